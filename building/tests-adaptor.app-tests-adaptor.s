@@ -0,0 +1,4959 @@
+	.file	"tests-adaptor.cpp"
+	.text
+	.section	.text._ZN1n13heap_resourceD2Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD2Ev
+	.type	_ZN1n13heap_resourceD2Ev, @function
+_ZN1n13heap_resourceD2Ev:
+.LFB7338:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7338:
+	.size	_ZN1n13heap_resourceD2Ev, .-_ZN1n13heap_resourceD2Ev
+	.weak	_ZN1n13heap_resourceD1Ev
+	.set	_ZN1n13heap_resourceD1Ev,_ZN1n13heap_resourceD2Ev
+	.section	.text._ZN1n13heap_resource10deallocateEPvmm,"axG",@progbits,_ZN1n13heap_resource10deallocateEPvmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource10deallocateEPvmm
+	.type	_ZN1n13heap_resource10deallocateEPvmm, @function
+_ZN1n13heap_resource10deallocateEPvmm:
+.LFB6799:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rcx
+	jbe	.L4
+	movq	%rcx, %rsi
+	jmp	_ZdlPvSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	jmp	_ZdlPv@PLT
+	.cfi_endproc
+.LFE6799:
+	.size	_ZN1n13heap_resource10deallocateEPvmm, .-_ZN1n13heap_resource10deallocateEPvmm
+	.section	.text._ZN1n13heap_resource8allocateEmm,"axG",@progbits,_ZN1n13heap_resource8allocateEmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource8allocateEmm
+	.type	_ZN1n13heap_resource8allocateEmm, @function
+_ZN1n13heap_resource8allocateEmm:
+.LFB6798:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rdx
+	jbe	.L6
+	movq	%rdx, %rsi
+	jmp	_ZnwmSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	jmp	_Znwm@PLT
+	.cfi_endproc
+.LFE6798:
+	.size	_ZN1n13heap_resource8allocateEmm, .-_ZN1n13heap_resource8allocateEmm
+	.section	.text._ZN1n13heap_resourceD0Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD0Ev
+	.type	_ZN1n13heap_resourceD0Ev, @function
+_ZN1n13heap_resourceD0Ev:
+.LFB7340:
+	.cfi_startproc
+	movl	$8, %esi
+	jmp	_ZdlPvm@PLT
+	.cfi_endproc
+.LFE7340:
+	.size	_ZN1n13heap_resourceD0Ev, .-_ZN1n13heap_resourceD0Ev
+	.section	.text._ZN1n13__frame_cacheD2Ev,"axG",@progbits,_ZN1n13__frame_cacheD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13__frame_cacheD2Ev
+	.type	_ZN1n13__frame_cacheD2Ev, @function
+_ZN1n13__frame_cacheD2Ev:
+.LFB6854:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6854
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	leaq	_ZZN1n4heapEvE7storage(%rip), %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movl	$64, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	jmp	.L23
+	.p2align 4,,10
+	.p2align 3
+.L11:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %ecx
+	movq	%r12, %rdx
+	movq	%rbx, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L23:
+	movq	0(%rbp), %rbx
+	testq	%rbx, %rbx
+	je	.L24
+	movq	(%rbx), %rax
+	movq	%rax, 0(%rbp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L11
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L11
+	movq	%r13, %rdi
+	movq	%r15, _ZZN1n4heapEvE7storage(%rip)
+	movq	%r14, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L11
+	.p2align 4,,10
+	.p2align 3
+.L24:
+	addq	$64, %r12
+	addq	$8, %rbp
+	cmpq	$2112, %r12
+	jne	.L23
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE6854:
+	.globl	__gxx_personality_v0
+	.section	.gcc_except_table._ZN1n13__frame_cacheD2Ev,"aG",@progbits,_ZN1n13__frame_cacheD5Ev,comdat
+.LLSDA6854:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6854-.LLSDACSB6854
+.LLSDACSB6854:
+.LLSDACSE6854:
+	.section	.text._ZN1n13__frame_cacheD2Ev,"axG",@progbits,_ZN1n13__frame_cacheD5Ev,comdat
+	.size	_ZN1n13__frame_cacheD2Ev, .-_ZN1n13__frame_cacheD2Ev
+	.weak	_ZN1n13__frame_cacheD1Ev
+	.set	_ZN1n13__frame_cacheD1Ev,_ZN1n13__frame_cacheD2Ev
+	.section	.text.unlikely,"ax",@progbits
+.LCOLDB0:
+	.text
+.LHOTB0:
+	.p2align 4
+	.type	_Z7counterPZ7counteriE17_Z7counteri.Frame.actor, @function
+_Z7counterPZ7counteriE17_Z7counteri.Frame.actor:
+.LFB7001:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movzwl	52(%rdi), %eax
+	testb	$1, %al
+	je	.L26
+	cmpw	$7, %ax
+	ja	.L27
+	movl	$170, %edx
+	btq	%rax, %rdx
+	jnc	.L27
+.L28:
+	cmpb	$0, 54(%rbx)
+	jne	.L48
+.L33:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L26:
+	.cfi_restore_state
+	cmpw	$4, %ax
+	je	.L29
+	ja	.L30
+	testw	%ax, %ax
+	jne	.L49
+	movl	$2, %ecx
+	movq	%rdi, 40(%rbx)
+	movb	$0, 55(%rdi)
+	movw	%cx, 52(%rdi)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L30:
+	.cfi_restore_state
+	cmpw	$6, %ax
+	je	.L28
+	jmp	.L27
+	.p2align 4,,10
+	.p2align 3
+.L49:
+	cmpw	$2, %ax
+	jne	.L50
+	xorl	%eax, %eax
+	movb	$1, 55(%rdi)
+	movl	%eax, 60(%rbx)
+	cmpl	%eax, 48(%rbx)
+	jle	.L51
+.L35:
+	movl	%eax, 64(%rbx)
+	leaq	16(%rbx), %rax
+	movl	$4, %edx
+	movq	%rax, 72(%rbx)
+	leaq	64(%rbx), %rax
+	movw	%dx, 52(%rbx)
+	movq	%rax, 16(%rbx)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L48:
+	.cfi_restore_state
+	cmpb	$0, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	je	.L52
+.L36:
+	movq	%fs:264+_ZZN1n8__framesEvE5cache@tpoff, %rax
+	cmpq	$16, %rax
+	je	.L53
+	movq	%fs:8+_ZZN1n8__framesEvE5cache@tpoff, %rdx
+	addq	$1, %rax
+	movq	%rdx, (%rbx)
+	movq	%rbx, %fs:8+_ZZN1n8__framesEvE5cache@tpoff
+	movq	%rax, %fs:264+_ZZN1n8__framesEvE5cache@tpoff
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L51:
+	.cfi_restore_state
+	movl	$6, %eax
+	movq	$0, (%rbx)
+	movw	%ax, 52(%rbx)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L52:
+	.cfi_restore_state
+	movq	%fs:0, %rax
+	leaq	__dso_handle(%rip), %rdx
+	movb	$1, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	leaq	_ZN1n13__frame_cacheD1Ev(%rip), %rdi
+	leaq	_ZZN1n8__framesEvE5cache@tpoff(%rax), %rsi
+	call	__cxa_thread_atexit@PLT
+	jmp	.L36
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	movl	60(%rdi), %eax
+	addl	$1, %eax
+	movl	%eax, 60(%rbx)
+	cmpl	%eax, 48(%rbx)
+	jg	.L35
+	jmp	.L51
+	.p2align 4,,10
+	.p2align 3
+.L53:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L54
+.L39:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%rbx, %rsi
+	movl	$16, %ecx
+	movl	$128, %edx
+	movq	(%rdi), %rax
+	movq	24(%rax), %rax
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	jmp	*%rax
+.L54:
+	.cfi_restore_state
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L39
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L39
+.L50:
+	jmp	.L27
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.type	_Z7counterPZ7counteriE17_Z7counteri.Frame.actor.cold, @function
+_Z7counterPZ7counteriE17_Z7counteri.Frame.actor.cold:
+.LFSB7001:
+.L27:
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	ud2
+	.cfi_endproc
+.LFE7001:
+	.text
+	.size	_Z7counterPZ7counteriE17_Z7counteri.Frame.actor, .-_Z7counterPZ7counteriE17_Z7counteri.Frame.actor
+	.section	.text.unlikely
+	.size	_Z7counterPZ7counteriE17_Z7counteri.Frame.actor.cold, .-_Z7counterPZ7counteriE17_Z7counteri.Frame.actor.cold
+.LCOLDE0:
+	.text
+.LHOTE0:
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC1:
+	.string	"a,bb,,ccc,"
+.LC2:
+	.string	"abc"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC4:
+	.string	"expected equal : expected value : pieces, actual value : 5"
+	.align 8
+.LC5:
+	.string	"expected equal : expected value : lens[0], actual value : 1"
+	.align 8
+.LC6:
+	.string	"expected equal : expected value : lens[1], actual value : 2"
+	.align 8
+.LC7:
+	.string	"expected equal : expected value : lens[2], actual value : 0"
+	.align 8
+.LC8:
+	.string	"expected equal : expected value : lens[3], actual value : 3"
+	.align 8
+.LC9:
+	.string	"expected equal : expected value : lens[4], actual value : 0"
+	.align 8
+.LC10:
+	.string	"expected equal : expected value : none.next().len(), actual value : 3"
+	.align 8
+.LC11:
+	.string	"expected false : none.has_next()"
+	.section	.text.unlikely
+.LCOLDB13:
+	.text
+.LHOTB13:
+	.p2align 4
+	.globl	_Z10test_splitv
+	.type	_Z10test_splitv, @function
+_Z10test_splitv:
+.LFB7071:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7071
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$184, %rsp
+	.cfi_def_cfa_offset 240
+	movdqa	.LC3(%rip), %xmm1
+	movaps	%xmm1, 16(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L56
+	pxor	%xmm0, %xmm0
+	leaq	40(%rsp), %r13
+	movq	%rax, 32(%rsp)
+	xorl	%r12d, %r12d
+	leaq	.LC1(%rip), %rbp
+	movups	%xmm0, 40(%rsp)
+	movq	$0, 56(%rsp)
+	cmpq	%r13, %rbp
+	jb	.L121
+.L211:
+	leaq	.LC1(%rip), %rsi
+.L213:
+	movq	%r13, %rbx
+.L57:
+	leaq	(%rbx,%r12), %rdi
+	movl	$10, %edx
+	leaq	40(%rsp), %r12
+	call	memmove@PLT
+	movq	16(%rsp), %rax
+	leaq	10(%rax), %rdx
+	movq	%rdx, 16(%rsp)
+	movb	$0, 10(%rbx,%rax)
+	movq	24(%rsp), %r13
+	movq	16(%rsp), %rbx
+	cmpq	$23, %r13
+	je	.L70
+	movq	40(%rsp), %r12
+.L70:
+	movq	%rbx, %rdx
+	movl	$44, %esi
+	movq	%r12, %rdi
+	call	memchr@PLT
+	movq	%rax, %rbp
+	testq	%rax, %rax
+	je	.L71
+	subq	%r12, %rbp
+	cmpq	$-1, %rbp
+	je	.L71
+	subq	$1, %rbx
+	leaq	1(%r12,%rbp), %r14
+	movl	$44, %esi
+	subq	%rbp, %rbx
+	movq	%r14, %rdi
+	movq	%rbx, %rdx
+	call	memchr@PLT
+	movq	%rax, %r12
+	testq	%rax, %rax
+	je	.L71
+	subq	%r14, %r12
+	cmpq	$-1, %r12
+	je	.L71
+	subq	$1, %rbx
+	leaq	1(%r14,%r12), %r15
+	movl	$44, %esi
+	subq	%r12, %rbx
+	movq	%r15, %rdi
+	movq	%rbx, %rdx
+	call	memchr@PLT
+	movq	%rax, %r14
+	testq	%rax, %rax
+	je	.L71
+	subq	%r15, %r14
+	cmpq	$-1, %r14
+	je	.L71
+	subq	$1, %rbx
+	leaq	1(%r15,%r14), %r15
+	movl	$44, %esi
+	subq	%r14, %rbx
+	movq	%r15, %rdi
+	movq	%rbx, %rdx
+	call	memchr@PLT
+	movq	%rax, %rcx
+	testq	%rax, %rax
+	je	.L71
+	subq	%r15, %rcx
+	cmpq	$-1, %rcx
+	je	.L71
+	subq	$1, %rbx
+	leaq	1(%r15,%rcx), %r15
+	movl	$44, %esi
+	movq	%rcx, (%rsp)
+	subq	%rcx, %rbx
+	movq	%r15, %rdi
+	movq	%rbx, %rdx
+	call	memchr@PLT
+	movq	(%rsp), %rcx
+	testq	%rax, %rax
+	je	.L72
+	subq	%r15, %rax
+	cmpq	$-1, %rax
+	je	.L72
+	subq	$1, %rbx
+	leaq	1(%r15,%rax), %rbp
+	movl	$44, %esi
+	subq	%rax, %rbx
+	movq	%rbp, %rdi
+	movq	%rbx, %rdx
+	call	memchr@PLT
+.L71:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC4(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB0:
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L72:
+	movq	%rbx, 144(%rsp)
+	cmpq	$1, %rbp
+	jne	.L205
+	cmpq	$2, %r12
+	jne	.L206
+	testq	%r14, %r14
+	jne	.L207
+	cmpq	$3, %rcx
+	jne	.L208
+	testq	%rbx, %rbx
+	jne	.L209
+	movdqa	.LC3(%rip), %xmm2
+	movaps	%xmm2, 64(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r12
+	testq	%r12, %r12
+	je	.L78
+	pxor	%xmm0, %xmm0
+	leaq	88(%rsp), %rbp
+	movq	%r12, 80(%rsp)
+	leaq	.LC2(%rip), %rsi
+	movups	%xmm0, 88(%rsp)
+	movl	$23, %r14d
+	movq	%rbp, %r15
+	movq	$0, 104(%rsp)
+	cmpq	%rbp, %rsi
+	jb	.L80
+.L79:
+	leaq	(%r15,%rbx), %rax
+	cmpq	%rax, %rsi
+	jnb	.L215
+	subq	%r15, %rsi
+	movq	%rsi, (%rsp)
+	cmpq	%rcx, %r14
+	jnb	.L117
+	leaq	10(%r14,%r14), %rax
+	movl	$1, %edx
+	movq	%r12, %rdi
+	cmpq	%rcx, %rax
+	cmovnb	%rax, %rcx
+	movq	(%r12), %rax
+	movq	%rcx, 8(%rsp)
+	leaq	1(%rcx), %rsi
+	call	*16(%rax)
+	leaq	1(%rbx), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L89
+	movq	(%r12), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r12, %rdi
+	call	*24(%rax)
+.L89:
+	movq	8(%rsp), %rax
+	movq	%rbp, 88(%rsp)
+	movq	%rax, 72(%rsp)
+	movq	%rax, %r14
+.L88:
+	cmpq	$23, %r14
+	jne	.L214
+	leaq	88(%rsp), %rbp
+.L214:
+	movq	(%rsp), %rsi
+	addq	%rbp, %rsi
+.L80:
+	leaq	0(%rbp,%rbx), %rdi
+	movl	$3, %edx
+	call	memmove@PLT
+	movq	64(%rsp), %rax
+	leaq	3(%rax), %rdx
+	movq	%rdx, 64(%rsp)
+	movb	$0, 3(%rbp,%rax)
+	movq	72(%rsp), %rbx
+	leaq	88(%rsp), %rbp
+	movq	64(%rsp), %r12
+	cmpq	$23, %rbx
+	je	.L92
+	movq	88(%rsp), %rbp
+.L92:
+	movq	%r12, %rdx
+	movl	$44, %esi
+	movq	%rbp, %rdi
+	call	memchr@PLT
+	testq	%rax, %rax
+	je	.L93
+	subq	%rbp, %rax
+	cmpq	$-1, %rax
+	je	.L93
+	cmpq	$3, %rax
+	jne	.L96
+	jmp	.L210
+	.p2align 4,,10
+	.p2align 3
+.L215:
+	cmpq	%rcx, %r14
+	jnb	.L116
+.L105:
+	leaq	10(%r14,%r14), %rax
+	movl	$1, %edx
+	movq	%r12, %rdi
+	cmpq	%rcx, %rax
+	cmovnb	%rax, %rcx
+	movq	(%r12), %rax
+	movq	%rcx, (%rsp)
+	leaq	1(%rcx), %rsi
+	call	*16(%rax)
+	leaq	1(%rbx), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L87
+	movq	(%r12), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r12, %rdi
+	call	*24(%rax)
+.LEHE0:
+.L87:
+	movq	(%rsp), %rax
+	movq	%rbp, 88(%rsp)
+	movq	%rax, 72(%rsp)
+.L86:
+	cmpq	$23, (%rsp)
+	leaq	.LC2(%rip), %rsi
+	jne	.L80
+	leaq	88(%rsp), %rbp
+	jmp	.L80
+	.p2align 4,,10
+	.p2align 3
+.L93:
+	cmpq	$3, %r12
+	jne	.L96
+	cmpq	$23, %rbx
+	je	.L104
+	movq	80(%rsp), %rdi
+	movq	88(%rsp), %rsi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L104:
+	cmpq	$23, %r13
+	je	.L55
+	movq	32(%rsp), %rdi
+	movq	40(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L55:
+	addq	$184, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L121:
+	.cfi_restore_state
+	movq	%rbp, %rsi
+	jmp	.L213
+.L117:
+	xorl	%ebp, %ebp
+	jmp	.L88
+	.p2align 4,,10
+	.p2align 3
+.L78:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L216
+.L82:
+	movq	_ZZN1n4heapEvE3res(%rip), %r12
+	movq	64(%rsp), %rbx
+	pxor	%xmm0, %xmm0
+	xorl	%r15d, %r15d
+	movq	72(%rsp), %r14
+	movq	24(%rsp), %r13
+	movq	$0, 104(%rsp)
+	leaq	.LC2(%rip), %rsi
+	movq	%r12, 80(%rsp)
+	leaq	3(%rbx), %rcx
+	movups	%xmm0, 88(%rsp)
+	cmpq	$23, %r14
+	jne	.L79
+	leaq	88(%rsp), %rbp
+	cmpq	%rbp, %rsi
+	jnb	.L217
+	cmpq	$23, %rcx
+	jbe	.L80
+	movq	%rbp, %r15
+	jmp	.L105
+	.p2align 4,,10
+	.p2align 3
+.L56:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L218
+.L61:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	16(%rsp), %r12
+	pxor	%xmm0, %xmm0
+	xorl	%r13d, %r13d
+	movq	24(%rsp), %r14
+	movups	%xmm0, 40(%rsp)
+	leaq	.LC1(%rip), %rbp
+	movq	%r15, 32(%rsp)
+	leaq	10(%r12), %rax
+	movq	$0, 56(%rsp)
+	cmpq	$23, %r14
+	je	.L219
+.L63:
+	leaq	0(%r13,%r12), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L220
+	subq	%r13, %rbp
+	movq	%rbp, (%rsp)
+	cmpq	%rax, %r14
+	jnb	.L111
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %rbp
+	movq	(%r15), %rax
+.LEHB1:
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L67
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L67:
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, %r14
+	movq	%rbp, 24(%rsp)
+.L66:
+	cmpq	$23, %r14
+	je	.L68
+	movq	(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L57
+.L220:
+	cmpq	%rax, %r14
+	jnb	.L110
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %rbp
+	movq	(%r15), %rax
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L65
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L65:
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, 24(%rsp)
+.L59:
+	leaq	.LC1(%rip), %rsi
+	cmpq	$23, %rbp
+	jne	.L57
+	leaq	40(%rsp), %r13
+	jmp	.L211
+	.p2align 4,,10
+	.p2align 3
+.L116:
+	movq	%r14, (%rsp)
+	xorl	%ebp, %ebp
+	jmp	.L86
+.L218:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L61
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L61
+.L216:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L82
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L82
+.L110:
+	xorl	%ebx, %ebx
+	movq	%r14, %rbp
+	jmp	.L59
+.L111:
+	xorl	%ebx, %ebx
+	jmp	.L66
+.L68:
+	movq	(%rsp), %rsi
+	leaq	40(%rsp), %r13
+	addq	%r13, %rsi
+	jmp	.L213
+.L219:
+	leaq	40(%rsp), %r13
+	cmpq	%r13, %rbp
+	jnb	.L63
+	cmpq	$23, %rax
+	jbe	.L121
+	movl	$56, %edx
+	movq	%r15, %rdi
+	cmpq	%rdx, %rax
+	cmovnb	%rax, %rdx
+	movq	(%r15), %rax
+	leaq	1(%rdx), %rsi
+	movq	%rdx, %r14
+	movl	$1, %edx
+	call	*16(%rax)
+.LEHE1:
+	movq	%r13, %rsi
+	leaq	1(%r12), %rdx
+	movq	%rax, %rbx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, %rsi
+	movq	%r14, 24(%rsp)
+	jmp	.L57
+.L217:
+	movq	%rbp, %r15
+	jmp	.L79
+.L203:
+	jmp	.L204
+	.section	.gcc_except_table,"a",@progbits
+.LLSDA7071:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7071-.LLSDACSB7071
+.LLSDACSB7071:
+	.uleb128 .LEHB0-.LFB7071
+	.uleb128 .LEHE0-.LEHB0
+	.uleb128 .L203-.LFB7071
+	.uleb128 0
+	.uleb128 .LEHB1-.LFB7071
+	.uleb128 .LEHE1-.LEHB1
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE7071:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7071
+	.type	_Z10test_splitv.cold, @function
+_Z10test_splitv.cold:
+.LFSB7071:
+.L207:
+	.cfi_def_cfa_offset 240
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC7(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB2:
+	call	__cxa_throw@PLT
+.L209:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC9(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE2:
+.L122:
+.L204:
+	movq	%rax, %rbp
+.L101:
+	movq	24(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L102
+	movq	32(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	40(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L102:
+	movq	%rbp, %rdi
+.LEHB3:
+	call	_Unwind_Resume@PLT
+.LEHE3:
+.L206:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC6(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB4:
+	call	__cxa_throw@PLT
+.L208:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC8(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L205:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC5(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE4:
+.L210:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC11(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB5:
+	call	__cxa_throw@PLT
+.L96:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC10(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE5:
+.L123:
+	movq	%rax, %rbp
+	cmpq	$23, %rbx
+	je	.L101
+	movq	80(%rsp), %rdi
+	movq	88(%rsp), %rsi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L101
+	.cfi_endproc
+.LFE7071:
+	.section	.gcc_except_table
+.LLSDAC7071:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7071-.LLSDACSBC7071
+.LLSDACSBC7071:
+	.uleb128 .LEHB2-.LCOLDB13
+	.uleb128 .LEHE2-.LEHB2
+	.uleb128 .L122-.LCOLDB13
+	.uleb128 0
+	.uleb128 .LEHB3-.LCOLDB13
+	.uleb128 .LEHE3-.LEHB3
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB4-.LCOLDB13
+	.uleb128 .LEHE4-.LEHB4
+	.uleb128 .L122-.LCOLDB13
+	.uleb128 0
+	.uleb128 .LEHB5-.LCOLDB13
+	.uleb128 .LEHE5-.LEHB5
+	.uleb128 .L123-.LCOLDB13
+	.uleb128 0
+.LLSDACSEC7071:
+	.section	.text.unlikely
+	.text
+	.size	_Z10test_splitv, .-_Z10test_splitv
+	.section	.text.unlikely
+	.size	_Z10test_splitv.cold, .-_Z10test_splitv.cold
+.LCOLDE13:
+	.text
+.LHOTE13:
+	.section	.text.unlikely
+.LCOLDB14:
+	.text
+.LHOTB14:
+	.p2align 4
+	.type	_Z7counterPZ7counteriE17_Z7counteri.Frame.destroy, @function
+_Z7counterPZ7counteriE17_Z7counteri.Frame.destroy:
+.LFB7002:
+	.cfi_startproc
+	movzwl	52(%rdi), %eax
+	orl	$1, %eax
+	movw	%ax, 52(%rdi)
+	cmpw	$7, %ax
+	ja	.L222
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	cmpb	$0, 54(%rdi)
+	jne	.L236
+.L224:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L236:
+	.cfi_restore_state
+	cmpb	$0, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	je	.L237
+.L225:
+	movq	%fs:264+_ZZN1n8__framesEvE5cache@tpoff, %rax
+	cmpq	$16, %rax
+	je	.L238
+	movq	%fs:8+_ZZN1n8__framesEvE5cache@tpoff, %rdx
+	addq	$1, %rax
+	movq	%rdx, (%rbx)
+	movq	%rbx, %fs:8+_ZZN1n8__framesEvE5cache@tpoff
+	movq	%rax, %fs:264+_ZZN1n8__framesEvE5cache@tpoff
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L237:
+	.cfi_restore_state
+	movq	%fs:0, %rax
+	leaq	__dso_handle(%rip), %rdx
+	movb	$1, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	leaq	_ZN1n13__frame_cacheD1Ev(%rip), %rdi
+	leaq	_ZZN1n8__framesEvE5cache@tpoff(%rax), %rsi
+	call	__cxa_thread_atexit@PLT
+	jmp	.L225
+	.p2align 4,,10
+	.p2align 3
+.L238:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L239
+.L228:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%rbx, %rsi
+	movl	$16, %ecx
+	movl	$128, %edx
+	movq	(%rdi), %rax
+	movq	24(%rax), %rax
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+	jmp	*%rax
+.L239:
+	.cfi_restore_state
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L228
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L228
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.type	_Z7counterPZ7counteriE17_Z7counteri.Frame.destroy.cold, @function
+_Z7counterPZ7counteriE17_Z7counteri.Frame.destroy.cold:
+.LFSB7002:
+.L222:
+	ud2
+	.cfi_endproc
+.LFE7002:
+	.text
+	.size	_Z7counterPZ7counteriE17_Z7counteri.Frame.destroy, .-_Z7counterPZ7counteriE17_Z7counteri.Frame.destroy
+	.section	.text.unlikely
+	.size	_Z7counterPZ7counteriE17_Z7counteri.Frame.destroy.cold, .-_Z7counterPZ7counteriE17_Z7counteri.Frame.destroy.cold
+.LCOLDE14:
+	.text
+.LHOTE14:
+	.section	.rodata._ZN1n4test10test_suite7run_allEv.str1.1,"aMS",@progbits,1
+.LC15:
+	.string	"\nSUITE [%s] "
+.LC17:
+	.string	"%s"
+.LC18:
+	.string	"\nTEST [%s] "
+.LC19:
+	.string	" - Result : \033[1;32mPASSED\033[0m"
+.LC20:
+	.string	"\033[1;31merror : %s\033[0m\n"
+.LC21:
+	.string	" - Result : \033[1;31mFAILED\033[0m"
+.LC22:
+	.string	" - Passed : \033[1;32m%d\033[0m\n"
+.LC23:
+	.string	" - Failed : \033[1;31m%d\033[0m\n"
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4test10test_suite7run_allEv
+	.type	_ZN1n4test10test_suite7run_allEv, @function
+_ZN1n4test10test_suite7run_allEv:
+.LFB6992:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6992
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	leaq	.LC15(%rip), %rdx
+	movl	$79, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	16(%rdi), %rcx
+	leaq	16(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L241
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L242
+	testb	$4, %cl
+	jne	.L295
+	testl	%ecx, %ecx
+	je	.L241
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L296
+	.p2align 4,,10
+	.p2align 3
+.L241:
+	movzwl	.LC16(%rip), %r15d
+	movq	%rbx, %rsi
+	leaq	.LC17(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+.LEHB6:
+	call	printf@PLT
+	movl	8(%r12), %esi
+	testl	%esi, %esi
+	jle	.L262
+	movl	$0, 12(%rsp)
+	xorl	%ebp, %ebp
+	xorl	%r14d, %r14d
+	jmp	.L256
+	.p2align 4,,10
+	.p2align 3
+.L299:
+	testb	$4, %dl
+	jne	.L297
+	testl	%edx, %edx
+	je	.L247
+	movb	$42, (%rax)
+	testb	$2, %dl
+	jne	.L298
+	.p2align 4,,10
+	.p2align 3
+.L247:
+	movq	%rbx, %rsi
+	leaq	.LC17(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+.LEHE6:
+	movq	(%r12), %rax
+.LEHB7:
+	call	*8(%rax,%r13)
+.LEHE7:
+	leaq	.LC19(%rip), %rdi
+	addl	$1, %r14d
+.LEHB8:
+	call	puts@PLT
+.L252:
+	addq	$1, %rbp
+	cmpl	%ebp, 8(%r12)
+	jle	.L246
+.L256:
+	movq	(%r12), %rax
+	movq	%rbp, %r13
+	movq	%rbx, %rdi
+	movl	$79, %esi
+	salq	$4, %r13
+	leaq	.LC18(%rip), %rdx
+	movq	(%rax,%r13), %rcx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L247
+	movl	$79, %edx
+	subl	%eax, %edx
+	addq	%rbx, %rax
+	cmpl	$8, %edx
+	jb	.L299
+	movabsq	$3038287259199220266, %rsi
+	leaq	8(%rax), %rdi
+	movl	%edx, %ecx
+	andq	$-8, %rdi
+	movq	%rsi, (%rax)
+	movq	%rsi, -8(%rax,%rcx)
+	subq	%rdi, %rax
+	leal	(%rdx,%rax), %ecx
+	movq	%rsi, %rax
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L247
+.L262:
+	movl	$0, 12(%rsp)
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L246:
+	movabsq	$5917806138674729738, %rax
+	movq	%rbx, %rdi
+	movq	%rax, 16(%rsp)
+	movabsq	$9095440486453792, %rax
+	movq	%rax, 22(%rsp)
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L257
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L258
+	testb	$4, %cl
+	jne	.L300
+	testl	%ecx, %ecx
+	je	.L257
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L301
+.L257:
+	movq	%rbx, %rsi
+	leaq	.LC17(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+	movl	%r14d, %esi
+	leaq	.LC22(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	12(%rsp), %esi
+	leaq	.LC23(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	$10, %edi
+	call	putchar@PLT
+.LEHE8:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L258:
+	.cfi_restore_state
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L257
+.L242:
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L241
+.L297:
+	movl	$707406378, (%rax)
+	movl	$707406378, -4(%rax,%rdx)
+	jmp	.L247
+.L298:
+	movl	$10794, %ecx
+	movw	%cx, -2(%rax,%rdx)
+	jmp	.L247
+.L296:
+	movl	$10794, %edi
+	movw	%di, -2(%rdx,%rcx)
+	jmp	.L241
+.L301:
+	movl	$10794, %eax
+	movw	%ax, -2(%rdx,%rcx)
+	jmp	.L257
+.L295:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L241
+.L300:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L257
+.L263:
+	movq	%rax, %rdi
+	movq	%rdx, %rax
+.L253:
+	subq	$1, %rax
+	jne	.L294
+	call	__cxa_begin_catch@PLT
+	leaq	.LC20(%rip), %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+.LEHB9:
+	call	printf@PLT
+.LEHE9:
+	call	__cxa_end_catch@PLT
+	leaq	.LC21(%rip), %rdi
+	addl	$1, 12(%rsp)
+.LEHB10:
+	call	puts@PLT
+	jmp	.L252
+.L255:
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+.L294:
+	call	_Unwind_Resume@PLT
+.LEHE10:
+.L264:
+	movq	%rax, %rbx
+	jmp	.L255
+	.cfi_endproc
+.LFE6992:
+	.section	.gcc_except_table
+	.align 4
+.LLSDA6992:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT6992-.LLSDATTD6992
+.LLSDATTD6992:
+	.byte	0x1
+	.uleb128 .LLSDACSE6992-.LLSDACSB6992
+.LLSDACSB6992:
+	.uleb128 .LEHB6-.LFB6992
+	.uleb128 .LEHE6-.LEHB6
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB7-.LFB6992
+	.uleb128 .LEHE7-.LEHB7
+	.uleb128 .L263-.LFB6992
+	.uleb128 0x1
+	.uleb128 .LEHB8-.LFB6992
+	.uleb128 .LEHE8-.LEHB8
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB9-.LFB6992
+	.uleb128 .LEHE9-.LEHB9
+	.uleb128 .L264-.LFB6992
+	.uleb128 0
+	.uleb128 .LEHB10-.LFB6992
+	.uleb128 .LEHE10-.LEHB10
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6992:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	DW.ref._ZTIPKc-.
+.LLSDATT6992:
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.size	_ZN1n4test10test_suite7run_allEv, .-_ZN1n4test10test_suite7run_allEv
+	.section	.text.unlikely
+.LCOLDB24:
+	.text
+.LHOTB24:
+	.p2align 4
+	.globl	_Z4iotai
+	.type	_Z4iotai, @function
+_Z4iotai:
+.LFB6993:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6993
+	pxor	%xmm0, %xmm0
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	movl	%esi, %r14d
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movq	%rdi, %rbx
+	movq	$0, (%rdi)
+	movups	%xmm0, 8(%rdi)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L328
+.L303:
+	movq	%rax, 24(%rbx)
+	testl	%r14d, %r14d
+	jle	.L302
+	movq	16(%rbx), %rdx
+	xorl	%ebp, %ebp
+	jmp	.L312
+	.p2align 4,,10
+	.p2align 3
+.L308:
+	movl	%ebp, 0(%r13,%rdx,4)
+.L311:
+	addq	$1, %rdx
+	addl	$1, %ebp
+	movq	%rdx, 16(%rbx)
+	cmpl	%r14d, %ebp
+	je	.L302
+.L312:
+	movq	8(%rbx), %r12
+	movq	(%rbx), %r13
+	cmpq	%r12, %rdx
+	jne	.L308
+	leaq	5(%r12), %rsi
+	movq	24(%rbx), %rdi
+	movl	$4, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$3, %rsi
+	movq	%rax, 8(%rbx)
+	movq	(%rdi), %rax
+.LEHB11:
+	call	*16(%rax)
+	movq	16(%rbx), %rdx
+	movq	%rax, %rdi
+	movq	%rax, (%rbx)
+	movl	%ebp, (%rdi,%rdx,4)
+	leaq	0(,%rdx,4), %rax
+	testq	%rdx, %rdx
+	jne	.L329
+	testq	%r13, %r13
+	je	.L311
+.L310:
+	movq	24(%rbx), %rdi
+	leaq	0(,%r12,4), %rdx
+	movl	$4, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE11:
+	movq	16(%rbx), %rdx
+	addl	$1, %ebp
+	addq	$1, %rdx
+	movq	%rdx, 16(%rbx)
+	cmpl	%r14d, %ebp
+	jne	.L312
+.L302:
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L329:
+	.cfi_restore_state
+	movq	%rax, %rdx
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L310
+	.p2align 4,,10
+	.p2align 3
+.L328:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L330
+.L305:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	jmp	.L303
+.L330:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L305
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L305
+.L316:
+	movq	%rax, %rbp
+	jmp	.L314
+	.section	.gcc_except_table
+.LLSDA6993:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6993-.LLSDACSB6993
+.LLSDACSB6993:
+	.uleb128 .LEHB11-.LFB6993
+	.uleb128 .LEHE11-.LEHB11
+	.uleb128 .L316-.LFB6993
+	.uleb128 0
+.LLSDACSE6993:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6993
+	.type	_Z4iotai.cold, @function
+_Z4iotai.cold:
+.LFSB6993:
+.L314:
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	.cfi_offset 6, -40
+	.cfi_offset 12, -32
+	.cfi_offset 13, -24
+	.cfi_offset 14, -16
+	movq	(%rbx), %rsi
+	movq	8(%rbx), %rdx
+	testq	%rsi, %rsi
+	je	.L315
+	movq	24(%rbx), %rdi
+	salq	$2, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L315:
+	movq	%rbp, %rdi
+.LEHB12:
+	call	_Unwind_Resume@PLT
+.LEHE12:
+	.cfi_endproc
+.LFE6993:
+	.section	.gcc_except_table
+.LLSDAC6993:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6993-.LLSDACSBC6993
+.LLSDACSBC6993:
+	.uleb128 .LEHB12-.LCOLDB24
+	.uleb128 .LEHE12-.LEHB12
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6993:
+	.section	.text.unlikely
+	.text
+	.size	_Z4iotai, .-_Z4iotai
+	.section	.text.unlikely
+	.size	_Z4iotai.cold, .-_Z4iotai.cold
+.LCOLDE24:
+	.text
+.LHOTE24:
+	.section	.rodata.str1.8
+	.align 8
+.LC25:
+	.string	"expected equal : expected value : c.len(), actual value : 3"
+	.align 8
+.LC26:
+	.string	"expected equal : expected value : c.next().data()[0], actual value : 4"
+	.align 8
+.LC27:
+	.string	"expected equal : expected value : c.next().len(), actual value : 2"
+	.align 8
+.LC28:
+	.string	"expected equal : expected value : sums, actual value : 2 * (1 + 2 + 3 + 4 + 5 + 6 + 7 + 8)"
+	.section	.text.unlikely
+.LCOLDB29:
+	.text
+.LHOTB29:
+	.p2align 4
+	.globl	_Z17test_chunk_windowv
+	.type	_Z17test_chunk_windowv, @function
+_Z17test_chunk_windowv:
+.LFB7063:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7063
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movl	$10, %esi
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$32, %rsp
+	.cfi_def_cfa_offset 64
+	movq	%rsp, %rdi
+.LEHB13:
+	call	_Z4iotai
+.LEHE13:
+	movq	16(%rsp), %rdx
+	movq	(%rsp), %rbx
+	leaq	3(%rdx), %rax
+	shrq	$2, %rax
+	cmpq	$3, %rax
+	jne	.L348
+	cmpl	$4, 16(%rbx)
+	jne	.L349
+	cmpq	$10, %rdx
+	jne	.L350
+	movdqu	24(%rbx), %xmm0
+	movdqu	16(%rbx), %xmm2
+	movdqu	(%rbx), %xmm1
+	movdqu	8(%rbx), %xmm3
+	paddd	%xmm2, %xmm0
+	movq	8(%rsp), %rax
+	movq	24(%rsp), %rdi
+	paddd	%xmm3, %xmm1
+	paddd	%xmm1, %xmm0
+	leaq	0(,%rax,4), %rbp
+	movdqa	%xmm0, %xmm1
+	psrldq	$8, %xmm1
+	paddd	%xmm1, %xmm0
+	movdqa	%xmm0, %xmm1
+	psrldq	$4, %xmm1
+	paddd	%xmm1, %xmm0
+	movd	%xmm0, %eax
+	cmpl	$72, %eax
+	jne	.L351
+	movq	(%rdi), %rax
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movl	$4, %ecx
+	call	*24(%rax)
+	addq	$32, %rsp
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.section	.gcc_except_table
+.LLSDA7063:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7063-.LLSDACSB7063
+.LLSDACSB7063:
+	.uleb128 .LEHB13-.LFB7063
+	.uleb128 .LEHE13-.LEHB13
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE7063:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7063
+	.type	_Z17test_chunk_windowv.cold, @function
+_Z17test_chunk_windowv.cold:
+.LFSB7063:
+.L348:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -32
+	.cfi_offset 6, -24
+	.cfi_offset 12, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC25(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB14:
+	call	__cxa_throw@PLT
+.LEHE14:
+.L351:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC28(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB15:
+	call	__cxa_throw@PLT
+.LEHE15:
+.L341:
+	movq	%rax, %r12
+	movq	8(%rsp), %rax
+	testq	%rbx, %rbx
+	je	.L340
+.L355:
+	leaq	0(,%rax,4), %rbp
+.L337:
+	movq	24(%rsp), %rdi
+	movl	$4, %ecx
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L340:
+	movq	%r12, %rdi
+.LEHB16:
+	call	_Unwind_Resume@PLT
+.LEHE16:
+.L342:
+	movq	%rax, %r12
+	jmp	.L337
+.L350:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC27(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB17:
+	call	__cxa_throw@PLT
+.LEHE17:
+.L349:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC26(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB18:
+	call	__cxa_throw@PLT
+.LEHE18:
+.L344:
+.L354:
+	movq	%rax, %r12
+	movq	8(%rsp), %rax
+	jmp	.L355
+.L343:
+	jmp	.L354
+	.cfi_endproc
+.LFE7063:
+	.section	.gcc_except_table
+.LLSDAC7063:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7063-.LLSDACSBC7063
+.LLSDACSBC7063:
+	.uleb128 .LEHB14-.LCOLDB29
+	.uleb128 .LEHE14-.LEHB14
+	.uleb128 .L341-.LCOLDB29
+	.uleb128 0
+	.uleb128 .LEHB15-.LCOLDB29
+	.uleb128 .LEHE15-.LEHB15
+	.uleb128 .L342-.LCOLDB29
+	.uleb128 0
+	.uleb128 .LEHB16-.LCOLDB29
+	.uleb128 .LEHE16-.LEHB16
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB17-.LCOLDB29
+	.uleb128 .LEHE17-.LEHB17
+	.uleb128 .L344-.LCOLDB29
+	.uleb128 0
+	.uleb128 .LEHB18-.LCOLDB29
+	.uleb128 .LEHE18-.LEHB18
+	.uleb128 .L343-.LCOLDB29
+	.uleb128 0
+.LLSDACSEC7063:
+	.section	.text.unlikely
+	.text
+	.size	_Z17test_chunk_windowv, .-_Z17test_chunk_windowv
+	.section	.text.unlikely
+	.size	_Z17test_chunk_windowv.cold, .-_Z17test_chunk_windowv.cold
+.LCOLDE29:
+	.text
+.LHOTE29:
+	.section	.rodata.str1.8
+	.align 8
+.LC30:
+	.string	"expected equal : expected value : sum, actual value : 4 + 5 + 6 + 7 + 8"
+	.section	.text.unlikely
+.LCOLDB31:
+	.text
+.LHOTB31:
+	.p2align 4
+	.globl	_Z13test_pipelinev
+	.type	_Z13test_pipelinev, @function
+_Z13test_pipelinev:
+.LFB7080:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7080
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movl	$100, %esi
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$32, %rsp
+	.cfi_def_cfa_offset 64
+	movq	%rsp, %rdi
+.LEHB19:
+	call	_Z4iotai
+.LEHE19:
+	movq	16(%rsp), %rdi
+	movl	$10, %eax
+	movq	(%rsp), %rbx
+	movl	$5, %r8d
+	cmpq	%rax, %rdi
+	cmovbe	%rdi, %rax
+	xorl	%r9d, %r9d
+	subq	%rax, %rdi
+	leaq	(%rbx,%rax,4), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L360:
+	testq	%rdi, %rdi
+	je	.L357
+	xorl	%ecx, %ecx
+	jmp	.L359
+	.p2align 4,,10
+	.p2align 3
+.L379:
+	addq	$1, %rcx
+	addq	$4, %rdx
+	cmpq	%rdi, %rcx
+	je	.L357
+.L359:
+	movl	(%rdx), %esi
+	imull	$-1431655765, %esi, %eax
+	addl	$715827882, %eax
+	cmpl	$1431655764, %eax
+	ja	.L379
+	cmpq	%rdi, %rcx
+	je	.L357
+	movslq	%esi, %rax
+	sarl	$31, %esi
+	subq	%rcx, %rdi
+	addq	$4, %rdx
+	imulq	$1431655766, %rax, %rax
+	subq	$1, %rdi
+	shrq	$32, %rax
+	subl	%esi, %eax
+	addl	%eax, %r9d
+	subq	$1, %r8
+	jne	.L360
+.L357:
+	movq	8(%rsp), %rbp
+	cmpl	$30, %r9d
+	jne	.L377
+	testq	%rbx, %rbx
+	je	.L356
+	movq	24(%rsp), %rdi
+	leaq	0(,%rbp,4), %rdx
+	movl	$4, %ecx
+	movq	%rbx, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L356:
+	addq	$32, %rsp
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.section	.gcc_except_table
+.LLSDA7080:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7080-.LLSDACSB7080
+.LLSDACSB7080:
+	.uleb128 .LEHB19-.LFB7080
+	.uleb128 .LEHE19-.LEHB19
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE7080:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7080
+	.type	_Z13test_pipelinev.cold, @function
+_Z13test_pipelinev.cold:
+.LFSB7080:
+.L377:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -32
+	.cfi_offset 6, -24
+	.cfi_offset 12, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC30(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB20:
+	call	__cxa_throw@PLT
+.LEHE20:
+.L365:
+	movq	%rax, %r12
+	testq	%rbx, %rbx
+	je	.L364
+	movq	24(%rsp), %rdi
+	leaq	0(,%rbp,4), %rdx
+	movl	$4, %ecx
+	movq	%rbx, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L364:
+	movq	%r12, %rdi
+.LEHB21:
+	call	_Unwind_Resume@PLT
+.LEHE21:
+	.cfi_endproc
+.LFE7080:
+	.section	.gcc_except_table
+.LLSDAC7080:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7080-.LLSDACSBC7080
+.LLSDACSBC7080:
+	.uleb128 .LEHB20-.LCOLDB31
+	.uleb128 .LEHE20-.LEHB20
+	.uleb128 .L365-.LCOLDB31
+	.uleb128 0
+	.uleb128 .LEHB21-.LCOLDB31
+	.uleb128 .LEHE21-.LEHB21
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC7080:
+	.section	.text.unlikely
+	.text
+	.size	_Z13test_pipelinev, .-_Z13test_pipelinev
+	.section	.text.unlikely
+	.size	_Z13test_pipelinev.cold, .-_Z13test_pipelinev.cold
+.LCOLDE31:
+	.text
+.LHOTE31:
+	.section	.rodata.str1.8
+	.align 8
+.LC32:
+	.string	"expected equal : expected value : c.len(), actual value : 5"
+	.align 8
+.LC33:
+	.string	"expected equal : expected value : r.len(), actual value : 5"
+	.align 8
+.LC34:
+	.string	"expected equal : expected value : r.data()[2], actual value : 2"
+	.align 8
+.LC35:
+	.string	"expected equal : expected value : r.data()[3], actual value : 0"
+	.section	.text.unlikely
+.LCOLDB36:
+	.text
+.LHOTB36:
+	.p2align 4
+	.globl	_Z10test_chainv
+	.type	_Z10test_chainv, @function
+_Z10test_chainv:
+.LFB7060:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7060
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$3, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$136, %rsp
+	.cfi_def_cfa_offset 192
+	leaq	64(%rsp), %rdi
+.LEHB22:
+	call	_Z4iotai
+.LEHE22:
+	leaq	96(%rsp), %rdi
+	movl	$2, %esi
+.LEHB23:
+	call	_Z4iotai
+.LEHE23:
+	movq	96(%rsp), %rax
+	movq	112(%rsp), %r12
+	movq	80(%rsp), %r13
+	movq	%rax, 24(%rsp)
+	movq	64(%rsp), %rax
+	movq	%rax, 32(%rsp)
+	leaq	0(%r13,%r12), %rax
+	cmpq	$5, %rax
+	jne	.L444
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r14
+	testq	%r14, %r14
+	je	.L449
+.L382:
+	movq	(%r14), %rax
+	movl	$4, %edx
+	movl	$40, %esi
+	movq	%r14, %rdi
+.LEHB24:
+	call	*16(%rax)
+.LEHE24:
+	movq	%rax, %rbp
+	movq	24(%rsp), %rax
+	movq	$10, (%rsp)
+	xorl	%ebx, %ebx
+	movq	%rax, 16(%rsp)
+	movq	32(%rsp), %rax
+	movq	%rax, 8(%rsp)
+	testq	%r13, %r13
+	je	.L450
+.L393:
+	movq	8(%rsp), %rax
+	subq	$1, %r13
+	movq	%rax, %r15
+	addq	$4, %rax
+	movq	%rax, 8(%rsp)
+	cmpq	%rbx, (%rsp)
+	je	.L451
+.L388:
+	movl	(%r15), %eax
+	movl	%eax, 0(%rbp,%rbx,4)
+.L392:
+	addq	$1, %rbx
+	testq	%r13, %r13
+	jne	.L393
+.L450:
+	testq	%r12, %r12
+	jne	.L394
+	movq	104(%rsp), %r13
+	cmpq	$5, %rbx
+	jne	.L452
+	cmpl	$2, 8(%rbp)
+	jne	.L445
+	movl	12(%rbp), %eax
+	testl	%eax, %eax
+	jne	.L446
+	movq	(%rsp), %rdx
+	movq	(%r14), %rax
+	movq	%rbp, %rsi
+	movl	$4, %ecx
+	movq	%r14, %rdi
+	salq	$2, %rdx
+	call	*24(%rax)
+	movq	24(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L403
+	movq	120(%rsp), %rdi
+	leaq	0(,%r13,4), %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L403:
+	movq	32(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L380
+	movq	72(%rsp), %rax
+	movq	88(%rsp), %rdi
+	movl	$4, %ecx
+	leaq	0(,%rax,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L380:
+	addq	$136, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L394:
+	.cfi_restore_state
+	movq	16(%rsp), %rax
+	subq	$1, %r12
+	movq	%rax, %r15
+	addq	$4, %rax
+	movq	%rax, 16(%rsp)
+	cmpq	%rbx, (%rsp)
+	jne	.L388
+.L451:
+	movq	(%rsp), %rax
+	movl	$4, %edx
+	movq	%r14, %rdi
+	addq	$5, %rax
+	leaq	(%rax,%rax), %rcx
+	salq	$3, %rax
+	movq	%rax, 56(%rsp)
+	movq	%rax, %rsi
+	movq	(%r14), %rax
+	movq	%rcx, 48(%rsp)
+.LEHB25:
+	call	*16(%rax)
+.LEHE25:
+	movq	%rax, %rcx
+	movq	%rax, 40(%rsp)
+	movl	(%r15), %eax
+	leaq	0(,%rbx,4), %rdx
+	movl	%eax, (%rcx,%rbx,4)
+	testq	%rbx, %rbx
+	jne	.L453
+	testq	%rbp, %rbp
+	je	.L391
+.L390:
+	movq	(%rsp), %rdx
+	movq	(%r14), %rax
+	movl	$4, %ecx
+	movq	%rbp, %rsi
+	movq	%r14, %rdi
+	salq	$2, %rdx
+.LEHB26:
+	call	*24(%rax)
+.LEHE26:
+.L391:
+	movq	48(%rsp), %rax
+	movq	40(%rsp), %rbp
+	movq	%rax, (%rsp)
+	jmp	.L392
+	.p2align 4,,10
+	.p2align 3
+.L453:
+	movq	%rbp, %rsi
+	movq	%rcx, %rdi
+	call	memcpy@PLT
+	jmp	.L390
+	.p2align 4,,10
+	.p2align 3
+.L449:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L454
+.L384:
+	movq	_ZZN1n4heapEvE3res(%rip), %r14
+	jmp	.L382
+	.p2align 4,,10
+	.p2align 3
+.L454:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L384
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L384
+.L442:
+	jmp	.L443
+.L412:
+	movq	%rax, %rbx
+	jmp	.L409
+.L417:
+	movq	%rax, %rbx
+	jmp	.L397
+.L452:
+	jmp	.L395
+.L414:
+	movq	%rax, %rbx
+	jmp	.L398
+	.section	.gcc_except_table
+.LLSDA7060:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7060-.LLSDACSB7060
+.LLSDACSB7060:
+	.uleb128 .LEHB22-.LFB7060
+	.uleb128 .LEHE22-.LEHB22
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB23-.LFB7060
+	.uleb128 .LEHE23-.LEHB23
+	.uleb128 .L412-.LFB7060
+	.uleb128 0
+	.uleb128 .LEHB24-.LFB7060
+	.uleb128 .LEHE24-.LEHB24
+	.uleb128 .L442-.LFB7060
+	.uleb128 0
+	.uleb128 .LEHB25-.LFB7060
+	.uleb128 .LEHE25-.LEHB25
+	.uleb128 .L417-.LFB7060
+	.uleb128 0
+	.uleb128 .LEHB26-.LFB7060
+	.uleb128 .LEHE26-.LEHB26
+	.uleb128 .L414-.LFB7060
+	.uleb128 0
+.LLSDACSE7060:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7060
+	.type	_Z10test_chainv.cold, @function
+_Z10test_chainv.cold:
+.LFSB7060:
+.L444:
+	.cfi_def_cfa_offset 192
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC32(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB27:
+	call	__cxa_throw@PLT
+.LEHE27:
+.L413:
+.L443:
+	movq	%rax, %rbx
+.L400:
+	cmpq	$0, 24(%rsp)
+	movq	104(%rsp), %rdx
+	je	.L409
+	movq	120(%rsp), %rdi
+	movq	24(%rsp), %rsi
+	salq	$2, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L409:
+	movq	64(%rsp), %rsi
+	movq	72(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L410
+	movq	88(%rsp), %rdi
+	salq	$2, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L410:
+	movq	%rbx, %rdi
+.LEHB28:
+	call	_Unwind_Resume@PLT
+.LEHE28:
+.L397:
+	movq	%rbp, 40(%rsp)
+.L398:
+	cmpq	$0, 40(%rsp)
+	je	.L400
+	movq	(%r14), %rax
+	movq	56(%rsp), %rdx
+	movl	$4, %ecx
+	movq	%r14, %rdi
+	movq	40(%rsp), %rsi
+	call	*24(%rax)
+	jmp	.L400
+.L446:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC35(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB29:
+	call	__cxa_throw@PLT
+.L445:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC34(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE29:
+.L416:
+	movq	%rax, %rbx
+.L407:
+	movq	(%rsp), %rdx
+	movq	(%r14), %rax
+	movl	$4, %ecx
+	movq	%rbp, %rsi
+	movq	%r14, %rdi
+	salq	$2, %rdx
+	call	*24(%rax)
+	jmp	.L400
+.L395:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC33(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB30:
+	call	__cxa_throw@PLT
+.LEHE30:
+.L415:
+	movq	%rax, %rbx
+	testq	%rbp, %rbp
+	je	.L400
+	jmp	.L407
+	.cfi_endproc
+.LFE7060:
+	.section	.gcc_except_table
+.LLSDAC7060:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7060-.LLSDACSBC7060
+.LLSDACSBC7060:
+	.uleb128 .LEHB27-.LCOLDB36
+	.uleb128 .LEHE27-.LEHB27
+	.uleb128 .L413-.LCOLDB36
+	.uleb128 0
+	.uleb128 .LEHB28-.LCOLDB36
+	.uleb128 .LEHE28-.LEHB28
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB29-.LCOLDB36
+	.uleb128 .LEHE29-.LEHB29
+	.uleb128 .L416-.LCOLDB36
+	.uleb128 0
+	.uleb128 .LEHB30-.LCOLDB36
+	.uleb128 .LEHE30-.LEHB30
+	.uleb128 .L415-.LCOLDB36
+	.uleb128 0
+.LLSDACSEC7060:
+	.section	.text.unlikely
+	.text
+	.size	_Z10test_chainv, .-_Z10test_chainv
+	.section	.text.unlikely
+	.size	_Z10test_chainv.cold, .-_Z10test_chainv.cold
+.LCOLDE36:
+	.text
+.LHOTE36:
+	.section	.rodata.str1.8
+	.align 8
+.LC37:
+	.string	"expected equal : expected value : m.len(), actual value : 5"
+	.align 8
+.LC38:
+	.string	"expected equal : expected value : r.data()[4], actual value : 40"
+	.section	.text.unlikely
+.LCOLDB39:
+	.text
+.LHOTB39:
+	.p2align 4
+	.globl	_Z8test_mapv
+	.type	_Z8test_mapv, @function
+_Z8test_mapv:
+.LFB7004:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7004
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movl	$5, %esi
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 80
+	movq	%rsp, %rdi
+.LEHB31:
+	call	_Z4iotai
+.LEHE31:
+	cmpq	$5, 16(%rsp)
+	movq	(%rsp), %rbp
+	jne	.L476
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r12
+	testq	%r12, %r12
+	je	.L480
+.L457:
+	movq	(%r12), %rax
+	movl	$4, %edx
+	movl	$40, %esi
+	movq	%r12, %rdi
+.LEHB32:
+	call	*16(%rax)
+.LEHE32:
+	movq	%rax, %rbx
+	movl	0(%rbp), %eax
+	movq	8(%rsp), %r13
+	leal	(%rax,%rax,4), %eax
+	addl	%eax, %eax
+	movl	%eax, (%rbx)
+	movl	4(%rbp), %eax
+	leal	(%rax,%rax,4), %eax
+	addl	%eax, %eax
+	movl	%eax, 4(%rbx)
+	movl	8(%rbp), %eax
+	leal	(%rax,%rax,4), %eax
+	addl	%eax, %eax
+	movl	%eax, 8(%rbx)
+	movl	12(%rbp), %eax
+	leal	(%rax,%rax,4), %eax
+	addl	%eax, %eax
+	movl	%eax, 12(%rbx)
+	movl	16(%rbp), %eax
+	leal	(%rax,%rax,4), %edx
+	addl	%edx, %edx
+	movl	%edx, 16(%rbx)
+	cmpl	$4, %eax
+	jne	.L477
+	movq	(%r12), %rax
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	movl	$4, %ecx
+	movl	$40, %edx
+	call	*24(%rax)
+	movq	24(%rsp), %rdi
+	movq	%rbp, %rsi
+	movl	$4, %ecx
+	leaq	0(,%r13,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L480:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L481
+.L459:
+	movq	_ZZN1n4heapEvE3res(%rip), %r12
+	jmp	.L457
+.L481:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L459
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L459
+.L474:
+	jmp	.L475
+	.section	.gcc_except_table
+.LLSDA7004:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7004-.LLSDACSB7004
+.LLSDACSB7004:
+	.uleb128 .LEHB31-.LFB7004
+	.uleb128 .LEHE31-.LEHB31
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB32-.LFB7004
+	.uleb128 .LEHE32-.LEHB32
+	.uleb128 .L474-.LFB7004
+	.uleb128 0
+.LLSDACSE7004:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7004
+	.type	_Z8test_mapv.cold, @function
+_Z8test_mapv.cold:
+.LFSB7004:
+.L476:
+	.cfi_def_cfa_offset 80
+	.cfi_offset 3, -40
+	.cfi_offset 6, -32
+	.cfi_offset 12, -24
+	.cfi_offset 13, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC37(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB33:
+	call	__cxa_throw@PLT
+.LEHE33:
+.L477:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC38(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB34:
+	call	__cxa_throw@PLT
+.LEHE34:
+.L467:
+.L475:
+	movq	%rax, %r13
+	movq	8(%rsp), %rax
+	testq	%rbp, %rbp
+	je	.L465
+.L463:
+	movq	24(%rsp), %rdi
+	leaq	0(,%rax,4), %rdx
+	movl	$4, %ecx
+	movq	%rbp, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L465:
+	movq	%r13, %rdi
+.LEHB35:
+	call	_Unwind_Resume@PLT
+.LEHE35:
+.L466:
+	movq	%rax, %r13
+	movq	(%r12), %rax
+	movl	$4, %ecx
+	movq	%rbx, %rsi
+	movl	$40, %edx
+	movq	%r12, %rdi
+	call	*24(%rax)
+	movq	8(%rsp), %rax
+	jmp	.L463
+	.cfi_endproc
+.LFE7004:
+	.section	.gcc_except_table
+.LLSDAC7004:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7004-.LLSDACSBC7004
+.LLSDACSBC7004:
+	.uleb128 .LEHB33-.LCOLDB39
+	.uleb128 .LEHE33-.LEHB33
+	.uleb128 .L467-.LCOLDB39
+	.uleb128 0
+	.uleb128 .LEHB34-.LCOLDB39
+	.uleb128 .LEHE34-.LEHB34
+	.uleb128 .L466-.LCOLDB39
+	.uleb128 0
+	.uleb128 .LEHB35-.LCOLDB39
+	.uleb128 .LEHE35-.LEHB35
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC7004:
+	.section	.text.unlikely
+	.text
+	.size	_Z8test_mapv, .-_Z8test_mapv
+	.section	.text.unlikely
+	.size	_Z8test_mapv.cold, .-_Z8test_mapv.cold
+.LCOLDE39:
+	.text
+.LHOTE39:
+	.p2align 4
+	.globl	_Z7counteri
+	.type	_Z7counteri, @function
+_Z7counteri:
+.LFB6997:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movl	%esi, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx
+	cmpb	$0, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	je	.L493
+	movq	%fs:8+_ZZN1n8__framesEvE5cache@tpoff, %rax
+	testq	%rax, %rax
+	je	.L484
+.L494:
+	movq	(%rax), %rdx
+	subq	$1, %fs:264+_ZZN1n8__framesEvE5cache@tpoff
+	movq	%rdx, %fs:8+_ZZN1n8__framesEvE5cache@tpoff
+.L485:
+	leaq	_Z7counterPZ7counteriE17_Z7counteri.Frame.destroy(%rip), %rdx
+	leaq	_Z7counterPZ7counteriE17_Z7counteri.Frame.actor(%rip), %rcx
+	movb	$1, 54(%rax)
+	movq	%rdx, %xmm1
+	movq	%rcx, %xmm0
+	movl	$2, %edx
+	movl	%ebp, 48(%rax)
+	punpcklqdq	%xmm1, %xmm0
+	movq	$0, 16(%rax)
+	movb	$0, 24(%rax)
+	movq	$1, 32(%rax)
+	movups	%xmm0, (%rax)
+	movq	%rax, (%rbx)
+	movq	%rax, 40(%rax)
+	movb	$0, 55(%rax)
+	movw	%dx, 52(%rax)
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L493:
+	.cfi_restore_state
+	movq	%fs:0, %rax
+	leaq	__dso_handle(%rip), %rdx
+	movb	$1, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	leaq	_ZN1n13__frame_cacheD1Ev(%rip), %rdi
+	leaq	_ZZN1n8__framesEvE5cache@tpoff(%rax), %rsi
+	call	__cxa_thread_atexit@PLT
+	movq	%fs:8+_ZZN1n8__framesEvE5cache@tpoff, %rax
+	testq	%rax, %rax
+	jne	.L494
+.L484:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L495
+.L487:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %edx
+	movl	$128, %esi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	jmp	.L485
+	.p2align 4,,10
+	.p2align 3
+.L495:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L487
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L487
+	.cfi_endproc
+.LFE6997:
+	.size	_Z7counteri, .-_Z7counteri
+	.section	.rodata.str1.8
+	.align 8
+.LC40:
+	.string	"expected equal : expected value : z.len(), actual value : 4"
+	.align 8
+.LC41:
+	.string	"expected equal : expected value : dot, actual value : 0 + 1 + 8 + 27"
+	.align 8
+.LC42:
+	.string	"expected equal : expected value : indices, actual value : 5"
+	.section	.text.unlikely
+.LCOLDB43:
+	.text
+.LHOTB43:
+	.p2align 4
+	.globl	_Z18test_zip_enumeratev
+	.type	_Z18test_zip_enumeratev, @function
+_Z18test_zip_enumeratev:
+.LFB7044:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7044
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	movl	$4, %esi
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	subq	$80, %rsp
+	.cfi_def_cfa_offset 128
+	leaq	16(%rsp), %rdi
+.LEHB36:
+	call	_Z4iotai
+.LEHE36:
+	leaq	48(%rsp), %rdi
+	movl	$6, %esi
+.LEHB37:
+	call	_Z4iotai
+.LEHE37:
+	movq	64(%rsp), %rax
+	movq	32(%rsp), %rdx
+	movq	48(%rsp), %r13
+	movq	16(%rsp), %r14
+	cmpq	%rax, %rdx
+	movq	%rax, %rcx
+	cmovbe	%rdx, %rcx
+	cmpq	$4, %rcx
+	jne	.L541
+	testq	%rax, %rax
+	je	.L498
+	testq	%rdx, %rdx
+	je	.L498
+	xorl	%ecx, %ecx
+	leaq	-1(%rdx), %r8
+	leaq	-1(%rax), %rdi
+	xorl	%esi, %esi
+.L499:
+	movl	0(%r13,%rcx,4), %eax
+	imull	%eax, %eax
+	imull	(%r14,%rcx,4), %eax
+	addl	%eax, %esi
+	cmpq	%rcx, %r8
+	setne	%dl
+	cmpq	%rcx, %rdi
+	setne	%al
+	addq	$1, %rcx
+	testb	%al, %dl
+	jne	.L499
+	cmpl	$36, %esi
+	jne	.L498
+	leaq	8(%rsp), %rdi
+	movl	$5, %esi
+.LEHB38:
+	call	_Z7counteri
+.LEHE38:
+	movq	8(%rsp), %rbx
+	movq	$0, 8(%rsp)
+	testq	%rbx, %rbx
+	je	.L506
+	xorl	%ebp, %ebp
+	xorl	%r12d, %r12d
+	cmpb	$0, 24(%rbx)
+	movq	(%rbx), %rax
+	je	.L505
+.L504:
+	movq	16(%rbx), %rdx
+	movb	$0, 24(%rbx)
+	movslq	(%rdx), %rdx
+	cmpq	%rbp, %rdx
+	sete	%dl
+	addq	$1, %rbp
+	movzbl	%dl, %edx
+	addq	%rdx, %r12
+.L505:
+	testq	%rax, %rax
+	je	.L510
+	movq	%rbx, %rdi
+.LEHB39:
+	call	*%rax
+.LEHE39:
+	movq	(%rbx), %rax
+	testq	%rax, %rax
+	setne	24(%rbx)
+	jne	.L504
+	.p2align 4,,10
+	.p2align 3
+.L510:
+	subq	$1, 32(%rbx)
+	jne	.L509
+	movq	%rbx, %rdi
+	call	*8(%rbx)
+.L509:
+	movq	56(%rsp), %rdx
+	cmpq	$5, %r12
+	jne	.L506
+	movq	72(%rsp), %rdi
+	movq	%r13, %rsi
+	salq	$2, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	24(%rsp), %rax
+	movq	40(%rsp), %rdi
+	movq	%r14, %rsi
+	movl	$4, %ecx
+	leaq	0(,%rax,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	addq	$80, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+.L524:
+	.cfi_restore_state
+	movq	%rax, %rbx
+	jmp	.L514
+.L522:
+	movq	%rax, %rbp
+	jmp	.L512
+.L520:
+	movq	%rax, %rbx
+	jmp	.L517
+	.section	.gcc_except_table
+.LLSDA7044:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7044-.LLSDACSB7044
+.LLSDACSB7044:
+	.uleb128 .LEHB36-.LFB7044
+	.uleb128 .LEHE36-.LEHB36
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB37-.LFB7044
+	.uleb128 .LEHE37-.LEHB37
+	.uleb128 .L520-.LFB7044
+	.uleb128 0
+	.uleb128 .LEHB38-.LFB7044
+	.uleb128 .LEHE38-.LEHB38
+	.uleb128 .L524-.LFB7044
+	.uleb128 0
+	.uleb128 .LEHB39-.LFB7044
+	.uleb128 .LEHE39-.LEHB39
+	.uleb128 .L522-.LFB7044
+	.uleb128 0
+.LLSDACSE7044:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7044
+	.type	_Z18test_zip_enumeratev.cold, @function
+_Z18test_zip_enumeratev.cold:
+.LFSB7044:
+.L506:
+	.cfi_def_cfa_offset 128
+	.cfi_offset 3, -48
+	.cfi_offset 6, -40
+	.cfi_offset 12, -32
+	.cfi_offset 13, -24
+	.cfi_offset 14, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC42(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB40:
+	call	__cxa_throw@PLT
+.LEHE40:
+.L521:
+	movq	%rax, %rbx
+.L514:
+	movq	56(%rsp), %rax
+.L502:
+	movq	72(%rsp), %rdi
+	leaq	0(,%rax,4), %rdx
+	movl	$4, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L517:
+	movq	16(%rsp), %rsi
+	movq	24(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L518
+	movq	40(%rsp), %rdi
+	salq	$2, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L518:
+	movq	%rbx, %rdi
+.LEHB41:
+	call	_Unwind_Resume@PLT
+.LEHE41:
+.L498:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC41(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB42:
+	call	__cxa_throw@PLT
+.LEHE42:
+.L512:
+	subq	$1, 32(%rbx)
+	jne	.L513
+	movq	%rbx, %rdi
+	call	*8(%rbx)
+.L513:
+	movq	%rbp, %rbx
+	jmp	.L514
+.L523:
+	movq	%rax, %rbx
+	movq	56(%rsp), %rax
+	testq	%r13, %r13
+	jne	.L502
+	jmp	.L517
+.L541:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC40(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB43:
+	call	__cxa_throw@PLT
+.LEHE43:
+	.cfi_endproc
+.LFE7044:
+	.section	.gcc_except_table
+.LLSDAC7044:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7044-.LLSDACSBC7044
+.LLSDACSBC7044:
+	.uleb128 .LEHB40-.LCOLDB43
+	.uleb128 .LEHE40-.LEHB40
+	.uleb128 .L521-.LCOLDB43
+	.uleb128 0
+	.uleb128 .LEHB41-.LCOLDB43
+	.uleb128 .LEHE41-.LEHB41
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB42-.LCOLDB43
+	.uleb128 .LEHE42-.LEHB42
+	.uleb128 .L523-.LCOLDB43
+	.uleb128 0
+	.uleb128 .LEHB43-.LCOLDB43
+	.uleb128 .LEHE43-.LEHB43
+	.uleb128 .L523-.LCOLDB43
+	.uleb128 0
+.LLSDACSEC7044:
+	.section	.text.unlikely
+	.text
+	.size	_Z18test_zip_enumeratev, .-_Z18test_zip_enumeratev
+	.section	.text.unlikely
+	.size	_Z18test_zip_enumeratev.cold, .-_Z18test_zip_enumeratev.cold
+.LCOLDE43:
+	.text
+.LHOTE43:
+	.section	.rodata.str1.8
+	.align 8
+.LC44:
+	.string	"expected equal : expected value : r.data()[0], actual value : 1"
+	.align 8
+.LC45:
+	.string	"expected equal : expected value : r.data()[4], actual value : 9"
+	.align 8
+.LC46:
+	.string	"expected true : n::equal(r.iter(), g.iter())"
+	.section	.text.unlikely
+.LCOLDB47:
+	.text
+.LHOTB47:
+	.p2align 4
+	.globl	_Z11test_filterv
+	.type	_Z11test_filterv, @function
+_Z11test_filterv:
+.LFB7017:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7017
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$10, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$120, %rsp
+	.cfi_def_cfa_offset 176
+	leaq	80(%rsp), %rdi
+.LEHB44:
+	call	_Z4iotai
+.LEHE44:
+	movq	80(%rsp), %rax
+	movq	96(%rsp), %rbp
+	movq	%rax, 56(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, 24(%rsp)
+	testq	%rax, %rax
+	je	.L663
+.L546:
+	movq	56(%rsp), %r14
+	xorl	%r12d, %r12d
+	xorl	%r15d, %r15d
+	xorl	%r13d, %r13d
+	testq	%rbp, %rbp
+	je	.L556
+	.p2align 4,,10
+	.p2align 3
+.L666:
+	movq	%r14, %rbx
+	xorl	%edx, %edx
+	jmp	.L558
+	.p2align 4,,10
+	.p2align 3
+.L664:
+	addq	$1, %rdx
+	addq	$4, %rbx
+	cmpq	%rbp, %rdx
+	je	.L556
+.L558:
+	movl	(%rbx), %ecx
+	movl	%ecx, %esi
+	shrl	$31, %esi
+	leal	(%rcx,%rsi), %eax
+	andl	$1, %eax
+	subl	%esi, %eax
+	cmpl	$1, %eax
+	jne	.L664
+	cmpq	%rbp, %rdx
+	je	.L556
+	subq	%rdx, %rbp
+	leaq	4(%rbx), %r14
+	subq	$1, %rbp
+	cmpq	%r12, %r15
+	je	.L665
+	movl	%ecx, 0(%r13,%r12,4)
+.L555:
+	addq	$1, %r12
+	testq	%rbp, %rbp
+	jne	.L666
+	.p2align 4,,10
+	.p2align 3
+.L556:
+	leaq	72(%rsp), %rdi
+	movl	$10, %esi
+.LEHB45:
+	call	_Z7counteri
+.LEHE45:
+	movq	72(%rsp), %rbx
+	movq	$0, 72(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, 32(%rsp)
+	testq	%rax, %rax
+	je	.L667
+.L565:
+	movq	$0, 16(%rsp)
+	xorl	%r14d, %r14d
+	testq	%rbx, %rbx
+	je	.L582
+	movq	$0, 8(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L579:
+	cmpb	$0, 24(%rbx)
+	jne	.L577
+	movq	(%rbx), %rax
+	testq	%rax, %rax
+	je	.L578
+	movq	%rbx, %rdi
+.LEHB46:
+	call	*%rax
+.LEHE46:
+	cmpq	$0, (%rbx)
+	setne	24(%rbx)
+	je	.L578
+.L577:
+	movq	16(%rbx), %rax
+	movb	$0, 24(%rbx)
+	movl	(%rax), %ebp
+	movl	%ebp, %edx
+	shrl	$31, %edx
+	leal	0(%rbp,%rdx), %eax
+	andl	$1, %eax
+	subl	%edx, %eax
+	cmpl	$1, %eax
+	jne	.L579
+	cmpq	%r14, 16(%rsp)
+	je	.L668
+	movq	8(%rsp), %rax
+	movl	%ebp, (%rax,%r14,4)
+.L576:
+	addq	$1, %r14
+	jmp	.L579
+	.p2align 4,,10
+	.p2align 3
+.L665:
+	leaq	5(%r15), %rax
+	movl	$4, %edx
+	leaq	(%rax,%rax), %rdi
+	leaq	0(,%rax,8), %rsi
+	movq	%rdi, 16(%rsp)
+	movq	24(%rsp), %rdi
+	movq	%rsi, 32(%rsp)
+	movq	(%rdi), %rax
+.LEHB47:
+	call	*16(%rax)
+.LEHE47:
+	movq	%rax, %rdi
+	movq	%rax, 8(%rsp)
+	movl	(%rbx), %eax
+	leaq	0(,%r12,4), %rdx
+	movl	%eax, (%rdi,%r12,4)
+	testq	%r12, %r12
+	jne	.L669
+	testq	%r13, %r13
+	je	.L554
+.L553:
+	movq	24(%rsp), %rdi
+	leaq	0(,%r15,4), %rdx
+	movl	$4, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+.LEHB48:
+	call	*24(%rax)
+.LEHE48:
+.L554:
+	movq	16(%rsp), %r15
+	movq	8(%rsp), %r13
+	jmp	.L555
+.L668:
+	movq	16(%rsp), %rax
+	movq	32(%rsp), %rdi
+	movl	$4, %edx
+	leaq	5(%rax), %rsi
+	leaq	(%rsi,%rsi), %rax
+	salq	$3, %rsi
+	movq	%rax, 48(%rsp)
+	movq	(%rdi), %rax
+.LEHB49:
+	call	*16(%rax)
+.LEHE49:
+	movq	%rax, 40(%rsp)
+	leaq	0(,%r14,4), %rdx
+	movl	%ebp, (%rax,%r14,4)
+	testq	%r14, %r14
+	jne	.L670
+	cmpq	$0, 8(%rsp)
+	je	.L573
+.L572:
+	movq	32(%rsp), %rdi
+	movq	16(%rsp), %rdx
+	movl	$4, %ecx
+	movq	8(%rsp), %rsi
+	movq	(%rdi), %rax
+	salq	$2, %rdx
+.LEHB50:
+	call	*24(%rax)
+.LEHE50:
+.L573:
+	movq	48(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	movq	40(%rsp), %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L576
+	.p2align 4,,10
+	.p2align 3
+.L578:
+	subq	$1, 32(%rbx)
+	jne	.L661
+	movq	%rbx, %rdi
+	call	*8(%rbx)
+.L661:
+	movq	8(%rsp), %rbx
+.L582:
+	movq	88(%rsp), %rbp
+	cmpq	$5, %r12
+	jne	.L671
+	cmpl	$1, 0(%r13)
+	jne	.L655
+	cmpl	$9, 16(%r13)
+	jne	.L656
+	cmpq	$5, %r14
+	jne	.L595
+	movq	0(%r13), %rdx
+	movq	8(%r13), %rax
+	xorq	(%rbx), %rdx
+	xorq	8(%rbx), %rax
+	orq	%rdx, %rax
+	jne	.L595
+	cmpl	$9, 16(%rbx)
+	jne	.L595
+	movq	32(%rsp), %rdi
+	movq	16(%rsp), %rdx
+	movl	$4, %ecx
+	movq	%rbx, %rsi
+	movq	(%rdi), %rax
+	salq	$2, %rdx
+	call	*24(%rax)
+	movq	24(%rsp), %rdi
+	movl	$4, %ecx
+	movq	%r13, %rsi
+	leaq	0(,%r15,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	$0, 56(%rsp)
+	je	.L545
+	movq	104(%rsp), %rdi
+	movq	56(%rsp), %rsi
+	movl	$4, %ecx
+	leaq	0(,%rbp,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L545:
+	addq	$120, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L670:
+	.cfi_restore_state
+	movq	8(%rsp), %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L572
+.L669:
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L553
+.L663:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L672
+.L548:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	%rax, 24(%rsp)
+	jmp	.L546
+.L667:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L673
+.L567:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	%rax, 32(%rsp)
+	jmp	.L565
+.L672:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L548
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L548
+.L673:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L567
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L567
+.L610:
+	movq	%rax, %rbp
+	jmp	.L575
+.L615:
+	movq	%rax, %rbp
+	jmp	.L585
+.L607:
+	movq	%rax, %rbp
+	jmp	.L588
+.L609:
+	movq	%rax, %rbp
+	jmp	.L562
+.L614:
+	movq	%rax, %rbp
+	jmp	.L561
+.L671:
+	jmp	.L583
+.L616:
+	movq	%rax, %rbp
+	jmp	.L574
+	.section	.gcc_except_table
+.LLSDA7017:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7017-.LLSDACSB7017
+.LLSDACSB7017:
+	.uleb128 .LEHB44-.LFB7017
+	.uleb128 .LEHE44-.LEHB44
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB45-.LFB7017
+	.uleb128 .LEHE45-.LEHB45
+	.uleb128 .L607-.LFB7017
+	.uleb128 0
+	.uleb128 .LEHB46-.LFB7017
+	.uleb128 .LEHE46-.LEHB46
+	.uleb128 .L615-.LFB7017
+	.uleb128 0
+	.uleb128 .LEHB47-.LFB7017
+	.uleb128 .LEHE47-.LEHB47
+	.uleb128 .L614-.LFB7017
+	.uleb128 0
+	.uleb128 .LEHB48-.LFB7017
+	.uleb128 .LEHE48-.LEHB48
+	.uleb128 .L609-.LFB7017
+	.uleb128 0
+	.uleb128 .LEHB49-.LFB7017
+	.uleb128 .LEHE49-.LEHB49
+	.uleb128 .L610-.LFB7017
+	.uleb128 0
+	.uleb128 .LEHB50-.LFB7017
+	.uleb128 .LEHE50-.LEHB50
+	.uleb128 .L616-.LFB7017
+	.uleb128 0
+.LLSDACSE7017:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7017
+	.type	_Z11test_filterv.cold, @function
+_Z11test_filterv.cold:
+.LFSB7017:
+.L574:
+	.cfi_def_cfa_offset 176
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	40(%rsp), %rax
+	movq	%rax, 8(%rsp)
+.L575:
+	subq	$1, 32(%rbx)
+	jne	.L586
+	movq	%rbx, %rdi
+	call	*8(%rbx)
+.L586:
+	cmpq	$0, 8(%rsp)
+	je	.L588
+	movq	32(%rsp), %rdi
+	movq	48(%rsp), %rdx
+	movl	$4, %ecx
+	movq	8(%rsp), %rsi
+	movq	(%rdi), %rax
+	salq	$2, %rdx
+	call	*24(%rax)
+.L588:
+	testq	%r13, %r13
+	je	.L564
+.L592:
+	movq	24(%rsp), %rdi
+	leaq	0(,%r15,4), %rdx
+	movl	$4, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L564:
+	cmpq	$0, 56(%rsp)
+	movq	88(%rsp), %rdx
+	je	.L604
+	movq	104(%rsp), %rdi
+	movq	56(%rsp), %rsi
+	salq	$2, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L604:
+	movq	%rbp, %rdi
+.LEHB51:
+	call	_Unwind_Resume@PLT
+.LEHE51:
+.L585:
+	movq	16(%rsp), %rax
+	movq	%rax, 48(%rsp)
+	jmp	.L575
+.L595:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC46(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB52:
+	call	__cxa_throw@PLT
+.LEHE52:
+.L608:
+.L662:
+	movq	%rax, %rbp
+	testq	%rbx, %rbx
+	je	.L592
+.L591:
+	movq	32(%rsp), %rdi
+	movq	16(%rsp), %rdx
+	movl	$4, %ecx
+	movq	%rbx, %rsi
+	movq	(%rdi), %rax
+	salq	$2, %rdx
+	call	*24(%rax)
+	jmp	.L588
+.L561:
+	movq	%r13, 8(%rsp)
+.L562:
+	cmpq	$0, 8(%rsp)
+	je	.L564
+	movq	24(%rsp), %rdi
+	movq	32(%rsp), %rdx
+	movl	$4, %ecx
+	movq	8(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L564
+.L656:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC45(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB53:
+	call	__cxa_throw@PLT
+.LEHE53:
+.L655:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC44(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB54:
+	call	__cxa_throw@PLT
+.LEHE54:
+.L613:
+	jmp	.L662
+.L612:
+	jmp	.L662
+.L583:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC33(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB55:
+	call	__cxa_throw@PLT
+.LEHE55:
+.L611:
+	movq	%rax, %rbp
+	testq	%rbx, %rbx
+	jne	.L591
+	jmp	.L588
+	.cfi_endproc
+.LFE7017:
+	.section	.gcc_except_table
+.LLSDAC7017:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7017-.LLSDACSBC7017
+.LLSDACSBC7017:
+	.uleb128 .LEHB51-.LCOLDB47
+	.uleb128 .LEHE51-.LEHB51
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB52-.LCOLDB47
+	.uleb128 .LEHE52-.LEHB52
+	.uleb128 .L608-.LCOLDB47
+	.uleb128 0
+	.uleb128 .LEHB53-.LCOLDB47
+	.uleb128 .LEHE53-.LEHB53
+	.uleb128 .L613-.LCOLDB47
+	.uleb128 0
+	.uleb128 .LEHB54-.LCOLDB47
+	.uleb128 .LEHE54-.LEHB54
+	.uleb128 .L612-.LCOLDB47
+	.uleb128 0
+	.uleb128 .LEHB55-.LCOLDB47
+	.uleb128 .LEHE55-.LEHB55
+	.uleb128 .L611-.LCOLDB47
+	.uleb128 0
+.LLSDACSEC7017:
+	.section	.text.unlikely
+	.text
+	.size	_Z11test_filterv, .-_Z11test_filterv
+	.section	.text.unlikely
+	.size	_Z11test_filterv.cold, .-_Z11test_filterv.cold
+.LCOLDE47:
+	.text
+.LHOTE47:
+	.section	.rodata.str1.1
+.LC48:
+	.string	"n::adaptor tests"
+.LC49:
+	.string	"test_map"
+.LC50:
+	.string	"test_filter"
+.LC51:
+	.string	"test_take_drop"
+.LC52:
+	.string	"test_zip_enumerate"
+.LC53:
+	.string	"test_chain"
+.LC54:
+	.string	"test_chunk_window"
+.LC55:
+	.string	"test_split"
+.LC56:
+	.string	"test_pipeline"
+	.section	.text.unlikely
+.LCOLDB58:
+	.section	.text.startup,"ax",@progbits
+.LHOTB58:
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB7119:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7119
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$1600, %edi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 64
+.LEHB56:
+	call	_Znam@PLT
+.LEHE56:
+	movq	%rax, %rbx
+	leaq	1600(%rax), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L675:
+	movq	$0, (%rax)
+	addq	$16, %rax
+	movq	$0, -8(%rax)
+	cmpq	%rax, %rdx
+	jne	.L675
+	leaq	.LC48(%rip), %rax
+	movq	%rsp, %rdi
+	movq	%rbx, (%rsp)
+	movq	%rax, 16(%rsp)
+	leaq	.LC49(%rip), %rax
+	movq	%rax, (%rbx)
+	leaq	_Z8test_mapv(%rip), %rax
+	movq	%rax, 8(%rbx)
+	leaq	.LC50(%rip), %rax
+	movq	%rax, 16(%rbx)
+	leaq	_Z11test_filterv(%rip), %rax
+	movq	%rax, 24(%rbx)
+	leaq	.LC51(%rip), %rax
+	movq	%rax, 32(%rbx)
+	leaq	_Z14test_take_dropv(%rip), %rax
+	movq	%rax, 40(%rbx)
+	leaq	.LC52(%rip), %rax
+	movq	%rax, 48(%rbx)
+	leaq	_Z18test_zip_enumeratev(%rip), %rax
+	movq	%rax, 56(%rbx)
+	leaq	.LC53(%rip), %rax
+	movq	%rax, 64(%rbx)
+	leaq	_Z10test_chainv(%rip), %rax
+	movq	%rax, 72(%rbx)
+	leaq	.LC54(%rip), %rax
+	movq	%rax, 80(%rbx)
+	leaq	_Z17test_chunk_windowv(%rip), %rax
+	movq	%rax, 88(%rbx)
+	leaq	.LC55(%rip), %rax
+	movq	%rax, 96(%rbx)
+	leaq	_Z10test_splitv(%rip), %rax
+	movq	%rax, 104(%rbx)
+	leaq	.LC56(%rip), %rax
+	movq	%rax, 112(%rbx)
+	leaq	_Z13test_pipelinev(%rip), %rax
+	movq	%rax, 120(%rbx)
+	movq	.LC57(%rip), %rax
+	movq	%rax, 8(%rsp)
+.LEHB57:
+	call	_ZN1n4test10test_suite7run_allEv
+.LEHE57:
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L677:
+	.cfi_restore_state
+	movq	%rax, %rbp
+	jmp	.L676
+	.section	.gcc_except_table
+.LLSDA7119:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7119-.LLSDACSB7119
+.LLSDACSB7119:
+	.uleb128 .LEHB56-.LFB7119
+	.uleb128 .LEHE56-.LEHB56
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB57-.LFB7119
+	.uleb128 .LEHE57-.LEHB57
+	.uleb128 .L677-.LFB7119
+	.uleb128 0
+.LLSDACSE7119:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7119
+	.type	main.cold, @function
+main.cold:
+.LFSB7119:
+.L676:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	movq	%rbp, %rdi
+.LEHB58:
+	call	_Unwind_Resume@PLT
+.LEHE58:
+	.cfi_endproc
+.LFE7119:
+	.section	.gcc_except_table
+.LLSDAC7119:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7119-.LLSDACSBC7119
+.LLSDACSBC7119:
+	.uleb128 .LEHB58-.LCOLDB58
+	.uleb128 .LEHE58-.LEHB58
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC7119:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	main, .-main
+	.section	.text.unlikely
+	.size	main.cold, .-main.cold
+.LCOLDE58:
+	.section	.text.startup
+.LHOTE58:
+	.section	.text._Z7collectIN1n14limit_iteratorINS0_9generatorIiEEEEENS0_6vectorIiEET_,"axG",@progbits,_Z7collectIN1n14limit_iteratorINS0_9generatorIiEEEEENS0_6vectorIiEET_,comdat
+	.p2align 4
+	.weak	_Z7collectIN1n14limit_iteratorINS0_9generatorIiEEEEENS0_6vectorIiEET_
+	.type	_Z7collectIN1n14limit_iteratorINS0_9generatorIiEEEEENS0_6vectorIiEET_, @function
+_Z7collectIN1n14limit_iteratorINS0_9generatorIiEEEEENS0_6vectorIiEET_:
+.LFB7192:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7192
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pxor	%xmm0, %xmm0
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	$0, (%rdi)
+	movups	%xmm0, 8(%rdi)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L723
+.L683:
+	movq	8(%rsi), %r12
+	movq	(%rsi), %rbp
+	movq	%rax, 24(%rbx)
+	movq	$0, (%rsi)
+	testq	%r12, %r12
+	je	.L724
+	testq	%rbp, %rbp
+	je	.L682
+	.p2align 4,,10
+	.p2align 3
+.L692:
+	cmpb	$0, 24(%rbp)
+	jne	.L698
+	movq	0(%rbp), %rax
+	testq	%rax, %rax
+	je	.L693
+	movq	%rbp, %rdi
+.LEHB59:
+	call	*%rax
+.LEHE59:
+	cmpq	$0, 0(%rbp)
+	setne	24(%rbp)
+	jne	.L698
+.L693:
+	subq	$1, 32(%rbp)
+	jne	.L682
+	movq	%rbp, %rdi
+	call	*8(%rbp)
+.L682:
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L698:
+	.cfi_restore_state
+	movq	16(%rbx), %rdx
+	movq	8(%rbx), %r13
+	movb	$0, 24(%rbp)
+	subq	$1, %r12
+	movq	16(%rbp), %r15
+	movq	(%rbx), %r14
+	cmpq	%r13, %rdx
+	je	.L725
+	movl	(%r15), %eax
+	movl	%eax, (%r14,%rdx,4)
+.L691:
+	addq	$1, %rdx
+	movq	%rdx, 16(%rbx)
+	testq	%r12, %r12
+	jne	.L692
+	jmp	.L693
+	.p2align 4,,10
+	.p2align 3
+.L725:
+	leaq	5(%r13), %rsi
+	movq	24(%rbx), %rdi
+	movl	$4, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$3, %rsi
+	movq	%rax, 8(%rbx)
+	movq	(%rdi), %rax
+.LEHB60:
+	call	*16(%rax)
+	movq	16(%rbx), %rdx
+	movl	(%r15), %esi
+	movq	%rax, (%rbx)
+	leaq	0(,%rdx,4), %rcx
+	movl	%esi, (%rax,%rdx,4)
+	testq	%rdx, %rdx
+	jne	.L726
+	testq	%r14, %r14
+	je	.L691
+.L690:
+	movq	24(%rbx), %rdi
+	leaq	0(,%r13,4), %rdx
+	movl	$4, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE60:
+	movq	16(%rbx), %rdx
+	jmp	.L691
+	.p2align 4,,10
+	.p2align 3
+.L724:
+	testq	%rbp, %rbp
+	je	.L682
+	jmp	.L693
+	.p2align 4,,10
+	.p2align 3
+.L726:
+	movq	%rcx, %rdx
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L690
+	.p2align 4,,10
+	.p2align 3
+.L723:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L727
+.L685:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	jmp	.L683
+.L727:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rsi, 8(%rsp)
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	movq	8(%rsp), %rsi
+	testl	%eax, %eax
+	je	.L685
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movq	8(%rsp), %rsi
+	jmp	.L685
+.L703:
+	movq	%rax, %r12
+.L700:
+	subq	$1, 32(%rbp)
+	jne	.L701
+	movq	%rbp, %rdi
+	call	*8(%rbp)
+.L701:
+	movq	(%rbx), %rsi
+	movq	8(%rbx), %rdx
+	testq	%rsi, %rsi
+	je	.L702
+	movq	24(%rbx), %rdi
+	salq	$2, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L702:
+	movq	%r12, %rdi
+.LEHB61:
+	call	_Unwind_Resume@PLT
+.LEHE61:
+	.cfi_endproc
+.LFE7192:
+	.section	.gcc_except_table
+.LLSDA7192:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7192-.LLSDACSB7192
+.LLSDACSB7192:
+	.uleb128 .LEHB59-.LFB7192
+	.uleb128 .LEHE59-.LEHB59
+	.uleb128 .L703-.LFB7192
+	.uleb128 0
+	.uleb128 .LEHB60-.LFB7192
+	.uleb128 .LEHE60-.LEHB60
+	.uleb128 .L703-.LFB7192
+	.uleb128 0
+	.uleb128 .LEHB61-.LFB7192
+	.uleb128 .LEHE61-.LEHB61
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE7192:
+	.section	.text._Z7collectIN1n14limit_iteratorINS0_9generatorIiEEEEENS0_6vectorIiEET_,"axG",@progbits,_Z7collectIN1n14limit_iteratorINS0_9generatorIiEEEEENS0_6vectorIiEET_,comdat
+	.size	_Z7collectIN1n14limit_iteratorINS0_9generatorIiEEEEENS0_6vectorIiEET_, .-_Z7collectIN1n14limit_iteratorINS0_9generatorIiEEEEENS0_6vectorIiEET_
+	.section	.text._Z7collectIN1n13drop_iteratorINS0_9generatorIiEEEEENS0_6vectorIiEET_,"axG",@progbits,_Z7collectIN1n13drop_iteratorINS0_9generatorIiEEEEENS0_6vectorIiEET_,comdat
+	.p2align 4
+	.weak	_Z7collectIN1n13drop_iteratorINS0_9generatorIiEEEEENS0_6vectorIiEET_
+	.type	_Z7collectIN1n13drop_iteratorINS0_9generatorIiEEEEENS0_6vectorIiEET_, @function
+_Z7collectIN1n13drop_iteratorINS0_9generatorIiEEEEENS0_6vectorIiEET_:
+.LFB7200:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7200
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pxor	%xmm0, %xmm0
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	$0, (%rdi)
+	movups	%xmm0, 8(%rdi)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L782
+.L729:
+	movq	8(%rsi), %rbp
+	movq	(%rsi), %rbx
+	movq	%rax, 24(%r12)
+	movq	$0, (%rsi)
+	testq	%rbp, %rbp
+	je	.L783
+	testq	%rbx, %rbx
+	je	.L728
+	.p2align 4,,10
+	.p2align 3
+.L739:
+	movq	(%rbx), %rax
+.L744:
+	cmpb	$0, 24(%rbx)
+	jne	.L742
+	testq	%rax, %rax
+	je	.L747
+	movq	%rbx, %rdi
+.LEHB62:
+	call	*%rax
+	movq	(%rbx), %rax
+	testq	%rax, %rax
+	setne	24(%rbx)
+	je	.L747
+.L742:
+	movb	$0, 24(%rbx)
+	subq	$1, %rbp
+	jne	.L744
+.L753:
+	testq	%rax, %rax
+	je	.L747
+	movq	%rbx, %rdi
+	call	*%rax
+.LEHE62:
+	cmpq	$0, (%rbx)
+	setne	24(%rbx)
+	je	.L747
+.L746:
+	movq	16(%r12), %rdx
+	movq	8(%r12), %r13
+	movb	$0, 24(%rbx)
+	movq	16(%rbx), %r15
+	movq	(%r12), %r14
+	cmpq	%r13, %rdx
+	je	.L784
+	movl	(%r15), %eax
+	movl	%eax, (%r14,%rdx,4)
+.L738:
+	addq	$1, %rdx
+	movq	%rdx, 16(%r12)
+	testq	%rbp, %rbp
+	jne	.L739
+.L740:
+	xorl	%ebp, %ebp
+	cmpb	$0, 24(%rbx)
+	jne	.L746
+	movq	(%rbx), %rax
+	jmp	.L753
+	.p2align 4,,10
+	.p2align 3
+.L747:
+	subq	$1, 32(%rbx)
+	jne	.L728
+	movq	%rbx, %rdi
+	call	*8(%rbx)
+.L728:
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%r12, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L782:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L785
+.L731:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	jmp	.L729
+.L785:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rsi, 8(%rsp)
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	movq	8(%rsp), %rsi
+	testl	%eax, %eax
+	je	.L731
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movq	8(%rsp), %rsi
+	jmp	.L731
+	.p2align 4,,10
+	.p2align 3
+.L784:
+	leaq	5(%r13), %rsi
+	movq	24(%r12), %rdi
+	movl	$4, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$3, %rsi
+	movq	%rax, 8(%r12)
+	movq	(%rdi), %rax
+.LEHB63:
+	call	*16(%rax)
+	movq	16(%r12), %rdx
+	movl	(%r15), %esi
+	movq	%rax, (%r12)
+	leaq	0(,%rdx,4), %rcx
+	movl	%esi, (%rax,%rdx,4)
+	testq	%rdx, %rdx
+	jne	.L786
+	testq	%r14, %r14
+	je	.L738
+.L737:
+	movq	24(%r12), %rdi
+	leaq	0(,%r13,4), %rdx
+	movl	$4, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE63:
+	movq	16(%r12), %rdx
+	jmp	.L738
+	.p2align 4,,10
+	.p2align 3
+.L786:
+	movq	%rcx, %rdx
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L737
+.L783:
+	testq	%rbx, %rbx
+	jne	.L740
+	jmp	.L728
+.L754:
+	movq	%rax, %rbp
+.L749:
+	subq	$1, 32(%rbx)
+	jne	.L751
+	movq	%rbx, %rdi
+	call	*8(%rbx)
+.L751:
+	movq	(%r12), %rsi
+	movq	8(%r12), %rdx
+	testq	%rsi, %rsi
+	je	.L748
+	movq	24(%r12), %rdi
+	salq	$2, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L748:
+	movq	%rbp, %rdi
+.LEHB64:
+	call	_Unwind_Resume@PLT
+.LEHE64:
+	.cfi_endproc
+.LFE7200:
+	.section	.gcc_except_table
+.LLSDA7200:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7200-.LLSDACSB7200
+.LLSDACSB7200:
+	.uleb128 .LEHB62-.LFB7200
+	.uleb128 .LEHE62-.LEHB62
+	.uleb128 .L754-.LFB7200
+	.uleb128 0
+	.uleb128 .LEHB63-.LFB7200
+	.uleb128 .LEHE63-.LEHB63
+	.uleb128 .L754-.LFB7200
+	.uleb128 0
+	.uleb128 .LEHB64-.LFB7200
+	.uleb128 .LEHE64-.LEHB64
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE7200:
+	.section	.text._Z7collectIN1n13drop_iteratorINS0_9generatorIiEEEEENS0_6vectorIiEET_,"axG",@progbits,_Z7collectIN1n13drop_iteratorINS0_9generatorIiEEEEENS0_6vectorIiEET_,comdat
+	.size	_Z7collectIN1n13drop_iteratorINS0_9generatorIiEEEEENS0_6vectorIiEET_, .-_Z7collectIN1n13drop_iteratorINS0_9generatorIiEEEEENS0_6vectorIiEET_
+	.section	.rodata.str1.8
+	.align 8
+.LC59:
+	.string	"expected equal : expected value : t.len(), actual value : 3"
+	.align 8
+.LC60:
+	.string	"expected equal : expected value : d.len(), actual value : 3"
+	.align 8
+.LC61:
+	.string	"expected equal : expected value : d.data()[0], actual value : 7"
+	.align 8
+.LC62:
+	.string	"expected true : n::equal(gt.iter(), t)"
+	.align 8
+.LC63:
+	.string	"expected true : n::equal(gd.iter(), d)"
+	.align 8
+.LC64:
+	.string	"expected equal : expected value : collect(n::take(counter(10), 1ul << 40)).len(), actual value : 10"
+	.section	.text.unlikely
+.LCOLDB65:
+	.text
+.LHOTB65:
+	.p2align 4
+	.globl	_Z14test_take_dropv
+	.type	_Z14test_take_dropv, @function
+_Z14test_take_dropv:
+.LFB7031:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7031
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$10, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$168, %rsp
+	.cfi_def_cfa_offset 224
+	leaq	32(%rsp), %rdi
+.LEHB65:
+	call	_Z4iotai
+.LEHE65:
+	movq	48(%rsp), %rdx
+	movl	$7, %eax
+	movq	32(%rsp), %rbp
+	cmpq	%rax, %rdx
+	movq	%rdx, %rcx
+	cmovbe	%rdx, %rax
+	subq	%rax, %rcx
+	leaq	0(%rbp,%rax,4), %r13
+	cmpq	$2, %rdx
+	jbe	.L853
+	cmpq	$3, %rcx
+	jne	.L854
+	cmpl	$7, 0(%r13)
+	jne	.L855
+	leaq	96(%rsp), %r12
+	movl	$10, %esi
+	movq	%r12, %rdi
+.LEHB66:
+	call	_Z7counteri
+.LEHE66:
+	movq	96(%rsp), %rax
+	leaq	128(%rsp), %rbx
+	leaq	64(%rsp), %rdi
+	movq	$0, 96(%rsp)
+	movq	$3, 136(%rsp)
+	movq	%rbx, %rsi
+	movq	%rax, 128(%rsp)
+.LEHB67:
+	call	_Z7collectIN1n14limit_iteratorINS0_9generatorIiEEEEENS0_6vectorIiEET_
+.LEHE67:
+	movq	128(%rsp), %rax
+	testq	%rax, %rax
+	je	.L792
+	subq	$1, 32(%rax)
+	je	.L860
+.L792:
+	leaq	16(%rsp), %r15
+	movl	$10, %esi
+	movq	%r15, %rdi
+.LEHB68:
+	call	_Z7counteri
+.LEHE68:
+	movq	16(%rsp), %rax
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	movq	$0, 16(%rsp)
+	movq	$7, 136(%rsp)
+	movq	%rax, 128(%rsp)
+.LEHB69:
+	call	_Z7collectIN1n13drop_iteratorINS0_9generatorIiEEEEENS0_6vectorIiEET_
+.LEHE69:
+	movq	128(%rsp), %rax
+	testq	%rax, %rax
+	je	.L795
+	subq	$1, 32(%rax)
+	jne	.L795
+	movq	%rax, %rdi
+	call	*8(%rax)
+.L795:
+	cmpq	$3, 80(%rsp)
+	movq	64(%rsp), %r12
+	jne	.L797
+	movq	0(%rbp), %rax
+	cmpq	%rax, (%r12)
+	jne	.L797
+	movl	8(%rbp), %eax
+	cmpl	%eax, 8(%r12)
+	jne	.L797
+	cmpq	$3, 112(%rsp)
+	movq	96(%rsp), %r14
+	jne	.L801
+	movq	0(%r13), %rax
+	cmpq	%rax, (%r14)
+	jne	.L801
+	movl	8(%r13), %eax
+	cmpl	%eax, 8(%r14)
+	jne	.L801
+	leaq	8(%rsp), %rdi
+	movl	$10, %esi
+.LEHB70:
+	call	_Z7counteri
+.LEHE70:
+	movq	8(%rsp), %rax
+	movq	%r15, %rsi
+	movq	%rbx, %rdi
+	movq	$0, 8(%rsp)
+	movq	%rax, 16(%rsp)
+	movabsq	$1099511627776, %rax
+	movq	%rax, 24(%rsp)
+.LEHB71:
+	call	_Z7collectIN1n14limit_iteratorINS0_9generatorIiEEEEENS0_6vectorIiEET_
+.LEHE71:
+	movq	128(%rsp), %rsi
+	movq	144(%rsp), %r13
+	testq	%rsi, %rsi
+	je	.L805
+	movq	136(%rsp), %rax
+	movq	152(%rsp), %rdi
+	movl	$4, %ecx
+	leaq	0(,%rax,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L805:
+	movq	16(%rsp), %rax
+	testq	%rax, %rax
+	je	.L807
+	subq	$1, 32(%rax)
+	jne	.L807
+	movq	%rax, %rdi
+	call	*8(%rax)
+.L807:
+	movq	72(%rsp), %rbx
+	movq	104(%rsp), %rdx
+	cmpq	$10, %r13
+	jne	.L856
+	movq	120(%rsp), %rdi
+	movq	%r14, %rsi
+	salq	$2, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	88(%rsp), %rdi
+	movq	%r12, %rsi
+	movl	$4, %ecx
+	leaq	0(,%rbx,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	40(%rsp), %rax
+	movq	56(%rsp), %rdi
+	movq	%rbp, %rsi
+	movl	$4, %ecx
+	leaq	0(,%rax,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L860:
+	.cfi_restore_state
+	movq	%rax, %rdi
+	call	*8(%rax)
+	jmp	.L792
+.L835:
+	movq	%rax, %rbx
+	jmp	.L820
+.L851:
+	jmp	.L852
+.L831:
+	movq	%rax, %rbx
+	jmp	.L810
+.L832:
+	movq	%rax, %rbx
+	jmp	.L815
+.L833:
+	movq	%rax, %rbx
+	jmp	.L819
+.L849:
+	jmp	.L850
+	.section	.gcc_except_table
+.LLSDA7031:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7031-.LLSDACSB7031
+.LLSDACSB7031:
+	.uleb128 .LEHB65-.LFB7031
+	.uleb128 .LEHE65-.LEHB65
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB66-.LFB7031
+	.uleb128 .LEHE66-.LEHB66
+	.uleb128 .L849-.LFB7031
+	.uleb128 0
+	.uleb128 .LEHB67-.LFB7031
+	.uleb128 .LEHE67-.LEHB67
+	.uleb128 .L831-.LFB7031
+	.uleb128 0
+	.uleb128 .LEHB68-.LFB7031
+	.uleb128 .LEHE68-.LEHB68
+	.uleb128 .L833-.LFB7031
+	.uleb128 0
+	.uleb128 .LEHB69-.LFB7031
+	.uleb128 .LEHE69-.LEHB69
+	.uleb128 .L832-.LFB7031
+	.uleb128 0
+	.uleb128 .LEHB70-.LFB7031
+	.uleb128 .LEHE70-.LEHB70
+	.uleb128 .L851-.LFB7031
+	.uleb128 0
+	.uleb128 .LEHB71-.LFB7031
+	.uleb128 .LEHE71-.LEHB71
+	.uleb128 .L835-.LFB7031
+	.uleb128 0
+.LLSDACSE7031:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7031
+	.type	_Z14test_take_dropv.cold, @function
+_Z14test_take_dropv.cold:
+.LFSB7031:
+.L856:
+	.cfi_def_cfa_offset 224
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC64(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB72:
+	call	__cxa_throw@PLT
+.LEHE72:
+.L820:
+	movq	16(%rsp), %rax
+	testq	%rax, %rax
+	je	.L824
+	subq	$1, 32(%rax)
+	jne	.L824
+	movq	%rax, %rdi
+	call	*8(%rax)
+.L824:
+	movq	96(%rsp), %rsi
+	movq	104(%rsp), %rax
+.L829:
+	movq	120(%rsp), %rdi
+	leaq	0(,%rax,4), %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L819:
+	movq	64(%rsp), %rsi
+	movq	72(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L814
+	movq	88(%rsp), %rdi
+	salq	$2, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L814:
+	movq	40(%rsp), %rdx
+	testq	%rbp, %rbp
+	je	.L828
+	movq	56(%rsp), %rdi
+	salq	$2, %rdx
+	movl	$4, %ecx
+	movq	%rbp, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L828:
+	movq	%rbx, %rdi
+.LEHB73:
+	call	_Unwind_Resume@PLT
+.LEHE73:
+.L834:
+.L852:
+	movq	%rax, %rbx
+	jmp	.L824
+.L801:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC63(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB74:
+	call	__cxa_throw@PLT
+.L836:
+	movq	96(%rsp), %rsi
+	movq	%rax, %rbx
+	movq	104(%rsp), %rax
+	testq	%rsi, %rsi
+	jne	.L829
+	jmp	.L819
+.L797:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC62(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE74:
+.L810:
+	movq	128(%rsp), %rax
+	testq	%rax, %rax
+	je	.L814
+	subq	$1, 32(%rax)
+	jne	.L814
+	movq	%rax, %rdi
+	call	*8(%rax)
+	jmp	.L814
+.L854:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC60(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB75:
+	call	__cxa_throw@PLT
+.L853:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC59(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE75:
+.L830:
+.L850:
+	movq	%rax, %rbx
+	jmp	.L814
+.L815:
+	movq	128(%rsp), %rax
+	testq	%rax, %rax
+	je	.L819
+	subq	$1, 32(%rax)
+	jne	.L819
+	movq	%rax, %rdi
+	call	*8(%rax)
+	jmp	.L819
+.L855:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC61(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB76:
+	call	__cxa_throw@PLT
+.LEHE76:
+	.cfi_endproc
+.LFE7031:
+	.section	.gcc_except_table
+.LLSDAC7031:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7031-.LLSDACSBC7031
+.LLSDACSBC7031:
+	.uleb128 .LEHB72-.LCOLDB65
+	.uleb128 .LEHE72-.LEHB72
+	.uleb128 .L834-.LCOLDB65
+	.uleb128 0
+	.uleb128 .LEHB73-.LCOLDB65
+	.uleb128 .LEHE73-.LEHB73
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB74-.LCOLDB65
+	.uleb128 .LEHE74-.LEHB74
+	.uleb128 .L836-.LCOLDB65
+	.uleb128 0
+	.uleb128 .LEHB75-.LCOLDB65
+	.uleb128 .LEHE75-.LEHB75
+	.uleb128 .L830-.LCOLDB65
+	.uleb128 0
+	.uleb128 .LEHB76-.LCOLDB65
+	.uleb128 .LEHE76-.LEHB76
+	.uleb128 .L830-.LCOLDB65
+	.uleb128 0
+.LLSDACSEC7031:
+	.section	.text.unlikely
+	.text
+	.size	_Z14test_take_dropv, .-_Z14test_take_dropv
+	.section	.text.unlikely
+	.size	_Z14test_take_dropv.cold, .-_Z14test_take_dropv.cold
+.LCOLDE65:
+	.text
+.LHOTE65:
+	.weak	_ZTSN1n15memory_resourceE
+	.section	.rodata._ZTSN1n15memory_resourceE,"aG",@progbits,_ZTSN1n15memory_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n15memory_resourceE, @object
+	.size	_ZTSN1n15memory_resourceE, 22
+_ZTSN1n15memory_resourceE:
+	.string	"N1n15memory_resourceE"
+	.weak	_ZTIN1n15memory_resourceE
+	.section	.data.rel.ro._ZTIN1n15memory_resourceE,"awG",@progbits,_ZTIN1n15memory_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n15memory_resourceE, @object
+	.size	_ZTIN1n15memory_resourceE, 16
+_ZTIN1n15memory_resourceE:
+	.quad	_ZTVN10__cxxabiv117__class_type_infoE+16
+	.quad	_ZTSN1n15memory_resourceE
+	.weak	_ZTSN1n13heap_resourceE
+	.section	.rodata._ZTSN1n13heap_resourceE,"aG",@progbits,_ZTSN1n13heap_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n13heap_resourceE, @object
+	.size	_ZTSN1n13heap_resourceE, 20
+_ZTSN1n13heap_resourceE:
+	.string	"N1n13heap_resourceE"
+	.weak	_ZTIN1n13heap_resourceE
+	.section	.data.rel.ro._ZTIN1n13heap_resourceE,"awG",@progbits,_ZTIN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n13heap_resourceE, @object
+	.size	_ZTIN1n13heap_resourceE, 24
+_ZTIN1n13heap_resourceE:
+	.quad	_ZTVN10__cxxabiv120__si_class_type_infoE+16
+	.quad	_ZTSN1n13heap_resourceE
+	.quad	_ZTIN1n15memory_resourceE
+	.weak	_ZTVN1n13heap_resourceE
+	.section	.data.rel.ro.local._ZTVN1n13heap_resourceE,"awG",@progbits,_ZTVN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTVN1n13heap_resourceE, @object
+	.size	_ZTVN1n13heap_resourceE, 48
+_ZTVN1n13heap_resourceE:
+	.quad	0
+	.quad	_ZTIN1n13heap_resourceE
+	.quad	_ZN1n13heap_resourceD1Ev
+	.quad	_ZN1n13heap_resourceD0Ev
+	.quad	_ZN1n13heap_resource8allocateEmm
+	.quad	_ZN1n13heap_resource10deallocateEPvmm
+	.weak	_ZGVZN1n8__framesEvE5cache
+	.section	.tbss._ZGVZN1n8__framesEvE5cache,"awTG",@nobits,_ZGVZN1n8__framesEvE5cache,comdat
+	.align 8
+	.type	_ZGVZN1n8__framesEvE5cache, @gnu_unique_object
+	.size	_ZGVZN1n8__framesEvE5cache, 8
+_ZGVZN1n8__framesEvE5cache:
+	.zero	8
+	.weak	_ZZN1n8__framesEvE5cache
+	.section	.tbss._ZZN1n8__framesEvE5cache,"awTG",@nobits,_ZZN1n8__framesEvE5cache,comdat
+	.align 8
+	.type	_ZZN1n8__framesEvE5cache, @gnu_unique_object
+	.size	_ZZN1n8__framesEvE5cache, 512
+_ZZN1n8__framesEvE5cache:
+	.zero	512
+	.weak	_ZN1n18__current_resourceE
+	.section	.tbss._ZN1n18__current_resourceE,"awTG",@nobits,_ZN1n18__current_resourceE,comdat
+	.align 8
+	.type	_ZN1n18__current_resourceE, @gnu_unique_object
+	.size	_ZN1n18__current_resourceE, 8
+_ZN1n18__current_resourceE:
+	.zero	8
+	.weak	_ZGVZN1n4heapEvE3res
+	.section	.bss._ZGVZN1n4heapEvE3res,"awG",@nobits,_ZGVZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZGVZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZGVZN1n4heapEvE3res, 8
+_ZGVZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE3res
+	.section	.bss._ZZN1n4heapEvE3res,"awG",@nobits,_ZZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZZN1n4heapEvE3res, 8
+_ZZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE7storage
+	.section	.bss._ZZN1n4heapEvE7storage,"awG",@nobits,_ZZN1n4heapEvE7storage,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE7storage, @gnu_unique_object
+	.size	_ZZN1n4heapEvE7storage, 8
+_ZZN1n4heapEvE7storage:
+	.zero	8
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC3:
+	.quad	0
+	.quad	23
+	.section	.rodata.cst2,"aM",@progbits,2
+	.align 2
+.LC16:
+	.byte	10
+	.byte	0
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC57:
+	.long	8
+	.long	100
+	.hidden	DW.ref._ZTIPKc
+	.weak	DW.ref._ZTIPKc
+	.section	.data.rel.local.DW.ref._ZTIPKc,"awG",@progbits,DW.ref._ZTIPKc,comdat
+	.align 8
+	.type	DW.ref._ZTIPKc, @object
+	.size	DW.ref._ZTIPKc, 8
+DW.ref._ZTIPKc:
+	.quad	_ZTIPKc
+	.hidden	DW.ref.__gxx_personality_v0
+	.weak	DW.ref.__gxx_personality_v0
+	.section	.data.rel.local.DW.ref.__gxx_personality_v0,"awG",@progbits,DW.ref.__gxx_personality_v0,comdat
+	.align 8
+	.type	DW.ref.__gxx_personality_v0, @object
+	.size	DW.ref.__gxx_personality_v0, 8
+DW.ref.__gxx_personality_v0:
+	.quad	__gxx_personality_v0
+	.hidden	__dso_handle
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,8706 @@
+	.file	"tests-aho-corasick.cpp"
+	.text
+	.section	.text._ZN1n13heap_resourceD2Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD2Ev
+	.type	_ZN1n13heap_resourceD2Ev, @function
+_ZN1n13heap_resourceD2Ev:
+.LFB7115:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7115:
+	.size	_ZN1n13heap_resourceD2Ev, .-_ZN1n13heap_resourceD2Ev
+	.weak	_ZN1n13heap_resourceD1Ev
+	.set	_ZN1n13heap_resourceD1Ev,_ZN1n13heap_resourceD2Ev
+	.section	.text._ZN1n13heap_resource10deallocateEPvmm,"axG",@progbits,_ZN1n13heap_resource10deallocateEPvmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource10deallocateEPvmm
+	.type	_ZN1n13heap_resource10deallocateEPvmm, @function
+_ZN1n13heap_resource10deallocateEPvmm:
+.LFB6517:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rcx
+	jbe	.L4
+	movq	%rcx, %rsi
+	jmp	_ZdlPvSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	jmp	_ZdlPv@PLT
+	.cfi_endproc
+.LFE6517:
+	.size	_ZN1n13heap_resource10deallocateEPvmm, .-_ZN1n13heap_resource10deallocateEPvmm
+	.section	.text._ZN1n13heap_resource8allocateEmm,"axG",@progbits,_ZN1n13heap_resource8allocateEmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource8allocateEmm
+	.type	_ZN1n13heap_resource8allocateEmm, @function
+_ZN1n13heap_resource8allocateEmm:
+.LFB6516:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rdx
+	jbe	.L6
+	movq	%rdx, %rsi
+	jmp	_ZnwmSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	jmp	_Znwm@PLT
+	.cfi_endproc
+.LFE6516:
+	.size	_ZN1n13heap_resource8allocateEmm, .-_ZN1n13heap_resource8allocateEmm
+	.section	.text._ZN1n13heap_resourceD0Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD0Ev
+	.type	_ZN1n13heap_resourceD0Ev, @function
+_ZN1n13heap_resourceD0Ev:
+.LFB7117:
+	.cfi_startproc
+	movl	$8, %esi
+	jmp	_ZdlPvm@PLT
+	.cfi_endproc
+.LFE7117:
+	.size	_ZN1n13heap_resourceD0Ev, .-_ZN1n13heap_resourceD0Ev
+	.section	.rodata._ZN1n4test10test_suite7run_allEv.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"\nSUITE [%s] "
+.LC2:
+	.string	"%s"
+.LC3:
+	.string	"\nTEST [%s] "
+.LC4:
+	.string	" - Result : \033[1;32mPASSED\033[0m"
+.LC5:
+	.string	"\033[1;31merror : %s\033[0m\n"
+.LC6:
+	.string	" - Result : \033[1;31mFAILED\033[0m"
+.LC7:
+	.string	" - Passed : \033[1;32m%d\033[0m\n"
+.LC8:
+	.string	" - Failed : \033[1;31m%d\033[0m\n"
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4test10test_suite7run_allEv
+	.type	_ZN1n4test10test_suite7run_allEv, @function
+_ZN1n4test10test_suite7run_allEv:
+.LFB6757:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6757
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rdx
+	movl	$79, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	16(%rdi), %rcx
+	leaq	16(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L9
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L10
+	testb	$4, %cl
+	jne	.L63
+	testl	%ecx, %ecx
+	je	.L9
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L64
+	.p2align 4,,10
+	.p2align 3
+.L9:
+	movzwl	.LC1(%rip), %r15d
+	movq	%rbx, %rsi
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+.LEHB0:
+	call	printf@PLT
+	movl	8(%r12), %esi
+	testl	%esi, %esi
+	jle	.L30
+	movl	$0, 12(%rsp)
+	xorl	%ebp, %ebp
+	xorl	%r14d, %r14d
+	jmp	.L24
+	.p2align 4,,10
+	.p2align 3
+.L67:
+	testb	$4, %dl
+	jne	.L65
+	testl	%edx, %edx
+	je	.L15
+	movb	$42, (%rax)
+	testb	$2, %dl
+	jne	.L66
+	.p2align 4,,10
+	.p2align 3
+.L15:
+	movq	%rbx, %rsi
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+.LEHE0:
+	movq	(%r12), %rax
+.LEHB1:
+	call	*8(%rax,%r13)
+.LEHE1:
+	leaq	.LC4(%rip), %rdi
+	addl	$1, %r14d
+.LEHB2:
+	call	puts@PLT
+.L20:
+	addq	$1, %rbp
+	cmpl	%ebp, 8(%r12)
+	jle	.L14
+.L24:
+	movq	(%r12), %rax
+	movq	%rbp, %r13
+	movq	%rbx, %rdi
+	movl	$79, %esi
+	salq	$4, %r13
+	leaq	.LC3(%rip), %rdx
+	movq	(%rax,%r13), %rcx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L15
+	movl	$79, %edx
+	subl	%eax, %edx
+	addq	%rbx, %rax
+	cmpl	$8, %edx
+	jb	.L67
+	movabsq	$3038287259199220266, %rsi
+	leaq	8(%rax), %rdi
+	movl	%edx, %ecx
+	andq	$-8, %rdi
+	movq	%rsi, (%rax)
+	movq	%rsi, -8(%rax,%rcx)
+	subq	%rdi, %rax
+	leal	(%rdx,%rax), %ecx
+	movq	%rsi, %rax
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L15
+.L30:
+	movl	$0, 12(%rsp)
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L14:
+	movabsq	$5917806138674729738, %rax
+	movq	%rbx, %rdi
+	movq	%rax, 16(%rsp)
+	movabsq	$9095440486453792, %rax
+	movq	%rax, 22(%rsp)
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L25
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L26
+	testb	$4, %cl
+	jne	.L68
+	testl	%ecx, %ecx
+	je	.L25
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L69
+.L25:
+	movq	%rbx, %rsi
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+	movl	%r14d, %esi
+	leaq	.LC7(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	12(%rsp), %esi
+	leaq	.LC8(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	$10, %edi
+	call	putchar@PLT
+.LEHE2:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L26:
+	.cfi_restore_state
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L25
+.L10:
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L9
+.L65:
+	movl	$707406378, (%rax)
+	movl	$707406378, -4(%rax,%rdx)
+	jmp	.L15
+.L66:
+	movl	$10794, %ecx
+	movw	%cx, -2(%rax,%rdx)
+	jmp	.L15
+.L64:
+	movl	$10794, %edi
+	movw	%di, -2(%rdx,%rcx)
+	jmp	.L9
+.L69:
+	movl	$10794, %eax
+	movw	%ax, -2(%rdx,%rcx)
+	jmp	.L25
+.L63:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L9
+.L68:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L25
+.L31:
+	movq	%rax, %rdi
+	movq	%rdx, %rax
+.L21:
+	subq	$1, %rax
+	jne	.L62
+	call	__cxa_begin_catch@PLT
+	leaq	.LC5(%rip), %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+.LEHB3:
+	call	printf@PLT
+.LEHE3:
+	call	__cxa_end_catch@PLT
+	leaq	.LC6(%rip), %rdi
+	addl	$1, 12(%rsp)
+.LEHB4:
+	call	puts@PLT
+	jmp	.L20
+.L23:
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+.L62:
+	call	_Unwind_Resume@PLT
+.LEHE4:
+.L32:
+	movq	%rax, %rbx
+	jmp	.L23
+	.cfi_endproc
+.LFE6757:
+	.globl	__gxx_personality_v0
+	.section	.gcc_except_table._ZN1n4test10test_suite7run_allEv,"aG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.align 4
+.LLSDA6757:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT6757-.LLSDATTD6757
+.LLSDATTD6757:
+	.byte	0x1
+	.uleb128 .LLSDACSE6757-.LLSDACSB6757
+.LLSDACSB6757:
+	.uleb128 .LEHB0-.LFB6757
+	.uleb128 .LEHE0-.LEHB0
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB1-.LFB6757
+	.uleb128 .LEHE1-.LEHB1
+	.uleb128 .L31-.LFB6757
+	.uleb128 0x1
+	.uleb128 .LEHB2-.LFB6757
+	.uleb128 .LEHE2-.LEHB2
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB3-.LFB6757
+	.uleb128 .LEHE3-.LEHB3
+	.uleb128 .L32-.LFB6757
+	.uleb128 0
+	.uleb128 .LEHB4-.LFB6757
+	.uleb128 .LEHE4-.LEHB4
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6757:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	DW.ref._ZTIPKc-.
+.LLSDATT6757:
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.size	_ZN1n4test10test_suite7run_allEv, .-_ZN1n4test10test_suite7run_allEv
+	.section	.text._ZN1n12aho_corasickIcED2Ev,"axG",@progbits,_ZN1n12aho_corasickIcED5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n12aho_corasickIcED2Ev
+	.type	_ZN1n12aho_corasickIcED2Ev, @function
+_ZN1n12aho_corasickIcED2Ev:
+.LFB6764:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6764
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	64(%rdi), %rsi
+	movq	%rdi, %rbx
+	testq	%rsi, %rsi
+	je	.L71
+	movq	72(%rbx), %rax
+	movq	88(%rdi), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L71:
+	movq	32(%rbx), %rsi
+	testq	%rsi, %rsi
+	je	.L72
+	movq	40(%rbx), %rax
+	movq	56(%rbx), %rdi
+	movl	$4, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L72:
+	movq	(%rbx), %rsi
+	testq	%rsi, %rsi
+	je	.L70
+	movq	8(%rbx), %rax
+	movq	24(%rbx), %rdi
+	movl	$4, %ecx
+	leaq	(%rax,%rax,4), %rdx
+	movq	(%rdi), %rax
+	salq	$2, %rdx
+	call	*24(%rax)
+.L70:
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE6764:
+	.section	.gcc_except_table._ZN1n12aho_corasickIcED2Ev,"aG",@progbits,_ZN1n12aho_corasickIcED5Ev,comdat
+.LLSDA6764:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6764-.LLSDACSB6764
+.LLSDACSB6764:
+.LLSDACSE6764:
+	.section	.text._ZN1n12aho_corasickIcED2Ev,"axG",@progbits,_ZN1n12aho_corasickIcED5Ev,comdat
+	.size	_ZN1n12aho_corasickIcED2Ev, .-_ZN1n12aho_corasickIcED2Ev
+	.weak	_ZN1n12aho_corasickIcED1Ev
+	.set	_ZN1n12aho_corasickIcED1Ev,_ZN1n12aho_corasickIcED2Ev
+	.section	.text._ZN1n12aho_corasickIwED2Ev,"axG",@progbits,_ZN1n12aho_corasickIwED5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n12aho_corasickIwED2Ev
+	.type	_ZN1n12aho_corasickIwED2Ev, @function
+_ZN1n12aho_corasickIwED2Ev:
+.LFB6814:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6814
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	64(%rdi), %rsi
+	movq	%rdi, %rbx
+	testq	%rsi, %rsi
+	je	.L85
+	movq	72(%rbx), %rax
+	movq	88(%rdi), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L85:
+	movq	32(%rbx), %rsi
+	testq	%rsi, %rsi
+	je	.L86
+	movq	40(%rbx), %rax
+	movq	56(%rbx), %rdi
+	movl	$4, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L86:
+	movq	(%rbx), %rsi
+	testq	%rsi, %rsi
+	je	.L84
+	movq	8(%rbx), %rax
+	movq	24(%rbx), %rdi
+	movl	$4, %ecx
+	leaq	(%rax,%rax,4), %rdx
+	movq	(%rdi), %rax
+	salq	$2, %rdx
+	call	*24(%rax)
+.L84:
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE6814:
+	.section	.gcc_except_table._ZN1n12aho_corasickIwED2Ev,"aG",@progbits,_ZN1n12aho_corasickIwED5Ev,comdat
+.LLSDA6814:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6814-.LLSDACSB6814
+.LLSDACSB6814:
+.LLSDACSE6814:
+	.section	.text._ZN1n12aho_corasickIwED2Ev,"axG",@progbits,_ZN1n12aho_corasickIwED5Ev,comdat
+	.size	_ZN1n12aho_corasickIwED2Ev, .-_ZN1n12aho_corasickIwED2Ev
+	.weak	_ZN1n12aho_corasickIwED1Ev
+	.set	_ZN1n12aho_corasickIwED1Ev,_ZN1n12aho_corasickIwED2Ev
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC9:
+	.string	"n::aho_corasick tests"
+.LC10:
+	.string	"test_aho_corasick_overlaps"
+.LC11:
+	.string	"test_aho_corasick_count"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC12:
+	.string	"test_aho_corasick_against_naive"
+	.section	.rodata.str1.1
+.LC13:
+	.string	"test_aho_corasick_wide"
+	.section	.text.unlikely,"ax",@progbits
+.LCOLDB15:
+	.section	.text.startup,"ax",@progbits
+.LHOTB15:
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB6829:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6829
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$1600, %edi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 64
+.LEHB5:
+	call	_Znam@PLT
+.LEHE5:
+	movq	%rax, %rbx
+	leaq	1600(%rax), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L99:
+	movq	$0, (%rax)
+	addq	$16, %rax
+	movq	$0, -8(%rax)
+	cmpq	%rax, %rdx
+	jne	.L99
+	leaq	.LC9(%rip), %rax
+	movq	%rsp, %rdi
+	movq	%rbx, (%rsp)
+	movq	%rax, 16(%rsp)
+	leaq	.LC10(%rip), %rax
+	movq	%rax, (%rbx)
+	leaq	_Z26test_aho_corasick_overlapsv(%rip), %rax
+	movq	%rax, 8(%rbx)
+	leaq	.LC11(%rip), %rax
+	movq	%rax, 16(%rbx)
+	leaq	_Z23test_aho_corasick_countv(%rip), %rax
+	movq	%rax, 24(%rbx)
+	leaq	.LC12(%rip), %rax
+	movq	%rax, 32(%rbx)
+	leaq	_Z31test_aho_corasick_against_naivev(%rip), %rax
+	movq	%rax, 40(%rbx)
+	leaq	.LC13(%rip), %rax
+	movq	%rax, 48(%rbx)
+	leaq	_Z22test_aho_corasick_widev(%rip), %rax
+	movq	%rax, 56(%rbx)
+	movq	.LC14(%rip), %rax
+	movq	%rax, 8(%rsp)
+.LEHB6:
+	call	_ZN1n4test10test_suite7run_allEv
+.LEHE6:
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L101:
+	.cfi_restore_state
+	movq	%rax, %rbp
+	jmp	.L100
+	.section	.gcc_except_table,"a",@progbits
+.LLSDA6829:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6829-.LLSDACSB6829
+.LLSDACSB6829:
+	.uleb128 .LEHB5-.LFB6829
+	.uleb128 .LEHE5-.LEHB5
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB6-.LFB6829
+	.uleb128 .LEHE6-.LEHB6
+	.uleb128 .L101-.LFB6829
+	.uleb128 0
+.LLSDACSE6829:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6829
+	.type	main.cold, @function
+main.cold:
+.LFSB6829:
+.L100:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	movq	%rbp, %rdi
+.LEHB7:
+	call	_Unwind_Resume@PLT
+.LEHE7:
+	.cfi_endproc
+.LFE6829:
+	.section	.gcc_except_table
+.LLSDAC6829:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6829-.LLSDACSBC6829
+.LLSDACSBC6829:
+	.uleb128 .LEHB7-.LCOLDB15
+	.uleb128 .LEHE7-.LEHB7
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6829:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	main, .-main
+	.section	.text.unlikely
+	.size	main.cold, .-main.cold
+.LCOLDE15:
+	.section	.text.startup
+.LHOTE15:
+	.section	.text._ZN1n6vectorINS_6stringIcEEE9__releaseEv,"axG",@progbits,_ZN1n6vectorINS_6stringIcEEE9__releaseEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n6vectorINS_6stringIcEEE9__releaseEv
+	.type	_ZN1n6vectorINS_6stringIcEEE9__releaseEv, @function
+_ZN1n6vectorINS_6stringIcEEE9__releaseEv:
+.LFB6913:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6913
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movq	16(%rdi), %rbp
+	movq	(%rdi), %rsi
+	testq	%rbp, %rbp
+	je	.L107
+	movq	%rsi, %rbx
+	xorl	%r13d, %r13d
+	.p2align 4,,10
+	.p2align 3
+.L111:
+	movq	8(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L108
+	movq	16(%rbx), %rdi
+	addq	$1, %r13
+	movq	24(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	addq	$48, %rbx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	%r13, %rbp
+	jne	.L111
+.L110:
+	movq	(%r12), %rsi
+.L107:
+	testq	%rsi, %rsi
+	je	.L112
+	movq	8(%r12), %rax
+	movq	24(%r12), %rdi
+	movl	$8, %ecx
+	leaq	(%rax,%rax,2), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+.LEHB8:
+	call	*24(%rax)
+.LEHE8:
+.L112:
+	pxor	%xmm0, %xmm0
+	movq	$0, (%r12)
+	movups	%xmm0, 8(%r12)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L108:
+	.cfi_restore_state
+	addq	$1, %r13
+	addq	$48, %rbx
+	cmpq	%r13, %rbp
+	jne	.L111
+	jmp	.L110
+	.cfi_endproc
+.LFE6913:
+	.section	.gcc_except_table
+.LLSDA6913:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6913-.LLSDACSB6913
+.LLSDACSB6913:
+	.uleb128 .LEHB8-.LFB6913
+	.uleb128 .LEHE8-.LEHB8
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6913:
+	.section	.text._ZN1n6vectorINS_6stringIcEEE9__releaseEv,"axG",@progbits,_ZN1n6vectorINS_6stringIcEEE9__releaseEv,comdat
+	.size	_ZN1n6vectorINS_6stringIcEEE9__releaseEv, .-_ZN1n6vectorINS_6stringIcEEE9__releaseEv
+	.section	.text.unlikely
+.LCOLDB19:
+	.text
+.LHOTB19:
+	.p2align 4
+	.globl	_Z8keywordsPKPKcm
+	.type	_Z8keywordsPKPKcm, @function
+_Z8keywordsPKPKcm:
+.LFB6758:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6758
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pxor	%xmm0, %xmm0
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$120, %rsp
+	.cfi_def_cfa_offset 176
+	movq	$0, (%rdi)
+	movq	%rsi, 48(%rsp)
+	movq	%rdx, 56(%rsp)
+	movups	%xmm0, 8(%rdi)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L201
+.L121:
+	cmpq	$0, 56(%rsp)
+	movq	%rax, 24(%r12)
+	je	.L120
+	movq	$0, 24(%rsp)
+	leaq	88(%rsp), %rax
+	movq	%rax, 40(%rsp)
+.L125:
+	movq	48(%rsp), %rax
+	movq	24(%rsp), %rcx
+	movq	(%rax,%rcx,8), %r13
+	testq	%r13, %r13
+	je	.L202
+	cmpb	$0, 0(%r13)
+	je	.L164
+	leaq	1(%r13), %rdi
+	call	strlen@PLT
+	leaq	1(%rax), %rbx
+.L129:
+	movdqa	.LC16(%rip), %xmm1
+	movaps	%xmm1, 64(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r14
+	testq	%r14, %r14
+	je	.L165
+	movq	40(%rsp), %rax
+	pxor	%xmm5, %xmm5
+	movq	%r14, 80(%rsp)
+	movq	$0, 104(%rsp)
+	movq	%rbx, 16(%rsp)
+	movq	%rax, %rbp
+	movups	%xmm5, 88(%rsp)
+	cmpq	%rax, %r13
+	jnb	.L166
+	movq	$0, 8(%rsp)
+.L128:
+	cmpq	$23, %rbx
+	jbe	.L141
+	movq	%rbp, 32(%rsp)
+	movl	$23, %r15d
+.L161:
+	leaq	10(%r15,%r15), %rax
+	movl	$1, %edx
+	movq	%r14, %rdi
+	cmpq	%rbx, %rax
+	cmovnb	%rax, %rbx
+	movq	(%r14), %rax
+	leaq	1(%rbx), %rsi
+.LEHB9:
+	call	*16(%rax)
+	movq	%rax, %rbp
+	movq	8(%rsp), %rax
+	movq	32(%rsp), %rsi
+	movq	%rbp, %rdi
+	leaq	1(%rax), %rdx
+	call	memcpy@PLT
+	cmpq	$23, %r15
+	je	.L137
+	movq	(%r14), %rax
+	leaq	1(%r15), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.LEHE9:
+.L137:
+	movq	%rbp, 88(%rsp)
+	movq	%rbx, 72(%rsp)
+	cmpq	$23, %rbx
+	je	.L203
+.L141:
+	movq	16(%rsp), %rbx
+	movq	8(%rsp), %rdi
+	movq	%r13, %rsi
+	movq	%rbx, %rdx
+	addq	%rbp, %rdi
+	call	memmove@PLT
+	movq	64(%rsp), %rax
+	addq	%rbx, %rax
+	movq	%rax, 64(%rsp)
+	movb	$0, 0(%rbp,%rax)
+	movq	16(%r12), %rax
+	movq	8(%r12), %rbx
+	cmpq	%rbx, %rax
+	je	.L204
+	movdqa	.LC16(%rip), %xmm2
+	leaq	(%rax,%rax,2), %rbx
+	salq	$4, %rbx
+	addq	(%r12), %rbx
+	movups	%xmm2, (%rbx)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L205
+.L153:
+	movq	80(%rsp), %rax
+	movdqa	64(%rsp), %xmm4
+	pxor	%xmm3, %xmm3
+	movq	$0, 40(%rbx)
+	movups	%xmm3, 24(%rbx)
+	movq	%rax, 16(%rbx)
+	movq	72(%rsp), %rax
+	movups	%xmm4, (%rbx)
+	cmpq	$23, %rax
+	je	.L206
+	movq	88(%rsp), %rax
+	movq	%rax, 24(%rbx)
+	movq	16(%r12), %rax
+	addq	$1, %rax
+.L156:
+	addq	$1, 24(%rsp)
+	movq	%rax, 16(%r12)
+	movq	24(%rsp), %rax
+	cmpq	%rax, 56(%rsp)
+	jne	.L125
+.L120:
+	addq	$120, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%r12, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L204:
+	.cfi_restore_state
+	leaq	5(%rbx), %rdx
+	movq	24(%r12), %rdi
+	movq	(%r12), %rbp
+	leaq	(%rdx,%rdx), %rax
+	leaq	(%rax,%rdx), %rsi
+	movq	%rax, 8(%r12)
+	movq	(%rdi), %rax
+	movl	$8, %edx
+	salq	$5, %rsi
+.LEHB10:
+	call	*16(%rax)
+	movq	16(%r12), %rdx
+	movdqa	.LC16(%rip), %xmm6
+	movq	%rax, (%r12)
+	leaq	(%rdx,%rdx,2), %rdx
+	salq	$4, %rdx
+	leaq	(%rax,%rdx), %r13
+	movups	%xmm6, 0(%r13)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L207
+.L145:
+	movq	80(%rsp), %rax
+	movdqa	64(%rsp), %xmm0
+	pxor	%xmm7, %xmm7
+	movq	$0, 40(%r13)
+	movups	%xmm7, 24(%r13)
+	movq	%rax, 16(%r13)
+	movq	72(%rsp), %rax
+	movups	%xmm0, 0(%r13)
+	cmpq	$23, %rax
+	je	.L208
+	movq	$23, 72(%rsp)
+	movq	88(%rsp), %rax
+	movq	%rax, 24(%r13)
+.L148:
+	movq	16(%r12), %rax
+	movq	(%r12), %rdi
+	movb	$0, 88(%rsp)
+	movq	$0, 64(%rsp)
+	testq	%rax, %rax
+	jne	.L209
+	testq	%rbp, %rbp
+	je	.L151
+.L150:
+	movq	24(%r12), %rdi
+	leaq	(%rbx,%rbx,2), %rdx
+	movl	$8, %ecx
+	movq	%rbp, %rsi
+	salq	$4, %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE10:
+.L200:
+	movq	16(%r12), %rax
+.L151:
+	addq	$1, %rax
+	jmp	.L156
+	.p2align 4,,10
+	.p2align 3
+.L202:
+	movdqa	.LC16(%rip), %xmm6
+	movaps	%xmm6, 64(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r14
+	testq	%r14, %r14
+	je	.L163
+	pxor	%xmm7, %xmm7
+	movq	%r14, 80(%rsp)
+	movq	40(%rsp), %rbp
+	movq	$0, 104(%rsp)
+	movq	$0, 16(%rsp)
+	movq	$0, 8(%rsp)
+	movups	%xmm7, 88(%rsp)
+	jmp	.L141
+	.p2align 4,,10
+	.p2align 3
+.L166:
+	movq	%rax, 32(%rsp)
+	movl	$23, %r15d
+	movq	$0, 8(%rsp)
+.L130:
+	cmpq	%rbx, %r15
+	jb	.L161
+	movq	%r15, %rbx
+	xorl	%ebp, %ebp
+	cmpq	$23, %rbx
+	jne	.L141
+.L203:
+	movq	40(%rsp), %rbp
+	jmp	.L141
+	.p2align 4,,10
+	.p2align 3
+.L206:
+	movdqu	88(%rsp), %xmm5
+	movq	104(%rsp), %rax
+	movups	%xmm5, 24(%rbx)
+	movq	%rax, 40(%rbx)
+	jmp	.L200
+	.p2align 4,,10
+	.p2align 3
+.L165:
+	movq	%rbx, 16(%rsp)
+.L127:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L210
+.L132:
+	movq	64(%rsp), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %r14
+	pxor	%xmm0, %xmm0
+	movq	$0, 104(%rsp)
+	movq	16(%rsp), %rcx
+	movq	72(%rsp), %r15
+	movups	%xmm0, 88(%rsp)
+	movq	%rax, 8(%rsp)
+	movq	%r14, 80(%rsp)
+	leaq	(%rcx,%rax), %rbx
+	movq	$0, 32(%rsp)
+	cmpq	$23, %r15
+	je	.L211
+.L134:
+	movq	32(%rsp), %rax
+	movq	8(%rsp), %rcx
+	addq	%rcx, %rax
+	cmpq	%rax, %r13
+	jnb	.L130
+	movq	32(%rsp), %rax
+	subq	%rax, %r13
+	cmpq	%rbx, %r15
+	jnb	.L169
+	leaq	10(%r15,%r15), %rax
+	movl	$1, %edx
+	movq	%r14, %rdi
+	cmpq	%rbx, %rax
+	cmovnb	%rax, %rbx
+	movq	(%r14), %rax
+	leaq	1(%rbx), %rsi
+.LEHB11:
+	call	*16(%rax)
+	movq	8(%rsp), %rcx
+	movq	32(%rsp), %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	leaq	1(%rcx), %rdx
+	call	memcpy@PLT
+	cmpq	$23, %r15
+	je	.L139
+	movq	(%r14), %rax
+	leaq	1(%r15), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.LEHE11:
+.L139:
+	movq	%rbp, 88(%rsp)
+	movq	%rbx, %r15
+	movq	%rbx, 72(%rsp)
+.L138:
+	cmpq	$23, %r15
+	jne	.L199
+	leaq	88(%rsp), %rbp
+.L199:
+	addq	%rbp, %r13
+	jmp	.L141
+	.p2align 4,,10
+	.p2align 3
+.L205:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L153
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L153
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L153
+	.p2align 4,,10
+	.p2align 3
+.L209:
+	leaq	(%rax,%rax,2), %rdx
+	movq	%rbp, %rsi
+	salq	$4, %rdx
+	call	memcpy@PLT
+	jmp	.L150
+	.p2align 4,,10
+	.p2align 3
+.L169:
+	xorl	%ebp, %ebp
+	jmp	.L138
+	.p2align 4,,10
+	.p2align 3
+.L164:
+	xorl	%ebx, %ebx
+	jmp	.L129
+	.p2align 4,,10
+	.p2align 3
+.L208:
+	movdqu	88(%rsp), %xmm7
+	movq	104(%rsp), %rax
+	movups	%xmm7, 24(%r13)
+	movq	%rax, 40(%r13)
+	jmp	.L148
+.L207:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L145
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r14
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L145
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r14, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L145
+.L210:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L132
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L132
+.L163:
+	movq	$0, 16(%rsp)
+	jmp	.L127
+.L201:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L212
+.L123:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	jmp	.L121
+.L212:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L123
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L123
+.L211:
+	leaq	88(%rsp), %rbp
+	cmpq	%rbp, %r13
+	jb	.L128
+	movq	%rbp, 32(%rsp)
+	jmp	.L134
+.L171:
+	movq	%rax, %rbx
+	jmp	.L160
+.L172:
+	movq	%rax, %rbx
+	jmp	.L158
+	.section	.gcc_except_table
+.LLSDA6758:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6758-.LLSDACSB6758
+.LLSDACSB6758:
+	.uleb128 .LEHB9-.LFB6758
+	.uleb128 .LEHE9-.LEHB9
+	.uleb128 .L171-.LFB6758
+	.uleb128 0
+	.uleb128 .LEHB10-.LFB6758
+	.uleb128 .LEHE10-.LEHB10
+	.uleb128 .L172-.LFB6758
+	.uleb128 0
+	.uleb128 .LEHB11-.LFB6758
+	.uleb128 .LEHE11-.LEHB11
+	.uleb128 .L171-.LFB6758
+	.uleb128 0
+.LLSDACSE6758:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6758
+	.type	_Z8keywordsPKPKcm.cold, @function
+_Z8keywordsPKPKcm.cold:
+.LFSB6758:
+.L158:
+	.cfi_def_cfa_offset 176
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	72(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L160
+	movq	80(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	88(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L160:
+	movq	%r12, %rdi
+	call	_ZN1n6vectorINS_6stringIcEEE9__releaseEv
+	movq	%rbx, %rdi
+.LEHB12:
+	call	_Unwind_Resume@PLT
+.LEHE12:
+	.cfi_endproc
+.LFE6758:
+	.section	.gcc_except_table
+.LLSDAC6758:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6758-.LLSDACSBC6758
+.LLSDACSBC6758:
+	.uleb128 .LEHB12-.LCOLDB19
+	.uleb128 .LEHE12-.LEHB12
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6758:
+	.section	.text.unlikely
+	.text
+	.size	_Z8keywordsPKPKcm, .-_Z8keywordsPKPKcm
+	.section	.text.unlikely
+	.size	_Z8keywordsPKPKcm.cold, .-_Z8keywordsPKPKcm.cold
+.LCOLDE19:
+	.text
+.LHOTE19:
+	.section	.text._ZN1n6vectorIjE6resizeEmRKj,"axG",@progbits,_ZN1n6vectorIjE6resizeEmRKj,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n6vectorIjE6resizeEmRKj
+	.type	_ZN1n6vectorIjE6resizeEmRKj, @function
+_ZN1n6vectorIjE6resizeEmRKj:
+.LFB6982:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rsi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	16(%rdi), %rcx
+	cmpq	%rcx, %rsi
+	jb	.L221
+	movq	8(%rdi), %r13
+	movq	%rdx, %r12
+	cmpq	%rsi, %r13
+	jnb	.L216
+	movq	(%rdi), %r15
+	cmpq	%r15, %rdx
+	jb	.L217
+	leaq	(%r15,%rcx,4), %rax
+	cmpq	%rax, %rdx
+	jnb	.L217
+	movl	(%rdx), %eax
+	leaq	12(%rsp), %rdx
+	movl	%eax, 12(%rsp)
+	call	_ZN1n6vectorIjE6resizeEmRKj
+	jmp	.L213
+	.p2align 4,,10
+	.p2align 3
+.L245:
+	leaq	0(,%rcx,4), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+.L219:
+	movq	24(%rbp), %rdi
+	movl	$4, %ecx
+	leaq	0(,%r13,4), %rdx
+	movq	%r15, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	16(%rbp), %rcx
+.L216:
+	cmpq	%rbx, %rcx
+	jnb	.L221
+	leaq	0(,%rbx,4), %r14
+.L220:
+	movq	%rbx, %rdi
+	movq	0(%rbp), %rsi
+	subq	%rcx, %rdi
+	leaq	-1(%rdi), %rax
+	cmpq	$3, %rax
+	jbe	.L244
+	leaq	0(,%rcx,4), %rax
+	leaq	(%rsi,%r14), %r8
+	leaq	(%rsi,%rax), %rdx
+	cmpq	%r8, %r12
+	jnb	.L229
+	leaq	4(%r12), %r8
+	cmpq	%r8, %rdx
+	jnb	.L229
+.L222:
+	addq	%rsi, %rax
+	leaq	(%rsi,%r14), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L227:
+	movl	(%r12), %ecx
+	addq	$4, %rax
+	movl	%ecx, -4(%rax)
+	cmpq	%rax, %rdx
+	jne	.L227
+.L221:
+	movq	%rbx, 16(%rbp)
+.L213:
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L217:
+	.cfi_restore_state
+	movq	24(%rbp), %rdi
+	leaq	0(,%rbx,4), %r14
+	movl	$4, %edx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	16(%rbp), %rcx
+	movq	%rbx, 8(%rbp)
+	movq	%rax, 0(%rbp)
+	testq	%rcx, %rcx
+	jne	.L245
+	testq	%r15, %r15
+	je	.L220
+	jmp	.L219
+	.p2align 4,,10
+	.p2align 3
+.L229:
+	movq	%rdx, %rax
+	movq	%rdi, %rdx
+	movd	(%r12), %xmm1
+	shrq	$2, %rdx
+	salq	$4, %rdx
+	pshufd	$0, %xmm1, %xmm0
+	addq	%rax, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L224:
+	movups	%xmm0, (%rax)
+	addq	$16, %rax
+	cmpq	%rdx, %rax
+	jne	.L224
+	movq	%rdi, %rax
+	andq	$-4, %rax
+	addq	%rcx, %rax
+	andl	$3, %edi
+	je	.L221
+	movl	(%r12), %edx
+	leaq	1(%rax), %rdi
+	leaq	0(,%rax,4), %rcx
+	movl	%edx, (%rsi,%rax,4)
+	cmpq	%rbx, %rdi
+	jnb	.L221
+	addq	$2, %rax
+	movl	%edx, 4(%rsi,%rcx)
+	cmpq	%rbx, %rax
+	jnb	.L221
+	movl	(%r12), %eax
+	movl	%eax, 8(%rsi,%rcx)
+	jmp	.L221
+	.p2align 4,,10
+	.p2align 3
+.L244:
+	leaq	0(,%rcx,4), %rax
+	jmp	.L222
+	.cfi_endproc
+.LFE6982:
+	.size	_ZN1n6vectorIjE6resizeEmRKj, .-_ZN1n6vectorIjE6resizeEmRKj
+	.section	.text._ZN1n12aho_corasickIcE7__buildERKNS_6vectorINS_6stringIcEEEE,"axG",@progbits,_ZN1n12aho_corasickIcE7__buildERKNS_6vectorINS_6stringIcEEEE,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n12aho_corasickIcE7__buildERKNS_6vectorINS_6stringIcEEEE
+	.type	_ZN1n12aho_corasickIcE7__buildERKNS_6vectorINS_6stringIcEEEE, @function
+_ZN1n12aho_corasickIcE7__buildERKNS_6vectorINS_6stringIcEEEE:
+.LFB6924:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6924
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$168, %rsp
+	.cfi_def_cfa_offset 224
+	movq	%rsi, 56(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbx
+	movq	%rbx, 72(%rsp)
+	testq	%rbx, %rbx
+	je	.L544
+.L247:
+	movq	72(%rsp), %rdi
+	movl	$8, %edx
+	movl	$400, %esi
+	movq	(%rdi), %rax
+.LEHB13:
+	call	*16(%rax)
+.LEHE13:
+	pxor	%xmm0, %xmm0
+	movq	%rax, 16(%rsp)
+	movups	%xmm0, 8(%rax)
+	movq	$0, (%rax)
+	movq	%rbx, 24(%rax)
+	movl	$-1, 32(%rax)
+	movq	56(%rsp), %rax
+	cmpq	$0, 16(%rax)
+	je	.L545
+	movq	$1, 32(%rsp)
+	movq	$10, 48(%rsp)
+	movq	$0, 24(%rsp)
+.L290:
+	movq	24(%rsp), %rax
+	movq	56(%rsp), %rcx
+	leaq	(%rax,%rax,2), %rax
+	salq	$4, %rax
+	addq	(%rcx), %rax
+	movq	(%rax), %r15
+	movq	%rax, (%rsp)
+	testq	%r15, %r15
+	je	.L258
+	addq	$24, %rax
+	xorl	%r12d, %r12d
+	xorl	%ebp, %ebp
+	movq	%rax, 40(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L283:
+	movq	(%rsp), %rax
+	cmpq	$23, 8(%rax)
+	je	.L546
+	movq	24(%rax), %rax
+.L260:
+	movq	16(%rsp), %rcx
+	movzbl	(%rax,%r12), %ebx
+	leaq	0(%rbp,%rbp,4), %rax
+	leaq	(%rcx,%rax,8), %r13
+	movq	0(%r13), %rax
+	movq	16(%r13), %rcx
+	movq	%rax, 8(%rsp)
+	testq	%rcx, %rcx
+	je	.L411
+	xorl	%edx, %edx
+	jmp	.L264
+	.p2align 4,,10
+	.p2align 3
+.L262:
+	addq	$1, %rdx
+	addq	$8, %rax
+	cmpq	%rcx, %rdx
+	je	.L412
+.L264:
+	cmpb	(%rax), %bl
+	jne	.L262
+	movl	4(%rax), %ebp
+	cmpl	$-1, %ebp
+	je	.L412
+.L263:
+	addq	$1, %r12
+	cmpq	%r15, %r12
+	jb	.L283
+	testl	%ebp, %ebp
+	je	.L258
+	movq	16(%rsp), %rdx
+	leaq	0(%rbp,%rbp,4), %rax
+	leaq	(%rdx,%rax,8), %rax
+	cmpl	$-1, 32(%rax)
+	jne	.L258
+	movl	24(%rsp), %ecx
+	movl	%ecx, 32(%rax)
+.L258:
+	movq	80(%r14), %rax
+	movq	72(%r14), %rbx
+	movq	64(%r14), %rbp
+	cmpq	%rbx, %rax
+	je	.L547
+	movq	%r15, 0(%rbp,%rax,8)
+.L533:
+	movq	80(%r14), %rax
+.L289:
+	movq	56(%rsp), %rcx
+	addq	$1, %rax
+	addq	$1, 24(%rsp)
+	movq	%rax, 80(%r14)
+	movq	24(%rsp), %rax
+	cmpq	16(%rcx), %rax
+	jb	.L290
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, 56(%rsp)
+	testq	%rax, %rax
+	je	.L292
+.L294:
+	movq	32(%rsp), %rax
+	movl	$40, %esi
+	movq	$10, 24(%rsp)
+	testq	%rax, %rax
+	jne	.L548
+.L298:
+	movq	56(%rsp), %rdi
+	movl	$4, %edx
+	movq	(%rdi), %rax
+.LEHB14:
+	call	*16(%rax)
+.LEHE14:
+	pxor	%xmm0, %xmm0
+	movq	%rax, 40(%rsp)
+	movq	$0, 128(%rsp)
+	movups	%xmm0, 136(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rdi
+	testq	%rdi, %rdi
+	je	.L299
+	movq	136(%rsp), %rbp
+	movq	32(%rsp), %rax
+	movq	%rdi, 152(%rsp)
+	movl	$0, 84(%rsp)
+	cmpq	%rax, %rbp
+	jb	.L549
+.L301:
+	xorl	%eax, %eax
+.L320:
+	movq	32(%rsp), %rdx
+	cmpq	%rdx, %rax
+	jnb	.L322
+.L540:
+	movq	128(%rsp), %rcx
+	subq	%rax, %rdx
+	xorl	%esi, %esi
+	salq	$2, %rdx
+	leaq	(%rcx,%rax,4), %rdi
+	call	memset@PLT
+.L322:
+	movq	32(%rsp), %rax
+	movq	%rax, 144(%rsp)
+.L306:
+	movq	40(%rsp), %rax
+	movl	$1, %ebx
+	movq	$0, 8(%rsp)
+	movl	$0, (%rax)
+	xorl	%eax, %eax
+.L342:
+	movq	16(%rsp), %rcx
+	leaq	(%rax,%rax,4), %rax
+	movl	$1, %r9d
+	leaq	(%rcx,%rax,8), %r13
+	movq	0(%r13), %r12
+	movq	16(%r13), %r11
+	leaq	8(%r12), %r8
+	cmpq	$1, %r11
+	jbe	.L550
+	.p2align 4,,10
+	.p2align 3
+.L332:
+	movzbl	(%r8), %edi
+	movl	4(%r8), %r10d
+	movq	%r8, %rax
+	movq	%r9, %rdx
+	jmp	.L329
+	.p2align 4,,10
+	.p2align 3
+.L331:
+	movq	-8(%rax), %rsi
+	movq	%rsi, (%rax)
+	leaq	-8(%rcx), %rax
+	subq	$1, %rdx
+	je	.L415
+.L329:
+	movq	%rax, %rcx
+	cmpb	%dil, -8(%rax)
+	jg	.L331
+.L330:
+	addq	$1, %r9
+	movb	%dil, (%rcx)
+	addq	$8, %r8
+	movl	%r10d, 4(%rcx)
+	cmpq	%r11, %r9
+	jne	.L332
+.L327:
+	xorl	%ebp, %ebp
+	jmp	.L340
+	.p2align 4,,10
+	.p2align 3
+.L333:
+	movl	4(%r12,%rbp,8), %eax
+	movq	40(%rsp), %rdx
+	addq	$1, %rbp
+	movl	%eax, (%rdx,%rbx,4)
+	addq	$1, %rbx
+	cmpq	16(%r13), %rbp
+	jnb	.L328
+.L340:
+	movl	4(%r12,%rbp,8), %edx
+	movq	128(%rsp), %rax
+	movl	%ebx, (%rax,%rdx,4)
+	cmpq	%rbx, 24(%rsp)
+	jne	.L333
+	movq	24(%rsp), %rax
+	movq	56(%rsp), %rdi
+	movl	$4, %edx
+	addq	$5, %rax
+	leaq	(%rax,%rax), %rcx
+	leaq	0(,%rax,8), %rsi
+	movq	(%rdi), %rax
+	movq	%rcx, (%rsp)
+.LEHB15:
+	call	*16(%rax)
+.LEHE15:
+	movq	%rax, %r15
+	movl	4(%r12,%rbp,8), %eax
+	leaq	0(,%rbx,4), %rdx
+	movl	%eax, (%r15,%rbx,4)
+	testq	%rbx, %rbx
+	jne	.L551
+	cmpq	$0, 40(%rsp)
+	je	.L336
+.L335:
+	movq	56(%rsp), %rdi
+	movq	24(%rsp), %rdx
+	movl	$4, %ecx
+	movq	40(%rsp), %rsi
+	movq	(%rdi), %rax
+	salq	$2, %rdx
+.LEHB16:
+	call	*24(%rax)
+.LEHE16:
+.L336:
+	movq	(%rsp), %rax
+	movq	%r15, 40(%rsp)
+	addq	$1, %rbx
+	addq	$1, %rbp
+	movq	%rax, 24(%rsp)
+	cmpq	16(%r13), %rbp
+	jb	.L340
+.L328:
+	addq	$1, 8(%rsp)
+	movq	8(%rsp), %rax
+	cmpq	%rbx, %rax
+	jnb	.L341
+.L559:
+	movq	40(%rsp), %rcx
+	movl	(%rcx,%rax,4), %eax
+	jmp	.L342
+	.p2align 4,,10
+	.p2align 3
+.L412:
+	movl	32(%rsp), %ebp
+	movq	%rcx, %r15
+	cmpq	%r15, 8(%r13)
+	je	.L552
+.L265:
+	movq	8(%rsp), %rax
+	leaq	(%rax,%r15,8), %rax
+	movb	%bl, (%rax)
+	movl	%ebp, 4(%rax)
+.L268:
+	addq	$1, %rcx
+	movq	%rcx, 16(%r13)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbx
+	testq	%rbx, %rbx
+	je	.L553
+.L269:
+	movq	32(%rsp), %rcx
+	cmpq	%rcx, 48(%rsp)
+	je	.L554
+	leaq	(%rcx,%rcx,4), %rax
+	movq	16(%rsp), %rcx
+	pxor	%xmm0, %xmm0
+	leaq	(%rcx,%rax,8), %rax
+	movq	$0, (%rax)
+	movq	%rbx, 24(%rax)
+	movl	$-1, 32(%rax)
+	movups	%xmm0, 8(%rax)
+.L282:
+	movq	(%rsp), %rax
+	addq	$1, 32(%rsp)
+	movq	(%rax), %r15
+	jmp	.L263
+	.p2align 4,,10
+	.p2align 3
+.L546:
+	movq	40(%rsp), %rax
+	jmp	.L260
+.L411:
+	movl	32(%rsp), %ebp
+	xorl	%r15d, %r15d
+	cmpq	%r15, 8(%r13)
+	jne	.L265
+.L552:
+	leaq	5(%r15), %rax
+	movq	24(%r13), %rdi
+	leaq	(%rax,%rax), %rdx
+	salq	$4, %rax
+	movq	%rax, %rsi
+	movq	(%rdi), %rax
+	movq	%rdx, 8(%r13)
+	movl	$4, %edx
+.LEHB17:
+	call	*16(%rax)
+	movq	16(%r13), %rcx
+	movq	%rax, 0(%r13)
+	movq	%rax, %rdi
+	leaq	0(,%rcx,8), %rdx
+	leaq	(%rax,%rdx), %rax
+	movb	%bl, (%rax)
+	movl	%ebp, 4(%rax)
+	testq	%rcx, %rcx
+	jne	.L555
+	cmpq	$0, 8(%rsp)
+	je	.L268
+.L267:
+	movq	24(%r13), %rdi
+	movq	8(%rsp), %rsi
+	movl	$4, %ecx
+	leaq	0(,%r15,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE17:
+	movq	16(%r13), %rcx
+	jmp	.L268
+.L554:
+	movq	48(%rsp), %rax
+	movq	72(%rsp), %rdi
+	movl	$8, %edx
+	addq	$5, %rax
+	leaq	(%rax,%rax,4), %rsi
+	leaq	(%rax,%rax), %r15
+	movq	(%rdi), %rax
+	salq	$4, %rsi
+.LEHB18:
+	call	*16(%rax)
+.LEHE18:
+	movq	32(%rsp), %rcx
+	movq	%rax, %r13
+	pxor	%xmm0, %xmm0
+	movq	%r13, %rdx
+	leaq	(%rcx,%rcx,4), %rsi
+	salq	$3, %rsi
+	leaq	(%rax,%rsi), %rax
+	movq	%rbx, 24(%rax)
+	movq	16(%rsp), %rbx
+	movq	$0, (%rax)
+	movl	$-1, 32(%rax)
+	addq	%rbx, %rsi
+	movups	%xmm0, 8(%rax)
+	movq	%rbx, %rax
+	testq	%rcx, %rcx
+	je	.L280
+	.p2align 4,,10
+	.p2align 3
+.L279:
+	movq	(%rax), %rcx
+	movdqu	8(%rax), %xmm1
+	addq	$40, %rax
+	addq	$40, %rdx
+	movq	%rcx, -40(%rdx)
+	movq	-16(%rax), %rcx
+	movups	%xmm1, -32(%rdx)
+	movq	%rcx, -16(%rdx)
+	movl	-8(%rax), %ecx
+	movl	%ecx, -8(%rdx)
+	cmpq	%rax, %rsi
+	jne	.L279
+.L280:
+	cmpq	$0, 16(%rsp)
+	je	.L278
+	movq	48(%rsp), %rax
+	movq	72(%rsp), %rdi
+	movl	$8, %ecx
+	movq	16(%rsp), %rsi
+	leaq	(%rax,%rax,4), %rdx
+	movq	(%rdi), %rax
+	salq	$3, %rdx
+.LEHB19:
+	call	*24(%rax)
+.LEHE19:
+.L278:
+	movq	%r15, 48(%rsp)
+	movq	%r13, 16(%rsp)
+	jmp	.L282
+.L553:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L556
+.L271:
+	movq	_ZZN1n4heapEvE3res(%rip), %rbx
+	jmp	.L269
+.L547:
+	leaq	5(%rbx), %rax
+	movq	88(%r14), %rdi
+	leaq	(%rax,%rax), %rdx
+	salq	$4, %rax
+	movq	%rax, %rsi
+	movq	(%rdi), %rax
+	movq	%rdx, 72(%r14)
+	movl	$8, %edx
+.LEHB20:
+	call	*16(%rax)
+	movq	%rax, 64(%r14)
+	movq	%rax, %rdi
+	movq	80(%r14), %rax
+	movq	%r15, (%rdi,%rax,8)
+	movq	80(%r14), %rax
+	testq	%rax, %rax
+	jne	.L557
+	testq	%rbp, %rbp
+	je	.L289
+.L288:
+	movq	88(%r14), %rdi
+	leaq	0(,%rbx,8), %rdx
+	movl	$8, %ecx
+	movq	%rbp, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE20:
+	jmp	.L533
+.L555:
+	movq	8(%rsp), %rsi
+	call	memcpy@PLT
+	jmp	.L267
+.L556:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L271
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L271
+.L557:
+	leaq	0(,%rax,8), %rdx
+	movq	%rbp, %rsi
+	call	memcpy@PLT
+	jmp	.L288
+.L548:
+	movq	%rax, 24(%rsp)
+	leaq	0(,%rax,4), %rsi
+.L293:
+	movq	%rax, 32(%rsp)
+	jmp	.L298
+.L549:
+	xorl	%ebx, %ebx
+	xorl	%eax, %eax
+	leaq	84(%rsp), %rdx
+.L409:
+	leaq	(%rbx,%rax,4), %rax
+	cmpq	%rax, %rdx
+	jnb	.L308
+	leaq	88(%rsp), %rdx
+	movl	$0, 88(%rsp)
+	cmpq	%rbx, %rdx
+	jb	.L309
+	cmpq	%rax, %rdx
+	jb	.L558
+.L309:
+	movq	32(%rsp), %r15
+	movq	(%rdi), %rax
+	movl	$4, %edx
+	leaq	0(,%r15,4), %rsi
+.LEHB21:
+	call	*16(%rax)
+	movq	%rax, 128(%rsp)
+	movq	%rax, %rdi
+	movq	144(%rsp), %rax
+	movq	%r15, 136(%rsp)
+	testq	%rax, %rax
+	jne	.L543
+	testq	%rbx, %rbx
+	je	.L320
+.L319:
+	movq	152(%rsp), %rdi
+	leaq	0(,%rbp,4), %rdx
+	movl	$4, %ecx
+	movq	%rbx, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE21:
+	movq	144(%rsp), %rax
+	jmp	.L320
+	.p2align 4,,10
+	.p2align 3
+.L415:
+	movq	%r12, %rcx
+	jmp	.L330
+.L551:
+	movq	40(%rsp), %rsi
+	movq	%r15, %rdi
+	call	memcpy@PLT
+	jmp	.L335
+.L550:
+	testq	%r11, %r11
+	jne	.L327
+	addq	$1, 8(%rsp)
+	movq	8(%rsp), %rax
+	cmpq	%rbx, %rax
+	jb	.L559
+.L341:
+	movq	8(%r14), %r13
+	movq	32(%rsp), %rax
+	movq	(%r14), %rbp
+	cmpq	%rax, %r13
+	jb	.L343
+.L534:
+	movq	16(%r14), %r12
+.L344:
+	testq	%rbx, %rbx
+	je	.L347
+	movq	$0, 64(%rsp)
+.L371:
+	movq	40(%rsp), %rax
+	movq	64(%rsp), %rcx
+	movq	16(%rsp), %rdx
+	movq	48(%r14), %r13
+	movl	(%rax,%rcx,4), %eax
+	leaq	(%rax,%rax,4), %rax
+	leaq	(%rdx,%rax,8), %r15
+	movq	16(%r15), %rdx
+	movl	32(%r15), %eax
+	movl	%edx, 8(%rsp)
+	movl	%eax, (%rsp)
+	cmpq	%r12, 8(%r14)
+	je	.L560
+	movl	%eax, %ecx
+	leaq	(%r12,%r12,4), %rax
+	leaq	0(%rbp,%rax,4), %rax
+	movl	%r13d, (%rax)
+	movl	%edx, 4(%rax)
+	movl	$0, 8(%rax)
+	movl	%ecx, 12(%rax)
+	movl	$-1, 16(%rax)
+.L355:
+	addq	$1, %r12
+	movq	%r12, 16(%r14)
+	testq	%rdx, %rdx
+	je	.L359
+	movq	48(%r14), %rbp
+	xorl	%r12d, %r12d
+	jmp	.L370
+	.p2align 4,,10
+	.p2align 3
+.L360:
+	movl	%eax, %edx
+	leaq	0(%r13,%rbp,8), %rax
+	movb	%cl, (%rax)
+	movl	%edx, 4(%rax)
+.L366:
+	addq	$1, %rbp
+	addq	$1, %r12
+	movq	%rbp, 48(%r14)
+	cmpq	16(%r15), %r12
+	jnb	.L561
+.L370:
+	movq	(%r15), %rax
+	movq	32(%r14), %r13
+	leaq	(%rax,%r12,8), %rax
+	movzbl	(%rax), %ecx
+	movl	4(%rax), %edx
+	movq	128(%rsp), %rax
+	movb	%cl, (%rsp)
+	movl	(%rax,%rdx,4), %eax
+	movl	%eax, 8(%rsp)
+	cmpq	%rbp, 40(%r14)
+	jne	.L360
+	leaq	5(%rbp), %rsi
+	movq	56(%r14), %rdi
+	movl	$4, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 40(%r14)
+	movq	(%rdi), %rax
+.LEHB22:
+	call	*16(%rax)
+.LEHE22:
+	movq	%rax, 32(%r14)
+	movq	%rax, %rdi
+	movq	48(%r14), %rax
+	movzbl	(%rsp), %esi
+	leaq	0(,%rax,8), %rcx
+	leaq	(%rdi,%rcx), %rdx
+	movb	%sil, (%rdx)
+	movl	8(%rsp), %esi
+	movl	%esi, 4(%rdx)
+	testq	%rax, %rax
+	jne	.L562
+	testq	%r13, %r13
+	je	.L417
+.L365:
+	movq	56(%r14), %rdi
+	leaq	0(,%rbp,8), %rdx
+	movl	$4, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+.LEHB23:
+	call	*24(%rax)
+.LEHE23:
+	movq	48(%r14), %rbp
+	jmp	.L366
+.L561:
+	movq	16(%r14), %r12
+.L359:
+	addq	$1, 64(%rsp)
+	movq	64(%rsp), %rax
+	movq	(%r14), %rbp
+	cmpq	%rbx, %rax
+	jne	.L371
+.L347:
+	movl	4(%rbp), %edx
+	testl	%edx, %edx
+	je	.L376
+	movq	32(%r14), %rax
+	leaq	(%rax,%rdx,8), %rsi
+.L375:
+	movl	4(%rax), %ecx
+	movzbl	(%rax), %edx
+	addq	$8, %rax
+	movl	%ecx, 96(%r14,%rdx,4)
+	cmpq	%rax, %rsi
+	jne	.L375
+.L376:
+	xorl	%r9d, %r9d
+	xorl	%eax, %eax
+	testq	%r12, %r12
+	je	.L374
+.L373:
+	leaq	(%rax,%rax,4), %rax
+	leaq	0(%rbp,%rax,4), %rax
+	movdqu	(%rax), %xmm2
+	movl	16(%rax), %eax
+	movaps	%xmm2, 96(%rsp)
+	movl	100(%rsp), %r8d
+	movl	%eax, 112(%rsp)
+	testl	%r8d, %r8d
+	je	.L390
+	movl	104(%rsp), %r10d
+	movl	96(%rsp), %edx
+	movq	32(%r14), %r11
+	movl	%r10d, (%rsp)
+	addl	%edx, %r8d
+	.p2align 4,,10
+	.p2align 3
+.L391:
+	movl	%edx, %eax
+	movq	%rbp, %rsi
+	leaq	(%r11,%rax,8), %rdi
+	movl	4(%rdi), %eax
+	leaq	(%rax,%rax,4), %rax
+	leaq	0(%rbp,%rax,4), %rcx
+	xorl	%eax, %eax
+	testl	%r9d, %r9d
+	jne	.L563
+.L380:
+	cmpl	$-1, 12(%rsi)
+	movl	%eax, 8(%rcx)
+	je	.L564
+	addl	$1, %edx
+	movl	%eax, 16(%rcx)
+	cmpl	%edx, %r8d
+	jne	.L391
+.L390:
+	leal	1(%r9), %eax
+	movq	%rax, %r9
+	cmpq	%r12, %rax
+	jb	.L373
+.L374:
+	movq	128(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L378
+	movq	136(%rsp), %rax
+	movq	152(%rsp), %rdi
+	movl	$4, %ecx
+	leaq	0(,%rax,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L378:
+	movq	40(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L392
+	movq	56(%rsp), %rdi
+	movq	24(%rsp), %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	salq	$2, %rdx
+	call	*24(%rax)
+.L392:
+	xorl	%ebp, %ebp
+	cmpq	$0, 32(%rsp)
+	movq	16(%rsp), %rbx
+	je	.L398
+.L399:
+	movq	(%rbx), %rsi
+	testq	%rsi, %rsi
+	je	.L396
+	movq	8(%rbx), %rax
+	movq	24(%rbx), %rdi
+	movl	$4, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L396:
+	movq	32(%rsp), %rax
+	addq	$1, %rbp
+	addq	$40, %rbx
+	cmpq	%rax, %rbp
+	jne	.L399
+.L398:
+	cmpq	$0, 16(%rsp)
+	je	.L246
+	movq	48(%rsp), %rax
+	movq	72(%rsp), %rdi
+	movl	$8, %ecx
+	movq	16(%rsp), %rsi
+	leaq	(%rax,%rax,4), %rdx
+	movq	(%rdi), %rax
+	salq	$3, %rdx
+	call	*24(%rax)
+.L246:
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L564:
+	.cfi_restore_state
+	movl	16(%rsi), %eax
+	addl	$1, %edx
+	movl	%eax, 16(%rcx)
+	cmpl	%edx, %r8d
+	jne	.L391
+	jmp	.L390
+	.p2align 4,,10
+	.p2align 3
+.L563:
+	movl	(%rsp), %eax
+	movzbl	(%rdi), %edi
+	testl	%eax, %eax
+	je	.L387
+	movl	(%rsp), %eax
+	.p2align 4,,10
+	.p2align 3
+.L381:
+	leaq	(%rax,%rax,4), %rax
+	xorl	%r10d, %r10d
+	leaq	0(%rbp,%rax,4), %r13
+	movl	0(%r13), %eax
+	movl	4(%r13), %r15d
+	leaq	(%r11,%rax,8), %rbx
+	movq	%r15, %rsi
+	jmp	.L384
+	.p2align 4,,10
+	.p2align 3
+.L385:
+	leaq	(%rsi,%r10), %rax
+	shrq	%rax
+	cmpb	(%rbx,%rax,8), %dil
+	jg	.L565
+	movq	%rax, %rsi
+.L384:
+	cmpq	%rsi, %r10
+	jb	.L385
+	cmpq	%r15, %r10
+	jnb	.L386
+	leaq	(%rbx,%r10,8), %rax
+	cmpb	(%rax), %dil
+	jne	.L386
+	movl	4(%rax), %eax
+	leal	-1(%rax), %esi
+	cmpl	$-3, %esi
+	jbe	.L382
+.L386:
+	movl	8(%r13), %eax
+	testl	%eax, %eax
+	jne	.L381
+.L387:
+	movl	96(%r14,%rdi,4), %eax
+	leal	-1(%rax), %esi
+	cmpl	$-3, %esi
+	jbe	.L382
+	movq	%rbp, %rsi
+	xorl	%eax, %eax
+	jmp	.L380
+	.p2align 4,,10
+	.p2align 3
+.L565:
+	leaq	1(%rax), %r10
+	jmp	.L384
+.L382:
+	movl	%eax, %esi
+	leaq	(%rsi,%rsi,4), %rsi
+	leaq	0(%rbp,%rsi,4), %rsi
+	jmp	.L380
+.L562:
+	movq	%rcx, %rdx
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L365
+.L417:
+	xorl	%ebp, %ebp
+	jmp	.L366
+.L560:
+	movq	24(%r14), %rdi
+	leaq	5(%r12), %rax
+	leaq	(%rax,%rax), %rdx
+	leaq	(%rax,%rax,4), %rsi
+	movq	(%rdi), %rax
+	movq	%rdx, 8(%r14)
+	salq	$3, %rsi
+	movl	$4, %edx
+.LEHB24:
+	call	*16(%rax)
+.LEHE24:
+	movq	16(%r14), %rcx
+	movl	8(%rsp), %esi
+	movq	%rax, (%r14)
+	movq	%rax, %rdi
+	leaq	(%rcx,%rcx,4), %rdx
+	salq	$2, %rdx
+	leaq	(%rax,%rdx), %rax
+	movl	%esi, 4(%rax)
+	movl	(%rsp), %esi
+	movl	%r13d, (%rax)
+	movl	$0, 8(%rax)
+	movl	%esi, 12(%rax)
+	movl	$-1, 16(%rax)
+	testq	%rcx, %rcx
+	jne	.L566
+	testq	%rbp, %rbp
+	je	.L567
+.L354:
+	movq	24(%r14), %rdi
+	leaq	(%r12,%r12,4), %rdx
+	movl	$4, %ecx
+	movq	%rbp, %rsi
+	salq	$2, %rdx
+	movq	(%rdi), %rax
+.LEHB25:
+	call	*24(%rax)
+.LEHE25:
+	movq	16(%r15), %rdx
+	movq	16(%r14), %r12
+	jmp	.L355
+.L566:
+	movq	%rbp, %rsi
+	call	memcpy@PLT
+	jmp	.L354
+.L567:
+	movq	16(%r15), %rdx
+	xorl	%r12d, %r12d
+	jmp	.L355
+.L343:
+	movq	24(%r14), %rdi
+	leaq	(%rax,%rax,4), %rsi
+	movq	%rax, %r15
+	movl	$4, %edx
+	salq	$2, %rsi
+	movq	(%rdi), %rax
+.LEHB26:
+	call	*16(%rax)
+	movq	16(%r14), %r12
+	movq	%rax, (%r14)
+	movq	%rax, %rdi
+	movq	%r15, 8(%r14)
+	testq	%r12, %r12
+	jne	.L568
+	testq	%rbp, %rbp
+	jne	.L346
+	movq	%rax, %rbp
+	jmp	.L344
+.L544:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L569
+.L249:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	%rax, 72(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbx
+	testq	%rbx, %rbx
+	jne	.L247
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L570
+.L252:
+	movq	_ZZN1n4heapEvE3res(%rip), %rbx
+	jmp	.L247
+.L568:
+	leaq	(%r12,%r12,4), %rdx
+	movq	%rbp, %rsi
+	salq	$2, %rdx
+	call	memcpy@PLT
+.L346:
+	movq	24(%r14), %rdi
+	leaq	0(%r13,%r13,4), %rdx
+	movl	$4, %ecx
+	movq	%rbp, %rsi
+	salq	$2, %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	(%r14), %rbp
+	jmp	.L534
+.L299:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L571
+.L303:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$0, 84(%rsp)
+	movq	144(%rsp), %rax
+	movq	%rdi, 152(%rsp)
+	cmpq	%rax, 32(%rsp)
+	jb	.L322
+	movq	136(%rsp), %rbp
+	movq	32(%rsp), %rcx
+	cmpq	%rcx, %rbp
+	jnb	.L320
+	movq	128(%rsp), %rbx
+	leaq	84(%rsp), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L409
+.L308:
+	movq	32(%rsp), %r15
+	movq	(%rdi), %rax
+	movl	$4, %edx
+	leaq	0(,%r15,4), %rsi
+	call	*16(%rax)
+	movq	%rax, 128(%rsp)
+	movq	%rax, %rdi
+	movq	144(%rsp), %rax
+	movq	%r15, 136(%rsp)
+	testq	%rax, %rax
+	jne	.L543
+	testq	%rbx, %rbx
+	je	.L301
+	jmp	.L319
+.L545:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, 56(%rsp)
+	testq	%rax, %rax
+	je	.L413
+	movq	$1, 24(%rsp)
+	movl	$4, %esi
+	movq	24(%rsp), %rax
+	movq	$10, 48(%rsp)
+	jmp	.L293
+.L413:
+	movq	$10, 48(%rsp)
+	movq	$1, 32(%rsp)
+.L292:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L572
+.L296:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	%rax, 56(%rsp)
+	jmp	.L294
+.L570:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L252
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L252
+.L569:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L249
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L249
+.L571:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L303
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L303
+.L572:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L296
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L296
+.L543:
+	leaq	0(,%rax,4), %rdx
+	movq	%rbx, %rsi
+	call	memcpy@PLT
+	jmp	.L319
+.L558:
+	leaq	92(%rsp), %rdx
+	movl	$0, 92(%rsp)
+	cmpq	%rax, %rdx
+	jnb	.L310
+	cmpq	%rbx, %rdx
+	jnb	.L573
+.L310:
+	movq	32(%rsp), %r15
+	movq	(%rdi), %rax
+	movl	$4, %edx
+	leaq	0(,%r15,4), %rsi
+	call	*16(%rax)
+	movq	%rax, 128(%rsp)
+	movq	%rax, %rdi
+	movq	144(%rsp), %rax
+	movq	%r15, 136(%rsp)
+	testq	%rax, %rax
+	jne	.L574
+	testq	%rbx, %rbx
+	jne	.L313
+.L314:
+	movq	32(%rsp), %rcx
+	movq	%rcx, %rdx
+	cmpq	%rcx, %rax
+	jb	.L540
+	jmp	.L322
+.L573:
+	xorl	%edx, %edx
+	movq	32(%rsp), %rsi
+	leaq	128(%rsp), %rdi
+	movl	%edx, 96(%rsp)
+	leaq	96(%rsp), %rdx
+	call	_ZN1n6vectorIjE6resizeEmRKj
+	jmp	.L306
+.L574:
+	leaq	0(,%rax,4), %rdx
+	movq	%rbx, %rsi
+	call	memcpy@PLT
+.L313:
+	movq	152(%rsp), %rdi
+	leaq	0(,%rbp,4), %rdx
+	movl	$4, %ecx
+	movq	%rbx, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE26:
+	movq	144(%rsp), %rax
+	jmp	.L314
+.L427:
+.L539:
+	movq	%rax, %rbx
+	jmp	.L368
+.L425:
+	jmp	.L539
+.L422:
+	jmp	.L539
+.L429:
+	movq	%rax, %rbx
+	jmp	.L337
+.L428:
+	movq	%rax, %rbx
+	jmp	.L402
+.L431:
+	movq	%rax, %rbx
+	jmp	.L281
+.L424:
+	movq	%rax, %rbx
+	jmp	.L338
+.L432:
+	movq	%rax, %rbx
+	jmp	.L275
+.L423:
+	movq	%rax, %rbx
+	jmp	.L256
+.L430:
+	movq	%rax, %rbx
+	jmp	.L255
+.L426:
+	jmp	.L539
+.L368:
+	movq	128(%rsp), %rsi
+	movq	136(%rsp), %rax
+	testq	%rsi, %rsi
+	je	.L400
+.L351:
+	movq	152(%rsp), %rdi
+	leaq	0(,%rax,4), %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L403:
+	cmpq	$0, 40(%rsp)
+	je	.L256
+.L400:
+	movq	56(%rsp), %rdi
+	movq	24(%rsp), %rdx
+	movl	$4, %ecx
+	movq	40(%rsp), %rsi
+	movq	(%rdi), %rax
+	salq	$2, %rdx
+	call	*24(%rax)
+.L256:
+	movq	16(%rsp), %rbp
+	xorl	%r12d, %r12d
+.L405:
+	cmpq	%r12, 32(%rsp)
+	je	.L575
+	movq	0(%rbp), %rsi
+	movq	8(%rbp), %rdx
+	testq	%rsi, %rsi
+	je	.L406
+	movq	24(%rbp), %rdi
+	salq	$3, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L406:
+	addq	$1, %r12
+	addq	$40, %rbp
+	jmp	.L405
+.L337:
+	movq	(%rsp), %rax
+	movq	%r15, 40(%rsp)
+	movq	%rax, 24(%rsp)
+.L338:
+	movq	128(%rsp), %rsi
+	movq	136(%rsp), %rax
+	testq	%rsi, %rsi
+	jne	.L351
+	jmp	.L403
+.L402:
+	movq	(%rsp), %rax
+	movq	%rax, 24(%rsp)
+	jmp	.L338
+.L281:
+	movq	%r15, 48(%rsp)
+	movq	%r13, 16(%rsp)
+	jmp	.L256
+.L255:
+	movq	$10, 48(%rsp)
+	xorl	%ecx, %ecx
+	xorl	%esi, %esi
+	movq	%rcx, 32(%rsp)
+	movq	%rsi, 16(%rsp)
+	jmp	.L256
+.L275:
+	movq	%r15, 48(%rsp)
+	jmp	.L256
+.L575:
+	cmpq	$0, 16(%rsp)
+	je	.L408
+	movq	72(%rsp), %rdi
+	imulq	$40, 48(%rsp), %rdx
+	movl	$8, %ecx
+	movq	16(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L408:
+	movq	%rbx, %rdi
+.LEHB27:
+	call	_Unwind_Resume@PLT
+.LEHE27:
+	.cfi_endproc
+.LFE6924:
+	.section	.gcc_except_table
+.LLSDA6924:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6924-.LLSDACSB6924
+.LLSDACSB6924:
+	.uleb128 .LEHB13-.LFB6924
+	.uleb128 .LEHE13-.LEHB13
+	.uleb128 .L430-.LFB6924
+	.uleb128 0
+	.uleb128 .LEHB14-.LFB6924
+	.uleb128 .LEHE14-.LEHB14
+	.uleb128 .L423-.LFB6924
+	.uleb128 0
+	.uleb128 .LEHB15-.LFB6924
+	.uleb128 .LEHE15-.LEHB15
+	.uleb128 .L428-.LFB6924
+	.uleb128 0
+	.uleb128 .LEHB16-.LFB6924
+	.uleb128 .LEHE16-.LEHB16
+	.uleb128 .L429-.LFB6924
+	.uleb128 0
+	.uleb128 .LEHB17-.LFB6924
+	.uleb128 .LEHE17-.LEHB17
+	.uleb128 .L423-.LFB6924
+	.uleb128 0
+	.uleb128 .LEHB18-.LFB6924
+	.uleb128 .LEHE18-.LEHB18
+	.uleb128 .L432-.LFB6924
+	.uleb128 0
+	.uleb128 .LEHB19-.LFB6924
+	.uleb128 .LEHE19-.LEHB19
+	.uleb128 .L431-.LFB6924
+	.uleb128 0
+	.uleb128 .LEHB20-.LFB6924
+	.uleb128 .LEHE20-.LEHB20
+	.uleb128 .L423-.LFB6924
+	.uleb128 0
+	.uleb128 .LEHB21-.LFB6924
+	.uleb128 .LEHE21-.LEHB21
+	.uleb128 .L424-.LFB6924
+	.uleb128 0
+	.uleb128 .LEHB22-.LFB6924
+	.uleb128 .LEHE22-.LEHB22
+	.uleb128 .L427-.LFB6924
+	.uleb128 0
+	.uleb128 .LEHB23-.LFB6924
+	.uleb128 .LEHE23-.LEHB23
+	.uleb128 .L422-.LFB6924
+	.uleb128 0
+	.uleb128 .LEHB24-.LFB6924
+	.uleb128 .LEHE24-.LEHB24
+	.uleb128 .L425-.LFB6924
+	.uleb128 0
+	.uleb128 .LEHB25-.LFB6924
+	.uleb128 .LEHE25-.LEHB25
+	.uleb128 .L426-.LFB6924
+	.uleb128 0
+	.uleb128 .LEHB26-.LFB6924
+	.uleb128 .LEHE26-.LEHB26
+	.uleb128 .L424-.LFB6924
+	.uleb128 0
+	.uleb128 .LEHB27-.LFB6924
+	.uleb128 .LEHE27-.LEHB27
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6924:
+	.section	.text._ZN1n12aho_corasickIcE7__buildERKNS_6vectorINS_6stringIcEEEE,"axG",@progbits,_ZN1n12aho_corasickIcE7__buildERKNS_6vectorINS_6stringIcEEEE,comdat
+	.size	_ZN1n12aho_corasickIcE7__buildERKNS_6vectorINS_6stringIcEEEE, .-_ZN1n12aho_corasickIcE7__buildERKNS_6vectorINS_6stringIcEEEE
+	.section	.rodata.str1.1
+.LC20:
+	.string	"he"
+.LC21:
+	.string	"she"
+.LC22:
+	.string	"his"
+.LC23:
+	.string	"hers"
+.LC24:
+	.string	"ushers"
+	.section	.rodata.str1.8
+	.align 8
+.LC25:
+	.string	"expected equal : expected value : found.len(), actual value : 3"
+	.align 8
+.LC26:
+	.string	"expected equal : expected value : found.data()[0].keyword, actual value : 1"
+	.align 8
+.LC27:
+	.string	"expected equal : expected value : found.data()[0].index, actual value : 1"
+	.align 8
+.LC28:
+	.string	"expected equal : expected value : found.data()[1].keyword, actual value : 0"
+	.align 8
+.LC29:
+	.string	"expected equal : expected value : found.data()[1].index, actual value : 2"
+	.align 8
+.LC30:
+	.string	"expected equal : expected value : found.data()[2].keyword, actual value : 3"
+	.align 8
+.LC31:
+	.string	"expected equal : expected value : found.data()[2].index, actual value : 2"
+	.section	.text.unlikely
+.LCOLDB32:
+	.text
+.LHOTB32:
+	.p2align 4
+	.globl	_Z26test_aho_corasick_overlapsv
+	.type	_Z26test_aho_corasick_overlapsv, @function
+_Z26test_aho_corasick_overlapsv:
+.LFB6762:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6762
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leaq	.LC21(%rip), %rax
+	leaq	.LC20(%rip), %rcx
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rcx, %xmm0
+	movq	%rax, %xmm3
+	leaq	.LC22(%rip), %rcx
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	punpcklqdq	%xmm3, %xmm0
+	leaq	.LC23(%rip), %rax
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rax, %xmm4
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$1256, %rsp
+	.cfi_def_cfa_offset 1312
+	movaps	%xmm0, 64(%rsp)
+	movq	%rcx, %xmm0
+	movq	$0, 96(%rsp)
+	punpcklqdq	%xmm4, %xmm0
+	movaps	%xmm0, 80(%rsp)
+	pxor	%xmm0, %xmm0
+	movups	%xmm0, 104(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, %r14
+	testq	%rax, %rax
+	je	.L782
+.L577:
+	movq	%rax, 120(%rsp)
+	leaq	64(%rsp), %rax
+	movq	%rax, (%rsp)
+	leaq	96(%rsp), %rax
+	movq	%rax, 32(%rsp)
+	leaq	152(%rsp), %rax
+	movq	%rax, 24(%rsp)
+	movq	(%rsp), %rax
+	jmp	.L613
+.L598:
+	leaq	0(%rbp,%rbp,2), %rax
+	movdqa	.LC16(%rip), %xmm2
+	salq	$4, %rax
+	addq	%rax, %rbx
+	movups	%xmm2, (%rbx)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L783
+.L608:
+	movq	144(%rsp), %rax
+	pxor	%xmm3, %xmm3
+	movdqa	128(%rsp), %xmm4
+	movq	$0, 40(%rbx)
+	movups	%xmm3, 24(%rbx)
+	movq	%rax, 16(%rbx)
+	movq	136(%rsp), %rax
+	movups	%xmm4, (%rbx)
+	cmpq	$23, %rax
+	je	.L784
+	movq	152(%rsp), %rax
+	leaq	1(%rbp), %r12
+	movq	%rax, 24(%rbx)
+.L611:
+	addq	$8, (%rsp)
+	movq	32(%rsp), %rcx
+	movq	(%rsp), %rax
+	movq	%r12, 112(%rsp)
+	cmpq	%rcx, %rax
+	je	.L612
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r14
+.L613:
+	movq	(%rax), %rbp
+	testq	%rbp, %rbp
+	je	.L785
+	cmpb	$0, 0(%rbp)
+	je	.L683
+	leaq	1(%rbp), %rdi
+	call	strlen@PLT
+	addq	$1, %rax
+.L584:
+	movdqa	.LC16(%rip), %xmm1
+	movaps	%xmm1, 128(%rsp)
+	testq	%r14, %r14
+	je	.L684
+	movq	24(%rsp), %rcx
+	pxor	%xmm5, %xmm5
+	movq	%rax, %r12
+	xorl	%r13d, %r13d
+	movq	%r14, 144(%rsp)
+	movq	$0, 168(%rsp)
+	movq	%rcx, %rbx
+	movups	%xmm5, 152(%rsp)
+	cmpq	%rcx, %rbp
+	jnb	.L786
+.L583:
+	cmpq	$23, %rax
+	jbe	.L596
+	movq	%rbx, 8(%rsp)
+	movl	$23, %r15d
+.L680:
+	leaq	10(%r15,%r15), %rdx
+	movq	%r14, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 16(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r14), %rax
+.LEHB28:
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r15
+	je	.L592
+	movq	(%r14), %rax
+	leaq	1(%r15), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.LEHE28:
+.L592:
+	movq	16(%rsp), %rax
+	cmpq	$23, 16(%rsp)
+	movq	%rbx, 152(%rsp)
+	movq	%rax, 136(%rsp)
+	je	.L787
+.L596:
+	leaq	(%rbx,%r13), %rdi
+	movq	%r12, %rdx
+	movq	%rbp, %rsi
+	call	memmove@PLT
+	movq	112(%rsp), %rbp
+	movq	104(%rsp), %r13
+	addq	128(%rsp), %r12
+	movq	%r12, 128(%rsp)
+	movb	$0, (%rbx,%r12)
+	movq	96(%rsp), %rbx
+	movq	%rbp, %r12
+	cmpq	%r13, %rbp
+	jne	.L598
+	leaq	5(%rbp), %rdx
+	movq	120(%rsp), %rdi
+	leaq	(%rdx,%rdx), %rax
+	leaq	(%rax,%rdx), %rsi
+	movq	%rax, 104(%rsp)
+	movq	(%rdi), %rax
+	movl	$8, %edx
+	salq	$5, %rsi
+.LEHB29:
+	call	*16(%rax)
+	leaq	0(%rbp,%rbp,2), %rbp
+	movdqa	.LC16(%rip), %xmm6
+	movq	%rax, 96(%rsp)
+	movq	%rax, %rdi
+	salq	$4, %rbp
+	addq	%rax, %rbp
+	movups	%xmm6, 0(%rbp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L788
+.L599:
+	movq	144(%rsp), %rax
+	pxor	%xmm7, %xmm7
+	movdqa	128(%rsp), %xmm6
+	movq	$0, 40(%rbp)
+	movups	%xmm7, 24(%rbp)
+	movq	%rax, 16(%rbp)
+	movq	136(%rsp), %rax
+	movups	%xmm6, 0(%rbp)
+	cmpq	$23, %rax
+	je	.L789
+	movq	152(%rsp), %rax
+	movq	$23, 136(%rsp)
+	movq	%rax, 24(%rbp)
+.L603:
+	movq	$0, 128(%rsp)
+	movb	$0, 152(%rsp)
+	testq	%r12, %r12
+	jne	.L790
+	testq	%rbx, %rbx
+	je	.L606
+.L605:
+	movq	120(%rsp), %rdi
+	leaq	0(%r13,%r13,2), %rdx
+	movl	$8, %ecx
+	movq	%rbx, %rsi
+	salq	$4, %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE29:
+.L606:
+	addq	$1, %r12
+	jmp	.L611
+.L785:
+	movdqa	.LC16(%rip), %xmm7
+	movaps	%xmm7, 128(%rsp)
+	testq	%r14, %r14
+	je	.L682
+	pxor	%xmm5, %xmm5
+	movq	24(%rsp), %rbx
+	xorl	%r12d, %r12d
+	xorl	%r13d, %r13d
+	movq	%r14, 144(%rsp)
+	movq	$0, 168(%rsp)
+	movups	%xmm5, 152(%rsp)
+	jmp	.L596
+.L786:
+	movq	%rcx, 8(%rsp)
+	movl	$23, %r15d
+	xorl	%r13d, %r13d
+.L585:
+	cmpq	%rax, %r15
+	jb	.L680
+	movq	%r15, 16(%rsp)
+	xorl	%ebx, %ebx
+	cmpq	$23, 16(%rsp)
+	jne	.L596
+.L787:
+	movq	24(%rsp), %rbx
+	jmp	.L596
+.L784:
+	movdqu	152(%rsp), %xmm1
+	movq	168(%rsp), %rax
+	movq	%rbp, %r12
+	movq	%rax, 40(%rbx)
+	movups	%xmm1, 24(%rbx)
+	jmp	.L606
+.L612:
+	movq	$0, 128(%rsp)
+	pxor	%xmm0, %xmm0
+	movups	%xmm0, 136(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L617
+	movq	%rax, 152(%rsp)
+	movq	$0, 160(%rsp)
+	movups	%xmm0, 168(%rsp)
+.L618:
+	movq	%rax, 184(%rsp)
+	pxor	%xmm0, %xmm0
+	movq	$0, 192(%rsp)
+	movups	%xmm0, 200(%rsp)
+.L623:
+	movq	%rax, 216(%rsp)
+	leaq	224(%rsp), %rdi
+	xorl	%eax, %eax
+	movl	$128, %ecx
+	rep stosq
+	movq	32(%rsp), %rsi
+	leaq	128(%rsp), %rax
+	movq	%rax, %rdi
+	movq	%rax, 56(%rsp)
+.LEHB30:
+	call	_ZN1n12aho_corasickIcE7__buildERKNS_6vectorINS_6stringIcEEEE
+.LEHE30:
+	movq	96(%rsp), %r12
+	movq	112(%rsp), %rbp
+	xorl	%r13d, %r13d
+	movq	%r12, %rbx
+	testq	%rbp, %rbp
+	je	.L640
+	.p2align 4,,10
+	.p2align 3
+.L641:
+	movq	8(%rbx), %rax
+	cmpq	$23, %rax
+	je	.L638
+	movq	16(%rbx), %rdi
+	leaq	1(%rax), %rdx
+	addq	$1, %r13
+	movq	24(%rbx), %rsi
+	movl	$1, %ecx
+	addq	$48, %rbx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	%r13, %rbp
+	jne	.L641
+.L640:
+	testq	%r12, %r12
+	je	.L637
+	movq	104(%rsp), %rax
+	movq	120(%rsp), %rdi
+	movl	$8, %ecx
+	movq	%r12, %rsi
+	leaq	(%rax,%rax,2), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+	call	*24(%rax)
+.L637:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, 40(%rsp)
+	testq	%rax, %rax
+	je	.L791
+.L642:
+	movq	$0, (%rsp)
+	xorl	%ebp, %ebp
+	xorl	%ebx, %ebx
+	movq	128(%rsp), %r15
+	movq	$0, 8(%rsp)
+	movq	$0, 16(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L666:
+	movq	16(%rsp), %rcx
+	leaq	.LC24(%rip), %rax
+	movzbl	(%rax,%rcx), %edi
+	testl	%ebx, %ebx
+	je	.L655
+	movq	160(%rsp), %r9
+	.p2align 4,,10
+	.p2align 3
+.L656:
+	leaq	(%rbx,%rbx,4), %rax
+	xorl	%edx, %edx
+	leaq	(%r15,%rax,4), %rcx
+	movl	(%rcx), %eax
+	movl	4(%rcx), %r8d
+	leaq	(%r9,%rax,8), %r10
+	movq	%r8, %rax
+	jmp	.L651
+	.p2align 4,,10
+	.p2align 3
+.L652:
+	leaq	(%rax,%rdx), %rsi
+	shrq	%rsi
+	cmpb	(%r10,%rsi,8), %dil
+	jg	.L792
+	movq	%rsi, %rax
+.L651:
+	cmpq	%rax, %rdx
+	jb	.L652
+	cmpq	%r8, %rdx
+	jnb	.L653
+	leaq	(%r10,%rdx,8), %rax
+	cmpb	(%rax), %dil
+	jne	.L653
+	movl	4(%rax), %ebx
+	leal	-1(%rbx), %eax
+	cmpl	$-3, %eax
+	jbe	.L647
+.L653:
+	movl	8(%rcx), %ebx
+	testl	%ebx, %ebx
+	jne	.L656
+.L655:
+	movl	224(%rsp,%rdi,4), %ebx
+	leal	-1(%rbx), %eax
+	cmpl	$-3, %eax
+	jbe	.L647
+	addq	$1, 16(%rsp)
+	xorl	%eax, %eax
+	xorl	%ebx, %ebx
+	cmpl	$-1, 12(%r15)
+	movq	%r15, %rdx
+	je	.L649
+.L648:
+	movq	192(%rsp), %rcx
+	movq	%rcx, 24(%rsp)
+	jmp	.L665
+	.p2align 4,,10
+	.p2align 3
+.L658:
+	movq	%rbp, %rax
+	movq	8(%rsp), %rsi
+	addq	$1, %rbp
+	salq	$4, %rax
+	addq	%rsi, %rax
+	movq	%r13, (%rax)
+	movq	%r14, 8(%rax)
+	movl	16(%r12), %eax
+	cmpl	$-1, %eax
+	je	.L657
+.L665:
+	leaq	(%rax,%rax,4), %rax
+	movq	16(%rsp), %r14
+	leaq	(%r15,%rax,4), %r12
+	movq	24(%rsp), %rax
+	movl	12(%r12), %r13d
+	subq	(%rax,%r13,8), %r14
+	cmpq	%rbp, (%rsp)
+	jne	.L658
+	movq	(%rsp), %rax
+	movq	40(%rsp), %rdi
+	movl	$8, %edx
+	leaq	5(%rax), %rsi
+	leaq	(%rsi,%rsi), %rax
+	salq	$5, %rsi
+	movq	%rax, 48(%rsp)
+	movq	(%rdi), %rax
+.LEHB31:
+	call	*16(%rax)
+.LEHE31:
+	movq	%rbp, %rdx
+	movq	%rax, 32(%rsp)
+	salq	$4, %rdx
+	addq	%rdx, %rax
+	movq	%r13, (%rax)
+	movq	%r14, 8(%rax)
+	testq	%rbp, %rbp
+	jne	.L793
+	cmpq	$0, 8(%rsp)
+	je	.L661
+.L660:
+	movq	40(%rsp), %rdi
+	movq	(%rsp), %rdx
+	movl	$8, %ecx
+	movq	8(%rsp), %rsi
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+.LEHB32:
+	call	*24(%rax)
+.LEHE32:
+.L661:
+	movq	48(%rsp), %rax
+	addq	$1, %rbp
+	movq	%rax, (%rsp)
+	movq	32(%rsp), %rax
+	movq	%rax, 8(%rsp)
+	movl	16(%r12), %eax
+	cmpl	$-1, %eax
+	jne	.L665
+	.p2align 4,,10
+	.p2align 3
+.L657:
+	cmpq	$6, 16(%rsp)
+	jne	.L666
+.L794:
+	cmpq	$3, %rbp
+	jne	.L767
+	movq	8(%rsp), %rax
+	cmpq	$1, (%rax)
+	jne	.L768
+	cmpq	$1, 8(%rax)
+	jne	.L769
+	cmpq	$0, 16(%rax)
+	jne	.L770
+	cmpq	$2, 24(%rax)
+	jne	.L771
+	cmpq	$3, 32(%rax)
+	jne	.L772
+	cmpq	$2, 40(%rax)
+	jne	.L773
+	movq	40(%rsp), %rdi
+	movq	%rax, %rsi
+	movq	(%rsp), %rdx
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+	call	*24(%rax)
+	movq	192(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L674
+	movq	200(%rsp), %rax
+	movq	216(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L674:
+	movq	160(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L675
+	movq	168(%rsp), %rax
+	movq	184(%rsp), %rdi
+	movl	$4, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L675:
+	testq	%r15, %r15
+	je	.L576
+	movq	136(%rsp), %rax
+	movq	152(%rsp), %rdi
+	movl	$4, %ecx
+	movq	%r15, %rsi
+	leaq	(%rax,%rax,4), %rdx
+	movq	(%rdi), %rax
+	salq	$2, %rdx
+	call	*24(%rax)
+.L576:
+	addq	$1256, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L792:
+	.cfi_restore_state
+	leaq	1(%rsi), %rdx
+	jmp	.L651
+.L793:
+	movq	8(%rsp), %rsi
+	movq	32(%rsp), %rdi
+	call	memcpy@PLT
+	jmp	.L660
+.L647:
+	movl	%ebx, %eax
+	addq	$1, 16(%rsp)
+	leaq	(%rax,%rax,4), %rax
+	salq	$2, %rax
+	leaq	(%r15,%rax), %rdx
+	movl	%ebx, %eax
+	cmpl	$-1, 12(%rdx)
+	jne	.L648
+.L649:
+	movl	16(%rdx), %eax
+	cmpl	$-1, %eax
+	jne	.L648
+	cmpq	$6, 16(%rsp)
+	jne	.L666
+	jmp	.L794
+	.p2align 4,,10
+	.p2align 3
+.L638:
+	addq	$1, %r13
+	addq	$48, %rbx
+	cmpq	%r13, %rbp
+	jne	.L641
+	jmp	.L640
+.L783:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	movq	112(%rsp), %rbp
+	testb	%al, %al
+	jne	.L608
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	movq	112(%rsp), %rbp
+	testl	%eax, %eax
+	je	.L608
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movq	112(%rsp), %rbp
+	jmp	.L608
+.L684:
+	movq	%rax, %r12
+.L582:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L795
+.L587:
+	movq	_ZZN1n4heapEvE3res(%rip), %r14
+	movq	128(%rsp), %r13
+	pxor	%xmm2, %xmm2
+	movq	$0, 168(%rsp)
+	movq	136(%rsp), %r15
+	movups	%xmm2, 152(%rsp)
+	movq	%r14, 144(%rsp)
+	leaq	0(%r13,%r12), %rax
+	movq	$0, 8(%rsp)
+	cmpq	$23, %r15
+	je	.L796
+.L589:
+	movq	8(%rsp), %rcx
+	leaq	(%rcx,%r13), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L585
+	subq	%rcx, %rbp
+	cmpq	%rax, %r15
+	jnb	.L688
+	leaq	10(%r15,%r15), %rdx
+	movq	%r14, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 16(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r14), %rax
+.LEHB33:
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r15
+	je	.L594
+	movq	(%r14), %rax
+	leaq	1(%r15), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.LEHE33:
+.L594:
+	movq	16(%rsp), %rax
+	movq	%rbx, 152(%rsp)
+	movq	%rax, 136(%rsp)
+	movq	%rax, %r15
+.L593:
+	cmpq	$23, %r15
+	jne	.L779
+	leaq	152(%rsp), %rbx
+.L779:
+	addq	%rbx, %rbp
+	jmp	.L596
+.L790:
+	leaq	(%r12,%r12,2), %rdx
+	movq	%rbx, %rsi
+	salq	$4, %rdx
+	call	memcpy@PLT
+	jmp	.L605
+.L688:
+	xorl	%ebx, %ebx
+	jmp	.L593
+.L683:
+	xorl	%eax, %eax
+	jmp	.L584
+.L789:
+	movdqu	152(%rsp), %xmm7
+	movq	168(%rsp), %rax
+	movups	%xmm7, 24(%rbp)
+	movq	%rax, 40(%rbp)
+	jmp	.L603
+.L788:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L600
+.L780:
+	movq	112(%rsp), %r12
+	movq	96(%rsp), %rdi
+	jmp	.L599
+.L795:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L587
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L587
+.L682:
+	xorl	%r12d, %r12d
+	jmp	.L582
+.L791:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L797
+.L644:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	%rax, 40(%rsp)
+	jmp	.L642
+.L782:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L798
+.L579:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r14
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	jmp	.L577
+.L617:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L799
+.L620:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdx
+	pxor	%xmm0, %xmm0
+	movq	$0, 160(%rsp)
+	movups	%xmm0, 168(%rsp)
+	movq	%rdx, 152(%rsp)
+	testq	%rax, %rax
+	jne	.L618
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L800
+.L625:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdx
+	pxor	%xmm0, %xmm0
+	movq	$0, 192(%rsp)
+	movups	%xmm0, 200(%rsp)
+	movq	%rdx, 184(%rsp)
+	testq	%rax, %rax
+	jne	.L623
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L801
+.L628:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	jmp	.L623
+.L600:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L780
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L780
+.L797:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L644
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L644
+.L798:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L579
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L579
+.L801:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L628
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L628
+.L800:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L625
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L625
+.L799:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L620
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L620
+.L796:
+	leaq	152(%rsp), %rbx
+	cmpq	%rbx, %rbp
+	jb	.L583
+	movq	%rbx, 8(%rsp)
+	jmp	.L589
+.L694:
+	movq	%rax, %rbx
+	jmp	.L616
+.L695:
+	movq	%rax, %rbx
+	jmp	.L614
+.L699:
+	movq	%rax, %rbx
+	jmp	.L662
+.L696:
+	movq	%rax, %rbx
+	jmp	.L663
+.L693:
+	movq	%rax, %rbx
+	jmp	.L631
+	.section	.gcc_except_table
+.LLSDA6762:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6762-.LLSDACSB6762
+.LLSDACSB6762:
+	.uleb128 .LEHB28-.LFB6762
+	.uleb128 .LEHE28-.LEHB28
+	.uleb128 .L694-.LFB6762
+	.uleb128 0
+	.uleb128 .LEHB29-.LFB6762
+	.uleb128 .LEHE29-.LEHB29
+	.uleb128 .L695-.LFB6762
+	.uleb128 0
+	.uleb128 .LEHB30-.LFB6762
+	.uleb128 .LEHE30-.LEHB30
+	.uleb128 .L693-.LFB6762
+	.uleb128 0
+	.uleb128 .LEHB31-.LFB6762
+	.uleb128 .LEHE31-.LEHB31
+	.uleb128 .L696-.LFB6762
+	.uleb128 0
+	.uleb128 .LEHB32-.LFB6762
+	.uleb128 .LEHE32-.LEHB32
+	.uleb128 .L699-.LFB6762
+	.uleb128 0
+	.uleb128 .LEHB33-.LFB6762
+	.uleb128 .LEHE33-.LEHB33
+	.uleb128 .L694-.LFB6762
+	.uleb128 0
+.LLSDACSE6762:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6762
+	.type	_Z26test_aho_corasick_overlapsv.cold, @function
+_Z26test_aho_corasick_overlapsv.cold:
+.LFSB6762:
+.L773:
+	.cfi_def_cfa_offset 1312
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC31(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB34:
+	call	__cxa_throw@PLT
+.L771:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC29(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE34:
+.L697:
+	movq	%rax, %rbx
+.L679:
+	movq	40(%rsp), %rdi
+	movq	(%rsp), %rdx
+	movl	$8, %ecx
+	movq	8(%rsp), %rsi
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+	call	*24(%rax)
+.L678:
+	movq	56(%rsp), %rdi
+	call	_ZN1n12aho_corasickIcED1Ev
+	movq	%rbx, %rdi
+.LEHB35:
+	call	_Unwind_Resume@PLT
+.LEHE35:
+.L772:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC30(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB36:
+	call	__cxa_throw@PLT
+.LEHE36:
+.L614:
+	movq	136(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L616
+	movq	144(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	152(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L616:
+	movq	32(%rsp), %rdi
+	call	_ZN1n6vectorINS_6stringIcEEE9__releaseEv
+	movq	%rbx, %rdi
+.LEHB37:
+	call	_Unwind_Resume@PLT
+.LEHE37:
+.L662:
+	movq	32(%rsp), %rax
+	movq	%rax, 8(%rsp)
+.L663:
+	cmpq	$0, 8(%rsp)
+	je	.L678
+	movq	48(%rsp), %rax
+	movq	%rax, (%rsp)
+	jmp	.L679
+.L770:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC28(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB38:
+	call	__cxa_throw@PLT
+.L769:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC27(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L768:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC26(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE38:
+.L767:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC25(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB39:
+	call	__cxa_throw@PLT
+.LEHE39:
+.L698:
+	movq	%rax, %rbx
+	movq	(%rsp), %rax
+	movq	%rax, 48(%rsp)
+	jmp	.L663
+.L631:
+	movq	192(%rsp), %rsi
+	movq	200(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L632
+	movq	216(%rsp), %rdi
+	salq	$3, %rdx
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L632:
+	movq	160(%rsp), %rsi
+	movq	168(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L633
+	movq	184(%rsp), %rdi
+	salq	$3, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L633:
+	movq	128(%rsp), %rsi
+	movq	136(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L634
+	movq	152(%rsp), %rdi
+	imulq	$20, %rdx, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L634:
+	movq	32(%rsp), %rdi
+	call	_ZN1n6vectorINS_6stringIcEEE9__releaseEv
+	movq	%rbx, %rdi
+.LEHB40:
+	call	_Unwind_Resume@PLT
+.LEHE40:
+	.cfi_endproc
+.LFE6762:
+	.section	.gcc_except_table
+.LLSDAC6762:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6762-.LLSDACSBC6762
+.LLSDACSBC6762:
+	.uleb128 .LEHB34-.LCOLDB32
+	.uleb128 .LEHE34-.LEHB34
+	.uleb128 .L697-.LCOLDB32
+	.uleb128 0
+	.uleb128 .LEHB35-.LCOLDB32
+	.uleb128 .LEHE35-.LEHB35
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB36-.LCOLDB32
+	.uleb128 .LEHE36-.LEHB36
+	.uleb128 .L697-.LCOLDB32
+	.uleb128 0
+	.uleb128 .LEHB37-.LCOLDB32
+	.uleb128 .LEHE37-.LEHB37
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB38-.LCOLDB32
+	.uleb128 .LEHE38-.LEHB38
+	.uleb128 .L697-.LCOLDB32
+	.uleb128 0
+	.uleb128 .LEHB39-.LCOLDB32
+	.uleb128 .LEHE39-.LEHB39
+	.uleb128 .L698-.LCOLDB32
+	.uleb128 0
+	.uleb128 .LEHB40-.LCOLDB32
+	.uleb128 .LEHE40-.LEHB40
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6762:
+	.section	.text.unlikely
+	.text
+	.size	_Z26test_aho_corasick_overlapsv, .-_Z26test_aho_corasick_overlapsv
+	.section	.text.unlikely
+	.size	_Z26test_aho_corasick_overlapsv.cold, .-_Z26test_aho_corasick_overlapsv.cold
+.LCOLDE32:
+	.text
+.LHOTE32:
+	.section	.rodata.str1.1
+.LC33:
+	.string	"xERRORx"
+.LC34:
+	.string	"ERROR"
+.LC35:
+	.string	"WARN"
+.LC36:
+	.string	"timeout"
+.LC37:
+	.string	"a"
+.LC38:
+	.string	"aa"
+.LC39:
+	.string	"WARN: timeout, ERROR"
+	.section	.rodata.str1.8
+	.align 8
+.LC40:
+	.string	"expected equal : expected value : ac.count(n::slice_of(\"WARN: timeout, ERROR\")), actual value : 3"
+	.section	.rodata.str1.1
+.LC41:
+	.string	"aaa"
+	.section	.rodata.str1.8
+	.align 8
+.LC42:
+	.string	"expected equal : expected value : ac.count(n::slice_of(\"aaa\")), actual value : 5"
+	.align 8
+.LC43:
+	.string	"expected equal : expected value : ac.count(n::cstring_iterator(\"xERRORx\")), actual value : 1"
+	.section	.text.unlikely
+.LCOLDB44:
+	.text
+.LHOTB44:
+	.p2align 4
+	.globl	_Z23test_aho_corasick_countv
+	.type	_Z23test_aho_corasick_countv, @function
+_Z23test_aho_corasick_countv:
+.LFB6777:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6777
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leaq	.LC35(%rip), %rax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rax, %xmm3
+	leaq	.LC37(%rip), %rax
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rax, %xmm4
+	leaq	.LC38(%rip), %rax
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	leaq	.LC34(%rip), %rbx
+	movq	%rbx, %xmm0
+	leaq	.LC36(%rip), %rbx
+	punpcklqdq	%xmm3, %xmm0
+	subq	$1256, %rsp
+	.cfi_def_cfa_offset 1312
+	movaps	%xmm0, 80(%rsp)
+	movq	%rbx, %xmm0
+	punpcklqdq	%xmm4, %xmm0
+	movq	%rax, 112(%rsp)
+	movaps	%xmm0, 96(%rsp)
+	pxor	%xmm0, %xmm0
+	movq	$0, 48(%rsp)
+	movups	%xmm0, 56(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, %r14
+	testq	%rax, %rax
+	je	.L1030
+.L803:
+	movq	%rax, 72(%rsp)
+	leaq	80(%rsp), %rax
+	movq	%rax, 8(%rsp)
+	leaq	120(%rsp), %rax
+	movq	%rax, 40(%rsp)
+	leaq	152(%rsp), %rax
+	movq	%rax, 32(%rsp)
+	movq	8(%rsp), %rax
+	jmp	.L839
+.L824:
+	leaq	0(%rbp,%rbp,2), %rax
+	movdqa	.LC16(%rip), %xmm2
+	salq	$4, %rax
+	addq	%rax, %rbx
+	movups	%xmm2, (%rbx)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L1031
+.L834:
+	movq	144(%rsp), %rax
+	pxor	%xmm3, %xmm3
+	movdqa	128(%rsp), %xmm4
+	movq	$0, 40(%rbx)
+	movups	%xmm3, 24(%rbx)
+	movq	%rax, 16(%rbx)
+	movq	136(%rsp), %rax
+	movups	%xmm4, (%rbx)
+	cmpq	$23, %rax
+	je	.L1032
+	movq	152(%rsp), %rax
+	leaq	1(%rbp), %r12
+	movq	%rax, 24(%rbx)
+.L837:
+	addq	$8, 8(%rsp)
+	movq	40(%rsp), %rbx
+	movq	8(%rsp), %rax
+	movq	%r12, 64(%rsp)
+	cmpq	%rbx, %rax
+	je	.L838
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r14
+.L839:
+	movq	(%rax), %rbp
+	testq	%rbp, %rbp
+	je	.L1033
+	cmpb	$0, 0(%rbp)
+	je	.L916
+	leaq	1(%rbp), %rdi
+	call	strlen@PLT
+	addq	$1, %rax
+.L810:
+	movdqa	.LC16(%rip), %xmm1
+	movaps	%xmm1, 128(%rsp)
+	testq	%r14, %r14
+	je	.L917
+	movq	32(%rsp), %rdi
+	pxor	%xmm5, %xmm5
+	movq	%r14, 144(%rsp)
+	movq	$0, 168(%rsp)
+	movups	%xmm5, 152(%rsp)
+	movq	%rdi, %rbx
+	cmpq	%rdi, %rbp
+	jnb	.L918
+	movq	%rax, %r12
+	xorl	%r13d, %r13d
+.L809:
+	cmpq	$23, %rax
+	jbe	.L822
+	movq	%rbx, 16(%rsp)
+	movl	$23, %r15d
+.L913:
+	leaq	10(%r15,%r15), %rdx
+	movq	%r14, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r14), %rax
+.LEHB41:
+	call	*16(%rax)
+	movq	16(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r15
+	je	.L818
+	movq	(%r14), %rax
+	leaq	1(%r15), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.LEHE41:
+.L818:
+	movq	24(%rsp), %rax
+	cmpq	$23, 24(%rsp)
+	movq	%rbx, 152(%rsp)
+	movq	%rax, 136(%rsp)
+	je	.L1034
+.L822:
+	leaq	(%rbx,%r13), %rdi
+	movq	%r12, %rdx
+	movq	%rbp, %rsi
+	call	memmove@PLT
+	movq	64(%rsp), %rbp
+	movq	56(%rsp), %r13
+	addq	128(%rsp), %r12
+	movq	%r12, 128(%rsp)
+	movb	$0, (%rbx,%r12)
+	movq	48(%rsp), %rbx
+	movq	%rbp, %r12
+	cmpq	%r13, %rbp
+	jne	.L824
+	leaq	5(%rbp), %rdx
+	movq	72(%rsp), %rdi
+	leaq	(%rdx,%rdx), %rax
+	leaq	(%rax,%rdx), %rsi
+	movq	%rax, 56(%rsp)
+	movq	(%rdi), %rax
+	movl	$8, %edx
+	salq	$5, %rsi
+.LEHB42:
+	call	*16(%rax)
+	leaq	0(%rbp,%rbp,2), %rbp
+	movdqa	.LC16(%rip), %xmm6
+	movq	%rax, 48(%rsp)
+	movq	%rax, %rdi
+	salq	$4, %rbp
+	addq	%rax, %rbp
+	movups	%xmm6, 0(%rbp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L1035
+.L825:
+	movq	144(%rsp), %rax
+	pxor	%xmm7, %xmm7
+	movdqa	128(%rsp), %xmm6
+	movq	$0, 40(%rbp)
+	movups	%xmm7, 24(%rbp)
+	movq	%rax, 16(%rbp)
+	movq	136(%rsp), %rax
+	movups	%xmm6, 0(%rbp)
+	cmpq	$23, %rax
+	je	.L1036
+	movq	152(%rsp), %rax
+	movq	$23, 136(%rsp)
+	movq	%rax, 24(%rbp)
+.L829:
+	movq	$0, 128(%rsp)
+	movb	$0, 152(%rsp)
+	testq	%r12, %r12
+	jne	.L1037
+	testq	%rbx, %rbx
+	je	.L832
+.L831:
+	movq	72(%rsp), %rdi
+	leaq	0(%r13,%r13,2), %rdx
+	movl	$8, %ecx
+	movq	%rbx, %rsi
+	salq	$4, %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE42:
+.L832:
+	addq	$1, %r12
+	jmp	.L837
+.L1033:
+	movdqa	.LC16(%rip), %xmm7
+	movaps	%xmm7, 128(%rsp)
+	testq	%r14, %r14
+	je	.L915
+	pxor	%xmm5, %xmm5
+	movq	32(%rsp), %rbx
+	xorl	%r12d, %r12d
+	xorl	%r13d, %r13d
+	movq	%r14, 144(%rsp)
+	movq	$0, 168(%rsp)
+	movups	%xmm5, 152(%rsp)
+	jmp	.L822
+.L918:
+	movq	%rdi, 16(%rsp)
+	movq	%rax, %r12
+	movl	$23, %r15d
+	xorl	%r13d, %r13d
+.L811:
+	cmpq	%rax, %r15
+	jb	.L913
+	movq	%r15, 24(%rsp)
+	xorl	%ebx, %ebx
+	cmpq	$23, 24(%rsp)
+	jne	.L822
+.L1034:
+	movq	32(%rsp), %rbx
+	jmp	.L822
+.L1032:
+	movdqu	152(%rsp), %xmm1
+	movq	168(%rsp), %rax
+	movq	%rbp, %r12
+	movq	%rax, 40(%rbx)
+	movups	%xmm1, 24(%rbx)
+	jmp	.L832
+.L838:
+	movq	$0, 128(%rsp)
+	pxor	%xmm0, %xmm0
+	movups	%xmm0, 136(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L843
+	movq	%rax, 152(%rsp)
+	movq	$0, 160(%rsp)
+	movups	%xmm0, 168(%rsp)
+.L844:
+	movq	%rax, 184(%rsp)
+	pxor	%xmm0, %xmm0
+	movq	$0, 192(%rsp)
+	movups	%xmm0, 200(%rsp)
+.L849:
+	movq	%rax, 216(%rsp)
+	leaq	224(%rsp), %rdi
+	movl	$128, %ecx
+	xorl	%eax, %eax
+	rep stosq
+	leaq	48(%rsp), %rbp
+	leaq	128(%rsp), %rbx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+.LEHB43:
+	call	_ZN1n12aho_corasickIcE7__buildERKNS_6vectorINS_6stringIcEEEE
+.LEHE43:
+	movq	48(%rsp), %r13
+	movq	64(%rsp), %r12
+	xorl	%r14d, %r14d
+	movq	%r13, %rbp
+	testq	%r12, %r12
+	je	.L866
+	.p2align 4,,10
+	.p2align 3
+.L867:
+	movq	8(%rbp), %rax
+	cmpq	$23, %rax
+	je	.L864
+	movq	16(%rbp), %rdi
+	leaq	1(%rax), %rdx
+	addq	$1, %r14
+	movq	24(%rbp), %rsi
+	movl	$1, %ecx
+	addq	$48, %rbp
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	%r14, %r12
+	jne	.L867
+.L866:
+	testq	%r13, %r13
+	je	.L863
+	movq	56(%rsp), %rax
+	movq	72(%rsp), %rdi
+	movl	$8, %ecx
+	movq	%r13, %rsi
+	leaq	(%rax,%rax,2), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+	call	*24(%rax)
+.L863:
+	leaq	.LC39(%rip), %rdi
+	movq	128(%rsp), %rbp
+	xorl	%esi, %esi
+	xorl	%eax, %eax
+	movq	160(%rsp), %r12
+	leaq	20(%rdi), %r8
+	.p2align 4,,10
+	.p2align 3
+.L880:
+	movzbl	(%rdi), %r11d
+	testl	%eax, %eax
+	jne	.L868
+	.p2align 4,,10
+	.p2align 3
+.L877:
+	movzbl	%r11b, %eax
+	movl	224(%rsp,%rax,4), %edx
+	leal	-1(%rdx), %eax
+	cmpl	$-3, %eax
+	jbe	.L869
+	xorl	%eax, %eax
+	xorl	%ecx, %ecx
+	cmpl	$-1, 12(%rbp)
+	movq	%rbp, %r9
+	je	.L871
+	.p2align 4,,10
+	.p2align 3
+.L879:
+	leaq	(%rcx,%rcx,4), %rdx
+	addq	$1, %rsi
+	movl	16(%rbp,%rdx,4), %edx
+	cmpl	$-1, %edx
+	je	.L878
+.L1025:
+	movl	%edx, %ecx
+	jmp	.L879
+	.p2align 4,,10
+	.p2align 3
+.L1039:
+	cmpq	%r9, %rdx
+	jnb	.L875
+	leaq	0(%r13,%rdx,8), %rax
+	cmpb	(%rax), %r11b
+	jne	.L875
+	movl	4(%rax), %eax
+	leal	-1(%rax), %edx
+	cmpl	$-3, %edx
+	jbe	.L876
+.L875:
+	movl	8(%r10), %eax
+	testl	%eax, %eax
+	je	.L877
+.L868:
+	leaq	(%rax,%rax,4), %rax
+	xorl	%edx, %edx
+	leaq	0(%rbp,%rax,4), %r10
+	movl	(%r10), %eax
+	movl	4(%r10), %r9d
+	leaq	(%r12,%rax,8), %r13
+	movq	%r9, %rax
+	jmp	.L873
+	.p2align 4,,10
+	.p2align 3
+.L874:
+	leaq	(%rax,%rdx), %rcx
+	shrq	%rcx
+	cmpb	0(%r13,%rcx,8), %r11b
+	jg	.L1038
+	movq	%rcx, %rax
+.L873:
+	cmpq	%rax, %rdx
+	jb	.L874
+	jmp	.L1039
+.L869:
+	movl	%edx, %ecx
+	leaq	(%rcx,%rcx,4), %rax
+	leaq	0(%rbp,%rax,4), %r9
+	movl	%edx, %eax
+	cmpl	$-1, 12(%r9)
+	jne	.L879
+.L871:
+	movl	16(%r9), %edx
+	cmpl	$-1, %edx
+	jne	.L1025
+	.p2align 4,,10
+	.p2align 3
+.L878:
+	addq	$1, %rdi
+	cmpq	%r8, %rdi
+	jne	.L880
+	cmpq	$3, %rsi
+	jne	.L1017
+	leaq	.LC41(%rip), %rdi
+	xorl	%esi, %esi
+	xorl	%edx, %edx
+	leaq	3(%rdi), %r8
+	.p2align 4,,10
+	.p2align 3
+.L894:
+	movzbl	(%rdi), %r11d
+	testl	%edx, %edx
+	jne	.L882
+	.p2align 4,,10
+	.p2align 3
+.L891:
+	movzbl	%r11b, %eax
+	movl	224(%rsp,%rax,4), %edx
+	leal	-1(%rdx), %eax
+	cmpl	$-3, %eax
+	jbe	.L890
+	xorl	%eax, %eax
+	xorl	%edx, %edx
+	cmpl	$-1, 12(%rbp)
+	movq	%rbp, %rcx
+	je	.L885
+	.p2align 4,,10
+	.p2align 3
+.L893:
+	leaq	(%rax,%rax,4), %rax
+	addq	$1, %rsi
+	movl	16(%rbp,%rax,4), %eax
+	cmpl	$-1, %eax
+	jne	.L893
+	addq	$1, %rdi
+	cmpq	%r8, %rdi
+	jne	.L894
+.L1045:
+	cmpq	$5, %rsi
+	jne	.L1018
+	xorl	%edi, %edi
+	xorl	%edx, %edx
+	movl	$120, %r10d
+	leaq	.LC33(%rip), %r8
+	.p2align 4,,10
+	.p2align 3
+.L895:
+	addq	$1, %r8
+	testl	%edx, %edx
+	jne	.L896
+	.p2align 4,,10
+	.p2align 3
+.L905:
+	movl	224(%rsp,%r10,4), %edx
+	leal	-1(%rdx), %eax
+	cmpl	$-3, %eax
+	jbe	.L904
+	xorl	%eax, %eax
+	xorl	%edx, %edx
+	cmpl	$-1, 12(%rbp)
+	movq	%rbp, %rcx
+	je	.L899
+	.p2align 4,,10
+	.p2align 3
+.L907:
+	leaq	(%rax,%rax,4), %rax
+	addq	$1, %rdi
+	movl	16(%rbp,%rax,4), %eax
+	cmpl	$-1, %eax
+	jne	.L907
+	movzbl	(%r8), %r10d
+	testb	%r10b, %r10b
+	jne	.L895
+.L1044:
+	cmpq	$1, %rdi
+	jne	.L1019
+	movq	192(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L909
+	movq	200(%rsp), %rax
+	movq	216(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L909:
+	testq	%r12, %r12
+	je	.L910
+	movq	168(%rsp), %rax
+	movq	184(%rsp), %rdi
+	movl	$4, %ecx
+	movq	%r12, %rsi
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L910:
+	testq	%rbp, %rbp
+	je	.L802
+	movq	136(%rsp), %rax
+	movq	152(%rsp), %rdi
+	movl	$4, %ecx
+	movq	%rbp, %rsi
+	leaq	(%rax,%rax,4), %rdx
+	movq	(%rdi), %rax
+	salq	$2, %rdx
+	call	*24(%rax)
+.L802:
+	addq	$1256, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1041:
+	.cfi_restore_state
+	cmpq	%r9, %rdx
+	jnb	.L889
+	leaq	0(%r13,%rdx,8), %rax
+	cmpb	(%rax), %r11b
+	jne	.L889
+	movl	4(%rax), %edx
+	leal	-1(%rdx), %eax
+	cmpl	$-3, %eax
+	jbe	.L890
+.L889:
+	movl	8(%r10), %edx
+	testl	%edx, %edx
+	je	.L891
+.L882:
+	leaq	(%rdx,%rdx,4), %rax
+	xorl	%edx, %edx
+	leaq	0(%rbp,%rax,4), %r10
+	movl	(%r10), %eax
+	movl	4(%r10), %r9d
+	leaq	(%r12,%rax,8), %r13
+	movq	%r9, %rax
+	jmp	.L887
+	.p2align 4,,10
+	.p2align 3
+.L888:
+	leaq	(%rax,%rdx), %rcx
+	shrq	%rcx
+	cmpb	0(%r13,%rcx,8), %r11b
+	jg	.L1040
+	movq	%rcx, %rax
+.L887:
+	cmpq	%rax, %rdx
+	jb	.L888
+	jmp	.L1041
+	.p2align 4,,10
+	.p2align 3
+.L1043:
+	cmpq	%rsi, %rdx
+	jnb	.L903
+	leaq	(%r11,%rdx,8), %rax
+	cmpb	(%rax), %r10b
+	jne	.L903
+	movl	4(%rax), %edx
+	leal	-1(%rdx), %eax
+	cmpl	$-3, %eax
+	jbe	.L904
+.L903:
+	movl	8(%r9), %edx
+	testl	%edx, %edx
+	je	.L905
+.L896:
+	leaq	(%rdx,%rdx,4), %rax
+	xorl	%edx, %edx
+	leaq	0(%rbp,%rax,4), %r9
+	movl	(%r9), %eax
+	movl	4(%r9), %esi
+	leaq	(%r12,%rax,8), %r11
+	movq	%rsi, %rax
+	jmp	.L901
+	.p2align 4,,10
+	.p2align 3
+.L902:
+	leaq	(%rax,%rdx), %rcx
+	shrq	%rcx
+	cmpb	(%r11,%rcx,8), %r10b
+	jg	.L1042
+	movq	%rcx, %rax
+.L901:
+	cmpq	%rax, %rdx
+	jb	.L902
+	jmp	.L1043
+	.p2align 4,,10
+	.p2align 3
+.L1042:
+	leaq	1(%rcx), %rdx
+	jmp	.L901
+	.p2align 4,,10
+	.p2align 3
+.L1038:
+	leaq	1(%rcx), %rdx
+	jmp	.L873
+	.p2align 4,,10
+	.p2align 3
+.L1040:
+	leaq	1(%rcx), %rdx
+	jmp	.L887
+.L904:
+	movl	%edx, %ecx
+	movl	%edx, %eax
+	imulq	$20, %rcx, %rcx
+	addq	%rbp, %rcx
+	cmpl	$-1, 12(%rcx)
+	jne	.L907
+.L899:
+	movl	16(%rcx), %eax
+	cmpl	$-1, %eax
+	jne	.L907
+	movzbl	(%r8), %r10d
+	testb	%r10b, %r10b
+	jne	.L895
+	jmp	.L1044
+.L890:
+	movl	%edx, %ecx
+	movl	%edx, %eax
+	imulq	$20, %rcx, %rcx
+	addq	%rbp, %rcx
+	cmpl	$-1, 12(%rcx)
+	jne	.L893
+.L885:
+	movl	16(%rcx), %eax
+	cmpl	$-1, %eax
+	jne	.L893
+	addq	$1, %rdi
+	cmpq	%r8, %rdi
+	jne	.L894
+	jmp	.L1045
+	.p2align 4,,10
+	.p2align 3
+.L864:
+	addq	$1, %r14
+	addq	$48, %rbp
+	cmpq	%r14, %r12
+	jne	.L867
+	jmp	.L866
+.L1031:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	movq	64(%rsp), %rbp
+	testb	%al, %al
+	jne	.L834
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	movq	64(%rsp), %rbp
+	testl	%eax, %eax
+	je	.L834
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movq	64(%rsp), %rbp
+	jmp	.L834
+.L917:
+	movq	%rax, %r12
+.L808:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1046
+.L813:
+	movq	_ZZN1n4heapEvE3res(%rip), %r14
+	movq	128(%rsp), %r13
+	pxor	%xmm2, %xmm2
+	movq	$0, 168(%rsp)
+	movq	136(%rsp), %r15
+	movups	%xmm2, 152(%rsp)
+	movq	%r14, 144(%rsp)
+	leaq	(%r12,%r13), %rax
+	movq	$0, 16(%rsp)
+	cmpq	$23, %r15
+	je	.L1047
+.L815:
+	movq	16(%rsp), %rbx
+	leaq	(%rbx,%r13), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L811
+	subq	%rbx, %rbp
+	cmpq	%rax, %r15
+	jnb	.L921
+	leaq	10(%r15,%r15), %rdx
+	movq	%r14, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r14), %rax
+.LEHB44:
+	call	*16(%rax)
+	movq	16(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r15
+	je	.L820
+	movq	(%r14), %rax
+	leaq	1(%r15), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.LEHE44:
+.L820:
+	movq	24(%rsp), %rax
+	movq	%rbx, 152(%rsp)
+	movq	%rax, 136(%rsp)
+	movq	%rax, %r15
+.L819:
+	cmpq	$23, %r15
+	jne	.L1023
+	leaq	152(%rsp), %rbx
+.L1023:
+	addq	%rbx, %rbp
+	jmp	.L822
+.L1037:
+	leaq	(%r12,%r12,2), %rdx
+	movq	%rbx, %rsi
+	salq	$4, %rdx
+	call	memcpy@PLT
+	jmp	.L831
+.L921:
+	xorl	%ebx, %ebx
+	jmp	.L819
+.L916:
+	xorl	%eax, %eax
+	jmp	.L810
+.L1036:
+	movdqu	152(%rsp), %xmm7
+	movq	168(%rsp), %rax
+	movups	%xmm7, 24(%rbp)
+	movq	%rax, 40(%rbp)
+	jmp	.L829
+.L1035:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L826
+.L1024:
+	movq	64(%rsp), %r12
+	movq	48(%rsp), %rdi
+	jmp	.L825
+.L1046:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L813
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L813
+.L915:
+	xorl	%r12d, %r12d
+	jmp	.L808
+.L1030:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1048
+.L805:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r14
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	jmp	.L803
+.L843:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1049
+.L846:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdx
+	pxor	%xmm0, %xmm0
+	movq	$0, 160(%rsp)
+	movups	%xmm0, 168(%rsp)
+	movq	%rdx, 152(%rsp)
+	testq	%rax, %rax
+	jne	.L844
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1050
+.L851:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdx
+	pxor	%xmm0, %xmm0
+	movq	$0, 192(%rsp)
+	movups	%xmm0, 200(%rsp)
+	movq	%rdx, 184(%rsp)
+	testq	%rax, %rax
+	jne	.L849
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1051
+.L854:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	jmp	.L849
+.L826:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1024
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1024
+.L1048:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L805
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L805
+.L1051:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L854
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L854
+.L1050:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L851
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L851
+.L1049:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L846
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L846
+.L876:
+	movl	%eax, %ecx
+	imulq	$20, %rcx, %r9
+	addq	%rbp, %r9
+	cmpl	$-1, 12(%r9)
+	jne	.L879
+	jmp	.L871
+.L1047:
+	leaq	152(%rsp), %rbx
+	cmpq	%rbx, %rbp
+	jb	.L809
+	movq	%rbx, 16(%rsp)
+	jmp	.L815
+.L938:
+	movq	%rax, %rbx
+	jmp	.L842
+.L937:
+	movq	%rax, %rbx
+	jmp	.L857
+.L939:
+	movq	%rax, %rbx
+	jmp	.L840
+	.section	.gcc_except_table
+.LLSDA6777:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6777-.LLSDACSB6777
+.LLSDACSB6777:
+	.uleb128 .LEHB41-.LFB6777
+	.uleb128 .LEHE41-.LEHB41
+	.uleb128 .L938-.LFB6777
+	.uleb128 0
+	.uleb128 .LEHB42-.LFB6777
+	.uleb128 .LEHE42-.LEHB42
+	.uleb128 .L939-.LFB6777
+	.uleb128 0
+	.uleb128 .LEHB43-.LFB6777
+	.uleb128 .LEHE43-.LEHB43
+	.uleb128 .L937-.LFB6777
+	.uleb128 0
+	.uleb128 .LEHB44-.LFB6777
+	.uleb128 .LEHE44-.LEHB44
+	.uleb128 .L938-.LFB6777
+	.uleb128 0
+.LLSDACSE6777:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6777
+	.type	_Z23test_aho_corasick_countv.cold, @function
+_Z23test_aho_corasick_countv.cold:
+.LFSB6777:
+.L840:
+	.cfi_def_cfa_offset 1312
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	136(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L842
+	movq	144(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	152(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L842:
+	leaq	48(%rsp), %rdi
+	call	_ZN1n6vectorINS_6stringIcEEE9__releaseEv
+	movq	%rbx, %rdi
+.LEHB45:
+	call	_Unwind_Resume@PLT
+.LEHE45:
+.L857:
+	movq	192(%rsp), %rsi
+	movq	200(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L858
+	movq	216(%rsp), %rdi
+	salq	$3, %rdx
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L858:
+	movq	160(%rsp), %rsi
+	movq	168(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L859
+	movq	184(%rsp), %rdi
+	salq	$3, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L859:
+	movq	128(%rsp), %rsi
+	movq	136(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L860
+	movq	152(%rsp), %rdi
+	imulq	$20, %rdx, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L860:
+	movq	%rbp, %rdi
+	call	_ZN1n6vectorINS_6stringIcEEE9__releaseEv
+	movq	%rbx, %rdi
+.LEHB46:
+	call	_Unwind_Resume@PLT
+.LEHE46:
+.L1018:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC42(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB47:
+	call	__cxa_throw@PLT
+.L1019:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC43(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE47:
+.L936:
+	movq	%rax, %rbp
+	movq	%rbx, %rdi
+	call	_ZN1n12aho_corasickIcED1Ev
+	movq	%rbp, %rdi
+.LEHB48:
+	call	_Unwind_Resume@PLT
+.LEHE48:
+.L1017:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC40(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB49:
+	call	__cxa_throw@PLT
+.LEHE49:
+	.cfi_endproc
+.LFE6777:
+	.section	.gcc_except_table
+.LLSDAC6777:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6777-.LLSDACSBC6777
+.LLSDACSBC6777:
+	.uleb128 .LEHB45-.LCOLDB44
+	.uleb128 .LEHE45-.LEHB45
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB46-.LCOLDB44
+	.uleb128 .LEHE46-.LEHB46
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB47-.LCOLDB44
+	.uleb128 .LEHE47-.LEHB47
+	.uleb128 .L936-.LCOLDB44
+	.uleb128 0
+	.uleb128 .LEHB48-.LCOLDB44
+	.uleb128 .LEHE48-.LEHB48
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB49-.LCOLDB44
+	.uleb128 .LEHE49-.LEHB49
+	.uleb128 .L936-.LCOLDB44
+	.uleb128 0
+.LLSDACSEC6777:
+	.section	.text.unlikely
+	.text
+	.size	_Z23test_aho_corasick_countv, .-_Z23test_aho_corasick_countv
+	.section	.text.unlikely
+	.size	_Z23test_aho_corasick_countv.cold, .-_Z23test_aho_corasick_countv.cold
+.LCOLDE44:
+	.text
+.LHOTE44:
+	.section	.rodata.str1.1
+.LC45:
+	.string	"ab"
+.LC46:
+	.string	"bab"
+.LC47:
+	.string	"abba"
+.LC48:
+	.string	"b"
+.LC49:
+	.string	"bbb"
+.LC50:
+	.string	"aab"
+.LC51:
+	.string	"abbabaabbbabababbbaabab"
+	.section	.rodata.str1.8
+	.align 8
+.LC52:
+	.string	"expected equal : expected value : ac.count(text), actual value : expected"
+	.section	.rodata.str1.1
+.LC53:
+	.string	"expected true : located"
+	.section	.text.unlikely
+.LCOLDB54:
+	.text
+.LHOTB54:
+	.p2align 4
+	.globl	_Z31test_aho_corasick_against_naivev
+	.type	_Z31test_aho_corasick_against_naivev, @function
+_Z31test_aho_corasick_against_naivev:
+.LFB6794:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6794
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leaq	.LC46(%rip), %rax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rax, %xmm3
+	leaq	.LC48(%rip), %rax
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rax, %xmm4
+	leaq	.LC50(%rip), %rax
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rax, %xmm7
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	leaq	.LC45(%rip), %rbx
+	movq	%rbx, %xmm0
+	leaq	.LC47(%rip), %rbx
+	punpcklqdq	%xmm3, %xmm0
+	subq	$1256, %rsp
+	.cfi_def_cfa_offset 1312
+	movaps	%xmm0, 80(%rsp)
+	movq	%rbx, %xmm0
+	leaq	.LC49(%rip), %rbx
+	movq	$0, 48(%rsp)
+	punpcklqdq	%xmm4, %xmm0
+	movaps	%xmm0, 96(%rsp)
+	movq	%rbx, %xmm0
+	punpcklqdq	%xmm7, %xmm0
+	movaps	%xmm0, 112(%rsp)
+	pxor	%xmm0, %xmm0
+	movups	%xmm0, 56(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, %r14
+	testq	%rax, %rax
+	je	.L1268
+.L1053:
+	movq	%rax, 72(%rsp)
+	leaq	80(%rsp), %rax
+	leaq	128(%rsp), %rbx
+	movq	%rax, (%rsp)
+	movq	%rax, 40(%rsp)
+	leaq	152(%rsp), %rax
+	movq	%rax, 32(%rsp)
+	movq	(%rsp), %rax
+	movq	%rbx, 24(%rsp)
+	jmp	.L1089
+.L1074:
+	leaq	(%rbx,%rbx,2), %rbp
+	movdqa	.LC16(%rip), %xmm2
+	salq	$4, %rbp
+	addq	%r13, %rbp
+	movups	%xmm2, 0(%rbp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L1269
+.L1084:
+	movq	144(%rsp), %rax
+	pxor	%xmm3, %xmm3
+	movdqa	128(%rsp), %xmm4
+	movq	$0, 40(%rbp)
+	movups	%xmm3, 24(%rbp)
+	movq	%rax, 16(%rbp)
+	movq	136(%rsp), %rax
+	movups	%xmm4, 0(%rbp)
+	cmpq	$23, %rax
+	je	.L1270
+	movq	152(%rsp), %rax
+	movq	%rax, 24(%rbp)
+	leaq	1(%rbx), %rbp
+.L1087:
+	addq	$8, (%rsp)
+	movq	(%rsp), %rax
+	movq	%rbp, 64(%rsp)
+	cmpq	%rax, 24(%rsp)
+	je	.L1088
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r14
+.L1089:
+	movq	(%rax), %r12
+	testq	%r12, %r12
+	je	.L1271
+	cmpb	$0, (%r12)
+	je	.L1160
+	leaq	1(%r12), %rdi
+	call	strlen@PLT
+	leaq	1(%rax), %rbx
+.L1060:
+	movdqa	.LC16(%rip), %xmm1
+	movaps	%xmm1, 128(%rsp)
+	testq	%r14, %r14
+	je	.L1161
+	movq	32(%rsp), %rax
+	pxor	%xmm5, %xmm5
+	movq	%r14, 144(%rsp)
+	xorl	%r13d, %r13d
+	movq	$0, 168(%rsp)
+	movq	%rbx, 8(%rsp)
+	movq	%rax, %rbp
+	movups	%xmm5, 152(%rsp)
+	cmpq	%rax, %r12
+	jnb	.L1162
+.L1059:
+	cmpq	$23, %rbx
+	jbe	.L1072
+	movq	%rbp, 16(%rsp)
+	movl	$23, %r15d
+.L1157:
+	leaq	10(%r15,%r15), %rax
+	movl	$1, %edx
+	movq	%r14, %rdi
+	cmpq	%rbx, %rax
+	cmovnb	%rax, %rbx
+	movq	(%r14), %rax
+	leaq	1(%rbx), %rsi
+.LEHB50:
+	call	*16(%rax)
+	movq	16(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	cmpq	$23, %r15
+	je	.L1068
+	movq	(%r14), %rax
+	leaq	1(%r15), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.LEHE50:
+.L1068:
+	movq	%rbp, 152(%rsp)
+	movq	%rbx, 136(%rsp)
+	cmpq	$23, %rbx
+	je	.L1272
+.L1072:
+	movq	8(%rsp), %rbx
+	leaq	0(%rbp,%r13), %rdi
+	movq	%r12, %rsi
+	movq	%rbx, %rdx
+	call	memmove@PLT
+	movq	56(%rsp), %r12
+	movq	48(%rsp), %r13
+	movq	128(%rsp), %rax
+	addq	%rbx, %rax
+	movq	64(%rsp), %rbx
+	movq	%rax, 128(%rsp)
+	movb	$0, 0(%rbp,%rax)
+	movq	%rbx, %rbp
+	cmpq	%r12, %rbx
+	jne	.L1074
+	leaq	5(%rbx), %rdx
+	movq	72(%rsp), %rdi
+	leaq	(%rdx,%rdx), %rax
+	leaq	(%rax,%rdx), %rsi
+	movq	%rax, 56(%rsp)
+	movq	(%rdi), %rax
+	movl	$8, %edx
+	salq	$5, %rsi
+.LEHB51:
+	call	*16(%rax)
+	leaq	(%rbx,%rbx,2), %rbx
+	movdqa	.LC16(%rip), %xmm6
+	movq	%rax, 48(%rsp)
+	movq	%rax, %rdi
+	salq	$4, %rbx
+	addq	%rax, %rbx
+	movups	%xmm6, (%rbx)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L1273
+.L1075:
+	movq	144(%rsp), %rax
+	pxor	%xmm7, %xmm7
+	movdqa	128(%rsp), %xmm6
+	movq	$0, 40(%rbx)
+	movups	%xmm7, 24(%rbx)
+	movq	%rax, 16(%rbx)
+	movq	136(%rsp), %rax
+	movups	%xmm6, (%rbx)
+	cmpq	$23, %rax
+	je	.L1274
+	movq	152(%rsp), %rax
+	movq	$23, 136(%rsp)
+	movq	%rax, 24(%rbx)
+.L1079:
+	movq	$0, 128(%rsp)
+	movb	$0, 152(%rsp)
+	testq	%rbp, %rbp
+	jne	.L1275
+	testq	%r13, %r13
+	je	.L1082
+.L1081:
+	movq	72(%rsp), %rdi
+	leaq	(%r12,%r12,2), %rdx
+	movl	$8, %ecx
+	movq	%r13, %rsi
+	salq	$4, %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE51:
+.L1082:
+	addq	$1, %rbp
+	jmp	.L1087
+.L1271:
+	movdqa	.LC16(%rip), %xmm7
+	movaps	%xmm7, 128(%rsp)
+	testq	%r14, %r14
+	je	.L1159
+	pxor	%xmm5, %xmm5
+	movq	32(%rsp), %rbp
+	xorl	%r13d, %r13d
+	movq	%r14, 144(%rsp)
+	movq	$0, 168(%rsp)
+	movq	$0, 8(%rsp)
+	movups	%xmm5, 152(%rsp)
+	jmp	.L1072
+.L1162:
+	movq	%rax, 16(%rsp)
+	movl	$23, %r15d
+.L1061:
+	cmpq	%rbx, %r15
+	jb	.L1157
+	movq	%r15, %rbx
+	xorl	%ebp, %ebp
+	cmpq	$23, %rbx
+	jne	.L1072
+.L1272:
+	movq	32(%rsp), %rbp
+	jmp	.L1072
+.L1270:
+	movdqu	152(%rsp), %xmm3
+	movq	168(%rsp), %rax
+	movups	%xmm3, 24(%rbp)
+	movq	%rax, 40(%rbp)
+	movq	%rbx, %rbp
+	jmp	.L1082
+.L1088:
+	movq	$0, 128(%rsp)
+	pxor	%xmm0, %xmm0
+	movups	%xmm0, 136(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L1093
+	movq	%rax, 152(%rsp)
+	movq	$0, 160(%rsp)
+	movups	%xmm0, 168(%rsp)
+.L1094:
+	movq	%rax, 184(%rsp)
+	pxor	%xmm0, %xmm0
+	movq	$0, 192(%rsp)
+	movups	%xmm0, 200(%rsp)
+.L1099:
+	movq	%rax, 216(%rsp)
+	leaq	224(%rsp), %rdi
+	movl	$128, %ecx
+	xorl	%eax, %eax
+	rep stosq
+	leaq	48(%rsp), %rbp
+	movq	24(%rsp), %rdi
+	movq	%rbp, %rsi
+.LEHB52:
+	call	_ZN1n12aho_corasickIcE7__buildERKNS_6vectorINS_6stringIcEEEE
+.LEHE52:
+	movq	48(%rsp), %r12
+	movq	64(%rsp), %rbp
+	xorl	%r13d, %r13d
+	movq	%r12, %rbx
+	testq	%rbp, %rbp
+	je	.L1116
+	.p2align 4,,10
+	.p2align 3
+.L1117:
+	movq	8(%rbx), %rax
+	cmpq	$23, %rax
+	je	.L1114
+	movq	16(%rbx), %rdi
+	leaq	1(%rax), %rdx
+	addq	$1, %r13
+	movq	24(%rbx), %rsi
+	movl	$1, %ecx
+	addq	$48, %rbx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	%r13, %rbp
+	jne	.L1117
+.L1116:
+	testq	%r12, %r12
+	je	.L1113
+	movq	56(%rsp), %rax
+	movq	72(%rsp), %rdi
+	movl	$8, %ecx
+	movq	%r12, %rsi
+	leaq	(%rax,%rax,2), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+	call	*24(%rax)
+.L1113:
+	movq	40(%rsp), %r13
+	xorl	%ebp, %ebp
+	leaq	23+.LC51(%rip), %rbx
+.L1123:
+	movq	0(%r13), %r15
+	testq	%r15, %r15
+	je	.L1167
+	cmpb	$0, (%r15)
+	je	.L1167
+	leaq	1(%r15), %rdi
+	movl	$23, %r12d
+	call	strlen@PLT
+	leaq	1(%rax), %r14
+	.p2align 4,,10
+	.p2align 3
+.L1120:
+	cmpq	%r14, %r12
+	jb	.L1119
+	movq	%rbx, %rdi
+	movq	%r14, %rdx
+	movq	%r15, %rsi
+	subq	%r12, %rdi
+	call	memcmp@PLT
+	cmpl	$1, %eax
+	adcq	$0, %rbp
+.L1119:
+	subq	$1, %r12
+	jne	.L1120
+	addq	$8, %r13
+	cmpq	%r13, 24(%rsp)
+	jne	.L1123
+.L1281:
+	movq	128(%rsp), %r13
+	movq	160(%rsp), %r14
+	xorl	%r9d, %r9d
+	xorl	%eax, %eax
+	leaq	.LC51(%rip), %r11
+	.p2align 4,,10
+	.p2align 3
+.L1136:
+	movzbl	(%r11), %esi
+	testl	%eax, %eax
+	jne	.L1124
+	.p2align 4,,10
+	.p2align 3
+.L1133:
+	movl	224(%rsp,%rsi,4), %edx
+	leal	-1(%rdx), %eax
+	cmpl	$-3, %eax
+	jbe	.L1125
+	xorl	%eax, %eax
+	xorl	%ecx, %ecx
+	cmpl	$-1, 12(%r13)
+	movq	%r13, %rsi
+	je	.L1127
+	.p2align 4,,10
+	.p2align 3
+.L1135:
+	leaq	(%rcx,%rcx,4), %rdx
+	addq	$1, %r9
+	movl	16(%r13,%rdx,4), %edx
+	cmpl	$-1, %edx
+	je	.L1134
+.L1266:
+	movl	%edx, %ecx
+	jmp	.L1135
+	.p2align 4,,10
+	.p2align 3
+.L1277:
+	cmpq	%r8, %rcx
+	jnb	.L1131
+	leaq	(%rdi,%rcx,8), %rax
+	cmpb	(%rax), %sil
+	jne	.L1131
+	movl	4(%rax), %eax
+	leal	-1(%rax), %edx
+	cmpl	$-3, %edx
+	jbe	.L1132
+.L1131:
+	movl	8(%r10), %eax
+	testl	%eax, %eax
+	je	.L1133
+.L1124:
+	leaq	(%rax,%rax,4), %rax
+	xorl	%ecx, %ecx
+	leaq	0(%r13,%rax,4), %r10
+	movl	(%r10), %eax
+	movl	4(%r10), %r8d
+	leaq	(%r14,%rax,8), %rdi
+	movq	%r8, %rdx
+	jmp	.L1129
+	.p2align 4,,10
+	.p2align 3
+.L1130:
+	leaq	(%rdx,%rcx), %rax
+	shrq	%rax
+	cmpb	(%rdi,%rax,8), %sil
+	jg	.L1276
+	movq	%rax, %rdx
+.L1129:
+	cmpq	%rdx, %rcx
+	jb	.L1130
+	jmp	.L1277
+.L1125:
+	movl	%edx, %ecx
+	leaq	(%rcx,%rcx,4), %rax
+	leaq	0(%r13,%rax,4), %rsi
+	movl	%edx, %eax
+	cmpl	$-1, 12(%rsi)
+	jne	.L1135
+.L1127:
+	movl	16(%rsi), %edx
+	cmpl	$-1, %edx
+	jne	.L1266
+	.p2align 4,,10
+	.p2align 3
+.L1134:
+	addq	$1, %r11
+	cmpq	%rbx, %r11
+	jne	.L1136
+	cmpq	%rbp, %r9
+	jne	.L1258
+	movq	%r14, (%rsp)
+	movl	$1, %r10d
+	xorl	%ebx, %ebx
+	xorl	%r12d, %r12d
+	movq	192(%rsp), %r11
+	movq	%r11, 8(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1151:
+	leaq	.LC51(%rip), %rax
+	movzbl	(%rax,%rbx), %esi
+	testl	%r12d, %r12d
+	jne	.L1138
+	.p2align 4,,10
+	.p2align 3
+.L1147:
+	movl	224(%rsp,%rsi,4), %r12d
+	leal	-1(%r12), %eax
+	cmpl	$-3, %eax
+	jbe	.L1139
+	addq	$1, %rbx
+	xorl	%r12d, %r12d
+	xorl	%eax, %eax
+	cmpl	$-1, 12(%r13)
+	movq	%r13, %rdx
+	je	.L1141
+	.p2align 4,,10
+	.p2align 3
+.L1150:
+	leaq	(%rax,%rax,4), %rax
+	leaq	0(%r13,%rax,4), %r15
+	testb	%r10b, %r10b
+	je	.L1149
+	movl	12(%r15), %r14d
+	movq	80(%rsp,%r14,8), %rbp
+	testq	%rbp, %rbp
+	je	.L1149
+	cmpb	$0, 0(%rbp)
+	je	.L1149
+	leaq	1(%rbp), %rdi
+	call	strlen@PLT
+	movq	8(%rsp), %rsi
+	movl	$23, %ecx
+	movq	%rbx, %rdx
+	addq	$1, %rax
+	subq	(%rsi,%r14,8), %rdx
+	cmpq	%rcx, %rdx
+	cmova	%rcx, %rdx
+	xorl	%r10d, %r10d
+	subq	%rdx, %rcx
+	cmpq	%rax, %rcx
+	jb	.L1149
+	leaq	.LC51(%rip), %rsi
+	leaq	(%rsi,%rdx), %rdi
+	movq	%rax, %rdx
+	movq	%rbp, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	sete	%r10b
+	.p2align 4,,10
+	.p2align 3
+.L1149:
+	movl	16(%r15), %eax
+	cmpl	$-1, %eax
+	jne	.L1150
+	cmpq	$23, %rbx
+	jne	.L1151
+.L1280:
+	movq	(%rsp), %r14
+	movq	8(%rsp), %r11
+	testb	%r10b, %r10b
+	je	.L1259
+	testq	%r11, %r11
+	je	.L1153
+	movq	200(%rsp), %rax
+	movq	216(%rsp), %rdi
+	movl	$8, %ecx
+	movq	%r11, %rsi
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1153:
+	testq	%r14, %r14
+	je	.L1154
+	movq	168(%rsp), %rax
+	movq	184(%rsp), %rdi
+	movl	$4, %ecx
+	movq	%r14, %rsi
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1154:
+	testq	%r13, %r13
+	je	.L1052
+	movq	136(%rsp), %rax
+	movq	152(%rsp), %rdi
+	movl	$4, %ecx
+	movq	%r13, %rsi
+	leaq	(%rax,%rax,4), %rdx
+	movq	(%rdi), %rax
+	salq	$2, %rdx
+	call	*24(%rax)
+.L1052:
+	addq	$1256, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1279:
+	.cfi_restore_state
+	cmpq	%r9, %rcx
+	jnb	.L1145
+	leaq	(%rdi,%rcx,8), %rax
+	cmpb	(%rax), %sil
+	jne	.L1145
+	movl	4(%rax), %r12d
+	leal	-1(%r12), %eax
+	cmpl	$-3, %eax
+	jbe	.L1139
+.L1145:
+	movl	8(%r8), %r12d
+	testl	%r12d, %r12d
+	je	.L1147
+.L1138:
+	leaq	(%r12,%r12,4), %rax
+	movq	(%rsp), %rdi
+	xorl	%ecx, %ecx
+	leaq	0(%r13,%rax,4), %r8
+	movl	(%r8), %eax
+	movl	4(%r8), %r9d
+	leaq	(%rdi,%rax,8), %rdi
+	movq	%r9, %rdx
+	jmp	.L1143
+	.p2align 4,,10
+	.p2align 3
+.L1144:
+	leaq	(%rdx,%rcx), %rax
+	shrq	%rax
+	cmpb	(%rdi,%rax,8), %sil
+	jg	.L1278
+	movq	%rax, %rdx
+.L1143:
+	cmpq	%rdx, %rcx
+	jb	.L1144
+	jmp	.L1279
+	.p2align 4,,10
+	.p2align 3
+.L1278:
+	leaq	1(%rax), %rcx
+	jmp	.L1143
+	.p2align 4,,10
+	.p2align 3
+.L1276:
+	leaq	1(%rax), %rcx
+	jmp	.L1129
+.L1114:
+	addq	$1, %r13
+	addq	$48, %rbx
+	cmpq	%r13, %rbp
+	jne	.L1117
+	jmp	.L1116
+.L1139:
+	movl	%r12d, %eax
+	addq	$1, %rbx
+	leaq	(%rax,%rax,4), %rax
+	leaq	0(%r13,%rax,4), %rdx
+	movl	%r12d, %eax
+	cmpl	$-1, 12(%rdx)
+	jne	.L1150
+.L1141:
+	movl	16(%rdx), %eax
+	cmpl	$-1, %eax
+	jne	.L1150
+	cmpq	$23, %rbx
+	jne	.L1151
+	jmp	.L1280
+	.p2align 4,,10
+	.p2align 3
+.L1167:
+	movl	$23, %eax
+	.p2align 4,,10
+	.p2align 3
+.L1122:
+	addq	$1, %rbp
+	subq	$1, %rax
+	jne	.L1122
+	addq	$8, %r13
+	cmpq	%r13, 24(%rsp)
+	jne	.L1123
+	jmp	.L1281
+.L1269:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	movq	64(%rsp), %rbx
+	testb	%al, %al
+	jne	.L1084
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	movq	64(%rsp), %rbx
+	testl	%eax, %eax
+	je	.L1084
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movq	64(%rsp), %rbx
+	jmp	.L1084
+.L1161:
+	movq	%rbx, 8(%rsp)
+.L1058:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1282
+.L1063:
+	movq	_ZZN1n4heapEvE3res(%rip), %r14
+	movq	128(%rsp), %r13
+	pxor	%xmm2, %xmm2
+	movq	$0, 168(%rsp)
+	movq	8(%rsp), %rax
+	movq	136(%rsp), %r15
+	movq	$0, 16(%rsp)
+	movq	%r14, 144(%rsp)
+	leaq	(%rax,%r13), %rbx
+	movups	%xmm2, 152(%rsp)
+	cmpq	$23, %r15
+	je	.L1283
+.L1065:
+	movq	16(%rsp), %rax
+	addq	%r13, %rax
+	cmpq	%rax, %r12
+	jnb	.L1061
+	movq	16(%rsp), %rax
+	subq	%rax, %r12
+	cmpq	%rbx, %r15
+	jnb	.L1165
+	leaq	10(%r15,%r15), %rax
+	movl	$1, %edx
+	movq	%r14, %rdi
+	cmpq	%rbx, %rax
+	cmovnb	%rax, %rbx
+	movq	(%r14), %rax
+	leaq	1(%rbx), %rsi
+.LEHB53:
+	call	*16(%rax)
+	movq	16(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	cmpq	$23, %r15
+	je	.L1070
+	movq	(%r14), %rax
+	leaq	1(%r15), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.LEHE53:
+.L1070:
+	movq	%rbp, 152(%rsp)
+	movq	%rbx, %r15
+	movq	%rbx, 136(%rsp)
+.L1069:
+	cmpq	$23, %r15
+	jne	.L1264
+	leaq	152(%rsp), %rbp
+.L1264:
+	addq	%rbp, %r12
+	jmp	.L1072
+.L1275:
+	leaq	0(%rbp,%rbp,2), %rdx
+	movq	%r13, %rsi
+	salq	$4, %rdx
+	call	memcpy@PLT
+	jmp	.L1081
+.L1165:
+	xorl	%ebp, %ebp
+	jmp	.L1069
+.L1160:
+	xorl	%ebx, %ebx
+	jmp	.L1060
+.L1274:
+	movdqu	152(%rsp), %xmm1
+	movq	168(%rsp), %rax
+	movups	%xmm1, 24(%rbx)
+	movq	%rax, 40(%rbx)
+	jmp	.L1079
+.L1273:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1076
+.L1265:
+	movq	64(%rsp), %rbp
+	movq	48(%rsp), %rdi
+	jmp	.L1075
+.L1282:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1063
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1063
+.L1159:
+	movq	$0, 8(%rsp)
+	jmp	.L1058
+.L1268:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1284
+.L1055:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r14
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	jmp	.L1053
+.L1093:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1285
+.L1096:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdx
+	pxor	%xmm0, %xmm0
+	movq	$0, 160(%rsp)
+	movups	%xmm0, 168(%rsp)
+	movq	%rdx, 152(%rsp)
+	testq	%rax, %rax
+	jne	.L1094
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1286
+.L1101:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdx
+	pxor	%xmm0, %xmm0
+	movq	$0, 192(%rsp)
+	movups	%xmm0, 200(%rsp)
+	movq	%rdx, 184(%rsp)
+	testq	%rax, %rax
+	jne	.L1099
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1287
+.L1104:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	jmp	.L1099
+.L1076:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1265
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1265
+.L1284:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1055
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1055
+.L1287:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1104
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1104
+.L1286:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1101
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1101
+.L1285:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1096
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1096
+.L1283:
+	leaq	152(%rsp), %rbp
+	cmpq	%rbp, %r12
+	jb	.L1059
+	movq	%rbp, 16(%rsp)
+	jmp	.L1065
+.L1132:
+	movl	%eax, %ecx
+	imulq	$20, %rcx, %rsi
+	addq	%r13, %rsi
+	cmpl	$-1, 12(%rsi)
+	jne	.L1135
+	jmp	.L1127
+.L1178:
+	movq	%rax, %rbx
+	jmp	.L1107
+.L1180:
+	movq	%rax, %rbx
+	jmp	.L1090
+.L1179:
+	movq	%rax, %rbx
+	jmp	.L1092
+	.section	.gcc_except_table
+.LLSDA6794:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6794-.LLSDACSB6794
+.LLSDACSB6794:
+	.uleb128 .LEHB50-.LFB6794
+	.uleb128 .LEHE50-.LEHB50
+	.uleb128 .L1179-.LFB6794
+	.uleb128 0
+	.uleb128 .LEHB51-.LFB6794
+	.uleb128 .LEHE51-.LEHB51
+	.uleb128 .L1180-.LFB6794
+	.uleb128 0
+	.uleb128 .LEHB52-.LFB6794
+	.uleb128 .LEHE52-.LEHB52
+	.uleb128 .L1178-.LFB6794
+	.uleb128 0
+	.uleb128 .LEHB53-.LFB6794
+	.uleb128 .LEHE53-.LEHB53
+	.uleb128 .L1179-.LFB6794
+	.uleb128 0
+.LLSDACSE6794:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6794
+	.type	_Z31test_aho_corasick_against_naivev.cold, @function
+_Z31test_aho_corasick_against_naivev.cold:
+.LFSB6794:
+.L1258:
+	.cfi_def_cfa_offset 1312
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC52(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB54:
+	call	__cxa_throw@PLT
+.L1259:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC53(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE54:
+.L1177:
+	movq	24(%rsp), %rdi
+	movq	%rax, %rbx
+	call	_ZN1n12aho_corasickIcED1Ev
+	movq	%rbx, %rdi
+.LEHB55:
+	call	_Unwind_Resume@PLT
+.LEHE55:
+.L1090:
+	movq	136(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L1092
+	movq	144(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	152(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1092:
+	leaq	48(%rsp), %rdi
+	call	_ZN1n6vectorINS_6stringIcEEE9__releaseEv
+	movq	%rbx, %rdi
+.LEHB56:
+	call	_Unwind_Resume@PLT
+.LEHE56:
+.L1107:
+	movq	192(%rsp), %rsi
+	movq	200(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L1108
+	movq	216(%rsp), %rdi
+	salq	$3, %rdx
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1108:
+	movq	160(%rsp), %rsi
+	movq	168(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L1109
+	movq	184(%rsp), %rdi
+	salq	$3, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1109:
+	movq	128(%rsp), %rsi
+	movq	136(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L1110
+	movq	152(%rsp), %rdi
+	imulq	$20, %rdx, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1110:
+	movq	%rbp, %rdi
+	call	_ZN1n6vectorINS_6stringIcEEE9__releaseEv
+	movq	%rbx, %rdi
+.LEHB57:
+	call	_Unwind_Resume@PLT
+.LEHE57:
+	.cfi_endproc
+.LFE6794:
+	.section	.gcc_except_table
+.LLSDAC6794:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6794-.LLSDACSBC6794
+.LLSDACSBC6794:
+	.uleb128 .LEHB54-.LCOLDB54
+	.uleb128 .LEHE54-.LEHB54
+	.uleb128 .L1177-.LCOLDB54
+	.uleb128 0
+	.uleb128 .LEHB55-.LCOLDB54
+	.uleb128 .LEHE55-.LEHB55
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB56-.LCOLDB54
+	.uleb128 .LEHE56-.LEHB56
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB57-.LCOLDB54
+	.uleb128 .LEHE57-.LEHB57
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6794:
+	.section	.text.unlikely
+	.text
+	.size	_Z31test_aho_corasick_against_naivev, .-_Z31test_aho_corasick_against_naivev
+	.section	.text.unlikely
+	.size	_Z31test_aho_corasick_against_naivev.cold, .-_Z31test_aho_corasick_against_naivev.cold
+.LCOLDE54:
+	.text
+.LHOTE54:
+	.section	.text._ZN1n12aho_corasickIwE7__buildERKNS_6vectorINS_6stringIwEEEE,"axG",@progbits,_ZN1n12aho_corasickIwE7__buildERKNS_6vectorINS_6stringIwEEEE,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n12aho_corasickIwE7__buildERKNS_6vectorINS_6stringIwEEEE
+	.type	_ZN1n12aho_corasickIwE7__buildERKNS_6vectorINS_6stringIwEEEE, @function
+_ZN1n12aho_corasickIwE7__buildERKNS_6vectorINS_6stringIwEEEE:
+.LFB6889:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6889
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdi, %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$168, %rsp
+	.cfi_def_cfa_offset 224
+	movq	%rsi, 56(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbx
+	movq	%rbx, 72(%rsp)
+	testq	%rbx, %rbx
+	je	.L1585
+.L1289:
+	movq	72(%rsp), %rdi
+	movl	$8, %edx
+	movl	$400, %esi
+	movq	(%rdi), %rax
+.LEHB58:
+	call	*16(%rax)
+.LEHE58:
+	pxor	%xmm0, %xmm0
+	movq	%rax, 24(%rsp)
+	movups	%xmm0, 8(%rax)
+	movq	$0, (%rax)
+	movq	%rbx, 24(%rax)
+	movl	$-1, 32(%rax)
+	movq	56(%rsp), %rax
+	cmpq	$0, 16(%rax)
+	je	.L1586
+	movq	$1, 16(%rsp)
+	movq	$10, 48(%rsp)
+	movq	$0, 32(%rsp)
+.L1332:
+	movq	32(%rsp), %rax
+	movq	56(%rsp), %rbx
+	leaq	(%rax,%rax,2), %rax
+	salq	$4, %rax
+	addq	(%rbx), %rax
+	movq	(%rax), %rbx
+	movq	%rax, (%rsp)
+	movq	%rbx, 8(%rsp)
+	testq	%rbx, %rbx
+	je	.L1300
+	addq	$24, %rax
+	xorl	%r12d, %r12d
+	xorl	%ebp, %ebp
+	movq	%rax, 40(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1325:
+	movq	(%rsp), %rax
+	cmpq	$5, 8(%rax)
+	je	.L1587
+	movq	24(%rax), %rax
+.L1302:
+	movq	24(%rsp), %rcx
+	movl	(%rax,%r12,4), %ebx
+	leaq	0(%rbp,%rbp,4), %rax
+	leaq	(%rcx,%rax,8), %r13
+	movq	16(%r13), %rcx
+	movq	0(%r13), %r14
+	testq	%rcx, %rcx
+	je	.L1450
+	movq	%r14, %rax
+	xorl	%edx, %edx
+	jmp	.L1306
+	.p2align 4,,10
+	.p2align 3
+.L1304:
+	addq	$1, %rdx
+	addq	$8, %rax
+	cmpq	%rcx, %rdx
+	je	.L1451
+.L1306:
+	cmpl	(%rax), %ebx
+	jne	.L1304
+	movl	4(%rax), %ebp
+	cmpl	$-1, %ebp
+	je	.L1451
+.L1305:
+	movq	8(%rsp), %rax
+	addq	$1, %r12
+	cmpq	%rax, %r12
+	jb	.L1325
+	testl	%ebp, %ebp
+	je	.L1300
+	movq	24(%rsp), %rbx
+	leaq	0(%rbp,%rbp,4), %rax
+	leaq	(%rbx,%rax,8), %rax
+	cmpl	$-1, 32(%rax)
+	jne	.L1300
+	movl	32(%rsp), %ebx
+	movl	%ebx, 32(%rax)
+.L1300:
+	movq	80(%r15), %rax
+	movq	72(%r15), %rbx
+	movq	64(%r15), %rbp
+	cmpq	%rbx, %rax
+	je	.L1588
+	movq	8(%rsp), %rbx
+	movq	%rbx, 0(%rbp,%rax,8)
+.L1568:
+	movq	80(%r15), %rax
+.L1331:
+	movq	56(%rsp), %rbx
+	addq	$1, %rax
+	addq	$1, 32(%rsp)
+	movq	%rax, 80(%r15)
+	movq	32(%rsp), %rax
+	cmpq	16(%rbx), %rax
+	jb	.L1332
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, 56(%rsp)
+	testq	%rax, %rax
+	je	.L1334
+.L1336:
+	movq	16(%rsp), %rax
+	movl	$40, %esi
+	movq	$10, 32(%rsp)
+	testq	%rax, %rax
+	jne	.L1589
+.L1340:
+	movq	56(%rsp), %rdi
+	movl	$4, %edx
+	movq	(%rdi), %rax
+.LEHB59:
+	call	*16(%rax)
+.LEHE59:
+	pxor	%xmm0, %xmm0
+	movq	%rax, 40(%rsp)
+	movq	$0, 128(%rsp)
+	movups	%xmm0, 136(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rdi
+	testq	%rdi, %rdi
+	je	.L1341
+	movq	136(%rsp), %rbp
+	movq	16(%rsp), %rax
+	movq	%rdi, 152(%rsp)
+	movl	$0, 84(%rsp)
+	cmpq	%rax, %rbp
+	jb	.L1590
+.L1343:
+	xorl	%eax, %eax
+.L1349:
+	movq	16(%rsp), %rbx
+	cmpq	%rbx, %rax
+	jnb	.L1364
+	subq	%rax, %rbx
+	movq	%rbx, %rdx
+.L1576:
+	movq	128(%rsp), %rcx
+	salq	$2, %rdx
+	xorl	%esi, %esi
+	leaq	(%rcx,%rax,4), %rdi
+	call	memset@PLT
+.L1364:
+	movq	16(%rsp), %rax
+	movq	%rax, 144(%rsp)
+.L1348:
+	movq	40(%rsp), %rax
+	movl	$1, %ebp
+	movq	$0, 8(%rsp)
+	movl	$0, (%rax)
+	xorl	%eax, %eax
+.L1384:
+	movq	24(%rsp), %rbx
+	leaq	(%rax,%rax,4), %rax
+	movl	$1, %r9d
+	leaq	(%rbx,%rax,8), %r13
+	movq	0(%r13), %r12
+	movq	16(%r13), %r11
+	leaq	8(%r12), %r8
+	cmpq	$1, %r11
+	jbe	.L1591
+	.p2align 4,,10
+	.p2align 3
+.L1374:
+	movl	(%r8), %edi
+	movl	4(%r8), %r10d
+	movq	%r8, %rax
+	movq	%r9, %rdx
+	jmp	.L1371
+	.p2align 4,,10
+	.p2align 3
+.L1373:
+	movq	-8(%rax), %rsi
+	movq	%rsi, (%rax)
+	leaq	-8(%rcx), %rax
+	subq	$1, %rdx
+	je	.L1454
+.L1371:
+	movq	%rax, %rcx
+	cmpl	%edi, -8(%rax)
+	jg	.L1373
+.L1372:
+	addq	$1, %r9
+	movl	%edi, (%rcx)
+	addq	$8, %r8
+	movl	%r10d, 4(%rcx)
+	cmpq	%r11, %r9
+	jne	.L1374
+.L1369:
+	xorl	%ebx, %ebx
+	jmp	.L1382
+	.p2align 4,,10
+	.p2align 3
+.L1375:
+	movl	4(%r12,%rbx,8), %eax
+	movq	40(%rsp), %rdx
+	addq	$1, %rbx
+	movl	%eax, (%rdx,%rbp,4)
+	addq	$1, %rbp
+	cmpq	16(%r13), %rbx
+	jnb	.L1370
+.L1382:
+	movl	4(%r12,%rbx,8), %edx
+	movq	128(%rsp), %rax
+	movl	%ebp, (%rax,%rdx,4)
+	cmpq	%rbp, 32(%rsp)
+	jne	.L1375
+	movq	32(%rsp), %rax
+	movq	56(%rsp), %rdi
+	movl	$4, %edx
+	addq	$5, %rax
+	leaq	(%rax,%rax), %rcx
+	leaq	0(,%rax,8), %rsi
+	movq	(%rdi), %rax
+	movq	%rcx, (%rsp)
+.LEHB60:
+	call	*16(%rax)
+.LEHE60:
+	movq	%rax, %r14
+	movl	4(%r12,%rbx,8), %eax
+	leaq	0(,%rbp,4), %rdx
+	movl	%eax, (%r14,%rbp,4)
+	testq	%rbp, %rbp
+	jne	.L1592
+	cmpq	$0, 40(%rsp)
+	je	.L1378
+.L1377:
+	movq	56(%rsp), %rdi
+	movq	32(%rsp), %rdx
+	movl	$4, %ecx
+	movq	40(%rsp), %rsi
+	movq	(%rdi), %rax
+	salq	$2, %rdx
+.LEHB61:
+	call	*24(%rax)
+.LEHE61:
+.L1378:
+	movq	(%rsp), %rax
+	movq	%r14, 40(%rsp)
+	addq	$1, %rbp
+	addq	$1, %rbx
+	movq	%rax, 32(%rsp)
+	cmpq	16(%r13), %rbx
+	jb	.L1382
+.L1370:
+	addq	$1, 8(%rsp)
+	movq	8(%rsp), %rax
+	cmpq	%rbp, %rax
+	jnb	.L1383
+	movq	40(%rsp), %rbx
+	movl	(%rbx,%rax,4), %eax
+	jmp	.L1384
+	.p2align 4,,10
+	.p2align 3
+.L1451:
+	movq	%rcx, 8(%rsp)
+	movl	16(%rsp), %ebp
+	movq	%rcx, %rax
+	cmpq	%rax, 8(%r13)
+	je	.L1593
+.L1307:
+	leaq	(%r14,%rax,8), %rax
+	movl	%ebx, (%rax)
+	movl	16(%rsp), %ebx
+	movl	%ebx, 4(%rax)
+.L1310:
+	addq	$1, %rcx
+	movq	%rcx, 16(%r13)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbx
+	testq	%rbx, %rbx
+	je	.L1594
+.L1311:
+	movq	48(%rsp), %rcx
+	cmpq	%rcx, 16(%rsp)
+	je	.L1595
+	movq	16(%rsp), %rax
+	movq	24(%rsp), %rcx
+	pxor	%xmm0, %xmm0
+	leaq	(%rax,%rax,4), %rax
+	leaq	(%rcx,%rax,8), %rax
+	movq	$0, (%rax)
+	movq	%rbx, 24(%rax)
+	movl	$-1, 32(%rax)
+	movups	%xmm0, 8(%rax)
+.L1324:
+	movq	(%rsp), %rax
+	addq	$1, 16(%rsp)
+	movq	(%rax), %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L1305
+.L1587:
+	movq	40(%rsp), %rax
+	jmp	.L1302
+.L1450:
+	movq	$0, 8(%rsp)
+	movl	16(%rsp), %ebp
+	movq	8(%rsp), %rax
+	cmpq	%rax, 8(%r13)
+	jne	.L1307
+.L1593:
+	addq	$5, %rax
+	movq	24(%r13), %rdi
+	leaq	(%rax,%rax), %rdx
+	salq	$4, %rax
+	movq	%rax, %rsi
+	movq	(%rdi), %rax
+	movq	%rdx, 8(%r13)
+	movl	$4, %edx
+.LEHB62:
+	call	*16(%rax)
+	movq	16(%r13), %rcx
+	movq	%rax, 0(%r13)
+	movq	%rax, %rdi
+	leaq	0(,%rcx,8), %rdx
+	leaq	(%rax,%rdx), %rax
+	movl	%ebx, (%rax)
+	movl	%ebp, 4(%rax)
+	testq	%rcx, %rcx
+	jne	.L1596
+	testq	%r14, %r14
+	je	.L1310
+.L1309:
+	movq	24(%r13), %rdi
+	movq	8(%rsp), %rdx
+	movl	$4, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	salq	$3, %rdx
+	call	*24(%rax)
+.LEHE62:
+	movq	16(%r13), %rcx
+	jmp	.L1310
+.L1595:
+	movq	16(%rsp), %rcx
+	movq	72(%rsp), %rdi
+	movl	$8, %edx
+	leaq	5(%rcx), %rax
+	leaq	(%rax,%rax,4), %rsi
+	leaq	(%rax,%rax), %r14
+	movq	(%rdi), %rax
+	salq	$4, %rsi
+.LEHB63:
+	call	*16(%rax)
+.LEHE63:
+	movq	16(%rsp), %rcx
+	movq	%rax, %r13
+	pxor	%xmm0, %xmm0
+	movq	%r13, %rdx
+	leaq	(%rcx,%rcx,4), %rsi
+	salq	$3, %rsi
+	leaq	(%rax,%rsi), %rax
+	movq	%rbx, 24(%rax)
+	movq	24(%rsp), %rbx
+	movq	$0, (%rax)
+	movl	$-1, 32(%rax)
+	addq	%rbx, %rsi
+	movups	%xmm0, 8(%rax)
+	movq	%rbx, %rax
+	testq	%rcx, %rcx
+	je	.L1322
+.L1321:
+	movq	(%rax), %rcx
+	movdqu	8(%rax), %xmm1
+	addq	$40, %rax
+	addq	$40, %rdx
+	movq	%rcx, -40(%rdx)
+	movq	-16(%rax), %rcx
+	movups	%xmm1, -32(%rdx)
+	movq	%rcx, -16(%rdx)
+	movl	-8(%rax), %ecx
+	movl	%ecx, -8(%rdx)
+	cmpq	%rax, %rsi
+	jne	.L1321
+.L1322:
+	cmpq	$0, 24(%rsp)
+	je	.L1320
+	movq	48(%rsp), %rax
+	movq	72(%rsp), %rdi
+	movl	$8, %ecx
+	movq	24(%rsp), %rsi
+	leaq	(%rax,%rax,4), %rdx
+	movq	(%rdi), %rax
+	salq	$3, %rdx
+.LEHB64:
+	call	*24(%rax)
+.LEHE64:
+.L1320:
+	movq	%r14, 48(%rsp)
+	movq	%r13, 24(%rsp)
+	jmp	.L1324
+.L1594:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1597
+.L1313:
+	movq	_ZZN1n4heapEvE3res(%rip), %rbx
+	jmp	.L1311
+.L1588:
+	leaq	5(%rbx), %rax
+	movq	88(%r15), %rdi
+	leaq	(%rax,%rax), %rdx
+	salq	$4, %rax
+	movq	%rax, %rsi
+	movq	(%rdi), %rax
+	movq	%rdx, 72(%r15)
+	movl	$8, %edx
+.LEHB65:
+	call	*16(%rax)
+	movq	%rax, 64(%r15)
+	movq	%rax, %rdi
+	movq	8(%rsp), %rcx
+	movq	80(%r15), %rax
+	movq	%rcx, (%rdi,%rax,8)
+	movq	80(%r15), %rax
+	testq	%rax, %rax
+	jne	.L1598
+	testq	%rbp, %rbp
+	je	.L1331
+.L1330:
+	movq	88(%r15), %rdi
+	leaq	0(,%rbx,8), %rdx
+	movl	$8, %ecx
+	movq	%rbp, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE65:
+	jmp	.L1568
+.L1596:
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L1309
+.L1597:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1313
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1313
+.L1598:
+	leaq	0(,%rax,8), %rdx
+	movq	%rbp, %rsi
+	call	memcpy@PLT
+	jmp	.L1330
+.L1589:
+	movq	%rax, 32(%rsp)
+	leaq	0(,%rax,4), %rsi
+.L1335:
+	movq	%rax, 16(%rsp)
+	jmp	.L1340
+.L1590:
+	xorl	%ebx, %ebx
+	xorl	%eax, %eax
+	leaq	84(%rsp), %rdx
+.L1448:
+	leaq	(%rbx,%rax,4), %rax
+	cmpq	%rax, %rdx
+	jnb	.L1350
+	leaq	88(%rsp), %rdx
+	movl	$0, 88(%rsp)
+	cmpq	%rax, %rdx
+	jnb	.L1351
+	cmpq	%rbx, %rdx
+	jnb	.L1599
+.L1351:
+	movq	16(%rsp), %r14
+	movq	(%rdi), %rax
+	movl	$4, %edx
+	leaq	0(,%r14,4), %rsi
+.LEHB66:
+	call	*16(%rax)
+.LEHE66:
+	movq	%rax, 128(%rsp)
+	movq	%rax, %rdi
+	movq	144(%rsp), %rax
+	movq	%r14, 136(%rsp)
+	testq	%rax, %rax
+	jne	.L1600
+	testq	%rbx, %rbx
+	jne	.L1361
+.L1362:
+	movq	16(%rsp), %rbx
+	movq	%rbx, %rdx
+	subq	%rax, %rdx
+	cmpq	%rbx, %rax
+	jb	.L1576
+	jmp	.L1364
+	.p2align 4,,10
+	.p2align 3
+.L1454:
+	movq	%r12, %rcx
+	jmp	.L1372
+.L1592:
+	movq	40(%rsp), %rsi
+	movq	%r14, %rdi
+	call	memcpy@PLT
+	jmp	.L1377
+.L1383:
+	movq	8(%r15), %r12
+	movq	16(%rsp), %rax
+	movq	(%r15), %rbx
+	cmpq	%rax, %r12
+	jb	.L1385
+.L1569:
+	movq	16(%r15), %r13
+.L1386:
+	testq	%rbp, %rbp
+	je	.L1389
+	movq	$0, 64(%rsp)
+.L1411:
+	movq	64(%rsp), %rcx
+	movq	40(%rsp), %rax
+	movq	48(%r15), %r12
+	movl	(%rax,%rcx,4), %eax
+	movq	24(%rsp), %rcx
+	leaq	(%rax,%rax,4), %rax
+	leaq	(%rcx,%rax,8), %r14
+	movq	16(%r14), %rdx
+	movl	32(%r14), %eax
+	movl	%edx, 8(%rsp)
+	movl	%eax, (%rsp)
+	cmpq	%r13, 8(%r15)
+	je	.L1601
+	leaq	0(%r13,%r13,4), %rax
+	leaq	(%rbx,%rax,4), %rax
+	movl	(%rsp), %ebx
+	movl	%r12d, (%rax)
+	movl	%edx, 4(%rax)
+	movl	$0, 8(%rax)
+	movl	%ebx, 12(%rax)
+	movl	$-1, 16(%rax)
+.L1397:
+	addq	$1, %r13
+	movq	%r13, 16(%r15)
+	testq	%rdx, %rdx
+	je	.L1400
+	movq	48(%r15), %rbx
+	xorl	%r12d, %r12d
+	jmp	.L1410
+	.p2align 4,,10
+	.p2align 3
+.L1401:
+	movl	%eax, %edx
+	leaq	0(%r13,%rbx,8), %rax
+	movl	%ecx, (%rax)
+	movl	%edx, 4(%rax)
+.L1406:
+	addq	$1, %rbx
+	addq	$1, %r12
+	movq	%rbx, 48(%r15)
+	cmpq	16(%r14), %r12
+	jnb	.L1602
+.L1410:
+	movq	(%r14), %rax
+	movq	32(%r15), %r13
+	leaq	(%rax,%r12,8), %rax
+	movl	(%rax), %ecx
+	movl	4(%rax), %edx
+	movq	128(%rsp), %rax
+	movl	%ecx, (%rsp)
+	movl	(%rax,%rdx,4), %eax
+	movl	%eax, 8(%rsp)
+	cmpq	%rbx, 40(%r15)
+	jne	.L1401
+	leaq	5(%rbx), %rsi
+	movq	56(%r15), %rdi
+	movl	$4, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 40(%r15)
+	movq	(%rdi), %rax
+.LEHB67:
+	call	*16(%rax)
+.LEHE67:
+	movq	%rax, 32(%r15)
+	movq	%rax, %rdi
+	movq	48(%r15), %rax
+	movl	(%rsp), %esi
+	leaq	0(,%rax,8), %rcx
+	leaq	(%rdi,%rcx), %rdx
+	movl	%esi, (%rdx)
+	movl	8(%rsp), %esi
+	movl	%esi, 4(%rdx)
+	testq	%rax, %rax
+	jne	.L1603
+	testq	%r13, %r13
+	je	.L1456
+.L1405:
+	movq	56(%r15), %rdi
+	leaq	0(,%rbx,8), %rdx
+	movl	$4, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+.LEHB68:
+	call	*24(%rax)
+.LEHE68:
+	movq	48(%r15), %rbx
+	jmp	.L1406
+.L1602:
+	movq	16(%r15), %r13
+.L1400:
+	addq	$1, 64(%rsp)
+	movq	64(%rsp), %rax
+	movq	(%r15), %rbx
+	cmpq	%rax, %rbp
+	jne	.L1411
+.L1389:
+	movl	4(%rbx), %edx
+	testl	%edx, %edx
+	je	.L1417
+	movq	32(%r15), %rax
+	leaq	(%rax,%rdx,8), %rcx
+.L1416:
+	movl	(%rax), %edx
+	cmpq	$255, %rdx
+	ja	.L1415
+	movl	4(%rax), %esi
+	movl	%esi, 96(%r15,%rdx,4)
+.L1415:
+	addq	$8, %rax
+	cmpq	%rax, %rcx
+	jne	.L1416
+.L1417:
+	xorl	%eax, %eax
+	xorl	%edx, %edx
+	testq	%r13, %r13
+	je	.L1414
+.L1413:
+	leaq	(%rdx,%rdx,4), %rdx
+	leaq	(%rbx,%rdx,4), %rdx
+	movdqu	(%rdx), %xmm2
+	movl	16(%rdx), %edx
+	movaps	%xmm2, 96(%rsp)
+	movl	%edx, 112(%rsp)
+	movl	100(%rsp), %edx
+	testl	%edx, %edx
+	je	.L1431
+	movl	104(%rsp), %r10d
+	movl	96(%rsp), %ecx
+	movq	%r13, %r11
+	movq	32(%r15), %rbp
+	movl	%r10d, 64(%rsp)
+	addl	%ecx, %edx
+	.p2align 4,,10
+	.p2align 3
+.L1432:
+	movl	%ecx, %esi
+	movq	%rbx, %rdi
+	xorl	%r10d, %r10d
+	leaq	0(%rbp,%rsi,8), %r9
+	movl	4(%r9), %esi
+	leaq	(%rsi,%rsi,4), %rsi
+	leaq	(%rbx,%rsi,4), %rsi
+	testl	%eax, %eax
+	jne	.L1604
+.L1421:
+	cmpl	$-1, 12(%rdi)
+	movl	%r10d, 8(%rsi)
+	je	.L1605
+	addl	$1, %ecx
+	movl	%r10d, 16(%rsi)
+	cmpl	%ecx, %edx
+	jne	.L1432
+.L1570:
+	movq	%r11, %r13
+.L1431:
+	leal	1(%rax), %edx
+	movq	%rdx, %rax
+	cmpq	%r13, %rdx
+	jb	.L1413
+.L1414:
+	movq	128(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L1419
+	movq	136(%rsp), %rax
+	movq	152(%rsp), %rdi
+	movl	$4, %ecx
+	leaq	0(,%rax,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1419:
+	movq	40(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L1433
+	movq	56(%rsp), %rdi
+	movq	32(%rsp), %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	salq	$2, %rdx
+	call	*24(%rax)
+.L1433:
+	xorl	%ebp, %ebp
+	cmpq	$0, 16(%rsp)
+	movq	24(%rsp), %rbx
+	movq	16(%rsp), %r12
+	je	.L1439
+.L1440:
+	movq	(%rbx), %rsi
+	testq	%rsi, %rsi
+	je	.L1437
+	movq	8(%rbx), %rax
+	movq	24(%rbx), %rdi
+	addq	$1, %rbp
+	addq	$40, %rbx
+	movl	$4, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	%r12, %rbp
+	jne	.L1440
+.L1439:
+	cmpq	$0, 24(%rsp)
+	je	.L1288
+	movq	48(%rsp), %rax
+	movq	72(%rsp), %rdi
+	movl	$8, %ecx
+	movq	24(%rsp), %rsi
+	leaq	(%rax,%rax,4), %rdx
+	movq	(%rdi), %rax
+	salq	$3, %rdx
+	call	*24(%rax)
+.L1288:
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L1605:
+	.cfi_restore_state
+	movl	16(%rdi), %edi
+	addl	$1, %ecx
+	movl	%edi, 16(%rsi)
+	cmpl	%ecx, %edx
+	jne	.L1432
+	jmp	.L1570
+.L1604:
+	movl	(%r9), %r13d
+	movl	64(%rsp), %r10d
+	movl	%eax, (%rsp)
+	movq	%rsi, 8(%rsp)
+	movq	%r13, %r9
+	.p2align 4,,10
+	.p2align 3
+.L1428:
+	testl	%r10d, %r10d
+	jne	.L1422
+	cmpq	$255, %r13
+	ja	.L1422
+	movl	96(%r15,%r13,4), %r9d
+	movl	(%rsp), %eax
+	movq	8(%rsp), %rsi
+	leal	-1(%r9), %edi
+	cmpl	$-3, %edi
+	jbe	.L1423
+.L1571:
+	movq	%rbx, %rdi
+	jmp	.L1421
+	.p2align 4,,10
+	.p2align 3
+.L1422:
+	movl	%r10d, %eax
+	xorl	%edi, %edi
+	leaq	(%rax,%rax,4), %rax
+	leaq	(%rbx,%rax,4), %r14
+	movl	(%r14), %eax
+	movl	4(%r14), %r12d
+	leaq	0(%rbp,%rax,8), %r8
+	movq	%r12, %rsi
+	jmp	.L1425
+	.p2align 4,,10
+	.p2align 3
+.L1426:
+	leaq	(%rsi,%rdi), %rax
+	shrq	%rax
+	cmpl	(%r8,%rax,8), %r9d
+	jg	.L1606
+	movq	%rax, %rsi
+.L1425:
+	cmpq	%rsi, %rdi
+	jb	.L1426
+	cmpq	%r12, %rdi
+	jnb	.L1427
+	leaq	(%r8,%rdi,8), %rax
+	cmpl	(%rax), %r9d
+	jne	.L1427
+	movl	4(%rax), %r12d
+	leal	-1(%r12), %eax
+	cmpl	$-3, %eax
+	jbe	.L1607
+.L1427:
+	testl	%r10d, %r10d
+	je	.L1460
+	movl	8(%r14), %r10d
+	jmp	.L1428
+	.p2align 4,,10
+	.p2align 3
+.L1606:
+	leaq	1(%rax), %rdi
+	jmp	.L1425
+.L1607:
+	movl	%r12d, %edi
+	movl	(%rsp), %eax
+	movq	8(%rsp), %rsi
+	movl	%r12d, %r10d
+	leaq	(%rdi,%rdi,4), %rdi
+	leaq	(%rbx,%rdi,4), %rdi
+	jmp	.L1421
+.L1603:
+	movq	%rcx, %rdx
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L1405
+.L1423:
+	movl	%r9d, %edi
+	movl	%r9d, %r10d
+	leaq	(%rdi,%rdi,4), %rdi
+	leaq	(%rbx,%rdi,4), %rdi
+	jmp	.L1421
+.L1456:
+	xorl	%ebx, %ebx
+	jmp	.L1406
+.L1437:
+	addq	$1, %rbp
+	addq	$40, %rbx
+	cmpq	%r12, %rbp
+	jne	.L1440
+	jmp	.L1439
+.L1460:
+	movl	(%rsp), %eax
+	movq	8(%rsp), %rsi
+	jmp	.L1571
+.L1601:
+	movq	24(%r15), %rdi
+	leaq	5(%r13), %rax
+	leaq	(%rax,%rax), %rdx
+	leaq	(%rax,%rax,4), %rsi
+	movq	(%rdi), %rax
+	movq	%rdx, 8(%r15)
+	salq	$3, %rsi
+	movl	$4, %edx
+.LEHB69:
+	call	*16(%rax)
+.LEHE69:
+	movq	16(%r15), %rcx
+	movl	8(%rsp), %esi
+	movq	%rax, (%r15)
+	movq	%rax, %rdi
+	leaq	(%rcx,%rcx,4), %rdx
+	salq	$2, %rdx
+	leaq	(%rax,%rdx), %rax
+	movl	%esi, 4(%rax)
+	movl	(%rsp), %esi
+	movl	%r12d, (%rax)
+	movl	$0, 8(%rax)
+	movl	%esi, 12(%rax)
+	movl	$-1, 16(%rax)
+	testq	%rcx, %rcx
+	jne	.L1608
+	testq	%rbx, %rbx
+	je	.L1609
+.L1396:
+	movq	24(%r15), %rdi
+	leaq	0(%r13,%r13,4), %rdx
+	movl	$4, %ecx
+	movq	%rbx, %rsi
+	salq	$2, %rdx
+	movq	(%rdi), %rax
+.LEHB70:
+	call	*24(%rax)
+.LEHE70:
+	movq	16(%r15), %r13
+	movq	16(%r14), %rdx
+	jmp	.L1397
+.L1591:
+	testq	%r11, %r11
+	jne	.L1369
+	jmp	.L1370
+.L1608:
+	movq	%rbx, %rsi
+	call	memcpy@PLT
+	jmp	.L1396
+.L1609:
+	movq	16(%r14), %rdx
+	xorl	%r13d, %r13d
+	jmp	.L1397
+.L1452:
+	movq	$10, 48(%rsp)
+	movq	$1, 16(%rsp)
+.L1334:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1610
+.L1338:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	%rax, 56(%rsp)
+	jmp	.L1336
+.L1341:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1611
+.L1345:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$0, 84(%rsp)
+	movq	144(%rsp), %rax
+	movq	%rdi, 152(%rsp)
+	cmpq	%rax, 16(%rsp)
+	jb	.L1364
+	movq	136(%rsp), %rbp
+	movq	16(%rsp), %rbx
+	cmpq	%rbx, %rbp
+	jnb	.L1349
+	movq	128(%rsp), %rbx
+	leaq	84(%rsp), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L1448
+.L1350:
+	movq	16(%rsp), %r14
+	movq	(%rdi), %rax
+	movl	$4, %edx
+	leaq	0(,%r14,4), %rsi
+.LEHB71:
+	call	*16(%rax)
+	movq	%rax, 128(%rsp)
+	movq	%rax, %rdi
+	movq	144(%rsp), %rax
+	movq	%r14, 136(%rsp)
+	testq	%rax, %rax
+	jne	.L1612
+	testq	%rbx, %rbx
+	je	.L1343
+.L1366:
+	movq	152(%rsp), %rdi
+	leaq	0(,%rbp,4), %rdx
+	movl	$4, %ecx
+	movq	%rbx, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	144(%rsp), %rax
+	jmp	.L1349
+.L1385:
+	movq	24(%r15), %rdi
+	leaq	(%rax,%rax,4), %rsi
+	movq	%rax, %r14
+	movl	$4, %edx
+	salq	$2, %rsi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	16(%r15), %r13
+	movq	%rax, (%r15)
+	movq	%rax, %rdi
+	movq	%r14, 8(%r15)
+	testq	%r13, %r13
+	jne	.L1613
+	testq	%rbx, %rbx
+	jne	.L1388
+	movq	%rax, %rbx
+	jmp	.L1386
+.L1585:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1614
+.L1291:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	%rax, 72(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbx
+	testq	%rbx, %rbx
+	jne	.L1289
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1615
+.L1294:
+	movq	_ZZN1n4heapEvE3res(%rip), %rbx
+	jmp	.L1289
+.L1613:
+	leaq	0(%r13,%r13,4), %rdx
+	movq	%rbx, %rsi
+	salq	$2, %rdx
+	call	memcpy@PLT
+.L1388:
+	movq	24(%r15), %rdi
+	leaq	(%r12,%r12,4), %rdx
+	movl	$4, %ecx
+	movq	%rbx, %rsi
+	salq	$2, %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	(%r15), %rbx
+	jmp	.L1569
+.L1610:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1338
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1338
+.L1611:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1345
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1345
+.L1586:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, 56(%rsp)
+	testq	%rax, %rax
+	je	.L1452
+	movq	$1, 32(%rsp)
+	movl	$4, %esi
+	movq	32(%rsp), %rax
+	movq	$10, 48(%rsp)
+	jmp	.L1335
+.L1615:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1294
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1294
+.L1614:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1291
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1291
+.L1599:
+	leaq	92(%rsp), %rdx
+	movl	$0, 92(%rsp)
+	cmpq	%rax, %rdx
+	jnb	.L1351
+	cmpq	%rbx, %rdx
+	jb	.L1351
+	movq	16(%rsp), %rsi
+	xorl	%eax, %eax
+	leaq	96(%rsp), %rdx
+	leaq	128(%rsp), %rdi
+	movl	%eax, 96(%rsp)
+	call	_ZN1n6vectorIjE6resizeEmRKj
+	jmp	.L1348
+	.p2align 4,,10
+	.p2align 3
+.L1612:
+	leaq	0(,%rax,4), %rdx
+	movq	%rbx, %rsi
+	call	memcpy@PLT
+	jmp	.L1366
+.L1600:
+	leaq	0(,%rax,4), %rdx
+	movq	%rbx, %rsi
+	call	memcpy@PLT
+.L1361:
+	movq	152(%rsp), %rdi
+	leaq	0(,%rbp,4), %rdx
+	movl	$4, %ecx
+	movq	%rbx, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE71:
+	movq	144(%rsp), %rax
+	jmp	.L1362
+.L1466:
+.L1575:
+	movq	%rax, %rbx
+	jmp	.L1408
+.L1462:
+	movq	%rax, %rbx
+	jmp	.L1298
+.L1469:
+	movq	%rax, %rbx
+.L1297:
+	movq	$10, 48(%rsp)
+	xorl	%edx, %edx
+	xorl	%ecx, %ecx
+	movq	%rdx, 16(%rsp)
+	movq	%rcx, 24(%rsp)
+.L1298:
+	movq	24(%rsp), %rbp
+	xorl	%r12d, %r12d
+.L1444:
+	cmpq	%r12, 16(%rsp)
+	je	.L1616
+	movq	0(%rbp), %rsi
+	movq	8(%rbp), %rdx
+	testq	%rsi, %rsi
+	je	.L1445
+	movq	24(%rbp), %rdi
+	salq	$3, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1445:
+	addq	$1, %r12
+	addq	$40, %rbp
+	jmp	.L1444
+.L1408:
+	movq	128(%rsp), %rsi
+	movq	136(%rsp), %rax
+	testq	%rsi, %rsi
+	je	.L1409
+.L1393:
+	movq	152(%rsp), %rdi
+	leaq	0(,%rax,4), %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1442:
+	cmpq	$0, 40(%rsp)
+	je	.L1298
+.L1409:
+	movq	56(%rsp), %rdi
+	movq	32(%rsp), %rdx
+	movl	$4, %ecx
+	movq	40(%rsp), %rsi
+	movq	(%rdi), %rax
+	salq	$2, %rdx
+	call	*24(%rax)
+	jmp	.L1298
+.L1616:
+	cmpq	$0, 24(%rsp)
+	je	.L1447
+	movq	72(%rsp), %rdi
+	imulq	$40, 48(%rsp), %rdx
+	movl	$8, %ecx
+	movq	24(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1447:
+	movq	%rbx, %rdi
+.LEHB72:
+	call	_Unwind_Resume@PLT
+.LEHE72:
+.L1463:
+	movq	%rax, %rbx
+	jmp	.L1380
+.L1465:
+	jmp	.L1575
+.L1379:
+	movq	(%rsp), %rax
+	movq	%r14, 40(%rsp)
+	movq	%rax, 32(%rsp)
+.L1380:
+	movq	128(%rsp), %rsi
+	movq	136(%rsp), %rax
+	testq	%rsi, %rsi
+	jne	.L1393
+	jmp	.L1442
+.L1464:
+	jmp	.L1575
+.L1461:
+	jmp	.L1575
+.L1467:
+	movq	%rax, %rbx
+	jmp	.L1441
+.L1471:
+	movq	%rax, %rbx
+	jmp	.L1317
+.L1441:
+	movq	(%rsp), %rax
+	movq	%rax, 32(%rsp)
+	jmp	.L1380
+.L1317:
+	movq	%r14, 48(%rsp)
+	jmp	.L1298
+.L1468:
+	movq	%rax, %rbx
+	jmp	.L1379
+.L1470:
+	movq	%rax, %rbx
+.L1323:
+	movq	%r14, 48(%rsp)
+	movq	%r13, 24(%rsp)
+	jmp	.L1298
+	.cfi_endproc
+.LFE6889:
+	.section	.gcc_except_table
+.LLSDA6889:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6889-.LLSDACSB6889
+.LLSDACSB6889:
+	.uleb128 .LEHB58-.LFB6889
+	.uleb128 .LEHE58-.LEHB58
+	.uleb128 .L1469-.LFB6889
+	.uleb128 0
+	.uleb128 .LEHB59-.LFB6889
+	.uleb128 .LEHE59-.LEHB59
+	.uleb128 .L1462-.LFB6889
+	.uleb128 0
+	.uleb128 .LEHB60-.LFB6889
+	.uleb128 .LEHE60-.LEHB60
+	.uleb128 .L1467-.LFB6889
+	.uleb128 0
+	.uleb128 .LEHB61-.LFB6889
+	.uleb128 .LEHE61-.LEHB61
+	.uleb128 .L1468-.LFB6889
+	.uleb128 0
+	.uleb128 .LEHB62-.LFB6889
+	.uleb128 .LEHE62-.LEHB62
+	.uleb128 .L1462-.LFB6889
+	.uleb128 0
+	.uleb128 .LEHB63-.LFB6889
+	.uleb128 .LEHE63-.LEHB63
+	.uleb128 .L1471-.LFB6889
+	.uleb128 0
+	.uleb128 .LEHB64-.LFB6889
+	.uleb128 .LEHE64-.LEHB64
+	.uleb128 .L1470-.LFB6889
+	.uleb128 0
+	.uleb128 .LEHB65-.LFB6889
+	.uleb128 .LEHE65-.LEHB65
+	.uleb128 .L1462-.LFB6889
+	.uleb128 0
+	.uleb128 .LEHB66-.LFB6889
+	.uleb128 .LEHE66-.LEHB66
+	.uleb128 .L1463-.LFB6889
+	.uleb128 0
+	.uleb128 .LEHB67-.LFB6889
+	.uleb128 .LEHE67-.LEHB67
+	.uleb128 .L1466-.LFB6889
+	.uleb128 0
+	.uleb128 .LEHB68-.LFB6889
+	.uleb128 .LEHE68-.LEHB68
+	.uleb128 .L1461-.LFB6889
+	.uleb128 0
+	.uleb128 .LEHB69-.LFB6889
+	.uleb128 .LEHE69-.LEHB69
+	.uleb128 .L1464-.LFB6889
+	.uleb128 0
+	.uleb128 .LEHB70-.LFB6889
+	.uleb128 .LEHE70-.LEHB70
+	.uleb128 .L1465-.LFB6889
+	.uleb128 0
+	.uleb128 .LEHB71-.LFB6889
+	.uleb128 .LEHE71-.LEHB71
+	.uleb128 .L1463-.LFB6889
+	.uleb128 0
+	.uleb128 .LEHB72-.LFB6889
+	.uleb128 .LEHE72-.LEHB72
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6889:
+	.section	.text._ZN1n12aho_corasickIwE7__buildERKNS_6vectorINS_6stringIwEEEE,"axG",@progbits,_ZN1n12aho_corasickIwE7__buildERKNS_6vectorINS_6stringIwEEEE,comdat
+	.size	_ZN1n12aho_corasickIwE7__buildERKNS_6vectorINS_6stringIwEEEE, .-_ZN1n12aho_corasickIwE7__buildERKNS_6vectorINS_6stringIwEEEE
+	.section	.rodata.str4.4,"aMS",@progbits,4
+	.align 4
+.LC55:
+	.string	"\351"
+	.string	""
+	.string	""
+	.string	"t"
+	.string	""
+	.string	""
+	.string	"\351"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.align 4
+.LC56:
+	.string	"\026N"
+	.string	""
+	.string	"Lu"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.section	.rodata.str4.8,"aMS",@progbits,4
+	.align 8
+.LC58:
+	.string	"l"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\351"
+	.string	""
+	.string	""
+	.string	"t"
+	.string	""
+	.string	""
+	.string	"\351"
+	.string	""
+	.string	""
+	.string	" "
+	.string	""
+	.string	""
+	.string	"d"
+	.string	""
+	.string	""
+	.string	"u"
+	.string	""
+	.string	""
+	.string	" "
+	.string	""
+	.string	""
+	.string	"\026N"
+	.string	""
+	.string	"Lu"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.section	.rodata.str1.8
+	.align 8
+.LC59:
+	.string	"expected equal : expected value : ac.count(n::slice_of(L\"l'\303\251t\303\251 du \344\270\226\347\225\214\")), actual value : 2"
+	.section	.text.unlikely
+.LCOLDB60:
+	.text
+.LHOTB60:
+	.p2align 4
+	.globl	_Z22test_aho_corasick_widev
+	.type	_Z22test_aho_corasick_widev, @function
+_Z22test_aho_corasick_widev:
+.LFB6797:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6797
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pxor	%xmm0, %xmm0
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$1192, %rsp
+	.cfi_def_cfa_offset 1248
+	movq	$0, 32(%rsp)
+	movups	%xmm0, 40(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r12
+	movq	%r12, %rax
+	testq	%r12, %r12
+	je	.L1840
+.L1618:
+	movq	%rax, 56(%rsp)
+	xorl	%ebp, %ebp
+	leaq	.LC55(%rip), %rdx
+.L1622:
+	addq	$1, %rbp
+	movl	(%rdx,%rbp,4), %ecx
+	testl	%ecx, %ecx
+	jne	.L1622
+	movdqa	.LC57(%rip), %xmm1
+	movaps	%xmm1, 64(%rsp)
+	testq	%r12, %r12
+	je	.L1623
+	movq	%r12, 80(%rsp)
+	pxor	%xmm0, %xmm0
+	movq	%rbp, %rax
+	xorl	%r15d, %r15d
+	movq	$0, 104(%rsp)
+	movups	%xmm0, 88(%rsp)
+.L1624:
+	leaq	88(%rsp), %rbx
+	movl	$5, %r13d
+	movq	%rbx, %r14
+	cmpq	%rbx, %rdx
+	jnb	.L1628
+	cmpq	$5, %rax
+	jbe	.L1841
+.L1736:
+	leaq	10(%r13,%r13), %rdx
+	movq	%r12, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$4, %edx
+	movq	%rax, 16(%rsp)
+	leaq	4(,%rax,4), %rsi
+	movq	(%r12), %rax
+.LEHB73:
+	call	*16(%rax)
+	leaq	4(,%r15,4), %r15
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	movq	%r15, %rdx
+	call	memcpy@PLT
+	cmpq	$5, %r13
+	je	.L1632
+	movq	(%r12), %rax
+	movl	$4, %ecx
+	xorl	%esi, %esi
+	movq	%r12, %rdi
+	leaq	4(,%r13,4), %rdx
+	call	*24(%rax)
+.L1632:
+	movq	16(%rsp), %rax
+	cmpq	$5, 16(%rsp)
+	movq	%rbx, 88(%rsp)
+	leaq	.LC55(%rip), %rsi
+	movq	%rax, 72(%rsp)
+	leaq	-4(%r15), %rax
+	movq	%rax, 8(%rsp)
+	je	.L1842
+.L1636:
+	movq	8(%rsp), %rdi
+	leaq	0(,%rbp,4), %rdx
+	addq	%rbx, %rdi
+	call	memmove@PLT
+	movq	48(%rsp), %r13
+	movq	40(%rsp), %r14
+	addq	64(%rsp), %rbp
+	movq	%rbp, 64(%rsp)
+	movq	%r13, %r12
+	movl	$0, (%rbx,%rbp,4)
+	movq	32(%rsp), %rbx
+	cmpq	%r14, %r13
+	je	.L1843
+	leaq	0(%r13,%r13,2), %rax
+	movdqa	.LC57(%rip), %xmm4
+	salq	$4, %rax
+	addq	%rax, %rbx
+	movups	%xmm4, (%rbx)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L1844
+.L1647:
+	pxor	%xmm0, %xmm0
+	movq	80(%rsp), %rax
+	cmpq	$5, 72(%rsp)
+	movq	$0, 40(%rbx)
+	movups	%xmm0, 24(%rbx)
+	movq	%rbp, %xmm0
+	movhps	72(%rsp), %xmm0
+	movq	%rax, 16(%rbx)
+	movups	%xmm0, (%rbx)
+	je	.L1845
+	movq	88(%rsp), %rax
+	leaq	1(%r13), %r12
+	movq	%rax, 24(%rbx)
+.L1651:
+	movq	%r12, 48(%rsp)
+	xorl	%ebp, %ebp
+	leaq	.LC56(%rip), %rdx
+.L1652:
+	addq	$1, %rbp
+	movl	(%rdx,%rbp,4), %eax
+	testl	%eax, %eax
+	jne	.L1652
+	movdqa	.LC57(%rip), %xmm6
+	movaps	%xmm6, 64(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r14
+	testq	%r14, %r14
+	je	.L1653
+	movq	%r14, 80(%rsp)
+	pxor	%xmm0, %xmm0
+	movq	%rbp, %rax
+	movq	$0, 104(%rsp)
+	movq	$0, 8(%rsp)
+	movups	%xmm0, 88(%rsp)
+.L1654:
+	leaq	88(%rsp), %rbx
+	movl	$5, %r13d
+	movq	%rbx, %r15
+	cmpq	%rbx, %rdx
+	jnb	.L1658
+	cmpq	$5, %rax
+	jbe	.L1846
+.L1735:
+	leaq	10(%r13,%r13), %rdx
+	movq	%r14, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$4, %edx
+	movq	%rax, 24(%rsp)
+	leaq	4(,%rax,4), %rsi
+	movq	(%r14), %rax
+	call	*16(%rax)
+	movq	%rax, %rbx
+	movq	8(%rsp), %rax
+	movq	%r15, %rsi
+	movq	%rbx, %rdi
+	leaq	4(,%rax,4), %rax
+	movq	%rax, %rdx
+	movq	%rax, 8(%rsp)
+	call	memcpy@PLT
+	cmpq	$5, %r13
+	je	.L1662
+	movq	(%r14), %rax
+	leaq	4(,%r13,4), %rdx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	movl	$4, %ecx
+	call	*24(%rax)
+.LEHE73:
+.L1662:
+	movq	24(%rsp), %rax
+	movq	%rbx, 88(%rsp)
+	leaq	.LC56(%rip), %rsi
+	movq	%rax, 72(%rsp)
+	movq	8(%rsp), %rax
+	subq	$4, %rax
+	cmpq	$5, 24(%rsp)
+	movq	%rax, 16(%rsp)
+	je	.L1847
+.L1666:
+	movq	16(%rsp), %rdi
+	leaq	0(,%rbp,4), %rdx
+	addq	%rbx, %rdi
+	call	memmove@PLT
+	addq	64(%rsp), %rbp
+	movq	%rbp, 64(%rsp)
+	movl	$0, (%rbx,%rbp,4)
+	movq	32(%rsp), %rbx
+	cmpq	%r12, 40(%rsp)
+	je	.L1848
+	leaq	(%r12,%r12,2), %rax
+	movdqa	.LC57(%rip), %xmm2
+	salq	$4, %rax
+	addq	%rax, %rbx
+	movups	%xmm2, (%rbx)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L1849
+.L1677:
+	pxor	%xmm0, %xmm0
+	movq	80(%rsp), %rax
+	cmpq	$5, 72(%rsp)
+	movq	$0, 40(%rbx)
+	movups	%xmm0, 24(%rbx)
+	movq	%rbp, %xmm0
+	movhps	72(%rsp), %xmm0
+	movq	%rax, 16(%rbx)
+	movups	%xmm0, (%rbx)
+	je	.L1850
+	movq	88(%rsp), %rax
+	movq	%rax, 24(%rbx)
+	movq	48(%rsp), %rax
+	leaq	1(%rax), %r12
+.L1681:
+	pxor	%xmm0, %xmm0
+	movq	%r12, 48(%rsp)
+	movq	$0, 64(%rsp)
+	movups	%xmm0, 72(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L1682
+	movq	%rax, 88(%rsp)
+	movq	$0, 96(%rsp)
+	movups	%xmm0, 104(%rsp)
+.L1683:
+	movq	%rax, 120(%rsp)
+	pxor	%xmm0, %xmm0
+	movq	$0, 128(%rsp)
+	movups	%xmm0, 136(%rsp)
+.L1688:
+	movl	$128, %ecx
+	leaq	64(%rsp), %rbx
+	leaq	32(%rsp), %rsi
+	movq	%rax, 152(%rsp)
+	leaq	160(%rsp), %rdi
+	xorl	%eax, %eax
+	rep stosq
+	movq	%rbx, %rdi
+.LEHB74:
+	call	_ZN1n12aho_corasickIwE7__buildERKNS_6vectorINS_6stringIwEEEE
+.LEHE74:
+	movq	64(%rsp), %rbp
+	movq	96(%rsp), %r12
+	xorl	%r11d, %r11d
+	xorl	%edx, %edx
+	leaq	.LC58(%rip), %r14
+	leaq	44(%r14), %r15
+.L1714:
+	movl	(%r14), %r13d
+	movl	%edx, %r8d
+	movq	%r13, %rdi
+	.p2align 4,,10
+	.p2align 3
+.L1711:
+	testl	%r8d, %r8d
+	jne	.L1701
+	cmpq	$255, %r13
+	ja	.L1701
+	movl	160(%rsp,%r13,4), %edx
+	leal	-1(%rdx), %eax
+	cmpl	$-3, %eax
+	jbe	.L1702
+	xorl	%edx, %edx
+	cmpl	$-1, 12(%rbp)
+	movq	%rbp, %rax
+	je	.L1704
+	.p2align 4,,10
+	.p2align 3
+.L1713:
+	leaq	(%r8,%r8,4), %rax
+	addq	$1, %r11
+	movl	16(%rbp,%rax,4), %r8d
+	cmpl	$-1, %r8d
+	jne	.L1713
+.L1712:
+	addq	$4, %r14
+	cmpq	%r14, %r15
+	jne	.L1714
+	cmpq	$2, %r11
+	jne	.L1830
+	movq	128(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L1716
+	movq	136(%rsp), %rax
+	movq	152(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1716:
+	testq	%r12, %r12
+	je	.L1717
+	movq	104(%rsp), %rax
+	movq	120(%rsp), %rdi
+	movl	$4, %ecx
+	movq	%r12, %rsi
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1717:
+	testq	%rbp, %rbp
+	je	.L1718
+	movq	72(%rsp), %rax
+	movq	88(%rsp), %rdi
+	movl	$4, %ecx
+	movq	%rbp, %rsi
+	leaq	(%rax,%rax,4), %rdx
+	movq	(%rdi), %rax
+	salq	$2, %rdx
+	call	*24(%rax)
+.L1718:
+	movq	32(%rsp), %r13
+	movq	48(%rsp), %r12
+	xorl	%ebp, %ebp
+	movq	%r13, %rbx
+	testq	%r12, %r12
+	je	.L1724
+.L1725:
+	movq	8(%rbx), %rax
+	cmpq	$5, %rax
+	je	.L1722
+	movq	16(%rbx), %rdi
+	addq	$1, %rbp
+	movq	24(%rbx), %rsi
+	addq	$48, %rbx
+	leaq	4(,%rax,4), %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	%rbp, %r12
+	jne	.L1725
+.L1724:
+	testq	%r13, %r13
+	je	.L1617
+	movq	40(%rsp), %rax
+	movq	56(%rsp), %rdi
+	movl	$8, %ecx
+	movq	%r13, %rsi
+	leaq	(%rax,%rax,2), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+	call	*24(%rax)
+.L1617:
+	addq	$1192, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L1623:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1851
+.L1626:
+	movq	_ZZN1n4heapEvE3res(%rip), %r12
+	movq	64(%rsp), %r15
+	pxor	%xmm0, %xmm0
+	xorl	%r14d, %r14d
+	movq	72(%rsp), %r13
+	movups	%xmm0, 88(%rsp)
+	movq	%r12, 80(%rsp)
+	leaq	0(%rbp,%r15), %rax
+	movq	$0, 104(%rsp)
+	cmpq	$5, %r13
+	je	.L1624
+.L1628:
+	leaq	0(,%r15,4), %rbx
+	leaq	(%r14,%rbx), %rcx
+	movq	%rbx, 8(%rsp)
+	cmpq	%rcx, %rdx
+	jnb	.L1852
+	subq	%r14, %rdx
+	movq	%rdx, 16(%rsp)
+	cmpq	%rax, %r13
+	jnb	.L1739
+	leaq	10(%r13,%r13), %rdx
+	movq	%r12, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$4, %edx
+	movq	%rax, %r15
+	leaq	4(,%rax,4), %rsi
+	movq	(%r12), %rax
+.LEHB75:
+	call	*16(%rax)
+	movq	%rax, %rbx
+	movq	8(%rsp), %rax
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	leaq	4(%rax), %rdx
+	call	memcpy@PLT
+	cmpq	$5, %r13
+	je	.L1634
+	movq	(%r12), %rax
+	movl	$4, %ecx
+	xorl	%esi, %esi
+	movq	%r12, %rdi
+	leaq	4(,%r13,4), %rdx
+	call	*24(%rax)
+.L1634:
+	movq	%rbx, 88(%rsp)
+	movq	%r15, %r13
+	movq	%r15, 72(%rsp)
+.L1633:
+	cmpq	$5, %r13
+	jne	.L1834
+	leaq	88(%rsp), %rbx
+.L1834:
+	movq	16(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L1636
+.L1852:
+	cmpq	%rax, %r13
+	jb	.L1736
+	movq	%r13, 16(%rsp)
+	xorl	%ebx, %ebx
+	cmpq	$5, 16(%rsp)
+	leaq	.LC55(%rip), %rsi
+	jne	.L1636
+.L1842:
+	leaq	88(%rsp), %rbx
+	jmp	.L1636
+	.p2align 4,,10
+	.p2align 3
+.L1701:
+	movl	%r8d, %eax
+	xorl	%ecx, %ecx
+	leaq	(%rax,%rax,4), %rax
+	leaq	0(%rbp,%rax,4), %r9
+	movl	(%r9), %eax
+	movl	4(%r9), %r10d
+	leaq	(%r12,%rax,8), %rsi
+	movq	%r10, %rdx
+	jmp	.L1706
+	.p2align 4,,10
+	.p2align 3
+.L1707:
+	leaq	(%rdx,%rcx), %rax
+	shrq	%rax
+	cmpl	(%rsi,%rax,8), %edi
+	jg	.L1853
+	movq	%rax, %rdx
+.L1706:
+	cmpq	%rdx, %rcx
+	jb	.L1707
+	cmpq	%r10, %rcx
+	jnb	.L1708
+	leaq	(%rsi,%rcx,8), %rax
+	cmpl	(%rax), %edi
+	jne	.L1708
+	movl	4(%rax), %edx
+	leal	-1(%rdx), %eax
+	cmpl	$-3, %eax
+	jbe	.L1709
+.L1708:
+	testl	%r8d, %r8d
+	je	.L1747
+	movl	8(%r9), %r8d
+	jmp	.L1711
+	.p2align 4,,10
+	.p2align 3
+.L1853:
+	leaq	1(%rax), %rcx
+	jmp	.L1706
+.L1709:
+	movl	%edx, %eax
+	leaq	(%rax,%rax,4), %rax
+	leaq	0(%rbp,%rax,4), %rax
+.L1710:
+	cmpl	$-1, 12(%rax)
+	movl	%edx, %r8d
+	jne	.L1713
+.L1704:
+	movl	16(%rax), %eax
+	movl	%r8d, %edx
+	cmpl	$-1, %eax
+	je	.L1712
+	movl	%eax, %r8d
+	jmp	.L1713
+.L1722:
+	addq	$1, %rbp
+	addq	$48, %rbx
+	cmpq	%rbp, %r12
+	jne	.L1725
+	jmp	.L1724
+.L1702:
+	movl	%edx, %eax
+	movl	%edx, %r8d
+	leaq	(%rax,%rax,4), %rax
+	leaq	0(%rbp,%rax,4), %rax
+	cmpl	$-1, 12(%rax)
+	jne	.L1713
+	jmp	.L1704
+.L1747:
+	movq	%rbp, %rax
+	xorl	%edx, %edx
+	jmp	.L1710
+.L1653:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1854
+.L1656:
+	movq	64(%rsp), %rax
+	movq	72(%rsp), %r13
+	pxor	%xmm0, %xmm0
+	xorl	%r15d, %r15d
+	movq	_ZZN1n4heapEvE3res(%rip), %r14
+	movq	48(%rsp), %r12
+	movups	%xmm0, 88(%rsp)
+	movq	%rax, 8(%rsp)
+	addq	%rbp, %rax
+	movq	%r14, 80(%rsp)
+	movq	$0, 104(%rsp)
+	cmpq	$5, %r13
+	je	.L1654
+.L1658:
+	movq	8(%rsp), %rbx
+	salq	$2, %rbx
+	leaq	(%r15,%rbx), %rcx
+	movq	%rbx, 16(%rsp)
+	cmpq	%rcx, %rdx
+	jnb	.L1855
+	subq	%r15, %rdx
+	movq	%rdx, 8(%rsp)
+	cmpq	%rax, %r13
+	jnb	.L1743
+	leaq	10(%r13,%r13), %rdx
+	movq	%r14, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$4, %edx
+	movq	%rax, 24(%rsp)
+	leaq	4(,%rax,4), %rsi
+	movq	(%r14), %rax
+	call	*16(%rax)
+	movq	%rax, %rbx
+	movq	16(%rsp), %rax
+	movq	%r15, %rsi
+	movq	%rbx, %rdi
+	leaq	4(%rax), %rdx
+	call	memcpy@PLT
+	cmpq	$5, %r13
+	je	.L1664
+	movq	(%r14), %rax
+	leaq	4(,%r13,4), %rdx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	movl	$4, %ecx
+	call	*24(%rax)
+.LEHE75:
+.L1664:
+	movq	24(%rsp), %rax
+	movq	%rbx, 88(%rsp)
+	movq	%rax, 72(%rsp)
+	movq	%rax, %r13
+.L1663:
+	cmpq	$5, %r13
+	jne	.L1837
+	leaq	88(%rsp), %rbx
+.L1837:
+	movq	8(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L1666
+.L1855:
+	cmpq	%rax, %r13
+	jb	.L1735
+	movq	%r13, 24(%rsp)
+	xorl	%ebx, %ebx
+	cmpq	$5, 24(%rsp)
+	leaq	.LC56(%rip), %rsi
+	jne	.L1666
+.L1847:
+	leaq	88(%rsp), %rbx
+	jmp	.L1666
+.L1848:
+	leaq	5(%r12), %rdx
+	movq	56(%rsp), %rdi
+	leaq	(%rdx,%rdx), %rax
+	movq	%rax, 40(%rsp)
+	addq	%rdx, %rax
+	movl	$8, %edx
+	salq	$5, %rax
+	movq	%rax, %rsi
+	movq	(%rdi), %rax
+.LEHB76:
+	call	*16(%rax)
+	leaq	(%r12,%r12,2), %r14
+	movdqa	.LC57(%rip), %xmm7
+	movq	%rax, 32(%rsp)
+	movq	%rax, %rdi
+	salq	$4, %r14
+	leaq	(%rax,%r14), %r13
+	movups	%xmm7, 0(%r13)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L1856
+.L1669:
+	pxor	%xmm0, %xmm0
+	movq	80(%rsp), %rax
+	cmpq	$5, 72(%rsp)
+	movq	$0, 40(%r13)
+	movups	%xmm0, 24(%r13)
+	movq	%rbp, %xmm0
+	movhps	72(%rsp), %xmm0
+	movq	%rax, 16(%r13)
+	movups	%xmm0, 0(%r13)
+	je	.L1857
+	movq	$5, 72(%rsp)
+	movq	88(%rsp), %rax
+	movq	%rax, 24(%r13)
+.L1673:
+	movq	$0, 64(%rsp)
+	movl	$0, 88(%rsp)
+	testq	%r12, %r12
+	jne	.L1858
+	testq	%rbx, %rbx
+	je	.L1676
+.L1675:
+	movq	56(%rsp), %rdi
+	movl	$8, %ecx
+	movq	%r14, %rdx
+	movq	%rbx, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE76:
+.L1676:
+	addq	$1, %r12
+	jmp	.L1681
+.L1843:
+	leaq	5(%r13), %rdx
+	movq	56(%rsp), %rdi
+	leaq	(%rdx,%rdx), %rax
+	movq	%rax, 40(%rsp)
+	addq	%rdx, %rax
+	movl	$8, %edx
+	salq	$5, %rax
+	movq	%rax, %rsi
+	movq	(%rdi), %rax
+.LEHB77:
+	call	*16(%rax)
+	leaq	0(%r13,%r13,2), %r13
+	movdqa	.LC57(%rip), %xmm2
+	movq	%rax, 32(%rsp)
+	movq	%rax, %rdi
+	salq	$4, %r13
+	addq	%rax, %r13
+	movups	%xmm2, 0(%r13)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L1859
+.L1639:
+	pxor	%xmm0, %xmm0
+	movq	80(%rsp), %rax
+	cmpq	$5, 72(%rsp)
+	movq	$0, 40(%r13)
+	movups	%xmm0, 24(%r13)
+	movq	%rbp, %xmm0
+	movhps	72(%rsp), %xmm0
+	movq	%rax, 16(%r13)
+	movups	%xmm0, 0(%r13)
+	je	.L1860
+	movq	$5, 72(%rsp)
+	movq	88(%rsp), %rax
+	movq	%rax, 24(%r13)
+.L1643:
+	movq	$0, 64(%rsp)
+	movl	$0, 88(%rsp)
+	testq	%r12, %r12
+	jne	.L1861
+	testq	%rbx, %rbx
+	je	.L1646
+.L1645:
+	movq	56(%rsp), %rdi
+	leaq	(%r14,%r14,2), %rdx
+	movl	$8, %ecx
+	movq	%rbx, %rsi
+	salq	$4, %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE77:
+.L1646:
+	addq	$1, %r12
+	jmp	.L1651
+.L1743:
+	xorl	%ebx, %ebx
+	jmp	.L1663
+.L1739:
+	xorl	%ebx, %ebx
+	jmp	.L1633
+.L1846:
+	movq	8(%rsp), %rax
+	leaq	.LC56(%rip), %rsi
+	salq	$2, %rax
+	movq	%rax, 16(%rsp)
+	jmp	.L1666
+.L1841:
+	leaq	0(,%r15,4), %rax
+	leaq	.LC55(%rip), %rsi
+	movq	%rax, 8(%rsp)
+	jmp	.L1636
+.L1682:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1862
+.L1685:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdx
+	pxor	%xmm0, %xmm0
+	movq	$0, 96(%rsp)
+	movups	%xmm0, 104(%rsp)
+	movq	%rdx, 88(%rsp)
+	testq	%rax, %rax
+	jne	.L1683
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1863
+.L1690:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdx
+	pxor	%xmm0, %xmm0
+	movq	$0, 128(%rsp)
+	movups	%xmm0, 136(%rsp)
+	movq	%rdx, 120(%rsp)
+	testq	%rax, %rax
+	jne	.L1688
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1864
+.L1693:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	jmp	.L1688
+.L1840:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1865
+.L1620:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r12
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	jmp	.L1618
+.L1863:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1690
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1690
+.L1862:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1685
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1685
+.L1864:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1693
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1693
+.L1865:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1620
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1620
+.L1861:
+	leaq	(%r12,%r12,2), %rdx
+	movq	%rbx, %rsi
+	salq	$4, %rdx
+	call	memcpy@PLT
+	jmp	.L1645
+.L1860:
+	movdqu	88(%rsp), %xmm3
+	movq	104(%rsp), %rax
+	movups	%xmm3, 24(%r13)
+	movq	%rax, 40(%r13)
+	jmp	.L1643
+.L1859:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1640
+.L1835:
+	movq	48(%rsp), %r12
+	movq	32(%rsp), %rdi
+	movq	64(%rsp), %rbp
+	jmp	.L1639
+.L1858:
+	leaq	(%r12,%r12,2), %rdx
+	movq	%rbx, %rsi
+	salq	$4, %rdx
+	call	memcpy@PLT
+	jmp	.L1675
+.L1856:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1670
+.L1838:
+	movq	48(%rsp), %r12
+	movq	32(%rsp), %rdi
+	movq	64(%rsp), %rbp
+	jmp	.L1669
+.L1857:
+	movdqu	88(%rsp), %xmm1
+	movq	104(%rsp), %rax
+	movups	%xmm1, 24(%r13)
+	movq	%rax, 40(%r13)
+	jmp	.L1673
+.L1850:
+	movdqu	88(%rsp), %xmm3
+	movq	104(%rsp), %rax
+	movq	48(%rsp), %r12
+	movq	%rax, 40(%rbx)
+	movups	%xmm3, 24(%rbx)
+	jmp	.L1676
+.L1849:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1678
+.L1839:
+	movq	64(%rsp), %rbp
+	jmp	.L1677
+.L1845:
+	movdqu	88(%rsp), %xmm5
+	movq	104(%rsp), %rax
+	movq	%r13, %r12
+	movq	%rax, 40(%rbx)
+	movups	%xmm5, 24(%rbx)
+	jmp	.L1646
+.L1851:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	leaq	.LC55(%rip), %rdx
+	testl	%eax, %eax
+	je	.L1626
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	leaq	.LC55(%rip), %rdx
+	jmp	.L1626
+.L1844:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1648
+.L1836:
+	movq	64(%rsp), %rbp
+	movq	48(%rsp), %r13
+	jmp	.L1647
+.L1854:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	leaq	.LC56(%rip), %rdx
+	testl	%eax, %eax
+	je	.L1656
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	leaq	.LC56(%rip), %rdx
+	jmp	.L1656
+.L1648:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1836
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1836
+.L1678:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1839
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1839
+.L1670:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1838
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1838
+.L1640:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1835
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1835
+.L1755:
+	movq	%rax, %rbx
+	jmp	.L1728
+.L1753:
+	movq	%rax, %rbx
+	jmp	.L1726
+.L1754:
+	movq	%rax, %rbx
+	jmp	.L1700
+.L1757:
+	movq	%rax, %rbx
+	jmp	.L1696
+	.section	.gcc_except_table
+.LLSDA6797:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6797-.LLSDACSB6797
+.LLSDACSB6797:
+	.uleb128 .LEHB73-.LFB6797
+	.uleb128 .LEHE73-.LEHB73
+	.uleb128 .L1754-.LFB6797
+	.uleb128 0
+	.uleb128 .LEHB74-.LFB6797
+	.uleb128 .LEHE74-.LEHB74
+	.uleb128 .L1757-.LFB6797
+	.uleb128 0
+	.uleb128 .LEHB75-.LFB6797
+	.uleb128 .LEHE75-.LEHB75
+	.uleb128 .L1754-.LFB6797
+	.uleb128 0
+	.uleb128 .LEHB76-.LFB6797
+	.uleb128 .LEHE76-.LEHB76
+	.uleb128 .L1755-.LFB6797
+	.uleb128 0
+	.uleb128 .LEHB77-.LFB6797
+	.uleb128 .LEHE77-.LEHB77
+	.uleb128 .L1753-.LFB6797
+	.uleb128 0
+.LLSDACSE6797:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6797
+	.type	_Z22test_aho_corasick_widev.cold, @function
+_Z22test_aho_corasick_widev.cold:
+.LFSB6797:
+.L1830:
+	.cfi_def_cfa_offset 1248
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC59(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB78:
+	call	__cxa_throw@PLT
+.LEHE78:
+.L1728:
+	movq	72(%rsp), %rax
+	cmpq	$5, %rax
+	je	.L1700
+	movq	80(%rsp), %rdi
+	movq	88(%rsp), %rsi
+	movl	$4, %ecx
+	leaq	4(,%rax,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L1700
+.L1756:
+	movq	%rax, %rbp
+	movq	%rbx, %rdi
+	call	_ZN1n12aho_corasickIwED1Ev
+	movq	%rbp, %rbx
+	jmp	.L1700
+.L1726:
+	movq	72(%rsp), %rax
+	cmpq	$5, %rax
+	je	.L1700
+	movq	80(%rsp), %rdi
+	movq	88(%rsp), %rsi
+	movl	$4, %ecx
+	leaq	4(,%rax,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1700:
+	movq	32(%rsp), %r14
+	movq	48(%rsp), %r13
+	xorl	%r12d, %r12d
+	movq	%r14, %rbp
+.L1731:
+	cmpq	%r12, %r13
+	je	.L1866
+	movq	8(%rbp), %rax
+	cmpq	$5, %rax
+	je	.L1732
+	movq	16(%rbp), %rdi
+	movq	24(%rbp), %rsi
+	movl	$4, %ecx
+	leaq	4(,%rax,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1732:
+	addq	$1, %r12
+	addq	$48, %rbp
+	jmp	.L1731
+.L1696:
+	movq	128(%rsp), %rsi
+	movq	136(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L1697
+	movq	152(%rsp), %rdi
+	salq	$3, %rdx
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1697:
+	movq	96(%rsp), %rsi
+	movq	104(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L1698
+	movq	120(%rsp), %rdi
+	salq	$3, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1698:
+	movq	64(%rsp), %rsi
+	movq	72(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L1700
+	movq	88(%rsp), %rdi
+	imulq	$20, %rdx, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L1700
+.L1866:
+	movq	40(%rsp), %rdx
+	testq	%r14, %r14
+	je	.L1734
+	movq	56(%rsp), %rdi
+	imulq	$48, %rdx, %rdx
+	movl	$8, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1734:
+	movq	%rbx, %rdi
+.LEHB79:
+	call	_Unwind_Resume@PLT
+.LEHE79:
+	.cfi_endproc
+.LFE6797:
+	.section	.gcc_except_table
+.LLSDAC6797:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6797-.LLSDACSBC6797
+.LLSDACSBC6797:
+	.uleb128 .LEHB78-.LCOLDB60
+	.uleb128 .LEHE78-.LEHB78
+	.uleb128 .L1756-.LCOLDB60
+	.uleb128 0
+	.uleb128 .LEHB79-.LCOLDB60
+	.uleb128 .LEHE79-.LEHB79
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6797:
+	.section	.text.unlikely
+	.text
+	.size	_Z22test_aho_corasick_widev, .-_Z22test_aho_corasick_widev
+	.section	.text.unlikely
+	.size	_Z22test_aho_corasick_widev.cold, .-_Z22test_aho_corasick_widev.cold
+.LCOLDE60:
+	.text
+.LHOTE60:
+	.weak	_ZTSN1n15memory_resourceE
+	.section	.rodata._ZTSN1n15memory_resourceE,"aG",@progbits,_ZTSN1n15memory_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n15memory_resourceE, @object
+	.size	_ZTSN1n15memory_resourceE, 22
+_ZTSN1n15memory_resourceE:
+	.string	"N1n15memory_resourceE"
+	.weak	_ZTIN1n15memory_resourceE
+	.section	.data.rel.ro._ZTIN1n15memory_resourceE,"awG",@progbits,_ZTIN1n15memory_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n15memory_resourceE, @object
+	.size	_ZTIN1n15memory_resourceE, 16
+_ZTIN1n15memory_resourceE:
+	.quad	_ZTVN10__cxxabiv117__class_type_infoE+16
+	.quad	_ZTSN1n15memory_resourceE
+	.weak	_ZTSN1n13heap_resourceE
+	.section	.rodata._ZTSN1n13heap_resourceE,"aG",@progbits,_ZTSN1n13heap_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n13heap_resourceE, @object
+	.size	_ZTSN1n13heap_resourceE, 20
+_ZTSN1n13heap_resourceE:
+	.string	"N1n13heap_resourceE"
+	.weak	_ZTIN1n13heap_resourceE
+	.section	.data.rel.ro._ZTIN1n13heap_resourceE,"awG",@progbits,_ZTIN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n13heap_resourceE, @object
+	.size	_ZTIN1n13heap_resourceE, 24
+_ZTIN1n13heap_resourceE:
+	.quad	_ZTVN10__cxxabiv120__si_class_type_infoE+16
+	.quad	_ZTSN1n13heap_resourceE
+	.quad	_ZTIN1n15memory_resourceE
+	.weak	_ZTVN1n13heap_resourceE
+	.section	.data.rel.ro.local._ZTVN1n13heap_resourceE,"awG",@progbits,_ZTVN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTVN1n13heap_resourceE, @object
+	.size	_ZTVN1n13heap_resourceE, 48
+_ZTVN1n13heap_resourceE:
+	.quad	0
+	.quad	_ZTIN1n13heap_resourceE
+	.quad	_ZN1n13heap_resourceD1Ev
+	.quad	_ZN1n13heap_resourceD0Ev
+	.quad	_ZN1n13heap_resource8allocateEmm
+	.quad	_ZN1n13heap_resource10deallocateEPvmm
+	.weak	_ZN1n18__current_resourceE
+	.section	.tbss._ZN1n18__current_resourceE,"awTG",@nobits,_ZN1n18__current_resourceE,comdat
+	.align 8
+	.type	_ZN1n18__current_resourceE, @gnu_unique_object
+	.size	_ZN1n18__current_resourceE, 8
+_ZN1n18__current_resourceE:
+	.zero	8
+	.weak	_ZGVZN1n4heapEvE3res
+	.section	.bss._ZGVZN1n4heapEvE3res,"awG",@nobits,_ZGVZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZGVZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZGVZN1n4heapEvE3res, 8
+_ZGVZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE3res
+	.section	.bss._ZZN1n4heapEvE3res,"awG",@nobits,_ZZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZZN1n4heapEvE3res, 8
+_ZZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE7storage
+	.section	.bss._ZZN1n4heapEvE7storage,"awG",@nobits,_ZZN1n4heapEvE7storage,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE7storage, @gnu_unique_object
+	.size	_ZZN1n4heapEvE7storage, 8
+_ZZN1n4heapEvE7storage:
+	.zero	8
+	.section	.rodata.cst2,"aM",@progbits,2
+	.align 2
+.LC1:
+	.byte	10
+	.byte	0
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC14:
+	.long	4
+	.long	100
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC16:
+	.quad	0
+	.quad	23
+	.align 16
+.LC57:
+	.quad	0
+	.quad	5
+	.hidden	DW.ref._ZTIPKc
+	.weak	DW.ref._ZTIPKc
+	.section	.data.rel.local.DW.ref._ZTIPKc,"awG",@progbits,DW.ref._ZTIPKc,comdat
+	.align 8
+	.type	DW.ref._ZTIPKc, @object
+	.size	DW.ref._ZTIPKc, 8
+DW.ref._ZTIPKc:
+	.quad	_ZTIPKc
+	.hidden	DW.ref.__gxx_personality_v0
+	.weak	DW.ref.__gxx_personality_v0
+	.section	.data.rel.local.DW.ref.__gxx_personality_v0,"awG",@progbits,DW.ref.__gxx_personality_v0,comdat
+	.align 8
+	.type	DW.ref.__gxx_personality_v0, @object
+	.size	DW.ref.__gxx_personality_v0, 8
+DW.ref.__gxx_personality_v0:
+	.quad	__gxx_personality_v0
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,8293 @@
+	.file	"tests-algorithm.cpp"
+	.text
+	.section	.text._ZN1n13heap_resourceD2Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD2Ev
+	.type	_ZN1n13heap_resourceD2Ev, @function
+_ZN1n13heap_resourceD2Ev:
+.LFB7006:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7006:
+	.size	_ZN1n13heap_resourceD2Ev, .-_ZN1n13heap_resourceD2Ev
+	.weak	_ZN1n13heap_resourceD1Ev
+	.set	_ZN1n13heap_resourceD1Ev,_ZN1n13heap_resourceD2Ev
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"abcdef"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC1:
+	.string	"expected equal : expected value : visited, actual value : 2"
+	.section	.rodata.str1.1
+.LC2:
+	.string	"bbcbbb"
+	.section	.rodata.str1.8
+	.align 8
+.LC3:
+	.string	"expected equal : expected value : visited, actual value : 3"
+	.align 8
+.LC4:
+	.string	"expected false : n::all_of(n::cstring_iterator(\"bbcbbb\"), is_b)"
+	.align 8
+.LC5:
+	.string	"expected false : n::none_of(n::cstring_iterator(\"abcdef\"), is_b)"
+	.align 8
+.LC6:
+	.string	"expected true : n::any_of(n::cstring_iterator(\"abcdef\"), is_b)"
+	.section	.text.unlikely,"ax",@progbits
+.LCOLDB7:
+	.text
+.LHOTB7:
+	.p2align 4
+	.globl	_Z29test_predicates_short_circuitv
+	.type	_Z29test_predicates_short_circuitv, @function
+_Z29test_predicates_short_circuitv:
+.LFB6818:
+	.cfi_startproc
+	leaq	.LC0(%rip), %rax
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	xorl	%esi, %esi
+	movq	%rax, %rdx
+	jmp	.L4
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	addl	$1, %esi
+	addq	$1, %rdx
+	cmpb	$98, %cl
+	je	.L5
+.L4:
+	movzbl	(%rdx), %ecx
+	testb	%cl, %cl
+	jne	.L6
+	jmp	.L21
+	.p2align 4,,10
+	.p2align 3
+.L5:
+	cmpl	$2, %esi
+	jne	.L19
+	xorl	%ecx, %ecx
+	jmp	.L20
+	.p2align 4,,10
+	.p2align 3
+.L9:
+	addl	$1, %ecx
+	addq	$1, %rax
+	cmpb	$98, %dl
+	je	.L8
+.L20:
+	movzbl	(%rax), %edx
+	testb	%dl, %dl
+	jne	.L9
+	jmp	.L22
+	.p2align 4,,10
+	.p2align 3
+.L8:
+	cmpl	$2, %ecx
+	jne	.L27
+	leaq	.LC2(%rip), %rax
+	xorl	%ecx, %ecx
+	jmp	.L11
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	addl	$1, %ecx
+	addq	$1, %rax
+	cmpb	$98, %dl
+	jne	.L12
+.L11:
+	movzbl	(%rax), %edx
+	testb	%dl, %dl
+	jne	.L13
+	jmp	.L23
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	cmpl	$3, %ecx
+	jne	.L28
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.L28:
+	.cfi_restore_state
+	jmp	.L15
+.L27:
+	jmp	.L17
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.type	_Z29test_predicates_short_circuitv.cold, @function
+_Z29test_predicates_short_circuitv.cold:
+.LFSB6818:
+.L21:
+	.cfi_def_cfa_offset 16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC6(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L23:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC4(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L22:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC5(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L19:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC1(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L15:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC3(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L17:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC1(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.cfi_endproc
+.LFE6818:
+	.text
+	.size	_Z29test_predicates_short_circuitv, .-_Z29test_predicates_short_circuitv
+	.section	.text.unlikely
+	.size	_Z29test_predicates_short_circuitv.cold, .-_Z29test_predicates_short_circuitv.cold
+.LCOLDE7:
+	.text
+.LHOTE7:
+	.section	.text._ZN1n13heap_resource10deallocateEPvmm,"axG",@progbits,_ZN1n13heap_resource10deallocateEPvmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource10deallocateEPvmm
+	.type	_ZN1n13heap_resource10deallocateEPvmm, @function
+_ZN1n13heap_resource10deallocateEPvmm:
+.LFB6536:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rcx
+	jbe	.L30
+	movq	%rcx, %rsi
+	jmp	_ZdlPvSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L30:
+	jmp	_ZdlPv@PLT
+	.cfi_endproc
+.LFE6536:
+	.size	_ZN1n13heap_resource10deallocateEPvmm, .-_ZN1n13heap_resource10deallocateEPvmm
+	.section	.text._ZN1n13heap_resource8allocateEmm,"axG",@progbits,_ZN1n13heap_resource8allocateEmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource8allocateEmm
+	.type	_ZN1n13heap_resource8allocateEmm, @function
+_ZN1n13heap_resource8allocateEmm:
+.LFB6535:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rdx
+	jbe	.L32
+	movq	%rdx, %rsi
+	jmp	_ZnwmSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L32:
+	jmp	_Znwm@PLT
+	.cfi_endproc
+.LFE6535:
+	.size	_ZN1n13heap_resource8allocateEmm, .-_ZN1n13heap_resource8allocateEmm
+	.section	.text._ZN1n13heap_resourceD0Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD0Ev
+	.type	_ZN1n13heap_resourceD0Ev, @function
+_ZN1n13heap_resourceD0Ev:
+.LFB7008:
+	.cfi_startproc
+	movl	$8, %esi
+	jmp	_ZdlPvm@PLT
+	.cfi_endproc
+.LFE7008:
+	.size	_ZN1n13heap_resourceD0Ev, .-_ZN1n13heap_resourceD0Ev
+	.section	.rodata.str1.1
+.LC8:
+	.string	"expected false : all"
+	.section	.text.unlikely
+.LCOLDB9:
+	.text
+.LHOTB9:
+	.p2align 4
+	.globl	_Z23test_try_for_each_stopsv
+	.type	_Z23test_try_for_each_stopsv, @function
+_Z23test_try_for_each_stopsv:
+.LFB6814:
+	.cfi_startproc
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	leaq	.LC0(%rip), %rax
+	xorl	%ecx, %ecx
+	jmp	.L35
+	.p2align 4,,10
+	.p2align 3
+.L37:
+	addl	$1, %ecx
+	addq	$1, %rax
+	cmpb	$99, %dl
+	je	.L36
+.L35:
+	movzbl	(%rax), %edx
+	testb	%dl, %dl
+	jne	.L37
+	jmp	.L41
+	.p2align 4,,10
+	.p2align 3
+.L36:
+	cmpl	$3, %ecx
+	jne	.L44
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.L44:
+	.cfi_restore_state
+	jmp	.L39
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.type	_Z23test_try_for_each_stopsv.cold, @function
+_Z23test_try_for_each_stopsv.cold:
+.LFSB6814:
+.L41:
+	.cfi_def_cfa_offset 16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC8(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L39:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC3(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.cfi_endproc
+.LFE6814:
+	.text
+	.size	_Z23test_try_for_each_stopsv, .-_Z23test_try_for_each_stopsv
+	.section	.text.unlikely
+	.size	_Z23test_try_for_each_stopsv.cold, .-_Z23test_try_for_each_stopsv.cold
+.LCOLDE9:
+	.text
+.LHOTE9:
+	.p2align 4
+	.globl	_Z9test_skipv
+	.type	_Z9test_skipv, @function
+_Z9test_skipv:
+.LFB6809:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE6809:
+	.size	_Z9test_skipv, .-_Z9test_skipv
+	.section	.rodata.str1.1
+.LC10:
+	.string	"Hello world"
+	.section	.rodata.str1.8
+	.align 8
+.LC12:
+	.string	"expected equal : expected value : n::find(s.iter(), [](char c) { return c == ' '; }), actual value : 5"
+	.section	.text.unlikely
+.LCOLDB14:
+	.text
+.LHOTB14:
+	.p2align 4
+	.globl	_Z19test_find_predicatev
+	.type	_Z19test_find_predicatev, @function
+_Z19test_find_predicatev:
+.LFB6773:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6773
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	movdqa	.LC11(%rip), %xmm0
+	movaps	%xmm0, 16(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L47
+	pxor	%xmm0, %xmm0
+	leaq	40(%rsp), %r14
+	movq	%rax, 32(%rsp)
+	xorl	%r13d, %r13d
+	leaq	.LC10(%rip), %r12
+	movups	%xmm0, 40(%rsp)
+	movq	$0, 56(%rsp)
+	cmpq	%r14, %r12
+	jb	.L77
+.L96:
+	leaq	.LC10(%rip), %rsi
+.L99:
+	movq	%r14, %rbx
+.L48:
+	leaq	(%rbx,%r13), %rdi
+	movl	$11, %edx
+	call	memmove@PLT
+	movq	16(%rsp), %rax
+	leaq	40(%rsp), %rcx
+	leaq	11(%rax), %rdx
+	movq	%rdx, 16(%rsp)
+	movb	$0, 11(%rbx,%rax)
+	movq	24(%rsp), %rbx
+	movq	16(%rsp), %rdx
+	cmpq	$23, %rbx
+	je	.L61
+	movq	40(%rsp), %rcx
+.L61:
+	subq	$1, %rdx
+	movq	$-1, %rax
+	jmp	.L62
+	.p2align 4,,10
+	.p2align 3
+.L101:
+	addq	$1, %rax
+	cmpb	$32, (%rcx,%rax)
+	je	.L100
+.L62:
+	cmpq	%rdx, %rax
+	jne	.L101
+	jmp	.L63
+	.p2align 4,,10
+	.p2align 3
+.L100:
+	cmpq	$5, %rax
+	jne	.L102
+	cmpq	$23, %rbx
+	je	.L46
+	movq	32(%rsp), %rdi
+	movq	40(%rsp), %rsi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L46:
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L77:
+	.cfi_restore_state
+	movq	%r12, %rsi
+	jmp	.L99
+	.p2align 4,,10
+	.p2align 3
+.L47:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L103
+.L52:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	16(%rsp), %r13
+	pxor	%xmm0, %xmm0
+	movq	$0, 56(%rsp)
+	movq	24(%rsp), %rbp
+	movups	%xmm0, 40(%rsp)
+	leaq	.LC10(%rip), %r12
+	movq	%r15, 32(%rsp)
+	leaq	11(%r13), %rax
+	movq	$0, 8(%rsp)
+	cmpq	$23, %rbp
+	je	.L104
+.L54:
+	movq	8(%rsp), %r14
+	leaq	(%r14,%r13), %rdx
+	cmpq	%rdx, %r12
+	jnb	.L105
+	movq	8(%rsp), %rsi
+	subq	%rsi, %r12
+	cmpq	%rax, %rbp
+	jnb	.L74
+	leaq	10(%rbp,%rbp), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %r14
+	movq	(%r15), %rax
+.LEHB0:
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %rbp
+	je	.L58
+	movq	(%r15), %rax
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L58:
+	movq	%rbx, 40(%rsp)
+	movq	%r14, %rbp
+	movq	%r14, 24(%rsp)
+.L57:
+	leaq	(%rbx,%r12), %rsi
+	cmpq	$23, %rbp
+	jne	.L48
+	leaq	40(%rsp), %r14
+	leaq	(%r14,%r12), %rsi
+	jmp	.L99
+.L105:
+	cmpq	%rax, %rbp
+	jnb	.L73
+	leaq	10(%rbp,%rbp), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %r12
+	movq	(%r15), %rax
+	call	*16(%rax)
+	leaq	1(%r13), %rdx
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %rbp
+	je	.L56
+	movq	(%r15), %rax
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L56:
+	movq	%rbx, 40(%rsp)
+	movq	%r12, 24(%rsp)
+.L50:
+	leaq	.LC10(%rip), %rsi
+	cmpq	$23, %r12
+	jne	.L48
+	leaq	40(%rsp), %r14
+	jmp	.L96
+.L103:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L52
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L52
+.L73:
+	xorl	%ebx, %ebx
+	movq	%rbp, %r12
+	jmp	.L50
+.L74:
+	xorl	%ebx, %ebx
+	jmp	.L57
+.L104:
+	leaq	40(%rsp), %r14
+	cmpq	%r14, %r12
+	jnb	.L106
+	cmpq	$23, %rax
+	jbe	.L77
+	movl	$56, %edx
+	movq	%r15, %rdi
+	cmpq	%rdx, %rax
+	cmovnb	%rax, %rdx
+	movq	(%r15), %rax
+	leaq	1(%rdx), %rsi
+	movq	%rdx, %rbp
+	movl	$1, %edx
+	call	*16(%rax)
+.LEHE0:
+	movq	%r14, %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rbx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	%rbx, 40(%rsp)
+	movq	%r12, %rsi
+	movq	%rbp, 24(%rsp)
+	jmp	.L48
+.L106:
+	movq	%r14, 8(%rsp)
+	jmp	.L54
+.L102:
+	jmp	.L63
+	.globl	__gxx_personality_v0
+	.section	.gcc_except_table,"a",@progbits
+.LLSDA6773:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6773-.LLSDACSB6773
+.LLSDACSB6773:
+	.uleb128 .LEHB0-.LFB6773
+	.uleb128 .LEHE0-.LEHB0
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6773:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6773
+	.type	_Z19test_find_predicatev.cold, @function
+_Z19test_find_predicatev.cold:
+.LFSB6773:
+.L63:
+	.cfi_def_cfa_offset 128
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC12(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB1:
+	call	__cxa_throw@PLT
+.LEHE1:
+.L78:
+	movq	%rax, %rbp
+	cmpq	$23, %rbx
+	je	.L68
+	movq	32(%rsp), %rdi
+	movq	40(%rsp), %rsi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L68:
+	movq	%rbp, %rdi
+.LEHB2:
+	call	_Unwind_Resume@PLT
+.LEHE2:
+	.cfi_endproc
+.LFE6773:
+	.section	.gcc_except_table
+.LLSDAC6773:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6773-.LLSDACSBC6773
+.LLSDACSBC6773:
+	.uleb128 .LEHB1-.LCOLDB14
+	.uleb128 .LEHE1-.LEHB1
+	.uleb128 .L78-.LCOLDB14
+	.uleb128 0
+	.uleb128 .LEHB2-.LCOLDB14
+	.uleb128 .LEHE2-.LEHB2
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6773:
+	.section	.text.unlikely
+	.text
+	.size	_Z19test_find_predicatev, .-_Z19test_find_predicatev
+	.section	.text.unlikely
+	.size	_Z19test_find_predicatev.cold, .-_Z19test_find_predicatev.cold
+.LCOLDE14:
+	.text
+.LHOTE14:
+	.section	.rodata.str1.8
+	.align 8
+.LC15:
+	.string	"expected equal : expected value : i.len(), actual value : 2"
+	.align 8
+.LC16:
+	.string	"expected equal : expected value : i.next(), actual value : 'e'"
+	.section	.text.unlikely
+.LCOLDB17:
+	.text
+.LHOTB17:
+	.p2align 4
+	.globl	_Z12test_advancev
+	.type	_Z12test_advancev, @function
+_Z12test_advancev:
+.LFB6799:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6799
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	movdqa	.LC11(%rip), %xmm0
+	movaps	%xmm0, 16(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L108
+	pxor	%xmm0, %xmm0
+	leaq	40(%rsp), %r13
+	movq	%rax, 32(%rsp)
+	xorl	%r12d, %r12d
+	leaq	.LC0(%rip), %rbp
+	movups	%xmm0, 40(%rsp)
+	movq	$0, 56(%rsp)
+	cmpq	%r13, %rbp
+	jb	.L136
+.L156:
+	leaq	.LC0(%rip), %rsi
+.L158:
+	movq	%r13, %rbx
+.L109:
+	leaq	(%rbx,%r12), %rdi
+	movl	$6, %edx
+	call	memmove@PLT
+	movq	16(%rsp), %rax
+	leaq	40(%rsp), %rcx
+	leaq	6(%rax), %rdx
+	movq	%rdx, 16(%rsp)
+	movb	$0, 6(%rbx,%rax)
+	movq	24(%rsp), %rbx
+	movq	16(%rsp), %rax
+	cmpq	$23, %rbx
+	je	.L122
+	movq	40(%rsp), %rcx
+.L122:
+	movl	$4, %edx
+	cmpq	%rdx, %rax
+	cmovbe	%rax, %rdx
+	subq	%rdx, %rax
+	addq	%rdx, %rcx
+	cmpq	$2, %rax
+	jne	.L154
+	cmpb	$101, (%rcx)
+	jne	.L155
+	cmpq	$23, %rbx
+	je	.L107
+	movq	32(%rsp), %rdi
+	movq	40(%rsp), %rsi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L107:
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L136:
+	.cfi_restore_state
+	movq	%rbp, %rsi
+	jmp	.L158
+	.p2align 4,,10
+	.p2align 3
+.L108:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L159
+.L113:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	16(%rsp), %r12
+	pxor	%xmm0, %xmm0
+	xorl	%r13d, %r13d
+	movq	24(%rsp), %r14
+	movups	%xmm0, 40(%rsp)
+	leaq	.LC0(%rip), %rbp
+	movq	%r15, 32(%rsp)
+	leaq	6(%r12), %rax
+	movq	$0, 56(%rsp)
+	cmpq	$23, %r14
+	je	.L160
+.L115:
+	leaq	0(%r13,%r12), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L161
+	subq	%r13, %rbp
+	movq	%rbp, 8(%rsp)
+	cmpq	%rax, %r14
+	jnb	.L133
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %rbp
+	movq	(%r15), %rax
+.LEHB3:
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L119
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L119:
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, %r14
+	movq	%rbp, 24(%rsp)
+.L118:
+	cmpq	$23, %r14
+	je	.L120
+	movq	8(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L109
+.L161:
+	cmpq	%rax, %r14
+	jnb	.L132
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %rbp
+	movq	(%r15), %rax
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L117
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L117:
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, 24(%rsp)
+.L111:
+	leaq	.LC0(%rip), %rsi
+	cmpq	$23, %rbp
+	jne	.L109
+	leaq	40(%rsp), %r13
+	jmp	.L156
+.L159:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L113
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L113
+.L132:
+	xorl	%ebx, %ebx
+	movq	%r14, %rbp
+	jmp	.L111
+.L133:
+	xorl	%ebx, %ebx
+	jmp	.L118
+.L120:
+	movq	8(%rsp), %rsi
+	leaq	40(%rsp), %r13
+	addq	%r13, %rsi
+	jmp	.L158
+.L160:
+	leaq	40(%rsp), %r13
+	cmpq	%r13, %rbp
+	jnb	.L115
+	cmpq	$23, %rax
+	jbe	.L136
+	movl	$56, %edx
+	movq	%r15, %rdi
+	cmpq	%rdx, %rax
+	cmovnb	%rax, %rdx
+	movq	(%r15), %rax
+	leaq	1(%rdx), %rsi
+	movq	%rdx, %r14
+	movl	$1, %edx
+	call	*16(%rax)
+.LEHE3:
+	movq	%r13, %rsi
+	leaq	1(%r12), %rdx
+	movq	%rax, %rbx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, %rsi
+	movq	%r14, 24(%rsp)
+	jmp	.L109
+	.section	.gcc_except_table
+.LLSDA6799:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6799-.LLSDACSB6799
+.LLSDACSB6799:
+	.uleb128 .LEHB3-.LFB6799
+	.uleb128 .LEHE3-.LEHB3
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6799:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6799
+	.type	_Z12test_advancev.cold, @function
+_Z12test_advancev.cold:
+.LFSB6799:
+.L154:
+	.cfi_def_cfa_offset 128
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC15(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB4:
+	call	__cxa_throw@PLT
+.L155:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC16(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE4:
+.L137:
+	movq	%rax, %rbp
+	cmpq	$23, %rbx
+	je	.L127
+	movq	32(%rsp), %rdi
+	movq	40(%rsp), %rsi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L127:
+	movq	%rbp, %rdi
+.LEHB5:
+	call	_Unwind_Resume@PLT
+.LEHE5:
+	.cfi_endproc
+.LFE6799:
+	.section	.gcc_except_table
+.LLSDAC6799:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6799-.LLSDACSBC6799
+.LLSDACSBC6799:
+	.uleb128 .LEHB4-.LCOLDB17
+	.uleb128 .LEHE4-.LEHB4
+	.uleb128 .L137-.LCOLDB17
+	.uleb128 0
+	.uleb128 .LEHB5-.LCOLDB17
+	.uleb128 .LEHE5-.LEHB5
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6799:
+	.section	.text.unlikely
+	.text
+	.size	_Z12test_advancev, .-_Z12test_advancev
+	.section	.text.unlikely
+	.size	_Z12test_advancev.cold, .-_Z12test_advancev.cold
+.LCOLDE17:
+	.text
+.LHOTE17:
+	.section	.rodata.str1.8
+	.align 8
+.LC18:
+	.string	"expected equal : expected value : n::find(s.iter(), 'o'), actual value : 4"
+	.align 8
+.LC19:
+	.string	"expected equal : expected value : n::find(s.iter(), 'z'), actual value : n::size_t(-1)"
+	.section	.text.unlikely
+.LCOLDB20:
+	.text
+.LHOTB20:
+	.p2align 4
+	.globl	_Z15test_find_valuev
+	.type	_Z15test_find_valuev, @function
+_Z15test_find_valuev:
+.LFB6763:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6763
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	movdqa	.LC11(%rip), %xmm0
+	movaps	%xmm0, 16(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L163
+	pxor	%xmm0, %xmm0
+	leaq	40(%rsp), %r13
+	movq	%rax, 32(%rsp)
+	xorl	%r12d, %r12d
+	leaq	.LC10(%rip), %rbp
+	movups	%xmm0, 40(%rsp)
+	movq	$0, 56(%rsp)
+	cmpq	%r13, %rbp
+	jb	.L192
+.L220:
+	leaq	.LC10(%rip), %rsi
+.L222:
+	movq	%r13, %rbx
+.L164:
+	leaq	(%rbx,%r12), %rdi
+	movl	$11, %edx
+	leaq	40(%rsp), %rbp
+	call	memmove@PLT
+	movq	16(%rsp), %rax
+	leaq	11(%rax), %rdx
+	movq	%rdx, 16(%rsp)
+	movb	$0, 11(%rbx,%rax)
+	movq	24(%rsp), %rbx
+	movq	16(%rsp), %r12
+	cmpq	$23, %rbx
+	je	.L177
+	movq	40(%rsp), %rbp
+.L177:
+	movq	%r12, %rdx
+	movl	$111, %esi
+	movq	%rbp, %rdi
+	call	memchr@PLT
+	testq	%rax, %rax
+	je	.L178
+	subq	%rbp, %rax
+	cmpq	$4, %rax
+	jne	.L178
+	movq	%r12, %rdx
+	movl	$122, %esi
+	movq	%rbp, %rdi
+	call	memchr@PLT
+	testq	%rax, %rax
+	je	.L180
+	subq	%rbp, %rax
+	cmpq	$-1, %rax
+	jne	.L219
+.L180:
+	cmpq	$23, %rbx
+	je	.L162
+	movq	32(%rsp), %rdi
+	movq	40(%rsp), %rsi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L162:
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L192:
+	.cfi_restore_state
+	movq	%rbp, %rsi
+	jmp	.L222
+	.p2align 4,,10
+	.p2align 3
+.L163:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L223
+.L168:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	16(%rsp), %r12
+	pxor	%xmm0, %xmm0
+	xorl	%r13d, %r13d
+	movq	24(%rsp), %r14
+	movups	%xmm0, 40(%rsp)
+	leaq	.LC10(%rip), %rbp
+	movq	%r15, 32(%rsp)
+	leaq	11(%r12), %rax
+	movq	$0, 56(%rsp)
+	cmpq	$23, %r14
+	je	.L224
+.L170:
+	leaq	0(%r13,%r12), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L225
+	subq	%r13, %rbp
+	movq	%rbp, 8(%rsp)
+	cmpq	%rax, %r14
+	jnb	.L189
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %rbp
+	movq	(%r15), %rax
+.LEHB6:
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L174
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L174:
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, %r14
+	movq	%rbp, 24(%rsp)
+.L173:
+	cmpq	$23, %r14
+	je	.L175
+	movq	8(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L164
+.L225:
+	cmpq	%rax, %r14
+	jnb	.L188
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %rbp
+	movq	(%r15), %rax
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L172
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L172:
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, 24(%rsp)
+.L166:
+	leaq	.LC10(%rip), %rsi
+	cmpq	$23, %rbp
+	jne	.L164
+	leaq	40(%rsp), %r13
+	jmp	.L220
+.L223:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L168
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L168
+.L188:
+	xorl	%ebx, %ebx
+	movq	%r14, %rbp
+	jmp	.L166
+.L189:
+	xorl	%ebx, %ebx
+	jmp	.L173
+.L175:
+	movq	8(%rsp), %rsi
+	leaq	40(%rsp), %r13
+	addq	%r13, %rsi
+	jmp	.L222
+.L224:
+	leaq	40(%rsp), %r13
+	cmpq	%r13, %rbp
+	jnb	.L170
+	cmpq	$23, %rax
+	jbe	.L192
+	movl	$56, %edx
+	movq	%r15, %rdi
+	cmpq	%rdx, %rax
+	cmovnb	%rax, %rdx
+	movq	(%r15), %rax
+	leaq	1(%rdx), %rsi
+	movq	%rdx, %r14
+	movl	$1, %edx
+	call	*16(%rax)
+.LEHE6:
+	movq	%r13, %rsi
+	leaq	1(%r12), %rdx
+	movq	%rax, %rbx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, %rsi
+	movq	%r14, 24(%rsp)
+	jmp	.L164
+	.section	.gcc_except_table
+.LLSDA6763:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6763-.LLSDACSB6763
+.LLSDACSB6763:
+	.uleb128 .LEHB6-.LFB6763
+	.uleb128 .LEHE6-.LEHB6
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6763:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6763
+	.type	_Z15test_find_valuev.cold, @function
+_Z15test_find_valuev.cold:
+.LFSB6763:
+.L178:
+	.cfi_def_cfa_offset 128
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC18(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB7:
+	call	__cxa_throw@PLT
+.L219:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC19(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE7:
+.L193:
+	movq	%rax, %rbp
+	cmpq	$23, %rbx
+	je	.L183
+	movq	32(%rsp), %rdi
+	movq	40(%rsp), %rsi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L183:
+	movq	%rbp, %rdi
+.LEHB8:
+	call	_Unwind_Resume@PLT
+.LEHE8:
+	.cfi_endproc
+.LFE6763:
+	.section	.gcc_except_table
+.LLSDAC6763:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6763-.LLSDACSBC6763
+.LLSDACSBC6763:
+	.uleb128 .LEHB7-.LCOLDB20
+	.uleb128 .LEHE7-.LEHB7
+	.uleb128 .L193-.LCOLDB20
+	.uleb128 0
+	.uleb128 .LEHB8-.LCOLDB20
+	.uleb128 .LEHE8-.LEHB8
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6763:
+	.section	.text.unlikely
+	.text
+	.size	_Z15test_find_valuev, .-_Z15test_find_valuev
+	.section	.text.unlikely
+	.size	_Z15test_find_valuev.cold, .-_Z15test_find_valuev.cold
+.LCOLDE20:
+	.text
+.LHOTE20:
+	.section	.rodata.str1.1
+.LC21:
+	.string	"abc"
+	.section	.rodata.str1.8
+	.align 8
+.LC22:
+	.string	"expected true : n::starts_with(s.iter(), n::slice_of(\"ab\"))"
+	.align 8
+.LC23:
+	.string	"expected false : n::starts_with(s.iter(), n::slice_of(\"abcd\"))"
+	.align 8
+.LC24:
+	.string	"expected false : n::starts_with(n::slice_of(\"ab\"), s.iter())"
+	.section	.text.unlikely
+.LCOLDB25:
+	.text
+.LHOTB25:
+	.p2align 4
+	.globl	_Z16test_starts_withv
+	.type	_Z16test_starts_withv, @function
+_Z16test_starts_withv:
+.LFB6797:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6797
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	movdqa	.LC11(%rip), %xmm0
+	movaps	%xmm0, 16(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L227
+	pxor	%xmm0, %xmm0
+	leaq	40(%rsp), %r13
+	movq	%rax, 32(%rsp)
+	xorl	%r12d, %r12d
+	leaq	.LC21(%rip), %rbp
+	movups	%xmm0, 40(%rsp)
+	movq	$0, 56(%rsp)
+	cmpq	%r13, %rbp
+	jb	.L257
+.L278:
+	leaq	.LC21(%rip), %rsi
+.L280:
+	movq	%r13, %rbx
+.L228:
+	leaq	(%rbx,%r12), %rdi
+	movl	$3, %edx
+	call	memmove@PLT
+	movq	16(%rsp), %rax
+	leaq	3(%rax), %rdx
+	movq	%rdx, 16(%rsp)
+	leaq	40(%rsp), %rdx
+	movb	$0, 3(%rbx,%rax)
+	movq	24(%rsp), %rbx
+	movq	16(%rsp), %rax
+	cmpq	$23, %rbx
+	je	.L241
+	movq	40(%rsp), %rdx
+.L241:
+	cmpq	$1, %rax
+	jbe	.L242
+	cmpw	$25185, (%rdx)
+	jne	.L242
+	cmpq	$3, %rax
+	jbe	.L244
+	cmpl	$1684234849, (%rdx)
+	je	.L277
+.L245:
+	cmpq	$23, %rbx
+	je	.L226
+	movq	32(%rsp), %rdi
+	movq	40(%rsp), %rsi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L226:
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L244:
+	.cfi_restore_state
+	cmpq	$2, %rax
+	jne	.L245
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC24(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB9:
+	call	__cxa_throw@PLT
+.LEHE9:
+	.p2align 4,,10
+	.p2align 3
+.L257:
+	movq	%rbp, %rsi
+	jmp	.L280
+	.p2align 4,,10
+	.p2align 3
+.L227:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L281
+.L232:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	16(%rsp), %r12
+	pxor	%xmm0, %xmm0
+	xorl	%r13d, %r13d
+	movq	24(%rsp), %r14
+	movups	%xmm0, 40(%rsp)
+	leaq	.LC21(%rip), %rbp
+	movq	%r15, 32(%rsp)
+	leaq	3(%r12), %rax
+	movq	$0, 56(%rsp)
+	cmpq	$23, %r14
+	je	.L282
+.L234:
+	leaq	0(%r13,%r12), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L283
+	subq	%r13, %rbp
+	movq	%rbp, 8(%rsp)
+	cmpq	%rax, %r14
+	jnb	.L254
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %rbp
+	movq	(%r15), %rax
+.LEHB10:
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L238
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L238:
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, %r14
+	movq	%rbp, 24(%rsp)
+.L237:
+	cmpq	$23, %r14
+	je	.L239
+	movq	8(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L228
+.L283:
+	cmpq	%rax, %r14
+	jnb	.L253
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %rbp
+	movq	(%r15), %rax
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L236
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L236:
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, 24(%rsp)
+.L230:
+	leaq	.LC21(%rip), %rsi
+	cmpq	$23, %rbp
+	jne	.L228
+	leaq	40(%rsp), %r13
+	jmp	.L278
+.L281:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L232
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L232
+.L253:
+	xorl	%ebx, %ebx
+	movq	%r14, %rbp
+	jmp	.L230
+.L254:
+	xorl	%ebx, %ebx
+	jmp	.L237
+.L239:
+	movq	8(%rsp), %rsi
+	leaq	40(%rsp), %r13
+	addq	%r13, %rsi
+	jmp	.L280
+.L282:
+	leaq	40(%rsp), %r13
+	cmpq	%r13, %rbp
+	jnb	.L234
+	cmpq	$23, %rax
+	jbe	.L257
+	movl	$56, %edx
+	movq	%r15, %rdi
+	cmpq	%rdx, %rax
+	cmovnb	%rax, %rdx
+	movq	(%r15), %rax
+	leaq	1(%rdx), %rsi
+	movq	%rdx, %r14
+	movl	$1, %edx
+	call	*16(%rax)
+.LEHE10:
+	movq	%r13, %rsi
+	leaq	1(%r12), %rdx
+	movq	%rax, %rbx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, %rsi
+	movq	%r14, 24(%rsp)
+	jmp	.L228
+.L275:
+	jmp	.L276
+	.section	.gcc_except_table
+.LLSDA6797:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6797-.LLSDACSB6797
+.LLSDACSB6797:
+	.uleb128 .LEHB9-.LFB6797
+	.uleb128 .LEHE9-.LEHB9
+	.uleb128 .L275-.LFB6797
+	.uleb128 0
+	.uleb128 .LEHB10-.LFB6797
+	.uleb128 .LEHE10-.LEHB10
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6797:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6797
+	.type	_Z16test_starts_withv.cold, @function
+_Z16test_starts_withv.cold:
+.LFSB6797:
+.L242:
+	.cfi_def_cfa_offset 128
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC22(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB11:
+	call	__cxa_throw@PLT
+.L277:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC23(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE11:
+.L258:
+.L276:
+	movq	%rax, %rbp
+	cmpq	$23, %rbx
+	je	.L248
+	movq	32(%rsp), %rdi
+	movq	40(%rsp), %rsi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L248:
+	movq	%rbp, %rdi
+.LEHB12:
+	call	_Unwind_Resume@PLT
+.LEHE12:
+	.cfi_endproc
+.LFE6797:
+	.section	.gcc_except_table
+.LLSDAC6797:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6797-.LLSDACSBC6797
+.LLSDACSBC6797:
+	.uleb128 .LEHB11-.LCOLDB25
+	.uleb128 .LEHE11-.LEHB11
+	.uleb128 .L258-.LCOLDB25
+	.uleb128 0
+	.uleb128 .LEHB12-.LCOLDB25
+	.uleb128 .LEHE12-.LEHB12
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6797:
+	.section	.text.unlikely
+	.text
+	.size	_Z16test_starts_withv, .-_Z16test_starts_withv
+	.section	.text.unlikely
+	.size	_Z16test_starts_withv.cold, .-_Z16test_starts_withv.cold
+.LCOLDE25:
+	.text
+.LHOTE25:
+	.section	.rodata.str1.8
+	.align 8
+.LC26:
+	.string	"expected true : n::equal(s.iter(), n::slice_of(\"abc\"))"
+	.align 8
+.LC27:
+	.string	"expected true : n::equal(s.iter(), n::cstring_iterator(\"abc\"))"
+	.section	.text.unlikely
+.LCOLDB28:
+	.text
+.LHOTB28:
+	.p2align 4
+	.globl	_Z10test_equalv
+	.type	_Z10test_equalv, @function
+_Z10test_equalv:
+.LFB6791:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6791
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	movdqa	.LC11(%rip), %xmm0
+	movaps	%xmm0, 16(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L285
+	pxor	%xmm0, %xmm0
+	leaq	40(%rsp), %r14
+	movq	%rax, 32(%rsp)
+	xorl	%r13d, %r13d
+	leaq	.LC21(%rip), %r12
+	movups	%xmm0, 40(%rsp)
+	movq	$0, 56(%rsp)
+	cmpq	%r14, %r12
+	jb	.L317
+.L335:
+	leaq	.LC21(%rip), %rsi
+.L339:
+	movq	%r14, %rbx
+.L286:
+	leaq	(%rbx,%r13), %rdi
+	movl	$3, %edx
+	call	memmove@PLT
+	movq	16(%rsp), %rax
+	leaq	3(%rax), %rdx
+	movq	%rdx, 16(%rsp)
+	movb	$0, 3(%rbx,%rax)
+	movq	24(%rsp), %rbx
+	leaq	40(%rsp), %rax
+	movq	16(%rsp), %rdx
+	cmpq	$23, %rbx
+	je	.L299
+	movq	40(%rsp), %rax
+.L299:
+	cmpq	$3, %rdx
+	jne	.L300
+	cmpw	$25185, (%rax)
+	jne	.L300
+	cmpb	$99, 2(%rax)
+	jne	.L300
+	cmpb	$97, (%rax)
+	jne	.L340
+	cmpb	$98, 1(%rax)
+	jne	.L304
+	cmpq	$23, %rbx
+	je	.L284
+	movq	32(%rsp), %rdi
+	movq	40(%rsp), %rsi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L284:
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L317:
+	.cfi_restore_state
+	movq	%r12, %rsi
+	jmp	.L339
+	.p2align 4,,10
+	.p2align 3
+.L285:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L341
+.L290:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	16(%rsp), %r13
+	pxor	%xmm0, %xmm0
+	movq	$0, 56(%rsp)
+	movq	24(%rsp), %rbp
+	movups	%xmm0, 40(%rsp)
+	leaq	.LC21(%rip), %r12
+	movq	%r15, 32(%rsp)
+	leaq	3(%r13), %rax
+	movq	$0, 8(%rsp)
+	cmpq	$23, %rbp
+	je	.L342
+.L292:
+	movq	8(%rsp), %r14
+	leaq	(%r14,%r13), %rdx
+	cmpq	%rdx, %r12
+	jnb	.L343
+	movq	8(%rsp), %rcx
+	subq	%rcx, %r12
+	cmpq	%rax, %rbp
+	jnb	.L314
+	leaq	10(%rbp,%rbp), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %r14
+	movq	(%r15), %rax
+.LEHB13:
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %rbp
+	je	.L296
+	movq	(%r15), %rax
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L296:
+	movq	%rbx, 40(%rsp)
+	movq	%r14, %rbp
+	movq	%r14, 24(%rsp)
+.L295:
+	leaq	(%rbx,%r12), %rsi
+	cmpq	$23, %rbp
+	jne	.L286
+	leaq	40(%rsp), %r14
+	leaq	(%r14,%r12), %rsi
+	jmp	.L339
+.L343:
+	cmpq	%rax, %rbp
+	jnb	.L313
+	leaq	10(%rbp,%rbp), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %r12
+	movq	(%r15), %rax
+	call	*16(%rax)
+	leaq	1(%r13), %rdx
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %rbp
+	je	.L294
+	movq	(%r15), %rax
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L294:
+	movq	%rbx, 40(%rsp)
+	movq	%r12, 24(%rsp)
+.L288:
+	leaq	.LC21(%rip), %rsi
+	cmpq	$23, %r12
+	jne	.L286
+	leaq	40(%rsp), %r14
+	jmp	.L335
+.L341:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L290
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L290
+.L313:
+	xorl	%ebx, %ebx
+	movq	%rbp, %r12
+	jmp	.L288
+.L314:
+	xorl	%ebx, %ebx
+	jmp	.L295
+.L342:
+	leaq	40(%rsp), %r14
+	cmpq	%r14, %r12
+	jnb	.L344
+	cmpq	$23, %rax
+	jbe	.L317
+	movl	$56, %edx
+	movq	%r15, %rdi
+	cmpq	%rdx, %rax
+	cmovnb	%rax, %rdx
+	movq	(%r15), %rax
+	leaq	1(%rdx), %rsi
+	movq	%rdx, %rbp
+	movl	$1, %edx
+	call	*16(%rax)
+.LEHE13:
+	movq	%r14, %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rbx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	%rbx, 40(%rsp)
+	movq	%r12, %rsi
+	movq	%rbp, 24(%rsp)
+	jmp	.L286
+.L344:
+	movq	%r14, 8(%rsp)
+	jmp	.L292
+.L340:
+	jmp	.L304
+	.section	.gcc_except_table
+.LLSDA6791:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6791-.LLSDACSB6791
+.LLSDACSB6791:
+	.uleb128 .LEHB13-.LFB6791
+	.uleb128 .LEHE13-.LEHB13
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6791:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6791
+	.type	_Z10test_equalv.cold, @function
+_Z10test_equalv.cold:
+.LFSB6791:
+.L304:
+	.cfi_def_cfa_offset 128
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC27(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB14:
+	call	__cxa_throw@PLT
+.L300:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC26(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE14:
+.L318:
+	movq	%rax, %rbp
+	cmpq	$23, %rbx
+	je	.L308
+	movq	32(%rsp), %rdi
+	movq	40(%rsp), %rsi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L308:
+	movq	%rbp, %rdi
+.LEHB15:
+	call	_Unwind_Resume@PLT
+.LEHE15:
+	.cfi_endproc
+.LFE6791:
+	.section	.gcc_except_table
+.LLSDAC6791:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6791-.LLSDACSBC6791
+.LLSDACSBC6791:
+	.uleb128 .LEHB14-.LCOLDB28
+	.uleb128 .LEHE14-.LEHB14
+	.uleb128 .L318-.LCOLDB28
+	.uleb128 0
+	.uleb128 .LEHB15-.LCOLDB28
+	.uleb128 .LEHE15-.LEHB15
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6791:
+	.section	.text.unlikely
+	.text
+	.size	_Z10test_equalv, .-_Z10test_equalv
+	.section	.text.unlikely
+	.size	_Z10test_equalv.cold, .-_Z10test_equalv.cold
+.LCOLDE28:
+	.text
+.LHOTE28:
+	.section	.rodata.str1.8
+	.align 8
+.LC29:
+	.string	"a string long enough to live on the heap"
+	.align 8
+.LC30:
+	.string	"expected true : d.iter() == s.iter()"
+	.align 8
+.LC31:
+	.string	"expected equal : expected value : buffer[3], actual value : 't'"
+	.section	.text.unlikely
+.LCOLDB32:
+	.text
+.LHOTB32:
+	.p2align 4
+	.globl	_Z14test_copy_bulkv
+	.type	_Z14test_copy_bulkv, @function
+_Z14test_copy_bulkv:
+.LFB6801:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6801
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$152, %rsp
+	.cfi_def_cfa_offset 208
+	movdqa	.LC11(%rip), %xmm1
+	movaps	%xmm1, 48(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r13
+	testq	%r13, %r13
+	je	.L346
+	pxor	%xmm0, %xmm0
+	leaq	72(%rsp), %r15
+	movq	%r13, 64(%rsp)
+	xorl	%r12d, %r12d
+	leaq	.LC29(%rip), %rsi
+	movups	%xmm0, 72(%rsp)
+	movq	$0, 88(%rsp)
+	cmpq	%r15, %rsi
+	jnb	.L390
+	movl	$40, %eax
+.L348:
+	movl	$56, %edx
+	movq	%r13, %rdi
+	cmpq	%rdx, %rax
+	cmovnb	%rax, %rdx
+	movq	0(%r13), %rax
+	leaq	1(%rdx), %rsi
+	movq	%rdx, %rbp
+	movl	$1, %edx
+.LEHB16:
+	call	*16(%rax)
+.LEHE16:
+	movq	%r15, %rsi
+	leaq	1(%r12), %rdx
+	movq	%rax, %rbx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	%rbx, 72(%rsp)
+	leaq	.LC29(%rip), %rsi
+	movq	%rbp, 56(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L359:
+	movl	$40, %edx
+	leaq	(%rbx,%r12), %rdi
+	call	memmove@PLT
+	movq	48(%rsp), %rax
+	movdqa	.LC11(%rip), %xmm2
+	leaq	40(%rax), %rdx
+	movaps	%xmm2, 96(%rsp)
+	movq	%rdx, 48(%rsp)
+	movb	$0, 40(%rbx,%rax)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbp
+	testq	%rbp, %rbp
+	je	.L449
+	movq	56(%rsp), %r12
+	pxor	%xmm0, %xmm0
+	movq	%rbp, 112(%rsp)
+	movq	48(%rsp), %r13
+	movups	%xmm0, 120(%rsp)
+	movq	$0, 136(%rsp)
+	cmpq	$23, %r12
+	je	.L403
+	movq	$0, (%rsp)
+	movq	72(%rsp), %r15
+	movq	%r13, %rax
+.L389:
+	leaq	120(%rsp), %rbx
+	cmpq	%rbx, %r15
+	jnb	.L450
+	cmpq	$23, %rax
+	jbe	.L401
+	movq	%rbx, 8(%rsp)
+	movl	$23, %r14d
+.L388:
+	leaq	10(%r14,%r14), %rdx
+	movq	%rbp, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 16(%rsp)
+	leaq	1(%rax), %rsi
+	movq	0(%rbp), %rax
+.LEHB17:
+	call	*16(%rax)
+	movq	%rax, %rbx
+	movq	(%rsp), %rax
+	movq	8(%rsp), %rsi
+	movq	%rbx, %rdi
+	leaq	1(%rax), %rdx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L370
+	movq	0(%rbp), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%rbp, %rdi
+	call	*24(%rax)
+.LEHE17:
+.L370:
+	movq	16(%rsp), %rax
+	cmpq	$23, 16(%rsp)
+	movq	%rbx, 120(%rsp)
+	movq	%r15, %r14
+	movq	%rax, 104(%rsp)
+	je	.L451
+.L374:
+	movq	(%rsp), %rdi
+	movq	%r13, %rdx
+	movq	%r15, %rsi
+	addq	%rbx, %rdi
+	call	memmove@PLT
+	movq	96(%rsp), %rax
+	leaq	120(%rsp), %rdi
+	addq	%r13, %rax
+	movq	%rax, 96(%rsp)
+	movb	$0, (%rbx,%rax)
+	movq	104(%rsp), %rbp
+	movq	96(%rsp), %rbx
+	cmpq	$23, %rbp
+	je	.L376
+	movq	120(%rsp), %rdi
+.L376:
+	cmpq	%r13, %rbx
+	jne	.L377
+	testq	%rbx, %rbx
+	je	.L379
+	movq	%rbx, %rdx
+	movq	%r14, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L377
+	movl	$4, %eax
+	leaq	44(%rsp), %rcx
+	cmpq	%rax, %rbx
+	cmova	%rax, %rbx
+	movl	%ebx, %esi
+	testl	%ebx, %ebx
+	je	.L379
+	xorl	%eax, %eax
+.L380:
+	movl	%eax, %edx
+	addl	$1, %eax
+	movzbl	(%r14,%rdx), %edi
+	movb	%dil, (%rcx,%rdx)
+	cmpl	%esi, %eax
+	jb	.L380
+.L379:
+	cmpb	$116, 47(%rsp)
+	jne	.L446
+	cmpq	$23, %rbp
+	je	.L383
+	movq	112(%rsp), %rdi
+	movq	120(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L383:
+	cmpq	$23, %r12
+	je	.L345
+	movq	64(%rsp), %rdi
+	movq	72(%rsp), %rsi
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L345:
+	addq	$152, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L403:
+	.cfi_restore_state
+	movq	$0, (%rsp)
+	movq	%r13, %rax
+	leaq	72(%rsp), %r15
+	jmp	.L389
+	.p2align 4,,10
+	.p2align 3
+.L401:
+	movq	%r15, %r14
+	jmp	.L374
+.L450:
+	movq	%rbx, 8(%rsp)
+	movl	$23, %r14d
+.L366:
+	movq	8(%rsp), %rcx
+	movq	(%rsp), %rsi
+	leaq	(%rcx,%rsi), %rdx
+	cmpq	%rdx, %r15
+	jnb	.L452
+	movq	%rcx, %rsi
+	movq	%r15, %rcx
+	subq	%rsi, %rcx
+	movq	%rcx, 16(%rsp)
+	cmpq	%rax, %r14
+	jnb	.L398
+	leaq	10(%r14,%r14), %rdx
+	movq	%rbp, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	0(%rbp), %rax
+.LEHB18:
+	call	*16(%rax)
+	movq	%rax, %rbx
+	movq	(%rsp), %rax
+	movq	8(%rsp), %rsi
+	movq	%rbx, %rdi
+	leaq	1(%rax), %rdx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L372
+	movq	0(%rbp), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%rbp, %rdi
+	call	*24(%rax)
+.LEHE18:
+.L372:
+	movq	24(%rsp), %rax
+	movq	%rbx, 120(%rsp)
+	movq	%rax, 104(%rsp)
+	movq	%rax, %r14
+.L371:
+	cmpq	$23, %r14
+	jne	.L448
+	leaq	120(%rsp), %rbx
+.L448:
+	movq	16(%rsp), %rax
+	movq	%r15, %r14
+	leaq	(%rbx,%rax), %r15
+	jmp	.L374
+	.p2align 4,,10
+	.p2align 3
+.L452:
+	cmpq	%rax, %r14
+	jb	.L388
+	movq	%r14, 16(%rsp)
+	xorl	%ebx, %ebx
+	cmpq	$23, 16(%rsp)
+	movq	%r15, %r14
+	jne	.L374
+.L451:
+	leaq	120(%rsp), %rbx
+	jmp	.L374
+	.p2align 4,,10
+	.p2align 3
+.L449:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L453
+.L363:
+	movq	_ZZN1n4heapEvE3res(%rip), %rbp
+	movq	96(%rsp), %rax
+	pxor	%xmm0, %xmm0
+	movq	$0, 136(%rsp)
+	movq	56(%rsp), %r12
+	movq	104(%rsp), %r14
+	movups	%xmm0, 120(%rsp)
+	leaq	72(%rsp), %r15
+	movq	%rax, (%rsp)
+	movq	48(%rsp), %r13
+	movq	%rbp, 112(%rsp)
+	cmpq	$23, %r12
+	je	.L365
+	movq	72(%rsp), %r15
+.L365:
+	movq	$0, 8(%rsp)
+	movq	(%rsp), %rax
+	addq	%r13, %rax
+	cmpq	$23, %r14
+	jne	.L366
+	jmp	.L389
+	.p2align 4,,10
+	.p2align 3
+.L346:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L454
+.L350:
+	movq	_ZZN1n4heapEvE3res(%rip), %r13
+	movq	48(%rsp), %r12
+	pxor	%xmm0, %xmm0
+	xorl	%r15d, %r15d
+	movq	56(%rsp), %r14
+	movups	%xmm0, 72(%rsp)
+	leaq	.LC29(%rip), %rsi
+	movq	%r13, 64(%rsp)
+	leaq	40(%r12), %rax
+	movq	$0, 88(%rsp)
+	cmpq	$23, %r14
+	je	.L455
+.L347:
+	leaq	(%r15,%r12), %rdx
+	cmpq	%rdx, %rsi
+	jnb	.L456
+	subq	%r15, %rsi
+	xorl	%ebx, %ebx
+	movq	%rsi, (%rsp)
+	cmpq	%rax, %r14
+	jnb	.L356
+	leaq	10(%r14,%r14), %rdx
+	movq	%r13, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %rbp
+	movq	0(%r13), %rax
+.LEHB19:
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L357
+	movq	0(%r13), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r13, %rdi
+	call	*24(%rax)
+.L357:
+	movq	%rbx, 72(%rsp)
+	movq	%rbp, %r14
+	movq	%rbp, 56(%rsp)
+.L356:
+	cmpq	$23, %r14
+	je	.L358
+	movq	(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L359
+	.p2align 4,,10
+	.p2align 3
+.L456:
+	cmpq	%rax, %r14
+	jnb	.L392
+	leaq	10(%r14,%r14), %rdx
+	movq	%r13, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %rbp
+	movq	0(%r13), %rax
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L355
+	movq	0(%r13), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r13, %rdi
+	call	*24(%rax)
+.LEHE19:
+.L355:
+	movq	%rbx, 72(%rsp)
+	movq	%rbp, 56(%rsp)
+.L354:
+	leaq	.LC29(%rip), %rsi
+	cmpq	$23, %rbp
+	jne	.L359
+	leaq	72(%rsp), %r15
+.L402:
+	movq	%r15, %rbx
+	jmp	.L359
+	.p2align 4,,10
+	.p2align 3
+.L390:
+	movl	$23, %r14d
+	movl	$40, %eax
+	jmp	.L347
+	.p2align 4,,10
+	.p2align 3
+.L392:
+	movq	%r14, %rbp
+	xorl	%ebx, %ebx
+	jmp	.L354
+.L398:
+	xorl	%ebx, %ebx
+	jmp	.L371
+.L358:
+	movq	(%rsp), %rsi
+	leaq	72(%rsp), %r15
+	addq	%r15, %rsi
+	jmp	.L402
+.L453:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L363
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L363
+.L454:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L350
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L350
+.L455:
+	leaq	72(%rsp), %r15
+	cmpq	%r15, %rsi
+	jnb	.L347
+	cmpq	$23, %rax
+	ja	.L348
+	jmp	.L402
+.L444:
+	jmp	.L445
+	.section	.gcc_except_table
+.LLSDA6801:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6801-.LLSDACSB6801
+.LLSDACSB6801:
+	.uleb128 .LEHB16-.LFB6801
+	.uleb128 .LEHE16-.LEHB16
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB17-.LFB6801
+	.uleb128 .LEHE17-.LEHB17
+	.uleb128 .L444-.LFB6801
+	.uleb128 0
+	.uleb128 .LEHB18-.LFB6801
+	.uleb128 .LEHE18-.LEHB18
+	.uleb128 .L444-.LFB6801
+	.uleb128 0
+	.uleb128 .LEHB19-.LFB6801
+	.uleb128 .LEHE19-.LEHB19
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6801:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6801
+	.type	_Z14test_copy_bulkv.cold, @function
+_Z14test_copy_bulkv.cold:
+.LFSB6801:
+.L446:
+	.cfi_def_cfa_offset 208
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC31(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB20:
+	call	__cxa_throw@PLT
+.L377:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC30(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE20:
+.L404:
+.L445:
+	movq	%rax, %rbx
+	movq	104(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L386
+	movq	112(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	120(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L386:
+	cmpq	$23, %r12
+	je	.L387
+	movq	64(%rsp), %rdi
+	movq	72(%rsp), %rsi
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L387:
+	movq	%rbx, %rdi
+.LEHB21:
+	call	_Unwind_Resume@PLT
+.LEHE21:
+	.cfi_endproc
+.LFE6801:
+	.section	.gcc_except_table
+.LLSDAC6801:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6801-.LLSDACSBC6801
+.LLSDACSBC6801:
+	.uleb128 .LEHB20-.LCOLDB32
+	.uleb128 .LEHE20-.LEHB20
+	.uleb128 .L404-.LCOLDB32
+	.uleb128 0
+	.uleb128 .LEHB21-.LCOLDB32
+	.uleb128 .LEHE21-.LEHB21
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6801:
+	.section	.text.unlikely
+	.text
+	.size	_Z14test_copy_bulkv, .-_Z14test_copy_bulkv
+	.section	.text.unlikely
+	.size	_Z14test_copy_bulkv.cold, .-_Z14test_copy_bulkv.cold
+.LCOLDE32:
+	.text
+.LHOTE32:
+	.section	.rodata._ZN1n4test10test_suite7run_allEv.str1.1,"aMS",@progbits,1
+.LC33:
+	.string	"\nSUITE [%s] "
+.LC35:
+	.string	"%s"
+.LC36:
+	.string	"\nTEST [%s] "
+.LC37:
+	.string	" - Result : \033[1;32mPASSED\033[0m"
+.LC38:
+	.string	"\033[1;31merror : %s\033[0m\n"
+.LC39:
+	.string	" - Result : \033[1;31mFAILED\033[0m"
+.LC40:
+	.string	" - Passed : \033[1;32m%d\033[0m\n"
+.LC41:
+	.string	" - Failed : \033[1;31m%d\033[0m\n"
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4test10test_suite7run_allEv
+	.type	_ZN1n4test10test_suite7run_allEv, @function
+_ZN1n4test10test_suite7run_allEv:
+.LFB6762:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6762
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	leaq	.LC33(%rip), %rdx
+	movl	$79, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	16(%rdi), %rcx
+	leaq	16(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L458
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L459
+	testb	$4, %cl
+	jne	.L512
+	testl	%ecx, %ecx
+	je	.L458
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L513
+	.p2align 4,,10
+	.p2align 3
+.L458:
+	movzwl	.LC34(%rip), %r15d
+	movq	%rbx, %rsi
+	leaq	.LC35(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+.LEHB22:
+	call	printf@PLT
+	movl	8(%r12), %esi
+	testl	%esi, %esi
+	jle	.L479
+	movl	$0, 12(%rsp)
+	xorl	%ebp, %ebp
+	xorl	%r14d, %r14d
+	jmp	.L473
+	.p2align 4,,10
+	.p2align 3
+.L516:
+	testb	$4, %dl
+	jne	.L514
+	testl	%edx, %edx
+	je	.L464
+	movb	$42, (%rax)
+	testb	$2, %dl
+	jne	.L515
+	.p2align 4,,10
+	.p2align 3
+.L464:
+	movq	%rbx, %rsi
+	leaq	.LC35(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+.LEHE22:
+	movq	(%r12), %rax
+.LEHB23:
+	call	*8(%rax,%r13)
+.LEHE23:
+	leaq	.LC37(%rip), %rdi
+	addl	$1, %r14d
+.LEHB24:
+	call	puts@PLT
+.L469:
+	addq	$1, %rbp
+	cmpl	%ebp, 8(%r12)
+	jle	.L463
+.L473:
+	movq	(%r12), %rax
+	movq	%rbp, %r13
+	movq	%rbx, %rdi
+	movl	$79, %esi
+	salq	$4, %r13
+	leaq	.LC36(%rip), %rdx
+	movq	(%rax,%r13), %rcx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L464
+	movl	$79, %edx
+	subl	%eax, %edx
+	addq	%rbx, %rax
+	cmpl	$8, %edx
+	jb	.L516
+	movabsq	$3038287259199220266, %rsi
+	leaq	8(%rax), %rdi
+	movl	%edx, %ecx
+	andq	$-8, %rdi
+	movq	%rsi, (%rax)
+	movq	%rsi, -8(%rax,%rcx)
+	subq	%rdi, %rax
+	leal	(%rdx,%rax), %ecx
+	movq	%rsi, %rax
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L464
+.L479:
+	movl	$0, 12(%rsp)
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L463:
+	movabsq	$5917806138674729738, %rax
+	movq	%rbx, %rdi
+	movq	%rax, 16(%rsp)
+	movabsq	$9095440486453792, %rax
+	movq	%rax, 22(%rsp)
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L474
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L475
+	testb	$4, %cl
+	jne	.L517
+	testl	%ecx, %ecx
+	je	.L474
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L518
+.L474:
+	movq	%rbx, %rsi
+	leaq	.LC35(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+	movl	%r14d, %esi
+	leaq	.LC40(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	12(%rsp), %esi
+	leaq	.LC41(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	$10, %edi
+	call	putchar@PLT
+.LEHE24:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L475:
+	.cfi_restore_state
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L474
+.L459:
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L458
+.L514:
+	movl	$707406378, (%rax)
+	movl	$707406378, -4(%rax,%rdx)
+	jmp	.L464
+.L515:
+	movl	$10794, %ecx
+	movw	%cx, -2(%rax,%rdx)
+	jmp	.L464
+.L513:
+	movl	$10794, %edi
+	movw	%di, -2(%rdx,%rcx)
+	jmp	.L458
+.L518:
+	movl	$10794, %eax
+	movw	%ax, -2(%rdx,%rcx)
+	jmp	.L474
+.L512:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L458
+.L517:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L474
+.L480:
+	movq	%rax, %rdi
+	movq	%rdx, %rax
+.L470:
+	subq	$1, %rax
+	jne	.L511
+	call	__cxa_begin_catch@PLT
+	leaq	.LC38(%rip), %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+.LEHB25:
+	call	printf@PLT
+.LEHE25:
+	call	__cxa_end_catch@PLT
+	leaq	.LC39(%rip), %rdi
+	addl	$1, 12(%rsp)
+.LEHB26:
+	call	puts@PLT
+	jmp	.L469
+.L472:
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+.L511:
+	call	_Unwind_Resume@PLT
+.LEHE26:
+.L481:
+	movq	%rax, %rbx
+	jmp	.L472
+	.cfi_endproc
+.LFE6762:
+	.section	.gcc_except_table
+	.align 4
+.LLSDA6762:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT6762-.LLSDATTD6762
+.LLSDATTD6762:
+	.byte	0x1
+	.uleb128 .LLSDACSE6762-.LLSDACSB6762
+.LLSDACSB6762:
+	.uleb128 .LEHB22-.LFB6762
+	.uleb128 .LEHE22-.LEHB22
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB23-.LFB6762
+	.uleb128 .LEHE23-.LEHB23
+	.uleb128 .L480-.LFB6762
+	.uleb128 0x1
+	.uleb128 .LEHB24-.LFB6762
+	.uleb128 .LEHE24-.LEHB24
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB25-.LFB6762
+	.uleb128 .LEHE25-.LEHB25
+	.uleb128 .L481-.LFB6762
+	.uleb128 0
+	.uleb128 .LEHB26-.LFB6762
+	.uleb128 .LEHE26-.LEHB26
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6762:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	DW.ref._ZTIPKc-.
+.LLSDATT6762:
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.size	_ZN1n4test10test_suite7run_allEv, .-_ZN1n4test10test_suite7run_allEv
+	.section	.rodata.str1.1
+.LC42:
+	.string	"n::algorithm tests"
+.LC43:
+	.string	"test_find_value"
+.LC44:
+	.string	"test_find_predicate"
+.LC45:
+	.string	"test_count"
+.LC46:
+	.string	"test_contains"
+.LC47:
+	.string	"test_equal"
+.LC48:
+	.string	"test_starts_with"
+.LC49:
+	.string	"test_advance"
+.LC50:
+	.string	"test_copy_bulk"
+.LC51:
+	.string	"test_skip"
+.LC52:
+	.string	"test_try_for_each_stops"
+.LC53:
+	.string	"test_predicates_short_circuit"
+.LC54:
+	.string	"test_find_subsequence"
+	.section	.rodata.str1.8
+	.align 8
+.LC55:
+	.string	"test_find_subsequence_long_needle"
+	.section	.rodata.str1.1
+.LC56:
+	.string	"test_find_subsequence_ints"
+.LC57:
+	.string	"test_next_chunk"
+	.section	.text.unlikely
+.LCOLDB59:
+	.section	.text.startup,"ax",@progbits
+.LHOTB59:
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB6875:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6875
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$1600, %edi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 64
+.LEHB27:
+	call	_Znam@PLT
+.LEHE27:
+	movq	%rax, %rbx
+	leaq	1600(%rax), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L520:
+	movq	$0, (%rax)
+	addq	$16, %rax
+	movq	$0, -8(%rax)
+	cmpq	%rax, %rdx
+	jne	.L520
+	leaq	.LC42(%rip), %rax
+	movq	%rbx, (%rsp)
+	movq	%rsp, %rdi
+	movq	%rax, 16(%rsp)
+	leaq	.LC43(%rip), %rax
+	movq	%rax, (%rbx)
+	leaq	_Z15test_find_valuev(%rip), %rax
+	movq	%rax, 8(%rbx)
+	leaq	.LC44(%rip), %rax
+	movq	%rax, 16(%rbx)
+	leaq	_Z19test_find_predicatev(%rip), %rax
+	movq	%rax, 24(%rbx)
+	leaq	.LC45(%rip), %rax
+	movq	%rax, 32(%rbx)
+	leaq	_Z10test_countv(%rip), %rax
+	movq	%rax, 40(%rbx)
+	leaq	.LC46(%rip), %rax
+	movq	%rax, 48(%rbx)
+	leaq	_Z13test_containsv(%rip), %rax
+	movq	%rax, 56(%rbx)
+	leaq	.LC47(%rip), %rax
+	movq	%rax, 64(%rbx)
+	leaq	_Z10test_equalv(%rip), %rax
+	movq	%rax, 72(%rbx)
+	leaq	.LC48(%rip), %rax
+	movq	%rax, 80(%rbx)
+	leaq	_Z16test_starts_withv(%rip), %rax
+	movq	%rax, 88(%rbx)
+	leaq	.LC49(%rip), %rax
+	movq	%rax, 96(%rbx)
+	leaq	_Z12test_advancev(%rip), %rax
+	movq	%rax, 104(%rbx)
+	leaq	.LC50(%rip), %rax
+	movq	%rax, 112(%rbx)
+	leaq	_Z14test_copy_bulkv(%rip), %rax
+	movq	%rax, 120(%rbx)
+	leaq	.LC51(%rip), %rax
+	movq	%rax, 128(%rbx)
+	leaq	_Z9test_skipv(%rip), %rax
+	movq	%rax, 136(%rbx)
+	leaq	.LC52(%rip), %rax
+	movq	%rax, 144(%rbx)
+	leaq	_Z23test_try_for_each_stopsv(%rip), %rax
+	movq	%rax, 152(%rbx)
+	leaq	.LC53(%rip), %rax
+	movq	%rax, 160(%rbx)
+	leaq	_Z29test_predicates_short_circuitv(%rip), %rax
+	movq	%rax, 168(%rbx)
+	leaq	.LC54(%rip), %rax
+	movq	%rax, 176(%rbx)
+	leaq	_Z21test_find_subsequencev(%rip), %rax
+	movq	%rax, 184(%rbx)
+	leaq	.LC55(%rip), %rax
+	movq	%rax, 192(%rbx)
+	leaq	_Z33test_find_subsequence_long_needlev(%rip), %rax
+	movq	%rax, 200(%rbx)
+	leaq	.LC56(%rip), %rax
+	movq	%rax, 208(%rbx)
+	leaq	_Z26test_find_subsequence_intsv(%rip), %rax
+	movq	%rax, 216(%rbx)
+	leaq	.LC57(%rip), %rax
+	movq	%rax, 224(%rbx)
+	leaq	_Z15test_next_chunkv(%rip), %rax
+	movq	%rax, 232(%rbx)
+	movq	.LC58(%rip), %rax
+	movq	%rax, 8(%rsp)
+.LEHB28:
+	call	_ZN1n4test10test_suite7run_allEv
+.LEHE28:
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L522:
+	.cfi_restore_state
+	movq	%rax, %rbp
+	jmp	.L521
+	.section	.gcc_except_table
+.LLSDA6875:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6875-.LLSDACSB6875
+.LLSDACSB6875:
+	.uleb128 .LEHB27-.LFB6875
+	.uleb128 .LEHE27-.LEHB27
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB28-.LFB6875
+	.uleb128 .LEHE28-.LEHB28
+	.uleb128 .L522-.LFB6875
+	.uleb128 0
+.LLSDACSE6875:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6875
+	.type	main.cold, @function
+main.cold:
+.LFSB6875:
+.L521:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	movq	%rbp, %rdi
+.LEHB29:
+	call	_Unwind_Resume@PLT
+.LEHE29:
+	.cfi_endproc
+.LFE6875:
+	.section	.gcc_except_table
+.LLSDAC6875:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6875-.LLSDACSBC6875
+.LLSDACSBC6875:
+	.uleb128 .LEHB29-.LCOLDB59
+	.uleb128 .LEHE29-.LEHB29
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6875:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	main, .-main
+	.section	.text.unlikely
+	.size	main.cold, .-main.cold
+.LCOLDE59:
+	.section	.text.startup
+.LHOTE59:
+	.section	.text._ZN1n12__horspool_nIcEEmPKT_mS3_m,"axG",@progbits,_ZN1n12__horspool_nIcEEmPKT_mS3_m,comdat
+	.p2align 4
+	.weak	_ZN1n12__horspool_nIcEEmPKT_mS3_m
+	.type	_ZN1n12__horspool_nIcEEmPKT_mS3_m, @function
+_ZN1n12__horspool_nIcEEmPKT_mS3_m:
+.LFB6914:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rcx, %xmm0
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	punpcklqdq	%xmm0, %xmm0
+	movq	%rdx, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rsi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rcx, %rbx
+	subq	$2072, %rsp
+	.cfi_def_cfa_offset 2128
+	leaq	16(%rsp), %rax
+	leaq	2064(%rsp), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L528:
+	movaps	%xmm0, (%rax)
+	addq	$16, %rax
+	cmpq	%rdx, %rax
+	jne	.L528
+	leaq	-1(%rbx), %r8
+	movq	%r14, %rax
+	leaq	-1(%r14,%rbx), %rdx
+	cmpq	$1, %rbx
+	jbe	.L550
+	.p2align 4,,10
+	.p2align 3
+.L532:
+	movzbl	(%rax), %ecx
+	movq	%rdx, %rsi
+	subq	%rax, %rsi
+	addq	$1, %rax
+	movq	%rsi, 16(%rsp,%rcx,8)
+	cmpq	%rdx, %rax
+	jne	.L532
+	movzbl	-1(%r14,%rbx), %ecx
+	cmpq	%rbx, %r13
+	jb	.L531
+.L533:
+	movq	%rbx, %rax
+	xorl	%ebp, %ebp
+.L537:
+	movzbl	-1(%r12,%rax), %r15d
+	cmpb	%r15b, %cl
+	je	.L551
+.L535:
+	addq	16(%rsp,%r15,8), %rbp
+	leaq	(%rbx,%rbp), %rax
+	cmpq	%rax, %r13
+	jnb	.L537
+.L531:
+	movq	$-1, %rbp
+.L527:
+	addq	$2072, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbp, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L551:
+	.cfi_restore_state
+	movq	%r8, %rdx
+	leaq	(%r12,%rbp), %rdi
+	movq	%r14, %rsi
+	movb	%cl, 15(%rsp)
+	movq	%r8, (%rsp)
+	call	memcmp@PLT
+	movq	(%rsp), %r8
+	movzbl	15(%rsp), %ecx
+	testl	%eax, %eax
+	je	.L527
+	jmp	.L535
+.L550:
+	movzbl	-1(%r14,%rbx), %ecx
+	cmpq	%rbx, %r13
+	jb	.L531
+	xorl	%ebp, %ebp
+	movl	$1, %eax
+	testq	%r8, %r8
+	jne	.L533
+	.p2align 4,,10
+	.p2align 3
+.L534:
+	movzbl	-1(%r12,%rax), %eax
+	cmpb	%cl, %al
+	je	.L527
+	addq	16(%rsp,%rax,8), %rbp
+	leaq	1(%rbp), %rax
+	cmpq	%rax, %r13
+	jnb	.L534
+	jmp	.L531
+	.cfi_endproc
+.LFE6914:
+	.size	_ZN1n12__horspool_nIcEEmPKT_mS3_m, .-_ZN1n12__horspool_nIcEEmPKT_mS3_m
+	.section	.text._ZN1n13__avx2_searchIcEEmPKT_mS3_m,"axG",@progbits,_ZN1n13__avx2_searchIcEEmPKT_mS3_m,comdat
+	.p2align 4
+	.weak	_ZN1n13__avx2_searchIcEEmPKT_mS3_m
+	.type	_ZN1n13__avx2_searchIcEEmPKT_mS3_m, @function
+_ZN1n13__avx2_searchIcEEmPKT_mS3_m:
+.LFB6948:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdx, %rax
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	movq	%rcx, %r14
+	pushq	%r13
+	pushq	%r12
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	xorl	%r12d, %r12d
+	pushq	%rbx
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	andq	$-32, %rsp
+	addq	$-128, %rsp
+	vpbroadcastb	(%rdx), %ymm4
+	vpbroadcastb	-1(%rdx,%rcx), %ymm5
+	movq	%rdx, 104(%rsp)
+	leaq	31(%rcx), %rdx
+	movq	%rsi, 96(%rsp)
+	movq	%rdx, 16(%rsp)
+	vmovdqa	%ymm4, 64(%rsp)
+	vmovdqa	%ymm5, 32(%rsp)
+	cmpq	%rdx, %rsi
+	jb	.L553
+	leaq	(%rdi,%rcx), %rsi
+	addq	$1, %rax
+	movq	%rsi, 24(%rsp)
+	leaq	-2(%rcx), %rsi
+	movq	%rsi, 120(%rsp)
+	movq	%rax, 112(%rsp)
+.L557:
+	movq	24(%rsp), %rax
+	vmovdqa	32(%rsp), %ymm2
+	vmovdqa	64(%rsp), %ymm3
+	vpcmpeqb	-1(%r12,%rax), %ymm2, %ymm0
+	vpcmpeqb	(%rbx,%r12), %ymm3, %ymm1
+	vpand	%ymm1, %ymm0, %ymm0
+	vpmovmskb	%ymm0, %r15d
+	testl	%r15d, %r15d
+	je	.L554
+	vzeroupper
+	jmp	.L556
+	.p2align 4,,10
+	.p2align 3
+.L582:
+	leal	-1(%r15), %eax
+	andl	%eax, %r15d
+	je	.L554
+.L556:
+	xorl	%ecx, %ecx
+	movq	120(%rsp), %rdx
+	movq	112(%rsp), %rsi
+	rep bsfl	%r15d, %ecx
+	movslq	%ecx, %rcx
+	leaq	(%rcx,%r12), %r13
+	leaq	1(%rbx,%r13), %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L582
+.L552:
+	leaq	-40(%rbp), %rsp
+	movq	%r13, %rax
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L554:
+	.cfi_restore_state
+	movq	16(%rsp), %rax
+	addq	$32, %r12
+	addq	%r12, %rax
+	cmpq	%rax, 96(%rsp)
+	jnb	.L557
+	subq	%r12, 96(%rsp)
+.L553:
+	cmpq	%r14, 96(%rsp)
+	jb	.L565
+	addq	%r12, %rbx
+	xorl	%r13d, %r13d
+	testq	%r14, %r14
+	je	.L578
+	.p2align 4,,10
+	.p2align 3
+.L558:
+	xorl	%eax, %eax
+	jmp	.L561
+	.p2align 4,,10
+	.p2align 3
+.L560:
+	addq	$1, %rax
+	cmpq	%rax, %r14
+	je	.L559
+.L561:
+	movq	104(%rsp), %rdx
+	movzbl	(%rdx,%rax), %esi
+	cmpb	%sil, (%rbx,%rax)
+	je	.L560
+	cmpq	%rax, %r14
+	je	.L559
+	addq	$1, %r13
+	addq	$1, %rbx
+	leaq	(%r14,%r13), %rax
+	cmpq	%rax, 96(%rsp)
+	jnb	.L558
+.L565:
+	movq	$-1, %r13
+	vzeroupper
+	jmp	.L552
+	.p2align 4,,10
+	.p2align 3
+.L559:
+	cmpq	$-1, %r13
+	je	.L579
+.L578:
+	addq	%r12, %r13
+	vzeroupper
+	jmp	.L552
+.L579:
+	vzeroupper
+	jmp	.L552
+	.cfi_endproc
+.LFE6948:
+	.size	_ZN1n13__avx2_searchIcEEmPKT_mS3_m, .-_ZN1n13__avx2_searchIcEEmPKT_mS3_m
+	.section	.text._ZN1n11simd_searchIcEEmPKT_mS3_mNS_8simd_isaE,"axG",@progbits,_ZN1n11simd_searchIcEEmPKT_mS3_mNS_8simd_isaE,comdat
+	.p2align 4
+	.weak	_ZN1n11simd_searchIcEEmPKT_mS3_mNS_8simd_isaE
+	.type	_ZN1n11simd_searchIcEEmPKT_mS3_mNS_8simd_isaE, @function
+_ZN1n11simd_searchIcEEmPKT_mS3_mNS_8simd_isaE:
+.LFB6913:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	%rsi, 8(%rsp)
+	cmpq	%rcx, %rsi
+	jb	.L605
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	movq	%rdi, %rbx
+	movq	%rdx, %r13
+	movq	%rcx, %r14
+	movl	%r8d, %r12d
+	testb	%al, %al
+	je	.L642
+.L587:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	jge	.L643
+.L620:
+.L591:
+	cmpl	$1, %r12d
+	je	.L598
+.L646:
+	subl	$2, %r12d
+	cmpl	$1, %r12d
+	ja	.L599
+	movq	8(%rsp), %rsi
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%r14, %rcx
+	movq	%r13, %rdx
+	movq	%rbx, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n13__avx2_searchIcEEmPKT_mS3_m
+	.p2align 4,,10
+	.p2align 3
+.L598:
+	.cfi_restore_state
+	movzbl	0(%r13), %eax
+	xorl	%r12d, %r12d
+	movd	%eax, %xmm0
+	movzbl	-1(%r13,%r14), %eax
+	punpcklbw	%xmm0, %xmm0
+	punpcklwd	%xmm0, %xmm0
+	pshufd	$0, %xmm0, %xmm5
+	movd	%eax, %xmm0
+	leaq	15(%r14), %rax
+	punpcklbw	%xmm0, %xmm0
+	movq	%rax, 88(%rsp)
+	punpcklwd	%xmm0, %xmm0
+	movaps	%xmm5, 48(%rsp)
+	pshufd	$0, %xmm0, %xmm6
+	movaps	%xmm6, 64(%rsp)
+	cmpq	%rax, 8(%rsp)
+	jb	.L601
+	leaq	(%rbx,%r14), %rax
+	movq	%rax, 80(%rsp)
+	leaq	-2(%r14), %rax
+	movq	%rax, 16(%rsp)
+	leaq	1(%r13), %rax
+	movq	%rax, 24(%rsp)
+.L604:
+	movq	80(%rsp), %rax
+	movdqu	(%rbx,%r12), %xmm1
+	movdqu	-1(%rax,%r12), %xmm2
+	pcmpeqb	48(%rsp), %xmm1
+	movaps	%xmm2, 32(%rsp)
+	movdqa	32(%rsp), %xmm0
+	pcmpeqb	64(%rsp), %xmm0
+	pand	%xmm1, %xmm0
+	pmovmskb	%xmm0, %ebp
+	testl	%ebp, %ebp
+	jne	.L603
+	jmp	.L602
+	.p2align 4,,10
+	.p2align 3
+.L644:
+	leal	-1(%rbp), %eax
+	andl	%eax, %ebp
+	je	.L602
+.L603:
+	xorl	%ecx, %ecx
+	movq	16(%rsp), %rdx
+	movq	24(%rsp), %rsi
+	rep bsfl	%ebp, %ecx
+	movslq	%ecx, %rcx
+	leaq	(%rcx,%r12), %r15
+	leaq	1(%rbx,%r15), %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L644
+.L583:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%r15, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L619:
+	.p2align 4,,10
+	.p2align 3
+.L643:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L645
+.L594:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	cmpl	$1, %r12d
+	jne	.L646
+	jmp	.L598
+	.p2align 4,,10
+	.p2align 3
+.L642:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L587
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L612
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L589:
+	movq	%rbp, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	jl	.L591
+	jmp	.L643
+.L599:
+	xorl	%r15d, %r15d
+	testq	%r14, %r14
+	je	.L583
+	.p2align 4,,10
+	.p2align 3
+.L600:
+	xorl	%eax, %eax
+	jmp	.L611
+	.p2align 4,,10
+	.p2align 3
+.L610:
+	addq	$1, %rax
+	cmpq	%rax, %r14
+	je	.L583
+.L611:
+	movzbl	0(%r13,%rax), %esi
+	cmpb	%sil, (%rbx,%rax)
+	je	.L610
+	cmpq	%rax, %r14
+	je	.L583
+	addq	$1, %r15
+	addq	$1, %rbx
+	leaq	(%r14,%r15), %rax
+	cmpq	%rax, 8(%rsp)
+	jnb	.L600
+.L605:
+	movq	$-1, %r15
+	jmp	.L583
+	.p2align 4,,10
+	.p2align 3
+.L602:
+	movq	88(%rsp), %rax
+	addq	$16, %r12
+	addq	%r12, %rax
+	cmpq	%rax, 8(%rsp)
+	jnb	.L604
+	subq	%r12, 8(%rsp)
+	movq	8(%rsp), %rax
+	cmpq	%r14, %rax
+	jb	.L605
+.L601:
+	addq	%r12, %rbx
+	xorl	%ecx, %ecx
+	testq	%r14, %r14
+	je	.L640
+	.p2align 4,,10
+	.p2align 3
+.L606:
+	xorl	%eax, %eax
+	jmp	.L609
+	.p2align 4,,10
+	.p2align 3
+.L608:
+	addq	$1, %rax
+	cmpq	%rax, %r14
+	je	.L607
+.L609:
+	movzbl	0(%r13,%rax), %edx
+	cmpb	%dl, (%rbx,%rax)
+	je	.L608
+	cmpq	%rax, %r14
+	je	.L607
+	addq	$1, %rcx
+	addq	$1, %rbx
+	leaq	(%r14,%rcx), %rax
+	cmpq	%rax, 8(%rsp)
+	jnb	.L606
+	jmp	.L605
+.L645:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L594
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L614
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L596:
+	movq	%rbp, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L594
+.L607:
+	cmpq	$-1, %rcx
+	je	.L605
+.L640:
+	leaq	(%rcx,%r12), %r15
+	jmp	.L583
+.L612:
+	movl	$3, %eax
+	jmp	.L589
+.L614:
+	movl	$3, %eax
+	jmp	.L596
+	.cfi_endproc
+.LFE6913:
+	.size	_ZN1n11simd_searchIcEEmPKT_mS3_mNS_8simd_isaE, .-_ZN1n11simd_searchIcEEmPKT_mS3_mNS_8simd_isaE
+	.section	.rodata.str1.8
+	.align 8
+.LC60:
+	.string	"expected equal : expected value : n::find_subsequence(hay.iter(), needle.iter()), actual value : 3"
+	.align 8
+.LC61:
+	.string	"expected equal : expected value : n::find_subsequence(hay.iter(), needle.iter()), actual value : n::size_t(-1)"
+	.align 8
+.LC62:
+	.string	"expected equal : expected value : n::find_subsequence(hay.iter(), needle.iter()), actual value : 4000"
+	.section	.text.unlikely
+.LCOLDB63:
+	.text
+.LHOTB63:
+	.p2align 4
+	.globl	_Z33test_find_subsequence_long_needlev
+	.type	_Z33test_find_subsequence_long_needlev, @function
+_Z33test_find_subsequence_long_needlev:
+.LFB6849:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6849
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, 16(%rsp)
+	movq	%rax, %r15
+	testq	%rax, %rax
+	je	.L728
+.L648:
+	xorl	%ebx, %ebx
+	xorl	%r12d, %r12d
+	xorl	%r13d, %r13d
+	jmp	.L663
+	.p2align 4,,10
+	.p2align 3
+.L655:
+	movb	%bpl, 0(%r13,%rbx)
+	addq	$1, %rbx
+	cmpq	$5000, %rbx
+	je	.L729
+.L663:
+	movl	%ebx, %edx
+	movl	%ebx, %eax
+	movl	%ebx, %ebp
+	imulq	$613566757, %rdx, %rdx
+	shrq	$32, %rdx
+	subl	%edx, %eax
+	shrl	%eax
+	addl	%edx, %eax
+	shrl	$2, %eax
+	leal	0(,%rax,8), %edx
+	subl	%eax, %edx
+	subl	%edx, %ebp
+	addl	$97, %ebp
+	cmpq	%rbx, %r12
+	jne	.L655
+	leaq	10(%r12,%r12), %rax
+	movl	$1, %edx
+	movq	%r15, %rdi
+	movq	%rax, (%rsp)
+	movq	%rax, %rsi
+	movq	(%r15), %rax
+.LEHB30:
+	call	*16(%rax)
+.LEHE30:
+	movb	%bpl, (%rax,%rbx)
+	movq	%rax, %r14
+	testq	%rbx, %rbx
+	jne	.L730
+	testq	%r13, %r13
+	je	.L691
+.L657:
+	movq	(%r15), %rax
+	movl	$1, %ecx
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movq	%r15, %rdi
+.LEHB31:
+	call	*24(%rax)
+.LEHE31:
+	addq	$1, %rbx
+	movq	(%rsp), %r12
+	movq	%r14, %r13
+	cmpq	$5000, %rbx
+	jne	.L663
+.L729:
+	movq	$0, (%rsp)
+	xorl	%ebp, %ebp
+	xorl	%r14d, %r14d
+	jmp	.L662
+	.p2align 4,,10
+	.p2align 3
+.L664:
+	movb	%bl, (%r14,%rbp)
+	addq	$1, %rbp
+	cmpq	$40, %rbp
+	je	.L731
+.L662:
+	leal	3(%rbp), %edx
+	movq	%rdx, %rbx
+	imulq	$613566757, %rdx, %rdx
+	movl	%ebx, %eax
+	shrq	$32, %rdx
+	subl	%edx, %eax
+	shrl	%eax
+	addl	%edx, %eax
+	shrl	$2, %eax
+	leal	0(,%rax,8), %edx
+	subl	%eax, %edx
+	subl	%edx, %ebx
+	addl	$97, %ebx
+	cmpq	%rbp, (%rsp)
+	jne	.L664
+	movq	(%rsp), %rax
+	movq	16(%rsp), %rdi
+	movl	$1, %edx
+	leaq	10(%rax,%rax), %rsi
+	movq	(%rdi), %rax
+	movq	%rsi, 24(%rsp)
+.LEHB32:
+	call	*16(%rax)
+.LEHE32:
+	movq	%rax, 8(%rsp)
+	movb	%bl, (%rax,%rbp)
+	testq	%rbp, %rbp
+	jne	.L732
+	testq	%r14, %r14
+	je	.L694
+.L669:
+	movq	16(%rsp), %rdi
+	movq	(%rsp), %rdx
+	movl	$1, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+.LEHB33:
+	call	*24(%rax)
+.LEHE33:
+	movq	24(%rsp), %rax
+	addq	$1, %rbp
+	movq	8(%rsp), %r14
+	movq	%rax, (%rsp)
+	cmpq	$40, %rbp
+	jne	.L662
+.L731:
+	movl	$40, %ecx
+	movq	%r14, %rdx
+	movl	$5000, %esi
+	movq	%r13, %rdi
+	call	_ZN1n12__horspool_nIcEEmPKT_mS3_m
+	cmpq	$3, %rax
+	jne	.L673
+	cmpq	$40, (%rsp)
+	je	.L733
+	movb	$122, 40(%r14)
+.L677:
+	movl	$41, %ecx
+	movq	%r14, %rdx
+	movl	$5000, %esi
+	movq	%r13, %rdi
+	call	_ZN1n12__horspool_nIcEEmPKT_mS3_m
+	cmpq	$-1, %rax
+	jne	.L721
+	movq	(%r15), %rax
+	movl	$1, %edx
+	movl	$41, %esi
+	movq	%r15, %rdi
+.LEHB34:
+	call	*16(%rax)
+.LEHE34:
+	movdqu	(%r14), %xmm0
+	movq	%rax, %rbx
+	movups	%xmm0, (%rax)
+	movdqu	16(%r14), %xmm1
+	movups	%xmm1, 16(%rax)
+	movdqu	25(%r14), %xmm2
+	movups	%xmm2, 25(%rax)
+	cmpq	$5040, %r12
+	ja	.L681
+	leaq	10(%r12,%r12), %rcx
+	movl	$5041, %eax
+	movl	$1, %edx
+	movq	%r15, %rdi
+	cmpq	%rax, %rcx
+	cmovnb	%rcx, %rax
+	movq	%rax, %rcx
+	movq	(%r15), %rax
+	movq	%rcx, 8(%rsp)
+	movq	%rcx, %rsi
+.LEHB35:
+	call	*16(%rax)
+.LEHE35:
+	movq	%rax, %rbp
+	movq	0(%r13), %rax
+	movq	%r13, %rsi
+	leaq	4000(%r13), %rdx
+	leaq	8(%rbp), %rdi
+	movq	%rax, 0(%rbp)
+	movq	3992(%r13), %rax
+	andq	$-8, %rdi
+	movq	%rax, 3992(%rbp)
+	movq	%rbp, %rax
+	subq	%rdi, %rax
+	subq	%rax, %rsi
+	addl	$4000, %eax
+	shrl	$3, %eax
+	movl	%eax, %ecx
+	leaq	4041(%rbp), %rax
+	rep movsq
+	leaq	4049(%rbp), %rdi
+	andq	$-8, %rdi
+	movq	4000(%r13), %rcx
+	subq	%rdi, %rax
+	subq	%rax, %rdx
+	addl	$1000, %eax
+	movq	%rcx, 4041(%rbp)
+	shrl	$3, %eax
+	movq	%rdx, %rsi
+	movq	%r12, %rdx
+	movq	4992(%r13), %rcx
+	movq	%rcx, 5033(%rbp)
+	movl	%eax, %ecx
+	rep movsq
+	movl	$1, %ecx
+	movq	%r13, %rsi
+	movq	%r15, %rdi
+	movq	(%r15), %rax
+.LEHB36:
+	call	*24(%rax)
+.LEHE36:
+	movq	8(%rsp), %r12
+	leaq	4000(%rbp), %rcx
+	movq	%rbp, %r13
+.L682:
+	movdqu	(%rbx), %xmm3
+	movl	$41, %edx
+	movq	%rbx, %rsi
+	movq	%r15, %rdi
+	movups	%xmm3, (%rcx)
+	movdqu	16(%rbx), %xmm4
+	movups	%xmm4, 16(%rcx)
+	movdqu	25(%rbx), %xmm5
+	movups	%xmm5, 25(%rcx)
+	movq	(%r15), %rax
+	movl	$1, %ecx
+	call	*24(%rax)
+	movl	$41, %ecx
+	movq	%r14, %rdx
+	movl	$5041, %esi
+	movq	%r13, %rdi
+	call	_ZN1n12__horspool_nIcEEmPKT_mS3_m
+	cmpq	$4000, %rax
+	jne	.L722
+	movq	16(%rsp), %rdi
+	movq	(%rsp), %rdx
+	movl	$1, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	testq	%r13, %r13
+	je	.L647
+	movq	(%r15), %rax
+	movl	$1, %ecx
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L647:
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L730:
+	.cfi_restore_state
+	movq	%rbx, %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L657
+	.p2align 4,,10
+	.p2align 3
+.L691:
+	movq	(%rsp), %r12
+	movq	%rax, %r13
+	movl	$1, %ebx
+	jmp	.L663
+	.p2align 4,,10
+	.p2align 3
+.L732:
+	movq	%rax, %rdi
+	movq	%rbp, %rdx
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L669
+	.p2align 4,,10
+	.p2align 3
+.L694:
+	movq	%rax, %r14
+	movq	24(%rsp), %rax
+	movl	$1, %ebp
+	movq	%rax, (%rsp)
+	jmp	.L662
+.L681:
+	leaq	4000(%r13), %rcx
+	leaq	4041(%r13), %rdi
+	movl	$1000, %edx
+	movq	%rcx, %rsi
+	movq	%rcx, 8(%rsp)
+	call	memmove@PLT
+	movq	8(%rsp), %rcx
+	jmp	.L682
+.L733:
+	movq	16(%rsp), %rbp
+	movl	$1, %edx
+	movl	$90, %esi
+	movq	0(%rbp), %rax
+	movq	%rbp, %rdi
+.LEHB37:
+	call	*16(%rax)
+.LEHE37:
+	movb	$122, 40(%rax)
+	movdqu	(%r14), %xmm6
+	movq	%rax, %rbx
+	movq	%rbp, %rdi
+	movl	$1, %ecx
+	movl	$40, %edx
+	movq	%r14, %rsi
+	movups	%xmm6, (%rax)
+	movdqu	16(%r14), %xmm7
+	movups	%xmm7, 16(%rax)
+	movq	32(%r14), %rax
+	movq	%rax, 32(%rbx)
+	movq	0(%rbp), %rax
+.LEHB38:
+	call	*24(%rax)
+.LEHE38:
+	movq	$90, (%rsp)
+	movq	%rbx, %r14
+	jmp	.L677
+.L728:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L734
+.L650:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	%rax, 16(%rsp)
+	testq	%rax, %rax
+	jne	.L648
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L735
+.L653:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	%rax, 16(%rsp)
+	jmp	.L648
+.L734:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L650
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L650
+.L735:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L653
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L653
+.L706:
+	jmp	.L660
+.L699:
+	jmp	.L661
+.L702:
+	jmp	.L687
+.L704:
+	jmp	.L666
+.L719:
+	jmp	.L667
+.L701:
+	movq	%rax, %r12
+	jmp	.L684
+.L698:
+	movq	%rax, %r12
+	jmp	.L685
+.L703:
+	jmp	.L676
+.L705:
+	jmp	.L678
+	.section	.gcc_except_table
+.LLSDA6849:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6849-.LLSDACSB6849
+.LLSDACSB6849:
+	.uleb128 .LEHB30-.LFB6849
+	.uleb128 .LEHE30-.LEHB30
+	.uleb128 .L699-.LFB6849
+	.uleb128 0
+	.uleb128 .LEHB31-.LFB6849
+	.uleb128 .LEHE31-.LEHB31
+	.uleb128 .L706-.LFB6849
+	.uleb128 0
+	.uleb128 .LEHB32-.LFB6849
+	.uleb128 .LEHE32-.LEHB32
+	.uleb128 .L704-.LFB6849
+	.uleb128 0
+	.uleb128 .LEHB33-.LFB6849
+	.uleb128 .LEHE33-.LEHB33
+	.uleb128 .L702-.LFB6849
+	.uleb128 0
+	.uleb128 .LEHB34-.LFB6849
+	.uleb128 .LEHE34-.LEHB34
+	.uleb128 .L719-.LFB6849
+	.uleb128 0
+	.uleb128 .LEHB35-.LFB6849
+	.uleb128 .LEHE35-.LEHB35
+	.uleb128 .L701-.LFB6849
+	.uleb128 0
+	.uleb128 .LEHB36-.LFB6849
+	.uleb128 .LEHE36-.LEHB36
+	.uleb128 .L698-.LFB6849
+	.uleb128 0
+	.uleb128 .LEHB37-.LFB6849
+	.uleb128 .LEHE37-.LEHB37
+	.uleb128 .L703-.LFB6849
+	.uleb128 0
+	.uleb128 .LEHB38-.LFB6849
+	.uleb128 .LEHE38-.LEHB38
+	.uleb128 .L705-.LFB6849
+	.uleb128 0
+.LLSDACSE6849:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6849
+	.type	_Z33test_find_subsequence_long_needlev.cold, @function
+_Z33test_find_subsequence_long_needlev.cold:
+.LFSB6849:
+.L660:
+	.cfi_def_cfa_offset 96
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	%r14, %r13
+.L661:
+	testq	%r13, %r13
+	je	.L689
+	movq	(%r15), %r8
+	movq	%rax, 8(%rsp)
+	movl	$1, %ecx
+	movq	%r13, %rsi
+	movq	(%rsp), %rdx
+	movq	%r15, %rdi
+	call	*24(%r8)
+	movq	8(%rsp), %rax
+.L689:
+	movq	%rax, %rdi
+.LEHB39:
+	call	_Unwind_Resume@PLT
+.LEHE39:
+.L687:
+	movq	24(%rsp), %rcx
+	movq	8(%rsp), %r14
+	movq	%rcx, (%rsp)
+.L667:
+	testq	%r14, %r14
+	je	.L736
+.L679:
+	movq	16(%rsp), %rdi
+	movq	%rax, 8(%rsp)
+	movl	$1, %ecx
+	movq	%r14, %rsi
+	movq	(%rsp), %rdx
+	movq	(%rdi), %r8
+	call	*24(%r8)
+	movq	%r12, (%rsp)
+	movq	8(%rsp), %rax
+	jmp	.L661
+.L666:
+	movq	24(%rsp), %rcx
+	movq	%rcx, (%rsp)
+	jmp	.L667
+.L736:
+	movq	%r12, (%rsp)
+	jmp	.L661
+.L673:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC60(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB40:
+	call	__cxa_throw@PLT
+.L721:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC61(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE40:
+.L700:
+	jmp	.L667
+.L722:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC62(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB41:
+	call	__cxa_throw@PLT
+.LEHE41:
+.L684:
+	movq	%r13, %rbp
+.L685:
+	movq	(%r15), %rax
+	movl	$1, %ecx
+	movl	$41, %edx
+	movq	%rbx, %rsi
+	movq	%r15, %rdi
+	movq	%rbp, %r13
+	call	*24(%rax)
+	movq	%r12, %rax
+	movq	8(%rsp), %r12
+	jmp	.L679
+.L697:
+	jmp	.L679
+.L676:
+	movq	$90, (%rsp)
+	jmp	.L667
+.L678:
+	movq	$90, (%rsp)
+	movq	%rbx, %r14
+	jmp	.L679
+	.cfi_endproc
+.LFE6849:
+	.section	.gcc_except_table
+.LLSDAC6849:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6849-.LLSDACSBC6849
+.LLSDACSBC6849:
+	.uleb128 .LEHB39-.LCOLDB63
+	.uleb128 .LEHE39-.LEHB39
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB40-.LCOLDB63
+	.uleb128 .LEHE40-.LEHB40
+	.uleb128 .L700-.LCOLDB63
+	.uleb128 0
+	.uleb128 .LEHB41-.LCOLDB63
+	.uleb128 .LEHE41-.LEHB41
+	.uleb128 .L697-.LCOLDB63
+	.uleb128 0
+.LLSDACSEC6849:
+	.section	.text.unlikely
+	.text
+	.size	_Z33test_find_subsequence_long_needlev, .-_Z33test_find_subsequence_long_needlev
+	.section	.text.unlikely
+	.size	_Z33test_find_subsequence_long_needlev.cold, .-_Z33test_find_subsequence_long_needlev.cold
+.LCOLDE63:
+	.text
+.LHOTE63:
+	.section	.rodata.str1.1
+.LC64:
+	.string	"fox"
+	.section	.rodata.str1.8
+	.align 8
+.LC65:
+	.string	"the quick brown fox jumps over the lazy dog"
+	.align 8
+.LC66:
+	.string	"expected equal : expected value : n::find_subsequence(text, n::slice_of(\"fox\")), actual value : 16"
+	.section	.rodata.str1.1
+.LC67:
+	.string	"the"
+	.section	.rodata.str1.8
+	.align 8
+.LC68:
+	.string	"expected equal : expected value : n::find_subsequence(text, n::slice_of(\"the\")), actual value : 0"
+	.section	.rodata.str1.1
+.LC69:
+	.string	"dog"
+	.section	.rodata.str1.8
+	.align 8
+.LC70:
+	.string	"expected equal : expected value : n::find_subsequence(text, n::slice_of(\"dog\")), actual value : 40"
+	.section	.rodata.str1.1
+.LC71:
+	.string	"cat"
+	.section	.rodata.str1.8
+	.align 8
+.LC72:
+	.string	"expected equal : expected value : n::find_subsequence(text, n::slice_of(\"cat\")), actual value : n::size_t(-1)"
+	.section	.text.unlikely
+.LCOLDB73:
+	.text
+.LHOTB73:
+	.p2align 4
+	.globl	_Z21test_find_subsequencev
+	.type	_Z21test_find_subsequencev, @function
+_Z21test_find_subsequencev:
+.LFB6845:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L926
+.L739:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L927
+.L743:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	jge	.L928
+.L850:
+.L748:
+	cmpl	$1, %ebp
+	je	.L755
+	subl	$2, %ebp
+	cmpl	$1, %ebp
+	ja	.L756
+	movl	$3, %ecx
+	leaq	.LC64(%rip), %rdx
+	movl	$43, %esi
+	leaq	.LC65(%rip), %rdi
+	call	_ZN1n13__avx2_searchIcEEmPKT_mS3_m
+.L757:
+	cmpq	$16, %rax
+	jne	.L759
+.L755:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L929
+.L762:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L930
+.L766:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	jge	.L931
+.L853:
+.L771:
+	subl	$2, %ebp
+	cmpl	$1, %ebp
+	jbe	.L932
+.L778:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L933
+.L780:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L934
+.L784:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	jge	.L935
+.L856:
+.L789:
+	cmpl	$1, %ebp
+	je	.L796
+	subl	$2, %ebp
+	cmpl	$1, %ebp
+	ja	.L797
+	movl	$3, %ecx
+	leaq	.LC69(%rip), %rdx
+	movl	$43, %esi
+	leaq	.LC65(%rip), %rdi
+	call	_ZN1n13__avx2_searchIcEEmPKT_mS3_m
+.L798:
+	cmpq	$40, %rax
+	jne	.L800
+.L796:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L936
+.L803:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L937
+.L807:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	jge	.L938
+.L859:
+.L812:
+	cmpl	$1, %ebp
+	je	.L737
+	subl	$2, %ebp
+	cmpl	$1, %ebp
+	ja	.L820
+	movl	$3, %ecx
+	leaq	.LC71(%rip), %rdx
+	movl	$43, %esi
+	leaq	.LC65(%rip), %rdi
+	call	_ZN1n13__avx2_searchIcEEmPKT_mS3_m
+	cmpq	$-1, %rax
+	jne	.L939
+.L737:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L756:
+	.cfi_restore_state
+	leaq	.LC65(%rip), %rdx
+	xorl	%ecx, %ecx
+	.p2align 4,,10
+	.p2align 3
+.L758:
+	movq	%rcx, %rax
+	addq	$1, %rcx
+	cmpb	$102, (%rdx)
+	jne	.L760
+	cmpb	$111, 1(%rdx)
+	jne	.L760
+	cmpb	$120, 2(%rdx)
+	je	.L757
+.L760:
+	addq	$1, %rdx
+	cmpq	$41, %rcx
+	jne	.L758
+.L759:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC66(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L820:
+	leaq	.LC65(%rip), %rax
+	xorl	%edx, %edx
+	.p2align 4,,10
+	.p2align 3
+.L822:
+	addq	$1, %rdx
+	cmpb	$99, (%rax)
+	jne	.L823
+	cmpb	$97, 1(%rax)
+	jne	.L823
+	cmpb	$116, 2(%rax)
+	je	.L821
+.L823:
+	addq	$1, %rax
+	cmpq	$41, %rdx
+	jne	.L822
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L797:
+	.cfi_restore_state
+	leaq	.LC65(%rip), %rdx
+	xorl	%ecx, %ecx
+	.p2align 4,,10
+	.p2align 3
+.L799:
+	movq	%rcx, %rax
+	addq	$1, %rcx
+	cmpb	$100, (%rdx)
+	jne	.L801
+	cmpb	$111, 1(%rdx)
+	jne	.L801
+	cmpb	$103, 2(%rdx)
+	je	.L798
+.L801:
+	addq	$1, %rdx
+	cmpq	$41, %rcx
+	jne	.L799
+.L800:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC70(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L932:
+	movl	$3, %ecx
+	leaq	.LC67(%rip), %rdx
+	movl	$43, %esi
+	leaq	.LC65(%rip), %rdi
+	call	_ZN1n13__avx2_searchIcEEmPKT_mS3_m
+	testq	%rax, %rax
+	je	.L778
+	jmp	.L923
+	.p2align 4,,10
+	.p2align 3
+.L933:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L780
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L836
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L782:
+	movq	%rbx, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L780
+.L855:
+	.p2align 4,,10
+	.p2align 3
+.L935:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L940
+.L792:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	jmp	.L789
+.L854:
+	.p2align 4,,10
+	.p2align 3
+.L934:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L784
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L838
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L787:
+	movq	%rbx, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L784
+.L852:
+	.p2align 4,,10
+	.p2align 3
+.L931:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L941
+.L774:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	jmp	.L771
+.L851:
+	.p2align 4,,10
+	.p2align 3
+.L930:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L766
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L832
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L769:
+	movq	%rbx, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L766
+	.p2align 4,,10
+	.p2align 3
+.L929:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L762
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L830
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L764:
+	movq	%rbx, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L762
+.L858:
+	.p2align 4,,10
+	.p2align 3
+.L938:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L942
+.L815:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	jmp	.L812
+.L857:
+	.p2align 4,,10
+	.p2align 3
+.L937:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L807
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L844
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L810:
+	movq	%rbx, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L807
+	.p2align 4,,10
+	.p2align 3
+.L936:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L803
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L842
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L805:
+	movq	%rbx, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L803
+.L849:
+	.p2align 4,,10
+	.p2align 3
+.L928:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L943
+.L751:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	jmp	.L748
+.L848:
+	.p2align 4,,10
+	.p2align 3
+.L927:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L743
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L826
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L746:
+	movq	%rbx, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L743
+	.p2align 4,,10
+	.p2align 3
+.L926:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L739
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L824
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L741:
+	movq	%rbx, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L739
+.L943:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L751
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L828
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L753:
+	movq	%rbx, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L751
+.L942:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L815
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L846
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L817:
+	movq	%rbx, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L815
+.L941:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L774
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L834
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L776:
+	movq	%rbx, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L774
+.L940:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L792
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L840
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L794:
+	movq	%rbx, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L792
+.L846:
+	movl	$3, %eax
+	jmp	.L817
+.L840:
+	movl	$3, %eax
+	jmp	.L794
+.L834:
+	movl	$3, %eax
+	jmp	.L776
+.L828:
+	movl	$3, %eax
+	jmp	.L753
+.L836:
+	movl	$3, %eax
+	jmp	.L782
+.L838:
+	movl	$3, %eax
+	jmp	.L787
+.L832:
+	movl	$3, %eax
+	jmp	.L769
+.L830:
+	movl	$3, %eax
+	jmp	.L764
+.L844:
+	movl	$3, %eax
+	jmp	.L810
+.L842:
+	movl	$3, %eax
+	jmp	.L805
+.L826:
+	movl	$3, %eax
+	jmp	.L746
+.L824:
+	movl	$3, %eax
+	jmp	.L741
+.L939:
+	jmp	.L821
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.type	_Z21test_find_subsequencev.cold, @function
+_Z21test_find_subsequencev.cold:
+.LFSB6845:
+.L821:
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC72(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L923:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC68(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.cfi_endproc
+.LFE6845:
+	.text
+	.size	_Z21test_find_subsequencev, .-_Z21test_find_subsequencev
+	.section	.text.unlikely
+	.size	_Z21test_find_subsequencev.cold, .-_Z21test_find_subsequencev.cold
+.LCOLDE73:
+	.text
+.LHOTE73:
+	.section	.text._ZN1n13__avx512_findIiEEmPKT_mS1_,"axG",@progbits,_ZN1n13__avx512_findIiEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n13__avx512_findIiEEmPKT_mS1_
+	.type	_ZN1n13__avx512_findIiEEmPKT_mS1_, @function
+_ZN1n13__avx512_findIiEEmPKT_mS1_:
+.LFB6960:
+	.cfi_startproc
+	xorl	%ecx, %ecx
+	vpbroadcastd	%edx, %zmm0
+	jmp	.L945
+	.p2align 4,,10
+	.p2align 3
+.L947:
+	vmovdqu32	-64(%rdi,%rcx,4), %zmm1
+	vpcmpd	$0, %zmm0, %zmm1, %k0
+	kortestq	%k0, %k0
+	jne	.L955
+.L945:
+	movq	%rcx, %rax
+	leaq	16(%rcx), %rcx
+	cmpq	%rcx, %rsi
+	jnb	.L947
+	subq	%rax, %rsi
+	je	.L950
+	leaq	(%rdi,%rax,4), %rdi
+	xorl	%ecx, %ecx
+	jmp	.L949
+	.p2align 4,,10
+	.p2align 3
+.L956:
+	addq	$1, %rcx
+	cmpq	%rcx, %rsi
+	je	.L950
+.L949:
+	cmpl	(%rdi,%rcx,4), %edx
+	jne	.L956
+	addq	%rcx, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L950:
+	movq	$-1, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L955:
+	kmovq	%k0, %rdx
+	rep bsfq	%rdx, %rdx
+	movslq	%edx, %rdx
+	addq	%rdx, %rax
+	vzeroupper
+	ret
+	.cfi_endproc
+.LFE6960:
+	.size	_ZN1n13__avx512_findIiEEmPKT_mS1_, .-_ZN1n13__avx512_findIiEEmPKT_mS1_
+	.section	.text._ZN1n11__avx2_findIiEEmPKT_mS1_,"axG",@progbits,_ZN1n11__avx2_findIiEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n11__avx2_findIiEEmPKT_mS1_
+	.type	_ZN1n11__avx2_findIiEEmPKT_mS1_, @function
+_ZN1n11__avx2_findIiEEmPKT_mS1_:
+.LFB6961:
+	.cfi_startproc
+	vmovd	%edx, %xmm1
+	xorl	%eax, %eax
+	vpbroadcastd	%xmm1, %ymm1
+	jmp	.L958
+	.p2align 4,,10
+	.p2align 3
+.L960:
+	vpcmpeqd	-128(%rdi,%rax,4), %ymm1, %ymm2
+	vpcmpeqd	-96(%rdi,%rax,4), %ymm1, %ymm0
+	vpcmpeqd	-64(%rdi,%rax,4), %ymm1, %ymm3
+	vpor	%ymm2, %ymm0, %ymm0
+	vpcmpeqd	-32(%rdi,%rax,4), %ymm1, %ymm2
+	vpor	%ymm3, %ymm2, %ymm2
+	vpor	%ymm2, %ymm0, %ymm0
+	vptest	%ymm0, %ymm0
+	jne	.L961
+.L958:
+	movq	%rax, %rcx
+	addq	$32, %rax
+	cmpq	%rax, %rsi
+	jnb	.L960
+	movq	%rcx, %rax
+	leaq	8(%rcx), %rcx
+	cmpq	%rcx, %rsi
+	jb	.L973
+	.p2align 4,,10
+	.p2align 3
+.L963:
+	vpcmpeqd	-32(%rdi,%rcx,4), %ymm1, %ymm0
+	vpmovmskb	%ymm0, %r8d
+	testl	%r8d, %r8d
+	jne	.L974
+.L961:
+	movq	%rcx, %rax
+	leaq	8(%rcx), %rcx
+	cmpq	%rcx, %rsi
+	jnb	.L963
+.L973:
+	subq	%rax, %rsi
+	je	.L966
+	leaq	(%rdi,%rax,4), %rdi
+	xorl	%ecx, %ecx
+	jmp	.L965
+	.p2align 4,,10
+	.p2align 3
+.L975:
+	addq	$1, %rcx
+	cmpq	%rcx, %rsi
+	je	.L966
+.L965:
+	cmpl	(%rdi,%rcx,4), %edx
+	jne	.L975
+	addq	%rcx, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L966:
+	movq	$-1, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L974:
+	rep bsfl	%r8d, %r8d
+	movslq	%r8d, %r8
+	shrq	$2, %r8
+	addq	%r8, %rax
+	vzeroupper
+	ret
+	.cfi_endproc
+.LFE6961:
+	.size	_ZN1n11__avx2_findIiEEmPKT_mS1_, .-_ZN1n11__avx2_findIiEEmPKT_mS1_
+	.section	.text._ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE,"axG",@progbits,_ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE,comdat
+	.p2align 4
+	.weak	_ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE
+	.type	_ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE, @function
+_ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE:
+.LFB6923:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	movl	%edx, %r13d
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movl	%ecx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	movq	%rdi, %rbx
+	testb	%al, %al
+	je	.L1022
+.L978:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	jge	.L1023
+.L1008:
+	cmpl	$2, %r12d
+	je	.L989
+.L1026:
+	cmpl	$3, %r12d
+	je	.L990
+	cmpl	$1, %r12d
+	je	.L991
+	xorl	%eax, %eax
+	testq	%rbp, %rbp
+	jne	.L992
+.L1006:
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	$-1, %rax
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1024:
+	.cfi_restore_state
+	addq	$1, %rax
+	cmpq	%rax, %rbp
+	je	.L1006
+.L992:
+	cmpl	(%rbx,%rax,4), %r13d
+	jne	.L1024
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+.L1007:
+	.p2align 4,,10
+	.p2align 3
+.L1023:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1025
+.L985:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	cmpl	$2, %r12d
+	jne	.L1026
+.L989:
+	movl	%r13d, %edx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n11__avx2_findIiEEmPKT_mS1_
+	.p2align 4,,10
+	.p2align 3
+.L1022:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r14
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L978
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1001
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L980:
+	movq	%r14, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L978
+	.p2align 4,,10
+	.p2align 3
+.L991:
+	movd	%r13d, %xmm4
+	xorl	%eax, %eax
+	pshufd	$0, %xmm4, %xmm2
+	jmp	.L994
+	.p2align 4,,10
+	.p2align 3
+.L996:
+	movdqu	-64(%rbx,%rax,4), %xmm0
+	movdqu	-48(%rbx,%rax,4), %xmm1
+	movdqu	-16(%rbx,%rax,4), %xmm3
+	pcmpeqd	%xmm2, %xmm1
+	pcmpeqd	%xmm2, %xmm0
+	pcmpeqd	%xmm2, %xmm3
+	por	%xmm1, %xmm0
+	movdqu	-32(%rbx,%rax,4), %xmm1
+	pcmpeqd	%xmm2, %xmm1
+	por	%xmm3, %xmm1
+	por	%xmm1, %xmm0
+	pmovmskb	%xmm0, %ecx
+	testl	%ecx, %ecx
+	jne	.L997
+.L994:
+	movq	%rax, %rdx
+	addq	$16, %rax
+	cmpq	%rax, %rbp
+	jnb	.L996
+	movq	%rdx, %rax
+	leaq	4(%rdx), %rdx
+	cmpq	%rdx, %rbp
+	jb	.L1027
+	.p2align 4,,10
+	.p2align 3
+.L998:
+	movdqu	-16(%rbx,%rdx,4), %xmm0
+	pcmpeqd	%xmm2, %xmm0
+	pmovmskb	%xmm0, %ecx
+	testl	%ecx, %ecx
+	jne	.L1028
+.L997:
+	movq	%rdx, %rax
+	leaq	4(%rdx), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L998
+.L1027:
+	subq	%rax, %rbp
+	je	.L1006
+	leaq	(%rbx,%rax,4), %rcx
+	xorl	%edx, %edx
+	jmp	.L1000
+	.p2align 4,,10
+	.p2align 3
+.L1029:
+	addq	$1, %rdx
+	cmpq	%rdx, %rbp
+	je	.L1006
+.L1000:
+	cmpl	(%rcx,%rdx,4), %r13d
+	jne	.L1029
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	addq	%rdx, %rax
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L990:
+	.cfi_restore_state
+	movl	%r13d, %edx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n13__avx512_findIiEEmPKT_mS1_
+	.p2align 4,,10
+	.p2align 3
+.L1028:
+	.cfi_restore_state
+	rep bsfl	%ecx, %ecx
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	movslq	%ecx, %rcx
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	shrq	$2, %rcx
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	addq	%rcx, %rax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1025:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r14
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L985
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1003
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L987:
+	movq	%r14, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L985
+.L1003:
+	movl	$3, %eax
+	jmp	.L987
+.L1001:
+	movl	$3, %eax
+	jmp	.L980
+	.cfi_endproc
+.LFE6923:
+	.size	_ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE, .-_ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE
+	.section	.rodata.str1.8
+	.align 8
+.LC77:
+	.string	"expected equal : expected value : n::find_subsequence(n::slice<const int>(hay, 9), n::slice<const int>(needle, 4)), actual value : 5"
+	.section	.text.unlikely
+.LCOLDB78:
+	.text
+.LHOTB78:
+	.p2align 4
+	.globl	_Z26test_find_subsequence_intsv
+	.type	_Z26test_find_subsequence_intsv, @function
+_Z26test_find_subsequence_intsv:
+.LFB6854:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movl	$6, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	xorl	%ebx, %ebx
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	movdqa	.LC74(%rip), %xmm0
+	movl	$4, 48(%rsp)
+	movaps	%xmm0, 16(%rsp)
+	movdqa	.LC75(%rip), %xmm0
+	movaps	%xmm0, 32(%rsp)
+	movdqa	.LC76(%rip), %xmm0
+	movaps	%xmm0, (%rsp)
+.L1031:
+	leaq	4(%rbx), %rax
+	cmpq	$9, %rax
+	ja	.L1037
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	movq	%r12, %r14
+	leaq	16(%rsp), %rbp
+	subq	%rbx, %r14
+	leaq	0(%rbp,%rbx,4), %r13
+	testb	%al, %al
+	je	.L1052
+.L1033:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %ecx
+	movl	(%rsp), %edx
+	movq	%r14, %rsi
+	movq	%r13, %rdi
+	call	_ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE
+	cmpq	$-1, %rax
+	je	.L1037
+.L1047:
+	addq	%rbx, %rax
+	movq	4(%rsp), %rcx
+	leaq	1(%rax), %rbx
+	leaq	0(%rbp,%rbx,4), %rdx
+	cmpq	%rcx, (%rdx)
+	jne	.L1031
+	movl	12(%rsp), %esi
+	cmpl	%esi, 8(%rdx)
+	jne	.L1031
+	cmpq	$5, %rax
+	jne	.L1053
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1052:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r15
+	movq	%r15, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1033
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1045
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1035:
+	movq	%r15, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1033
+	.p2align 4,,10
+	.p2align 3
+.L1045:
+	movl	$3, %eax
+	jmp	.L1035
+.L1053:
+	jmp	.L1037
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.type	_Z26test_find_subsequence_intsv.cold, @function
+_Z26test_find_subsequence_intsv.cold:
+.LFSB6854:
+.L1037:
+	.cfi_def_cfa_offset 128
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC77(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.cfi_endproc
+.LFE6854:
+	.text
+	.size	_Z26test_find_subsequence_intsv, .-_Z26test_find_subsequence_intsv
+	.section	.text.unlikely
+	.size	_Z26test_find_subsequence_intsv.cold, .-_Z26test_find_subsequence_intsv.cold
+.LCOLDE78:
+	.text
+.LHOTE78:
+	.section	.rodata.str1.8
+	.align 8
+.LC80:
+	.string	"expected true : n::contains(v.iter(), 2)"
+	.align 8
+.LC81:
+	.string	"expected false : n::contains(v.iter(), 3)"
+	.section	.text.unlikely
+.LCOLDB82:
+	.text
+.LHOTB82:
+	.p2align 4
+	.globl	_Z13test_containsv
+	.type	_Z13test_containsv, @function
+_Z13test_containsv:
+.LFB6786:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6786
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbp
+	testq	%rbp, %rbp
+	je	.L1094
+.L1055:
+	movq	0(%rbp), %rax
+	movl	$4, %edx
+	movl	$40, %esi
+	movq	%rbp, %rdi
+.LEHB42:
+	call	*16(%rax)
+.LEHE42:
+	movq	%rax, %rbx
+	movq	.LC79(%rip), %rax
+	movq	%rax, (%rbx)
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1095
+.L1060:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %ecx
+	movl	$2, %edx
+	movl	$2, %esi
+	movq	%rbx, %rdi
+	call	_ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE
+	cmpq	$-1, %rax
+	je	.L1090
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1096
+.L1068:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %ecx
+	movl	$3, %edx
+	movl	$2, %esi
+	movq	%rbx, %rdi
+	call	_ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE
+	cmpq	$-1, %rax
+	jne	.L1071
+	movq	0(%rbp), %rax
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	movl	$4, %ecx
+	movl	$40, %edx
+	call	*24(%rax)
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1095:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1060
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1074
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1062:
+	movq	%r12, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1060
+	.p2align 4,,10
+	.p2align 3
+.L1096:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1068
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1076
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1070:
+	movq	%r12, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1068
+	.p2align 4,,10
+	.p2align 3
+.L1094:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1097
+.L1057:
+	movq	_ZZN1n4heapEvE3res(%rip), %rbp
+	jmp	.L1055
+	.p2align 4,,10
+	.p2align 3
+.L1097:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1057
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1057
+	.p2align 4,,10
+	.p2align 3
+.L1074:
+	movl	$3, %eax
+	jmp	.L1062
+	.p2align 4,,10
+	.p2align 3
+.L1076:
+	movl	$3, %eax
+	jmp	.L1070
+	.section	.gcc_except_table
+.LLSDA6786:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6786-.LLSDACSB6786
+.LLSDACSB6786:
+	.uleb128 .LEHB42-.LFB6786
+	.uleb128 .LEHE42-.LEHB42
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6786:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6786
+	.type	_Z13test_containsv.cold, @function
+_Z13test_containsv.cold:
+.LFSB6786:
+.L1090:
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.cfi_offset 6, -24
+	.cfi_offset 12, -16
+.L1079:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC80(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB43:
+	call	__cxa_throw@PLT
+.L1080:
+.L1071:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC81(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE43:
+.L1078:
+	movq	%rax, %r12
+	movq	0(%rbp), %rax
+	movq	%rbp, %rdi
+	movl	$4, %ecx
+	movl	$40, %edx
+	movq	%rbx, %rsi
+	call	*24(%rax)
+	movq	%r12, %rdi
+.LEHB44:
+	call	_Unwind_Resume@PLT
+.LEHE44:
+	.cfi_endproc
+.LFE6786:
+	.section	.gcc_except_table
+.LLSDAC6786:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6786-.LLSDACSBC6786
+.LLSDACSBC6786:
+	.uleb128 .LEHB43-.LCOLDB82
+	.uleb128 .LEHE43-.LEHB43
+	.uleb128 .L1078-.LCOLDB82
+	.uleb128 0
+	.uleb128 .LEHB44-.LCOLDB82
+	.uleb128 .LEHE44-.LEHB44
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6786:
+	.section	.text.unlikely
+	.text
+	.size	_Z13test_containsv, .-_Z13test_containsv
+	.section	.text.unlikely
+	.size	_Z13test_containsv.cold, .-_Z13test_containsv.cold
+.LCOLDE82:
+	.text
+.LHOTE82:
+	.section	.text._ZN1n14__avx512_countIcEEmPKT_mS1_,"axG",@progbits,_ZN1n14__avx512_countIcEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n14__avx512_countIcEEmPKT_mS1_
+	.type	_ZN1n14__avx512_countIcEEmPKT_mS1_, @function
+_ZN1n14__avx512_countIcEEmPKT_mS1_:
+.LFB6968:
+	.cfi_startproc
+	movl	%edx, %r10d
+	vpbroadcastb	%edx, %zmm5
+	movl	$64, %eax
+	xorl	%r8d, %r8d
+	cmpq	$63, %rsi
+	jbe	.L1123
+	.p2align 4,,10
+	.p2align 3
+.L1102:
+	vpcmpeqb	-64(%rdi,%rax), %zmm5, %k0
+	movq	%rax, %r9
+	addq	$64, %rax
+	kmovq	%k0, %rcx
+	popcntq	%rcx, %rcx
+	addq	%rcx, %r8
+	cmpq	%rax, %rsi
+	jnb	.L1102
+	subq	%r9, %rsi
+	je	.L1098
+	leaq	-1(%rsi), %rax
+	cmpq	$62, %rax
+	jbe	.L1109
+	movq	%rsi, %rcx
+	addq	%r9, %rdi
+	movl	$1, %r9d
+	andq	$-64, %rcx
+	movq	%rdi, %rax
+	vpxor	%xmm7, %xmm7, %xmm7
+	addq	%rdi, %rcx
+	vpbroadcastb	%r9d, %zmm6
+	.p2align 4,,10
+	.p2align 3
+.L1103:
+	vpcmpb	$0, (%rax), %zmm5, %k1
+	addq	$64, %rax
+	vmovdqu8	%zmm6, %zmm0{%k1}{z}
+	vpmovzxbw	%ymm0, %zmm1
+	vextracti64x4	$0x1, %zmm0, %ymm0
+	vpmovzxwd	%ymm1, %zmm4
+	vextracti64x4	$0x1, %zmm1, %ymm1
+	vpmovzxbw	%ymm0, %zmm0
+	vpmovzxdq	%ymm4, %zmm2
+	vextracti64x4	$0x1, %zmm4, %ymm4
+	vpmovzxwd	%ymm1, %zmm1
+	vpmovzxdq	%ymm4, %zmm4
+	vpmovzxwd	%ymm0, %zmm3
+	vextracti64x4	$0x1, %zmm0, %ymm0
+	vpaddq	%zmm4, %zmm2, %zmm2
+	vpmovzxdq	%ymm1, %zmm4
+	vextracti64x4	$0x1, %zmm1, %ymm1
+	vpmovzxdq	%ymm1, %zmm1
+	vpmovzxwd	%ymm0, %zmm0
+	vpaddq	%zmm1, %zmm4, %zmm4
+	vpmovzxdq	%ymm3, %zmm1
+	vextracti64x4	$0x1, %zmm3, %ymm3
+	vpmovzxdq	%ymm3, %zmm3
+	vpaddq	%zmm4, %zmm2, %zmm2
+	vpaddq	%zmm3, %zmm1, %zmm1
+	vpmovzxdq	%ymm0, %zmm3
+	vextracti64x4	$0x1, %zmm0, %ymm0
+	vpaddq	%zmm3, %zmm1, %zmm1
+	vpmovzxdq	%ymm0, %zmm0
+	vpaddq	%zmm1, %zmm2, %zmm2
+	vpaddq	%zmm7, %zmm0, %zmm0
+	vpaddq	%zmm0, %zmm2, %zmm7
+	cmpq	%rax, %rcx
+	jne	.L1103
+	vmovdqa	%ymm7, %ymm3
+	vextracti64x4	$0x1, %zmm7, %ymm7
+	movq	%rsi, %rax
+	vpaddq	%ymm7, %ymm3, %ymm3
+	andq	$-64, %rax
+	vextracti128	$0x1, %ymm3, %xmm1
+	vpaddq	%xmm1, %xmm3, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rcx
+	testb	$63, %sil
+	je	.L1104
+.L1100:
+	movq	%rsi, %r9
+	subq	%rax, %r9
+	leaq	-1(%r9), %r11
+	cmpq	$30, %r11
+	jbe	.L1107
+	vmovd	%edx, %xmm0
+	movl	$1, %edx
+	vpbroadcastb	%xmm0, %ymm0
+	vmovd	%edx, %xmm1
+	movq	%r9, %rdx
+	vpcmpeqb	(%rdi,%rax), %ymm0, %ymm0
+	vpbroadcastb	%xmm1, %ymm1
+	andq	$-32, %rdx
+	addq	%rdx, %rax
+	andl	$31, %r9d
+	vpand	%ymm1, %ymm0, %ymm0
+	vpmovzxbw	%xmm0, %ymm2
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxwd	%xmm2, %ymm4
+	vextracti128	$0x1, %ymm2, %xmm2
+	vpmovzxbw	%xmm0, %ymm0
+	vpmovzxwd	%xmm2, %ymm2
+	vpmovzxwd	%xmm0, %ymm5
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxdq	%xmm2, %ymm1
+	vextracti128	$0x1, %ymm2, %xmm2
+	vpmovzxwd	%xmm0, %ymm0
+	vpmovzxdq	%xmm2, %ymm2
+	vpaddq	%ymm2, %ymm1, %ymm1
+	vpmovzxdq	%xmm4, %ymm2
+	vextracti128	$0x1, %ymm4, %xmm4
+	vpmovzxdq	%xmm4, %ymm4
+	vpaddq	%ymm4, %ymm2, %ymm2
+	vpaddq	%ymm2, %ymm1, %ymm1
+	vpmovzxdq	%xmm5, %ymm2
+	vextracti128	$0x1, %ymm5, %xmm5
+	vpmovzxdq	%xmm5, %ymm5
+	vpaddq	%ymm5, %ymm2, %ymm2
+	vpaddq	%ymm3, %ymm2, %ymm2
+	vpaddq	%ymm2, %ymm1, %ymm1
+	vpmovzxdq	%xmm0, %ymm2
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxdq	%xmm0, %ymm0
+	vpaddq	%ymm0, %ymm2, %ymm0
+	vpaddq	%ymm0, %ymm1, %ymm1
+	vmovdqa	%xmm1, %xmm0
+	vextracti128	$0x1, %ymm1, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rcx
+	je	.L1104
+	.p2align 4,,10
+	.p2align 3
+.L1107:
+	xorl	%edx, %edx
+	cmpb	%r10b, (%rdi,%rax)
+	sete	%dl
+	addq	$1, %rax
+	addq	%rdx, %rcx
+	cmpq	%rsi, %rax
+	jb	.L1107
+.L1104:
+	addq	%rcx, %r8
+.L1098:
+	movq	%r8, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1123:
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	testq	%rsi, %rsi
+	jne	.L1100
+	jmp	.L1098
+.L1109:
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	addq	%r9, %rdi
+	jmp	.L1100
+	.cfi_endproc
+.LFE6968:
+	.size	_ZN1n14__avx512_countIcEEmPKT_mS1_, .-_ZN1n14__avx512_countIcEEmPKT_mS1_
+	.section	.text._ZN1n12__avx2_countIcEEmPKT_mS1_,"axG",@progbits,_ZN1n12__avx2_countIcEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n12__avx2_countIcEEmPKT_mS1_
+	.type	_ZN1n12__avx2_countIcEEmPKT_mS1_, @function
+_ZN1n12__avx2_countIcEEmPKT_mS1_:
+.LFB6969:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	vmovd	%edx, %xmm2
+	movq	%rdi, %r10
+	movl	%edx, %r11d
+	movq	%rsi, %rdi
+	vpbroadcastb	%xmm2, %ymm2
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	.cfi_offset 14, -24
+	.cfi_offset 13, -32
+	.cfi_offset 12, -40
+	.cfi_offset 3, -48
+	cmpq	$31, %rsi
+	jbe	.L1125
+	xorl	%edx, %edx
+	xorl	%r9d, %r9d
+	movl	$32, %r8d
+	xorl	%ebx, %ebx
+	vpxor	%xmm3, %xmm3, %xmm3
+	.p2align 4,,10
+	.p2align 3
+.L1131:
+	movq	%rdi, %r12
+	movl	$255, %ecx
+	subq	%rdx, %r12
+	movq	%r12, %rsi
+	shrq	$5, %rsi
+	cmpq	%rcx, %rsi
+	cmovbe	%rsi, %rcx
+	testq	%rsi, %rsi
+	je	.L1138
+	addq	%r10, %rdx
+	vpxor	%xmm1, %xmm1, %xmm1
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L1127:
+	vpcmpeqb	(%rdx), %ymm2, %ymm0
+	addq	$1, %rax
+	addq	$32, %rdx
+	vpsubb	%ymm0, %ymm1, %ymm0
+	vmovdqa	%ymm0, %ymm1
+	cmpq	%rcx, %rax
+	jb	.L1127
+	subq	$1, %rcx
+	movq	%rdi, %r12
+	salq	$5, %rcx
+	testq	%rsi, %rsi
+	cmove	%rbx, %rcx
+	leaq	(%rcx,%r8), %rdx
+	subq	%rdx, %r12
+	leaq	32(%rdx), %r8
+.L1126:
+	vpsadbw	%ymm3, %ymm0, %ymm0
+	vmovq	%xmm0, %rcx
+	vpextrq	$1, %xmm0, %r14
+	vextracti128	$0x1, %ymm0, %xmm0
+	addq	%r14, %rcx
+	vmovq	%xmm0, %r13
+	vpextrq	$1, %xmm0, %rax
+	addq	%r9, %rcx
+	addq	%r13, %rcx
+	leaq	(%rax,%rcx), %r9
+	cmpq	%r8, %rdi
+	jb	.L1151
+	testq	%rsi, %rsi
+	jne	.L1131
+.L1132:
+	jmp	.L1132
+	.p2align 4,,10
+	.p2align 3
+.L1151:
+	testq	%r12, %r12
+	je	.L1124
+	leaq	-1(%r12), %rax
+	cmpq	$30, %rax
+	jbe	.L1140
+	movq	%r12, %rsi
+	leaq	(%r10,%rdx), %rcx
+	vpxor	%xmm3, %xmm3, %xmm3
+	movl	$1, %edi
+	andq	$-32, %rsi
+	vmovd	%edi, %xmm4
+	movq	%rcx, %rax
+	addq	%rcx, %rsi
+	vpbroadcastb	%xmm4, %ymm4
+	.p2align 4,,10
+	.p2align 3
+.L1134:
+	vpcmpeqb	(%rax), %ymm2, %ymm0
+	addq	$32, %rax
+	vpand	%ymm4, %ymm0, %ymm0
+	vpmovzxbw	%xmm0, %ymm1
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxwd	%xmm1, %ymm7
+	vextracti128	$0x1, %ymm1, %xmm1
+	vpmovzxbw	%xmm0, %ymm0
+	vpmovzxwd	%xmm1, %ymm1
+	vpmovzxwd	%xmm0, %ymm6
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxdq	%xmm1, %ymm5
+	vextracti128	$0x1, %ymm1, %xmm1
+	vpmovzxwd	%xmm0, %ymm0
+	vpmovzxdq	%xmm1, %ymm1
+	vpaddq	%ymm1, %ymm5, %ymm1
+	vpmovzxdq	%xmm7, %ymm5
+	vextracti128	$0x1, %ymm7, %xmm7
+	vpmovzxdq	%xmm7, %ymm7
+	vpaddq	%ymm7, %ymm5, %ymm5
+	vpaddq	%ymm5, %ymm1, %ymm1
+	vpmovzxdq	%xmm6, %ymm5
+	vextracti128	$0x1, %ymm6, %xmm6
+	vpmovzxdq	%xmm6, %ymm6
+	vpaddq	%ymm6, %ymm5, %ymm5
+	vpmovzxdq	%xmm0, %ymm6
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpaddq	%ymm6, %ymm5, %ymm5
+	vpmovzxdq	%xmm0, %ymm0
+	vpaddq	%ymm5, %ymm1, %ymm1
+	vpaddq	%ymm3, %ymm0, %ymm0
+	vpaddq	%ymm0, %ymm1, %ymm3
+	cmpq	%rax, %rsi
+	jne	.L1134
+	vmovdqa	%xmm3, %xmm0
+	vextracti128	$0x1, %ymm3, %xmm3
+	movq	%r12, %r8
+	vpaddq	%xmm3, %xmm0, %xmm3
+	andq	$-32, %r8
+	vpsrldq	$8, %xmm3, %xmm0
+	vpaddq	%xmm0, %xmm3, %xmm0
+	vmovq	%xmm0, %rax
+	testb	$31, %r12b
+	je	.L1135
+.L1133:
+	movq	%r12, %rsi
+	subq	%r8, %rsi
+	leaq	-1(%rsi), %rdi
+	cmpq	$14, %rdi
+	jbe	.L1136
+	vmovd	%r11d, %xmm0
+	movl	$1, %eax
+	movq	%rsi, %rdi
+	vpbroadcastb	%xmm0, %xmm0
+	vmovd	%eax, %xmm1
+	andq	$-16, %rdi
+	vpcmpeqb	(%rcx,%r8), %xmm0, %xmm0
+	vpbroadcastb	%xmm1, %xmm1
+	addq	%rdi, %r8
+	andl	$15, %esi
+	vpand	%xmm1, %xmm0, %xmm0
+	vpmovzxbw	%xmm0, %xmm2
+	vpsrldq	$8, %xmm0, %xmm0
+	vpmovzxwd	%xmm2, %xmm5
+	vpsrldq	$8, %xmm2, %xmm2
+	vpmovzxbw	%xmm0, %xmm0
+	vpmovzxdq	%xmm5, %xmm1
+	vpsrldq	$8, %xmm5, %xmm5
+	vpmovzxwd	%xmm2, %xmm2
+	vpmovzxdq	%xmm5, %xmm5
+	vpmovzxwd	%xmm0, %xmm4
+	vpaddq	%xmm5, %xmm1, %xmm1
+	vpsrldq	$8, %xmm0, %xmm0
+	vpmovzxdq	%xmm2, %xmm5
+	vpsrldq	$8, %xmm2, %xmm2
+	vpmovzxwd	%xmm0, %xmm0
+	vpmovzxdq	%xmm2, %xmm2
+	vpaddq	%xmm2, %xmm5, %xmm2
+	vpaddq	%xmm2, %xmm1, %xmm1
+	vpmovzxdq	%xmm4, %xmm2
+	vpsrldq	$8, %xmm4, %xmm4
+	vpmovzxdq	%xmm4, %xmm4
+	vpaddq	%xmm4, %xmm2, %xmm2
+	vpaddq	%xmm3, %xmm2, %xmm2
+	vpaddq	%xmm2, %xmm1, %xmm1
+	vpmovzxdq	%xmm0, %xmm2
+	vpsrldq	$8, %xmm0, %xmm0
+	vpmovzxdq	%xmm0, %xmm0
+	vpaddq	%xmm0, %xmm2, %xmm0
+	vpaddq	%xmm0, %xmm1, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rax
+	je	.L1135
+.L1136:
+	xorl	%esi, %esi
+	cmpb	%r11b, (%rcx,%r8)
+	sete	%sil
+	addq	%rsi, %rax
+	leaq	1(%r8), %rsi
+	cmpq	%r12, %rsi
+	jnb	.L1135
+	addq	%rsi, %r10
+	cmpb	%r11b, (%r10,%rdx)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+	leaq	2(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L1135
+	xorl	%edx, %edx
+	cmpb	%r11b, 2(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	3(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L1135
+	xorl	%edx, %edx
+	cmpb	%r11b, 3(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	4(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L1135
+	xorl	%edx, %edx
+	cmpb	%r11b, 4(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	5(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L1135
+	xorl	%edx, %edx
+	cmpb	%r11b, 5(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	6(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L1135
+	xorl	%edx, %edx
+	cmpb	%r11b, 6(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	7(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L1135
+	xorl	%edx, %edx
+	cmpb	%r11b, 7(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	8(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L1135
+	xorl	%edx, %edx
+	cmpb	%r11b, 8(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	9(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L1135
+	xorl	%edx, %edx
+	cmpb	%r11b, 9(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	10(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L1135
+	xorl	%edx, %edx
+	cmpb	%r11b, 10(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	11(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L1135
+	xorl	%edx, %edx
+	cmpb	%r11b, 11(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	12(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L1135
+	xorl	%edx, %edx
+	cmpb	%r11b, 12(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	13(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L1135
+	xorl	%edx, %edx
+	cmpb	%r11b, 13(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	14(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L1135
+	xorl	%edx, %edx
+	cmpb	%r11b, 14(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	.p2align 4,,10
+	.p2align 3
+.L1135:
+	addq	%rax, %r9
+.L1124:
+	vzeroupper
+	movq	%r9, %rax
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1138:
+	.cfi_restore_state
+	vpxor	%xmm0, %xmm0, %xmm0
+	jmp	.L1126
+.L1125:
+	xorl	%r9d, %r9d
+	testq	%rsi, %rsi
+	je	.L1124
+	movq	%rsi, %r12
+	xorl	%edx, %edx
+	xorl	%r9d, %r9d
+	xorl	%eax, %eax
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%r8d, %r8d
+	movq	%r10, %rcx
+	jmp	.L1133
+.L1140:
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%eax, %eax
+	leaq	(%r10,%rdx), %rcx
+	xorl	%r8d, %r8d
+	jmp	.L1133
+	.cfi_endproc
+.LFE6969:
+	.size	_ZN1n12__avx2_countIcEEmPKT_mS1_, .-_ZN1n12__avx2_countIcEEmPKT_mS1_
+	.section	.text._ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE,"axG",@progbits,_ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE,comdat
+	.p2align 4
+	.weak	_ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE
+	.type	_ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE, @function
+_ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE:
+.LFB6935:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	movl	%ecx, %r13d
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movl	%edx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	movq	%rsi, %rbx
+	testb	%al, %al
+	je	.L1217
+.L1154:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %r13d
+	jge	.L1218
+.L1194:
+	cmpl	$2, %r13d
+	je	.L1165
+.L1220:
+	cmpl	$3, %r13d
+	je	.L1166
+	cmpl	$1, %r13d
+	je	.L1167
+	xorl	%esi, %esi
+	testq	%rbx, %rbx
+	je	.L1152
+	leaq	-1(%rbx), %rax
+	cmpq	$14, %rax
+	jbe	.L1192
+	movd	%r12d, %xmm7
+	movq	%rbx, %rdx
+	pxor	%xmm4, %xmm4
+	movq	%rbp, %rax
+	punpcklbw	%xmm7, %xmm7
+	pxor	%xmm6, %xmm6
+	pxor	%xmm5, %xmm5
+	andq	$-16, %rdx
+	punpcklwd	%xmm7, %xmm7
+	movdqa	.LC85(%rip), %xmm3
+	addq	%rbp, %rdx
+	pxor	%xmm8, %xmm8
+	pshufd	$0, %xmm7, %xmm7
+	.p2align 4,,10
+	.p2align 3
+.L1182:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqb	%xmm7, %xmm0
+	pand	%xmm3, %xmm0
+	movdqa	%xmm0, %xmm2
+	punpckhbw	%xmm8, %xmm0
+	punpcklbw	%xmm8, %xmm2
+	movdqa	%xmm0, %xmm9
+	punpckhwd	%xmm6, %xmm0
+	movdqa	%xmm2, %xmm1
+	punpckhwd	%xmm6, %xmm2
+	punpcklwd	%xmm6, %xmm9
+	punpcklwd	%xmm6, %xmm1
+	movdqa	%xmm1, %xmm10
+	punpckldq	%xmm5, %xmm1
+	punpckhdq	%xmm5, %xmm10
+	paddq	%xmm10, %xmm1
+	movdqa	%xmm2, %xmm10
+	punpckldq	%xmm5, %xmm2
+	punpckhdq	%xmm5, %xmm10
+	paddq	%xmm10, %xmm2
+	paddq	%xmm2, %xmm1
+	movdqa	%xmm9, %xmm2
+	punpckldq	%xmm5, %xmm9
+	punpckhdq	%xmm5, %xmm2
+	paddq	%xmm2, %xmm9
+	movdqa	%xmm0, %xmm2
+	punpckhdq	%xmm5, %xmm0
+	punpckldq	%xmm5, %xmm2
+	paddq	%xmm4, %xmm0
+	paddq	%xmm2, %xmm9
+	paddq	%xmm9, %xmm1
+	movdqa	%xmm1, %xmm4
+	paddq	%xmm0, %xmm4
+	cmpq	%rax, %rdx
+	jne	.L1182
+	movdqa	%xmm4, %xmm0
+	movq	%rbx, %rax
+	psrldq	$8, %xmm0
+	andq	$-16, %rax
+	paddq	%xmm0, %xmm4
+	movq	%xmm4, %rsi
+	testb	$15, %bl
+	je	.L1152
+.L1181:
+	xorl	%edx, %edx
+	cmpb	%r12b, 0(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	1(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L1152
+	xorl	%edx, %edx
+	cmpb	%r12b, 1(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	2(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L1152
+	xorl	%edx, %edx
+	cmpb	%r12b, 2(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	3(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L1152
+	xorl	%edx, %edx
+	cmpb	%r12b, 3(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	4(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L1152
+	xorl	%edx, %edx
+	cmpb	%r12b, 4(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	5(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L1152
+	xorl	%edx, %edx
+	cmpb	%r12b, 5(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	6(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L1152
+	xorl	%edx, %edx
+	cmpb	%r12b, 6(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	7(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L1152
+	xorl	%edx, %edx
+	cmpb	%r12b, 7(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	8(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L1152
+	xorl	%edx, %edx
+	cmpb	%r12b, 8(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	9(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L1152
+	xorl	%edx, %edx
+	cmpb	%r12b, 9(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	10(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L1152
+	xorl	%edx, %edx
+	cmpb	%r12b, 10(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	11(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L1152
+	xorl	%edx, %edx
+	cmpb	%r12b, 11(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	12(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L1152
+	xorl	%edx, %edx
+	cmpb	%r12b, 12(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	13(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L1152
+	xorl	%edx, %edx
+	cmpb	%r12b, 13(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	14(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L1152
+	cmpb	%r12b, 14(%rbp,%rax)
+	sete	%al
+	movzbl	%al, %eax
+	.p2align 4,,10
+	.p2align 3
+.L1216:
+	addq	%rax, %rsi
+.L1152:
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%rsi, %rax
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+.L1193:
+	.p2align 4,,10
+	.p2align 3
+.L1218:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1219
+.L1161:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %r13d
+	cmpl	$2, %r13d
+	jne	.L1220
+.L1165:
+	movsbl	%r12b, %edx
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n12__avx2_countIcEEmPKT_mS1_
+	.p2align 4,,10
+	.p2align 3
+.L1217:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r14
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1154
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1185
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1156:
+	movq	%r14, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1154
+	.p2align 4,,10
+	.p2align 3
+.L1167:
+	movd	%r12d, %xmm4
+	xorl	%esi, %esi
+	punpcklbw	%xmm4, %xmm4
+	punpcklwd	%xmm4, %xmm4
+	pshufd	$0, %xmm4, %xmm4
+	cmpq	$15, %rbx
+	jbe	.L1170
+	xorl	%edx, %edx
+	movl	$16, %r9d
+	pxor	%xmm3, %xmm3
+	xorl	%r8d, %r8d
+	.p2align 4,,10
+	.p2align 3
+.L1173:
+	movq	%rbx, %rax
+	movl	$255, %ecx
+	subq	%rdx, %rax
+	movq	%rax, %rdi
+	shrq	$4, %rdi
+	cmpq	%rcx, %rdi
+	cmovbe	%rdi, %rcx
+	testq	%rdi, %rdi
+	je	.L1171
+	addq	%rbp, %rdx
+	pxor	%xmm2, %xmm2
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L1172:
+	movdqu	(%rdx), %xmm0
+	movdqa	%xmm2, %xmm1
+	addq	$1, %rax
+	addq	$16, %rdx
+	pcmpeqb	%xmm4, %xmm0
+	psubb	%xmm0, %xmm1
+	movdqa	%xmm1, %xmm2
+	cmpq	%rcx, %rax
+	jb	.L1172
+	subq	$1, %rcx
+	psadbw	%xmm3, %xmm1
+	salq	$4, %rcx
+	movhlps	%xmm1, %xmm7
+	movq	%xmm1, %rax
+	testq	%rdi, %rdi
+	cmove	%r8, %rcx
+	leaq	(%rcx,%r9), %rdx
+	movq	%xmm7, %rcx
+	addq	%rcx, %rax
+	leaq	16(%rdx), %r9
+	addq	%rax, %rsi
+	cmpq	%r9, %rbx
+	jnb	.L1173
+	subq	%rdx, %rbx
+.L1175:
+	testq	%rbx, %rbx
+	je	.L1152
+	leaq	-1(%rbx), %rax
+	cmpq	$14, %rax
+	jbe	.L1191
+	movq	%rbx, %rcx
+	pxor	%xmm6, %xmm6
+	pxor	%xmm8, %xmm8
+	addq	%rbp, %rdx
+	andq	$-16, %rcx
+	pxor	%xmm7, %xmm7
+	pxor	%xmm5, %xmm5
+	movq	%rdx, %rax
+	movdqa	.LC85(%rip), %xmm3
+	addq	%rdx, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L1179:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqb	%xmm4, %xmm0
+	pand	%xmm3, %xmm0
+	movdqa	%xmm0, %xmm2
+	punpckhbw	%xmm8, %xmm0
+	punpcklbw	%xmm8, %xmm2
+	movdqa	%xmm0, %xmm9
+	punpckhwd	%xmm7, %xmm0
+	movdqa	%xmm2, %xmm1
+	punpckhwd	%xmm7, %xmm2
+	punpcklwd	%xmm7, %xmm9
+	punpcklwd	%xmm7, %xmm1
+	movdqa	%xmm1, %xmm10
+	punpckhdq	%xmm5, %xmm1
+	punpckldq	%xmm5, %xmm10
+	paddq	%xmm10, %xmm1
+	movdqa	%xmm2, %xmm10
+	punpckhdq	%xmm5, %xmm2
+	punpckldq	%xmm5, %xmm10
+	paddq	%xmm10, %xmm2
+	paddq	%xmm2, %xmm1
+	movdqa	%xmm9, %xmm2
+	punpckhdq	%xmm5, %xmm9
+	punpckldq	%xmm5, %xmm2
+	paddq	%xmm2, %xmm9
+	movdqa	%xmm0, %xmm2
+	punpckhdq	%xmm5, %xmm0
+	punpckldq	%xmm5, %xmm2
+	paddq	%xmm6, %xmm0
+	paddq	%xmm2, %xmm9
+	paddq	%xmm9, %xmm1
+	movdqa	%xmm1, %xmm6
+	paddq	%xmm0, %xmm6
+	cmpq	%rax, %rcx
+	jne	.L1179
+	movdqa	%xmm6, %xmm0
+	movq	%rbx, %rcx
+	psrldq	$8, %xmm0
+	andq	$-16, %rcx
+	paddq	%xmm0, %xmm6
+	movq	%xmm6, %rax
+	testb	$15, %bl
+	je	.L1216
+.L1177:
+	xorl	%edi, %edi
+	cmpb	%r12b, (%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	1(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L1216
+	xorl	%edi, %edi
+	cmpb	%r12b, 1(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	2(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L1216
+	xorl	%edi, %edi
+	cmpb	%r12b, 2(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	3(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L1216
+	xorl	%edi, %edi
+	cmpb	%r12b, 3(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	4(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L1216
+	xorl	%edi, %edi
+	cmpb	%r12b, 4(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	5(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L1216
+	xorl	%edi, %edi
+	cmpb	%r12b, 5(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	6(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L1216
+	xorl	%edi, %edi
+	cmpb	%r12b, 6(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	7(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L1216
+	xorl	%edi, %edi
+	cmpb	%r12b, 7(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	8(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L1216
+	xorl	%edi, %edi
+	cmpb	%r12b, 8(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	9(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L1216
+	xorl	%edi, %edi
+	cmpb	%r12b, 9(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	10(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L1216
+	xorl	%edi, %edi
+	cmpb	%r12b, 10(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	11(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L1216
+	xorl	%edi, %edi
+	cmpb	%r12b, 11(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	12(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L1216
+	xorl	%edi, %edi
+	cmpb	%r12b, 12(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	13(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L1216
+	xorl	%edi, %edi
+	cmpb	%r12b, 13(%rdx,%rcx)
+	sete	%dil
+	addq	$14, %rcx
+	addq	%rdi, %rax
+	cmpq	%rbx, %rcx
+	jnb	.L1216
+	cmpb	%r12b, (%rdx,%rcx)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+	jmp	.L1216
+	.p2align 4,,10
+	.p2align 3
+.L1166:
+	movsbl	%r12b, %edx
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n14__avx512_countIcEEmPKT_mS1_
+.L1219:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r14
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1161
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1187
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1163:
+	movq	%r14, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1161
+.L1187:
+	movl	$3, %eax
+	jmp	.L1163
+.L1170:
+	xorl	%eax, %eax
+	xorl	%ecx, %ecx
+	movq	%rbp, %rdx
+	testq	%rbx, %rbx
+	jne	.L1177
+	jmp	.L1152
+.L1192:
+	xorl	%esi, %esi
+	xorl	%eax, %eax
+	jmp	.L1181
+.L1185:
+	movl	$3, %eax
+	jmp	.L1156
+.L1191:
+	xorl	%eax, %eax
+	xorl	%ecx, %ecx
+	addq	%rbp, %rdx
+	jmp	.L1177
+.L1171:
+	pxor	%xmm0, %xmm0
+	psadbw	%xmm0, %xmm0
+	movhlps	%xmm0, %xmm3
+	movq	%xmm0, %rdi
+	movq	%xmm3, %rcx
+	addq	%rdi, %rcx
+	addq	%rcx, %rsi
+	cmpq	%r9, %rbx
+	jb	.L1189
+.L1176:
+	jmp	.L1176
+.L1189:
+	movq	%rax, %rbx
+	jmp	.L1175
+	.cfi_endproc
+.LFE6935:
+	.size	_ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE, .-_ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE
+	.section	.rodata.str1.1
+.LC86:
+	.string	"banana"
+.LC87:
+	.string	"chunked"
+	.section	.rodata.str1.8
+	.align 8
+.LC88:
+	.string	"expected equal : expected value : s.next_chunk(2).len(), actual value : 2"
+	.align 8
+.LC89:
+	.string	"expected equal : expected value : s.next_chunk(8).len(), actual value : 1"
+	.align 8
+.LC90:
+	.string	"expected equal : expected value : n::count(n::cstring_iterator(\"banana\"), 'a'), actual value : 3"
+	.align 8
+.LC91:
+	.string	"expected equal : expected value : out.len(), actual value : 7"
+	.section	.text.unlikely
+.LCOLDB92:
+	.text
+.LHOTB92:
+	.p2align 4
+	.globl	_Z15test_next_chunkv
+	.type	_Z15test_next_chunkv, @function
+_Z15test_next_chunkv:
+.LFB6863:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6863
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$2, %esi
+	leaq	.LC21(%rip), %rdi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	call	strnlen@PLT
+	cmpq	$2, %rax
+	jne	.L1280
+	movl	$8, %esi
+	leaq	2+.LC21(%rip), %rdi
+	call	strnlen@PLT
+	cmpq	$1, %rax
+	jne	.L1281
+	leaq	.LC86(%rip), %r12
+	movl	$4096, %esi
+	xorl	%r13d, %r13d
+	movq	%r12, %rdi
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r14
+	call	strnlen@PLT
+	movq	%rax, %rbx
+	leaq	(%r12,%rax), %rbp
+	testq	%rax, %rax
+	jne	.L1224
+	jmp	.L1231
+	.p2align 4,,10
+	.p2align 3
+.L1226:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %ecx
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	movl	$97, %edx
+	movq	%rbp, %r12
+	call	_ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE
+	movl	$4096, %esi
+	movq	%rbp, %rdi
+	addq	%rax, %r13
+	call	strnlen@PLT
+	movq	%rax, %rbx
+	leaq	0(%rbp,%rax), %rax
+	testq	%rbx, %rbx
+	je	.L1286
+	movq	%rax, %rbp
+.L1224:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	jne	.L1226
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1226
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1256
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1228:
+	movq	%r14, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1226
+	.p2align 4,,10
+	.p2align 3
+.L1286:
+.L1263:
+	cmpq	$3, %r13
+	jne	.L1231
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, 16(%rsp)
+	testq	%rax, %rax
+	je	.L1287
+.L1232:
+	leaq	.LC87(%rip), %r12
+	movl	$4096, %esi
+	movq	%r12, %rdi
+	call	strnlen@PLT
+	movq	%rax, %rbp
+	leaq	(%r12,%rax), %r14
+	testq	%rax, %rax
+	je	.L1259
+	movq	$0, 8(%rsp)
+	xorl	%r15d, %r15d
+	jmp	.L1250
+	.p2align 4,,10
+	.p2align 3
+.L1290:
+	leaq	(%r15,%rax), %r13
+	cmpq	%r13, %r12
+	jnb	.L1237
+	cmpq	%rbx, 8(%rsp)
+	jb	.L1288
+	.p2align 4,,10
+	.p2align 3
+.L1244:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movq	%r13, %rdi
+	movq	%r14, %r12
+	call	memcpy@PLT
+	movl	$4096, %esi
+	movq	%r14, %rdi
+	call	strnlen@PLT
+	movq	%rax, %rbp
+	leaq	(%r14,%rax), %rax
+	testq	%rbp, %rbp
+	je	.L1289
+	movq	%rax, %r14
+.L1250:
+	movq	%rbx, (%rsp)
+	movq	%rbx, %rax
+	addq	%rbp, %rbx
+	cmpq	%r15, %r12
+	jnb	.L1290
+.L1237:
+	cmpq	%rbx, 8(%rsp)
+	jb	.L1245
+	movq	(%rsp), %r13
+	addq	%r15, %r13
+	jmp	.L1244
+	.p2align 4,,10
+	.p2align 3
+.L1245:
+	movq	8(%rsp), %rax
+	movq	16(%rsp), %rdi
+	movl	$1, %edx
+	leaq	10(%rax,%rax), %rax
+	cmpq	%rbx, %rax
+	cmovb	%rbx, %rax
+	movq	%rax, 24(%rsp)
+	movq	%rax, %rsi
+	movq	(%rdi), %rax
+.LEHB45:
+	call	*16(%rax)
+.LEHE45:
+	cmpq	$0, (%rsp)
+	movq	%rax, %r13
+	jne	.L1291
+	testq	%r15, %r15
+	jne	.L1247
+	movq	24(%rsp), %rax
+	movq	%r13, %r15
+	movq	%rax, 8(%rsp)
+	jmp	.L1244
+	.p2align 4,,10
+	.p2align 3
+.L1291:
+	movq	(%rsp), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+.L1247:
+	movq	16(%rsp), %rdi
+	movq	8(%rsp), %rdx
+	movl	$1, %ecx
+	movq	%r15, %rsi
+	movq	(%rdi), %rax
+.LEHB46:
+	call	*24(%rax)
+.LEHE46:
+	movq	24(%rsp), %rax
+	movq	%r13, %r15
+	movq	%rax, 8(%rsp)
+	movq	(%rsp), %rax
+	addq	%rax, %r13
+	jmp	.L1244
+	.p2align 4,,10
+	.p2align 3
+.L1289:
+	cmpq	$7, %rbx
+	jne	.L1282
+	testq	%r15, %r15
+	je	.L1221
+	movq	16(%rsp), %rdi
+	movq	8(%rsp), %rdx
+	movl	$1, %ecx
+	movq	%r15, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1221:
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1288:
+	.cfi_restore_state
+	movq	8(%rsp), %rax
+	movq	16(%rsp), %rdi
+	movl	$1, %edx
+	leaq	10(%rax,%rax), %rax
+	cmpq	%rbx, %rax
+	cmovb	%rbx, %rax
+	movq	%rax, 24(%rsp)
+	movq	%rax, %rsi
+	movq	(%rdi), %rax
+.LEHB47:
+	call	*16(%rax)
+.LEHE47:
+	subq	%r15, %r12
+	cmpq	$0, (%rsp)
+	movq	%rax, %r13
+	jne	.L1292
+	testq	%r15, %r15
+	jne	.L1240
+	addq	%rax, %r12
+	movq	24(%rsp), %rax
+	movq	%r13, %r15
+	movq	%rax, 8(%rsp)
+	jmp	.L1244
+	.p2align 4,,10
+	.p2align 3
+.L1292:
+	movq	(%rsp), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+.L1240:
+	movq	16(%rsp), %rdi
+	movq	8(%rsp), %rdx
+	movl	$1, %ecx
+	movq	%r15, %rsi
+	movq	(%rdi), %rax
+.LEHB48:
+	call	*24(%rax)
+.LEHE48:
+	movq	%r13, %r15
+	movq	24(%rsp), %rax
+	addq	%r13, %r12
+	movq	(%rsp), %r13
+	movq	%rax, 8(%rsp)
+	addq	%r15, %r13
+	jmp	.L1244
+	.p2align 4,,10
+	.p2align 3
+.L1287:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1293
+.L1234:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	%rax, 16(%rsp)
+	jmp	.L1232
+	.p2align 4,,10
+	.p2align 3
+.L1256:
+	movl	$3, %eax
+	jmp	.L1228
+	.p2align 4,,10
+	.p2align 3
+.L1259:
+	xorl	%r15d, %r15d
+.L1236:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC91(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB49:
+	call	__cxa_throw@PLT
+.LEHE49:
+	.p2align 4,,10
+	.p2align 3
+.L1293:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1234
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1234
+.L1264:
+	movq	%rax, %rbx
+	jmp	.L1253
+.L1265:
+	movq	%rax, %rbx
+	jmp	.L1249
+.L1262:
+	movq	%rax, %rbx
+	jmp	.L1243
+.L1266:
+	movq	%rax, %rbx
+	jmp	.L1242
+	.section	.gcc_except_table
+.LLSDA6863:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6863-.LLSDACSB6863
+.LLSDACSB6863:
+	.uleb128 .LEHB45-.LFB6863
+	.uleb128 .LEHE45-.LEHB45
+	.uleb128 .L1262-.LFB6863
+	.uleb128 0
+	.uleb128 .LEHB46-.LFB6863
+	.uleb128 .LEHE46-.LEHB46
+	.uleb128 .L1265-.LFB6863
+	.uleb128 0
+	.uleb128 .LEHB47-.LFB6863
+	.uleb128 .LEHE47-.LEHB47
+	.uleb128 .L1262-.LFB6863
+	.uleb128 0
+	.uleb128 .LEHB48-.LFB6863
+	.uleb128 .LEHE48-.LEHB48
+	.uleb128 .L1266-.LFB6863
+	.uleb128 0
+	.uleb128 .LEHB49-.LFB6863
+	.uleb128 .LEHE49-.LEHB49
+	.uleb128 .L1264-.LFB6863
+	.uleb128 0
+.LLSDACSE6863:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6863
+	.type	_Z15test_next_chunkv.cold, @function
+_Z15test_next_chunkv.cold:
+.LFSB6863:
+.L1231:
+	.cfi_def_cfa_offset 96
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC90(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB50:
+	call	__cxa_throw@PLT
+.LEHE50:
+.L1253:
+	movq	%rbp, 8(%rsp)
+.L1243:
+	testq	%r15, %r15
+	je	.L1254
+	movq	16(%rsp), %rdi
+	movq	8(%rsp), %rdx
+	movl	$1, %ecx
+	movq	%r15, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1254:
+	movq	%rbx, %rdi
+.LEHB51:
+	call	_Unwind_Resume@PLT
+.L1282:
+	movq	8(%rsp), %rbp
+	jmp	.L1236
+.L1249:
+	movq	24(%rsp), %rax
+	movq	%r13, %r15
+	movq	%rax, 8(%rsp)
+	jmp	.L1243
+.L1281:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC89(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L1280:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC88(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE51:
+.L1242:
+	movq	24(%rsp), %rax
+	movq	%r13, %r15
+	movq	%rax, 8(%rsp)
+	jmp	.L1243
+	.cfi_endproc
+.LFE6863:
+	.section	.gcc_except_table
+.LLSDAC6863:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6863-.LLSDACSBC6863
+.LLSDACSBC6863:
+	.uleb128 .LEHB50-.LCOLDB92
+	.uleb128 .LEHE50-.LEHB50
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB51-.LCOLDB92
+	.uleb128 .LEHE51-.LEHB51
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6863:
+	.section	.text.unlikely
+	.text
+	.size	_Z15test_next_chunkv, .-_Z15test_next_chunkv
+	.section	.text.unlikely
+	.size	_Z15test_next_chunkv.cold, .-_Z15test_next_chunkv.cold
+.LCOLDE92:
+	.text
+.LHOTE92:
+	.section	.rodata.str1.1
+.LC93:
+	.string	"a\nb\nc\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC94:
+	.string	"expected equal : expected value : n::count(s.iter(), '\\n'), actual value : 3"
+	.align 8
+.LC95:
+	.string	"expected equal : expected value : n::count(n::cstring_iterator(\"a\\nb\\nc\\n\"), '\\n'), actual value : 3"
+	.align 8
+.LC97:
+	.string	"expected equal : expected value : n::count(s.iter(), [](char c) { return c != '\\n'; }), actual value : 3"
+	.section	.text.unlikely
+.LCOLDB98:
+	.text
+.LHOTB98:
+	.p2align 4
+	.globl	_Z10test_countv
+	.type	_Z10test_countv, @function
+_Z10test_countv:
+.LFB6777:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6777
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	movdqa	.LC11(%rip), %xmm0
+	movaps	%xmm0, 16(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L1295
+	pxor	%xmm0, %xmm0
+	leaq	40(%rsp), %r14
+	movq	%rax, 32(%rsp)
+	xorl	%ebp, %ebp
+	leaq	.LC93(%rip), %r12
+	movups	%xmm0, 40(%rsp)
+	movq	$0, 56(%rsp)
+	cmpq	%r14, %r12
+	jb	.L1370
+.L1402:
+	leaq	.LC93(%rip), %rsi
+.L1406:
+	movq	%r14, %rbx
+.L1296:
+	leaq	(%rbx,%rbp), %rdi
+	movl	$6, %edx
+	call	memmove@PLT
+	movq	16(%rsp), %rax
+	leaq	6(%rax), %rdx
+	movq	%rdx, 16(%rsp)
+	movb	$0, 6(%rbx,%rax)
+	cmpq	$23, 24(%rsp)
+	leaq	40(%rsp), %rbx
+	movq	16(%rsp), %rbp
+	je	.L1309
+	movq	40(%rsp), %rbx
+.L1309:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1407
+.L1311:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %ecx
+	movl	$10, %edx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	_ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE
+	cmpq	$3, %rax
+	jne	.L1314
+	movq	%r12, %rdi
+	movl	$4096, %esi
+	xorl	%r13d, %r13d
+	call	strnlen@PLT
+	leaq	.LC93(%rip), %rbp
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r14
+	movq	%rax, %rbx
+	addq	%rax, %r12
+	testq	%rax, %rax
+	jne	.L1318
+	jmp	.L1325
+	.p2align 4,,10
+	.p2align 3
+.L1320:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %ecx
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	movl	$10, %edx
+	movq	%r12, %rbp
+	call	_ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE
+	movl	$4096, %esi
+	movq	%r12, %rdi
+	addq	%rax, %r13
+	call	strnlen@PLT
+	movq	%rax, %rbx
+	leaq	(%r12,%rax), %rax
+	testq	%rbx, %rbx
+	je	.L1408
+	movq	%rax, %r12
+.L1318:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	jne	.L1320
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1320
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1364
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1322:
+	movq	%r14, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1320
+	.p2align 4,,10
+	.p2align 3
+.L1408:
+.L1373:
+	movq	24(%rsp), %r10
+	cmpq	$3, %r13
+	jne	.L1325
+	movq	16(%rsp), %rax
+	leaq	40(%rsp), %rdi
+	cmpq	$23, %r10
+	je	.L1326
+	movq	40(%rsp), %rdi
+.L1326:
+	movl	$4096, %edx
+	movq	%rax, %r8
+	cmpq	%rdx, %rax
+	cmovbe	%rax, %rdx
+	xorl	%esi, %esi
+	leaq	(%rdi,%rdx), %r9
+	subq	%rdx, %r8
+	testq	%rax, %rax
+	je	.L1328
+	leaq	-1(%rdx), %rax
+	movdqa	.LC85(%rip), %xmm7
+	pxor	%xmm6, %xmm6
+	pxor	%xmm4, %xmm4
+	movdqa	.LC96(%rip), %xmm8
+	pxor	%xmm3, %xmm3
+	cmpq	$14, %rax
+	jbe	.L1409
+	.p2align 4,,10
+	.p2align 3
+.L1403:
+	movq	%rdx, %rcx
+	movq	%rdi, %rax
+	pxor	%xmm5, %xmm5
+	andq	$-16, %rcx
+	addq	%rdi, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L1329:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqb	%xmm8, %xmm0
+	pandn	%xmm7, %xmm0
+	movdqa	%xmm0, %xmm2
+	punpckhbw	%xmm6, %xmm0
+	punpcklbw	%xmm6, %xmm2
+	movdqa	%xmm0, %xmm9
+	punpckhwd	%xmm4, %xmm0
+	movdqa	%xmm2, %xmm1
+	punpckhwd	%xmm4, %xmm2
+	punpcklwd	%xmm4, %xmm9
+	punpcklwd	%xmm4, %xmm1
+	movdqa	%xmm1, %xmm10
+	punpckldq	%xmm3, %xmm1
+	punpckhdq	%xmm3, %xmm10
+	paddq	%xmm10, %xmm1
+	movdqa	%xmm2, %xmm10
+	punpckhdq	%xmm3, %xmm2
+	punpckldq	%xmm3, %xmm10
+	paddq	%xmm10, %xmm2
+	paddq	%xmm2, %xmm1
+	movdqa	%xmm9, %xmm2
+	punpckhdq	%xmm3, %xmm9
+	punpckldq	%xmm3, %xmm2
+	paddq	%xmm2, %xmm9
+	movdqa	%xmm0, %xmm2
+	punpckhdq	%xmm3, %xmm0
+	punpckldq	%xmm3, %xmm2
+	paddq	%xmm5, %xmm0
+	paddq	%xmm2, %xmm9
+	paddq	%xmm9, %xmm1
+	movdqa	%xmm1, %xmm5
+	paddq	%xmm0, %xmm5
+	cmpq	%rcx, %rax
+	jne	.L1329
+	movdqa	%xmm5, %xmm0
+	psrldq	$8, %xmm0
+	paddq	%xmm0, %xmm5
+	movq	%xmm5, %rax
+	addq	%rax, %rsi
+	movq	%rdx, %rax
+	andq	$-16, %rax
+	testb	$15, %dl
+	je	.L1330
+.L1348:
+	cmpb	$10, (%rdi,%rax)
+	je	.L1331
+	addq	$1, %rsi
+.L1331:
+	leaq	1(%rax), %rcx
+	cmpq	%rdx, %rcx
+	jnb	.L1330
+	cmpb	$10, 1(%rdi,%rax)
+	je	.L1332
+	addq	$1, %rsi
+.L1332:
+	leaq	2(%rax), %rcx
+	cmpq	%rdx, %rcx
+	jnb	.L1330
+	cmpb	$10, 2(%rdi,%rax)
+	je	.L1333
+	addq	$1, %rsi
+.L1333:
+	leaq	3(%rax), %rcx
+	cmpq	%rdx, %rcx
+	jnb	.L1330
+	cmpb	$10, 3(%rdi,%rax)
+	je	.L1334
+	addq	$1, %rsi
+.L1334:
+	leaq	4(%rax), %rcx
+	cmpq	%rdx, %rcx
+	jnb	.L1330
+	cmpb	$10, 4(%rdi,%rax)
+	je	.L1335
+	addq	$1, %rsi
+.L1335:
+	leaq	5(%rax), %rcx
+	cmpq	%rdx, %rcx
+	jnb	.L1330
+	cmpb	$10, 5(%rdi,%rax)
+	je	.L1336
+	addq	$1, %rsi
+.L1336:
+	leaq	6(%rax), %rcx
+	cmpq	%rdx, %rcx
+	jnb	.L1330
+	cmpb	$10, 6(%rdi,%rax)
+	je	.L1337
+	addq	$1, %rsi
+.L1337:
+	leaq	7(%rax), %rcx
+	cmpq	%rdx, %rcx
+	jnb	.L1330
+	cmpb	$10, 7(%rdi,%rax)
+	je	.L1338
+	addq	$1, %rsi
+.L1338:
+	leaq	8(%rax), %rcx
+	cmpq	%rdx, %rcx
+	jnb	.L1330
+	cmpb	$10, 8(%rdi,%rax)
+	je	.L1339
+	addq	$1, %rsi
+.L1339:
+	leaq	9(%rax), %rcx
+	cmpq	%rdx, %rcx
+	jnb	.L1330
+	cmpb	$10, 9(%rdi,%rax)
+	je	.L1340
+	addq	$1, %rsi
+.L1340:
+	leaq	10(%rax), %rcx
+	cmpq	%rdx, %rcx
+	jnb	.L1330
+	cmpb	$10, 10(%rdi,%rax)
+	je	.L1341
+	addq	$1, %rsi
+.L1341:
+	leaq	11(%rax), %rcx
+	cmpq	%rdx, %rcx
+	jnb	.L1330
+	cmpb	$10, 11(%rdi,%rax)
+	je	.L1342
+	addq	$1, %rsi
+.L1342:
+	leaq	12(%rax), %rcx
+	cmpq	%rdx, %rcx
+	jnb	.L1330
+	cmpb	$10, 12(%rdi,%rax)
+	je	.L1343
+	addq	$1, %rsi
+.L1343:
+	leaq	13(%rax), %rcx
+	cmpq	%rdx, %rcx
+	jnb	.L1330
+	cmpb	$10, 13(%rdi,%rax)
+	je	.L1344
+	addq	$1, %rsi
+.L1344:
+	leaq	14(%rax), %rcx
+	cmpq	%rdx, %rcx
+	jnb	.L1330
+	cmpb	$10, 14(%rdi,%rax)
+	je	.L1330
+	addq	$1, %rsi
+	.p2align 4,,10
+	.p2align 3
+.L1330:
+	movl	$4096, %edx
+	movq	%r8, %rax
+	movq	%r9, %rdi
+	cmpq	%rdx, %r8
+	cmovbe	%r8, %rdx
+	leaq	(%r9,%rdx), %rcx
+	subq	%rdx, %rax
+	testq	%r8, %r8
+	je	.L1347
+	movq	%rax, %r8
+	leaq	-1(%rdx), %rax
+	movq	%rcx, %r9
+	cmpq	$14, %rax
+	ja	.L1403
+.L1409:
+	xorl	%eax, %eax
+	jmp	.L1348
+	.p2align 4,,10
+	.p2align 3
+.L1347:
+	cmpq	$3, %rsi
+	jne	.L1328
+	cmpq	$23, %r10
+	je	.L1294
+	movq	32(%rsp), %rdi
+	movq	40(%rsp), %rsi
+	leaq	1(%r10), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1294:
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L1407:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1311
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1361
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1313:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1311
+.L1370:
+	movq	%r12, %rsi
+	jmp	.L1406
+.L1295:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1410
+.L1300:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	16(%rsp), %rbp
+	pxor	%xmm0, %xmm0
+	xorl	%r14d, %r14d
+	movq	24(%rsp), %rcx
+	movups	%xmm0, 40(%rsp)
+	leaq	.LC93(%rip), %r12
+	movq	%r15, 32(%rsp)
+	leaq	6(%rbp), %rax
+	movq	$0, 56(%rsp)
+	cmpq	$23, %rcx
+	je	.L1411
+.L1302:
+	leaq	(%r14,%rbp), %rdx
+	cmpq	%rdx, %r12
+	jnb	.L1412
+	movq	%r12, %rbx
+	subq	%r14, %rbx
+	movq	%rbx, (%rsp)
+	cmpq	%rax, %rcx
+	jnb	.L1358
+	leaq	10(%rcx,%rcx), %rdx
+	movq	%rcx, 8(%rsp)
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %r13
+	movq	(%r15), %rax
+.LEHB52:
+	call	*16(%rax)
+	leaq	1(%rbp), %rdx
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	movq	8(%rsp), %rcx
+	cmpq	$23, %rcx
+	je	.L1306
+	movq	(%r15), %rax
+	leaq	1(%rcx), %rdx
+	xorl	%esi, %esi
+	movl	$1, %ecx
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L1306:
+	movq	%rbx, 40(%rsp)
+	movq	%r13, %rcx
+	movq	%r13, 24(%rsp)
+.L1305:
+	cmpq	$23, %rcx
+	je	.L1307
+	movq	(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L1296
+.L1412:
+	cmpq	%rax, %rcx
+	jnb	.L1357
+	leaq	10(%rcx,%rcx), %rdx
+	movq	%rcx, (%rsp)
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %r13
+	movq	(%r15), %rax
+	call	*16(%rax)
+	leaq	1(%rbp), %rdx
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	movq	(%rsp), %rcx
+	cmpq	$23, %rcx
+	je	.L1304
+	movq	(%r15), %rax
+	leaq	1(%rcx), %rdx
+	xorl	%esi, %esi
+	movl	$1, %ecx
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L1304:
+	movq	%rbx, 40(%rsp)
+	movq	%r13, 24(%rsp)
+.L1298:
+	leaq	.LC93(%rip), %rsi
+	cmpq	$23, %r13
+	jne	.L1296
+	leaq	40(%rsp), %r14
+	jmp	.L1402
+.L1364:
+	movl	$3, %eax
+	jmp	.L1322
+.L1410:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1300
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1300
+.L1357:
+	xorl	%ebx, %ebx
+	movq	%rcx, %r13
+	jmp	.L1298
+.L1361:
+	movl	$3, %eax
+	jmp	.L1313
+.L1358:
+	xorl	%ebx, %ebx
+	jmp	.L1305
+.L1307:
+	movq	(%rsp), %rsi
+	leaq	40(%rsp), %r14
+	addq	%r14, %rsi
+	jmp	.L1406
+.L1411:
+	leaq	40(%rsp), %r14
+	cmpq	%r14, %r12
+	jnb	.L1302
+	cmpq	$23, %rax
+	jbe	.L1370
+	movl	$56, %edx
+	movq	%r15, %rdi
+	cmpq	%rdx, %rax
+	cmovnb	%rax, %rdx
+	movq	(%r15), %rax
+	leaq	1(%rdx), %rsi
+	movq	%rdx, %r13
+	movl	$1, %edx
+	call	*16(%rax)
+.LEHE52:
+	movq	%r14, %rsi
+	leaq	1(%rbp), %rdx
+	movq	%rax, %rbx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	%rbx, 40(%rsp)
+	movq	%r12, %rsi
+	movq	%r13, 24(%rsp)
+	jmp	.L1296
+.L1372:
+	.section	.gcc_except_table
+.LLSDA6777:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6777-.LLSDACSB6777
+.LLSDACSB6777:
+	.uleb128 .LEHB52-.LFB6777
+	.uleb128 .LEHE52-.LEHB52
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6777:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6777
+	.type	_Z10test_countv.cold, @function
+_Z10test_countv.cold:
+.LFSB6777:
+.L1314:
+	.cfi_def_cfa_offset 128
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC94(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB53:
+	call	__cxa_throw@PLT
+.L1328:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC97(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L1325:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC95(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE53:
+.L1371:
+	movq	%rax, %rbx
+	movq	24(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L1352
+	movq	32(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	40(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1352:
+	movq	%rbx, %rdi
+.LEHB54:
+	call	_Unwind_Resume@PLT
+.LEHE54:
+	.cfi_endproc
+.LFE6777:
+	.section	.gcc_except_table
+.LLSDAC6777:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6777-.LLSDACSBC6777
+.LLSDACSBC6777:
+	.uleb128 .LEHB53-.LCOLDB98
+	.uleb128 .LEHE53-.LEHB53
+	.uleb128 .L1371-.LCOLDB98
+	.uleb128 0
+	.uleb128 .LEHB54-.LCOLDB98
+	.uleb128 .LEHE54-.LEHB54
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6777:
+	.section	.text.unlikely
+	.text
+	.size	_Z10test_countv, .-_Z10test_countv
+	.section	.text.unlikely
+	.size	_Z10test_countv.cold, .-_Z10test_countv.cold
+.LCOLDE98:
+	.text
+.LHOTE98:
+	.weak	_ZTSN1n15memory_resourceE
+	.section	.rodata._ZTSN1n15memory_resourceE,"aG",@progbits,_ZTSN1n15memory_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n15memory_resourceE, @object
+	.size	_ZTSN1n15memory_resourceE, 22
+_ZTSN1n15memory_resourceE:
+	.string	"N1n15memory_resourceE"
+	.weak	_ZTIN1n15memory_resourceE
+	.section	.data.rel.ro._ZTIN1n15memory_resourceE,"awG",@progbits,_ZTIN1n15memory_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n15memory_resourceE, @object
+	.size	_ZTIN1n15memory_resourceE, 16
+_ZTIN1n15memory_resourceE:
+	.quad	_ZTVN10__cxxabiv117__class_type_infoE+16
+	.quad	_ZTSN1n15memory_resourceE
+	.weak	_ZTSN1n13heap_resourceE
+	.section	.rodata._ZTSN1n13heap_resourceE,"aG",@progbits,_ZTSN1n13heap_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n13heap_resourceE, @object
+	.size	_ZTSN1n13heap_resourceE, 20
+_ZTSN1n13heap_resourceE:
+	.string	"N1n13heap_resourceE"
+	.weak	_ZTIN1n13heap_resourceE
+	.section	.data.rel.ro._ZTIN1n13heap_resourceE,"awG",@progbits,_ZTIN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n13heap_resourceE, @object
+	.size	_ZTIN1n13heap_resourceE, 24
+_ZTIN1n13heap_resourceE:
+	.quad	_ZTVN10__cxxabiv120__si_class_type_infoE+16
+	.quad	_ZTSN1n13heap_resourceE
+	.quad	_ZTIN1n15memory_resourceE
+	.weak	_ZTVN1n13heap_resourceE
+	.section	.data.rel.ro.local._ZTVN1n13heap_resourceE,"awG",@progbits,_ZTVN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTVN1n13heap_resourceE, @object
+	.size	_ZTVN1n13heap_resourceE, 48
+_ZTVN1n13heap_resourceE:
+	.quad	0
+	.quad	_ZTIN1n13heap_resourceE
+	.quad	_ZN1n13heap_resourceD1Ev
+	.quad	_ZN1n13heap_resourceD0Ev
+	.quad	_ZN1n13heap_resource8allocateEmm
+	.quad	_ZN1n13heap_resource10deallocateEPvmm
+	.weak	_ZN1n18__current_resourceE
+	.section	.tbss._ZN1n18__current_resourceE,"awTG",@nobits,_ZN1n18__current_resourceE,comdat
+	.align 8
+	.type	_ZN1n18__current_resourceE, @gnu_unique_object
+	.size	_ZN1n18__current_resourceE, 8
+_ZN1n18__current_resourceE:
+	.zero	8
+	.weak	_ZGVZN1n4heapEvE3res
+	.section	.bss._ZGVZN1n4heapEvE3res,"awG",@nobits,_ZGVZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZGVZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZGVZN1n4heapEvE3res, 8
+_ZGVZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE3res
+	.section	.bss._ZZN1n4heapEvE3res,"awG",@nobits,_ZZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZZN1n4heapEvE3res, 8
+_ZZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE7storage
+	.section	.bss._ZZN1n4heapEvE7storage,"awG",@nobits,_ZZN1n4heapEvE7storage,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE7storage, @gnu_unique_object
+	.size	_ZZN1n4heapEvE7storage, 8
+_ZZN1n4heapEvE7storage:
+	.zero	8
+	.weak	_ZGVZN1n9simd_bestEvE4best
+	.section	.bss._ZGVZN1n9simd_bestEvE4best,"awG",@nobits,_ZGVZN1n9simd_bestEvE4best,comdat
+	.align 8
+	.type	_ZGVZN1n9simd_bestEvE4best, @gnu_unique_object
+	.size	_ZGVZN1n9simd_bestEvE4best, 8
+_ZGVZN1n9simd_bestEvE4best:
+	.zero	8
+	.weak	_ZZN1n9simd_bestEvE4best
+	.section	.bss._ZZN1n9simd_bestEvE4best,"awG",@nobits,_ZZN1n9simd_bestEvE4best,comdat
+	.align 4
+	.type	_ZZN1n9simd_bestEvE4best, @gnu_unique_object
+	.size	_ZZN1n9simd_bestEvE4best, 4
+_ZZN1n9simd_bestEvE4best:
+	.zero	4
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC11:
+	.quad	0
+	.quad	23
+	.section	.rodata.cst2,"aM",@progbits,2
+	.align 2
+.LC34:
+	.byte	10
+	.byte	0
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC58:
+	.long	15
+	.long	100
+	.section	.rodata.cst16
+	.align 16
+.LC74:
+	.long	1
+	.long	2
+	.long	1
+	.long	2
+	.align 16
+.LC75:
+	.long	3
+	.long	1
+	.long	2
+	.long	3
+	.align 16
+.LC76:
+	.long	1
+	.long	2
+	.long	3
+	.long	4
+	.set	.LC79,.LC74
+	.align 16
+.LC85:
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.align 16
+.LC96:
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.hidden	DW.ref._ZTIPKc
+	.weak	DW.ref._ZTIPKc
+	.section	.data.rel.local.DW.ref._ZTIPKc,"awG",@progbits,DW.ref._ZTIPKc,comdat
+	.align 8
+	.type	DW.ref._ZTIPKc, @object
+	.size	DW.ref._ZTIPKc, 8
+DW.ref._ZTIPKc:
+	.quad	_ZTIPKc
+	.hidden	DW.ref.__gxx_personality_v0
+	.weak	DW.ref.__gxx_personality_v0
+	.section	.data.rel.local.DW.ref.__gxx_personality_v0,"awG",@progbits,DW.ref.__gxx_personality_v0,comdat
+	.align 8
+	.type	DW.ref.__gxx_personality_v0, @object
+	.size	DW.ref.__gxx_personality_v0, 8
+DW.ref.__gxx_personality_v0:
+	.quad	__gxx_personality_v0
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
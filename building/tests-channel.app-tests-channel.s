@@ -0,0 +1,5521 @@
+	.file	"tests-channel.cpp"
+	.text
+	.section	.text._ZN1n13heap_resourceD2Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD2Ev
+	.type	_ZN1n13heap_resourceD2Ev, @function
+_ZN1n13heap_resourceD2Ev:
+.LFB7071:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7071:
+	.size	_ZN1n13heap_resourceD2Ev, .-_ZN1n13heap_resourceD2Ev
+	.weak	_ZN1n13heap_resourceD1Ev
+	.set	_ZN1n13heap_resourceD1Ev,_ZN1n13heap_resourceD2Ev
+	.section	.text._ZN1n13heap_resource10deallocateEPvmm,"axG",@progbits,_ZN1n13heap_resource10deallocateEPvmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource10deallocateEPvmm
+	.type	_ZN1n13heap_resource10deallocateEPvmm, @function
+_ZN1n13heap_resource10deallocateEPvmm:
+.LFB48:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rcx
+	jbe	.L4
+	movq	%rcx, %rsi
+	jmp	_ZdlPvSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	jmp	_ZdlPv@PLT
+	.cfi_endproc
+.LFE48:
+	.size	_ZN1n13heap_resource10deallocateEPvmm, .-_ZN1n13heap_resource10deallocateEPvmm
+	.section	.text._ZN1n13heap_resource8allocateEmm,"axG",@progbits,_ZN1n13heap_resource8allocateEmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource8allocateEmm
+	.type	_ZN1n13heap_resource8allocateEmm, @function
+_ZN1n13heap_resource8allocateEmm:
+.LFB47:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rdx
+	jbe	.L6
+	movq	%rdx, %rsi
+	jmp	_ZnwmSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	jmp	_Znwm@PLT
+	.cfi_endproc
+.LFE47:
+	.size	_ZN1n13heap_resource8allocateEmm, .-_ZN1n13heap_resource8allocateEmm
+	.section	.text._ZN1n13heap_resourceD0Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD0Ev
+	.type	_ZN1n13heap_resourceD0Ev, @function
+_ZN1n13heap_resourceD0Ev:
+.LFB7073:
+	.cfi_startproc
+	movl	$8, %esi
+	jmp	_ZdlPvm@PLT
+	.cfi_endproc
+.LFE7073:
+	.size	_ZN1n13heap_resourceD0Ev, .-_ZN1n13heap_resourceD0Ev
+	.text
+	.p2align 4
+	.globl	_Z12mpmc_producePv
+	.type	_Z12mpmc_producePv, @function
+_Z12mpmc_producePv:
+.LFB6828:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	xorl	%r14d, %r14d
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	movq	(%rdi), %rbp
+	leaq	64(%rbp), %r12
+	jmp	.L20
+	.p2align 4,,10
+	.p2align 3
+.L26:
+	leaq	1(%rax), %rcx
+	lock cmpxchgq	%rcx, (%r12)
+	jne	.L11
+	testq	%rdx, %rdx
+	je	.L15
+	movq	(%rdx), %rax
+	movl	%r15d, 8(%rdx)
+	addl	$1, %r14d
+	addq	$1, %rax
+	movq	%rax, (%rdx)
+	cmpl	$20000, %r14d
+	je	.L25
+.L20:
+	movl	8(%rbx), %r15d
+	xorl	%r13d, %r13d
+	addl	%r14d, %r15d
+	.p2align 4,,10
+	.p2align 3
+.L9:
+	movq	(%r12), %rax
+.L11:
+	movq	8(%rbp), %rdx
+	andq	%rax, %rdx
+	salq	$4, %rdx
+	addq	0(%rbp), %rdx
+	movq	(%rdx), %rcx
+	cmpq	%rax, %rcx
+	je	.L26
+	jns	.L9
+	.p2align 4,,10
+	.p2align 3
+.L15:
+	cmpl	$63, %r13d
+	ja	.L27
+	rep nop
+	addl	$1, %r13d
+	jmp	.L9
+	.p2align 4,,10
+	.p2align 3
+.L27:
+	call	sched_yield@PLT
+	jmp	.L9
+.L25:
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 56
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE6828:
+	.size	_Z12mpmc_producePv, .-_Z12mpmc_producePv
+	.p2align 4
+	.globl	_Z12spsc_producePv
+	.type	_Z12spsc_producePv, @function
+_Z12spsc_producePv:
+.LFB6811:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	8(%rdi), %rax
+	movq	(%rdi), %rbx
+	movq	%rdi, 8(%rsp)
+	movq	16(%rax), %r13
+	movq	(%rax), %r14
+	testq	%r13, %r13
+	je	.L29
+	leaq	128(%rbx), %rbp
+	.p2align 4,,10
+	.p2align 3
+.L36:
+	movq	136(%rbx), %rax
+	movq	144(%rbx), %rcx
+	movq	8(%rbx), %rdx
+	movq	%rax, %rdi
+	subq	%rcx, %rdi
+	leaq	1(%rdx), %rsi
+	cmpq	%rsi, %rdi
+	jb	.L30
+	leaq	64(%rbx), %r12
+	xorl	%r15d, %r15d
+	movq	%rax, 0(%rbp)
+	.p2align 4,,10
+	.p2align 3
+.L31:
+	movq	136(%rbx), %rax
+	movq	(%r12), %rcx
+	subq	%rcx, %rax
+	movq	%rcx, 144(%rbx)
+	movq	8(%rbx), %rdx
+	leaq	1(%rdx), %rsi
+	cmpq	%rsi, %rax
+	jne	.L47
+	cmpl	$63, %r15d
+	ja	.L32
+	rep nop
+	addl	$1, %r15d
+	jmp	.L31
+	.p2align 4,,10
+	.p2align 3
+.L32:
+	call	sched_yield@PLT
+	jmp	.L31
+	.p2align 4,,10
+	.p2align 3
+.L47:
+	movq	136(%rbx), %rax
+.L30:
+	leaq	1(%rcx,%rdx), %r8
+	subq	%rax, %r8
+	cmpq	%r13, %r8
+	cmova	%r13, %r8
+	testq	%r8, %r8
+	je	.L48
+	movq	%rax, %rcx
+	movq	(%rbx), %r10
+	leaq	(%r8,%rax), %rdi
+	negq	%rcx
+	leaq	(%r14,%rcx,4), %r9
+	.p2align 4,,10
+	.p2align 3
+.L38:
+	movl	(%r9,%rax,4), %esi
+	movq	%rdx, %rcx
+	andq	%rax, %rcx
+	addq	$1, %rax
+	movl	%esi, (%r10,%rcx,4)
+	cmpq	%rax, %rdi
+	jne	.L38
+.L39:
+	movq	%rdi, 136(%rbx)
+	leaq	(%r14,%r8,4), %r14
+	movq	%rdi, 0(%rbp)
+	subq	%r8, %r13
+	jne	.L36
+	movq	8(%rsp), %rax
+	movq	(%rax), %rbx
+.L29:
+	movq	136(%rbx), %rax
+	movq	%rax, 128(%rbx)
+	xorl	%eax, %eax
+	movb	$1, 152(%rbx)
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L48:
+	.cfi_restore_state
+	movq	%rax, %rdi
+	jmp	.L39
+	.cfi_endproc
+.LFE6811:
+	.size	_Z12spsc_producePv, .-_Z12spsc_producePv
+	.p2align 4
+	.globl	_Z23spsc_produce_one_by_onePv
+	.type	_Z23spsc_produce_one_by_onePv, @function
+_Z23spsc_produce_one_by_onePv:
+.LFB6822:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	xorl	%r14d, %r14d
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	leaq	128(%rdi), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movq	%rdi, %rbx
+	.p2align 4,,10
+	.p2align 3
+.L56:
+	movq	136(%rbx), %rax
+	movq	8(%rbx), %rdx
+	movq	%rax, %rsi
+	leaq	1(%rdx), %rcx
+	subq	144(%rbx), %rsi
+	cmpq	%rcx, %rsi
+	jb	.L50
+	leaq	64(%rbx), %r13
+	xorl	%r12d, %r12d
+	movq	%rax, 0(%rbp)
+	.p2align 4,,10
+	.p2align 3
+.L51:
+	movq	136(%rbx), %rax
+	movq	0(%r13), %rcx
+	subq	%rcx, %rax
+	movq	%rcx, 144(%rbx)
+	movq	8(%rbx), %rdx
+	leaq	1(%rdx), %rcx
+	cmpq	%rcx, %rax
+	jne	.L59
+	cmpl	$63, %r12d
+	ja	.L52
+	rep nop
+	addl	$1, %r12d
+	jmp	.L51
+	.p2align 4,,10
+	.p2align 3
+.L52:
+	call	sched_yield@PLT
+	jmp	.L51
+	.p2align 4,,10
+	.p2align 3
+.L59:
+	movq	136(%rbx), %rax
+.L50:
+	movq	(%rbx), %rcx
+	andq	%rax, %rdx
+	addq	$1, %rax
+	movl	%r14d, (%rcx,%rdx,4)
+	movq	%rax, 136(%rbx)
+	movq	0(%rbp), %rdx
+	subq	%rdx, %rax
+	cmpq	16(%rbx), %rax
+	jnb	.L60
+.L55:
+	addl	$1, %r14d
+	cmpl	$50000, %r14d
+	jne	.L56
+	movq	136(%rbx), %rax
+	movq	%rax, 128(%rbx)
+	xorl	%eax, %eax
+	movb	$1, 152(%rbx)
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L60:
+	.cfi_restore_state
+	movq	136(%rbx), %rax
+	movq	%rax, 0(%rbp)
+	jmp	.L55
+	.cfi_endproc
+.LFE6822:
+	.size	_Z23spsc_produce_one_by_onePv, .-_Z23spsc_produce_one_by_onePv
+	.p2align 4
+	.globl	_Z12mpmc_consumePv
+	.type	_Z12mpmc_consumePv, @function
+_Z12mpmc_consumePv:
+.LFB6829:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movq	%rdi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movq	(%rdi), %rbx
+	leaq	128(%rbx), %rbp
+	jmp	.L76
+	.p2align 4,,10
+	.p2align 3
+.L88:
+	leaq	1(%rax), %rcx
+	lock cmpxchgq	%rcx, 0(%rbp)
+	jne	.L62
+.L87:
+	movq	8(%rbx), %rcx
+	movl	8(%rdx), %esi
+	leaq	1(%rax,%rcx), %rax
+	movq	%rax, (%rdx)
+	addq	%rsi, 16(%r13)
+	addl	$1, 24(%r13)
+.L76:
+	xorl	%r12d, %r12d
+	.p2align 4,,10
+	.p2align 3
+.L75:
+	movq	0(%rbp), %rax
+.L62:
+	movq	8(%rbx), %rdx
+	andq	%rax, %rdx
+	salq	$4, %rdx
+	addq	(%rbx), %rdx
+	movq	(%rdx), %rcx
+	subq	$1, %rcx
+	cmpq	%rax, %rcx
+	je	.L88
+	jns	.L75
+	movzbl	192(%rbx), %eax
+	testb	%al, %al
+	jne	.L86
+	cmpl	$63, %r12d
+	ja	.L73
+	rep nop
+	addl	$1, %r12d
+	jmp	.L75
+	.p2align 4,,10
+	.p2align 3
+.L70:
+	js	.L79
+.L86:
+	movq	0(%rbp), %rax
+.L69:
+	movq	8(%rbx), %rdx
+	andq	%rax, %rdx
+	salq	$4, %rdx
+	addq	(%rbx), %rdx
+	movq	(%rdx), %rcx
+	subq	$1, %rcx
+	cmpq	%rax, %rcx
+	jne	.L70
+	leaq	1(%rax), %rcx
+	lock cmpxchgq	%rcx, 0(%rbp)
+	je	.L87
+	jmp	.L69
+	.p2align 4,,10
+	.p2align 3
+.L73:
+	call	sched_yield@PLT
+	jmp	.L75
+.L79:
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE6829:
+	.size	_Z12mpmc_consumePv, .-_Z12mpmc_consumePv
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC0:
+	.string	"expected equal : expected value : count, actual value : total"
+	.align 8
+.LC1:
+	.string	"expected equal : expected value : sum, actual value : total * (total - 1) / 2"
+	.section	.text.unlikely,"ax",@progbits
+.LCOLDB2:
+	.text
+.LHOTB2:
+	.p2align 4
+	.globl	_Z22test_mpmc_many_threadsv
+	.type	_Z22test_mpmc_many_threadsv, @function
+_Z22test_mpmc_many_threadsv:
+.LFB6833:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6833
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	andq	$-64, %rsp
+	subq	$576, %rsp
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rdi
+	testq	%rdi, %rdi
+	je	.L114
+.L90:
+	movq	(%rdi), %rax
+	movl	$8, %edx
+	movl	$2048, %esi
+	movq	$0, 320(%rsp)
+	movq	$127, 328(%rsp)
+	movq	%rdi, 336(%rsp)
+	movq	$0, 384(%rsp)
+	movq	$0, 448(%rsp)
+	movb	$0, 512(%rsp)
+.LEHB0:
+	call	*16(%rax)
+.LEHE0:
+	movq	328(%rsp), %rsi
+	xorl	%edx, %edx
+	movq	%rax, 320(%rsp)
+	cmpq	$-1, %rsi
+	je	.L96
+	.p2align 4,,10
+	.p2align 3
+.L94:
+	movq	%rdx, %rcx
+	salq	$4, %rcx
+	movq	%rdx, (%rax,%rcx)
+	movq	%rdx, %rcx
+	addq	$1, %rdx
+	cmpq	%rcx, %rsi
+	jne	.L94
+.L96:
+	leaq	128(%rsp), %r12
+	leaq	224(%rsp), %rbx
+	xorl	%r15d, %r15d
+	leaq	64(%rsp), %r9
+	leaq	96(%rsp), %r13
+	leaq	320(%rsp), %r14
+.L95:
+	movl	%r15d, 8(%r12)
+	movq	%r9, %rdi
+	movq	%r12, %rcx
+	xorl	%esi, %esi
+	movq	%r14, (%r12)
+	leaq	_Z12mpmc_producePv(%rip), %rdx
+	addl	$20000, %r15d
+	addq	$32, %r12
+	movq	%r14, (%rbx)
+	movl	$0, 8(%rbx)
+	movq	$0, 16(%rbx)
+	movl	$0, 24(%rbx)
+	movq	$0, -16(%r12)
+	movl	$0, -8(%r12)
+	movq	%r9, 56(%rsp)
+	call	pthread_create@PLT
+	movq	%rbx, %rcx
+	movq	%r13, %rdi
+	xorl	%esi, %esi
+	leaq	_Z12mpmc_consumePv(%rip), %rdx
+	addq	$32, %rbx
+	addq	$8, %r13
+	call	pthread_create@PLT
+	movq	56(%rsp), %r9
+	addq	$8, %r9
+	cmpl	$60000, %r15d
+	jne	.L95
+	movq	64(%rsp), %rdi
+	xorl	%esi, %esi
+.LEHB1:
+	call	pthread_join@PLT
+	movq	72(%rsp), %rdi
+	xorl	%esi, %esi
+	call	pthread_join@PLT
+	movq	80(%rsp), %rdi
+	xorl	%esi, %esi
+	call	pthread_join@PLT
+	xorl	%esi, %esi
+	movb	$1, 512(%rsp)
+	movq	96(%rsp), %rdi
+	call	pthread_join@PLT
+	movq	104(%rsp), %rdi
+	xorl	%esi, %esi
+	call	pthread_join@PLT
+	movq	112(%rsp), %rdi
+	xorl	%esi, %esi
+	call	pthread_join@PLT
+.LEHE1:
+	movl	248(%rsp), %edx
+	addl	280(%rsp), %edx
+	addl	312(%rsp), %edx
+	movq	240(%rsp), %rax
+	addq	272(%rsp), %rax
+	addq	304(%rsp), %rax
+	cmpl	$60000, %edx
+	jne	.L110
+	cmpq	$1799970000, %rax
+	jne	.L111
+	movq	328(%rsp), %rax
+	movq	336(%rsp), %rdi
+	movl	$8, %ecx
+	movq	320(%rsp), %rsi
+	leaq	1(%rax), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+	call	*24(%rax)
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L114:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L115
+.L92:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	jmp	.L90
+.L115:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L92
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L92
+.L108:
+	jmp	.L109
+	.globl	__gxx_personality_v0
+	.section	.gcc_except_table,"a",@progbits
+.LLSDA6833:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6833-.LLSDACSB6833
+.LLSDACSB6833:
+	.uleb128 .LEHB0-.LFB6833
+	.uleb128 .LEHE0-.LEHB0
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB1-.LFB6833
+	.uleb128 .LEHE1-.LEHB1
+	.uleb128 .L108-.LFB6833
+	.uleb128 0
+.LLSDACSE6833:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6833
+	.type	_Z22test_mpmc_many_threadsv.cold, @function
+_Z22test_mpmc_many_threadsv.cold:
+.LFSB6833:
+.L111:
+	.cfi_def_cfa 6, 16
+	.cfi_offset 3, -56
+	.cfi_offset 6, -16
+	.cfi_offset 12, -48
+	.cfi_offset 13, -40
+	.cfi_offset 14, -32
+	.cfi_offset 15, -24
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC1(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB2:
+	call	__cxa_throw@PLT
+.L110:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC0(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE2:
+.L101:
+.L109:
+	movq	336(%rsp), %rdi
+	movq	%rax, %rbx
+	movl	$8, %ecx
+	movq	328(%rsp), %rax
+	movq	320(%rsp), %rsi
+	leaq	1(%rax), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+	call	*24(%rax)
+	movq	%rbx, %rdi
+.LEHB3:
+	call	_Unwind_Resume@PLT
+.LEHE3:
+	.cfi_endproc
+.LFE6833:
+	.section	.gcc_except_table
+.LLSDAC6833:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6833-.LLSDACSBC6833
+.LLSDACSBC6833:
+	.uleb128 .LEHB2-.LCOLDB2
+	.uleb128 .LEHE2-.LEHB2
+	.uleb128 .L101-.LCOLDB2
+	.uleb128 0
+	.uleb128 .LEHB3-.LCOLDB2
+	.uleb128 .LEHE3-.LEHB3
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6833:
+	.section	.text.unlikely
+	.text
+	.size	_Z22test_mpmc_many_threadsv, .-_Z22test_mpmc_many_threadsv
+	.section	.text.unlikely
+	.size	_Z22test_mpmc_many_threadsv.cold, .-_Z22test_mpmc_many_threadsv.cold
+.LCOLDE2:
+	.text
+.LHOTE2:
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC4:
+	.string	"expected true : ordered"
+	.section	.rodata.str1.8
+	.align 8
+.LC5:
+	.string	"expected equal : expected value : expected, actual value : 50000u"
+	.section	.text.unlikely
+.LCOLDB7:
+	.text
+.LHOTB7:
+	.p2align 4
+	.globl	_Z25test_spsc_batched_publishv
+	.type	_Z25test_spsc_batched_publishv, @function
+_Z25test_spsc_batched_publishv:
+.LFB6823:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6823
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	andq	$-64, %rsp
+	subq	$256, %rsp
+	.cfi_offset 13, -24
+	.cfi_offset 12, -32
+	.cfi_offset 3, -40
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rdi
+	testq	%rdi, %rdi
+	je	.L154
+.L117:
+	movq	(%rdi), %rax
+	movq	%rdi, 88(%rsp)
+	movl	$4, %edx
+	xorl	%ebx, %ebx
+	movdqa	.LC3(%rip), %xmm0
+	movl	$256, %esi
+	movq	$0, 64(%rsp)
+	movl	$1, %r12d
+	movq	$0, 208(%rsp)
+	movups	%xmm0, 72(%rsp)
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 128(%rsp)
+	movaps	%xmm0, 144(%rsp)
+	movaps	%xmm0, 192(%rsp)
+	movb	$0, 216(%rsp)
+.LEHB4:
+	call	*16(%rax)
+.LEHE4:
+	leaq	64(%rsp), %rcx
+	leaq	56(%rsp), %rdi
+	xorl	%esi, %esi
+	leaq	_Z23spsc_produce_one_by_onePv(%rip), %rdx
+	movq	%rax, 64(%rsp)
+	call	pthread_create@PLT
+.L121:
+	movq	136(%rsp), %rax
+	jmp	.L122
+	.p2align 4,,10
+	.p2align 3
+.L124:
+	cmpq	%rax, 144(%rsp)
+	je	.L155
+.L126:
+	testb	%r12b, %r12b
+	jne	.L156
+.L122:
+	movq	152(%rsp), %rdx
+	testq	%rdx, %rdx
+	je	.L124
+	addq	%rdx, %rax
+	movq	%rax, 136(%rsp)
+	movq	128(%rsp), %rdx
+	subq	%rdx, %rax
+	cmpq	80(%rsp), %rax
+	jnb	.L157
+.L125:
+	movq	$0, 152(%rsp)
+	movq	136(%rsp), %rax
+	cmpq	%rax, 144(%rsp)
+	jne	.L126
+.L155:
+	movq	192(%rsp), %rdx
+	movq	%rdx, 144(%rsp)
+	movq	136(%rsp), %rax
+	cmpq	%rax, %rdx
+	jne	.L126
+	xorl	%r13d, %r13d
+	movq	%rax, 128(%rsp)
+	movq	136(%rsp), %rax
+	cmpq	%rax, 144(%rsp)
+	jne	.L126
+.L127:
+	movq	192(%rsp), %rdx
+	movq	%rdx, 144(%rsp)
+	movq	136(%rsp), %rax
+	cmpq	%rax, %rdx
+	jne	.L126
+	movzbl	216(%rsp), %eax
+	testb	%al, %al
+	jne	.L158
+	cmpl	$63, %r13d
+	ja	.L130
+	rep nop
+	addl	$1, %r13d
+.L131:
+	movq	136(%rsp), %rax
+	cmpq	144(%rsp), %rax
+	je	.L127
+	testb	%r12b, %r12b
+	je	.L122
+	.p2align 4,,10
+	.p2align 3
+.L156:
+	movq	72(%rsp), %rcx
+	movq	64(%rsp), %rdx
+	andq	%rax, %rcx
+	addq	$1, %rax
+	movl	(%rdx,%rcx,4), %edx
+	movq	%rax, 136(%rsp)
+	movq	128(%rsp), %rcx
+	subq	%rcx, %rax
+	cmpq	80(%rsp), %rax
+	jnb	.L159
+.L123:
+	cmpl	%ebx, %edx
+	sete	%r12b
+	addl	$1, %ebx
+	jmp	.L121
+	.p2align 4,,10
+	.p2align 3
+.L157:
+	movq	136(%rsp), %rax
+	movq	%rax, 128(%rsp)
+	jmp	.L125
+	.p2align 4,,10
+	.p2align 3
+.L130:
+	call	sched_yield@PLT
+	jmp	.L131
+	.p2align 4,,10
+	.p2align 3
+.L159:
+	movq	136(%rsp), %rax
+	movq	%rax, 128(%rsp)
+	jmp	.L123
+.L154:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L160
+.L119:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	jmp	.L117
+.L160:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L119
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L119
+.L158:
+	movq	136(%rsp), %rax
+	cmpq	144(%rsp), %rax
+	jne	.L126
+	movq	192(%rsp), %rdx
+	movq	%rdx, 144(%rsp)
+	movq	136(%rsp), %rax
+	cmpq	%rax, %rdx
+	jne	.L126
+	movq	56(%rsp), %rdi
+	xorl	%esi, %esi
+.LEHB5:
+	call	pthread_join@PLT
+.LEHE5:
+	testb	%r12b, %r12b
+	je	.L148
+	cmpl	$50000, %ebx
+	jne	.L149
+	movq	72(%rsp), %rax
+	movq	88(%rsp), %rdi
+	movl	$4, %ecx
+	movq	64(%rsp), %rsi
+	leaq	4(,%rax,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	leaq	-24(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.L146:
+	.cfi_restore_state
+	jmp	.L147
+	.section	.gcc_except_table
+.LLSDA6823:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6823-.LLSDACSB6823
+.LLSDACSB6823:
+	.uleb128 .LEHB4-.LFB6823
+	.uleb128 .LEHE4-.LEHB4
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB5-.LFB6823
+	.uleb128 .LEHE5-.LEHB5
+	.uleb128 .L146-.LFB6823
+	.uleb128 0
+.LLSDACSE6823:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6823
+	.type	_Z25test_spsc_batched_publishv.cold, @function
+_Z25test_spsc_batched_publishv.cold:
+.LFSB6823:
+.L149:
+	.cfi_def_cfa 6, 16
+	.cfi_offset 3, -40
+	.cfi_offset 6, -16
+	.cfi_offset 12, -32
+	.cfi_offset 13, -24
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC5(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB6:
+	call	__cxa_throw@PLT
+.L148:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC4(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE6:
+.L137:
+.L147:
+	movq	88(%rsp), %rdi
+	movq	%rax, %rbx
+	movq	72(%rsp), %rax
+	movl	$4, %ecx
+	movq	64(%rsp), %rsi
+	leaq	4(,%rax,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	%rbx, %rdi
+.LEHB7:
+	call	_Unwind_Resume@PLT
+.LEHE7:
+	.cfi_endproc
+.LFE6823:
+	.section	.gcc_except_table
+.LLSDAC6823:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6823-.LLSDACSBC6823
+.LLSDACSBC6823:
+	.uleb128 .LEHB6-.LCOLDB7
+	.uleb128 .LEHE6-.LEHB6
+	.uleb128 .L137-.LCOLDB7
+	.uleb128 0
+	.uleb128 .LEHB7-.LCOLDB7
+	.uleb128 .LEHE7-.LEHB7
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6823:
+	.section	.text.unlikely
+	.text
+	.size	_Z25test_spsc_batched_publishv, .-_Z25test_spsc_batched_publishv
+	.section	.text.unlikely
+	.size	_Z25test_spsc_batched_publishv.cold, .-_Z25test_spsc_batched_publishv.cold
+.LCOLDE7:
+	.text
+.LHOTE7:
+	.section	.rodata.str1.8
+	.align 8
+.LC8:
+	.string	"expected true : c.try_push(int(i))"
+	.align 8
+.LC9:
+	.string	"expected false : c.try_push(4)"
+	.align 8
+.LC10:
+	.string	"expected equal : expected value : c.try_pop().get(), actual value : 0"
+	.align 8
+.LC11:
+	.string	"expected equal : expected value : c.try_pop().get(), actual value : 1"
+	.section	.rodata.str1.1
+.LC12:
+	.string	"expected true : c.try_push(4)"
+	.section	.rodata.str1.8
+	.align 8
+.LC13:
+	.string	"expected equal : expected value : c.try_pop().get(), actual value : 2"
+	.section	.text.unlikely
+.LCOLDB14:
+	.text
+.LHOTB14:
+	.p2align 4
+	.globl	_Z23test_mpmc_single_threadv
+	.type	_Z23test_mpmc_single_threadv, @function
+_Z23test_mpmc_single_threadv:
+.LFB6827:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6827
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%rbx
+	andq	$-64, %rsp
+	subq	$256, %rsp
+	.cfi_offset 3, -24
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rdi
+	testq	%rdi, %rdi
+	je	.L244
+.L162:
+	movq	(%rdi), %rax
+	movl	$8, %edx
+	movl	$64, %esi
+	movq	$0, (%rsp)
+	movq	$3, 8(%rsp)
+	movq	%rdi, 16(%rsp)
+	movq	$0, 64(%rsp)
+	movq	$0, 128(%rsp)
+	movb	$0, 192(%rsp)
+.LEHB8:
+	call	*16(%rax)
+.LEHE8:
+	movq	8(%rsp), %rsi
+	xorl	%edx, %edx
+	movq	%rax, (%rsp)
+	cmpq	$-1, %rsi
+	je	.L168
+	.p2align 4,,10
+	.p2align 3
+.L166:
+	movq	%rdx, %rcx
+	salq	$4, %rcx
+	movq	%rdx, (%rax,%rcx)
+	movq	%rdx, %rcx
+	addq	$1, %rdx
+	cmpq	%rcx, %rsi
+	jne	.L166
+.L168:
+	xorl	%ecx, %ecx
+	.p2align 4,,10
+	.p2align 3
+.L167:
+	movq	64(%rsp), %rax
+.L169:
+	movq	8(%rsp), %rdx
+	andq	%rax, %rdx
+	salq	$4, %rdx
+	addq	(%rsp), %rdx
+	movq	(%rdx), %rsi
+	cmpq	%rax, %rsi
+	jne	.L170
+	leaq	1(%rax), %rsi
+	lock cmpxchgq	%rsi, 64(%rsp)
+	jne	.L169
+	testq	%rdx, %rdx
+	je	.L175
+	movq	(%rdx), %rax
+	movl	%ecx, 8(%rdx)
+	addl	$1, %ecx
+	addq	$1, %rax
+	movq	%rax, (%rdx)
+	cmpl	$4, %ecx
+	jne	.L167
+.L243:
+	movq	64(%rsp), %rax
+.L176:
+	movq	8(%rsp), %rdx
+	andq	%rax, %rdx
+	salq	$4, %rdx
+	addq	(%rsp), %rdx
+	movq	(%rdx), %rcx
+	cmpq	%rax, %rcx
+	jne	.L177
+	leaq	1(%rax), %rcx
+	lock cmpxchgq	%rcx, 64(%rsp)
+	jne	.L176
+	testq	%rdx, %rdx
+	jne	.L235
+.L180:
+	movq	128(%rsp), %rax
+.L182:
+	movq	8(%rsp), %rdx
+	andq	%rax, %rdx
+	salq	$4, %rdx
+	addq	(%rsp), %rdx
+	movq	(%rdx), %rcx
+	subq	$1, %rcx
+	cmpq	%rax, %rcx
+	jne	.L183
+	leaq	1(%rax), %rcx
+	lock cmpxchgq	%rcx, 128(%rsp)
+	jne	.L182
+	movq	8(%rsp), %rsi
+	movl	8(%rdx), %ecx
+	leaq	1(%rax,%rsi), %rax
+	movq	%rax, (%rdx)
+	testl	%ecx, %ecx
+	jne	.L245
+.L186:
+	movq	128(%rsp), %rax
+.L188:
+	movq	8(%rsp), %rdx
+	andq	%rax, %rdx
+	salq	$4, %rdx
+	addq	(%rsp), %rdx
+	movq	(%rdx), %rcx
+	subq	$1, %rcx
+	cmpq	%rax, %rcx
+	jne	.L189
+	leaq	1(%rax), %rcx
+	lock cmpxchgq	%rcx, 128(%rsp)
+	jne	.L188
+	movq	8(%rsp), %rsi
+	movl	8(%rdx), %ecx
+	leaq	1(%rax,%rsi), %rax
+	movq	%rax, (%rdx)
+	cmpl	$1, %ecx
+	jne	.L246
+.L238:
+	movq	64(%rsp), %rax
+.L194:
+	movq	8(%rsp), %rdx
+	andq	%rax, %rdx
+	salq	$4, %rdx
+	addq	(%rsp), %rdx
+	movq	(%rdx), %rcx
+	cmpq	%rax, %rcx
+	jne	.L195
+	leaq	1(%rax), %rcx
+	lock cmpxchgq	%rcx, 64(%rsp)
+	jne	.L194
+	testq	%rdx, %rdx
+	je	.L198
+	movq	(%rdx), %rax
+	movl	$4, 8(%rdx)
+	addq	$1, %rax
+	movq	%rax, (%rdx)
+	movq	128(%rsp), %rax
+.L200:
+	movq	8(%rsp), %rdx
+	andq	%rax, %rdx
+	salq	$4, %rdx
+	addq	(%rsp), %rdx
+	movq	(%rdx), %rcx
+	subq	$1, %rcx
+	cmpq	%rax, %rcx
+	jne	.L201
+	leaq	1(%rax), %rcx
+	lock cmpxchgq	%rcx, 128(%rsp)
+	jne	.L200
+	movq	8(%rsp), %rsi
+	movl	8(%rdx), %ecx
+	leaq	1(%rax,%rsi), %rax
+	movq	%rax, (%rdx)
+	cmpl	$2, %ecx
+	jne	.L247
+	movq	8(%rsp), %rax
+	movq	16(%rsp), %rdi
+	movl	$8, %ecx
+	movq	(%rsp), %rsi
+	leaq	1(%rax), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+	call	*24(%rax)
+	movq	-8(%rbp), %rbx
+	leave
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L170:
+	.cfi_restore_state
+	jns	.L167
+	.p2align 4,,10
+	.p2align 3
+.L175:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC8(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB9:
+	call	__cxa_throw@PLT
+.LEHE9:
+	.p2align 4,,10
+	.p2align 3
+.L177:
+	jns	.L243
+	jmp	.L180
+	.p2align 4,,10
+	.p2align 3
+.L201:
+	js	.L203
+	movq	128(%rsp), %rax
+	jmp	.L200
+	.p2align 4,,10
+	.p2align 3
+.L195:
+	jns	.L238
+	jmp	.L198
+	.p2align 4,,10
+	.p2align 3
+.L189:
+	jns	.L186
+	jmp	.L191
+	.p2align 4,,10
+	.p2align 3
+.L183:
+	jns	.L180
+	jmp	.L186
+	.p2align 4,,10
+	.p2align 3
+.L244:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L248
+.L164:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	jmp	.L162
+.L248:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L164
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L164
+.L233:
+	jmp	.L234
+.L247:
+	jmp	.L203
+.L246:
+	jmp	.L191
+.L245:
+	jmp	.L185
+	.section	.gcc_except_table
+.LLSDA6827:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6827-.LLSDACSB6827
+.LLSDACSB6827:
+	.uleb128 .LEHB8-.LFB6827
+	.uleb128 .LEHE8-.LEHB8
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB9-.LFB6827
+	.uleb128 .LEHE9-.LEHB9
+	.uleb128 .L233-.LFB6827
+	.uleb128 0
+.LLSDACSE6827:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6827
+	.type	_Z23test_mpmc_single_threadv.cold, @function
+_Z23test_mpmc_single_threadv.cold:
+.LFSB6827:
+.L235:
+	.cfi_def_cfa 6, 16
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movq	(%rdx), %rax
+	movl	$4, 8(%rdx)
+	movl	$8, %edi
+	addq	$1, %rax
+	movq	%rax, (%rdx)
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC9(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB10:
+	call	__cxa_throw@PLT
+.L191:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC11(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE10:
+.L208:
+.L234:
+	movq	16(%rsp), %rdi
+	movq	%rax, %rbx
+	movq	8(%rsp), %rax
+	movl	$8, %ecx
+	movq	(%rsp), %rsi
+	leaq	1(%rax), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+	call	*24(%rax)
+	movq	%rbx, %rdi
+.LEHB11:
+	call	_Unwind_Resume@PLT
+.LEHE11:
+.L203:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC13(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB12:
+	call	__cxa_throw@PLT
+.L198:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC12(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L185:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC10(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE12:
+	.cfi_endproc
+.LFE6827:
+	.section	.gcc_except_table
+.LLSDAC6827:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6827-.LLSDACSBC6827
+.LLSDACSBC6827:
+	.uleb128 .LEHB10-.LCOLDB14
+	.uleb128 .LEHE10-.LEHB10
+	.uleb128 .L208-.LCOLDB14
+	.uleb128 0
+	.uleb128 .LEHB11-.LCOLDB14
+	.uleb128 .LEHE11-.LEHB11
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB12-.LCOLDB14
+	.uleb128 .LEHE12-.LEHB12
+	.uleb128 .L208-.LCOLDB14
+	.uleb128 0
+.LLSDACSEC6827:
+	.section	.text.unlikely
+	.text
+	.size	_Z23test_mpmc_single_threadv, .-_Z23test_mpmc_single_threadv
+	.section	.text.unlikely
+	.size	_Z23test_mpmc_single_threadv.cold, .-_Z23test_mpmc_single_threadv.cold
+.LCOLDE14:
+	.text
+.LHOTE14:
+	.section	.rodata.str1.8
+	.align 8
+.LC16:
+	.string	"expected equal : expected value : out.len(), actual value : in.len()"
+	.align 8
+.LC17:
+	.string	"expected true : n::equal(in.iter(), out.iter())"
+	.section	.text.unlikely
+.LCOLDB18:
+	.text
+.LHOTB18:
+	.p2align 4
+	.globl	_Z29test_spsc_copy_across_threadsv
+	.type	_Z29test_spsc_copy_across_threadsv, @function
+_Z29test_spsc_copy_across_threadsv:
+.LFB6813:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6813
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pxor	%xmm0, %xmm0
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	andq	$-64, %rsp
+	subq	$320, %rsp
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movq	$0, 96(%rsp)
+	movups	%xmm0, 104(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L372
+	xorl	%r13d, %r13d
+	xorl	%r12d, %r12d
+	xorl	%edx, %edx
+.L250:
+	movq	%rax, 120(%rsp)
+	xorl	%ebx, %ebx
+	jmp	.L259
+	.p2align 4,,10
+	.p2align 3
+.L254:
+	movl	%ebx, 0(%r13,%rdx,4)
+.L257:
+	addq	$1, %rdx
+	addl	$7, %ebx
+	movq	%rdx, 112(%rsp)
+	cmpl	$700000, %ebx
+	je	.L258
+	movq	104(%rsp), %r12
+	movq	96(%rsp), %r13
+.L259:
+	cmpq	%r12, %rdx
+	jne	.L254
+	leaq	5(%r12), %rsi
+	movq	120(%rsp), %rdi
+	movl	$4, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$3, %rsi
+	movq	%rax, 104(%rsp)
+	movq	(%rdi), %rax
+.LEHB13:
+	call	*16(%rax)
+	movq	112(%rsp), %rdx
+	movq	%rax, %rdi
+	movq	%rax, 96(%rsp)
+	movl	%ebx, (%rdi,%rdx,4)
+	leaq	0(,%rdx,4), %rax
+	testq	%rdx, %rdx
+	jne	.L373
+	testq	%r13, %r13
+	je	.L257
+.L256:
+	movq	120(%rsp), %rdi
+	leaq	0(,%r12,4), %rdx
+	movl	$4, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	112(%rsp), %rdx
+	jmp	.L257
+	.p2align 4,,10
+	.p2align 3
+.L373:
+	movq	%rax, %rdx
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L256
+.L258:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rdi
+	testq	%rdi, %rdi
+	je	.L374
+.L260:
+	movdqa	.LC15(%rip), %xmm0
+	movq	(%rdi), %rax
+	movq	$0, 128(%rsp)
+	movl	$4, %edx
+	movq	%rdi, 152(%rsp)
+	movl	$1024, %esi
+	movups	%xmm0, 136(%rsp)
+	pxor	%xmm0, %xmm0
+	movq	$0, 272(%rsp)
+	movb	$0, 280(%rsp)
+	movaps	%xmm0, 192(%rsp)
+	movaps	%xmm0, 208(%rsp)
+	movaps	%xmm0, 256(%rsp)
+	call	*16(%rax)
+.LEHE13:
+	movq	%rax, 128(%rsp)
+	leaq	80(%rsp), %rcx
+	xorl	%esi, %esi
+	leaq	128(%rsp), %rax
+	movq	%rax, %xmm0
+	leaq	96(%rsp), %rax
+	leaq	72(%rsp), %rdi
+	movq	%rax, %xmm1
+	leaq	_Z12spsc_producePv(%rip), %rdx
+	punpcklqdq	%xmm1, %xmm0
+	movaps	%xmm0, 80(%rsp)
+	call	pthread_create@PLT
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, 40(%rsp)
+	testq	%rax, %rax
+	je	.L375
+.L264:
+	movq	216(%rsp), %rax
+	testq	%rax, %rax
+	jne	.L376
+.L268:
+	movq	200(%rsp), %rdx
+	movq	208(%rsp), %rax
+	cmpq	%rax, %rdx
+	je	.L377
+.L270:
+	movq	136(%rsp), %rcx
+	subq	%rdx, %rax
+	movq	%rcx, %rsi
+	leaq	1(%rcx), %rbx
+	andq	%rdx, %rsi
+	movl	$1024, %edx
+	subq	%rsi, %rbx
+	cmpq	%rdx, %rax
+	cmova	%rdx, %rax
+	cmpq	%rax, %rbx
+	cmova	%rax, %rbx
+	movq	128(%rsp), %rax
+	movq	%rbx, 216(%rsp)
+	leaq	(%rax,%rsi,4), %r13
+	testq	%rbx, %rbx
+	je	.L278
+	movq	$0, 56(%rsp)
+	movq	56(%rsp), %rax
+	xorl	%r15d, %r15d
+	movq	$0, 48(%rsp)
+	leaq	(%rax,%rbx), %r14
+	cmpq	%r15, %r13
+	jb	.L279
+	.p2align 4,,10
+	.p2align 3
+.L382:
+	salq	$2, %rax
+	leaq	(%r15,%rax), %r12
+	movq	%rax, 32(%rsp)
+	cmpq	%r12, %r13
+	jnb	.L279
+	cmpq	%r14, 48(%rsp)
+	jb	.L378
+.L283:
+	salq	$2, %rbx
+	cmpl	$8, %ebx
+	jnb	.L290
+.L383:
+	testb	$4, %bl
+	jne	.L379
+	testl	%ebx, %ebx
+	je	.L291
+	movzbl	0(%r13), %eax
+	movb	%al, (%r12)
+.L291:
+	movq	216(%rsp), %rax
+	testq	%rax, %rax
+	jne	.L380
+.L294:
+	movq	200(%rsp), %rax
+	movq	208(%rsp), %rbx
+	cmpq	%rbx, %rax
+	je	.L381
+.L296:
+	movq	136(%rsp), %rdx
+	subq	%rax, %rbx
+	movq	%rdx, %rcx
+	andq	%rax, %rcx
+	movl	$1024, %eax
+	cmpq	%rax, %rbx
+	cmova	%rax, %rbx
+	leaq	1(%rdx), %rax
+	subq	%rcx, %rax
+	cmpq	%rax, %rbx
+	cmova	%rax, %rbx
+	movq	128(%rsp), %rax
+	movq	%rbx, 216(%rsp)
+	leaq	(%rax,%rcx,4), %r13
+	testq	%rbx, %rbx
+	je	.L299
+	movq	%r14, %rax
+	movq	%r14, 56(%rsp)
+	leaq	(%rax,%rbx), %r14
+	cmpq	%r15, %r13
+	jnb	.L382
+.L279:
+	cmpq	%r14, 48(%rsp)
+	jb	.L284
+	movq	56(%rsp), %rax
+	salq	$2, %rbx
+	leaq	(%r15,%rax,4), %r12
+	cmpl	$8, %ebx
+	jb	.L383
+.L290:
+	movq	0(%r13), %rax
+	leaq	8(%r12), %rdi
+	movq	%r13, %rsi
+	andq	$-8, %rdi
+	movq	%rax, (%r12)
+	movl	%ebx, %eax
+	movq	-8(%r13,%rax), %rdx
+	movq	%rdx, -8(%r12,%rax)
+	subq	%rdi, %r12
+	addl	%r12d, %ebx
+	subq	%r12, %rsi
+	shrl	$3, %ebx
+	movl	%ebx, %ecx
+	rep movsq
+	movq	216(%rsp), %rax
+	testq	%rax, %rax
+	je	.L294
+.L380:
+	addq	200(%rsp), %rax
+	movq	%rax, 200(%rsp)
+	movq	192(%rsp), %rdx
+	subq	%rdx, %rax
+	cmpq	144(%rsp), %rax
+	jnb	.L384
+.L295:
+	movq	$0, 216(%rsp)
+	jmp	.L294
+	.p2align 4,,10
+	.p2align 3
+.L381:
+	movq	256(%rsp), %rbx
+	movq	%rbx, 208(%rsp)
+	movq	200(%rsp), %rax
+	cmpq	%rax, %rbx
+	jne	.L296
+	xorl	%r12d, %r12d
+	movq	%rbx, 192(%rsp)
+	movq	200(%rsp), %rax
+	movq	208(%rsp), %rbx
+	cmpq	%rbx, %rax
+	jne	.L296
+.L297:
+	movq	256(%rsp), %rbx
+	movq	%rbx, 208(%rsp)
+	movq	200(%rsp), %rax
+	cmpq	%rax, %rbx
+	jne	.L296
+	movzbl	280(%rsp), %eax
+	testb	%al, %al
+	jne	.L385
+	cmpl	$63, %r12d
+	ja	.L300
+	rep nop
+	addl	$1, %r12d
+.L301:
+	movq	200(%rsp), %rax
+	movq	208(%rsp), %rbx
+	cmpq	%rbx, %rax
+	jne	.L296
+	jmp	.L297
+	.p2align 4,,10
+	.p2align 3
+.L284:
+	movq	48(%rsp), %rax
+	movq	40(%rsp), %rdi
+	movl	$4, %edx
+	leaq	10(%rax,%rax), %rax
+	cmpq	%r14, %rax
+	cmovb	%r14, %rax
+	movq	%rax, 32(%rsp)
+	leaq	0(,%rax,4), %rsi
+	movq	(%rdi), %rax
+.LEHB14:
+	call	*16(%rax)
+.LEHE14:
+	cmpq	$0, 56(%rsp)
+	movq	%rax, %r12
+	jne	.L386
+	testq	%r15, %r15
+	jne	.L286
+	movq	32(%rsp), %rax
+	movq	%r12, %r15
+	movq	%rax, 48(%rsp)
+	jmp	.L283
+.L386:
+	movq	56(%rsp), %rax
+	movq	%r15, %rsi
+	movq	%r12, %rdi
+	leaq	0(,%rax,4), %rdx
+	call	memcpy@PLT
+.L286:
+	movq	40(%rsp), %rdi
+	movq	48(%rsp), %rdx
+	movl	$4, %ecx
+	movq	%r15, %rsi
+	movq	(%rdi), %rax
+	salq	$2, %rdx
+.LEHB15:
+	call	*24(%rax)
+.LEHE15:
+	movq	32(%rsp), %rax
+	movq	%r12, %r15
+	movq	%rax, 48(%rsp)
+	movq	56(%rsp), %rax
+	leaq	(%r12,%rax,4), %r12
+	jmp	.L283
+.L385:
+	movq	200(%rsp), %rax
+	movq	208(%rsp), %rbx
+	cmpq	%rbx, %rax
+	jne	.L296
+	movq	256(%rsp), %rbx
+	movq	%rbx, 208(%rsp)
+	movq	200(%rsp), %rax
+	cmpq	%rax, %rbx
+	jne	.L296
+.L299:
+	movq	72(%rsp), %rdi
+	xorl	%esi, %esi
+.LEHB16:
+	call	pthread_join@PLT
+.LEHE16:
+	cmpq	%r14, 112(%rsp)
+	jne	.L387
+	movq	96(%rsp), %rdi
+	testq	%r14, %r14
+	je	.L307
+	leaq	0(,%r14,4), %rdx
+	movq	%r15, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L367
+.L309:
+	movq	40(%rsp), %rdi
+	movq	48(%rsp), %rdx
+	movl	$4, %ecx
+	movq	%r15, %rsi
+	movq	(%rdi), %rax
+	salq	$2, %rdx
+	call	*24(%rax)
+.L310:
+	movq	136(%rsp), %rax
+	movq	152(%rsp), %rdi
+	movl	$4, %ecx
+	movq	128(%rsp), %rsi
+	leaq	4(,%rax,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	96(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L249
+	movq	104(%rsp), %rax
+	movq	120(%rsp), %rdi
+	movl	$4, %ecx
+	leaq	0(,%rax,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L249:
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.L384:
+	.cfi_restore_state
+	movq	200(%rsp), %rax
+	movq	%rax, 192(%rsp)
+	jmp	.L295
+.L307:
+	testq	%r15, %r15
+	jne	.L309
+	jmp	.L310
+.L378:
+	movq	48(%rsp), %rax
+	movq	40(%rsp), %rdi
+	movl	$4, %edx
+	leaq	10(%rax,%rax), %rax
+	cmpq	%r14, %rax
+	cmovb	%r14, %rax
+	movq	%rax, 24(%rsp)
+	leaq	0(,%rax,4), %rsi
+	movq	(%rdi), %rax
+.LEHB17:
+	call	*16(%rax)
+.LEHE17:
+	subq	%r15, %r13
+	cmpq	$0, 56(%rsp)
+	movq	%rax, %r12
+	jne	.L388
+	testq	%r15, %r15
+	jne	.L282
+	addq	%rax, %r13
+	movq	24(%rsp), %rax
+	movq	%r12, %r15
+	movq	%rax, 48(%rsp)
+	jmp	.L283
+.L388:
+	movq	32(%rsp), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+.L282:
+	movq	40(%rsp), %rdi
+	movq	48(%rsp), %rdx
+	movl	$4, %ecx
+	movq	%r15, %rsi
+	movq	(%rdi), %rax
+	salq	$2, %rdx
+.LEHB18:
+	call	*24(%rax)
+.LEHE18:
+	movq	%r12, %r15
+	movq	24(%rsp), %rax
+	addq	%r12, %r13
+	movq	32(%rsp), %r12
+	movq	%rax, 48(%rsp)
+	addq	%r15, %r12
+	jmp	.L283
+.L379:
+	movl	0(%r13), %eax
+	movl	%ebx, %ebx
+	movl	%eax, (%r12)
+	movl	-4(%r13,%rbx), %eax
+	movl	%eax, -4(%r12,%rbx)
+	jmp	.L291
+.L377:
+	movq	256(%rsp), %rax
+	movq	%rax, 208(%rsp)
+	movq	200(%rsp), %rdx
+	cmpq	%rdx, %rax
+	jne	.L270
+	xorl	%ebx, %ebx
+	movq	%rax, 192(%rsp)
+	movq	200(%rsp), %rdx
+	movq	208(%rsp), %rax
+	cmpq	%rdx, %rax
+	jne	.L270
+.L271:
+	movq	256(%rsp), %rax
+	movq	%rax, 208(%rsp)
+	movq	200(%rsp), %rdx
+	cmpq	%rdx, %rax
+	jne	.L270
+	movzbl	280(%rsp), %eax
+	testb	%al, %al
+	jne	.L389
+	cmpl	$63, %ebx
+	ja	.L274
+	rep nop
+	addl	$1, %ebx
+.L275:
+	movq	200(%rsp), %rdx
+	movq	208(%rsp), %rax
+	cmpq	%rax, %rdx
+	jne	.L270
+	jmp	.L271
+	.p2align 4,,10
+	.p2align 3
+.L376:
+	addq	200(%rsp), %rax
+	movq	%rax, 200(%rsp)
+	movq	192(%rsp), %rdx
+	subq	%rdx, %rax
+	cmpq	144(%rsp), %rax
+	jnb	.L390
+.L269:
+	movq	$0, 216(%rsp)
+	jmp	.L268
+.L300:
+	call	sched_yield@PLT
+	jmp	.L301
+.L374:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L391
+.L262:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	jmp	.L260
+.L372:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L392
+.L252:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	112(%rsp), %rdx
+	movq	104(%rsp), %r12
+	movq	96(%rsp), %r13
+	jmp	.L250
+.L375:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L393
+.L266:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	%rax, 40(%rsp)
+	jmp	.L264
+.L390:
+	movq	200(%rsp), %rax
+	movq	%rax, 192(%rsp)
+	jmp	.L269
+.L391:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L262
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L262
+.L392:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L252
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L252
+.L393:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L266
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L266
+.L274:
+	call	sched_yield@PLT
+	jmp	.L275
+.L389:
+	movq	200(%rsp), %rdx
+	movq	208(%rsp), %rax
+	cmpq	%rax, %rdx
+	jne	.L270
+	movq	256(%rsp), %rax
+	movq	%rax, 208(%rsp)
+	movq	200(%rsp), %rdx
+	cmpq	%rdx, %rax
+	jne	.L270
+.L278:
+	movq	72(%rsp), %rdi
+	xorl	%esi, %esi
+.LEHB19:
+	call	pthread_join@PLT
+.LEHE19:
+	cmpq	$0, 112(%rsp)
+	je	.L310
+	jmp	.L321
+.L365:
+	jmp	.L366
+.L327:
+	movq	%rax, %rbx
+	jmp	.L288
+.L387:
+	jmp	.L306
+.L322:
+	movq	%rax, %rbx
+	jmp	.L316
+.L326:
+	movq	%rax, %rbx
+	jmp	.L312
+.L324:
+	movq	%rax, %rbx
+	jmp	.L314
+	.section	.gcc_except_table
+.LLSDA6813:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6813-.LLSDACSB6813
+.LLSDACSB6813:
+	.uleb128 .LEHB13-.LFB6813
+	.uleb128 .LEHE13-.LEHB13
+	.uleb128 .L322-.LFB6813
+	.uleb128 0
+	.uleb128 .LEHB14-.LFB6813
+	.uleb128 .LEHE14-.LEHB14
+	.uleb128 .L365-.LFB6813
+	.uleb128 0
+	.uleb128 .LEHB15-.LFB6813
+	.uleb128 .LEHE15-.LEHB15
+	.uleb128 .L327-.LFB6813
+	.uleb128 0
+	.uleb128 .LEHB16-.LFB6813
+	.uleb128 .LEHE16-.LEHB16
+	.uleb128 .L365-.LFB6813
+	.uleb128 0
+	.uleb128 .LEHB17-.LFB6813
+	.uleb128 .LEHE17-.LEHB17
+	.uleb128 .L365-.LFB6813
+	.uleb128 0
+	.uleb128 .LEHB18-.LFB6813
+	.uleb128 .LEHE18-.LEHB18
+	.uleb128 .L326-.LFB6813
+	.uleb128 0
+	.uleb128 .LEHB19-.LFB6813
+	.uleb128 .LEHE19-.LEHB19
+	.uleb128 .L324-.LFB6813
+	.uleb128 0
+.LLSDACSE6813:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6813
+	.type	_Z29test_spsc_copy_across_threadsv.cold, @function
+_Z29test_spsc_copy_across_threadsv.cold:
+.LFSB6813:
+	nop
+.L325:
+	.cfi_def_cfa 6, 16
+	.cfi_offset 3, -56
+	.cfi_offset 6, -16
+	.cfi_offset 12, -48
+	.cfi_offset 13, -40
+	.cfi_offset 14, -32
+	.cfi_offset 15, -24
+.L366:
+	movq	%rax, %rbx
+.L289:
+	testq	%r15, %r15
+	jne	.L315
+.L314:
+	movq	136(%rsp), %rax
+	movq	152(%rsp), %rdi
+	movl	$4, %ecx
+	movq	128(%rsp), %rsi
+	leaq	4(,%rax,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L316:
+	movq	96(%rsp), %rsi
+	movq	104(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L317
+	movq	120(%rsp), %rdi
+	salq	$2, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L317:
+	movq	%rbx, %rdi
+.LEHB20:
+	call	_Unwind_Resume@PLT
+.LEHE20:
+.L288:
+	movq	32(%rsp), %rax
+	movq	%r12, %r15
+	movq	%rax, 48(%rsp)
+	jmp	.L289
+.L367:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC17(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB21:
+	call	__cxa_throw@PLT
+.LEHE21:
+.L321:
+	xorl	%eax, %eax
+	xorl	%r15d, %r15d
+	movq	%rax, 48(%rsp)
+.L306:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC16(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB22:
+	call	__cxa_throw@PLT
+.LEHE22:
+.L323:
+	movq	%rax, %rbx
+.L315:
+	movq	40(%rsp), %rdi
+	movq	48(%rsp), %rdx
+	movl	$4, %ecx
+	movq	%r15, %rsi
+	movq	(%rdi), %rax
+	salq	$2, %rdx
+	call	*24(%rax)
+	jmp	.L314
+.L312:
+	movq	24(%rsp), %rax
+	movq	%r12, %r15
+	movq	%rax, 48(%rsp)
+	jmp	.L289
+	.cfi_endproc
+.LFE6813:
+	.section	.gcc_except_table
+.LLSDAC6813:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6813-.LLSDACSBC6813
+.LLSDACSBC6813:
+	.uleb128 .LEHB20-.LCOLDB18
+	.uleb128 .LEHE20-.LEHB20
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB21-.LCOLDB18
+	.uleb128 .LEHE21-.LEHB21
+	.uleb128 .L323-.LCOLDB18
+	.uleb128 0
+	.uleb128 .LEHB22-.LCOLDB18
+	.uleb128 .LEHE22-.LEHB22
+	.uleb128 .L325-.LCOLDB18
+	.uleb128 0
+.LLSDACSEC6813:
+	.section	.text.unlikely
+	.text
+	.size	_Z29test_spsc_copy_across_threadsv, .-_Z29test_spsc_copy_across_threadsv
+	.section	.text.unlikely
+	.size	_Z29test_spsc_copy_across_threadsv.cold, .-_Z29test_spsc_copy_across_threadsv.cold
+.LCOLDE18:
+	.text
+.LHOTE18:
+	.section	.rodata.str1.8
+	.align 8
+.LC20:
+	.string	"expected equal : expected value : c.capacity(), actual value : 4"
+	.section	.rodata.str1.1
+.LC21:
+	.string	"expected true : c.try_push(1)"
+.LC22:
+	.string	"expected true : c.try_push(2)"
+.LC23:
+	.string	"expected true : c.try_push(3)"
+	.section	.rodata.str1.8
+	.align 8
+.LC24:
+	.string	"expected false : c.try_push(5)"
+	.section	.rodata.str1.1
+.LC25:
+	.string	"expected true : c.try_push(5)"
+	.section	.rodata.str1.8
+	.align 8
+.LC26:
+	.string	"expected equal : expected value : sum, actual value : 2 + 3 + 4 + 5"
+	.section	.text.unlikely
+.LCOLDB27:
+	.text
+.LHOTB27:
+	.p2align 4
+	.globl	_Z23test_spsc_single_threadv
+	.type	_Z23test_spsc_single_threadv, @function
+_Z23test_spsc_single_threadv:
+.LFB6807:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6807
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%rbx
+	andq	$-64, %rsp
+	subq	$192, %rsp
+	.cfi_offset 3, -24
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rdi
+	testq	%rdi, %rdi
+	je	.L453
+.L395:
+	movdqa	.LC19(%rip), %xmm0
+	movq	(%rdi), %rax
+	movl	$4, %edx
+	movq	$0, (%rsp)
+	movq	%rdi, 24(%rsp)
+	movl	$16, %esi
+	movups	%xmm0, 8(%rsp)
+	pxor	%xmm0, %xmm0
+	movq	$0, 144(%rsp)
+	movb	$0, 152(%rsp)
+	movaps	%xmm0, 64(%rsp)
+	movaps	%xmm0, 80(%rsp)
+	movaps	%xmm0, 128(%rsp)
+.LEHB23:
+	call	*16(%rax)
+.LEHE23:
+	movq	8(%rsp), %rdx
+	movq	%rax, (%rsp)
+	cmpq	$3, %rdx
+	jne	.L449
+	movq	136(%rsp), %rcx
+	movq	%rcx, %rsi
+	subq	144(%rsp), %rsi
+	cmpq	$4, %rsi
+	je	.L454
+.L400:
+	movq	%rcx, %rsi
+	addq	$1, %rcx
+	andq	%rdx, %rsi
+	movl	$1, (%rax,%rsi,4)
+	movq	%rcx, 136(%rsp)
+	movq	128(%rsp), %rax
+	subq	%rax, %rcx
+	cmpq	16(%rsp), %rcx
+	jnb	.L455
+.L402:
+	movq	136(%rsp), %rax
+	leaq	1(%rdx), %rcx
+	movq	%rax, %rsi
+	subq	144(%rsp), %rsi
+	cmpq	%rcx, %rsi
+	je	.L456
+.L403:
+	movq	(%rsp), %rcx
+	movq	%rax, %rsi
+	addq	$1, %rax
+	andq	%rdx, %rsi
+	movl	$2, (%rcx,%rsi,4)
+	movq	%rax, 136(%rsp)
+	movq	128(%rsp), %rcx
+	subq	%rcx, %rax
+	cmpq	16(%rsp), %rax
+	jnb	.L457
+.L405:
+	movq	136(%rsp), %rax
+	leaq	1(%rdx), %rcx
+	movq	%rax, %rsi
+	subq	144(%rsp), %rsi
+	cmpq	%rcx, %rsi
+	je	.L458
+.L406:
+	movq	(%rsp), %rcx
+	movq	%rax, %rsi
+	addq	$1, %rax
+	andq	%rdx, %rsi
+	movl	$3, (%rcx,%rsi,4)
+	movq	%rax, 136(%rsp)
+	movq	128(%rsp), %rcx
+	subq	%rcx, %rax
+	cmpq	16(%rsp), %rax
+	jnb	.L459
+.L408:
+	movq	136(%rsp), %rax
+	leaq	1(%rdx), %rcx
+	movq	%rax, %rsi
+	subq	144(%rsp), %rsi
+	cmpq	%rcx, %rsi
+	je	.L460
+.L409:
+	movq	(%rsp), %rcx
+	movq	%rax, %rsi
+	addq	$1, %rax
+	andq	%rdx, %rsi
+	movl	$4, (%rcx,%rsi,4)
+	movq	%rax, 136(%rsp)
+	movq	128(%rsp), %rcx
+	subq	%rcx, %rax
+	cmpq	16(%rsp), %rax
+	jnb	.L461
+.L411:
+	movq	136(%rsp), %rax
+	leaq	1(%rdx), %rcx
+	movq	%rax, %rsi
+	subq	144(%rsp), %rsi
+	cmpq	%rcx, %rsi
+	je	.L462
+.L412:
+	movq	(%rsp), %rcx
+	andq	%rax, %rdx
+	addq	$1, %rax
+	movl	$5, (%rcx,%rdx,4)
+	movq	%rax, 136(%rsp)
+	movq	128(%rsp), %rdx
+	subq	%rdx, %rax
+	cmpq	16(%rsp), %rax
+	jnb	.L463
+.L414:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC24(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB24:
+	call	__cxa_throw@PLT
+.LEHE24:
+	.p2align 4,,10
+	.p2align 3
+.L454:
+	movq	64(%rsp), %rax
+	movq	%rax, 144(%rsp)
+	movq	136(%rsp), %rcx
+	movq	8(%rsp), %rdx
+	movq	%rcx, %rsi
+	subq	%rax, %rsi
+	leaq	1(%rdx), %rax
+	cmpq	%rax, %rsi
+	je	.L401
+	movq	(%rsp), %rax
+	jmp	.L400
+	.p2align 4,,10
+	.p2align 3
+.L462:
+	movq	64(%rsp), %rcx
+	movq	%rcx, 144(%rsp)
+	movq	136(%rsp), %rax
+	movq	8(%rsp), %rdx
+	movq	%rax, %rsi
+	subq	%rcx, %rsi
+	leaq	1(%rdx), %rcx
+	cmpq	%rcx, %rsi
+	jne	.L412
+	movq	88(%rsp), %rax
+	testq	%rax, %rax
+	jne	.L464
+	movq	72(%rsp), %rax
+	cmpq	80(%rsp), %rax
+	je	.L465
+.L418:
+	movq	8(%rsp), %rcx
+	movq	(%rsp), %rdx
+	andq	%rax, %rcx
+	addq	$1, %rax
+	movl	(%rdx,%rcx,4), %edx
+	movq	%rax, 72(%rsp)
+	movq	64(%rsp), %rcx
+	subq	%rcx, %rax
+	cmpq	16(%rsp), %rax
+	jnb	.L466
+.L420:
+	cmpl	$1, %edx
+	jne	.L419
+	movq	136(%rsp), %rax
+	movq	8(%rsp), %rdx
+	movq	%rax, %rsi
+	leaq	1(%rdx), %rcx
+	subq	144(%rsp), %rsi
+	cmpq	%rcx, %rsi
+	je	.L467
+.L422:
+	movq	(%rsp), %rcx
+	andq	%rax, %rdx
+	addq	$1, %rax
+	movl	$5, (%rcx,%rdx,4)
+	movq	%rax, 136(%rsp)
+	movq	128(%rsp), %rdx
+	subq	%rdx, %rax
+	cmpq	16(%rsp), %rax
+	jnb	.L468
+.L424:
+	movq	88(%rsp), %rax
+	testq	%rax, %rax
+	jne	.L469
+.L425:
+	movq	72(%rsp), %rax
+	cmpq	80(%rsp), %rax
+	je	.L470
+.L427:
+	movq	8(%rsp), %rcx
+	movq	(%rsp), %rdx
+	andq	%rax, %rcx
+	addq	$1, %rax
+	movl	(%rdx,%rcx,4), %ecx
+	movq	%rax, 72(%rsp)
+	movq	64(%rsp), %rdx
+	subq	%rdx, %rax
+	cmpq	16(%rsp), %rax
+	jnb	.L471
+.L429:
+	xorl	%edx, %edx
+	.p2align 4,,10
+	.p2align 3
+.L435:
+	movq	88(%rsp), %rax
+	addl	%ecx, %edx
+	testq	%rax, %rax
+	jne	.L472
+.L430:
+	movq	72(%rsp), %rax
+	cmpq	80(%rsp), %rax
+	je	.L473
+.L432:
+	movq	8(%rsp), %rsi
+	movq	(%rsp), %rcx
+	andq	%rax, %rsi
+	addq	$1, %rax
+	movl	(%rcx,%rsi,4), %ecx
+	movq	%rax, 72(%rsp)
+	movq	64(%rsp), %rsi
+	subq	%rsi, %rax
+	cmpq	16(%rsp), %rax
+	jb	.L435
+	addl	%ecx, %edx
+	movq	72(%rsp), %rax
+	movq	%rax, 64(%rsp)
+	movq	88(%rsp), %rax
+	testq	%rax, %rax
+	je	.L430
+.L472:
+	addq	72(%rsp), %rax
+	movq	%rax, 72(%rsp)
+	movq	64(%rsp), %rcx
+	subq	%rcx, %rax
+	cmpq	16(%rsp), %rax
+	jnb	.L474
+.L431:
+	movq	$0, 88(%rsp)
+	movq	72(%rsp), %rax
+	cmpq	80(%rsp), %rax
+	jne	.L432
+.L473:
+	movq	128(%rsp), %rcx
+	movq	%rcx, 80(%rsp)
+	movq	72(%rsp), %rax
+	cmpq	%rax, %rcx
+	jne	.L432
+	cmpl	$14, %edx
+	jne	.L475
+	movq	8(%rsp), %rax
+	movq	24(%rsp), %rdi
+	movl	$4, %ecx
+	movq	(%rsp), %rsi
+	leaq	4(,%rax,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	-8(%rbp), %rbx
+	leave
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L471:
+	.cfi_restore_state
+	movq	72(%rsp), %rax
+	movq	%rax, 64(%rsp)
+	jmp	.L429
+	.p2align 4,,10
+	.p2align 3
+.L474:
+	movq	72(%rsp), %rax
+	movq	%rax, 64(%rsp)
+	jmp	.L431
+	.p2align 4,,10
+	.p2align 3
+.L467:
+	movq	64(%rsp), %rcx
+	movq	%rcx, 144(%rsp)
+	movq	136(%rsp), %rax
+	movq	8(%rsp), %rdx
+	movq	%rax, %rsi
+	subq	%rcx, %rsi
+	leaq	1(%rdx), %rcx
+	cmpq	%rcx, %rsi
+	jne	.L422
+	jmp	.L423
+	.p2align 4,,10
+	.p2align 3
+.L460:
+	movq	64(%rsp), %rcx
+	movq	%rcx, 144(%rsp)
+	movq	136(%rsp), %rax
+	movq	8(%rsp), %rdx
+	movq	%rax, %rsi
+	subq	%rcx, %rsi
+	leaq	1(%rdx), %rcx
+	cmpq	%rcx, %rsi
+	jne	.L409
+	jmp	.L410
+	.p2align 4,,10
+	.p2align 3
+.L458:
+	movq	64(%rsp), %rcx
+	movq	%rcx, 144(%rsp)
+	movq	136(%rsp), %rax
+	movq	8(%rsp), %rdx
+	movq	%rax, %rsi
+	subq	%rcx, %rsi
+	leaq	1(%rdx), %rcx
+	cmpq	%rcx, %rsi
+	jne	.L406
+	jmp	.L407
+	.p2align 4,,10
+	.p2align 3
+.L456:
+	movq	64(%rsp), %rcx
+	movq	%rcx, 144(%rsp)
+	movq	136(%rsp), %rax
+	movq	8(%rsp), %rdx
+	movq	%rax, %rsi
+	subq	%rcx, %rsi
+	leaq	1(%rdx), %rcx
+	cmpq	%rcx, %rsi
+	jne	.L403
+	jmp	.L404
+	.p2align 4,,10
+	.p2align 3
+.L464:
+	addq	72(%rsp), %rax
+	movq	%rax, 72(%rsp)
+	movq	64(%rsp), %rdx
+	subq	%rdx, %rax
+	cmpq	16(%rsp), %rax
+	jnb	.L476
+.L417:
+	movq	$0, 88(%rsp)
+	movq	72(%rsp), %rax
+	cmpq	80(%rsp), %rax
+	jne	.L418
+.L465:
+	movq	128(%rsp), %rdx
+	movq	%rdx, 80(%rsp)
+	movq	72(%rsp), %rax
+	cmpq	%rax, %rdx
+	je	.L419
+	jmp	.L418
+	.p2align 4,,10
+	.p2align 3
+.L470:
+	movq	128(%rsp), %rdx
+	movq	%rdx, 80(%rsp)
+	movq	72(%rsp), %rax
+	cmpq	%rax, %rdx
+	je	.L428
+	jmp	.L427
+	.p2align 4,,10
+	.p2align 3
+.L469:
+	addq	72(%rsp), %rax
+	movq	%rax, 72(%rsp)
+	movq	64(%rsp), %rdx
+	subq	%rdx, %rax
+	cmpq	16(%rsp), %rax
+	jnb	.L477
+.L426:
+	movq	$0, 88(%rsp)
+	jmp	.L425
+	.p2align 4,,10
+	.p2align 3
+.L461:
+	movq	136(%rsp), %rax
+	movq	%rax, 128(%rsp)
+	movq	8(%rsp), %rdx
+	jmp	.L411
+	.p2align 4,,10
+	.p2align 3
+.L463:
+	movq	136(%rsp), %rax
+	movq	%rax, 128(%rsp)
+	jmp	.L414
+	.p2align 4,,10
+	.p2align 3
+.L457:
+	movq	136(%rsp), %rax
+	movq	%rax, 128(%rsp)
+	movq	8(%rsp), %rdx
+	jmp	.L405
+	.p2align 4,,10
+	.p2align 3
+.L455:
+	movq	136(%rsp), %rax
+	movq	%rax, 128(%rsp)
+	movq	8(%rsp), %rdx
+	jmp	.L402
+	.p2align 4,,10
+	.p2align 3
+.L468:
+	movq	136(%rsp), %rax
+	movq	%rax, 128(%rsp)
+	jmp	.L424
+	.p2align 4,,10
+	.p2align 3
+.L459:
+	movq	136(%rsp), %rax
+	movq	%rax, 128(%rsp)
+	movq	8(%rsp), %rdx
+	jmp	.L408
+	.p2align 4,,10
+	.p2align 3
+.L466:
+	movq	72(%rsp), %rax
+	movq	%rax, 64(%rsp)
+	jmp	.L420
+	.p2align 4,,10
+	.p2align 3
+.L453:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L478
+.L397:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	jmp	.L395
+	.p2align 4,,10
+	.p2align 3
+.L477:
+	movq	72(%rsp), %rax
+	movq	%rax, 64(%rsp)
+	jmp	.L426
+	.p2align 4,,10
+	.p2align 3
+.L476:
+	movq	72(%rsp), %rax
+	movq	%rax, 64(%rsp)
+	jmp	.L417
+.L478:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L397
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L397
+.L447:
+	jmp	.L448
+.L475:
+	jmp	.L428
+	.section	.gcc_except_table
+.LLSDA6807:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6807-.LLSDACSB6807
+.LLSDACSB6807:
+	.uleb128 .LEHB23-.LFB6807
+	.uleb128 .LEHE23-.LEHB23
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB24-.LFB6807
+	.uleb128 .LEHE24-.LEHB24
+	.uleb128 .L447-.LFB6807
+	.uleb128 0
+.LLSDACSE6807:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6807
+	.type	_Z23test_spsc_single_threadv.cold, @function
+_Z23test_spsc_single_threadv.cold:
+.LFSB6807:
+.L449:
+	.cfi_def_cfa 6, 16
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC20(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB25:
+	call	__cxa_throw@PLT
+.LEHE25:
+.L437:
+.L448:
+	movq	24(%rsp), %rdi
+	movq	%rax, %rbx
+	movq	8(%rsp), %rax
+	movl	$4, %ecx
+	movq	(%rsp), %rsi
+	leaq	4(,%rax,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	%rbx, %rdi
+.LEHB26:
+	call	_Unwind_Resume@PLT
+.LEHE26:
+.L401:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC21(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB27:
+	call	__cxa_throw@PLT
+.L419:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC11(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L423:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC25(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L410:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC12(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L407:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC23(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L428:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC26(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L404:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC22(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE27:
+	.cfi_endproc
+.LFE6807:
+	.section	.gcc_except_table
+.LLSDAC6807:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6807-.LLSDACSBC6807
+.LLSDACSBC6807:
+	.uleb128 .LEHB25-.LCOLDB27
+	.uleb128 .LEHE25-.LEHB25
+	.uleb128 .L437-.LCOLDB27
+	.uleb128 0
+	.uleb128 .LEHB26-.LCOLDB27
+	.uleb128 .LEHE26-.LEHB26
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB27-.LCOLDB27
+	.uleb128 .LEHE27-.LEHB27
+	.uleb128 .L437-.LCOLDB27
+	.uleb128 0
+.LLSDACSEC6807:
+	.section	.text.unlikely
+	.text
+	.size	_Z23test_spsc_single_threadv, .-_Z23test_spsc_single_threadv
+	.section	.text.unlikely
+	.size	_Z23test_spsc_single_threadv.cold, .-_Z23test_spsc_single_threadv.cold
+.LCOLDE27:
+	.text
+.LHOTE27:
+	.section	.rodata.str1.8
+	.align 8
+.LC29:
+	.string	"expected equal : expected value : k.len(), actual value : 4"
+	.align 8
+.LC30:
+	.string	"expected equal : expected value : k.data()[3], actual value : 3"
+	.align 8
+.LC31:
+	.string	"expected equal : expected value : k.len(), actual value : 2"
+	.align 8
+.LC32:
+	.string	"expected equal : expected value : k.data()[0], actual value : 6"
+	.align 8
+.LC33:
+	.string	"expected equal : expected value : r.next_chunk(8).len(), actual value : 4"
+	.align 8
+.LC34:
+	.string	"expected equal : expected value : r.next_chunk(8).len(), actual value : 0"
+	.section	.text.unlikely
+.LCOLDB35:
+	.text
+.LHOTB35:
+	.p2align 4
+	.globl	_Z20test_spsc_next_chunkv
+	.type	_Z20test_spsc_next_chunkv, @function
+_Z20test_spsc_next_chunkv:
+.LFB6824:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6824
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r12
+	pushq	%rbx
+	andq	$-64, %rsp
+	subq	$192, %rsp
+	.cfi_offset 12, -24
+	.cfi_offset 3, -32
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rdi
+	testq	%rdi, %rdi
+	je	.L568
+.L480:
+	movq	(%rdi), %rax
+	movq	%rdi, 24(%rsp)
+	movl	$4, %edx
+	xorl	%ebx, %ebx
+	movdqa	.LC28(%rip), %xmm0
+	movq	$0, (%rsp)
+	movl	$32, %esi
+	movq	$0, 144(%rsp)
+	movups	%xmm0, 8(%rsp)
+	pxor	%xmm0, %xmm0
+	movb	$0, 152(%rsp)
+	movaps	%xmm0, 64(%rsp)
+	movaps	%xmm0, 80(%rsp)
+	movaps	%xmm0, 128(%rsp)
+.LEHB28:
+	call	*16(%rax)
+.LEHE28:
+	movq	%rax, (%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L490:
+	movq	136(%rsp), %rax
+	movq	8(%rsp), %rdx
+	movq	%rax, %rsi
+	leaq	1(%rdx), %rcx
+	subq	144(%rsp), %rsi
+	cmpq	%rcx, %rsi
+	jb	.L484
+	xorl	%r12d, %r12d
+	movq	%rax, 128(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L485:
+	movq	136(%rsp), %rax
+	movq	64(%rsp), %rcx
+	subq	%rcx, %rax
+	movq	%rcx, 144(%rsp)
+	movq	8(%rsp), %rdx
+	leaq	1(%rdx), %rcx
+	cmpq	%rcx, %rax
+	jne	.L569
+	cmpl	$63, %r12d
+	ja	.L486
+	rep nop
+	addl	$1, %r12d
+	jmp	.L485
+	.p2align 4,,10
+	.p2align 3
+.L486:
+	call	sched_yield@PLT
+	jmp	.L485
+	.p2align 4,,10
+	.p2align 3
+.L569:
+	movq	136(%rsp), %rax
+.L484:
+	movq	(%rsp), %rcx
+	andq	%rax, %rdx
+	addq	$1, %rax
+	movl	%ebx, (%rcx,%rdx,4)
+	movq	%rax, 136(%rsp)
+	movq	128(%rsp), %rdx
+	subq	%rdx, %rax
+	cmpq	16(%rsp), %rax
+	jnb	.L570
+.L489:
+	addl	$1, %ebx
+	cmpl	$6, %ebx
+	jne	.L490
+	movq	88(%rsp), %rax
+	testq	%rax, %rax
+	jne	.L571
+	movq	72(%rsp), %rax
+	movq	80(%rsp), %rdx
+	cmpq	%rdx, %rax
+	je	.L572
+.L493:
+	movq	8(%rsp), %rcx
+	subq	%rax, %rdx
+	movl	$4, %edi
+	movq	%rcx, %rsi
+	addq	$1, %rcx
+	andq	%rax, %rsi
+	subq	%rsi, %rcx
+	cmpq	%rdi, %rdx
+	cmova	%rdi, %rdx
+	cmpq	%rdx, %rcx
+	cmovbe	%rcx, %rdx
+	movq	(%rsp), %rcx
+	movq	%rdx, 88(%rsp)
+	leaq	(%rcx,%rsi,4), %rcx
+	cmpq	$4, %rdx
+	jne	.L500
+	cmpl	$3, 12(%rcx)
+	jne	.L563
+	addq	$4, %rax
+	movq	%rax, 72(%rsp)
+	movq	64(%rsp), %rdx
+	subq	%rdx, %rax
+	cmpq	16(%rsp), %rax
+	jnb	.L573
+.L502:
+	movq	72(%rsp), %rsi
+	movq	80(%rsp), %rax
+	movq	$0, 88(%rsp)
+	cmpq	%rax, %rsi
+	je	.L574
+.L503:
+	movq	8(%rsp), %rdx
+	subq	%rsi, %rax
+	leaq	1(%rdx), %rcx
+	movq	%rdx, %r8
+	andq	%rsi, %r8
+	movq	%rcx, %rdi
+	movl	$8, %esi
+	subq	%r8, %rdi
+	cmpq	%rsi, %rax
+	cmova	%rsi, %rax
+	cmpq	%rax, %rdi
+	cmovbe	%rdi, %rax
+	movq	%rax, 88(%rsp)
+	cmpq	$2, %rax
+	jne	.L510
+	.p2align 4,,10
+	.p2align 3
+.L518:
+	movq	136(%rsp), %rax
+	movq	%rax, %rsi
+	subq	144(%rsp), %rsi
+	cmpq	%rcx, %rsi
+	jb	.L511
+	xorl	%r12d, %r12d
+	movq	%rax, 128(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L512:
+	movq	136(%rsp), %rax
+	movq	64(%rsp), %rcx
+	subq	%rcx, %rax
+	movq	%rcx, 144(%rsp)
+	movq	8(%rsp), %rdx
+	leaq	1(%rdx), %rcx
+	cmpq	%rcx, %rax
+	jne	.L575
+	cmpl	$63, %r12d
+	ja	.L513
+	rep nop
+	addl	$1, %r12d
+	jmp	.L512
+	.p2align 4,,10
+	.p2align 3
+.L513:
+	call	sched_yield@PLT
+	jmp	.L512
+	.p2align 4,,10
+	.p2align 3
+.L575:
+	movq	136(%rsp), %rax
+.L511:
+	movq	(%rsp), %rcx
+	andq	%rax, %rdx
+	addq	$1, %rax
+	movl	%ebx, (%rcx,%rdx,4)
+	movq	%rax, 136(%rsp)
+	movq	128(%rsp), %rdx
+	subq	%rdx, %rax
+	cmpq	16(%rsp), %rax
+	jnb	.L576
+	addl	$1, %ebx
+	cmpl	$12, %ebx
+	je	.L517
+.L577:
+	movq	8(%rsp), %rdx
+	leaq	1(%rdx), %rcx
+	jmp	.L518
+	.p2align 4,,10
+	.p2align 3
+.L570:
+	movq	136(%rsp), %rax
+	movq	%rax, 128(%rsp)
+	jmp	.L489
+	.p2align 4,,10
+	.p2align 3
+.L576:
+	addl	$1, %ebx
+	movq	136(%rsp), %rax
+	movq	%rax, 128(%rsp)
+	cmpl	$12, %ebx
+	jne	.L577
+.L517:
+	movq	136(%rsp), %rax
+	movq	%rax, 128(%rsp)
+	movb	$1, 152(%rsp)
+	movq	88(%rsp), %rax
+	testq	%rax, %rax
+	jne	.L578
+.L519:
+	movq	72(%rsp), %rax
+	movq	80(%rsp), %rdx
+	cmpq	%rdx, %rax
+	je	.L579
+.L521:
+	movq	8(%rsp), %rcx
+	subq	%rax, %rdx
+	movl	$8, %edi
+	movq	%rcx, %rsi
+	addq	$1, %rcx
+	andq	%rax, %rsi
+	subq	%rsi, %rcx
+	cmpq	%rdi, %rdx
+	cmova	%rdi, %rdx
+	cmpq	%rdx, %rcx
+	cmovbe	%rcx, %rdx
+	movq	(%rsp), %rcx
+	movq	%rdx, 88(%rsp)
+	leaq	(%rcx,%rsi,4), %rcx
+	cmpq	$2, %rdx
+	jne	.L528
+	cmpl	$6, (%rcx)
+	jne	.L564
+	addq	$2, %rax
+	movq	%rax, 72(%rsp)
+	movq	64(%rsp), %rdx
+	subq	%rdx, %rax
+	cmpq	16(%rsp), %rax
+	jnb	.L580
+.L530:
+	movq	72(%rsp), %rax
+	movq	80(%rsp), %rdx
+	movq	$0, 88(%rsp)
+	cmpq	%rdx, %rax
+	je	.L581
+.L531:
+	movq	8(%rsp), %rsi
+	subq	%rax, %rdx
+	leaq	1(%rsi), %rcx
+	andq	%rax, %rsi
+	subq	%rsi, %rcx
+	movl	$8, %esi
+	cmpq	%rsi, %rdx
+	cmova	%rsi, %rdx
+	cmpq	%rdx, %rcx
+	cmovbe	%rcx, %rdx
+	movq	%rdx, 88(%rsp)
+	cmpq	$4, %rdx
+	jne	.L538
+	addq	$4, %rax
+	movq	%rax, 72(%rsp)
+	movq	64(%rsp), %rdx
+	subq	%rdx, %rax
+	cmpq	16(%rsp), %rax
+	jnb	.L582
+.L539:
+	movq	72(%rsp), %rdx
+	movq	80(%rsp), %rax
+	movq	$0, 88(%rsp)
+	cmpq	%rax, %rdx
+	je	.L583
+.L540:
+	movq	8(%rsp), %rsi
+	subq	%rdx, %rax
+	movq	%rsi, %rdi
+	leaq	1(%rsi), %rcx
+	andq	%rdx, %rdi
+	movl	$8, %edx
+	subq	%rdi, %rcx
+	cmpq	%rdx, %rax
+	cmova	%rdx, %rax
+	cmpq	%rax, %rcx
+	cmovbe	%rcx, %rax
+	movq	%rax, 88(%rsp)
+	testq	%rax, %rax
+	jne	.L565
+.L543:
+	movq	24(%rsp), %rdi
+	leaq	4(,%rsi,4), %rdx
+	movl	$4, %ecx
+	movq	(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	leaq	-16(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L571:
+	.cfi_restore_state
+	addq	72(%rsp), %rax
+	movq	%rax, 72(%rsp)
+	movq	64(%rsp), %rdx
+	subq	%rdx, %rax
+	cmpq	16(%rsp), %rax
+	jnb	.L584
+.L492:
+	movq	72(%rsp), %rax
+	movq	80(%rsp), %rdx
+	movq	$0, 88(%rsp)
+	cmpq	%rdx, %rax
+	jne	.L493
+.L572:
+	movq	128(%rsp), %rdx
+	movq	%rdx, 80(%rsp)
+	movq	72(%rsp), %rax
+	cmpq	%rax, %rdx
+	jne	.L493
+	movq	%rdx, 64(%rsp)
+	movq	72(%rsp), %rax
+	movq	80(%rsp), %rdx
+	cmpq	%rax, %rdx
+	jne	.L493
+	xorl	%r12d, %r12d
+.L494:
+	movq	128(%rsp), %rdx
+	movq	%rdx, 80(%rsp)
+	movq	72(%rsp), %rax
+	cmpq	%rax, %rdx
+	jne	.L493
+	movzbl	152(%rsp), %eax
+	testb	%al, %al
+	jne	.L585
+	cmpl	$63, %r12d
+	ja	.L496
+	rep nop
+	addl	$1, %r12d
+.L497:
+	movq	72(%rsp), %rax
+	movq	80(%rsp), %rdx
+	cmpq	%rdx, %rax
+	jne	.L493
+	jmp	.L494
+	.p2align 4,,10
+	.p2align 3
+.L583:
+	movq	128(%rsp), %rax
+	movq	%rax, 80(%rsp)
+	movq	72(%rsp), %rdx
+	cmpq	%rdx, %rax
+	jne	.L540
+	movq	%rax, 64(%rsp)
+	movq	72(%rsp), %rdx
+	movq	80(%rsp), %rax
+	cmpq	%rdx, %rax
+	jne	.L540
+	xorl	%ebx, %ebx
+.L541:
+	movq	128(%rsp), %rax
+	movq	%rax, 80(%rsp)
+	movq	72(%rsp), %rdx
+	cmpq	%rdx, %rax
+	jne	.L540
+	movzbl	152(%rsp), %eax
+	testb	%al, %al
+	jne	.L586
+	cmpl	$63, %ebx
+	ja	.L544
+	rep nop
+	addl	$1, %ebx
+.L545:
+	movq	72(%rsp), %rdx
+	movq	80(%rsp), %rax
+	cmpq	%rax, %rdx
+	jne	.L540
+	jmp	.L541
+	.p2align 4,,10
+	.p2align 3
+.L581:
+	movq	128(%rsp), %rdx
+	movq	%rdx, 80(%rsp)
+	movq	72(%rsp), %rax
+	cmpq	%rax, %rdx
+	jne	.L531
+	movq	%rdx, 64(%rsp)
+	movq	72(%rsp), %rax
+	movq	80(%rsp), %rdx
+	cmpq	%rdx, %rax
+	jne	.L531
+	xorl	%ebx, %ebx
+.L532:
+	movq	128(%rsp), %rdx
+	movq	%rdx, 80(%rsp)
+	movq	72(%rsp), %rax
+	cmpq	%rax, %rdx
+	jne	.L531
+	movzbl	152(%rsp), %eax
+	testb	%al, %al
+	jne	.L587
+	cmpl	$63, %ebx
+	ja	.L534
+	rep nop
+	addl	$1, %ebx
+.L535:
+	movq	72(%rsp), %rax
+	movq	80(%rsp), %rdx
+	cmpq	%rdx, %rax
+	jne	.L531
+	jmp	.L532
+	.p2align 4,,10
+	.p2align 3
+.L579:
+	movq	128(%rsp), %rdx
+	movq	%rdx, 80(%rsp)
+	movq	72(%rsp), %rax
+	cmpq	%rax, %rdx
+	jne	.L521
+	movq	%rdx, 64(%rsp)
+	movq	72(%rsp), %rax
+	movq	80(%rsp), %rdx
+	cmpq	%rdx, %rax
+	jne	.L521
+	xorl	%ebx, %ebx
+.L522:
+	movq	128(%rsp), %rdx
+	movq	%rdx, 80(%rsp)
+	movq	72(%rsp), %rax
+	cmpq	%rax, %rdx
+	jne	.L521
+	movzbl	152(%rsp), %eax
+	testb	%al, %al
+	jne	.L588
+	cmpl	$63, %ebx
+	ja	.L524
+	rep nop
+	addl	$1, %ebx
+.L525:
+	movq	72(%rsp), %rax
+	movq	80(%rsp), %rdx
+	cmpq	%rdx, %rax
+	jne	.L521
+	jmp	.L522
+	.p2align 4,,10
+	.p2align 3
+.L578:
+	addq	72(%rsp), %rax
+	movq	%rax, 72(%rsp)
+	movq	64(%rsp), %rdx
+	subq	%rdx, %rax
+	cmpq	16(%rsp), %rax
+	jnb	.L589
+.L520:
+	movq	$0, 88(%rsp)
+	jmp	.L519
+	.p2align 4,,10
+	.p2align 3
+.L574:
+	movq	128(%rsp), %rax
+	movq	%rax, 80(%rsp)
+	movq	72(%rsp), %rsi
+	cmpq	%rsi, %rax
+	jne	.L503
+	movq	%rax, 64(%rsp)
+	movq	72(%rsp), %rsi
+	movq	80(%rsp), %rax
+	cmpq	%rsi, %rax
+	jne	.L503
+	xorl	%r12d, %r12d
+.L504:
+	movq	128(%rsp), %rax
+	movq	%rax, 80(%rsp)
+	movq	72(%rsp), %rsi
+	cmpq	%rsi, %rax
+	jne	.L503
+	movzbl	152(%rsp), %eax
+	testb	%al, %al
+	jne	.L590
+	cmpl	$63, %r12d
+	ja	.L506
+	rep nop
+	addl	$1, %r12d
+.L507:
+	movq	72(%rsp), %rsi
+	movq	80(%rsp), %rax
+	cmpq	%rax, %rsi
+	jne	.L503
+	jmp	.L504
+.L568:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L591
+.L482:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	jmp	.L480
+.L584:
+	movq	72(%rsp), %rax
+	movq	%rax, 64(%rsp)
+	jmp	.L492
+.L589:
+	movq	72(%rsp), %rax
+	movq	%rax, 64(%rsp)
+	jmp	.L520
+	.p2align 4,,10
+	.p2align 3
+.L573:
+	movq	72(%rsp), %rax
+	movq	%rax, 64(%rsp)
+	jmp	.L502
+	.p2align 4,,10
+	.p2align 3
+.L580:
+	movq	72(%rsp), %rax
+	movq	%rax, 64(%rsp)
+	jmp	.L530
+	.p2align 4,,10
+	.p2align 3
+.L582:
+	movq	72(%rsp), %rax
+	movq	%rax, 64(%rsp)
+	jmp	.L539
+.L591:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L482
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L482
+.L506:
+	call	sched_yield@PLT
+	jmp	.L507
+.L496:
+	call	sched_yield@PLT
+	jmp	.L497
+.L524:
+	call	sched_yield@PLT
+	jmp	.L525
+.L534:
+	call	sched_yield@PLT
+	jmp	.L535
+.L544:
+	call	sched_yield@PLT
+	jmp	.L545
+.L588:
+	movq	72(%rsp), %rax
+	movq	80(%rsp), %rdx
+	cmpq	%rdx, %rax
+	jne	.L521
+	movq	128(%rsp), %rdx
+	movq	%rdx, 80(%rsp)
+	movq	72(%rsp), %rax
+	cmpq	%rax, %rdx
+	je	.L528
+	jmp	.L521
+	.p2align 4,,10
+	.p2align 3
+.L590:
+	movq	72(%rsp), %rsi
+	movq	80(%rsp), %rax
+	cmpq	%rax, %rsi
+	jne	.L503
+	movq	128(%rsp), %rax
+	movq	%rax, 80(%rsp)
+	movq	72(%rsp), %rsi
+	cmpq	%rsi, %rax
+	je	.L510
+	jmp	.L503
+	.p2align 4,,10
+	.p2align 3
+.L585:
+	movq	72(%rsp), %rax
+	movq	80(%rsp), %rdx
+	cmpq	%rdx, %rax
+	jne	.L493
+	movq	128(%rsp), %rdx
+	movq	%rdx, 80(%rsp)
+	movq	72(%rsp), %rax
+	cmpq	%rax, %rdx
+	je	.L500
+	jmp	.L493
+	.p2align 4,,10
+	.p2align 3
+.L587:
+	movq	72(%rsp), %rax
+	movq	80(%rsp), %rdx
+	cmpq	%rdx, %rax
+	jne	.L531
+	movq	128(%rsp), %rdx
+	movq	%rdx, 80(%rsp)
+	movq	72(%rsp), %rax
+	cmpq	%rax, %rdx
+	je	.L538
+	jmp	.L531
+	.p2align 4,,10
+	.p2align 3
+.L586:
+	movq	72(%rsp), %rdx
+	movq	80(%rsp), %rax
+	cmpq	%rax, %rdx
+	jne	.L540
+	movq	128(%rsp), %rax
+	movq	%rax, 80(%rsp)
+	movq	72(%rsp), %rdx
+	cmpq	%rdx, %rax
+	jne	.L540
+	movq	8(%rsp), %rsi
+	jmp	.L543
+	.section	.gcc_except_table
+.LLSDA6824:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6824-.LLSDACSB6824
+.LLSDACSB6824:
+	.uleb128 .LEHB28-.LFB6824
+	.uleb128 .LEHE28-.LEHB28
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6824:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6824
+	.type	_Z20test_spsc_next_chunkv.cold, @function
+_Z20test_spsc_next_chunkv.cold:
+.LFSB6824:
+.L510:
+	.cfi_def_cfa 6, 16
+	.cfi_offset 3, -32
+	.cfi_offset 6, -16
+	.cfi_offset 12, -24
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC31(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB29:
+	call	__cxa_throw@PLT
+.L500:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC29(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L565:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC34(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE29:
+.L549:
+	movq	24(%rsp), %rdi
+	movq	%rax, %rbx
+	movq	8(%rsp), %rax
+	movl	$4, %ecx
+	movq	(%rsp), %rsi
+	leaq	4(,%rax,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	%rbx, %rdi
+.LEHB30:
+	call	_Unwind_Resume@PLT
+.LEHE30:
+.L564:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC32(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB31:
+	call	__cxa_throw@PLT
+.L528:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC31(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L563:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC30(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L538:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC33(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE31:
+	.cfi_endproc
+.LFE6824:
+	.section	.gcc_except_table
+.LLSDAC6824:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6824-.LLSDACSBC6824
+.LLSDACSBC6824:
+	.uleb128 .LEHB29-.LCOLDB35
+	.uleb128 .LEHE29-.LEHB29
+	.uleb128 .L549-.LCOLDB35
+	.uleb128 0
+	.uleb128 .LEHB30-.LCOLDB35
+	.uleb128 .LEHE30-.LEHB30
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB31-.LCOLDB35
+	.uleb128 .LEHE31-.LEHB31
+	.uleb128 .L549-.LCOLDB35
+	.uleb128 0
+.LLSDACSEC6824:
+	.section	.text.unlikely
+	.text
+	.size	_Z20test_spsc_next_chunkv, .-_Z20test_spsc_next_chunkv
+	.section	.text.unlikely
+	.size	_Z20test_spsc_next_chunkv.cold, .-_Z20test_spsc_next_chunkv.cold
+.LCOLDE35:
+	.text
+.LHOTE35:
+	.section	.rodata.str1.1
+.LC36:
+	.string	"left"
+.LC37:
+	.string	"in the channel"
+.LC39:
+	.string	"expected true : r.has_next()"
+	.section	.rodata.str1.8
+	.align 8
+.LC40:
+	.string	"expected true : r.next() == n::str(\"left\")"
+	.section	.text.unlikely
+.LCOLDB43:
+	.text
+.LHOTB43:
+	.p2align 4
+	.globl	_Z28test_spsc_destroys_remainingv
+	.type	_Z28test_spsc_destroys_remainingv, @function
+_Z28test_spsc_destroys_remainingv:
+.LFB6810:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6810
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	andq	$-64, %rsp
+	subq	$320, %rsp
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rdi
+	testq	%rdi, %rdi
+	je	.L833
+.L593:
+	movdqa	.LC28(%rip), %xmm0
+	movq	(%rdi), %rax
+	movq	$0, 128(%rsp)
+	movl	$8, %edx
+	movq	%rdi, 152(%rsp)
+	movl	$384, %esi
+	movups	%xmm0, 136(%rsp)
+	pxor	%xmm0, %xmm0
+	movq	$0, 272(%rsp)
+	movb	$0, 280(%rsp)
+	movaps	%xmm0, 192(%rsp)
+	movaps	%xmm0, 208(%rsp)
+	movaps	%xmm0, 256(%rsp)
+.LEHB32:
+	call	*16(%rax)
+.LEHE32:
+	movdqa	.LC38(%rip), %xmm1
+	movq	%rax, 128(%rsp)
+	movaps	%xmm1, 80(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L597
+	pxor	%xmm0, %xmm0
+	leaq	104(%rsp), %rbx
+	movq	%rax, 96(%rsp)
+	xorl	%r14d, %r14d
+	leaq	.LC36(%rip), %r12
+	movups	%xmm0, 104(%rsp)
+	movq	$0, 120(%rsp)
+	cmpq	%rbx, %r12
+	jb	.L744
+.L823:
+	leaq	.LC36(%rip), %rax
+	.p2align 4,,10
+	.p2align 3
+.L598:
+	movl	(%rax), %eax
+	movl	%eax, (%rbx,%r14)
+	movq	80(%rsp), %rax
+	leaq	4(%rax), %rdx
+	movq	%rdx, 80(%rsp)
+	movb	$0, 4(%rbx,%rax)
+	movq	264(%rsp), %rax
+	movq	136(%rsp), %rcx
+	movq	%rax, %rsi
+	subq	272(%rsp), %rsi
+	leaq	1(%rcx), %rdx
+	cmpq	%rdx, %rsi
+	jnb	.L834
+.L611:
+	andq	%rcx, %rax
+	movdqa	.LC38(%rip), %xmm2
+	leaq	(%rax,%rax,2), %rbx
+	salq	$4, %rbx
+	addq	128(%rsp), %rbx
+	movups	%xmm2, (%rbx)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L835
+.L617:
+	movq	96(%rsp), %rax
+	movdqa	80(%rsp), %xmm3
+	pxor	%xmm0, %xmm0
+	movq	$0, 40(%rbx)
+	movups	%xmm0, 24(%rbx)
+	movq	%rax, 16(%rbx)
+	movq	88(%rsp), %rax
+	movups	%xmm3, (%rbx)
+	cmpq	$23, %rax
+	je	.L836
+	movq	$23, 88(%rsp)
+	movq	104(%rsp), %rax
+	movq	%rax, 24(%rbx)
+.L620:
+	movq	264(%rsp), %rax
+	movb	$0, 104(%rsp)
+	movq	$0, 80(%rsp)
+	addq	$1, %rax
+	movq	%rax, 264(%rsp)
+	movq	256(%rsp), %rdx
+	subq	%rdx, %rax
+	cmpq	144(%rsp), %rax
+	jnb	.L837
+.L621:
+	movq	88(%rsp), %rdx
+	cmpq	$23, %rdx
+	je	.L622
+	movq	96(%rsp), %rdi
+	movq	104(%rsp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L622:
+	movdqa	.LC38(%rip), %xmm4
+	movaps	%xmm4, 80(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L623
+	pxor	%xmm0, %xmm0
+	leaq	104(%rsp), %rbx
+	movq	%rax, 96(%rsp)
+	xorl	%r13d, %r13d
+	leaq	.LC37(%rip), %rsi
+	movups	%xmm0, 104(%rsp)
+	movq	$0, 120(%rsp)
+	cmpq	%rbx, %rsi
+	jb	.L624
+.L824:
+	leaq	.LC37(%rip), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L624:
+	movl	$14, %edx
+	leaq	(%rbx,%r13), %rdi
+	call	memmove@PLT
+	movq	80(%rsp), %rax
+	leaq	14(%rax), %rdx
+	movq	%rdx, 80(%rsp)
+	movb	$0, 14(%rbx,%rax)
+	movq	264(%rsp), %rax
+	movq	136(%rsp), %rcx
+	movq	%rax, %rsi
+	subq	272(%rsp), %rsi
+	leaq	1(%rcx), %rdx
+	cmpq	%rdx, %rsi
+	jnb	.L838
+.L637:
+	andq	%rcx, %rax
+	movdqa	.LC38(%rip), %xmm5
+	leaq	(%rax,%rax,2), %rbx
+	salq	$4, %rbx
+	addq	128(%rsp), %rbx
+	movups	%xmm5, (%rbx)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L839
+.L643:
+	movq	96(%rsp), %rax
+	movdqa	80(%rsp), %xmm6
+	pxor	%xmm0, %xmm0
+	movq	$0, 40(%rbx)
+	movups	%xmm0, 24(%rbx)
+	movq	%rax, 16(%rbx)
+	movq	88(%rsp), %rax
+	movups	%xmm6, (%rbx)
+	cmpq	$23, %rax
+	je	.L840
+	movq	$23, 88(%rsp)
+	movq	104(%rsp), %rax
+	movq	%rax, 24(%rbx)
+.L646:
+	movq	264(%rsp), %rax
+	movb	$0, 104(%rsp)
+	movq	$0, 80(%rsp)
+	addq	$1, %rax
+	movq	%rax, 264(%rsp)
+	movq	256(%rsp), %rdx
+	subq	%rdx, %rax
+	cmpq	144(%rsp), %rax
+	jnb	.L841
+.L647:
+	movq	88(%rsp), %rdx
+	cmpq	$23, %rdx
+	je	.L648
+	movq	96(%rsp), %rdi
+	movq	104(%rsp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L648:
+	movq	264(%rsp), %rax
+	movq	%rax, 256(%rsp)
+	movb	$1, 280(%rsp)
+	cmpq	$0, 216(%rsp)
+	je	.L649
+	xorl	%ebx, %ebx
+	jmp	.L831
+	.p2align 4,,10
+	.p2align 3
+.L843:
+	movq	16(%rax), %rdi
+	movq	24(%rax), %rsi
+	addq	$1, %rdx
+	addq	$1, %rbx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	216(%rsp), %rax
+	cmpq	%rax, %rbx
+	jnb	.L842
+.L831:
+	movq	128(%rsp), %rsi
+	movq	200(%rsp), %rcx
+.L653:
+	leaq	(%rbx,%rcx), %rax
+	andq	136(%rsp), %rax
+	leaq	(%rax,%rax,2), %rax
+	salq	$4, %rax
+	addq	%rsi, %rax
+	movq	8(%rax), %rdx
+	cmpq	$23, %rdx
+	jne	.L843
+	movq	216(%rsp), %rax
+	addq	$1, %rbx
+	cmpq	%rax, %rbx
+	jb	.L653
+.L652:
+	addq	%rcx, %rax
+	movq	%rax, 200(%rsp)
+	movq	192(%rsp), %rdx
+	subq	%rdx, %rax
+	cmpq	144(%rsp), %rax
+	jnb	.L844
+.L654:
+	movq	$0, 216(%rsp)
+.L649:
+	movq	208(%rsp), %rax
+	cmpq	%rax, 200(%rsp)
+	je	.L845
+.L655:
+	movdqa	.LC38(%rip), %xmm7
+	movaps	%xmm7, 80(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L663
+	movq	%rax, 96(%rsp)
+	pxor	%xmm0, %xmm0
+	leaq	104(%rsp), %rbx
+	xorl	%r14d, %r14d
+	movq	$0, 120(%rsp)
+	movups	%xmm0, 104(%rsp)
+.L742:
+	leaq	.LC36(%rip), %rax
+.L664:
+	movl	(%rax), %eax
+	movdqa	.LC38(%rip), %xmm1
+	movl	%eax, (%rbx,%r14)
+	movq	80(%rsp), %rax
+	movaps	%xmm1, 32(%rsp)
+	leaq	4(%rax), %rdx
+	movq	%rdx, 80(%rsp)
+	movb	$0, 4(%rbx,%rax)
+	movq	200(%rsp), %rcx
+	movq	136(%rsp), %rax
+	andq	%rcx, %rax
+	leaq	(%rax,%rax,2), %rbx
+	salq	$4, %rbx
+	addq	128(%rsp), %rbx
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L846
+.L678:
+	movq	16(%rbx), %rax
+	movdqu	(%rbx), %xmm2
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 64(%rsp)
+	movq	%rax, 48(%rsp)
+	movq	8(%rbx), %rax
+	movaps	%xmm2, 32(%rsp)
+	cmpq	$23, %rax
+	je	.L847
+	movq	24(%rbx), %rax
+	movq	%rax, 56(%rsp)
+.L681:
+	addq	$1, %rcx
+	movq	%rcx, 200(%rsp)
+	movq	192(%rsp), %rax
+	subq	%rax, %rcx
+	cmpq	144(%rsp), %rcx
+	jnb	.L848
+.L682:
+	movq	32(%rsp), %rdx
+	movq	40(%rsp), %r12
+	movq	88(%rsp), %rbx
+	cmpq	80(%rsp), %rdx
+	je	.L849
+	movq	56(%rsp), %r14
+	cmpq	$23, %r12
+	je	.L691
+.L698:
+	xorl	%r13d, %r13d
+.L692:
+	movq	48(%rsp), %rdi
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	$23, %rbx
+	je	.L700
+	movq	104(%rsp), %rsi
+.L694:
+	movq	96(%rsp), %rdi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L700:
+	testb	%r13b, %r13b
+	je	.L695
+.L697:
+	movq	200(%rsp), %rbx
+	movq	128(%rsp), %rsi
+	cmpq	264(%rsp), %rbx
+	je	.L704
+	.p2align 4,,10
+	.p2align 3
+.L701:
+	movq	136(%rsp), %rax
+	andq	%rbx, %rax
+	leaq	(%rax,%rax,2), %rax
+	salq	$4, %rax
+	addq	%rsi, %rax
+	movq	8(%rax), %rdx
+	cmpq	$23, %rdx
+	je	.L702
+	movq	16(%rax), %rdi
+	movq	24(%rax), %rsi
+	addq	$1, %rdx
+	addq	$1, %rbx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	128(%rsp), %rsi
+	cmpq	264(%rsp), %rbx
+	jne	.L701
+.L704:
+	movq	136(%rsp), %rax
+	movq	152(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	3(%rax,%rax,2), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+	call	*24(%rax)
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L849:
+	.cfi_restore_state
+	cmpq	$23, %rbx
+	je	.L850
+	movq	104(%rsp), %rsi
+	movq	%rsi, %rax
+	cmpq	$23, %r12
+	jne	.L688
+	testq	%rdx, %rdx
+	je	.L689
+.L686:
+	leaq	56(%rsp), %rdi
+	movq	%rax, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L696
+	.p2align 4,,10
+	.p2align 3
+.L691:
+	cmpq	$23, %rbx
+	je	.L695
+	movq	104(%rsp), %rsi
+	xorl	%r13d, %r13d
+	jmp	.L694
+	.p2align 4,,10
+	.p2align 3
+.L702:
+	addq	$1, %rbx
+	cmpq	264(%rsp), %rbx
+	jne	.L701
+	jmp	.L704
+	.p2align 4,,10
+	.p2align 3
+.L834:
+	xorl	%ebx, %ebx
+	movq	%rax, 256(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L612:
+	movq	264(%rsp), %rax
+	movq	192(%rsp), %rdx
+	subq	%rdx, %rax
+	movq	%rdx, 272(%rsp)
+	movq	136(%rsp), %rcx
+	leaq	1(%rcx), %rdx
+	cmpq	%rdx, %rax
+	jne	.L851
+	cmpl	$63, %ebx
+	ja	.L613
+	rep nop
+	addl	$1, %ebx
+	jmp	.L612
+	.p2align 4,,10
+	.p2align 3
+.L613:
+	call	sched_yield@PLT
+	jmp	.L612
+	.p2align 4,,10
+	.p2align 3
+.L851:
+	movq	264(%rsp), %rax
+	jmp	.L611
+	.p2align 4,,10
+	.p2align 3
+.L838:
+	xorl	%ebx, %ebx
+	movq	%rax, 256(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L638:
+	movq	264(%rsp), %rax
+	movq	192(%rsp), %rdx
+	subq	%rdx, %rax
+	movq	%rdx, 272(%rsp)
+	movq	136(%rsp), %rcx
+	leaq	1(%rcx), %rdx
+	cmpq	%rdx, %rax
+	jne	.L852
+	cmpl	$63, %ebx
+	ja	.L639
+	rep nop
+	addl	$1, %ebx
+	jmp	.L638
+	.p2align 4,,10
+	.p2align 3
+.L639:
+	call	sched_yield@PLT
+	jmp	.L638
+	.p2align 4,,10
+	.p2align 3
+.L852:
+	movq	264(%rsp), %rax
+	jmp	.L637
+	.p2align 4,,10
+	.p2align 3
+.L837:
+	movq	264(%rsp), %rax
+	movq	%rax, 256(%rsp)
+	jmp	.L621
+	.p2align 4,,10
+	.p2align 3
+.L848:
+	movq	200(%rsp), %rax
+	movq	%rax, 192(%rsp)
+	jmp	.L682
+	.p2align 4,,10
+	.p2align 3
+.L845:
+	movq	256(%rsp), %rax
+	movq	%rax, 208(%rsp)
+	cmpq	200(%rsp), %rax
+	jne	.L655
+	xorl	%ebx, %ebx
+	movq	%rax, 192(%rsp)
+	movq	208(%rsp), %rax
+	cmpq	%rax, 200(%rsp)
+	jne	.L655
+.L656:
+	movq	256(%rsp), %rax
+	movq	%rax, 208(%rsp)
+	cmpq	200(%rsp), %rax
+	jne	.L655
+	movzbl	280(%rsp), %eax
+	testb	%al, %al
+	jne	.L853
+	cmpl	$63, %ebx
+	ja	.L659
+	rep nop
+	addl	$1, %ebx
+.L660:
+	movq	208(%rsp), %rax
+	cmpq	%rax, 200(%rsp)
+	jne	.L655
+	jmp	.L656
+	.p2align 4,,10
+	.p2align 3
+.L841:
+	movq	264(%rsp), %rax
+	movq	%rax, 256(%rsp)
+	jmp	.L647
+	.p2align 4,,10
+	.p2align 3
+.L842:
+	movq	200(%rsp), %rcx
+	jmp	.L652
+	.p2align 4,,10
+	.p2align 3
+.L744:
+	movq	%r12, %rax
+	jmp	.L598
+	.p2align 4,,10
+	.p2align 3
+.L840:
+	movdqu	104(%rsp), %xmm4
+	movq	120(%rsp), %rax
+	movups	%xmm4, 24(%rbx)
+	movq	%rax, 40(%rbx)
+	jmp	.L646
+	.p2align 4,,10
+	.p2align 3
+.L836:
+	movdqu	104(%rsp), %xmm3
+	movq	120(%rsp), %rax
+	movups	%xmm3, 24(%rbx)
+	movq	%rax, 40(%rbx)
+	jmp	.L620
+	.p2align 4,,10
+	.p2align 3
+.L847:
+	movdqu	24(%rbx), %xmm5
+	movq	40(%rbx), %rax
+	movups	%xmm5, 56(%rsp)
+	movq	%rax, 72(%rsp)
+	jmp	.L681
+	.p2align 4,,10
+	.p2align 3
+.L844:
+	movq	200(%rsp), %rax
+	movq	%rax, 192(%rsp)
+	jmp	.L654
+	.p2align 4,,10
+	.p2align 3
+.L688:
+	movq	56(%rsp), %r14
+	testq	%rdx, %rdx
+	jne	.L718
+	movq	48(%rsp), %rdi
+	movq	%r14, %rsi
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	104(%rsp), %rsi
+.L689:
+	movl	$1, %r13d
+	jmp	.L694
+	.p2align 4,,10
+	.p2align 3
+.L663:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L854
+.L668:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	80(%rsp), %r14
+	pxor	%xmm0, %xmm0
+	movq	$0, 120(%rsp)
+	movq	88(%rsp), %r13
+	movups	%xmm0, 104(%rsp)
+	movq	%r15, 96(%rsp)
+	leaq	4(%r14), %rax
+	movq	$0, 24(%rsp)
+	cmpq	$23, %r13
+	je	.L855
+.L670:
+	movq	24(%rsp), %rcx
+	leaq	(%rcx,%r14), %rdx
+	cmpq	%rdx, %r12
+	jnb	.L856
+	movq	24(%rsp), %rcx
+	subq	%rcx, %r12
+	movq	%r12, 16(%rsp)
+	cmpq	%rax, %r13
+	jnb	.L739
+	leaq	10(%r13,%r13), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, %r12
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+.LEHB33:
+	call	*16(%rax)
+	movq	24(%rsp), %rsi
+	leaq	1(%r14), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L674
+	movq	(%r15), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L674:
+	movq	%rbx, 104(%rsp)
+	movq	%r12, %r13
+	movq	%r12, 88(%rsp)
+.L673:
+	cmpq	$23, %r13
+	jne	.L832
+	leaq	104(%rsp), %rbx
+.L832:
+	movq	16(%rsp), %rax
+	addq	%rbx, %rax
+	jmp	.L664
+.L856:
+	cmpq	%rax, %r13
+	jnb	.L738
+.L713:
+	leaq	10(%r13,%r13), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, %r12
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	24(%rsp), %rsi
+	leaq	1(%r14), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L672
+	movq	(%r15), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L672:
+	movq	%rbx, 104(%rsp)
+	movq	%r12, 88(%rsp)
+.L666:
+	leaq	.LC36(%rip), %rax
+	cmpq	$23, %r12
+	jne	.L664
+	leaq	104(%rsp), %rbx
+	jmp	.L742
+	.p2align 4,,10
+	.p2align 3
+.L846:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	movq	200(%rsp), %rcx
+	testb	%al, %al
+	jne	.L678
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	movq	200(%rsp), %rcx
+	testl	%eax, %eax
+	je	.L678
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movq	200(%rsp), %rcx
+	jmp	.L678
+	.p2align 4,,10
+	.p2align 3
+.L597:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L857
+.L602:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	80(%rsp), %r14
+	pxor	%xmm0, %xmm0
+	movq	$0, 120(%rsp)
+	movq	88(%rsp), %r13
+	movups	%xmm0, 104(%rsp)
+	leaq	.LC36(%rip), %r12
+	movq	%r15, 96(%rsp)
+	leaq	4(%r14), %rax
+	movq	$0, 16(%rsp)
+	cmpq	$23, %r13
+	je	.L858
+.L604:
+	movq	16(%rsp), %rcx
+	leaq	(%rcx,%r14), %rdx
+	cmpq	%rdx, %r12
+	jnb	.L859
+	movq	16(%rsp), %rcx
+	movq	%r12, %rdi
+	subq	%rcx, %rdi
+	movq	%rdi, 8(%rsp)
+	cmpq	%rax, %r13
+	jnb	.L725
+	leaq	10(%r13,%r13), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	16(%rsp), %rsi
+	leaq	1(%r14), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L608
+	movq	(%r15), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L608:
+	movq	24(%rsp), %rax
+	movq	%rbx, 104(%rsp)
+	movq	%rax, 88(%rsp)
+	movq	%rax, %r13
+.L607:
+	cmpq	$23, %r13
+	jne	.L829
+	leaq	104(%rsp), %rbx
+.L829:
+	movq	8(%rsp), %rax
+	addq	%rbx, %rax
+	jmp	.L598
+.L859:
+	cmpq	%rax, %r13
+	jnb	.L724
+.L715:
+	leaq	10(%r13,%r13), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	16(%rsp), %rsi
+	leaq	1(%r14), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L606
+	movq	(%r15), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L606:
+	movq	24(%rsp), %rax
+	movq	%rbx, 104(%rsp)
+	movq	%rax, 88(%rsp)
+.L600:
+	cmpq	$23, 24(%rsp)
+	leaq	.LC36(%rip), %rax
+	jne	.L598
+	leaq	104(%rsp), %rbx
+	jmp	.L823
+	.p2align 4,,10
+	.p2align 3
+.L833:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L860
+.L595:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	jmp	.L593
+	.p2align 4,,10
+	.p2align 3
+.L835:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L617
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L617
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r13, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L617
+	.p2align 4,,10
+	.p2align 3
+.L839:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L643
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L643
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r13, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L643
+	.p2align 4,,10
+	.p2align 3
+.L623:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L861
+.L628:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	80(%rsp), %r13
+	pxor	%xmm0, %xmm0
+	movq	$0, 120(%rsp)
+	movq	88(%rsp), %r14
+	movups	%xmm0, 104(%rsp)
+	leaq	.LC37(%rip), %rsi
+	movq	%r15, 96(%rsp)
+	leaq	14(%r13), %rax
+	movq	$0, 16(%rsp)
+	cmpq	$23, %r14
+	je	.L862
+.L630:
+	movq	16(%rsp), %rcx
+	leaq	(%rcx,%r13), %rdx
+	cmpq	%rdx, %rsi
+	jnb	.L863
+	movq	16(%rsp), %rcx
+	movq	%rsi, %rdi
+	subq	%rcx, %rdi
+	movq	%rdi, 8(%rsp)
+	cmpq	%rax, %r14
+	jnb	.L732
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	16(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L634
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L634:
+	movq	24(%rsp), %rax
+	movq	%rbx, 104(%rsp)
+	movq	%rax, 88(%rsp)
+	movq	%rax, %r14
+.L633:
+	cmpq	$23, %r14
+	jne	.L830
+	leaq	104(%rsp), %rbx
+.L830:
+	movq	8(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L624
+.L863:
+	cmpq	%rax, %r14
+	jnb	.L731
+.L714:
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	16(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L632
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.LEHE33:
+.L632:
+	movq	24(%rsp), %rax
+	movq	%rbx, 104(%rsp)
+	movq	%rax, 88(%rsp)
+.L626:
+	cmpq	$23, 24(%rsp)
+	leaq	.LC37(%rip), %rsi
+	jne	.L624
+	leaq	104(%rsp), %rbx
+	jmp	.L824
+	.p2align 4,,10
+	.p2align 3
+.L850:
+	cmpq	$23, %r12
+	je	.L864
+	movq	56(%rsp), %r14
+	leaq	104(%rsp), %rax
+	testq	%rdx, %rdx
+	je	.L865
+.L718:
+	movq	%rax, %rsi
+	movq	%r14, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L866
+	cmpq	$23, %r12
+	je	.L696
+	movl	$1, %r13d
+	jmp	.L692
+.L866:
+	cmpq	$23, %r12
+	jne	.L698
+	jmp	.L691
+.L860:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L595
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L595
+.L861:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L628
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L628
+.L857:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L602
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L602
+.L854:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L668
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L668
+.L865:
+	movq	48(%rsp), %rdi
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L697
+.L696:
+	cmpq	$23, %rbx
+	je	.L697
+	movq	104(%rsp), %rsi
+	jmp	.L689
+.L659:
+	call	sched_yield@PLT
+	jmp	.L660
+.L864:
+	testq	%rdx, %rdx
+	je	.L697
+	leaq	104(%rsp), %rax
+	jmp	.L686
+.L731:
+	movq	%r14, 24(%rsp)
+	xorl	%ebx, %ebx
+	jmp	.L626
+.L738:
+	xorl	%ebx, %ebx
+	movq	%r13, %r12
+	jmp	.L666
+.L724:
+	movq	%r13, 24(%rsp)
+	xorl	%ebx, %ebx
+	jmp	.L600
+.L853:
+	movq	208(%rsp), %rax
+	cmpq	%rax, 200(%rsp)
+	jne	.L655
+	movq	256(%rsp), %rax
+	movq	%rax, 208(%rsp)
+	cmpq	200(%rsp), %rax
+	jne	.L655
+	jmp	.L822
+	.p2align 4,,10
+	.p2align 3
+.L725:
+	xorl	%ebx, %ebx
+	jmp	.L607
+.L732:
+	xorl	%ebx, %ebx
+	jmp	.L633
+.L862:
+	leaq	104(%rsp), %rbx
+	cmpq	%rbx, %rsi
+	jnb	.L867
+	cmpq	$23, %rax
+	jbe	.L624
+	movq	%rbx, 16(%rsp)
+	jmp	.L714
+.L858:
+	leaq	104(%rsp), %rbx
+	cmpq	%rbx, %r12
+	jnb	.L868
+	cmpq	$23, %rax
+	jbe	.L744
+	movq	%rbx, 16(%rsp)
+	jmp	.L715
+.L867:
+	movq	%rbx, 16(%rsp)
+	jmp	.L630
+.L868:
+	movq	%rbx, 16(%rsp)
+	jmp	.L604
+	.p2align 4,,10
+	.p2align 3
+.L739:
+	xorl	%ebx, %ebx
+	jmp	.L673
+.L855:
+	leaq	104(%rsp), %rbx
+	cmpq	%rbx, %r12
+	jnb	.L869
+	cmpq	$23, %rax
+	jbe	.L742
+	movq	%rbx, 24(%rsp)
+	jmp	.L713
+.L869:
+	movq	%rbx, 24(%rsp)
+	jmp	.L670
+.L820:
+	jmp	.L821
+	.section	.gcc_except_table
+.LLSDA6810:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6810-.LLSDACSB6810
+.LLSDACSB6810:
+	.uleb128 .LEHB32-.LFB6810
+	.uleb128 .LEHE32-.LEHB32
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB33-.LFB6810
+	.uleb128 .LEHE33-.LEHB33
+	.uleb128 .L820-.LFB6810
+	.uleb128 0
+.LLSDACSE6810:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6810
+	.type	_Z28test_spsc_destroys_remainingv.cold, @function
+_Z28test_spsc_destroys_remainingv.cold:
+.LFSB6810:
+.L695:
+	.cfi_def_cfa 6, 16
+	.cfi_offset 3, -56
+	.cfi_offset 6, -16
+	.cfi_offset 12, -48
+	.cfi_offset 13, -40
+	.cfi_offset 14, -32
+	.cfi_offset 15, -24
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC40(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB34:
+	call	__cxa_throw@PLT
+.LEHE34:
+.L745:
+.L747:
+.L746:
+.L821:
+	movq	%rax, %rbx
+	movq	200(%rsp), %r12
+	movq	136(%rsp), %rax
+	movq	128(%rsp), %rsi
+.L710:
+	cmpq	264(%rsp), %r12
+	je	.L870
+	movq	%r12, %rdx
+	andq	%rax, %rdx
+	imulq	$48, %rdx, %rdx
+	addq	%rsi, %rdx
+	movq	8(%rdx), %rcx
+	cmpq	$23, %rcx
+	je	.L711
+	movq	16(%rdx), %rdi
+	leaq	1(%rcx), %rax
+	movq	24(%rdx), %rsi
+	movl	$1, %ecx
+	movq	%rax, %rdx
+	movq	(%rdi), %r8
+	call	*24(%r8)
+	movq	136(%rsp), %rax
+	movq	128(%rsp), %rsi
+.L711:
+	addq	$1, %r12
+	jmp	.L710
+.L822:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC39(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB35:
+	call	__cxa_throw@PLT
+.LEHE35:
+.L870:
+	movq	152(%rsp), %rdi
+	addq	$1, %rax
+	movl	$8, %ecx
+	imulq	$48, %rax, %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	%rbx, %rdi
+.LEHB36:
+	call	_Unwind_Resume@PLT
+.LEHE36:
+	.cfi_endproc
+.LFE6810:
+	.section	.gcc_except_table
+.LLSDAC6810:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6810-.LLSDACSBC6810
+.LLSDACSBC6810:
+	.uleb128 .LEHB34-.LCOLDB43
+	.uleb128 .LEHE34-.LEHB34
+	.uleb128 .L746-.LCOLDB43
+	.uleb128 0
+	.uleb128 .LEHB35-.LCOLDB43
+	.uleb128 .LEHE35-.LEHB35
+	.uleb128 .L746-.LCOLDB43
+	.uleb128 0
+	.uleb128 .LEHB36-.LCOLDB43
+	.uleb128 .LEHE36-.LEHB36
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6810:
+	.section	.text.unlikely
+	.text
+	.size	_Z28test_spsc_destroys_remainingv, .-_Z28test_spsc_destroys_remainingv
+	.section	.text.unlikely
+	.size	_Z28test_spsc_destroys_remainingv.cold, .-_Z28test_spsc_destroys_remainingv.cold
+.LCOLDE43:
+	.text
+.LHOTE43:
+	.section	.rodata._ZN1n4test10test_suite7run_allEv.str1.1,"aMS",@progbits,1
+.LC44:
+	.string	"\nSUITE [%s] "
+.LC46:
+	.string	"%s"
+.LC47:
+	.string	"\nTEST [%s] "
+.LC48:
+	.string	" - Result : \033[1;32mPASSED\033[0m"
+.LC49:
+	.string	"\033[1;31merror : %s\033[0m\n"
+.LC50:
+	.string	" - Result : \033[1;31mFAILED\033[0m"
+.LC51:
+	.string	" - Passed : \033[1;32m%d\033[0m\n"
+.LC52:
+	.string	" - Failed : \033[1;31m%d\033[0m\n"
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4test10test_suite7run_allEv
+	.type	_ZN1n4test10test_suite7run_allEv, @function
+_ZN1n4test10test_suite7run_allEv:
+.LFB6806:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6806
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	leaq	.LC44(%rip), %rdx
+	movl	$79, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	16(%rdi), %rcx
+	leaq	16(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L872
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L873
+	testb	$4, %cl
+	jne	.L926
+	testl	%ecx, %ecx
+	je	.L872
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L927
+	.p2align 4,,10
+	.p2align 3
+.L872:
+	movzwl	.LC45(%rip), %r15d
+	movq	%rbx, %rsi
+	leaq	.LC46(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+.LEHB37:
+	call	printf@PLT
+	movl	8(%r12), %esi
+	testl	%esi, %esi
+	jle	.L893
+	movl	$0, 12(%rsp)
+	xorl	%ebp, %ebp
+	xorl	%r14d, %r14d
+	jmp	.L887
+	.p2align 4,,10
+	.p2align 3
+.L930:
+	testb	$4, %dl
+	jne	.L928
+	testl	%edx, %edx
+	je	.L878
+	movb	$42, (%rax)
+	testb	$2, %dl
+	jne	.L929
+	.p2align 4,,10
+	.p2align 3
+.L878:
+	movq	%rbx, %rsi
+	leaq	.LC46(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+.LEHE37:
+	movq	(%r12), %rax
+.LEHB38:
+	call	*8(%rax,%r13)
+.LEHE38:
+	leaq	.LC48(%rip), %rdi
+	addl	$1, %r14d
+.LEHB39:
+	call	puts@PLT
+.L883:
+	addq	$1, %rbp
+	cmpl	%ebp, 8(%r12)
+	jle	.L877
+.L887:
+	movq	(%r12), %rax
+	movq	%rbp, %r13
+	movq	%rbx, %rdi
+	movl	$79, %esi
+	salq	$4, %r13
+	leaq	.LC47(%rip), %rdx
+	movq	(%rax,%r13), %rcx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L878
+	movl	$79, %edx
+	subl	%eax, %edx
+	addq	%rbx, %rax
+	cmpl	$8, %edx
+	jb	.L930
+	movabsq	$3038287259199220266, %rsi
+	leaq	8(%rax), %rdi
+	movl	%edx, %ecx
+	andq	$-8, %rdi
+	movq	%rsi, (%rax)
+	movq	%rsi, -8(%rax,%rcx)
+	subq	%rdi, %rax
+	leal	(%rdx,%rax), %ecx
+	movq	%rsi, %rax
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L878
+.L893:
+	movl	$0, 12(%rsp)
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L877:
+	movabsq	$5917806138674729738, %rax
+	movq	%rbx, %rdi
+	movq	%rax, 16(%rsp)
+	movabsq	$9095440486453792, %rax
+	movq	%rax, 22(%rsp)
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L888
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L889
+	testb	$4, %cl
+	jne	.L931
+	testl	%ecx, %ecx
+	je	.L888
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L932
+.L888:
+	movq	%rbx, %rsi
+	leaq	.LC46(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+	movl	%r14d, %esi
+	leaq	.LC51(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	12(%rsp), %esi
+	leaq	.LC52(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	$10, %edi
+	call	putchar@PLT
+.LEHE39:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L889:
+	.cfi_restore_state
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L888
+.L873:
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L872
+.L928:
+	movl	$707406378, (%rax)
+	movl	$707406378, -4(%rax,%rdx)
+	jmp	.L878
+.L929:
+	movl	$10794, %ecx
+	movw	%cx, -2(%rax,%rdx)
+	jmp	.L878
+.L927:
+	movl	$10794, %edi
+	movw	%di, -2(%rdx,%rcx)
+	jmp	.L872
+.L932:
+	movl	$10794, %eax
+	movw	%ax, -2(%rdx,%rcx)
+	jmp	.L888
+.L926:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L872
+.L931:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L888
+.L894:
+	movq	%rax, %rdi
+	movq	%rdx, %rax
+.L884:
+	subq	$1, %rax
+	jne	.L925
+	call	__cxa_begin_catch@PLT
+	leaq	.LC49(%rip), %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+.LEHB40:
+	call	printf@PLT
+.LEHE40:
+	call	__cxa_end_catch@PLT
+	leaq	.LC50(%rip), %rdi
+	addl	$1, 12(%rsp)
+.LEHB41:
+	call	puts@PLT
+	jmp	.L883
+.L886:
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+.L925:
+	call	_Unwind_Resume@PLT
+.LEHE41:
+.L895:
+	movq	%rax, %rbx
+	jmp	.L886
+	.cfi_endproc
+.LFE6806:
+	.section	.gcc_except_table
+	.align 4
+.LLSDA6806:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT6806-.LLSDATTD6806
+.LLSDATTD6806:
+	.byte	0x1
+	.uleb128 .LLSDACSE6806-.LLSDACSB6806
+.LLSDACSB6806:
+	.uleb128 .LEHB37-.LFB6806
+	.uleb128 .LEHE37-.LEHB37
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB38-.LFB6806
+	.uleb128 .LEHE38-.LEHB38
+	.uleb128 .L894-.LFB6806
+	.uleb128 0x1
+	.uleb128 .LEHB39-.LFB6806
+	.uleb128 .LEHE39-.LEHB39
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB40-.LFB6806
+	.uleb128 .LEHE40-.LEHB40
+	.uleb128 .L895-.LFB6806
+	.uleb128 0
+	.uleb128 .LEHB41-.LFB6806
+	.uleb128 .LEHE41-.LEHB41
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6806:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	DW.ref._ZTIPKc-.
+.LLSDATT6806:
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.size	_ZN1n4test10test_suite7run_allEv, .-_ZN1n4test10test_suite7run_allEv
+	.section	.rodata.str1.1
+.LC53:
+	.string	"n::channel tests"
+.LC54:
+	.string	"test_spsc_single_thread"
+.LC55:
+	.string	"test_spsc_destroys_remaining"
+.LC56:
+	.string	"test_spsc_copy_across_threads"
+.LC57:
+	.string	"test_spsc_batched_publish"
+.LC58:
+	.string	"test_spsc_next_chunk"
+.LC59:
+	.string	"test_mpmc_single_thread"
+.LC60:
+	.string	"test_mpmc_many_threads"
+	.section	.text.unlikely
+.LCOLDB62:
+	.section	.text.startup,"ax",@progbits
+.LHOTB62:
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB6834:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6834
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$1600, %edi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 64
+.LEHB42:
+	call	_Znam@PLT
+.LEHE42:
+	movq	%rax, %rbx
+	leaq	1600(%rax), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L934:
+	movq	$0, (%rax)
+	addq	$16, %rax
+	movq	$0, -8(%rax)
+	cmpq	%rax, %rdx
+	jne	.L934
+	leaq	.LC53(%rip), %rax
+	movq	%rsp, %rdi
+	movq	%rbx, (%rsp)
+	movq	%rax, 16(%rsp)
+	leaq	.LC54(%rip), %rax
+	movq	%rax, (%rbx)
+	leaq	_Z23test_spsc_single_threadv(%rip), %rax
+	movq	%rax, 8(%rbx)
+	leaq	.LC55(%rip), %rax
+	movq	%rax, 16(%rbx)
+	leaq	_Z28test_spsc_destroys_remainingv(%rip), %rax
+	movq	%rax, 24(%rbx)
+	leaq	.LC56(%rip), %rax
+	movq	%rax, 32(%rbx)
+	leaq	_Z29test_spsc_copy_across_threadsv(%rip), %rax
+	movq	%rax, 40(%rbx)
+	leaq	.LC57(%rip), %rax
+	movq	%rax, 48(%rbx)
+	leaq	_Z25test_spsc_batched_publishv(%rip), %rax
+	movq	%rax, 56(%rbx)
+	leaq	.LC58(%rip), %rax
+	movq	%rax, 64(%rbx)
+	leaq	_Z20test_spsc_next_chunkv(%rip), %rax
+	movq	%rax, 72(%rbx)
+	leaq	.LC59(%rip), %rax
+	movq	%rax, 80(%rbx)
+	leaq	_Z23test_mpmc_single_threadv(%rip), %rax
+	movq	%rax, 88(%rbx)
+	leaq	.LC60(%rip), %rax
+	movq	%rax, 96(%rbx)
+	leaq	_Z22test_mpmc_many_threadsv(%rip), %rax
+	movq	%rax, 104(%rbx)
+	movq	.LC61(%rip), %rax
+	movq	%rax, 8(%rsp)
+.LEHB43:
+	call	_ZN1n4test10test_suite7run_allEv
+.LEHE43:
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L936:
+	.cfi_restore_state
+	movq	%rax, %rbp
+	jmp	.L935
+	.section	.gcc_except_table
+.LLSDA6834:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6834-.LLSDACSB6834
+.LLSDACSB6834:
+	.uleb128 .LEHB42-.LFB6834
+	.uleb128 .LEHE42-.LEHB42
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB43-.LFB6834
+	.uleb128 .LEHE43-.LEHB43
+	.uleb128 .L936-.LFB6834
+	.uleb128 0
+.LLSDACSE6834:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6834
+	.type	main.cold, @function
+main.cold:
+.LFSB6834:
+.L935:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	movq	%rbp, %rdi
+.LEHB44:
+	call	_Unwind_Resume@PLT
+.LEHE44:
+	.cfi_endproc
+.LFE6834:
+	.section	.gcc_except_table
+.LLSDAC6834:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6834-.LLSDACSBC6834
+.LLSDACSBC6834:
+	.uleb128 .LEHB44-.LCOLDB62
+	.uleb128 .LEHE44-.LEHB44
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6834:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	main, .-main
+	.section	.text.unlikely
+	.size	main.cold, .-main.cold
+.LCOLDE62:
+	.section	.text.startup
+.LHOTE62:
+	.weak	_ZTSN1n15memory_resourceE
+	.section	.rodata._ZTSN1n15memory_resourceE,"aG",@progbits,_ZTSN1n15memory_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n15memory_resourceE, @object
+	.size	_ZTSN1n15memory_resourceE, 22
+_ZTSN1n15memory_resourceE:
+	.string	"N1n15memory_resourceE"
+	.weak	_ZTIN1n15memory_resourceE
+	.section	.data.rel.ro._ZTIN1n15memory_resourceE,"awG",@progbits,_ZTIN1n15memory_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n15memory_resourceE, @object
+	.size	_ZTIN1n15memory_resourceE, 16
+_ZTIN1n15memory_resourceE:
+	.quad	_ZTVN10__cxxabiv117__class_type_infoE+16
+	.quad	_ZTSN1n15memory_resourceE
+	.weak	_ZTSN1n13heap_resourceE
+	.section	.rodata._ZTSN1n13heap_resourceE,"aG",@progbits,_ZTSN1n13heap_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n13heap_resourceE, @object
+	.size	_ZTSN1n13heap_resourceE, 20
+_ZTSN1n13heap_resourceE:
+	.string	"N1n13heap_resourceE"
+	.weak	_ZTIN1n13heap_resourceE
+	.section	.data.rel.ro._ZTIN1n13heap_resourceE,"awG",@progbits,_ZTIN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n13heap_resourceE, @object
+	.size	_ZTIN1n13heap_resourceE, 24
+_ZTIN1n13heap_resourceE:
+	.quad	_ZTVN10__cxxabiv120__si_class_type_infoE+16
+	.quad	_ZTSN1n13heap_resourceE
+	.quad	_ZTIN1n15memory_resourceE
+	.weak	_ZTVN1n13heap_resourceE
+	.section	.data.rel.ro.local._ZTVN1n13heap_resourceE,"awG",@progbits,_ZTVN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTVN1n13heap_resourceE, @object
+	.size	_ZTVN1n13heap_resourceE, 48
+_ZTVN1n13heap_resourceE:
+	.quad	0
+	.quad	_ZTIN1n13heap_resourceE
+	.quad	_ZN1n13heap_resourceD1Ev
+	.quad	_ZN1n13heap_resourceD0Ev
+	.quad	_ZN1n13heap_resource8allocateEmm
+	.quad	_ZN1n13heap_resource10deallocateEPvmm
+	.weak	_ZN1n18__current_resourceE
+	.section	.tbss._ZN1n18__current_resourceE,"awTG",@nobits,_ZN1n18__current_resourceE,comdat
+	.align 8
+	.type	_ZN1n18__current_resourceE, @gnu_unique_object
+	.size	_ZN1n18__current_resourceE, 8
+_ZN1n18__current_resourceE:
+	.zero	8
+	.weak	_ZGVZN1n4heapEvE3res
+	.section	.bss._ZGVZN1n4heapEvE3res,"awG",@nobits,_ZGVZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZGVZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZGVZN1n4heapEvE3res, 8
+_ZGVZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE3res
+	.section	.bss._ZZN1n4heapEvE3res,"awG",@nobits,_ZZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZZN1n4heapEvE3res, 8
+_ZZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE7storage
+	.section	.bss._ZZN1n4heapEvE7storage,"awG",@nobits,_ZZN1n4heapEvE7storage,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE7storage, @gnu_unique_object
+	.size	_ZZN1n4heapEvE7storage, 8
+_ZZN1n4heapEvE7storage:
+	.zero	8
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC3:
+	.quad	63
+	.quad	16
+	.align 16
+.LC15:
+	.quad	255
+	.quad	32
+	.align 16
+.LC19:
+	.quad	3
+	.quad	1
+	.align 16
+.LC28:
+	.quad	7
+	.quad	1
+	.align 16
+.LC38:
+	.quad	0
+	.quad	23
+	.section	.rodata.cst2,"aM",@progbits,2
+	.align 2
+.LC45:
+	.byte	10
+	.byte	0
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC61:
+	.long	7
+	.long	100
+	.hidden	DW.ref._ZTIPKc
+	.weak	DW.ref._ZTIPKc
+	.section	.data.rel.local.DW.ref._ZTIPKc,"awG",@progbits,DW.ref._ZTIPKc,comdat
+	.align 8
+	.type	DW.ref._ZTIPKc, @object
+	.size	DW.ref._ZTIPKc, 8
+DW.ref._ZTIPKc:
+	.quad	_ZTIPKc
+	.hidden	DW.ref.__gxx_personality_v0
+	.weak	DW.ref.__gxx_personality_v0
+	.section	.data.rel.local.DW.ref.__gxx_personality_v0,"awG",@progbits,DW.ref.__gxx_personality_v0,comdat
+	.align 8
+	.type	DW.ref.__gxx_personality_v0, @object
+	.size	DW.ref.__gxx_personality_v0, 8
+DW.ref.__gxx_personality_v0:
+	.quad	__gxx_personality_v0
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
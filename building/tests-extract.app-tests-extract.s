@@ -0,0 +1,5636 @@
+	.file	"tests-extract.cpp"
+	.text
+	.section	.text._ZN1n13heap_resourceD2Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD2Ev
+	.type	_ZN1n13heap_resourceD2Ev, @function
+_ZN1n13heap_resourceD2Ev:
+.LFB6903:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE6903:
+	.size	_ZN1n13heap_resourceD2Ev, .-_ZN1n13heap_resourceD2Ev
+	.weak	_ZN1n13heap_resourceD1Ev
+	.set	_ZN1n13heap_resourceD1Ev,_ZN1n13heap_resourceD2Ev
+	.section	.text._ZN1n13heap_resource10deallocateEPvmm,"axG",@progbits,_ZN1n13heap_resource10deallocateEPvmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource10deallocateEPvmm
+	.type	_ZN1n13heap_resource10deallocateEPvmm, @function
+_ZN1n13heap_resource10deallocateEPvmm:
+.LFB6517:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rcx
+	jbe	.L4
+	movq	%rcx, %rsi
+	jmp	_ZdlPvSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	jmp	_ZdlPv@PLT
+	.cfi_endproc
+.LFE6517:
+	.size	_ZN1n13heap_resource10deallocateEPvmm, .-_ZN1n13heap_resource10deallocateEPvmm
+	.section	.text._ZN1n13heap_resource8allocateEmm,"axG",@progbits,_ZN1n13heap_resource8allocateEmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource8allocateEmm
+	.type	_ZN1n13heap_resource8allocateEmm, @function
+_ZN1n13heap_resource8allocateEmm:
+.LFB6516:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rdx
+	jbe	.L6
+	movq	%rdx, %rsi
+	jmp	_ZnwmSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	jmp	_Znwm@PLT
+	.cfi_endproc
+.LFE6516:
+	.size	_ZN1n13heap_resource8allocateEmm, .-_ZN1n13heap_resource8allocateEmm
+	.section	.text._ZN1n13heap_resourceD0Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD0Ev
+	.type	_ZN1n13heap_resourceD0Ev, @function
+_ZN1n13heap_resourceD0Ev:
+.LFB6905:
+	.cfi_startproc
+	movl	$8, %esi
+	jmp	_ZdlPvm@PLT
+	.cfi_endproc
+.LFE6905:
+	.size	_ZN1n13heap_resourceD0Ev, .-_ZN1n13heap_resourceD0Ev
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"input"
+.LC2:
+	.string	"expected true : mc.has()"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC3:
+	.string	"expected equal : expected value : mc.get(), actual value : 'i'"
+	.section	.text.unlikely,"ax",@progbits
+.LCOLDB5:
+	.text
+.LHOTB5:
+	.p2align 4
+	.globl	_Z17test_extract_charv
+	.type	_Z17test_extract_charv, @function
+_Z17test_extract_charv:
+.LFB6755:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6755
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	movdqa	.LC1(%rip), %xmm0
+	movaps	%xmm0, 16(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L9
+	pxor	%xmm0, %xmm0
+	leaq	40(%rsp), %r13
+	movq	%rax, 32(%rsp)
+	xorl	%r12d, %r12d
+	leaq	.LC0(%rip), %rbp
+	movups	%xmm0, 40(%rsp)
+	movq	$0, 56(%rsp)
+	cmpq	%r13, %rbp
+	jb	.L35
+.L49:
+	leaq	.LC0(%rip), %rsi
+.L51:
+	movq	%r13, %rbx
+.L10:
+	movl	$5, %edx
+	leaq	(%rbx,%r12), %rdi
+	call	memmove@PLT
+	movq	16(%rsp), %rax
+	leaq	5(%rax), %rdx
+	movq	%rdx, 16(%rsp)
+	movb	$0, 5(%rbx,%rax)
+	movq	24(%rsp), %rdx
+	movq	16(%rsp), %rax
+	cmpq	$23, %rdx
+	je	.L52
+	movq	32(%rsp), %rdi
+	movq	40(%rsp), %rsi
+	addq	$1, %rdx
+	movq	(%rdi), %rcx
+	movq	24(%rcx), %r8
+	testq	%rax, %rax
+	je	.L26
+	movzbl	(%rsi), %ebx
+	movl	$1, %ecx
+	call	*%r8
+.L25:
+	cmpb	$105, %bl
+	jne	.L48
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L52:
+	.cfi_restore_state
+	testq	%rax, %rax
+	je	.L24
+	movzbl	40(%rsp), %ebx
+	jmp	.L25
+	.p2align 4,,10
+	.p2align 3
+.L35:
+	movq	%rbp, %rsi
+	jmp	.L51
+	.p2align 4,,10
+	.p2align 3
+.L9:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L53
+.L14:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	16(%rsp), %r12
+	pxor	%xmm0, %xmm0
+	xorl	%r13d, %r13d
+	movq	24(%rsp), %r14
+	movups	%xmm0, 40(%rsp)
+	leaq	.LC0(%rip), %rbp
+	movq	%r15, 32(%rsp)
+	leaq	5(%r12), %rax
+	movq	$0, 56(%rsp)
+	cmpq	$23, %r14
+	je	.L54
+.L16:
+	leaq	0(%r13,%r12), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L55
+	subq	%r13, %rbp
+	movq	%rbp, 8(%rsp)
+	cmpq	%rax, %r14
+	jnb	.L33
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %rbp
+	movq	(%r15), %rax
+.LEHB0:
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L20
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L20:
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, %r14
+	movq	%rbp, 24(%rsp)
+.L19:
+	cmpq	$23, %r14
+	je	.L21
+	movq	8(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L10
+.L55:
+	cmpq	%rax, %r14
+	jnb	.L32
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %rbp
+	movq	(%r15), %rax
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L18
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L18:
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, 24(%rsp)
+.L12:
+	leaq	.LC0(%rip), %rsi
+	cmpq	$23, %rbp
+	jne	.L10
+	leaq	40(%rsp), %r13
+	jmp	.L49
+.L53:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L14
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L14
+.L32:
+	xorl	%ebx, %ebx
+	movq	%r14, %rbp
+	jmp	.L12
+.L33:
+	xorl	%ebx, %ebx
+	jmp	.L19
+.L21:
+	movq	8(%rsp), %rsi
+	leaq	40(%rsp), %r13
+	addq	%r13, %rsi
+	jmp	.L51
+.L54:
+	leaq	40(%rsp), %r13
+	cmpq	%r13, %rbp
+	jnb	.L16
+	cmpq	$23, %rax
+	jbe	.L35
+	movl	$56, %edx
+	movq	%r15, %rdi
+	cmpq	%rdx, %rax
+	cmovnb	%rax, %rdx
+	movq	(%r15), %rax
+	leaq	1(%rdx), %rsi
+	movq	%rdx, %r14
+	movl	$1, %edx
+	call	*16(%rax)
+.LEHE0:
+	movq	%r13, %rsi
+	leaq	1(%r12), %rdx
+	movq	%rax, %rbx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, %rsi
+	movq	%r14, 24(%rsp)
+	jmp	.L10
+	.globl	__gxx_personality_v0
+	.section	.gcc_except_table,"a",@progbits
+.LLSDA6755:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6755-.LLSDACSB6755
+.LLSDACSB6755:
+	.uleb128 .LEHB0-.LFB6755
+	.uleb128 .LEHE0-.LEHB0
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6755:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6755
+	.type	_Z17test_extract_charv.cold, @function
+_Z17test_extract_charv.cold:
+.LFSB6755:
+.L26:
+	.cfi_def_cfa_offset 128
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$1, %ecx
+	call	*%r8
+.L24:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC2(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB1:
+	call	__cxa_throw@PLT
+.L48:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC3(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE1:
+	.cfi_endproc
+.LFE6755:
+	.section	.gcc_except_table
+.LLSDAC6755:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6755-.LLSDACSBC6755
+.LLSDACSBC6755:
+	.uleb128 .LEHB1-.LCOLDB5
+	.uleb128 .LEHE1-.LEHB1
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6755:
+	.section	.text.unlikely
+	.text
+	.size	_Z17test_extract_charv, .-_Z17test_extract_charv
+	.section	.text.unlikely
+	.size	_Z17test_extract_charv.cold, .-_Z17test_extract_charv.cold
+.LCOLDE5:
+	.text
+.LHOTE5:
+	.section	.rodata.str1.1
+.LC6:
+	.string	"123"
+.LC7:
+	.string	"expected true : mui.has()"
+	.section	.rodata.str1.8
+	.align 8
+.LC8:
+	.string	"expected equal : expected value : mui.get(), actual value : 123u"
+	.section	.text.unlikely
+.LCOLDB9:
+	.text
+.LHOTB9:
+	.p2align 4
+	.globl	_Z30test_extract_unsigned_integralv
+	.type	_Z30test_extract_unsigned_integralv, @function
+_Z30test_extract_unsigned_integralv:
+.LFB6767:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6767
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	movdqa	.LC1(%rip), %xmm0
+	movaps	%xmm0, 16(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L57
+	pxor	%xmm0, %xmm0
+	leaq	40(%rsp), %r14
+	movq	%rax, 32(%rsp)
+	xorl	%r13d, %r13d
+	leaq	.LC6(%rip), %r12
+	movups	%xmm0, 40(%rsp)
+	movq	$0, 56(%rsp)
+	cmpq	%r14, %r12
+	jb	.L92
+.L113:
+	leaq	.LC6(%rip), %rsi
+.L116:
+	movq	%r14, %rbp
+.L58:
+	movl	$3, %edx
+	leaq	0(%rbp,%r13), %rdi
+	call	memmove@PLT
+	movq	16(%rsp), %rax
+	leaq	3(%rax), %rdx
+	movq	%rdx, 16(%rsp)
+	movb	$0, 3(%rbp,%rax)
+	movq	24(%rsp), %rdx
+	movq	16(%rsp), %rax
+	cmpq	$23, %rdx
+	je	.L117
+	movq	40(%rsp), %rsi
+	movq	%rsi, %rdi
+	testq	%rax, %rax
+	je	.L74
+	movzbl	(%rsi), %ecx
+	leal	-48(%rcx), %ebx
+	cmpb	$9, %bl
+	ja	.L74
+	movsbl	%bl, %ebx
+	cmpq	$1, %rax
+	je	.L84
+.L82:
+	leaq	1(%rdi), %rcx
+	addq	%rax, %rdi
+	jmp	.L77
+	.p2align 4,,10
+	.p2align 3
+.L118:
+	leal	(%rbx,%rbx,4), %esi
+	addq	$1, %rcx
+	leal	-48(%rax,%rsi,2), %ebx
+	cmpq	%rdi, %rcx
+	je	.L76
+.L77:
+	movsbl	(%rcx), %eax
+	leal	-48(%rax), %esi
+	cmpb	$9, %sil
+	jbe	.L118
+.L76:
+	cmpq	$23, %rdx
+	jne	.L119
+.L78:
+	cmpl	$123, %ebx
+	jne	.L81
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L117:
+	.cfi_restore_state
+	testq	%rax, %rax
+	je	.L72
+	movzbl	40(%rsp), %ecx
+	leal	-48(%rcx), %ebx
+	cmpb	$9, %bl
+	ja	.L72
+	movsbl	%bl, %ebx
+	leaq	40(%rsp), %rdi
+	cmpq	$1, %rax
+	jne	.L82
+	jmp	.L81
+	.p2align 4,,10
+	.p2align 3
+.L92:
+	movq	%r12, %rsi
+	jmp	.L116
+	.p2align 4,,10
+	.p2align 3
+.L57:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L120
+.L62:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	16(%rsp), %r13
+	pxor	%xmm0, %xmm0
+	movq	$0, 56(%rsp)
+	movq	24(%rsp), %rbx
+	movups	%xmm0, 40(%rsp)
+	leaq	.LC6(%rip), %r12
+	movq	%r15, 32(%rsp)
+	leaq	3(%r13), %rax
+	movq	$0, 8(%rsp)
+	cmpq	$23, %rbx
+	je	.L121
+.L64:
+	movq	8(%rsp), %r14
+	leaq	(%r14,%r13), %rdx
+	cmpq	%rdx, %r12
+	jnb	.L122
+	movq	8(%rsp), %rcx
+	subq	%rcx, %r12
+	cmpq	%rax, %rbx
+	jnb	.L90
+	leaq	10(%rbx,%rbx), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %r14
+	movq	(%r15), %rax
+.LEHB2:
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	cmpq	$23, %rbx
+	je	.L68
+	movq	(%r15), %rax
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L68:
+	movq	%rbp, 40(%rsp)
+	movq	%r14, %rbx
+	movq	%r14, 24(%rsp)
+.L67:
+	leaq	0(%rbp,%r12), %rsi
+	cmpq	$23, %rbx
+	jne	.L58
+	leaq	40(%rsp), %r14
+	leaq	(%r14,%r12), %rsi
+	jmp	.L116
+.L122:
+	cmpq	%rax, %rbx
+	jnb	.L89
+	leaq	10(%rbx,%rbx), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %r12
+	movq	(%r15), %rax
+	call	*16(%rax)
+	leaq	1(%r13), %rdx
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	cmpq	$23, %rbx
+	je	.L66
+	movq	(%r15), %rax
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.LEHE2:
+.L66:
+	movq	%rbp, 40(%rsp)
+	movq	%r12, 24(%rsp)
+.L60:
+	leaq	.LC6(%rip), %rsi
+	cmpq	$23, %r12
+	jne	.L58
+	leaq	40(%rsp), %r14
+	jmp	.L113
+.L120:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L62
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L62
+.L89:
+	xorl	%ebp, %ebp
+	movq	%rbx, %r12
+	jmp	.L60
+.L119:
+	movq	40(%rsp), %rsi
+.L84:
+	movq	32(%rsp), %rdi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L78
+	.p2align 4,,10
+	.p2align 3
+.L90:
+	xorl	%ebp, %ebp
+	jmp	.L67
+.L121:
+	leaq	40(%rsp), %r14
+	cmpq	%r14, %r12
+	jnb	.L123
+	cmpq	$23, %rax
+	jbe	.L92
+	movl	$56, %edx
+	movq	%r15, %rdi
+	cmpq	%rdx, %rax
+	movq	%rdx, %rbx
+	movl	$1, %edx
+	cmovnb	%rax, %rbx
+	movq	(%r15), %rax
+	leaq	1(%rbx), %rsi
+.LEHB3:
+	call	*16(%rax)
+.LEHE3:
+	movq	%r14, %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rbp
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	%rbp, 40(%rsp)
+	movq	%r12, %rsi
+	movq	%rbx, 24(%rsp)
+	jmp	.L58
+.L123:
+	movq	%r14, 8(%rsp)
+	jmp	.L64
+	.section	.gcc_except_table
+.LLSDA6767:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6767-.LLSDACSB6767
+.LLSDACSB6767:
+	.uleb128 .LEHB2-.LFB6767
+	.uleb128 .LEHE2-.LEHB2
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB3-.LFB6767
+	.uleb128 .LEHE3-.LEHB3
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6767:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6767
+	.type	_Z30test_extract_unsigned_integralv.cold, @function
+_Z30test_extract_unsigned_integralv.cold:
+.LFSB6767:
+.L81:
+	.cfi_def_cfa_offset 128
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC8(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB4:
+	call	__cxa_throw@PLT
+.LEHE4:
+.L74:
+	movq	32(%rsp), %rdi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L72:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC7(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB5:
+	call	__cxa_throw@PLT
+.LEHE5:
+	.cfi_endproc
+.LFE6767:
+	.section	.gcc_except_table
+.LLSDAC6767:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6767-.LLSDACSBC6767
+.LLSDACSBC6767:
+	.uleb128 .LEHB4-.LCOLDB9
+	.uleb128 .LEHE4-.LEHB4
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB5-.LCOLDB9
+	.uleb128 .LEHE5-.LEHB5
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6767:
+	.section	.text.unlikely
+	.text
+	.size	_Z30test_extract_unsigned_integralv, .-_Z30test_extract_unsigned_integralv
+	.section	.text.unlikely
+	.size	_Z30test_extract_unsigned_integralv.cold, .-_Z30test_extract_unsigned_integralv.cold
+.LCOLDE9:
+	.text
+.LHOTE9:
+	.section	.rodata.str1.1
+.LC10:
+	.string	"j'ai 12 ans"
+.LC11:
+	.string	"j'ai $ ans"
+.LC12:
+	.string	"expected true : age.has()"
+	.section	.rodata.str1.8
+	.align 8
+.LC13:
+	.string	"expected equal : expected value : age.get(), actual value : 12"
+	.section	.text.unlikely
+.LCOLDB14:
+	.text
+.LHOTB14:
+	.p2align 4
+	.globl	_Z30test_extract_specific_pattern1v
+	.type	_Z30test_extract_specific_pattern1v, @function
+_Z30test_extract_specific_pattern1v:
+.LFB6799:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6799
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	movdqa	.LC1(%rip), %xmm0
+	movaps	%xmm0, 16(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L125
+	pxor	%xmm0, %xmm0
+	leaq	40(%rsp), %r13
+	movq	%rax, 32(%rsp)
+	xorl	%r12d, %r12d
+	leaq	.LC10(%rip), %rbp
+	movups	%xmm0, 40(%rsp)
+	movq	$0, 56(%rsp)
+	cmpq	%r13, %rbp
+	jb	.L169
+.L202:
+	leaq	.LC10(%rip), %rsi
+.L205:
+	movq	%r13, %rbx
+.L126:
+	movl	$11, %edx
+	leaq	(%rbx,%r12), %rdi
+	call	memmove@PLT
+	movq	16(%rsp), %rax
+	leaq	11(%rax), %rdx
+	movq	%rdx, 16(%rsp)
+	movb	$0, 11(%rbx,%rax)
+	movq	24(%rsp), %r8
+	movq	16(%rsp), %rax
+	cmpq	$23, %r8
+	je	.L206
+	movq	40(%rsp), %rdi
+	movq	%rdi, %rsi
+	testq	%rax, %rax
+	je	.L142
+.L140:
+	leaq	.LC11(%rip), %rcx
+	jmp	.L143
+	.p2align 4,,10
+	.p2align 3
+.L207:
+	cmpb	$36, %dl
+	je	.L145
+	addq	$1, %rsi
+	addq	$1, %rcx
+	subq	$1, %rax
+	je	.L144
+.L143:
+	movzbl	(%rcx), %edx
+	testb	%dl, %dl
+	jne	.L207
+.L145:
+	testq	%rax, %rax
+	je	.L144
+	movzbl	(%rsi), %edi
+	leaq	-1(%rax), %rdx
+	cmpb	$45, %dil
+	je	.L208
+	cmpb	$43, %dil
+	je	.L149
+	leaq	1(%rsi), %rcx
+	xorl	%r9d, %r9d
+.L148:
+	subl	$48, %edi
+	cmpb	$9, %dil
+	ja	.L144
+	movsbl	%dil, %ebx
+	testq	%rdx, %rdx
+	je	.L150
+	addq	%rcx, %rdx
+	jmp	.L152
+	.p2align 4,,10
+	.p2align 3
+.L209:
+	leal	(%rbx,%rbx,4), %esi
+	addq	$1, %rcx
+	leal	-48(%rax,%rsi,2), %ebx
+	cmpq	%rcx, %rdx
+	je	.L151
+.L152:
+	movsbl	(%rcx), %eax
+	leal	-48(%rax), %esi
+	cmpb	$9, %sil
+	jbe	.L209
+.L151:
+	testb	%r9b, %r9b
+	je	.L156
+.L153:
+	cmpq	$23, %r8
+	je	.L155
+	negl	%ebx
+.L154:
+	movq	32(%rsp), %rdi
+	movq	40(%rsp), %rsi
+	leaq	1(%r8), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L158:
+	cmpl	$12, %ebx
+	jne	.L155
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L208:
+	.cfi_restore_state
+	testq	%rdx, %rdx
+	jne	.L210
+	.p2align 4,,10
+	.p2align 3
+.L144:
+	cmpq	$23, %r8
+	je	.L141
+	movq	40(%rsp), %rdi
+.L142:
+	movq	32(%rsp), %rax
+	movq	%rdi, %rsi
+	leaq	1(%r8), %rdx
+	movl	$1, %ecx
+	movq	(%rax), %r9
+	movq	%rax, %rdi
+	call	*24(%r9)
+	jmp	.L141
+	.p2align 4,,10
+	.p2align 3
+.L206:
+	leaq	40(%rsp), %rsi
+	testq	%rax, %rax
+	jne	.L140
+	jmp	.L141
+	.p2align 4,,10
+	.p2align 3
+.L169:
+	movq	%rbp, %rsi
+	jmp	.L205
+	.p2align 4,,10
+	.p2align 3
+.L125:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L211
+.L130:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	16(%rsp), %r12
+	pxor	%xmm0, %xmm0
+	xorl	%r13d, %r13d
+	movq	24(%rsp), %r14
+	movups	%xmm0, 40(%rsp)
+	leaq	.LC10(%rip), %rbp
+	movq	%r15, 32(%rsp)
+	leaq	11(%r12), %rax
+	movq	$0, 56(%rsp)
+	cmpq	$23, %r14
+	je	.L212
+.L132:
+	leaq	0(%r13,%r12), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L213
+	subq	%r13, %rbp
+	movq	%rbp, 8(%rsp)
+	cmpq	%rax, %r14
+	jnb	.L166
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %rbp
+	movq	(%r15), %rax
+.LEHB6:
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L136
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L136:
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, %r14
+	movq	%rbp, 24(%rsp)
+.L135:
+	cmpq	$23, %r14
+	je	.L137
+	movq	8(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L126
+.L213:
+	cmpq	%rax, %r14
+	jnb	.L165
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %rbp
+	movq	(%r15), %rax
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L134
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L134:
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, 24(%rsp)
+.L128:
+	leaq	.LC10(%rip), %rsi
+	cmpq	$23, %rbp
+	jne	.L126
+	leaq	40(%rsp), %r13
+	jmp	.L202
+.L211:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L130
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L130
+.L149:
+	testq	%rdx, %rdx
+	je	.L144
+	movzbl	1(%rsi), %edi
+	leaq	-2(%rax), %rdx
+	leaq	2(%rsi), %rcx
+	xorl	%r9d, %r9d
+	jmp	.L148
+.L210:
+	movzbl	1(%rsi), %edi
+	leaq	-2(%rax), %rdx
+	leaq	2(%rsi), %rcx
+	movl	$1, %r9d
+	jmp	.L148
+.L156:
+	cmpq	$23, %r8
+	je	.L158
+	jmp	.L154
+	.p2align 4,,10
+	.p2align 3
+.L165:
+	xorl	%ebx, %ebx
+	movq	%r14, %rbp
+	jmp	.L128
+.L150:
+	testb	%r9b, %r9b
+	jne	.L153
+	cmpq	$23, %r8
+	je	.L155
+	jmp	.L154
+	.p2align 4,,10
+	.p2align 3
+.L166:
+	xorl	%ebx, %ebx
+	jmp	.L135
+.L137:
+	movq	8(%rsp), %rsi
+	leaq	40(%rsp), %r13
+	addq	%r13, %rsi
+	jmp	.L205
+.L212:
+	leaq	40(%rsp), %r13
+	cmpq	%r13, %rbp
+	jnb	.L132
+	cmpq	$23, %rax
+	jbe	.L169
+	movl	$56, %edx
+	movq	%r15, %rdi
+	cmpq	%rdx, %rax
+	cmovnb	%rax, %rdx
+	movq	(%r15), %rax
+	leaq	1(%rdx), %rsi
+	movq	%rdx, %r14
+	movl	$1, %edx
+	call	*16(%rax)
+.LEHE6:
+	movq	%r13, %rsi
+	leaq	1(%r12), %rdx
+	movq	%rax, %rbx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, %rsi
+	movq	%r14, 24(%rsp)
+	jmp	.L126
+	.section	.gcc_except_table
+.LLSDA6799:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6799-.LLSDACSB6799
+.LLSDACSB6799:
+	.uleb128 .LEHB6-.LFB6799
+	.uleb128 .LEHE6-.LEHB6
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6799:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6799
+	.type	_Z30test_extract_specific_pattern1v.cold, @function
+_Z30test_extract_specific_pattern1v.cold:
+.LFSB6799:
+.L141:
+	.cfi_def_cfa_offset 128
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC12(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB7:
+	call	__cxa_throw@PLT
+.L155:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC13(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE7:
+	.cfi_endproc
+.LFE6799:
+	.section	.gcc_except_table
+.LLSDAC6799:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6799-.LLSDACSBC6799
+.LLSDACSBC6799:
+	.uleb128 .LEHB7-.LCOLDB14
+	.uleb128 .LEHE7-.LEHB7
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6799:
+	.section	.text.unlikely
+	.text
+	.size	_Z30test_extract_specific_pattern1v, .-_Z30test_extract_specific_pattern1v
+	.section	.text.unlikely
+	.size	_Z30test_extract_specific_pattern1v.cold, .-_Z30test_extract_specific_pattern1v.cold
+.LCOLDE14:
+	.text
+.LHOTE14:
+	.section	.rodata.str1.1
+.LC15:
+	.string	"-456"
+.LC16:
+	.string	"expected true : mi.has()"
+	.section	.rodata.str1.8
+	.align 8
+.LC17:
+	.string	"expected equal : expected value : mi.get(), actual value : -456"
+	.section	.text.unlikely
+.LCOLDB18:
+	.text
+.LHOTB18:
+	.p2align 4
+	.globl	_Z28test_extract_signed_integralv
+	.type	_Z28test_extract_signed_integralv, @function
+_Z28test_extract_signed_integralv:
+.LFB6773:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6773
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	movdqa	.LC1(%rip), %xmm0
+	movaps	%xmm0, 16(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L215
+	pxor	%xmm0, %xmm0
+	leaq	40(%rsp), %r14
+	movq	%rax, 32(%rsp)
+	xorl	%r13d, %r13d
+	leaq	.LC15(%rip), %r12
+	movups	%xmm0, 40(%rsp)
+	movq	$0, 56(%rsp)
+	cmpq	%r14, %r12
+	jb	.L258
+.L293:
+	leaq	.LC15(%rip), %rax
+.L296:
+	movq	%r14, %rbx
+.L216:
+	movl	(%rax), %eax
+	movl	%eax, (%rbx,%r13)
+	movq	16(%rsp), %rax
+	leaq	4(%rax), %rdx
+	movq	%rdx, 16(%rsp)
+	movb	$0, 4(%rbx,%rax)
+	movq	24(%rsp), %rcx
+	movq	16(%rsp), %rax
+	cmpq	$23, %rcx
+	je	.L297
+	movq	40(%rsp), %rsi
+	movq	%rsi, %r8
+	testq	%rax, %rax
+	je	.L233
+	movzbl	(%rsi), %edx
+	leaq	-1(%rax), %rdi
+	cmpb	$45, %dl
+	je	.L298
+.L231:
+	cmpb	$43, %dl
+	je	.L236
+	leaq	1(%r8), %rax
+	xorl	%r8d, %r8d
+.L235:
+	subl	$48, %edx
+	cmpb	$9, %dl
+	ja	.L237
+	movsbl	%dl, %ebx
+	testq	%rdi, %rdi
+	je	.L238
+	movq	%rax, %rdx
+	addq	%rax, %rdi
+	jmp	.L240
+	.p2align 4,,10
+	.p2align 3
+.L299:
+	leal	(%rbx,%rbx,4), %esi
+	addq	$1, %rdx
+	leal	-48(%rax,%rsi,2), %ebx
+	cmpq	%rdx, %rdi
+	je	.L239
+.L240:
+	movsbl	(%rdx), %eax
+	leal	-48(%rax), %esi
+	cmpb	$9, %sil
+	jbe	.L299
+.L239:
+	testb	%r8b, %r8b
+	je	.L241
+	negl	%ebx
+	cmpq	$23, %rcx
+	jne	.L243
+.L246:
+	cmpl	$-456, %ebx
+	jne	.L244
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L297:
+	.cfi_restore_state
+	testq	%rax, %rax
+	je	.L230
+	movzbl	40(%rsp), %edx
+	leaq	-1(%rax), %rdi
+	leaq	40(%rsp), %r8
+	cmpb	$45, %dl
+	jne	.L231
+	testq	%rdi, %rdi
+	je	.L230
+.L232:
+	movzbl	1(%r8), %edx
+	leaq	-2(%rax), %rdi
+	leaq	2(%r8), %rax
+	movl	$1, %r8d
+	jmp	.L235
+	.p2align 4,,10
+	.p2align 3
+.L258:
+	movq	%r12, %rax
+	jmp	.L296
+	.p2align 4,,10
+	.p2align 3
+.L215:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L300
+.L220:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	16(%rsp), %r13
+	pxor	%xmm0, %xmm0
+	movq	$0, 56(%rsp)
+	movq	24(%rsp), %rbp
+	movups	%xmm0, 40(%rsp)
+	leaq	.LC15(%rip), %r12
+	movq	%r15, 32(%rsp)
+	leaq	4(%r13), %rax
+	movq	$0, 8(%rsp)
+	cmpq	$23, %rbp
+	je	.L301
+.L222:
+	movq	8(%rsp), %r14
+	leaq	(%r14,%r13), %rdx
+	cmpq	%rdx, %r12
+	jnb	.L302
+	movq	8(%rsp), %rcx
+	subq	%rcx, %r12
+	cmpq	%rax, %rbp
+	jnb	.L254
+	leaq	10(%rbp,%rbp), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %r14
+	movq	(%r15), %rax
+.LEHB8:
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %rbp
+	je	.L226
+	movq	(%r15), %rax
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L226:
+	movq	%rbx, 40(%rsp)
+	movq	%r14, %rbp
+	movq	%r14, 24(%rsp)
+.L225:
+	leaq	(%rbx,%r12), %rax
+	cmpq	$23, %rbp
+	jne	.L216
+	leaq	40(%rsp), %r14
+	leaq	(%r14,%r12), %rax
+	jmp	.L296
+.L302:
+	cmpq	%rax, %rbp
+	jnb	.L253
+	leaq	10(%rbp,%rbp), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %r12
+	movq	(%r15), %rax
+	call	*16(%rax)
+	leaq	1(%r13), %rdx
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %rbp
+	je	.L224
+	movq	(%r15), %rax
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.LEHE8:
+.L224:
+	movq	%rbx, 40(%rsp)
+	movq	%r12, 24(%rsp)
+.L218:
+	leaq	.LC15(%rip), %rax
+	cmpq	$23, %r12
+	jne	.L216
+	leaq	40(%rsp), %r14
+	jmp	.L293
+.L237:
+	cmpq	$23, %rcx
+	je	.L230
+	movq	40(%rsp), %rsi
+.L233:
+	movq	32(%rsp), %rdi
+	leaq	1(%rcx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L230
+	.p2align 4,,10
+	.p2align 3
+.L300:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L220
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L220
+.L236:
+	testq	%rdi, %rdi
+	je	.L237
+	movzbl	1(%r8), %edx
+	leaq	-2(%rax), %rdi
+	leaq	2(%r8), %rax
+	xorl	%r8d, %r8d
+	jmp	.L235
+.L241:
+	cmpq	$23, %rcx
+	je	.L244
+	jmp	.L243
+	.p2align 4,,10
+	.p2align 3
+.L253:
+	xorl	%ebx, %ebx
+	movq	%rbp, %r12
+	jmp	.L218
+.L238:
+	testb	%r8b, %r8b
+	je	.L241
+	cmpq	$23, %rcx
+	je	.L244
+	negl	%ebx
+.L243:
+	movq	32(%rsp), %rdi
+	leaq	1(%rcx), %rdx
+	movq	40(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L246
+	.p2align 4,,10
+	.p2align 3
+.L254:
+	xorl	%ebx, %ebx
+	jmp	.L225
+.L301:
+	leaq	40(%rsp), %r14
+	cmpq	%r14, %r12
+	jnb	.L303
+	cmpq	$23, %rax
+	jbe	.L258
+	movl	$56, %edx
+	movq	%r15, %rdi
+	cmpq	%rdx, %rax
+	cmovnb	%rax, %rdx
+	movq	(%r15), %rax
+	leaq	1(%rdx), %rsi
+	movq	%rdx, %rbp
+	movl	$1, %edx
+.LEHB9:
+	call	*16(%rax)
+.LEHE9:
+	leaq	1(%r13), %rdx
+	movq	%r14, %rsi
+	movq	%rax, %rbx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	%rbx, 40(%rsp)
+	movq	%r12, %rax
+	movq	%rbp, 24(%rsp)
+	jmp	.L216
+.L298:
+	testq	%rdi, %rdi
+	je	.L233
+	jmp	.L232
+.L303:
+	movq	%r14, 8(%rsp)
+	jmp	.L222
+	.section	.gcc_except_table
+.LLSDA6773:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6773-.LLSDACSB6773
+.LLSDACSB6773:
+	.uleb128 .LEHB8-.LFB6773
+	.uleb128 .LEHE8-.LEHB8
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB9-.LFB6773
+	.uleb128 .LEHE9-.LEHB9
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6773:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6773
+	.type	_Z28test_extract_signed_integralv.cold, @function
+_Z28test_extract_signed_integralv.cold:
+.LFSB6773:
+.L244:
+	.cfi_def_cfa_offset 128
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC17(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB10:
+	call	__cxa_throw@PLT
+.L230:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC16(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE10:
+	.cfi_endproc
+.LFE6773:
+	.section	.gcc_except_table
+.LLSDAC6773:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6773-.LLSDACSBC6773
+.LLSDACSBC6773:
+	.uleb128 .LEHB10-.LCOLDB18
+	.uleb128 .LEHE10-.LEHB10
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6773:
+	.section	.text.unlikely
+	.text
+	.size	_Z28test_extract_signed_integralv, .-_Z28test_extract_signed_integralv
+	.section	.text.unlikely
+	.size	_Z28test_extract_signed_integralv.cold, .-_Z28test_extract_signed_integralv.cold
+.LCOLDE18:
+	.text
+.LHOTE18:
+	.section	.rodata.str1.1
+.LC19:
+	.string	"name=\"Bob\";"
+.LC20:
+	.string	"name=$;"
+.LC21:
+	.string	"Bob"
+	.section	.rodata.str1.8
+	.align 8
+.LC22:
+	.string	"expected true : name.get() == n::slice_of(\"Bob\")"
+	.align 8
+.LC23:
+	.string	"expected equal : expected value : name.get().data(), actual value : input.data() + 6"
+	.section	.rodata.str1.1
+.LC24:
+	.string	"expected true : name.has()"
+	.section	.text.unlikely
+.LCOLDB25:
+	.text
+.LHOTB25:
+	.p2align 4
+	.globl	_Z27test_extract_borrowed_slicev
+	.type	_Z27test_extract_borrowed_slicev, @function
+_Z27test_extract_borrowed_slicev:
+.LFB6785:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6785
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	movdqa	.LC1(%rip), %xmm0
+	movaps	%xmm0, 16(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L305
+	pxor	%xmm0, %xmm0
+	leaq	40(%rsp), %r13
+	movq	%rax, 32(%rsp)
+	xorl	%r12d, %r12d
+	leaq	.LC19(%rip), %rbp
+	movups	%xmm0, 40(%rsp)
+	movq	$0, 56(%rsp)
+	cmpq	%r13, %rbp
+	jb	.L340
+.L370:
+	leaq	.LC19(%rip), %rsi
+.L372:
+	movq	%r13, %rbx
+.L306:
+	leaq	(%rbx,%r12), %rdi
+	movl	$11, %edx
+	leaq	40(%rsp), %r12
+	call	memmove@PLT
+	movq	16(%rsp), %rax
+	leaq	11(%rax), %rdx
+	movq	%rdx, 16(%rsp)
+	movb	$0, 11(%rbx,%rax)
+	movq	24(%rsp), %rbp
+	movq	16(%rsp), %rsi
+	cmpq	$23, %rbp
+	je	.L319
+	movq	40(%rsp), %r12
+.L319:
+	testq	%rsi, %rsi
+	je	.L320
+	leaq	.LC20(%rip), %rcx
+	addq	%r12, %rsi
+	movq	%r12, %rax
+	jmp	.L321
+	.p2align 4,,10
+	.p2align 3
+.L373:
+	cmpb	$36, %dl
+	je	.L322
+	addq	$1, %rax
+	addq	$1, %rcx
+	cmpq	%rax, %rsi
+	je	.L320
+.L321:
+	movzbl	(%rcx), %edx
+	testb	%dl, %dl
+	jne	.L373
+.L322:
+	subq	%rax, %rsi
+	cmpq	$1, %rsi
+	ja	.L374
+.L320:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC24(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB11:
+	call	__cxa_throw@PLT
+.LEHE11:
+	.p2align 4,,10
+	.p2align 3
+.L374:
+	cmpb	$34, (%rax)
+	jne	.L320
+	leaq	1(%rax), %rbx
+	leaq	-1(%rsi), %rdx
+	movl	$34, %esi
+	movq	%rbx, %rdi
+	call	memchr@PLT
+	testq	%rax, %rax
+	je	.L320
+	subq	%rbx, %rax
+	cmpq	$-3, %rax
+	ja	.L320
+	cmpq	$3, %rax
+	jne	.L324
+	cmpw	$28482, (%rbx)
+	jne	.L324
+	cmpb	$98, 2(%rbx)
+	jne	.L324
+	addq	$6, %r12
+	cmpq	%r12, %rbx
+	jne	.L375
+	cmpq	$23, %rbp
+	je	.L304
+	movq	32(%rsp), %rdi
+	movq	40(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L304:
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L340:
+	.cfi_restore_state
+	movq	%rbp, %rsi
+	jmp	.L372
+	.p2align 4,,10
+	.p2align 3
+.L305:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L376
+.L310:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	16(%rsp), %r12
+	pxor	%xmm0, %xmm0
+	xorl	%r13d, %r13d
+	movq	24(%rsp), %r14
+	movups	%xmm0, 40(%rsp)
+	leaq	.LC19(%rip), %rbp
+	movq	%r15, 32(%rsp)
+	leaq	11(%r12), %rax
+	movq	$0, 56(%rsp)
+	cmpq	$23, %r14
+	je	.L377
+.L312:
+	leaq	0(%r13,%r12), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L378
+	subq	%r13, %rbp
+	movq	%rbp, 8(%rsp)
+	cmpq	%rax, %r14
+	jnb	.L337
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %rbp
+	movq	(%r15), %rax
+.LEHB12:
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L316
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L316:
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, %r14
+	movq	%rbp, 24(%rsp)
+.L315:
+	cmpq	$23, %r14
+	je	.L317
+	movq	8(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L306
+.L378:
+	cmpq	%rax, %r14
+	jnb	.L336
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %rbp
+	movq	(%r15), %rax
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L314
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L314:
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, 24(%rsp)
+.L308:
+	leaq	.LC19(%rip), %rsi
+	cmpq	$23, %rbp
+	jne	.L306
+	leaq	40(%rsp), %r13
+	jmp	.L370
+.L376:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L310
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L310
+.L336:
+	xorl	%ebx, %ebx
+	movq	%r14, %rbp
+	jmp	.L308
+.L337:
+	xorl	%ebx, %ebx
+	jmp	.L315
+.L317:
+	movq	8(%rsp), %rsi
+	leaq	40(%rsp), %r13
+	addq	%r13, %rsi
+	jmp	.L372
+.L377:
+	leaq	40(%rsp), %r13
+	cmpq	%r13, %rbp
+	jnb	.L312
+	cmpq	$23, %rax
+	jbe	.L340
+	movl	$56, %edx
+	movq	%r15, %rdi
+	cmpq	%rdx, %rax
+	cmovnb	%rax, %rdx
+	movq	(%r15), %rax
+	leaq	1(%rdx), %rsi
+	movq	%rdx, %r14
+	movl	$1, %edx
+	call	*16(%rax)
+.LEHE12:
+	movq	%r13, %rsi
+	leaq	1(%r12), %rdx
+	movq	%rax, %rbx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, %rsi
+	movq	%r14, 24(%rsp)
+	jmp	.L306
+.L375:
+	jmp	.L369
+.L367:
+	jmp	.L368
+	.section	.gcc_except_table
+.LLSDA6785:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6785-.LLSDACSB6785
+.LLSDACSB6785:
+	.uleb128 .LEHB11-.LFB6785
+	.uleb128 .LEHE11-.LEHB11
+	.uleb128 .L367-.LFB6785
+	.uleb128 0
+	.uleb128 .LEHB12-.LFB6785
+	.uleb128 .LEHE12-.LEHB12
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6785:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6785
+	.type	_Z27test_extract_borrowed_slicev.cold, @function
+_Z27test_extract_borrowed_slicev.cold:
+.LFSB6785:
+.L324:
+	.cfi_def_cfa_offset 128
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC22(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB13:
+	call	__cxa_throw@PLT
+.L369:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC23(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE13:
+.L341:
+.L368:
+	movq	%rax, %rbx
+	cmpq	$23, %rbp
+	je	.L331
+	movq	32(%rsp), %rdi
+	movq	40(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L331:
+	movq	%rbx, %rdi
+.LEHB14:
+	call	_Unwind_Resume@PLT
+.LEHE14:
+	.cfi_endproc
+.LFE6785:
+	.section	.gcc_except_table
+.LLSDAC6785:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6785-.LLSDACSBC6785
+.LLSDACSBC6785:
+	.uleb128 .LEHB13-.LCOLDB25
+	.uleb128 .LEHE13-.LEHB13
+	.uleb128 .L341-.LCOLDB25
+	.uleb128 0
+	.uleb128 .LEHB14-.LCOLDB25
+	.uleb128 .LEHE14-.LEHB14
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6785:
+	.section	.text.unlikely
+	.text
+	.size	_Z27test_extract_borrowed_slicev, .-_Z27test_extract_borrowed_slicev
+	.section	.text.unlikely
+	.size	_Z27test_extract_borrowed_slicev.cold, .-_Z27test_extract_borrowed_slicev.cold
+.LCOLDE25:
+	.text
+.LHOTE25:
+	.section	.rodata.str1.1
+.LC26:
+	.string	"true"
+.LC27:
+	.string	"false"
+.LC28:
+	.string	"expected true : mb.has()"
+.LC29:
+	.string	"expected true : mb.get()"
+.LC30:
+	.string	"expected false : mb.get()"
+	.section	.text.unlikely
+.LCOLDB31:
+	.text
+.LHOTB31:
+	.p2align 4
+	.globl	_Z17test_extract_boolv
+	.type	_Z17test_extract_boolv, @function
+_Z17test_extract_boolv:
+.LFB6779:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6779
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$88, %rsp
+	.cfi_def_cfa_offset 144
+	movdqa	.LC1(%rip), %xmm1
+	movaps	%xmm1, 32(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L380
+	pxor	%xmm0, %xmm0
+	leaq	56(%rsp), %r12
+	movq	%rax, 48(%rsp)
+	xorl	%r13d, %r13d
+	leaq	.LC26(%rip), %rbx
+	movups	%xmm0, 56(%rsp)
+	movq	$0, 72(%rsp)
+	cmpq	%r12, %rbx
+	jb	.L469
+.L506:
+	leaq	.LC26(%rip), %r14
+.L511:
+	movq	%r12, %rbp
+.L381:
+	movl	(%r14), %eax
+	movl	%eax, 0(%rbp,%r13)
+	movq	32(%rsp), %rax
+	leaq	4(%rax), %rdx
+	movq	%rdx, 32(%rsp)
+	movb	$0, 4(%rbp,%rax)
+	movq	40(%rsp), %rdx
+	movq	32(%rsp), %rsi
+	cmpq	$23, %rdx
+	je	.L514
+	movq	56(%rsp), %rdi
+	testq	%rsi, %rsi
+	je	.L397
+.L395:
+	xorl	%eax, %eax
+	movl	$116, %ecx
+	jmp	.L400
+	.p2align 4,,10
+	.p2align 3
+.L515:
+	cmpq	%rax, %rsi
+	je	.L453
+	addq	$1, %rax
+	cmpb	-1(%rdi,%rax), %cl
+	jne	.L453
+	movzbl	(%rbx,%rax), %ecx
+.L400:
+	testb	%cl, %cl
+	jne	.L515
+	cmpq	%rax, %rsi
+	jne	.L453
+	movb	$1, (%rsp)
+	cmpq	$23, %rdx
+	jne	.L440
+	.p2align 4,,10
+	.p2align 3
+.L442:
+	movdqa	.LC1(%rip), %xmm2
+	movaps	%xmm2, 32(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L407
+	pxor	%xmm0, %xmm0
+	leaq	56(%rsp), %r12
+	movq	%rax, 48(%rsp)
+	xorl	%r14d, %r14d
+	leaq	.LC27(%rip), %r13
+	movups	%xmm0, 56(%rsp)
+	movq	$0, 72(%rsp)
+	cmpq	%r12, %r13
+	jb	.L466
+.L507:
+	leaq	.LC27(%rip), %rsi
+.L512:
+	movq	%r12, %rbp
+.L408:
+	movl	$5, %edx
+	leaq	0(%rbp,%r14), %rdi
+	call	memmove@PLT
+	movq	32(%rsp), %rax
+	leaq	5(%rax), %rdx
+	movq	%rdx, 32(%rsp)
+	movb	$0, 5(%rbp,%rax)
+	movq	40(%rsp), %rdx
+	movq	32(%rsp), %rsi
+	cmpq	$23, %rdx
+	je	.L516
+	movq	56(%rsp), %rdi
+	testq	%rsi, %rsi
+	je	.L424
+.L422:
+	xorl	%eax, %eax
+	movl	$116, %ecx
+	jmp	.L427
+	.p2align 4,,10
+	.p2align 3
+.L517:
+	cmpq	%rax, %rsi
+	je	.L463
+	addq	$1, %rax
+	cmpb	%cl, -1(%rdi,%rax)
+	jne	.L463
+	movzbl	(%rbx,%rax), %ecx
+.L427:
+	testb	%cl, %cl
+	jne	.L517
+	cmpq	%rax, %rsi
+	jne	.L463
+	movb	$1, (%rsp)
+	cmpq	$23, %rdx
+	je	.L518
+	.p2align 4,,10
+	.p2align 3
+.L513:
+	movq	56(%rsp), %rdi
+.L424:
+	movq	48(%rsp), %rax
+	movq	%rdi, %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rax), %r8
+	movq	%rax, %rdi
+	call	*24(%r8)
+.L434:
+	cmpb	$0, (%rsp)
+	jne	.L437
+.L379:
+	addq	$88, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L514:
+	.cfi_restore_state
+	leaq	56(%rsp), %rdi
+	testq	%rsi, %rsi
+	jne	.L395
+	jmp	.L396
+	.p2align 4,,10
+	.p2align 3
+.L453:
+	xorl	%eax, %eax
+	movl	$102, %ecx
+	leaq	.LC27(%rip), %r8
+	jmp	.L405
+	.p2align 4,,10
+	.p2align 3
+.L519:
+	cmpq	%rax, %rsi
+	je	.L404
+	addq	$1, %rax
+	cmpb	%cl, -1(%rdi,%rax)
+	jne	.L404
+	movzbl	(%r8,%rax), %ecx
+.L405:
+	testb	%cl, %cl
+	jne	.L519
+	cmpq	%rax, %rsi
+	je	.L520
+.L404:
+	cmpq	$23, %rdx
+	je	.L396
+	movq	56(%rsp), %rdi
+.L397:
+	movq	48(%rsp), %rax
+	movq	%rdi, %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rax), %r8
+	movq	%rax, %rdi
+	call	*24(%r8)
+	jmp	.L396
+	.p2align 4,,10
+	.p2align 3
+.L469:
+	movq	%rbx, %r14
+	jmp	.L511
+.L520:
+	cmpq	$23, %rdx
+	je	.L441
+	movb	$0, (%rsp)
+.L440:
+	movq	48(%rsp), %rdi
+	addq	$1, %rdx
+	movq	56(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpb	$0, (%rsp)
+	jne	.L442
+	jmp	.L441
+	.p2align 4,,10
+	.p2align 3
+.L516:
+	leaq	56(%rsp), %rdi
+	testq	%rsi, %rsi
+	jne	.L422
+	jmp	.L437
+	.p2align 4,,10
+	.p2align 3
+.L463:
+	xorl	%eax, %eax
+	movl	$102, %ecx
+	jmp	.L432
+	.p2align 4,,10
+	.p2align 3
+.L521:
+	cmpq	%rax, %rsi
+	je	.L430
+	addq	$1, %rax
+	cmpb	%cl, -1(%rdi,%rax)
+	jne	.L431
+	movzbl	0(%r13,%rax), %ecx
+.L432:
+	testb	%cl, %cl
+	jne	.L521
+	cmpq	%rax, %rsi
+	je	.L522
+.L430:
+	cmpq	$23, %rdx
+	jne	.L513
+	jmp	.L437
+	.p2align 4,,10
+	.p2align 3
+.L431:
+	cmpq	$23, %rdx
+	jne	.L513
+	jmp	.L434
+	.p2align 4,,10
+	.p2align 3
+.L466:
+	movq	%r13, %rsi
+	jmp	.L512
+	.p2align 4,,10
+	.p2align 3
+.L407:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L523
+.L412:
+	movq	_ZZN1n4heapEvE3res(%rip), %r9
+	movq	32(%rsp), %r14
+	pxor	%xmm0, %xmm0
+	xorl	%r12d, %r12d
+	movq	40(%rsp), %rcx
+	movups	%xmm0, 56(%rsp)
+	leaq	.LC27(%rip), %r13
+	movq	%r9, 48(%rsp)
+	leaq	5(%r14), %rax
+	movq	$0, 72(%rsp)
+	cmpq	$23, %rcx
+	je	.L524
+.L414:
+	leaq	(%r12,%r14), %rdx
+	cmpq	%rdx, %r13
+	jnb	.L525
+	movq	%r13, %rdi
+	subq	%r12, %rdi
+	movq	%rdi, 24(%rsp)
+	cmpq	%rax, %rcx
+	jnb	.L459
+	leaq	10(%rcx,%rcx), %rdx
+	movq	%rcx, 8(%rsp)
+	movq	%r9, %rdi
+	cmpq	%rax, %rdx
+	movq	%r9, 16(%rsp)
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %r15
+	movq	(%r9), %rax
+.LEHB15:
+	call	*16(%rax)
+	leaq	1(%r14), %rdx
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	movq	8(%rsp), %rcx
+	cmpq	$23, %rcx
+	je	.L418
+	movq	16(%rsp), %r9
+	leaq	1(%rcx), %rdx
+	xorl	%esi, %esi
+	movl	$1, %ecx
+	movq	(%r9), %rax
+	movq	%r9, %rdi
+	call	*24(%rax)
+.L418:
+	movq	%rbp, 56(%rsp)
+	movq	%r15, %rcx
+	movq	%r15, 40(%rsp)
+.L417:
+	cmpq	$23, %rcx
+	je	.L419
+	movq	24(%rsp), %rsi
+	addq	%rbp, %rsi
+	jmp	.L408
+.L525:
+	cmpq	%rax, %rcx
+	jnb	.L458
+	leaq	10(%rcx,%rcx), %rdx
+	movq	%rcx, 16(%rsp)
+	movq	%r9, %rdi
+	cmpq	%rax, %rdx
+	movq	%r9, 8(%rsp)
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %r15
+	movq	(%r9), %rax
+	call	*16(%rax)
+	leaq	1(%r14), %rdx
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	movq	16(%rsp), %rcx
+	cmpq	$23, %rcx
+	je	.L416
+	movq	8(%rsp), %r9
+	leaq	1(%rcx), %rdx
+	xorl	%esi, %esi
+	movl	$1, %ecx
+	movq	(%r9), %rax
+	movq	%r9, %rdi
+	call	*24(%rax)
+.L416:
+	movq	%rbp, 56(%rsp)
+	movq	%r15, 40(%rsp)
+.L410:
+	leaq	.LC27(%rip), %rsi
+	cmpq	$23, %r15
+	jne	.L408
+	leaq	56(%rsp), %r12
+	jmp	.L507
+	.p2align 4,,10
+	.p2align 3
+.L380:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L526
+.L385:
+	movq	_ZZN1n4heapEvE3res(%rip), %r14
+	movq	32(%rsp), %r13
+	pxor	%xmm0, %xmm0
+	xorl	%r12d, %r12d
+	movq	40(%rsp), %rcx
+	movups	%xmm0, 56(%rsp)
+	leaq	.LC26(%rip), %rbx
+	movq	%r14, 48(%rsp)
+	leaq	4(%r13), %rax
+	movq	$0, 72(%rsp)
+	cmpq	$23, %rcx
+	je	.L527
+.L387:
+	leaq	(%r12,%r13), %rdx
+	cmpq	%rdx, %rbx
+	jnb	.L528
+	movq	%rbx, %rdi
+	subq	%r12, %rdi
+	movq	%rdi, 8(%rsp)
+	cmpq	%rax, %rcx
+	jnb	.L449
+	leaq	10(%rcx,%rcx), %rdx
+	movq	%rcx, (%rsp)
+	movq	%r14, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %r15
+	movq	(%r14), %rax
+	call	*16(%rax)
+	leaq	1(%r13), %rdx
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	movq	(%rsp), %rcx
+	cmpq	$23, %rcx
+	je	.L391
+	movq	(%r14), %rax
+	leaq	1(%rcx), %rdx
+	xorl	%esi, %esi
+	movl	$1, %ecx
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L391:
+	movq	%rbp, 56(%rsp)
+	movq	%r15, %rcx
+	movq	%r15, 40(%rsp)
+.L390:
+	cmpq	$23, %rcx
+	je	.L392
+	movq	8(%rsp), %r14
+	addq	%rbp, %r14
+	jmp	.L381
+.L528:
+	cmpq	%rax, %rcx
+	jnb	.L448
+	leaq	10(%rcx,%rcx), %rdx
+	movq	%rcx, (%rsp)
+	movq	%r14, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %r15
+	movq	(%r14), %rax
+	call	*16(%rax)
+	leaq	1(%r13), %rdx
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	movq	(%rsp), %rcx
+	cmpq	$23, %rcx
+	je	.L389
+	movq	(%r14), %rax
+	leaq	1(%rcx), %rdx
+	xorl	%esi, %esi
+	movl	$1, %ecx
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L389:
+	movq	%rbp, 56(%rsp)
+	movq	%r15, 40(%rsp)
+.L383:
+	leaq	.LC26(%rip), %r14
+	cmpq	$23, %r15
+	jne	.L381
+	leaq	56(%rsp), %r12
+	jmp	.L506
+.L526:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L385
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L385
+.L523:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L412
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L412
+.L522:
+	movb	$0, (%rsp)
+	cmpq	$23, %rdx
+	jne	.L513
+	jmp	.L379
+.L518:
+	jmp	.L437
+.L448:
+	xorl	%ebp, %ebp
+	movq	%rcx, %r15
+	jmp	.L383
+.L458:
+	xorl	%ebp, %ebp
+	movq	%rcx, %r15
+	jmp	.L410
+.L527:
+	leaq	56(%rsp), %r12
+	cmpq	%r12, %rbx
+	jnb	.L387
+	cmpq	$23, %rax
+	jbe	.L469
+	movl	$56, %edx
+	movq	%r14, %rdi
+	cmpq	%rdx, %rax
+	cmovnb	%rax, %rdx
+	movq	(%r14), %rax
+	movq	%rbx, %r14
+	leaq	1(%rdx), %rsi
+	movq	%rdx, %r15
+	movl	$1, %edx
+	call	*16(%rax)
+	leaq	1(%r13), %rdx
+	movq	%r12, %rsi
+	movq	%rax, %rbp
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	%rbp, 56(%rsp)
+	movq	%r15, 40(%rsp)
+	jmp	.L381
+.L449:
+	xorl	%ebp, %ebp
+	jmp	.L390
+.L392:
+	movq	8(%rsp), %r14
+	leaq	56(%rsp), %r12
+	addq	%r12, %r14
+	jmp	.L511
+.L459:
+	xorl	%ebp, %ebp
+	jmp	.L417
+.L419:
+	movq	24(%rsp), %rsi
+	leaq	56(%rsp), %r12
+	addq	%r12, %rsi
+	jmp	.L512
+.L524:
+	leaq	56(%rsp), %r12
+	cmpq	%r12, %r13
+	jnb	.L414
+	cmpq	$23, %rax
+	jbe	.L466
+	movl	$56, %edx
+	movq	%r9, %rdi
+	cmpq	%rdx, %rax
+	cmovnb	%rax, %rdx
+	movq	(%r9), %rax
+	leaq	1(%rdx), %rsi
+	movq	%rdx, %r15
+	movl	$1, %edx
+	call	*16(%rax)
+.LEHE15:
+	movq	%r12, %rsi
+	leaq	1(%r14), %rdx
+	movq	%rax, %rbp
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	%rbp, 56(%rsp)
+	movq	%r13, %rsi
+	movq	%r15, 40(%rsp)
+	jmp	.L408
+	.section	.gcc_except_table
+.LLSDA6779:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6779-.LLSDACSB6779
+.LLSDACSB6779:
+	.uleb128 .LEHB15-.LFB6779
+	.uleb128 .LEHE15-.LEHB15
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6779:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6779
+	.type	_Z17test_extract_boolv.cold, @function
+_Z17test_extract_boolv.cold:
+.LFSB6779:
+.L441:
+	.cfi_def_cfa_offset 144
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC29(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB16:
+	call	__cxa_throw@PLT
+.L396:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC28(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L437:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC30(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE16:
+	.cfi_endproc
+.LFE6779:
+	.section	.gcc_except_table
+.LLSDAC6779:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6779-.LLSDACSBC6779
+.LLSDACSBC6779:
+	.uleb128 .LEHB16-.LCOLDB31
+	.uleb128 .LEHE16-.LEHB16
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6779:
+	.section	.text.unlikely
+	.text
+	.size	_Z17test_extract_boolv, .-_Z17test_extract_boolv
+	.section	.text.unlikely
+	.size	_Z17test_extract_boolv.cold, .-_Z17test_extract_boolv.cold
+.LCOLDE31:
+	.text
+.LHOTE31:
+	.section	.rodata._ZN1n4test10test_suite7run_allEv.str1.1,"aMS",@progbits,1
+.LC32:
+	.string	"\nSUITE [%s] "
+.LC34:
+	.string	"%s"
+.LC35:
+	.string	"\nTEST [%s] "
+.LC36:
+	.string	" - Result : \033[1;32mPASSED\033[0m"
+.LC37:
+	.string	"\033[1;31merror : %s\033[0m\n"
+.LC38:
+	.string	" - Result : \033[1;31mFAILED\033[0m"
+.LC39:
+	.string	" - Passed : \033[1;32m%d\033[0m\n"
+.LC40:
+	.string	" - Failed : \033[1;31m%d\033[0m\n"
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4test10test_suite7run_allEv
+	.type	_ZN1n4test10test_suite7run_allEv, @function
+_ZN1n4test10test_suite7run_allEv:
+.LFB6752:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6752
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	leaq	.LC32(%rip), %rdx
+	movl	$79, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	16(%rdi), %rcx
+	leaq	16(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L530
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L531
+	testb	$4, %cl
+	jne	.L584
+	testl	%ecx, %ecx
+	je	.L530
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L585
+	.p2align 4,,10
+	.p2align 3
+.L530:
+	movzwl	.LC33(%rip), %r15d
+	movq	%rbx, %rsi
+	leaq	.LC34(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+.LEHB17:
+	call	printf@PLT
+	movl	8(%r12), %esi
+	testl	%esi, %esi
+	jle	.L551
+	movl	$0, 12(%rsp)
+	xorl	%ebp, %ebp
+	xorl	%r14d, %r14d
+	jmp	.L545
+	.p2align 4,,10
+	.p2align 3
+.L588:
+	testb	$4, %dl
+	jne	.L586
+	testl	%edx, %edx
+	je	.L536
+	movb	$42, (%rax)
+	testb	$2, %dl
+	jne	.L587
+	.p2align 4,,10
+	.p2align 3
+.L536:
+	movq	%rbx, %rsi
+	leaq	.LC34(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+.LEHE17:
+	movq	(%r12), %rax
+.LEHB18:
+	call	*8(%rax,%r13)
+.LEHE18:
+	leaq	.LC36(%rip), %rdi
+	addl	$1, %r14d
+.LEHB19:
+	call	puts@PLT
+.L541:
+	addq	$1, %rbp
+	cmpl	%ebp, 8(%r12)
+	jle	.L535
+.L545:
+	movq	(%r12), %rax
+	movq	%rbp, %r13
+	movq	%rbx, %rdi
+	movl	$79, %esi
+	salq	$4, %r13
+	leaq	.LC35(%rip), %rdx
+	movq	(%rax,%r13), %rcx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L536
+	movl	$79, %edx
+	subl	%eax, %edx
+	addq	%rbx, %rax
+	cmpl	$8, %edx
+	jb	.L588
+	movabsq	$3038287259199220266, %rsi
+	leaq	8(%rax), %rdi
+	movl	%edx, %ecx
+	andq	$-8, %rdi
+	movq	%rsi, (%rax)
+	movq	%rsi, -8(%rax,%rcx)
+	subq	%rdi, %rax
+	leal	(%rdx,%rax), %ecx
+	movq	%rsi, %rax
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L536
+.L551:
+	movl	$0, 12(%rsp)
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L535:
+	movabsq	$5917806138674729738, %rax
+	movq	%rbx, %rdi
+	movq	%rax, 16(%rsp)
+	movabsq	$9095440486453792, %rax
+	movq	%rax, 22(%rsp)
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L546
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L547
+	testb	$4, %cl
+	jne	.L589
+	testl	%ecx, %ecx
+	je	.L546
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L590
+.L546:
+	movq	%rbx, %rsi
+	leaq	.LC34(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+	movl	%r14d, %esi
+	leaq	.LC39(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	12(%rsp), %esi
+	leaq	.LC40(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	$10, %edi
+	call	putchar@PLT
+.LEHE19:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L547:
+	.cfi_restore_state
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L546
+.L531:
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L530
+.L586:
+	movl	$707406378, (%rax)
+	movl	$707406378, -4(%rax,%rdx)
+	jmp	.L536
+.L587:
+	movl	$10794, %ecx
+	movw	%cx, -2(%rax,%rdx)
+	jmp	.L536
+.L585:
+	movl	$10794, %edi
+	movw	%di, -2(%rdx,%rcx)
+	jmp	.L530
+.L590:
+	movl	$10794, %eax
+	movw	%ax, -2(%rdx,%rcx)
+	jmp	.L546
+.L584:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L530
+.L589:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L546
+.L552:
+	movq	%rax, %rdi
+	movq	%rdx, %rax
+.L542:
+	subq	$1, %rax
+	jne	.L583
+	call	__cxa_begin_catch@PLT
+	leaq	.LC37(%rip), %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+.LEHB20:
+	call	printf@PLT
+.LEHE20:
+	call	__cxa_end_catch@PLT
+	leaq	.LC38(%rip), %rdi
+	addl	$1, 12(%rsp)
+.LEHB21:
+	call	puts@PLT
+	jmp	.L541
+.L544:
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+.L583:
+	call	_Unwind_Resume@PLT
+.LEHE21:
+.L553:
+	movq	%rax, %rbx
+	jmp	.L544
+	.cfi_endproc
+.LFE6752:
+	.section	.gcc_except_table
+	.align 4
+.LLSDA6752:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT6752-.LLSDATTD6752
+.LLSDATTD6752:
+	.byte	0x1
+	.uleb128 .LLSDACSE6752-.LLSDACSB6752
+.LLSDACSB6752:
+	.uleb128 .LEHB17-.LFB6752
+	.uleb128 .LEHE17-.LEHB17
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB18-.LFB6752
+	.uleb128 .LEHE18-.LEHB18
+	.uleb128 .L552-.LFB6752
+	.uleb128 0x1
+	.uleb128 .LEHB19-.LFB6752
+	.uleb128 .LEHE19-.LEHB19
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB20-.LFB6752
+	.uleb128 .LEHE20-.LEHB20
+	.uleb128 .L553-.LFB6752
+	.uleb128 0
+	.uleb128 .LEHB21-.LFB6752
+	.uleb128 .LEHE21-.LEHB21
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6752:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	DW.ref._ZTIPKc-.
+.LLSDATT6752:
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.size	_ZN1n4test10test_suite7run_allEv, .-_ZN1n4test10test_suite7run_allEv
+	.text
+	.p2align 4
+	.globl	_ZeqRKN1n6stringIcEEPKc
+	.type	_ZeqRKN1n6stringIcEEPKc, @function
+_ZeqRKN1n6stringIcEEPKc:
+.LFB6753:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	movq	%rsi, %rdi
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	call	strlen@PLT
+	cmpq	$23, 8(%rbx)
+	movq	(%rbx), %rcx
+	leaq	24(%rbx), %rdi
+	movq	%rax, %rdx
+	je	.L593
+	movq	24(%rbx), %rdi
+.L593:
+	xorl	%eax, %eax
+	cmpq	%rcx, %rdx
+	je	.L599
+.L591:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L599:
+	.cfi_restore_state
+	movl	$1, %eax
+	testq	%rdx, %rdx
+	je	.L591
+	movq	%rbp, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	sete	%al
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE6753:
+	.size	_ZeqRKN1n6stringIcEEPKc, .-_ZeqRKN1n6stringIcEEPKc
+	.section	.rodata.str1.1
+.LC41:
+	.string	"n_extract.hpp Tests"
+.LC42:
+	.string	"test_extract_char"
+.LC43:
+	.string	"test_extract_string"
+	.section	.rodata.str1.8
+	.align 8
+.LC44:
+	.string	"test_extract_unsigned_integral"
+	.section	.rodata.str1.1
+.LC45:
+	.string	"test_extract_signed_integral"
+.LC46:
+	.string	"test_extract_bool"
+.LC47:
+	.string	"test_extract_borrowed_slice"
+	.section	.rodata.str1.8
+	.align 8
+.LC48:
+	.string	"test_extract_specific_pattern1"
+	.align 8
+.LC49:
+	.string	"test_extract_specific_pattern2"
+	.align 8
+.LC50:
+	.string	"test_extract_specific_pattern3"
+	.section	.text.unlikely
+.LCOLDB52:
+	.section	.text.startup,"ax",@progbits
+.LHOTB52:
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB6802:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6802
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$1600, %edi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 64
+.LEHB22:
+	call	_Znam@PLT
+.LEHE22:
+	movq	%rax, %rbx
+	leaq	1600(%rax), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L601:
+	movq	$0, (%rax)
+	addq	$16, %rax
+	movq	$0, -8(%rax)
+	cmpq	%rax, %rdx
+	jne	.L601
+	leaq	.LC41(%rip), %rax
+	movq	%rsp, %rdi
+	movq	%rbx, (%rsp)
+	movq	%rax, 16(%rsp)
+	leaq	.LC42(%rip), %rax
+	movq	%rax, (%rbx)
+	leaq	_Z17test_extract_charv(%rip), %rax
+	movq	%rax, 8(%rbx)
+	leaq	.LC43(%rip), %rax
+	movq	%rax, 16(%rbx)
+	leaq	_Z19test_extract_stringv(%rip), %rax
+	movq	%rax, 24(%rbx)
+	leaq	.LC44(%rip), %rax
+	movq	%rax, 32(%rbx)
+	leaq	_Z30test_extract_unsigned_integralv(%rip), %rax
+	movq	%rax, 40(%rbx)
+	leaq	.LC45(%rip), %rax
+	movq	%rax, 48(%rbx)
+	leaq	_Z28test_extract_signed_integralv(%rip), %rax
+	movq	%rax, 56(%rbx)
+	leaq	.LC46(%rip), %rax
+	movq	%rax, 64(%rbx)
+	leaq	_Z17test_extract_boolv(%rip), %rax
+	movq	%rax, 72(%rbx)
+	leaq	.LC47(%rip), %rax
+	movq	%rax, 80(%rbx)
+	leaq	_Z27test_extract_borrowed_slicev(%rip), %rax
+	movq	%rax, 88(%rbx)
+	leaq	.LC48(%rip), %rax
+	movq	%rax, 96(%rbx)
+	leaq	_Z30test_extract_specific_pattern1v(%rip), %rax
+	movq	%rax, 104(%rbx)
+	leaq	.LC49(%rip), %rax
+	movq	%rax, 112(%rbx)
+	leaq	_Z30test_extract_specific_pattern2v(%rip), %rax
+	movq	%rax, 120(%rbx)
+	leaq	.LC50(%rip), %rax
+	movq	%rax, 128(%rbx)
+	leaq	_Z30test_extract_specific_pattern3v(%rip), %rax
+	movq	%rax, 136(%rbx)
+	movq	.LC51(%rip), %rax
+	movq	%rax, 8(%rsp)
+.LEHB23:
+	call	_ZN1n4test10test_suite7run_allEv
+.LEHE23:
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L603:
+	.cfi_restore_state
+	movq	%rax, %rbp
+	jmp	.L602
+	.section	.gcc_except_table
+.LLSDA6802:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6802-.LLSDACSB6802
+.LLSDACSB6802:
+	.uleb128 .LEHB22-.LFB6802
+	.uleb128 .LEHE22-.LEHB22
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB23-.LFB6802
+	.uleb128 .LEHE23-.LEHB23
+	.uleb128 .L603-.LFB6802
+	.uleb128 0
+.LLSDACSE6802:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6802
+	.type	main.cold, @function
+main.cold:
+.LFSB6802:
+.L602:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	movq	%rbp, %rdi
+.LEHB24:
+	call	_Unwind_Resume@PLT
+.LEHE24:
+	.cfi_endproc
+.LFE6802:
+	.section	.gcc_except_table
+.LLSDAC6802:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6802-.LLSDACSBC6802
+.LLSDACSBC6802:
+	.uleb128 .LEHB24-.LCOLDB52
+	.uleb128 .LEHE24-.LEHB24
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6802:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	main, .-main
+	.section	.text.unlikely
+	.size	main.cold, .-main.cold
+.LCOLDE52:
+	.section	.text.startup
+.LHOTE52:
+	.section	.text._ZN1n5maybeINS_6stringIcEEED2Ev,"axG",@progbits,_ZN1n5maybeINS_6stringIcEEED5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n5maybeINS_6stringIcEEED2Ev
+	.type	_ZN1n5maybeINS_6stringIcEEED2Ev, @function
+_ZN1n5maybeINS_6stringIcEEED2Ev:
+.LFB6828:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6828
+	cmpb	$0, 48(%rdi)
+	je	.L614
+	movq	8(%rdi), %rdx
+	cmpq	$23, %rdx
+	je	.L614
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	movq	16(%rdi), %rax
+	movq	24(%rdi), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rax), %r8
+	movq	%rax, %rdi
+	call	*24(%r8)
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L614:
+	ret
+	.cfi_endproc
+.LFE6828:
+	.section	.gcc_except_table
+.LLSDA6828:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6828-.LLSDACSB6828
+.LLSDACSB6828:
+.LLSDACSE6828:
+	.section	.text._ZN1n5maybeINS_6stringIcEEED2Ev,"axG",@progbits,_ZN1n5maybeINS_6stringIcEEED5Ev,comdat
+	.size	_ZN1n5maybeINS_6stringIcEEED2Ev, .-_ZN1n5maybeINS_6stringIcEEED2Ev
+	.weak	_ZN1n5maybeINS_6stringIcEEED1Ev
+	.set	_ZN1n5maybeINS_6stringIcEEED1Ev,_ZN1n5maybeINS_6stringIcEEED2Ev
+	.section	.rodata.str1.1
+.LC53:
+	.string	"\"input\""
+.LC54:
+	.string	"expected true : ms.has()"
+	.section	.rodata.str1.8
+	.align 8
+.LC55:
+	.string	"expected equal : expected value : ms.get(), actual value : \"input\""
+	.section	.text.unlikely
+.LCOLDB57:
+	.text
+.LHOTB57:
+	.p2align 4
+	.globl	_Z19test_extract_stringv
+	.type	_Z19test_extract_stringv, @function
+_Z19test_extract_stringv:
+.LFB6761:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6761
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$184, %rsp
+	.cfi_def_cfa_offset 240
+	movdqa	.LC1(%rip), %xmm1
+	movb	$0, 160(%rsp)
+	movaps	%xmm1, 16(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L618
+	pxor	%xmm0, %xmm0
+	leaq	40(%rsp), %rbx
+	movq	%rax, 32(%rsp)
+	xorl	%ebp, %ebp
+	leaq	.LC53(%rip), %rsi
+	movups	%xmm0, 40(%rsp)
+	movq	$0, 56(%rsp)
+	cmpq	%rbx, %rsi
+	jb	.L619
+.L730:
+	leaq	.LC53(%rip), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L619:
+	movl	$7, %edx
+	leaq	(%rbx,%rbp), %rdi
+	call	memmove@PLT
+	movq	16(%rsp), %rax
+	leaq	7(%rax), %rdx
+	movq	%rdx, 16(%rsp)
+	movb	$0, 7(%rbx,%rax)
+	movq	24(%rsp), %r12
+	movq	16(%rsp), %rax
+	cmpq	$23, %r12
+	je	.L632
+	movq	40(%rsp), %rsi
+	movq	%rsi, %rbx
+	testq	%rax, %rax
+	je	.L633
+	cmpq	$1, %rax
+	je	.L633
+	cmpb	$34, (%rsi)
+	je	.L636
+	.p2align 4,,10
+	.p2align 3
+.L633:
+	movzbl	160(%rsp), %ebx
+.L674:
+	movq	32(%rsp), %rdi
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L637:
+	testb	%bl, %bl
+	je	.L729
+.L663:
+	movq	120(%rsp), %rdx
+	movq	112(%rsp), %rax
+	leaq	136(%rsp), %rcx
+	cmpq	$23, %rdx
+	je	.L664
+	movq	136(%rsp), %rcx
+.L664:
+	cmpq	$5, %rax
+	jne	.L665
+	cmpl	$1970302569, (%rcx)
+	jne	.L665
+	cmpb	$116, 4(%rcx)
+	jne	.L665
+	cmpq	$23, %rdx
+	je	.L617
+	movq	128(%rsp), %rdi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	136(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L617:
+	addq	$184, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L632:
+	.cfi_restore_state
+	testq	%rax, %rax
+	je	.L675
+	cmpq	$1, %rax
+	je	.L675
+	cmpb	$34, 40(%rsp)
+	jne	.L675
+	leaq	40(%rsp), %rbx
+.L636:
+	addq	$1, %rbx
+	leaq	-1(%rax), %rdx
+	movl	$34, %esi
+	movq	%rbx, %rdi
+	call	memchr@PLT
+	movq	%rax, %rbp
+	testq	%rax, %rax
+	je	.L733
+	subq	%rbx, %rbp
+	cmpq	$-1, %rbp
+	je	.L733
+	cmpq	$-2, %rbp
+	je	.L733
+	movdqa	.LC1(%rip), %xmm2
+	movaps	%xmm2, 64(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r13
+	testq	%r13, %r13
+	je	.L642
+	pxor	%xmm0, %xmm0
+	leaq	88(%rsp), %rax
+	movq	%rbp, %rdx
+	xorl	%r15d, %r15d
+	movq	%r13, 80(%rsp)
+	movq	$0, 104(%rsp)
+	movups	%xmm0, 88(%rsp)
+	cmpq	%rax, %rbx
+	jnb	.L686
+.L644:
+	cmpq	$23, %rdx
+	jbe	.L692
+	movq	%rax, (%rsp)
+	movl	$23, %r14d
+.L673:
+	leaq	10(%r14,%r14), %rax
+	movq	%r13, %rdi
+	cmpq	%rdx, %rax
+	cmovnb	%rax, %rdx
+	movq	0(%r13), %rax
+	movq	%rdx, 8(%rsp)
+	leaq	1(%rdx), %rsi
+	movl	$1, %edx
+.LEHB25:
+	call	*16(%rax)
+	movq	(%rsp), %rsi
+	leaq	1(%r15), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %r12
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L651
+	movq	0(%r13), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r13, %rdi
+	call	*24(%rax)
+.LEHE25:
+.L651:
+	movq	8(%rsp), %rax
+	movq	%r12, 88(%rsp)
+	movq	%rax, 72(%rsp)
+.L650:
+	cmpq	$23, 8(%rsp)
+	je	.L735
+.L655:
+	movq	%rbp, %rdx
+	leaq	(%r12,%r15), %rdi
+	movq	%rbx, %rsi
+	call	memmove@PLT
+	addq	64(%rsp), %rbp
+	cmpb	$0, 160(%rsp)
+	movq	%rbp, 64(%rsp)
+	movb	$0, (%r12,%rbp)
+	je	.L657
+	movq	120(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L657
+	movq	128(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	136(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L657:
+	movdqa	.LC1(%rip), %xmm3
+	movaps	%xmm3, 112(%rsp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L736
+.L659:
+	movq	80(%rsp), %rax
+	movdqa	64(%rsp), %xmm4
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 144(%rsp)
+	movq	%rax, 128(%rsp)
+	movq	72(%rsp), %rax
+	movaps	%xmm4, 112(%rsp)
+	cmpq	$23, %rax
+	je	.L737
+	movq	88(%rsp), %rax
+	movq	%rax, 136(%rsp)
+.L662:
+	movq	24(%rsp), %r12
+	movb	$1, 160(%rsp)
+	movl	$1, %ebx
+	cmpq	$23, %r12
+	jne	.L734
+	jmp	.L663
+	.p2align 4,,10
+	.p2align 3
+.L675:
+	movzbl	160(%rsp), %ebx
+	jmp	.L637
+	.p2align 4,,10
+	.p2align 3
+.L618:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L738
+.L623:
+	movq	_ZZN1n4heapEvE3res(%rip), %r14
+	movq	16(%rsp), %rbp
+	pxor	%xmm0, %xmm0
+	xorl	%r15d, %r15d
+	movq	24(%rsp), %r13
+	movups	%xmm0, 40(%rsp)
+	leaq	.LC53(%rip), %rsi
+	movq	%r14, 32(%rsp)
+	leaq	7(%rbp), %r12
+	movq	$0, 56(%rsp)
+	cmpq	$23, %r13
+	je	.L739
+.L625:
+	leaq	(%r15,%rbp), %rax
+	cmpq	%rax, %rsi
+	jnb	.L740
+	subq	%r15, %rsi
+	movq	%rsi, (%rsp)
+	cmpq	%r12, %r13
+	jnb	.L683
+	leaq	10(%r13,%r13), %rax
+	movl	$1, %edx
+	movq	%r14, %rdi
+	cmpq	%r12, %rax
+	cmovnb	%rax, %r12
+	movq	(%r14), %rax
+	leaq	1(%r12), %rsi
+.LEHB26:
+	call	*16(%rax)
+	leaq	1(%rbp), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L629
+	movq	(%r14), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L629:
+	movq	%rbx, 40(%rsp)
+	movq	%r12, %r13
+	movq	%r12, 24(%rsp)
+.L628:
+	cmpq	$23, %r13
+	jne	.L732
+	leaq	40(%rsp), %rbx
+.L732:
+	movq	(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L619
+.L740:
+	cmpq	%r12, %r13
+	jnb	.L682
+.L677:
+	leaq	10(%r13,%r13), %rax
+	movl	$1, %edx
+	movq	%r14, %rdi
+	cmpq	%r12, %rax
+	cmovnb	%rax, %r12
+	movq	(%r14), %rax
+	leaq	1(%r12), %rsi
+	call	*16(%rax)
+	leaq	1(%rbp), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L627
+	movq	(%r14), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.LEHE26:
+.L627:
+	movq	%rbx, 40(%rsp)
+	movq	%r12, 24(%rsp)
+.L621:
+	leaq	.LC53(%rip), %rsi
+	cmpq	$23, %r12
+	jne	.L619
+	leaq	40(%rsp), %rbx
+	jmp	.L730
+.L733:
+	movzbl	160(%rsp), %ebx
+	cmpq	$23, %r12
+	je	.L637
+.L734:
+	movq	40(%rsp), %rsi
+	jmp	.L674
+.L738:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L623
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L623
+.L642:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L741
+.L646:
+	movq	_ZZN1n4heapEvE3res(%rip), %r12
+	movq	64(%rsp), %r15
+	pxor	%xmm0, %xmm0
+	movq	$0, 104(%rsp)
+	movq	72(%rsp), %r14
+	movq	$0, (%rsp)
+	movq	%r12, 80(%rsp)
+	leaq	(%r15,%rbp), %rdx
+	movups	%xmm0, 88(%rsp)
+	cmpq	$23, %r14
+	je	.L742
+.L648:
+	movq	(%rsp), %rax
+	addq	%r15, %rax
+	cmpq	%rax, %rbx
+	jnb	.L743
+	movq	(%rsp), %rax
+	subq	%rax, %rbx
+	movq	%rbx, 8(%rsp)
+	cmpq	%rdx, %r14
+	jnb	.L652
+	leaq	10(%r14,%r14), %rax
+	movq	%rdx, %rbx
+	movq	%r12, %rdi
+	cmpq	%rdx, %rax
+	movl	$1, %edx
+	cmovnb	%rax, %rbx
+	movq	(%r12), %rax
+	leaq	1(%rbx), %rsi
+.LEHB27:
+	call	*16(%rax)
+	movq	(%rsp), %rsi
+	leaq	1(%r15), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %r13
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L653
+	movq	(%r12), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r12, %rdi
+	call	*24(%rax)
+.LEHE27:
+.L653:
+	movq	%r13, 88(%rsp)
+	movq	%rbx, %r14
+	movq	%rbx, 72(%rsp)
+.L652:
+	cmpq	$23, %r14
+	je	.L654
+	movq	8(%rsp), %rbx
+	movq	%r13, %r12
+	addq	%r13, %rbx
+	jmp	.L655
+.L682:
+	xorl	%ebx, %ebx
+	movq	%r13, %r12
+	jmp	.L621
+.L735:
+	leaq	88(%rsp), %rax
+.L692:
+	movq	%rax, %r12
+	jmp	.L655
+.L737:
+	movdqu	88(%rsp), %xmm5
+	movq	104(%rsp), %rax
+	movups	%xmm5, 136(%rsp)
+	movq	%rax, 152(%rsp)
+	jmp	.L662
+.L743:
+	movq	%r12, %r13
+.L643:
+	cmpq	%rdx, %r14
+	jb	.L673
+	movq	%r14, 8(%rsp)
+	xorl	%r12d, %r12d
+	jmp	.L650
+.L736:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L659
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L659
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L659
+.L686:
+	movq	%rax, (%rsp)
+	movl	$23, %r14d
+	jmp	.L643
+.L654:
+	movq	8(%rsp), %rbx
+	leaq	88(%rsp), %rax
+	addq	%rax, %rbx
+	jmp	.L692
+.L741:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L646
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L646
+.L742:
+	leaq	88(%rsp), %rax
+	cmpq	%rax, %rbx
+	jnb	.L744
+	movq	%r12, %r13
+	jmp	.L644
+.L739:
+	leaq	40(%rsp), %rbx
+	cmpq	%rbx, %rsi
+	jnb	.L745
+	cmpq	$23, %r12
+	jbe	.L619
+	movq	%rbx, %r15
+	jmp	.L677
+.L683:
+	xorl	%ebx, %ebx
+	jmp	.L628
+.L744:
+	movq	%rax, (%rsp)
+	jmp	.L648
+.L745:
+	movq	%rbx, %r15
+	jmp	.L625
+.L694:
+	movq	%rax, %rbx
+	jmp	.L670
+.L727:
+	jmp	.L728
+	.section	.gcc_except_table
+.LLSDA6761:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6761-.LLSDACSB6761
+.LLSDACSB6761:
+	.uleb128 .LEHB25-.LFB6761
+	.uleb128 .LEHE25-.LEHB25
+	.uleb128 .L694-.LFB6761
+	.uleb128 0
+	.uleb128 .LEHB26-.LFB6761
+	.uleb128 .LEHE26-.LEHB26
+	.uleb128 .L727-.LFB6761
+	.uleb128 0
+	.uleb128 .LEHB27-.LFB6761
+	.uleb128 .LEHE27-.LEHB27
+	.uleb128 .L694-.LFB6761
+	.uleb128 0
+.LLSDACSE6761:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6761
+	.type	_Z19test_extract_stringv.cold, @function
+_Z19test_extract_stringv.cold:
+.LFSB6761:
+.L665:
+	.cfi_def_cfa_offset 240
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC55(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB28:
+	call	__cxa_throw@PLT
+.L729:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC54(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE28:
+.L695:
+.L728:
+	movq	%rax, %rbx
+.L672:
+	leaq	112(%rsp), %rdi
+	call	_ZN1n5maybeINS_6stringIcEEED1Ev
+	movq	%rbx, %rdi
+.LEHB29:
+	call	_Unwind_Resume@PLT
+.LEHE29:
+.L670:
+	movq	24(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L672
+	movq	32(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	40(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L672
+	.cfi_endproc
+.LFE6761:
+	.section	.gcc_except_table
+.LLSDAC6761:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6761-.LLSDACSBC6761
+.LLSDACSBC6761:
+	.uleb128 .LEHB28-.LCOLDB57
+	.uleb128 .LEHE28-.LEHB28
+	.uleb128 .L695-.LCOLDB57
+	.uleb128 0
+	.uleb128 .LEHB29-.LCOLDB57
+	.uleb128 .LEHE29-.LEHB29
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6761:
+	.section	.text.unlikely
+	.text
+	.size	_Z19test_extract_stringv, .-_Z19test_extract_stringv
+	.section	.text.unlikely
+	.size	_Z19test_extract_stringv.cold, .-_Z19test_extract_stringv.cold
+.LCOLDE57:
+	.text
+.LHOTE57:
+	.section	.rodata.str1.1
+.LC58:
+	.string	"j'ai 12 ans et \"demi\"!"
+.LC59:
+	.string	"j'ai $ ans et $!"
+.LC60:
+	.string	"expected true : s.has()"
+	.section	.rodata.str1.8
+	.align 8
+.LC61:
+	.string	"expected equal : expected value : s.get(), actual value : \"demi\""
+	.section	.text.unlikely
+.LCOLDB62:
+	.text
+.LHOTB62:
+	.p2align 4
+	.globl	_Z30test_extract_specific_pattern2v
+	.type	_Z30test_extract_specific_pattern2v, @function
+_Z30test_extract_specific_pattern2v:
+.LFB6800:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6800
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$200, %rsp
+	.cfi_def_cfa_offset 256
+	movdqa	.LC1(%rip), %xmm1
+	movb	$0, 176(%rsp)
+	movaps	%xmm1, 32(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L747
+	pxor	%xmm0, %xmm0
+	leaq	56(%rsp), %rbx
+	movq	%rax, 48(%rsp)
+	xorl	%ebp, %ebp
+	leaq	.LC58(%rip), %rsi
+	movups	%xmm0, 56(%rsp)
+	movq	$0, 72(%rsp)
+	cmpq	%rbx, %rsi
+	jb	.L748
+.L888:
+	leaq	.LC58(%rip), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L748:
+	movl	$22, %edx
+	leaq	(%rbx,%rbp), %rdi
+	call	memmove@PLT
+	movq	32(%rsp), %rax
+	leaq	22(%rax), %rdx
+	movq	%rdx, 32(%rsp)
+	movb	$0, 22(%rbx,%rax)
+	movq	40(%rsp), %r13
+	movq	32(%rsp), %rcx
+	cmpq	$23, %r13
+	je	.L761
+	movq	56(%rsp), %rsi
+	movq	%rsi, %rbx
+	testq	%rcx, %rcx
+	je	.L892
+.L814:
+	addq	%rbx, %rcx
+	leaq	.LC59(%rip), %rax
+	jmp	.L763
+	.p2align 4,,10
+	.p2align 3
+.L893:
+	addq	$1, %rax
+	cmpb	$36, %dl
+	je	.L765
+	addq	$1, %rbx
+	cmpq	%rcx, %rbx
+	je	.L764
+.L763:
+	movzbl	(%rax), %edx
+	testb	%dl, %dl
+	jne	.L893
+.L765:
+	subq	%rbx, %rcx
+	je	.L764
+	movzbl	(%rbx), %esi
+	leaq	-1(%rcx), %rdi
+	cmpb	$45, %sil
+	je	.L894
+	cmpb	$43, %sil
+	je	.L770
+	leaq	1(%rbx), %r10
+	movl	$1, %edx
+	xorl	%r9d, %r9d
+.L769:
+	subl	$48, %esi
+	cmpb	$9, %sil
+	ja	.L826
+	movsbl	%sil, %r14d
+	testq	%rdi, %rdi
+	je	.L771
+	addq	%rdx, %rdi
+	subq	%rdx, %r10
+	jmp	.L772
+	.p2align 4,,10
+	.p2align 3
+.L895:
+	leal	(%r14,%r14,4), %r8d
+	addq	$1, %rdx
+	leal	-48(%rsi,%r8,2), %r14d
+	cmpq	%rdi, %rdx
+	je	.L771
+.L772:
+	movsbl	(%r10,%rdx), %esi
+	leal	-48(%rsi), %r8d
+	cmpb	$9, %r8b
+	jbe	.L895
+.L771:
+	movl	%r14d, %esi
+	negl	%esi
+	testb	%r9b, %r9b
+	cmovne	%esi, %r14d
+	cmpq	%rcx, %rdx
+	cmova	%rcx, %rdx
+	addq	%rdx, %rbx
+	subq	%rdx, %rcx
+	je	.L774
+	movl	$1, %ebp
+.L768:
+	addq	%rbx, %rcx
+	jmp	.L775
+	.p2align 4,,10
+	.p2align 3
+.L896:
+	cmpb	$36, %dl
+	je	.L779
+	addq	$1, %rbx
+	addq	$1, %rax
+	cmpq	%rcx, %rbx
+	je	.L778
+.L775:
+	movzbl	(%rax), %edx
+	testb	%dl, %dl
+	jne	.L896
+.L779:
+	subq	%rbx, %rcx
+	cmpq	$1, %rcx
+	jbe	.L778
+	cmpb	$34, (%rbx)
+	jne	.L778
+	addq	$1, %rbx
+	leaq	-1(%rcx), %rdx
+	movl	$34, %esi
+	movq	%rbx, %rdi
+	call	memchr@PLT
+	movq	%rax, %r12
+	testq	%rax, %rax
+	je	.L778
+	subq	%rbx, %r12
+	cmpq	$-3, %r12
+	ja	.L778
+	movdqa	.LC1(%rip), %xmm2
+	movaps	%xmm2, 80(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r15
+	testq	%r15, %r15
+	je	.L781
+	pxor	%xmm0, %xmm0
+	leaq	104(%rsp), %rax
+	movq	%r12, %rdx
+	movq	%r15, 96(%rsp)
+	movq	$0, 120(%rsp)
+	movups	%xmm0, 104(%rsp)
+	cmpq	%rax, %rbx
+	jnb	.L830
+	movq	$0, 8(%rsp)
+.L783:
+	cmpq	$23, %rdx
+	jbe	.L834
+	movq	$23, (%rsp)
+	movq	%rax, 16(%rsp)
+.L812:
+	movq	(%rsp), %rax
+	movq	%r15, %rdi
+	leaq	10(%rax,%rax), %rax
+	cmpq	%rdx, %rax
+	cmovnb	%rax, %rdx
+	movq	(%r15), %rax
+	movq	%rdx, 24(%rsp)
+	leaq	1(%rdx), %rsi
+	movl	$1, %edx
+.LEHB30:
+	call	*16(%rax)
+	movq	8(%rsp), %rdi
+	movq	16(%rsp), %rsi
+	movq	%rax, %r13
+	leaq	1(%rdi), %rdx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L790
+	addq	$1, %rax
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	movq	%rax, %rdx
+	movq	(%r15), %rax
+	call	*24(%rax)
+.LEHE30:
+.L790:
+	movq	24(%rsp), %rax
+	movq	%r13, 104(%rsp)
+	movq	%rax, 88(%rsp)
+.L789:
+	cmpq	$23, 24(%rsp)
+	je	.L897
+.L794:
+	movq	8(%rsp), %rdi
+	movq	%r12, %rdx
+	movq	%rbx, %rsi
+	addq	%r13, %rdi
+	call	memmove@PLT
+	addq	80(%rsp), %r12
+	cmpb	$0, 176(%rsp)
+	movq	%r12, 80(%rsp)
+	movb	$0, 0(%r13,%r12)
+	je	.L796
+	movq	136(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L796
+	movq	144(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	152(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L796:
+	movdqa	.LC1(%rip), %xmm3
+	movaps	%xmm3, 128(%rsp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L898
+.L798:
+	movq	96(%rsp), %rax
+	movdqa	80(%rsp), %xmm4
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 160(%rsp)
+	movq	%rax, 144(%rsp)
+	movq	88(%rsp), %rax
+	movaps	%xmm4, 128(%rsp)
+	cmpq	$23, %rax
+	je	.L899
+	movq	104(%rsp), %rax
+	movq	%rax, 152(%rsp)
+.L801:
+	movb	$1, 176(%rsp)
+	movq	40(%rsp), %r13
+	.p2align 4,,10
+	.p2align 3
+.L778:
+	cmpq	$23, %r13
+	je	.L802
+.L891:
+	movq	56(%rsp), %rsi
+.L762:
+	movq	48(%rsp), %rdi
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L802:
+	testb	%bpl, %bpl
+	je	.L776
+.L777:
+	cmpl	$12, %r14d
+	jne	.L886
+	cmpb	$0, 176(%rsp)
+	je	.L887
+	movq	136(%rsp), %rdx
+	movq	128(%rsp), %rax
+	cmpq	$23, %rdx
+	je	.L805
+	cmpq	$4, %rax
+	jne	.L806
+	movq	152(%rsp), %rsi
+	cmpl	$1768777060, (%rsi)
+	jne	.L806
+	movq	144(%rsp), %rdi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L746:
+	addq	$200, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L761:
+	.cfi_restore_state
+	testq	%rcx, %rcx
+	je	.L900
+	leaq	56(%rsp), %rbx
+	jmp	.L814
+	.p2align 4,,10
+	.p2align 3
+.L805:
+	cmpq	$4, %rax
+	jne	.L806
+	cmpl	$1768777060, 152(%rsp)
+	jne	.L806
+	jmp	.L746
+	.p2align 4,,10
+	.p2align 3
+.L747:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L901
+.L752:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	32(%rsp), %rbp
+	pxor	%xmm0, %xmm0
+	movq	$0, 72(%rsp)
+	movq	40(%rsp), %r13
+	movq	$0, (%rsp)
+	leaq	.LC58(%rip), %rsi
+	movq	%r15, 48(%rsp)
+	leaq	22(%rbp), %r12
+	movups	%xmm0, 56(%rsp)
+	cmpq	$23, %r13
+	je	.L902
+.L754:
+	movq	(%rsp), %rax
+	addq	%rbp, %rax
+	cmpq	%rax, %rsi
+	jnb	.L903
+	movq	(%rsp), %rax
+	movq	%rsi, %rdi
+	subq	%rax, %rdi
+	movq	%rdi, 8(%rsp)
+	cmpq	%r12, %r13
+	jnb	.L821
+	leaq	10(%r13,%r13), %rax
+	movl	$1, %edx
+	movq	%r15, %rdi
+	cmpq	%r12, %rax
+	cmovnb	%rax, %r12
+	movq	(%r15), %rax
+	leaq	1(%r12), %rsi
+.LEHB31:
+	call	*16(%rax)
+	movq	(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L758
+	movq	(%r15), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L758:
+	movq	%rbx, 56(%rsp)
+	movq	%r12, %r13
+	movq	%r12, 40(%rsp)
+.L757:
+	cmpq	$23, %r13
+	jne	.L890
+	leaq	56(%rsp), %rbx
+.L890:
+	movq	8(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L748
+.L903:
+	cmpq	%r12, %r13
+	jnb	.L820
+.L813:
+	leaq	10(%r13,%r13), %rax
+	movl	$1, %edx
+	movq	%r15, %rdi
+	cmpq	%r12, %rax
+	cmovnb	%rax, %r12
+	movq	(%r15), %rax
+	leaq	1(%r12), %rsi
+	call	*16(%rax)
+	movq	(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L756
+	movq	(%r15), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.LEHE31:
+.L756:
+	movq	%rbx, 56(%rsp)
+	movq	%r12, 40(%rsp)
+.L750:
+	leaq	.LC58(%rip), %rsi
+	cmpq	$23, %r12
+	jne	.L748
+	leaq	56(%rsp), %rbx
+	jmp	.L888
+.L901:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L752
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L752
+.L826:
+	xorl	%ebp, %ebp
+	jmp	.L768
+	.p2align 4,,10
+	.p2align 3
+.L894:
+	testq	%rdi, %rdi
+	je	.L825
+	movzbl	1(%rbx), %esi
+	leaq	-2(%rcx), %rdi
+	leaq	2(%rbx), %r10
+	movl	$2, %edx
+	movl	$1, %r9d
+	jmp	.L769
+	.p2align 4,,10
+	.p2align 3
+.L764:
+	cmpq	$23, %r13
+	je	.L904
+	movq	56(%rsp), %rsi
+	xorl	%ebp, %ebp
+	jmp	.L762
+.L770:
+	testq	%rdi, %rdi
+	je	.L825
+	movzbl	1(%rbx), %esi
+	leaq	-2(%rcx), %rdi
+	leaq	2(%rbx), %r10
+	xorl	%r9d, %r9d
+	movl	$2, %edx
+	jmp	.L769
+.L825:
+	xorl	%ebp, %ebp
+	movl	$1, %ecx
+	jmp	.L768
+.L830:
+	movq	%rax, 16(%rsp)
+	movq	$0, 8(%rsp)
+	movq	$23, (%rsp)
+.L782:
+	cmpq	%rdx, (%rsp)
+	jb	.L812
+	movq	(%rsp), %rax
+	xorl	%r13d, %r13d
+	movq	%rax, 24(%rsp)
+	jmp	.L789
+.L820:
+	xorl	%ebx, %ebx
+	movq	%r13, %r12
+	jmp	.L750
+.L897:
+	leaq	104(%rsp), %rax
+.L834:
+	movq	%rax, %r13
+	jmp	.L794
+.L904:
+	jmp	.L776
+.L899:
+	movdqu	104(%rsp), %xmm5
+	movq	120(%rsp), %rax
+	movups	%xmm5, 152(%rsp)
+	movq	%rax, 168(%rsp)
+	jmp	.L801
+.L781:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L905
+.L785:
+	movq	80(%rsp), %rdi
+	movq	_ZZN1n4heapEvE3res(%rip), %r13
+	pxor	%xmm0, %xmm0
+	movq	$0, 120(%rsp)
+	movq	88(%rsp), %rax
+	movups	%xmm0, 104(%rsp)
+	movq	%rdi, 8(%rsp)
+	leaq	(%r12,%rdi), %rdx
+	movq	%rax, (%rsp)
+	movq	%r13, 96(%rsp)
+	movq	$0, 16(%rsp)
+	cmpq	$23, %rax
+	je	.L906
+.L787:
+	movq	16(%rsp), %rax
+	movq	8(%rsp), %rdi
+	addq	%rdi, %rax
+	cmpq	%rax, %rbx
+	jnb	.L907
+	movq	16(%rsp), %rax
+	subq	%rax, %rbx
+	movq	(%rsp), %rax
+	movq	%rbx, 24(%rsp)
+	cmpq	%rdx, %rax
+	jnb	.L791
+	leaq	10(%rax,%rax), %rax
+	movq	%rdx, %rbx
+	movq	%r13, %rdi
+	cmpq	%rdx, %rax
+	movl	$1, %edx
+	cmovnb	%rax, %rbx
+	movq	0(%r13), %rax
+	leaq	1(%rbx), %rsi
+.LEHB32:
+	call	*16(%rax)
+	movq	8(%rsp), %rdi
+	movq	16(%rsp), %rsi
+	movq	%rax, %r15
+	leaq	1(%rdi), %rdx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L792
+	addq	$1, %rax
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r13, %rdi
+	movq	%rax, %rdx
+	movq	0(%r13), %rax
+	call	*24(%rax)
+.LEHE32:
+.L792:
+	movq	%r15, 104(%rsp)
+	movq	%rbx, 88(%rsp)
+	movq	%rbx, (%rsp)
+.L791:
+	cmpq	$23, (%rsp)
+	je	.L793
+	movq	24(%rsp), %rbx
+	movq	%r15, %r13
+	addq	%r15, %rbx
+	jmp	.L794
+.L907:
+	movq	%r13, %r15
+	jmp	.L782
+.L898:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L798
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L798
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L798
+.L793:
+	movq	24(%rsp), %rbx
+	leaq	104(%rsp), %rax
+	addq	%rax, %rbx
+	jmp	.L834
+.L905:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L785
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r13, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L785
+.L774:
+	movl	$1, %ebp
+	cmpq	$23, %r13
+	jne	.L891
+	jmp	.L777
+.L906:
+	leaq	104(%rsp), %rax
+	cmpq	%rax, %rbx
+	jnb	.L908
+	movq	%r13, %r15
+	jmp	.L783
+.L892:
+	xorl	%ebp, %ebp
+	jmp	.L762
+.L900:
+	jmp	.L776
+	.p2align 4,,10
+	.p2align 3
+.L821:
+	xorl	%ebx, %ebx
+	jmp	.L757
+.L902:
+	leaq	56(%rsp), %rbx
+	cmpq	%rbx, %rsi
+	jnb	.L909
+	cmpq	$23, %r12
+	jbe	.L748
+	movq	%rbx, (%rsp)
+	jmp	.L813
+.L908:
+	movq	%rax, 16(%rsp)
+	jmp	.L787
+.L909:
+	movq	%rbx, (%rsp)
+	jmp	.L754
+.L837:
+	movq	%rax, %rbx
+	jmp	.L809
+.L884:
+	jmp	.L885
+	.section	.gcc_except_table
+.LLSDA6800:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6800-.LLSDACSB6800
+.LLSDACSB6800:
+	.uleb128 .LEHB30-.LFB6800
+	.uleb128 .LEHE30-.LEHB30
+	.uleb128 .L837-.LFB6800
+	.uleb128 0
+	.uleb128 .LEHB31-.LFB6800
+	.uleb128 .LEHE31-.LEHB31
+	.uleb128 .L884-.LFB6800
+	.uleb128 0
+	.uleb128 .LEHB32-.LFB6800
+	.uleb128 .LEHE32-.LEHB32
+	.uleb128 .L837-.LFB6800
+	.uleb128 0
+.LLSDACSE6800:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6800
+	.type	_Z30test_extract_specific_pattern2v.cold, @function
+_Z30test_extract_specific_pattern2v.cold:
+.LFSB6800:
+.L806:
+	.cfi_def_cfa_offset 256
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC61(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB33:
+	call	__cxa_throw@PLT
+.LEHE33:
+.L838:
+.L885:
+	movq	%rax, %rbx
+.L811:
+	leaq	128(%rsp), %rdi
+	call	_ZN1n5maybeINS_6stringIcEEED1Ev
+	movq	%rbx, %rdi
+.LEHB34:
+	call	_Unwind_Resume@PLT
+.LEHE34:
+.L809:
+	movq	40(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L811
+	movq	48(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	56(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L811
+.L776:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC12(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB35:
+	call	__cxa_throw@PLT
+.L887:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC60(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L886:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC13(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE35:
+	.cfi_endproc
+.LFE6800:
+	.section	.gcc_except_table
+.LLSDAC6800:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6800-.LLSDACSBC6800
+.LLSDACSBC6800:
+	.uleb128 .LEHB33-.LCOLDB62
+	.uleb128 .LEHE33-.LEHB33
+	.uleb128 .L838-.LCOLDB62
+	.uleb128 0
+	.uleb128 .LEHB34-.LCOLDB62
+	.uleb128 .LEHE34-.LEHB34
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB35-.LCOLDB62
+	.uleb128 .LEHE35-.LEHB35
+	.uleb128 .L838-.LCOLDB62
+	.uleb128 0
+.LLSDACSEC6800:
+	.section	.text.unlikely
+	.text
+	.size	_Z30test_extract_specific_pattern2v, .-_Z30test_extract_specific_pattern2v
+	.section	.text.unlikely
+	.size	_Z30test_extract_specific_pattern2v.cold, .-_Z30test_extract_specific_pattern2v.cold
+.LCOLDE62:
+	.text
+.LHOTE62:
+	.section	.rodata.str1.8
+	.align 8
+.LC63:
+	.string	"j'ai 12 ans, je m'appelle \"Bob\" !!"
+	.section	.rodata.str1.1
+.LC64:
+	.string	"j'ai $ ans, je m'appelle $ !!"
+	.section	.rodata.str1.8
+	.align 8
+.LC65:
+	.string	"expected equal : expected value : name.get(), actual value : \"Bob\""
+	.section	.text.unlikely
+.LCOLDB66:
+	.text
+.LHOTB66:
+	.p2align 4
+	.globl	_Z30test_extract_specific_pattern3v
+	.type	_Z30test_extract_specific_pattern3v, @function
+_Z30test_extract_specific_pattern3v:
+.LFB6801:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6801
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$200, %rsp
+	.cfi_def_cfa_offset 256
+	movdqa	.LC1(%rip), %xmm1
+	movb	$0, 176(%rsp)
+	movaps	%xmm1, 32(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbp
+	testq	%rbp, %rbp
+	je	.L911
+	leaq	56(%rsp), %rdi
+	movq	%rbp, 48(%rsp)
+	pxor	%xmm0, %xmm0
+	xorl	%r13d, %r13d
+	movq	%rdi, (%rsp)
+	movl	$34, %eax
+	movl	$23, %r14d
+	movq	$0, 72(%rsp)
+	movups	%xmm0, 56(%rsp)
+.L912:
+	leaq	10(%r14,%r14), %r12
+	movl	$1, %edx
+	movq	%rbp, %rdi
+	cmpq	%rax, %r12
+	cmovb	%rax, %r12
+	movq	0(%rbp), %rax
+	leaq	1(%r12), %rsi
+.LEHB36:
+	call	*16(%rax)
+	movq	(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L920
+	movq	0(%rbp), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%rbp, %rdi
+	call	*24(%rax)
+.LEHE36:
+.L920:
+	movq	%rbx, 56(%rsp)
+	movq	%r12, 40(%rsp)
+.L919:
+	leaq	.LC63(%rip), %rsi
+	cmpq	$23, %r12
+	je	.L1059
+.L924:
+	leaq	(%rbx,%r13), %rdi
+	movl	$34, %edx
+	call	memmove@PLT
+	movq	32(%rsp), %rax
+	leaq	34(%rax), %rdx
+	movq	%rdx, 32(%rsp)
+	movb	$0, 34(%rbx,%rax)
+	movq	40(%rsp), %r13
+	movq	32(%rsp), %rcx
+	cmpq	$23, %r13
+	je	.L926
+	movq	56(%rsp), %rsi
+	movq	%rsi, %rbx
+	testq	%rcx, %rcx
+	je	.L1060
+.L980:
+	addq	%rbx, %rcx
+	leaq	.LC64(%rip), %rax
+	jmp	.L928
+	.p2align 4,,10
+	.p2align 3
+.L1061:
+	addq	$1, %rax
+	cmpb	$36, %dl
+	je	.L930
+	addq	$1, %rbx
+	cmpq	%rcx, %rbx
+	je	.L929
+.L928:
+	movzbl	(%rax), %edx
+	testb	%dl, %dl
+	jne	.L1061
+.L930:
+	subq	%rbx, %rcx
+	jne	.L1062
+.L929:
+	cmpq	$23, %r13
+	je	.L1063
+	movq	56(%rsp), %rsi
+	xorl	%ebp, %ebp
+	jmp	.L927
+	.p2align 4,,10
+	.p2align 3
+.L926:
+	testq	%rcx, %rcx
+	je	.L1064
+	leaq	56(%rsp), %rbx
+	jmp	.L980
+	.p2align 4,,10
+	.p2align 3
+.L1062:
+	movzbl	(%rbx), %esi
+	leaq	-1(%rcx), %rdi
+	cmpb	$45, %sil
+	je	.L1065
+	cmpb	$43, %sil
+	je	.L935
+	leaq	1(%rbx), %r10
+	movl	$1, %edx
+	xorl	%r9d, %r9d
+.L934:
+	subl	$48, %esi
+	cmpb	$9, %sil
+	ja	.L992
+	movsbl	%sil, %r15d
+	testq	%rdi, %rdi
+	je	.L936
+	addq	%rdx, %rdi
+	subq	%rdx, %r10
+	jmp	.L937
+	.p2align 4,,10
+	.p2align 3
+.L1066:
+	leal	(%r15,%r15,4), %r8d
+	addq	$1, %rdx
+	leal	-48(%rsi,%r8,2), %r15d
+	cmpq	%rdi, %rdx
+	je	.L936
+.L937:
+	movsbl	(%r10,%rdx), %esi
+	leal	-48(%rsi), %r8d
+	cmpb	$9, %r8b
+	jbe	.L1066
+.L936:
+	movl	%r15d, %esi
+	negl	%esi
+	testb	%r9b, %r9b
+	cmovne	%esi, %r15d
+	cmpq	%rcx, %rdx
+	cmova	%rcx, %rdx
+	addq	%rdx, %rbx
+	subq	%rdx, %rcx
+	je	.L939
+	movl	$1, %ebp
+.L933:
+	addq	%rbx, %rcx
+	jmp	.L940
+	.p2align 4,,10
+	.p2align 3
+.L1067:
+	cmpb	$36, %dl
+	je	.L944
+	addq	$1, %rbx
+	addq	$1, %rax
+	cmpq	%rcx, %rbx
+	je	.L943
+.L940:
+	movzbl	(%rax), %edx
+	testb	%dl, %dl
+	jne	.L1067
+.L944:
+	subq	%rbx, %rcx
+	cmpq	$1, %rcx
+	jbe	.L943
+	cmpb	$34, (%rbx)
+	jne	.L943
+	addq	$1, %rbx
+	leaq	-1(%rcx), %rdx
+	movl	$34, %esi
+	movq	%rbx, %rdi
+	call	memchr@PLT
+	movq	%rax, %r12
+	testq	%rax, %rax
+	je	.L943
+	subq	%rbx, %r12
+	cmpq	$-3, %r12
+	ja	.L943
+	movdqa	.LC1(%rip), %xmm2
+	movaps	%xmm2, 80(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r14
+	testq	%r14, %r14
+	je	.L946
+	pxor	%xmm0, %xmm0
+	leaq	104(%rsp), %rax
+	movq	%r12, %rdx
+	movq	%r14, 96(%rsp)
+	movq	$0, 120(%rsp)
+	movups	%xmm0, 104(%rsp)
+	cmpq	%rax, %rbx
+	jnb	.L996
+	movq	$0, 8(%rsp)
+.L948:
+	cmpq	$23, %rdx
+	jbe	.L1001
+	movq	$23, (%rsp)
+	movq	%rax, 16(%rsp)
+.L979:
+	movq	(%rsp), %rax
+	movq	%r14, %rdi
+	leaq	10(%rax,%rax), %rax
+	cmpq	%rdx, %rax
+	cmovnb	%rax, %rdx
+	movq	(%r14), %rax
+	movq	%rdx, 24(%rsp)
+	leaq	1(%rdx), %rsi
+	movl	$1, %edx
+.LEHB37:
+	call	*16(%rax)
+	movq	8(%rsp), %rdi
+	movq	16(%rsp), %rsi
+	movq	%rax, %r13
+	leaq	1(%rdi), %rdx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L955
+	addq	$1, %rax
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	movq	%rax, %rdx
+	movq	(%r14), %rax
+	call	*24(%rax)
+.LEHE37:
+.L955:
+	movq	24(%rsp), %rax
+	movq	%r13, 104(%rsp)
+	movq	%rax, 88(%rsp)
+.L954:
+	cmpq	$23, 24(%rsp)
+	je	.L1068
+.L959:
+	movq	8(%rsp), %rdi
+	movq	%r12, %rdx
+	movq	%rbx, %rsi
+	addq	%r13, %rdi
+	call	memmove@PLT
+	addq	80(%rsp), %r12
+	cmpb	$0, 176(%rsp)
+	movq	%r12, 80(%rsp)
+	movb	$0, 0(%r13,%r12)
+	je	.L961
+	movq	136(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L961
+	movq	144(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	152(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L961:
+	movdqa	.LC1(%rip), %xmm3
+	movaps	%xmm3, 128(%rsp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L1069
+.L963:
+	movq	96(%rsp), %rax
+	movdqa	80(%rsp), %xmm4
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 160(%rsp)
+	movq	%rax, 144(%rsp)
+	movq	88(%rsp), %rax
+	movaps	%xmm4, 128(%rsp)
+	cmpq	$23, %rax
+	je	.L1070
+	movq	104(%rsp), %rax
+	movq	%rax, 152(%rsp)
+.L966:
+	movb	$1, 176(%rsp)
+	movq	40(%rsp), %r13
+	.p2align 4,,10
+	.p2align 3
+.L943:
+	cmpq	$23, %r13
+	je	.L967
+.L1058:
+	movq	56(%rsp), %rsi
+.L927:
+	movq	48(%rsp), %rdi
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L967:
+	testb	%bpl, %bpl
+	je	.L941
+.L942:
+	cmpl	$12, %r15d
+	jne	.L1054
+	cmpb	$0, 176(%rsp)
+	je	.L1055
+	movq	136(%rsp), %rdx
+	movq	128(%rsp), %rax
+	leaq	152(%rsp), %rcx
+	cmpq	$23, %rdx
+	je	.L970
+	movq	152(%rsp), %rcx
+.L970:
+	cmpq	$3, %rax
+	jne	.L971
+	cmpw	$28482, (%rcx)
+	jne	.L971
+	cmpb	$98, 2(%rcx)
+	jne	.L971
+	cmpq	$23, %rdx
+	je	.L910
+	movq	144(%rsp), %rdi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	152(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L910:
+	addq	$200, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L911:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1071
+.L915:
+	movq	_ZZN1n4heapEvE3res(%rip), %rbp
+	movq	32(%rsp), %r13
+	pxor	%xmm0, %xmm0
+	movq	$0, 72(%rsp)
+	movq	40(%rsp), %r12
+	movq	$0, (%rsp)
+	leaq	.LC63(%rip), %rsi
+	movq	%rbp, 48(%rsp)
+	leaq	34(%r13), %rax
+	movups	%xmm0, 56(%rsp)
+	cmpq	$23, %r12
+	je	.L1072
+.L917:
+	movq	(%rsp), %rdi
+	leaq	(%rdi,%r13), %rdx
+	cmpq	%rdx, %rsi
+	jnb	.L1073
+	movq	%rsi, %rcx
+	subq	%rdi, %rcx
+	movq	%rcx, 8(%rsp)
+	cmpq	%rax, %r12
+	jnb	.L987
+	leaq	10(%r12,%r12), %rdx
+	movq	%rbp, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, %r14
+	leaq	1(%rax), %rsi
+	movq	0(%rbp), %rax
+.LEHB38:
+	call	*16(%rax)
+	movq	(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r12
+	je	.L922
+	movq	0(%rbp), %rax
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%rbp, %rdi
+	call	*24(%rax)
+.LEHE38:
+.L922:
+	movq	%rbx, 56(%rsp)
+	movq	%r14, %r12
+	movq	%r14, 40(%rsp)
+.L921:
+	cmpq	$23, %r12
+	jne	.L1057
+	leaq	56(%rsp), %rbx
+.L1057:
+	movq	8(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L924
+.L987:
+	xorl	%ebx, %ebx
+	jmp	.L921
+.L1073:
+	xorl	%ebx, %ebx
+	cmpq	%rax, %r12
+	jnb	.L919
+	movq	%r12, %r14
+	jmp	.L912
+	.p2align 4,,10
+	.p2align 3
+.L1059:
+	leaq	56(%rsp), %rbx
+	jmp	.L924
+.L1071:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L915
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L915
+.L992:
+	xorl	%ebp, %ebp
+	jmp	.L933
+	.p2align 4,,10
+	.p2align 3
+.L1065:
+	testq	%rdi, %rdi
+	je	.L991
+	movzbl	1(%rbx), %esi
+	leaq	-2(%rcx), %rdi
+	leaq	2(%rbx), %r10
+	movl	$2, %edx
+	movl	$1, %r9d
+	jmp	.L934
+.L935:
+	testq	%rdi, %rdi
+	je	.L991
+	movzbl	1(%rbx), %esi
+	leaq	-2(%rcx), %rdi
+	leaq	2(%rbx), %r10
+	xorl	%r9d, %r9d
+	movl	$2, %edx
+	jmp	.L934
+.L991:
+	xorl	%ebp, %ebp
+	movl	$1, %ecx
+	jmp	.L933
+.L1063:
+	jmp	.L941
+.L996:
+	movq	%rax, 16(%rsp)
+	movq	$0, 8(%rsp)
+	movq	$23, (%rsp)
+.L947:
+	cmpq	%rdx, (%rsp)
+	jb	.L979
+	movq	(%rsp), %rax
+	xorl	%r13d, %r13d
+	movq	%rax, 24(%rsp)
+	jmp	.L954
+.L1068:
+	leaq	104(%rsp), %rax
+.L1001:
+	movq	%rax, %r13
+	jmp	.L959
+.L1070:
+	movdqu	104(%rsp), %xmm5
+	movq	120(%rsp), %rax
+	movups	%xmm5, 152(%rsp)
+	movq	%rax, 168(%rsp)
+	jmp	.L966
+.L1069:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L963
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L963
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L963
+.L946:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1074
+.L950:
+	movq	80(%rsp), %rdi
+	movq	_ZZN1n4heapEvE3res(%rip), %r13
+	pxor	%xmm0, %xmm0
+	movq	$0, 120(%rsp)
+	movq	88(%rsp), %rax
+	movups	%xmm0, 104(%rsp)
+	movq	%rdi, 8(%rsp)
+	leaq	(%r12,%rdi), %rdx
+	movq	%rax, (%rsp)
+	movq	%r13, 96(%rsp)
+	movq	$0, 16(%rsp)
+	cmpq	$23, %rax
+	je	.L1075
+.L952:
+	movq	16(%rsp), %rax
+	movq	8(%rsp), %rdi
+	addq	%rdi, %rax
+	cmpq	%rax, %rbx
+	jnb	.L1076
+	movq	16(%rsp), %rax
+	subq	%rax, %rbx
+	movq	(%rsp), %rax
+	movq	%rbx, 24(%rsp)
+	cmpq	%rdx, %rax
+	jnb	.L956
+	leaq	10(%rax,%rax), %rax
+	movq	%rdx, %rbx
+	movq	%r13, %rdi
+	cmpq	%rdx, %rax
+	movl	$1, %edx
+	cmovnb	%rax, %rbx
+	movq	0(%r13), %rax
+	leaq	1(%rbx), %rsi
+.LEHB39:
+	call	*16(%rax)
+	movq	8(%rsp), %rdi
+	movq	16(%rsp), %rsi
+	movq	%rax, %r14
+	leaq	1(%rdi), %rdx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L957
+	addq	$1, %rax
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r13, %rdi
+	movq	%rax, %rdx
+	movq	0(%r13), %rax
+	call	*24(%rax)
+.LEHE39:
+.L957:
+	movq	%r14, 104(%rsp)
+	movq	%rbx, 88(%rsp)
+	movq	%rbx, (%rsp)
+.L956:
+	cmpq	$23, (%rsp)
+	je	.L958
+	movq	24(%rsp), %rbx
+	movq	%r14, %r13
+	addq	%r14, %rbx
+	jmp	.L959
+.L1076:
+	movq	%r13, %r14
+	jmp	.L947
+.L958:
+	movq	24(%rsp), %rbx
+	leaq	104(%rsp), %rax
+	addq	%rax, %rbx
+	jmp	.L1001
+.L1074:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L950
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r13, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L950
+.L939:
+	movl	$1, %ebp
+	cmpq	$23, %r13
+	jne	.L1058
+	jmp	.L942
+.L1075:
+	leaq	104(%rsp), %rax
+	cmpq	%rax, %rbx
+	jnb	.L1077
+	movq	%r13, %r14
+	jmp	.L948
+.L1064:
+	jmp	.L941
+.L1072:
+	leaq	56(%rsp), %rbx
+	cmpq	%rbx, %rsi
+	jnb	.L1078
+	cmpq	$23, %rax
+	jbe	.L924
+	movq	%rbx, (%rsp)
+	movl	$23, %r14d
+	jmp	.L912
+.L1060:
+	xorl	%ebp, %ebp
+	jmp	.L927
+.L1077:
+	movq	%rax, 16(%rsp)
+	jmp	.L952
+.L1078:
+	movq	%rbx, (%rsp)
+	jmp	.L917
+.L1052:
+	jmp	.L1053
+.L1004:
+	movq	%rax, %rbx
+	jmp	.L976
+	.section	.gcc_except_table
+.LLSDA6801:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6801-.LLSDACSB6801
+.LLSDACSB6801:
+	.uleb128 .LEHB36-.LFB6801
+	.uleb128 .LEHE36-.LEHB36
+	.uleb128 .L1052-.LFB6801
+	.uleb128 0
+	.uleb128 .LEHB37-.LFB6801
+	.uleb128 .LEHE37-.LEHB37
+	.uleb128 .L1004-.LFB6801
+	.uleb128 0
+	.uleb128 .LEHB38-.LFB6801
+	.uleb128 .LEHE38-.LEHB38
+	.uleb128 .L1052-.LFB6801
+	.uleb128 0
+	.uleb128 .LEHB39-.LFB6801
+	.uleb128 .LEHE39-.LEHB39
+	.uleb128 .L1004-.LFB6801
+	.uleb128 0
+.LLSDACSE6801:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6801
+	.type	_Z30test_extract_specific_pattern3v.cold, @function
+_Z30test_extract_specific_pattern3v.cold:
+.LFSB6801:
+.L971:
+	.cfi_def_cfa_offset 256
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC65(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB40:
+	call	__cxa_throw@PLT
+.LEHE40:
+.L1005:
+.L1053:
+	movq	%rax, %rbx
+.L978:
+	leaq	128(%rsp), %rdi
+	call	_ZN1n5maybeINS_6stringIcEEED1Ev
+	movq	%rbx, %rdi
+.LEHB41:
+	call	_Unwind_Resume@PLT
+.LEHE41:
+.L1054:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC13(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB42:
+	call	__cxa_throw@PLT
+.L1055:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC24(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L941:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC12(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE42:
+.L976:
+	movq	40(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L978
+	movq	48(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	56(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L978
+	.cfi_endproc
+.LFE6801:
+	.section	.gcc_except_table
+.LLSDAC6801:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6801-.LLSDACSBC6801
+.LLSDACSBC6801:
+	.uleb128 .LEHB40-.LCOLDB66
+	.uleb128 .LEHE40-.LEHB40
+	.uleb128 .L1005-.LCOLDB66
+	.uleb128 0
+	.uleb128 .LEHB41-.LCOLDB66
+	.uleb128 .LEHE41-.LEHB41
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB42-.LCOLDB66
+	.uleb128 .LEHE42-.LEHB42
+	.uleb128 .L1005-.LCOLDB66
+	.uleb128 0
+.LLSDACSEC6801:
+	.section	.text.unlikely
+	.text
+	.size	_Z30test_extract_specific_pattern3v, .-_Z30test_extract_specific_pattern3v
+	.section	.text.unlikely
+	.size	_Z30test_extract_specific_pattern3v.cold, .-_Z30test_extract_specific_pattern3v.cold
+.LCOLDE66:
+	.text
+.LHOTE66:
+	.weak	_ZTSN1n15memory_resourceE
+	.section	.rodata._ZTSN1n15memory_resourceE,"aG",@progbits,_ZTSN1n15memory_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n15memory_resourceE, @object
+	.size	_ZTSN1n15memory_resourceE, 22
+_ZTSN1n15memory_resourceE:
+	.string	"N1n15memory_resourceE"
+	.weak	_ZTIN1n15memory_resourceE
+	.section	.data.rel.ro._ZTIN1n15memory_resourceE,"awG",@progbits,_ZTIN1n15memory_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n15memory_resourceE, @object
+	.size	_ZTIN1n15memory_resourceE, 16
+_ZTIN1n15memory_resourceE:
+	.quad	_ZTVN10__cxxabiv117__class_type_infoE+16
+	.quad	_ZTSN1n15memory_resourceE
+	.weak	_ZTSN1n13heap_resourceE
+	.section	.rodata._ZTSN1n13heap_resourceE,"aG",@progbits,_ZTSN1n13heap_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n13heap_resourceE, @object
+	.size	_ZTSN1n13heap_resourceE, 20
+_ZTSN1n13heap_resourceE:
+	.string	"N1n13heap_resourceE"
+	.weak	_ZTIN1n13heap_resourceE
+	.section	.data.rel.ro._ZTIN1n13heap_resourceE,"awG",@progbits,_ZTIN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n13heap_resourceE, @object
+	.size	_ZTIN1n13heap_resourceE, 24
+_ZTIN1n13heap_resourceE:
+	.quad	_ZTVN10__cxxabiv120__si_class_type_infoE+16
+	.quad	_ZTSN1n13heap_resourceE
+	.quad	_ZTIN1n15memory_resourceE
+	.weak	_ZTVN1n13heap_resourceE
+	.section	.data.rel.ro.local._ZTVN1n13heap_resourceE,"awG",@progbits,_ZTVN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTVN1n13heap_resourceE, @object
+	.size	_ZTVN1n13heap_resourceE, 48
+_ZTVN1n13heap_resourceE:
+	.quad	0
+	.quad	_ZTIN1n13heap_resourceE
+	.quad	_ZN1n13heap_resourceD1Ev
+	.quad	_ZN1n13heap_resourceD0Ev
+	.quad	_ZN1n13heap_resource8allocateEmm
+	.quad	_ZN1n13heap_resource10deallocateEPvmm
+	.weak	_ZN1n18__current_resourceE
+	.section	.tbss._ZN1n18__current_resourceE,"awTG",@nobits,_ZN1n18__current_resourceE,comdat
+	.align 8
+	.type	_ZN1n18__current_resourceE, @gnu_unique_object
+	.size	_ZN1n18__current_resourceE, 8
+_ZN1n18__current_resourceE:
+	.zero	8
+	.weak	_ZGVZN1n4heapEvE3res
+	.section	.bss._ZGVZN1n4heapEvE3res,"awG",@nobits,_ZGVZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZGVZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZGVZN1n4heapEvE3res, 8
+_ZGVZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE3res
+	.section	.bss._ZZN1n4heapEvE3res,"awG",@nobits,_ZZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZZN1n4heapEvE3res, 8
+_ZZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE7storage
+	.section	.bss._ZZN1n4heapEvE7storage,"awG",@nobits,_ZZN1n4heapEvE7storage,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE7storage, @gnu_unique_object
+	.size	_ZZN1n4heapEvE7storage, 8
+_ZZN1n4heapEvE7storage:
+	.zero	8
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC1:
+	.quad	0
+	.quad	23
+	.section	.rodata.cst2,"aM",@progbits,2
+	.align 2
+.LC33:
+	.byte	10
+	.byte	0
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC51:
+	.long	9
+	.long	100
+	.hidden	DW.ref._ZTIPKc
+	.weak	DW.ref._ZTIPKc
+	.section	.data.rel.local.DW.ref._ZTIPKc,"awG",@progbits,DW.ref._ZTIPKc,comdat
+	.align 8
+	.type	DW.ref._ZTIPKc, @object
+	.size	DW.ref._ZTIPKc, 8
+DW.ref._ZTIPKc:
+	.quad	_ZTIPKc
+	.hidden	DW.ref.__gxx_personality_v0
+	.weak	DW.ref.__gxx_personality_v0
+	.section	.data.rel.local.DW.ref.__gxx_personality_v0,"awG",@progbits,DW.ref.__gxx_personality_v0,comdat
+	.align 8
+	.type	DW.ref.__gxx_personality_v0, @object
+	.size	DW.ref.__gxx_personality_v0, 8
+DW.ref.__gxx_personality_v0:
+	.quad	__gxx_personality_v0
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,8650 @@
+	.file	"tests-fd-file.cpp"
+	.text
+	.section	.text._ZN1n13heap_resourceD2Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD2Ev
+	.type	_ZN1n13heap_resourceD2Ev, @function
+_ZN1n13heap_resourceD2Ev:
+.LFB6941:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE6941:
+	.size	_ZN1n13heap_resourceD2Ev, .-_ZN1n13heap_resourceD2Ev
+	.weak	_ZN1n13heap_resourceD1Ev
+	.set	_ZN1n13heap_resourceD1Ev,_ZN1n13heap_resourceD2Ev
+	.section	.text._ZN1n13heap_resource8allocateEmm,"axG",@progbits,_ZN1n13heap_resource8allocateEmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource8allocateEmm
+	.type	_ZN1n13heap_resource8allocateEmm, @function
+_ZN1n13heap_resource8allocateEmm:
+.LFB49:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rdx
+	jbe	.L4
+	movq	%rdx, %rsi
+	jmp	_ZnwmSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	jmp	_Znwm@PLT
+	.cfi_endproc
+.LFE49:
+	.size	_ZN1n13heap_resource8allocateEmm, .-_ZN1n13heap_resource8allocateEmm
+	.section	.text._ZN1n13heap_resource10deallocateEPvmm,"axG",@progbits,_ZN1n13heap_resource10deallocateEPvmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource10deallocateEPvmm
+	.type	_ZN1n13heap_resource10deallocateEPvmm, @function
+_ZN1n13heap_resource10deallocateEPvmm:
+.LFB50:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rcx
+	jbe	.L6
+	movq	%rcx, %rsi
+	jmp	_ZdlPvSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	jmp	_ZdlPv@PLT
+	.cfi_endproc
+.LFE50:
+	.size	_ZN1n13heap_resource10deallocateEPvmm, .-_ZN1n13heap_resource10deallocateEPvmm
+	.section	.text._ZN1n13heap_resourceD0Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD0Ev
+	.type	_ZN1n13heap_resourceD0Ev, @function
+_ZN1n13heap_resourceD0Ev:
+.LFB6943:
+	.cfi_startproc
+	movl	$8, %esi
+	jmp	_ZdlPvm@PLT
+	.cfi_endproc
+.LFE6943:
+	.size	_ZN1n13heap_resourceD0Ev, .-_ZN1n13heap_resourceD0Ev
+	.section	.text._ZN1n4fileIcLNS_4modeE6EED2Ev,"axG",@progbits,_ZN1n4fileIcLNS_4modeE6EED5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4fileIcLNS_4modeE6EED2Ev
+	.type	_ZN1n4fileIcLNS_4modeE6EED2Ev, @function
+_ZN1n4fileIcLNS_4modeE6EED2Ev:
+.LFB6899:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6899
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movl	(%rdi), %ebp
+	testl	%ebp, %ebp
+	js	.L9
+	cmpl	$2, 8(%rdi)
+	je	.L59
+.L10:
+	cmpb	$0, 4(%rbx)
+	jne	.L60
+.L15:
+	movl	$-1, (%rbx)
+.L9:
+	cmpq	$0, 16(%rbx)
+	je	.L16
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L61
+.L18:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	$0, 16(%rbx)
+.L16:
+	movq	48(%rbx), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 8(%rbx)
+	movups	%xmm0, 32(%rbx)
+	testq	%rdi, %rdi
+	je	.L20
+	call	fclose@PLT
+	movl	(%rbx), %ebp
+	movq	$0, 48(%rbx)
+	testl	%ebp, %ebp
+	js	.L57
+	cmpl	$2, 8(%rbx)
+	jne	.L24
+	movq	40(%rbx), %r12
+	testq	%r12, %r12
+	jne	.L62
+.L24:
+	cmpb	$0, 4(%rbx)
+	jne	.L63
+.L30:
+	movl	$-1, (%rbx)
+.L57:
+	movq	16(%rbx), %rax
+	testq	%rax, %rax
+	je	.L8
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L64
+.L33:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L8:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L59:
+	.cfi_restore_state
+	movq	40(%rdi), %r12
+	testq	%r12, %r12
+	je	.L10
+	movq	16(%rdi), %r13
+.L14:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L65
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L14
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	movq	$0, 40(%rbx)
+	jmp	.L10
+	.p2align 4,,10
+	.p2align 3
+.L20:
+	movl	(%rbx), %eax
+	testl	%eax, %eax
+	js	.L8
+	cmpb	$0, 4(%rbx)
+	je	.L30
+.L63:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L30
+	.p2align 4,,10
+	.p2align 3
+.L60:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L15
+	.p2align 4,,10
+	.p2align 3
+.L64:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L33
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L33
+	.p2align 4,,10
+	.p2align 3
+.L61:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L18
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L18
+	.p2align 4,,10
+	.p2align 3
+.L62:
+	movq	16(%rbx), %r13
+.L29:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L66
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L29
+	.p2align 4,,10
+	.p2align 3
+.L28:
+	movq	$0, 40(%rbx)
+	jmp	.L24
+	.p2align 4,,10
+	.p2align 3
+.L65:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L13
+	jmp	.L14
+	.p2align 4,,10
+	.p2align 3
+.L66:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L28
+	jmp	.L29
+	.cfi_endproc
+.LFE6899:
+	.globl	__gxx_personality_v0
+	.section	.gcc_except_table._ZN1n4fileIcLNS_4modeE6EED2Ev,"aG",@progbits,_ZN1n4fileIcLNS_4modeE6EED5Ev,comdat
+.LLSDA6899:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6899-.LLSDACSB6899
+.LLSDACSB6899:
+.LLSDACSE6899:
+	.section	.text._ZN1n4fileIcLNS_4modeE6EED2Ev,"axG",@progbits,_ZN1n4fileIcLNS_4modeE6EED5Ev,comdat
+	.size	_ZN1n4fileIcLNS_4modeE6EED2Ev, .-_ZN1n4fileIcLNS_4modeE6EED2Ev
+	.weak	_ZN1n4fileIcLNS_4modeE6EED1Ev
+	.set	_ZN1n4fileIcLNS_4modeE6EED1Ev,_ZN1n4fileIcLNS_4modeE6EED2Ev
+	.section	.text._ZN1n7fd_file5closeEv,"axG",@progbits,_ZN1n7fd_file5closeEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n7fd_file5closeEv
+	.type	_ZN1n7fd_file5closeEv, @function
+_ZN1n7fd_file5closeEv:
+.LFB147:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movl	(%rdi), %ebp
+	testl	%ebp, %ebp
+	js	.L68
+	cmpl	$2, 8(%rdi)
+	je	.L89
+.L69:
+	cmpb	$0, 4(%rbx)
+	jne	.L90
+.L74:
+	movl	$-1, (%rbx)
+.L68:
+	cmpq	$0, 16(%rbx)
+	je	.L75
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L91
+.L77:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	$0, 16(%rbx)
+.L75:
+	pxor	%xmm0, %xmm0
+	movl	$0, 8(%rbx)
+	movups	%xmm0, 32(%rbx)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L89:
+	.cfi_restore_state
+	movq	40(%rdi), %r12
+	testq	%r12, %r12
+	je	.L69
+	movq	16(%rdi), %r13
+.L73:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L92
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L73
+	.p2align 4,,10
+	.p2align 3
+.L72:
+	movq	$0, 40(%rbx)
+	jmp	.L69
+	.p2align 4,,10
+	.p2align 3
+.L90:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L74
+	.p2align 4,,10
+	.p2align 3
+.L91:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L77
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L77
+	.p2align 4,,10
+	.p2align 3
+.L92:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L72
+	jmp	.L73
+	.cfi_endproc
+.LFE147:
+	.size	_ZN1n7fd_file5closeEv, .-_ZN1n7fd_file5closeEv
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"no newline"
+.LC1:
+	.string	" yet\n"
+.LC2:
+	.string	"x"
+.LC3:
+	.string	"y\n"
+.LC4:
+	.string	"test_fd_file.bin"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC8:
+	.string	"expected equal : expected value : on_disk(path), actual value : 0"
+	.align 8
+.LC9:
+	.string	"expected equal : expected value : on_disk(path), actual value : 15"
+	.align 8
+.LC10:
+	.string	"expected equal : expected value : on_disk(path), actual value : 16"
+	.align 8
+.LC11:
+	.string	"expected equal : expected value : on_disk(path), actual value : 18"
+	.section	.rodata.str1.1
+.LC12:
+	.string	"expected true : f.flush()"
+	.section	.text.unlikely,"ax",@progbits
+.LCOLDB14:
+	.text
+.LHOTB14:
+	.p2align 4
+	.globl	_Z27test_fd_file_flush_policiesv
+	.type	_Z27test_fd_file_flush_policiesv, @function
+_Z27test_fd_file_flush_policiesv:
+.LFB6880:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6880
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$438, %edx
+	movl	$524865, %esi
+	xorl	%eax, %eax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	leaq	.LC4(%rip), %rbx
+	movq	%rbx, %rdi
+	subq	$1336, %rsp
+	.cfi_def_cfa_offset 1392
+.LEHB0:
+	call	open@PLT
+.LEHE0:
+	movzwl	.LC5(%rip), %edx
+	movb	$0, 6(%rsp)
+	movdqa	.LC7(%rip), %xmm0
+	movl	%eax, (%rsp)
+	movw	%dx, 4(%rsp)
+	movq	.LC6(%rip), %rdx
+	movq	$0, 16(%rsp)
+	movq	%rdx, 8(%rsp)
+	movq	$0, 40(%rsp)
+	movups	%xmm0, 24(%rsp)
+	testl	%eax, %eax
+	js	.L242
+	movl	$2, 8(%rsp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L355
+.L96:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rsp), %r14
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%r14, %rsi
+.LEHB1:
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	movq	%rax, %r13
+	testq	%rax, %rax
+	je	.L98
+	movq	40(%rsp), %rbp
+	movq	%r14, %rax
+	subq	%rbp, %rax
+	cmpq	$9, %rax
+	ja	.L248
+	cmpl	$2, 8(%rsp)
+	jne	.L248
+	testq	%rbp, %rbp
+	jne	.L101
+.L248:
+	leaq	0(%r13,%rbp), %rax
+	addq	$10, %rbp
+.L100:
+	movabsq	$7596577948990205806, %rcx
+	movl	$25966, %esi
+	movq	%rbp, 40(%rsp)
+	movq	%rcx, (%rax)
+	movw	%si, 8(%rax)
+.L106:
+	cmpl	$2, 12(%rsp)
+	jne	.L94
+	cmpl	$2, 8(%rsp)
+	jne	.L94
+	movq	40(%rsp), %rbp
+	testq	%rbp, %rbp
+	je	.L94
+	movl	(%rsp), %r15d
+	movq	%r13, %r12
+.L114:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%r15d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L356
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L114
+	.p2align 4,,10
+	.p2align 3
+.L113:
+	movq	$0, 40(%rsp)
+	jmp	.L94
+	.p2align 4,,10
+	.p2align 3
+.L242:
+	xorl	%r13d, %r13d
+	movl	$64, %r14d
+.L94:
+	xorl	%esi, %esi
+	movq	%rbx, %rdi
+	xorl	%eax, %eax
+	call	open@PLT
+	leaq	48(%rsp), %rsi
+	movl	$256, %edx
+	movl	%eax, %edi
+	movl	%eax, %ebp
+	call	read@PLT
+	movl	%ebp, %edi
+	movq	%rax, %r12
+	call	close@PLT
+	testq	%r12, %r12
+	jg	.L341
+	movl	(%rsp), %r12d
+	testl	%r12d, %r12d
+	js	.L116
+	cmpl	$1, 8(%rsp)
+	je	.L357
+	movl	$2, 8(%rsp)
+	cmpq	$5, %r14
+	ja	.L119
+.L371:
+	movq	40(%rsp), %rbp
+	testq	%rbp, %rbp
+	jne	.L125
+.L120:
+	movl	$5, %ebp
+	leaq	.LC1(%rip), %r13
+	.p2align 4,,10
+	.p2align 3
+.L129:
+	movq	%rbp, %rdx
+	movq	%r13, %rsi
+	movl	%r12d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L358
+	addq	%rax, %r13
+	subq	%rax, %rbp
+	jne	.L129
+	.p2align 4,,10
+	.p2align 3
+.L116:
+	xorl	%esi, %esi
+	movq	%rbx, %rdi
+	xorl	%eax, %eax
+	call	open@PLT
+	leaq	304(%rsp), %rsi
+	movl	$256, %edx
+	movl	%eax, %edi
+	movl	%eax, %ebp
+	call	read@PLT
+	movl	%ebp, %edi
+	movq	%rax, %r12
+	call	close@PLT
+	cmpq	$15, %r12
+	jne	.L342
+	movl	(%rsp), %r12d
+	movl	$2, 12(%rsp)
+	testl	%r12d, %r12d
+	js	.L152
+	cmpl	$1, 8(%rsp)
+	je	.L359
+.L153:
+	movq	24(%rsp), %rbp
+	movl	$2, 8(%rsp)
+	cmpq	$1, %rbp
+	ja	.L155
+	movq	40(%rsp), %rbp
+	testq	%rbp, %rbp
+	jne	.L360
+.L156:
+	movl	$1, %ebp
+	leaq	.LC2(%rip), %r13
+	.p2align 4,,10
+	.p2align 3
+.L165:
+	movq	%rbp, %rdx
+	movq	%r13, %rsi
+	movl	%r12d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L361
+	addq	%rax, %r13
+	subq	%rax, %rbp
+	jne	.L165
+	.p2align 4,,10
+	.p2align 3
+.L152:
+	xorl	%esi, %esi
+	movq	%rbx, %rdi
+	xorl	%eax, %eax
+	call	open@PLT
+	leaq	560(%rsp), %rsi
+	movl	$256, %edx
+	movl	%eax, %edi
+	movl	%eax, %ebp
+	call	read@PLT
+	movl	%ebp, %edi
+	movq	%rax, %r12
+	call	close@PLT
+	cmpq	$16, %r12
+	jne	.L343
+	movl	(%rsp), %r12d
+	movl	$0, 12(%rsp)
+	testl	%r12d, %r12d
+	js	.L188
+	cmpl	$1, 8(%rsp)
+	je	.L362
+.L189:
+	movq	24(%rsp), %rbp
+	movl	$2, 8(%rsp)
+	cmpq	$2, %rbp
+	ja	.L191
+	movq	40(%rsp), %rbp
+	testq	%rbp, %rbp
+	jne	.L192
+.L241:
+	movl	$2, %ebp
+	leaq	.LC3(%rip), %r13
+	.p2align 4,,10
+	.p2align 3
+.L193:
+	movq	%rbp, %rdx
+	movq	%r13, %rsi
+	movl	%r12d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L363
+	addq	%rax, %r13
+	subq	%rax, %rbp
+	jne	.L193
+	.p2align 4,,10
+	.p2align 3
+.L188:
+	xorl	%esi, %esi
+	movq	%rbx, %rdi
+	xorl	%eax, %eax
+	call	open@PLT
+	leaq	816(%rsp), %rsi
+	movl	$256, %edx
+	movl	%eax, %edi
+	movl	%eax, %ebp
+	call	read@PLT
+	movl	%ebp, %edi
+	movq	%rax, %r12
+	call	close@PLT
+	cmpq	$16, %r12
+	jne	.L344
+	movl	8(%rsp), %r13d
+	cmpl	$2, %r13d
+	je	.L364
+.L222:
+	xorl	%esi, %esi
+	movq	%rbx, %rdi
+	xorl	%eax, %eax
+	call	open@PLT
+	leaq	1072(%rsp), %rsi
+	movl	$256, %edx
+	movl	%eax, %edi
+	movl	%eax, %ebp
+	call	read@PLT
+	movl	%ebp, %edi
+	movq	%rax, %r12
+	call	close@PLT
+.LEHE1:
+	cmpq	$18, %r12
+	jne	.L345
+	movq	%rbx, %rdi
+	call	remove@PLT
+	movl	(%rsp), %ebx
+	movq	16(%rsp), %rbp
+	testl	%ebx, %ebx
+	js	.L229
+	cmpl	$2, %r13d
+	je	.L365
+.L230:
+	cmpb	$0, 4(%rsp)
+	jne	.L366
+.L235:
+	movl	$-1, (%rsp)
+.L229:
+	testq	%rbp, %rbp
+	je	.L93
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L367
+.L238:
+	movq	24(%rsp), %rdx
+	movq	16(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L93:
+	addq	$1336, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L364:
+	.cfi_restore_state
+	movq	40(%rsp), %rbp
+	testq	%rbp, %rbp
+	je	.L222
+	movq	16(%rsp), %r12
+	movl	(%rsp), %r14d
+.L227:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%r14d, %edi
+.LEHB2:
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L368
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L227
+	xorl	%edx, %edx
+	movq	%rdx, 40(%rsp)
+	jmp	.L222
+	.p2align 4,,10
+	.p2align 3
+.L362:
+	movq	40(%rsp), %rax
+	movq	32(%rsp), %rsi
+	cmpq	%rsi, %rax
+	jne	.L369
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 32(%rsp)
+	jmp	.L189
+	.p2align 4,,10
+	.p2align 3
+.L357:
+	movq	40(%rsp), %rax
+	movq	32(%rsp), %rsi
+	cmpq	%rsi, %rax
+	jne	.L370
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 32(%rsp)
+.L380:
+	movl	$2, 8(%rsp)
+	cmpq	$5, %r14
+	jbe	.L371
+.L119:
+	testq	%r13, %r13
+	je	.L372
+.L130:
+	movq	40(%rsp), %rbp
+	subq	%rbp, %r14
+	cmpq	$4, %r14
+	jbe	.L135
+.L249:
+	leaq	0(%r13,%rbp), %rax
+	addq	$5, %rbp
+.L136:
+	movl	$1952807200, (%rax)
+	movb	$10, 4(%rax)
+	movq	%rbp, 40(%rsp)
+.L142:
+	movl	12(%rsp), %eax
+	subl	$1, %eax
+	cmpl	$1, %eax
+	ja	.L116
+	cmpl	$2, 8(%rsp)
+	jne	.L116
+	movq	40(%rsp), %rbp
+	testq	%rbp, %rbp
+	je	.L116
+	movl	(%rsp), %r12d
+.L150:
+	movq	%rbp, %rdx
+	movq	%r13, %rsi
+	movl	%r12d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L373
+	addq	%rax, %r13
+	subq	%rax, %rbp
+	jne	.L150
+	.p2align 4,,10
+	.p2align 3
+.L149:
+	movq	$0, 40(%rsp)
+	jmp	.L116
+	.p2align 4,,10
+	.p2align 3
+.L359:
+	movq	40(%rsp), %rax
+	movq	32(%rsp), %rsi
+	cmpq	%rsi, %rax
+	jne	.L374
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 32(%rsp)
+	jmp	.L153
+	.p2align 4,,10
+	.p2align 3
+.L155:
+	movq	16(%rsp), %r12
+	testq	%r12, %r12
+	je	.L375
+.L166:
+	movq	40(%rsp), %r13
+	cmpq	%rbp, %r13
+	je	.L171
+.L250:
+	addq	%r13, %r12
+	addq	$1, %r13
+.L172:
+	movb	$120, (%r12)
+	movq	%r13, 40(%rsp)
+.L178:
+	cmpl	$2, 12(%rsp)
+	jne	.L152
+	cmpl	$2, 8(%rsp)
+	jne	.L152
+	movq	40(%rsp), %rbp
+	testq	%rbp, %rbp
+	je	.L152
+	movq	16(%rsp), %r12
+	movl	(%rsp), %r13d
+.L186:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%r13d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L376
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L186
+	.p2align 4,,10
+	.p2align 3
+.L185:
+	movq	$0, 40(%rsp)
+	jmp	.L152
+	.p2align 4,,10
+	.p2align 3
+.L191:
+	movq	16(%rsp), %r12
+	testq	%r12, %r12
+	je	.L377
+.L201:
+	movq	40(%rsp), %r13
+	subq	%r13, %rbp
+	cmpq	$1, %rbp
+	jbe	.L206
+.L251:
+	leaq	(%r12,%r13), %rax
+	addq	$2, %r13
+.L207:
+	movl	$2681, %ecx
+	movq	%r13, 40(%rsp)
+	movw	%cx, (%rax)
+.L213:
+	movl	12(%rsp), %eax
+	subl	$1, %eax
+	cmpl	$1, %eax
+	ja	.L188
+	cmpl	$2, 8(%rsp)
+	jne	.L188
+	movq	40(%rsp), %rbp
+	testq	%rbp, %rbp
+	je	.L188
+	movl	(%rsp), %r13d
+.L220:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%r13d, %edi
+	call	write@PLT
+.LEHE2:
+	testq	%rax, %rax
+	js	.L378
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L220
+	.p2align 4,,10
+	.p2align 3
+.L219:
+	movq	$0, 40(%rsp)
+	jmp	.L188
+	.p2align 4,,10
+	.p2align 3
+.L365:
+	movq	40(%rsp), %r12
+	testq	%r12, %r12
+	je	.L230
+	movq	%rbp, %r13
+.L234:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L379
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L234
+	.p2align 4,,10
+	.p2align 3
+.L233:
+	movq	$0, 40(%rsp)
+	jmp	.L230
+	.p2align 4,,10
+	.p2align 3
+.L374:
+	subq	%rax, %rsi
+	movl	$1, %edx
+	movl	%r12d, %edi
+	call	lseek@PLT
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 32(%rsp)
+	jmp	.L153
+	.p2align 4,,10
+	.p2align 3
+.L370:
+	subq	%rax, %rsi
+	movl	$1, %edx
+	movl	%r12d, %edi
+	call	lseek@PLT
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 32(%rsp)
+	jmp	.L380
+	.p2align 4,,10
+	.p2align 3
+.L369:
+	subq	%rax, %rsi
+	movl	$1, %edx
+	movl	%r12d, %edi
+	call	lseek@PLT
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 32(%rsp)
+	jmp	.L189
+	.p2align 4,,10
+	.p2align 3
+.L381:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L149
+	.p2align 4,,10
+	.p2align 3
+.L125:
+	movq	%rbp, %rdx
+	movq	%r13, %rsi
+	movl	%r12d, %edi
+.LEHB3:
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L381
+	addq	%rax, %r13
+	subq	%rax, %rbp
+	jne	.L125
+	movq	$0, 40(%rsp)
+	jmp	.L120
+	.p2align 4,,10
+	.p2align 3
+.L171:
+	cmpl	$2, 8(%rsp)
+	jne	.L250
+	testq	%rbp, %rbp
+	je	.L250
+	movl	(%rsp), %r14d
+	movq	%r12, %rbp
+.L177:
+	movq	%r13, %rdx
+	movq	%rbp, %rsi
+	movl	%r14d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L382
+	addq	%rax, %rbp
+	subq	%rax, %r13
+	jne	.L177
+.L353:
+	movl	$1, %r13d
+	jmp	.L172
+	.p2align 4,,10
+	.p2align 3
+.L135:
+	cmpl	$2, 8(%rsp)
+	jne	.L249
+	testq	%rbp, %rbp
+	je	.L249
+	movl	(%rsp), %r14d
+	movq	%r13, %r12
+.L141:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%r14d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L383
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L141
+.L352:
+	movq	%r13, %rax
+	movl	$5, %ebp
+	jmp	.L136
+	.p2align 4,,10
+	.p2align 3
+.L206:
+	cmpl	$2, 8(%rsp)
+	jne	.L251
+	testq	%r13, %r13
+	je	.L251
+	movl	(%rsp), %r14d
+	movq	%r12, %rbp
+.L212:
+	movq	%r13, %rdx
+	movq	%rbp, %rsi
+	movl	%r14d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L384
+	addq	%rax, %rbp
+	subq	%rax, %r13
+	jne	.L212
+.L354:
+	movq	%r12, %rax
+	movl	$2, %r13d
+	jmp	.L207
+	.p2align 4,,10
+	.p2align 3
+.L192:
+	movq	16(%rsp), %r13
+.L198:
+	movq	%rbp, %rdx
+	movq	%r13, %rsi
+	movl	%r12d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L385
+	addq	%rax, %r13
+	subq	%rax, %rbp
+	jne	.L198
+	movq	$0, 40(%rsp)
+	jmp	.L241
+	.p2align 4,,10
+	.p2align 3
+.L360:
+	movq	16(%rsp), %r13
+.L161:
+	movq	%rbp, %rdx
+	movq	%r13, %rsi
+	movl	%r12d, %edi
+	call	write@PLT
+.LEHE3:
+	testq	%rax, %rax
+	js	.L386
+	addq	%rax, %r13
+	subq	%rax, %rbp
+	jne	.L161
+	movq	$0, 40(%rsp)
+	jmp	.L156
+	.p2align 4,,10
+	.p2align 3
+.L361:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L152
+	jmp	.L165
+	.p2align 4,,10
+	.p2align 3
+.L363:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L188
+	jmp	.L193
+	.p2align 4,,10
+	.p2align 3
+.L358:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L116
+	jmp	.L129
+	.p2align 4,,10
+	.p2align 3
+.L366:
+	movl	%ebx, %edi
+	call	close@PLT
+	jmp	.L235
+	.p2align 4,,10
+	.p2align 3
+.L367:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L238
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L238
+	.p2align 4,,10
+	.p2align 3
+.L368:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L227
+	xorl	%eax, %eax
+	movl	$8, %edi
+	movq	%rax, 40(%rsp)
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC12(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB4:
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L379:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L233
+	jmp	.L234
+	.p2align 4,,10
+	.p2align 3
+.L386:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L185
+	jmp	.L161
+	.p2align 4,,10
+	.p2align 3
+.L385:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L219
+	jmp	.L198
+	.p2align 4,,10
+	.p2align 3
+.L376:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L185
+	jmp	.L186
+	.p2align 4,,10
+	.p2align 3
+.L355:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L96
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L96
+	.p2align 4,,10
+	.p2align 3
+.L98:
+	movl	(%rsp), %r15d
+	movl	$10, %ebp
+	leaq	.LC0(%rip), %r12
+.L109:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%r15d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L387
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L109
+	jmp	.L106
+	.p2align 4,,10
+	.p2align 3
+.L387:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L106
+	jmp	.L109
+	.p2align 4,,10
+	.p2align 3
+.L378:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L219
+	jmp	.L220
+	.p2align 4,,10
+	.p2align 3
+.L356:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L113
+	jmp	.L114
+	.p2align 4,,10
+	.p2align 3
+.L373:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L149
+	jmp	.L150
+	.p2align 4,,10
+	.p2align 3
+.L377:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L388
+.L203:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rsp), %rbp
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%rbp, %rsi
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	movq	%rax, %r12
+	testq	%rax, %rax
+	jne	.L201
+	movl	(%rsp), %r14d
+	movl	$2, %ebp
+	leaq	.LC3(%rip), %r13
+.L216:
+	movq	%rbp, %rdx
+	movq	%r13, %rsi
+	movl	%r14d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L389
+	addq	%rax, %r13
+	subq	%rax, %rbp
+	jne	.L216
+	jmp	.L213
+	.p2align 4,,10
+	.p2align 3
+.L389:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L213
+	jmp	.L216
+	.p2align 4,,10
+	.p2align 3
+.L372:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L390
+.L132:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rsp), %r14
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%r14, %rsi
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	movq	%rax, %r13
+	testq	%rax, %rax
+	jne	.L130
+	movl	(%rsp), %r14d
+	movl	$5, %ebp
+	leaq	.LC1(%rip), %r12
+.L145:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%r14d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L391
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L145
+	jmp	.L142
+	.p2align 4,,10
+	.p2align 3
+.L391:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L142
+	jmp	.L145
+	.p2align 4,,10
+	.p2align 3
+.L375:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L392
+.L168:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rsp), %rbp
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%rbp, %rsi
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	movq	%rax, %r12
+	testq	%rax, %rax
+	jne	.L166
+	movl	(%rsp), %r13d
+	movl	$1, %ebp
+	leaq	.LC2(%rip), %r12
+.L181:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%r13d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L393
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L181
+	jmp	.L178
+	.p2align 4,,10
+	.p2align 3
+.L393:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L178
+	jmp	.L181
+	.p2align 4,,10
+	.p2align 3
+.L392:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L168
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L168
+	.p2align 4,,10
+	.p2align 3
+.L390:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L132
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L132
+	.p2align 4,,10
+	.p2align 3
+.L388:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L203
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L203
+.L384:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L354
+	jmp	.L212
+.L382:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L353
+	jmp	.L177
+.L383:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L352
+	jmp	.L141
+.L101:
+	movl	(%rsp), %r15d
+	movq	%r13, %r12
+.L105:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%r15d, %edi
+	call	write@PLT
+.LEHE4:
+	testq	%rax, %rax
+	js	.L394
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L105
+.L351:
+	movq	%r13, %rax
+	movl	$10, %ebp
+	jmp	.L100
+.L394:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L351
+	jmp	.L105
+.L339:
+	jmp	.L340
+	.section	.gcc_except_table,"a",@progbits
+.LLSDA6880:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6880-.LLSDACSB6880
+.LLSDACSB6880:
+	.uleb128 .LEHB0-.LFB6880
+	.uleb128 .LEHE0-.LEHB0
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB1-.LFB6880
+	.uleb128 .LEHE1-.LEHB1
+	.uleb128 .L339-.LFB6880
+	.uleb128 0
+	.uleb128 .LEHB2-.LFB6880
+	.uleb128 .LEHE2-.LEHB2
+	.uleb128 .L339-.LFB6880
+	.uleb128 0
+	.uleb128 .LEHB3-.LFB6880
+	.uleb128 .LEHE3-.LEHB3
+	.uleb128 .L339-.LFB6880
+	.uleb128 0
+	.uleb128 .LEHB4-.LFB6880
+	.uleb128 .LEHE4-.LEHB4
+	.uleb128 .L339-.LFB6880
+	.uleb128 0
+.LLSDACSE6880:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6880
+	.type	_Z27test_fd_file_flush_policiesv.cold, @function
+_Z27test_fd_file_flush_policiesv.cold:
+.LFSB6880:
+.L343:
+	.cfi_def_cfa_offset 1392
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC10(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB5:
+	call	__cxa_throw@PLT
+.LEHE5:
+.L247:
+.L340:
+	movq	%rax, %rbx
+	movq	%rsp, %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB6:
+	call	_Unwind_Resume@PLT
+.LEHE6:
+.L342:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC9(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB7:
+	call	__cxa_throw@PLT
+.L341:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC8(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L345:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC11(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L344:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC10(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE7:
+	.cfi_endproc
+.LFE6880:
+	.section	.gcc_except_table
+.LLSDAC6880:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6880-.LLSDACSBC6880
+.LLSDACSBC6880:
+	.uleb128 .LEHB5-.LCOLDB14
+	.uleb128 .LEHE5-.LEHB5
+	.uleb128 .L247-.LCOLDB14
+	.uleb128 0
+	.uleb128 .LEHB6-.LCOLDB14
+	.uleb128 .LEHE6-.LEHB6
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB7-.LCOLDB14
+	.uleb128 .LEHE7-.LEHB7
+	.uleb128 .L247-.LCOLDB14
+	.uleb128 0
+.LLSDACSEC6880:
+	.section	.text.unlikely
+	.text
+	.size	_Z27test_fd_file_flush_policiesv, .-_Z27test_fd_file_flush_policiesv
+	.section	.text.unlikely
+	.size	_Z27test_fd_file_flush_policiesv.cold, .-_Z27test_fd_file_flush_policiesv.cold
+.LCOLDE14:
+	.text
+.LHOTE14:
+	.section	.rodata.str1.1
+.LC15:
+	.string	"hello "
+.LC16:
+	.string	"buffered world!!!"
+.LC17:
+	.string	"\n"
+.LC19:
+	.string	"expected true : f.opened()"
+	.section	.rodata.str1.8
+	.align 8
+.LC20:
+	.string	"expected equal : expected value : f.write(\"hello \", 6), actual value : 6"
+	.align 8
+.LC21:
+	.string	"expected equal : expected value : f.write(\"buffered world!!!\", 17), actual value : 17"
+	.align 8
+.LC22:
+	.string	"expected equal : expected value : on_disk(path), actual value : 23"
+	.align 8
+.LC24:
+	.string	"expected equal : expected value : f.read(b, 5), actual value : 5"
+	.section	.rodata.str1.1
+.LC25:
+	.string	"hello"
+	.section	.rodata.str1.8
+	.align 8
+.LC26:
+	.string	"expected true : memcmp(b, \"hello\", 5) == 0"
+	.align 8
+.LC27:
+	.string	"expected equal : expected value : f.read(b, 32), actual value : 19"
+	.section	.rodata.str1.1
+.LC28:
+	.string	" buffered world!!!\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC29:
+	.string	"expected true : memcmp(b, \" buffered world!!!\\n\", 19) == 0"
+	.section	.rodata.str1.1
+.LC30:
+	.string	"expected true : f.eof()"
+.LC31:
+	.string	"expected false : f.error()"
+	.section	.text.unlikely
+.LCOLDB33:
+	.text
+.LHOTB33:
+	.p2align 4
+	.globl	_Z23test_fd_file_write_readv
+	.type	_Z23test_fd_file_write_readv, @function
+_Z23test_fd_file_write_readv:
+.LFB6875:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6875
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$438, %edx
+	movl	$524865, %esi
+	xorl	%eax, %eax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	leaq	.LC4(%rip), %rdi
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$600, %rsp
+	.cfi_def_cfa_offset 656
+.LEHB8:
+	call	open@PLT
+.LEHE8:
+	movzwl	.LC5(%rip), %r12d
+	movb	$0, 38(%rsp)
+	movdqa	.LC18(%rip), %xmm0
+	movl	%eax, 32(%rsp)
+	movw	%r12w, 36(%rsp)
+	movq	$0, 40(%rsp)
+	movq	$0, 48(%rsp)
+	movq	$0, 72(%rsp)
+	movups	%xmm0, 56(%rsp)
+	testl	%eax, %eax
+	js	.L763
+	movl	$2, 40(%rsp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L790
+.L398:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	56(%rsp), %rbx
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%rbx, 16(%rsp)
+	movq	%rbx, %rsi
+.LEHB9:
+	call	*16(%rax)
+	movq	%rax, 48(%rsp)
+	movq	%rax, %r14
+	testq	%rax, %rax
+	je	.L400
+	movq	72(%rsp), %rbp
+	movq	%rbx, %rax
+	subq	%rbp, %rax
+	cmpq	$5, %rax
+	ja	.L783
+	cmpl	$2, 40(%rsp)
+	sete	%bl
+	testq	%rbp, %rbp
+	setne	%al
+	andb	%al, %bl
+	jne	.L403
+.L783:
+	leaq	(%r14,%rbp), %rax
+	movl	$1, %ebx
+	addq	$6, %rbp
+.L402:
+	movl	$8303, %edx
+	movl	$1819043176, (%rax)
+	movw	%dx, 4(%rax)
+	movl	44(%rsp), %eax
+	movq	%rbp, 72(%rsp)
+	movl	%eax, 8(%rsp)
+	cmpl	$2, %eax
+	je	.L791
+	testb	%bl, %bl
+	je	.L417
+.L425:
+	xorl	%esi, %esi
+	leaq	.LC4(%rip), %rdi
+	xorl	%eax, %eax
+	call	open@PLT
+	leaq	80(%rsp), %r15
+	movl	$256, %edx
+	movl	%eax, %edi
+	movl	%eax, %ebx
+	movq	%r15, %rsi
+	call	read@PLT
+	movl	%ebx, %edi
+	movq	%rax, %rbp
+	call	close@PLT
+	testq	%rbp, %rbp
+	jg	.L764
+	movl	32(%rsp), %ebp
+	testl	%ebp, %ebp
+	js	.L439
+	cmpl	$1, 40(%rsp)
+	je	.L792
+	cmpq	$17, 16(%rsp)
+	movl	$2, 40(%rsp)
+	ja	.L430
+.L830:
+	movq	72(%rsp), %rbx
+	testq	%rbx, %rbx
+	jne	.L793
+.L431:
+	movl	$17, %ebx
+	leaq	.LC16(%rip), %r13
+	.p2align 4,,10
+	.p2align 3
+.L441:
+	movq	%rbx, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L794
+	addq	%rax, %r13
+	subq	%rax, %rbx
+	jne	.L441
+.L440:
+	xorl	%esi, %esi
+	leaq	.LC4(%rip), %rdi
+	xorl	%eax, %eax
+	call	open@PLT
+	movl	%eax, %ebx
+	leaq	336(%rsp), %rax
+	movl	$256, %edx
+	movq	%rax, %rsi
+	movl	%ebx, %edi
+	movq	%rax, 24(%rsp)
+	call	read@PLT
+	movl	%ebx, %edi
+	movq	%rax, %rbp
+	call	close@PLT
+	cmpq	$23, %rbp
+	jne	.L765
+	movl	32(%rsp), %ebx
+	testl	%ebx, %ebx
+	js	.L468
+	cmpl	$1, 40(%rsp)
+	je	.L795
+	cmpq	$1, 16(%rsp)
+	movl	$2, 40(%rsp)
+	ja	.L471
+.L832:
+	movq	72(%rsp), %rbp
+	testq	%rbp, %rbp
+	jne	.L796
+.L472:
+	movl	$1, %ebp
+	leaq	.LC17(%rip), %r13
+	.p2align 4,,10
+	.p2align 3
+.L484:
+	movq	%rbp, %rdx
+	movq	%r13, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+.LEHE9:
+	testq	%rax, %rax
+	js	.L797
+	addq	%rax, %r13
+	subq	%rax, %rbp
+	jne	.L484
+	cmpl	$2, 8(%rsp)
+	je	.L479
+.L779:
+	cmpl	$1, 8(%rsp)
+	je	.L479
+.L486:
+	movq	72(%rsp), %r13
+	testq	%r13, %r13
+	jne	.L798
+.L478:
+	cmpb	$0, 36(%rsp)
+	jne	.L799
+.L514:
+	movl	$-1, 32(%rsp)
+.L468:
+	testq	%r14, %r14
+	je	.L515
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L800
+.L517:
+	movq	56(%rsp), %rdx
+	movq	48(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L515:
+	movl	$438, %edx
+	movl	$524288, %esi
+	leaq	.LC4(%rip), %rdi
+	xorl	%eax, %eax
+.LEHB10:
+	call	open@PLT
+.LEHE10:
+	movdqa	.LC23(%rip), %xmm0
+	movw	%r12w, 340(%rsp)
+	movl	%eax, 336(%rsp)
+	movb	$0, 342(%rsp)
+	movq	$0, 344(%rsp)
+	movq	$0, 352(%rsp)
+	movq	$0, 376(%rsp)
+	movups	%xmm0, 360(%rsp)
+	testl	%eax, %eax
+	js	.L520
+	movq	$0, 8(%rsp)
+	xorl	%r14d, %r14d
+	xorl	%r12d, %r12d
+	movl	$1, 344(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L553:
+	movq	8(%rsp), %rax
+	subq	%r14, %rax
+	jne	.L801
+	cmpb	$0, 341(%rsp)
+	jne	.L525
+	movzbl	342(%rsp), %eax
+	movb	%al, 16(%rsp)
+	testb	%al, %al
+	jne	.L525
+	movl	$5, %ebx
+	movq	360(%rsp), %r13
+	movl	336(%rsp), %ebp
+	subq	%r12, %rbx
+	cmpq	%r13, %rbx
+	jb	.L526
+	leaq	(%r15,%r12), %r13
+	jmp	.L529
+	.p2align 4,,10
+	.p2align 3
+.L803:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L802
+.L529:
+	movq	%rbx, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+.LEHB11:
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L803
+	je	.L804
+	addq	%rax, %r12
+.L524:
+	cmpq	$4, %r12
+	jbe	.L553
+.L525:
+	cmpq	$5, %r12
+	jne	.L520
+	cmpl	$1819043176, 80(%rsp)
+	je	.L805
+.L555:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC26(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L790:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L398
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L398
+	.p2align 4,,10
+	.p2align 3
+.L801:
+	movl	$5, %ecx
+	movq	352(%rsp), %r8
+	leaq	(%r15,%r12), %rdi
+	subq	%r12, %rcx
+	cmpq	%rax, %rcx
+	cmova	%rax, %rcx
+	addq	%r14, %r8
+	movl	%ecx, %r9d
+	testl	%ecx, %ecx
+	je	.L523
+	xorl	%eax, %eax
+.L522:
+	movl	%eax, %edx
+	addl	$1, %eax
+	movzbl	(%r8,%rdx), %esi
+	movb	%sil, (%rdi,%rdx)
+	cmpl	%r9d, %eax
+	jb	.L522
+.L523:
+	addq	%rcx, %r14
+	addq	%rcx, %r12
+	movq	%r14, 368(%rsp)
+	jmp	.L524
+	.p2align 4,,10
+	.p2align 3
+.L526:
+	testl	%ebp, %ebp
+	jns	.L806
+.L520:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC24(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L802:
+	movl	$1, %eax
+.L528:
+	movzbl	16(%rsp), %ecx
+	movb	%al, 342(%rsp)
+	movb	%cl, 341(%rsp)
+	jmp	.L520
+	.p2align 4,,10
+	.p2align 3
+.L806:
+	movq	352(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L807
+.L533:
+	cmpl	$2, 344(%rsp)
+	je	.L808
+.L538:
+	movq	368(%rsp), %r14
+	movq	8(%rsp), %rax
+	movl	$1, 344(%rsp)
+	cmpq	%r14, %rax
+	jne	.L553
+	cmpb	$0, 341(%rsp)
+	jne	.L520
+	movzbl	342(%rsp), %r14d
+	testb	%r14b, %r14b
+	jne	.L520
+	testq	%rax, %rax
+	jne	.L809
+.L547:
+	testq	%r13, %r13
+	je	.L520
+	movl	336(%rsp), %ebp
+	jmp	.L550
+	.p2align 4,,10
+	.p2align 3
+.L811:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L810
+.L550:
+	movq	%r13, %rdx
+	movq	%rbx, %rsi
+	movl	%ebp, %edi
+	call	read@PLT
+.LEHE11:
+	testq	%rax, %rax
+	js	.L811
+	je	.L812
+	movq	%rax, 8(%rsp)
+	xorl	%r14d, %r14d
+	movq	%rax, 376(%rsp)
+	jmp	.L553
+	.p2align 4,,10
+	.p2align 3
+.L797:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L484
+	cmpl	$2, 8(%rsp)
+	jne	.L779
+.L479:
+	cmpl	$2, 40(%rsp)
+	je	.L486
+.L789:
+	cmpb	$0, 36(%rsp)
+	je	.L514
+.L799:
+	movl	%ebx, %edi
+	call	close@PLT
+	jmp	.L514
+	.p2align 4,,10
+	.p2align 3
+.L794:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L441
+.L439:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC21(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB12:
+	call	__cxa_throw@PLT
+.LEHE12:
+	.p2align 4,,10
+	.p2align 3
+.L810:
+	movl	$1, %eax
+.L549:
+	movb	%r14b, 341(%rsp)
+	movb	%al, 342(%rsp)
+	jmp	.L520
+.L791:
+	cmpl	$2, 40(%rsp)
+	je	.L418
+.L419:
+	testb	%bl, %bl
+	je	.L417
+.L415:
+	movl	$2, 8(%rsp)
+	jmp	.L425
+	.p2align 4,,10
+	.p2align 3
+.L805:
+	cmpb	$111, 84(%rsp)
+	jne	.L555
+	movl	336(%rsp), %ebx
+	testl	%ebx, %ebx
+	js	.L813
+	movq	376(%rsp), %rax
+	cmpl	$2, 344(%rsp)
+	movq	%rax, 8(%rsp)
+	je	.L814
+.L559:
+	movl	$1, 344(%rsp)
+	movq	368(%rsp), %r13
+	xorl	%r12d, %r12d
+	.p2align 4,,10
+	.p2align 3
+.L601:
+	movq	8(%rsp), %rdx
+	subq	%r13, %rdx
+	jne	.L815
+	cmpb	$0, 341(%rsp)
+	jne	.L574
+	movzbl	342(%rsp), %eax
+	movb	%al, 16(%rsp)
+	testb	%al, %al
+	jne	.L574
+	movl	$32, %ebx
+	movq	360(%rsp), %r14
+	movl	336(%rsp), %ebp
+	subq	%r12, %rbx
+	cmpq	%r14, %rbx
+	jb	.L575
+	leaq	(%r15,%r12), %r14
+	jmp	.L578
+	.p2align 4,,10
+	.p2align 3
+.L817:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L816
+.L578:
+	movq	%rbx, %rdx
+	movq	%r14, %rsi
+	movl	%ebp, %edi
+.LEHB13:
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L817
+	je	.L818
+	addq	%rax, %r12
+.L573:
+	cmpq	$31, %r12
+	jbe	.L601
+	.p2align 4,,10
+	.p2align 3
+.L574:
+	cmpq	$19, %r12
+	jne	.L602
+	movabsq	$2406167339674837092, %rax
+	xorq	88(%rsp), %rax
+	movabsq	$7310016635655774752, %rdx
+	xorq	80(%rsp), %rdx
+	orq	%rdx, %rax
+	jne	.L603
+	cmpl	$169943329, 95(%rsp)
+	je	.L819
+.L603:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC29(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L815:
+	movl	$32, %eax
+	movq	352(%rsp), %rcx
+	subq	%r12, %rax
+	cmpq	%rdx, %rax
+	cmova	%rdx, %rax
+	leaq	(%r15,%r12), %rdx
+	addq	%r13, %rcx
+	cmpl	$8, %eax
+	jnb	.L567
+	testb	$4, %al
+	jne	.L820
+	testl	%eax, %eax
+	je	.L568
+	movzbl	(%rcx), %esi
+	movb	%sil, (%rdx)
+	testb	$2, %al
+	jne	.L821
+.L568:
+	addq	%rax, %r13
+	addq	%rax, %r12
+	movq	%r13, 368(%rsp)
+	jmp	.L573
+	.p2align 4,,10
+	.p2align 3
+.L575:
+	testl	%ebp, %ebp
+	js	.L574
+	movq	352(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L822
+.L581:
+	cmpl	$2, 344(%rsp)
+	je	.L823
+.L586:
+	movq	368(%rsp), %r13
+	movq	8(%rsp), %rax
+	movl	$1, 344(%rsp)
+	cmpq	%rax, %r13
+	jne	.L601
+	cmpb	$0, 341(%rsp)
+	jne	.L574
+	movzbl	342(%rsp), %r13d
+	testb	%r13b, %r13b
+	jne	.L574
+	testq	%rax, %rax
+	jne	.L824
+.L595:
+	testq	%r14, %r14
+	je	.L574
+	movl	336(%rsp), %ebp
+	jmp	.L598
+	.p2align 4,,10
+	.p2align 3
+.L826:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L825
+.L598:
+	movq	%r14, %rdx
+	movq	%rbx, %rsi
+	movl	%ebp, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L826
+	je	.L827
+	movq	%rax, 8(%rsp)
+	xorl	%r13d, %r13d
+	movq	%rax, 376(%rsp)
+	jmp	.L601
+	.p2align 4,,10
+	.p2align 3
+.L567:
+	movq	(%rcx), %rsi
+	movq	%rsi, (%rdx)
+	movl	%eax, %esi
+	movq	-8(%rcx,%rsi), %rdi
+	movq	%rdi, -8(%rdx,%rsi)
+	leaq	8(%rdx), %rdi
+	andq	$-8, %rdi
+	subq	%rdi, %rdx
+	subq	%rdx, %rcx
+	addl	%eax, %edx
+	andl	$-8, %edx
+	movq	%rcx, %rsi
+	cmpl	$8, %edx
+	jb	.L568
+	andl	$-8, %edx
+	xorl	%ecx, %ecx
+.L571:
+	movl	%ecx, %r8d
+	addl	$8, %ecx
+	movq	(%rsi,%r8), %r9
+	movq	%r9, (%rdi,%r8)
+	cmpl	%edx, %ecx
+	jb	.L571
+	jmp	.L568
+	.p2align 4,,10
+	.p2align 3
+.L816:
+	movl	$1, %eax
+.L577:
+	movzbl	16(%rsp), %ecx
+	movb	%al, 342(%rsp)
+	movb	%cl, 341(%rsp)
+	jmp	.L574
+	.p2align 4,,10
+	.p2align 3
+.L825:
+	movl	$1, %eax
+.L597:
+	movb	%r13b, 341(%rsp)
+	movb	%al, 342(%rsp)
+	jmp	.L574
+.L822:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L828
+.L583:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	360(%rsp), %r14
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%r14, %rsi
+	call	*16(%rax)
+	movq	%rax, 352(%rsp)
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L574
+	movq	376(%rsp), %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L581
+	.p2align 4,,10
+	.p2align 3
+.L807:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L829
+.L535:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	360(%rsp), %r13
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%r13, %rsi
+	call	*16(%rax)
+.LEHE13:
+	movq	%rax, 352(%rsp)
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L520
+	movq	376(%rsp), %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L533
+	.p2align 4,,10
+	.p2align 3
+.L792:
+	movq	72(%rsp), %rax
+	movq	64(%rsp), %rsi
+	cmpq	%rsi, %rax
+	je	.L429
+	subq	%rax, %rsi
+	movl	$1, %edx
+	movl	%ebp, %edi
+	call	lseek@PLT
+.L429:
+	pxor	%xmm0, %xmm0
+	cmpq	$17, 16(%rsp)
+	movl	$2, 40(%rsp)
+	movaps	%xmm0, 64(%rsp)
+	jbe	.L830
+.L430:
+	testq	%r14, %r14
+	je	.L831
+.L442:
+	movq	72(%rsp), %rbx
+	movq	16(%rsp), %rax
+	subq	%rbx, %rax
+	cmpq	$16, %rax
+	ja	.L784
+	cmpl	$2, 40(%rsp)
+	sete	%dl
+	testq	%rbx, %rbx
+	setne	%al
+	andb	%al, %dl
+	movl	%edx, %ebp
+	jne	.L449
+.L784:
+	leaq	(%r14,%rbx), %rax
+	movl	$1, %ebp
+	addq	$17, %rbx
+.L448:
+	movdqa	.LC32(%rip), %xmm0
+	movb	$33, 16(%rax)
+	movq	%rbx, 72(%rsp)
+	movups	%xmm0, (%rax)
+	movl	44(%rsp), %eax
+	movl	%eax, 8(%rsp)
+	cmpl	$2, %eax
+	je	.L454
+	testb	%bpl, %bpl
+	jne	.L440
+	jmp	.L439
+	.p2align 4,,10
+	.p2align 3
+.L795:
+	movq	72(%rsp), %rax
+	movq	64(%rsp), %rsi
+	cmpq	%rsi, %rax
+	je	.L470
+	subq	%rax, %rsi
+	movl	$1, %edx
+	movl	%ebx, %edi
+	call	lseek@PLT
+.L470:
+	pxor	%xmm0, %xmm0
+	cmpq	$1, 16(%rsp)
+	movl	$2, 40(%rsp)
+	movaps	%xmm0, 64(%rsp)
+	jbe	.L832
+.L471:
+	testq	%r14, %r14
+	je	.L833
+.L487:
+	movq	72(%rsp), %rbp
+	movq	16(%rsp), %rax
+	cmpq	%rax, %rbp
+	jne	.L645
+	cmpl	$2, 40(%rsp)
+	jne	.L645
+	cmpq	$0, 16(%rsp)
+	jne	.L634
+.L645:
+	leaq	(%r14,%rbp), %rax
+	addq	$1, %rbp
+.L493:
+	movb	$10, (%rax)
+	movq	%rbp, 72(%rsp)
+.L498:
+	movl	44(%rsp), %eax
+	subl	$1, %eax
+	cmpl	$1, %eax
+	ja	.L501
+	cmpl	$2, 40(%rsp)
+	je	.L834
+.L501:
+	testl	%ebx, %ebx
+	js	.L468
+	cmpl	$2, 40(%rsp)
+	jne	.L789
+	jmp	.L486
+.L855:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L460
+	xorl	%ebp, %ebp
+	cmpl	$2, 44(%rsp)
+	jne	.L439
+.L454:
+	cmpl	$2, 40(%rsp)
+	je	.L835
+.L461:
+	movl	$2, 8(%rsp)
+	testb	%bpl, %bpl
+	jne	.L440
+	jmp	.L439
+.L820:
+	movl	(%rcx), %esi
+	movl	%esi, (%rdx)
+	movl	%eax, %esi
+	movl	-4(%rcx,%rsi), %ecx
+	movl	%ecx, -4(%rdx,%rsi)
+	jmp	.L568
+.L800:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L517
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L517
+.L819:
+	cmpb	$0, 341(%rsp)
+	je	.L836
+	cmpb	$0, 342(%rsp)
+	jne	.L767
+	leaq	.LC4(%rip), %rdi
+	call	remove@PLT
+	movl	336(%rsp), %ebx
+	movq	352(%rsp), %rbp
+	testl	%ebx, %ebx
+	js	.L608
+	cmpl	$2, 344(%rsp)
+	je	.L837
+.L609:
+	cmpb	$0, 340(%rsp)
+	jne	.L838
+.L614:
+	movl	$-1, 336(%rsp)
+.L608:
+	testq	%rbp, %rbp
+	je	.L395
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L839
+.L617:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	360(%rsp), %rdx
+	movl	$64, %ecx
+	movq	352(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L395:
+	addq	$600, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L837:
+	.cfi_restore_state
+	movq	376(%rsp), %r12
+	testq	%r12, %r12
+	je	.L609
+	movq	%rbp, %r13
+.L613:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L840
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L613
+.L612:
+	movq	$0, 376(%rsp)
+	jmp	.L609
+.L838:
+	movl	%ebx, %edi
+	call	close@PLT
+	jmp	.L614
+.L839:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L617
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L617
+.L808:
+	cmpq	$0, 8(%rsp)
+	jne	.L539
+.L544:
+	movq	$0, 8(%rsp)
+	jmp	.L538
+.L823:
+	cmpq	$0, 8(%rsp)
+	jne	.L587
+.L592:
+	movq	$0, 8(%rsp)
+	jmp	.L586
+.L814:
+	testq	%rax, %rax
+	jne	.L560
+.L565:
+	movq	$0, 8(%rsp)
+	jmp	.L559
+.L418:
+	testq	%rbp, %rbp
+	je	.L419
+.L416:
+	movl	32(%rsp), %r15d
+	movq	%r14, %r13
+.L424:
+	movq	%rbp, %rdx
+	movq	%r13, %rsi
+	movl	%r15d, %edi
+.LEHB14:
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L841
+	addq	%rax, %r13
+	subq	%rax, %rbp
+	jne	.L424
+	movq	$0, 72(%rsp)
+	jmp	.L419
+	.p2align 4,,10
+	.p2align 3
+.L829:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L535
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L535
+.L828:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L583
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L583
+.L821:
+	movl	%eax, %esi
+	movzwl	-2(%rcx,%rsi), %ecx
+	movw	%cx, -2(%rdx,%rsi)
+	jmp	.L568
+.L840:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L612
+	jmp	.L613
+.L400:
+	movl	32(%rsp), %r13d
+	movl	$6, %ebx
+	leaq	.LC15(%rip), %rbp
+.L414:
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movl	%r13d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L842
+	addq	%rax, %rbp
+	subq	%rax, %rbx
+	jne	.L414
+	movl	44(%rsp), %eax
+	movl	%eax, 8(%rsp)
+	cmpl	$2, %eax
+	jne	.L425
+	cmpl	$2, 40(%rsp)
+	jne	.L415
+	movq	72(%rsp), %rbp
+	testq	%rbp, %rbp
+	je	.L415
+	movl	$1, %ebx
+	jmp	.L416
+	.p2align 4,,10
+	.p2align 3
+.L842:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L414
+	cmpl	$2, 44(%rsp)
+	je	.L843
+.L417:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC20(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE14:
+	.p2align 4,,10
+	.p2align 3
+.L798:
+	movq	%r14, %rbp
+.L509:
+	movq	%r13, %rdx
+	movq	%rbp, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L844
+	addq	%rax, %rbp
+	subq	%rax, %r13
+	jne	.L509
+.L512:
+	movq	$0, 72(%rsp)
+	jmp	.L478
+.L844:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L512
+	jmp	.L509
+.L835:
+	movq	72(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L461
+	movl	32(%rsp), %eax
+	movq	%r14, %r13
+	movl	%eax, 8(%rsp)
+.L466:
+	movl	8(%rsp), %edi
+	movq	%rbx, %rdx
+	movq	%r13, %rsi
+.LEHB15:
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L845
+	addq	%rax, %r13
+	subq	%rax, %rbx
+	jne	.L466
+	movq	$0, 72(%rsp)
+	jmp	.L461
+	.p2align 4,,10
+	.p2align 3
+.L793:
+	movq	%r14, %r13
+.L436:
+	movq	%rbx, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L846
+	addq	%rax, %r13
+	subq	%rax, %rbx
+	jne	.L436
+	movq	$0, 72(%rsp)
+	jmp	.L431
+	.p2align 4,,10
+	.p2align 3
+.L846:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L436
+.L771:
+	movq	$0, 72(%rsp)
+	jmp	.L439
+.L796:
+	movq	%r14, %r13
+.L477:
+	movq	%rbp, %rdx
+	movq	%r13, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+.LEHE15:
+	testq	%rax, %rax
+	js	.L847
+	addq	%rax, %r13
+	subq	%rax, %rbp
+	jne	.L477
+	movq	$0, 72(%rsp)
+	jmp	.L472
+	.p2align 4,,10
+	.p2align 3
+.L847:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L477
+	movq	$0, 72(%rsp)
+	cmpl	$2, 8(%rsp)
+	je	.L479
+	cmpl	$1, 8(%rsp)
+	jne	.L478
+	jmp	.L479
+.L587:
+	movl	336(%rsp), %r13d
+	movq	%rbx, %rbp
+.L591:
+	movq	8(%rsp), %rdx
+	movq	%rbp, %rsi
+	movl	%r13d, %edi
+.LEHB16:
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L848
+	addq	%rax, %rbp
+	subq	%rax, 8(%rsp)
+	jne	.L591
+.L590:
+	movq	$0, 376(%rsp)
+	jmp	.L592
+.L848:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L590
+	jmp	.L591
+.L845:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L771
+	jmp	.L466
+.L539:
+	movl	336(%rsp), %r14d
+	movq	%rbx, %rbp
+.L543:
+	movq	8(%rsp), %rdx
+	movq	%rbp, %rsi
+	movl	%r14d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L849
+	addq	%rax, %rbp
+	subq	%rax, 8(%rsp)
+	jne	.L543
+.L542:
+	movq	$0, 376(%rsp)
+	jmp	.L544
+.L849:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L542
+	jmp	.L543
+.L560:
+	movq	352(%rsp), %rbp
+.L564:
+	movq	8(%rsp), %rdx
+	movq	%rbp, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+.LEHE16:
+	testq	%rax, %rax
+	js	.L850
+	addq	%rax, %rbp
+	subq	%rax, 8(%rsp)
+	jne	.L564
+.L563:
+	movq	$0, 376(%rsp)
+	jmp	.L565
+.L850:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L563
+	jmp	.L564
+.L841:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L424
+	movq	$0, 72(%rsp)
+	jmp	.L417
+.L834:
+	movq	72(%rsp), %rbp
+	testq	%rbp, %rbp
+	je	.L501
+	movq	%r14, %r13
+.L508:
+	movq	%rbp, %rdx
+	movq	%r13, %rsi
+	movl	%ebx, %edi
+.LEHB17:
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L851
+	addq	%rax, %r13
+	subq	%rax, %rbp
+	jne	.L508
+.L777:
+	movq	$0, 72(%rsp)
+	jmp	.L501
+.L851:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L777
+	jmp	.L508
+.L833:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L852
+.L489:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	56(%rsp), %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%rsi, 16(%rsp)
+	call	*16(%rax)
+	movq	%rax, 48(%rsp)
+	movl	32(%rsp), %ebx
+	movq	%rax, %r14
+	testq	%rax, %rax
+	jne	.L487
+	movl	$1, %r13d
+	leaq	.LC17(%rip), %rbp
+.L491:
+	movq	%r13, %rdx
+	movq	%rbp, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L853
+	addq	%rax, %rbp
+	subq	%rax, %r13
+	jne	.L491
+	jmp	.L498
+.L853:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L498
+	jmp	.L491
+.L831:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L854
+.L444:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	56(%rsp), %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%rsi, 16(%rsp)
+	call	*16(%rax)
+	movq	%rax, 48(%rsp)
+	movq	%rax, %r14
+	testq	%rax, %rax
+	jne	.L442
+	movl	32(%rsp), %r13d
+	movl	$17, %ebp
+	leaq	.LC16(%rip), %rbx
+.L460:
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movl	%r13d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L855
+	addq	%rax, %rbx
+	subq	%rax, %rbp
+	jne	.L460
+	movl	44(%rsp), %eax
+	movl	%eax, 8(%rsp)
+	cmpl	$2, %eax
+	jne	.L440
+	movl	$1, %ebp
+	jmp	.L454
+.L824:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 368(%rsp)
+	jmp	.L595
+.L813:
+	jmp	.L602
+.L809:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 368(%rsp)
+	jmp	.L547
+.L843:
+	cmpl	$2, 40(%rsp)
+	jne	.L417
+	movq	72(%rsp), %rbp
+	testq	%rbp, %rbp
+	je	.L417
+	xorl	%ebx, %ebx
+	jmp	.L416
+.L852:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L489
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L489
+.L854:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L444
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L444
+.L449:
+	movl	32(%rsp), %eax
+	movq	%r14, %r13
+	movl	%eax, 8(%rsp)
+.L453:
+	movl	8(%rsp), %edi
+	movq	%rbx, %rdx
+	movq	%r13, %rsi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L856
+	addq	%rax, %r13
+	subq	%rax, %rbx
+	jne	.L453
+.L452:
+	movq	%r14, %rax
+	movl	$17, %ebx
+	jmp	.L448
+.L818:
+	movb	$1, 16(%rsp)
+	xorl	%eax, %eax
+	jmp	.L577
+.L856:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L453
+	xorl	%ebp, %ebp
+	jmp	.L452
+.L634:
+	movq	%r14, %r13
+.L494:
+	movq	%rbp, %rdx
+	movq	%r13, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L857
+	addq	%rax, %r13
+	subq	%rax, %rbp
+	jne	.L494
+.L785:
+	movq	%r14, %rax
+	movl	$1, %ebp
+	jmp	.L493
+.L403:
+	movl	32(%rsp), %r15d
+	movq	%r14, %r13
+.L407:
+	movq	%rbp, %rdx
+	movq	%r13, %rsi
+	movl	%r15d, %edi
+	call	write@PLT
+.LEHE17:
+	testq	%rax, %rax
+	js	.L858
+	addq	%rax, %r13
+	subq	%rax, %rbp
+	jne	.L407
+.L406:
+	movq	%r14, %rax
+	movl	$6, %ebp
+	jmp	.L402
+.L804:
+	movb	$1, 16(%rsp)
+	xorl	%eax, %eax
+	jmp	.L528
+.L857:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L785
+	jmp	.L494
+.L858:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L407
+	xorl	%ebx, %ebx
+	jmp	.L406
+.L827:
+	xorl	%eax, %eax
+	movl	$1, %r13d
+	jmp	.L597
+.L812:
+	xorl	%eax, %eax
+	movl	$1, %r14d
+	jmp	.L549
+.L759:
+	jmp	.L760
+.L761:
+	jmp	.L762
+.L836:
+	jmp	.L766
+	.section	.gcc_except_table
+.LLSDA6875:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6875-.LLSDACSB6875
+.LLSDACSB6875:
+	.uleb128 .LEHB8-.LFB6875
+	.uleb128 .LEHE8-.LEHB8
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB9-.LFB6875
+	.uleb128 .LEHE9-.LEHB9
+	.uleb128 .L759-.LFB6875
+	.uleb128 0
+	.uleb128 .LEHB10-.LFB6875
+	.uleb128 .LEHE10-.LEHB10
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB11-.LFB6875
+	.uleb128 .LEHE11-.LEHB11
+	.uleb128 .L761-.LFB6875
+	.uleb128 0
+	.uleb128 .LEHB12-.LFB6875
+	.uleb128 .LEHE12-.LEHB12
+	.uleb128 .L759-.LFB6875
+	.uleb128 0
+	.uleb128 .LEHB13-.LFB6875
+	.uleb128 .LEHE13-.LEHB13
+	.uleb128 .L761-.LFB6875
+	.uleb128 0
+	.uleb128 .LEHB14-.LFB6875
+	.uleb128 .LEHE14-.LEHB14
+	.uleb128 .L759-.LFB6875
+	.uleb128 0
+	.uleb128 .LEHB15-.LFB6875
+	.uleb128 .LEHE15-.LEHB15
+	.uleb128 .L759-.LFB6875
+	.uleb128 0
+	.uleb128 .LEHB16-.LFB6875
+	.uleb128 .LEHE16-.LEHB16
+	.uleb128 .L761-.LFB6875
+	.uleb128 0
+	.uleb128 .LEHB17-.LFB6875
+	.uleb128 .LEHE17-.LEHB17
+	.uleb128 .L759-.LFB6875
+	.uleb128 0
+.LLSDACSE6875:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6875
+	.type	_Z23test_fd_file_write_readv.cold, @function
+_Z23test_fd_file_write_readv.cold:
+.LFSB6875:
+.L763:
+	.cfi_def_cfa_offset 656
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC19(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB18:
+	call	__cxa_throw@PLT
+.LEHE18:
+.L643:
+.L760:
+	movq	%rax, %rbx
+	leaq	32(%rsp), %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB19:
+	call	_Unwind_Resume@PLT
+.LEHE19:
+.L602:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC27(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB20:
+	call	__cxa_throw@PLT
+.LEHE20:
+.L764:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC8(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB21:
+	call	__cxa_throw@PLT
+.LEHE21:
+.L644:
+.L762:
+	movq	24(%rsp), %rdi
+	movq	%rax, %rbx
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB22:
+	call	_Unwind_Resume@PLT
+.LEHE22:
+.L767:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC31(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB23:
+	call	__cxa_throw@PLT
+.LEHE23:
+.L765:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC22(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB24:
+	call	__cxa_throw@PLT
+.LEHE24:
+.L766:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC30(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB25:
+	call	__cxa_throw@PLT
+.LEHE25:
+	.cfi_endproc
+.LFE6875:
+	.section	.gcc_except_table
+.LLSDAC6875:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6875-.LLSDACSBC6875
+.LLSDACSBC6875:
+	.uleb128 .LEHB18-.LCOLDB33
+	.uleb128 .LEHE18-.LEHB18
+	.uleb128 .L643-.LCOLDB33
+	.uleb128 0
+	.uleb128 .LEHB19-.LCOLDB33
+	.uleb128 .LEHE19-.LEHB19
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB20-.LCOLDB33
+	.uleb128 .LEHE20-.LEHB20
+	.uleb128 .L644-.LCOLDB33
+	.uleb128 0
+	.uleb128 .LEHB21-.LCOLDB33
+	.uleb128 .LEHE21-.LEHB21
+	.uleb128 .L643-.LCOLDB33
+	.uleb128 0
+	.uleb128 .LEHB22-.LCOLDB33
+	.uleb128 .LEHE22-.LEHB22
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB23-.LCOLDB33
+	.uleb128 .LEHE23-.LEHB23
+	.uleb128 .L644-.LCOLDB33
+	.uleb128 0
+	.uleb128 .LEHB24-.LCOLDB33
+	.uleb128 .LEHE24-.LEHB24
+	.uleb128 .L643-.LCOLDB33
+	.uleb128 0
+	.uleb128 .LEHB25-.LCOLDB33
+	.uleb128 .LEHE25-.LEHB25
+	.uleb128 .L644-.LCOLDB33
+	.uleb128 0
+.LLSDACSEC6875:
+	.section	.text.unlikely
+	.text
+	.size	_Z23test_fd_file_write_readv, .-_Z23test_fd_file_write_readv
+	.section	.text.unlikely
+	.size	_Z23test_fd_file_write_readv.cold, .-_Z23test_fd_file_write_readv.cold
+.LCOLDE33:
+	.text
+.LHOTE33:
+	.section	.rodata.str1.1
+.LC34:
+	.string	"abcdef"
+.LC35:
+	.string	"XY"
+	.section	.rodata.str1.8
+	.align 8
+.LC37:
+	.string	"expected equal : expected value : f.read(b, 6), actual value : 6"
+	.section	.rodata.str1.1
+.LC38:
+	.string	"aXYdef"
+	.section	.rodata.str1.8
+	.align 8
+.LC39:
+	.string	"expected true : memcmp(b, \"aXYdef\", 6) == 0"
+	.align 8
+.LC40:
+	.string	"expected equal : expected value : f.tell(), actual value : 3"
+	.section	.text.unlikely
+.LCOLDB41:
+	.text
+.LHOTB41:
+	.p2align 4
+	.globl	_Z28test_fd_file_read_then_writev
+	.type	_Z28test_fd_file_read_then_writev, @function
+_Z28test_fd_file_read_then_writev:
+.LFB6881:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6881
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$438, %edx
+	movl	$524865, %esi
+	xorl	%eax, %eax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	leaq	.LC4(%rip), %rdi
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$88, %rsp
+	.cfi_def_cfa_offset 144
+.LEHB26:
+	call	open@PLT
+.LEHE26:
+	movzwl	.LC5(%rip), %ebp
+	movb	$0, 38(%rsp)
+	movdqa	.LC36(%rip), %xmm0
+	movl	%eax, 32(%rsp)
+	movw	%bp, 36(%rsp)
+	movq	$0, 40(%rsp)
+	movq	$0, 48(%rsp)
+	movq	$0, 72(%rsp)
+	movups	%xmm0, 56(%rsp)
+	testl	%eax, %eax
+	js	.L860
+	movl	$2, 40(%rsp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1121
+.L862:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	56(%rsp), %r14
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%r14, %rsi
+.LEHB27:
+	call	*16(%rax)
+.LEHE27:
+	movq	%rax, 48(%rsp)
+	movl	32(%rsp), %ebx
+	movq	%rax, %r12
+	testq	%rax, %rax
+	je	.L1015
+	movq	72(%rsp), %r13
+	movq	%r14, %rax
+	subq	%r13, %rax
+	cmpq	$5, %rax
+	ja	.L1027
+	cmpl	$2, 40(%rsp)
+	jne	.L1027
+	testq	%r13, %r13
+	jne	.L1016
+.L1027:
+	leaq	(%r12,%r13), %rax
+	addq	$6, %r13
+.L866:
+	movl	$26213, %edx
+	cmpl	$2, 44(%rsp)
+	movl	$1684234849, (%rax)
+	movw	%dx, 4(%rax)
+	movq	%r13, 72(%rsp)
+	je	.L871
+	testl	%ebx, %ebx
+	js	.L878
+.L877:
+	cmpl	$2, 40(%rsp)
+	je	.L1122
+.L887:
+	cmpb	$0, 36(%rsp)
+	jne	.L1123
+.L892:
+	movl	$-1, 32(%rsp)
+.L893:
+	testq	%r12, %r12
+	je	.L860
+.L878:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1124
+.L895:
+	movq	56(%rsp), %rdx
+	movq	48(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L860:
+	movl	$438, %edx
+	movl	$524290, %esi
+	leaq	.LC4(%rip), %rdi
+	xorl	%eax, %eax
+.LEHB28:
+	call	open@PLT
+.LEHE28:
+	movdqa	.LC7(%rip), %xmm0
+	movw	%bp, 36(%rsp)
+	movl	%eax, 32(%rsp)
+	movl	%eax, %ebx
+	movb	$0, 38(%rsp)
+	movq	$0, 40(%rsp)
+	movq	$0, 48(%rsp)
+	movq	$0, 72(%rsp)
+	movups	%xmm0, 56(%rsp)
+	testl	%eax, %eax
+	js	.L953
+	cmpb	$0, 37(%rsp)
+	movl	$1, 40(%rsp)
+	jne	.L898
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1125
+.L902:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	56(%rsp), %r12
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%r12, %rsi
+.LEHB29:
+	call	*16(%rax)
+	movq	%rax, 48(%rsp)
+	movl	32(%rsp), %ebx
+	movq	%rax, %rbp
+	testq	%rax, %rax
+	jne	.L1126
+.L898:
+	testl	%ebx, %ebx
+	js	.L953
+	cmpl	$1, 40(%rsp)
+	je	.L1014
+.L918:
+	movq	56(%rsp), %rbp
+	movl	$2, 40(%rsp)
+	cmpq	$2, %rbp
+	ja	.L920
+	movq	72(%rsp), %rbp
+	testq	%rbp, %rbp
+	jne	.L1127
+.L921:
+	movl	$2, %ebp
+	leaq	.LC35(%rip), %r12
+	.p2align 4,,10
+	.p2align 3
+.L930:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1128
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L930
+	.p2align 4,,10
+	.p2align 3
+.L1013:
+	xorl	%esi, %esi
+	movl	$1, %edx
+	movl	%ebx, %edi
+	call	lseek@PLT
+	testq	%rax, %rax
+	js	.L953
+	cmpl	$2, 40(%rsp)
+	movq	72(%rsp), %rbp
+	je	.L1129
+	subq	64(%rsp), %rbp
+	subq	%rbp, %rax
+	cmpq	$3, %rax
+	jne	.L953
+.L959:
+	pxor	%xmm0, %xmm0
+	xorl	%edx, %edx
+	xorl	%esi, %esi
+	movl	%ebx, %edi
+	movw	$0, 37(%rsp)
+	xorl	%r14d, %r14d
+	xorl	%r12d, %r12d
+	movaps	%xmm0, 64(%rsp)
+	call	lseek@PLT
+	movl	$1, 40(%rsp)
+	movq	$0, 8(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L956:
+	movq	8(%rsp), %rax
+	subq	%r14, %rax
+	jne	.L1130
+	cmpb	$0, 37(%rsp)
+	jne	.L965
+	movzbl	38(%rsp), %r15d
+	testb	%r15b, %r15b
+	jne	.L965
+	movl	$6, %ebx
+	movq	56(%rsp), %r13
+	movl	32(%rsp), %ebp
+	subq	%r12, %rbx
+	cmpq	%r13, %rbx
+	jb	.L966
+	leaq	26(%rsp,%r12), %r13
+	jmp	.L969
+	.p2align 4,,10
+	.p2align 3
+.L1132:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1131
+.L969:
+	movq	%rbx, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L1132
+	je	.L1133
+	addq	%rax, %r12
+.L964:
+	cmpq	$5, %r12
+	jbe	.L956
+.L965:
+	cmpq	$6, %r12
+	jne	.L971
+	cmpl	$1683576929, 26(%rsp)
+	je	.L1134
+.L994:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC39(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L1125:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L902
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L902
+.L1121:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L862
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L862
+	.p2align 4,,10
+	.p2align 3
+.L1130:
+	movl	$6, %ecx
+	movq	48(%rsp), %r8
+	leaq	26(%rsp,%r12), %rdi
+	subq	%r12, %rcx
+	cmpq	%rax, %rcx
+	cmova	%rax, %rcx
+	addq	%r14, %r8
+	movl	%ecx, %r9d
+	testl	%ecx, %ecx
+	je	.L963
+	xorl	%eax, %eax
+.L962:
+	movl	%eax, %edx
+	addl	$1, %eax
+	movzbl	(%r8,%rdx), %esi
+	movb	%sil, (%rdi,%rdx)
+	cmpl	%r9d, %eax
+	jb	.L962
+.L963:
+	addq	%rcx, %r14
+	addq	%rcx, %r12
+	movq	%r14, 64(%rsp)
+	jmp	.L964
+	.p2align 4,,10
+	.p2align 3
+.L966:
+	testl	%ebp, %ebp
+	jns	.L1135
+.L971:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC37(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L1131:
+	movl	$1, %eax
+.L968:
+	movb	%r15b, 37(%rsp)
+	movb	%al, 38(%rsp)
+	jmp	.L971
+	.p2align 4,,10
+	.p2align 3
+.L1135:
+	movq	48(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L1136
+.L973:
+	cmpl	$2, 40(%rsp)
+	je	.L1137
+.L978:
+	movq	64(%rsp), %r14
+	movq	8(%rsp), %rax
+	movl	$1, 40(%rsp)
+	cmpq	%rax, %r14
+	jne	.L956
+	cmpb	$0, 37(%rsp)
+	jne	.L971
+	movzbl	38(%rsp), %r14d
+	testb	%r14b, %r14b
+	jne	.L971
+	testq	%rax, %rax
+	jne	.L1138
+.L987:
+	testq	%r13, %r13
+	je	.L971
+	movl	32(%rsp), %ebp
+	jmp	.L990
+	.p2align 4,,10
+	.p2align 3
+.L1140:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1139
+.L990:
+	movq	%r13, %rdx
+	movq	%rbx, %rsi
+	movl	%ebp, %edi
+	call	read@PLT
+.LEHE29:
+	testq	%rax, %rax
+	js	.L1140
+	je	.L1141
+	movq	%rax, 8(%rsp)
+	xorl	%r14d, %r14d
+	movq	%rax, 72(%rsp)
+	jmp	.L956
+	.p2align 4,,10
+	.p2align 3
+.L1128:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1013
+	jmp	.L930
+	.p2align 4,,10
+	.p2align 3
+.L1139:
+	movl	$1, %eax
+.L989:
+	movb	%r14b, 37(%rsp)
+	movb	%al, 38(%rsp)
+	jmp	.L965
+.L871:
+	cmpl	$2, 40(%rsp)
+	je	.L1142
+.L1115:
+	testl	%ebx, %ebx
+	js	.L893
+	cmpb	$0, 36(%rsp)
+	je	.L892
+.L1123:
+	movl	%ebx, %edi
+	call	close@PLT
+	jmp	.L892
+	.p2align 4,,10
+	.p2align 3
+.L1134:
+	cmpw	$26213, 30(%rsp)
+	jne	.L994
+	movl	32(%rsp), %r13d
+	movq	48(%rsp), %rbx
+	testl	%r13d, %r13d
+	js	.L997
+	cmpl	$2, 40(%rsp)
+	je	.L1143
+.L998:
+	cmpb	$0, 36(%rsp)
+	jne	.L1144
+.L1003:
+	movl	$-1, 32(%rsp)
+.L997:
+	testq	%rbx, %rbx
+	je	.L1004
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1145
+.L1006:
+	movq	56(%rsp), %rdx
+	movq	48(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1004:
+	addq	$88, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	leaq	.LC4(%rip), %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	remove@PLT
+.L1136:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1146
+.L975:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	56(%rsp), %r13
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%r13, %rsi
+.LEHB30:
+	call	*16(%rax)
+	movq	%rax, 48(%rsp)
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L971
+	movq	72(%rsp), %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L973
+	.p2align 4,,10
+	.p2align 3
+.L1014:
+	movq	72(%rsp), %rax
+	movq	64(%rsp), %rsi
+	cmpq	%rsi, %rax
+	je	.L919
+	subq	%rax, %rsi
+	movl	$1, %edx
+	movl	%ebx, %edi
+	call	lseek@PLT
+.L919:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 64(%rsp)
+	jmp	.L918
+.L1129:
+	addq	%rbp, %rax
+	cmpq	$3, %rax
+	jne	.L1147
+	testq	%rbp, %rbp
+	je	.L959
+	movq	48(%rsp), %r12
+.L960:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+.LEHE30:
+	testq	%rax, %rax
+	js	.L1148
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L960
+	jmp	.L959
+	.p2align 4,,10
+	.p2align 3
+.L920:
+	movq	48(%rsp), %r12
+	testq	%r12, %r12
+	je	.L1149
+.L931:
+	movq	72(%rsp), %r13
+	subq	%r13, %rbp
+	cmpq	$1, %rbp
+	ja	.L1028
+	cmpl	$2, 40(%rsp)
+	jne	.L1028
+	testq	%r13, %r13
+	jne	.L1021
+.L1028:
+	addq	%r13, %r12
+	addq	$2, %r13
+.L937:
+	movl	$22872, %eax
+	movq	%r13, 72(%rsp)
+	movw	%ax, (%r12)
+.L942:
+	cmpl	$2, 44(%rsp)
+	je	.L1150
+.L945:
+	testl	%ebx, %ebx
+	jns	.L1013
+	jmp	.L953
+	.p2align 4,,10
+	.p2align 3
+.L1143:
+	movq	72(%rsp), %rbp
+	testq	%rbp, %rbp
+	je	.L998
+	movq	%rbx, %r12
+.L1002:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%r13d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1151
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L1002
+.L1001:
+	movq	$0, 72(%rsp)
+	jmp	.L998
+.L1150:
+	cmpl	$2, 40(%rsp)
+	jne	.L945
+	movq	72(%rsp), %rbp
+	testq	%rbp, %rbp
+	je	.L945
+	movq	48(%rsp), %r12
+.L952:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%ebx, %edi
+.LEHB31:
+	call	write@PLT
+.LEHE31:
+	testq	%rax, %rax
+	js	.L1152
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L952
+.L951:
+	movq	$0, 72(%rsp)
+	jmp	.L945
+.L1144:
+	movl	%r13d, %edi
+	call	close@PLT
+	jmp	.L1003
+.L1145:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1006
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1006
+.L1124:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L895
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L895
+.L1137:
+	cmpq	$0, 8(%rsp)
+	jne	.L979
+.L984:
+	movq	$0, 8(%rsp)
+	jmp	.L978
+.L1142:
+	movq	72(%rsp), %r13
+	testq	%r13, %r13
+	je	.L1115
+	movq	%r12, %r14
+.L884:
+	movq	%r13, %rdx
+	movq	%r14, %rsi
+	movl	%ebx, %edi
+.LEHB32:
+	call	write@PLT
+.LEHE32:
+	testq	%rax, %rax
+	js	.L1153
+	addq	%rax, %r14
+	subq	%rax, %r13
+	jne	.L884
+.L883:
+	movq	$0, 72(%rsp)
+	jmp	.L1115
+.L1122:
+	movq	72(%rsp), %r14
+	testq	%r14, %r14
+	je	.L887
+	movq	%r12, %r13
+.L891:
+	movq	%r14, %rdx
+	movq	%r13, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1154
+	addq	%rax, %r13
+	subq	%rax, %r14
+	jne	.L891
+.L890:
+	movq	$0, 72(%rsp)
+	jmp	.L887
+.L1146:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L975
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L975
+.L1151:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1001
+	jmp	.L1002
+.L1154:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L890
+	jmp	.L891
+.L1148:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L959
+	jmp	.L960
+.L1015:
+	movl	$6, %r13d
+	leaq	.LC34(%rip), %r14
+.L864:
+	movq	%r13, %rdx
+	movq	%r14, %rsi
+	movl	%ebx, %edi
+.LEHB33:
+	call	write@PLT
+.LEHE33:
+	testq	%rax, %rax
+	js	.L1155
+	addq	%rax, %r14
+	subq	%rax, %r13
+	jne	.L864
+.L876:
+	cmpl	$2, 44(%rsp)
+	je	.L871
+	testl	%ebx, %ebx
+	jns	.L877
+	jmp	.L860
+.L1155:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L876
+	jmp	.L864
+.L1127:
+	movq	48(%rsp), %r12
+.L926:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%ebx, %edi
+.LEHB34:
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1156
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L926
+	movq	$0, 72(%rsp)
+	jmp	.L921
+	.p2align 4,,10
+	.p2align 3
+.L1156:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L926
+	movq	$0, 72(%rsp)
+	jmp	.L1013
+.L979:
+	movl	32(%rsp), %r14d
+	movq	%rbx, %rbp
+.L983:
+	movq	8(%rsp), %rdx
+	movq	%rbp, %rsi
+	movl	%r14d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1157
+	addq	%rax, %rbp
+	subq	%rax, 8(%rsp)
+	jne	.L983
+.L982:
+	movq	$0, 72(%rsp)
+	jmp	.L984
+.L1157:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L982
+	jmp	.L983
+.L1152:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L951
+	jmp	.L952
+.L1153:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L883
+	jmp	.L884
+.L1149:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1158
+.L933:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	56(%rsp), %rbp
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%rbp, %rsi
+	call	*16(%rax)
+	movq	%rax, 48(%rsp)
+	movl	32(%rsp), %ebx
+	movq	%rax, %r12
+	testq	%rax, %rax
+	jne	.L931
+	movl	$2, %ebp
+	leaq	.LC35(%rip), %r12
+.L935:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1159
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L935
+	jmp	.L942
+.L1159:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L942
+	jmp	.L935
+.L1138:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 64(%rsp)
+	jmp	.L987
+.L1158:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L933
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L933
+.L1021:
+	movq	%r12, %rbp
+.L938:
+	movq	%r13, %rdx
+	movq	%rbp, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+.LEHE34:
+	testq	%rax, %rax
+	js	.L1160
+	addq	%rax, %rbp
+	subq	%rax, %r13
+	jne	.L938
+.L1118:
+	movl	$2, %r13d
+	jmp	.L937
+.L1133:
+	xorl	%eax, %eax
+	movl	$1, %r15d
+	jmp	.L968
+.L1016:
+	movq	%r12, %r14
+.L867:
+	movq	%r13, %rdx
+	movq	%r14, %rsi
+	movl	%ebx, %edi
+.LEHB35:
+	call	write@PLT
+.LEHE35:
+	testq	%rax, %rax
+	js	.L1161
+	addq	%rax, %r14
+	subq	%rax, %r13
+	jne	.L867
+.L1113:
+	movq	%r12, %rax
+	movl	$6, %r13d
+	jmp	.L866
+.L1160:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1118
+	jmp	.L938
+.L1161:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1113
+	jmp	.L867
+.L1141:
+	xorl	%eax, %eax
+	movl	$1, %r14d
+	jmp	.L989
+.L1126:
+	cmpl	$2, 40(%rsp)
+	movq	72(%rsp), %r14
+	je	.L1162
+.L905:
+	movq	64(%rsp), %rax
+	movl	$1, 40(%rsp)
+	cmpq	%r14, %rax
+	jne	.L911
+	cmpb	$0, 37(%rsp)
+	je	.L1163
+.L912:
+	testl	%ebx, %ebx
+	jns	.L1014
+	jmp	.L953
+	.p2align 4,,10
+	.p2align 3
+.L1163:
+	movzbl	38(%rsp), %r13d
+	testb	%r13b, %r13b
+	jne	.L912
+	testq	%r14, %r14
+	jne	.L1164
+.L913:
+	testq	%r12, %r12
+	jne	.L916
+	jmp	.L912
+	.p2align 4,,10
+	.p2align 3
+.L1166:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1165
+.L916:
+	movq	%r12, %rdx
+	movq	%rbp, %rsi
+	movl	%ebx, %edi
+.LEHB36:
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L1166
+	je	.L1167
+	movq	%rax, 72(%rsp)
+	xorl	%eax, %eax
+.L911:
+	addq	$1, %rax
+	movq	%rax, 64(%rsp)
+	jmp	.L898
+	.p2align 4,,10
+	.p2align 3
+.L1165:
+	movl	$1, %eax
+.L915:
+	movb	%r13b, 37(%rsp)
+	movb	%al, 38(%rsp)
+	jmp	.L912
+.L1162:
+	testq	%r14, %r14
+	jne	.L1018
+.L910:
+	xorl	%r14d, %r14d
+	jmp	.L905
+.L1018:
+	movq	%rax, %r13
+.L906:
+	movq	%r14, %rdx
+	movq	%r13, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+.LEHE36:
+	testq	%rax, %rax
+	js	.L1168
+	addq	%rax, %r13
+	subq	%rax, %r14
+	jne	.L906
+.L909:
+	movq	$0, 72(%rsp)
+	jmp	.L910
+.L1168:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L909
+	jmp	.L906
+.L1164:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 64(%rsp)
+	jmp	.L913
+.L1167:
+	xorl	%eax, %eax
+	movl	$1, %r13d
+	jmp	.L915
+.L1147:
+	jmp	.L953
+.L1025:
+	movq	%rax, %rbx
+	jmp	.L1008
+.L1103:
+	jmp	.L1104
+	.section	.gcc_except_table
+.LLSDA6881:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6881-.LLSDACSB6881
+.LLSDACSB6881:
+	.uleb128 .LEHB26-.LFB6881
+	.uleb128 .LEHE26-.LEHB26
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB27-.LFB6881
+	.uleb128 .LEHE27-.LEHB27
+	.uleb128 .L1025-.LFB6881
+	.uleb128 0
+	.uleb128 .LEHB28-.LFB6881
+	.uleb128 .LEHE28-.LEHB28
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB29-.LFB6881
+	.uleb128 .LEHE29-.LEHB29
+	.uleb128 .L1103-.LFB6881
+	.uleb128 0
+	.uleb128 .LEHB30-.LFB6881
+	.uleb128 .LEHE30-.LEHB30
+	.uleb128 .L1103-.LFB6881
+	.uleb128 0
+	.uleb128 .LEHB31-.LFB6881
+	.uleb128 .LEHE31-.LEHB31
+	.uleb128 .L1103-.LFB6881
+	.uleb128 0
+	.uleb128 .LEHB32-.LFB6881
+	.uleb128 .LEHE32-.LEHB32
+	.uleb128 .L1025-.LFB6881
+	.uleb128 0
+	.uleb128 .LEHB33-.LFB6881
+	.uleb128 .LEHE33-.LEHB33
+	.uleb128 .L1025-.LFB6881
+	.uleb128 0
+	.uleb128 .LEHB34-.LFB6881
+	.uleb128 .LEHE34-.LEHB34
+	.uleb128 .L1103-.LFB6881
+	.uleb128 0
+	.uleb128 .LEHB35-.LFB6881
+	.uleb128 .LEHE35-.LEHB35
+	.uleb128 .L1025-.LFB6881
+	.uleb128 0
+	.uleb128 .LEHB36-.LFB6881
+	.uleb128 .LEHE36-.LEHB36
+	.uleb128 .L1103-.LFB6881
+	.uleb128 0
+.LLSDACSE6881:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6881
+	.type	_Z28test_fd_file_read_then_writev.cold, @function
+_Z28test_fd_file_read_then_writev.cold:
+.LFSB6881:
+.L953:
+	.cfi_def_cfa_offset 144
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC40(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB37:
+	call	__cxa_throw@PLT
+.LEHE37:
+.L1008:
+	leaq	32(%rsp), %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB38:
+	call	_Unwind_Resume@PLT
+.LEHE38:
+.L1026:
+.L1104:
+	movq	%rax, %rbx
+	leaq	32(%rsp), %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB39:
+	call	_Unwind_Resume@PLT
+.LEHE39:
+	.cfi_endproc
+.LFE6881:
+	.section	.gcc_except_table
+.LLSDAC6881:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6881-.LLSDACSBC6881
+.LLSDACSBC6881:
+	.uleb128 .LEHB37-.LCOLDB41
+	.uleb128 .LEHE37-.LEHB37
+	.uleb128 .L1026-.LCOLDB41
+	.uleb128 0
+	.uleb128 .LEHB38-.LCOLDB41
+	.uleb128 .LEHE38-.LEHB38
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB39-.LCOLDB41
+	.uleb128 .LEHE39-.LEHB39
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6881:
+	.section	.text.unlikely
+	.text
+	.size	_Z28test_fd_file_read_then_writev, .-_Z28test_fd_file_read_then_writev
+	.section	.text.unlikely
+	.size	_Z28test_fd_file_read_then_writev.cold, .-_Z28test_fd_file_read_then_writev.cold
+.LCOLDE41:
+	.text
+.LHOTE41:
+	.section	.rodata.str1.1
+.LC42:
+	.string	"."
+	.section	.rodata.str1.8
+	.align 8
+.LC43:
+	.string	"expected equal : expected value : f.read(b, 4), actual value : 0"
+	.section	.rodata.str1.1
+.LC44:
+	.string	"expected true : f.error()"
+.LC45:
+	.string	"expected false : f.eof()"
+	.section	.rodata.str1.8
+	.align 8
+.LC46:
+	.string	"expected equal : expected value : f.read(b, 32), actual value : 0"
+	.align 8
+.LC47:
+	.string	"expected equal : expected value : g.peek().len(), actual value : 0"
+	.section	.rodata.str1.1
+.LC48:
+	.string	"expected true : g.error()"
+.LC49:
+	.string	"expected false : g.eof()"
+	.section	.text.unlikely
+.LCOLDB50:
+	.text
+.LHOTB50:
+	.p2align 4
+	.globl	_Z23test_fd_file_read_errorv
+	.type	_Z23test_fd_file_read_errorv, @function
+_Z23test_fd_file_read_errorv:
+.LFB6876:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6876
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$438, %edx
+	movl	$524288, %esi
+	xorl	%eax, %eax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	leaq	.LC42(%rip), %rdi
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$152, %rsp
+	.cfi_def_cfa_offset 208
+.LEHB40:
+	call	open@PLT
+.LEHE40:
+	movzwl	.LC5(%rip), %ecx
+	movb	$0, 54(%rsp)
+	movdqa	.LC23(%rip), %xmm1
+	movl	%eax, 48(%rsp)
+	movw	%cx, 52(%rsp)
+	movq	$0, 56(%rsp)
+	movq	$0, 64(%rsp)
+	movq	$0, 88(%rsp)
+	movups	%xmm1, 72(%rsp)
+	testl	%eax, %eax
+	js	.L1389
+	movl	$1, 56(%rsp)
+	xorl	%r14d, %r14d
+	xorl	%r12d, %r12d
+	movq	$0, 8(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1203:
+	movq	8(%rsp), %rax
+	subq	%r14, %rax
+	jne	.L1396
+	cmpb	$0, 53(%rsp)
+	jne	.L1175
+	movzbl	54(%rsp), %r15d
+	testb	%r15b, %r15b
+	jne	.L1176
+	movl	$4, %ebx
+	movq	72(%rsp), %r13
+	movl	48(%rsp), %ebp
+	subq	%r12, %rbx
+	cmpq	%r13, %rbx
+	jb	.L1177
+	leaq	16(%rsp,%r12), %r13
+	jmp	.L1180
+	.p2align 4,,10
+	.p2align 3
+.L1398:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1397
+.L1180:
+	movq	%rbx, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+.LEHB41:
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L1398
+	je	.L1399
+	addq	%rax, %r12
+.L1174:
+	cmpq	$3, %r12
+	jbe	.L1203
+	.p2align 4,,10
+	.p2align 3
+.L1175:
+	testq	%r12, %r12
+	jne	.L1309
+	cmpb	$0, 54(%rsp)
+	je	.L1310
+.L1205:
+	cmpb	$0, 53(%rsp)
+	jne	.L1390
+	movl	48(%rsp), %ebx
+	testl	%ebx, %ebx
+	js	.L1207
+	movq	88(%rsp), %rax
+	cmpl	$2, 56(%rsp)
+	movq	%rax, 8(%rsp)
+	je	.L1400
+.L1208:
+	movl	$1, 56(%rsp)
+	movq	80(%rsp), %r13
+	xorl	%r12d, %r12d
+	.p2align 4,,10
+	.p2align 3
+.L1251:
+	movq	8(%rsp), %rdx
+	subq	%r13, %rdx
+	jne	.L1401
+	cmpb	$0, 53(%rsp)
+	jne	.L1223
+	movzbl	54(%rsp), %r15d
+	testb	%r15b, %r15b
+	jne	.L1224
+	movl	$32, %ebx
+	movq	72(%rsp), %r14
+	movl	48(%rsp), %ebp
+	subq	%r12, %rbx
+	cmpq	%r14, %rbx
+	jb	.L1225
+	leaq	16(%rsp,%r12), %r14
+	jmp	.L1228
+	.p2align 4,,10
+	.p2align 3
+.L1403:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1402
+.L1228:
+	movq	%rbx, %rdx
+	movq	%r14, %rsi
+	movl	%ebp, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L1403
+	je	.L1404
+	addq	%rax, %r12
+.L1222:
+	cmpq	$31, %r12
+	jbe	.L1251
+	.p2align 4,,10
+	.p2align 3
+.L1223:
+	testq	%r12, %r12
+	jne	.L1305
+	cmpb	$0, 54(%rsp)
+	je	.L1306
+.L1207:
+	movl	$438, %edx
+	movl	$524288, %esi
+	leaq	.LC42(%rip), %rdi
+	xorl	%eax, %eax
+	call	open@PLT
+.LEHE41:
+	movzwl	.LC5(%rip), %ecx
+	movdqa	.LC23(%rip), %xmm2
+	movl	%eax, 96(%rsp)
+	movb	$0, 102(%rsp)
+	movw	%cx, 100(%rsp)
+	movq	$0, 104(%rsp)
+	movq	$0, 112(%rsp)
+	movq	$0, 136(%rsp)
+	movups	%xmm2, 120(%rsp)
+	testl	%eax, %eax
+	js	.L1254
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1405
+.L1256:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	120(%rsp), %r12
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%r12, %rsi
+.LEHB42:
+	call	*16(%rax)
+.LEHE42:
+	movq	%rax, 112(%rsp)
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	jne	.L1258
+	movzbl	102(%rsp), %r13d
+.L1259:
+	testb	%r13b, %r13b
+	je	.L1254
+	cmpb	$0, 101(%rsp)
+	jne	.L1391
+	movl	96(%rsp), %ebp
+	testl	%ebp, %ebp
+	js	.L1279
+.L1303:
+	cmpl	$2, 104(%rsp)
+	je	.L1406
+.L1280:
+	cmpb	$0, 100(%rsp)
+	jne	.L1407
+.L1285:
+	movl	$-1, 96(%rsp)
+.L1279:
+	testq	%rbx, %rbx
+	je	.L1286
+.L1304:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1408
+.L1288:
+	movq	120(%rsp), %rdx
+	movq	112(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1286:
+	movl	48(%rsp), %ebx
+	movq	64(%rsp), %rbp
+	testl	%ebx, %ebx
+	js	.L1290
+	cmpl	$2, 56(%rsp)
+	je	.L1409
+.L1291:
+	cmpb	$0, 52(%rsp)
+	jne	.L1410
+.L1296:
+	movl	$-1, 48(%rsp)
+.L1290:
+	testq	%rbp, %rbp
+	je	.L1169
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1411
+.L1299:
+	movq	72(%rsp), %rdx
+	movq	64(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1169:
+	addq	$152, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1401:
+	.cfi_restore_state
+	movl	$32, %eax
+	movq	64(%rsp), %rcx
+	subq	%r12, %rax
+	cmpq	%rdx, %rax
+	cmova	%rdx, %rax
+	leaq	16(%rsp,%r12), %rdx
+	addq	%r13, %rcx
+	cmpl	$8, %eax
+	jnb	.L1216
+	testb	$4, %al
+	jne	.L1412
+	testl	%eax, %eax
+	je	.L1217
+	movzbl	(%rcx), %esi
+	movb	%sil, (%rdx)
+	testb	$2, %al
+	jne	.L1413
+.L1217:
+	addq	%rax, %r13
+	addq	%rax, %r12
+	movq	%r13, 80(%rsp)
+	jmp	.L1222
+	.p2align 4,,10
+	.p2align 3
+.L1396:
+	movl	$4, %ecx
+	movq	64(%rsp), %r8
+	leaq	16(%rsp,%r12), %rdi
+	subq	%r12, %rcx
+	cmpq	%rax, %rcx
+	cmova	%rax, %rcx
+	addq	%r14, %r8
+	movl	%ecx, %r9d
+	testl	%ecx, %ecx
+	je	.L1173
+	xorl	%eax, %eax
+.L1172:
+	movl	%eax, %edx
+	addl	$1, %eax
+	movzbl	(%r8,%rdx), %esi
+	movb	%sil, (%rdi,%rdx)
+	cmpl	%r9d, %eax
+	jb	.L1172
+.L1173:
+	addq	%rcx, %r14
+	addq	%rcx, %r12
+	movq	%r14, 80(%rsp)
+	jmp	.L1174
+	.p2align 4,,10
+	.p2align 3
+.L1177:
+	testl	%ebp, %ebp
+	js	.L1175
+	movq	64(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L1414
+.L1183:
+	cmpl	$2, 56(%rsp)
+	je	.L1415
+.L1188:
+	movq	80(%rsp), %r14
+	movq	8(%rsp), %rax
+	movl	$1, 56(%rsp)
+	cmpq	%rax, %r14
+	jne	.L1203
+	cmpb	$0, 53(%rsp)
+	jne	.L1175
+	movzbl	54(%rsp), %r14d
+	testb	%r14b, %r14b
+	jne	.L1175
+	testq	%rax, %rax
+	jne	.L1416
+.L1197:
+	testq	%r13, %r13
+	je	.L1417
+	movl	48(%rsp), %ebp
+	jmp	.L1200
+	.p2align 4,,10
+	.p2align 3
+.L1419:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1418
+.L1200:
+	movq	%r13, %rdx
+	movq	%rbx, %rsi
+	movl	%ebp, %edi
+.LEHB43:
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L1419
+	je	.L1420
+	movq	%rax, 8(%rsp)
+	xorl	%r14d, %r14d
+	movq	%rax, 88(%rsp)
+	jmp	.L1203
+	.p2align 4,,10
+	.p2align 3
+.L1225:
+	testl	%ebp, %ebp
+	js	.L1223
+	movq	64(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L1421
+.L1231:
+	cmpl	$2, 56(%rsp)
+	je	.L1422
+.L1236:
+	movq	80(%rsp), %r13
+	movq	8(%rsp), %rax
+	movl	$1, 56(%rsp)
+	cmpq	%rax, %r13
+	jne	.L1251
+	cmpb	$0, 53(%rsp)
+	jne	.L1223
+	movzbl	54(%rsp), %r13d
+	testb	%r13b, %r13b
+	jne	.L1223
+	testq	%rax, %rax
+	jne	.L1423
+.L1245:
+	testq	%r14, %r14
+	je	.L1424
+	movl	48(%rsp), %ebp
+	jmp	.L1248
+	.p2align 4,,10
+	.p2align 3
+.L1426:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1425
+.L1248:
+	movq	%r14, %rdx
+	movq	%rbx, %rsi
+	movl	%ebp, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L1426
+	je	.L1427
+	movq	%rax, 8(%rsp)
+	xorl	%r13d, %r13d
+	movq	%rax, 88(%rsp)
+	jmp	.L1251
+	.p2align 4,,10
+	.p2align 3
+.L1216:
+	movq	(%rcx), %rsi
+	movq	%rsi, (%rdx)
+	movl	%eax, %esi
+	movq	-8(%rcx,%rsi), %rdi
+	movq	%rdi, -8(%rdx,%rsi)
+	leaq	8(%rdx), %rdi
+	andq	$-8, %rdi
+	subq	%rdi, %rdx
+	subq	%rdx, %rcx
+	addl	%eax, %edx
+	andl	$-8, %edx
+	movq	%rcx, %rsi
+	cmpl	$8, %edx
+	jb	.L1217
+	andl	$-8, %edx
+	xorl	%ecx, %ecx
+.L1220:
+	movl	%ecx, %r8d
+	addl	$8, %ecx
+	movq	(%rsi,%r8), %r9
+	movq	%r9, (%rdi,%r8)
+	cmpl	%edx, %ecx
+	jb	.L1220
+	jmp	.L1217
+	.p2align 4,,10
+	.p2align 3
+.L1397:
+	movl	$1, %eax
+.L1179:
+	movb	%r15b, 53(%rsp)
+	movb	%al, 54(%rsp)
+	jmp	.L1175
+	.p2align 4,,10
+	.p2align 3
+.L1402:
+	movl	$1, %eax
+.L1227:
+	movb	%r15b, 53(%rsp)
+	movb	%al, 54(%rsp)
+	jmp	.L1223
+.L1421:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1428
+.L1233:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	72(%rsp), %r14
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%r14, %rsi
+	call	*16(%rax)
+	movq	%rax, 64(%rsp)
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L1223
+	movq	88(%rsp), %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L1231
+	.p2align 4,,10
+	.p2align 3
+.L1414:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1429
+.L1185:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	72(%rsp), %r13
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%r13, %rsi
+	call	*16(%rax)
+.LEHE43:
+	movq	%rax, 64(%rsp)
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L1175
+	movq	88(%rsp), %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L1183
+	.p2align 4,,10
+	.p2align 3
+.L1429:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1185
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1185
+.L1428:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1233
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1233
+.L1258:
+	cmpl	$2, 104(%rsp)
+	movq	136(%rsp), %rbp
+	je	.L1430
+.L1260:
+	movl	$1, 104(%rsp)
+	cmpq	128(%rsp), %rbp
+	jne	.L1267
+	cmpb	$0, 101(%rsp)
+	movzbl	102(%rsp), %r13d
+	jne	.L1259
+	testb	%r13b, %r13b
+	jne	.L1269
+	testq	%rbp, %rbp
+	jne	.L1270
+.L1395:
+	testq	%r12, %r12
+	je	.L1254
+	movl	96(%rsp), %ebp
+	jmp	.L1275
+	.p2align 4,,10
+	.p2align 3
+.L1432:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1431
+.L1275:
+	movq	%r12, %rdx
+	movq	%rbx, %rsi
+	movl	%ebp, %edi
+.LEHB44:
+	call	read@PLT
+.LEHE44:
+	testq	%rax, %rax
+	js	.L1432
+	jne	.L1276
+	xorl	%eax, %eax
+	movl	$1, %r13d
+.L1274:
+	movb	%r13b, 101(%rsp)
+	movl	%eax, %r13d
+	movb	%al, 102(%rsp)
+	jmp	.L1259
+	.p2align 4,,10
+	.p2align 3
+.L1425:
+	movl	$1, %eax
+.L1247:
+	movb	%r13b, 53(%rsp)
+	movb	%al, 54(%rsp)
+	jmp	.L1223
+	.p2align 4,,10
+	.p2align 3
+.L1418:
+	movl	$1, %eax
+.L1199:
+	movb	%r14b, 53(%rsp)
+	movb	%al, 54(%rsp)
+	jmp	.L1175
+.L1406:
+	movq	136(%rsp), %r12
+	testq	%r12, %r12
+	je	.L1280
+	movq	%rbx, %r13
+.L1284:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1433
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L1284
+.L1283:
+	movq	$0, 136(%rsp)
+	jmp	.L1280
+.L1409:
+	movq	88(%rsp), %r12
+	testq	%r12, %r12
+	je	.L1291
+	movq	%rbp, %r13
+.L1295:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1434
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L1295
+.L1294:
+	movq	$0, 88(%rsp)
+	jmp	.L1291
+.L1410:
+	movl	%ebx, %edi
+	call	close@PLT
+	jmp	.L1296
+.L1407:
+	movl	%ebp, %edi
+	call	close@PLT
+	jmp	.L1285
+.L1412:
+	movl	(%rcx), %esi
+	movl	%esi, (%rdx)
+	movl	%eax, %esi
+	movl	-4(%rcx,%rsi), %ecx
+	movl	%ecx, -4(%rdx,%rsi)
+	jmp	.L1217
+.L1408:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1288
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1288
+.L1411:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1299
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1299
+.L1224:
+	testq	%r12, %r12
+	je	.L1207
+	jmp	.L1305
+	.p2align 4,,10
+	.p2align 3
+.L1176:
+	testq	%r12, %r12
+	je	.L1205
+	jmp	.L1309
+	.p2align 4,,10
+	.p2align 3
+.L1415:
+	cmpq	$0, 8(%rsp)
+	jne	.L1189
+.L1194:
+	movq	$0, 8(%rsp)
+	jmp	.L1188
+.L1422:
+	cmpq	$0, 8(%rsp)
+	jne	.L1237
+.L1242:
+	movq	$0, 8(%rsp)
+	jmp	.L1236
+.L1400:
+	testq	%rax, %rax
+	jne	.L1209
+.L1214:
+	movq	$0, 8(%rsp)
+	jmp	.L1208
+.L1413:
+	movl	%eax, %esi
+	movzwl	-2(%rcx,%rsi), %ecx
+	movw	%cx, -2(%rdx,%rsi)
+	jmp	.L1217
+.L1434:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1294
+	jmp	.L1295
+.L1433:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1283
+	jmp	.L1284
+.L1269:
+	movl	96(%rsp), %ebp
+	testl	%ebp, %ebp
+	jns	.L1303
+	jmp	.L1304
+	.p2align 4,,10
+	.p2align 3
+.L1405:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1256
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1256
+	.p2align 4,,10
+	.p2align 3
+.L1431:
+	movl	$1, %eax
+	jmp	.L1274
+.L1209:
+	movq	64(%rsp), %rbp
+.L1213:
+	movq	8(%rsp), %rdx
+	movq	%rbp, %rsi
+	movl	%ebx, %edi
+.LEHB45:
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1435
+	addq	%rax, %rbp
+	subq	%rax, 8(%rsp)
+	jne	.L1213
+.L1212:
+	movq	$0, 88(%rsp)
+	jmp	.L1214
+.L1435:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1212
+	jmp	.L1213
+.L1237:
+	movl	48(%rsp), %r13d
+	movq	%rbx, %rbp
+.L1241:
+	movq	8(%rsp), %rdx
+	movq	%rbp, %rsi
+	movl	%r13d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1436
+	addq	%rax, %rbp
+	subq	%rax, 8(%rsp)
+	jne	.L1241
+.L1240:
+	movq	$0, 88(%rsp)
+	jmp	.L1242
+.L1436:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1240
+	jmp	.L1241
+.L1189:
+	movl	48(%rsp), %r14d
+	movq	%rbx, %rbp
+.L1193:
+	movq	8(%rsp), %rdx
+	movq	%rbp, %rsi
+	movl	%r14d, %edi
+	call	write@PLT
+.LEHE45:
+	testq	%rax, %rax
+	js	.L1437
+	addq	%rax, %rbp
+	subq	%rax, 8(%rsp)
+	jne	.L1193
+.L1192:
+	movq	$0, 88(%rsp)
+	jmp	.L1194
+.L1437:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1192
+	jmp	.L1193
+.L1430:
+	testq	%rbp, %rbp
+	jne	.L1261
+	xorl	%ebp, %ebp
+	jmp	.L1260
+.L1261:
+	movl	96(%rsp), %r14d
+	movq	%rax, %r13
+.L1265:
+	movq	%rbp, %rdx
+	movq	%r13, %rsi
+	movl	%r14d, %edi
+.LEHB46:
+	call	write@PLT
+.LEHE46:
+	testq	%rax, %rax
+	js	.L1438
+	addq	%rax, %r13
+	subq	%rax, %rbp
+	jne	.L1265
+.L1264:
+	movq	$0, 136(%rsp)
+	xorl	%ebp, %ebp
+	jmp	.L1260
+.L1423:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 80(%rsp)
+	jmp	.L1245
+.L1416:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 80(%rsp)
+	jmp	.L1197
+.L1438:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1264
+	jmp	.L1265
+.L1404:
+	xorl	%eax, %eax
+	movl	$1, %r15d
+	jmp	.L1227
+.L1270:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 128(%rsp)
+	jmp	.L1395
+.L1399:
+	xorl	%eax, %eax
+	movl	$1, %r15d
+	jmp	.L1179
+.L1427:
+	xorl	%eax, %eax
+	movl	$1, %r13d
+	jmp	.L1247
+.L1420:
+	xorl	%eax, %eax
+	movl	$1, %r14d
+	jmp	.L1199
+.L1417:
+	testq	%r12, %r12
+	jne	.L1309
+	jmp	.L1310
+.L1424:
+	testq	%r12, %r12
+	jne	.L1305
+	jmp	.L1306
+.L1387:
+	jmp	.L1388
+.L1385:
+	jmp	.L1386
+	.section	.gcc_except_table
+.LLSDA6876:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6876-.LLSDACSB6876
+.LLSDACSB6876:
+	.uleb128 .LEHB40-.LFB6876
+	.uleb128 .LEHE40-.LEHB40
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB41-.LFB6876
+	.uleb128 .LEHE41-.LEHB41
+	.uleb128 .L1385-.LFB6876
+	.uleb128 0
+	.uleb128 .LEHB42-.LFB6876
+	.uleb128 .LEHE42-.LEHB42
+	.uleb128 .L1387-.LFB6876
+	.uleb128 0
+	.uleb128 .LEHB43-.LFB6876
+	.uleb128 .LEHE43-.LEHB43
+	.uleb128 .L1385-.LFB6876
+	.uleb128 0
+	.uleb128 .LEHB44-.LFB6876
+	.uleb128 .LEHE44-.LEHB44
+	.uleb128 .L1387-.LFB6876
+	.uleb128 0
+	.uleb128 .LEHB45-.LFB6876
+	.uleb128 .LEHE45-.LEHB45
+	.uleb128 .L1385-.LFB6876
+	.uleb128 0
+	.uleb128 .LEHB46-.LFB6876
+	.uleb128 .LEHE46-.LEHB46
+	.uleb128 .L1387-.LFB6876
+	.uleb128 0
+.LLSDACSE6876:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6876
+	.type	_Z23test_fd_file_read_errorv.cold, @function
+_Z23test_fd_file_read_errorv.cold:
+.LFSB6876:
+.L1276:
+	.cfi_def_cfa_offset 208
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	%rax, 136(%rsp)
+.L1267:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC47(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB47:
+	call	__cxa_throw@PLT
+.LEHE47:
+.L1305:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC46(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB48:
+	call	__cxa_throw@PLT
+.LEHE48:
+.L1318:
+.L1386:
+	movq	%rax, %rbx
+	jmp	.L1302
+.L1319:
+.L1388:
+	leaq	96(%rsp), %rdi
+	movq	%rax, %rbx
+	call	_ZN1n7fd_file5closeEv
+.L1302:
+	leaq	48(%rsp), %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB49:
+	call	_Unwind_Resume@PLT
+.LEHE49:
+.L1254:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC48(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB50:
+	call	__cxa_throw@PLT
+.LEHE50:
+.L1306:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC44(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB51:
+	call	__cxa_throw@PLT
+.L1309:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC43(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L1390:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC45(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L1310:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC44(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L1389:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC19(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE51:
+.L1391:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC49(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB52:
+	call	__cxa_throw@PLT
+.LEHE52:
+	.cfi_endproc
+.LFE6876:
+	.section	.gcc_except_table
+.LLSDAC6876:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6876-.LLSDACSBC6876
+.LLSDACSBC6876:
+	.uleb128 .LEHB47-.LCOLDB50
+	.uleb128 .LEHE47-.LEHB47
+	.uleb128 .L1319-.LCOLDB50
+	.uleb128 0
+	.uleb128 .LEHB48-.LCOLDB50
+	.uleb128 .LEHE48-.LEHB48
+	.uleb128 .L1318-.LCOLDB50
+	.uleb128 0
+	.uleb128 .LEHB49-.LCOLDB50
+	.uleb128 .LEHE49-.LEHB49
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB50-.LCOLDB50
+	.uleb128 .LEHE50-.LEHB50
+	.uleb128 .L1319-.LCOLDB50
+	.uleb128 0
+	.uleb128 .LEHB51-.LCOLDB50
+	.uleb128 .LEHE51-.LEHB51
+	.uleb128 .L1318-.LCOLDB50
+	.uleb128 0
+	.uleb128 .LEHB52-.LCOLDB50
+	.uleb128 .LEHE52-.LEHB52
+	.uleb128 .L1319-.LCOLDB50
+	.uleb128 0
+.LLSDACSEC6876:
+	.section	.text.unlikely
+	.text
+	.size	_Z23test_fd_file_read_errorv, .-_Z23test_fd_file_read_errorv
+	.section	.text.unlikely
+	.size	_Z23test_fd_file_read_errorv.cold, .-_Z23test_fd_file_read_errorv.cold
+.LCOLDE50:
+	.text
+.LHOTE50:
+	.section	.rodata.str1.1
+.LC51:
+	.string	"0123456789"
+	.section	.rodata.str1.8
+	.align 8
+.LC53:
+	.string	"expected equal : expected value : p.len(), actual value : 4"
+	.align 8
+.LC54:
+	.string	"expected equal : expected value : p.data()[0], actual value : '3'"
+	.align 8
+.LC55:
+	.string	"expected equal : expected value : f.tell(), actual value : 7"
+	.align 8
+.LC56:
+	.string	"expected equal : expected value : f.peek().len(), actual value : 0"
+	.section	.text.unlikely
+.LCOLDB57:
+	.text
+.LHOTB57:
+	.p2align 4
+	.globl	_Z25test_fd_file_peek_consumev
+	.type	_Z25test_fd_file_peek_consumev, @function
+_Z25test_fd_file_peek_consumev:
+.LFB6877:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6877
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$438, %edx
+	movl	$524865, %esi
+	xorl	%eax, %eax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	leaq	.LC4(%rip), %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%r14, %rdi
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$88, %rsp
+	.cfi_def_cfa_offset 144
+.LEHB53:
+	call	open@PLT
+.LEHE53:
+	movzwl	.LC5(%rip), %ebx
+	movb	$0, 38(%rsp)
+	movdqa	.LC36(%rip), %xmm0
+	movl	%eax, 32(%rsp)
+	movw	%bx, 36(%rsp)
+	movq	$0, 40(%rsp)
+	movq	$0, 48(%rsp)
+	movq	$0, 72(%rsp)
+	movups	%xmm0, 56(%rsp)
+	testl	%eax, %eax
+	js	.L1440
+	movl	$2, 40(%rsp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1598
+.L1442:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	56(%rsp), %r15
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%r15, %rsi
+.LEHB54:
+	call	*16(%rax)
+.LEHE54:
+	movq	%rax, 48(%rsp)
+	movl	32(%rsp), %ebp
+	movq	%rax, %r12
+	testq	%rax, %rax
+	je	.L1531
+	movq	72(%rsp), %r13
+	movq	%r15, %rax
+	subq	%r13, %rax
+	cmpq	$9, %rax
+	ja	.L1540
+	cmpl	$2, 40(%rsp)
+	jne	.L1540
+	testq	%r13, %r13
+	jne	.L1532
+.L1540:
+	leaq	(%r12,%r13), %rax
+	addq	$10, %r13
+.L1446:
+	movl	$14648, %edx
+	cmpl	$2, 44(%rsp)
+	movq	%r13, 72(%rsp)
+	movabsq	$3978425819141910832, %rcx
+	movq	%rcx, (%rax)
+	movw	%dx, 8(%rax)
+	je	.L1451
+	testl	%ebp, %ebp
+	js	.L1458
+.L1457:
+	cmpl	$2, 40(%rsp)
+	je	.L1599
+.L1467:
+	cmpb	$0, 36(%rsp)
+	jne	.L1600
+.L1472:
+	movl	$-1, 32(%rsp)
+.L1473:
+	testq	%r12, %r12
+	je	.L1440
+.L1458:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1601
+.L1475:
+	movq	56(%rsp), %rdx
+	movq	48(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1440:
+	movl	$438, %edx
+	movl	$524288, %esi
+	movq	%r14, %rdi
+	xorl	%eax, %eax
+.LEHB55:
+	call	open@PLT
+.LEHE55:
+	movdqa	.LC52(%rip), %xmm0
+	movw	%bx, 36(%rsp)
+	movl	%eax, 32(%rsp)
+	movb	$0, 38(%rsp)
+	movq	$0, 40(%rsp)
+	movq	$0, 48(%rsp)
+	movq	$0, 72(%rsp)
+	movups	%xmm0, 56(%rsp)
+	testl	%eax, %eax
+	js	.L1478
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1602
+.L1480:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	56(%rsp), %r13
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%r13, %rsi
+.LEHB56:
+	call	*16(%rax)
+	movq	%rax, 48(%rsp)
+	movq	%rax, %rbp
+	testq	%rax, %rax
+	je	.L1478
+	cmpl	$2, 40(%rsp)
+	movq	72(%rsp), %r12
+	je	.L1603
+.L1484:
+	movq	64(%rsp), %rdx
+	movl	$1, 40(%rsp)
+	cmpq	%rdx, %r12
+	je	.L1491
+	movq	%r12, %rax
+	subq	%rdx, %rax
+.L1492:
+	cmpq	$4, %rax
+	jne	.L1478
+	movl	32(%rsp), %ebx
+	leaq	3(%rdx), %rax
+	movq	%rax, 64(%rsp)
+	testl	%ebx, %ebx
+	jns	.L1498
+.L1500:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC53(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L1498:
+	movq	%r12, %r15
+	subq	%rax, %r15
+	cmpq	$1, %r15
+	ja	.L1499
+	cmpb	$0, 37(%rsp)
+	jne	.L1500
+	movzbl	38(%rsp), %ecx
+	movb	%cl, 31(%rsp)
+	testb	%cl, %cl
+	jne	.L1500
+	testq	%rax, %rax
+	jne	.L1604
+.L1501:
+	movl	$2, %eax
+	cmpq	%rax, %r13
+	cmovbe	%r13, %rax
+	movq	%rax, 16(%rsp)
+	cmpq	%rax, %r12
+	jnb	.L1500
+	.p2align 4,,10
+	.p2align 3
+.L1506:
+	movq	%r13, %rax
+	leaq	0(%rbp,%r12), %r15
+	subq	%r12, %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L1504
+	.p2align 4,,10
+	.p2align 3
+.L1606:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1605
+.L1504:
+	movq	8(%rsp), %rdx
+	movq	%r15, %rsi
+	movl	%ebx, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L1606
+	je	.L1607
+	leaq	(%rax,%r12), %r15
+	movq	16(%rsp), %rax
+	movl	$1, %r12d
+	movq	%r15, 72(%rsp)
+	cmpq	%rax, %r15
+	jb	.L1506
+	movq	%r15, %r12
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L1499:
+	leaq	0(%rbp,%rax), %rdx
+	cmpq	$4, %r15
+	jne	.L1500
+	cmpb	$51, (%rdx)
+	jne	.L1586
+	leaq	4(%rax), %r15
+	xorl	%esi, %esi
+	movl	$1, %edx
+	movl	%ebx, %edi
+	movq	%r15, 64(%rsp)
+	call	lseek@PLT
+	testq	%rax, %rax
+	js	.L1508
+	movq	%r12, %rdx
+	subq	%r15, %rdx
+	subq	%rdx, %rax
+	cmpq	$7, %rax
+	jne	.L1508
+	cmpq	$9, %rdx
+	ja	.L1510
+	cmpb	$0, 37(%rsp)
+	jne	.L1510
+	movzbl	38(%rsp), %eax
+	movb	%al, 31(%rsp)
+	testb	%al, %al
+	jne	.L1510
+	testq	%r15, %r15
+	jne	.L1608
+.L1511:
+	movl	$10, %eax
+	cmpq	%rax, %r13
+	cmovbe	%r13, %rax
+	movq	%rax, 16(%rsp)
+	cmpq	%rax, %r12
+	jnb	.L1510
+	.p2align 4,,10
+	.p2align 3
+.L1516:
+	movq	%r13, %rax
+	leaq	0(%rbp,%r12), %r15
+	subq	%r12, %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L1514
+	.p2align 4,,10
+	.p2align 3
+.L1610:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1609
+.L1514:
+	movq	8(%rsp), %rdx
+	movq	%r15, %rsi
+	movl	%ebx, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L1610
+	je	.L1611
+	addq	%rax, %r12
+	movq	16(%rsp), %rax
+	movq	%r12, 72(%rsp)
+	cmpq	%rax, %r12
+	jb	.L1516
+	.p2align 4,,10
+	.p2align 3
+.L1510:
+	cmpb	$0, 37(%rsp)
+	movq	%r12, 64(%rsp)
+	jne	.L1523
+	movzbl	38(%rsp), %r15d
+	testb	%r15b, %r15b
+	jne	.L1523
+	testq	%r12, %r12
+	jne	.L1612
+.L1518:
+	testq	%r13, %r13
+	jne	.L1521
+	jmp	.L1523
+	.p2align 4,,10
+	.p2align 3
+.L1614:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1613
+.L1521:
+	movq	%r13, %rdx
+	movq	%rbp, %rsi
+	movl	%ebx, %edi
+	call	read@PLT
+.LEHE56:
+	testq	%rax, %rax
+	js	.L1614
+	jne	.L1522
+	xorl	%eax, %eax
+	movl	$1, %r15d
+	.p2align 4,,10
+	.p2align 3
+.L1520:
+	movb	%r15b, 37(%rsp)
+	movb	%al, 38(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1523:
+	movq	%r14, %rdi
+	call	remove@PLT
+	cmpb	$0, 36(%rsp)
+	jne	.L1615
+.L1524:
+	movl	$-1, 32(%rsp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1616
+.L1526:
+	movq	56(%rsp), %rdx
+	movq	48(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	addq	$88, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1615:
+	.cfi_restore_state
+	movl	%ebx, %edi
+	call	close@PLT
+	jmp	.L1524
+	.p2align 4,,10
+	.p2align 3
+.L1616:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1526
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1526
+	.p2align 4,,10
+	.p2align 3
+.L1491:
+	cmpb	$0, 37(%rsp)
+	jne	.L1478
+	movzbl	38(%rsp), %ebx
+	testb	%bl, %bl
+	jne	.L1478
+	testq	%r12, %r12
+	jne	.L1617
+.L1493:
+	testq	%r13, %r13
+	je	.L1618
+	movl	32(%rsp), %r12d
+	jmp	.L1496
+	.p2align 4,,10
+	.p2align 3
+.L1620:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1619
+.L1496:
+	movq	%r13, %rdx
+	movq	%rbp, %rsi
+	movl	%r12d, %edi
+.LEHB57:
+	call	read@PLT
+.LEHE57:
+	testq	%rax, %rax
+	js	.L1620
+	je	.L1621
+	movq	%rax, 72(%rsp)
+	movq	%rax, %r12
+	xorl	%edx, %edx
+	jmp	.L1492
+	.p2align 4,,10
+	.p2align 3
+.L1598:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1442
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1442
+	.p2align 4,,10
+	.p2align 3
+.L1602:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1480
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1480
+	.p2align 4,,10
+	.p2align 3
+.L1451:
+	cmpl	$2, 40(%rsp)
+	je	.L1622
+.L1593:
+	testl	%ebp, %ebp
+	js	.L1473
+	cmpb	$0, 36(%rsp)
+	je	.L1472
+.L1600:
+	movl	%ebp, %edi
+	call	close@PLT
+	jmp	.L1472
+	.p2align 4,,10
+	.p2align 3
+.L1601:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1475
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1475
+	.p2align 4,,10
+	.p2align 3
+.L1622:
+	movq	72(%rsp), %r13
+	testq	%r13, %r13
+	je	.L1593
+	movq	%r12, %r15
+.L1464:
+	movq	%r13, %rdx
+	movq	%r15, %rsi
+	movl	%ebp, %edi
+.LEHB58:
+	call	write@PLT
+.LEHE58:
+	testq	%rax, %rax
+	js	.L1623
+	addq	%rax, %r15
+	subq	%rax, %r13
+	jne	.L1464
+	.p2align 4,,10
+	.p2align 3
+.L1463:
+	movq	$0, 72(%rsp)
+	jmp	.L1593
+	.p2align 4,,10
+	.p2align 3
+.L1619:
+	movl	$1, %eax
+.L1495:
+	movb	%bl, 37(%rsp)
+	movb	%al, 38(%rsp)
+	jmp	.L1478
+	.p2align 4,,10
+	.p2align 3
+.L1613:
+	movl	$1, %eax
+	jmp	.L1520
+	.p2align 4,,10
+	.p2align 3
+.L1605:
+	movl	$1, %eax
+.L1503:
+	movzbl	31(%rsp), %ecx
+	movb	%al, 38(%rsp)
+	movb	%cl, 37(%rsp)
+	jmp	.L1500
+	.p2align 4,,10
+	.p2align 3
+.L1609:
+	movl	$1, %eax
+.L1513:
+	movzbl	31(%rsp), %ecx
+	movb	%al, 38(%rsp)
+	movb	%cl, 37(%rsp)
+	jmp	.L1510
+	.p2align 4,,10
+	.p2align 3
+.L1599:
+	movq	72(%rsp), %r13
+	testq	%r13, %r13
+	je	.L1467
+	movq	%r12, %r15
+.L1471:
+	movq	%r13, %rdx
+	movq	%r15, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1624
+	addq	%rax, %r15
+	subq	%rax, %r13
+	jne	.L1471
+	.p2align 4,,10
+	.p2align 3
+.L1470:
+	movq	$0, 72(%rsp)
+	jmp	.L1467
+	.p2align 4,,10
+	.p2align 3
+.L1624:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1470
+	jmp	.L1471
+.L1531:
+	movl	$10, %r13d
+	leaq	.LC51(%rip), %r15
+.L1444:
+	movq	%r13, %rdx
+	movq	%r15, %rsi
+	movl	%ebp, %edi
+.LEHB59:
+	call	write@PLT
+.LEHE59:
+	testq	%rax, %rax
+	js	.L1625
+	addq	%rax, %r15
+	subq	%rax, %r13
+	jne	.L1444
+	.p2align 4,,10
+	.p2align 3
+.L1456:
+	cmpl	$2, 44(%rsp)
+	je	.L1451
+	testl	%ebp, %ebp
+	jns	.L1457
+	jmp	.L1440
+	.p2align 4,,10
+	.p2align 3
+.L1625:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1456
+	jmp	.L1444
+	.p2align 4,,10
+	.p2align 3
+.L1623:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1463
+	jmp	.L1464
+	.p2align 4,,10
+	.p2align 3
+.L1603:
+	testq	%r12, %r12
+	jne	.L1485
+.L1490:
+	xorl	%r12d, %r12d
+	jmp	.L1484
+.L1485:
+	movl	32(%rsp), %r15d
+	movq	%rax, %rbx
+.L1489:
+	movq	%r12, %rdx
+	movq	%rbx, %rsi
+	movl	%r15d, %edi
+.LEHB60:
+	call	write@PLT
+.LEHE60:
+	testq	%rax, %rax
+	js	.L1626
+	addq	%rax, %rbx
+	subq	%rax, %r12
+	jne	.L1489
+.L1488:
+	movq	$0, 72(%rsp)
+	jmp	.L1490
+.L1626:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1488
+	jmp	.L1489
+.L1532:
+	movq	%r12, %r15
+.L1447:
+	movq	%r13, %rdx
+	movq	%r15, %rsi
+	movl	%ebp, %edi
+.LEHB61:
+	call	write@PLT
+.LEHE61:
+	testq	%rax, %rax
+	js	.L1627
+	addq	%rax, %r15
+	subq	%rax, %r13
+	jne	.L1447
+.L1591:
+	movq	%r12, %rax
+	movl	$10, %r13d
+	jmp	.L1446
+.L1627:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1591
+	jmp	.L1447
+.L1617:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 64(%rsp)
+	jmp	.L1493
+.L1608:
+	leaq	0(%rbp,%r15), %rsi
+	movq	%rbp, %rdi
+	movq	%rdx, 8(%rsp)
+	call	memmove@PLT
+	movq	8(%rsp), %rdx
+	movq	$0, 64(%rsp)
+	movq	%rdx, 72(%rsp)
+	movq	%rdx, %r12
+	jmp	.L1511
+.L1612:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 64(%rsp)
+	jmp	.L1518
+.L1604:
+	leaq	0(%rbp,%rax), %rsi
+	movq	%r15, %rdx
+	movq	%rbp, %rdi
+	movq	%r15, %r12
+	call	memmove@PLT
+	movq	%r15, 72(%rsp)
+	movq	$0, 64(%rsp)
+	jmp	.L1501
+.L1611:
+	movb	$1, 31(%rsp)
+	xorl	%eax, %eax
+	jmp	.L1513
+.L1621:
+	xorl	%eax, %eax
+	movl	$1, %ebx
+	jmp	.L1495
+.L1607:
+	movb	$1, 31(%rsp)
+	xorl	%eax, %eax
+	jmp	.L1503
+.L1618:
+	jmp	.L1478
+.L1538:
+	movq	%rax, %rbx
+	jmp	.L1528
+.L1584:
+	jmp	.L1585
+	.section	.gcc_except_table
+.LLSDA6877:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6877-.LLSDACSB6877
+.LLSDACSB6877:
+	.uleb128 .LEHB53-.LFB6877
+	.uleb128 .LEHE53-.LEHB53
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB54-.LFB6877
+	.uleb128 .LEHE54-.LEHB54
+	.uleb128 .L1538-.LFB6877
+	.uleb128 0
+	.uleb128 .LEHB55-.LFB6877
+	.uleb128 .LEHE55-.LEHB55
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB56-.LFB6877
+	.uleb128 .LEHE56-.LEHB56
+	.uleb128 .L1584-.LFB6877
+	.uleb128 0
+	.uleb128 .LEHB57-.LFB6877
+	.uleb128 .LEHE57-.LEHB57
+	.uleb128 .L1584-.LFB6877
+	.uleb128 0
+	.uleb128 .LEHB58-.LFB6877
+	.uleb128 .LEHE58-.LEHB58
+	.uleb128 .L1538-.LFB6877
+	.uleb128 0
+	.uleb128 .LEHB59-.LFB6877
+	.uleb128 .LEHE59-.LEHB59
+	.uleb128 .L1538-.LFB6877
+	.uleb128 0
+	.uleb128 .LEHB60-.LFB6877
+	.uleb128 .LEHE60-.LEHB60
+	.uleb128 .L1584-.LFB6877
+	.uleb128 0
+	.uleb128 .LEHB61-.LFB6877
+	.uleb128 .LEHE61-.LEHB61
+	.uleb128 .L1538-.LFB6877
+	.uleb128 0
+.LLSDACSE6877:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6877
+	.type	_Z25test_fd_file_peek_consumev.cold, @function
+_Z25test_fd_file_peek_consumev.cold:
+.LFSB6877:
+.L1586:
+	.cfi_def_cfa_offset 144
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC54(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB62:
+	call	__cxa_throw@PLT
+.L1522:
+	movl	$8, %edi
+	movq	%rax, 72(%rsp)
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC56(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE62:
+.L1539:
+.L1585:
+	movq	%rax, %rbx
+	leaq	32(%rsp), %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB63:
+	call	_Unwind_Resume@PLT
+.LEHE63:
+.L1508:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC55(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB64:
+	call	__cxa_throw@PLT
+.L1478:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC53(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE64:
+.L1528:
+	leaq	32(%rsp), %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB65:
+	call	_Unwind_Resume@PLT
+.LEHE65:
+	.cfi_endproc
+.LFE6877:
+	.section	.gcc_except_table
+.LLSDAC6877:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6877-.LLSDACSBC6877
+.LLSDACSBC6877:
+	.uleb128 .LEHB62-.LCOLDB57
+	.uleb128 .LEHE62-.LEHB62
+	.uleb128 .L1539-.LCOLDB57
+	.uleb128 0
+	.uleb128 .LEHB63-.LCOLDB57
+	.uleb128 .LEHE63-.LEHB63
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB64-.LCOLDB57
+	.uleb128 .LEHE64-.LEHB64
+	.uleb128 .L1539-.LCOLDB57
+	.uleb128 0
+	.uleb128 .LEHB65-.LCOLDB57
+	.uleb128 .LEHE65-.LEHB65
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6877:
+	.section	.text.unlikely
+	.text
+	.size	_Z25test_fd_file_peek_consumev, .-_Z25test_fd_file_peek_consumev
+	.section	.text.unlikely
+	.size	_Z25test_fd_file_peek_consumev.cold, .-_Z25test_fd_file_peek_consumev.cold
+.LCOLDE57:
+	.text
+.LHOTE57:
+	.section	.rodata._ZN1n4test10test_suite7run_allEv.str1.1,"aMS",@progbits,1
+.LC58:
+	.string	"\nSUITE [%s] "
+.LC60:
+	.string	"%s"
+.LC61:
+	.string	"\nTEST [%s] "
+.LC62:
+	.string	" - Result : \033[1;32mPASSED\033[0m"
+.LC63:
+	.string	"\033[1;31merror : %s\033[0m\n"
+.LC64:
+	.string	" - Result : \033[1;31mFAILED\033[0m"
+.LC65:
+	.string	" - Passed : \033[1;32m%d\033[0m\n"
+.LC66:
+	.string	" - Failed : \033[1;31m%d\033[0m\n"
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4test10test_suite7run_allEv
+	.type	_ZN1n4test10test_suite7run_allEv, @function
+_ZN1n4test10test_suite7run_allEv:
+.LFB6873:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6873
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	leaq	.LC58(%rip), %rdx
+	movl	$79, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	16(%rdi), %rcx
+	leaq	16(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L1629
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L1630
+	testb	$4, %cl
+	jne	.L1683
+	testl	%ecx, %ecx
+	je	.L1629
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L1684
+	.p2align 4,,10
+	.p2align 3
+.L1629:
+	movzwl	.LC59(%rip), %r15d
+	movq	%rbx, %rsi
+	leaq	.LC60(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+.LEHB66:
+	call	printf@PLT
+	movl	8(%r12), %esi
+	testl	%esi, %esi
+	jle	.L1650
+	movl	$0, 12(%rsp)
+	xorl	%ebp, %ebp
+	xorl	%r14d, %r14d
+	jmp	.L1644
+	.p2align 4,,10
+	.p2align 3
+.L1687:
+	testb	$4, %dl
+	jne	.L1685
+	testl	%edx, %edx
+	je	.L1635
+	movb	$42, (%rax)
+	testb	$2, %dl
+	jne	.L1686
+	.p2align 4,,10
+	.p2align 3
+.L1635:
+	movq	%rbx, %rsi
+	leaq	.LC60(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+.LEHE66:
+	movq	(%r12), %rax
+.LEHB67:
+	call	*8(%rax,%r13)
+.LEHE67:
+	leaq	.LC62(%rip), %rdi
+	addl	$1, %r14d
+.LEHB68:
+	call	puts@PLT
+.L1640:
+	addq	$1, %rbp
+	cmpl	%ebp, 8(%r12)
+	jle	.L1634
+.L1644:
+	movq	(%r12), %rax
+	movq	%rbp, %r13
+	movq	%rbx, %rdi
+	movl	$79, %esi
+	salq	$4, %r13
+	leaq	.LC61(%rip), %rdx
+	movq	(%rax,%r13), %rcx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L1635
+	movl	$79, %edx
+	subl	%eax, %edx
+	addq	%rbx, %rax
+	cmpl	$8, %edx
+	jb	.L1687
+	movabsq	$3038287259199220266, %rsi
+	leaq	8(%rax), %rdi
+	movl	%edx, %ecx
+	andq	$-8, %rdi
+	movq	%rsi, (%rax)
+	movq	%rsi, -8(%rax,%rcx)
+	subq	%rdi, %rax
+	leal	(%rdx,%rax), %ecx
+	movq	%rsi, %rax
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L1635
+.L1650:
+	movl	$0, 12(%rsp)
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L1634:
+	movabsq	$5917806138674729738, %rax
+	movq	%rbx, %rdi
+	movq	%rax, 16(%rsp)
+	movabsq	$9095440486453792, %rax
+	movq	%rax, 22(%rsp)
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L1645
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L1646
+	testb	$4, %cl
+	jne	.L1688
+	testl	%ecx, %ecx
+	je	.L1645
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L1689
+.L1645:
+	movq	%rbx, %rsi
+	leaq	.LC60(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+	movl	%r14d, %esi
+	leaq	.LC65(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	12(%rsp), %esi
+	leaq	.LC66(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	$10, %edi
+	call	putchar@PLT
+.LEHE68:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L1646:
+	.cfi_restore_state
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L1645
+.L1630:
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L1629
+.L1685:
+	movl	$707406378, (%rax)
+	movl	$707406378, -4(%rax,%rdx)
+	jmp	.L1635
+.L1686:
+	movl	$10794, %ecx
+	movw	%cx, -2(%rax,%rdx)
+	jmp	.L1635
+.L1684:
+	movl	$10794, %edi
+	movw	%di, -2(%rdx,%rcx)
+	jmp	.L1629
+.L1689:
+	movl	$10794, %eax
+	movw	%ax, -2(%rdx,%rcx)
+	jmp	.L1645
+.L1683:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L1629
+.L1688:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L1645
+.L1651:
+	movq	%rax, %rdi
+	movq	%rdx, %rax
+.L1641:
+	subq	$1, %rax
+	jne	.L1682
+	call	__cxa_begin_catch@PLT
+	leaq	.LC63(%rip), %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+.LEHB69:
+	call	printf@PLT
+.LEHE69:
+	call	__cxa_end_catch@PLT
+	leaq	.LC64(%rip), %rdi
+	addl	$1, 12(%rsp)
+.LEHB70:
+	call	puts@PLT
+	jmp	.L1640
+.L1643:
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+.L1682:
+	call	_Unwind_Resume@PLT
+.LEHE70:
+.L1652:
+	movq	%rax, %rbx
+	jmp	.L1643
+	.cfi_endproc
+.LFE6873:
+	.section	.gcc_except_table
+	.align 4
+.LLSDA6873:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT6873-.LLSDATTD6873
+.LLSDATTD6873:
+	.byte	0x1
+	.uleb128 .LLSDACSE6873-.LLSDACSB6873
+.LLSDACSB6873:
+	.uleb128 .LEHB66-.LFB6873
+	.uleb128 .LEHE66-.LEHB66
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB67-.LFB6873
+	.uleb128 .LEHE67-.LEHB67
+	.uleb128 .L1651-.LFB6873
+	.uleb128 0x1
+	.uleb128 .LEHB68-.LFB6873
+	.uleb128 .LEHE68-.LEHB68
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB69-.LFB6873
+	.uleb128 .LEHE69-.LEHB69
+	.uleb128 .L1652-.LFB6873
+	.uleb128 0
+	.uleb128 .LEHB70-.LFB6873
+	.uleb128 .LEHE70-.LEHB70
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6873:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	DW.ref._ZTIPKc-.
+.LLSDATT6873:
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.size	_ZN1n4test10test_suite7run_allEv, .-_ZN1n4test10test_suite7run_allEv
+	.text
+	.p2align 4
+	.globl	_Z7on_diskPKc
+	.type	_Z7on_diskPKc, @function
+_Z7on_diskPKc:
+.LFB6874:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	xorl	%esi, %esi
+	xorl	%eax, %eax
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$264, %rsp
+	.cfi_def_cfa_offset 288
+	call	open@PLT
+	movq	%rsp, %rsi
+	movl	$256, %edx
+	movl	%eax, %edi
+	movl	%eax, %ebp
+	call	read@PLT
+	movl	%ebp, %edi
+	movq	%rax, %rbx
+	call	close@PLT
+	xorl	%eax, %eax
+	testq	%rbx, %rbx
+	cmovns	%rbx, %rax
+	addq	$264, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE6874:
+	.size	_Z7on_diskPKc, .-_Z7on_diskPKc
+	.section	.rodata.str1.1
+.LC67:
+	.string	"n::fd_file tests"
+.LC68:
+	.string	"test_fd_file_write_read"
+.LC69:
+	.string	"test_fd_file_read_error"
+.LC70:
+	.string	"test_fd_file_peek_consume"
+.LC71:
+	.string	"test_fd_file_flush_policies"
+.LC72:
+	.string	"test_fd_file_read_then_write"
+.LC73:
+	.string	"test_file_records"
+	.section	.text.unlikely
+.LCOLDB75:
+	.section	.text.startup,"ax",@progbits
+.LHOTB75:
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB6884:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6884
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$1600, %edi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 64
+.LEHB71:
+	call	_Znam@PLT
+.LEHE71:
+	movq	%rax, %rbx
+	leaq	1600(%rax), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L1693:
+	movq	$0, (%rax)
+	addq	$16, %rax
+	movq	$0, -8(%rax)
+	cmpq	%rax, %rdx
+	jne	.L1693
+	leaq	.LC67(%rip), %rax
+	movq	%rsp, %rdi
+	movq	%rbx, (%rsp)
+	movq	%rax, 16(%rsp)
+	leaq	.LC68(%rip), %rax
+	movq	%rax, (%rbx)
+	leaq	_Z23test_fd_file_write_readv(%rip), %rax
+	movq	%rax, 8(%rbx)
+	leaq	.LC69(%rip), %rax
+	movq	%rax, 16(%rbx)
+	leaq	_Z23test_fd_file_read_errorv(%rip), %rax
+	movq	%rax, 24(%rbx)
+	leaq	.LC70(%rip), %rax
+	movq	%rax, 32(%rbx)
+	leaq	_Z25test_fd_file_peek_consumev(%rip), %rax
+	movq	%rax, 40(%rbx)
+	leaq	.LC71(%rip), %rax
+	movq	%rax, 48(%rbx)
+	leaq	_Z27test_fd_file_flush_policiesv(%rip), %rax
+	movq	%rax, 56(%rbx)
+	leaq	.LC72(%rip), %rax
+	movq	%rax, 64(%rbx)
+	leaq	_Z28test_fd_file_read_then_writev(%rip), %rax
+	movq	%rax, 72(%rbx)
+	leaq	.LC73(%rip), %rax
+	movq	%rax, 80(%rbx)
+	leaq	_Z17test_file_recordsv(%rip), %rax
+	movq	%rax, 88(%rbx)
+	movq	.LC74(%rip), %rax
+	movq	%rax, 8(%rsp)
+.LEHB72:
+	call	_ZN1n4test10test_suite7run_allEv
+.LEHE72:
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L1695:
+	.cfi_restore_state
+	movq	%rax, %rbp
+	jmp	.L1694
+	.section	.gcc_except_table
+.LLSDA6884:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6884-.LLSDACSB6884
+.LLSDACSB6884:
+	.uleb128 .LEHB71-.LFB6884
+	.uleb128 .LEHE71-.LEHB71
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB72-.LFB6884
+	.uleb128 .LEHE72-.LEHB72
+	.uleb128 .L1695-.LFB6884
+	.uleb128 0
+.LLSDACSE6884:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6884
+	.type	main.cold, @function
+main.cold:
+.LFSB6884:
+.L1694:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	movq	%rbp, %rdi
+.LEHB73:
+	call	_Unwind_Resume@PLT
+.LEHE73:
+	.cfi_endproc
+.LFE6884:
+	.section	.gcc_except_table
+.LLSDAC6884:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6884-.LLSDACSBC6884
+.LLSDACSBC6884:
+	.uleb128 .LEHB73-.LCOLDB75
+	.uleb128 .LEHE73-.LEHB73
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6884:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	main, .-main
+	.section	.text.unlikely
+	.size	main.cold, .-main.cold
+.LCOLDE75:
+	.section	.text.startup
+.LHOTE75:
+	.section	.text._ZN1n4fileI6recordLNS_4modeE1EE5closeEv,"axG",@progbits,_ZN1n4fileI6recordLNS_4modeE1EE5closeEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4fileI6recordLNS_4modeE1EE5closeEv
+	.type	_ZN1n4fileI6recordLNS_4modeE1EE5closeEv, @function
+_ZN1n4fileI6recordLNS_4modeE1EE5closeEv:
+.LFB6929:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movl	(%rdi), %ebp
+	testl	%ebp, %ebp
+	js	.L1701
+	cmpl	$2, 8(%rdi)
+	je	.L1726
+.L1702:
+	cmpb	$0, 4(%rbx)
+	jne	.L1727
+.L1707:
+	movl	$-1, (%rbx)
+.L1701:
+	cmpq	$0, 16(%rbx)
+	je	.L1708
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1728
+.L1710:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	$0, 16(%rbx)
+.L1708:
+	movq	48(%rbx), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 8(%rbx)
+	movups	%xmm0, 32(%rbx)
+	testq	%rdi, %rdi
+	je	.L1700
+	call	fclose@PLT
+	movq	$0, 48(%rbx)
+.L1700:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1726:
+	.cfi_restore_state
+	movq	40(%rdi), %r12
+	testq	%r12, %r12
+	je	.L1702
+	movq	16(%rdi), %r13
+.L1706:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1729
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L1706
+	.p2align 4,,10
+	.p2align 3
+.L1705:
+	movq	$0, 40(%rbx)
+	jmp	.L1702
+	.p2align 4,,10
+	.p2align 3
+.L1727:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L1707
+	.p2align 4,,10
+	.p2align 3
+.L1728:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1710
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1710
+	.p2align 4,,10
+	.p2align 3
+.L1729:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1705
+	jmp	.L1706
+	.cfi_endproc
+.LFE6929:
+	.size	_ZN1n4fileI6recordLNS_4modeE1EE5closeEv, .-_ZN1n4fileI6recordLNS_4modeE1EE5closeEv
+	.section	.text._ZN1n4fileI6recordLNS_4modeE0EE5closeEv,"axG",@progbits,_ZN1n4fileI6recordLNS_4modeE0EE5closeEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4fileI6recordLNS_4modeE0EE5closeEv
+	.type	_ZN1n4fileI6recordLNS_4modeE0EE5closeEv, @function
+_ZN1n4fileI6recordLNS_4modeE0EE5closeEv:
+.LFB6930:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movl	(%rdi), %ebp
+	testl	%ebp, %ebp
+	js	.L1731
+	cmpl	$2, 8(%rdi)
+	je	.L1756
+.L1732:
+	cmpb	$0, 4(%rbx)
+	jne	.L1757
+.L1737:
+	movl	$-1, (%rbx)
+.L1731:
+	cmpq	$0, 16(%rbx)
+	je	.L1738
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1758
+.L1740:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	$0, 16(%rbx)
+.L1738:
+	movq	48(%rbx), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 8(%rbx)
+	movups	%xmm0, 32(%rbx)
+	testq	%rdi, %rdi
+	je	.L1730
+	call	fclose@PLT
+	movq	$0, 48(%rbx)
+.L1730:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1756:
+	.cfi_restore_state
+	movq	40(%rdi), %r12
+	testq	%r12, %r12
+	je	.L1732
+	movq	16(%rdi), %r13
+.L1736:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1759
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L1736
+	.p2align 4,,10
+	.p2align 3
+.L1735:
+	movq	$0, 40(%rbx)
+	jmp	.L1732
+	.p2align 4,,10
+	.p2align 3
+.L1757:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L1737
+	.p2align 4,,10
+	.p2align 3
+.L1758:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1740
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1740
+	.p2align 4,,10
+	.p2align 3
+.L1759:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1735
+	jmp	.L1736
+	.cfi_endproc
+.LFE6930:
+	.size	_ZN1n4fileI6recordLNS_4modeE0EE5closeEv, .-_ZN1n4fileI6recordLNS_4modeE0EE5closeEv
+	.section	.rodata.str1.8
+	.align 8
+.LC80:
+	.string	"expected equal : expected value : f.write(rs, 100), actual value : 100"
+	.align 8
+.LC82:
+	.string	"expected equal : expected value : p.len(), actual value : 10"
+	.align 8
+.LC83:
+	.string	"expected equal : expected value : f.pop().get().id, actual value : 9"
+	.align 8
+.LC84:
+	.string	"expected equal : expected value : f.peek().data()[0].id, actual value : 10"
+	.align 8
+.LC85:
+	.string	"expected equal : expected value : f.read(rs, 100), actual value : 90"
+	.align 8
+.LC86:
+	.string	"expected equal : expected value : rs[89].id, actual value : 99"
+	.section	.text.unlikely
+.LCOLDB87:
+	.text
+.LHOTB87:
+	.p2align 4
+	.globl	_Z17test_file_recordsv
+	.type	_Z17test_file_recordsv, @function
+_Z17test_file_recordsv:
+.LFB6882:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6882
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$438, %edx
+	movl	$524865, %esi
+	xorl	%eax, %eax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	leaq	.LC4(%rip), %rdi
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$904, %rsp
+	.cfi_def_cfa_offset 960
+.LEHB74:
+	call	open@PLT
+.LEHE74:
+	movb	$0, 38(%rsp)
+	leaq	96(%rsp), %rcx
+	movzwl	.LC5(%rip), %ebx
+	movdqa	.LC36(%rip), %xmm0
+	movl	%eax, 32(%rsp)
+	movq	%rcx, %rdx
+	movw	%bx, 36(%rsp)
+	movss	.LC79(%rip), %xmm4
+	movq	$0, 40(%rsp)
+	movdqa	.LC76(%rip), %xmm2
+	movdqa	.LC77(%rip), %xmm5
+	movq	%rcx, (%rsp)
+	shufps	$0, %xmm4, %xmm4
+	leaq	896(%rsp), %rcx
+	movq	$0, 48(%rsp)
+	movq	$0, 72(%rsp)
+	movq	$0, 80(%rsp)
+	movups	%xmm0, 56(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1761:
+	movdqa	%xmm2, %xmm1
+	addq	$32, %rdx
+	paddd	%xmm5, %xmm2
+	cvtdq2ps	%xmm1, %xmm0
+	mulps	%xmm4, %xmm0
+	pshufd	$85, %xmm1, %xmm3
+	movd	%xmm1, -32(%rdx)
+	movd	%xmm3, -24(%rdx)
+	movdqa	%xmm1, %xmm3
+	punpckhdq	%xmm1, %xmm3
+	pshufd	$255, %xmm1, %xmm1
+	movd	%xmm1, -8(%rdx)
+	movd	%xmm3, -16(%rdx)
+	movaps	%xmm0, %xmm1
+	movss	%xmm0, -28(%rdx)
+	shufps	$85, %xmm0, %xmm1
+	movss	%xmm1, -20(%rdx)
+	movaps	%xmm0, %xmm1
+	unpckhps	%xmm0, %xmm1
+	shufps	$255, %xmm0, %xmm0
+	movss	%xmm0, -4(%rdx)
+	movss	%xmm1, -12(%rdx)
+	cmpq	%rdx, %rcx
+	jne	.L1761
+	testl	%eax, %eax
+	js	.L1782
+	movl	$2, 40(%rsp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2004
+.L1764:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	56(%rsp), %r12
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%r12, %rsi
+.LEHB75:
+	call	*16(%rax)
+	movq	%rax, 48(%rsp)
+	movq	%rax, %rbp
+	testq	%rax, %rax
+	je	.L1766
+	movq	72(%rsp), %r13
+	subq	%r13, %r12
+	cmpq	$799, %r12
+	ja	.L2003
+	cmpl	$2, 40(%rsp)
+	sete	%r12b
+	testq	%r13, %r13
+	setne	%al
+	andb	%al, %r12b
+	jne	.L1769
+.L2003:
+	leaq	0(%rbp,%r13), %rax
+	movl	$1, %r12d
+	addq	$800, %r13
+.L1768:
+	movq	96(%rsp), %rdx
+	leaq	8(%rax), %rdi
+	andq	$-8, %rdi
+	movq	%rdx, (%rax)
+	movq	888(%rsp), %rdx
+	movq	%rdx, 792(%rax)
+	movq	(%rsp), %rsi
+	subq	%rdi, %rax
+	subq	%rax, %rsi
+	addl	$800, %eax
+	shrl	$3, %eax
+	movl	%eax, %ecx
+	rep movsq
+	movq	%r13, 72(%rsp)
+.L1774:
+	movl	44(%rsp), %eax
+	cmpl	$2, %eax
+	je	.L1778
+	cmpl	$1, %eax
+	je	.L2005
+.L1779:
+	testb	%r12b, %r12b
+	jne	.L2006
+.L1782:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC80(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE75:
+	.p2align 4,,10
+	.p2align 3
+.L2004:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1764
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1764
+	.p2align 4,,10
+	.p2align 3
+.L2006:
+	movl	32(%rsp), %r13d
+	testl	%r13d, %r13d
+	js	.L1789
+	cmpl	$2, 40(%rsp)
+	je	.L2007
+.L1790:
+	cmpb	$0, 36(%rsp)
+	jne	.L2008
+.L1795:
+	movl	$-1, 32(%rsp)
+	movl	$-1, %r13d
+.L1789:
+	testq	%rbp, %rbp
+	je	.L2009
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2010
+.L1800:
+	movq	56(%rsp), %rdx
+	movq	48(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	80(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movq	$0, 48(%rsp)
+	movl	$0, 40(%rsp)
+	movl	32(%rsp), %r13d
+	movaps	%xmm0, 64(%rsp)
+	testq	%rdi, %rdi
+	je	.L1802
+.L1797:
+	call	fclose@PLT
+.L1802:
+	testl	%r13d, %r13d
+	js	.L1798
+	cmpb	$0, 36(%rsp)
+	jne	.L2011
+.L1798:
+	movl	$438, %edx
+	movl	$524288, %esi
+	leaq	.LC4(%rip), %rdi
+	xorl	%eax, %eax
+.LEHB76:
+	call	open@PLT
+.LEHE76:
+	movdqa	.LC81(%rip), %xmm0
+	movw	%bx, 36(%rsp)
+	movl	%eax, 32(%rsp)
+	movb	$0, 38(%rsp)
+	movq	$0, 40(%rsp)
+	movq	$0, 48(%rsp)
+	movq	$0, 72(%rsp)
+	movq	$0, 80(%rsp)
+	movups	%xmm0, 56(%rsp)
+	testl	%eax, %eax
+	js	.L1805
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2012
+.L1807:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	56(%rsp), %r15
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%r15, %rsi
+.LEHB77:
+	call	*16(%rax)
+	movq	%rax, 48(%rsp)
+	movq	%rax, %r13
+	testq	%rax, %rax
+	je	.L1805
+	cmpl	$2, 40(%rsp)
+	movq	72(%rsp), %rbx
+	je	.L2013
+.L1810:
+	movq	64(%rsp), %r12
+	movq	%rbx, %rbp
+	movl	$1, 40(%rsp)
+	subq	%r12, %rbp
+	cmpq	$7, %rbp
+	ja	.L1817
+	cmpb	$0, 37(%rsp)
+	jne	.L1805
+	movzbl	38(%rsp), %eax
+	movb	%al, 16(%rsp)
+	testb	%al, %al
+	jne	.L1805
+	testq	%r12, %r12
+	jne	.L2014
+.L1818:
+	movl	$8, %eax
+	cmpq	%rax, %r15
+	cmovbe	%r15, %rax
+	movq	%rax, 24(%rsp)
+	cmpq	%rax, %rbx
+	jnb	.L1805
+	movl	32(%rsp), %r14d
+.L1824:
+	movq	%r15, %rbp
+	leaq	0(%r13,%rbx), %r12
+	subq	%rbx, %rbp
+	jmp	.L1822
+	.p2align 4,,10
+	.p2align 3
+.L2016:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2015
+.L1822:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%r14d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L2016
+	je	.L2017
+	addq	%rax, %rbx
+	movq	24(%rsp), %rax
+	movq	%rbx, 72(%rsp)
+	cmpq	%rax, %rbx
+	jb	.L1824
+	movq	64(%rsp), %r12
+	movq	%rbx, %rbp
+	subq	%r12, %rbp
+.L1817:
+	shrq	$3, %rbp
+	cmpq	$10, %rbp
+	jne	.L1805
+	movl	32(%rsp), %ebp
+	addq	$72, %r12
+	movq	%r12, 64(%rsp)
+	testl	%ebp, %ebp
+	js	.L1827
+	movq	%rbx, %r14
+	leaq	0(%r13,%r12), %rax
+	subq	%r12, %r14
+	cmpq	$7, %r14
+	ja	.L1830
+	cmpb	$0, 37(%rsp)
+	jne	.L1831
+	movzbl	38(%rsp), %eax
+	movb	%al, 24(%rsp)
+	testb	%al, %al
+	jne	.L1831
+	testq	%r12, %r12
+	jne	.L2018
+.L1832:
+	movl	$8, %eax
+	cmpq	%rax, %r15
+	cmovbe	%r15, %rax
+	movq	%rax, 16(%rsp)
+	cmpq	%rax, %rbx
+	jnb	.L2019
+.L1838:
+	movq	%r15, %r14
+	leaq	0(%r13,%rbx), %r12
+	subq	%rbx, %r14
+	jmp	.L1835
+	.p2align 4,,10
+	.p2align 3
+.L2021:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2020
+.L1835:
+	movq	%r14, %rdx
+	movq	%r12, %rsi
+	movl	%ebp, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L2021
+	je	.L2022
+	addq	%rax, %rbx
+	movq	16(%rsp), %rax
+	movq	%rbx, 72(%rsp)
+	cmpq	%rax, %rbx
+	jb	.L1838
+	movq	64(%rsp), %r12
+	movq	%rbx, %rdx
+	subq	%r12, %rdx
+.L1837:
+	shrq	$3, %rdx
+	leaq	0(%r13,%r12), %rax
+	je	.L1831
+.L1830:
+	movl	(%rax), %eax
+	addq	$8, %r12
+	movq	%r12, 64(%rsp)
+	movl	%eax, 12(%rsp)
+.L1831:
+	cmpl	$9, 12(%rsp)
+	jne	.L1827
+	movq	%rbx, %r14
+	subq	%r12, %r14
+	cmpq	$7, %r14
+	ja	.L1840
+	cmpb	$0, 37(%rsp)
+	jne	.L1840
+	movzbl	38(%rsp), %eax
+	movb	%al, 12(%rsp)
+	testb	%al, %al
+	jne	.L1840
+	testq	%r12, %r12
+	jne	.L2023
+.L1841:
+	movl	$8, %eax
+	cmpq	%rax, %r15
+	cmovbe	%r15, %rax
+	movq	%rax, 16(%rsp)
+	cmpq	%rax, %rbx
+	jnb	.L1905
+.L1846:
+	movq	%r15, %r14
+	leaq	0(%r13,%rbx), %r12
+	subq	%rbx, %r14
+	jmp	.L1844
+	.p2align 4,,10
+	.p2align 3
+.L2025:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2024
+.L1844:
+	movq	%r14, %rdx
+	movq	%r12, %rsi
+	movl	%ebp, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L2025
+	je	.L2026
+	addq	%rax, %rbx
+	movq	16(%rsp), %rax
+	movq	%rbx, 72(%rsp)
+	cmpq	%rax, %rbx
+	jb	.L1846
+.L1905:
+	xorl	%r12d, %r12d
+.L1840:
+	cmpl	$10, 0(%r13,%r12)
+	jne	.L1997
+	xorl	%r13d, %r13d
+	.p2align 4,,10
+	.p2align 3
+.L1847:
+	movq	%rbx, %rdx
+	subq	%r12, %rdx
+	jne	.L2027
+	cmpb	$0, 37(%rsp)
+	jne	.L1854
+	movzbl	38(%rsp), %eax
+	movb	%al, 12(%rsp)
+	testb	%al, %al
+	jne	.L1854
+	movl	$800, %ebp
+	movq	56(%rsp), %r15
+	movl	32(%rsp), %r14d
+	subq	%r13, %rbp
+	cmpq	%r15, %rbp
+	jb	.L1855
+	movq	(%rsp), %rax
+	leaq	(%rax,%r13), %r15
+	jmp	.L1858
+	.p2align 4,,10
+	.p2align 3
+.L2029:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2028
+.L1858:
+	movq	%rbp, %rdx
+	movq	%r15, %rsi
+	movl	%r14d, %edi
+	call	read@PLT
+.LEHE77:
+	testq	%rax, %rax
+	js	.L2029
+	je	.L2030
+	addq	%rax, %r13
+.L1853:
+	cmpq	$799, %r13
+	jbe	.L1847
+	.p2align 4,,10
+	.p2align 3
+.L1854:
+	shrq	$3, %r13
+	cmpq	$90, %r13
+	jne	.L1998
+	cmpl	$99, 808(%rsp)
+	jne	.L1999
+	movl	32(%rsp), %ebx
+	movq	48(%rsp), %rbp
+	testl	%ebx, %ebx
+	js	.L1883
+	cmpl	$2, 40(%rsp)
+	je	.L2031
+.L1884:
+	cmpb	$0, 36(%rsp)
+	jne	.L2032
+.L1889:
+	movl	$-1, 32(%rsp)
+	movl	$-1, %ebx
+.L1883:
+	testq	%rbp, %rbp
+	je	.L2033
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2034
+.L1894:
+	movq	56(%rsp), %rdx
+	movq	48(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	80(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movl	32(%rsp), %ebx
+	movq	$0, 48(%rsp)
+	movl	$0, 40(%rsp)
+	movaps	%xmm0, 64(%rsp)
+	testq	%rdi, %rdi
+	je	.L1896
+.L1891:
+	call	fclose@PLT
+.L1896:
+	testl	%ebx, %ebx
+	js	.L1892
+	cmpb	$0, 36(%rsp)
+	jne	.L2035
+.L1892:
+	addq	$904, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	leaq	.LC4(%rip), %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	remove@PLT
+	.p2align 4,,10
+	.p2align 3
+.L2027:
+	.cfi_restore_state
+	movl	$800, %eax
+	movq	(%rsp), %rcx
+	movq	48(%rsp), %rsi
+	subq	%r13, %rax
+	cmpq	%rdx, %rax
+	cmova	%rdx, %rax
+	leaq	(%rcx,%r13), %rdx
+	addq	%r12, %rsi
+	cmpl	$8, %eax
+	jnb	.L1849
+	testb	$4, %al
+	jne	.L2036
+	testl	%eax, %eax
+	je	.L1850
+	movzbl	(%rsi), %ecx
+	movb	%cl, (%rdx)
+	testb	$2, %al
+	jne	.L2037
+.L1850:
+	addq	%rax, %r12
+	addq	%rax, %r13
+	movq	%r12, 64(%rsp)
+	jmp	.L1853
+	.p2align 4,,10
+	.p2align 3
+.L1855:
+	testl	%r14d, %r14d
+	js	.L1854
+	movq	48(%rsp), %rbp
+	testq	%rbp, %rbp
+	je	.L2038
+.L1861:
+	cmpl	$2, 40(%rsp)
+	je	.L2039
+.L1866:
+	movq	64(%rsp), %r12
+	movl	$1, 40(%rsp)
+	cmpq	%r12, %rbx
+	jne	.L1847
+	cmpb	$0, 37(%rsp)
+	jne	.L1854
+	movzbl	38(%rsp), %r14d
+	testb	%r14b, %r14b
+	jne	.L1854
+	testq	%rbx, %rbx
+	jne	.L2040
+.L1875:
+	testq	%r15, %r15
+	je	.L1854
+	movl	32(%rsp), %r12d
+	jmp	.L1878
+	.p2align 4,,10
+	.p2align 3
+.L2042:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2041
+.L1878:
+	movq	%r15, %rdx
+	movq	%rbp, %rsi
+	movl	%r12d, %edi
+.LEHB78:
+	call	read@PLT
+.LEHE78:
+	testq	%rax, %rax
+	js	.L2042
+	je	.L2043
+	movq	%rax, 72(%rsp)
+	movq	%rax, %rbx
+	xorl	%r12d, %r12d
+	jmp	.L1847
+	.p2align 4,,10
+	.p2align 3
+.L1849:
+	movq	(%rsi), %rcx
+	movq	%rcx, (%rdx)
+	movl	%eax, %ecx
+	movq	-8(%rsi,%rcx), %rdi
+	movq	%rdi, -8(%rdx,%rcx)
+	leaq	8(%rdx), %rdi
+	andq	$-8, %rdi
+	subq	%rdi, %rdx
+	subq	%rdx, %rsi
+	addl	%eax, %edx
+	shrl	$3, %edx
+	movl	%edx, %ecx
+	rep movsq
+	jmp	.L1850
+	.p2align 4,,10
+	.p2align 3
+.L2028:
+	movl	$1, %eax
+.L1857:
+	movzbl	12(%rsp), %ebx
+	movb	%al, 38(%rsp)
+	movb	%bl, 37(%rsp)
+	jmp	.L1854
+.L2033:
+	movq	80(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 40(%rsp)
+	movaps	%xmm0, 64(%rsp)
+	testq	%rdi, %rdi
+	jne	.L1891
+	jmp	.L1892
+.L2009:
+	movq	80(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 40(%rsp)
+	movaps	%xmm0, 64(%rsp)
+	testq	%rdi, %rdi
+	jne	.L1797
+	jmp	.L1798
+.L2041:
+	movl	$1, %eax
+.L1877:
+	movb	%r14b, 37(%rsp)
+	movb	%al, 38(%rsp)
+	jmp	.L1854
+.L2005:
+	movq	(%rsp), %rdi
+	movl	$800, %edx
+	movl	$10, %esi
+	call	memchr@PLT
+	testq	%rax, %rax
+	je	.L1779
+.L1778:
+	cmpl	$2, 40(%rsp)
+	jne	.L1779
+	movq	72(%rsp), %r13
+	testq	%r13, %r13
+	je	.L1779
+	movl	32(%rsp), %r15d
+	movq	%rbp, %r14
+.L1788:
+	movq	%r13, %rdx
+	movq	%r14, %rsi
+	movl	%r15d, %edi
+.LEHB79:
+	call	write@PLT
+.LEHE79:
+	testq	%rax, %rax
+	js	.L2044
+	addq	%rax, %r14
+	subq	%rax, %r13
+	jne	.L1788
+	movq	$0, 72(%rsp)
+	jmp	.L1779
+	.p2align 4,,10
+	.p2align 3
+.L2038:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2045
+.L1863:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	56(%rsp), %r15
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%r15, %rsi
+.LEHB80:
+	call	*16(%rax)
+.LEHE80:
+	movq	%rax, 48(%rsp)
+	movq	%rax, %rbp
+	testq	%rax, %rax
+	je	.L1854
+	movq	72(%rsp), %rbx
+	jmp	.L1861
+	.p2align 4,,10
+	.p2align 3
+.L2007:
+	movq	72(%rsp), %r14
+	testq	%r14, %r14
+	je	.L1790
+	movq	%rbp, %r12
+.L1794:
+	movq	%r14, %rdx
+	movq	%r12, %rsi
+	movl	%r13d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L2046
+	addq	%rax, %r12
+	subq	%rax, %r14
+	jne	.L1794
+.L1793:
+	movq	$0, 72(%rsp)
+	jmp	.L1790
+.L2031:
+	movq	72(%rsp), %r13
+	testq	%r13, %r13
+	je	.L1884
+	movq	%rbp, %r12
+.L1888:
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L2047
+	addq	%rax, %r12
+	subq	%rax, %r13
+	jne	.L1888
+.L1887:
+	movq	$0, 72(%rsp)
+	jmp	.L1884
+.L2032:
+	movl	%ebx, %edi
+	call	close@PLT
+	jmp	.L1889
+.L2008:
+	movl	%r13d, %edi
+	call	close@PLT
+	jmp	.L1795
+.L2035:
+	movl	%ebx, %edi
+	call	close@PLT
+	jmp	.L1892
+.L2011:
+	movl	%r13d, %edi
+	call	close@PLT
+	jmp	.L1798
+.L2010:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1800
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1800
+.L2034:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1894
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1894
+.L2036:
+	movl	(%rsi), %ecx
+	movl	%ecx, (%rdx)
+	movl	%eax, %ecx
+	movl	-4(%rsi,%rcx), %esi
+	movl	%esi, -4(%rdx,%rcx)
+	jmp	.L1850
+.L2039:
+	testq	%rbx, %rbx
+	jne	.L1867
+	xorl	%ebx, %ebx
+	jmp	.L1866
+.L1867:
+	movl	32(%rsp), %r14d
+	movq	%rbp, %r12
+.L1871:
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	movl	%r14d, %edi
+.LEHB81:
+	call	write@PLT
+.LEHE81:
+	testq	%rax, %rax
+	js	.L2048
+	addq	%rax, %r12
+	subq	%rax, %rbx
+	jne	.L1871
+.L1870:
+	movq	$0, 72(%rsp)
+	xorl	%ebx, %ebx
+	jmp	.L1866
+.L2020:
+	movl	$1, %eax
+.L1834:
+	movzbl	24(%rsp), %ecx
+	movq	64(%rsp), %r12
+	movq	%rbx, %rdx
+	movb	%al, 38(%rsp)
+	movb	%cl, 37(%rsp)
+	subq	%r12, %rdx
+	jmp	.L1837
+.L2015:
+	movl	$1, %eax
+.L1821:
+	movzbl	16(%rsp), %ecx
+	movq	64(%rsp), %r12
+	movq	%rbx, %rbp
+	movb	%al, 38(%rsp)
+	movb	%cl, 37(%rsp)
+	subq	%r12, %rbp
+	jmp	.L1817
+.L2024:
+	movl	$1, %eax
+.L1843:
+	movzbl	12(%rsp), %ecx
+	movb	%al, 38(%rsp)
+	xorl	%r12d, %r12d
+	movb	%cl, 37(%rsp)
+	jmp	.L1840
+.L2045:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1863
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1863
+.L2047:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1887
+	jmp	.L1888
+.L1766:
+	movl	32(%rsp), %r14d
+	movq	(%rsp), %r12
+	movl	$800, %r13d
+.L1777:
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+	movl	%r14d, %edi
+.LEHB82:
+	call	write@PLT
+.LEHE82:
+	testq	%rax, %rax
+	js	.L2049
+	addq	%rax, %r12
+	subq	%rax, %r13
+	jne	.L1777
+	movl	$1, %r12d
+	jmp	.L1774
+.L2049:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L1777
+	xorl	%r12d, %r12d
+	jmp	.L1774
+.L2037:
+	movl	%eax, %ecx
+	movzwl	-2(%rsi,%rcx), %esi
+	movw	%si, -2(%rdx,%rcx)
+	jmp	.L1850
+.L2046:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1793
+	jmp	.L1794
+.L2048:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1870
+	jmp	.L1871
+.L2044:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L1788
+	movq	$0, 72(%rsp)
+	jmp	.L1782
+.L2013:
+	testq	%rbx, %rbx
+	jne	.L1811
+	xorl	%ebx, %ebx
+	jmp	.L1810
+.L1811:
+	movl	32(%rsp), %r12d
+	movq	%rax, %rbp
+.L1815:
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movl	%r12d, %edi
+.LEHB83:
+	call	write@PLT
+.LEHE83:
+	testq	%rax, %rax
+	js	.L2050
+	addq	%rax, %rbp
+	subq	%rax, %rbx
+	jne	.L1815
+	jmp	.L1814
+	.p2align 4,,10
+	.p2align 3
+.L2040:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 64(%rsp)
+	jmp	.L1875
+.L2012:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1807
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1807
+.L2050:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L1815
+.L1814:
+	movq	$0, 72(%rsp)
+	xorl	%ebx, %ebx
+	jmp	.L1810
+.L2014:
+	leaq	0(%r13,%r12), %rsi
+	movq	%rbp, %rdx
+	movq	%r13, %rdi
+	movq	%rbp, %rbx
+	call	memmove@PLT
+	movq	%rbp, 72(%rsp)
+	movq	$0, 64(%rsp)
+	jmp	.L1818
+.L2023:
+	leaq	0(%r13,%r12), %rsi
+	movq	%r14, %rdx
+	movq	%r13, %rdi
+	movq	%r14, %rbx
+	call	memmove@PLT
+	movq	%r14, 72(%rsp)
+	movq	$0, 64(%rsp)
+	jmp	.L1841
+.L2018:
+	leaq	0(%r13,%r12), %rsi
+	movq	%r14, %rdx
+	movq	%r13, %rdi
+	movq	%r14, %rbx
+	call	memmove@PLT
+	movq	%r14, 72(%rsp)
+	movq	$0, 64(%rsp)
+	jmp	.L1832
+.L1769:
+	movl	32(%rsp), %r15d
+	movq	%rbp, %r14
+.L1773:
+	movq	%r13, %rdx
+	movq	%r14, %rsi
+	movl	%r15d, %edi
+.LEHB84:
+	call	write@PLT
+.LEHE84:
+	testq	%rax, %rax
+	js	.L2051
+	addq	%rax, %r14
+	subq	%rax, %r13
+	jne	.L1773
+.L1772:
+	movq	%rbp, %rax
+	movl	$800, %r13d
+	jmp	.L1768
+.L2043:
+	xorl	%eax, %eax
+	movl	$1, %r14d
+	jmp	.L1877
+.L2030:
+	movb	$1, 12(%rsp)
+	xorl	%eax, %eax
+	jmp	.L1857
+.L2051:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L1773
+	xorl	%r12d, %r12d
+	jmp	.L1772
+.L2017:
+	movb	$1, 16(%rsp)
+	xorl	%eax, %eax
+	jmp	.L1821
+.L2022:
+	movb	$1, 24(%rsp)
+	xorl	%eax, %eax
+	jmp	.L1834
+.L2026:
+	movb	$1, 12(%rsp)
+	xorl	%eax, %eax
+	jmp	.L1843
+.L2019:
+	xorl	%r12d, %r12d
+	jmp	.L1831
+.L1910:
+	movq	%rax, %rbx
+	jmp	.L1898
+.L1995:
+	jmp	.L1996
+	.section	.gcc_except_table
+.LLSDA6882:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6882-.LLSDACSB6882
+.LLSDACSB6882:
+	.uleb128 .LEHB74-.LFB6882
+	.uleb128 .LEHE74-.LEHB74
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB75-.LFB6882
+	.uleb128 .LEHE75-.LEHB75
+	.uleb128 .L1910-.LFB6882
+	.uleb128 0
+	.uleb128 .LEHB76-.LFB6882
+	.uleb128 .LEHE76-.LEHB76
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB77-.LFB6882
+	.uleb128 .LEHE77-.LEHB77
+	.uleb128 .L1995-.LFB6882
+	.uleb128 0
+	.uleb128 .LEHB78-.LFB6882
+	.uleb128 .LEHE78-.LEHB78
+	.uleb128 .L1995-.LFB6882
+	.uleb128 0
+	.uleb128 .LEHB79-.LFB6882
+	.uleb128 .LEHE79-.LEHB79
+	.uleb128 .L1910-.LFB6882
+	.uleb128 0
+	.uleb128 .LEHB80-.LFB6882
+	.uleb128 .LEHE80-.LEHB80
+	.uleb128 .L1995-.LFB6882
+	.uleb128 0
+	.uleb128 .LEHB81-.LFB6882
+	.uleb128 .LEHE81-.LEHB81
+	.uleb128 .L1995-.LFB6882
+	.uleb128 0
+	.uleb128 .LEHB82-.LFB6882
+	.uleb128 .LEHE82-.LEHB82
+	.uleb128 .L1910-.LFB6882
+	.uleb128 0
+	.uleb128 .LEHB83-.LFB6882
+	.uleb128 .LEHE83-.LEHB83
+	.uleb128 .L1995-.LFB6882
+	.uleb128 0
+	.uleb128 .LEHB84-.LFB6882
+	.uleb128 .LEHE84-.LEHB84
+	.uleb128 .L1910-.LFB6882
+	.uleb128 0
+.LLSDACSE6882:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6882
+	.type	_Z17test_file_recordsv.cold, @function
+_Z17test_file_recordsv.cold:
+.LFSB6882:
+.L1827:
+	.cfi_def_cfa_offset 960
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC83(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB85:
+	call	__cxa_throw@PLT
+.L1999:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC86(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L1998:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC85(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE85:
+.L1911:
+.L1996:
+	leaq	32(%rsp), %rbp
+	movq	%rax, %rbx
+	movq	%rbp, %rdi
+	call	_ZN1n4fileI6recordLNS_4modeE0EE5closeEv
+	movq	%rbp, %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB86:
+	call	_Unwind_Resume@PLT
+.LEHE86:
+.L1805:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC82(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB87:
+	call	__cxa_throw@PLT
+.L1997:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC84(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE87:
+.L1898:
+	leaq	32(%rsp), %rbp
+	movq	%rbp, %rdi
+	call	_ZN1n4fileI6recordLNS_4modeE1EE5closeEv
+	movq	%rbp, %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB88:
+	call	_Unwind_Resume@PLT
+.LEHE88:
+	.cfi_endproc
+.LFE6882:
+	.section	.gcc_except_table
+.LLSDAC6882:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6882-.LLSDACSBC6882
+.LLSDACSBC6882:
+	.uleb128 .LEHB85-.LCOLDB87
+	.uleb128 .LEHE85-.LEHB85
+	.uleb128 .L1911-.LCOLDB87
+	.uleb128 0
+	.uleb128 .LEHB86-.LCOLDB87
+	.uleb128 .LEHE86-.LEHB86
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB87-.LCOLDB87
+	.uleb128 .LEHE87-.LEHB87
+	.uleb128 .L1911-.LCOLDB87
+	.uleb128 0
+	.uleb128 .LEHB88-.LCOLDB87
+	.uleb128 .LEHE88-.LEHB88
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6882:
+	.section	.text.unlikely
+	.text
+	.size	_Z17test_file_recordsv, .-_Z17test_file_recordsv
+	.section	.text.unlikely
+	.size	_Z17test_file_recordsv.cold, .-_Z17test_file_recordsv.cold
+.LCOLDE87:
+	.text
+.LHOTE87:
+	.section	.text.unlikely
+.LCOLDB88:
+	.section	.text.startup
+.LHOTB88:
+	.p2align 4
+	.type	_GLOBAL__sub_I__Z7on_diskPKc, @function
+_GLOBAL__sub_I__Z7on_diskPKc:
+.LFB6945:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6945
+	cmpb	$0, _ZGVN1n4stdrE(%rip)
+	je	.L2083
+	ret
+.L2083:
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movl	$4294967295, %eax
+	xorl	%edi, %edi
+	xorl	%r8d, %r8d
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$48, %rsp
+	.cfi_def_cfa_offset 80
+	movdqa	.LC36(%rip), %xmm0
+	movq	stdin(%rip), %rbx
+	movb	$1, _ZGVN1n4stdrE(%rip)
+	movq	%rax, _ZN1n4stdrE(%rip)
+	movq	$0, 8+_ZN1n4stdrE(%rip)
+	movq	%rdi, 16+_ZN1n4stdrE(%rip)
+	movq	%r8, 40+_ZN1n4stdrE(%rip)
+	movups	%xmm0, 24+_ZN1n4stdrE(%rip)
+	testq	%rbx, %rbx
+	je	.L2084
+	movq	%rbx, %rdi
+	movq	%rbx, 48+_ZN1n4stdrE(%rip)
+	call	fileno@PLT
+	movq	%rbx, %rdi
+	call	fileno@PLT
+	movl	_ZN1n4stdrE(%rip), %ebx
+	xorl	%edx, %edx
+	xorl	%ecx, %ecx
+	movdqa	.LC36(%rip), %xmm0
+	movl	%eax, (%rsp)
+	movw	$0, 4(%rsp)
+	movb	$0, 6(%rsp)
+	movq	$0, 8(%rsp)
+	movq	%rdx, 16(%rsp)
+	movq	%rcx, 40(%rsp)
+	movups	%xmm0, 24(%rsp)
+	testl	%ebx, %ebx
+	js	.L2056
+	cmpl	$2, 8+_ZN1n4stdrE(%rip)
+	je	.L2085
+.L2057:
+	cmpb	$0, 4+_ZN1n4stdrE(%rip)
+	jne	.L2062
+.L2063:
+	movl	$-1, _ZN1n4stdrE(%rip)
+.L2056:
+	cmpq	$0, 16+_ZN1n4stdrE(%rip)
+	je	.L2068
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2086
+.L2066:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24+_ZN1n4stdrE(%rip), %rdx
+	movl	$64, %ecx
+	movq	16+_ZN1n4stdrE(%rip), %rsi
+	movq	(%rdi), %rax
+.LEHB89:
+	call	*24(%rax)
+.L2068:
+	movl	(%rsp), %eax
+	movdqu	24(%rsp), %xmm1
+	movl	%eax, _ZN1n4stdrE(%rip)
+	movzwl	4(%rsp), %eax
+	movups	%xmm1, 24+_ZN1n4stdrE(%rip)
+	movw	%ax, 4+_ZN1n4stdrE(%rip)
+	movzbl	6(%rsp), %eax
+	movb	%al, 6+_ZN1n4stdrE(%rip)
+	movq	8(%rsp), %rax
+	movq	%rax, 8+_ZN1n4stdrE(%rip)
+	movq	16(%rsp), %rax
+	movq	%rax, 16+_ZN1n4stdrE(%rip)
+	movq	40(%rsp), %rax
+	movq	%rax, 40+_ZN1n4stdrE(%rip)
+	jmp	.L2055
+.L2084:
+	xorl	%esi, %esi
+	movq	%rsi, 48+_ZN1n4stdrE(%rip)
+.L2055:
+	addq	$48, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	leaq	__dso_handle(%rip), %rdx
+	leaq	_ZN1n4stdrE(%rip), %rsi
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+	leaq	_ZN1n4fileIcLNS_4modeE6EED1Ev(%rip), %rdi
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+	jmp	__cxa_atexit@PLT
+.L2085:
+	.cfi_restore_state
+	movq	40+_ZN1n4stdrE(%rip), %rbp
+	testq	%rbp, %rbp
+	je	.L2057
+	movq	16+_ZN1n4stdrE(%rip), %r12
+.L2061:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L2087
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L2061
+.L2060:
+	xorl	%eax, %eax
+	movq	%rax, 40+_ZN1n4stdrE(%rip)
+	jmp	.L2057
+.L2062:
+	movl	_ZN1n4stdrE(%rip), %edi
+	call	close@PLT
+.LEHE89:
+	jmp	.L2063
+.L2086:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2066
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2066
+.L2087:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2060
+	jmp	.L2061
+.L2070:
+	movq	%rax, %rbx
+	jmp	.L2069
+	.section	.gcc_except_table
+.LLSDA6945:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6945-.LLSDACSB6945
+.LLSDACSB6945:
+	.uleb128 .LEHB89-.LFB6945
+	.uleb128 .LEHE89-.LEHB89
+	.uleb128 .L2070-.LFB6945
+	.uleb128 0
+.LLSDACSE6945:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6945
+	.type	_GLOBAL__sub_I__Z7on_diskPKc.cold, @function
+_GLOBAL__sub_I__Z7on_diskPKc.cold:
+.LFSB6945:
+.L2069:
+	.cfi_def_cfa_offset 80
+	.cfi_offset 3, -32
+	.cfi_offset 6, -24
+	.cfi_offset 12, -16
+	movq	%rsp, %rdi
+	call	_ZN1n7fd_file5closeEv
+	leaq	_ZN1n4stdrE(%rip), %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB90:
+	call	_Unwind_Resume@PLT
+.LEHE90:
+	.cfi_endproc
+.LFE6945:
+	.section	.gcc_except_table
+.LLSDAC6945:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6945-.LLSDACSBC6945
+.LLSDACSBC6945:
+	.uleb128 .LEHB90-.LCOLDB88
+	.uleb128 .LEHE90-.LEHB90
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6945:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	_GLOBAL__sub_I__Z7on_diskPKc, .-_GLOBAL__sub_I__Z7on_diskPKc
+	.section	.text.unlikely
+	.size	_GLOBAL__sub_I__Z7on_diskPKc.cold, .-_GLOBAL__sub_I__Z7on_diskPKc.cold
+.LCOLDE88:
+	.section	.text.startup
+.LHOTE88:
+	.section	.init_array,"aw"
+	.align 8
+	.quad	_GLOBAL__sub_I__Z7on_diskPKc
+	.weak	_ZGVN1n4stdrE
+	.section	.bss._ZGVN1n4stdrE,"awG",@nobits,_ZGVN1n4stdrE,comdat
+	.align 8
+	.type	_ZGVN1n4stdrE, @gnu_unique_object
+	.size	_ZGVN1n4stdrE, 8
+_ZGVN1n4stdrE:
+	.zero	8
+	.weak	_ZTSN1n15memory_resourceE
+	.section	.rodata._ZTSN1n15memory_resourceE,"aG",@progbits,_ZTSN1n15memory_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n15memory_resourceE, @object
+	.size	_ZTSN1n15memory_resourceE, 22
+_ZTSN1n15memory_resourceE:
+	.string	"N1n15memory_resourceE"
+	.weak	_ZTIN1n15memory_resourceE
+	.section	.data.rel.ro._ZTIN1n15memory_resourceE,"awG",@progbits,_ZTIN1n15memory_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n15memory_resourceE, @object
+	.size	_ZTIN1n15memory_resourceE, 16
+_ZTIN1n15memory_resourceE:
+	.quad	_ZTVN10__cxxabiv117__class_type_infoE+16
+	.quad	_ZTSN1n15memory_resourceE
+	.weak	_ZTSN1n13heap_resourceE
+	.section	.rodata._ZTSN1n13heap_resourceE,"aG",@progbits,_ZTSN1n13heap_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n13heap_resourceE, @object
+	.size	_ZTSN1n13heap_resourceE, 20
+_ZTSN1n13heap_resourceE:
+	.string	"N1n13heap_resourceE"
+	.weak	_ZTIN1n13heap_resourceE
+	.section	.data.rel.ro._ZTIN1n13heap_resourceE,"awG",@progbits,_ZTIN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n13heap_resourceE, @object
+	.size	_ZTIN1n13heap_resourceE, 24
+_ZTIN1n13heap_resourceE:
+	.quad	_ZTVN10__cxxabiv120__si_class_type_infoE+16
+	.quad	_ZTSN1n13heap_resourceE
+	.quad	_ZTIN1n15memory_resourceE
+	.weak	_ZTVN1n13heap_resourceE
+	.section	.data.rel.ro.local._ZTVN1n13heap_resourceE,"awG",@progbits,_ZTVN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTVN1n13heap_resourceE, @object
+	.size	_ZTVN1n13heap_resourceE, 48
+_ZTVN1n13heap_resourceE:
+	.quad	0
+	.quad	_ZTIN1n13heap_resourceE
+	.quad	_ZN1n13heap_resourceD1Ev
+	.quad	_ZN1n13heap_resourceD0Ev
+	.quad	_ZN1n13heap_resource8allocateEmm
+	.quad	_ZN1n13heap_resource10deallocateEPvmm
+	.weak	_ZN1n4stdrE
+	.section	.bss._ZN1n4stdrE,"awG",@nobits,_ZN1n4stdrE,comdat
+	.align 32
+	.type	_ZN1n4stdrE, @gnu_unique_object
+	.size	_ZN1n4stdrE, 56
+_ZN1n4stdrE:
+	.zero	56
+	.weak	_ZGVZN1n4heapEvE3res
+	.section	.bss._ZGVZN1n4heapEvE3res,"awG",@nobits,_ZGVZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZGVZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZGVZN1n4heapEvE3res, 8
+_ZGVZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE3res
+	.section	.bss._ZZN1n4heapEvE3res,"awG",@nobits,_ZZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZZN1n4heapEvE3res, 8
+_ZZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE7storage
+	.section	.bss._ZZN1n4heapEvE7storage,"awG",@nobits,_ZZN1n4heapEvE7storage,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE7storage, @gnu_unique_object
+	.size	_ZZN1n4heapEvE7storage, 8
+_ZZN1n4heapEvE7storage:
+	.zero	8
+	.set	.LC5,.LC36+2
+	.set	.LC6,.LC76
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC7:
+	.quad	64
+	.quad	0
+	.align 16
+.LC18:
+	.quad	16
+	.quad	0
+	.align 16
+.LC23:
+	.quad	8
+	.quad	0
+	.align 16
+.LC32:
+	.quad	7234314156275823970
+	.quad	2387299694422226720
+	.align 16
+.LC36:
+	.quad	65536
+	.quad	0
+	.align 16
+.LC52:
+	.quad	4
+	.quad	0
+	.section	.rodata.cst2,"aM",@progbits,2
+	.align 2
+.LC59:
+	.byte	10
+	.byte	0
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC74:
+	.long	6
+	.long	100
+	.section	.rodata.cst16
+	.align 16
+.LC76:
+	.long	0
+	.long	1
+	.long	2
+	.long	3
+	.align 16
+.LC77:
+	.long	4
+	.long	4
+	.long	4
+	.long	4
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC79:
+	.long	1056964608
+	.section	.rodata.cst16
+	.align 16
+.LC81:
+	.quad	84
+	.quad	0
+	.hidden	DW.ref._ZTIPKc
+	.weak	DW.ref._ZTIPKc
+	.section	.data.rel.local.DW.ref._ZTIPKc,"awG",@progbits,DW.ref._ZTIPKc,comdat
+	.align 8
+	.type	DW.ref._ZTIPKc, @object
+	.size	DW.ref._ZTIPKc, 8
+DW.ref._ZTIPKc:
+	.quad	_ZTIPKc
+	.hidden	DW.ref.__gxx_personality_v0
+	.weak	DW.ref.__gxx_personality_v0
+	.section	.data.rel.local.DW.ref.__gxx_personality_v0,"awG",@progbits,DW.ref.__gxx_personality_v0,comdat
+	.align 8
+	.type	DW.ref.__gxx_personality_v0, @object
+	.size	DW.ref.__gxx_personality_v0, 8
+DW.ref.__gxx_personality_v0:
+	.quad	__gxx_personality_v0
+	.hidden	__dso_handle
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
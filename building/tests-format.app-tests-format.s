@@ -0,0 +1,8943 @@
+	.file	"tests-format.cpp"
+	.text
+	.section	.text._ZN1n13heap_resourceD2Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD2Ev
+	.type	_ZN1n13heap_resourceD2Ev, @function
+_ZN1n13heap_resourceD2Ev:
+.LFB6861:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE6861:
+	.size	_ZN1n13heap_resourceD2Ev, .-_ZN1n13heap_resourceD2Ev
+	.weak	_ZN1n13heap_resourceD1Ev
+	.set	_ZN1n13heap_resourceD1Ev,_ZN1n13heap_resourceD2Ev
+	.section	.text._ZN1n13heap_resource10deallocateEPvmm,"axG",@progbits,_ZN1n13heap_resource10deallocateEPvmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource10deallocateEPvmm
+	.type	_ZN1n13heap_resource10deallocateEPvmm, @function
+_ZN1n13heap_resource10deallocateEPvmm:
+.LFB6590:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rcx
+	jbe	.L4
+	movq	%rcx, %rsi
+	jmp	_ZdlPvSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	jmp	_ZdlPv@PLT
+	.cfi_endproc
+.LFE6590:
+	.size	_ZN1n13heap_resource10deallocateEPvmm, .-_ZN1n13heap_resource10deallocateEPvmm
+	.section	.text._ZN1n13heap_resource8allocateEmm,"axG",@progbits,_ZN1n13heap_resource8allocateEmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource8allocateEmm
+	.type	_ZN1n13heap_resource8allocateEmm, @function
+_ZN1n13heap_resource8allocateEmm:
+.LFB6589:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rdx
+	jbe	.L6
+	movq	%rdx, %rsi
+	jmp	_ZnwmSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	jmp	_Znwm@PLT
+	.cfi_endproc
+.LFE6589:
+	.size	_ZN1n13heap_resource8allocateEmm, .-_ZN1n13heap_resource8allocateEmm
+	.section	.text._ZN1n13heap_resourceD0Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD0Ev
+	.type	_ZN1n13heap_resourceD0Ev, @function
+_ZN1n13heap_resourceD0Ev:
+.LFB6863:
+	.cfi_startproc
+	movl	$8, %esi
+	jmp	_ZdlPvm@PLT
+	.cfi_endproc
+.LFE6863:
+	.size	_ZN1n13heap_resourceD0Ev, .-_ZN1n13heap_resourceD0Ev
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"$"
+.LC1:
+	.string	"true"
+.LC2:
+	.string	"false"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC4:
+	.string	"expected equal : expected value : result, actual value : \"true\""
+	.align 8
+.LC5:
+	.string	"expected equal : expected value : result, actual value : \"false\""
+	.section	.text.unlikely,"ax",@progbits
+.LCOLDB7:
+	.text
+.LHOTB7:
+	.p2align 4
+	.globl	_Z16test_format_boolv
+	.type	_Z16test_format_boolv, @function
+_Z16test_format_boolv:
+.LFB6783:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6783
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	xorl	%r14d, %r14d
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movl	$23, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$152, %rsp
+	.cfi_def_cfa_offset 208
+	movdqa	.LC3(%rip), %xmm1
+	movaps	%xmm1, 48(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r13
+	testq	%r13, %r13
+	je	.L220
+.L9:
+	pxor	%xmm0, %xmm0
+	movl	$36, %esi
+	movq	%r13, 64(%rsp)
+	leaq	.LC0(%rip), %rdi
+	movq	$0, 88(%rsp)
+	movups	%xmm0, 72(%rsp)
+	call	strchrnul@PLT
+	leaq	.LC0(%rip), %rcx
+	movq	%rax, %rbx
+	movq	%rax, 32(%rsp)
+	movzbl	(%rax), %eax
+	subq	%rcx, %rbx
+	testb	%al, %al
+	jne	.L13
+	jmp	.L14
+	.p2align 4,,10
+	.p2align 3
+.L16:
+	addq	$1, %rbx
+	leaq	.LC0(%rip), %rax
+	movzbl	(%rax,%rbx), %eax
+	testb	%al, %al
+	je	.L15
+.L13:
+	cmpb	$36, %al
+	jne	.L16
+	leaq	.LC0(%rip), %rax
+	leaq	1(%rax,%rbx), %rax
+	movq	%rax, 32(%rsp)
+.L14:
+	leaq	(%r14,%rbx), %rax
+	xorl	%r15d, %r15d
+	cmpq	$23, %r12
+	je	.L221
+.L18:
+	leaq	(%r15,%r14), %rdx
+	leaq	.LC0(%rip), %rcx
+	cmpq	%rdx, %rcx
+	jb	.L20
+	cmpq	%rax, %r12
+	jnb	.L133
+.L126:
+	leaq	10(%r12,%r12), %rdx
+	movq	%r13, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, (%rsp)
+	leaq	1(%rax), %rsi
+	movq	0(%r13), %rax
+.LEHB0:
+	call	*16(%rax)
+	leaq	1(%r14), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	cmpq	$23, %r12
+	je	.L22
+	movq	0(%r13), %rax
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r13, %rdi
+	call	*24(%rax)
+.L22:
+	movq	(%rsp), %rax
+	movq	%rbp, 72(%rsp)
+	movq	%rax, 56(%rsp)
+.L21:
+	cmpq	$23, (%rsp)
+	leaq	.LC0(%rip), %rsi
+	je	.L222
+.L26:
+	movq	%rbx, %rdx
+	leaq	0(%rbp,%r14), %rdi
+	leaq	.LC1(%rip), %r13
+	call	memmove@PLT
+	addq	48(%rsp), %rbx
+	movl	$4096, %esi
+	movq	%r13, %rdi
+	movq	%rbx, 48(%rsp)
+	movb	$0, 0(%rbp,%rbx)
+	call	strnlen@PLT
+	movq	%rax, %rbx
+	leaq	0(%r13,%rax), %r15
+	leaq	72(%rsp), %rax
+	movq	%rax, (%rsp)
+	testq	%rbx, %rbx
+	jne	.L28
+	jmp	.L44
+	.p2align 4,,10
+	.p2align 3
+.L224:
+	leaq	(%r14,%r12), %rdx
+	cmpq	%rdx, %r13
+	jnb	.L32
+	subq	%r14, %r13
+	movq	%r13, 8(%rsp)
+	cmpq	%rax, %rbp
+	jnb	.L37
+	leaq	10(%rbp,%rbp), %rdx
+	movq	64(%rsp), %r13
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r13, %rdi
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	0(%r13), %rax
+	call	*16(%rax)
+.LEHE0:
+	movq	%rax, 16(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L38
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	0(%r13), %rax
+	leaq	1(%rbp), %rdx
+	movq	%r13, %rdi
+	movq	72(%rsp), %rsi
+	movl	$1, %ecx
+.LEHB1:
+	call	*24(%rax)
+.LEHE1:
+.L39:
+	movq	16(%rsp), %rax
+	movq	%rax, 72(%rsp)
+	movq	24(%rsp), %rax
+	movq	%rax, 56(%rsp)
+	movq	%rax, %rbp
+.L37:
+	cmpq	$23, %rbp
+	je	.L223
+	movq	72(%rsp), %rbp
+	movq	8(%rsp), %r13
+	addq	%rbp, %r13
+.L42:
+	movq	%rbx, %rdx
+	leaq	0(%rbp,%r12), %rdi
+	movq	%r13, %rsi
+	call	memmove@PLT
+	addq	48(%rsp), %rbx
+	movq	%rbx, 48(%rsp)
+	movb	$0, 0(%rbp,%rbx)
+.L216:
+	movl	$4096, %esi
+	movq	%r15, %rdi
+	call	strnlen@PLT
+	movq	%rax, %rbx
+	leaq	(%r15,%rax), %rax
+	testq	%rbx, %rbx
+	je	.L44
+	movq	%r15, %r13
+	movq	%rax, %r15
+.L28:
+	movq	56(%rsp), %rbp
+	movq	(%rsp), %r14
+	cmpq	$23, %rbp
+	je	.L31
+	movq	72(%rsp), %r14
+.L31:
+	movq	48(%rsp), %r12
+	leaq	(%r12,%rbx), %rax
+	cmpq	%r14, %r13
+	jnb	.L224
+.L32:
+	cmpq	%rax, %rbp
+	jnb	.L34
+	leaq	10(%rbp,%rbp), %rdx
+	movq	64(%rsp), %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%rdi, 24(%rsp)
+	movl	$1, %edx
+	movq	%rax, 16(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%rdi), %rax
+.LEHB2:
+	call	*16(%rax)
+.LEHE2:
+	movq	%rax, 8(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L35
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	24(%rsp), %rdi
+	movq	72(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB3:
+	call	*24(%rax)
+.LEHE3:
+.L36:
+	movq	8(%rsp), %rax
+	movq	%rax, 72(%rsp)
+	movq	16(%rsp), %rax
+	movq	%rax, 56(%rsp)
+	movq	%rax, %rbp
+.L34:
+	cmpq	$23, %rbp
+	je	.L171
+	movq	72(%rsp), %rbp
+	jmp	.L42
+	.p2align 4,,10
+	.p2align 3
+.L20:
+	leaq	.LC0(%rip), %rcx
+	subq	%r15, %rcx
+	movq	%rcx, (%rsp)
+	cmpq	%rax, %r12
+	jnb	.L134
+	leaq	10(%r12,%r12), %rdx
+	movq	%r13, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 8(%rsp)
+	leaq	1(%rax), %rsi
+	movq	0(%r13), %rax
+.LEHB4:
+	call	*16(%rax)
+	leaq	1(%r14), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	cmpq	$23, %r12
+	je	.L24
+	movq	0(%r13), %rax
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r13, %rdi
+	call	*24(%rax)
+.L24:
+	movq	8(%rsp), %rax
+	movq	%rbp, 72(%rsp)
+	movq	%rax, 56(%rsp)
+	movq	%rax, %r12
+.L23:
+	cmpq	$23, %r12
+	jne	.L214
+	leaq	72(%rsp), %rbp
+.L214:
+	movq	(%rsp), %rsi
+	addq	%rbp, %rsi
+	jmp	.L26
+	.p2align 4,,10
+	.p2align 3
+.L171:
+	movq	(%rsp), %rbp
+.L41:
+	movq	%rbx, %rdx
+	leaq	0(%rbp,%r12), %rdi
+	movq	%r13, %rsi
+	call	memmove@PLT
+	addq	48(%rsp), %rbx
+	movq	%rbx, 48(%rsp)
+	movb	$0, 72(%rsp,%rbx)
+	jmp	.L216
+	.p2align 4,,10
+	.p2align 3
+.L35:
+	movq	%rax, %rdi
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L36
+	.p2align 4,,10
+	.p2align 3
+.L44:
+	movq	32(%rsp), %rdi
+	movq	$-1, %rsi
+	leaq	72(%rsp), %r13
+	call	strnlen@PLT
+	movq	56(%rsp), %rbp
+	movq	%rax, %rbx
+	cmpq	$23, %rbp
+	je	.L29
+	movq	72(%rsp), %r13
+.L29:
+	movq	48(%rsp), %r12
+	movq	32(%rsp), %rcx
+	leaq	(%rbx,%r12), %r15
+	cmpq	%r13, %rcx
+	jb	.L45
+	leaq	0(%r13,%r12), %rax
+	cmpq	%rax, %rcx
+	jnb	.L45
+	movq	%rcx, %rax
+	subq	%r13, %rax
+	movq	%rax, (%rsp)
+	cmpq	%r15, %rbp
+	jnb	.L50
+	leaq	10(%rbp,%rbp), %rax
+	movq	64(%rsp), %r14
+	movl	$1, %edx
+	cmpq	%r15, %rax
+	cmovnb	%rax, %r15
+	movq	(%r14), %rax
+	movq	%r14, %rdi
+	leaq	1(%r15), %rsi
+	call	*16(%rax)
+.LEHE4:
+	movq	%rax, 8(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L51
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r14), %rax
+	movq	72(%rsp), %rsi
+	movq	%r14, %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+.LEHB5:
+	call	*24(%rax)
+.LEHE5:
+.L52:
+	movq	8(%rsp), %rax
+	movq	%r15, 56(%rsp)
+	movq	%r15, %rbp
+	movq	%rax, 72(%rsp)
+.L50:
+	cmpq	$23, %rbp
+	je	.L225
+	movq	72(%rsp), %rbp
+	movq	(%rsp), %rax
+	addq	%rbp, %rax
+	movq	%rax, 32(%rsp)
+	jmp	.L55
+	.p2align 4,,10
+	.p2align 3
+.L45:
+	cmpq	%r15, %rbp
+	jnb	.L47
+	leaq	10(%rbp,%rbp), %rax
+	movq	64(%rsp), %r14
+	movl	$1, %edx
+	cmpq	%r15, %rax
+	cmovnb	%rax, %r15
+	movq	(%r14), %rax
+	movq	%r14, %rdi
+	leaq	1(%r15), %rsi
+.LEHB6:
+	call	*16(%rax)
+.LEHE6:
+	movq	%rax, (%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L48
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r14), %rax
+	movq	72(%rsp), %rsi
+	movq	%r14, %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+.LEHB7:
+	call	*24(%rax)
+.LEHE7:
+.L49:
+	movq	(%rsp), %rax
+	movq	%r15, 56(%rsp)
+	movq	%r15, %rbp
+	movq	%rax, 72(%rsp)
+.L47:
+	leaq	72(%rsp), %r13
+	cmpq	$23, %rbp
+	je	.L54
+	movq	72(%rsp), %rbp
+.L55:
+	movq	%rbp, %r13
+.L54:
+	movq	32(%rsp), %rsi
+	movq	%rbx, %rdx
+	leaq	0(%r13,%r12), %rdi
+	call	memmove@PLT
+	addq	48(%rsp), %rbx
+	leaq	72(%rsp), %rdx
+	movq	%rbx, 48(%rsp)
+	movb	$0, 0(%r13,%rbx)
+	movq	56(%rsp), %rcx
+	movq	48(%rsp), %rax
+	movq	%rcx, 40(%rsp)
+	cmpq	$23, %rcx
+	je	.L56
+	movq	72(%rsp), %rdx
+.L56:
+	cmpq	$4, %rax
+	jne	.L60
+	cmpl	$1702195828, (%rdx)
+	jne	.L60
+	movdqa	.LC3(%rip), %xmm2
+	movaps	%xmm2, 96(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r13
+	testq	%r13, %r13
+	je	.L61
+	xorl	%ebp, %ebp
+	movl	$23, %r12d
+.L62:
+	pxor	%xmm0, %xmm0
+	movl	$36, %esi
+	movq	%r13, 112(%rsp)
+	leaq	.LC0(%rip), %rdi
+	movq	$0, 136(%rsp)
+	movups	%xmm0, 120(%rsp)
+	call	strchrnul@PLT
+	leaq	.LC0(%rip), %rcx
+	movq	%rax, %rbx
+	movq	%rax, 32(%rsp)
+	movzbl	(%rax), %eax
+	subq	%rcx, %rbx
+	testb	%al, %al
+	jne	.L66
+	jmp	.L67
+	.p2align 4,,10
+	.p2align 3
+.L69:
+	addq	$1, %rbx
+	leaq	.LC0(%rip), %rax
+	movzbl	(%rax,%rbx), %eax
+	testb	%al, %al
+	je	.L68
+.L66:
+	cmpb	$36, %al
+	jne	.L69
+	leaq	.LC0(%rip), %rax
+	leaq	1(%rax,%rbx), %rax
+	movq	%rax, 32(%rsp)
+.L67:
+	leaq	(%rbx,%rbp), %rax
+	xorl	%r15d, %r15d
+	cmpq	$23, %r12
+	je	.L226
+.L71:
+	leaq	(%r15,%rbp), %rdx
+	leaq	.LC0(%rip), %rcx
+	cmpq	%rdx, %rcx
+	jnb	.L227
+	leaq	.LC0(%rip), %rcx
+	subq	%r15, %rcx
+	movq	%rcx, (%rsp)
+	cmpq	%rax, %r12
+	jnb	.L143
+	leaq	10(%r12,%r12), %rdx
+	movq	%r13, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 8(%rsp)
+	leaq	1(%rax), %rsi
+	movq	0(%r13), %rax
+.LEHB8:
+	call	*16(%rax)
+	leaq	1(%rbp), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %r14
+	call	memcpy@PLT
+	cmpq	$23, %r12
+	je	.L77
+	movq	0(%r13), %rax
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r13, %rdi
+	call	*24(%rax)
+.L77:
+	movq	8(%rsp), %rax
+	movq	%r14, 120(%rsp)
+	movq	%rax, 104(%rsp)
+	movq	%rax, %r12
+.L76:
+	cmpq	$23, %r12
+	jne	.L217
+	leaq	120(%rsp), %r14
+.L217:
+	movq	(%rsp), %rsi
+	addq	%r14, %rsi
+	jmp	.L79
+	.p2align 4,,10
+	.p2align 3
+.L223:
+	movq	8(%rsp), %r13
+	leaq	72(%rsp), %rbp
+	addq	%rbp, %r13
+	jmp	.L41
+	.p2align 4,,10
+	.p2align 3
+.L227:
+	cmpq	%rax, %r12
+	jnb	.L142
+.L125:
+	leaq	10(%r12,%r12), %rdx
+	movq	%r13, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, (%rsp)
+	leaq	1(%rax), %rsi
+	movq	0(%r13), %rax
+	call	*16(%rax)
+	leaq	1(%rbp), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %r14
+	call	memcpy@PLT
+	cmpq	$23, %r12
+	je	.L75
+	movq	0(%r13), %rax
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r13, %rdi
+	call	*24(%rax)
+.L75:
+	movq	(%rsp), %rax
+	movq	%r14, 120(%rsp)
+	movq	%rax, 104(%rsp)
+.L74:
+	cmpq	$23, (%rsp)
+	leaq	.LC0(%rip), %rsi
+	je	.L228
+.L79:
+	movq	%rbx, %rdx
+	leaq	(%r14,%rbp), %rdi
+	leaq	.LC2(%rip), %r13
+	call	memmove@PLT
+	addq	96(%rsp), %rbx
+	movl	$4096, %esi
+	movq	%r13, %rdi
+	movq	%rbx, 96(%rsp)
+	movb	$0, (%r14,%rbx)
+	call	strnlen@PLT
+	movq	%rax, %rbx
+	leaq	0(%r13,%rax), %r15
+	leaq	120(%rsp), %rax
+	movq	%rax, (%rsp)
+	testq	%rbx, %rbx
+	jne	.L81
+	jmp	.L97
+	.p2align 4,,10
+	.p2align 3
+.L230:
+	leaq	(%r14,%r12), %rdx
+	cmpq	%rdx, %r13
+	jnb	.L85
+	subq	%r14, %r13
+	movq	%r13, 8(%rsp)
+	cmpq	%rax, %rbp
+	jnb	.L90
+	leaq	10(%rbp,%rbp), %rdx
+	movq	112(%rsp), %r13
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r13, %rdi
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	0(%r13), %rax
+	call	*16(%rax)
+.LEHE8:
+	movq	%rax, 16(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L91
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	0(%r13), %rax
+	leaq	1(%rbp), %rdx
+	movq	%r13, %rdi
+	movq	120(%rsp), %rsi
+	movl	$1, %ecx
+.LEHB9:
+	call	*24(%rax)
+.LEHE9:
+.L92:
+	movq	16(%rsp), %rax
+	movq	%rax, 120(%rsp)
+	movq	24(%rsp), %rax
+	movq	%rax, 104(%rsp)
+	movq	%rax, %rbp
+.L90:
+	cmpq	$23, %rbp
+	je	.L229
+	movq	120(%rsp), %rbp
+	movq	8(%rsp), %r13
+	addq	%rbp, %r13
+.L95:
+	movq	%rbx, %rdx
+	leaq	0(%rbp,%r12), %rdi
+	movq	%r13, %rsi
+	call	memmove@PLT
+	addq	96(%rsp), %rbx
+	movq	%rbx, 96(%rsp)
+	movb	$0, 0(%rbp,%rbx)
+.L219:
+	movl	$4096, %esi
+	movq	%r15, %rdi
+	call	strnlen@PLT
+	movq	%rax, %rbx
+	leaq	(%r15,%rax), %rax
+	testq	%rbx, %rbx
+	je	.L97
+	movq	%r15, %r13
+	movq	%rax, %r15
+.L81:
+	movq	104(%rsp), %rbp
+	movq	(%rsp), %r14
+	cmpq	$23, %rbp
+	je	.L84
+	movq	120(%rsp), %r14
+.L84:
+	movq	96(%rsp), %r12
+	leaq	(%rbx,%r12), %rax
+	cmpq	%r14, %r13
+	jnb	.L230
+.L85:
+	cmpq	%rax, %rbp
+	jnb	.L87
+	leaq	10(%rbp,%rbp), %rdx
+	movq	112(%rsp), %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%rdi, 24(%rsp)
+	movl	$1, %edx
+	movq	%rax, 16(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%rdi), %rax
+.LEHB10:
+	call	*16(%rax)
+.LEHE10:
+	movq	%rax, 8(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L88
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	24(%rsp), %rdi
+	movq	120(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB11:
+	call	*24(%rax)
+.LEHE11:
+.L89:
+	movq	8(%rsp), %rax
+	movq	%rax, 120(%rsp)
+	movq	16(%rsp), %rax
+	movq	%rax, 104(%rsp)
+	movq	%rax, %rbp
+.L87:
+	cmpq	$23, %rbp
+	je	.L172
+	movq	120(%rsp), %rbp
+	jmp	.L95
+	.p2align 4,,10
+	.p2align 3
+.L172:
+	movq	(%rsp), %r14
+.L94:
+	movq	%rbx, %rdx
+	leaq	(%r14,%r12), %rdi
+	movq	%r13, %rsi
+	call	memmove@PLT
+	addq	96(%rsp), %rbx
+	movq	%rbx, 96(%rsp)
+	movb	$0, 120(%rsp,%rbx)
+	jmp	.L219
+	.p2align 4,,10
+	.p2align 3
+.L88:
+	movq	%rax, %rdi
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L89
+	.p2align 4,,10
+	.p2align 3
+.L97:
+	movq	32(%rsp), %rdi
+	movq	$-1, %rsi
+	leaq	120(%rsp), %r13
+	call	strnlen@PLT
+	movq	104(%rsp), %rbp
+	movq	%rax, %rbx
+	cmpq	$23, %rbp
+	je	.L82
+	movq	120(%rsp), %r13
+.L82:
+	movq	96(%rsp), %r12
+	movq	32(%rsp), %rcx
+	leaq	(%rbx,%r12), %r15
+	cmpq	%r13, %rcx
+	jb	.L98
+	leaq	0(%r13,%r12), %rax
+	cmpq	%rax, %rcx
+	jnb	.L98
+	movq	%rcx, %rax
+	subq	%r13, %rax
+	movq	%rax, (%rsp)
+	cmpq	%r15, %rbp
+	jnb	.L103
+	leaq	10(%rbp,%rbp), %rax
+	movq	112(%rsp), %r14
+	movl	$1, %edx
+	cmpq	%r15, %rax
+	cmovnb	%rax, %r15
+	movq	(%r14), %rax
+	movq	%r14, %rdi
+	leaq	1(%r15), %rsi
+.LEHB12:
+	call	*16(%rax)
+.LEHE12:
+	movq	%rax, 8(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L104
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r14), %rax
+	movq	120(%rsp), %rsi
+	movq	%r14, %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+.LEHB13:
+	call	*24(%rax)
+.LEHE13:
+.L105:
+	movq	8(%rsp), %rax
+	movq	%r15, 104(%rsp)
+	movq	%r15, %rbp
+	movq	%rax, 120(%rsp)
+.L103:
+	cmpq	$23, %rbp
+	je	.L231
+	movq	120(%rsp), %rbp
+	movq	(%rsp), %rax
+	addq	%rbp, %rax
+	movq	%rax, 32(%rsp)
+	jmp	.L108
+	.p2align 4,,10
+	.p2align 3
+.L98:
+	cmpq	%r15, %rbp
+	jnb	.L100
+	leaq	10(%rbp,%rbp), %rax
+	movq	112(%rsp), %r14
+	movl	$1, %edx
+	cmpq	%r15, %rax
+	cmovnb	%rax, %r15
+	movq	(%r14), %rax
+	movq	%r14, %rdi
+	leaq	1(%r15), %rsi
+.LEHB14:
+	call	*16(%rax)
+.LEHE14:
+	movq	%rax, (%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L101
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r14), %rax
+	movq	120(%rsp), %rsi
+	movq	%r14, %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+.LEHB15:
+	call	*24(%rax)
+.LEHE15:
+.L102:
+	movq	(%rsp), %rax
+	movq	%r15, 104(%rsp)
+	movq	%r15, %rbp
+	movq	%rax, 120(%rsp)
+.L100:
+	leaq	120(%rsp), %r13
+	cmpq	$23, %rbp
+	je	.L107
+	movq	120(%rsp), %rbp
+.L108:
+	movq	%rbp, %r13
+.L107:
+	movq	32(%rsp), %rsi
+	movq	%rbx, %rdx
+	leaq	0(%r13,%r12), %rdi
+	call	memmove@PLT
+	addq	96(%rsp), %rbx
+	cmpq	$23, 40(%rsp)
+	movq	%rbx, 96(%rsp)
+	movb	$0, 0(%r13,%rbx)
+	je	.L115
+	movq	64(%rsp), %rdi
+	movq	40(%rsp), %rdx
+	movl	$1, %ecx
+	movq	72(%rsp), %rsi
+	movq	(%rdi), %rax
+	addq	$1, %rdx
+.LEHB16:
+	call	*24(%rax)
+.LEHE16:
+.L115:
+	movdqa	96(%rsp), %xmm3
+	movq	112(%rsp), %rdi
+	movq	104(%rsp), %rdx
+	movq	96(%rsp), %rcx
+	movq	%rdi, 64(%rsp)
+	movaps	%xmm3, 48(%rsp)
+	cmpq	$23, %rdx
+	je	.L232
+	movq	120(%rsp), %rax
+	movq	%rax, 72(%rsp)
+.L116:
+	cmpq	$5, %rcx
+	jne	.L117
+	cmpl	$1936482662, (%rax)
+	jne	.L117
+	cmpb	$101, 4(%rax)
+	jne	.L117
+	cmpq	$23, %rdx
+	je	.L8
+	movq	(%rdi), %rax
+	movq	72(%rsp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	call	*24(%rax)
+.L8:
+	addq	$152, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L229:
+	.cfi_restore_state
+	movq	8(%rsp), %r13
+	leaq	120(%rsp), %r14
+	addq	%r14, %r13
+	jmp	.L94
+	.p2align 4,,10
+	.p2align 3
+.L91:
+	movq	%rax, %rdi
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L92
+	.p2align 4,,10
+	.p2align 3
+.L38:
+	movq	%rax, %rdi
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L39
+	.p2align 4,,10
+	.p2align 3
+.L68:
+	leaq	.LC0(%rip), %rax
+	xorl	%r15d, %r15d
+	addq	%rbx, %rax
+	movq	%rax, 32(%rsp)
+	leaq	(%rbx,%rbp), %rax
+	cmpq	$23, %r12
+	jne	.L71
+.L226:
+	leaq	120(%rsp), %r14
+	leaq	.LC0(%rip), %rcx
+	cmpq	%r14, %rcx
+	jnb	.L233
+	movq	%r14, %r15
+	cmpq	$23, %rax
+	ja	.L125
+	leaq	.LC0(%rip), %rsi
+	jmp	.L79
+	.p2align 4,,10
+	.p2align 3
+.L15:
+	leaq	.LC0(%rip), %rax
+	xorl	%r15d, %r15d
+	addq	%rbx, %rax
+	movq	%rax, 32(%rsp)
+	leaq	(%r14,%rbx), %rax
+	cmpq	$23, %r12
+	jne	.L18
+.L221:
+	leaq	72(%rsp), %rbp
+	leaq	.LC0(%rip), %rcx
+	cmpq	%rbp, %rcx
+	jnb	.L234
+	movq	%rbp, %r15
+	cmpq	$23, %rax
+	ja	.L126
+	leaq	.LC0(%rip), %rsi
+	jmp	.L26
+	.p2align 4,,10
+	.p2align 3
+.L232:
+	movq	136(%rsp), %rax
+	movdqu	120(%rsp), %xmm4
+	movq	%rax, 88(%rsp)
+	leaq	72(%rsp), %rax
+	movups	%xmm4, 72(%rsp)
+	jmp	.L116
+.L231:
+	movq	(%rsp), %rax
+	leaq	120(%rsp), %rbp
+	movq	%rbp, %r13
+	addq	%rbp, %rax
+	movq	%rax, 32(%rsp)
+	jmp	.L107
+.L143:
+	xorl	%r14d, %r14d
+	jmp	.L76
+.L225:
+	movq	(%rsp), %rax
+	leaq	72(%rsp), %rbp
+	movq	%rbp, %r13
+	addq	%rbp, %rax
+	movq	%rax, 32(%rsp)
+	jmp	.L54
+.L134:
+	xorl	%ebp, %ebp
+	jmp	.L23
+	.p2align 4,,10
+	.p2align 3
+.L61:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L235
+.L64:
+	movq	56(%rsp), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %r13
+	movq	104(%rsp), %r12
+	movq	96(%rsp), %rbp
+	movq	%rax, 40(%rsp)
+	jmp	.L62
+	.p2align 4,,10
+	.p2align 3
+.L220:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L236
+.L11:
+	movq	_ZZN1n4heapEvE3res(%rip), %r13
+	movq	56(%rsp), %r12
+	movq	48(%rsp), %r14
+	jmp	.L9
+	.p2align 4,,10
+	.p2align 3
+.L101:
+	movq	%rax, %rdi
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L102
+	.p2align 4,,10
+	.p2align 3
+.L48:
+	movq	%rax, %rdi
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L49
+	.p2align 4,,10
+	.p2align 3
+.L228:
+	leaq	120(%rsp), %r14
+	jmp	.L79
+	.p2align 4,,10
+	.p2align 3
+.L222:
+	leaq	72(%rsp), %rbp
+	jmp	.L26
+	.p2align 4,,10
+	.p2align 3
+.L133:
+	movq	%r12, (%rsp)
+	xorl	%ebp, %ebp
+	jmp	.L21
+	.p2align 4,,10
+	.p2align 3
+.L142:
+	movq	%r12, (%rsp)
+	xorl	%r14d, %r14d
+	jmp	.L74
+.L233:
+	movq	%r14, %r15
+	jmp	.L71
+.L234:
+	movq	%rbp, %r15
+	jmp	.L18
+.L235:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L64
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L64
+.L236:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L11
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L11
+.L51:
+	movq	%rax, %rdi
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L52
+.L104:
+	movq	%rax, %rdi
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L105
+.L152:
+	movq	%rax, %rbx
+	jmp	.L122
+.L154:
+	movq	%rax, %rbx
+	jmp	.L127
+.L155:
+	movq	%rax, %rbx
+	jmp	.L58
+.L153:
+	movq	%rax, %rbx
+	jmp	.L129
+.L156:
+	movq	%rax, %rbx
+	jmp	.L112
+	.globl	__gxx_personality_v0
+	.section	.gcc_except_table,"a",@progbits
+.LLSDA6783:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6783-.LLSDACSB6783
+.LLSDACSB6783:
+	.uleb128 .LEHB0-.LFB6783
+	.uleb128 .LEHE0-.LEHB0
+	.uleb128 .L155-.LFB6783
+	.uleb128 0
+	.uleb128 .LEHB1-.LFB6783
+	.uleb128 .LEHE1-.LEHB1
+	.uleb128 .L153-.LFB6783
+	.uleb128 0
+	.uleb128 .LEHB2-.LFB6783
+	.uleb128 .LEHE2-.LEHB2
+	.uleb128 .L155-.LFB6783
+	.uleb128 0
+	.uleb128 .LEHB3-.LFB6783
+	.uleb128 .LEHE3-.LEHB3
+	.uleb128 .L153-.LFB6783
+	.uleb128 0
+	.uleb128 .LEHB4-.LFB6783
+	.uleb128 .LEHE4-.LEHB4
+	.uleb128 .L155-.LFB6783
+	.uleb128 0
+	.uleb128 .LEHB5-.LFB6783
+	.uleb128 .LEHE5-.LEHB5
+	.uleb128 .L153-.LFB6783
+	.uleb128 0
+	.uleb128 .LEHB6-.LFB6783
+	.uleb128 .LEHE6-.LEHB6
+	.uleb128 .L155-.LFB6783
+	.uleb128 0
+	.uleb128 .LEHB7-.LFB6783
+	.uleb128 .LEHE7-.LEHB7
+	.uleb128 .L153-.LFB6783
+	.uleb128 0
+	.uleb128 .LEHB8-.LFB6783
+	.uleb128 .LEHE8-.LEHB8
+	.uleb128 .L156-.LFB6783
+	.uleb128 0
+	.uleb128 .LEHB9-.LFB6783
+	.uleb128 .LEHE9-.LEHB9
+	.uleb128 .L154-.LFB6783
+	.uleb128 0
+	.uleb128 .LEHB10-.LFB6783
+	.uleb128 .LEHE10-.LEHB10
+	.uleb128 .L156-.LFB6783
+	.uleb128 0
+	.uleb128 .LEHB11-.LFB6783
+	.uleb128 .LEHE11-.LEHB11
+	.uleb128 .L154-.LFB6783
+	.uleb128 0
+	.uleb128 .LEHB12-.LFB6783
+	.uleb128 .LEHE12-.LEHB12
+	.uleb128 .L156-.LFB6783
+	.uleb128 0
+	.uleb128 .LEHB13-.LFB6783
+	.uleb128 .LEHE13-.LEHB13
+	.uleb128 .L154-.LFB6783
+	.uleb128 0
+	.uleb128 .LEHB14-.LFB6783
+	.uleb128 .LEHE14-.LEHB14
+	.uleb128 .L156-.LFB6783
+	.uleb128 0
+	.uleb128 .LEHB15-.LFB6783
+	.uleb128 .LEHE15-.LEHB15
+	.uleb128 .L154-.LFB6783
+	.uleb128 0
+	.uleb128 .LEHB16-.LFB6783
+	.uleb128 .LEHE16-.LEHB16
+	.uleb128 .L152-.LFB6783
+	.uleb128 0
+.LLSDACSE6783:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6783
+	.type	_Z16test_format_boolv.cold, @function
+_Z16test_format_boolv.cold:
+.LFSB6783:
+.L117:
+	.cfi_def_cfa_offset 208
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC5(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB17:
+	call	__cxa_throw@PLT
+.LEHE17:
+.L151:
+	movq	%rax, %rbx
+.L114:
+	movq	56(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L124
+	movq	64(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	72(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L124:
+	movq	%rbx, %rdi
+.LEHB18:
+	call	_Unwind_Resume@PLT
+.LEHE18:
+.L122:
+	movq	104(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L114
+	movq	112(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	120(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L114
+.L127:
+	movq	104(%rsp), %rax
+.L128:
+	movq	112(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	120(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L114
+.L60:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC4(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB19:
+	call	__cxa_throw@PLT
+.LEHE19:
+.L58:
+	movq	56(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L59
+.L130:
+	movq	64(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	72(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L59:
+	movq	%rbx, %rdi
+.LEHB20:
+	call	_Unwind_Resume@PLT
+.LEHE20:
+.L129:
+	movq	56(%rsp), %rax
+	jmp	.L130
+.L112:
+	movq	104(%rsp), %rax
+	cmpq	$23, %rax
+	jne	.L128
+	jmp	.L114
+	.cfi_endproc
+.LFE6783:
+	.section	.gcc_except_table
+.LLSDAC6783:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6783-.LLSDACSBC6783
+.LLSDACSBC6783:
+	.uleb128 .LEHB17-.LCOLDB7
+	.uleb128 .LEHE17-.LEHB17
+	.uleb128 .L151-.LCOLDB7
+	.uleb128 0
+	.uleb128 .LEHB18-.LCOLDB7
+	.uleb128 .LEHE18-.LEHB18
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB19-.LCOLDB7
+	.uleb128 .LEHE19-.LEHB19
+	.uleb128 .L151-.LCOLDB7
+	.uleb128 0
+	.uleb128 .LEHB20-.LCOLDB7
+	.uleb128 .LEHE20-.LEHB20
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6783:
+	.section	.text.unlikely
+	.text
+	.size	_Z16test_format_boolv, .-_Z16test_format_boolv
+	.section	.text.unlikely
+	.size	_Z16test_format_boolv.cold, .-_Z16test_format_boolv.cold
+.LCOLDE7:
+	.text
+.LHOTE7:
+	.section	.rodata.str1.1
+.LC8:
+	.string	"Hello, $!"
+.LC9:
+	.string	"world"
+.LC10:
+	.string	"The answer is $"
+.LC11:
+	.string	"$ is $ years old"
+.LC12:
+	.string	"John"
+.LC13:
+	.string	"Hello, world!"
+	.section	.rodata.str1.8
+	.align 8
+.LC14:
+	.string	"expected equal : expected value : str, actual value : \"Hello, world!\""
+	.section	.rodata.str1.1
+.LC16:
+	.string	"Hello, world!The answer is 42"
+	.section	.rodata.str1.8
+	.align 8
+.LC17:
+	.string	"expected equal : expected value : str, actual value : \"Hello, world!The answer is 42\""
+	.align 8
+.LC19:
+	.string	"Hello, world!The answer is 42John is 30 years old"
+	.align 8
+.LC20:
+	.string	"expected equal : expected value : str, actual value : \"Hello, world!The answer is 42John is 30 years old\""
+	.section	.text.unlikely
+.LCOLDB21:
+	.text
+.LHOTB21:
+	.p2align 4
+	.globl	_Z21test_format_to_stringv
+	.type	_Z21test_format_to_stringv, @function
+_Z21test_format_to_stringv:
+.LFB6778:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6778
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movl	$23, %r13d
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	xorl	%r12d, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$136, %rsp
+	.cfi_def_cfa_offset 192
+	movdqa	.LC3(%rip), %xmm0
+	movaps	%xmm0, 80(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r14
+	testq	%r14, %r14
+	je	.L483
+.L238:
+	leaq	.LC8(%rip), %rbp
+	pxor	%xmm0, %xmm0
+	movl	$36, %esi
+	movq	%r14, 96(%rsp)
+	movq	%rbp, %rdi
+	movups	%xmm0, 104(%rsp)
+	movq	$0, 120(%rsp)
+	call	strchrnul@PLT
+	movq	%rax, %rbx
+	movq	%rax, 32(%rsp)
+	movzbl	(%rax), %eax
+	subq	%rbp, %rbx
+	testb	%al, %al
+	jne	.L242
+	jmp	.L243
+	.p2align 4,,10
+	.p2align 3
+.L245:
+	addq	$1, %rbx
+	movzbl	0(%rbp,%rbx), %eax
+	testb	%al, %al
+	je	.L244
+.L242:
+	cmpb	$36, %al
+	jne	.L245
+	leaq	1(%rbp,%rbx), %rax
+	movq	%rax, 32(%rsp)
+.L243:
+	leaq	(%r12,%rbx), %rax
+	xorl	%r15d, %r15d
+	cmpq	$23, %r13
+	je	.L484
+.L247:
+	leaq	(%r15,%r12), %rdx
+	cmpq	%rdx, %rbp
+	jb	.L249
+	cmpq	%rax, %r13
+	jnb	.L408
+.L405:
+	leaq	10(%r13,%r13), %rdx
+	movq	%r14, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, (%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r14), %rax
+.LEHB21:
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L251
+	movq	(%r14), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L251:
+	movq	(%rsp), %rax
+	movq	%rbp, 104(%rsp)
+	movq	%rax, 88(%rsp)
+.L250:
+	cmpq	$23, (%rsp)
+	leaq	.LC8(%rip), %rsi
+	leaq	104(%rsp), %rdi
+	je	.L478
+.L255:
+	movq	%rbx, %rdx
+	leaq	0(%rbp,%r12), %rdi
+	leaq	.LC9(%rip), %r13
+	call	memmove@PLT
+	addq	80(%rsp), %rbx
+	movl	$4096, %esi
+	movq	%r13, %rdi
+	movq	%rbx, 80(%rsp)
+	movb	$0, 0(%rbp,%rbx)
+	call	strnlen@PLT
+	movq	%rax, %rbx
+	leaq	0(%r13,%rax), %r15
+	leaq	104(%rsp), %rax
+	movq	%rax, (%rsp)
+	testq	%rbx, %rbx
+	jne	.L257
+	jmp	.L273
+	.p2align 4,,10
+	.p2align 3
+.L486:
+	leaq	(%r14,%r12), %rdx
+	cmpq	%rdx, %r13
+	jnb	.L261
+	subq	%r14, %r13
+	movq	%r13, 8(%rsp)
+	cmpq	%rax, %rbp
+	jnb	.L266
+	leaq	10(%rbp,%rbp), %rdx
+	movq	96(%rsp), %r13
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r13, %rdi
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	0(%r13), %rax
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L267
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	0(%r13), %rax
+	leaq	1(%rbp), %rdx
+	movq	%r13, %rdi
+	movq	104(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.L268:
+	movq	16(%rsp), %rax
+	movq	%rax, 104(%rsp)
+	movq	24(%rsp), %rax
+	movq	%rax, 88(%rsp)
+	movq	%rax, %rbp
+.L266:
+	cmpq	$23, %rbp
+	je	.L485
+	movq	104(%rsp), %r14
+	movq	8(%rsp), %r13
+	addq	%r14, %r13
+.L271:
+	movq	%rbx, %rdx
+	leaq	(%r14,%r12), %rdi
+	movq	%r13, %rsi
+	call	memmove@PLT
+	addq	80(%rsp), %rbx
+	movq	%rbx, 80(%rsp)
+	movb	$0, (%r14,%rbx)
+.L480:
+	movl	$4096, %esi
+	movq	%r15, %rdi
+	call	strnlen@PLT
+	movq	%rax, %rbx
+	leaq	(%r15,%rax), %rax
+	testq	%rbx, %rbx
+	je	.L273
+	movq	%r15, %r13
+	movq	%rax, %r15
+.L257:
+	movq	88(%rsp), %rbp
+	movq	(%rsp), %r14
+	cmpq	$23, %rbp
+	je	.L260
+	movq	104(%rsp), %r14
+.L260:
+	movq	80(%rsp), %r12
+	leaq	(%r12,%rbx), %rax
+	cmpq	%r14, %r13
+	jnb	.L486
+.L261:
+	cmpq	%rax, %rbp
+	jnb	.L263
+	leaq	10(%rbp,%rbp), %rdx
+	movq	96(%rsp), %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%rdi, 24(%rsp)
+	movl	$1, %edx
+	movq	%rax, 16(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, 8(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L264
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	24(%rsp), %rdi
+	movq	104(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L265:
+	movq	8(%rsp), %rax
+	movq	%rax, 104(%rsp)
+	movq	16(%rsp), %rax
+	movq	%rax, 88(%rsp)
+	movq	%rax, %rbp
+.L263:
+	cmpq	$23, %rbp
+	je	.L440
+	movq	104(%rsp), %r14
+	jmp	.L271
+	.p2align 4,,10
+	.p2align 3
+.L249:
+	subq	%r15, %rbp
+	movq	%rbp, (%rsp)
+	cmpq	%rax, %r13
+	jnb	.L409
+	leaq	10(%r13,%r13), %rdx
+	movq	%r14, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 8(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r14), %rax
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L253
+	movq	(%r14), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L253:
+	movq	8(%rsp), %rax
+	movq	%rbp, 104(%rsp)
+	movq	%rax, 88(%rsp)
+	movq	%rax, %r13
+.L252:
+	cmpq	$23, %r13
+	je	.L254
+	movq	(%rsp), %rsi
+	addq	%rbp, %rsi
+	jmp	.L255
+	.p2align 4,,10
+	.p2align 3
+.L440:
+	movq	(%rsp), %rdi
+.L270:
+	movq	%rbx, %rdx
+	addq	%r12, %rdi
+	movq	%r13, %rsi
+	call	memmove@PLT
+	addq	80(%rsp), %rbx
+	movq	%rbx, 80(%rsp)
+	movb	$0, 104(%rsp,%rbx)
+	jmp	.L480
+	.p2align 4,,10
+	.p2align 3
+.L264:
+	movq	%rax, %rdi
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L265
+	.p2align 4,,10
+	.p2align 3
+.L273:
+	movq	32(%rsp), %rdi
+	movq	$-1, %rsi
+	leaq	104(%rsp), %r13
+	call	strnlen@PLT
+	movq	88(%rsp), %rbp
+	movq	%rax, %rbx
+	cmpq	$23, %rbp
+	je	.L258
+	movq	104(%rsp), %r13
+.L258:
+	movq	80(%rsp), %r12
+	movq	32(%rsp), %rcx
+	leaq	(%rbx,%r12), %r15
+	cmpq	%r13, %rcx
+	jb	.L274
+	leaq	0(%r13,%r12), %rax
+	cmpq	%rax, %rcx
+	jnb	.L274
+	movq	%rcx, %rax
+	subq	%r13, %rax
+	movq	%rax, (%rsp)
+	cmpq	%r15, %rbp
+	jnb	.L279
+	leaq	10(%rbp,%rbp), %r14
+	movl	$1, %edx
+	cmpq	%r15, %r14
+	cmovb	%r15, %r14
+	movq	96(%rsp), %r15
+	movq	(%r15), %rax
+	leaq	1(%r14), %rsi
+	movq	%r15, %rdi
+	call	*16(%rax)
+	movq	%rax, 8(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L280
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	movq	104(%rsp), %rsi
+	movq	%r15, %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	call	*24(%rax)
+.L281:
+	movq	8(%rsp), %rax
+	movq	%r14, 88(%rsp)
+	movq	%r14, %rbp
+	movq	%rax, 104(%rsp)
+.L279:
+	cmpq	$23, %rbp
+	je	.L487
+	movq	104(%rsp), %r14
+	movq	(%rsp), %rax
+	addq	%r14, %rax
+	movq	%rax, 32(%rsp)
+	jmp	.L283
+	.p2align 4,,10
+	.p2align 3
+.L274:
+	cmpq	%r15, %rbp
+	jnb	.L276
+	leaq	10(%rbp,%rbp), %rax
+	movq	96(%rsp), %r14
+	movl	$1, %edx
+	cmpq	%r15, %rax
+	cmovnb	%rax, %r15
+	movq	(%r14), %rax
+	movq	%r14, %rdi
+	leaq	1(%r15), %rsi
+	call	*16(%rax)
+	movq	%rax, (%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L277
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r14), %rax
+	movq	104(%rsp), %rsi
+	movq	%r14, %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	call	*24(%rax)
+.L278:
+	movq	(%rsp), %rax
+	movq	%r15, 88(%rsp)
+	movq	%r15, %rbp
+	movq	%rax, 104(%rsp)
+.L276:
+	leaq	104(%rsp), %r14
+	cmpq	$23, %rbp
+	je	.L283
+	movq	104(%rsp), %r14
+.L283:
+	movq	32(%rsp), %rsi
+	movq	%rbx, %rdx
+	leaq	(%r14,%r12), %rdi
+	leaq	104(%rsp), %r13
+	call	memmove@PLT
+	addq	80(%rsp), %rbx
+	movq	%rbx, 80(%rsp)
+	movb	$0, (%r14,%rbx)
+	movq	88(%rsp), %rbp
+	movq	80(%rsp), %rax
+	cmpq	$23, %rbp
+	je	.L285
+	movq	104(%rsp), %r13
+.L285:
+	cmpq	$13, %rax
+	jne	.L286
+	movabsq	$8583909746840200520, %rax
+	cmpq	%rax, 0(%r13)
+	jne	.L286
+	movabsq	$2406167339674837036, %rax
+	cmpq	%rax, 5(%r13)
+	jne	.L286
+	leaq	.LC10(%rip), %r14
+	movl	$36, %esi
+	movq	%r14, %rdi
+	call	strchrnul@PLT
+	movq	%rax, %rbx
+	movq	%rax, 8(%rsp)
+	movzbl	(%rax), %eax
+	subq	%r14, %rbx
+	testb	%al, %al
+	jne	.L289
+	jmp	.L290
+	.p2align 4,,10
+	.p2align 3
+.L292:
+	addq	$1, %rbx
+	movzbl	(%r14,%rbx), %eax
+	testb	%al, %al
+	je	.L291
+.L289:
+	cmpb	$36, %al
+	jne	.L292
+	leaq	1(%r14,%rbx), %rax
+	movq	%rax, 8(%rsp)
+.L290:
+	leaq	13(%rbx), %r12
+	cmpq	%r13, %r14
+	jb	.L294
+	leaq	13(%r13), %rax
+	cmpq	%rax, %r14
+	jnb	.L294
+	subq	%r13, %r14
+	movq	%r14, (%rsp)
+	cmpq	%r12, %rbp
+	jnb	.L299
+	leaq	10(%rbp,%rbp), %rax
+	movq	96(%rsp), %r14
+	movl	$1, %edx
+	cmpq	%r12, %rax
+	cmovb	%r12, %rax
+	movq	%r14, %rdi
+	movq	%rax, 16(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r14), %rax
+	call	*16(%rax)
+	movq	%rax, %r15
+	movq	0(%r13), %rax
+	movq	%rax, (%r15)
+	movq	6(%r13), %rax
+	movq	%rax, 6(%r15)
+	cmpq	$23, %rbp
+	je	.L301
+	movq	(%r14), %rax
+	movq	104(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movq	%r14, %rdi
+	movl	$1, %ecx
+	call	*24(%rax)
+.L301:
+	movq	16(%rsp), %rax
+	movq	%r15, 104(%rsp)
+	movq	%rax, 88(%rsp)
+	movq	%rax, %rbp
+.L299:
+	cmpq	$23, %rbp
+	je	.L488
+	movq	104(%rsp), %r14
+	movq	(%rsp), %rsi
+	addq	%r14, %rsi
+	.p2align 4,,10
+	.p2align 3
+.L303:
+	leaq	13(%r14), %rdi
+	movq	%rbx, %rdx
+	call	memmove@PLT
+	leaq	48(%rsp), %rcx
+	movq	%r12, 80(%rsp)
+	movzwl	.LC15(%rip), %eax
+	movb	$0, (%r14,%r12)
+	movq	%rcx, (%rsp)
+	movw	%ax, 48(%rsp)
+	movl	$2, %eax
+	.p2align 4,,10
+	.p2align 3
+.L305:
+	movq	(%rsp), %rcx
+	movq	80(%rsp), %rbx
+	leaq	-1(%rax), %r12
+	movq	88(%rsp), %rbp
+	movzbl	-1(%rcx,%rax), %r13d
+	cmpq	%rbp, %rbx
+	je	.L489
+.L306:
+	cmpq	$23, %rbp
+	je	.L309
+	movq	104(%rsp), %rdx
+	movb	%r13b, (%rdx,%rbx)
+	movq	80(%rsp), %rax
+	leaq	1(%rax), %rcx
+	movq	%rcx, 80(%rsp)
+	movb	$0, 1(%rdx,%rax)
+	testq	%r12, %r12
+	je	.L311
+.L310:
+	movl	$1, %eax
+	jmp	.L305
+	.p2align 4,,10
+	.p2align 3
+.L485:
+	movq	8(%rsp), %r13
+	leaq	104(%rsp), %rdi
+	addq	%rdi, %r13
+	jmp	.L270
+	.p2align 4,,10
+	.p2align 3
+.L267:
+	movq	%rax, %rdi
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L268
+	.p2align 4,,10
+	.p2align 3
+.L244:
+	leaq	0(%rbp,%rbx), %rax
+	xorl	%r15d, %r15d
+	movq	%rax, 32(%rsp)
+	leaq	(%r12,%rbx), %rax
+	cmpq	$23, %r13
+	jne	.L247
+.L484:
+	leaq	104(%rsp), %rdi
+	cmpq	%rdi, %rbp
+	jnb	.L490
+	movq	%rdi, %r15
+	cmpq	$23, %rax
+	ja	.L405
+	leaq	.LC8(%rip), %rsi
+.L478:
+	movq	%rdi, %rbp
+	jmp	.L255
+.L487:
+	movq	(%rsp), %rax
+	leaq	104(%rsp), %rcx
+	movq	%rcx, %r14
+	addq	%rcx, %rax
+	movq	%rax, 32(%rsp)
+	jmp	.L283
+.L409:
+	xorl	%ebp, %ebp
+	jmp	.L252
+	.p2align 4,,10
+	.p2align 3
+.L483:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L491
+.L240:
+	movq	_ZZN1n4heapEvE3res(%rip), %r14
+	movq	88(%rsp), %r13
+	movq	80(%rsp), %r12
+	jmp	.L238
+	.p2align 4,,10
+	.p2align 3
+.L277:
+	movq	%rax, %rdi
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L278
+	.p2align 4,,10
+	.p2align 3
+.L408:
+	movq	%r13, (%rsp)
+	xorl	%ebp, %ebp
+	jmp	.L250
+.L254:
+	movq	(%rsp), %rsi
+	leaq	104(%rsp), %rdi
+	addq	%rdi, %rsi
+	jmp	.L478
+.L490:
+	movq	%rdi, %r15
+	jmp	.L247
+.L491:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L240
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L240
+.L280:
+	movq	%rax, %rdi
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L281
+	.p2align 4,,10
+	.p2align 3
+.L309:
+	movb	%r13b, 104(%rsp,%rbx)
+	movq	80(%rsp), %rax
+	addq	$1, %rax
+	movq	%rax, 80(%rsp)
+	movb	$0, 104(%rsp,%rax)
+	testq	%r12, %r12
+	jne	.L310
+.L311:
+	movq	88(%rsp), %rbx
+	leaq	104(%rsp), %r12
+	cmpq	$23, %rbx
+	je	.L313
+	movq	104(%rsp), %r12
+.L313:
+	movq	8(%rsp), %r14
+	movq	$-1, %rsi
+	movq	%r14, %rdi
+	call	strnlen@PLT
+	movq	80(%rsp), %r13
+	movq	%rax, %rbp
+	leaq	(%rax,%r13), %r15
+	cmpq	%r12, %r14
+	jb	.L314
+	leaq	(%r12,%r13), %rax
+	cmpq	%rax, %r14
+	jnb	.L314
+	movq	%r14, %rax
+	subq	%r12, %rax
+	movq	%rax, 8(%rsp)
+	cmpq	%r15, %rbx
+	jnb	.L319
+	leaq	10(%rbx,%rbx), %rax
+	movq	96(%rsp), %r14
+	movl	$1, %edx
+	cmpq	%r15, %rax
+	cmovnb	%rax, %r15
+	movq	(%r14), %rax
+	movq	%r14, %rdi
+	leaq	1(%r15), %rsi
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	leaq	1(%r13), %rdx
+	cmpq	$23, %rbx
+	je	.L320
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r14), %rax
+	movq	104(%rsp), %rsi
+	movq	%r14, %rdi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	call	*24(%rax)
+.L321:
+	movq	16(%rsp), %rax
+	movq	%r15, 88(%rsp)
+	movq	%r15, %rbx
+	movq	%rax, 104(%rsp)
+.L319:
+	cmpq	$23, %rbx
+	je	.L492
+	movq	8(%rsp), %rax
+	movq	104(%rsp), %r14
+	addq	%r14, %rax
+	movq	%rax, 8(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L323:
+	movq	8(%rsp), %rsi
+	leaq	(%r14,%r13), %rdi
+	movq	%rbp, %rdx
+	leaq	104(%rsp), %r13
+	call	memmove@PLT
+	addq	80(%rsp), %rbp
+	movq	%rbp, 80(%rsp)
+	movb	$0, (%r14,%rbp)
+	movq	88(%rsp), %rbp
+	movq	80(%rsp), %rax
+	cmpq	$23, %rbp
+	je	.L325
+	movq	104(%rsp), %r13
+.L325:
+	cmpq	$29, %rax
+	jne	.L326
+	movabsq	$7307182897804112495, %rax
+	xorq	8(%r13), %rax
+	movabsq	$8583909746840200520, %rdx
+	xorq	0(%r13), %rdx
+	orq	%rdx, %rax
+	jne	.L326
+	movabsq	$3617552080742412901, %rax
+	xorq	21(%r13), %rax
+	movabsq	$8607344676269549652, %rdx
+	xorq	13(%r13), %rdx
+	orq	%rdx, %rax
+	jne	.L326
+	leaq	.LC11(%rip), %r14
+	movl	$36, %esi
+	movq	%r14, %rdi
+	call	strchrnul@PLT
+	movq	%rax, %rbx
+	movq	%rax, 8(%rsp)
+	movzbl	(%rax), %eax
+	subq	%r14, %rbx
+	testb	%al, %al
+	jne	.L329
+	jmp	.L330
+	.p2align 4,,10
+	.p2align 3
+.L332:
+	addq	$1, %rbx
+	movzbl	(%r14,%rbx), %eax
+	testb	%al, %al
+	je	.L331
+.L329:
+	cmpb	$36, %al
+	jne	.L332
+	leaq	1(%r14,%rbx), %rax
+	movq	%rax, 8(%rsp)
+.L330:
+	leaq	29(%rbx), %r12
+	cmpq	%r13, %r14
+	jb	.L334
+	leaq	29(%r13), %rax
+	cmpq	%rax, %r14
+	jnb	.L334
+	subq	%r13, %r14
+	movq	%r14, 16(%rsp)
+	cmpq	%r12, %rbp
+	jnb	.L339
+	leaq	10(%rbp,%rbp), %rax
+	movq	96(%rsp), %r14
+	movl	$1, %edx
+	cmpq	%r12, %rax
+	cmovb	%r12, %rax
+	movq	%r14, %rdi
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r14), %rax
+	call	*16(%rax)
+	movq	%rax, %r15
+	cmpq	$23, %rbp
+	je	.L340
+	movdqu	0(%r13), %xmm5
+	movq	104(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movq	%r14, %rdi
+	movl	$1, %ecx
+	movups	%xmm5, (%rax)
+	movdqu	14(%r13), %xmm6
+	movups	%xmm6, 14(%rax)
+	movq	(%r14), %rax
+	call	*24(%rax)
+.L341:
+	movq	24(%rsp), %rax
+	movq	%r15, 104(%rsp)
+	movq	%rax, 88(%rsp)
+	movq	%rax, %rbp
+.L339:
+	cmpq	$23, %rbp
+	je	.L493
+	movq	104(%rsp), %r14
+	movq	16(%rsp), %rsi
+	addq	%r14, %rsi
+	.p2align 4,,10
+	.p2align 3
+.L343:
+	movq	%rbx, %rdx
+	leaq	29(%r14), %rdi
+	leaq	.LC12(%rip), %r13
+	call	memmove@PLT
+	movq	%r12, 80(%rsp)
+	movl	$4096, %esi
+	movq	%r13, %rdi
+	movb	$0, (%r14,%r12)
+	call	strnlen@PLT
+	movq	%rax, %rbx
+	leaq	0(%r13,%rax), %r15
+	leaq	104(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	testq	%rbx, %rbx
+	jne	.L345
+	jmp	.L361
+	.p2align 4,,10
+	.p2align 3
+.L495:
+	leaq	(%r14,%r12), %rdx
+	cmpq	%rdx, %r13
+	jnb	.L349
+	subq	%r14, %r13
+	movq	%r13, 24(%rsp)
+	cmpq	%rax, %rbp
+	jnb	.L354
+	leaq	10(%rbp,%rbp), %rdx
+	movq	96(%rsp), %r13
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r13, %rdi
+	movl	$1, %edx
+	movq	%rax, 40(%rsp)
+	leaq	1(%rax), %rsi
+	movq	0(%r13), %rax
+	call	*16(%rax)
+	movq	%rax, 32(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L355
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	0(%r13), %rax
+	leaq	1(%rbp), %rdx
+	movq	%r13, %rdi
+	movq	104(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.L356:
+	movq	32(%rsp), %rax
+	movq	%rax, 104(%rsp)
+	movq	40(%rsp), %rax
+	movq	%rax, 88(%rsp)
+	movq	%rax, %rbp
+.L354:
+	cmpq	$23, %rbp
+	je	.L494
+	movq	104(%rsp), %r14
+	movq	24(%rsp), %r13
+	addq	%r14, %r13
+.L359:
+	movq	%rbx, %rdx
+	leaq	(%r14,%r12), %rdi
+	movq	%r13, %rsi
+	call	memmove@PLT
+	addq	80(%rsp), %rbx
+	movq	%rbx, 80(%rsp)
+	movb	$0, (%r14,%rbx)
+.L482:
+	movl	$4096, %esi
+	movq	%r15, %rdi
+	call	strnlen@PLT
+	movq	%rax, %rbx
+	leaq	(%r15,%rax), %rax
+	testq	%rbx, %rbx
+	je	.L361
+	movq	%r15, %r13
+	movq	%rax, %r15
+.L345:
+	movq	88(%rsp), %rbp
+	movq	16(%rsp), %r14
+	cmpq	$23, %rbp
+	je	.L348
+	movq	104(%rsp), %r14
+.L348:
+	movq	80(%rsp), %r12
+	leaq	(%r12,%rbx), %rax
+	cmpq	%r14, %r13
+	jnb	.L495
+.L349:
+	cmpq	%rax, %rbp
+	jnb	.L351
+	leaq	10(%rbp,%rbp), %rdx
+	movq	96(%rsp), %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%rdi, 40(%rsp)
+	movl	$1, %edx
+	movq	%rax, 32(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, 24(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L352
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	40(%rsp), %rdi
+	movq	104(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L353:
+	movq	24(%rsp), %rax
+	movq	%rax, 104(%rsp)
+	movq	32(%rsp), %rax
+	movq	%rax, 88(%rsp)
+	movq	%rax, %rbp
+.L351:
+	cmpq	$23, %rbp
+	je	.L441
+	movq	104(%rsp), %r14
+	jmp	.L359
+	.p2align 4,,10
+	.p2align 3
+.L441:
+	movq	16(%rsp), %rdi
+.L358:
+	movq	%rbx, %rdx
+	addq	%r12, %rdi
+	movq	%r13, %rsi
+	call	memmove@PLT
+	addq	80(%rsp), %rbx
+	movq	%rbx, 80(%rsp)
+	movb	$0, 104(%rsp,%rbx)
+	jmp	.L482
+	.p2align 4,,10
+	.p2align 3
+.L489:
+	leaq	1(%rbx), %r14
+	cmpq	%r14, %rbx
+	jnb	.L306
+	leaq	10(%rbx,%rbx), %rax
+	movq	96(%rsp), %r15
+	movl	$1, %edx
+	cmpq	%r14, %rax
+	cmovb	%r14, %rax
+	movq	%r15, %rdi
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	cmpq	$23, %rbp
+	je	.L307
+	movq	104(%rsp), %rsi
+	movq	%r14, %rdx
+	movq	%rax, %rdi
+	movq	%rsi, 32(%rsp)
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	movq	32(%rsp), %rsi
+	movq	%r15, %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	call	*24(%rax)
+.L308:
+	movq	16(%rsp), %rax
+	movq	%rax, 104(%rsp)
+	movq	24(%rsp), %rax
+	movq	%rax, 88(%rsp)
+	movq	%rax, %rbp
+	jmp	.L306
+	.p2align 4,,10
+	.p2align 3
+.L352:
+	movq	%rax, %rdi
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L353
+	.p2align 4,,10
+	.p2align 3
+.L361:
+	movq	8(%rsp), %r15
+	movl	$36, %esi
+	movq	%r15, %rdi
+	call	strchrnul@PLT
+	movq	%rax, %rbx
+	movq	%rax, %r13
+	movzbl	(%rax), %eax
+	subq	%r15, %rbx
+	testb	%al, %al
+	jne	.L346
+	jmp	.L347
+	.p2align 4,,10
+	.p2align 3
+.L363:
+	movq	8(%rsp), %rax
+	addq	$1, %rbx
+	movzbl	(%rax,%rbx), %eax
+	testb	%al, %al
+	je	.L362
+.L346:
+	cmpb	$36, %al
+	jne	.L363
+	movq	8(%rsp), %rax
+	leaq	1(%rax,%rbx), %r13
+.L347:
+	movq	88(%rsp), %rbp
+	leaq	104(%rsp), %r14
+	cmpq	$23, %rbp
+	je	.L365
+	movq	104(%rsp), %r14
+.L365:
+	movq	80(%rsp), %r12
+	movq	8(%rsp), %rcx
+	leaq	(%r12,%rbx), %rax
+	cmpq	%r14, %rcx
+	jb	.L366
+	leaq	(%r14,%r12), %rdx
+	cmpq	%rdx, %rcx
+	jnb	.L366
+	subq	%r14, %rcx
+	movq	%rcx, 8(%rsp)
+	cmpq	%rax, %rbp
+	jnb	.L371
+	leaq	10(%rbp,%rbp), %rdx
+	movq	96(%rsp), %r15
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r15, %rdi
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L372
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	movq	104(%rsp), %rsi
+	movq	%r15, %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	call	*24(%rax)
+.L373:
+	movq	16(%rsp), %rax
+	movq	%rax, 104(%rsp)
+	movq	24(%rsp), %rax
+	movq	%rax, 88(%rsp)
+	movq	%rax, %rbp
+.L371:
+	cmpq	$23, %rbp
+	je	.L496
+	movq	8(%rsp), %rax
+	movq	104(%rsp), %r14
+	addq	%r14, %rax
+	movq	%rax, 8(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L375:
+	movq	8(%rsp), %rsi
+	movq	%rbx, %rdx
+	leaq	(%r14,%r12), %rdi
+	call	memmove@PLT
+	addq	80(%rsp), %rbx
+	movzwl	.LC18(%rip), %eax
+	movq	%rbx, 80(%rsp)
+	movb	$0, (%r14,%rbx)
+	movw	%ax, 48(%rsp)
+	movl	$2, %eax
+	.p2align 4,,10
+	.p2align 3
+.L377:
+	movq	(%rsp), %rcx
+	movq	80(%rsp), %rbx
+	leaq	-1(%rax), %r12
+	movq	88(%rsp), %rbp
+	movzbl	-1(%rcx,%rax), %r14d
+	cmpq	%rbp, %rbx
+	je	.L497
+.L378:
+	cmpq	$23, %rbp
+	je	.L381
+	movq	104(%rsp), %rdx
+	movb	%r14b, (%rdx,%rbx)
+	movq	80(%rsp), %rax
+	leaq	1(%rax), %rcx
+	movq	%rcx, 80(%rsp)
+	movb	$0, 1(%rdx,%rax)
+	testq	%r12, %r12
+	je	.L383
+.L382:
+	movl	$1, %eax
+	jmp	.L377
+	.p2align 4,,10
+	.p2align 3
+.L381:
+	movb	%r14b, 104(%rsp,%rbx)
+	movq	80(%rsp), %rax
+	addq	$1, %rax
+	movq	%rax, 80(%rsp)
+	movb	$0, 104(%rsp,%rax)
+	testq	%r12, %r12
+	jne	.L382
+.L383:
+	movq	88(%rsp), %rbx
+	leaq	104(%rsp), %r12
+	cmpq	$23, %rbx
+	je	.L385
+	movq	104(%rsp), %r12
+.L385:
+	movq	$-1, %rsi
+	movq	%r13, %rdi
+	call	strnlen@PLT
+	movq	80(%rsp), %rcx
+	movq	%rax, %rbp
+	movq	%rcx, (%rsp)
+	leaq	(%rcx,%rax), %rax
+	cmpq	%r12, %r13
+	jb	.L386
+	leaq	(%r12,%rcx), %rdx
+	cmpq	%rdx, %r13
+	jnb	.L386
+	subq	%r12, %r13
+	movq	%r13, 8(%rsp)
+	cmpq	%rax, %rbx
+	jnb	.L391
+	movq	96(%rsp), %r15
+	leaq	10(%rbx,%rbx), %r13
+	movl	$1, %edx
+	cmpq	%rax, %r13
+	cmovb	%rax, %r13
+	movq	(%r15), %rax
+	movq	%r15, %rdi
+	leaq	1(%r13), %rsi
+	call	*16(%rax)
+	movq	%rax, %r14
+	movq	(%rsp), %rax
+	movq	%r12, %rsi
+	movq	%r14, %rdi
+	leaq	1(%rax), %rdx
+	cmpq	$23, %rbx
+	je	.L392
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	movq	104(%rsp), %rsi
+	movq	%r15, %rdi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	call	*24(%rax)
+.LEHE21:
+.L393:
+	movq	%r14, 104(%rsp)
+	movq	%r13, %rbx
+	movq	%r13, 88(%rsp)
+.L391:
+	cmpq	$23, %rbx
+	je	.L498
+	movq	104(%rsp), %r14
+	movq	8(%rsp), %r13
+	addq	%r14, %r13
+.L396:
+	movq	%r14, %r12
+.L395:
+	movq	(%rsp), %rdi
+	movq	%rbp, %rdx
+	movq	%r13, %rsi
+	addq	%r12, %rdi
+	call	memmove@PLT
+	addq	80(%rsp), %rbp
+	leaq	104(%rsp), %rax
+	movq	%rbp, 80(%rsp)
+	movb	$0, (%r12,%rbp)
+	movq	88(%rsp), %rdx
+	movq	80(%rsp), %rcx
+	cmpq	$23, %rdx
+	je	.L397
+	movq	104(%rsp), %rax
+.L397:
+	cmpq	$49, %rcx
+	jne	.L398
+	movabsq	$7307182897804112495, %rcx
+	xorq	8(%rax), %rcx
+	movabsq	$8583909746840200520, %rsi
+	xorq	(%rax), %rsi
+	orq	%rsi, %rcx
+	jne	.L398
+	movabsq	$7525315081842750313, %rcx
+	xorq	24(%rax), %rcx
+	movabsq	$2338042720270836000, %rsi
+	xorq	16(%rax), %rsi
+	orq	%rsi, %rcx
+	jne	.L398
+	movabsq	$7813499558723413369, %rcx
+	xorq	40(%rax), %rcx
+	movabsq	$2319410022564044910, %rsi
+	xorq	32(%rax), %rsi
+	orq	%rsi, %rcx
+	jne	.L398
+	cmpb	$100, 48(%rax)
+	jne	.L398
+	cmpq	$23, %rdx
+	je	.L237
+	movq	96(%rsp), %rdi
+	movq	104(%rsp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L237:
+	addq	$136, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L497:
+	.cfi_restore_state
+	leaq	1(%rbx), %r15
+	cmpq	%r15, %rbx
+	jnb	.L378
+	leaq	10(%rbx,%rbx), %rax
+	movq	96(%rsp), %rdi
+	movl	$1, %edx
+	cmpq	%r15, %rax
+	cmovb	%r15, %rax
+	movq	%rdi, 24(%rsp)
+	movq	%rax, 16(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%rdi), %rax
+.LEHB22:
+	call	*16(%rax)
+	movq	%rax, 8(%rsp)
+	cmpq	$23, %rbp
+	je	.L379
+	movq	104(%rsp), %rsi
+	movq	%r15, %rdx
+	movq	%rax, %rdi
+	movq	%rsi, 32(%rsp)
+	call	memcpy@PLT
+	movq	24(%rsp), %rdi
+	movq	32(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L380:
+	movq	8(%rsp), %rax
+	movq	%rax, 104(%rsp)
+	movq	16(%rsp), %rax
+	movq	%rax, 88(%rsp)
+	movq	%rax, %rbp
+	jmp	.L378
+	.p2align 4,,10
+	.p2align 3
+.L386:
+	cmpq	%rax, %rbx
+	jnb	.L388
+	leaq	10(%rbx,%rbx), %rdx
+	movq	96(%rsp), %r15
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r15, %rdi
+	movl	$1, %edx
+	movq	%rax, %r14
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	(%rsp), %rcx
+	movq	%rax, 8(%rsp)
+	leaq	1(%rcx), %rdx
+	cmpq	$23, %rbx
+	je	.L389
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	movq	104(%rsp), %rsi
+	movq	%r15, %rdi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	call	*24(%rax)
+.L390:
+	movq	8(%rsp), %rax
+	movq	%r14, 88(%rsp)
+	movq	%r14, %rbx
+	movq	%rax, 104(%rsp)
+.L388:
+	leaq	104(%rsp), %r12
+	cmpq	$23, %rbx
+	je	.L395
+	movq	104(%rsp), %r14
+	jmp	.L396
+	.p2align 4,,10
+	.p2align 3
+.L366:
+	cmpq	%rax, %rbp
+	jnb	.L368
+	leaq	10(%rbp,%rbp), %rdx
+	movq	96(%rsp), %r15
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r15, %rdi
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L369
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	movq	104(%rsp), %rsi
+	movq	%r15, %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	call	*24(%rax)
+.L370:
+	movq	16(%rsp), %rax
+	movq	%rax, 104(%rsp)
+	movq	24(%rsp), %rax
+	movq	%rax, 88(%rsp)
+	movq	%rax, %rbp
+.L368:
+	leaq	104(%rsp), %r14
+	cmpq	$23, %rbp
+	je	.L375
+	movq	104(%rsp), %r14
+	jmp	.L375
+	.p2align 4,,10
+	.p2align 3
+.L334:
+	cmpq	%r12, %rbp
+	jnb	.L336
+	leaq	10(%rbp,%rbp), %rax
+	movq	96(%rsp), %r14
+	movl	$1, %edx
+	cmpq	%r12, %rax
+	cmovb	%r12, %rax
+	movq	%r14, %rdi
+	movq	%rax, 16(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r14), %rax
+	call	*16(%rax)
+	movq	%rax, %r15
+	cmpq	$23, %rbp
+	je	.L337
+	movdqu	0(%r13), %xmm1
+	movq	104(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movq	%r14, %rdi
+	movl	$1, %ecx
+	movups	%xmm1, (%rax)
+	movdqu	14(%r13), %xmm2
+	movups	%xmm2, 14(%rax)
+	movq	(%r14), %rax
+	call	*24(%rax)
+.L338:
+	movq	16(%rsp), %rax
+	movq	%r15, 104(%rsp)
+	movq	%rax, 88(%rsp)
+	movq	%rax, %rbp
+.L336:
+	leaq	.LC11(%rip), %rsi
+	leaq	104(%rsp), %r14
+	cmpq	$23, %rbp
+	je	.L343
+	movq	104(%rsp), %r14
+	jmp	.L343
+	.p2align 4,,10
+	.p2align 3
+.L314:
+	cmpq	%r15, %rbx
+	jnb	.L316
+	leaq	10(%rbx,%rbx), %rax
+	movq	96(%rsp), %r14
+	movl	$1, %edx
+	cmpq	%r15, %rax
+	cmovnb	%rax, %r15
+	movq	(%r14), %rax
+	movq	%r14, %rdi
+	leaq	1(%r15), %rsi
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	leaq	1(%r13), %rdx
+	cmpq	$23, %rbx
+	je	.L317
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r14), %rax
+	movq	104(%rsp), %rsi
+	movq	%r14, %rdi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	call	*24(%rax)
+.L318:
+	movq	16(%rsp), %rax
+	movq	%r15, 88(%rsp)
+	movq	%r15, %rbx
+	movq	%rax, 104(%rsp)
+.L316:
+	leaq	104(%rsp), %r14
+	cmpq	$23, %rbx
+	je	.L323
+	movq	104(%rsp), %r14
+	jmp	.L323
+	.p2align 4,,10
+	.p2align 3
+.L294:
+	cmpq	%r12, %rbp
+	jnb	.L296
+	leaq	10(%rbp,%rbp), %rax
+	movq	96(%rsp), %r14
+	movl	$1, %edx
+	cmpq	%r12, %rax
+	cmovb	%r12, %rax
+	movq	%r14, %rdi
+	movq	%rax, (%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r14), %rax
+	call	*16(%rax)
+	movq	%rax, %r15
+	movq	0(%r13), %rax
+	movq	%rax, (%r15)
+	movq	6(%r13), %rax
+	movq	%rax, 6(%r15)
+	cmpq	$23, %rbp
+	je	.L298
+	movq	(%r14), %rax
+	movq	104(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movq	%r14, %rdi
+	movl	$1, %ecx
+	call	*24(%rax)
+.LEHE22:
+.L298:
+	movq	(%rsp), %rax
+	movq	%r15, 104(%rsp)
+	movq	%rax, 88(%rsp)
+	movq	%rax, %rbp
+.L296:
+	leaq	.LC10(%rip), %rsi
+	leaq	104(%rsp), %r14
+	cmpq	$23, %rbp
+	je	.L303
+	movq	104(%rsp), %r14
+	jmp	.L303
+	.p2align 4,,10
+	.p2align 3
+.L494:
+	movq	24(%rsp), %r13
+	leaq	104(%rsp), %rdi
+	addq	%rdi, %r13
+	jmp	.L358
+	.p2align 4,,10
+	.p2align 3
+.L355:
+	movq	%rax, %rdi
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L356
+	.p2align 4,,10
+	.p2align 3
+.L291:
+	leaq	(%r14,%rbx), %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L290
+	.p2align 4,,10
+	.p2align 3
+.L362:
+	movq	8(%rsp), %rax
+	leaq	(%rax,%rbx), %r13
+	jmp	.L347
+	.p2align 4,,10
+	.p2align 3
+.L331:
+	leaq	(%r14,%rbx), %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L330
+	.p2align 4,,10
+	.p2align 3
+.L307:
+	leaq	104(%rsp), %rdi
+	movq	%r14, %rdx
+	movq	%rdi, %rsi
+	movq	16(%rsp), %rdi
+	call	memcpy@PLT
+	jmp	.L308
+	.p2align 4,,10
+	.p2align 3
+.L379:
+	movq	%rax, %rdi
+	leaq	104(%rsp), %rsi
+	movq	%r15, %rdx
+	call	memcpy@PLT
+	jmp	.L380
+	.p2align 4,,10
+	.p2align 3
+.L337:
+	movdqu	0(%r13), %xmm3
+	movups	%xmm3, (%rax)
+	movdqu	14(%r13), %xmm4
+	movups	%xmm4, 14(%rax)
+	jmp	.L338
+	.p2align 4,,10
+	.p2align 3
+.L389:
+	movq	%rax, %rdi
+	movq	%r12, %rsi
+	call	memcpy@PLT
+	jmp	.L390
+	.p2align 4,,10
+	.p2align 3
+.L317:
+	movq	%rax, %rdi
+	movq	%r12, %rsi
+	call	memcpy@PLT
+	jmp	.L318
+	.p2align 4,,10
+	.p2align 3
+.L369:
+	movq	%rax, %rdi
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L370
+.L492:
+	movq	8(%rsp), %rax
+	leaq	104(%rsp), %rcx
+	movq	%rcx, %r14
+	addq	%rcx, %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L323
+.L498:
+	movq	8(%rsp), %r13
+	leaq	104(%rsp), %rcx
+	movq	%rcx, %r12
+	addq	%rcx, %r13
+	jmp	.L395
+.L488:
+	movq	(%rsp), %rsi
+	leaq	104(%rsp), %rcx
+	movq	%rcx, %r14
+	addq	%rcx, %rsi
+	jmp	.L303
+.L493:
+	movq	16(%rsp), %rsi
+	leaq	104(%rsp), %rcx
+	movq	%rcx, %r14
+	addq	%rcx, %rsi
+	jmp	.L343
+.L496:
+	movq	8(%rsp), %rax
+	leaq	104(%rsp), %rcx
+	movq	%rcx, %r14
+	addq	%rcx, %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L375
+.L320:
+	movq	%rax, %rdi
+	movq	%r12, %rsi
+	call	memcpy@PLT
+	jmp	.L321
+.L340:
+	movdqu	0(%r13), %xmm7
+	movups	%xmm7, (%rax)
+	movdqu	14(%r13), %xmm7
+	movups	%xmm7, 14(%rax)
+	jmp	.L341
+.L392:
+	call	memcpy@PLT
+	jmp	.L393
+.L372:
+	movq	%rax, %rdi
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L373
+.L469:
+	jmp	.L470
+	.section	.gcc_except_table
+.LLSDA6778:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6778-.LLSDACSB6778
+.LLSDACSB6778:
+	.uleb128 .LEHB21-.LFB6778
+	.uleb128 .LEHE21-.LEHB21
+	.uleb128 .L469-.LFB6778
+	.uleb128 0
+	.uleb128 .LEHB22-.LFB6778
+	.uleb128 .LEHE22-.LEHB22
+	.uleb128 .L469-.LFB6778
+	.uleb128 0
+.LLSDACSE6778:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6778
+	.type	_Z21test_format_to_stringv.cold, @function
+_Z21test_format_to_stringv.cold:
+.LFSB6778:
+.L326:
+	.cfi_def_cfa_offset 192
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC17(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB23:
+	call	__cxa_throw@PLT
+.LEHE23:
+.L429:
+.L470:
+	movq	%rax, %rbx
+	movq	88(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L404
+	movq	96(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	104(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L404:
+	movq	%rbx, %rdi
+.LEHB24:
+	call	_Unwind_Resume@PLT
+.LEHE24:
+.L398:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC20(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB25:
+	call	__cxa_throw@PLT
+.L286:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC14(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE25:
+	.cfi_endproc
+.LFE6778:
+	.section	.gcc_except_table
+.LLSDAC6778:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6778-.LLSDACSBC6778
+.LLSDACSBC6778:
+	.uleb128 .LEHB23-.LCOLDB21
+	.uleb128 .LEHE23-.LEHB23
+	.uleb128 .L429-.LCOLDB21
+	.uleb128 0
+	.uleb128 .LEHB24-.LCOLDB21
+	.uleb128 .LEHE24-.LEHB24
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB25-.LCOLDB21
+	.uleb128 .LEHE25-.LEHB25
+	.uleb128 .L429-.LCOLDB21
+	.uleb128 0
+.LLSDACSEC6778:
+	.section	.text.unlikely
+	.text
+	.size	_Z21test_format_to_stringv, .-_Z21test_format_to_stringv
+	.section	.text.unlikely
+	.size	_Z21test_format_to_stringv.cold, .-_Z21test_format_to_stringv.cold
+.LCOLDE21:
+	.text
+.LHOTE21:
+	.section	.rodata.str1.8
+	.align 8
+.LC22:
+	.string	"expected equal : expected value : result, actual value : \"42\""
+	.align 8
+.LC23:
+	.string	"expected equal : expected value : result, actual value : \"0\""
+	.section	.rodata.str1.1
+.LC25:
+	.string	"123456789"
+	.section	.rodata.str1.8
+	.align 8
+.LC26:
+	.string	"expected equal : expected value : result, actual value : \"123456789\""
+	.section	.text.unlikely
+.LCOLDB27:
+	.text
+.LHOTB27:
+	.p2align 4
+	.globl	_Z29test_format_unsigned_integralv
+	.type	_Z29test_format_unsigned_integralv, @function
+_Z29test_format_unsigned_integralv:
+.LFB6780:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6780
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%r15d, %r15d
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movl	$23, %r13d
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$184, %rsp
+	.cfi_def_cfa_offset 240
+	movdqa	.LC3(%rip), %xmm1
+	movaps	%xmm1, 80(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r14
+	testq	%r14, %r14
+	je	.L747
+.L500:
+	leaq	.LC0(%rip), %rbx
+	pxor	%xmm0, %xmm0
+	movl	$36, %esi
+	movq	%r14, 96(%rsp)
+	movq	%rbx, %rdi
+	movups	%xmm0, 104(%rsp)
+	movq	$0, 120(%rsp)
+	call	strchrnul@PLT
+	movq	%rax, %rbp
+	movq	%rax, 8(%rsp)
+	movzbl	(%rax), %eax
+	subq	%rbx, %rbp
+	testb	%al, %al
+	jne	.L504
+	jmp	.L505
+	.p2align 4,,10
+	.p2align 3
+.L507:
+	addq	$1, %rbp
+	movzbl	(%rbx,%rbp), %eax
+	testb	%al, %al
+	je	.L506
+.L504:
+	cmpb	$36, %al
+	jne	.L507
+	leaq	1(%rbx,%rbp), %rax
+	movq	%rax, 8(%rsp)
+.L505:
+	movq	$0, 16(%rsp)
+	leaq	0(%rbp,%r15), %rax
+	cmpq	$23, %r13
+	je	.L748
+.L509:
+	movq	16(%rsp), %rcx
+	leaq	(%rcx,%r15), %rdx
+	cmpq	%rdx, %rbx
+	jb	.L511
+	cmpq	%rax, %r13
+	jnb	.L651
+.L648:
+	leaq	10(%r13,%r13), %rdx
+	movq	%r14, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r14), %rax
+.LEHB26:
+	call	*16(%rax)
+	movq	16(%rsp), %rsi
+	leaq	1(%r15), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %r12
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L513
+	movq	(%r14), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L513:
+	movq	24(%rsp), %rax
+	movq	%r12, 104(%rsp)
+	movq	%rax, 88(%rsp)
+.L512:
+	cmpq	$23, 24(%rsp)
+	leaq	.LC0(%rip), %rsi
+	je	.L749
+.L517:
+	leaq	(%r12,%r15), %rdi
+	movq	%rbp, %rdx
+	leaq	128(%rsp), %r15
+	call	memmove@PLT
+	addq	80(%rsp), %rbp
+	movzwl	.LC15(%rip), %eax
+	movq	%rbp, 80(%rsp)
+	movb	$0, (%r12,%rbp)
+	movw	%ax, 128(%rsp)
+	movl	$2, %eax
+	.p2align 4,,10
+	.p2align 3
+.L519:
+	movq	80(%rsp), %rbp
+	movq	88(%rsp), %r12
+	leaq	-1(%rax), %r13
+	movzbl	-1(%r15,%rax), %r14d
+	cmpq	%r12, %rbp
+	je	.L750
+.L520:
+	cmpq	$23, %r12
+	je	.L523
+	movq	104(%rsp), %rdx
+	movb	%r14b, (%rdx,%rbp)
+	movq	80(%rsp), %rax
+	leaq	1(%rax), %rcx
+	movq	%rcx, 80(%rsp)
+	movb	$0, 1(%rdx,%rax)
+	testq	%r13, %r13
+	je	.L525
+.L524:
+	movl	$1, %eax
+	jmp	.L519
+	.p2align 4,,10
+	.p2align 3
+.L511:
+	movq	%rcx, %rsi
+	movq	%rbx, %rcx
+	subq	%rsi, %rcx
+	movq	%rcx, 24(%rsp)
+	cmpq	%rax, %r13
+	jnb	.L652
+	leaq	10(%r13,%r13), %rdx
+	movq	%r14, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 32(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r14), %rax
+	call	*16(%rax)
+	movq	16(%rsp), %rsi
+	leaq	1(%r15), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %r12
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L515
+	movq	(%r14), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L515:
+	movq	32(%rsp), %rax
+	movq	%r12, 104(%rsp)
+	movq	%rax, 88(%rsp)
+	movq	%rax, %r13
+.L514:
+	cmpq	$23, %r13
+	jne	.L743
+	leaq	104(%rsp), %r12
+.L743:
+	movq	24(%rsp), %rsi
+	addq	%r12, %rsi
+	jmp	.L517
+	.p2align 4,,10
+	.p2align 3
+.L523:
+	movb	%r14b, 104(%rsp,%rbp)
+	movq	80(%rsp), %rax
+	addq	$1, %rax
+	movq	%rax, 80(%rsp)
+	movb	$0, 104(%rsp,%rax)
+	testq	%r13, %r13
+	jne	.L524
+.L525:
+	movq	88(%rsp), %rbp
+	leaq	104(%rsp), %r13
+	cmpq	$23, %rbp
+	je	.L527
+	movq	104(%rsp), %r13
+.L527:
+	movq	8(%rsp), %r15
+	movq	$-1, %rsi
+	movq	%r15, %rdi
+	call	strnlen@PLT
+	movq	80(%rsp), %r14
+	movq	%r15, %rsi
+	movq	%rax, %r12
+	leaq	(%rax,%r14), %rax
+	cmpq	%r13, %r15
+	jb	.L528
+	leaq	0(%r13,%r14), %rdx
+	cmpq	%rdx, %r15
+	jnb	.L528
+	subq	%r13, %rsi
+	movq	%rsi, 8(%rsp)
+	cmpq	%rax, %rbp
+	jnb	.L533
+	leaq	10(%rbp,%rbp), %rdx
+	movq	96(%rsp), %r15
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r15, %rdi
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	leaq	1(%r14), %rdx
+	cmpq	$23, %rbp
+	je	.L534
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	movq	104(%rsp), %rsi
+	movq	%r15, %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	call	*24(%rax)
+.L535:
+	movq	16(%rsp), %rax
+	movq	%rax, 104(%rsp)
+	movq	24(%rsp), %rax
+	movq	%rax, 88(%rsp)
+	movq	%rax, %rbp
+.L533:
+	cmpq	$23, %rbp
+	je	.L751
+	movq	8(%rsp), %rax
+	movq	104(%rsp), %r13
+	addq	%r13, %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L537
+	.p2align 4,,10
+	.p2align 3
+.L750:
+	leaq	1(%rbp), %rcx
+	cmpq	%rcx, %rbp
+	jnb	.L520
+	leaq	10(%rbp,%rbp), %rax
+	movq	96(%rsp), %rdi
+	movq	%rcx, 24(%rsp)
+	movl	$1, %edx
+	cmpq	%rcx, %rax
+	cmovb	%rcx, %rax
+	movq	%rdi, 40(%rsp)
+	movq	%rax, 32(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	cmpq	$23, %r12
+	je	.L521
+	movq	104(%rsp), %rsi
+	movq	24(%rsp), %rdx
+	movq	%rax, %rdi
+	movq	%rsi, 24(%rsp)
+	call	memcpy@PLT
+	movq	40(%rsp), %rdi
+	movq	24(%rsp), %rsi
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L522:
+	movq	16(%rsp), %rax
+	movq	%rax, 104(%rsp)
+	movq	32(%rsp), %rax
+	movq	%rax, 88(%rsp)
+	movq	%rax, %r12
+	jmp	.L520
+	.p2align 4,,10
+	.p2align 3
+.L528:
+	cmpq	%rax, %rbp
+	jnb	.L530
+	leaq	10(%rbp,%rbp), %rdx
+	movq	96(%rsp), %r15
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r15, %rdi
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	leaq	1(%r14), %rdx
+	cmpq	$23, %rbp
+	je	.L531
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	movq	104(%rsp), %rsi
+	movq	%r15, %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	call	*24(%rax)
+.LEHE26:
+.L532:
+	movq	16(%rsp), %rax
+	movq	%rax, 104(%rsp)
+	movq	24(%rsp), %rax
+	movq	%rax, 88(%rsp)
+	movq	%rax, %rbp
+.L530:
+	leaq	104(%rsp), %r13
+	cmpq	$23, %rbp
+	je	.L537
+	movq	104(%rsp), %r13
+.L537:
+	movq	8(%rsp), %rsi
+	movq	%r12, %rdx
+	leaq	0(%r13,%r14), %rdi
+	call	memmove@PLT
+	addq	80(%rsp), %r12
+	leaq	104(%rsp), %rdx
+	movq	%r12, 80(%rsp)
+	movb	$0, 0(%r13,%r12)
+	movq	88(%rsp), %rcx
+	movq	80(%rsp), %rax
+	movq	%rcx, 16(%rsp)
+	cmpq	$23, %rcx
+	je	.L539
+	movq	104(%rsp), %rdx
+.L539:
+	cmpq	$2, %rax
+	jne	.L543
+	cmpw	$12852, (%rdx)
+	jne	.L543
+	movdqa	.LC3(%rip), %xmm2
+	movaps	%xmm2, 128(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r15
+	testq	%r15, %r15
+	je	.L544
+	movq	$0, 8(%rsp)
+	movl	$23, %r14d
+.L545:
+	pxor	%xmm0, %xmm0
+	movl	$36, %esi
+	movq	%rbx, %rdi
+	movq	%r15, 144(%rsp)
+	movq	$0, 168(%rsp)
+	movups	%xmm0, 152(%rsp)
+	call	strchrnul@PLT
+	movq	%rax, %rbp
+	movq	%rax, %r13
+	movzbl	(%rax), %eax
+	subq	%rbx, %rbp
+	testb	%al, %al
+	jne	.L549
+	jmp	.L550
+	.p2align 4,,10
+	.p2align 3
+.L552:
+	addq	$1, %rbp
+	movzbl	(%rbx,%rbp), %eax
+	testb	%al, %al
+	je	.L551
+.L549:
+	cmpb	$36, %al
+	jne	.L552
+	leaq	1(%rbx,%rbp), %r13
+.L550:
+	movq	$0, 24(%rsp)
+	movq	8(%rsp), %rax
+	addq	%rbp, %rax
+	cmpq	$23, %r14
+	je	.L752
+.L554:
+	movq	24(%rsp), %rcx
+	movq	8(%rsp), %rsi
+	leaq	(%rcx,%rsi), %rdx
+	cmpq	%rdx, %rbx
+	jnb	.L753
+	movq	%rcx, %rsi
+	movq	%rbx, %rcx
+	subq	%rsi, %rcx
+	movq	%rcx, 32(%rsp)
+	cmpq	%rax, %r14
+	jnb	.L659
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 40(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+.LEHB27:
+	call	*16(%rax)
+	movq	%rax, %r12
+	movq	8(%rsp), %rax
+	movq	24(%rsp), %rsi
+	movq	%r12, %rdi
+	leaq	1(%rax), %rdx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L560
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L560:
+	movq	40(%rsp), %rax
+	movq	%r12, 152(%rsp)
+	movq	%rax, 136(%rsp)
+	movq	%rax, %r14
+.L559:
+	cmpq	$23, %r14
+	je	.L561
+	movq	32(%rsp), %rax
+	addq	%r12, %rax
+	jmp	.L562
+	.p2align 4,,10
+	.p2align 3
+.L753:
+	cmpq	%rax, %r14
+	jnb	.L658
+.L647:
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 32(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	%rax, %r12
+	movq	8(%rsp), %rax
+	movq	24(%rsp), %rsi
+	movq	%r12, %rdi
+	leaq	1(%rax), %rdx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L558
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L558:
+	movq	32(%rsp), %rax
+	movq	%r12, 152(%rsp)
+	movq	%rax, 136(%rsp)
+.L557:
+	cmpq	$23, 32(%rsp)
+	leaq	.LC0(%rip), %rax
+	leaq	152(%rsp), %rsi
+	je	.L744
+.L562:
+	movq	8(%rsp), %rdi
+	movq	%rbp, %rdx
+	movq	%rax, %rsi
+	addq	%r12, %rdi
+	call	memmove@PLT
+	addq	128(%rsp), %rbp
+	movq	%rbp, 128(%rsp)
+	movb	$0, (%r12,%rbp)
+	movq	128(%rsp), %rbp
+	movq	136(%rsp), %r12
+	cmpq	%r12, %rbp
+	je	.L754
+.L564:
+	leaq	152(%rsp), %rax
+	cmpq	$23, %r12
+	je	.L567
+	movq	152(%rsp), %rax
+.L567:
+	movb	$48, (%rax,%rbp)
+	movq	128(%rsp), %rdx
+	leaq	152(%rsp), %r12
+	leaq	1(%rdx), %rcx
+	movq	%rcx, 128(%rsp)
+	movb	$0, 1(%rax,%rdx)
+	movq	136(%rsp), %rbp
+	cmpq	$23, %rbp
+	je	.L568
+	movq	152(%rsp), %r12
+	.p2align 4,,10
+	.p2align 3
+.L568:
+	movq	$-1, %rsi
+	movq	%r13, %rdi
+	call	strnlen@PLT
+	movq	128(%rsp), %r15
+	movq	%rax, %r14
+	leaq	(%rax,%r15), %rax
+	cmpq	%r12, %r13
+	jb	.L569
+	leaq	(%r12,%r15), %rdx
+	cmpq	%rdx, %r13
+	jnb	.L569
+	subq	%r12, %r13
+	movq	%r13, 8(%rsp)
+	cmpq	%rax, %rbp
+	jnb	.L574
+	leaq	10(%rbp,%rbp), %rdx
+	movq	144(%rsp), %r13
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r13, %rdi
+	movl	$1, %edx
+	movq	%rax, 32(%rsp)
+	leaq	1(%rax), %rsi
+	movq	0(%r13), %rax
+	call	*16(%rax)
+	movq	%rax, 24(%rsp)
+	leaq	1(%r15), %rdx
+	cmpq	$23, %rbp
+	je	.L575
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	0(%r13), %rax
+	leaq	1(%rbp), %rdx
+	movq	%r13, %rdi
+	movq	152(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.L576:
+	movq	24(%rsp), %rax
+	movq	%rax, 152(%rsp)
+	movq	32(%rsp), %rax
+	movq	%rax, 136(%rsp)
+	movq	%rax, %rbp
+.L574:
+	cmpq	$23, %rbp
+	je	.L755
+	movq	152(%rsp), %r12
+	movq	8(%rsp), %r13
+	addq	%r12, %r13
+	jmp	.L578
+	.p2align 4,,10
+	.p2align 3
+.L754:
+	leaq	1(%rbp), %r14
+	cmpq	%r14, %rbp
+	jnb	.L564
+	leaq	10(%rbp,%rbp), %rax
+	movq	144(%rsp), %r15
+	movl	$1, %edx
+	cmpq	%r14, %rax
+	cmovb	%r14, %rax
+	movq	%r15, %rdi
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	%rax, 8(%rsp)
+	cmpq	$23, %r12
+	je	.L565
+	movq	152(%rsp), %rsi
+	movq	%r14, %rdx
+	movq	%rax, %rdi
+	movq	%rsi, 32(%rsp)
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	movq	32(%rsp), %rsi
+	movq	%r15, %rdi
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	call	*24(%rax)
+.L566:
+	movq	8(%rsp), %rax
+	movq	%rax, 152(%rsp)
+	movq	24(%rsp), %rax
+	movq	%rax, 136(%rsp)
+	movq	%rax, %r12
+	jmp	.L564
+	.p2align 4,,10
+	.p2align 3
+.L569:
+	cmpq	%rax, %rbp
+	jnb	.L571
+	leaq	10(%rbp,%rbp), %rdx
+	movq	144(%rsp), %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%rdi, 32(%rsp)
+	movl	$1, %edx
+	movq	%rax, %rsi
+	movq	%rax, 24(%rsp)
+	movq	(%rdi), %rax
+	addq	$1, %rsi
+	call	*16(%rax)
+	movq	%rax, 8(%rsp)
+	leaq	1(%r15), %rdx
+	cmpq	$23, %rbp
+	je	.L572
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	32(%rsp), %rdi
+	leaq	1(%rbp), %rdx
+	movq	152(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE27:
+.L573:
+	movq	8(%rsp), %rax
+	movq	%rax, 152(%rsp)
+	movq	24(%rsp), %rax
+	movq	%rax, 136(%rsp)
+	movq	%rax, %rbp
+.L571:
+	leaq	152(%rsp), %r12
+	cmpq	$23, %rbp
+	je	.L578
+	movq	152(%rsp), %r12
+.L578:
+	movq	%r14, %rdx
+	leaq	(%r12,%r15), %rdi
+	movq	%r13, %rsi
+	call	memmove@PLT
+	addq	128(%rsp), %r14
+	cmpq	$23, 16(%rsp)
+	movq	%r14, 128(%rsp)
+	movb	$0, (%r12,%r14)
+	je	.L586
+	movq	96(%rsp), %rdi
+	movq	16(%rsp), %rdx
+	movl	$1, %ecx
+	movq	104(%rsp), %rsi
+	movq	(%rdi), %rax
+	addq	$1, %rdx
+.LEHB28:
+	call	*24(%rax)
+.LEHE28:
+.L586:
+	movq	144(%rsp), %rdx
+	movq	128(%rsp), %rax
+	movq	136(%rsp), %xmm3
+	movdqa	128(%rsp), %xmm4
+	movq	%rdx, 96(%rsp)
+	movq	%xmm3, 8(%rsp)
+	cmpq	$23, 8(%rsp)
+	movaps	%xmm4, 80(%rsp)
+	je	.L756
+	movq	152(%rsp), %rdx
+	movq	%rdx, 104(%rsp)
+.L587:
+	cmpq	$1, %rax
+	jne	.L588
+	cmpb	$48, (%rdx)
+	jne	.L588
+	movdqa	.LC3(%rip), %xmm5
+	movaps	%xmm5, 128(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r12
+	testq	%r12, %r12
+	je	.L589
+	movl	$23, %r15d
+	xorl	%r13d, %r13d
+.L590:
+	pxor	%xmm0, %xmm0
+	movl	$36, %esi
+	movq	%rbx, %rdi
+	movq	%r12, 144(%rsp)
+	movq	$0, 168(%rsp)
+	movups	%xmm0, 152(%rsp)
+	call	strchrnul@PLT
+	movq	%rax, %rbp
+	movq	%rax, %r14
+	movzbl	(%rax), %eax
+	subq	%rbx, %rbp
+	testb	%al, %al
+	jne	.L594
+	jmp	.L595
+	.p2align 4,,10
+	.p2align 3
+.L597:
+	addq	$1, %rbp
+	movzbl	(%rbx,%rbp), %eax
+	testb	%al, %al
+	je	.L596
+.L594:
+	cmpb	$36, %al
+	jne	.L597
+	leaq	1(%rbx,%rbp), %r14
+.L595:
+	movq	$0, 16(%rsp)
+	leaq	0(%r13,%rbp), %rax
+	cmpq	$23, %r15
+	je	.L757
+.L599:
+	movq	16(%rsp), %rcx
+	leaq	(%rcx,%r13), %rdx
+	cmpq	%rdx, %rbx
+	jnb	.L758
+	subq	%rcx, %rbx
+	movq	%rbx, 24(%rsp)
+	cmpq	%rax, %r15
+	jnb	.L666
+	leaq	10(%r15,%r15), %rdx
+	movq	%r12, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 32(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r12), %rax
+.LEHB29:
+	call	*16(%rax)
+	movq	16(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r15
+	je	.L605
+	movq	(%r12), %rax
+	leaq	1(%r15), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r12, %rdi
+	call	*24(%rax)
+.L605:
+	movq	32(%rsp), %rax
+	movq	%rbx, 152(%rsp)
+	movq	%rax, 136(%rsp)
+	movq	%rax, %r15
+.L604:
+	cmpq	$23, %r15
+	je	.L606
+	movq	24(%rsp), %rax
+	addq	%rbx, %rax
+	jmp	.L607
+	.p2align 4,,10
+	.p2align 3
+.L758:
+	cmpq	%rax, %r15
+	jnb	.L665
+.L646:
+	leaq	10(%r15,%r15), %rdx
+	movq	%r12, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r12), %rax
+	call	*16(%rax)
+	movq	16(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r15
+	je	.L603
+	movq	(%r12), %rax
+	leaq	1(%r15), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r12, %rdi
+	call	*24(%rax)
+.L603:
+	movq	24(%rsp), %rax
+	movq	%rbx, 152(%rsp)
+	movq	%rax, 136(%rsp)
+.L602:
+	cmpq	$23, 24(%rsp)
+	leaq	.LC0(%rip), %rax
+	leaq	152(%rsp), %rsi
+	je	.L745
+.L607:
+	movq	%rbp, %rdx
+	leaq	(%rbx,%r13), %rdi
+	leaq	48(%rsp), %r15
+	movq	%rax, %rsi
+	call	memmove@PLT
+	movb	$49, 56(%rsp)
+	leaq	56(%rsp), %r12
+	movq	.LC24(%rip), %rax
+	addq	128(%rsp), %rbp
+	movq	%rbp, 128(%rsp)
+	movq	%rax, 48(%rsp)
+	movb	$0, (%rbx,%rbp)
+	.p2align 4,,10
+	.p2align 3
+.L609:
+	movq	128(%rsp), %rbx
+	movq	136(%rsp), %rbp
+	movzbl	(%r12), %r13d
+	cmpq	%rbp, %rbx
+	je	.L759
+.L610:
+	cmpq	$23, %rbp
+	je	.L613
+	movq	152(%rsp), %rdx
+	movb	%r13b, (%rdx,%rbx)
+	movq	128(%rsp), %rax
+	leaq	1(%rax), %rcx
+	movq	%rcx, 128(%rsp)
+	movb	$0, 1(%rdx,%rax)
+	cmpq	%r12, %r15
+	je	.L614
+.L746:
+	subq	$1, %r12
+	jmp	.L609
+	.p2align 4,,10
+	.p2align 3
+.L613:
+	movb	%r13b, 152(%rsp,%rbx)
+	movq	128(%rsp), %rax
+	addq	$1, %rax
+	movq	%rax, 128(%rsp)
+	movb	$0, 152(%rsp,%rax)
+	cmpq	%r12, %r15
+	jne	.L746
+.L614:
+	movq	136(%rsp), %rbx
+	leaq	152(%rsp), %r12
+	cmpq	$23, %rbx
+	je	.L617
+	movq	152(%rsp), %r12
+.L617:
+	movq	$-1, %rsi
+	movq	%r14, %rdi
+	call	strnlen@PLT
+	movq	128(%rsp), %r13
+	movq	%rax, %rbp
+	leaq	(%rax,%r13), %rax
+	cmpq	%r12, %r14
+	jb	.L618
+	leaq	(%r12,%r13), %rdx
+	cmpq	%rdx, %r14
+	jnb	.L618
+	subq	%r12, %r14
+	movq	%r14, 16(%rsp)
+	cmpq	%rax, %rbx
+	jnb	.L623
+	leaq	10(%rbx,%rbx), %rdx
+	movq	144(%rsp), %r14
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r14, %rdi
+	movl	$1, %edx
+	movq	%rax, %r15
+	leaq	1(%rax), %rsi
+	movq	(%r14), %rax
+	call	*16(%rax)
+	movq	%rax, 24(%rsp)
+	leaq	1(%r13), %rdx
+	cmpq	$23, %rbx
+	je	.L624
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r14), %rax
+	leaq	1(%rbx), %rdx
+	movq	%r14, %rdi
+	movq	152(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.L625:
+	movq	24(%rsp), %rax
+	movq	%r15, 136(%rsp)
+	movq	%r15, %rbx
+	movq	%rax, 152(%rsp)
+.L623:
+	cmpq	$23, %rbx
+	je	.L760
+	movq	152(%rsp), %r12
+	movq	16(%rsp), %r14
+	addq	%r12, %r14
+	jmp	.L627
+	.p2align 4,,10
+	.p2align 3
+.L759:
+	leaq	1(%rbx), %rdi
+	cmpq	%rdi, %rbx
+	jnb	.L610
+	leaq	10(%rbx,%rbx), %rax
+	movq	%rdi, 24(%rsp)
+	movl	$1, %edx
+	movq	144(%rsp), %rcx
+	cmpq	%rdi, %rax
+	cmovb	%rdi, %rax
+	movq	%rcx, 40(%rsp)
+	movq	%rcx, %rdi
+	movq	%rax, %rsi
+	movq	%rax, 32(%rsp)
+	movq	(%rcx), %rax
+	addq	$1, %rsi
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	cmpq	$23, %rbp
+	je	.L611
+	movq	152(%rsp), %rsi
+	movq	24(%rsp), %rdx
+	movq	%rax, %rdi
+	movq	%rsi, 24(%rsp)
+	call	memcpy@PLT
+	movq	40(%rsp), %rdi
+	movq	24(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L612:
+	movq	16(%rsp), %rax
+	movq	%rax, 152(%rsp)
+	movq	32(%rsp), %rax
+	movq	%rax, 136(%rsp)
+	movq	%rax, %rbp
+	jmp	.L610
+	.p2align 4,,10
+	.p2align 3
+.L618:
+	cmpq	%rax, %rbx
+	jnb	.L620
+	leaq	10(%rbx,%rbx), %rdx
+	movq	144(%rsp), %r15
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r15, %rdi
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	leaq	1(%r13), %rdx
+	cmpq	$23, %rbx
+	je	.L621
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	leaq	1(%rbx), %rdx
+	movq	%r15, %rdi
+	movq	152(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.LEHE29:
+.L622:
+	movq	16(%rsp), %rax
+	movq	%rax, 152(%rsp)
+	movq	24(%rsp), %rax
+	movq	%rax, 136(%rsp)
+	movq	%rax, %rbx
+.L620:
+	leaq	152(%rsp), %r12
+	cmpq	$23, %rbx
+	je	.L627
+	movq	152(%rsp), %r12
+.L627:
+	movq	%rbp, %rdx
+	leaq	(%r12,%r13), %rdi
+	movq	%r14, %rsi
+	call	memmove@PLT
+	addq	128(%rsp), %rbp
+	cmpq	$23, 8(%rsp)
+	movq	%rbp, 128(%rsp)
+	movb	$0, (%r12,%rbp)
+	je	.L634
+	movq	96(%rsp), %rdi
+	movq	8(%rsp), %rdx
+	movl	$1, %ecx
+	movq	104(%rsp), %rsi
+	movq	(%rdi), %rax
+	addq	$1, %rdx
+.LEHB30:
+	call	*24(%rax)
+.LEHE30:
+.L634:
+	movq	144(%rsp), %rdi
+	movq	136(%rsp), %rdx
+	movdqa	128(%rsp), %xmm6
+	movq	128(%rsp), %rcx
+	movq	%rdi, 96(%rsp)
+	movaps	%xmm6, 80(%rsp)
+	cmpq	$23, %rdx
+	je	.L761
+	movq	152(%rsp), %rax
+	movq	%rax, 104(%rsp)
+.L635:
+	cmpq	$9, %rcx
+	jne	.L636
+	movabsq	$4050765991979987505, %rcx
+	cmpq	%rcx, (%rax)
+	jne	.L636
+	cmpb	$57, 8(%rax)
+	jne	.L636
+	cmpq	$23, %rdx
+	je	.L499
+	movq	(%rdi), %rax
+	movq	104(%rsp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	call	*24(%rax)
+.L499:
+	addq	$184, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L596:
+	.cfi_restore_state
+	leaq	(%rbx,%rbp), %r14
+	jmp	.L595
+	.p2align 4,,10
+	.p2align 3
+.L551:
+	leaq	(%rbx,%rbp), %r13
+	jmp	.L550
+	.p2align 4,,10
+	.p2align 3
+.L506:
+	leaq	(%rbx,%rbp), %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L505
+	.p2align 4,,10
+	.p2align 3
+.L521:
+	movq	24(%rsp), %rdx
+	movq	%rax, %rdi
+	leaq	104(%rsp), %rsi
+	call	memcpy@PLT
+	jmp	.L522
+	.p2align 4,,10
+	.p2align 3
+.L611:
+	movq	24(%rsp), %rdx
+	movq	%rax, %rdi
+	leaq	152(%rsp), %rsi
+	call	memcpy@PLT
+	jmp	.L612
+	.p2align 4,,10
+	.p2align 3
+.L565:
+	movq	%rax, %rdi
+	leaq	152(%rsp), %rsi
+	movq	%r14, %rdx
+	call	memcpy@PLT
+	jmp	.L566
+	.p2align 4,,10
+	.p2align 3
+.L752:
+	leaq	152(%rsp), %rsi
+	cmpq	%rsi, %rbx
+	jnb	.L762
+	cmpq	$23, %rax
+	ja	.L763
+	leaq	.LC0(%rip), %rax
+.L744:
+	movq	%rsi, %r12
+	jmp	.L562
+	.p2align 4,,10
+	.p2align 3
+.L748:
+	leaq	104(%rsp), %r12
+	cmpq	%r12, %rbx
+	jnb	.L764
+	cmpq	$23, %rax
+	jbe	.L672
+	movq	%r12, 16(%rsp)
+	jmp	.L648
+	.p2align 4,,10
+	.p2align 3
+.L757:
+	leaq	152(%rsp), %rsi
+	cmpq	%rsi, %rbx
+	jnb	.L765
+	cmpq	$23, %rax
+	ja	.L766
+	leaq	.LC0(%rip), %rax
+.L745:
+	movq	%rsi, %rbx
+	jmp	.L607
+	.p2align 4,,10
+	.p2align 3
+.L756:
+	movq	168(%rsp), %rdx
+	movdqu	152(%rsp), %xmm7
+	movq	%rdx, 120(%rsp)
+	leaq	104(%rsp), %rdx
+	movups	%xmm7, 104(%rsp)
+	jmp	.L587
+	.p2align 4,,10
+	.p2align 3
+.L761:
+	movq	168(%rsp), %rax
+	movdqu	152(%rsp), %xmm7
+	movq	%rax, 120(%rsp)
+	leaq	104(%rsp), %rax
+	movups	%xmm7, 104(%rsp)
+	jmp	.L635
+	.p2align 4,,10
+	.p2align 3
+.L766:
+	movq	%rsi, 16(%rsp)
+	jmp	.L646
+	.p2align 4,,10
+	.p2align 3
+.L763:
+	movq	%rsi, 24(%rsp)
+	jmp	.L647
+.L672:
+	leaq	.LC0(%rip), %rsi
+	jmp	.L517
+.L666:
+	xorl	%ebx, %ebx
+	jmp	.L604
+.L659:
+	xorl	%r12d, %r12d
+	jmp	.L559
+.L755:
+	movq	8(%rsp), %r13
+	leaq	152(%rsp), %r12
+	addq	%r12, %r13
+	jmp	.L578
+.L652:
+	xorl	%r12d, %r12d
+	jmp	.L514
+.L760:
+	movq	16(%rsp), %r14
+	leaq	152(%rsp), %r12
+	addq	%r12, %r14
+	jmp	.L627
+.L751:
+	movq	8(%rsp), %rax
+	leaq	104(%rsp), %r13
+	addq	%r13, %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L537
+	.p2align 4,,10
+	.p2align 3
+.L589:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L767
+.L592:
+	movq	88(%rsp), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %r12
+	movq	128(%rsp), %r13
+	movq	136(%rsp), %r15
+	movq	%rax, 8(%rsp)
+	jmp	.L590
+	.p2align 4,,10
+	.p2align 3
+.L544:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L768
+.L547:
+	movq	88(%rsp), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	136(%rsp), %r14
+	movq	%rax, 16(%rsp)
+	movq	128(%rsp), %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L545
+	.p2align 4,,10
+	.p2align 3
+.L747:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L769
+.L502:
+	movq	_ZZN1n4heapEvE3res(%rip), %r14
+	movq	88(%rsp), %r13
+	movq	80(%rsp), %r15
+	jmp	.L500
+	.p2align 4,,10
+	.p2align 3
+.L572:
+	movq	%rax, %rdi
+	movq	%r12, %rsi
+	call	memcpy@PLT
+	jmp	.L573
+	.p2align 4,,10
+	.p2align 3
+.L621:
+	movq	%rax, %rdi
+	movq	%r12, %rsi
+	call	memcpy@PLT
+	jmp	.L622
+	.p2align 4,,10
+	.p2align 3
+.L531:
+	movq	%rax, %rdi
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L532
+	.p2align 4,,10
+	.p2align 3
+.L749:
+	leaq	104(%rsp), %r12
+	jmp	.L517
+	.p2align 4,,10
+	.p2align 3
+.L665:
+	movq	%r15, 24(%rsp)
+	xorl	%ebx, %ebx
+	jmp	.L602
+	.p2align 4,,10
+	.p2align 3
+.L658:
+	movq	%r14, 32(%rsp)
+	xorl	%r12d, %r12d
+	jmp	.L557
+	.p2align 4,,10
+	.p2align 3
+.L651:
+	movq	%r13, 24(%rsp)
+	xorl	%r12d, %r12d
+	jmp	.L512
+.L606:
+	movq	24(%rsp), %rax
+	leaq	152(%rsp), %rsi
+	addq	%rsi, %rax
+	jmp	.L745
+.L561:
+	movq	32(%rsp), %rax
+	leaq	152(%rsp), %rsi
+	addq	%rsi, %rax
+	jmp	.L744
+.L764:
+	movq	%r12, 16(%rsp)
+	jmp	.L509
+.L765:
+	movq	%rsi, 16(%rsp)
+	jmp	.L599
+.L762:
+	movq	%rsi, 24(%rsp)
+	jmp	.L554
+.L767:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L592
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L592
+.L769:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L502
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L502
+.L768:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L547
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L547
+.L624:
+	movq	%rax, %rdi
+	movq	%r12, %rsi
+	call	memcpy@PLT
+	jmp	.L625
+.L575:
+	movq	%rax, %rdi
+	movq	%r12, %rsi
+	call	memcpy@PLT
+	jmp	.L576
+.L534:
+	movq	%rax, %rdi
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L535
+.L678:
+	movq	%rax, %rbx
+	jmp	.L632
+.L675:
+	movq	%rax, %rbx
+	jmp	.L643
+.L676:
+	movq	%rax, %rbx
+	jmp	.L541
+.L677:
+	movq	%rax, %rbx
+	jmp	.L583
+.L674:
+	movq	%rax, %rbx
+	jmp	.L641
+	.section	.gcc_except_table
+.LLSDA6780:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6780-.LLSDACSB6780
+.LLSDACSB6780:
+	.uleb128 .LEHB26-.LFB6780
+	.uleb128 .LEHE26-.LEHB26
+	.uleb128 .L676-.LFB6780
+	.uleb128 0
+	.uleb128 .LEHB27-.LFB6780
+	.uleb128 .LEHE27-.LEHB27
+	.uleb128 .L677-.LFB6780
+	.uleb128 0
+	.uleb128 .LEHB28-.LFB6780
+	.uleb128 .LEHE28-.LEHB28
+	.uleb128 .L674-.LFB6780
+	.uleb128 0
+	.uleb128 .LEHB29-.LFB6780
+	.uleb128 .LEHE29-.LEHB29
+	.uleb128 .L678-.LFB6780
+	.uleb128 0
+	.uleb128 .LEHB30-.LFB6780
+	.uleb128 .LEHE30-.LEHB30
+	.uleb128 .L675-.LFB6780
+	.uleb128 0
+.LLSDACSE6780:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6780
+	.type	_Z29test_format_unsigned_integralv.cold, @function
+_Z29test_format_unsigned_integralv.cold:
+.LFSB6780:
+.L632:
+	.cfi_def_cfa_offset 240
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	136(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L585
+	movq	144(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	152(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L585:
+	movq	88(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L645
+	movq	96(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	104(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L645:
+	movq	%rbx, %rdi
+.LEHB31:
+	call	_Unwind_Resume@PLT
+.LEHE31:
+.L643:
+	movq	136(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L585
+	movq	144(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	152(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L585
+.L543:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC22(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB32:
+	call	__cxa_throw@PLT
+.LEHE32:
+.L673:
+	movq	%rax, %rbx
+	jmp	.L585
+.L541:
+	movq	88(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L542
+	movq	96(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	104(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L542:
+	movq	%rbx, %rdi
+.LEHB33:
+	call	_Unwind_Resume@PLT
+.LEHE33:
+.L636:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC26(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB34:
+	call	__cxa_throw@PLT
+.LEHE34:
+.L583:
+	movq	136(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L585
+	movq	144(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	152(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L585
+.L588:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC23(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB35:
+	call	__cxa_throw@PLT
+.LEHE35:
+.L641:
+	movq	136(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L585
+	movq	144(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	152(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L585
+	.cfi_endproc
+.LFE6780:
+	.section	.gcc_except_table
+.LLSDAC6780:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6780-.LLSDACSBC6780
+.LLSDACSBC6780:
+	.uleb128 .LEHB31-.LCOLDB27
+	.uleb128 .LEHE31-.LEHB31
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB32-.LCOLDB27
+	.uleb128 .LEHE32-.LEHB32
+	.uleb128 .L673-.LCOLDB27
+	.uleb128 0
+	.uleb128 .LEHB33-.LCOLDB27
+	.uleb128 .LEHE33-.LEHB33
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB34-.LCOLDB27
+	.uleb128 .LEHE34-.LEHB34
+	.uleb128 .L673-.LCOLDB27
+	.uleb128 0
+	.uleb128 .LEHB35-.LCOLDB27
+	.uleb128 .LEHE35-.LEHB35
+	.uleb128 .L673-.LCOLDB27
+	.uleb128 0
+.LLSDACSEC6780:
+	.section	.text.unlikely
+	.text
+	.size	_Z29test_format_unsigned_integralv, .-_Z29test_format_unsigned_integralv
+	.section	.text.unlikely
+	.size	_Z29test_format_unsigned_integralv.cold, .-_Z29test_format_unsigned_integralv.cold
+.LCOLDE27:
+	.text
+.LHOTE27:
+	.section	.rodata.str1.1
+.LC28:
+	.string	"-42"
+	.section	.rodata.str1.8
+	.align 8
+.LC29:
+	.string	"expected equal : expected value : result, actual value : \"-42\""
+	.section	.text.unlikely
+.LCOLDB30:
+	.text
+.LHOTB30:
+	.p2align 4
+	.globl	_Z27test_format_signed_integralv
+	.type	_Z27test_format_signed_integralv, @function
+_Z27test_format_signed_integralv:
+.LFB6779:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6779
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%r15d, %r15d
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movl	$23, %r13d
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$184, %rsp
+	.cfi_def_cfa_offset 240
+	movdqa	.LC3(%rip), %xmm1
+	movaps	%xmm1, 80(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r14
+	testq	%r14, %r14
+	je	.L1017
+.L771:
+	leaq	.LC0(%rip), %rbx
+	pxor	%xmm0, %xmm0
+	movl	$36, %esi
+	movq	%r14, 96(%rsp)
+	movq	%rbx, %rdi
+	movups	%xmm0, 104(%rsp)
+	movq	$0, 120(%rsp)
+	call	strchrnul@PLT
+	movq	%rax, %rbp
+	movq	%rax, 8(%rsp)
+	movzbl	(%rax), %eax
+	subq	%rbx, %rbp
+	testb	%al, %al
+	jne	.L775
+	jmp	.L776
+	.p2align 4,,10
+	.p2align 3
+.L778:
+	addq	$1, %rbp
+	movzbl	(%rbx,%rbp), %eax
+	testb	%al, %al
+	je	.L777
+.L775:
+	cmpb	$36, %al
+	jne	.L778
+	leaq	1(%rbx,%rbp), %rax
+	movq	%rax, 8(%rsp)
+.L776:
+	movq	$0, 16(%rsp)
+	leaq	0(%rbp,%r15), %rax
+	cmpq	$23, %r13
+	je	.L1018
+.L780:
+	movq	16(%rsp), %rcx
+	leaq	(%rcx,%r15), %rdx
+	cmpq	%rdx, %rbx
+	jb	.L782
+	cmpq	%rax, %r13
+	jnb	.L924
+.L921:
+	leaq	10(%r13,%r13), %rdx
+	movq	%r14, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r14), %rax
+.LEHB36:
+	call	*16(%rax)
+	movq	16(%rsp), %rsi
+	leaq	1(%r15), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %r12
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L784
+	movq	(%r14), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L784:
+	movq	24(%rsp), %rax
+	movq	%r12, 104(%rsp)
+	movq	%rax, 88(%rsp)
+.L783:
+	cmpq	$23, 24(%rsp)
+	leaq	.LC0(%rip), %rsi
+	je	.L1019
+.L788:
+	leaq	(%r12,%r15), %rdi
+	movq	%rbp, %rdx
+	leaq	125(%rsp), %r15
+	call	memmove@PLT
+	movzwl	.LC15(%rip), %eax
+	addq	80(%rsp), %rbp
+	movb	$45, 130(%rsp)
+	movq	%rbp, 80(%rsp)
+	movw	%ax, 128(%rsp)
+	movb	$0, (%r12,%rbp)
+	leaq	128(%rsp), %rbp
+	.p2align 4,,10
+	.p2align 3
+.L790:
+	movq	80(%rsp), %r12
+	movq	88(%rsp), %r13
+	movzbl	2(%rbp), %r14d
+	cmpq	%r13, %r12
+	je	.L1020
+.L791:
+	cmpq	$23, %r13
+	je	.L794
+	movq	104(%rsp), %rdx
+	subq	$1, %rbp
+	movb	%r14b, (%rdx,%r12)
+	movq	80(%rsp), %rax
+	leaq	1(%rax), %rcx
+	movq	%rcx, 80(%rsp)
+	movb	$0, 1(%rdx,%rax)
+	cmpq	%r15, %rbp
+	jne	.L790
+.L796:
+	movq	88(%rsp), %rbp
+	leaq	104(%rsp), %r13
+	cmpq	$23, %rbp
+	je	.L798
+	movq	104(%rsp), %r13
+.L798:
+	movq	8(%rsp), %r15
+	movq	$-1, %rsi
+	movq	%r15, %rdi
+	call	strnlen@PLT
+	movq	80(%rsp), %r14
+	movq	%r15, %rsi
+	movq	%rax, %r12
+	leaq	(%r14,%rax), %rax
+	cmpq	%r13, %r15
+	jb	.L799
+	leaq	0(%r13,%r14), %rdx
+	cmpq	%rdx, %r15
+	jnb	.L799
+	subq	%r13, %rsi
+	movq	%rsi, 8(%rsp)
+	cmpq	%rax, %rbp
+	jnb	.L804
+	leaq	10(%rbp,%rbp), %rdx
+	movq	96(%rsp), %r15
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r15, %rdi
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	leaq	1(%r14), %rdx
+	cmpq	$23, %rbp
+	je	.L805
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	movq	104(%rsp), %rsi
+	movq	%r15, %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	call	*24(%rax)
+.L806:
+	movq	16(%rsp), %rax
+	movq	%rax, 104(%rsp)
+	movq	24(%rsp), %rax
+	movq	%rax, 88(%rsp)
+	movq	%rax, %rbp
+.L804:
+	cmpq	$23, %rbp
+	je	.L1021
+	movq	8(%rsp), %rax
+	movq	104(%rsp), %r13
+	addq	%r13, %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L808
+	.p2align 4,,10
+	.p2align 3
+.L782:
+	movq	%rcx, %rsi
+	movq	%rbx, %rcx
+	subq	%rsi, %rcx
+	movq	%rcx, 24(%rsp)
+	cmpq	%rax, %r13
+	jnb	.L925
+	leaq	10(%r13,%r13), %rdx
+	movq	%r14, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 32(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r14), %rax
+	call	*16(%rax)
+	movq	16(%rsp), %rsi
+	leaq	1(%r15), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %r12
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L786
+	movq	(%r14), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L786:
+	movq	32(%rsp), %rax
+	movq	%r12, 104(%rsp)
+	movq	%rax, 88(%rsp)
+	movq	%rax, %r13
+.L785:
+	cmpq	$23, %r13
+	jne	.L1013
+	leaq	104(%rsp), %r12
+.L1013:
+	movq	24(%rsp), %rsi
+	addq	%r12, %rsi
+	jmp	.L788
+	.p2align 4,,10
+	.p2align 3
+.L794:
+	movb	%r14b, 104(%rsp,%r12)
+	movq	80(%rsp), %rax
+	subq	$1, %rbp
+	addq	$1, %rax
+	movq	%rax, 80(%rsp)
+	movb	$0, 104(%rsp,%rax)
+	cmpq	%r15, %rbp
+	je	.L796
+	jmp	.L790
+	.p2align 4,,10
+	.p2align 3
+.L1020:
+	leaq	1(%r12), %rcx
+	cmpq	%rcx, %r12
+	jnb	.L791
+	leaq	10(%r12,%r12), %rax
+	movq	96(%rsp), %rdi
+	movq	%rcx, 24(%rsp)
+	movl	$1, %edx
+	cmpq	%rcx, %rax
+	cmovb	%rcx, %rax
+	movq	%rdi, 40(%rsp)
+	movq	%rax, 32(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	cmpq	$23, %r13
+	je	.L792
+	movq	104(%rsp), %rsi
+	movq	24(%rsp), %rdx
+	movq	%rax, %rdi
+	movq	%rsi, 24(%rsp)
+	call	memcpy@PLT
+	movq	40(%rsp), %rdi
+	movq	24(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L793:
+	movq	16(%rsp), %rax
+	movq	%rax, 104(%rsp)
+	movq	32(%rsp), %rax
+	movq	%rax, 88(%rsp)
+	movq	%rax, %r13
+	jmp	.L791
+	.p2align 4,,10
+	.p2align 3
+.L799:
+	cmpq	%rax, %rbp
+	jnb	.L801
+	leaq	10(%rbp,%rbp), %rdx
+	movq	96(%rsp), %r15
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r15, %rdi
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	leaq	1(%r14), %rdx
+	cmpq	$23, %rbp
+	je	.L802
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	movq	104(%rsp), %rsi
+	movq	%r15, %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	call	*24(%rax)
+.LEHE36:
+.L803:
+	movq	16(%rsp), %rax
+	movq	%rax, 104(%rsp)
+	movq	24(%rsp), %rax
+	movq	%rax, 88(%rsp)
+	movq	%rax, %rbp
+.L801:
+	leaq	104(%rsp), %r13
+	cmpq	$23, %rbp
+	je	.L808
+	movq	104(%rsp), %r13
+.L808:
+	movq	8(%rsp), %rsi
+	movq	%r12, %rdx
+	leaq	0(%r13,%r14), %rdi
+	call	memmove@PLT
+	addq	80(%rsp), %r12
+	leaq	104(%rsp), %rdx
+	movq	%r12, 80(%rsp)
+	movb	$0, 0(%r13,%r12)
+	movq	88(%rsp), %rcx
+	movq	80(%rsp), %rax
+	movq	%rcx, 16(%rsp)
+	cmpq	$23, %rcx
+	je	.L810
+	movq	104(%rsp), %rdx
+.L810:
+	cmpq	$3, %rax
+	jne	.L814
+	cmpw	$13357, (%rdx)
+	jne	.L814
+	cmpb	$50, 2(%rdx)
+	jne	.L814
+	movdqa	.LC3(%rip), %xmm6
+	movaps	%xmm6, 128(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, 8(%rsp)
+	testq	%rax, %rax
+	je	.L817
+	xorl	%r14d, %r14d
+	movl	$23, %r15d
+.L818:
+	pxor	%xmm0, %xmm0
+	movl	$36, %esi
+	movq	%rbx, %rdi
+	movq	%rax, 144(%rsp)
+	movq	$0, 168(%rsp)
+	movups	%xmm0, 152(%rsp)
+	call	strchrnul@PLT
+	movq	%rax, %rbp
+	movq	%rax, %r13
+	movzbl	(%rax), %eax
+	subq	%rbx, %rbp
+	testb	%al, %al
+	jne	.L822
+	jmp	.L823
+	.p2align 4,,10
+	.p2align 3
+.L825:
+	addq	$1, %rbp
+	movzbl	(%rbx,%rbp), %eax
+	testb	%al, %al
+	je	.L824
+.L822:
+	cmpb	$36, %al
+	jne	.L825
+	leaq	1(%rbx,%rbp), %r13
+.L823:
+	movq	$0, 24(%rsp)
+	leaq	0(%rbp,%r14), %rax
+	cmpq	$23, %r15
+	je	.L1022
+.L827:
+	movq	24(%rsp), %rcx
+	leaq	(%rcx,%r14), %rdx
+	cmpq	%rdx, %rbx
+	jnb	.L1023
+	movq	%rcx, %rsi
+	movq	%rbx, %rcx
+	subq	%rsi, %rcx
+	movq	%rcx, 32(%rsp)
+	cmpq	%rax, %r15
+	jnb	.L932
+	leaq	10(%r15,%r15), %rdx
+	movq	8(%rsp), %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 40(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%rdi), %rax
+.LEHB37:
+	call	*16(%rax)
+	movq	24(%rsp), %rsi
+	leaq	1(%r14), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %r12
+	call	memcpy@PLT
+	cmpq	$23, %r15
+	je	.L833
+	movq	8(%rsp), %rdi
+	leaq	1(%r15), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L833:
+	movq	40(%rsp), %rax
+	movq	%r12, 152(%rsp)
+	movq	%rax, 136(%rsp)
+	movq	%rax, %r15
+.L832:
+	cmpq	$23, %r15
+	je	.L834
+	movq	32(%rsp), %rax
+	addq	%r12, %rax
+	.p2align 4,,10
+	.p2align 3
+.L835:
+	leaq	(%r12,%r14), %rdi
+	movq	%rbp, %rdx
+	movq	%rax, %rsi
+	call	memmove@PLT
+	addq	128(%rsp), %rbp
+	movq	%rbp, 128(%rsp)
+	movb	$0, (%r12,%rbp)
+	movq	128(%rsp), %rbp
+	movq	136(%rsp), %r12
+	cmpq	%r12, %rbp
+	je	.L1024
+.L837:
+	leaq	152(%rsp), %rax
+	cmpq	$23, %r12
+	je	.L840
+	movq	152(%rsp), %rax
+.L840:
+	movb	$48, (%rax,%rbp)
+	movq	128(%rsp), %rdx
+	leaq	152(%rsp), %r12
+	leaq	1(%rdx), %rcx
+	movq	%rcx, 128(%rsp)
+	movb	$0, 1(%rax,%rdx)
+	movq	136(%rsp), %rbp
+	cmpq	$23, %rbp
+	je	.L841
+	movq	152(%rsp), %r12
+	.p2align 4,,10
+	.p2align 3
+.L841:
+	movq	$-1, %rsi
+	movq	%r13, %rdi
+	call	strnlen@PLT
+	movq	128(%rsp), %r15
+	movq	%rax, %r14
+	leaq	(%rax,%r15), %rax
+	cmpq	%r12, %r13
+	jb	.L842
+	leaq	(%r12,%r15), %rdx
+	cmpq	%rdx, %r13
+	jnb	.L842
+	subq	%r12, %r13
+	movq	%r13, 8(%rsp)
+	cmpq	%rax, %rbp
+	jnb	.L847
+	leaq	10(%rbp,%rbp), %rdx
+	movq	144(%rsp), %r13
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r13, %rdi
+	movl	$1, %edx
+	movq	%rax, 32(%rsp)
+	leaq	1(%rax), %rsi
+	movq	0(%r13), %rax
+	call	*16(%rax)
+	movq	%rax, 24(%rsp)
+	leaq	1(%r15), %rdx
+	cmpq	$23, %rbp
+	je	.L848
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	0(%r13), %rax
+	leaq	1(%rbp), %rdx
+	movq	%r13, %rdi
+	movq	152(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.LEHE37:
+.L849:
+	movq	24(%rsp), %rax
+	movq	%rax, 152(%rsp)
+	movq	32(%rsp), %rax
+	movq	%rax, 136(%rsp)
+	movq	%rax, %rbp
+.L847:
+	cmpq	$23, %rbp
+	je	.L1025
+	movq	152(%rsp), %r12
+	movq	8(%rsp), %r13
+	addq	%r12, %r13
+	.p2align 4,,10
+	.p2align 3
+.L851:
+	movq	%r14, %rdx
+	leaq	(%r12,%r15), %rdi
+	movq	%r13, %rsi
+	call	memmove@PLT
+	addq	128(%rsp), %r14
+	cmpq	$23, 16(%rsp)
+	movq	%r14, 128(%rsp)
+	movb	$0, (%r12,%r14)
+	je	.L859
+	movq	96(%rsp), %rdi
+	movq	16(%rsp), %rdx
+	movl	$1, %ecx
+	movq	104(%rsp), %rsi
+	movq	(%rdi), %rax
+	addq	$1, %rdx
+.LEHB38:
+	call	*24(%rax)
+.LEHE38:
+.L859:
+	movq	144(%rsp), %rdx
+	movq	128(%rsp), %rax
+	movq	136(%rsp), %xmm2
+	movdqa	128(%rsp), %xmm3
+	movq	%rdx, 96(%rsp)
+	movq	%xmm2, 8(%rsp)
+	cmpq	$23, 8(%rsp)
+	movaps	%xmm3, 80(%rsp)
+	je	.L1026
+	movq	152(%rsp), %rdx
+	movq	%rdx, 104(%rsp)
+.L860:
+	cmpq	$1, %rax
+	jne	.L861
+	cmpb	$48, (%rdx)
+	jne	.L861
+	movdqa	.LC3(%rip), %xmm4
+	movaps	%xmm4, 128(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r12
+	testq	%r12, %r12
+	je	.L862
+	xorl	%r13d, %r13d
+	movl	$23, %r15d
+.L863:
+	pxor	%xmm0, %xmm0
+	movl	$36, %esi
+	movq	%rbx, %rdi
+	movq	%r12, 144(%rsp)
+	movq	$0, 168(%rsp)
+	movups	%xmm0, 152(%rsp)
+	call	strchrnul@PLT
+	movq	%rax, %rbp
+	movq	%rax, %r14
+	movzbl	(%rax), %eax
+	subq	%rbx, %rbp
+	testb	%al, %al
+	jne	.L867
+	jmp	.L868
+	.p2align 4,,10
+	.p2align 3
+.L870:
+	addq	$1, %rbp
+	movzbl	(%rbx,%rbp), %eax
+	testb	%al, %al
+	je	.L869
+.L867:
+	cmpb	$36, %al
+	jne	.L870
+	leaq	1(%rbx,%rbp), %r14
+.L868:
+	movq	$0, 16(%rsp)
+	leaq	0(%r13,%rbp), %rax
+	cmpq	$23, %r15
+	je	.L1027
+.L872:
+	movq	16(%rsp), %rsi
+	leaq	(%rsi,%r13), %rdx
+	cmpq	%rdx, %rbx
+	jnb	.L1028
+	subq	%rsi, %rbx
+	movq	%rbx, 24(%rsp)
+	cmpq	%rax, %r15
+	jnb	.L939
+	leaq	10(%r15,%r15), %rdx
+	movq	%r12, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 32(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r12), %rax
+.LEHB39:
+	call	*16(%rax)
+	movq	16(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r15
+	je	.L878
+	movq	(%r12), %rax
+	leaq	1(%r15), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r12, %rdi
+	call	*24(%rax)
+.L878:
+	movq	32(%rsp), %rax
+	movq	%rbx, 152(%rsp)
+	movq	%rax, 136(%rsp)
+	movq	%rax, %r15
+.L877:
+	cmpq	$23, %r15
+	je	.L879
+	movq	24(%rsp), %rax
+	addq	%rbx, %rax
+	.p2align 4,,10
+	.p2align 3
+.L880:
+	movq	%rbp, %rdx
+	leaq	(%rbx,%r13), %rdi
+	leaq	48(%rsp), %r15
+	movq	%rax, %rsi
+	call	memmove@PLT
+	movb	$49, 56(%rsp)
+	leaq	56(%rsp), %r12
+	movq	.LC24(%rip), %rax
+	addq	128(%rsp), %rbp
+	movq	%rbp, 128(%rsp)
+	movq	%rax, 48(%rsp)
+	movb	$0, (%rbx,%rbp)
+	.p2align 4,,10
+	.p2align 3
+.L882:
+	movq	128(%rsp), %rbx
+	movq	136(%rsp), %rbp
+	movzbl	(%r12), %r13d
+	cmpq	%rbp, %rbx
+	je	.L1029
+.L883:
+	cmpq	$23, %rbp
+	je	.L886
+	movq	152(%rsp), %rdx
+	movb	%r13b, (%rdx,%rbx)
+	movq	128(%rsp), %rax
+	leaq	1(%rax), %rcx
+	movq	%rcx, 128(%rsp)
+	movb	$0, 1(%rdx,%rax)
+	cmpq	%r12, %r15
+	je	.L887
+.L1016:
+	subq	$1, %r12
+	jmp	.L882
+	.p2align 4,,10
+	.p2align 3
+.L777:
+	leaq	(%rbx,%rbp), %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L776
+	.p2align 4,,10
+	.p2align 3
+.L792:
+	movq	24(%rsp), %rdx
+	movq	%rax, %rdi
+	leaq	104(%rsp), %rsi
+	call	memcpy@PLT
+	jmp	.L793
+	.p2align 4,,10
+	.p2align 3
+.L1018:
+	leaq	104(%rsp), %r12
+	cmpq	%r12, %rbx
+	jnb	.L1030
+	cmpq	$23, %rax
+	jbe	.L945
+	movq	%r12, 16(%rsp)
+	jmp	.L921
+.L945:
+	leaq	.LC0(%rip), %rsi
+	jmp	.L788
+.L1021:
+	movq	8(%rsp), %rax
+	leaq	104(%rsp), %r13
+	addq	%r13, %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L808
+.L925:
+	xorl	%r12d, %r12d
+	jmp	.L785
+	.p2align 4,,10
+	.p2align 3
+.L1017:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1031
+.L773:
+	movq	_ZZN1n4heapEvE3res(%rip), %r14
+	movq	80(%rsp), %r15
+	movq	88(%rsp), %r13
+	jmp	.L771
+	.p2align 4,,10
+	.p2align 3
+.L802:
+	movq	%rax, %rdi
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L803
+	.p2align 4,,10
+	.p2align 3
+.L1019:
+	leaq	104(%rsp), %r12
+	jmp	.L788
+	.p2align 4,,10
+	.p2align 3
+.L924:
+	movq	%r13, 24(%rsp)
+	xorl	%r12d, %r12d
+	jmp	.L783
+.L1030:
+	movq	%r12, 16(%rsp)
+	jmp	.L780
+.L1031:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L773
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L773
+.L805:
+	movq	%rax, %rdi
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L806
+	.p2align 4,,10
+	.p2align 3
+.L886:
+	movb	%r13b, 152(%rsp,%rbx)
+	movq	128(%rsp), %rax
+	addq	$1, %rax
+	movq	%rax, 128(%rsp)
+	movb	$0, 152(%rsp,%rax)
+	cmpq	%r12, %r15
+	jne	.L1016
+.L887:
+	movq	136(%rsp), %rbx
+	leaq	152(%rsp), %r12
+	cmpq	$23, %rbx
+	je	.L890
+	movq	152(%rsp), %r12
+.L890:
+	movq	$-1, %rsi
+	movq	%r14, %rdi
+	call	strnlen@PLT
+	movq	128(%rsp), %r13
+	movq	%rax, %rbp
+	leaq	0(%r13,%rax), %rax
+	cmpq	%r12, %r14
+	jb	.L891
+	leaq	(%r12,%r13), %rdx
+	cmpq	%rdx, %r14
+	jnb	.L891
+	subq	%r12, %r14
+	movq	%r14, 16(%rsp)
+	cmpq	%rax, %rbx
+	jnb	.L896
+	leaq	10(%rbx,%rbx), %rdx
+	movq	144(%rsp), %r14
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r14, %rdi
+	movl	$1, %edx
+	movq	%rax, %r15
+	leaq	1(%rax), %rsi
+	movq	(%r14), %rax
+	call	*16(%rax)
+	movq	%rax, 24(%rsp)
+	leaq	1(%r13), %rdx
+	cmpq	$23, %rbx
+	je	.L897
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r14), %rax
+	leaq	1(%rbx), %rdx
+	movq	%r14, %rdi
+	movq	152(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.LEHE39:
+.L898:
+	movq	24(%rsp), %rax
+	movq	%r15, 136(%rsp)
+	movq	%r15, %rbx
+	movq	%rax, 152(%rsp)
+.L896:
+	cmpq	$23, %rbx
+	je	.L1032
+	movq	152(%rsp), %r12
+	movq	16(%rsp), %r14
+	addq	%r12, %r14
+	.p2align 4,,10
+	.p2align 3
+.L900:
+	movq	%rbp, %rdx
+	leaq	(%r12,%r13), %rdi
+	movq	%r14, %rsi
+	call	memmove@PLT
+	addq	128(%rsp), %rbp
+	cmpq	$23, 8(%rsp)
+	movq	%rbp, 128(%rsp)
+	movb	$0, (%r12,%rbp)
+	je	.L907
+	movq	96(%rsp), %rdi
+	movq	8(%rsp), %rdx
+	movl	$1, %ecx
+	movq	104(%rsp), %rsi
+	movq	(%rdi), %rax
+	addq	$1, %rdx
+.LEHB40:
+	call	*24(%rax)
+.LEHE40:
+.L907:
+	movq	144(%rsp), %rdi
+	movq	136(%rsp), %rdx
+	movdqa	128(%rsp), %xmm5
+	movq	128(%rsp), %rcx
+	movq	%rdi, 96(%rsp)
+	movaps	%xmm5, 80(%rsp)
+	cmpq	$23, %rdx
+	je	.L1033
+	movq	152(%rsp), %rax
+	movq	%rax, 104(%rsp)
+.L908:
+	cmpq	$9, %rcx
+	jne	.L909
+	movabsq	$4050765991979987505, %rcx
+	cmpq	%rcx, (%rax)
+	jne	.L909
+	cmpb	$57, 8(%rax)
+	jne	.L909
+	cmpq	$23, %rdx
+	je	.L770
+	movq	(%rdi), %rax
+	movq	104(%rsp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	call	*24(%rax)
+.L770:
+	addq	$184, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1029:
+	.cfi_restore_state
+	leaq	1(%rbx), %rdi
+	cmpq	%rdi, %rbx
+	jnb	.L883
+	leaq	10(%rbx,%rbx), %rax
+	movq	%rdi, 24(%rsp)
+	movl	$1, %edx
+	movq	144(%rsp), %rcx
+	cmpq	%rdi, %rax
+	cmovb	%rdi, %rax
+	movq	%rcx, 40(%rsp)
+	movq	%rcx, %rdi
+	movq	%rax, %rsi
+	movq	%rax, 32(%rsp)
+	movq	(%rcx), %rax
+	addq	$1, %rsi
+.LEHB41:
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	cmpq	$23, %rbp
+	je	.L884
+	movq	152(%rsp), %rsi
+	movq	24(%rsp), %rdx
+	movq	%rax, %rdi
+	movq	%rsi, 24(%rsp)
+	call	memcpy@PLT
+	movq	40(%rsp), %rdi
+	movq	24(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE41:
+.L885:
+	movq	16(%rsp), %rax
+	movq	%rax, 152(%rsp)
+	movq	32(%rsp), %rax
+	movq	%rax, 136(%rsp)
+	movq	%rax, %rbp
+	jmp	.L883
+	.p2align 4,,10
+	.p2align 3
+.L1024:
+	leaq	1(%rbp), %r14
+	cmpq	%r14, %rbp
+	jnb	.L837
+	leaq	10(%rbp,%rbp), %rax
+	movq	144(%rsp), %r15
+	movl	$1, %edx
+	cmpq	%r14, %rax
+	cmovb	%r14, %rax
+	movq	%r15, %rdi
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+.LEHB42:
+	call	*16(%rax)
+	movq	%rax, 8(%rsp)
+	cmpq	$23, %r12
+	je	.L838
+	movq	152(%rsp), %rsi
+	movq	%r14, %rdx
+	movq	%rax, %rdi
+	movq	%rsi, 32(%rsp)
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	movq	32(%rsp), %rsi
+	movq	%r15, %rdi
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	call	*24(%rax)
+.LEHE42:
+.L839:
+	movq	8(%rsp), %rax
+	movq	%rax, 152(%rsp)
+	movq	24(%rsp), %rax
+	movq	%rax, 136(%rsp)
+	movq	%rax, %r12
+	jmp	.L837
+	.p2align 4,,10
+	.p2align 3
+.L891:
+	cmpq	%rax, %rbx
+	jnb	.L893
+	leaq	10(%rbx,%rbx), %rdx
+	movq	144(%rsp), %r15
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r15, %rdi
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+.LEHB43:
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	leaq	1(%r13), %rdx
+	cmpq	$23, %rbx
+	je	.L894
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	leaq	1(%rbx), %rdx
+	movq	%r15, %rdi
+	movq	152(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.LEHE43:
+.L895:
+	movq	16(%rsp), %rax
+	movq	%rax, 152(%rsp)
+	movq	24(%rsp), %rax
+	movq	%rax, 136(%rsp)
+	movq	%rax, %rbx
+.L893:
+	leaq	152(%rsp), %r12
+	cmpq	$23, %rbx
+	je	.L900
+	movq	152(%rsp), %r12
+	jmp	.L900
+	.p2align 4,,10
+	.p2align 3
+.L842:
+	cmpq	%rax, %rbp
+	jnb	.L844
+	leaq	10(%rbp,%rbp), %rdx
+	movq	144(%rsp), %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%rdi, 32(%rsp)
+	movl	$1, %edx
+	movq	%rax, %rsi
+	movq	%rax, 24(%rsp)
+	movq	(%rdi), %rax
+	addq	$1, %rsi
+.LEHB44:
+	call	*16(%rax)
+	movq	%rax, 8(%rsp)
+	leaq	1(%r15), %rdx
+	cmpq	$23, %rbp
+	je	.L845
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	32(%rsp), %rdi
+	leaq	1(%rbp), %rdx
+	movq	152(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE44:
+.L846:
+	movq	8(%rsp), %rax
+	movq	%rax, 152(%rsp)
+	movq	24(%rsp), %rax
+	movq	%rax, 136(%rsp)
+	movq	%rax, %rbp
+.L844:
+	leaq	152(%rsp), %r12
+	cmpq	$23, %rbp
+	je	.L851
+	movq	152(%rsp), %r12
+	jmp	.L851
+	.p2align 4,,10
+	.p2align 3
+.L1028:
+	cmpq	%rax, %r15
+	jnb	.L938
+.L919:
+	leaq	10(%r15,%r15), %rdx
+	movq	%r12, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r12), %rax
+.LEHB45:
+	call	*16(%rax)
+	movq	16(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r15
+	je	.L876
+	movq	(%r12), %rax
+	leaq	1(%r15), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r12, %rdi
+	call	*24(%rax)
+.LEHE45:
+.L876:
+	movq	24(%rsp), %rax
+	movq	%rbx, 152(%rsp)
+	movq	%rax, 136(%rsp)
+.L875:
+	cmpq	$23, 24(%rsp)
+	leaq	.LC0(%rip), %rax
+	leaq	152(%rsp), %rsi
+	jne	.L880
+.L1015:
+	movq	%rsi, %rbx
+	jmp	.L880
+	.p2align 4,,10
+	.p2align 3
+.L1023:
+	cmpq	%rax, %r15
+	jnb	.L931
+.L920:
+	leaq	10(%r15,%r15), %rdx
+	movq	8(%rsp), %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 32(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%rdi), %rax
+.LEHB46:
+	call	*16(%rax)
+	movq	24(%rsp), %rsi
+	leaq	1(%r14), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %r12
+	call	memcpy@PLT
+	cmpq	$23, %r15
+	je	.L831
+	movq	8(%rsp), %rdi
+	leaq	1(%r15), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE46:
+.L831:
+	movq	32(%rsp), %rax
+	movq	%r12, 152(%rsp)
+	movq	%rax, 136(%rsp)
+.L830:
+	cmpq	$23, 32(%rsp)
+	leaq	.LC0(%rip), %rax
+	leaq	152(%rsp), %rsi
+	jne	.L835
+.L1014:
+	movq	%rsi, %r12
+	jmp	.L835
+	.p2align 4,,10
+	.p2align 3
+.L824:
+	leaq	(%rbx,%rbp), %r13
+	jmp	.L823
+	.p2align 4,,10
+	.p2align 3
+.L869:
+	leaq	(%rbx,%rbp), %r14
+	jmp	.L868
+	.p2align 4,,10
+	.p2align 3
+.L838:
+	movq	%rax, %rdi
+	leaq	152(%rsp), %rsi
+	movq	%r14, %rdx
+	call	memcpy@PLT
+	jmp	.L839
+	.p2align 4,,10
+	.p2align 3
+.L884:
+	movq	24(%rsp), %rdx
+	movq	%rax, %rdi
+	leaq	152(%rsp), %rsi
+	call	memcpy@PLT
+	jmp	.L885
+	.p2align 4,,10
+	.p2align 3
+.L1027:
+	leaq	152(%rsp), %rsi
+	cmpq	%rsi, %rbx
+	jnb	.L1034
+	cmpq	$23, %rax
+	jbe	.L943
+	movq	%rsi, 16(%rsp)
+	jmp	.L919
+	.p2align 4,,10
+	.p2align 3
+.L1022:
+	leaq	152(%rsp), %rsi
+	cmpq	%rsi, %rbx
+	jnb	.L1035
+	cmpq	$23, %rax
+	jbe	.L944
+	movq	%rsi, 24(%rsp)
+	jmp	.L920
+	.p2align 4,,10
+	.p2align 3
+.L1026:
+	movq	168(%rsp), %rdx
+	movdqu	152(%rsp), %xmm6
+	movq	%rdx, 120(%rsp)
+	leaq	104(%rsp), %rdx
+	movups	%xmm6, 104(%rsp)
+	jmp	.L860
+	.p2align 4,,10
+	.p2align 3
+.L1033:
+	movq	168(%rsp), %rax
+	movdqu	152(%rsp), %xmm7
+	movq	%rax, 120(%rsp)
+	leaq	104(%rsp), %rax
+	movups	%xmm7, 104(%rsp)
+	jmp	.L908
+	.p2align 4,,10
+	.p2align 3
+.L862:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1036
+.L865:
+	movq	88(%rsp), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %r12
+	movq	136(%rsp), %r15
+	movq	128(%rsp), %r13
+	movq	%rax, 8(%rsp)
+	jmp	.L863
+.L817:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1037
+.L820:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	136(%rsp), %r15
+	movq	128(%rsp), %r14
+	movq	%rax, 8(%rsp)
+	movq	88(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	movq	8(%rsp), %rax
+	jmp	.L818
+	.p2align 4,,10
+	.p2align 3
+.L845:
+	movq	%rax, %rdi
+	movq	%r12, %rsi
+	call	memcpy@PLT
+	jmp	.L846
+	.p2align 4,,10
+	.p2align 3
+.L894:
+	movq	%rax, %rdi
+	movq	%r12, %rsi
+	call	memcpy@PLT
+	jmp	.L895
+	.p2align 4,,10
+	.p2align 3
+.L931:
+	movq	%r15, 32(%rsp)
+	xorl	%r12d, %r12d
+	jmp	.L830
+	.p2align 4,,10
+	.p2align 3
+.L938:
+	movq	%r15, 24(%rsp)
+	xorl	%ebx, %ebx
+	jmp	.L875
+.L944:
+	leaq	.LC0(%rip), %rax
+	jmp	.L1014
+.L943:
+	leaq	.LC0(%rip), %rax
+	jmp	.L1015
+.L932:
+	xorl	%r12d, %r12d
+	jmp	.L832
+.L939:
+	xorl	%ebx, %ebx
+	jmp	.L877
+.L1032:
+	movq	16(%rsp), %r14
+	leaq	152(%rsp), %r12
+	addq	%r12, %r14
+	jmp	.L900
+.L879:
+	movq	24(%rsp), %rax
+	leaq	152(%rsp), %rsi
+	addq	%rsi, %rax
+	jmp	.L1015
+.L1025:
+	movq	8(%rsp), %r13
+	leaq	152(%rsp), %r12
+	addq	%r12, %r13
+	jmp	.L851
+.L834:
+	movq	32(%rsp), %rax
+	leaq	152(%rsp), %rsi
+	addq	%rsi, %rax
+	jmp	.L1014
+.L1035:
+	movq	%rsi, 24(%rsp)
+	jmp	.L827
+.L1034:
+	movq	%rsi, 16(%rsp)
+	jmp	.L872
+.L1036:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L865
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L865
+.L1037:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L820
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L820
+.L848:
+	movq	%rax, %rdi
+	movq	%r12, %rsi
+	call	memcpy@PLT
+	jmp	.L849
+.L897:
+	movq	%rax, %rdi
+	movq	%r12, %rsi
+	call	memcpy@PLT
+	jmp	.L898
+.L948:
+	movq	%rax, %rbx
+	jmp	.L916
+.L951:
+	movq	%rax, %rbx
+	jmp	.L905
+.L949:
+	movq	%rax, %rbx
+	jmp	.L812
+.L950:
+	movq	%rax, %rbx
+	jmp	.L856
+.L947:
+	movq	%rax, %rbx
+	jmp	.L914
+	.section	.gcc_except_table
+.LLSDA6779:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6779-.LLSDACSB6779
+.LLSDACSB6779:
+	.uleb128 .LEHB36-.LFB6779
+	.uleb128 .LEHE36-.LEHB36
+	.uleb128 .L949-.LFB6779
+	.uleb128 0
+	.uleb128 .LEHB37-.LFB6779
+	.uleb128 .LEHE37-.LEHB37
+	.uleb128 .L950-.LFB6779
+	.uleb128 0
+	.uleb128 .LEHB38-.LFB6779
+	.uleb128 .LEHE38-.LEHB38
+	.uleb128 .L947-.LFB6779
+	.uleb128 0
+	.uleb128 .LEHB39-.LFB6779
+	.uleb128 .LEHE39-.LEHB39
+	.uleb128 .L951-.LFB6779
+	.uleb128 0
+	.uleb128 .LEHB40-.LFB6779
+	.uleb128 .LEHE40-.LEHB40
+	.uleb128 .L948-.LFB6779
+	.uleb128 0
+	.uleb128 .LEHB41-.LFB6779
+	.uleb128 .LEHE41-.LEHB41
+	.uleb128 .L951-.LFB6779
+	.uleb128 0
+	.uleb128 .LEHB42-.LFB6779
+	.uleb128 .LEHE42-.LEHB42
+	.uleb128 .L950-.LFB6779
+	.uleb128 0
+	.uleb128 .LEHB43-.LFB6779
+	.uleb128 .LEHE43-.LEHB43
+	.uleb128 .L951-.LFB6779
+	.uleb128 0
+	.uleb128 .LEHB44-.LFB6779
+	.uleb128 .LEHE44-.LEHB44
+	.uleb128 .L950-.LFB6779
+	.uleb128 0
+	.uleb128 .LEHB45-.LFB6779
+	.uleb128 .LEHE45-.LEHB45
+	.uleb128 .L951-.LFB6779
+	.uleb128 0
+	.uleb128 .LEHB46-.LFB6779
+	.uleb128 .LEHE46-.LEHB46
+	.uleb128 .L950-.LFB6779
+	.uleb128 0
+.LLSDACSE6779:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6779
+	.type	_Z27test_format_signed_integralv.cold, @function
+_Z27test_format_signed_integralv.cold:
+.LFSB6779:
+.L909:
+	.cfi_def_cfa_offset 240
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC26(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB47:
+	call	__cxa_throw@PLT
+.LEHE47:
+.L916:
+	movq	136(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L858
+	movq	144(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	152(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L858:
+	movq	88(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L918
+	movq	96(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	104(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L918:
+	movq	%rbx, %rdi
+.LEHB48:
+	call	_Unwind_Resume@PLT
+.LEHE48:
+.L946:
+	movq	%rax, %rbx
+	jmp	.L858
+.L814:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC29(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB49:
+	call	__cxa_throw@PLT
+.LEHE49:
+.L905:
+	movq	136(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L858
+	movq	144(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	152(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L858
+.L861:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC23(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB50:
+	call	__cxa_throw@PLT
+.LEHE50:
+.L812:
+	movq	88(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L813
+	movq	96(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	104(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L813:
+	movq	%rbx, %rdi
+.LEHB51:
+	call	_Unwind_Resume@PLT
+.LEHE51:
+.L856:
+	movq	136(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L858
+	movq	144(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	152(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L858
+.L914:
+	movq	136(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L858
+	movq	144(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	152(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L858
+	.cfi_endproc
+.LFE6779:
+	.section	.gcc_except_table
+.LLSDAC6779:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6779-.LLSDACSBC6779
+.LLSDACSBC6779:
+	.uleb128 .LEHB47-.LCOLDB30
+	.uleb128 .LEHE47-.LEHB47
+	.uleb128 .L946-.LCOLDB30
+	.uleb128 0
+	.uleb128 .LEHB48-.LCOLDB30
+	.uleb128 .LEHE48-.LEHB48
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB49-.LCOLDB30
+	.uleb128 .LEHE49-.LEHB49
+	.uleb128 .L946-.LCOLDB30
+	.uleb128 0
+	.uleb128 .LEHB50-.LCOLDB30
+	.uleb128 .LEHE50-.LEHB50
+	.uleb128 .L946-.LCOLDB30
+	.uleb128 0
+	.uleb128 .LEHB51-.LCOLDB30
+	.uleb128 .LEHE51-.LEHB51
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6779:
+	.section	.text.unlikely
+	.text
+	.size	_Z27test_format_signed_integralv, .-_Z27test_format_signed_integralv
+	.section	.text.unlikely
+	.size	_Z27test_format_signed_integralv.cold, .-_Z27test_format_signed_integralv.cold
+.LCOLDE30:
+	.text
+.LHOTE30:
+	.section	.rodata.str1.8
+	.align 8
+.LC31:
+	.string	"expected equal : expected value : result, actual value : \"Hello, world!\""
+	.section	.rodata.str1.1
+.LC32:
+	.string	"The answer is 42"
+	.section	.rodata.str1.8
+	.align 8
+.LC33:
+	.string	"expected equal : expected value : result, actual value : \"The answer is 42\""
+	.section	.rodata.str1.1
+.LC34:
+	.string	"John is 30 years old"
+	.section	.rodata.str1.8
+	.align 8
+.LC35:
+	.string	"expected equal : expected value : result, actual value : \"John is 30 years old\""
+	.section	.text.unlikely
+.LCOLDB36:
+	.text
+.LHOTB36:
+	.p2align 4
+	.globl	_Z18test_format_stringv
+	.type	_Z18test_format_stringv, @function
+_Z18test_format_stringv:
+.LFB6765:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6765
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movl	$23, %r13d
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	xorl	%r12d, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$200, %rsp
+	.cfi_def_cfa_offset 256
+	movdqa	.LC3(%rip), %xmm1
+	movaps	%xmm1, 96(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r14
+	testq	%r14, %r14
+	je	.L1369
+.L1039:
+	leaq	.LC8(%rip), %rdx
+	pxor	%xmm0, %xmm0
+	movl	$36, %esi
+	movq	%r14, 112(%rsp)
+	movq	%rdx, %rdi
+	movups	%xmm0, 120(%rsp)
+	movq	$0, 136(%rsp)
+	call	strchrnul@PLT
+	leaq	.LC8(%rip), %rdx
+	movq	%rax, %rbx
+	movq	%rax, 40(%rsp)
+	movzbl	(%rax), %eax
+	subq	%rdx, %rbx
+	testb	%al, %al
+	jne	.L1043
+	jmp	.L1044
+	.p2align 4,,10
+	.p2align 3
+.L1046:
+	addq	$1, %rbx
+	movzbl	(%rdx,%rbx), %eax
+	testb	%al, %al
+	je	.L1045
+.L1043:
+	cmpb	$36, %al
+	jne	.L1046
+	leaq	1(%rdx,%rbx), %rax
+	movq	%rax, 40(%rsp)
+.L1044:
+	leaq	(%rbx,%r12), %rax
+	xorl	%r15d, %r15d
+	cmpq	$23, %r13
+	je	.L1370
+.L1048:
+	leaq	(%r15,%r12), %rcx
+	cmpq	%rcx, %rdx
+	jb	.L1050
+	cmpq	%rax, %r13
+	jnb	.L1240
+.L1235:
+	leaq	10(%r13,%r13), %rdx
+	movq	%r14, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 8(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r14), %rax
+.LEHB52:
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L1052
+	movq	(%r14), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L1052:
+	movq	8(%rsp), %rax
+	movq	%rbp, 120(%rsp)
+	movq	%rax, 104(%rsp)
+.L1051:
+	cmpq	$23, 8(%rsp)
+	leaq	.LC8(%rip), %rsi
+	je	.L1371
+.L1056:
+	movq	%rbx, %rdx
+	leaq	0(%rbp,%r12), %rdi
+	leaq	.LC9(%rip), %r13
+	call	memmove@PLT
+	addq	96(%rsp), %rbx
+	movl	$4096, %esi
+	movq	%r13, %rdi
+	movq	%rbx, 96(%rsp)
+	movb	$0, 0(%rbp,%rbx)
+	call	strnlen@PLT
+	movq	%rax, %rbx
+	leaq	0(%r13,%rax), %r15
+	leaq	120(%rsp), %rax
+	movq	%rax, 8(%rsp)
+	testq	%rbx, %rbx
+	jne	.L1058
+	jmp	.L1074
+	.p2align 4,,10
+	.p2align 3
+.L1373:
+	leaq	(%r14,%r12), %rdx
+	cmpq	%rdx, %r13
+	jnb	.L1062
+	subq	%r14, %r13
+	movq	%r13, 16(%rsp)
+	cmpq	%rax, %rbp
+	jnb	.L1067
+	leaq	10(%rbp,%rbp), %rdx
+	movq	112(%rsp), %r13
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r13, %rdi
+	movl	$1, %edx
+	movq	%rax, 32(%rsp)
+	leaq	1(%rax), %rsi
+	movq	0(%r13), %rax
+	call	*16(%rax)
+.LEHE52:
+	movq	%rax, 24(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L1068
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	0(%r13), %rax
+	leaq	1(%rbp), %rdx
+	movq	%r13, %rdi
+	movq	120(%rsp), %rsi
+	movl	$1, %ecx
+.LEHB53:
+	call	*24(%rax)
+.LEHE53:
+.L1069:
+	movq	24(%rsp), %rax
+	movq	%rax, 120(%rsp)
+	movq	32(%rsp), %rax
+	movq	%rax, 104(%rsp)
+	movq	%rax, %rbp
+.L1067:
+	cmpq	$23, %rbp
+	je	.L1372
+	movq	120(%rsp), %rbp
+	movq	16(%rsp), %r13
+	addq	%rbp, %r13
+.L1072:
+	movq	%rbx, %rdx
+	leaq	0(%rbp,%r12), %rdi
+	movq	%r13, %rsi
+	call	memmove@PLT
+	addq	96(%rsp), %rbx
+	movq	%rbx, 96(%rsp)
+	movb	$0, 0(%rbp,%rbx)
+.L1364:
+	movl	$4096, %esi
+	movq	%r15, %rdi
+	call	strnlen@PLT
+	movq	%rax, %rbx
+	leaq	(%r15,%rax), %rax
+	testq	%rbx, %rbx
+	je	.L1074
+	movq	%r15, %r13
+	movq	%rax, %r15
+.L1058:
+	movq	104(%rsp), %rbp
+	movq	8(%rsp), %r14
+	cmpq	$23, %rbp
+	je	.L1061
+	movq	120(%rsp), %r14
+.L1061:
+	movq	96(%rsp), %r12
+	leaq	(%rbx,%r12), %rax
+	cmpq	%r14, %r13
+	jnb	.L1373
+.L1062:
+	cmpq	%rax, %rbp
+	jnb	.L1064
+	leaq	10(%rbp,%rbp), %rdx
+	movq	112(%rsp), %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%rdi, 32(%rsp)
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%rdi), %rax
+.LEHB54:
+	call	*16(%rax)
+.LEHE54:
+	movq	%rax, 16(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L1065
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	32(%rsp), %rdi
+	movq	120(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB55:
+	call	*24(%rax)
+.LEHE55:
+.L1066:
+	movq	16(%rsp), %rax
+	movq	%rax, 120(%rsp)
+	movq	24(%rsp), %rax
+	movq	%rax, 104(%rsp)
+	movq	%rax, %rbp
+.L1064:
+	cmpq	$23, %rbp
+	je	.L1295
+	movq	120(%rsp), %rbp
+	jmp	.L1072
+	.p2align 4,,10
+	.p2align 3
+.L1050:
+	subq	%r15, %rdx
+	movq	%rdx, 8(%rsp)
+	cmpq	%rax, %r13
+	jnb	.L1241
+	leaq	10(%r13,%r13), %rdx
+	movq	%r14, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 16(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r14), %rax
+.LEHB56:
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L1054
+	movq	(%r14), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L1054:
+	movq	16(%rsp), %rax
+	movq	%rbp, 120(%rsp)
+	movq	%rax, 104(%rsp)
+	movq	%rax, %r13
+.L1053:
+	cmpq	$23, %r13
+	jne	.L1362
+	leaq	120(%rsp), %rbp
+.L1362:
+	movq	8(%rsp), %rsi
+	addq	%rbp, %rsi
+	jmp	.L1056
+	.p2align 4,,10
+	.p2align 3
+.L1295:
+	movq	8(%rsp), %rbp
+.L1071:
+	movq	%rbx, %rdx
+	leaq	0(%rbp,%r12), %rdi
+	movq	%r13, %rsi
+	call	memmove@PLT
+	addq	96(%rsp), %rbx
+	movq	%rbx, 96(%rsp)
+	movb	$0, 120(%rsp,%rbx)
+	jmp	.L1364
+	.p2align 4,,10
+	.p2align 3
+.L1065:
+	movq	%rax, %rdi
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L1066
+	.p2align 4,,10
+	.p2align 3
+.L1074:
+	movq	40(%rsp), %rdi
+	movq	$-1, %rsi
+	leaq	120(%rsp), %r13
+	call	strnlen@PLT
+	movq	104(%rsp), %rbp
+	movq	%rax, %rbx
+	cmpq	$23, %rbp
+	je	.L1059
+	movq	120(%rsp), %r13
+.L1059:
+	movq	96(%rsp), %r12
+	movq	40(%rsp), %rcx
+	leaq	(%rbx,%r12), %r15
+	cmpq	%r13, %rcx
+	jb	.L1075
+	leaq	0(%r13,%r12), %rax
+	cmpq	%rax, %rcx
+	jnb	.L1075
+	movq	%rcx, %rax
+	subq	%r13, %rax
+	movq	%rax, 8(%rsp)
+	cmpq	%r15, %rbp
+	jnb	.L1080
+	leaq	10(%rbp,%rbp), %r14
+	movl	$1, %edx
+	cmpq	%r15, %r14
+	cmovb	%r15, %r14
+	movq	112(%rsp), %r15
+	movq	(%r15), %rax
+	leaq	1(%r14), %rsi
+	movq	%r15, %rdi
+	call	*16(%rax)
+.LEHE56:
+	movq	%rax, 16(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L1081
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	movq	120(%rsp), %rsi
+	movq	%r15, %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+.LEHB57:
+	call	*24(%rax)
+.LEHE57:
+.L1082:
+	movq	16(%rsp), %rax
+	movq	%r14, 104(%rsp)
+	movq	%r14, %rbp
+	movq	%rax, 120(%rsp)
+.L1080:
+	cmpq	$23, %rbp
+	je	.L1374
+	movq	120(%rsp), %rbp
+	movq	8(%rsp), %rax
+	addq	%rbp, %rax
+	movq	%rax, 40(%rsp)
+	jmp	.L1085
+	.p2align 4,,10
+	.p2align 3
+.L1075:
+	cmpq	%r15, %rbp
+	jnb	.L1077
+	leaq	10(%rbp,%rbp), %rax
+	movq	112(%rsp), %r14
+	movl	$1, %edx
+	cmpq	%r15, %rax
+	cmovnb	%rax, %r15
+	movq	(%r14), %rax
+	movq	%r14, %rdi
+	leaq	1(%r15), %rsi
+.LEHB58:
+	call	*16(%rax)
+.LEHE58:
+	movq	%rax, 8(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L1078
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r14), %rax
+	movq	120(%rsp), %rsi
+	movq	%r14, %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+.LEHB59:
+	call	*24(%rax)
+.LEHE59:
+.L1079:
+	movq	8(%rsp), %rax
+	movq	%r15, 104(%rsp)
+	movq	%r15, %rbp
+	movq	%rax, 120(%rsp)
+.L1077:
+	leaq	120(%rsp), %r13
+	cmpq	$23, %rbp
+	je	.L1084
+	movq	120(%rsp), %rbp
+.L1085:
+	movq	%rbp, %r13
+.L1084:
+	movq	40(%rsp), %rsi
+	movq	%rbx, %rdx
+	leaq	0(%r13,%r12), %rdi
+	call	memmove@PLT
+	addq	96(%rsp), %rbx
+	leaq	120(%rsp), %rdx
+	movq	%rbx, 96(%rsp)
+	movb	$0, 0(%r13,%rbx)
+	movq	104(%rsp), %rcx
+	movq	96(%rsp), %rax
+	movq	%rcx, 16(%rsp)
+	cmpq	$23, %rcx
+	je	.L1086
+	movq	120(%rsp), %rdx
+.L1086:
+	cmpq	$13, %rax
+	jne	.L1090
+	movabsq	$8583909746840200520, %rax
+	cmpq	%rax, (%rdx)
+	jne	.L1090
+	movabsq	$2406167339674837036, %rax
+	cmpq	%rax, 5(%rdx)
+	jne	.L1090
+	movdqa	.LC3(%rip), %xmm7
+	movaps	%xmm7, 144(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r15
+	testq	%r15, %r15
+	je	.L1093
+	xorl	%r12d, %r12d
+	movl	$23, %r13d
+.L1094:
+	leaq	.LC10(%rip), %rbp
+	pxor	%xmm0, %xmm0
+	movl	$36, %esi
+	movq	%r15, 160(%rsp)
+	movq	%rbp, %rdi
+	movups	%xmm0, 168(%rsp)
+	movq	$0, 184(%rsp)
+	call	strchrnul@PLT
+	movq	%rax, %rbx
+	movq	%rax, %r14
+	movzbl	(%rax), %eax
+	subq	%rbp, %rbx
+	testb	%al, %al
+	jne	.L1098
+	jmp	.L1099
+	.p2align 4,,10
+	.p2align 3
+.L1101:
+	addq	$1, %rbx
+	movzbl	0(%rbp,%rbx), %eax
+	testb	%al, %al
+	je	.L1100
+.L1098:
+	cmpb	$36, %al
+	jne	.L1101
+	leaq	1(%rbp,%rbx), %r14
+.L1099:
+	movq	$0, 8(%rsp)
+	leaq	(%rbx,%r12), %rax
+	cmpq	$23, %r13
+	je	.L1375
+.L1103:
+	movq	8(%rsp), %rcx
+	leaq	(%rcx,%r12), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L1376
+	subq	%rcx, %rbp
+	movq	%rbp, 24(%rsp)
+	cmpq	%rax, %r13
+	jnb	.L1250
+	leaq	10(%r13,%r13), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 32(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+.LEHB60:
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%r12), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L1109
+	movq	(%r15), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L1109:
+	movq	32(%rsp), %rax
+	movq	%rbp, 168(%rsp)
+	movq	%rax, 152(%rsp)
+	movq	%rax, %r13
+.L1108:
+	cmpq	$23, %r13
+	je	.L1110
+	movq	24(%rsp), %rax
+	addq	%rbp, %rax
+	.p2align 4,,10
+	.p2align 3
+.L1111:
+	movq	%rbx, %rdx
+	leaq	0(%rbp,%r12), %rdi
+	movq	%rax, %rsi
+	call	memmove@PLT
+	addq	144(%rsp), %rbx
+	leaq	64(%rsp), %rcx
+	movzwl	.LC15(%rip), %eax
+	movq	%rbx, 144(%rsp)
+	movq	%rcx, 8(%rsp)
+	movb	$0, 0(%rbp,%rbx)
+	movw	%ax, 64(%rsp)
+	movl	$2, %eax
+	.p2align 4,,10
+	.p2align 3
+.L1113:
+	movq	8(%rsp), %rcx
+	movq	144(%rsp), %rbx
+	leaq	-1(%rax), %r12
+	movq	152(%rsp), %rbp
+	movzbl	-1(%rcx,%rax), %r13d
+	cmpq	%rbp, %rbx
+	je	.L1377
+.L1114:
+	cmpq	$23, %rbp
+	je	.L1117
+	movq	168(%rsp), %rdx
+	movb	%r13b, (%rdx,%rbx)
+	movq	144(%rsp), %rax
+	leaq	1(%rax), %rcx
+	movq	%rcx, 144(%rsp)
+	movb	$0, 1(%rdx,%rax)
+	testq	%r12, %r12
+	je	.L1119
+.L1118:
+	movl	$1, %eax
+	jmp	.L1113
+	.p2align 4,,10
+	.p2align 3
+.L1372:
+	movq	16(%rsp), %r13
+	leaq	120(%rsp), %rbp
+	addq	%rbp, %r13
+	jmp	.L1071
+	.p2align 4,,10
+	.p2align 3
+.L1068:
+	movq	%rax, %rdi
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L1069
+	.p2align 4,,10
+	.p2align 3
+.L1045:
+	leaq	(%rdx,%rbx), %rax
+	xorl	%r15d, %r15d
+	movq	%rax, 40(%rsp)
+	leaq	(%rbx,%r12), %rax
+	cmpq	$23, %r13
+	jne	.L1048
+.L1370:
+	leaq	120(%rsp), %rbp
+	cmpq	%rbp, %rdx
+	jnb	.L1378
+	movq	%rbp, %r15
+	cmpq	$23, %rax
+	ja	.L1235
+	leaq	.LC8(%rip), %rsi
+	jmp	.L1056
+.L1241:
+	xorl	%ebp, %ebp
+	jmp	.L1053
+.L1374:
+	movq	8(%rsp), %rax
+	leaq	120(%rsp), %rbp
+	movq	%rbp, %r13
+	addq	%rbp, %rax
+	movq	%rax, 40(%rsp)
+	jmp	.L1084
+	.p2align 4,,10
+	.p2align 3
+.L1369:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1379
+.L1041:
+	movq	_ZZN1n4heapEvE3res(%rip), %r14
+	movq	104(%rsp), %r13
+	movq	96(%rsp), %r12
+	jmp	.L1039
+	.p2align 4,,10
+	.p2align 3
+.L1078:
+	movq	%rax, %rdi
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L1079
+	.p2align 4,,10
+	.p2align 3
+.L1371:
+	leaq	120(%rsp), %rbp
+	jmp	.L1056
+	.p2align 4,,10
+	.p2align 3
+.L1240:
+	movq	%r13, 8(%rsp)
+	xorl	%ebp, %ebp
+	jmp	.L1051
+.L1378:
+	movq	%rbp, %r15
+	jmp	.L1048
+.L1379:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1041
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1041
+.L1081:
+	movq	%rax, %rdi
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L1082
+	.p2align 4,,10
+	.p2align 3
+.L1117:
+	movb	%r13b, 168(%rsp,%rbx)
+	movq	144(%rsp), %rax
+	addq	$1, %rax
+	movq	%rax, 144(%rsp)
+	movb	$0, 168(%rsp,%rax)
+	testq	%r12, %r12
+	jne	.L1118
+.L1119:
+	movq	152(%rsp), %rbx
+	leaq	168(%rsp), %r12
+	cmpq	$23, %rbx
+	je	.L1121
+	movq	168(%rsp), %r12
+.L1121:
+	movq	$-1, %rsi
+	movq	%r14, %rdi
+	call	strnlen@PLT
+	movq	144(%rsp), %r13
+	movq	%rax, %rbp
+	leaq	0(%r13,%rax), %rax
+	cmpq	%r12, %r14
+	jb	.L1122
+	leaq	(%r12,%r13), %rdx
+	cmpq	%rdx, %r14
+	jnb	.L1122
+	subq	%r12, %r14
+	movq	%r14, 24(%rsp)
+	cmpq	%rax, %rbx
+	jnb	.L1127
+	leaq	10(%rbx,%rbx), %rdx
+	movq	160(%rsp), %r14
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r14, %rdi
+	movl	$1, %edx
+	movq	%rax, %r15
+	leaq	1(%rax), %rsi
+	movq	(%r14), %rax
+	call	*16(%rax)
+	movq	%rax, 32(%rsp)
+	leaq	1(%r13), %rdx
+	cmpq	$23, %rbx
+	je	.L1128
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r14), %rax
+	leaq	1(%rbx), %rdx
+	movq	%r14, %rdi
+	movq	168(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.LEHE60:
+.L1129:
+	movq	32(%rsp), %rax
+	movq	%r15, 152(%rsp)
+	movq	%r15, %rbx
+	movq	%rax, 168(%rsp)
+.L1127:
+	cmpq	$23, %rbx
+	je	.L1380
+	movq	168(%rsp), %r15
+	movq	24(%rsp), %r14
+	addq	%r15, %r14
+	.p2align 4,,10
+	.p2align 3
+.L1131:
+	movq	%rbp, %rdx
+	leaq	(%r15,%r13), %rdi
+	movq	%r14, %rsi
+	call	memmove@PLT
+	addq	144(%rsp), %rbp
+	cmpq	$23, 16(%rsp)
+	movq	%rbp, 144(%rsp)
+	movb	$0, (%r15,%rbp)
+	je	.L1139
+	movq	112(%rsp), %rdi
+	movq	16(%rsp), %rdx
+	movl	$1, %ecx
+	movq	120(%rsp), %rsi
+	movq	(%rdi), %rax
+	addq	$1, %rdx
+.LEHB61:
+	call	*24(%rax)
+.LEHE61:
+.L1139:
+	movq	160(%rsp), %rax
+	movq	144(%rsp), %rdx
+	movq	152(%rsp), %xmm2
+	movdqa	144(%rsp), %xmm3
+	movq	%rax, 112(%rsp)
+	movq	%xmm2, 56(%rsp)
+	cmpq	$23, 56(%rsp)
+	movaps	%xmm3, 96(%rsp)
+	je	.L1381
+	movq	168(%rsp), %rax
+	movq	%rax, 120(%rsp)
+.L1140:
+	cmpq	$16, %rdx
+	jne	.L1141
+	movabsq	$3617552080742412901, %rdx
+	xorq	8(%rax), %rdx
+	movabsq	$8607344676269549652, %rcx
+	xorq	(%rax), %rcx
+	orq	%rcx, %rdx
+	jne	.L1141
+	movdqa	.LC3(%rip), %xmm7
+	movaps	%xmm7, 144(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r14
+	testq	%r14, %r14
+	je	.L1144
+	xorl	%r12d, %r12d
+	movl	$23, %r13d
+.L1145:
+	leaq	.LC11(%rip), %rbp
+	pxor	%xmm0, %xmm0
+	movl	$36, %esi
+	movq	%r14, 160(%rsp)
+	movq	%rbp, %rdi
+	movups	%xmm0, 168(%rsp)
+	movq	$0, 184(%rsp)
+	call	strchrnul@PLT
+	movq	%rax, %rbx
+	movq	%rax, 40(%rsp)
+	movzbl	(%rax), %eax
+	subq	%rbp, %rbx
+	testb	%al, %al
+	jne	.L1149
+	jmp	.L1150
+	.p2align 4,,10
+	.p2align 3
+.L1152:
+	addq	$1, %rbx
+	movzbl	0(%rbp,%rbx), %eax
+	testb	%al, %al
+	je	.L1151
+.L1149:
+	cmpb	$36, %al
+	jne	.L1152
+	leaq	1(%rbp,%rbx), %rax
+	movq	%rax, 40(%rsp)
+.L1150:
+	leaq	(%rbx,%r12), %rax
+	xorl	%r15d, %r15d
+	cmpq	$23, %r13
+	je	.L1382
+.L1154:
+	leaq	(%r15,%r12), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L1383
+	subq	%r15, %rbp
+	movq	%rbp, 16(%rsp)
+	cmpq	%rax, %r13
+	jnb	.L1256
+	leaq	10(%r13,%r13), %rdx
+	movq	%r14, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r14), %rax
+.LEHB62:
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L1160
+	movq	(%r14), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L1160:
+	movq	24(%rsp), %rax
+	movq	%rbp, 168(%rsp)
+	movq	%rax, 152(%rsp)
+	movq	%rax, %r13
+.L1159:
+	cmpq	$23, %r13
+	je	.L1161
+	movq	16(%rsp), %rax
+	addq	%rbp, %rax
+	.p2align 4,,10
+	.p2align 3
+.L1162:
+	movq	%rbx, %rdx
+	leaq	0(%rbp,%r12), %rdi
+	movq	%rax, %rsi
+	call	memmove@PLT
+	addq	144(%rsp), %rbx
+	movl	$4096, %esi
+	leaq	.LC12(%rip), %r13
+	movq	%rbx, 144(%rsp)
+	movq	%r13, %rdi
+	movb	$0, 0(%rbp,%rbx)
+	call	strnlen@PLT
+	movq	%rax, %rbx
+	leaq	0(%r13,%rax), %r14
+	leaq	168(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	testq	%rbx, %rbx
+	jne	.L1164
+	jmp	.L1180
+	.p2align 4,,10
+	.p2align 3
+.L1385:
+	leaq	(%r15,%r12), %rdx
+	cmpq	%rdx, %r13
+	jnb	.L1168
+	subq	%r15, %r13
+	movq	%r13, 24(%rsp)
+	cmpq	%rax, %rbp
+	jnb	.L1173
+	leaq	10(%rbp,%rbp), %rdx
+	movq	160(%rsp), %r13
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r13, %rdi
+	movl	$1, %edx
+	movq	%rax, 48(%rsp)
+	leaq	1(%rax), %rsi
+	movq	0(%r13), %rax
+	call	*16(%rax)
+	movq	%rax, 32(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L1174
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	0(%r13), %rax
+	leaq	1(%rbp), %rdx
+	movq	%r13, %rdi
+	movq	168(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.L1175:
+	movq	32(%rsp), %rax
+	movq	%rax, 168(%rsp)
+	movq	48(%rsp), %rax
+	movq	%rax, 152(%rsp)
+	movq	%rax, %rbp
+.L1173:
+	cmpq	$23, %rbp
+	je	.L1384
+	movq	168(%rsp), %r15
+	movq	24(%rsp), %r13
+	addq	%r15, %r13
+.L1178:
+	movq	%rbx, %rdx
+	leaq	(%r15,%r12), %rdi
+	movq	%r13, %rsi
+	call	memmove@PLT
+	addq	144(%rsp), %rbx
+	movq	%rbx, 144(%rsp)
+	movb	$0, (%r15,%rbx)
+.L1368:
+	movl	$4096, %esi
+	movq	%r14, %rdi
+	call	strnlen@PLT
+	movq	%rax, %rbx
+	leaq	(%r14,%rax), %rax
+	testq	%rbx, %rbx
+	je	.L1180
+	movq	%r14, %r13
+	movq	%rax, %r14
+.L1164:
+	movq	152(%rsp), %rbp
+	movq	16(%rsp), %r15
+	cmpq	$23, %rbp
+	je	.L1167
+	movq	168(%rsp), %r15
+.L1167:
+	movq	144(%rsp), %r12
+	leaq	(%r12,%rbx), %rax
+	cmpq	%r15, %r13
+	jnb	.L1385
+.L1168:
+	cmpq	%rax, %rbp
+	jnb	.L1170
+	leaq	10(%rbp,%rbp), %rdx
+	movq	160(%rsp), %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%rdi, 48(%rsp)
+	movl	$1, %edx
+	movq	%rax, 32(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, 24(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L1171
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	48(%rsp), %rdi
+	leaq	1(%rbp), %rdx
+	movq	168(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE62:
+.L1172:
+	movq	24(%rsp), %rax
+	movq	%rax, 168(%rsp)
+	movq	32(%rsp), %rax
+	movq	%rax, 152(%rsp)
+	movq	%rax, %rbp
+.L1170:
+	cmpq	$23, %rbp
+	je	.L1296
+	movq	168(%rsp), %r15
+	jmp	.L1178
+	.p2align 4,,10
+	.p2align 3
+.L1296:
+	movq	16(%rsp), %rsi
+.L1177:
+	leaq	(%rsi,%r12), %rdi
+	movq	%rbx, %rdx
+	movq	%r13, %rsi
+	call	memmove@PLT
+	addq	144(%rsp), %rbx
+	movq	%rbx, 144(%rsp)
+	movb	$0, 168(%rsp,%rbx)
+	jmp	.L1368
+	.p2align 4,,10
+	.p2align 3
+.L1377:
+	leaq	1(%rbx), %r15
+	cmpq	%r15, %rbx
+	jnb	.L1114
+	leaq	10(%rbx,%rbx), %rax
+	movq	160(%rsp), %rdi
+	movl	$1, %edx
+	cmpq	%r15, %rax
+	cmovb	%r15, %rax
+	movq	%rdi, 40(%rsp)
+	movq	%rax, 32(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%rdi), %rax
+.LEHB63:
+	call	*16(%rax)
+	movq	%rax, 24(%rsp)
+	cmpq	$23, %rbp
+	je	.L1115
+	movq	168(%rsp), %rsi
+	movq	%r15, %rdx
+	movq	%rax, %rdi
+	movq	%rsi, 48(%rsp)
+	call	memcpy@PLT
+	movq	40(%rsp), %rdi
+	movq	48(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE63:
+.L1116:
+	movq	24(%rsp), %rax
+	movq	%rax, 168(%rsp)
+	movq	32(%rsp), %rax
+	movq	%rax, 152(%rsp)
+	movq	%rax, %rbp
+	jmp	.L1114
+	.p2align 4,,10
+	.p2align 3
+.L1171:
+	movq	%rax, %rdi
+	movq	%r15, %rsi
+	call	memcpy@PLT
+	jmp	.L1172
+	.p2align 4,,10
+	.p2align 3
+.L1180:
+	movq	40(%rsp), %r15
+	movl	$36, %esi
+	movq	%r15, %rdi
+	call	strchrnul@PLT
+	movq	%r15, %rdx
+	movq	%rax, %rbx
+	movq	%rax, %r14
+	movzbl	(%rax), %eax
+	subq	%r15, %rbx
+	testb	%al, %al
+	jne	.L1165
+	jmp	.L1166
+	.p2align 4,,10
+	.p2align 3
+.L1182:
+	addq	$1, %rbx
+	movzbl	(%rdx,%rbx), %eax
+	testb	%al, %al
+	je	.L1181
+.L1165:
+	cmpb	$36, %al
+	jne	.L1182
+	movq	40(%rsp), %rax
+	leaq	1(%rax,%rbx), %r14
+.L1166:
+	movq	152(%rsp), %rbp
+	leaq	168(%rsp), %r13
+	cmpq	$23, %rbp
+	je	.L1184
+	movq	168(%rsp), %r13
+.L1184:
+	movq	144(%rsp), %r12
+	movq	40(%rsp), %rcx
+	leaq	(%r12,%rbx), %rax
+	cmpq	%r13, %rcx
+	jb	.L1185
+	leaq	0(%r13,%r12), %rdx
+	cmpq	%rdx, %rcx
+	jnb	.L1185
+	subq	%r13, %rcx
+	movq	%rcx, 16(%rsp)
+	cmpq	%rax, %rbp
+	jnb	.L1190
+	leaq	10(%rbp,%rbp), %rdx
+	movq	160(%rsp), %r15
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r15, %rdi
+	movl	$1, %edx
+	movq	%rax, 32(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+.LEHB64:
+	call	*16(%rax)
+	movq	%rax, 24(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L1191
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	leaq	1(%rbp), %rdx
+	movq	%r15, %rdi
+	movq	168(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.L1192:
+	movq	24(%rsp), %rax
+	movq	%rax, 168(%rsp)
+	movq	32(%rsp), %rax
+	movq	%rax, 152(%rsp)
+	movq	%rax, %rbp
+.L1190:
+	cmpq	$23, %rbp
+	je	.L1386
+	movq	168(%rsp), %r15
+	movq	16(%rsp), %rax
+	addq	%r15, %rax
+	movq	%rax, 40(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1194:
+	movq	40(%rsp), %rsi
+	movq	%rbx, %rdx
+	leaq	(%r15,%r12), %rdi
+	call	memmove@PLT
+	addq	144(%rsp), %rbx
+	movzwl	.LC18(%rip), %eax
+	movq	%rbx, 144(%rsp)
+	movb	$0, (%r15,%rbx)
+	movw	%ax, 64(%rsp)
+	movl	$2, %eax
+	.p2align 4,,10
+	.p2align 3
+.L1196:
+	movq	8(%rsp), %rcx
+	movq	144(%rsp), %rbx
+	leaq	-1(%rax), %r12
+	movq	152(%rsp), %rbp
+	movzbl	-1(%rcx,%rax), %r13d
+	cmpq	%rbp, %rbx
+	je	.L1387
+.L1197:
+	cmpq	$23, %rbp
+	je	.L1200
+	movq	168(%rsp), %rdx
+	movb	%r13b, (%rdx,%rbx)
+	movq	144(%rsp), %rax
+	leaq	1(%rax), %rcx
+	movq	%rcx, 144(%rsp)
+	movb	$0, 1(%rdx,%rax)
+	testq	%r12, %r12
+	je	.L1202
+.L1201:
+	movl	$1, %eax
+	jmp	.L1196
+	.p2align 4,,10
+	.p2align 3
+.L1200:
+	movb	%r13b, 168(%rsp,%rbx)
+	movq	144(%rsp), %rax
+	addq	$1, %rax
+	movq	%rax, 144(%rsp)
+	movb	$0, 168(%rsp,%rax)
+	testq	%r12, %r12
+	jne	.L1201
+.L1202:
+	movq	152(%rsp), %rbx
+	leaq	168(%rsp), %r12
+	cmpq	$23, %rbx
+	je	.L1204
+	movq	168(%rsp), %r12
+.L1204:
+	movq	$-1, %rsi
+	movq	%r14, %rdi
+	call	strnlen@PLT
+	movq	144(%rsp), %r13
+	movq	%rax, %rbp
+	leaq	(%rax,%r13), %rax
+	cmpq	%r12, %r14
+	jb	.L1205
+	leaq	(%r12,%r13), %rdx
+	cmpq	%rdx, %r14
+	jnb	.L1205
+	subq	%r12, %r14
+	movq	%r14, 8(%rsp)
+	cmpq	%rax, %rbx
+	jnb	.L1210
+	leaq	10(%rbx,%rbx), %rdx
+	movq	160(%rsp), %r14
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r14, %rdi
+	movl	$1, %edx
+	movq	%rax, %r15
+	leaq	1(%rax), %rsi
+	movq	(%r14), %rax
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	leaq	1(%r13), %rdx
+	cmpq	$23, %rbx
+	je	.L1211
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r14), %rax
+	leaq	1(%rbx), %rdx
+	movq	%r14, %rdi
+	movq	168(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.LEHE64:
+.L1212:
+	movq	16(%rsp), %rax
+	movq	%r15, 152(%rsp)
+	movq	%r15, %rbx
+	movq	%rax, 168(%rsp)
+.L1210:
+	cmpq	$23, %rbx
+	je	.L1388
+	movq	168(%rsp), %r15
+	movq	8(%rsp), %r14
+	addq	%r15, %r14
+	.p2align 4,,10
+	.p2align 3
+.L1214:
+	movq	%rbp, %rdx
+	leaq	(%r15,%r13), %rdi
+	movq	%r14, %rsi
+	call	memmove@PLT
+	addq	144(%rsp), %rbp
+	cmpq	$23, 56(%rsp)
+	movq	%rbp, 144(%rsp)
+	movb	$0, (%r15,%rbp)
+	je	.L1221
+	movq	112(%rsp), %rdi
+	movq	56(%rsp), %rdx
+	movl	$1, %ecx
+	movq	120(%rsp), %rsi
+	movq	(%rdi), %rax
+	addq	$1, %rdx
+.LEHB65:
+	call	*24(%rax)
+.LEHE65:
+.L1221:
+	movq	160(%rsp), %rdi
+	movq	152(%rsp), %rdx
+	movdqa	144(%rsp), %xmm4
+	movq	144(%rsp), %rcx
+	movq	%rdi, 112(%rsp)
+	movaps	%xmm4, 96(%rsp)
+	cmpq	$23, %rdx
+	je	.L1389
+	movq	168(%rsp), %rax
+	movq	%rax, 120(%rsp)
+.L1222:
+	cmpq	$20, %rcx
+	jne	.L1223
+	movabsq	$8318818550158471219, %rcx
+	xorq	8(%rax), %rcx
+	movabsq	$2338328219547627338, %rsi
+	xorq	(%rax), %rsi
+	orq	%rsi, %rcx
+	jne	.L1223
+	cmpl	$1684827936, 16(%rax)
+	jne	.L1223
+	cmpq	$23, %rdx
+	je	.L1038
+	movq	(%rdi), %rax
+	movq	120(%rsp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	call	*24(%rax)
+.L1038:
+	addq	$200, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1387:
+	.cfi_restore_state
+	leaq	1(%rbx), %r15
+	cmpq	%r15, %rbx
+	jnb	.L1197
+	leaq	10(%rbx,%rbx), %rax
+	movq	160(%rsp), %rdi
+	movl	$1, %edx
+	cmpq	%r15, %rax
+	cmovb	%r15, %rax
+	movq	%rdi, 32(%rsp)
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%rdi), %rax
+.LEHB66:
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	cmpq	$23, %rbp
+	je	.L1198
+	movq	168(%rsp), %rsi
+	movq	%r15, %rdx
+	movq	%rax, %rdi
+	movq	%rsi, 40(%rsp)
+	call	memcpy@PLT
+	movq	32(%rsp), %rdi
+	movq	40(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1199:
+	movq	16(%rsp), %rax
+	movq	%rax, 168(%rsp)
+	movq	24(%rsp), %rax
+	movq	%rax, 152(%rsp)
+	movq	%rax, %rbp
+	jmp	.L1197
+	.p2align 4,,10
+	.p2align 3
+.L1205:
+	cmpq	%rax, %rbx
+	jnb	.L1207
+	leaq	10(%rbx,%rbx), %rdx
+	movq	160(%rsp), %r15
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r15, %rdi
+	movl	$1, %edx
+	movq	%rax, 16(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	%rax, 8(%rsp)
+	leaq	1(%r13), %rdx
+	cmpq	$23, %rbx
+	je	.L1208
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	leaq	1(%rbx), %rdx
+	movq	%r15, %rdi
+	movq	168(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.L1209:
+	movq	8(%rsp), %rax
+	movq	%rax, 168(%rsp)
+	movq	16(%rsp), %rax
+	movq	%rax, 152(%rsp)
+	movq	%rax, %rbx
+.L1207:
+	leaq	168(%rsp), %r15
+	cmpq	$23, %rbx
+	je	.L1214
+	movq	168(%rsp), %r15
+	jmp	.L1214
+	.p2align 4,,10
+	.p2align 3
+.L1185:
+	cmpq	%rax, %rbp
+	jnb	.L1187
+	leaq	10(%rbp,%rbp), %rdx
+	movq	160(%rsp), %r15
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r15, %rdi
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L1188
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	leaq	1(%rbp), %rdx
+	movq	%r15, %rdi
+	movq	168(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.LEHE66:
+.L1189:
+	movq	16(%rsp), %rax
+	movq	%rax, 168(%rsp)
+	movq	24(%rsp), %rax
+	movq	%rax, 152(%rsp)
+	movq	%rax, %rbp
+.L1187:
+	leaq	168(%rsp), %r15
+	cmpq	$23, %rbp
+	je	.L1194
+	movq	168(%rsp), %r15
+	jmp	.L1194
+	.p2align 4,,10
+	.p2align 3
+.L1122:
+	cmpq	%rax, %rbx
+	jnb	.L1124
+	leaq	10(%rbx,%rbx), %rdx
+	movq	160(%rsp), %r15
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r15, %rdi
+	movl	$1, %edx
+	movq	%rax, 32(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+.LEHB67:
+	call	*16(%rax)
+	movq	%rax, 24(%rsp)
+	leaq	1(%r13), %rdx
+	cmpq	$23, %rbx
+	je	.L1125
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	leaq	1(%rbx), %rdx
+	movq	%r15, %rdi
+	movq	168(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.L1126:
+	movq	24(%rsp), %rax
+	movq	%rax, 168(%rsp)
+	movq	32(%rsp), %rax
+	movq	%rax, 152(%rsp)
+	movq	%rax, %rbx
+.L1124:
+	leaq	168(%rsp), %r15
+	cmpq	$23, %rbx
+	je	.L1131
+	movq	168(%rsp), %r15
+	jmp	.L1131
+	.p2align 4,,10
+	.p2align 3
+.L1384:
+	movq	24(%rsp), %r13
+	leaq	168(%rsp), %rsi
+	addq	%rsi, %r13
+	jmp	.L1177
+	.p2align 4,,10
+	.p2align 3
+.L1376:
+	cmpq	%rax, %r13
+	jnb	.L1249
+.L1234:
+	leaq	10(%r13,%r13), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%r12), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L1107
+	movq	(%r15), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.LEHE67:
+.L1107:
+	movq	24(%rsp), %rax
+	movq	%rbp, 168(%rsp)
+	movq	%rax, 152(%rsp)
+.L1106:
+	cmpq	$23, 24(%rsp)
+	leaq	.LC10(%rip), %rax
+	leaq	168(%rsp), %rsi
+	jne	.L1111
+.L1365:
+	movq	%rsi, %rbp
+	jmp	.L1111
+	.p2align 4,,10
+	.p2align 3
+.L1383:
+	cmpq	%rax, %r13
+	jnb	.L1255
+.L1233:
+	leaq	10(%r13,%r13), %rdx
+	movq	%r14, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 16(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r14), %rax
+.LEHB68:
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L1158
+	movq	(%r14), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.LEHE68:
+.L1158:
+	movq	16(%rsp), %rax
+	movq	%rbp, 168(%rsp)
+	movq	%rax, 152(%rsp)
+.L1157:
+	cmpq	$23, 16(%rsp)
+	leaq	.LC11(%rip), %rax
+	leaq	168(%rsp), %rsi
+	jne	.L1162
+.L1366:
+	movq	%rsi, %rbp
+	jmp	.L1162
+	.p2align 4,,10
+	.p2align 3
+.L1174:
+	movq	%rax, %rdi
+	movq	%r15, %rsi
+	call	memcpy@PLT
+	jmp	.L1175
+	.p2align 4,,10
+	.p2align 3
+.L1100:
+	leaq	0(%rbp,%rbx), %r14
+	jmp	.L1099
+	.p2align 4,,10
+	.p2align 3
+.L1151:
+	leaq	0(%rbp,%rbx), %rax
+	xorl	%r15d, %r15d
+	movq	%rax, 40(%rsp)
+	leaq	(%rbx,%r12), %rax
+	cmpq	$23, %r13
+	jne	.L1154
+.L1382:
+	leaq	168(%rsp), %rsi
+	cmpq	%rsi, %rbp
+	jnb	.L1390
+	movq	%rsi, %r15
+	cmpq	$23, %rax
+	ja	.L1233
+	leaq	.LC11(%rip), %rax
+	jmp	.L1366
+	.p2align 4,,10
+	.p2align 3
+.L1181:
+	movq	40(%rsp), %rax
+	leaq	(%rax,%rbx), %r14
+	jmp	.L1166
+	.p2align 4,,10
+	.p2align 3
+.L1115:
+	movq	%rax, %rdi
+	leaq	168(%rsp), %rsi
+	movq	%r15, %rdx
+	call	memcpy@PLT
+	jmp	.L1116
+	.p2align 4,,10
+	.p2align 3
+.L1198:
+	movq	%rax, %rdi
+	leaq	168(%rsp), %rsi
+	movq	%r15, %rdx
+	call	memcpy@PLT
+	jmp	.L1199
+	.p2align 4,,10
+	.p2align 3
+.L1375:
+	leaq	168(%rsp), %rsi
+	cmpq	%rsi, %rbp
+	jnb	.L1391
+	cmpq	$23, %rax
+	jbe	.L1265
+	movq	%rsi, 8(%rsp)
+	jmp	.L1234
+	.p2align 4,,10
+	.p2align 3
+.L1389:
+	movq	184(%rsp), %rax
+	movdqu	168(%rsp), %xmm6
+	movq	%rax, 136(%rsp)
+	leaq	120(%rsp), %rax
+	movups	%xmm6, 120(%rsp)
+	jmp	.L1222
+	.p2align 4,,10
+	.p2align 3
+.L1381:
+	movq	184(%rsp), %rax
+	movdqu	168(%rsp), %xmm5
+	movq	%rax, 136(%rsp)
+	leaq	120(%rsp), %rax
+	movups	%xmm5, 120(%rsp)
+	jmp	.L1140
+.L1093:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1392
+.L1096:
+	movq	104(%rsp), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	152(%rsp), %r13
+	movq	144(%rsp), %r12
+	movq	%rax, 16(%rsp)
+	jmp	.L1094
+.L1144:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1393
+.L1147:
+	movq	104(%rsp), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %r14
+	movq	152(%rsp), %r13
+	movq	144(%rsp), %r12
+	movq	%rax, 56(%rsp)
+	jmp	.L1145
+	.p2align 4,,10
+	.p2align 3
+.L1208:
+	movq	%rax, %rdi
+	movq	%r12, %rsi
+	call	memcpy@PLT
+	jmp	.L1209
+	.p2align 4,,10
+	.p2align 3
+.L1125:
+	movq	%rax, %rdi
+	movq	%r12, %rsi
+	call	memcpy@PLT
+	jmp	.L1126
+	.p2align 4,,10
+	.p2align 3
+.L1188:
+	movq	%rax, %rdi
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L1189
+	.p2align 4,,10
+	.p2align 3
+.L1249:
+	movq	%r13, 24(%rsp)
+	xorl	%ebp, %ebp
+	jmp	.L1106
+	.p2align 4,,10
+	.p2align 3
+.L1255:
+	movq	%r13, 16(%rsp)
+	xorl	%ebp, %ebp
+	jmp	.L1157
+.L1265:
+	leaq	.LC10(%rip), %rax
+	jmp	.L1365
+.L1256:
+	xorl	%ebp, %ebp
+	jmp	.L1159
+.L1388:
+	movq	8(%rsp), %r14
+	leaq	168(%rsp), %r15
+	addq	%r15, %r14
+	jmp	.L1214
+.L1386:
+	movq	16(%rsp), %rax
+	leaq	168(%rsp), %r15
+	addq	%r15, %rax
+	movq	%rax, 40(%rsp)
+	jmp	.L1194
+.L1110:
+	movq	24(%rsp), %rax
+	leaq	168(%rsp), %rsi
+	addq	%rsi, %rax
+	jmp	.L1365
+.L1161:
+	movq	16(%rsp), %rax
+	leaq	168(%rsp), %rsi
+	addq	%rsi, %rax
+	jmp	.L1366
+.L1380:
+	movq	24(%rsp), %r14
+	leaq	168(%rsp), %r15
+	addq	%r15, %r14
+	jmp	.L1131
+.L1250:
+	xorl	%ebp, %ebp
+	jmp	.L1108
+.L1391:
+	movq	%rsi, 8(%rsp)
+	jmp	.L1103
+.L1390:
+	movq	%rsi, %r15
+	jmp	.L1154
+.L1393:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1147
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1147
+.L1392:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1096
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1096
+.L1211:
+	movq	%rax, %rdi
+	movq	%r12, %rsi
+	call	memcpy@PLT
+	jmp	.L1212
+.L1191:
+	movq	%rax, %rdi
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L1192
+.L1128:
+	movq	%rax, %rdi
+	movq	%r12, %rsi
+	call	memcpy@PLT
+	jmp	.L1129
+.L1272:
+	movq	%rax, %rbx
+	jmp	.L1219
+.L1268:
+	movq	%rax, %rbx
+	jmp	.L1228
+.L1269:
+	movq	%rax, %rbx
+	jmp	.L1230
+.L1273:
+	movq	%rax, %rbx
+	jmp	.L1088
+.L1271:
+	movq	%rax, %rbx
+	jmp	.L1136
+.L1270:
+	movq	%rax, %rbx
+	jmp	.L1236
+	.section	.gcc_except_table
+.LLSDA6765:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6765-.LLSDACSB6765
+.LLSDACSB6765:
+	.uleb128 .LEHB52-.LFB6765
+	.uleb128 .LEHE52-.LEHB52
+	.uleb128 .L1273-.LFB6765
+	.uleb128 0
+	.uleb128 .LEHB53-.LFB6765
+	.uleb128 .LEHE53-.LEHB53
+	.uleb128 .L1270-.LFB6765
+	.uleb128 0
+	.uleb128 .LEHB54-.LFB6765
+	.uleb128 .LEHE54-.LEHB54
+	.uleb128 .L1273-.LFB6765
+	.uleb128 0
+	.uleb128 .LEHB55-.LFB6765
+	.uleb128 .LEHE55-.LEHB55
+	.uleb128 .L1270-.LFB6765
+	.uleb128 0
+	.uleb128 .LEHB56-.LFB6765
+	.uleb128 .LEHE56-.LEHB56
+	.uleb128 .L1273-.LFB6765
+	.uleb128 0
+	.uleb128 .LEHB57-.LFB6765
+	.uleb128 .LEHE57-.LEHB57
+	.uleb128 .L1270-.LFB6765
+	.uleb128 0
+	.uleb128 .LEHB58-.LFB6765
+	.uleb128 .LEHE58-.LEHB58
+	.uleb128 .L1273-.LFB6765
+	.uleb128 0
+	.uleb128 .LEHB59-.LFB6765
+	.uleb128 .LEHE59-.LEHB59
+	.uleb128 .L1270-.LFB6765
+	.uleb128 0
+	.uleb128 .LEHB60-.LFB6765
+	.uleb128 .LEHE60-.LEHB60
+	.uleb128 .L1271-.LFB6765
+	.uleb128 0
+	.uleb128 .LEHB61-.LFB6765
+	.uleb128 .LEHE61-.LEHB61
+	.uleb128 .L1268-.LFB6765
+	.uleb128 0
+	.uleb128 .LEHB62-.LFB6765
+	.uleb128 .LEHE62-.LEHB62
+	.uleb128 .L1272-.LFB6765
+	.uleb128 0
+	.uleb128 .LEHB63-.LFB6765
+	.uleb128 .LEHE63-.LEHB63
+	.uleb128 .L1271-.LFB6765
+	.uleb128 0
+	.uleb128 .LEHB64-.LFB6765
+	.uleb128 .LEHE64-.LEHB64
+	.uleb128 .L1272-.LFB6765
+	.uleb128 0
+	.uleb128 .LEHB65-.LFB6765
+	.uleb128 .LEHE65-.LEHB65
+	.uleb128 .L1269-.LFB6765
+	.uleb128 0
+	.uleb128 .LEHB66-.LFB6765
+	.uleb128 .LEHE66-.LEHB66
+	.uleb128 .L1272-.LFB6765
+	.uleb128 0
+	.uleb128 .LEHB67-.LFB6765
+	.uleb128 .LEHE67-.LEHB67
+	.uleb128 .L1271-.LFB6765
+	.uleb128 0
+	.uleb128 .LEHB68-.LFB6765
+	.uleb128 .LEHE68-.LEHB68
+	.uleb128 .L1272-.LFB6765
+	.uleb128 0
+.LLSDACSE6765:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6765
+	.type	_Z18test_format_stringv.cold, @function
+_Z18test_format_stringv.cold:
+.LFSB6765:
+.L1090:
+	.cfi_def_cfa_offset 256
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC31(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB69:
+	call	__cxa_throw@PLT
+.L1223:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC35(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE69:
+.L1219:
+	movq	152(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L1138
+	movq	160(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1138:
+	movq	104(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L1232
+	movq	112(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	120(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1232:
+	movq	%rbx, %rdi
+.LEHB70:
+	call	_Unwind_Resume@PLT
+.LEHE70:
+.L1136:
+	movq	152(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L1138
+	movq	160(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L1138
+.L1141:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC33(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB71:
+	call	__cxa_throw@PLT
+.LEHE71:
+.L1228:
+	movq	152(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L1138
+	movq	160(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L1138
+.L1267:
+	movq	%rax, %rbx
+	jmp	.L1138
+.L1230:
+	movq	152(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L1138
+	movq	160(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L1138
+.L1088:
+	movq	104(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L1089
+.L1237:
+	movq	112(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	120(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1089:
+	movq	%rbx, %rdi
+.LEHB72:
+	call	_Unwind_Resume@PLT
+.LEHE72:
+.L1236:
+	movq	104(%rsp), %rax
+	jmp	.L1237
+	.cfi_endproc
+.LFE6765:
+	.section	.gcc_except_table
+.LLSDAC6765:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6765-.LLSDACSBC6765
+.LLSDACSBC6765:
+	.uleb128 .LEHB69-.LCOLDB36
+	.uleb128 .LEHE69-.LEHB69
+	.uleb128 .L1267-.LCOLDB36
+	.uleb128 0
+	.uleb128 .LEHB70-.LCOLDB36
+	.uleb128 .LEHE70-.LEHB70
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB71-.LCOLDB36
+	.uleb128 .LEHE71-.LEHB71
+	.uleb128 .L1267-.LCOLDB36
+	.uleb128 0
+	.uleb128 .LEHB72-.LCOLDB36
+	.uleb128 .LEHE72-.LEHB72
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6765:
+	.section	.text.unlikely
+	.text
+	.size	_Z18test_format_stringv, .-_Z18test_format_stringv
+	.section	.text.unlikely
+	.size	_Z18test_format_stringv.cold, .-_Z18test_format_stringv.cold
+.LCOLDE36:
+	.text
+.LHOTE36:
+	.section	.rodata._ZN1n4test10test_suite7run_allEv.str1.1,"aMS",@progbits,1
+.LC37:
+	.string	"\nSUITE [%s] "
+.LC39:
+	.string	"%s"
+.LC40:
+	.string	"\nTEST [%s] "
+.LC41:
+	.string	" - Result : \033[1;32mPASSED\033[0m"
+.LC42:
+	.string	"\033[1;31merror : %s\033[0m\n"
+.LC43:
+	.string	" - Result : \033[1;31mFAILED\033[0m"
+.LC44:
+	.string	" - Passed : \033[1;32m%d\033[0m\n"
+.LC45:
+	.string	" - Failed : \033[1;31m%d\033[0m\n"
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4test10test_suite7run_allEv
+	.type	_ZN1n4test10test_suite7run_allEv, @function
+_ZN1n4test10test_suite7run_allEv:
+.LFB6762:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6762
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	leaq	.LC37(%rip), %rdx
+	movl	$79, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	16(%rdi), %rcx
+	leaq	16(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L1395
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L1396
+	testb	$4, %cl
+	jne	.L1449
+	testl	%ecx, %ecx
+	je	.L1395
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L1450
+	.p2align 4,,10
+	.p2align 3
+.L1395:
+	movzwl	.LC38(%rip), %r15d
+	movq	%rbx, %rsi
+	leaq	.LC39(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+.LEHB73:
+	call	printf@PLT
+	movl	8(%r12), %esi
+	testl	%esi, %esi
+	jle	.L1416
+	movl	$0, 12(%rsp)
+	xorl	%ebp, %ebp
+	xorl	%r14d, %r14d
+	jmp	.L1410
+	.p2align 4,,10
+	.p2align 3
+.L1453:
+	testb	$4, %dl
+	jne	.L1451
+	testl	%edx, %edx
+	je	.L1401
+	movb	$42, (%rax)
+	testb	$2, %dl
+	jne	.L1452
+	.p2align 4,,10
+	.p2align 3
+.L1401:
+	movq	%rbx, %rsi
+	leaq	.LC39(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+.LEHE73:
+	movq	(%r12), %rax
+.LEHB74:
+	call	*8(%rax,%r13)
+.LEHE74:
+	leaq	.LC41(%rip), %rdi
+	addl	$1, %r14d
+.LEHB75:
+	call	puts@PLT
+.L1406:
+	addq	$1, %rbp
+	cmpl	%ebp, 8(%r12)
+	jle	.L1400
+.L1410:
+	movq	(%r12), %rax
+	movq	%rbp, %r13
+	movq	%rbx, %rdi
+	movl	$79, %esi
+	salq	$4, %r13
+	leaq	.LC40(%rip), %rdx
+	movq	(%rax,%r13), %rcx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L1401
+	movl	$79, %edx
+	subl	%eax, %edx
+	addq	%rbx, %rax
+	cmpl	$8, %edx
+	jb	.L1453
+	movabsq	$3038287259199220266, %rsi
+	leaq	8(%rax), %rdi
+	movl	%edx, %ecx
+	andq	$-8, %rdi
+	movq	%rsi, (%rax)
+	movq	%rsi, -8(%rax,%rcx)
+	subq	%rdi, %rax
+	leal	(%rdx,%rax), %ecx
+	movq	%rsi, %rax
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L1401
+.L1416:
+	movl	$0, 12(%rsp)
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L1400:
+	movabsq	$5917806138674729738, %rax
+	movq	%rbx, %rdi
+	movq	%rax, 16(%rsp)
+	movabsq	$9095440486453792, %rax
+	movq	%rax, 22(%rsp)
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L1411
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L1412
+	testb	$4, %cl
+	jne	.L1454
+	testl	%ecx, %ecx
+	je	.L1411
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L1455
+.L1411:
+	movq	%rbx, %rsi
+	leaq	.LC39(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+	movl	%r14d, %esi
+	leaq	.LC44(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	12(%rsp), %esi
+	leaq	.LC45(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	$10, %edi
+	call	putchar@PLT
+.LEHE75:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L1412:
+	.cfi_restore_state
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L1411
+.L1396:
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L1395
+.L1451:
+	movl	$707406378, (%rax)
+	movl	$707406378, -4(%rax,%rdx)
+	jmp	.L1401
+.L1452:
+	movl	$10794, %ecx
+	movw	%cx, -2(%rax,%rdx)
+	jmp	.L1401
+.L1450:
+	movl	$10794, %edi
+	movw	%di, -2(%rdx,%rcx)
+	jmp	.L1395
+.L1455:
+	movl	$10794, %eax
+	movw	%ax, -2(%rdx,%rcx)
+	jmp	.L1411
+.L1449:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L1395
+.L1454:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L1411
+.L1417:
+	movq	%rax, %rdi
+	movq	%rdx, %rax
+.L1407:
+	subq	$1, %rax
+	jne	.L1448
+	call	__cxa_begin_catch@PLT
+	leaq	.LC42(%rip), %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+.LEHB76:
+	call	printf@PLT
+.LEHE76:
+	call	__cxa_end_catch@PLT
+	leaq	.LC43(%rip), %rdi
+	addl	$1, 12(%rsp)
+.LEHB77:
+	call	puts@PLT
+	jmp	.L1406
+.L1409:
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+.L1448:
+	call	_Unwind_Resume@PLT
+.LEHE77:
+.L1418:
+	movq	%rax, %rbx
+	jmp	.L1409
+	.cfi_endproc
+.LFE6762:
+	.section	.gcc_except_table
+	.align 4
+.LLSDA6762:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT6762-.LLSDATTD6762
+.LLSDATTD6762:
+	.byte	0x1
+	.uleb128 .LLSDACSE6762-.LLSDACSB6762
+.LLSDACSB6762:
+	.uleb128 .LEHB73-.LFB6762
+	.uleb128 .LEHE73-.LEHB73
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB74-.LFB6762
+	.uleb128 .LEHE74-.LEHB74
+	.uleb128 .L1417-.LFB6762
+	.uleb128 0x1
+	.uleb128 .LEHB75-.LFB6762
+	.uleb128 .LEHE75-.LEHB75
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB76-.LFB6762
+	.uleb128 .LEHE76-.LEHB76
+	.uleb128 .L1418-.LFB6762
+	.uleb128 0
+	.uleb128 .LEHB77-.LFB6762
+	.uleb128 .LEHE77-.LEHB77
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6762:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	DW.ref._ZTIPKc-.
+.LLSDATT6762:
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.size	_ZN1n4test10test_suite7run_allEv, .-_ZN1n4test10test_suite7run_allEv
+	.text
+	.p2align 4
+	.globl	_ZeqRKN1n6stringIcEEPKc
+	.type	_ZeqRKN1n6stringIcEEPKc, @function
+_ZeqRKN1n6stringIcEEPKc:
+.LFB6763:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	movq	%rsi, %rdi
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	call	strlen@PLT
+	cmpq	$23, 8(%rbx)
+	movq	(%rbx), %rcx
+	leaq	24(%rbx), %rdi
+	movq	%rax, %rdx
+	je	.L1458
+	movq	24(%rbx), %rdi
+.L1458:
+	xorl	%eax, %eax
+	cmpq	%rcx, %rdx
+	je	.L1464
+.L1456:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1464:
+	.cfi_restore_state
+	movl	$1, %eax
+	testq	%rdx, %rdx
+	je	.L1456
+	movq	%rbp, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	sete	%al
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE6763:
+	.size	_ZeqRKN1n6stringIcEEPKc, .-_ZeqRKN1n6stringIcEEPKc
+	.section	.rodata.str1.1
+.LC46:
+	.string	"Format Library Tests"
+.LC47:
+	.string	"test_format_string"
+.LC48:
+	.string	"test_format_to_string"
+.LC49:
+	.string	"test_format_signed_integral"
+.LC50:
+	.string	"test_format_unsigned_integral"
+.LC51:
+	.string	"test_format_bool"
+	.section	.text.unlikely
+.LCOLDB53:
+	.section	.text.startup,"ax",@progbits
+.LHOTB53:
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB6786:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6786
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$1600, %edi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 64
+.LEHB78:
+	call	_Znam@PLT
+.LEHE78:
+	movq	%rax, %rbx
+	leaq	1600(%rax), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L1466:
+	movq	$0, (%rax)
+	addq	$16, %rax
+	movq	$0, -8(%rax)
+	cmpq	%rdx, %rax
+	jne	.L1466
+	leaq	.LC46(%rip), %rax
+	movq	%rsp, %rdi
+	movq	%rbx, (%rsp)
+	movq	%rax, 16(%rsp)
+	leaq	.LC47(%rip), %rax
+	movq	%rax, (%rbx)
+	leaq	_Z18test_format_stringv(%rip), %rax
+	movq	%rax, 8(%rbx)
+	leaq	.LC48(%rip), %rax
+	movq	%rax, 16(%rbx)
+	leaq	_Z21test_format_to_stringv(%rip), %rax
+	movq	%rax, 24(%rbx)
+	leaq	.LC49(%rip), %rax
+	movq	%rax, 32(%rbx)
+	leaq	_Z27test_format_signed_integralv(%rip), %rax
+	movq	%rax, 40(%rbx)
+	leaq	.LC50(%rip), %rax
+	movq	%rax, 48(%rbx)
+	leaq	_Z29test_format_unsigned_integralv(%rip), %rax
+	movq	%rax, 56(%rbx)
+	leaq	.LC51(%rip), %rax
+	movq	%rax, 64(%rbx)
+	leaq	_Z16test_format_boolv(%rip), %rax
+	movq	%rax, 72(%rbx)
+	movq	.LC52(%rip), %rax
+	movq	%rax, 8(%rsp)
+.LEHB79:
+	call	_ZN1n4test10test_suite7run_allEv
+.LEHE79:
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L1468:
+	.cfi_restore_state
+	movq	%rax, %rbp
+	jmp	.L1467
+	.section	.gcc_except_table
+.LLSDA6786:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6786-.LLSDACSB6786
+.LLSDACSB6786:
+	.uleb128 .LEHB78-.LFB6786
+	.uleb128 .LEHE78-.LEHB78
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB79-.LFB6786
+	.uleb128 .LEHE79-.LEHB79
+	.uleb128 .L1468-.LFB6786
+	.uleb128 0
+.LLSDACSE6786:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6786
+	.type	main.cold, @function
+main.cold:
+.LFSB6786:
+.L1467:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	movq	%rbp, %rdi
+.LEHB80:
+	call	_Unwind_Resume@PLT
+.LEHE80:
+	.cfi_endproc
+.LFE6786:
+	.section	.gcc_except_table
+.LLSDAC6786:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6786-.LLSDACSBC6786
+.LLSDACSBC6786:
+	.uleb128 .LEHB80-.LCOLDB53
+	.uleb128 .LEHE80-.LEHB80
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6786:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	main, .-main
+	.section	.text.unlikely
+	.size	main.cold, .-main.cold
+.LCOLDE53:
+	.section	.text.startup
+.LHOTE53:
+	.weak	_ZTSN1n15memory_resourceE
+	.section	.rodata._ZTSN1n15memory_resourceE,"aG",@progbits,_ZTSN1n15memory_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n15memory_resourceE, @object
+	.size	_ZTSN1n15memory_resourceE, 22
+_ZTSN1n15memory_resourceE:
+	.string	"N1n15memory_resourceE"
+	.weak	_ZTIN1n15memory_resourceE
+	.section	.data.rel.ro._ZTIN1n15memory_resourceE,"awG",@progbits,_ZTIN1n15memory_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n15memory_resourceE, @object
+	.size	_ZTIN1n15memory_resourceE, 16
+_ZTIN1n15memory_resourceE:
+	.quad	_ZTVN10__cxxabiv117__class_type_infoE+16
+	.quad	_ZTSN1n15memory_resourceE
+	.weak	_ZTSN1n13heap_resourceE
+	.section	.rodata._ZTSN1n13heap_resourceE,"aG",@progbits,_ZTSN1n13heap_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n13heap_resourceE, @object
+	.size	_ZTSN1n13heap_resourceE, 20
+_ZTSN1n13heap_resourceE:
+	.string	"N1n13heap_resourceE"
+	.weak	_ZTIN1n13heap_resourceE
+	.section	.data.rel.ro._ZTIN1n13heap_resourceE,"awG",@progbits,_ZTIN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n13heap_resourceE, @object
+	.size	_ZTIN1n13heap_resourceE, 24
+_ZTIN1n13heap_resourceE:
+	.quad	_ZTVN10__cxxabiv120__si_class_type_infoE+16
+	.quad	_ZTSN1n13heap_resourceE
+	.quad	_ZTIN1n15memory_resourceE
+	.weak	_ZTVN1n13heap_resourceE
+	.section	.data.rel.ro.local._ZTVN1n13heap_resourceE,"awG",@progbits,_ZTVN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTVN1n13heap_resourceE, @object
+	.size	_ZTVN1n13heap_resourceE, 48
+_ZTVN1n13heap_resourceE:
+	.quad	0
+	.quad	_ZTIN1n13heap_resourceE
+	.quad	_ZN1n13heap_resourceD1Ev
+	.quad	_ZN1n13heap_resourceD0Ev
+	.quad	_ZN1n13heap_resource8allocateEmm
+	.quad	_ZN1n13heap_resource10deallocateEPvmm
+	.weak	_ZN1n18__current_resourceE
+	.section	.tbss._ZN1n18__current_resourceE,"awTG",@nobits,_ZN1n18__current_resourceE,comdat
+	.align 8
+	.type	_ZN1n18__current_resourceE, @gnu_unique_object
+	.size	_ZN1n18__current_resourceE, 8
+_ZN1n18__current_resourceE:
+	.zero	8
+	.weak	_ZGVZN1n4heapEvE3res
+	.section	.bss._ZGVZN1n4heapEvE3res,"awG",@nobits,_ZGVZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZGVZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZGVZN1n4heapEvE3res, 8
+_ZGVZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE3res
+	.section	.bss._ZZN1n4heapEvE3res,"awG",@nobits,_ZZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZZN1n4heapEvE3res, 8
+_ZZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE7storage
+	.section	.bss._ZZN1n4heapEvE7storage,"awG",@nobits,_ZZN1n4heapEvE7storage,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE7storage, @gnu_unique_object
+	.size	_ZZN1n4heapEvE7storage, 8
+_ZZN1n4heapEvE7storage:
+	.zero	8
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC3:
+	.quad	0
+	.quad	23
+	.section	.rodata.cst2,"aM",@progbits,2
+	.align 2
+.LC15:
+	.byte	50
+	.byte	52
+	.align 2
+.LC18:
+	.byte	48
+	.byte	51
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC24:
+	.byte	57
+	.byte	56
+	.byte	55
+	.byte	54
+	.byte	53
+	.byte	52
+	.byte	51
+	.byte	50
+	.section	.rodata.cst2
+	.align 2
+.LC38:
+	.byte	10
+	.byte	0
+	.section	.rodata.cst8
+	.align 8
+.LC52:
+	.long	5
+	.long	100
+	.hidden	DW.ref._ZTIPKc
+	.weak	DW.ref._ZTIPKc
+	.section	.data.rel.local.DW.ref._ZTIPKc,"awG",@progbits,DW.ref._ZTIPKc,comdat
+	.align 8
+	.type	DW.ref._ZTIPKc, @object
+	.size	DW.ref._ZTIPKc, 8
+DW.ref._ZTIPKc:
+	.quad	_ZTIPKc
+	.hidden	DW.ref.__gxx_personality_v0
+	.weak	DW.ref.__gxx_personality_v0
+	.section	.data.rel.local.DW.ref.__gxx_personality_v0,"awG",@progbits,DW.ref.__gxx_personality_v0,comdat
+	.align 8
+	.type	DW.ref.__gxx_personality_v0, @object
+	.size	DW.ref.__gxx_personality_v0, 8
+DW.ref.__gxx_personality_v0:
+	.quad	__gxx_personality_v0
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,6682 @@
+	.file	"tests-generator.cpp"
+	.text
+	.section	.text._ZN1n13heap_resourceD2Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD2Ev
+	.type	_ZN1n13heap_resourceD2Ev, @function
+_ZN1n13heap_resourceD2Ev:
+.LFB7190:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7190:
+	.size	_ZN1n13heap_resourceD2Ev, .-_ZN1n13heap_resourceD2Ev
+	.weak	_ZN1n13heap_resourceD1Ev
+	.set	_ZN1n13heap_resourceD1Ev,_ZN1n13heap_resourceD2Ev
+	.section	.text._ZN1n13heap_resource10deallocateEPvmm,"axG",@progbits,_ZN1n13heap_resource10deallocateEPvmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource10deallocateEPvmm
+	.type	_ZN1n13heap_resource10deallocateEPvmm, @function
+_ZN1n13heap_resource10deallocateEPvmm:
+.LFB6609:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rcx
+	jbe	.L4
+	movq	%rcx, %rsi
+	jmp	_ZdlPvSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	jmp	_ZdlPv@PLT
+	.cfi_endproc
+.LFE6609:
+	.size	_ZN1n13heap_resource10deallocateEPvmm, .-_ZN1n13heap_resource10deallocateEPvmm
+	.section	.text._ZN1n13heap_resource8allocateEmm,"axG",@progbits,_ZN1n13heap_resource8allocateEmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource8allocateEmm
+	.type	_ZN1n13heap_resource8allocateEmm, @function
+_ZN1n13heap_resource8allocateEmm:
+.LFB6608:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rdx
+	jbe	.L6
+	movq	%rdx, %rsi
+	jmp	_ZnwmSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	jmp	_Znwm@PLT
+	.cfi_endproc
+.LFE6608:
+	.size	_ZN1n13heap_resource8allocateEmm, .-_ZN1n13heap_resource8allocateEmm
+	.section	.text._ZN1n13heap_resourceD0Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD0Ev
+	.type	_ZN1n13heap_resourceD0Ev, @function
+_ZN1n13heap_resourceD0Ev:
+.LFB7192:
+	.cfi_startproc
+	movl	$8, %esi
+	jmp	_ZdlPvm@PLT
+	.cfi_endproc
+.LFE7192:
+	.size	_ZN1n13heap_resourceD0Ev, .-_ZN1n13heap_resourceD0Ev
+	.section	.text._ZN1n13__frame_cacheD2Ev,"axG",@progbits,_ZN1n13__frame_cacheD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13__frame_cacheD2Ev
+	.type	_ZN1n13__frame_cacheD2Ev, @function
+_ZN1n13__frame_cacheD2Ev:
+.LFB6914:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6914
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	leaq	_ZZN1n4heapEvE7storage(%rip), %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movl	$64, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	jmp	.L23
+	.p2align 4,,10
+	.p2align 3
+.L11:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %ecx
+	movq	%r12, %rdx
+	movq	%rbx, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L23:
+	movq	0(%rbp), %rbx
+	testq	%rbx, %rbx
+	je	.L24
+	movq	(%rbx), %rax
+	movq	%rax, 0(%rbp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L11
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L11
+	movq	%r13, %rdi
+	movq	%r15, _ZZN1n4heapEvE7storage(%rip)
+	movq	%r14, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L11
+	.p2align 4,,10
+	.p2align 3
+.L24:
+	addq	$64, %r12
+	addq	$8, %rbp
+	cmpq	$2112, %r12
+	jne	.L23
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE6914:
+	.globl	__gxx_personality_v0
+	.section	.gcc_except_table._ZN1n13__frame_cacheD2Ev,"aG",@progbits,_ZN1n13__frame_cacheD5Ev,comdat
+.LLSDA6914:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6914-.LLSDACSB6914
+.LLSDACSB6914:
+.LLSDACSE6914:
+	.section	.text._ZN1n13__frame_cacheD2Ev,"axG",@progbits,_ZN1n13__frame_cacheD5Ev,comdat
+	.size	_ZN1n13__frame_cacheD2Ev, .-_ZN1n13__frame_cacheD2Ev
+	.weak	_ZN1n13__frame_cacheD1Ev
+	.set	_ZN1n13__frame_cacheD1Ev,_ZN1n13__frame_cacheD2Ev
+	.section	.text.unlikely,"ax",@progbits
+.LCOLDB0:
+	.text
+.LHOTB0:
+	.p2align 4
+	.type	_Z7lettersPZ7lettersPKcE19_Z7lettersPKc.Frame.actor, @function
+_Z7lettersPZ7lettersPKcE19_Z7lettersPKc.Frame.actor:
+.LFB6978:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movzwl	56(%rdi), %eax
+	testb	$1, %al
+	je	.L26
+	cmpw	$7, %ax
+	ja	.L27
+	movl	$170, %edx
+	btq	%rax, %rdx
+	jnc	.L27
+.L28:
+	cmpb	$0, 58(%rbx)
+	jne	.L50
+.L33:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L26:
+	.cfi_restore_state
+	cmpw	$4, %ax
+	je	.L29
+	ja	.L30
+	testw	%ax, %ax
+	jne	.L51
+	movl	$2, %ecx
+	movq	%rdi, 40(%rbx)
+	movb	$0, 59(%rdi)
+	movw	%cx, 56(%rdi)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L30:
+	.cfi_restore_state
+	cmpw	$6, %ax
+	je	.L28
+	jmp	.L27
+	.p2align 4,,10
+	.p2align 3
+.L51:
+	cmpw	$2, %ax
+	jne	.L52
+	movb	$1, 59(%rdi)
+.L29:
+	movq	48(%rbx), %rax
+	cmpb	$0, (%rax)
+	je	.L34
+	leaq	1(%rax), %rdx
+	movq	%rdx, 48(%rbx)
+	movzbl	(%rax), %eax
+	movl	$4, %edx
+	movw	%dx, 56(%rbx)
+	movb	%al, 64(%rbx)
+	leaq	16(%rbx), %rax
+	movq	%rax, 72(%rbx)
+	leaq	64(%rbx), %rax
+	movq	%rax, 16(%rbx)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L50:
+	.cfi_restore_state
+	cmpb	$0, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	je	.L53
+.L35:
+	movq	%fs:264+_ZZN1n8__framesEvE5cache@tpoff, %rax
+	cmpq	$16, %rax
+	je	.L54
+	movq	%fs:8+_ZZN1n8__framesEvE5cache@tpoff, %rdx
+	addq	$1, %rax
+	movq	%rdx, (%rbx)
+	movq	%rbx, %fs:8+_ZZN1n8__framesEvE5cache@tpoff
+	movq	%rax, %fs:264+_ZZN1n8__framesEvE5cache@tpoff
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L34:
+	.cfi_restore_state
+	movl	$6, %eax
+	movq	$0, (%rbx)
+	movw	%ax, 56(%rbx)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L53:
+	.cfi_restore_state
+	movq	%fs:0, %rax
+	leaq	__dso_handle(%rip), %rdx
+	movb	$1, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	leaq	_ZN1n13__frame_cacheD1Ev(%rip), %rdi
+	leaq	_ZZN1n8__framesEvE5cache@tpoff(%rax), %rsi
+	call	__cxa_thread_atexit@PLT
+	jmp	.L35
+	.p2align 4,,10
+	.p2align 3
+.L54:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L55
+.L38:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%rbx, %rsi
+	movl	$16, %ecx
+	movl	$128, %edx
+	movq	(%rdi), %rax
+	movq	24(%rax), %rax
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	jmp	*%rax
+.L55:
+	.cfi_restore_state
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L38
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L38
+.L52:
+	jmp	.L27
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.type	_Z7lettersPZ7lettersPKcE19_Z7lettersPKc.Frame.actor.cold, @function
+_Z7lettersPZ7lettersPKcE19_Z7lettersPKc.Frame.actor.cold:
+.LFSB6978:
+.L27:
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	ud2
+	.cfi_endproc
+.LFE6978:
+	.text
+	.size	_Z7lettersPZ7lettersPKcE19_Z7lettersPKc.Frame.actor, .-_Z7lettersPZ7lettersPKcE19_Z7lettersPKc.Frame.actor
+	.section	.text.unlikely
+	.size	_Z7lettersPZ7lettersPKcE19_Z7lettersPKc.Frame.actor.cold, .-_Z7lettersPZ7lettersPKcE19_Z7lettersPKc.Frame.actor.cold
+.LCOLDE0:
+	.text
+.LHOTE0:
+	.section	.text.unlikely
+.LCOLDB1:
+	.text
+.LHOTB1:
+	.p2align 4
+	.type	_Z7lettersPZ7lettersPKcE19_Z7lettersPKc.Frame.destroy, @function
+_Z7lettersPZ7lettersPKcE19_Z7lettersPKc.Frame.destroy:
+.LFB6979:
+	.cfi_startproc
+	movzwl	56(%rdi), %eax
+	orl	$1, %eax
+	movw	%ax, 56(%rdi)
+	cmpw	$7, %ax
+	ja	.L57
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	cmpb	$0, 58(%rdi)
+	jne	.L71
+.L59:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L71:
+	.cfi_restore_state
+	cmpb	$0, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	je	.L72
+.L60:
+	movq	%fs:264+_ZZN1n8__framesEvE5cache@tpoff, %rax
+	cmpq	$16, %rax
+	je	.L73
+	movq	%fs:8+_ZZN1n8__framesEvE5cache@tpoff, %rdx
+	addq	$1, %rax
+	movq	%rdx, (%rbx)
+	movq	%rbx, %fs:8+_ZZN1n8__framesEvE5cache@tpoff
+	movq	%rax, %fs:264+_ZZN1n8__framesEvE5cache@tpoff
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L72:
+	.cfi_restore_state
+	movq	%fs:0, %rax
+	leaq	__dso_handle(%rip), %rdx
+	movb	$1, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	leaq	_ZN1n13__frame_cacheD1Ev(%rip), %rdi
+	leaq	_ZZN1n8__framesEvE5cache@tpoff(%rax), %rsi
+	call	__cxa_thread_atexit@PLT
+	jmp	.L60
+	.p2align 4,,10
+	.p2align 3
+.L73:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L74
+.L63:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%rbx, %rsi
+	movl	$16, %ecx
+	movl	$128, %edx
+	movq	(%rdi), %rax
+	movq	24(%rax), %rax
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+	jmp	*%rax
+.L74:
+	.cfi_restore_state
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L63
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L63
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.type	_Z7lettersPZ7lettersPKcE19_Z7lettersPKc.Frame.destroy.cold, @function
+_Z7lettersPZ7lettersPKcE19_Z7lettersPKc.Frame.destroy.cold:
+.LFSB6979:
+.L57:
+	ud2
+	.cfi_endproc
+.LFE6979:
+	.text
+	.size	_Z7lettersPZ7lettersPKcE19_Z7lettersPKc.Frame.destroy, .-_Z7lettersPZ7lettersPKcE19_Z7lettersPKc.Frame.destroy
+	.section	.text.unlikely
+	.size	_Z7lettersPZ7lettersPKcE19_Z7lettersPKc.Frame.destroy.cold, .-_Z7lettersPZ7lettersPKcE19_Z7lettersPKc.Frame.destroy.cold
+.LCOLDE1:
+	.text
+.LHOTE1:
+	.section	.text.unlikely
+.LCOLDB2:
+	.text
+.LHOTB2:
+	.p2align 4
+	.type	_Z5evensPZ5evensiE15_Z5evensi.Frame.destroy, @function
+_Z5evensPZ5evensiE15_Z5evensi.Frame.destroy:
+.LFB6973:
+	.cfi_startproc
+	movzwl	52(%rdi), %eax
+	orl	$1, %eax
+	movw	%ax, 52(%rdi)
+	cmpw	$7, %ax
+	ja	.L76
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	cmpb	$0, 54(%rdi)
+	jne	.L90
+.L78:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L90:
+	.cfi_restore_state
+	cmpb	$0, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	je	.L91
+.L79:
+	movq	%fs:264+_ZZN1n8__framesEvE5cache@tpoff, %rax
+	cmpq	$16, %rax
+	je	.L92
+	movq	%fs:8+_ZZN1n8__framesEvE5cache@tpoff, %rdx
+	addq	$1, %rax
+	movq	%rdx, (%rbx)
+	movq	%rbx, %fs:8+_ZZN1n8__framesEvE5cache@tpoff
+	movq	%rax, %fs:264+_ZZN1n8__framesEvE5cache@tpoff
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L91:
+	.cfi_restore_state
+	movq	%fs:0, %rax
+	leaq	__dso_handle(%rip), %rdx
+	movb	$1, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	leaq	_ZN1n13__frame_cacheD1Ev(%rip), %rdi
+	leaq	_ZZN1n8__framesEvE5cache@tpoff(%rax), %rsi
+	call	__cxa_thread_atexit@PLT
+	jmp	.L79
+	.p2align 4,,10
+	.p2align 3
+.L92:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L93
+.L82:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%rbx, %rsi
+	movl	$16, %ecx
+	movl	$128, %edx
+	movq	(%rdi), %rax
+	movq	24(%rax), %rax
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+	jmp	*%rax
+.L93:
+	.cfi_restore_state
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L82
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L82
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.type	_Z5evensPZ5evensiE15_Z5evensi.Frame.destroy.cold, @function
+_Z5evensPZ5evensiE15_Z5evensi.Frame.destroy.cold:
+.LFSB6973:
+.L76:
+	ud2
+	.cfi_endproc
+.LFE6973:
+	.text
+	.size	_Z5evensPZ5evensiE15_Z5evensi.Frame.destroy, .-_Z5evensPZ5evensiE15_Z5evensi.Frame.destroy
+	.section	.text.unlikely
+	.size	_Z5evensPZ5evensiE15_Z5evensi.Frame.destroy.cold, .-_Z5evensPZ5evensiE15_Z5evensi.Frame.destroy.cold
+.LCOLDE2:
+	.text
+.LHOTE2:
+	.section	.text.unlikely
+.LCOLDB3:
+	.text
+.LHOTB3:
+	.p2align 4
+	.type	_Z7squaresPZ7squaresN1n9generatorIiEEE33_Z7squaresN1n9generatorIiEE.Frame.destroy, @function
+_Z7squaresPZ7squaresN1n9generatorIiEEE33_Z7squaresN1n9generatorIiEE.Frame.destroy:
+.LFB6991:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6991
+	movzwl	56(%rdi), %eax
+	orl	$1, %eax
+	movw	%ax, 56(%rdi)
+	cmpw	$7, %ax
+	ja	.L95
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	cmpb	$0, 58(%rdi)
+	je	.L94
+	movq	48(%rdi), %rax
+	testq	%rax, %rax
+	je	.L99
+	subq	$1, 32(%rax)
+	je	.L112
+.L99:
+	cmpb	$0, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	je	.L113
+.L101:
+	movq	%fs:264+_ZZN1n8__framesEvE5cache@tpoff, %rax
+	cmpq	$16, %rax
+	je	.L114
+	movq	%fs:8+_ZZN1n8__framesEvE5cache@tpoff, %rdx
+	addq	$1, %rax
+	movq	%rdx, (%rbx)
+	movq	%rbx, %fs:8+_ZZN1n8__framesEvE5cache@tpoff
+	movq	%rax, %fs:264+_ZZN1n8__framesEvE5cache@tpoff
+.L97:
+.L94:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L112:
+	.cfi_restore_state
+	movq	%rax, %rdi
+	call	*8(%rax)
+	cmpb	$0, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	jne	.L101
+.L113:
+	movq	%fs:0, %rax
+	leaq	__dso_handle(%rip), %rdx
+	movb	$1, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	leaq	_ZN1n13__frame_cacheD1Ev(%rip), %rdi
+	leaq	_ZZN1n8__framesEvE5cache@tpoff(%rax), %rsi
+	call	__cxa_thread_atexit@PLT
+	jmp	.L101
+	.p2align 4,,10
+	.p2align 3
+.L114:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L115
+.L104:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%rbx, %rsi
+	movl	$16, %ecx
+	movl	$128, %edx
+	movq	(%rdi), %rax
+	movq	24(%rax), %rax
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+.LEHB0:
+	jmp	*%rax
+.LEHE0:
+	.p2align 4,,10
+	.p2align 3
+.L115:
+	.cfi_restore_state
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L104
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L104
+	.section	.gcc_except_table,"a",@progbits
+	.align 4
+.LLSDA6991:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT6991-.LLSDATTD6991
+.LLSDATTD6991:
+	.byte	0x1
+	.uleb128 .LLSDACSE6991-.LLSDACSB6991
+.LLSDACSB6991:
+	.uleb128 .LEHB0-.LFB6991
+	.uleb128 .LEHE0-.LEHB0
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6991:
+	.align 4
+	.long	0
+
+.LLSDATT6991:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6991
+	.type	_Z7squaresPZ7squaresN1n9generatorIiEEE33_Z7squaresN1n9generatorIiEE.Frame.destroy.cold, @function
+_Z7squaresPZ7squaresN1n9generatorIiEEE33_Z7squaresN1n9generatorIiEE.Frame.destroy.cold:
+.LFSB6991:
+.L95:
+	ud2
+	.cfi_endproc
+.LFE6991:
+	.section	.gcc_except_table
+	.align 4
+.LLSDAC6991:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATTC6991-.LLSDATTDC6991
+.LLSDATTDC6991:
+	.byte	0x1
+	.uleb128 .LLSDACSEC6991-.LLSDACSBC6991
+.LLSDACSBC6991:
+.LLSDACSEC6991:
+	.align 4
+	.long	0
+
+.LLSDATTC6991:
+	.section	.text.unlikely
+	.text
+	.size	_Z7squaresPZ7squaresN1n9generatorIiEEE33_Z7squaresN1n9generatorIiEE.Frame.destroy, .-_Z7squaresPZ7squaresN1n9generatorIiEEE33_Z7squaresN1n9generatorIiEE.Frame.destroy
+	.section	.text.unlikely
+	.size	_Z7squaresPZ7squaresN1n9generatorIiEEE33_Z7squaresN1n9generatorIiEE.Frame.destroy.cold, .-_Z7squaresPZ7squaresN1n9generatorIiEEE33_Z7squaresN1n9generatorIiEE.Frame.destroy.cold
+.LCOLDE3:
+	.text
+.LHOTE3:
+	.section	.text.unlikely
+.LCOLDB4:
+	.text
+.LHOTB4:
+	.p2align 4
+	.type	_Z5evensPZ5evensiE15_Z5evensi.Frame.actor, @function
+_Z5evensPZ5evensiE15_Z5evensi.Frame.actor:
+.LFB6972:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movzwl	52(%rdi), %eax
+	testb	$1, %al
+	je	.L117
+	cmpw	$7, %ax
+	ja	.L118
+	movl	$170, %edx
+	btq	%rax, %rdx
+	jnc	.L118
+.L119:
+	cmpb	$0, 54(%rbx)
+	jne	.L139
+.L124:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L117:
+	.cfi_restore_state
+	cmpw	$4, %ax
+	je	.L120
+	ja	.L121
+	testw	%ax, %ax
+	jne	.L140
+	movl	$2, %ecx
+	movq	%rdi, 40(%rbx)
+	movb	$0, 55(%rdi)
+	movw	%cx, 52(%rdi)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L121:
+	.cfi_restore_state
+	cmpw	$6, %ax
+	je	.L119
+	jmp	.L118
+	.p2align 4,,10
+	.p2align 3
+.L140:
+	cmpw	$2, %ax
+	jne	.L141
+	xorl	%eax, %eax
+	movb	$1, 55(%rdi)
+	movl	%eax, 60(%rbx)
+	cmpl	%eax, 48(%rbx)
+	jle	.L142
+.L126:
+	movl	%eax, 64(%rbx)
+	leaq	16(%rbx), %rax
+	movl	$4, %edx
+	movq	%rax, 72(%rbx)
+	leaq	64(%rbx), %rax
+	movw	%dx, 52(%rbx)
+	movq	%rax, 16(%rbx)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L139:
+	.cfi_restore_state
+	cmpb	$0, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	je	.L143
+.L127:
+	movq	%fs:264+_ZZN1n8__framesEvE5cache@tpoff, %rax
+	cmpq	$16, %rax
+	je	.L144
+	movq	%fs:8+_ZZN1n8__framesEvE5cache@tpoff, %rdx
+	addq	$1, %rax
+	movq	%rdx, (%rbx)
+	movq	%rbx, %fs:8+_ZZN1n8__framesEvE5cache@tpoff
+	movq	%rax, %fs:264+_ZZN1n8__framesEvE5cache@tpoff
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L142:
+	.cfi_restore_state
+	movl	$6, %eax
+	movq	$0, (%rbx)
+	movw	%ax, 52(%rbx)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L143:
+	.cfi_restore_state
+	movq	%fs:0, %rax
+	leaq	__dso_handle(%rip), %rdx
+	movb	$1, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	leaq	_ZN1n13__frame_cacheD1Ev(%rip), %rdi
+	leaq	_ZZN1n8__framesEvE5cache@tpoff(%rax), %rsi
+	call	__cxa_thread_atexit@PLT
+	jmp	.L127
+	.p2align 4,,10
+	.p2align 3
+.L120:
+	movl	60(%rdi), %eax
+	addl	$2, %eax
+	movl	%eax, 60(%rbx)
+	cmpl	%eax, 48(%rbx)
+	jg	.L126
+	jmp	.L142
+	.p2align 4,,10
+	.p2align 3
+.L144:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L145
+.L130:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%rbx, %rsi
+	movl	$16, %ecx
+	movl	$128, %edx
+	movq	(%rdi), %rax
+	movq	24(%rax), %rax
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	jmp	*%rax
+.L145:
+	.cfi_restore_state
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L130
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L130
+.L141:
+	jmp	.L118
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.type	_Z5evensPZ5evensiE15_Z5evensi.Frame.actor.cold, @function
+_Z5evensPZ5evensiE15_Z5evensi.Frame.actor.cold:
+.LFSB6972:
+.L118:
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	ud2
+	.cfi_endproc
+.LFE6972:
+	.text
+	.size	_Z5evensPZ5evensiE15_Z5evensi.Frame.actor, .-_Z5evensPZ5evensiE15_Z5evensi.Frame.actor
+	.section	.text.unlikely
+	.size	_Z5evensPZ5evensiE15_Z5evensi.Frame.actor.cold, .-_Z5evensPZ5evensiE15_Z5evensi.Frame.actor.cold
+.LCOLDE4:
+	.text
+.LHOTE4:
+	.section	.text.unlikely
+.LCOLDB5:
+	.text
+.LHOTB5:
+	.p2align 4
+	.type	_Z7squaresPZ7squaresN1n9generatorIiEEE33_Z7squaresN1n9generatorIiEE.Frame.actor, @function
+_Z7squaresPZ7squaresN1n9generatorIiEEE33_Z7squaresN1n9generatorIiEE.Frame.actor:
+.LFB6990:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6990
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movzwl	56(%rdi), %eax
+	testb	$1, %al
+	je	.L147
+	cmpw	$7, %ax
+	ja	.L148
+	movl	$170, %edx
+	btq	%rax, %rdx
+	jnc	.L148
+	cmpb	$0, 58(%rbx)
+	je	.L146
+.L192:
+	movq	48(%rbx), %rax
+	testq	%rax, %rax
+	je	.L159
+	subq	$1, 32(%rax)
+	je	.L186
+.L159:
+	cmpb	$0, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	je	.L187
+.L161:
+	movq	%fs:264+_ZZN1n8__framesEvE5cache@tpoff, %rax
+	cmpq	$16, %rax
+	je	.L188
+	movq	%fs:8+_ZZN1n8__framesEvE5cache@tpoff, %rdx
+	addq	$1, %rax
+	movq	%rdx, (%rbx)
+	movq	%rbx, %fs:8+_ZZN1n8__framesEvE5cache@tpoff
+	movq	%rax, %fs:264+_ZZN1n8__framesEvE5cache@tpoff
+.L154:
+.L146:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L147:
+	.cfi_restore_state
+	cmpw	$4, %ax
+	je	.L150
+	ja	.L151
+	testw	%ax, %ax
+	je	.L152
+	cmpw	$2, %ax
+	jne	.L189
+	movb	$1, 59(%rdi)
+.L150:
+	movq	48(%rbx), %rbp
+	testq	%rbp, %rbp
+	je	.L157
+	cmpb	$0, 24(%rbp)
+	jne	.L156
+	movq	0(%rbp), %rax
+	testq	%rax, %rax
+	je	.L157
+	movq	%rbp, %rdi
+.LEHB1:
+	call	*%rax
+.LEHE1:
+	movq	48(%rbx), %rax
+	cmpq	$0, (%rax)
+	setne	24(%rbp)
+	jne	.L190
+.L157:
+	movl	$6, %edx
+	movq	$0, (%rbx)
+	movw	%dx, 56(%rbx)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L151:
+	.cfi_restore_state
+	cmpw	$6, %ax
+	jne	.L191
+	cmpb	$0, 58(%rbx)
+	jne	.L192
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L152:
+	.cfi_restore_state
+	movl	$2, %esi
+	movq	%rdi, 40(%rbx)
+	movb	$0, 59(%rdi)
+	movw	%si, 56(%rdi)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L186:
+	.cfi_restore_state
+	movq	%rax, %rdi
+	call	*8(%rax)
+	cmpb	$0, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	jne	.L161
+.L187:
+	movq	%fs:0, %rax
+	leaq	__dso_handle(%rip), %rdx
+	movb	$1, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	leaq	_ZN1n13__frame_cacheD1Ev(%rip), %rdi
+	leaq	_ZZN1n8__framesEvE5cache@tpoff(%rax), %rsi
+	call	__cxa_thread_atexit@PLT
+	jmp	.L161
+.L190:
+	movq	%rax, %rbp
+.L156:
+	movq	16(%rbp), %rax
+	movb	$0, 24(%rbp)
+	movl	$4, %ecx
+	movl	(%rax), %eax
+	movw	%cx, 56(%rbx)
+	movl	%eax, 64(%rbx)
+	imull	%eax, %eax
+	movl	%eax, 72(%rbx)
+	leaq	72(%rbx), %rax
+	movq	%rax, 16(%rbx)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L188:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L193
+.L164:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%rbx, %rsi
+	movl	$16, %ecx
+	movl	$128, %edx
+	movq	(%rdi), %rax
+	movq	24(%rax), %rax
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LEHB2:
+	jmp	*%rax
+.LEHE2:
+	.p2align 4,,10
+	.p2align 3
+.L193:
+	.cfi_restore_state
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L164
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L164
+.L191:
+	jmp	.L148
+.L189:
+	jmp	.L148
+.L170:
+	movq	%rax, %rdi
+	jmp	.L166
+	.section	.gcc_except_table
+	.align 4
+.LLSDA6990:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT6990-.LLSDATTD6990
+.LLSDATTD6990:
+	.byte	0x1
+	.uleb128 .LLSDACSE6990-.LLSDACSB6990
+.LLSDACSB6990:
+	.uleb128 .LEHB1-.LFB6990
+	.uleb128 .LEHE1-.LEHB1
+	.uleb128 .L170-.LFB6990
+	.uleb128 0x1
+	.uleb128 .LEHB2-.LFB6990
+	.uleb128 .LEHE2-.LEHB2
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6990:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	0
+
+.LLSDATT6990:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6990
+	.type	_Z7squaresPZ7squaresN1n9generatorIiEEE33_Z7squaresN1n9generatorIiEE.Frame.actor.cold, @function
+_Z7squaresPZ7squaresN1n9generatorIiEEE33_Z7squaresN1n9generatorIiEE.Frame.actor.cold:
+.LFSB6990:
+.L148:
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	ud2
+.L166:
+	call	__cxa_begin_catch@PLT
+	cmpb	$0, 59(%rbx)
+	jne	.L167
+.LEHB3:
+	call	__cxa_rethrow@PLT
+.L167:
+	xorl	%eax, %eax
+	movw	$0, 56(%rbx)
+	movq	%rax, (%rbx)
+	call	__cxa_rethrow@PLT
+.LEHE3:
+.L171:
+	movq	%rax, %rbx
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+.LEHB4:
+	call	_Unwind_Resume@PLT
+.LEHE4:
+	.cfi_endproc
+.LFE6990:
+	.section	.gcc_except_table
+	.align 4
+.LLSDAC6990:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATTC6990-.LLSDATTDC6990
+.LLSDATTDC6990:
+	.byte	0x1
+	.uleb128 .LLSDACSEC6990-.LLSDACSBC6990
+.LLSDACSBC6990:
+	.uleb128 .LEHB3-.LCOLDB5
+	.uleb128 .LEHE3-.LEHB3
+	.uleb128 .L171-.LCOLDB5
+	.uleb128 0
+	.uleb128 .LEHB4-.LCOLDB5
+	.uleb128 .LEHE4-.LEHB4
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6990:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	0
+
+.LLSDATTC6990:
+	.section	.text.unlikely
+	.text
+	.size	_Z7squaresPZ7squaresN1n9generatorIiEEE33_Z7squaresN1n9generatorIiEE.Frame.actor, .-_Z7squaresPZ7squaresN1n9generatorIiEEE33_Z7squaresN1n9generatorIiEE.Frame.actor
+	.section	.text.unlikely
+	.size	_Z7squaresPZ7squaresN1n9generatorIiEEE33_Z7squaresN1n9generatorIiEE.Frame.actor.cold, .-_Z7squaresPZ7squaresN1n9generatorIiEEE33_Z7squaresN1n9generatorIiEE.Frame.actor.cold
+.LCOLDE5:
+	.text
+.LHOTE5:
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC6:
+	.string	"kept"
+.LC7:
+	.string	"moved"
+	.section	.text.unlikely
+.LCOLDB10:
+	.text
+.LHOTB10:
+	.p2align 4
+	.type	_Z5wordsPZ5wordsvE15_Z5wordsv.Frame.actor, @function
+_Z5wordsPZ5wordsvE15_Z5wordsv.Frame.actor:
+.LFB6987:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6987
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movzwl	48(%rdi), %eax
+	testb	$1, %al
+	je	.L195
+	cmpw	$9, %ax
+	ja	.L196
+	leaq	.L198(%rip), %rdx
+	movslq	(%rdx,%rax,4), %rax
+	addq	%rdx, %rax
+	jmp	*%rax
+	.section	.rodata
+	.align 4
+	.align 4
+.L198:
+	.long	.L196-.L198
+	.long	.L197-.L198
+	.long	.L196-.L198
+	.long	.L197-.L198
+	.long	.L196-.L198
+	.long	.L200-.L198
+	.long	.L196-.L198
+	.long	.L199-.L198
+	.long	.L196-.L198
+	.long	.L197-.L198
+	.text
+	.p2align 4,,10
+	.p2align 3
+.L199:
+	movq	176(%rdi), %rdx
+	cmpq	$23, %rdx
+	je	.L267
+	movq	184(%rdi), %rdi
+	movq	192(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L267:
+	movq	64(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L197
+	movq	72(%rbx), %rdi
+	movq	80(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L197:
+	cmpb	$0, 50(%rbx)
+	jne	.L359
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L195:
+	.cfi_restore_state
+	cmpw	$8, %ax
+	ja	.L196
+	leaq	.L201(%rip), %rdx
+	movslq	(%rdx,%rax,4), %rax
+	addq	%rdx, %rax
+	jmp	*%rax
+	.section	.rodata
+	.align 4
+	.align 4
+.L201:
+	.long	.L205-.L201
+	.long	.L196-.L201
+	.long	.L204-.L201
+	.long	.L196-.L201
+	.long	.L203-.L201
+	.long	.L196-.L201
+	.long	.L202-.L201
+	.long	.L196-.L201
+	.long	.L197-.L201
+	.text
+	.p2align 4,,10
+	.p2align 3
+.L200:
+	movq	112(%rdi), %rdx
+	cmpq	$23, %rdx
+	je	.L267
+	movq	120(%rdi), %rdi
+	movq	128(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L267
+	.p2align 4,,10
+	.p2align 3
+.L202:
+	movq	176(%rdi), %rdx
+	cmpq	$23, %rdx
+	je	.L268
+	movq	184(%rdi), %rdi
+	movq	192(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L268:
+	movq	64(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L269
+	movq	72(%rbx), %rdi
+	movq	80(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L269:
+	movl	$8, %edx
+	movq	$0, (%rbx)
+	movw	%dx, 48(%rbx)
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L203:
+	.cfi_restore_state
+	movq	112(%rdi), %rdx
+	cmpq	$23, %rdx
+	je	.L246
+	movq	120(%rdi), %rdi
+	movq	128(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L246:
+	movdqa	.LC8(%rip), %xmm0
+	leaq	168(%rbx), %r13
+	movups	%xmm0, 168(%rbx)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbp
+	testq	%rbp, %rbp
+	je	.L247
+	pxor	%xmm0, %xmm0
+	leaq	192(%rbx), %rax
+	leaq	.LC7(%rip), %rsi
+	xorl	%edi, %edi
+	movq	%rbp, 184(%rbx)
+	movq	%rax, %rbp
+	movq	$0, 208(%rbx)
+	movups	%xmm0, 192(%rbx)
+	cmpq	%rax, %rsi
+	jnb	.L301
+.L265:
+	addq	%rbp, %rdi
+	movl	$5, %edx
+	call	memmove@PLT
+	movq	168(%rbx), %rax
+	movl	$6, %ecx
+	leaq	5(%rax), %rdx
+	movq	%rdx, 168(%rbx)
+	movb	$0, 5(%rbp,%rax)
+	movq	%r13, 16(%rbx)
+	movw	%cx, 48(%rbx)
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L204:
+	.cfi_restore_state
+	movdqa	.LC8(%rip), %xmm1
+	movb	$1, 51(%rdi)
+	movups	%xmm1, 56(%rdi)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L207
+	movq	%rax, 72(%rdi)
+	pxor	%xmm0, %xmm0
+	leaq	80(%rdi), %rdx
+	xorl	%ecx, %ecx
+	leaq	.LC6(%rip), %rax
+	movq	$0, 96(%rdi)
+	movq	%rdx, %rbp
+	movups	%xmm0, 80(%rdi)
+	cmpq	%rdx, %rax
+	jb	.L224
+.L356:
+	leaq	.LC6(%rip), %rax
+.L225:
+	movq	%rdx, %rbp
+.L224:
+	movl	(%rax), %eax
+	movdqa	.LC8(%rip), %xmm2
+	leaq	104(%rbx), %r15
+	xorl	%edi, %edi
+	movl	$23, %r12d
+	movl	%eax, 0(%rbp,%rcx)
+	movq	56(%rbx), %rax
+	leaq	4(%rax), %rdx
+	movq	%rdx, 56(%rbx)
+	movb	$0, 4(%rbp,%rax)
+	leaq	16(%rbx), %rax
+	movq	%rax, 8(%rsp)
+	movups	%xmm2, 104(%rbx)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L360
+.L226:
+	pxor	%xmm0, %xmm0
+	movq	%rax, 120(%rbx)
+	movq	56(%rbx), %r13
+	leaq	80(%rbx), %r14
+	cmpq	$23, 64(%rbx)
+	movups	%xmm0, 128(%rbx)
+	movq	$0, 144(%rbx)
+	je	.L231
+	movq	80(%rbx), %r14
+.L231:
+	leaq	(%rdi,%r13), %rdx
+	xorl	%ebp, %ebp
+	cmpq	$23, %r12
+	je	.L361
+.L232:
+	leaq	0(%rbp,%rdi), %rcx
+	cmpq	%rcx, %r14
+	jnb	.L362
+	subq	%rbp, %r14
+	cmpq	%rdx, %r12
+	jnb	.L296
+	leaq	10(%r12,%r12), %r12
+	movq	(%rax), %rcx
+	movq	%rax, %rdi
+	cmpq	%rdx, %r12
+	cmovb	%rdx, %r12
+	movl	$1, %edx
+	leaq	1(%r12), %rsi
+.LEHB5:
+	call	*16(%rcx)
+	movq	%rax, %rbp
+	movq	104(%rbx), %rax
+	cmpq	$23, 112(%rbx)
+	leaq	128(%rbx), %rsi
+	leaq	1(%rax), %rdx
+	je	.L241
+	movq	128(%rbx), %rsi
+.L241:
+	movq	%rbp, %rdi
+	call	memcpy@PLT
+	movq	112(%rbx), %rax
+	cmpq	$23, %rax
+	je	.L242
+	movq	120(%rbx), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	128(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L242:
+	movq	%rbp, 128(%rbx)
+	movq	104(%rbx), %rdi
+	movq	%r12, 112(%rbx)
+.L239:
+	cmpq	$23, %r12
+	jne	.L358
+	leaq	128(%rbx), %rbp
+.L358:
+	addq	%rbp, %r14
+	jmp	.L244
+	.p2align 4,,10
+	.p2align 3
+.L205:
+	movq	%rdi, 40(%rbx)
+	movb	$0, 51(%rdi)
+	movl	$2, %edi
+	movw	%di, 48(%rbx)
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L359:
+	.cfi_restore_state
+	cmpb	$0, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	je	.L363
+.L272:
+	movq	%fs:280+_ZZN1n8__framesEvE5cache@tpoff, %rax
+	cmpq	$16, %rax
+	je	.L364
+.L206:
+	movq	%fs:24+_ZZN1n8__framesEvE5cache@tpoff, %rdx
+	addq	$1, %rax
+	movq	%rdx, (%rbx)
+	movq	%rbx, %fs:24+_ZZN1n8__framesEvE5cache@tpoff
+	movq	%rax, %fs:280+_ZZN1n8__framesEvE5cache@tpoff
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L363:
+	.cfi_restore_state
+	movq	%fs:0, %rax
+	leaq	__dso_handle(%rip), %rdx
+	movb	$1, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	leaq	_ZN1n13__frame_cacheD1Ev(%rip), %rdi
+	leaq	_ZZN1n8__framesEvE5cache@tpoff(%rax), %rsi
+	call	__cxa_thread_atexit@PLT
+	jmp	.L272
+	.p2align 4,,10
+	.p2align 3
+.L362:
+	cmpq	%rdx, %r12
+	jnb	.L295
+.L283:
+	leaq	10(%r12,%r12), %r12
+	movq	(%rax), %rcx
+	movq	%rax, %rdi
+	cmpq	%rdx, %r12
+	cmovb	%rdx, %r12
+	movl	$1, %edx
+	leaq	1(%r12), %rsi
+	call	*16(%rcx)
+	movq	%rax, %rbp
+	movq	104(%rbx), %rax
+	cmpq	$23, 112(%rbx)
+	leaq	128(%rbx), %rsi
+	leaq	1(%rax), %rdx
+	je	.L237
+	movq	128(%rbx), %rsi
+.L237:
+	movq	%rbp, %rdi
+	call	memcpy@PLT
+	movq	112(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L238
+	movq	120(%rbx), %rdi
+	movq	128(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L238:
+	movq	%rbp, 128(%rbx)
+	movq	104(%rbx), %rdi
+	movq	%r12, 112(%rbx)
+.L235:
+	cmpq	$23, %r12
+	je	.L365
+.L244:
+	movq	%r14, %rsi
+	addq	%rbp, %rdi
+	movq	%r13, %rdx
+	call	memmove@PLT
+	movq	8(%rsp), %rax
+	addq	104(%rbx), %r13
+	movl	$4, %esi
+	movq	%r13, 104(%rbx)
+	movb	$0, 0(%rbp,%r13)
+	movq	%rax, 152(%rbx)
+	movw	%si, 48(%rbx)
+	movq	%r15, 16(%rbx)
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L361:
+	.cfi_restore_state
+	leaq	128(%rbx), %rbp
+	cmpq	%rbp, %r14
+	jnb	.L232
+	cmpq	$23, %rdx
+	ja	.L283
+	jmp	.L244
+	.p2align 4,,10
+	.p2align 3
+.L372:
+	cmpq	%rdx, %r12
+	jnb	.L256
+.L285:
+	leaq	10(%r12,%r12), %r12
+	movq	(%rcx), %rax
+	movq	%rcx, %rdi
+	cmpq	%rdx, %r12
+	cmovb	%rdx, %r12
+	movl	$1, %edx
+	leaq	1(%r12), %rsi
+	call	*16(%rax)
+	movq	%rax, %rbp
+	movq	168(%rbx), %rax
+	cmpq	$23, 176(%rbx)
+	leaq	192(%rbx), %rsi
+	leaq	1(%rax), %rdx
+	je	.L258
+	movq	192(%rbx), %rsi
+.L258:
+	movq	%rbp, %rdi
+	call	memcpy@PLT
+	movq	176(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L259
+	movq	184(%rbx), %rdi
+	movq	192(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE5:
+.L259:
+	movq	%rbp, 192(%rbx)
+	movq	168(%rbx), %rdi
+	movq	%r12, 176(%rbx)
+.L256:
+	leaq	.LC7(%rip), %rsi
+	cmpq	$23, %r12
+	jne	.L265
+	leaq	192(%rbx), %rax
+.L301:
+	movq	%rax, %rbp
+	jmp	.L265
+	.p2align 4,,10
+	.p2align 3
+.L364:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L366
+.L275:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%rbx, %rsi
+	movl	$16, %ecx
+	movl	$256, %edx
+	movq	(%rdi), %rax
+	movq	24(%rax), %rax
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LEHB6:
+	jmp	*%rax
+.LEHE6:
+	.p2align 4,,10
+	.p2align 3
+.L207:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L367
+.L212:
+	movq	56(%rbx), %rcx
+	movq	64(%rbx), %r12
+	pxor	%xmm0, %xmm0
+	xorl	%ebp, %ebp
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	$0, 96(%rbx)
+	leaq	.LC6(%rip), %rax
+	leaq	4(%rcx), %rdx
+	movups	%xmm0, 80(%rbx)
+	movq	%rdi, 72(%rbx)
+	cmpq	$23, %r12
+	je	.L368
+.L214:
+	leaq	0(%rbp,%rcx), %rsi
+	cmpq	%rsi, %rax
+	jnb	.L369
+	subq	%rbp, %rax
+	movq	%rax, %r13
+	cmpq	%rdx, %r12
+	jnb	.L291
+	leaq	10(%r12,%r12), %r12
+	movq	(%rdi), %rax
+	cmpq	%rdx, %r12
+	cmovb	%rdx, %r12
+	movl	$1, %edx
+	leaq	1(%r12), %rsi
+.LEHB7:
+	call	*16(%rax)
+	movq	%rax, %rbp
+	movq	56(%rbx), %rax
+	cmpq	$23, 64(%rbx)
+	leaq	80(%rbx), %rsi
+	leaq	1(%rax), %rdx
+	je	.L221
+	movq	80(%rbx), %rsi
+.L221:
+	movq	%rbp, %rdi
+	call	memcpy@PLT
+	movq	64(%rbx), %rax
+	cmpq	$23, %rax
+	je	.L222
+	movq	72(%rbx), %rdi
+	leaq	1(%rax), %rdx
+	movq	80(%rbx), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L222:
+	movq	%rbp, 80(%rbx)
+	movq	56(%rbx), %rcx
+	movq	%r12, 64(%rbx)
+.L219:
+	leaq	0(%rbp,%r13), %rax
+	cmpq	$23, %r12
+	jne	.L224
+	leaq	80(%rbx), %rdx
+	leaq	(%rdx,%r13), %rax
+	jmp	.L225
+.L369:
+	cmpq	%rdx, %r12
+	jnb	.L290
+.L284:
+	leaq	10(%r12,%r12), %r12
+	movq	(%rdi), %rax
+	cmpq	%rdx, %r12
+	cmovb	%rdx, %r12
+	movl	$1, %edx
+	leaq	1(%r12), %rsi
+	call	*16(%rax)
+	movq	%rax, %rbp
+	movq	56(%rbx), %rax
+	cmpq	$23, 64(%rbx)
+	leaq	80(%rbx), %rsi
+	leaq	1(%rax), %rdx
+	je	.L217
+	movq	80(%rbx), %rsi
+.L217:
+	movq	%rbp, %rdi
+	call	memcpy@PLT
+	movq	64(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L218
+	movq	72(%rbx), %rdi
+	movq	80(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE7:
+.L218:
+	movq	%rbp, 80(%rbx)
+	movq	56(%rbx), %rcx
+	movq	%r12, 64(%rbx)
+.L210:
+	leaq	.LC6(%rip), %rax
+	cmpq	$23, %r12
+	jne	.L224
+	leaq	80(%rbx), %rdx
+	jmp	.L356
+	.p2align 4,,10
+	.p2align 3
+.L247:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L370
+.L251:
+	movq	_ZZN1n4heapEvE3res(%rip), %rcx
+	movq	168(%rbx), %rdi
+	pxor	%xmm0, %xmm0
+	xorl	%r8d, %r8d
+	movq	176(%rbx), %r12
+	movups	%xmm0, 192(%rbx)
+	leaq	.LC7(%rip), %rsi
+	movq	%rcx, 184(%rbx)
+	leaq	5(%rdi), %rdx
+	movq	$0, 208(%rbx)
+	cmpq	$23, %r12
+	je	.L371
+.L253:
+	leaq	(%r8,%rdi), %rax
+	cmpq	%rax, %rsi
+	jnb	.L372
+	subq	%r8, %rsi
+	movq	%rsi, %r14
+	cmpq	%rdx, %r12
+	jnb	.L260
+	leaq	10(%r12,%r12), %r12
+	movq	(%rcx), %rax
+	movq	%rcx, %rdi
+	cmpq	%rdx, %r12
+	cmovb	%rdx, %r12
+	movl	$1, %edx
+	leaq	1(%r12), %rsi
+.LEHB8:
+	call	*16(%rax)
+	movq	%rax, %rbp
+	movq	168(%rbx), %rax
+	cmpq	$23, 176(%rbx)
+	leaq	192(%rbx), %rsi
+	leaq	1(%rax), %rdx
+	je	.L262
+	movq	192(%rbx), %rsi
+.L262:
+	movq	%rbp, %rdi
+	call	memcpy@PLT
+	movq	176(%rbx), %rax
+	cmpq	$23, %rax
+	je	.L263
+	movq	184(%rbx), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	192(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE8:
+.L263:
+	movq	%rbp, 192(%rbx)
+	movq	168(%rbx), %rdi
+	movq	%r12, 176(%rbx)
+.L260:
+	leaq	0(%rbp,%r14), %rsi
+	cmpq	$23, %r12
+	jne	.L265
+	leaq	192(%rbx), %rax
+	leaq	(%rax,%r14), %rsi
+	jmp	.L301
+	.p2align 4,,10
+	.p2align 3
+.L360:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L373
+.L228:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	112(%rbx), %r12
+	movq	104(%rbx), %rdi
+	jmp	.L226
+	.p2align 4,,10
+	.p2align 3
+.L365:
+	leaq	128(%rbx), %rbp
+	jmp	.L244
+	.p2align 4,,10
+	.p2align 3
+.L295:
+	xorl	%ebp, %ebp
+	jmp	.L235
+.L291:
+	xorl	%ebp, %ebp
+	jmp	.L219
+.L296:
+	xorl	%ebp, %ebp
+	jmp	.L239
+.L366:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L275
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L275
+.L373:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L228
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L228
+.L367:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L212
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L212
+.L370:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L251
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L251
+.L290:
+	xorl	%ebp, %ebp
+	jmp	.L210
+.L368:
+	leaq	80(%rbx), %rbp
+	cmpq	%rbp, %rax
+	jnb	.L214
+	cmpq	$23, %rdx
+	ja	.L284
+	jmp	.L224
+.L371:
+	leaq	192(%rbx), %rax
+	movq	%rax, %r8
+	cmpq	%rax, %rsi
+	jnb	.L253
+	cmpq	$23, %rdx
+	ja	.L285
+	jmp	.L301
+.L302:
+	movq	%rax, %rdi
+	jmp	.L279
+.L303:
+	movq	%rax, %rbp
+	jmp	.L277
+	.section	.gcc_except_table
+	.align 4
+.LLSDA6987:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT6987-.LLSDATTD6987
+.LLSDATTD6987:
+	.byte	0x1
+	.uleb128 .LLSDACSE6987-.LLSDACSB6987
+.LLSDACSB6987:
+	.uleb128 .LEHB5-.LFB6987
+	.uleb128 .LEHE5-.LEHB5
+	.uleb128 .L303-.LFB6987
+	.uleb128 0x3
+	.uleb128 .LEHB6-.LFB6987
+	.uleb128 .LEHE6-.LEHB6
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB7-.LFB6987
+	.uleb128 .LEHE7-.LEHB7
+	.uleb128 .L302-.LFB6987
+	.uleb128 0x1
+	.uleb128 .LEHB8-.LFB6987
+	.uleb128 .LEHE8-.LEHB8
+	.uleb128 .L303-.LFB6987
+	.uleb128 0x3
+.LLSDACSE6987:
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x7d
+	.align 4
+	.long	0
+
+.LLSDATT6987:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6987
+	.type	_Z5wordsPZ5wordsvE15_Z5wordsv.Frame.actor.cold, @function
+_Z5wordsPZ5wordsvE15_Z5wordsv.Frame.actor.cold:
+.LFSB6987:
+.L196:
+	.cfi_def_cfa_offset 80
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	ud2
+.L277:
+	movq	64(%rbx), %rax
+	cmpq	$23, %rax
+	jne	.L374
+.L278:
+	movq	%rbp, %rdi
+.L279:
+	call	__cxa_begin_catch@PLT
+	cmpb	$0, 51(%rbx)
+	jne	.L280
+.LEHB9:
+	call	__cxa_rethrow@PLT
+.L280:
+	xorl	%eax, %eax
+	movw	$0, 48(%rbx)
+	movq	%rax, (%rbx)
+	call	__cxa_rethrow@PLT
+.LEHE9:
+.L304:
+	movq	%rax, %rbx
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+.LEHB10:
+	call	_Unwind_Resume@PLT
+.LEHE10:
+.L374:
+	movq	72(%rbx), %rdi
+	leaq	1(%rax), %rdx
+	movq	80(%rbx), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L278
+	.cfi_endproc
+.LFE6987:
+	.section	.gcc_except_table
+	.align 4
+.LLSDAC6987:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATTC6987-.LLSDATTDC6987
+.LLSDATTDC6987:
+	.byte	0x1
+	.uleb128 .LLSDACSEC6987-.LLSDACSBC6987
+.LLSDACSBC6987:
+	.uleb128 .LEHB9-.LCOLDB10
+	.uleb128 .LEHE9-.LEHB9
+	.uleb128 .L304-.LCOLDB10
+	.uleb128 0
+	.uleb128 .LEHB10-.LCOLDB10
+	.uleb128 .LEHE10-.LEHB10
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6987:
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x7d
+	.align 4
+	.long	0
+
+.LLSDATTC6987:
+	.section	.text.unlikely
+	.text
+	.size	_Z5wordsPZ5wordsvE15_Z5wordsv.Frame.actor, .-_Z5wordsPZ5wordsvE15_Z5wordsv.Frame.actor
+	.section	.text.unlikely
+	.size	_Z5wordsPZ5wordsvE15_Z5wordsv.Frame.actor.cold, .-_Z5wordsPZ5wordsvE15_Z5wordsv.Frame.actor.cold
+.LCOLDE10:
+	.text
+.LHOTE10:
+	.p2align 4
+	.type	_Z5wordsPZ5wordsvE15_Z5wordsv.Frame.destroy, @function
+_Z5wordsPZ5wordsvE15_Z5wordsv.Frame.destroy:
+.LFB6988:
+	.cfi_startproc
+	orw	$1, 48(%rdi)
+	jmp	_Z5wordsPZ5wordsvE15_Z5wordsv.Frame.actor
+	.cfi_endproc
+.LFE6988:
+	.size	_Z5wordsPZ5wordsvE15_Z5wordsv.Frame.destroy, .-_Z5wordsPZ5wordsvE15_Z5wordsv.Frame.destroy
+	.section	.rodata._ZN1n4test10test_suite7run_allEv.str1.1,"aMS",@progbits,1
+.LC11:
+	.string	"\nSUITE [%s] "
+.LC13:
+	.string	"%s"
+.LC14:
+	.string	"\nTEST [%s] "
+.LC15:
+	.string	" - Result : \033[1;32mPASSED\033[0m"
+.LC16:
+	.string	"\033[1;31merror : %s\033[0m\n"
+.LC17:
+	.string	" - Result : \033[1;31mFAILED\033[0m"
+.LC18:
+	.string	" - Passed : \033[1;32m%d\033[0m\n"
+.LC19:
+	.string	" - Failed : \033[1;31m%d\033[0m\n"
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4test10test_suite7run_allEv
+	.type	_ZN1n4test10test_suite7run_allEv, @function
+_ZN1n4test10test_suite7run_allEv:
+.LFB6967:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6967
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	leaq	.LC11(%rip), %rdx
+	movl	$79, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	16(%rdi), %rcx
+	leaq	16(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L377
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L378
+	testb	$4, %cl
+	jne	.L431
+	testl	%ecx, %ecx
+	je	.L377
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L432
+	.p2align 4,,10
+	.p2align 3
+.L377:
+	movzwl	.LC12(%rip), %r15d
+	movq	%rbx, %rsi
+	leaq	.LC13(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+.LEHB11:
+	call	printf@PLT
+	movl	8(%r12), %esi
+	testl	%esi, %esi
+	jle	.L398
+	movl	$0, 12(%rsp)
+	xorl	%ebp, %ebp
+	xorl	%r14d, %r14d
+	jmp	.L392
+	.p2align 4,,10
+	.p2align 3
+.L435:
+	testb	$4, %dl
+	jne	.L433
+	testl	%edx, %edx
+	je	.L383
+	movb	$42, (%rax)
+	testb	$2, %dl
+	jne	.L434
+	.p2align 4,,10
+	.p2align 3
+.L383:
+	movq	%rbx, %rsi
+	leaq	.LC13(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+.LEHE11:
+	movq	(%r12), %rax
+.LEHB12:
+	call	*8(%rax,%r13)
+.LEHE12:
+	leaq	.LC15(%rip), %rdi
+	addl	$1, %r14d
+.LEHB13:
+	call	puts@PLT
+.L388:
+	addq	$1, %rbp
+	cmpl	%ebp, 8(%r12)
+	jle	.L382
+.L392:
+	movq	(%r12), %rax
+	movq	%rbp, %r13
+	movq	%rbx, %rdi
+	movl	$79, %esi
+	salq	$4, %r13
+	leaq	.LC14(%rip), %rdx
+	movq	(%rax,%r13), %rcx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L383
+	movl	$79, %edx
+	subl	%eax, %edx
+	addq	%rbx, %rax
+	cmpl	$8, %edx
+	jb	.L435
+	movabsq	$3038287259199220266, %rsi
+	leaq	8(%rax), %rdi
+	movl	%edx, %ecx
+	andq	$-8, %rdi
+	movq	%rsi, (%rax)
+	movq	%rsi, -8(%rax,%rcx)
+	subq	%rdi, %rax
+	leal	(%rdx,%rax), %ecx
+	movq	%rsi, %rax
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L383
+.L398:
+	movl	$0, 12(%rsp)
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L382:
+	movabsq	$5917806138674729738, %rax
+	movq	%rbx, %rdi
+	movq	%rax, 16(%rsp)
+	movabsq	$9095440486453792, %rax
+	movq	%rax, 22(%rsp)
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L393
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L394
+	testb	$4, %cl
+	jne	.L436
+	testl	%ecx, %ecx
+	je	.L393
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L437
+.L393:
+	movq	%rbx, %rsi
+	leaq	.LC13(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+	movl	%r14d, %esi
+	leaq	.LC18(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	12(%rsp), %esi
+	leaq	.LC19(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	$10, %edi
+	call	putchar@PLT
+.LEHE13:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L394:
+	.cfi_restore_state
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L393
+.L378:
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L377
+.L433:
+	movl	$707406378, (%rax)
+	movl	$707406378, -4(%rax,%rdx)
+	jmp	.L383
+.L434:
+	movl	$10794, %ecx
+	movw	%cx, -2(%rax,%rdx)
+	jmp	.L383
+.L432:
+	movl	$10794, %edi
+	movw	%di, -2(%rdx,%rcx)
+	jmp	.L377
+.L437:
+	movl	$10794, %eax
+	movw	%ax, -2(%rdx,%rcx)
+	jmp	.L393
+.L431:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L377
+.L436:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L393
+.L399:
+	movq	%rax, %rdi
+	movq	%rdx, %rax
+.L389:
+	subq	$1, %rax
+	jne	.L430
+	call	__cxa_begin_catch@PLT
+	leaq	.LC16(%rip), %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+.LEHB14:
+	call	printf@PLT
+.LEHE14:
+	call	__cxa_end_catch@PLT
+	leaq	.LC17(%rip), %rdi
+	addl	$1, 12(%rsp)
+.LEHB15:
+	call	puts@PLT
+	jmp	.L388
+.L391:
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+.L430:
+	call	_Unwind_Resume@PLT
+.LEHE15:
+.L400:
+	movq	%rax, %rbx
+	jmp	.L391
+	.cfi_endproc
+.LFE6967:
+	.section	.gcc_except_table
+	.align 4
+.LLSDA6967:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT6967-.LLSDATTD6967
+.LLSDATTD6967:
+	.byte	0x1
+	.uleb128 .LLSDACSE6967-.LLSDACSB6967
+.LLSDACSB6967:
+	.uleb128 .LEHB11-.LFB6967
+	.uleb128 .LEHE11-.LEHB11
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB12-.LFB6967
+	.uleb128 .LEHE12-.LEHB12
+	.uleb128 .L399-.LFB6967
+	.uleb128 0x1
+	.uleb128 .LEHB13-.LFB6967
+	.uleb128 .LEHE13-.LEHB13
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB14-.LFB6967
+	.uleb128 .LEHE14-.LEHB14
+	.uleb128 .L400-.LFB6967
+	.uleb128 0
+	.uleb128 .LEHB15-.LFB6967
+	.uleb128 .LEHE15-.LEHB15
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6967:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	DW.ref._ZTIPKc-.
+.LLSDATT6967:
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.size	_ZN1n4test10test_suite7run_allEv, .-_ZN1n4test10test_suite7run_allEv
+	.text
+	.p2align 4
+	.globl	_Z7lettersPKc
+	.type	_Z7lettersPKc, @function
+_Z7lettersPKc:
+.LFB6974:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx
+	cmpb	$0, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	je	.L449
+	movq	%fs:8+_ZZN1n8__framesEvE5cache@tpoff, %rax
+	testq	%rax, %rax
+	je	.L440
+.L450:
+	movq	(%rax), %rdx
+	subq	$1, %fs:264+_ZZN1n8__framesEvE5cache@tpoff
+	movq	%rdx, %fs:8+_ZZN1n8__framesEvE5cache@tpoff
+.L441:
+	leaq	_Z7lettersPZ7lettersPKcE19_Z7lettersPKc.Frame.destroy(%rip), %rdx
+	leaq	_Z7lettersPZ7lettersPKcE19_Z7lettersPKc.Frame.actor(%rip), %rcx
+	movb	$1, 58(%rax)
+	movq	%rdx, %xmm1
+	movq	%rcx, %xmm0
+	movl	$2, %edx
+	movq	%rbp, 48(%rax)
+	punpcklqdq	%xmm1, %xmm0
+	movq	$0, 16(%rax)
+	movb	$0, 24(%rax)
+	movq	$1, 32(%rax)
+	movups	%xmm0, (%rax)
+	movq	%rax, (%rbx)
+	movq	%rax, 40(%rax)
+	movb	$0, 59(%rax)
+	movw	%dx, 56(%rax)
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L449:
+	.cfi_restore_state
+	movq	%fs:0, %rax
+	leaq	__dso_handle(%rip), %rdx
+	movb	$1, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	leaq	_ZN1n13__frame_cacheD1Ev(%rip), %rdi
+	leaq	_ZZN1n8__framesEvE5cache@tpoff(%rax), %rsi
+	call	__cxa_thread_atexit@PLT
+	movq	%fs:8+_ZZN1n8__framesEvE5cache@tpoff, %rax
+	testq	%rax, %rax
+	jne	.L450
+.L440:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L451
+.L443:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %edx
+	movl	$128, %esi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	jmp	.L441
+	.p2align 4,,10
+	.p2align 3
+.L451:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L443
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L443
+	.cfi_endproc
+.LFE6974:
+	.size	_Z7lettersPKc, .-_Z7lettersPKc
+	.section	.rodata.str1.1
+.LC20:
+	.string	"<$>"
+.LC21:
+	.string	"<lazy>"
+.LC22:
+	.string	"lazy"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC23:
+	.string	"expected true : s == n::str(\"<lazy>\")"
+	.section	.text.unlikely
+.LCOLDB24:
+	.text
+.LHOTB24:
+	.p2align 4
+	.globl	_Z21test_generator_formatv
+	.type	_Z21test_generator_formatv, @function
+_Z21test_generator_formatv:
+.LFB7007:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7007
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movl	$23, %r14d
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$136, %rsp
+	.cfi_def_cfa_offset 192
+	movdqa	.LC8(%rip), %xmm1
+	movaps	%xmm1, 32(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r15
+	testq	%r15, %r15
+	je	.L606
+.L453:
+	pxor	%xmm0, %xmm0
+	leaq	80(%rsp), %rdi
+	movq	%r15, 48(%rsp)
+	leaq	.LC22(%rip), %rsi
+	movq	$0, 72(%rsp)
+	movups	%xmm0, 56(%rsp)
+.LEHB16:
+	call	_Z7lettersPKc
+.LEHE16:
+	leaq	.LC20(%rip), %rbp
+	movl	$36, %esi
+	movq	%rbp, %rdi
+	call	strchrnul@PLT
+	movq	%rax, %rbx
+	movq	%rax, %r13
+	movzbl	(%rax), %eax
+	subq	%rbp, %rbx
+	testb	%al, %al
+	jne	.L457
+	jmp	.L458
+	.p2align 4,,10
+	.p2align 3
+.L460:
+	addq	$1, %rbx
+	movzbl	0(%rbp,%rbx), %eax
+	testb	%al, %al
+	je	.L459
+.L457:
+	cmpb	$36, %al
+	jne	.L460
+	leaq	1(%rbp,%rbx), %r13
+.L458:
+	movq	32(%rsp), %r12
+	movq	$0, (%rsp)
+	leaq	(%rbx,%r12), %rdx
+	cmpq	$23, %r14
+	je	.L607
+.L462:
+	movq	(%rsp), %rax
+	addq	%r12, %rax
+	cmpq	%rax, %rbp
+	jb	.L464
+	cmpq	%rdx, %r14
+	jnb	.L539
+.L536:
+	leaq	10(%r14,%r14), %rax
+	movq	%r15, %rdi
+	cmpq	%rdx, %rax
+	cmovnb	%rax, %rdx
+	movq	(%r15), %rax
+	movq	%rdx, 8(%rsp)
+	leaq	1(%rdx), %rsi
+	movl	$1, %edx
+.LEHB17:
+	call	*16(%rax)
+	movq	(%rsp), %rsi
+	leaq	1(%r12), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L466
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.LEHE17:
+.L466:
+	movq	8(%rsp), %rax
+	movq	%rbp, 56(%rsp)
+	movq	%rax, 40(%rsp)
+.L465:
+	cmpq	$23, 8(%rsp)
+	leaq	.LC20(%rip), %rsi
+	leaq	56(%rsp), %rax
+	je	.L602
+.L470:
+	movq	%rbx, %rdx
+	leaq	0(%rbp,%r12), %rdi
+	call	memmove@PLT
+	addq	32(%rsp), %rbx
+	movq	%rbx, 32(%rsp)
+	movb	$0, 0(%rbp,%rbx)
+	movq	80(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L473
+	addq	$1, 32(%rbx)
+	leaq	56(%rsp), %r15
+	jmp	.L474
+	.p2align 4,,10
+	.p2align 3
+.L475:
+	movq	%r15, %rax
+	cmpq	$23, %r12
+	je	.L478
+	movq	56(%rsp), %rax
+.L478:
+	movb	%r14b, (%rax,%rbp)
+	movq	32(%rsp), %rdx
+	leaq	1(%rdx), %rcx
+	movq	%rcx, 32(%rsp)
+	movb	$0, 1(%rax,%rdx)
+.L474:
+	cmpb	$0, 24(%rbx)
+	jne	.L479
+	movq	(%rbx), %rax
+	testq	%rax, %rax
+	je	.L483
+	movq	%rbx, %rdi
+.LEHB18:
+	call	*%rax
+	cmpq	$0, (%rbx)
+	setne	24(%rbx)
+	je	.L483
+.L479:
+	movq	16(%rbx), %rax
+	movq	32(%rsp), %rbp
+	movb	$0, 24(%rbx)
+	movq	40(%rsp), %r12
+	movzbl	(%rax), %r14d
+	cmpq	%r12, %rbp
+	jne	.L475
+	leaq	1(%rbp), %rcx
+	cmpq	%rcx, %rbp
+	jnb	.L475
+	leaq	10(%rbp,%rbp), %rax
+	movq	48(%rsp), %rdi
+	movq	%rcx, 16(%rsp)
+	movl	$1, %edx
+	cmpq	%rcx, %rax
+	cmovb	%rcx, %rax
+	movq	%rdi, 24(%rsp)
+	movq	%rax, 8(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, (%rsp)
+	cmpq	$23, %r12
+	je	.L476
+	movq	56(%rsp), %rsi
+	movq	16(%rsp), %rdx
+	movq	%rax, %rdi
+	movq	%rsi, 16(%rsp)
+	call	memcpy@PLT
+	movq	24(%rsp), %rdi
+	movq	16(%rsp), %rsi
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE18:
+.L477:
+	movq	(%rsp), %rax
+	movq	%rax, 56(%rsp)
+	movq	8(%rsp), %rax
+	movq	%rax, 40(%rsp)
+	movq	%rax, %r12
+	jmp	.L475
+	.p2align 4,,10
+	.p2align 3
+.L464:
+	movq	(%rsp), %rax
+	subq	%rax, %rbp
+	movq	%rbp, 8(%rsp)
+	cmpq	%rdx, %r14
+	jnb	.L540
+	leaq	10(%r14,%r14), %rax
+	movq	%r15, %rdi
+	cmpq	%rdx, %rax
+	cmovnb	%rax, %rdx
+	movq	(%r15), %rax
+	movq	%rdx, 16(%rsp)
+	leaq	1(%rdx), %rsi
+	movl	$1, %edx
+.LEHB19:
+	call	*16(%rax)
+	movq	(%rsp), %rsi
+	leaq	1(%r12), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L468
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.LEHE19:
+.L468:
+	movq	16(%rsp), %rax
+	movq	%rbp, 56(%rsp)
+	movq	%rax, 40(%rsp)
+	movq	%rax, %r14
+.L467:
+	cmpq	$23, %r14
+	je	.L469
+	movq	8(%rsp), %rsi
+	addq	%rbp, %rsi
+	jmp	.L470
+	.p2align 4,,10
+	.p2align 3
+.L483:
+	subq	$1, 32(%rbx)
+	jne	.L473
+	movq	%rbx, %rdi
+	call	*8(%rbx)
+.L473:
+	movq	$-1, %rsi
+	movq	%r13, %rdi
+	leaq	56(%rsp), %r15
+	call	strnlen@PLT
+	movq	40(%rsp), %r12
+	movq	%rax, %rbp
+	cmpq	$23, %r12
+	je	.L484
+	movq	56(%rsp), %r15
+.L484:
+	movq	32(%rsp), %r14
+	leaq	0(%rbp,%r14), %rax
+	cmpq	%r15, %r13
+	jb	.L485
+	leaq	(%r15,%r14), %rdx
+	cmpq	%rdx, %r13
+	jnb	.L485
+	subq	%r15, %r13
+	movq	%r13, (%rsp)
+	cmpq	%rax, %r12
+	jnb	.L490
+	leaq	10(%r12,%r12), %rdx
+	movq	48(%rsp), %r13
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r13, %rdi
+	movl	$1, %edx
+	movq	%rax, 16(%rsp)
+	leaq	1(%rax), %rsi
+	movq	0(%r13), %rax
+.LEHB20:
+	call	*16(%rax)
+	movq	%rax, 8(%rsp)
+	leaq	1(%r14), %rdx
+	cmpq	$23, %r12
+	je	.L491
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	0(%r13), %rax
+	movq	56(%rsp), %rsi
+	movq	%r13, %rdi
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	call	*24(%rax)
+.L492:
+	movq	8(%rsp), %rax
+	movq	%rax, 56(%rsp)
+	movq	16(%rsp), %rax
+	movq	%rax, 40(%rsp)
+	movq	%rax, %r12
+.L490:
+	cmpq	$23, %r12
+	je	.L608
+	movq	56(%rsp), %rsi
+	movq	(%rsp), %r13
+	addq	%rsi, %r13
+	jmp	.L495
+	.p2align 4,,10
+	.p2align 3
+.L485:
+	cmpq	%rax, %r12
+	jnb	.L487
+	leaq	10(%r12,%r12), %rdx
+	movq	48(%rsp), %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%rdi, 16(%rsp)
+	movl	$1, %edx
+	movq	%rax, 8(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, (%rsp)
+	leaq	1(%r14), %rdx
+	cmpq	$23, %r12
+	je	.L488
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	16(%rsp), %rdi
+	movq	56(%rsp), %rsi
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE20:
+.L489:
+	movq	(%rsp), %rax
+	movq	%rax, 56(%rsp)
+	movq	8(%rsp), %rax
+	movq	%rax, 40(%rsp)
+	movq	%rax, %r12
+.L487:
+	leaq	56(%rsp), %r15
+	cmpq	$23, %r12
+	je	.L494
+	movq	56(%rsp), %rsi
+.L495:
+	movq	%rsi, %r15
+.L494:
+	movq	%rbp, %rdx
+	leaq	(%r15,%r14), %rdi
+	movq	%r13, %rsi
+	call	memmove@PLT
+	addq	32(%rsp), %rbp
+	movq	%rbp, 32(%rsp)
+	movb	$0, (%r15,%rbp)
+	testq	%rbx, %rbx
+	je	.L497
+	subq	$1, 32(%rbx)
+	jne	.L497
+	movq	%rbx, %rdi
+	call	*8(%rbx)
+.L497:
+	movdqa	.LC8(%rip), %xmm2
+	movaps	%xmm2, 80(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L502
+	pxor	%xmm0, %xmm0
+	leaq	104(%rsp), %rbx
+	movq	%rax, 96(%rsp)
+	xorl	%ebp, %ebp
+	leaq	.LC21(%rip), %rsi
+	movups	%xmm0, 104(%rsp)
+	movq	$0, 120(%rsp)
+	cmpq	%rbx, %rsi
+	jb	.L503
+.L599:
+	leaq	.LC21(%rip), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L503:
+	leaq	(%rbx,%rbp), %rdi
+	movl	$6, %edx
+	call	memmove@PLT
+	movq	80(%rsp), %rax
+	leaq	6(%rax), %rdx
+	movq	%rdx, 80(%rsp)
+	movq	32(%rsp), %rdx
+	movb	$0, 6(%rbx,%rax)
+	movq	40(%rsp), %rbx
+	movq	88(%rsp), %rbp
+	cmpq	80(%rsp), %rdx
+	je	.L609
+.L516:
+	cmpq	$23, %rbp
+	je	.L528
+	movq	96(%rsp), %rdi
+	movq	104(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L528:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC23(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB21:
+	call	__cxa_throw@PLT
+.LEHE21:
+	.p2align 4,,10
+	.p2align 3
+.L459:
+	leaq	0(%rbp,%rbx), %r13
+	jmp	.L458
+	.p2align 4,,10
+	.p2align 3
+.L607:
+	leaq	56(%rsp), %rax
+	cmpq	%rax, %rbp
+	jnb	.L610
+	cmpq	$23, %rdx
+	jbe	.L553
+	movq	%rax, (%rsp)
+	jmp	.L536
+	.p2align 4,,10
+	.p2align 3
+.L609:
+	cmpq	$23, %rbp
+	je	.L517
+	movq	104(%rsp), %rsi
+	movq	%rsi, %rax
+	cmpq	$23, %rbx
+	je	.L611
+	testq	%rdx, %rdx
+	je	.L519
+	movq	56(%rsp), %rdi
+.L520:
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L516
+	movq	104(%rsp), %rax
+	cmpq	$23, %rbp
+	je	.L529
+.L519:
+	movq	96(%rsp), %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	%rax, %rsi
+	movq	(%rdi), %r8
+	call	*24(%r8)
+.L529:
+	cmpq	$23, %rbx
+	je	.L452
+	movq	56(%rsp), %rsi
+.L525:
+	movq	48(%rsp), %rdi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L452:
+	addq	$136, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L553:
+	.cfi_restore_state
+	leaq	.LC20(%rip), %rsi
+.L602:
+	movq	%rax, %rbp
+	jmp	.L470
+.L540:
+	xorl	%ebp, %ebp
+	jmp	.L467
+.L608:
+	movq	(%rsp), %r13
+	leaq	56(%rsp), %r15
+	addq	%r15, %r13
+	jmp	.L494
+.L611:
+	testq	%rdx, %rdx
+	je	.L519
+.L604:
+	leaq	56(%rsp), %rdi
+	jmp	.L520
+	.p2align 4,,10
+	.p2align 3
+.L502:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L612
+.L507:
+	movq	_ZZN1n4heapEvE3res(%rip), %r14
+	movq	80(%rsp), %rbp
+	pxor	%xmm0, %xmm0
+	xorl	%r15d, %r15d
+	movq	88(%rsp), %r13
+	movups	%xmm0, 104(%rsp)
+	leaq	.LC21(%rip), %rsi
+	movq	%r14, 96(%rsp)
+	leaq	6(%rbp), %r12
+	movq	$0, 120(%rsp)
+	cmpq	$23, %r13
+	je	.L613
+.L509:
+	leaq	(%r15,%rbp), %rax
+	cmpq	%rax, %rsi
+	jnb	.L614
+	subq	%r15, %rsi
+	movq	%rsi, (%rsp)
+	cmpq	%r12, %r13
+	jnb	.L550
+	leaq	10(%r13,%r13), %rax
+	movl	$1, %edx
+	movq	%r14, %rdi
+	cmpq	%r12, %rax
+	cmovnb	%rax, %r12
+	movq	(%r14), %rax
+	leaq	1(%r12), %rsi
+.LEHB22:
+	call	*16(%rax)
+	leaq	1(%rbp), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L513
+	movq	(%r14), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L513:
+	movq	%rbx, 104(%rsp)
+	movq	%r12, %r13
+	movq	%r12, 88(%rsp)
+.L512:
+	cmpq	$23, %r13
+	jne	.L603
+	leaq	104(%rsp), %rbx
+.L603:
+	movq	(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L503
+.L614:
+	cmpq	%r12, %r13
+	jnb	.L549
+.L535:
+	leaq	10(%r13,%r13), %rax
+	movl	$1, %edx
+	movq	%r14, %rdi
+	cmpq	%r12, %rax
+	cmovnb	%rax, %r12
+	movq	(%r14), %rax
+	leaq	1(%r12), %rsi
+	call	*16(%rax)
+	leaq	1(%rbp), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L511
+	movq	(%r14), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.LEHE22:
+.L511:
+	movq	%rbx, 104(%rsp)
+	movq	%r12, 88(%rsp)
+.L505:
+	leaq	.LC21(%rip), %rsi
+	cmpq	$23, %r12
+	jne	.L503
+	leaq	104(%rsp), %rbx
+	jmp	.L599
+	.p2align 4,,10
+	.p2align 3
+.L606:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L615
+.L455:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	40(%rsp), %r14
+	jmp	.L453
+	.p2align 4,,10
+	.p2align 3
+.L488:
+	movq	%rax, %rdi
+	movq	%r15, %rsi
+	call	memcpy@PLT
+	jmp	.L489
+	.p2align 4,,10
+	.p2align 3
+.L539:
+	movq	%r14, 8(%rsp)
+	xorl	%ebp, %ebp
+	jmp	.L465
+	.p2align 4,,10
+	.p2align 3
+.L476:
+	movq	16(%rsp), %rdx
+	movq	%rax, %rdi
+	leaq	56(%rsp), %rsi
+	call	memcpy@PLT
+	jmp	.L477
+	.p2align 4,,10
+	.p2align 3
+.L517:
+	cmpq	$23, %rbx
+	je	.L616
+	movq	56(%rsp), %rdi
+	movq	%rdi, %rsi
+	testq	%rdx, %rdx
+	je	.L525
+	leaq	104(%rsp), %rsi
+	jmp	.L520
+.L469:
+	movq	8(%rsp), %rsi
+	leaq	56(%rsp), %rax
+	addq	%rax, %rsi
+	jmp	.L602
+.L610:
+	movq	%rax, (%rsp)
+	jmp	.L462
+.L612:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L507
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L507
+.L615:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L455
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L455
+.L491:
+	movq	%rax, %rdi
+	movq	%r15, %rsi
+	call	memcpy@PLT
+	jmp	.L492
+.L616:
+	testq	%rdx, %rdx
+	je	.L452
+	leaq	104(%rsp), %rsi
+	jmp	.L604
+.L549:
+	xorl	%ebx, %ebx
+	movq	%r13, %r12
+	jmp	.L505
+.L550:
+	xorl	%ebx, %ebx
+	jmp	.L512
+.L613:
+	leaq	104(%rsp), %rbx
+	cmpq	%rbx, %rsi
+	jnb	.L617
+	cmpq	$23, %r12
+	jbe	.L503
+	movq	%rbx, %r15
+	jmp	.L535
+.L617:
+	movq	%rbx, %r15
+	jmp	.L509
+.L556:
+	movq	%rax, %rbx
+	jmp	.L530
+.L555:
+	movq	%rax, %rbp
+	jmp	.L498
+.L554:
+	movq	%rax, %rbx
+	jmp	.L533
+	.section	.gcc_except_table
+.LLSDA7007:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7007-.LLSDACSB7007
+.LLSDACSB7007:
+	.uleb128 .LEHB16-.LFB7007
+	.uleb128 .LEHE16-.LEHB16
+	.uleb128 .L554-.LFB7007
+	.uleb128 0
+	.uleb128 .LEHB17-.LFB7007
+	.uleb128 .LEHE17-.LEHB17
+	.uleb128 .L556-.LFB7007
+	.uleb128 0
+	.uleb128 .LEHB18-.LFB7007
+	.uleb128 .LEHE18-.LEHB18
+	.uleb128 .L555-.LFB7007
+	.uleb128 0
+	.uleb128 .LEHB19-.LFB7007
+	.uleb128 .LEHE19-.LEHB19
+	.uleb128 .L556-.LFB7007
+	.uleb128 0
+	.uleb128 .LEHB20-.LFB7007
+	.uleb128 .LEHE20-.LEHB20
+	.uleb128 .L556-.LFB7007
+	.uleb128 0
+	.uleb128 .LEHB21-.LFB7007
+	.uleb128 .LEHE21-.LEHB21
+	.uleb128 .L554-.LFB7007
+	.uleb128 0
+	.uleb128 .LEHB22-.LFB7007
+	.uleb128 .LEHE22-.LEHB22
+	.uleb128 .L554-.LFB7007
+	.uleb128 0
+.LLSDACSE7007:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7007
+	.type	_Z21test_generator_formatv.cold, @function
+_Z21test_generator_formatv.cold:
+.LFSB7007:
+.L530:
+	.cfi_def_cfa_offset 192
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	80(%rsp), %rax
+	testq	%rax, %rax
+	je	.L533
+.L500:
+	subq	$1, 32(%rax)
+	jne	.L533
+	movq	%rax, %rdi
+	call	*8(%rax)
+.L533:
+	movq	40(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L534
+	movq	48(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	56(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L534:
+	movq	%rbx, %rdi
+.LEHB23:
+	call	_Unwind_Resume@PLT
+.LEHE23:
+.L498:
+	subq	$1, 32(%rbx)
+	jne	.L499
+	movq	%rbx, %rdi
+	call	*8(%rbx)
+.L499:
+	movq	80(%rsp), %rax
+	movq	%rbp, %rbx
+	jmp	.L500
+	.cfi_endproc
+.LFE7007:
+	.section	.gcc_except_table
+.LLSDAC7007:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7007-.LLSDACSBC7007
+.LLSDACSBC7007:
+	.uleb128 .LEHB23-.LCOLDB24
+	.uleb128 .LEHE23-.LEHB23
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC7007:
+	.section	.text.unlikely
+	.text
+	.size	_Z21test_generator_formatv, .-_Z21test_generator_formatv
+	.section	.text.unlikely
+	.size	_Z21test_generator_formatv.cold, .-_Z21test_generator_formatv.cold
+.LCOLDE24:
+	.text
+.LHOTE24:
+	.p2align 4
+	.globl	_Z5wordsv
+	.type	_Z5wordsv, @function
+_Z5wordsv:
+.LFB6980:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	cmpb	$0, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	je	.L629
+	movq	%fs:24+_ZZN1n8__framesEvE5cache@tpoff, %rax
+	testq	%rax, %rax
+	je	.L620
+.L630:
+	movq	(%rax), %rdx
+	subq	$1, %fs:280+_ZZN1n8__framesEvE5cache@tpoff
+	movq	%rdx, %fs:24+_ZZN1n8__framesEvE5cache@tpoff
+.L621:
+	leaq	_Z5wordsPZ5wordsvE15_Z5wordsv.Frame.destroy(%rip), %rdx
+	leaq	_Z5wordsPZ5wordsvE15_Z5wordsv.Frame.actor(%rip), %rcx
+	movb	$1, 50(%rax)
+	movq	%rdx, %xmm1
+	movq	%rcx, %xmm0
+	movl	$2, %edx
+	movq	$0, 16(%rax)
+	punpcklqdq	%xmm1, %xmm0
+	movb	$0, 24(%rax)
+	movq	$1, 32(%rax)
+	movups	%xmm0, (%rax)
+	movq	%rax, (%rbx)
+	movq	%rax, 40(%rax)
+	movb	$0, 51(%rax)
+	movw	%dx, 48(%rax)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L629:
+	.cfi_restore_state
+	movq	%fs:0, %rax
+	leaq	__dso_handle(%rip), %rdx
+	movb	$1, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	leaq	_ZN1n13__frame_cacheD1Ev(%rip), %rdi
+	leaq	_ZZN1n8__framesEvE5cache@tpoff(%rax), %rsi
+	call	__cxa_thread_atexit@PLT
+	movq	%fs:24+_ZZN1n8__framesEvE5cache@tpoff, %rax
+	testq	%rax, %rax
+	jne	.L630
+.L620:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L631
+.L623:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %edx
+	movl	$256, %esi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	jmp	.L621
+.L631:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L623
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L623
+	.cfi_endproc
+.LFE6980:
+	.size	_Z5wordsv, .-_Z5wordsv
+	.section	.rodata.str1.1
+.LC25:
+	.string	"expected true : g.has_next()"
+	.section	.rodata.str1.8
+	.align 8
+.LC26:
+	.string	"expected true : kept == n::str(\"kept\")"
+	.align 8
+.LC27:
+	.string	"expected true : moved == n::str(\"moved\")"
+	.section	.text.unlikely
+.LCOLDB29:
+	.text
+.LHOTB29:
+	.p2align 4
+	.globl	_Z39test_generator_lvalue_and_rvalue_yieldsv
+	.type	_Z39test_generator_lvalue_and_rvalue_yieldsv, @function
+_Z39test_generator_lvalue_and_rvalue_yieldsv:
+.LFB7006:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7006
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$200, %rsp
+	.cfi_def_cfa_offset 256
+	leaq	40(%rsp), %rdi
+.LEHB24:
+	call	_Z5wordsv
+.LEHE24:
+	movq	40(%rsp), %rbp
+	testq	%rbp, %rbp
+	je	.L635
+	cmpb	$0, 24(%rbp)
+	jne	.L634
+	movq	0(%rbp), %rax
+	testq	%rax, %rax
+	je	.L635
+	movq	%rbp, %rdi
+.LEHB25:
+	call	*%rax
+.LEHE25:
+	cmpq	$0, 0(%rbp)
+	setne	24(%rbp)
+	je	.L635
+.L634:
+	movdqa	.LC8(%rip), %xmm1
+	movq	16(%rbp), %rbx
+	movb	$0, 24(%rbp)
+	movaps	%xmm1, 48(%rsp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L824
+.L637:
+	movq	16(%rbx), %rax
+	movdqu	(%rbx), %xmm2
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 80(%rsp)
+	movq	%rax, 64(%rsp)
+	movq	8(%rbx), %rax
+	movaps	%xmm2, 48(%rsp)
+	cmpq	$23, %rax
+	je	.L825
+	movq	24(%rbx), %rax
+	movq	$23, 8(%rbx)
+	movq	%rax, 72(%rsp)
+.L640:
+	movb	$0, 24(%rbx)
+	cmpb	$0, 24(%rbp)
+	movq	$0, (%rbx)
+	jne	.L641
+	movq	0(%rbp), %rax
+	testq	%rax, %rax
+	je	.L643
+	movq	%rbp, %rdi
+.LEHB26:
+	call	*%rax
+.LEHE26:
+	cmpq	$0, 0(%rbp)
+	setne	24(%rbp)
+	je	.L643
+.L641:
+	movdqa	.LC8(%rip), %xmm3
+	movq	16(%rbp), %rbx
+	movb	$0, 24(%rbp)
+	movaps	%xmm3, 96(%rsp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L826
+.L645:
+	movq	16(%rbx), %rax
+	movdqu	(%rbx), %xmm4
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 128(%rsp)
+	movq	%rax, 112(%rsp)
+	movq	8(%rbx), %rax
+	movaps	%xmm4, 96(%rsp)
+	cmpq	$23, %rax
+	je	.L827
+	movq	24(%rbx), %rax
+	movq	$23, 8(%rbx)
+	movq	%rax, 120(%rsp)
+.L648:
+	movdqa	.LC8(%rip), %xmm5
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+	movaps	%xmm5, 144(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L649
+	movq	%rax, 160(%rsp)
+	pxor	%xmm0, %xmm0
+	leaq	168(%rsp), %rbx
+	leaq	.LC6(%rip), %rax
+	movq	$0, 184(%rsp)
+	xorl	%r14d, %r14d
+	movups	%xmm0, 168(%rsp)
+	cmpq	%rbx, %rax
+	jb	.L650
+.L815:
+	leaq	.LC6(%rip), %rax
+	.p2align 4,,10
+	.p2align 3
+.L650:
+	movl	(%rax), %eax
+	movq	56(%rsp), %r15
+	movl	%eax, (%rbx,%r14)
+	movq	144(%rsp), %rax
+	leaq	4(%rax), %rdx
+	movq	%rdx, 144(%rsp)
+	movq	48(%rsp), %rdx
+	movb	$0, 4(%rbx,%rax)
+	movq	152(%rsp), %rbx
+	cmpq	144(%rsp), %rdx
+	je	.L828
+	movq	168(%rsp), %r13
+	cmpq	$23, %rbx
+	je	.L673
+.L672:
+	movq	160(%rsp), %rdi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L673
+	.p2align 4,,10
+	.p2align 3
+.L828:
+	cmpq	$23, %rbx
+	je	.L829
+	movq	168(%rsp), %r13
+	cmpq	$23, %r15
+	je	.L830
+	testq	%rdx, %rdx
+	je	.L670
+	movq	72(%rsp), %rdi
+.L671:
+	movq	%r13, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L672
+.L670:
+	movq	160(%rsp), %rdi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L666:
+	movdqa	.LC8(%rip), %xmm6
+	movaps	%xmm6, 144(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r12
+	testq	%r12, %r12
+	je	.L674
+	pxor	%xmm0, %xmm0
+	leaq	168(%rsp), %rbx
+	xorl	%r13d, %r13d
+	movq	%r12, 160(%rsp)
+	leaq	.LC7(%rip), %rsi
+	movups	%xmm0, 168(%rsp)
+	movq	$0, 184(%rsp)
+	cmpq	%rbx, %rsi
+	jb	.L676
+	movl	$23, %r14d
+	xorl	%r13d, %r13d
+	movl	$5, %eax
+.L820:
+	movq	%rbx, 8(%rsp)
+.L675:
+	movq	8(%rsp), %rcx
+	leaq	(%rcx,%r13), %rdx
+	cmpq	%rdx, %rsi
+	jnb	.L831
+	subq	%rcx, %rsi
+	movq	%rsi, 16(%rsp)
+	cmpq	%rax, %r14
+	jnb	.L725
+	leaq	10(%r14,%r14), %rdx
+	movq	%r12, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r12), %rax
+.LEHB27:
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L685
+	movq	(%r12), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r12, %rdi
+	call	*24(%rax)
+.LEHE27:
+.L685:
+	movq	24(%rsp), %rax
+	movq	%rbx, 168(%rsp)
+	movq	%rax, 152(%rsp)
+	movq	%rax, %r14
+.L684:
+	cmpq	$23, %r14
+	jne	.L821
+	leaq	168(%rsp), %rbx
+.L821:
+	movq	16(%rsp), %rsi
+	addq	%rbx, %rsi
+.L676:
+	leaq	(%rbx,%r13), %rdi
+	movl	$5, %edx
+	call	memmove@PLT
+	movq	144(%rsp), %rax
+	leaq	5(%rax), %rdx
+	movq	%rdx, 144(%rsp)
+	movq	96(%rsp), %rdx
+	movb	$0, 5(%rbx,%rax)
+	movq	104(%rsp), %rbx
+	movq	152(%rsp), %r12
+	cmpq	144(%rsp), %rdx
+	je	.L832
+.L688:
+	cmpq	$23, %r12
+	je	.L700
+	movq	160(%rsp), %rdi
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L700:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC27(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB28:
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L825:
+	movdqu	24(%rbx), %xmm7
+	movq	40(%rbx), %rax
+	movups	%xmm7, 72(%rsp)
+	movq	%rax, 88(%rsp)
+	jmp	.L640
+	.p2align 4,,10
+	.p2align 3
+.L827:
+	movdqu	24(%rbx), %xmm7
+	movq	40(%rbx), %rax
+	movups	%xmm7, 120(%rsp)
+	movq	%rax, 136(%rsp)
+	jmp	.L648
+.L830:
+	leaq	72(%rsp), %rdi
+	testq	%rdx, %rdx
+	jne	.L671
+	jmp	.L670
+	.p2align 4,,10
+	.p2align 3
+.L831:
+	cmpq	%rax, %r14
+	jnb	.L724
+.L713:
+	leaq	10(%r14,%r14), %rdx
+	movq	%r12, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 16(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r12), %rax
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L683
+	movq	(%r12), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r12, %rdi
+	call	*24(%rax)
+.LEHE28:
+.L683:
+	movq	16(%rsp), %rax
+	movq	%rbx, 168(%rsp)
+	movq	%rax, 152(%rsp)
+.L682:
+	cmpq	$23, 16(%rsp)
+	leaq	.LC7(%rip), %rsi
+	jne	.L676
+	leaq	168(%rsp), %rbx
+	jmp	.L676
+	.p2align 4,,10
+	.p2align 3
+.L832:
+	cmpq	$23, %r12
+	je	.L689
+	movq	168(%rsp), %rsi
+	movq	%rsi, %r13
+	cmpq	$23, %rbx
+	je	.L833
+	testq	%rdx, %rdx
+	je	.L691
+	movq	120(%rsp), %rdi
+.L692:
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L688
+	movq	168(%rsp), %r13
+	cmpq	$23, %r12
+	je	.L701
+.L691:
+	movq	160(%rsp), %rdi
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L701:
+	cmpq	$23, %rbx
+	je	.L696
+	movq	120(%rsp), %rsi
+.L697:
+	movq	112(%rsp), %rdi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L696:
+	cmpq	$23, %r15
+	je	.L702
+	movq	64(%rsp), %rdi
+	movq	72(%rsp), %rsi
+	leaq	1(%r15), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L702:
+	subq	$1, 32(%rbp)
+	jne	.L632
+	movq	%rbp, %rdi
+	call	*8(%rbp)
+.L632:
+	addq	$200, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L674:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L834
+.L678:
+	movq	_ZZN1n4heapEvE3res(%rip), %r12
+	movq	144(%rsp), %r13
+	pxor	%xmm0, %xmm0
+	movq	$0, 184(%rsp)
+	movq	152(%rsp), %r14
+	movq	56(%rsp), %r15
+	movq	$0, 8(%rsp)
+	leaq	.LC7(%rip), %rsi
+	movq	%r12, 160(%rsp)
+	leaq	5(%r13), %rax
+	movups	%xmm0, 168(%rsp)
+	cmpq	$23, %r14
+	jne	.L675
+	leaq	168(%rsp), %rbx
+	cmpq	%rbx, %rsi
+	jnb	.L820
+	cmpq	$23, %rax
+	jbe	.L676
+	movq	%rbx, 8(%rsp)
+	jmp	.L713
+	.p2align 4,,10
+	.p2align 3
+.L824:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L637
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L637
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L637
+	.p2align 4,,10
+	.p2align 3
+.L826:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L645
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L645
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L645
+	.p2align 4,,10
+	.p2align 3
+.L649:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L835
+.L654:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	144(%rsp), %r14
+	pxor	%xmm0, %xmm0
+	movq	$0, 184(%rsp)
+	movq	152(%rsp), %r13
+	movups	%xmm0, 168(%rsp)
+	leaq	.LC6(%rip), %rax
+	movq	%r15, 160(%rsp)
+	leaq	4(%r14), %r12
+	movq	$0, 8(%rsp)
+	cmpq	$23, %r13
+	je	.L836
+.L656:
+	movq	8(%rsp), %rcx
+	leaq	(%rcx,%r14), %rdx
+	cmpq	%rdx, %rax
+	jnb	.L837
+	movq	8(%rsp), %rcx
+	subq	%rcx, %rax
+	movq	%rax, 16(%rsp)
+	cmpq	%r12, %r13
+	jnb	.L720
+	leaq	10(%r13,%r13), %rax
+	movl	$1, %edx
+	movq	%r15, %rdi
+	cmpq	%r12, %rax
+	cmovnb	%rax, %r12
+	movq	(%r15), %rax
+	leaq	1(%r12), %rsi
+.LEHB29:
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%r14), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L660
+	movq	(%r15), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L660:
+	movq	%rbx, 168(%rsp)
+	movq	%r12, %r13
+	movq	%r12, 152(%rsp)
+.L659:
+	cmpq	$23, %r13
+	jne	.L819
+	leaq	168(%rsp), %rbx
+.L819:
+	movq	16(%rsp), %rax
+	addq	%rbx, %rax
+	jmp	.L650
+.L837:
+	cmpq	%r12, %r13
+	jnb	.L719
+.L714:
+	leaq	10(%r13,%r13), %rax
+	movl	$1, %edx
+	movq	%r15, %rdi
+	cmpq	%r12, %rax
+	cmovnb	%rax, %r12
+	movq	(%r15), %rax
+	leaq	1(%r12), %rsi
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%r14), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L658
+	movq	(%r15), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L658:
+	movq	%rbx, 168(%rsp)
+	movq	%r12, 152(%rsp)
+.L652:
+	leaq	.LC6(%rip), %rax
+	cmpq	$23, %r12
+	jne	.L650
+	leaq	168(%rsp), %rbx
+	jmp	.L815
+	.p2align 4,,10
+	.p2align 3
+.L724:
+	movq	%r14, 16(%rsp)
+	xorl	%ebx, %ebx
+	jmp	.L682
+	.p2align 4,,10
+	.p2align 3
+.L829:
+	cmpq	$23, %r15
+	je	.L838
+	movq	72(%rsp), %rdi
+	testq	%rdx, %rdx
+	je	.L666
+	leaq	168(%rsp), %rbx
+	movq	%rbx, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L666
+.L673:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC26(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE29:
+	.p2align 4,,10
+	.p2align 3
+.L689:
+	cmpq	$23, %rbx
+	je	.L839
+	movq	120(%rsp), %rdi
+	movq	%rdi, %rsi
+	testq	%rdx, %rdx
+	je	.L697
+	leaq	168(%rsp), %rsi
+	jmp	.L692
+.L725:
+	xorl	%ebx, %ebx
+	jmp	.L684
+.L833:
+	testq	%rdx, %rdx
+	je	.L691
+.L822:
+	leaq	120(%rsp), %rdi
+	jmp	.L692
+.L835:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L654
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L654
+.L834:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L678
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L678
+.L839:
+	testq	%rdx, %rdx
+	je	.L696
+	leaq	168(%rsp), %rsi
+	jmp	.L822
+.L838:
+	testq	%rdx, %rdx
+	je	.L666
+	leaq	168(%rsp), %rbx
+	leaq	72(%rsp), %rdi
+	movq	%rbx, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L673
+	jmp	.L666
+	.p2align 4,,10
+	.p2align 3
+.L719:
+	xorl	%ebx, %ebx
+	movq	%r13, %r12
+	jmp	.L652
+.L720:
+	xorl	%ebx, %ebx
+	jmp	.L659
+.L836:
+	leaq	168(%rsp), %rbx
+	cmpq	%rbx, %rax
+	jnb	.L840
+	cmpq	$23, %r12
+	jbe	.L650
+	movq	%rbx, 8(%rsp)
+	jmp	.L714
+.L840:
+	movq	%rbx, 8(%rsp)
+	jmp	.L656
+.L731:
+	movq	%rax, %rbx
+	jmp	.L704
+.L813:
+	jmp	.L814
+.L732:
+	movq	%rax, %rbx
+	jmp	.L708
+	.section	.gcc_except_table
+.LLSDA7006:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7006-.LLSDACSB7006
+.LLSDACSB7006:
+	.uleb128 .LEHB24-.LFB7006
+	.uleb128 .LEHE24-.LEHB24
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB25-.LFB7006
+	.uleb128 .LEHE25-.LEHB25
+	.uleb128 .L732-.LFB7006
+	.uleb128 0
+	.uleb128 .LEHB26-.LFB7006
+	.uleb128 .LEHE26-.LEHB26
+	.uleb128 .L813-.LFB7006
+	.uleb128 0
+	.uleb128 .LEHB27-.LFB7006
+	.uleb128 .LEHE27-.LEHB27
+	.uleb128 .L731-.LFB7006
+	.uleb128 0
+	.uleb128 .LEHB28-.LFB7006
+	.uleb128 .LEHE28-.LEHB28
+	.uleb128 .L731-.LFB7006
+	.uleb128 0
+	.uleb128 .LEHB29-.LFB7006
+	.uleb128 .LEHE29-.LEHB29
+	.uleb128 .L731-.LFB7006
+	.uleb128 0
+.LLSDACSE7006:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7006
+	.type	_Z39test_generator_lvalue_and_rvalue_yieldsv.cold, @function
+_Z39test_generator_lvalue_and_rvalue_yieldsv.cold:
+.LFSB7006:
+.L704:
+	.cfi_def_cfa_offset 256
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	104(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L706
+	movq	112(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	120(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L706:
+	movq	56(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L708
+	movq	64(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	72(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L708:
+	subq	$1, 32(%rbp)
+	jne	.L711
+	movq	%rbp, %rdi
+	call	*8(%rbp)
+.L711:
+	movq	%rbx, %rdi
+.LEHB30:
+	call	_Unwind_Resume@PLT
+.LEHE30:
+.L730:
+.L814:
+	movq	%rax, %rbx
+	jmp	.L706
+.L635:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC25(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB31:
+	call	__cxa_throw@PLT
+.LEHE31:
+.L643:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC25(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB32:
+	call	__cxa_throw@PLT
+.LEHE32:
+.L729:
+	movq	%rax, %rbx
+	testq	%rbp, %rbp
+	jne	.L708
+	jmp	.L711
+	.cfi_endproc
+.LFE7006:
+	.section	.gcc_except_table
+.LLSDAC7006:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7006-.LLSDACSBC7006
+.LLSDACSBC7006:
+	.uleb128 .LEHB30-.LCOLDB29
+	.uleb128 .LEHE30-.LEHB30
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB31-.LCOLDB29
+	.uleb128 .LEHE31-.LEHB31
+	.uleb128 .L729-.LCOLDB29
+	.uleb128 0
+	.uleb128 .LEHB32-.LCOLDB29
+	.uleb128 .LEHE32-.LEHB32
+	.uleb128 .L730-.LCOLDB29
+	.uleb128 0
+.LLSDACSEC7006:
+	.section	.text.unlikely
+	.text
+	.size	_Z39test_generator_lvalue_and_rvalue_yieldsv, .-_Z39test_generator_lvalue_and_rvalue_yieldsv
+	.section	.text.unlikely
+	.size	_Z39test_generator_lvalue_and_rvalue_yieldsv.cold, .-_Z39test_generator_lvalue_and_rvalue_yieldsv.cold
+.LCOLDE29:
+	.text
+.LHOTE29:
+	.section	.rodata.str1.1
+.LC30:
+	.string	"n::generator tests"
+.LC31:
+	.string	"test_generator_for_each"
+.LC32:
+	.string	"test_generator_copy"
+.LC33:
+	.string	"test_generator_empty"
+	.section	.rodata.str1.8
+	.align 8
+.LC34:
+	.string	"test_generator_has_next_is_idempotent"
+	.align 8
+.LC35:
+	.string	"test_generator_lvalue_and_rvalue_yields"
+	.section	.rodata.str1.1
+.LC36:
+	.string	"test_generator_format"
+	.section	.rodata.str1.8
+	.align 8
+.LC37:
+	.string	"test_generator_copies_share_the_coroutine"
+	.section	.rodata.str1.1
+.LC38:
+	.string	"test_frame_cache_recycles"
+	.section	.text.unlikely
+.LCOLDB40:
+	.section	.text.startup,"ax",@progbits
+.LHOTB40:
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB7013:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7013
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$1600, %edi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 64
+.LEHB33:
+	call	_Znam@PLT
+.LEHE33:
+	movq	%rax, %rbx
+	leaq	1600(%rax), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L842:
+	movq	$0, (%rax)
+	addq	$16, %rax
+	movq	$0, -8(%rax)
+	cmpq	%rax, %rdx
+	jne	.L842
+	leaq	.LC30(%rip), %rax
+	movq	%rsp, %rdi
+	movq	%rbx, (%rsp)
+	movq	%rax, 16(%rsp)
+	leaq	.LC31(%rip), %rax
+	movq	%rax, (%rbx)
+	leaq	_Z23test_generator_for_eachv(%rip), %rax
+	movq	%rax, 8(%rbx)
+	leaq	.LC32(%rip), %rax
+	movq	%rax, 16(%rbx)
+	leaq	_Z19test_generator_copyv(%rip), %rax
+	movq	%rax, 24(%rbx)
+	leaq	.LC33(%rip), %rax
+	movq	%rax, 32(%rbx)
+	leaq	_Z20test_generator_emptyv(%rip), %rax
+	movq	%rax, 40(%rbx)
+	leaq	.LC34(%rip), %rax
+	movq	%rax, 48(%rbx)
+	leaq	_Z37test_generator_has_next_is_idempotentv(%rip), %rax
+	movq	%rax, 56(%rbx)
+	leaq	.LC35(%rip), %rax
+	movq	%rax, 64(%rbx)
+	leaq	_Z39test_generator_lvalue_and_rvalue_yieldsv(%rip), %rax
+	movq	%rax, 72(%rbx)
+	leaq	.LC36(%rip), %rax
+	movq	%rax, 80(%rbx)
+	leaq	_Z21test_generator_formatv(%rip), %rax
+	movq	%rax, 88(%rbx)
+	leaq	.LC37(%rip), %rax
+	movq	%rax, 96(%rbx)
+	leaq	_Z41test_generator_copies_share_the_coroutinev(%rip), %rax
+	movq	%rax, 104(%rbx)
+	leaq	.LC38(%rip), %rax
+	movq	%rax, 112(%rbx)
+	leaq	_Z25test_frame_cache_recyclesv(%rip), %rax
+	movq	%rax, 120(%rbx)
+	movq	.LC39(%rip), %rax
+	movq	%rax, 8(%rsp)
+.LEHB34:
+	call	_ZN1n4test10test_suite7run_allEv
+.LEHE34:
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L844:
+	.cfi_restore_state
+	movq	%rax, %rbp
+	jmp	.L843
+	.section	.gcc_except_table
+.LLSDA7013:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7013-.LLSDACSB7013
+.LLSDACSB7013:
+	.uleb128 .LEHB33-.LFB7013
+	.uleb128 .LEHE33-.LEHB33
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB34-.LFB7013
+	.uleb128 .LEHE34-.LEHB34
+	.uleb128 .L844-.LFB7013
+	.uleb128 0
+.LLSDACSE7013:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7013
+	.type	main.cold, @function
+main.cold:
+.LFSB7013:
+.L843:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	movq	%rbp, %rdi
+.LEHB35:
+	call	_Unwind_Resume@PLT
+.LEHE35:
+	.cfi_endproc
+.LFE7013:
+	.section	.gcc_except_table
+.LLSDAC7013:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7013-.LLSDACSBC7013
+.LLSDACSBC7013:
+	.uleb128 .LEHB35-.LCOLDB40
+	.uleb128 .LEHE35-.LEHB35
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC7013:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	main, .-main
+	.section	.text.unlikely
+	.size	main.cold, .-main.cold
+.LCOLDE40:
+	.section	.text.startup
+.LHOTE40:
+	.section	.text._ZN1n9generatorIiE12promise_typedlEPvm,"axG",@progbits,_ZN1n9generatorIiE12promise_typedlEPvm,comdat
+	.p2align 4
+	.weak	_ZN1n9generatorIiE12promise_typedlEPvm
+	.type	_ZN1n9generatorIiE12promise_typedlEPvm, @function
+_ZN1n9generatorIiE12promise_typedlEPvm:
+.LFB7033:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rsi, %rbx
+	cmpb	$0, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	je	.L867
+	cmpq	$2048, %rbx
+	ja	.L868
+.L851:
+	addq	$63, %rbx
+	shrq	$6, %rbx
+	leaq	31(%rbx), %rdx
+	leaq	-1(%rbx), %rcx
+	movq	%fs:_ZZN1n8__framesEvE5cache@tpoff(,%rdx,8), %rax
+	cmpq	$16, %rax
+	je	.L869
+	movq	%fs:_ZZN1n8__framesEvE5cache@tpoff(,%rcx,8), %rsi
+	addq	$1, %rax
+	movq	%rsi, 0(%rbp)
+	movq	%rbp, %fs:_ZZN1n8__framesEvE5cache@tpoff(,%rcx,8)
+	movq	%rax, %fs:_ZZN1n8__framesEvE5cache@tpoff(,%rdx,8)
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L867:
+	.cfi_restore_state
+	movq	%fs:0, %rax
+	leaq	__dso_handle(%rip), %rdx
+	movb	$1, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	leaq	_ZN1n13__frame_cacheD1Ev(%rip), %rdi
+	leaq	_ZZN1n8__framesEvE5cache@tpoff(%rax), %rsi
+	call	__cxa_thread_atexit@PLT
+	cmpq	$2048, %rbx
+	jbe	.L851
+.L868:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L870
+.L853:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %ecx
+	movq	%rbx, %rdx
+	movq	(%rdi), %rax
+	movq	24(%rax), %rax
+.L866:
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	movq	%rbp, %rsi
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	jmp	*%rax
+	.p2align 4,,10
+	.p2align 3
+.L870:
+	.cfi_restore_state
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L853
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L853
+	.p2align 4,,10
+	.p2align 3
+.L869:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L871
+.L857:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%rbx, %rdx
+	movl	$16, %ecx
+	salq	$6, %rdx
+	movq	(%rdi), %rax
+	movq	24(%rax), %rax
+	jmp	.L866
+	.p2align 4,,10
+	.p2align 3
+.L871:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L857
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L857
+	.cfi_endproc
+.LFE7033:
+	.size	_ZN1n9generatorIiE12promise_typedlEPvm, .-_ZN1n9generatorIiE12promise_typedlEPvm
+	.text
+	.p2align 4
+	.globl	_Z5evensi
+	.type	_Z5evensi, @function
+_Z5evensi:
+.LFB6968:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movl	%esi, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx
+	cmpb	$0, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	je	.L883
+	movq	%fs:8+_ZZN1n8__framesEvE5cache@tpoff, %rax
+	testq	%rax, %rax
+	je	.L874
+.L884:
+	movq	(%rax), %rdx
+	subq	$1, %fs:264+_ZZN1n8__framesEvE5cache@tpoff
+	movq	%rdx, %fs:8+_ZZN1n8__framesEvE5cache@tpoff
+.L875:
+	leaq	_Z5evensPZ5evensiE15_Z5evensi.Frame.destroy(%rip), %rdx
+	leaq	_Z5evensPZ5evensiE15_Z5evensi.Frame.actor(%rip), %rcx
+	movb	$1, 54(%rax)
+	movq	%rdx, %xmm1
+	movq	%rcx, %xmm0
+	movl	$2, %edx
+	movl	%ebp, 48(%rax)
+	punpcklqdq	%xmm1, %xmm0
+	movq	$0, 16(%rax)
+	movb	$0, 24(%rax)
+	movq	$1, 32(%rax)
+	movups	%xmm0, (%rax)
+	movq	%rax, (%rbx)
+	movq	%rax, 40(%rax)
+	movb	$0, 55(%rax)
+	movw	%dx, 52(%rax)
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L883:
+	.cfi_restore_state
+	movq	%fs:0, %rax
+	leaq	__dso_handle(%rip), %rdx
+	movb	$1, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	leaq	_ZN1n13__frame_cacheD1Ev(%rip), %rdi
+	leaq	_ZZN1n8__framesEvE5cache@tpoff(%rax), %rsi
+	call	__cxa_thread_atexit@PLT
+	movq	%fs:8+_ZZN1n8__framesEvE5cache@tpoff, %rax
+	testq	%rax, %rax
+	jne	.L884
+.L874:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L885
+.L877:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %edx
+	movl	$128, %esi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	jmp	.L875
+	.p2align 4,,10
+	.p2align 3
+.L885:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L877
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L877
+	.cfi_endproc
+.LFE6968:
+	.size	_Z5evensi, .-_Z5evensi
+	.section	.rodata.str1.8
+	.align 8
+.LC41:
+	.string	"expected equal : expected value : sum, actual value : 0 + 2 + 4 + 6 + 8"
+	.align 8
+.LC42:
+	.string	"expected equal : expected value : count, actual value : 5"
+	.section	.text.unlikely
+.LCOLDB43:
+	.text
+.LHOTB43:
+	.p2align 4
+	.globl	_Z23test_generator_for_eachv
+	.type	_Z23test_generator_for_eachv, @function
+_Z23test_generator_for_eachv:
+.LFB6992:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6992
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movl	$10, %esi
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 48
+	leaq	8(%rsp), %rdi
+.LEHB36:
+	call	_Z5evensi
+.LEHE36:
+	movq	8(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L890
+	xorl	%ebp, %ebp
+	xorl	%r12d, %r12d
+	cmpb	$0, 24(%rbx)
+	movq	(%rbx), %rax
+	je	.L889
+	movq	16(%rbx), %rdx
+	movb	$0, 24(%rbx)
+	movl	$1, %ebp
+	movl	(%rdx), %r12d
+.L889:
+	testq	%rax, %rax
+	jne	.L891
+.L895:
+	subq	$1, 32(%rbx)
+	je	.L892
+.L893:
+	cmpl	$20, %r12d
+	jne	.L890
+	cmpl	$5, %ebp
+	jne	.L905
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L894:
+	.cfi_restore_state
+	movq	16(%rbx), %rdx
+	addl	$1, %ebp
+	addl	(%rdx), %r12d
+.L891:
+	movq	%rbx, %rdi
+.LEHB37:
+	call	*%rax
+.LEHE37:
+	movq	(%rbx), %rax
+	movb	$0, 24(%rbx)
+	testq	%rax, %rax
+	jne	.L894
+	jmp	.L895
+	.p2align 4,,10
+	.p2align 3
+.L892:
+	movq	%rbx, %rdi
+	call	*8(%rbx)
+	jmp	.L893
+.L900:
+	movq	%rax, %rbp
+	jmp	.L898
+	.section	.gcc_except_table
+.LLSDA6992:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6992-.LLSDACSB6992
+.LLSDACSB6992:
+	.uleb128 .LEHB36-.LFB6992
+	.uleb128 .LEHE36-.LEHB36
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB37-.LFB6992
+	.uleb128 .LEHE37-.LEHB37
+	.uleb128 .L900-.LFB6992
+	.uleb128 0
+.LLSDACSE6992:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6992
+	.type	_Z23test_generator_for_eachv.cold, @function
+_Z23test_generator_for_eachv.cold:
+.LFSB6992:
+.L890:
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -32
+	.cfi_offset 6, -24
+	.cfi_offset 12, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC41(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB38:
+	call	__cxa_throw@PLT
+.L905:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC42(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE38:
+.L898:
+	subq	$1, 32(%rbx)
+	jne	.L899
+	movq	%rbx, %rdi
+	call	*8(%rbx)
+.L899:
+	movq	%rbp, %rdi
+.LEHB39:
+	call	_Unwind_Resume@PLT
+.LEHE39:
+	.cfi_endproc
+.LFE6992:
+	.section	.gcc_except_table
+.LLSDAC6992:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6992-.LLSDACSBC6992
+.LLSDACSBC6992:
+	.uleb128 .LEHB38-.LCOLDB43
+	.uleb128 .LEHE38-.LEHB38
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB39-.LCOLDB43
+	.uleb128 .LEHE39-.LEHB39
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6992:
+	.section	.text.unlikely
+	.text
+	.size	_Z23test_generator_for_eachv, .-_Z23test_generator_for_eachv
+	.section	.text.unlikely
+	.size	_Z23test_generator_for_eachv.cold, .-_Z23test_generator_for_eachv.cold
+.LCOLDE43:
+	.text
+.LHOTE43:
+	.section	.rodata.str1.8
+	.align 8
+.LC44:
+	.string	"expected equal : expected value : g.next(), actual value : 0"
+	.section	.rodata.str1.1
+.LC45:
+	.string	"expected true : h.has_next()"
+	.section	.rodata.str1.8
+	.align 8
+.LC46:
+	.string	"expected equal : expected value : h.next(), actual value : 2"
+	.section	.text.unlikely
+.LCOLDB47:
+	.text
+.LHOTB47:
+	.p2align 4
+	.globl	_Z41test_generator_copies_share_the_coroutinev
+	.type	_Z41test_generator_copies_share_the_coroutinev, @function
+_Z41test_generator_copies_share_the_coroutinev:
+.LFB7011:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7011
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$6, %esi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+	leaq	8(%rsp), %rdi
+.LEHB40:
+	call	_Z5evensi
+.LEHE40:
+	movq	8(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L910
+	addq	$1, 32(%rbx)
+	cmpb	$0, 24(%rbx)
+	jne	.L909
+	movq	(%rbx), %rax
+	testq	%rax, %rax
+	je	.L910
+	movq	%rbx, %rdi
+.LEHB41:
+	call	*%rax
+	cmpq	$0, (%rbx)
+	setne	24(%rbx)
+	je	.L910
+.L909:
+	movq	16(%rbx), %rax
+	movb	$0, 24(%rbx)
+	movl	(%rax), %eax
+	testl	%eax, %eax
+	jne	.L934
+	movq	(%rbx), %rax
+	testq	%rax, %rax
+	je	.L914
+	movq	%rbx, %rdi
+	call	*%rax
+.LEHE41:
+	cmpq	$0, (%rbx)
+	je	.L935
+	movq	16(%rbx), %rax
+	movb	$0, 24(%rbx)
+	cmpl	$2, (%rax)
+	jne	.L936
+	movq	32(%rbx), %rax
+	subq	$1, %rax
+	movq	%rax, 32(%rbx)
+	jne	.L916
+	movq	%rbx, %rdi
+	call	*8(%rbx)
+	movq	32(%rbx), %rax
+.L916:
+	subq	$1, %rax
+	movq	%rax, 32(%rbx)
+	jne	.L907
+	movq	%rbx, %rdi
+	call	*8(%rbx)
+.L907:
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L932:
+	.cfi_restore_state
+	jmp	.L933
+	.section	.gcc_except_table
+.LLSDA7011:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7011-.LLSDACSB7011
+.LLSDACSB7011:
+	.uleb128 .LEHB40-.LFB7011
+	.uleb128 .LEHE40-.LEHB40
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB41-.LFB7011
+	.uleb128 .LEHE41-.LEHB41
+	.uleb128 .L932-.LFB7011
+	.uleb128 0
+.LLSDACSE7011:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7011
+	.type	_Z41test_generator_copies_share_the_coroutinev.cold, @function
+_Z41test_generator_copies_share_the_coroutinev.cold:
+.LFSB7011:
+.L910:
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC25(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB42:
+	call	__cxa_throw@PLT
+.LEHE42:
+.L936:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC46(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB43:
+	call	__cxa_throw@PLT
+.LEHE43:
+.L924:
+	movq	%rax, %rbp
+	testq	%rbx, %rbx
+	je	.L938
+.L920:
+	subq	$1, 32(%rbx)
+	jne	.L922
+	movq	%rbx, %rdi
+	call	*8(%rbx)
+.L922:
+	subq	$1, 32(%rbx)
+	jne	.L923
+	movq	%rbx, %rdi
+	call	*8(%rbx)
+.L923:
+	movq	%rbp, %rdi
+.LEHB44:
+	call	_Unwind_Resume@PLT
+.L925:
+.L933:
+	movq	%rax, %rbp
+	jmp	.L920
+.L938:
+	movq	%rax, %rdi
+	call	_Unwind_Resume@PLT
+.LEHE44:
+.L935:
+	movb	$0, 24(%rbx)
+.L914:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC45(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB45:
+	call	__cxa_throw@PLT
+.L934:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC44(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE45:
+	.cfi_endproc
+.LFE7011:
+	.section	.gcc_except_table
+.LLSDAC7011:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7011-.LLSDACSBC7011
+.LLSDACSBC7011:
+	.uleb128 .LEHB42-.LCOLDB47
+	.uleb128 .LEHE42-.LEHB42
+	.uleb128 .L924-.LCOLDB47
+	.uleb128 0
+	.uleb128 .LEHB43-.LCOLDB47
+	.uleb128 .LEHE43-.LEHB43
+	.uleb128 .L925-.LCOLDB47
+	.uleb128 0
+	.uleb128 .LEHB44-.LCOLDB47
+	.uleb128 .LEHE44-.LEHB44
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB45-.LCOLDB47
+	.uleb128 .LEHE45-.LEHB45
+	.uleb128 .L925-.LCOLDB47
+	.uleb128 0
+.LLSDACSEC7011:
+	.section	.text.unlikely
+	.text
+	.size	_Z41test_generator_copies_share_the_coroutinev, .-_Z41test_generator_copies_share_the_coroutinev
+	.section	.text.unlikely
+	.size	_Z41test_generator_copies_share_the_coroutinev.cold, .-_Z41test_generator_copies_share_the_coroutinev.cold
+.LCOLDE47:
+	.text
+.LHOTE47:
+	.p2align 4
+	.globl	_Z7squaresN1n9generatorIiEE
+	.type	_Z7squaresN1n9generatorIiEE, @function
+_Z7squaresN1n9generatorIiEE:
+.LFB6989:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx
+	cmpb	$0, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	je	.L950
+	movq	%fs:8+_ZZN1n8__framesEvE5cache@tpoff, %rax
+	testq	%rax, %rax
+	je	.L941
+.L951:
+	movq	(%rax), %rdx
+	subq	$1, %fs:264+_ZZN1n8__framesEvE5cache@tpoff
+	movq	%rdx, %fs:8+_ZZN1n8__framesEvE5cache@tpoff
+.L942:
+	leaq	_Z7squaresPZ7squaresN1n9generatorIiEEE33_Z7squaresN1n9generatorIiEE.Frame.destroy(%rip), %rdx
+	leaq	_Z7squaresPZ7squaresN1n9generatorIiEEE33_Z7squaresN1n9generatorIiEE.Frame.actor(%rip), %rcx
+	movb	$1, 58(%rax)
+	movq	%rdx, %xmm1
+	movq	%rcx, %xmm0
+	punpcklqdq	%xmm1, %xmm0
+	movups	%xmm0, (%rax)
+	movq	0(%rbp), %rdx
+	movq	$0, 0(%rbp)
+	movq	%rdx, 48(%rax)
+	movl	$2, %edx
+	movq	$0, 16(%rax)
+	movb	$0, 24(%rax)
+	movq	$1, 32(%rax)
+	movq	%rax, (%rbx)
+	movq	%rax, 40(%rax)
+	movb	$0, 59(%rax)
+	movw	%dx, 56(%rax)
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L950:
+	.cfi_restore_state
+	movq	%fs:0, %rax
+	leaq	__dso_handle(%rip), %rdx
+	movb	$1, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	leaq	_ZN1n13__frame_cacheD1Ev(%rip), %rdi
+	leaq	_ZZN1n8__framesEvE5cache@tpoff(%rax), %rsi
+	call	__cxa_thread_atexit@PLT
+	movq	%fs:8+_ZZN1n8__framesEvE5cache@tpoff, %rax
+	testq	%rax, %rax
+	jne	.L951
+.L941:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L952
+.L944:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %edx
+	movl	$128, %esi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	jmp	.L942
+	.p2align 4,,10
+	.p2align 3
+.L952:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L944
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L944
+	.cfi_endproc
+.LFE6989:
+	.size	_Z7squaresN1n9generatorIiEE, .-_Z7squaresN1n9generatorIiEE
+	.section	.rodata.str1.8
+	.align 8
+.LC48:
+	.string	"expected equal : expected value : v.len(), actual value : 4"
+	.align 8
+.LC49:
+	.string	"expected equal : expected value : v.data()[3], actual value : 36"
+	.section	.text.unlikely
+.LCOLDB50:
+	.text
+.LHOTB50:
+	.p2align 4
+	.globl	_Z19test_generator_copyv
+	.type	_Z19test_generator_copyv, @function
+_Z19test_generator_copyv:
+.LFB6994:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6994
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$56, %rsp
+	.cfi_def_cfa_offset 112
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r15
+	testq	%r15, %r15
+	je	.L954
+	leaq	32(%rsp), %rbx
+	movl	$8, %esi
+	movq	%rbx, %rdi
+.LEHB46:
+	call	_Z5evensi
+.LEHE46:
+.L955:
+	leaq	40(%rsp), %rdi
+	movq	%rbx, %rsi
+.LEHB47:
+	call	_Z7squaresN1n9generatorIiEE
+.LEHE47:
+	movq	32(%rsp), %rax
+	movq	40(%rsp), %rbx
+	movq	%rax, 8(%rsp)
+	testq	%rbx, %rbx
+	je	.L1024
+	xorl	%ebp, %ebp
+	xorl	%r12d, %r12d
+	xorl	%r13d, %r13d
+	jmp	.L964
+	.p2align 4,,10
+	.p2align 3
+.L967:
+	movl	(%r14), %eax
+	movl	%eax, 0(%r13,%rbp,4)
+.L971:
+	addq	$1, %rbp
+.L964:
+	cmpb	$0, 24(%rbx)
+	jne	.L972
+	movq	(%rbx), %rax
+	testq	%rax, %rax
+	je	.L979
+	movq	%rbx, %rdi
+.LEHB48:
+	call	*%rax
+.LEHE48:
+	cmpq	$0, (%rbx)
+	setne	24(%rbx)
+	je	.L979
+.L972:
+	movb	$0, 24(%rbx)
+	movq	16(%rbx), %r14
+	cmpq	%rbp, %r12
+	jne	.L967
+	leaq	5(%r12), %rsi
+	movl	$4, %edx
+	movq	%r15, %rdi
+	leaq	(%rsi,%rsi), %rax
+	salq	$3, %rsi
+	movq	%rax, 24(%rsp)
+	movq	(%r15), %rax
+.LEHB49:
+	call	*16(%rax)
+.LEHE49:
+	movq	%rax, %rsi
+	movq	%rax, 16(%rsp)
+	movl	(%r14), %eax
+	leaq	0(,%rbp,4), %rdx
+	movl	%eax, (%rsi,%rbp,4)
+	testq	%rbp, %rbp
+	jne	.L1025
+	testq	%r13, %r13
+	je	.L970
+.L969:
+	movq	(%r15), %rax
+	movl	$4, %ecx
+	movq	%r13, %rsi
+	movq	%r15, %rdi
+	leaq	0(,%r12,4), %rdx
+.LEHB50:
+	call	*24(%rax)
+.LEHE50:
+.L970:
+	movq	24(%rsp), %r12
+	movq	16(%rsp), %r13
+	jmp	.L971
+	.p2align 4,,10
+	.p2align 3
+.L979:
+	subq	$1, 32(%rbx)
+	je	.L974
+.L975:
+	cmpq	$0, 8(%rsp)
+	je	.L980
+.L965:
+	movq	8(%rsp), %rcx
+	movq	32(%rcx), %rax
+	movq	%rax, 8(%rsp)
+	subq	$1, %rax
+	movq	%rax, 32(%rcx)
+	je	.L1026
+.L980:
+	cmpq	$4, %rbp
+	jne	.L994
+	cmpl	$36, 12(%r13)
+	jne	.L1018
+	movq	(%r15), %rax
+	movq	%r13, %rsi
+	movq	%r15, %rdi
+	movl	$4, %ecx
+	leaq	0(,%r12,4), %rdx
+	call	*24(%rax)
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L974:
+	.cfi_restore_state
+	movq	%rbx, %rdi
+	call	*8(%rbx)
+	jmp	.L975
+	.p2align 4,,10
+	.p2align 3
+.L1026:
+	movq	%rcx, %rdi
+	call	*8(%rcx)
+	jmp	.L980
+	.p2align 4,,10
+	.p2align 3
+.L1025:
+	movq	%rsi, %rdi
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L969
+	.p2align 4,,10
+	.p2align 3
+.L1024:
+	testq	%rax, %rax
+	je	.L1027
+	xorl	%r13d, %r13d
+	xorl	%ebp, %ebp
+	xorl	%r12d, %r12d
+	jmp	.L965
+	.p2align 4,,10
+	.p2align 3
+.L954:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1028
+.L959:
+	leaq	32(%rsp), %rbx
+	movl	$8, %esi
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	%rbx, %rdi
+.LEHB51:
+	call	_Z5evensi
+.LEHE51:
+	jmp	.L955
+	.p2align 4,,10
+	.p2align 3
+.L1028:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L959
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L959
+.L1001:
+.L1023:
+	movq	%rax, %rbx
+	jmp	.L957
+.L1027:
+	jmp	.L1017
+.L1003:
+	movq	%rax, %rbp
+	jmp	.L987
+.L999:
+	movq	%rax, %rbp
+	jmp	.L978
+.L1004:
+	movq	%rax, %rbp
+	jmp	.L977
+.L1000:
+	jmp	.L1023
+.L998:
+	movq	%rax, %rbx
+	jmp	.L962
+	.section	.gcc_except_table
+.LLSDA6994:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6994-.LLSDACSB6994
+.LLSDACSB6994:
+	.uleb128 .LEHB46-.LFB6994
+	.uleb128 .LEHE46-.LEHB46
+	.uleb128 .L1000-.LFB6994
+	.uleb128 0
+	.uleb128 .LEHB47-.LFB6994
+	.uleb128 .LEHE47-.LEHB47
+	.uleb128 .L998-.LFB6994
+	.uleb128 0
+	.uleb128 .LEHB48-.LFB6994
+	.uleb128 .LEHE48-.LEHB48
+	.uleb128 .L1004-.LFB6994
+	.uleb128 0
+	.uleb128 .LEHB49-.LFB6994
+	.uleb128 .LEHE49-.LEHB49
+	.uleb128 .L999-.LFB6994
+	.uleb128 0
+	.uleb128 .LEHB50-.LFB6994
+	.uleb128 .LEHE50-.LEHB50
+	.uleb128 .L1003-.LFB6994
+	.uleb128 0
+	.uleb128 .LEHB51-.LFB6994
+	.uleb128 .LEHE51-.LEHB51
+	.uleb128 .L1001-.LFB6994
+	.uleb128 0
+.LLSDACSE6994:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6994
+	.type	_Z19test_generator_copyv.cold, @function
+_Z19test_generator_copyv.cold:
+.LFSB6994:
+.L1018:
+	.cfi_def_cfa_offset 112
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC49(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB52:
+	call	__cxa_throw@PLT
+.LEHE52:
+.L1017:
+	xorl	%r13d, %r13d
+	xorl	%r12d, %r12d
+.L994:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC48(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB53:
+	call	__cxa_throw@PLT
+.LEHE53:
+.L987:
+	movq	16(%rsp), %r13
+.L978:
+	subq	$1, 32(%rbx)
+	jne	.L988
+	movq	%rbx, %rdi
+	call	*8(%rbx)
+.L988:
+	movq	24(%rsp), %r12
+	movq	%rbp, %rbx
+.L963:
+	movq	32(%rsp), %rax
+	testq	%rax, %rax
+	je	.L992
+	subq	$1, 32(%rax)
+	jne	.L992
+	movq	%rax, %rdi
+	call	*8(%rax)
+.L992:
+	testq	%r13, %r13
+	je	.L957
+.L986:
+	movq	(%r15), %rax
+	movl	$4, %ecx
+	movq	%r13, %rsi
+	movq	%r15, %rdi
+	leaq	0(,%r12,4), %rdx
+	call	*24(%rax)
+.L957:
+	movq	%rbx, %rdi
+.LEHB54:
+	call	_Unwind_Resume@PLT
+.LEHE54:
+.L997:
+	movq	%rax, %rbx
+	jmp	.L992
+.L1002:
+	movq	%rax, %rbx
+	jmp	.L986
+.L977:
+	movq	%r12, 24(%rsp)
+	jmp	.L978
+.L962:
+	xorl	%r12d, %r12d
+	xorl	%r13d, %r13d
+	jmp	.L963
+	.cfi_endproc
+.LFE6994:
+	.section	.gcc_except_table
+.LLSDAC6994:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6994-.LLSDACSBC6994
+.LLSDACSBC6994:
+	.uleb128 .LEHB52-.LCOLDB50
+	.uleb128 .LEHE52-.LEHB52
+	.uleb128 .L1002-.LCOLDB50
+	.uleb128 0
+	.uleb128 .LEHB53-.LCOLDB50
+	.uleb128 .LEHE53-.LEHB53
+	.uleb128 .L997-.LCOLDB50
+	.uleb128 0
+	.uleb128 .LEHB54-.LCOLDB50
+	.uleb128 .LEHE54-.LEHB54
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6994:
+	.section	.text.unlikely
+	.text
+	.size	_Z19test_generator_copyv, .-_Z19test_generator_copyv
+	.section	.text.unlikely
+	.size	_Z19test_generator_copyv.cold, .-_Z19test_generator_copyv.cold
+.LCOLDE50:
+	.text
+.LHOTE50:
+	.p2align 4
+	.type	_Z5evensi.constprop.0, @function
+_Z5evensi.constprop.0:
+.LFB7203:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	cmpb	$0, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	je	.L1040
+	movq	%fs:8+_ZZN1n8__framesEvE5cache@tpoff, %rax
+	testq	%rax, %rax
+	je	.L1031
+.L1041:
+	movq	(%rax), %rdx
+	subq	$1, %fs:264+_ZZN1n8__framesEvE5cache@tpoff
+	movq	%rdx, %fs:8+_ZZN1n8__framesEvE5cache@tpoff
+.L1032:
+	leaq	_Z5evensPZ5evensiE15_Z5evensi.Frame.destroy(%rip), %rdx
+	leaq	_Z5evensPZ5evensiE15_Z5evensi.Frame.actor(%rip), %rcx
+	movb	$1, 54(%rax)
+	movq	%rdx, %xmm1
+	movq	%rcx, %xmm0
+	movl	$2, %edx
+	movl	$4, 48(%rax)
+	punpcklqdq	%xmm1, %xmm0
+	movq	$0, 16(%rax)
+	movb	$0, 24(%rax)
+	movq	$1, 32(%rax)
+	movups	%xmm0, (%rax)
+	movq	%rax, (%rbx)
+	movq	%rax, 40(%rax)
+	movb	$0, 55(%rax)
+	movw	%dx, 52(%rax)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1040:
+	.cfi_restore_state
+	movq	%fs:0, %rax
+	leaq	__dso_handle(%rip), %rdx
+	movb	$1, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	leaq	_ZN1n13__frame_cacheD1Ev(%rip), %rdi
+	leaq	_ZZN1n8__framesEvE5cache@tpoff(%rax), %rsi
+	call	__cxa_thread_atexit@PLT
+	movq	%fs:8+_ZZN1n8__framesEvE5cache@tpoff, %rax
+	testq	%rax, %rax
+	jne	.L1041
+.L1031:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1042
+.L1034:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %edx
+	movl	$128, %esi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	jmp	.L1032
+	.p2align 4,,10
+	.p2align 3
+.L1042:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1034
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1034
+	.cfi_endproc
+.LFE7203:
+	.size	_Z5evensi.constprop.0, .-_Z5evensi.constprop.0
+	.section	.rodata.str1.8
+	.align 8
+.LC51:
+	.string	"expected equal : expected value : g.next(), actual value : 2"
+	.section	.rodata.str1.1
+.LC52:
+	.string	"expected false : g.has_next()"
+	.section	.text.unlikely
+.LCOLDB53:
+	.text
+.LHOTB53:
+	.p2align 4
+	.globl	_Z37test_generator_has_next_is_idempotentv
+	.type	_Z37test_generator_has_next_is_idempotentv, @function
+_Z37test_generator_has_next_is_idempotentv:
+.LFB7005:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7005
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+	leaq	8(%rsp), %rdi
+.LEHB55:
+	call	_Z5evensi.constprop.0
+.LEHE55:
+	movq	8(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L1046
+	cmpb	$0, 24(%rbx)
+	jne	.L1045
+	movq	(%rbx), %rax
+	testq	%rax, %rax
+	je	.L1046
+	movq	%rbx, %rdi
+.LEHB56:
+	call	*%rax
+	cmpq	$0, (%rbx)
+	setne	24(%rbx)
+	je	.L1046
+.L1045:
+	movq	16(%rbx), %rax
+	movb	$0, 24(%rbx)
+	movl	(%rax), %eax
+	testl	%eax, %eax
+	jne	.L1069
+	movq	(%rbx), %rax
+	testq	%rax, %rax
+	je	.L1050
+	movq	%rbx, %rdi
+	call	*%rax
+	movq	(%rbx), %rax
+	testq	%rax, %rax
+	je	.L1070
+	movq	16(%rbx), %rdx
+	movb	$0, 24(%rbx)
+	cmpl	$2, (%rdx)
+	jne	.L1071
+	movq	%rbx, %rdi
+	call	*%rax
+.LEHE56:
+	cmpq	$0, (%rbx)
+	setne	24(%rbx)
+	jne	.L1072
+	subq	$1, 32(%rbx)
+	jne	.L1043
+	movq	%rbx, %rdi
+	call	*8(%rbx)
+.L1043:
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L1067:
+	.cfi_restore_state
+	jmp	.L1068
+	.section	.gcc_except_table
+.LLSDA7005:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7005-.LLSDACSB7005
+.LLSDACSB7005:
+	.uleb128 .LEHB55-.LFB7005
+	.uleb128 .LEHE55-.LEHB55
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB56-.LFB7005
+	.uleb128 .LEHE56-.LEHB56
+	.uleb128 .L1067-.LFB7005
+	.uleb128 0
+.LLSDACSE7005:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7005
+	.type	_Z37test_generator_has_next_is_idempotentv.cold, @function
+_Z37test_generator_has_next_is_idempotentv.cold:
+.LFSB7005:
+.L1046:
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC25(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB57:
+	call	__cxa_throw@PLT
+.LEHE57:
+.L1072:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC52(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB58:
+	call	__cxa_throw@PLT
+.L1071:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC51(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE58:
+.L1059:
+	movq	%rax, %rbp
+	testq	%rbx, %rbx
+	je	.L1056
+.L1057:
+	subq	$1, 32(%rbx)
+	jne	.L1056
+	movq	%rbx, %rdi
+	call	*8(%rbx)
+.L1056:
+	movq	%rbp, %rdi
+.LEHB59:
+	call	_Unwind_Resume@PLT
+.LEHE59:
+.L1060:
+.L1068:
+	movq	%rax, %rbp
+	jmp	.L1057
+.L1070:
+	movb	$0, 24(%rbx)
+.L1050:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC25(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB60:
+	call	__cxa_throw@PLT
+.L1069:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC44(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE60:
+	.cfi_endproc
+.LFE7005:
+	.section	.gcc_except_table
+.LLSDAC7005:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7005-.LLSDACSBC7005
+.LLSDACSBC7005:
+	.uleb128 .LEHB57-.LCOLDB53
+	.uleb128 .LEHE57-.LEHB57
+	.uleb128 .L1059-.LCOLDB53
+	.uleb128 0
+	.uleb128 .LEHB58-.LCOLDB53
+	.uleb128 .LEHE58-.LEHB58
+	.uleb128 .L1060-.LCOLDB53
+	.uleb128 0
+	.uleb128 .LEHB59-.LCOLDB53
+	.uleb128 .LEHE59-.LEHB59
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB60-.LCOLDB53
+	.uleb128 .LEHE60-.LEHB60
+	.uleb128 .L1060-.LCOLDB53
+	.uleb128 0
+.LLSDACSEC7005:
+	.section	.text.unlikely
+	.text
+	.size	_Z37test_generator_has_next_is_idempotentv, .-_Z37test_generator_has_next_is_idempotentv
+	.section	.text.unlikely
+	.size	_Z37test_generator_has_next_is_idempotentv.cold, .-_Z37test_generator_has_next_is_idempotentv.cold
+.LCOLDE53:
+	.text
+.LHOTE53:
+	.section	.rodata.str1.1
+.LC54:
+	.string	"expected true : a == b"
+	.section	.rodata.str1.8
+	.align 8
+.LC55:
+	.string	"expected equal : expected value : total, actual value : 2000"
+	.section	.text.unlikely
+.LCOLDB56:
+	.text
+.LHOTB56:
+	.p2align 4
+	.globl	_Z25test_frame_cache_recyclesv
+	.type	_Z25test_frame_cache_recyclesv, @function
+_Z25test_frame_cache_recyclesv:
+.LFB7012:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7012
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 64
+	cmpb	$0, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	je	.L1129
+	movq	%fs:8+_ZZN1n8__framesEvE5cache@tpoff, %rbx
+	testq	%rbx, %rbx
+	je	.L1076
+.L1133:
+	movq	(%rbx), %rax
+	movq	%rax, %fs:8+_ZZN1n8__framesEvE5cache@tpoff
+	movq	%fs:264+_ZZN1n8__framesEvE5cache@tpoff, %rax
+	subq	$1, %rax
+	movq	%rax, %fs:264+_ZZN1n8__framesEvE5cache@tpoff
+	cmpq	$16, %rax
+	je	.L1130
+.L1081:
+	movq	%fs:8+_ZZN1n8__framesEvE5cache@tpoff, %rdx
+	movq	%rdx, (%rbx)
+	movq	%rdx, %fs:8+_ZZN1n8__framesEvE5cache@tpoff
+	movq	%rax, %fs:264+_ZZN1n8__framesEvE5cache@tpoff
+.L1087:
+	cmpq	$16, %rax
+	je	.L1131
+	movq	%fs:8+_ZZN1n8__framesEvE5cache@tpoff, %rdx
+	addq	$1, %rax
+	movq	%rdx, (%rbx)
+	movq	%rbx, %fs:8+_ZZN1n8__framesEvE5cache@tpoff
+	movq	%rax, %fs:264+_ZZN1n8__framesEvE5cache@tpoff
+.L1095:
+	movl	$1000, %r12d
+	xorl	%ebp, %ebp
+	leaq	8(%rsp), %r13
+	jmp	.L1103
+	.p2align 4,,10
+	.p2align 3
+.L1101:
+	subq	$1, 32(%rbx)
+	jne	.L1096
+	movq	%rbx, %rdi
+	call	*8(%rbx)
+.L1096:
+	subl	$1, %r12d
+	je	.L1132
+.L1103:
+	movq	%r13, %rdi
+.LEHB61:
+	call	_Z5evensi.constprop.0
+.LEHE61:
+	movq	8(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L1096
+	cmpb	$0, 24(%rbx)
+	movq	(%rbx), %rax
+	je	.L1097
+	movq	16(%rbx), %rdx
+	movb	$0, 24(%rbx)
+	addl	(%rdx), %ebp
+.L1097:
+	testq	%rax, %rax
+	je	.L1101
+	jmp	.L1098
+	.p2align 4,,10
+	.p2align 3
+.L1100:
+	movq	16(%rbx), %rdx
+	addl	(%rdx), %ebp
+.L1098:
+	movq	%rbx, %rdi
+.LEHB62:
+	call	*%rax
+.LEHE62:
+	movq	(%rbx), %rax
+	movb	$0, 24(%rbx)
+	testq	%rax, %rax
+	jne	.L1100
+	jmp	.L1101
+	.p2align 4,,10
+	.p2align 3
+.L1132:
+	cmpl	$2000, %ebp
+	jne	.L1127
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.L1129:
+	.cfi_restore_state
+	movq	%fs:0, %rax
+	leaq	__dso_handle(%rip), %rdx
+	movb	$1, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	leaq	_ZN1n13__frame_cacheD1Ev(%rip), %rdi
+	leaq	_ZZN1n8__framesEvE5cache@tpoff(%rax), %rsi
+	call	__cxa_thread_atexit@PLT
+	movq	%fs:8+_ZZN1n8__framesEvE5cache@tpoff, %rbx
+	testq	%rbx, %rbx
+	jne	.L1133
+.L1076:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1134
+.L1079:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %edx
+	movl	$128, %esi
+	movq	(%rdi), %rax
+.LEHB63:
+	call	*16(%rax)
+	movq	%rax, %rbx
+	movq	%fs:264+_ZZN1n8__framesEvE5cache@tpoff, %rax
+	cmpq	$16, %rax
+	jne	.L1081
+.L1130:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1135
+.L1083:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %ecx
+	movl	$128, %edx
+	movq	%rbx, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	%fs:8+_ZZN1n8__framesEvE5cache@tpoff, %rax
+	testq	%rax, %rax
+	jne	.L1136
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1137
+.L1089:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %edx
+	movl	$128, %esi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+.L1086:
+	cmpq	%rbx, %rax
+	jne	.L1126
+	movq	%fs:264+_ZZN1n8__framesEvE5cache@tpoff, %rax
+	jmp	.L1087
+	.p2align 4,,10
+	.p2align 3
+.L1134:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1079
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1079
+.L1131:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1138
+.L1093:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %ecx
+	movl	$128, %edx
+	movq	%rbx, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE63:
+	jmp	.L1095
+.L1137:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1089
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1089
+.L1138:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1093
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1093
+.L1135:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1083
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1083
+.L1136:
+	movq	(%rax), %rdx
+	subq	$1, %fs:264+_ZZN1n8__framesEvE5cache@tpoff
+	movq	%rdx, %fs:8+_ZZN1n8__framesEvE5cache@tpoff
+	jmp	.L1086
+.L1108:
+	movq	%rax, %rbp
+	jmp	.L1105
+	.section	.gcc_except_table
+.LLSDA7012:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7012-.LLSDACSB7012
+.LLSDACSB7012:
+	.uleb128 .LEHB61-.LFB7012
+	.uleb128 .LEHE61-.LEHB61
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB62-.LFB7012
+	.uleb128 .LEHE62-.LEHB62
+	.uleb128 .L1108-.LFB7012
+	.uleb128 0
+	.uleb128 .LEHB63-.LFB7012
+	.uleb128 .LEHE63-.LEHB63
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE7012:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7012
+	.type	_Z25test_frame_cache_recyclesv.cold, @function
+_Z25test_frame_cache_recyclesv.cold:
+.LFSB7012:
+.L1126:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -40
+	.cfi_offset 6, -32
+	.cfi_offset 12, -24
+	.cfi_offset 13, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC54(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB64:
+	call	__cxa_throw@PLT
+.L1127:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC55(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE64:
+.L1105:
+	subq	$1, 32(%rbx)
+	jne	.L1106
+	movq	%rbx, %rdi
+	call	*8(%rbx)
+.L1106:
+	movq	%rbp, %rdi
+.LEHB65:
+	call	_Unwind_Resume@PLT
+.LEHE65:
+	.cfi_endproc
+.LFE7012:
+	.section	.gcc_except_table
+.LLSDAC7012:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7012-.LLSDACSBC7012
+.LLSDACSBC7012:
+	.uleb128 .LEHB64-.LCOLDB56
+	.uleb128 .LEHE64-.LEHB64
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB65-.LCOLDB56
+	.uleb128 .LEHE65-.LEHB65
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC7012:
+	.section	.text.unlikely
+	.text
+	.size	_Z25test_frame_cache_recyclesv, .-_Z25test_frame_cache_recyclesv
+	.section	.text.unlikely
+	.size	_Z25test_frame_cache_recyclesv.cold, .-_Z25test_frame_cache_recyclesv.cold
+.LCOLDE56:
+	.text
+.LHOTE56:
+	.section	.text.unlikely
+.LCOLDB57:
+	.text
+.LHOTB57:
+	.p2align 4
+	.globl	_Z20test_generator_emptyv
+	.type	_Z20test_generator_emptyv, @function
+_Z20test_generator_emptyv:
+.LFB7004:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7004
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	cmpb	$0, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	je	.L1158
+	movq	%fs:8+_ZZN1n8__framesEvE5cache@tpoff, %rbx
+	testq	%rbx, %rbx
+	je	.L1141
+.L1159:
+	movq	(%rbx), %rax
+	subq	$1, %fs:264+_ZZN1n8__framesEvE5cache@tpoff
+	movq	%rax, %fs:8+_ZZN1n8__framesEvE5cache@tpoff
+.L1142:
+	leaq	_Z5evensPZ5evensiE15_Z5evensi.Frame.destroy(%rip), %rax
+	leaq	_Z5evensPZ5evensiE15_Z5evensi.Frame.actor(%rip), %rcx
+	movb	$0, 24(%rbx)
+	movq	%rbx, %rdi
+	movq	%rax, %xmm1
+	movq	%rcx, %xmm0
+	movq	%rbx, 40(%rbx)
+	movabsq	$281483566645248, %rax
+	movq	$0, 16(%rbx)
+	punpcklqdq	%xmm1, %xmm0
+	movq	$1, 32(%rbx)
+	movq	%rax, 48(%rbx)
+	movups	%xmm0, (%rbx)
+.LEHB66:
+	call	_Z5evensPZ5evensiE15_Z5evensi.Frame.actor
+.LEHE66:
+	cmpq	$0, (%rbx)
+	setne	24(%rbx)
+	jne	.L1156
+	subq	$1, 32(%rbx)
+	jne	.L1139
+	movq	%rbx, %rdi
+	call	*8(%rbx)
+.L1139:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1158:
+	.cfi_restore_state
+	movq	%fs:0, %rax
+	leaq	__dso_handle(%rip), %rdx
+	movb	$1, %fs:_ZGVZN1n8__framesEvE5cache@tpoff
+	leaq	_ZN1n13__frame_cacheD1Ev(%rip), %rdi
+	leaq	_ZZN1n8__framesEvE5cache@tpoff(%rax), %rsi
+	call	__cxa_thread_atexit@PLT
+	movq	%fs:8+_ZZN1n8__framesEvE5cache@tpoff, %rbx
+	testq	%rbx, %rbx
+	jne	.L1159
+.L1141:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1160
+.L1144:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %edx
+	movl	$128, %esi
+	movq	(%rdi), %rax
+.LEHB67:
+	call	*16(%rax)
+.LEHE67:
+	movq	%rax, %rbx
+	jmp	.L1142
+	.p2align 4,,10
+	.p2align 3
+.L1160:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1144
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1144
+.L1154:
+	jmp	.L1155
+	.section	.gcc_except_table
+	.align 4
+.LLSDA7004:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT7004-.LLSDATTD7004
+.LLSDATTD7004:
+	.byte	0x1
+	.uleb128 .LLSDACSE7004-.LLSDACSB7004
+.LLSDACSB7004:
+	.uleb128 .LEHB66-.LFB7004
+	.uleb128 .LEHE66-.LEHB66
+	.uleb128 .L1154-.LFB7004
+	.uleb128 0
+	.uleb128 .LEHB67-.LFB7004
+	.uleb128 .LEHE67-.LEHB67
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE7004:
+	.align 4
+	.long	0
+
+.LLSDATT7004:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7004
+	.type	_Z20test_generator_emptyv.cold, @function
+_Z20test_generator_emptyv.cold:
+.LFSB7004:
+.L1156:
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC52(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB68:
+	call	__cxa_throw@PLT
+.LEHE68:
+.L1150:
+.L1155:
+	subq	$1, 32(%rbx)
+	movq	%rax, %rbp
+	jne	.L1149
+	movq	%rbx, %rdi
+	call	*8(%rbx)
+.L1149:
+	movq	%rbp, %rdi
+.LEHB69:
+	call	_Unwind_Resume@PLT
+.LEHE69:
+	.cfi_endproc
+.LFE7004:
+	.section	.gcc_except_table
+	.align 4
+.LLSDAC7004:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATTC7004-.LLSDATTDC7004
+.LLSDATTDC7004:
+	.byte	0x1
+	.uleb128 .LLSDACSEC7004-.LLSDACSBC7004
+.LLSDACSBC7004:
+	.uleb128 .LEHB68-.LCOLDB57
+	.uleb128 .LEHE68-.LEHB68
+	.uleb128 .L1150-.LCOLDB57
+	.uleb128 0
+	.uleb128 .LEHB69-.LCOLDB57
+	.uleb128 .LEHE69-.LEHB69
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC7004:
+	.align 4
+	.long	0
+
+.LLSDATTC7004:
+	.section	.text.unlikely
+	.text
+	.size	_Z20test_generator_emptyv, .-_Z20test_generator_emptyv
+	.section	.text.unlikely
+	.size	_Z20test_generator_emptyv.cold, .-_Z20test_generator_emptyv.cold
+.LCOLDE57:
+	.text
+.LHOTE57:
+	.weak	_ZTSN1n15memory_resourceE
+	.section	.rodata._ZTSN1n15memory_resourceE,"aG",@progbits,_ZTSN1n15memory_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n15memory_resourceE, @object
+	.size	_ZTSN1n15memory_resourceE, 22
+_ZTSN1n15memory_resourceE:
+	.string	"N1n15memory_resourceE"
+	.weak	_ZTIN1n15memory_resourceE
+	.section	.data.rel.ro._ZTIN1n15memory_resourceE,"awG",@progbits,_ZTIN1n15memory_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n15memory_resourceE, @object
+	.size	_ZTIN1n15memory_resourceE, 16
+_ZTIN1n15memory_resourceE:
+	.quad	_ZTVN10__cxxabiv117__class_type_infoE+16
+	.quad	_ZTSN1n15memory_resourceE
+	.weak	_ZTSN1n13heap_resourceE
+	.section	.rodata._ZTSN1n13heap_resourceE,"aG",@progbits,_ZTSN1n13heap_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n13heap_resourceE, @object
+	.size	_ZTSN1n13heap_resourceE, 20
+_ZTSN1n13heap_resourceE:
+	.string	"N1n13heap_resourceE"
+	.weak	_ZTIN1n13heap_resourceE
+	.section	.data.rel.ro._ZTIN1n13heap_resourceE,"awG",@progbits,_ZTIN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n13heap_resourceE, @object
+	.size	_ZTIN1n13heap_resourceE, 24
+_ZTIN1n13heap_resourceE:
+	.quad	_ZTVN10__cxxabiv120__si_class_type_infoE+16
+	.quad	_ZTSN1n13heap_resourceE
+	.quad	_ZTIN1n15memory_resourceE
+	.weak	_ZTVN1n13heap_resourceE
+	.section	.data.rel.ro.local._ZTVN1n13heap_resourceE,"awG",@progbits,_ZTVN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTVN1n13heap_resourceE, @object
+	.size	_ZTVN1n13heap_resourceE, 48
+_ZTVN1n13heap_resourceE:
+	.quad	0
+	.quad	_ZTIN1n13heap_resourceE
+	.quad	_ZN1n13heap_resourceD1Ev
+	.quad	_ZN1n13heap_resourceD0Ev
+	.quad	_ZN1n13heap_resource8allocateEmm
+	.quad	_ZN1n13heap_resource10deallocateEPvmm
+	.weak	_ZGVZN1n8__framesEvE5cache
+	.section	.tbss._ZGVZN1n8__framesEvE5cache,"awTG",@nobits,_ZGVZN1n8__framesEvE5cache,comdat
+	.align 8
+	.type	_ZGVZN1n8__framesEvE5cache, @gnu_unique_object
+	.size	_ZGVZN1n8__framesEvE5cache, 8
+_ZGVZN1n8__framesEvE5cache:
+	.zero	8
+	.weak	_ZZN1n8__framesEvE5cache
+	.section	.tbss._ZZN1n8__framesEvE5cache,"awTG",@nobits,_ZZN1n8__framesEvE5cache,comdat
+	.align 8
+	.type	_ZZN1n8__framesEvE5cache, @gnu_unique_object
+	.size	_ZZN1n8__framesEvE5cache, 512
+_ZZN1n8__framesEvE5cache:
+	.zero	512
+	.weak	_ZN1n18__current_resourceE
+	.section	.tbss._ZN1n18__current_resourceE,"awTG",@nobits,_ZN1n18__current_resourceE,comdat
+	.align 8
+	.type	_ZN1n18__current_resourceE, @gnu_unique_object
+	.size	_ZN1n18__current_resourceE, 8
+_ZN1n18__current_resourceE:
+	.zero	8
+	.weak	_ZGVZN1n4heapEvE3res
+	.section	.bss._ZGVZN1n4heapEvE3res,"awG",@nobits,_ZGVZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZGVZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZGVZN1n4heapEvE3res, 8
+_ZGVZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE3res
+	.section	.bss._ZZN1n4heapEvE3res,"awG",@nobits,_ZZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZZN1n4heapEvE3res, 8
+_ZZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE7storage
+	.section	.bss._ZZN1n4heapEvE7storage,"awG",@nobits,_ZZN1n4heapEvE7storage,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE7storage, @gnu_unique_object
+	.size	_ZZN1n4heapEvE7storage, 8
+_ZZN1n4heapEvE7storage:
+	.zero	8
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC8:
+	.quad	0
+	.quad	23
+	.section	.rodata.cst2,"aM",@progbits,2
+	.align 2
+.LC12:
+	.byte	10
+	.byte	0
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC39:
+	.long	8
+	.long	100
+	.hidden	DW.ref._ZTIPKc
+	.weak	DW.ref._ZTIPKc
+	.section	.data.rel.local.DW.ref._ZTIPKc,"awG",@progbits,DW.ref._ZTIPKc,comdat
+	.align 8
+	.type	DW.ref._ZTIPKc, @object
+	.size	DW.ref._ZTIPKc, 8
+DW.ref._ZTIPKc:
+	.quad	_ZTIPKc
+	.hidden	DW.ref.__gxx_personality_v0
+	.weak	DW.ref.__gxx_personality_v0
+	.section	.data.rel.local.DW.ref.__gxx_personality_v0,"awG",@progbits,DW.ref.__gxx_personality_v0,comdat
+	.align 8
+	.type	DW.ref.__gxx_personality_v0, @object
+	.size	DW.ref.__gxx_personality_v0, 8
+DW.ref.__gxx_personality_v0:
+	.quad	__gxx_personality_v0
+	.hidden	__dso_handle
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
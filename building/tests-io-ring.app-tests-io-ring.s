@@ -0,0 +1,18682 @@
+	.file	"tests-io-ring.cpp"
+	.text
+	.p2align 4
+	.type	_ZN1n4taskUlPvS1_E3_4_FUNES1_S1_, @function
+_ZN1n4taskUlPvS1_E3_4_FUNES1_S1_:
+.LFB7072:
+	.cfi_startproc
+	movdqu	(%rdi), %xmm0
+	movups	%xmm0, (%rsi)
+	ret
+	.cfi_endproc
+.LFE7072:
+	.size	_ZN1n4taskUlPvS1_E3_4_FUNES1_S1_, .-_ZN1n4taskUlPvS1_E3_4_FUNES1_S1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvPNS_15memory_resourceEE4_4_FUNES1_S3_, @function
+_ZN1n4taskUlPvPNS_15memory_resourceEE4_4_FUNES1_S3_:
+.LFB7075:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7075:
+	.size	_ZN1n4taskUlPvPNS_15memory_resourceEE4_4_FUNES1_S3_, .-_ZN1n4taskUlPvPNS_15memory_resourceEE4_4_FUNES1_S3_
+	.section	.text._ZN1n13heap_resourceD2Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD2Ev
+	.type	_ZN1n13heap_resourceD2Ev, @function
+_ZN1n13heap_resourceD2Ev:
+.LFB7125:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7125:
+	.size	_ZN1n13heap_resourceD2Ev, .-_ZN1n13heap_resourceD2Ev
+	.weak	_ZN1n13heap_resourceD1Ev
+	.set	_ZN1n13heap_resourceD1Ev,_ZN1n13heap_resourceD2Ev
+	.section	.text._ZN1n13heap_resource8allocateEmm,"axG",@progbits,_ZN1n13heap_resource8allocateEmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource8allocateEmm
+	.type	_ZN1n13heap_resource8allocateEmm, @function
+_ZN1n13heap_resource8allocateEmm:
+.LFB6547:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rdx
+	jbe	.L6
+	movq	%rdx, %rsi
+	jmp	_ZnwmSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	jmp	_Znwm@PLT
+	.cfi_endproc
+.LFE6547:
+	.size	_ZN1n13heap_resource8allocateEmm, .-_ZN1n13heap_resource8allocateEmm
+	.section	.text._ZN1n13heap_resource10deallocateEPvmm,"axG",@progbits,_ZN1n13heap_resource10deallocateEPvmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource10deallocateEPvmm
+	.type	_ZN1n13heap_resource10deallocateEPvmm, @function
+_ZN1n13heap_resource10deallocateEPvmm:
+.LFB6548:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rcx
+	jbe	.L8
+	movq	%rcx, %rsi
+	jmp	_ZdlPvSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L8:
+	jmp	_ZdlPv@PLT
+	.cfi_endproc
+.LFE6548:
+	.size	_ZN1n13heap_resource10deallocateEPvmm, .-_ZN1n13heap_resource10deallocateEPvmm
+	.section	.text._ZN1n13heap_resourceD0Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD0Ev
+	.type	_ZN1n13heap_resourceD0Ev, @function
+_ZN1n13heap_resourceD0Ev:
+.LFB7127:
+	.cfi_startproc
+	movl	$8, %esi
+	jmp	_ZdlPvm@PLT
+	.cfi_endproc
+.LFE7127:
+	.size	_ZN1n13heap_resourceD0Ev, .-_ZN1n13heap_resourceD0Ev
+	.text
+	.p2align 4
+	.type	_ZN1n4taskUlPvE2_4_FUNES1_, @function
+_ZN1n4taskUlPvE2_4_FUNES1_:
+.LFB7069:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movq	8(%rdi), %rbx
+	movq	(%rdi), %rbp
+	leaq	(%rbx,%rbx,2), %r14
+	salq	$4, %r14
+	addq	24(%rbp), %r14
+	movq	16(%rbp), %r12
+	movq	24(%r14), %rax
+	movq	16(%r14), %rdx
+	movq	0(%rbp), %r13
+	imulq	%rbx, %r12
+	movq	$0, 40(%r14)
+	cmpq	%rdx, %rax
+	jnb	.L11
+.L19:
+	movq	32(%r14), %rcx
+	subq	%rax, %rdx
+	movl	(%r14), %edi
+	addq	%rax, %rcx
+	addq	%r12, %rax
+	cmpb	$0, 4(%r14)
+	leaq	0(%r13,%rax), %rsi
+	je	.L12
+	call	pwrite@PLT
+	testq	%rax, %rax
+	js	.L36
+.L14:
+	je	.L18
+	addq	24(%r14), %rax
+	movq	%rax, 24(%r14)
+.L16:
+	movq	16(%r14), %rdx
+	cmpq	%rdx, %rax
+	jb	.L19
+.L18:
+	movq	40(%r14), %rax
+	testq	%rax, %rax
+	jne	.L20
+	.p2align 4,,10
+	.p2align 3
+.L38:
+	movq	24(%r14), %rax
+.L11:
+	movq	%rax, 40(%r14)
+	jmp	.L20
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	call	pread@PLT
+	testq	%rax, %rax
+	jns	.L14
+.L36:
+	call	__errno_location@PLT
+	movl	(%rax), %eax
+	cmpl	$4, %eax
+	je	.L37
+	negl	%eax
+	cltq
+	movq	%rax, 40(%r14)
+	testq	%rax, %rax
+	je	.L38
+.L20:
+	leaq	320(%rbp), %r12
+	xorl	%r13d, %r13d
+	.p2align 4,,10
+	.p2align 3
+.L21:
+	movq	(%r12), %rax
+.L23:
+	movq	264(%rbp), %rdx
+	andq	%rax, %rdx
+	salq	$4, %rdx
+	addq	256(%rbp), %rdx
+	movq	(%rdx), %rcx
+	cmpq	%rax, %rcx
+	jne	.L24
+	leaq	1(%rax), %rcx
+	lock cmpxchgq	%rcx, (%r12)
+	jne	.L23
+	testq	%rdx, %rdx
+	je	.L27
+	movq	(%rdx), %rax
+	movq	%rbx, 8(%rdx)
+	addq	$1, %rax
+	movq	%rax, (%rdx)
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L24:
+	.cfi_restore_state
+	jns	.L21
+	.p2align 4,,10
+	.p2align 3
+.L27:
+	cmpl	$63, %r13d
+	ja	.L39
+	rep nop
+	addl	$1, %r13d
+	jmp	.L21
+	.p2align 4,,10
+	.p2align 3
+.L39:
+	call	sched_yield@PLT
+	jmp	.L21
+	.p2align 4,,10
+	.p2align 3
+.L37:
+	movq	24(%r14), %rax
+	jmp	.L16
+	.cfi_endproc
+.LFE7069:
+	.size	_ZN1n4taskUlPvE2_4_FUNES1_, .-_ZN1n4taskUlPvE2_4_FUNES1_
+	.section	.text._ZN1n11thread_pool6__loopEPv,"axG",@progbits,_ZN1n11thread_pool6__loopEPv,comdat
+	.p2align 4
+	.weak	_ZN1n11thread_pool6__loopEPv
+	.type	_ZN1n11thread_pool6__loopEPv, @function
+_ZN1n11thread_pool6__loopEPv:
+.LFB6807:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6807
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$88, %rsp
+	.cfi_def_cfa_offset 144
+	movq	(%rdi), %rbx
+	movq	%rdi, %fs:_ZN1n16__current_workerE@tpoff
+	leaq	208(%rbx), %r12
+	.p2align 4,,10
+	.p2align 3
+.L41:
+	movq	(%r12), %r13
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %rbp
+	testq	%rbp, %rbp
+	je	.L42
+	cmpq	0(%rbp), %rbx
+	jne	.L43
+	movq	128(%rbp), %rcx
+	movq	136(%rbp), %rdi
+	leaq	64(%rbp), %r8
+	leaq	128(%rbp), %r9
+	leaq	-1(%rcx), %rax
+	movq	%rax, 128(%rbp)
+	lock orq	$0, (%rsp)
+	movq	64(%rbp), %rsi
+	cmpq	%rsi, %rax
+	jge	.L44
+	movq	%rcx, 128(%rbp)
+.L45:
+	movq	112(%rbx), %rax
+	leaq	112(%rbx), %r15
+	testq	%rax, %rax
+	jne	.L49
+	movq	16(%rbx), %rsi
+.L52:
+	movq	16(%rbp), %rdx
+	movq	%rdx, %rax
+	salq	$13, %rax
+	xorq	%rdx, %rax
+	movq	%rax, %rdx
+	shrq	$7, %rdx
+	xorq	%rax, %rdx
+	movq	%rdx, %rax
+	salq	$17, %rax
+	xorq	%rdx, %rax
+	xorl	%edx, %edx
+	movq	%rax, 16(%rbp)
+	divq	%rsi
+	movq	%rdx, %rcx
+.L50:
+	leaq	(%rcx,%rsi), %r8
+	testq	%rsi, %rsi
+	jne	.L60
+	jmp	.L61
+	.p2align 4,,10
+	.p2align 3
+.L58:
+	addq	$1, %rcx
+	cmpq	%rcx, %r8
+	je	.L61
+.L60:
+	movq	%rcx, %rax
+	xorl	%edx, %edx
+	divq	%rsi
+	movq	(%rbx), %rax
+	movq	(%rax,%rdx,8), %rdx
+	cmpq	%rbp, %rdx
+	je	.L58
+	movq	64(%rdx), %rax
+	leaq	64(%rdx), %r9
+	lock orq	$0, (%rsp)
+	movq	128(%rdx), %rdi
+	cmpq	%rdi, %rax
+	jge	.L58
+	movq	136(%rdx), %rdi
+	movq	(%rdi), %rdx
+	movq	8(%rdi), %rdi
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%rdi,%rdx,8), %r14
+	leaq	1(%rax), %rdx
+	lock cmpxchgq	%rdx, (%r9)
+	jne	.L58
+.L47:
+	movq	48(%r14), %rax
+	movq	%r14, %rdi
+	leaq	16(%rsp), %rbp
+.LEHB0:
+	call	*(%rax)
+.LEHE0:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 16(%rsp)
+	movaps	%xmm0, 32(%rsp)
+	movaps	%xmm0, 48(%rsp)
+	movaps	%xmm0, 64(%rsp)
+	cmpq	%rbp, %r14
+	je	.L62
+	movq	48(%r14), %rax
+	testq	%rax, %rax
+	je	.L62
+	movq	56(%r14), %rsi
+	movq	%r14, %rdi
+.LEHB1:
+	call	*16(%rax)
+	movq	$0, 48(%r14)
+	movq	64(%rsp), %rax
+	testq	%rax, %rax
+	je	.L62
+	movq	%r14, %rsi
+	movq	%rbp, %rdi
+	call	*8(%rax)
+.LEHE1:
+	movdqa	64(%rsp), %xmm1
+	movaps	%xmm1, 48(%r14)
+.L62:
+	movq	64(%r14), %rax
+	lock subq	$1, (%rax)
+	jmp	.L41
+	.p2align 4,,10
+	.p2align 3
+.L61:
+	leaq	120(%rbx), %rbp
+	movq	%rbp, %rdi
+	call	pthread_mutex_lock@PLT
+	lock addq	$1, 216(%rbx)
+	cmpb	$0, 224(%rbx)
+	jne	.L88
+	movq	(%r12), %rax
+	cmpq	%r13, %rax
+	jne	.L65
+	leaq	160(%rbx), %rdi
+	movq	%rbp, %rsi
+.LEHB2:
+	call	pthread_cond_wait@PLT
+.LEHE2:
+.L65:
+	lock subq	$1, 216(%rbx)
+	movq	%rbp, %rdi
+	call	pthread_mutex_unlock@PLT
+	jmp	.L41
+	.p2align 4,,10
+	.p2align 3
+.L43:
+	movq	112(%rbx), %rcx
+	leaq	112(%rbx), %r15
+	testq	%rcx, %rcx
+	jne	.L68
+	movq	16(%rbx), %rsi
+	xorl	%ebp, %ebp
+	jmp	.L50
+	.p2align 4,,10
+	.p2align 3
+.L68:
+	xorl	%ebp, %ebp
+.L49:
+	leaq	32(%rbx), %rdi
+	movq	%rdi, 8(%rsp)
+	call	pthread_mutex_lock@PLT
+	movq	104(%rbx), %rax
+	cmpq	88(%rbx), %rax
+	movq	8(%rsp), %rdi
+	jne	.L51
+	call	pthread_mutex_unlock@PLT
+	movq	16(%rbx), %rsi
+	testq	%rbp, %rbp
+	jne	.L52
+	xorl	%ecx, %ecx
+	jmp	.L50
+	.p2align 4,,10
+	.p2align 3
+.L44:
+	movq	(%rdi), %rdx
+	movq	8(%rdi), %rdi
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%rdi,%rdx,8), %r14
+	cmpq	%rsi, %rax
+	jne	.L47
+	lock cmpxchgq	%rcx, (%r8)
+	movq	%rcx, (%r9)
+	je	.L47
+	jmp	.L45
+	.p2align 4,,10
+	.p2align 3
+.L42:
+	movq	112(%rbx), %rcx
+	leaq	112(%rbx), %r15
+	testq	%rcx, %rcx
+	jne	.L49
+	movq	16(%rbx), %rsi
+	jmp	.L50
+	.p2align 4,,10
+	.p2align 3
+.L51:
+	movq	72(%rbx), %rdx
+	leaq	1(%rax), %rcx
+	movq	%rcx, 104(%rbx)
+	movq	(%rdx,%rax,8), %r14
+	lock subq	$1, (%r15)
+	movq	88(%rbx), %rax
+	cmpq	%rax, 104(%rbx)
+	jne	.L87
+	movq	$0, 88(%rbx)
+	movq	$0, 104(%rbx)
+.L87:
+	call	pthread_mutex_unlock@PLT
+	jmp	.L47
+	.p2align 4,,10
+	.p2align 3
+.L88:
+	movq	%rbp, %rdi
+	call	pthread_mutex_unlock@PLT
+	addq	$88, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L69:
+	.cfi_restore_state
+	movq	%rax, %rbx
+.L63:
+	movq	64(%rsp), %rax
+	testq	%rax, %rax
+	je	.L64
+	movq	72(%rsp), %rsi
+	movq	%rbp, %rdi
+	call	*16(%rax)
+.L64:
+	movq	%rbx, %rdi
+.LEHB3:
+	call	_Unwind_Resume@PLT
+.LEHE3:
+	.cfi_endproc
+.LFE6807:
+	.globl	__gxx_personality_v0
+	.section	.gcc_except_table._ZN1n11thread_pool6__loopEPv,"aG",@progbits,_ZN1n11thread_pool6__loopEPv,comdat
+.LLSDA6807:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6807-.LLSDACSB6807
+.LLSDACSB6807:
+	.uleb128 .LEHB0-.LFB6807
+	.uleb128 .LEHE0-.LEHB0
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB1-.LFB6807
+	.uleb128 .LEHE1-.LEHB1
+	.uleb128 .L69-.LFB6807
+	.uleb128 0
+	.uleb128 .LEHB2-.LFB6807
+	.uleb128 .LEHE2-.LEHB2
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB3-.LFB6807
+	.uleb128 .LEHE3-.LEHB3
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6807:
+	.section	.text._ZN1n11thread_pool6__loopEPv,"axG",@progbits,_ZN1n11thread_pool6__loopEPv,comdat
+	.size	_ZN1n11thread_pool6__loopEPv, .-_ZN1n11thread_pool6__loopEPv
+	.text
+	.align 2
+	.p2align 4
+	.type	_ZN1n7io_ring6submitEv.part.0, @function
+_ZN1n7io_ring6submitEv.part.0:
+.LFB7130:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdi, %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	xorl	%r14d, %r14d
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	cmpq	$0, 216(%rdi)
+	je	.L115
+	.p2align 4,,10
+	.p2align 3
+.L90:
+	movq	200(%r15), %rax
+	movq	192(%r15), %rbx
+	movq	(%rax,%r14,8), %r12
+	movq	672(%rbx), %rax
+	movq	8(%rax), %rdx
+	cmpq	$8, %rdx
+	je	.L138
+.L91:
+	leaq	1(%rdx), %rcx
+	leaq	(%rdx,%rdx,4), %rdx
+	salq	$4, %rdx
+	movq	%rcx, 8(%rax)
+	leaq	16(%rax,%rdx), %rbp
+	leaq	_ZN1n4task8__ops_ofIZNS_7io_ring6submitEvEUlvE_EE(%rip), %rax
+	movq	%rax, 48(%rbp)
+	leaq	8(%rbx), %rax
+	movq	$0, 56(%rbp)
+	movq	%r15, 0(%rbp)
+	movq	%r12, 8(%rbp)
+	movq	%rax, 64(%rbp)
+	lock addq	$1, 8(%rbx)
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %r13
+	movq	(%rbx), %rbx
+	testq	%r13, %r13
+	je	.L96
+	cmpq	0(%r13), %rbx
+	jne	.L96
+	movq	128(%r13), %r9
+	movq	64(%r13), %r11
+	movq	%r9, %rdx
+	movq	%r11, %r12
+	movq	136(%r13), %rcx
+	subq	%r11, %rdx
+	movq	(%rcx), %rax
+	cmpq	%rdx, %rax
+	jle	.L139
+.L97:
+	movq	8(%rcx), %rdx
+	subq	$1, %rax
+	andq	%r9, %rax
+	addq	$1, %r9
+	movq	%rbp, (%rdx,%rax,8)
+	movq	%r9, 128(%r13)
+.L108:
+	lock addq	$1, 208(%rbx)
+	movq	216(%rbx), %rax
+	testq	%rax, %rax
+	jne	.L140
+	addq	$1, %r14
+	cmpq	216(%r15), %r14
+	jb	.L90
+.L115:
+	movq	$0, 216(%r15)
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L96:
+	.cfi_restore_state
+	leaq	32(%rbx), %r12
+	movq	%r12, %rdi
+	call	pthread_mutex_lock@PLT
+	movq	88(%rbx), %rdx
+	movq	80(%rbx), %r13
+	movq	72(%rbx), %rax
+	cmpq	%r13, %rdx
+	je	.L141
+	movq	%rbp, (%rax,%rdx,8)
+.L112:
+	addq	$1, %rdx
+	movq	%rdx, 88(%rbx)
+	lock addq	$1, 112(%rbx)
+	movq	%r12, %rdi
+	call	pthread_mutex_unlock@PLT
+	jmp	.L108
+	.p2align 4,,10
+	.p2align 3
+.L138:
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	je	.L142
+.L92:
+	movq	%rax, 672(%rbx)
+	movq	8(%rax), %rdx
+	jmp	.L91
+	.p2align 4,,10
+	.p2align 3
+.L140:
+	leaq	120(%rbx), %rbp
+	addq	$1, %r14
+	movq	%rbp, %rdi
+	call	pthread_mutex_lock@PLT
+	leaq	160(%rbx), %rdi
+	call	pthread_cond_broadcast@PLT
+	movq	%rbp, %rdi
+	call	pthread_mutex_unlock@PLT
+	cmpq	216(%r15), %r14
+	jb	.L90
+	jmp	.L115
+	.p2align 4,,10
+	.p2align 3
+.L139:
+	addq	%rax, %rax
+	movq	%rax, (%rsp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L143
+.L99:
+	movq	(%rsp), %rax
+	movq	%rcx, 24(%rsp)
+	movl	$8, %edx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%r11, 16(%rsp)
+	leaq	16(,%rax,8), %rsi
+	movq	%r9, 8(%rsp)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	8(%rsp), %r9
+	movq	16(%rsp), %r11
+	movq	%rax, %r10
+	movq	(%rsp), %rax
+	movq	24(%rsp), %rcx
+	cmpq	%r11, %r9
+	movq	%rax, (%r10)
+	leaq	16(%r10), %rax
+	movq	%rax, 8(%r10)
+	jle	.L104
+	.p2align 4,,10
+	.p2align 3
+.L101:
+	movq	(%rcx), %rax
+	movq	8(%rcx), %rdx
+	subq	$1, %rax
+	andq	%r12, %rax
+	movq	(%rdx,%rax,8), %rsi
+	movq	(%r10), %rax
+	movq	8(%r10), %rdx
+	subq	$1, %rax
+	andq	%r12, %rax
+	addq	$1, %r12
+	movq	%rsi, (%rdx,%rax,8)
+	cmpq	%r12, %r9
+	jne	.L101
+.L104:
+	movq	160(%r13), %rax
+	movq	152(%r13), %r11
+	movq	144(%r13), %r12
+	cmpq	%r11, %rax
+	je	.L144
+	movq	%rcx, (%r12,%rax,8)
+.L107:
+	addq	$1, %rax
+	movq	%r10, %rcx
+	movq	%rax, 160(%r13)
+	movq	%r10, 136(%r13)
+	movq	(%r10), %rax
+	jmp	.L97
+	.p2align 4,,10
+	.p2align 3
+.L141:
+	movq	96(%rbx), %rdi
+	leaq	5(%r13), %rsi
+	movq	%rax, (%rsp)
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 80(%rbx)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	88(%rbx), %rdx
+	movq	%rax, %rdi
+	movq	%rax, 72(%rbx)
+	movq	%rbp, (%rdi,%rdx,8)
+	leaq	0(,%rdx,8), %rax
+	testq	%rdx, %rdx
+	jne	.L145
+	cmpq	$0, (%rsp)
+	je	.L112
+.L111:
+	movq	96(%rbx), %rdi
+	movq	(%rsp), %rsi
+	movl	$8, %ecx
+	leaq	0(,%r13,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	88(%rbx), %rdx
+	jmp	.L112
+	.p2align 4,,10
+	.p2align 3
+.L142:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L146
+.L94:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %edx
+	movl	$656, %esi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movl	$82, %ecx
+	movq	%rax, %rdx
+	xorl	%eax, %eax
+	movq	%rdx, %rdi
+	rep stosq
+	movq	672(%rbx), %rax
+	movq	%rdx, (%rax)
+	movq	672(%rbx), %rax
+	movq	(%rax), %rax
+	jmp	.L92
+	.p2align 4,,10
+	.p2align 3
+.L143:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rcx, 24(%rsp)
+	movq	%r11, 16(%rsp)
+	movq	%r9, 8(%rsp)
+	call	__cxa_guard_acquire@PLT
+	movq	8(%rsp), %r9
+	movq	16(%rsp), %r11
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	testl	%eax, %eax
+	movq	24(%rsp), %rcx
+	je	.L99
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movq	24(%rsp), %rcx
+	movq	16(%rsp), %r11
+	movq	8(%rsp), %r9
+	jmp	.L99
+	.p2align 4,,10
+	.p2align 3
+.L145:
+	movq	(%rsp), %rsi
+	movq	%rax, %rdx
+	call	memcpy@PLT
+	jmp	.L111
+	.p2align 4,,10
+	.p2align 3
+.L144:
+	leaq	5(%r11), %rsi
+	movq	168(%r13), %rdi
+	movq	%r10, 24(%rsp)
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	movq	%rcx, 16(%rsp)
+	salq	$4, %rsi
+	movq	%rax, 152(%r13)
+	movq	(%rdi), %rax
+	movq	%r9, 8(%rsp)
+	movq	%r11, (%rsp)
+	call	*16(%rax)
+	movq	16(%rsp), %rcx
+	movq	(%rsp), %r11
+	movq	%rax, 144(%r13)
+	movq	%rax, %rdi
+	movq	8(%rsp), %r9
+	movq	160(%r13), %rax
+	movq	24(%rsp), %r10
+	testq	%rax, %rax
+	movq	%rcx, (%rdi,%rax,8)
+	leaq	0(,%rax,8), %rdx
+	jne	.L147
+	testq	%r12, %r12
+	je	.L107
+.L106:
+	movq	168(%r13), %rdi
+	movq	%r10, 8(%rsp)
+	movq	%r12, %rsi
+	leaq	0(,%r11,8), %rdx
+	movq	%r9, (%rsp)
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	160(%r13), %rax
+	movq	(%rsp), %r9
+	movq	8(%rsp), %r10
+	jmp	.L107
+.L147:
+	movq	%r12, %rsi
+	movq	%r11, 16(%rsp)
+	movq	%r10, 8(%rsp)
+	movq	%r9, (%rsp)
+	call	memcpy@PLT
+	movq	(%rsp), %r9
+	movq	8(%rsp), %r10
+	movq	16(%rsp), %r11
+	jmp	.L106
+	.p2align 4,,10
+	.p2align 3
+.L146:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L94
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L94
+	.cfi_endproc
+.LFE7130:
+	.size	_ZN1n7io_ring6submitEv.part.0, .-_ZN1n7io_ring6submitEv.part.0
+	.section	.text.unlikely,"ax",@progbits
+	.align 2
+.LCOLDB0:
+	.text
+.LHOTB0:
+	.align 2
+	.p2align 4
+	.type	_ZN1n7io_ring4waitEPmmm.constprop.0, @function
+_ZN1n7io_ring4waitEPmmm.constprop.0:
+.LFB7135:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7135
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	56(%rdi), %rax
+	cmpq	%rsi, %rax
+	cmovbe	%rax, %rsi
+	movq	%rsi, %r15
+	movl	64(%rdi), %esi
+	testl	%esi, %esi
+	jns	.L343
+	movq	216(%rdi), %rdx
+	testq	%rdx, %rdx
+	je	.L154
+	cmpq	%rdx, %rax
+	je	.L344
+.L155:
+	movq	%rbx, %rdi
+.LEHB4:
+	call	_ZN1n7io_ring6submitEv.part.0
+	movl	64(%rbx), %esi
+.L152:
+	testl	%esi, %esi
+	js	.L154
+.L150:
+	movq	136(%rbx), %rax
+	xorl	%r12d, %r12d
+	movl	(%rax), %ecx
+	movq	144(%rbx), %rax
+	movl	(%rax), %esi
+	cmpl	%esi, %ecx
+	je	.L188
+	pxor	%xmm0, %xmm0
+	jmp	.L201
+	.p2align 4,,10
+	.p2align 3
+.L346:
+	addq	24(%rax), %rdx
+	movq	%rdx, 24(%rax)
+	cmpq	16(%rax), %rdx
+	jb	.L345
+.L200:
+	addl	$1, %ecx
+	movq	%rdx, 40(%rax)
+	addq	$1, %r12
+	movl	$2, 8(%rax)
+	subq	$1, 56(%rbx)
+	cmpl	%ecx, %esi
+	je	.L188
+.L201:
+	movl	%ecx, %edx
+	andl	152(%rbx), %edx
+	salq	$4, %rdx
+	addq	160(%rbx), %rdx
+	movq	(%rdx), %rdi
+	movslq	8(%rdx), %rdx
+	leaq	(%rdi,%rdi,2), %rax
+	salq	$4, %rax
+	addq	24(%rbx), %rax
+	cmpl	$-4, %edx
+	je	.L278
+	cmpl	$-11, %edx
+	je	.L278
+	testl	%edx, %edx
+	jg	.L346
+	jne	.L200
+	movq	24(%rax), %rdx
+	jmp	.L200
+.L154:
+	leaq	384(%rbx), %rsi
+	xorl	%r12d, %r12d
+	.p2align 4,,10
+	.p2align 3
+.L187:
+	movq	(%rsi), %rax
+.L210:
+	movq	264(%rbx), %rdx
+	andq	%rax, %rdx
+	salq	$4, %rdx
+	addq	256(%rbx), %rdx
+	movq	(%rdx), %rcx
+	subq	$1, %rcx
+	cmpq	%rax, %rcx
+	jne	.L207
+	leaq	1(%rax), %rcx
+	lock cmpxchgq	%rcx, (%rsi)
+	jne	.L210
+	movq	264(%rbx), %rdi
+	movq	8(%rdx), %rcx
+	addq	$1, %r12
+	leaq	1(%rax,%rdi), %rax
+	movq	%rax, (%rdx)
+	leaq	(%rcx,%rcx,2), %rax
+	salq	$4, %rax
+	addq	24(%rbx), %rax
+	movl	$2, 8(%rax)
+	subq	$1, 56(%rbx)
+	movq	(%rsi), %rax
+	jmp	.L210
+	.p2align 4,,10
+	.p2align 3
+.L207:
+	jns	.L187
+.L205:
+	movl	$0, (%rsp)
+	leaq	384(%rbx), %rbp
+	cmpq	%r15, %r12
+	jnb	.L148
+	.p2align 4,,10
+	.p2align 3
+.L212:
+	movl	64(%rbx), %esi
+	testl	%esi, %esi
+	js	.L239
+	movl	168(%rbx), %edx
+	movq	%r15, %rax
+	subq	%r12, %rax
+	movl	%edx, %ecx
+	movl	%eax, %r13d
+	orl	%eax, %ecx
+	je	.L240
+	xorl	%r14d, %r14d
+	testl	%eax, %eax
+	setne	%r14b
+	jmp	.L243
+	.p2align 4,,10
+	.p2align 3
+.L241:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L148
+	movl	168(%rbx), %edx
+	movl	64(%rbx), %esi
+.L243:
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 168
+	movl	%r13d, %ecx
+	xorl	%r9d, %r9d
+	movl	%r14d, %r8d
+	pushq	$0
+	.cfi_def_cfa_offset 176
+	movl	$426, %edi
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%rdx
+	.cfi_def_cfa_offset 168
+	popq	%rcx
+	.cfi_def_cfa_offset 160
+	testq	%rax, %rax
+	js	.L241
+	subl	%eax, 168(%rbx)
+.L267:
+	movl	64(%rbx), %eax
+	xorl	%esi, %esi
+	testl	%eax, %eax
+	js	.L235
+.L240:
+	movq	136(%rbx), %rax
+	movl	(%rax), %edx
+	movq	144(%rbx), %rax
+	movl	(%rax), %esi
+	cmpl	%esi, %edx
+	je	.L214
+	xorl	%ecx, %ecx
+	pxor	%xmm0, %xmm0
+	jmp	.L227
+	.p2align 4,,10
+	.p2align 3
+.L348:
+	addq	24(%rdi), %rax
+	movq	%rax, 24(%rdi)
+	cmpq	16(%rdi), %rax
+	jb	.L342
+.L226:
+	addl	$1, %edx
+	movq	%rax, 40(%rdi)
+	addq	$1, %rcx
+	movl	$2, 8(%rdi)
+	subq	$1, 56(%rbx)
+	cmpl	%edx, %esi
+	je	.L347
+.L227:
+	movl	%edx, %eax
+	andl	152(%rbx), %eax
+	salq	$4, %rax
+	addq	160(%rbx), %rax
+	movq	(%rax), %r8
+	movslq	8(%rax), %rax
+	leaq	(%r8,%r8,2), %rdi
+	salq	$4, %rdi
+	addq	24(%rbx), %rdi
+	cmpl	$-4, %eax
+	je	.L342
+	cmpl	$-11, %eax
+	je	.L342
+	testl	%eax, %eax
+	jg	.L348
+	jne	.L226
+	movq	24(%rdi), %rax
+	jmp	.L226
+	.p2align 4,,10
+	.p2align 3
+.L233:
+	js	.L349
+.L235:
+	movq	0(%rbp), %rax
+.L237:
+	movq	264(%rbx), %rdx
+	andq	%rax, %rdx
+	salq	$4, %rdx
+	addq	256(%rbx), %rdx
+	movq	(%rdx), %rcx
+	subq	$1, %rcx
+	cmpq	%rax, %rcx
+	jne	.L233
+	leaq	1(%rax), %rcx
+	lock cmpxchgq	%rcx, 0(%rbp)
+	jne	.L237
+	movq	264(%rbx), %rdi
+	movq	8(%rdx), %rcx
+	addq	$1, %rsi
+	leaq	1(%rax,%rdi), %rax
+	movq	%rax, (%rdx)
+	leaq	(%rcx,%rcx,2), %rax
+	salq	$4, %rax
+	addq	24(%rbx), %rax
+	movl	$2, 8(%rax)
+	subq	$1, 56(%rbx)
+	movq	0(%rbp), %rax
+	jmp	.L237
+	.p2align 4,,10
+	.p2align 3
+.L349:
+	addq	%rsi, %r12
+.L231:
+	cmpq	%r15, %r12
+	jb	.L212
+.L148:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%r12, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L342:
+	.cfi_restore_state
+	movq	120(%rbx), %rax
+	movl	(%rax), %r10d
+	movl	%r10d, %eax
+	andl	128(%rbx), %eax
+	salq	$6, %rax
+	addq	104(%rbx), %rax
+	movups	%xmm0, (%rax)
+	movups	%xmm0, 16(%rax)
+	movups	%xmm0, 32(%rax)
+	movups	%xmm0, 48(%rax)
+	cmpb	$0, 68(%rbx)
+	je	.L222
+	movzbl	4(%rdi), %r11d
+	movw	%r8w, 40(%rax)
+	leal	4(%r11), %r9d
+	movb	%r9b, (%rax)
+.L223:
+	movl	(%rdi), %r9d
+	movq	24(%rdi), %r11
+	addl	$1, %r10d
+	addl	$1, %edx
+	movl	%r9d, 4(%rax)
+	movq	32(%rdi), %r9
+	movq	16(%rdi), %rdi
+	addq	%r11, %r9
+	movq	%r9, 8(%rax)
+	movq	16(%rbx), %r9
+	subl	%r11d, %edi
+	imulq	%r8, %r9
+	addq	%r11, %r9
+	addq	(%rbx), %r9
+	movl	%edi, 24(%rax)
+	movq	%r9, 16(%rax)
+	movq	%r8, 32(%rax)
+	movq	120(%rbx), %rax
+	movl	%r10d, (%rax)
+	movl	168(%rbx), %eax
+	addl	$1, %eax
+	movl	%eax, 168(%rbx)
+	cmpl	%edx, %esi
+	jne	.L227
+.L347:
+	addq	%rcx, %r12
+.L214:
+	movq	136(%rbx), %rax
+	movl	%esi, (%rax)
+	movl	168(%rbx), %edx
+	testl	%edx, %edx
+	jne	.L232
+	jmp	.L231
+	.p2align 4,,10
+	.p2align 3
+.L229:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L231
+	movl	168(%rbx), %edx
+.L232:
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 168
+	movl	64(%rbx), %esi
+	movl	$426, %edi
+	xorl	%r9d, %r9d
+	pushq	$0
+	.cfi_def_cfa_offset 176
+	xorl	%r8d, %r8d
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%rsi
+	.cfi_def_cfa_offset 168
+	popq	%rdi
+	.cfi_def_cfa_offset 160
+	testq	%rax, %rax
+	js	.L229
+	subl	%eax, 168(%rbx)
+	jmp	.L231
+	.p2align 4,,10
+	.p2align 3
+.L222:
+	movzbl	4(%rdi), %r14d
+	leal	22(%r14), %r9d
+	movb	%r9b, (%rax)
+	jmp	.L223
+	.p2align 4,,10
+	.p2align 3
+.L239:
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %r14
+	movq	192(%rbx), %rax
+	movq	(%rax), %r8
+	testq	%r14, %r14
+	je	.L244
+	cmpq	(%r14), %r8
+	jne	.L245
+	movq	128(%r14), %rcx
+	movq	136(%r14), %r10
+	leaq	64(%r14), %rsi
+	leaq	128(%r14), %rdi
+	leaq	-1(%rcx), %rax
+	movq	%rax, 128(%r14)
+	lock orq	$0, (%rsp)
+	movq	64(%r14), %r9
+	cmpq	%r9, %rax
+	jge	.L246
+	movq	%rcx, 128(%r14)
+.L247:
+	movq	112(%r8), %rax
+	leaq	112(%r8), %rdx
+	testq	%rax, %rax
+	jne	.L251
+	movq	16(%r8), %rsi
+.L256:
+	movq	16(%r14), %rdx
+	movq	%rdx, %rax
+	salq	$13, %rax
+	xorq	%rdx, %rax
+	movq	%rax, %rdx
+	shrq	$7, %rdx
+	xorq	%rax, %rdx
+	movq	%rdx, %rax
+	salq	$17, %rax
+	xorq	%rdx, %rax
+	xorl	%edx, %edx
+	movq	%rax, 16(%r14)
+	divq	%rsi
+	movq	%rdx, %rcx
+.L252:
+	leaq	(%rcx,%rsi), %rdi
+	testq	%rsi, %rsi
+	jne	.L262
+	jmp	.L263
+	.p2align 4,,10
+	.p2align 3
+.L260:
+	addq	$1, %rcx
+	cmpq	%rdi, %rcx
+	je	.L263
+.L262:
+	movq	%rcx, %rax
+	xorl	%edx, %edx
+	divq	%rsi
+	movq	(%r8), %rax
+	movq	(%rax,%rdx,8), %rdx
+	cmpq	%r14, %rdx
+	je	.L260
+	movq	64(%rdx), %rax
+	leaq	64(%rdx), %r9
+	lock orq	$0, (%rsp)
+	movq	128(%rdx), %r10
+	cmpq	%r10, %rax
+	jge	.L260
+	movq	136(%rdx), %r10
+	movq	(%r10), %rdx
+	movq	8(%r10), %r10
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%r10,%rdx,8), %r13
+	leaq	1(%rax), %rdx
+	lock cmpxchgq	%rdx, (%r9)
+	jne	.L260
+.L249:
+	movq	48(%r13), %rax
+	movq	%r13, %rdi
+	leaq	32(%rsp), %r14
+	call	*(%rax)
+.LEHE4:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 32(%rsp)
+	movaps	%xmm0, 48(%rsp)
+	movaps	%xmm0, 64(%rsp)
+	movaps	%xmm0, 80(%rsp)
+	cmpq	%r14, %r13
+	je	.L264
+	movq	48(%r13), %rax
+	testq	%rax, %rax
+	je	.L264
+	movq	56(%r13), %rsi
+	movq	%r13, %rdi
+.LEHB5:
+	call	*16(%rax)
+	movq	$0, 48(%r13)
+	movq	80(%rsp), %rax
+	testq	%rax, %rax
+	je	.L264
+	movq	%r13, %rsi
+	movq	%r14, %rdi
+	call	*8(%rax)
+.LEHE5:
+	movdqa	80(%rsp), %xmm2
+	movaps	%xmm2, 48(%r13)
+.L264:
+	movq	64(%r13), %rax
+	lock subq	$1, (%rax)
+	jmp	.L267
+.L263:
+	cmpl	$63, (%rsp)
+	ja	.L350
+	rep nop
+	addl	$1, (%rsp)
+	jmp	.L267
+	.p2align 4,,10
+	.p2align 3
+.L278:
+	movq	120(%rbx), %rdx
+	movl	(%rdx), %r9d
+	movl	%r9d, %edx
+	andl	128(%rbx), %edx
+	salq	$6, %rdx
+	addq	104(%rbx), %rdx
+	movups	%xmm0, (%rdx)
+	movups	%xmm0, 16(%rdx)
+	movups	%xmm0, 32(%rdx)
+	movups	%xmm0, 48(%rdx)
+	cmpb	$0, 68(%rbx)
+	movzbl	4(%rax), %r11d
+	je	.L339
+	leal	4(%r11), %r8d
+	movw	%di, 40(%rdx)
+	movb	%r8b, (%rdx)
+.L197:
+	movl	(%rax), %r8d
+	movq	24(%rax), %r10
+	addl	$1, %ecx
+	movl	%r8d, 4(%rdx)
+	movq	32(%rax), %r8
+	addq	%r10, %r8
+	movq	%r8, 8(%rdx)
+	movq	16(%rbx), %r8
+	imulq	%rdi, %r8
+	addq	%r10, %r8
+	addq	(%rbx), %r8
+	movq	%r8, 16(%rdx)
+	movq	16(%rax), %r8
+	leal	1(%r9), %eax
+	movq	%rdi, 32(%rdx)
+	subl	%r10d, %r8d
+	movl	%r8d, 24(%rdx)
+	movq	120(%rbx), %rdx
+	movl	%eax, (%rdx)
+	movl	168(%rbx), %eax
+	addl	$1, %eax
+	movl	%eax, 168(%rbx)
+	cmpl	%ecx, %esi
+	jne	.L201
+.L188:
+	movq	136(%rbx), %rax
+	movl	%esi, (%rax)
+	movl	168(%rbx), %edx
+	testl	%edx, %edx
+	jne	.L206
+	jmp	.L205
+	.p2align 4,,10
+	.p2align 3
+.L203:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L205
+	movl	168(%rbx), %edx
+.L206:
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 168
+	movl	64(%rbx), %esi
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	pushq	$0
+	.cfi_def_cfa_offset 176
+	xorl	%ecx, %ecx
+	movl	$426, %edi
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%r8
+	.cfi_def_cfa_offset 168
+	popq	%r9
+	.cfi_def_cfa_offset 160
+	testq	%rax, %rax
+	js	.L203
+	subl	%eax, 168(%rbx)
+	jmp	.L205
+	.p2align 4,,10
+	.p2align 3
+.L245:
+	movq	112(%r8), %rcx
+	leaq	112(%r8), %rdx
+	testq	%rcx, %rcx
+	jne	.L275
+	movq	16(%r8), %rsi
+	xorl	%r14d, %r14d
+	jmp	.L252
+.L196:
+	movzbl	4(%rax), %r11d
+.L339:
+	leal	22(%r11), %r8d
+	movb	%r8b, (%rdx)
+	jmp	.L197
+.L345:
+	movq	120(%rbx), %rdx
+	movl	(%rdx), %r9d
+	movl	%r9d, %edx
+	andl	128(%rbx), %edx
+	salq	$6, %rdx
+	addq	104(%rbx), %rdx
+	movups	%xmm0, (%rdx)
+	movups	%xmm0, 16(%rdx)
+	movups	%xmm0, 32(%rdx)
+	movups	%xmm0, 48(%rdx)
+	cmpb	$0, 68(%rbx)
+	je	.L196
+	movzbl	4(%rax), %r14d
+	movw	%di, 40(%rdx)
+	leal	4(%r14), %r8d
+	movb	%r8b, (%rdx)
+	jmp	.L197
+.L275:
+	xorl	%r14d, %r14d
+.L251:
+	leaq	32(%r8), %rdi
+	movq	%r8, 16(%rsp)
+	movq	%rdi, 8(%rsp)
+	movq	%rdx, 24(%rsp)
+	call	pthread_mutex_lock@PLT
+	movq	16(%rsp), %r8
+	movq	8(%rsp), %rdi
+	movq	104(%r8), %rax
+	cmpq	88(%r8), %rax
+	je	.L253
+	movq	72(%r8), %rcx
+	movq	24(%rsp), %rdx
+	leaq	1(%rax), %rsi
+	movq	%rsi, 104(%r8)
+	movq	(%rcx,%rax,8), %r13
+	lock subq	$1, (%rdx)
+	movq	88(%r8), %rax
+	cmpq	%rax, 104(%r8)
+	jne	.L337
+	movq	$0, 88(%r8)
+	movq	$0, 104(%r8)
+.L337:
+	call	pthread_mutex_unlock@PLT
+	jmp	.L249
+.L246:
+	movq	(%r10), %rdx
+	movq	8(%r10), %r10
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%r10,%rdx,8), %r13
+	cmpq	%r9, %rax
+	jne	.L249
+	lock cmpxchgq	%rcx, (%rsi)
+	movq	%rcx, (%rdi)
+	je	.L249
+	jmp	.L247
+	.p2align 4,,10
+	.p2align 3
+.L350:
+	call	sched_yield@PLT
+	jmp	.L267
+.L244:
+	movq	112(%r8), %rcx
+	leaq	112(%r8), %rdx
+	testq	%rcx, %rcx
+	jne	.L251
+	movq	16(%r8), %rsi
+	jmp	.L252
+.L253:
+	movq	%r8, 8(%rsp)
+	call	pthread_mutex_unlock@PLT
+	movq	8(%rsp), %r8
+	movq	16(%r8), %rsi
+	testq	%r14, %r14
+	jne	.L256
+	xorl	%ecx, %ecx
+	jmp	.L252
+.L343:
+	movl	168(%rdi), %edx
+	testl	%edx, %edx
+	jne	.L153
+	jmp	.L150
+	.p2align 4,,10
+	.p2align 3
+.L151:
+	call	__errno_location@PLT
+	movl	64(%rbx), %esi
+	cmpl	$4, (%rax)
+	jne	.L152
+	movl	168(%rbx), %edx
+.L153:
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 168
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	xorl	%ecx, %ecx
+	pushq	$0
+	.cfi_def_cfa_offset 176
+	movl	$426, %edi
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%r10
+	.cfi_def_cfa_offset 168
+	popq	%r11
+	.cfi_def_cfa_offset 160
+	testq	%rax, %rax
+	js	.L151
+	subl	%eax, 168(%rbx)
+	movl	64(%rbx), %esi
+	jmp	.L152
+.L344:
+	movq	192(%rdi), %rax
+	movq	%rax, (%rsp)
+	leaq	8(%rax), %rbp
+.L156:
+	movq	0(%rbp), %rax
+	testq	%rax, %rax
+	movq	(%rsp), %rax
+	je	.L351
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %r14
+	movq	(%rax), %r8
+	testq	%r14, %r14
+	je	.L157
+	cmpq	(%r14), %r8
+	jne	.L158
+	movq	128(%r14), %rdx
+	movq	136(%r14), %r10
+	leaq	64(%r14), %rsi
+	leaq	128(%r14), %rdi
+	leaq	-1(%rdx), %rax
+	movq	%rax, 128(%r14)
+	lock orq	$0, (%rsp)
+	movq	64(%r14), %r9
+	cmpq	%r9, %rax
+	jge	.L159
+	movq	%rdx, 128(%r14)
+.L160:
+	movq	112(%r8), %rax
+	leaq	112(%r8), %rdx
+	testq	%rax, %rax
+	jne	.L164
+	movq	16(%r8), %rsi
+.L167:
+	movq	16(%r14), %rdx
+	movq	%rdx, %rax
+	salq	$13, %rax
+	xorq	%rdx, %rax
+	movq	%rax, %rdx
+	shrq	$7, %rdx
+	xorq	%rax, %rdx
+	movq	%rdx, %rax
+	salq	$17, %rax
+	xorq	%rdx, %rax
+	xorl	%edx, %edx
+	movq	%rax, 16(%r14)
+	divq	%rsi
+	movq	%rdx, %rcx
+.L165:
+	leaq	(%rcx,%rsi), %rdi
+	testq	%rsi, %rsi
+	jne	.L174
+	jmp	.L175
+	.p2align 4,,10
+	.p2align 3
+.L172:
+	addq	$1, %rcx
+	cmpq	%rcx, %rdi
+	je	.L175
+.L174:
+	movq	%rcx, %rax
+	xorl	%edx, %edx
+	divq	%rsi
+	movq	(%r8), %rax
+	movq	(%rax,%rdx,8), %rdx
+	cmpq	%r14, %rdx
+	je	.L172
+	movq	64(%rdx), %rax
+	leaq	64(%rdx), %r10
+	lock orq	$0, (%rsp)
+	movq	128(%rdx), %r9
+	cmpq	%r9, %rax
+	jge	.L172
+	movq	136(%rdx), %r9
+	movq	(%r9), %rdx
+	movq	8(%r9), %r9
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%r9,%rdx,8), %r12
+	leaq	1(%rax), %rdx
+	lock cmpxchgq	%rdx, (%r10)
+	jne	.L172
+.L162:
+	movq	48(%r12), %rax
+	movq	%r12, %rdi
+	leaq	32(%rsp), %r14
+.LEHB6:
+	call	*(%rax)
+.LEHE6:
+	pxor	%xmm1, %xmm1
+	movaps	%xmm1, 32(%rsp)
+	movaps	%xmm1, 48(%rsp)
+	movaps	%xmm1, 64(%rsp)
+	movaps	%xmm1, 80(%rsp)
+	cmpq	%r14, %r12
+	je	.L176
+	movq	48(%r12), %rax
+	testq	%rax, %rax
+	je	.L176
+	movq	56(%r12), %rsi
+	movq	%r12, %rdi
+.LEHB7:
+	call	*16(%rax)
+	movq	$0, 48(%r12)
+	movq	80(%rsp), %rax
+	testq	%rax, %rax
+	je	.L176
+	movq	%r12, %rsi
+	movq	%r14, %rdi
+	call	*8(%rax)
+.LEHE7:
+	movdqa	80(%rsp), %xmm3
+	movaps	%xmm3, 48(%r12)
+.L176:
+	movq	64(%r12), %rax
+	lock subq	$1, (%rax)
+	jmp	.L156
+.L175:
+	call	sched_yield@PLT
+	jmp	.L156
+.L158:
+	movq	112(%r8), %rcx
+	leaq	112(%r8), %rdx
+	testq	%rcx, %rcx
+	jne	.L272
+	movq	16(%r8), %rsi
+	xorl	%r14d, %r14d
+	jmp	.L165
+.L272:
+	xorl	%r14d, %r14d
+.L164:
+	leaq	32(%r8), %rdi
+	movq	%rdx, 24(%rsp)
+	movq	%r8, 16(%rsp)
+	movq	%rdi, 8(%rsp)
+	call	pthread_mutex_lock@PLT
+	movq	16(%rsp), %r8
+	movq	8(%rsp), %rdi
+	movq	24(%rsp), %rdx
+	movq	104(%r8), %rax
+	cmpq	88(%r8), %rax
+	jne	.L166
+	movq	%r8, 8(%rsp)
+	call	pthread_mutex_unlock@PLT
+	movq	8(%rsp), %r8
+	movq	16(%r8), %rsi
+	testq	%r14, %r14
+	jne	.L167
+	xorl	%ecx, %ecx
+	jmp	.L165
+.L159:
+	movq	(%r10), %rcx
+	movq	8(%r10), %r10
+	subq	$1, %rcx
+	andq	%rax, %rcx
+	movq	(%r10,%rcx,8), %r12
+	cmpq	%r9, %rax
+	jne	.L162
+	lock cmpxchgq	%rdx, (%rsi)
+	movq	%rdx, (%rdi)
+	je	.L162
+	jmp	.L160
+	.p2align 4,,10
+	.p2align 3
+.L157:
+	movq	112(%r8), %rcx
+	leaq	112(%r8), %rdx
+	testq	%rcx, %rcx
+	jne	.L164
+	movq	16(%r8), %rsi
+	jmp	.L165
+.L166:
+	movq	72(%r8), %rcx
+	leaq	1(%rax), %rsi
+	movq	%rsi, 104(%r8)
+	movq	(%rcx,%rax,8), %r12
+	lock subq	$1, (%rdx)
+	movq	88(%r8), %rax
+	cmpq	%rax, 104(%r8)
+	jne	.L338
+	movq	$0, 88(%r8)
+	movq	$0, 104(%r8)
+.L338:
+	call	pthread_mutex_unlock@PLT
+	jmp	.L162
+.L351:
+	addq	$16, %rax
+	movq	%rax, 8(%rsp)
+	movq	%rax, %r12
+.L181:
+	movq	8(%r12), %rbp
+	leaq	16(%r12), %r13
+	xorl	%r14d, %r14d
+	testq	%rbp, %rbp
+	je	.L185
+	.p2align 4,,10
+	.p2align 3
+.L186:
+	movq	48(%r13), %rcx
+	testq	%rcx, %rcx
+	je	.L183
+	addq	$1, %r14
+	movq	56(%r13), %rsi
+	movq	%r13, %rdi
+	addq	$80, %r13
+	call	*16(%rcx)
+	cmpq	%r14, %rbp
+	jne	.L186
+.L185:
+	movq	$0, 8(%r12)
+	movq	(%r12), %r12
+	testq	%r12, %r12
+	jne	.L181
+	movq	(%rsp), %rax
+	movq	8(%rsp), %rsi
+	movq	%rsi, 672(%rax)
+	jmp	.L155
+	.p2align 4,,10
+	.p2align 3
+.L183:
+	addq	$1, %r14
+	addq	$80, %r13
+	cmpq	%r14, %rbp
+	jne	.L186
+	jmp	.L185
+.L276:
+	movq	%rax, %rbx
+	jmp	.L177
+.L277:
+	movq	%rax, %rbx
+	jmp	.L265
+	.section	.gcc_except_table,"a",@progbits
+.LLSDA7135:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7135-.LLSDACSB7135
+.LLSDACSB7135:
+	.uleb128 .LEHB4-.LFB7135
+	.uleb128 .LEHE4-.LEHB4
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB5-.LFB7135
+	.uleb128 .LEHE5-.LEHB5
+	.uleb128 .L277-.LFB7135
+	.uleb128 0
+	.uleb128 .LEHB6-.LFB7135
+	.uleb128 .LEHE6-.LEHB6
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB7-.LFB7135
+	.uleb128 .LEHE7-.LEHB7
+	.uleb128 .L276-.LFB7135
+	.uleb128 0
+.LLSDACSE7135:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7135
+	.type	_ZN1n7io_ring4waitEPmmm.constprop.0.cold, @function
+_ZN1n7io_ring4waitEPmmm.constprop.0.cold:
+.LFSB7135:
+.L177:
+	.cfi_def_cfa_offset 160
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	80(%rsp), %rax
+	testq	%rax, %rax
+	je	.L178
+	movq	88(%rsp), %rsi
+	movq	%r14, %rdi
+	call	*16(%rax)
+.L178:
+	movq	%rbx, %rdi
+.LEHB8:
+	call	_Unwind_Resume@PLT
+.LEHE8:
+.L265:
+	movq	80(%rsp), %rax
+	testq	%rax, %rax
+	je	.L266
+	movq	88(%rsp), %rsi
+	movq	%r14, %rdi
+	call	*16(%rax)
+.L266:
+	movq	%rbx, %rdi
+.LEHB9:
+	call	_Unwind_Resume@PLT
+.LEHE9:
+	.cfi_endproc
+.LFE7135:
+	.section	.gcc_except_table
+.LLSDAC7135:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7135-.LLSDACSBC7135
+.LLSDACSBC7135:
+	.uleb128 .LEHB8-.LCOLDB0
+	.uleb128 .LEHE8-.LEHB8
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB9-.LCOLDB0
+	.uleb128 .LEHE9-.LEHB9
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC7135:
+	.section	.text.unlikely
+	.text
+	.size	_ZN1n7io_ring4waitEPmmm.constprop.0, .-_ZN1n7io_ring4waitEPmmm.constprop.0
+	.section	.text.unlikely
+	.size	_ZN1n7io_ring4waitEPmmm.constprop.0.cold, .-_ZN1n7io_ring4waitEPmmm.constprop.0.cold
+.LCOLDE0:
+	.text
+.LHOTE0:
+	.section	.text._ZN1n11thread_pool11__find_workEv,"axG",@progbits,_ZN1n11thread_pool11__find_workEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n11thread_pool11__find_workEv
+	.type	_ZN1n11thread_pool11__find_workEv, @function
+_ZN1n11thread_pool11__find_workEv:
+.LFB6800:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movq	%rsi, %rbx
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %rbp
+	testq	%rbp, %rbp
+	je	.L353
+	cmpq	0(%rbp), %rsi
+	jne	.L354
+	movq	128(%rbp), %rcx
+	movq	136(%rbp), %rdi
+	leaq	64(%rbp), %r8
+	leaq	128(%rbp), %r9
+	leaq	-1(%rcx), %rax
+	movq	%rax, 128(%rbp)
+	lock orq	$0, (%rsp)
+	movq	64(%rbp), %rsi
+	cmpq	%rsi, %rax
+	jge	.L355
+	movq	%rcx, 128(%rbp)
+.L356:
+	movq	112(%rbx), %rax
+	leaq	112(%rbx), %r13
+	testq	%rax, %rax
+	jne	.L360
+	movq	16(%rbx), %rsi
+.L363:
+	movq	16(%rbp), %rdx
+	movq	%rdx, %rax
+	salq	$13, %rax
+	xorq	%rdx, %rax
+	movq	%rax, %rdx
+	shrq	$7, %rdx
+	xorq	%rax, %rdx
+	movq	%rdx, %rax
+	salq	$17, %rax
+	xorq	%rdx, %rax
+	xorl	%edx, %edx
+	movq	%rax, 16(%rbp)
+	divq	%rsi
+	movq	%rdx, %rcx
+	jmp	.L361
+	.p2align 4,,10
+	.p2align 3
+.L354:
+	movq	112(%rsi), %rcx
+	leaq	112(%rsi), %r13
+	testq	%rcx, %rcx
+	jne	.L372
+	movq	16(%rsi), %rsi
+	xorl	%ebp, %ebp
+.L361:
+	leaq	(%rcx,%rsi), %r8
+	testq	%rsi, %rsi
+	jne	.L370
+	jmp	.L371
+	.p2align 4,,10
+	.p2align 3
+.L367:
+	addq	$1, %rcx
+	cmpq	%rcx, %r8
+	je	.L371
+.L370:
+	movq	%rcx, %rax
+	xorl	%edx, %edx
+	divq	%rsi
+	movq	(%rbx), %rax
+	movq	(%rax,%rdx,8), %rdx
+	cmpq	%rdx, %rbp
+	je	.L367
+	movq	64(%rdx), %rax
+	leaq	64(%rdx), %r9
+	lock orq	$0, (%rsp)
+	movq	128(%rdx), %rdi
+	cmpq	%rdi, %rax
+	jge	.L367
+	movq	136(%rdx), %rdi
+	movq	(%rdi), %rdx
+	movq	8(%rdi), %rdi
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%rdi,%rdx,8), %rdx
+	leaq	1(%rax), %rdi
+	lock cmpxchgq	%rdi, (%r9)
+	jne	.L367
+.L377:
+	movb	$1, 8(%r12)
+	movq	%r12, %rax
+	movq	%rdx, (%r12)
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L372:
+	.cfi_restore_state
+	xorl	%ebp, %ebp
+.L360:
+	leaq	32(%rbx), %r14
+	movq	%r14, %rdi
+	call	pthread_mutex_lock@PLT
+	movq	104(%rbx), %rax
+	cmpq	88(%rbx), %rax
+	jne	.L362
+	movq	%r14, %rdi
+	call	pthread_mutex_unlock@PLT
+	movq	16(%rbx), %rsi
+	testq	%rbp, %rbp
+	jne	.L363
+	xorl	%ecx, %ecx
+	jmp	.L361
+	.p2align 4,,10
+	.p2align 3
+.L371:
+	pxor	%xmm0, %xmm0
+	movq	%r12, %rax
+	movups	%xmm0, (%r12)
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L355:
+	.cfi_restore_state
+	movq	(%rdi), %rdx
+	movq	8(%rdi), %rdi
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%rdi,%rdx,8), %rdx
+	cmpq	%rsi, %rax
+	jne	.L377
+	lock cmpxchgq	%rcx, (%r8)
+	movq	%rcx, (%r9)
+	je	.L377
+	jmp	.L356
+	.p2align 4,,10
+	.p2align 3
+.L362:
+	movq	72(%rbx), %rdx
+	leaq	1(%rax), %rcx
+	movq	%rcx, 104(%rbx)
+	movq	(%rdx,%rax,8), %rbp
+	lock subq	$1, 0(%r13)
+	movq	88(%rbx), %rax
+	cmpq	%rax, 104(%rbx)
+	jne	.L376
+	movq	$0, 88(%rbx)
+	movq	$0, 104(%rbx)
+.L376:
+	movq	%r14, %rdi
+	call	pthread_mutex_unlock@PLT
+	movb	$1, 8(%r12)
+	movq	%r12, %rax
+	movq	%rbp, (%r12)
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L353:
+	.cfi_restore_state
+	movq	112(%rsi), %rcx
+	leaq	112(%rsi), %r13
+	testq	%rcx, %rcx
+	jne	.L360
+	movq	16(%rsi), %rsi
+	jmp	.L361
+	.cfi_endproc
+.LFE6800:
+	.size	_ZN1n11thread_pool11__find_workEv, .-_ZN1n11thread_pool11__find_workEv
+	.section	.text._ZN1n7io_ring7__queueEimmlb,"axG",@progbits,_ZN1n7io_ring7__queueEimmlb,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n7io_ring7__queueEimmlb
+	.type	_ZN1n7io_ring7__queueEimmlb, @function
+_ZN1n7io_ring7__queueEimmlb:
+.LFB6851:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rdx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movl	64(%rdi), %edi
+	testl	%edi, %edi
+	js	.L398
+.L379:
+	xorl	%edx, %edx
+	cmpq	8(%rbx), %rbp
+	jnb	.L378
+	cmpq	%rcx, 16(%rbx)
+	jb	.L378
+	leaq	0(%rbp,%rbp,2), %rax
+	salq	$4, %rax
+	addq	24(%rbx), %rax
+	cmpl	$1, 8(%rax)
+	je	.L378
+	movl	%esi, (%rax)
+	movb	%r9b, 4(%rax)
+	movl	$1, 8(%rax)
+	movq	%rcx, 16(%rax)
+	movq	$0, 24(%rax)
+	movq	%r8, 32(%rax)
+	movq	$0, 40(%rax)
+	addq	$1, 56(%rbx)
+	testl	%edi, %edi
+	jns	.L399
+	movq	216(%rbx), %rax
+	movq	208(%rbx), %r12
+	movq	200(%rbx), %r13
+	cmpq	%r12, %rax
+	je	.L400
+	movq	%rbp, 0(%r13,%rax,8)
+	movq	216(%rbx), %rdx
+.L387:
+	addq	$1, %rdx
+	movq	%rdx, 216(%rbx)
+.L388:
+	movl	$1, %edx
+.L378:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movl	%edx, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L398:
+	.cfi_restore_state
+	xorl	%edx, %edx
+	cmpq	$0, 192(%rbx)
+	jne	.L379
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movl	%edx, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L399:
+	.cfi_restore_state
+	movq	120(%rbx), %rdx
+	pxor	%xmm0, %xmm0
+	movl	(%rdx), %esi
+	movl	%esi, %edx
+	andl	128(%rbx), %edx
+	salq	$6, %rdx
+	addq	104(%rbx), %rdx
+	movups	%xmm0, (%rdx)
+	movups	%xmm0, 16(%rdx)
+	movups	%xmm0, 32(%rdx)
+	movups	%xmm0, 48(%rdx)
+	cmpb	$0, 68(%rbx)
+	movzbl	4(%rax), %edi
+	je	.L382
+	leal	4(%rdi), %ecx
+	movw	%bp, 40(%rdx)
+	movb	%cl, (%rdx)
+.L383:
+	movl	(%rax), %ecx
+	movq	24(%rax), %rdi
+	addl	$1, %esi
+	movl	%ecx, 4(%rdx)
+	movq	32(%rax), %rcx
+	movq	16(%rax), %rax
+	addq	%rdi, %rcx
+	movq	%rcx, 8(%rdx)
+	movq	16(%rbx), %rcx
+	subl	%edi, %eax
+	imulq	%rbp, %rcx
+	addq	%rdi, %rcx
+	addq	(%rbx), %rcx
+	movl	%eax, 24(%rdx)
+	movq	%rcx, 16(%rdx)
+	movq	120(%rbx), %rax
+	movq	%rbp, 32(%rdx)
+	movl	%esi, (%rax)
+	addl	$1, 168(%rbx)
+	jmp	.L388
+	.p2align 4,,10
+	.p2align 3
+.L382:
+	leal	22(%rdi), %ecx
+	movb	%cl, (%rdx)
+	jmp	.L383
+	.p2align 4,,10
+	.p2align 3
+.L400:
+	movq	224(%rbx), %rdi
+	leaq	5(%r12), %rsi
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 208(%rbx)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	216(%rbx), %rdx
+	movq	%rax, 200(%rbx)
+	movq	%rbp, (%rax,%rdx,8)
+	movq	216(%rbx), %rdx
+	testq	%rdx, %rdx
+	jne	.L401
+	testq	%r13, %r13
+	je	.L387
+.L386:
+	movq	224(%rbx), %rdi
+	leaq	0(,%r12,8), %rdx
+	movl	$8, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	216(%rbx), %rdx
+	jmp	.L387
+	.p2align 4,,10
+	.p2align 3
+.L401:
+	salq	$3, %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L386
+	.cfi_endproc
+.LFE6851:
+	.size	_ZN1n7io_ring7__queueEimmlb, .-_ZN1n7io_ring7__queueEimmlb
+	.section	.text.unlikely
+.LCOLDB1:
+	.text
+.LHOTB1:
+	.p2align 4
+	.type	_Z12read_patternRN1n11ring_readerEmm.constprop.1, @function
+_Z12read_patternRN1n11ring_readerEmm.constprop.1:
+.LFB7143:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7143
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$136, %rsp
+	.cfi_def_cfa_offset 192
+	movq	72(%rdi), %r9
+	movq	80(%rdi), %rdi
+	cmpq	%rdi, %r9
+	jb	.L403
+	cmpb	$0, 88(%rbp)
+	jne	.L565
+.L405:
+	movq	56(%rbp), %rax
+	cmpq	48(%rbp), %rax
+	je	.L427
+	cmpb	$0, 89(%rbp)
+	je	.L566
+.L427:
+	xorl	%eax, %eax
+.L402:
+	addq	$136, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L566:
+	.cfi_restore_state
+	xorl	%edx, %edx
+	movq	16(%rbp), %rbx
+	movq	0(%rbp), %r12
+	divq	24(%rbp)
+	addq	%rdx, %rbx
+	leaq	(%rbx,%rbx,2), %r13
+	salq	$4, %r13
+	jmp	.L428
+	.p2align 4,,10
+	.p2align 3
+.L430:
+	movl	$1, %esi
+	movq	%r12, %rdi
+.LEHB10:
+	call	_ZN1n7io_ring4waitEPmmm.constprop.0
+	testq	%rax, %rax
+	je	.L429
+.L428:
+	movq	24(%r12), %rax
+	addq	%r13, %rax
+	cmpl	$1, 8(%rax)
+	je	.L430
+	movq	40(%rax), %rdi
+	addq	$1, 56(%rbp)
+	testq	%rdi, %rdi
+	jle	.L567
+	movq	0(%rbp), %rax
+	movq	%rdi, %r12
+	movq	16(%rax), %rdx
+	movq	(%rax), %rsi
+	movq	%rdi, 80(%rbp)
+	movb	$1, 88(%rbp)
+	cmpq	%rdx, %rdi
+	setb	89(%rbp)
+	imulq	%rdx, %rbx
+	xorl	%r9d, %r9d
+	addq	%rbx, %rsi
+	movq	%rsi, 64(%rbp)
+	jmp	.L433
+.L565:
+	cmpb	$0, 89(%rbp)
+	movq	0(%rbp), %rbx
+	movb	$0, 88(%rbp)
+	jne	.L406
+	movq	32(%rbp), %rax
+	movq	40(%rbp), %r8
+	testq	%rax, %rax
+	js	.L407
+	cmpq	%r8, %rax
+	jle	.L406
+.L407:
+	movq	48(%rbp), %rax
+	xorl	%edx, %edx
+	movq	16(%rbx), %rcx
+	movq	%rbx, %rdi
+	movl	8(%rbp), %esi
+	xorl	%r9d, %r9d
+	divq	24(%rbp)
+	addq	16(%rbp), %rdx
+	call	_ZN1n7io_ring7__queueEimmlb
+	movq	0(%rbp), %rbx
+	testb	%al, %al
+	je	.L406
+	movq	16(%rbx), %rax
+	addq	$1, 48(%rbp)
+	addq	%rax, 40(%rbp)
+.L406:
+	movl	64(%rbx), %esi
+	testl	%esi, %esi
+	jns	.L568
+	movq	216(%rbx), %rax
+	testq	%rax, %rax
+	je	.L405
+	cmpq	56(%rbx), %rax
+	je	.L569
+.L413:
+	movq	%rbx, %rdi
+	call	_ZN1n7io_ring6submitEv.part.0
+	jmp	.L405
+.L403:
+	movq	64(%rbp), %rsi
+	movq	%rdi, %r12
+	subq	%r9, %r12
+	addq	%r9, %rsi
+.L433:
+	movl	$3000, %eax
+	movl	$1, %ebx
+	cmpq	%rax, %r12
+	cmova	%rax, %r12
+	xorl	%r13d, %r13d
+	addq	%r12, %r9
+	.p2align 4,,10
+	.p2align 3
+.L501:
+	leaq	(%r12,%r13), %rax
+	movq	%r9, 72(%rbp)
+	leaq	0(%r13,%r13,4), %rcx
+	movq	%rax, (%rsp)
+	leaq	(%rax,%rax,4), %r8
+	.p2align 4,,10
+	.p2align 3
+.L436:
+	testb	%bl, %bl
+	je	.L435
+	movabsq	$367465021388636487, %rax
+	mulq	%rcx
+	movq	%rcx, %rax
+	subq	%rdx, %rax
+	shrq	%rax
+	addq	%rax, %rdx
+	movq	%rcx, %rax
+	shrq	$7, %rdx
+	imulq	$251, %rdx, %rdx
+	subq	%rdx, %rax
+	cmpb	%al, (%rsi)
+	sete	%bl
+.L435:
+	addq	$5, %rcx
+	addq	$1, %rsi
+	cmpq	%rcx, %r8
+	jne	.L436
+	movq	(%rsp), %r13
+	cmpq	%rdi, %r9
+	jb	.L437
+	cmpb	$0, 88(%rbp)
+	jne	.L570
+.L439:
+	movq	56(%rbp), %rax
+	cmpq	48(%rbp), %rax
+	je	.L488
+	cmpb	$0, 89(%rbp)
+	jne	.L488
+	xorl	%edx, %edx
+	movq	0(%rbp), %r15
+	divq	24(%rbp)
+	addq	16(%rbp), %rdx
+	leaq	(%rdx,%rdx,2), %r14
+	movq	%rdx, %r12
+	salq	$4, %r14
+	jmp	.L489
+	.p2align 4,,10
+	.p2align 3
+.L491:
+	movl	$1, %esi
+	movq	%r15, %rdi
+	call	_ZN1n7io_ring4waitEPmmm.constprop.0
+	testq	%rax, %rax
+	je	.L506
+.L489:
+	movq	24(%r15), %rax
+	addq	%r14, %rax
+	cmpl	$1, 8(%rax)
+	je	.L491
+	movq	40(%rax), %rdi
+.L490:
+	addq	$1, 56(%rbp)
+	testq	%rdi, %rdi
+	jle	.L571
+	movq	0(%rbp), %rax
+	movq	%r12, %rsi
+	movq	%rdi, %r12
+	movq	16(%rax), %rdx
+	cmpq	%rdx, %rdi
+	setb	89(%rbp)
+	imulq	%rdx, %rsi
+	addq	(%rax), %rsi
+	xorl	%r9d, %r9d
+	movq	%rsi, 64(%rbp)
+	movq	%rdi, 80(%rbp)
+	movb	$1, 88(%rbp)
+.L494:
+	movl	$3000, %eax
+	cmpq	%rax, %r12
+	cmova	%rax, %r12
+	addq	%r12, %r9
+	jmp	.L501
+.L571:
+	movl	%edi, %eax
+	xorl	%edx, %edx
+	movb	$1, 89(%rbp)
+	negl	%eax
+	testq	%rdi, %rdi
+	cmove	%edx, %eax
+	movl	%eax, 92(%rbp)
+	.p2align 4,,10
+	.p2align 3
+.L488:
+	cmpq	$123457, (%rsp)
+	sete	%al
+	andl	%ebx, %eax
+	jmp	.L402
+	.p2align 4,,10
+	.p2align 3
+.L437:
+	movq	64(%rbp), %rsi
+	movq	%rdi, %r12
+	subq	%r9, %r12
+	addq	%r9, %rsi
+	jmp	.L494
+	.p2align 4,,10
+	.p2align 3
+.L570:
+	movq	0(%rbp), %r14
+	cmpb	$0, 89(%rbp)
+	movb	$0, 88(%rbp)
+	movl	64(%r14), %esi
+	jne	.L440
+	movq	32(%rbp), %rax
+	movq	40(%rbp), %rcx
+	testq	%rax, %rax
+	js	.L441
+	cmpq	%rcx, %rax
+	jle	.L440
+.L441:
+	movq	48(%rbp), %rax
+	xorl	%edx, %edx
+	movl	8(%rbp), %edi
+	divq	24(%rbp)
+	addq	16(%rbp), %rdx
+	movq	%rdx, %r12
+	movq	16(%r14), %rdx
+	testl	%esi, %esi
+	js	.L572
+	cmpq	8(%r14), %r12
+	jnb	.L498
+	leaq	(%r12,%r12,2), %rax
+	salq	$4, %rax
+	addq	24(%r14), %rax
+	cmpl	$1, 8(%rax)
+	je	.L498
+.L502:
+	movl	%edi, (%rax)
+	movb	$0, 4(%rax)
+	movl	$1, 8(%rax)
+	movq	%rdx, 16(%rax)
+	movq	$0, 24(%rax)
+	movq	%rcx, 32(%rax)
+	movq	$0, 40(%rax)
+	addq	$1, 56(%r14)
+	testl	%esi, %esi
+	jns	.L573
+	movq	216(%r14), %rax
+	movq	208(%r14), %rcx
+	movq	200(%r14), %r15
+	cmpq	%rcx, %rax
+	je	.L574
+	movq	%r12, (%r15,%rax,8)
+	movq	216(%r14), %rax
+	movq	%r14, %rdx
+.L452:
+	addq	$1, %rax
+	movq	%rax, 216(%r14)
+	movq	%rdx, %r14
+.L448:
+	movq	16(%r14), %rax
+	addq	$1, 48(%rbp)
+	addq	%rax, 40(%rbp)
+.L440:
+	testl	%esi, %esi
+	jns	.L498
+.L444:
+	movq	216(%r14), %rax
+	testq	%rax, %rax
+	je	.L439
+	cmpq	56(%r14), %rax
+	je	.L575
+.L456:
+	movq	%r14, %rdi
+	call	_ZN1n7io_ring6submitEv.part.0
+	jmp	.L439
+	.p2align 4,,10
+	.p2align 3
+.L506:
+	movq	$-5, %rdi
+	jmp	.L490
+.L498:
+	movl	168(%r14), %edx
+	testl	%edx, %edx
+	jne	.L455
+	jmp	.L439
+	.p2align 4,,10
+	.p2align 3
+.L454:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L439
+	movl	168(%r14), %edx
+	movl	64(%r14), %esi
+.L455:
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 200
+	xorl	%ecx, %ecx
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	pushq	$0
+	.cfi_def_cfa_offset 208
+	movl	$426, %edi
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%rdx
+	.cfi_def_cfa_offset 200
+	popq	%rcx
+	.cfi_def_cfa_offset 192
+	testq	%rax, %rax
+	js	.L454
+	subl	%eax, 168(%r14)
+	jmp	.L439
+.L572:
+	cmpq	$0, 192(%r14)
+	je	.L444
+	cmpq	8(%r14), %r12
+	jnb	.L444
+	imulq	$48, %r12, %rax
+	addq	24(%r14), %rax
+	cmpl	$1, 8(%rax)
+	jne	.L502
+	jmp	.L444
+	.p2align 4,,10
+	.p2align 3
+.L573:
+	movq	120(%r14), %rdx
+	pxor	%xmm0, %xmm0
+	movl	(%rdx), %esi
+	movl	%esi, %edx
+	andl	128(%r14), %edx
+	salq	$6, %rdx
+	addq	104(%r14), %rdx
+	movups	%xmm0, (%rdx)
+	movups	%xmm0, 16(%rdx)
+	movups	%xmm0, 32(%rdx)
+	movups	%xmm0, 48(%rdx)
+	cmpb	$0, 68(%r14)
+	movzbl	4(%rax), %edi
+	je	.L446
+	leal	4(%rdi), %ecx
+	movw	%r12w, 40(%rdx)
+	movb	%cl, (%rdx)
+.L447:
+	movl	(%rax), %ecx
+	movq	24(%rax), %rdi
+	addl	$1, %esi
+	movl	%ecx, 4(%rdx)
+	movq	32(%rax), %rcx
+	movq	16(%rax), %rax
+	addq	%rdi, %rcx
+	movq	%rcx, 8(%rdx)
+	movq	16(%r14), %rcx
+	subl	%edi, %eax
+	imulq	%r12, %rcx
+	addq	%rdi, %rcx
+	addq	(%r14), %rcx
+	movl	%eax, 24(%rdx)
+	movq	%rcx, 16(%rdx)
+	movq	120(%r14), %rax
+	movq	%r12, 32(%rdx)
+	movl	%esi, (%rax)
+	addl	$1, 168(%r14)
+	movq	0(%rbp), %r14
+	movl	64(%r14), %esi
+	jmp	.L448
+.L568:
+	movl	168(%rbx), %edx
+	testl	%edx, %edx
+	jne	.L412
+	jmp	.L405
+	.p2align 4,,10
+	.p2align 3
+.L411:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L405
+	movl	168(%rbx), %edx
+	movl	64(%rbx), %esi
+.L412:
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 200
+	movl	$426, %edi
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	pushq	$0
+	.cfi_def_cfa_offset 208
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%rsi
+	.cfi_def_cfa_offset 200
+	popq	%rdi
+	.cfi_def_cfa_offset 192
+	testq	%rax, %rax
+	js	.L411
+	subl	%eax, 168(%rbx)
+	jmp	.L405
+.L575:
+	movq	192(%r14), %rax
+	movq	%rax, 8(%rsp)
+	addq	$8, %rax
+	movq	%rax, 16(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L457:
+	movq	16(%rsp), %rax
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	movq	8(%rsp), %rax
+	je	.L576
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %r15
+	movq	(%rax), %r8
+	testq	%r15, %r15
+	je	.L458
+	cmpq	(%r15), %r8
+	jne	.L459
+	movq	128(%r15), %rcx
+	movq	136(%r15), %r10
+	leaq	64(%r15), %rsi
+	leaq	128(%r15), %rdi
+	leaq	-1(%rcx), %rax
+	movq	%rax, 128(%r15)
+	lock orq	$0, (%rsp)
+	movq	64(%r15), %r9
+	cmpq	%r9, %rax
+	jge	.L460
+	movq	%rcx, 128(%r15)
+.L461:
+	movq	112(%r8), %rax
+	leaq	112(%r8), %rdx
+	testq	%rax, %rax
+	jne	.L465
+	movq	16(%r8), %rsi
+.L470:
+	movq	16(%r15), %rdx
+	movq	%rdx, %rax
+	salq	$13, %rax
+	xorq	%rdx, %rax
+	movq	%rax, %rdx
+	shrq	$7, %rdx
+	xorq	%rax, %rdx
+	movq	%rdx, %rax
+	salq	$17, %rax
+	xorq	%rdx, %rax
+	xorl	%edx, %edx
+	movq	%rax, 16(%r15)
+	divq	%rsi
+	movq	%rdx, %rcx
+.L466:
+	leaq	(%rsi,%rcx), %rdi
+	testq	%rsi, %rsi
+	jne	.L475
+	jmp	.L476
+	.p2align 4,,10
+	.p2align 3
+.L473:
+	addq	$1, %rcx
+	cmpq	%rcx, %rdi
+	je	.L476
+.L475:
+	movq	%rcx, %rax
+	xorl	%edx, %edx
+	divq	%rsi
+	movq	(%r8), %rax
+	movq	(%rax,%rdx,8), %rdx
+	cmpq	%r15, %rdx
+	je	.L473
+	movq	64(%rdx), %rax
+	leaq	64(%rdx), %r11
+	lock orq	$0, (%rsp)
+	movq	128(%rdx), %r9
+	cmpq	%r9, %rax
+	jge	.L473
+	movq	136(%rdx), %r9
+	movq	(%r9), %rdx
+	movq	8(%r9), %r9
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%r9,%rdx,8), %r10
+	leaq	1(%rax), %rdx
+	lock cmpxchgq	%rdx, (%r11)
+	jne	.L473
+	movq	%r10, %r12
+.L463:
+	movq	48(%r12), %rax
+	movq	%r12, %rdi
+	leaq	64(%rsp), %r15
+	call	*(%rax)
+.LEHE10:
+	pxor	%xmm1, %xmm1
+	movaps	%xmm1, 64(%rsp)
+	movaps	%xmm1, 80(%rsp)
+	movaps	%xmm1, 96(%rsp)
+	movaps	%xmm1, 112(%rsp)
+	cmpq	%r15, %r12
+	je	.L477
+	movq	48(%r12), %rax
+	testq	%rax, %rax
+	je	.L477
+	movq	56(%r12), %rsi
+	movq	%r12, %rdi
+.LEHB11:
+	call	*16(%rax)
+	movq	$0, 48(%r12)
+	movq	112(%rsp), %rax
+	testq	%rax, %rax
+	je	.L477
+	movq	%r12, %rsi
+	movq	%r15, %rdi
+	call	*8(%rax)
+.LEHE11:
+	movdqa	112(%rsp), %xmm2
+	movaps	%xmm2, 48(%r12)
+.L477:
+	movq	64(%r12), %rax
+	lock subq	$1, (%rax)
+	jmp	.L457
+.L476:
+	call	sched_yield@PLT
+	jmp	.L457
+.L459:
+	movq	112(%r8), %rcx
+	leaq	112(%r8), %rdx
+	testq	%rcx, %rcx
+	jne	.L505
+	movq	16(%r8), %rsi
+	xorl	%r15d, %r15d
+	jmp	.L466
+.L505:
+	xorl	%r15d, %r15d
+.L465:
+	leaq	32(%r8), %rdi
+	movq	%r8, 32(%rsp)
+	movq	%rdi, 24(%rsp)
+	movq	%rdx, 40(%rsp)
+	call	pthread_mutex_lock@PLT
+	movq	32(%rsp), %r8
+	movq	24(%rsp), %rdi
+	movq	104(%r8), %rax
+	cmpq	88(%r8), %rax
+	je	.L467
+	movq	72(%r8), %rcx
+	movq	40(%rsp), %rdx
+	leaq	1(%rax), %rsi
+	movq	%rsi, 104(%r8)
+	movq	(%rcx,%rax,8), %r12
+	lock subq	$1, (%rdx)
+	movq	88(%r8), %rax
+	cmpq	%rax, 104(%r8)
+	jne	.L564
+	movq	$0, 88(%r8)
+	movq	$0, 104(%r8)
+.L564:
+	call	pthread_mutex_unlock@PLT
+	jmp	.L463
+.L460:
+	movq	(%r10), %rdx
+	movq	8(%r10), %r10
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%r10,%rdx,8), %r12
+	cmpq	%r9, %rax
+	jne	.L463
+	lock cmpxchgq	%rcx, (%rsi)
+	movq	%rcx, (%rdi)
+	je	.L463
+	jmp	.L461
+	.p2align 4,,10
+	.p2align 3
+.L458:
+	movq	112(%r8), %rcx
+	leaq	112(%r8), %rdx
+	testq	%rcx, %rcx
+	jne	.L465
+	movq	16(%r8), %rsi
+	jmp	.L466
+.L467:
+	movq	%r8, 24(%rsp)
+	call	pthread_mutex_unlock@PLT
+	movq	24(%rsp), %r8
+	movq	16(%r8), %rsi
+	testq	%r15, %r15
+	jne	.L470
+	xorl	%ecx, %ecx
+	jmp	.L466
+.L576:
+	addq	$16, %rax
+	movb	%bl, 16(%rsp)
+	movq	%rax, 24(%rsp)
+	movq	%rax, %r15
+	movq	%rbp, 32(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L482:
+	movq	8(%r15), %r12
+	leaq	16(%r15), %rbp
+	xorl	%ebx, %ebx
+	testq	%r12, %r12
+	je	.L486
+	.p2align 4,,10
+	.p2align 3
+.L487:
+	movq	48(%rbp), %rcx
+	testq	%rcx, %rcx
+	je	.L484
+	addq	$1, %rbx
+	movq	56(%rbp), %rsi
+	movq	%rbp, %rdi
+	addq	$80, %rbp
+	call	*16(%rcx)
+	cmpq	%rbx, %r12
+	jne	.L487
+.L486:
+	movq	$0, 8(%r15)
+	movq	(%r15), %r15
+	testq	%r15, %r15
+	jne	.L482
+	movq	24(%rsp), %rax
+	movq	8(%rsp), %rdi
+	movzbl	16(%rsp), %ebx
+	movq	32(%rsp), %rbp
+	movq	%rax, 672(%rdi)
+	jmp	.L456
+	.p2align 4,,10
+	.p2align 3
+.L484:
+	addq	$1, %rbx
+	addq	$80, %rbp
+	cmpq	%rbx, %r12
+	jne	.L487
+	jmp	.L486
+.L446:
+	leal	22(%rdi), %ecx
+	movb	%cl, (%rdx)
+	jmp	.L447
+.L567:
+	jne	.L503
+	xorl	%edi, %edi
+.L432:
+	movl	%edi, 92(%rbp)
+	movb	$1, 89(%rbp)
+	jmp	.L427
+.L429:
+	addq	$1, 56(%rbp)
+	movq	$-5, %rdi
+.L503:
+	negl	%edi
+	jmp	.L432
+.L574:
+	leaq	5(%rcx), %rax
+	movq	224(%r14), %rdi
+	movq	%rcx, 8(%rsp)
+	leaq	(%rax,%rax), %rdx
+	salq	$4, %rax
+	movq	%rax, %rsi
+	movq	(%rdi), %rax
+	movq	%rdx, 208(%r14)
+	movl	$8, %edx
+.LEHB12:
+	call	*16(%rax)
+	movq	8(%rsp), %rcx
+	movq	%rax, 200(%r14)
+	movq	%rax, %rdi
+	movq	216(%r14), %rax
+	movq	%r12, (%rdi,%rax,8)
+	movq	216(%r14), %rax
+	testq	%rax, %rax
+	jne	.L577
+	testq	%r15, %r15
+	je	.L563
+.L451:
+	movq	224(%r14), %rdi
+	leaq	0(,%rcx,8), %rdx
+	movq	%r15, %rsi
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	216(%r14), %rax
+.L563:
+	movq	0(%rbp), %rdx
+	movl	64(%rdx), %esi
+	jmp	.L452
+.L569:
+	leaq	48(%rsp), %rax
+	movq	192(%rbx), %r13
+	movq	%rax, (%rsp)
+	leaq	8(%r13), %r14
+.L414:
+	movq	(%r14), %rax
+	testq	%rax, %rax
+	je	.L578
+.L419:
+	movq	0(%r13), %rsi
+	movq	(%rsp), %rdi
+	call	_ZN1n11thread_pool11__find_workEv
+	cmpb	$0, 56(%rsp)
+	je	.L415
+	movq	48(%rsp), %r12
+	leaq	64(%rsp), %r15
+	movq	48(%r12), %rax
+	movq	%r12, %rdi
+	call	*(%rax)
+.LEHE12:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 64(%rsp)
+	movaps	%xmm0, 80(%rsp)
+	movaps	%xmm0, 96(%rsp)
+	movaps	%xmm0, 112(%rsp)
+	cmpq	%r15, %r12
+	je	.L416
+	movq	48(%r12), %rax
+	testq	%rax, %rax
+	je	.L416
+	movq	56(%r12), %rsi
+	movq	%r12, %rdi
+.LEHB13:
+	call	*16(%rax)
+	movq	$0, 48(%r12)
+	movq	112(%rsp), %rax
+	testq	%rax, %rax
+	je	.L416
+	movq	%r12, %rsi
+	movq	%r15, %rdi
+	call	*8(%rax)
+.LEHE13:
+	movdqa	112(%rsp), %xmm3
+	movaps	%xmm3, 48(%r12)
+.L416:
+	movq	64(%r12), %rax
+	lock subq	$1, (%rax)
+	movq	(%r14), %rax
+	testq	%rax, %rax
+	jne	.L419
+.L578:
+	movq	%rbx, (%rsp)
+	leaq	16(%r13), %r12
+	movq	%rbp, 8(%rsp)
+	movq	%r12, %r15
+.L421:
+	movq	8(%r15), %r14
+	leaq	16(%r15), %rbp
+	xorl	%ebx, %ebx
+	testq	%r14, %r14
+	je	.L425
+	.p2align 4,,10
+	.p2align 3
+.L426:
+	movq	48(%rbp), %rcx
+	testq	%rcx, %rcx
+	je	.L423
+	addq	$1, %rbx
+	movq	56(%rbp), %rsi
+	movq	%rbp, %rdi
+	addq	$80, %rbp
+	call	*16(%rcx)
+	cmpq	%rbx, %r14
+	jne	.L426
+.L425:
+	movq	$0, 8(%r15)
+	movq	(%r15), %r15
+	testq	%r15, %r15
+	jne	.L421
+	movq	(%rsp), %rbx
+	movq	8(%rsp), %rbp
+	movq	%r12, 672(%r13)
+	jmp	.L413
+	.p2align 4,,10
+	.p2align 3
+.L423:
+	addq	$1, %rbx
+	addq	$80, %rbp
+	cmpq	%rbx, %r14
+	jne	.L426
+	jmp	.L425
+.L415:
+	call	sched_yield@PLT
+	jmp	.L414
+.L577:
+	leaq	0(,%rax,8), %rdx
+	movq	%r15, %rsi
+	call	memcpy@PLT
+	movq	8(%rsp), %rcx
+	jmp	.L451
+.L508:
+	movq	%rax, %rbx
+	jmp	.L417
+.L509:
+	movq	%rax, %rbx
+	jmp	.L478
+	.section	.gcc_except_table
+.LLSDA7143:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7143-.LLSDACSB7143
+.LLSDACSB7143:
+	.uleb128 .LEHB10-.LFB7143
+	.uleb128 .LEHE10-.LEHB10
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB11-.LFB7143
+	.uleb128 .LEHE11-.LEHB11
+	.uleb128 .L509-.LFB7143
+	.uleb128 0
+	.uleb128 .LEHB12-.LFB7143
+	.uleb128 .LEHE12-.LEHB12
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB13-.LFB7143
+	.uleb128 .LEHE13-.LEHB13
+	.uleb128 .L508-.LFB7143
+	.uleb128 0
+.LLSDACSE7143:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7143
+	.type	_Z12read_patternRN1n11ring_readerEmm.constprop.1.cold, @function
+_Z12read_patternRN1n11ring_readerEmm.constprop.1.cold:
+.LFSB7143:
+.L417:
+	.cfi_def_cfa_offset 192
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	112(%rsp), %rax
+	testq	%rax, %rax
+	je	.L418
+	movq	120(%rsp), %rsi
+	movq	%r15, %rdi
+	call	*16(%rax)
+.L418:
+	movq	%rbx, %rdi
+.LEHB14:
+	call	_Unwind_Resume@PLT
+.LEHE14:
+.L478:
+	movq	112(%rsp), %rax
+	testq	%rax, %rax
+	je	.L479
+	movq	120(%rsp), %rsi
+	movq	%r15, %rdi
+	call	*16(%rax)
+.L479:
+	movq	%rbx, %rdi
+.LEHB15:
+	call	_Unwind_Resume@PLT
+.LEHE15:
+	.cfi_endproc
+.LFE7143:
+	.section	.gcc_except_table
+.LLSDAC7143:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7143-.LLSDACSBC7143
+.LLSDACSBC7143:
+	.uleb128 .LEHB14-.LCOLDB1
+	.uleb128 .LEHE14-.LEHB14
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB15-.LCOLDB1
+	.uleb128 .LEHE15-.LEHB15
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC7143:
+	.section	.text.unlikely
+	.text
+	.size	_Z12read_patternRN1n11ring_readerEmm.constprop.1, .-_Z12read_patternRN1n11ring_readerEmm.constprop.1
+	.section	.text.unlikely
+	.size	_Z12read_patternRN1n11ring_readerEmm.constprop.1.cold, .-_Z12read_patternRN1n11ring_readerEmm.constprop.1.cold
+.LCOLDE1:
+	.text
+.LHOTE1:
+	.section	.text.unlikely
+.LCOLDB2:
+	.text
+.LHOTB2:
+	.p2align 4
+	.type	_Z12read_patternRN1n11ring_readerEmm.constprop.2, @function
+_Z12read_patternRN1n11ring_readerEmm.constprop.2:
+.LFB7145:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7145
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$136, %rsp
+	.cfi_def_cfa_offset 192
+	movq	72(%rdi), %r10
+	movq	80(%rdi), %rsi
+	cmpq	%rsi, %r10
+	jb	.L580
+	cmpb	$0, 88(%rdi)
+	jne	.L742
+.L582:
+	movq	56(%rbp), %rax
+	cmpq	48(%rbp), %rax
+	je	.L604
+	cmpb	$0, 89(%rbp)
+	je	.L743
+.L604:
+	xorl	%eax, %eax
+.L579:
+	addq	$136, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L743:
+	.cfi_restore_state
+	xorl	%edx, %edx
+	movq	16(%rbp), %rbx
+	movq	0(%rbp), %r12
+	divq	24(%rbp)
+	addq	%rdx, %rbx
+	leaq	(%rbx,%rbx,2), %r13
+	salq	$4, %r13
+	jmp	.L605
+	.p2align 4,,10
+	.p2align 3
+.L607:
+	movl	$1, %esi
+	movq	%r12, %rdi
+.LEHB16:
+	call	_ZN1n7io_ring4waitEPmmm.constprop.0
+	testq	%rax, %rax
+	je	.L606
+.L605:
+	movq	24(%r12), %rax
+	addq	%r13, %rax
+	cmpl	$1, 8(%rax)
+	je	.L607
+	movq	40(%rax), %rsi
+	addq	$1, 56(%rbp)
+	testq	%rsi, %rsi
+	jle	.L744
+	movq	0(%rbp), %rax
+	movq	%rsi, %r9
+	movq	16(%rax), %rdx
+	movq	(%rax), %rcx
+	movq	%rsi, 80(%rbp)
+	movb	$1, 88(%rbp)
+	cmpq	%rdx, %rsi
+	setb	89(%rbp)
+	imulq	%rdx, %rbx
+	xorl	%r10d, %r10d
+	addq	%rbx, %rcx
+	movq	%rcx, 64(%rbp)
+	jmp	.L610
+.L742:
+	cmpb	$0, 89(%rdi)
+	movq	(%rdi), %rbx
+	movb	$0, 88(%rdi)
+	jne	.L583
+	movq	32(%rdi), %rax
+	movq	40(%rdi), %r8
+	testq	%rax, %rax
+	js	.L584
+	cmpq	%r8, %rax
+	jle	.L583
+.L584:
+	movq	48(%rbp), %rax
+	xorl	%edx, %edx
+	movq	16(%rbx), %rcx
+	movq	%rbx, %rdi
+	movl	8(%rbp), %esi
+	xorl	%r9d, %r9d
+	divq	24(%rbp)
+	addq	16(%rbp), %rdx
+	call	_ZN1n7io_ring7__queueEimmlb
+	movq	0(%rbp), %rbx
+	testb	%al, %al
+	je	.L583
+	movq	16(%rbx), %rax
+	addq	$1, 48(%rbp)
+	addq	%rax, 40(%rbp)
+.L583:
+	movl	64(%rbx), %esi
+	testl	%esi, %esi
+	jns	.L745
+	movq	216(%rbx), %rax
+	testq	%rax, %rax
+	je	.L582
+	cmpq	56(%rbx), %rax
+	je	.L746
+.L590:
+	movq	%rbx, %rdi
+	call	_ZN1n7io_ring6submitEv.part.0
+	jmp	.L582
+.L580:
+	movq	64(%rdi), %rcx
+	movq	%rsi, %r9
+	subq	%r10, %r9
+	addq	%r10, %rcx
+.L610:
+	movl	$3000, %eax
+	movl	$1, %ebx
+	movq	$0, (%rsp)
+	movabsq	$367465021388636487, %r13
+	cmpq	%rax, %r9
+	cmova	%rax, %r9
+	addq	%r9, %r10
+	.p2align 4,,10
+	.p2align 3
+.L678:
+	movq	(%rsp), %rax
+	movq	%r10, 72(%rbp)
+	leaq	(%rcx,%r9), %r8
+	leaq	0(,%rax,8), %rdi
+	subq	%rax, %rdi
+	.p2align 4,,10
+	.p2align 3
+.L613:
+	testb	%bl, %bl
+	je	.L612
+	movq	%rdi, %rax
+	mulq	%r13
+	movq	%rdi, %rax
+	subq	%rdx, %rax
+	shrq	%rax
+	addq	%rax, %rdx
+	movq	%rdi, %rax
+	shrq	$7, %rdx
+	imulq	$251, %rdx, %rdx
+	subq	%rdx, %rax
+	cmpb	%al, (%rcx)
+	sete	%bl
+.L612:
+	addq	$1, %rcx
+	addq	$7, %rdi
+	cmpq	%rcx, %r8
+	jne	.L613
+	addq	%r9, (%rsp)
+	cmpq	%rsi, %r10
+	jb	.L614
+	cmpb	$0, 88(%rbp)
+	jne	.L747
+.L616:
+	movq	56(%rbp), %rax
+	cmpq	48(%rbp), %rax
+	je	.L665
+	cmpb	$0, 89(%rbp)
+	jne	.L665
+	xorl	%edx, %edx
+	movq	0(%rbp), %r14
+	divq	24(%rbp)
+	addq	16(%rbp), %rdx
+	leaq	(%rdx,%rdx,2), %r15
+	movq	%rdx, %r12
+	salq	$4, %r15
+	jmp	.L666
+	.p2align 4,,10
+	.p2align 3
+.L668:
+	movl	$1, %esi
+	movq	%r14, %rdi
+	call	_ZN1n7io_ring4waitEPmmm.constprop.0
+	testq	%rax, %rax
+	je	.L683
+.L666:
+	movq	24(%r14), %rax
+	addq	%r15, %rax
+	cmpl	$1, 8(%rax)
+	je	.L668
+	movq	40(%rax), %rsi
+.L667:
+	addq	$1, 56(%rbp)
+	testq	%rsi, %rsi
+	jle	.L748
+	movq	0(%rbp), %rax
+	movq	%r12, %rcx
+	movq	%rsi, %r9
+	movq	16(%rax), %rdx
+	cmpq	%rdx, %rsi
+	setb	89(%rbp)
+	imulq	%rdx, %rcx
+	addq	(%rax), %rcx
+	xorl	%r10d, %r10d
+	movq	%rcx, 64(%rbp)
+	movq	%rsi, 80(%rbp)
+	movb	$1, 88(%rbp)
+.L671:
+	movl	$3000, %eax
+	cmpq	%rax, %r9
+	cmova	%rax, %r9
+	addq	%r9, %r10
+	jmp	.L678
+.L748:
+	movl	%esi, %eax
+	xorl	%edx, %edx
+	movb	$1, 89(%rbp)
+	negl	%eax
+	testq	%rsi, %rsi
+	cmove	%edx, %eax
+	movl	%eax, 92(%rbp)
+	.p2align 4,,10
+	.p2align 3
+.L665:
+	cmpq	$1000003, (%rsp)
+	sete	%al
+	andl	%ebx, %eax
+	jmp	.L579
+	.p2align 4,,10
+	.p2align 3
+.L614:
+	movq	64(%rbp), %rcx
+	movq	%rsi, %r9
+	subq	%r10, %r9
+	addq	%r10, %rcx
+	jmp	.L671
+	.p2align 4,,10
+	.p2align 3
+.L747:
+	movq	0(%rbp), %r14
+	cmpb	$0, 89(%rbp)
+	movb	$0, 88(%rbp)
+	movl	64(%r14), %esi
+	jne	.L617
+	movq	32(%rbp), %rax
+	movq	40(%rbp), %rcx
+	testq	%rax, %rax
+	js	.L618
+	cmpq	%rcx, %rax
+	jle	.L617
+.L618:
+	movq	48(%rbp), %rax
+	xorl	%edx, %edx
+	movl	8(%rbp), %edi
+	divq	24(%rbp)
+	addq	16(%rbp), %rdx
+	movq	%rdx, %r12
+	movq	16(%r14), %rdx
+	testl	%esi, %esi
+	js	.L749
+	cmpq	8(%r14), %r12
+	jnb	.L675
+	leaq	(%r12,%r12,2), %rax
+	salq	$4, %rax
+	addq	24(%r14), %rax
+	cmpl	$1, 8(%rax)
+	je	.L675
+.L679:
+	movl	%edi, (%rax)
+	movb	$0, 4(%rax)
+	movl	$1, 8(%rax)
+	movq	%rdx, 16(%rax)
+	movq	$0, 24(%rax)
+	movq	%rcx, 32(%rax)
+	movq	$0, 40(%rax)
+	addq	$1, 56(%r14)
+	testl	%esi, %esi
+	jns	.L750
+	movq	216(%r14), %rax
+	movq	208(%r14), %rcx
+	movq	200(%r14), %r15
+	cmpq	%rcx, %rax
+	je	.L751
+	movq	%r12, (%r15,%rax,8)
+	movq	216(%r14), %rax
+	movq	%r14, %rdx
+.L629:
+	addq	$1, %rax
+	movq	%rax, 216(%r14)
+	movq	%rdx, %r14
+.L625:
+	movq	16(%r14), %rax
+	addq	$1, 48(%rbp)
+	addq	%rax, 40(%rbp)
+.L617:
+	testl	%esi, %esi
+	jns	.L675
+.L621:
+	movq	216(%r14), %rax
+	testq	%rax, %rax
+	je	.L616
+	cmpq	56(%r14), %rax
+	je	.L752
+.L633:
+	movq	%r14, %rdi
+	call	_ZN1n7io_ring6submitEv.part.0
+	jmp	.L616
+	.p2align 4,,10
+	.p2align 3
+.L683:
+	movq	$-5, %rsi
+	jmp	.L667
+.L675:
+	movl	168(%r14), %edx
+	testl	%edx, %edx
+	jne	.L632
+	jmp	.L616
+	.p2align 4,,10
+	.p2align 3
+.L631:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L616
+	movl	168(%r14), %edx
+	movl	64(%r14), %esi
+.L632:
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 200
+	xorl	%ecx, %ecx
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	pushq	$0
+	.cfi_def_cfa_offset 208
+	movl	$426, %edi
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%rdx
+	.cfi_def_cfa_offset 200
+	popq	%rcx
+	.cfi_def_cfa_offset 192
+	testq	%rax, %rax
+	js	.L631
+	subl	%eax, 168(%r14)
+	jmp	.L616
+.L749:
+	cmpq	$0, 192(%r14)
+	je	.L621
+	cmpq	8(%r14), %r12
+	jnb	.L621
+	imulq	$48, %r12, %rax
+	addq	24(%r14), %rax
+	cmpl	$1, 8(%rax)
+	jne	.L679
+	jmp	.L621
+	.p2align 4,,10
+	.p2align 3
+.L750:
+	movq	120(%r14), %rdx
+	pxor	%xmm0, %xmm0
+	movl	(%rdx), %esi
+	movl	%esi, %edx
+	andl	128(%r14), %edx
+	salq	$6, %rdx
+	addq	104(%r14), %rdx
+	movups	%xmm0, (%rdx)
+	movups	%xmm0, 16(%rdx)
+	movups	%xmm0, 32(%rdx)
+	movups	%xmm0, 48(%rdx)
+	cmpb	$0, 68(%r14)
+	movzbl	4(%rax), %edi
+	je	.L623
+	leal	4(%rdi), %ecx
+	movw	%r12w, 40(%rdx)
+	movb	%cl, (%rdx)
+.L624:
+	movl	(%rax), %ecx
+	movq	24(%rax), %rdi
+	addl	$1, %esi
+	movl	%ecx, 4(%rdx)
+	movq	32(%rax), %rcx
+	movq	16(%rax), %rax
+	addq	%rdi, %rcx
+	movq	%rcx, 8(%rdx)
+	movq	16(%r14), %rcx
+	subl	%edi, %eax
+	imulq	%r12, %rcx
+	addq	%rdi, %rcx
+	addq	(%r14), %rcx
+	movl	%eax, 24(%rdx)
+	movq	%rcx, 16(%rdx)
+	movq	120(%r14), %rax
+	movq	%r12, 32(%rdx)
+	movl	%esi, (%rax)
+	addl	$1, 168(%r14)
+	movq	0(%rbp), %r14
+	movl	64(%r14), %esi
+	jmp	.L625
+.L745:
+	movl	168(%rbx), %edx
+	testl	%edx, %edx
+	jne	.L589
+	jmp	.L582
+	.p2align 4,,10
+	.p2align 3
+.L588:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L582
+	movl	168(%rbx), %edx
+	movl	64(%rbx), %esi
+.L589:
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 200
+	movl	$426, %edi
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	pushq	$0
+	.cfi_def_cfa_offset 208
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%rsi
+	.cfi_def_cfa_offset 200
+	popq	%rdi
+	.cfi_def_cfa_offset 192
+	testq	%rax, %rax
+	js	.L588
+	subl	%eax, 168(%rbx)
+	jmp	.L582
+.L752:
+	movq	192(%r14), %rax
+	movq	%rax, 8(%rsp)
+	addq	$8, %rax
+	movq	%rax, 16(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L634:
+	movq	16(%rsp), %rax
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	movq	8(%rsp), %rax
+	je	.L753
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %r15
+	movq	(%rax), %r8
+	testq	%r15, %r15
+	je	.L635
+	cmpq	(%r15), %r8
+	jne	.L636
+	movq	128(%r15), %rcx
+	movq	136(%r15), %r10
+	leaq	64(%r15), %rsi
+	leaq	128(%r15), %rdi
+	leaq	-1(%rcx), %rax
+	movq	%rax, 128(%r15)
+	lock orq	$0, (%rsp)
+	movq	64(%r15), %r9
+	cmpq	%r9, %rax
+	jge	.L637
+	movq	%rcx, 128(%r15)
+.L638:
+	movq	112(%r8), %rax
+	leaq	112(%r8), %rdx
+	testq	%rax, %rax
+	jne	.L642
+	movq	16(%r8), %rsi
+.L647:
+	movq	16(%r15), %rdx
+	movq	%rdx, %rax
+	salq	$13, %rax
+	xorq	%rdx, %rax
+	movq	%rax, %rdx
+	shrq	$7, %rdx
+	xorq	%rax, %rdx
+	movq	%rdx, %rax
+	salq	$17, %rax
+	xorq	%rdx, %rax
+	xorl	%edx, %edx
+	movq	%rax, 16(%r15)
+	divq	%rsi
+	movq	%rdx, %rcx
+.L643:
+	leaq	(%rsi,%rcx), %rdi
+	testq	%rsi, %rsi
+	jne	.L652
+	jmp	.L653
+	.p2align 4,,10
+	.p2align 3
+.L650:
+	addq	$1, %rcx
+	cmpq	%rcx, %rdi
+	je	.L653
+.L652:
+	movq	%rcx, %rax
+	xorl	%edx, %edx
+	divq	%rsi
+	movq	(%r8), %rax
+	movq	(%rax,%rdx,8), %rdx
+	cmpq	%rdx, %r15
+	je	.L650
+	movq	64(%rdx), %rax
+	leaq	64(%rdx), %r11
+	lock orq	$0, (%rsp)
+	movq	128(%rdx), %r9
+	cmpq	%r9, %rax
+	jge	.L650
+	movq	136(%rdx), %r9
+	movq	(%r9), %rdx
+	movq	8(%r9), %r9
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%r9,%rdx,8), %r10
+	leaq	1(%rax), %rdx
+	lock cmpxchgq	%rdx, (%r11)
+	jne	.L650
+	movq	%r10, %r12
+.L640:
+	movq	48(%r12), %rax
+	movq	%r12, %rdi
+	leaq	64(%rsp), %r15
+	call	*(%rax)
+.LEHE16:
+	pxor	%xmm1, %xmm1
+	movaps	%xmm1, 64(%rsp)
+	movaps	%xmm1, 80(%rsp)
+	movaps	%xmm1, 96(%rsp)
+	movaps	%xmm1, 112(%rsp)
+	cmpq	%r15, %r12
+	je	.L654
+	movq	48(%r12), %rax
+	testq	%rax, %rax
+	je	.L654
+	movq	56(%r12), %rsi
+	movq	%r12, %rdi
+.LEHB17:
+	call	*16(%rax)
+	movq	$0, 48(%r12)
+	movq	112(%rsp), %rax
+	testq	%rax, %rax
+	je	.L654
+	movq	%r12, %rsi
+	movq	%r15, %rdi
+	call	*8(%rax)
+.LEHE17:
+	movdqa	112(%rsp), %xmm2
+	movaps	%xmm2, 48(%r12)
+.L654:
+	movq	64(%r12), %rax
+	lock subq	$1, (%rax)
+	jmp	.L634
+.L653:
+	call	sched_yield@PLT
+	jmp	.L634
+.L636:
+	movq	112(%r8), %rcx
+	leaq	112(%r8), %rdx
+	testq	%rcx, %rcx
+	jne	.L682
+	movq	16(%r8), %rsi
+	xorl	%r15d, %r15d
+	jmp	.L643
+.L682:
+	xorl	%r15d, %r15d
+.L642:
+	leaq	32(%r8), %rdi
+	movq	%r8, 32(%rsp)
+	movq	%rdi, 24(%rsp)
+	movq	%rdx, 40(%rsp)
+	call	pthread_mutex_lock@PLT
+	movq	32(%rsp), %r8
+	movq	24(%rsp), %rdi
+	movq	104(%r8), %rax
+	cmpq	88(%r8), %rax
+	je	.L644
+	movq	72(%r8), %rcx
+	movq	40(%rsp), %rdx
+	leaq	1(%rax), %rsi
+	movq	%rsi, 104(%r8)
+	movq	(%rcx,%rax,8), %r12
+	lock subq	$1, (%rdx)
+	movq	88(%r8), %rax
+	cmpq	%rax, 104(%r8)
+	jne	.L741
+	movq	$0, 88(%r8)
+	movq	$0, 104(%r8)
+.L741:
+	call	pthread_mutex_unlock@PLT
+	jmp	.L640
+.L637:
+	movq	(%r10), %rdx
+	movq	8(%r10), %r10
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%r10,%rdx,8), %r12
+	cmpq	%r9, %rax
+	jne	.L640
+	lock cmpxchgq	%rcx, (%rsi)
+	movq	%rcx, (%rdi)
+	je	.L640
+	jmp	.L638
+	.p2align 4,,10
+	.p2align 3
+.L635:
+	movq	112(%r8), %rcx
+	leaq	112(%r8), %rdx
+	testq	%rcx, %rcx
+	jne	.L642
+	movq	16(%r8), %rsi
+	jmp	.L643
+.L644:
+	movq	%r8, 24(%rsp)
+	call	pthread_mutex_unlock@PLT
+	movq	24(%rsp), %r8
+	movq	16(%r8), %rsi
+	testq	%r15, %r15
+	jne	.L647
+	xorl	%ecx, %ecx
+	jmp	.L643
+.L753:
+	addq	$16, %rax
+	movb	%bl, 16(%rsp)
+	movq	%rax, 24(%rsp)
+	movq	%rax, %r15
+	movq	%rbp, 32(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L659:
+	movq	8(%r15), %r12
+	leaq	16(%r15), %rbp
+	xorl	%ebx, %ebx
+	testq	%r12, %r12
+	je	.L663
+	.p2align 4,,10
+	.p2align 3
+.L664:
+	movq	48(%rbp), %rcx
+	testq	%rcx, %rcx
+	je	.L661
+	addq	$1, %rbx
+	movq	56(%rbp), %rsi
+	movq	%rbp, %rdi
+	addq	$80, %rbp
+	call	*16(%rcx)
+	cmpq	%rbx, %r12
+	jne	.L664
+.L663:
+	movq	$0, 8(%r15)
+	movq	(%r15), %r15
+	testq	%r15, %r15
+	jne	.L659
+	movq	24(%rsp), %rax
+	movq	8(%rsp), %rsi
+	movzbl	16(%rsp), %ebx
+	movq	32(%rsp), %rbp
+	movq	%rax, 672(%rsi)
+	jmp	.L633
+	.p2align 4,,10
+	.p2align 3
+.L661:
+	addq	$1, %rbx
+	addq	$80, %rbp
+	cmpq	%rbx, %r12
+	jne	.L664
+	jmp	.L663
+.L623:
+	leal	22(%rdi), %ecx
+	movb	%cl, (%rdx)
+	jmp	.L624
+.L744:
+	jne	.L680
+	xorl	%esi, %esi
+.L609:
+	movl	%esi, 92(%rbp)
+	movb	$1, 89(%rbp)
+	jmp	.L604
+.L606:
+	addq	$1, 56(%rbp)
+	movq	$-5, %rsi
+.L680:
+	negl	%esi
+	jmp	.L609
+.L751:
+	leaq	5(%rcx), %rax
+	movq	224(%r14), %rdi
+	movq	%rcx, 8(%rsp)
+	leaq	(%rax,%rax), %rdx
+	salq	$4, %rax
+	movq	%rax, %rsi
+	movq	(%rdi), %rax
+	movq	%rdx, 208(%r14)
+	movl	$8, %edx
+.LEHB18:
+	call	*16(%rax)
+	movq	8(%rsp), %rcx
+	movq	%rax, 200(%r14)
+	movq	%rax, %rdi
+	movq	216(%r14), %rax
+	movq	%r12, (%rdi,%rax,8)
+	movq	216(%r14), %rax
+	testq	%rax, %rax
+	jne	.L754
+	testq	%r15, %r15
+	je	.L740
+.L628:
+	movq	224(%r14), %rdi
+	leaq	0(,%rcx,8), %rdx
+	movq	%r15, %rsi
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	216(%r14), %rax
+.L740:
+	movq	0(%rbp), %rdx
+	movl	64(%rdx), %esi
+	jmp	.L629
+.L746:
+	leaq	48(%rsp), %rax
+	movq	192(%rbx), %r13
+	movq	%rax, (%rsp)
+	leaq	8(%r13), %r14
+.L591:
+	movq	(%r14), %rax
+	testq	%rax, %rax
+	je	.L755
+.L596:
+	movq	0(%r13), %rsi
+	movq	(%rsp), %rdi
+	call	_ZN1n11thread_pool11__find_workEv
+	cmpb	$0, 56(%rsp)
+	je	.L592
+	movq	48(%rsp), %r12
+	leaq	64(%rsp), %r15
+	movq	48(%r12), %rax
+	movq	%r12, %rdi
+	call	*(%rax)
+.LEHE18:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 64(%rsp)
+	movaps	%xmm0, 80(%rsp)
+	movaps	%xmm0, 96(%rsp)
+	movaps	%xmm0, 112(%rsp)
+	cmpq	%r15, %r12
+	je	.L593
+	movq	48(%r12), %rax
+	testq	%rax, %rax
+	je	.L593
+	movq	56(%r12), %rsi
+	movq	%r12, %rdi
+.LEHB19:
+	call	*16(%rax)
+	movq	$0, 48(%r12)
+	movq	112(%rsp), %rax
+	testq	%rax, %rax
+	je	.L593
+	movq	%r12, %rsi
+	movq	%r15, %rdi
+	call	*8(%rax)
+.LEHE19:
+	movdqa	112(%rsp), %xmm3
+	movaps	%xmm3, 48(%r12)
+.L593:
+	movq	64(%r12), %rax
+	lock subq	$1, (%rax)
+	movq	(%r14), %rax
+	testq	%rax, %rax
+	jne	.L596
+.L755:
+	movq	%rbx, (%rsp)
+	leaq	16(%r13), %r12
+	movq	%rbp, 8(%rsp)
+	movq	%r12, %r15
+.L598:
+	movq	8(%r15), %r14
+	leaq	16(%r15), %rbp
+	xorl	%ebx, %ebx
+	testq	%r14, %r14
+	je	.L602
+	.p2align 4,,10
+	.p2align 3
+.L603:
+	movq	48(%rbp), %rcx
+	testq	%rcx, %rcx
+	je	.L600
+	addq	$1, %rbx
+	movq	56(%rbp), %rsi
+	movq	%rbp, %rdi
+	addq	$80, %rbp
+	call	*16(%rcx)
+	cmpq	%rbx, %r14
+	jne	.L603
+.L602:
+	movq	$0, 8(%r15)
+	movq	(%r15), %r15
+	testq	%r15, %r15
+	jne	.L598
+	movq	(%rsp), %rbx
+	movq	8(%rsp), %rbp
+	movq	%r12, 672(%r13)
+	jmp	.L590
+	.p2align 4,,10
+	.p2align 3
+.L600:
+	addq	$1, %rbx
+	addq	$80, %rbp
+	cmpq	%rbx, %r14
+	jne	.L603
+	jmp	.L602
+.L592:
+	call	sched_yield@PLT
+	jmp	.L591
+.L754:
+	leaq	0(,%rax,8), %rdx
+	movq	%r15, %rsi
+	call	memcpy@PLT
+	movq	8(%rsp), %rcx
+	jmp	.L628
+.L685:
+	movq	%rax, %rbx
+	jmp	.L594
+.L686:
+	movq	%rax, %rbx
+	jmp	.L655
+	.section	.gcc_except_table
+.LLSDA7145:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7145-.LLSDACSB7145
+.LLSDACSB7145:
+	.uleb128 .LEHB16-.LFB7145
+	.uleb128 .LEHE16-.LEHB16
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB17-.LFB7145
+	.uleb128 .LEHE17-.LEHB17
+	.uleb128 .L686-.LFB7145
+	.uleb128 0
+	.uleb128 .LEHB18-.LFB7145
+	.uleb128 .LEHE18-.LEHB18
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB19-.LFB7145
+	.uleb128 .LEHE19-.LEHB19
+	.uleb128 .L685-.LFB7145
+	.uleb128 0
+.LLSDACSE7145:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7145
+	.type	_Z12read_patternRN1n11ring_readerEmm.constprop.2.cold, @function
+_Z12read_patternRN1n11ring_readerEmm.constprop.2.cold:
+.LFSB7145:
+.L594:
+	.cfi_def_cfa_offset 192
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	112(%rsp), %rax
+	testq	%rax, %rax
+	je	.L595
+	movq	120(%rsp), %rsi
+	movq	%r15, %rdi
+	call	*16(%rax)
+.L595:
+	movq	%rbx, %rdi
+.LEHB20:
+	call	_Unwind_Resume@PLT
+.LEHE20:
+.L655:
+	movq	112(%rsp), %rax
+	testq	%rax, %rax
+	je	.L656
+	movq	120(%rsp), %rsi
+	movq	%r15, %rdi
+	call	*16(%rax)
+.L656:
+	movq	%rbx, %rdi
+.LEHB21:
+	call	_Unwind_Resume@PLT
+.LEHE21:
+	.cfi_endproc
+.LFE7145:
+	.section	.gcc_except_table
+.LLSDAC7145:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7145-.LLSDACSBC7145
+.LLSDACSBC7145:
+	.uleb128 .LEHB20-.LCOLDB2
+	.uleb128 .LEHE20-.LEHB20
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB21-.LCOLDB2
+	.uleb128 .LEHE21-.LEHB21
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC7145:
+	.section	.text.unlikely
+	.text
+	.size	_Z12read_patternRN1n11ring_readerEmm.constprop.2, .-_Z12read_patternRN1n11ring_readerEmm.constprop.2
+	.section	.text.unlikely
+	.size	_Z12read_patternRN1n11ring_readerEmm.constprop.2.cold, .-_Z12read_patternRN1n11ring_readerEmm.constprop.2.cold
+.LCOLDE2:
+	.text
+.LHOTE2:
+	.section	.text.unlikely
+.LCOLDB3:
+	.text
+.LHOTB3:
+	.p2align 4
+	.type	_Z12read_patternRN1n11ring_readerEmm.constprop.0, @function
+_Z12read_patternRN1n11ring_readerEmm.constprop.0:
+.LFB7146:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7146
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$136, %rsp
+	.cfi_def_cfa_offset 192
+	movq	72(%rdi), %r9
+	movq	80(%rdi), %rdi
+	cmpq	%rdi, %r9
+	jb	.L757
+	cmpb	$0, 88(%rbp)
+	jne	.L919
+.L759:
+	movq	56(%rbp), %rax
+	cmpq	48(%rbp), %rax
+	je	.L781
+	cmpb	$0, 89(%rbp)
+	je	.L920
+.L781:
+	xorl	%eax, %eax
+.L756:
+	addq	$136, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L920:
+	.cfi_restore_state
+	xorl	%edx, %edx
+	movq	16(%rbp), %rbx
+	movq	0(%rbp), %r12
+	divq	24(%rbp)
+	addq	%rdx, %rbx
+	leaq	(%rbx,%rbx,2), %r13
+	salq	$4, %r13
+	jmp	.L782
+	.p2align 4,,10
+	.p2align 3
+.L784:
+	movl	$1, %esi
+	movq	%r12, %rdi
+.LEHB22:
+	call	_ZN1n7io_ring4waitEPmmm.constprop.0
+	testq	%rax, %rax
+	je	.L783
+.L782:
+	movq	24(%r12), %rax
+	addq	%r13, %rax
+	cmpl	$1, 8(%rax)
+	je	.L784
+	movq	40(%rax), %rdi
+	addq	$1, 56(%rbp)
+	testq	%rdi, %rdi
+	jle	.L921
+	movq	0(%rbp), %rax
+	movq	%rdi, %r12
+	movq	16(%rax), %rdx
+	movq	(%rax), %rsi
+	movq	%rdi, 80(%rbp)
+	movb	$1, 88(%rbp)
+	cmpq	%rdx, %rdi
+	setb	89(%rbp)
+	imulq	%rdx, %rbx
+	xorl	%r9d, %r9d
+	addq	%rbx, %rsi
+	movq	%rsi, 64(%rbp)
+	jmp	.L787
+.L919:
+	cmpb	$0, 89(%rbp)
+	movq	0(%rbp), %rbx
+	movb	$0, 88(%rbp)
+	jne	.L760
+	movq	32(%rbp), %rax
+	movq	40(%rbp), %r8
+	testq	%rax, %rax
+	js	.L761
+	cmpq	%r8, %rax
+	jle	.L760
+.L761:
+	movq	48(%rbp), %rax
+	xorl	%edx, %edx
+	movq	16(%rbx), %rcx
+	movq	%rbx, %rdi
+	movl	8(%rbp), %esi
+	xorl	%r9d, %r9d
+	divq	24(%rbp)
+	addq	16(%rbp), %rdx
+	call	_ZN1n7io_ring7__queueEimmlb
+	movq	0(%rbp), %rbx
+	testb	%al, %al
+	je	.L760
+	movq	16(%rbx), %rax
+	addq	$1, 48(%rbp)
+	addq	%rax, 40(%rbp)
+.L760:
+	movl	64(%rbx), %esi
+	testl	%esi, %esi
+	jns	.L922
+	movq	216(%rbx), %rax
+	testq	%rax, %rax
+	je	.L759
+	cmpq	56(%rbx), %rax
+	je	.L923
+.L767:
+	movq	%rbx, %rdi
+	call	_ZN1n7io_ring6submitEv.part.0
+	jmp	.L759
+.L757:
+	movq	64(%rbp), %rsi
+	movq	%rdi, %r12
+	subq	%r9, %r12
+	addq	%r9, %rsi
+.L787:
+	movl	$3000, %eax
+	movl	$1, %ebx
+	cmpq	%rax, %r12
+	cmova	%rax, %r12
+	xorl	%r13d, %r13d
+	addq	%r12, %r9
+	.p2align 4,,10
+	.p2align 3
+.L855:
+	leaq	(%r12,%r13), %rax
+	movq	%r9, 72(%rbp)
+	leaq	0(%r13,%r13,2), %rcx
+	movq	%rax, (%rsp)
+	leaq	(%rax,%rax,2), %r8
+	.p2align 4,,10
+	.p2align 3
+.L790:
+	testb	%bl, %bl
+	je	.L789
+	movabsq	$367465021388636487, %rax
+	mulq	%rcx
+	movq	%rcx, %rax
+	subq	%rdx, %rax
+	shrq	%rax
+	addq	%rax, %rdx
+	movq	%rcx, %rax
+	shrq	$7, %rdx
+	imulq	$251, %rdx, %rdx
+	subq	%rdx, %rax
+	cmpb	%al, (%rsi)
+	sete	%bl
+.L789:
+	addq	$3, %rcx
+	addq	$1, %rsi
+	cmpq	%rcx, %r8
+	jne	.L790
+	movq	(%rsp), %r13
+	cmpq	%rdi, %r9
+	jb	.L791
+	cmpb	$0, 88(%rbp)
+	jne	.L924
+.L793:
+	movq	56(%rbp), %rax
+	cmpq	48(%rbp), %rax
+	je	.L842
+	cmpb	$0, 89(%rbp)
+	jne	.L842
+	xorl	%edx, %edx
+	movq	0(%rbp), %r15
+	divq	24(%rbp)
+	addq	16(%rbp), %rdx
+	leaq	(%rdx,%rdx,2), %r14
+	movq	%rdx, %r12
+	salq	$4, %r14
+	jmp	.L843
+	.p2align 4,,10
+	.p2align 3
+.L845:
+	movl	$1, %esi
+	movq	%r15, %rdi
+	call	_ZN1n7io_ring4waitEPmmm.constprop.0
+	testq	%rax, %rax
+	je	.L860
+.L843:
+	movq	24(%r15), %rax
+	addq	%r14, %rax
+	cmpl	$1, 8(%rax)
+	je	.L845
+	movq	40(%rax), %rdi
+.L844:
+	addq	$1, 56(%rbp)
+	testq	%rdi, %rdi
+	jle	.L925
+	movq	0(%rbp), %rax
+	movq	%r12, %rsi
+	movq	%rdi, %r12
+	movq	16(%rax), %rdx
+	cmpq	%rdx, %rdi
+	setb	89(%rbp)
+	imulq	%rdx, %rsi
+	addq	(%rax), %rsi
+	xorl	%r9d, %r9d
+	movq	%rsi, 64(%rbp)
+	movq	%rdi, 80(%rbp)
+	movb	$1, 88(%rbp)
+.L848:
+	movl	$3000, %eax
+	cmpq	%rax, %r12
+	cmova	%rax, %r12
+	addq	%r12, %r9
+	jmp	.L855
+.L925:
+	movl	%edi, %eax
+	xorl	%edx, %edx
+	movb	$1, 89(%rbp)
+	negl	%eax
+	testq	%rdi, %rdi
+	cmove	%edx, %eax
+	movl	%eax, 92(%rbp)
+	.p2align 4,,10
+	.p2align 3
+.L842:
+	cmpq	$300000, (%rsp)
+	sete	%al
+	andl	%ebx, %eax
+	jmp	.L756
+	.p2align 4,,10
+	.p2align 3
+.L791:
+	movq	64(%rbp), %rsi
+	movq	%rdi, %r12
+	subq	%r9, %r12
+	addq	%r9, %rsi
+	jmp	.L848
+	.p2align 4,,10
+	.p2align 3
+.L924:
+	movq	0(%rbp), %r14
+	cmpb	$0, 89(%rbp)
+	movb	$0, 88(%rbp)
+	movl	64(%r14), %esi
+	jne	.L794
+	movq	32(%rbp), %rax
+	movq	40(%rbp), %rcx
+	testq	%rax, %rax
+	js	.L795
+	cmpq	%rcx, %rax
+	jle	.L794
+.L795:
+	movq	48(%rbp), %rax
+	xorl	%edx, %edx
+	movl	8(%rbp), %edi
+	divq	24(%rbp)
+	addq	16(%rbp), %rdx
+	movq	%rdx, %r12
+	movq	16(%r14), %rdx
+	testl	%esi, %esi
+	js	.L926
+	cmpq	8(%r14), %r12
+	jnb	.L852
+	leaq	(%r12,%r12,2), %rax
+	salq	$4, %rax
+	addq	24(%r14), %rax
+	cmpl	$1, 8(%rax)
+	je	.L852
+.L856:
+	movl	%edi, (%rax)
+	movb	$0, 4(%rax)
+	movl	$1, 8(%rax)
+	movq	%rdx, 16(%rax)
+	movq	$0, 24(%rax)
+	movq	%rcx, 32(%rax)
+	movq	$0, 40(%rax)
+	addq	$1, 56(%r14)
+	testl	%esi, %esi
+	jns	.L927
+	movq	216(%r14), %rax
+	movq	208(%r14), %rcx
+	movq	200(%r14), %r15
+	cmpq	%rcx, %rax
+	je	.L928
+	movq	%r12, (%r15,%rax,8)
+	movq	216(%r14), %rax
+	movq	%r14, %rdx
+.L806:
+	addq	$1, %rax
+	movq	%rax, 216(%r14)
+	movq	%rdx, %r14
+.L802:
+	movq	16(%r14), %rax
+	addq	$1, 48(%rbp)
+	addq	%rax, 40(%rbp)
+.L794:
+	testl	%esi, %esi
+	jns	.L852
+.L798:
+	movq	216(%r14), %rax
+	testq	%rax, %rax
+	je	.L793
+	cmpq	56(%r14), %rax
+	je	.L929
+.L810:
+	movq	%r14, %rdi
+	call	_ZN1n7io_ring6submitEv.part.0
+	jmp	.L793
+	.p2align 4,,10
+	.p2align 3
+.L860:
+	movq	$-5, %rdi
+	jmp	.L844
+.L852:
+	movl	168(%r14), %edx
+	testl	%edx, %edx
+	jne	.L809
+	jmp	.L793
+	.p2align 4,,10
+	.p2align 3
+.L808:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L793
+	movl	168(%r14), %edx
+	movl	64(%r14), %esi
+.L809:
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 200
+	xorl	%ecx, %ecx
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	pushq	$0
+	.cfi_def_cfa_offset 208
+	movl	$426, %edi
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%rdx
+	.cfi_def_cfa_offset 200
+	popq	%rcx
+	.cfi_def_cfa_offset 192
+	testq	%rax, %rax
+	js	.L808
+	subl	%eax, 168(%r14)
+	jmp	.L793
+.L926:
+	cmpq	$0, 192(%r14)
+	je	.L798
+	cmpq	8(%r14), %r12
+	jnb	.L798
+	imulq	$48, %r12, %rax
+	addq	24(%r14), %rax
+	cmpl	$1, 8(%rax)
+	jne	.L856
+	jmp	.L798
+	.p2align 4,,10
+	.p2align 3
+.L927:
+	movq	120(%r14), %rdx
+	pxor	%xmm0, %xmm0
+	movl	(%rdx), %esi
+	movl	%esi, %edx
+	andl	128(%r14), %edx
+	salq	$6, %rdx
+	addq	104(%r14), %rdx
+	movups	%xmm0, (%rdx)
+	movups	%xmm0, 16(%rdx)
+	movups	%xmm0, 32(%rdx)
+	movups	%xmm0, 48(%rdx)
+	cmpb	$0, 68(%r14)
+	movzbl	4(%rax), %edi
+	je	.L800
+	leal	4(%rdi), %ecx
+	movw	%r12w, 40(%rdx)
+	movb	%cl, (%rdx)
+.L801:
+	movl	(%rax), %ecx
+	movq	24(%rax), %rdi
+	addl	$1, %esi
+	movl	%ecx, 4(%rdx)
+	movq	32(%rax), %rcx
+	movq	16(%rax), %rax
+	addq	%rdi, %rcx
+	movq	%rcx, 8(%rdx)
+	movq	16(%r14), %rcx
+	subl	%edi, %eax
+	imulq	%r12, %rcx
+	addq	%rdi, %rcx
+	addq	(%r14), %rcx
+	movl	%eax, 24(%rdx)
+	movq	%rcx, 16(%rdx)
+	movq	120(%r14), %rax
+	movq	%r12, 32(%rdx)
+	movl	%esi, (%rax)
+	addl	$1, 168(%r14)
+	movq	0(%rbp), %r14
+	movl	64(%r14), %esi
+	jmp	.L802
+.L922:
+	movl	168(%rbx), %edx
+	testl	%edx, %edx
+	jne	.L766
+	jmp	.L759
+	.p2align 4,,10
+	.p2align 3
+.L765:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L759
+	movl	168(%rbx), %edx
+	movl	64(%rbx), %esi
+.L766:
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 200
+	movl	$426, %edi
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	pushq	$0
+	.cfi_def_cfa_offset 208
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%rsi
+	.cfi_def_cfa_offset 200
+	popq	%rdi
+	.cfi_def_cfa_offset 192
+	testq	%rax, %rax
+	js	.L765
+	subl	%eax, 168(%rbx)
+	jmp	.L759
+.L929:
+	movq	192(%r14), %rax
+	movq	%rax, 8(%rsp)
+	addq	$8, %rax
+	movq	%rax, 16(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L811:
+	movq	16(%rsp), %rax
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	movq	8(%rsp), %rax
+	je	.L930
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %r15
+	movq	(%rax), %r8
+	testq	%r15, %r15
+	je	.L812
+	cmpq	(%r15), %r8
+	jne	.L813
+	movq	128(%r15), %rcx
+	movq	136(%r15), %r10
+	leaq	64(%r15), %rsi
+	leaq	128(%r15), %rdi
+	leaq	-1(%rcx), %rax
+	movq	%rax, 128(%r15)
+	lock orq	$0, (%rsp)
+	movq	64(%r15), %r9
+	cmpq	%r9, %rax
+	jge	.L814
+	movq	%rcx, 128(%r15)
+.L815:
+	movq	112(%r8), %rax
+	leaq	112(%r8), %rdx
+	testq	%rax, %rax
+	jne	.L819
+	movq	16(%r8), %rsi
+.L824:
+	movq	16(%r15), %rdx
+	movq	%rdx, %rax
+	salq	$13, %rax
+	xorq	%rdx, %rax
+	movq	%rax, %rdx
+	shrq	$7, %rdx
+	xorq	%rax, %rdx
+	movq	%rdx, %rax
+	salq	$17, %rax
+	xorq	%rdx, %rax
+	xorl	%edx, %edx
+	movq	%rax, 16(%r15)
+	divq	%rsi
+	movq	%rdx, %rcx
+.L820:
+	leaq	(%rsi,%rcx), %rdi
+	testq	%rsi, %rsi
+	jne	.L829
+	jmp	.L830
+	.p2align 4,,10
+	.p2align 3
+.L827:
+	addq	$1, %rcx
+	cmpq	%rcx, %rdi
+	je	.L830
+.L829:
+	movq	%rcx, %rax
+	xorl	%edx, %edx
+	divq	%rsi
+	movq	(%r8), %rax
+	movq	(%rax,%rdx,8), %rdx
+	cmpq	%r15, %rdx
+	je	.L827
+	movq	64(%rdx), %rax
+	leaq	64(%rdx), %r11
+	lock orq	$0, (%rsp)
+	movq	128(%rdx), %r9
+	cmpq	%r9, %rax
+	jge	.L827
+	movq	136(%rdx), %r9
+	movq	(%r9), %rdx
+	movq	8(%r9), %r9
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%r9,%rdx,8), %r10
+	leaq	1(%rax), %rdx
+	lock cmpxchgq	%rdx, (%r11)
+	jne	.L827
+	movq	%r10, %r12
+.L817:
+	movq	48(%r12), %rax
+	movq	%r12, %rdi
+	leaq	64(%rsp), %r15
+	call	*(%rax)
+.LEHE22:
+	pxor	%xmm1, %xmm1
+	movaps	%xmm1, 64(%rsp)
+	movaps	%xmm1, 80(%rsp)
+	movaps	%xmm1, 96(%rsp)
+	movaps	%xmm1, 112(%rsp)
+	cmpq	%r15, %r12
+	je	.L831
+	movq	48(%r12), %rax
+	testq	%rax, %rax
+	je	.L831
+	movq	56(%r12), %rsi
+	movq	%r12, %rdi
+.LEHB23:
+	call	*16(%rax)
+	movq	$0, 48(%r12)
+	movq	112(%rsp), %rax
+	testq	%rax, %rax
+	je	.L831
+	movq	%r12, %rsi
+	movq	%r15, %rdi
+	call	*8(%rax)
+.LEHE23:
+	movdqa	112(%rsp), %xmm2
+	movaps	%xmm2, 48(%r12)
+.L831:
+	movq	64(%r12), %rax
+	lock subq	$1, (%rax)
+	jmp	.L811
+.L830:
+	call	sched_yield@PLT
+	jmp	.L811
+.L813:
+	movq	112(%r8), %rcx
+	leaq	112(%r8), %rdx
+	testq	%rcx, %rcx
+	jne	.L859
+	movq	16(%r8), %rsi
+	xorl	%r15d, %r15d
+	jmp	.L820
+.L859:
+	xorl	%r15d, %r15d
+.L819:
+	leaq	32(%r8), %rdi
+	movq	%r8, 32(%rsp)
+	movq	%rdi, 24(%rsp)
+	movq	%rdx, 40(%rsp)
+	call	pthread_mutex_lock@PLT
+	movq	32(%rsp), %r8
+	movq	24(%rsp), %rdi
+	movq	104(%r8), %rax
+	cmpq	88(%r8), %rax
+	je	.L821
+	movq	72(%r8), %rcx
+	movq	40(%rsp), %rdx
+	leaq	1(%rax), %rsi
+	movq	%rsi, 104(%r8)
+	movq	(%rcx,%rax,8), %r12
+	lock subq	$1, (%rdx)
+	movq	88(%r8), %rax
+	cmpq	%rax, 104(%r8)
+	jne	.L918
+	movq	$0, 88(%r8)
+	movq	$0, 104(%r8)
+.L918:
+	call	pthread_mutex_unlock@PLT
+	jmp	.L817
+.L814:
+	movq	(%r10), %rdx
+	movq	8(%r10), %r10
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%r10,%rdx,8), %r12
+	cmpq	%r9, %rax
+	jne	.L817
+	lock cmpxchgq	%rcx, (%rsi)
+	movq	%rcx, (%rdi)
+	je	.L817
+	jmp	.L815
+	.p2align 4,,10
+	.p2align 3
+.L812:
+	movq	112(%r8), %rcx
+	leaq	112(%r8), %rdx
+	testq	%rcx, %rcx
+	jne	.L819
+	movq	16(%r8), %rsi
+	jmp	.L820
+.L821:
+	movq	%r8, 24(%rsp)
+	call	pthread_mutex_unlock@PLT
+	movq	24(%rsp), %r8
+	movq	16(%r8), %rsi
+	testq	%r15, %r15
+	jne	.L824
+	xorl	%ecx, %ecx
+	jmp	.L820
+.L930:
+	addq	$16, %rax
+	movb	%bl, 16(%rsp)
+	movq	%rax, 24(%rsp)
+	movq	%rax, %r15
+	movq	%rbp, 32(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L836:
+	movq	8(%r15), %r12
+	leaq	16(%r15), %rbp
+	xorl	%ebx, %ebx
+	testq	%r12, %r12
+	je	.L840
+	.p2align 4,,10
+	.p2align 3
+.L841:
+	movq	48(%rbp), %rcx
+	testq	%rcx, %rcx
+	je	.L838
+	addq	$1, %rbx
+	movq	56(%rbp), %rsi
+	movq	%rbp, %rdi
+	addq	$80, %rbp
+	call	*16(%rcx)
+	cmpq	%rbx, %r12
+	jne	.L841
+.L840:
+	movq	$0, 8(%r15)
+	movq	(%r15), %r15
+	testq	%r15, %r15
+	jne	.L836
+	movq	24(%rsp), %rax
+	movq	8(%rsp), %rdi
+	movzbl	16(%rsp), %ebx
+	movq	32(%rsp), %rbp
+	movq	%rax, 672(%rdi)
+	jmp	.L810
+	.p2align 4,,10
+	.p2align 3
+.L838:
+	addq	$1, %rbx
+	addq	$80, %rbp
+	cmpq	%rbx, %r12
+	jne	.L841
+	jmp	.L840
+.L800:
+	leal	22(%rdi), %ecx
+	movb	%cl, (%rdx)
+	jmp	.L801
+.L921:
+	jne	.L857
+	xorl	%edi, %edi
+.L786:
+	movl	%edi, 92(%rbp)
+	movb	$1, 89(%rbp)
+	jmp	.L781
+.L783:
+	addq	$1, 56(%rbp)
+	movq	$-5, %rdi
+.L857:
+	negl	%edi
+	jmp	.L786
+.L928:
+	leaq	5(%rcx), %rax
+	movq	224(%r14), %rdi
+	movq	%rcx, 8(%rsp)
+	leaq	(%rax,%rax), %rdx
+	salq	$4, %rax
+	movq	%rax, %rsi
+	movq	(%rdi), %rax
+	movq	%rdx, 208(%r14)
+	movl	$8, %edx
+.LEHB24:
+	call	*16(%rax)
+	movq	8(%rsp), %rcx
+	movq	%rax, 200(%r14)
+	movq	%rax, %rdi
+	movq	216(%r14), %rax
+	movq	%r12, (%rdi,%rax,8)
+	movq	216(%r14), %rax
+	testq	%rax, %rax
+	jne	.L931
+	testq	%r15, %r15
+	je	.L917
+.L805:
+	movq	224(%r14), %rdi
+	leaq	0(,%rcx,8), %rdx
+	movq	%r15, %rsi
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	216(%r14), %rax
+.L917:
+	movq	0(%rbp), %rdx
+	movl	64(%rdx), %esi
+	jmp	.L806
+.L923:
+	leaq	48(%rsp), %rax
+	movq	192(%rbx), %r13
+	movq	%rax, (%rsp)
+	leaq	8(%r13), %r14
+.L768:
+	movq	(%r14), %rax
+	testq	%rax, %rax
+	je	.L932
+.L773:
+	movq	0(%r13), %rsi
+	movq	(%rsp), %rdi
+	call	_ZN1n11thread_pool11__find_workEv
+	cmpb	$0, 56(%rsp)
+	je	.L769
+	movq	48(%rsp), %r12
+	leaq	64(%rsp), %r15
+	movq	48(%r12), %rax
+	movq	%r12, %rdi
+	call	*(%rax)
+.LEHE24:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 64(%rsp)
+	movaps	%xmm0, 80(%rsp)
+	movaps	%xmm0, 96(%rsp)
+	movaps	%xmm0, 112(%rsp)
+	cmpq	%r15, %r12
+	je	.L770
+	movq	48(%r12), %rax
+	testq	%rax, %rax
+	je	.L770
+	movq	56(%r12), %rsi
+	movq	%r12, %rdi
+.LEHB25:
+	call	*16(%rax)
+	movq	$0, 48(%r12)
+	movq	112(%rsp), %rax
+	testq	%rax, %rax
+	je	.L770
+	movq	%r12, %rsi
+	movq	%r15, %rdi
+	call	*8(%rax)
+.LEHE25:
+	movdqa	112(%rsp), %xmm3
+	movaps	%xmm3, 48(%r12)
+.L770:
+	movq	64(%r12), %rax
+	lock subq	$1, (%rax)
+	movq	(%r14), %rax
+	testq	%rax, %rax
+	jne	.L773
+.L932:
+	movq	%rbx, (%rsp)
+	leaq	16(%r13), %r12
+	movq	%rbp, 8(%rsp)
+	movq	%r12, %r15
+.L775:
+	movq	8(%r15), %r14
+	leaq	16(%r15), %rbp
+	xorl	%ebx, %ebx
+	testq	%r14, %r14
+	je	.L779
+	.p2align 4,,10
+	.p2align 3
+.L780:
+	movq	48(%rbp), %rcx
+	testq	%rcx, %rcx
+	je	.L777
+	addq	$1, %rbx
+	movq	56(%rbp), %rsi
+	movq	%rbp, %rdi
+	addq	$80, %rbp
+	call	*16(%rcx)
+	cmpq	%rbx, %r14
+	jne	.L780
+.L779:
+	movq	$0, 8(%r15)
+	movq	(%r15), %r15
+	testq	%r15, %r15
+	jne	.L775
+	movq	(%rsp), %rbx
+	movq	8(%rsp), %rbp
+	movq	%r12, 672(%r13)
+	jmp	.L767
+	.p2align 4,,10
+	.p2align 3
+.L777:
+	addq	$1, %rbx
+	addq	$80, %rbp
+	cmpq	%rbx, %r14
+	jne	.L780
+	jmp	.L779
+.L769:
+	call	sched_yield@PLT
+	jmp	.L768
+.L931:
+	leaq	0(,%rax,8), %rdx
+	movq	%r15, %rsi
+	call	memcpy@PLT
+	movq	8(%rsp), %rcx
+	jmp	.L805
+.L862:
+	movq	%rax, %rbx
+	jmp	.L771
+.L863:
+	movq	%rax, %rbx
+	jmp	.L832
+	.section	.gcc_except_table
+.LLSDA7146:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7146-.LLSDACSB7146
+.LLSDACSB7146:
+	.uleb128 .LEHB22-.LFB7146
+	.uleb128 .LEHE22-.LEHB22
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB23-.LFB7146
+	.uleb128 .LEHE23-.LEHB23
+	.uleb128 .L863-.LFB7146
+	.uleb128 0
+	.uleb128 .LEHB24-.LFB7146
+	.uleb128 .LEHE24-.LEHB24
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB25-.LFB7146
+	.uleb128 .LEHE25-.LEHB25
+	.uleb128 .L862-.LFB7146
+	.uleb128 0
+.LLSDACSE7146:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7146
+	.type	_Z12read_patternRN1n11ring_readerEmm.constprop.0.cold, @function
+_Z12read_patternRN1n11ring_readerEmm.constprop.0.cold:
+.LFSB7146:
+.L771:
+	.cfi_def_cfa_offset 192
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	112(%rsp), %rax
+	testq	%rax, %rax
+	je	.L772
+	movq	120(%rsp), %rsi
+	movq	%r15, %rdi
+	call	*16(%rax)
+.L772:
+	movq	%rbx, %rdi
+.LEHB26:
+	call	_Unwind_Resume@PLT
+.LEHE26:
+.L832:
+	movq	112(%rsp), %rax
+	testq	%rax, %rax
+	je	.L833
+	movq	120(%rsp), %rsi
+	movq	%r15, %rdi
+	call	*16(%rax)
+.L833:
+	movq	%rbx, %rdi
+.LEHB27:
+	call	_Unwind_Resume@PLT
+.LEHE27:
+	.cfi_endproc
+.LFE7146:
+	.section	.gcc_except_table
+.LLSDAC7146:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7146-.LLSDACSBC7146
+.LLSDACSBC7146:
+	.uleb128 .LEHB26-.LCOLDB3
+	.uleb128 .LEHE26-.LEHB26
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB27-.LCOLDB3
+	.uleb128 .LEHE27-.LEHB27
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC7146:
+	.section	.text.unlikely
+	.text
+	.size	_Z12read_patternRN1n11ring_readerEmm.constprop.0, .-_Z12read_patternRN1n11ring_readerEmm.constprop.0
+	.section	.text.unlikely
+	.size	_Z12read_patternRN1n11ring_readerEmm.constprop.0.cold, .-_Z12read_patternRN1n11ring_readerEmm.constprop.0.cold
+.LCOLDE3:
+	.text
+.LHOTE3:
+	.section	.text._ZN1n7io_ringD2Ev,"axG",@progbits,_ZN1n7io_ringD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n7io_ringD2Ev
+	.type	_ZN1n7io_ringD2Ev, @function
+_ZN1n7io_ringD2Ev:
+.LFB6859:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6859
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	56(%rdi), %rax
+	leaq	32(%rsp), %rdi
+	movq	%rdi, (%rsp)
+	testq	%rax, %rax
+	jne	.L934
+	jmp	.L974
+	.p2align 4,,10
+	.p2align 3
+.L937:
+	movq	216(%rbx), %rdx
+	testq	%rdx, %rdx
+	je	.L938
+	cmpq	%rax, %rdx
+	je	.L1146
+.L942:
+	movq	%rbx, %rdi
+	call	_ZN1n7io_ring6submitEv.part.0
+.L1143:
+	movq	56(%rbx), %rax
+.L938:
+	movq	%rax, %rsi
+	movq	%rbx, %rdi
+	call	_ZN1n7io_ring4waitEPmmm.constprop.0
+	movq	56(%rbx), %rax
+	testq	%rax, %rax
+	je	.L974
+.L934:
+	movl	64(%rbx), %esi
+	testl	%esi, %esi
+	js	.L937
+	movl	168(%rbx), %edx
+	testl	%edx, %edx
+	jne	.L941
+	jmp	.L938
+	.p2align 4,,10
+	.p2align 3
+.L939:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1143
+	movl	168(%rbx), %edx
+	movl	64(%rbx), %esi
+.L941:
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 168
+	xorl	%ecx, %ecx
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	pushq	$0
+	.cfi_def_cfa_offset 176
+	movl	$426, %edi
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%rdx
+	.cfi_def_cfa_offset 168
+	popq	%rcx
+	.cfi_def_cfa_offset 160
+	testq	%rax, %rax
+	js	.L939
+	subl	%eax, 168(%rbx)
+	movq	56(%rbx), %rax
+	jmp	.L938
+	.p2align 4,,10
+	.p2align 3
+.L974:
+	movq	104(%rbx), %rdi
+	cmpq	$-1, %rdi
+	je	.L936
+	movq	112(%rbx), %rsi
+	call	munmap@PLT
+.L936:
+	movq	88(%rbx), %rax
+	movq	72(%rbx), %rdi
+	cmpq	$-1, %rax
+	je	.L975
+	cmpq	%rdi, %rax
+	je	.L976
+	movq	96(%rbx), %rsi
+	movq	%rax, %rdi
+	call	munmap@PLT
+	movq	72(%rbx), %rdi
+.L975:
+	cmpq	$-1, %rdi
+	je	.L977
+.L976:
+	movq	80(%rbx), %rsi
+	call	munmap@PLT
+.L977:
+	movl	64(%rbx), %edi
+	testl	%edi, %edi
+	js	.L978
+	call	close@PLT
+.L978:
+	movq	192(%rbx), %r14
+	movl	$-1, 64(%rbx)
+	movq	$-1, 88(%rbx)
+	movq	$-1, 72(%rbx)
+	leaq	8(%r14), %r12
+	movq	$-1, 104(%rbx)
+	testq	%r14, %r14
+	je	.L979
+	.p2align 4,,10
+	.p2align 3
+.L980:
+	movq	(%r12), %rax
+	testq	%rax, %rax
+	je	.L1147
+.L1003:
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %rbp
+	movq	(%r14), %r13
+	testq	%rbp, %rbp
+	je	.L981
+	cmpq	0(%rbp), %r13
+	jne	.L982
+	movq	128(%rbp), %rcx
+	movq	136(%rbp), %r9
+	leaq	64(%rbp), %rdi
+	leaq	128(%rbp), %r8
+	leaq	-1(%rcx), %rax
+	movq	%rax, 128(%rbp)
+	lock orq	$0, (%rsp)
+	movq	64(%rbp), %rsi
+	cmpq	%rsi, %rax
+	jge	.L983
+	movq	%rcx, 128(%rbp)
+.L984:
+	movq	112(%r13), %rax
+	leaq	112(%r13), %rdx
+	testq	%rax, %rax
+	jne	.L988
+	movq	16(%r13), %rsi
+.L993:
+	movq	16(%rbp), %rdx
+	movq	%rdx, %rax
+	salq	$13, %rax
+	xorq	%rdx, %rax
+	movq	%rax, %rdx
+	shrq	$7, %rdx
+	xorq	%rax, %rdx
+	movq	%rdx, %rax
+	salq	$17, %rax
+	xorq	%rdx, %rax
+	xorl	%edx, %edx
+	movq	%rax, 16(%rbp)
+	divq	%rsi
+	movq	%rdx, %rcx
+.L989:
+	leaq	(%rcx,%rsi), %rdi
+	testq	%rsi, %rsi
+	jne	.L998
+	jmp	.L999
+	.p2align 4,,10
+	.p2align 3
+.L996:
+	addq	$1, %rcx
+	cmpq	%rcx, %rdi
+	je	.L999
+.L998:
+	movq	%rcx, %rax
+	xorl	%edx, %edx
+	divq	%rsi
+	movq	0(%r13), %rax
+	movq	(%rax,%rdx,8), %rdx
+	cmpq	%rbp, %rdx
+	je	.L996
+	movq	64(%rdx), %rax
+	leaq	64(%rdx), %r9
+	lock orq	$0, (%rsp)
+	movq	128(%rdx), %r8
+	cmpq	%r8, %rax
+	jge	.L996
+	movq	136(%rdx), %r8
+	movq	(%r8), %rdx
+	movq	8(%r8), %r8
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%r8,%rdx,8), %r15
+	leaq	1(%rax), %rdx
+	lock cmpxchgq	%rdx, (%r9)
+	jne	.L996
+.L986:
+	movq	48(%r15), %rax
+	movq	%r15, %rdi
+	leaq	32(%rsp), %rbp
+	call	*(%rax)
+	pxor	%xmm1, %xmm1
+	movaps	%xmm1, 32(%rsp)
+	movaps	%xmm1, 48(%rsp)
+	movaps	%xmm1, 64(%rsp)
+	movaps	%xmm1, 80(%rsp)
+	cmpq	%rbp, %r15
+	je	.L1000
+	movq	48(%r15), %rax
+	testq	%rax, %rax
+	je	.L1000
+	movq	56(%r15), %rsi
+	movq	%r15, %rdi
+.LEHB28:
+	call	*16(%rax)
+	movq	$0, 48(%r15)
+	movq	80(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1000
+	movq	%r15, %rsi
+	movq	%rbp, %rdi
+	call	*8(%rax)
+.LEHE28:
+	movdqa	80(%rsp), %xmm3
+	movaps	%xmm3, 48(%r15)
+.L1000:
+	movq	64(%r15), %rax
+	lock subq	$1, (%rax)
+	movq	(%r12), %rax
+	testq	%rax, %rax
+	jne	.L1003
+.L1147:
+	leaq	16(%r14), %rax
+	movq	%rax, (%rsp)
+	movq	%rax, %r13
+	.p2align 4,,10
+	.p2align 3
+.L1014:
+	movq	%r13, %r12
+	xorl	%r15d, %r15d
+	movq	0(%r13), %r13
+	movq	8(%r12), %rbp
+	leaq	16(%r12), %r14
+	testq	%rbp, %rbp
+	je	.L1009
+	.p2align 4,,10
+	.p2align 3
+.L1010:
+	movq	48(%r14), %rcx
+	testq	%rcx, %rcx
+	je	.L1007
+	addq	$1, %r15
+	movq	56(%r14), %rsi
+	movq	%r14, %rdi
+	addq	$80, %r14
+	call	*16(%rcx)
+	cmpq	%r15, %rbp
+	jne	.L1010
+.L1009:
+	cmpq	%r12, (%rsp)
+	je	.L1006
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1148
+.L1012:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %ecx
+	movl	$656, %edx
+	movq	%r12, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1006:
+	testq	%r13, %r13
+	jne	.L1014
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1149
+.L1016:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %ecx
+	movl	$688, %edx
+	movq	192(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L979:
+	cmpb	$0, 184(%rbx)
+	jne	.L1150
+.L1018:
+	movq	(%rbx), %rdi
+	testq	%rdi, %rdi
+	je	.L1041
+	movq	8(%rbx), %rsi
+	imulq	16(%rbx), %rsi
+	call	munmap@PLT
+.L1041:
+	movq	264(%rbx), %rax
+	movq	272(%rbx), %rdi
+	movl	$8, %ecx
+	movq	256(%rbx), %rsi
+	leaq	1(%rax), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+	call	*24(%rax)
+	movq	200(%rbx), %rsi
+	testq	%rsi, %rsi
+	je	.L1042
+	movq	208(%rbx), %rax
+	movq	224(%rbx), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1042:
+	movq	24(%rbx), %rsi
+	testq	%rsi, %rsi
+	je	.L933
+	movq	32(%rbx), %rax
+	movq	48(%rbx), %rdi
+	movl	$8, %ecx
+	leaq	(%rax,%rax,2), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+	call	*24(%rax)
+.L933:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L999:
+	.cfi_restore_state
+	call	sched_yield@PLT
+	jmp	.L980
+	.p2align 4,,10
+	.p2align 3
+.L982:
+	movq	112(%r13), %rcx
+	leaq	112(%r13), %rdx
+	testq	%rcx, %rcx
+	jne	.L1049
+	movq	16(%r13), %rsi
+	xorl	%ebp, %ebp
+	jmp	.L989
+	.p2align 4,,10
+	.p2align 3
+.L1049:
+	xorl	%ebp, %ebp
+.L988:
+	leaq	32(%r13), %rdi
+	movq	%rdx, 8(%rsp)
+	movq	%rdi, (%rsp)
+	call	pthread_mutex_lock@PLT
+	movq	104(%r13), %rax
+	cmpq	88(%r13), %rax
+	movq	(%rsp), %rdi
+	je	.L990
+	movq	72(%r13), %rcx
+	movq	8(%rsp), %rdx
+	leaq	1(%rax), %rsi
+	movq	%rsi, 104(%r13)
+	movq	(%rcx,%rax,8), %r15
+	lock subq	$1, (%rdx)
+	movq	88(%r13), %rax
+	cmpq	%rax, 104(%r13)
+	je	.L991
+	call	pthread_mutex_unlock@PLT
+	jmp	.L986
+	.p2align 4,,10
+	.p2align 3
+.L983:
+	movq	(%r9), %rdx
+	movq	8(%r9), %r9
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%r9,%rdx,8), %r15
+	cmpq	%rsi, %rax
+	jne	.L986
+	lock cmpxchgq	%rcx, (%rdi)
+	movq	%rcx, (%r8)
+	je	.L986
+	jmp	.L984
+	.p2align 4,,10
+	.p2align 3
+.L1146:
+	movq	192(%rbx), %r13
+	leaq	8(%r13), %rbp
+	.p2align 4,,10
+	.p2align 3
+.L943:
+	movq	0(%rbp), %rax
+	testq	%rax, %rax
+	je	.L1151
+.L966:
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %r12
+	movq	0(%r13), %r8
+	testq	%r12, %r12
+	je	.L944
+	cmpq	(%r12), %r8
+	jne	.L945
+	movq	128(%r12), %rcx
+	movq	136(%r12), %r10
+	leaq	64(%r12), %rsi
+	leaq	128(%r12), %rdi
+	leaq	-1(%rcx), %rax
+	movq	%rax, 128(%r12)
+	lock orq	$0, (%rsp)
+	movq	64(%r12), %r9
+	cmpq	%r9, %rax
+	jge	.L946
+	movq	%rcx, 128(%r12)
+.L947:
+	movq	112(%r8), %rax
+	leaq	112(%r8), %rdx
+	testq	%rax, %rax
+	jne	.L951
+	movq	16(%r8), %rsi
+.L954:
+	movq	16(%r12), %rdx
+	movq	%rdx, %rax
+	salq	$13, %rax
+	xorq	%rdx, %rax
+	movq	%rax, %rdx
+	shrq	$7, %rdx
+	xorq	%rax, %rdx
+	movq	%rdx, %rax
+	salq	$17, %rax
+	xorq	%rdx, %rax
+	xorl	%edx, %edx
+	movq	%rax, 16(%r12)
+	divq	%rsi
+	movq	%rdx, %rcx
+.L952:
+	leaq	(%rcx,%rsi), %rdi
+	testq	%rsi, %rsi
+	jne	.L961
+	jmp	.L962
+	.p2align 4,,10
+	.p2align 3
+.L959:
+	addq	$1, %rcx
+	cmpq	%rcx, %rdi
+	je	.L962
+.L961:
+	movq	%rcx, %rax
+	xorl	%edx, %edx
+	divq	%rsi
+	movq	(%r8), %rax
+	movq	(%rax,%rdx,8), %rdx
+	cmpq	%r12, %rdx
+	je	.L959
+	movq	64(%rdx), %rax
+	leaq	64(%rdx), %r10
+	lock orq	$0, (%rsp)
+	movq	128(%rdx), %r9
+	cmpq	%r9, %rax
+	jge	.L959
+	movq	136(%rdx), %r9
+	movq	(%r9), %rdx
+	movq	8(%r9), %r9
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%r9,%rdx,8), %r15
+	leaq	1(%rax), %rdx
+	lock cmpxchgq	%rdx, (%r10)
+	jne	.L959
+.L949:
+	movq	48(%r15), %rax
+	movq	%r15, %rdi
+	call	*(%rax)
+	movq	(%rsp), %rax
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 32(%rsp)
+	movaps	%xmm0, 48(%rsp)
+	movaps	%xmm0, 64(%rsp)
+	movaps	%xmm0, 80(%rsp)
+	cmpq	%rax, %r15
+	je	.L963
+	movq	48(%r15), %rax
+	testq	%rax, %rax
+	je	.L963
+	movq	56(%r15), %rsi
+	movq	%r15, %rdi
+.LEHB29:
+	call	*16(%rax)
+	movq	$0, 48(%r15)
+	movq	80(%rsp), %rax
+	testq	%rax, %rax
+	je	.L963
+	movq	(%rsp), %rdi
+	movq	%r15, %rsi
+	call	*8(%rax)
+.LEHE29:
+	movdqa	80(%rsp), %xmm2
+	movaps	%xmm2, 48(%r15)
+.L963:
+	movq	64(%r15), %rax
+	lock subq	$1, (%rax)
+	movq	0(%rbp), %rax
+	testq	%rax, %rax
+	jne	.L966
+.L1151:
+	leaq	16(%r13), %rax
+	movq	%rax, 8(%rsp)
+	movq	%rax, %r12
+	.p2align 4,,10
+	.p2align 3
+.L968:
+	movq	8(%r12), %rbp
+	leaq	16(%r12), %r14
+	xorl	%r15d, %r15d
+	testq	%rbp, %rbp
+	je	.L972
+	.p2align 4,,10
+	.p2align 3
+.L973:
+	movq	48(%r14), %rcx
+	testq	%rcx, %rcx
+	je	.L970
+	addq	$1, %r15
+	movq	56(%r14), %rsi
+	movq	%r14, %rdi
+	addq	$80, %r14
+	call	*16(%rcx)
+	cmpq	%r15, %rbp
+	jne	.L973
+.L972:
+	movq	$0, 8(%r12)
+	movq	(%r12), %r12
+	testq	%r12, %r12
+	jne	.L968
+	movq	8(%rsp), %rax
+	movq	%rax, 672(%r13)
+	jmp	.L942
+	.p2align 4,,10
+	.p2align 3
+.L962:
+	call	sched_yield@PLT
+	jmp	.L943
+	.p2align 4,,10
+	.p2align 3
+.L945:
+	movq	112(%r8), %rcx
+	leaq	112(%r8), %rdx
+	testq	%rcx, %rcx
+	jne	.L1048
+	movq	16(%r8), %rsi
+	xorl	%r12d, %r12d
+	jmp	.L952
+	.p2align 4,,10
+	.p2align 3
+.L1048:
+	xorl	%r12d, %r12d
+.L951:
+	leaq	32(%r8), %rdi
+	movq	%rdx, 24(%rsp)
+	movq	%r8, 16(%rsp)
+	movq	%rdi, 8(%rsp)
+	call	pthread_mutex_lock@PLT
+	movq	16(%rsp), %r8
+	movq	8(%rsp), %rdi
+	movq	24(%rsp), %rdx
+	movq	104(%r8), %rax
+	cmpq	88(%r8), %rax
+	jne	.L953
+	movq	%r8, 8(%rsp)
+	call	pthread_mutex_unlock@PLT
+	movq	8(%rsp), %r8
+	movq	16(%r8), %rsi
+	testq	%r12, %r12
+	jne	.L954
+	xorl	%ecx, %ecx
+	jmp	.L952
+	.p2align 4,,10
+	.p2align 3
+.L946:
+	movq	(%r10), %rdx
+	movq	8(%r10), %r10
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%r10,%rdx,8), %r15
+	cmpq	%r9, %rax
+	jne	.L949
+	lock cmpxchgq	%rcx, (%rsi)
+	movq	%rcx, (%rdi)
+	je	.L949
+	jmp	.L947
+	.p2align 4,,10
+	.p2align 3
+.L944:
+	movq	112(%r8), %rcx
+	leaq	112(%r8), %rdx
+	testq	%rcx, %rcx
+	jne	.L951
+	movq	16(%r8), %rsi
+	jmp	.L952
+	.p2align 4,,10
+	.p2align 3
+.L953:
+	movq	72(%r8), %rcx
+	leaq	1(%rax), %rsi
+	movq	%rsi, 104(%r8)
+	movq	(%rcx,%rax,8), %r15
+	lock subq	$1, (%rdx)
+	movq	88(%r8), %rax
+	cmpq	%rax, 104(%r8)
+	jne	.L1145
+	movq	$0, 88(%r8)
+	movq	$0, 104(%r8)
+.L1145:
+	call	pthread_mutex_unlock@PLT
+	jmp	.L949
+	.p2align 4,,10
+	.p2align 3
+.L970:
+	addq	$1, %r15
+	addq	$80, %r14
+	cmpq	%r15, %rbp
+	jne	.L973
+	jmp	.L972
+	.p2align 4,,10
+	.p2align 3
+.L981:
+	movq	112(%r13), %rcx
+	leaq	112(%r13), %rdx
+	testq	%rcx, %rcx
+	jne	.L988
+	movq	16(%r13), %rsi
+	jmp	.L989
+.L990:
+	call	pthread_mutex_unlock@PLT
+	movq	16(%r13), %rsi
+	testq	%rbp, %rbp
+	jne	.L993
+	xorl	%ecx, %ecx
+	jmp	.L989
+	.p2align 4,,10
+	.p2align 3
+.L1007:
+	addq	$1, %r15
+	addq	$80, %r14
+	cmpq	%r15, %rbp
+	jne	.L1010
+	jmp	.L1009
+	.p2align 4,,10
+	.p2align 3
+.L1148:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1012
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1012
+.L1150:
+	movq	176(%rbx), %rbp
+	leaq	120(%rbp), %r15
+	movq	%r15, %rdi
+	movq	%r15, 8(%rsp)
+	call	pthread_mutex_lock@PLT
+	movb	$1, 224(%rbp)
+	lock addq	$1, 208(%rbp)
+	xorl	%r12d, %r12d
+	leaq	160(%rbp), %rax
+	movq	%rax, %rdi
+	movq	%rax, 16(%rsp)
+	call	pthread_cond_broadcast@PLT
+	movq	%r15, %rdi
+	call	pthread_mutex_unlock@PLT
+	cmpq	$0, 16(%rbp)
+	je	.L1022
+	.p2align 4,,10
+	.p2align 3
+.L1019:
+	movq	0(%rbp), %rax
+	xorl	%esi, %esi
+	movq	(%rax,%r12,8), %rax
+	addq	$1, %r12
+	movq	24(%rax), %rdi
+	call	pthread_join@PLT
+	movq	16(%rbp), %rax
+	cmpq	%rax, %r12
+	jb	.L1019
+	testq	%rax, %rax
+	je	.L1022
+	xorl	%r13d, %r13d
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	.p2align 4,,10
+	.p2align 3
+.L1036:
+	movq	0(%rbp), %rax
+	movq	(%rax,%r13,8), %r14
+	movq	136(%r14), %r15
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1152
+.L1024:
+	movq	(%r15), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%r15, %rsi
+	movl	$8, %ecx
+	xorl	%r15d, %r15d
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	$0, 160(%r14)
+	jne	.L1026
+	jmp	.L1032
+	.p2align 4,,10
+	.p2align 3
+.L1030:
+	movq	(%rsi), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$8, %ecx
+	addq	$1, %r15
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	160(%r14), %r15
+	jnb	.L1032
+.L1026:
+	movq	144(%r14), %rax
+	movq	(%rax,%r15,8), %rsi
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L1030
+	movq	%r12, %rdi
+	movq	%rsi, (%rsp)
+	call	__cxa_guard_acquire@PLT
+	movq	(%rsp), %rsi
+	testl	%eax, %eax
+	je	.L1030
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movq	(%rsp), %rsi
+	jmp	.L1030
+	.p2align 4,,10
+	.p2align 3
+.L1032:
+	movq	144(%r14), %rsi
+	testq	%rsi, %rsi
+	je	.L1028
+	movq	152(%r14), %rax
+	movq	168(%r14), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1028:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1153
+.L1034:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$64, %ecx
+	movl	$192, %edx
+	movq	%r14, %rsi
+	addq	$1, %r13
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	16(%rbp), %r13
+	jb	.L1036
+.L1022:
+	movq	16(%rsp), %rdi
+	call	pthread_cond_destroy@PLT
+	movq	8(%rsp), %rdi
+	call	pthread_mutex_destroy@PLT
+	leaq	32(%rbp), %rdi
+	call	pthread_mutex_destroy@PLT
+	movq	72(%rbp), %rsi
+	testq	%rsi, %rsi
+	je	.L1021
+	movq	80(%rbp), %rax
+	movq	96(%rbp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1021:
+	movq	0(%rbp), %rsi
+	testq	%rsi, %rsi
+	je	.L1037
+	movq	24(%rbp), %rdi
+	movq	8(%rbp), %rdx
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	salq	$3, %rdx
+	call	*24(%rax)
+.L1037:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1154
+.L1039:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$8, %ecx
+	movl	$232, %edx
+	movq	176(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L1018
+	.p2align 4,,10
+	.p2align 3
+.L1153:
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1034
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1034
+	.p2align 4,,10
+	.p2align 3
+.L1152:
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1024
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1024
+.L991:
+	movq	$0, 88(%r13)
+	movq	$0, 104(%r13)
+	call	pthread_mutex_unlock@PLT
+	jmp	.L986
+.L1149:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1016
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1016
+.L1154:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1039
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1039
+.L1053:
+	jmp	.L1001
+.L1052:
+	jmp	.L964
+.L1001:
+	movq	80(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1002
+	movq	88(%rsp), %rsi
+	movq	%rbp, %rdi
+	call	*16(%rax)
+.L1002:
+	call	_ZSt9terminatev@PLT
+.L964:
+	movq	80(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1002
+	movq	88(%rsp), %rsi
+	movq	(%rsp), %rdi
+	call	*16(%rax)
+	jmp	.L1002
+	.cfi_endproc
+.LFE6859:
+	.section	.gcc_except_table
+.LLSDA6859:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6859-.LLSDACSB6859
+.LLSDACSB6859:
+	.uleb128 .LEHB28-.LFB6859
+	.uleb128 .LEHE28-.LEHB28
+	.uleb128 .L1053-.LFB6859
+	.uleb128 0
+	.uleb128 .LEHB29-.LFB6859
+	.uleb128 .LEHE29-.LEHB29
+	.uleb128 .L1052-.LFB6859
+	.uleb128 0
+.LLSDACSE6859:
+	.section	.text._ZN1n7io_ringD2Ev,"axG",@progbits,_ZN1n7io_ringD5Ev,comdat
+	.size	_ZN1n7io_ringD2Ev, .-_ZN1n7io_ringD2Ev
+	.weak	_ZN1n7io_ringD1Ev
+	.set	_ZN1n7io_ringD1Ev,_ZN1n7io_ringD2Ev
+	.section	.text._ZN1n7io_ring4waitEPmmm,"axG",@progbits,_ZN1n7io_ring4waitEPmmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n7io_ring4waitEPmmm
+	.type	_ZN1n7io_ring4waitEPmmm, @function
+_ZN1n7io_ring4waitEPmmm:
+.LFB6874:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6874
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdx, %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$120, %rsp
+	.cfi_def_cfa_offset 176
+	movq	56(%rdi), %rax
+	cmpq	%rcx, %rax
+	cmovbe	%rax, %rcx
+	testq	%rsi, %rsi
+	sete	%r13b
+	movq	%rcx, 8(%rsp)
+	cmpq	%rdx, %rcx
+	jb	.L1156
+	testb	%r13b, %r13b
+	cmove	%rdx, %rcx
+	movq	%rcx, 8(%rsp)
+.L1156:
+	movl	64(%rbx), %esi
+	testl	%esi, %esi
+	jns	.L1394
+	movq	216(%rbx), %rdx
+	testq	%rdx, %rdx
+	je	.L1164
+	cmpq	%rdx, %rax
+	je	.L1395
+.L1165:
+	movq	%rbx, %rdi
+.LEHB30:
+	call	_ZN1n7io_ring6submitEv.part.0
+.L1163:
+	movl	64(%rbx), %r10d
+	testl	%r10d, %r10d
+	js	.L1164
+.L1197:
+	movq	136(%rbx), %rax
+	xorl	%ebp, %ebp
+	movl	(%rax), %ecx
+	movq	144(%rbx), %rax
+	movl	(%rax), %esi
+	cmpl	%esi, %ecx
+	je	.L1161
+	testq	%r15, %r15
+	jne	.L1308
+	testb	%r13b, %r13b
+	je	.L1161
+.L1308:
+	pxor	%xmm0, %xmm0
+	.p2align 4,,10
+	.p2align 3
+.L1351:
+	movl	%ecx, %edx
+	andl	152(%rbx), %edx
+	salq	$4, %rdx
+	addq	160(%rbx), %rdx
+	movq	(%rdx), %rdi
+	movslq	8(%rdx), %rdx
+	leaq	(%rdi,%rdi,2), %rax
+	salq	$4, %rax
+	addq	24(%rbx), %rax
+	cmpl	$-4, %edx
+	je	.L1391
+	cmpl	$-11, %edx
+	je	.L1391
+	testl	%edx, %edx
+	jle	.L1204
+	addq	24(%rax), %rdx
+	movq	%rdx, 24(%rax)
+	cmpq	16(%rax), %rdx
+	jb	.L1391
+.L1210:
+	movq	%rdx, 40(%rax)
+	movl	$2, 8(%rax)
+	subq	$1, 56(%rbx)
+	testq	%r12, %r12
+	je	.L1211
+	movq	%rdi, (%r12,%rbp,8)
+.L1211:
+	addq	$1, %rbp
+.L1208:
+	addl	$1, %ecx
+	cmpl	%ecx, %esi
+	je	.L1161
+	cmpq	%r15, %rbp
+	jb	.L1351
+	testb	%r13b, %r13b
+	jne	.L1351
+.L1161:
+	movq	136(%rbx), %rax
+	movl	%ecx, (%rax)
+	movl	168(%rbx), %edx
+	testl	%edx, %edx
+	jne	.L1217
+	jmp	.L1216
+	.p2align 4,,10
+	.p2align 3
+.L1214:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1216
+	movl	168(%rbx), %edx
+.L1217:
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 184
+	movl	64(%rbx), %esi
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	pushq	$0
+	.cfi_def_cfa_offset 192
+	xorl	%ecx, %ecx
+	movl	$426, %edi
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%r8
+	.cfi_def_cfa_offset 184
+	popq	%r9
+	.cfi_def_cfa_offset 176
+	testq	%rax, %rax
+	js	.L1214
+	subl	%eax, 168(%rbx)
+.L1216:
+	movq	8(%rsp), %rax
+	movl	$0, 16(%rsp)
+	cmpq	%rax, %rbp
+	jnb	.L1155
+	.p2align 4,,10
+	.p2align 3
+.L1227:
+	movl	64(%rbx), %esi
+	testl	%esi, %esi
+	js	.L1261
+	movq	8(%rsp), %rax
+	movl	168(%rbx), %edx
+	subq	%rbp, %rax
+	movl	%edx, %ecx
+	orl	%eax, %ecx
+	movl	%eax, %r14d
+	je	.L1262
+	xorl	%r13d, %r13d
+	testl	%eax, %eax
+	setne	%r13b
+	jmp	.L1265
+	.p2align 4,,10
+	.p2align 3
+.L1263:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1155
+	movl	168(%rbx), %edx
+	movl	64(%rbx), %esi
+.L1265:
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 184
+	movl	%r14d, %ecx
+	xorl	%r9d, %r9d
+	movl	%r13d, %r8d
+	pushq	$0
+	.cfi_def_cfa_offset 192
+	movl	$426, %edi
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%rdx
+	.cfi_def_cfa_offset 184
+	popq	%rcx
+	.cfi_def_cfa_offset 176
+	testq	%rax, %rax
+	js	.L1263
+	subl	%eax, 168(%rbx)
+.L1289:
+	movq	%r15, %r9
+	movl	64(%rbx), %eax
+	subq	%rbp, %r9
+	testq	%r12, %r12
+	je	.L1396
+.L1290:
+	leaq	(%r12,%rbp,8), %r8
+	testl	%eax, %eax
+	jns	.L1292
+	testq	%r9, %r9
+	je	.L1249
+.L1260:
+	leaq	384(%rbx), %rsi
+	xorl	%edi, %edi
+	.p2align 4,,10
+	.p2align 3
+.L1259:
+	movq	(%rsi), %rax
+.L1251:
+	movq	264(%rbx), %rdx
+	andq	%rax, %rdx
+	salq	$4, %rdx
+	addq	256(%rbx), %rdx
+	movq	(%rdx), %rcx
+	subq	$1, %rcx
+	cmpq	%rax, %rcx
+	jne	.L1252
+	leaq	1(%rax), %rcx
+	lock cmpxchgq	%rcx, (%rsi)
+	jne	.L1251
+	movq	264(%rbx), %r10
+	movq	8(%rdx), %rcx
+	leaq	1(%rax,%r10), %rax
+	movq	%rax, (%rdx)
+	leaq	(%rcx,%rcx,2), %rax
+	salq	$4, %rax
+	addq	24(%rbx), %rax
+	movl	$2, 8(%rax)
+	subq	$1, 56(%rbx)
+	testq	%r8, %r8
+	je	.L1397
+	movq	%rcx, (%r8,%rdi,8)
+	addq	$1, %rdi
+	cmpq	%r9, %rdi
+	jb	.L1259
+.L1372:
+	addq	%rdi, %rbp
+.L1249:
+	movq	8(%rsp), %rax
+	cmpq	%rax, %rbp
+	jb	.L1227
+.L1155:
+	addq	$120, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbp, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L1164:
+	.cfi_restore_state
+	testq	%r15, %r15
+	jne	.L1226
+	testb	%r13b, %r13b
+	je	.L1398
+.L1226:
+	leaq	384(%rbx), %rsi
+	xorl	%ebp, %ebp
+	.p2align 4,,10
+	.p2align 3
+.L1225:
+	movq	(%rsi), %rax
+.L1218:
+	movq	264(%rbx), %rdx
+	andq	%rax, %rdx
+	salq	$4, %rdx
+	addq	256(%rbx), %rdx
+	movq	(%rdx), %rcx
+	subq	$1, %rcx
+	cmpq	%rax, %rcx
+	jne	.L1219
+	leaq	1(%rax), %rcx
+	lock cmpxchgq	%rcx, (%rsi)
+	jne	.L1218
+	movq	264(%rbx), %rdi
+	movq	8(%rdx), %rcx
+	leaq	1(%rax,%rdi), %rax
+	movq	%rax, (%rdx)
+	leaq	(%rcx,%rcx,2), %rax
+	salq	$4, %rax
+	addq	24(%rbx), %rax
+	movl	$2, 8(%rax)
+	subq	$1, 56(%rbx)
+	testq	%r12, %r12
+	je	.L1399
+	movq	%rcx, (%r12,%rbp,8)
+	addq	$1, %rbp
+	cmpq	%r15, %rbp
+	jb	.L1225
+	jmp	.L1216
+	.p2align 4,,10
+	.p2align 3
+.L1252:
+	jns	.L1259
+	jmp	.L1372
+	.p2align 4,,10
+	.p2align 3
+.L1397:
+	addq	$1, %rdi
+	jmp	.L1259
+	.p2align 4,,10
+	.p2align 3
+.L1219:
+	jns	.L1225
+	jmp	.L1216
+	.p2align 4,,10
+	.p2align 3
+.L1261:
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %r14
+	movq	192(%rbx), %rax
+	movq	(%rax), %r8
+	testq	%r14, %r14
+	je	.L1266
+	cmpq	(%r14), %r8
+	jne	.L1267
+	movq	128(%r14), %rcx
+	movq	136(%r14), %r10
+	leaq	64(%r14), %rsi
+	leaq	128(%r14), %rdi
+	leaq	-1(%rcx), %rax
+	movq	%rax, 128(%r14)
+	lock orq	$0, (%rsp)
+	movq	64(%r14), %r9
+	cmpq	%r9, %rax
+	jge	.L1268
+	movq	%rcx, 128(%r14)
+.L1269:
+	movq	112(%r8), %rax
+	leaq	112(%r8), %rdx
+	testq	%rax, %rax
+	jne	.L1273
+	movq	16(%r8), %rsi
+.L1278:
+	movq	16(%r14), %rdx
+	movq	%rdx, %rax
+	salq	$13, %rax
+	xorq	%rdx, %rax
+	movq	%rax, %rdx
+	shrq	$7, %rdx
+	xorq	%rax, %rdx
+	movq	%rdx, %rax
+	salq	$17, %rax
+	xorq	%rdx, %rax
+	xorl	%edx, %edx
+	movq	%rax, 16(%r14)
+	divq	%rsi
+	movq	%rdx, %rcx
+.L1274:
+	leaq	(%rcx,%rsi), %r9
+	testq	%rsi, %rsi
+	jne	.L1284
+	jmp	.L1285
+	.p2align 4,,10
+	.p2align 3
+.L1282:
+	addq	$1, %rcx
+	cmpq	%r9, %rcx
+	je	.L1285
+.L1284:
+	movq	%rcx, %rax
+	xorl	%edx, %edx
+	divq	%rsi
+	movq	(%r8), %rax
+	movq	(%rax,%rdx,8), %rdx
+	cmpq	%r14, %rdx
+	je	.L1282
+	movq	64(%rdx), %rax
+	leaq	64(%rdx), %r10
+	lock orq	$0, (%rsp)
+	movq	128(%rdx), %rdi
+	cmpq	%rdi, %rax
+	jge	.L1282
+	movq	136(%rdx), %rdi
+	movq	(%rdi), %rdx
+	movq	8(%rdi), %rdi
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%rdi,%rdx,8), %r13
+	leaq	1(%rax), %rdx
+	lock cmpxchgq	%rdx, (%r10)
+	jne	.L1282
+.L1271:
+	movq	48(%r13), %rax
+	movq	%r13, %rdi
+	leaq	48(%rsp), %r14
+	call	*(%rax)
+.LEHE30:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 48(%rsp)
+	movaps	%xmm0, 64(%rsp)
+	movaps	%xmm0, 80(%rsp)
+	movaps	%xmm0, 96(%rsp)
+	cmpq	%r14, %r13
+	je	.L1286
+	movq	48(%r13), %rax
+	testq	%rax, %rax
+	je	.L1286
+	movq	56(%r13), %rsi
+	movq	%r13, %rdi
+.LEHB31:
+	call	*16(%rax)
+	movq	$0, 48(%r13)
+	movq	96(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1286
+	movq	%r13, %rsi
+	movq	%r14, %rdi
+	call	*8(%rax)
+.LEHE31:
+	movdqa	96(%rsp), %xmm2
+	movaps	%xmm2, 48(%r13)
+.L1286:
+	movq	64(%r13), %rax
+	lock subq	$1, (%rax)
+	movl	64(%rbx), %eax
+	movq	%r15, %r9
+	subq	%rbp, %r9
+	testq	%r12, %r12
+	jne	.L1290
+.L1396:
+	xorl	%r8d, %r8d
+	testl	%eax, %eax
+	js	.L1260
+.L1291:
+	movq	136(%rbx), %rax
+	xorl	%r8d, %r8d
+	movl	$1, %r14d
+	movl	(%rax), %edx
+	movq	144(%rbx), %rax
+	movl	(%rax), %r10d
+	cmpl	%edx, %r10d
+	jne	.L1298
+	jmp	.L1230
+	.p2align 4,,10
+	.p2align 3
+.L1262:
+	movq	%r15, %r9
+	leaq	(%r12,%rbp,8), %r8
+	subq	%rbp, %r9
+	testq	%r12, %r12
+	je	.L1291
+.L1292:
+	movq	136(%rbx), %rax
+	movl	(%rax), %edx
+	movq	144(%rbx), %rax
+	movl	(%rax), %r10d
+	cmpl	%r10d, %edx
+	je	.L1230
+	testq	%r9, %r9
+	je	.L1230
+	xorl	%r14d, %r14d
+.L1298:
+	xorl	%esi, %esi
+	pxor	%xmm0, %xmm0
+	.p2align 4,,10
+	.p2align 3
+.L1352:
+	movl	%edx, %edi
+	andl	152(%rbx), %edi
+	salq	$4, %rdi
+	addq	160(%rbx), %rdi
+	movq	(%rdi), %rcx
+	movslq	8(%rdi), %rdi
+	leaq	(%rcx,%rcx,2), %rax
+	salq	$4, %rax
+	addq	24(%rbx), %rax
+	cmpl	$-4, %edi
+	je	.L1393
+	cmpl	$-11, %edi
+	je	.L1393
+	testl	%edi, %edi
+	jle	.L1236
+	addq	24(%rax), %rdi
+	movq	%rdi, 24(%rax)
+	cmpq	16(%rax), %rdi
+	jb	.L1393
+.L1242:
+	movq	%rdi, 40(%rax)
+	movl	$2, 8(%rax)
+	subq	$1, 56(%rbx)
+	testq	%r8, %r8
+	je	.L1243
+	movq	%rcx, (%r8,%rsi,8)
+.L1243:
+	addq	$1, %rsi
+.L1240:
+	addl	$1, %edx
+	cmpl	%r10d, %edx
+	je	.L1385
+	cmpq	%r9, %rsi
+	jb	.L1352
+	testb	%r14b, %r14b
+	jne	.L1352
+.L1385:
+	addq	%rsi, %rbp
+.L1230:
+	movq	136(%rbx), %rax
+	movl	%edx, (%rax)
+	movl	168(%rbx), %edx
+	testl	%edx, %edx
+	jne	.L1250
+	jmp	.L1249
+	.p2align 4,,10
+	.p2align 3
+.L1247:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1249
+	movl	168(%rbx), %edx
+.L1250:
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 184
+	movl	64(%rbx), %esi
+	movl	$426, %edi
+	xorl	%r9d, %r9d
+	pushq	$0
+	.cfi_def_cfa_offset 192
+	xorl	%r8d, %r8d
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%rsi
+	.cfi_def_cfa_offset 184
+	popq	%rdi
+	.cfi_def_cfa_offset 176
+	testq	%rax, %rax
+	js	.L1247
+	subl	%eax, 168(%rbx)
+	jmp	.L1249
+	.p2align 4,,10
+	.p2align 3
+.L1236:
+	jne	.L1242
+	movq	24(%rax), %rdi
+	jmp	.L1242
+	.p2align 4,,10
+	.p2align 3
+.L1393:
+	movq	120(%rbx), %rdi
+	movl	(%rdi), %r11d
+	movl	%r11d, %edi
+	andl	128(%rbx), %edi
+	movl	%r11d, (%rsp)
+	salq	$6, %rdi
+	addq	104(%rbx), %rdi
+	movups	%xmm0, (%rdi)
+	movups	%xmm0, 16(%rdi)
+	movups	%xmm0, 32(%rdi)
+	movups	%xmm0, 48(%rdi)
+	cmpb	$0, 68(%rbx)
+	movzbl	4(%rax), %r11d
+	je	.L1238
+	addl	$4, %r11d
+	movw	%cx, 40(%rdi)
+	movb	%r11b, (%rdi)
+.L1239:
+	movl	(%rax), %r11d
+	movq	24(%rax), %r13
+	movl	%r11d, 4(%rdi)
+	movq	32(%rax), %r11
+	movq	16(%rax), %rax
+	addq	%r13, %r11
+	movq	%r11, 8(%rdi)
+	movq	16(%rbx), %r11
+	subl	%r13d, %eax
+	imulq	%rcx, %r11
+	addq	%r13, %r11
+	addq	(%rbx), %r11
+	movl	%eax, 24(%rdi)
+	movq	%rcx, 32(%rdi)
+	movl	(%rsp), %eax
+	movq	%r11, 16(%rdi)
+	movq	120(%rbx), %rcx
+	addl	$1, %eax
+	movl	%eax, (%rcx)
+	movl	168(%rbx), %eax
+	addl	$1, %eax
+	movl	%eax, 168(%rbx)
+	jmp	.L1240
+	.p2align 4,,10
+	.p2align 3
+.L1238:
+	addl	$22, %r11d
+	movb	%r11b, (%rdi)
+	jmp	.L1239
+	.p2align 4,,10
+	.p2align 3
+.L1285:
+	cmpl	$63, 16(%rsp)
+	ja	.L1400
+	rep nop
+	addl	$1, 16(%rsp)
+	jmp	.L1289
+	.p2align 4,,10
+	.p2align 3
+.L1204:
+	jne	.L1210
+	movq	24(%rax), %rdx
+	jmp	.L1210
+	.p2align 4,,10
+	.p2align 3
+.L1391:
+	movq	120(%rbx), %rdx
+	movl	(%rdx), %r9d
+	movl	%r9d, %edx
+	andl	128(%rbx), %edx
+	salq	$6, %rdx
+	addq	104(%rbx), %rdx
+	movups	%xmm0, (%rdx)
+	movups	%xmm0, 16(%rdx)
+	movups	%xmm0, 32(%rdx)
+	movups	%xmm0, 48(%rdx)
+	cmpb	$0, 68(%rbx)
+	movzbl	4(%rax), %r14d
+	je	.L1206
+	leal	4(%r14), %r8d
+	movw	%di, 40(%rdx)
+	movb	%r8b, (%rdx)
+.L1207:
+	movl	(%rax), %r8d
+	movq	24(%rax), %r10
+	addl	$1, %r9d
+	movl	%r8d, 4(%rdx)
+	movq	32(%rax), %r8
+	movq	16(%rax), %rax
+	addq	%r10, %r8
+	movq	%r8, 8(%rdx)
+	movq	16(%rbx), %r8
+	subl	%r10d, %eax
+	imulq	%rdi, %r8
+	addq	%r10, %r8
+	addq	(%rbx), %r8
+	movl	%eax, 24(%rdx)
+	movq	%r8, 16(%rdx)
+	movq	120(%rbx), %rax
+	movq	%rdi, 32(%rdx)
+	movl	%r9d, (%rax)
+	movl	168(%rbx), %eax
+	addl	$1, %eax
+	movl	%eax, 168(%rbx)
+	jmp	.L1208
+	.p2align 4,,10
+	.p2align 3
+.L1267:
+	movq	112(%r8), %rcx
+	leaq	112(%r8), %rdx
+	testq	%rcx, %rcx
+	jne	.L1304
+	movq	16(%r8), %rsi
+	xorl	%r14d, %r14d
+	jmp	.L1274
+	.p2align 4,,10
+	.p2align 3
+.L1399:
+	addq	$1, %rbp
+	jmp	.L1225
+.L1304:
+	xorl	%r14d, %r14d
+.L1273:
+	leaq	32(%r8), %rdi
+	movq	%r8, 24(%rsp)
+	movq	%rdi, (%rsp)
+	movq	%rdx, 32(%rsp)
+	call	pthread_mutex_lock@PLT
+	movq	24(%rsp), %r8
+	movq	(%rsp), %rdi
+	movq	104(%r8), %rax
+	cmpq	88(%r8), %rax
+	je	.L1275
+	movq	72(%r8), %rcx
+	movq	32(%rsp), %rdx
+	leaq	1(%rax), %rsi
+	movq	%rsi, 104(%r8)
+	movq	(%rcx,%rax,8), %r13
+	lock subq	$1, (%rdx)
+	movq	88(%r8), %rax
+	cmpq	%rax, 104(%r8)
+	jne	.L1386
+	movq	$0, 88(%r8)
+	movq	$0, 104(%r8)
+.L1386:
+	call	pthread_mutex_unlock@PLT
+	jmp	.L1271
+	.p2align 4,,10
+	.p2align 3
+.L1206:
+	leal	22(%r14), %r8d
+	movb	%r8b, (%rdx)
+	jmp	.L1207
+	.p2align 4,,10
+	.p2align 3
+.L1268:
+	movq	(%r10), %rdx
+	movq	8(%r10), %r10
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%r10,%rdx,8), %r13
+	cmpq	%r9, %rax
+	jne	.L1271
+	lock cmpxchgq	%rcx, (%rsi)
+	movq	%rcx, (%rdi)
+	je	.L1271
+	jmp	.L1269
+	.p2align 4,,10
+	.p2align 3
+.L1400:
+	call	sched_yield@PLT
+	jmp	.L1289
+.L1266:
+	movq	112(%r8), %rcx
+	leaq	112(%r8), %rdx
+	testq	%rcx, %rcx
+	jne	.L1273
+	movq	16(%r8), %rsi
+	jmp	.L1274
+.L1275:
+	movq	%r8, (%rsp)
+	call	pthread_mutex_unlock@PLT
+	movq	(%rsp), %r8
+	movq	16(%r8), %rsi
+	testq	%r14, %r14
+	jne	.L1278
+	xorl	%ecx, %ecx
+	jmp	.L1274
+.L1394:
+	movl	168(%rbx), %edx
+	testl	%edx, %edx
+	jne	.L1159
+	jmp	.L1197
+	.p2align 4,,10
+	.p2align 3
+.L1162:
+	call	__errno_location@PLT
+	movl	64(%rbx), %esi
+	cmpl	$4, (%rax)
+	jne	.L1163
+	movl	168(%rbx), %edx
+.L1159:
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 184
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	xorl	%ecx, %ecx
+	pushq	$0
+	.cfi_def_cfa_offset 192
+	movl	$426, %edi
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%r11
+	.cfi_def_cfa_offset 184
+	popq	%rbp
+	.cfi_def_cfa_offset 176
+	testq	%rax, %rax
+	js	.L1162
+	subl	%eax, 168(%rbx)
+	jmp	.L1163
+.L1395:
+	movq	192(%rbx), %rax
+	movq	%rax, (%rsp)
+	addq	$8, %rax
+	movq	%rax, 16(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1166:
+	movq	16(%rsp), %rax
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	movq	(%rsp), %rax
+	je	.L1401
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %r14
+	movq	(%rax), %r8
+	testq	%r14, %r14
+	je	.L1167
+	cmpq	(%r14), %r8
+	jne	.L1168
+	movq	128(%r14), %rdx
+	movq	136(%r14), %r10
+	leaq	64(%r14), %rsi
+	leaq	128(%r14), %rdi
+	leaq	-1(%rdx), %rax
+	movq	%rax, 128(%r14)
+	lock orq	$0, (%rsp)
+	movq	64(%r14), %rcx
+	cmpq	%rcx, %rax
+	jge	.L1169
+	movq	%rdx, 128(%r14)
+.L1170:
+	movq	112(%r8), %rax
+	leaq	112(%r8), %rdx
+	testq	%rax, %rax
+	jne	.L1174
+	movq	16(%r8), %rsi
+.L1177:
+	movq	16(%r14), %rdx
+	movq	%rdx, %rax
+	salq	$13, %rax
+	xorq	%rdx, %rax
+	movq	%rax, %rdx
+	shrq	$7, %rdx
+	xorq	%rax, %rdx
+	movq	%rdx, %rax
+	salq	$17, %rax
+	xorq	%rdx, %rax
+	xorl	%edx, %edx
+	movq	%rax, 16(%r14)
+	divq	%rsi
+	movq	%rdx, %rcx
+.L1175:
+	leaq	(%rcx,%rsi), %rdi
+	testq	%rsi, %rsi
+	jne	.L1184
+	jmp	.L1185
+	.p2align 4,,10
+	.p2align 3
+.L1182:
+	addq	$1, %rcx
+	cmpq	%rcx, %rdi
+	je	.L1185
+.L1184:
+	movq	%rcx, %rax
+	xorl	%edx, %edx
+	divq	%rsi
+	movq	(%r8), %rax
+	movq	(%rax,%rdx,8), %rdx
+	cmpq	%r14, %rdx
+	je	.L1182
+	movq	64(%rdx), %rax
+	leaq	64(%rdx), %r10
+	lock orq	$0, (%rsp)
+	movq	128(%rdx), %r9
+	cmpq	%r9, %rax
+	jge	.L1182
+	movq	136(%rdx), %r9
+	movq	(%r9), %rdx
+	movq	8(%r9), %r9
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%r9,%rdx,8), %rbp
+	leaq	1(%rax), %rdx
+	lock cmpxchgq	%rdx, (%r10)
+	jne	.L1182
+.L1172:
+	movq	48(%rbp), %rax
+	movq	%rbp, %rdi
+	leaq	48(%rsp), %r14
+.LEHB32:
+	call	*(%rax)
+.LEHE32:
+	pxor	%xmm1, %xmm1
+	movaps	%xmm1, 48(%rsp)
+	movaps	%xmm1, 64(%rsp)
+	movaps	%xmm1, 80(%rsp)
+	movaps	%xmm1, 96(%rsp)
+	cmpq	%r14, %rbp
+	je	.L1186
+	movq	48(%rbp), %rax
+	testq	%rax, %rax
+	je	.L1186
+	movq	56(%rbp), %rsi
+	movq	%rbp, %rdi
+.LEHB33:
+	call	*16(%rax)
+	movq	$0, 48(%rbp)
+	movq	96(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1186
+	movq	%rbp, %rsi
+	movq	%r14, %rdi
+	call	*8(%rax)
+.LEHE33:
+	movdqa	96(%rsp), %xmm3
+	movaps	%xmm3, 48(%rbp)
+.L1186:
+	movq	64(%rbp), %rax
+	lock subq	$1, (%rax)
+	jmp	.L1166
+.L1185:
+	call	sched_yield@PLT
+	jmp	.L1166
+.L1168:
+	movq	112(%r8), %rcx
+	leaq	112(%r8), %rdx
+	testq	%rcx, %rcx
+	jne	.L1300
+	movq	16(%r8), %rsi
+	xorl	%r14d, %r14d
+	jmp	.L1175
+.L1300:
+	xorl	%r14d, %r14d
+.L1174:
+	leaq	32(%r8), %rdi
+	movq	%rdx, 40(%rsp)
+	movq	%r8, 32(%rsp)
+	movq	%rdi, 24(%rsp)
+	call	pthread_mutex_lock@PLT
+	movq	32(%rsp), %r8
+	movq	24(%rsp), %rdi
+	movq	40(%rsp), %rdx
+	movq	104(%r8), %rax
+	cmpq	88(%r8), %rax
+	jne	.L1176
+	movq	%r8, 24(%rsp)
+	call	pthread_mutex_unlock@PLT
+	movq	24(%rsp), %r8
+	movq	16(%r8), %rsi
+	testq	%r14, %r14
+	jne	.L1177
+	xorl	%ecx, %ecx
+	jmp	.L1175
+.L1169:
+	movq	(%r10), %r9
+	movq	8(%r10), %r10
+	subq	$1, %r9
+	andq	%rax, %r9
+	movq	(%r10,%r9,8), %rbp
+	cmpq	%rcx, %rax
+	jne	.L1172
+	lock cmpxchgq	%rdx, (%rsi)
+	movq	%rdx, (%rdi)
+	je	.L1172
+	jmp	.L1170
+	.p2align 4,,10
+	.p2align 3
+.L1167:
+	movq	112(%r8), %rcx
+	leaq	112(%r8), %rdx
+	testq	%rcx, %rcx
+	jne	.L1174
+	movq	16(%r8), %rsi
+	jmp	.L1175
+.L1176:
+	movq	72(%r8), %rcx
+	leaq	1(%rax), %rsi
+	movq	%rsi, 104(%r8)
+	movq	(%rcx,%rax,8), %rbp
+	lock subq	$1, (%rdx)
+	movq	88(%r8), %rax
+	cmpq	%rax, 104(%r8)
+	jne	.L1387
+	movq	$0, 88(%r8)
+	movq	$0, 104(%r8)
+.L1387:
+	call	pthread_mutex_unlock@PLT
+	jmp	.L1172
+.L1401:
+	addq	$16, %rax
+	movq	%rbx, 24(%rsp)
+	movq	%rax, 16(%rsp)
+	movq	%rax, %r14
+	movq	%r12, 32(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1191:
+	movq	8(%r14), %rbp
+	leaq	16(%r14), %r12
+	xorl	%ebx, %ebx
+	testq	%rbp, %rbp
+	je	.L1195
+	.p2align 4,,10
+	.p2align 3
+.L1196:
+	movq	48(%r12), %rcx
+	testq	%rcx, %rcx
+	je	.L1193
+	addq	$1, %rbx
+	movq	56(%r12), %rsi
+	movq	%r12, %rdi
+	addq	$80, %r12
+	call	*16(%rcx)
+	cmpq	%rbx, %rbp
+	jne	.L1196
+.L1195:
+	movq	$0, 8(%r14)
+	movq	(%r14), %r14
+	testq	%r14, %r14
+	jne	.L1191
+	movq	16(%rsp), %rax
+	movq	(%rsp), %rsi
+	movq	24(%rsp), %rbx
+	movq	32(%rsp), %r12
+	movq	%rax, 672(%rsi)
+	jmp	.L1165
+	.p2align 4,,10
+	.p2align 3
+.L1193:
+	addq	$1, %rbx
+	addq	$80, %r12
+	cmpq	%rbx, %rbp
+	jne	.L1196
+	jmp	.L1195
+.L1398:
+	xorl	%ebp, %ebp
+	jmp	.L1216
+.L1307:
+	movq	%rax, %rbx
+	jmp	.L1287
+.L1306:
+	movq	%rax, %rbx
+	jmp	.L1187
+.L1287:
+	movq	96(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1288
+	movq	104(%rsp), %rsi
+	movq	%r14, %rdi
+	call	*16(%rax)
+.L1288:
+	movq	%rbx, %rdi
+.LEHB34:
+	call	_Unwind_Resume@PLT
+.LEHE34:
+.L1187:
+	movq	96(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1288
+	movq	104(%rsp), %rsi
+	movq	%r14, %rdi
+	call	*16(%rax)
+	jmp	.L1288
+	.cfi_endproc
+.LFE6874:
+	.section	.gcc_except_table
+.LLSDA6874:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6874-.LLSDACSB6874
+.LLSDACSB6874:
+	.uleb128 .LEHB30-.LFB6874
+	.uleb128 .LEHE30-.LEHB30
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB31-.LFB6874
+	.uleb128 .LEHE31-.LEHB31
+	.uleb128 .L1307-.LFB6874
+	.uleb128 0
+	.uleb128 .LEHB32-.LFB6874
+	.uleb128 .LEHE32-.LEHB32
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB33-.LFB6874
+	.uleb128 .LEHE33-.LEHB33
+	.uleb128 .L1306-.LFB6874
+	.uleb128 0
+	.uleb128 .LEHB34-.LFB6874
+	.uleb128 .LEHE34-.LEHB34
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6874:
+	.section	.text._ZN1n7io_ring4waitEPmmm,"axG",@progbits,_ZN1n7io_ring4waitEPmmm,comdat
+	.size	_ZN1n7io_ring4waitEPmmm, .-_ZN1n7io_ring4waitEPmmm
+	.section	.text._ZN1n11ring_reader6__fillEv,"axG",@progbits,_ZN1n11ring_reader6__fillEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n11ring_reader6__fillEv
+	.type	_ZN1n11ring_reader6__fillEv, @function
+_ZN1n11ring_reader6__fillEv:
+.LFB6885:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6885
+	movq	80(%rdi), %rax
+	cmpq	%rax, 72(%rdi)
+	jb	.L1457
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	cmpb	$0, 88(%rdi)
+	jne	.L1460
+.L1405:
+	movq	56(%rbx), %rax
+	cmpq	48(%rbx), %rax
+	je	.L1427
+	cmpb	$0, 89(%rbx)
+	je	.L1461
+.L1427:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1461:
+	.cfi_restore_state
+	xorl	%edx, %edx
+	movq	(%rbx), %rbp
+	divq	24(%rbx)
+	addq	16(%rbx), %rdx
+	leaq	(%rdx,%rdx,2), %r12
+	movq	%rdx, %r13
+	salq	$4, %r12
+	jmp	.L1428
+	.p2align 4,,10
+	.p2align 3
+.L1430:
+	movl	$1, %esi
+	movq	%rbp, %rdi
+.LEHB35:
+	call	_ZN1n7io_ring4waitEPmmm.constprop.0
+	testq	%rax, %rax
+	je	.L1429
+.L1428:
+	movq	24(%rbp), %rax
+	addq	%r12, %rax
+	cmpl	$1, 8(%rax)
+	je	.L1430
+	movq	40(%rax), %rax
+	addq	$1, 56(%rbx)
+	testq	%rax, %rax
+	jle	.L1462
+	movq	(%rbx), %rdx
+	movq	16(%rdx), %rcx
+	cmpq	%rcx, %rax
+	setb	89(%rbx)
+	imulq	%rcx, %r13
+	addq	(%rdx), %r13
+	movq	%r13, 64(%rbx)
+	movq	%rax, 80(%rbx)
+	movl	$1, %eax
+	movq	$0, 72(%rbx)
+	movb	$1, 88(%rbx)
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1460:
+	.cfi_restore_state
+	cmpb	$0, 89(%rdi)
+	movq	(%rdi), %rbp
+	movb	$0, 88(%rdi)
+	jne	.L1406
+	movq	32(%rdi), %rax
+	movq	40(%rdi), %r8
+	testq	%rax, %rax
+	js	.L1407
+	cmpq	%r8, %rax
+	jle	.L1406
+.L1407:
+	movq	48(%rbx), %rax
+	xorl	%edx, %edx
+	movq	16(%rbp), %rcx
+	movq	%rbp, %rdi
+	movl	8(%rbx), %esi
+	xorl	%r9d, %r9d
+	divq	24(%rbx)
+	addq	16(%rbx), %rdx
+	call	_ZN1n7io_ring7__queueEimmlb
+	movq	(%rbx), %rbp
+	testb	%al, %al
+	je	.L1406
+	movq	16(%rbp), %rax
+	addq	$1, 48(%rbx)
+	addq	%rax, 40(%rbx)
+.L1406:
+	movl	64(%rbp), %esi
+	testl	%esi, %esi
+	jns	.L1463
+	movq	216(%rbp), %rax
+	testq	%rax, %rax
+	je	.L1405
+	cmpq	56(%rbp), %rax
+	je	.L1464
+.L1413:
+	movq	%rbp, %rdi
+	call	_ZN1n7io_ring6submitEv.part.0
+	jmp	.L1405
+	.p2align 4,,10
+	.p2align 3
+.L1463:
+	movl	168(%rbp), %edx
+	testl	%edx, %edx
+	jne	.L1412
+	jmp	.L1405
+	.p2align 4,,10
+	.p2align 3
+.L1411:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1405
+	movl	168(%rbp), %edx
+	movl	64(%rbp), %esi
+.L1412:
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 168
+	xorl	%ecx, %ecx
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	pushq	$0
+	.cfi_def_cfa_offset 176
+	movl	$426, %edi
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%rdx
+	.cfi_def_cfa_offset 168
+	popq	%rcx
+	.cfi_def_cfa_offset 160
+	testq	%rax, %rax
+	js	.L1411
+	subl	%eax, 168(%rbp)
+	jmp	.L1405
+	.p2align 4,,10
+	.p2align 3
+.L1457:
+	.cfi_def_cfa_offset 8
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.cfi_restore 14
+	.cfi_restore 15
+	movl	$1, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1462:
+	.cfi_def_cfa_offset 160
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	jne	.L1435
+	xorl	%eax, %eax
+.L1432:
+	movl	%eax, 92(%rbx)
+	movb	$1, 89(%rbx)
+	jmp	.L1427
+	.p2align 4,,10
+	.p2align 3
+.L1429:
+	addq	$1, 56(%rbx)
+	movq	$-5, %rax
+.L1435:
+	negl	%eax
+	jmp	.L1432
+.L1464:
+	movq	192(%rbp), %rax
+	leaq	16(%rsp), %r13
+	movq	%rax, (%rsp)
+	leaq	8(%rax), %r15
+	.p2align 4,,10
+	.p2align 3
+.L1414:
+	movq	(%r15), %rax
+	testq	%rax, %rax
+	movq	(%rsp), %rax
+	je	.L1465
+.L1419:
+	movq	(%rax), %rsi
+	movq	%r13, %rdi
+	call	_ZN1n11thread_pool11__find_workEv
+	cmpb	$0, 24(%rsp)
+	je	.L1415
+	movq	16(%rsp), %r12
+	leaq	32(%rsp), %r14
+	movq	48(%r12), %rax
+	movq	%r12, %rdi
+	call	*(%rax)
+.LEHE35:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 32(%rsp)
+	movaps	%xmm0, 48(%rsp)
+	movaps	%xmm0, 64(%rsp)
+	movaps	%xmm0, 80(%rsp)
+	cmpq	%r14, %r12
+	je	.L1416
+	movq	48(%r12), %rax
+	testq	%rax, %rax
+	je	.L1416
+	movq	56(%r12), %rsi
+	movq	%r12, %rdi
+.LEHB36:
+	call	*16(%rax)
+	movq	$0, 48(%r12)
+	movq	80(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1416
+	movq	%r12, %rsi
+	movq	%r14, %rdi
+	call	*8(%rax)
+.LEHE36:
+	movdqa	80(%rsp), %xmm1
+	movaps	%xmm1, 48(%r12)
+.L1416:
+	movq	64(%r12), %rax
+	lock subq	$1, (%rax)
+	movq	(%r15), %rax
+	testq	%rax, %rax
+	movq	(%rsp), %rax
+	jne	.L1419
+.L1465:
+	addq	$16, %rax
+	movq	%rax, 8(%rsp)
+	movq	%rax, %r14
+	.p2align 4,,10
+	.p2align 3
+.L1421:
+	movq	8(%r14), %r12
+	leaq	16(%r14), %r13
+	xorl	%r15d, %r15d
+	testq	%r12, %r12
+	je	.L1425
+	.p2align 4,,10
+	.p2align 3
+.L1426:
+	movq	48(%r13), %rcx
+	testq	%rcx, %rcx
+	je	.L1423
+	addq	$1, %r15
+	movq	56(%r13), %rsi
+	movq	%r13, %rdi
+	addq	$80, %r13
+	call	*16(%rcx)
+	cmpq	%r15, %r12
+	jne	.L1426
+.L1425:
+	movq	$0, 8(%r14)
+	movq	(%r14), %r14
+	testq	%r14, %r14
+	jne	.L1421
+	movq	(%rsp), %rax
+	movq	8(%rsp), %rdx
+	movq	%rdx, 672(%rax)
+	jmp	.L1413
+	.p2align 4,,10
+	.p2align 3
+.L1423:
+	addq	$1, %r15
+	addq	$80, %r13
+	cmpq	%r15, %r12
+	jne	.L1426
+	jmp	.L1425
+	.p2align 4,,10
+	.p2align 3
+.L1415:
+	call	sched_yield@PLT
+	jmp	.L1414
+.L1437:
+	movq	%rax, %rbx
+.L1417:
+	movq	80(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1418
+	movq	88(%rsp), %rsi
+	movq	%r14, %rdi
+	call	*16(%rax)
+.L1418:
+	movq	%rbx, %rdi
+.LEHB37:
+	call	_Unwind_Resume@PLT
+.LEHE37:
+	.cfi_endproc
+.LFE6885:
+	.section	.gcc_except_table
+.LLSDA6885:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6885-.LLSDACSB6885
+.LLSDACSB6885:
+	.uleb128 .LEHB35-.LFB6885
+	.uleb128 .LEHE35-.LEHB35
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB36-.LFB6885
+	.uleb128 .LEHE36-.LEHB36
+	.uleb128 .L1437-.LFB6885
+	.uleb128 0
+	.uleb128 .LEHB37-.LFB6885
+	.uleb128 .LEHE37-.LEHB37
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6885:
+	.section	.text._ZN1n11ring_reader6__fillEv,"axG",@progbits,_ZN1n11ring_reader6__fillEv,comdat
+	.size	_ZN1n11ring_reader6__fillEv, .-_ZN1n11ring_reader6__fillEv
+	.section	.text._ZN1n11ring_readerC2ERNS_7io_ringEimm,"axG",@progbits,_ZN1n11ring_readerC5ERNS_7io_ringEimm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n11ring_readerC2ERNS_7io_ringEimm
+	.type	_ZN1n11ring_readerC2ERNS_7io_ringEimm, @function
+_ZN1n11ring_readerC2ERNS_7io_ringEimm:
+.LFB6887:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6887
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	movl	%edx, %edi
+	subq	$232, %rsp
+	.cfi_def_cfa_offset 288
+	movl	%edx, 8(%rbx)
+	movq	8(%rsi), %rdx
+	movdqa	.LC4(%rip), %xmm0
+	movq	%rsi, (%rbx)
+	leaq	80(%rsp), %rsi
+	movq	%rdx, %rax
+	movq	%rcx, 16(%rbx)
+	subq	%rcx, %rax
+	movq	$0, 64(%rbx)
+	cmpq	%r8, %rax
+	movw	$0, 88(%rbx)
+	cmova	%r8, %rax
+	cmpq	%rdx, %rcx
+	movl	$0, %edx
+	movups	%xmm0, 32(%rbx)
+	movl	$0, 92(%rbx)
+	pxor	%xmm0, %xmm0
+	cmovnb	%rdx, %rax
+	movups	%xmm0, 48(%rbx)
+	movups	%xmm0, 72(%rbx)
+	movq	%rax, 24(%rbx)
+	call	fstat@PLT
+	testl	%eax, %eax
+	jne	.L1468
+	movl	104(%rsp), %eax
+	andl	$61440, %eax
+	cmpl	$32768, %eax
+	je	.L1551
+.L1468:
+	movq	(%rbx), %rbp
+	movq	24(%rbx), %rcx
+	xorl	%r13d, %r13d
+	movl	64(%rbp), %esi
+	testq	%rcx, %rcx
+	je	.L1482
+.L1481:
+	cmpb	$0, 89(%rbx)
+	jne	.L1482
+	movq	32(%rbx), %rax
+	movq	40(%rbx), %r8
+	testq	%rax, %rax
+	js	.L1470
+	cmpq	%r8, %rax
+	jle	.L1471
+.L1470:
+	movq	48(%rbx), %rdi
+	xorl	%edx, %edx
+	movq	%rdi, %rax
+	divq	%rcx
+	addq	16(%rbx), %rdx
+	movq	%rdx, %r12
+	testl	%esi, %esi
+	js	.L1552
+.L1472:
+	cmpq	8(%rbp), %r12
+	jnb	.L1471
+	leaq	(%r12,%r12,2), %rdx
+	salq	$4, %rdx
+	addq	24(%rbp), %rdx
+	cmpl	$1, 8(%rdx)
+	je	.L1471
+	movq	16(%rbp), %rax
+	movl	8(%rbx), %r9d
+	movb	$0, 4(%rdx)
+	movl	$1, 8(%rdx)
+	movl	%r9d, (%rdx)
+	movq	%rax, 16(%rdx)
+	movq	$0, 24(%rdx)
+	movq	%r8, 32(%rdx)
+	movq	$0, 40(%rdx)
+	addq	$1, 56(%rbp)
+	testl	%esi, %esi
+	jns	.L1553
+	movq	216(%rbp), %rax
+	movq	208(%rbp), %r15
+	movq	200(%rbp), %r14
+	cmpq	%r15, %rax
+	je	.L1554
+	movq	%r12, (%r14,%rax,8)
+	movq	216(%rbp), %rdx
+	movq	%rbp, %rax
+.L1480:
+	addq	$1, %rdx
+	movq	%rdx, 216(%rbp)
+	movq	%rax, %rbp
+.L1476:
+	movq	16(%rbp), %rax
+	addq	%r8, %rax
+	movq	%rax, 40(%rbx)
+	leaq	1(%rdi), %rax
+	movq	%rax, 48(%rbx)
+.L1471:
+	addq	$1, %r13
+	cmpq	%rcx, %r13
+	jb	.L1481
+	.p2align 4,,10
+	.p2align 3
+.L1482:
+	testl	%esi, %esi
+	jns	.L1555
+	movq	216(%rbp), %rax
+	testq	%rax, %rax
+	je	.L1466
+	cmpq	56(%rbp), %rax
+	je	.L1556
+.L1488:
+	movq	%rbp, %rdi
+.LEHB38:
+	call	_ZN1n7io_ring6submitEv.part.0
+.L1466:
+	addq	$232, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1552:
+	.cfi_restore_state
+	cmpq	$0, 192(%rbp)
+	jne	.L1472
+	jmp	.L1471
+	.p2align 4,,10
+	.p2align 3
+.L1553:
+	movq	120(%rbp), %rax
+	pxor	%xmm0, %xmm0
+	movl	(%rax), %edi
+	movl	%edi, %eax
+	andl	128(%rbp), %eax
+	salq	$6, %rax
+	addq	104(%rbp), %rax
+	movups	%xmm0, (%rax)
+	movups	%xmm0, 16(%rax)
+	movups	%xmm0, 32(%rax)
+	movups	%xmm0, 48(%rax)
+	cmpb	$0, 68(%rbp)
+	movzbl	4(%rdx), %ecx
+	jne	.L1557
+	addl	$22, %ecx
+	movb	%cl, (%rax)
+.L1475:
+	movl	(%rdx), %ecx
+	movq	24(%rdx), %rsi
+	movl	%ecx, 4(%rax)
+	movq	32(%rdx), %rcx
+	movq	16(%rdx), %rdx
+	addq	%rsi, %rcx
+	movq	%rcx, 8(%rax)
+	movq	16(%rbp), %rcx
+	subl	%esi, %edx
+	imulq	%r12, %rcx
+	addq	%rsi, %rcx
+	addq	0(%rbp), %rcx
+	movl	%edx, 24(%rax)
+	movq	%rcx, 16(%rax)
+	movq	120(%rbp), %rdx
+	movq	%r12, 32(%rax)
+	leal	1(%rdi), %eax
+	movl	%eax, (%rdx)
+	addl	$1, 168(%rbp)
+	movq	(%rbx), %rbp
+	movq	40(%rbx), %r8
+	movq	48(%rbx), %rdi
+	movq	24(%rbx), %rcx
+	movl	64(%rbp), %esi
+	jmp	.L1476
+	.p2align 4,,10
+	.p2align 3
+.L1557:
+	addl	$4, %ecx
+	movw	%r12w, 40(%rax)
+	movb	%cl, (%rax)
+	jmp	.L1475
+	.p2align 4,,10
+	.p2align 3
+.L1555:
+	movl	168(%rbp), %edx
+	testl	%edx, %edx
+	jne	.L1484
+	jmp	.L1466
+	.p2align 4,,10
+	.p2align 3
+.L1486:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1466
+	movl	168(%rbp), %edx
+	movl	64(%rbp), %esi
+.L1484:
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 296
+	xorl	%ecx, %ecx
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	pushq	$0
+	.cfi_def_cfa_offset 304
+	movl	$426, %edi
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%rdx
+	.cfi_def_cfa_offset 296
+	popq	%rcx
+	.cfi_def_cfa_offset 288
+	testq	%rax, %rax
+	js	.L1486
+	subl	%eax, 168(%rbp)
+	jmp	.L1466
+	.p2align 4,,10
+	.p2align 3
+.L1551:
+	movq	128(%rsp), %rax
+	movq	%rax, 32(%rbx)
+	jmp	.L1468
+	.p2align 4,,10
+	.p2align 3
+.L1554:
+	movq	224(%rbp), %rdi
+	leaq	5(%r15), %rsi
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 208(%rbp)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	216(%rbp), %rdx
+	movq	%rax, 200(%rbp)
+	movq	%r12, (%rax,%rdx,8)
+	movq	216(%rbp), %rdx
+	testq	%rdx, %rdx
+	jne	.L1558
+	testq	%r14, %r14
+	je	.L1549
+.L1479:
+	movq	224(%rbp), %rdi
+	leaq	0(,%r15,8), %rdx
+	movl	$8, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	216(%rbp), %rdx
+.L1549:
+	movq	(%rbx), %rax
+	movq	40(%rbx), %r8
+	movq	48(%rbx), %rdi
+	movq	24(%rbx), %rcx
+	movl	64(%rax), %esi
+	jmp	.L1480
+	.p2align 4,,10
+	.p2align 3
+.L1556:
+	movq	192(%rbp), %r14
+	leaq	8(%r14), %rbx
+	.p2align 4,,10
+	.p2align 3
+.L1489:
+	movq	(%rbx), %rax
+	testq	%rax, %rax
+	je	.L1559
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %r12
+	movq	(%r14), %r13
+	testq	%r12, %r12
+	je	.L1490
+	cmpq	(%r12), %r13
+	jne	.L1491
+	movq	128(%r12), %rcx
+	movq	136(%r12), %r9
+	leaq	64(%r12), %rdi
+	leaq	128(%r12), %r8
+	leaq	-1(%rcx), %rax
+	movq	%rax, 128(%r12)
+	lock orq	$0, (%rsp)
+	movq	64(%r12), %rsi
+	cmpq	%rsi, %rax
+	jge	.L1492
+	movq	%rcx, 128(%r12)
+.L1493:
+	movq	112(%r13), %rax
+	leaq	112(%r13), %rdx
+	testq	%rax, %rax
+	jne	.L1497
+	movq	16(%r13), %rsi
+.L1502:
+	movq	16(%r12), %rdx
+	movq	%rdx, %rax
+	salq	$13, %rax
+	xorq	%rdx, %rax
+	movq	%rax, %rdx
+	shrq	$7, %rdx
+	xorq	%rax, %rdx
+	movq	%rdx, %rax
+	salq	$17, %rax
+	xorq	%rdx, %rax
+	xorl	%edx, %edx
+	movq	%rax, 16(%r12)
+	divq	%rsi
+	movq	%rdx, %rcx
+.L1498:
+	leaq	(%rsi,%rcx), %r8
+	testq	%rsi, %rsi
+	jne	.L1507
+	jmp	.L1508
+	.p2align 4,,10
+	.p2align 3
+.L1505:
+	addq	$1, %rcx
+	cmpq	%rcx, %r8
+	je	.L1508
+.L1507:
+	movq	%rcx, %rax
+	xorl	%edx, %edx
+	divq	%rsi
+	movq	0(%r13), %rax
+	movq	(%rax,%rdx,8), %rdx
+	cmpq	%rdx, %r12
+	je	.L1505
+	movq	64(%rdx), %rax
+	leaq	64(%rdx), %r9
+	lock orq	$0, (%rsp)
+	movq	128(%rdx), %rdi
+	cmpq	%rdi, %rax
+	jge	.L1505
+	movq	136(%rdx), %rdi
+	movq	(%rdi), %rdx
+	movq	8(%rdi), %rdi
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%rdi,%rdx,8), %r15
+	leaq	1(%rax), %rdx
+	lock cmpxchgq	%rdx, (%r9)
+	jne	.L1505
+.L1495:
+	movq	48(%r15), %rax
+	movq	%r15, %rdi
+	leaq	16(%rsp), %r12
+	call	*(%rax)
+.LEHE38:
+	pxor	%xmm1, %xmm1
+	movaps	%xmm1, 16(%rsp)
+	movaps	%xmm1, 32(%rsp)
+	movaps	%xmm1, 48(%rsp)
+	movaps	%xmm1, 64(%rsp)
+	cmpq	%r12, %r15
+	je	.L1509
+	movq	48(%r15), %rax
+	testq	%rax, %rax
+	je	.L1509
+	movq	56(%r15), %rsi
+	movq	%r15, %rdi
+.LEHB39:
+	call	*16(%rax)
+	movq	$0, 48(%r15)
+	movq	64(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1509
+	movq	%r15, %rsi
+	movq	%r12, %rdi
+	call	*8(%rax)
+.LEHE39:
+	movdqa	64(%rsp), %xmm2
+	movaps	%xmm2, 48(%r15)
+.L1509:
+	movq	64(%r15), %rax
+	lock subq	$1, (%rax)
+	jmp	.L1489
+	.p2align 4,,10
+	.p2align 3
+.L1508:
+	call	sched_yield@PLT
+	jmp	.L1489
+	.p2align 4,,10
+	.p2align 3
+.L1491:
+	movq	112(%r13), %rcx
+	leaq	112(%r13), %rdx
+	testq	%rcx, %rcx
+	jne	.L1523
+	movq	16(%r13), %rsi
+	xorl	%r12d, %r12d
+	jmp	.L1498
+	.p2align 4,,10
+	.p2align 3
+.L1523:
+	xorl	%r12d, %r12d
+.L1497:
+	leaq	32(%r13), %rdi
+	movq	%rdx, 8(%rsp)
+	movq	%rdi, (%rsp)
+	call	pthread_mutex_lock@PLT
+	movq	104(%r13), %rax
+	cmpq	88(%r13), %rax
+	movq	(%rsp), %rdi
+	je	.L1499
+	movq	72(%r13), %rcx
+	movq	8(%rsp), %rdx
+	leaq	1(%rax), %rsi
+	movq	%rsi, 104(%r13)
+	movq	(%rcx,%rax,8), %r15
+	lock subq	$1, (%rdx)
+	movq	88(%r13), %rax
+	cmpq	%rax, 104(%r13)
+	jne	.L1550
+	movq	$0, 88(%r13)
+	movq	$0, 104(%r13)
+.L1550:
+	call	pthread_mutex_unlock@PLT
+	jmp	.L1495
+	.p2align 4,,10
+	.p2align 3
+.L1492:
+	movq	(%r9), %rdx
+	movq	8(%r9), %r9
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%r9,%rdx,8), %r15
+	cmpq	%rsi, %rax
+	jne	.L1495
+	lock cmpxchgq	%rcx, (%rdi)
+	movq	%rcx, (%r8)
+	je	.L1495
+	jmp	.L1493
+	.p2align 4,,10
+	.p2align 3
+.L1490:
+	movq	112(%r13), %rcx
+	leaq	112(%r13), %rdx
+	testq	%rcx, %rcx
+	jne	.L1497
+	movq	16(%r13), %rsi
+	jmp	.L1498
+	.p2align 4,,10
+	.p2align 3
+.L1499:
+	call	pthread_mutex_unlock@PLT
+	movq	16(%r13), %rsi
+	testq	%r12, %r12
+	jne	.L1502
+	xorl	%ecx, %ecx
+	jmp	.L1498
+	.p2align 4,,10
+	.p2align 3
+.L1559:
+	leaq	16(%r14), %rax
+	movq	%rax, (%rsp)
+	movq	%rax, %r13
+	.p2align 4,,10
+	.p2align 3
+.L1514:
+	movq	8(%r13), %r12
+	leaq	16(%r13), %rbx
+	xorl	%r15d, %r15d
+	testq	%r12, %r12
+	je	.L1518
+	.p2align 4,,10
+	.p2align 3
+.L1519:
+	movq	48(%rbx), %rdx
+	testq	%rdx, %rdx
+	je	.L1516
+	addq	$1, %r15
+	movq	56(%rbx), %rsi
+	movq	%rbx, %rdi
+	addq	$80, %rbx
+	call	*16(%rdx)
+	cmpq	%r15, %r12
+	jne	.L1519
+.L1518:
+	movq	$0, 8(%r13)
+	movq	0(%r13), %r13
+	testq	%r13, %r13
+	jne	.L1514
+	movq	(%rsp), %rax
+	movq	%rax, 672(%r14)
+	jmp	.L1488
+	.p2align 4,,10
+	.p2align 3
+.L1516:
+	addq	$1, %r15
+	addq	$80, %rbx
+	cmpq	%r15, %r12
+	jne	.L1519
+	jmp	.L1518
+.L1558:
+	salq	$3, %rdx
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L1479
+.L1524:
+	movq	%rax, %rbx
+.L1510:
+	movq	64(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1511
+	movq	72(%rsp), %rsi
+	movq	%r12, %rdi
+	call	*16(%rax)
+.L1511:
+	movq	%rbx, %rdi
+.LEHB40:
+	call	_Unwind_Resume@PLT
+.LEHE40:
+	.cfi_endproc
+.LFE6887:
+	.section	.gcc_except_table
+.LLSDA6887:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6887-.LLSDACSB6887
+.LLSDACSB6887:
+	.uleb128 .LEHB38-.LFB6887
+	.uleb128 .LEHE38-.LEHB38
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB39-.LFB6887
+	.uleb128 .LEHE39-.LEHB39
+	.uleb128 .L1524-.LFB6887
+	.uleb128 0
+	.uleb128 .LEHB40-.LFB6887
+	.uleb128 .LEHE40-.LEHB40
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6887:
+	.section	.text._ZN1n11ring_readerC2ERNS_7io_ringEimm,"axG",@progbits,_ZN1n11ring_readerC5ERNS_7io_ringEimm,comdat
+	.size	_ZN1n11ring_readerC2ERNS_7io_ringEimm, .-_ZN1n11ring_readerC2ERNS_7io_ringEimm
+	.weak	_ZN1n11ring_readerC1ERNS_7io_ringEimm
+	.set	_ZN1n11ring_readerC1ERNS_7io_ringEimm,_ZN1n11ring_readerC2ERNS_7io_ringEimm
+	.section	.text._ZN1n11ring_readerD2Ev,"axG",@progbits,_ZN1n11ring_readerD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n11ring_readerD2Ev
+	.type	_ZN1n11ring_readerD2Ev, @function
+_ZN1n11ring_readerD2Ev:
+.LFB6890:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6890
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$120, %rsp
+	.cfi_def_cfa_offset 176
+	movq	(%rdi), %rbx
+	movq	%rdi, (%rsp)
+	testq	%rbx, %rbx
+	je	.L1560
+	movq	56(%rdi), %r12
+	cmpq	48(%rdi), %r12
+	jnb	.L1560
+.L1687:
+	movq	(%rsp), %rdi
+	movq	%r12, %rax
+	xorl	%edx, %edx
+	divq	24(%rdi)
+	movq	16(%rdi), %rax
+	addq	%rdx, %rax
+	leaq	(%rax,%rax,2), %rax
+	salq	$4, %rax
+	movq	%rax, 16(%rsp)
+.L1742:
+	movq	24(%rbx), %rax
+	movq	16(%rsp), %rdi
+	cmpl	$1, 8(%rax,%rdi)
+	jne	.L1685
+	movq	56(%rbx), %rax
+	movl	64(%rbx), %esi
+	movl	$1, %r13d
+	cmpq	$0, %rax
+	cmovbe	%rax, %r13
+	testl	%esi, %esi
+	jns	.L1775
+	movq	216(%rbx), %rdx
+	testq	%rdx, %rdx
+	je	.L1568
+	cmpq	%rdx, %rax
+	je	.L1776
+.L1569:
+	movq	%rbx, %rdi
+	call	_ZN1n7io_ring6submitEv.part.0
+	movl	64(%rbx), %esi
+.L1566:
+	testl	%esi, %esi
+	js	.L1568
+.L1564:
+	movq	136(%rbx), %rax
+	xorl	%r15d, %r15d
+	movl	(%rax), %edx
+	movq	144(%rbx), %rax
+	movl	(%rax), %ecx
+	cmpl	%ecx, %edx
+	jne	.L1615
+	jmp	.L1602
+	.p2align 4,,10
+	.p2align 3
+.L1778:
+	addq	24(%rax), %rsi
+	movq	%rsi, 24(%rax)
+	cmpq	16(%rax), %rsi
+	jb	.L1777
+.L1614:
+	addl	$1, %edx
+	movq	%rsi, 40(%rax)
+	addq	$1, %r15
+	movl	$2, 8(%rax)
+	subq	$1, 56(%rbx)
+	cmpl	%edx, %ecx
+	je	.L1602
+.L1615:
+	movl	%edx, %esi
+	andl	152(%rbx), %esi
+	salq	$4, %rsi
+	addq	160(%rbx), %rsi
+	movq	(%rsi), %rdi
+	movslq	8(%rsi), %rsi
+	leaq	(%rdi,%rdi,2), %rax
+	salq	$4, %rax
+	addq	24(%rbx), %rax
+	cmpl	$-4, %esi
+	je	.L1699
+	cmpl	$-11, %esi
+	je	.L1699
+	testl	%esi, %esi
+	jg	.L1778
+	jne	.L1614
+	movq	24(%rax), %rsi
+	jmp	.L1614
+	.p2align 4,,10
+	.p2align 3
+.L1699:
+	movq	120(%rbx), %rsi
+	pxor	%xmm1, %xmm1
+	movl	(%rsi), %r9d
+	movl	%r9d, %esi
+	andl	128(%rbx), %esi
+	salq	$6, %rsi
+	addq	104(%rbx), %rsi
+	movups	%xmm1, (%rsi)
+	movups	%xmm1, 16(%rsi)
+	movups	%xmm1, 32(%rsi)
+	movups	%xmm1, 48(%rsi)
+	cmpb	$0, 68(%rbx)
+	movzbl	4(%rax), %r11d
+	je	.L1610
+.L1774:
+	leal	4(%r11), %r8d
+	movw	%di, 40(%rsi)
+	movb	%r8b, (%rsi)
+.L1611:
+	movl	(%rax), %r8d
+	movq	24(%rax), %r10
+	addl	$1, %r9d
+	addl	$1, %edx
+	movl	%r8d, 4(%rsi)
+	movq	32(%rax), %r8
+	movq	16(%rax), %rax
+	addq	%r10, %r8
+	movq	%r8, 8(%rsi)
+	movq	16(%rbx), %r8
+	subl	%r10d, %eax
+	imulq	%rdi, %r8
+	addq	%r10, %r8
+	addq	(%rbx), %r8
+	movl	%eax, 24(%rsi)
+	movq	%r8, 16(%rsi)
+	movq	120(%rbx), %rax
+	movq	%rdi, 32(%rsi)
+	movl	%r9d, (%rax)
+	movl	168(%rbx), %eax
+	addl	$1, %eax
+	movl	%eax, 168(%rbx)
+	cmpl	%edx, %ecx
+	jne	.L1615
+.L1602:
+	movq	136(%rbx), %rax
+	movl	%ecx, (%rax)
+	movl	168(%rbx), %edx
+	testl	%edx, %edx
+	jne	.L1620
+	jmp	.L1619
+	.p2align 4,,10
+	.p2align 3
+.L1617:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1619
+	movl	168(%rbx), %edx
+.L1620:
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 184
+	movl	64(%rbx), %esi
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	pushq	$0
+	.cfi_def_cfa_offset 192
+	xorl	%ecx, %ecx
+	movl	$426, %edi
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%r8
+	.cfi_def_cfa_offset 184
+	popq	%r9
+	.cfi_def_cfa_offset 176
+	testq	%rax, %rax
+	js	.L1617
+	subl	%eax, 168(%rbx)
+.L1619:
+	xorl	%ebp, %ebp
+	cmpq	%r13, %r15
+	jnb	.L1779
+	movl	64(%rbx), %esi
+	testl	%esi, %esi
+	jns	.L1658
+	jmp	.L1653
+	.p2align 4,,10
+	.p2align 3
+.L1654:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1685
+	movl	64(%rbx), %esi
+.L1658:
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 184
+	movl	168(%rbx), %edx
+	xorl	%r9d, %r9d
+	xorl	%eax, %eax
+	pushq	$0
+	.cfi_def_cfa_offset 192
+	movl	$1, %ecx
+	movl	$1, %r8d
+	movl	$426, %edi
+	call	syscall@PLT
+	popq	%rdx
+	.cfi_def_cfa_offset 184
+	popq	%rcx
+	.cfi_def_cfa_offset 176
+	testq	%rax, %rax
+	js	.L1654
+	subl	%eax, 168(%rbx)
+.L1683:
+	movl	64(%rbx), %eax
+	leaq	384(%rbx), %rdx
+	xorl	%r15d, %r15d
+	testl	%eax, %eax
+	js	.L1649
+	movq	136(%rbx), %rax
+	xorl	%r15d, %r15d
+	movl	(%rax), %esi
+	movq	144(%rbx), %rax
+	movl	(%rax), %edi
+	cmpl	%edi, %esi
+	jne	.L1641
+	jmp	.L1628
+	.p2align 4,,10
+	.p2align 3
+.L1781:
+	addq	24(%rax), %rdx
+	movq	%rdx, 24(%rax)
+	cmpq	16(%rax), %rdx
+	jb	.L1780
+.L1640:
+	movq	%rdx, 40(%rax)
+	addq	$1, %r15
+	movl	$2, 8(%rax)
+	subq	$1, 56(%rbx)
+.L1638:
+	addl	$1, %esi
+	cmpl	%esi, %edi
+	je	.L1628
+.L1641:
+	movl	%esi, %edx
+	andl	152(%rbx), %edx
+	salq	$4, %rdx
+	addq	160(%rbx), %rdx
+	movq	(%rdx), %r8
+	movslq	8(%rdx), %rdx
+	leaq	(%r8,%r8,2), %rax
+	salq	$4, %rax
+	addq	24(%rbx), %rax
+	cmpl	$-4, %edx
+	je	.L1700
+	cmpl	$-11, %edx
+	je	.L1700
+	testl	%edx, %edx
+	jg	.L1781
+	jne	.L1640
+	movq	24(%rax), %rdx
+	jmp	.L1640
+.L1779:
+	testq	%r15, %r15
+	jne	.L1742
+	.p2align 4,,10
+	.p2align 3
+.L1685:
+	movq	(%rsp), %rax
+	addq	$1, %r12
+	cmpq	48(%rax), %r12
+	jnb	.L1560
+	movq	(%rax), %rbx
+	jmp	.L1687
+.L1777:
+	movq	120(%rbx), %rsi
+	pxor	%xmm3, %xmm3
+	movl	(%rsi), %r9d
+	movl	%r9d, %esi
+	andl	128(%rbx), %esi
+	salq	$6, %rsi
+	addq	104(%rbx), %rsi
+	movups	%xmm3, (%rsi)
+	movups	%xmm3, 16(%rsi)
+	movups	%xmm3, 32(%rsi)
+	movups	%xmm3, 48(%rsi)
+	cmpb	$0, 68(%rbx)
+	movzbl	4(%rax), %r11d
+	jne	.L1774
+.L1610:
+	leal	22(%r11), %r8d
+	movb	%r8b, (%rsi)
+	jmp	.L1611
+	.p2align 4,,10
+	.p2align 3
+.L1647:
+	js	.L1645
+.L1649:
+	movq	(%rdx), %rax
+.L1651:
+	movq	264(%rbx), %rcx
+	andq	%rax, %rcx
+	salq	$4, %rcx
+	addq	256(%rbx), %rcx
+	movq	(%rcx), %rsi
+	subq	$1, %rsi
+	cmpq	%rax, %rsi
+	jne	.L1647
+	leaq	1(%rax), %rsi
+	lock cmpxchgq	%rsi, (%rdx)
+	jne	.L1651
+	movq	264(%rbx), %rdi
+	movq	8(%rcx), %rsi
+	addq	$1, %r15
+	leaq	1(%rax,%rdi), %rax
+	movq	%rax, (%rcx)
+	leaq	(%rsi,%rsi,2), %rax
+	salq	$4, %rax
+	addq	24(%rbx), %rax
+	movl	$2, 8(%rax)
+	subq	$1, 56(%rbx)
+	movq	(%rdx), %rax
+	jmp	.L1651
+	.p2align 4,,10
+	.p2align 3
+.L1628:
+	movq	136(%rbx), %rax
+	movl	%edi, (%rax)
+	movl	168(%rbx), %edx
+	testl	%edx, %edx
+	jne	.L1646
+	jmp	.L1645
+	.p2align 4,,10
+	.p2align 3
+.L1643:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1645
+	movl	168(%rbx), %edx
+.L1646:
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 184
+	movl	64(%rbx), %esi
+	movl	$426, %edi
+	xorl	%r9d, %r9d
+	pushq	$0
+	.cfi_def_cfa_offset 192
+	xorl	%r8d, %r8d
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%rsi
+	.cfi_def_cfa_offset 184
+	popq	%rdi
+	.cfi_def_cfa_offset 176
+	testq	%rax, %rax
+	js	.L1643
+	subl	%eax, 168(%rbx)
+.L1645:
+	testq	%r15, %r15
+	jne	.L1742
+	movl	64(%rbx), %esi
+	testl	%esi, %esi
+	jns	.L1658
+.L1653:
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %r15
+	movq	192(%rbx), %rax
+	movq	(%rax), %r14
+	testq	%r15, %r15
+	je	.L1659
+	cmpq	(%r15), %r14
+	jne	.L1660
+	movq	128(%r15), %rcx
+	movq	136(%r15), %r10
+	leaq	64(%r15), %rdi
+	leaq	128(%r15), %r8
+	leaq	-1(%rcx), %rax
+	movq	%rax, 128(%r15)
+	lock orq	$0, (%rsp)
+	movq	64(%r15), %r9
+	cmpq	%r9, %rax
+	jge	.L1661
+	movq	%rcx, 128(%r15)
+.L1662:
+	movq	112(%r14), %rax
+	leaq	112(%r14), %rdx
+	testq	%rax, %rax
+	jne	.L1666
+	movq	16(%r14), %r8
+.L1671:
+	movq	16(%r15), %rdx
+	movq	%rdx, %rax
+	salq	$13, %rax
+	xorq	%rdx, %rax
+	movq	%rax, %rdx
+	shrq	$7, %rdx
+	xorq	%rax, %rdx
+	movq	%rdx, %rax
+	salq	$17, %rax
+	xorq	%rdx, %rax
+	xorl	%edx, %edx
+	movq	%rax, 16(%r15)
+	divq	%r8
+	movq	%rdx, %rdi
+.L1667:
+	leaq	(%rdi,%r8), %r9
+	testq	%r8, %r8
+	jne	.L1677
+	jmp	.L1678
+	.p2align 4,,10
+	.p2align 3
+.L1675:
+	addq	$1, %rdi
+	cmpq	%r9, %rdi
+	je	.L1678
+.L1677:
+	movq	%rdi, %rax
+	xorl	%edx, %edx
+	divq	%r8
+	movq	(%r14), %rax
+	movq	(%rax,%rdx,8), %rdx
+	cmpq	%r15, %rdx
+	je	.L1675
+	movq	64(%rdx), %rax
+	leaq	64(%rdx), %rsi
+	lock orq	$0, (%rsp)
+	movq	128(%rdx), %rcx
+	cmpq	%rcx, %rax
+	jge	.L1675
+	movq	136(%rdx), %rcx
+	movq	(%rcx), %rdx
+	movq	8(%rcx), %rcx
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%rcx,%rdx,8), %r13
+	leaq	1(%rax), %rdx
+	lock cmpxchgq	%rdx, (%rsi)
+	jne	.L1675
+.L1664:
+	movq	48(%r13), %rax
+	movq	%r13, %rdi
+	leaq	48(%rsp), %r15
+	call	*(%rax)
+	pxor	%xmm2, %xmm2
+	movaps	%xmm2, 48(%rsp)
+	movaps	%xmm2, 64(%rsp)
+	movaps	%xmm2, 80(%rsp)
+	movaps	%xmm2, 96(%rsp)
+	cmpq	%r15, %r13
+	je	.L1679
+	movq	48(%r13), %rax
+	testq	%rax, %rax
+	je	.L1679
+	movq	56(%r13), %rsi
+	movq	%r13, %rdi
+.LEHB41:
+	call	*16(%rax)
+	movq	$0, 48(%r13)
+	movq	96(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1679
+	movq	%r13, %rsi
+	movq	%r15, %rdi
+	call	*8(%rax)
+.LEHE41:
+	movdqa	96(%rsp), %xmm6
+	movaps	%xmm6, 48(%r13)
+.L1679:
+	movq	64(%r13), %rax
+	lock subq	$1, (%rax)
+	jmp	.L1683
+	.p2align 4,,10
+	.p2align 3
+.L1780:
+	movq	120(%rbx), %rdx
+	pxor	%xmm0, %xmm0
+	movl	(%rdx), %r9d
+	movl	%r9d, %edx
+	andl	128(%rbx), %edx
+	salq	$6, %rdx
+	addq	104(%rbx), %rdx
+	movups	%xmm0, (%rdx)
+	movups	%xmm0, 16(%rdx)
+	movups	%xmm0, 32(%rdx)
+	movups	%xmm0, 48(%rdx)
+	cmpb	$0, 68(%rbx)
+	movzbl	4(%rax), %ecx
+	je	.L1636
+	addl	$4, %ecx
+	movw	%r8w, 40(%rdx)
+	movb	%cl, (%rdx)
+.L1637:
+	movl	(%rax), %ecx
+	movq	24(%rax), %r10
+	movl	%ecx, 4(%rdx)
+	movq	32(%rax), %rcx
+	movq	16(%rax), %rax
+	addq	%r10, %rcx
+	movq	%rcx, 8(%rdx)
+	movq	16(%rbx), %rcx
+	subl	%r10d, %eax
+	imulq	%r8, %rcx
+	addq	%r10, %rcx
+	addq	(%rbx), %rcx
+	movl	%eax, 24(%rdx)
+	movq	%rcx, 16(%rdx)
+	movq	%r8, 32(%rdx)
+.L1771:
+	movq	120(%rbx), %rax
+	addl	$1, %r9d
+	movl	%r9d, (%rax)
+	movl	168(%rbx), %eax
+	addl	$1, %eax
+	movl	%eax, 168(%rbx)
+	jmp	.L1638
+	.p2align 4,,10
+	.p2align 3
+.L1636:
+	addl	$22, %ecx
+	movb	%cl, (%rdx)
+	jmp	.L1637
+.L1678:
+	cmpl	$63, %ebp
+	ja	.L1782
+	rep nop
+	addl	$1, %ebp
+	jmp	.L1683
+	.p2align 4,,10
+	.p2align 3
+.L1660:
+	movq	112(%r14), %rdi
+	leaq	112(%r14), %rdx
+	testq	%rdi, %rdi
+	jne	.L1696
+	movq	16(%r14), %r8
+	xorl	%r15d, %r15d
+	jmp	.L1667
+.L1696:
+	xorl	%r15d, %r15d
+.L1666:
+	leaq	32(%r14), %rdi
+	movq	%rdx, 24(%rsp)
+	movq	%rdi, 8(%rsp)
+	call	pthread_mutex_lock@PLT
+	movq	104(%r14), %rax
+	cmpq	88(%r14), %rax
+	movq	8(%rsp), %rdi
+	je	.L1668
+	movq	72(%r14), %rcx
+	movq	24(%rsp), %rdx
+	leaq	1(%rax), %r8
+	movq	%r8, 104(%r14)
+	movq	(%rcx,%rax,8), %r13
+	lock subq	$1, (%rdx)
+	movq	88(%r14), %rax
+	cmpq	%rax, 104(%r14)
+	jne	.L1772
+	movq	$0, 88(%r14)
+	movq	$0, 104(%r14)
+.L1772:
+	call	pthread_mutex_unlock@PLT
+	jmp	.L1664
+.L1661:
+	movq	(%r10), %rsi
+	movq	8(%r10), %r10
+	leaq	-1(%rsi), %rdx
+	andq	%rax, %rdx
+	movq	(%r10,%rdx,8), %r13
+	cmpq	%r9, %rax
+	jne	.L1664
+	lock cmpxchgq	%rcx, (%rdi)
+	movq	%rcx, (%r8)
+	je	.L1664
+	jmp	.L1662
+	.p2align 4,,10
+	.p2align 3
+.L1782:
+	call	sched_yield@PLT
+	jmp	.L1683
+.L1659:
+	movq	112(%r14), %rdi
+	leaq	112(%r14), %rdx
+	testq	%rdi, %rdi
+	jne	.L1666
+	movq	16(%r14), %r8
+	jmp	.L1667
+.L1668:
+	call	pthread_mutex_unlock@PLT
+	movq	16(%r14), %r8
+	testq	%r15, %r15
+	jne	.L1671
+	xorl	%edi, %edi
+	jmp	.L1667
+.L1568:
+	leaq	384(%rbx), %rsi
+	xorl	%r15d, %r15d
+	.p2align 4,,10
+	.p2align 3
+.L1601:
+	movq	(%rsi), %rax
+.L1624:
+	movq	264(%rbx), %rdx
+	andq	%rax, %rdx
+	salq	$4, %rdx
+	addq	256(%rbx), %rdx
+	movq	(%rdx), %rcx
+	subq	$1, %rcx
+	cmpq	%rax, %rcx
+	jne	.L1621
+	leaq	1(%rax), %rcx
+	lock cmpxchgq	%rcx, (%rsi)
+	jne	.L1624
+	movq	264(%rbx), %rdi
+	movq	8(%rdx), %rcx
+	addq	$1, %r15
+	leaq	1(%rax,%rdi), %rax
+	movq	%rax, (%rdx)
+	leaq	(%rcx,%rcx,2), %rax
+	salq	$4, %rax
+	addq	24(%rbx), %rax
+	movl	$2, 8(%rax)
+	subq	$1, 56(%rbx)
+	movq	(%rsi), %rax
+	jmp	.L1624
+	.p2align 4,,10
+	.p2align 3
+.L1621:
+	jns	.L1601
+	jmp	.L1619
+.L1775:
+	movl	168(%rbx), %edx
+	testl	%edx, %edx
+	jne	.L1567
+	jmp	.L1564
+	.p2align 4,,10
+	.p2align 3
+.L1565:
+	call	__errno_location@PLT
+	movl	64(%rbx), %esi
+	cmpl	$4, (%rax)
+	jne	.L1566
+	movl	168(%rbx), %edx
+.L1567:
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 184
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	xorl	%ecx, %ecx
+	pushq	$0
+	.cfi_def_cfa_offset 192
+	movl	$426, %edi
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%r10
+	.cfi_def_cfa_offset 184
+	popq	%r11
+	.cfi_def_cfa_offset 176
+	testq	%rax, %rax
+	js	.L1565
+	subl	%eax, 168(%rbx)
+	movl	64(%rbx), %esi
+	jmp	.L1566
+	.p2align 4,,10
+	.p2align 3
+.L1700:
+	movq	120(%rbx), %rdx
+	pxor	%xmm5, %xmm5
+	movl	(%rdx), %r9d
+	movl	%r9d, %ecx
+	andl	128(%rbx), %ecx
+	salq	$6, %rcx
+	addq	104(%rbx), %rcx
+	movups	%xmm5, (%rcx)
+	movups	%xmm5, 16(%rcx)
+	movups	%xmm5, 32(%rcx)
+	movups	%xmm5, 48(%rcx)
+	cmpb	$0, 68(%rbx)
+	movzbl	4(%rax), %edx
+	je	.L1631
+	addl	$4, %edx
+	movw	%r8w, 40(%rcx)
+	movb	%dl, (%rcx)
+.L1632:
+	movl	(%rax), %edx
+	movq	24(%rax), %r10
+	movl	%edx, 4(%rcx)
+	movq	32(%rax), %rdx
+	movq	16(%rax), %rax
+	addq	%r10, %rdx
+	movq	%rdx, 8(%rcx)
+	movq	16(%rbx), %rdx
+	subl	%r10d, %eax
+	imulq	%r8, %rdx
+	addq	%r10, %rdx
+	addq	(%rbx), %rdx
+	movl	%eax, 24(%rcx)
+	movq	%rdx, 16(%rcx)
+	movq	%r8, 32(%rcx)
+	jmp	.L1771
+	.p2align 4,,10
+	.p2align 3
+.L1631:
+	addl	$22, %edx
+	movb	%dl, (%rcx)
+	jmp	.L1632
+.L1776:
+	movq	192(%rbx), %rax
+	movq	%rax, 8(%rsp)
+	addq	$8, %rax
+	movq	%rax, 24(%rsp)
+.L1570:
+	movq	24(%rsp), %rax
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	movq	8(%rsp), %rax
+	je	.L1783
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %r15
+	movq	(%rax), %r8
+	testq	%r15, %r15
+	je	.L1571
+	cmpq	(%r15), %r8
+	jne	.L1572
+	movq	128(%r15), %rdx
+	movq	136(%r15), %r10
+	leaq	64(%r15), %rsi
+	leaq	128(%r15), %rdi
+	leaq	-1(%rdx), %rax
+	movq	%rax, 128(%r15)
+	lock orq	$0, (%rsp)
+	movq	64(%r15), %r9
+	cmpq	%r9, %rax
+	jge	.L1573
+	movq	%rdx, 128(%r15)
+.L1574:
+	movq	112(%r8), %rax
+	leaq	112(%r8), %r14
+	testq	%rax, %rax
+	jne	.L1578
+	movq	16(%r8), %rsi
+.L1581:
+	movq	16(%r15), %rdx
+	movq	%rdx, %rax
+	salq	$13, %rax
+	xorq	%rdx, %rax
+	movq	%rax, %rdx
+	shrq	$7, %rdx
+	xorq	%rax, %rdx
+	movq	%rdx, %rax
+	salq	$17, %rax
+	xorq	%rdx, %rax
+	xorl	%edx, %edx
+	movq	%rax, 16(%r15)
+	divq	%rsi
+	movq	%rdx, %rcx
+.L1579:
+	leaq	(%rcx,%rsi), %rdi
+	testq	%rsi, %rsi
+	jne	.L1588
+	jmp	.L1589
+	.p2align 4,,10
+	.p2align 3
+.L1586:
+	addq	$1, %rcx
+	cmpq	%rcx, %rdi
+	je	.L1589
+.L1588:
+	movq	%rcx, %rax
+	xorl	%edx, %edx
+	divq	%rsi
+	movq	(%r8), %rax
+	movq	(%rax,%rdx,8), %rdx
+	cmpq	%r15, %rdx
+	je	.L1586
+	movq	64(%rdx), %rax
+	leaq	64(%rdx), %r10
+	lock orq	$0, (%rsp)
+	movq	128(%rdx), %r9
+	cmpq	%r9, %rax
+	jge	.L1586
+	movq	136(%rdx), %r9
+	movq	(%r9), %rdx
+	movq	8(%r9), %r9
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%r9,%rdx,8), %rbp
+	leaq	1(%rax), %rdx
+	lock cmpxchgq	%rdx, (%r10)
+	jne	.L1586
+.L1576:
+	movq	48(%rbp), %rax
+	movq	%rbp, %rdi
+	leaq	48(%rsp), %r15
+	call	*(%rax)
+	pxor	%xmm4, %xmm4
+	movaps	%xmm4, 48(%rsp)
+	movaps	%xmm4, 64(%rsp)
+	movaps	%xmm4, 80(%rsp)
+	movaps	%xmm4, 96(%rsp)
+	cmpq	%r15, %rbp
+	je	.L1590
+	movq	48(%rbp), %rax
+	testq	%rax, %rax
+	je	.L1590
+	movq	56(%rbp), %rsi
+	movq	%rbp, %rdi
+.LEHB42:
+	call	*16(%rax)
+	movq	$0, 48(%rbp)
+	movq	96(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1590
+	movq	%rbp, %rsi
+	movq	%r15, %rdi
+	call	*8(%rax)
+.LEHE42:
+	movdqa	96(%rsp), %xmm7
+	movaps	%xmm7, 48(%rbp)
+.L1590:
+	movq	64(%rbp), %rax
+	lock subq	$1, (%rax)
+	jmp	.L1570
+.L1589:
+	call	sched_yield@PLT
+	jmp	.L1570
+.L1572:
+	movq	112(%r8), %rcx
+	leaq	112(%r8), %r14
+	testq	%rcx, %rcx
+	jne	.L1692
+	movq	16(%r8), %rsi
+	xorl	%r15d, %r15d
+	jmp	.L1579
+.L1692:
+	xorl	%r15d, %r15d
+.L1578:
+	leaq	32(%r8), %rdi
+	movq	%r8, 40(%rsp)
+	movq	%rdi, 32(%rsp)
+	call	pthread_mutex_lock@PLT
+	movq	40(%rsp), %r8
+	movq	32(%rsp), %rdi
+	movq	104(%r8), %rax
+	cmpq	88(%r8), %rax
+	jne	.L1580
+	movq	%r8, 32(%rsp)
+	call	pthread_mutex_unlock@PLT
+	movq	32(%rsp), %r8
+	movq	16(%r8), %rsi
+	testq	%r15, %r15
+	jne	.L1581
+	xorl	%ecx, %ecx
+	jmp	.L1579
+.L1573:
+	movq	(%r10), %rcx
+	movq	8(%r10), %r10
+	subq	$1, %rcx
+	andq	%rax, %rcx
+	movq	(%r10,%rcx,8), %rbp
+	cmpq	%r9, %rax
+	jne	.L1576
+	lock cmpxchgq	%rdx, (%rsi)
+	movq	%rdx, (%rdi)
+	je	.L1576
+	jmp	.L1574
+	.p2align 4,,10
+	.p2align 3
+.L1571:
+	movq	112(%r8), %rcx
+	leaq	112(%r8), %r14
+	testq	%rcx, %rcx
+	jne	.L1578
+	movq	16(%r8), %rsi
+	jmp	.L1579
+.L1783:
+	movq	%r12, 24(%rsp)
+	leaq	16(%rax), %r14
+	movq	%rbx, 32(%rsp)
+	movq	%r14, %r15
+.L1595:
+	movq	8(%r15), %rbp
+	leaq	16(%r15), %r12
+	xorl	%ebx, %ebx
+	testq	%rbp, %rbp
+	je	.L1599
+	.p2align 4,,10
+	.p2align 3
+.L1600:
+	movq	48(%r12), %rcx
+	testq	%rcx, %rcx
+	je	.L1597
+	addq	$1, %rbx
+	movq	56(%r12), %rsi
+	movq	%r12, %rdi
+	addq	$80, %r12
+	call	*16(%rcx)
+	cmpq	%rbx, %rbp
+	jne	.L1600
+.L1599:
+	movq	$0, 8(%r15)
+	movq	(%r15), %r15
+	testq	%r15, %r15
+	jne	.L1595
+.L1784:
+	movq	8(%rsp), %rax
+	movq	24(%rsp), %r12
+	movq	32(%rsp), %rbx
+	movq	%r14, 672(%rax)
+	jmp	.L1569
+	.p2align 4,,10
+	.p2align 3
+.L1597:
+	addq	$1, %rbx
+	addq	$80, %r12
+	cmpq	%rbx, %rbp
+	jne	.L1600
+	movq	$0, 8(%r15)
+	movq	(%r15), %r15
+	testq	%r15, %r15
+	jne	.L1595
+	jmp	.L1784
+.L1580:
+	movq	72(%r8), %rcx
+	leaq	1(%rax), %rsi
+	movq	%rsi, 104(%r8)
+	movq	(%rcx,%rax,8), %rbp
+	lock subq	$1, (%r14)
+	movq	88(%r8), %rax
+	cmpq	%rax, 104(%r8)
+	jne	.L1773
+	movq	$0, 88(%r8)
+	movq	$0, 104(%r8)
+.L1773:
+	call	pthread_mutex_unlock@PLT
+	jmp	.L1576
+.L1560:
+	addq	$120, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L1698:
+	.cfi_restore_state
+	jmp	.L1680
+.L1697:
+	jmp	.L1591
+.L1680:
+	movq	96(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1682
+	movq	104(%rsp), %rsi
+	movq	%r15, %rdi
+	call	*16(%rax)
+.L1682:
+	call	_ZSt9terminatev@PLT
+.L1591:
+	movq	96(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1682
+	movq	104(%rsp), %rsi
+	movq	%r15, %rdi
+	call	*16(%rax)
+	jmp	.L1682
+	.cfi_endproc
+.LFE6890:
+	.section	.gcc_except_table
+.LLSDA6890:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6890-.LLSDACSB6890
+.LLSDACSB6890:
+	.uleb128 .LEHB41-.LFB6890
+	.uleb128 .LEHE41-.LEHB41
+	.uleb128 .L1698-.LFB6890
+	.uleb128 0
+	.uleb128 .LEHB42-.LFB6890
+	.uleb128 .LEHE42-.LEHB42
+	.uleb128 .L1697-.LFB6890
+	.uleb128 0
+.LLSDACSE6890:
+	.section	.text._ZN1n11ring_readerD2Ev,"axG",@progbits,_ZN1n11ring_readerD5Ev,comdat
+	.size	_ZN1n11ring_readerD2Ev, .-_ZN1n11ring_readerD2Ev
+	.weak	_ZN1n11ring_readerD1Ev
+	.set	_ZN1n11ring_readerD1Ev,_ZN1n11ring_readerD2Ev
+	.section	.rodata._ZN1n4test10test_suite7run_allEv.str1.1,"aMS",@progbits,1
+.LC7:
+	.string	"\nSUITE [%s] "
+.LC9:
+	.string	"%s"
+.LC10:
+	.string	"\nTEST [%s] "
+.LC11:
+	.string	" - Result : \033[1;32mPASSED\033[0m"
+.LC12:
+	.string	"\033[1;31merror : %s\033[0m\n"
+.LC13:
+	.string	" - Result : \033[1;31mFAILED\033[0m"
+.LC14:
+	.string	" - Passed : \033[1;32m%d\033[0m\n"
+.LC15:
+	.string	" - Failed : \033[1;31m%d\033[0m\n"
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4test10test_suite7run_allEv
+	.type	_ZN1n4test10test_suite7run_allEv, @function
+_ZN1n4test10test_suite7run_allEv:
+.LFB6928:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6928
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	leaq	.LC7(%rip), %rdx
+	movl	$79, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	16(%rdi), %rcx
+	leaq	16(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L1786
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L1787
+	testb	$4, %cl
+	jne	.L1840
+	testl	%ecx, %ecx
+	je	.L1786
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L1841
+	.p2align 4,,10
+	.p2align 3
+.L1786:
+	movzwl	.LC8(%rip), %r15d
+	movq	%rbx, %rsi
+	leaq	.LC9(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+.LEHB43:
+	call	printf@PLT
+	movl	8(%r12), %esi
+	testl	%esi, %esi
+	jle	.L1807
+	movl	$0, 12(%rsp)
+	xorl	%ebp, %ebp
+	xorl	%r14d, %r14d
+	jmp	.L1801
+	.p2align 4,,10
+	.p2align 3
+.L1844:
+	testb	$4, %dl
+	jne	.L1842
+	testl	%edx, %edx
+	je	.L1792
+	movb	$42, (%rax)
+	testb	$2, %dl
+	jne	.L1843
+	.p2align 4,,10
+	.p2align 3
+.L1792:
+	movq	%rbx, %rsi
+	leaq	.LC9(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+.LEHE43:
+	movq	(%r12), %rax
+.LEHB44:
+	call	*8(%rax,%r13)
+.LEHE44:
+	leaq	.LC11(%rip), %rdi
+	addl	$1, %r14d
+.LEHB45:
+	call	puts@PLT
+.L1797:
+	addq	$1, %rbp
+	cmpl	%ebp, 8(%r12)
+	jle	.L1791
+.L1801:
+	movq	(%r12), %rax
+	movq	%rbp, %r13
+	movq	%rbx, %rdi
+	movl	$79, %esi
+	salq	$4, %r13
+	leaq	.LC10(%rip), %rdx
+	movq	(%rax,%r13), %rcx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L1792
+	movl	$79, %edx
+	subl	%eax, %edx
+	addq	%rbx, %rax
+	cmpl	$8, %edx
+	jb	.L1844
+	movabsq	$3038287259199220266, %rsi
+	leaq	8(%rax), %rdi
+	movl	%edx, %ecx
+	andq	$-8, %rdi
+	movq	%rsi, (%rax)
+	movq	%rsi, -8(%rax,%rcx)
+	subq	%rdi, %rax
+	leal	(%rdx,%rax), %ecx
+	movq	%rsi, %rax
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L1792
+.L1807:
+	movl	$0, 12(%rsp)
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L1791:
+	movabsq	$5917806138674729738, %rax
+	movq	%rbx, %rdi
+	movq	%rax, 16(%rsp)
+	movabsq	$9095440486453792, %rax
+	movq	%rax, 22(%rsp)
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L1802
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L1803
+	testb	$4, %cl
+	jne	.L1845
+	testl	%ecx, %ecx
+	je	.L1802
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L1846
+.L1802:
+	movq	%rbx, %rsi
+	leaq	.LC9(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+	movl	%r14d, %esi
+	leaq	.LC14(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	12(%rsp), %esi
+	leaq	.LC15(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	$10, %edi
+	call	putchar@PLT
+.LEHE45:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L1803:
+	.cfi_restore_state
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L1802
+.L1787:
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L1786
+.L1842:
+	movl	$707406378, (%rax)
+	movl	$707406378, -4(%rax,%rdx)
+	jmp	.L1792
+.L1843:
+	movl	$10794, %ecx
+	movw	%cx, -2(%rax,%rdx)
+	jmp	.L1792
+.L1841:
+	movl	$10794, %edi
+	movw	%di, -2(%rdx,%rcx)
+	jmp	.L1786
+.L1846:
+	movl	$10794, %eax
+	movw	%ax, -2(%rdx,%rcx)
+	jmp	.L1802
+.L1840:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L1786
+.L1845:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L1802
+.L1808:
+	movq	%rax, %rdi
+	movq	%rdx, %rax
+.L1798:
+	subq	$1, %rax
+	jne	.L1839
+	call	__cxa_begin_catch@PLT
+	leaq	.LC12(%rip), %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+.LEHB46:
+	call	printf@PLT
+.LEHE46:
+	call	__cxa_end_catch@PLT
+	leaq	.LC13(%rip), %rdi
+	addl	$1, 12(%rsp)
+.LEHB47:
+	call	puts@PLT
+	jmp	.L1797
+.L1800:
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+.L1839:
+	call	_Unwind_Resume@PLT
+.LEHE47:
+.L1809:
+	movq	%rax, %rbx
+	jmp	.L1800
+	.cfi_endproc
+.LFE6928:
+	.section	.gcc_except_table
+	.align 4
+.LLSDA6928:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT6928-.LLSDATTD6928
+.LLSDATTD6928:
+	.byte	0x1
+	.uleb128 .LLSDACSE6928-.LLSDACSB6928
+.LLSDACSB6928:
+	.uleb128 .LEHB43-.LFB6928
+	.uleb128 .LEHE43-.LEHB43
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB44-.LFB6928
+	.uleb128 .LEHE44-.LEHB44
+	.uleb128 .L1808-.LFB6928
+	.uleb128 0x1
+	.uleb128 .LEHB45-.LFB6928
+	.uleb128 .LEHE45-.LEHB45
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB46-.LFB6928
+	.uleb128 .LEHE46-.LEHB46
+	.uleb128 .L1809-.LFB6928
+	.uleb128 0
+	.uleb128 .LEHB47-.LFB6928
+	.uleb128 .LEHE47-.LEHB47
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6928:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	DW.ref._ZTIPKc-.
+.LLSDATT6928:
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.size	_ZN1n4test10test_suite7run_allEv, .-_ZN1n4test10test_suite7run_allEv
+	.text
+	.p2align 4
+	.globl	_Z13write_patternPKcmm
+	.type	_Z13write_patternPKcmm, @function
+_Z13write_patternPKcmm:
+.LFB6929:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	movq	%rsi, %r15
+	movl	$577, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdx, %rbp
+	movl	$438, %edx
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$4120, %rsp
+	.cfi_def_cfa_offset 4176
+	call	open@PLT
+	movl	%eax, 12(%rsp)
+	testq	%r15, %r15
+	je	.L1848
+	xorl	%r14d, %r14d
+	leaq	16(%rsp), %rbx
+	movabsq	$367465021388636487, %r12
+	.p2align 4,,10
+	.p2align 3
+.L1851:
+	movq	%r15, %r13
+	movl	$4096, %eax
+	subq	%r14, %r13
+	cmpq	%rax, %r13
+	cmova	%rax, %r13
+	cmpq	%r14, %r15
+	je	.L1849
+	movq	%rbp, %rcx
+	leaq	(%rbx,%r13), %rdi
+	movq	%rbx, %rsi
+	imulq	%r14, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L1850:
+	movq	%rcx, %rax
+	addq	$1, %rsi
+	mulq	%r12
+	movq	%rcx, %rax
+	subq	%rdx, %rax
+	shrq	%rax
+	addq	%rax, %rdx
+	movq	%rcx, %rax
+	addq	%rbp, %rcx
+	shrq	$7, %rdx
+	imulq	$251, %rdx, %rdx
+	subq	%rdx, %rax
+	movb	%al, -1(%rsi)
+	cmpq	%rsi, %rdi
+	jne	.L1850
+.L1849:
+	movl	12(%rsp), %edi
+	movq	%r13, %rdx
+	movq	%rbx, %rsi
+	addq	%r13, %r14
+	call	write@PLT
+	cmpq	%r15, %r14
+	jb	.L1851
+.L1848:
+	movl	12(%rsp), %edi
+	call	close@PLT
+	addq	$4120, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE6929:
+	.size	_Z13write_patternPKcmm, .-_Z13write_patternPKcmm
+	.section	.text.unlikely
+.LCOLDB16:
+	.text
+.LHOTB16:
+	.p2align 4
+	.globl	_Z12read_patternRN1n11ring_readerEmm
+	.type	_Z12read_patternRN1n11ring_readerEmm, @function
+_Z12read_patternRN1n11ring_readerEmm:
+.LFB6930:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6930
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$136, %rsp
+	.cfi_def_cfa_offset 192
+	movq	%rdi, (%rsp)
+	movq	%rsi, 16(%rsp)
+.LEHB48:
+	call	_ZN1n11ring_reader6__fillEv
+	testb	%al, %al
+	je	.L1859
+	movq	80(%r14), %r10
+	movl	%eax, %ebx
+	movq	72(%r14), %rax
+	movl	$3000, %edx
+	movq	$0, 8(%rsp)
+	movq	64(%r14), %rcx
+	movabsq	$367465021388636487, %r13
+	movq	%r10, %r8
+	subq	%rax, %r8
+	cmpq	%rdx, %r8
+	cmova	%rdx, %r8
+	addq	%rax, %rcx
+	leaq	(%rax,%r8), %r9
+	movq	%r9, 72(%r14)
+	cmpq	%rax, %r10
+	je	.L1859
+	.p2align 4,,10
+	.p2align 3
+.L1860:
+	testq	%r8, %r8
+	je	.L1923
+	movq	8(%rsp), %rsi
+	leaq	(%rcx,%r8), %rdi
+	imulq	%rbp, %rsi
+	.p2align 4,,10
+	.p2align 3
+.L1862:
+	testb	%bl, %bl
+	je	.L1861
+	movq	%rsi, %rax
+	mulq	%r13
+	movq	%rsi, %rax
+	subq	%rdx, %rax
+	shrq	%rax
+	addq	%rax, %rdx
+	movq	%rsi, %rax
+	shrq	$7, %rdx
+	imulq	$251, %rdx, %rdx
+	subq	%rdx, %rax
+	cmpb	%al, (%rcx)
+	sete	%bl
+.L1861:
+	addq	$1, %rcx
+	addq	%rbp, %rsi
+	cmpq	%rcx, %rdi
+	jne	.L1862
+.L1923:
+	addq	%r8, 8(%rsp)
+	cmpq	%r10, %r9
+	jb	.L1863
+	movq	(%rsp), %rax
+	cmpb	$0, 88(%rax)
+	jne	.L1976
+.L1865:
+	movq	(%rsp), %rdi
+	movq	56(%rdi), %rax
+	cmpq	48(%rdi), %rax
+	je	.L1921
+	cmpb	$0, 89(%rdi)
+	je	.L1977
+.L1921:
+	movq	8(%rsp), %rcx
+	cmpq	%rcx, 16(%rsp)
+	sete	%al
+	addq	$136, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	andl	%ebx, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L1859:
+	.cfi_restore_state
+	movq	$0, 8(%rsp)
+	movl	$1, %ebx
+	jmp	.L1921
+	.p2align 4,,10
+	.p2align 3
+.L1863:
+	movq	(%rsp), %rax
+	movq	%r10, %r8
+	subq	%r9, %r8
+	movq	64(%rax), %rcx
+	addq	%r9, %rcx
+.L1920:
+	movl	$3000, %eax
+	cmpq	%rax, %r8
+	cmova	%rax, %r8
+	movq	(%rsp), %rax
+	addq	%r8, %r9
+	movq	%r9, 72(%rax)
+	jmp	.L1860
+	.p2align 4,,10
+	.p2align 3
+.L1977:
+	xorl	%edx, %edx
+	movq	(%rdi), %r15
+	divq	24(%rdi)
+	addq	16(%rdi), %rdx
+	leaq	(%rdx,%rdx,2), %r14
+	movq	%rdx, %r12
+	salq	$4, %r14
+	jmp	.L1915
+	.p2align 4,,10
+	.p2align 3
+.L1917:
+	movl	$1, %esi
+	movq	%r15, %rdi
+	call	_ZN1n7io_ring4waitEPmmm.constprop.0
+	testq	%rax, %rax
+	je	.L1932
+.L1915:
+	movq	24(%r15), %rax
+	addq	%r14, %rax
+	cmpl	$1, 8(%rax)
+	je	.L1917
+	movq	40(%rax), %r10
+	movq	(%rsp), %rax
+	addq	$1, 56(%rax)
+	testq	%r10, %r10
+	jle	.L1978
+.L1918:
+	movq	%rax, %rdi
+	movq	(%rax), %rax
+	movq	%r12, %rcx
+	movq	%r10, %r8
+	movq	16(%rax), %rdx
+	cmpq	%rdx, %r10
+	setb	89(%rdi)
+	imulq	%rdx, %rcx
+	addq	(%rax), %rcx
+	xorl	%r9d, %r9d
+	movq	%rcx, 64(%rdi)
+	movq	%r10, 80(%rdi)
+	movb	$1, 88(%rdi)
+	jmp	.L1920
+	.p2align 4,,10
+	.p2align 3
+.L1976:
+	movq	(%rax), %r14
+	cmpb	$0, 89(%rax)
+	movb	$0, 88(%rax)
+	movq	%rax, %rdi
+	movl	64(%r14), %esi
+	jne	.L1866
+	movq	32(%rax), %rax
+	movq	40(%rdi), %rcx
+	testq	%rax, %rax
+	js	.L1867
+	cmpq	%rcx, %rax
+	jle	.L1866
+.L1867:
+	movq	(%rsp), %rdi
+	xorl	%edx, %edx
+	movq	48(%rdi), %rax
+	divq	24(%rdi)
+	addq	16(%rdi), %rdx
+	movl	8(%rdi), %edi
+	movq	%rdx, %r12
+	movq	16(%r14), %rdx
+	testl	%esi, %esi
+	js	.L1979
+	cmpq	8(%r14), %r12
+	jnb	.L1927
+	leaq	(%r12,%r12,2), %rax
+	salq	$4, %rax
+	addq	24(%r14), %rax
+	cmpl	$1, 8(%rax)
+	je	.L1927
+.L1929:
+	movl	%edi, (%rax)
+	movb	$0, 4(%rax)
+	movl	$1, 8(%rax)
+	movq	%rdx, 16(%rax)
+	movq	$0, 24(%rax)
+	movq	%rcx, 32(%rax)
+	movq	$0, 40(%rax)
+	addq	$1, 56(%r14)
+	testl	%esi, %esi
+	jns	.L1980
+	movq	216(%r14), %rax
+	movq	208(%r14), %rcx
+	movq	200(%r14), %r15
+	cmpq	%rcx, %rax
+	je	.L1981
+	movq	%r12, (%r15,%rax,8)
+	movq	216(%r14), %rax
+	movq	%r14, %rdx
+.L1878:
+	addq	$1, %rax
+	movq	%rax, 216(%r14)
+	movq	%rdx, %r14
+.L1874:
+	movq	(%rsp), %rcx
+	movq	16(%r14), %rax
+	addq	$1, 48(%rcx)
+	addq	%rax, 40(%rcx)
+.L1866:
+	testl	%esi, %esi
+	jns	.L1927
+.L1870:
+	movq	216(%r14), %rax
+	testq	%rax, %rax
+	je	.L1865
+	cmpq	56(%r14), %rax
+	je	.L1982
+.L1882:
+	movq	%r14, %rdi
+	call	_ZN1n7io_ring6submitEv.part.0
+	jmp	.L1865
+	.p2align 4,,10
+	.p2align 3
+.L1932:
+	movq	(%rsp), %rax
+	movq	$-5, %r10
+	addq	$1, 56(%rax)
+	testq	%r10, %r10
+	jg	.L1918
+.L1978:
+	movq	%rax, %rcx
+	movl	%r10d, %eax
+	xorl	%edx, %edx
+	negl	%eax
+	testq	%r10, %r10
+	movb	$1, 89(%rcx)
+	cmove	%edx, %eax
+	movl	%eax, 92(%rcx)
+	jmp	.L1921
+.L1927:
+	movl	168(%r14), %edx
+	testl	%edx, %edx
+	jne	.L1881
+	jmp	.L1865
+	.p2align 4,,10
+	.p2align 3
+.L1880:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1865
+	movl	168(%r14), %edx
+	movl	64(%r14), %esi
+.L1881:
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 200
+	xorl	%ecx, %ecx
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	pushq	$0
+	.cfi_def_cfa_offset 208
+	movl	$426, %edi
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%rdx
+	.cfi_def_cfa_offset 200
+	popq	%rcx
+	.cfi_def_cfa_offset 192
+	testq	%rax, %rax
+	js	.L1880
+	subl	%eax, 168(%r14)
+	jmp	.L1865
+.L1979:
+	cmpq	$0, 192(%r14)
+	je	.L1870
+	cmpq	8(%r14), %r12
+	jnb	.L1870
+	imulq	$48, %r12, %rax
+	addq	24(%r14), %rax
+	cmpl	$1, 8(%rax)
+	jne	.L1929
+	jmp	.L1870
+	.p2align 4,,10
+	.p2align 3
+.L1980:
+	movq	120(%r14), %rdx
+	pxor	%xmm0, %xmm0
+	movl	(%rdx), %esi
+	movl	%esi, %edx
+	andl	128(%r14), %edx
+	salq	$6, %rdx
+	addq	104(%r14), %rdx
+	movups	%xmm0, (%rdx)
+	movups	%xmm0, 16(%rdx)
+	movups	%xmm0, 32(%rdx)
+	movups	%xmm0, 48(%rdx)
+	cmpb	$0, 68(%r14)
+	movzbl	4(%rax), %ecx
+	je	.L1872
+	addl	$4, %ecx
+	movw	%r12w, 40(%rdx)
+	movb	%cl, (%rdx)
+.L1873:
+	movl	(%rax), %ecx
+	movq	24(%rax), %rdi
+	addl	$1, %esi
+	movl	%ecx, 4(%rdx)
+	movq	32(%rax), %rcx
+	movq	16(%rax), %rax
+	addq	%rdi, %rcx
+	movq	%rcx, 8(%rdx)
+	movq	16(%r14), %rcx
+	subl	%edi, %eax
+	imulq	%r12, %rcx
+	addq	%rdi, %rcx
+	addq	(%r14), %rcx
+	movl	%eax, 24(%rdx)
+	movq	%rcx, 16(%rdx)
+	movq	120(%r14), %rax
+	movq	%r12, 32(%rdx)
+	movl	%esi, (%rax)
+	movq	(%rsp), %rax
+	addl	$1, 168(%r14)
+	movq	(%rax), %r14
+	movl	64(%r14), %esi
+	jmp	.L1874
+.L1982:
+	movq	192(%r14), %rax
+	movq	%rax, 24(%rsp)
+	addq	$8, %rax
+	movq	%rax, 32(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1883:
+	movq	32(%rsp), %rax
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	movq	24(%rsp), %rax
+	je	.L1983
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %r15
+	movq	(%rax), %r8
+	testq	%r15, %r15
+	je	.L1884
+	cmpq	(%r15), %r8
+	jne	.L1885
+	movq	128(%r15), %rcx
+	movq	136(%r15), %r10
+	leaq	64(%r15), %rsi
+	leaq	128(%r15), %rdi
+	leaq	-1(%rcx), %rax
+	movq	%rax, 128(%r15)
+	lock orq	$0, (%rsp)
+	movq	64(%r15), %r9
+	cmpq	%r9, %rax
+	jge	.L1886
+	movq	%rcx, 128(%r15)
+.L1887:
+	movq	112(%r8), %rax
+	leaq	112(%r8), %rdx
+	testq	%rax, %rax
+	jne	.L1891
+	movq	16(%r8), %rsi
+.L1896:
+	movq	16(%r15), %rdx
+	movq	%rdx, %rax
+	salq	$13, %rax
+	xorq	%rdx, %rax
+	movq	%rax, %rdx
+	shrq	$7, %rdx
+	xorq	%rax, %rdx
+	movq	%rdx, %rax
+	salq	$17, %rax
+	xorq	%rdx, %rax
+	xorl	%edx, %edx
+	movq	%rax, 16(%r15)
+	divq	%rsi
+	movq	%rdx, %rcx
+.L1892:
+	leaq	(%rcx,%rsi), %rdi
+	testq	%rsi, %rsi
+	jne	.L1901
+	jmp	.L1902
+	.p2align 4,,10
+	.p2align 3
+.L1899:
+	addq	$1, %rcx
+	cmpq	%rcx, %rdi
+	je	.L1902
+.L1901:
+	movq	%rcx, %rax
+	xorl	%edx, %edx
+	divq	%rsi
+	movq	(%r8), %rax
+	movq	(%rax,%rdx,8), %rdx
+	cmpq	%rdx, %r15
+	je	.L1899
+	movq	64(%rdx), %rax
+	leaq	64(%rdx), %r11
+	lock orq	$0, (%rsp)
+	movq	128(%rdx), %r9
+	cmpq	%r9, %rax
+	jge	.L1899
+	movq	136(%rdx), %r9
+	movq	(%r9), %rdx
+	movq	8(%r9), %r9
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%r9,%rdx,8), %r10
+	leaq	1(%rax), %rdx
+	lock cmpxchgq	%rdx, (%r11)
+	jne	.L1899
+	movq	%r10, %r12
+.L1889:
+	movq	48(%r12), %rax
+	movq	%r12, %rdi
+	leaq	64(%rsp), %r15
+	call	*(%rax)
+.LEHE48:
+	pxor	%xmm1, %xmm1
+	movaps	%xmm1, 64(%rsp)
+	movaps	%xmm1, 80(%rsp)
+	movaps	%xmm1, 96(%rsp)
+	movaps	%xmm1, 112(%rsp)
+	cmpq	%r15, %r12
+	je	.L1903
+	movq	48(%r12), %rax
+	testq	%rax, %rax
+	je	.L1903
+	movq	56(%r12), %rsi
+	movq	%r12, %rdi
+.LEHB49:
+	call	*16(%rax)
+	movq	$0, 48(%r12)
+	movq	112(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1903
+	movq	%r12, %rsi
+	movq	%r15, %rdi
+	call	*8(%rax)
+.LEHE49:
+	movdqa	112(%rsp), %xmm2
+	movaps	%xmm2, 48(%r12)
+.L1903:
+	movq	64(%r12), %rax
+	lock subq	$1, (%rax)
+	jmp	.L1883
+.L1902:
+	call	sched_yield@PLT
+	jmp	.L1883
+.L1885:
+	movq	112(%r8), %rcx
+	leaq	112(%r8), %rdx
+	testq	%rcx, %rcx
+	jne	.L1931
+	movq	16(%r8), %rsi
+	xorl	%r15d, %r15d
+	jmp	.L1892
+.L1931:
+	xorl	%r15d, %r15d
+.L1891:
+	leaq	32(%r8), %rdi
+	movq	%r8, 48(%rsp)
+	movq	%rdi, 40(%rsp)
+	movq	%rdx, 56(%rsp)
+	call	pthread_mutex_lock@PLT
+	movq	48(%rsp), %r8
+	movq	40(%rsp), %rdi
+	movq	104(%r8), %rax
+	cmpq	88(%r8), %rax
+	je	.L1893
+	movq	72(%r8), %rcx
+	movq	56(%rsp), %rdx
+	leaq	1(%rax), %rsi
+	movq	%rsi, 104(%r8)
+	movq	(%rcx,%rax,8), %r12
+	lock subq	$1, (%rdx)
+	movq	88(%r8), %rax
+	cmpq	%rax, 104(%r8)
+	jne	.L1975
+	movq	$0, 88(%r8)
+	movq	$0, 104(%r8)
+.L1975:
+	call	pthread_mutex_unlock@PLT
+	jmp	.L1889
+.L1886:
+	movq	(%r10), %rdx
+	movq	8(%r10), %r10
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%r10,%rdx,8), %r12
+	cmpq	%r9, %rax
+	jne	.L1889
+	lock cmpxchgq	%rcx, (%rsi)
+	movq	%rcx, (%rdi)
+	je	.L1889
+	jmp	.L1887
+	.p2align 4,,10
+	.p2align 3
+.L1884:
+	movq	112(%r8), %rcx
+	leaq	112(%r8), %rdx
+	testq	%rcx, %rcx
+	jne	.L1891
+	movq	16(%r8), %rsi
+	jmp	.L1892
+.L1893:
+	movq	%r8, 40(%rsp)
+	call	pthread_mutex_unlock@PLT
+	movq	40(%rsp), %r8
+	movq	16(%r8), %rsi
+	testq	%r15, %r15
+	jne	.L1896
+	xorl	%ecx, %ecx
+	jmp	.L1892
+.L1983:
+	addq	$16, %rax
+	movb	%bl, 32(%rsp)
+	movq	%rax, 40(%rsp)
+	movq	%rax, %r15
+	movq	%rbp, 48(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1908:
+	movq	8(%r15), %r12
+	leaq	16(%r15), %rbp
+	xorl	%ebx, %ebx
+	testq	%r12, %r12
+	je	.L1912
+	.p2align 4,,10
+	.p2align 3
+.L1913:
+	movq	48(%rbp), %rax
+	testq	%rax, %rax
+	je	.L1910
+	addq	$1, %rbx
+	movq	56(%rbp), %rsi
+	movq	%rbp, %rdi
+	addq	$80, %rbp
+	call	*16(%rax)
+	cmpq	%rbx, %r12
+	jne	.L1913
+.L1912:
+	movq	$0, 8(%r15)
+	movq	(%r15), %r15
+	testq	%r15, %r15
+	jne	.L1908
+	movq	40(%rsp), %rax
+	movq	24(%rsp), %rcx
+	movzbl	32(%rsp), %ebx
+	movq	48(%rsp), %rbp
+	movq	%rax, 672(%rcx)
+	jmp	.L1882
+	.p2align 4,,10
+	.p2align 3
+.L1910:
+	addq	$1, %rbx
+	addq	$80, %rbp
+	cmpq	%rbx, %r12
+	jne	.L1913
+	jmp	.L1912
+.L1872:
+	addl	$22, %ecx
+	movb	%cl, (%rdx)
+	jmp	.L1873
+.L1981:
+	leaq	5(%rcx), %rax
+	movq	224(%r14), %rdi
+	movq	%rcx, 24(%rsp)
+	leaq	(%rax,%rax), %rdx
+	salq	$4, %rax
+	movq	%rax, %rsi
+	movq	(%rdi), %rax
+	movq	%rdx, 208(%r14)
+	movl	$8, %edx
+.LEHB50:
+	call	*16(%rax)
+	movq	24(%rsp), %rcx
+	movq	%rax, 200(%r14)
+	movq	%rax, %rdi
+	movq	216(%r14), %rax
+	movq	%r12, (%rdi,%rax,8)
+	movq	216(%r14), %rax
+	testq	%rax, %rax
+	jne	.L1984
+	testq	%r15, %r15
+	je	.L1974
+.L1877:
+	movq	224(%r14), %rdi
+	leaq	0(,%rcx,8), %rdx
+	movq	%r15, %rsi
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE50:
+	movq	216(%r14), %rax
+.L1974:
+	movq	(%rsp), %rcx
+	movq	(%rcx), %rdx
+	movl	64(%rdx), %esi
+	jmp	.L1878
+.L1984:
+	leaq	0(,%rax,8), %rdx
+	movq	%r15, %rsi
+	call	memcpy@PLT
+	movq	24(%rsp), %rcx
+	jmp	.L1877
+.L1934:
+	movq	%rax, %rbx
+	jmp	.L1904
+	.section	.gcc_except_table
+.LLSDA6930:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6930-.LLSDACSB6930
+.LLSDACSB6930:
+	.uleb128 .LEHB48-.LFB6930
+	.uleb128 .LEHE48-.LEHB48
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB49-.LFB6930
+	.uleb128 .LEHE49-.LEHB49
+	.uleb128 .L1934-.LFB6930
+	.uleb128 0
+	.uleb128 .LEHB50-.LFB6930
+	.uleb128 .LEHE50-.LEHB50
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6930:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6930
+	.type	_Z12read_patternRN1n11ring_readerEmm.cold, @function
+_Z12read_patternRN1n11ring_readerEmm.cold:
+.LFSB6930:
+.L1904:
+	.cfi_def_cfa_offset 192
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	112(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1905
+	movq	120(%rsp), %rsi
+	movq	%r15, %rdi
+	call	*16(%rax)
+.L1905:
+	movq	%rbx, %rdi
+.LEHB51:
+	call	_Unwind_Resume@PLT
+.LEHE51:
+	.cfi_endproc
+.LFE6930:
+	.section	.gcc_except_table
+.LLSDAC6930:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6930-.LLSDACSBC6930
+.LLSDACSBC6930:
+	.uleb128 .LEHB51-.LCOLDB16
+	.uleb128 .LEHE51-.LEHB51
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6930:
+	.section	.text.unlikely
+	.text
+	.size	_Z12read_patternRN1n11ring_readerEmm, .-_Z12read_patternRN1n11ring_readerEmm
+	.section	.text.unlikely
+	.size	_Z12read_patternRN1n11ring_readerEmm.cold, .-_Z12read_patternRN1n11ring_readerEmm.cold
+.LCOLDE16:
+	.text
+.LHOTE16:
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC17:
+	.string	"n::io_ring tests"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC18:
+	.string	"test_io_ring_read_write<n::io_backend::automatic>"
+	.align 8
+.LC19:
+	.string	"test_io_ring_read_write<n::io_backend::threads>"
+	.align 8
+.LC20:
+	.string	"test_ring_reader<n::io_backend::automatic>"
+	.align 8
+.LC21:
+	.string	"test_ring_reader<n::io_backend::threads>"
+	.align 8
+.LC22:
+	.string	"test_ring_readers_sharing<n::io_backend::automatic>"
+	.align 8
+.LC23:
+	.string	"test_ring_readers_sharing<n::io_backend::threads>"
+	.section	.text.unlikely
+.LCOLDB25:
+	.section	.text.startup,"ax",@progbits
+.LHOTB25:
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB6936:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6936
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$1600, %edi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 64
+.LEHB52:
+	call	_Znam@PLT
+.LEHE52:
+	movq	%rax, %rbx
+	leaq	1600(%rax), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L1986:
+	movq	$0, (%rax)
+	addq	$16, %rax
+	movq	$0, -8(%rax)
+	cmpq	%rax, %rdx
+	jne	.L1986
+	leaq	.LC17(%rip), %rax
+	movq	%rsp, %rdi
+	movq	%rbx, (%rsp)
+	movq	%rax, 16(%rsp)
+	leaq	.LC18(%rip), %rax
+	movq	%rax, (%rbx)
+	leaq	_Z23test_io_ring_read_writeILN1n10io_backendE0EEvv(%rip), %rax
+	movq	%rax, 8(%rbx)
+	leaq	.LC19(%rip), %rax
+	movq	%rax, 16(%rbx)
+	leaq	_Z23test_io_ring_read_writeILN1n10io_backendE2EEvv(%rip), %rax
+	movq	%rax, 24(%rbx)
+	leaq	.LC20(%rip), %rax
+	movq	%rax, 32(%rbx)
+	leaq	_Z16test_ring_readerILN1n10io_backendE0EEvv(%rip), %rax
+	movq	%rax, 40(%rbx)
+	leaq	.LC21(%rip), %rax
+	movq	%rax, 48(%rbx)
+	leaq	_Z16test_ring_readerILN1n10io_backendE2EEvv(%rip), %rax
+	movq	%rax, 56(%rbx)
+	leaq	.LC22(%rip), %rax
+	movq	%rax, 64(%rbx)
+	leaq	_Z25test_ring_readers_sharingILN1n10io_backendE0EEvv(%rip), %rax
+	movq	%rax, 72(%rbx)
+	leaq	.LC23(%rip), %rax
+	movq	%rax, 80(%rbx)
+	leaq	_Z25test_ring_readers_sharingILN1n10io_backendE2EEvv(%rip), %rax
+	movq	%rax, 88(%rbx)
+	movq	.LC24(%rip), %rax
+	movq	%rax, 8(%rsp)
+.LEHB53:
+	call	_ZN1n4test10test_suite7run_allEv
+.LEHE53:
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L1988:
+	.cfi_restore_state
+	movq	%rax, %rbp
+	jmp	.L1987
+	.section	.gcc_except_table
+.LLSDA6936:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6936-.LLSDACSB6936
+.LLSDACSB6936:
+	.uleb128 .LEHB52-.LFB6936
+	.uleb128 .LEHE52-.LEHB52
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB53-.LFB6936
+	.uleb128 .LEHE53-.LEHB53
+	.uleb128 .L1988-.LFB6936
+	.uleb128 0
+.LLSDACSE6936:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6936
+	.type	main.cold, @function
+main.cold:
+.LFSB6936:
+.L1987:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	movq	%rbp, %rdi
+.LEHB54:
+	call	_Unwind_Resume@PLT
+.LEHE54:
+	.cfi_endproc
+.LFE6936:
+	.section	.gcc_except_table
+.LLSDAC6936:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6936-.LLSDACSBC6936
+.LLSDACSBC6936:
+	.uleb128 .LEHB54-.LCOLDB25
+	.uleb128 .LEHE54-.LEHB54
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6936:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	main, .-main
+	.section	.text.unlikely
+	.size	main.cold, .-main.cold
+.LCOLDE25:
+	.section	.text.startup
+.LHOTE25:
+	.section	.text._ZN1n6vectorINS_7io_ring4__opEE6resizeEmRKS2_,"axG",@progbits,_ZN1n6vectorINS_7io_ring4__opEE6resizeEmRKS2_,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n6vectorINS_7io_ring4__opEE6resizeEmRKS2_
+	.type	_ZN1n6vectorINS_7io_ring4__opEE6resizeEmRKS2_, @function
+_ZN1n6vectorINS_7io_ring4__opEE6resizeEmRKS2_:
+.LFB7016:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$56, %rsp
+	.cfi_def_cfa_offset 112
+	movq	16(%rdi), %rcx
+	cmpq	%rcx, %rsi
+	jb	.L2001
+	movq	8(%rdi), %r14
+	movq	%rdx, %rbx
+	cmpq	%rsi, %r14
+	jnb	.L1996
+	movq	(%rdi), %r15
+	cmpq	%r15, %rdx
+	jb	.L1997
+	leaq	(%rcx,%rcx,2), %rax
+	salq	$4, %rax
+	addq	%r15, %rax
+	cmpq	%rax, %rdx
+	jnb	.L1997
+	movdqu	(%rdx), %xmm3
+	movdqu	16(%rdx), %xmm4
+	movdqu	32(%rdx), %xmm5
+	movq	%rsp, %rdx
+	movaps	%xmm3, (%rsp)
+	movaps	%xmm4, 16(%rsp)
+	movaps	%xmm5, 32(%rsp)
+	call	_ZN1n6vectorINS_7io_ring4__opEE6resizeEmRKS2_
+	jmp	.L1993
+	.p2align 4,,10
+	.p2align 3
+.L2008:
+	leaq	(%rcx,%rcx,2), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	salq	$4, %rdx
+	call	memcpy@PLT
+.L1999:
+	movq	24(%r12), %rdi
+	leaq	(%r14,%r14,2), %rdx
+	movl	$8, %ecx
+	movq	%r15, %rsi
+	salq	$4, %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	16(%r12), %rcx
+.L1996:
+	cmpq	%rbp, %rcx
+	jnb	.L2001
+	leaq	(%rbp,%rbp), %r13
+.L2000:
+	movq	(%r12), %rdx
+	leaq	(%rcx,%rcx,2), %rax
+	addq	%rbp, %r13
+	salq	$4, %rax
+	salq	$4, %r13
+	addq	%rdx, %rax
+	addq	%r13, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L2002:
+	movdqu	(%rbx), %xmm0
+	addq	$48, %rax
+	movups	%xmm0, -48(%rax)
+	movdqu	16(%rbx), %xmm1
+	movups	%xmm1, -32(%rax)
+	movdqu	32(%rbx), %xmm2
+	movups	%xmm2, -16(%rax)
+	cmpq	%rax, %rdx
+	jne	.L2002
+.L2001:
+	movq	%rbp, 16(%r12)
+.L1993:
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1997:
+	.cfi_restore_state
+	movq	24(%r12), %rdi
+	leaq	(%rbp,%rbp), %r13
+	movl	$8, %edx
+	leaq	0(%r13,%rbp), %rsi
+	movq	(%rdi), %rax
+	salq	$4, %rsi
+	call	*16(%rax)
+	movq	16(%r12), %rcx
+	movq	%rbp, 8(%r12)
+	movq	%rax, (%r12)
+	testq	%rcx, %rcx
+	jne	.L2008
+	testq	%r15, %r15
+	je	.L2000
+	jmp	.L1999
+	.cfi_endproc
+.LFE7016:
+	.size	_ZN1n6vectorINS_7io_ring4__opEE6resizeEmRKS2_, .-_ZN1n6vectorINS_7io_ring4__opEE6resizeEmRKS2_
+	.section	.text._ZN1n7io_ringC2EmmNS_10io_backendEPNS_11thread_poolE,"axG",@progbits,_ZN1n7io_ringC5EmmNS_10io_backendEPNS_11thread_poolE,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n7io_ringC2EmmNS_10io_backendEPNS_11thread_poolE
+	.type	_ZN1n7io_ringC2EmmNS_10io_backendEPNS_11thread_poolE, @function
+_ZN1n7io_ringC2EmmNS_10io_backendEPNS_11thread_poolE:
+.LFB6856:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6856
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$1, %eax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movl	%ecx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%r8, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$248, %rsp
+	.cfi_def_cfa_offset 304
+	testq	%rsi, %rsi
+	movq	$0, (%rdi)
+	cmove	%rax, %rsi
+	addq	$4095, %rdx
+	andq	$-4096, %rdx
+	movq	%rsi, 8(%rdi)
+	movq	%rdx, 16(%rdi)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2213
+.L2011:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movb	$0, 68(%rbx)
+	pxor	%xmm0, %xmm0
+	movq	$0, 24(%rbx)
+	movq	%rax, 48(%rbx)
+	movq	$0, 56(%rbx)
+	movl	$-1, 64(%rbx)
+	movq	$-1, 72(%rbx)
+	movq	$0, 80(%rbx)
+	movq	$-1, 88(%rbx)
+	movq	$0, 96(%rbx)
+	movq	$-1, 104(%rbx)
+	movq	$0, 112(%rbx)
+	movq	$0, 120(%rbx)
+	movl	$0, 128(%rbx)
+	movl	$0, 152(%rbx)
+	movq	$0, 160(%rbx)
+	movl	$0, 168(%rbx)
+	movq	$0, 176(%rbx)
+	movb	$0, 184(%rbx)
+	movq	$0, 192(%rbx)
+	movaps	%xmm0, 32(%rbx)
+	movups	%xmm0, 136(%rbx)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2214
+.L2014:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	pxor	%xmm0, %xmm0
+	movq	$0, 200(%rbx)
+	movaps	%xmm0, 208(%rbx)
+	movq	%rax, 224(%rbx)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rdi
+	testq	%rdi, %rdi
+	je	.L2215
+.L2016:
+	movq	8(%rbx), %rdx
+	movl	$2, %eax
+	movq	$0, 256(%rbx)
+	cmpq	%rax, %rdx
+	cmovb	%rax, %rdx
+	movl	$1, %eax
+	.p2align 4,,10
+	.p2align 3
+.L2020:
+	movq	%rax, %rsi
+	addq	%rax, %rax
+	cmpq	%rdx, %rax
+	jb	.L2020
+	subq	$1, %rax
+	salq	$5, %rsi
+	movq	%rdi, 272(%rbx)
+	movl	$8, %edx
+	movq	%rax, 264(%rbx)
+	movq	(%rdi), %rax
+	movq	$0, 320(%rbx)
+	movq	$0, 384(%rbx)
+	movb	$0, 448(%rbx)
+.LEHB55:
+	call	*16(%rax)
+.LEHE55:
+	movq	264(%rbx), %rsi
+	movq	%rax, 256(%rbx)
+	xorl	%edx, %edx
+	cmpq	$-1, %rsi
+	je	.L2024
+	.p2align 4,,10
+	.p2align 3
+.L2021:
+	movq	%rdx, %rcx
+	salq	$4, %rcx
+	movq	%rdx, (%rax,%rcx)
+	movq	%rdx, %rcx
+	addq	$1, %rdx
+	cmpq	%rsi, %rcx
+	jne	.L2021
+.L2024:
+	movq	8(%rbx), %rsi
+	imulq	16(%rbx), %rsi
+	xorl	%r9d, %r9d
+	xorl	%edi, %edi
+	movl	$-1, %r8d
+	movl	$34, %ecx
+	movl	$3, %edx
+	call	mmap@PLT
+	cmpq	$-1, %rax
+	je	.L2009
+	movq	8(%rbx), %r13
+	movq	40(%rbx), %rcx
+	pxor	%xmm0, %xmm0
+	movq	%rax, (%rbx)
+	movups	%xmm0, 36(%rsp)
+	movl	$-1, 16(%rsp)
+	movups	%xmm0, 20(%rsp)
+	movups	%xmm0, 48(%rsp)
+	cmpq	%rcx, %r13
+	jnb	.L2026
+.L2036:
+	movq	%r13, 40(%rbx)
+.L2027:
+	cmpl	$2, %r12d
+	jne	.L2042
+.L2068:
+	testq	%rbp, %rbp
+	je	.L2216
+.L2044:
+	movq	%rbp, 176(%rbx)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2217
+.L2103:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %edx
+	movl	$688, %esi
+	movq	(%rdi), %rax
+.LEHB56:
+	call	*16(%rax)
+	movq	176(%rbx), %rdx
+	movq	$0, 8(%rax)
+	movq	$0, 16(%rax)
+	movq	%rdx, (%rax)
+	leaq	16(%rax), %rdx
+	movq	$0, 24(%rax)
+	movq	%rdx, 672(%rax)
+	movq	%rax, 192(%rbx)
+.L2009:
+	addq	$248, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2026:
+	.cfi_restore_state
+	movq	32(%rbx), %r14
+	cmpq	%r13, %r14
+	jnb	.L2028
+	movq	24(%rbx), %r15
+	leaq	16(%rsp), %rdx
+	cmpq	%r15, %rdx
+	jnb	.L2218
+.L2029:
+	movq	48(%rbx), %rdi
+	leaq	(%r13,%r13), %rax
+	movl	$8, %edx
+	leaq	(%rax,%r13), %rsi
+	movq	%rax, (%rsp)
+	movq	(%rdi), %rax
+	salq	$4, %rsi
+	call	*16(%rax)
+	movq	40(%rbx), %rcx
+	movq	%rax, 24(%rbx)
+	movq	%r13, 32(%rbx)
+	testq	%rcx, %rcx
+	jne	.L2219
+	testq	%r15, %r15
+	je	.L2039
+.L2038:
+	movq	48(%rbx), %rdi
+	leaq	(%r14,%r14,2), %rdx
+	movl	$8, %ecx
+	movq	%r15, %rsi
+	salq	$4, %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	40(%rbx), %rcx
+.L2028:
+	cmpq	%r13, %rcx
+	jnb	.L2036
+	leaq	(%r13,%r13), %rax
+	movq	%rax, (%rsp)
+.L2039:
+	leaq	(%rcx,%rcx,2), %rax
+	movq	(%rsp), %rcx
+	movq	24(%rbx), %rdx
+	salq	$4, %rax
+	movdqa	16(%rsp), %xmm2
+	movdqa	32(%rsp), %xmm1
+	addq	%r13, %rcx
+	movdqa	48(%rsp), %xmm0
+	addq	%rdx, %rax
+	salq	$4, %rcx
+	addq	%rcx, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L2041:
+	movups	%xmm2, (%rax)
+	addq	$48, %rax
+	movups	%xmm1, -32(%rax)
+	movups	%xmm0, -16(%rax)
+	cmpq	%rax, %rdx
+	jne	.L2041
+	jmp	.L2036
+	.p2align 4,,10
+	.p2align 3
+.L2042:
+	leaq	112(%rsp), %rdx
+	xorl	%eax, %eax
+	movl	$15, %ecx
+	movl	8(%rbx), %esi
+	movq	%rdx, %rdi
+	rep stosq
+	movl	$425, %edi
+	call	syscall@PLT
+	movq	%rax, %r8
+	testq	%rax, %rax
+	js	.L2045
+	movl	112(%rsp), %edx
+	movl	%eax, 64(%rbx)
+	movl	176(%rsp), %eax
+	leaq	(%rax,%rdx,4), %rsi
+	movl	116(%rsp), %eax
+	movl	212(%rsp), %edx
+	movq	%rsi, 80(%rbx)
+	salq	$4, %rax
+	addq	%rdx, %rax
+	movq	%rax, 96(%rbx)
+	testb	$1, 132(%rsp)
+	jne	.L2220
+	xorl	%r9d, %r9d
+	movl	$32769, %ecx
+	movl	$3, %edx
+	xorl	%edi, %edi
+	call	mmap@PLT
+	movq	%rax, 72(%rbx)
+	cmpq	$-1, %rax
+	je	.L2047
+	movq	96(%rbx), %rsi
+	movl	64(%rbx), %r8d
+	movl	$134217728, %r9d
+	xorl	%edi, %edi
+	movl	$32769, %ecx
+	movl	$3, %edx
+	call	mmap@PLT
+.L2047:
+	movl	112(%rsp), %esi
+	movq	%rax, 88(%rbx)
+	xorl	%edi, %edi
+	movl	$268435456, %r9d
+	movl	64(%rbx), %r8d
+	movl	$32769, %ecx
+	movl	$3, %edx
+	salq	$6, %rsi
+	movq	%rsi, 112(%rbx)
+	call	mmap@PLT
+	movq	72(%rbx), %rdi
+	movq	%rax, 104(%rbx)
+	cmpq	$-1, %rdi
+	je	.L2048
+	movq	88(%rbx), %rdx
+	cmpq	$-1, %rdx
+	je	.L2221
+	cmpq	$-1, %rax
+	je	.L2222
+	movl	156(%rsp), %eax
+	movl	176(%rsp), %ecx
+	addq	%rdi, %rax
+	movq	%rax, 120(%rbx)
+	movl	160(%rsp), %eax
+	movl	(%rdi,%rax), %eax
+	movl	%eax, 128(%rbx)
+	movl	192(%rsp), %eax
+	addq	%rdx, %rax
+	movq	%rax, 136(%rbx)
+	movl	196(%rsp), %eax
+	addq	%rdx, %rax
+	movq	%rax, 144(%rbx)
+	movl	200(%rsp), %eax
+	movl	(%rdx,%rax), %eax
+	movl	%eax, 152(%rbx)
+	movl	212(%rsp), %eax
+	addq	%rdx, %rax
+	movl	112(%rsp), %edx
+	movq	%rax, 160(%rbx)
+	xorl	%eax, %eax
+	testl	%edx, %edx
+	je	.L2061
+	.p2align 4,,10
+	.p2align 3
+.L2058:
+	movl	%eax, %edx
+	leaq	(%rdi,%rdx,4), %rdx
+	movl	%eax, (%rdx,%rcx)
+	addl	$1, %eax
+	cmpl	112(%rsp), %eax
+	jb	.L2058
+.L2061:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2223
+.L2062:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	8(%rbx), %rsi
+	movl	$8, %edx
+	movq	(%rdi), %rax
+	salq	$4, %rsi
+	call	*16(%rax)
+	movq	8(%rbx), %r8
+	movq	%rax, %rbp
+	testq	%r8, %r8
+	je	.L2111
+	movq	%r8, %rsi
+	movq	16(%rbx), %rcx
+	movq	(%rbx), %rdx
+	salq	$4, %rsi
+	addq	%rax, %rsi
+	.p2align 4,,10
+	.p2align 3
+.L2064:
+	movq	%rdx, (%rax)
+	addq	$16, %rax
+	addq	%rcx, %rdx
+	movq	%rcx, -8(%rax)
+	cmpq	%rsi, %rax
+	jne	.L2064
+.L2063:
+	movl	64(%rbx), %esi
+	xorl	%edx, %edx
+	xorl	%eax, %eax
+	movq	%rbp, %rcx
+	movl	$427, %edi
+	call	syscall@PLT
+	testq	%rax, %rax
+	sete	68(%rbx)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2224
+.L2066:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	8(%rbx), %rdx
+	movl	$8, %ecx
+	movq	%rbp, %rsi
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+	call	*24(%rax)
+	jmp	.L2009
+	.p2align 4,,10
+	.p2align 3
+.L2214:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2014
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r13, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2014
+	.p2align 4,,10
+	.p2align 3
+.L2213:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2011
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r13, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2011
+.L2221:
+	cmpq	$-1, %rax
+	je	.L2051
+.L2050:
+	movq	112(%rbx), %rsi
+	movq	%rax, %rdi
+	call	munmap@PLT
+	movq	88(%rbx), %rdx
+	movq	72(%rbx), %rdi
+	cmpq	$-1, %rdx
+	je	.L2056
+	cmpq	%rdi, %rdx
+	je	.L2051
+.L2054:
+	movq	96(%rbx), %rsi
+	movq	%rdx, %rdi
+	call	munmap@PLT
+	movq	72(%rbx), %rdi
+.L2056:
+	cmpq	$-1, %rdi
+	jne	.L2051
+.L2055:
+	movl	64(%rbx), %edi
+	testl	%edi, %edi
+	jns	.L2225
+.L2057:
+	movl	$-1, 64(%rbx)
+	movq	$-1, 88(%rbx)
+	movq	$-1, 72(%rbx)
+	movq	$-1, 104(%rbx)
+.L2045:
+	cmpl	$1, %r12d
+	je	.L2009
+	jmp	.L2068
+	.p2align 4,,10
+	.p2align 3
+.L2220:
+	cmpq	%rax, %rsi
+	movl	$32769, %ecx
+	movl	$3, %edx
+	cmovb	%rax, %rsi
+	xorl	%r9d, %r9d
+	xorl	%edi, %edi
+	movq	%rsi, 96(%rbx)
+	movq	%rsi, 80(%rbx)
+	call	mmap@PLT
+	movq	%rax, 72(%rbx)
+	jmp	.L2047
+	.p2align 4,,10
+	.p2align 3
+.L2218:
+	leaq	(%rcx,%rcx,2), %rax
+	salq	$4, %rax
+	addq	%r15, %rax
+	cmpq	%rax, %rdx
+	jnb	.L2029
+	movdqa	16(%rsp), %xmm2
+	movdqa	32(%rsp), %xmm1
+	leaq	64(%rsp), %rdx
+	movdqa	48(%rsp), %xmm0
+	movaps	%xmm2, 64(%rsp)
+	movaps	%xmm1, 80(%rsp)
+	movaps	%xmm0, 96(%rsp)
+	cmpq	%rax, %rdx
+	jnb	.L2030
+	cmpq	%r15, %rdx
+	jnb	.L2226
+.L2030:
+	movq	48(%rbx), %rdi
+	leaq	0(%r13,%r13,2), %rax
+	movl	$8, %edx
+	salq	$4, %rax
+	movq	%rax, (%rsp)
+	movq	%rax, %rsi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, 24(%rbx)
+	movq	%rax, %rdi
+	movq	40(%rbx), %rax
+	movq	%r13, 32(%rbx)
+	testq	%rax, %rax
+	jne	.L2227
+	testq	%r15, %r15
+	jne	.L2033
+.L2034:
+	movq	24(%rbx), %rdx
+	movq	(%rsp), %rdi
+	leaq	(%rax,%rax,2), %rax
+	salq	$4, %rax
+	movdqa	64(%rsp), %xmm2
+	movdqa	80(%rsp), %xmm1
+	movdqa	96(%rsp), %xmm0
+	addq	%rdx, %rax
+	addq	%rdi, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L2035:
+	movups	%xmm2, (%rax)
+	addq	$48, %rax
+	movups	%xmm1, -32(%rax)
+	movups	%xmm0, -16(%rax)
+	cmpq	%rdx, %rax
+	jne	.L2035
+	jmp	.L2036
+	.p2align 4,,10
+	.p2align 3
+.L2215:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2228
+.L2018:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	jmp	.L2016
+	.p2align 4,,10
+	.p2align 3
+.L2217:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2103
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2103
+	.p2align 4,,10
+	.p2align 3
+.L2216:
+	movl	$84, %edi
+	call	sysconf@PLT
+	movl	$1, %edx
+	testq	%rax, %rax
+	cmovg	%rax, %rdx
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	movq	%rdx, %r12
+	testb	%al, %al
+	je	.L2229
+.L2070:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$8, %edx
+	movl	$232, %esi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+.LEHE56:
+	movq	%rax, %rbp
+	movq	8(%rbx), %rax
+	cmpq	%rax, %r12
+	cmovbe	%r12, %rax
+	movq	%rax, (%rsp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2230
+.L2073:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	pxor	%xmm0, %xmm0
+	movq	$0, 0(%rbp)
+	movups	%xmm0, 8(%rbp)
+	pxor	%xmm0, %xmm0
+	movq	%rax, 24(%rbp)
+	movq	$0, 64(%rbp)
+	movups	%xmm0, 32(%rbp)
+	movups	%xmm0, 48(%rbp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2231
+.L2076:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	8(%rbp), %r12
+	pxor	%xmm0, %xmm0
+	pxor	%xmm1, %xmm1
+	movq	$0, 72(%rbp)
+	movq	%rax, 96(%rbp)
+	movq	(%rsp), %rax
+	movq	$0, 152(%rbp)
+	movb	$0, 224(%rbp)
+	movups	%xmm1, 80(%rbp)
+	movups	%xmm1, 104(%rbp)
+	movups	%xmm0, 120(%rbp)
+	movups	%xmm0, 136(%rbp)
+	movups	%xmm0, 160(%rbp)
+	movups	%xmm0, 176(%rbp)
+	movups	%xmm0, 192(%rbp)
+	movups	%xmm1, 208(%rbp)
+	cmpq	%rax, %r12
+	jb	.L2232
+	cmpq	$0, (%rsp)
+	je	.L2082
+.L2081:
+	movabsq	$-7046029254386353131, %r14
+	xorl	%r13d, %r13d
+	jmp	.L2096
+	.p2align 4,,10
+	.p2align 3
+.L2084:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$64, %edx
+	movl	$192, %esi
+	movq	(%rdi), %rax
+.LEHB57:
+	call	*16(%rax)
+	movq	%rax, %rdi
+	movq	%rax, %r12
+	movl	$24, %ecx
+	xorl	%eax, %eax
+	rep stosq
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2233
+.L2087:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$8, %edx
+	movl	$528, %esi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	leaq	16(%rax), %rdx
+	movq	$64, (%rax)
+	movq	%rdx, 8(%rax)
+	movq	%rax, 136(%r12)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2234
+.L2090:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	pxor	%xmm3, %xmm3
+	movq	%r13, 8(%r12)
+	addq	$1, %r13
+	movups	%xmm3, 152(%r12)
+	movq	16(%rbp), %rdx
+	movq	8(%rbp), %r15
+	movq	%rax, 168(%r12)
+	movq	0(%rbp), %rax
+	movq	$0, 144(%r12)
+	movq	%rbp, (%r12)
+	movq	%r14, 16(%r12)
+	movq	%rax, 8(%rsp)
+	cmpq	%r15, %rdx
+	je	.L2235
+	movq	%r12, (%rax,%rdx,8)
+.L2095:
+	movabsq	$-7046029254386353131, %rax
+	addq	$1, %rdx
+	movq	%rdx, 16(%rbp)
+	addq	%rax, %r14
+	cmpq	%r13, (%rsp)
+	je	.L2236
+.L2096:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L2084
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2084
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2084
+	.p2align 4,,10
+	.p2align 3
+.L2234:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2090
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2090
+	.p2align 4,,10
+	.p2align 3
+.L2233:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2087
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2087
+	.p2align 4,,10
+	.p2align 3
+.L2235:
+	leaq	5(%r15), %rsi
+	movq	24(%rbp), %rdi
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 8(%rbp)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	16(%rbp), %rdx
+	movq	%rax, %rdi
+	movq	%rax, 0(%rbp)
+	movq	%r12, (%rdi,%rdx,8)
+	leaq	0(,%rdx,8), %rax
+	testq	%rdx, %rdx
+	jne	.L2237
+	cmpq	$0, 8(%rsp)
+	je	.L2095
+.L2094:
+	movq	24(%rbp), %rdi
+	movq	8(%rsp), %rsi
+	movl	$8, %ecx
+	leaq	0(,%r15,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	16(%rbp), %rdx
+	jmp	.L2095
+	.p2align 4,,10
+	.p2align 3
+.L2236:
+	xorl	%r12d, %r12d
+	leaq	_ZN1n11thread_pool6__loopEPv(%rip), %r13
+	.p2align 4,,10
+	.p2align 3
+.L2097:
+	movq	0(%rbp), %rax
+	movq	%r13, %rdx
+	xorl	%esi, %esi
+	movq	(%rax,%r12,8), %rcx
+	addq	$1, %r12
+	leaq	24(%rcx), %rdi
+	call	pthread_create@PLT
+	cmpq	%r12, (%rsp)
+	jne	.L2097
+.L2082:
+	movb	$1, 184(%rbx)
+	jmp	.L2044
+.L2237:
+	movq	8(%rsp), %rsi
+	movq	%rax, %rdx
+	call	memcpy@PLT
+	jmp	.L2094
+.L2228:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2018
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r13, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2018
+.L2223:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2062
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2062
+.L2224:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2066
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2066
+.L2232:
+	movq	24(%rbp), %rdi
+	movq	%rax, %r14
+	movq	0(%rbp), %r13
+	movl	$8, %edx
+	leaq	0(,%rax,8), %rsi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, 0(%rbp)
+	movq	%rax, %rdi
+	movq	16(%rbp), %rax
+	movq	%r14, 8(%rbp)
+	testq	%rax, %rax
+	jne	.L2238
+	testq	%r13, %r13
+	je	.L2081
+.L2080:
+	movq	24(%rbp), %rdi
+	leaq	0(,%r12,8), %rdx
+	movl	$8, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE57:
+	jmp	.L2081
+.L2231:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2076
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2076
+.L2230:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2073
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2073
+.L2229:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2070
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2070
+.L2222:
+	cmpq	%rdx, %rdi
+	jne	.L2054
+.L2051:
+	movq	80(%rbx), %rsi
+	call	munmap@PLT
+	jmp	.L2055
+.L2225:
+.LEHB58:
+	call	close@PLT
+	jmp	.L2057
+.L2219:
+	leaq	(%rcx,%rcx,2), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	salq	$4, %rdx
+	call	memcpy@PLT
+	jmp	.L2038
+.L2048:
+	cmpq	$-1, %rax
+	jne	.L2050
+	movq	88(%rbx), %rdx
+	cmpq	$-1, %rdx
+	jne	.L2054
+	jmp	.L2055
+.L2111:
+	xorl	%r8d, %r8d
+	jmp	.L2063
+.L2238:
+	leaq	0(,%rax,8), %rdx
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L2080
+.L2227:
+	leaq	(%rax,%rax,2), %rdx
+	movq	%r15, %rsi
+	salq	$4, %rdx
+	call	memcpy@PLT
+.L2033:
+	movq	48(%rbx), %rdi
+	leaq	(%r14,%r14,2), %rdx
+	movl	$8, %ecx
+	movq	%r15, %rsi
+	salq	$4, %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	40(%rbx), %rax
+	cmpq	%r13, %rax
+	jb	.L2034
+	jmp	.L2036
+.L2226:
+	leaq	112(%rsp), %rdx
+	leaq	24(%rbx), %rdi
+	movq	%r13, %rsi
+	movaps	%xmm2, 112(%rsp)
+	movaps	%xmm1, 128(%rsp)
+	movaps	%xmm0, 144(%rsp)
+	call	_ZN1n6vectorINS_7io_ring4__opEE6resizeEmRKS2_
+.LEHE58:
+	jmp	.L2027
+.L2114:
+	movq	%rax, %r12
+	jmp	.L2098
+.L2112:
+	movq	%rax, %rbp
+	jmp	.L2105
+.L2113:
+	movq	%rax, %rbp
+	jmp	.L2101
+.L2098:
+	movq	72(%rbp), %rsi
+	movq	80(%rbp), %rdx
+	testq	%rsi, %rsi
+	je	.L2099
+	movq	96(%rbp), %rdi
+	salq	$3, %rdx
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2099:
+	movq	0(%rbp), %rsi
+	movq	8(%rbp), %rdx
+	testq	%rsi, %rsi
+	je	.L2100
+	movq	24(%rbp), %rdi
+	salq	$3, %rdx
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2100:
+	movq	%r12, %rbp
+.L2101:
+	movq	264(%rbx), %rax
+	movq	272(%rbx), %rdi
+	movl	$8, %ecx
+	movq	256(%rbx), %rsi
+	leaq	1(%rax), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+	call	*24(%rax)
+.L2105:
+	movq	200(%rbx), %rsi
+	movq	208(%rbx), %rdx
+	testq	%rsi, %rsi
+	je	.L2106
+	movq	224(%rbx), %rdi
+	salq	$3, %rdx
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2106:
+	movq	24(%rbx), %rsi
+	movq	32(%rbx), %rdx
+	testq	%rsi, %rsi
+	je	.L2107
+	movq	48(%rbx), %rdi
+	imulq	$48, %rdx, %rdx
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2107:
+	movq	%rbp, %rdi
+.LEHB59:
+	call	_Unwind_Resume@PLT
+.LEHE59:
+	.cfi_endproc
+.LFE6856:
+	.section	.gcc_except_table
+.LLSDA6856:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6856-.LLSDACSB6856
+.LLSDACSB6856:
+	.uleb128 .LEHB55-.LFB6856
+	.uleb128 .LEHE55-.LEHB55
+	.uleb128 .L2112-.LFB6856
+	.uleb128 0
+	.uleb128 .LEHB56-.LFB6856
+	.uleb128 .LEHE56-.LEHB56
+	.uleb128 .L2113-.LFB6856
+	.uleb128 0
+	.uleb128 .LEHB57-.LFB6856
+	.uleb128 .LEHE57-.LEHB57
+	.uleb128 .L2114-.LFB6856
+	.uleb128 0
+	.uleb128 .LEHB58-.LFB6856
+	.uleb128 .LEHE58-.LEHB58
+	.uleb128 .L2113-.LFB6856
+	.uleb128 0
+	.uleb128 .LEHB59-.LFB6856
+	.uleb128 .LEHE59-.LEHB59
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6856:
+	.section	.text._ZN1n7io_ringC2EmmNS_10io_backendEPNS_11thread_poolE,"axG",@progbits,_ZN1n7io_ringC5EmmNS_10io_backendEPNS_11thread_poolE,comdat
+	.size	_ZN1n7io_ringC2EmmNS_10io_backendEPNS_11thread_poolE, .-_ZN1n7io_ringC2EmmNS_10io_backendEPNS_11thread_poolE
+	.weak	_ZN1n7io_ringC1EmmNS_10io_backendEPNS_11thread_poolE
+	.set	_ZN1n7io_ringC1EmmNS_10io_backendEPNS_11thread_poolE,_ZN1n7io_ringC2EmmNS_10io_backendEPNS_11thread_poolE
+	.section	.rodata._Z25test_ring_readers_sharingILN1n10io_backendE2EEvv.str1.8,"aMS",@progbits,1
+	.align 8
+.LC26:
+	.string	"expected true : read_pattern(r1, 123457, 5)"
+	.align 8
+.LC27:
+	.string	"expected true : read_pattern(r0, 300000, 3)"
+	.align 8
+.LC28:
+	.string	"expected false : n::ring_reader(small, fd2).iter().has_next()"
+	.align 8
+.LC29:
+	.string	"expected true : n::ring_reader(small, fd0).iter().has_next()"
+	.section	.text._Z25test_ring_readers_sharingILN1n10io_backendE2EEvv,"axG",@progbits,_Z25test_ring_readers_sharingILN1n10io_backendE2EEvv,comdat
+	.p2align 4
+	.weak	_Z25test_ring_readers_sharingILN1n10io_backendE2EEvv
+	.type	_Z25test_ring_readers_sharingILN1n10io_backendE2EEvv, @function
+_Z25test_ring_readers_sharingILN1n10io_backendE2EEvv:
+.LFB7032:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7032
+	leaq	8(%rsp), %r10
+	.cfi_def_cfa 10, 0
+	andq	$-64, %rsp
+	movl	$438, %edx
+	movl	$577, %esi
+	pushq	-8(%r10)
+	xorl	%eax, %eax
+	pushq	%rbp
+	movq	%rsp, %rbp
+	.cfi_escape 0x10,0x6,0x2,0x76,0
+	pushq	%r15
+	pushq	%r14
+	.cfi_escape 0x10,0xf,0x2,0x76,0x78
+	.cfi_escape 0x10,0xe,0x2,0x76,0x70
+	xorl	%r14d, %r14d
+	pushq	%r13
+	.cfi_escape 0x10,0xd,0x2,0x76,0x68
+	xorl	%r13d, %r13d
+	pushq	%r12
+	.cfi_escape 0x10,0xc,0x2,0x76,0x60
+	movabsq	$2351776136887273513, %r12
+	pushq	%r10
+	.cfi_escape 0xf,0x3,0x76,0x58,0x6
+	pushq	%rbx
+	.cfi_escape 0x10,0x3,0x2,0x76,0x50
+	leaq	-4144(%rbp), %rbx
+	subq	$4864, %rsp
+	movq	path(%rip), %rdi
+.LEHB60:
+	call	open@PLT
+	movl	$4096, %r8d
+	movl	%eax, %r15d
+	.p2align 4,,10
+	.p2align 3
+.L2242:
+	leaq	(%r14,%r13), %rcx
+	addq	%r8, %r13
+	movq	%rbx, %rsi
+	leaq	(%r13,%r13), %r14
+	leaq	(%r14,%r13), %rdi
+	.p2align 4,,10
+	.p2align 3
+.L2240:
+	movq	%rcx, %rax
+	addq	$1, %rsi
+	imulq	%r12
+	movq	%rcx, %rax
+	sarq	$63, %rax
+	sarq	$5, %rdx
+	subq	%rax, %rdx
+	movq	%rcx, %rax
+	addq	$3, %rcx
+	imulq	$251, %rdx, %rdx
+	subq	%rdx, %rax
+	movb	%al, -1(%rsi)
+	cmpq	%rcx, %rdi
+	jne	.L2240
+	movq	%r8, %rdx
+	movq	%rbx, %rsi
+	movl	%r15d, %edi
+	call	write@PLT
+	cmpq	$299999, %r13
+	ja	.L2241
+	movl	$300000, %r8d
+	movl	$4096, %eax
+	subq	%r13, %r8
+	cmpq	%rax, %r8
+	cmova	%rax, %r8
+	jmp	.L2242
+.L2241:
+	movl	%r15d, %edi
+	xorl	%r13d, %r13d
+	xorl	%r14d, %r14d
+	movabsq	$2351776136887273513, %r12
+	call	close@PLT
+	movq	other(%rip), %rdi
+	movl	$438, %edx
+	xorl	%eax, %eax
+	movl	$577, %esi
+	call	open@PLT
+	movl	$4096, %r8d
+	movl	%eax, %r15d
+	.p2align 4,,10
+	.p2align 3
+.L2245:
+	leaq	(%r14,%r13), %rcx
+	addq	%r8, %r13
+	movq	%rbx, %rsi
+	leaq	0(,%r13,4), %r14
+	leaq	(%r14,%r13), %rdi
+	.p2align 4,,10
+	.p2align 3
+.L2243:
+	movq	%rcx, %rax
+	addq	$1, %rsi
+	imulq	%r12
+	movq	%rcx, %rax
+	sarq	$63, %rax
+	sarq	$5, %rdx
+	subq	%rax, %rdx
+	movq	%rcx, %rax
+	addq	$5, %rcx
+	imulq	$251, %rdx, %rdx
+	subq	%rdx, %rax
+	movb	%al, -1(%rsi)
+	cmpq	%rcx, %rdi
+	jne	.L2243
+	movq	%r8, %rdx
+	movq	%rbx, %rsi
+	movl	%r15d, %edi
+	call	write@PLT
+	cmpq	$123456, %r13
+	ja	.L2244
+	movl	$123457, %r8d
+	movl	$4096, %eax
+	subq	%r13, %r8
+	cmpq	%rax, %r8
+	cmova	%rax, %r8
+	jmp	.L2245
+.L2244:
+	movl	%r15d, %edi
+	leaq	-4656(%rbp), %r15
+	call	close@PLT
+	movl	$8, %esi
+	movq	%r15, %rdi
+	xorl	%r8d, %r8d
+	movl	$2, %ecx
+	movl	$4096, %edx
+	movq	%r15, -4848(%rbp)
+	call	_ZN1n7io_ringC1EmmNS_10io_backendEPNS_11thread_poolE
+.LEHE60:
+	movq	path(%rip), %rdi
+	xorl	%esi, %esi
+	xorl	%eax, %eax
+.LEHB61:
+	call	open@PLT
+	movq	other(%rip), %rdi
+	movl	%eax, -4836(%rbp)
+	movl	%eax, %r13d
+	xorl	%esi, %esi
+	xorl	%eax, %eax
+	call	open@PLT
+	leaq	-4752(%rbp), %r12
+	xorl	%ecx, %ecx
+	movl	%r13d, %edx
+	movq	%r15, %rsi
+	movl	$4, %r8d
+	movq	%r12, %rdi
+	movl	%eax, -4840(%rbp)
+	movl	%eax, %r14d
+	call	_ZN1n11ring_readerC1ERNS_7io_ringEimm
+.LEHE61:
+	movl	$4, %r8d
+	movl	%r14d, %edx
+	movq	%r15, %rsi
+	movq	%rbx, %rdi
+	movl	$4, %ecx
+.LEHB62:
+	call	_ZN1n11ring_readerC1ERNS_7io_ringEimm
+.LEHE62:
+	movq	%rbx, %rdi
+.LEHB63:
+	call	_Z12read_patternRN1n11ring_readerEmm.constprop.1
+	testb	%al, %al
+	je	.L2388
+	movq	%r12, %rdi
+	call	_Z12read_patternRN1n11ring_readerEmm.constprop.0
+.LEHE63:
+	testb	%al, %al
+	je	.L2389
+	movq	%rbx, %rdi
+	call	_ZN1n11ring_readerD1Ev
+	movq	%r12, %rdi
+	call	_ZN1n11ring_readerD1Ev
+	xorl	%r8d, %r8d
+	movl	$2, %ecx
+	movq	%rbx, %rdi
+	movl	$4096, %edx
+	movl	$2, %esi
+.LEHB64:
+	call	_ZN1n7io_ringC1EmmNS_10io_backendEPNS_11thread_poolE
+.LEHE64:
+	movq	other(%rip), %rdi
+	movl	$514, %esi
+	xorl	%eax, %eax
+.LEHB65:
+	call	open@PLT
+	movq	$-1, %r8
+	xorl	%ecx, %ecx
+	movl	%eax, %edx
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	movl	%eax, -4852(%rbp)
+	call	_ZN1n11ring_readerC1ERNS_7io_ringEimm
+	movq	-4672(%rbp), %rax
+	cmpq	%rax, -4680(%rbp)
+	jb	.L2248
+	cmpb	$0, -4664(%rbp)
+	jne	.L2390
+.L2256:
+	movq	-4696(%rbp), %r15
+	cmpq	-4704(%rbp), %r15
+	je	.L2273
+	cmpb	$0, -4663(%rbp)
+	je	.L2391
+.L2273:
+	movq	%r12, %rdi
+	call	_ZN1n11ring_readerD1Ev
+.L2279:
+	movl	-4836(%rbp), %edx
+	xorl	%ecx, %ecx
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	movq	$-1, %r8
+	call	_ZN1n11ring_readerC1ERNS_7io_ringEimm
+.LEHE65:
+	movq	-4672(%rbp), %rax
+	cmpq	%rax, -4680(%rbp)
+	jb	.L2386
+	cmpb	$0, -4664(%rbp)
+	jne	.L2392
+.L2290:
+	movq	-4696(%rbp), %r15
+	cmpq	-4704(%rbp), %r15
+	je	.L2385
+	cmpb	$0, -4663(%rbp)
+	jne	.L2385
+	movq	%r15, %rax
+	xorl	%edx, %edx
+	movq	-4752(%rbp), %r13
+	divq	-4728(%rbp)
+	addq	-4736(%rbp), %rdx
+	leaq	(%rdx,%rdx,2), %r14
+	movq	%rdx, -4864(%rbp)
+	salq	$4, %r14
+	jmp	.L2310
+	.p2align 4,,10
+	.p2align 3
+.L2312:
+	movl	$1, %esi
+	movq	%r13, %rdi
+.LEHB66:
+	call	_ZN1n7io_ring4waitEPmmm.constprop.0
+.LEHE66:
+	testq	%rax, %rax
+	je	.L2311
+.L2310:
+	movq	24(%r13), %rax
+	addq	%r14, %rax
+	cmpl	$1, 8(%rax)
+	je	.L2312
+	movq	40(%rax), %rdx
+	addq	$1, %r15
+	movq	%r15, -4696(%rbp)
+	testq	%rdx, %rdx
+	jle	.L2393
+	movq	16(%r13), %rax
+	movq	-4864(%rbp), %rdi
+	movq	$0, -4680(%rbp)
+	movq	%rdx, -4672(%rbp)
+	cmpq	%rax, %rdx
+	movb	$1, -4664(%rbp)
+	setb	-4663(%rbp)
+	imulq	%rax, %rdi
+	movq	0(%r13), %rax
+	addq	%rdi, %rax
+	movq	%rax, -4688(%rbp)
+.L2386:
+	movq	%r12, %rdi
+	call	_ZN1n11ring_readerD1Ev
+	movl	-4836(%rbp), %edi
+.LEHB67:
+	call	close@PLT
+	movl	-4840(%rbp), %edi
+	call	close@PLT
+	movl	-4852(%rbp), %edi
+	call	close@PLT
+.LEHE67:
+	movq	path(%rip), %rdi
+	call	remove@PLT
+	movq	other(%rip), %rdi
+	call	remove@PLT
+	movq	%rbx, %rdi
+	call	_ZN1n7io_ringD1Ev
+	movq	-4848(%rbp), %rdi
+	call	_ZN1n7io_ringD1Ev
+	leaq	-48(%rbp), %rsp
+	popq	%rbx
+	popq	%r10
+	.cfi_remember_state
+	.cfi_def_cfa 10, 0
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	leaq	-8(%r10), %rsp
+	.cfi_def_cfa 7, 8
+	ret
+.L2391:
+	.cfi_restore_state
+	movq	%r15, %rax
+	xorl	%edx, %edx
+	movq	-4752(%rbp), %r13
+	divq	-4728(%rbp)
+	addq	-4736(%rbp), %rdx
+	leaq	(%rdx,%rdx,2), %r14
+	movq	%rdx, -4864(%rbp)
+	salq	$4, %r14
+	jmp	.L2274
+	.p2align 4,,10
+	.p2align 3
+.L2276:
+	movl	$1, %esi
+	movq	%r13, %rdi
+.LEHB68:
+	call	_ZN1n7io_ring4waitEPmmm.constprop.0
+	testq	%rax, %rax
+	je	.L2275
+.L2274:
+	movq	24(%r13), %rax
+	addq	%r14, %rax
+	cmpl	$1, 8(%rax)
+	je	.L2276
+	movq	40(%rax), %rdx
+	addq	$1, %r15
+	movq	%r15, -4696(%rbp)
+	testq	%rdx, %rdx
+	jle	.L2394
+	movq	16(%r13), %rax
+	movq	-4864(%rbp), %rdi
+	movq	$0, -4680(%rbp)
+	movq	%rdx, -4672(%rbp)
+	cmpq	%rax, %rdx
+	movb	$1, -4664(%rbp)
+	setb	-4663(%rbp)
+	imulq	%rax, %rdi
+	movq	0(%r13), %rax
+	addq	%rdi, %rax
+	movq	%r12, %rdi
+	movq	%rax, -4688(%rbp)
+	call	_ZN1n11ring_readerD1Ev
+	jmp	.L2280
+.L2390:
+	cmpb	$0, -4663(%rbp)
+	movb	$0, -4664(%rbp)
+	movq	-4752(%rbp), %r13
+	jne	.L2251
+	movq	-4720(%rbp), %rax
+	movq	-4712(%rbp), %r14
+	testq	%rax, %rax
+	js	.L2252
+	cmpq	%r14, %rax
+	jle	.L2251
+.L2252:
+	movq	-4704(%rbp), %r15
+	xorl	%edx, %edx
+	movq	16(%r13), %rcx
+	xorl	%r9d, %r9d
+	movl	-4744(%rbp), %esi
+	movq	%r14, %r8
+	movq	%r13, %rdi
+	movq	%r15, %rax
+	divq	-4728(%rbp)
+	addq	-4736(%rbp), %rdx
+	call	_ZN1n7io_ring7__queueEimmlb
+	testb	%al, %al
+	je	.L2251
+	addq	16(%r13), %r14
+	addq	$1, %r15
+	movq	%r14, -4712(%rbp)
+	movq	%r15, -4704(%rbp)
+.L2251:
+	movl	64(%r13), %esi
+	testl	%esi, %esi
+	jns	.L2395
+	movq	216(%r13), %rax
+	testq	%rax, %rax
+	je	.L2256
+	cmpq	56(%r13), %rax
+	je	.L2396
+.L2258:
+	movq	%r13, %rdi
+	call	_ZN1n7io_ring6submitEv.part.0
+.LEHE68:
+	jmp	.L2256
+.L2393:
+	jne	.L2321
+	xorl	%edx, %edx
+.L2314:
+	movl	%edx, -4660(%rbp)
+	movb	$1, -4663(%rbp)
+.L2385:
+	movq	%r12, %rdi
+	call	_ZN1n11ring_readerD1Ev
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC29(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB69:
+	call	__cxa_throw@PLT
+.L2248:
+	movq	%r12, %rdi
+	call	_ZN1n11ring_readerD1Ev
+.L2280:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC28(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE69:
+	.p2align 4,,10
+	.p2align 3
+.L2392:
+	cmpb	$0, -4663(%rbp)
+	movb	$0, -4664(%rbp)
+	movq	-4752(%rbp), %r13
+	jne	.L2285
+	movq	-4720(%rbp), %rax
+	movq	-4712(%rbp), %r14
+	testq	%rax, %rax
+	js	.L2286
+	cmpq	%r14, %rax
+	jle	.L2285
+.L2286:
+	movq	-4704(%rbp), %r15
+	xorl	%edx, %edx
+	movq	16(%r13), %rcx
+	xorl	%r9d, %r9d
+	movl	-4744(%rbp), %esi
+	movq	%r14, %r8
+	movq	%r13, %rdi
+	movq	%r15, %rax
+	divq	-4728(%rbp)
+	addq	-4736(%rbp), %rdx
+.LEHB70:
+	call	_ZN1n7io_ring7__queueEimmlb
+	testb	%al, %al
+	je	.L2285
+	addq	16(%r13), %r14
+	addq	$1, %r15
+	movq	%r14, -4712(%rbp)
+	movq	%r15, -4704(%rbp)
+.L2285:
+	movl	64(%r13), %esi
+	testl	%esi, %esi
+	jns	.L2397
+	movq	216(%r13), %rax
+	testq	%rax, %rax
+	je	.L2290
+	cmpq	56(%r13), %rax
+	je	.L2398
+.L2292:
+	movq	%r13, %rdi
+	call	_ZN1n7io_ring6submitEv.part.0
+.LEHE70:
+	jmp	.L2290
+.L2395:
+	movl	168(%r13), %edx
+	testl	%edx, %edx
+	jne	.L2257
+	jmp	.L2256
+	.p2align 4,,10
+	.p2align 3
+.L2255:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2256
+	movl	168(%r13), %edx
+	movl	64(%r13), %esi
+.L2257:
+	subq	$8, %rsp
+	movl	$426, %edi
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	pushq	$0
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%rsi
+	popq	%rdi
+	testq	%rax, %rax
+	js	.L2255
+	subl	%eax, 168(%r13)
+	jmp	.L2256
+.L2397:
+	movl	168(%r13), %edx
+	testl	%edx, %edx
+	jne	.L2291
+	jmp	.L2290
+	.p2align 4,,10
+	.p2align 3
+.L2289:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2290
+	movl	168(%r13), %edx
+	movl	64(%r13), %esi
+.L2291:
+	subq	$8, %rsp
+	xorl	%ecx, %ecx
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	pushq	$0
+	movl	$426, %edi
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%rdx
+	popq	%rcx
+	testq	%rax, %rax
+	js	.L2289
+	subl	%eax, 168(%r13)
+	jmp	.L2290
+.L2394:
+	jne	.L2322
+	xorl	%edx, %edx
+.L2278:
+	movl	%edx, -4660(%rbp)
+	movq	%r12, %rdi
+	movb	$1, -4663(%rbp)
+	call	_ZN1n11ring_readerD1Ev
+	jmp	.L2279
+.L2275:
+	addq	$1, %r15
+	movq	$-5, %rdx
+	movq	%r15, -4696(%rbp)
+.L2322:
+	negl	%edx
+	jmp	.L2278
+.L2311:
+	addq	$1, %r15
+	movq	$-5, %rdx
+	movq	%r15, -4696(%rbp)
+.L2321:
+	negl	%edx
+	jmp	.L2314
+.L2396:
+	movq	192(%r13), %rax
+	movq	%rax, -4864(%rbp)
+	addq	$8, %rax
+	movq	%rax, -4872(%rbp)
+	leaq	-4832(%rbp), %rax
+	movq	%rax, -4880(%rbp)
+.L2259:
+	movq	-4872(%rbp), %rax
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	movq	-4864(%rbp), %rax
+	je	.L2399
+	movq	(%rax), %rsi
+	movq	-4880(%rbp), %rdi
+	call	_ZN1n11thread_pool11__find_workEv
+	cmpb	$0, -4824(%rbp)
+	je	.L2260
+	movq	-4832(%rbp), %r14
+	movq	48(%r14), %rax
+	movq	%r14, %rdi
+.LEHB71:
+	call	*(%rax)
+.LEHE71:
+	pxor	%xmm0, %xmm0
+	leaq	-4816(%rbp), %r15
+	movaps	%xmm0, -4816(%rbp)
+	movaps	%xmm0, -4800(%rbp)
+	movaps	%xmm0, -4784(%rbp)
+	movaps	%xmm0, -4768(%rbp)
+	cmpq	%r15, %r14
+	je	.L2261
+	movq	48(%r14), %rax
+	testq	%rax, %rax
+	je	.L2261
+	movq	56(%r14), %rsi
+	movq	%r14, %rdi
+.LEHB72:
+	call	*16(%rax)
+	movq	$0, 48(%r14)
+	movq	-4768(%rbp), %rax
+	testq	%rax, %rax
+	je	.L2261
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	*8(%rax)
+.LEHE72:
+	movdqa	-4768(%rbp), %xmm1
+	movaps	%xmm1, 48(%r14)
+.L2261:
+	movq	64(%r14), %rax
+	lock subq	$1, (%rax)
+	jmp	.L2259
+.L2260:
+	call	sched_yield@PLT
+	jmp	.L2259
+.L2399:
+	addq	$16, %rax
+	movq	%r12, -4880(%rbp)
+	movq	%rax, -4872(%rbp)
+	movq	%rax, %r15
+	movq	%rbx, -4888(%rbp)
+.L2267:
+	movq	8(%r15), %r14
+	leaq	16(%r15), %r12
+	xorl	%ebx, %ebx
+	testq	%r14, %r14
+	je	.L2271
+	.p2align 4,,10
+	.p2align 3
+.L2272:
+	movq	48(%r12), %rax
+	testq	%rax, %rax
+	je	.L2269
+	addq	$1, %rbx
+	movq	56(%r12), %rsi
+	movq	%r12, %rdi
+	addq	$80, %r12
+	call	*16(%rax)
+	cmpq	%rbx, %r14
+	jne	.L2272
+.L2271:
+	movq	$0, 8(%r15)
+	movq	(%r15), %r15
+	testq	%r15, %r15
+	jne	.L2267
+	movq	-4872(%rbp), %rax
+	movq	-4864(%rbp), %rdi
+	movq	-4880(%rbp), %r12
+	movq	-4888(%rbp), %rbx
+	movq	%rax, 672(%rdi)
+	jmp	.L2258
+	.p2align 4,,10
+	.p2align 3
+.L2269:
+	addq	$1, %rbx
+	addq	$80, %r12
+	cmpq	%rbx, %r14
+	jne	.L2272
+	jmp	.L2271
+.L2398:
+	movq	192(%r13), %rax
+	movq	%rax, -4864(%rbp)
+	addq	$8, %rax
+	movq	%rax, -4872(%rbp)
+	leaq	-4832(%rbp), %rax
+	movq	%rax, -4880(%rbp)
+.L2293:
+	movq	-4872(%rbp), %rax
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	movq	-4864(%rbp), %rax
+	je	.L2400
+	movq	(%rax), %rsi
+	movq	-4880(%rbp), %rdi
+	call	_ZN1n11thread_pool11__find_workEv
+	cmpb	$0, -4824(%rbp)
+	je	.L2294
+	movq	-4832(%rbp), %r14
+	movq	48(%r14), %rax
+	movq	%r14, %rdi
+.LEHB73:
+	call	*(%rax)
+.LEHE73:
+	pxor	%xmm0, %xmm0
+	leaq	-4816(%rbp), %r15
+	movaps	%xmm0, -4816(%rbp)
+	movaps	%xmm0, -4800(%rbp)
+	movaps	%xmm0, -4784(%rbp)
+	movaps	%xmm0, -4768(%rbp)
+	cmpq	%r15, %r14
+	je	.L2295
+	movq	48(%r14), %rax
+	testq	%rax, %rax
+	je	.L2295
+	movq	56(%r14), %rsi
+	movq	%r14, %rdi
+.LEHB74:
+	call	*16(%rax)
+	movq	$0, 48(%r14)
+	movq	-4768(%rbp), %rax
+	testq	%rax, %rax
+	je	.L2295
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	*8(%rax)
+.LEHE74:
+	movdqa	-4768(%rbp), %xmm2
+	movaps	%xmm2, 48(%r14)
+.L2295:
+	movq	64(%r14), %rax
+	lock subq	$1, (%rax)
+	jmp	.L2293
+.L2294:
+	call	sched_yield@PLT
+	jmp	.L2293
+.L2400:
+	addq	$16, %rax
+	movq	%r12, -4880(%rbp)
+	movq	%rax, -4872(%rbp)
+	movq	%rax, %r15
+	movq	%rbx, -4888(%rbp)
+.L2301:
+	movq	8(%r15), %r14
+	leaq	16(%r15), %r12
+	xorl	%ebx, %ebx
+	testq	%r14, %r14
+	je	.L2305
+	.p2align 4,,10
+	.p2align 3
+.L2306:
+	movq	48(%r12), %rax
+	testq	%rax, %rax
+	je	.L2303
+	addq	$1, %rbx
+	movq	56(%r12), %rsi
+	movq	%r12, %rdi
+	addq	$80, %r12
+	call	*16(%rax)
+	cmpq	%r14, %rbx
+	jne	.L2306
+.L2305:
+	movq	$0, 8(%r15)
+	movq	(%r15), %r15
+	testq	%r15, %r15
+	jne	.L2301
+	movq	-4872(%rbp), %rax
+	movq	-4864(%rbp), %rdi
+	movq	-4880(%rbp), %r12
+	movq	-4888(%rbp), %rbx
+	movq	%rax, 672(%rdi)
+	jmp	.L2292
+	.p2align 4,,10
+	.p2align 3
+.L2303:
+	addq	$1, %rbx
+	addq	$80, %r12
+	cmpq	%rbx, %r14
+	jne	.L2306
+	jmp	.L2305
+.L2325:
+	movq	%rax, %rbx
+	jmp	.L2317
+.L2332:
+	movq	%rax, %r13
+.L2296:
+	movq	-4768(%rbp), %rax
+	testq	%rax, %rax
+	je	.L2298
+	movq	-4760(%rbp), %rsi
+	movq	%r15, %rdi
+	call	*16(%rax)
+.L2298:
+	movq	%r12, %rdi
+	call	_ZN1n11ring_readerD1Ev
+.L2318:
+	movq	%rbx, %rdi
+	movq	%r13, %rbx
+	call	_ZN1n7io_ringD1Ev
+.L2317:
+	movq	-4848(%rbp), %rdi
+	call	_ZN1n7io_ringD1Ev
+	movq	%rbx, %rdi
+.LEHB75:
+	call	_Unwind_Resume@PLT
+.LEHE75:
+.L2389:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC27(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB76:
+	call	__cxa_throw@PLT
+.L2331:
+	movq	%rax, %r13
+	jmp	.L2262
+.L2330:
+.L2387:
+	movq	%rax, %r13
+	jmp	.L2298
+.L2327:
+	movq	%rax, %r13
+	jmp	.L2315
+.L2328:
+	movq	%rax, %r13
+	jmp	.L2318
+.L2388:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC26(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE76:
+.L2262:
+	movq	-4768(%rbp), %rax
+	testq	%rax, %rax
+	je	.L2298
+	movq	-4760(%rbp), %rsi
+	movq	%r15, %rdi
+	call	*16(%rax)
+	jmp	.L2298
+.L2329:
+	jmp	.L2387
+.L2315:
+	movq	%rbx, %rdi
+	movq	%r13, %rbx
+	call	_ZN1n11ring_readerD1Ev
+.L2316:
+	movq	%r12, %rdi
+	call	_ZN1n11ring_readerD1Ev
+	jmp	.L2317
+.L2326:
+	movq	%rax, %rbx
+	jmp	.L2316
+	.cfi_endproc
+.LFE7032:
+	.section	.gcc_except_table
+.LLSDA7032:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7032-.LLSDACSB7032
+.LLSDACSB7032:
+	.uleb128 .LEHB60-.LFB7032
+	.uleb128 .LEHE60-.LEHB60
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB61-.LFB7032
+	.uleb128 .LEHE61-.LEHB61
+	.uleb128 .L2325-.LFB7032
+	.uleb128 0
+	.uleb128 .LEHB62-.LFB7032
+	.uleb128 .LEHE62-.LEHB62
+	.uleb128 .L2326-.LFB7032
+	.uleb128 0
+	.uleb128 .LEHB63-.LFB7032
+	.uleb128 .LEHE63-.LEHB63
+	.uleb128 .L2327-.LFB7032
+	.uleb128 0
+	.uleb128 .LEHB64-.LFB7032
+	.uleb128 .LEHE64-.LEHB64
+	.uleb128 .L2325-.LFB7032
+	.uleb128 0
+	.uleb128 .LEHB65-.LFB7032
+	.uleb128 .LEHE65-.LEHB65
+	.uleb128 .L2328-.LFB7032
+	.uleb128 0
+	.uleb128 .LEHB66-.LFB7032
+	.uleb128 .LEHE66-.LEHB66
+	.uleb128 .L2330-.LFB7032
+	.uleb128 0
+	.uleb128 .LEHB67-.LFB7032
+	.uleb128 .LEHE67-.LEHB67
+	.uleb128 .L2328-.LFB7032
+	.uleb128 0
+	.uleb128 .LEHB68-.LFB7032
+	.uleb128 .LEHE68-.LEHB68
+	.uleb128 .L2329-.LFB7032
+	.uleb128 0
+	.uleb128 .LEHB69-.LFB7032
+	.uleb128 .LEHE69-.LEHB69
+	.uleb128 .L2328-.LFB7032
+	.uleb128 0
+	.uleb128 .LEHB70-.LFB7032
+	.uleb128 .LEHE70-.LEHB70
+	.uleb128 .L2330-.LFB7032
+	.uleb128 0
+	.uleb128 .LEHB71-.LFB7032
+	.uleb128 .LEHE71-.LEHB71
+	.uleb128 .L2329-.LFB7032
+	.uleb128 0
+	.uleb128 .LEHB72-.LFB7032
+	.uleb128 .LEHE72-.LEHB72
+	.uleb128 .L2331-.LFB7032
+	.uleb128 0
+	.uleb128 .LEHB73-.LFB7032
+	.uleb128 .LEHE73-.LEHB73
+	.uleb128 .L2330-.LFB7032
+	.uleb128 0
+	.uleb128 .LEHB74-.LFB7032
+	.uleb128 .LEHE74-.LEHB74
+	.uleb128 .L2332-.LFB7032
+	.uleb128 0
+	.uleb128 .LEHB75-.LFB7032
+	.uleb128 .LEHE75-.LEHB75
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB76-.LFB7032
+	.uleb128 .LEHE76-.LEHB76
+	.uleb128 .L2327-.LFB7032
+	.uleb128 0
+.LLSDACSE7032:
+	.section	.text._Z25test_ring_readers_sharingILN1n10io_backendE2EEvv,"axG",@progbits,_Z25test_ring_readers_sharingILN1n10io_backendE2EEvv,comdat
+	.size	_Z25test_ring_readers_sharingILN1n10io_backendE2EEvv, .-_Z25test_ring_readers_sharingILN1n10io_backendE2EEvv
+	.section	.text._Z25test_ring_readers_sharingILN1n10io_backendE0EEvv,"axG",@progbits,_Z25test_ring_readers_sharingILN1n10io_backendE0EEvv,comdat
+	.p2align 4
+	.weak	_Z25test_ring_readers_sharingILN1n10io_backendE0EEvv
+	.type	_Z25test_ring_readers_sharingILN1n10io_backendE0EEvv, @function
+_Z25test_ring_readers_sharingILN1n10io_backendE0EEvv:
+.LFB7031:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7031
+	leaq	8(%rsp), %r10
+	.cfi_def_cfa 10, 0
+	andq	$-64, %rsp
+	movl	$438, %edx
+	movl	$577, %esi
+	pushq	-8(%r10)
+	xorl	%eax, %eax
+	pushq	%rbp
+	movq	%rsp, %rbp
+	.cfi_escape 0x10,0x6,0x2,0x76,0
+	pushq	%r15
+	pushq	%r14
+	.cfi_escape 0x10,0xf,0x2,0x76,0x78
+	.cfi_escape 0x10,0xe,0x2,0x76,0x70
+	xorl	%r14d, %r14d
+	pushq	%r13
+	.cfi_escape 0x10,0xd,0x2,0x76,0x68
+	xorl	%r13d, %r13d
+	pushq	%r12
+	.cfi_escape 0x10,0xc,0x2,0x76,0x60
+	movabsq	$2351776136887273513, %r12
+	pushq	%r10
+	.cfi_escape 0xf,0x3,0x76,0x58,0x6
+	pushq	%rbx
+	.cfi_escape 0x10,0x3,0x2,0x76,0x50
+	leaq	-4144(%rbp), %rbx
+	subq	$4864, %rsp
+	movq	path(%rip), %rdi
+.LEHB77:
+	call	open@PLT
+	movl	$4096, %r8d
+	movl	%eax, %r15d
+	.p2align 4,,10
+	.p2align 3
+.L2404:
+	leaq	(%r14,%r13), %rcx
+	addq	%r8, %r13
+	movq	%rbx, %rsi
+	leaq	(%r13,%r13), %r14
+	leaq	(%r14,%r13), %rdi
+	.p2align 4,,10
+	.p2align 3
+.L2402:
+	movq	%rcx, %rax
+	addq	$1, %rsi
+	imulq	%r12
+	movq	%rcx, %rax
+	sarq	$63, %rax
+	sarq	$5, %rdx
+	subq	%rax, %rdx
+	movq	%rcx, %rax
+	addq	$3, %rcx
+	imulq	$251, %rdx, %rdx
+	subq	%rdx, %rax
+	movb	%al, -1(%rsi)
+	cmpq	%rcx, %rdi
+	jne	.L2402
+	movq	%r8, %rdx
+	movq	%rbx, %rsi
+	movl	%r15d, %edi
+	call	write@PLT
+	cmpq	$299999, %r13
+	ja	.L2403
+	movl	$300000, %r8d
+	movl	$4096, %eax
+	subq	%r13, %r8
+	cmpq	%rax, %r8
+	cmova	%rax, %r8
+	jmp	.L2404
+.L2403:
+	movl	%r15d, %edi
+	xorl	%r13d, %r13d
+	xorl	%r14d, %r14d
+	movabsq	$2351776136887273513, %r12
+	call	close@PLT
+	movq	other(%rip), %rdi
+	movl	$438, %edx
+	xorl	%eax, %eax
+	movl	$577, %esi
+	call	open@PLT
+	movl	$4096, %r8d
+	movl	%eax, %r15d
+	.p2align 4,,10
+	.p2align 3
+.L2407:
+	leaq	(%r14,%r13), %rcx
+	addq	%r8, %r13
+	movq	%rbx, %rsi
+	leaq	0(,%r13,4), %r14
+	leaq	(%r14,%r13), %rdi
+	.p2align 4,,10
+	.p2align 3
+.L2405:
+	movq	%rcx, %rax
+	addq	$1, %rsi
+	imulq	%r12
+	movq	%rcx, %rax
+	sarq	$63, %rax
+	sarq	$5, %rdx
+	subq	%rax, %rdx
+	movq	%rcx, %rax
+	addq	$5, %rcx
+	imulq	$251, %rdx, %rdx
+	subq	%rdx, %rax
+	movb	%al, -1(%rsi)
+	cmpq	%rcx, %rdi
+	jne	.L2405
+	movq	%r8, %rdx
+	movq	%rbx, %rsi
+	movl	%r15d, %edi
+	call	write@PLT
+	cmpq	$123456, %r13
+	ja	.L2406
+	movl	$123457, %r8d
+	movl	$4096, %eax
+	subq	%r13, %r8
+	cmpq	%rax, %r8
+	cmova	%rax, %r8
+	jmp	.L2407
+.L2406:
+	movl	%r15d, %edi
+	leaq	-4656(%rbp), %r15
+	call	close@PLT
+	movl	$8, %esi
+	movq	%r15, %rdi
+	xorl	%r8d, %r8d
+	xorl	%ecx, %ecx
+	movl	$4096, %edx
+	movq	%r15, -4848(%rbp)
+	call	_ZN1n7io_ringC1EmmNS_10io_backendEPNS_11thread_poolE
+.LEHE77:
+	movq	path(%rip), %rdi
+	xorl	%esi, %esi
+	xorl	%eax, %eax
+.LEHB78:
+	call	open@PLT
+	movq	other(%rip), %rdi
+	movl	%eax, -4836(%rbp)
+	movl	%eax, %r13d
+	xorl	%esi, %esi
+	xorl	%eax, %eax
+	call	open@PLT
+	leaq	-4752(%rbp), %r12
+	xorl	%ecx, %ecx
+	movl	%r13d, %edx
+	movq	%r15, %rsi
+	movl	$4, %r8d
+	movq	%r12, %rdi
+	movl	%eax, -4840(%rbp)
+	movl	%eax, %r14d
+	call	_ZN1n11ring_readerC1ERNS_7io_ringEimm
+.LEHE78:
+	movl	$4, %r8d
+	movl	%r14d, %edx
+	movq	%r15, %rsi
+	movq	%rbx, %rdi
+	movl	$4, %ecx
+.LEHB79:
+	call	_ZN1n11ring_readerC1ERNS_7io_ringEimm
+.LEHE79:
+	movq	%rbx, %rdi
+.LEHB80:
+	call	_Z12read_patternRN1n11ring_readerEmm.constprop.1
+	testb	%al, %al
+	je	.L2550
+	movq	%r12, %rdi
+	call	_Z12read_patternRN1n11ring_readerEmm.constprop.0
+.LEHE80:
+	testb	%al, %al
+	je	.L2551
+	movq	%rbx, %rdi
+	call	_ZN1n11ring_readerD1Ev
+	movq	%r12, %rdi
+	call	_ZN1n11ring_readerD1Ev
+	xorl	%r8d, %r8d
+	xorl	%ecx, %ecx
+	movl	$4096, %edx
+	movl	$2, %esi
+	movq	%rbx, %rdi
+.LEHB81:
+	call	_ZN1n7io_ringC1EmmNS_10io_backendEPNS_11thread_poolE
+.LEHE81:
+	movq	other(%rip), %rdi
+	movl	$514, %esi
+	xorl	%eax, %eax
+.LEHB82:
+	call	open@PLT
+	movq	$-1, %r8
+	xorl	%ecx, %ecx
+	movl	%eax, %edx
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	movl	%eax, -4852(%rbp)
+	call	_ZN1n11ring_readerC1ERNS_7io_ringEimm
+	movq	-4672(%rbp), %rax
+	cmpq	%rax, -4680(%rbp)
+	jb	.L2410
+	cmpb	$0, -4664(%rbp)
+	jne	.L2552
+.L2418:
+	movq	-4696(%rbp), %r15
+	cmpq	-4704(%rbp), %r15
+	je	.L2435
+	cmpb	$0, -4663(%rbp)
+	je	.L2553
+.L2435:
+	movq	%r12, %rdi
+	call	_ZN1n11ring_readerD1Ev
+.L2441:
+	movl	-4836(%rbp), %edx
+	xorl	%ecx, %ecx
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	movq	$-1, %r8
+	call	_ZN1n11ring_readerC1ERNS_7io_ringEimm
+.LEHE82:
+	movq	-4672(%rbp), %rax
+	cmpq	%rax, -4680(%rbp)
+	jb	.L2548
+	cmpb	$0, -4664(%rbp)
+	jne	.L2554
+.L2452:
+	movq	-4696(%rbp), %r15
+	cmpq	-4704(%rbp), %r15
+	je	.L2547
+	cmpb	$0, -4663(%rbp)
+	jne	.L2547
+	movq	%r15, %rax
+	xorl	%edx, %edx
+	movq	-4752(%rbp), %r13
+	divq	-4728(%rbp)
+	addq	-4736(%rbp), %rdx
+	leaq	(%rdx,%rdx,2), %r14
+	movq	%rdx, -4864(%rbp)
+	salq	$4, %r14
+	jmp	.L2472
+	.p2align 4,,10
+	.p2align 3
+.L2474:
+	movl	$1, %esi
+	movq	%r13, %rdi
+.LEHB83:
+	call	_ZN1n7io_ring4waitEPmmm.constprop.0
+.LEHE83:
+	testq	%rax, %rax
+	je	.L2473
+.L2472:
+	movq	24(%r13), %rax
+	addq	%r14, %rax
+	cmpl	$1, 8(%rax)
+	je	.L2474
+	movq	40(%rax), %rdx
+	addq	$1, %r15
+	movq	%r15, -4696(%rbp)
+	testq	%rdx, %rdx
+	jle	.L2555
+	movq	16(%r13), %rax
+	movq	-4864(%rbp), %rdi
+	movq	$0, -4680(%rbp)
+	movq	%rdx, -4672(%rbp)
+	cmpq	%rax, %rdx
+	movb	$1, -4664(%rbp)
+	setb	-4663(%rbp)
+	imulq	%rax, %rdi
+	movq	0(%r13), %rax
+	addq	%rdi, %rax
+	movq	%rax, -4688(%rbp)
+.L2548:
+	movq	%r12, %rdi
+	call	_ZN1n11ring_readerD1Ev
+	movl	-4836(%rbp), %edi
+.LEHB84:
+	call	close@PLT
+	movl	-4840(%rbp), %edi
+	call	close@PLT
+	movl	-4852(%rbp), %edi
+	call	close@PLT
+.LEHE84:
+	movq	path(%rip), %rdi
+	call	remove@PLT
+	movq	other(%rip), %rdi
+	call	remove@PLT
+	movq	%rbx, %rdi
+	call	_ZN1n7io_ringD1Ev
+	movq	-4848(%rbp), %rdi
+	call	_ZN1n7io_ringD1Ev
+	leaq	-48(%rbp), %rsp
+	popq	%rbx
+	popq	%r10
+	.cfi_remember_state
+	.cfi_def_cfa 10, 0
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	leaq	-8(%r10), %rsp
+	.cfi_def_cfa 7, 8
+	ret
+.L2553:
+	.cfi_restore_state
+	movq	%r15, %rax
+	xorl	%edx, %edx
+	movq	-4752(%rbp), %r13
+	divq	-4728(%rbp)
+	addq	-4736(%rbp), %rdx
+	leaq	(%rdx,%rdx,2), %r14
+	movq	%rdx, -4864(%rbp)
+	salq	$4, %r14
+	jmp	.L2436
+	.p2align 4,,10
+	.p2align 3
+.L2438:
+	movl	$1, %esi
+	movq	%r13, %rdi
+.LEHB85:
+	call	_ZN1n7io_ring4waitEPmmm.constprop.0
+	testq	%rax, %rax
+	je	.L2437
+.L2436:
+	movq	24(%r13), %rax
+	addq	%r14, %rax
+	cmpl	$1, 8(%rax)
+	je	.L2438
+	movq	40(%rax), %rdx
+	addq	$1, %r15
+	movq	%r15, -4696(%rbp)
+	testq	%rdx, %rdx
+	jle	.L2556
+	movq	16(%r13), %rax
+	movq	-4864(%rbp), %rdi
+	movq	$0, -4680(%rbp)
+	movq	%rdx, -4672(%rbp)
+	cmpq	%rax, %rdx
+	movb	$1, -4664(%rbp)
+	setb	-4663(%rbp)
+	imulq	%rax, %rdi
+	movq	0(%r13), %rax
+	addq	%rdi, %rax
+	movq	%r12, %rdi
+	movq	%rax, -4688(%rbp)
+	call	_ZN1n11ring_readerD1Ev
+	jmp	.L2442
+.L2552:
+	cmpb	$0, -4663(%rbp)
+	movb	$0, -4664(%rbp)
+	movq	-4752(%rbp), %r13
+	jne	.L2413
+	movq	-4720(%rbp), %rax
+	movq	-4712(%rbp), %r14
+	testq	%rax, %rax
+	js	.L2414
+	cmpq	%r14, %rax
+	jle	.L2413
+.L2414:
+	movq	-4704(%rbp), %r15
+	xorl	%edx, %edx
+	movq	16(%r13), %rcx
+	xorl	%r9d, %r9d
+	movl	-4744(%rbp), %esi
+	movq	%r14, %r8
+	movq	%r13, %rdi
+	movq	%r15, %rax
+	divq	-4728(%rbp)
+	addq	-4736(%rbp), %rdx
+	call	_ZN1n7io_ring7__queueEimmlb
+	testb	%al, %al
+	je	.L2413
+	addq	16(%r13), %r14
+	addq	$1, %r15
+	movq	%r14, -4712(%rbp)
+	movq	%r15, -4704(%rbp)
+.L2413:
+	movl	64(%r13), %esi
+	testl	%esi, %esi
+	jns	.L2557
+	movq	216(%r13), %rax
+	testq	%rax, %rax
+	je	.L2418
+	cmpq	56(%r13), %rax
+	je	.L2558
+.L2420:
+	movq	%r13, %rdi
+	call	_ZN1n7io_ring6submitEv.part.0
+.LEHE85:
+	jmp	.L2418
+.L2555:
+	jne	.L2483
+	xorl	%edx, %edx
+.L2476:
+	movl	%edx, -4660(%rbp)
+	movb	$1, -4663(%rbp)
+.L2547:
+	movq	%r12, %rdi
+	call	_ZN1n11ring_readerD1Ev
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC29(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB86:
+	call	__cxa_throw@PLT
+.L2410:
+	movq	%r12, %rdi
+	call	_ZN1n11ring_readerD1Ev
+.L2442:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC28(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE86:
+	.p2align 4,,10
+	.p2align 3
+.L2554:
+	cmpb	$0, -4663(%rbp)
+	movb	$0, -4664(%rbp)
+	movq	-4752(%rbp), %r13
+	jne	.L2447
+	movq	-4720(%rbp), %rax
+	movq	-4712(%rbp), %r14
+	testq	%rax, %rax
+	js	.L2448
+	cmpq	%r14, %rax
+	jle	.L2447
+.L2448:
+	movq	-4704(%rbp), %r15
+	xorl	%edx, %edx
+	movq	16(%r13), %rcx
+	xorl	%r9d, %r9d
+	movl	-4744(%rbp), %esi
+	movq	%r14, %r8
+	movq	%r13, %rdi
+	movq	%r15, %rax
+	divq	-4728(%rbp)
+	addq	-4736(%rbp), %rdx
+.LEHB87:
+	call	_ZN1n7io_ring7__queueEimmlb
+	testb	%al, %al
+	je	.L2447
+	addq	16(%r13), %r14
+	addq	$1, %r15
+	movq	%r14, -4712(%rbp)
+	movq	%r15, -4704(%rbp)
+.L2447:
+	movl	64(%r13), %esi
+	testl	%esi, %esi
+	jns	.L2559
+	movq	216(%r13), %rax
+	testq	%rax, %rax
+	je	.L2452
+	cmpq	56(%r13), %rax
+	je	.L2560
+.L2454:
+	movq	%r13, %rdi
+	call	_ZN1n7io_ring6submitEv.part.0
+.LEHE87:
+	jmp	.L2452
+.L2557:
+	movl	168(%r13), %edx
+	testl	%edx, %edx
+	jne	.L2419
+	jmp	.L2418
+	.p2align 4,,10
+	.p2align 3
+.L2417:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2418
+	movl	168(%r13), %edx
+	movl	64(%r13), %esi
+.L2419:
+	subq	$8, %rsp
+	movl	$426, %edi
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	pushq	$0
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%rsi
+	popq	%rdi
+	testq	%rax, %rax
+	js	.L2417
+	subl	%eax, 168(%r13)
+	jmp	.L2418
+.L2559:
+	movl	168(%r13), %edx
+	testl	%edx, %edx
+	jne	.L2453
+	jmp	.L2452
+	.p2align 4,,10
+	.p2align 3
+.L2451:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2452
+	movl	168(%r13), %edx
+	movl	64(%r13), %esi
+.L2453:
+	subq	$8, %rsp
+	xorl	%ecx, %ecx
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	pushq	$0
+	movl	$426, %edi
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%rdx
+	popq	%rcx
+	testq	%rax, %rax
+	js	.L2451
+	subl	%eax, 168(%r13)
+	jmp	.L2452
+.L2556:
+	jne	.L2484
+	xorl	%edx, %edx
+.L2440:
+	movl	%edx, -4660(%rbp)
+	movq	%r12, %rdi
+	movb	$1, -4663(%rbp)
+	call	_ZN1n11ring_readerD1Ev
+	jmp	.L2441
+.L2437:
+	addq	$1, %r15
+	movq	$-5, %rdx
+	movq	%r15, -4696(%rbp)
+.L2484:
+	negl	%edx
+	jmp	.L2440
+.L2473:
+	addq	$1, %r15
+	movq	$-5, %rdx
+	movq	%r15, -4696(%rbp)
+.L2483:
+	negl	%edx
+	jmp	.L2476
+.L2558:
+	movq	192(%r13), %rax
+	movq	%rax, -4864(%rbp)
+	addq	$8, %rax
+	movq	%rax, -4872(%rbp)
+	leaq	-4832(%rbp), %rax
+	movq	%rax, -4880(%rbp)
+.L2421:
+	movq	-4872(%rbp), %rax
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	movq	-4864(%rbp), %rax
+	je	.L2561
+	movq	(%rax), %rsi
+	movq	-4880(%rbp), %rdi
+	call	_ZN1n11thread_pool11__find_workEv
+	cmpb	$0, -4824(%rbp)
+	je	.L2422
+	movq	-4832(%rbp), %r14
+	movq	48(%r14), %rax
+	movq	%r14, %rdi
+.LEHB88:
+	call	*(%rax)
+.LEHE88:
+	pxor	%xmm0, %xmm0
+	leaq	-4816(%rbp), %r15
+	movaps	%xmm0, -4816(%rbp)
+	movaps	%xmm0, -4800(%rbp)
+	movaps	%xmm0, -4784(%rbp)
+	movaps	%xmm0, -4768(%rbp)
+	cmpq	%r15, %r14
+	je	.L2423
+	movq	48(%r14), %rax
+	testq	%rax, %rax
+	je	.L2423
+	movq	56(%r14), %rsi
+	movq	%r14, %rdi
+.LEHB89:
+	call	*16(%rax)
+	movq	$0, 48(%r14)
+	movq	-4768(%rbp), %rax
+	testq	%rax, %rax
+	je	.L2423
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	*8(%rax)
+.LEHE89:
+	movdqa	-4768(%rbp), %xmm1
+	movaps	%xmm1, 48(%r14)
+.L2423:
+	movq	64(%r14), %rax
+	lock subq	$1, (%rax)
+	jmp	.L2421
+.L2422:
+	call	sched_yield@PLT
+	jmp	.L2421
+.L2561:
+	addq	$16, %rax
+	movq	%r12, -4880(%rbp)
+	movq	%rax, -4872(%rbp)
+	movq	%rax, %r15
+	movq	%rbx, -4888(%rbp)
+.L2429:
+	movq	8(%r15), %r14
+	leaq	16(%r15), %r12
+	xorl	%ebx, %ebx
+	testq	%r14, %r14
+	je	.L2433
+	.p2align 4,,10
+	.p2align 3
+.L2434:
+	movq	48(%r12), %rax
+	testq	%rax, %rax
+	je	.L2431
+	addq	$1, %rbx
+	movq	56(%r12), %rsi
+	movq	%r12, %rdi
+	addq	$80, %r12
+	call	*16(%rax)
+	cmpq	%rbx, %r14
+	jne	.L2434
+.L2433:
+	movq	$0, 8(%r15)
+	movq	(%r15), %r15
+	testq	%r15, %r15
+	jne	.L2429
+	movq	-4872(%rbp), %rax
+	movq	-4864(%rbp), %rdi
+	movq	-4880(%rbp), %r12
+	movq	-4888(%rbp), %rbx
+	movq	%rax, 672(%rdi)
+	jmp	.L2420
+	.p2align 4,,10
+	.p2align 3
+.L2431:
+	addq	$1, %rbx
+	addq	$80, %r12
+	cmpq	%rbx, %r14
+	jne	.L2434
+	jmp	.L2433
+.L2560:
+	movq	192(%r13), %rax
+	movq	%rax, -4864(%rbp)
+	addq	$8, %rax
+	movq	%rax, -4872(%rbp)
+	leaq	-4832(%rbp), %rax
+	movq	%rax, -4880(%rbp)
+.L2455:
+	movq	-4872(%rbp), %rax
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	movq	-4864(%rbp), %rax
+	je	.L2562
+	movq	(%rax), %rsi
+	movq	-4880(%rbp), %rdi
+	call	_ZN1n11thread_pool11__find_workEv
+	cmpb	$0, -4824(%rbp)
+	je	.L2456
+	movq	-4832(%rbp), %r14
+	movq	48(%r14), %rax
+	movq	%r14, %rdi
+.LEHB90:
+	call	*(%rax)
+.LEHE90:
+	pxor	%xmm0, %xmm0
+	leaq	-4816(%rbp), %r15
+	movaps	%xmm0, -4816(%rbp)
+	movaps	%xmm0, -4800(%rbp)
+	movaps	%xmm0, -4784(%rbp)
+	movaps	%xmm0, -4768(%rbp)
+	cmpq	%r15, %r14
+	je	.L2457
+	movq	48(%r14), %rax
+	testq	%rax, %rax
+	je	.L2457
+	movq	56(%r14), %rsi
+	movq	%r14, %rdi
+.LEHB91:
+	call	*16(%rax)
+	movq	$0, 48(%r14)
+	movq	-4768(%rbp), %rax
+	testq	%rax, %rax
+	je	.L2457
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	*8(%rax)
+.LEHE91:
+	movdqa	-4768(%rbp), %xmm2
+	movaps	%xmm2, 48(%r14)
+.L2457:
+	movq	64(%r14), %rax
+	lock subq	$1, (%rax)
+	jmp	.L2455
+.L2456:
+	call	sched_yield@PLT
+	jmp	.L2455
+.L2562:
+	addq	$16, %rax
+	movq	%r12, -4880(%rbp)
+	movq	%rax, -4872(%rbp)
+	movq	%rax, %r15
+	movq	%rbx, -4888(%rbp)
+.L2463:
+	movq	8(%r15), %r14
+	leaq	16(%r15), %r12
+	xorl	%ebx, %ebx
+	testq	%r14, %r14
+	je	.L2467
+	.p2align 4,,10
+	.p2align 3
+.L2468:
+	movq	48(%r12), %rax
+	testq	%rax, %rax
+	je	.L2465
+	addq	$1, %rbx
+	movq	56(%r12), %rsi
+	movq	%r12, %rdi
+	addq	$80, %r12
+	call	*16(%rax)
+	cmpq	%r14, %rbx
+	jne	.L2468
+.L2467:
+	movq	$0, 8(%r15)
+	movq	(%r15), %r15
+	testq	%r15, %r15
+	jne	.L2463
+	movq	-4872(%rbp), %rax
+	movq	-4864(%rbp), %rdi
+	movq	-4880(%rbp), %r12
+	movq	-4888(%rbp), %rbx
+	movq	%rax, 672(%rdi)
+	jmp	.L2454
+	.p2align 4,,10
+	.p2align 3
+.L2465:
+	addq	$1, %rbx
+	addq	$80, %r12
+	cmpq	%rbx, %r14
+	jne	.L2468
+	jmp	.L2467
+.L2487:
+	movq	%rax, %rbx
+	jmp	.L2479
+.L2494:
+	movq	%rax, %r13
+.L2458:
+	movq	-4768(%rbp), %rax
+	testq	%rax, %rax
+	je	.L2460
+	movq	-4760(%rbp), %rsi
+	movq	%r15, %rdi
+	call	*16(%rax)
+.L2460:
+	movq	%r12, %rdi
+	call	_ZN1n11ring_readerD1Ev
+.L2480:
+	movq	%rbx, %rdi
+	movq	%r13, %rbx
+	call	_ZN1n7io_ringD1Ev
+.L2479:
+	movq	-4848(%rbp), %rdi
+	call	_ZN1n7io_ringD1Ev
+	movq	%rbx, %rdi
+.LEHB92:
+	call	_Unwind_Resume@PLT
+.LEHE92:
+.L2551:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC27(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB93:
+	call	__cxa_throw@PLT
+.L2493:
+	movq	%rax, %r13
+	jmp	.L2424
+.L2492:
+.L2549:
+	movq	%rax, %r13
+	jmp	.L2460
+.L2489:
+	movq	%rax, %r13
+	jmp	.L2477
+.L2490:
+	movq	%rax, %r13
+	jmp	.L2480
+.L2550:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC26(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE93:
+.L2424:
+	movq	-4768(%rbp), %rax
+	testq	%rax, %rax
+	je	.L2460
+	movq	-4760(%rbp), %rsi
+	movq	%r15, %rdi
+	call	*16(%rax)
+	jmp	.L2460
+.L2491:
+	jmp	.L2549
+.L2477:
+	movq	%rbx, %rdi
+	movq	%r13, %rbx
+	call	_ZN1n11ring_readerD1Ev
+.L2478:
+	movq	%r12, %rdi
+	call	_ZN1n11ring_readerD1Ev
+	jmp	.L2479
+.L2488:
+	movq	%rax, %rbx
+	jmp	.L2478
+	.cfi_endproc
+.LFE7031:
+	.section	.gcc_except_table
+.LLSDA7031:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7031-.LLSDACSB7031
+.LLSDACSB7031:
+	.uleb128 .LEHB77-.LFB7031
+	.uleb128 .LEHE77-.LEHB77
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB78-.LFB7031
+	.uleb128 .LEHE78-.LEHB78
+	.uleb128 .L2487-.LFB7031
+	.uleb128 0
+	.uleb128 .LEHB79-.LFB7031
+	.uleb128 .LEHE79-.LEHB79
+	.uleb128 .L2488-.LFB7031
+	.uleb128 0
+	.uleb128 .LEHB80-.LFB7031
+	.uleb128 .LEHE80-.LEHB80
+	.uleb128 .L2489-.LFB7031
+	.uleb128 0
+	.uleb128 .LEHB81-.LFB7031
+	.uleb128 .LEHE81-.LEHB81
+	.uleb128 .L2487-.LFB7031
+	.uleb128 0
+	.uleb128 .LEHB82-.LFB7031
+	.uleb128 .LEHE82-.LEHB82
+	.uleb128 .L2490-.LFB7031
+	.uleb128 0
+	.uleb128 .LEHB83-.LFB7031
+	.uleb128 .LEHE83-.LEHB83
+	.uleb128 .L2492-.LFB7031
+	.uleb128 0
+	.uleb128 .LEHB84-.LFB7031
+	.uleb128 .LEHE84-.LEHB84
+	.uleb128 .L2490-.LFB7031
+	.uleb128 0
+	.uleb128 .LEHB85-.LFB7031
+	.uleb128 .LEHE85-.LEHB85
+	.uleb128 .L2491-.LFB7031
+	.uleb128 0
+	.uleb128 .LEHB86-.LFB7031
+	.uleb128 .LEHE86-.LEHB86
+	.uleb128 .L2490-.LFB7031
+	.uleb128 0
+	.uleb128 .LEHB87-.LFB7031
+	.uleb128 .LEHE87-.LEHB87
+	.uleb128 .L2492-.LFB7031
+	.uleb128 0
+	.uleb128 .LEHB88-.LFB7031
+	.uleb128 .LEHE88-.LEHB88
+	.uleb128 .L2491-.LFB7031
+	.uleb128 0
+	.uleb128 .LEHB89-.LFB7031
+	.uleb128 .LEHE89-.LEHB89
+	.uleb128 .L2493-.LFB7031
+	.uleb128 0
+	.uleb128 .LEHB90-.LFB7031
+	.uleb128 .LEHE90-.LEHB90
+	.uleb128 .L2492-.LFB7031
+	.uleb128 0
+	.uleb128 .LEHB91-.LFB7031
+	.uleb128 .LEHE91-.LEHB91
+	.uleb128 .L2494-.LFB7031
+	.uleb128 0
+	.uleb128 .LEHB92-.LFB7031
+	.uleb128 .LEHE92-.LEHB92
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB93-.LFB7031
+	.uleb128 .LEHE93-.LEHB93
+	.uleb128 .L2489-.LFB7031
+	.uleb128 0
+.LLSDACSE7031:
+	.section	.text._Z25test_ring_readers_sharingILN1n10io_backendE0EEvv,"axG",@progbits,_Z25test_ring_readers_sharingILN1n10io_backendE0EEvv,comdat
+	.size	_Z25test_ring_readers_sharingILN1n10io_backendE0EEvv, .-_Z25test_ring_readers_sharingILN1n10io_backendE0EEvv
+	.section	.rodata._Z23test_io_ring_read_writeILN1n10io_backendE2EEvv.str1.1,"aMS",@progbits,1
+.LC30:
+	.string	"expected true : ring.ready()"
+	.section	.rodata._Z23test_io_ring_read_writeILN1n10io_backendE2EEvv.str1.8,"aMS",@progbits,1
+	.align 8
+.LC31:
+	.string	"expected equal : expected value : ring.depth(), actual value : 4"
+	.align 8
+.LC33:
+	.string	"expected true : ring.write(fd, k, 4096, long(k * 4096))"
+	.align 8
+.LC35:
+	.string	"expected false : ring.write(fd, 0, 10, 0)"
+	.align 8
+.LC36:
+	.string	"expected equal : expected value : ring.in_flight(), actual value : 4"
+	.align 8
+.LC37:
+	.string	"expected equal : expected value : ring.in_flight(), actual value : 0"
+	.align 8
+.LC38:
+	.string	"expected equal : expected value : ring.result(done[0]), actual value : 4096"
+	.align 8
+.LC40:
+	.string	"expected true : ring.read(fd, 1, 4096, 3 * 4096 + 100)"
+	.align 8
+.LC43:
+	.string	"expected true : ring.read(fd, 2, 100, 2 * 4096)"
+	.align 8
+.LC44:
+	.string	"expected equal : expected value : ring.wait_for(1), actual value : 4096 - 100"
+	.align 8
+.LC45:
+	.string	"expected equal : expected value : ring.wait_for(2), actual value : 100"
+	.align 8
+.LC46:
+	.string	"expected true : ring.buffer(1)[0] == 'd' and ring.buffer(2)[99] == 'c'"
+	.align 8
+.LC47:
+	.string	"expected true : ring.read(-1, 3, 10, 0)"
+	.align 8
+.LC48:
+	.string	"expected equal : expected value : ring.wait_for(3), actual value : -EBADF"
+	.section	.text._Z23test_io_ring_read_writeILN1n10io_backendE2EEvv,"axG",@progbits,_Z23test_io_ring_read_writeILN1n10io_backendE2EEvv,comdat
+	.p2align 4
+	.weak	_Z23test_io_ring_read_writeILN1n10io_backendE2EEvv
+	.type	_Z23test_io_ring_read_writeILN1n10io_backendE2EEvv, @function
+_Z23test_io_ring_read_writeILN1n10io_backendE2EEvv:
+.LFB7028:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7028
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	xorl	%r8d, %r8d
+	movl	$2, %ecx
+	movl	$4096, %edx
+	movl	$4, %esi
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	andq	$-64, %rsp
+	subq	$576, %rsp
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	leaq	64(%rsp), %rbx
+	movq	%rbx, %rdi
+.LEHB94:
+	call	_ZN1n7io_ringC1EmmNS_10io_backendEPNS_11thread_poolE
+.LEHE94:
+	movl	128(%rsp), %r8d
+	testl	%r8d, %r8d
+	js	.L2659
+.L2564:
+	cmpq	$4, 72(%rsp)
+	jne	.L2660
+	movq	path(%rip), %rdi
+	movl	$438, %edx
+	movl	$578, %esi
+	xorl	%eax, %eax
+.LEHB95:
+	call	open@PLT
+	movl	128(%rsp), %edx
+	movl	%eax, %r13d
+	xorl	%r12d, %r12d
+	movabsq	$72340172838076673, %r14
+.L2576:
+	movq	80(%rsp), %rsi
+	leal	97(%r12), %eax
+	movzbl	%al, %eax
+	movq	%rsi, %rcx
+	imulq	%r14, %rax
+	imulq	%r12, %rcx
+	addq	64(%rsp), %rcx
+	leaq	8(%rcx), %rdi
+	andq	$-8, %rdi
+	movq	%rax, (%rcx)
+	movq	%rax, 4088(%rcx)
+	subq	%rdi, %rcx
+	addl	$4096, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	testl	%edx, %edx
+	js	.L2661
+.L2566:
+	cmpq	72(%rsp), %r12
+	jnb	.L2567
+	cmpq	$4095, %rsi
+	jbe	.L2567
+	leaq	(%r12,%r12,2), %rax
+	salq	$4, %rax
+	addq	88(%rsp), %rax
+	cmpl	$1, 8(%rax)
+	je	.L2567
+	movdqa	.LC32(%rip), %xmm1
+	movq	%r12, %rcx
+	movl	%r13d, (%rax)
+	salq	$12, %rcx
+	movb	$1, 4(%rax)
+	movl	$1, 8(%rax)
+	movq	%rcx, 32(%rax)
+	movq	$0, 40(%rax)
+	movups	%xmm1, 16(%rax)
+	addq	$1, 120(%rsp)
+	testl	%edx, %edx
+	jns	.L2662
+	movq	264(%rsp), %rdi
+	movq	280(%rsp), %rax
+	movq	272(%rsp), %r15
+	movq	%rdi, 24(%rsp)
+	cmpq	%r15, %rax
+	je	.L2663
+	movq	%r12, (%rdi,%rax,8)
+	movq	280(%rsp), %rcx
+.L2575:
+	addq	$1, %rcx
+	movq	%rcx, 280(%rsp)
+.L2571:
+	addq	$1, %r12
+	cmpq	$4, %r12
+	jne	.L2576
+	testl	%edx, %edx
+	js	.L2664
+.L2577:
+	cmpq	$0, 72(%rsp)
+	je	.L2578
+	cmpq	$9, 80(%rsp)
+	jbe	.L2578
+	movq	88(%rsp), %rax
+	cmpl	$1, 8(%rax)
+	je	.L2578
+	movq	120(%rsp), %rcx
+	movdqa	.LC34(%rip), %xmm0
+	movl	%r13d, (%rax)
+	movb	$1, 4(%rax)
+	movups	%xmm0, 16(%rax)
+	addq	$1, %rcx
+	pxor	%xmm0, %xmm0
+	movl	$1, 8(%rax)
+	movups	%xmm0, 32(%rax)
+	movq	%rcx, 120(%rsp)
+	testl	%edx, %edx
+	jns	.L2665
+	movq	280(%rsp), %rax
+	movq	272(%rsp), %r12
+	movq	264(%rsp), %r13
+	cmpq	%r12, %rax
+	je	.L2666
+	movq	$0, 0(%r13,%rax,8)
+.L2654:
+	movq	280(%rsp), %rdx
+.L2586:
+	addq	$1, %rdx
+	movq	%rdx, 280(%rsp)
+.L2582:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC35(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L2664:
+	cmpq	$0, 256(%rsp)
+	jne	.L2577
+	.p2align 4,,10
+	.p2align 3
+.L2578:
+	cmpq	$4, 120(%rsp)
+	jne	.L2667
+	xorl	%r12d, %r12d
+	leaq	32(%rsp), %r15
+	movl	$4, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L2587:
+	movq	%r14, %rdx
+	leaq	(%r15,%r12,8), %rsi
+	movl	$1, %ecx
+	movq	%rbx, %rdi
+	subq	%r12, %rdx
+	call	_ZN1n7io_ring4waitEPmmm
+	addq	%rax, %r12
+	cmpq	$3, %r12
+	jbe	.L2587
+	cmpq	$0, 120(%rsp)
+	jne	.L2668
+	movq	32(%rsp), %rdx
+	movq	88(%rsp), %rax
+	leaq	(%rdx,%rdx,2), %rdx
+	salq	$4, %rdx
+	cmpq	$4096, 40(%rax,%rdx)
+	jne	.L2669
+	movl	128(%rsp), %edx
+	testl	%edx, %edx
+	js	.L2670
+.L2590:
+	cmpq	$1, 72(%rsp)
+	jbe	.L2591
+	cmpq	$4095, 80(%rsp)
+	jbe	.L2591
+	cmpl	$1, 56(%rax)
+	je	.L2591
+	movdqa	.LC32(%rip), %xmm2
+	movdqa	.LC39(%rip), %xmm0
+	movl	%r13d, 48(%rax)
+	movb	$0, 52(%rax)
+	movl	$1, 56(%rax)
+	movups	%xmm2, 64(%rax)
+	movq	$1, 120(%rsp)
+	movups	%xmm0, 80(%rax)
+	testl	%edx, %edx
+	jns	.L2671
+	movq	280(%rsp), %rax
+	movq	272(%rsp), %r12
+	movq	264(%rsp), %r14
+	cmpq	%r12, %rax
+	je	.L2672
+	movq	$1, (%r14,%rax,8)
+	addq	$1, 280(%rsp)
+.L2600:
+	cmpq	$0, 256(%rsp)
+	je	.L2602
+	cmpq	$2, 72(%rsp)
+	jbe	.L2602
+.L2679:
+	cmpq	$99, 80(%rsp)
+	jbe	.L2602
+	movq	88(%rsp), %rax
+	cmpl	$1, 104(%rax)
+	je	.L2602
+	movdqa	.LC41(%rip), %xmm0
+	addq	$1, 120(%rsp)
+	movl	%r13d, 96(%rax)
+	movups	%xmm0, 112(%rax)
+	movdqa	.LC42(%rip), %xmm0
+	movb	$0, 100(%rax)
+	movl	$1, 104(%rax)
+	movups	%xmm0, 128(%rax)
+	testl	%edx, %edx
+	jns	.L2673
+	movq	280(%rsp), %rdx
+	movq	272(%rsp), %r12
+	movq	264(%rsp), %r14
+	cmpq	%r12, %rdx
+	je	.L2674
+	movq	$2, (%r14,%rdx,8)
+	movq	280(%rsp), %rdx
+.L2610:
+	addq	$1, %rdx
+	movq	%rdx, 280(%rsp)
+	jmp	.L2612
+	.p2align 4,,10
+	.p2align 3
+.L2613:
+	movl	$1, %esi
+	movq	%rbx, %rdi
+	call	_ZN1n7io_ring4waitEPmmm.constprop.0
+	testq	%rax, %rax
+	je	.L2611
+	movq	88(%rsp), %rax
+.L2612:
+	cmpl	$1, 56(%rax)
+	je	.L2613
+	cmpq	$3996, 88(%rax)
+	je	.L2614
+	jmp	.L2611
+	.p2align 4,,10
+	.p2align 3
+.L2616:
+	movl	$1, %esi
+	movq	%rbx, %rdi
+	call	_ZN1n7io_ring4waitEPmmm.constprop.0
+	testq	%rax, %rax
+	je	.L2615
+	movq	88(%rsp), %rax
+.L2614:
+	cmpl	$1, 104(%rax)
+	je	.L2616
+	cmpq	$100, 136(%rax)
+	jne	.L2615
+	movq	80(%rsp), %rdx
+	movq	64(%rsp), %rcx
+	addq	%rdx, %rcx
+	cmpb	$100, (%rcx)
+	jne	.L2618
+	cmpb	$99, 99(%rcx,%rdx)
+	jne	.L2618
+	movl	128(%rsp), %ecx
+	testl	%ecx, %ecx
+	js	.L2675
+.L2619:
+	cmpq	$3, 72(%rsp)
+	jbe	.L2620
+	cmpq	$9, %rdx
+	jbe	.L2620
+	cmpl	$1, 152(%rax)
+	movq	%rax, %rdx
+	je	.L2620
+	movdqa	.LC34(%rip), %xmm0
+	addq	$1, 120(%rsp)
+	movl	$-1, 144(%rax)
+	movups	%xmm0, 160(%rax)
+	pxor	%xmm0, %xmm0
+	movb	$0, 148(%rax)
+	movl	$1, 152(%rax)
+	movups	%xmm0, 176(%rax)
+	testl	%ecx, %ecx
+	jns	.L2676
+	movq	280(%rsp), %rax
+	movq	272(%rsp), %r12
+	movq	264(%rsp), %r14
+	cmpq	%r12, %rax
+	je	.L2677
+	movq	$3, (%r14,%rax,8)
+	movq	280(%rsp), %rcx
+	movl	$1, %eax
+.L2628:
+	addq	$1, %rcx
+	movq	%rcx, 280(%rsp)
+	jmp	.L2630
+	.p2align 4,,10
+	.p2align 3
+.L2631:
+	movl	$1, %esi
+	movq	%rbx, %rdi
+	call	_ZN1n7io_ring4waitEPmmm.constprop.0
+	testq	%rax, %rax
+	je	.L2629
+	movq	88(%rsp), %rdx
+	movl	152(%rdx), %eax
+.L2630:
+	cmpl	$1, %eax
+	je	.L2631
+	cmpq	$-9, 184(%rdx)
+	jne	.L2629
+	movl	%r13d, %edi
+	call	close@PLT
+	movq	path(%rip), %rdi
+	call	remove@PLT
+	movq	%rbx, %rdi
+	call	_ZN1n7io_ringD1Ev
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2661:
+	.cfi_restore_state
+	cmpq	$0, 256(%rsp)
+	jne	.L2566
+.L2567:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC33(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L2662:
+	movq	184(%rsp), %rdx
+	pxor	%xmm0, %xmm0
+	movl	(%rdx), %edi
+	movl	%edi, %edx
+	andl	192(%rsp), %edx
+	salq	$6, %rdx
+	addq	168(%rsp), %rdx
+	movups	%xmm0, (%rdx)
+	movups	%xmm0, 16(%rdx)
+	movups	%xmm0, 32(%rdx)
+	movups	%xmm0, 48(%rdx)
+	cmpb	$0, 132(%rsp)
+	movzbl	4(%rax), %esi
+	jne	.L2678
+	leal	22(%rsi), %ecx
+	movb	%cl, (%rdx)
+.L2570:
+	movl	(%rax), %ecx
+	movq	24(%rax), %rsi
+	movl	%ecx, 4(%rdx)
+	movq	32(%rax), %rcx
+	addq	%rsi, %rcx
+	movq	%rcx, 8(%rdx)
+	movq	80(%rsp), %rcx
+	imulq	%r12, %rcx
+	addq	%rsi, %rcx
+	addq	64(%rsp), %rcx
+	movq	%rcx, 16(%rdx)
+	movq	16(%rax), %rcx
+	leal	1(%rdi), %eax
+	movq	%r12, 32(%rdx)
+	subl	%esi, %ecx
+	movl	%ecx, 24(%rdx)
+	movq	184(%rsp), %rdx
+	movl	%eax, (%rdx)
+	addl	$1, 232(%rsp)
+	movl	128(%rsp), %edx
+	jmp	.L2571
+	.p2align 4,,10
+	.p2align 3
+.L2678:
+	leal	4(%rsi), %ecx
+	movw	%r12w, 40(%rdx)
+	movb	%cl, (%rdx)
+	jmp	.L2570
+	.p2align 4,,10
+	.p2align 3
+.L2659:
+	cmpq	$0, 256(%rsp)
+	jne	.L2564
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC30(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L2670:
+	cmpq	$0, 256(%rsp)
+	jne	.L2590
+.L2591:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC40(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L2665:
+	movq	184(%rsp), %rdx
+	pxor	%xmm0, %xmm0
+	movl	(%rdx), %ecx
+	movl	%ecx, %edx
+	andl	192(%rsp), %edx
+	salq	$6, %rdx
+	addq	168(%rsp), %rdx
+	movups	%xmm0, (%rdx)
+	movups	%xmm0, 16(%rdx)
+	movups	%xmm0, 32(%rdx)
+	movups	%xmm0, 48(%rdx)
+	movzbl	4(%rax), %edi
+	cmpb	$0, 132(%rsp)
+	leal	4(%rdi), %esi
+	jne	.L2581
+	leal	22(%rdi), %esi
+.L2581:
+	movb	%sil, (%rdx)
+	movl	(%rax), %esi
+	addl	$1, %ecx
+	movq	32(%rax), %rdi
+	movl	%esi, 4(%rdx)
+	movq	24(%rax), %rsi
+	movq	16(%rax), %rax
+	addq	%rsi, %rdi
+	movq	%rdi, 8(%rdx)
+	movq	64(%rsp), %rdi
+	subl	%esi, %eax
+	movl	%eax, 24(%rdx)
+	movq	184(%rsp), %rax
+	addq	%rsi, %rdi
+	movq	%rdi, 16(%rdx)
+	movl	%ecx, (%rax)
+	addl	$1, 232(%rsp)
+	jmp	.L2582
+	.p2align 4,,10
+	.p2align 3
+.L2671:
+	movq	184(%rsp), %rdx
+	pxor	%xmm0, %xmm0
+	movl	(%rdx), %ecx
+	movl	%ecx, %edx
+	andl	192(%rsp), %edx
+	salq	$6, %rdx
+	addq	168(%rsp), %rdx
+	movups	%xmm0, (%rdx)
+	movups	%xmm0, 16(%rdx)
+	movups	%xmm0, 32(%rdx)
+	movups	%xmm0, 48(%rdx)
+	cmpb	$0, 132(%rsp)
+	movzbl	52(%rax), %edi
+	je	.L2593
+	leal	4(%rdi), %esi
+	movl	$1, %edi
+	movb	%sil, (%rdx)
+	movw	%di, 40(%rdx)
+.L2594:
+	movl	48(%rax), %esi
+	movq	80(%rax), %rdi
+	movl	%esi, 4(%rdx)
+	movq	72(%rax), %rsi
+	movq	64(%rax), %rax
+	movq	$1, 32(%rdx)
+	addq	%rsi, %rdi
+	movq	%rdi, 8(%rdx)
+	movq	80(%rsp), %rdi
+	subl	%esi, %eax
+	movl	%eax, 24(%rdx)
+	leal	1(%rcx), %eax
+	addq	%rsi, %rdi
+	addq	64(%rsp), %rdi
+	movq	%rdi, 16(%rdx)
+	movq	184(%rsp), %rdx
+	movl	%eax, (%rdx)
+	addl	$1, 232(%rsp)
+	movl	128(%rsp), %edx
+.L2595:
+	testl	%edx, %edx
+	js	.L2600
+	cmpq	$2, 72(%rsp)
+	ja	.L2679
+.L2602:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC43(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L2675:
+	cmpq	$0, 256(%rsp)
+	jne	.L2619
+.L2620:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC47(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L2663:
+	leaq	5(%r15), %rsi
+	movq	288(%rsp), %rdi
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 272(%rsp)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	280(%rsp), %rdx
+	movq	%rax, 264(%rsp)
+	movq	%r12, (%rax,%rdx,8)
+	movq	280(%rsp), %rcx
+	testq	%rcx, %rcx
+	jne	.L2680
+	cmpq	$0, 24(%rsp)
+	je	.L2653
+.L2574:
+	movq	288(%rsp), %rdi
+	movq	24(%rsp), %rsi
+	movl	$8, %ecx
+	leaq	0(,%r15,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	280(%rsp), %rcx
+.L2653:
+	movl	128(%rsp), %edx
+	jmp	.L2575
+	.p2align 4,,10
+	.p2align 3
+.L2676:
+	movq	184(%rsp), %rdx
+	pxor	%xmm0, %xmm0
+	movl	(%rdx), %edi
+	movl	%edi, %edx
+	andl	192(%rsp), %edx
+	salq	$6, %rdx
+	addq	168(%rsp), %rdx
+	movups	%xmm0, (%rdx)
+	movups	%xmm0, 16(%rdx)
+	movups	%xmm0, 32(%rdx)
+	movups	%xmm0, 48(%rdx)
+	cmpb	$0, 132(%rsp)
+	movzbl	148(%rax), %esi
+	je	.L2622
+	leal	4(%rsi), %ecx
+	movb	%cl, (%rdx)
+	movl	$3, %ecx
+	movw	%cx, 40(%rdx)
+.L2623:
+	movl	144(%rax), %ecx
+	movq	168(%rax), %rsi
+	movl	%ecx, 4(%rdx)
+	movq	176(%rax), %rcx
+	addq	%rsi, %rcx
+	movq	%rcx, 8(%rdx)
+	movq	80(%rsp), %rcx
+	leaq	(%rcx,%rcx,2), %rcx
+	addq	%rsi, %rcx
+	addq	64(%rsp), %rcx
+	movq	%rcx, 16(%rdx)
+	movq	160(%rax), %rcx
+	leal	1(%rdi), %eax
+	movq	$3, 32(%rdx)
+	subl	%esi, %ecx
+	movl	%ecx, 24(%rdx)
+	movq	184(%rsp), %rdx
+	movl	%eax, (%rdx)
+	movq	88(%rsp), %rdx
+	addl	$1, 232(%rsp)
+	movl	152(%rdx), %eax
+	jmp	.L2630
+	.p2align 4,,10
+	.p2align 3
+.L2673:
+	movq	184(%rsp), %rdx
+	pxor	%xmm0, %xmm0
+	movl	(%rdx), %edi
+	movl	%edi, %edx
+	andl	192(%rsp), %edx
+	salq	$6, %rdx
+	addq	168(%rsp), %rdx
+	movups	%xmm0, (%rdx)
+	movups	%xmm0, 16(%rdx)
+	movups	%xmm0, 32(%rdx)
+	movups	%xmm0, 48(%rdx)
+	cmpb	$0, 132(%rsp)
+	movzbl	100(%rax), %esi
+	je	.L2604
+	leal	4(%rsi), %ecx
+	movl	$2, %esi
+	movb	%cl, (%rdx)
+	movw	%si, 40(%rdx)
+.L2605:
+	movl	96(%rax), %ecx
+	movq	120(%rax), %rsi
+	movl	%ecx, 4(%rdx)
+	movq	128(%rax), %rcx
+	addq	%rsi, %rcx
+	movq	%rcx, 8(%rdx)
+	movq	80(%rsp), %rcx
+	leaq	(%rsi,%rcx,2), %rcx
+	addq	64(%rsp), %rcx
+	movq	%rcx, 16(%rdx)
+	movq	112(%rax), %rcx
+	leal	1(%rdi), %eax
+	movq	$2, 32(%rdx)
+	subl	%esi, %ecx
+	movl	%ecx, 24(%rdx)
+	movq	184(%rsp), %rdx
+	movl	%eax, (%rdx)
+	addl	$1, 232(%rsp)
+	movq	88(%rsp), %rax
+	jmp	.L2612
+.L2593:
+	leal	22(%rdi), %esi
+	movb	%sil, (%rdx)
+	jmp	.L2594
+.L2622:
+	leal	22(%rsi), %ecx
+	movb	%cl, (%rdx)
+	jmp	.L2623
+.L2604:
+	leal	22(%rsi), %ecx
+	movb	%cl, (%rdx)
+	jmp	.L2605
+.L2680:
+	movq	24(%rsp), %rsi
+	leaq	0(,%rcx,8), %rdx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L2574
+.L2677:
+	leaq	5(%r12), %rsi
+	movq	288(%rsp), %rdi
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 272(%rsp)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	280(%rsp), %rdx
+	movq	%rax, 264(%rsp)
+	movq	$3, (%rax,%rdx,8)
+	movq	280(%rsp), %rcx
+	testq	%rcx, %rcx
+	jne	.L2681
+	testq	%r14, %r14
+	je	.L2657
+.L2627:
+	movq	288(%rsp), %rdi
+	leaq	0(,%r12,8), %rdx
+	movl	$8, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	280(%rsp), %rcx
+.L2657:
+	movq	88(%rsp), %rdx
+	movl	152(%rdx), %eax
+	jmp	.L2628
+.L2674:
+	leaq	5(%r12), %rsi
+	movq	288(%rsp), %rdi
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 272(%rsp)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	280(%rsp), %rdx
+	movq	%rax, 264(%rsp)
+	movq	$2, (%rax,%rdx,8)
+	movq	280(%rsp), %rdx
+	testq	%rdx, %rdx
+	jne	.L2682
+	testq	%r14, %r14
+	je	.L2656
+.L2609:
+	movq	288(%rsp), %rdi
+	leaq	0(,%r12,8), %rdx
+	movl	$8, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	280(%rsp), %rdx
+.L2656:
+	movq	88(%rsp), %rax
+	jmp	.L2610
+.L2672:
+	leaq	5(%r12), %rsi
+	movq	288(%rsp), %rdi
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 272(%rsp)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	280(%rsp), %rdx
+	movq	%rax, 264(%rsp)
+	movq	$1, (%rax,%rdx,8)
+	movq	280(%rsp), %rcx
+	testq	%rcx, %rcx
+	jne	.L2683
+	testq	%r14, %r14
+	je	.L2655
+.L2598:
+	movq	288(%rsp), %rdi
+	leaq	0(,%r12,8), %rdx
+	movl	$8, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	280(%rsp), %rcx
+.L2655:
+	addq	$1, %rcx
+	movl	128(%rsp), %edx
+	movq	%rcx, 280(%rsp)
+	jmp	.L2595
+.L2666:
+	leaq	5(%r12), %rsi
+	movq	288(%rsp), %rdi
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 272(%rsp)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	280(%rsp), %rdx
+	movq	%rax, 264(%rsp)
+	movq	$0, (%rax,%rdx,8)
+	movq	280(%rsp), %rdx
+	testq	%rdx, %rdx
+	jne	.L2684
+	testq	%r13, %r13
+	je	.L2586
+.L2585:
+	movq	288(%rsp), %rdi
+	leaq	0(,%r12,8), %rdx
+	movl	$8, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L2654
+.L2683:
+	leaq	0(,%rcx,8), %rdx
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L2598
+.L2682:
+	salq	$3, %rdx
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L2609
+.L2681:
+	leaq	0(,%rcx,8), %rdx
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L2627
+.L2684:
+	salq	$3, %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L2585
+.L2635:
+	movq	%rax, %r12
+	jmp	.L2633
+.L2629:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC48(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2615:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC45(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2611:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC44(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2618:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC46(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE95:
+.L2633:
+	movq	%rbx, %rdi
+	call	_ZN1n7io_ringD1Ev
+	movq	%r12, %rdi
+.LEHB96:
+	call	_Unwind_Resume@PLT
+.LEHE96:
+.L2667:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC36(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB97:
+	call	__cxa_throw@PLT
+.L2660:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC31(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2669:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC38(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2668:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC37(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE97:
+	.cfi_endproc
+.LFE7028:
+	.section	.gcc_except_table
+.LLSDA7028:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7028-.LLSDACSB7028
+.LLSDACSB7028:
+	.uleb128 .LEHB94-.LFB7028
+	.uleb128 .LEHE94-.LEHB94
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB95-.LFB7028
+	.uleb128 .LEHE95-.LEHB95
+	.uleb128 .L2635-.LFB7028
+	.uleb128 0
+	.uleb128 .LEHB96-.LFB7028
+	.uleb128 .LEHE96-.LEHB96
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB97-.LFB7028
+	.uleb128 .LEHE97-.LEHB97
+	.uleb128 .L2635-.LFB7028
+	.uleb128 0
+.LLSDACSE7028:
+	.section	.text._Z23test_io_ring_read_writeILN1n10io_backendE2EEvv,"axG",@progbits,_Z23test_io_ring_read_writeILN1n10io_backendE2EEvv,comdat
+	.size	_Z23test_io_ring_read_writeILN1n10io_backendE2EEvv, .-_Z23test_io_ring_read_writeILN1n10io_backendE2EEvv
+	.section	.text._Z23test_io_ring_read_writeILN1n10io_backendE0EEvv,"axG",@progbits,_Z23test_io_ring_read_writeILN1n10io_backendE0EEvv,comdat
+	.p2align 4
+	.weak	_Z23test_io_ring_read_writeILN1n10io_backendE0EEvv
+	.type	_Z23test_io_ring_read_writeILN1n10io_backendE0EEvv, @function
+_Z23test_io_ring_read_writeILN1n10io_backendE0EEvv:
+.LFB7027:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7027
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	xorl	%r8d, %r8d
+	xorl	%ecx, %ecx
+	movl	$4096, %edx
+	movl	$4, %esi
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	andq	$-64, %rsp
+	subq	$576, %rsp
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	leaq	64(%rsp), %rbx
+	movq	%rbx, %rdi
+.LEHB98:
+	call	_ZN1n7io_ringC1EmmNS_10io_backendEPNS_11thread_poolE
+.LEHE98:
+	movl	128(%rsp), %r8d
+	testl	%r8d, %r8d
+	js	.L2781
+.L2686:
+	cmpq	$4, 72(%rsp)
+	jne	.L2782
+	movq	path(%rip), %rdi
+	movl	$438, %edx
+	movl	$578, %esi
+	xorl	%eax, %eax
+.LEHB99:
+	call	open@PLT
+	movl	128(%rsp), %edx
+	movl	%eax, %r13d
+	xorl	%r12d, %r12d
+	movabsq	$72340172838076673, %r14
+.L2698:
+	movq	80(%rsp), %rsi
+	leal	97(%r12), %eax
+	movzbl	%al, %eax
+	movq	%rsi, %rcx
+	imulq	%r14, %rax
+	imulq	%r12, %rcx
+	addq	64(%rsp), %rcx
+	leaq	8(%rcx), %rdi
+	andq	$-8, %rdi
+	movq	%rax, (%rcx)
+	movq	%rax, 4088(%rcx)
+	subq	%rdi, %rcx
+	addl	$4096, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	testl	%edx, %edx
+	js	.L2783
+.L2688:
+	cmpq	72(%rsp), %r12
+	jnb	.L2689
+	cmpq	$4095, %rsi
+	jbe	.L2689
+	leaq	(%r12,%r12,2), %rax
+	salq	$4, %rax
+	addq	88(%rsp), %rax
+	cmpl	$1, 8(%rax)
+	je	.L2689
+	movdqa	.LC32(%rip), %xmm1
+	movq	%r12, %rcx
+	movl	%r13d, (%rax)
+	salq	$12, %rcx
+	movb	$1, 4(%rax)
+	movl	$1, 8(%rax)
+	movq	%rcx, 32(%rax)
+	movq	$0, 40(%rax)
+	movups	%xmm1, 16(%rax)
+	addq	$1, 120(%rsp)
+	testl	%edx, %edx
+	jns	.L2784
+	movq	264(%rsp), %rdi
+	movq	280(%rsp), %rax
+	movq	272(%rsp), %r15
+	movq	%rdi, 24(%rsp)
+	cmpq	%r15, %rax
+	je	.L2785
+	movq	%r12, (%rdi,%rax,8)
+	movq	280(%rsp), %rcx
+.L2697:
+	addq	$1, %rcx
+	movq	%rcx, 280(%rsp)
+.L2693:
+	addq	$1, %r12
+	cmpq	$4, %r12
+	jne	.L2698
+	testl	%edx, %edx
+	js	.L2786
+.L2699:
+	cmpq	$0, 72(%rsp)
+	je	.L2700
+	cmpq	$9, 80(%rsp)
+	jbe	.L2700
+	movq	88(%rsp), %rax
+	cmpl	$1, 8(%rax)
+	je	.L2700
+	movq	120(%rsp), %rcx
+	movdqa	.LC34(%rip), %xmm0
+	movl	%r13d, (%rax)
+	movb	$1, 4(%rax)
+	movups	%xmm0, 16(%rax)
+	addq	$1, %rcx
+	pxor	%xmm0, %xmm0
+	movl	$1, 8(%rax)
+	movups	%xmm0, 32(%rax)
+	movq	%rcx, 120(%rsp)
+	testl	%edx, %edx
+	jns	.L2787
+	movq	280(%rsp), %rax
+	movq	272(%rsp), %r12
+	movq	264(%rsp), %r13
+	cmpq	%r12, %rax
+	je	.L2788
+	movq	$0, 0(%r13,%rax,8)
+.L2776:
+	movq	280(%rsp), %rdx
+.L2708:
+	addq	$1, %rdx
+	movq	%rdx, 280(%rsp)
+.L2704:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC35(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L2786:
+	cmpq	$0, 256(%rsp)
+	jne	.L2699
+	.p2align 4,,10
+	.p2align 3
+.L2700:
+	cmpq	$4, 120(%rsp)
+	jne	.L2789
+	xorl	%r12d, %r12d
+	leaq	32(%rsp), %r15
+	movl	$4, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L2709:
+	movq	%r14, %rdx
+	leaq	(%r15,%r12,8), %rsi
+	movl	$1, %ecx
+	movq	%rbx, %rdi
+	subq	%r12, %rdx
+	call	_ZN1n7io_ring4waitEPmmm
+	addq	%rax, %r12
+	cmpq	$3, %r12
+	jbe	.L2709
+	cmpq	$0, 120(%rsp)
+	jne	.L2790
+	movq	32(%rsp), %rdx
+	movq	88(%rsp), %rax
+	leaq	(%rdx,%rdx,2), %rdx
+	salq	$4, %rdx
+	cmpq	$4096, 40(%rax,%rdx)
+	jne	.L2791
+	movl	128(%rsp), %edx
+	testl	%edx, %edx
+	js	.L2792
+.L2712:
+	cmpq	$1, 72(%rsp)
+	jbe	.L2713
+	cmpq	$4095, 80(%rsp)
+	jbe	.L2713
+	cmpl	$1, 56(%rax)
+	je	.L2713
+	movdqa	.LC32(%rip), %xmm2
+	movdqa	.LC39(%rip), %xmm0
+	movl	%r13d, 48(%rax)
+	movb	$0, 52(%rax)
+	movl	$1, 56(%rax)
+	movups	%xmm2, 64(%rax)
+	movq	$1, 120(%rsp)
+	movups	%xmm0, 80(%rax)
+	testl	%edx, %edx
+	jns	.L2793
+	movq	280(%rsp), %rax
+	movq	272(%rsp), %r12
+	movq	264(%rsp), %r14
+	cmpq	%r12, %rax
+	je	.L2794
+	movq	$1, (%r14,%rax,8)
+	addq	$1, 280(%rsp)
+.L2722:
+	cmpq	$0, 256(%rsp)
+	je	.L2724
+	cmpq	$2, 72(%rsp)
+	jbe	.L2724
+.L2801:
+	cmpq	$99, 80(%rsp)
+	jbe	.L2724
+	movq	88(%rsp), %rax
+	cmpl	$1, 104(%rax)
+	je	.L2724
+	movdqa	.LC41(%rip), %xmm0
+	addq	$1, 120(%rsp)
+	movl	%r13d, 96(%rax)
+	movups	%xmm0, 112(%rax)
+	movdqa	.LC42(%rip), %xmm0
+	movb	$0, 100(%rax)
+	movl	$1, 104(%rax)
+	movups	%xmm0, 128(%rax)
+	testl	%edx, %edx
+	jns	.L2795
+	movq	280(%rsp), %rdx
+	movq	272(%rsp), %r12
+	movq	264(%rsp), %r14
+	cmpq	%r12, %rdx
+	je	.L2796
+	movq	$2, (%r14,%rdx,8)
+	movq	280(%rsp), %rdx
+.L2732:
+	addq	$1, %rdx
+	movq	%rdx, 280(%rsp)
+	jmp	.L2734
+	.p2align 4,,10
+	.p2align 3
+.L2735:
+	movl	$1, %esi
+	movq	%rbx, %rdi
+	call	_ZN1n7io_ring4waitEPmmm.constprop.0
+	testq	%rax, %rax
+	je	.L2733
+	movq	88(%rsp), %rax
+.L2734:
+	cmpl	$1, 56(%rax)
+	je	.L2735
+	cmpq	$3996, 88(%rax)
+	je	.L2736
+	jmp	.L2733
+	.p2align 4,,10
+	.p2align 3
+.L2738:
+	movl	$1, %esi
+	movq	%rbx, %rdi
+	call	_ZN1n7io_ring4waitEPmmm.constprop.0
+	testq	%rax, %rax
+	je	.L2737
+	movq	88(%rsp), %rax
+.L2736:
+	cmpl	$1, 104(%rax)
+	je	.L2738
+	cmpq	$100, 136(%rax)
+	jne	.L2737
+	movq	80(%rsp), %rdx
+	movq	64(%rsp), %rcx
+	addq	%rdx, %rcx
+	cmpb	$100, (%rcx)
+	jne	.L2740
+	cmpb	$99, 99(%rcx,%rdx)
+	jne	.L2740
+	movl	128(%rsp), %ecx
+	testl	%ecx, %ecx
+	js	.L2797
+.L2741:
+	cmpq	$3, 72(%rsp)
+	jbe	.L2742
+	cmpq	$9, %rdx
+	jbe	.L2742
+	cmpl	$1, 152(%rax)
+	movq	%rax, %rdx
+	je	.L2742
+	movdqa	.LC34(%rip), %xmm0
+	addq	$1, 120(%rsp)
+	movl	$-1, 144(%rax)
+	movups	%xmm0, 160(%rax)
+	pxor	%xmm0, %xmm0
+	movb	$0, 148(%rax)
+	movl	$1, 152(%rax)
+	movups	%xmm0, 176(%rax)
+	testl	%ecx, %ecx
+	jns	.L2798
+	movq	280(%rsp), %rax
+	movq	272(%rsp), %r12
+	movq	264(%rsp), %r14
+	cmpq	%r12, %rax
+	je	.L2799
+	movq	$3, (%r14,%rax,8)
+	movq	280(%rsp), %rcx
+	movl	$1, %eax
+.L2750:
+	addq	$1, %rcx
+	movq	%rcx, 280(%rsp)
+	jmp	.L2752
+	.p2align 4,,10
+	.p2align 3
+.L2753:
+	movl	$1, %esi
+	movq	%rbx, %rdi
+	call	_ZN1n7io_ring4waitEPmmm.constprop.0
+	testq	%rax, %rax
+	je	.L2751
+	movq	88(%rsp), %rdx
+	movl	152(%rdx), %eax
+.L2752:
+	cmpl	$1, %eax
+	je	.L2753
+	cmpq	$-9, 184(%rdx)
+	jne	.L2751
+	movl	%r13d, %edi
+	call	close@PLT
+	movq	path(%rip), %rdi
+	call	remove@PLT
+	movq	%rbx, %rdi
+	call	_ZN1n7io_ringD1Ev
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2783:
+	.cfi_restore_state
+	cmpq	$0, 256(%rsp)
+	jne	.L2688
+.L2689:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC33(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L2784:
+	movq	184(%rsp), %rdx
+	pxor	%xmm0, %xmm0
+	movl	(%rdx), %edi
+	movl	%edi, %edx
+	andl	192(%rsp), %edx
+	salq	$6, %rdx
+	addq	168(%rsp), %rdx
+	movups	%xmm0, (%rdx)
+	movups	%xmm0, 16(%rdx)
+	movups	%xmm0, 32(%rdx)
+	movups	%xmm0, 48(%rdx)
+	cmpb	$0, 132(%rsp)
+	movzbl	4(%rax), %esi
+	jne	.L2800
+	leal	22(%rsi), %ecx
+	movb	%cl, (%rdx)
+.L2692:
+	movl	(%rax), %ecx
+	movq	24(%rax), %rsi
+	movl	%ecx, 4(%rdx)
+	movq	32(%rax), %rcx
+	addq	%rsi, %rcx
+	movq	%rcx, 8(%rdx)
+	movq	80(%rsp), %rcx
+	imulq	%r12, %rcx
+	addq	%rsi, %rcx
+	addq	64(%rsp), %rcx
+	movq	%rcx, 16(%rdx)
+	movq	16(%rax), %rcx
+	leal	1(%rdi), %eax
+	movq	%r12, 32(%rdx)
+	subl	%esi, %ecx
+	movl	%ecx, 24(%rdx)
+	movq	184(%rsp), %rdx
+	movl	%eax, (%rdx)
+	addl	$1, 232(%rsp)
+	movl	128(%rsp), %edx
+	jmp	.L2693
+	.p2align 4,,10
+	.p2align 3
+.L2800:
+	leal	4(%rsi), %ecx
+	movw	%r12w, 40(%rdx)
+	movb	%cl, (%rdx)
+	jmp	.L2692
+	.p2align 4,,10
+	.p2align 3
+.L2781:
+	cmpq	$0, 256(%rsp)
+	jne	.L2686
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC30(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L2792:
+	cmpq	$0, 256(%rsp)
+	jne	.L2712
+.L2713:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC40(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L2787:
+	movq	184(%rsp), %rdx
+	pxor	%xmm0, %xmm0
+	movl	(%rdx), %ecx
+	movl	%ecx, %edx
+	andl	192(%rsp), %edx
+	salq	$6, %rdx
+	addq	168(%rsp), %rdx
+	movups	%xmm0, (%rdx)
+	movups	%xmm0, 16(%rdx)
+	movups	%xmm0, 32(%rdx)
+	movups	%xmm0, 48(%rdx)
+	movzbl	4(%rax), %edi
+	cmpb	$0, 132(%rsp)
+	leal	4(%rdi), %esi
+	jne	.L2703
+	leal	22(%rdi), %esi
+.L2703:
+	movb	%sil, (%rdx)
+	movl	(%rax), %esi
+	addl	$1, %ecx
+	movq	32(%rax), %rdi
+	movl	%esi, 4(%rdx)
+	movq	24(%rax), %rsi
+	movq	16(%rax), %rax
+	addq	%rsi, %rdi
+	movq	%rdi, 8(%rdx)
+	movq	64(%rsp), %rdi
+	subl	%esi, %eax
+	movl	%eax, 24(%rdx)
+	movq	184(%rsp), %rax
+	addq	%rsi, %rdi
+	movq	%rdi, 16(%rdx)
+	movl	%ecx, (%rax)
+	addl	$1, 232(%rsp)
+	jmp	.L2704
+	.p2align 4,,10
+	.p2align 3
+.L2793:
+	movq	184(%rsp), %rdx
+	pxor	%xmm0, %xmm0
+	movl	(%rdx), %ecx
+	movl	%ecx, %edx
+	andl	192(%rsp), %edx
+	salq	$6, %rdx
+	addq	168(%rsp), %rdx
+	movups	%xmm0, (%rdx)
+	movups	%xmm0, 16(%rdx)
+	movups	%xmm0, 32(%rdx)
+	movups	%xmm0, 48(%rdx)
+	cmpb	$0, 132(%rsp)
+	movzbl	52(%rax), %edi
+	je	.L2715
+	leal	4(%rdi), %esi
+	movl	$1, %edi
+	movb	%sil, (%rdx)
+	movw	%di, 40(%rdx)
+.L2716:
+	movl	48(%rax), %esi
+	movq	80(%rax), %rdi
+	movl	%esi, 4(%rdx)
+	movq	72(%rax), %rsi
+	movq	64(%rax), %rax
+	movq	$1, 32(%rdx)
+	addq	%rsi, %rdi
+	movq	%rdi, 8(%rdx)
+	movq	80(%rsp), %rdi
+	subl	%esi, %eax
+	movl	%eax, 24(%rdx)
+	leal	1(%rcx), %eax
+	addq	%rsi, %rdi
+	addq	64(%rsp), %rdi
+	movq	%rdi, 16(%rdx)
+	movq	184(%rsp), %rdx
+	movl	%eax, (%rdx)
+	addl	$1, 232(%rsp)
+	movl	128(%rsp), %edx
+.L2717:
+	testl	%edx, %edx
+	js	.L2722
+	cmpq	$2, 72(%rsp)
+	ja	.L2801
+.L2724:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC43(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L2797:
+	cmpq	$0, 256(%rsp)
+	jne	.L2741
+.L2742:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC47(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L2785:
+	leaq	5(%r15), %rsi
+	movq	288(%rsp), %rdi
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 272(%rsp)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	280(%rsp), %rdx
+	movq	%rax, 264(%rsp)
+	movq	%r12, (%rax,%rdx,8)
+	movq	280(%rsp), %rcx
+	testq	%rcx, %rcx
+	jne	.L2802
+	cmpq	$0, 24(%rsp)
+	je	.L2775
+.L2696:
+	movq	288(%rsp), %rdi
+	movq	24(%rsp), %rsi
+	movl	$8, %ecx
+	leaq	0(,%r15,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	280(%rsp), %rcx
+.L2775:
+	movl	128(%rsp), %edx
+	jmp	.L2697
+	.p2align 4,,10
+	.p2align 3
+.L2798:
+	movq	184(%rsp), %rdx
+	pxor	%xmm0, %xmm0
+	movl	(%rdx), %edi
+	movl	%edi, %edx
+	andl	192(%rsp), %edx
+	salq	$6, %rdx
+	addq	168(%rsp), %rdx
+	movups	%xmm0, (%rdx)
+	movups	%xmm0, 16(%rdx)
+	movups	%xmm0, 32(%rdx)
+	movups	%xmm0, 48(%rdx)
+	cmpb	$0, 132(%rsp)
+	movzbl	148(%rax), %esi
+	je	.L2744
+	leal	4(%rsi), %ecx
+	movb	%cl, (%rdx)
+	movl	$3, %ecx
+	movw	%cx, 40(%rdx)
+.L2745:
+	movl	144(%rax), %ecx
+	movq	168(%rax), %rsi
+	movl	%ecx, 4(%rdx)
+	movq	176(%rax), %rcx
+	addq	%rsi, %rcx
+	movq	%rcx, 8(%rdx)
+	movq	80(%rsp), %rcx
+	leaq	(%rcx,%rcx,2), %rcx
+	addq	%rsi, %rcx
+	addq	64(%rsp), %rcx
+	movq	%rcx, 16(%rdx)
+	movq	160(%rax), %rcx
+	leal	1(%rdi), %eax
+	movq	$3, 32(%rdx)
+	subl	%esi, %ecx
+	movl	%ecx, 24(%rdx)
+	movq	184(%rsp), %rdx
+	movl	%eax, (%rdx)
+	movq	88(%rsp), %rdx
+	addl	$1, 232(%rsp)
+	movl	152(%rdx), %eax
+	jmp	.L2752
+	.p2align 4,,10
+	.p2align 3
+.L2795:
+	movq	184(%rsp), %rdx
+	pxor	%xmm0, %xmm0
+	movl	(%rdx), %edi
+	movl	%edi, %edx
+	andl	192(%rsp), %edx
+	salq	$6, %rdx
+	addq	168(%rsp), %rdx
+	movups	%xmm0, (%rdx)
+	movups	%xmm0, 16(%rdx)
+	movups	%xmm0, 32(%rdx)
+	movups	%xmm0, 48(%rdx)
+	cmpb	$0, 132(%rsp)
+	movzbl	100(%rax), %esi
+	je	.L2726
+	leal	4(%rsi), %ecx
+	movl	$2, %esi
+	movb	%cl, (%rdx)
+	movw	%si, 40(%rdx)
+.L2727:
+	movl	96(%rax), %ecx
+	movq	120(%rax), %rsi
+	movl	%ecx, 4(%rdx)
+	movq	128(%rax), %rcx
+	addq	%rsi, %rcx
+	movq	%rcx, 8(%rdx)
+	movq	80(%rsp), %rcx
+	leaq	(%rsi,%rcx,2), %rcx
+	addq	64(%rsp), %rcx
+	movq	%rcx, 16(%rdx)
+	movq	112(%rax), %rcx
+	leal	1(%rdi), %eax
+	movq	$2, 32(%rdx)
+	subl	%esi, %ecx
+	movl	%ecx, 24(%rdx)
+	movq	184(%rsp), %rdx
+	movl	%eax, (%rdx)
+	addl	$1, 232(%rsp)
+	movq	88(%rsp), %rax
+	jmp	.L2734
+.L2715:
+	leal	22(%rdi), %esi
+	movb	%sil, (%rdx)
+	jmp	.L2716
+.L2744:
+	leal	22(%rsi), %ecx
+	movb	%cl, (%rdx)
+	jmp	.L2745
+.L2726:
+	leal	22(%rsi), %ecx
+	movb	%cl, (%rdx)
+	jmp	.L2727
+.L2802:
+	movq	24(%rsp), %rsi
+	leaq	0(,%rcx,8), %rdx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L2696
+.L2799:
+	leaq	5(%r12), %rsi
+	movq	288(%rsp), %rdi
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 272(%rsp)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	280(%rsp), %rdx
+	movq	%rax, 264(%rsp)
+	movq	$3, (%rax,%rdx,8)
+	movq	280(%rsp), %rcx
+	testq	%rcx, %rcx
+	jne	.L2803
+	testq	%r14, %r14
+	je	.L2779
+.L2749:
+	movq	288(%rsp), %rdi
+	leaq	0(,%r12,8), %rdx
+	movl	$8, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	280(%rsp), %rcx
+.L2779:
+	movq	88(%rsp), %rdx
+	movl	152(%rdx), %eax
+	jmp	.L2750
+.L2796:
+	leaq	5(%r12), %rsi
+	movq	288(%rsp), %rdi
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 272(%rsp)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	280(%rsp), %rdx
+	movq	%rax, 264(%rsp)
+	movq	$2, (%rax,%rdx,8)
+	movq	280(%rsp), %rdx
+	testq	%rdx, %rdx
+	jne	.L2804
+	testq	%r14, %r14
+	je	.L2778
+.L2731:
+	movq	288(%rsp), %rdi
+	leaq	0(,%r12,8), %rdx
+	movl	$8, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	280(%rsp), %rdx
+.L2778:
+	movq	88(%rsp), %rax
+	jmp	.L2732
+.L2794:
+	leaq	5(%r12), %rsi
+	movq	288(%rsp), %rdi
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 272(%rsp)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	280(%rsp), %rdx
+	movq	%rax, 264(%rsp)
+	movq	$1, (%rax,%rdx,8)
+	movq	280(%rsp), %rcx
+	testq	%rcx, %rcx
+	jne	.L2805
+	testq	%r14, %r14
+	je	.L2777
+.L2720:
+	movq	288(%rsp), %rdi
+	leaq	0(,%r12,8), %rdx
+	movl	$8, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	280(%rsp), %rcx
+.L2777:
+	addq	$1, %rcx
+	movl	128(%rsp), %edx
+	movq	%rcx, 280(%rsp)
+	jmp	.L2717
+.L2788:
+	leaq	5(%r12), %rsi
+	movq	288(%rsp), %rdi
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 272(%rsp)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	280(%rsp), %rdx
+	movq	%rax, 264(%rsp)
+	movq	$0, (%rax,%rdx,8)
+	movq	280(%rsp), %rdx
+	testq	%rdx, %rdx
+	jne	.L2806
+	testq	%r13, %r13
+	je	.L2708
+.L2707:
+	movq	288(%rsp), %rdi
+	leaq	0(,%r12,8), %rdx
+	movl	$8, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L2776
+.L2805:
+	leaq	0(,%rcx,8), %rdx
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L2720
+.L2804:
+	salq	$3, %rdx
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L2731
+.L2803:
+	leaq	0(,%rcx,8), %rdx
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L2749
+.L2806:
+	salq	$3, %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L2707
+.L2757:
+	movq	%rax, %r12
+	jmp	.L2755
+.L2751:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC48(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2737:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC45(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2733:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC44(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2740:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC46(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE99:
+.L2755:
+	movq	%rbx, %rdi
+	call	_ZN1n7io_ringD1Ev
+	movq	%r12, %rdi
+.LEHB100:
+	call	_Unwind_Resume@PLT
+.LEHE100:
+.L2789:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC36(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB101:
+	call	__cxa_throw@PLT
+.L2782:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC31(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2791:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC38(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2790:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC37(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE101:
+	.cfi_endproc
+.LFE7027:
+	.section	.gcc_except_table
+.LLSDA7027:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7027-.LLSDACSB7027
+.LLSDACSB7027:
+	.uleb128 .LEHB98-.LFB7027
+	.uleb128 .LEHE98-.LEHB98
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB99-.LFB7027
+	.uleb128 .LEHE99-.LEHB99
+	.uleb128 .L2757-.LFB7027
+	.uleb128 0
+	.uleb128 .LEHB100-.LFB7027
+	.uleb128 .LEHE100-.LEHB100
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB101-.LFB7027
+	.uleb128 .LEHE101-.LEHB101
+	.uleb128 .L2757-.LFB7027
+	.uleb128 0
+.LLSDACSE7027:
+	.section	.text._Z23test_io_ring_read_writeILN1n10io_backendE0EEvv,"axG",@progbits,_Z23test_io_ring_read_writeILN1n10io_backendE0EEvv,comdat
+	.size	_Z23test_io_ring_read_writeILN1n10io_backendE0EEvv, .-_Z23test_io_ring_read_writeILN1n10io_backendE0EEvv
+	.section	.text._ZN1n14__avx512_countIcEEmPKT_mS1_,"axG",@progbits,_ZN1n14__avx512_countIcEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n14__avx512_countIcEEmPKT_mS1_
+	.type	_ZN1n14__avx512_countIcEEmPKT_mS1_, @function
+_ZN1n14__avx512_countIcEEmPKT_mS1_:
+.LFB7117:
+	.cfi_startproc
+	movl	%edx, %r10d
+	vpbroadcastb	%edx, %zmm5
+	movl	$64, %eax
+	xorl	%r8d, %r8d
+	cmpq	$63, %rsi
+	jbe	.L2833
+	.p2align 4,,10
+	.p2align 3
+.L2811:
+	vpcmpeqb	-64(%rdi,%rax), %zmm5, %k0
+	movq	%rax, %r9
+	addq	$64, %rax
+	kmovq	%k0, %rcx
+	popcntq	%rcx, %rcx
+	addq	%rcx, %r8
+	cmpq	%rax, %rsi
+	jnb	.L2811
+	subq	%r9, %rsi
+	je	.L2807
+	leaq	-1(%rsi), %rax
+	cmpq	$62, %rax
+	jbe	.L2818
+	movq	%rsi, %rcx
+	addq	%r9, %rdi
+	movl	$1, %r9d
+	andq	$-64, %rcx
+	movq	%rdi, %rax
+	vpxor	%xmm7, %xmm7, %xmm7
+	addq	%rdi, %rcx
+	vpbroadcastb	%r9d, %zmm6
+	.p2align 4,,10
+	.p2align 3
+.L2812:
+	vpcmpb	$0, (%rax), %zmm5, %k1
+	addq	$64, %rax
+	vmovdqu8	%zmm6, %zmm0{%k1}{z}
+	vpmovzxbw	%ymm0, %zmm1
+	vextracti64x4	$0x1, %zmm0, %ymm0
+	vpmovzxwd	%ymm1, %zmm4
+	vextracti64x4	$0x1, %zmm1, %ymm1
+	vpmovzxbw	%ymm0, %zmm0
+	vpmovzxdq	%ymm4, %zmm2
+	vextracti64x4	$0x1, %zmm4, %ymm4
+	vpmovzxwd	%ymm1, %zmm1
+	vpmovzxdq	%ymm4, %zmm4
+	vpmovzxwd	%ymm0, %zmm3
+	vextracti64x4	$0x1, %zmm0, %ymm0
+	vpaddq	%zmm4, %zmm2, %zmm2
+	vpmovzxdq	%ymm1, %zmm4
+	vextracti64x4	$0x1, %zmm1, %ymm1
+	vpmovzxdq	%ymm1, %zmm1
+	vpmovzxwd	%ymm0, %zmm0
+	vpaddq	%zmm1, %zmm4, %zmm4
+	vpmovzxdq	%ymm3, %zmm1
+	vextracti64x4	$0x1, %zmm3, %ymm3
+	vpmovzxdq	%ymm3, %zmm3
+	vpaddq	%zmm4, %zmm2, %zmm2
+	vpaddq	%zmm3, %zmm1, %zmm1
+	vpmovzxdq	%ymm0, %zmm3
+	vextracti64x4	$0x1, %zmm0, %ymm0
+	vpaddq	%zmm3, %zmm1, %zmm1
+	vpmovzxdq	%ymm0, %zmm0
+	vpaddq	%zmm1, %zmm2, %zmm2
+	vpaddq	%zmm7, %zmm0, %zmm0
+	vpaddq	%zmm0, %zmm2, %zmm7
+	cmpq	%rax, %rcx
+	jne	.L2812
+	vmovdqa	%ymm7, %ymm3
+	vextracti64x4	$0x1, %zmm7, %ymm7
+	movq	%rsi, %rax
+	vpaddq	%ymm7, %ymm3, %ymm3
+	andq	$-64, %rax
+	vextracti128	$0x1, %ymm3, %xmm1
+	vpaddq	%xmm1, %xmm3, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rcx
+	testb	$63, %sil
+	je	.L2813
+.L2809:
+	movq	%rsi, %r9
+	subq	%rax, %r9
+	leaq	-1(%r9), %r11
+	cmpq	$30, %r11
+	jbe	.L2816
+	vmovd	%edx, %xmm0
+	movl	$1, %edx
+	vpbroadcastb	%xmm0, %ymm0
+	vmovd	%edx, %xmm1
+	movq	%r9, %rdx
+	vpcmpeqb	(%rdi,%rax), %ymm0, %ymm0
+	vpbroadcastb	%xmm1, %ymm1
+	andq	$-32, %rdx
+	addq	%rdx, %rax
+	andl	$31, %r9d
+	vpand	%ymm1, %ymm0, %ymm0
+	vpmovzxbw	%xmm0, %ymm2
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxwd	%xmm2, %ymm4
+	vextracti128	$0x1, %ymm2, %xmm2
+	vpmovzxbw	%xmm0, %ymm0
+	vpmovzxwd	%xmm2, %ymm2
+	vpmovzxwd	%xmm0, %ymm5
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxdq	%xmm2, %ymm1
+	vextracti128	$0x1, %ymm2, %xmm2
+	vpmovzxwd	%xmm0, %ymm0
+	vpmovzxdq	%xmm2, %ymm2
+	vpaddq	%ymm2, %ymm1, %ymm1
+	vpmovzxdq	%xmm4, %ymm2
+	vextracti128	$0x1, %ymm4, %xmm4
+	vpmovzxdq	%xmm4, %ymm4
+	vpaddq	%ymm4, %ymm2, %ymm2
+	vpaddq	%ymm2, %ymm1, %ymm1
+	vpmovzxdq	%xmm5, %ymm2
+	vextracti128	$0x1, %ymm5, %xmm5
+	vpmovzxdq	%xmm5, %ymm5
+	vpaddq	%ymm5, %ymm2, %ymm2
+	vpaddq	%ymm3, %ymm2, %ymm2
+	vpaddq	%ymm2, %ymm1, %ymm1
+	vpmovzxdq	%xmm0, %ymm2
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxdq	%xmm0, %ymm0
+	vpaddq	%ymm0, %ymm2, %ymm0
+	vpaddq	%ymm0, %ymm1, %ymm1
+	vmovdqa	%xmm1, %xmm0
+	vextracti128	$0x1, %ymm1, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rcx
+	je	.L2813
+	.p2align 4,,10
+	.p2align 3
+.L2816:
+	xorl	%edx, %edx
+	cmpb	%r10b, (%rdi,%rax)
+	sete	%dl
+	addq	$1, %rax
+	addq	%rdx, %rcx
+	cmpq	%rsi, %rax
+	jb	.L2816
+.L2813:
+	addq	%rcx, %r8
+.L2807:
+	movq	%r8, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2833:
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	testq	%rsi, %rsi
+	jne	.L2809
+	jmp	.L2807
+.L2818:
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	addq	%r9, %rdi
+	jmp	.L2809
+	.cfi_endproc
+.LFE7117:
+	.size	_ZN1n14__avx512_countIcEEmPKT_mS1_, .-_ZN1n14__avx512_countIcEEmPKT_mS1_
+	.section	.text._ZN1n12__avx2_countIcEEmPKT_mS1_,"axG",@progbits,_ZN1n12__avx2_countIcEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n12__avx2_countIcEEmPKT_mS1_
+	.type	_ZN1n12__avx2_countIcEEmPKT_mS1_, @function
+_ZN1n12__avx2_countIcEEmPKT_mS1_:
+.LFB7118:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	vmovd	%edx, %xmm2
+	movq	%rdi, %r10
+	movl	%edx, %r11d
+	movq	%rsi, %rdi
+	vpbroadcastb	%xmm2, %ymm2
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	.cfi_offset 14, -24
+	.cfi_offset 13, -32
+	.cfi_offset 12, -40
+	.cfi_offset 3, -48
+	cmpq	$31, %rsi
+	jbe	.L2835
+	xorl	%edx, %edx
+	xorl	%r9d, %r9d
+	movl	$32, %r8d
+	xorl	%ebx, %ebx
+	vpxor	%xmm3, %xmm3, %xmm3
+	.p2align 4,,10
+	.p2align 3
+.L2841:
+	movq	%rdi, %r12
+	movl	$255, %ecx
+	subq	%rdx, %r12
+	movq	%r12, %rsi
+	shrq	$5, %rsi
+	cmpq	%rcx, %rsi
+	cmovbe	%rsi, %rcx
+	testq	%rsi, %rsi
+	je	.L2848
+	addq	%r10, %rdx
+	vpxor	%xmm1, %xmm1, %xmm1
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L2837:
+	vpcmpeqb	(%rdx), %ymm2, %ymm0
+	addq	$1, %rax
+	addq	$32, %rdx
+	vpsubb	%ymm0, %ymm1, %ymm0
+	vmovdqa	%ymm0, %ymm1
+	cmpq	%rcx, %rax
+	jb	.L2837
+	subq	$1, %rcx
+	movq	%rdi, %r12
+	salq	$5, %rcx
+	testq	%rsi, %rsi
+	cmove	%rbx, %rcx
+	leaq	(%rcx,%r8), %rdx
+	subq	%rdx, %r12
+	leaq	32(%rdx), %r8
+.L2836:
+	vpsadbw	%ymm3, %ymm0, %ymm0
+	vmovq	%xmm0, %rcx
+	vpextrq	$1, %xmm0, %r14
+	vextracti128	$0x1, %ymm0, %xmm0
+	addq	%r14, %rcx
+	vmovq	%xmm0, %r13
+	vpextrq	$1, %xmm0, %rax
+	addq	%r9, %rcx
+	addq	%r13, %rcx
+	leaq	(%rax,%rcx), %r9
+	cmpq	%r8, %rdi
+	jb	.L2862
+	testq	%rsi, %rsi
+	jne	.L2841
+.L2842:
+	jmp	.L2842
+	.p2align 4,,10
+	.p2align 3
+.L2862:
+	testq	%r12, %r12
+	je	.L2834
+	leaq	-1(%r12), %rax
+	cmpq	$30, %rax
+	jbe	.L2850
+	movq	%r12, %rsi
+	leaq	(%r10,%rdx), %rcx
+	vpxor	%xmm3, %xmm3, %xmm3
+	movl	$1, %edi
+	andq	$-32, %rsi
+	vmovd	%edi, %xmm4
+	movq	%rcx, %rax
+	addq	%rcx, %rsi
+	vpbroadcastb	%xmm4, %ymm4
+	.p2align 4,,10
+	.p2align 3
+.L2844:
+	vpcmpeqb	(%rax), %ymm2, %ymm0
+	addq	$32, %rax
+	vpand	%ymm4, %ymm0, %ymm0
+	vpmovzxbw	%xmm0, %ymm1
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxwd	%xmm1, %ymm7
+	vextracti128	$0x1, %ymm1, %xmm1
+	vpmovzxbw	%xmm0, %ymm0
+	vpmovzxwd	%xmm1, %ymm1
+	vpmovzxwd	%xmm0, %ymm6
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxdq	%xmm1, %ymm5
+	vextracti128	$0x1, %ymm1, %xmm1
+	vpmovzxwd	%xmm0, %ymm0
+	vpmovzxdq	%xmm1, %ymm1
+	vpaddq	%ymm1, %ymm5, %ymm1
+	vpmovzxdq	%xmm7, %ymm5
+	vextracti128	$0x1, %ymm7, %xmm7
+	vpmovzxdq	%xmm7, %ymm7
+	vpaddq	%ymm7, %ymm5, %ymm5
+	vpaddq	%ymm5, %ymm1, %ymm1
+	vpmovzxdq	%xmm6, %ymm5
+	vextracti128	$0x1, %ymm6, %xmm6
+	vpmovzxdq	%xmm6, %ymm6
+	vpaddq	%ymm6, %ymm5, %ymm5
+	vpmovzxdq	%xmm0, %ymm6
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpaddq	%ymm6, %ymm5, %ymm5
+	vpmovzxdq	%xmm0, %ymm0
+	vpaddq	%ymm5, %ymm1, %ymm1
+	vpaddq	%ymm3, %ymm0, %ymm0
+	vpaddq	%ymm0, %ymm1, %ymm3
+	cmpq	%rax, %rsi
+	jne	.L2844
+	vmovdqa	%xmm3, %xmm0
+	vextracti128	$0x1, %ymm3, %xmm3
+	movq	%r12, %r8
+	vpaddq	%xmm3, %xmm0, %xmm3
+	andq	$-32, %r8
+	vpsrldq	$8, %xmm3, %xmm0
+	vpaddq	%xmm0, %xmm3, %xmm0
+	vmovq	%xmm0, %rax
+	testb	$31, %r12b
+	je	.L2845
+.L2843:
+	movq	%r12, %rsi
+	subq	%r8, %rsi
+	leaq	-1(%rsi), %rdi
+	cmpq	$14, %rdi
+	jbe	.L2846
+	vmovd	%r11d, %xmm0
+	movl	$1, %eax
+	movq	%rsi, %rdi
+	vpbroadcastb	%xmm0, %xmm0
+	vmovd	%eax, %xmm1
+	andq	$-16, %rdi
+	vpcmpeqb	(%rcx,%r8), %xmm0, %xmm0
+	vpbroadcastb	%xmm1, %xmm1
+	addq	%rdi, %r8
+	andl	$15, %esi
+	vpand	%xmm1, %xmm0, %xmm0
+	vpmovzxbw	%xmm0, %xmm2
+	vpsrldq	$8, %xmm0, %xmm0
+	vpmovzxwd	%xmm2, %xmm5
+	vpsrldq	$8, %xmm2, %xmm2
+	vpmovzxbw	%xmm0, %xmm0
+	vpmovzxdq	%xmm5, %xmm1
+	vpsrldq	$8, %xmm5, %xmm5
+	vpmovzxwd	%xmm2, %xmm2
+	vpmovzxdq	%xmm5, %xmm5
+	vpmovzxwd	%xmm0, %xmm4
+	vpaddq	%xmm5, %xmm1, %xmm1
+	vpsrldq	$8, %xmm0, %xmm0
+	vpmovzxdq	%xmm2, %xmm5
+	vpsrldq	$8, %xmm2, %xmm2
+	vpmovzxwd	%xmm0, %xmm0
+	vpmovzxdq	%xmm2, %xmm2
+	vpaddq	%xmm2, %xmm5, %xmm2
+	vpaddq	%xmm2, %xmm1, %xmm1
+	vpmovzxdq	%xmm4, %xmm2
+	vpsrldq	$8, %xmm4, %xmm4
+	vpmovzxdq	%xmm4, %xmm4
+	vpaddq	%xmm4, %xmm2, %xmm2
+	vpaddq	%xmm3, %xmm2, %xmm2
+	vpaddq	%xmm2, %xmm1, %xmm1
+	vpmovzxdq	%xmm0, %xmm2
+	vpsrldq	$8, %xmm0, %xmm0
+	vpmovzxdq	%xmm0, %xmm0
+	vpaddq	%xmm0, %xmm2, %xmm0
+	vpaddq	%xmm0, %xmm1, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rax
+	je	.L2845
+.L2846:
+	xorl	%esi, %esi
+	cmpb	%r11b, (%rcx,%r8)
+	sete	%sil
+	addq	%rsi, %rax
+	leaq	1(%r8), %rsi
+	cmpq	%r12, %rsi
+	jnb	.L2845
+	addq	%rsi, %r10
+	cmpb	%r11b, (%r10,%rdx)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+	leaq	2(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2845
+	xorl	%edx, %edx
+	cmpb	%r11b, 2(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	3(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2845
+	xorl	%edx, %edx
+	cmpb	%r11b, 3(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	4(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2845
+	xorl	%edx, %edx
+	cmpb	%r11b, 4(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	5(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2845
+	xorl	%edx, %edx
+	cmpb	%r11b, 5(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	6(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2845
+	xorl	%edx, %edx
+	cmpb	%r11b, 6(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	7(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2845
+	xorl	%edx, %edx
+	cmpb	%r11b, 7(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	8(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2845
+	xorl	%edx, %edx
+	cmpb	%r11b, 8(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	9(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2845
+	xorl	%edx, %edx
+	cmpb	%r11b, 9(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	10(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2845
+	xorl	%edx, %edx
+	cmpb	%r11b, 10(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	11(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2845
+	xorl	%edx, %edx
+	cmpb	%r11b, 11(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	12(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2845
+	xorl	%edx, %edx
+	cmpb	%r11b, 12(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	13(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2845
+	xorl	%edx, %edx
+	cmpb	%r11b, 13(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	14(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2845
+	xorl	%edx, %edx
+	cmpb	%r11b, 14(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	.p2align 4,,10
+	.p2align 3
+.L2845:
+	addq	%rax, %r9
+.L2834:
+	vzeroupper
+	movq	%r9, %rax
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2848:
+	.cfi_restore_state
+	vpxor	%xmm0, %xmm0, %xmm0
+	jmp	.L2836
+.L2835:
+	xorl	%r9d, %r9d
+	testq	%rsi, %rsi
+	je	.L2834
+	movq	%rsi, %r12
+	xorl	%edx, %edx
+	xorl	%r9d, %r9d
+	xorl	%eax, %eax
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%r8d, %r8d
+	movq	%r10, %rcx
+	jmp	.L2843
+.L2850:
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%eax, %eax
+	leaq	(%r10,%rdx), %rcx
+	xorl	%r8d, %r8d
+	jmp	.L2843
+	.cfi_endproc
+.LFE7118:
+	.size	_ZN1n12__avx2_countIcEEmPKT_mS1_, .-_ZN1n12__avx2_countIcEEmPKT_mS1_
+	.section	.rodata._Z16test_ring_readerILN1n10io_backendE2EEvv.str1.8,"aMS",@progbits,1
+	.align 8
+.LC52:
+	.string	"expected true : read_pattern(r, size, 7)"
+	.align 8
+.LC53:
+	.string	"expected equal : expected value : r.error(), actual value : 0"
+	.align 8
+.LC55:
+	.string	"expected equal : expected value : n::count(r.iter(), char(7)), actual value : 3985"
+	.section	.text._Z16test_ring_readerILN1n10io_backendE2EEvv,"axG",@progbits,_Z16test_ring_readerILN1n10io_backendE2EEvv,comdat
+	.p2align 4
+	.weak	_Z16test_ring_readerILN1n10io_backendE2EEvv
+	.type	_Z16test_ring_readerILN1n10io_backendE2EEvv, @function
+_Z16test_ring_readerILN1n10io_backendE2EEvv:
+.LFB7030:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7030
+	leaq	8(%rsp), %r10
+	.cfi_def_cfa 10, 0
+	andq	$-64, %rsp
+	movl	$438, %edx
+	movl	$577, %esi
+	pushq	-8(%r10)
+	xorl	%eax, %eax
+	pushq	%rbp
+	movq	%rsp, %rbp
+	.cfi_escape 0x10,0x6,0x2,0x76,0
+	pushq	%r15
+	pushq	%r14
+	.cfi_escape 0x10,0xf,0x2,0x76,0x78
+	.cfi_escape 0x10,0xe,0x2,0x76,0x70
+	leaq	-4144(%rbp), %r15
+	pushq	%r13
+	.cfi_escape 0x10,0xd,0x2,0x76,0x68
+	xorl	%r13d, %r13d
+	pushq	%r12
+	.cfi_escape 0x10,0xc,0x2,0x76,0x60
+	movl	$4096, %r12d
+	pushq	%r10
+	.cfi_escape 0xf,0x3,0x76,0x58,0x6
+	pushq	%rbx
+	.cfi_escape 0x10,0x3,0x2,0x76,0x50
+	movabsq	$2351776136887273513, %rbx
+	subq	$4352, %rsp
+	movq	path(%rip), %rdi
+.LEHB102:
+	call	open@PLT
+	movl	%eax, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L2866:
+	leaq	0(,%r13,8), %rcx
+	movq	%r15, %rsi
+	leaq	(%r15,%r12), %rdi
+	subq	%r13, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L2864:
+	movq	%rcx, %rax
+	addq	$1, %rsi
+	imulq	%rbx
+	movq	%rcx, %rax
+	sarq	$63, %rax
+	sarq	$5, %rdx
+	subq	%rax, %rdx
+	movq	%rcx, %rax
+	addq	$7, %rcx
+	imulq	$251, %rdx, %rdx
+	subq	%rdx, %rax
+	movb	%al, -1(%rsi)
+	cmpq	%rsi, %rdi
+	jne	.L2864
+	movq	%r12, %rdx
+	movq	%r15, %rsi
+	movl	%r14d, %edi
+	addq	%r12, %r13
+	call	write@PLT
+	cmpq	$1000002, %r13
+	ja	.L2865
+	movl	$1000003, %r12d
+	movl	$4096, %eax
+	subq	%r13, %r12
+	cmpq	%rax, %r12
+	cmova	%rax, %r12
+	jmp	.L2866
+.L2865:
+	movl	%r14d, %edi
+	call	close@PLT
+	movl	$8, %esi
+	movq	%r15, %rdi
+	xorl	%r8d, %r8d
+	movl	$2, %ecx
+	movl	$65536, %edx
+	call	_ZN1n7io_ringC1EmmNS_10io_backendEPNS_11thread_poolE
+.LEHE102:
+	movq	path(%rip), %rdi
+	xorl	%esi, %esi
+	xorl	%eax, %eax
+.LEHB103:
+	call	open@PLT
+	leaq	-4240(%rbp), %rdi
+	xorl	%ecx, %ecx
+	movl	%eax, %edx
+	movq	%r15, %rsi
+	movq	$-1, %r8
+	movl	%eax, -4332(%rbp)
+	movq	%rdi, %rbx
+	movq	%rdi, -4328(%rbp)
+	call	_ZN1n11ring_readerC1ERNS_7io_ringEimm
+.LEHE103:
+	movq	%rbx, %rdi
+.LEHB104:
+	call	_Z12read_patternRN1n11ring_readerEmm.constprop.2
+.LEHE104:
+	testb	%al, %al
+	je	.L3060
+	movl	-4148(%rbp), %eax
+	movl	%eax, -4336(%rbp)
+	testl	%eax, %eax
+	jne	.L3061
+	movq	-4328(%rbp), %rbx
+	movq	%rbx, %rdi
+	call	_ZN1n11ring_readerD1Ev
+	movl	-4332(%rbp), %edx
+	xorl	%ecx, %ecx
+	movq	%r15, %rsi
+	movq	$-1, %r8
+	movq	%rbx, %rdi
+.LEHB105:
+	call	_ZN1n11ring_readerC1ERNS_7io_ringEimm
+.LEHE105:
+	movq	%rbx, %rdi
+.LEHB106:
+	call	_ZN1n11ring_reader6__fillEv
+	testb	%al, %al
+	jne	.L3062
+.L2966:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC55(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L3062:
+	movq	-4160(%rbp), %rdx
+	movq	-4168(%rbp), %rax
+	movl	$4096, %ecx
+	movq	-4176(%rbp), %rbx
+	movq	%rdx, %r13
+	subq	%rax, %r13
+	cmpq	%rcx, %r13
+	cmova	%rcx, %r13
+	addq	%rax, %rbx
+	leaq	(%rax,%r13), %rcx
+	movq	%rcx, -4168(%rbp)
+	cmpq	%rax, %rdx
+	je	.L2966
+	movq	$0, -4312(%rbp)
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L3063
+	.p2align 4,,10
+	.p2align 3
+.L2871:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %r14d
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L3064
+.L2875:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %r14d
+	jge	.L3065
+.L2996:
+	cmpl	$2, %r14d
+	je	.L2888
+.L3069:
+	cmpl	$3, %r14d
+	je	.L2889
+	cmpl	$1, %r14d
+	je	.L3066
+	testq	%r13, %r13
+	je	.L2895
+	leaq	-1(%r13), %rax
+	cmpq	$14, %rax
+	jbe	.L2988
+	movq	%r13, %rdx
+	pxor	%xmm2, %xmm2
+	pxor	%xmm6, %xmm6
+	movq	%rbx, %rax
+	andq	$-16, %rdx
+	pxor	%xmm5, %xmm5
+	pxor	%xmm4, %xmm4
+	addq	%rbx, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L2903:
+	movdqu	(%rax), %xmm1
+	addq	$16, %rax
+	pcmpeqb	.LC54(%rip), %xmm1
+	pand	.LC51(%rip), %xmm1
+	movdqa	%xmm1, %xmm0
+	punpckhbw	%xmm6, %xmm1
+	punpcklbw	%xmm6, %xmm0
+	movdqa	%xmm1, %xmm3
+	punpckhwd	%xmm5, %xmm1
+	movdqa	%xmm0, %xmm7
+	punpckhwd	%xmm5, %xmm0
+	punpcklwd	%xmm5, %xmm3
+	movdqa	%xmm0, %xmm8
+	punpcklwd	%xmm5, %xmm7
+	punpckldq	%xmm4, %xmm0
+	punpckhdq	%xmm4, %xmm8
+	paddq	%xmm8, %xmm0
+	movdqa	%xmm7, %xmm8
+	punpckldq	%xmm4, %xmm7
+	punpckhdq	%xmm4, %xmm8
+	paddq	%xmm8, %xmm7
+	paddq	%xmm7, %xmm0
+	movdqa	%xmm3, %xmm7
+	punpckldq	%xmm4, %xmm3
+	punpckhdq	%xmm4, %xmm7
+	paddq	%xmm7, %xmm3
+	movdqa	%xmm1, %xmm7
+	punpckhdq	%xmm4, %xmm1
+	punpckldq	%xmm4, %xmm7
+	paddq	%xmm1, %xmm2
+	paddq	%xmm7, %xmm3
+	paddq	%xmm3, %xmm0
+	paddq	%xmm0, %xmm2
+	cmpq	%rax, %rdx
+	jne	.L2903
+	movdqa	%xmm2, %xmm0
+	movq	%r13, %rdx
+	psrldq	$8, %xmm0
+	andq	$-16, %rdx
+	paddq	%xmm0, %xmm2
+	movq	%xmm2, %rax
+	testb	$15, %r13b
+	je	.L2904
+.L2902:
+	xorl	%ecx, %ecx
+	cmpb	$7, (%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	1(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L2904
+	xorl	%ecx, %ecx
+	cmpb	$7, 1(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	2(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L2904
+	xorl	%ecx, %ecx
+	cmpb	$7, 2(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	3(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L2904
+	xorl	%ecx, %ecx
+	cmpb	$7, 3(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	4(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L2904
+	xorl	%ecx, %ecx
+	cmpb	$7, 4(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	5(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L2904
+	xorl	%ecx, %ecx
+	cmpb	$7, 5(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	6(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L2904
+	xorl	%ecx, %ecx
+	cmpb	$7, 6(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	7(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L2904
+	xorl	%ecx, %ecx
+	cmpb	$7, 7(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	8(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L2904
+	xorl	%ecx, %ecx
+	cmpb	$7, 8(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	9(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L2904
+	xorl	%ecx, %ecx
+	cmpb	$7, 9(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	10(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L2904
+	xorl	%ecx, %ecx
+	cmpb	$7, 10(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	11(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L2904
+	xorl	%ecx, %ecx
+	cmpb	$7, 11(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	12(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L2904
+	xorl	%ecx, %ecx
+	cmpb	$7, 12(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	13(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L2904
+	xorl	%ecx, %ecx
+	cmpb	$7, 13(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	14(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L2904
+	cmpb	$7, 14(%rbx,%rdx)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+	.p2align 4,,10
+	.p2align 3
+.L2904:
+	addq	%rax, -4312(%rbp)
+.L2895:
+	movq	-4168(%rbp), %rax
+	movq	-4160(%rbp), %r13
+	cmpq	%r13, %rax
+	jb	.L2905
+	cmpb	$0, -4152(%rbp)
+	jne	.L2906
+.L3057:
+	movq	-4192(%rbp), %rbx
+.L2907:
+	movq	-4184(%rbp), %r13
+	cmpq	%rbx, %r13
+	je	.L2959
+	cmpb	$0, -4151(%rbp)
+	jne	.L2959
+	movq	%r13, %rax
+	xorl	%edx, %edx
+	movq	-4224(%rbp), %rbx
+	movq	-4240(%rbp), %r12
+	divq	-4216(%rbp)
+	addq	%rdx, %rbx
+	leaq	(%rbx,%rbx,2), %r14
+	salq	$4, %r14
+	jmp	.L2960
+	.p2align 4,,10
+	.p2align 3
+.L2962:
+	movl	$1, %esi
+	movq	%r12, %rdi
+	call	_ZN1n7io_ring4waitEPmmm.constprop.0
+	testq	%rax, %rax
+	je	.L2990
+.L2960:
+	movq	24(%r12), %rax
+	addq	%r14, %rax
+	cmpl	$1, 8(%rax)
+	je	.L2962
+	movq	40(%rax), %rax
+.L2961:
+	addq	$1, %r13
+	movq	%r13, -4184(%rbp)
+	testq	%rax, %rax
+	jle	.L3067
+	movq	16(%r12), %rdx
+	movb	$1, -4152(%rbp)
+	movq	%rax, %r13
+	movq	%rax, -4160(%rbp)
+	cmpq	%rdx, %rax
+	setb	-4151(%rbp)
+	imulq	%rdx, %rbx
+	addq	(%r12), %rbx
+	xorl	%eax, %eax
+	movq	%rbx, -4176(%rbp)
+.L2965:
+	movl	$4096, %edx
+	cmpq	%rdx, %r13
+	cmova	%rdx, %r13
+	addq	%r13, %rax
+	movq	%rax, -4168(%rbp)
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	jne	.L2871
+.L3063:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2871
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L2978
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L2873:
+	movq	%r12, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2871
+.L3067:
+	movl	%eax, %edx
+	movb	$1, -4151(%rbp)
+	negl	%edx
+	testq	%rax, %rax
+	cmove	-4336(%rbp), %edx
+	movl	%edx, -4148(%rbp)
+	.p2align 4,,10
+	.p2align 3
+.L2959:
+	cmpq	$3985, -4312(%rbp)
+	jne	.L2966
+	movl	-4332(%rbp), %edi
+	call	close@PLT
+	movq	path(%rip), %rdi
+	call	remove@PLT
+	movq	-4328(%rbp), %rdi
+	call	_ZN1n11ring_readerD1Ev
+	movq	%r15, %rdi
+	call	_ZN1n7io_ringD1Ev
+	leaq	-48(%rbp), %rsp
+	popq	%rbx
+	popq	%r10
+	.cfi_remember_state
+	.cfi_def_cfa 10, 0
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	leaq	-8(%r10), %rsp
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2905:
+	.cfi_restore_state
+	movq	-4176(%rbp), %rbx
+	subq	%rax, %r13
+	addq	%rax, %rbx
+	jmp	.L2965
+.L2995:
+	.p2align 4,,10
+	.p2align 3
+.L3065:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L3068
+.L2884:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %r14d
+	cmpl	$2, %r14d
+	jne	.L3069
+.L2888:
+	movl	$7, %edx
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	call	_ZN1n12__avx2_countIcEEmPKT_mS1_
+	addq	%rax, -4312(%rbp)
+	jmp	.L2895
+.L2994:
+	.p2align 4,,10
+	.p2align 3
+.L3064:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2875
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L2980
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L2879:
+	movq	%r12, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2875
+	.p2align 4,,10
+	.p2align 3
+.L2889:
+	movl	$7, %edx
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	call	_ZN1n14__avx512_countIcEEmPKT_mS1_
+	addq	%rax, -4312(%rbp)
+	jmp	.L2895
+	.p2align 4,,10
+	.p2align 3
+.L3066:
+	xorl	%edi, %edi
+	xorl	%eax, %eax
+	movl	$16, %esi
+	xorl	%r8d, %r8d
+	pxor	%xmm3, %xmm3
+	cmpq	$15, %r13
+	jbe	.L3070
+	.p2align 4,,10
+	.p2align 3
+.L2891:
+	movq	%r13, %rcx
+	movl	$255, %edx
+	subq	%rax, %rcx
+	shrq	$4, %rcx
+	cmpq	%rdx, %rcx
+	cmovbe	%rcx, %rdx
+	testq	%rcx, %rcx
+	je	.L2986
+	addq	%rbx, %rax
+	pxor	%xmm1, %xmm1
+	xorl	%r9d, %r9d
+	.p2align 4,,10
+	.p2align 3
+.L2897:
+	movdqu	(%rax), %xmm2
+	movdqa	%xmm1, %xmm0
+	addq	$1, %r9
+	addq	$16, %rax
+	pcmpeqb	.LC54(%rip), %xmm2
+	psubb	%xmm2, %xmm0
+	movdqa	%xmm0, %xmm1
+	cmpq	%rdx, %r9
+	jb	.L2897
+	leaq	-1(%rdx), %rax
+	salq	$4, %rax
+	testq	%rcx, %rcx
+	cmove	%r8, %rax
+	addq	%rsi, %rax
+	leaq	16(%rax), %rsi
+.L2896:
+	psadbw	%xmm3, %xmm0
+	movhlps	%xmm0, %xmm6
+	movq	%xmm0, %r9
+	movq	%xmm6, %rdx
+	addq	%r9, %rdx
+	addq	%rdx, %rdi
+	cmpq	%rsi, %r13
+	jb	.L2898
+	testq	%rcx, %rcx
+	jne	.L2891
+.L2899:
+	jmp	.L2899
+	.p2align 4,,10
+	.p2align 3
+.L2898:
+	subq	%rax, %r13
+	je	.L2893
+	leaq	-1(%r13), %rdx
+	cmpq	$14, %rdx
+	jbe	.L2987
+	movq	%r13, %rcx
+	pxor	%xmm2, %xmm2
+	pxor	%xmm5, %xmm5
+	addq	%rbx, %rax
+	andq	$-16, %rcx
+	pxor	%xmm4, %xmm4
+	pxor	%xmm3, %xmm3
+	movq	%rax, %rdx
+	movdqa	.LC54(%rip), %xmm7
+	movdqa	.LC51(%rip), %xmm6
+	addq	%rax, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L2900:
+	movdqu	(%rdx), %xmm1
+	addq	$16, %rdx
+	pcmpeqb	%xmm7, %xmm1
+	pand	%xmm6, %xmm1
+	movdqa	%xmm1, %xmm0
+	punpckhbw	%xmm5, %xmm1
+	punpcklbw	%xmm5, %xmm0
+	movdqa	%xmm1, %xmm8
+	punpckhwd	%xmm4, %xmm1
+	movdqa	%xmm0, %xmm9
+	punpckhwd	%xmm4, %xmm0
+	punpcklwd	%xmm4, %xmm8
+	movdqa	%xmm0, %xmm10
+	punpcklwd	%xmm4, %xmm9
+	punpckldq	%xmm3, %xmm0
+	punpckhdq	%xmm3, %xmm10
+	paddq	%xmm10, %xmm0
+	movdqa	%xmm9, %xmm10
+	punpckldq	%xmm3, %xmm9
+	punpckhdq	%xmm3, %xmm10
+	paddq	%xmm10, %xmm9
+	paddq	%xmm9, %xmm0
+	movdqa	%xmm8, %xmm9
+	punpckldq	%xmm3, %xmm8
+	punpckhdq	%xmm3, %xmm9
+	paddq	%xmm9, %xmm8
+	movdqa	%xmm1, %xmm9
+	punpckhdq	%xmm3, %xmm1
+	punpckldq	%xmm3, %xmm9
+	paddq	%xmm1, %xmm2
+	paddq	%xmm9, %xmm8
+	paddq	%xmm8, %xmm0
+	paddq	%xmm0, %xmm2
+	cmpq	%rdx, %rcx
+	jne	.L2900
+	movdqa	%xmm2, %xmm0
+	movq	%r13, %rcx
+	psrldq	$8, %xmm0
+	andq	$-16, %rcx
+	paddq	%xmm0, %xmm2
+	movq	%xmm2, %rdx
+	testb	$15, %r13b
+	je	.L2901
+.L2892:
+	xorl	%esi, %esi
+	cmpb	$7, (%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	1(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L2901
+	xorl	%esi, %esi
+	cmpb	$7, 1(%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	2(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L2901
+	xorl	%esi, %esi
+	cmpb	$7, 2(%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	3(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L2901
+	xorl	%esi, %esi
+	cmpb	$7, 3(%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	4(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L2901
+	xorl	%esi, %esi
+	cmpb	$7, 4(%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	5(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L2901
+	xorl	%esi, %esi
+	cmpb	$7, 5(%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	6(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L2901
+	xorl	%esi, %esi
+	cmpb	$7, 6(%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	7(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L2901
+	xorl	%esi, %esi
+	cmpb	$7, 7(%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	8(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L2901
+	xorl	%esi, %esi
+	cmpb	$7, 8(%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	9(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L2901
+	xorl	%esi, %esi
+	cmpb	$7, 9(%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	10(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L2901
+	xorl	%esi, %esi
+	cmpb	$7, 10(%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	11(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L2901
+	xorl	%esi, %esi
+	cmpb	$7, 11(%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	12(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L2901
+	xorl	%esi, %esi
+	cmpb	$7, 12(%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	13(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L2901
+	xorl	%esi, %esi
+	cmpb	$7, 13(%rax,%rcx)
+	sete	%sil
+	addq	$14, %rcx
+	addq	%rsi, %rdx
+	cmpq	%r13, %rcx
+	jnb	.L2901
+	cmpb	$7, (%rax,%rcx)
+	sete	%al
+	movzbl	%al, %eax
+	addq	%rax, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L2901:
+	addq	%rdx, %rdi
+.L2893:
+	addq	%rdi, -4312(%rbp)
+	jmp	.L2895
+	.p2align 4,,10
+	.p2align 3
+.L2906:
+	movq	-4240(%rbp), %rax
+	cmpb	$0, -4151(%rbp)
+	movb	$0, -4152(%rbp)
+	movq	%rax, -4320(%rbp)
+	movl	64(%rax), %esi
+	jne	.L2908
+	movq	-4208(%rbp), %rax
+	movq	-4200(%rbp), %r13
+	testq	%rax, %rax
+	js	.L2909
+	cmpq	%r13, %rax
+	jle	.L2908
+.L2909:
+	movq	-4192(%rbp), %rbx
+	xorl	%edx, %edx
+	movl	-4232(%rbp), %edi
+	movq	%rbx, %rax
+	movq	%rbx, %rcx
+	divq	-4216(%rbp)
+	movq	-4320(%rbp), %rax
+	addq	-4224(%rbp), %rdx
+	movq	%rdx, %r12
+	movq	16(%rax), %rdx
+	testl	%esi, %esi
+	js	.L3071
+	cmpq	8(%rax), %r12
+	jnb	.L2973
+	movq	%rax, %r11
+	leaq	(%r12,%r12,2), %rax
+	salq	$4, %rax
+	addq	24(%r11), %rax
+	cmpl	$1, 8(%rax)
+	je	.L2977
+.L2976:
+	movl	%edi, (%rax)
+	movq	-4320(%rbp), %rdi
+	movb	$0, 4(%rax)
+	movl	$1, 8(%rax)
+	movq	%rdx, 16(%rax)
+	movq	$0, 24(%rax)
+	movq	%r13, 32(%rax)
+	movq	$0, 40(%rax)
+	addq	$1, 56(%rdi)
+	testl	%esi, %esi
+	jns	.L3072
+	movq	216(%rdi), %rax
+	movq	208(%rdi), %r14
+	movq	200(%rdi), %rdi
+	movq	%rdi, -4344(%rbp)
+	cmpq	%r14, %rax
+	je	.L3073
+	movq	%r12, (%rdi,%rax,8)
+	movq	-4320(%rbp), %rax
+	movq	216(%rax), %rax
+.L2920:
+	movq	-4320(%rbp), %rdi
+	addq	$1, %rax
+	movq	%rax, 216(%rdi)
+	movq	%rdi, %rax
+.L2916:
+	addq	16(%rax), %r13
+	addq	$1, %rbx
+	movq	%r13, -4200(%rbp)
+	movq	%rbx, -4192(%rbp)
+.L2908:
+	testl	%esi, %esi
+	jns	.L3074
+.L2912:
+	movq	-4320(%rbp), %rax
+	movq	216(%rax), %rax
+	testq	%rax, %rax
+	je	.L3057
+	movq	-4320(%rbp), %rdi
+	cmpq	56(%rdi), %rax
+	je	.L3075
+.L2927:
+	movq	-4320(%rbp), %rdi
+	call	_ZN1n7io_ring6submitEv.part.0
+	jmp	.L3057
+	.p2align 4,,10
+	.p2align 3
+.L2986:
+	pxor	%xmm0, %xmm0
+	jmp	.L2896
+.L2990:
+	movq	$-5, %rax
+	jmp	.L2961
+.L3068:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2884
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L2982
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L2886:
+	movq	%r12, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2884
+.L3074:
+	movq	-4192(%rbp), %rcx
+.L2977:
+	movq	%rcx, %rbx
+.L2973:
+	movq	-4320(%rbp), %r12
+	movl	168(%r12), %edx
+	testl	%edx, %edx
+	jne	.L2925
+	jmp	.L2907
+	.p2align 4,,10
+	.p2align 3
+.L2922:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2907
+	movl	168(%r12), %edx
+	movl	64(%r12), %esi
+.L2925:
+	subq	$8, %rsp
+	xorl	%ecx, %ecx
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	pushq	$0
+	movl	$426, %edi
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%rdx
+	popq	%rcx
+	testq	%rax, %rax
+	js	.L2922
+	movq	-4320(%rbp), %rdi
+	subl	%eax, 168(%rdi)
+	jmp	.L2907
+.L3071:
+	cmpq	$0, 192(%rax)
+	je	.L2912
+	cmpq	8(%rax), %r12
+	jnb	.L2912
+	movq	-4320(%rbp), %rcx
+	imulq	$48, %r12, %rax
+	addq	24(%rcx), %rax
+	cmpl	$1, 8(%rax)
+	jne	.L2976
+	jmp	.L2912
+	.p2align 4,,10
+	.p2align 3
+.L3070:
+	xorl	%edx, %edx
+	xorl	%ecx, %ecx
+	movq	%rbx, %rax
+	testq	%r13, %r13
+	jne	.L2892
+	jmp	.L2893
+.L3072:
+	movq	120(%rdi), %rdx
+	pxor	%xmm0, %xmm0
+	movl	(%rdx), %esi
+	movl	%esi, %edx
+	andl	128(%rdi), %edx
+	salq	$6, %rdx
+	addq	104(%rdi), %rdx
+	movups	%xmm0, (%rdx)
+	movups	%xmm0, 16(%rdx)
+	movups	%xmm0, 32(%rdx)
+	movups	%xmm0, 48(%rdx)
+	cmpb	$0, 68(%rdi)
+	movzbl	4(%rax), %edi
+	je	.L2914
+	leal	4(%rdi), %ecx
+	movw	%r12w, 40(%rdx)
+	movb	%cl, (%rdx)
+.L2915:
+	movl	(%rax), %ecx
+	movq	24(%rax), %rdi
+	addl	$1, %esi
+	movq	-4320(%rbp), %rbx
+	movl	%ecx, 4(%rdx)
+	movq	32(%rax), %rcx
+	movq	16(%rax), %rax
+	addq	%rdi, %rcx
+	movq	%rcx, 8(%rdx)
+	movq	16(%rbx), %rcx
+	subl	%edi, %eax
+	imulq	%r12, %rcx
+	addq	%rdi, %rcx
+	addq	(%rbx), %rcx
+	movl	%eax, 24(%rdx)
+	movq	%rcx, 16(%rdx)
+	movq	120(%rbx), %rax
+	movq	%r12, 32(%rdx)
+	movl	%esi, (%rax)
+	movq	-4240(%rbp), %rax
+	addl	$1, 168(%rbx)
+	movq	-4200(%rbp), %r13
+	movq	-4192(%rbp), %rbx
+	movq	%rax, -4320(%rbp)
+	movl	64(%rax), %esi
+	jmp	.L2916
+.L3075:
+	movq	192(%rdi), %r14
+	leaq	8(%r14), %r13
+.L2928:
+	movq	0(%r13), %rax
+	testq	%rax, %rax
+	je	.L3076
+.L2951:
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %r12
+	movq	(%r14), %r10
+	testq	%r12, %r12
+	je	.L2929
+	cmpq	(%r12), %r10
+	jne	.L2930
+	movq	128(%r12), %rcx
+	movq	136(%r12), %r9
+	leaq	64(%r12), %rsi
+	leaq	128(%r12), %rdi
+	leaq	-1(%rcx), %rax
+	movq	%rax, 128(%r12)
+	lock orq	$0, (%rsp)
+	movq	64(%r12), %r8
+	cmpq	%r8, %rax
+	jge	.L2931
+	movq	%rcx, 128(%r12)
+.L2932:
+	movq	112(%r10), %rax
+	leaq	112(%r10), %rdx
+	testq	%rax, %rax
+	jne	.L2936
+	movq	16(%r10), %rsi
+.L2941:
+	movq	16(%r12), %rdx
+	movq	%rdx, %rax
+	salq	$13, %rax
+	xorq	%rdx, %rax
+	movq	%rax, %rdx
+	shrq	$7, %rdx
+	xorq	%rax, %rdx
+	movq	%rdx, %rax
+	salq	$17, %rax
+	xorq	%rdx, %rax
+	xorl	%edx, %edx
+	movq	%rax, 16(%r12)
+	divq	%rsi
+	movq	%rdx, %rcx
+.L2937:
+	leaq	(%rsi,%rcx), %rdi
+	testq	%rsi, %rsi
+	jne	.L2946
+	jmp	.L2947
+	.p2align 4,,10
+	.p2align 3
+.L2944:
+	addq	$1, %rcx
+	cmpq	%rcx, %rdi
+	je	.L2947
+.L2946:
+	movq	%rcx, %rax
+	xorl	%edx, %edx
+	divq	%rsi
+	movq	(%r10), %rax
+	movq	(%rax,%rdx,8), %rdx
+	cmpq	%rdx, %r12
+	je	.L2944
+	movq	64(%rdx), %rax
+	leaq	64(%rdx), %r9
+	lock orq	$0, (%rsp)
+	movq	128(%rdx), %r8
+	cmpq	%r8, %rax
+	jge	.L2944
+	movq	136(%rdx), %r8
+	movq	(%r8), %rbx
+	movq	8(%r8), %r8
+	leaq	-1(%rbx), %rdx
+	andq	%rax, %rdx
+	movq	(%r8,%rdx,8), %rbx
+	leaq	1(%rax), %rdx
+	lock cmpxchgq	%rdx, (%r9)
+	jne	.L2944
+.L2934:
+	movq	48(%rbx), %rax
+	movq	%rbx, %rdi
+	call	*(%rax)
+.LEHE106:
+	pxor	%xmm6, %xmm6
+	leaq	-4304(%rbp), %r12
+	movaps	%xmm6, -4304(%rbp)
+	movaps	%xmm6, -4288(%rbp)
+	movaps	%xmm6, -4272(%rbp)
+	movaps	%xmm6, -4256(%rbp)
+	cmpq	%r12, %rbx
+	je	.L2948
+	movq	48(%rbx), %rax
+	testq	%rax, %rax
+	je	.L2948
+	movq	56(%rbx), %rsi
+	movq	%rbx, %rdi
+.LEHB107:
+	call	*16(%rax)
+	movq	$0, 48(%rbx)
+	movq	-4256(%rbp), %rax
+	testq	%rax, %rax
+	je	.L2948
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	call	*8(%rax)
+.LEHE107:
+	movdqa	-4256(%rbp), %xmm5
+	movaps	%xmm5, 48(%rbx)
+.L2948:
+	movq	64(%rbx), %rax
+	lock subq	$1, (%rax)
+	movq	0(%r13), %rax
+	testq	%rax, %rax
+	jne	.L2951
+.L3076:
+	leaq	16(%r14), %r13
+	movq	%r14, -4344(%rbp)
+	movq	%r13, -4352(%rbp)
+	movq	%r13, %r12
+.L2953:
+	movq	8(%r12), %rbx
+	leaq	16(%r12), %r14
+	xorl	%r13d, %r13d
+	testq	%rbx, %rbx
+	je	.L2957
+	.p2align 4,,10
+	.p2align 3
+.L2958:
+	movq	48(%r14), %rcx
+	testq	%rcx, %rcx
+	je	.L2955
+	addq	$1, %r13
+	movq	56(%r14), %rsi
+	movq	%r14, %rdi
+	addq	$80, %r14
+	call	*16(%rcx)
+	cmpq	%r13, %rbx
+	jne	.L2958
+.L2957:
+	movq	$0, 8(%r12)
+	movq	(%r12), %r12
+	testq	%r12, %r12
+	jne	.L2953
+	movq	-4344(%rbp), %r14
+	movq	-4352(%rbp), %r13
+	movq	%r13, 672(%r14)
+	jmp	.L2927
+.L2947:
+	call	sched_yield@PLT
+	jmp	.L2928
+.L2930:
+	movq	112(%r10), %rcx
+	leaq	112(%r10), %rdx
+	testq	%rcx, %rcx
+	jne	.L2989
+	movq	16(%r10), %rsi
+	xorl	%r12d, %r12d
+	jmp	.L2937
+.L2989:
+	xorl	%r12d, %r12d
+.L2936:
+	leaq	32(%r10), %rdi
+	movq	%r10, -4352(%rbp)
+	movq	%rdi, -4344(%rbp)
+	movq	%rdx, -4360(%rbp)
+	call	pthread_mutex_lock@PLT
+	movq	-4352(%rbp), %r10
+	movq	-4344(%rbp), %rdi
+	movq	104(%r10), %rax
+	cmpq	88(%r10), %rax
+	je	.L2938
+	movq	72(%r10), %rcx
+	movq	-4360(%rbp), %rdx
+	leaq	1(%rax), %rsi
+	movq	%rsi, 104(%r10)
+	movq	(%rcx,%rax,8), %rbx
+	lock subq	$1, (%rdx)
+	movq	88(%r10), %rax
+	cmpq	%rax, 104(%r10)
+	jne	.L3058
+	movq	$0, 88(%r10)
+	movq	$0, 104(%r10)
+.L3058:
+	call	pthread_mutex_unlock@PLT
+	jmp	.L2934
+.L2931:
+	movq	(%r9), %rbx
+	movq	8(%r9), %r9
+	leaq	-1(%rbx), %rdx
+	andq	%rax, %rdx
+	movq	(%r9,%rdx,8), %rbx
+	cmpq	%r8, %rax
+	jne	.L2934
+	lock cmpxchgq	%rcx, (%rsi)
+	movq	%rcx, (%rdi)
+	je	.L2934
+	jmp	.L2932
+	.p2align 4,,10
+	.p2align 3
+.L2929:
+	movq	112(%r10), %rcx
+	leaq	112(%r10), %rdx
+	testq	%rcx, %rcx
+	jne	.L2936
+	movq	16(%r10), %rsi
+	jmp	.L2937
+.L2938:
+	movq	%r10, -4344(%rbp)
+	call	pthread_mutex_unlock@PLT
+	movq	-4344(%rbp), %r10
+	movq	16(%r10), %rsi
+	testq	%r12, %r12
+	jne	.L2941
+	xorl	%ecx, %ecx
+	jmp	.L2937
+	.p2align 4,,10
+	.p2align 3
+.L2955:
+	addq	$1, %r13
+	addq	$80, %r14
+	cmpq	%r13, %rbx
+	jne	.L2958
+	jmp	.L2957
+.L2988:
+	xorl	%eax, %eax
+	xorl	%edx, %edx
+	jmp	.L2902
+.L2978:
+	movl	$3, %eax
+	jmp	.L2873
+.L2980:
+	movl	$3, %eax
+	jmp	.L2879
+.L2982:
+	movl	$3, %eax
+	jmp	.L2886
+.L2914:
+	leal	22(%rdi), %ecx
+	movb	%cl, (%rdx)
+	jmp	.L2915
+.L2987:
+	xorl	%edx, %edx
+	xorl	%ecx, %ecx
+	addq	%rbx, %rax
+	jmp	.L2892
+.L3073:
+	movq	-4320(%rbp), %rsi
+	leaq	5(%r14), %rax
+	leaq	(%rax,%rax), %rdx
+	salq	$4, %rax
+	movq	224(%rsi), %rdi
+	movq	%rdx, 208(%rsi)
+	movq	%rax, %rsi
+	movl	$8, %edx
+	movq	(%rdi), %rax
+.LEHB108:
+	call	*16(%rax)
+	movq	-4320(%rbp), %rsi
+	movq	%rax, %rdi
+	movq	%rax, 200(%rsi)
+	movq	216(%rsi), %rax
+	movq	%r12, (%rdi,%rax,8)
+	movq	216(%rsi), %rax
+	testq	%rax, %rax
+	jne	.L3077
+	cmpq	$0, -4344(%rbp)
+	je	.L3078
+.L2919:
+	movq	-4320(%rbp), %r12
+	movq	-4344(%rbp), %rsi
+	movl	$8, %ecx
+	leaq	0(,%r14,8), %rdx
+	movq	224(%r12), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE108:
+	movq	216(%r12), %rax
+	movl	64(%r12), %esi
+	jmp	.L2920
+.L3077:
+	movq	-4344(%rbp), %rsi
+	leaq	0(,%rax,8), %rdx
+	call	memcpy@PLT
+	jmp	.L2919
+.L3078:
+	movl	64(%rsi), %esi
+	jmp	.L2920
+.L2993:
+.L3059:
+	movq	%rax, %rbx
+	jmp	.L2877
+.L2997:
+	movq	%rax, %rbx
+.L2949:
+	movq	-4256(%rbp), %rax
+	testq	%rax, %rax
+	jne	.L3079
+.L2877:
+	movq	-4328(%rbp), %rdi
+	call	_ZN1n11ring_readerD1Ev
+.L2969:
+	movq	%r15, %rdi
+	call	_ZN1n7io_ringD1Ev
+	movq	%rbx, %rdi
+.LEHB109:
+	call	_Unwind_Resume@PLT
+.LEHE109:
+.L3079:
+	movq	-4248(%rbp), %rsi
+	movq	%r12, %rdi
+	call	*16(%rax)
+	jmp	.L2877
+.L2992:
+	jmp	.L3059
+.L2991:
+	movq	%rax, %rbx
+	jmp	.L2969
+.L3061:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC53(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB110:
+	call	__cxa_throw@PLT
+.L3060:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC52(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE110:
+	.cfi_endproc
+.LFE7030:
+	.section	.gcc_except_table
+.LLSDA7030:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7030-.LLSDACSB7030
+.LLSDACSB7030:
+	.uleb128 .LEHB102-.LFB7030
+	.uleb128 .LEHE102-.LEHB102
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB103-.LFB7030
+	.uleb128 .LEHE103-.LEHB103
+	.uleb128 .L2991-.LFB7030
+	.uleb128 0
+	.uleb128 .LEHB104-.LFB7030
+	.uleb128 .LEHE104-.LEHB104
+	.uleb128 .L2992-.LFB7030
+	.uleb128 0
+	.uleb128 .LEHB105-.LFB7030
+	.uleb128 .LEHE105-.LEHB105
+	.uleb128 .L2991-.LFB7030
+	.uleb128 0
+	.uleb128 .LEHB106-.LFB7030
+	.uleb128 .LEHE106-.LEHB106
+	.uleb128 .L2993-.LFB7030
+	.uleb128 0
+	.uleb128 .LEHB107-.LFB7030
+	.uleb128 .LEHE107-.LEHB107
+	.uleb128 .L2997-.LFB7030
+	.uleb128 0
+	.uleb128 .LEHB108-.LFB7030
+	.uleb128 .LEHE108-.LEHB108
+	.uleb128 .L2993-.LFB7030
+	.uleb128 0
+	.uleb128 .LEHB109-.LFB7030
+	.uleb128 .LEHE109-.LEHB109
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB110-.LFB7030
+	.uleb128 .LEHE110-.LEHB110
+	.uleb128 .L2992-.LFB7030
+	.uleb128 0
+.LLSDACSE7030:
+	.section	.text._Z16test_ring_readerILN1n10io_backendE2EEvv,"axG",@progbits,_Z16test_ring_readerILN1n10io_backendE2EEvv,comdat
+	.size	_Z16test_ring_readerILN1n10io_backendE2EEvv, .-_Z16test_ring_readerILN1n10io_backendE2EEvv
+	.section	.text._Z16test_ring_readerILN1n10io_backendE0EEvv,"axG",@progbits,_Z16test_ring_readerILN1n10io_backendE0EEvv,comdat
+	.p2align 4
+	.weak	_Z16test_ring_readerILN1n10io_backendE0EEvv
+	.type	_Z16test_ring_readerILN1n10io_backendE0EEvv, @function
+_Z16test_ring_readerILN1n10io_backendE0EEvv:
+.LFB7029:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7029
+	leaq	8(%rsp), %r10
+	.cfi_def_cfa 10, 0
+	andq	$-64, %rsp
+	movl	$438, %edx
+	movl	$577, %esi
+	pushq	-8(%r10)
+	xorl	%eax, %eax
+	pushq	%rbp
+	movq	%rsp, %rbp
+	.cfi_escape 0x10,0x6,0x2,0x76,0
+	pushq	%r15
+	pushq	%r14
+	.cfi_escape 0x10,0xf,0x2,0x76,0x78
+	.cfi_escape 0x10,0xe,0x2,0x76,0x70
+	leaq	-4144(%rbp), %r15
+	pushq	%r13
+	.cfi_escape 0x10,0xd,0x2,0x76,0x68
+	xorl	%r13d, %r13d
+	pushq	%r12
+	.cfi_escape 0x10,0xc,0x2,0x76,0x60
+	movl	$4096, %r12d
+	pushq	%r10
+	.cfi_escape 0xf,0x3,0x76,0x58,0x6
+	pushq	%rbx
+	.cfi_escape 0x10,0x3,0x2,0x76,0x50
+	movabsq	$2351776136887273513, %rbx
+	subq	$4352, %rsp
+	movq	path(%rip), %rdi
+.LEHB111:
+	call	open@PLT
+	movl	%eax, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L3083:
+	leaq	0(,%r13,8), %rcx
+	movq	%r15, %rsi
+	leaq	(%r15,%r12), %rdi
+	subq	%r13, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L3081:
+	movq	%rcx, %rax
+	addq	$1, %rsi
+	imulq	%rbx
+	movq	%rcx, %rax
+	sarq	$63, %rax
+	sarq	$5, %rdx
+	subq	%rax, %rdx
+	movq	%rcx, %rax
+	addq	$7, %rcx
+	imulq	$251, %rdx, %rdx
+	subq	%rdx, %rax
+	movb	%al, -1(%rsi)
+	cmpq	%rsi, %rdi
+	jne	.L3081
+	movq	%r12, %rdx
+	movq	%r15, %rsi
+	movl	%r14d, %edi
+	addq	%r12, %r13
+	call	write@PLT
+	cmpq	$1000002, %r13
+	ja	.L3082
+	movl	$1000003, %r12d
+	movl	$4096, %eax
+	subq	%r13, %r12
+	cmpq	%rax, %r12
+	cmova	%rax, %r12
+	jmp	.L3083
+.L3082:
+	movl	%r14d, %edi
+	call	close@PLT
+	movl	$8, %esi
+	movq	%r15, %rdi
+	xorl	%r8d, %r8d
+	xorl	%ecx, %ecx
+	movl	$65536, %edx
+	call	_ZN1n7io_ringC1EmmNS_10io_backendEPNS_11thread_poolE
+.LEHE111:
+	movq	path(%rip), %rdi
+	xorl	%esi, %esi
+	xorl	%eax, %eax
+.LEHB112:
+	call	open@PLT
+	leaq	-4240(%rbp), %rdi
+	xorl	%ecx, %ecx
+	movl	%eax, %edx
+	movq	%r15, %rsi
+	movq	$-1, %r8
+	movl	%eax, -4332(%rbp)
+	movq	%rdi, %rbx
+	movq	%rdi, -4328(%rbp)
+	call	_ZN1n11ring_readerC1ERNS_7io_ringEimm
+.LEHE112:
+	movq	%rbx, %rdi
+.LEHB113:
+	call	_Z12read_patternRN1n11ring_readerEmm.constprop.2
+.LEHE113:
+	testb	%al, %al
+	je	.L3277
+	movl	-4148(%rbp), %eax
+	movl	%eax, -4336(%rbp)
+	testl	%eax, %eax
+	jne	.L3278
+	movq	-4328(%rbp), %rbx
+	movq	%rbx, %rdi
+	call	_ZN1n11ring_readerD1Ev
+	movl	-4332(%rbp), %edx
+	xorl	%ecx, %ecx
+	movq	%r15, %rsi
+	movq	$-1, %r8
+	movq	%rbx, %rdi
+.LEHB114:
+	call	_ZN1n11ring_readerC1ERNS_7io_ringEimm
+.LEHE114:
+	movq	%rbx, %rdi
+.LEHB115:
+	call	_ZN1n11ring_reader6__fillEv
+	testb	%al, %al
+	jne	.L3279
+.L3183:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC55(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L3279:
+	movq	-4160(%rbp), %rdx
+	movq	-4168(%rbp), %rax
+	movl	$4096, %ecx
+	movq	-4176(%rbp), %rbx
+	movq	%rdx, %r13
+	subq	%rax, %r13
+	cmpq	%rcx, %r13
+	cmova	%rcx, %r13
+	addq	%rax, %rbx
+	leaq	(%rax,%r13), %rcx
+	movq	%rcx, -4168(%rbp)
+	cmpq	%rax, %rdx
+	je	.L3183
+	movq	$0, -4312(%rbp)
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L3280
+	.p2align 4,,10
+	.p2align 3
+.L3088:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %r14d
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L3281
+.L3092:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %r14d
+	jge	.L3282
+.L3213:
+	cmpl	$2, %r14d
+	je	.L3105
+.L3286:
+	cmpl	$3, %r14d
+	je	.L3106
+	cmpl	$1, %r14d
+	je	.L3283
+	testq	%r13, %r13
+	je	.L3112
+	leaq	-1(%r13), %rax
+	cmpq	$14, %rax
+	jbe	.L3205
+	movq	%r13, %rdx
+	pxor	%xmm2, %xmm2
+	pxor	%xmm6, %xmm6
+	movq	%rbx, %rax
+	andq	$-16, %rdx
+	pxor	%xmm5, %xmm5
+	pxor	%xmm4, %xmm4
+	addq	%rbx, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L3120:
+	movdqu	(%rax), %xmm1
+	addq	$16, %rax
+	pcmpeqb	.LC54(%rip), %xmm1
+	pand	.LC51(%rip), %xmm1
+	movdqa	%xmm1, %xmm0
+	punpckhbw	%xmm6, %xmm1
+	punpcklbw	%xmm6, %xmm0
+	movdqa	%xmm1, %xmm3
+	punpckhwd	%xmm5, %xmm1
+	movdqa	%xmm0, %xmm7
+	punpckhwd	%xmm5, %xmm0
+	punpcklwd	%xmm5, %xmm3
+	movdqa	%xmm0, %xmm8
+	punpcklwd	%xmm5, %xmm7
+	punpckldq	%xmm4, %xmm0
+	punpckhdq	%xmm4, %xmm8
+	paddq	%xmm8, %xmm0
+	movdqa	%xmm7, %xmm8
+	punpckldq	%xmm4, %xmm7
+	punpckhdq	%xmm4, %xmm8
+	paddq	%xmm8, %xmm7
+	paddq	%xmm7, %xmm0
+	movdqa	%xmm3, %xmm7
+	punpckldq	%xmm4, %xmm3
+	punpckhdq	%xmm4, %xmm7
+	paddq	%xmm7, %xmm3
+	movdqa	%xmm1, %xmm7
+	punpckhdq	%xmm4, %xmm1
+	punpckldq	%xmm4, %xmm7
+	paddq	%xmm1, %xmm2
+	paddq	%xmm7, %xmm3
+	paddq	%xmm3, %xmm0
+	paddq	%xmm0, %xmm2
+	cmpq	%rax, %rdx
+	jne	.L3120
+	movdqa	%xmm2, %xmm0
+	movq	%r13, %rdx
+	psrldq	$8, %xmm0
+	andq	$-16, %rdx
+	paddq	%xmm0, %xmm2
+	movq	%xmm2, %rax
+	testb	$15, %r13b
+	je	.L3121
+.L3119:
+	xorl	%ecx, %ecx
+	cmpb	$7, (%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	1(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L3121
+	xorl	%ecx, %ecx
+	cmpb	$7, 1(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	2(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L3121
+	xorl	%ecx, %ecx
+	cmpb	$7, 2(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	3(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L3121
+	xorl	%ecx, %ecx
+	cmpb	$7, 3(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	4(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L3121
+	xorl	%ecx, %ecx
+	cmpb	$7, 4(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	5(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L3121
+	xorl	%ecx, %ecx
+	cmpb	$7, 5(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	6(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L3121
+	xorl	%ecx, %ecx
+	cmpb	$7, 6(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	7(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L3121
+	xorl	%ecx, %ecx
+	cmpb	$7, 7(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	8(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L3121
+	xorl	%ecx, %ecx
+	cmpb	$7, 8(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	9(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L3121
+	xorl	%ecx, %ecx
+	cmpb	$7, 9(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	10(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L3121
+	xorl	%ecx, %ecx
+	cmpb	$7, 10(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	11(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L3121
+	xorl	%ecx, %ecx
+	cmpb	$7, 11(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	12(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L3121
+	xorl	%ecx, %ecx
+	cmpb	$7, 12(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	13(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L3121
+	xorl	%ecx, %ecx
+	cmpb	$7, 13(%rbx,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	14(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L3121
+	cmpb	$7, 14(%rbx,%rdx)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+	.p2align 4,,10
+	.p2align 3
+.L3121:
+	addq	%rax, -4312(%rbp)
+.L3112:
+	movq	-4168(%rbp), %rax
+	movq	-4160(%rbp), %r13
+	cmpq	%r13, %rax
+	jb	.L3122
+	cmpb	$0, -4152(%rbp)
+	jne	.L3123
+.L3274:
+	movq	-4192(%rbp), %rbx
+.L3124:
+	movq	-4184(%rbp), %r13
+	cmpq	%rbx, %r13
+	je	.L3176
+	cmpb	$0, -4151(%rbp)
+	jne	.L3176
+	movq	%r13, %rax
+	xorl	%edx, %edx
+	movq	-4224(%rbp), %rbx
+	movq	-4240(%rbp), %r12
+	divq	-4216(%rbp)
+	addq	%rdx, %rbx
+	leaq	(%rbx,%rbx,2), %r14
+	salq	$4, %r14
+	jmp	.L3177
+	.p2align 4,,10
+	.p2align 3
+.L3179:
+	movl	$1, %esi
+	movq	%r12, %rdi
+	call	_ZN1n7io_ring4waitEPmmm.constprop.0
+	testq	%rax, %rax
+	je	.L3207
+.L3177:
+	movq	24(%r12), %rax
+	addq	%r14, %rax
+	cmpl	$1, 8(%rax)
+	je	.L3179
+	movq	40(%rax), %rax
+.L3178:
+	addq	$1, %r13
+	movq	%r13, -4184(%rbp)
+	testq	%rax, %rax
+	jle	.L3284
+	movq	16(%r12), %rdx
+	movb	$1, -4152(%rbp)
+	movq	%rax, %r13
+	movq	%rax, -4160(%rbp)
+	cmpq	%rdx, %rax
+	setb	-4151(%rbp)
+	imulq	%rdx, %rbx
+	addq	(%r12), %rbx
+	xorl	%eax, %eax
+	movq	%rbx, -4176(%rbp)
+.L3182:
+	movl	$4096, %edx
+	cmpq	%rdx, %r13
+	cmova	%rdx, %r13
+	addq	%r13, %rax
+	movq	%rax, -4168(%rbp)
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	jne	.L3088
+.L3280:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3088
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L3195
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L3090:
+	movq	%r12, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3088
+.L3284:
+	movl	%eax, %edx
+	movb	$1, -4151(%rbp)
+	negl	%edx
+	testq	%rax, %rax
+	cmove	-4336(%rbp), %edx
+	movl	%edx, -4148(%rbp)
+	.p2align 4,,10
+	.p2align 3
+.L3176:
+	cmpq	$3985, -4312(%rbp)
+	jne	.L3183
+	movl	-4332(%rbp), %edi
+	call	close@PLT
+	movq	path(%rip), %rdi
+	call	remove@PLT
+	movq	-4328(%rbp), %rdi
+	call	_ZN1n11ring_readerD1Ev
+	movq	%r15, %rdi
+	call	_ZN1n7io_ringD1Ev
+	leaq	-48(%rbp), %rsp
+	popq	%rbx
+	popq	%r10
+	.cfi_remember_state
+	.cfi_def_cfa 10, 0
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	leaq	-8(%r10), %rsp
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L3122:
+	.cfi_restore_state
+	movq	-4176(%rbp), %rbx
+	subq	%rax, %r13
+	addq	%rax, %rbx
+	jmp	.L3182
+.L3212:
+	.p2align 4,,10
+	.p2align 3
+.L3282:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L3285
+.L3101:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %r14d
+	cmpl	$2, %r14d
+	jne	.L3286
+.L3105:
+	movl	$7, %edx
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	call	_ZN1n12__avx2_countIcEEmPKT_mS1_
+	addq	%rax, -4312(%rbp)
+	jmp	.L3112
+.L3211:
+	.p2align 4,,10
+	.p2align 3
+.L3281:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3092
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L3197
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L3096:
+	movq	%r12, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3092
+	.p2align 4,,10
+	.p2align 3
+.L3106:
+	movl	$7, %edx
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	call	_ZN1n14__avx512_countIcEEmPKT_mS1_
+	addq	%rax, -4312(%rbp)
+	jmp	.L3112
+	.p2align 4,,10
+	.p2align 3
+.L3283:
+	xorl	%edi, %edi
+	xorl	%eax, %eax
+	movl	$16, %esi
+	xorl	%r8d, %r8d
+	pxor	%xmm3, %xmm3
+	cmpq	$15, %r13
+	jbe	.L3287
+	.p2align 4,,10
+	.p2align 3
+.L3108:
+	movq	%r13, %rcx
+	movl	$255, %edx
+	subq	%rax, %rcx
+	shrq	$4, %rcx
+	cmpq	%rdx, %rcx
+	cmovbe	%rcx, %rdx
+	testq	%rcx, %rcx
+	je	.L3203
+	addq	%rbx, %rax
+	pxor	%xmm1, %xmm1
+	xorl	%r9d, %r9d
+	.p2align 4,,10
+	.p2align 3
+.L3114:
+	movdqu	(%rax), %xmm2
+	movdqa	%xmm1, %xmm0
+	addq	$1, %r9
+	addq	$16, %rax
+	pcmpeqb	.LC54(%rip), %xmm2
+	psubb	%xmm2, %xmm0
+	movdqa	%xmm0, %xmm1
+	cmpq	%rdx, %r9
+	jb	.L3114
+	leaq	-1(%rdx), %rax
+	salq	$4, %rax
+	testq	%rcx, %rcx
+	cmove	%r8, %rax
+	addq	%rsi, %rax
+	leaq	16(%rax), %rsi
+.L3113:
+	psadbw	%xmm3, %xmm0
+	movhlps	%xmm0, %xmm6
+	movq	%xmm0, %r9
+	movq	%xmm6, %rdx
+	addq	%r9, %rdx
+	addq	%rdx, %rdi
+	cmpq	%rsi, %r13
+	jb	.L3115
+	testq	%rcx, %rcx
+	jne	.L3108
+.L3116:
+	jmp	.L3116
+	.p2align 4,,10
+	.p2align 3
+.L3115:
+	subq	%rax, %r13
+	je	.L3110
+	leaq	-1(%r13), %rdx
+	cmpq	$14, %rdx
+	jbe	.L3204
+	movq	%r13, %rcx
+	pxor	%xmm2, %xmm2
+	pxor	%xmm5, %xmm5
+	addq	%rbx, %rax
+	andq	$-16, %rcx
+	pxor	%xmm4, %xmm4
+	pxor	%xmm3, %xmm3
+	movq	%rax, %rdx
+	movdqa	.LC54(%rip), %xmm7
+	movdqa	.LC51(%rip), %xmm6
+	addq	%rax, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L3117:
+	movdqu	(%rdx), %xmm1
+	addq	$16, %rdx
+	pcmpeqb	%xmm7, %xmm1
+	pand	%xmm6, %xmm1
+	movdqa	%xmm1, %xmm0
+	punpckhbw	%xmm5, %xmm1
+	punpcklbw	%xmm5, %xmm0
+	movdqa	%xmm1, %xmm8
+	punpckhwd	%xmm4, %xmm1
+	movdqa	%xmm0, %xmm9
+	punpckhwd	%xmm4, %xmm0
+	punpcklwd	%xmm4, %xmm8
+	movdqa	%xmm0, %xmm10
+	punpcklwd	%xmm4, %xmm9
+	punpckldq	%xmm3, %xmm0
+	punpckhdq	%xmm3, %xmm10
+	paddq	%xmm10, %xmm0
+	movdqa	%xmm9, %xmm10
+	punpckldq	%xmm3, %xmm9
+	punpckhdq	%xmm3, %xmm10
+	paddq	%xmm10, %xmm9
+	paddq	%xmm9, %xmm0
+	movdqa	%xmm8, %xmm9
+	punpckldq	%xmm3, %xmm8
+	punpckhdq	%xmm3, %xmm9
+	paddq	%xmm9, %xmm8
+	movdqa	%xmm1, %xmm9
+	punpckhdq	%xmm3, %xmm1
+	punpckldq	%xmm3, %xmm9
+	paddq	%xmm1, %xmm2
+	paddq	%xmm9, %xmm8
+	paddq	%xmm8, %xmm0
+	paddq	%xmm0, %xmm2
+	cmpq	%rdx, %rcx
+	jne	.L3117
+	movdqa	%xmm2, %xmm0
+	movq	%r13, %rcx
+	psrldq	$8, %xmm0
+	andq	$-16, %rcx
+	paddq	%xmm0, %xmm2
+	movq	%xmm2, %rdx
+	testb	$15, %r13b
+	je	.L3118
+.L3109:
+	xorl	%esi, %esi
+	cmpb	$7, (%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	1(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L3118
+	xorl	%esi, %esi
+	cmpb	$7, 1(%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	2(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L3118
+	xorl	%esi, %esi
+	cmpb	$7, 2(%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	3(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L3118
+	xorl	%esi, %esi
+	cmpb	$7, 3(%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	4(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L3118
+	xorl	%esi, %esi
+	cmpb	$7, 4(%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	5(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L3118
+	xorl	%esi, %esi
+	cmpb	$7, 5(%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	6(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L3118
+	xorl	%esi, %esi
+	cmpb	$7, 6(%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	7(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L3118
+	xorl	%esi, %esi
+	cmpb	$7, 7(%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	8(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L3118
+	xorl	%esi, %esi
+	cmpb	$7, 8(%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	9(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L3118
+	xorl	%esi, %esi
+	cmpb	$7, 9(%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	10(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L3118
+	xorl	%esi, %esi
+	cmpb	$7, 10(%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	11(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L3118
+	xorl	%esi, %esi
+	cmpb	$7, 11(%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	12(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L3118
+	xorl	%esi, %esi
+	cmpb	$7, 12(%rax,%rcx)
+	sete	%sil
+	addq	%rsi, %rdx
+	leaq	13(%rcx), %rsi
+	cmpq	%r13, %rsi
+	jnb	.L3118
+	xorl	%esi, %esi
+	cmpb	$7, 13(%rax,%rcx)
+	sete	%sil
+	addq	$14, %rcx
+	addq	%rsi, %rdx
+	cmpq	%r13, %rcx
+	jnb	.L3118
+	cmpb	$7, (%rax,%rcx)
+	sete	%al
+	movzbl	%al, %eax
+	addq	%rax, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L3118:
+	addq	%rdx, %rdi
+.L3110:
+	addq	%rdi, -4312(%rbp)
+	jmp	.L3112
+	.p2align 4,,10
+	.p2align 3
+.L3123:
+	movq	-4240(%rbp), %rax
+	cmpb	$0, -4151(%rbp)
+	movb	$0, -4152(%rbp)
+	movq	%rax, -4320(%rbp)
+	movl	64(%rax), %esi
+	jne	.L3125
+	movq	-4208(%rbp), %rax
+	movq	-4200(%rbp), %r13
+	testq	%rax, %rax
+	js	.L3126
+	cmpq	%r13, %rax
+	jle	.L3125
+.L3126:
+	movq	-4192(%rbp), %rbx
+	xorl	%edx, %edx
+	movl	-4232(%rbp), %edi
+	movq	%rbx, %rax
+	movq	%rbx, %rcx
+	divq	-4216(%rbp)
+	movq	-4320(%rbp), %rax
+	addq	-4224(%rbp), %rdx
+	movq	%rdx, %r12
+	movq	16(%rax), %rdx
+	testl	%esi, %esi
+	js	.L3288
+	cmpq	8(%rax), %r12
+	jnb	.L3190
+	movq	%rax, %r11
+	leaq	(%r12,%r12,2), %rax
+	salq	$4, %rax
+	addq	24(%r11), %rax
+	cmpl	$1, 8(%rax)
+	je	.L3194
+.L3193:
+	movl	%edi, (%rax)
+	movq	-4320(%rbp), %rdi
+	movb	$0, 4(%rax)
+	movl	$1, 8(%rax)
+	movq	%rdx, 16(%rax)
+	movq	$0, 24(%rax)
+	movq	%r13, 32(%rax)
+	movq	$0, 40(%rax)
+	addq	$1, 56(%rdi)
+	testl	%esi, %esi
+	jns	.L3289
+	movq	216(%rdi), %rax
+	movq	208(%rdi), %r14
+	movq	200(%rdi), %rdi
+	movq	%rdi, -4344(%rbp)
+	cmpq	%r14, %rax
+	je	.L3290
+	movq	%r12, (%rdi,%rax,8)
+	movq	-4320(%rbp), %rax
+	movq	216(%rax), %rax
+.L3137:
+	movq	-4320(%rbp), %rdi
+	addq	$1, %rax
+	movq	%rax, 216(%rdi)
+	movq	%rdi, %rax
+.L3133:
+	addq	16(%rax), %r13
+	addq	$1, %rbx
+	movq	%r13, -4200(%rbp)
+	movq	%rbx, -4192(%rbp)
+.L3125:
+	testl	%esi, %esi
+	jns	.L3291
+.L3129:
+	movq	-4320(%rbp), %rax
+	movq	216(%rax), %rax
+	testq	%rax, %rax
+	je	.L3274
+	movq	-4320(%rbp), %rdi
+	cmpq	56(%rdi), %rax
+	je	.L3292
+.L3144:
+	movq	-4320(%rbp), %rdi
+	call	_ZN1n7io_ring6submitEv.part.0
+	jmp	.L3274
+	.p2align 4,,10
+	.p2align 3
+.L3203:
+	pxor	%xmm0, %xmm0
+	jmp	.L3113
+.L3207:
+	movq	$-5, %rax
+	jmp	.L3178
+.L3285:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3101
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L3199
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L3103:
+	movq	%r12, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3101
+.L3291:
+	movq	-4192(%rbp), %rcx
+.L3194:
+	movq	%rcx, %rbx
+.L3190:
+	movq	-4320(%rbp), %r12
+	movl	168(%r12), %edx
+	testl	%edx, %edx
+	jne	.L3142
+	jmp	.L3124
+	.p2align 4,,10
+	.p2align 3
+.L3139:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L3124
+	movl	168(%r12), %edx
+	movl	64(%r12), %esi
+.L3142:
+	subq	$8, %rsp
+	xorl	%ecx, %ecx
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	pushq	$0
+	movl	$426, %edi
+	xorl	%eax, %eax
+	call	syscall@PLT
+	popq	%rdx
+	popq	%rcx
+	testq	%rax, %rax
+	js	.L3139
+	movq	-4320(%rbp), %rdi
+	subl	%eax, 168(%rdi)
+	jmp	.L3124
+.L3288:
+	cmpq	$0, 192(%rax)
+	je	.L3129
+	cmpq	8(%rax), %r12
+	jnb	.L3129
+	movq	-4320(%rbp), %rcx
+	imulq	$48, %r12, %rax
+	addq	24(%rcx), %rax
+	cmpl	$1, 8(%rax)
+	jne	.L3193
+	jmp	.L3129
+	.p2align 4,,10
+	.p2align 3
+.L3287:
+	xorl	%edx, %edx
+	xorl	%ecx, %ecx
+	movq	%rbx, %rax
+	testq	%r13, %r13
+	jne	.L3109
+	jmp	.L3110
+.L3289:
+	movq	120(%rdi), %rdx
+	pxor	%xmm0, %xmm0
+	movl	(%rdx), %esi
+	movl	%esi, %edx
+	andl	128(%rdi), %edx
+	salq	$6, %rdx
+	addq	104(%rdi), %rdx
+	movups	%xmm0, (%rdx)
+	movups	%xmm0, 16(%rdx)
+	movups	%xmm0, 32(%rdx)
+	movups	%xmm0, 48(%rdx)
+	cmpb	$0, 68(%rdi)
+	movzbl	4(%rax), %edi
+	je	.L3131
+	leal	4(%rdi), %ecx
+	movw	%r12w, 40(%rdx)
+	movb	%cl, (%rdx)
+.L3132:
+	movl	(%rax), %ecx
+	movq	24(%rax), %rdi
+	addl	$1, %esi
+	movq	-4320(%rbp), %rbx
+	movl	%ecx, 4(%rdx)
+	movq	32(%rax), %rcx
+	movq	16(%rax), %rax
+	addq	%rdi, %rcx
+	movq	%rcx, 8(%rdx)
+	movq	16(%rbx), %rcx
+	subl	%edi, %eax
+	imulq	%r12, %rcx
+	addq	%rdi, %rcx
+	addq	(%rbx), %rcx
+	movl	%eax, 24(%rdx)
+	movq	%rcx, 16(%rdx)
+	movq	120(%rbx), %rax
+	movq	%r12, 32(%rdx)
+	movl	%esi, (%rax)
+	movq	-4240(%rbp), %rax
+	addl	$1, 168(%rbx)
+	movq	-4200(%rbp), %r13
+	movq	-4192(%rbp), %rbx
+	movq	%rax, -4320(%rbp)
+	movl	64(%rax), %esi
+	jmp	.L3133
+.L3292:
+	movq	192(%rdi), %r14
+	leaq	8(%r14), %r13
+.L3145:
+	movq	0(%r13), %rax
+	testq	%rax, %rax
+	je	.L3293
+.L3168:
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %r12
+	movq	(%r14), %r10
+	testq	%r12, %r12
+	je	.L3146
+	cmpq	(%r12), %r10
+	jne	.L3147
+	movq	128(%r12), %rcx
+	movq	136(%r12), %r9
+	leaq	64(%r12), %rsi
+	leaq	128(%r12), %rdi
+	leaq	-1(%rcx), %rax
+	movq	%rax, 128(%r12)
+	lock orq	$0, (%rsp)
+	movq	64(%r12), %r8
+	cmpq	%r8, %rax
+	jge	.L3148
+	movq	%rcx, 128(%r12)
+.L3149:
+	movq	112(%r10), %rax
+	leaq	112(%r10), %rdx
+	testq	%rax, %rax
+	jne	.L3153
+	movq	16(%r10), %rsi
+.L3158:
+	movq	16(%r12), %rdx
+	movq	%rdx, %rax
+	salq	$13, %rax
+	xorq	%rdx, %rax
+	movq	%rax, %rdx
+	shrq	$7, %rdx
+	xorq	%rax, %rdx
+	movq	%rdx, %rax
+	salq	$17, %rax
+	xorq	%rdx, %rax
+	xorl	%edx, %edx
+	movq	%rax, 16(%r12)
+	divq	%rsi
+	movq	%rdx, %rcx
+.L3154:
+	leaq	(%rsi,%rcx), %rdi
+	testq	%rsi, %rsi
+	jne	.L3163
+	jmp	.L3164
+	.p2align 4,,10
+	.p2align 3
+.L3161:
+	addq	$1, %rcx
+	cmpq	%rcx, %rdi
+	je	.L3164
+.L3163:
+	movq	%rcx, %rax
+	xorl	%edx, %edx
+	divq	%rsi
+	movq	(%r10), %rax
+	movq	(%rax,%rdx,8), %rdx
+	cmpq	%rdx, %r12
+	je	.L3161
+	movq	64(%rdx), %rax
+	leaq	64(%rdx), %r9
+	lock orq	$0, (%rsp)
+	movq	128(%rdx), %r8
+	cmpq	%r8, %rax
+	jge	.L3161
+	movq	136(%rdx), %r8
+	movq	(%r8), %rbx
+	movq	8(%r8), %r8
+	leaq	-1(%rbx), %rdx
+	andq	%rax, %rdx
+	movq	(%r8,%rdx,8), %rbx
+	leaq	1(%rax), %rdx
+	lock cmpxchgq	%rdx, (%r9)
+	jne	.L3161
+.L3151:
+	movq	48(%rbx), %rax
+	movq	%rbx, %rdi
+	call	*(%rax)
+.LEHE115:
+	pxor	%xmm6, %xmm6
+	leaq	-4304(%rbp), %r12
+	movaps	%xmm6, -4304(%rbp)
+	movaps	%xmm6, -4288(%rbp)
+	movaps	%xmm6, -4272(%rbp)
+	movaps	%xmm6, -4256(%rbp)
+	cmpq	%r12, %rbx
+	je	.L3165
+	movq	48(%rbx), %rax
+	testq	%rax, %rax
+	je	.L3165
+	movq	56(%rbx), %rsi
+	movq	%rbx, %rdi
+.LEHB116:
+	call	*16(%rax)
+	movq	$0, 48(%rbx)
+	movq	-4256(%rbp), %rax
+	testq	%rax, %rax
+	je	.L3165
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	call	*8(%rax)
+.LEHE116:
+	movdqa	-4256(%rbp), %xmm5
+	movaps	%xmm5, 48(%rbx)
+.L3165:
+	movq	64(%rbx), %rax
+	lock subq	$1, (%rax)
+	movq	0(%r13), %rax
+	testq	%rax, %rax
+	jne	.L3168
+.L3293:
+	leaq	16(%r14), %r13
+	movq	%r14, -4344(%rbp)
+	movq	%r13, -4352(%rbp)
+	movq	%r13, %r12
+.L3170:
+	movq	8(%r12), %rbx
+	leaq	16(%r12), %r14
+	xorl	%r13d, %r13d
+	testq	%rbx, %rbx
+	je	.L3174
+	.p2align 4,,10
+	.p2align 3
+.L3175:
+	movq	48(%r14), %rcx
+	testq	%rcx, %rcx
+	je	.L3172
+	addq	$1, %r13
+	movq	56(%r14), %rsi
+	movq	%r14, %rdi
+	addq	$80, %r14
+	call	*16(%rcx)
+	cmpq	%r13, %rbx
+	jne	.L3175
+.L3174:
+	movq	$0, 8(%r12)
+	movq	(%r12), %r12
+	testq	%r12, %r12
+	jne	.L3170
+	movq	-4344(%rbp), %r14
+	movq	-4352(%rbp), %r13
+	movq	%r13, 672(%r14)
+	jmp	.L3144
+.L3164:
+	call	sched_yield@PLT
+	jmp	.L3145
+.L3147:
+	movq	112(%r10), %rcx
+	leaq	112(%r10), %rdx
+	testq	%rcx, %rcx
+	jne	.L3206
+	movq	16(%r10), %rsi
+	xorl	%r12d, %r12d
+	jmp	.L3154
+.L3206:
+	xorl	%r12d, %r12d
+.L3153:
+	leaq	32(%r10), %rdi
+	movq	%r10, -4352(%rbp)
+	movq	%rdi, -4344(%rbp)
+	movq	%rdx, -4360(%rbp)
+	call	pthread_mutex_lock@PLT
+	movq	-4352(%rbp), %r10
+	movq	-4344(%rbp), %rdi
+	movq	104(%r10), %rax
+	cmpq	88(%r10), %rax
+	je	.L3155
+	movq	72(%r10), %rcx
+	movq	-4360(%rbp), %rdx
+	leaq	1(%rax), %rsi
+	movq	%rsi, 104(%r10)
+	movq	(%rcx,%rax,8), %rbx
+	lock subq	$1, (%rdx)
+	movq	88(%r10), %rax
+	cmpq	%rax, 104(%r10)
+	jne	.L3275
+	movq	$0, 88(%r10)
+	movq	$0, 104(%r10)
+.L3275:
+	call	pthread_mutex_unlock@PLT
+	jmp	.L3151
+.L3148:
+	movq	(%r9), %rbx
+	movq	8(%r9), %r9
+	leaq	-1(%rbx), %rdx
+	andq	%rax, %rdx
+	movq	(%r9,%rdx,8), %rbx
+	cmpq	%r8, %rax
+	jne	.L3151
+	lock cmpxchgq	%rcx, (%rsi)
+	movq	%rcx, (%rdi)
+	je	.L3151
+	jmp	.L3149
+	.p2align 4,,10
+	.p2align 3
+.L3146:
+	movq	112(%r10), %rcx
+	leaq	112(%r10), %rdx
+	testq	%rcx, %rcx
+	jne	.L3153
+	movq	16(%r10), %rsi
+	jmp	.L3154
+.L3155:
+	movq	%r10, -4344(%rbp)
+	call	pthread_mutex_unlock@PLT
+	movq	-4344(%rbp), %r10
+	movq	16(%r10), %rsi
+	testq	%r12, %r12
+	jne	.L3158
+	xorl	%ecx, %ecx
+	jmp	.L3154
+	.p2align 4,,10
+	.p2align 3
+.L3172:
+	addq	$1, %r13
+	addq	$80, %r14
+	cmpq	%r13, %rbx
+	jne	.L3175
+	jmp	.L3174
+.L3205:
+	xorl	%eax, %eax
+	xorl	%edx, %edx
+	jmp	.L3119
+.L3195:
+	movl	$3, %eax
+	jmp	.L3090
+.L3197:
+	movl	$3, %eax
+	jmp	.L3096
+.L3199:
+	movl	$3, %eax
+	jmp	.L3103
+.L3131:
+	leal	22(%rdi), %ecx
+	movb	%cl, (%rdx)
+	jmp	.L3132
+.L3204:
+	xorl	%edx, %edx
+	xorl	%ecx, %ecx
+	addq	%rbx, %rax
+	jmp	.L3109
+.L3290:
+	movq	-4320(%rbp), %rsi
+	leaq	5(%r14), %rax
+	leaq	(%rax,%rax), %rdx
+	salq	$4, %rax
+	movq	224(%rsi), %rdi
+	movq	%rdx, 208(%rsi)
+	movq	%rax, %rsi
+	movl	$8, %edx
+	movq	(%rdi), %rax
+.LEHB117:
+	call	*16(%rax)
+	movq	-4320(%rbp), %rsi
+	movq	%rax, %rdi
+	movq	%rax, 200(%rsi)
+	movq	216(%rsi), %rax
+	movq	%r12, (%rdi,%rax,8)
+	movq	216(%rsi), %rax
+	testq	%rax, %rax
+	jne	.L3294
+	cmpq	$0, -4344(%rbp)
+	je	.L3295
+.L3136:
+	movq	-4320(%rbp), %r12
+	movq	-4344(%rbp), %rsi
+	movl	$8, %ecx
+	leaq	0(,%r14,8), %rdx
+	movq	224(%r12), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE117:
+	movq	216(%r12), %rax
+	movl	64(%r12), %esi
+	jmp	.L3137
+.L3294:
+	movq	-4344(%rbp), %rsi
+	leaq	0(,%rax,8), %rdx
+	call	memcpy@PLT
+	jmp	.L3136
+.L3295:
+	movl	64(%rsi), %esi
+	jmp	.L3137
+.L3210:
+.L3276:
+	movq	%rax, %rbx
+	jmp	.L3094
+.L3214:
+	movq	%rax, %rbx
+.L3166:
+	movq	-4256(%rbp), %rax
+	testq	%rax, %rax
+	jne	.L3296
+.L3094:
+	movq	-4328(%rbp), %rdi
+	call	_ZN1n11ring_readerD1Ev
+.L3186:
+	movq	%r15, %rdi
+	call	_ZN1n7io_ringD1Ev
+	movq	%rbx, %rdi
+.LEHB118:
+	call	_Unwind_Resume@PLT
+.LEHE118:
+.L3296:
+	movq	-4248(%rbp), %rsi
+	movq	%r12, %rdi
+	call	*16(%rax)
+	jmp	.L3094
+.L3209:
+	jmp	.L3276
+.L3208:
+	movq	%rax, %rbx
+	jmp	.L3186
+.L3278:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC53(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB119:
+	call	__cxa_throw@PLT
+.L3277:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC52(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE119:
+	.cfi_endproc
+.LFE7029:
+	.section	.gcc_except_table
+.LLSDA7029:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7029-.LLSDACSB7029
+.LLSDACSB7029:
+	.uleb128 .LEHB111-.LFB7029
+	.uleb128 .LEHE111-.LEHB111
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB112-.LFB7029
+	.uleb128 .LEHE112-.LEHB112
+	.uleb128 .L3208-.LFB7029
+	.uleb128 0
+	.uleb128 .LEHB113-.LFB7029
+	.uleb128 .LEHE113-.LEHB113
+	.uleb128 .L3209-.LFB7029
+	.uleb128 0
+	.uleb128 .LEHB114-.LFB7029
+	.uleb128 .LEHE114-.LEHB114
+	.uleb128 .L3208-.LFB7029
+	.uleb128 0
+	.uleb128 .LEHB115-.LFB7029
+	.uleb128 .LEHE115-.LEHB115
+	.uleb128 .L3210-.LFB7029
+	.uleb128 0
+	.uleb128 .LEHB116-.LFB7029
+	.uleb128 .LEHE116-.LEHB116
+	.uleb128 .L3214-.LFB7029
+	.uleb128 0
+	.uleb128 .LEHB117-.LFB7029
+	.uleb128 .LEHE117-.LEHB117
+	.uleb128 .L3210-.LFB7029
+	.uleb128 0
+	.uleb128 .LEHB118-.LFB7029
+	.uleb128 .LEHE118-.LEHB118
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB119-.LFB7029
+	.uleb128 .LEHE119-.LEHB119
+	.uleb128 .L3209-.LFB7029
+	.uleb128 0
+.LLSDACSE7029:
+	.section	.text._Z16test_ring_readerILN1n10io_backendE0EEvv,"axG",@progbits,_Z16test_ring_readerILN1n10io_backendE0EEvv,comdat
+	.size	_Z16test_ring_readerILN1n10io_backendE0EEvv, .-_Z16test_ring_readerILN1n10io_backendE0EEvv
+	.weak	_ZTSN1n15memory_resourceE
+	.section	.rodata._ZTSN1n15memory_resourceE,"aG",@progbits,_ZTSN1n15memory_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n15memory_resourceE, @object
+	.size	_ZTSN1n15memory_resourceE, 22
+_ZTSN1n15memory_resourceE:
+	.string	"N1n15memory_resourceE"
+	.weak	_ZTIN1n15memory_resourceE
+	.section	.data.rel.ro._ZTIN1n15memory_resourceE,"awG",@progbits,_ZTIN1n15memory_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n15memory_resourceE, @object
+	.size	_ZTIN1n15memory_resourceE, 16
+_ZTIN1n15memory_resourceE:
+	.quad	_ZTVN10__cxxabiv117__class_type_infoE+16
+	.quad	_ZTSN1n15memory_resourceE
+	.weak	_ZTSN1n13heap_resourceE
+	.section	.rodata._ZTSN1n13heap_resourceE,"aG",@progbits,_ZTSN1n13heap_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n13heap_resourceE, @object
+	.size	_ZTSN1n13heap_resourceE, 20
+_ZTSN1n13heap_resourceE:
+	.string	"N1n13heap_resourceE"
+	.weak	_ZTIN1n13heap_resourceE
+	.section	.data.rel.ro._ZTIN1n13heap_resourceE,"awG",@progbits,_ZTIN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n13heap_resourceE, @object
+	.size	_ZTIN1n13heap_resourceE, 24
+_ZTIN1n13heap_resourceE:
+	.quad	_ZTVN10__cxxabiv120__si_class_type_infoE+16
+	.quad	_ZTSN1n13heap_resourceE
+	.quad	_ZTIN1n15memory_resourceE
+	.weak	_ZTVN1n13heap_resourceE
+	.section	.data.rel.ro.local._ZTVN1n13heap_resourceE,"awG",@progbits,_ZTVN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTVN1n13heap_resourceE, @object
+	.size	_ZTVN1n13heap_resourceE, 48
+_ZTVN1n13heap_resourceE:
+	.quad	0
+	.quad	_ZTIN1n13heap_resourceE
+	.quad	_ZN1n13heap_resourceD1Ev
+	.quad	_ZN1n13heap_resourceD0Ev
+	.quad	_ZN1n13heap_resource8allocateEmm
+	.quad	_ZN1n13heap_resource10deallocateEPvmm
+	.weak	_ZN1n4task8__ops_ofIZNS_7io_ring6submitEvEUlvE_EE
+	.section	.data.rel.ro.local._ZN1n4task8__ops_ofIZNS_7io_ring6submitEvEUlvE_EE,"awG",@progbits,_ZN1n4task8__ops_ofIZNS_7io_ring6submitEvEUlvE_EE,comdat
+	.align 16
+	.type	_ZN1n4task8__ops_ofIZNS_7io_ring6submitEvEUlvE_EE, @gnu_unique_object
+	.size	_ZN1n4task8__ops_ofIZNS_7io_ring6submitEvEUlvE_EE, 24
+_ZN1n4task8__ops_ofIZNS_7io_ring6submitEvEUlvE_EE:
+	.quad	_ZN1n4taskUlPvE2_4_FUNES1_
+	.quad	_ZN1n4taskUlPvS1_E3_4_FUNES1_S1_
+	.quad	_ZN1n4taskUlPvPNS_15memory_resourceEE4_4_FUNES1_S3_
+	.globl	other
+	.section	.rodata.str1.1
+.LC56:
+	.string	"test_io_ring_other.bin"
+	.section	.data.rel.local,"aw"
+	.align 8
+	.type	other, @object
+	.size	other, 8
+other:
+	.quad	.LC56
+	.globl	path
+	.section	.rodata.str1.1
+.LC57:
+	.string	"test_io_ring.bin"
+	.section	.data.rel.local
+	.align 8
+	.type	path, @object
+	.size	path, 8
+path:
+	.quad	.LC57
+	.weak	_ZN1n16__current_workerE
+	.section	.tbss._ZN1n16__current_workerE,"awTG",@nobits,_ZN1n16__current_workerE,comdat
+	.align 8
+	.type	_ZN1n16__current_workerE, @gnu_unique_object
+	.size	_ZN1n16__current_workerE, 8
+_ZN1n16__current_workerE:
+	.zero	8
+	.weak	_ZN1n18__current_resourceE
+	.section	.tbss._ZN1n18__current_resourceE,"awTG",@nobits,_ZN1n18__current_resourceE,comdat
+	.align 8
+	.type	_ZN1n18__current_resourceE, @gnu_unique_object
+	.size	_ZN1n18__current_resourceE, 8
+_ZN1n18__current_resourceE:
+	.zero	8
+	.weak	_ZGVZN1n4heapEvE3res
+	.section	.bss._ZGVZN1n4heapEvE3res,"awG",@nobits,_ZGVZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZGVZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZGVZN1n4heapEvE3res, 8
+_ZGVZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE3res
+	.section	.bss._ZZN1n4heapEvE3res,"awG",@nobits,_ZZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZZN1n4heapEvE3res, 8
+_ZZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE7storage
+	.section	.bss._ZZN1n4heapEvE7storage,"awG",@nobits,_ZZN1n4heapEvE7storage,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE7storage, @gnu_unique_object
+	.size	_ZZN1n4heapEvE7storage, 8
+_ZZN1n4heapEvE7storage:
+	.zero	8
+	.weak	_ZGVZN1n9simd_bestEvE4best
+	.section	.bss._ZGVZN1n9simd_bestEvE4best,"awG",@nobits,_ZGVZN1n9simd_bestEvE4best,comdat
+	.align 8
+	.type	_ZGVZN1n9simd_bestEvE4best, @gnu_unique_object
+	.size	_ZGVZN1n9simd_bestEvE4best, 8
+_ZGVZN1n9simd_bestEvE4best:
+	.zero	8
+	.weak	_ZZN1n9simd_bestEvE4best
+	.section	.bss._ZZN1n9simd_bestEvE4best,"awG",@nobits,_ZZN1n9simd_bestEvE4best,comdat
+	.align 4
+	.type	_ZZN1n9simd_bestEvE4best, @gnu_unique_object
+	.size	_ZZN1n9simd_bestEvE4best, 4
+_ZZN1n9simd_bestEvE4best:
+	.zero	4
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC4:
+	.quad	-1
+	.quad	0
+	.set	.LC8,.LC34
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC24:
+	.long	6
+	.long	100
+	.section	.rodata.cst16
+	.align 16
+.LC32:
+	.quad	4096
+	.quad	0
+	.align 16
+.LC34:
+	.quad	10
+	.quad	0
+	.align 16
+.LC39:
+	.quad	12388
+	.quad	0
+	.align 16
+.LC41:
+	.quad	100
+	.quad	0
+	.align 16
+.LC42:
+	.quad	8192
+	.quad	0
+	.align 16
+.LC51:
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.align 16
+.LC54:
+	.byte	7
+	.byte	7
+	.byte	7
+	.byte	7
+	.byte	7
+	.byte	7
+	.byte	7
+	.byte	7
+	.byte	7
+	.byte	7
+	.byte	7
+	.byte	7
+	.byte	7
+	.byte	7
+	.byte	7
+	.byte	7
+	.hidden	DW.ref._ZTIPKc
+	.weak	DW.ref._ZTIPKc
+	.section	.data.rel.local.DW.ref._ZTIPKc,"awG",@progbits,DW.ref._ZTIPKc,comdat
+	.align 8
+	.type	DW.ref._ZTIPKc, @object
+	.size	DW.ref._ZTIPKc, 8
+DW.ref._ZTIPKc:
+	.quad	_ZTIPKc
+	.hidden	DW.ref.__gxx_personality_v0
+	.weak	DW.ref.__gxx_personality_v0
+	.section	.data.rel.local.DW.ref.__gxx_personality_v0,"awG",@progbits,DW.ref.__gxx_personality_v0,comdat
+	.align 8
+	.type	DW.ref.__gxx_personality_v0, @object
+	.size	DW.ref.__gxx_personality_v0, 8
+DW.ref.__gxx_personality_v0:
+	.quad	__gxx_personality_v0
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
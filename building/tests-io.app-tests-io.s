@@ -0,0 +1,16494 @@
+	.file	"tests-io.cpp"
+	.text
+	.section	.text._ZN1n13heap_resourceD2Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD2Ev
+	.type	_ZN1n13heap_resourceD2Ev, @function
+_ZN1n13heap_resourceD2Ev:
+.LFB7211:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7211:
+	.size	_ZN1n13heap_resourceD2Ev, .-_ZN1n13heap_resourceD2Ev
+	.weak	_ZN1n13heap_resourceD1Ev
+	.set	_ZN1n13heap_resourceD1Ev,_ZN1n13heap_resourceD2Ev
+	.section	.text._ZN1n13heap_resource10deallocateEPvmm,"axG",@progbits,_ZN1n13heap_resource10deallocateEPvmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource10deallocateEPvmm
+	.type	_ZN1n13heap_resource10deallocateEPvmm, @function
+_ZN1n13heap_resource10deallocateEPvmm:
+.LFB6619:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rcx
+	jbe	.L4
+	movq	%rcx, %rsi
+	jmp	_ZdlPvSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	jmp	_ZdlPv@PLT
+	.cfi_endproc
+.LFE6619:
+	.size	_ZN1n13heap_resource10deallocateEPvmm, .-_ZN1n13heap_resource10deallocateEPvmm
+	.section	.text._ZN1n13heap_resource8allocateEmm,"axG",@progbits,_ZN1n13heap_resource8allocateEmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource8allocateEmm
+	.type	_ZN1n13heap_resource8allocateEmm, @function
+_ZN1n13heap_resource8allocateEmm:
+.LFB6618:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rdx
+	jbe	.L6
+	movq	%rdx, %rsi
+	jmp	_ZnwmSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	jmp	_Znwm@PLT
+	.cfi_endproc
+.LFE6618:
+	.size	_ZN1n13heap_resource8allocateEmm, .-_ZN1n13heap_resource8allocateEmm
+	.section	.text._ZN1n13heap_resourceD0Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD0Ev
+	.type	_ZN1n13heap_resourceD0Ev, @function
+_ZN1n13heap_resourceD0Ev:
+.LFB7213:
+	.cfi_startproc
+	movl	$8, %esi
+	jmp	_ZdlPvm@PLT
+	.cfi_endproc
+.LFE7213:
+	.size	_ZN1n13heap_resourceD0Ev, .-_ZN1n13heap_resourceD0Ev
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"test_records.bin"
+.LC2:
+	.string	"expected true : ok"
+	.section	.text.unlikely,"ax",@progbits
+.LCOLDB3:
+	.text
+.LHOTB3:
+	.p2align 4
+	.globl	_Z24test_record_file_threadsv
+	.type	_Z24test_record_file_threadsv, @function
+_Z24test_record_file_threadsv:
+.LFB6958:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6958
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$438, %edx
+	movl	$524865, %esi
+	xorl	%eax, %eax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	leaq	.LC0(%rip), %rdi
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	xorl	%r12d, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$152, %rsp
+	.cfi_def_cfa_offset 208
+.LEHB0:
+	call	open@PLT
+.LEHE0:
+	leaq	48(%rsp), %r15
+	movl	%eax, %r13d
+	.p2align 4,,10
+	.p2align 3
+.L10:
+	movq	%r12, %r14
+	movq	%r12, 48(%rsp)
+	xorl	%ebx, %ebx
+	movq	$0x000000000, 56(%rsp)
+	salq	$4, %r14
+	movq	%r14, %rbp
+	testl	%r13d, %r13d
+	jns	.L9
+	jmp	.L14
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	je	.L14
+	addq	%rax, %rbx
+	cmpq	$15, %rbx
+	ja	.L14
+	leaq	(%r14,%rbx), %rbp
+.L9:
+	movl	$16, %edx
+	leaq	(%r15,%rbx), %rsi
+	movq	%rbp, %rcx
+	movl	%r13d, %edi
+	subq	%rbx, %rdx
+.LEHB1:
+	call	pwrite@PLT
+.LEHE1:
+	testq	%rax, %rax
+	jns	.L12
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L9
+.L14:
+	addq	$1, %r12
+	cmpq	$4000, %r12
+	jne	.L10
+	testl	%r13d, %r13d
+	js	.L15
+	movl	%r13d, %edi
+	call	close@PLT
+.L15:
+	movl	$438, %edx
+	movl	$524288, %esi
+	xorl	%eax, %eax
+	xorl	%ebx, %ebx
+	leaq	.LC0(%rip), %rdi
+	leaq	12(%rsp), %r13
+.LEHB2:
+	call	open@PLT
+.LEHE2:
+	leaq	16(%rsp), %rbp
+	leaq	_Z12read_recordsPv(%rip), %r12
+	movl	%eax, 12(%rsp)
+.L16:
+	movq	%rbx, 8(%r15)
+	leaq	0(%rbp,%rbx,8), %rdi
+	movq	%r15, %rcx
+	movq	%r12, %rdx
+	movq	%r13, (%r15)
+	xorl	%esi, %esi
+	addq	$1, %rbx
+	addq	$24, %r15
+	movb	$0, -8(%r15)
+	call	pthread_create@PLT
+	cmpq	$4, %rbx
+	jne	.L16
+	xorl	%ebx, %ebx
+	movl	$1, %r12d
+	leaq	64(%rsp), %r13
+.L18:
+	movq	0(%rbp,%rbx,8), %rdi
+	xorl	%esi, %esi
+.LEHB3:
+	call	pthread_join@PLT
+.LEHE3:
+	testb	%r12b, %r12b
+	je	.L17
+	leaq	(%rbx,%rbx,2), %rax
+	movzbl	0(%r13,%rax,8), %r12d
+.L17:
+	addq	$1, %rbx
+	cmpq	$4, %rbx
+	jne	.L18
+	testb	%r12b, %r12b
+	je	.L39
+	leaq	.LC0(%rip), %rdi
+	call	remove@PLT
+	movl	12(%rsp), %edi
+	testl	%edi, %edi
+	js	.L8
+	call	close@PLT
+.L8:
+	addq	$152, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L37:
+	.cfi_restore_state
+	jmp	.L38
+.L25:
+	movq	%rax, %rbx
+	jmp	.L21
+	.globl	__gxx_personality_v0
+	.section	.gcc_except_table,"a",@progbits
+.LLSDA6958:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6958-.LLSDACSB6958
+.LLSDACSB6958:
+	.uleb128 .LEHB0-.LFB6958
+	.uleb128 .LEHE0-.LEHB0
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB1-.LFB6958
+	.uleb128 .LEHE1-.LEHB1
+	.uleb128 .L25-.LFB6958
+	.uleb128 0
+	.uleb128 .LEHB2-.LFB6958
+	.uleb128 .LEHE2-.LEHB2
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB3-.LFB6958
+	.uleb128 .LEHE3-.LEHB3
+	.uleb128 .L37-.LFB6958
+	.uleb128 0
+.LLSDACSE6958:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6958
+	.type	_Z24test_record_file_threadsv.cold, @function
+_Z24test_record_file_threadsv.cold:
+.LFSB6958:
+.L39:
+	.cfi_def_cfa_offset 208
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC2(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB4:
+	call	__cxa_throw@PLT
+.LEHE4:
+.L26:
+.L38:
+	movl	12(%rsp), %edi
+	movq	%rax, %rbx
+	testl	%edi, %edi
+	js	.L23
+	call	close@PLT
+.L23:
+	movq	%rbx, %rdi
+.LEHB5:
+	call	_Unwind_Resume@PLT
+.LEHE5:
+.L21:
+	movl	%r13d, %edi
+	call	close@PLT
+	movq	%rbx, %rdi
+.LEHB6:
+	call	_Unwind_Resume@PLT
+.LEHE6:
+	.cfi_endproc
+.LFE6958:
+	.section	.gcc_except_table
+.LLSDAC6958:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6958-.LLSDACSBC6958
+.LLSDACSBC6958:
+	.uleb128 .LEHB4-.LCOLDB3
+	.uleb128 .LEHE4-.LEHB4
+	.uleb128 .L26-.LCOLDB3
+	.uleb128 0
+	.uleb128 .LEHB5-.LCOLDB3
+	.uleb128 .LEHE5-.LEHB5
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB6-.LCOLDB3
+	.uleb128 .LEHE6-.LEHB6
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6958:
+	.section	.text.unlikely
+	.text
+	.size	_Z24test_record_file_threadsv, .-_Z24test_record_file_threadsv
+	.section	.text.unlikely
+	.size	_Z24test_record_file_threadsv.cold, .-_Z24test_record_file_threadsv.cold
+.LCOLDE3:
+	.text
+.LHOTE3:
+	.p2align 4
+	.globl	_Z12read_recordsPv
+	.type	_Z12read_recordsPv, @function
+_Z12read_recordsPv:
+.LFB6955:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	movq	8(%rdi), %rax
+	movb	$1, 16(%rdi)
+	movq	%rdi, 8(%rsp)
+	movq	%rax, (%rsp)
+	cmpq	$3999, %rax
+	jg	.L62
+	leaq	16(%rsp), %r13
+.L43:
+	movq	8(%rsp), %rax
+	movq	(%rax), %rax
+	movl	(%rax), %ebp
+	testl	%ebp, %ebp
+	jns	.L64
+	movq	8(%rsp), %rax
+	movb	$0, 16(%rax)
+	movq	(%rsp), %rax
+	addq	$4, %rax
+	cmpq	$3999, %rax
+	jg	.L62
+.L52:
+	addq	$4, %rax
+	cmpq	$3999, %rax
+	jle	.L52
+	movq	8(%rsp), %rax
+	movb	$0, 16(%rax)
+.L62:
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L64:
+	.cfi_restore_state
+	movq	(%rsp), %r14
+	xorl	%r15d, %r15d
+	movl	$16, %r12d
+	salq	$4, %r14
+	movq	%r14, %rbx
+	jmp	.L48
+	.p2align 4,,10
+	.p2align 3
+.L45:
+	je	.L47
+	addq	%rax, %r15
+	cmpq	$15, %r15
+	ja	.L47
+	leaq	(%r15,%r14), %rbx
+.L48:
+	movq	%r12, %rdx
+	leaq	0(%r13,%r15), %rsi
+	movq	%rbx, %rcx
+	movl	%ebp, %edi
+	subq	%r15, %rdx
+	call	pread@PLT
+	testq	%rax, %rax
+	jns	.L45
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L48
+.L47:
+	movq	8(%rsp), %rax
+	movzbl	16(%rax), %eax
+	cmpq	$16, %r15
+	je	.L65
+	xorl	%eax, %eax
+.L49:
+	movq	8(%rsp), %rcx
+	addq	$4, (%rsp)
+	movb	%al, 16(%rcx)
+	movq	(%rsp), %rax
+	cmpq	$3999, %rax
+	jle	.L43
+	jmp	.L62
+	.p2align 4,,10
+	.p2align 3
+.L65:
+	movq	16(%rsp), %rdx
+	testb	%al, %al
+	je	.L49
+	movq	(%rsp), %rax
+	cmpq	%rax, %rdx
+	sete	%al
+	jmp	.L49
+	.cfi_endproc
+.LFE6955:
+	.size	_Z12read_recordsPv, .-_Z12read_recordsPv
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC5:
+	.string	"expected equal : expected value : f.write_range(0, s, 1000), actual value : 1000"
+	.align 8
+.LC6:
+	.string	"expected true : f.write_at(500, sample{-1, 0})"
+	.align 8
+.LC7:
+	.string	"expected equal : expected value : f.len(), actual value : 1000"
+	.align 8
+.LC8:
+	.string	"expected equal : expected value : f.read_at(7).get().id, actual value : 7"
+	.align 8
+.LC9:
+	.string	"expected equal : expected value : f.read_at(500).get().id, actual value : -1"
+	.align 8
+.LC10:
+	.string	"expected false : f.read_at(1000).has()"
+	.align 8
+.LC11:
+	.string	"expected equal : expected value : f.read_range(995, out, 8), actual value : 5"
+	.align 8
+.LC12:
+	.string	"expected equal : expected value : out[4].id, actual value : 999"
+	.align 8
+.LC16:
+	.string	"expected equal : expected value : f.read_many(idx, many, 6), actual value : 5"
+	.align 8
+.LC17:
+	.string	"expected equal : expected value : many[2].id, actual value : 12"
+	.align 8
+.LC18:
+	.string	"expected equal : expected value : many[4].id, actual value : 0"
+	.align 8
+.LC19:
+	.string	"expected equal : expected value : many[5].id, actual value : 401"
+	.align 8
+.LC21:
+	.string	"expected equal : expected value : f.read_many(run, outs, 3), actual value : 3"
+	.align 8
+.LC22:
+	.string	"expected true : c.id == 300 and a.id == 301 and b.id == 302"
+	.section	.text.unlikely
+.LCOLDB23:
+	.text
+.LHOTB23:
+	.p2align 4
+	.globl	_Z16test_record_filev
+	.type	_Z16test_record_filev, @function
+_Z16test_record_filev:
+.LFB6954:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6954
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$438, %edx
+	movl	$524865, %esi
+	xorl	%eax, %eax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	leaq	.LC0(%rip), %rdi
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$16440, %rsp
+	.cfi_def_cfa_offset 16496
+.LEHB7:
+	call	open@PLT
+.LEHE7:
+	movsd	.LC4(%rip), %xmm1
+	movl	%eax, %ebp
+	leaq	432(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	movq	%rax, %rdx
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L67:
+	pxor	%xmm0, %xmm0
+	movq	%rax, (%rdx)
+	addq	$16, %rdx
+	cvtsi2sdq	%rax, %xmm0
+	addq	$1, %rax
+	mulsd	%xmm1, %xmm0
+	movsd	%xmm0, -8(%rdx)
+	cmpq	$1000, %rax
+	jne	.L67
+	xorl	%ebx, %ebx
+	movl	$16000, %r12d
+	testl	%ebp, %ebp
+	jns	.L68
+	jmp	.L72
+	.p2align 4,,10
+	.p2align 3
+.L69:
+	je	.L71
+	addq	%rax, %rbx
+	cmpq	$15999, %rbx
+	ja	.L71
+.L68:
+	movq	16(%rsp), %rax
+	movq	%r12, %rdx
+	movq	%rbx, %rcx
+	movl	%ebp, %edi
+	subq	%rbx, %rdx
+	leaq	(%rax,%rbx), %rsi
+.LEHB8:
+	call	pwrite@PLT
+	testq	%rax, %rax
+	jns	.L69
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L68
+.L71:
+	shrq	$4, %rbx
+	cmpq	$1000, %rbx
+	jne	.L214
+	xorl	%ebx, %ebx
+	movl	$8000, %r12d
+	movq	$-1, 288(%rsp)
+	leaq	288(%rsp), %r13
+	movq	$0x000000000, 296(%rsp)
+	movl	$16, %r14d
+	jmp	.L80
+.L77:
+	je	.L79
+	addq	%rax, %rbx
+	cmpq	$15, %rbx
+	ja	.L79
+	leaq	8000(%rbx), %r12
+.L80:
+	movq	%r14, %rdx
+	leaq	0(%r13,%rbx), %rsi
+	movq	%r12, %rcx
+	movl	%ebp, %edi
+	subq	%rbx, %rdx
+	call	pwrite@PLT
+.LEHE8:
+	testq	%rax, %rax
+	jns	.L77
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L80
+.L79:
+	shrq	$4, %rbx
+	cmpq	$1, %rbx
+	jne	.L199
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	fstat@PLT
+	testl	%eax, %eax
+	jne	.L83
+	movq	336(%rsp), %rax
+	shrq	$4, %rax
+	cmpq	$1000, %rax
+	jne	.L83
+	movl	%ebp, %edi
+	call	close@PLT
+	movl	$438, %edx
+	movl	$524288, %esi
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rdi
+.LEHB9:
+	call	open@PLT
+.LEHE9:
+	movl	%eax, %ebp
+	testl	%eax, %eax
+	js	.L91
+	xorl	%ebx, %ebx
+	movl	$112, %r12d
+	movl	$16, %r14d
+	jmp	.L89
+.L86:
+	je	.L88
+	addq	%rax, %rbx
+	cmpq	$15, %rbx
+	ja	.L88
+	leaq	112(%rbx), %r12
+.L89:
+	movq	16(%rsp), %rax
+	movq	%r14, %rdx
+	movq	%r12, %rcx
+	movl	%ebp, %edi
+	subq	%rbx, %rdx
+	leaq	(%rax,%rbx), %rsi
+.LEHB10:
+	call	pread@PLT
+	testq	%rax, %rax
+	jns	.L86
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L89
+.L88:
+	cmpq	$16, %rbx
+	jne	.L91
+	cmpq	$7, 432(%rsp)
+	jne	.L91
+	xorl	%ebx, %ebx
+	movl	$8000, %r12d
+	movl	$16, %r14d
+	jmp	.L98
+.L95:
+	je	.L97
+	addq	%rax, %rbx
+	cmpq	$15, %rbx
+	ja	.L97
+	leaq	8000(%rbx), %r12
+.L98:
+	movq	16(%rsp), %rax
+	movq	%r14, %rdx
+	movq	%r12, %rcx
+	movl	%ebp, %edi
+	subq	%rbx, %rdx
+	leaq	(%rax,%rbx), %rsi
+	call	pread@PLT
+	testq	%rax, %rax
+	jns	.L95
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L98
+.L97:
+	cmpq	$16, %rbx
+	jne	.L93
+	cmpq	$-1, 432(%rsp)
+	jne	.L93
+	xorl	%r12d, %r12d
+	movl	$16000, %ebx
+	movl	$16, %r14d
+	jmp	.L105
+.L102:
+	je	.L104
+	addq	%rax, %r12
+	cmpq	$15, %r12
+	ja	.L104
+	leaq	16000(%r12), %rbx
+.L105:
+	movq	16(%rsp), %rax
+	movq	%r14, %rdx
+	movq	%rbx, %rcx
+	movl	%ebp, %edi
+	subq	%r12, %rdx
+	leaq	(%rax,%r12), %rsi
+	call	pread@PLT
+	testq	%rax, %rax
+	jns	.L102
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L105
+.L104:
+	xorl	%ebx, %ebx
+	movl	$15920, %r14d
+	movl	$128, %r15d
+	cmpq	$16, %r12
+	jne	.L110
+	jmp	.L200
+	.p2align 4,,10
+	.p2align 3
+.L107:
+	je	.L109
+	addq	%rax, %rbx
+	cmpq	$127, %rbx
+	ja	.L109
+	leaq	15920(%rbx), %r14
+.L110:
+	movq	%r15, %rdx
+	leaq	0(%r13,%rbx), %rsi
+	movq	%r14, %rcx
+	movl	%ebp, %edi
+	subq	%rbx, %rdx
+	call	pread@PLT
+	testq	%rax, %rax
+	jns	.L107
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L110
+.L109:
+	shrq	$4, %rbx
+	cmpq	$5, %rbx
+	jne	.L201
+	cmpq	$999, 352(%rsp)
+	jne	.L202
+	movl	$12, %ecx
+	xorl	%eax, %eax
+	movl	$10, %r14d
+	xorl	%r13d, %r13d
+	leaq	192(%rsp), %r15
+	movdqa	.LC13(%rip), %xmm0
+	movq	$0, 8(%rsp)
+	movq	%r15, %rdi
+	rep stosq
+	movaps	%xmm0, 144(%rsp)
+	movdqa	.LC14(%rip), %xmm0
+	movaps	%xmm0, 160(%rsp)
+	movdqa	.LC15(%rip), %xmm0
+	movaps	%xmm0, 176(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L113:
+	leaq	1(%r13), %rax
+	movl	$16, %r12d
+	movq	%rax, (%rsp)
+	cmpq	$5, %r13
+	je	.L114
+	leaq	1(%r13), %rdi
+	leaq	1(%r14), %rdx
+	leaq	0(,%rdi,8), %rax
+	cmpq	144(%rsp,%rdi,8), %rdx
+	jne	.L150
+	leaq	2(%r13), %rcx
+	movq	%rcx, (%rsp)
+	cmpq	$4, %r13
+	je	.L151
+	leaq	2(%r14), %rdx
+	cmpq	152(%rsp,%rax), %rdx
+	jne	.L152
+	leaq	3(%r13), %rdi
+	movq	%rdi, (%rsp)
+	cmpq	$3, %r13
+	je	.L153
+	leaq	3(%r14), %rdx
+	cmpq	160(%rsp,%rax), %rdx
+	jne	.L154
+	leaq	4(%r13), %rcx
+	movq	%rcx, (%rsp)
+	cmpq	$2, %r13
+	je	.L155
+	leaq	4(%r14), %rdx
+	cmpq	%rdx, 168(%rsp,%rax)
+	jne	.L156
+	testq	%r13, %r13
+	jne	.L157
+	leaq	5(%r14), %rax
+	movl	$6, %r12d
+	cmpq	184(%rsp), %rax
+	jne	.L215
+.L116:
+	movq	$6, (%rsp)
+	salq	$4, %r12
+.L114:
+	salq	$4, %r13
+	salq	$4, %r14
+	xorl	%ebx, %ebx
+	jmp	.L120
+	.p2align 4,,10
+	.p2align 3
+.L117:
+	je	.L119
+	addq	%rax, %rbx
+.L118:
+	cmpq	%r12, %rbx
+	jnb	.L119
+.L120:
+	movq	%r12, %rdx
+	leaq	0(%r13,%rbx), %rsi
+	leaq	(%r14,%rbx), %rcx
+	movl	%ebp, %edi
+	subq	%rbx, %rdx
+	addq	%r15, %rsi
+	call	pread@PLT
+	testq	%rax, %rax
+	jns	.L117
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L118
+.L119:
+	movq	(%rsp), %r13
+	shrq	$4, %rbx
+	addq	%rbx, 8(%rsp)
+	cmpq	$6, %r13
+	je	.L121
+	movq	144(%rsp,%r13,8), %r14
+	jmp	.L113
+.L121:
+	leaq	64(%rsp), %rax
+	cmpq	$5, 8(%rsp)
+	movq	%rax, %xmm0
+	leaq	32(%rsp), %rax
+	movq	%rax, %xmm2
+	punpcklqdq	%xmm2, %xmm0
+	jne	.L203
+	cmpq	$12, 224(%rsp)
+	jne	.L204
+	cmpq	$0, 256(%rsp)
+	jne	.L205
+	cmpq	$401, 272(%rsp)
+	jne	.L206
+	movaps	%xmm0, 80(%rsp)
+	leaq	48(%rsp), %rax
+	movdqa	.LC20(%rip), %xmm0
+	movq	%rax, 96(%rsp)
+	movl	$300, %eax
+	movq	$302, 128(%rsp)
+	movq	$0, 24(%rsp)
+	movq	$0, 8(%rsp)
+	movaps	%xmm0, 112(%rsp)
+	jmp	.L127
+	.p2align 4,,10
+	.p2align 3
+.L220:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L134
+.L130:
+	movq	8(%rsp), %rax
+	addq	%r13, 24(%rsp)
+	cmpq	$3, %rax
+	je	.L135
+	movq	112(%rsp,%rax,8), %rax
+.L127:
+	movq	8(%rsp), %rdi
+	leaq	1(%rdi), %rdx
+	cmpq	$2, %rdi
+	je	.L216
+	leaq	1(%rax), %rcx
+	cmpq	112(%rsp,%rdx,8), %rcx
+	jne	.L217
+	cmpq	$0, 8(%rsp)
+	jne	.L218
+	cmpq	$300, %rax
+	jne	.L219
+	movq	80(%rsp), %rdx
+	movq	$16, 440(%rsp)
+	movl	$3, %r12d
+	movq	$16, 456(%rsp)
+	movq	%rdx, 432(%rsp)
+	movq	88(%rsp), %rdx
+	movq	$16, 472(%rsp)
+	movq	%rdx, 448(%rsp)
+	movq	96(%rsp), %rdx
+	movq	$3, 8(%rsp)
+	movq	%rdx, 464(%rsp)
+.L137:
+	salq	$4, %rax
+	movq	16(%rsp), %rbx
+	xorl	%r13d, %r13d
+	xorl	%r15d, %r15d
+	movq	%rax, (%rsp)
+	movq	%rax, %r14
+	.p2align 4,,10
+	.p2align 3
+.L134:
+	movq	%r14, %rcx
+	movl	%r12d, %edx
+	movq	%rbx, %rsi
+	movl	%ebp, %edi
+	call	preadv@PLT
+.LEHE10:
+	testq	%rax, %rax
+	js	.L220
+	je	.L130
+	addq	%rax, %r15
+	.p2align 4,,10
+	.p2align 3
+.L132:
+	movq	8(%rbx), %rdx
+	cmpq	%rdx, %rax
+	jb	.L131
+	addq	$16, %rbx
+	subq	$1, %r12
+	addq	$1, %r13
+	subq	%rdx, %rax
+	jne	.L132
+	.p2align 4,,10
+	.p2align 3
+.L133:
+	testq	%r12, %r12
+	je	.L130
+	movq	(%rsp), %rax
+	leaq	(%rax,%r15), %r14
+	jmp	.L134
+	.p2align 4,,10
+	.p2align 3
+.L131:
+	subq	%rax, %rdx
+	addq	%rax, (%rbx)
+	movq	%rdx, 8(%rbx)
+	jmp	.L133
+.L135:
+	cmpq	$3, 24(%rsp)
+	jne	.L207
+	cmpq	$300, 64(%rsp)
+	jne	.L143
+	cmpq	$301, 32(%rsp)
+	jne	.L143
+	cmpq	$302, 48(%rsp)
+	jne	.L143
+	leaq	.LC0(%rip), %rdi
+	call	remove@PLT
+	movl	%ebp, %edi
+	call	close@PLT
+	addq	$16440, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L150:
+	.cfi_restore_state
+	movl	$1, %r12d
+.L115:
+	salq	$4, %r12
+	jmp	.L114
+.L151:
+	movl	$2, %r12d
+	jmp	.L116
+.L152:
+	movl	$2, %r12d
+	jmp	.L115
+.L153:
+	movl	$3, %r12d
+	jmp	.L116
+.L154:
+	movl	$3, %r12d
+	jmp	.L115
+.L155:
+	movl	$4, %r12d
+	jmp	.L116
+.L218:
+	movq	$3, 8(%rsp)
+	movq	88(%rsp), %rcx
+	movl	$8, %edx
+.L140:
+	movq	88(%rsp,%rdx), %rdx
+	movq	%rcx, 432(%rsp)
+	movl	$2, %r12d
+	movq	$16, 440(%rsp)
+	movq	%rdx, 448(%rsp)
+	movq	$16, 456(%rsp)
+	jmp	.L137
+.L217:
+	movq	80(%rsp,%rdi,8), %rcx
+	movq	%rdx, 8(%rsp)
+	movl	$1, %r12d
+	movq	$16, 440(%rsp)
+	movq	%rcx, 432(%rsp)
+	jmp	.L137
+.L157:
+	movl	$5, %r12d
+	jmp	.L116
+.L156:
+	movl	$4, %r12d
+	jmp	.L115
+.L216:
+	movq	96(%rsp), %rdx
+	movl	$1, %r12d
+	movq	$16, 440(%rsp)
+	movq	$3, 8(%rsp)
+	movq	%rdx, 432(%rsp)
+	jmp	.L137
+.L219:
+	movq	$2, 8(%rsp)
+	movq	80(%rsp), %rcx
+	xorl	%edx, %edx
+	jmp	.L140
+.L215:
+	movq	$5, (%rsp)
+	movl	$5, %r12d
+	jmp	.L115
+.L214:
+	jmp	.L72
+.L197:
+	jmp	.L198
+.L195:
+	jmp	.L196
+	.section	.gcc_except_table
+.LLSDA6954:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6954-.LLSDACSB6954
+.LLSDACSB6954:
+	.uleb128 .LEHB7-.LFB6954
+	.uleb128 .LEHE7-.LEHB7
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB8-.LFB6954
+	.uleb128 .LEHE8-.LEHB8
+	.uleb128 .L197-.LFB6954
+	.uleb128 0
+	.uleb128 .LEHB9-.LFB6954
+	.uleb128 .LEHE9-.LEHB9
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB10-.LFB6954
+	.uleb128 .LEHE10-.LEHB10
+	.uleb128 .L195-.LFB6954
+	.uleb128 0
+.LLSDACSE6954:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6954
+	.type	_Z16test_record_filev.cold, @function
+_Z16test_record_filev.cold:
+.LFSB6954:
+.L201:
+	.cfi_def_cfa_offset 16496
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC11(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB11:
+	call	__cxa_throw@PLT
+.L91:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC8(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE11:
+.L200:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC10(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB12:
+	call	__cxa_throw@PLT
+.L143:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC22(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE12:
+.L159:
+.L196:
+	movq	%rax, %rbx
+.L148:
+	movl	%ebp, %edi
+	call	close@PLT
+.L147:
+	movq	%rbx, %rdi
+.LEHB13:
+	call	_Unwind_Resume@PLT
+.LEHE13:
+.L207:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC21(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB14:
+	call	__cxa_throw@PLT
+.L206:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC19(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L205:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC18(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L203:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC16(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L202:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC12(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L204:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC17(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE14:
+.L72:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC5(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB15:
+	call	__cxa_throw@PLT
+.LEHE15:
+.L83:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC7(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB16:
+	call	__cxa_throw@PLT
+.LEHE16:
+.L160:
+	movq	%rax, %rbx
+	testl	%ebp, %ebp
+	js	.L76
+.L145:
+	movl	%ebp, %edi
+	call	close@PLT
+.L76:
+	movq	%rbx, %rdi
+.LEHB17:
+	call	_Unwind_Resume@PLT
+.LEHE17:
+.L162:
+.L198:
+	movq	%rax, %rbx
+	jmp	.L145
+.L199:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC6(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB18:
+	call	__cxa_throw@PLT
+.LEHE18:
+.L161:
+	movq	%rax, %rbx
+	testl	%ebp, %ebp
+	js	.L147
+	jmp	.L148
+.L93:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC9(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB19:
+	call	__cxa_throw@PLT
+.LEHE19:
+	.cfi_endproc
+.LFE6954:
+	.section	.gcc_except_table
+.LLSDAC6954:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6954-.LLSDACSBC6954
+.LLSDACSBC6954:
+	.uleb128 .LEHB11-.LCOLDB23
+	.uleb128 .LEHE11-.LEHB11
+	.uleb128 .L161-.LCOLDB23
+	.uleb128 0
+	.uleb128 .LEHB12-.LCOLDB23
+	.uleb128 .LEHE12-.LEHB12
+	.uleb128 .L159-.LCOLDB23
+	.uleb128 0
+	.uleb128 .LEHB13-.LCOLDB23
+	.uleb128 .LEHE13-.LEHB13
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB14-.LCOLDB23
+	.uleb128 .LEHE14-.LEHB14
+	.uleb128 .L159-.LCOLDB23
+	.uleb128 0
+	.uleb128 .LEHB15-.LCOLDB23
+	.uleb128 .LEHE15-.LEHB15
+	.uleb128 .L160-.LCOLDB23
+	.uleb128 0
+	.uleb128 .LEHB16-.LCOLDB23
+	.uleb128 .LEHE16-.LEHB16
+	.uleb128 .L162-.LCOLDB23
+	.uleb128 0
+	.uleb128 .LEHB17-.LCOLDB23
+	.uleb128 .LEHE17-.LEHB17
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB18-.LCOLDB23
+	.uleb128 .LEHE18-.LEHB18
+	.uleb128 .L162-.LCOLDB23
+	.uleb128 0
+	.uleb128 .LEHB19-.LCOLDB23
+	.uleb128 .LEHE19-.LEHB19
+	.uleb128 .L161-.LCOLDB23
+	.uleb128 0
+.LLSDACSEC6954:
+	.section	.text.unlikely
+	.text
+	.size	_Z16test_record_filev, .-_Z16test_record_filev
+	.section	.text.unlikely
+	.size	_Z16test_record_filev.cold, .-_Z16test_record_filev.cold
+.LCOLDE23:
+	.text
+.LHOTE23:
+	.section	.text._ZN1n10std_writerILi1EE8__bufferD2Ev,"axG",@progbits,_ZN1n10std_writerILi1EE8__bufferD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n10std_writerILi1EE8__bufferD2Ev
+	.type	_ZN1n10std_writerILi1EE8__bufferD2Ev, @function
+_ZN1n10std_writerILi1EE8__bufferD2Ev:
+.LFB7218:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7218
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	8(%rdi), %rbp
+	movq	%rdi, %rbx
+	testq	%rbp, %rbp
+	jne	.L222
+.L227:
+	cmpq	$0, (%rbx)
+	movq	$0, 8(%rbx)
+	movb	$0, 32(%rbx)
+	je	.L221
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L239
+.L230:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	16(%rbx), %rdx
+	movl	$64, %ecx
+	movq	(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L221:
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L222:
+	.cfi_restore_state
+	movq	(%rdi), %r12
+.L228:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	$1, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L240
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L228
+	jmp	.L227
+	.p2align 4,,10
+	.p2align 3
+.L240:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L227
+	jmp	.L228
+	.p2align 4,,10
+	.p2align 3
+.L239:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L230
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L230
+	.cfi_endproc
+.LFE7218:
+	.section	.gcc_except_table
+.LLSDA7218:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7218-.LLSDACSB7218
+.LLSDACSB7218:
+.LLSDACSE7218:
+	.section	.text._ZN1n10std_writerILi1EE8__bufferD2Ev,"axG",@progbits,_ZN1n10std_writerILi1EE8__bufferD5Ev,comdat
+	.size	_ZN1n10std_writerILi1EE8__bufferD2Ev, .-_ZN1n10std_writerILi1EE8__bufferD2Ev
+	.weak	_ZN1n10std_writerILi1EE8__bufferD1Ev
+	.set	_ZN1n10std_writerILi1EE8__bufferD1Ev,_ZN1n10std_writerILi1EE8__bufferD2Ev
+	.section	.text._ZN1n4fileIcLNS_4modeE6EED2Ev,"axG",@progbits,_ZN1n4fileIcLNS_4modeE6EED5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4fileIcLNS_4modeE6EED2Ev
+	.type	_ZN1n4fileIcLNS_4modeE6EED2Ev, @function
+_ZN1n4fileIcLNS_4modeE6EED2Ev:
+.LFB6971:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6971
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movl	(%rdi), %ebp
+	testl	%ebp, %ebp
+	js	.L242
+	cmpl	$2, 8(%rdi)
+	je	.L292
+.L243:
+	cmpb	$0, 4(%rbx)
+	jne	.L293
+.L248:
+	movl	$-1, (%rbx)
+.L242:
+	cmpq	$0, 16(%rbx)
+	je	.L249
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L294
+.L251:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	$0, 16(%rbx)
+.L249:
+	movq	48(%rbx), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 8(%rbx)
+	movups	%xmm0, 32(%rbx)
+	testq	%rdi, %rdi
+	je	.L253
+	call	fclose@PLT
+	movl	(%rbx), %ebp
+	movq	$0, 48(%rbx)
+	testl	%ebp, %ebp
+	js	.L290
+	cmpl	$2, 8(%rbx)
+	jne	.L257
+	movq	40(%rbx), %r12
+	testq	%r12, %r12
+	jne	.L295
+.L257:
+	cmpb	$0, 4(%rbx)
+	jne	.L296
+.L263:
+	movl	$-1, (%rbx)
+.L290:
+	movq	16(%rbx), %rax
+	testq	%rax, %rax
+	je	.L241
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L297
+.L266:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L241:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L292:
+	.cfi_restore_state
+	movq	40(%rdi), %r12
+	testq	%r12, %r12
+	je	.L243
+	movq	16(%rdi), %r13
+.L247:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L298
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L247
+	.p2align 4,,10
+	.p2align 3
+.L246:
+	movq	$0, 40(%rbx)
+	jmp	.L243
+	.p2align 4,,10
+	.p2align 3
+.L253:
+	movl	(%rbx), %eax
+	testl	%eax, %eax
+	js	.L241
+	cmpb	$0, 4(%rbx)
+	je	.L263
+.L296:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L263
+	.p2align 4,,10
+	.p2align 3
+.L293:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L248
+	.p2align 4,,10
+	.p2align 3
+.L297:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L266
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L266
+	.p2align 4,,10
+	.p2align 3
+.L294:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L251
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L251
+	.p2align 4,,10
+	.p2align 3
+.L295:
+	movq	16(%rbx), %r13
+.L262:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L299
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L262
+	.p2align 4,,10
+	.p2align 3
+.L261:
+	movq	$0, 40(%rbx)
+	jmp	.L257
+	.p2align 4,,10
+	.p2align 3
+.L298:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L246
+	jmp	.L247
+	.p2align 4,,10
+	.p2align 3
+.L299:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L261
+	jmp	.L262
+	.cfi_endproc
+.LFE6971:
+	.section	.gcc_except_table
+.LLSDA6971:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6971-.LLSDACSB6971
+.LLSDACSB6971:
+.LLSDACSE6971:
+	.section	.text._ZN1n4fileIcLNS_4modeE6EED2Ev,"axG",@progbits,_ZN1n4fileIcLNS_4modeE6EED5Ev,comdat
+	.size	_ZN1n4fileIcLNS_4modeE6EED2Ev, .-_ZN1n4fileIcLNS_4modeE6EED2Ev
+	.weak	_ZN1n4fileIcLNS_4modeE6EED1Ev
+	.set	_ZN1n4fileIcLNS_4modeE6EED1Ev,_ZN1n4fileIcLNS_4modeE6EED2Ev
+	.text
+	.align 2
+	.p2align 4
+	.type	_ZN1n7fd_file5writeEPKvm.constprop.0.isra.0, @function
+_ZN1n7fd_file5writeEPKvm.constprop.0.isra.0:
+.LFB7236:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movq	%rdi, %rbx
+	movl	(%rdi), %edi
+	testl	%edi, %edi
+	js	.L300
+	cmpl	$1, 8(%rbx)
+	movq	%rsi, %rbp
+	je	.L389
+.L302:
+	movq	24(%rbx), %rax
+	movl	$2, 8(%rbx)
+	cmpq	$1, %rax
+	ja	.L304
+	movq	40(%rbx), %r13
+	movl	(%rbx), %r14d
+	testq	%r13, %r13
+	jne	.L390
+.L305:
+	movq	%rbp, %r13
+	movl	$1, %r12d
+.L317:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%r14d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L391
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L317
+	jmp	.L316
+	.p2align 4,,10
+	.p2align 3
+.L304:
+	movq	16(%rbx), %r12
+	testq	%r12, %r12
+	je	.L392
+.L320:
+	movq	40(%rbx), %r13
+	cmpq	%rax, %r13
+	je	.L325
+.L346:
+	addq	%r13, %r12
+.L326:
+	movzbl	0(%rbp), %eax
+	movb	%al, (%r12)
+	addq	$1, 40(%rbx)
+.L316:
+	movl	12(%rbx), %eax
+	cmpl	$2, %eax
+	je	.L343
+	cmpl	$1, %eax
+	jne	.L300
+.L319:
+	movl	$1, %edx
+	movl	$10, %esi
+	movq	%rbp, %rdi
+	call	memchr@PLT
+	testq	%rax, %rax
+	je	.L300
+.L343:
+	cmpl	$2, 8(%rbx)
+	jne	.L300
+	movq	40(%rbx), %rbp
+	testq	%rbp, %rbp
+	jne	.L393
+.L300:
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L389:
+	.cfi_restore_state
+	movq	40(%rbx), %rax
+	movq	32(%rbx), %rsi
+	cmpq	%rsi, %rax
+	jne	.L394
+	pxor	%xmm0, %xmm0
+	movups	%xmm0, 32(%rbx)
+	jmp	.L302
+	.p2align 4,,10
+	.p2align 3
+.L394:
+	subq	%rax, %rsi
+	movl	$1, %edx
+	call	lseek@PLT
+	pxor	%xmm0, %xmm0
+	movups	%xmm0, 32(%rbx)
+	jmp	.L302
+	.p2align 4,,10
+	.p2align 3
+.L325:
+	cmpl	$2, 8(%rbx)
+	jne	.L346
+	testq	%rax, %rax
+	je	.L346
+	movl	(%rbx), %r14d
+.L332:
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+	movl	%r14d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L395
+	addq	%rax, %r12
+	subq	%rax, %r13
+	jne	.L332
+.L331:
+	movq	$0, 40(%rbx)
+	movq	16(%rbx), %r12
+	jmp	.L326
+	.p2align 4,,10
+	.p2align 3
+.L391:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L316
+	jmp	.L317
+	.p2align 4,,10
+	.p2align 3
+.L390:
+	movq	16(%rbx), %r12
+.L310:
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+	movl	%r14d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L396
+	addq	%rax, %r12
+	subq	%rax, %r13
+	jne	.L310
+	movq	$0, 40(%rbx)
+	movl	(%rbx), %r14d
+	jmp	.L305
+	.p2align 4,,10
+	.p2align 3
+.L396:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L310
+	cmpl	$1, 12(%rbx)
+	movq	$0, 40(%rbx)
+	je	.L319
+	jmp	.L300
+	.p2align 4,,10
+	.p2align 3
+.L393:
+	movq	16(%rbx), %r12
+	movl	(%rbx), %r13d
+.L342:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%r13d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L397
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L342
+	.p2align 4,,10
+	.p2align 3
+.L341:
+	movq	$0, 40(%rbx)
+	jmp	.L300
+	.p2align 4,,10
+	.p2align 3
+.L397:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L341
+	jmp	.L342
+	.p2align 4,,10
+	.p2align 3
+.L392:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L398
+.L322:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, 16(%rbx)
+	movq	%rax, %r12
+	testq	%rax, %rax
+	jne	.L399
+	movl	(%rbx), %r14d
+	movq	%rbp, %r13
+	movl	$1, %r12d
+.L336:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%r14d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L400
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L336
+	jmp	.L316
+	.p2align 4,,10
+	.p2align 3
+.L400:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L316
+	jmp	.L336
+	.p2align 4,,10
+	.p2align 3
+.L398:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L322
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L322
+.L395:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L331
+	jmp	.L332
+.L399:
+	movq	24(%rbx), %rax
+	jmp	.L320
+	.cfi_endproc
+.LFE7236:
+	.size	_ZN1n7fd_file5writeEPKvm.constprop.0.isra.0, .-_ZN1n7fd_file5writeEPKvm.constprop.0.isra.0
+	.section	.text._ZN1n7fd_file5closeEv,"axG",@progbits,_ZN1n7fd_file5closeEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n7fd_file5closeEv
+	.type	_ZN1n7fd_file5closeEv, @function
+_ZN1n7fd_file5closeEv:
+.LFB6795:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movl	(%rdi), %ebp
+	testl	%ebp, %ebp
+	js	.L402
+	cmpl	$2, 8(%rdi)
+	je	.L423
+.L403:
+	cmpb	$0, 4(%rbx)
+	jne	.L424
+.L408:
+	movl	$-1, (%rbx)
+.L402:
+	cmpq	$0, 16(%rbx)
+	je	.L409
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L425
+.L411:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	$0, 16(%rbx)
+.L409:
+	pxor	%xmm0, %xmm0
+	movl	$0, 8(%rbx)
+	movups	%xmm0, 32(%rbx)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L423:
+	.cfi_restore_state
+	movq	40(%rdi), %r12
+	testq	%r12, %r12
+	je	.L403
+	movq	16(%rdi), %r13
+.L407:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L426
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L407
+	.p2align 4,,10
+	.p2align 3
+.L406:
+	movq	$0, 40(%rbx)
+	jmp	.L403
+	.p2align 4,,10
+	.p2align 3
+.L424:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L408
+	.p2align 4,,10
+	.p2align 3
+.L425:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L411
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L411
+	.p2align 4,,10
+	.p2align 3
+.L426:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L406
+	jmp	.L407
+	.cfi_endproc
+.LFE6795:
+	.size	_ZN1n7fd_file5closeEv, .-_ZN1n7fd_file5closeEv
+	.section	.text._ZN1n7fd_file4peekEm,"axG",@progbits,_ZN1n7fd_file4peekEm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n7fd_file4peekEm
+	.type	_ZN1n7fd_file4peekEm, @function
+_ZN1n7fd_file4peekEm:
+.LFB6797:
+	.cfi_startproc
+	movl	(%rdi), %eax
+	testl	%eax, %eax
+	jns	.L428
+	xorl	%eax, %eax
+	xorl	%edx, %edx
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L428:
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	movq	16(%rdi), %rbp
+	testq	%rbp, %rbp
+	je	.L468
+.L430:
+	cmpl	$2, 8(%rbx)
+	movq	40(%rbx), %r14
+	je	.L469
+.L435:
+	movq	32(%rbx), %rax
+	movq	%r14, %rdx
+	movl	$1, 8(%rbx)
+	subq	%rax, %rdx
+	cmpq	%r12, %rdx
+	jnb	.L440
+	cmpb	$0, 5(%rbx)
+	jne	.L440
+	movzbl	6(%rbx), %r15d
+	testb	%r15b, %r15b
+	jne	.L440
+	testq	%rax, %rax
+	jne	.L470
+.L441:
+	movq	24(%rbx), %r13
+	cmpq	%r12, %r13
+	cmovbe	%r13, %r12
+	cmpq	%r12, %r14
+	jnb	.L448
+	.p2align 4,,10
+	.p2align 3
+.L447:
+	subq	%r14, %r13
+	addq	%r14, %rbp
+	movl	(%rbx), %r14d
+	jmp	.L444
+	.p2align 4,,10
+	.p2align 3
+.L472:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L471
+.L444:
+	movq	%r13, %rdx
+	movq	%rbp, %rsi
+	movl	%r14d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L472
+	movq	16(%rbx), %rcx
+	movq	40(%rbx), %rdx
+	movq	%rcx, %rbp
+	je	.L473
+	leaq	(%rax,%rdx), %r14
+	movq	%r14, 40(%rbx)
+	cmpq	%r12, %r14
+	jnb	.L474
+	movq	24(%rbx), %r13
+	jmp	.L447
+	.p2align 4,,10
+	.p2align 3
+.L471:
+	movq	16(%rbx), %rcx
+	movq	40(%rbx), %rdx
+	movl	$1, %eax
+.L443:
+	movb	%al, 6(%rbx)
+	movq	32(%rbx), %rax
+	movq	%rcx, %rbp
+	movb	%r15b, 5(%rbx)
+	subq	%rax, %rdx
+.L440:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	addq	%rbp, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L468:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L475
+.L432:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, 16(%rbx)
+	movq	%rax, %rbp
+	testq	%rax, %rax
+	jne	.L430
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	xorl	%eax, %eax
+	xorl	%edx, %edx
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L469:
+	.cfi_restore_state
+	testq	%r14, %r14
+	je	.L435
+	movl	(%rbx), %r13d
+.L439:
+	movq	%r14, %rdx
+	movq	%rbp, %rsi
+	movl	%r13d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L476
+	addq	%rax, %rbp
+	subq	%rax, %r14
+	jne	.L439
+.L438:
+	movq	$0, 40(%rbx)
+	movq	16(%rbx), %rbp
+	xorl	%r14d, %r14d
+	jmp	.L435
+	.p2align 4,,10
+	.p2align 3
+.L475:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L432
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L432
+.L476:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L438
+	jmp	.L439
+.L474:
+	movq	32(%rbx), %rax
+	movq	%r14, %rdx
+	subq	%rax, %rdx
+	jmp	.L440
+.L470:
+	leaq	0(%rbp,%rax), %rsi
+	movq	%rbp, %rdi
+	call	memmove@PLT
+	movq	40(%rbx), %rax
+	subq	32(%rbx), %rax
+	movq	$0, 32(%rbx)
+	movq	%rax, 40(%rbx)
+	movq	16(%rbx), %rbp
+	movq	%rax, %r14
+	movq	%rax, %rdx
+	jmp	.L441
+.L473:
+	xorl	%eax, %eax
+	movl	$1, %r15d
+	jmp	.L443
+.L448:
+	xorl	%eax, %eax
+	jmp	.L440
+	.cfi_endproc
+.LFE6797:
+	.size	_ZN1n7fd_file4peekEm, .-_ZN1n7fd_file4peekEm
+	.section	.rodata._ZN1n4test10test_suite7run_allEv.str1.1,"aMS",@progbits,1
+.LC24:
+	.string	"\nSUITE [%s] "
+.LC26:
+	.string	"%s"
+.LC27:
+	.string	"\nTEST [%s] "
+.LC28:
+	.string	" - Result : \033[1;32mPASSED\033[0m"
+.LC29:
+	.string	"\033[1;31merror : %s\033[0m\n"
+.LC30:
+	.string	" - Result : \033[1;31mFAILED\033[0m"
+.LC31:
+	.string	" - Passed : \033[1;32m%d\033[0m\n"
+.LC32:
+	.string	" - Failed : \033[1;31m%d\033[0m\n"
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4test10test_suite7run_allEv
+	.type	_ZN1n4test10test_suite7run_allEv, @function
+_ZN1n4test10test_suite7run_allEv:
+.LFB6902:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6902
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	leaq	.LC24(%rip), %rdx
+	movl	$79, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	16(%rdi), %rcx
+	leaq	16(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L478
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L479
+	testb	$4, %cl
+	jne	.L532
+	testl	%ecx, %ecx
+	je	.L478
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L533
+	.p2align 4,,10
+	.p2align 3
+.L478:
+	movzwl	.LC25(%rip), %r15d
+	movq	%rbx, %rsi
+	leaq	.LC26(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+.LEHB20:
+	call	printf@PLT
+	movl	8(%r12), %esi
+	testl	%esi, %esi
+	jle	.L499
+	movl	$0, 12(%rsp)
+	xorl	%ebp, %ebp
+	xorl	%r14d, %r14d
+	jmp	.L493
+	.p2align 4,,10
+	.p2align 3
+.L536:
+	testb	$4, %dl
+	jne	.L534
+	testl	%edx, %edx
+	je	.L484
+	movb	$42, (%rax)
+	testb	$2, %dl
+	jne	.L535
+	.p2align 4,,10
+	.p2align 3
+.L484:
+	movq	%rbx, %rsi
+	leaq	.LC26(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+.LEHE20:
+	movq	(%r12), %rax
+.LEHB21:
+	call	*8(%rax,%r13)
+.LEHE21:
+	leaq	.LC28(%rip), %rdi
+	addl	$1, %r14d
+.LEHB22:
+	call	puts@PLT
+.L489:
+	addq	$1, %rbp
+	cmpl	%ebp, 8(%r12)
+	jle	.L483
+.L493:
+	movq	(%r12), %rax
+	movq	%rbp, %r13
+	movq	%rbx, %rdi
+	movl	$79, %esi
+	salq	$4, %r13
+	leaq	.LC27(%rip), %rdx
+	movq	(%rax,%r13), %rcx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L484
+	movl	$79, %edx
+	subl	%eax, %edx
+	addq	%rbx, %rax
+	cmpl	$8, %edx
+	jb	.L536
+	movabsq	$3038287259199220266, %rsi
+	leaq	8(%rax), %rdi
+	movl	%edx, %ecx
+	andq	$-8, %rdi
+	movq	%rsi, (%rax)
+	movq	%rsi, -8(%rax,%rcx)
+	subq	%rdi, %rax
+	leal	(%rdx,%rax), %ecx
+	movq	%rsi, %rax
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L484
+.L499:
+	movl	$0, 12(%rsp)
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L483:
+	movabsq	$5917806138674729738, %rax
+	movq	%rbx, %rdi
+	movq	%rax, 16(%rsp)
+	movabsq	$9095440486453792, %rax
+	movq	%rax, 22(%rsp)
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L494
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L495
+	testb	$4, %cl
+	jne	.L537
+	testl	%ecx, %ecx
+	je	.L494
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L538
+.L494:
+	movq	%rbx, %rsi
+	leaq	.LC26(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+	movl	%r14d, %esi
+	leaq	.LC31(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	12(%rsp), %esi
+	leaq	.LC32(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	$10, %edi
+	call	putchar@PLT
+.LEHE22:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L495:
+	.cfi_restore_state
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L494
+.L479:
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L478
+.L534:
+	movl	$707406378, (%rax)
+	movl	$707406378, -4(%rax,%rdx)
+	jmp	.L484
+.L535:
+	movl	$10794, %ecx
+	movw	%cx, -2(%rax,%rdx)
+	jmp	.L484
+.L533:
+	movl	$10794, %edi
+	movw	%di, -2(%rdx,%rcx)
+	jmp	.L478
+.L538:
+	movl	$10794, %eax
+	movw	%ax, -2(%rdx,%rcx)
+	jmp	.L494
+.L532:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L478
+.L537:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L494
+.L500:
+	movq	%rax, %rdi
+	movq	%rdx, %rax
+.L490:
+	subq	$1, %rax
+	jne	.L531
+	call	__cxa_begin_catch@PLT
+	leaq	.LC29(%rip), %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+.LEHB23:
+	call	printf@PLT
+.LEHE23:
+	call	__cxa_end_catch@PLT
+	leaq	.LC30(%rip), %rdi
+	addl	$1, 12(%rsp)
+.LEHB24:
+	call	puts@PLT
+	jmp	.L489
+.L492:
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+.L531:
+	call	_Unwind_Resume@PLT
+.LEHE24:
+.L501:
+	movq	%rax, %rbx
+	jmp	.L492
+	.cfi_endproc
+.LFE6902:
+	.section	.gcc_except_table
+	.align 4
+.LLSDA6902:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT6902-.LLSDATTD6902
+.LLSDATTD6902:
+	.byte	0x1
+	.uleb128 .LLSDACSE6902-.LLSDACSB6902
+.LLSDACSB6902:
+	.uleb128 .LEHB20-.LFB6902
+	.uleb128 .LEHE20-.LEHB20
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB21-.LFB6902
+	.uleb128 .LEHE21-.LEHB21
+	.uleb128 .L500-.LFB6902
+	.uleb128 0x1
+	.uleb128 .LEHB22-.LFB6902
+	.uleb128 .LEHE22-.LEHB22
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB23-.LFB6902
+	.uleb128 .LEHE23-.LEHB23
+	.uleb128 .L501-.LFB6902
+	.uleb128 0
+	.uleb128 .LEHB24-.LFB6902
+	.uleb128 .LEHE24-.LEHB24
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6902:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	DW.ref._ZTIPKc-.
+.LLSDATT6902:
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.size	_ZN1n4test10test_suite7run_allEv, .-_ZN1n4test10test_suite7run_allEv
+	.text
+	.p2align 4
+	.globl	_ZeqRKN1n6stringIcEEPKc
+	.type	_ZeqRKN1n6stringIcEEPKc, @function
+_ZeqRKN1n6stringIcEEPKc:
+.LFB6903:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	movq	%rsi, %rdi
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	call	strlen@PLT
+	cmpq	$23, 8(%rbx)
+	movq	(%rbx), %rcx
+	leaq	24(%rbx), %rdi
+	movq	%rax, %rdx
+	je	.L541
+	movq	24(%rbx), %rdi
+.L541:
+	xorl	%eax, %eax
+	cmpq	%rcx, %rdx
+	je	.L547
+.L539:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L547:
+	.cfi_restore_state
+	movl	$1, %eax
+	testq	%rdx, %rdx
+	je	.L539
+	movq	%rbp, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	sete	%al
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE6903:
+	.size	_ZeqRKN1n6stringIcEEPKc, .-_ZeqRKN1n6stringIcEEPKc
+	.p2align 4
+	.globl	_ZeqRKN1n6stringIcEES3_
+	.type	_ZeqRKN1n6stringIcEES3_, @function
+_ZeqRKN1n6stringIcEES3_:
+.LFB6905:
+	.cfi_startproc
+	cmpq	$23, 8(%rsi)
+	movq	(%rsi), %rcx
+	je	.L561
+	movq	24(%rsi), %rsi
+.L550:
+	cmpq	$23, 8(%rdi)
+	movq	(%rdi), %rdx
+	je	.L562
+	movq	24(%rdi), %rdi
+.L552:
+	xorl	%eax, %eax
+	cmpq	%rcx, %rdx
+	je	.L563
+.L558:
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L563:
+	movl	$1, %eax
+	testq	%rdx, %rdx
+	je	.L558
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	call	memcmp@PLT
+	testl	%eax, %eax
+	sete	%al
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L562:
+	addq	$24, %rdi
+	jmp	.L552
+	.p2align 4,,10
+	.p2align 3
+.L561:
+	addq	$24, %rsi
+	jmp	.L550
+	.cfi_endproc
+.LFE6905:
+	.size	_ZeqRKN1n6stringIcEES3_, .-_ZeqRKN1n6stringIcEES3_
+	.section	.rodata.str1.1
+.LC33:
+	.string	"IO file test suite"
+	.section	.rodata.str1.8
+	.align 8
+.LC34:
+	.string	"test_file_iterator_readable_mode"
+	.align 8
+.LC35:
+	.string	"test_file_oterator_writable_mode"
+	.section	.rodata.str1.1
+.LC36:
+	.string	"test_file_pathable_mode"
+.LC37:
+	.string	"test_file_stdin_mode"
+.LC38:
+	.string	"test_file_stdout_mode"
+.LC39:
+	.string	"test_file_stdout_exit"
+.LC40:
+	.string	"test_file_chunked_copy"
+.LC41:
+	.string	"test_mmap_file"
+.LC42:
+	.string	"test_record_file"
+.LC43:
+	.string	"test_record_file_threads"
+	.section	.text.unlikely
+.LCOLDB45:
+	.section	.text.startup,"ax",@progbits
+.LHOTB45:
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB6959:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6959
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$1600, %edi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 64
+.LEHB25:
+	call	_Znam@PLT
+.LEHE25:
+	movq	%rax, %rbx
+	leaq	1600(%rax), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L565:
+	movq	$0, (%rax)
+	addq	$16, %rax
+	movq	$0, -8(%rax)
+	cmpq	%rax, %rdx
+	jne	.L565
+	leaq	.LC33(%rip), %rax
+	movq	%rsp, %rdi
+	movq	%rbx, (%rsp)
+	movq	%rax, 16(%rsp)
+	leaq	.LC34(%rip), %rax
+	movq	%rax, (%rbx)
+	leaq	_Z32test_file_iterator_readable_modev(%rip), %rax
+	movq	%rax, 8(%rbx)
+	leaq	.LC35(%rip), %rax
+	movq	%rax, 16(%rbx)
+	leaq	_Z32test_file_oterator_writable_modev(%rip), %rax
+	movq	%rax, 24(%rbx)
+	leaq	.LC36(%rip), %rax
+	movq	%rax, 32(%rbx)
+	leaq	_Z23test_file_pathable_modev(%rip), %rax
+	movq	%rax, 40(%rbx)
+	leaq	.LC37(%rip), %rax
+	movq	%rax, 48(%rbx)
+	leaq	_Z20test_file_stdin_modev(%rip), %rax
+	movq	%rax, 56(%rbx)
+	leaq	.LC38(%rip), %rax
+	movq	%rax, 64(%rbx)
+	leaq	_Z21test_file_stdout_modev(%rip), %rax
+	movq	%rax, 72(%rbx)
+	leaq	.LC39(%rip), %rax
+	movq	%rax, 80(%rbx)
+	leaq	_Z21test_file_stdout_exitv(%rip), %rax
+	movq	%rax, 88(%rbx)
+	leaq	.LC40(%rip), %rax
+	movq	%rax, 96(%rbx)
+	leaq	_Z22test_file_chunked_copyv(%rip), %rax
+	movq	%rax, 104(%rbx)
+	leaq	.LC41(%rip), %rax
+	movq	%rax, 112(%rbx)
+	leaq	_Z14test_mmap_filev(%rip), %rax
+	movq	%rax, 120(%rbx)
+	leaq	.LC42(%rip), %rax
+	movq	%rax, 128(%rbx)
+	leaq	_Z16test_record_filev(%rip), %rax
+	movq	%rax, 136(%rbx)
+	leaq	.LC43(%rip), %rax
+	movq	%rax, 144(%rbx)
+	leaq	_Z24test_record_file_threadsv(%rip), %rax
+	movq	%rax, 152(%rbx)
+	movq	.LC44(%rip), %rax
+	movq	%rax, 8(%rsp)
+.LEHB26:
+	call	_ZN1n4test10test_suite7run_allEv
+.LEHE26:
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L567:
+	.cfi_restore_state
+	movq	%rax, %rbp
+	jmp	.L566
+	.section	.gcc_except_table
+.LLSDA6959:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6959-.LLSDACSB6959
+.LLSDACSB6959:
+	.uleb128 .LEHB25-.LFB6959
+	.uleb128 .LEHE25-.LEHB25
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB26-.LFB6959
+	.uleb128 .LEHE26-.LEHB26
+	.uleb128 .L567-.LFB6959
+	.uleb128 0
+.LLSDACSE6959:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6959
+	.type	main.cold, @function
+main.cold:
+.LFSB6959:
+.L566:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	movq	%rbp, %rdi
+.LEHB27:
+	call	_Unwind_Resume@PLT
+.LEHE27:
+	.cfi_endproc
+.LFE6959:
+	.section	.gcc_except_table
+.LLSDAC6959:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6959-.LLSDACSBC6959
+.LLSDACSBC6959:
+	.uleb128 .LEHB27-.LCOLDB45
+	.uleb128 .LEHE27-.LEHB27
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6959:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	main, .-main
+	.section	.text.unlikely
+	.size	main.cold, .-main.cold
+.LCOLDE45:
+	.section	.text.startup
+.LHOTE45:
+	.section	.text._ZN1n4fileIcLNS_4modeE6EE5closeEv,"axG",@progbits,_ZN1n4fileIcLNS_4modeE6EE5closeEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4fileIcLNS_4modeE6EE5closeEv
+	.type	_ZN1n4fileIcLNS_4modeE6EE5closeEv, @function
+_ZN1n4fileIcLNS_4modeE6EE5closeEv:
+.LFB7106:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movl	(%rdi), %ebp
+	testl	%ebp, %ebp
+	js	.L573
+	cmpl	$2, 8(%rdi)
+	je	.L598
+.L574:
+	cmpb	$0, 4(%rbx)
+	jne	.L599
+.L579:
+	movl	$-1, (%rbx)
+.L573:
+	cmpq	$0, 16(%rbx)
+	je	.L580
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L600
+.L582:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	$0, 16(%rbx)
+.L580:
+	movq	48(%rbx), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 8(%rbx)
+	movups	%xmm0, 32(%rbx)
+	testq	%rdi, %rdi
+	je	.L572
+	call	fclose@PLT
+	movq	$0, 48(%rbx)
+.L572:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L598:
+	.cfi_restore_state
+	movq	40(%rdi), %r12
+	testq	%r12, %r12
+	je	.L574
+	movq	16(%rdi), %r13
+.L578:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L601
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L578
+	.p2align 4,,10
+	.p2align 3
+.L577:
+	movq	$0, 40(%rbx)
+	jmp	.L574
+	.p2align 4,,10
+	.p2align 3
+.L599:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L579
+	.p2align 4,,10
+	.p2align 3
+.L600:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L582
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L582
+	.p2align 4,,10
+	.p2align 3
+.L601:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L577
+	jmp	.L578
+	.cfi_endproc
+.LFE7106:
+	.size	_ZN1n4fileIcLNS_4modeE6EE5closeEv, .-_ZN1n4fileIcLNS_4modeE6EE5closeEv
+	.section	.rodata.str1.8
+	.align 8
+.LC47:
+	.string	"expected true : n::stdr.opened()"
+	.section	.text.unlikely
+.LCOLDB48:
+	.text
+.LHOTB48:
+	.p2align 4
+	.globl	_Z20test_file_stdin_modev
+	.type	_Z20test_file_stdin_modev, @function
+_Z20test_file_stdin_modev:
+.LFB6923:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6923
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 96
+	movdqa	.LC46(%rip), %xmm0
+	movl	_ZN1n4stdrE(%rip), %eax
+	movl	$-1, (%rsp)
+	movw	$0, 4(%rsp)
+	movb	$0, 6(%rsp)
+	movq	$0, 8(%rsp)
+	movq	$0, 16(%rsp)
+	movq	$0, 40(%rsp)
+	movq	$0, 48(%rsp)
+	movups	%xmm0, 24(%rsp)
+	testl	%eax, %eax
+	js	.L606
+	addq	$72, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.section	.gcc_except_table
+.LLSDA6923:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6923-.LLSDACSB6923
+.LLSDACSB6923:
+.LLSDACSE6923:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6923
+	.type	_Z20test_file_stdin_modev.cold, @function
+_Z20test_file_stdin_modev.cold:
+.LFSB6923:
+.L606:
+	.cfi_def_cfa_offset 96
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC47(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB28:
+	call	__cxa_throw@PLT
+.LEHE28:
+.L605:
+	movq	%rsp, %rbp
+	movq	%rax, %rbx
+	movq	%rbp, %rdi
+	call	_ZN1n4fileIcLNS_4modeE6EE5closeEv
+	movq	%rbp, %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB29:
+	call	_Unwind_Resume@PLT
+.LEHE29:
+	.cfi_endproc
+.LFE6923:
+	.section	.gcc_except_table
+.LLSDAC6923:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6923-.LLSDACSBC6923
+.LLSDACSBC6923:
+	.uleb128 .LEHB28-.LCOLDB48
+	.uleb128 .LEHE28-.LEHB28
+	.uleb128 .L605-.LCOLDB48
+	.uleb128 0
+	.uleb128 .LEHB29-.LCOLDB48
+	.uleb128 .LEHE29-.LEHB29
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6923:
+	.section	.text.unlikely
+	.text
+	.size	_Z20test_file_stdin_modev, .-_Z20test_file_stdin_modev
+	.section	.text.unlikely
+	.size	_Z20test_file_stdin_modev.cold, .-_Z20test_file_stdin_modev.cold
+.LCOLDE48:
+	.text
+.LHOTE48:
+	.section	.text._ZN1n4fileIcLNS_4modeE2EE5closeEv,"axG",@progbits,_ZN1n4fileIcLNS_4modeE2EE5closeEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4fileIcLNS_4modeE2EE5closeEv
+	.type	_ZN1n4fileIcLNS_4modeE2EE5closeEv, @function
+_ZN1n4fileIcLNS_4modeE2EE5closeEv:
+.LFB7109:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movl	(%rdi), %ebp
+	testl	%ebp, %ebp
+	js	.L609
+	cmpl	$2, 8(%rdi)
+	je	.L634
+.L610:
+	cmpb	$0, 4(%rbx)
+	jne	.L635
+.L615:
+	movl	$-1, (%rbx)
+.L609:
+	cmpq	$0, 16(%rbx)
+	je	.L616
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L636
+.L618:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	$0, 16(%rbx)
+.L616:
+	movq	48(%rbx), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 8(%rbx)
+	movups	%xmm0, 32(%rbx)
+	testq	%rdi, %rdi
+	je	.L608
+	call	fclose@PLT
+	movq	$0, 48(%rbx)
+.L608:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L634:
+	.cfi_restore_state
+	movq	40(%rdi), %r12
+	testq	%r12, %r12
+	je	.L610
+	movq	16(%rdi), %r13
+.L614:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L637
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L614
+	.p2align 4,,10
+	.p2align 3
+.L613:
+	movq	$0, 40(%rbx)
+	jmp	.L610
+	.p2align 4,,10
+	.p2align 3
+.L635:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L615
+	.p2align 4,,10
+	.p2align 3
+.L636:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L618
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L618
+	.p2align 4,,10
+	.p2align 3
+.L637:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L613
+	jmp	.L614
+	.cfi_endproc
+.LFE7109:
+	.size	_ZN1n4fileIcLNS_4modeE2EE5closeEv, .-_ZN1n4fileIcLNS_4modeE2EE5closeEv
+	.section	.rodata.str1.1
+.LC49:
+	.string	"w+"
+.LC50:
+	.string	"test_file.txt"
+.LC51:
+	.string	"Hello\nWorld\n"
+.LC52:
+	.string	"expected true : it.has_next()"
+	.section	.rodata.str1.8
+	.align 8
+.LC53:
+	.string	"expected equal : expected value : it.next(), actual value : 'H'"
+	.align 8
+.LC54:
+	.string	"expected equal : expected value : it.next(), actual value : 'e'"
+	.align 8
+.LC55:
+	.string	"expected equal : expected value : it.next(), actual value : 'l'"
+	.align 8
+.LC56:
+	.string	"expected equal : expected value : it.next(), actual value : 'o'"
+	.align 8
+.LC57:
+	.string	"expected equal : expected value : it.next(), actual value : '\\n'"
+	.align 8
+.LC58:
+	.string	"expected equal : expected value : it.next(), actual value : 'W'"
+	.align 8
+.LC59:
+	.string	"expected equal : expected value : it.next(), actual value : 'r'"
+	.align 8
+.LC60:
+	.string	"expected equal : expected value : it.next(), actual value : 'd'"
+	.align 8
+.LC61:
+	.string	"expected false : it.has_next()"
+	.section	.text.unlikely
+.LCOLDB63:
+	.text
+.LHOTB63:
+	.p2align 4
+	.globl	_Z32test_file_iterator_readable_modev
+	.type	_Z32test_file_iterator_readable_modev, @function
+_Z32test_file_iterator_readable_modev:
+.LFB6906:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6906
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leaq	.LC49(%rip), %rsi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	leaq	.LC50(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rbp, %rdi
+	subq	$136, %rsp
+	.cfi_def_cfa_offset 192
+.LEHB30:
+	call	fopen@PLT
+	movl	$12, %edx
+	movl	$1, %esi
+	leaq	.LC51(%rip), %rdi
+	movq	%rax, %rbx
+	movq	%rax, %rcx
+	call	fwrite@PLT
+	movq	%rbx, %rdi
+	call	rewind@PLT
+.LEHE30:
+	movdqa	.LC46(%rip), %xmm1
+	movl	$4294967295, %eax
+	movq	%rbx, %rdi
+	movq	%rax, 64(%rsp)
+	movq	$0, 72(%rsp)
+	movq	$0, 80(%rsp)
+	movq	$0, 104(%rsp)
+	movq	$0, 112(%rsp)
+	movups	%xmm1, 88(%rsp)
+.LEHB31:
+	call	fflush@PLT
+.LEHE31:
+	movq	%rbx, %rdi
+	movq	%rbx, 112(%rsp)
+	xorl	%r13d, %r13d
+	call	fileno@PLT
+	movl	%eax, %edi
+	call	isatty@PLT
+	movq	%rbx, %rdi
+	leaq	64(%rsp), %rbx
+	testl	%eax, %eax
+	setne	%r13b
+	call	fileno@PLT
+	movdqa	.LC46(%rip), %xmm3
+	movq	%rbx, %rdi
+	movw	$0, 20(%rsp)
+	movl	%eax, 16(%rsp)
+	movl	%eax, %r12d
+	movb	$0, 22(%rsp)
+	movl	$0, 24(%rsp)
+	movl	%r13d, 28(%rsp)
+	movq	$0, 32(%rsp)
+	movq	$0, 56(%rsp)
+	movups	%xmm3, 40(%rsp)
+.LEHB32:
+	call	_ZN1n7fd_file5closeEv
+.LEHE32:
+	movdqa	.LC46(%rip), %xmm2
+	movl	%r12d, 64(%rsp)
+	movw	$0, 68(%rsp)
+	movb	$0, 70(%rsp)
+	movl	$0, 72(%rsp)
+	movl	%r13d, 76(%rsp)
+	movq	$0, 80(%rsp)
+	movq	$0, 104(%rsp)
+	movups	%xmm2, 88(%rsp)
+	testl	%r12d, %r12d
+	jns	.L1030
+.L648:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC52(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB33:
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L1030:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1031
+.L644:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	88(%rsp), %r13
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%r13, %rsi
+	call	*16(%rax)
+	movq	%rax, 80(%rsp)
+	movq	%rax, %r12
+	testq	%rax, %rax
+	je	.L648
+	cmpl	$2, 72(%rsp)
+	movq	104(%rsp), %r14
+	je	.L1032
+.L649:
+	movl	$1, 72(%rsp)
+	cmpq	%r14, 96(%rsp)
+	je	.L1033
+.L656:
+	movl	$1, %esi
+	movq	%rbx, %rdi
+	call	_ZN1n7fd_file4peekEm
+	movl	72(%rsp), %edx
+	movzbl	(%rax), %ecx
+	cmpl	$1, %edx
+	jne	.L662
+	movq	96(%rsp), %rsi
+	movq	104(%rsp), %rax
+	movl	$1, %edi
+	subq	%rsi, %rax
+	cmpq	$0, %rax
+	cmova	%rdi, %rax
+	addq	%rsi, %rax
+	movq	%rax, 96(%rsp)
+.L662:
+	cmpb	$72, %cl
+	jne	.L1034
+	movl	64(%rsp), %r10d
+	testl	%r10d, %r10d
+	js	.L673
+	movq	80(%rsp), %r12
+	testq	%r12, %r12
+	je	.L1035
+.L667:
+	movq	104(%rsp), %r13
+	cmpl	$2, %edx
+	je	.L1036
+.L674:
+	movl	$1, 72(%rsp)
+	cmpq	96(%rsp), %r13
+	je	.L1037
+.L681:
+	movl	$1, %esi
+	movq	%rbx, %rdi
+	call	_ZN1n7fd_file4peekEm
+	movl	72(%rsp), %edx
+	movzbl	(%rax), %ecx
+	cmpl	$1, %edx
+	jne	.L687
+	movq	96(%rsp), %rsi
+	movq	104(%rsp), %rax
+	movl	$1, %edi
+	subq	%rsi, %rax
+	cmpq	$0, %rax
+	cmova	%rdi, %rax
+	addq	%rsi, %rax
+	movq	%rax, 96(%rsp)
+.L687:
+	cmpb	$101, %cl
+	jne	.L1017
+	movl	64(%rsp), %r9d
+	testl	%r9d, %r9d
+	jns	.L1038
+.L697:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC52(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L1038:
+	movq	80(%rsp), %r12
+	testq	%r12, %r12
+	je	.L1039
+.L691:
+	movq	104(%rsp), %r13
+	cmpl	$2, %edx
+	je	.L1040
+.L698:
+	movl	$1, 72(%rsp)
+	cmpq	%r13, 96(%rsp)
+	je	.L1041
+.L705:
+	movl	$1, %esi
+	movq	%rbx, %rdi
+	call	_ZN1n7fd_file4peekEm
+	movl	72(%rsp), %edx
+	movzbl	(%rax), %ecx
+	cmpl	$1, %edx
+	jne	.L711
+	movq	96(%rsp), %rsi
+	movq	104(%rsp), %rax
+	movl	$1, %edi
+	subq	%rsi, %rax
+	cmpq	$0, %rax
+	cmova	%rdi, %rax
+	addq	%rsi, %rax
+	movq	%rax, 96(%rsp)
+.L711:
+	cmpb	$108, %cl
+	jne	.L1018
+	movl	64(%rsp), %r8d
+	testl	%r8d, %r8d
+	jns	.L1042
+.L721:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC52(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L1042:
+	movq	80(%rsp), %r12
+	testq	%r12, %r12
+	je	.L1043
+.L715:
+	movq	104(%rsp), %r13
+	cmpl	$2, %edx
+	je	.L1044
+.L722:
+	movl	$1, 72(%rsp)
+	cmpq	%r13, 96(%rsp)
+	je	.L1045
+.L729:
+	movl	$1, %esi
+	movq	%rbx, %rdi
+	call	_ZN1n7fd_file4peekEm
+	movl	72(%rsp), %edx
+	movzbl	(%rax), %ecx
+	cmpl	$1, %edx
+	jne	.L735
+	movq	96(%rsp), %rsi
+	movq	104(%rsp), %rax
+	movl	$1, %edi
+	subq	%rsi, %rax
+	cmpq	$0, %rax
+	cmova	%rdi, %rax
+	addq	%rsi, %rax
+	movq	%rax, 96(%rsp)
+.L735:
+	cmpb	$108, %cl
+	jne	.L1019
+	movl	64(%rsp), %edi
+	testl	%edi, %edi
+	js	.L745
+	movq	80(%rsp), %r12
+	testq	%r12, %r12
+	je	.L1046
+.L739:
+	movq	104(%rsp), %r13
+	cmpl	$2, %edx
+	je	.L1047
+.L746:
+	movl	$1, 72(%rsp)
+	cmpq	96(%rsp), %r13
+	je	.L1048
+.L753:
+	movl	$1, %esi
+	movq	%rbx, %rdi
+	call	_ZN1n7fd_file4peekEm
+	movl	72(%rsp), %edx
+	movzbl	(%rax), %ecx
+	cmpl	$1, %edx
+	jne	.L759
+	movq	96(%rsp), %rsi
+	movq	104(%rsp), %rax
+	movl	$1, %edi
+	subq	%rsi, %rax
+	cmpq	$0, %rax
+	cmova	%rdi, %rax
+	addq	%rsi, %rax
+	movq	%rax, 96(%rsp)
+.L759:
+	cmpb	$111, %cl
+	jne	.L1020
+	movl	64(%rsp), %esi
+	testl	%esi, %esi
+	js	.L769
+	movq	80(%rsp), %r12
+	testq	%r12, %r12
+	je	.L1049
+.L763:
+	movq	104(%rsp), %r14
+	cmpl	$2, %edx
+	je	.L1050
+.L770:
+	movq	96(%rsp), %rcx
+	movl	$1, 72(%rsp)
+	cmpq	%r14, %rcx
+	je	.L1051
+	movq	%r14, %rax
+	movl	64(%rsp), %r13d
+	leaq	(%r12,%rcx), %rsi
+	subq	%rcx, %rax
+.L783:
+	testl	%r13d, %r13d
+	js	.L784
+	cmpq	$0, %rax
+	movl	$1, %edx
+	cmova	%rdx, %rax
+	addq	%rcx, %rax
+	cmpb	$10, (%rsi)
+	movq	%rax, 96(%rsp)
+	jne	.L1021
+	cmpq	%rax, %r14
+	jne	.L786
+	cmpb	$0, 69(%rsp)
+	jne	.L793
+	movzbl	70(%rsp), %r15d
+	testb	%r15b, %r15b
+	jne	.L793
+	testq	%r14, %r14
+	jne	.L1052
+.L788:
+	movq	88(%rsp), %r14
+	testq	%r14, %r14
+	jne	.L791
+	jmp	.L1053
+	.p2align 4,,10
+	.p2align 3
+.L1055:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1054
+.L791:
+	movq	%r14, %rdx
+	movq	%r12, %rsi
+	movl	%r13d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L1055
+	je	.L1056
+	movq	%rax, 104(%rsp)
+.L786:
+	movl	$1, %esi
+	movq	%rbx, %rdi
+	call	_ZN1n7fd_file4peekEm
+	movl	72(%rsp), %edx
+	movzbl	(%rax), %ecx
+	cmpl	$1, %edx
+	jne	.L794
+	movq	96(%rsp), %rsi
+	movq	104(%rsp), %rax
+	movl	$1, %edi
+	subq	%rsi, %rax
+	cmpq	$0, %rax
+	cmova	%rdi, %rax
+	addq	%rsi, %rax
+	movq	%rax, 96(%rsp)
+.L794:
+	cmpb	$87, %cl
+	jne	.L1022
+	movl	64(%rsp), %ecx
+	testl	%ecx, %ecx
+	js	.L804
+	movq	80(%rsp), %r12
+	testq	%r12, %r12
+	je	.L1057
+.L798:
+	movq	104(%rsp), %r14
+	cmpl	$2, %edx
+	je	.L1058
+.L805:
+	movq	96(%rsp), %rcx
+	movl	$1, 72(%rsp)
+	cmpq	%r14, %rcx
+	jne	.L812
+	cmpb	$0, 69(%rsp)
+	jne	.L804
+	movzbl	70(%rsp), %r15d
+	testb	%r15b, %r15b
+	jne	.L804
+	testq	%r14, %r14
+	jne	.L1059
+.L813:
+	movq	88(%rsp), %r14
+	testq	%r14, %r14
+	je	.L1060
+	movl	64(%rsp), %r13d
+	jmp	.L816
+	.p2align 4,,10
+	.p2align 3
+.L1062:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1061
+.L816:
+	movq	%r14, %rdx
+	movq	%r12, %rsi
+	movl	%r13d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L1062
+	je	.L1063
+	movq	%rax, 104(%rsp)
+	movq	%rax, %r14
+	movq	%r12, %rsi
+	xorl	%ecx, %ecx
+	jmp	.L818
+	.p2align 4,,10
+	.p2align 3
+.L1051:
+	cmpb	$0, 69(%rsp)
+	jne	.L769
+	movzbl	70(%rsp), %r15d
+	testb	%r15b, %r15b
+	jne	.L769
+	testq	%r14, %r14
+	jne	.L1064
+.L778:
+	movq	88(%rsp), %r14
+	testq	%r14, %r14
+	je	.L1065
+	movl	64(%rsp), %r13d
+	jmp	.L781
+	.p2align 4,,10
+	.p2align 3
+.L1067:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1066
+.L781:
+	movq	%r14, %rdx
+	movq	%r12, %rsi
+	movl	%r13d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L1067
+	je	.L1068
+	movq	%rax, 104(%rsp)
+	movq	%rax, %r14
+	movq	%r12, %rsi
+	xorl	%ecx, %ecx
+	jmp	.L783
+	.p2align 4,,10
+	.p2align 3
+.L1048:
+	cmpb	$0, 69(%rsp)
+	jne	.L745
+	movzbl	70(%rsp), %r15d
+	testb	%r15b, %r15b
+	jne	.L745
+	testq	%r13, %r13
+	jne	.L1069
+.L754:
+	movq	88(%rsp), %r14
+	testq	%r14, %r14
+	je	.L1070
+	movl	64(%rsp), %r13d
+	jmp	.L757
+	.p2align 4,,10
+	.p2align 3
+.L1072:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1071
+.L757:
+	movq	%r14, %rdx
+	movq	%r12, %rsi
+	movl	%r13d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L1072
+	je	.L1073
+	movq	%rax, 104(%rsp)
+	jmp	.L753
+	.p2align 4,,10
+	.p2align 3
+.L1045:
+	cmpb	$0, 69(%rsp)
+	jne	.L721
+	movzbl	70(%rsp), %r15d
+	testb	%r15b, %r15b
+	jne	.L721
+	testq	%r13, %r13
+	jne	.L1074
+.L730:
+	movq	88(%rsp), %r14
+	testq	%r14, %r14
+	je	.L721
+	movl	64(%rsp), %r13d
+	jmp	.L733
+	.p2align 4,,10
+	.p2align 3
+.L1076:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1075
+.L733:
+	movq	%r14, %rdx
+	movq	%r12, %rsi
+	movl	%r13d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L1076
+	je	.L1077
+	movq	%rax, 104(%rsp)
+	jmp	.L729
+	.p2align 4,,10
+	.p2align 3
+.L1041:
+	cmpb	$0, 69(%rsp)
+	jne	.L697
+	movzbl	70(%rsp), %r15d
+	testb	%r15b, %r15b
+	jne	.L697
+	testq	%r13, %r13
+	jne	.L1078
+.L706:
+	movq	88(%rsp), %r14
+	testq	%r14, %r14
+	je	.L697
+	movl	64(%rsp), %r13d
+	jmp	.L709
+	.p2align 4,,10
+	.p2align 3
+.L1080:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1079
+.L709:
+	movq	%r14, %rdx
+	movq	%r12, %rsi
+	movl	%r13d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L1080
+	je	.L1081
+	movq	%rax, 104(%rsp)
+	jmp	.L705
+	.p2align 4,,10
+	.p2align 3
+.L1037:
+	cmpb	$0, 69(%rsp)
+	jne	.L673
+	movzbl	70(%rsp), %r15d
+	testb	%r15b, %r15b
+	jne	.L673
+	testq	%r13, %r13
+	jne	.L1082
+.L682:
+	movq	88(%rsp), %r14
+	testq	%r14, %r14
+	je	.L1083
+	movl	64(%rsp), %r13d
+	jmp	.L685
+	.p2align 4,,10
+	.p2align 3
+.L1085:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1084
+.L685:
+	movq	%r14, %rdx
+	movq	%r12, %rsi
+	movl	%r13d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L1085
+	je	.L1086
+	movq	%rax, 104(%rsp)
+	jmp	.L681
+	.p2align 4,,10
+	.p2align 3
+.L1033:
+	cmpb	$0, 69(%rsp)
+	jne	.L648
+	movzbl	70(%rsp), %r15d
+	testb	%r15b, %r15b
+	jne	.L648
+	testq	%r14, %r14
+	jne	.L1087
+.L657:
+	testq	%r13, %r13
+	je	.L648
+	movl	64(%rsp), %r14d
+	jmp	.L660
+	.p2align 4,,10
+	.p2align 3
+.L1089:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1088
+.L660:
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+	movl	%r14d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L1089
+	je	.L1090
+	movq	%rax, 104(%rsp)
+	jmp	.L656
+	.p2align 4,,10
+	.p2align 3
+.L812:
+	movq	%r14, %rax
+	movl	64(%rsp), %r13d
+	leaq	(%r12,%rcx), %rsi
+	subq	%rcx, %rax
+.L818:
+	testl	%r13d, %r13d
+	js	.L819
+	cmpq	$0, %rax
+	movl	$1, %edx
+	cmova	%rdx, %rax
+	cmpb	$111, (%rsi)
+	leaq	(%rax,%rcx), %rdx
+	movq	%rdx, 96(%rsp)
+	jne	.L1023
+	cmpq	%r14, %rdx
+	jne	.L821
+	cmpb	$0, 69(%rsp)
+	jne	.L828
+	movzbl	70(%rsp), %r15d
+	testb	%r15b, %r15b
+	jne	.L828
+	testq	%r14, %r14
+	jne	.L1091
+.L823:
+	movq	88(%rsp), %r14
+	testq	%r14, %r14
+	jne	.L826
+	jmp	.L1092
+	.p2align 4,,10
+	.p2align 3
+.L1094:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1093
+.L826:
+	movq	%r14, %rdx
+	movq	%r12, %rsi
+	movl	%r13d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L1094
+	je	.L1095
+	movq	%rax, 104(%rsp)
+	movq	%rax, %r14
+	movq	%r12, %rsi
+	xorl	%edx, %edx
+	jmp	.L829
+	.p2align 4,,10
+	.p2align 3
+.L821:
+	movq	%r14, %rax
+	leaq	(%r12,%rdx), %rsi
+	subq	%rdx, %rax
+.L829:
+	cmpq	$0, %rax
+	movl	$1, %ecx
+	cmova	%rcx, %rax
+	addq	%rax, %rdx
+	cmpb	$114, (%rsi)
+	movq	%rdx, 96(%rsp)
+	jne	.L1024
+	cmpq	%r14, %rdx
+	jne	.L831
+	cmpb	$0, 69(%rsp)
+	jne	.L838
+	movzbl	70(%rsp), %r15d
+	testb	%r15b, %r15b
+	jne	.L838
+	testq	%r14, %r14
+	jne	.L1096
+.L833:
+	movq	88(%rsp), %r14
+	testq	%r14, %r14
+	jne	.L836
+	jmp	.L1097
+	.p2align 4,,10
+	.p2align 3
+.L1099:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1098
+.L836:
+	movq	%r14, %rdx
+	movq	%r12, %rsi
+	movl	%r13d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L1099
+	je	.L1100
+	movq	%rax, 104(%rsp)
+	movq	%rax, %r14
+	movq	%r12, %rsi
+	xorl	%edx, %edx
+	jmp	.L839
+	.p2align 4,,10
+	.p2align 3
+.L831:
+	movq	%r14, %rax
+	leaq	(%r12,%rdx), %rsi
+	subq	%rdx, %rax
+.L839:
+	cmpq	$0, %rax
+	movl	$1, %ecx
+	cmova	%rcx, %rax
+	addq	%rdx, %rax
+	cmpb	$108, (%rsi)
+	movq	%rax, 96(%rsp)
+	jne	.L1025
+	cmpq	%rax, %r14
+	jne	.L841
+	cmpb	$0, 69(%rsp)
+	jne	.L848
+	movzbl	70(%rsp), %r15d
+	testb	%r15b, %r15b
+	jne	.L848
+	testq	%r14, %r14
+	jne	.L1101
+.L843:
+	movq	88(%rsp), %r14
+	testq	%r14, %r14
+	jne	.L846
+	jmp	.L1102
+	.p2align 4,,10
+	.p2align 3
+.L1104:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1103
+.L846:
+	movq	%r14, %rdx
+	movq	%r12, %rsi
+	movl	%r13d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L1104
+	je	.L1105
+	movq	%rax, 104(%rsp)
+.L841:
+	movl	$1, %esi
+	movq	%rbx, %rdi
+	call	_ZN1n7fd_file4peekEm
+	movl	72(%rsp), %edx
+	movzbl	(%rax), %ecx
+	cmpl	$1, %edx
+	jne	.L849
+	movq	96(%rsp), %rsi
+	movq	104(%rsp), %rax
+	movl	$1, %edi
+	subq	%rsi, %rax
+	cmpq	$0, %rax
+	cmova	%rdi, %rax
+	addq	%rsi, %rax
+	movq	%rax, 96(%rsp)
+.L849:
+	cmpb	$100, %cl
+	jne	.L1026
+	movl	64(%rsp), %eax
+	testl	%eax, %eax
+	js	.L859
+	movq	80(%rsp), %r13
+	testq	%r13, %r13
+	je	.L1106
+.L853:
+	movq	104(%rsp), %r14
+	cmpl	$2, %edx
+	je	.L1107
+.L860:
+	movq	96(%rsp), %rcx
+	movl	$1, 72(%rsp)
+	cmpq	%r14, %rcx
+	jne	.L867
+	cmpb	$0, 69(%rsp)
+	jne	.L859
+	movzbl	70(%rsp), %r15d
+	testb	%r15b, %r15b
+	jne	.L859
+	testq	%r14, %r14
+	jne	.L1108
+.L868:
+	movq	88(%rsp), %r14
+	testq	%r14, %r14
+	je	.L1109
+	movl	64(%rsp), %r12d
+	jmp	.L871
+	.p2align 4,,10
+	.p2align 3
+.L1111:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1110
+.L871:
+	movq	%r14, %rdx
+	movq	%r13, %rsi
+	movl	%r12d, %edi
+	call	read@PLT
+.LEHE33:
+	testq	%rax, %rax
+	js	.L1111
+	je	.L1112
+	movq	%rax, 104(%rsp)
+	movq	%rax, %r14
+	movq	%r13, %rsi
+	xorl	%ecx, %ecx
+	jmp	.L873
+	.p2align 4,,10
+	.p2align 3
+.L867:
+	movq	%r14, %rax
+	movl	64(%rsp), %r12d
+	leaq	0(%r13,%rcx), %rsi
+	subq	%rcx, %rax
+.L873:
+	testl	%r12d, %r12d
+	js	.L874
+	cmpq	$0, %rax
+	movl	$1, %edx
+	cmova	%rdx, %rax
+	addq	%rcx, %rax
+	cmpb	$10, (%rsi)
+	movq	%rax, 96(%rsp)
+	jne	.L1027
+	cmpq	%r14, %rax
+	jne	.L876
+	cmpb	$0, 69(%rsp)
+	jne	.L877
+	movzbl	70(%rsp), %r15d
+	testb	%r15b, %r15b
+	je	.L1113
+.L877:
+	movq	%rbp, %rdi
+	call	remove@PLT
+	cmpb	$0, 68(%rsp)
+	jne	.L1114
+.L893:
+	movl	$-1, 64(%rsp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1115
+.L886:
+	movq	88(%rsp), %rdx
+	movq	80(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	112(%rsp), %rdi
+	testq	%rdi, %rdi
+	je	.L888
+	call	fclose@PLT
+.L888:
+	movl	64(%rsp), %edi
+	testl	%edi, %edi
+	js	.L638
+	cmpb	$0, 68(%rsp)
+	jne	.L1116
+.L638:
+	addq	$136, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1116:
+	.cfi_restore_state
+	call	close@PLT
+	jmp	.L638
+	.p2align 4,,10
+	.p2align 3
+.L1114:
+	movl	%r12d, %edi
+	call	close@PLT
+	jmp	.L893
+	.p2align 4,,10
+	.p2align 3
+.L1115:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L886
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L886
+	.p2align 4,,10
+	.p2align 3
+.L1106:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1117
+.L855:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	88(%rsp), %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+.LEHB34:
+	call	*16(%rax)
+	movq	%rax, 80(%rsp)
+	movq	%rax, %r13
+	testq	%rax, %rax
+	je	.L859
+	movl	72(%rsp), %edx
+	jmp	.L853
+	.p2align 4,,10
+	.p2align 3
+.L1057:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1118
+.L800:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	88(%rsp), %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, 80(%rsp)
+	movq	%rax, %r12
+	testq	%rax, %rax
+	je	.L804
+	movl	72(%rsp), %edx
+	jmp	.L798
+	.p2align 4,,10
+	.p2align 3
+.L1049:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1119
+.L765:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	88(%rsp), %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, 80(%rsp)
+	movq	%rax, %r12
+	testq	%rax, %rax
+	je	.L769
+	movl	72(%rsp), %edx
+	jmp	.L763
+	.p2align 4,,10
+	.p2align 3
+.L1035:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1120
+.L669:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	88(%rsp), %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, 80(%rsp)
+	movq	%rax, %r12
+	testq	%rax, %rax
+	je	.L673
+	movl	72(%rsp), %edx
+	jmp	.L667
+	.p2align 4,,10
+	.p2align 3
+.L1039:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1121
+.L693:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	88(%rsp), %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, 80(%rsp)
+	movq	%rax, %r12
+	testq	%rax, %rax
+	je	.L697
+	movl	72(%rsp), %edx
+	jmp	.L691
+	.p2align 4,,10
+	.p2align 3
+.L1046:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1122
+.L741:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	88(%rsp), %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, 80(%rsp)
+	movq	%rax, %r12
+	testq	%rax, %rax
+	je	.L745
+	movl	72(%rsp), %edx
+	jmp	.L739
+	.p2align 4,,10
+	.p2align 3
+.L1043:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1123
+.L717:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	88(%rsp), %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, 80(%rsp)
+	movq	%rax, %r12
+	testq	%rax, %rax
+	je	.L721
+	movl	72(%rsp), %edx
+	jmp	.L715
+	.p2align 4,,10
+	.p2align 3
+.L1050:
+	testq	%r14, %r14
+	jne	.L771
+.L776:
+	xorl	%r14d, %r14d
+	jmp	.L770
+	.p2align 4,,10
+	.p2align 3
+.L1032:
+	testq	%r14, %r14
+	jne	.L650
+.L655:
+	xorl	%r14d, %r14d
+	jmp	.L649
+	.p2align 4,,10
+	.p2align 3
+.L1040:
+	testq	%r13, %r13
+	jne	.L699
+.L704:
+	xorl	%r13d, %r13d
+	jmp	.L698
+	.p2align 4,,10
+	.p2align 3
+.L1044:
+	testq	%r13, %r13
+	jne	.L723
+.L728:
+	xorl	%r13d, %r13d
+	jmp	.L722
+	.p2align 4,,10
+	.p2align 3
+.L1036:
+	testq	%r13, %r13
+	jne	.L675
+.L680:
+	xorl	%r13d, %r13d
+	jmp	.L674
+	.p2align 4,,10
+	.p2align 3
+.L1047:
+	testq	%r13, %r13
+	jne	.L747
+.L752:
+	xorl	%r13d, %r13d
+	jmp	.L746
+	.p2align 4,,10
+	.p2align 3
+.L1113:
+	testq	%r14, %r14
+	jne	.L1124
+	movq	88(%rsp), %r14
+	testq	%r14, %r14
+	jne	.L883
+	jmp	.L877
+	.p2align 4,,10
+	.p2align 3
+.L1126:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1125
+.L883:
+	movq	%r14, %rdx
+	movq	%r13, %rsi
+	movl	%r12d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L1126
+	jne	.L884
+	xorl	%eax, %eax
+	movl	$1, %r15d
+	.p2align 4,,10
+	.p2align 3
+.L882:
+	movb	%r15b, 69(%rsp)
+	movb	%al, 70(%rsp)
+	jmp	.L877
+	.p2align 4,,10
+	.p2align 3
+.L1122:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L741
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L741
+	.p2align 4,,10
+	.p2align 3
+.L1123:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L717
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L717
+	.p2align 4,,10
+	.p2align 3
+.L1118:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L800
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L800
+	.p2align 4,,10
+	.p2align 3
+.L1117:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L855
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L855
+	.p2align 4,,10
+	.p2align 3
+.L1120:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L669
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L669
+	.p2align 4,,10
+	.p2align 3
+.L1119:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L765
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L765
+	.p2align 4,,10
+	.p2align 3
+.L1121:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L693
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L693
+	.p2align 4,,10
+	.p2align 3
+.L1066:
+	movl	$1, %eax
+.L780:
+	movb	%r15b, 69(%rsp)
+	movb	%al, 70(%rsp)
+	jmp	.L769
+	.p2align 4,,10
+	.p2align 3
+.L1084:
+	movl	$1, %eax
+.L684:
+	movb	%r15b, 69(%rsp)
+	movb	%al, 70(%rsp)
+	jmp	.L673
+	.p2align 4,,10
+	.p2align 3
+.L1110:
+	movl	$1, %eax
+.L870:
+	movb	%r15b, 69(%rsp)
+	movb	%al, 70(%rsp)
+	jmp	.L859
+	.p2align 4,,10
+	.p2align 3
+.L1103:
+	movl	$1, %eax
+.L845:
+	movb	%r15b, 69(%rsp)
+	movb	%al, 70(%rsp)
+	jmp	.L848
+	.p2align 4,,10
+	.p2align 3
+.L1125:
+	movl	$1, %eax
+	jmp	.L882
+	.p2align 4,,10
+	.p2align 3
+.L1075:
+	movl	$1, %eax
+.L732:
+	movb	%r15b, 69(%rsp)
+	movb	%al, 70(%rsp)
+	jmp	.L721
+	.p2align 4,,10
+	.p2align 3
+.L1093:
+	movl	$1, %eax
+.L825:
+	movb	%r15b, 69(%rsp)
+	movb	%al, 70(%rsp)
+	jmp	.L828
+	.p2align 4,,10
+	.p2align 3
+.L1079:
+	movl	$1, %eax
+.L708:
+	movb	%r15b, 69(%rsp)
+	movb	%al, 70(%rsp)
+	jmp	.L697
+	.p2align 4,,10
+	.p2align 3
+.L1061:
+	movl	$1, %eax
+.L815:
+	movb	%r15b, 69(%rsp)
+	movb	%al, 70(%rsp)
+	jmp	.L804
+	.p2align 4,,10
+	.p2align 3
+.L1071:
+	movl	$1, %eax
+.L756:
+	movb	%r15b, 69(%rsp)
+	movb	%al, 70(%rsp)
+	jmp	.L745
+	.p2align 4,,10
+	.p2align 3
+.L1098:
+	movl	$1, %eax
+.L835:
+	movb	%r15b, 69(%rsp)
+	movb	%al, 70(%rsp)
+	jmp	.L838
+	.p2align 4,,10
+	.p2align 3
+.L1054:
+	movl	$1, %eax
+.L790:
+	movb	%r15b, 69(%rsp)
+	movb	%al, 70(%rsp)
+	jmp	.L793
+	.p2align 4,,10
+	.p2align 3
+.L1088:
+	movl	$1, %eax
+.L659:
+	movb	%r15b, 69(%rsp)
+	movb	%al, 70(%rsp)
+	jmp	.L648
+	.p2align 4,,10
+	.p2align 3
+.L1058:
+	testq	%r14, %r14
+	jne	.L806
+.L811:
+	xorl	%r14d, %r14d
+	jmp	.L805
+	.p2align 4,,10
+	.p2align 3
+.L1107:
+	testq	%r14, %r14
+	jne	.L861
+.L866:
+	xorl	%r14d, %r14d
+	jmp	.L860
+	.p2align 4,,10
+	.p2align 3
+.L1031:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L644
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L644
+.L806:
+	movl	64(%rsp), %r15d
+	movq	%r12, %r13
+.L810:
+	movq	%r14, %rdx
+	movq	%r13, %rsi
+	movl	%r15d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1127
+	addq	%rax, %r13
+	subq	%rax, %r14
+	jne	.L810
+.L809:
+	movq	$0, 104(%rsp)
+	jmp	.L811
+.L1127:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L809
+	jmp	.L810
+.L747:
+	movl	64(%rsp), %r15d
+	movq	%r12, %r14
+.L751:
+	movq	%r13, %rdx
+	movq	%r14, %rsi
+	movl	%r15d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1128
+	addq	%rax, %r14
+	subq	%rax, %r13
+	jne	.L751
+.L750:
+	movq	$0, 104(%rsp)
+	jmp	.L752
+.L1128:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L750
+	jmp	.L751
+.L771:
+	movl	64(%rsp), %r15d
+	movq	%r12, %r13
+.L775:
+	movq	%r14, %rdx
+	movq	%r13, %rsi
+	movl	%r15d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1129
+	addq	%rax, %r13
+	subq	%rax, %r14
+	jne	.L775
+.L774:
+	movq	$0, 104(%rsp)
+	jmp	.L776
+.L1129:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L774
+	jmp	.L775
+.L650:
+	movl	64(%rsp), %eax
+	movq	%r12, %r15
+	movl	%eax, 12(%rsp)
+.L654:
+	movl	12(%rsp), %edi
+	movq	%r14, %rdx
+	movq	%r15, %rsi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1130
+	addq	%rax, %r15
+	subq	%rax, %r14
+	jne	.L654
+.L653:
+	movq	$0, 104(%rsp)
+	jmp	.L655
+.L1130:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L653
+	jmp	.L654
+.L723:
+	movl	64(%rsp), %r15d
+	movq	%r12, %r14
+.L727:
+	movq	%r13, %rdx
+	movq	%r14, %rsi
+	movl	%r15d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1131
+	addq	%rax, %r14
+	subq	%rax, %r13
+	jne	.L727
+.L726:
+	movq	$0, 104(%rsp)
+	jmp	.L728
+.L1131:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L726
+	jmp	.L727
+.L699:
+	movl	64(%rsp), %r15d
+	movq	%r12, %r14
+.L703:
+	movq	%r13, %rdx
+	movq	%r14, %rsi
+	movl	%r15d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1132
+	addq	%rax, %r14
+	subq	%rax, %r13
+	jne	.L703
+.L702:
+	movq	$0, 104(%rsp)
+	jmp	.L704
+.L1132:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L702
+	jmp	.L703
+.L675:
+	movl	64(%rsp), %r15d
+	movq	%r12, %r14
+.L679:
+	movq	%r13, %rdx
+	movq	%r14, %rsi
+	movl	%r15d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1133
+	addq	%rax, %r14
+	subq	%rax, %r13
+	jne	.L679
+.L678:
+	movq	$0, 104(%rsp)
+	jmp	.L680
+.L1133:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L678
+	jmp	.L679
+.L861:
+	movl	64(%rsp), %r15d
+	movq	%r13, %r12
+.L865:
+	movq	%r14, %rdx
+	movq	%r12, %rsi
+	movl	%r15d, %edi
+	call	write@PLT
+.LEHE34:
+	testq	%rax, %rax
+	js	.L1134
+	addq	%rax, %r12
+	subq	%rax, %r14
+	jne	.L865
+.L864:
+	movq	$0, 104(%rsp)
+	jmp	.L866
+.L1134:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L864
+	jmp	.L865
+.L1052:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 96(%rsp)
+	jmp	.L788
+.L1108:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 96(%rsp)
+	jmp	.L868
+.L1064:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 96(%rsp)
+	jmp	.L778
+.L1082:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 96(%rsp)
+	jmp	.L682
+.L1096:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 96(%rsp)
+	jmp	.L833
+.L1059:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 96(%rsp)
+	jmp	.L813
+.L1069:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 96(%rsp)
+	jmp	.L754
+.L1074:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 96(%rsp)
+	jmp	.L730
+.L1101:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 96(%rsp)
+	jmp	.L843
+.L1091:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 96(%rsp)
+	jmp	.L823
+.L1078:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 96(%rsp)
+	jmp	.L706
+.L1087:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 96(%rsp)
+	jmp	.L657
+.L1124:
+	movq	88(%rsp), %r14
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 96(%rsp)
+	testq	%r14, %r14
+	jne	.L883
+	jmp	.L877
+.L1095:
+	xorl	%eax, %eax
+	movl	$1, %r15d
+	jmp	.L825
+.L1112:
+	xorl	%eax, %eax
+	movl	$1, %r15d
+	jmp	.L870
+.L1100:
+	xorl	%eax, %eax
+	movl	$1, %r15d
+	jmp	.L835
+.L1105:
+	xorl	%eax, %eax
+	movl	$1, %r15d
+	jmp	.L845
+.L1063:
+	xorl	%eax, %eax
+	movl	$1, %r15d
+	jmp	.L815
+.L1056:
+	xorl	%eax, %eax
+	movl	$1, %r15d
+	jmp	.L790
+.L1090:
+	xorl	%eax, %eax
+	movl	$1, %r15d
+	jmp	.L659
+.L1086:
+	xorl	%eax, %eax
+	movl	$1, %r15d
+	jmp	.L684
+.L1068:
+	xorl	%eax, %eax
+	movl	$1, %r15d
+	jmp	.L780
+.L1081:
+	xorl	%eax, %eax
+	movl	$1, %r15d
+	jmp	.L708
+.L1077:
+	xorl	%eax, %eax
+	movl	$1, %r15d
+	jmp	.L732
+.L1073:
+	xorl	%eax, %eax
+	movl	$1, %r15d
+	jmp	.L756
+.L1034:
+	jmp	.L663
+.L916:
+	movq	%rax, %rbp
+	leaq	64(%rsp), %rbx
+	jmp	.L642
+.L1015:
+	jmp	.L1016
+.L917:
+	movq	%rax, %rbp
+	jmp	.L641
+.L1102:
+	jmp	.L848
+.L1097:
+	jmp	.L838
+.L1060:
+	jmp	.L804
+.L1053:
+	jmp	.L793
+.L1109:
+	jmp	.L859
+.L1065:
+	jmp	.L769
+.L1092:
+	jmp	.L828
+.L1070:
+	jmp	.L745
+.L1083:
+	jmp	.L673
+	.section	.gcc_except_table
+.LLSDA6906:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6906-.LLSDACSB6906
+.LLSDACSB6906:
+	.uleb128 .LEHB30-.LFB6906
+	.uleb128 .LEHE30-.LEHB30
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB31-.LFB6906
+	.uleb128 .LEHE31-.LEHB31
+	.uleb128 .L916-.LFB6906
+	.uleb128 0
+	.uleb128 .LEHB32-.LFB6906
+	.uleb128 .LEHE32-.LEHB32
+	.uleb128 .L917-.LFB6906
+	.uleb128 0
+	.uleb128 .LEHB33-.LFB6906
+	.uleb128 .LEHE33-.LEHB33
+	.uleb128 .L1015-.LFB6906
+	.uleb128 0
+	.uleb128 .LEHB34-.LFB6906
+	.uleb128 .LEHE34-.LEHB34
+	.uleb128 .L1015-.LFB6906
+	.uleb128 0
+.LLSDACSE6906:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6906
+	.type	_Z32test_file_iterator_readable_modev.cold, @function
+_Z32test_file_iterator_readable_modev.cold:
+.LFSB6906:
+.L1025:
+	.cfi_def_cfa_offset 192
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC55(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB35:
+	call	__cxa_throw@PLT
+.L1022:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC58(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE35:
+.L915:
+.L1016:
+	movq	%rbx, %rdi
+	movq	%rax, %rbp
+	call	_ZN1n4fileIcLNS_4modeE2EE5closeEv
+	movq	%rbx, %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbp, %rdi
+.LEHB36:
+	call	_Unwind_Resume@PLT
+.LEHE36:
+.L793:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC52(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB37:
+	call	__cxa_throw@PLT
+.L1019:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC55(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L1020:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC56(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L663:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC53(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L1021:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC57(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L784:
+	movzbl	0, %eax
+	ud2
+.L838:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC52(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L828:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC52(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L848:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC52(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L859:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC52(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE37:
+.L641:
+	leaq	16(%rsp), %rdi
+	call	_ZN1n7fd_file5closeEv
+.L642:
+	movq	%rbx, %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbp, %rdi
+.LEHB38:
+	call	_Unwind_Resume@PLT
+.LEHE38:
+.L804:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC52(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB39:
+	call	__cxa_throw@PLT
+.L884:
+	movq	%rax, 104(%rsp)
+.L876:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC61(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L769:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC52(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L745:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC52(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L673:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC52(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L1017:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC54(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L1018:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC55(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L1023:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC56(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L819:
+	movzbl	0, %eax
+	ud2
+.L1024:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC59(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L1026:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC60(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L1027:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC57(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE39:
+.L874:
+	movzbl	0, %eax
+	ud2
+	.cfi_endproc
+.LFE6906:
+	.section	.gcc_except_table
+.LLSDAC6906:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6906-.LLSDACSBC6906
+.LLSDACSBC6906:
+	.uleb128 .LEHB35-.LCOLDB63
+	.uleb128 .LEHE35-.LEHB35
+	.uleb128 .L915-.LCOLDB63
+	.uleb128 0
+	.uleb128 .LEHB36-.LCOLDB63
+	.uleb128 .LEHE36-.LEHB36
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB37-.LCOLDB63
+	.uleb128 .LEHE37-.LEHB37
+	.uleb128 .L915-.LCOLDB63
+	.uleb128 0
+	.uleb128 .LEHB38-.LCOLDB63
+	.uleb128 .LEHE38-.LEHB38
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB39-.LCOLDB63
+	.uleb128 .LEHE39-.LEHB39
+	.uleb128 .L915-.LCOLDB63
+	.uleb128 0
+.LLSDACSEC6906:
+	.section	.text.unlikely
+	.text
+	.size	_Z32test_file_iterator_readable_modev, .-_Z32test_file_iterator_readable_modev
+	.section	.text.unlikely
+	.size	_Z32test_file_iterator_readable_modev.cold, .-_Z32test_file_iterator_readable_modev.cold
+.LCOLDE63:
+	.text
+.LHOTE63:
+	.section	.text._ZN1n4fileIcLNS_4modeE3EE5closeEv,"axG",@progbits,_ZN1n4fileIcLNS_4modeE3EE5closeEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4fileIcLNS_4modeE3EE5closeEv
+	.type	_ZN1n4fileIcLNS_4modeE3EE5closeEv, @function
+_ZN1n4fileIcLNS_4modeE3EE5closeEv:
+.LFB7112:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movl	(%rdi), %ebp
+	testl	%ebp, %ebp
+	js	.L1136
+	cmpl	$2, 8(%rdi)
+	je	.L1161
+.L1137:
+	cmpb	$0, 4(%rbx)
+	jne	.L1162
+.L1142:
+	movl	$-1, (%rbx)
+.L1136:
+	cmpq	$0, 16(%rbx)
+	je	.L1143
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1163
+.L1145:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	$0, 16(%rbx)
+.L1143:
+	movq	48(%rbx), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 8(%rbx)
+	movups	%xmm0, 32(%rbx)
+	testq	%rdi, %rdi
+	je	.L1135
+	call	fclose@PLT
+	movq	$0, 48(%rbx)
+.L1135:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1161:
+	.cfi_restore_state
+	movq	40(%rdi), %r12
+	testq	%r12, %r12
+	je	.L1137
+	movq	16(%rdi), %r13
+.L1141:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1164
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L1141
+	.p2align 4,,10
+	.p2align 3
+.L1140:
+	movq	$0, 40(%rbx)
+	jmp	.L1137
+	.p2align 4,,10
+	.p2align 3
+.L1162:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L1142
+	.p2align 4,,10
+	.p2align 3
+.L1163:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1145
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1145
+	.p2align 4,,10
+	.p2align 3
+.L1164:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1140
+	jmp	.L1141
+	.cfi_endproc
+.LFE7112:
+	.size	_ZN1n4fileIcLNS_4modeE3EE5closeEv, .-_ZN1n4fileIcLNS_4modeE3EE5closeEv
+	.section	.text._ZN1n4fileIcLNS_4modeE0EE5closeEv,"axG",@progbits,_ZN1n4fileIcLNS_4modeE0EE5closeEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4fileIcLNS_4modeE0EE5closeEv
+	.type	_ZN1n4fileIcLNS_4modeE0EE5closeEv, @function
+_ZN1n4fileIcLNS_4modeE0EE5closeEv:
+.LFB7114:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movl	(%rdi), %ebp
+	testl	%ebp, %ebp
+	js	.L1166
+	cmpl	$2, 8(%rdi)
+	je	.L1191
+.L1167:
+	cmpb	$0, 4(%rbx)
+	jne	.L1192
+.L1172:
+	movl	$-1, (%rbx)
+.L1166:
+	cmpq	$0, 16(%rbx)
+	je	.L1173
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1193
+.L1175:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	$0, 16(%rbx)
+.L1173:
+	movq	48(%rbx), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 8(%rbx)
+	movups	%xmm0, 32(%rbx)
+	testq	%rdi, %rdi
+	je	.L1165
+	call	fclose@PLT
+	movq	$0, 48(%rbx)
+.L1165:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1191:
+	.cfi_restore_state
+	movq	40(%rdi), %r12
+	testq	%r12, %r12
+	je	.L1167
+	movq	16(%rdi), %r13
+.L1171:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1194
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L1171
+	.p2align 4,,10
+	.p2align 3
+.L1170:
+	movq	$0, 40(%rbx)
+	jmp	.L1167
+	.p2align 4,,10
+	.p2align 3
+.L1192:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L1172
+	.p2align 4,,10
+	.p2align 3
+.L1193:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1175
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1175
+	.p2align 4,,10
+	.p2align 3
+.L1194:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1170
+	jmp	.L1171
+	.cfi_endproc
+.LFE7114:
+	.size	_ZN1n4fileIcLNS_4modeE0EE5closeEv, .-_ZN1n4fileIcLNS_4modeE0EE5closeEv
+	.section	.rodata.str1.8
+	.align 8
+.LC66:
+	.string	"expected equal : expected value : s, actual value : n::str(\"Hello\\nWorld\\n\")"
+	.section	.text.unlikely
+.LCOLDB68:
+	.text
+.LHOTB68:
+	.p2align 4
+	.globl	_Z32test_file_oterator_writable_modev
+	.type	_Z32test_file_oterator_writable_modev, @function
+_Z32test_file_oterator_writable_modev:
+.LFB6907:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6907
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$438, %edx
+	movl	$524866, %esi
+	xorl	%eax, %eax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	leaq	.LC50(%rip), %rdi
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$200, %rsp
+	.cfi_def_cfa_offset 256
+.LEHB40:
+	call	open@PLT
+.LEHE40:
+	movzwl	.LC64(%rip), %r13d
+	movb	$72, 80(%rsp)
+	movdqa	.LC46(%rip), %xmm1
+	movl	%eax, 128(%rsp)
+	movw	%r13w, 132(%rsp)
+	movb	$0, 134(%rsp)
+	movq	$0, 136(%rsp)
+	movq	$0, 144(%rsp)
+	movq	$0, 168(%rsp)
+	movq	$0, 176(%rsp)
+	movups	%xmm1, 152(%rsp)
+	testl	%eax, %eax
+	js	.L1817
+	movl	$2, 136(%rsp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1825
+.L1199:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	152(%rsp), %r14
+	movl	$64, %edx
+	leaq	128(%rsp), %rcx
+	movq	%rcx, 24(%rsp)
+	movq	(%rdi), %rax
+	movq	%r14, %rsi
+.LEHB41:
+	call	*16(%rax)
+	movq	%rax, 144(%rsp)
+	movl	128(%rsp), %ebp
+	movq	%rax, %r12
+	testq	%rax, %rax
+	je	.L1520
+	movq	168(%rsp), %rbx
+	cmpq	%r14, %rbx
+	jne	.L1545
+	cmpl	$2, 136(%rsp)
+	jne	.L1545
+	testq	%r14, %r14
+	jne	.L1521
+.L1545:
+	leaq	(%r12,%rbx), %rax
+	addq	$1, %rbx
+.L1203:
+	movzbl	80(%rsp), %edx
+	movq	%rbx, 168(%rsp)
+	movb	%dl, (%rax)
+.L1208:
+	movl	140(%rsp), %r15d
+	cmpl	$2, %r15d
+	je	.L1211
+	cmpl	$1, %r15d
+	je	.L1826
+.L1212:
+	movb	$101, 80(%rsp)
+	testl	%ebp, %ebp
+	js	.L1817
+	cmpl	$1, 136(%rsp)
+	je	.L1827
+.L1219:
+	movl	$2, 136(%rsp)
+	cmpq	$1, %r14
+	ja	.L1221
+	movq	168(%rsp), %rbx
+	testq	%rbx, %rbx
+	jne	.L1828
+.L1222:
+	leaq	128(%rsp), %rax
+	leaq	80(%rsp), %rbx
+	movl	$1, %r14d
+	movq	%rax, (%rsp)
+	movq	%rbx, %r12
+	.p2align 4,,10
+	.p2align 3
+.L1234:
+	movq	(%rsp), %rax
+	movq	%r14, %rdx
+	movq	%r12, %rsi
+	movl	%ebp, %edi
+	movq	%rax, 24(%rsp)
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1829
+	addq	%rax, %r12
+	subq	%rax, %r14
+	jne	.L1234
+	.p2align 4,,10
+	.p2align 3
+.L1796:
+	cmpl	$2, %r15d
+	je	.L1514
+	cmpl	$1, %r15d
+	je	.L1228
+.L1503:
+	cmpl	$1, 136(%rsp)
+	movb	$108, 80(%rsp)
+	je	.L1830
+	.p2align 4,,10
+	.p2align 3
+.L1260:
+	movq	152(%rsp), %rbx
+	movl	$2, 136(%rsp)
+	cmpq	$1, %rbx
+	ja	.L1262
+	movq	168(%rsp), %rbx
+	testq	%rbx, %rbx
+	jne	.L1831
+.L1263:
+	leaq	80(%rsp), %rbx
+	movl	$1, %r14d
+	leaq	128(%rsp), %r15
+	movq	%rbx, %r12
+	.p2align 4,,10
+	.p2align 3
+.L1275:
+	movq	%r14, %rdx
+	movq	%r12, %rsi
+	movl	%ebp, %edi
+	movq	%r15, 24(%rsp)
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1832
+	addq	%rax, %r12
+	subq	%rax, %r14
+	jne	.L1275
+	.p2align 4,,10
+	.p2align 3
+.L1274:
+	movl	140(%rsp), %eax
+	cmpl	$2, %eax
+	je	.L1507
+	cmpl	$1, %eax
+	je	.L1269
+.L1501:
+	movb	$108, 80(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1270:
+	cmpl	$1, 136(%rsp)
+	je	.L1833
+.L1300:
+	movq	152(%rsp), %rbx
+	movl	$2, 136(%rsp)
+	cmpq	$1, %rbx
+	ja	.L1302
+	movq	168(%rsp), %rbx
+	testq	%rbx, %rbx
+	jne	.L1834
+.L1303:
+	leaq	80(%rsp), %rbx
+	movl	$1, %r14d
+	leaq	128(%rsp), %r15
+	movq	%rbx, %r12
+	.p2align 4,,10
+	.p2align 3
+.L1312:
+	movq	%r14, %rdx
+	movq	%r12, %rsi
+	movl	%ebp, %edi
+	movq	%r15, 24(%rsp)
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1835
+	addq	%rax, %r12
+	subq	%rax, %r14
+	jne	.L1312
+	jmp	.L1259
+.L1889:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L1268
+	movl	140(%rsp), %eax
+	movq	$0, 168(%rsp)
+	cmpl	$2, %eax
+	je	.L1507
+	leaq	80(%rsp), %rbx
+	cmpl	$1, %eax
+	jne	.L1501
+	.p2align 4,,10
+	.p2align 3
+.L1269:
+	movl	$1, %edx
+	movl	$10, %esi
+	movq	%rbx, %rdi
+	call	memchr@PLT
+	testq	%rax, %rax
+	je	.L1501
+	.p2align 4,,10
+	.p2align 3
+.L1507:
+	movb	$108, 80(%rsp)
+	testl	%ebp, %ebp
+	jns	.L1270
+.L1817:
+	leaq	80(%rsp), %rbx
+.L1259:
+	leaq	128(%rsp), %rax
+	movq	%rbx, %rsi
+	movb	$111, 80(%rsp)
+	movq	%rax, %rdi
+	movq	%rax, 24(%rsp)
+	movq	%rax, %r15
+	call	_ZN1n7fd_file5writeEPKvm.constprop.0.isra.0
+	movq	%rbx, %rsi
+	movq	%r15, %rdi
+	movb	$10, 80(%rsp)
+	call	_ZN1n7fd_file5writeEPKvm.constprop.0.isra.0
+	movq	%rbx, %rsi
+	movq	%r15, %rdi
+	movb	$87, 80(%rsp)
+	call	_ZN1n7fd_file5writeEPKvm.constprop.0.isra.0
+	movq	%rbx, %rsi
+	movq	%r15, %rdi
+	movb	$111, 80(%rsp)
+	call	_ZN1n7fd_file5writeEPKvm.constprop.0.isra.0
+	movq	%rbx, %rsi
+	movq	%r15, %rdi
+	movb	$114, 80(%rsp)
+	call	_ZN1n7fd_file5writeEPKvm.constprop.0.isra.0
+	movl	128(%rsp), %ebp
+	movb	$108, 80(%rsp)
+	testl	%ebp, %ebp
+	js	.L1335
+	cmpl	$1, 136(%rsp)
+	je	.L1836
+.L1336:
+	movq	152(%rsp), %r12
+	movl	$2, 136(%rsp)
+	cmpq	$1, %r12
+	ja	.L1338
+	movq	168(%rsp), %r12
+	testq	%r12, %r12
+	jne	.L1837
+.L1339:
+	movl	$1, %r14d
+	movq	%rbx, %r12
+	.p2align 4,,10
+	.p2align 3
+.L1348:
+	movq	%r14, %rdx
+	movq	%r12, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1838
+	addq	%rax, %r12
+	subq	%rax, %r14
+	jne	.L1348
+	.p2align 4,,10
+	.p2align 3
+.L1335:
+	movq	24(%rsp), %r15
+	movq	%rbx, %rsi
+	movb	$100, 80(%rsp)
+	movq	%r15, %rdi
+	call	_ZN1n7fd_file5writeEPKvm.constprop.0.isra.0
+	movq	%rbx, %rsi
+	movq	%r15, %rdi
+	movb	$10, 80(%rsp)
+	call	_ZN1n7fd_file5writeEPKvm.constprop.0.isra.0
+.LEHE41:
+	movl	128(%rsp), %ebx
+	movq	144(%rsp), %rbp
+	testl	%ebx, %ebx
+	js	.L1371
+	cmpl	$2, 136(%rsp)
+	je	.L1839
+.L1372:
+	cmpb	$0, 132(%rsp)
+	jne	.L1840
+.L1377:
+	movl	$-1, 128(%rsp)
+	movl	$-1, %ebx
+.L1371:
+	testq	%rbp, %rbp
+	je	.L1841
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1842
+.L1382:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	152(%rsp), %rdx
+	movl	$64, %ecx
+	movq	144(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	176(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movq	$0, 144(%rsp)
+	movl	128(%rsp), %ebx
+	movaps	%xmm0, 160(%rsp)
+	movl	$0, 136(%rsp)
+	testq	%rdi, %rdi
+	je	.L1384
+.L1379:
+	call	fclose@PLT
+.L1384:
+	testl	%ebx, %ebx
+	js	.L1380
+	cmpb	$0, 132(%rsp)
+	jne	.L1843
+.L1380:
+	movl	$438, %edx
+	movl	$524288, %esi
+	leaq	.LC50(%rip), %rdi
+	xorl	%eax, %eax
+.LEHB42:
+	call	open@PLT
+.LEHE42:
+	movdqa	.LC46(%rip), %xmm2
+	movdqa	.LC65(%rip), %xmm3
+	movw	%r13w, 132(%rsp)
+	movl	%eax, 128(%rsp)
+	movb	$0, 134(%rsp)
+	movq	$0, 136(%rsp)
+	movq	$0, 144(%rsp)
+	movq	$0, 168(%rsp)
+	movq	$0, 176(%rsp)
+	movups	%xmm2, 152(%rsp)
+	movaps	%xmm3, 32(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbx
+	testq	%rbx, %rbx
+	je	.L1386
+	movq	%rbx, 48(%rsp)
+	pxor	%xmm0, %xmm0
+	movl	$23, %r12d
+	movq	$0, 72(%rsp)
+	movups	%xmm0, 56(%rsp)
+.L1387:
+	movl	$100, %eax
+	leaq	10(%r12,%r12), %rbp
+	movl	$1, %edx
+	movq	%rbx, %rdi
+	cmpq	%rax, %rbp
+	cmovb	%rax, %rbp
+	movq	(%rbx), %rax
+	leaq	1(%rbp), %rsi
+.LEHB43:
+	call	*16(%rax)
+	movq	%rax, %r13
+	movq	32(%rsp), %rax
+	leaq	1(%rax), %rdx
+	cmpq	$23, %r12
+	je	.L1392
+	xorl	%esi, %esi
+	movq	%r13, %rdi
+	call	memcpy@PLT
+	movq	(%rbx), %rax
+	leaq	1(%r12), %rdx
+	xorl	%esi, %esi
+	movl	$1, %ecx
+	movq	%rbx, %rdi
+	call	*24(%rax)
+.LEHE43:
+.L1393:
+	movq	%r13, 56(%rsp)
+	movq	%rbp, 40(%rsp)
+.L1391:
+	movl	128(%rsp), %edx
+	testl	%edx, %edx
+	jns	.L1844
+	.p2align 4,,10
+	.p2align 3
+.L1395:
+	movdqa	.LC65(%rip), %xmm4
+	movaps	%xmm4, 80(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L1417
+	pxor	%xmm0, %xmm0
+	leaq	104(%rsp), %rbx
+	movq	%rax, 96(%rsp)
+	xorl	%ebp, %ebp
+	leaq	.LC51(%rip), %rsi
+	movups	%xmm0, 104(%rsp)
+	movq	$0, 120(%rsp)
+	cmpq	%rbx, %rsi
+	jb	.L1418
+.L1805:
+	leaq	.LC51(%rip), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L1418:
+	leaq	(%rbx,%rbp), %rdi
+	movl	$12, %edx
+	call	memmove@PLT
+	movq	80(%rsp), %rax
+	leaq	12(%rax), %rdx
+	movq	%rdx, 80(%rsp)
+	movb	$0, 12(%rbx,%rax)
+	movq	88(%rsp), %rbp
+	movq	80(%rsp), %rax
+	cmpq	$23, %rbp
+	je	.L1845
+	movq	104(%rsp), %rsi
+	movq	40(%rsp), %rbx
+	movq	32(%rsp), %rdx
+	movq	%rsi, %rdi
+	cmpq	$23, %rbx
+	je	.L1846
+	cmpq	%rdx, %rax
+	je	.L1847
+.L1472:
+	movq	96(%rsp), %rax
+	movq	%rdi, %rsi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	(%rax), %r8
+	movq	%rax, %rdi
+	call	*24(%r8)
+	jmp	.L1469
+	.p2align 4,,10
+	.p2align 3
+.L1836:
+	movq	168(%rsp), %rax
+	movq	160(%rsp), %rsi
+	cmpq	%rsi, %rax
+	jne	.L1848
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 160(%rsp)
+	jmp	.L1336
+	.p2align 4,,10
+	.p2align 3
+.L1338:
+	movq	144(%rsp), %rbp
+	testq	%rbp, %rbp
+	je	.L1849
+.L1349:
+	movq	168(%rsp), %r14
+	cmpq	%r12, %r14
+	je	.L1354
+.L1549:
+	addq	%r14, %rbp
+	addq	$1, %r14
+.L1355:
+	movzbl	80(%rsp), %eax
+	movq	%r14, 168(%rsp)
+	movb	%al, 0(%rbp)
+.L1361:
+	movl	140(%rsp), %eax
+	cmpl	$2, %eax
+	je	.L1365
+	cmpl	$1, %eax
+	jne	.L1335
+	movl	$1, %edx
+	movl	$10, %esi
+	movq	%rbx, %rdi
+	call	memchr@PLT
+	testq	%rax, %rax
+	je	.L1335
+.L1365:
+	cmpl	$2, 136(%rsp)
+	jne	.L1335
+	movq	168(%rsp), %rbp
+	testq	%rbp, %rbp
+	je	.L1335
+	movq	144(%rsp), %r12
+	movl	128(%rsp), %r14d
+.L1369:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%r14d, %edi
+.LEHB44:
+	call	write@PLT
+.LEHE44:
+	testq	%rax, %rax
+	js	.L1850
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L1369
+.L1368:
+	movq	$0, 168(%rsp)
+	jmp	.L1335
+	.p2align 4,,10
+	.p2align 3
+.L1392:
+	leaq	56(%rsp), %rsi
+	movq	%r13, %rdi
+	call	memcpy@PLT
+	jmp	.L1393
+	.p2align 4,,10
+	.p2align 3
+.L1839:
+	movq	168(%rsp), %r14
+	testq	%r14, %r14
+	je	.L1372
+	movq	%rbp, %r12
+.L1376:
+	movq	%r14, %rdx
+	movq	%r12, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1851
+	addq	%rax, %r12
+	subq	%rax, %r14
+	jne	.L1376
+.L1375:
+	movq	$0, 168(%rsp)
+	jmp	.L1372
+	.p2align 4,,10
+	.p2align 3
+.L1841:
+	movq	176(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 136(%rsp)
+	movaps	%xmm0, 160(%rsp)
+	testq	%rdi, %rdi
+	jne	.L1379
+	jmp	.L1380
+	.p2align 4,,10
+	.p2align 3
+.L1845:
+	movq	40(%rsp), %rbx
+	movq	32(%rsp), %rdx
+	cmpq	$23, %rbx
+	je	.L1852
+	cmpq	%rdx, %rax
+	jne	.L1469
+	movq	56(%rsp), %rax
+	leaq	104(%rsp), %rsi
+	testq	%rdx, %rdx
+	jne	.L1505
+	.p2align 4,,10
+	.p2align 3
+.L1479:
+	movq	48(%rsp), %rdi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	%rax, %rsi
+	movq	(%rdi), %r8
+	call	*24(%r8)
+.L1473:
+	movl	128(%rsp), %ebx
+	movq	144(%rsp), %rbp
+	testl	%ebx, %ebx
+	js	.L1480
+	cmpl	$2, 136(%rsp)
+	je	.L1853
+.L1481:
+	cmpb	$0, 132(%rsp)
+	jne	.L1854
+.L1486:
+	movl	$-1, 128(%rsp)
+	movl	$-1, %ebx
+.L1480:
+	testq	%rbp, %rbp
+	je	.L1855
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1856
+.L1491:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	152(%rsp), %rdx
+	movl	$64, %ecx
+	movq	144(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	176(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movq	$0, 144(%rsp)
+	movl	128(%rsp), %ebx
+	movaps	%xmm0, 160(%rsp)
+	movl	$0, 136(%rsp)
+	testq	%rdi, %rdi
+	je	.L1493
+.L1488:
+	call	fclose@PLT
+.L1493:
+	testl	%ebx, %ebx
+	js	.L1489
+	cmpb	$0, 132(%rsp)
+	jne	.L1857
+.L1489:
+	addq	$200, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	leaq	.LC50(%rip), %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	remove@PLT
+	.p2align 4,,10
+	.p2align 3
+.L1846:
+	.cfi_restore_state
+	cmpq	%rdx, %rax
+	jne	.L1472
+	leaq	56(%rsp), %rax
+	testq	%rdx, %rdx
+	je	.L1477
+.L1505:
+	movq	%rax, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L1476
+	movq	104(%rsp), %rdi
+	cmpq	$23, %rbp
+	je	.L1478
+.L1477:
+	movq	96(%rsp), %rax
+	movq	%rdi, %rsi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	(%rax), %r8
+	movq	%rax, %rdi
+	call	*24(%r8)
+.L1478:
+	cmpq	$23, %rbx
+	je	.L1473
+	movq	56(%rsp), %rax
+	jmp	.L1479
+	.p2align 4,,10
+	.p2align 3
+.L1844:
+	movq	144(%rsp), %r13
+	testq	%r13, %r13
+	je	.L1858
+.L1396:
+	cmpl	$2, 136(%rsp)
+	movq	168(%rsp), %rbx
+	je	.L1859
+.L1401:
+	movq	160(%rsp), %rcx
+	movq	%rbx, %rdx
+	movl	$1, 136(%rsp)
+	subq	%rcx, %rdx
+	cmpq	%rbx, %rcx
+	jne	.L1408
+	cmpb	$0, 133(%rsp)
+	jne	.L1409
+	cmpb	$0, 134(%rsp)
+	jne	.L1409
+	testq	%rbx, %rbx
+	jne	.L1860
+.L1410:
+	movq	152(%rsp), %r12
+	testq	%r12, %r12
+	je	.L1411
+	movl	128(%rsp), %ebx
+	jmp	.L1414
+	.p2align 4,,10
+	.p2align 3
+.L1861:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1413
+.L1414:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebx, %edi
+.LEHB45:
+	call	read@PLT
+.LEHE45:
+	movq	%rax, %rbp
+	testq	%rax, %rax
+	js	.L1861
+	je	.L1413
+	movl	$4096, %ebx
+	movq	%rax, 168(%rsp)
+	cmpq	%rbx, %rax
+	cmovbe	%rax, %rbx
+	movq	%rbx, 160(%rsp)
+	jmp	.L1416
+	.p2align 4,,10
+	.p2align 3
+.L1843:
+	movl	%ebx, %edi
+	call	close@PLT
+	jmp	.L1380
+	.p2align 4,,10
+	.p2align 3
+.L1840:
+	movl	%ebx, %edi
+	call	close@PLT
+	jmp	.L1377
+	.p2align 4,,10
+	.p2align 3
+.L1842:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1382
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1382
+	.p2align 4,,10
+	.p2align 3
+.L1848:
+	subq	%rax, %rsi
+	movl	$1, %edx
+	movl	%ebp, %edi
+	call	lseek@PLT
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 160(%rsp)
+	jmp	.L1336
+.L1354:
+	cmpl	$2, 136(%rsp)
+	jne	.L1549
+	testq	%r12, %r12
+	je	.L1549
+	movl	128(%rsp), %r15d
+	movq	%rbp, %r12
+.L1360:
+	movq	%r14, %rdx
+	movq	%r12, %rsi
+	movl	%r15d, %edi
+.LEHB46:
+	call	write@PLT
+.LEHE46:
+	testq	%rax, %rax
+	js	.L1862
+	addq	%rax, %r12
+	subq	%rax, %r14
+	jne	.L1360
+.L1818:
+	movl	$1, %r14d
+	jmp	.L1355
+	.p2align 4,,10
+	.p2align 3
+.L1838:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1335
+	jmp	.L1348
+	.p2align 4,,10
+	.p2align 3
+.L1855:
+	movq	176(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 136(%rsp)
+	movaps	%xmm0, 160(%rsp)
+	testq	%rdi, %rdi
+	jne	.L1488
+	jmp	.L1489
+.L1408:
+	movl	$4096, %ebx
+	addq	%rcx, %r13
+	cmpq	%rbx, %rdx
+	cmovbe	%rdx, %rbx
+	movq	%rbx, %rax
+	addq	%rcx, %rax
+	movq	%rax, 160(%rsp)
+	testq	%rdx, %rdx
+	je	.L1395
+.L1416:
+	leaq	56(%rsp), %rax
+	movq	%rax, (%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1455:
+	movq	40(%rsp), %rbp
+	movq	(%rsp), %r14
+	cmpq	$23, %rbp
+	je	.L1421
+	movq	56(%rsp), %r14
+.L1421:
+	movq	32(%rsp), %r12
+	leaq	(%rbx,%r12), %rax
+	cmpq	%r14, %r13
+	jb	.L1422
+	leaq	(%r14,%r12), %rdx
+	cmpq	%rdx, %r13
+	jnb	.L1422
+	subq	%r14, %r13
+	movq	%r13, 8(%rsp)
+	cmpq	%rax, %rbp
+	jnb	.L1427
+	leaq	10(%rbp,%rbp), %rdx
+	movq	48(%rsp), %r13
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r13, %rdi
+	movl	$1, %edx
+	movq	%rax, %r15
+	leaq	1(%rax), %rsi
+	movq	0(%r13), %rax
+.LEHB47:
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L1428
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	0(%r13), %rax
+	leaq	1(%rbp), %rdx
+	movq	%r13, %rdi
+	movq	56(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.L1429:
+	movq	16(%rsp), %rax
+	movq	%r15, 40(%rsp)
+	movq	%r15, %rbp
+	movq	%rax, 56(%rsp)
+.L1427:
+	cmpq	$23, %rbp
+	je	.L1863
+	movq	56(%rsp), %r14
+	movq	8(%rsp), %r13
+	addq	%r14, %r13
+	.p2align 4,,10
+	.p2align 3
+.L1431:
+	movq	%rbx, %rdx
+	leaq	(%r14,%r12), %rdi
+	movq	%r13, %rsi
+	call	memmove@PLT
+	movl	128(%rsp), %eax
+	addq	32(%rsp), %rbx
+	movq	%rbx, 32(%rsp)
+	movb	$0, (%r14,%rbx)
+	testl	%eax, %eax
+	js	.L1395
+	movq	144(%rsp), %r13
+	testq	%r13, %r13
+	je	.L1864
+.L1434:
+	cmpl	$2, 136(%rsp)
+	movq	168(%rsp), %rbx
+	je	.L1865
+.L1439:
+	movq	160(%rsp), %rcx
+	movq	%rbx, %rdx
+	movl	$1, 136(%rsp)
+	subq	%rcx, %rdx
+	cmpq	%rbx, %rcx
+	jne	.L1446
+	cmpb	$0, 133(%rsp)
+	je	.L1866
+.L1409:
+	movq	%rbx, 160(%rsp)
+	jmp	.L1395
+	.p2align 4,,10
+	.p2align 3
+.L1422:
+	cmpq	%rax, %rbp
+	jnb	.L1424
+	leaq	10(%rbp,%rbp), %rdx
+	movq	48(%rsp), %r15
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r15, %rdi
+	movl	$1, %edx
+	movq	%rax, 16(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	%rax, 8(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L1425
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	movq	56(%rsp), %rsi
+	movq	%r15, %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	call	*24(%rax)
+.L1426:
+	movq	8(%rsp), %rax
+	movq	%rax, 56(%rsp)
+	movq	16(%rsp), %rax
+	movq	%rax, 40(%rsp)
+	movq	%rax, %rbp
+.L1424:
+	movq	(%rsp), %r14
+	cmpq	$23, %rbp
+	je	.L1431
+	movq	56(%rsp), %r14
+	jmp	.L1431
+	.p2align 4,,10
+	.p2align 3
+.L1446:
+	movl	$4096, %ebx
+	addq	%rcx, %r13
+	cmpq	%rbx, %rdx
+	cmovbe	%rdx, %rbx
+	movq	%rbx, %rax
+	addq	%rcx, %rax
+	movq	%rax, 160(%rsp)
+	testq	%rdx, %rdx
+	jne	.L1455
+	jmp	.L1395
+	.p2align 4,,10
+	.p2align 3
+.L1425:
+	movq	%rax, %rdi
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L1426
+	.p2align 4,,10
+	.p2align 3
+.L1863:
+	movq	8(%rsp), %r13
+	movq	(%rsp), %r14
+	addq	%r14, %r13
+	jmp	.L1431
+	.p2align 4,,10
+	.p2align 3
+.L1428:
+	movq	%rax, %rdi
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L1429
+	.p2align 4,,10
+	.p2align 3
+.L1864:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1867
+.L1436:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	152(%rsp), %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, 144(%rsp)
+	movq	%rax, %r13
+	testq	%rax, %rax
+	je	.L1395
+	jmp	.L1434
+	.p2align 4,,10
+	.p2align 3
+.L1866:
+	movzbl	134(%rsp), %r12d
+	testb	%r12b, %r12b
+	jne	.L1409
+	testq	%rbx, %rbx
+	jne	.L1868
+.L1448:
+	movq	152(%rsp), %rbp
+	testq	%rbp, %rbp
+	je	.L1411
+	movl	128(%rsp), %ebx
+	jmp	.L1452
+	.p2align 4,,10
+	.p2align 3
+.L1870:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1869
+.L1452:
+	movq	%rbp, %rdx
+	movq	%r13, %rsi
+	movl	%ebx, %edi
+	call	read@PLT
+.LEHE47:
+	testq	%rax, %rax
+	js	.L1870
+	je	.L1871
+	movl	$4096, %ebx
+	movq	%rax, 168(%rsp)
+	cmpq	%rbx, %rax
+	cmovbe	%rax, %rbx
+	movq	%rbx, 160(%rsp)
+	jmp	.L1455
+	.p2align 4,,10
+	.p2align 3
+.L1869:
+	movl	$1, %eax
+.L1451:
+	movb	%r12b, 133(%rsp)
+	movb	%al, 134(%rsp)
+.L1411:
+	xorl	%ebx, %ebx
+	jmp	.L1409
+	.p2align 4,,10
+	.p2align 3
+.L1853:
+	movq	168(%rsp), %r13
+	testq	%r13, %r13
+	je	.L1481
+	movq	%rbp, %r12
+.L1485:
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1872
+	addq	%rax, %r12
+	subq	%rax, %r13
+	jne	.L1485
+.L1484:
+	movq	$0, 168(%rsp)
+	jmp	.L1481
+	.p2align 4,,10
+	.p2align 3
+.L1854:
+	movl	%ebx, %edi
+	call	close@PLT
+	jmp	.L1486
+	.p2align 4,,10
+	.p2align 3
+.L1857:
+	movl	%ebx, %edi
+	call	close@PLT
+	jmp	.L1489
+	.p2align 4,,10
+	.p2align 3
+.L1865:
+	testq	%rbx, %rbx
+	jne	.L1440
+	xorl	%ebx, %ebx
+	jmp	.L1439
+.L1440:
+	movl	128(%rsp), %r12d
+	movq	%r13, %rbp
+.L1444:
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movl	%r12d, %edi
+.LEHB48:
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1873
+	addq	%rax, %rbp
+	subq	%rax, %rbx
+	jne	.L1444
+.L1443:
+	movq	$0, 168(%rsp)
+	xorl	%ebx, %ebx
+	jmp	.L1439
+	.p2align 4,,10
+	.p2align 3
+.L1856:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1491
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1491
+	.p2align 4,,10
+	.p2align 3
+.L1386:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1874
+.L1389:
+	movq	_ZZN1n4heapEvE3res(%rip), %rbx
+	movq	40(%rsp), %r12
+	pxor	%xmm0, %xmm0
+	movq	$0, 72(%rsp)
+	movups	%xmm0, 56(%rsp)
+	movq	%rbx, 48(%rsp)
+	cmpq	$99, %r12
+	ja	.L1391
+	jmp	.L1387
+	.p2align 4,,10
+	.p2align 3
+.L1417:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1875
+.L1457:
+	movq	_ZZN1n4heapEvE3res(%rip), %r13
+	movq	80(%rsp), %rbp
+	pxor	%xmm0, %xmm0
+	xorl	%r15d, %r15d
+	movq	88(%rsp), %r12
+	movups	%xmm0, 104(%rsp)
+	leaq	.LC51(%rip), %rsi
+	movq	%r13, 96(%rsp)
+	leaq	12(%rbp), %r14
+	movq	$0, 120(%rsp)
+	cmpq	$23, %r12
+	je	.L1876
+.L1459:
+	leaq	(%r15,%rbp), %rax
+	cmpq	%rax, %rsi
+	jnb	.L1877
+	subq	%r15, %rsi
+	movq	%rsi, (%rsp)
+	cmpq	%r14, %r12
+	jnb	.L1539
+	leaq	10(%r12,%r12), %rax
+	movl	$1, %edx
+	movq	%r13, %rdi
+	cmpq	%r14, %rax
+	cmovnb	%rax, %r14
+	movq	0(%r13), %rax
+	leaq	1(%r14), %rsi
+	call	*16(%rax)
+	leaq	1(%rbp), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r12
+	je	.L1463
+	movq	0(%r13), %rax
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r13, %rdi
+	call	*24(%rax)
+.L1463:
+	movq	%rbx, 104(%rsp)
+	movq	%r14, %r12
+	movq	%r14, 88(%rsp)
+.L1462:
+	cmpq	$23, %r12
+	jne	.L1819
+	leaq	104(%rsp), %rbx
+.L1819:
+	movq	(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L1418
+.L1877:
+	cmpq	%r14, %r12
+	jnb	.L1538
+.L1499:
+	leaq	10(%r12,%r12), %rax
+	movl	$1, %edx
+	movq	%r13, %rdi
+	cmpq	%r14, %rax
+	cmovnb	%rax, %r14
+	movq	0(%r13), %rax
+	leaq	1(%r14), %rsi
+	call	*16(%rax)
+	leaq	1(%rbp), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r12
+	je	.L1461
+	movq	0(%r13), %rax
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r13, %rdi
+	call	*24(%rax)
+.LEHE48:
+.L1461:
+	movq	%rbx, 104(%rsp)
+	movq	%r14, 88(%rsp)
+.L1420:
+	leaq	.LC51(%rip), %rsi
+	cmpq	$23, %r14
+	jne	.L1418
+	leaq	104(%rsp), %rbx
+	jmp	.L1805
+	.p2align 4,,10
+	.p2align 3
+.L1847:
+	testq	%rdx, %rdx
+	je	.L1477
+	movq	56(%rsp), %rax
+	jmp	.L1505
+	.p2align 4,,10
+	.p2align 3
+.L1852:
+	cmpq	%rdx, %rax
+	jne	.L1469
+	testq	%rdx, %rdx
+	je	.L1473
+	leaq	104(%rsp), %rsi
+	leaq	56(%rsp), %rax
+	jmp	.L1505
+	.p2align 4,,10
+	.p2align 3
+.L1867:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1436
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1436
+.L1476:
+	cmpq	$23, %rbp
+	je	.L1469
+	movq	104(%rsp), %rdi
+	jmp	.L1472
+.L1872:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1484
+	jmp	.L1485
+.L1851:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1375
+	jmp	.L1376
+.L1873:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1443
+	jmp	.L1444
+.L1875:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1457
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1457
+.L1874:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1389
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1389
+.L1837:
+	movq	144(%rsp), %r14
+.L1344:
+	movq	%r12, %rdx
+	movq	%r14, %rsi
+	movl	%ebp, %edi
+.LEHB49:
+	call	write@PLT
+.LEHE49:
+	testq	%rax, %rax
+	js	.L1878
+	addq	%rax, %r14
+	subq	%rax, %r12
+	jne	.L1344
+	movq	$0, 168(%rsp)
+	jmp	.L1339
+	.p2align 4,,10
+	.p2align 3
+.L1878:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1368
+	jmp	.L1344
+	.p2align 4,,10
+	.p2align 3
+.L1825:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1199
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1199
+.L1858:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1879
+.L1398:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	152(%rsp), %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+.LEHB50:
+	call	*16(%rax)
+.LEHE50:
+	movq	%rax, 144(%rsp)
+	movq	%rax, %r13
+	testq	%rax, %rax
+	je	.L1395
+	jmp	.L1396
+	.p2align 4,,10
+	.p2align 3
+.L1890:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L1227
+	movq	$0, 168(%rsp)
+	cmpl	$2, %r15d
+	je	.L1514
+	leaq	80(%rsp), %rbx
+	cmpl	$1, %r15d
+	jne	.L1503
+	.p2align 4,,10
+	.p2align 3
+.L1228:
+	movl	$1, %edx
+	movl	$10, %esi
+	movq	%rbx, %rdi
+	call	memchr@PLT
+	testq	%rax, %rax
+	je	.L1503
+	.p2align 4,,10
+	.p2align 3
+.L1514:
+	movb	$108, 80(%rsp)
+	testl	%ebp, %ebp
+	js	.L1817
+	cmpl	$1, 136(%rsp)
+	jne	.L1260
+.L1830:
+	movq	168(%rsp), %rax
+	movq	160(%rsp), %rsi
+	cmpq	%rsi, %rax
+	je	.L1261
+	subq	%rax, %rsi
+	movl	$1, %edx
+	movl	%ebp, %edi
+	call	lseek@PLT
+.L1261:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 160(%rsp)
+	jmp	.L1260
+	.p2align 4,,10
+	.p2align 3
+.L1835:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1259
+	jmp	.L1312
+	.p2align 4,,10
+	.p2align 3
+.L1832:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1274
+	jmp	.L1275
+	.p2align 4,,10
+	.p2align 3
+.L1829:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1796
+	jmp	.L1234
+	.p2align 4,,10
+	.p2align 3
+.L1826:
+	leaq	80(%rsp), %rbx
+	movl	$1, %edx
+	movl	$10, %esi
+	movq	%rbx, %rdi
+	call	memchr@PLT
+	testq	%rax, %rax
+	je	.L1212
+.L1211:
+	cmpl	$2, 136(%rsp)
+	jne	.L1212
+	movq	168(%rsp), %rbx
+	testq	%rbx, %rbx
+	jne	.L1880
+.L1213:
+	movb	$101, 80(%rsp)
+	testl	%ebp, %ebp
+	jns	.L1219
+	jmp	.L1817
+	.p2align 4,,10
+	.p2align 3
+.L1827:
+	movq	168(%rsp), %rax
+	movq	160(%rsp), %rsi
+	cmpq	%rsi, %rax
+	je	.L1220
+	subq	%rax, %rsi
+	movl	$1, %edx
+	movl	%ebp, %edi
+	call	lseek@PLT
+.L1220:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 160(%rsp)
+	jmp	.L1219
+	.p2align 4,,10
+	.p2align 3
+.L1833:
+	movq	168(%rsp), %rax
+	movq	160(%rsp), %rsi
+	cmpq	%rsi, %rax
+	je	.L1301
+	subq	%rax, %rsi
+	movl	$1, %edx
+	movl	%ebp, %edi
+	call	lseek@PLT
+.L1301:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 160(%rsp)
+	jmp	.L1300
+	.p2align 4,,10
+	.p2align 3
+.L1221:
+	testq	%r12, %r12
+	je	.L1881
+.L1235:
+	movq	168(%rsp), %rbx
+	cmpq	%r14, %rbx
+	jne	.L1546
+	cmpl	$2, 136(%rsp)
+	jne	.L1546
+	testq	%r14, %r14
+	jne	.L1524
+.L1546:
+	leaq	(%r12,%rbx), %rax
+	addq	$1, %rbx
+.L1241:
+	movzbl	80(%rsp), %edx
+	movq	%rbx, 168(%rsp)
+	movb	%dl, (%rax)
+.L1246:
+	movl	140(%rsp), %eax
+	cmpl	$2, %eax
+	je	.L1249
+	cmpl	$1, %eax
+	jne	.L1514
+	leaq	80(%rsp), %rbx
+	movl	$1, %edx
+	movl	$10, %esi
+	movq	%rbx, %rdi
+	call	memchr@PLT
+	testq	%rax, %rax
+	je	.L1514
+.L1249:
+	cmpl	$2, 136(%rsp)
+	jne	.L1514
+	movq	168(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L1514
+	leaq	128(%rsp), %r14
+.L1252:
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	movl	%ebp, %edi
+	movq	%r14, 24(%rsp)
+.LEHB51:
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1882
+	addq	%rax, %r12
+	subq	%rax, %rbx
+	jne	.L1252
+.L1797:
+	movq	$0, 168(%rsp)
+	jmp	.L1514
+	.p2align 4,,10
+	.p2align 3
+.L1302:
+	movq	144(%rsp), %rbp
+	testq	%rbp, %rbp
+	je	.L1883
+.L1313:
+	movq	168(%rsp), %r12
+	cmpq	%rbx, %r12
+	jne	.L1548
+	cmpl	$2, 136(%rsp)
+	jne	.L1548
+	testq	%rbx, %rbx
+	jne	.L1320
+.L1548:
+	addq	%r12, %rbp
+	addq	$1, %r12
+.L1319:
+	movzbl	80(%rsp), %eax
+	movq	%r12, 168(%rsp)
+	movb	%al, 0(%rbp)
+.L1325:
+	movl	140(%rsp), %eax
+	cmpl	$2, %eax
+	je	.L1329
+	leaq	80(%rsp), %rbx
+	cmpl	$1, %eax
+	jne	.L1259
+	movl	$1, %edx
+	movl	$10, %esi
+	movq	%rbx, %rdi
+	call	memchr@PLT
+	testq	%rax, %rax
+	je	.L1259
+.L1329:
+	cmpl	$2, 136(%rsp)
+	jne	.L1817
+	movq	168(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L1817
+	movq	144(%rsp), %rbp
+	movl	128(%rsp), %r14d
+	leaq	128(%rsp), %r12
+.L1333:
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movl	%r14d, %edi
+	movq	%r12, 24(%rsp)
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1884
+	addq	%rax, %rbp
+	subq	%rax, %rbx
+	jne	.L1333
+.L1332:
+	movq	$0, 168(%rsp)
+	jmp	.L1817
+	.p2align 4,,10
+	.p2align 3
+.L1262:
+	movq	144(%rsp), %r12
+	testq	%r12, %r12
+	je	.L1885
+.L1277:
+	movq	168(%rsp), %r14
+	cmpq	%rbx, %r14
+	jne	.L1547
+	cmpl	$2, 136(%rsp)
+	jne	.L1547
+	testq	%rbx, %rbx
+	jne	.L1527
+.L1547:
+	addq	%r14, %r12
+	addq	$1, %r14
+.L1283:
+	movzbl	80(%rsp), %eax
+	movq	%r14, 168(%rsp)
+	movb	%al, (%r12)
+.L1288:
+	movl	140(%rsp), %eax
+	cmpl	$2, %eax
+	je	.L1291
+	cmpl	$1, %eax
+	jne	.L1507
+	leaq	80(%rsp), %rbx
+	movl	$1, %edx
+	movl	$10, %esi
+	movq	%rbx, %rdi
+	call	memchr@PLT
+	testq	%rax, %rax
+	je	.L1507
+.L1291:
+	cmpl	$2, 136(%rsp)
+	jne	.L1507
+	movq	168(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L1507
+	movq	144(%rsp), %r12
+	leaq	128(%rsp), %r14
+.L1299:
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	movl	%ebp, %edi
+	movq	%r14, 24(%rsp)
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1886
+	addq	%rax, %r12
+	subq	%rax, %rbx
+	jne	.L1299
+.L1800:
+	movq	$0, 168(%rsp)
+	jmp	.L1507
+.L1520:
+	leaq	128(%rsp), %rax
+	movl	$1, %r15d
+	leaq	80(%rsp), %rbx
+	movq	%rax, (%rsp)
+.L1201:
+	movq	(%rsp), %rax
+	movq	%r15, %rdx
+	movq	%rbx, %rsi
+	movl	%ebp, %edi
+	movq	%rax, 24(%rsp)
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1887
+	addq	%rax, %rbx
+	subq	%rax, %r15
+	jne	.L1201
+	jmp	.L1208
+	.p2align 4,,10
+	.p2align 3
+.L1887:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1208
+	jmp	.L1201
+.L1834:
+	movq	144(%rsp), %r12
+	leaq	128(%rsp), %r14
+.L1308:
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	movl	%ebp, %edi
+	movq	%r14, 24(%rsp)
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1888
+	addq	%rax, %r12
+	subq	%rax, %rbx
+	jne	.L1308
+	movq	$0, 168(%rsp)
+	jmp	.L1303
+	.p2align 4,,10
+	.p2align 3
+.L1888:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1332
+	jmp	.L1308
+.L1831:
+	movq	144(%rsp), %r12
+	leaq	128(%rsp), %r14
+.L1268:
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	movl	%ebp, %edi
+	movq	%r14, 24(%rsp)
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1889
+	addq	%rax, %r12
+	subq	%rax, %rbx
+	jne	.L1268
+	movq	$0, 168(%rsp)
+	jmp	.L1263
+.L1828:
+	leaq	128(%rsp), %r14
+.L1227:
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	movl	%ebp, %edi
+	movq	%r14, 24(%rsp)
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1890
+	addq	%rax, %r12
+	subq	%rax, %rbx
+	jne	.L1227
+	movq	$0, 168(%rsp)
+	jmp	.L1222
+.L1884:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1332
+	jmp	.L1333
+.L1882:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1797
+	jmp	.L1252
+.L1886:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1800
+	jmp	.L1299
+.L1850:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1368
+	jmp	.L1369
+.L1883:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1891
+.L1315:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	152(%rsp), %rbx
+	movl	$64, %edx
+	leaq	128(%rsp), %rcx
+	movq	%rcx, 24(%rsp)
+	movq	(%rdi), %rax
+	movq	%rbx, %rsi
+	call	*16(%rax)
+	movq	%rax, 144(%rsp)
+	movq	%rax, %rbp
+	testq	%rax, %rax
+	jne	.L1313
+	movl	128(%rsp), %r14d
+	movl	$1, %ebx
+	leaq	80(%rsp), %rbp
+	leaq	128(%rsp), %r12
+.L1328:
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movl	%r14d, %edi
+	movq	%r12, 24(%rsp)
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1892
+	addq	%rax, %rbp
+	subq	%rax, %rbx
+	jne	.L1328
+	jmp	.L1325
+	.p2align 4,,10
+	.p2align 3
+.L1892:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1325
+	jmp	.L1328
+.L1881:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1893
+.L1237:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	152(%rsp), %r14
+	movl	$64, %edx
+	leaq	128(%rsp), %rcx
+	movq	%rcx, 24(%rsp)
+	movq	(%rdi), %rax
+	movq	%r14, %rsi
+	call	*16(%rax)
+	movq	%rax, 144(%rsp)
+	movl	128(%rsp), %ebp
+	movq	%rax, %r12
+	testq	%rax, %rax
+	jne	.L1235
+	movl	$1, %r14d
+	leaq	80(%rsp), %rbx
+	leaq	128(%rsp), %r15
+.L1239:
+	movq	%r14, %rdx
+	movq	%rbx, %rsi
+	movl	%ebp, %edi
+	movq	%r15, 24(%rsp)
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1894
+	addq	%rax, %rbx
+	subq	%rax, %r14
+	jne	.L1239
+	jmp	.L1246
+	.p2align 4,,10
+	.p2align 3
+.L1894:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1246
+	jmp	.L1239
+.L1885:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1895
+.L1279:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	152(%rsp), %rbx
+	movl	$64, %edx
+	leaq	128(%rsp), %rcx
+	movq	%rcx, 24(%rsp)
+	movq	(%rdi), %rax
+	movq	%rbx, %rsi
+	call	*16(%rax)
+	movq	%rax, 144(%rsp)
+	movl	128(%rsp), %ebp
+	movq	%rax, %r12
+	testq	%rax, %rax
+	jne	.L1277
+	movl	$1, %ebx
+	leaq	80(%rsp), %r12
+	leaq	128(%rsp), %r14
+.L1281:
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	movl	%ebp, %edi
+	movq	%r14, 24(%rsp)
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1896
+	addq	%rax, %r12
+	subq	%rax, %rbx
+	jne	.L1281
+	jmp	.L1288
+	.p2align 4,,10
+	.p2align 3
+.L1896:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1288
+	jmp	.L1281
+.L1849:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1897
+.L1351:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	152(%rsp), %r12
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%r12, %rsi
+	call	*16(%rax)
+	movq	%rax, 144(%rsp)
+	movq	%rax, %rbp
+	testq	%rax, %rax
+	jne	.L1349
+	movl	128(%rsp), %r14d
+	movl	$1, %ebp
+	movq	%rbx, %r12
+.L1364:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%r14d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1898
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L1364
+	jmp	.L1361
+	.p2align 4,,10
+	.p2align 3
+.L1898:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1361
+	jmp	.L1364
+.L1880:
+	leaq	128(%rsp), %rax
+	movq	%r12, (%rsp)
+	movq	%rax, 8(%rsp)
+.L1217:
+	movq	8(%rsp), %rax
+	movq	(%rsp), %rsi
+	movq	%rbx, %rdx
+	movl	%ebp, %edi
+	movq	%rax, 24(%rsp)
+	call	write@PLT
+.LEHE51:
+	testq	%rax, %rax
+	js	.L1899
+	addq	%rax, (%rsp)
+	subq	%rax, %rbx
+	jne	.L1217
+.L1216:
+	movq	$0, 168(%rsp)
+	jmp	.L1213
+.L1899:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1216
+	jmp	.L1217
+.L1868:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 160(%rsp)
+	jmp	.L1448
+.L1538:
+	xorl	%ebx, %ebx
+	movq	%r12, %r14
+	jmp	.L1420
+.L1859:
+	testq	%rbx, %rbx
+	jne	.L1402
+	xorl	%ebx, %ebx
+	jmp	.L1401
+.L1402:
+	movl	128(%rsp), %r12d
+	movq	%r13, %rbp
+.L1406:
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movl	%r12d, %edi
+.LEHB52:
+	call	write@PLT
+.LEHE52:
+	testq	%rax, %rax
+	js	.L1900
+	addq	%rax, %rbp
+	subq	%rax, %rbx
+	jne	.L1406
+.L1405:
+	movq	$0, 168(%rsp)
+	xorl	%ebx, %ebx
+	jmp	.L1401
+.L1895:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1279
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1279
+.L1897:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1351
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1351
+.L1893:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1237
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1237
+.L1891:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1315
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1315
+.L1879:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1398
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1398
+.L1862:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1818
+	jmp	.L1360
+.L1524:
+	movq	%r12, %r14
+	leaq	128(%rsp), %r15
+.L1242:
+	movq	%rbx, %rdx
+	movq	%r14, %rsi
+	movl	%ebp, %edi
+	movq	%r15, 24(%rsp)
+.LEHB53:
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1901
+	addq	%rax, %r14
+	subq	%rax, %rbx
+	jne	.L1242
+.L1814:
+	movq	%r12, %rax
+	movl	$1, %ebx
+	jmp	.L1241
+.L1901:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1814
+	jmp	.L1242
+.L1900:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1405
+	jmp	.L1406
+.L1521:
+	movq	%rax, %r15
+	leaq	128(%rsp), %rax
+	movq	%rax, (%rsp)
+.L1204:
+	movq	(%rsp), %rax
+	movq	%rbx, %rdx
+	movq	%r15, %rsi
+	movl	%ebp, %edi
+	movq	%rax, 24(%rsp)
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1902
+	addq	%rax, %r15
+	subq	%rax, %rbx
+	jne	.L1204
+.L1813:
+	movq	%r12, %rax
+	movl	$1, %ebx
+	jmp	.L1203
+.L1902:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1813
+	jmp	.L1204
+.L1527:
+	movq	%r12, %rbx
+	leaq	128(%rsp), %r15
+.L1284:
+	movq	%r14, %rdx
+	movq	%rbx, %rsi
+	movl	%ebp, %edi
+	movq	%r15, 24(%rsp)
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1903
+	addq	%rax, %rbx
+	subq	%rax, %r14
+	jne	.L1284
+.L1815:
+	movl	$1, %r14d
+	jmp	.L1283
+.L1903:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1815
+	jmp	.L1284
+.L1320:
+	movl	128(%rsp), %r15d
+	movq	%rbp, %rbx
+	leaq	128(%rsp), %r14
+.L1324:
+	movq	%r12, %rdx
+	movq	%rbx, %rsi
+	movl	%r15d, %edi
+	movq	%r14, 24(%rsp)
+	call	write@PLT
+.LEHE53:
+	testq	%rax, %rax
+	js	.L1904
+	addq	%rax, %rbx
+	subq	%rax, %r12
+	jne	.L1324
+.L1816:
+	movl	$1, %r12d
+	jmp	.L1319
+.L1904:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1816
+	jmp	.L1324
+.L1871:
+	xorl	%eax, %eax
+	movl	$1, %r12d
+	jmp	.L1451
+.L1413:
+	testq	%rbp, %rbp
+	sete	133(%rsp)
+	shrq	$63, %rbp
+	xorl	%ebx, %ebx
+	movb	%bpl, 134(%rsp)
+	jmp	.L1409
+.L1860:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 160(%rsp)
+	jmp	.L1410
+	.p2align 4,,10
+	.p2align 3
+.L1539:
+	xorl	%ebx, %ebx
+	jmp	.L1462
+.L1876:
+	leaq	104(%rsp), %rbx
+	cmpq	%rbx, %rsi
+	jnb	.L1905
+	cmpq	$23, %r14
+	jbe	.L1418
+	movq	%rbx, %r15
+	jmp	.L1499
+.L1905:
+	movq	%rbx, %r15
+	jmp	.L1459
+.L1543:
+	movq	%rax, %rbx
+	jmp	.L1498
+.L1542:
+	movq	%rax, %rbx
+	jmp	.L1495
+.L1793:
+	jmp	.L1794
+	.section	.gcc_except_table
+.LLSDA6907:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6907-.LLSDACSB6907
+.LLSDACSB6907:
+	.uleb128 .LEHB40-.LFB6907
+	.uleb128 .LEHE40-.LEHB40
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB41-.LFB6907
+	.uleb128 .LEHE41-.LEHB41
+	.uleb128 .L1542-.LFB6907
+	.uleb128 0
+	.uleb128 .LEHB42-.LFB6907
+	.uleb128 .LEHE42-.LEHB42
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB43-.LFB6907
+	.uleb128 .LEHE43-.LEHB43
+	.uleb128 .L1543-.LFB6907
+	.uleb128 0
+	.uleb128 .LEHB44-.LFB6907
+	.uleb128 .LEHE44-.LEHB44
+	.uleb128 .L1542-.LFB6907
+	.uleb128 0
+	.uleb128 .LEHB45-.LFB6907
+	.uleb128 .LEHE45-.LEHB45
+	.uleb128 .L1793-.LFB6907
+	.uleb128 0
+	.uleb128 .LEHB46-.LFB6907
+	.uleb128 .LEHE46-.LEHB46
+	.uleb128 .L1542-.LFB6907
+	.uleb128 0
+	.uleb128 .LEHB47-.LFB6907
+	.uleb128 .LEHE47-.LEHB47
+	.uleb128 .L1793-.LFB6907
+	.uleb128 0
+	.uleb128 .LEHB48-.LFB6907
+	.uleb128 .LEHE48-.LEHB48
+	.uleb128 .L1793-.LFB6907
+	.uleb128 0
+	.uleb128 .LEHB49-.LFB6907
+	.uleb128 .LEHE49-.LEHB49
+	.uleb128 .L1542-.LFB6907
+	.uleb128 0
+	.uleb128 .LEHB50-.LFB6907
+	.uleb128 .LEHE50-.LEHB50
+	.uleb128 .L1793-.LFB6907
+	.uleb128 0
+	.uleb128 .LEHB51-.LFB6907
+	.uleb128 .LEHE51-.LEHB51
+	.uleb128 .L1542-.LFB6907
+	.uleb128 0
+	.uleb128 .LEHB52-.LFB6907
+	.uleb128 .LEHE52-.LEHB52
+	.uleb128 .L1793-.LFB6907
+	.uleb128 0
+	.uleb128 .LEHB53-.LFB6907
+	.uleb128 .LEHE53-.LEHB53
+	.uleb128 .L1542-.LFB6907
+	.uleb128 0
+.LLSDACSE6907:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6907
+	.type	_Z32test_file_oterator_writable_modev.cold, @function
+_Z32test_file_oterator_writable_modev.cold:
+.LFSB6907:
+.L1469:
+	.cfi_def_cfa_offset 256
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC66(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB54:
+	call	__cxa_throw@PLT
+.LEHE54:
+.L1544:
+.L1794:
+	movq	%rax, %rbx
+	movq	40(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L1498
+	movq	48(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	56(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1498:
+	movq	24(%rsp), %r15
+	movq	%r15, %rdi
+	call	_ZN1n4fileIcLNS_4modeE0EE5closeEv
+	movq	%r15, %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB55:
+	call	_Unwind_Resume@PLT
+.LEHE55:
+.L1495:
+	movq	24(%rsp), %r15
+	movq	%r15, %rdi
+	call	_ZN1n4fileIcLNS_4modeE3EE5closeEv
+	movq	%r15, %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB56:
+	call	_Unwind_Resume@PLT
+.LEHE56:
+	.cfi_endproc
+.LFE6907:
+	.section	.gcc_except_table
+.LLSDAC6907:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6907-.LLSDACSBC6907
+.LLSDACSBC6907:
+	.uleb128 .LEHB54-.LCOLDB68
+	.uleb128 .LEHE54-.LEHB54
+	.uleb128 .L1544-.LCOLDB68
+	.uleb128 0
+	.uleb128 .LEHB55-.LCOLDB68
+	.uleb128 .LEHE55-.LEHB55
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB56-.LCOLDB68
+	.uleb128 .LEHE56-.LEHB56
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6907:
+	.section	.text.unlikely
+	.text
+	.size	_Z32test_file_oterator_writable_modev, .-_Z32test_file_oterator_writable_modev
+	.section	.text.unlikely
+	.size	_Z32test_file_oterator_writable_modev.cold, .-_Z32test_file_oterator_writable_modev.cold
+.LCOLDE68:
+	.text
+.LHOTE68:
+	.section	.text._ZN1n4fileIcLNS_4modeE1EE5closeEv,"axG",@progbits,_ZN1n4fileIcLNS_4modeE1EE5closeEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4fileIcLNS_4modeE1EE5closeEv
+	.type	_ZN1n4fileIcLNS_4modeE1EE5closeEv, @function
+_ZN1n4fileIcLNS_4modeE1EE5closeEv:
+.LFB7123:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movl	(%rdi), %ebp
+	testl	%ebp, %ebp
+	js	.L1907
+	cmpl	$2, 8(%rdi)
+	je	.L1932
+.L1908:
+	cmpb	$0, 4(%rbx)
+	jne	.L1933
+.L1913:
+	movl	$-1, (%rbx)
+.L1907:
+	cmpq	$0, 16(%rbx)
+	je	.L1914
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1934
+.L1916:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	$0, 16(%rbx)
+.L1914:
+	movq	48(%rbx), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 8(%rbx)
+	movups	%xmm0, 32(%rbx)
+	testq	%rdi, %rdi
+	je	.L1906
+	call	fclose@PLT
+	movq	$0, 48(%rbx)
+.L1906:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1932:
+	.cfi_restore_state
+	movq	40(%rdi), %r12
+	testq	%r12, %r12
+	je	.L1908
+	movq	16(%rdi), %r13
+.L1912:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1935
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L1912
+	.p2align 4,,10
+	.p2align 3
+.L1911:
+	movq	$0, 40(%rbx)
+	jmp	.L1908
+	.p2align 4,,10
+	.p2align 3
+.L1933:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L1913
+	.p2align 4,,10
+	.p2align 3
+.L1934:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1916
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1916
+	.p2align 4,,10
+	.p2align 3
+.L1935:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1911
+	jmp	.L1912
+	.cfi_endproc
+.LFE7123:
+	.size	_ZN1n4fileIcLNS_4modeE1EE5closeEv, .-_ZN1n4fileIcLNS_4modeE1EE5closeEv
+	.section	.rodata.str1.1
+.LC69:
+	.string	"expected true : f.opened()"
+	.section	.rodata.str1.8
+	.align 8
+.LC70:
+	.string	"expected equal : expected value : c.get(), actual value : 'H'"
+	.section	.rodata.str1.1
+.LC71:
+	.string	"expected true : c.has()"
+	.section	.rodata.str1.8
+	.align 8
+.LC72:
+	.string	"expected equal : expected value : c.get(), actual value : 'e'"
+	.align 8
+.LC73:
+	.string	"expected equal : expected value : c.get(), actual value : 'l'"
+	.align 8
+.LC74:
+	.string	"expected equal : expected value : c.get(), actual value : 'o'"
+	.align 8
+.LC75:
+	.string	"expected equal : expected value : c.get(), actual value : '\\n'"
+	.align 8
+.LC76:
+	.string	"expected equal : expected value : c.get(), actual value : 'W'"
+	.align 8
+.LC77:
+	.string	"expected equal : expected value : c.get(), actual value : 'r'"
+	.align 8
+.LC78:
+	.string	"expected equal : expected value : c.get(), actual value : 'd'"
+	.section	.rodata.str1.1
+.LC79:
+	.string	"expected false : c.has()"
+	.section	.text.unlikely
+.LCOLDB80:
+	.text
+.LHOTB80:
+	.p2align 4
+	.globl	_Z23test_file_pathable_modev
+	.type	_Z23test_file_pathable_modev, @function
+_Z23test_file_pathable_modev:
+.LFB6917:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6917
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leaq	.LC50(%rip), %r15
+	movl	$524865, %esi
+	xorl	%eax, %eax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%r15, %rdi
+	movl	$438, %edx
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+.LEHB57:
+	call	open@PLT
+.LEHE57:
+	leaq	31(%rsp), %rbx
+	movzwl	.LC64(%rip), %ebp
+	movdqa	.LC46(%rip), %xmm1
+	leaq	32(%rsp), %r14
+	movq	%rbx, %rsi
+	movl	%eax, 32(%rsp)
+	movq	%r14, %rdi
+	movw	%bp, 36(%rsp)
+	movb	$0, 38(%rsp)
+	movq	$0, 40(%rsp)
+	movq	$0, 48(%rsp)
+	movq	$0, 72(%rsp)
+	movq	$0, 80(%rsp)
+	movb	$72, 31(%rsp)
+	movups	%xmm1, 56(%rsp)
+.LEHB58:
+	call	_ZN1n7fd_file5writeEPKvm.constprop.0.isra.0
+	movq	%rbx, %rsi
+	movq	%r14, %rdi
+	movb	$101, 31(%rsp)
+	call	_ZN1n7fd_file5writeEPKvm.constprop.0.isra.0
+	movq	%rbx, %rsi
+	movq	%r14, %rdi
+	movb	$108, 31(%rsp)
+	call	_ZN1n7fd_file5writeEPKvm.constprop.0.isra.0
+	movq	%rbx, %rsi
+	movq	%r14, %rdi
+	movb	$108, 31(%rsp)
+	call	_ZN1n7fd_file5writeEPKvm.constprop.0.isra.0
+	movq	%rbx, %rsi
+	movq	%r14, %rdi
+	movb	$111, 31(%rsp)
+	call	_ZN1n7fd_file5writeEPKvm.constprop.0.isra.0
+	movq	%rbx, %rsi
+	movq	%r14, %rdi
+	movb	$10, 31(%rsp)
+	call	_ZN1n7fd_file5writeEPKvm.constprop.0.isra.0
+	movq	%rbx, %rsi
+	movq	%r14, %rdi
+	movb	$87, 31(%rsp)
+	call	_ZN1n7fd_file5writeEPKvm.constprop.0.isra.0
+	movq	%rbx, %rsi
+	movq	%r14, %rdi
+	movb	$111, 31(%rsp)
+	call	_ZN1n7fd_file5writeEPKvm.constprop.0.isra.0
+	movq	%rbx, %rsi
+	movq	%r14, %rdi
+	movb	$114, 31(%rsp)
+	call	_ZN1n7fd_file5writeEPKvm.constprop.0.isra.0
+	movq	%rbx, %rsi
+	movq	%r14, %rdi
+	movb	$108, 31(%rsp)
+	call	_ZN1n7fd_file5writeEPKvm.constprop.0.isra.0
+	movq	%rbx, %rsi
+	movq	%r14, %rdi
+	movb	$100, 31(%rsp)
+	call	_ZN1n7fd_file5writeEPKvm.constprop.0.isra.0
+	movq	%rbx, %rsi
+	movq	%r14, %rdi
+	movb	$10, 31(%rsp)
+	call	_ZN1n7fd_file5writeEPKvm.constprop.0.isra.0
+.LEHE58:
+	movl	32(%rsp), %ebx
+	movq	48(%rsp), %r12
+	testl	%ebx, %ebx
+	js	.L1937
+	cmpl	$2, 40(%rsp)
+	je	.L2231
+.L1938:
+	cmpb	$0, 36(%rsp)
+	jne	.L2232
+.L1943:
+	movl	$-1, 32(%rsp)
+	movl	$-1, %ebx
+.L1937:
+	testq	%r12, %r12
+	je	.L2233
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2234
+.L1948:
+	movq	56(%rsp), %rdx
+	movq	48(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	80(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movl	32(%rsp), %ebx
+	movq	$0, 48(%rsp)
+	movl	$0, 40(%rsp)
+	movaps	%xmm0, 64(%rsp)
+	testq	%rdi, %rdi
+	je	.L1950
+.L1945:
+	call	fclose@PLT
+.L1950:
+	testl	%ebx, %ebx
+	js	.L1946
+	cmpb	$0, 36(%rsp)
+	jne	.L2235
+.L1946:
+	movl	$438, %edx
+	movl	$524288, %esi
+	movq	%r15, %rdi
+	xorl	%eax, %eax
+.LEHB59:
+	call	open@PLT
+.LEHE59:
+	movdqa	.LC46(%rip), %xmm2
+	movw	%bp, 36(%rsp)
+	movl	%eax, 32(%rsp)
+	movb	$0, 38(%rsp)
+	movq	$0, 40(%rsp)
+	movq	$0, 48(%rsp)
+	movq	$0, 72(%rsp)
+	movq	$0, 80(%rsp)
+	movups	%xmm2, 56(%rsp)
+	testl	%eax, %eax
+	js	.L2217
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2236
+.L1954:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	56(%rsp), %rbp
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%rbp, %rsi
+.LEHB60:
+	call	*16(%rax)
+	movq	%rax, 48(%rsp)
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L1956
+	cmpl	$2, 40(%rsp)
+	movq	72(%rsp), %r13
+	je	.L2237
+.L1957:
+	movq	64(%rsp), %rcx
+	movl	$1, 40(%rsp)
+	cmpq	%r13, %rcx
+	je	.L2238
+	movq	%r13, %rax
+	leaq	(%rbx,%rcx), %rsi
+	subq	%rcx, %rax
+.L2103:
+	cmpq	$0, %rax
+	movl	$1, %edx
+	cmova	%rdx, %rax
+	cmpb	$72, (%rsi)
+	leaq	(%rax,%rcx), %rdx
+	movq	%rdx, 64(%rsp)
+	jne	.L2218
+	movl	32(%rsp), %r12d
+	testl	%r12d, %r12d
+	jns	.L1972
+.L1974:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC71(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE60:
+	.p2align 4,,10
+	.p2align 3
+.L2231:
+	movq	72(%rsp), %r13
+	testq	%r13, %r13
+	je	.L1938
+	movq	%r12, 8(%rsp)
+.L1942:
+	movq	8(%rsp), %rsi
+	movq	%r13, %rdx
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L2239
+	addq	%rax, 8(%rsp)
+	subq	%rax, %r13
+	jne	.L1942
+	.p2align 4,,10
+	.p2align 3
+.L1941:
+	movq	$0, 72(%rsp)
+	jmp	.L1938
+	.p2align 4,,10
+	.p2align 3
+.L2233:
+	movq	80(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 40(%rsp)
+	movaps	%xmm0, 64(%rsp)
+	testq	%rdi, %rdi
+	jne	.L1945
+	jmp	.L1946
+	.p2align 4,,10
+	.p2align 3
+.L2235:
+	movl	%ebx, %edi
+	call	close@PLT
+	jmp	.L1946
+	.p2align 4,,10
+	.p2align 3
+.L2232:
+	movl	%ebx, %edi
+	call	close@PLT
+	jmp	.L1943
+	.p2align 4,,10
+	.p2align 3
+.L2234:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1948
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1948
+	.p2align 4,,10
+	.p2align 3
+.L2238:
+	cmpb	$0, 37(%rsp)
+	je	.L2240
+.L1956:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC71(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB61:
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L1972:
+	cmpq	%r13, %rdx
+	jne	.L1973
+	cmpb	$0, 37(%rsp)
+	jne	.L1974
+	movzbl	38(%rsp), %eax
+	movb	%al, 8(%rsp)
+	testb	%al, %al
+	jne	.L1974
+	testq	%r13, %r13
+	jne	.L2241
+.L1975:
+	testq	%rbp, %rbp
+	jne	.L1979
+	jmp	.L1974
+	.p2align 4,,10
+	.p2align 3
+.L2243:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2242
+.L1979:
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movl	%r12d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L2243
+	je	.L2244
+	movq	%rax, 72(%rsp)
+	movq	%rax, %r13
+	movq	%rbx, %rsi
+	xorl	%edx, %edx
+	jmp	.L2102
+	.p2align 4,,10
+	.p2align 3
+.L1973:
+	movq	%r13, %rax
+	leaq	(%rbx,%rdx), %rsi
+	subq	%rdx, %rax
+.L2102:
+	cmpq	$0, %rax
+	movl	$1, %ecx
+	cmova	%rcx, %rax
+	addq	%rax, %rdx
+	cmpb	$101, (%rsi)
+	movq	%rdx, 64(%rsp)
+	jne	.L2219
+	cmpq	%rdx, %r13
+	jne	.L1982
+	cmpb	$0, 37(%rsp)
+	je	.L2245
+.L1983:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC71(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L1982:
+	movq	%r13, %rax
+	leaq	(%rbx,%rdx), %rsi
+	subq	%rdx, %rax
+.L2101:
+	cmpq	$0, %rax
+	movl	$1, %ecx
+	cmova	%rcx, %rax
+	addq	%rax, %rdx
+	cmpb	$108, (%rsi)
+	movq	%rdx, 64(%rsp)
+	jne	.L2220
+	cmpq	%rdx, %r13
+	jne	.L1991
+	cmpb	$0, 37(%rsp)
+	je	.L2246
+.L1992:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC71(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L1991:
+	movq	%r13, %rax
+	leaq	(%rbx,%rdx), %rsi
+	subq	%rdx, %rax
+.L2100:
+	cmpq	$0, %rax
+	movl	$1, %ecx
+	cmova	%rcx, %rax
+	addq	%rax, %rdx
+	cmpb	$108, (%rsi)
+	movq	%rdx, 64(%rsp)
+	jne	.L2221
+	cmpq	%rdx, %r13
+	jne	.L2000
+	cmpb	$0, 37(%rsp)
+	je	.L2247
+.L2001:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC71(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L2000:
+	movq	%r13, %rax
+	leaq	(%rbx,%rdx), %rsi
+	subq	%rdx, %rax
+.L2099:
+	cmpq	$0, %rax
+	movl	$1, %ecx
+	cmova	%rcx, %rax
+	addq	%rax, %rdx
+	cmpb	$111, (%rsi)
+	movq	%rdx, 64(%rsp)
+	jne	.L2222
+	cmpq	%r13, %rdx
+	jne	.L2009
+	cmpb	$0, 37(%rsp)
+	je	.L2248
+.L2010:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC71(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L2009:
+	movq	%r13, %rax
+	leaq	(%rbx,%rdx), %rsi
+	subq	%rdx, %rax
+.L2098:
+	cmpq	$0, %rax
+	movl	$1, %ecx
+	cmova	%rcx, %rax
+	addq	%rax, %rdx
+	cmpb	$10, (%rsi)
+	movq	%rdx, 64(%rsp)
+	jne	.L2223
+	cmpq	%rdx, %r13
+	jne	.L2018
+	cmpb	$0, 37(%rsp)
+	je	.L2249
+.L2019:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC71(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L2018:
+	movq	%r13, %rax
+	leaq	(%rbx,%rdx), %rsi
+	subq	%rdx, %rax
+.L2097:
+	cmpq	$0, %rax
+	movl	$1, %ecx
+	cmova	%rcx, %rax
+	addq	%rax, %rdx
+	cmpb	$87, (%rsi)
+	movq	%rdx, 64(%rsp)
+	jne	.L2224
+	cmpq	%r13, %rdx
+	jne	.L2027
+	cmpb	$0, 37(%rsp)
+	je	.L2250
+.L2028:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC71(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L2027:
+	movq	%r13, %rax
+	leaq	(%rbx,%rdx), %rsi
+	subq	%rdx, %rax
+.L2096:
+	cmpq	$0, %rax
+	movl	$1, %ecx
+	cmova	%rcx, %rax
+	addq	%rax, %rdx
+	cmpb	$111, (%rsi)
+	movq	%rdx, 64(%rsp)
+	jne	.L2225
+	cmpq	%r13, %rdx
+	jne	.L2036
+	cmpb	$0, 37(%rsp)
+	je	.L2251
+.L2037:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC71(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L2036:
+	movq	%r13, %rax
+	leaq	(%rbx,%rdx), %rsi
+	subq	%rdx, %rax
+.L2095:
+	cmpq	$0, %rax
+	movl	$1, %ecx
+	cmova	%rcx, %rax
+	addq	%rax, %rdx
+	cmpb	$114, (%rsi)
+	movq	%rdx, 64(%rsp)
+	jne	.L2226
+	cmpq	%rdx, %r13
+	jne	.L2045
+	cmpb	$0, 37(%rsp)
+	je	.L2252
+.L2046:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC71(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L2045:
+	movq	%r13, %rax
+	leaq	(%rbx,%rdx), %rsi
+	subq	%rdx, %rax
+.L2094:
+	cmpq	$0, %rax
+	movl	$1, %ecx
+	cmova	%rcx, %rax
+	addq	%rax, %rdx
+	cmpb	$108, (%rsi)
+	movq	%rdx, 64(%rsp)
+	jne	.L2227
+	cmpq	%rdx, %r13
+	jne	.L2054
+	cmpb	$0, 37(%rsp)
+	je	.L2253
+.L2055:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC71(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L2054:
+	movq	%r13, %rax
+	leaq	(%rbx,%rdx), %rsi
+	subq	%rdx, %rax
+.L2093:
+	cmpq	$0, %rax
+	movl	$1, %ecx
+	cmova	%rcx, %rax
+	addq	%rax, %rdx
+	cmpb	$100, (%rsi)
+	movq	%rdx, 64(%rsp)
+	jne	.L2228
+	cmpq	%rdx, %r13
+	jne	.L2063
+	cmpb	$0, 37(%rsp)
+	je	.L2254
+.L2064:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC71(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE61:
+	.p2align 4,,10
+	.p2align 3
+.L2063:
+	movq	%r13, %rax
+	leaq	(%rbx,%rdx), %rsi
+	subq	%rdx, %rax
+.L2092:
+	cmpq	$0, %rax
+	movl	$1, %ecx
+	cmova	%rcx, %rax
+	addq	%rdx, %rax
+	cmpb	$10, (%rsi)
+	movq	%rax, 64(%rsp)
+	jne	.L2229
+	cmpq	%rax, %r13
+	jne	.L2072
+	cmpb	$0, 37(%rsp)
+	jne	.L2073
+	movzbl	38(%rsp), %eax
+	movb	%al, 8(%rsp)
+	testb	%al, %al
+	je	.L2255
+.L2073:
+	cmpb	$0, 36(%rsp)
+	jne	.L2256
+.L2090:
+	movl	$-1, 32(%rsp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2257
+.L2082:
+	movq	56(%rsp), %rdx
+	movq	48(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	80(%rsp), %rdi
+	movl	32(%rsp), %ebx
+	testq	%rdi, %rdi
+	je	.L2084
+	call	fclose@PLT
+.L2084:
+	testl	%ebx, %ebx
+	js	.L2085
+	cmpb	$0, 36(%rsp)
+	jne	.L2258
+.L2085:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%r15, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	remove@PLT
+	.p2align 4,,10
+	.p2align 3
+.L2256:
+	.cfi_restore_state
+	movl	%r12d, %edi
+	call	close@PLT
+	jmp	.L2090
+	.p2align 4,,10
+	.p2align 3
+.L2258:
+	movl	%ebx, %edi
+	call	close@PLT
+	jmp	.L2085
+	.p2align 4,,10
+	.p2align 3
+.L2257:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2082
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2082
+	.p2align 4,,10
+	.p2align 3
+.L2072:
+	subq	%rax, %r13
+.L2091:
+	cmpq	$0, %r13
+	movl	$1, %edx
+	movl	$8, %edi
+	cmova	%rdx, %r13
+	addq	%r13, %rax
+	movq	%rax, 64(%rsp)
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC79(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB62:
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L2239:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1941
+	jmp	.L1942
+	.p2align 4,,10
+	.p2align 3
+.L2245:
+	movzbl	38(%rsp), %eax
+	movb	%al, 8(%rsp)
+	testb	%al, %al
+	jne	.L1983
+	testq	%r13, %r13
+	jne	.L2259
+.L1984:
+	testq	%rbp, %rbp
+	jne	.L1985
+	jmp	.L1983
+	.p2align 4,,10
+	.p2align 3
+.L2261:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2260
+.L1985:
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movl	%r12d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L2261
+	je	.L2262
+	movq	%rax, 72(%rsp)
+	movq	%rax, %r13
+	movq	%rbx, %rsi
+	xorl	%edx, %edx
+	jmp	.L2101
+	.p2align 4,,10
+	.p2align 3
+.L2246:
+	movzbl	38(%rsp), %eax
+	movb	%al, 8(%rsp)
+	testb	%al, %al
+	jne	.L1992
+	testq	%r13, %r13
+	jne	.L2263
+.L1993:
+	testq	%rbp, %rbp
+	jne	.L1997
+	jmp	.L1992
+	.p2align 4,,10
+	.p2align 3
+.L2265:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2264
+.L1997:
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movl	%r12d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L2265
+	je	.L2266
+	movq	%rax, 72(%rsp)
+	movq	%rax, %r13
+	movq	%rbx, %rsi
+	xorl	%edx, %edx
+	jmp	.L2100
+	.p2align 4,,10
+	.p2align 3
+.L2240:
+	movzbl	38(%rsp), %r12d
+	testb	%r12b, %r12b
+	jne	.L1956
+	testq	%r13, %r13
+	jne	.L2267
+.L1965:
+	testq	%rbp, %rbp
+	je	.L1956
+	movl	32(%rsp), %r13d
+	jmp	.L1969
+	.p2align 4,,10
+	.p2align 3
+.L2269:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2268
+.L1969:
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movl	%r13d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L2269
+	je	.L2270
+	movq	%rax, 72(%rsp)
+	movq	%rax, %r13
+	movq	%rbx, %rsi
+	xorl	%ecx, %ecx
+	jmp	.L2103
+	.p2align 4,,10
+	.p2align 3
+.L2247:
+	movzbl	38(%rsp), %eax
+	movb	%al, 8(%rsp)
+	testb	%al, %al
+	jne	.L2001
+	testq	%r13, %r13
+	jne	.L2271
+.L2002:
+	testq	%rbp, %rbp
+	jne	.L2006
+	jmp	.L2001
+	.p2align 4,,10
+	.p2align 3
+.L2273:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2272
+.L2006:
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movl	%r12d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L2273
+	je	.L2274
+	movq	%rax, 72(%rsp)
+	movq	%rax, %r13
+	movq	%rbx, %rsi
+	xorl	%edx, %edx
+	jmp	.L2099
+	.p2align 4,,10
+	.p2align 3
+.L2248:
+	movzbl	38(%rsp), %eax
+	movb	%al, 8(%rsp)
+	testb	%al, %al
+	jne	.L2010
+	testq	%r13, %r13
+	jne	.L2275
+.L2011:
+	testq	%rbp, %rbp
+	jne	.L2015
+	jmp	.L2010
+	.p2align 4,,10
+	.p2align 3
+.L2277:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2276
+.L2015:
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movl	%r12d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L2277
+	je	.L2278
+	movq	%rax, 72(%rsp)
+	movq	%rax, %r13
+	movq	%rbx, %rsi
+	xorl	%edx, %edx
+	jmp	.L2098
+	.p2align 4,,10
+	.p2align 3
+.L2249:
+	movzbl	38(%rsp), %eax
+	movb	%al, 8(%rsp)
+	testb	%al, %al
+	jne	.L2019
+	testq	%r13, %r13
+	jne	.L2279
+.L2020:
+	testq	%rbp, %rbp
+	jne	.L2021
+	jmp	.L2019
+	.p2align 4,,10
+	.p2align 3
+.L2281:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2280
+.L2021:
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movl	%r12d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L2281
+	je	.L2282
+	movq	%rax, 72(%rsp)
+	movq	%rax, %r13
+	movq	%rbx, %rsi
+	xorl	%edx, %edx
+	jmp	.L2097
+	.p2align 4,,10
+	.p2align 3
+.L2250:
+	movzbl	38(%rsp), %eax
+	movb	%al, 8(%rsp)
+	testb	%al, %al
+	jne	.L2028
+	testq	%r13, %r13
+	jne	.L2283
+.L2029:
+	testq	%rbp, %rbp
+	jne	.L2033
+	jmp	.L2028
+	.p2align 4,,10
+	.p2align 3
+.L2285:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2284
+.L2033:
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movl	%r12d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L2285
+	je	.L2286
+	movq	%rax, 72(%rsp)
+	movq	%rax, %r13
+	movq	%rbx, %rsi
+	xorl	%edx, %edx
+	jmp	.L2096
+	.p2align 4,,10
+	.p2align 3
+.L2251:
+	movzbl	38(%rsp), %eax
+	movb	%al, 8(%rsp)
+	testb	%al, %al
+	jne	.L2037
+	testq	%r13, %r13
+	jne	.L2287
+.L2038:
+	testq	%rbp, %rbp
+	jne	.L2042
+	jmp	.L2037
+	.p2align 4,,10
+	.p2align 3
+.L2289:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2288
+.L2042:
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movl	%r12d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L2289
+	je	.L2290
+	movq	%rax, 72(%rsp)
+	movq	%rax, %r13
+	movq	%rbx, %rsi
+	xorl	%edx, %edx
+	jmp	.L2095
+	.p2align 4,,10
+	.p2align 3
+.L2252:
+	movzbl	38(%rsp), %eax
+	movb	%al, 8(%rsp)
+	testb	%al, %al
+	jne	.L2046
+	testq	%r13, %r13
+	jne	.L2291
+.L2047:
+	testq	%rbp, %rbp
+	jne	.L2048
+	jmp	.L2046
+	.p2align 4,,10
+	.p2align 3
+.L2293:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2292
+.L2048:
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movl	%r12d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L2293
+	je	.L2294
+	movq	%rax, 72(%rsp)
+	movq	%rax, %r13
+	movq	%rbx, %rsi
+	xorl	%edx, %edx
+	jmp	.L2094
+	.p2align 4,,10
+	.p2align 3
+.L2253:
+	movzbl	38(%rsp), %eax
+	movb	%al, 8(%rsp)
+	testb	%al, %al
+	jne	.L2055
+	testq	%r13, %r13
+	jne	.L2295
+.L2056:
+	testq	%rbp, %rbp
+	jne	.L2060
+	jmp	.L2055
+	.p2align 4,,10
+	.p2align 3
+.L2297:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2296
+.L2060:
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movl	%r12d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L2297
+	je	.L2298
+	movq	%rax, 72(%rsp)
+	movq	%rax, %r13
+	movq	%rbx, %rsi
+	xorl	%edx, %edx
+	jmp	.L2093
+	.p2align 4,,10
+	.p2align 3
+.L2254:
+	movzbl	38(%rsp), %eax
+	movb	%al, 8(%rsp)
+	testb	%al, %al
+	jne	.L2064
+	testq	%r13, %r13
+	jne	.L2299
+.L2065:
+	testq	%rbp, %rbp
+	jne	.L2069
+	jmp	.L2064
+	.p2align 4,,10
+	.p2align 3
+.L2301:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2300
+.L2069:
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movl	%r12d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L2301
+	je	.L2302
+	movq	%rax, 72(%rsp)
+	movq	%rax, %r13
+	movq	%rbx, %rsi
+	xorl	%edx, %edx
+	jmp	.L2092
+	.p2align 4,,10
+	.p2align 3
+.L2237:
+	testq	%r13, %r13
+	jne	.L1958
+.L1963:
+	xorl	%r13d, %r13d
+	jmp	.L1957
+	.p2align 4,,10
+	.p2align 3
+.L2255:
+	testq	%r13, %r13
+	jne	.L2303
+	testq	%rbp, %rbp
+	jne	.L2079
+	jmp	.L2073
+	.p2align 4,,10
+	.p2align 3
+.L2305:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2304
+.L2079:
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movl	%r12d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L2305
+	je	.L2306
+	movq	%rax, 72(%rsp)
+	movq	%rax, %r13
+	xorl	%eax, %eax
+	jmp	.L2091
+	.p2align 4,,10
+	.p2align 3
+.L2272:
+	movl	$1, %eax
+.L2005:
+	movzbl	8(%rsp), %ecx
+	movb	%al, 38(%rsp)
+	movb	%cl, 37(%rsp)
+	jmp	.L2001
+	.p2align 4,,10
+	.p2align 3
+.L2304:
+	movl	$1, %eax
+.L2078:
+	movzbl	8(%rsp), %ecx
+	movb	%al, 38(%rsp)
+	movb	%cl, 37(%rsp)
+	jmp	.L2073
+	.p2align 4,,10
+	.p2align 3
+.L2288:
+	movl	$1, %eax
+.L2041:
+	movzbl	8(%rsp), %ecx
+	movb	%al, 38(%rsp)
+	movb	%cl, 37(%rsp)
+	jmp	.L2037
+	.p2align 4,,10
+	.p2align 3
+.L2268:
+	movl	$1, %eax
+.L1968:
+	movb	%r12b, 37(%rsp)
+	movb	%al, 38(%rsp)
+	jmp	.L1956
+	.p2align 4,,10
+	.p2align 3
+.L2292:
+	movl	$1, %eax
+.L2050:
+	movzbl	8(%rsp), %ecx
+	movb	%al, 38(%rsp)
+	movb	%cl, 37(%rsp)
+	jmp	.L2046
+	.p2align 4,,10
+	.p2align 3
+.L2242:
+	movl	$1, %eax
+.L1978:
+	movzbl	8(%rsp), %ecx
+	movb	%al, 38(%rsp)
+	movb	%cl, 37(%rsp)
+	jmp	.L1974
+	.p2align 4,,10
+	.p2align 3
+.L2276:
+	movl	$1, %eax
+.L2014:
+	movzbl	8(%rsp), %ecx
+	movb	%al, 38(%rsp)
+	movb	%cl, 37(%rsp)
+	jmp	.L2010
+	.p2align 4,,10
+	.p2align 3
+.L2260:
+	movl	$1, %eax
+.L1987:
+	movzbl	8(%rsp), %ecx
+	movb	%al, 38(%rsp)
+	movb	%cl, 37(%rsp)
+	jmp	.L1983
+	.p2align 4,,10
+	.p2align 3
+.L2296:
+	movl	$1, %eax
+.L2059:
+	movzbl	8(%rsp), %ecx
+	movb	%al, 38(%rsp)
+	movb	%cl, 37(%rsp)
+	jmp	.L2055
+	.p2align 4,,10
+	.p2align 3
+.L2264:
+	movl	$1, %eax
+.L1996:
+	movzbl	8(%rsp), %ecx
+	movb	%al, 38(%rsp)
+	movb	%cl, 37(%rsp)
+	jmp	.L1992
+	.p2align 4,,10
+	.p2align 3
+.L2280:
+	movl	$1, %eax
+.L2023:
+	movzbl	8(%rsp), %ecx
+	movb	%al, 38(%rsp)
+	movb	%cl, 37(%rsp)
+	jmp	.L2019
+	.p2align 4,,10
+	.p2align 3
+.L2300:
+	movl	$1, %eax
+.L2068:
+	movzbl	8(%rsp), %ecx
+	movb	%al, 38(%rsp)
+	movb	%cl, 37(%rsp)
+	jmp	.L2064
+	.p2align 4,,10
+	.p2align 3
+.L2284:
+	movl	$1, %eax
+.L2032:
+	movzbl	8(%rsp), %ecx
+	movb	%al, 38(%rsp)
+	movb	%cl, 37(%rsp)
+	jmp	.L2028
+	.p2align 4,,10
+	.p2align 3
+.L2236:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1954
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1954
+.L1958:
+	movl	32(%rsp), %eax
+	movq	%rbx, %r12
+	movl	%eax, 8(%rsp)
+.L1962:
+	movl	8(%rsp), %edi
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+	call	write@PLT
+.LEHE62:
+	testq	%rax, %rax
+	js	.L2307
+	addq	%rax, %r12
+	subq	%rax, %r13
+	jne	.L1962
+.L1961:
+	movq	$0, 72(%rsp)
+	jmp	.L1963
+.L2307:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1961
+	jmp	.L1962
+.L2303:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 64(%rsp)
+	testq	%rbp, %rbp
+	jne	.L2079
+	jmp	.L2073
+	.p2align 4,,10
+	.p2align 3
+.L2283:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 64(%rsp)
+	jmp	.L2029
+.L2267:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 64(%rsp)
+	jmp	.L1965
+.L2291:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 64(%rsp)
+	jmp	.L2047
+.L2287:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 64(%rsp)
+	jmp	.L2038
+.L2271:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 64(%rsp)
+	jmp	.L2002
+.L2279:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 64(%rsp)
+	jmp	.L2020
+.L2263:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 64(%rsp)
+	jmp	.L1993
+.L2299:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 64(%rsp)
+	jmp	.L2065
+.L2241:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 64(%rsp)
+	jmp	.L1975
+.L2275:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 64(%rsp)
+	jmp	.L2011
+.L2259:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 64(%rsp)
+	jmp	.L1984
+.L2295:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 64(%rsp)
+	jmp	.L2056
+.L2262:
+	movb	$1, 8(%rsp)
+	xorl	%eax, %eax
+	jmp	.L1987
+.L2274:
+	movb	$1, 8(%rsp)
+	xorl	%eax, %eax
+	jmp	.L2005
+.L2270:
+	xorl	%eax, %eax
+	movl	$1, %r12d
+	jmp	.L1968
+.L2306:
+	movb	$1, 8(%rsp)
+	xorl	%eax, %eax
+	jmp	.L2078
+.L2302:
+	movb	$1, 8(%rsp)
+	xorl	%eax, %eax
+	jmp	.L2068
+.L2266:
+	movb	$1, 8(%rsp)
+	xorl	%eax, %eax
+	jmp	.L1996
+.L2244:
+	movb	$1, 8(%rsp)
+	xorl	%eax, %eax
+	jmp	.L1978
+.L2290:
+	movb	$1, 8(%rsp)
+	xorl	%eax, %eax
+	jmp	.L2041
+.L2294:
+	movb	$1, 8(%rsp)
+	xorl	%eax, %eax
+	jmp	.L2050
+.L2286:
+	movb	$1, 8(%rsp)
+	xorl	%eax, %eax
+	jmp	.L2032
+.L2298:
+	movb	$1, 8(%rsp)
+	xorl	%eax, %eax
+	jmp	.L2059
+.L2278:
+	movb	$1, 8(%rsp)
+	xorl	%eax, %eax
+	jmp	.L2014
+.L2282:
+	movb	$1, 8(%rsp)
+	xorl	%eax, %eax
+	jmp	.L2023
+.L2215:
+	jmp	.L2216
+.L2117:
+	movq	%rax, %rbx
+	jmp	.L2087
+	.section	.gcc_except_table
+.LLSDA6917:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6917-.LLSDACSB6917
+.LLSDACSB6917:
+	.uleb128 .LEHB57-.LFB6917
+	.uleb128 .LEHE57-.LEHB57
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB58-.LFB6917
+	.uleb128 .LEHE58-.LEHB58
+	.uleb128 .L2117-.LFB6917
+	.uleb128 0
+	.uleb128 .LEHB59-.LFB6917
+	.uleb128 .LEHE59-.LEHB59
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB60-.LFB6917
+	.uleb128 .LEHE60-.LEHB60
+	.uleb128 .L2215-.LFB6917
+	.uleb128 0
+	.uleb128 .LEHB61-.LFB6917
+	.uleb128 .LEHE61-.LEHB61
+	.uleb128 .L2215-.LFB6917
+	.uleb128 0
+	.uleb128 .LEHB62-.LFB6917
+	.uleb128 .LEHE62-.LEHB62
+	.uleb128 .L2215-.LFB6917
+	.uleb128 0
+.LLSDACSE6917:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6917
+	.type	_Z23test_file_pathable_modev.cold, @function
+_Z23test_file_pathable_modev.cold:
+.LFSB6917:
+.L2219:
+	.cfi_def_cfa_offset 160
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC72(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB63:
+	call	__cxa_throw@PLT
+.L2221:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC73(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2220:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC73(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE63:
+.L2118:
+.L2216:
+	movq	%r14, %rdi
+	movq	%rax, %rbx
+	call	_ZN1n4fileIcLNS_4modeE0EE5closeEv
+	movq	%r14, %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB64:
+	call	_Unwind_Resume@PLT
+.LEHE64:
+.L2229:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC75(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB65:
+	call	__cxa_throw@PLT
+.L2227:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC73(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2226:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC77(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2228:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC78(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2218:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC70(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2217:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC69(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE65:
+.L2087:
+	movq	%r14, %rdi
+	call	_ZN1n4fileIcLNS_4modeE1EE5closeEv
+	movq	%r14, %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB66:
+	call	_Unwind_Resume@PLT
+.LEHE66:
+.L2225:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC74(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB67:
+	call	__cxa_throw@PLT
+.L2224:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC76(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2223:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC75(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2222:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC74(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE67:
+	.cfi_endproc
+.LFE6917:
+	.section	.gcc_except_table
+.LLSDAC6917:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6917-.LLSDACSBC6917
+.LLSDACSBC6917:
+	.uleb128 .LEHB63-.LCOLDB80
+	.uleb128 .LEHE63-.LEHB63
+	.uleb128 .L2118-.LCOLDB80
+	.uleb128 0
+	.uleb128 .LEHB64-.LCOLDB80
+	.uleb128 .LEHE64-.LEHB64
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB65-.LCOLDB80
+	.uleb128 .LEHE65-.LEHB65
+	.uleb128 .L2118-.LCOLDB80
+	.uleb128 0
+	.uleb128 .LEHB66-.LCOLDB80
+	.uleb128 .LEHE66-.LEHB66
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB67-.LCOLDB80
+	.uleb128 .LEHE67-.LEHB67
+	.uleb128 .L2118-.LCOLDB80
+	.uleb128 0
+.LLSDACSEC6917:
+	.section	.text.unlikely
+	.text
+	.size	_Z23test_file_pathable_modev, .-_Z23test_file_pathable_modev
+	.section	.text.unlikely
+	.size	_Z23test_file_pathable_modev.cold, .-_Z23test_file_pathable_modev.cold
+.LCOLDE80:
+	.text
+.LHOTE80:
+	.section	.text._ZN1n4fileIcLNS_4modeE7EE5closeEv,"axG",@progbits,_ZN1n4fileIcLNS_4modeE7EE5closeEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4fileIcLNS_4modeE7EE5closeEv
+	.type	_ZN1n4fileIcLNS_4modeE7EE5closeEv, @function
+_ZN1n4fileIcLNS_4modeE7EE5closeEv:
+.LFB7132:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movl	(%rdi), %ebp
+	testl	%ebp, %ebp
+	js	.L2309
+	cmpl	$2, 8(%rdi)
+	je	.L2334
+.L2310:
+	cmpb	$0, 4(%rbx)
+	jne	.L2335
+.L2315:
+	movl	$-1, (%rbx)
+.L2309:
+	cmpq	$0, 16(%rbx)
+	je	.L2316
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2336
+.L2318:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	$0, 16(%rbx)
+.L2316:
+	movq	48(%rbx), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 8(%rbx)
+	movups	%xmm0, 32(%rbx)
+	testq	%rdi, %rdi
+	je	.L2308
+	call	fclose@PLT
+	movq	$0, 48(%rbx)
+.L2308:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2334:
+	.cfi_restore_state
+	movq	40(%rdi), %r12
+	testq	%r12, %r12
+	je	.L2310
+	movq	16(%rdi), %r13
+.L2314:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L2337
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L2314
+	.p2align 4,,10
+	.p2align 3
+.L2313:
+	movq	$0, 40(%rbx)
+	jmp	.L2310
+	.p2align 4,,10
+	.p2align 3
+.L2335:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L2315
+	.p2align 4,,10
+	.p2align 3
+.L2336:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2318
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2318
+	.p2align 4,,10
+	.p2align 3
+.L2337:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2313
+	jmp	.L2314
+	.cfi_endproc
+.LFE7132:
+	.size	_ZN1n4fileIcLNS_4modeE7EE5closeEv, .-_ZN1n4fileIcLNS_4modeE7EE5closeEv
+	.section	.rodata.str1.8
+	.align 8
+.LC81:
+	.string	"expected true : n::stdw.opened()"
+	.section	.text.unlikely
+.LCOLDB82:
+	.text
+.LHOTB82:
+	.p2align 4
+	.globl	_Z21test_file_stdout_modev
+	.type	_Z21test_file_stdout_modev, @function
+_Z21test_file_stdout_modev:
+.LFB6930:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6930
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$1, %esi
+	movl	$1, %edi
+	xorl	%eax, %eax
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 96
+	movdqa	.LC46(%rip), %xmm0
+	movl	$-1, (%rsp)
+	movw	$0, 4(%rsp)
+	movb	$0, 6(%rsp)
+	movq	$0, 8(%rsp)
+	movq	$0, 16(%rsp)
+	movq	$0, 40(%rsp)
+	movq	$0, 48(%rsp)
+	movups	%xmm0, 24(%rsp)
+.LEHB68:
+	call	fcntl@PLT
+.LEHE68:
+	cmpl	$-1, %eax
+	je	.L2344
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L2342:
+	.cfi_restore_state
+	jmp	.L2343
+	.section	.gcc_except_table
+.LLSDA6930:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6930-.LLSDACSB6930
+.LLSDACSB6930:
+	.uleb128 .LEHB68-.LFB6930
+	.uleb128 .LEHE68-.LEHB68
+	.uleb128 .L2342-.LFB6930
+	.uleb128 0
+.LLSDACSE6930:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6930
+	.type	_Z21test_file_stdout_modev.cold, @function
+_Z21test_file_stdout_modev.cold:
+.LFSB6930:
+.L2344:
+	.cfi_def_cfa_offset 96
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC81(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB69:
+	call	__cxa_throw@PLT
+.LEHE69:
+.L2341:
+.L2343:
+	movq	%rsp, %rbp
+	movq	%rax, %rbx
+	movq	%rbp, %rdi
+	call	_ZN1n4fileIcLNS_4modeE7EE5closeEv
+	movq	%rbp, %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB70:
+	call	_Unwind_Resume@PLT
+.LEHE70:
+	.cfi_endproc
+.LFE6930:
+	.section	.gcc_except_table
+.LLSDAC6930:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6930-.LLSDACSBC6930
+.LLSDACSBC6930:
+	.uleb128 .LEHB69-.LCOLDB82
+	.uleb128 .LEHE69-.LEHB69
+	.uleb128 .L2341-.LCOLDB82
+	.uleb128 0
+	.uleb128 .LEHB70-.LCOLDB82
+	.uleb128 .LEHE70-.LEHB70
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6930:
+	.section	.text.unlikely
+	.text
+	.size	_Z21test_file_stdout_modev, .-_Z21test_file_stdout_modev
+	.section	.text.unlikely
+	.size	_Z21test_file_stdout_modev.cold, .-_Z21test_file_stdout_modev.cold
+.LCOLDE82:
+	.text
+.LHOTE82:
+	.section	.text._ZN1n14__avx512_countIcEEmPKT_mS1_,"axG",@progbits,_ZN1n14__avx512_countIcEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n14__avx512_countIcEEmPKT_mS1_
+	.type	_ZN1n14__avx512_countIcEEmPKT_mS1_, @function
+_ZN1n14__avx512_countIcEEmPKT_mS1_:
+.LFB7199:
+	.cfi_startproc
+	movl	%edx, %r10d
+	vpbroadcastb	%edx, %zmm5
+	movl	$64, %eax
+	xorl	%r8d, %r8d
+	cmpq	$63, %rsi
+	jbe	.L2372
+	.p2align 4,,10
+	.p2align 3
+.L2350:
+	vpcmpeqb	-64(%rdi,%rax), %zmm5, %k0
+	movq	%rax, %r9
+	addq	$64, %rax
+	kmovq	%k0, %rcx
+	popcntq	%rcx, %rcx
+	addq	%rcx, %r8
+	cmpq	%rax, %rsi
+	jnb	.L2350
+	subq	%r9, %rsi
+	je	.L2346
+	leaq	-1(%rsi), %rax
+	cmpq	$62, %rax
+	jbe	.L2357
+	movq	%rsi, %rcx
+	addq	%r9, %rdi
+	movl	$1, %r9d
+	andq	$-64, %rcx
+	movq	%rdi, %rax
+	vpxor	%xmm7, %xmm7, %xmm7
+	addq	%rdi, %rcx
+	vpbroadcastb	%r9d, %zmm6
+	.p2align 4,,10
+	.p2align 3
+.L2351:
+	vpcmpb	$0, (%rax), %zmm5, %k1
+	addq	$64, %rax
+	vmovdqu8	%zmm6, %zmm0{%k1}{z}
+	vpmovzxbw	%ymm0, %zmm1
+	vextracti64x4	$0x1, %zmm0, %ymm0
+	vpmovzxwd	%ymm1, %zmm4
+	vextracti64x4	$0x1, %zmm1, %ymm1
+	vpmovzxbw	%ymm0, %zmm0
+	vpmovzxdq	%ymm4, %zmm2
+	vextracti64x4	$0x1, %zmm4, %ymm4
+	vpmovzxwd	%ymm1, %zmm1
+	vpmovzxdq	%ymm4, %zmm4
+	vpmovzxwd	%ymm0, %zmm3
+	vextracti64x4	$0x1, %zmm0, %ymm0
+	vpaddq	%zmm4, %zmm2, %zmm2
+	vpmovzxdq	%ymm1, %zmm4
+	vextracti64x4	$0x1, %zmm1, %ymm1
+	vpmovzxdq	%ymm1, %zmm1
+	vpmovzxwd	%ymm0, %zmm0
+	vpaddq	%zmm1, %zmm4, %zmm4
+	vpmovzxdq	%ymm3, %zmm1
+	vextracti64x4	$0x1, %zmm3, %ymm3
+	vpmovzxdq	%ymm3, %zmm3
+	vpaddq	%zmm4, %zmm2, %zmm2
+	vpaddq	%zmm3, %zmm1, %zmm1
+	vpmovzxdq	%ymm0, %zmm3
+	vextracti64x4	$0x1, %zmm0, %ymm0
+	vpaddq	%zmm3, %zmm1, %zmm1
+	vpmovzxdq	%ymm0, %zmm0
+	vpaddq	%zmm1, %zmm2, %zmm2
+	vpaddq	%zmm7, %zmm0, %zmm0
+	vpaddq	%zmm0, %zmm2, %zmm7
+	cmpq	%rax, %rcx
+	jne	.L2351
+	vmovdqa	%ymm7, %ymm3
+	vextracti64x4	$0x1, %zmm7, %ymm7
+	movq	%rsi, %rax
+	vpaddq	%ymm7, %ymm3, %ymm3
+	andq	$-64, %rax
+	vextracti128	$0x1, %ymm3, %xmm1
+	vpaddq	%xmm1, %xmm3, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rcx
+	testb	$63, %sil
+	je	.L2352
+.L2348:
+	movq	%rsi, %r9
+	subq	%rax, %r9
+	leaq	-1(%r9), %r11
+	cmpq	$30, %r11
+	jbe	.L2355
+	vmovd	%edx, %xmm0
+	movl	$1, %edx
+	vpbroadcastb	%xmm0, %ymm0
+	vmovd	%edx, %xmm1
+	movq	%r9, %rdx
+	vpcmpeqb	(%rdi,%rax), %ymm0, %ymm0
+	vpbroadcastb	%xmm1, %ymm1
+	andq	$-32, %rdx
+	addq	%rdx, %rax
+	andl	$31, %r9d
+	vpand	%ymm1, %ymm0, %ymm0
+	vpmovzxbw	%xmm0, %ymm2
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxwd	%xmm2, %ymm4
+	vextracti128	$0x1, %ymm2, %xmm2
+	vpmovzxbw	%xmm0, %ymm0
+	vpmovzxwd	%xmm2, %ymm2
+	vpmovzxwd	%xmm0, %ymm5
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxdq	%xmm2, %ymm1
+	vextracti128	$0x1, %ymm2, %xmm2
+	vpmovzxwd	%xmm0, %ymm0
+	vpmovzxdq	%xmm2, %ymm2
+	vpaddq	%ymm2, %ymm1, %ymm1
+	vpmovzxdq	%xmm4, %ymm2
+	vextracti128	$0x1, %ymm4, %xmm4
+	vpmovzxdq	%xmm4, %ymm4
+	vpaddq	%ymm4, %ymm2, %ymm2
+	vpaddq	%ymm2, %ymm1, %ymm1
+	vpmovzxdq	%xmm5, %ymm2
+	vextracti128	$0x1, %ymm5, %xmm5
+	vpmovzxdq	%xmm5, %ymm5
+	vpaddq	%ymm5, %ymm2, %ymm2
+	vpaddq	%ymm3, %ymm2, %ymm2
+	vpaddq	%ymm2, %ymm1, %ymm1
+	vpmovzxdq	%xmm0, %ymm2
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxdq	%xmm0, %ymm0
+	vpaddq	%ymm0, %ymm2, %ymm0
+	vpaddq	%ymm0, %ymm1, %ymm1
+	vmovdqa	%xmm1, %xmm0
+	vextracti128	$0x1, %ymm1, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rcx
+	je	.L2352
+	.p2align 4,,10
+	.p2align 3
+.L2355:
+	xorl	%edx, %edx
+	cmpb	%r10b, (%rdi,%rax)
+	sete	%dl
+	addq	$1, %rax
+	addq	%rdx, %rcx
+	cmpq	%rsi, %rax
+	jb	.L2355
+.L2352:
+	addq	%rcx, %r8
+.L2346:
+	movq	%r8, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2372:
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	testq	%rsi, %rsi
+	jne	.L2348
+	jmp	.L2346
+.L2357:
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	addq	%r9, %rdi
+	jmp	.L2348
+	.cfi_endproc
+.LFE7199:
+	.size	_ZN1n14__avx512_countIcEEmPKT_mS1_, .-_ZN1n14__avx512_countIcEEmPKT_mS1_
+	.section	.text._ZN1n12__avx2_countIcEEmPKT_mS1_,"axG",@progbits,_ZN1n12__avx2_countIcEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n12__avx2_countIcEEmPKT_mS1_
+	.type	_ZN1n12__avx2_countIcEEmPKT_mS1_, @function
+_ZN1n12__avx2_countIcEEmPKT_mS1_:
+.LFB7200:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	vmovd	%edx, %xmm2
+	movq	%rdi, %r10
+	movl	%edx, %r11d
+	movq	%rsi, %rdi
+	vpbroadcastb	%xmm2, %ymm2
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	.cfi_offset 14, -24
+	.cfi_offset 13, -32
+	.cfi_offset 12, -40
+	.cfi_offset 3, -48
+	cmpq	$31, %rsi
+	jbe	.L2374
+	xorl	%edx, %edx
+	xorl	%r9d, %r9d
+	movl	$32, %r8d
+	xorl	%ebx, %ebx
+	vpxor	%xmm3, %xmm3, %xmm3
+	.p2align 4,,10
+	.p2align 3
+.L2380:
+	movq	%rdi, %r12
+	movl	$255, %ecx
+	subq	%rdx, %r12
+	movq	%r12, %rsi
+	shrq	$5, %rsi
+	cmpq	%rcx, %rsi
+	cmovbe	%rsi, %rcx
+	testq	%rsi, %rsi
+	je	.L2387
+	addq	%r10, %rdx
+	vpxor	%xmm1, %xmm1, %xmm1
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L2376:
+	vpcmpeqb	(%rdx), %ymm2, %ymm0
+	addq	$1, %rax
+	addq	$32, %rdx
+	vpsubb	%ymm0, %ymm1, %ymm0
+	vmovdqa	%ymm0, %ymm1
+	cmpq	%rcx, %rax
+	jb	.L2376
+	subq	$1, %rcx
+	movq	%rdi, %r12
+	salq	$5, %rcx
+	testq	%rsi, %rsi
+	cmove	%rbx, %rcx
+	leaq	(%rcx,%r8), %rdx
+	subq	%rdx, %r12
+	leaq	32(%rdx), %r8
+.L2375:
+	vpsadbw	%ymm3, %ymm0, %ymm0
+	vmovq	%xmm0, %rcx
+	vpextrq	$1, %xmm0, %r14
+	vextracti128	$0x1, %ymm0, %xmm0
+	addq	%r14, %rcx
+	vmovq	%xmm0, %r13
+	vpextrq	$1, %xmm0, %rax
+	addq	%r9, %rcx
+	addq	%r13, %rcx
+	leaq	(%rax,%rcx), %r9
+	cmpq	%r8, %rdi
+	jb	.L2401
+	testq	%rsi, %rsi
+	jne	.L2380
+.L2381:
+	jmp	.L2381
+	.p2align 4,,10
+	.p2align 3
+.L2401:
+	testq	%r12, %r12
+	je	.L2373
+	leaq	-1(%r12), %rax
+	cmpq	$30, %rax
+	jbe	.L2389
+	movq	%r12, %rsi
+	leaq	(%r10,%rdx), %rcx
+	vpxor	%xmm3, %xmm3, %xmm3
+	movl	$1, %edi
+	andq	$-32, %rsi
+	vmovd	%edi, %xmm4
+	movq	%rcx, %rax
+	addq	%rcx, %rsi
+	vpbroadcastb	%xmm4, %ymm4
+	.p2align 4,,10
+	.p2align 3
+.L2383:
+	vpcmpeqb	(%rax), %ymm2, %ymm0
+	addq	$32, %rax
+	vpand	%ymm4, %ymm0, %ymm0
+	vpmovzxbw	%xmm0, %ymm1
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxwd	%xmm1, %ymm7
+	vextracti128	$0x1, %ymm1, %xmm1
+	vpmovzxbw	%xmm0, %ymm0
+	vpmovzxwd	%xmm1, %ymm1
+	vpmovzxwd	%xmm0, %ymm6
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxdq	%xmm1, %ymm5
+	vextracti128	$0x1, %ymm1, %xmm1
+	vpmovzxwd	%xmm0, %ymm0
+	vpmovzxdq	%xmm1, %ymm1
+	vpaddq	%ymm1, %ymm5, %ymm1
+	vpmovzxdq	%xmm7, %ymm5
+	vextracti128	$0x1, %ymm7, %xmm7
+	vpmovzxdq	%xmm7, %ymm7
+	vpaddq	%ymm7, %ymm5, %ymm5
+	vpaddq	%ymm5, %ymm1, %ymm1
+	vpmovzxdq	%xmm6, %ymm5
+	vextracti128	$0x1, %ymm6, %xmm6
+	vpmovzxdq	%xmm6, %ymm6
+	vpaddq	%ymm6, %ymm5, %ymm5
+	vpmovzxdq	%xmm0, %ymm6
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpaddq	%ymm6, %ymm5, %ymm5
+	vpmovzxdq	%xmm0, %ymm0
+	vpaddq	%ymm5, %ymm1, %ymm1
+	vpaddq	%ymm3, %ymm0, %ymm0
+	vpaddq	%ymm0, %ymm1, %ymm3
+	cmpq	%rax, %rsi
+	jne	.L2383
+	vmovdqa	%xmm3, %xmm0
+	vextracti128	$0x1, %ymm3, %xmm3
+	movq	%r12, %r8
+	vpaddq	%xmm3, %xmm0, %xmm3
+	andq	$-32, %r8
+	vpsrldq	$8, %xmm3, %xmm0
+	vpaddq	%xmm0, %xmm3, %xmm0
+	vmovq	%xmm0, %rax
+	testb	$31, %r12b
+	je	.L2384
+.L2382:
+	movq	%r12, %rsi
+	subq	%r8, %rsi
+	leaq	-1(%rsi), %rdi
+	cmpq	$14, %rdi
+	jbe	.L2385
+	vmovd	%r11d, %xmm0
+	movl	$1, %eax
+	movq	%rsi, %rdi
+	vpbroadcastb	%xmm0, %xmm0
+	vmovd	%eax, %xmm1
+	andq	$-16, %rdi
+	vpcmpeqb	(%rcx,%r8), %xmm0, %xmm0
+	vpbroadcastb	%xmm1, %xmm1
+	addq	%rdi, %r8
+	andl	$15, %esi
+	vpand	%xmm1, %xmm0, %xmm0
+	vpmovzxbw	%xmm0, %xmm2
+	vpsrldq	$8, %xmm0, %xmm0
+	vpmovzxwd	%xmm2, %xmm5
+	vpsrldq	$8, %xmm2, %xmm2
+	vpmovzxbw	%xmm0, %xmm0
+	vpmovzxdq	%xmm5, %xmm1
+	vpsrldq	$8, %xmm5, %xmm5
+	vpmovzxwd	%xmm2, %xmm2
+	vpmovzxdq	%xmm5, %xmm5
+	vpmovzxwd	%xmm0, %xmm4
+	vpaddq	%xmm5, %xmm1, %xmm1
+	vpsrldq	$8, %xmm0, %xmm0
+	vpmovzxdq	%xmm2, %xmm5
+	vpsrldq	$8, %xmm2, %xmm2
+	vpmovzxwd	%xmm0, %xmm0
+	vpmovzxdq	%xmm2, %xmm2
+	vpaddq	%xmm2, %xmm5, %xmm2
+	vpaddq	%xmm2, %xmm1, %xmm1
+	vpmovzxdq	%xmm4, %xmm2
+	vpsrldq	$8, %xmm4, %xmm4
+	vpmovzxdq	%xmm4, %xmm4
+	vpaddq	%xmm4, %xmm2, %xmm2
+	vpaddq	%xmm3, %xmm2, %xmm2
+	vpaddq	%xmm2, %xmm1, %xmm1
+	vpmovzxdq	%xmm0, %xmm2
+	vpsrldq	$8, %xmm0, %xmm0
+	vpmovzxdq	%xmm0, %xmm0
+	vpaddq	%xmm0, %xmm2, %xmm0
+	vpaddq	%xmm0, %xmm1, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rax
+	je	.L2384
+.L2385:
+	xorl	%esi, %esi
+	cmpb	%r11b, (%rcx,%r8)
+	sete	%sil
+	addq	%rsi, %rax
+	leaq	1(%r8), %rsi
+	cmpq	%r12, %rsi
+	jnb	.L2384
+	addq	%rsi, %r10
+	cmpb	%r11b, (%r10,%rdx)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+	leaq	2(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2384
+	xorl	%edx, %edx
+	cmpb	%r11b, 2(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	3(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2384
+	xorl	%edx, %edx
+	cmpb	%r11b, 3(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	4(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2384
+	xorl	%edx, %edx
+	cmpb	%r11b, 4(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	5(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2384
+	xorl	%edx, %edx
+	cmpb	%r11b, 5(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	6(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2384
+	xorl	%edx, %edx
+	cmpb	%r11b, 6(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	7(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2384
+	xorl	%edx, %edx
+	cmpb	%r11b, 7(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	8(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2384
+	xorl	%edx, %edx
+	cmpb	%r11b, 8(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	9(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2384
+	xorl	%edx, %edx
+	cmpb	%r11b, 9(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	10(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2384
+	xorl	%edx, %edx
+	cmpb	%r11b, 10(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	11(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2384
+	xorl	%edx, %edx
+	cmpb	%r11b, 11(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	12(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2384
+	xorl	%edx, %edx
+	cmpb	%r11b, 12(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	13(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2384
+	xorl	%edx, %edx
+	cmpb	%r11b, 13(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	14(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L2384
+	xorl	%edx, %edx
+	cmpb	%r11b, 14(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	.p2align 4,,10
+	.p2align 3
+.L2384:
+	addq	%rax, %r9
+.L2373:
+	vzeroupper
+	movq	%r9, %rax
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2387:
+	.cfi_restore_state
+	vpxor	%xmm0, %xmm0, %xmm0
+	jmp	.L2375
+.L2374:
+	xorl	%r9d, %r9d
+	testq	%rsi, %rsi
+	je	.L2373
+	movq	%rsi, %r12
+	xorl	%edx, %edx
+	xorl	%r9d, %r9d
+	xorl	%eax, %eax
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%r8d, %r8d
+	movq	%r10, %rcx
+	jmp	.L2382
+.L2389:
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%eax, %eax
+	leaq	(%r10,%rdx), %rcx
+	xorl	%r8d, %r8d
+	jmp	.L2382
+	.cfi_endproc
+.LFE7200:
+	.size	_ZN1n12__avx2_countIcEEmPKT_mS1_, .-_ZN1n12__avx2_countIcEEmPKT_mS1_
+	.section	.text._ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE,"axG",@progbits,_ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE,comdat
+	.p2align 4
+	.weak	_ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE
+	.type	_ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE, @function
+_ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE:
+.LFB7178:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	movl	%ecx, %r13d
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movl	%edx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	movq	%rsi, %rbx
+	testb	%al, %al
+	je	.L2467
+.L2404:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %r13d
+	jge	.L2468
+.L2444:
+	cmpl	$2, %r13d
+	je	.L2415
+.L2470:
+	cmpl	$3, %r13d
+	je	.L2416
+	cmpl	$1, %r13d
+	je	.L2417
+	xorl	%esi, %esi
+	testq	%rbx, %rbx
+	je	.L2402
+	leaq	-1(%rbx), %rax
+	cmpq	$14, %rax
+	jbe	.L2442
+	movd	%r12d, %xmm7
+	movq	%rbx, %rdx
+	pxor	%xmm4, %xmm4
+	movq	%rbp, %rax
+	punpcklbw	%xmm7, %xmm7
+	pxor	%xmm6, %xmm6
+	pxor	%xmm5, %xmm5
+	andq	$-16, %rdx
+	punpcklwd	%xmm7, %xmm7
+	movdqa	.LC85(%rip), %xmm3
+	addq	%rbp, %rdx
+	pxor	%xmm8, %xmm8
+	pshufd	$0, %xmm7, %xmm7
+	.p2align 4,,10
+	.p2align 3
+.L2432:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqb	%xmm7, %xmm0
+	pand	%xmm3, %xmm0
+	movdqa	%xmm0, %xmm2
+	punpckhbw	%xmm8, %xmm0
+	punpcklbw	%xmm8, %xmm2
+	movdqa	%xmm0, %xmm9
+	punpckhwd	%xmm6, %xmm0
+	movdqa	%xmm2, %xmm1
+	punpckhwd	%xmm6, %xmm2
+	punpcklwd	%xmm6, %xmm9
+	punpcklwd	%xmm6, %xmm1
+	movdqa	%xmm1, %xmm10
+	punpckldq	%xmm5, %xmm1
+	punpckhdq	%xmm5, %xmm10
+	paddq	%xmm10, %xmm1
+	movdqa	%xmm2, %xmm10
+	punpckldq	%xmm5, %xmm2
+	punpckhdq	%xmm5, %xmm10
+	paddq	%xmm10, %xmm2
+	paddq	%xmm2, %xmm1
+	movdqa	%xmm9, %xmm2
+	punpckldq	%xmm5, %xmm9
+	punpckhdq	%xmm5, %xmm2
+	paddq	%xmm2, %xmm9
+	movdqa	%xmm0, %xmm2
+	punpckhdq	%xmm5, %xmm0
+	punpckldq	%xmm5, %xmm2
+	paddq	%xmm4, %xmm0
+	paddq	%xmm2, %xmm9
+	paddq	%xmm9, %xmm1
+	movdqa	%xmm1, %xmm4
+	paddq	%xmm0, %xmm4
+	cmpq	%rax, %rdx
+	jne	.L2432
+	movdqa	%xmm4, %xmm0
+	movq	%rbx, %rax
+	psrldq	$8, %xmm0
+	andq	$-16, %rax
+	paddq	%xmm0, %xmm4
+	movq	%xmm4, %rsi
+	testb	$15, %bl
+	je	.L2402
+.L2431:
+	xorl	%edx, %edx
+	cmpb	%r12b, 0(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	1(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L2402
+	xorl	%edx, %edx
+	cmpb	%r12b, 1(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	2(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L2402
+	xorl	%edx, %edx
+	cmpb	%r12b, 2(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	3(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L2402
+	xorl	%edx, %edx
+	cmpb	%r12b, 3(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	4(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L2402
+	xorl	%edx, %edx
+	cmpb	%r12b, 4(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	5(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L2402
+	xorl	%edx, %edx
+	cmpb	%r12b, 5(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	6(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L2402
+	xorl	%edx, %edx
+	cmpb	%r12b, 6(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	7(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L2402
+	xorl	%edx, %edx
+	cmpb	%r12b, 7(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	8(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L2402
+	xorl	%edx, %edx
+	cmpb	%r12b, 8(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	9(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L2402
+	xorl	%edx, %edx
+	cmpb	%r12b, 9(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	10(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L2402
+	xorl	%edx, %edx
+	cmpb	%r12b, 10(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	11(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L2402
+	xorl	%edx, %edx
+	cmpb	%r12b, 11(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	12(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L2402
+	xorl	%edx, %edx
+	cmpb	%r12b, 12(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	13(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L2402
+	xorl	%edx, %edx
+	cmpb	%r12b, 13(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	14(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L2402
+	cmpb	%r12b, 14(%rbp,%rax)
+	sete	%al
+	movzbl	%al, %eax
+	.p2align 4,,10
+	.p2align 3
+.L2466:
+	addq	%rax, %rsi
+.L2402:
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%rsi, %rax
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+.L2443:
+	.p2align 4,,10
+	.p2align 3
+.L2468:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L2469
+.L2411:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %r13d
+	cmpl	$2, %r13d
+	jne	.L2470
+.L2415:
+	movsbl	%r12b, %edx
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n12__avx2_countIcEEmPKT_mS1_
+	.p2align 4,,10
+	.p2align 3
+.L2467:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r14
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2404
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L2435
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L2406:
+	movq	%r14, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2404
+	.p2align 4,,10
+	.p2align 3
+.L2417:
+	movd	%r12d, %xmm4
+	xorl	%esi, %esi
+	punpcklbw	%xmm4, %xmm4
+	punpcklwd	%xmm4, %xmm4
+	pshufd	$0, %xmm4, %xmm4
+	cmpq	$15, %rbx
+	jbe	.L2420
+	xorl	%edx, %edx
+	movl	$16, %r9d
+	pxor	%xmm3, %xmm3
+	xorl	%r8d, %r8d
+	.p2align 4,,10
+	.p2align 3
+.L2423:
+	movq	%rbx, %rax
+	movl	$255, %ecx
+	subq	%rdx, %rax
+	movq	%rax, %rdi
+	shrq	$4, %rdi
+	cmpq	%rcx, %rdi
+	cmovbe	%rdi, %rcx
+	testq	%rdi, %rdi
+	je	.L2421
+	addq	%rbp, %rdx
+	pxor	%xmm2, %xmm2
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L2422:
+	movdqu	(%rdx), %xmm0
+	movdqa	%xmm2, %xmm1
+	addq	$1, %rax
+	addq	$16, %rdx
+	pcmpeqb	%xmm4, %xmm0
+	psubb	%xmm0, %xmm1
+	movdqa	%xmm1, %xmm2
+	cmpq	%rcx, %rax
+	jb	.L2422
+	subq	$1, %rcx
+	psadbw	%xmm3, %xmm1
+	salq	$4, %rcx
+	movhlps	%xmm1, %xmm7
+	movq	%xmm1, %rax
+	testq	%rdi, %rdi
+	cmove	%r8, %rcx
+	leaq	(%rcx,%r9), %rdx
+	movq	%xmm7, %rcx
+	addq	%rcx, %rax
+	leaq	16(%rdx), %r9
+	addq	%rax, %rsi
+	cmpq	%r9, %rbx
+	jnb	.L2423
+	subq	%rdx, %rbx
+.L2425:
+	testq	%rbx, %rbx
+	je	.L2402
+	leaq	-1(%rbx), %rax
+	cmpq	$14, %rax
+	jbe	.L2441
+	movq	%rbx, %rcx
+	pxor	%xmm6, %xmm6
+	pxor	%xmm8, %xmm8
+	addq	%rbp, %rdx
+	andq	$-16, %rcx
+	pxor	%xmm7, %xmm7
+	pxor	%xmm5, %xmm5
+	movq	%rdx, %rax
+	movdqa	.LC85(%rip), %xmm3
+	addq	%rdx, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L2429:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqb	%xmm4, %xmm0
+	pand	%xmm3, %xmm0
+	movdqa	%xmm0, %xmm2
+	punpckhbw	%xmm8, %xmm0
+	punpcklbw	%xmm8, %xmm2
+	movdqa	%xmm0, %xmm9
+	punpckhwd	%xmm7, %xmm0
+	movdqa	%xmm2, %xmm1
+	punpckhwd	%xmm7, %xmm2
+	punpcklwd	%xmm7, %xmm9
+	punpcklwd	%xmm7, %xmm1
+	movdqa	%xmm1, %xmm10
+	punpckhdq	%xmm5, %xmm1
+	punpckldq	%xmm5, %xmm10
+	paddq	%xmm10, %xmm1
+	movdqa	%xmm2, %xmm10
+	punpckhdq	%xmm5, %xmm2
+	punpckldq	%xmm5, %xmm10
+	paddq	%xmm10, %xmm2
+	paddq	%xmm2, %xmm1
+	movdqa	%xmm9, %xmm2
+	punpckhdq	%xmm5, %xmm9
+	punpckldq	%xmm5, %xmm2
+	paddq	%xmm2, %xmm9
+	movdqa	%xmm0, %xmm2
+	punpckhdq	%xmm5, %xmm0
+	punpckldq	%xmm5, %xmm2
+	paddq	%xmm6, %xmm0
+	paddq	%xmm2, %xmm9
+	paddq	%xmm9, %xmm1
+	movdqa	%xmm1, %xmm6
+	paddq	%xmm0, %xmm6
+	cmpq	%rax, %rcx
+	jne	.L2429
+	movdqa	%xmm6, %xmm0
+	movq	%rbx, %rcx
+	psrldq	$8, %xmm0
+	andq	$-16, %rcx
+	paddq	%xmm0, %xmm6
+	movq	%xmm6, %rax
+	testb	$15, %bl
+	je	.L2466
+.L2427:
+	xorl	%edi, %edi
+	cmpb	%r12b, (%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	1(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L2466
+	xorl	%edi, %edi
+	cmpb	%r12b, 1(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	2(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L2466
+	xorl	%edi, %edi
+	cmpb	%r12b, 2(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	3(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L2466
+	xorl	%edi, %edi
+	cmpb	%r12b, 3(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	4(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L2466
+	xorl	%edi, %edi
+	cmpb	%r12b, 4(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	5(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L2466
+	xorl	%edi, %edi
+	cmpb	%r12b, 5(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	6(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L2466
+	xorl	%edi, %edi
+	cmpb	%r12b, 6(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	7(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L2466
+	xorl	%edi, %edi
+	cmpb	%r12b, 7(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	8(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L2466
+	xorl	%edi, %edi
+	cmpb	%r12b, 8(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	9(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L2466
+	xorl	%edi, %edi
+	cmpb	%r12b, 9(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	10(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L2466
+	xorl	%edi, %edi
+	cmpb	%r12b, 10(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	11(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L2466
+	xorl	%edi, %edi
+	cmpb	%r12b, 11(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	12(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L2466
+	xorl	%edi, %edi
+	cmpb	%r12b, 12(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	13(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L2466
+	xorl	%edi, %edi
+	cmpb	%r12b, 13(%rdx,%rcx)
+	sete	%dil
+	addq	$14, %rcx
+	addq	%rdi, %rax
+	cmpq	%rbx, %rcx
+	jnb	.L2466
+	cmpb	%r12b, (%rdx,%rcx)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+	jmp	.L2466
+	.p2align 4,,10
+	.p2align 3
+.L2416:
+	movsbl	%r12b, %edx
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n14__avx512_countIcEEmPKT_mS1_
+.L2469:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r14
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2411
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L2437
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L2413:
+	movq	%r14, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2411
+.L2437:
+	movl	$3, %eax
+	jmp	.L2413
+.L2420:
+	xorl	%eax, %eax
+	xorl	%ecx, %ecx
+	movq	%rbp, %rdx
+	testq	%rbx, %rbx
+	jne	.L2427
+	jmp	.L2402
+.L2442:
+	xorl	%esi, %esi
+	xorl	%eax, %eax
+	jmp	.L2431
+.L2435:
+	movl	$3, %eax
+	jmp	.L2406
+.L2441:
+	xorl	%eax, %eax
+	xorl	%ecx, %ecx
+	addq	%rbp, %rdx
+	jmp	.L2427
+.L2421:
+	pxor	%xmm0, %xmm0
+	psadbw	%xmm0, %xmm0
+	movhlps	%xmm0, %xmm3
+	movq	%xmm0, %rdi
+	movq	%xmm3, %rcx
+	addq	%rdi, %rcx
+	addq	%rcx, %rsi
+	cmpq	%r9, %rbx
+	jb	.L2439
+.L2426:
+	jmp	.L2426
+.L2439:
+	movq	%rax, %rbx
+	jmp	.L2425
+	.cfi_endproc
+.LFE7178:
+	.size	_ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE, .-_ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE
+	.section	.rodata.str1.1
+.LC86:
+	.string	"test_chunk_from.txt"
+.LC87:
+	.string	"test_chunk_to.txt"
+	.section	.rodata.str1.8
+	.align 8
+.LC88:
+	.string	"expected equal : expected value : it.next(), actual value : 'a'"
+	.align 8
+.LC89:
+	.string	"expected equal : expected value : c.len(), actual value : 3"
+	.align 8
+.LC90:
+	.string	"expected equal : expected value : c.data()[0], actual value : 'b'"
+	.align 8
+.LC91:
+	.string	"expected equal : expected value : back.len(), actual value : 9999"
+	.align 8
+.LC92:
+	.string	"expected true : n::equal(back.iter(), content.iter().subslice(1))"
+	.align 8
+.LC93:
+	.string	"expected equal : expected value : n::count(f.iter(), 'z'), actual value : 10000 / 26"
+	.section	.text.unlikely
+.LCOLDB94:
+	.text
+.LHOTB94:
+	.p2align 4
+	.globl	_Z22test_file_chunked_copyv
+	.type	_Z22test_file_chunked_copyv, @function
+_Z22test_file_chunked_copyv:
+.LFB6935:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6935
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$200, %rsp
+	.cfi_def_cfa_offset 256
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, 8(%rsp)
+	testq	%rax, %rax
+	je	.L3123
+.L2472:
+	xorl	%ebx, %ebx
+	xorl	%r14d, %r14d
+	xorl	%r15d, %r15d
+	jmp	.L2486
+	.p2align 4,,10
+	.p2align 3
+.L2476:
+	movb	%bpl, (%r15,%rbx)
+	addq	$1, %rbx
+	cmpq	$10000, %rbx
+	je	.L3124
+.L2486:
+	movl	%ebx, %eax
+	movl	%ebx, %ebp
+	imulq	$1321528399, %rax, %rax
+	shrq	$35, %rax
+	imull	$26, %eax, %eax
+	subl	%eax, %ebp
+	addl	$97, %ebp
+	cmpq	%rbx, %r14
+	jne	.L2476
+	movq	8(%rsp), %rdi
+	leaq	10(%r14,%r14), %r13
+	movl	$1, %edx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+.LEHB71:
+	call	*16(%rax)
+.LEHE71:
+	movb	%bpl, (%rax,%rbx)
+	movq	%rax, %r12
+	testq	%rbx, %rbx
+	jne	.L3125
+	testq	%r15, %r15
+	je	.L2820
+.L2481:
+	movq	8(%rsp), %rdi
+	movl	$1, %ecx
+	movq	%r14, %rdx
+	movq	%r15, %rsi
+	movq	(%rdi), %rax
+.LEHB72:
+	call	*24(%rax)
+.LEHE72:
+	addq	$1, %rbx
+	movq	%r13, %r14
+	movq	%r12, %r15
+	cmpq	$10000, %rbx
+	jne	.L2486
+.L3124:
+	movl	$438, %edx
+	movl	$524865, %esi
+	leaq	.LC86(%rip), %rdi
+	xorl	%eax, %eax
+.LEHB73:
+	call	open@PLT
+	movzwl	.LC64(%rip), %ecx
+	movdqa	.LC46(%rip), %xmm1
+	movl	%eax, 128(%rsp)
+	movb	$0, 134(%rsp)
+	movw	%cx, 132(%rsp)
+	movq	$0, 136(%rsp)
+	movq	$0, 144(%rsp)
+	movq	$0, 168(%rsp)
+	movq	$0, 176(%rsp)
+	movups	%xmm1, 152(%rsp)
+	testl	%eax, %eax
+	jns	.L3126
+.L2487:
+	movl	$438, %edx
+	movl	$524288, %esi
+	leaq	.LC86(%rip), %rdi
+	xorl	%eax, %eax
+	call	open@PLT
+.LEHE73:
+	movl	%eax, 64(%rsp)
+	movl	%eax, %ebx
+	movl	$438, %edx
+	movl	$524865, %esi
+	movzwl	.LC64(%rip), %eax
+	movdqa	.LC46(%rip), %xmm2
+	movb	$0, 70(%rsp)
+	leaq	.LC87(%rip), %rdi
+	movq	$0, 72(%rsp)
+	movw	%ax, 68(%rsp)
+	xorl	%eax, %eax
+	movq	$0, 80(%rsp)
+	movq	$0, 104(%rsp)
+	movq	$0, 112(%rsp)
+	movups	%xmm2, 88(%rsp)
+.LEHB74:
+	call	open@PLT
+.LEHE74:
+	movl	%eax, 128(%rsp)
+	movdqa	.LC46(%rip), %xmm3
+	movzwl	.LC64(%rip), %eax
+	movb	$0, 134(%rsp)
+	movq	$0, 136(%rsp)
+	movw	%ax, 132(%rsp)
+	movq	$0, 144(%rsp)
+	movq	$0, 168(%rsp)
+	movq	$0, 176(%rsp)
+	movups	%xmm3, 152(%rsp)
+	testl	%ebx, %ebx
+	js	.L2529
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3127
+.L2525:
+	movq	88(%rsp), %r12
+	leaq	64(%rsp), %rsi
+	movl	$64, %edx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%rsi, 16(%rsp)
+	movq	(%rdi), %rax
+	movq	%r12, %rsi
+.LEHB75:
+	call	*16(%rax)
+	movq	%rax, 80(%rsp)
+	movq	%rax, %rbp
+	testq	%rax, %rax
+	je	.L2529
+	cmpl	$2, 72(%rsp)
+	movq	104(%rsp), %r13
+	je	.L3128
+.L2530:
+	movq	96(%rsp), %rcx
+	movl	$1, 72(%rsp)
+	cmpq	%r13, %rcx
+	jne	.L2537
+	cmpb	$0, 69(%rsp)
+	jne	.L2529
+	movzbl	70(%rsp), %eax
+	movb	%al, 24(%rsp)
+	testb	%al, %al
+	jne	.L2529
+	testq	%r13, %r13
+	jne	.L3129
+.L2538:
+	testq	%r12, %r12
+	je	.L3130
+	movl	64(%rsp), %ebx
+	leaq	64(%rsp), %r13
+	jmp	.L2541
+	.p2align 4,,10
+	.p2align 3
+.L3132:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L3131
+.L2541:
+	movq	%r12, %rdx
+	movq	%rbp, %rsi
+	movl	%ebx, %edi
+	movq	%r13, 16(%rsp)
+	call	read@PLT
+.LEHE75:
+	testq	%rax, %rax
+	js	.L3132
+	je	.L3133
+	movq	%rax, 104(%rsp)
+	movq	%rax, %r13
+	movq	%rbp, %rsi
+	xorl	%ecx, %ecx
+	jmp	.L2813
+	.p2align 4,,10
+	.p2align 3
+.L3125:
+	movq	%rbx, %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L2481
+	.p2align 4,,10
+	.p2align 3
+.L2820:
+	movq	%rax, %r15
+	movq	%r13, %r14
+	movl	$1, %ebx
+	jmp	.L2486
+.L3126:
+	movl	$2, 136(%rsp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3134
+.L2489:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	152(%rsp), %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%rsi, 16(%rsp)
+.LEHB76:
+	call	*16(%rax)
+.LEHE76:
+	movq	%rax, 144(%rsp)
+	movl	128(%rsp), %ebp
+	movq	%rax, %r12
+	testq	%rax, %rax
+	je	.L2822
+	movq	168(%rsp), %r13
+	movq	16(%rsp), %rax
+	subq	%r13, %rax
+	cmpq	$9999, %rax
+	jbe	.L2492
+.L2852:
+	leaq	(%r12,%r13), %rdi
+	leaq	10000(%r13), %rbx
+.L2493:
+	movl	$10000, %edx
+	movq	%r15, %rsi
+	call	memcpy@PLT
+	movq	%rbx, 168(%rsp)
+.L2498:
+	movl	140(%rsp), %eax
+	cmpl	$2, %eax
+	je	.L2501
+	cmpl	$1, %eax
+	je	.L3135
+.L2502:
+	testl	%ebp, %ebp
+	js	.L2504
+	cmpl	$2, 136(%rsp)
+	movzbl	132(%rsp), %edx
+	je	.L3136
+.L2509:
+	testb	%dl, %dl
+	je	.L2514
+	movl	%ebp, %edi
+	call	close@PLT
+.L2514:
+	movl	$-1, 128(%rsp)
+	movl	$-1, %ebp
+.L2504:
+	testq	%r12, %r12
+	je	.L3112
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3137
+.L2518:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	152(%rsp), %rdx
+	movl	$64, %ecx
+	movq	144(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movl	128(%rsp), %ebp
+	movq	$0, 144(%rsp)
+.L3112:
+	movq	176(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 136(%rsp)
+	movaps	%xmm0, 160(%rsp)
+	testq	%rdi, %rdi
+	je	.L2520
+	call	fclose@PLT
+	movq	$0, 176(%rsp)
+.L2520:
+	testl	%ebp, %ebp
+	js	.L2487
+	cmpb	$0, 132(%rsp)
+	je	.L2487
+	movl	%ebp, %edi
+	call	close@PLT
+	jmp	.L2487
+.L3136:
+	movq	168(%rsp), %r13
+	testq	%r13, %r13
+	je	.L2509
+	movb	%dl, 16(%rsp)
+	movq	%r12, %rbx
+.L2513:
+	movq	%r13, %rdx
+	movq	%rbx, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L3138
+	addq	%rax, %rbx
+	subq	%rax, %r13
+	jne	.L2513
+.L2512:
+	movq	$0, 168(%rsp)
+	movzbl	16(%rsp), %edx
+	jmp	.L2509
+.L3137:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2518
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2518
+.L3123:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3139
+.L2474:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L2472
+.L3135:
+	movl	$10000, %edx
+	movl	$10, %esi
+	movq	%r15, %rdi
+	call	memchr@PLT
+	testq	%rax, %rax
+	je	.L2502
+.L2501:
+	cmpl	$2, 136(%rsp)
+	jne	.L2502
+	movq	168(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L2502
+	movq	%r12, %r13
+.L2508:
+	movq	%rbx, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+.LEHB77:
+	call	write@PLT
+.LEHE77:
+	testq	%rax, %rax
+	js	.L3140
+	addq	%rax, %r13
+	subq	%rax, %rbx
+	jne	.L2508
+.L2507:
+	movq	$0, 168(%rsp)
+	jmp	.L2502
+.L2537:
+	movq	%r13, %rax
+	movl	64(%rsp), %ebx
+	leaq	0(%rbp,%rcx), %rsi
+	subq	%rcx, %rax
+.L2813:
+	testl	%ebx, %ebx
+	js	.L2543
+	cmpq	$0, %rax
+	movl	$1, %edx
+	cmova	%rdx, %rax
+	addq	%rcx, %rax
+	cmpb	$97, (%rsi)
+	movq	%rax, 96(%rsp)
+	jne	.L3141
+	cmpq	%r13, %rax
+	jne	.L2546
+	cmpb	$0, 69(%rsp)
+	je	.L3142
+.L2553:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC52(%rip), %rax
+	movq	%rax, (%rdi)
+	leaq	64(%rsp), %rax
+	movq	%rax, 16(%rsp)
+.LEHB78:
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L3142:
+	movzbl	70(%rsp), %eax
+	movb	%al, 24(%rsp)
+	testb	%al, %al
+	jne	.L2553
+	testq	%r13, %r13
+	jne	.L3143
+.L2548:
+	testq	%r12, %r12
+	je	.L2553
+	leaq	64(%rsp), %r13
+	jmp	.L2551
+	.p2align 4,,10
+	.p2align 3
+.L3145:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L3144
+.L2551:
+	movq	%r12, %rdx
+	movq	%rbp, %rsi
+	movl	%ebx, %edi
+	movq	%r13, 16(%rsp)
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L3145
+	je	.L3146
+	movq	%rax, 104(%rsp)
+.L2546:
+	leaq	64(%rsp), %rdi
+	movl	$1, %esi
+	movq	%rdi, 16(%rsp)
+	call	_ZN1n7fd_file4peekEm
+	cmpl	$1, 72(%rsp)
+	movq	%rax, %r12
+	movq	%rax, %rbx
+	jne	.L2554
+	movq	96(%rsp), %rsi
+	movq	104(%rsp), %rax
+	movl	$3, %ecx
+	subq	%rsi, %rax
+	cmpq	%rcx, %rdx
+	cmovbe	%rdx, %rcx
+	cmpq	%rcx, %rax
+	cmova	%rcx, %rax
+	addq	%rsi, %rax
+	movq	%rax, 96(%rsp)
+.L2554:
+	cmpq	$2, %rdx
+	jbe	.L3096
+	cmpb	$98, (%r12)
+	jne	.L3097
+	movl	128(%rsp), %ebp
+	testl	%ebp, %ebp
+	js	.L2557
+	cmpl	$1, 136(%rsp)
+	je	.L3147
+.L2558:
+	movq	152(%rsp), %r13
+	movl	$2, 136(%rsp)
+	cmpq	$3, %r13
+	ja	.L2560
+	movq	168(%rsp), %r12
+	testq	%r12, %r12
+	jne	.L3148
+.L2561:
+	movl	$3, %r12d
+	.p2align 4,,10
+	.p2align 3
+.L2570:
+	movq	%r12, %rdx
+	movq	%rbx, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L3149
+	addq	%rax, %rbx
+	subq	%rax, %r12
+	jne	.L2570
+	.p2align 4,,10
+	.p2align 3
+.L2557:
+	movq	16(%rsp), %rdi
+	movl	$1, %esi
+	call	_ZN1n7fd_file4peekEm
+	movl	$4096, %r12d
+	movq	%rax, %rbx
+	cmpq	%r12, %rdx
+	cmovbe	%rdx, %r12
+	cmpl	$1, 72(%rsp)
+	movq	%r12, 24(%rsp)
+	je	.L3150
+.L2593:
+	testq	%rdx, %rdx
+	je	.L2642
+.L2594:
+	movl	128(%rsp), %ebp
+	testl	%ebp, %ebp
+	js	.L2597
+	cmpl	$1, 136(%rsp)
+	je	.L3151
+.L2598:
+	movl	$2, 136(%rsp)
+	movq	152(%rsp), %r13
+	cmpq	%r13, 24(%rsp)
+	jb	.L2600
+	movq	168(%rsp), %r13
+	testq	%r13, %r13
+	jne	.L3152
+.L2601:
+	movq	24(%rsp), %r13
+	movq	%rbx, %r12
+	.p2align 4,,10
+	.p2align 3
+.L2612:
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+.LEHE78:
+	testq	%rax, %rax
+	js	.L3153
+	addq	%rax, %r12
+	subq	%rax, %r13
+	jne	.L2612
+.L3121:
+	movl	140(%rsp), %eax
+	cmpl	$2, %eax
+	je	.L2597
+.L3107:
+	cmpl	$1, %eax
+	je	.L3154
+	.p2align 4,,10
+	.p2align 3
+.L2597:
+	movl	64(%rsp), %ecx
+	testl	%ecx, %ecx
+	jns	.L3155
+.L2642:
+	movl	128(%rsp), %ebp
+	movq	144(%rsp), %r12
+	testl	%ebp, %ebp
+	js	.L2596
+	cmpl	$2, 136(%rsp)
+	je	.L3156
+.L2663:
+	cmpb	$0, 132(%rsp)
+	jne	.L3157
+.L2668:
+	movl	$-1, 128(%rsp)
+	movl	$-1, %ebp
+.L2596:
+	testq	%r12, %r12
+	je	.L3158
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3159
+.L2673:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	152(%rsp), %rdx
+	movl	$64, %ecx
+	movq	144(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	176(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movq	$0, 144(%rsp)
+	movl	128(%rsp), %ebp
+	movaps	%xmm0, 160(%rsp)
+	movl	$0, 136(%rsp)
+	testq	%rdi, %rdi
+	je	.L2675
+.L2670:
+	call	fclose@PLT
+.L2675:
+	testl	%ebp, %ebp
+	js	.L2671
+	cmpb	$0, 132(%rsp)
+	jne	.L3160
+.L2671:
+	movl	64(%rsp), %ebp
+	movq	80(%rsp), %r12
+	testl	%ebp, %ebp
+	js	.L2677
+	cmpl	$2, 72(%rsp)
+	je	.L3161
+.L2678:
+	cmpb	$0, 68(%rsp)
+	jne	.L3162
+.L2683:
+	movl	$-1, 64(%rsp)
+	movl	$-1, %ebp
+.L2677:
+	testq	%r12, %r12
+	je	.L3163
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3164
+.L2688:
+	movq	88(%rsp), %rdx
+	movq	80(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	112(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movl	64(%rsp), %ebp
+	movq	$0, 80(%rsp)
+	movl	$0, 72(%rsp)
+	movaps	%xmm0, 96(%rsp)
+	testq	%rdi, %rdi
+	je	.L2690
+.L2685:
+	call	fclose@PLT
+.L2690:
+	testl	%ebp, %ebp
+	js	.L2686
+	cmpb	$0, 68(%rsp)
+	jne	.L3165
+.L2686:
+	movl	$438, %edx
+	movl	$524288, %esi
+	leaq	.LC87(%rip), %rdi
+	xorl	%eax, %eax
+.LEHB79:
+	call	open@PLT
+.LEHE79:
+	movl	%eax, 128(%rsp)
+	movdqa	.LC46(%rip), %xmm4
+	movzwl	.LC64(%rip), %eax
+	movb	$0, 134(%rsp)
+	movq	$0, 136(%rsp)
+	movw	%ax, 132(%rsp)
+	movq	$0, 144(%rsp)
+	movq	$0, 168(%rsp)
+	movq	$0, 176(%rsp)
+	movups	%xmm4, 152(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, 40(%rsp)
+	testq	%rax, %rax
+	je	.L2692
+.L3117:
+	leaq	128(%rsp), %rax
+	movl	$1, %esi
+	movq	%rax, %rdi
+	movq	%rax, 56(%rsp)
+.LEHB80:
+	call	_ZN1n7fd_file4peekEm
+.LEHE80:
+	movl	$4096, %ebp
+	movq	%rdx, 32(%rsp)
+	movq	%rax, %rbx
+	cmpq	%rbp, %rdx
+	cmovbe	%rdx, %rbp
+	cmpl	$1, 136(%rsp)
+	jne	.L2697
+	movq	160(%rsp), %rcx
+	movq	168(%rsp), %rax
+	subq	%rcx, %rax
+	cmpq	%rbp, %rax
+	cmova	%rbp, %rax
+	addq	%rcx, %rax
+	movq	%rax, 160(%rsp)
+.L2697:
+	testq	%rdx, %rdx
+	je	.L2830
+	movq	$0, 32(%rsp)
+	xorl	%r13d, %r13d
+	movq	$0, 16(%rsp)
+	movq	16(%rsp), %rax
+.L2736:
+	leaq	0(%rbp,%rax), %rcx
+	movq	%rcx, 24(%rsp)
+	cmpq	%r13, %rbx
+	jb	.L2699
+	leaq	0(%r13,%rax), %r12
+	cmpq	%r12, %rbx
+	jnb	.L2699
+	cmpq	%rcx, 32(%rsp)
+	jb	.L3166
+.L2706:
+	movl	%ebp, %ecx
+	cmpl	$8, %ebp
+	jnb	.L2710
+.L3183:
+	andl	$4, %ebp
+	jne	.L3167
+	testl	%ecx, %ecx
+	je	.L2711
+	movzbl	(%rbx), %eax
+	movb	%al, (%r12)
+	testb	$2, %cl
+	jne	.L3168
+.L2711:
+	movl	128(%rsp), %edx
+	testl	%edx, %edx
+	jns	.L3169
+.L2715:
+	cmpq	$9999, 24(%rsp)
+	jne	.L2698
+	leaq	1(%r15), %rsi
+	movl	$9999, %edx
+	movq	%r13, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L2738
+	movq	40(%rsp), %rdi
+	movq	32(%rsp), %rdx
+	movl	$1, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movl	128(%rsp), %ebp
+	movq	144(%rsp), %r12
+	testl	%ebp, %ebp
+	js	.L2740
+	cmpl	$2, 136(%rsp)
+	je	.L3170
+.L2741:
+	cmpb	$0, 132(%rsp)
+	jne	.L3171
+.L2746:
+	movl	$-1, 128(%rsp)
+	movl	$-1, %ebp
+.L2740:
+	testq	%r12, %r12
+	je	.L3172
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3173
+.L2751:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	152(%rsp), %rdx
+	movl	$64, %ecx
+	movq	144(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	176(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movq	$0, 144(%rsp)
+	movl	128(%rsp), %ebp
+	movaps	%xmm0, 160(%rsp)
+	movl	$0, 136(%rsp)
+	testq	%rdi, %rdi
+	je	.L2753
+.L2748:
+	call	fclose@PLT
+.L2753:
+	testl	%ebp, %ebp
+	js	.L2749
+	cmpb	$0, 132(%rsp)
+	jne	.L3174
+.L2749:
+	movl	$438, %edx
+	movl	$524288, %esi
+	leaq	.LC86(%rip), %rdi
+	xorl	%eax, %eax
+.LEHB81:
+	call	open@PLT
+.LEHE81:
+	movl	%eax, 128(%rsp)
+	movq	56(%rsp), %rdi
+	movl	$1, %esi
+	movzwl	.LC64(%rip), %eax
+	movdqa	.LC46(%rip), %xmm5
+	movb	$0, 134(%rsp)
+	movq	$0, 136(%rsp)
+	movw	%ax, 132(%rsp)
+	movq	$0, 144(%rsp)
+	movq	$0, 168(%rsp)
+	movq	$0, 176(%rsp)
+	movups	%xmm5, 152(%rsp)
+.LEHB82:
+	call	_ZN1n7fd_file4peekEm
+.LEHE82:
+	movl	$4096, %r13d
+	movq	%rax, %rbx
+	cmpq	%r13, %rdx
+	cmovbe	%rdx, %r13
+	cmpl	$1, 136(%rsp)
+	je	.L3175
+.L2755:
+	xorl	%ebp, %ebp
+	testq	%rdx, %rdx
+	je	.L2771
+.L2756:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L3176
+.L2758:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %ecx
+	movl	$122, %edx
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	call	_ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE
+	addq	%rax, %rbp
+	movl	128(%rsp), %eax
+	testl	%eax, %eax
+	jns	.L2761
+.L2770:
+	movl	136(%rsp), %eax
+	cmpl	$1, %eax
+	je	.L3177
+.L2763:
+	cmpq	$384, %rbp
+	jne	.L2771
+	movl	128(%rsp), %ebp
+	movq	144(%rsp), %r12
+	testl	%ebp, %ebp
+	js	.L2789
+	cmpl	$2, %eax
+	jne	.L2788
+	movq	168(%rsp), %r13
+	testq	%r13, %r13
+	jne	.L3178
+.L2788:
+	cmpb	$0, 132(%rsp)
+	jne	.L3179
+.L2795:
+	movl	$-1, 128(%rsp)
+	movl	$-1, %ebp
+.L2789:
+	testq	%r12, %r12
+	je	.L3180
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3181
+.L2800:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	152(%rsp), %rdx
+	movl	$64, %ecx
+	movq	144(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	176(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movq	$0, 144(%rsp)
+	movl	128(%rsp), %ebp
+	movaps	%xmm0, 160(%rsp)
+	movl	$0, 136(%rsp)
+	testq	%rdi, %rdi
+	je	.L2802
+.L2797:
+	call	fclose@PLT
+.L2802:
+	testl	%ebp, %ebp
+	js	.L2798
+	cmpb	$0, 132(%rsp)
+	jne	.L3182
+.L2798:
+	leaq	.LC86(%rip), %rdi
+	call	remove@PLT
+	leaq	.LC87(%rip), %rdi
+	call	remove@PLT
+	testq	%r15, %r15
+	je	.L2471
+	movq	8(%rsp), %rdi
+	movl	$1, %ecx
+	movq	%r14, %rdx
+	movq	%r15, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2471:
+	addq	$200, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2699:
+	.cfi_restore_state
+	movq	24(%rsp), %rsi
+	cmpq	%rsi, 32(%rsp)
+	jb	.L2707
+	movq	16(%rsp), %r12
+	movl	%ebp, %ecx
+	addq	%r13, %r12
+	cmpl	$8, %ebp
+	jb	.L3183
+.L2710:
+	movq	(%rbx), %rax
+	leaq	8(%r12), %rdi
+	movq	%r12, %rcx
+	movq	%rbx, %rsi
+	andq	$-8, %rdi
+	movq	%rax, (%r12)
+	movl	%ebp, %eax
+	subq	%rdi, %rcx
+	movq	-8(%rbx,%rax), %rdx
+	subq	%rcx, %rsi
+	addl	%ebp, %ecx
+	shrl	$3, %ecx
+	movq	%rdx, -8(%r12,%rax)
+	rep movsq
+	movl	128(%rsp), %edx
+	testl	%edx, %edx
+	js	.L2715
+.L3169:
+	movq	144(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L3184
+.L2716:
+	cmpl	$2, 136(%rsp)
+	movq	168(%rsp), %rbp
+	je	.L3185
+.L2721:
+	movq	160(%rsp), %rcx
+	movq	%rbp, %rdx
+	movl	$1, 136(%rsp)
+	subq	%rcx, %rdx
+	cmpq	%rbp, %rcx
+	jne	.L2728
+	cmpb	$0, 133(%rsp)
+	je	.L3186
+.L2729:
+	movq	%rbp, 160(%rsp)
+	jmp	.L2715
+	.p2align 4,,10
+	.p2align 3
+.L3155:
+	movq	80(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L3187
+.L2643:
+	cmpl	$2, 72(%rsp)
+	movq	104(%rsp), %rbp
+	je	.L3188
+.L2647:
+	movq	96(%rsp), %rax
+	movl	$1, 72(%rsp)
+	cmpq	%rax, %rbp
+	je	.L3189
+	subq	%rax, %rbp
+	movl	$4096, %r12d
+	addq	%rax, %rbx
+	cmpq	%r12, %rbp
+	cmovbe	%rbp, %r12
+	addq	%r12, %rax
+	movq	%r12, 24(%rsp)
+	movq	%rax, 96(%rsp)
+	testq	%rbp, %rbp
+	jne	.L2594
+	jmp	.L2642
+	.p2align 4,,10
+	.p2align 3
+.L3176:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2758
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L2834
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L2760:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2758
+	.p2align 4,,10
+	.p2align 3
+.L2707:
+	movq	32(%rsp), %rax
+	movq	40(%rsp), %rdi
+	movl	$1, %edx
+	leaq	10(%rax,%rax), %rax
+	cmpq	%rsi, %rax
+	cmovb	%rsi, %rax
+	movq	%rax, 48(%rsp)
+	movq	%rax, %rsi
+	movq	(%rdi), %rax
+.LEHB83:
+	call	*16(%rax)
+.LEHE83:
+	cmpq	$0, 16(%rsp)
+	movq	%rax, %r12
+	jne	.L3190
+	testq	%r13, %r13
+	jne	.L2709
+	movq	48(%rsp), %rax
+	movq	%r12, %r13
+	movq	%rax, 32(%rsp)
+	jmp	.L2706
+.L2844:
+	.p2align 4,,10
+	.p2align 3
+.L2761:
+	movq	144(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L3191
+.L2766:
+	cmpl	$2, 136(%rsp)
+	movq	168(%rsp), %r13
+	je	.L3192
+.L2773:
+	movq	160(%rsp), %r12
+	movq	%r13, %rdx
+	movl	$1, 136(%rsp)
+	subq	%r12, %rdx
+	cmpq	%r12, %r13
+	jne	.L2780
+	cmpb	$0, 133(%rsp)
+	je	.L3193
+.L2781:
+	movq	%r12, 160(%rsp)
+	cmpq	$384, %rbp
+	jne	.L3194
+.L3105:
+	movl	128(%rsp), %ebp
+	movq	144(%rsp), %r12
+	testl	%ebp, %ebp
+	js	.L2789
+	cmpb	$0, 132(%rsp)
+	je	.L2795
+.L3179:
+	movl	%ebp, %edi
+	call	close@PLT
+	jmp	.L2795
+.L2780:
+	movl	$4096, %r13d
+	addq	%r12, %rbx
+	cmpq	%r13, %rdx
+	cmovbe	%rdx, %r13
+	movq	%r13, %rax
+	addq	%r12, %rax
+	movq	%rax, 160(%rsp)
+	testq	%rdx, %rdx
+	jne	.L2756
+	movl	$1, %eax
+	jmp	.L2763
+	.p2align 4,,10
+	.p2align 3
+.L2728:
+	movl	$4096, %ebp
+	addq	%rcx, %rbx
+	cmpq	%rbp, %rdx
+	cmovbe	%rdx, %rbp
+	movq	%rbp, %rax
+	addq	%rcx, %rax
+	movq	%rax, 160(%rsp)
+	testq	%rdx, %rdx
+	je	.L2715
+.L2735:
+	movq	24(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	jmp	.L2736
+.L3190:
+	movq	16(%rsp), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+.L2709:
+	movq	40(%rsp), %rdi
+	movq	32(%rsp), %rdx
+	movl	$1, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+.LEHB84:
+	call	*24(%rax)
+.LEHE84:
+	movq	48(%rsp), %rax
+	movq	%r12, %r13
+	movq	%rax, 32(%rsp)
+	movq	16(%rsp), %rax
+	addq	%rax, %r12
+	jmp	.L2706
+	.p2align 4,,10
+	.p2align 3
+.L3153:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L2612
+	movl	140(%rsp), %eax
+	cmpl	$2, %eax
+	jne	.L3107
+.L3115:
+	movq	168(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L2597
+	movq	144(%rsp), %rbp
+	movl	128(%rsp), %r12d
+.L2639:
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movl	%r12d, %edi
+.LEHB85:
+	call	write@PLT
+.LEHE85:
+	testq	%rax, %rax
+	js	.L3195
+	addq	%rax, %rbp
+	subq	%rax, %rbx
+	jne	.L2639
+.L2638:
+	movq	$0, 168(%rsp)
+	jmp	.L2597
+.L3166:
+	movq	32(%rsp), %rax
+	movq	40(%rsp), %rdi
+	movl	$1, %edx
+	leaq	10(%rax,%rax), %rax
+	cmpq	%rcx, %rax
+	cmovb	%rcx, %rax
+	movq	%rax, 48(%rsp)
+	movq	%rax, %rsi
+	movq	(%rdi), %rax
+.LEHB86:
+	call	*16(%rax)
+.LEHE86:
+	subq	%r13, %rbx
+	cmpq	$0, 16(%rsp)
+	movq	%rax, %r12
+	jne	.L3196
+	testq	%r13, %r13
+	jne	.L2702
+	addq	%rax, %rbx
+	movq	48(%rsp), %rax
+	movq	%r12, %r13
+	movq	%rax, 32(%rsp)
+	jmp	.L2706
+.L3177:
+	cmpq	$384, %rbp
+	je	.L3105
+	jmp	.L2771
+	.p2align 4,,10
+	.p2align 3
+.L3151:
+	movq	168(%rsp), %rax
+	movq	160(%rsp), %rsi
+	cmpq	%rsi, %rax
+	je	.L2599
+	subq	%rax, %rsi
+	movl	$1, %edx
+	movl	%ebp, %edi
+	call	lseek@PLT
+.L2599:
+	pxor	%xmm6, %xmm6
+	movaps	%xmm6, 160(%rsp)
+	jmp	.L2598
+.L2600:
+	movq	144(%rsp), %rbp
+	testq	%rbp, %rbp
+	je	.L3197
+.L2614:
+	movq	168(%rsp), %r12
+	movq	24(%rsp), %rax
+	subq	%r12, %r13
+	cmpq	%rax, %r13
+	jb	.L2619
+	addq	%r12, %rbp
+	leaq	(%rax,%r12), %rdx
+	movq	%rax, %rsi
+.L2620:
+	movl	%esi, %eax
+	cmpl	$8, %esi
+	jnb	.L2626
+	andl	$4, %esi
+	jne	.L3198
+	testl	%eax, %eax
+	je	.L2627
+	movzbl	(%rbx), %ecx
+	movb	%cl, 0(%rbp)
+	testb	$2, %al
+	jne	.L3199
+.L2627:
+	movq	%rdx, 168(%rsp)
+.L2630:
+	movl	140(%rsp), %eax
+	cmpl	$2, %eax
+	je	.L2634
+	cmpl	$1, %eax
+	jne	.L2597
+	movq	24(%rsp), %rdx
+	movl	$10, %esi
+	movq	%rbx, %rdi
+	call	memchr@PLT
+	testq	%rax, %rax
+	je	.L2597
+.L2634:
+	cmpl	$2, 136(%rsp)
+	jne	.L2597
+	jmp	.L3115
+	.p2align 4,,10
+	.p2align 3
+.L3149:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2557
+	jmp	.L2570
+.L3196:
+	movq	16(%rsp), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+.L2702:
+	movq	40(%rsp), %rdi
+	movq	32(%rsp), %rdx
+	movl	$1, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+.LEHB87:
+	call	*24(%rax)
+.LEHE87:
+	movq	%r12, %r13
+	movq	48(%rsp), %rax
+	addq	%r12, %rbx
+	movq	16(%rsp), %r12
+	movq	%rax, 32(%rsp)
+	addq	%r13, %r12
+	jmp	.L2706
+.L3172:
+	movq	176(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 136(%rsp)
+	movaps	%xmm0, 160(%rsp)
+	testq	%rdi, %rdi
+	jne	.L2748
+	jmp	.L2749
+.L3180:
+	movq	176(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 136(%rsp)
+	movaps	%xmm0, 160(%rsp)
+	testq	%rdi, %rdi
+	jne	.L2797
+	jmp	.L2798
+.L3158:
+	movq	176(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 136(%rsp)
+	movaps	%xmm0, 160(%rsp)
+	testq	%rdi, %rdi
+	jne	.L2670
+	jmp	.L2671
+.L3163:
+	movq	112(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 72(%rsp)
+	movaps	%xmm0, 96(%rsp)
+	testq	%rdi, %rdi
+	jne	.L2685
+	jmp	.L2686
+.L3189:
+	cmpb	$0, 69(%rsp)
+	je	.L3200
+.L2655:
+	movq	%rax, 96(%rsp)
+	jmp	.L2642
+	.p2align 4,,10
+	.p2align 3
+.L3167:
+	movl	(%rbx), %eax
+	movl	%eax, (%r12)
+	movl	-4(%rbx,%rcx), %eax
+	movl	%eax, -4(%r12,%rcx)
+	jmp	.L2711
+.L3184:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3201
+.L2718:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	152(%rsp), %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+.LEHB88:
+	call	*16(%rax)
+.LEHE88:
+	movq	%rax, 144(%rsp)
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L2715
+	jmp	.L2716
+	.p2align 4,,10
+	.p2align 3
+.L3191:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3202
+.L2768:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	152(%rsp), %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+.LEHB89:
+	call	*16(%rax)
+.LEHE89:
+	movq	%rax, 144(%rsp)
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L2770
+	jmp	.L2766
+	.p2align 4,,10
+	.p2align 3
+.L3187:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3203
+.L2645:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	88(%rsp), %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+.LEHB90:
+	call	*16(%rax)
+	movq	%rax, 80(%rsp)
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L2642
+	jmp	.L2643
+	.p2align 4,,10
+	.p2align 3
+.L3147:
+	movq	168(%rsp), %rdx
+	movq	160(%rsp), %rax
+	cmpq	%rax, %rdx
+	je	.L2559
+	subq	%rdx, %rax
+	movl	%ebp, %edi
+	movl	$1, %edx
+	movq	%rax, %rsi
+	call	lseek@PLT
+.L2559:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 160(%rsp)
+	jmp	.L2558
+.L2560:
+	movq	144(%rsp), %rbp
+	testq	%rbp, %rbp
+	je	.L3204
+.L2571:
+	movq	168(%rsp), %rbx
+	subq	%rbx, %r13
+	cmpq	$2, %r13
+	ja	.L2853
+	cmpl	$2, 136(%rsp)
+	jne	.L2853
+	testq	%rbx, %rbx
+	je	.L2853
+	movl	128(%rsp), %eax
+	movq	%rbp, %r13
+	movl	%eax, 24(%rsp)
+.L2582:
+	movl	24(%rsp), %edi
+	movq	%rbx, %rdx
+	movq	%r13, %rsi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L3205
+	addq	%rax, %r13
+	subq	%rax, %rbx
+	jne	.L2582
+.L3113:
+	movl	$3, %ebx
+	jmp	.L2577
+	.p2align 4,,10
+	.p2align 3
+.L2853:
+	addq	%rbx, %rbp
+	addq	$3, %rbx
+.L2577:
+	movzwl	(%r12), %eax
+	movq	%rbx, 168(%rsp)
+	movw	%ax, 0(%rbp)
+	movzbl	2(%r12), %eax
+	movb	%al, 2(%rbp)
+.L2583:
+	movl	140(%rsp), %eax
+	cmpl	$2, %eax
+	je	.L2587
+	cmpl	$1, %eax
+	jne	.L2557
+	movl	$3, %edx
+	movl	$10, %esi
+	movq	%r12, %rdi
+	call	memchr@PLT
+	testq	%rax, %rax
+	je	.L2557
+.L2587:
+	cmpl	$2, 136(%rsp)
+	jne	.L2557
+	movq	168(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L2557
+	movq	144(%rsp), %rbp
+	movl	128(%rsp), %r12d
+.L2591:
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movl	%r12d, %edi
+	call	write@PLT
+.LEHE90:
+	testq	%rax, %rax
+	js	.L3206
+	addq	%rax, %rbp
+	subq	%rax, %rbx
+	jne	.L2591
+.L2590:
+	movq	$0, 168(%rsp)
+	jmp	.L2557
+.L3154:
+	movq	24(%rsp), %rdx
+	movl	$10, %esi
+	movq	%rbx, %rdi
+	call	memchr@PLT
+	testq	%rax, %rax
+	jne	.L3115
+	jmp	.L2597
+.L3193:
+	movzbl	134(%rsp), %eax
+	movb	%al, 16(%rsp)
+	testb	%al, %al
+	jne	.L2781
+	testq	%r13, %r13
+	jne	.L3207
+.L2782:
+	movq	152(%rsp), %r12
+	testq	%r12, %r12
+	je	.L2781
+	movl	128(%rsp), %r13d
+	jmp	.L2785
+	.p2align 4,,10
+	.p2align 3
+.L3209:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L3208
+.L2785:
+	movq	%r12, %rdx
+	movq	%rbx, %rsi
+	movl	%r13d, %edi
+.LEHB91:
+	call	read@PLT
+.LEHE91:
+	testq	%rax, %rax
+	js	.L3209
+	je	.L3210
+	movl	$4096, %r13d
+	movq	%rax, 168(%rsp)
+	cmpq	%r13, %rax
+	cmovbe	%rax, %r13
+	movq	%r13, 160(%rsp)
+	jmp	.L2756
+.L3208:
+	movl	$1, %eax
+.L2784:
+	movzbl	16(%rsp), %esi
+	movb	%al, 134(%rsp)
+	xorl	%r12d, %r12d
+	movb	%sil, 133(%rsp)
+	jmp	.L2781
+.L3200:
+	movzbl	70(%rsp), %r13d
+	testb	%r13b, %r13b
+	jne	.L2655
+	testq	%rbp, %rbp
+	jne	.L3211
+.L2656:
+	movq	88(%rsp), %r12
+	testq	%r12, %r12
+	je	.L2657
+	movl	64(%rsp), %ebp
+	jmp	.L2660
+	.p2align 4,,10
+	.p2align 3
+.L3213:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L3212
+.L2660:
+	movq	%r12, %rdx
+	movq	%rbx, %rsi
+	movl	%ebp, %edi
+.LEHB92:
+	call	read@PLT
+.LEHE92:
+	testq	%rax, %rax
+	js	.L3213
+	je	.L3214
+	movl	$4096, %r12d
+	movq	%rax, 104(%rsp)
+	cmpq	%r12, %rax
+	cmovbe	%rax, %r12
+	movq	%r12, 24(%rsp)
+	movq	%r12, 96(%rsp)
+	jmp	.L2594
+.L3212:
+	movl	$1, %eax
+.L2659:
+	movb	%r13b, 69(%rsp)
+	movb	%al, 70(%rsp)
+.L2657:
+	xorl	%eax, %eax
+	jmp	.L2655
+.L3186:
+	movzbl	134(%rsp), %eax
+	movb	%al, 16(%rsp)
+	testb	%al, %al
+	jne	.L2729
+	testq	%rbp, %rbp
+	jne	.L3215
+.L2730:
+	movq	152(%rsp), %rbp
+	testq	%rbp, %rbp
+	je	.L2729
+	movl	128(%rsp), %r12d
+	jmp	.L2733
+	.p2align 4,,10
+	.p2align 3
+.L3217:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L3216
+.L2733:
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movl	%r12d, %edi
+.LEHB93:
+	call	read@PLT
+.LEHE93:
+	testq	%rax, %rax
+	js	.L3217
+	je	.L3218
+	movl	$4096, %ebp
+	movq	%rax, 168(%rsp)
+	cmpq	%rbp, %rax
+	cmovbe	%rax, %rbp
+	movq	%rbp, 160(%rsp)
+	jmp	.L2735
+.L3216:
+	movl	$1, %eax
+.L2732:
+	movzbl	16(%rsp), %esi
+	movb	%al, 134(%rsp)
+	xorl	%ebp, %ebp
+	movb	%sil, 133(%rsp)
+	jmp	.L2729
+.L3161:
+	movq	104(%rsp), %r13
+	testq	%r13, %r13
+	je	.L2678
+	movq	%r12, %rbx
+.L2682:
+	movq	%r13, %rdx
+	movq	%rbx, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L3219
+	addq	%rax, %rbx
+	subq	%rax, %r13
+	jne	.L2682
+.L2681:
+	movq	$0, 104(%rsp)
+	jmp	.L2678
+.L3170:
+	movq	168(%rsp), %r13
+	testq	%r13, %r13
+	je	.L2741
+	movq	%r12, %rbx
+.L2745:
+	movq	%r13, %rdx
+	movq	%rbx, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L3220
+	addq	%rax, %rbx
+	subq	%rax, %r13
+	jne	.L2745
+.L2744:
+	movq	$0, 168(%rsp)
+	jmp	.L2741
+.L3156:
+	movq	168(%rsp), %r13
+	testq	%r13, %r13
+	je	.L2663
+	movq	%r12, %rbx
+.L2667:
+	movq	%r13, %rdx
+	movq	%rbx, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L3221
+	addq	%rax, %rbx
+	subq	%rax, %r13
+	jne	.L2667
+.L2666:
+	movq	$0, 168(%rsp)
+	jmp	.L2663
+.L3157:
+	movl	%ebp, %edi
+	call	close@PLT
+	jmp	.L2668
+.L3162:
+	movl	%ebp, %edi
+	call	close@PLT
+	jmp	.L2683
+.L3171:
+	movl	%ebp, %edi
+	call	close@PLT
+	jmp	.L2746
+.L3182:
+	movl	%ebp, %edi
+	call	close@PLT
+	jmp	.L2798
+.L3160:
+	movl	%ebp, %edi
+	call	close@PLT
+	jmp	.L2671
+.L3165:
+	movl	%ebp, %edi
+	call	close@PLT
+	jmp	.L2686
+.L3174:
+	movl	%ebp, %edi
+	call	close@PLT
+	jmp	.L2749
+.L3175:
+	movq	160(%rsp), %rcx
+	movq	168(%rsp), %rax
+	subq	%rcx, %rax
+	cmpq	%r13, %rax
+	cmova	%r13, %rax
+	addq	%rcx, %rax
+	movq	%rax, 160(%rsp)
+	jmp	.L2755
+.L3159:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2673
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2673
+.L3164:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2688
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2688
+.L3150:
+	movq	96(%rsp), %rcx
+	movq	104(%rsp), %rax
+	subq	%rcx, %rax
+	cmpq	%r12, %rax
+	cmova	%r12, %rax
+	addq	%rcx, %rax
+	movq	%rax, 96(%rsp)
+	jmp	.L2593
+.L3185:
+	testq	%rbp, %rbp
+	jne	.L2722
+	xorl	%ebp, %ebp
+	jmp	.L2721
+.L2722:
+	movl	128(%rsp), %eax
+	movq	%rbx, %r12
+	movl	%eax, 16(%rsp)
+.L2726:
+	movl	16(%rsp), %edi
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+.LEHB94:
+	call	write@PLT
+.LEHE94:
+	testq	%rax, %rax
+	js	.L3222
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L2726
+.L2725:
+	movq	$0, 168(%rsp)
+	xorl	%ebp, %ebp
+	jmp	.L2721
+.L3188:
+	testq	%rbp, %rbp
+	jne	.L2648
+	xorl	%ebp, %ebp
+	jmp	.L2647
+.L2648:
+	movl	64(%rsp), %r13d
+	movq	%rbx, %r12
+.L2652:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%r13d, %edi
+.LEHB95:
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L3223
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L2652
+.L2651:
+	movq	$0, 104(%rsp)
+	xorl	%ebp, %ebp
+	jmp	.L2647
+.L3168:
+	movzwl	-2(%rbx,%rcx), %eax
+	movw	%ax, -2(%r12,%rcx)
+	jmp	.L2711
+.L3192:
+	testq	%r13, %r13
+	jne	.L2774
+.L2779:
+	xorl	%r13d, %r13d
+	jmp	.L2773
+.L3173:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2751
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2751
+.L3181:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2800
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2800
+.L2692:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3224
+.L2695:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	%rax, 40(%rsp)
+	jmp	.L3117
+.L2834:
+	movl	$3, %eax
+	jmp	.L2760
+.L2626:
+	movq	(%rbx), %rax
+	leaq	8(%rbp), %rdi
+	movq	%rbx, %rsi
+	andq	$-8, %rdi
+	movq	%rax, 0(%rbp)
+	movq	24(%rsp), %r8
+	movl	%r8d, %eax
+	movq	-8(%rbx,%rax), %rcx
+	movq	%rcx, -8(%rbp,%rax)
+	subq	%rdi, %rbp
+	movl	%r8d, %eax
+	addl	%ebp, %eax
+	subq	%rbp, %rsi
+	shrl	$3, %eax
+	movl	%eax, %ecx
+	rep movsq
+	jmp	.L2627
+.L2619:
+	cmpl	$2, 136(%rsp)
+	jne	.L2854
+	testq	%r12, %r12
+	jne	.L2621
+.L2854:
+	movq	24(%rsp), %rax
+	addq	%r12, %rbp
+	leaq	(%rax,%r12), %rdx
+	movq	%rax, %rsi
+	jmp	.L2620
+.L3152:
+	movq	144(%rsp), %r12
+.L2606:
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+.LEHE95:
+	testq	%rax, %rax
+	js	.L3225
+	addq	%rax, %r12
+	subq	%rax, %r13
+	jne	.L2606
+	movq	$0, 168(%rsp)
+	jmp	.L2601
+	.p2align 4,,10
+	.p2align 3
+.L3225:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L2606
+	movq	$0, 168(%rsp)
+	jmp	.L3121
+.L3195:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2638
+	jmp	.L2639
+.L2830:
+	xorl	%r13d, %r13d
+.L2698:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC91(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB96:
+	call	__cxa_throw@PLT
+.LEHE96:
+	.p2align 4,,10
+	.p2align 3
+.L3202:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2768
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2768
+.L3203:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2645
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2645
+.L3201:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2718
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2718
+.L3197:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3226
+.L2616:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	152(%rsp), %r13
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%r13, %rsi
+.LEHB97:
+	call	*16(%rax)
+	movq	%rax, 144(%rsp)
+	movq	%rax, %rbp
+	testq	%rax, %rax
+	jne	.L2614
+	movl	128(%rsp), %r12d
+	movq	24(%rsp), %rbp
+	movq	%rbx, %r13
+.L2633:
+	movq	%rbp, %rdx
+	movq	%r13, %rsi
+	movl	%r12d, %edi
+	call	write@PLT
+.LEHE97:
+	testq	%rax, %rax
+	js	.L3227
+	addq	%rax, %r13
+	subq	%rax, %rbp
+	jne	.L2633
+	jmp	.L2630
+.L3227:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2630
+	jmp	.L2633
+.L3220:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2744
+	jmp	.L2745
+.L3221:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2666
+	jmp	.L2667
+.L3219:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2681
+	jmp	.L2682
+.L3138:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2512
+	jmp	.L2513
+.L3178:
+	movq	%r12, %rbx
+.L2791:
+	movq	%r13, %rdx
+	movq	%rbx, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L3228
+	addq	%rax, %rbx
+	subq	%rax, %r13
+	jne	.L2791
+.L2794:
+	movq	$0, 168(%rsp)
+	jmp	.L2788
+.L3228:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2794
+	jmp	.L2791
+.L3223:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2651
+	jmp	.L2652
+.L3222:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2725
+	jmp	.L2726
+.L3224:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2695
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2695
+.L3139:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2474
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2474
+.L3148:
+	movq	144(%rsp), %r13
+.L2566:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+.LEHB98:
+	call	write@PLT
+.LEHE98:
+	testq	%rax, %rax
+	js	.L3229
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L2566
+	movq	$0, 168(%rsp)
+	jmp	.L2561
+	.p2align 4,,10
+	.p2align 3
+.L3229:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2590
+	jmp	.L2566
+.L2774:
+	movl	128(%rsp), %eax
+	movq	%rbx, %r12
+	movl	%eax, 16(%rsp)
+.L2778:
+	movl	16(%rsp), %edi
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+.LEHB99:
+	call	write@PLT
+.LEHE99:
+	testq	%rax, %rax
+	js	.L3230
+	addq	%rax, %r12
+	subq	%rax, %r13
+	jne	.L2778
+.L2777:
+	movq	$0, 168(%rsp)
+	jmp	.L2779
+.L3230:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2777
+	jmp	.L2778
+.L2492:
+	cmpl	$2, 136(%rsp)
+	jne	.L2852
+	testq	%r13, %r13
+	je	.L2852
+	movq	%r12, 16(%rsp)
+.L2494:
+	movq	16(%rsp), %rsi
+	movq	%r13, %rdx
+	movl	%ebp, %edi
+.LEHB100:
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L3231
+	addq	%rax, 16(%rsp)
+	subq	%rax, %r13
+	jne	.L2494
+	jmp	.L3111
+	.p2align 4,,10
+	.p2align 3
+.L3127:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2525
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2525
+.L2822:
+	movq	%r15, %r13
+.L2491:
+	movq	%rbx, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+.LEHE100:
+	testq	%rax, %rax
+	js	.L3232
+	addq	%rax, %r13
+	subq	%rax, %rbx
+	jne	.L2491
+	jmp	.L2498
+	.p2align 4,,10
+	.p2align 3
+.L3131:
+	movl	$1, %eax
+.L2540:
+	movzbl	24(%rsp), %esi
+	movb	%al, 70(%rsp)
+	movb	%sil, 69(%rsp)
+	jmp	.L2529
+	.p2align 4,,10
+	.p2align 3
+.L3144:
+	movl	$1, %eax
+.L2550:
+	movzbl	24(%rsp), %esi
+	movb	%al, 70(%rsp)
+	movb	%sil, 69(%rsp)
+	jmp	.L2553
+.L3232:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2498
+	jmp	.L2491
+.L3206:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2590
+	jmp	.L2591
+.L3128:
+	testq	%r13, %r13
+	jne	.L2531
+.L2536:
+	xorl	%r13d, %r13d
+	jmp	.L2530
+.L3215:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 160(%rsp)
+	jmp	.L2730
+.L3207:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 160(%rsp)
+	jmp	.L2782
+.L3211:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 96(%rsp)
+	jmp	.L2656
+.L3204:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3233
+.L2573:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	152(%rsp), %r13
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%r13, %rsi
+.LEHB101:
+	call	*16(%rax)
+	movq	%rax, 144(%rsp)
+	movq	%rax, %rbp
+	testq	%rax, %rax
+	jne	.L2571
+	movl	128(%rsp), %r13d
+	movq	%r12, %rbx
+	movl	$3, %ebp
+.L2586:
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movl	%r13d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L3234
+	addq	%rax, %rbx
+	subq	%rax, %rbp
+	jne	.L2586
+	jmp	.L2583
+.L3234:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2583
+	jmp	.L2586
+.L3226:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2616
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2616
+.L3140:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L2507
+	jmp	.L2508
+.L2621:
+	movl	128(%rsp), %eax
+	movq	%rbp, %r13
+	movl	%eax, 32(%rsp)
+.L2625:
+	movl	32(%rsp), %edi
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L3235
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L2625
+.L3114:
+	movq	24(%rsp), %rdx
+	movq	%rdx, %rsi
+	jmp	.L2620
+.L3198:
+	movl	(%rbx), %ecx
+	movl	%ecx, 0(%rbp)
+	movl	-4(%rbx,%rax), %ecx
+	movl	%ecx, -4(%rbp,%rax)
+	jmp	.L2627
+.L3235:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L3114
+	jmp	.L2625
+.L3218:
+	movb	$1, 16(%rsp)
+	xorl	%eax, %eax
+	jmp	.L2732
+.L3214:
+	xorl	%eax, %eax
+	movl	$1, %r13d
+	jmp	.L2659
+.L2531:
+	movl	64(%rsp), %eax
+	movq	%rbp, %rbx
+	movl	%eax, 24(%rsp)
+	leaq	64(%rsp), %rax
+	movq	%rax, 32(%rsp)
+.L2535:
+	movq	32(%rsp), %rax
+	movl	24(%rsp), %edi
+	movq	%r13, %rdx
+	movq	%rbx, %rsi
+	movq	%rax, 16(%rsp)
+	call	write@PLT
+.LEHE101:
+	testq	%rax, %rax
+	js	.L3236
+	addq	%rax, %rbx
+	subq	%rax, %r13
+	jne	.L2535
+	jmp	.L2534
+.L3236:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L2535
+.L2534:
+	movq	$0, 104(%rsp)
+	jmp	.L2536
+.L3210:
+	movb	$1, 16(%rsp)
+	xorl	%eax, %eax
+	jmp	.L2784
+.L3199:
+	movzwl	-2(%rbx,%rax), %ecx
+	movw	%cx, -2(%rbp,%rax)
+	jmp	.L2627
+.L3143:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 96(%rsp)
+	jmp	.L2548
+.L3129:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 96(%rsp)
+	jmp	.L2538
+.L3231:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L2494
+.L3111:
+	movq	%r12, %rdi
+	jmp	.L2493
+.L3134:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2489
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2489
+.L3233:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2573
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2573
+.L3205:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L3113
+	jmp	.L2582
+.L3133:
+	movb	$1, 24(%rsp)
+	xorl	%eax, %eax
+	jmp	.L2540
+.L3146:
+	movb	$1, 24(%rsp)
+	xorl	%eax, %eax
+	jmp	.L2550
+.L3194:
+	jmp	.L2771
+.L2847:
+	movq	%rax, %rbx
+	jmp	.L2705
+.L3094:
+	jmp	.L3095
+.L3092:
+	jmp	.L3093
+.L2848:
+	movq	%rax, %rbx
+	jmp	.L2808
+.L3130:
+	jmp	.L2529
+.L2849:
+	movq	%rax, %rbx
+	jmp	.L2704
+.L2840:
+	movq	%rax, %rbx
+	leaq	64(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	jmp	.L2807
+.L2846:
+	movq	%rax, %rbx
+	jmp	.L2479
+.L2851:
+	movq	%rax, %rbx
+	jmp	.L2484
+.L2850:
+	movq	%rax, %rbx
+	jmp	.L2478
+.L2839:
+	movq	%rax, %rbx
+	jmp	.L2805
+.L2845:
+	movq	%rax, %rbx
+	jmp	.L2810
+.L3141:
+	jmp	.L2544
+	.section	.gcc_except_table
+.LLSDA6935:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6935-.LLSDACSB6935
+.LLSDACSB6935:
+	.uleb128 .LEHB71-.LFB6935
+	.uleb128 .LEHE71-.LEHB71
+	.uleb128 .L2850-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB72-.LFB6935
+	.uleb128 .LEHE72-.LEHB72
+	.uleb128 .L2851-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB73-.LFB6935
+	.uleb128 .LEHE73-.LEHB73
+	.uleb128 .L2846-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB74-.LFB6935
+	.uleb128 .LEHE74-.LEHB74
+	.uleb128 .L2840-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB75-.LFB6935
+	.uleb128 .LEHE75-.LEHB75
+	.uleb128 .L3092-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB76-.LFB6935
+	.uleb128 .LEHE76-.LEHB76
+	.uleb128 .L2839-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB77-.LFB6935
+	.uleb128 .LEHE77-.LEHB77
+	.uleb128 .L2839-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB78-.LFB6935
+	.uleb128 .LEHE78-.LEHB78
+	.uleb128 .L3092-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB79-.LFB6935
+	.uleb128 .LEHE79-.LEHB79
+	.uleb128 .L2846-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB80-.LFB6935
+	.uleb128 .LEHE80-.LEHB80
+	.uleb128 .L2845-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB81-.LFB6935
+	.uleb128 .LEHE81-.LEHB81
+	.uleb128 .L2846-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB82-.LFB6935
+	.uleb128 .LEHE82-.LEHB82
+	.uleb128 .L3094-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB83-.LFB6935
+	.uleb128 .LEHE83-.LEHB83
+	.uleb128 .L2847-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB84-.LFB6935
+	.uleb128 .LEHE84-.LEHB84
+	.uleb128 .L2848-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB85-.LFB6935
+	.uleb128 .LEHE85-.LEHB85
+	.uleb128 .L3092-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB86-.LFB6935
+	.uleb128 .LEHE86-.LEHB86
+	.uleb128 .L2847-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB87-.LFB6935
+	.uleb128 .LEHE87-.LEHB87
+	.uleb128 .L2849-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB88-.LFB6935
+	.uleb128 .LEHE88-.LEHB88
+	.uleb128 .L2847-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB89-.LFB6935
+	.uleb128 .LEHE89-.LEHB89
+	.uleb128 .L3094-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB90-.LFB6935
+	.uleb128 .LEHE90-.LEHB90
+	.uleb128 .L3092-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB91-.LFB6935
+	.uleb128 .LEHE91-.LEHB91
+	.uleb128 .L3094-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB92-.LFB6935
+	.uleb128 .LEHE92-.LEHB92
+	.uleb128 .L3092-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB93-.LFB6935
+	.uleb128 .LEHE93-.LEHB93
+	.uleb128 .L2847-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB94-.LFB6935
+	.uleb128 .LEHE94-.LEHB94
+	.uleb128 .L2847-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB95-.LFB6935
+	.uleb128 .LEHE95-.LEHB95
+	.uleb128 .L3092-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB96-.LFB6935
+	.uleb128 .LEHE96-.LEHB96
+	.uleb128 .L2847-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB97-.LFB6935
+	.uleb128 .LEHE97-.LEHB97
+	.uleb128 .L3092-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB98-.LFB6935
+	.uleb128 .LEHE98-.LEHB98
+	.uleb128 .L3092-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB99-.LFB6935
+	.uleb128 .LEHE99-.LEHB99
+	.uleb128 .L3094-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB100-.LFB6935
+	.uleb128 .LEHE100-.LEHB100
+	.uleb128 .L2839-.LFB6935
+	.uleb128 0
+	.uleb128 .LEHB101-.LFB6935
+	.uleb128 .LEHE101-.LEHB101
+	.uleb128 .L3092-.LFB6935
+	.uleb128 0
+.LLSDACSE6935:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6935
+	.type	_Z22test_file_chunked_copyv.cold, @function
+_Z22test_file_chunked_copyv.cold:
+.LFSB6935:
+.L2738:
+	.cfi_def_cfa_offset 256
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC92(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB102:
+	call	__cxa_throw@PLT
+.LEHE102:
+.L2704:
+	movq	48(%rsp), %rax
+	movq	%r12, %r13
+	movq	%rax, 32(%rsp)
+.L2705:
+	testq	%r13, %r13
+	je	.L2810
+.L2811:
+	movq	40(%rsp), %rdi
+	movq	32(%rsp), %rdx
+	movl	$1, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2810:
+	movq	56(%rsp), %rbp
+	movq	%rbp, %rdi
+	call	_ZN1n4fileIcLNS_4modeE0EE5closeEv
+	movq	%rbp, %rdi
+	call	_ZN1n7fd_file5closeEv
+	jmp	.L2479
+.L2843:
+.L3095:
+	movq	56(%rsp), %rbp
+	movq	%rax, %rbx
+	movq	%rbp, %rdi
+	call	_ZN1n4fileIcLNS_4modeE0EE5closeEv
+	movq	%rbp, %rdi
+	call	_ZN1n7fd_file5closeEv
+.L2479:
+	testq	%r15, %r15
+	je	.L2812
+	movq	8(%rsp), %rdi
+	movl	$1, %ecx
+	movq	%r14, %rdx
+	movq	%r15, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2812:
+	movq	%rbx, %rdi
+.LEHB103:
+	call	_Unwind_Resume@PLT
+.LEHE103:
+.L2842:
+	movq	%rax, %rbx
+	jmp	.L2811
+.L2841:
+.L3093:
+	leaq	128(%rsp), %rbp
+	movq	%rax, %rbx
+	movq	%rbp, %rdi
+	call	_ZN1n4fileIcLNS_4modeE1EE5closeEv
+	movq	%rbp, %rdi
+	call	_ZN1n7fd_file5closeEv
+.L2807:
+	movq	16(%rsp), %rbp
+	movq	%rbp, %rdi
+	call	_ZN1n4fileIcLNS_4modeE0EE5closeEv
+	movq	%rbp, %rdi
+	call	_ZN1n7fd_file5closeEv
+	jmp	.L2479
+.L2808:
+	movq	48(%rsp), %rax
+	movq	%r12, %r13
+	movq	%rax, 32(%rsp)
+	jmp	.L2705
+.L2771:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC93(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB104:
+	call	__cxa_throw@PLT
+.LEHE104:
+.L2529:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC52(%rip), %rax
+	movq	%rax, (%rdi)
+	leaq	64(%rsp), %rax
+	movq	%rax, 16(%rsp)
+.LEHB105:
+	call	__cxa_throw@PLT
+.LEHE105:
+.L2484:
+	movq	%r13, %r14
+	movq	%r12, %r15
+	jmp	.L2479
+.L2478:
+	movq	%r13, %r14
+	jmp	.L2479
+.L2805:
+	leaq	128(%rsp), %rbp
+	movq	%rbp, %rdi
+	call	_ZN1n4fileIcLNS_4modeE1EE5closeEv
+	movq	%rbp, %rdi
+	call	_ZN1n7fd_file5closeEv
+	jmp	.L2479
+.L3097:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC90(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB106:
+	call	__cxa_throw@PLT
+.L3096:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC89(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2543:
+	movzbl	0, %eax
+	ud2
+.L2544:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC88(%rip), %rax
+	movq	%rax, (%rdi)
+	leaq	64(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	call	__cxa_throw@PLT
+.LEHE106:
+	.cfi_endproc
+.LFE6935:
+	.section	.gcc_except_table
+.LLSDAC6935:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6935-.LLSDACSBC6935
+.LLSDACSBC6935:
+	.uleb128 .LEHB102-.LCOLDB94
+	.uleb128 .LEHE102-.LEHB102
+	.uleb128 .L2842-.LCOLDB94
+	.uleb128 0
+	.uleb128 .LEHB103-.LCOLDB94
+	.uleb128 .LEHE103-.LEHB103
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB104-.LCOLDB94
+	.uleb128 .LEHE104-.LEHB104
+	.uleb128 .L2843-.LCOLDB94
+	.uleb128 0
+	.uleb128 .LEHB105-.LCOLDB94
+	.uleb128 .LEHE105-.LEHB105
+	.uleb128 .L2841-.LCOLDB94
+	.uleb128 0
+	.uleb128 .LEHB106-.LCOLDB94
+	.uleb128 .LEHE106-.LEHB106
+	.uleb128 .L2841-.LCOLDB94
+	.uleb128 0
+.LLSDACSEC6935:
+	.section	.text.unlikely
+	.text
+	.size	_Z22test_file_chunked_copyv, .-_Z22test_file_chunked_copyv
+	.section	.text.unlikely
+	.size	_Z22test_file_chunked_copyv.cold, .-_Z22test_file_chunked_copyv.cold
+.LCOLDE94:
+	.text
+.LHOTE94:
+	.section	.text._ZN1n13__avx2_searchIcEEmPKT_mS3_m,"axG",@progbits,_ZN1n13__avx2_searchIcEEmPKT_mS3_m,comdat
+	.p2align 4
+	.weak	_ZN1n13__avx2_searchIcEEmPKT_mS3_m
+	.type	_ZN1n13__avx2_searchIcEEmPKT_mS3_m, @function
+_ZN1n13__avx2_searchIcEEmPKT_mS3_m:
+.LFB7203:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdx, %rax
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	movq	%rcx, %r14
+	pushq	%r13
+	pushq	%r12
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	xorl	%r12d, %r12d
+	pushq	%rbx
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	andq	$-32, %rsp
+	addq	$-128, %rsp
+	vpbroadcastb	(%rdx), %ymm4
+	vpbroadcastb	-1(%rdx,%rcx), %ymm5
+	movq	%rdx, 104(%rsp)
+	leaq	31(%rcx), %rdx
+	movq	%rsi, 96(%rsp)
+	movq	%rdx, 16(%rsp)
+	vmovdqa	%ymm4, 64(%rsp)
+	vmovdqa	%ymm5, 32(%rsp)
+	cmpq	%rdx, %rsi
+	jb	.L3238
+	leaq	(%rdi,%rcx), %rsi
+	addq	$1, %rax
+	movq	%rsi, 24(%rsp)
+	leaq	-2(%rcx), %rsi
+	movq	%rsi, 120(%rsp)
+	movq	%rax, 112(%rsp)
+.L3242:
+	movq	24(%rsp), %rax
+	vmovdqa	32(%rsp), %ymm2
+	vmovdqa	64(%rsp), %ymm3
+	vpcmpeqb	-1(%r12,%rax), %ymm2, %ymm0
+	vpcmpeqb	(%rbx,%r12), %ymm3, %ymm1
+	vpand	%ymm1, %ymm0, %ymm0
+	vpmovmskb	%ymm0, %r15d
+	testl	%r15d, %r15d
+	je	.L3239
+	vzeroupper
+	jmp	.L3241
+	.p2align 4,,10
+	.p2align 3
+.L3266:
+	leal	-1(%r15), %eax
+	andl	%eax, %r15d
+	je	.L3239
+.L3241:
+	xorl	%ecx, %ecx
+	movq	120(%rsp), %rdx
+	movq	112(%rsp), %rsi
+	rep bsfl	%r15d, %ecx
+	movslq	%ecx, %rcx
+	leaq	(%rcx,%r12), %r13
+	leaq	1(%rbx,%r13), %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L3266
+.L3237:
+	leaq	-40(%rbp), %rsp
+	movq	%r13, %rax
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L3239:
+	.cfi_restore_state
+	movq	16(%rsp), %rax
+	addq	$32, %r12
+	addq	%r12, %rax
+	cmpq	%rax, 96(%rsp)
+	jnb	.L3242
+	subq	%r12, 96(%rsp)
+.L3238:
+	cmpq	%r14, 96(%rsp)
+	jb	.L3250
+	addq	%r12, %rbx
+	xorl	%r13d, %r13d
+	testq	%r14, %r14
+	je	.L3263
+	.p2align 4,,10
+	.p2align 3
+.L3243:
+	xorl	%eax, %eax
+	jmp	.L3246
+	.p2align 4,,10
+	.p2align 3
+.L3245:
+	addq	$1, %rax
+	cmpq	%rax, %r14
+	je	.L3244
+.L3246:
+	movq	104(%rsp), %rdx
+	movzbl	(%rdx,%rax), %esi
+	cmpb	%sil, (%rbx,%rax)
+	je	.L3245
+	cmpq	%rax, %r14
+	je	.L3244
+	addq	$1, %r13
+	addq	$1, %rbx
+	leaq	(%r14,%r13), %rax
+	cmpq	%rax, 96(%rsp)
+	jnb	.L3243
+.L3250:
+	movq	$-1, %r13
+	vzeroupper
+	jmp	.L3237
+	.p2align 4,,10
+	.p2align 3
+.L3244:
+	cmpq	$-1, %r13
+	je	.L3264
+.L3263:
+	addq	%r12, %r13
+	vzeroupper
+	jmp	.L3237
+.L3264:
+	vzeroupper
+	jmp	.L3237
+	.cfi_endproc
+.LFE7203:
+	.size	_ZN1n13__avx2_searchIcEEmPKT_mS3_m, .-_ZN1n13__avx2_searchIcEEmPKT_mS3_m
+	.section	.text._ZN1n11simd_searchIcEEmPKT_mS3_mNS_8simd_isaE,"axG",@progbits,_ZN1n11simd_searchIcEEmPKT_mS3_mNS_8simd_isaE,comdat
+	.p2align 4
+	.weak	_ZN1n11simd_searchIcEEmPKT_mS3_mNS_8simd_isaE
+	.type	_ZN1n11simd_searchIcEEmPKT_mS3_mNS_8simd_isaE, @function
+_ZN1n11simd_searchIcEEmPKT_mS3_mNS_8simd_isaE:
+.LFB7182:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	%rsi, 8(%rsp)
+	cmpq	%rcx, %rsi
+	jb	.L3289
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	movq	%rdi, %rbx
+	movq	%rdx, %r13
+	movq	%rcx, %r14
+	movl	%r8d, %r12d
+	testb	%al, %al
+	je	.L3326
+.L3271:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	jge	.L3327
+.L3304:
+.L3275:
+	cmpl	$1, %r12d
+	je	.L3282
+.L3330:
+	subl	$2, %r12d
+	cmpl	$1, %r12d
+	ja	.L3283
+	movq	8(%rsp), %rsi
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%r14, %rcx
+	movq	%r13, %rdx
+	movq	%rbx, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n13__avx2_searchIcEEmPKT_mS3_m
+	.p2align 4,,10
+	.p2align 3
+.L3282:
+	.cfi_restore_state
+	movzbl	0(%r13), %eax
+	xorl	%r12d, %r12d
+	movd	%eax, %xmm0
+	movzbl	-1(%r13,%r14), %eax
+	punpcklbw	%xmm0, %xmm0
+	punpcklwd	%xmm0, %xmm0
+	pshufd	$0, %xmm0, %xmm5
+	movd	%eax, %xmm0
+	leaq	15(%r14), %rax
+	punpcklbw	%xmm0, %xmm0
+	movq	%rax, 88(%rsp)
+	punpcklwd	%xmm0, %xmm0
+	movaps	%xmm5, 48(%rsp)
+	pshufd	$0, %xmm0, %xmm6
+	movaps	%xmm6, 64(%rsp)
+	cmpq	%rax, 8(%rsp)
+	jb	.L3285
+	leaq	(%rbx,%r14), %rax
+	movq	%rax, 80(%rsp)
+	leaq	-2(%r14), %rax
+	movq	%rax, 16(%rsp)
+	leaq	1(%r13), %rax
+	movq	%rax, 24(%rsp)
+.L3288:
+	movq	80(%rsp), %rax
+	movdqu	(%rbx,%r12), %xmm1
+	movdqu	-1(%rax,%r12), %xmm2
+	pcmpeqb	48(%rsp), %xmm1
+	movaps	%xmm2, 32(%rsp)
+	movdqa	32(%rsp), %xmm0
+	pcmpeqb	64(%rsp), %xmm0
+	pand	%xmm1, %xmm0
+	pmovmskb	%xmm0, %ebp
+	testl	%ebp, %ebp
+	jne	.L3287
+	jmp	.L3286
+	.p2align 4,,10
+	.p2align 3
+.L3328:
+	leal	-1(%rbp), %eax
+	andl	%eax, %ebp
+	je	.L3286
+.L3287:
+	xorl	%ecx, %ecx
+	movq	16(%rsp), %rdx
+	movq	24(%rsp), %rsi
+	rep bsfl	%ebp, %ecx
+	movslq	%ecx, %rcx
+	leaq	(%rcx,%r12), %r15
+	leaq	1(%rbx,%r15), %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L3328
+.L3267:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%r15, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L3303:
+	.p2align 4,,10
+	.p2align 3
+.L3327:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L3329
+.L3278:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	cmpl	$1, %r12d
+	jne	.L3330
+	jmp	.L3282
+	.p2align 4,,10
+	.p2align 3
+.L3326:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3271
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L3296
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L3273:
+	movq	%rbp, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	jl	.L3275
+	jmp	.L3327
+.L3283:
+	xorl	%r15d, %r15d
+	testq	%r14, %r14
+	je	.L3267
+	.p2align 4,,10
+	.p2align 3
+.L3284:
+	xorl	%eax, %eax
+	jmp	.L3295
+	.p2align 4,,10
+	.p2align 3
+.L3294:
+	addq	$1, %rax
+	cmpq	%rax, %r14
+	je	.L3267
+.L3295:
+	movzbl	0(%r13,%rax), %esi
+	cmpb	%sil, (%rbx,%rax)
+	je	.L3294
+	cmpq	%rax, %r14
+	je	.L3267
+	addq	$1, %r15
+	addq	$1, %rbx
+	leaq	(%r14,%r15), %rax
+	cmpq	%rax, 8(%rsp)
+	jnb	.L3284
+.L3289:
+	movq	$-1, %r15
+	jmp	.L3267
+	.p2align 4,,10
+	.p2align 3
+.L3286:
+	movq	88(%rsp), %rax
+	addq	$16, %r12
+	addq	%r12, %rax
+	cmpq	%rax, 8(%rsp)
+	jnb	.L3288
+	subq	%r12, 8(%rsp)
+	movq	8(%rsp), %rax
+	cmpq	%r14, %rax
+	jb	.L3289
+.L3285:
+	addq	%r12, %rbx
+	xorl	%ecx, %ecx
+	testq	%r14, %r14
+	je	.L3324
+	.p2align 4,,10
+	.p2align 3
+.L3290:
+	xorl	%eax, %eax
+	jmp	.L3293
+	.p2align 4,,10
+	.p2align 3
+.L3292:
+	addq	$1, %rax
+	cmpq	%rax, %r14
+	je	.L3291
+.L3293:
+	movzbl	0(%r13,%rax), %edx
+	cmpb	%dl, (%rbx,%rax)
+	je	.L3292
+	cmpq	%rax, %r14
+	je	.L3291
+	addq	$1, %rcx
+	addq	$1, %rbx
+	leaq	(%r14,%rcx), %rax
+	cmpq	%rax, 8(%rsp)
+	jnb	.L3290
+	jmp	.L3289
+.L3329:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3278
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L3298
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L3280:
+	movq	%rbp, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3278
+.L3291:
+	cmpq	$-1, %rcx
+	je	.L3289
+.L3324:
+	leaq	(%rcx,%r12), %r15
+	jmp	.L3267
+.L3296:
+	movl	$3, %eax
+	jmp	.L3273
+.L3298:
+	movl	$3, %eax
+	jmp	.L3280
+	.cfi_endproc
+.LFE7182:
+	.size	_ZN1n11simd_searchIcEEmPKT_mS3_mNS_8simd_isaE, .-_ZN1n11simd_searchIcEEmPKT_mS3_mNS_8simd_isaE
+	.section	.rodata.str1.8
+	.align 8
+.LC95:
+	.string	"key=value\nother=thing\nkey=again\n"
+	.section	.rodata.str1.1
+.LC96:
+	.string	"again"
+.LC97:
+	.string	"other=thing"
+.LC98:
+	.string	"test_mmap.txt"
+.LC99:
+	.string	"expected true : m.opened()"
+	.section	.rodata.str1.8
+	.align 8
+.LC100:
+	.string	"expected equal : expected value : m.len(), actual value : 32"
+	.align 8
+.LC101:
+	.string	"expected equal : expected value : n::count(all, '\\n'), actual value : 3"
+	.align 8
+.LC102:
+	.string	"expected equal : expected value : n::find_subsequence(all, n::str(\"again\").iter()), actual value : 26"
+	.align 8
+.LC103:
+	.string	"expected true : m.advise(n::advice::sequential)"
+	.align 8
+.LC104:
+	.string	"expected true : m.advise(n::advice::willneed, 10, 12)"
+	.align 8
+.LC105:
+	.string	"expected true : n::equal(v, n::str(\"other=thing\").iter())"
+	.section	.rodata.str1.1
+.LC106:
+	.string	"no/such/file"
+	.section	.rodata.str1.8
+	.align 8
+.LC107:
+	.string	"expected false : n::mmap_file<char>(\"no/such/file\").opened()"
+	.section	.text.unlikely
+.LCOLDB108:
+	.text
+.LHOTB108:
+	.p2align 4
+	.globl	_Z14test_mmap_filev
+	.type	_Z14test_mmap_filev, @function
+_Z14test_mmap_filev:
+.LFB6948:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6948
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$438, %edx
+	movl	$524865, %esi
+	xorl	%eax, %eax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	leaq	.LC98(%rip), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%r13, %rdi
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$248, %rsp
+	.cfi_def_cfa_offset 304
+.LEHB107:
+	call	open@PLT
+.LEHE107:
+	movdqa	.LC46(%rip), %xmm0
+	movb	$0, 102(%rsp)
+	movl	%eax, 96(%rsp)
+	movzwl	.LC64(%rip), %eax
+	movdqa	.LC65(%rip), %xmm1
+	movq	$0, 104(%rsp)
+	movw	%ax, 100(%rsp)
+	movq	$0, 112(%rsp)
+	movq	$0, 136(%rsp)
+	movq	$0, 144(%rsp)
+	movups	%xmm0, 120(%rsp)
+	movaps	%xmm1, 48(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbx
+	testq	%rbx, %rbx
+	je	.L3332
+	movq	%rbx, 64(%rsp)
+	pxor	%xmm0, %xmm0
+	movl	$32, %eax
+	movl	$23, %ebp
+	movq	$0, 88(%rsp)
+	movups	%xmm0, 72(%rsp)
+.L3333:
+	leaq	10(%rbp,%rbp), %rbp
+	movl	$1, %edx
+	movq	%rbx, %rdi
+	cmpq	%rax, %rbp
+	cmovb	%rax, %rbp
+	movq	(%rbx), %rax
+	leaq	1(%rbp), %rsi
+.LEHB108:
+	call	*16(%rax)
+	movq	%rax, %rbx
+	movq	48(%rsp), %rax
+	cmpq	$23, 56(%rsp)
+	leaq	72(%rsp), %rsi
+	leaq	1(%rax), %rdx
+	je	.L3341
+	movq	72(%rsp), %rsi
+.L3341:
+	movq	%rbx, %rdi
+	call	memcpy@PLT
+	movq	56(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L3342
+	movq	64(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	72(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE108:
+.L3342:
+	movq	%rbx, 72(%rsp)
+	movq	48(%rsp), %rdi
+	movq	%rbp, 56(%rsp)
+.L3340:
+	leaq	.LC95(%rip), %rsi
+	cmpq	$23, %rbp
+	je	.L3668
+.L3347:
+	addq	%rbx, %rdi
+	movl	$32, %edx
+	call	memmove@PLT
+	movq	48(%rsp), %rax
+	leaq	32(%rax), %rdx
+	movq	%rdx, 48(%rsp)
+	movb	$0, 32(%rbx,%rax)
+	movl	96(%rsp), %ebx
+	movq	56(%rsp), %rdx
+	movq	48(%rsp), %rbp
+	movl	%ebx, %eax
+	shrl	$31, %eax
+	cmpq	$23, %rdx
+	je	.L3349
+	movq	72(%rsp), %r12
+	testq	%rbp, %rbp
+	je	.L3350
+	testb	%al, %al
+	jne	.L3350
+.L3498:
+	cmpl	$1, 104(%rsp)
+	je	.L3669
+.L3351:
+	movq	120(%rsp), %r15
+	movl	$2, 104(%rsp)
+	cmpq	%r15, %rbp
+	jb	.L3353
+	movq	136(%rsp), %r15
+	testq	%r15, %r15
+	je	.L3360
+	movq	112(%rsp), %r14
+	movq	%r14, (%rsp)
+.L3359:
+	movq	(%rsp), %rsi
+	movq	%r15, %rdx
+	movl	%ebx, %edi
+.LEHB109:
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L3670
+	addq	%rax, (%rsp)
+	subq	%rax, %r15
+	jne	.L3359
+	movq	$0, 136(%rsp)
+	jmp	.L3360
+	.p2align 4,,10
+	.p2align 3
+.L3363:
+	addq	%rax, %r12
+	subq	%rax, %rbp
+.L3364:
+	testq	%rbp, %rbp
+	je	.L3655
+.L3360:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+.LEHE109:
+	testq	%rax, %rax
+	jns	.L3363
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L3364
+.L3655:
+	movq	112(%rsp), %r14
+.L3362:
+	movq	56(%rsp), %rdx
+	cmpq	$23, %rdx
+	je	.L3390
+	movq	72(%rsp), %r12
+.L3497:
+	movq	64(%rsp), %rdi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	%r12, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L3390:
+	testl	%ebx, %ebx
+	js	.L3391
+	cmpl	$2, 104(%rsp)
+	je	.L3671
+.L3392:
+	cmpb	$0, 100(%rsp)
+	jne	.L3672
+.L3397:
+	movl	$-1, 96(%rsp)
+	movl	$-1, %ebx
+.L3391:
+	testq	%r14, %r14
+	je	.L3673
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3674
+.L3402:
+	movq	120(%rsp), %rdx
+	movq	112(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	144(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movl	96(%rsp), %ebx
+	movq	$0, 112(%rsp)
+	movl	$0, 104(%rsp)
+	movaps	%xmm0, 128(%rsp)
+	testq	%rdi, %rdi
+	je	.L3404
+.L3399:
+	call	fclose@PLT
+.L3404:
+	testl	%ebx, %ebx
+	js	.L3400
+	cmpb	$0, 100(%rsp)
+	jne	.L3675
+.L3400:
+	movl	$524288, %esi
+	movq	%r13, %rdi
+	xorl	%eax, %eax
+.LEHB110:
+	call	open@PLT
+	movl	%eax, %ebx
+	testl	%eax, %eax
+	js	.L3406
+	leaq	96(%rsp), %rax
+	movl	%ebx, %edi
+	movq	%rax, %rsi
+	movq	%rax, 16(%rsp)
+	call	fstat@PLT
+	testl	%eax, %eax
+	jne	.L3407
+	movq	144(%rsp), %rax
+	movq	%rax, 32(%rsp)
+	testq	%rax, %rax
+	je	.L3408
+	xorl	%edi, %edi
+	xorl	%r9d, %r9d
+	movl	%ebx, %r8d
+	movl	$2, %ecx
+	movl	$1, %edx
+	movq	%rax, %rsi
+	call	mmap@PLT
+	movl	%ebx, %edi
+	movq	%rax, %rbp
+	cmpq	$-1, %rax
+	je	.L3676
+	call	close@PLT
+.LEHE110:
+	cmpq	$32, 32(%rsp)
+	jne	.L3677
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L3678
+.L3413:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %ecx
+	movl	$10, %edx
+	movl	$32, %esi
+	movq	%rbp, %rdi
+	call	_ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE
+	cmpq	$3, %rax
+	jne	.L3416
+	movdqa	.LC65(%rip), %xmm2
+	movaps	%xmm2, 96(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L3420
+	pxor	%xmm0, %xmm0
+	leaq	120(%rsp), %rbx
+	movq	%rax, 112(%rsp)
+	xorl	%r12d, %r12d
+	leaq	.LC96(%rip), %rsi
+	movups	%xmm0, 120(%rsp)
+	movq	$0, 136(%rsp)
+	cmpq	%rbx, %rsi
+	jb	.L3421
+.L3659:
+	leaq	.LC96(%rip), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L3421:
+	leaq	(%rbx,%r12), %rdi
+	movl	$5, %edx
+	call	memmove@PLT
+	movq	96(%rsp), %rax
+	leaq	5(%rax), %rdx
+	movq	%rdx, 96(%rsp)
+	movb	$0, 5(%rbx,%rax)
+	movq	104(%rsp), %r12
+	movq	96(%rsp), %rbx
+	cmpq	$23, %r12
+	je	.L3434
+	movq	120(%rsp), %rsi
+	testq	%rbx, %rbx
+	je	.L3435
+	cmpq	$32, %rbx
+	ja	.L3524
+	cmpq	$1, %rbx
+	je	.L3679
+.L3436:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L3680
+.L3440:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %r8d
+	movq	%rbx, %rcx
+	movq	%rsi, %rdx
+	movq	%rbp, %rdi
+	movl	$32, %esi
+	call	_ZN1n11simd_searchIcEEmPKT_mS3_mNS_8simd_isaE
+	movq	104(%rsp), %r12
+	movq	%rax, %rbx
+.L3438:
+	cmpq	$23, %r12
+	je	.L3448
+	movq	120(%rsp), %rsi
+.L3435:
+	movq	112(%rsp), %rdi
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L3448:
+	cmpq	$26, %rbx
+	jne	.L3447
+	movl	$30, %edi
+	call	sysconf@PLT
+	leaq	32(%rbp), %rsi
+	movl	$2, %edx
+	negq	%rax
+	movq	%rax, %rdi
+	andq	%rbp, %rdi
+	subq	%rdi, %rsi
+	call	madvise@PLT
+	testl	%eax, %eax
+	jne	.L3652
+	leaq	10(%rbp), %rbx
+	movl	$30, %edi
+	movq	%rbx, 8(%rsp)
+	call	sysconf@PLT
+	leaq	22(%rbp), %rsi
+	movl	$3, %edx
+	negq	%rax
+	movq	%rax, %rdi
+	andq	%rbx, %rdi
+	subq	%rdi, %rsi
+	call	madvise@PLT
+	testl	%eax, %eax
+	jne	.L3653
+	movdqa	.LC65(%rip), %xmm3
+	movaps	%xmm3, 96(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L3452
+	pxor	%xmm0, %xmm0
+	leaq	120(%rsp), %rbx
+	movq	%rax, 112(%rsp)
+	xorl	%r12d, %r12d
+	leaq	.LC97(%rip), %rsi
+	movups	%xmm0, 120(%rsp)
+	movq	$0, 136(%rsp)
+	cmpq	%rbx, %rsi
+	jb	.L3453
+.L3660:
+	leaq	.LC97(%rip), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L3453:
+	movl	$11, %edx
+	leaq	(%rbx,%r12), %rdi
+	call	memmove@PLT
+	movq	96(%rsp), %rax
+	leaq	11(%rax), %rdx
+	movq	%rdx, 96(%rsp)
+	movb	$0, 11(%rbx,%rax)
+	movq	104(%rsp), %rax
+	movq	96(%rsp), %rdx
+	cmpq	$23, %rax
+	je	.L3681
+	movq	120(%rsp), %rsi
+	cmpq	$11, %rdx
+	jne	.L3469
+	movq	8(%rsp), %rcx
+	movq	(%rsi), %rdx
+	cmpq	%rdx, (%rcx)
+	jne	.L3469
+	movl	7(%rsi), %edx
+	cmpl	%edx, 7(%rcx)
+	jne	.L3469
+	movq	112(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L3490
+	.p2align 4,,10
+	.p2align 3
+.L3673:
+	movq	144(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 104(%rsp)
+	movaps	%xmm0, 128(%rsp)
+	testq	%rdi, %rdi
+	jne	.L3399
+	jmp	.L3400
+	.p2align 4,,10
+	.p2align 3
+.L3350:
+	movq	112(%rsp), %r14
+	jmp	.L3497
+	.p2align 4,,10
+	.p2align 3
+.L3349:
+	testq	%rbp, %rbp
+	je	.L3547
+	leaq	72(%rsp), %r12
+	testb	%al, %al
+	je	.L3498
+.L3547:
+	movq	112(%rsp), %r14
+	jmp	.L3390
+.L3671:
+	movq	136(%rsp), %r12
+	testq	%r12, %r12
+	je	.L3392
+	movq	%r14, %rbp
+.L3396:
+	movq	%r12, %rdx
+	movq	%rbp, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L3682
+	addq	%rax, %rbp
+	subq	%rax, %r12
+	jne	.L3396
+.L3395:
+	movq	$0, 136(%rsp)
+	jmp	.L3392
+	.p2align 4,,10
+	.p2align 3
+.L3434:
+	testq	%rbx, %rbx
+	je	.L3447
+	cmpq	$32, %rbx
+	ja	.L3447
+	leaq	120(%rsp), %rsi
+	cmpq	$1, %rbx
+	jne	.L3436
+.L3679:
+	movzbl	(%rsi), %esi
+	movl	$32, %edx
+	movq	%rbp, %rdi
+	call	memchr@PLT
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L3437
+	subq	%rbp, %rbx
+	jmp	.L3438
+	.p2align 4,,10
+	.p2align 3
+.L3681:
+	cmpq	$11, %rdx
+	jne	.L3468
+	movq	8(%rsp), %rax
+	movq	120(%rsp), %rcx
+	cmpq	%rcx, (%rax)
+	jne	.L3468
+	movl	127(%rsp), %ecx
+	cmpl	%ecx, 7(%rax)
+	jne	.L3468
+.L3490:
+	movq	%r13, %rdi
+	call	remove@PLT
+	movl	$524288, %esi
+	leaq	.LC106(%rip), %rdi
+	xorl	%eax, %eax
+.LEHB111:
+	call	open@PLT
+.LEHE111:
+	movl	%eax, %ebx
+	testl	%eax, %eax
+	js	.L3473
+	movq	16(%rsp), %rsi
+	movl	%eax, %edi
+	call	fstat@PLT
+	testl	%eax, %eax
+	jne	.L3474
+	movq	144(%rsp), %r12
+	testq	%r12, %r12
+	jne	.L3683
+	movl	%ebx, %edi
+.LEHB112:
+	call	close@PLT
+.L3478:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC107(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE112:
+	.p2align 4,,10
+	.p2align 3
+.L3678:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3413
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L3515
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L3415:
+	movq	%r12, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3413
+.L3672:
+	movl	%ebx, %edi
+	call	close@PLT
+	jmp	.L3397
+.L3675:
+	movl	%ebx, %edi
+	call	close@PLT
+	jmp	.L3400
+.L3674:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3402
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3402
+.L3452:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3684
+.L3457:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	96(%rsp), %r12
+	pxor	%xmm0, %xmm0
+	movq	$0, 136(%rsp)
+	movq	104(%rsp), %r14
+	movups	%xmm0, 120(%rsp)
+	leaq	.LC97(%rip), %rsi
+	movq	%r15, 112(%rsp)
+	leaq	11(%r12), %rax
+	movq	$0, 24(%rsp)
+	cmpq	$23, %r14
+	je	.L3685
+.L3459:
+	movq	24(%rsp), %rcx
+	leaq	(%rcx,%r12), %rdx
+	cmpq	%rdx, %rsi
+	jnb	.L3686
+	movq	24(%rsp), %rcx
+	movq	%rsi, %rdx
+	subq	%rcx, %rdx
+	movq	%rdx, 40(%rsp)
+	cmpq	%rax, %r14
+	jnb	.L3532
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, (%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+.LEHB113:
+	call	*16(%rax)
+	movq	24(%rsp), %rsi
+	leaq	1(%r12), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L3463
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L3463:
+	movq	(%rsp), %rax
+	movq	%rbx, 120(%rsp)
+	movq	%rax, 104(%rsp)
+	movq	%rax, %r14
+.L3462:
+	cmpq	$23, %r14
+	jne	.L3667
+	leaq	120(%rsp), %rbx
+.L3667:
+	movq	40(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L3453
+.L3686:
+	cmpq	%rax, %r14
+	jnb	.L3531
+.L3493:
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, (%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	24(%rsp), %rsi
+	leaq	1(%r12), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L3461
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.LEHE113:
+.L3461:
+	movq	(%rsp), %rax
+	movq	%rbx, 120(%rsp)
+	movq	%rax, 104(%rsp)
+.L3455:
+	cmpq	$23, (%rsp)
+	leaq	.LC97(%rip), %rsi
+	jne	.L3453
+	leaq	120(%rsp), %rbx
+	jmp	.L3660
+.L3332:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3687
+.L3336:
+	movq	48(%rsp), %rdi
+	movq	56(%rsp), %rbp
+	pxor	%xmm0, %xmm0
+	xorl	%edx, %edx
+	movq	_ZZN1n4heapEvE3res(%rip), %rcx
+	movups	%xmm0, 72(%rsp)
+	leaq	.LC95(%rip), %rsi
+	movq	$0, 88(%rsp)
+	leaq	32(%rdi), %rax
+	movq	%rcx, 64(%rsp)
+	cmpq	$23, %rbp
+	je	.L3688
+.L3338:
+	leaq	(%rdx,%rdi), %r8
+	cmpq	%r8, %rsi
+	jnb	.L3689
+	subq	%rdx, %rsi
+	movq	%rsi, %r12
+	cmpq	%rax, %rbp
+	jnb	.L3509
+	leaq	10(%rbp,%rbp), %rbp
+	movl	$1, %edx
+	movq	%rcx, %rdi
+	cmpq	%rax, %rbp
+	cmovb	%rax, %rbp
+	movq	(%rcx), %rax
+	leaq	1(%rbp), %rsi
+.LEHB114:
+	call	*16(%rax)
+	movq	%rax, %rbx
+	movq	48(%rsp), %rax
+	cmpq	$23, 56(%rsp)
+	leaq	72(%rsp), %rsi
+	leaq	1(%rax), %rdx
+	je	.L3344
+	movq	72(%rsp), %rsi
+.L3344:
+	movq	%rbx, %rdi
+	call	memcpy@PLT
+	movq	56(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L3345
+	movq	64(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	72(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE114:
+.L3345:
+	movq	%rbx, 72(%rsp)
+	movq	48(%rsp), %rdi
+	movq	%rbp, 56(%rsp)
+.L3343:
+	leaq	(%rbx,%r12), %rsi
+	cmpq	$23, %rbp
+	jne	.L3347
+	leaq	72(%rsp), %rdx
+	leaq	(%rdx,%r12), %rsi
+.L3537:
+	movq	%rdx, %rbx
+	jmp	.L3347
+.L3509:
+	xorl	%ebx, %ebx
+	jmp	.L3343
+.L3689:
+	cmpq	%rax, %rbp
+	jnb	.L3340
+.L3663:
+	movq	%rcx, %rbx
+	jmp	.L3333
+.L3420:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3690
+.L3425:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	96(%rsp), %r12
+	pxor	%xmm0, %xmm0
+	movq	$0, 136(%rsp)
+	movq	104(%rsp), %r14
+	movups	%xmm0, 120(%rsp)
+	leaq	.LC96(%rip), %rsi
+	movq	%r15, 112(%rsp)
+	leaq	5(%r12), %rax
+	movq	$0, 8(%rsp)
+	cmpq	$23, %r14
+	je	.L3691
+.L3427:
+	movq	8(%rsp), %rcx
+	leaq	(%rcx,%r12), %rdx
+	cmpq	%rdx, %rsi
+	jnb	.L3692
+	movq	8(%rsp), %rcx
+	movq	%rsi, %rdx
+	subq	%rcx, %rdx
+	movq	%rdx, 24(%rsp)
+	cmpq	%rax, %r14
+	jnb	.L3522
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, (%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+.LEHB115:
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%r12), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L3431
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L3431:
+	movq	(%rsp), %rax
+	movq	%rbx, 120(%rsp)
+	movq	%rax, 104(%rsp)
+	movq	%rax, %r14
+.L3430:
+	cmpq	$23, %r14
+	jne	.L3666
+	leaq	120(%rsp), %rbx
+.L3666:
+	movq	24(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L3421
+.L3692:
+	cmpq	%rax, %r14
+	jnb	.L3521
+.L3495:
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, (%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%r12), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L3429
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.LEHE115:
+.L3429:
+	movq	(%rsp), %rax
+	movq	%rbx, 120(%rsp)
+	movq	%rax, 104(%rsp)
+.L3423:
+	cmpq	$23, (%rsp)
+	leaq	.LC96(%rip), %rsi
+	jne	.L3421
+	leaq	120(%rsp), %rbx
+	jmp	.L3659
+.L3668:
+	leaq	72(%rsp), %rdx
+	jmp	.L3537
+.L3669:
+	movq	136(%rsp), %rax
+	movq	128(%rsp), %rsi
+	cmpq	%rsi, %rax
+	je	.L3352
+	subq	%rax, %rsi
+	movl	$1, %edx
+	movl	%ebx, %edi
+	call	lseek@PLT
+.L3352:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 128(%rsp)
+	jmp	.L3351
+.L3353:
+	movq	112(%rsp), %r14
+	testq	%r14, %r14
+	je	.L3693
+.L3367:
+	movq	136(%rsp), %rax
+	subq	%rax, %r15
+	movq	%rax, (%rsp)
+	cmpq	%rbp, %r15
+	jb	.L3372
+.L3664:
+	leaq	(%r14,%rax), %rdi
+	leaq	0(%rbp,%rax), %r15
+.L3373:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	call	memcpy@PLT
+	movq	%r15, 136(%rsp)
+.L3378:
+	movl	108(%rsp), %eax
+	cmpl	$2, %eax
+	je	.L3381
+	cmpl	$1, %eax
+	jne	.L3362
+	movq	%rbp, %rdx
+	movl	$10, %esi
+	movq	%r12, %rdi
+	call	memchr@PLT
+	testq	%rax, %rax
+	je	.L3362
+.L3381:
+	cmpl	$2, 104(%rsp)
+	jne	.L3362
+	movq	136(%rsp), %rbp
+	testq	%rbp, %rbp
+	je	.L3362
+	movq	%r14, %r12
+.L3389:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%ebx, %edi
+.LEHB116:
+	call	write@PLT
+.LEHE116:
+	testq	%rax, %rax
+	js	.L3694
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L3389
+	jmp	.L3654
+	.p2align 4,,10
+	.p2align 3
+.L3524:
+	movq	$-1, %rbx
+	jmp	.L3435
+.L3682:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L3395
+	jmp	.L3396
+.L3690:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3425
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3425
+.L3687:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3336
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3336
+.L3684:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3457
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3457
+.L3372:
+	cmpl	$2, 104(%rsp)
+	jne	.L3546
+	cmpq	$0, (%rsp)
+	jne	.L3513
+.L3546:
+	movq	(%rsp), %rax
+	jmp	.L3664
+	.p2align 4,,10
+	.p2align 3
+.L3474:
+	movl	%ebx, %edi
+.LEHB117:
+	call	close@PLT
+.L3473:
+	testq	%rbp, %rbp
+	je	.L3331
+	addq	$248, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbp, %rdi
+	movl	$32, %esi
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	munmap@PLT
+	.p2align 4,,10
+	.p2align 3
+.L3331:
+	.cfi_restore_state
+	addq	$248, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L3683:
+	.cfi_restore_state
+	xorl	%r9d, %r9d
+	movl	%ebx, %r8d
+	movl	$2, %ecx
+	movl	$1, %edx
+	movq	%r12, %rsi
+	xorl	%edi, %edi
+	call	mmap@PLT
+	movq	%rax, %r13
+	cmpq	$-1, %rax
+	je	.L3474
+	movl	%ebx, %edi
+	call	close@PLT
+.LEHE117:
+	testq	%r13, %r13
+	je	.L3478
+	movq	%r12, %rsi
+	movq	%r13, %rdi
+	call	munmap@PLT
+	jmp	.L3478
+.L3680:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r12
+	movq	%rsi, (%rsp)
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	movq	(%rsp), %rsi
+	testl	%eax, %eax
+	je	.L3440
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movq	(%rsp), %rsi
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L3525
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L3442:
+	movq	%r12, %rdi
+	movq	%rsi, (%rsp)
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	movq	(%rsp), %rsi
+	jmp	.L3440
+.L3670:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L3359
+.L3654:
+	movq	$0, 136(%rsp)
+	jmp	.L3362
+.L3543:
+.L3437:
+	cmpq	$23, %r12
+	je	.L3447
+	movq	120(%rsp), %rsi
+	movq	$-1, %rbx
+	jmp	.L3435
+.L3676:
+.LEHB118:
+	call	close@PLT
+.LEHE118:
+.L3406:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC99(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB119:
+	call	__cxa_throw@PLT
+.LEHE119:
+	.p2align 4,,10
+	.p2align 3
+.L3521:
+	movq	%r14, (%rsp)
+	xorl	%ebx, %ebx
+	jmp	.L3423
+.L3531:
+	movq	%r14, (%rsp)
+	xorl	%ebx, %ebx
+	jmp	.L3455
+.L3694:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L3654
+	jmp	.L3389
+.L3515:
+	movl	$3, %eax
+	jmp	.L3415
+.L3693:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3695
+.L3369:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	120(%rsp), %r15
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%r15, %rsi
+.LEHB120:
+	call	*16(%rax)
+	movq	%rax, 112(%rsp)
+	movl	96(%rsp), %ebx
+	movq	%rax, %r14
+	testq	%rax, %rax
+	jne	.L3367
+	movq	%r12, (%rsp)
+	movq	%rbp, %r15
+.L3371:
+	movq	(%rsp), %rsi
+	movq	%r15, %rdx
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L3696
+	addq	%rax, (%rsp)
+	subq	%rax, %r15
+.L3380:
+	testq	%r15, %r15
+	jne	.L3371
+	jmp	.L3378
+	.p2align 4,,10
+	.p2align 3
+.L3696:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L3378
+	jmp	.L3380
+.L3695:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3369
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3369
+.L3513:
+	movq	%r14, %r15
+.L3374:
+	movq	(%rsp), %rdx
+	movq	%r15, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+.LEHE120:
+	testq	%rax, %rax
+	js	.L3697
+	addq	%rax, %r15
+	subq	%rax, (%rsp)
+	jne	.L3374
+	jmp	.L3665
+.L3697:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L3374
+.L3665:
+	movq	%rbp, %r15
+	movq	%r14, %rdi
+	jmp	.L3373
+.L3525:
+	movl	$3, %eax
+	jmp	.L3442
+	.p2align 4,,10
+	.p2align 3
+.L3532:
+	xorl	%ebx, %ebx
+	jmp	.L3462
+.L3685:
+	leaq	120(%rsp), %rbx
+	cmpq	%rbx, %rsi
+	jnb	.L3698
+	cmpq	$23, %rax
+	jbe	.L3453
+	movq	%rbx, 24(%rsp)
+	jmp	.L3493
+.L3691:
+	leaq	120(%rsp), %rbx
+	cmpq	%rbx, %rsi
+	jnb	.L3699
+	cmpq	$23, %rax
+	jbe	.L3421
+	movq	%rbx, 8(%rsp)
+	jmp	.L3495
+.L3522:
+	xorl	%ebx, %ebx
+	jmp	.L3430
+.L3688:
+	leaq	72(%rsp), %rdx
+	cmpq	%rdx, %rsi
+	jnb	.L3338
+	cmpq	$23, %rax
+	jbe	.L3537
+	jmp	.L3663
+.L3698:
+	movq	%rbx, 24(%rsp)
+	jmp	.L3459
+.L3699:
+	movq	%rbx, 8(%rsp)
+	jmp	.L3427
+.L3544:
+	movq	%rax, %rbx
+	jmp	.L3483
+.L3540:
+	movq	%rax, %rbx
+	jmp	.L3486
+.L3677:
+	jmp	.L3410
+.L3650:
+	jmp	.L3651
+.L3541:
+	movq	%rax, %rbx
+	jmp	.L3483
+.L3538:
+	movq	%rax, %rbx
+	jmp	.L3482
+.L3539:
+	movq	%rax, %rbx
+	jmp	.L3480
+	.section	.gcc_except_table
+.LLSDA6948:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6948-.LLSDACSB6948
+.LLSDACSB6948:
+	.uleb128 .LEHB107-.LFB6948
+	.uleb128 .LEHE107-.LEHB107
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB108-.LFB6948
+	.uleb128 .LEHE108-.LEHB108
+	.uleb128 .L3538-.LFB6948
+	.uleb128 0
+	.uleb128 .LEHB109-.LFB6948
+	.uleb128 .LEHE109-.LEHB109
+	.uleb128 .L3539-.LFB6948
+	.uleb128 0
+	.uleb128 .LEHB110-.LFB6948
+	.uleb128 .LEHE110-.LEHB110
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB111-.LFB6948
+	.uleb128 .LEHE111-.LEHB111
+	.uleb128 .L3544-.LFB6948
+	.uleb128 0
+	.uleb128 .LEHB112-.LFB6948
+	.uleb128 .LEHE112-.LEHB112
+	.uleb128 .L3541-.LFB6948
+	.uleb128 0
+	.uleb128 .LEHB113-.LFB6948
+	.uleb128 .LEHE113-.LEHB113
+	.uleb128 .L3650-.LFB6948
+	.uleb128 0
+	.uleb128 .LEHB114-.LFB6948
+	.uleb128 .LEHE114-.LEHB114
+	.uleb128 .L3538-.LFB6948
+	.uleb128 0
+	.uleb128 .LEHB115-.LFB6948
+	.uleb128 .LEHE115-.LEHB115
+	.uleb128 .L3650-.LFB6948
+	.uleb128 0
+	.uleb128 .LEHB116-.LFB6948
+	.uleb128 .LEHE116-.LEHB116
+	.uleb128 .L3539-.LFB6948
+	.uleb128 0
+	.uleb128 .LEHB117-.LFB6948
+	.uleb128 .LEHE117-.LEHB117
+	.uleb128 .L3541-.LFB6948
+	.uleb128 0
+	.uleb128 .LEHB118-.LFB6948
+	.uleb128 .LEHE118-.LEHB118
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB119-.LFB6948
+	.uleb128 .LEHE119-.LEHB119
+	.uleb128 .L3540-.LFB6948
+	.uleb128 0
+	.uleb128 .LEHB120-.LFB6948
+	.uleb128 .LEHE120-.LEHB120
+	.uleb128 .L3539-.LFB6948
+	.uleb128 0
+.LLSDACSE6948:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6948
+	.type	_Z14test_mmap_filev.cold, @function
+_Z14test_mmap_filev.cold:
+.LFSB6948:
+.L3483:
+	.cfi_def_cfa_offset 304
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	testq	%rbp, %rbp
+	je	.L3486
+	movl	$32, %esi
+	movq	%rbp, %rdi
+	call	munmap@PLT
+.L3486:
+	movq	%rbx, %rdi
+.LEHB121:
+	call	_Unwind_Resume@PLT
+.L3408:
+	movl	%ebx, %edi
+	xorl	%ebp, %ebp
+	call	close@PLT
+.LEHE121:
+.L3410:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC100(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB122:
+	call	__cxa_throw@PLT
+.L3545:
+.L3651:
+	movq	%rax, %rbx
+	testq	%rbp, %rbp
+	je	.L3486
+	movq	32(%rsp), %rsi
+	movq	%rbp, %rdi
+	call	munmap@PLT
+	jmp	.L3486
+.L3542:
+.L3416:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC101(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L3652:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC103(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L3447:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC102(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L3653:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC104(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE122:
+.L3469:
+	movq	112(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L3468:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC105(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB123:
+	call	__cxa_throw@PLT
+.LEHE123:
+.L3480:
+	movq	56(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L3482
+	movq	64(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	72(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L3482:
+	leaq	96(%rsp), %rbp
+	movq	%rbp, %rdi
+	call	_ZN1n4fileIcLNS_4modeE1EE5closeEv
+	movq	%rbp, %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB124:
+	call	_Unwind_Resume@PLT
+.L3407:
+	movl	%ebx, %edi
+	call	close@PLT
+.LEHE124:
+	jmp	.L3406
+	.cfi_endproc
+.LFE6948:
+	.section	.gcc_except_table
+.LLSDAC6948:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6948-.LLSDACSBC6948
+.LLSDACSBC6948:
+	.uleb128 .LEHB121-.LCOLDB108
+	.uleb128 .LEHE121-.LEHB121
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB122-.LCOLDB108
+	.uleb128 .LEHE122-.LEHB122
+	.uleb128 .L3545-.LCOLDB108
+	.uleb128 0
+	.uleb128 .LEHB123-.LCOLDB108
+	.uleb128 .LEHE123-.LEHB123
+	.uleb128 .L3545-.LCOLDB108
+	.uleb128 0
+	.uleb128 .LEHB124-.LCOLDB108
+	.uleb128 .LEHE124-.LEHB124
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6948:
+	.section	.text.unlikely
+	.text
+	.size	_Z14test_mmap_filev, .-_Z14test_mmap_filev
+	.section	.text.unlikely
+	.size	_Z14test_mmap_filev.cold, .-_Z14test_mmap_filev.cold
+.LCOLDE108:
+	.text
+.LHOTE108:
+	.p2align 4
+	.type	__tls_init, @function
+__tls_init:
+.LFB7215:
+	.cfi_startproc
+	cmpb	$0, %fs:__tls_guard@tpoff
+	jne	.L3700
+	cmpb	$0, %fs:_ZGVN1n10std_writerILi1EE7__localE@tpoff
+	movb	$1, %fs:__tls_guard@tpoff
+	je	.L3704
+.L3700:
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L3704:
+	movq	%fs:0, %rax
+	leaq	__dso_handle(%rip), %rdx
+	movb	$1, %fs:_ZGVN1n10std_writerILi1EE7__localE@tpoff
+	leaq	_ZN1n10std_writerILi1EE8__bufferD1Ev(%rip), %rdi
+	leaq	_ZN1n10std_writerILi1EE7__localE@tpoff(%rax), %rsi
+	jmp	__cxa_thread_atexit@PLT
+	.cfi_endproc
+.LFE7215:
+	.size	__tls_init, .-__tls_init
+	.weak	_ZTHN1n10std_writerILi1EE7__localE
+	.set	_ZTHN1n10std_writerILi1EE7__localE,__tls_init
+	.align 2
+	.p2align 4
+	.type	_ZN1n10std_writerILi1EE6appendEPKcm.isra.0, @function
+_ZN1n10std_writerILi1EE6appendEPKcm.isra.0:
+.LFB7252:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	call	_ZTHN1n10std_writerILi1EE7__localE
+	testq	%rbp, %rbp
+	je	.L3705
+	movq	%fs:16+_ZN1n10std_writerILi1EE7__localE@tpoff, %rbx
+	movq	%fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff, %rax
+	movq	%rbx, %rdx
+	subq	%rax, %rdx
+	cmpq	%rbp, %rdx
+	jb	.L3788
+.L3708:
+	movq	%fs:_ZN1n10std_writerILi1EE7__localE@tpoff, %r13
+.L3711:
+	leaq	0(%r13,%rax), %rdi
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	call	memcpy@PLT
+	movq	%fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff, %rbx
+	movzbl	%fs:32+_ZN1n10std_writerILi1EE7__localE@tpoff, %eax
+	addq	%rbp, %rbx
+	movq	%rbx, %fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff
+	testb	%al, %al
+	je	.L3789
+.L3743:
+	cmpq	$0, %fs:24+_ZN1n10std_writerILi1EE7__localE@tpoff
+	movb	%al, %fs:32+_ZN1n10std_writerILi1EE7__localE@tpoff
+	jne	.L3705
+	movl	_ZN1n10std_writerILi1EE8__policyE(%rip), %eax
+	cmpl	$2, %eax
+	je	.L3744
+	cmpl	$1, %eax
+	je	.L3790
+.L3705:
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L3788:
+	.cfi_restore_state
+	movl	_ZN1n10std_writerILi1EE8__policyE(%rip), %edx
+	cmpl	$3, %edx
+	je	.L3791
+	movq	%rax, %r13
+	testq	%rax, %rax
+	jne	.L3723
+.L3728:
+	movq	$0, %fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff
+	movb	$0, %fs:32+_ZN1n10std_writerILi1EE7__localE@tpoff
+	cmpq	$65535, %rbx
+	ja	.L3724
+	testq	%rbx, %rbx
+	jne	.L3731
+	movl	$65536, %ebx
+.L3730:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3792
+.L3733:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%rbx, %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%fs:_ZN1n10std_writerILi1EE7__localE@tpoff, %rsi
+	movq	%rax, %r13
+	testq	%rsi, %rsi
+	je	.L3735
+	movq	%fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff, %rdx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3793
+.L3737:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$64, %ecx
+	movq	%fs:16+_ZN1n10std_writerILi1EE7__localE@tpoff, %rdx
+	movq	%fs:_ZN1n10std_writerILi1EE7__localE@tpoff, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L3735:
+	movq	%r13, %fs:_ZN1n10std_writerILi1EE7__localE@tpoff
+	movq	%rbx, %fs:16+_ZN1n10std_writerILi1EE7__localE@tpoff
+.L3724:
+	cmpq	%rbx, %rbp
+	jnb	.L3739
+	movq	%fs:_ZN1n10std_writerILi1EE7__localE@tpoff, %r13
+	movq	%fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff, %rax
+	jmp	.L3711
+	.p2align 4,,10
+	.p2align 3
+.L3789:
+	movl	_ZN1n10std_writerILi1EE8__policyE(%rip), %edx
+	cmpl	$1, %edx
+	jne	.L3743
+	movq	%rbp, %rdx
+	movl	$10, %esi
+	movq	%r12, %rdi
+	call	memchr@PLT
+	testq	%rax, %rax
+	setne	%al
+	jmp	.L3743
+	.p2align 4,,10
+	.p2align 3
+.L3731:
+	addq	%rbx, %rbx
+	cmpq	$65535, %rbx
+	ja	.L3730
+	addq	%rbx, %rbx
+	cmpq	$65535, %rbx
+	jbe	.L3731
+	jmp	.L3730
+	.p2align 4,,10
+	.p2align 3
+.L3790:
+	cmpb	$0, %fs:32+_ZN1n10std_writerILi1EE7__localE@tpoff
+	je	.L3705
+.L3744:
+	testq	%rbx, %rbx
+	jne	.L3745
+.L3748:
+	movq	$0, %fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff
+	movb	$0, %fs:32+_ZN1n10std_writerILi1EE7__localE@tpoff
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L3794:
+	.cfi_restore_state
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L3705
+	.p2align 4,,10
+	.p2align 3
+.L3739:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	$1, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L3794
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L3739
+	jmp	.L3705
+	.p2align 4,,10
+	.p2align 3
+.L3723:
+	movq	%fs:_ZN1n10std_writerILi1EE7__localE@tpoff, %rbx
+.L3729:
+	movq	%r13, %rdx
+	movq	%rbx, %rsi
+	movl	$1, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L3795
+	addq	%rax, %rbx
+	subq	%rax, %r13
+	jne	.L3729
+	.p2align 4,,10
+	.p2align 3
+.L3786:
+	movq	%fs:16+_ZN1n10std_writerILi1EE7__localE@tpoff, %rbx
+	jmp	.L3728
+	.p2align 4,,10
+	.p2align 3
+.L3791:
+	leaq	0(%rbp,%rax), %rdx
+	cmpq	%rdx, %rbx
+	jnb	.L3708
+	testq	%rbx, %rbx
+	je	.L3712
+	.p2align 4,,10
+	.p2align 3
+.L3713:
+	addq	%rbx, %rbx
+	cmpq	%rdx, %rbx
+	jb	.L3713
+.L3714:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3796
+.L3717:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%rbx, %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%fs:_ZN1n10std_writerILi1EE7__localE@tpoff, %rsi
+	movq	%rax, %r13
+	testq	%rsi, %rsi
+	je	.L3719
+	movq	%fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff, %rdx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3797
+.L3721:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$64, %ecx
+	movq	%fs:16+_ZN1n10std_writerILi1EE7__localE@tpoff, %rdx
+	movq	%fs:_ZN1n10std_writerILi1EE7__localE@tpoff, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L3719:
+	movq	%r13, %fs:_ZN1n10std_writerILi1EE7__localE@tpoff
+	movq	%fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff, %rax
+	movq	%rbx, %fs:16+_ZN1n10std_writerILi1EE7__localE@tpoff
+	jmp	.L3711
+	.p2align 4,,10
+	.p2align 3
+.L3795:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L3786
+	jmp	.L3729
+	.p2align 4,,10
+	.p2align 3
+.L3712:
+	movl	$65536, %ebx
+	cmpq	$65536, %rdx
+	ja	.L3713
+	jmp	.L3714
+	.p2align 4,,10
+	.p2align 3
+.L3796:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3717
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r13, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3717
+	.p2align 4,,10
+	.p2align 3
+.L3792:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3733
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r13, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3733
+	.p2align 4,,10
+	.p2align 3
+.L3745:
+	movq	%fs:_ZN1n10std_writerILi1EE7__localE@tpoff, %rbp
+.L3749:
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movl	$1, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L3798
+	addq	%rax, %rbp
+	subq	%rax, %rbx
+	jne	.L3749
+	jmp	.L3748
+	.p2align 4,,10
+	.p2align 3
+.L3798:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L3748
+	jmp	.L3749
+	.p2align 4,,10
+	.p2align 3
+.L3793:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r14
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3737
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r14, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3737
+.L3797:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r14
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3721
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r14, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3721
+	.cfi_endproc
+.LFE7252:
+	.size	_ZN1n10std_writerILi1EE6appendEPKcm.isra.0, .-_ZN1n10std_writerILi1EE6appendEPKcm.isra.0
+	.section	.rodata.str1.1
+.LC109:
+	.string	"/dev/null"
+.LC110:
+	.string	"$\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC111:
+	.string	"expected true : WIFEXITED(status) and WEXITSTATUS(status) == 0"
+	.section	.text.unlikely
+.LCOLDB112:
+	.text
+.LHOTB112:
+	.p2align 4
+	.globl	_Z21test_file_stdout_exitv
+	.type	_Z21test_file_stdout_exitv, @function
+_Z21test_file_stdout_exitv:
+.LFB6934:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$56, %rsp
+	.cfi_def_cfa_offset 112
+	movq	stdout(%rip), %rdi
+	call	fflush@PLT
+	call	fork@PLT
+	testl	%eax, %eax
+	jne	.L3800
+	movl	$1, %esi
+	leaq	.LC109(%rip), %rdi
+	leaq	.LC110(%rip), %rbx
+	call	open@PLT
+	movl	$1, %esi
+	movl	%eax, %edi
+	call	dup2@PLT
+	movl	$36, %esi
+	movq	%rbx, %rdi
+	call	strchrnul@PLT
+	movq	%rax, %rsi
+	movq	%rax, %r12
+	movzbl	(%rax), %eax
+	subq	%rbx, %rsi
+	testb	%al, %al
+	jne	.L3801
+	.p2align 4,,10
+	.p2align 3
+.L3802:
+	movq	%rbx, %rdi
+	leaq	16(%rsp), %r13
+	leaq	17(%rsp), %rbp
+	call	_ZN1n10std_writerILi1EE6appendEPKcm.isra.0
+	movb	$50, 16(%rsp)
+	leaq	_ZN1n10std_writerILi1EE7__localE@tpoff, %rbx
+	.p2align 4,,10
+	.p2align 3
+.L3806:
+	movzbl	-1(%rbp), %eax
+	movb	%al, 15(%rsp)
+	call	_ZTHN1n10std_writerILi1EE7__localE
+	movq	%fs:8(%rbx), %rax
+	cmpq	%fs:16(%rbx), %rax
+	je	.L3833
+	movzbl	15(%rsp), %ecx
+	movq	%fs:(%rbx), %rdx
+	leaq	1(%rax), %rsi
+	movq	%rsi, %fs:8(%rbx)
+	movb	%cl, (%rdx,%rax)
+	movzbl	%fs:32(%rbx), %eax
+	testb	%al, %al
+	jne	.L3808
+	cmpb	$10, 15(%rsp)
+	sete	%al
+.L3808:
+	cmpq	$0, %fs:24(%rbx)
+	movb	%al, %fs:32(%rbx)
+	jne	.L3807
+	movl	_ZN1n10std_writerILi1EE8__policyE(%rip), %eax
+	cmpl	$2, %eax
+	je	.L3810
+	cmpl	$1, %eax
+	je	.L3834
+.L3807:
+	subq	$1, %rbp
+	cmpq	%r13, %rbp
+	jne	.L3806
+	movq	$-1, %rsi
+	movq	%r12, %rdi
+	call	strnlen@PLT
+	movq	%r12, %rdi
+	movq	%rax, %rsi
+	call	_ZN1n10std_writerILi1EE6appendEPKcm.isra.0
+	xorl	%edi, %edi
+	call	exit@PLT
+	.p2align 4,,10
+	.p2align 3
+.L3804:
+	addq	$1, %rsi
+	movzbl	(%rbx,%rsi), %eax
+	testb	%al, %al
+	je	.L3803
+.L3801:
+	cmpb	$36, %al
+	jne	.L3804
+	leaq	1(%rbx,%rsi), %r12
+	jmp	.L3802
+	.p2align 4,,10
+	.p2align 3
+.L3834:
+	cmpb	$0, %fs:32(%rbx)
+	je	.L3807
+.L3810:
+	movq	%fs:8(%rbx), %r15
+	testq	%r15, %r15
+	jne	.L3812
+.L3815:
+	movq	$0, %fs:8(%rbx)
+	movb	$0, %fs:32(%rbx)
+	jmp	.L3807
+	.p2align 4,,10
+	.p2align 3
+.L3800:
+	xorl	%edx, %edx
+	leaq	16(%rsp), %rsi
+	movl	%eax, %edi
+	movl	$0, 16(%rsp)
+	call	waitpid@PLT
+	movl	16(%rsp), %eax
+	movzbl	%ah, %edx
+	andl	$127, %eax
+	orl	%eax, %edx
+	jne	.L3828
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L3833:
+	.cfi_restore_state
+	leaq	15(%rsp), %rdi
+	movl	$1, %esi
+	call	_ZN1n10std_writerILi1EE6appendEPKcm.isra.0
+	jmp	.L3807
+	.p2align 4,,10
+	.p2align 3
+.L3803:
+	leaq	(%rbx,%rsi), %r12
+	jmp	.L3802
+	.p2align 4,,10
+	.p2align 3
+.L3812:
+	movq	%fs:(%rbx), %r14
+.L3816:
+	movq	%r15, %rdx
+	movq	%r14, %rsi
+	movl	$1, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L3835
+	addq	%rax, %r14
+	subq	%rax, %r15
+	jne	.L3816
+	jmp	.L3815
+	.p2align 4,,10
+	.p2align 3
+.L3835:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L3816
+	movq	$0, %fs:8(%rbx)
+	movb	$0, %fs:32(%rbx)
+	jmp	.L3807
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.type	_Z21test_file_stdout_exitv.cold, @function
+_Z21test_file_stdout_exitv.cold:
+.LFSB6934:
+.L3828:
+	.cfi_def_cfa_offset 112
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC111(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.cfi_endproc
+.LFE6934:
+	.text
+	.size	_Z21test_file_stdout_exitv, .-_Z21test_file_stdout_exitv
+	.section	.text.unlikely
+	.size	_Z21test_file_stdout_exitv.cold, .-_Z21test_file_stdout_exitv.cold
+.LCOLDE112:
+	.text
+.LHOTE112:
+	.section	.text.unlikely
+.LCOLDB113:
+	.section	.text.startup
+.LHOTB113:
+	.p2align 4
+	.type	_GLOBAL__sub_I__ZeqRKN1n6stringIcEEPKc, @function
+_GLOBAL__sub_I__ZeqRKN1n6stringIcEEPKc:
+.LFB7220:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7220
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$56, %rsp
+	.cfi_def_cfa_offset 80
+	cmpb	$0, _ZGVN1n4stdrE(%rip)
+	je	.L3844
+.L3837:
+	cmpb	$0, _ZGVN1n10std_writerILi1EE8__policyE(%rip)
+	je	.L3845
+.L3836:
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L3844:
+	.cfi_restore_state
+	movdqa	.LC46(%rip), %xmm0
+	movq	stdin(%rip), %rbx
+	xorl	%r8d, %r8d
+	xorl	%r9d, %r9d
+	movl	$4294967295, %eax
+	movb	$1, _ZGVN1n4stdrE(%rip)
+	leaq	_ZN1n4stdrE(%rip), %rbp
+	movq	%rax, _ZN1n4stdrE(%rip)
+	movq	$0, 8+_ZN1n4stdrE(%rip)
+	movq	%r8, 16+_ZN1n4stdrE(%rip)
+	movq	%r9, 40+_ZN1n4stdrE(%rip)
+	movups	%xmm0, 24+_ZN1n4stdrE(%rip)
+	testq	%rbx, %rbx
+	je	.L3846
+	movq	%rbx, %rdi
+	movq	%rbx, 48+_ZN1n4stdrE(%rip)
+	call	fileno@PLT
+	movq	%rbx, %rdi
+	call	fileno@PLT
+	xorl	%ecx, %ecx
+	xorl	%esi, %esi
+	movq	%rbp, %rdi
+	movdqa	.LC46(%rip), %xmm1
+	movl	%eax, (%rsp)
+	movl	%eax, %ebx
+	movw	$0, 4(%rsp)
+	movb	$0, 6(%rsp)
+	movq	$0, 8(%rsp)
+	movq	%rcx, 16(%rsp)
+	movq	%rsi, 40(%rsp)
+	movups	%xmm1, 24(%rsp)
+.LEHB125:
+	call	_ZN1n7fd_file5closeEv
+.LEHE125:
+	xorl	%eax, %eax
+	xorl	%edx, %edx
+	movdqa	.LC46(%rip), %xmm2
+	movl	%ebx, _ZN1n4stdrE(%rip)
+	movw	$0, 4+_ZN1n4stdrE(%rip)
+	movb	$0, 6+_ZN1n4stdrE(%rip)
+	movq	$0, 8+_ZN1n4stdrE(%rip)
+	movq	%rax, 16+_ZN1n4stdrE(%rip)
+	movq	%rdx, 40+_ZN1n4stdrE(%rip)
+	movups	%xmm2, 24+_ZN1n4stdrE(%rip)
+.L3839:
+	leaq	__dso_handle(%rip), %rdx
+	movq	%rbp, %rsi
+	leaq	_ZN1n4fileIcLNS_4modeE6EED1Ev(%rip), %rdi
+	call	__cxa_atexit@PLT
+	jmp	.L3837
+.L3845:
+	movl	$1, %edi
+	movb	$1, _ZGVN1n10std_writerILi1EE8__policyE(%rip)
+	call	isatty@PLT
+	testl	%eax, %eax
+	setne	%al
+	movzbl	%al, %eax
+	movl	%eax, _ZN1n10std_writerILi1EE8__policyE(%rip)
+	jmp	.L3836
+.L3846:
+	xorl	%edi, %edi
+	movq	%rdi, 48+_ZN1n4stdrE(%rip)
+	jmp	.L3839
+.L3842:
+	movq	%rax, %rbx
+	jmp	.L3840
+	.section	.gcc_except_table
+.LLSDA7220:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7220-.LLSDACSB7220
+.LLSDACSB7220:
+	.uleb128 .LEHB125-.LFB7220
+	.uleb128 .LEHE125-.LEHB125
+	.uleb128 .L3842-.LFB7220
+	.uleb128 0
+.LLSDACSE7220:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7220
+	.type	_GLOBAL__sub_I__ZeqRKN1n6stringIcEEPKc.cold, @function
+_GLOBAL__sub_I__ZeqRKN1n6stringIcEEPKc.cold:
+.LFSB7220:
+.L3840:
+	.cfi_def_cfa_offset 80
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movq	%rsp, %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbp, %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB126:
+	call	_Unwind_Resume@PLT
+.LEHE126:
+	.cfi_endproc
+.LFE7220:
+	.section	.gcc_except_table
+.LLSDAC7220:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7220-.LLSDACSBC7220
+.LLSDACSBC7220:
+	.uleb128 .LEHB126-.LCOLDB113
+	.uleb128 .LEHE126-.LEHB126
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC7220:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	_GLOBAL__sub_I__ZeqRKN1n6stringIcEEPKc, .-_GLOBAL__sub_I__ZeqRKN1n6stringIcEEPKc
+	.section	.text.unlikely
+	.size	_GLOBAL__sub_I__ZeqRKN1n6stringIcEEPKc.cold, .-_GLOBAL__sub_I__ZeqRKN1n6stringIcEEPKc.cold
+.LCOLDE113:
+	.section	.text.startup
+.LHOTE113:
+	.section	.init_array,"aw"
+	.align 8
+	.quad	_GLOBAL__sub_I__ZeqRKN1n6stringIcEEPKc
+	.weak	_ZGVN1n10std_writerILi1EE7__localE
+	.section	.tbss._ZGVN1n10std_writerILi1EE7__localE,"awTG",@nobits,_ZGVN1n10std_writerILi1EE7__localE,comdat
+	.align 8
+	.type	_ZGVN1n10std_writerILi1EE7__localE, @gnu_unique_object
+	.size	_ZGVN1n10std_writerILi1EE7__localE, 8
+_ZGVN1n10std_writerILi1EE7__localE:
+	.zero	8
+	.section	.tbss,"awT",@nobits
+	.type	__tls_guard, @object
+	.size	__tls_guard, 1
+__tls_guard:
+	.zero	1
+	.weak	_ZGVN1n10std_writerILi1EE8__policyE
+	.section	.bss._ZGVN1n10std_writerILi1EE8__policyE,"awG",@nobits,_ZGVN1n10std_writerILi1EE8__policyE,comdat
+	.align 8
+	.type	_ZGVN1n10std_writerILi1EE8__policyE, @gnu_unique_object
+	.size	_ZGVN1n10std_writerILi1EE8__policyE, 8
+_ZGVN1n10std_writerILi1EE8__policyE:
+	.zero	8
+	.weak	_ZGVN1n4stdrE
+	.section	.bss._ZGVN1n4stdrE,"awG",@nobits,_ZGVN1n4stdrE,comdat
+	.align 8
+	.type	_ZGVN1n4stdrE, @gnu_unique_object
+	.size	_ZGVN1n4stdrE, 8
+_ZGVN1n4stdrE:
+	.zero	8
+	.weak	_ZTSN1n15memory_resourceE
+	.section	.rodata._ZTSN1n15memory_resourceE,"aG",@progbits,_ZTSN1n15memory_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n15memory_resourceE, @object
+	.size	_ZTSN1n15memory_resourceE, 22
+_ZTSN1n15memory_resourceE:
+	.string	"N1n15memory_resourceE"
+	.weak	_ZTIN1n15memory_resourceE
+	.section	.data.rel.ro._ZTIN1n15memory_resourceE,"awG",@progbits,_ZTIN1n15memory_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n15memory_resourceE, @object
+	.size	_ZTIN1n15memory_resourceE, 16
+_ZTIN1n15memory_resourceE:
+	.quad	_ZTVN10__cxxabiv117__class_type_infoE+16
+	.quad	_ZTSN1n15memory_resourceE
+	.weak	_ZTSN1n13heap_resourceE
+	.section	.rodata._ZTSN1n13heap_resourceE,"aG",@progbits,_ZTSN1n13heap_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n13heap_resourceE, @object
+	.size	_ZTSN1n13heap_resourceE, 20
+_ZTSN1n13heap_resourceE:
+	.string	"N1n13heap_resourceE"
+	.weak	_ZTIN1n13heap_resourceE
+	.section	.data.rel.ro._ZTIN1n13heap_resourceE,"awG",@progbits,_ZTIN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n13heap_resourceE, @object
+	.size	_ZTIN1n13heap_resourceE, 24
+_ZTIN1n13heap_resourceE:
+	.quad	_ZTVN10__cxxabiv120__si_class_type_infoE+16
+	.quad	_ZTSN1n13heap_resourceE
+	.quad	_ZTIN1n15memory_resourceE
+	.weak	_ZTVN1n13heap_resourceE
+	.section	.data.rel.ro.local._ZTVN1n13heap_resourceE,"awG",@progbits,_ZTVN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTVN1n13heap_resourceE, @object
+	.size	_ZTVN1n13heap_resourceE, 48
+_ZTVN1n13heap_resourceE:
+	.quad	0
+	.quad	_ZTIN1n13heap_resourceE
+	.quad	_ZN1n13heap_resourceD1Ev
+	.quad	_ZN1n13heap_resourceD0Ev
+	.quad	_ZN1n13heap_resource8allocateEmm
+	.quad	_ZN1n13heap_resource10deallocateEPvmm
+	.weak	_ZN1n4stdrE
+	.section	.bss._ZN1n4stdrE,"awG",@nobits,_ZN1n4stdrE,comdat
+	.align 32
+	.type	_ZN1n4stdrE, @gnu_unique_object
+	.size	_ZN1n4stdrE, 56
+_ZN1n4stdrE:
+	.zero	56
+	.weak	_ZN1n10std_writerILi1EE8__policyE
+	.section	.bss._ZN1n10std_writerILi1EE8__policyE,"awG",@nobits,_ZN1n10std_writerILi1EE8__policyE,comdat
+	.align 4
+	.type	_ZN1n10std_writerILi1EE8__policyE, @gnu_unique_object
+	.size	_ZN1n10std_writerILi1EE8__policyE, 4
+_ZN1n10std_writerILi1EE8__policyE:
+	.zero	4
+	.weak	_ZN1n10std_writerILi1EE7__localE
+	.section	.tbss._ZN1n10std_writerILi1EE7__localE,"awTG",@nobits,_ZN1n10std_writerILi1EE7__localE,comdat
+	.align 8
+	.type	_ZN1n10std_writerILi1EE7__localE, @gnu_unique_object
+	.size	_ZN1n10std_writerILi1EE7__localE, 40
+_ZN1n10std_writerILi1EE7__localE:
+	.zero	40
+	.weak	_ZN1n18__current_resourceE
+	.section	.tbss._ZN1n18__current_resourceE,"awTG",@nobits,_ZN1n18__current_resourceE,comdat
+	.align 8
+	.type	_ZN1n18__current_resourceE, @gnu_unique_object
+	.size	_ZN1n18__current_resourceE, 8
+_ZN1n18__current_resourceE:
+	.zero	8
+	.weak	_ZGVZN1n4heapEvE3res
+	.section	.bss._ZGVZN1n4heapEvE3res,"awG",@nobits,_ZGVZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZGVZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZGVZN1n4heapEvE3res, 8
+_ZGVZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE3res
+	.section	.bss._ZZN1n4heapEvE3res,"awG",@nobits,_ZZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZZN1n4heapEvE3res, 8
+_ZZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE7storage
+	.section	.bss._ZZN1n4heapEvE7storage,"awG",@nobits,_ZZN1n4heapEvE7storage,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE7storage, @gnu_unique_object
+	.size	_ZZN1n4heapEvE7storage, 8
+_ZZN1n4heapEvE7storage:
+	.zero	8
+	.weak	_ZGVZN1n9simd_bestEvE4best
+	.section	.bss._ZGVZN1n9simd_bestEvE4best,"awG",@nobits,_ZGVZN1n9simd_bestEvE4best,comdat
+	.align 8
+	.type	_ZGVZN1n9simd_bestEvE4best, @gnu_unique_object
+	.size	_ZGVZN1n9simd_bestEvE4best, 8
+_ZGVZN1n9simd_bestEvE4best:
+	.zero	8
+	.weak	_ZZN1n9simd_bestEvE4best
+	.section	.bss._ZZN1n9simd_bestEvE4best,"awG",@nobits,_ZZN1n9simd_bestEvE4best,comdat
+	.align 4
+	.type	_ZZN1n9simd_bestEvE4best, @gnu_unique_object
+	.size	_ZZN1n9simd_bestEvE4best, 4
+_ZZN1n9simd_bestEvE4best:
+	.zero	4
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC4:
+	.long	0
+	.long	1070596096
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC13:
+	.quad	10
+	.quad	11
+	.align 16
+.LC14:
+	.quad	12
+	.quad	400
+	.align 16
+.LC15:
+	.quad	2000
+	.quad	401
+	.align 16
+.LC20:
+	.quad	300
+	.quad	301
+	.set	.LC25,.LC13
+	.section	.rodata.cst8
+	.align 8
+.LC44:
+	.long	10
+	.long	100
+	.section	.rodata.cst16
+	.align 16
+.LC46:
+	.quad	65536
+	.quad	0
+	.set	.LC64,.LC46+2
+	.align 16
+.LC65:
+	.quad	0
+	.quad	23
+	.align 16
+.LC85:
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.hidden	DW.ref._ZTIPKc
+	.weak	DW.ref._ZTIPKc
+	.section	.data.rel.local.DW.ref._ZTIPKc,"awG",@progbits,DW.ref._ZTIPKc,comdat
+	.align 8
+	.type	DW.ref._ZTIPKc, @object
+	.size	DW.ref._ZTIPKc, 8
+DW.ref._ZTIPKc:
+	.quad	_ZTIPKc
+	.hidden	DW.ref.__gxx_personality_v0
+	.weak	DW.ref.__gxx_personality_v0
+	.section	.data.rel.local.DW.ref.__gxx_personality_v0,"awG",@progbits,DW.ref.__gxx_personality_v0,comdat
+	.align 8
+	.type	DW.ref.__gxx_personality_v0, @object
+	.size	DW.ref.__gxx_personality_v0, 8
+DW.ref.__gxx_personality_v0:
+	.quad	__gxx_personality_v0
+	.hidden	__dso_handle
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
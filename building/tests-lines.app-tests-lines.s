@@ -0,0 +1,7404 @@
+	.file	"tests-lines.cpp"
+	.text
+	.section	.text._ZN1n13heap_resourceD2Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD2Ev
+	.type	_ZN1n13heap_resourceD2Ev, @function
+_ZN1n13heap_resourceD2Ev:
+.LFB7014:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7014:
+	.size	_ZN1n13heap_resourceD2Ev, .-_ZN1n13heap_resourceD2Ev
+	.weak	_ZN1n13heap_resourceD1Ev
+	.set	_ZN1n13heap_resourceD1Ev,_ZN1n13heap_resourceD2Ev
+	.section	.text._ZN1n13heap_resource8allocateEmm,"axG",@progbits,_ZN1n13heap_resource8allocateEmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource8allocateEmm
+	.type	_ZN1n13heap_resource8allocateEmm, @function
+_ZN1n13heap_resource8allocateEmm:
+.LFB55:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rdx
+	jbe	.L4
+	movq	%rdx, %rsi
+	jmp	_ZnwmSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	jmp	_Znwm@PLT
+	.cfi_endproc
+.LFE55:
+	.size	_ZN1n13heap_resource8allocateEmm, .-_ZN1n13heap_resource8allocateEmm
+	.section	.text._ZN1n13heap_resource10deallocateEPvmm,"axG",@progbits,_ZN1n13heap_resource10deallocateEPvmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource10deallocateEPvmm
+	.type	_ZN1n13heap_resource10deallocateEPvmm, @function
+_ZN1n13heap_resource10deallocateEPvmm:
+.LFB56:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rcx
+	jbe	.L6
+	movq	%rcx, %rsi
+	jmp	_ZdlPvSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	jmp	_ZdlPv@PLT
+	.cfi_endproc
+.LFE56:
+	.size	_ZN1n13heap_resource10deallocateEPvmm, .-_ZN1n13heap_resource10deallocateEPvmm
+	.section	.text._ZN1n13heap_resourceD0Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD0Ev
+	.type	_ZN1n13heap_resourceD0Ev, @function
+_ZN1n13heap_resourceD0Ev:
+.LFB7016:
+	.cfi_startproc
+	movl	$8, %esi
+	jmp	_ZdlPvm@PLT
+	.cfi_endproc
+.LFE7016:
+	.size	_ZN1n13heap_resourceD0Ev, .-_ZN1n13heap_resourceD0Ev
+	.section	.text._ZN1n4fileIcLNS_4modeE6EED2Ev,"axG",@progbits,_ZN1n4fileIcLNS_4modeE6EED5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4fileIcLNS_4modeE6EED2Ev
+	.type	_ZN1n4fileIcLNS_4modeE6EED2Ev, @function
+_ZN1n4fileIcLNS_4modeE6EED2Ev:
+.LFB6922:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6922
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movl	(%rdi), %ebp
+	testl	%ebp, %ebp
+	js	.L9
+	cmpl	$2, 8(%rdi)
+	je	.L59
+.L10:
+	cmpb	$0, 4(%rbx)
+	jne	.L60
+.L15:
+	movl	$-1, (%rbx)
+.L9:
+	cmpq	$0, 16(%rbx)
+	je	.L16
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L61
+.L18:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	$0, 16(%rbx)
+.L16:
+	movq	48(%rbx), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 8(%rbx)
+	movups	%xmm0, 32(%rbx)
+	testq	%rdi, %rdi
+	je	.L20
+	call	fclose@PLT
+	movl	(%rbx), %ebp
+	movq	$0, 48(%rbx)
+	testl	%ebp, %ebp
+	js	.L57
+	cmpl	$2, 8(%rbx)
+	jne	.L24
+	movq	40(%rbx), %r12
+	testq	%r12, %r12
+	jne	.L62
+.L24:
+	cmpb	$0, 4(%rbx)
+	jne	.L63
+.L30:
+	movl	$-1, (%rbx)
+.L57:
+	movq	16(%rbx), %rax
+	testq	%rax, %rax
+	je	.L8
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L64
+.L33:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L8:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L59:
+	.cfi_restore_state
+	movq	40(%rdi), %r12
+	testq	%r12, %r12
+	je	.L10
+	movq	16(%rdi), %r13
+.L14:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L65
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L14
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	movq	$0, 40(%rbx)
+	jmp	.L10
+	.p2align 4,,10
+	.p2align 3
+.L20:
+	movl	(%rbx), %eax
+	testl	%eax, %eax
+	js	.L8
+	cmpb	$0, 4(%rbx)
+	je	.L30
+.L63:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L30
+	.p2align 4,,10
+	.p2align 3
+.L60:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L15
+	.p2align 4,,10
+	.p2align 3
+.L64:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L33
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L33
+	.p2align 4,,10
+	.p2align 3
+.L61:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L18
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L18
+	.p2align 4,,10
+	.p2align 3
+.L62:
+	movq	16(%rbx), %r13
+.L29:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L66
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L29
+	.p2align 4,,10
+	.p2align 3
+.L28:
+	movq	$0, 40(%rbx)
+	jmp	.L24
+	.p2align 4,,10
+	.p2align 3
+.L65:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L13
+	jmp	.L14
+	.p2align 4,,10
+	.p2align 3
+.L66:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L28
+	jmp	.L29
+	.cfi_endproc
+.LFE6922:
+	.globl	__gxx_personality_v0
+	.section	.gcc_except_table._ZN1n4fileIcLNS_4modeE6EED2Ev,"aG",@progbits,_ZN1n4fileIcLNS_4modeE6EED5Ev,comdat
+.LLSDA6922:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6922-.LLSDACSB6922
+.LLSDACSB6922:
+.LLSDACSE6922:
+	.section	.text._ZN1n4fileIcLNS_4modeE6EED2Ev,"axG",@progbits,_ZN1n4fileIcLNS_4modeE6EED5Ev,comdat
+	.size	_ZN1n4fileIcLNS_4modeE6EED2Ev, .-_ZN1n4fileIcLNS_4modeE6EED2Ev
+	.weak	_ZN1n4fileIcLNS_4modeE6EED1Ev
+	.set	_ZN1n4fileIcLNS_4modeE6EED1Ev,_ZN1n4fileIcLNS_4modeE6EED2Ev
+	.section	.text._ZN1n7fd_file5closeEv,"axG",@progbits,_ZN1n7fd_file5closeEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n7fd_file5closeEv
+	.type	_ZN1n7fd_file5closeEv, @function
+_ZN1n7fd_file5closeEv:
+.LFB153:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movl	(%rdi), %ebp
+	testl	%ebp, %ebp
+	js	.L68
+	cmpl	$2, 8(%rdi)
+	je	.L89
+.L69:
+	cmpb	$0, 4(%rbx)
+	jne	.L90
+.L74:
+	movl	$-1, (%rbx)
+.L68:
+	cmpq	$0, 16(%rbx)
+	je	.L75
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L91
+.L77:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	$0, 16(%rbx)
+.L75:
+	pxor	%xmm0, %xmm0
+	movl	$0, 8(%rbx)
+	movups	%xmm0, 32(%rbx)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L89:
+	.cfi_restore_state
+	movq	40(%rdi), %r12
+	testq	%r12, %r12
+	je	.L69
+	movq	16(%rdi), %r13
+.L73:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L92
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L73
+	.p2align 4,,10
+	.p2align 3
+.L72:
+	movq	$0, 40(%rbx)
+	jmp	.L69
+	.p2align 4,,10
+	.p2align 3
+.L90:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L74
+	.p2align 4,,10
+	.p2align 3
+.L91:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L77
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L77
+	.p2align 4,,10
+	.p2align 3
+.L92:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L72
+	jmp	.L73
+	.cfi_endproc
+.LFE153:
+	.size	_ZN1n7fd_file5closeEv, .-_ZN1n7fd_file5closeEv
+	.section	.rodata._ZN1n4test10test_suite7run_allEv.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"\nSUITE [%s] "
+.LC2:
+	.string	"%s"
+.LC3:
+	.string	"\nTEST [%s] "
+.LC4:
+	.string	" - Result : \033[1;32mPASSED\033[0m"
+.LC5:
+	.string	"\033[1;31merror : %s\033[0m\n"
+.LC6:
+	.string	" - Result : \033[1;31mFAILED\033[0m"
+.LC7:
+	.string	" - Passed : \033[1;32m%d\033[0m\n"
+.LC8:
+	.string	" - Failed : \033[1;31m%d\033[0m\n"
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4test10test_suite7run_allEv
+	.type	_ZN1n4test10test_suite7run_allEv, @function
+_ZN1n4test10test_suite7run_allEv:
+.LFB6887:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6887
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rdx
+	movl	$79, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	16(%rdi), %rcx
+	leaq	16(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L94
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L95
+	testb	$4, %cl
+	jne	.L148
+	testl	%ecx, %ecx
+	je	.L94
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L149
+	.p2align 4,,10
+	.p2align 3
+.L94:
+	movzwl	.LC1(%rip), %r15d
+	movq	%rbx, %rsi
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+.LEHB0:
+	call	printf@PLT
+	movl	8(%r12), %esi
+	testl	%esi, %esi
+	jle	.L115
+	movl	$0, 12(%rsp)
+	xorl	%ebp, %ebp
+	xorl	%r14d, %r14d
+	jmp	.L109
+	.p2align 4,,10
+	.p2align 3
+.L152:
+	testb	$4, %dl
+	jne	.L150
+	testl	%edx, %edx
+	je	.L100
+	movb	$42, (%rax)
+	testb	$2, %dl
+	jne	.L151
+	.p2align 4,,10
+	.p2align 3
+.L100:
+	movq	%rbx, %rsi
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+.LEHE0:
+	movq	(%r12), %rax
+.LEHB1:
+	call	*8(%rax,%r13)
+.LEHE1:
+	leaq	.LC4(%rip), %rdi
+	addl	$1, %r14d
+.LEHB2:
+	call	puts@PLT
+.L105:
+	addq	$1, %rbp
+	cmpl	%ebp, 8(%r12)
+	jle	.L99
+.L109:
+	movq	(%r12), %rax
+	movq	%rbp, %r13
+	movq	%rbx, %rdi
+	movl	$79, %esi
+	salq	$4, %r13
+	leaq	.LC3(%rip), %rdx
+	movq	(%rax,%r13), %rcx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L100
+	movl	$79, %edx
+	subl	%eax, %edx
+	addq	%rbx, %rax
+	cmpl	$8, %edx
+	jb	.L152
+	movabsq	$3038287259199220266, %rsi
+	leaq	8(%rax), %rdi
+	movl	%edx, %ecx
+	andq	$-8, %rdi
+	movq	%rsi, (%rax)
+	movq	%rsi, -8(%rax,%rcx)
+	subq	%rdi, %rax
+	leal	(%rdx,%rax), %ecx
+	movq	%rsi, %rax
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L100
+.L115:
+	movl	$0, 12(%rsp)
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L99:
+	movabsq	$5917806138674729738, %rax
+	movq	%rbx, %rdi
+	movq	%rax, 16(%rsp)
+	movabsq	$9095440486453792, %rax
+	movq	%rax, 22(%rsp)
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L110
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L111
+	testb	$4, %cl
+	jne	.L153
+	testl	%ecx, %ecx
+	je	.L110
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L154
+.L110:
+	movq	%rbx, %rsi
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+	movl	%r14d, %esi
+	leaq	.LC7(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	12(%rsp), %esi
+	leaq	.LC8(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	$10, %edi
+	call	putchar@PLT
+.LEHE2:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L111:
+	.cfi_restore_state
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L110
+.L95:
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L94
+.L150:
+	movl	$707406378, (%rax)
+	movl	$707406378, -4(%rax,%rdx)
+	jmp	.L100
+.L151:
+	movl	$10794, %ecx
+	movw	%cx, -2(%rax,%rdx)
+	jmp	.L100
+.L149:
+	movl	$10794, %edi
+	movw	%di, -2(%rdx,%rcx)
+	jmp	.L94
+.L154:
+	movl	$10794, %eax
+	movw	%ax, -2(%rdx,%rcx)
+	jmp	.L110
+.L148:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L94
+.L153:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L110
+.L116:
+	movq	%rax, %rdi
+	movq	%rdx, %rax
+.L106:
+	subq	$1, %rax
+	jne	.L147
+	call	__cxa_begin_catch@PLT
+	leaq	.LC5(%rip), %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+.LEHB3:
+	call	printf@PLT
+.LEHE3:
+	call	__cxa_end_catch@PLT
+	leaq	.LC6(%rip), %rdi
+	addl	$1, 12(%rsp)
+.LEHB4:
+	call	puts@PLT
+	jmp	.L105
+.L108:
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+.L147:
+	call	_Unwind_Resume@PLT
+.LEHE4:
+.L117:
+	movq	%rax, %rbx
+	jmp	.L108
+	.cfi_endproc
+.LFE6887:
+	.section	.gcc_except_table._ZN1n4test10test_suite7run_allEv,"aG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.align 4
+.LLSDA6887:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT6887-.LLSDATTD6887
+.LLSDATTD6887:
+	.byte	0x1
+	.uleb128 .LLSDACSE6887-.LLSDACSB6887
+.LLSDACSB6887:
+	.uleb128 .LEHB0-.LFB6887
+	.uleb128 .LEHE0-.LEHB0
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB1-.LFB6887
+	.uleb128 .LEHE1-.LEHB1
+	.uleb128 .L116-.LFB6887
+	.uleb128 0x1
+	.uleb128 .LEHB2-.LFB6887
+	.uleb128 .LEHE2-.LEHB2
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB3-.LFB6887
+	.uleb128 .LEHE3-.LEHB3
+	.uleb128 .L117-.LFB6887
+	.uleb128 0
+	.uleb128 .LEHB4-.LFB6887
+	.uleb128 .LEHE4-.LEHB4
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6887:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	DW.ref._ZTIPKc-.
+.LLSDATT6887:
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.size	_ZN1n4test10test_suite7run_allEv, .-_ZN1n4test10test_suite7run_allEv
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC9:
+	.string	"n::lines tests"
+.LC10:
+	.string	"test_lines_in_memory"
+.LC11:
+	.string	"test_lines_of_file"
+.LC12:
+	.string	"test_lines_across_refills"
+.LC13:
+	.string	"test_lines_empty"
+	.section	.text.unlikely,"ax",@progbits
+.LCOLDB15:
+	.section	.text.startup,"ax",@progbits
+.LHOTB15:
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB6906:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6906
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$1600, %edi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 64
+.LEHB5:
+	call	_Znam@PLT
+.LEHE5:
+	movq	%rax, %rbx
+	leaq	1600(%rax), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L156:
+	movq	$0, (%rax)
+	addq	$16, %rax
+	movq	$0, -8(%rax)
+	cmpq	%rax, %rdx
+	jne	.L156
+	leaq	.LC9(%rip), %rax
+	movq	%rsp, %rdi
+	movq	%rbx, (%rsp)
+	movq	%rax, 16(%rsp)
+	leaq	.LC10(%rip), %rax
+	movq	%rax, (%rbx)
+	leaq	_Z20test_lines_in_memoryv(%rip), %rax
+	movq	%rax, 8(%rbx)
+	leaq	.LC11(%rip), %rax
+	movq	%rax, 16(%rbx)
+	leaq	_Z18test_lines_of_filev(%rip), %rax
+	movq	%rax, 24(%rbx)
+	leaq	.LC12(%rip), %rax
+	movq	%rax, 32(%rbx)
+	leaq	_Z25test_lines_across_refillsv(%rip), %rax
+	movq	%rax, 40(%rbx)
+	leaq	.LC13(%rip), %rax
+	movq	%rax, 48(%rbx)
+	leaq	_Z16test_lines_emptyv(%rip), %rax
+	movq	%rax, 56(%rbx)
+	movq	.LC14(%rip), %rax
+	movq	%rax, 8(%rsp)
+.LEHB6:
+	call	_ZN1n4test10test_suite7run_allEv
+.LEHE6:
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L158:
+	.cfi_restore_state
+	movq	%rax, %rbp
+	jmp	.L157
+	.section	.gcc_except_table,"a",@progbits
+.LLSDA6906:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6906-.LLSDACSB6906
+.LLSDACSB6906:
+	.uleb128 .LEHB5-.LFB6906
+	.uleb128 .LEHE5-.LEHB5
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB6-.LFB6906
+	.uleb128 .LEHE6-.LEHB6
+	.uleb128 .L158-.LFB6906
+	.uleb128 0
+.LLSDACSE6906:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6906
+	.type	main.cold, @function
+main.cold:
+.LFSB6906:
+.L157:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	movq	%rbp, %rdi
+.LEHB7:
+	call	_Unwind_Resume@PLT
+.LEHE7:
+	.cfi_endproc
+.LFE6906:
+	.section	.gcc_except_table
+.LLSDAC6906:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6906-.LLSDACSBC6906
+.LLSDACSBC6906:
+	.uleb128 .LEHB7-.LCOLDB15
+	.uleb128 .LEHE7-.LEHB7
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6906:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	main, .-main
+	.section	.text.unlikely
+	.size	main.cold, .-main.cold
+.LCOLDE15:
+	.section	.text.startup
+.LHOTE15:
+	.section	.text._ZN1n4fileIcLNS_4modeE1EE5closeEv,"axG",@progbits,_ZN1n4fileIcLNS_4modeE1EE5closeEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4fileIcLNS_4modeE1EE5closeEv
+	.type	_ZN1n4fileIcLNS_4modeE1EE5closeEv, @function
+_ZN1n4fileIcLNS_4modeE1EE5closeEv:
+.LFB6976:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movl	(%rdi), %ebp
+	testl	%ebp, %ebp
+	js	.L164
+	cmpl	$2, 8(%rdi)
+	je	.L189
+.L165:
+	cmpb	$0, 4(%rbx)
+	jne	.L190
+.L170:
+	movl	$-1, (%rbx)
+.L164:
+	cmpq	$0, 16(%rbx)
+	je	.L171
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L191
+.L173:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	$0, 16(%rbx)
+.L171:
+	movq	48(%rbx), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 8(%rbx)
+	movups	%xmm0, 32(%rbx)
+	testq	%rdi, %rdi
+	je	.L163
+	call	fclose@PLT
+	movq	$0, 48(%rbx)
+.L163:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L189:
+	.cfi_restore_state
+	movq	40(%rdi), %r12
+	testq	%r12, %r12
+	je	.L165
+	movq	16(%rdi), %r13
+.L169:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L192
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L169
+	.p2align 4,,10
+	.p2align 3
+.L168:
+	movq	$0, 40(%rbx)
+	jmp	.L165
+	.p2align 4,,10
+	.p2align 3
+.L190:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L170
+	.p2align 4,,10
+	.p2align 3
+.L191:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L173
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L173
+	.p2align 4,,10
+	.p2align 3
+.L192:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L168
+	jmp	.L169
+	.cfi_endproc
+.LFE6976:
+	.size	_ZN1n4fileIcLNS_4modeE1EE5closeEv, .-_ZN1n4fileIcLNS_4modeE1EE5closeEv
+	.section	.text.unlikely
+.LCOLDB18:
+	.text
+.LHOTB18:
+	.p2align 4
+	.globl	_Z10write_fileRKN1n6stringIcEE
+	.type	_Z10write_fileRKN1n6stringIcEE, @function
+_Z10write_fileRKN1n6stringIcEE:
+.LFB6888:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6888
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	movl	$438, %edx
+	movl	$524865, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	movq	path(%rip), %rdi
+.LEHB8:
+	call	open@PLT
+.LEHE8:
+	cmpq	$23, 8(%rbp)
+	movb	$0, 6(%rsp)
+	movl	%eax, (%rsp)
+	movl	%eax, %ebx
+	movq	0(%rbp), %r12
+	movzwl	.LC16(%rip), %eax
+	movdqa	.LC17(%rip), %xmm0
+	movq	$0, 8(%rsp)
+	movq	$0, 16(%rsp)
+	movw	%ax, 4(%rsp)
+	movq	$0, 40(%rsp)
+	movq	$0, 48(%rsp)
+	movups	%xmm0, 24(%rsp)
+	je	.L280
+	movq	24(%rbp), %rbp
+.L195:
+	testl	%ebx, %ebx
+	js	.L193
+	testq	%r12, %r12
+	je	.L196
+	movl	$2, 8(%rsp)
+	cmpq	$65535, %r12
+	jbe	.L197
+.L201:
+	movq	%r12, %rdx
+	movq	%rbp, %rsi
+	movl	%ebx, %edi
+.LEHB9:
+	call	write@PLT
+.LEHE9:
+	testq	%rax, %rax
+	js	.L281
+	addq	%rax, %rbp
+	subq	%rax, %r12
+	jne	.L201
+	.p2align 4,,10
+	.p2align 3
+.L238:
+	xorl	%r13d, %r13d
+.L200:
+	cmpl	$2, 8(%rsp)
+	movzbl	4(%rsp), %r14d
+	jne	.L222
+	movq	40(%rsp), %rbp
+	testq	%rbp, %rbp
+	jne	.L282
+.L222:
+	testb	%r14b, %r14b
+	jne	.L283
+.L227:
+	movl	$-1, (%rsp)
+	movl	$-1, %ebx
+.L217:
+	testq	%r13, %r13
+	je	.L279
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L284
+.L231:
+	movq	24(%rsp), %rdx
+	movq	16(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movl	(%rsp), %ebx
+	jmp	.L279
+	.p2align 4,,10
+	.p2align 3
+.L196:
+	testl	%ebx, %ebx
+	js	.L193
+	movl	%ebx, %edi
+	movl	$-1, %ebx
+	call	close@PLT
+.L279:
+	movq	48(%rsp), %rdi
+	testq	%rdi, %rdi
+	je	.L233
+	call	fclose@PLT
+.L233:
+	testl	%ebx, %ebx
+	js	.L193
+	cmpb	$0, 4(%rsp)
+	jne	.L285
+.L193:
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L280:
+	.cfi_restore_state
+	addq	$24, %rbp
+	jmp	.L195
+	.p2align 4,,10
+	.p2align 3
+.L281:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L238
+	jmp	.L201
+	.p2align 4,,10
+	.p2align 3
+.L285:
+	movl	%ebx, %edi
+	call	close@PLT
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L284:
+	.cfi_restore_state
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L231
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L231
+	.p2align 4,,10
+	.p2align 3
+.L282:
+	movq	%r13, %r12
+.L226:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L286
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L226
+	.p2align 4,,10
+	.p2align 3
+.L225:
+	movq	$0, 40(%rsp)
+	jmp	.L222
+	.p2align 4,,10
+	.p2align 3
+.L286:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L225
+	jmp	.L226
+	.p2align 4,,10
+	.p2align 3
+.L197:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L287
+.L203:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rsp), %r15
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%r15, %rsi
+.LEHB10:
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	movl	(%rsp), %ebx
+	movq	%rax, %r13
+	testq	%rax, %rax
+	je	.L239
+	movq	40(%rsp), %r14
+	movq	%r15, %rax
+	subq	%r14, %rax
+	cmpq	%r12, %rax
+	jnb	.L243
+	cmpl	$2, 8(%rsp)
+	jne	.L243
+	testq	%r14, %r14
+	jne	.L240
+.L243:
+	leaq	0(%r13,%r14), %rdi
+	addq	%r12, %r14
+.L207:
+	movq	%r12, %rdx
+	movq	%rbp, %rsi
+	call	memcpy@PLT
+	movq	%r14, 40(%rsp)
+.L212:
+	movl	12(%rsp), %eax
+	cmpl	$2, %eax
+	je	.L215
+	cmpl	$1, %eax
+	je	.L288
+.L216:
+	testl	%ebx, %ebx
+	js	.L217
+	jmp	.L200
+	.p2align 4,,10
+	.p2align 3
+.L288:
+	movq	%r12, %rdx
+	movl	$10, %esi
+	movq	%rbp, %rdi
+	call	memchr@PLT
+	testq	%rax, %rax
+	je	.L216
+.L215:
+	cmpl	$2, 8(%rsp)
+	jne	.L216
+	movq	40(%rsp), %rbp
+	testq	%rbp, %rbp
+	je	.L216
+	movq	%r13, %r12
+.L221:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L289
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L221
+	.p2align 4,,10
+	.p2align 3
+.L220:
+	movq	$0, 40(%rsp)
+	jmp	.L216
+.L239:
+	movq	%r12, %r14
+	movq	%rbp, %r15
+.L205:
+	movq	%r14, %rdx
+	movq	%r15, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L290
+	addq	%rax, %r15
+	subq	%rax, %r14
+	jne	.L205
+	jmp	.L212
+	.p2align 4,,10
+	.p2align 3
+.L290:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L212
+	jmp	.L205
+	.p2align 4,,10
+	.p2align 3
+.L289:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L220
+	jmp	.L221
+.L287:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L203
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L203
+.L240:
+	movq	%r13, %r15
+.L208:
+	movq	%r14, %rdx
+	movq	%r15, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+.LEHE10:
+	testq	%rax, %rax
+	js	.L291
+	addq	%rax, %r15
+	subq	%rax, %r14
+	jne	.L208
+.L278:
+	movq	%r12, %r14
+	movq	%r13, %rdi
+	jmp	.L207
+.L291:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L278
+	jmp	.L208
+.L283:
+	movl	%ebx, %edi
+	call	close@PLT
+	jmp	.L227
+.L242:
+	movq	%rax, %rbx
+	jmp	.L236
+	.section	.gcc_except_table
+.LLSDA6888:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6888-.LLSDACSB6888
+.LLSDACSB6888:
+	.uleb128 .LEHB8-.LFB6888
+	.uleb128 .LEHE8-.LEHB8
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB9-.LFB6888
+	.uleb128 .LEHE9-.LEHB9
+	.uleb128 .L242-.LFB6888
+	.uleb128 0
+	.uleb128 .LEHB10-.LFB6888
+	.uleb128 .LEHE10-.LEHB10
+	.uleb128 .L242-.LFB6888
+	.uleb128 0
+.LLSDACSE6888:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6888
+	.type	_Z10write_fileRKN1n6stringIcEE.cold, @function
+_Z10write_fileRKN1n6stringIcEE.cold:
+.LFSB6888:
+.L236:
+	.cfi_def_cfa_offset 128
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	%rsp, %rbp
+	movq	%rbp, %rdi
+	call	_ZN1n4fileIcLNS_4modeE1EE5closeEv
+	movq	%rbp, %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB11:
+	call	_Unwind_Resume@PLT
+.LEHE11:
+	.cfi_endproc
+.LFE6888:
+	.section	.gcc_except_table
+.LLSDAC6888:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6888-.LLSDACSBC6888
+.LLSDACSBC6888:
+	.uleb128 .LEHB11-.LCOLDB18
+	.uleb128 .LEHE11-.LEHB11
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6888:
+	.section	.text.unlikely
+	.text
+	.size	_Z10write_fileRKN1n6stringIcEE, .-_Z10write_fileRKN1n6stringIcEE
+	.section	.text.unlikely
+	.size	_Z10write_fileRKN1n6stringIcEE.cold, .-_Z10write_fileRKN1n6stringIcEE.cold
+.LCOLDE18:
+	.text
+.LHOTE18:
+	.section	.text._ZN1n6vectorINS_6stringIcEEE9__releaseEv,"axG",@progbits,_ZN1n6vectorINS_6stringIcEEE9__releaseEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n6vectorINS_6stringIcEEE9__releaseEv
+	.type	_ZN1n6vectorINS_6stringIcEEE9__releaseEv, @function
+_ZN1n6vectorINS_6stringIcEEE9__releaseEv:
+.LFB6988:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6988
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movq	16(%rdi), %rbp
+	movq	(%rdi), %rsi
+	testq	%rbp, %rbp
+	je	.L293
+	movq	%rsi, %rbx
+	xorl	%r13d, %r13d
+	.p2align 4,,10
+	.p2align 3
+.L297:
+	movq	8(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L294
+	movq	16(%rbx), %rdi
+	addq	$1, %r13
+	movq	24(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	addq	$48, %rbx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	%r13, %rbp
+	jne	.L297
+.L296:
+	movq	(%r12), %rsi
+.L293:
+	testq	%rsi, %rsi
+	je	.L298
+	movq	8(%r12), %rax
+	movq	24(%r12), %rdi
+	movl	$8, %ecx
+	leaq	(%rax,%rax,2), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+.LEHB12:
+	call	*24(%rax)
+.LEHE12:
+.L298:
+	pxor	%xmm0, %xmm0
+	movq	$0, (%r12)
+	movups	%xmm0, 8(%r12)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L294:
+	.cfi_restore_state
+	addq	$1, %r13
+	addq	$48, %rbx
+	cmpq	%r13, %rbp
+	jne	.L297
+	jmp	.L296
+	.cfi_endproc
+.LFE6988:
+	.section	.gcc_except_table
+.LLSDA6988:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6988-.LLSDACSB6988
+.LLSDACSB6988:
+	.uleb128 .LEHB12-.LFB6988
+	.uleb128 .LEHE12-.LEHB12
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6988:
+	.section	.text._ZN1n6vectorINS_6stringIcEEE9__releaseEv,"axG",@progbits,_ZN1n6vectorINS_6stringIcEEE9__releaseEv,comdat
+	.size	_ZN1n6vectorINS_6stringIcEEE9__releaseEv, .-_ZN1n6vectorINS_6stringIcEEE9__releaseEv
+	.section	.text._Z7collectIN1n13line_iteratorINS0_5sliceIKcEEEEENS0_6vectorINS0_6stringIcEEEET_,"axG",@progbits,_Z7collectIN1n13line_iteratorINS0_5sliceIKcEEEEENS0_6vectorINS0_6stringIcEEEET_,comdat
+	.p2align 4
+	.weak	_Z7collectIN1n13line_iteratorINS0_5sliceIKcEEEEENS0_6vectorINS0_6stringIcEEEET_
+	.type	_Z7collectIN1n13line_iteratorINS0_5sliceIKcEEEEENS0_6vectorINS0_6stringIcEEEET_, @function
+_Z7collectIN1n13line_iteratorINS0_5sliceIKcEEEEENS0_6vectorINS0_6stringIcEEEET_:
+.LFB6941:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6941
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pxor	%xmm0, %xmm0
+	movq	%rdx, %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	$0, (%rdi)
+	movups	%xmm0, 8(%rdi)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L395
+.L307:
+	movq	%rax, 24(%r13)
+	leaq	72(%rsp), %rax
+	movq	%rax, 40(%rsp)
+	testq	%rdx, %rdx
+	je	.L306
+.L311:
+	movq	%r15, %rdx
+	movl	$10, %esi
+	movq	%r12, %rdi
+	call	memchr@PLT
+	movq	%rax, %rbx
+	leaq	-1(%r15), %rax
+	testq	%rbx, %rbx
+	je	.L312
+	subq	%r12, %rbx
+	cmpq	$-1, %rbx
+	je	.L312
+	subq	%rbx, %rax
+	movq	%rax, %r15
+	leaq	1(%r12,%rbx), %rax
+	movq	%rax, 32(%rsp)
+	testq	%rbx, %rbx
+	je	.L315
+	leaq	-1(%rbx), %rax
+	cmpb	$13, -1(%r12,%rbx)
+	cmove	%rax, %rbx
+.L315:
+	movdqa	.LC19(%rip), %xmm1
+	movaps	%xmm1, 48(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbp
+	testq	%rbp, %rbp
+	je	.L317
+	movq	40(%rsp), %rcx
+	pxor	%xmm0, %xmm0
+	movq	%rbp, 64(%rsp)
+	movq	$0, 88(%rsp)
+	movups	%xmm0, 72(%rsp)
+	movq	%rcx, %rax
+	cmpq	%rcx, %r12
+	jnb	.L353
+	movq	$0, 8(%rsp)
+	movq	%rbx, %r14
+.L319:
+	cmpq	$23, %r14
+	jbe	.L358
+	movq	%rbp, 16(%rsp)
+	movq	$23, (%rsp)
+	movq	%rax, 24(%rsp)
+.L350:
+	movq	(%rsp), %rax
+	movq	16(%rsp), %rdi
+	movl	$1, %edx
+	leaq	10(%rax,%rax), %rax
+	cmpq	%r14, %rax
+	cmovnb	%rax, %r14
+	movq	(%rdi), %rax
+	leaq	1(%r14), %rsi
+.LEHB13:
+	call	*16(%rax)
+	movq	8(%rsp), %rcx
+	movq	24(%rsp), %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	leaq	1(%rcx), %rdx
+	call	memcpy@PLT
+	movq	(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L326
+	movq	16(%rsp), %rdi
+	movq	%rax, %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	addq	$1, %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE13:
+.L326:
+	movq	%rbp, 72(%rsp)
+	movq	%r14, 56(%rsp)
+.L325:
+	cmpq	$23, %r14
+	je	.L396
+.L330:
+	movq	8(%rsp), %rdi
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	addq	%rbp, %rdi
+	call	memmove@PLT
+	addq	48(%rsp), %rbx
+	movq	%rbx, 48(%rsp)
+	movb	$0, 0(%rbp,%rbx)
+	movq	16(%r13), %rax
+	movq	8(%r13), %rbx
+	cmpq	%rbx, %rax
+	je	.L397
+	movdqa	.LC19(%rip), %xmm2
+	leaq	(%rax,%rax,2), %rbx
+	salq	$4, %rbx
+	addq	0(%r13), %rbx
+	movups	%xmm2, (%rbx)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L398
+.L342:
+	movq	64(%rsp), %rax
+	movdqa	48(%rsp), %xmm3
+	pxor	%xmm0, %xmm0
+	movq	$0, 40(%rbx)
+	movups	%xmm0, 24(%rbx)
+	movq	%rax, 16(%rbx)
+	movq	56(%rsp), %rax
+	movups	%xmm3, (%rbx)
+	cmpq	$23, %rax
+	je	.L399
+	movq	72(%rsp), %rax
+	movq	%rax, 24(%rbx)
+	movq	16(%r13), %rax
+	addq	$1, %rax
+	movq	%rax, 16(%r13)
+	testq	%r15, %r15
+	je	.L306
+.L357:
+	movq	32(%rsp), %r12
+	jmp	.L311
+	.p2align 4,,10
+	.p2align 3
+.L312:
+	leaq	(%r12,%r15), %rcx
+	cmpb	$13, (%r12,%rax)
+	movq	%r15, %rbx
+	cmove	%rax, %rbx
+	movq	%rcx, 32(%rsp)
+	xorl	%r15d, %r15d
+	jmp	.L315
+	.p2align 4,,10
+	.p2align 3
+.L396:
+	movq	40(%rsp), %rax
+.L358:
+	movq	%rax, %rbp
+	jmp	.L330
+	.p2align 4,,10
+	.p2align 3
+.L397:
+	leaq	5(%rbx), %rax
+	movq	24(%r13), %rdi
+	movq	0(%r13), %rbp
+	movl	$8, %edx
+	leaq	(%rax,%rax), %rsi
+	movq	%rsi, 8(%r13)
+	addq	%rax, %rsi
+	movq	(%rdi), %rax
+	salq	$5, %rsi
+.LEHB14:
+	call	*16(%rax)
+	movq	16(%r13), %rdx
+	movdqa	.LC19(%rip), %xmm4
+	movq	%rax, 0(%r13)
+	leaq	(%rdx,%rdx,2), %rdx
+	salq	$4, %rdx
+	leaq	(%rax,%rdx), %r12
+	movups	%xmm4, (%r12)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L400
+.L334:
+	movq	64(%rsp), %rax
+	movdqa	48(%rsp), %xmm5
+	pxor	%xmm0, %xmm0
+	movq	$0, 40(%r12)
+	movups	%xmm0, 24(%r12)
+	movq	%rax, 16(%r12)
+	movq	56(%rsp), %rax
+	movups	%xmm5, (%r12)
+	cmpq	$23, %rax
+	je	.L401
+	movq	$23, 56(%rsp)
+	movq	72(%rsp), %rax
+	movq	%rax, 24(%r12)
+.L337:
+	movq	16(%r13), %rax
+	movq	0(%r13), %rdi
+	movb	$0, 72(%rsp)
+	movq	$0, 48(%rsp)
+	testq	%rax, %rax
+	jne	.L402
+	testq	%rbp, %rbp
+	je	.L340
+.L339:
+	movq	24(%r13), %rdi
+	leaq	(%rbx,%rbx,2), %rdx
+	movl	$8, %ecx
+	movq	%rbp, %rsi
+	salq	$4, %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE14:
+.L394:
+	movq	16(%r13), %rax
+.L340:
+	addq	$1, %rax
+	movq	%rax, 16(%r13)
+	testq	%r15, %r15
+	jne	.L357
+.L306:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%r13, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L317:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L403
+.L321:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	48(%rsp), %rsi
+	pxor	%xmm0, %xmm0
+	movq	$0, 88(%rsp)
+	movq	56(%rsp), %rcx
+	movups	%xmm0, 72(%rsp)
+	movq	%rax, 16(%rsp)
+	leaq	(%rsi,%rbx), %r14
+	movq	%rcx, (%rsp)
+	movq	%rsi, 8(%rsp)
+	movq	%rax, 64(%rsp)
+	movq	$0, 24(%rsp)
+	cmpq	$23, %rcx
+	je	.L404
+.L323:
+	movq	24(%rsp), %rax
+	movq	8(%rsp), %rcx
+	addq	%rcx, %rax
+	cmpq	%rax, %r12
+	jnb	.L318
+	movq	24(%rsp), %rax
+	subq	%rax, %r12
+	movq	(%rsp), %rax
+	cmpq	%r14, %rax
+	jnb	.L327
+	leaq	10(%rax,%rax), %rax
+	movq	16(%rsp), %rdi
+	movl	$1, %edx
+	cmpq	%r14, %rax
+	cmovnb	%rax, %r14
+	movq	(%rdi), %rax
+	leaq	1(%r14), %rsi
+.LEHB15:
+	call	*16(%rax)
+	movq	8(%rsp), %rcx
+	movq	24(%rsp), %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	leaq	1(%rcx), %rdx
+	call	memcpy@PLT
+	movq	(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L328
+	movq	16(%rsp), %rdi
+	movq	%rax, %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	addq	$1, %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE15:
+.L328:
+	movq	%rbp, 72(%rsp)
+	movq	%r14, 56(%rsp)
+	movq	%r14, (%rsp)
+.L327:
+	cmpq	$23, (%rsp)
+	je	.L329
+	addq	%rbp, %r12
+	jmp	.L330
+	.p2align 4,,10
+	.p2align 3
+.L353:
+	movq	%rbp, 16(%rsp)
+	movq	%rbx, %r14
+	movq	%rcx, 24(%rsp)
+	movq	$23, (%rsp)
+	movq	$0, 8(%rsp)
+.L318:
+	cmpq	%r14, (%rsp)
+	jb	.L350
+	movq	(%rsp), %r14
+	xorl	%ebp, %ebp
+	jmp	.L325
+	.p2align 4,,10
+	.p2align 3
+.L399:
+	movdqu	72(%rsp), %xmm6
+	movq	88(%rsp), %rax
+	movups	%xmm6, 24(%rbx)
+	movq	%rax, 40(%rbx)
+	jmp	.L394
+	.p2align 4,,10
+	.p2align 3
+.L398:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L342
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L342
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L342
+	.p2align 4,,10
+	.p2align 3
+.L402:
+	leaq	(%rax,%rax,2), %rdx
+	movq	%rbp, %rsi
+	salq	$4, %rdx
+	call	memcpy@PLT
+	jmp	.L339
+	.p2align 4,,10
+	.p2align 3
+.L329:
+	leaq	72(%rsp), %rax
+	addq	%rax, %r12
+	movq	%rax, %rbp
+	jmp	.L330
+	.p2align 4,,10
+	.p2align 3
+.L401:
+	movdqu	72(%rsp), %xmm7
+	movq	88(%rsp), %rax
+	movups	%xmm7, 24(%r12)
+	movq	%rax, 40(%r12)
+	jmp	.L337
+	.p2align 4,,10
+	.p2align 3
+.L400:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L334
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r14
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L334
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r14, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L334
+	.p2align 4,,10
+	.p2align 3
+.L403:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r14
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L321
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r14, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L321
+	.p2align 4,,10
+	.p2align 3
+.L395:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L405
+.L309:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	jmp	.L307
+.L405:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rdx, (%rsp)
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	movq	(%rsp), %rdx
+	testl	%eax, %eax
+	je	.L309
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movq	(%rsp), %rdx
+	jmp	.L309
+.L404:
+	leaq	72(%rsp), %rax
+	cmpq	%rax, %r12
+	jnb	.L406
+	movq	16(%rsp), %rbp
+	jmp	.L319
+.L406:
+	movq	%rax, 24(%rsp)
+	jmp	.L323
+.L359:
+	movq	%rax, %rbx
+	jmp	.L349
+.L360:
+	movq	%rax, %rbx
+.L347:
+	movq	56(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L349
+	movq	64(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	72(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L349:
+	movq	%r13, %rdi
+	call	_ZN1n6vectorINS_6stringIcEEE9__releaseEv
+	movq	%rbx, %rdi
+.LEHB16:
+	call	_Unwind_Resume@PLT
+.LEHE16:
+	.cfi_endproc
+.LFE6941:
+	.section	.gcc_except_table
+.LLSDA6941:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6941-.LLSDACSB6941
+.LLSDACSB6941:
+	.uleb128 .LEHB13-.LFB6941
+	.uleb128 .LEHE13-.LEHB13
+	.uleb128 .L359-.LFB6941
+	.uleb128 0
+	.uleb128 .LEHB14-.LFB6941
+	.uleb128 .LEHE14-.LEHB14
+	.uleb128 .L360-.LFB6941
+	.uleb128 0
+	.uleb128 .LEHB15-.LFB6941
+	.uleb128 .LEHE15-.LEHB15
+	.uleb128 .L359-.LFB6941
+	.uleb128 0
+	.uleb128 .LEHB16-.LFB6941
+	.uleb128 .LEHE16-.LEHB16
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6941:
+	.section	.text._Z7collectIN1n13line_iteratorINS0_5sliceIKcEEEEENS0_6vectorINS0_6stringIcEEEET_,"axG",@progbits,_Z7collectIN1n13line_iteratorINS0_5sliceIKcEEEEENS0_6vectorINS0_6stringIcEEEET_,comdat
+	.size	_Z7collectIN1n13line_iteratorINS0_5sliceIKcEEEEENS0_6vectorINS0_6stringIcEEEET_, .-_Z7collectIN1n13line_iteratorINS0_5sliceIKcEEEEENS0_6vectorINS0_6stringIcEEEET_
+	.section	.rodata.str1.1
+.LC22:
+	.string	"first\r\nsecond\n\nlast"
+.LC23:
+	.string	"first"
+.LC24:
+	.string	"second"
+.LC25:
+	.string	"last"
+.LC26:
+	.string	"a\nb\n"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC27:
+	.string	"expected equal : expected value : v.len(), actual value : 4"
+	.align 8
+.LC28:
+	.string	"expected true : v.data()[0] == n::str(\"first\")"
+	.align 8
+.LC29:
+	.string	"expected true : v.data()[1] == n::str(\"second\")"
+	.align 8
+.LC30:
+	.string	"expected equal : expected value : v.data()[2].len(), actual value : 0"
+	.align 8
+.LC31:
+	.string	"expected true : v.data()[3] == n::str(\"last\")"
+	.align 8
+.LC32:
+	.string	"expected equal : expected value : collect(n::lines(ended.iter())).len(), actual value : 2"
+	.section	.text.unlikely
+.LCOLDB33:
+	.text
+.LHOTB33:
+	.p2align 4
+	.globl	_Z20test_lines_in_memoryv
+	.type	_Z20test_lines_in_memoryv, @function
+_Z20test_lines_in_memoryv:
+.LFB6890:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6890
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$200, %rsp
+	.cfi_def_cfa_offset 256
+	movdqa	.LC19(%rip), %xmm1
+	movaps	%xmm1, 96(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbx
+	testq	%rbx, %rbx
+	je	.L408
+	pxor	%xmm0, %xmm0
+	leaq	120(%rsp), %rax
+	movq	%rbx, 112(%rsp)
+	xorl	%edi, %edi
+	leaq	.LC22(%rip), %rsi
+	movups	%xmm0, 120(%rsp)
+	movq	$0, 136(%rsp)
+	cmpq	%rax, %rsi
+	jb	.L591
+.L710:
+	leaq	.LC22(%rip), %rsi
+.L591:
+	movq	%rax, %rbx
+.L409:
+	addq	%rbx, %rdi
+	movl	$19, %edx
+	call	memmove@PLT
+	movq	96(%rsp), %rax
+	leaq	120(%rsp), %rsi
+	leaq	19(%rax), %rdx
+	movq	%rdx, 96(%rsp)
+	movb	$0, 19(%rbx,%rax)
+	cmpq	$23, 104(%rsp)
+	movq	96(%rsp), %rdx
+	je	.L424
+	movq	120(%rsp), %rsi
+.L424:
+	leaq	32(%rsp), %rdi
+	movq	%rdi, 16(%rsp)
+.LEHB17:
+	call	_Z7collectIN1n13line_iteratorINS0_5sliceIKcEEEEENS0_6vectorINS0_6stringIcEEEET_
+.LEHE17:
+	cmpq	$4, 48(%rsp)
+	jne	.L708
+	movdqa	.LC19(%rip), %xmm2
+	movaps	%xmm2, 144(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L426
+	pxor	%xmm0, %xmm0
+	leaq	168(%rsp), %rbx
+	xorl	%ebp, %ebp
+	movq	%rax, 160(%rsp)
+	leaq	.LC23(%rip), %rsi
+	movups	%xmm0, 168(%rsp)
+	movq	$0, 184(%rsp)
+	cmpq	%rbx, %rsi
+	jb	.L427
+.L711:
+	leaq	.LC23(%rip), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L427:
+	leaq	(%rbx,%rbp), %rdi
+	movl	$5, %edx
+	call	memmove@PLT
+	movq	144(%rsp), %rax
+	movq	32(%rsp), %r12
+	leaq	5(%rax), %rdx
+	movq	%rdx, 144(%rsp)
+	movb	$0, 5(%rbx,%rax)
+	movq	(%r12), %rdx
+	movq	152(%rsp), %rbx
+	cmpq	144(%rsp), %rdx
+	je	.L725
+.L440:
+	cmpq	$23, %rbx
+	je	.L450
+	movq	160(%rsp), %rdi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L450:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC28(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB18:
+	call	__cxa_throw@PLT
+.LEHE18:
+	.p2align 4,,10
+	.p2align 3
+.L725:
+	cmpq	$23, %rbx
+	je	.L726
+	movq	168(%rsp), %rax
+	cmpq	$23, 8(%r12)
+	movq	%rax, %rsi
+	je	.L727
+	testq	%rdx, %rdx
+	je	.L446
+	movq	24(%r12), %rdi
+.L447:
+	movq	%rax, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L440
+	movq	168(%rsp), %rsi
+	cmpq	$23, %rbx
+	je	.L443
+.L446:
+	movq	160(%rsp), %rdi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L443:
+	movdqa	.LC19(%rip), %xmm3
+	movaps	%xmm3, 144(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L451
+	pxor	%xmm0, %xmm0
+	leaq	168(%rsp), %rbx
+	xorl	%ebp, %ebp
+	movq	%rax, 160(%rsp)
+	leaq	.LC24(%rip), %rsi
+	movups	%xmm0, 168(%rsp)
+	movq	$0, 184(%rsp)
+	cmpq	%rbx, %rsi
+	jb	.L452
+.L713:
+	leaq	.LC24(%rip), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L452:
+	leaq	(%rbx,%rbp), %rdi
+	movl	$6, %edx
+	call	memmove@PLT
+	movq	144(%rsp), %rax
+	leaq	6(%rax), %rdx
+	movq	%rdx, 144(%rsp)
+	movb	$0, 6(%rbx,%rax)
+	movq	48(%r12), %rdx
+	movq	152(%rsp), %rbx
+	cmpq	144(%rsp), %rdx
+	je	.L728
+.L465:
+	cmpq	$23, %rbx
+	je	.L475
+	movq	160(%rsp), %rdi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L475:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC29(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB19:
+	call	__cxa_throw@PLT
+.LEHE19:
+	.p2align 4,,10
+	.p2align 3
+.L727:
+	leaq	24(%r12), %rdi
+	testq	%rdx, %rdx
+	jne	.L447
+	jmp	.L446
+	.p2align 4,,10
+	.p2align 3
+.L728:
+	cmpq	$23, %rbx
+	je	.L729
+	movq	168(%rsp), %rax
+	cmpq	$23, 56(%r12)
+	movq	%rax, %rsi
+	je	.L730
+	testq	%rdx, %rdx
+	je	.L471
+	movq	72(%r12), %rdi
+.L472:
+	movq	%rax, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L465
+	movq	168(%rsp), %rsi
+	cmpq	$23, %rbx
+	je	.L468
+.L471:
+	movq	160(%rsp), %rdi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L468:
+	movq	96(%r12), %rbp
+	testq	%rbp, %rbp
+	jne	.L709
+	movdqa	.LC19(%rip), %xmm4
+	movaps	%xmm4, 144(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L477
+	pxor	%xmm0, %xmm0
+	leaq	168(%rsp), %rbx
+	xorl	%r14d, %r14d
+	movq	%rax, 160(%rsp)
+	leaq	.LC25(%rip), %rdx
+	movups	%xmm0, 168(%rsp)
+	movq	$0, 184(%rsp)
+	cmpq	%rbx, %rdx
+	jb	.L588
+.L715:
+	leaq	.LC25(%rip), %rax
+	.p2align 4,,10
+	.p2align 3
+.L478:
+	movl	(%rax), %eax
+	movl	%eax, (%rbx,%r14)
+	movq	144(%rsp), %rax
+	leaq	4(%rax), %rdx
+	movq	%rdx, 144(%rsp)
+	movb	$0, 4(%rbx,%rax)
+	movq	144(%r12), %rdx
+	movq	152(%rsp), %rbx
+	cmpq	144(%rsp), %rdx
+	je	.L731
+.L491:
+	cmpq	$23, %rbx
+	je	.L501
+	movq	160(%rsp), %rdi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L501:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC31(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB20:
+	call	__cxa_throw@PLT
+.LEHE20:
+	.p2align 4,,10
+	.p2align 3
+.L731:
+	cmpq	$23, %rbx
+	je	.L732
+	movq	168(%rsp), %rax
+	cmpq	$23, 152(%r12)
+	movq	%rax, %rsi
+	je	.L733
+	testq	%rdx, %rdx
+	je	.L497
+	movq	168(%r12), %rdi
+.L498:
+	movq	%rax, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L491
+	movq	168(%rsp), %rsi
+	cmpq	$23, %rbx
+	je	.L494
+.L497:
+	movq	160(%rsp), %rdi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L494:
+	movdqa	.LC19(%rip), %xmm5
+	movaps	%xmm5, 144(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r12
+	testq	%r12, %r12
+	je	.L502
+	pxor	%xmm0, %xmm0
+	leaq	168(%rsp), %rbx
+	xorl	%edx, %edx
+	movq	%r12, 160(%rsp)
+	leaq	.LC26(%rip), %rax
+	movups	%xmm0, 168(%rsp)
+	movq	$0, 184(%rsp)
+	cmpq	%rbx, %rax
+	jb	.L587
+.L717:
+	leaq	.LC26(%rip), %rax
+.L587:
+	movq	%rbx, %r12
+.L503:
+	movl	(%rax), %eax
+	leaq	168(%rsp), %rsi
+	movl	%eax, (%r12,%rdx)
+	movq	144(%rsp), %rax
+	leaq	4(%rax), %rdx
+	movq	%rdx, 144(%rsp)
+	movb	$0, 4(%r12,%rax)
+	movq	144(%rsp), %rdx
+	cmpq	$23, 152(%rsp)
+	je	.L518
+	movq	168(%rsp), %rsi
+.L518:
+	leaq	64(%rsp), %rdi
+.LEHB21:
+	call	_Z7collectIN1n13line_iteratorINS0_5sliceIKcEEEEENS0_6vectorINS0_6stringIcEEEET_
+.LEHE21:
+	movq	80(%rsp), %r12
+	movq	64(%rsp), %r13
+	movq	72(%rsp), %r14
+	testq	%r12, %r12
+	je	.L519
+	movq	%r13, %rbx
+	xorl	%r15d, %r15d
+	.p2align 4,,10
+	.p2align 3
+.L523:
+	movq	8(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L520
+	movq	16(%rbx), %rdi
+	addq	$1, %r15
+	movq	24(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	addq	$48, %rbx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	%r12, %r15
+	jne	.L523
+.L522:
+	testq	%r13, %r13
+	je	.L525
+.L527:
+	movq	88(%rsp), %rdi
+	leaq	(%r14,%r14,2), %rdx
+	movl	$8, %ecx
+	movq	%r13, %rsi
+	salq	$4, %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L525:
+	cmpq	$2, %r12
+	jne	.L526
+	movq	152(%rsp), %rdx
+	cmpq	$23, %rdx
+	je	.L529
+	movq	160(%rsp), %rdi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L529:
+	movq	32(%rsp), %r13
+	movq	48(%rsp), %r12
+	movq	%r13, %rbx
+	testq	%r12, %r12
+	je	.L535
+	.p2align 4,,10
+	.p2align 3
+.L536:
+	movq	8(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L533
+	movq	16(%rbx), %rdi
+	addq	$1, %rbp
+	movq	24(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	addq	$48, %rbx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	%r12, %rbp
+	jne	.L536
+.L535:
+	testq	%r13, %r13
+	je	.L532
+	movq	40(%rsp), %rax
+	movq	56(%rsp), %rdi
+	movl	$8, %ecx
+	movq	%r13, %rsi
+	leaq	(%rax,%rax,2), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+	call	*24(%rax)
+.L532:
+	movq	104(%rsp), %rdx
+	cmpq	$23, %rdx
+	je	.L407
+	movq	112(%rsp), %rdi
+	movq	120(%rsp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L407:
+	addq	$200, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L533:
+	.cfi_restore_state
+	addq	$1, %rbp
+	addq	$48, %rbx
+	cmpq	%rbp, %r12
+	jne	.L536
+	jmp	.L535
+	.p2align 4,,10
+	.p2align 3
+.L520:
+	addq	$1, %r15
+	addq	$48, %rbx
+	cmpq	%r15, %r12
+	jne	.L523
+	jmp	.L522
+	.p2align 4,,10
+	.p2align 3
+.L588:
+	movq	%rdx, %rax
+	jmp	.L478
+	.p2align 4,,10
+	.p2align 3
+.L502:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L734
+.L507:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	144(%rsp), %rdx
+	pxor	%xmm0, %xmm0
+	xorl	%ebx, %ebx
+	movq	152(%rsp), %r13
+	movups	%xmm0, 168(%rsp)
+	leaq	.LC26(%rip), %rax
+	movq	%rdi, 160(%rsp)
+	leaq	4(%rdx), %rcx
+	movq	$0, 184(%rsp)
+	cmpq	$23, %r13
+	je	.L735
+.L509:
+	leaq	(%rbx,%rdx), %rsi
+	cmpq	%rsi, %rax
+	jnb	.L736
+	subq	%rbx, %rax
+	movq	%rax, %r14
+	cmpq	%rcx, %r13
+	jnb	.L583
+	leaq	10(%r13,%r13), %r13
+	movq	(%rdi), %rax
+	movl	$1, %edx
+	cmpq	%rcx, %r13
+	cmovb	%rcx, %r13
+	leaq	1(%r13), %rsi
+.LEHB22:
+	call	*16(%rax)
+	movq	%rax, %r12
+	movq	144(%rsp), %rax
+	cmpq	$23, 152(%rsp)
+	leaq	168(%rsp), %rsi
+	leaq	1(%rax), %rdx
+	je	.L514
+	movq	168(%rsp), %rsi
+.L514:
+	movq	%r12, %rdi
+	call	memcpy@PLT
+	movq	152(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L515
+	movq	160(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L515:
+	movq	%r12, 168(%rsp)
+	movq	144(%rsp), %rdx
+	movq	%r13, 152(%rsp)
+.L513:
+	leaq	(%r12,%r14), %rax
+	cmpq	$23, %r13
+	jne	.L503
+	leaq	168(%rsp), %rbx
+	leaq	(%rbx,%r14), %rax
+	jmp	.L587
+.L736:
+	cmpq	%rcx, %r13
+	jnb	.L505
+.L543:
+	leaq	10(%r13,%r13), %r13
+	movq	(%rdi), %rax
+	movl	$1, %edx
+	cmpq	%rcx, %r13
+	cmovb	%rcx, %r13
+	leaq	1(%r13), %rsi
+	call	*16(%rax)
+	movq	%rax, %r12
+	movq	144(%rsp), %rax
+	cmpq	$23, 152(%rsp)
+	leaq	168(%rsp), %rsi
+	leaq	1(%rax), %rdx
+	je	.L511
+	movq	168(%rsp), %rsi
+.L511:
+	movq	%r12, %rdi
+	call	memcpy@PLT
+	movq	152(%rsp), %rdx
+	cmpq	$23, %rdx
+	je	.L512
+	movq	160(%rsp), %rdi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L512:
+	movq	%r12, 168(%rsp)
+	movq	144(%rsp), %rdx
+	movq	%r13, 152(%rsp)
+.L505:
+	leaq	.LC26(%rip), %rax
+	cmpq	$23, %r13
+	jne	.L503
+	leaq	168(%rsp), %rbx
+	jmp	.L717
+	.p2align 4,,10
+	.p2align 3
+.L477:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L737
+.L482:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	144(%rsp), %r14
+	pxor	%xmm0, %xmm0
+	movq	$0, 184(%rsp)
+	movq	152(%rsp), %r13
+	movups	%xmm0, 168(%rsp)
+	leaq	.LC25(%rip), %rdx
+	movq	%r15, 160(%rsp)
+	leaq	4(%r14), %rax
+	movq	$0, 8(%rsp)
+	cmpq	$23, %r13
+	je	.L738
+.L484:
+	movq	8(%rsp), %rcx
+	addq	%r14, %rcx
+	cmpq	%rcx, %rdx
+	jnb	.L739
+	movq	8(%rsp), %rcx
+	subq	%rcx, %rdx
+	movq	%rdx, 24(%rsp)
+	cmpq	%rax, %r13
+	jnb	.L576
+	leaq	10(%r13,%r13), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, (%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%r14), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L488
+	movq	(%r15), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L488:
+	movq	(%rsp), %rax
+	movq	%rbx, 168(%rsp)
+	movq	%rax, 152(%rsp)
+	movq	%rax, %r13
+.L487:
+	cmpq	$23, %r13
+	jne	.L723
+	leaq	168(%rsp), %rbx
+.L723:
+	movq	24(%rsp), %rax
+	addq	%rbx, %rax
+	jmp	.L478
+.L739:
+	cmpq	%rax, %r13
+	jnb	.L575
+.L544:
+	leaq	10(%r13,%r13), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, (%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%r14), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L486
+	movq	(%r15), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L486:
+	movq	(%rsp), %rax
+	movq	%rbx, 168(%rsp)
+	movq	%rax, 152(%rsp)
+.L480:
+	cmpq	$23, (%rsp)
+	leaq	.LC25(%rip), %rax
+	jne	.L478
+	leaq	168(%rsp), %rbx
+	jmp	.L715
+	.p2align 4,,10
+	.p2align 3
+.L451:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L740
+.L456:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	144(%rsp), %rbp
+	pxor	%xmm0, %xmm0
+	movq	$0, 184(%rsp)
+	movq	152(%rsp), %r14
+	movq	$0, (%rsp)
+	leaq	.LC24(%rip), %rsi
+	movq	%r15, 160(%rsp)
+	leaq	6(%rbp), %r13
+	movups	%xmm0, 168(%rsp)
+	cmpq	$23, %r14
+	je	.L741
+.L458:
+	movq	(%rsp), %rax
+	addq	%rbp, %rax
+	cmpq	%rax, %rsi
+	jnb	.L742
+	movq	(%rsp), %rax
+	movq	%rsi, %rcx
+	subq	%rax, %rcx
+	movq	%rcx, 8(%rsp)
+	cmpq	%r13, %r14
+	jnb	.L569
+	leaq	10(%r14,%r14), %rax
+	movl	$1, %edx
+	movq	%r15, %rdi
+	cmpq	%r13, %rax
+	cmovnb	%rax, %r13
+	movq	(%r15), %rax
+	leaq	1(%r13), %rsi
+	call	*16(%rax)
+	movq	(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L462
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L462:
+	movq	%rbx, 168(%rsp)
+	movq	%r13, %r14
+	movq	%r13, 152(%rsp)
+.L461:
+	cmpq	$23, %r14
+	jne	.L721
+	leaq	168(%rsp), %rbx
+.L721:
+	movq	8(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L452
+.L742:
+	cmpq	%r13, %r14
+	jnb	.L568
+.L545:
+	leaq	10(%r14,%r14), %rax
+	movl	$1, %edx
+	movq	%r15, %rdi
+	cmpq	%r13, %rax
+	cmovnb	%rax, %r13
+	movq	(%r15), %rax
+	leaq	1(%r13), %rsi
+	call	*16(%rax)
+	movq	(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L460
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L460:
+	movq	%rbx, 168(%rsp)
+	movq	%r13, 152(%rsp)
+.L454:
+	leaq	.LC24(%rip), %rsi
+	cmpq	$23, %r13
+	jne	.L452
+	leaq	168(%rsp), %rbx
+	jmp	.L713
+	.p2align 4,,10
+	.p2align 3
+.L426:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L743
+.L431:
+	movq	_ZZN1n4heapEvE3res(%rip), %r14
+	movq	144(%rsp), %rbp
+	pxor	%xmm0, %xmm0
+	xorl	%r15d, %r15d
+	movq	152(%rsp), %r13
+	movups	%xmm0, 168(%rsp)
+	leaq	.LC23(%rip), %rsi
+	movq	%r14, 160(%rsp)
+	leaq	5(%rbp), %r12
+	movq	$0, 184(%rsp)
+	cmpq	$23, %r13
+	je	.L744
+.L433:
+	leaq	(%r15,%rbp), %rax
+	cmpq	%rax, %rsi
+	jnb	.L745
+	subq	%r15, %rsi
+	movq	%rsi, (%rsp)
+	cmpq	%r12, %r13
+	jnb	.L562
+	leaq	10(%r13,%r13), %rax
+	movl	$1, %edx
+	movq	%r14, %rdi
+	cmpq	%r12, %rax
+	cmovnb	%rax, %r12
+	movq	(%r14), %rax
+	leaq	1(%r12), %rsi
+	call	*16(%rax)
+	leaq	1(%rbp), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L437
+	movq	(%r14), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L437:
+	movq	%rbx, 168(%rsp)
+	movq	%r12, %r13
+	movq	%r12, 152(%rsp)
+.L436:
+	cmpq	$23, %r13
+	jne	.L719
+	leaq	168(%rsp), %rbx
+.L719:
+	movq	(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L427
+.L745:
+	cmpq	%r12, %r13
+	jnb	.L561
+.L546:
+	leaq	10(%r13,%r13), %rax
+	movl	$1, %edx
+	movq	%r14, %rdi
+	cmpq	%r12, %rax
+	cmovnb	%rax, %r12
+	movq	(%r14), %rax
+	leaq	1(%r12), %rsi
+	call	*16(%rax)
+	leaq	1(%rbp), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L435
+	movq	(%r14), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.LEHE22:
+.L435:
+	movq	%rbx, 168(%rsp)
+	movq	%r12, 152(%rsp)
+.L429:
+	leaq	.LC23(%rip), %rsi
+	cmpq	$23, %r12
+	jne	.L427
+	leaq	168(%rsp), %rbx
+	jmp	.L711
+	.p2align 4,,10
+	.p2align 3
+.L408:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L746
+.L413:
+	movq	96(%rsp), %rdi
+	movq	104(%rsp), %rbp
+	pxor	%xmm0, %xmm0
+	xorl	%eax, %eax
+	movq	_ZZN1n4heapEvE3res(%rip), %rcx
+	movups	%xmm0, 120(%rsp)
+	leaq	.LC22(%rip), %rsi
+	movq	$0, 136(%rsp)
+	leaq	19(%rdi), %rdx
+	movq	%rcx, 112(%rsp)
+	cmpq	$23, %rbp
+	je	.L747
+.L415:
+	leaq	(%rax,%rdi), %r8
+	cmpq	%r8, %rsi
+	jnb	.L748
+	subq	%rax, %rsi
+	movq	%rsi, %r12
+	cmpq	%rdx, %rbp
+	jnb	.L553
+	leaq	10(%rbp,%rbp), %rbp
+	movq	(%rcx), %rax
+	movq	%rcx, %rdi
+	cmpq	%rdx, %rbp
+	cmovb	%rdx, %rbp
+	movl	$1, %edx
+	leaq	1(%rbp), %rsi
+.LEHB23:
+	call	*16(%rax)
+	cmpq	$23, 104(%rsp)
+	leaq	120(%rsp), %rsi
+	movq	%rax, %rbx
+	movq	96(%rsp), %rax
+	leaq	1(%rax), %rdx
+	je	.L420
+	movq	120(%rsp), %rsi
+.L420:
+	movq	%rbx, %rdi
+	call	memcpy@PLT
+	movq	104(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L421
+	movq	112(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	120(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L421:
+	movq	%rbx, 120(%rsp)
+	movq	96(%rsp), %rdi
+	movq	%rbp, 104(%rsp)
+.L419:
+	leaq	(%rbx,%r12), %rsi
+	cmpq	$23, %rbp
+	jne	.L409
+	leaq	120(%rsp), %rax
+	leaq	(%rax,%r12), %rsi
+	jmp	.L591
+.L748:
+	cmpq	%rdx, %rbp
+	jnb	.L411
+.L547:
+	leaq	10(%rbp,%rbp), %rbp
+	movq	(%rcx), %rax
+	movq	%rcx, %rdi
+	cmpq	%rdx, %rbp
+	cmovb	%rdx, %rbp
+	movl	$1, %edx
+	leaq	1(%rbp), %rsi
+	call	*16(%rax)
+	cmpq	$23, 104(%rsp)
+	leaq	120(%rsp), %rsi
+	movq	%rax, %rbx
+	movq	96(%rsp), %rax
+	leaq	1(%rax), %rdx
+	je	.L417
+	movq	120(%rsp), %rsi
+.L417:
+	movq	%rbx, %rdi
+	call	memcpy@PLT
+	movq	104(%rsp), %rdx
+	cmpq	$23, %rdx
+	je	.L418
+	movq	112(%rsp), %rdi
+	movq	120(%rsp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE23:
+.L418:
+	movq	%rbx, 120(%rsp)
+	movq	96(%rsp), %rdi
+	movq	%rbp, 104(%rsp)
+.L411:
+	leaq	.LC22(%rip), %rsi
+	cmpq	$23, %rbp
+	jne	.L409
+	leaq	120(%rsp), %rax
+	jmp	.L710
+	.p2align 4,,10
+	.p2align 3
+.L732:
+	cmpq	$23, 152(%r12)
+	je	.L749
+	movq	168(%r12), %rdi
+	leaq	168(%rsp), %rax
+	testq	%rdx, %rdx
+	je	.L494
+	jmp	.L498
+	.p2align 4,,10
+	.p2align 3
+.L729:
+	cmpq	$23, 56(%r12)
+	je	.L750
+	movq	72(%r12), %rdi
+	testq	%rdx, %rdx
+	je	.L468
+	leaq	168(%rsp), %rax
+	jmp	.L472
+	.p2align 4,,10
+	.p2align 3
+.L726:
+	cmpq	$23, 8(%r12)
+	je	.L751
+	movq	24(%r12), %rdi
+	leaq	168(%rsp), %rax
+	testq	%rdx, %rdx
+	je	.L443
+	jmp	.L447
+	.p2align 4,,10
+	.p2align 3
+.L519:
+	testq	%r13, %r13
+	jne	.L527
+	jmp	.L526
+.L733:
+	leaq	168(%r12), %rdi
+	testq	%rdx, %rdx
+	jne	.L498
+	jmp	.L497
+.L730:
+	leaq	72(%r12), %rdi
+	testq	%rdx, %rdx
+	jne	.L472
+	jmp	.L471
+.L734:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L507
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L507
+.L746:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L413
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L413
+.L743:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L431
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L431
+.L740:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L456
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L456
+.L737:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L482
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L482
+.L750:
+	testq	%rdx, %rdx
+	je	.L468
+	leaq	168(%rsp), %rbx
+	leaq	72(%r12), %rdi
+	movq	%rbx, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L475
+	jmp	.L468
+.L751:
+	testq	%rdx, %rdx
+	je	.L443
+	leaq	168(%rsp), %rbx
+	leaq	24(%r12), %rdi
+	movq	%rbx, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L450
+	jmp	.L443
+.L749:
+	testq	%rdx, %rdx
+	je	.L494
+	leaq	168(%rsp), %rbx
+	leaq	168(%r12), %rdi
+	movq	%rbx, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L494
+	jmp	.L501
+.L561:
+	xorl	%ebx, %ebx
+	movq	%r13, %r12
+	jmp	.L429
+.L568:
+	xorl	%ebx, %ebx
+	movq	%r14, %r13
+	jmp	.L454
+.L575:
+	movq	%r13, (%rsp)
+	xorl	%ebx, %ebx
+	jmp	.L480
+.L569:
+	xorl	%ebx, %ebx
+	jmp	.L461
+.L741:
+	leaq	168(%rsp), %rbx
+	cmpq	%rbx, %rsi
+	jnb	.L752
+	cmpq	$23, %r13
+	jbe	.L452
+	movq	%rbx, (%rsp)
+	jmp	.L545
+.L553:
+	xorl	%ebx, %ebx
+	jmp	.L419
+.L562:
+	xorl	%ebx, %ebx
+	jmp	.L436
+.L744:
+	leaq	168(%rsp), %rbx
+	cmpq	%rbx, %rsi
+	jnb	.L753
+	cmpq	$23, %r12
+	jbe	.L427
+	movq	%rbx, %r15
+	jmp	.L546
+.L747:
+	leaq	120(%rsp), %rax
+	cmpq	%rax, %rsi
+	jnb	.L415
+	cmpq	$23, %rdx
+	ja	.L547
+	jmp	.L591
+.L752:
+	movq	%rbx, (%rsp)
+	jmp	.L458
+.L753:
+	movq	%rbx, %r15
+	jmp	.L433
+	.p2align 4,,10
+	.p2align 3
+.L576:
+	xorl	%ebx, %ebx
+	jmp	.L487
+.L738:
+	leaq	168(%rsp), %rbx
+	cmpq	%rbx, %rdx
+	jnb	.L754
+	cmpq	$23, %rax
+	jbe	.L588
+	movq	%rbx, 8(%rsp)
+	jmp	.L544
+.L583:
+	xorl	%r12d, %r12d
+	jmp	.L513
+.L735:
+	leaq	168(%rsp), %rbx
+	cmpq	%rbx, %rax
+	jnb	.L509
+	cmpq	$23, %rcx
+	ja	.L543
+	jmp	.L587
+.L754:
+	movq	%rbx, 8(%rsp)
+	jmp	.L484
+.L704:
+	jmp	.L705
+.L706:
+	jmp	.L707
+.L592:
+	movq	%rax, %rbx
+	jmp	.L541
+	.section	.gcc_except_table
+.LLSDA6890:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6890-.LLSDACSB6890
+.LLSDACSB6890:
+	.uleb128 .LEHB17-.LFB6890
+	.uleb128 .LEHE17-.LEHB17
+	.uleb128 .L592-.LFB6890
+	.uleb128 0
+	.uleb128 .LEHB18-.LFB6890
+	.uleb128 .LEHE18-.LEHB18
+	.uleb128 .L704-.LFB6890
+	.uleb128 0
+	.uleb128 .LEHB19-.LFB6890
+	.uleb128 .LEHE19-.LEHB19
+	.uleb128 .L704-.LFB6890
+	.uleb128 0
+	.uleb128 .LEHB20-.LFB6890
+	.uleb128 .LEHE20-.LEHB20
+	.uleb128 .L704-.LFB6890
+	.uleb128 0
+	.uleb128 .LEHB21-.LFB6890
+	.uleb128 .LEHE21-.LEHB21
+	.uleb128 .L706-.LFB6890
+	.uleb128 0
+	.uleb128 .LEHB22-.LFB6890
+	.uleb128 .LEHE22-.LEHB22
+	.uleb128 .L704-.LFB6890
+	.uleb128 0
+	.uleb128 .LEHB23-.LFB6890
+	.uleb128 .LEHE23-.LEHB23
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6890:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6890
+	.type	_Z20test_lines_in_memoryv.cold, @function
+_Z20test_lines_in_memoryv.cold:
+.LFSB6890:
+.L708:
+	.cfi_def_cfa_offset 256
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC27(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB24:
+	call	__cxa_throw@PLT
+.LEHE24:
+.L593:
+.L705:
+	movq	%rax, %rbx
+.L540:
+	movq	16(%rsp), %rdi
+	call	_ZN1n6vectorINS_6stringIcEEE9__releaseEv
+.L541:
+	movq	104(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L542
+	movq	112(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	120(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L542:
+	movq	%rbx, %rdi
+.LEHB25:
+	call	_Unwind_Resume@PLT
+.LEHE25:
+.L526:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC32(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB26:
+	call	__cxa_throw@PLT
+.LEHE26:
+.L594:
+.L707:
+	movq	%rax, %rbx
+	movq	152(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L540
+	movq	160(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L540
+.L709:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC30(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB27:
+	call	__cxa_throw@PLT
+.LEHE27:
+	.cfi_endproc
+.LFE6890:
+	.section	.gcc_except_table
+.LLSDAC6890:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6890-.LLSDACSBC6890
+.LLSDACSBC6890:
+	.uleb128 .LEHB24-.LCOLDB33
+	.uleb128 .LEHE24-.LEHB24
+	.uleb128 .L593-.LCOLDB33
+	.uleb128 0
+	.uleb128 .LEHB25-.LCOLDB33
+	.uleb128 .LEHE25-.LEHB25
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB26-.LCOLDB33
+	.uleb128 .LEHE26-.LEHB26
+	.uleb128 .L594-.LCOLDB33
+	.uleb128 0
+	.uleb128 .LEHB27-.LCOLDB33
+	.uleb128 .LEHE27-.LEHB27
+	.uleb128 .L593-.LCOLDB33
+	.uleb128 0
+.LLSDACSEC6890:
+	.section	.text.unlikely
+	.text
+	.size	_Z20test_lines_in_memoryv, .-_Z20test_lines_in_memoryv
+	.section	.text.unlikely
+	.size	_Z20test_lines_in_memoryv.cold, .-_Z20test_lines_in_memoryv.cold
+.LCOLDE33:
+	.text
+.LHOTE33:
+	.section	.text._ZN1n4fileIcLNS_4modeE0EE5closeEv,"axG",@progbits,_ZN1n4fileIcLNS_4modeE0EE5closeEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4fileIcLNS_4modeE0EE5closeEv
+	.type	_ZN1n4fileIcLNS_4modeE0EE5closeEv, @function
+_ZN1n4fileIcLNS_4modeE0EE5closeEv:
+.LFB6990:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movl	(%rdi), %ebp
+	testl	%ebp, %ebp
+	js	.L756
+	cmpl	$2, 8(%rdi)
+	je	.L781
+.L757:
+	cmpb	$0, 4(%rbx)
+	jne	.L782
+.L762:
+	movl	$-1, (%rbx)
+.L756:
+	cmpq	$0, 16(%rbx)
+	je	.L763
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L783
+.L765:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	$0, 16(%rbx)
+.L763:
+	movq	48(%rbx), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 8(%rbx)
+	movups	%xmm0, 32(%rbx)
+	testq	%rdi, %rdi
+	je	.L755
+	call	fclose@PLT
+	movq	$0, 48(%rbx)
+.L755:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L781:
+	.cfi_restore_state
+	movq	40(%rdi), %r12
+	testq	%r12, %r12
+	je	.L757
+	movq	16(%rdi), %r13
+.L761:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L784
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L761
+	.p2align 4,,10
+	.p2align 3
+.L760:
+	movq	$0, 40(%rbx)
+	jmp	.L757
+	.p2align 4,,10
+	.p2align 3
+.L782:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L762
+	.p2align 4,,10
+	.p2align 3
+.L783:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L765
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L765
+	.p2align 4,,10
+	.p2align 3
+.L784:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L760
+	jmp	.L761
+	.cfi_endproc
+.LFE6990:
+	.size	_ZN1n4fileIcLNS_4modeE0EE5closeEv, .-_ZN1n4fileIcLNS_4modeE0EE5closeEv
+	.section	.text._ZN1n11line_readerINS_4fileIcLNS_4modeE0EEEE9__advanceEv,"axG",@progbits,_ZN1n11line_readerINS_4fileIcLNS_4modeE0EEEE9__advanceEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n11line_readerINS_4fileIcLNS_4modeE0EEEE9__advanceEv
+	.type	_ZN1n11line_readerINS_4fileIcLNS_4modeE0EEEE9__advanceEv, @function
+_ZN1n11line_readerINS_4fileIcLNS_4modeE0EEEE9__advanceEv:
+.LFB6996:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdi, %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	(%rdi), %rdx
+	cmpl	$1, 8(%rdx)
+	jne	.L786
+	movq	32(%rdx), %rcx
+	movq	40(%rdx), %rax
+	movq	72(%rdi), %rsi
+	subq	%rcx, %rax
+	cmpq	%rsi, %rax
+	cmova	%rsi, %rax
+	addq	%rcx, %rax
+	movq	%rax, 32(%rdx)
+.L786:
+	cmpq	$23, 16(%r15)
+	movq	$0, 72(%r15)
+	leaq	32(%r15), %rax
+	movq	$0, 8(%r15)
+	je	.L788
+	movq	32(%r15), %rax
+.L788:
+	movb	$0, (%rax)
+	movq	(%r15), %rbp
+	xorl	%r13d, %r13d
+.L789:
+	movl	0(%rbp), %eax
+	testl	%eax, %eax
+	jns	.L904
+.L791:
+	cmpq	$23, 16(%r15)
+	leaq	32(%r15), %rax
+	je	.L840
+	movq	32(%r15), %rax
+	.p2align 4,,10
+	.p2align 3
+.L840:
+	movq	8(%r15), %rdx
+	xorl	%ecx, %ecx
+	testq	%rdx, %rdx
+	je	.L841
+	leaq	-1(%rdx), %rcx
+	cmpb	$13, -1(%rax,%rdx)
+	cmovne	%rdx, %rcx
+.L841:
+	testq	%rdx, %rdx
+	movq	%rax, 56(%r15)
+	movq	%rcx, 64(%r15)
+	setne	%al
+	jmp	.L785
+	.p2align 4,,10
+	.p2align 3
+.L904:
+	movq	16(%rbp), %rcx
+	testq	%rcx, %rcx
+	je	.L905
+.L792:
+	cmpl	$2, 8(%rbp)
+	movq	40(%rbp), %rbx
+	je	.L906
+.L799:
+	movq	32(%rbp), %rax
+	movq	%rbx, %r14
+	leaq	1(%r13), %r8
+	movl	$1, 8(%rbp)
+	subq	%rax, %r14
+	cmpq	%r8, %r14
+	jnb	.L804
+	cmpb	$0, 5(%rbp)
+	jne	.L804
+	movzbl	6(%rbp), %esi
+	movb	%sil, 15(%rsp)
+	testb	%sil, %sil
+	jne	.L804
+	testq	%rax, %rax
+	jne	.L907
+.L805:
+	movq	24(%rbp), %r12
+	cmpq	%r12, %r8
+	cmova	%r12, %r8
+	movq	%r8, (%rsp)
+	cmpq	%r8, %rbx
+	jnb	.L860
+	.p2align 4,,10
+	.p2align 3
+.L811:
+	subq	%rbx, %r12
+	movl	0(%rbp), %r14d
+	addq	%rcx, %rbx
+	jmp	.L808
+	.p2align 4,,10
+	.p2align 3
+.L909:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L908
+.L808:
+	movq	%r12, %rdx
+	movq	%rbx, %rsi
+	movl	%r14d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L909
+	movq	40(%rbp), %r14
+	je	.L910
+	leaq	(%rax,%r14), %rbx
+	movq	(%rsp), %rax
+	movq	16(%rbp), %rcx
+	movq	%rbx, 40(%rbp)
+	cmpq	%rax, %rbx
+	jnb	.L911
+	movq	24(%rbp), %r12
+	jmp	.L811
+	.p2align 4,,10
+	.p2align 3
+.L908:
+	movq	40(%rbp), %r14
+	movl	$1, %eax
+.L807:
+	movzbl	15(%rsp), %ecx
+	movb	%al, 6(%rbp)
+	movq	32(%rbp), %rax
+	movb	%cl, 5(%rbp)
+	movq	16(%rbp), %rcx
+	subq	%rax, %r14
+	.p2align 4,,10
+	.p2align 3
+.L804:
+	leaq	(%rcx,%rax), %rbx
+	cmpq	%r14, %r13
+	jb	.L912
+	movq	16(%r15), %rbp
+	testq	%r14, %r14
+	je	.L791
+	leaq	32(%r15), %rdx
+	cmpq	$23, %rbp
+	je	.L843
+	movq	32(%r15), %rdx
+.L843:
+	movq	8(%r15), %rdi
+	leaq	(%r14,%rdi), %rax
+	cmpq	%rdx, %rbx
+	jb	.L844
+	leaq	(%rdx,%rdi), %rcx
+	cmpq	%rcx, %rbx
+	jnb	.L844
+	subq	%rdx, %rbx
+	cmpq	%rax, %rbp
+	jnb	.L850
+	movq	24(%r15), %rdi
+	leaq	10(%rbp,%rbp), %rbp
+	movl	$1, %edx
+	cmpq	%rax, %rbp
+	cmovb	%rax, %rbp
+	movq	(%rdi), %rax
+	leaq	1(%rbp), %rsi
+	call	*16(%rax)
+	cmpq	$23, 16(%r15)
+	leaq	32(%r15), %rsi
+	movq	%rax, %r12
+	movq	8(%r15), %rax
+	leaq	1(%rax), %rdx
+	je	.L852
+	movq	32(%r15), %rsi
+.L852:
+	movq	%r12, %rdi
+	call	memcpy@PLT
+	movq	16(%r15), %rdx
+	cmpq	$23, %rdx
+	je	.L853
+	movq	24(%r15), %rdi
+	movq	32(%r15), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L853:
+	movq	%r12, 32(%r15)
+	movq	8(%r15), %rdi
+	movq	%rbp, 16(%r15)
+.L850:
+	cmpq	$23, %rbp
+	je	.L913
+	movq	32(%r15), %rax
+	addq	%rax, %rbx
+	.p2align 4,,10
+	.p2align 3
+.L856:
+	addq	%rax, %rdi
+	movq	%r14, %rdx
+	movq	%rbx, %rsi
+	movq	%rax, %rbp
+	call	memmove@PLT
+	movq	8(%r15), %rax
+	addq	%r14, %rax
+	movq	%rax, 8(%r15)
+	movb	$0, 0(%rbp,%rax)
+	movq	(%r15), %rbp
+	cmpl	$1, 8(%rbp)
+	jne	.L859
+	movq	32(%rbp), %rdx
+	movq	40(%rbp), %rax
+	subq	%rdx, %rax
+	cmpq	%r14, %rax
+	cmova	%r14, %rax
+	addq	%rdx, %rax
+	movq	%rax, 32(%rbp)
+.L859:
+	xorl	%r13d, %r13d
+	jmp	.L789
+	.p2align 4,,10
+	.p2align 3
+.L912:
+	leaq	(%rbx,%r13), %rbp
+	movq	%r14, %rdx
+	movl	$10, %esi
+	subq	%r13, %rdx
+	movq	%rbp, %rdi
+	call	memchr@PLT
+	testq	%rax, %rax
+	je	.L813
+	subq	%rbp, %rax
+	cmpq	$-1, %rax
+	je	.L813
+	movq	8(%r15), %rdi
+	leaq	0(%r13,%rax), %rbp
+	testq	%rdi, %rdi
+	jne	.L816
+	xorl	%eax, %eax
+	testq	%rbp, %rbp
+	jne	.L914
+.L818:
+	addq	$1, %rbp
+	movq	%rbx, 56(%r15)
+	movq	%rbp, 72(%r15)
+	movq	%rax, 64(%r15)
+	movl	$1, %eax
+.L785:
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L813:
+	.cfi_restore_state
+	movq	(%r15), %rbp
+	movq	%r14, %r13
+	jmp	.L789
+	.p2align 4,,10
+	.p2align 3
+.L914:
+	leaq	-1(%rbp), %rax
+	cmpb	$13, -1(%rbx,%rbp)
+	cmovne	%rbp, %rax
+	jmp	.L818
+	.p2align 4,,10
+	.p2align 3
+.L844:
+	cmpq	%rax, %rbp
+	jnb	.L846
+	movq	24(%r15), %rdi
+	leaq	10(%rbp,%rbp), %rbp
+	movl	$1, %edx
+	cmpq	%rax, %rbp
+	cmovb	%rax, %rbp
+	movq	(%rdi), %rax
+	leaq	1(%rbp), %rsi
+	call	*16(%rax)
+	cmpq	$23, 16(%r15)
+	leaq	32(%r15), %rsi
+	movq	%rax, %r12
+	movq	8(%r15), %rax
+	leaq	1(%rax), %rdx
+	je	.L848
+	movq	32(%r15), %rsi
+.L848:
+	movq	%r12, %rdi
+	call	memcpy@PLT
+	movq	16(%r15), %rdx
+	cmpq	$23, %rdx
+	je	.L849
+	movq	24(%r15), %rdi
+	movq	32(%r15), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L849:
+	movq	%r12, 32(%r15)
+	movq	8(%r15), %rdi
+	movq	%rbp, 16(%r15)
+.L846:
+	leaq	32(%r15), %rax
+	cmpq	$23, %rbp
+	je	.L856
+	movq	32(%r15), %rax
+	jmp	.L856
+	.p2align 4,,10
+	.p2align 3
+.L816:
+	movq	16(%r15), %r12
+	leaq	32(%r15), %rdx
+	cmpq	$23, %r12
+	je	.L820
+	movq	32(%r15), %rdx
+.L820:
+	leaq	0(%rbp,%rdi), %rax
+	cmpq	%rdx, %rbx
+	jb	.L821
+	leaq	(%rdx,%rdi), %rcx
+	cmpq	%rcx, %rbx
+	jnb	.L821
+	subq	%rdx, %rbx
+	cmpq	%rax, %r12
+	jnb	.L827
+	movq	24(%r15), %rdi
+	leaq	10(%r12,%r12), %r12
+	movl	$1, %edx
+	cmpq	%rax, %r12
+	cmovb	%rax, %r12
+	movq	(%rdi), %rax
+	leaq	1(%r12), %rsi
+	call	*16(%rax)
+	cmpq	$23, 16(%r15)
+	leaq	32(%r15), %rsi
+	movq	%rax, %r13
+	movq	8(%r15), %rax
+	leaq	1(%rax), %rdx
+	je	.L829
+	movq	32(%r15), %rsi
+.L829:
+	movq	%r13, %rdi
+	call	memcpy@PLT
+	movq	16(%r15), %rax
+	cmpq	$23, %rax
+	je	.L830
+	movq	24(%r15), %rdi
+	leaq	1(%rax), %rdx
+	movq	32(%r15), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L830:
+	movq	%r13, 32(%r15)
+	movq	8(%r15), %rdi
+	movq	%r12, 16(%r15)
+.L827:
+	cmpq	$23, %r12
+	je	.L915
+	movq	32(%r15), %rax
+	addq	%rax, %rbx
+	.p2align 4,,10
+	.p2align 3
+.L833:
+	addq	%rax, %rdi
+	movq	%rbx, %rsi
+	movq	%rbp, %rdx
+	movq	%rax, %r12
+	call	memmove@PLT
+	movq	8(%r15), %rax
+	leaq	32(%r15), %rbx
+	addq	%rbp, %rax
+	movq	%rax, 8(%r15)
+	movb	$0, (%r12,%rax)
+	cmpq	$23, 16(%r15)
+	movq	8(%r15), %rax
+	je	.L836
+	movq	32(%r15), %rbx
+.L836:
+	testq	%rax, %rax
+	je	.L818
+	leaq	-1(%rax), %rdx
+	cmpb	$13, -1(%rbx,%rax)
+	cmove	%rdx, %rax
+	jmp	.L818
+	.p2align 4,,10
+	.p2align 3
+.L821:
+	cmpq	%rax, %r12
+	jnb	.L823
+	movq	24(%r15), %rdi
+	leaq	10(%r12,%r12), %r12
+	movl	$1, %edx
+	cmpq	%rax, %r12
+	cmovb	%rax, %r12
+	movq	(%rdi), %rax
+	leaq	1(%r12), %rsi
+	call	*16(%rax)
+	cmpq	$23, 16(%r15)
+	leaq	32(%r15), %rsi
+	movq	%rax, %r13
+	movq	8(%r15), %rax
+	leaq	1(%rax), %rdx
+	je	.L825
+	movq	32(%r15), %rsi
+.L825:
+	movq	%r13, %rdi
+	call	memcpy@PLT
+	movq	16(%r15), %rax
+	cmpq	$23, %rax
+	je	.L826
+	movq	24(%r15), %rdi
+	leaq	1(%rax), %rdx
+	movq	32(%r15), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L826:
+	movq	%r13, 32(%r15)
+	movq	8(%r15), %rdi
+	movq	%r12, 16(%r15)
+.L823:
+	leaq	32(%r15), %rax
+	cmpq	$23, %r12
+	je	.L833
+	movq	32(%r15), %rax
+	jmp	.L833
+	.p2align 4,,10
+	.p2align 3
+.L905:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L916
+.L794:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbp), %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, 16(%rbp)
+	movq	%rax, %rcx
+	testq	%rax, %rax
+	je	.L791
+	jmp	.L792
+	.p2align 4,,10
+	.p2align 3
+.L916:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L794
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L794
+	.p2align 4,,10
+	.p2align 3
+.L906:
+	testq	%rbx, %rbx
+	je	.L799
+	movl	0(%rbp), %r12d
+.L803:
+	movq	%rcx, %rsi
+	movq	%rbx, %rdx
+	movl	%r12d, %edi
+	movq	%rcx, (%rsp)
+	call	write@PLT
+	movq	(%rsp), %rcx
+	testq	%rax, %rax
+	js	.L917
+	addq	%rax, %rcx
+	subq	%rax, %rbx
+	jne	.L803
+.L802:
+	movq	$0, 40(%rbp)
+	movq	16(%rbp), %rcx
+	xorl	%ebx, %ebx
+	jmp	.L799
+	.p2align 4,,10
+	.p2align 3
+.L913:
+	leaq	32(%r15), %rax
+	addq	%rax, %rbx
+	jmp	.L856
+.L915:
+	leaq	32(%r15), %rax
+	addq	%rax, %rbx
+	jmp	.L833
+.L917:
+	call	__errno_location@PLT
+	movq	(%rsp), %rcx
+	cmpl	$4, (%rax)
+	jne	.L802
+	jmp	.L803
+.L911:
+	movq	32(%rbp), %rax
+	subq	%rax, %rbx
+	movq	%rbx, %r14
+	jmp	.L804
+.L907:
+	leaq	(%rcx,%rax), %rsi
+	movq	%r14, %rdx
+	movq	%rcx, %rdi
+	movq	%r8, (%rsp)
+	call	memmove@PLT
+	movq	40(%rbp), %rax
+	subq	32(%rbp), %rax
+	movq	$0, 32(%rbp)
+	movq	%rax, 40(%rbp)
+	movq	16(%rbp), %rcx
+	movq	%rax, %rbx
+	movq	%rax, %r14
+	movq	(%rsp), %r8
+	jmp	.L805
+.L910:
+	movb	$1, 15(%rsp)
+	xorl	%eax, %eax
+	jmp	.L807
+.L860:
+	xorl	%eax, %eax
+	jmp	.L804
+	.cfi_endproc
+.LFE6996:
+	.size	_ZN1n11line_readerINS_4fileIcLNS_4modeE0EEEE9__advanceEv, .-_ZN1n11line_readerINS_4fileIcLNS_4modeE0EEEE9__advanceEv
+	.section	.rodata.str1.8
+	.align 8
+.LC34:
+	.string	"expected false : n::lines(f).has_next()"
+	.section	.text.unlikely
+.LCOLDB35:
+	.text
+.LHOTB35:
+	.p2align 4
+	.globl	_Z16test_lines_emptyv
+	.type	_Z16test_lines_emptyv, @function
+_Z16test_lines_emptyv:
+.LFB6905:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6905
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pxor	%xmm0, %xmm0
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$160, %rsp
+	.cfi_def_cfa_offset 192
+	movaps	%xmm0, 64(%rsp)
+	movaps	%xmm0, 80(%rsp)
+	movq	$23, 72(%rsp)
+	movaps	%xmm0, 96(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L1007
+.L919:
+	leaq	64(%rsp), %rbx
+	pxor	%xmm0, %xmm0
+	movq	%rax, 80(%rsp)
+	movq	%rbx, %rdi
+	movups	%xmm0, 88(%rsp)
+	movq	$0, 104(%rsp)
+.LEHB28:
+	call	_Z10write_fileRKN1n6stringIcEE
+.LEHE28:
+	movq	72(%rsp), %rdx
+	cmpq	$23, %rdx
+	je	.L923
+	movq	80(%rsp), %rdi
+	movq	88(%rsp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L923:
+	movl	$438, %edx
+	movl	$524288, %esi
+	xorl	%eax, %eax
+	movq	%rsp, %rbp
+	movq	path(%rip), %rdi
+.LEHB29:
+	call	open@PLT
+.LEHE29:
+	movdqa	.LC17(%rip), %xmm0
+	movb	$0, 6(%rsp)
+	movl	%eax, (%rsp)
+	movzwl	.LC16(%rip), %eax
+	movups	%xmm0, 24(%rsp)
+	movdqa	.LC19(%rip), %xmm0
+	movw	%ax, 4(%rsp)
+	movq	$0, 8(%rsp)
+	movq	$0, 16(%rsp)
+	movq	$0, 40(%rsp)
+	movq	$0, 48(%rsp)
+	movq	%rbp, 64(%rsp)
+	movups	%xmm0, 72(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L1008
+.L924:
+	pxor	%xmm0, %xmm0
+	movq	%rbx, %rdi
+	movq	%rax, 88(%rsp)
+	movaps	%xmm0, 96(%rsp)
+	pxor	%xmm0, %xmm0
+	movq	$0, 112(%rsp)
+	movq	$0, 120(%rsp)
+	movb	$0, 144(%rsp)
+	movaps	%xmm0, 128(%rsp)
+.LEHB30:
+	call	_ZN1n11line_readerINS_4fileIcLNS_4modeE0EEEE9__advanceEv
+.LEHE30:
+	movq	80(%rsp), %rdx
+	movb	%al, 144(%rsp)
+	movl	%eax, %ebx
+	cmpq	$23, %rdx
+	je	.L928
+	movq	88(%rsp), %rdi
+	movq	96(%rsp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L928:
+	testb	%bl, %bl
+	jne	.L1003
+	movq	path(%rip), %rdi
+	call	remove@PLT
+	movl	(%rsp), %ebx
+	testl	%ebx, %ebx
+	js	.L930
+	cmpl	$2, 8(%rsp)
+	je	.L1009
+.L931:
+	cmpb	$0, 4(%rsp)
+	jne	.L1010
+.L936:
+	movl	$-1, (%rsp)
+.L930:
+	cmpq	$0, 16(%rsp)
+	je	.L937
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1011
+.L939:
+	movq	24(%rsp), %rdx
+	movq	16(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	$0, 16(%rsp)
+.L937:
+	movq	48(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 8(%rsp)
+	movaps	%xmm0, 32(%rsp)
+	testq	%rdi, %rdi
+	je	.L941
+	call	fclose@PLT
+	movl	(%rsp), %ebx
+	movq	$0, 48(%rsp)
+	testl	%ebx, %ebx
+	js	.L1005
+	cmpl	$2, 8(%rsp)
+	jne	.L945
+	movq	40(%rsp), %rbp
+	testq	%rbp, %rbp
+	jne	.L1012
+.L945:
+	cmpb	$0, 4(%rsp)
+	jne	.L1013
+.L951:
+	movl	$-1, (%rsp)
+.L1005:
+	movq	16(%rsp), %rax
+	testq	%rax, %rax
+	je	.L918
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1014
+.L954:
+	movq	24(%rsp), %rdx
+	movq	16(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L918:
+	addq	$160, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1009:
+	.cfi_restore_state
+	movq	40(%rsp), %rbp
+	testq	%rbp, %rbp
+	je	.L931
+	movq	16(%rsp), %r12
+.L935:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1015
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L935
+	.p2align 4,,10
+	.p2align 3
+.L934:
+	movq	$0, 40(%rsp)
+	jmp	.L931
+	.p2align 4,,10
+	.p2align 3
+.L941:
+	movl	(%rsp), %eax
+	testl	%eax, %eax
+	js	.L918
+	cmpb	$0, 4(%rsp)
+	je	.L951
+.L1013:
+	movl	(%rsp), %edi
+	call	close@PLT
+	jmp	.L951
+	.p2align 4,,10
+	.p2align 3
+.L1010:
+	movl	(%rsp), %edi
+	call	close@PLT
+	jmp	.L936
+	.p2align 4,,10
+	.p2align 3
+.L1014:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L954
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L954
+	.p2align 4,,10
+	.p2align 3
+.L1011:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L939
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L939
+	.p2align 4,,10
+	.p2align 3
+.L1012:
+	movq	16(%rsp), %r12
+.L950:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1016
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L950
+	.p2align 4,,10
+	.p2align 3
+.L949:
+	movq	$0, 40(%rsp)
+	jmp	.L945
+	.p2align 4,,10
+	.p2align 3
+.L1007:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1017
+.L921:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	jmp	.L919
+	.p2align 4,,10
+	.p2align 3
+.L1008:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1018
+.L926:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	jmp	.L924
+	.p2align 4,,10
+	.p2align 3
+.L1016:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L949
+	jmp	.L950
+	.p2align 4,,10
+	.p2align 3
+.L1015:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L934
+	jmp	.L935
+	.p2align 4,,10
+	.p2align 3
+.L1018:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L926
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L926
+	.p2align 4,,10
+	.p2align 3
+.L1017:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L921
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L921
+.L962:
+	movq	%rax, %rbx
+	jmp	.L958
+.L961:
+	movq	%rax, %rbx
+	jmp	.L956
+	.section	.gcc_except_table
+.LLSDA6905:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6905-.LLSDACSB6905
+.LLSDACSB6905:
+	.uleb128 .LEHB28-.LFB6905
+	.uleb128 .LEHE28-.LEHB28
+	.uleb128 .L961-.LFB6905
+	.uleb128 0
+	.uleb128 .LEHB29-.LFB6905
+	.uleb128 .LEHE29-.LEHB29
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB30-.LFB6905
+	.uleb128 .LEHE30-.LEHB30
+	.uleb128 .L962-.LFB6905
+	.uleb128 0
+.LLSDACSE6905:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6905
+	.type	_Z16test_lines_emptyv.cold, @function
+_Z16test_lines_emptyv.cold:
+.LFSB6905:
+.L1003:
+	.cfi_def_cfa_offset 192
+	.cfi_offset 3, -32
+	.cfi_offset 6, -24
+	.cfi_offset 12, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC34(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB31:
+	call	__cxa_throw@PLT
+.LEHE31:
+.L963:
+	movq	%rax, %rbx
+.L960:
+	movq	%rbp, %rdi
+	call	_ZN1n4fileIcLNS_4modeE0EE5closeEv
+	movq	%rbp, %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB32:
+	call	_Unwind_Resume@PLT
+.LEHE32:
+.L958:
+	movq	80(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L960
+	movq	88(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	96(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L960
+.L956:
+	movq	72(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L957
+	movq	80(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	88(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L957:
+	movq	%rbx, %rdi
+.LEHB33:
+	call	_Unwind_Resume@PLT
+.LEHE33:
+	.cfi_endproc
+.LFE6905:
+	.section	.gcc_except_table
+.LLSDAC6905:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6905-.LLSDACSBC6905
+.LLSDACSBC6905:
+	.uleb128 .LEHB31-.LCOLDB35
+	.uleb128 .LEHE31-.LEHB31
+	.uleb128 .L963-.LCOLDB35
+	.uleb128 0
+	.uleb128 .LEHB32-.LCOLDB35
+	.uleb128 .LEHE32-.LEHB32
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB33-.LCOLDB35
+	.uleb128 .LEHE33-.LEHB33
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6905:
+	.section	.text.unlikely
+	.text
+	.size	_Z16test_lines_emptyv, .-_Z16test_lines_emptyv
+	.section	.text.unlikely
+	.size	_Z16test_lines_emptyv.cold, .-_Z16test_lines_emptyv.cold
+.LCOLDE35:
+	.text
+.LHOTE35:
+	.section	.text._Z7collectIN1n11line_readerINS0_4fileIcLNS0_4modeE0EEEEEENS0_6vectorINS0_6stringIcEEEET_,"axG",@progbits,_Z7collectIN1n11line_readerINS0_4fileIcLNS0_4modeE0EEEEEENS0_6vectorINS0_6stringIcEEEET_,comdat
+	.p2align 4
+	.weak	_Z7collectIN1n11line_readerINS0_4fileIcLNS0_4modeE0EEEEEENS0_6vectorINS0_6stringIcEEEET_
+	.type	_Z7collectIN1n11line_readerINS0_4fileIcLNS0_4modeE0EEEEEENS0_6vectorINS0_6stringIcEEEET_, @function
+_Z7collectIN1n11line_readerINS0_4fileIcLNS0_4modeE0EEEEEENS0_6vectorINS0_6stringIcEEEET_:
+.LFB6961:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6961
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pxor	%xmm0, %xmm0
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rsi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	$0, (%rdi)
+	movups	%xmm0, 8(%rdi)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L1093
+.L1020:
+	movq	%rax, 24(%rbp)
+	leaq	72(%rsp), %rax
+	movq	%rax, 40(%rsp)
+	jmp	.L1024
+	.p2align 4,,10
+	.p2align 3
+.L1054:
+	movq	56(%r13), %rax
+	movq	64(%r13), %r12
+	movb	$0, 80(%r13)
+	movdqa	.LC19(%rip), %xmm1
+	movq	%rax, 16(%rsp)
+	movaps	%xmm1, 48(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbx
+	testq	%rbx, %rbx
+	je	.L1025
+	movq	40(%rsp), %rcx
+	pxor	%xmm0, %xmm0
+	movq	%rbx, 64(%rsp)
+	movq	$0, 88(%rsp)
+	movups	%xmm0, 72(%rsp)
+	movq	%rcx, %rdx
+	cmpq	%rcx, %rax
+	jnb	.L1059
+	movq	$0, 8(%rsp)
+	movq	%r12, %rax
+.L1027:
+	cmpq	$23, %rax
+	jbe	.L1063
+	movq	%rdx, 24(%rsp)
+	movq	%rbx, %r15
+	movl	$23, %r14d
+.L1058:
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 32(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+.LEHB34:
+	call	*16(%rax)
+	movq	%rax, %rbx
+	movq	8(%rsp), %rax
+	movq	24(%rsp), %rsi
+	movq	%rbx, %rdi
+	leaq	1(%rax), %rdx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L1034
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L1034:
+	movq	32(%rsp), %rax
+	movq	%rbx, 72(%rsp)
+	movq	%rax, 56(%rsp)
+.L1033:
+	cmpq	$23, 32(%rsp)
+	je	.L1094
+.L1038:
+	movq	8(%rsp), %rdi
+	movq	16(%rsp), %rsi
+	movq	%r12, %rdx
+	addq	%rbx, %rdi
+	call	memmove@PLT
+	addq	48(%rsp), %r12
+	movq	%r12, 48(%rsp)
+	movb	$0, (%rbx,%r12)
+	movq	16(%rbp), %rax
+	movq	8(%rbp), %rbx
+	cmpq	%rbx, %rax
+	je	.L1095
+	movdqa	.LC19(%rip), %xmm2
+	leaq	(%rax,%rax,2), %rbx
+	salq	$4, %rbx
+	addq	0(%rbp), %rbx
+	movups	%xmm2, (%rbx)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L1096
+.L1050:
+	movq	64(%rsp), %rax
+	movdqa	48(%rsp), %xmm3
+	pxor	%xmm0, %xmm0
+	movq	$0, 40(%rbx)
+	movups	%xmm0, 24(%rbx)
+	movq	%rax, 16(%rbx)
+	movq	56(%rsp), %rax
+	movups	%xmm3, (%rbx)
+	cmpq	$23, %rax
+	je	.L1097
+	movq	72(%rsp), %rax
+	movq	%rax, 24(%rbx)
+	movq	16(%rbp), %rax
+	addq	$1, %rax
+.L1053:
+	movq	%rax, 16(%rbp)
+.L1024:
+	cmpb	$0, 80(%r13)
+	jne	.L1054
+	movq	%r13, %rdi
+	call	_ZN1n11line_readerINS_4fileIcLNS_4modeE0EEEE9__advanceEv
+.LEHE34:
+	movb	%al, 80(%r13)
+	testb	%al, %al
+	jne	.L1054
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbp, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1094:
+	.cfi_restore_state
+	movq	40(%rsp), %rdx
+.L1063:
+	movq	%rdx, %rbx
+	jmp	.L1038
+	.p2align 4,,10
+	.p2align 3
+.L1095:
+	leaq	5(%rbx), %rax
+	movq	24(%rbp), %rdi
+	movq	0(%rbp), %r12
+	movl	$8, %edx
+	leaq	(%rax,%rax), %rsi
+	movq	%rsi, 8(%rbp)
+	addq	%rax, %rsi
+	movq	(%rdi), %rax
+	salq	$5, %rsi
+.LEHB35:
+	call	*16(%rax)
+	movq	16(%rbp), %rdx
+	movdqa	.LC19(%rip), %xmm4
+	movq	%rax, 0(%rbp)
+	leaq	(%rdx,%rdx,2), %rdx
+	salq	$4, %rdx
+	leaq	(%rax,%rdx), %r14
+	movups	%xmm4, (%r14)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L1098
+.L1042:
+	movq	64(%rsp), %rax
+	movdqa	48(%rsp), %xmm5
+	pxor	%xmm0, %xmm0
+	movq	$0, 40(%r14)
+	movups	%xmm0, 24(%r14)
+	movq	%rax, 16(%r14)
+	movq	56(%rsp), %rax
+	movups	%xmm5, (%r14)
+	cmpq	$23, %rax
+	je	.L1099
+	movq	$23, 56(%rsp)
+	movq	72(%rsp), %rax
+	movq	%rax, 24(%r14)
+.L1045:
+	movq	16(%rbp), %rax
+	movq	0(%rbp), %rdi
+	movb	$0, 72(%rsp)
+	movq	$0, 48(%rsp)
+	testq	%rax, %rax
+	jne	.L1100
+	testq	%r12, %r12
+	je	.L1048
+.L1047:
+	movq	24(%rbp), %rdi
+	leaq	(%rbx,%rbx,2), %rdx
+	movl	$8, %ecx
+	movq	%r12, %rsi
+	salq	$4, %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE35:
+.L1092:
+	movq	16(%rbp), %rax
+.L1048:
+	addq	$1, %rax
+	jmp	.L1053
+	.p2align 4,,10
+	.p2align 3
+.L1025:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1101
+.L1029:
+	movq	48(%rsp), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	pxor	%xmm0, %xmm0
+	movq	$0, 88(%rsp)
+	movq	56(%rsp), %r14
+	movups	%xmm0, 72(%rsp)
+	movq	%rax, 8(%rsp)
+	addq	%r12, %rax
+	movq	%r15, 64(%rsp)
+	movq	$0, 24(%rsp)
+	cmpq	$23, %r14
+	je	.L1102
+.L1031:
+	movq	24(%rsp), %rcx
+	movq	8(%rsp), %rsi
+	leaq	(%rcx,%rsi), %rdx
+	cmpq	%rdx, 16(%rsp)
+	jnb	.L1026
+	movq	%rcx, %rsi
+	movq	16(%rsp), %rcx
+	subq	%rsi, %rcx
+	movq	%rcx, 16(%rsp)
+	cmpq	%rax, %r14
+	jnb	.L1035
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 32(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+.LEHB36:
+	call	*16(%rax)
+	movq	%rax, %rbx
+	movq	8(%rsp), %rax
+	movq	24(%rsp), %rsi
+	movq	%rbx, %rdi
+	leaq	1(%rax), %rdx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L1036
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.LEHE36:
+.L1036:
+	movq	32(%rsp), %rax
+	movq	%rbx, 72(%rsp)
+	movq	%rax, 56(%rsp)
+	movq	%rax, %r14
+.L1035:
+	cmpq	$23, %r14
+	je	.L1037
+	movq	16(%rsp), %rax
+	addq	%rbx, %rax
+	movq	%rax, 16(%rsp)
+	jmp	.L1038
+	.p2align 4,,10
+	.p2align 3
+.L1059:
+	movq	%rcx, 24(%rsp)
+	movq	%rbx, %r15
+	movq	%r12, %rax
+	movl	$23, %r14d
+	movq	$0, 8(%rsp)
+.L1026:
+	cmpq	%rax, %r14
+	jb	.L1058
+	movq	%r14, 32(%rsp)
+	xorl	%ebx, %ebx
+	jmp	.L1033
+	.p2align 4,,10
+	.p2align 3
+.L1097:
+	movdqu	72(%rsp), %xmm6
+	movq	88(%rsp), %rax
+	movups	%xmm6, 24(%rbx)
+	movq	%rax, 40(%rbx)
+	jmp	.L1092
+	.p2align 4,,10
+	.p2align 3
+.L1096:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L1050
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1050
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1050
+	.p2align 4,,10
+	.p2align 3
+.L1100:
+	leaq	(%rax,%rax,2), %rdx
+	movq	%r12, %rsi
+	salq	$4, %rdx
+	call	memcpy@PLT
+	jmp	.L1047
+	.p2align 4,,10
+	.p2align 3
+.L1037:
+	movq	16(%rsp), %rax
+	leaq	72(%rsp), %rdx
+	movq	%rdx, %rbx
+	addq	%rdx, %rax
+	movq	%rax, 16(%rsp)
+	jmp	.L1038
+	.p2align 4,,10
+	.p2align 3
+.L1099:
+	movdqu	72(%rsp), %xmm7
+	movq	88(%rsp), %rax
+	movups	%xmm7, 24(%r14)
+	movq	%rax, 40(%r14)
+	jmp	.L1045
+	.p2align 4,,10
+	.p2align 3
+.L1098:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L1042
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r15
+	movq	%r15, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1042
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r15, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1042
+	.p2align 4,,10
+	.p2align 3
+.L1101:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r14
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1029
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r14, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1029
+	.p2align 4,,10
+	.p2align 3
+.L1093:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1103
+.L1022:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	jmp	.L1020
+.L1103:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1022
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1022
+.L1102:
+	leaq	72(%rsp), %rdx
+	cmpq	%rdx, 16(%rsp)
+	jnb	.L1104
+	movq	%r15, %rbx
+	jmp	.L1027
+.L1104:
+	movq	%rdx, 24(%rsp)
+	jmp	.L1031
+.L1065:
+	movq	%rax, %rbx
+	jmp	.L1057
+.L1064:
+	movq	%rax, %rbx
+.L1055:
+	movq	56(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L1057
+	movq	64(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	72(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1057:
+	movq	%rbp, %rdi
+	call	_ZN1n6vectorINS_6stringIcEEE9__releaseEv
+	movq	%rbx, %rdi
+.LEHB37:
+	call	_Unwind_Resume@PLT
+.LEHE37:
+	.cfi_endproc
+.LFE6961:
+	.section	.gcc_except_table
+.LLSDA6961:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6961-.LLSDACSB6961
+.LLSDACSB6961:
+	.uleb128 .LEHB34-.LFB6961
+	.uleb128 .LEHE34-.LEHB34
+	.uleb128 .L1065-.LFB6961
+	.uleb128 0
+	.uleb128 .LEHB35-.LFB6961
+	.uleb128 .LEHE35-.LEHB35
+	.uleb128 .L1064-.LFB6961
+	.uleb128 0
+	.uleb128 .LEHB36-.LFB6961
+	.uleb128 .LEHE36-.LEHB36
+	.uleb128 .L1065-.LFB6961
+	.uleb128 0
+	.uleb128 .LEHB37-.LFB6961
+	.uleb128 .LEHE37-.LEHB37
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6961:
+	.section	.text._Z7collectIN1n11line_readerINS0_4fileIcLNS0_4modeE0EEEEEENS0_6vectorINS0_6stringIcEEEET_,"axG",@progbits,_Z7collectIN1n11line_readerINS0_4fileIcLNS0_4modeE0EEEEEENS0_6vectorINS0_6stringIcEEEET_,comdat
+	.size	_Z7collectIN1n11line_readerINS0_4fileIcLNS0_4modeE0EEEEEENS0_6vectorINS0_6stringIcEEEET_, .-_Z7collectIN1n11line_readerINS0_4fileIcLNS0_4modeE0EEEEEENS0_6vectorINS0_6stringIcEEEET_
+	.section	.rodata.str1.1
+.LC36:
+	.string	"alpha\nbeta\r\n\ngamma"
+.LC37:
+	.string	"beta"
+.LC38:
+	.string	"gamma"
+	.section	.rodata.str1.8
+	.align 8
+.LC39:
+	.string	"expected true : v.data()[1] == n::str(\"beta\")"
+	.align 8
+.LC40:
+	.string	"expected true : v.data()[3] == n::str(\"gamma\")"
+	.section	.text.unlikely
+.LCOLDB41:
+	.text
+.LHOTB41:
+	.p2align 4
+	.globl	_Z18test_lines_of_filev
+	.type	_Z18test_lines_of_filev, @function
+_Z18test_lines_of_filev:
+.LFB6896:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6896
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$248, %rsp
+	.cfi_def_cfa_offset 304
+	movdqa	.LC19(%rip), %xmm1
+	movaps	%xmm1, 144(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbx
+	testq	%rbx, %rbx
+	je	.L1106
+	pxor	%xmm0, %xmm0
+	leaq	168(%rsp), %rbp
+	xorl	%edi, %edi
+	movq	%rbx, 160(%rsp)
+	leaq	.LC36(%rip), %rsi
+	movups	%xmm0, 168(%rsp)
+	movq	$0, 184(%rsp)
+	cmpq	%rbp, %rsi
+	jb	.L1246
+.L1350:
+	leaq	.LC36(%rip), %rsi
+.L1246:
+	movq	%rbp, %rbx
+.L1107:
+	addq	%rbx, %rdi
+	movl	$18, %edx
+	call	memmove@PLT
+	movq	144(%rsp), %rax
+	leaq	18(%rax), %rdx
+	movq	%rdx, 144(%rsp)
+	movb	$0, 18(%rbx,%rax)
+	leaq	144(%rsp), %rbx
+	movq	%rbx, %rdi
+.LEHB38:
+	call	_Z10write_fileRKN1n6stringIcEE
+.LEHE38:
+	movq	152(%rsp), %rdx
+	cmpq	$23, %rdx
+	je	.L1122
+	movq	160(%rsp), %rdi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1122:
+	movq	path(%rip), %rdi
+	movl	$438, %edx
+	movl	$524288, %esi
+	xorl	%eax, %eax
+.LEHB39:
+	call	open@PLT
+.LEHE39:
+	movdqa	.LC17(%rip), %xmm0
+	movb	$0, 86(%rsp)
+	movl	%eax, 80(%rsp)
+	movzwl	.LC16(%rip), %eax
+	movdqa	.LC19(%rip), %xmm2
+	movups	%xmm0, 104(%rsp)
+	movw	%ax, 84(%rsp)
+	leaq	80(%rsp), %rax
+	movq	$0, 88(%rsp)
+	movq	$0, 96(%rsp)
+	movq	$0, 120(%rsp)
+	movq	$0, 128(%rsp)
+	movq	%rax, 32(%rsp)
+	movq	%rax, 144(%rsp)
+	movups	%xmm2, 152(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L1362
+.L1123:
+	pxor	%xmm0, %xmm0
+	leaq	48(%rsp), %rdi
+	movq	%rbx, %rsi
+	movq	%rax, 168(%rsp)
+	movaps	%xmm0, 176(%rsp)
+	pxor	%xmm0, %xmm0
+	movq	$0, 192(%rsp)
+	movq	$0, 200(%rsp)
+	movb	$0, 224(%rsp)
+	movq	%rdi, 24(%rsp)
+	movaps	%xmm0, 208(%rsp)
+.LEHB40:
+	call	_Z7collectIN1n11line_readerINS0_4fileIcLNS0_4modeE0EEEEEENS0_6vectorINS0_6stringIcEEEET_
+.LEHE40:
+	movq	160(%rsp), %rdx
+	cmpq	$23, %rdx
+	je	.L1127
+	movq	168(%rsp), %rdi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	176(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1127:
+	cmpq	$4, 64(%rsp)
+	jne	.L1348
+	movdqa	.LC19(%rip), %xmm3
+	movaps	%xmm3, 144(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L1129
+	movq	%rax, 160(%rsp)
+	pxor	%xmm0, %xmm0
+	leaq	168(%rsp), %rbp
+	leaq	.LC37(%rip), %rax
+	movq	$0, 184(%rsp)
+	xorl	%r13d, %r13d
+	movups	%xmm0, 168(%rsp)
+	cmpq	%rbp, %rax
+	jb	.L1130
+.L1351:
+	leaq	.LC37(%rip), %rax
+	.p2align 4,,10
+	.p2align 3
+.L1130:
+	movl	(%rax), %eax
+	movq	48(%rsp), %r12
+	movl	%eax, 0(%rbp,%r13)
+	movq	144(%rsp), %rax
+	leaq	4(%rax), %rdx
+	movq	%rdx, 144(%rsp)
+	movb	$0, 4(%rbp,%rax)
+	movq	48(%r12), %rdx
+	movq	152(%rsp), %rbx
+	cmpq	144(%rsp), %rdx
+	je	.L1363
+.L1143:
+	cmpq	$23, %rbx
+	je	.L1153
+	movq	160(%rsp), %rdi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1153:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC39(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB41:
+	call	__cxa_throw@PLT
+.LEHE41:
+	.p2align 4,,10
+	.p2align 3
+.L1363:
+	cmpq	$23, %rbx
+	je	.L1364
+	movq	168(%rsp), %rax
+	cmpq	$23, 56(%r12)
+	movq	%rax, %rsi
+	je	.L1365
+	testq	%rdx, %rdx
+	je	.L1149
+	movq	72(%r12), %rdi
+.L1150:
+	movq	%rax, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L1143
+	movq	168(%rsp), %rsi
+	cmpq	$23, %rbx
+	je	.L1146
+.L1149:
+	movq	160(%rsp), %rdi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1146:
+	movq	96(%r12), %rbx
+	testq	%rbx, %rbx
+	jne	.L1349
+	movdqa	.LC19(%rip), %xmm4
+	movaps	%xmm4, 144(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L1155
+	pxor	%xmm0, %xmm0
+	leaq	168(%rsp), %rbp
+	xorl	%r13d, %r13d
+	movq	%rax, 160(%rsp)
+	leaq	.LC38(%rip), %rsi
+	movups	%xmm0, 168(%rsp)
+	movq	$0, 184(%rsp)
+	cmpq	%rbp, %rsi
+	jb	.L1156
+.L1353:
+	leaq	.LC38(%rip), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L1156:
+	leaq	0(%rbp,%r13), %rdi
+	movl	$5, %edx
+	call	memmove@PLT
+	movq	144(%rsp), %rax
+	leaq	5(%rax), %rdx
+	movq	%rdx, 144(%rsp)
+	movb	$0, 5(%rbp,%rax)
+	movq	144(%r12), %rdx
+	movq	152(%rsp), %rbp
+	cmpq	144(%rsp), %rdx
+	je	.L1366
+.L1169:
+	cmpq	$23, %rbp
+	je	.L1179
+	movq	160(%rsp), %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1179:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC40(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB42:
+	call	__cxa_throw@PLT
+.LEHE42:
+	.p2align 4,,10
+	.p2align 3
+.L1365:
+	leaq	72(%r12), %rdi
+	testq	%rdx, %rdx
+	jne	.L1150
+	jmp	.L1149
+	.p2align 4,,10
+	.p2align 3
+.L1366:
+	cmpq	$23, %rbp
+	je	.L1367
+	movq	168(%rsp), %rax
+	cmpq	$23, 152(%r12)
+	movq	%rax, %rsi
+	je	.L1368
+	testq	%rdx, %rdx
+	je	.L1175
+	movq	168(%r12), %rdi
+.L1176:
+	movq	%rax, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L1169
+	movq	168(%rsp), %rsi
+	cmpq	$23, %rbp
+	je	.L1172
+.L1175:
+	movq	160(%rsp), %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1172:
+	movq	path(%rip), %rdi
+	call	remove@PLT
+	movq	48(%rsp), %r13
+	movq	64(%rsp), %r12
+	movq	%r13, %rbp
+	testq	%r12, %r12
+	je	.L1185
+	.p2align 4,,10
+	.p2align 3
+.L1186:
+	movq	8(%rbp), %rdx
+	cmpq	$23, %rdx
+	je	.L1183
+	movq	16(%rbp), %rdi
+	addq	$1, %rbx
+	movq	24(%rbp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	addq	$48, %rbp
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	%rbx, %r12
+	jne	.L1186
+.L1185:
+	testq	%r13, %r13
+	je	.L1182
+	movq	56(%rsp), %rax
+	movq	72(%rsp), %rdi
+	movl	$8, %ecx
+	movq	%r13, %rsi
+	leaq	(%rax,%rax,2), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+	call	*24(%rax)
+.L1182:
+	movl	80(%rsp), %ebx
+	testl	%ebx, %ebx
+	js	.L1187
+	cmpl	$2, 88(%rsp)
+	je	.L1369
+.L1188:
+	cmpb	$0, 84(%rsp)
+	jne	.L1370
+.L1193:
+	movl	$-1, 80(%rsp)
+.L1187:
+	cmpq	$0, 96(%rsp)
+	je	.L1194
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1371
+.L1196:
+	movq	104(%rsp), %rdx
+	movq	96(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	$0, 96(%rsp)
+.L1194:
+	movq	128(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 88(%rsp)
+	movaps	%xmm0, 112(%rsp)
+	testq	%rdi, %rdi
+	je	.L1198
+	call	fclose@PLT
+	movl	80(%rsp), %ebx
+	movq	$0, 128(%rsp)
+	testl	%ebx, %ebx
+	js	.L1360
+	cmpl	$2, 88(%rsp)
+	jne	.L1202
+	movq	120(%rsp), %rbp
+	testq	%rbp, %rbp
+	jne	.L1372
+.L1202:
+	cmpb	$0, 84(%rsp)
+	jne	.L1373
+.L1208:
+	movl	$-1, 80(%rsp)
+.L1360:
+	movq	96(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1105
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1374
+.L1211:
+	movq	104(%rsp), %rdx
+	movq	96(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1105:
+	addq	$248, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1183:
+	.cfi_restore_state
+	addq	$1, %rbx
+	addq	$48, %rbp
+	cmpq	%rbx, %r12
+	jne	.L1186
+	jmp	.L1185
+	.p2align 4,,10
+	.p2align 3
+.L1198:
+	movl	80(%rsp), %eax
+	testl	%eax, %eax
+	js	.L1105
+	cmpb	$0, 84(%rsp)
+	je	.L1208
+.L1373:
+	movl	80(%rsp), %edi
+	call	close@PLT
+	jmp	.L1208
+	.p2align 4,,10
+	.p2align 3
+.L1369:
+	movq	120(%rsp), %rbp
+	testq	%rbp, %rbp
+	je	.L1188
+	movq	96(%rsp), %r12
+.L1192:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1375
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L1192
+.L1191:
+	movq	$0, 120(%rsp)
+	jmp	.L1188
+	.p2align 4,,10
+	.p2align 3
+.L1370:
+	movl	80(%rsp), %edi
+	call	close@PLT
+	jmp	.L1193
+	.p2align 4,,10
+	.p2align 3
+.L1371:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1196
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1196
+	.p2align 4,,10
+	.p2align 3
+.L1374:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1211
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1211
+	.p2align 4,,10
+	.p2align 3
+.L1155:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1376
+.L1160:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	144(%rsp), %r13
+	pxor	%xmm0, %xmm0
+	movq	$0, 184(%rsp)
+	movq	152(%rsp), %r14
+	movups	%xmm0, 168(%rsp)
+	leaq	.LC38(%rip), %rsi
+	movq	%r15, 160(%rsp)
+	leaq	5(%r13), %rax
+	movq	$0, 16(%rsp)
+	cmpq	$23, %r14
+	je	.L1377
+.L1162:
+	movq	16(%rsp), %rcx
+	leaq	(%rcx,%r13), %rdx
+	cmpq	%rdx, %rsi
+	jnb	.L1378
+	movq	16(%rsp), %rcx
+	movq	%rsi, %rdi
+	subq	%rcx, %rdi
+	movq	%rdi, 40(%rsp)
+	cmpq	%rax, %r14
+	jnb	.L1242
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 8(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+.LEHB43:
+	call	*16(%rax)
+	movq	16(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L1166
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L1166:
+	movq	8(%rsp), %rax
+	movq	%rbp, 168(%rsp)
+	movq	%rax, 152(%rsp)
+	movq	%rax, %r14
+.L1165:
+	cmpq	$23, %r14
+	jne	.L1358
+	leaq	168(%rsp), %rbp
+.L1358:
+	movq	40(%rsp), %rsi
+	addq	%rbp, %rsi
+	jmp	.L1156
+.L1378:
+	cmpq	%rax, %r14
+	jnb	.L1241
+.L1219:
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 8(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	16(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L1164
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L1164:
+	movq	8(%rsp), %rax
+	movq	%rbp, 168(%rsp)
+	movq	%rax, 152(%rsp)
+.L1158:
+	cmpq	$23, 8(%rsp)
+	leaq	.LC38(%rip), %rsi
+	jne	.L1156
+	leaq	168(%rsp), %rbp
+	jmp	.L1353
+	.p2align 4,,10
+	.p2align 3
+.L1129:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1379
+.L1134:
+	movq	_ZZN1n4heapEvE3res(%rip), %r14
+	movq	144(%rsp), %r13
+	pxor	%xmm0, %xmm0
+	xorl	%r15d, %r15d
+	movq	152(%rsp), %r12
+	movups	%xmm0, 168(%rsp)
+	leaq	.LC37(%rip), %rax
+	movq	%r14, 160(%rsp)
+	leaq	4(%r13), %rbx
+	movq	$0, 184(%rsp)
+	cmpq	$23, %r12
+	je	.L1380
+.L1136:
+	leaq	(%r15,%r13), %rdx
+	cmpq	%rdx, %rax
+	jnb	.L1381
+	subq	%r15, %rax
+	movq	%rax, 8(%rsp)
+	cmpq	%rbx, %r12
+	jnb	.L1235
+	leaq	10(%r12,%r12), %rax
+	movl	$1, %edx
+	movq	%r14, %rdi
+	cmpq	%rbx, %rax
+	cmovnb	%rax, %rbx
+	movq	(%r14), %rax
+	leaq	1(%rbx), %rsi
+	call	*16(%rax)
+	leaq	1(%r13), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	cmpq	$23, %r12
+	je	.L1140
+	movq	(%r14), %rax
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L1140:
+	movq	%rbp, 168(%rsp)
+	movq	%rbx, %r12
+	movq	%rbx, 152(%rsp)
+.L1139:
+	cmpq	$23, %r12
+	jne	.L1356
+	leaq	168(%rsp), %rbp
+.L1356:
+	movq	8(%rsp), %rax
+	addq	%rbp, %rax
+	jmp	.L1130
+.L1381:
+	cmpq	%rbx, %r12
+	jnb	.L1234
+.L1220:
+	leaq	10(%r12,%r12), %rax
+	movl	$1, %edx
+	movq	%r14, %rdi
+	cmpq	%rbx, %rax
+	cmovnb	%rax, %rbx
+	movq	(%r14), %rax
+	leaq	1(%rbx), %rsi
+	call	*16(%rax)
+	leaq	1(%r13), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memcpy@PLT
+	cmpq	$23, %r12
+	je	.L1138
+	movq	(%r14), %rax
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.LEHE43:
+.L1138:
+	movq	%rbp, 168(%rsp)
+	movq	%rbx, 152(%rsp)
+.L1132:
+	leaq	.LC37(%rip), %rax
+	cmpq	$23, %rbx
+	jne	.L1130
+	leaq	168(%rsp), %rbp
+	jmp	.L1351
+	.p2align 4,,10
+	.p2align 3
+.L1362:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1382
+.L1125:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	jmp	.L1123
+	.p2align 4,,10
+	.p2align 3
+.L1106:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1383
+.L1111:
+	movq	_ZZN1n4heapEvE3res(%rip), %rcx
+	movq	144(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	xorl	%ebp, %ebp
+	movq	152(%rsp), %r12
+	movups	%xmm0, 168(%rsp)
+	leaq	.LC36(%rip), %rsi
+	movq	%rcx, 160(%rsp)
+	leaq	18(%rdi), %rax
+	movq	$0, 184(%rsp)
+	cmpq	$23, %r12
+	je	.L1384
+.L1113:
+	leaq	0(%rbp,%rdi), %rdx
+	cmpq	%rdx, %rsi
+	jnb	.L1385
+	subq	%rbp, %rsi
+	movq	%rsi, %r13
+	cmpq	%rax, %r12
+	jnb	.L1227
+	leaq	10(%r12,%r12), %r12
+	movl	$1, %edx
+	movq	%rcx, %rdi
+	cmpq	%rax, %r12
+	cmovb	%rax, %r12
+	movq	(%rcx), %rax
+	leaq	1(%r12), %rsi
+.LEHB44:
+	call	*16(%rax)
+	leaq	168(%rsp), %rsi
+	cmpq	$23, 152(%rsp)
+	movq	%rax, %rbx
+	movq	144(%rsp), %rax
+	leaq	1(%rax), %rdx
+	je	.L1118
+	movq	168(%rsp), %rsi
+.L1118:
+	movq	%rbx, %rdi
+	call	memcpy@PLT
+	movq	152(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L1119
+	movq	160(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1119:
+	movq	%rbx, 168(%rsp)
+	movq	144(%rsp), %rdi
+	movq	%r12, 152(%rsp)
+.L1117:
+	leaq	(%rbx,%r13), %rsi
+	cmpq	$23, %r12
+	jne	.L1107
+	leaq	168(%rsp), %rbp
+	leaq	0(%rbp,%r13), %rsi
+	jmp	.L1246
+.L1385:
+	cmpq	%rax, %r12
+	jnb	.L1109
+.L1221:
+	leaq	10(%r12,%r12), %r12
+	movl	$1, %edx
+	movq	%rcx, %rdi
+	cmpq	%rax, %r12
+	cmovb	%rax, %r12
+	movq	(%rcx), %rax
+	leaq	1(%r12), %rsi
+	call	*16(%rax)
+	leaq	168(%rsp), %rsi
+	cmpq	$23, 152(%rsp)
+	movq	%rax, %rbx
+	movq	144(%rsp), %rax
+	leaq	1(%rax), %rdx
+	je	.L1115
+	movq	168(%rsp), %rsi
+.L1115:
+	movq	%rbx, %rdi
+	call	memcpy@PLT
+	movq	152(%rsp), %rdx
+	cmpq	$23, %rdx
+	je	.L1116
+	movq	160(%rsp), %rdi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE44:
+.L1116:
+	movq	%rbx, 168(%rsp)
+	movq	144(%rsp), %rdi
+	movq	%r12, 152(%rsp)
+.L1109:
+	leaq	.LC36(%rip), %rsi
+	cmpq	$23, %r12
+	jne	.L1107
+	leaq	168(%rsp), %rbp
+	jmp	.L1350
+	.p2align 4,,10
+	.p2align 3
+.L1367:
+	cmpq	$23, 152(%r12)
+	je	.L1386
+	movq	168(%r12), %rdi
+	leaq	168(%rsp), %rax
+	testq	%rdx, %rdx
+	je	.L1172
+	jmp	.L1176
+	.p2align 4,,10
+	.p2align 3
+.L1364:
+	cmpq	$23, 56(%r12)
+	je	.L1387
+	movq	72(%r12), %rdi
+	testq	%rdx, %rdx
+	je	.L1146
+	leaq	168(%rsp), %rax
+	jmp	.L1150
+.L1375:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1191
+	jmp	.L1192
+.L1368:
+	leaq	168(%r12), %rdi
+	testq	%rdx, %rdx
+	jne	.L1176
+	jmp	.L1175
+.L1372:
+	movq	96(%rsp), %r12
+.L1207:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1388
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L1207
+.L1206:
+	movq	$0, 120(%rsp)
+	jmp	.L1202
+.L1388:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1206
+	jmp	.L1207
+.L1383:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1111
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1111
+.L1376:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1160
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1160
+.L1379:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1134
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1134
+.L1382:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1125
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1125
+.L1387:
+	testq	%rdx, %rdx
+	je	.L1146
+	leaq	168(%rsp), %rbp
+	leaq	72(%r12), %rdi
+	movq	%rbp, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L1153
+	jmp	.L1146
+.L1386:
+	testq	%rdx, %rdx
+	je	.L1172
+	leaq	168(%rsp), %rsi
+	leaq	168(%r12), %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L1179
+	jmp	.L1172
+.L1234:
+	xorl	%ebp, %ebp
+	movq	%r12, %rbx
+	jmp	.L1132
+.L1241:
+	movq	%r14, 8(%rsp)
+	xorl	%ebp, %ebp
+	jmp	.L1158
+.L1242:
+	xorl	%ebp, %ebp
+	jmp	.L1165
+.L1377:
+	leaq	168(%rsp), %rbp
+	cmpq	%rbp, %rsi
+	jnb	.L1389
+	cmpq	$23, %rax
+	jbe	.L1156
+	movq	%rbp, 16(%rsp)
+	jmp	.L1219
+.L1227:
+	xorl	%ebx, %ebx
+	jmp	.L1117
+.L1235:
+	xorl	%ebp, %ebp
+	jmp	.L1139
+.L1380:
+	leaq	168(%rsp), %rbp
+	cmpq	%rbp, %rax
+	jnb	.L1390
+	cmpq	$23, %rbx
+	jbe	.L1130
+	movq	%rbp, %r15
+	jmp	.L1220
+.L1384:
+	leaq	168(%rsp), %rbp
+	cmpq	%rbp, %rsi
+	jnb	.L1113
+	cmpq	$23, %rax
+	ja	.L1221
+	jmp	.L1246
+.L1389:
+	movq	%rbp, 16(%rsp)
+	jmp	.L1162
+.L1390:
+	movq	%rbp, %r15
+	jmp	.L1136
+.L1247:
+	movq	%rax, %rbx
+	jmp	.L1213
+.L1248:
+	movq	%rax, %rbx
+	jmp	.L1215
+.L1346:
+	jmp	.L1347
+	.section	.gcc_except_table
+.LLSDA6896:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6896-.LLSDACSB6896
+.LLSDACSB6896:
+	.uleb128 .LEHB38-.LFB6896
+	.uleb128 .LEHE38-.LEHB38
+	.uleb128 .L1247-.LFB6896
+	.uleb128 0
+	.uleb128 .LEHB39-.LFB6896
+	.uleb128 .LEHE39-.LEHB39
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB40-.LFB6896
+	.uleb128 .LEHE40-.LEHB40
+	.uleb128 .L1248-.LFB6896
+	.uleb128 0
+	.uleb128 .LEHB41-.LFB6896
+	.uleb128 .LEHE41-.LEHB41
+	.uleb128 .L1346-.LFB6896
+	.uleb128 0
+	.uleb128 .LEHB42-.LFB6896
+	.uleb128 .LEHE42-.LEHB42
+	.uleb128 .L1346-.LFB6896
+	.uleb128 0
+	.uleb128 .LEHB43-.LFB6896
+	.uleb128 .LEHE43-.LEHB43
+	.uleb128 .L1346-.LFB6896
+	.uleb128 0
+	.uleb128 .LEHB44-.LFB6896
+	.uleb128 .LEHE44-.LEHB44
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6896:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6896
+	.type	_Z18test_lines_of_filev.cold, @function
+_Z18test_lines_of_filev.cold:
+.LFSB6896:
+.L1349:
+	.cfi_def_cfa_offset 304
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC30(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB45:
+	call	__cxa_throw@PLT
+.L1348:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC27(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE45:
+.L1213:
+	movq	152(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L1214
+	movq	160(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1214:
+	movq	%rbx, %rdi
+.LEHB46:
+	call	_Unwind_Resume@PLT
+.LEHE46:
+.L1215:
+	movq	160(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L1217
+	movq	168(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	176(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L1217
+.L1249:
+.L1347:
+	movq	24(%rsp), %rdi
+	movq	%rax, %rbx
+	call	_ZN1n6vectorINS_6stringIcEEE9__releaseEv
+.L1217:
+	movq	32(%rsp), %r15
+	movq	%r15, %rdi
+	call	_ZN1n4fileIcLNS_4modeE0EE5closeEv
+	movq	%r15, %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB47:
+	call	_Unwind_Resume@PLT
+.LEHE47:
+	.cfi_endproc
+.LFE6896:
+	.section	.gcc_except_table
+.LLSDAC6896:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6896-.LLSDACSBC6896
+.LLSDACSBC6896:
+	.uleb128 .LEHB45-.LCOLDB41
+	.uleb128 .LEHE45-.LEHB45
+	.uleb128 .L1249-.LCOLDB41
+	.uleb128 0
+	.uleb128 .LEHB46-.LCOLDB41
+	.uleb128 .LEHE46-.LEHB46
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB47-.LCOLDB41
+	.uleb128 .LEHE47-.LEHB47
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6896:
+	.section	.text.unlikely
+	.text
+	.size	_Z18test_lines_of_filev, .-_Z18test_lines_of_filev
+	.section	.text.unlikely
+	.size	_Z18test_lines_of_filev.cold, .-_Z18test_lines_of_filev.cold
+.LCOLDE41:
+	.text
+.LHOTE41:
+	.section	.rodata.str1.1
+.LC42:
+	.string	"\r\n"
+.LC43:
+	.string	"\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC45:
+	.string	"expected equal : expected value : from_file.len(), actual value : 200"
+	.align 8
+.LC46:
+	.string	"expected equal : expected value : from_map.len(), actual value : 200"
+	.section	.rodata.str1.1
+.LC47:
+	.string	"expected true : same"
+	.section	.text.unlikely
+.LCOLDB48:
+	.text
+.LHOTB48:
+	.p2align 4
+	.globl	_Z25test_lines_across_refillsv
+	.type	_Z25test_lines_across_refillsv, @function
+_Z25test_lines_across_refillsv:
+.LFB6901:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6901
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movl	$23, %ebx
+	subq	$376, %rsp
+	.cfi_def_cfa_offset 432
+	movdqa	.LC19(%rip), %xmm1
+	movaps	%xmm1, 112(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rdx
+	testq	%rdx, %rdx
+	je	.L1581
+.L1392:
+	movq	%rdx, 128(%rsp)
+	pxor	%xmm0, %xmm0
+	xorl	%r13d, %r13d
+	leaq	136(%rsp), %r14
+	movq	$0, 152(%rsp)
+	movups	%xmm0, 136(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1396:
+	movl	%r13d, %r12d
+	movl	$2987803337, %esi
+	imulq	%rsi, %r12
+	shrq	$36, %r12
+	imull	$23, %r12d, %edx
+	movl	%r13d, %r12d
+	subl	%edx, %r12d
+	je	.L1419
+	addl	$97, %r12d
+	movl	$97, %ebp
+	jmp	.L1403
+	.p2align 4,,10
+	.p2align 3
+.L1583:
+	movq	136(%rsp), %rdx
+	movb	%bpl, (%rdx,%rax)
+	movq	112(%rsp), %rax
+	addl	$1, %ebp
+	leaq	1(%rax), %rcx
+	movq	%rcx, 112(%rsp)
+	movb	$0, 1(%rdx,%rax)
+	cmpb	%r12b, %bpl
+	je	.L1402
+.L1401:
+	movq	112(%rsp), %rax
+	movq	120(%rsp), %rbx
+.L1403:
+	cmpq	%rax, %rbx
+	je	.L1582
+.L1397:
+	cmpq	$23, %rbx
+	jne	.L1583
+	movb	%bpl, 136(%rsp,%rax)
+	movq	112(%rsp), %rax
+	addl	$1, %ebp
+	addq	$1, %rax
+	movq	%rax, 112(%rsp)
+	movb	$0, 136(%rsp,%rax)
+	cmpb	%bpl, %r12b
+	jne	.L1401
+.L1402:
+	movq	120(%rsp), %rbx
+	movq	112(%rsp), %rax
+.L1419:
+	imull	$-1431655765, %r13d, %edx
+	leaq	.LC42(%rip), %r12
+	leaq	.LC43(%rip), %rcx
+	cmpl	$1431655766, %edx
+	sbbq	%rbp, %rbp
+	notq	%rbp
+	addq	$2, %rbp
+	cmpl	$1431655765, %edx
+	movq	%r14, %rdx
+	cmova	%rcx, %r12
+	cmpq	$23, %rbx
+	je	.L1405
+	movq	136(%rsp), %rdx
+.L1405:
+	leaq	0(%rbp,%rax), %rcx
+	cmpq	%rdx, %r12
+	jb	.L1406
+	leaq	(%rdx,%rax), %rsi
+	cmpq	%rsi, %r12
+	jnb	.L1406
+	movq	%r12, %r15
+	subq	%rdx, %r15
+	cmpq	%rcx, %rbx
+	jnb	.L1411
+	leaq	10(%rbx,%rbx), %rbx
+	movq	128(%rsp), %rdi
+	movl	$1, %edx
+	cmpq	%rcx, %rbx
+	cmovb	%rcx, %rbx
+	movq	(%rdi), %rax
+	leaq	1(%rbx), %rsi
+.LEHB48:
+	call	*16(%rax)
+	movq	%rax, %r12
+	movq	112(%rsp), %rax
+	cmpq	$23, 120(%rsp)
+	movq	%r14, %rsi
+	leaq	1(%rax), %rdx
+	je	.L1412
+	movq	136(%rsp), %rsi
+.L1412:
+	movq	%r12, %rdi
+	call	memcpy@PLT
+	movq	120(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L1413
+	movq	128(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	136(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1413:
+	movq	%r12, 136(%rsp)
+	movq	112(%rsp), %rax
+	movq	%rbx, 120(%rsp)
+.L1411:
+	leaq	(%r14,%r15), %r12
+	cmpq	$23, %rbx
+	je	.L1415
+	movq	136(%rsp), %rbx
+	leaq	(%rbx,%r15), %r12
+.L1416:
+	movq	%rbp, %rdx
+	leaq	(%rbx,%rax), %rdi
+	movq	%r12, %rsi
+	addl	$1, %r13d
+	call	memmove@PLT
+	addq	112(%rsp), %rbp
+	movq	%rbp, 112(%rsp)
+	movb	$0, (%rbx,%rbp)
+	cmpl	$200, %r13d
+	je	.L1418
+.L1417:
+	movq	120(%rsp), %rbx
+	movq	112(%rsp), %rax
+	jmp	.L1396
+	.p2align 4,,10
+	.p2align 3
+.L1582:
+	leaq	1(%rbx), %rdx
+	cmpq	%rdx, %rbx
+	jnb	.L1397
+	leaq	10(%rbx,%rbx), %rbx
+	movq	128(%rsp), %rdi
+	cmpq	%rdx, %rbx
+	cmovb	%rdx, %rbx
+	movq	(%rdi), %rax
+	movl	$1, %edx
+	leaq	1(%rbx), %rsi
+	call	*16(%rax)
+	movq	%rax, %r15
+	movq	112(%rsp), %rax
+	cmpq	$23, 120(%rsp)
+	movq	%r14, %rsi
+	leaq	1(%rax), %rdx
+	je	.L1398
+	movq	136(%rsp), %rsi
+.L1398:
+	movq	%r15, %rdi
+	call	memcpy@PLT
+	movq	120(%rsp), %rdx
+	cmpq	$23, %rdx
+	je	.L1399
+	movq	128(%rsp), %rdi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	136(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1399:
+	movq	%r15, 136(%rsp)
+	movq	112(%rsp), %rax
+	movq	%rbx, 120(%rsp)
+	jmp	.L1397
+	.p2align 4,,10
+	.p2align 3
+.L1406:
+	cmpq	%rcx, %rbx
+	jnb	.L1408
+	leaq	10(%rbx,%rbx), %rbx
+	movq	128(%rsp), %rdi
+	movl	$1, %edx
+	cmpq	%rcx, %rbx
+	cmovb	%rcx, %rbx
+	movq	(%rdi), %rax
+	leaq	1(%rbx), %rsi
+	call	*16(%rax)
+	movq	%rax, %r15
+	movq	112(%rsp), %rax
+	cmpq	$23, 120(%rsp)
+	movq	%r14, %rsi
+	leaq	1(%rax), %rdx
+	je	.L1409
+	movq	136(%rsp), %rsi
+.L1409:
+	movq	%r15, %rdi
+	call	memcpy@PLT
+	movq	120(%rsp), %rdx
+	cmpq	$23, %rdx
+	je	.L1410
+	movq	128(%rsp), %rdi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	136(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1410:
+	movq	%r15, 136(%rsp)
+	movq	112(%rsp), %rax
+	movq	%rbx, 120(%rsp)
+.L1408:
+	cmpq	$23, %rbx
+	je	.L1415
+	movq	136(%rsp), %rbx
+	jmp	.L1416
+	.p2align 4,,10
+	.p2align 3
+.L1415:
+	movq	%rbp, %rdx
+	leaq	(%r14,%rax), %rdi
+	movq	%r12, %rsi
+	addl	$1, %r13d
+	call	memmove@PLT
+	addq	112(%rsp), %rbp
+	movq	%rbp, 112(%rsp)
+	movb	$0, 136(%rsp,%rbp)
+	cmpl	$200, %r13d
+	jne	.L1417
+.L1418:
+	leaq	112(%rsp), %rdi
+	call	_Z10write_fileRKN1n6stringIcEE
+	movq	path(%rip), %rdi
+	movl	$438, %edx
+	movl	$524288, %esi
+	xorl	%eax, %eax
+	call	open@PLT
+.LEHE48:
+	movl	%eax, 160(%rsp)
+	movzwl	.LC16(%rip), %eax
+	movl	$524288, %esi
+	movdqa	.LC44(%rip), %xmm0
+	movq	path(%rip), %rdi
+	movb	$0, 166(%rsp)
+	movw	%ax, 164(%rsp)
+	xorl	%eax, %eax
+	movq	$0, 168(%rsp)
+	movq	$0, 176(%rsp)
+	movq	$0, 200(%rsp)
+	movq	$0, 208(%rsp)
+	movups	%xmm0, 184(%rsp)
+.LEHB49:
+	call	open@PLT
+	movl	%eax, %r12d
+	testl	%eax, %eax
+	js	.L1491
+	leaq	224(%rsp), %r13
+	movl	%eax, %edi
+	movq	%r13, %rsi
+	call	fstat@PLT
+	testl	%eax, %eax
+	je	.L1584
+.L1424:
+	movq	$0, (%rsp)
+	xorl	%ebx, %ebx
+.L1423:
+	movl	%r12d, %edi
+	call	close@PLT
+.LEHE49:
+	jmp	.L1420
+.L1584:
+	movq	272(%rsp), %rax
+	movq	%rax, (%rsp)
+	testq	%rax, %rax
+	je	.L1424
+	movq	%rax, %rsi
+	xorl	%r9d, %r9d
+	movl	%r12d, %r8d
+	movl	$2, %ecx
+	movl	$1, %edx
+	xorl	%edi, %edi
+	call	mmap@PLT
+	movq	%rax, %rbx
+	cmpq	$-1, %rax
+	jne	.L1423
+	jmp	.L1424
+	.p2align 4,,10
+	.p2align 3
+.L1491:
+	movq	$0, (%rsp)
+	xorl	%ebx, %ebx
+	leaq	224(%rsp), %r13
+.L1420:
+	movdqa	.LC19(%rip), %xmm2
+	leaq	160(%rsp), %rax
+	movq	%rax, 24(%rsp)
+	movq	%rax, 224(%rsp)
+	movups	%xmm2, 232(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L1585
+.L1425:
+	pxor	%xmm0, %xmm0
+	leaq	48(%rsp), %rdi
+	movq	%r13, %rsi
+	movq	%rax, 248(%rsp)
+	movaps	%xmm0, 256(%rsp)
+	pxor	%xmm0, %xmm0
+	movq	$0, 272(%rsp)
+	movq	$0, 280(%rsp)
+	movb	$0, 304(%rsp)
+	movq	%rdi, 40(%rsp)
+	movaps	%xmm0, 288(%rsp)
+.LEHB50:
+	call	_Z7collectIN1n11line_readerINS0_4fileIcLNS0_4modeE0EEEEEENS0_6vectorINS0_6stringIcEEEET_
+.LEHE50:
+	movq	240(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L1429
+	movq	248(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	256(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1429:
+	leaq	80(%rsp), %rax
+	movq	(%rsp), %rdx
+	movq	%rbx, %rsi
+	movq	%rax, %rdi
+	movq	%rax, 32(%rsp)
+.LEHB51:
+	call	_Z7collectIN1n13line_iteratorINS0_5sliceIKcEEEEENS0_6vectorINS0_6stringIcEEEET_
+.LEHE51:
+	cmpq	$200, 64(%rsp)
+	jne	.L1574
+	cmpq	$200, 96(%rsp)
+	jne	.L1575
+	movq	80(%rsp), %rax
+	movq	48(%rsp), %rcx
+	xorl	%r14d, %r14d
+	movl	$2987803337, %r15d
+	movq	%rax, 16(%rsp)
+	leaq	24(%rax), %r12
+	leaq	24(%rcx), %r13
+	movl	$1, %eax
+	movq	%rcx, 8(%rsp)
+	jmp	.L1436
+	.p2align 4,,10
+	.p2align 3
+.L1432:
+	addl	$1, %r14d
+	addq	$48, %r13
+	addq	$48, %r12
+	cmpl	$200, %r14d
+	je	.L1586
+.L1436:
+	testb	%al, %al
+	je	.L1432
+	movq	-24(%r13), %rbp
+	movq	%r13, %rdi
+	movq	%r12, %rsi
+	xorl	%eax, %eax
+	cmpq	-24(%r12), %rbp
+	jne	.L1432
+	cmpq	$23, -16(%r12)
+	je	.L1433
+	movq	(%r12), %rsi
+.L1433:
+	cmpq	$23, -16(%r13)
+	je	.L1434
+	movq	0(%r13), %rdi
+.L1434:
+	testq	%rbp, %rbp
+	je	.L1435
+	movq	%rbp, %rdx
+	call	memcmp@PLT
+	movl	%eax, %esi
+	xorl	%eax, %eax
+	testl	%esi, %esi
+	jne	.L1432
+.L1435:
+	movl	%r14d, %eax
+	movl	%r14d, %esi
+	imulq	%r15, %rax
+	shrq	$36, %rax
+	imull	$23, %eax, %eax
+	subl	%eax, %esi
+	movslq	%esi, %rax
+	cmpq	%rbp, %rax
+	sete	%al
+	jmp	.L1432
+.L1586:
+	testb	%al, %al
+	je	.L1576
+	movq	path(%rip), %rdi
+	call	remove@PLT
+	movq	16(%rsp), %rax
+	movq	%rax, %r14
+	leaq	9600(%rax), %r15
+.L1441:
+	movq	8(%r14), %rax
+	cmpq	$23, %rax
+	je	.L1438
+	movq	16(%r14), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%r14), %rsi
+	addq	$48, %r14
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	%r14, %r15
+	jne	.L1441
+.L1440:
+	movq	16(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L1442
+	movq	88(%rsp), %rax
+	movq	104(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	(%rax,%rax,2), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+	call	*24(%rax)
+.L1442:
+	movq	8(%rsp), %rax
+	movq	%rax, %r13
+	leaq	9600(%rax), %r14
+.L1446:
+	movq	8(%r13), %rax
+	cmpq	$23, %rax
+	je	.L1443
+	movq	16(%r13), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%r13), %rsi
+	addq	$48, %r13
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	%r14, %r13
+	jne	.L1446
+.L1445:
+	movq	8(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L1447
+	movq	56(%rsp), %rax
+	movq	72(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	(%rax,%rax,2), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+	call	*24(%rax)
+.L1447:
+	testq	%rbx, %rbx
+	je	.L1448
+	movq	(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	munmap@PLT
+.L1448:
+	movl	160(%rsp), %r12d
+	testl	%r12d, %r12d
+	js	.L1449
+	cmpl	$2, 168(%rsp)
+	je	.L1587
+.L1450:
+	cmpb	$0, 164(%rsp)
+	jne	.L1588
+.L1455:
+	movl	$-1, 160(%rsp)
+.L1449:
+	cmpq	$0, 176(%rsp)
+	je	.L1456
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1589
+.L1458:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	184(%rsp), %rdx
+	movl	$64, %ecx
+	movq	176(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	$0, 176(%rsp)
+.L1456:
+	movq	208(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 168(%rsp)
+	movaps	%xmm0, 192(%rsp)
+	testq	%rdi, %rdi
+	je	.L1460
+	call	fclose@PLT
+	movl	160(%rsp), %r12d
+	movq	$0, 208(%rsp)
+	testl	%r12d, %r12d
+	js	.L1579
+	cmpl	$2, 168(%rsp)
+	jne	.L1464
+	movq	200(%rsp), %rbx
+	testq	%rbx, %rbx
+	jne	.L1590
+.L1464:
+	cmpb	$0, 164(%rsp)
+	jne	.L1591
+.L1470:
+	movl	$-1, 160(%rsp)
+.L1579:
+	movq	176(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1471
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1592
+.L1473:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	184(%rsp), %rdx
+	movl	$64, %ecx
+	movq	176(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1471:
+	movq	120(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L1391
+	movq	128(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	136(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1391:
+	addq	$376, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L1443:
+	.cfi_restore_state
+	addq	$48, %r13
+	cmpq	%r13, %r14
+	jne	.L1446
+	jmp	.L1445
+.L1438:
+	addq	$48, %r14
+	cmpq	%r14, %r15
+	jne	.L1441
+	jmp	.L1440
+.L1460:
+	movl	160(%rsp), %eax
+	testl	%eax, %eax
+	js	.L1471
+	cmpb	$0, 164(%rsp)
+	je	.L1470
+.L1591:
+	movl	160(%rsp), %edi
+	call	close@PLT
+	jmp	.L1470
+.L1587:
+	movq	200(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L1450
+	movq	176(%rsp), %rbp
+.L1454:
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movl	%r12d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1593
+	addq	%rax, %rbp
+	subq	%rax, %rbx
+	jne	.L1454
+.L1453:
+	movq	$0, 200(%rsp)
+	jmp	.L1450
+.L1590:
+	movq	176(%rsp), %rbp
+.L1469:
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movl	%r12d, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1594
+	addq	%rax, %rbp
+	subq	%rax, %rbx
+	jne	.L1469
+.L1468:
+	movq	$0, 200(%rsp)
+	jmp	.L1464
+.L1581:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1595
+.L1394:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdx
+	movq	120(%rsp), %rbx
+	movq	112(%rsp), %rax
+	jmp	.L1392
+.L1592:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1473
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1473
+.L1589:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1458
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1458
+.L1588:
+	movl	160(%rsp), %edi
+	call	close@PLT
+	jmp	.L1455
+.L1585:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1596
+.L1427:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	jmp	.L1425
+.L1594:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1468
+	jmp	.L1469
+.L1596:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1427
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1427
+.L1595:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1394
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1394
+.L1593:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1453
+	jmp	.L1454
+.L1496:
+	movq	%rax, %r12
+	jmp	.L1476
+.L1497:
+	movq	%rax, %r12
+	jmp	.L1480
+.L1495:
+	movq	%rax, %rbx
+	leaq	160(%rsp), %rax
+	movq	%rax, 24(%rsp)
+	jmp	.L1482
+.L1494:
+	movq	%rax, %rbx
+	jmp	.L1483
+	.section	.gcc_except_table
+.LLSDA6901:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6901-.LLSDACSB6901
+.LLSDACSB6901:
+	.uleb128 .LEHB48-.LFB6901
+	.uleb128 .LEHE48-.LEHB48
+	.uleb128 .L1494-.LFB6901
+	.uleb128 0
+	.uleb128 .LEHB49-.LFB6901
+	.uleb128 .LEHE49-.LEHB49
+	.uleb128 .L1495-.LFB6901
+	.uleb128 0
+	.uleb128 .LEHB50-.LFB6901
+	.uleb128 .LEHE50-.LEHB50
+	.uleb128 .L1496-.LFB6901
+	.uleb128 0
+	.uleb128 .LEHB51-.LFB6901
+	.uleb128 .LEHE51-.LEHB51
+	.uleb128 .L1497-.LFB6901
+	.uleb128 0
+.LLSDACSE6901:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6901
+	.type	_Z25test_lines_across_refillsv.cold, @function
+_Z25test_lines_across_refillsv.cold:
+.LFSB6901:
+.L1575:
+	.cfi_def_cfa_offset 432
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC46(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB52:
+	call	__cxa_throw@PLT
+.L1576:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC47(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE52:
+.L1476:
+	movq	240(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L1478
+	movq	248(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	256(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L1478
+.L1498:
+	movq	32(%rsp), %rdi
+	movq	%rax, %r12
+	call	_ZN1n6vectorINS_6stringIcEEE9__releaseEv
+.L1480:
+	movq	40(%rsp), %rdi
+	call	_ZN1n6vectorINS_6stringIcEEE9__releaseEv
+.L1478:
+	testq	%rbx, %rbx
+	je	.L1481
+	movq	(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	munmap@PLT
+.L1481:
+	movq	%r12, %rbx
+.L1482:
+	movq	24(%rsp), %r14
+	movq	%r14, %rdi
+	call	_ZN1n4fileIcLNS_4modeE0EE5closeEv
+	movq	%r14, %rdi
+	call	_ZN1n7fd_file5closeEv
+.L1483:
+	movq	120(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L1484
+	movq	128(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	136(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1484:
+	movq	%rbx, %rdi
+.LEHB53:
+	call	_Unwind_Resume@PLT
+.LEHE53:
+.L1574:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC45(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB54:
+	call	__cxa_throw@PLT
+.LEHE54:
+	.cfi_endproc
+.LFE6901:
+	.section	.gcc_except_table
+.LLSDAC6901:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6901-.LLSDACSBC6901
+.LLSDACSBC6901:
+	.uleb128 .LEHB52-.LCOLDB48
+	.uleb128 .LEHE52-.LEHB52
+	.uleb128 .L1498-.LCOLDB48
+	.uleb128 0
+	.uleb128 .LEHB53-.LCOLDB48
+	.uleb128 .LEHE53-.LEHB53
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB54-.LCOLDB48
+	.uleb128 .LEHE54-.LEHB54
+	.uleb128 .L1498-.LCOLDB48
+	.uleb128 0
+.LLSDACSEC6901:
+	.section	.text.unlikely
+	.text
+	.size	_Z25test_lines_across_refillsv, .-_Z25test_lines_across_refillsv
+	.section	.text.unlikely
+	.size	_Z25test_lines_across_refillsv.cold, .-_Z25test_lines_across_refillsv.cold
+.LCOLDE48:
+	.text
+.LHOTE48:
+	.section	.text.unlikely
+.LCOLDB49:
+	.section	.text.startup
+.LHOTB49:
+	.p2align 4
+	.type	_GLOBAL__sub_I_path, @function
+_GLOBAL__sub_I_path:
+.LFB7018:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7018
+	cmpb	$0, _ZGVN1n4stdrE(%rip)
+	je	.L1628
+	ret
+.L1628:
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movl	$4294967295, %eax
+	xorl	%edi, %edi
+	xorl	%r8d, %r8d
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$48, %rsp
+	.cfi_def_cfa_offset 80
+	movdqa	.LC17(%rip), %xmm0
+	movq	stdin(%rip), %rbx
+	movb	$1, _ZGVN1n4stdrE(%rip)
+	movq	%rax, _ZN1n4stdrE(%rip)
+	movq	$0, 8+_ZN1n4stdrE(%rip)
+	movq	%rdi, 16+_ZN1n4stdrE(%rip)
+	movq	%r8, 40+_ZN1n4stdrE(%rip)
+	movups	%xmm0, 24+_ZN1n4stdrE(%rip)
+	testq	%rbx, %rbx
+	je	.L1629
+	movq	%rbx, %rdi
+	movq	%rbx, 48+_ZN1n4stdrE(%rip)
+	call	fileno@PLT
+	movq	%rbx, %rdi
+	call	fileno@PLT
+	movl	_ZN1n4stdrE(%rip), %ebx
+	xorl	%edx, %edx
+	xorl	%ecx, %ecx
+	movdqa	.LC17(%rip), %xmm0
+	movl	%eax, (%rsp)
+	movw	$0, 4(%rsp)
+	movb	$0, 6(%rsp)
+	movq	$0, 8(%rsp)
+	movq	%rdx, 16(%rsp)
+	movq	%rcx, 40(%rsp)
+	movups	%xmm0, 24(%rsp)
+	testl	%ebx, %ebx
+	js	.L1601
+	cmpl	$2, 8+_ZN1n4stdrE(%rip)
+	je	.L1630
+.L1602:
+	cmpb	$0, 4+_ZN1n4stdrE(%rip)
+	jne	.L1607
+.L1608:
+	movl	$-1, _ZN1n4stdrE(%rip)
+.L1601:
+	cmpq	$0, 16+_ZN1n4stdrE(%rip)
+	je	.L1613
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1631
+.L1611:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24+_ZN1n4stdrE(%rip), %rdx
+	movl	$64, %ecx
+	movq	16+_ZN1n4stdrE(%rip), %rsi
+	movq	(%rdi), %rax
+.LEHB55:
+	call	*24(%rax)
+.L1613:
+	movl	(%rsp), %eax
+	movdqu	24(%rsp), %xmm1
+	movl	%eax, _ZN1n4stdrE(%rip)
+	movzwl	4(%rsp), %eax
+	movups	%xmm1, 24+_ZN1n4stdrE(%rip)
+	movw	%ax, 4+_ZN1n4stdrE(%rip)
+	movzbl	6(%rsp), %eax
+	movb	%al, 6+_ZN1n4stdrE(%rip)
+	movq	8(%rsp), %rax
+	movq	%rax, 8+_ZN1n4stdrE(%rip)
+	movq	16(%rsp), %rax
+	movq	%rax, 16+_ZN1n4stdrE(%rip)
+	movq	40(%rsp), %rax
+	movq	%rax, 40+_ZN1n4stdrE(%rip)
+	jmp	.L1600
+.L1629:
+	xorl	%esi, %esi
+	movq	%rsi, 48+_ZN1n4stdrE(%rip)
+.L1600:
+	addq	$48, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	leaq	__dso_handle(%rip), %rdx
+	leaq	_ZN1n4stdrE(%rip), %rsi
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+	leaq	_ZN1n4fileIcLNS_4modeE6EED1Ev(%rip), %rdi
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+	jmp	__cxa_atexit@PLT
+.L1630:
+	.cfi_restore_state
+	movq	40+_ZN1n4stdrE(%rip), %rbp
+	testq	%rbp, %rbp
+	je	.L1602
+	movq	16+_ZN1n4stdrE(%rip), %r12
+.L1606:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1632
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L1606
+.L1605:
+	xorl	%eax, %eax
+	movq	%rax, 40+_ZN1n4stdrE(%rip)
+	jmp	.L1602
+.L1607:
+	movl	_ZN1n4stdrE(%rip), %edi
+	call	close@PLT
+.LEHE55:
+	jmp	.L1608
+.L1631:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1611
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1611
+.L1632:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1605
+	jmp	.L1606
+.L1615:
+	movq	%rax, %rbx
+	jmp	.L1614
+	.section	.gcc_except_table
+.LLSDA7018:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7018-.LLSDACSB7018
+.LLSDACSB7018:
+	.uleb128 .LEHB55-.LFB7018
+	.uleb128 .LEHE55-.LEHB55
+	.uleb128 .L1615-.LFB7018
+	.uleb128 0
+.LLSDACSE7018:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7018
+	.type	_GLOBAL__sub_I_path.cold, @function
+_GLOBAL__sub_I_path.cold:
+.LFSB7018:
+.L1614:
+	.cfi_def_cfa_offset 80
+	.cfi_offset 3, -32
+	.cfi_offset 6, -24
+	.cfi_offset 12, -16
+	movq	%rsp, %rdi
+	call	_ZN1n7fd_file5closeEv
+	leaq	_ZN1n4stdrE(%rip), %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB56:
+	call	_Unwind_Resume@PLT
+.LEHE56:
+	.cfi_endproc
+.LFE7018:
+	.section	.gcc_except_table
+.LLSDAC7018:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7018-.LLSDACSBC7018
+.LLSDACSBC7018:
+	.uleb128 .LEHB56-.LCOLDB49
+	.uleb128 .LEHE56-.LEHB56
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC7018:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	_GLOBAL__sub_I_path, .-_GLOBAL__sub_I_path
+	.section	.text.unlikely
+	.size	_GLOBAL__sub_I_path.cold, .-_GLOBAL__sub_I_path.cold
+.LCOLDE49:
+	.section	.text.startup
+.LHOTE49:
+	.section	.init_array,"aw"
+	.align 8
+	.quad	_GLOBAL__sub_I_path
+	.weak	_ZGVN1n4stdrE
+	.section	.bss._ZGVN1n4stdrE,"awG",@nobits,_ZGVN1n4stdrE,comdat
+	.align 8
+	.type	_ZGVN1n4stdrE, @gnu_unique_object
+	.size	_ZGVN1n4stdrE, 8
+_ZGVN1n4stdrE:
+	.zero	8
+	.weak	_ZTSN1n15memory_resourceE
+	.section	.rodata._ZTSN1n15memory_resourceE,"aG",@progbits,_ZTSN1n15memory_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n15memory_resourceE, @object
+	.size	_ZTSN1n15memory_resourceE, 22
+_ZTSN1n15memory_resourceE:
+	.string	"N1n15memory_resourceE"
+	.weak	_ZTIN1n15memory_resourceE
+	.section	.data.rel.ro._ZTIN1n15memory_resourceE,"awG",@progbits,_ZTIN1n15memory_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n15memory_resourceE, @object
+	.size	_ZTIN1n15memory_resourceE, 16
+_ZTIN1n15memory_resourceE:
+	.quad	_ZTVN10__cxxabiv117__class_type_infoE+16
+	.quad	_ZTSN1n15memory_resourceE
+	.weak	_ZTSN1n13heap_resourceE
+	.section	.rodata._ZTSN1n13heap_resourceE,"aG",@progbits,_ZTSN1n13heap_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n13heap_resourceE, @object
+	.size	_ZTSN1n13heap_resourceE, 20
+_ZTSN1n13heap_resourceE:
+	.string	"N1n13heap_resourceE"
+	.weak	_ZTIN1n13heap_resourceE
+	.section	.data.rel.ro._ZTIN1n13heap_resourceE,"awG",@progbits,_ZTIN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n13heap_resourceE, @object
+	.size	_ZTIN1n13heap_resourceE, 24
+_ZTIN1n13heap_resourceE:
+	.quad	_ZTVN10__cxxabiv120__si_class_type_infoE+16
+	.quad	_ZTSN1n13heap_resourceE
+	.quad	_ZTIN1n15memory_resourceE
+	.weak	_ZTVN1n13heap_resourceE
+	.section	.data.rel.ro.local._ZTVN1n13heap_resourceE,"awG",@progbits,_ZTVN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTVN1n13heap_resourceE, @object
+	.size	_ZTVN1n13heap_resourceE, 48
+_ZTVN1n13heap_resourceE:
+	.quad	0
+	.quad	_ZTIN1n13heap_resourceE
+	.quad	_ZN1n13heap_resourceD1Ev
+	.quad	_ZN1n13heap_resourceD0Ev
+	.quad	_ZN1n13heap_resource8allocateEmm
+	.quad	_ZN1n13heap_resource10deallocateEPvmm
+	.globl	path
+	.section	.rodata.str1.1
+.LC50:
+	.string	"test_lines.txt"
+	.section	.data.rel.local,"aw"
+	.align 8
+	.type	path, @object
+	.size	path, 8
+path:
+	.quad	.LC50
+	.weak	_ZN1n4stdrE
+	.section	.bss._ZN1n4stdrE,"awG",@nobits,_ZN1n4stdrE,comdat
+	.align 32
+	.type	_ZN1n4stdrE, @gnu_unique_object
+	.size	_ZN1n4stdrE, 56
+_ZN1n4stdrE:
+	.zero	56
+	.weak	_ZN1n18__current_resourceE
+	.section	.tbss._ZN1n18__current_resourceE,"awTG",@nobits,_ZN1n18__current_resourceE,comdat
+	.align 8
+	.type	_ZN1n18__current_resourceE, @gnu_unique_object
+	.size	_ZN1n18__current_resourceE, 8
+_ZN1n18__current_resourceE:
+	.zero	8
+	.weak	_ZGVZN1n4heapEvE3res
+	.section	.bss._ZGVZN1n4heapEvE3res,"awG",@nobits,_ZGVZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZGVZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZGVZN1n4heapEvE3res, 8
+_ZGVZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE3res
+	.section	.bss._ZZN1n4heapEvE3res,"awG",@nobits,_ZZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZZN1n4heapEvE3res, 8
+_ZZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE7storage
+	.section	.bss._ZZN1n4heapEvE7storage,"awG",@nobits,_ZZN1n4heapEvE7storage,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE7storage, @gnu_unique_object
+	.size	_ZZN1n4heapEvE7storage, 8
+_ZZN1n4heapEvE7storage:
+	.zero	8
+	.section	.rodata.cst2,"aM",@progbits,2
+	.align 2
+.LC1:
+	.byte	10
+	.byte	0
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC14:
+	.long	4
+	.long	100
+	.set	.LC16,.LC17+2
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC17:
+	.quad	65536
+	.quad	0
+	.align 16
+.LC19:
+	.quad	0
+	.quad	23
+	.align 16
+.LC44:
+	.quad	16
+	.quad	0
+	.hidden	DW.ref._ZTIPKc
+	.weak	DW.ref._ZTIPKc
+	.section	.data.rel.local.DW.ref._ZTIPKc,"awG",@progbits,DW.ref._ZTIPKc,comdat
+	.align 8
+	.type	DW.ref._ZTIPKc, @object
+	.size	DW.ref._ZTIPKc, 8
+DW.ref._ZTIPKc:
+	.quad	_ZTIPKc
+	.hidden	DW.ref.__gxx_personality_v0
+	.weak	DW.ref.__gxx_personality_v0
+	.section	.data.rel.local.DW.ref.__gxx_personality_v0,"awG",@progbits,DW.ref.__gxx_personality_v0,comdat
+	.align 8
+	.type	DW.ref.__gxx_personality_v0, @object
+	.size	DW.ref.__gxx_personality_v0, 8
+DW.ref.__gxx_personality_v0:
+	.quad	__gxx_personality_v0
+	.hidden	__dso_handle
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
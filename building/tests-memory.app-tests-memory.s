@@ -0,0 +1,4222 @@
+	.file	"tests-memory.cpp"
+	.text
+	.section	.text._ZN1n14arena_resourceD2Ev,"axG",@progbits,_ZN1n14arena_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n14arena_resourceD2Ev
+	.type	_ZN1n14arena_resourceD2Ev, @function
+_ZN1n14arena_resourceD2Ev:
+.LFB6604:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6604
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	leaq	16+_ZTVN1n14arena_resourceE(%rip), %rax
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movq	16(%rdi), %rbx
+	movq	%rax, (%rdi)
+	testq	%rbx, %rbx
+	je	.L1
+	movq	%rdi, %rbp
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	movq	8(%rbp), %rdi
+	movq	%rbx, %rsi
+	movq	(%rbx), %rbx
+	movl	$8, %ecx
+	movq	8(%rsi), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	%rbx, 16(%rbp)
+	testq	%rbx, %rbx
+	jne	.L3
+.L1:
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE6604:
+	.globl	__gxx_personality_v0
+	.section	.gcc_except_table._ZN1n14arena_resourceD2Ev,"aG",@progbits,_ZN1n14arena_resourceD5Ev,comdat
+.LLSDA6604:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6604-.LLSDACSB6604
+.LLSDACSB6604:
+.LLSDACSE6604:
+	.section	.text._ZN1n14arena_resourceD2Ev,"axG",@progbits,_ZN1n14arena_resourceD5Ev,comdat
+	.size	_ZN1n14arena_resourceD2Ev, .-_ZN1n14arena_resourceD2Ev
+	.weak	_ZN1n14arena_resourceD1Ev
+	.set	_ZN1n14arena_resourceD1Ev,_ZN1n14arena_resourceD2Ev
+	.section	.text._ZN1n14arena_resource8allocateEmm,"axG",@progbits,_ZN1n14arena_resource8allocateEmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n14arena_resource8allocateEmm
+	.type	_ZN1n14arena_resource8allocateEmm, @function
+_ZN1n14arena_resource8allocateEmm:
+.LFB6616:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	leaq	-1(%rdx), %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	movq	%rdx, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	negq	%r13
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movq	24(%rdi), %rcx
+	leaq	(%rcx,%r14), %rax
+	andq	%r13, %rax
+	subq	%rcx, %rax
+	testq	%rcx, %rcx
+	je	.L11
+	movq	32(%rdi), %rsi
+	leaq	(%rax,%r12), %rdi
+	subq	%rcx, %rsi
+	cmpq	%rdi, %rsi
+	jnb	.L12
+.L11:
+	leaq	15(%rdx), %rbx
+	movq	40(%rbp), %rax
+	movq	8(%rbp), %rdi
+	movl	$8, %edx
+	andq	%r13, %rbx
+	leaq	(%rbx,%r12), %rbx
+	cmpq	%rax, %rbx
+	cmovb	%rax, %rbx
+	movq	(%rdi), %rax
+	movq	%rbx, %rsi
+	call	*16(%rax)
+	movq	16(%rbp), %rdx
+	leaq	16(%rax), %rcx
+	movq	%rbx, 8(%rax)
+	movq	%rdx, (%rax)
+	movq	%rax, 16(%rbp)
+	addq	%rbx, %rax
+	addq	%rbx, %rbx
+	movq	%rax, 32(%rbp)
+	leaq	(%rcx,%r14), %rax
+	movq	%rbx, 40(%rbp)
+	andq	%r13, %rax
+	subq	%rcx, %rax
+.L12:
+	addq	%rcx, %rax
+	addq	%rax, %r12
+	movq	%r12, 24(%rbp)
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE6616:
+	.size	_ZN1n14arena_resource8allocateEmm, .-_ZN1n14arena_resource8allocateEmm
+	.section	.text._ZN1n14arena_resource10deallocateEPvmm,"axG",@progbits,_ZN1n14arena_resource10deallocateEPvmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n14arena_resource10deallocateEPvmm
+	.type	_ZN1n14arena_resource10deallocateEPvmm, @function
+_ZN1n14arena_resource10deallocateEPvmm:
+.LFB6617:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE6617:
+	.size	_ZN1n14arena_resource10deallocateEPvmm, .-_ZN1n14arena_resource10deallocateEPvmm
+	.section	.text._ZN1n13pool_resourceD2Ev,"axG",@progbits,_ZN1n13pool_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13pool_resourceD2Ev
+	.type	_ZN1n13pool_resourceD2Ev, @function
+_ZN1n13pool_resourceD2Ev:
+.LFB6622:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6622
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	leaq	16+_ZTVN1n13pool_resourceE(%rip), %rax
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movq	16(%rdi), %rbx
+	movq	%rax, (%rdi)
+	testq	%rbx, %rbx
+	je	.L18
+	movq	%rdi, %rbp
+	.p2align 4,,10
+	.p2align 3
+.L20:
+	movq	8(%rbp), %rdi
+	movq	%rbx, %rsi
+	movq	(%rbx), %rbx
+	movl	$16, %ecx
+	movq	8(%rsi), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	%rbx, 16(%rbp)
+	testq	%rbx, %rbx
+	jne	.L20
+.L18:
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE6622:
+	.section	.gcc_except_table._ZN1n13pool_resourceD2Ev,"aG",@progbits,_ZN1n13pool_resourceD5Ev,comdat
+.LLSDA6622:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6622-.LLSDACSB6622
+.LLSDACSB6622:
+.LLSDACSE6622:
+	.section	.text._ZN1n13pool_resourceD2Ev,"axG",@progbits,_ZN1n13pool_resourceD5Ev,comdat
+	.size	_ZN1n13pool_resourceD2Ev, .-_ZN1n13pool_resourceD2Ev
+	.weak	_ZN1n13pool_resourceD1Ev
+	.set	_ZN1n13pool_resourceD1Ev,_ZN1n13pool_resourceD2Ev
+	.section	.text._ZN1n13pool_resource10deallocateEPvmm,"axG",@progbits,_ZN1n13pool_resource10deallocateEPvmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13pool_resource10deallocateEPvmm
+	.type	_ZN1n13pool_resource10deallocateEPvmm, @function
+_ZN1n13pool_resource10deallocateEPvmm:
+.LFB6630:
+	.cfi_startproc
+	cmpq	%rdx, 32(%rdi)
+	jb	.L27
+	cmpq	$16, %rcx
+	jbe	.L36
+.L27:
+	movq	8(%rdi), %rdi
+	movq	(%rdi), %rax
+	jmp	*24(%rax)
+	.p2align 4,,10
+	.p2align 3
+.L36:
+	testq	%rsi, %rsi
+	je	.L37
+	movq	24(%rdi), %rax
+	movq	%rax, (%rsi)
+	movq	%rsi, 24(%rdi)
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L37:
+	ret
+	.cfi_endproc
+.LFE6630:
+	.size	_ZN1n13pool_resource10deallocateEPvmm, .-_ZN1n13pool_resource10deallocateEPvmm
+	.section	.text._ZN17counting_resourceD2Ev,"axG",@progbits,_ZN17counting_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN17counting_resourceD2Ev
+	.type	_ZN17counting_resourceD2Ev, @function
+_ZN17counting_resourceD2Ev:
+.LFB6887:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE6887:
+	.size	_ZN17counting_resourceD2Ev, .-_ZN17counting_resourceD2Ev
+	.weak	_ZN17counting_resourceD1Ev
+	.set	_ZN17counting_resourceD1Ev,_ZN17counting_resourceD2Ev
+	.section	.text._ZN1n13heap_resourceD2Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD2Ev
+	.type	_ZN1n13heap_resourceD2Ev, @function
+_ZN1n13heap_resourceD2Ev:
+.LFB6891:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE6891:
+	.size	_ZN1n13heap_resourceD2Ev, .-_ZN1n13heap_resourceD2Ev
+	.weak	_ZN1n13heap_resourceD1Ev
+	.set	_ZN1n13heap_resourceD1Ev,_ZN1n13heap_resourceD2Ev
+	.section	.text._ZN1n13heap_resourceD0Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD0Ev
+	.type	_ZN1n13heap_resourceD0Ev, @function
+_ZN1n13heap_resourceD0Ev:
+.LFB6893:
+	.cfi_startproc
+	movl	$8, %esi
+	jmp	_ZdlPvm@PLT
+	.cfi_endproc
+.LFE6893:
+	.size	_ZN1n13heap_resourceD0Ev, .-_ZN1n13heap_resourceD0Ev
+	.section	.text._ZN17counting_resourceD0Ev,"axG",@progbits,_ZN17counting_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN17counting_resourceD0Ev
+	.type	_ZN17counting_resourceD0Ev, @function
+_ZN17counting_resourceD0Ev:
+.LFB6889:
+	.cfi_startproc
+	movl	$16, %esi
+	jmp	_ZdlPvm@PLT
+	.cfi_endproc
+.LFE6889:
+	.size	_ZN17counting_resourceD0Ev, .-_ZN17counting_resourceD0Ev
+	.section	.text._ZN1n14arena_resourceD0Ev,"axG",@progbits,_ZN1n14arena_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n14arena_resourceD0Ev
+	.type	_ZN1n14arena_resourceD0Ev, @function
+_ZN1n14arena_resourceD0Ev:
+.LFB6606:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6606
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	leaq	16+_ZTVN1n14arena_resourceE(%rip), %rax
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movq	16(%rdi), %rbx
+	movq	%rax, (%rdi)
+	testq	%rbx, %rbx
+	je	.L43
+	.p2align 4,,10
+	.p2align 3
+.L44:
+	movq	8(%rbp), %rdi
+	movq	%rbx, %rsi
+	movq	(%rbx), %rbx
+	movl	$8, %ecx
+	movq	8(%rsi), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	%rbx, 16(%rbp)
+	testq	%rbx, %rbx
+	jne	.L44
+.L43:
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	movq	%rbp, %rdi
+	movl	$48, %esi
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	jmp	_ZdlPvm@PLT
+	.cfi_endproc
+.LFE6606:
+	.section	.gcc_except_table._ZN1n14arena_resourceD0Ev,"aG",@progbits,_ZN1n14arena_resourceD5Ev,comdat
+.LLSDA6606:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6606-.LLSDACSB6606
+.LLSDACSB6606:
+.LLSDACSE6606:
+	.section	.text._ZN1n14arena_resourceD0Ev,"axG",@progbits,_ZN1n14arena_resourceD5Ev,comdat
+	.size	_ZN1n14arena_resourceD0Ev, .-_ZN1n14arena_resourceD0Ev
+	.section	.text._ZN1n13pool_resourceD0Ev,"axG",@progbits,_ZN1n13pool_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13pool_resourceD0Ev
+	.type	_ZN1n13pool_resourceD0Ev, @function
+_ZN1n13pool_resourceD0Ev:
+.LFB6624:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6624
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	leaq	16+_ZTVN1n13pool_resourceE(%rip), %rax
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movq	16(%rdi), %rbx
+	movq	%rax, (%rdi)
+	testq	%rbx, %rbx
+	je	.L51
+	.p2align 4,,10
+	.p2align 3
+.L52:
+	movq	8(%rbp), %rdi
+	movq	%rbx, %rsi
+	movq	(%rbx), %rbx
+	movl	$16, %ecx
+	movq	8(%rsi), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	%rbx, 16(%rbp)
+	testq	%rbx, %rbx
+	jne	.L52
+.L51:
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	movq	%rbp, %rdi
+	movl	$48, %esi
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	jmp	_ZdlPvm@PLT
+	.cfi_endproc
+.LFE6624:
+	.section	.gcc_except_table._ZN1n13pool_resourceD0Ev,"aG",@progbits,_ZN1n13pool_resourceD5Ev,comdat
+.LLSDA6624:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6624-.LLSDACSB6624
+.LLSDACSB6624:
+.LLSDACSE6624:
+	.section	.text._ZN1n13pool_resourceD0Ev,"axG",@progbits,_ZN1n13pool_resourceD5Ev,comdat
+	.size	_ZN1n13pool_resourceD0Ev, .-_ZN1n13pool_resourceD0Ev
+	.section	.text._ZN1n13heap_resource10deallocateEPvmm,"axG",@progbits,_ZN1n13heap_resource10deallocateEPvmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource10deallocateEPvmm
+	.type	_ZN1n13heap_resource10deallocateEPvmm, @function
+_ZN1n13heap_resource10deallocateEPvmm:
+.LFB6590:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rcx
+	jbe	.L59
+	movq	%rcx, %rsi
+	jmp	_ZdlPvSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L59:
+	jmp	_ZdlPv@PLT
+	.cfi_endproc
+.LFE6590:
+	.size	_ZN1n13heap_resource10deallocateEPvmm, .-_ZN1n13heap_resource10deallocateEPvmm
+	.section	.text._ZN1n13heap_resource8allocateEmm,"axG",@progbits,_ZN1n13heap_resource8allocateEmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource8allocateEmm
+	.type	_ZN1n13heap_resource8allocateEmm, @function
+_ZN1n13heap_resource8allocateEmm:
+.LFB6589:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rdx
+	jbe	.L61
+	movq	%rdx, %rsi
+	jmp	_ZnwmSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L61:
+	jmp	_Znwm@PLT
+	.cfi_endproc
+.LFE6589:
+	.size	_ZN1n13heap_resource8allocateEmm, .-_ZN1n13heap_resource8allocateEmm
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC0:
+	.string	"expected true : res.allocations > 0"
+	.align 8
+.LC1:
+	.string	"expected equal : expected value : res.deallocations, actual value : res.allocations"
+	.section	.text.unlikely,"ax",@progbits
+.LCOLDB2:
+	.text
+.LHOTB2:
+	.p2align 4
+	.globl	_Z29test_vector_explicit_resourcev
+	.type	_Z29test_vector_explicit_resourcev, @function
+_Z29test_vector_explicit_resourcev:
+.LFB6777:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6777
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leaq	16+_ZTV17counting_resource(%rip), %rax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	xorl	%r12d, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	xorl	%ebp, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	xorl	%ebx, %ebx
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	movq	%rax, 16(%rsp)
+	leaq	16(%rsp), %rax
+	movq	$0, 24(%rsp)
+	movq	%rax, 8(%rsp)
+	jmp	.L71
+	.p2align 4,,10
+	.p2align 3
+.L63:
+	movl	%ebx, (%r12,%rbx,4)
+	addq	$1, %rbx
+	cmpq	$100, %rbx
+	je	.L92
+.L71:
+	cmpq	%rbp, %rbx
+	jne	.L63
+	leaq	5(%rbx), %rsi
+	movq	8(%rsp), %rdi
+	movl	$4, %edx
+	leaq	(%rsi,%rsi), %r15
+	salq	$3, %rsi
+.LEHB0:
+	call	_ZN17counting_resource8allocateEmm
+.LEHE0:
+	movl	%ebx, (%rax,%rbx,4)
+	movq	%rax, %r14
+	leaq	0(,%rbx,4), %rdx
+	testq	%rbx, %rbx
+	jne	.L93
+	testq	%r12, %r12
+	je	.L77
+.L65:
+	movq	8(%rsp), %rdi
+	leaq	0(,%rbp,4), %rdx
+	movl	$4, %ecx
+	movq	%r12, %rsi
+.LEHB1:
+	call	_ZN17counting_resource10deallocateEPvmm
+.LEHE1:
+	addq	$1, %rbx
+	movq	%r15, %rbp
+	movq	%r14, %r12
+	cmpq	$100, %rbx
+	jne	.L71
+	.p2align 4,,10
+	.p2align 3
+.L92:
+	movl	24(%rsp), %eax
+	testl	%eax, %eax
+	jle	.L88
+	testq	%r12, %r12
+	je	.L73
+	leaq	0(,%rbp,4), %rdx
+	leaq	16(%rsp), %rdi
+	movl	$4, %ecx
+	movq	%r12, %rsi
+	call	_ZN17counting_resource10deallocateEPvmm
+	movl	24(%rsp), %eax
+.L73:
+	cmpl	%eax, 28(%rsp)
+	jne	.L89
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L93:
+	.cfi_restore_state
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L65
+	.p2align 4,,10
+	.p2align 3
+.L77:
+	movq	%r15, %rbp
+	movq	%rax, %r12
+	movl	$1, %ebx
+	jmp	.L71
+.L79:
+	movq	%rax, %rbx
+	jmp	.L69
+.L81:
+	movq	%rax, %rbx
+	jmp	.L68
+	.section	.gcc_except_table,"a",@progbits
+.LLSDA6777:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6777-.LLSDACSB6777
+.LLSDACSB6777:
+	.uleb128 .LEHB0-.LFB6777
+	.uleb128 .LEHE0-.LEHB0
+	.uleb128 .L79-.LFB6777
+	.uleb128 0
+	.uleb128 .LEHB1-.LFB6777
+	.uleb128 .LEHE1-.LEHB1
+	.uleb128 .L81-.LFB6777
+	.uleb128 0
+.LLSDACSE6777:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6777
+	.type	_Z29test_vector_explicit_resourcev.cold, @function
+_Z29test_vector_explicit_resourcev.cold:
+.LFSB6777:
+.L89:
+	.cfi_def_cfa_offset 96
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC1(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB2:
+	call	__cxa_throw@PLT
+.LEHE2:
+.L68:
+	movq	%r14, %r12
+.L69:
+	testq	%r12, %r12
+	je	.L76
+	leaq	0(,%r15,4), %rdx
+	leaq	16(%rsp), %rdi
+	movl	$4, %ecx
+	movq	%r12, %rsi
+	call	_ZN17counting_resource10deallocateEPvmm
+.L76:
+	movq	%rbx, %rdi
+.LEHB3:
+	call	_Unwind_Resume@PLT
+.LEHE3:
+.L88:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC0(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB4:
+	call	__cxa_throw@PLT
+.LEHE4:
+.L80:
+	movq	%rax, %rbx
+	movq	%rbp, %r15
+	jmp	.L69
+	.cfi_endproc
+.LFE6777:
+	.section	.gcc_except_table
+.LLSDAC6777:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6777-.LLSDACSBC6777
+.LLSDACSBC6777:
+	.uleb128 .LEHB2-.LCOLDB2
+	.uleb128 .LEHE2-.LEHB2
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB3-.LCOLDB2
+	.uleb128 .LEHE3-.LEHB3
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB4-.LCOLDB2
+	.uleb128 .LEHE4-.LEHB4
+	.uleb128 .L80-.LCOLDB2
+	.uleb128 0
+.LLSDACSEC6777:
+	.section	.text.unlikely
+	.text
+	.size	_Z29test_vector_explicit_resourcev, .-_Z29test_vector_explicit_resourcev
+	.section	.text.unlikely
+	.size	_Z29test_vector_explicit_resourcev.cold, .-_Z29test_vector_explicit_resourcev.cold
+.LCOLDE2:
+	.text
+.LHOTE2:
+	.section	.text._ZN1n13pool_resource8allocateEmm,"axG",@progbits,_ZN1n13pool_resource8allocateEmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13pool_resource8allocateEmm
+	.type	_ZN1n13pool_resource8allocateEmm, @function
+_ZN1n13pool_resource8allocateEmm:
+.LFB6629:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movq	32(%rdi), %rax
+	cmpq	%rsi, %rax
+	jb	.L95
+	cmpq	$16, %rdx
+	jbe	.L112
+.L95:
+	movq	8(%rbx), %rdi
+	movq	(%rdi), %rax
+	movq	16(%rax), %rax
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	jmp	*%rax
+	.p2align 4,,10
+	.p2align 3
+.L112:
+	.cfi_restore_state
+	movq	24(%rdi), %rdx
+	testq	%rdx, %rdx
+	je	.L96
+.L111:
+	movq	(%rdx), %rsi
+.L97:
+	movq	%rsi, 24(%rbx)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	movq	%rdx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L96:
+	.cfi_restore_state
+	imulq	40(%rdi), %rax
+	movq	8(%rdi), %rdi
+	movl	$16, %edx
+	leaq	16(%rax), %rbp
+	movq	(%rdi), %rax
+	movq	%rbp, %rsi
+	call	*16(%rax)
+	movq	16(%rbx), %rdx
+	movq	40(%rbx), %rcx
+	movq	%rbp, 8(%rax)
+	movq	%rdx, (%rax)
+	movq	%rax, 16(%rbx)
+	testq	%rcx, %rcx
+	je	.L113
+	movq	32(%rbx), %r8
+	subq	$1, %rcx
+	movq	24(%rbx), %rdi
+	movq	%rcx, %rdx
+	imulq	%r8, %rdx
+	leaq	16(%rax,%rdx), %rdx
+	jmp	.L99
+	.p2align 4,,10
+	.p2align 3
+.L114:
+	subq	$1, %rcx
+.L99:
+	movq	%rdi, %rsi
+	movq	%rdx, %rdi
+	movq	%rsi, (%rdx)
+	subq	%r8, %rdx
+	testq	%rcx, %rcx
+	jne	.L114
+	leaq	16(%rax), %rdx
+	jmp	.L97
+.L113:
+	movq	24(%rbx), %rdx
+	jmp	.L111
+	.cfi_endproc
+.LFE6629:
+	.size	_ZN1n13pool_resource8allocateEmm, .-_ZN1n13pool_resource8allocateEmm
+	.section	.rodata.str1.8
+	.align 8
+.LC3:
+	.string	"expected true : upstream.allocations > 1"
+	.align 8
+.LC4:
+	.string	"expected equal : expected value : upstream.deallocations, actual value : 0"
+	.align 8
+.LC5:
+	.string	"expected equal : expected value : upstream.deallocations, actual value : upstream.allocations"
+	.section	.text.unlikely
+.LCOLDB6:
+	.text
+.LHOTB6:
+	.p2align 4
+	.globl	_Z30test_arena_release_in_one_stepv
+	.type	_Z30test_arena_release_in_one_stepv, @function
+_Z30test_arena_release_in_one_stepv:
+.LFB6771:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6771
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	leaq	16+_ZTV17counting_resource(%rip), %rax
+	xorl	%esi, %esi
+	xorl	%ecx, %ecx
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	movl	$128, %r13d
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	xorl	%r12d, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movl	$32, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movl	$100, %ebx
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 64
+	movq	%rax, (%rsp)
+	movq	$0, 8(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L118:
+	leaq	7(%rcx), %rdx
+	movq	%rbp, %rax
+	andq	$-8, %rdx
+	subq	%rcx, %rax
+	testq	%rcx, %rcx
+	je	.L116
+	addq	%rax, %rdx
+	movq	%rsi, %rax
+	subq	%rcx, %rax
+	cmpq	%rdx, %rax
+	jnb	.L117
+.L116:
+	movl	$48, %eax
+	movq	%rsp, %r14
+	movl	$8, %edx
+	cmpq	%rax, %r13
+	movq	%r14, %rdi
+	cmovb	%rax, %r13
+	movq	%r13, %rsi
+.LEHB5:
+	call	_ZN17counting_resource8allocateEmm
+.LEHE5:
+	leaq	16(%rax), %rcx
+	leaq	23(%rax), %rdx
+	movq	%rbp, %rdi
+	movq	%r12, (%rax)
+	andq	$-8, %rdx
+	subq	%rcx, %rdi
+	movq	%r13, 8(%rax)
+	leaq	(%rax,%r13), %rsi
+	addq	%rdi, %rdx
+	addq	%r13, %r13
+	movq	%rax, %r12
+.L117:
+	addq	%rdx, %rcx
+	subl	$1, %ebx
+	jne	.L118
+	cmpl	$1, 8(%rsp)
+	jle	.L142
+	movl	12(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L120
+	movq	%rsp, %r14
+	testq	%r12, %r12
+	je	.L145
+	.p2align 4,,10
+	.p2align 3
+.L121:
+	movq	%r12, %rbx
+	movl	$8, %ecx
+	movq	%r14, %rdi
+	movq	(%r12), %r12
+	movq	8(%rbx), %rdx
+	movq	%rbx, %rsi
+.LEHB6:
+	call	_ZN17counting_resource10deallocateEPvmm
+.LEHE6:
+	testq	%r12, %r12
+	jne	.L121
+	movl	8(%rsp), %eax
+	cmpl	%eax, 12(%rsp)
+	jne	.L122
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+.L145:
+	.cfi_restore_state
+	jmp	.L122
+.L132:
+	movq	%rax, %rbp
+	jmp	.L124
+.L140:
+	jmp	.L141
+	.section	.gcc_except_table
+.LLSDA6771:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6771-.LLSDACSB6771
+.LLSDACSB6771:
+	.uleb128 .LEHB5-.LFB6771
+	.uleb128 .LEHE5-.LEHB5
+	.uleb128 .L140-.LFB6771
+	.uleb128 0
+	.uleb128 .LEHB6-.LFB6771
+	.uleb128 .LEHE6-.LEHB6
+	.uleb128 .L132-.LFB6771
+	.uleb128 0
+.LLSDACSE6771:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6771
+	.type	_Z30test_arena_release_in_one_stepv.cold, @function
+_Z30test_arena_release_in_one_stepv.cold:
+.LFSB6771:
+.L120:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -48
+	.cfi_offset 6, -40
+	.cfi_offset 12, -32
+	.cfi_offset 13, -24
+	.cfi_offset 14, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC4(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB7:
+	call	__cxa_throw@PLT
+.L142:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC3(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE7:
+.L122:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC5(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB8:
+	call	__cxa_throw@PLT
+.LEHE8:
+.L130:
+.L141:
+	movq	%rax, %rbp
+.L125:
+	movq	%rsp, %rbx
+.L127:
+	testq	%r12, %r12
+	je	.L146
+	movq	(%r12), %r13
+	movq	8(%r12), %rdx
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	movl	$8, %ecx
+	call	_ZN17counting_resource10deallocateEPvmm
+	movq	%r13, %r12
+	jmp	.L127
+.L131:
+	movq	%rax, %rbp
+	xorl	%r12d, %r12d
+	jmp	.L125
+.L124:
+	movq	%rbx, %r12
+	jmp	.L125
+.L146:
+	movq	%rbp, %rdi
+.LEHB9:
+	call	_Unwind_Resume@PLT
+.LEHE9:
+	.cfi_endproc
+.LFE6771:
+	.section	.gcc_except_table
+.LLSDAC6771:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6771-.LLSDACSBC6771
+.LLSDACSBC6771:
+	.uleb128 .LEHB7-.LCOLDB6
+	.uleb128 .LEHE7-.LEHB7
+	.uleb128 .L130-.LCOLDB6
+	.uleb128 0
+	.uleb128 .LEHB8-.LCOLDB6
+	.uleb128 .LEHE8-.LEHB8
+	.uleb128 .L131-.LCOLDB6
+	.uleb128 0
+	.uleb128 .LEHB9-.LCOLDB6
+	.uleb128 .LEHE9-.LEHB9
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6771:
+	.section	.text.unlikely
+	.text
+	.size	_Z30test_arena_release_in_one_stepv, .-_Z30test_arena_release_in_one_stepv
+	.section	.text.unlikely
+	.size	_Z30test_arena_release_in_one_stepv.cold, .-_Z30test_arena_release_in_one_stepv.cold
+.LCOLDE6:
+	.text
+.LHOTE6:
+	.section	.text._ZN17counting_resource8allocateEmm,"axG",@progbits,_ZN17counting_resource8allocateEmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN17counting_resource8allocateEmm
+	.type	_ZN17counting_resource8allocateEmm, @function
+_ZN17counting_resource8allocateEmm:
+.LFB6763:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rsi, %rbx
+	addl	$1, 8(%rdi)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L155
+.L149:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	movq	(%rdi), %rax
+	movq	16(%rax), %rax
+	jmp	*%rax
+	.p2align 4,,10
+	.p2align 3
+.L155:
+	.cfi_restore_state
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L149
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L149
+	.cfi_endproc
+.LFE6763:
+	.size	_ZN17counting_resource8allocateEmm, .-_ZN17counting_resource8allocateEmm
+	.section	.text._ZN17counting_resource10deallocateEPvmm,"axG",@progbits,_ZN17counting_resource10deallocateEPvmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN17counting_resource10deallocateEPvmm
+	.type	_ZN17counting_resource10deallocateEPvmm, @function
+_ZN17counting_resource10deallocateEPvmm:
+.LFB6764:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rcx, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rdx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rsi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	addl	$1, 12(%rdi)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L164
+.L158:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%r12, %rcx
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movq	(%rdi), %rax
+	movq	24(%rax), %rax
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	jmp	*%rax
+	.p2align 4,,10
+	.p2align 3
+.L164:
+	.cfi_restore_state
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L158
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r13, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L158
+	.cfi_endproc
+.LFE6764:
+	.size	_ZN17counting_resource10deallocateEPvmm, .-_ZN17counting_resource10deallocateEPvmm
+	.text
+	.p2align 4
+	.globl	_Z24test_arena_caller_bufferv
+	.type	_Z24test_arena_caller_bufferv, @function
+_Z24test_arena_caller_bufferv:
+.LFB6775:
+	.cfi_startproc
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L176
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L176:
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	jne	.L177
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L177:
+	.cfi_restore_state
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	jmp	__cxa_guard_release@PLT
+	.cfi_endproc
+.LFE6775:
+	.size	_Z24test_arena_caller_bufferv, .-_Z24test_arena_caller_bufferv
+	.section	.rodata.str1.8
+	.align 8
+.LC7:
+	.string	"expected equal : expected value : reinterpret_cast<n::size_t>(p1) % 8, actual value : 0"
+	.align 8
+.LC8:
+	.string	"expected equal : expected value : reinterpret_cast<n::size_t>(p2) % 16, actual value : 0"
+	.section	.text.unlikely
+.LCOLDB9:
+	.text
+.LHOTB9:
+	.p2align 4
+	.globl	_Z20test_arena_alignmentv
+	.type	_Z20test_arena_alignmentv, @function
+_Z20test_arena_alignmentv:
+.LFB6765:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6765
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L208
+.L180:
+	movq	_ZZN1n4heapEvE3res(%rip), %rbp
+	movl	$8, %edx
+	movl	$64, %esi
+	movq	0(%rbp), %rax
+	movq	%rbp, %rdi
+.LEHB10:
+	call	*16(%rax)
+.LEHE10:
+	movq	$0, (%rax)
+	leaq	17(%rax), %r12
+	movq	%rax, %r13
+	leaq	24(%rax), %rax
+	movq	$64, -16(%rax)
+	andq	$-8, %rax
+	subq	%r12, %rax
+	leaq	8(%rax), %rdx
+	cmpq	$47, %rdx
+	ja	.L185
+	leaq	64(%r13), %rsi
+	movq	%r13, %rbx
+	movl	$128, %r13d
+.L186:
+	addq	%rax, %r12
+	leaq	23(%r12), %rdx
+	leaq	8(%r12), %rcx
+	andq	$-16, %rdx
+	subq	%rcx, %rsi
+	subq	%rcx, %rdx
+	leaq	100(%rdx), %rax
+	cmpq	%rax, %rsi
+	jnb	.L187
+	movq	0(%rbp), %rax
+	movl	$8, %edx
+	movq	%r13, %rsi
+	movq	%rbp, %rdi
+.LEHB11:
+	call	*16(%rax)
+.LEHE11:
+	leaq	31(%rax), %rdx
+	movq	%r13, 8(%rax)
+	leaq	16(%rax), %rcx
+	andq	$-16, %rdx
+	movq	%rbx, (%rax)
+	movq	%rax, %rbx
+	subq	%rcx, %rdx
+.L187:
+	addq	%rdx, %rcx
+	andl	$7, %r12d
+	jne	.L204
+	andl	$15, %ecx
+	jne	.L189
+	.p2align 4,,10
+	.p2align 3
+.L190:
+	movq	%rbx, %rsi
+	movq	0(%rbp), %rax
+	movq	(%rbx), %rbx
+	movl	$8, %ecx
+	movq	8(%rsi), %rdx
+	movq	%rbp, %rdi
+	call	*24(%rax)
+	testq	%rbx, %rbx
+	jne	.L190
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L185:
+	.cfi_restore_state
+	movq	0(%rbp), %rax
+	movl	$8, %edx
+	movl	$128, %esi
+	movq	%rbp, %rdi
+.LEHB12:
+	call	*16(%rax)
+.LEHE12:
+	movq	%r13, (%rax)
+	leaq	16(%rax), %r12
+	movq	%rax, %rbx
+	movl	$256, %r13d
+	movq	$128, 8(%rax)
+	leaq	128(%rax), %rsi
+	leaq	23(%rax), %rax
+	andq	$-8, %rax
+	subq	%r12, %rax
+	jmp	.L186
+	.p2align 4,,10
+	.p2align 3
+.L208:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L180
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L180
+.L197:
+	movq	%rax, %r12
+	jmp	.L183
+.L196:
+	movq	%rax, %r12
+	jmp	.L193
+.L202:
+	jmp	.L203
+	.section	.gcc_except_table
+.LLSDA6765:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6765-.LLSDACSB6765
+.LLSDACSB6765:
+	.uleb128 .LEHB10-.LFB6765
+	.uleb128 .LEHE10-.LEHB10
+	.uleb128 .L197-.LFB6765
+	.uleb128 0
+	.uleb128 .LEHB11-.LFB6765
+	.uleb128 .LEHE11-.LEHB11
+	.uleb128 .L202-.LFB6765
+	.uleb128 0
+	.uleb128 .LEHB12-.LFB6765
+	.uleb128 .LEHE12-.LEHB12
+	.uleb128 .L196-.LFB6765
+	.uleb128 0
+.LLSDACSE6765:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6765
+	.type	_Z20test_arena_alignmentv.cold, @function
+_Z20test_arena_alignmentv.cold:
+.LFSB6765:
+.L204:
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -40
+	.cfi_offset 6, -32
+	.cfi_offset 12, -24
+	.cfi_offset 13, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC7(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB13:
+	call	__cxa_throw@PLT
+.L189:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC8(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE13:
+.L193:
+	movq	%r13, %rbx
+.L192:
+	testq	%rbx, %rbx
+	je	.L209
+	movq	(%rbx), %r13
+	movq	0(%rbp), %rax
+	movq	%rbx, %rsi
+	movl	$8, %ecx
+	movq	8(%rbx), %rdx
+	movq	%rbp, %rdi
+	call	*24(%rax)
+	movq	%r13, %rbx
+	jmp	.L192
+.L195:
+.L203:
+	movq	%rax, %r12
+	jmp	.L192
+.L183:
+	xorl	%ebx, %ebx
+	jmp	.L192
+.L209:
+	movq	%r12, %rdi
+.LEHB14:
+	call	_Unwind_Resume@PLT
+.LEHE14:
+	.cfi_endproc
+.LFE6765:
+	.section	.gcc_except_table
+.LLSDAC6765:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6765-.LLSDACSBC6765
+.LLSDACSBC6765:
+	.uleb128 .LEHB13-.LCOLDB9
+	.uleb128 .LEHE13-.LEHB13
+	.uleb128 .L195-.LCOLDB9
+	.uleb128 0
+	.uleb128 .LEHB14-.LCOLDB9
+	.uleb128 .LEHE14-.LEHB14
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6765:
+	.section	.text.unlikely
+	.text
+	.size	_Z20test_arena_alignmentv, .-_Z20test_arena_alignmentv
+	.section	.text.unlikely
+	.size	_Z20test_arena_alignmentv.cold, .-_Z20test_arena_alignmentv.cold
+.LCOLDE9:
+	.text
+.LHOTE9:
+	.section	.rodata.str1.8
+	.align 8
+.LC10:
+	.string	"expected true : big != nullptr"
+	.section	.text.unlikely
+.LCOLDB11:
+	.text
+.LHOTB11:
+	.p2align 4
+	.globl	_Z25test_pool_recycles_blocksv
+	.type	_Z25test_pool_recycles_blocksv, @function
+_Z25test_pool_recycles_blocksv:
+.LFB6776:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6776
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L231
+.L212:
+	movq	_ZZN1n4heapEvE3res(%rip), %rbp
+	movl	$16, %edx
+	movl	$144, %esi
+	movq	0(%rbp), %rax
+	movq	%rbp, %rdi
+.LEHB15:
+	call	*16(%rax)
+.LEHE15:
+	movq	%rax, %rbx
+	leaq	112(%rax), %rax
+	movl	$8, %edx
+	movq	%rbp, %rdi
+	movq	$0, -112(%rax)
+	movl	$1000, %esi
+	movq	$144, -104(%rax)
+	movq	$0, (%rax)
+	movq	%rax, 80(%rbx)
+	leaq	80(%rbx), %rax
+	movq	%rax, 48(%rbx)
+	leaq	48(%rbx), %rax
+	movq	%rax, 16(%rbx)
+	movq	0(%rbp), %rax
+.LEHB16:
+	call	*16(%rax)
+	testq	%rax, %rax
+	je	.L228
+	movq	0(%rbp), %r8
+	movl	$8, %ecx
+	movq	%rax, %rsi
+	movq	%rbp, %rdi
+	movl	$1000, %edx
+	call	*24(%r8)
+.LEHE16:
+	.p2align 4,,10
+	.p2align 3
+.L215:
+	movq	%rbx, %rsi
+	movq	0(%rbp), %rax
+	movq	(%rbx), %rbx
+	movl	$16, %ecx
+	movq	8(%rsi), %rdx
+	movq	%rbp, %rdi
+	call	*24(%rax)
+	testq	%rbx, %rbx
+	jne	.L215
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L231:
+	.cfi_restore_state
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L212
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L212
+.L221:
+	movq	%rax, %r12
+	jmp	.L217
+.L226:
+	jmp	.L227
+	.section	.gcc_except_table
+.LLSDA6776:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6776-.LLSDACSB6776
+.LLSDACSB6776:
+	.uleb128 .LEHB15-.LFB6776
+	.uleb128 .LEHE15-.LEHB15
+	.uleb128 .L221-.LFB6776
+	.uleb128 0
+	.uleb128 .LEHB16-.LFB6776
+	.uleb128 .LEHE16-.LEHB16
+	.uleb128 .L226-.LFB6776
+	.uleb128 0
+.LLSDACSE6776:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6776
+	.type	_Z25test_pool_recycles_blocksv.cold, @function
+_Z25test_pool_recycles_blocksv.cold:
+.LFSB6776:
+.L228:
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -40
+	.cfi_offset 6, -32
+	.cfi_offset 12, -24
+	.cfi_offset 13, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC10(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB17:
+	call	__cxa_throw@PLT
+.LEHE17:
+.L217:
+	xorl	%ebx, %ebx
+.L216:
+	testq	%rbx, %rbx
+	je	.L232
+	movq	(%rbx), %r13
+	movq	0(%rbp), %rax
+	movq	%rbx, %rsi
+	movl	$16, %ecx
+	movq	8(%rbx), %rdx
+	movq	%rbp, %rdi
+	call	*24(%rax)
+	movq	%r13, %rbx
+	jmp	.L216
+.L220:
+.L227:
+	movq	%rax, %r12
+	jmp	.L216
+.L232:
+	movq	%r12, %rdi
+.LEHB18:
+	call	_Unwind_Resume@PLT
+.LEHE18:
+	.cfi_endproc
+.LFE6776:
+	.section	.gcc_except_table
+.LLSDAC6776:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6776-.LLSDACSBC6776
+.LLSDACSBC6776:
+	.uleb128 .LEHB17-.LCOLDB11
+	.uleb128 .LEHE17-.LEHB17
+	.uleb128 .L220-.LCOLDB11
+	.uleb128 0
+	.uleb128 .LEHB18-.LCOLDB11
+	.uleb128 .LEHE18-.LEHB18
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6776:
+	.section	.text.unlikely
+	.text
+	.size	_Z25test_pool_recycles_blocksv, .-_Z25test_pool_recycles_blocksv
+	.section	.text.unlikely
+	.size	_Z25test_pool_recycles_blocksv.cold, .-_Z25test_pool_recycles_blocksv.cold
+.LCOLDE11:
+	.text
+.LHOTE11:
+	.section	.rodata.str1.8
+	.align 8
+.LC12:
+	.string	"expected equal : expected value : reinterpret_cast<n::size_t>(p) % 128, actual value : 0"
+	.align 8
+.LC13:
+	.string	"expected equal : expected value : reinterpret_cast<n::size_t>(v.data()) % 64, actual value : 0"
+	.section	.text.unlikely
+.LCOLDB14:
+	.text
+.LHOTB14:
+	.p2align 4
+	.globl	_Z24test_heap_over_alignmentv
+	.type	_Z24test_heap_over_alignmentv, @function
+_Z24test_heap_over_alignmentv:
+.LFB6766:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6766
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	andq	$-64, %rsp
+	addq	$-128, %rsp
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L291
+.L235:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$128, %edx
+	movl	$100, %esi
+	movq	(%rdi), %rax
+.LEHB19:
+	call	*16(%rax)
+	movq	%rax, %r13
+	movq	%rax, %rbx
+	andl	$127, %r13d
+	jne	.L288
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L292
+.L239:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$128, %ecx
+	movl	$100, %edx
+	movq	%rbx, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE19:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r15
+	testq	%r15, %r15
+	je	.L293
+.L241:
+	xorl	%ebx, %ebx
+	xorl	%r12d, %r12d
+	jmp	.L260
+	.p2align 4,,10
+	.p2align 3
+.L245:
+	movq	%rbx, %rax
+	pxor	%xmm1, %xmm1
+	salq	$6, %rax
+	addq	%r12, %rax
+	movaps	%xmm1, (%rax)
+	movaps	%xmm1, 16(%rax)
+	movaps	%xmm1, 32(%rax)
+	movaps	%xmm1, 48(%rax)
+.L253:
+	testb	$63, %r12b
+	jne	.L294
+	addq	$1, %rbx
+	cmpq	$100, %rbx
+	je	.L295
+.L260:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 64(%rsp)
+	movaps	%xmm0, 80(%rsp)
+	movaps	%xmm0, 96(%rsp)
+	movaps	%xmm0, 112(%rsp)
+	cmpq	%rbx, %r13
+	jne	.L245
+	leaq	5(%r13), %rsi
+	movl	$64, %edx
+	movq	%r15, %rdi
+	leaq	(%rsi,%rsi), %rax
+	salq	$7, %rsi
+	movq	%rax, 56(%rsp)
+	movq	(%r15), %rax
+.LEHB20:
+	call	*16(%rax)
+.LEHE20:
+	movq	%rax, %r14
+	movdqa	64(%rsp), %xmm2
+	movq	%rbx, %rax
+	movdqa	80(%rsp), %xmm3
+	movdqa	96(%rsp), %xmm4
+	movdqa	112(%rsp), %xmm5
+	salq	$6, %rax
+	movaps	%xmm2, (%r14,%rax)
+	movaps	%xmm3, 16(%r14,%rax)
+	movaps	%xmm4, 32(%r14,%rax)
+	movaps	%xmm5, 48(%r14,%rax)
+	testq	%rbx, %rbx
+	jne	.L296
+	testq	%r12, %r12
+	je	.L252
+.L251:
+	movq	(%r15), %rax
+	movq	%r13, %rdx
+	movl	$64, %ecx
+	movq	%r12, %rsi
+	salq	$6, %rdx
+	movq	%r15, %rdi
+.LEHB21:
+	call	*24(%rax)
+.LEHE21:
+	movq	56(%rsp), %r13
+	movq	%r14, %r12
+	jmp	.L253
+	.p2align 4,,10
+	.p2align 3
+.L296:
+	cmpl	$8, %eax
+	jnb	.L247
+	testl	%eax, %eax
+	je	.L251
+	movzbl	(%r12), %eax
+	movb	%al, (%r14)
+	jmp	.L251
+	.p2align 4,,10
+	.p2align 3
+.L252:
+	movq	%r14, %r12
+	andl	$63, %r14d
+	movq	56(%rsp), %r13
+	jne	.L254
+	movl	$1, %ebx
+	jmp	.L260
+	.p2align 4,,10
+	.p2align 3
+.L247:
+	movq	(%r12), %rdx
+	leaq	8(%r14), %rdi
+	movq	%r12, %rsi
+	andq	$-8, %rdi
+	movq	%rdx, (%r14)
+	movl	%eax, %edx
+	movq	-8(%r12,%rdx), %rcx
+	movq	%rcx, -8(%r14,%rdx)
+	movq	%r14, %rdx
+	subq	%rdi, %rdx
+	leal	(%rax,%rdx), %ecx
+	subq	%rdx, %rsi
+	movl	%ecx, %eax
+	shrl	$3, %eax
+	movl	%eax, %ecx
+	rep movsq
+	jmp	.L251
+.L295:
+	testq	%r12, %r12
+	je	.L233
+	movq	(%r15), %rax
+	movq	%r13, %rdx
+	movl	$64, %ecx
+	movq	%r12, %rsi
+	salq	$6, %rdx
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L233:
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.L291:
+	.cfi_restore_state
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L235
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L235
+.L292:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L239
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L239
+.L293:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L297
+.L243:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	jmp	.L241
+.L297:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L243
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L243
+.L269:
+	movq	%rax, %rbx
+	jmp	.L262
+.L268:
+	movq	%rax, %rbx
+	jmp	.L263
+.L294:
+	jmp	.L254
+	.section	.gcc_except_table
+.LLSDA6766:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6766-.LLSDACSB6766
+.LLSDACSB6766:
+	.uleb128 .LEHB19-.LFB6766
+	.uleb128 .LEHE19-.LEHB19
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB20-.LFB6766
+	.uleb128 .LEHE20-.LEHB20
+	.uleb128 .L268-.LFB6766
+	.uleb128 0
+	.uleb128 .LEHB21-.LFB6766
+	.uleb128 .LEHE21-.LEHB21
+	.uleb128 .L269-.LFB6766
+	.uleb128 0
+.LLSDACSE6766:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6766
+	.type	_Z24test_heap_over_alignmentv.cold, @function
+_Z24test_heap_over_alignmentv.cold:
+.LFSB6766:
+.L288:
+	.cfi_def_cfa 6, 16
+	.cfi_offset 3, -56
+	.cfi_offset 6, -16
+	.cfi_offset 12, -48
+	.cfi_offset 13, -40
+	.cfi_offset 14, -32
+	.cfi_offset 15, -24
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC12(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB22:
+	call	__cxa_throw@PLT
+.LEHE22:
+.L254:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC13(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB23:
+	call	__cxa_throw@PLT
+.LEHE23:
+.L262:
+	movq	%r14, %r12
+.L263:
+	testq	%r12, %r12
+	je	.L264
+.L258:
+	movq	56(%rsp), %rdx
+	movq	(%r15), %rax
+	movl	$64, %ecx
+	movq	%r12, %rsi
+	movq	%r15, %rdi
+	salq	$6, %rdx
+	call	*24(%rax)
+.L264:
+	movq	%rbx, %rdi
+.LEHB24:
+	call	_Unwind_Resume@PLT
+.LEHE24:
+.L267:
+	movq	%r13, 56(%rsp)
+	movq	%rax, %rbx
+	jmp	.L258
+	.cfi_endproc
+.LFE6766:
+	.section	.gcc_except_table
+.LLSDAC6766:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6766-.LLSDACSBC6766
+.LLSDACSBC6766:
+	.uleb128 .LEHB22-.LCOLDB14
+	.uleb128 .LEHE22-.LEHB22
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB23-.LCOLDB14
+	.uleb128 .LEHE23-.LEHB23
+	.uleb128 .L267-.LCOLDB14
+	.uleb128 0
+	.uleb128 .LEHB24-.LCOLDB14
+	.uleb128 .LEHE24-.LEHB24
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6766:
+	.section	.text.unlikely
+	.text
+	.size	_Z24test_heap_over_alignmentv, .-_Z24test_heap_over_alignmentv
+	.section	.text.unlikely
+	.size	_Z24test_heap_over_alignmentv.cold, .-_Z24test_heap_over_alignmentv.cold
+.LCOLDE14:
+	.text
+.LHOTE14:
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC15:
+	.string	"John"
+.LC16:
+	.string	"Mary"
+.LC18:
+	.string	"$ is $ years old, $ is $"
+	.section	.rodata.str1.8
+	.align 8
+.LC21:
+	.string	"expected equal : expected value : s.resource(), actual value : &arena"
+	.align 8
+.LC22:
+	.string	"expected equal : expected value : s.len(), actual value : 32"
+	.align 8
+.LC23:
+	.string	"expected equal : expected value : upstream.allocations, actual value : 1"
+	.align 8
+.LC24:
+	.string	"expected equal : expected value : n::default_resource(), actual value : n::heap()"
+	.align 8
+.LC25:
+	.string	"expected equal : expected value : upstream.deallocations, actual value : 1"
+	.section	.text.unlikely
+.LCOLDB29:
+	.text
+.LHOTB29:
+	.p2align 4
+	.globl	_Z29test_scoped_format_uses_arenav
+	.type	_Z29test_scoped_format_uses_arenav, @function
+_Z29test_scoped_format_uses_arenav:
+.LFB6786:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6786
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leaq	16+_ZTV17counting_resource(%rip), %rax
+	movl	$36, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	leaq	.LC18(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rbp, %rdi
+	subq	$216, %rsp
+	.cfi_def_cfa_offset 272
+	movq	.LC28(%rip), %xmm0
+	movq	%rax, 64(%rsp)
+	leaq	64(%rsp), %rax
+	movq	$0, 72(%rsp)
+	movq	%rax, %xmm1
+	movq	$0, 144(%rsp)
+	punpcklqdq	%xmm1, %xmm0
+	movaps	%xmm0, 112(%rsp)
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 128(%rsp)
+	movdqa	.LC17(%rip), %xmm0
+	movq	$1024, 152(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, 48(%rsp)
+	leaq	112(%rsp), %rax
+	movq	%rax, 56(%rsp)
+	movq	%rax, %fs:_ZN1n18__current_resourceE@tpoff
+	movaps	%xmm0, 160(%rsp)
+	pxor	%xmm0, %xmm0
+	movq	%rax, 176(%rsp)
+	movq	$0, 200(%rsp)
+	movups	%xmm0, 184(%rsp)
+	call	strchrnul@PLT
+	movq	%rax, %rbx
+	movq	%rax, 32(%rsp)
+	movzbl	(%rax), %eax
+	subq	%rbp, %rbx
+	testb	%al, %al
+	jne	.L299
+	jmp	.L300
+	.p2align 4,,10
+	.p2align 3
+.L302:
+	addq	$1, %rbx
+	movzbl	0(%rbp,%rbx), %eax
+	testb	%al, %al
+	je	.L301
+.L299:
+	cmpb	$36, %al
+	jne	.L302
+	leaq	1(%rbp,%rbx), %rax
+	movq	%rax, 32(%rsp)
+.L300:
+	cmpq	$23, %rbx
+	jbe	.L438
+.L528:
+	movl	$56, %r12d
+	movq	56(%rsp), %rdi
+	movl	$1, %edx
+	cmpq	%r12, %rbx
+	cmovnb	%rbx, %r12
+	leaq	1(%r12), %rsi
+.LEHB25:
+	call	_ZN1n14arena_resource8allocateEmm
+	movb	$0, (%rax)
+	movq	%rax, %rcx
+	movq	%rax, 184(%rsp)
+	movq	%r12, 168(%rsp)
+.L304:
+	movq	%rbx, %rdx
+	movq	%rcx, %rdi
+	leaq	.LC15(%rip), %r12
+	movq	%rbp, %rsi
+	call	memcpy@PLT
+	addq	160(%rsp), %rbx
+	movl	$4096, %esi
+	movq	%r12, %rdi
+	movq	%rbx, 160(%rsp)
+	movb	$0, (%rax,%rbx)
+	call	strnlen@PLT
+	movq	%rax, %rbx
+	leaq	(%r12,%rax), %rax
+	movq	%rax, (%rsp)
+	leaq	184(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	testq	%rbx, %rbx
+	jne	.L305
+	jmp	.L321
+	.p2align 4,,10
+	.p2align 3
+.L514:
+	leaq	0(%r13,%r15), %rdx
+	cmpq	%rdx, %r12
+	jnb	.L309
+	subq	%r13, %r12
+	movq	%r12, 8(%rsp)
+	cmpq	%rax, %rbp
+	jnb	.L314
+	leaq	10(%rbp,%rbp), %rdx
+	movq	176(%rsp), %r12
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r12, %rdi
+	movl	$1, %edx
+	movq	%rax, %r14
+	leaq	1(%rax), %rsi
+	movq	(%r12), %rax
+	call	*16(%rax)
+	movq	%rax, 24(%rsp)
+	leaq	1(%r15), %rdx
+	cmpq	$23, %rbp
+	je	.L315
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r12), %rax
+	leaq	1(%rbp), %rdx
+	movq	%r12, %rdi
+	movq	184(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.L316:
+	movq	24(%rsp), %rax
+	movq	%r14, 168(%rsp)
+	movq	%r14, %rbp
+	movq	%rax, 184(%rsp)
+.L314:
+	cmpq	$23, %rbp
+	je	.L513
+	movq	184(%rsp), %r14
+	movq	8(%rsp), %r12
+	addq	%r14, %r12
+.L319:
+	movq	%rbx, %rdx
+	leaq	(%r14,%r15), %rdi
+	movq	%r12, %rsi
+	call	memmove@PLT
+	addq	160(%rsp), %rbx
+	movq	%rbx, 160(%rsp)
+	movb	$0, (%r14,%rbx)
+.L510:
+	movq	(%rsp), %r15
+	movl	$4096, %esi
+	movq	%r15, %rdi
+	call	strnlen@PLT
+	movq	%rax, %rbx
+	leaq	(%r15,%rax), %rax
+	testq	%rbx, %rbx
+	je	.L321
+	movq	(%rsp), %r12
+	movq	%rax, (%rsp)
+.L305:
+	movq	168(%rsp), %rbp
+	movq	16(%rsp), %r13
+	cmpq	$23, %rbp
+	je	.L308
+	movq	184(%rsp), %r13
+.L308:
+	movq	160(%rsp), %r15
+	leaq	(%r15,%rbx), %rax
+	cmpq	%r13, %r12
+	jnb	.L514
+.L309:
+	cmpq	%rax, %rbp
+	jnb	.L311
+	leaq	10(%rbp,%rbp), %rdx
+	movq	176(%rsp), %r14
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r14, %rdi
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r14), %rax
+	call	*16(%rax)
+	movq	%rax, 8(%rsp)
+	leaq	1(%r15), %rdx
+	cmpq	$23, %rbp
+	je	.L515
+	movq	%rax, %rdi
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	movq	(%r14), %rax
+	leaq	1(%rbp), %rdx
+	movq	%r14, %rdi
+	movq	184(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.L313:
+	movq	8(%rsp), %rax
+	movq	%rax, 184(%rsp)
+	movq	24(%rsp), %rax
+	movq	%rax, 168(%rsp)
+	movq	%rax, %rbp
+.L311:
+	cmpq	$23, %rbp
+	je	.L464
+	movq	184(%rsp), %r14
+	jmp	.L319
+	.p2align 4,,10
+	.p2align 3
+.L464:
+	movq	16(%rsp), %rdi
+.L318:
+	movq	%rbx, %rdx
+	addq	%r15, %rdi
+	movq	%r12, %rsi
+	call	memmove@PLT
+	addq	160(%rsp), %rbx
+	movq	%rbx, 160(%rsp)
+	movb	$0, 184(%rsp,%rbx)
+	jmp	.L510
+	.p2align 4,,10
+	.p2align 3
+.L515:
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L313
+	.p2align 4,,10
+	.p2align 3
+.L321:
+	movq	32(%rsp), %r15
+	movl	$36, %esi
+	movq	%r15, %rdi
+	call	strchrnul@PLT
+	movq	%r15, %rdx
+	movq	%rax, %rbx
+	movq	%rax, %rbp
+	movzbl	(%rax), %eax
+	subq	%r15, %rbx
+	testb	%al, %al
+	jne	.L306
+	jmp	.L307
+	.p2align 4,,10
+	.p2align 3
+.L323:
+	addq	$1, %rbx
+	movzbl	(%rdx,%rbx), %eax
+	testb	%al, %al
+	je	.L322
+.L306:
+	cmpb	$36, %al
+	jne	.L323
+	movq	32(%rsp), %rax
+	leaq	1(%rax,%rbx), %rbp
+.L307:
+	movq	168(%rsp), %r12
+	leaq	184(%rsp), %r14
+	cmpq	$23, %r12
+	je	.L325
+	movq	184(%rsp), %r14
+.L325:
+	movq	160(%rsp), %r13
+	movq	32(%rsp), %rcx
+	leaq	(%rbx,%r13), %rax
+	cmpq	%r14, %rcx
+	jb	.L326
+	leaq	(%r14,%r13), %rdx
+	cmpq	%rdx, %rcx
+	jnb	.L326
+	subq	%r14, %rcx
+	movq	%rcx, (%rsp)
+	cmpq	%rax, %r12
+	jnb	.L331
+	leaq	10(%r12,%r12), %rdx
+	movq	176(%rsp), %r15
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r15, %rdi
+	movl	$1, %edx
+	movq	%rax, 16(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	%rax, 8(%rsp)
+	leaq	1(%r13), %rdx
+	cmpq	$23, %r12
+	je	.L332
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	leaq	1(%r12), %rdx
+	movq	%r15, %rdi
+	movq	184(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.L333:
+	movq	8(%rsp), %rax
+	movq	%rax, 184(%rsp)
+	movq	16(%rsp), %rax
+	movq	%rax, 168(%rsp)
+	movq	%rax, %r12
+.L331:
+	cmpq	$23, %r12
+	je	.L516
+	movq	184(%rsp), %r14
+	movq	(%rsp), %rax
+	addq	%r14, %rax
+	movq	%rax, 32(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L335:
+	movq	32(%rsp), %rsi
+	movq	%rbx, %rdx
+	leaq	(%r14,%r13), %rdi
+	call	memmove@PLT
+	addq	160(%rsp), %rbx
+	leaq	80(%rsp), %rcx
+	movzwl	.LC19(%rip), %eax
+	movq	%rbx, 160(%rsp)
+	movq	%rcx, (%rsp)
+	movb	$0, (%r14,%rbx)
+	movw	%ax, 80(%rsp)
+	movl	$2, %eax
+	.p2align 4,,10
+	.p2align 3
+.L337:
+	movq	(%rsp), %rcx
+	movq	160(%rsp), %rbx
+	leaq	-1(%rax), %r13
+	movq	168(%rsp), %r12
+	movzbl	-1(%rcx,%rax), %r14d
+	cmpq	%r12, %rbx
+	je	.L517
+.L338:
+	cmpq	$23, %r12
+	je	.L341
+	movq	184(%rsp), %rdx
+	movb	%r14b, (%rdx,%rbx)
+	movq	160(%rsp), %rax
+	leaq	1(%rax), %rcx
+	movq	%rcx, 160(%rsp)
+	movb	$0, 1(%rdx,%rax)
+	testq	%r13, %r13
+	je	.L343
+.L342:
+	movl	$1, %eax
+	jmp	.L337
+	.p2align 4,,10
+	.p2align 3
+.L326:
+	cmpq	%rax, %r12
+	jnb	.L328
+	leaq	10(%r12,%r12), %rdx
+	movq	176(%rsp), %r15
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r15, %rdi
+	movl	$1, %edx
+	movq	%rax, 8(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	%rax, (%rsp)
+	leaq	1(%r13), %rdx
+	cmpq	$23, %r12
+	je	.L329
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	leaq	1(%r12), %rdx
+	movq	%r15, %rdi
+	movq	184(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.L330:
+	movq	(%rsp), %rax
+	movq	%rax, 184(%rsp)
+	movq	8(%rsp), %rax
+	movq	%rax, 168(%rsp)
+	movq	%rax, %r12
+.L328:
+	leaq	184(%rsp), %r14
+	cmpq	$23, %r12
+	je	.L335
+	movq	184(%rsp), %r14
+	jmp	.L335
+	.p2align 4,,10
+	.p2align 3
+.L341:
+	movb	%r14b, 184(%rsp,%rbx)
+	movq	160(%rsp), %rax
+	addq	$1, %rax
+	movq	%rax, 160(%rsp)
+	movb	$0, 184(%rsp,%rax)
+	testq	%r13, %r13
+	jne	.L342
+.L343:
+	movl	$36, %esi
+	movq	%rbp, %rdi
+	call	strchrnul@PLT
+	movq	%rax, %rbx
+	movq	%rax, 16(%rsp)
+	movzbl	(%rax), %eax
+	subq	%rbp, %rbx
+	testb	%al, %al
+	jne	.L345
+	jmp	.L346
+	.p2align 4,,10
+	.p2align 3
+.L348:
+	addq	$1, %rbx
+	movzbl	0(%rbp,%rbx), %eax
+	testb	%al, %al
+	je	.L347
+.L345:
+	cmpb	$36, %al
+	jne	.L348
+	leaq	1(%rbp,%rbx), %rax
+	movq	%rax, 16(%rsp)
+.L346:
+	movq	168(%rsp), %r12
+	leaq	184(%rsp), %r14
+	cmpq	$23, %r12
+	je	.L350
+	movq	184(%rsp), %r14
+.L350:
+	movq	160(%rsp), %r13
+	leaq	0(%r13,%rbx), %rax
+	cmpq	%r14, %rbp
+	jb	.L351
+	leaq	(%r14,%r13), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L351
+	subq	%r14, %rbp
+	movq	%rbp, 8(%rsp)
+	cmpq	%rax, %r12
+	jnb	.L356
+	leaq	10(%r12,%r12), %rdx
+	movq	176(%rsp), %rbp
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%rbp, %rdi
+	movl	$1, %edx
+	movq	%rax, %r15
+	leaq	1(%rax), %rsi
+	movq	0(%rbp), %rax
+	call	*16(%rax)
+	movq	%rax, 24(%rsp)
+	leaq	1(%r13), %rdx
+	cmpq	$23, %r12
+	je	.L357
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	0(%rbp), %rax
+	leaq	1(%r12), %rdx
+	movq	%rbp, %rdi
+	movq	184(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.L358:
+	movq	24(%rsp), %rax
+	movq	%r15, 168(%rsp)
+	movq	%r15, %r12
+	movq	%rax, 184(%rsp)
+.L356:
+	cmpq	$23, %r12
+	je	.L518
+	movq	184(%rsp), %r14
+	movq	8(%rsp), %rbp
+	addq	%r14, %rbp
+	.p2align 4,,10
+	.p2align 3
+.L360:
+	leaq	(%r14,%r13), %rdi
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	call	memmove@PLT
+	addq	160(%rsp), %rbx
+	movl	$4096, %esi
+	leaq	.LC16(%rip), %r13
+	movq	%rbx, 160(%rsp)
+	movq	%r13, %rdi
+	movb	$0, (%r14,%rbx)
+	call	strnlen@PLT
+	movq	%rax, %rbx
+	leaq	0(%r13,%rax), %r15
+	leaq	184(%rsp), %rax
+	movq	%rax, 8(%rsp)
+	testq	%rbx, %rbx
+	jne	.L362
+	jmp	.L378
+	.p2align 4,,10
+	.p2align 3
+.L520:
+	leaq	(%r14,%r12), %rdx
+	cmpq	%rdx, %r13
+	jnb	.L366
+	subq	%r14, %r13
+	movq	%r13, 24(%rsp)
+	cmpq	%rax, %rbp
+	jnb	.L371
+	leaq	10(%rbp,%rbp), %rdx
+	movq	176(%rsp), %r13
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r13, %rdi
+	movl	$1, %edx
+	movq	%rax, 40(%rsp)
+	leaq	1(%rax), %rsi
+	movq	0(%r13), %rax
+	call	*16(%rax)
+	movq	%rax, 32(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L372
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	0(%r13), %rax
+	leaq	1(%rbp), %rdx
+	movq	%r13, %rdi
+	movq	184(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.L373:
+	movq	32(%rsp), %rax
+	movq	%rax, 184(%rsp)
+	movq	40(%rsp), %rax
+	movq	%rax, 168(%rsp)
+	movq	%rax, %rbp
+.L371:
+	cmpq	$23, %rbp
+	je	.L519
+	movq	184(%rsp), %r14
+	movq	24(%rsp), %r13
+	addq	%r14, %r13
+.L376:
+	movq	%rbx, %rdx
+	leaq	(%r14,%r12), %rdi
+	movq	%r13, %rsi
+	call	memmove@PLT
+	addq	160(%rsp), %rbx
+	movq	%rbx, 160(%rsp)
+	movb	$0, (%r14,%rbx)
+.L512:
+	movl	$4096, %esi
+	movq	%r15, %rdi
+	call	strnlen@PLT
+	movq	%rax, %rbx
+	leaq	(%r15,%rax), %rax
+	testq	%rbx, %rbx
+	je	.L378
+	movq	%r15, %r13
+	movq	%rax, %r15
+.L362:
+	movq	168(%rsp), %rbp
+	movq	8(%rsp), %r14
+	cmpq	$23, %rbp
+	je	.L365
+	movq	184(%rsp), %r14
+.L365:
+	movq	160(%rsp), %r12
+	leaq	(%rbx,%r12), %rax
+	cmpq	%r14, %r13
+	jnb	.L520
+.L366:
+	cmpq	%rax, %rbp
+	jnb	.L368
+	leaq	10(%rbp,%rbp), %rdx
+	movq	176(%rsp), %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%rdi, 40(%rsp)
+	movl	$1, %edx
+	movq	%rax, 32(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, 24(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L369
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	40(%rsp), %rdi
+	leaq	1(%rbp), %rdx
+	movq	184(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L370:
+	movq	24(%rsp), %rax
+	movq	%rax, 184(%rsp)
+	movq	32(%rsp), %rax
+	movq	%rax, 168(%rsp)
+	movq	%rax, %rbp
+.L368:
+	cmpq	$23, %rbp
+	je	.L465
+	movq	184(%rsp), %r14
+	jmp	.L376
+	.p2align 4,,10
+	.p2align 3
+.L351:
+	cmpq	%rax, %r12
+	jnb	.L353
+	leaq	10(%r12,%r12), %rdx
+	movq	176(%rsp), %r15
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r15, %rdi
+	movl	$1, %edx
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	%rax, 8(%rsp)
+	leaq	1(%r13), %rdx
+	cmpq	$23, %r12
+	je	.L354
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	leaq	1(%r12), %rdx
+	movq	%r15, %rdi
+	movq	184(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.L355:
+	movq	8(%rsp), %rax
+	movq	%rax, 184(%rsp)
+	movq	24(%rsp), %rax
+	movq	%rax, 168(%rsp)
+	movq	%rax, %r12
+.L353:
+	leaq	184(%rsp), %r14
+	cmpq	$23, %r12
+	je	.L360
+	movq	184(%rsp), %r14
+	jmp	.L360
+	.p2align 4,,10
+	.p2align 3
+.L465:
+	movq	8(%rsp), %rdi
+.L375:
+	movq	%rbx, %rdx
+	addq	%r12, %rdi
+	movq	%r13, %rsi
+	call	memmove@PLT
+	addq	160(%rsp), %rbx
+	movq	%rbx, 160(%rsp)
+	movb	$0, 184(%rsp,%rbx)
+	jmp	.L512
+	.p2align 4,,10
+	.p2align 3
+.L517:
+	leaq	1(%rbx), %r15
+	cmpq	%r15, %rbx
+	jnb	.L338
+	leaq	10(%rbx,%rbx), %rax
+	movq	176(%rsp), %rdi
+	movl	$1, %edx
+	cmpq	%r15, %rax
+	cmovb	%r15, %rax
+	movq	%rdi, 24(%rsp)
+	movq	%rax, 16(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, 8(%rsp)
+	cmpq	$23, %r12
+	je	.L339
+	movq	184(%rsp), %rsi
+	movq	%r15, %rdx
+	movq	%rax, %rdi
+	movq	%rsi, 32(%rsp)
+	call	memcpy@PLT
+	movq	24(%rsp), %rdi
+	movq	32(%rsp), %rsi
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L340:
+	movq	8(%rsp), %rax
+	movq	%rax, 184(%rsp)
+	movq	16(%rsp), %rax
+	movq	%rax, 168(%rsp)
+	movq	%rax, %r12
+	jmp	.L338
+	.p2align 4,,10
+	.p2align 3
+.L369:
+	movq	%rax, %rdi
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L370
+	.p2align 4,,10
+	.p2align 3
+.L378:
+	movq	16(%rsp), %r15
+	movl	$36, %esi
+	movq	%r15, %rdi
+	call	strchrnul@PLT
+	movq	%r15, %rdx
+	movq	%rax, %rbx
+	movq	%rax, 8(%rsp)
+	movzbl	(%rax), %eax
+	subq	%r15, %rbx
+	testb	%al, %al
+	jne	.L363
+	jmp	.L364
+	.p2align 4,,10
+	.p2align 3
+.L380:
+	addq	$1, %rbx
+	movzbl	(%rdx,%rbx), %eax
+	testb	%al, %al
+	je	.L379
+.L363:
+	cmpb	$36, %al
+	jne	.L380
+	movq	16(%rsp), %rax
+	leaq	1(%rax,%rbx), %rax
+	movq	%rax, 8(%rsp)
+.L364:
+	movq	168(%rsp), %rbp
+	leaq	184(%rsp), %r13
+	cmpq	$23, %rbp
+	je	.L382
+	movq	184(%rsp), %r13
+.L382:
+	movq	160(%rsp), %r12
+	movq	16(%rsp), %rcx
+	leaq	(%r12,%rbx), %rax
+	cmpq	%r13, %rcx
+	jb	.L383
+	leaq	0(%r13,%r12), %rdx
+	cmpq	%rdx, %rcx
+	jnb	.L383
+	subq	%r13, %rcx
+	movq	%rcx, 16(%rsp)
+	cmpq	%rax, %rbp
+	jnb	.L388
+	leaq	10(%rbp,%rbp), %rdx
+	movq	176(%rsp), %r15
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r15, %rdi
+	movl	$1, %edx
+	movq	%rax, %r14
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	%rax, 24(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L389
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	leaq	1(%rbp), %rdx
+	movq	%r15, %rdi
+	movq	184(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.L390:
+	movq	24(%rsp), %rax
+	movq	%r14, 168(%rsp)
+	movq	%r14, %rbp
+	movq	%rax, 184(%rsp)
+.L388:
+	cmpq	$23, %rbp
+	je	.L521
+	movq	16(%rsp), %rax
+	movq	184(%rsp), %r14
+	addq	%r14, %rax
+	movq	%rax, 16(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L392:
+	movq	16(%rsp), %rsi
+	movq	%rbx, %rdx
+	leaq	(%r14,%r12), %rdi
+	call	memmove@PLT
+	addq	160(%rsp), %rbx
+	movzwl	.LC20(%rip), %eax
+	movq	%rbx, 160(%rsp)
+	movb	$0, (%r14,%rbx)
+	movw	%ax, 80(%rsp)
+	movl	$2, %eax
+	.p2align 4,,10
+	.p2align 3
+.L394:
+	movq	(%rsp), %rcx
+	movq	160(%rsp), %rbx
+	leaq	-1(%rax), %r12
+	movq	168(%rsp), %rbp
+	movzbl	-1(%rcx,%rax), %r13d
+	cmpq	%rbp, %rbx
+	je	.L522
+.L395:
+	cmpq	$23, %rbp
+	je	.L398
+	movq	184(%rsp), %rdx
+	movb	%r13b, (%rdx,%rbx)
+	movq	160(%rsp), %rax
+	leaq	1(%rax), %rcx
+	movq	%rcx, 160(%rsp)
+	movb	$0, 1(%rdx,%rax)
+	testq	%r12, %r12
+	je	.L400
+.L399:
+	movl	$1, %eax
+	jmp	.L394
+	.p2align 4,,10
+	.p2align 3
+.L383:
+	cmpq	%rax, %rbp
+	jnb	.L385
+	leaq	10(%rbp,%rbp), %rdx
+	movq	176(%rsp), %r15
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movq	%r15, %rdi
+	movl	$1, %edx
+	movq	%rax, %r14
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	%rax, 24(%rsp)
+	leaq	1(%r12), %rdx
+	cmpq	$23, %rbp
+	je	.L386
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	leaq	1(%rbp), %rdx
+	movq	%r15, %rdi
+	movq	184(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.L387:
+	movq	24(%rsp), %rax
+	movq	%r14, 168(%rsp)
+	movq	%r14, %rbp
+	movq	%rax, 184(%rsp)
+.L385:
+	leaq	184(%rsp), %r14
+	cmpq	$23, %rbp
+	je	.L392
+	movq	184(%rsp), %r14
+	jmp	.L392
+	.p2align 4,,10
+	.p2align 3
+.L398:
+	movb	%r13b, 184(%rsp,%rbx)
+	movq	160(%rsp), %rax
+	addq	$1, %rax
+	movq	%rax, 160(%rsp)
+	movb	$0, 184(%rsp,%rax)
+	testq	%r12, %r12
+	jne	.L399
+.L400:
+	movq	168(%rsp), %rbx
+	leaq	184(%rsp), %r12
+	cmpq	$23, %rbx
+	je	.L402
+	movq	184(%rsp), %r12
+.L402:
+	movq	8(%rsp), %r15
+	movq	$-1, %rsi
+	movq	%r15, %rdi
+	call	strnlen@PLT
+	movq	160(%rsp), %r13
+	movq	%rax, %rbp
+	leaq	(%rax,%r13), %r14
+	cmpq	%r12, %r15
+	jb	.L403
+	leaq	(%r12,%r13), %rax
+	cmpq	%rax, %r15
+	jnb	.L403
+	movq	%r15, %rax
+	subq	%r12, %rax
+	movq	%rax, (%rsp)
+	cmpq	%r14, %rbx
+	jnb	.L408
+	leaq	10(%rbx,%rbx), %rax
+	movq	176(%rsp), %r15
+	movl	$1, %edx
+	cmpq	%r14, %rax
+	cmovnb	%rax, %r14
+	movq	(%r15), %rax
+	movq	%r15, %rdi
+	leaq	1(%r14), %rsi
+	call	*16(%rax)
+	movq	%rax, 8(%rsp)
+	leaq	1(%r13), %rdx
+	cmpq	$23, %rbx
+	je	.L409
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	leaq	1(%rbx), %rdx
+	movq	%r15, %rdi
+	movq	184(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.LEHE25:
+.L410:
+	movq	8(%rsp), %rax
+	movq	%r14, 168(%rsp)
+	movq	%r14, %rbx
+	movq	%rax, 184(%rsp)
+.L408:
+	cmpq	$23, %rbx
+	je	.L523
+	movq	184(%rsp), %r14
+	movq	(%rsp), %rax
+	addq	%r14, %rax
+	movq	%rax, 8(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L412:
+	movq	8(%rsp), %rsi
+	movq	%rbp, %rdx
+	leaq	(%r14,%r13), %rdi
+	call	memmove@PLT
+	addq	160(%rsp), %rbp
+	movq	56(%rsp), %rax
+	movq	%rbp, 160(%rsp)
+	movb	$0, (%r14,%rbp)
+	movq	176(%rsp), %rbx
+	cmpq	%rax, %rbx
+	jne	.L524
+	cmpq	$32, 160(%rsp)
+	jne	.L496
+	movq	48(%rsp), %rax
+	movq	%rax, %fs:_ZN1n18__current_resourceE@tpoff
+	cmpl	$1, 72(%rsp)
+	jne	.L497
+	cmpq	$0, 48(%rsp)
+	je	.L525
+.L421:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L526
+.L426:
+	movq	48(%rsp), %rax
+	cmpq	_ZZN1n4heapEvE3res(%rip), %rax
+	jne	.L428
+	movq	128(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L432
+	.p2align 4,,10
+	.p2align 3
+.L429:
+	movq	120(%rsp), %rdi
+	movq	%rbx, %rsi
+	movl	$8, %ecx
+	movq	(%rbx), %rbx
+	movq	8(%rsi), %rdx
+	movq	(%rdi), %rax
+.LEHB26:
+	call	*24(%rax)
+.LEHE26:
+	movq	%rbx, 128(%rsp)
+	testq	%rbx, %rbx
+	jne	.L429
+.L432:
+	pxor	%xmm0, %xmm0
+	cmpl	$1, 76(%rsp)
+	movups	%xmm0, 136(%rsp)
+	jne	.L527
+	addq	$216, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L403:
+	.cfi_restore_state
+	cmpq	%r14, %rbx
+	jnb	.L405
+	leaq	10(%rbx,%rbx), %rax
+	movq	176(%rsp), %r15
+	movl	$1, %edx
+	cmpq	%r14, %rax
+	cmovnb	%rax, %r14
+	movq	(%r15), %rax
+	movq	%r15, %rdi
+	leaq	1(%r14), %rsi
+.LEHB27:
+	call	*16(%rax)
+	movq	%rax, (%rsp)
+	leaq	1(%r13), %rdx
+	cmpq	$23, %rbx
+	je	.L406
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	leaq	1(%rbx), %rdx
+	movq	%r15, %rdi
+	movq	184(%rsp), %rsi
+	movl	$1, %ecx
+	call	*24(%rax)
+.L407:
+	movq	(%rsp), %rax
+	movq	%r14, 168(%rsp)
+	movq	%r14, %rbx
+	movq	%rax, 184(%rsp)
+.L405:
+	leaq	184(%rsp), %r14
+	cmpq	$23, %rbx
+	je	.L412
+	movq	184(%rsp), %r14
+	jmp	.L412
+	.p2align 4,,10
+	.p2align 3
+.L522:
+	leaq	1(%rbx), %r14
+	cmpq	%r14, %rbx
+	jnb	.L395
+	leaq	10(%rbx,%rbx), %rax
+	movq	176(%rsp), %r15
+	movl	$1, %edx
+	cmpq	%r14, %rax
+	cmovb	%r14, %rax
+	movq	%r15, %rdi
+	movq	%rax, 24(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	%rax, 16(%rsp)
+	cmpq	$23, %rbp
+	je	.L396
+	movq	184(%rsp), %rsi
+	movq	%r14, %rdx
+	movq	%rax, %rdi
+	movq	%rsi, 32(%rsp)
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	movq	32(%rsp), %rsi
+	movq	%r15, %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	call	*24(%rax)
+.LEHE27:
+.L397:
+	movq	16(%rsp), %rax
+	movq	%rax, 184(%rsp)
+	movq	24(%rsp), %rax
+	movq	%rax, 168(%rsp)
+	movq	%rax, %rbp
+	jmp	.L395
+	.p2align 4,,10
+	.p2align 3
+.L513:
+	movq	8(%rsp), %r12
+	leaq	184(%rsp), %rdi
+	addq	%rdi, %r12
+	jmp	.L318
+	.p2align 4,,10
+	.p2align 3
+.L519:
+	movq	24(%rsp), %r13
+	leaq	184(%rsp), %rdi
+	addq	%rdi, %r13
+	jmp	.L375
+	.p2align 4,,10
+	.p2align 3
+.L315:
+	movq	%rax, %rdi
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L316
+	.p2align 4,,10
+	.p2align 3
+.L372:
+	movq	%rax, %rdi
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L373
+	.p2align 4,,10
+	.p2align 3
+.L379:
+	movq	16(%rsp), %rax
+	addq	%rbx, %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L364
+	.p2align 4,,10
+	.p2align 3
+.L322:
+	movq	32(%rsp), %rax
+	leaq	(%rax,%rbx), %rbp
+	jmp	.L307
+	.p2align 4,,10
+	.p2align 3
+.L301:
+	leaq	0(%rbp,%rbx), %rax
+	movq	%rax, 32(%rsp)
+	cmpq	$23, %rbx
+	ja	.L528
+.L438:
+	leaq	184(%rsp), %rcx
+	jmp	.L304
+	.p2align 4,,10
+	.p2align 3
+.L339:
+	leaq	184(%rsp), %rdi
+	movq	%r15, %rdx
+	movq	%rdi, %rsi
+	movq	8(%rsp), %rdi
+	call	memcpy@PLT
+	jmp	.L340
+	.p2align 4,,10
+	.p2align 3
+.L396:
+	movq	%rax, %rdi
+	leaq	184(%rsp), %rsi
+	movq	%r14, %rdx
+	call	memcpy@PLT
+	jmp	.L397
+	.p2align 4,,10
+	.p2align 3
+.L526:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L426
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L426
+.L523:
+	movq	(%rsp), %rax
+	leaq	184(%rsp), %r14
+	addq	%r14, %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L412
+.L518:
+	movq	8(%rsp), %rbp
+	leaq	184(%rsp), %r14
+	addq	%r14, %rbp
+	jmp	.L360
+.L521:
+	movq	16(%rsp), %rax
+	leaq	184(%rsp), %r14
+	addq	%r14, %rax
+	movq	%rax, 16(%rsp)
+	jmp	.L392
+.L516:
+	movq	(%rsp), %rax
+	leaq	184(%rsp), %r14
+	addq	%r14, %rax
+	movq	%rax, 32(%rsp)
+	jmp	.L335
+	.p2align 4,,10
+	.p2align 3
+.L347:
+	leaq	0(%rbp,%rbx), %rax
+	movq	%rax, 16(%rsp)
+	jmp	.L346
+	.p2align 4,,10
+	.p2align 3
+.L525:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L529
+.L423:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	%rax, 48(%rsp)
+	jmp	.L421
+	.p2align 4,,10
+	.p2align 3
+.L386:
+	movq	%rax, %rdi
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L387
+	.p2align 4,,10
+	.p2align 3
+.L329:
+	movq	%rax, %rdi
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L330
+	.p2align 4,,10
+	.p2align 3
+.L354:
+	movq	%rax, %rdi
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L355
+	.p2align 4,,10
+	.p2align 3
+.L406:
+	movq	%rax, %rdi
+	movq	%r12, %rsi
+	call	memcpy@PLT
+	jmp	.L407
+.L529:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L423
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L423
+.L332:
+	movq	%rax, %rdi
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L333
+.L389:
+	movq	%rax, %rdi
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L390
+.L409:
+	movq	%rax, %rdi
+	movq	%r12, %rsi
+	call	memcpy@PLT
+	jmp	.L410
+.L357:
+	movq	%rax, %rdi
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L358
+.L527:
+	jmp	.L430
+.L453:
+	movq	%rax, %rbx
+	jmp	.L416
+.L494:
+	jmp	.L495
+.L524:
+	jmp	.L414
+	.section	.gcc_except_table
+.LLSDA6786:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6786-.LLSDACSB6786
+.LLSDACSB6786:
+	.uleb128 .LEHB25-.LFB6786
+	.uleb128 .LEHE25-.LEHB25
+	.uleb128 .L453-.LFB6786
+	.uleb128 0
+	.uleb128 .LEHB26-.LFB6786
+	.uleb128 .LEHE26-.LEHB26
+	.uleb128 .L494-.LFB6786
+	.uleb128 0
+	.uleb128 .LEHB27-.LFB6786
+	.uleb128 .LEHE27-.LEHB27
+	.uleb128 .L453-.LFB6786
+	.uleb128 0
+.LLSDACSE6786:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6786
+	.type	_Z29test_scoped_format_uses_arenav.cold, @function
+_Z29test_scoped_format_uses_arenav.cold:
+.LFSB6786:
+.L497:
+	.cfi_def_cfa_offset 272
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC23(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB28:
+	call	__cxa_throw@PLT
+.LEHE28:
+.L496:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC22(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB29:
+	call	__cxa_throw@PLT
+.LEHE29:
+.L452:
+.L495:
+	movq	%rax, %rbx
+.L435:
+	leaq	16+_ZTVN1n14arena_resourceE(%rip), %rax
+	movq	%rax, 112(%rsp)
+.L436:
+	movq	128(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L530
+	movq	120(%rsp), %rdi
+	movq	(%rsi), %rbp
+	movl	$8, %ecx
+	movq	8(%rsi), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	%rbp, 128(%rsp)
+	jmp	.L436
+.L451:
+	movq	%rax, %rbp
+	movq	168(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L434
+	leaq	1(%rax), %rdx
+	movq	(%rbx), %rax
+	movl	$1, %ecx
+	movq	%rbx, %rdi
+	movq	184(%rsp), %rsi
+	call	*24(%rax)
+.L434:
+	movq	%rbp, %rbx
+.L418:
+	movq	48(%rsp), %rax
+	movq	%rax, %fs:_ZN1n18__current_resourceE@tpoff
+	jmp	.L435
+.L430:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC25(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB30:
+	call	__cxa_throw@PLT
+.LEHE30:
+.L416:
+	movq	168(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L418
+	movq	176(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	184(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L418
+.L428:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC24(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB31:
+	call	__cxa_throw@PLT
+.LEHE31:
+.L530:
+	movq	%rbx, %rdi
+.LEHB32:
+	call	_Unwind_Resume@PLT
+.LEHE32:
+.L414:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC21(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB33:
+	call	__cxa_throw@PLT
+.LEHE33:
+	.cfi_endproc
+.LFE6786:
+	.section	.gcc_except_table
+.LLSDAC6786:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6786-.LLSDACSBC6786
+.LLSDACSBC6786:
+	.uleb128 .LEHB28-.LCOLDB29
+	.uleb128 .LEHE28-.LEHB28
+	.uleb128 .L452-.LCOLDB29
+	.uleb128 0
+	.uleb128 .LEHB29-.LCOLDB29
+	.uleb128 .LEHE29-.LEHB29
+	.uleb128 .L451-.LCOLDB29
+	.uleb128 0
+	.uleb128 .LEHB30-.LCOLDB29
+	.uleb128 .LEHE30-.LEHB30
+	.uleb128 .L452-.LCOLDB29
+	.uleb128 0
+	.uleb128 .LEHB31-.LCOLDB29
+	.uleb128 .LEHE31-.LEHB31
+	.uleb128 .L452-.LCOLDB29
+	.uleb128 0
+	.uleb128 .LEHB32-.LCOLDB29
+	.uleb128 .LEHE32-.LEHB32
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB33-.LCOLDB29
+	.uleb128 .LEHE33-.LEHB33
+	.uleb128 .L451-.LCOLDB29
+	.uleb128 0
+.LLSDACSEC6786:
+	.section	.text.unlikely
+	.text
+	.size	_Z29test_scoped_format_uses_arenav, .-_Z29test_scoped_format_uses_arenav
+	.section	.text.unlikely
+	.size	_Z29test_scoped_format_uses_arenav.cold, .-_Z29test_scoped_format_uses_arenav.cold
+.LCOLDE29:
+	.text
+.LHOTE29:
+	.section	.rodata._ZN1n4test10test_suite7run_allEv.str1.1,"aMS",@progbits,1
+.LC30:
+	.string	"\nSUITE [%s] "
+.LC32:
+	.string	"%s"
+.LC33:
+	.string	"\nTEST [%s] "
+.LC34:
+	.string	" - Result : \033[1;32mPASSED\033[0m"
+.LC35:
+	.string	"\033[1;31merror : %s\033[0m\n"
+.LC36:
+	.string	" - Result : \033[1;31mFAILED\033[0m"
+.LC37:
+	.string	" - Passed : \033[1;32m%d\033[0m\n"
+.LC38:
+	.string	" - Failed : \033[1;31m%d\033[0m\n"
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4test10test_suite7run_allEv
+	.type	_ZN1n4test10test_suite7run_allEv, @function
+_ZN1n4test10test_suite7run_allEv:
+.LFB6762:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6762
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	leaq	.LC30(%rip), %rdx
+	movl	$79, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	16(%rdi), %rcx
+	leaq	16(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L532
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L533
+	testb	$4, %cl
+	jne	.L586
+	testl	%ecx, %ecx
+	je	.L532
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L587
+	.p2align 4,,10
+	.p2align 3
+.L532:
+	movzwl	.LC31(%rip), %r15d
+	movq	%rbx, %rsi
+	leaq	.LC32(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+.LEHB34:
+	call	printf@PLT
+	movl	8(%r12), %esi
+	testl	%esi, %esi
+	jle	.L553
+	movl	$0, 12(%rsp)
+	xorl	%ebp, %ebp
+	xorl	%r14d, %r14d
+	jmp	.L547
+	.p2align 4,,10
+	.p2align 3
+.L590:
+	testb	$4, %dl
+	jne	.L588
+	testl	%edx, %edx
+	je	.L538
+	movb	$42, (%rax)
+	testb	$2, %dl
+	jne	.L589
+	.p2align 4,,10
+	.p2align 3
+.L538:
+	movq	%rbx, %rsi
+	leaq	.LC32(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+.LEHE34:
+	movq	(%r12), %rax
+.LEHB35:
+	call	*8(%rax,%r13)
+.LEHE35:
+	leaq	.LC34(%rip), %rdi
+	addl	$1, %r14d
+.LEHB36:
+	call	puts@PLT
+.L543:
+	addq	$1, %rbp
+	cmpl	%ebp, 8(%r12)
+	jle	.L537
+.L547:
+	movq	(%r12), %rax
+	movq	%rbp, %r13
+	movq	%rbx, %rdi
+	movl	$79, %esi
+	salq	$4, %r13
+	leaq	.LC33(%rip), %rdx
+	movq	(%rax,%r13), %rcx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L538
+	movl	$79, %edx
+	subl	%eax, %edx
+	addq	%rbx, %rax
+	cmpl	$8, %edx
+	jb	.L590
+	movabsq	$3038287259199220266, %rsi
+	leaq	8(%rax), %rdi
+	movl	%edx, %ecx
+	andq	$-8, %rdi
+	movq	%rsi, (%rax)
+	movq	%rsi, -8(%rax,%rcx)
+	subq	%rdi, %rax
+	leal	(%rdx,%rax), %ecx
+	movq	%rsi, %rax
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L538
+.L553:
+	movl	$0, 12(%rsp)
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L537:
+	movabsq	$5917806138674729738, %rax
+	movq	%rbx, %rdi
+	movq	%rax, 16(%rsp)
+	movabsq	$9095440486453792, %rax
+	movq	%rax, 22(%rsp)
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L548
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L549
+	testb	$4, %cl
+	jne	.L591
+	testl	%ecx, %ecx
+	je	.L548
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L592
+.L548:
+	movq	%rbx, %rsi
+	leaq	.LC32(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+	movl	%r14d, %esi
+	leaq	.LC37(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	12(%rsp), %esi
+	leaq	.LC38(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	$10, %edi
+	call	putchar@PLT
+.LEHE36:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L549:
+	.cfi_restore_state
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L548
+.L533:
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L532
+.L588:
+	movl	$707406378, (%rax)
+	movl	$707406378, -4(%rax,%rdx)
+	jmp	.L538
+.L589:
+	movl	$10794, %ecx
+	movw	%cx, -2(%rax,%rdx)
+	jmp	.L538
+.L587:
+	movl	$10794, %edi
+	movw	%di, -2(%rdx,%rcx)
+	jmp	.L532
+.L592:
+	movl	$10794, %eax
+	movw	%ax, -2(%rdx,%rcx)
+	jmp	.L548
+.L586:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L532
+.L591:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L548
+.L554:
+	movq	%rax, %rdi
+	movq	%rdx, %rax
+.L544:
+	subq	$1, %rax
+	jne	.L585
+	call	__cxa_begin_catch@PLT
+	leaq	.LC35(%rip), %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+.LEHB37:
+	call	printf@PLT
+.LEHE37:
+	call	__cxa_end_catch@PLT
+	leaq	.LC36(%rip), %rdi
+	addl	$1, 12(%rsp)
+.LEHB38:
+	call	puts@PLT
+	jmp	.L543
+.L546:
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+.L585:
+	call	_Unwind_Resume@PLT
+.LEHE38:
+.L555:
+	movq	%rax, %rbx
+	jmp	.L546
+	.cfi_endproc
+.LFE6762:
+	.section	.gcc_except_table
+	.align 4
+.LLSDA6762:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT6762-.LLSDATTD6762
+.LLSDATTD6762:
+	.byte	0x1
+	.uleb128 .LLSDACSE6762-.LLSDACSB6762
+.LLSDACSB6762:
+	.uleb128 .LEHB34-.LFB6762
+	.uleb128 .LEHE34-.LEHB34
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB35-.LFB6762
+	.uleb128 .LEHE35-.LEHB35
+	.uleb128 .L554-.LFB6762
+	.uleb128 0x1
+	.uleb128 .LEHB36-.LFB6762
+	.uleb128 .LEHE36-.LEHB36
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB37-.LFB6762
+	.uleb128 .LEHE37-.LEHB37
+	.uleb128 .L555-.LFB6762
+	.uleb128 0
+	.uleb128 .LEHB38-.LFB6762
+	.uleb128 .LEHE38-.LEHB38
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6762:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	DW.ref._ZTIPKc-.
+.LLSDATT6762:
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.size	_ZN1n4test10test_suite7run_allEv, .-_ZN1n4test10test_suite7run_allEv
+	.section	.rodata.str1.1
+.LC39:
+	.string	"n::memory tests"
+.LC40:
+	.string	"test_arena_alignment"
+.LC41:
+	.string	"test_heap_over_alignment"
+	.section	.rodata.str1.8
+	.align 8
+.LC42:
+	.string	"test_arena_release_in_one_step"
+	.section	.rodata.str1.1
+.LC43:
+	.string	"test_arena_caller_buffer"
+.LC44:
+	.string	"test_pool_recycles_blocks"
+.LC45:
+	.string	"test_vector_explicit_resource"
+.LC46:
+	.string	"test_scoped_format_uses_arena"
+	.section	.text.unlikely
+.LCOLDB48:
+	.section	.text.startup,"ax",@progbits
+.LHOTB48:
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB6797:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6797
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$1600, %edi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 64
+.LEHB39:
+	call	_Znam@PLT
+.LEHE39:
+	movq	%rax, %rbx
+	leaq	1600(%rax), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L594:
+	movq	$0, (%rax)
+	addq	$16, %rax
+	movq	$0, -8(%rax)
+	cmpq	%rax, %rdx
+	jne	.L594
+	leaq	.LC39(%rip), %rax
+	movq	%rsp, %rdi
+	movq	%rbx, (%rsp)
+	movq	%rax, 16(%rsp)
+	leaq	.LC40(%rip), %rax
+	movq	%rax, (%rbx)
+	leaq	_Z20test_arena_alignmentv(%rip), %rax
+	movq	%rax, 8(%rbx)
+	leaq	.LC41(%rip), %rax
+	movq	%rax, 16(%rbx)
+	leaq	_Z24test_heap_over_alignmentv(%rip), %rax
+	movq	%rax, 24(%rbx)
+	leaq	.LC42(%rip), %rax
+	movq	%rax, 32(%rbx)
+	leaq	_Z30test_arena_release_in_one_stepv(%rip), %rax
+	movq	%rax, 40(%rbx)
+	leaq	.LC43(%rip), %rax
+	movq	%rax, 48(%rbx)
+	leaq	_Z24test_arena_caller_bufferv(%rip), %rax
+	movq	%rax, 56(%rbx)
+	leaq	.LC44(%rip), %rax
+	movq	%rax, 64(%rbx)
+	leaq	_Z25test_pool_recycles_blocksv(%rip), %rax
+	movq	%rax, 72(%rbx)
+	leaq	.LC45(%rip), %rax
+	movq	%rax, 80(%rbx)
+	leaq	_Z29test_vector_explicit_resourcev(%rip), %rax
+	movq	%rax, 88(%rbx)
+	leaq	.LC46(%rip), %rax
+	movq	%rax, 96(%rbx)
+	leaq	_Z29test_scoped_format_uses_arenav(%rip), %rax
+	movq	%rax, 104(%rbx)
+	movq	.LC47(%rip), %rax
+	movq	%rax, 8(%rsp)
+.LEHB40:
+	call	_ZN1n4test10test_suite7run_allEv
+.LEHE40:
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L596:
+	.cfi_restore_state
+	movq	%rax, %rbp
+	jmp	.L595
+	.section	.gcc_except_table
+.LLSDA6797:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6797-.LLSDACSB6797
+.LLSDACSB6797:
+	.uleb128 .LEHB39-.LFB6797
+	.uleb128 .LEHE39-.LEHB39
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB40-.LFB6797
+	.uleb128 .LEHE40-.LEHB40
+	.uleb128 .L596-.LFB6797
+	.uleb128 0
+.LLSDACSE6797:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6797
+	.type	main.cold, @function
+main.cold:
+.LFSB6797:
+.L595:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	movq	%rbp, %rdi
+.LEHB41:
+	call	_Unwind_Resume@PLT
+.LEHE41:
+	.cfi_endproc
+.LFE6797:
+	.section	.gcc_except_table
+.LLSDAC6797:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6797-.LLSDACSBC6797
+.LLSDACSBC6797:
+	.uleb128 .LEHB41-.LCOLDB48
+	.uleb128 .LEHE41-.LEHB41
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6797:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	main, .-main
+	.section	.text.unlikely
+	.size	main.cold, .-main.cold
+.LCOLDE48:
+	.section	.text.startup
+.LHOTE48:
+	.weak	_ZTSN1n15memory_resourceE
+	.section	.rodata._ZTSN1n15memory_resourceE,"aG",@progbits,_ZTSN1n15memory_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n15memory_resourceE, @object
+	.size	_ZTSN1n15memory_resourceE, 22
+_ZTSN1n15memory_resourceE:
+	.string	"N1n15memory_resourceE"
+	.weak	_ZTIN1n15memory_resourceE
+	.section	.data.rel.ro._ZTIN1n15memory_resourceE,"awG",@progbits,_ZTIN1n15memory_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n15memory_resourceE, @object
+	.size	_ZTIN1n15memory_resourceE, 16
+_ZTIN1n15memory_resourceE:
+	.quad	_ZTVN10__cxxabiv117__class_type_infoE+16
+	.quad	_ZTSN1n15memory_resourceE
+	.weak	_ZTSN1n13heap_resourceE
+	.section	.rodata._ZTSN1n13heap_resourceE,"aG",@progbits,_ZTSN1n13heap_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n13heap_resourceE, @object
+	.size	_ZTSN1n13heap_resourceE, 20
+_ZTSN1n13heap_resourceE:
+	.string	"N1n13heap_resourceE"
+	.weak	_ZTIN1n13heap_resourceE
+	.section	.data.rel.ro._ZTIN1n13heap_resourceE,"awG",@progbits,_ZTIN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n13heap_resourceE, @object
+	.size	_ZTIN1n13heap_resourceE, 24
+_ZTIN1n13heap_resourceE:
+	.quad	_ZTVN10__cxxabiv120__si_class_type_infoE+16
+	.quad	_ZTSN1n13heap_resourceE
+	.quad	_ZTIN1n15memory_resourceE
+	.weak	_ZTSN1n14arena_resourceE
+	.section	.rodata._ZTSN1n14arena_resourceE,"aG",@progbits,_ZTSN1n14arena_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n14arena_resourceE, @object
+	.size	_ZTSN1n14arena_resourceE, 21
+_ZTSN1n14arena_resourceE:
+	.string	"N1n14arena_resourceE"
+	.weak	_ZTIN1n14arena_resourceE
+	.section	.data.rel.ro._ZTIN1n14arena_resourceE,"awG",@progbits,_ZTIN1n14arena_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n14arena_resourceE, @object
+	.size	_ZTIN1n14arena_resourceE, 24
+_ZTIN1n14arena_resourceE:
+	.quad	_ZTVN10__cxxabiv120__si_class_type_infoE+16
+	.quad	_ZTSN1n14arena_resourceE
+	.quad	_ZTIN1n15memory_resourceE
+	.weak	_ZTSN1n13pool_resourceE
+	.section	.rodata._ZTSN1n13pool_resourceE,"aG",@progbits,_ZTSN1n13pool_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n13pool_resourceE, @object
+	.size	_ZTSN1n13pool_resourceE, 20
+_ZTSN1n13pool_resourceE:
+	.string	"N1n13pool_resourceE"
+	.weak	_ZTIN1n13pool_resourceE
+	.section	.data.rel.ro._ZTIN1n13pool_resourceE,"awG",@progbits,_ZTIN1n13pool_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n13pool_resourceE, @object
+	.size	_ZTIN1n13pool_resourceE, 24
+_ZTIN1n13pool_resourceE:
+	.quad	_ZTVN10__cxxabiv120__si_class_type_infoE+16
+	.quad	_ZTSN1n13pool_resourceE
+	.quad	_ZTIN1n15memory_resourceE
+	.weak	_ZTS17counting_resource
+	.section	.rodata._ZTS17counting_resource,"aG",@progbits,_ZTS17counting_resource,comdat
+	.align 16
+	.type	_ZTS17counting_resource, @object
+	.size	_ZTS17counting_resource, 20
+_ZTS17counting_resource:
+	.string	"17counting_resource"
+	.weak	_ZTI17counting_resource
+	.section	.data.rel.ro._ZTI17counting_resource,"awG",@progbits,_ZTI17counting_resource,comdat
+	.align 8
+	.type	_ZTI17counting_resource, @object
+	.size	_ZTI17counting_resource, 24
+_ZTI17counting_resource:
+	.quad	_ZTVN10__cxxabiv120__si_class_type_infoE+16
+	.quad	_ZTS17counting_resource
+	.quad	_ZTIN1n15memory_resourceE
+	.weak	_ZTVN1n13heap_resourceE
+	.section	.data.rel.ro.local._ZTVN1n13heap_resourceE,"awG",@progbits,_ZTVN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTVN1n13heap_resourceE, @object
+	.size	_ZTVN1n13heap_resourceE, 48
+_ZTVN1n13heap_resourceE:
+	.quad	0
+	.quad	_ZTIN1n13heap_resourceE
+	.quad	_ZN1n13heap_resourceD1Ev
+	.quad	_ZN1n13heap_resourceD0Ev
+	.quad	_ZN1n13heap_resource8allocateEmm
+	.quad	_ZN1n13heap_resource10deallocateEPvmm
+	.weak	_ZTVN1n14arena_resourceE
+	.section	.data.rel.ro.local._ZTVN1n14arena_resourceE,"awG",@progbits,_ZTVN1n14arena_resourceE,comdat
+	.align 8
+	.type	_ZTVN1n14arena_resourceE, @object
+	.size	_ZTVN1n14arena_resourceE, 48
+_ZTVN1n14arena_resourceE:
+	.quad	0
+	.quad	_ZTIN1n14arena_resourceE
+	.quad	_ZN1n14arena_resourceD1Ev
+	.quad	_ZN1n14arena_resourceD0Ev
+	.quad	_ZN1n14arena_resource8allocateEmm
+	.quad	_ZN1n14arena_resource10deallocateEPvmm
+	.weak	_ZTVN1n13pool_resourceE
+	.section	.data.rel.ro.local._ZTVN1n13pool_resourceE,"awG",@progbits,_ZTVN1n13pool_resourceE,comdat
+	.align 8
+	.type	_ZTVN1n13pool_resourceE, @object
+	.size	_ZTVN1n13pool_resourceE, 48
+_ZTVN1n13pool_resourceE:
+	.quad	0
+	.quad	_ZTIN1n13pool_resourceE
+	.quad	_ZN1n13pool_resourceD1Ev
+	.quad	_ZN1n13pool_resourceD0Ev
+	.quad	_ZN1n13pool_resource8allocateEmm
+	.quad	_ZN1n13pool_resource10deallocateEPvmm
+	.weak	_ZTV17counting_resource
+	.section	.data.rel.ro.local._ZTV17counting_resource,"awG",@progbits,_ZTV17counting_resource,comdat
+	.align 8
+	.type	_ZTV17counting_resource, @object
+	.size	_ZTV17counting_resource, 48
+_ZTV17counting_resource:
+	.quad	0
+	.quad	_ZTI17counting_resource
+	.quad	_ZN17counting_resourceD1Ev
+	.quad	_ZN17counting_resourceD0Ev
+	.quad	_ZN17counting_resource8allocateEmm
+	.quad	_ZN17counting_resource10deallocateEPvmm
+	.weak	_ZN1n18__current_resourceE
+	.section	.tbss._ZN1n18__current_resourceE,"awTG",@nobits,_ZN1n18__current_resourceE,comdat
+	.align 8
+	.type	_ZN1n18__current_resourceE, @gnu_unique_object
+	.size	_ZN1n18__current_resourceE, 8
+_ZN1n18__current_resourceE:
+	.zero	8
+	.weak	_ZGVZN1n4heapEvE3res
+	.section	.bss._ZGVZN1n4heapEvE3res,"awG",@nobits,_ZGVZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZGVZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZGVZN1n4heapEvE3res, 8
+_ZGVZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE3res
+	.section	.bss._ZZN1n4heapEvE3res,"awG",@nobits,_ZZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZZN1n4heapEvE3res, 8
+_ZZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE7storage
+	.section	.bss._ZZN1n4heapEvE7storage,"awG",@nobits,_ZZN1n4heapEvE7storage,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE7storage, @gnu_unique_object
+	.size	_ZZN1n4heapEvE7storage, 8
+_ZZN1n4heapEvE7storage:
+	.zero	8
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC17:
+	.quad	0
+	.quad	23
+	.section	.rodata.cst2,"aM",@progbits,2
+	.align 2
+.LC19:
+	.byte	48
+	.byte	51
+	.align 2
+.LC20:
+	.byte	49
+	.byte	51
+	.section	.data.rel.ro.local,"aw"
+	.align 8
+.LC28:
+	.quad	_ZTVN1n14arena_resourceE+16
+	.section	.rodata.cst2
+	.align 2
+.LC31:
+	.byte	10
+	.byte	0
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC47:
+	.long	7
+	.long	100
+	.hidden	DW.ref._ZTIPKc
+	.weak	DW.ref._ZTIPKc
+	.section	.data.rel.local.DW.ref._ZTIPKc,"awG",@progbits,DW.ref._ZTIPKc,comdat
+	.align 8
+	.type	DW.ref._ZTIPKc, @object
+	.size	DW.ref._ZTIPKc, 8
+DW.ref._ZTIPKc:
+	.quad	_ZTIPKc
+	.hidden	DW.ref.__gxx_personality_v0
+	.weak	DW.ref.__gxx_personality_v0
+	.section	.data.rel.local.DW.ref.__gxx_personality_v0,"awG",@progbits,DW.ref.__gxx_personality_v0,comdat
+	.align 8
+	.type	DW.ref.__gxx_personality_v0, @object
+	.size	DW.ref.__gxx_personality_v0, 8
+DW.ref.__gxx_personality_v0:
+	.quad	__gxx_personality_v0
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
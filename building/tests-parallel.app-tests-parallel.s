@@ -0,0 +1,18518 @@
+	.file	"tests-parallel.cpp"
+	.text
+	.p2align 4
+	.type	_ZN1n4taskUlPvS1_E3_4_FUNES1_S1_, @function
+_ZN1n4taskUlPvS1_E3_4_FUNES1_S1_:
+.LFB7222:
+	.cfi_startproc
+	movdqu	(%rdi), %xmm0
+	movups	%xmm0, (%rsi)
+	ret
+	.cfi_endproc
+.LFE7222:
+	.size	_ZN1n4taskUlPvS1_E3_4_FUNES1_S1_, .-_ZN1n4taskUlPvS1_E3_4_FUNES1_S1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvPNS_15memory_resourceEE4_4_FUNES1_S3_, @function
+_ZN1n4taskUlPvPNS_15memory_resourceEE4_4_FUNES1_S3_:
+.LFB7225:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7225:
+	.size	_ZN1n4taskUlPvPNS_15memory_resourceEE4_4_FUNES1_S3_, .-_ZN1n4taskUlPvPNS_15memory_resourceEE4_4_FUNES1_S3_
+	.p2align 4
+	.type	_ZN1n4taskUlPvE5_4_FUNES1_, @function
+_ZN1n4taskUlPvE5_4_FUNES1_:
+.LFB7235:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	(%rdi), %r8
+	xorl	%edx, %edx
+	movq	8(%rdi), %rdi
+	movq	(%r8), %rax
+	movq	8(%r8), %rbx
+	movq	%rdi, %r9
+	leaq	1(%rdi), %rsi
+	movq	(%rax), %rax
+	divq	(%rbx)
+	imulq	%rax, %r9
+	movq	%rdx, %rcx
+	cmpq	%rdx, %rdi
+	cmovbe	%rdi, %rcx
+	addq	%r9, %rcx
+	cmpq	%rdx, %rsi
+	cmovbe	%rsi, %rdx
+	addq	%r9, %rax
+	leaq	1(%rcx), %rsi
+	addq	%rax, %rdx
+	movq	16(%r8), %rax
+	movq	(%rax), %r10
+	movslq	(%r10,%rcx,4), %r9
+	cmpq	%rdx, %rsi
+	jnb	.L5
+	movq	%rdx, %rax
+	subq	%rcx, %rax
+	leaq	-1(%rax), %r11
+	subq	$2, %rax
+	cmpq	$2, %rax
+	jbe	.L6
+	leaq	0(,%rcx,4), %rbx
+	movq	%r11, %rcx
+	pxor	%xmm1, %xmm1
+	shrq	$2, %rcx
+	leaq	4(%r10,%rbx), %rax
+	pxor	%xmm4, %xmm4
+	salq	$4, %rcx
+	addq	%rax, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	movdqu	(%rax), %xmm0
+	movdqa	%xmm4, %xmm2
+	addq	$16, %rax
+	pcmpgtd	%xmm0, %xmm2
+	movdqa	%xmm0, %xmm3
+	punpckldq	%xmm2, %xmm3
+	punpckhdq	%xmm2, %xmm0
+	paddq	%xmm3, %xmm1
+	paddq	%xmm0, %xmm1
+	cmpq	%rcx, %rax
+	jne	.L7
+	movdqa	%xmm1, %xmm0
+	psrldq	$8, %xmm0
+	paddq	%xmm0, %xmm1
+	movq	%xmm1, %rax
+	addq	%rax, %r9
+	movq	%r11, %rax
+	andq	$-4, %rax
+	addq	%rax, %rsi
+	andl	$3, %r11d
+	je	.L5
+.L6:
+	movslq	(%r10,%rsi,4), %rcx
+	leaq	0(,%rsi,4), %rax
+	addq	%rcx, %r9
+	leaq	1(%rsi), %rcx
+	cmpq	%rdx, %rcx
+	jnb	.L5
+	movslq	4(%r10,%rax), %rcx
+	addq	$2, %rsi
+	addq	%rcx, %r9
+	cmpq	%rdx, %rsi
+	jnb	.L5
+	movslq	8(%r10,%rax), %rax
+	addq	%rax, %r9
+.L5:
+	movq	32(%r8), %rax
+	movq	(%rax), %rax
+	movq	%r9, (%rax,%rdi,8)
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE7235:
+	.size	_ZN1n4taskUlPvE5_4_FUNES1_, .-_ZN1n4taskUlPvE5_4_FUNES1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvS1_E6_4_FUNES1_S1_, @function
+_ZN1n4taskUlPvS1_E6_4_FUNES1_S1_:
+.LFB7238:
+	.cfi_startproc
+	movdqu	(%rdi), %xmm0
+	movups	%xmm0, (%rsi)
+	ret
+	.cfi_endproc
+.LFE7238:
+	.size	_ZN1n4taskUlPvS1_E6_4_FUNES1_S1_, .-_ZN1n4taskUlPvS1_E6_4_FUNES1_S1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvPNS_15memory_resourceEE7_4_FUNES1_S3_, @function
+_ZN1n4taskUlPvPNS_15memory_resourceEE7_4_FUNES1_S3_:
+.LFB7241:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7241:
+	.size	_ZN1n4taskUlPvPNS_15memory_resourceEE7_4_FUNES1_S3_, .-_ZN1n4taskUlPvPNS_15memory_resourceEE7_4_FUNES1_S3_
+	.p2align 4
+	.type	_ZN1n4taskUlPvS1_E9_4_FUNES1_S1_, @function
+_ZN1n4taskUlPvS1_E9_4_FUNES1_S1_:
+.LFB7255:
+	.cfi_startproc
+	movdqu	(%rdi), %xmm0
+	movups	%xmm0, (%rsi)
+	ret
+	.cfi_endproc
+.LFE7255:
+	.size	_ZN1n4taskUlPvS1_E9_4_FUNES1_S1_, .-_ZN1n4taskUlPvS1_E9_4_FUNES1_S1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvPNS_15memory_resourceEE10_4_FUNES1_S3_, @function
+_ZN1n4taskUlPvPNS_15memory_resourceEE10_4_FUNES1_S3_:
+.LFB7258:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7258:
+	.size	_ZN1n4taskUlPvPNS_15memory_resourceEE10_4_FUNES1_S3_, .-_ZN1n4taskUlPvPNS_15memory_resourceEE10_4_FUNES1_S3_
+	.p2align 4
+	.type	_ZN1n4taskUlPvS1_E12_4_FUNES1_S1_, @function
+_ZN1n4taskUlPvS1_E12_4_FUNES1_S1_:
+.LFB7268:
+	.cfi_startproc
+	movdqu	(%rdi), %xmm0
+	movups	%xmm0, (%rsi)
+	ret
+	.cfi_endproc
+.LFE7268:
+	.size	_ZN1n4taskUlPvS1_E12_4_FUNES1_S1_, .-_ZN1n4taskUlPvS1_E12_4_FUNES1_S1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvPNS_15memory_resourceEE13_4_FUNES1_S3_, @function
+_ZN1n4taskUlPvPNS_15memory_resourceEE13_4_FUNES1_S3_:
+.LFB7271:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7271:
+	.size	_ZN1n4taskUlPvPNS_15memory_resourceEE13_4_FUNES1_S3_, .-_ZN1n4taskUlPvPNS_15memory_resourceEE13_4_FUNES1_S3_
+	.p2align 4
+	.type	_ZN1n4taskUlPvS1_E15_4_FUNES1_S1_, @function
+_ZN1n4taskUlPvS1_E15_4_FUNES1_S1_:
+.LFB7330:
+	.cfi_startproc
+	movdqu	(%rdi), %xmm0
+	movups	%xmm0, (%rsi)
+	ret
+	.cfi_endproc
+.LFE7330:
+	.size	_ZN1n4taskUlPvS1_E15_4_FUNES1_S1_, .-_ZN1n4taskUlPvS1_E15_4_FUNES1_S1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvPNS_15memory_resourceEE16_4_FUNES1_S3_, @function
+_ZN1n4taskUlPvPNS_15memory_resourceEE16_4_FUNES1_S3_:
+.LFB7333:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7333:
+	.size	_ZN1n4taskUlPvPNS_15memory_resourceEE16_4_FUNES1_S3_, .-_ZN1n4taskUlPvPNS_15memory_resourceEE16_4_FUNES1_S3_
+	.p2align 4
+	.type	_ZN1n4taskUlPvS1_E18_4_FUNES1_S1_, @function
+_ZN1n4taskUlPvS1_E18_4_FUNES1_S1_:
+.LFB7343:
+	.cfi_startproc
+	movdqu	(%rdi), %xmm0
+	movups	%xmm0, (%rsi)
+	ret
+	.cfi_endproc
+.LFE7343:
+	.size	_ZN1n4taskUlPvS1_E18_4_FUNES1_S1_, .-_ZN1n4taskUlPvS1_E18_4_FUNES1_S1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvPNS_15memory_resourceEE19_4_FUNES1_S3_, @function
+_ZN1n4taskUlPvPNS_15memory_resourceEE19_4_FUNES1_S3_:
+.LFB7346:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7346:
+	.size	_ZN1n4taskUlPvPNS_15memory_resourceEE19_4_FUNES1_S3_, .-_ZN1n4taskUlPvPNS_15memory_resourceEE19_4_FUNES1_S3_
+	.p2align 4
+	.type	_ZN1n4taskUlPvS1_E21_4_FUNES1_S1_, @function
+_ZN1n4taskUlPvS1_E21_4_FUNES1_S1_:
+.LFB7362:
+	.cfi_startproc
+	movdqu	(%rdi), %xmm0
+	movups	%xmm0, (%rsi)
+	ret
+	.cfi_endproc
+.LFE7362:
+	.size	_ZN1n4taskUlPvS1_E21_4_FUNES1_S1_, .-_ZN1n4taskUlPvS1_E21_4_FUNES1_S1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvPNS_15memory_resourceEE22_4_FUNES1_S3_, @function
+_ZN1n4taskUlPvPNS_15memory_resourceEE22_4_FUNES1_S3_:
+.LFB7365:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7365:
+	.size	_ZN1n4taskUlPvPNS_15memory_resourceEE22_4_FUNES1_S3_, .-_ZN1n4taskUlPvPNS_15memory_resourceEE22_4_FUNES1_S3_
+	.p2align 4
+	.type	_ZN1n4taskUlPvS1_E24_4_FUNES1_S1_, @function
+_ZN1n4taskUlPvS1_E24_4_FUNES1_S1_:
+.LFB7375:
+	.cfi_startproc
+	movdqu	(%rdi), %xmm0
+	movups	%xmm0, (%rsi)
+	ret
+	.cfi_endproc
+.LFE7375:
+	.size	_ZN1n4taskUlPvS1_E24_4_FUNES1_S1_, .-_ZN1n4taskUlPvS1_E24_4_FUNES1_S1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvPNS_15memory_resourceEE25_4_FUNES1_S3_, @function
+_ZN1n4taskUlPvPNS_15memory_resourceEE25_4_FUNES1_S3_:
+.LFB7378:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7378:
+	.size	_ZN1n4taskUlPvPNS_15memory_resourceEE25_4_FUNES1_S3_, .-_ZN1n4taskUlPvPNS_15memory_resourceEE25_4_FUNES1_S3_
+	.p2align 4
+	.type	_ZN1n4taskUlPvS1_E27_4_FUNES1_S1_, @function
+_ZN1n4taskUlPvS1_E27_4_FUNES1_S1_:
+.LFB7399:
+	.cfi_startproc
+	movdqu	(%rdi), %xmm0
+	movups	%xmm0, (%rsi)
+	ret
+	.cfi_endproc
+.LFE7399:
+	.size	_ZN1n4taskUlPvS1_E27_4_FUNES1_S1_, .-_ZN1n4taskUlPvS1_E27_4_FUNES1_S1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvPNS_15memory_resourceEE28_4_FUNES1_S3_, @function
+_ZN1n4taskUlPvPNS_15memory_resourceEE28_4_FUNES1_S3_:
+.LFB7402:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7402:
+	.size	_ZN1n4taskUlPvPNS_15memory_resourceEE28_4_FUNES1_S3_, .-_ZN1n4taskUlPvPNS_15memory_resourceEE28_4_FUNES1_S3_
+	.p2align 4
+	.type	_ZN1n4taskUlPvS1_E30_4_FUNES1_S1_, @function
+_ZN1n4taskUlPvS1_E30_4_FUNES1_S1_:
+.LFB7413:
+	.cfi_startproc
+	movdqu	(%rdi), %xmm0
+	movups	%xmm0, (%rsi)
+	ret
+	.cfi_endproc
+.LFE7413:
+	.size	_ZN1n4taskUlPvS1_E30_4_FUNES1_S1_, .-_ZN1n4taskUlPvS1_E30_4_FUNES1_S1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvPNS_15memory_resourceEE31_4_FUNES1_S3_, @function
+_ZN1n4taskUlPvPNS_15memory_resourceEE31_4_FUNES1_S3_:
+.LFB7416:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7416:
+	.size	_ZN1n4taskUlPvPNS_15memory_resourceEE31_4_FUNES1_S3_, .-_ZN1n4taskUlPvPNS_15memory_resourceEE31_4_FUNES1_S3_
+	.section	.text._ZN1n13heap_resourceD2Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD2Ev
+	.type	_ZN1n13heap_resourceD2Ev, @function
+_ZN1n13heap_resourceD2Ev:
+.LFB7442:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7442:
+	.size	_ZN1n13heap_resourceD2Ev, .-_ZN1n13heap_resourceD2Ev
+	.weak	_ZN1n13heap_resourceD1Ev
+	.set	_ZN1n13heap_resourceD1Ev,_ZN1n13heap_resourceD2Ev
+	.section	.text._ZN1n13heap_resource10deallocateEPvmm,"axG",@progbits,_ZN1n13heap_resource10deallocateEPvmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource10deallocateEPvmm
+	.type	_ZN1n13heap_resource10deallocateEPvmm, @function
+_ZN1n13heap_resource10deallocateEPvmm:
+.LFB6536:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rcx
+	jbe	.L35
+	movq	%rcx, %rsi
+	jmp	_ZdlPvSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L35:
+	jmp	_ZdlPv@PLT
+	.cfi_endproc
+.LFE6536:
+	.size	_ZN1n13heap_resource10deallocateEPvmm, .-_ZN1n13heap_resource10deallocateEPvmm
+	.section	.text._ZN1n13heap_resource8allocateEmm,"axG",@progbits,_ZN1n13heap_resource8allocateEmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource8allocateEmm
+	.type	_ZN1n13heap_resource8allocateEmm, @function
+_ZN1n13heap_resource8allocateEmm:
+.LFB6535:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rdx
+	jbe	.L37
+	movq	%rdx, %rsi
+	jmp	_ZnwmSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L37:
+	jmp	_Znwm@PLT
+	.cfi_endproc
+.LFE6535:
+	.size	_ZN1n13heap_resource8allocateEmm, .-_ZN1n13heap_resource8allocateEmm
+	.section	.text._ZN1n13heap_resourceD0Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD0Ev
+	.type	_ZN1n13heap_resourceD0Ev, @function
+_ZN1n13heap_resourceD0Ev:
+.LFB7444:
+	.cfi_startproc
+	movl	$8, %esi
+	jmp	_ZdlPvm@PLT
+	.cfi_endproc
+.LFE7444:
+	.size	_ZN1n13heap_resourceD0Ev, .-_ZN1n13heap_resourceD0Ev
+	.text
+	.p2align 4
+	.type	_ZN1n4taskUlPvE17_4_FUNES1_, @function
+_ZN1n4taskUlPvE17_4_FUNES1_:
+.LFB7340:
+	.cfi_startproc
+	movq	(%rdi), %r8
+	movq	8(%rdi), %rcx
+	xorl	%edx, %edx
+	movq	(%r8), %rax
+	movq	8(%r8), %rdi
+	movq	(%rax), %rax
+	divq	(%rdi)
+	movq	%rcx, %rdi
+	imulq	%rax, %rdi
+	movq	%rdx, %rsi
+	cmpq	%rdx, %rcx
+	cmovbe	%rcx, %rsi
+	addq	$1, %rcx
+	addq	%rdi, %rsi
+	cmpq	%rdx, %rcx
+	cmova	%rdx, %rcx
+	addq	%rdi, %rax
+	leaq	(%rcx,%rax), %rdi
+	cmpq	%rdi, %rsi
+	jnb	.L39
+	movq	16(%r8), %r9
+	.p2align 4,,10
+	.p2align 3
+.L40:
+	movq	(%r9), %rax
+	cmpq	%rsi, %rax
+	jb	.L39
+	movq	%rdi, %rax
+	movl	$4096, %edx
+	subq	%rsi, %rax
+	cmpq	%rdx, %rax
+	cmova	%rdx, %rax
+	movq	24(%r8), %rdx
+	cmpq	%rdi, %rsi
+	je	.L42
+	movq	8(%rdx), %rdx
+	addq	%rsi, %rax
+	movq	(%rdx), %rcx
+	movq	%rsi, %rdx
+	jmp	.L44
+	.p2align 4,,10
+	.p2align 3
+.L49:
+	addq	$1, %rdx
+	cmpq	%rdx, %rax
+	je	.L42
+.L44:
+	cmpl	$1, (%rcx,%rdx,4)
+	jle	.L49
+	movq	(%r9), %rax
+.L45:
+	cmpq	%rax, %rdx
+	jnb	.L39
+	movq	16(%r8), %rcx
+	lock cmpxchgq	%rdx, (%rcx)
+	jne	.L45
+.L39:
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L42:
+	addq	$4096, %rsi
+	cmpq	%rdi, %rsi
+	jb	.L40
+	ret
+	.cfi_endproc
+.LFE7340:
+	.size	_ZN1n4taskUlPvE17_4_FUNES1_, .-_ZN1n4taskUlPvE17_4_FUNES1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvE2_4_FUNES1_, @function
+_ZN1n4taskUlPvE2_4_FUNES1_:
+.LFB7219:
+	.cfi_startproc
+	movq	(%rdi), %rsi
+	xorl	%edx, %edx
+	movq	8(%rdi), %r8
+	movq	(%rsi), %rax
+	movq	8(%rsi), %rcx
+	leaq	1(%r8), %rdi
+	movq	(%rax), %rax
+	divq	(%rcx)
+	movq	%rdi, %rcx
+	imulq	%rax, %rcx
+	cmpq	%rdx, %rdi
+	cmova	%rdx, %rdi
+	addq	%rcx, %rdi
+	subq	%rax, %rcx
+	cmpq	%rdx, %r8
+	cmova	%rdx, %r8
+	leaq	(%rcx,%r8), %rax
+	cmpq	%rdi, %rax
+	jnb	.L50
+	.p2align 4,,10
+	.p2align 3
+.L52:
+	movq	24(%rsi), %rcx
+	movq	16(%rsi), %rdx
+	movq	(%rcx), %rcx
+	movq	(%rdx), %rdx
+	movslq	(%rcx,%rax,4), %rcx
+	lock addq	%rcx, (%rdx)
+	addq	$1, %rax
+	cmpq	%rax, %rdi
+	jne	.L52
+.L50:
+	ret
+	.cfi_endproc
+.LFE7219:
+	.size	_ZN1n4taskUlPvE2_4_FUNES1_, .-_ZN1n4taskUlPvE2_4_FUNES1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvE11_4_FUNES1_, @function
+_ZN1n4taskUlPvE11_4_FUNES1_:
+.LFB7265:
+	.cfi_startproc
+	movq	(%rdi), %r8
+	movq	8(%rdi), %rcx
+	xorl	%edx, %edx
+	movq	(%r8), %rax
+	movq	8(%r8), %rdi
+	leaq	1(%rcx), %rsi
+	movq	(%rax), %rax
+	divq	(%rdi)
+	movq	%rsi, %rdi
+	imulq	%rax, %rdi
+	cmpq	%rdx, %rsi
+	cmova	%rdx, %rsi
+	addq	%rdi, %rsi
+	subq	%rax, %rdi
+	cmpq	%rdx, %rcx
+	cmova	%rdx, %rcx
+	leaq	(%rdi,%rcx), %rdx
+	cmpq	%rsi, %rdx
+	jnb	.L60
+	movq	24(%r8), %rax
+	movq	%rsi, %rdi
+	subq	%rdx, %rdi
+	movq	(%rax), %r9
+	leaq	-1(%rdi), %rax
+	cmpq	$2, %rax
+	jbe	.L61
+	leaq	(%r9,%rdx,4), %rax
+	pxor	%xmm1, %xmm1
+	pxor	%xmm2, %xmm2
+	movq	%rdi, %rcx
+	shrq	$2, %rcx
+	movdqa	.LC0(%rip), %xmm5
+	movdqa	.LC1(%rip), %xmm4
+	salq	$4, %rcx
+	addq	%rax, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L57:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpgtd	%xmm5, %xmm0
+	pandn	%xmm4, %xmm0
+	movdqa	%xmm0, %xmm3
+	punpckhdq	%xmm2, %xmm0
+	punpckldq	%xmm2, %xmm3
+	paddq	%xmm3, %xmm0
+	paddq	%xmm0, %xmm1
+	cmpq	%rax, %rcx
+	jne	.L57
+	movdqa	%xmm1, %xmm0
+	movq	%rdi, %rcx
+	andq	$-4, %rcx
+	psrldq	$8, %xmm0
+	paddq	%xmm0, %xmm1
+	addq	%rcx, %rdx
+	andl	$3, %edi
+	movq	%xmm1, %rax
+	je	.L55
+.L56:
+	xorl	%edi, %edi
+	cmpl	$99, (%r9,%rdx,4)
+	leaq	0(,%rdx,4), %rcx
+	setle	%dil
+	addq	%rdi, %rax
+	leaq	1(%rdx), %rdi
+	cmpq	%rsi, %rdi
+	jnb	.L55
+	xorl	%edi, %edi
+	cmpl	$99, 4(%r9,%rcx)
+	setle	%dil
+	addq	$2, %rdx
+	addq	%rdi, %rax
+	cmpq	%rsi, %rdx
+	jnb	.L55
+	xorl	%edx, %edx
+	cmpl	$99, 8(%r9,%rcx)
+	setle	%dl
+	addq	%rdx, %rax
+.L55:
+	movq	32(%r8), %rdx
+	lock addq	%rax, (%rdx)
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L60:
+	xorl	%eax, %eax
+	jmp	.L55
+.L61:
+	xorl	%eax, %eax
+	jmp	.L56
+	.cfi_endproc
+.LFE7265:
+	.size	_ZN1n4taskUlPvE11_4_FUNES1_, .-_ZN1n4taskUlPvE11_4_FUNES1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvE23_4_FUNES1_, @function
+_ZN1n4taskUlPvE23_4_FUNES1_:
+.LFB7372:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	(%rdi), %rax
+	movq	8(%rdi), %r8
+	movq	(%rax), %rdx
+	movq	24(%rax), %rsi
+	movq	%r8, %rcx
+	movq	16(%rax), %r10
+	movq	8(%rax), %rax
+	leaq	2(%r8,%r8), %r8
+	movq	(%rdx), %rdi
+	salq	$4, %rcx
+	movq	(%rsi), %r12
+	movq	(%r10), %rbp
+	movq	(%rdi,%rcx), %r11
+	movq	8(%rdi,%rcx), %r9
+	leaq	0(,%r11,4), %rsi
+	movq	%r9, %rdx
+	leaq	(%r12,%rsi), %rbx
+	subq	%r11, %rdx
+	addq	%rbp, %rsi
+	cmpq	16(%rax), %r8
+	jb	.L115
+	cmpq	%r9, %r11
+	jne	.L116
+.L66:
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L116:
+	.cfi_restore_state
+	movq	%rbx, %rdi
+	salq	$2, %rdx
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	memcpy@PLT
+	.p2align 4,,10
+	.p2align 3
+.L115:
+	.cfi_restore_state
+	movq	16(%rdi,%rcx), %r10
+	movq	%rdx, %rax
+	xorl	%edi, %edi
+	xorl	%ecx, %ecx
+	subq	%r11, %r10
+	cmpq	%r10, %rdx
+	jnb	.L68
+	testq	%rdx, %rdx
+	je	.L68
+	.p2align 4,,10
+	.p2align 3
+.L72:
+	movl	(%rsi,%rax,4), %r9d
+	movl	(%rsi,%rcx,4), %r8d
+	addq	$1, %rdi
+	cmpl	%r9d, %r8d
+	jle	.L69
+	addq	$1, %rax
+	movl	%r9d, -4(%rbx,%rdi,4)
+	cmpq	%r10, %rax
+	jnb	.L68
+	cmpq	%rdx, %rcx
+	jb	.L72
+	.p2align 4,,10
+	.p2align 3
+.L73:
+	cmpq	%r10, %rax
+	jnb	.L66
+	movq	%r10, %r9
+	subq	%rax, %r9
+	leaq	-1(%r9), %rdx
+	cmpq	$2, %rdx
+	jbe	.L81
+	leaq	(%r11,%rdi), %rdx
+	leaq	(%r12,%rdx,4), %rcx
+	leaq	1(%r11,%rax), %rdx
+	salq	$2, %rdx
+	movq	%rcx, %r8
+	leaq	0(%rbp,%rdx), %r11
+	subq	%r11, %r8
+	cmpq	$8, %r8
+	ja	.L117
+.L81:
+	subq	%rax, %rdi
+	leaq	(%rbx,%rdi,4), %rcx
+	.p2align 4,,10
+	.p2align 3
+.L86:
+	addq	$1, %rax
+	movl	-4(%rsi,%rax,4), %edx
+	movl	%edx, -4(%rcx,%rax,4)
+	cmpq	%rax, %r10
+	jne	.L86
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L69:
+	.cfi_restore_state
+	addq	$1, %rcx
+	movl	%r8d, -4(%rbx,%rdi,4)
+	cmpq	%rdx, %rcx
+	jnb	.L73
+	cmpq	%r10, %rax
+	jb	.L72
+.L68:
+	cmpq	%rdx, %rcx
+	jnb	.L73
+	movq	%rdx, %r13
+	subq	%rcx, %r13
+	leaq	-1(%r13), %r8
+	cmpq	$2, %r8
+	jbe	.L74
+	leaq	(%r11,%rdi), %r8
+	leaq	(%r12,%r8,4), %r9
+	leaq	1(%r11,%rcx), %r8
+	salq	$2, %r8
+	movq	%r9, %r14
+	leaq	0(%rbp,%r8), %r15
+	subq	%r15, %r14
+	cmpq	$8, %r14
+	ja	.L118
+.L74:
+	movq	%rdi, %r8
+	subq	%rcx, %r8
+	leaq	(%rbx,%r8,4), %r9
+	.p2align 4,,10
+	.p2align 3
+.L77:
+	addq	$1, %rcx
+	movl	-4(%rsi,%rcx,4), %r8d
+	movl	%r8d, -4(%r9,%rcx,4)
+	cmpq	%rcx, %rdx
+	jne	.L77
+.L78:
+	addq	%r13, %rdi
+	jmp	.L73
+	.p2align 4,,10
+	.p2align 3
+.L117:
+	movq	%r9, %r8
+	leaq	-4(%rbp,%rdx), %r11
+	xorl	%edx, %edx
+	shrq	$2, %r8
+	salq	$4, %r8
+	.p2align 4,,10
+	.p2align 3
+.L82:
+	movdqu	(%r11,%rdx), %xmm1
+	movups	%xmm1, (%rcx,%rdx)
+	addq	$16, %rdx
+	cmpq	%r8, %rdx
+	jne	.L82
+	movq	%r9, %rdx
+	andq	$-4, %rdx
+	addq	%rdx, %rdi
+	addq	%rdx, %rax
+	andl	$3, %r9d
+	je	.L66
+	movl	(%rsi,%rax,4), %r8d
+	leaq	0(,%rdi,4), %rdx
+	leaq	0(,%rax,4), %rcx
+	movl	%r8d, (%rbx,%rdi,4)
+	leaq	1(%rax), %rdi
+	cmpq	%r10, %rdi
+	jnb	.L66
+	movl	4(%rsi,%rcx), %edi
+	addq	$2, %rax
+	movl	%edi, 4(%rbx,%rdx)
+	cmpq	%r10, %rax
+	jnb	.L66
+	movl	8(%rsi,%rcx), %eax
+	movl	%eax, 8(%rbx,%rdx)
+	jmp	.L66
+	.p2align 4,,10
+	.p2align 3
+.L118:
+	movq	%r13, %r14
+	leaq	-4(%rbp,%r8), %r15
+	xorl	%r8d, %r8d
+	shrq	$2, %r14
+	salq	$4, %r14
+	.p2align 4,,10
+	.p2align 3
+.L75:
+	movdqu	(%r15,%r8), %xmm0
+	movups	%xmm0, (%r9,%r8)
+	addq	$16, %r8
+	cmpq	%r14, %r8
+	jne	.L75
+	movq	%r13, %r8
+	andq	$-4, %r8
+	leaq	(%rdi,%r8), %r9
+	addq	%r8, %rcx
+	testb	$3, %r13b
+	je	.L78
+	movl	(%rsi,%rcx,4), %r15d
+	leaq	0(,%r9,4), %r8
+	leaq	0(,%rcx,4), %r14
+	movl	%r15d, (%rbx,%r9,4)
+	leaq	1(%rcx), %r9
+	cmpq	%rdx, %r9
+	jnb	.L78
+	movl	4(%rsi,%r14), %r9d
+	addq	$2, %rcx
+	movl	%r9d, 4(%rbx,%r8)
+	cmpq	%rdx, %rcx
+	jnb	.L78
+	movl	8(%rsi,%r14), %edx
+	movl	%edx, 8(%rbx,%r8)
+	jmp	.L78
+	.cfi_endproc
+.LFE7372:
+	.size	_ZN1n4taskUlPvE23_4_FUNES1_, .-_ZN1n4taskUlPvE23_4_FUNES1_
+	.p2align 4
+	.type	_ZN1n9__pdqsortIiNS_4lessEEEvPT_S3_RT0_ib.isra.0, @function
+_ZN1n9__pdqsortIiNS_4lessEEEvPT_S3_RT0_ib.isra.0:
+.LFB7448:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	subq	%rdi, %r12
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%r12, %rax
+	sarq	$2, %rax
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	cmpq	$92, %r12
+	jbe	.L120
+	movl	%edx, %r13d
+	movl	%ecx, %r9d
+	.p2align 4,,10
+	.p2align 3
+.L121:
+	movq	%rax, %r10
+	movl	(%rdi), %esi
+	shrq	%r10
+	leaq	0(,%r10,4), %r8
+	leaq	(%rdi,%r8), %rdx
+	movl	(%rdx), %ecx
+	cmpq	$512, %r12
+	jbe	.L131
+	cmpl	%ecx, %esi
+	jle	.L132
+	movl	%ecx, (%rdi)
+	movl	%esi, (%rdx)
+	movl	-4(%rbp), %r11d
+	cmpl	%esi, %r11d
+	jge	.L133
+.L205:
+	movl	%r11d, (%rdx)
+	movl	%esi, -4(%rbp)
+	movl	(%rdx), %esi
+.L133:
+	movl	(%rdi), %ecx
+	cmpl	%esi, %ecx
+	jle	.L135
+	movl	%esi, (%rdi)
+	movl	%ecx, (%rdx)
+.L135:
+	leaq	-4(%rdi,%r8), %r11
+	movl	4(%rdi), %esi
+	movl	(%r11), %ecx
+	cmpl	%esi, %ecx
+	jge	.L136
+	movl	%ecx, 4(%rdi)
+	movl	%esi, %ecx
+	movl	%esi, (%r11)
+	movl	-8(%rbp), %ebx
+	cmpl	%ebx, %esi
+	jle	.L137
+.L204:
+	movl	%ebx, (%r11)
+	movl	%esi, -8(%rbp)
+	movl	(%r11), %ecx
+.L137:
+	movl	4(%rdi), %esi
+	cmpl	%ecx, %esi
+	jle	.L138
+	movl	%ecx, 4(%rdi)
+	movl	%esi, %ecx
+	movl	%esi, (%r11)
+.L138:
+	leaq	4(%rdi,%r8), %rbx
+	movl	8(%rdi), %esi
+	movl	(%rbx), %r8d
+	cmpl	%esi, %r8d
+	jge	.L139
+	movl	%r8d, 8(%rdi)
+	movl	%esi, (%rbx)
+	movl	-12(%rbp), %r12d
+	cmpl	%r12d, %esi
+	jle	.L140
+.L203:
+	movl	%r12d, (%rbx)
+	movl	%esi, -12(%rbp)
+	movl	(%rbx), %esi
+.L140:
+	movl	8(%rdi), %r8d
+	cmpl	%esi, %r8d
+	jle	.L265
+	movl	%esi, 8(%rdi)
+	movl	%r8d, (%rbx)
+	movl	(%r11), %ecx
+.L142:
+	movl	(%rdx), %esi
+	cmpl	%ecx, %esi
+	jge	.L143
+	movd	%esi, %xmm0
+	movd	%ecx, %xmm1
+	movl	%ecx, %esi
+	punpckldq	%xmm1, %xmm0
+	movq	%xmm0, (%r11)
+	movl	(%rbx), %r8d
+	cmpl	%ecx, %r8d
+	jge	.L144
+.L202:
+	movl	%r8d, (%rdx)
+	movl	%ecx, (%rbx)
+	movl	(%rdx), %esi
+.L144:
+	movl	(%r11), %ecx
+	cmpl	%esi, %ecx
+	jle	.L145
+	movd	%esi, %xmm0
+	movd	%ecx, %xmm2
+	movl	%ecx, %esi
+	punpckldq	%xmm2, %xmm0
+	movq	%xmm0, (%r11)
+.L145:
+	movl	(%rdi), %ecx
+	movl	%esi, (%rdi)
+	movl	%ecx, (%rdx)
+	movl	(%rdi), %ecx
+.L146:
+	movq	%rdi, %rbx
+	testb	%r9b, %r9b
+	jne	.L161
+	cmpl	%ecx, -4(%rdi)
+	jge	.L266
+	.p2align 4,,10
+	.p2align 3
+.L161:
+	movq	%rbx, %rsi
+	movl	4(%rbx), %r8d
+	addq	$4, %rbx
+	cmpl	%ecx, %r8d
+	jl	.L161
+	movq	%rbp, %rdx
+	cmpq	%rdi, %rsi
+	je	.L164
+	.p2align 4,,10
+	.p2align 3
+.L162:
+	subq	$4, %rdx
+	cmpl	%ecx, (%rdx)
+	jge	.L162
+.L165:
+	movq	%rax, %r11
+	shrq	$3, %r11
+	cmpq	%rdx, %rbx
+	jnb	.L166
+	movl	(%rdx), %r12d
+	.p2align 4,,10
+	.p2align 3
+.L169:
+	movl	%r12d, (%rbx)
+	movl	%r8d, (%rdx)
+	.p2align 4,,10
+	.p2align 3
+.L167:
+	movq	%rbx, %rsi
+	movl	4(%rbx), %r8d
+	addq	$4, %rbx
+	cmpl	%ecx, %r8d
+	jl	.L167
+	.p2align 4,,10
+	.p2align 3
+.L168:
+	movl	-4(%rdx), %r12d
+	subq	$4, %rdx
+	cmpl	%ecx, %r12d
+	jge	.L168
+	cmpq	%rdx, %rbx
+	jb	.L169
+	movl	-4(%rbx), %edx
+	movq	%rsi, %r8
+	movq	%rbp, %r12
+	subq	%rdi, %r8
+	subq	%rbx, %r12
+	movl	%edx, (%rdi)
+	movq	%r8, %rdx
+	movl	%ecx, -4(%rbx)
+	movq	%r12, %rcx
+	sarq	$2, %rdx
+	sarq	$2, %rcx
+	movq	%rdx, 8(%rsp)
+	cmpq	%rcx, %rdx
+	movq	%rcx, %r15
+	movq	%rcx, %r14
+	cmovbe	%rdx, %r15
+	cmpq	%r11, %r15
+	jnb	.L170
+	subl	$1, %r13d
+	jne	.L171
+.L271:
+	leaq	-1(%r10), %rbp
+	leaq	-1(%r10,%r10), %r12
+	testq	%r10, %r10
+	je	.L119
+.L175:
+	cmpq	%rax, %r12
+	jnb	.L177
+	movl	(%rdi,%rbp,4), %r11d
+	movq	%r12, %rcx
+	movq	%rbp, %r9
+	jmp	.L178
+	.p2align 4,,10
+	.p2align 3
+.L267:
+	leaq	(%rdi,%r10,8), %r10
+	movl	(%r10), %ebx
+	cmpl	%esi, %ebx
+	jle	.L215
+	movl	%ebx, %esi
+	movq	%r10, %r8
+	leaq	(%rdi,%r9,4), %rcx
+	cmpl	%esi, %r11d
+	jge	.L177
+.L174:
+	movl	%esi, (%rcx)
+	leaq	1(%rdx,%rdx), %rcx
+	movl	%r11d, (%r8)
+	cmpq	%rax, %rcx
+	jnb	.L177
+	movq	%rdx, %r9
+.L178:
+	leaq	1(%r9), %r10
+	leaq	(%rdi,%rcx,4), %r8
+	leaq	(%r10,%r10), %rdx
+	movl	(%r8), %esi
+	cmpq	%rax, %rdx
+	jb	.L267
+.L215:
+	movq	%rcx, %rdx
+	leaq	(%rdi,%r9,4), %rcx
+	cmpl	%esi, %r11d
+	jl	.L174
+.L177:
+	subq	$1, %rbp
+	subq	$2, %r12
+	cmpq	$-1, %rbp
+	jne	.L175
+	subq	$1, %rax
+	movl	(%rdi), %ecx
+	leaq	(%rdi,%rax,4), %rdx
+	movl	(%rdx), %esi
+	movl	%esi, (%rdi)
+	movl	%ecx, (%rdx)
+	cmpq	$1, %rax
+	je	.L119
+.L182:
+	movl	(%rdi), %r11d
+	movl	$1, %ecx
+	xorl	%r9d, %r9d
+	jmp	.L184
+	.p2align 4,,10
+	.p2align 3
+.L268:
+	leaq	(%rdi,%r10,8), %r10
+	movl	(%r10), %ebx
+	cmpl	%esi, %ebx
+	jle	.L217
+	movl	%ebx, %esi
+	movq	%r10, %r8
+	leaq	(%rdi,%r9,4), %rcx
+	cmpl	%esi, %r11d
+	jge	.L183
+.L181:
+	movl	%esi, (%rcx)
+	leaq	1(%rdx,%rdx), %rcx
+	movl	%r11d, (%r8)
+	cmpq	%rax, %rcx
+	jnb	.L183
+	movq	%rdx, %r9
+.L184:
+	leaq	1(%r9), %r10
+	leaq	(%rdi,%rcx,4), %r8
+	leaq	(%r10,%r10), %rdx
+	movl	(%r8), %esi
+	cmpq	%rax, %rdx
+	jb	.L268
+.L217:
+	movq	%rcx, %rdx
+	leaq	(%rdi,%r9,4), %rcx
+	cmpl	%esi, %r11d
+	jl	.L181
+.L183:
+	subq	$1, %rax
+	movl	(%rdi), %edx
+	movl	(%rdi,%rax,4), %ecx
+	movl	%ecx, (%rdi)
+	movl	%edx, (%rdi,%rax,4)
+	cmpq	$1, %rax
+	jne	.L182
+.L119:
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L269:
+	.cfi_restore_state
+	subq	$4, %rdx
+	cmpl	%ecx, (%rdx)
+	jl	.L165
+.L164:
+	cmpq	%rdx, %rbx
+	jb	.L269
+	movq	%rax, %r11
+	shrq	$3, %r11
+.L166:
+	movl	-4(%rbx), %edx
+	movq	%rsi, %r8
+	movq	%rbp, %r12
+	subq	%rdi, %r8
+	subq	%rbx, %r12
+	movl	%edx, (%rdi)
+	movq	%r8, %r15
+	movl	%ecx, -4(%rbx)
+	movq	%r12, %rcx
+	sarq	$2, %r15
+	sarq	$2, %rcx
+	movq	%r15, 8(%rsp)
+	movq	%r15, %rdx
+	cmpq	%rcx, %r15
+	movq	%rcx, %r14
+	cmova	%rcx, %r15
+	cmpq	%r11, %r15
+	jnb	.L270
+	subl	$1, %r13d
+	je	.L271
+.L171:
+	cmpq	$92, %r8
+	jbe	.L186
+	andq	$-4, %rdx
+	movl	(%rdi), %r10d
+	leaq	(%rdi,%rdx), %rax
+	movl	(%rax), %r11d
+	movl	%r11d, (%rdi)
+	movl	%r10d, (%rax)
+	movq	%rsi, %rax
+	movl	-8(%rbx), %r10d
+	subq	%rdx, %rax
+	movl	(%rax), %r11d
+	movl	%r11d, -8(%rbx)
+	movl	%r10d, (%rax)
+	cmpq	$512, %r8
+	jbe	.L186
+	leaq	4(%rdi,%rdx), %rax
+	movl	4(%rdi), %r8d
+	movl	(%rax), %r10d
+	movl	%r10d, 4(%rdi)
+	movl	%r8d, (%rax)
+	leaq	8(%rdi,%rdx), %rax
+	movl	8(%rdi), %r8d
+	movl	(%rax), %r10d
+	movl	%r10d, 8(%rdi)
+	movl	%r8d, (%rax)
+	movq	8(%rsp), %rax
+	movl	-12(%rbx), %r8d
+	notq	%rax
+	andq	$-4, %rax
+	addq	%rsi, %rax
+	movl	(%rax), %r10d
+	movl	%r10d, -12(%rbx)
+	movl	%r8d, (%rax)
+	movq	%rsi, %rax
+	subq	%rdx, %rax
+	movl	-16(%rbx), %edx
+	movl	-8(%rax), %r8d
+	movl	%r8d, -16(%rbx)
+	movl	%edx, -8(%rax)
+.L186:
+	cmpq	$92, %r12
+	ja	.L272
+.L170:
+	movzbl	%r9b, %ecx
+	movl	%r13d, %edx
+	call	_ZN1n9__pdqsortIiNS_4lessEEEvPT_S3_RT0_ib.isra.0
+	movq	%r14, %rax
+	movq	%rbx, %rdi
+.L160:
+	xorl	%r9d, %r9d
+	cmpq	$92, %r12
+	ja	.L121
+.L122:
+	addq	$4, %rdi
+	cmpq	%rbp, %rdi
+	jnb	.L119
+	movl	(%rdi), %ecx
+	movl	-4(%rdi), %edx
+	cmpl	%edx, %ecx
+	jge	.L122
+	movq	%rdi, %rax
+	.p2align 4,,10
+	.p2align 3
+.L129:
+	movl	%edx, (%rax)
+	movl	-8(%rax), %edx
+	subq	$4, %rax
+	cmpl	%edx, %ecx
+	jl	.L129
+	movl	%ecx, (%rax)
+	jmp	.L122
+.L131:
+	cmpl	%ecx, %esi
+	jge	.L147
+	movl	%esi, (%rdx)
+	movl	%ecx, (%rdi)
+	movl	-4(%rbp), %r8d
+	cmpl	%ecx, %r8d
+	jge	.L148
+.L207:
+	movl	%r8d, (%rdi)
+	movl	%ecx, -4(%rbp)
+	movl	(%rdi), %ecx
+.L148:
+	movl	(%rdx), %esi
+	cmpl	%ecx, %esi
+	jle	.L146
+	movl	%ecx, (%rdx)
+	movl	%esi, (%rdi)
+.L264:
+	movl	%esi, %ecx
+	jmp	.L146
+.L272:
+	movq	%r14, %rax
+	movl	(%rbx), %r8d
+	andq	$-4, %rcx
+	shrq	$2, %rax
+	leaq	4(,%rax,4), %rax
+	leaq	(%rsi,%rax), %rdx
+	movl	(%rdx), %r10d
+	movl	%r10d, (%rbx)
+	movl	%r8d, (%rdx)
+	movq	%rbp, %rdx
+	subq	%rcx, %rdx
+	movl	-4(%rbp), %ecx
+	movl	(%rdx), %r8d
+	movl	%r8d, -4(%rbp)
+	movl	%ecx, (%rdx)
+	cmpq	$512, %r12
+	jbe	.L170
+	leaq	4(%rsi,%rax), %rdx
+	movl	4(%rbx), %ecx
+	movl	(%rdx), %r8d
+	movl	%r8d, 4(%rbx)
+	movl	%ecx, (%rdx)
+	leaq	8(%rsi,%rax), %rdx
+	movl	8(%rbx), %ecx
+	movl	(%rdx), %r8d
+	movl	%r8d, 8(%rbx)
+	movl	%ecx, (%rdx)
+	movq	%rbp, %rdx
+	movl	-8(%rbp), %ecx
+	subq	%rax, %rdx
+	movl	(%rdx), %r8d
+	movl	%r8d, -8(%rbp)
+	movl	%ecx, (%rdx)
+	movq	$-4, %rdx
+	subq	%rax, %rdx
+	leaq	0(%rbp,%rdx), %rax
+	movl	-12(%rbp), %edx
+	movl	(%rax), %ecx
+	movl	%ecx, -12(%rbp)
+	movl	%edx, (%rax)
+	jmp	.L170
+.L147:
+	movl	-4(%rbp), %r8d
+	cmpl	%esi, %r8d
+	jge	.L264
+	movl	%esi, %ecx
+	jmp	.L207
+.L132:
+	movl	-4(%rbp), %r11d
+	cmpl	%ecx, %r11d
+	jge	.L135
+	movl	%ecx, %esi
+	jmp	.L205
+.L143:
+	cmpl	%r8d, %esi
+	jle	.L145
+	movl	%esi, %ecx
+	jmp	.L202
+.L139:
+	movl	-12(%rbp), %r12d
+	cmpl	%r12d, %r8d
+	jle	.L142
+	movl	%r8d, %esi
+	jmp	.L203
+.L136:
+	movl	-8(%rbp), %ebx
+	cmpl	%ebx, %ecx
+	jle	.L138
+	movl	%ecx, %esi
+	jmp	.L204
+.L266:
+	movq	%rbp, %rax
+	.p2align 4,,10
+	.p2align 3
+.L150:
+	movq	%rax, %r9
+	movl	-4(%rax), %esi
+	subq	$4, %rax
+	cmpl	%ecx, %esi
+	jg	.L150
+	movq	%rdi, %rdx
+	cmpq	%r9, %rbp
+	je	.L153
+	.p2align 4,,10
+	.p2align 3
+.L151:
+	addq	$4, %rdx
+	cmpl	%ecx, (%rdx)
+	jle	.L151
+.L154:
+	cmpq	%rax, %rdx
+	jnb	.L152
+	movl	(%rdx), %r8d
+.L159:
+	movl	%esi, (%rdx)
+	movl	%r8d, (%rax)
+	.p2align 4,,10
+	.p2align 3
+.L155:
+	movq	%rax, %r9
+	movl	-4(%rax), %esi
+	subq	$4, %rax
+	cmpl	%ecx, %esi
+	jg	.L155
+	.p2align 4,,10
+	.p2align 3
+.L156:
+	movl	4(%rdx), %r8d
+	addq	$4, %rdx
+	cmpl	%ecx, %r8d
+	jle	.L156
+	cmpq	%rax, %rdx
+	jb	.L159
+	jmp	.L152
+.L273:
+	addq	$4, %rdx
+	cmpl	%ecx, (%rdx)
+	jg	.L154
+.L153:
+	cmpq	%rax, %rdx
+	jb	.L273
+.L152:
+	movq	%rbp, %r12
+	movl	%esi, (%rdi)
+	movq	%r9, %rdi
+	subq	%r9, %r12
+	movl	%ecx, (%rax)
+	movq	%r12, %rax
+	sarq	$2, %rax
+	jmp	.L160
+.L265:
+	movl	(%r11), %ecx
+	movl	%esi, %r8d
+	jmp	.L142
+.L270:
+	cmpq	%rdi, %rsi
+	je	.L191
+	leaq	4(%rdi), %rdx
+	cmpq	%rsi, %rdx
+	jnb	.L191
+	xorl	%r10d, %r10d
+	jmp	.L195
+	.p2align 4,,10
+	.p2align 3
+.L192:
+	addq	$4, %rdx
+	cmpq	%rsi, %rdx
+	jnb	.L191
+.L195:
+	movl	(%rdx), %ecx
+	cmpl	-4(%rdx), %ecx
+	jge	.L192
+	movq	%rdx, %rax
+.L194:
+	movl	-4(%rax), %r8d
+	subq	$4, %rax
+	movl	%r8d, 4(%rax)
+	cmpq	%rdi, %rax
+	je	.L193
+	cmpl	-4(%rax), %ecx
+	jl	.L194
+.L193:
+	movl	%ecx, (%rax)
+	movq	%rdx, %rcx
+	subq	%rax, %rcx
+	movq	%rcx, %rax
+	sarq	$2, %rax
+	addq	%rax, %r10
+	cmpq	$8, %r10
+	jbe	.L192
+	addq	$4, %rdx
+	cmpq	%rdx, %rsi
+	jne	.L170
+.L191:
+	cmpq	%rbx, %rbp
+	je	.L119
+	leaq	8(%rsi), %rdx
+	cmpq	%rbp, %rdx
+	jnb	.L119
+	xorl	%r8d, %r8d
+	jmp	.L199
+.L196:
+	addq	$4, %rdx
+	cmpq	%rbp, %rdx
+	jnb	.L119
+.L199:
+	movl	(%rdx), %ecx
+	cmpl	-4(%rdx), %ecx
+	jge	.L196
+	movq	%rdx, %rax
+.L198:
+	movl	-4(%rax), %r10d
+	subq	$4, %rax
+	movl	%r10d, 4(%rax)
+	cmpq	%rax, %rbx
+	je	.L197
+	cmpl	-4(%rax), %ecx
+	jl	.L198
+.L197:
+	movl	%ecx, (%rax)
+	movq	%rdx, %rcx
+	subq	%rax, %rcx
+	movq	%rcx, %rax
+	sarq	$2, %rax
+	addq	%rax, %r8
+	cmpq	$8, %r8
+	jbe	.L196
+	addq	$4, %rdx
+	cmpq	%rdx, %rbp
+	jne	.L170
+	jmp	.L119
+	.p2align 4,,10
+	.p2align 3
+.L120:
+	testb	%cl, %cl
+	je	.L122
+	cmpq	%rdi, %rsi
+	je	.L119
+	leaq	4(%rdi), %rdx
+	cmpq	%rsi, %rdx
+	jb	.L127
+	jmp	.L119
+	.p2align 4,,10
+	.p2align 3
+.L124:
+	addq	$4, %rdx
+	cmpq	%rbp, %rdx
+	jnb	.L119
+.L127:
+	movl	(%rdx), %ecx
+	cmpl	-4(%rdx), %ecx
+	jge	.L124
+	movq	%rdx, %rax
+.L126:
+	movl	-4(%rax), %esi
+	subq	$4, %rax
+	movl	%esi, 4(%rax)
+	cmpq	%rax, %rdi
+	je	.L125
+	cmpl	-4(%rax), %ecx
+	jl	.L126
+.L125:
+	movl	%ecx, (%rax)
+	jmp	.L124
+	.cfi_endproc
+.LFE7448:
+	.size	_ZN1n9__pdqsortIiNS_4lessEEEvPT_S3_RT0_ib.isra.0, .-_ZN1n9__pdqsortIiNS_4lessEEEvPT_S3_RT0_ib.isra.0
+	.p2align 4
+	.type	_ZN1n4taskUlPvE20_4_FUNES1_, @function
+_ZN1n4taskUlPvE20_4_FUNES1_:
+.LFB7359:
+	.cfi_startproc
+	movq	(%rdi), %r8
+	movq	8(%rdi), %rdx
+	movq	(%r8), %rax
+	movq	(%rax), %rax
+	movq	(%rax,%rdx,8), %rsi
+	movq	8(%rax,%rdx,8), %rcx
+	subq	%rsi, %rcx
+	cmpq	$1, %rcx
+	jbe	.L274
+	movq	%rcx, %rax
+	xorl	%edx, %edx
+	.p2align 4,,10
+	.p2align 3
+.L276:
+	shrq	%rax
+	addl	$1, %edx
+	cmpq	$1, %rax
+	jne	.L276
+	movq	8(%r8), %rax
+	movq	(%rax), %rax
+	leaq	(%rax,%rsi,4), %rdi
+	leaq	(%rdi,%rcx,4), %rsi
+	movl	$1, %ecx
+	jmp	_ZN1n9__pdqsortIiNS_4lessEEEvPT_S3_RT0_ib.isra.0
+	.p2align 4,,10
+	.p2align 3
+.L274:
+	ret
+	.cfi_endproc
+.LFE7359:
+	.size	_ZN1n4taskUlPvE20_4_FUNES1_, .-_ZN1n4taskUlPvE20_4_FUNES1_
+	.section	.text._ZN1n11thread_pool6__loopEPv,"axG",@progbits,_ZN1n11thread_pool6__loopEPv,comdat
+	.p2align 4
+	.weak	_ZN1n11thread_pool6__loopEPv
+	.type	_ZN1n11thread_pool6__loopEPv, @function
+_ZN1n11thread_pool6__loopEPv:
+.LFB6754:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6754
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$88, %rsp
+	.cfi_def_cfa_offset 144
+	movq	(%rdi), %rbx
+	movq	%rdi, %fs:_ZN1n16__current_workerE@tpoff
+	leaq	208(%rbx), %r12
+	.p2align 4,,10
+	.p2align 3
+.L279:
+	movq	(%r12), %r13
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %rbp
+	testq	%rbp, %rbp
+	je	.L280
+	cmpq	0(%rbp), %rbx
+	jne	.L281
+	movq	128(%rbp), %rcx
+	movq	136(%rbp), %rdi
+	leaq	64(%rbp), %r8
+	leaq	128(%rbp), %r9
+	leaq	-1(%rcx), %rax
+	movq	%rax, 128(%rbp)
+	lock orq	$0, (%rsp)
+	movq	64(%rbp), %rsi
+	cmpq	%rsi, %rax
+	jge	.L282
+	movq	%rcx, 128(%rbp)
+.L283:
+	movq	112(%rbx), %rax
+	leaq	112(%rbx), %r15
+	testq	%rax, %rax
+	jne	.L287
+	movq	16(%rbx), %rsi
+.L290:
+	movq	16(%rbp), %rdx
+	movq	%rdx, %rax
+	salq	$13, %rax
+	xorq	%rdx, %rax
+	movq	%rax, %rdx
+	shrq	$7, %rdx
+	xorq	%rax, %rdx
+	movq	%rdx, %rax
+	salq	$17, %rax
+	xorq	%rdx, %rax
+	xorl	%edx, %edx
+	movq	%rax, 16(%rbp)
+	divq	%rsi
+	movq	%rdx, %rcx
+.L288:
+	leaq	(%rcx,%rsi), %r8
+	testq	%rsi, %rsi
+	jne	.L298
+	jmp	.L299
+	.p2align 4,,10
+	.p2align 3
+.L296:
+	addq	$1, %rcx
+	cmpq	%rcx, %r8
+	je	.L299
+.L298:
+	movq	%rcx, %rax
+	xorl	%edx, %edx
+	divq	%rsi
+	movq	(%rbx), %rax
+	movq	(%rax,%rdx,8), %rdx
+	cmpq	%rbp, %rdx
+	je	.L296
+	movq	64(%rdx), %rax
+	leaq	64(%rdx), %r9
+	lock orq	$0, (%rsp)
+	movq	128(%rdx), %rdi
+	cmpq	%rdi, %rax
+	jge	.L296
+	movq	136(%rdx), %rdi
+	movq	(%rdi), %rdx
+	movq	8(%rdi), %rdi
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%rdi,%rdx,8), %r14
+	leaq	1(%rax), %rdx
+	lock cmpxchgq	%rdx, (%r9)
+	jne	.L296
+.L285:
+	movq	48(%r14), %rax
+	movq	%r14, %rdi
+	leaq	16(%rsp), %rbp
+.LEHB0:
+	call	*(%rax)
+.LEHE0:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 16(%rsp)
+	movaps	%xmm0, 32(%rsp)
+	movaps	%xmm0, 48(%rsp)
+	movaps	%xmm0, 64(%rsp)
+	cmpq	%rbp, %r14
+	je	.L300
+	movq	48(%r14), %rax
+	testq	%rax, %rax
+	je	.L300
+	movq	56(%r14), %rsi
+	movq	%r14, %rdi
+.LEHB1:
+	call	*16(%rax)
+	movq	$0, 48(%r14)
+	movq	64(%rsp), %rax
+	testq	%rax, %rax
+	je	.L300
+	movq	%r14, %rsi
+	movq	%rbp, %rdi
+	call	*8(%rax)
+.LEHE1:
+	movdqa	64(%rsp), %xmm1
+	movaps	%xmm1, 48(%r14)
+.L300:
+	movq	64(%r14), %rax
+	lock subq	$1, (%rax)
+	jmp	.L279
+	.p2align 4,,10
+	.p2align 3
+.L299:
+	leaq	120(%rbx), %rbp
+	movq	%rbp, %rdi
+	call	pthread_mutex_lock@PLT
+	lock addq	$1, 216(%rbx)
+	cmpb	$0, 224(%rbx)
+	jne	.L326
+	movq	(%r12), %rax
+	cmpq	%r13, %rax
+	jne	.L303
+	leaq	160(%rbx), %rdi
+	movq	%rbp, %rsi
+.LEHB2:
+	call	pthread_cond_wait@PLT
+.LEHE2:
+.L303:
+	lock subq	$1, 216(%rbx)
+	movq	%rbp, %rdi
+	call	pthread_mutex_unlock@PLT
+	jmp	.L279
+	.p2align 4,,10
+	.p2align 3
+.L281:
+	movq	112(%rbx), %rcx
+	leaq	112(%rbx), %r15
+	testq	%rcx, %rcx
+	jne	.L306
+	movq	16(%rbx), %rsi
+	xorl	%ebp, %ebp
+	jmp	.L288
+	.p2align 4,,10
+	.p2align 3
+.L306:
+	xorl	%ebp, %ebp
+.L287:
+	leaq	32(%rbx), %rdi
+	movq	%rdi, 8(%rsp)
+	call	pthread_mutex_lock@PLT
+	movq	104(%rbx), %rax
+	cmpq	88(%rbx), %rax
+	movq	8(%rsp), %rdi
+	jne	.L289
+	call	pthread_mutex_unlock@PLT
+	movq	16(%rbx), %rsi
+	testq	%rbp, %rbp
+	jne	.L290
+	xorl	%ecx, %ecx
+	jmp	.L288
+	.p2align 4,,10
+	.p2align 3
+.L282:
+	movq	(%rdi), %rdx
+	movq	8(%rdi), %rdi
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%rdi,%rdx,8), %r14
+	cmpq	%rsi, %rax
+	jne	.L285
+	lock cmpxchgq	%rcx, (%r8)
+	movq	%rcx, (%r9)
+	je	.L285
+	jmp	.L283
+	.p2align 4,,10
+	.p2align 3
+.L280:
+	movq	112(%rbx), %rcx
+	leaq	112(%rbx), %r15
+	testq	%rcx, %rcx
+	jne	.L287
+	movq	16(%rbx), %rsi
+	jmp	.L288
+	.p2align 4,,10
+	.p2align 3
+.L289:
+	movq	72(%rbx), %rdx
+	leaq	1(%rax), %rcx
+	movq	%rcx, 104(%rbx)
+	movq	(%rdx,%rax,8), %r14
+	lock subq	$1, (%r15)
+	movq	88(%rbx), %rax
+	cmpq	%rax, 104(%rbx)
+	jne	.L325
+	movq	$0, 88(%rbx)
+	movq	$0, 104(%rbx)
+.L325:
+	call	pthread_mutex_unlock@PLT
+	jmp	.L285
+	.p2align 4,,10
+	.p2align 3
+.L326:
+	movq	%rbp, %rdi
+	call	pthread_mutex_unlock@PLT
+	addq	$88, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L307:
+	.cfi_restore_state
+	movq	%rax, %rbx
+.L301:
+	movq	64(%rsp), %rax
+	testq	%rax, %rax
+	je	.L302
+	movq	72(%rsp), %rsi
+	movq	%rbp, %rdi
+	call	*16(%rax)
+.L302:
+	movq	%rbx, %rdi
+.LEHB3:
+	call	_Unwind_Resume@PLT
+.LEHE3:
+	.cfi_endproc
+.LFE6754:
+	.globl	__gxx_personality_v0
+	.section	.gcc_except_table._ZN1n11thread_pool6__loopEPv,"aG",@progbits,_ZN1n11thread_pool6__loopEPv,comdat
+.LLSDA6754:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6754-.LLSDACSB6754
+.LLSDACSB6754:
+	.uleb128 .LEHB0-.LFB6754
+	.uleb128 .LEHE0-.LEHB0
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB1-.LFB6754
+	.uleb128 .LEHE1-.LEHB1
+	.uleb128 .L307-.LFB6754
+	.uleb128 0
+	.uleb128 .LEHB2-.LFB6754
+	.uleb128 .LEHE2-.LEHB2
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB3-.LFB6754
+	.uleb128 .LEHE3-.LEHB3
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6754:
+	.section	.text._ZN1n11thread_pool6__loopEPv,"axG",@progbits,_ZN1n11thread_pool6__loopEPv,comdat
+	.size	_ZN1n11thread_pool6__loopEPv, .-_ZN1n11thread_pool6__loopEPv
+	.section	.text.unlikely,"ax",@progbits
+	.align 2
+.LCOLDB2:
+	.text
+.LHOTB2:
+	.align 2
+	.p2align 4
+	.type	_ZN1n11thread_poolC2Em.constprop.1, @function
+_ZN1n11thread_poolC2Em.constprop.1:
+.LFB7458:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7458
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L387
+.L329:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	pxor	%xmm0, %xmm0
+	movq	$0, 0(%rbp)
+	movups	%xmm0, 8(%rbp)
+	pxor	%xmm0, %xmm0
+	movq	%rax, 24(%rbp)
+	movq	$0, 64(%rbp)
+	movups	%xmm0, 32(%rbp)
+	movups	%xmm0, 48(%rbp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L388
+.L332:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	8(%rbp), %rbx
+	pxor	%xmm0, %xmm0
+	pxor	%xmm1, %xmm1
+	movq	$0, 72(%rbp)
+	movq	%rax, 96(%rbp)
+	movq	$0, 152(%rbp)
+	movb	$0, 224(%rbp)
+	movups	%xmm1, 80(%rbp)
+	movups	%xmm1, 104(%rbp)
+	movups	%xmm0, 120(%rbp)
+	movups	%xmm0, 136(%rbp)
+	movups	%xmm0, 160(%rbp)
+	movups	%xmm0, 176(%rbp)
+	movups	%xmm0, 192(%rbp)
+	movups	%xmm1, 208(%rbp)
+	cmpq	$2, %rbx
+	jbe	.L389
+.L334:
+	movabsq	$-7046029254386353131, %r15
+	xorl	%r12d, %r12d
+	jmp	.L350
+	.p2align 4,,10
+	.p2align 3
+.L338:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$64, %edx
+	movl	$192, %esi
+	movq	(%rdi), %rax
+.LEHB4:
+	call	*16(%rax)
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	movl	$24, %ecx
+	xorl	%eax, %eax
+	rep stosq
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L390
+.L341:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$8, %edx
+	movl	$528, %esi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	leaq	16(%rax), %rdx
+	movq	$64, (%rax)
+	movq	%rdx, 8(%rax)
+	movq	%rax, 136(%rbx)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L391
+.L344:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	%r12, 8(%rbx)
+	addq	$1, %r12
+	pxor	%xmm2, %xmm2
+	movups	%xmm2, 152(%rbx)
+	movq	16(%rbp), %rdx
+	movq	8(%rbp), %r13
+	movq	%rax, 168(%rbx)
+	movq	%r12, %rax
+	movq	0(%rbp), %r14
+	imulq	%r15, %rax
+	movq	%rbp, (%rbx)
+	movq	$0, 144(%rbx)
+	movq	%rax, 16(%rbx)
+	cmpq	%r13, %rdx
+	je	.L392
+	movq	%rbx, (%r14,%rdx,8)
+.L349:
+	addq	$1, %rdx
+	movq	%rdx, 16(%rbp)
+	cmpq	$3, %r12
+	je	.L393
+.L350:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L338
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L338
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L338
+	.p2align 4,,10
+	.p2align 3
+.L391:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L344
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L344
+	.p2align 4,,10
+	.p2align 3
+.L390:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L341
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L341
+	.p2align 4,,10
+	.p2align 3
+.L392:
+	leaq	5(%r13), %rsi
+	movq	24(%rbp), %rdi
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 8(%rbp)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	16(%rbp), %rdx
+	movq	%rax, %rdi
+	movq	%rax, 0(%rbp)
+	movq	%rbx, (%rdi,%rdx,8)
+	leaq	0(,%rdx,8), %rax
+	testq	%rdx, %rdx
+	jne	.L394
+	testq	%r14, %r14
+	je	.L349
+.L348:
+	movq	24(%rbp), %rdi
+	leaq	0(,%r13,8), %rdx
+	movl	$8, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	16(%rbp), %rdx
+	addq	$1, %rdx
+	movq	%rdx, 16(%rbp)
+	cmpq	$3, %r12
+	jne	.L350
+	.p2align 4,,10
+	.p2align 3
+.L393:
+	xorl	%ebx, %ebx
+	leaq	_ZN1n11thread_pool6__loopEPv(%rip), %r12
+	.p2align 4,,10
+	.p2align 3
+.L351:
+	movq	0(%rbp), %rax
+	movq	%r12, %rdx
+	xorl	%esi, %esi
+	movq	(%rax,%rbx), %rcx
+	addq	$8, %rbx
+	leaq	24(%rcx), %rdi
+	call	pthread_create@PLT
+	cmpq	$24, %rbx
+	jne	.L351
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L394:
+	.cfi_restore_state
+	movq	%rax, %rdx
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L348
+	.p2align 4,,10
+	.p2align 3
+.L387:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L329
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L329
+	.p2align 4,,10
+	.p2align 3
+.L389:
+	movq	24(%rbp), %rdi
+	movq	0(%rbp), %r12
+	movl	$8, %edx
+	movl	$24, %esi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, 0(%rbp)
+	movq	%rax, %rdi
+	movq	16(%rbp), %rax
+	movq	$3, 8(%rbp)
+	testq	%rax, %rax
+	jne	.L395
+	testq	%r12, %r12
+	je	.L334
+.L336:
+	movq	24(%rbp), %rdi
+	leaq	0(,%rbx,8), %rdx
+	movl	$8, %ecx
+	movq	%r12, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE4:
+	jmp	.L334
+	.p2align 4,,10
+	.p2align 3
+.L388:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L332
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L332
+	.p2align 4,,10
+	.p2align 3
+.L395:
+	leaq	0(,%rax,8), %rdx
+	movq	%r12, %rsi
+	call	memcpy@PLT
+	jmp	.L336
+.L355:
+	movq	%rax, %rbx
+	jmp	.L352
+	.section	.gcc_except_table,"a",@progbits
+.LLSDA7458:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7458-.LLSDACSB7458
+.LLSDACSB7458:
+	.uleb128 .LEHB4-.LFB7458
+	.uleb128 .LEHE4-.LEHB4
+	.uleb128 .L355-.LFB7458
+	.uleb128 0
+.LLSDACSE7458:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7458
+	.type	_ZN1n11thread_poolC2Em.constprop.1.cold, @function
+_ZN1n11thread_poolC2Em.constprop.1.cold:
+.LFSB7458:
+.L352:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	72(%rbp), %rsi
+	movq	80(%rbp), %rdx
+	testq	%rsi, %rsi
+	je	.L353
+	movq	96(%rbp), %rdi
+	salq	$3, %rdx
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L353:
+	movq	0(%rbp), %rsi
+	movq	8(%rbp), %rdx
+	testq	%rsi, %rsi
+	je	.L354
+	movq	24(%rbp), %rdi
+	salq	$3, %rdx
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L354:
+	movq	%rbx, %rdi
+.LEHB5:
+	call	_Unwind_Resume@PLT
+.LEHE5:
+	.cfi_endproc
+.LFE7458:
+	.section	.gcc_except_table
+.LLSDAC7458:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7458-.LLSDACSBC7458
+.LLSDACSBC7458:
+	.uleb128 .LEHB5-.LCOLDB2
+	.uleb128 .LEHE5-.LEHB5
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC7458:
+	.section	.text.unlikely
+	.text
+	.size	_ZN1n11thread_poolC2Em.constprop.1, .-_ZN1n11thread_poolC2Em.constprop.1
+	.section	.text.unlikely
+	.size	_ZN1n11thread_poolC2Em.constprop.1.cold, .-_ZN1n11thread_poolC2Em.constprop.1.cold
+.LCOLDE2:
+	.text
+.LHOTE2:
+	.section	.text.unlikely
+.LCOLDB3:
+	.text
+.LHOTB3:
+	.p2align 4
+	.type	_Z7numbersi.constprop.0, @function
+_Z7numbersi.constprop.0:
+.LFB7459:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7459
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pxor	%xmm0, %xmm0
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	movq	$0, (%rdi)
+	movups	%xmm0, 8(%rdi)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L421
+	xorl	%r15d, %r15d
+	xorl	%r14d, %r14d
+	xorl	%edx, %edx
+.L397:
+	movq	%rax, 24(%r12)
+	movl	$200000, %r13d
+	movl	$7, %ebp
+	jmp	.L406
+	.p2align 4,,10
+	.p2align 3
+.L401:
+	movl	%ebx, (%r15,%rdx,4)
+.L404:
+	addq	$1, %rdx
+	movq	%rdx, 16(%r12)
+	subl	$1, %r13d
+	je	.L396
+.L423:
+	movq	8(%r12), %r14
+	movq	(%r12), %r15
+.L406:
+	movabsq	$6364136223846793005, %rax
+	imulq	%rax, %rbp
+	movabsq	$1442695040888963407, %rax
+	addq	%rax, %rbp
+	movq	%rbp, %rax
+	shrq	$40, %rax
+	imulq	$274877907, %rax, %rbx
+	shrq	$38, %rbx
+	imull	$1000, %ebx, %ecx
+	movl	%eax, %ebx
+	subl	%ecx, %ebx
+	cmpq	%r14, %rdx
+	jne	.L401
+	leaq	5(%r14), %rsi
+	movq	24(%r12), %rdi
+	movl	$4, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$3, %rsi
+	movq	%rax, 8(%r12)
+	movq	(%rdi), %rax
+.LEHB6:
+	call	*16(%rax)
+	movq	16(%r12), %rdx
+	movq	%rax, %rdi
+	movq	%rax, (%r12)
+	movl	%ebx, (%rdi,%rdx,4)
+	leaq	0(,%rdx,4), %rax
+	testq	%rdx, %rdx
+	jne	.L422
+	testq	%r15, %r15
+	je	.L404
+.L403:
+	movq	24(%r12), %rdi
+	leaq	0(,%r14,4), %rdx
+	movl	$4, %ecx
+	movq	%r15, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE6:
+	movq	16(%r12), %rdx
+	addq	$1, %rdx
+	movq	%rdx, 16(%r12)
+	subl	$1, %r13d
+	jne	.L423
+.L396:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%r12, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L422:
+	.cfi_restore_state
+	movq	%rax, %rdx
+	movq	%r15, %rsi
+	call	memcpy@PLT
+	jmp	.L403
+	.p2align 4,,10
+	.p2align 3
+.L421:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L424
+.L399:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	16(%r12), %rdx
+	movq	8(%r12), %r14
+	movq	(%r12), %r15
+	jmp	.L397
+.L424:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L399
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L399
+.L410:
+	movq	%rax, %rbx
+	jmp	.L407
+	.section	.gcc_except_table
+.LLSDA7459:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7459-.LLSDACSB7459
+.LLSDACSB7459:
+	.uleb128 .LEHB6-.LFB7459
+	.uleb128 .LEHE6-.LEHB6
+	.uleb128 .L410-.LFB7459
+	.uleb128 0
+.LLSDACSE7459:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7459
+	.type	_Z7numbersi.constprop.0.cold, @function
+_Z7numbersi.constprop.0.cold:
+.LFSB7459:
+.L407:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	(%r12), %rsi
+	movq	8(%r12), %rdx
+	testq	%rsi, %rsi
+	je	.L408
+	movq	24(%r12), %rdi
+	salq	$2, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L408:
+	movq	%rbx, %rdi
+.LEHB7:
+	call	_Unwind_Resume@PLT
+.LEHE7:
+	.cfi_endproc
+.LFE7459:
+	.section	.gcc_except_table
+.LLSDAC7459:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7459-.LLSDACSBC7459
+.LLSDACSBC7459:
+	.uleb128 .LEHB7-.LCOLDB3
+	.uleb128 .LEHE7-.LEHB7
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC7459:
+	.section	.text.unlikely
+	.text
+	.size	_Z7numbersi.constprop.0, .-_Z7numbersi.constprop.0
+	.section	.text.unlikely
+	.size	_Z7numbersi.constprop.0.cold, .-_Z7numbersi.constprop.0.cold
+.LCOLDE3:
+	.text
+.LHOTE3:
+	.p2align 4
+	.type	_ZN1n4taskUlPvE29_4_FUNES1_, @function
+_ZN1n4taskUlPvE29_4_FUNES1_:
+.LFB7410:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7410
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$88, %rsp
+	.cfi_def_cfa_offset 144
+	movq	(%rdi), %rdx
+	movq	8(%rdi), %rdi
+	movq	(%rdx), %rax
+	movq	%rdi, %rcx
+	movq	24(%rdx), %r9
+	leaq	2(%rdi,%rdi), %rdi
+	salq	$4, %rcx
+	movq	(%rax), %rsi
+	movq	(%r9), %rbx
+	movq	16(%rdx), %r9
+	movq	8(%rdx), %rdx
+	movq	(%rsi,%rcx), %rax
+	movq	8(%rsi,%rcx), %r8
+	leaq	(%rax,%rax,2), %r13
+	movq	%r8, %r10
+	salq	$4, %r13
+	subq	%rax, %r10
+	addq	%r13, %rbx
+	addq	(%r9), %r13
+	movq	%rbx, 72(%rsp)
+	cmpq	16(%rdx), %rdi
+	jb	.L516
+	cmpq	%r8, %rax
+	jne	.L517
+.L425:
+	addq	$88, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L517:
+	.cfi_restore_state
+	addq	$88, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	leaq	(%r10,%r10,2), %rdx
+	movq	%rbx, %rdi
+	movq	%r13, %rsi
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	salq	$4, %rdx
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	memcpy@PLT
+	.p2align 4,,10
+	.p2align 3
+.L516:
+	.cfi_restore_state
+	movq	16(%rsi,%rcx), %r8
+	subq	%rax, %r8
+	testq	%r10, %r10
+	je	.L481
+	cmpq	%r8, %r10
+	jnb	.L481
+	movq	%rbx, %r12
+	movq	%r10, %r15
+	movl	$1, %r11d
+	xorl	%r14d, %r14d
+	movdqa	.LC4(%rip), %xmm0
+	jmp	.L449
+	.p2align 4,,10
+	.p2align 3
+.L520:
+	movq	%r10, 64(%rsp)
+	movq	%r11, 32(%rsp)
+	movq	%r9, 24(%rsp)
+	movq	%rcx, 16(%rsp)
+	movq	%r8, 8(%rsp)
+	movaps	%xmm0, 48(%rsp)
+	call	memcmp@PLT
+	movq	8(%rsp), %r8
+	movq	16(%rsp), %rcx
+	testl	%eax, %eax
+	movq	24(%rsp), %r9
+	movq	32(%rsp), %r11
+	movq	64(%rsp), %r10
+	movdqa	48(%rsp), %xmm0
+	je	.L432
+	jns	.L434
+.L435:
+	movups	%xmm0, (%r12)
+	addq	$1, %r15
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L518
+.L436:
+	pxor	%xmm2, %xmm2
+	movq	%rax, 16(%r12)
+	movq	$0, 40(%r12)
+	movups	%xmm2, 24(%r12)
+	movq	0(%rbp), %rax
+	movq	16(%rbp), %rdx
+	movq	%rax, (%r12)
+	movq	8(%rbp), %rax
+	movq	%rdx, 16(%r12)
+	movq	%rax, 8(%r12)
+	cmpq	$23, %rax
+	je	.L519
+	movq	24(%rbp), %rax
+	movq	%rax, 24(%r12)
+	movq	$23, 8(%rbp)
+.L441:
+	movq	$0, 0(%rbp)
+	leaq	1(%r11), %rax
+	addq	$48, %r12
+	movb	$0, 24(%rbp)
+	cmpq	%r10, %r14
+	jnb	.L451
+.L523:
+	cmpq	%r8, %r15
+	jnb	.L427
+	movq	%rax, %r11
+.L449:
+	leaq	(%r14,%r14,2), %rbx
+	leaq	(%r15,%r15,2), %rbp
+	salq	$4, %rbx
+	salq	$4, %rbp
+	addq	%r13, %rbx
+	addq	%r13, %rbp
+	cmpq	$23, 8(%rbx)
+	movq	(%rbx), %rcx
+	leaq	24(%rbx), %rsi
+	je	.L429
+	movq	24(%rbx), %rsi
+.L429:
+	cmpq	$23, 8(%rbp)
+	movq	0(%rbp), %r9
+	leaq	24(%rbp), %rdi
+	je	.L431
+	movq	24(%rbp), %rdi
+.L431:
+	cmpq	%r9, %rcx
+	movq	%r9, %rdx
+	cmovbe	%rcx, %rdx
+	testq	%rdx, %rdx
+	jne	.L520
+.L432:
+	cmpq	%rcx, %r9
+	jb	.L435
+.L434:
+	movups	%xmm0, (%r12)
+	addq	$1, %r14
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L521
+.L443:
+	pxor	%xmm3, %xmm3
+	movq	%rax, 16(%r12)
+	movq	$0, 40(%r12)
+	movups	%xmm3, 24(%r12)
+	movq	(%rbx), %rax
+	movq	16(%rbx), %rdx
+	movq	%rax, (%r12)
+	movq	8(%rbx), %rax
+	movq	%rdx, 16(%r12)
+	movq	%rax, 8(%r12)
+	cmpq	$23, %rax
+	je	.L522
+	movq	24(%rbx), %rax
+	movq	%rax, 24(%r12)
+	movq	$23, 8(%rbx)
+.L448:
+	movq	$0, (%rbx)
+	leaq	1(%r11), %rax
+	addq	$48, %r12
+	movb	$0, 24(%rbx)
+	cmpq	%r10, %r14
+	jb	.L523
+	.p2align 4,,10
+	.p2align 3
+.L451:
+	cmpq	%r8, %r15
+	jnb	.L524
+	movq	72(%rsp), %rax
+	leaq	(%r11,%r11,2), %r12
+	movdqa	.LC4(%rip), %xmm0
+	movq	%r15, %rbx
+	salq	$4, %r12
+	addq	%rax, %r12
+	leaq	(%r15,%r15,2), %rax
+	salq	$4, %rax
+	leaq	24(%r13,%rax), %r14
+.L473:
+	movups	%xmm0, (%r12)
+	leaq	1(%rbx), %rbp
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rdx
+	movq	%rdx, %rax
+	testq	%rdx, %rdx
+	je	.L525
+.L467:
+	pxor	%xmm1, %xmm1
+	movq	%rax, 16(%r12)
+	movq	$0, 40(%r12)
+	movups	%xmm1, 24(%r12)
+	movq	-24(%r14), %rax
+	movq	-8(%r14), %rsi
+	movq	%rax, (%r12)
+	movq	-16(%r14), %rax
+	movq	%rsi, 16(%r12)
+	movq	%rax, 8(%r12)
+	cmpq	$23, %rax
+	je	.L526
+	movq	(%r14), %rax
+	movq	%rax, 24(%r12)
+	movq	$23, -16(%r14)
+.L472:
+	movq	$0, -24(%r14)
+	movb	$0, (%r14)
+	cmpq	%rbp, %r8
+	je	.L465
+	addq	$48, %r12
+	addq	$48, %r14
+	testq	%rdx, %rdx
+	je	.L486
+	subq	%r15, %r11
+	movq	72(%rsp), %rdi
+	leaq	0(%rbp,%rbp,2), %rdx
+	pxor	%xmm1, %xmm1
+	leaq	1(%rbx,%r11), %rax
+	salq	$4, %rdx
+	leaq	(%rax,%rax,2), %rax
+	leaq	24(%r13,%rdx), %rdx
+	salq	$4, %rax
+	addq	%rax, %rdi
+	movq	%rdi, %rax
+	jmp	.L476
+	.p2align 4,,10
+	.p2align 3
+.L474:
+	movq	(%rdx), %rcx
+	movq	%rcx, 24(%rax)
+	movq	$23, -16(%rdx)
+.L514:
+	movq	$0, -24(%rdx)
+	addq	$48, %rax
+	addq	$48, %rdx
+	movb	$0, -48(%rdx)
+	cmpq	%r8, %rbp
+	jnb	.L465
+.L476:
+	movups	%xmm0, (%rax)
+	addq	$1, %rbp
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rcx
+	movq	$0, 40(%rax)
+	movq	%rcx, 16(%rax)
+	movups	%xmm1, 24(%rax)
+	movq	-24(%rdx), %rcx
+	movq	-8(%rdx), %rsi
+	movq	%rcx, (%rax)
+	movq	-16(%rdx), %rcx
+	movq	%rsi, 16(%rax)
+	movq	%rcx, 8(%rax)
+	cmpq	$23, %rcx
+	jne	.L474
+	movdqu	(%rdx), %xmm5
+	movups	%xmm5, 24(%rax)
+	movq	16(%rdx), %rcx
+	movq	%rcx, 40(%rax)
+	jmp	.L514
+	.p2align 4,,10
+	.p2align 3
+.L525:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L527
+.L469:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	jmp	.L467
+.L524:
+	testq	%r8, %r8
+	je	.L425
+	.p2align 4,,10
+	.p2align 3
+.L465:
+	xorl	%ebx, %ebx
+.L480:
+	movq	8(%r13), %rdx
+	cmpq	$23, %rdx
+	je	.L478
+.L528:
+	movq	16(%r13), %rdi
+	movq	24(%r13), %rsi
+	addq	$1, %rdx
+	addq	$1, %rbx
+	movq	%r8, 8(%rsp)
+	movl	$1, %ecx
+	addq	$48, %r13
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	8(%rsp), %r8
+	cmpq	%rbx, %r8
+	je	.L425
+	movq	8(%r13), %rdx
+	cmpq	$23, %rdx
+	jne	.L528
+.L478:
+	addq	$1, %rbx
+	addq	$48, %r13
+	cmpq	%rbx, %r8
+	jne	.L480
+	jmp	.L425
+	.p2align 4,,10
+	.p2align 3
+.L519:
+	movdqu	24(%rbp), %xmm6
+	movups	%xmm6, 24(%r12)
+	movq	40(%rbp), %rax
+	movq	%rax, 40(%r12)
+	jmp	.L441
+	.p2align 4,,10
+	.p2align 3
+.L522:
+	movdqu	24(%rbx), %xmm7
+	movups	%xmm7, 24(%r12)
+	movq	40(%rbx), %rax
+	movq	%rax, 40(%r12)
+	jmp	.L448
+	.p2align 4,,10
+	.p2align 3
+.L518:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L529
+.L438:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	jmp	.L436
+	.p2align 4,,10
+	.p2align 3
+.L521:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L530
+.L445:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	jmp	.L443
+	.p2align 4,,10
+	.p2align 3
+.L530:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%r10, 24(%rsp)
+	movq	%rbp, %rdi
+	movq	%r11, 16(%rsp)
+	movq	%r8, 8(%rsp)
+	movaps	%xmm0, 32(%rsp)
+	call	__cxa_guard_acquire@PLT
+	movq	8(%rsp), %r8
+	movq	16(%rsp), %r11
+	testl	%eax, %eax
+	movq	24(%rsp), %r10
+	movdqa	32(%rsp), %xmm0
+	je	.L445
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movdqa	32(%rsp), %xmm0
+	movq	24(%rsp), %r10
+	movq	16(%rsp), %r11
+	movq	8(%rsp), %r8
+	jmp	.L445
+	.p2align 4,,10
+	.p2align 3
+.L529:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%r10, 24(%rsp)
+	movq	%rbx, %rdi
+	movq	%r11, 16(%rsp)
+	movq	%r8, 8(%rsp)
+	movaps	%xmm0, 32(%rsp)
+	call	__cxa_guard_acquire@PLT
+	movq	8(%rsp), %r8
+	movq	16(%rsp), %r11
+	testl	%eax, %eax
+	movq	24(%rsp), %r10
+	movdqa	32(%rsp), %xmm0
+	je	.L438
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movdqa	32(%rsp), %xmm0
+	movq	24(%rsp), %r10
+	movq	16(%rsp), %r11
+	movq	8(%rsp), %r8
+	jmp	.L438
+	.p2align 4,,10
+	.p2align 3
+.L481:
+	movq	%r10, %r15
+	xorl	%r11d, %r11d
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L427:
+	cmpq	%r10, %r14
+	jnb	.L451
+	movq	72(%rsp), %rax
+	leaq	(%r11,%r11,2), %r12
+	movdqa	.LC4(%rip), %xmm0
+	movq	%r14, %rbx
+	salq	$4, %r12
+	addq	%rax, %r12
+	leaq	(%r14,%r14,2), %rax
+	salq	$4, %rax
+	leaq	24(%r13,%rax), %rdx
+.L459:
+	movups	%xmm0, (%r12)
+	leaq	1(%rbx), %rbp
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rcx
+	movq	%rcx, %rax
+	testq	%rcx, %rcx
+	je	.L531
+.L452:
+	pxor	%xmm1, %xmm1
+	movq	%rax, 16(%r12)
+	movq	$0, 40(%r12)
+	movups	%xmm1, 24(%r12)
+	movq	-24(%rdx), %rax
+	movq	-8(%rdx), %rdi
+	movq	%rax, (%r12)
+	movq	-16(%rdx), %rax
+	movq	%rdi, 16(%r12)
+	movq	%rax, 8(%r12)
+	cmpq	$23, %rax
+	je	.L532
+	movq	(%rdx), %rax
+	movq	%rax, 24(%r12)
+	movq	$23, -16(%rdx)
+.L457:
+	movq	$0, -24(%rdx)
+	movb	$0, (%rdx)
+	cmpq	%r10, %rbp
+	je	.L462
+	addq	$48, %r12
+	addq	$48, %rdx
+	testq	%rcx, %rcx
+	je	.L484
+	movq	%rbx, %rsi
+	movq	72(%rsp), %rdi
+	leaq	0(%rbp,%rbp,2), %rdx
+	pxor	%xmm1, %xmm1
+	subq	%r14, %rsi
+	salq	$4, %rdx
+	leaq	1(%rsi,%r11), %rax
+	leaq	24(%r13,%rdx), %rdx
+	leaq	(%rax,%rax,2), %rax
+	salq	$4, %rax
+	addq	%rdi, %rax
+	jmp	.L463
+	.p2align 4,,10
+	.p2align 3
+.L460:
+	movq	(%rdx), %rcx
+	movq	%rcx, 24(%rax)
+	movq	$23, -16(%rdx)
+.L513:
+	movq	$0, -24(%rdx)
+	addq	$48, %rax
+	addq	$48, %rdx
+	movb	$0, -48(%rdx)
+	cmpq	%r10, %rbp
+	jnb	.L462
+.L463:
+	movups	%xmm0, (%rax)
+	addq	$1, %rbp
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rcx
+	movq	$0, 40(%rax)
+	movq	%rcx, 16(%rax)
+	movups	%xmm1, 24(%rax)
+	movq	-24(%rdx), %rcx
+	movq	-8(%rdx), %rsi
+	movq	%rcx, (%rax)
+	movq	-16(%rdx), %rcx
+	movq	%rsi, 16(%rax)
+	movq	%rcx, 8(%rax)
+	cmpq	$23, %rcx
+	jne	.L460
+	movdqu	(%rdx), %xmm4
+	movups	%xmm4, 24(%rax)
+	movq	16(%rdx), %rcx
+	movq	%rcx, 40(%rax)
+	jmp	.L513
+	.p2align 4,,10
+	.p2align 3
+.L531:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L533
+.L454:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	jmp	.L452
+	.p2align 4,,10
+	.p2align 3
+.L462:
+	addq	%r11, %r10
+	movq	%r10, %r11
+	subq	%r14, %r11
+	jmp	.L451
+	.p2align 4,,10
+	.p2align 3
+.L527:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%r11, 24(%rsp)
+	movq	%rdx, 16(%rsp)
+	movq	%r8, 8(%rsp)
+	movaps	%xmm0, 32(%rsp)
+	call	__cxa_guard_acquire@PLT
+	movq	8(%rsp), %r8
+	movq	16(%rsp), %rdx
+	testl	%eax, %eax
+	movq	24(%rsp), %r11
+	movdqa	32(%rsp), %xmm0
+	je	.L469
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movdqa	32(%rsp), %xmm0
+	movq	24(%rsp), %r11
+	movq	16(%rsp), %rdx
+	movq	8(%rsp), %r8
+	jmp	.L469
+	.p2align 4,,10
+	.p2align 3
+.L533:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rdx, 64(%rsp)
+	movq	%r10, 32(%rsp)
+	movq	%r11, 24(%rsp)
+	movq	%rcx, 16(%rsp)
+	movq	%r8, 8(%rsp)
+	movaps	%xmm0, 48(%rsp)
+	call	__cxa_guard_acquire@PLT
+	movq	8(%rsp), %r8
+	movq	16(%rsp), %rcx
+	testl	%eax, %eax
+	movq	24(%rsp), %r11
+	movq	32(%rsp), %r10
+	movq	64(%rsp), %rdx
+	movdqa	48(%rsp), %xmm0
+	je	.L454
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movdqa	48(%rsp), %xmm0
+	movq	64(%rsp), %rdx
+	movq	32(%rsp), %r10
+	movq	24(%rsp), %r11
+	movq	16(%rsp), %rcx
+	movq	8(%rsp), %r8
+	jmp	.L454
+	.p2align 4,,10
+	.p2align 3
+.L526:
+	movdqu	(%r14), %xmm7
+	movups	%xmm7, 24(%r12)
+	movq	16(%r14), %rax
+	movq	%rax, 40(%r12)
+	jmp	.L472
+	.p2align 4,,10
+	.p2align 3
+.L532:
+	movdqu	(%rdx), %xmm6
+	movups	%xmm6, 24(%r12)
+	movq	16(%rdx), %rax
+	movq	%rax, 40(%r12)
+	jmp	.L457
+	.p2align 4,,10
+	.p2align 3
+.L486:
+	movq	%rbp, %rbx
+	jmp	.L473
+	.p2align 4,,10
+	.p2align 3
+.L484:
+	movq	%rbp, %rbx
+	jmp	.L459
+	.cfi_endproc
+.LFE7410:
+	.section	.gcc_except_table
+.LLSDA7410:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7410-.LLSDACSB7410
+.LLSDACSB7410:
+.LLSDACSE7410:
+	.text
+	.size	_ZN1n4taskUlPvE29_4_FUNES1_, .-_ZN1n4taskUlPvE29_4_FUNES1_
+	.section	.text._ZN1n11thread_pool6__pushEPNS_11__task_nodeE,"axG",@progbits,_ZN1n11thread_pool6__pushEPNS_11__task_nodeE,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n11thread_pool6__pushEPNS_11__task_nodeE
+	.type	_ZN1n11thread_pool6__pushEPNS_11__task_nodeE, @function
+_ZN1n11thread_pool6__pushEPNS_11__task_nodeE:
+.LFB6744:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rsi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %r12
+	testq	%r12, %r12
+	je	.L535
+	cmpq	(%r12), %rdi
+	jne	.L535
+	movq	128(%r12), %r14
+	movq	64(%r12), %r9
+	movq	%r14, %rax
+	movq	%r9, %rbp
+	movq	136(%r12), %rcx
+	subq	%r9, %rax
+	movq	(%rcx), %r15
+	cmpq	%rax, %r15
+	jle	.L569
+.L536:
+	movq	8(%rcx), %rax
+	subq	$1, %r15
+	andq	%r14, %r15
+	addq	$1, %r14
+	movq	%r13, (%rax,%r15,8)
+	movq	%r14, 128(%r12)
+	jmp	.L547
+	.p2align 4,,10
+	.p2align 3
+.L535:
+	leaq	32(%rbx), %rbp
+	movq	%rbp, %rdi
+	call	pthread_mutex_lock@PLT
+	movq	88(%rbx), %rdx
+	movq	80(%rbx), %r12
+	cmpq	%r12, %rdx
+	je	.L570
+	movq	72(%rbx), %rax
+	movq	%r13, (%rax,%rdx,8)
+.L551:
+	addq	$1, %rdx
+	movq	%rdx, 88(%rbx)
+	lock addq	$1, 112(%rbx)
+	movq	%rbp, %rdi
+	call	pthread_mutex_unlock@PLT
+.L547:
+	lock addq	$1, 208(%rbx)
+	movq	216(%rbx), %rax
+	testq	%rax, %rax
+	jne	.L571
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L571:
+	.cfi_restore_state
+	leaq	120(%rbx), %rbp
+	movq	%rbp, %rdi
+	call	pthread_mutex_lock@PLT
+	leaq	160(%rbx), %rdi
+	call	pthread_cond_broadcast@PLT
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbp, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	pthread_mutex_unlock@PLT
+	.p2align 4,,10
+	.p2align 3
+.L570:
+	.cfi_restore_state
+	movq	96(%rbx), %rdi
+	leaq	5(%r12), %rsi
+	movl	$8, %edx
+	movq	72(%rbx), %r14
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 80(%rbx)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	88(%rbx), %rdx
+	movq	%rax, %rdi
+	movq	%rax, 72(%rbx)
+	movq	%r13, (%rdi,%rdx,8)
+	leaq	0(,%rdx,8), %rax
+	testq	%rdx, %rdx
+	jne	.L572
+	testq	%r14, %r14
+	je	.L551
+.L550:
+	movq	96(%rbx), %rdi
+	leaq	0(,%r12,8), %rdx
+	movl	$8, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	88(%rbx), %rdx
+	jmp	.L551
+	.p2align 4,,10
+	.p2align 3
+.L569:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	addq	%r15, %r15
+	testb	%al, %al
+	je	.L573
+.L538:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%rcx, 8(%rsp)
+	leaq	16(,%r15,8), %rsi
+	movl	$8, %edx
+	movq	%r9, (%rsp)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	(%rsp), %r9
+	movq	8(%rsp), %rcx
+	movq	%r15, (%rax)
+	movq	%rax, %r8
+	leaq	16(%rax), %rax
+	cmpq	%r9, %r14
+	movq	%rax, 8(%r8)
+	jle	.L543
+	.p2align 4,,10
+	.p2align 3
+.L540:
+	movq	(%rcx), %rax
+	movq	8(%rcx), %rdx
+	subq	$1, %rax
+	andq	%rbp, %rax
+	movq	(%rdx,%rax,8), %rsi
+	movq	(%r8), %rax
+	movq	8(%r8), %rdx
+	subq	$1, %rax
+	andq	%rbp, %rax
+	addq	$1, %rbp
+	movq	%rsi, (%rdx,%rax,8)
+	cmpq	%rbp, %r14
+	jne	.L540
+.L543:
+	movq	160(%r12), %rdx
+	movq	152(%r12), %rbp
+	movq	144(%r12), %r15
+	cmpq	%rbp, %rdx
+	je	.L574
+	movq	%rcx, (%r15,%rdx,8)
+.L546:
+	addq	$1, %rdx
+	movq	%r8, %rcx
+	movq	%rdx, 160(%r12)
+	movq	%r8, 136(%r12)
+	movq	(%r8), %r15
+	jmp	.L536
+	.p2align 4,,10
+	.p2align 3
+.L573:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rcx, 8(%rsp)
+	movq	%r9, (%rsp)
+	call	__cxa_guard_acquire@PLT
+	movq	(%rsp), %r9
+	movq	8(%rsp), %rcx
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	testl	%eax, %eax
+	je	.L538
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movq	8(%rsp), %rcx
+	movq	(%rsp), %r9
+	jmp	.L538
+	.p2align 4,,10
+	.p2align 3
+.L572:
+	movq	%rax, %rdx
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L550
+	.p2align 4,,10
+	.p2align 3
+.L574:
+	movq	168(%r12), %rdi
+	leaq	5(%rbp), %rsi
+	movq	%r8, 8(%rsp)
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	movq	%rcx, (%rsp)
+	salq	$4, %rsi
+	movq	%rax, 152(%r12)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	160(%r12), %rdx
+	movq	(%rsp), %rcx
+	movq	%rax, %rdi
+	movq	%rax, 144(%r12)
+	movq	8(%rsp), %r8
+	testq	%rdx, %rdx
+	movq	%rcx, (%rdi,%rdx,8)
+	leaq	0(,%rdx,8), %rax
+	jne	.L575
+	testq	%r15, %r15
+	je	.L546
+.L545:
+	movq	168(%r12), %rdi
+	movq	%r8, (%rsp)
+	movl	$8, %ecx
+	movq	%r15, %rsi
+	leaq	0(,%rbp,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	160(%r12), %rdx
+	movq	(%rsp), %r8
+	jmp	.L546
+.L575:
+	movq	%rax, %rdx
+	movq	%r15, %rsi
+	movq	%r8, (%rsp)
+	call	memcpy@PLT
+	movq	(%rsp), %r8
+	jmp	.L545
+	.cfi_endproc
+.LFE6744:
+	.size	_ZN1n11thread_pool6__pushEPNS_11__task_nodeE, .-_ZN1n11thread_pool6__pushEPNS_11__task_nodeE
+	.section	.text._ZN1n11thread_poolD2Ev,"axG",@progbits,_ZN1n11thread_poolD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n11thread_poolD2Ev
+	.type	_ZN1n11thread_poolD2Ev, @function
+_ZN1n11thread_poolD2Ev:
+.LFB6766:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6766
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leaq	120(%rdi), %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	movq	%r15, %rdi
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	%r15, (%rsp)
+	call	pthread_mutex_lock@PLT
+	movb	$1, 224(%rbx)
+	lock addq	$1, 208(%rbx)
+	xorl	%ebp, %ebp
+	leaq	160(%rbx), %rax
+	movq	%rax, %rdi
+	movq	%rax, 8(%rsp)
+	call	pthread_cond_broadcast@PLT
+	movq	%r15, %rdi
+	call	pthread_mutex_unlock@PLT
+	cmpq	$0, 16(%rbx)
+	je	.L580
+	.p2align 4,,10
+	.p2align 3
+.L577:
+	movq	(%rbx), %rax
+	xorl	%esi, %esi
+	movq	(%rax,%rbp,8), %rax
+	addq	$1, %rbp
+	movq	24(%rax), %rdi
+	call	pthread_join@PLT
+	movq	16(%rbx), %rax
+	cmpq	%rax, %rbp
+	jb	.L577
+	testq	%rax, %rax
+	je	.L580
+	xorl	%r12d, %r12d
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	.p2align 4,,10
+	.p2align 3
+.L594:
+	movq	(%rbx), %rax
+	movq	(%rax,%r12,8), %r15
+	movq	136(%r15), %r13
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L620
+.L582:
+	movq	0(%r13), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%r13, %rsi
+	movl	$8, %ecx
+	xorl	%r13d, %r13d
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	$0, 160(%r15)
+	jne	.L584
+	jmp	.L590
+	.p2align 4,,10
+	.p2align 3
+.L588:
+	movq	(%r14), %rax
+	movl	$8, %ecx
+	movq	%r14, %rsi
+	addq	$1, %r13
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	160(%r15), %r13
+	jnb	.L590
+.L584:
+	movq	144(%r15), %rax
+	movq	(%rax,%r13,8), %r14
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L588
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L588
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L588
+	.p2align 4,,10
+	.p2align 3
+.L590:
+	movq	144(%r15), %rsi
+	testq	%rsi, %rsi
+	je	.L586
+	movq	152(%r15), %rax
+	movq	168(%r15), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L586:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L621
+.L592:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$64, %ecx
+	movl	$192, %edx
+	movq	%r15, %rsi
+	addq	$1, %r12
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	16(%rbx), %r12
+	jb	.L594
+.L580:
+	movq	8(%rsp), %rdi
+	call	pthread_cond_destroy@PLT
+	movq	(%rsp), %rdi
+	call	pthread_mutex_destroy@PLT
+	leaq	32(%rbx), %rdi
+	call	pthread_mutex_destroy@PLT
+	movq	72(%rbx), %rsi
+	testq	%rsi, %rsi
+	je	.L579
+	movq	80(%rbx), %rax
+	movq	96(%rbx), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L579:
+	movq	(%rbx), %rsi
+	testq	%rsi, %rsi
+	je	.L576
+	movq	24(%rbx), %rdi
+	movq	8(%rbx), %rdx
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	salq	$3, %rdx
+	call	*24(%rax)
+.L576:
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L621:
+	.cfi_restore_state
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L592
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L592
+	.p2align 4,,10
+	.p2align 3
+.L620:
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L582
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L582
+	.cfi_endproc
+.LFE6766:
+	.section	.gcc_except_table
+.LLSDA6766:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6766-.LLSDACSB6766
+.LLSDACSB6766:
+.LLSDACSE6766:
+	.section	.text._ZN1n11thread_poolD2Ev,"axG",@progbits,_ZN1n11thread_poolD5Ev,comdat
+	.size	_ZN1n11thread_poolD2Ev, .-_ZN1n11thread_poolD2Ev
+	.weak	_ZN1n11thread_poolD1Ev
+	.set	_ZN1n11thread_poolD1Ev,_ZN1n11thread_poolD2Ev
+	.section	.text._ZN1n10task_group4syncEv,"axG",@progbits,_ZN1n10task_group4syncEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n10task_group4syncEv
+	.type	_ZN1n10task_group4syncEv, @function
+_ZN1n10task_group4syncEv:
+.LFB6781:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6781
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	leaq	8(%rdi), %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$88, %rsp
+	.cfi_def_cfa_offset 144
+	.p2align 4,,10
+	.p2align 3
+.L623:
+	movq	(%r12), %rax
+	testq	%rax, %rax
+	je	.L667
+.L646:
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %rbx
+	movq	0(%rbp), %r13
+	testq	%rbx, %rbx
+	je	.L624
+	cmpq	(%rbx), %r13
+	jne	.L625
+	movq	128(%rbx), %rcx
+	movq	136(%rbx), %rdi
+	leaq	64(%rbx), %r8
+	leaq	128(%rbx), %r9
+	leaq	-1(%rcx), %rax
+	movq	%rax, 128(%rbx)
+	lock orq	$0, (%rsp)
+	movq	64(%rbx), %rsi
+	cmpq	%rsi, %rax
+	jge	.L626
+	movq	%rcx, 128(%rbx)
+.L627:
+	movq	112(%r13), %rax
+	leaq	112(%r13), %r15
+	testq	%rax, %rax
+	jne	.L631
+	movq	16(%r13), %rsi
+.L634:
+	movq	16(%rbx), %rdx
+	movq	%rdx, %rax
+	salq	$13, %rax
+	xorq	%rdx, %rax
+	movq	%rax, %rdx
+	shrq	$7, %rdx
+	xorq	%rax, %rdx
+	movq	%rdx, %rax
+	salq	$17, %rax
+	xorq	%rdx, %rax
+	xorl	%edx, %edx
+	movq	%rax, 16(%rbx)
+	divq	%rsi
+	movq	%rdx, %rcx
+.L632:
+	leaq	(%rcx,%rsi), %r8
+	testq	%rsi, %rsi
+	jne	.L641
+	jmp	.L642
+	.p2align 4,,10
+	.p2align 3
+.L639:
+	addq	$1, %rcx
+	cmpq	%r8, %rcx
+	je	.L642
+.L641:
+	movq	%rcx, %rax
+	xorl	%edx, %edx
+	divq	%rsi
+	movq	0(%r13), %rax
+	movq	(%rax,%rdx,8), %rdx
+	cmpq	%rbx, %rdx
+	je	.L639
+	movq	64(%rdx), %rax
+	leaq	64(%rdx), %r9
+	lock orq	$0, (%rsp)
+	movq	128(%rdx), %rdi
+	cmpq	%rdi, %rax
+	jge	.L639
+	movq	136(%rdx), %rdi
+	movq	(%rdi), %rdx
+	movq	8(%rdi), %rdi
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%rdi,%rdx,8), %r14
+	leaq	1(%rax), %rdx
+	lock cmpxchgq	%rdx, (%r9)
+	jne	.L639
+.L629:
+	movq	48(%r14), %rax
+	movq	%r14, %rdi
+	leaq	16(%rsp), %rbx
+.LEHB8:
+	call	*(%rax)
+.LEHE8:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 16(%rsp)
+	movaps	%xmm0, 32(%rsp)
+	movaps	%xmm0, 48(%rsp)
+	movaps	%xmm0, 64(%rsp)
+	cmpq	%rbx, %r14
+	je	.L643
+	movq	48(%r14), %rax
+	testq	%rax, %rax
+	je	.L643
+	movq	56(%r14), %rsi
+	movq	%r14, %rdi
+.LEHB9:
+	call	*16(%rax)
+	movq	$0, 48(%r14)
+	movq	64(%rsp), %rax
+	testq	%rax, %rax
+	je	.L643
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	call	*8(%rax)
+.LEHE9:
+	movdqa	64(%rsp), %xmm1
+	movaps	%xmm1, 48(%r14)
+.L643:
+	movq	64(%r14), %rax
+	lock subq	$1, (%rax)
+	movq	(%r12), %rax
+	testq	%rax, %rax
+	jne	.L646
+.L667:
+	addq	$88, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L642:
+	.cfi_restore_state
+	call	sched_yield@PLT
+	jmp	.L623
+	.p2align 4,,10
+	.p2align 3
+.L625:
+	movq	112(%r13), %rcx
+	leaq	112(%r13), %r15
+	testq	%rcx, %rcx
+	jne	.L648
+	movq	16(%r13), %rsi
+	xorl	%ebx, %ebx
+	jmp	.L632
+	.p2align 4,,10
+	.p2align 3
+.L648:
+	xorl	%ebx, %ebx
+.L631:
+	leaq	32(%r13), %rdi
+	movq	%rdi, 8(%rsp)
+	call	pthread_mutex_lock@PLT
+	movq	104(%r13), %rax
+	cmpq	88(%r13), %rax
+	movq	8(%rsp), %rdi
+	jne	.L633
+	call	pthread_mutex_unlock@PLT
+	movq	16(%r13), %rsi
+	testq	%rbx, %rbx
+	jne	.L634
+	xorl	%ecx, %ecx
+	jmp	.L632
+	.p2align 4,,10
+	.p2align 3
+.L626:
+	movq	(%rdi), %rdx
+	movq	8(%rdi), %rdi
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%rdi,%rdx,8), %r14
+	cmpq	%rsi, %rax
+	jne	.L629
+	lock cmpxchgq	%rcx, (%r8)
+	movq	%rcx, (%r9)
+	je	.L629
+	jmp	.L627
+	.p2align 4,,10
+	.p2align 3
+.L624:
+	movq	112(%r13), %rcx
+	leaq	112(%r13), %r15
+	testq	%rcx, %rcx
+	jne	.L631
+	movq	16(%r13), %rsi
+	jmp	.L632
+	.p2align 4,,10
+	.p2align 3
+.L633:
+	movq	72(%r13), %rdx
+	leaq	1(%rax), %rcx
+	movq	%rcx, 104(%r13)
+	movq	(%rdx,%rax,8), %r14
+	lock subq	$1, (%r15)
+	movq	88(%r13), %rax
+	cmpq	%rax, 104(%r13)
+	jne	.L666
+	movq	$0, 88(%r13)
+	movq	$0, 104(%r13)
+.L666:
+	call	pthread_mutex_unlock@PLT
+	jmp	.L629
+.L649:
+	movq	%rax, %rbp
+.L644:
+	movq	64(%rsp), %rax
+	testq	%rax, %rax
+	je	.L645
+	movq	72(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	*16(%rax)
+.L645:
+	movq	%rbp, %rdi
+.LEHB10:
+	call	_Unwind_Resume@PLT
+.LEHE10:
+	.cfi_endproc
+.LFE6781:
+	.section	.gcc_except_table
+.LLSDA6781:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6781-.LLSDACSB6781
+.LLSDACSB6781:
+	.uleb128 .LEHB8-.LFB6781
+	.uleb128 .LEHE8-.LEHB8
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB9-.LFB6781
+	.uleb128 .LEHE9-.LEHB9
+	.uleb128 .L649-.LFB6781
+	.uleb128 0
+	.uleb128 .LEHB10-.LFB6781
+	.uleb128 .LEHE10-.LEHB10
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6781:
+	.section	.text._ZN1n10task_group4syncEv,"axG",@progbits,_ZN1n10task_group4syncEv,comdat
+	.size	_ZN1n10task_group4syncEv, .-_ZN1n10task_group4syncEv
+	.section	.text._ZN1n10task_groupD2Ev,"axG",@progbits,_ZN1n10task_groupD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n10task_groupD2Ev
+	.type	_ZN1n10task_groupD2Ev, @function
+_ZN1n10task_groupD2Ev:
+.LFB6778:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6778
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	addq	$16, %r14
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%r14, %r13
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	call	_ZN1n10task_group4syncEv
+	.p2align 4,,10
+	.p2align 3
+.L677:
+	movq	%r13, %r12
+	movq	0(%r13), %r13
+	movq	8(%r12), %rbp
+	testq	%rbp, %rbp
+	je	.L669
+	leaq	16(%r12), %rbx
+	xorl	%r15d, %r15d
+	.p2align 4,,10
+	.p2align 3
+.L672:
+	movq	48(%rbx), %rdx
+	testq	%rdx, %rdx
+	je	.L670
+	addq	$1, %r15
+	movq	56(%rbx), %rsi
+	movq	%rbx, %rdi
+	addq	$80, %rbx
+	call	*16(%rdx)
+	cmpq	%r15, %rbp
+	jne	.L672
+.L669:
+	cmpq	%r12, %r14
+	je	.L673
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L686
+.L675:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %ecx
+	movl	$656, %edx
+	movq	%r12, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L673:
+	testq	%r13, %r13
+	jne	.L677
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L670:
+	.cfi_restore_state
+	addq	$1, %r15
+	addq	$80, %rbx
+	cmpq	%r15, %rbp
+	jne	.L672
+	jmp	.L669
+	.p2align 4,,10
+	.p2align 3
+.L686:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L675
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L675
+	.cfi_endproc
+.LFE6778:
+	.section	.gcc_except_table
+.LLSDA6778:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6778-.LLSDACSB6778
+.LLSDACSB6778:
+.LLSDACSE6778:
+	.section	.text._ZN1n10task_groupD2Ev,"axG",@progbits,_ZN1n10task_groupD5Ev,comdat
+	.size	_ZN1n10task_groupD2Ev, .-_ZN1n10task_groupD2Ev
+	.weak	_ZN1n10task_groupD1Ev
+	.set	_ZN1n10task_groupD1Ev,_ZN1n10task_groupD2Ev
+	.section	.rodata._ZN1n4test10test_suite7run_allEv.str1.1,"aMS",@progbits,1
+.LC6:
+	.string	"\nSUITE [%s] "
+.LC8:
+	.string	"%s"
+.LC9:
+	.string	"\nTEST [%s] "
+.LC10:
+	.string	" - Result : \033[1;32mPASSED\033[0m"
+.LC11:
+	.string	"\033[1;31merror : %s\033[0m\n"
+.LC12:
+	.string	" - Result : \033[1;31mFAILED\033[0m"
+.LC13:
+	.string	" - Passed : \033[1;32m%d\033[0m\n"
+.LC14:
+	.string	" - Failed : \033[1;31m%d\033[0m\n"
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4test10test_suite7run_allEv
+	.type	_ZN1n4test10test_suite7run_allEv, @function
+_ZN1n4test10test_suite7run_allEv:
+.LFB6902:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6902
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	leaq	.LC6(%rip), %rdx
+	movl	$79, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	16(%rdi), %rcx
+	leaq	16(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L688
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L689
+	testb	$4, %cl
+	jne	.L742
+	testl	%ecx, %ecx
+	je	.L688
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L743
+	.p2align 4,,10
+	.p2align 3
+.L688:
+	movzwl	.LC7(%rip), %r15d
+	movq	%rbx, %rsi
+	leaq	.LC8(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+.LEHB11:
+	call	printf@PLT
+	movl	8(%r12), %esi
+	testl	%esi, %esi
+	jle	.L709
+	movl	$0, 12(%rsp)
+	xorl	%ebp, %ebp
+	xorl	%r14d, %r14d
+	jmp	.L703
+	.p2align 4,,10
+	.p2align 3
+.L746:
+	testb	$4, %dl
+	jne	.L744
+	testl	%edx, %edx
+	je	.L694
+	movb	$42, (%rax)
+	testb	$2, %dl
+	jne	.L745
+	.p2align 4,,10
+	.p2align 3
+.L694:
+	movq	%rbx, %rsi
+	leaq	.LC8(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+.LEHE11:
+	movq	(%r12), %rax
+.LEHB12:
+	call	*8(%rax,%r13)
+.LEHE12:
+	leaq	.LC10(%rip), %rdi
+	addl	$1, %r14d
+.LEHB13:
+	call	puts@PLT
+.L699:
+	addq	$1, %rbp
+	cmpl	%ebp, 8(%r12)
+	jle	.L693
+.L703:
+	movq	(%r12), %rax
+	movq	%rbp, %r13
+	movq	%rbx, %rdi
+	movl	$79, %esi
+	salq	$4, %r13
+	leaq	.LC9(%rip), %rdx
+	movq	(%rax,%r13), %rcx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L694
+	movl	$79, %edx
+	subl	%eax, %edx
+	addq	%rbx, %rax
+	cmpl	$8, %edx
+	jb	.L746
+	movabsq	$3038287259199220266, %rsi
+	leaq	8(%rax), %rdi
+	movl	%edx, %ecx
+	andq	$-8, %rdi
+	movq	%rsi, (%rax)
+	movq	%rsi, -8(%rax,%rcx)
+	subq	%rdi, %rax
+	leal	(%rdx,%rax), %ecx
+	movq	%rsi, %rax
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L694
+.L709:
+	movl	$0, 12(%rsp)
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L693:
+	movabsq	$5917806138674729738, %rax
+	movq	%rbx, %rdi
+	movq	%rax, 16(%rsp)
+	movabsq	$9095440486453792, %rax
+	movq	%rax, 22(%rsp)
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L704
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L705
+	testb	$4, %cl
+	jne	.L747
+	testl	%ecx, %ecx
+	je	.L704
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L748
+.L704:
+	movq	%rbx, %rsi
+	leaq	.LC8(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+	movl	%r14d, %esi
+	leaq	.LC13(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	12(%rsp), %esi
+	leaq	.LC14(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	$10, %edi
+	call	putchar@PLT
+.LEHE13:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L705:
+	.cfi_restore_state
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L704
+.L689:
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L688
+.L744:
+	movl	$707406378, (%rax)
+	movl	$707406378, -4(%rax,%rdx)
+	jmp	.L694
+.L745:
+	movl	$10794, %ecx
+	movw	%cx, -2(%rax,%rdx)
+	jmp	.L694
+.L743:
+	movl	$10794, %edi
+	movw	%di, -2(%rdx,%rcx)
+	jmp	.L688
+.L748:
+	movl	$10794, %eax
+	movw	%ax, -2(%rdx,%rcx)
+	jmp	.L704
+.L742:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L688
+.L747:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L704
+.L710:
+	movq	%rax, %rdi
+	movq	%rdx, %rax
+.L700:
+	subq	$1, %rax
+	jne	.L741
+	call	__cxa_begin_catch@PLT
+	leaq	.LC11(%rip), %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+.LEHB14:
+	call	printf@PLT
+.LEHE14:
+	call	__cxa_end_catch@PLT
+	leaq	.LC12(%rip), %rdi
+	addl	$1, 12(%rsp)
+.LEHB15:
+	call	puts@PLT
+	jmp	.L699
+.L702:
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+.L741:
+	call	_Unwind_Resume@PLT
+.LEHE15:
+.L711:
+	movq	%rax, %rbx
+	jmp	.L702
+	.cfi_endproc
+.LFE6902:
+	.section	.gcc_except_table
+	.align 4
+.LLSDA6902:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT6902-.LLSDATTD6902
+.LLSDATTD6902:
+	.byte	0x1
+	.uleb128 .LLSDACSE6902-.LLSDACSB6902
+.LLSDACSB6902:
+	.uleb128 .LEHB11-.LFB6902
+	.uleb128 .LEHE11-.LEHB11
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB12-.LFB6902
+	.uleb128 .LEHE12-.LEHB12
+	.uleb128 .L710-.LFB6902
+	.uleb128 0x1
+	.uleb128 .LEHB13-.LFB6902
+	.uleb128 .LEHE13-.LEHB13
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB14-.LFB6902
+	.uleb128 .LEHE14-.LEHB14
+	.uleb128 .L711-.LFB6902
+	.uleb128 0
+	.uleb128 .LEHB15-.LFB6902
+	.uleb128 .LEHE15-.LEHB15
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6902:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	DW.ref._ZTIPKc-.
+.LLSDATT6902:
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.size	_ZN1n4test10test_suite7run_allEv, .-_ZN1n4test10test_suite7run_allEv
+	.section	.text.unlikely
+.LCOLDB15:
+	.text
+.LHOTB15:
+	.p2align 4
+	.globl	_Z7numbersi
+	.type	_Z7numbersi, @function
+_Z7numbersi:
+.LFB6903:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6903
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pxor	%xmm0, %xmm0
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	$0, (%rdi)
+	movl	%esi, 12(%rsp)
+	movups	%xmm0, 8(%rdi)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L775
+.L750:
+	movq	%rax, 24(%r12)
+	movl	12(%rsp), %eax
+	testl	%eax, %eax
+	jle	.L749
+	movq	16(%r12), %rdx
+	xorl	%r13d, %r13d
+	movl	$7, %ebp
+	jmp	.L759
+	.p2align 4,,10
+	.p2align 3
+.L755:
+	movl	%ebx, (%r15,%rdx,4)
+.L758:
+	addq	$1, %rdx
+	addl	$1, %r13d
+	movq	%rdx, 16(%r12)
+	cmpl	%r13d, 12(%rsp)
+	je	.L749
+.L759:
+	movabsq	$6364136223846793005, %rax
+	movq	8(%r12), %r14
+	movq	(%r12), %r15
+	imulq	%rax, %rbp
+	movabsq	$1442695040888963407, %rax
+	addq	%rax, %rbp
+	movq	%rbp, %rax
+	shrq	$40, %rax
+	imulq	$274877907, %rax, %rbx
+	shrq	$38, %rbx
+	imull	$1000, %ebx, %ecx
+	movl	%eax, %ebx
+	subl	%ecx, %ebx
+	cmpq	%r14, %rdx
+	jne	.L755
+	leaq	5(%r14), %rsi
+	movq	24(%r12), %rdi
+	movl	$4, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$3, %rsi
+	movq	%rax, 8(%r12)
+	movq	(%rdi), %rax
+.LEHB16:
+	call	*16(%rax)
+	movq	16(%r12), %rdx
+	movq	%rax, %rdi
+	movq	%rax, (%r12)
+	movl	%ebx, (%rdi,%rdx,4)
+	leaq	0(,%rdx,4), %rax
+	testq	%rdx, %rdx
+	jne	.L776
+	testq	%r15, %r15
+	je	.L758
+.L757:
+	movq	24(%r12), %rdi
+	leaq	0(,%r14,4), %rdx
+	movl	$4, %ecx
+	movq	%r15, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE16:
+	movq	16(%r12), %rdx
+	jmp	.L758
+	.p2align 4,,10
+	.p2align 3
+.L749:
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%r12, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L776:
+	.cfi_restore_state
+	movq	%rax, %rdx
+	movq	%r15, %rsi
+	call	memcpy@PLT
+	jmp	.L757
+	.p2align 4,,10
+	.p2align 3
+.L775:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L777
+.L752:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	jmp	.L750
+.L777:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L752
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L752
+.L763:
+	movq	%rax, %rbx
+	jmp	.L761
+	.section	.gcc_except_table
+.LLSDA6903:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6903-.LLSDACSB6903
+.LLSDACSB6903:
+	.uleb128 .LEHB16-.LFB6903
+	.uleb128 .LEHE16-.LEHB16
+	.uleb128 .L763-.LFB6903
+	.uleb128 0
+.LLSDACSE6903:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6903
+	.type	_Z7numbersi.cold, @function
+_Z7numbersi.cold:
+.LFSB6903:
+.L761:
+	.cfi_def_cfa_offset 80
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	(%r12), %rsi
+	movq	8(%r12), %rdx
+	testq	%rsi, %rsi
+	je	.L762
+	movq	24(%r12), %rdi
+	salq	$2, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L762:
+	movq	%rbx, %rdi
+.LEHB17:
+	call	_Unwind_Resume@PLT
+.LEHE17:
+	.cfi_endproc
+.LFE6903:
+	.section	.gcc_except_table
+.LLSDAC6903:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6903-.LLSDACSBC6903
+.LLSDACSBC6903:
+	.uleb128 .LEHB17-.LCOLDB15
+	.uleb128 .LEHE17-.LEHB17
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6903:
+	.section	.text.unlikely
+	.text
+	.size	_Z7numbersi, .-_Z7numbersi
+	.section	.text.unlikely
+	.size	_Z7numbersi.cold, .-_Z7numbersi.cold
+.LCOLDE15:
+	.text
+.LHOTE15:
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC16:
+	.string	"n::parallel tests"
+.LC17:
+	.string	"test_parallel_for_each"
+.LC18:
+	.string	"test_parallel_reduce"
+.LC19:
+	.string	"test_parallel_count"
+.LC20:
+	.string	"test_parallel_find"
+.LC21:
+	.string	"test_parallel_sort"
+.LC22:
+	.string	"test_parallel_sort_strings"
+	.section	.text.unlikely
+.LCOLDB24:
+	.section	.text.startup,"ax",@progbits
+.LHOTB24:
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB6948:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6948
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$1600, %edi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 64
+.LEHB18:
+	call	_Znam@PLT
+.LEHE18:
+	movq	%rax, %rbx
+	leaq	1600(%rax), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L779:
+	movq	$0, (%rax)
+	addq	$16, %rax
+	movq	$0, -8(%rax)
+	cmpq	%rax, %rdx
+	jne	.L779
+	leaq	.LC16(%rip), %rax
+	movq	%rsp, %rdi
+	movq	%rbx, (%rsp)
+	movq	%rax, 16(%rsp)
+	leaq	.LC17(%rip), %rax
+	movq	%rax, (%rbx)
+	leaq	_Z22test_parallel_for_eachv(%rip), %rax
+	movq	%rax, 8(%rbx)
+	leaq	.LC18(%rip), %rax
+	movq	%rax, 16(%rbx)
+	leaq	_Z20test_parallel_reducev(%rip), %rax
+	movq	%rax, 24(%rbx)
+	leaq	.LC19(%rip), %rax
+	movq	%rax, 32(%rbx)
+	leaq	_Z19test_parallel_countv(%rip), %rax
+	movq	%rax, 40(%rbx)
+	leaq	.LC20(%rip), %rax
+	movq	%rax, 48(%rbx)
+	leaq	_Z18test_parallel_findv(%rip), %rax
+	movq	%rax, 56(%rbx)
+	leaq	.LC21(%rip), %rax
+	movq	%rax, 64(%rbx)
+	leaq	_Z18test_parallel_sortv(%rip), %rax
+	movq	%rax, 72(%rbx)
+	leaq	.LC22(%rip), %rax
+	movq	%rax, 80(%rbx)
+	leaq	_Z26test_parallel_sort_stringsv(%rip), %rax
+	movq	%rax, 88(%rbx)
+	movq	.LC23(%rip), %rax
+	movq	%rax, 8(%rsp)
+.LEHB19:
+	call	_ZN1n4test10test_suite7run_allEv
+.LEHE19:
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L781:
+	.cfi_restore_state
+	movq	%rax, %rbp
+	jmp	.L780
+	.section	.gcc_except_table
+.LLSDA6948:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6948-.LLSDACSB6948
+.LLSDACSB6948:
+	.uleb128 .LEHB18-.LFB6948
+	.uleb128 .LEHE18-.LEHB18
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB19-.LFB6948
+	.uleb128 .LEHE19-.LEHB19
+	.uleb128 .L781-.LFB6948
+	.uleb128 0
+.LLSDACSE6948:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6948
+	.type	main.cold, @function
+main.cold:
+.LFSB6948:
+.L780:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	movq	%rbp, %rdi
+.LEHB20:
+	call	_Unwind_Resume@PLT
+.LEHE20:
+	.cfi_endproc
+.LFE6948:
+	.section	.gcc_except_table
+.LLSDAC6948:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6948-.LLSDACSBC6948
+.LLSDACSBC6948:
+	.uleb128 .LEHB20-.LCOLDB24
+	.uleb128 .LEHE20-.LEHB20
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6948:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	main, .-main
+	.section	.text.unlikely
+	.size	main.cold, .-main.cold
+.LCOLDE24:
+	.section	.text.startup
+.LHOTE24:
+	.section	.text._ZN1n6vectorIiE6resizeEmRKi,"axG",@progbits,_ZN1n6vectorIiE6resizeEmRKi,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n6vectorIiE6resizeEmRKi
+	.type	_ZN1n6vectorIiE6resizeEmRKi, @function
+_ZN1n6vectorIiE6resizeEmRKi:
+.LFB7008:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rsi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	16(%rdi), %rcx
+	cmpq	%rcx, %rsi
+	jb	.L794
+	movq	8(%rdi), %r13
+	movq	%rdx, %r12
+	cmpq	%rsi, %r13
+	jnb	.L789
+	movq	(%rdi), %r15
+	cmpq	%r15, %rdx
+	jb	.L790
+	leaq	(%r15,%rcx,4), %rax
+	cmpq	%rax, %rdx
+	jnb	.L790
+	movl	(%rdx), %eax
+	leaq	12(%rsp), %rdx
+	movl	%eax, 12(%rsp)
+	call	_ZN1n6vectorIiE6resizeEmRKi
+	jmp	.L786
+	.p2align 4,,10
+	.p2align 3
+.L818:
+	leaq	0(,%rcx,4), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+.L792:
+	movq	24(%rbp), %rdi
+	movl	$4, %ecx
+	leaq	0(,%r13,4), %rdx
+	movq	%r15, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	16(%rbp), %rcx
+.L789:
+	cmpq	%rbx, %rcx
+	jnb	.L794
+	leaq	0(,%rbx,4), %r14
+.L793:
+	movq	%rbx, %rdi
+	movq	0(%rbp), %rsi
+	subq	%rcx, %rdi
+	leaq	-1(%rdi), %rax
+	cmpq	$3, %rax
+	jbe	.L817
+	leaq	0(,%rcx,4), %rax
+	leaq	(%rsi,%r14), %r8
+	leaq	(%rsi,%rax), %rdx
+	cmpq	%r8, %r12
+	jnb	.L802
+	leaq	4(%r12), %r8
+	cmpq	%r8, %rdx
+	jnb	.L802
+.L795:
+	addq	%rsi, %rax
+	leaq	(%rsi,%r14), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L800:
+	movl	(%r12), %ecx
+	addq	$4, %rax
+	movl	%ecx, -4(%rax)
+	cmpq	%rax, %rdx
+	jne	.L800
+.L794:
+	movq	%rbx, 16(%rbp)
+.L786:
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L790:
+	.cfi_restore_state
+	movq	24(%rbp), %rdi
+	leaq	0(,%rbx,4), %r14
+	movl	$4, %edx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	16(%rbp), %rcx
+	movq	%rbx, 8(%rbp)
+	movq	%rax, 0(%rbp)
+	testq	%rcx, %rcx
+	jne	.L818
+	testq	%r15, %r15
+	je	.L793
+	jmp	.L792
+	.p2align 4,,10
+	.p2align 3
+.L802:
+	movq	%rdx, %rax
+	movq	%rdi, %rdx
+	movd	(%r12), %xmm1
+	shrq	$2, %rdx
+	salq	$4, %rdx
+	pshufd	$0, %xmm1, %xmm0
+	addq	%rax, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L797:
+	movups	%xmm0, (%rax)
+	addq	$16, %rax
+	cmpq	%rdx, %rax
+	jne	.L797
+	movq	%rdi, %rax
+	andq	$-4, %rax
+	addq	%rcx, %rax
+	andl	$3, %edi
+	je	.L794
+	movl	(%r12), %edx
+	leaq	1(%rax), %rdi
+	leaq	0(,%rax,4), %rcx
+	movl	%edx, (%rsi,%rax,4)
+	cmpq	%rbx, %rdi
+	jnb	.L794
+	addq	$2, %rax
+	movl	%edx, 4(%rsi,%rcx)
+	cmpq	%rbx, %rax
+	jnb	.L794
+	movl	(%r12), %eax
+	movl	%eax, 8(%rsi,%rcx)
+	jmp	.L794
+	.p2align 4,,10
+	.p2align 3
+.L817:
+	leaq	0(,%rcx,4), %rax
+	jmp	.L795
+	.cfi_endproc
+.LFE7008:
+	.size	_ZN1n6vectorIiE6resizeEmRKi, .-_ZN1n6vectorIiE6resizeEmRKi
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC25:
+	.string	"expected equal : expected value : sum, actual value : 100000"
+	.section	.text.unlikely
+.LCOLDB27:
+	.text
+.LHOTB27:
+	.p2align 4
+	.globl	_Z22test_parallel_for_eachv
+	.type	_Z22test_parallel_for_eachv, @function
+_Z22test_parallel_for_eachv:
+.LFB6907:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6907
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$1064, %rsp
+	.cfi_def_cfa_offset 1120
+	leaq	128(%rsp), %rax
+	movq	%rax, %rdi
+	movq	%rax, 8(%rsp)
+.LEHB21:
+	call	_ZN1n11thread_poolC2Em.constprop.1
+.LEHE21:
+	pxor	%xmm0, %xmm0
+	movq	$0, 64(%rsp)
+	movups	%xmm0, 72(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rdi
+	testq	%rdi, %rdi
+	je	.L820
+	movq	72(%rsp), %rbp
+	movq	%rdi, 88(%rsp)
+	movl	$1, 96(%rsp)
+	cmpq	$99999, %rbp
+	jbe	.L904
+	movl	$100000, %esi
+	xorl	%ecx, %ecx
+	xorl	%ebx, %ebx
+.L822:
+	movq	%rsi, %rdx
+	leaq	(%rbx,%rcx,4), %rax
+	movdqa	.LC1(%rip), %xmm0
+	shrq	$2, %rdx
+	salq	$4, %rdx
+	addq	%rax, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L856:
+	movups	%xmm0, (%rax)
+	addq	$16, %rax
+	cmpq	%rax, %rdx
+	jne	.L856
+	testb	$3, %sil
+	je	.L826
+	andq	$-4, %rsi
+	addq	%rsi, %rcx
+.L855:
+	movl	$1, (%rbx,%rcx,4)
+	leaq	0(,%rcx,4), %rax
+	cmpq	$99999, %rcx
+	je	.L826
+	movl	$1, 4(%rbx,%rax)
+	cmpq	$99998, %rcx
+	je	.L826
+	movl	$1, 8(%rbx,%rax)
+.L826:
+	movl	$25, %eax
+	movl	$100000, %edx
+	leaq	96(%rsp), %r13
+	movq	$100000, 80(%rsp)
+	leaq	368(%rsp), %rcx
+	leaq	32(%rsp), %r12
+	movq	%rcx, (%rsp)
+.L851:
+	movq	%rdx, 48(%rsp)
+	movq	144(%rsp), %rdx
+	leaq	24(%rsp), %rcx
+	leaq	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_8for_eachIS2_NS_5sliceIKiEEZ22test_parallel_for_eachvEUliE_EEvRT_T0_OT1_EUlmE_EEvmOS9_EUlvE_EE(%rip), %r15
+	movq	%rcx, 32(%rsp)
+	leaq	376(%rsp), %r14
+	leaq	4(,%rdx,4), %rbp
+	movq	$0, 24(%rsp)
+	cmpq	%rax, %rbp
+	movq	$0, 376(%rsp)
+	cmova	%rax, %rbp
+	movl	$1, %eax
+	movq	%rbx, 40(%rsp)
+	movq	$0, 384(%rsp)
+	movq	$0, 392(%rsp)
+	testq	%rbp, %rbp
+	cmove	%rax, %rbp
+	leaq	48(%rsp), %rax
+	xorl	%ebx, %ebx
+	xorl	%edx, %edx
+	movq	%rax, %xmm0
+	leaq	56(%rsp), %rax
+	movq	%rax, %xmm1
+	leaq	40(%rsp), %rax
+	movq	%rbp, 56(%rsp)
+	punpcklqdq	%xmm1, %xmm0
+	movq	%rax, %xmm2
+	movq	8(%rsp), %rax
+	movaps	%xmm0, 96(%rsp)
+	movq	%r12, %xmm0
+	leaq	384(%rsp), %r12
+	movq	%r12, 1040(%rsp)
+	punpcklqdq	%xmm2, %xmm0
+	movq	%rax, 368(%rsp)
+	movq	%r12, %rax
+	movaps	%xmm0, 112(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L860:
+	leaq	1(%rdx), %rcx
+	leaq	(%rdx,%rdx,4), %rdx
+	salq	$4, %rdx
+	movq	%rcx, 8(%rax)
+	leaq	16(%rax,%rdx), %rsi
+	movq	$0, 56(%rsi)
+	movq	%r13, (%rsi)
+	movq	%rbx, 8(%rsi)
+	movq	%r15, 48(%rsi)
+	movq	%r14, 64(%rsi)
+	lock addq	$1, 376(%rsp)
+	movq	368(%rsp), %rdi
+.LEHB22:
+	call	_ZN1n11thread_pool6__pushEPNS_11__task_nodeE
+	addq	$1, %rbx
+	cmpq	%rbx, %rbp
+	je	.L865
+	movq	1040(%rsp), %rax
+	movq	8(%rax), %rdx
+	cmpq	$8, %rdx
+	jne	.L860
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	je	.L994
+.L861:
+	movq	%rax, 1040(%rsp)
+	movq	8(%rax), %rdx
+	jmp	.L860
+	.p2align 4,,10
+	.p2align 3
+.L865:
+	movq	(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	_ZN1n10task_group4syncEv
+.LEHE22:
+	movq	%rbx, %rdi
+	movq	%r12, %r13
+	call	_ZN1n10task_group4syncEv
+	.p2align 4,,10
+	.p2align 3
+.L878:
+	movq	%r13, %rbp
+	xorl	%r14d, %r14d
+	movq	0(%r13), %r13
+	movq	8(%rbp), %rbx
+	leaq	16(%rbp), %r15
+	testq	%rbx, %rbx
+	je	.L873
+	.p2align 4,,10
+	.p2align 3
+.L874:
+	movq	48(%r15), %rdx
+	testq	%rdx, %rdx
+	je	.L871
+	addq	$1, %r14
+	movq	56(%r15), %rsi
+	movq	%r15, %rdi
+	addq	$80, %r15
+	call	*16(%rdx)
+	cmpq	%r14, %rbx
+	jne	.L874
+.L873:
+	cmpq	%r12, %rbp
+	je	.L870
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L995
+.L876:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %ecx
+	movl	$656, %edx
+	movq	%rbp, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L870:
+	testq	%r13, %r13
+	jne	.L878
+	cmpq	$100000, 24(%rsp)
+	jne	.L996
+	movq	64(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L883
+	movq	72(%rsp), %rax
+	movq	88(%rsp), %rdi
+	movl	$4, %ecx
+	leaq	0(,%rax,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L883:
+	leaq	248(%rsp), %rbx
+	movq	%rbx, %rdi
+	movq	%rbx, (%rsp)
+	call	pthread_mutex_lock@PLT
+	movb	$1, 352(%rsp)
+	lock addq	$1, 336(%rsp)
+	leaq	288(%rsp), %rax
+	movq	%rax, %rdi
+	movq	%rax, 8(%rsp)
+	call	pthread_cond_broadcast@PLT
+	movq	%rbx, %rdi
+	xorl	%ebx, %ebx
+	call	pthread_mutex_unlock@PLT
+	cmpq	$0, 144(%rsp)
+	je	.L887
+	.p2align 4,,10
+	.p2align 3
+.L884:
+	movq	128(%rsp), %rax
+	xorl	%esi, %esi
+	movq	(%rax,%rbx,8), %rax
+	addq	$1, %rbx
+	movq	24(%rax), %rdi
+	call	pthread_join@PLT
+	movq	144(%rsp), %rax
+	cmpq	%rax, %rbx
+	jb	.L884
+	testq	%rax, %rax
+	je	.L887
+	xorl	%ebp, %ebp
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %r13
+	.p2align 4,,10
+	.p2align 3
+.L901:
+	movq	128(%rsp), %rax
+	movq	(%rax,%rbp,8), %r15
+	movq	136(%r15), %r14
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L997
+.L889:
+	movq	(%r14), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%r14, %rsi
+	movl	$8, %ecx
+	xorl	%r14d, %r14d
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	$0, 160(%r15)
+	jne	.L891
+	jmp	.L897
+	.p2align 4,,10
+	.p2align 3
+.L895:
+	movq	(%r12), %rax
+	movl	$8, %ecx
+	movq	%r12, %rsi
+	addq	$1, %r14
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	160(%r15), %r14
+	jnb	.L897
+.L891:
+	movq	144(%r15), %rax
+	movq	(%rax,%r14,8), %r12
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L895
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L895
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%r13, _ZZN1n4heapEvE7storage(%rip)
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L895
+	.p2align 4,,10
+	.p2align 3
+.L871:
+	addq	$1, %r14
+	addq	$80, %r15
+	cmpq	%r14, %rbx
+	jne	.L874
+	jmp	.L873
+	.p2align 4,,10
+	.p2align 3
+.L897:
+	movq	144(%r15), %rsi
+	testq	%rsi, %rsi
+	je	.L893
+	movq	152(%r15), %rax
+	movq	168(%r15), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L893:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L998
+.L899:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$64, %ecx
+	movl	$192, %edx
+	movq	%r15, %rsi
+	addq	$1, %rbp
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	144(%rsp), %rbp
+	jb	.L901
+.L887:
+	movq	8(%rsp), %rdi
+	call	pthread_cond_destroy@PLT
+	movq	(%rsp), %rdi
+	call	pthread_mutex_destroy@PLT
+	leaq	160(%rsp), %rdi
+	call	pthread_mutex_destroy@PLT
+	movq	200(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L886
+	movq	208(%rsp), %rax
+	movq	224(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L886:
+	movq	128(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L819
+	movq	136(%rsp), %rax
+	movq	152(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L819:
+	addq	$1064, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L998:
+	.cfi_restore_state
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L899
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L899
+	.p2align 4,,10
+	.p2align 3
+.L997:
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L889
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L889
+	.p2align 4,,10
+	.p2align 3
+.L995:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L876
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L876
+.L994:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L999
+.L863:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %edx
+	movl	$656, %esi
+	movq	(%rdi), %rax
+.LEHB23:
+	call	*16(%rax)
+.LEHE23:
+	movq	%rax, %rdx
+	movl	$82, %ecx
+	xorl	%eax, %eax
+	movq	%rdx, %rdi
+	rep stosq
+	movq	1040(%rsp), %rax
+	movq	%rdx, (%rax)
+	movq	1040(%rsp), %rax
+	movq	(%rax), %rax
+	jmp	.L861
+.L904:
+	xorl	%ebx, %ebx
+.L821:
+	movq	(%rdi), %rax
+	movl	$4, %edx
+	movl	$400000, %esi
+.LEHB24:
+	call	*16(%rax)
+	movq	80(%rsp), %rcx
+	movq	%rax, 64(%rsp)
+	movq	%rax, %rdi
+	movq	$100000, 72(%rsp)
+	testq	%rcx, %rcx
+	jne	.L1000
+	testq	%rbx, %rbx
+	jne	.L853
+	movq	%rax, %rbx
+	movl	$100000, %esi
+	jmp	.L822
+.L820:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1001
+.L824:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	80(%rsp), %rcx
+	movl	$1, 96(%rsp)
+	movq	64(%rsp), %rbx
+	movq	%rdi, 88(%rsp)
+	cmpq	$100000, %rcx
+	ja	.L826
+	movq	72(%rsp), %rbp
+	cmpq	$99999, %rbp
+	ja	.L827
+	leaq	96(%rsp), %r13
+	cmpq	%rbx, %r13
+	jb	.L821
+	leaq	(%rbx,%rcx,4), %rax
+	cmpq	%rax, %r13
+	jnb	.L821
+	leaq	20(%rsp), %rdx
+	movl	$1, 20(%rsp)
+	cmpq	%rax, %rdx
+	jnb	.L828
+	cmpq	%rbx, %rdx
+	jnb	.L1002
+.L828:
+	movq	(%rdi), %rax
+	movl	$4, %edx
+	movl	$400000, %esi
+	call	*16(%rax)
+	movq	%rax, 64(%rsp)
+	movq	%rax, %rdi
+	movq	80(%rsp), %rax
+	movq	$100000, 72(%rsp)
+	testq	%rax, %rax
+	jne	.L1003
+	testq	%rbx, %rbx
+	jne	.L842
+	movq	%rdi, %rbx
+	movl	$100000, %ecx
+.L843:
+	movq	%rcx, %rsi
+	leaq	(%rbx,%rax,4), %rdx
+	movdqa	.LC1(%rip), %xmm0
+	shrq	$2, %rsi
+	salq	$4, %rsi
+	addq	%rdx, %rsi
+.L846:
+	movups	%xmm0, (%rdx)
+	addq	$16, %rdx
+	cmpq	%rdx, %rsi
+	jne	.L846
+	movq	%rcx, %rdx
+	andq	$-4, %rdx
+	addq	%rdx, %rax
+	andl	$3, %ecx
+	je	.L848
+.L845:
+	movl	$1, (%rbx,%rax,4)
+	leaq	0(,%rax,4), %rdx
+	cmpq	$99999, %rax
+	je	.L848
+	movl	$1, 4(%rbx,%rdx)
+	cmpq	$99998, %rax
+	je	.L848
+	movl	$1, 8(%rbx,%rdx)
+.L848:
+	movl	$25, %eax
+	movl	$100000, %edx
+	leaq	32(%rsp), %r12
+	movq	$100000, 80(%rsp)
+	leaq	368(%rsp), %rcx
+	movq	%rcx, (%rsp)
+	jmp	.L851
+.L999:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	testl	%eax, %eax
+	je	.L863
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L863
+.L1000:
+	leaq	0(,%rcx,4), %rdx
+	movq	%rbx, %rsi
+	call	memcpy@PLT
+.L853:
+	movq	88(%rsp), %rdi
+	leaq	0(,%rbp,4), %rdx
+	movl	$4, %ecx
+	movq	%rbx, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	80(%rsp), %rcx
+	movq	64(%rsp), %rbx
+.L827:
+	cmpq	$99999, %rcx
+	ja	.L826
+	movl	$99999, %eax
+	subq	%rcx, %rax
+	cmpq	$2, %rax
+	jbe	.L855
+	movl	$100000, %esi
+	subq	%rcx, %rsi
+	jmp	.L822
+	.p2align 4,,10
+	.p2align 3
+.L1001:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L824
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L824
+.L1003:
+	leaq	0(,%rax,4), %rdx
+	movq	%rbx, %rsi
+	call	memcpy@PLT
+.L842:
+	movq	88(%rsp), %rdi
+	leaq	0(,%rbp,4), %rdx
+	movl	$4, %ecx
+	movq	%rbx, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	80(%rsp), %rax
+	movq	64(%rsp), %rbx
+	cmpq	$99999, %rax
+	ja	.L848
+	movl	$99999, %edx
+	movl	$100000, %ecx
+	subq	%rax, %rdx
+	subq	%rax, %rcx
+	cmpq	$2, %rdx
+	ja	.L843
+	jmp	.L845
+.L1002:
+	leaq	32(%rsp), %r12
+	movl	$1, 32(%rsp)
+	cmpq	%rax, %r12
+	jnb	.L829
+	cmpq	%rbx, %r12
+	jnb	.L1004
+.L829:
+	movq	(%rdi), %rax
+	movl	$4, %edx
+	movl	$400000, %esi
+	call	*16(%rax)
+	movq	%rax, 64(%rsp)
+	movq	%rax, %rdi
+	movq	80(%rsp), %rax
+	movq	$100000, 72(%rsp)
+	testq	%rax, %rax
+	jne	.L1005
+	testq	%rbx, %rbx
+	jne	.L832
+	xorl	%eax, %eax
+	movq	%rdi, %rbx
+.L834:
+	movl	$99999, %ecx
+	movl	$100000, %edx
+	subq	%rax, %rcx
+	subq	%rax, %rdx
+	cmpq	$2, %rcx
+	jbe	.L835
+	movq	%rdx, %rcx
+	leaq	(%rbx,%rax,4), %rsi
+	movdqa	.LC1(%rip), %xmm0
+	shrq	$2, %rcx
+	salq	$4, %rcx
+	addq	%rsi, %rcx
+.L836:
+	movups	%xmm0, (%rsi)
+	addq	$16, %rsi
+	cmpq	%rcx, %rsi
+	jne	.L836
+	movq	%rdx, %rcx
+	andq	$-4, %rcx
+	addq	%rcx, %rax
+	andl	$3, %edx
+	je	.L838
+.L835:
+	movl	$1, (%rbx,%rax,4)
+	leaq	0(,%rax,4), %rdx
+	cmpq	$99999, %rax
+	je	.L838
+	movl	$1, 4(%rbx,%rdx)
+	cmpq	$99998, %rax
+	je	.L838
+	movl	$1, 8(%rbx,%rdx)
+.L838:
+	leaq	368(%rsp), %rcx
+	movl	$25, %eax
+	movl	$100000, %edx
+	movq	$100000, 80(%rsp)
+	movq	%rcx, (%rsp)
+	jmp	.L851
+.L1004:
+	leaq	368(%rsp), %rax
+	leaq	64(%rsp), %rdi
+	movl	$100000, %esi
+	movl	$1, 368(%rsp)
+	movq	%rax, %rdx
+	movq	%rax, (%rsp)
+	call	_ZN1n6vectorIiE6resizeEmRKi
+	movq	80(%rsp), %rdx
+	movq	64(%rsp), %rbx
+	leaq	4095(%rdx), %rax
+	shrq	$12, %rax
+	jmp	.L851
+.L1005:
+	leaq	0(,%rax,4), %rdx
+	movq	%rbx, %rsi
+	call	memcpy@PLT
+.L832:
+	movq	88(%rsp), %rdi
+	leaq	0(,%rbp,4), %rdx
+	movl	$4, %ecx
+	movq	%rbx, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE24:
+	movq	80(%rsp), %rax
+	movq	64(%rsp), %rbx
+	cmpq	$99999, %rax
+	jbe	.L834
+	jmp	.L838
+.L996:
+	jmp	.L879
+.L990:
+	jmp	.L991
+.L910:
+	movq	%rax, %rbx
+	jmp	.L881
+	.section	.gcc_except_table
+.LLSDA6907:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6907-.LLSDACSB6907
+.LLSDACSB6907:
+	.uleb128 .LEHB21-.LFB6907
+	.uleb128 .LEHE21-.LEHB21
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB22-.LFB6907
+	.uleb128 .LEHE22-.LEHB22
+	.uleb128 .L910-.LFB6907
+	.uleb128 0
+	.uleb128 .LEHB23-.LFB6907
+	.uleb128 .LEHE23-.LEHB23
+	.uleb128 .L910-.LFB6907
+	.uleb128 0
+	.uleb128 .LEHB24-.LFB6907
+	.uleb128 .LEHE24-.LEHB24
+	.uleb128 .L990-.LFB6907
+	.uleb128 0
+.LLSDACSE6907:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6907
+	.type	_Z22test_parallel_for_eachv.cold, @function
+_Z22test_parallel_for_eachv.cold:
+.LFSB6907:
+.L879:
+	.cfi_def_cfa_offset 1120
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC25(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB25:
+	call	__cxa_throw@PLT
+.LEHE25:
+.L909:
+.L991:
+	movq	%rax, %rbx
+	jmp	.L882
+.L881:
+	movq	(%rsp), %rdi
+	call	_ZN1n10task_groupD1Ev
+.L882:
+	movq	64(%rsp), %rsi
+	movq	72(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L903
+	movq	88(%rsp), %rdi
+	salq	$2, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L903:
+	movq	8(%rsp), %rdi
+	call	_ZN1n11thread_poolD1Ev
+	movq	%rbx, %rdi
+.LEHB26:
+	call	_Unwind_Resume@PLT
+.LEHE26:
+	.cfi_endproc
+.LFE6907:
+	.section	.gcc_except_table
+.LLSDAC6907:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6907-.LLSDACSBC6907
+.LLSDACSBC6907:
+	.uleb128 .LEHB25-.LCOLDB27
+	.uleb128 .LEHE25-.LEHB25
+	.uleb128 .L909-.LCOLDB27
+	.uleb128 0
+	.uleb128 .LEHB26-.LCOLDB27
+	.uleb128 .LEHE26-.LEHB26
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6907:
+	.section	.text.unlikely
+	.text
+	.size	_Z22test_parallel_for_eachv, .-_Z22test_parallel_for_eachv
+	.section	.text.unlikely
+	.size	_Z22test_parallel_for_eachv.cold, .-_Z22test_parallel_for_eachv.cold
+.LCOLDE27:
+	.text
+.LHOTE27:
+	.section	.text._ZN1n6vectorIxE6resizeEmRKx,"axG",@progbits,_ZN1n6vectorIxE6resizeEmRKx,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n6vectorIxE6resizeEmRKx
+	.type	_ZN1n6vectorIxE6resizeEmRKx, @function
+_ZN1n6vectorIxE6resizeEmRKx:
+.LFB7090:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	16(%rdi), %rsi
+	cmpq	%rsi, %r12
+	jb	.L1014
+	movq	8(%rdi), %r13
+	movq	%rdx, %rbx
+	cmpq	%r12, %r13
+	jnb	.L1009
+	movq	(%rdi), %r15
+	cmpq	%r15, %rdx
+	jb	.L1010
+	leaq	(%r15,%rsi,8), %rax
+	cmpq	%rax, %rdx
+	jnb	.L1010
+	movq	(%rdx), %rax
+	movq	%r12, %rsi
+	leaq	8(%rsp), %rdx
+	movq	%rax, 8(%rsp)
+	call	_ZN1n6vectorIxE6resizeEmRKx
+	jmp	.L1006
+	.p2align 4,,10
+	.p2align 3
+.L1022:
+	movq	%rdx, %rax
+	movq	%rdi, %rdx
+	movq	(%rbx), %xmm0
+	shrq	%rdx
+	salq	$4, %rdx
+	punpcklqdq	%xmm0, %xmm0
+	addq	%rax, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L1017:
+	movups	%xmm0, (%rax)
+	addq	$16, %rax
+	cmpq	%rdx, %rax
+	jne	.L1017
+	movq	%rdi, %rdx
+	andq	$-2, %rdx
+	addq	%rsi, %rdx
+	andl	$1, %edi
+	je	.L1014
+	movq	(%rbx), %rax
+	movq	%rax, (%rcx,%rdx,8)
+.L1014:
+	movq	%r12, 16(%rbp)
+.L1006:
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1038:
+	.cfi_restore_state
+	leaq	0(,%rsi,8), %rdx
+	movq	%rax, %rdi
+	movq	%r15, %rsi
+	call	memcpy@PLT
+.L1012:
+	movq	24(%rbp), %rdi
+	movq	%r15, %rsi
+	movl	$8, %ecx
+	leaq	0(,%r13,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	16(%rbp), %rsi
+.L1009:
+	cmpq	%r12, %rsi
+	jnb	.L1014
+	leaq	0(,%r12,8), %r14
+.L1013:
+	movq	%r12, %rdi
+	movq	0(%rbp), %rcx
+	subq	%rsi, %rdi
+	leaq	-1(%rdi), %rax
+	cmpq	$2, %rax
+	jbe	.L1037
+	leaq	0(,%rsi,8), %rax
+	leaq	(%rcx,%r14), %r8
+	leaq	(%rcx,%rax), %rdx
+	cmpq	%r8, %rbx
+	jnb	.L1022
+	leaq	8(%rbx), %r8
+	cmpq	%r8, %rdx
+	jnb	.L1022
+.L1015:
+	addq	%rcx, %rax
+	addq	%r14, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L1020:
+	movq	(%rbx), %rdx
+	addq	$8, %rax
+	movq	%rdx, -8(%rax)
+	cmpq	%rax, %rcx
+	jne	.L1020
+	jmp	.L1014
+	.p2align 4,,10
+	.p2align 3
+.L1010:
+	movq	24(%rbp), %rdi
+	leaq	0(,%r12,8), %r14
+	movl	$8, %edx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	16(%rbp), %rsi
+	movq	%r12, 8(%rbp)
+	movq	%rax, 0(%rbp)
+	testq	%rsi, %rsi
+	jne	.L1038
+	testq	%r15, %r15
+	je	.L1013
+	jmp	.L1012
+	.p2align 4,,10
+	.p2align 3
+.L1037:
+	leaq	0(,%rsi,8), %rax
+	jmp	.L1015
+	.cfi_endproc
+.LFE7090:
+	.size	_ZN1n6vectorIxE6resizeEmRKx, .-_ZN1n6vectorIxE6resizeEmRKx
+	.section	.rodata.str1.8
+	.align 8
+.LC28:
+	.string	"expected equal : expected value : n::reduce(pool, v.iter(), 0LL, plus), actual value : expected"
+	.align 8
+.LC29:
+	.string	"expected equal : expected value : n::reduce(serial, v.iter(), 0LL, plus), actual value : expected"
+	.section	.text.unlikely
+.LCOLDB30:
+	.text
+.LHOTB30:
+	.p2align 4
+	.globl	_Z20test_parallel_reducev
+	.type	_Z20test_parallel_reducev, @function
+_Z20test_parallel_reducev:
+.LFB6910:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6910
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$1192, %rsp
+	.cfi_def_cfa_offset 1248
+	leaq	256(%rsp), %rax
+	movq	%rax, %rdi
+	movq	%rax, 32(%rsp)
+.LEHB27:
+	call	_ZN1n11thread_poolC2Em.constprop.1
+.LEHE27:
+	leaq	144(%rsp), %rdi
+.LEHB28:
+	call	_Z7numbersi.constprop.0
+.LEHE28:
+	movq	160(%rsp), %rcx
+	movq	144(%rsp), %rbx
+	movq	%rcx, 24(%rsp)
+	testq	%rcx, %rcx
+	je	.L1040
+	leaq	-1(%rcx), %rax
+	cmpq	$2, %rax
+	jbe	.L1178
+	shrq	$2, %rcx
+	pxor	%xmm0, %xmm0
+	pxor	%xmm4, %xmm4
+	movq	%rbx, %rax
+	movq	%rcx, %rdx
+	salq	$4, %rdx
+	addq	%rbx, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L1042:
+	movdqu	(%rax), %xmm2
+	movdqa	%xmm4, %xmm3
+	addq	$16, %rax
+	pcmpgtd	%xmm2, %xmm3
+	movdqa	%xmm2, %xmm1
+	punpckldq	%xmm3, %xmm1
+	punpckhdq	%xmm3, %xmm2
+	paddq	%xmm1, %xmm0
+	paddq	%xmm2, %xmm0
+	cmpq	%rdx, %rax
+	jne	.L1042
+	movdqa	%xmm0, %xmm1
+	movq	24(%rsp), %rax
+	psrldq	$8, %xmm1
+	paddq	%xmm1, %xmm0
+	movq	%xmm0, 16(%rsp)
+	testb	$3, %al
+	je	.L1043
+	andq	$-4, %rax
+.L1041:
+	movq	24(%rsp), %rdi
+	movslq	(%rbx,%rax,4), %rcx
+	leaq	0(,%rax,4), %rdx
+	addq	%rcx, 16(%rsp)
+	leaq	1(%rax), %rcx
+	movq	16(%rsp), %rsi
+	cmpq	%rdi, %rcx
+	jnb	.L1043
+	movslq	4(%rbx,%rdx), %rcx
+	addq	$2, %rax
+	addq	%rcx, %rsi
+	movq	%rsi, 16(%rsp)
+	movq	%rsi, %rcx
+	cmpq	%rdi, %rax
+	jnb	.L1043
+	movslq	8(%rbx,%rdx), %rax
+	addq	%rax, %rcx
+	movq	%rcx, 16(%rsp)
+.L1043:
+	movq	24(%rsp), %rax
+	movl	$1, %edx
+	pxor	%xmm0, %xmm0
+	movq	$0, 96(%rsp)
+	movq	%rbx, 104(%rsp)
+	movq	%rax, 112(%rsp)
+	addq	$4095, %rax
+	movq	%rax, 48(%rsp)
+	movq	%rax, %r12
+	movq	272(%rsp), %rax
+	shrq	$12, %r12
+	movups	%xmm0, 184(%rsp)
+	leaq	4(,%rax,4), %rax
+	movq	$0, 176(%rsp)
+	cmpq	%r12, %rax
+	cmova	%r12, %rax
+	testq	%rax, %rax
+	cmove	%rdx, %rax
+	movq	%rax, 136(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rdi
+	testq	%rdi, %rdi
+	je	.L1045
+	movq	184(%rsp), %rbp
+	movq	%rdi, 200(%rsp)
+	cmpq	%rax, %rbp
+	jb	.L1046
+	movq	%rax, %r13
+	xorl	%ecx, %ecx
+.L1047:
+	movq	%rax, %r9
+	movq	176(%rsp), %rdi
+	movq	96(%rsp), %r8
+	subq	%rcx, %r9
+	cmpq	$1, %r9
+	je	.L1079
+	movq	%r9, %rsi
+	movq	%r8, %xmm0
+	leaq	(%rdi,%rcx,8), %rdx
+	shrq	%rsi
+	punpcklqdq	%xmm0, %xmm0
+	salq	$4, %rsi
+	addq	%rdx, %rsi
+	.p2align 4,,10
+	.p2align 3
+.L1080:
+	movups	%xmm0, (%rdx)
+	addq	$16, %rdx
+	cmpq	%rdx, %rsi
+	jne	.L1080
+	testb	$1, %r9b
+	je	.L1051
+	andq	$-2, %r9
+	addq	%r9, %rcx
+.L1079:
+	movq	%r8, (%rdi,%rcx,8)
+.L1051:
+	movq	%rax, 192(%rsp)
+	leaq	496(%rsp), %rax
+	movq	%rax, 40(%rsp)
+	leaq	176(%rsp), %rax
+	movq	%rax, 56(%rsp)
+.L1075:
+	leaq	112(%rsp), %rax
+	leaq	512(%rsp), %r14
+	movq	$0, 504(%rsp)
+	movq	%rax, %xmm0
+	leaq	136(%rsp), %rax
+	movq	$0, 512(%rsp)
+	movq	%rax, 64(%rsp)
+	leaq	104(%rsp), %rax
+	movq	$0, 520(%rsp)
+	movq	%r14, 1168(%rsp)
+	movhps	64(%rsp), %xmm0
+	movaps	%xmm0, 208(%rsp)
+	movq	%rax, %xmm0
+	leaq	95(%rsp), %rax
+	movq	%rax, %xmm6
+	movq	56(%rsp), %rax
+	punpcklqdq	%xmm6, %xmm0
+	movq	%rax, 240(%rsp)
+	movq	32(%rsp), %rax
+	movaps	%xmm0, 224(%rsp)
+	movq	%rax, 496(%rsp)
+	testq	%r13, %r13
+	je	.L1084
+	leaq	504(%rsp), %rcx
+	xorl	%ebp, %ebp
+	xorl	%edx, %edx
+	movq	%r14, %rax
+	movq	%rcx, 8(%rsp)
+	leaq	208(%rsp), %r15
+	.p2align 4,,10
+	.p2align 3
+.L1083:
+	leaq	1(%rdx), %rcx
+	leaq	(%rdx,%rdx,4), %rdx
+	salq	$4, %rdx
+	movq	%rcx, 8(%rax)
+	leaq	16(%rax,%rdx), %rsi
+	leaq	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_6reduceIS2_NS_5sliceIKiEExZ20test_parallel_reducevEUlxiE_EET1_RT_T0_S9_T2_EUlmE_EEvmOSA_EUlvE_EE(%rip), %rax
+	movq	%rax, 48(%rsi)
+	movq	8(%rsp), %rax
+	movq	$0, 56(%rsi)
+	movq	%r15, (%rsi)
+	movq	%rbp, 8(%rsi)
+	movq	%rax, 64(%rsi)
+	lock addq	$1, 504(%rsp)
+	movq	496(%rsp), %rdi
+.LEHB29:
+	call	_ZN1n11thread_pool6__pushEPNS_11__task_nodeE
+	addq	$1, %rbp
+	cmpq	%r13, %rbp
+	je	.L1084
+	movq	1168(%rsp), %rax
+	movq	8(%rax), %rdx
+	cmpq	$8, %rdx
+	jne	.L1083
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	je	.L1322
+.L1085:
+	movq	%rax, 1168(%rsp)
+	movq	8(%rax), %rdx
+	jmp	.L1083
+.L1084:
+	movq	40(%rsp), %r15
+	movq	%r15, %rdi
+	call	_ZN1n10task_group4syncEv
+.LEHE29:
+	movq	%r15, %rdi
+	movq	%r14, %r13
+	call	_ZN1n10task_group4syncEv
+	movq	%r12, 8(%rsp)
+	movq	%rbx, 72(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1101:
+	movq	%r13, %r15
+	xorl	%ebx, %ebx
+	movq	0(%r13), %r13
+	movq	8(%r15), %rbp
+	leaq	16(%r15), %r12
+	testq	%rbp, %rbp
+	je	.L1096
+	.p2align 4,,10
+	.p2align 3
+.L1097:
+	movq	48(%r12), %rax
+	testq	%rax, %rax
+	je	.L1094
+	addq	$1, %rbx
+	movq	56(%r12), %rsi
+	movq	%r12, %rdi
+	addq	$80, %r12
+	call	*16(%rax)
+	cmpq	%rbx, %rbp
+	jne	.L1097
+.L1096:
+	cmpq	%r14, %r15
+	je	.L1093
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1323
+.L1099:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %ecx
+	movl	$656, %edx
+	movq	%r15, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1093:
+	testq	%r13, %r13
+	jne	.L1101
+	movq	136(%rsp), %rcx
+	movq	8(%rsp), %r12
+	movq	72(%rsp), %rbx
+	movq	176(%rsp), %rsi
+	movq	96(%rsp), %rbp
+	testq	%rcx, %rcx
+	je	.L1103
+	leaq	-1(%rcx), %rax
+	cmpq	$2, %rax
+	jbe	.L1183
+	movq	%rcx, %rdx
+	pxor	%xmm1, %xmm1
+	pxor	%xmm4, %xmm4
+	movq	%rsi, %rax
+	shrq	$2, %rdx
+	salq	$5, %rdx
+	addq	%rsi, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L1107:
+	movdqu	(%rax), %xmm0
+	movdqu	16(%rax), %xmm5
+	movdqa	%xmm4, %xmm3
+	addq	$32, %rax
+	shufps	$136, %xmm5, %xmm0
+	pcmpgtd	%xmm0, %xmm3
+	movdqa	%xmm0, %xmm2
+	punpckldq	%xmm3, %xmm2
+	punpckhdq	%xmm3, %xmm0
+	paddq	%xmm2, %xmm1
+	paddq	%xmm0, %xmm1
+	cmpq	%rdx, %rax
+	jne	.L1107
+	movdqa	%xmm1, %xmm0
+	psrldq	$8, %xmm0
+	paddq	%xmm0, %xmm1
+	movq	%xmm1, %rax
+	addq	%rax, %rbp
+	movq	%rcx, %rax
+	andq	$-4, %rax
+	testb	$3, %cl
+	je	.L1103
+.L1106:
+	movslq	(%rsi,%rax,8), %rdi
+	leaq	0(,%rax,8), %rdx
+	addq	%rdi, %rbp
+	leaq	1(%rax), %rdi
+	cmpq	%rcx, %rdi
+	jnb	.L1103
+	movslq	8(%rsi,%rdx), %rdi
+	addq	$2, %rax
+	addq	%rdi, %rbp
+	cmpq	%rcx, %rax
+	jnb	.L1103
+	movslq	16(%rsi,%rdx), %rax
+	addq	%rax, %rbp
+.L1103:
+	testq	%rsi, %rsi
+	je	.L1109
+	movq	184(%rsp), %rax
+	movq	200(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1109:
+	cmpq	%rbp, 16(%rsp)
+	jne	.L1324
+	movq	48(%rsp), %rax
+	movq	$0, 128(%rsp)
+	cmpq	$20479, %rax
+	ja	.L1184
+	cmpq	$4095, %rax
+	movl	$1, %eax
+	cmovbe	%rax, %r12
+.L1114:
+	movq	$0, 496(%rsp)
+	pxor	%xmm0, %xmm0
+	movups	%xmm0, 504(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rdi
+	testq	%rdi, %rdi
+	je	.L1115
+	movq	%rdi, 520(%rsp)
+	xorl	%r15d, %r15d
+.L1116:
+	movq	(%rdi), %rax
+	leaq	0(,%r12,8), %rsi
+	movl	$8, %edx
+.LEHB30:
+	call	*16(%rax)
+.LEHE30:
+	movq	%rax, 496(%rsp)
+	movq	%rax, %rdi
+	movq	512(%rsp), %rax
+	movq	%r12, 504(%rsp)
+	testq	%rax, %rax
+	jne	.L1325
+	testq	%r13, %r13
+	jne	.L1139
+	movq	128(%rsp), %r14
+	jmp	.L1321
+	.p2align 4,,10
+	.p2align 3
+.L1094:
+	addq	$1, %rbx
+	addq	$80, %r12
+	cmpq	%rbx, %rbp
+	jne	.L1097
+	jmp	.L1096
+	.p2align 4,,10
+	.p2align 3
+.L1323:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1099
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1099
+.L1322:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1326
+.L1087:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %edx
+	movl	$656, %esi
+	movq	(%rdi), %rax
+.LEHB31:
+	call	*16(%rax)
+.LEHE31:
+	movq	%rax, %rdx
+	movl	$82, %ecx
+	xorl	%eax, %eax
+	movq	%rdx, %rdi
+	rep stosq
+	movq	1168(%rsp), %rax
+	movq	%rdx, (%rax)
+	movq	1168(%rsp), %rax
+	movq	(%rax), %rax
+	jmp	.L1085
+.L1184:
+	movl	$4, %r12d
+	jmp	.L1114
+.L1046:
+	movq	%rax, %r13
+	xorl	%r14d, %r14d
+	leaq	96(%rsp), %rax
+	xorl	%ecx, %ecx
+.L1177:
+	leaq	(%r14,%rcx,8), %rdx
+	cmpq	%rdx, %rax
+	jnb	.L1053
+	movq	96(%rsp), %r15
+	leaq	120(%rsp), %rax
+	movq	%r15, 120(%rsp)
+	cmpq	%rdx, %rax
+	jnb	.L1054
+	cmpq	%r14, %rax
+	jnb	.L1327
+.L1054:
+	movq	(%rdi), %rax
+	leaq	0(,%r13,8), %rsi
+	movl	$8, %edx
+.LEHB32:
+	call	*16(%rax)
+.LEHE32:
+	movq	%rax, 176(%rsp)
+	movq	%rax, %rdi
+	movq	192(%rsp), %rax
+	movq	%r13, 184(%rsp)
+	testq	%rax, %rax
+	jne	.L1328
+	testq	%r14, %r14
+	jne	.L1068
+.L1069:
+	movq	%r13, %rdx
+	movq	176(%rsp), %rdi
+	subq	%rax, %rdx
+	cmpq	$1, %rdx
+	je	.L1070
+	movq	%rdx, %rcx
+	movq	%r15, %xmm0
+	leaq	(%rdi,%rax,8), %rsi
+	shrq	%rcx
+	punpcklqdq	%xmm0, %xmm0
+	salq	$4, %rcx
+	addq	%rsi, %rcx
+.L1071:
+	movups	%xmm0, (%rsi)
+	addq	$16, %rsi
+	cmpq	%rcx, %rsi
+	jne	.L1071
+	testb	$1, %dl
+	je	.L1073
+	andq	$-2, %rdx
+	addq	%rdx, %rax
+.L1070:
+	movq	%r15, (%rdi,%rax,8)
+.L1073:
+	leaq	496(%rsp), %rax
+	movq	%r13, 192(%rsp)
+	movq	%rax, 40(%rsp)
+	leaq	176(%rsp), %rax
+	movq	%rax, 56(%rsp)
+.L1066:
+	movq	136(%rsp), %r13
+	jmp	.L1075
+.L1325:
+	leaq	0(,%rax,8), %rdx
+	movq	%r13, %rsi
+	call	memcpy@PLT
+.L1139:
+	movq	520(%rsp), %rdi
+	leaq	0(,%r15,8), %rdx
+	movl	$8, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+.LEHB33:
+	call	*24(%rax)
+.LEHE33:
+	movq	512(%rsp), %rax
+	movq	496(%rsp), %r13
+	movq	504(%rsp), %r15
+.L1121:
+	movq	128(%rsp), %r14
+	cmpq	%r12, %rax
+	jnb	.L1143
+.L1140:
+	leaq	1(%rax), %rcx
+	movq	%r14, 0(%r13,%rax,8)
+	leaq	0(,%rax,8), %rdx
+	cmpq	%r12, %rcx
+	jnb	.L1143
+	leaq	2(%rax), %rcx
+	movq	%r14, 8(%r13,%rdx)
+	cmpq	%r12, %rcx
+	jnb	.L1143
+	cmpq	$1, %rax
+	movq	%r14, 16(%r13,%rdx)
+	sbbq	%rax, %rax
+	addq	$4, %rax
+	cmpq	%r12, %rax
+	jnb	.L1143
+	movq	%r14, 24(%r13,%rdx)
+.L1143:
+	movq	%r12, 512(%rsp)
+.L1144:
+	movq	24(%rsp), %rax
+	xorl	%edx, %edx
+	movq	%rbp, 8(%rsp)
+	xorl	%r11d, %r11d
+	xorl	%edi, %edi
+	pxor	%xmm4, %xmm4
+	divq	%r12
+	.p2align 4,,10
+	.p2align 3
+.L1137:
+	cmpq	%rdx, %rdi
+	movq	%rdx, %rbp
+	cmovbe	%rdi, %rbp
+	addq	$1, %rdi
+	movq	%rdi, %r10
+	addq	%r11, %rbp
+	addq	%rax, %r11
+	cmpq	%rdi, %rdx
+	cmovbe	%rdx, %r10
+	leaq	1(%rbp), %r8
+	movslq	(%rbx,%rbp,4), %r9
+	leaq	0(,%rbp,4), %rsi
+	addq	%r11, %r10
+	cmpq	%r10, %r8
+	jnb	.L1145
+	movq	%r10, %rcx
+	subq	%rbp, %rcx
+	leaq	-1(%rcx), %rbp
+	subq	$2, %rcx
+	cmpq	$2, %rcx
+	jbe	.L1146
+	leaq	4(%rbx,%rsi), %rcx
+	movq	%rbp, %rsi
+	pxor	%xmm0, %xmm0
+	shrq	$2, %rsi
+	salq	$4, %rsi
+	addq	%rcx, %rsi
+	.p2align 4,,10
+	.p2align 3
+.L1147:
+	movdqu	(%rcx), %xmm2
+	movdqa	%xmm4, %xmm3
+	addq	$16, %rcx
+	pcmpgtd	%xmm2, %xmm3
+	movdqa	%xmm2, %xmm1
+	punpckldq	%xmm3, %xmm1
+	punpckhdq	%xmm3, %xmm2
+	paddq	%xmm1, %xmm0
+	paddq	%xmm2, %xmm0
+	cmpq	%rsi, %rcx
+	jne	.L1147
+	movdqa	%xmm0, %xmm1
+	psrldq	$8, %xmm1
+	paddq	%xmm1, %xmm0
+	movq	%xmm0, %rcx
+	addq	%rcx, %r9
+	movq	%rbp, %rcx
+	andq	$-4, %rcx
+	addq	%rcx, %r8
+	andl	$3, %ebp
+	je	.L1145
+.L1146:
+	movslq	(%rbx,%r8,4), %rsi
+	leaq	0(,%r8,4), %rcx
+	addq	%rsi, %r9
+	leaq	1(%r8), %rsi
+	cmpq	%r10, %rsi
+	jnb	.L1145
+	movslq	4(%rbx,%rcx), %rsi
+	addq	$2, %r8
+	addq	%rsi, %r9
+	cmpq	%r10, %r8
+	jnb	.L1145
+	movslq	8(%rbx,%rcx), %rcx
+	addq	%rcx, %r9
+.L1145:
+	movq	%r9, -8(%r13,%rdi,8)
+	cmpq	%rdi, %r12
+	jne	.L1137
+	movslq	0(%r13), %rax
+	movq	8(%rsp), %rbp
+	addq	%rax, %r14
+	cmpq	$1, %r12
+	je	.L1150
+	movslq	8(%r13), %rax
+	addq	%rax, %r14
+	cmpq	$2, %r12
+	je	.L1150
+	movslq	16(%r13), %rax
+	addq	%rax, %r14
+	cmpq	$4, %r12
+	jne	.L1150
+	movslq	24(%r13), %rax
+	addq	%rax, %r14
+.L1150:
+	movq	520(%rsp), %rdi
+	movq	%r14, 128(%rsp)
+	movl	$8, %ecx
+	movq	%r13, %rsi
+	leaq	0(,%r15,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	152(%rsp), %rax
+	cmpq	%r14, %rbp
+	jne	.L1329
+.L1044:
+	testq	%rbx, %rbx
+	je	.L1155
+	movq	168(%rsp), %rdi
+	leaq	0(,%rax,4), %rdx
+	movl	$4, %ecx
+	movq	%rbx, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1155:
+	leaq	376(%rsp), %r14
+	movq	%r14, %rdi
+	call	pthread_mutex_lock@PLT
+	movb	$1, 480(%rsp)
+	lock addq	$1, 464(%rsp)
+	xorl	%ebx, %ebx
+	leaq	416(%rsp), %r15
+	movq	%r15, %rdi
+	call	pthread_cond_broadcast@PLT
+	movq	%r14, %rdi
+	call	pthread_mutex_unlock@PLT
+	cmpq	$0, 272(%rsp)
+	je	.L1159
+	.p2align 4,,10
+	.p2align 3
+.L1156:
+	movq	256(%rsp), %rax
+	xorl	%esi, %esi
+	movq	(%rax,%rbx,8), %rax
+	addq	$1, %rbx
+	movq	24(%rax), %rdi
+	call	pthread_join@PLT
+	movq	272(%rsp), %rax
+	cmpq	%rax, %rbx
+	jb	.L1156
+	testq	%rax, %rax
+	je	.L1159
+	movq	%r15, 8(%rsp)
+	xorl	%ebp, %ebp
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %r13
+	movq	%r14, 16(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1173:
+	movq	256(%rsp), %rax
+	movq	(%rax,%rbp,8), %r14
+	movq	136(%r14), %r12
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1330
+.L1161:
+	movq	(%r12), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%r12, %rsi
+	movl	$8, %ecx
+	xorl	%r12d, %r12d
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	$0, 160(%r14)
+	jne	.L1163
+	jmp	.L1169
+	.p2align 4,,10
+	.p2align 3
+.L1167:
+	movq	(%r15), %rax
+	movl	$8, %ecx
+	movq	%r15, %rsi
+	addq	$1, %r12
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	160(%r14), %r12
+	jnb	.L1169
+.L1163:
+	movq	144(%r14), %rax
+	movq	(%rax,%r12,8), %r15
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L1167
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1167
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%r13, _ZZN1n4heapEvE7storage(%rip)
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1167
+	.p2align 4,,10
+	.p2align 3
+.L1169:
+	movq	144(%r14), %rsi
+	testq	%rsi, %rsi
+	je	.L1165
+	movq	152(%r14), %rax
+	movq	168(%r14), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1165:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1331
+.L1171:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$64, %ecx
+	movl	$192, %edx
+	movq	%r14, %rsi
+	addq	$1, %rbp
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	272(%rsp), %rbp
+	jb	.L1173
+	movq	8(%rsp), %r15
+	movq	16(%rsp), %r14
+.L1159:
+	movq	%r15, %rdi
+	call	pthread_cond_destroy@PLT
+	movq	%r14, %rdi
+	call	pthread_mutex_destroy@PLT
+	leaq	288(%rsp), %rdi
+	call	pthread_mutex_destroy@PLT
+	movq	328(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L1158
+	movq	336(%rsp), %rax
+	movq	352(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1158:
+	movq	256(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L1039
+	movq	264(%rsp), %rax
+	movq	280(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1039:
+	addq	$1192, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1330:
+	.cfi_restore_state
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1161
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1161
+	.p2align 4,,10
+	.p2align 3
+.L1331:
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1171
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1171
+.L1045:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1332
+.L1049:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	136(%rsp), %r13
+	movq	192(%rsp), %rcx
+	movq	%rdi, 200(%rsp)
+	cmpq	%rcx, %r13
+	jb	.L1179
+	movq	184(%rsp), %rbp
+	cmpq	%r13, %rbp
+	jnb	.L1180
+	movq	176(%rsp), %r14
+	leaq	96(%rsp), %rax
+	cmpq	%r14, %rax
+	jnb	.L1177
+.L1053:
+	movq	(%rdi), %rax
+	leaq	0(,%r13,8), %rsi
+	movl	$8, %edx
+.LEHB34:
+	call	*16(%rax)
+.LEHE34:
+	movq	192(%rsp), %rcx
+	movq	%rax, 176(%rsp)
+	movq	%rax, %rdi
+	movq	%r13, 184(%rsp)
+	testq	%rcx, %rcx
+	jne	.L1333
+	testq	%r14, %r14
+	jne	.L1077
+	movq	%r13, %rax
+	movq	136(%rsp), %r13
+	jmp	.L1047
+.L1115:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1334
+.L1118:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	512(%rsp), %rax
+	movq	504(%rsp), %r15
+	movq	496(%rsp), %r13
+	movq	%rdi, 520(%rsp)
+	cmpq	%rax, %r12
+	jb	.L1120
+	cmpq	%r12, %r15
+	jnb	.L1121
+	leaq	128(%rsp), %rdx
+	cmpq	%r13, %rdx
+	jb	.L1116
+	leaq	0(%r13,%rax,8), %rax
+	cmpq	%rax, %rdx
+	jnb	.L1116
+	movq	128(%rsp), %r14
+	movq	64(%rsp), %rcx
+	movq	%r14, 136(%rsp)
+	cmpq	%rax, %rcx
+	jnb	.L1122
+	cmpq	%r13, %rcx
+	jnb	.L1335
+.L1122:
+	movq	(%rdi), %rax
+	leaq	0(,%r12,8), %rsi
+	movl	$8, %edx
+.LEHB35:
+	call	*16(%rax)
+.LEHE35:
+	movq	%rax, 496(%rsp)
+	movq	%rax, %rdi
+	movq	512(%rsp), %rax
+	movq	%r12, 504(%rsp)
+	testq	%rax, %rax
+	jne	.L1336
+	testq	%r13, %r13
+	jne	.L1133
+.L1321:
+	movq	%r12, %r15
+	movq	%rdi, %r13
+	jmp	.L1140
+.L1120:
+	movq	128(%rsp), %r14
+	jmp	.L1143
+.L1040:
+	movq	$0, 128(%rsp)
+	movq	152(%rsp), %rax
+	jmp	.L1044
+.L1333:
+	leaq	0(,%rcx,8), %rdx
+	movq	%r14, %rsi
+	call	memcpy@PLT
+.L1077:
+	movq	200(%rsp), %rdi
+	leaq	0(,%rbp,8), %rdx
+	movl	$8, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+.LEHB36:
+	call	*24(%rax)
+.LEHE36:
+	movq	192(%rsp), %rcx
+	movq	136(%rsp), %rdx
+.L1052:
+	cmpq	%r13, %rcx
+	movq	%r13, %rax
+	movq	%rdx, %r13
+	jb	.L1047
+	jmp	.L1051
+	.p2align 4,,10
+	.p2align 3
+.L1326:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	testl	%eax, %eax
+	je	.L1087
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1087
+.L1178:
+	movq	$0, 16(%rsp)
+	xorl	%eax, %eax
+	jmp	.L1041
+.L1183:
+	xorl	%eax, %eax
+	jmp	.L1106
+.L1179:
+	movq	%r13, %rax
+	jmp	.L1051
+.L1334:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1118
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r13, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1118
+.L1332:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1049
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1049
+.L1336:
+	leaq	0(,%rax,8), %rdx
+	movq	%r13, %rsi
+	call	memcpy@PLT
+.L1133:
+	movq	520(%rsp), %rdi
+	leaq	0(,%r15,8), %rdx
+	movl	$8, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+.LEHB37:
+	call	*24(%rax)
+.LEHE37:
+	movq	512(%rsp), %rax
+	movq	496(%rsp), %r13
+	movq	504(%rsp), %r15
+	cmpq	%r12, %rax
+	jb	.L1140
+	jmp	.L1143
+.L1328:
+	leaq	0(,%rax,8), %rdx
+	movq	%r14, %rsi
+	call	memcpy@PLT
+.L1068:
+	movq	200(%rsp), %rdi
+	leaq	0(,%rbp,8), %rdx
+	movl	$8, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+.LEHB38:
+	call	*24(%rax)
+	movq	192(%rsp), %rax
+	cmpq	%r13, %rax
+	jb	.L1069
+	jmp	.L1073
+.L1327:
+	leaq	128(%rsp), %rax
+	movq	%r15, 128(%rsp)
+	cmpq	%rdx, %rax
+	jnb	.L1055
+	cmpq	%r14, %rax
+	jnb	.L1337
+.L1055:
+	movq	(%rdi), %rax
+	leaq	0(,%r13,8), %rsi
+	movl	$8, %edx
+	call	*16(%rax)
+.LEHE38:
+	movq	%rax, 176(%rsp)
+	movq	%rax, %rdi
+	movq	192(%rsp), %rax
+	movq	%r13, 184(%rsp)
+	testq	%rax, %rax
+	jne	.L1338
+	testq	%r14, %r14
+	jne	.L1058
+.L1059:
+	movq	%rax, %rcx
+	cmpq	%r13, %rax
+	jnb	.L1073
+	movq	%r13, %rdx
+	movq	176(%rsp), %rdi
+	subq	%rax, %rdx
+	cmpq	$1, %rdx
+	je	.L1061
+	movq	%rdx, %rcx
+	movq	%r15, %xmm0
+	leaq	(%rdi,%rax,8), %rsi
+	shrq	%rcx
+	punpcklqdq	%xmm0, %xmm0
+	salq	$4, %rcx
+	addq	%rsi, %rcx
+.L1062:
+	movups	%xmm0, (%rsi)
+	addq	$16, %rsi
+	cmpq	%rcx, %rsi
+	jne	.L1062
+	testb	$1, %dl
+	je	.L1073
+	andq	$-2, %rdx
+	leaq	(%rax,%rdx), %rcx
+.L1061:
+	movq	%r15, (%rdi,%rcx,8)
+	jmp	.L1073
+.L1335:
+	movq	56(%rsp), %rcx
+	movq	%r14, 176(%rsp)
+	cmpq	%r13, %rcx
+	jb	.L1123
+	cmpq	%rax, %rcx
+	jb	.L1339
+.L1123:
+	movq	(%rdi), %rax
+	leaq	0(,%r12,8), %rsi
+	movl	$8, %edx
+.LEHB39:
+	call	*16(%rax)
+	movq	%rax, 496(%rsp)
+	movq	%rax, %rdi
+	movq	512(%rsp), %rax
+	movq	%r12, 504(%rsp)
+	testq	%rax, %rax
+	jne	.L1340
+	testq	%r13, %r13
+	jne	.L1126
+	xorl	%eax, %eax
+	movq	%rdi, %r13
+.L1128:
+	leaq	1(%rax), %rcx
+	movq	%r14, 0(%r13,%rax,8)
+	leaq	0(,%rax,8), %rdx
+	cmpq	%r12, %rcx
+	jnb	.L1130
+	leaq	2(%rax), %rcx
+	movq	%r14, 8(%r13,%rdx)
+	cmpq	%r12, %rcx
+	jnb	.L1130
+	cmpq	$1, %rax
+	movq	%r14, 16(%r13,%rdx)
+	sbbq	%rax, %rax
+	addq	$4, %rax
+	cmpq	%r12, %rax
+	jnb	.L1130
+	movq	%r14, 24(%r13,%rdx)
+.L1130:
+	movq	%r12, 512(%rsp)
+.L1124:
+	movq	504(%rsp), %r15
+	jmp	.L1144
+.L1340:
+	leaq	0(,%rax,8), %rdx
+	movq	%r13, %rsi
+	call	memcpy@PLT
+.L1126:
+	movq	520(%rsp), %rdi
+	leaq	0(,%r15,8), %rdx
+	movl	$8, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE39:
+	movq	512(%rsp), %rax
+	movq	496(%rsp), %r13
+	cmpq	%r12, %rax
+	jb	.L1128
+	jmp	.L1130
+.L1338:
+	leaq	0(,%rax,8), %rdx
+	movq	%r14, %rsi
+	call	memcpy@PLT
+.L1058:
+	movq	200(%rsp), %rdi
+	leaq	0(,%rbp,8), %rdx
+	movl	$8, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+.LEHB40:
+	call	*24(%rax)
+.LEHE40:
+	movq	192(%rsp), %rax
+	jmp	.L1059
+.L1339:
+	movq	40(%rsp), %rdi
+	leaq	208(%rsp), %rdx
+	movq	%r12, %rsi
+	movq	%r14, 208(%rsp)
+.LEHB41:
+	call	_ZN1n6vectorIxE6resizeEmRKx
+.LEHE41:
+	movq	496(%rsp), %r13
+	jmp	.L1124
+.L1337:
+	leaq	176(%rsp), %rax
+	leaq	496(%rsp), %rdx
+	movq	%r13, %rsi
+	movq	%r15, 496(%rsp)
+	movq	%rax, %rdi
+	movq	%rdx, 40(%rsp)
+	movq	%rax, 56(%rsp)
+.LEHB42:
+	call	_ZN1n6vectorIxE6resizeEmRKx
+.LEHE42:
+	jmp	.L1066
+.L1180:
+	movq	%r13, %rdx
+	jmp	.L1052
+.L1192:
+	movq	%rax, %rbp
+	jmp	.L1105
+.L1329:
+	jmp	.L1152
+.L1194:
+	movq	%rax, %rbp
+	jmp	.L1153
+.L1324:
+	jmp	.L1110
+.L1190:
+	movq	%rax, %rbp
+	jmp	.L1176
+.L1193:
+	movq	%rax, %rbp
+	jmp	.L1104
+	.section	.gcc_except_table
+.LLSDA6910:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6910-.LLSDACSB6910
+.LLSDACSB6910:
+	.uleb128 .LEHB27-.LFB6910
+	.uleb128 .LEHE27-.LEHB27
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB28-.LFB6910
+	.uleb128 .LEHE28-.LEHB28
+	.uleb128 .L1190-.LFB6910
+	.uleb128 0
+	.uleb128 .LEHB29-.LFB6910
+	.uleb128 .LEHE29-.LEHB29
+	.uleb128 .L1193-.LFB6910
+	.uleb128 0
+	.uleb128 .LEHB30-.LFB6910
+	.uleb128 .LEHE30-.LEHB30
+	.uleb128 .L1194-.LFB6910
+	.uleb128 0
+	.uleb128 .LEHB31-.LFB6910
+	.uleb128 .LEHE31-.LEHB31
+	.uleb128 .L1193-.LFB6910
+	.uleb128 0
+	.uleb128 .LEHB32-.LFB6910
+	.uleb128 .LEHE32-.LEHB32
+	.uleb128 .L1192-.LFB6910
+	.uleb128 0
+	.uleb128 .LEHB33-.LFB6910
+	.uleb128 .LEHE33-.LEHB33
+	.uleb128 .L1194-.LFB6910
+	.uleb128 0
+	.uleb128 .LEHB34-.LFB6910
+	.uleb128 .LEHE34-.LEHB34
+	.uleb128 .L1192-.LFB6910
+	.uleb128 0
+	.uleb128 .LEHB35-.LFB6910
+	.uleb128 .LEHE35-.LEHB35
+	.uleb128 .L1194-.LFB6910
+	.uleb128 0
+	.uleb128 .LEHB36-.LFB6910
+	.uleb128 .LEHE36-.LEHB36
+	.uleb128 .L1192-.LFB6910
+	.uleb128 0
+	.uleb128 .LEHB37-.LFB6910
+	.uleb128 .LEHE37-.LEHB37
+	.uleb128 .L1194-.LFB6910
+	.uleb128 0
+	.uleb128 .LEHB38-.LFB6910
+	.uleb128 .LEHE38-.LEHB38
+	.uleb128 .L1192-.LFB6910
+	.uleb128 0
+	.uleb128 .LEHB39-.LFB6910
+	.uleb128 .LEHE39-.LEHB39
+	.uleb128 .L1194-.LFB6910
+	.uleb128 0
+	.uleb128 .LEHB40-.LFB6910
+	.uleb128 .LEHE40-.LEHB40
+	.uleb128 .L1192-.LFB6910
+	.uleb128 0
+	.uleb128 .LEHB41-.LFB6910
+	.uleb128 .LEHE41-.LEHB41
+	.uleb128 .L1194-.LFB6910
+	.uleb128 0
+	.uleb128 .LEHB42-.LFB6910
+	.uleb128 .LEHE42-.LEHB42
+	.uleb128 .L1192-.LFB6910
+	.uleb128 0
+.LLSDACSE6910:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6910
+	.type	_Z20test_parallel_reducev.cold, @function
+_Z20test_parallel_reducev.cold:
+.LFSB6910:
+.L1104:
+	.cfi_def_cfa_offset 1248
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	40(%rsp), %rdi
+	call	_ZN1n10task_groupD1Ev
+.L1105:
+	movq	176(%rsp), %rsi
+	movq	184(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L1113
+	movq	200(%rsp), %rdi
+	salq	$3, %rdx
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1113:
+	movq	152(%rsp), %rdx
+	testq	%rbx, %rbx
+	je	.L1176
+	movq	168(%rsp), %rdi
+	salq	$2, %rdx
+	movl	$4, %ecx
+	movq	%rbx, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1176:
+	movq	32(%rsp), %rdi
+	call	_ZN1n11thread_poolD1Ev
+	movq	%rbp, %rdi
+.LEHB43:
+	call	_Unwind_Resume@PLT
+.LEHE43:
+.L1152:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC29(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB44:
+	call	__cxa_throw@PLT
+.LEHE44:
+.L1191:
+	movq	%rax, %rbp
+	jmp	.L1113
+.L1153:
+	movq	496(%rsp), %rsi
+	movq	504(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L1113
+	movq	520(%rsp), %rdi
+	salq	$3, %rdx
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L1113
+.L1110:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC28(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB45:
+	call	__cxa_throw@PLT
+.LEHE45:
+	.cfi_endproc
+.LFE6910:
+	.section	.gcc_except_table
+.LLSDAC6910:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6910-.LLSDACSBC6910
+.LLSDACSBC6910:
+	.uleb128 .LEHB43-.LCOLDB30
+	.uleb128 .LEHE43-.LEHB43
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB44-.LCOLDB30
+	.uleb128 .LEHE44-.LEHB44
+	.uleb128 .L1191-.LCOLDB30
+	.uleb128 0
+	.uleb128 .LEHB45-.LCOLDB30
+	.uleb128 .LEHE45-.LEHB45
+	.uleb128 .L1191-.LCOLDB30
+	.uleb128 0
+.LLSDACSEC6910:
+	.section	.text.unlikely
+	.text
+	.size	_Z20test_parallel_reducev, .-_Z20test_parallel_reducev
+	.section	.text.unlikely
+	.size	_Z20test_parallel_reducev.cold, .-_Z20test_parallel_reducev.cold
+.LCOLDE30:
+	.text
+.LHOTE30:
+	.section	.text._ZN1n4sortINS_11thread_poolEiNS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceE,"axG",@progbits,_ZN1n4sortINS_11thread_poolEiNS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceE,comdat
+	.p2align 4
+	.weak	_ZN1n4sortINS_11thread_poolEiNS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceE
+	.type	_ZN1n4sortINS_11thread_poolEiNS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceE, @function
+_ZN1n4sortINS_11thread_poolEiNS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceE:
+.LFB7118:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7118
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdi, %rax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$952, %rsp
+	.cfi_def_cfa_offset 1008
+	movq	16(%rax), %rax
+	movq	%rdx, 104(%rsp)
+	addq	$4095, %rdx
+	shrq	$12, %rdx
+	leaq	4(,%rax,4), %rax
+	movq	%rdi, 80(%rsp)
+	movq	%rsi, %rdi
+	cmpq	%rdx, %rax
+	movq	%rcx, 112(%rsp)
+	cmova	%rdx, %rax
+	movl	$1, %edx
+	testq	%rax, %rax
+	cmovne	%rax, %rdx
+	cmpq	$1, %rax
+	jbe	.L1500
+	pxor	%xmm0, %xmm0
+	movq	%rsi, 144(%rsp)
+	movq	%rdx, %r15
+	movq	$0, 176(%rsp)
+	movups	%xmm0, 184(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L1501
+	xorl	%r14d, %r14d
+	xorl	%r13d, %r13d
+	xorl	%ecx, %ecx
+.L1346:
+	movq	%rax, 200(%rsp)
+	xorl	%edx, %edx
+	xorl	%r12d, %r12d
+	xorl	%ebx, %ebx
+	movq	104(%rsp), %rax
+	divq	%r15
+	movq	%rdx, 8(%rsp)
+	movq	%rax, (%rsp)
+	jmp	.L1355
+	.p2align 4,,10
+	.p2align 3
+.L1350:
+	movq	%rbp, (%r14,%rcx,8)
+.L1497:
+	movq	192(%rsp), %rcx
+.L1353:
+	movq	(%rsp), %rdi
+	addq	$1, %rcx
+	leaq	1(%rbx), %rax
+	movq	%rcx, 192(%rsp)
+	addq	%rdi, %r12
+	cmpq	%rbx, %r15
+	je	.L1354
+	movq	184(%rsp), %r13
+	movq	176(%rsp), %r14
+	movq	%rax, %rbx
+.L1355:
+	movq	8(%rsp), %rax
+	cmpq	%rbx, %rax
+	movq	%rax, %rbp
+	cmova	%rbx, %rbp
+	addq	%r12, %rbp
+	cmpq	%r13, %rcx
+	jne	.L1350
+	leaq	5(%r13), %rsi
+	movq	200(%rsp), %rdi
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 184(%rsp)
+	movq	(%rdi), %rax
+.LEHB46:
+	call	*16(%rax)
+	movq	192(%rsp), %rdx
+	movq	%rax, 176(%rsp)
+	movq	%rbp, (%rax,%rdx,8)
+	movq	192(%rsp), %rcx
+	testq	%rcx, %rcx
+	jne	.L1502
+	testq	%r14, %r14
+	je	.L1353
+.L1352:
+	movq	200(%rsp), %rdi
+	leaq	0(,%r13,8), %rdx
+	movl	$8, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE46:
+	jmp	.L1497
+.L1354:
+	leaq	176(%rsp), %rax
+	xorl	%ebx, %ebx
+	xorl	%edx, %edx
+	movq	$0, 264(%rsp)
+	movq	%rax, %rcx
+	movq	%rax, 16(%rsp)
+	leaq	144(%rsp), %rax
+	leaq	272(%rsp), %r13
+	movq	%rcx, %xmm0
+	leaq	208(%rsp), %rcx
+	movq	%rax, %xmm5
+	movq	$0, 272(%rsp)
+	leaq	143(%rsp), %rax
+	movq	%rcx, (%rsp)
+	punpcklqdq	%xmm5, %xmm0
+	leaq	264(%rsp), %rcx
+	movq	%rax, 88(%rsp)
+	leaq	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_iNS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE_EEvmOS6_EUlvE_EE(%rip), %rbp
+	leaq	256(%rsp), %r12
+	movq	%rax, 224(%rsp)
+	movq	80(%rsp), %rax
+	movq	$0, 280(%rsp)
+	movq	%r13, 928(%rsp)
+	movq	%r13, 40(%rsp)
+	movq	%rcx, 8(%rsp)
+	movq	%rax, 256(%rsp)
+	movq	%r13, %rax
+	movaps	%xmm0, 208(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1356:
+	leaq	1(%rdx), %rcx
+	leaq	(%rdx,%rdx,4), %rdx
+	salq	$4, %rdx
+	movq	%rcx, 8(%rax)
+	leaq	16(%rax,%rdx), %rsi
+	movq	(%rsp), %rax
+	movq	$0, 56(%rsi)
+	movq	%rax, (%rsi)
+	movq	8(%rsp), %rax
+	movq	%rbx, 8(%rsi)
+	movq	%rbp, 48(%rsi)
+	movq	%rax, 64(%rsi)
+	lock addq	$1, 264(%rsp)
+	movq	256(%rsp), %rdi
+	movq	%r12, 32(%rsp)
+.LEHB47:
+	call	_ZN1n11thread_pool6__pushEPNS_11__task_nodeE
+	addq	$1, %rbx
+	cmpq	%rbx, %r15
+	je	.L1361
+	movq	928(%rsp), %rax
+	movq	8(%rax), %rdx
+	cmpq	$8, %rdx
+	jne	.L1356
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	je	.L1503
+.L1357:
+	movq	%rax, 928(%rsp)
+	movq	8(%rax), %rdx
+	jmp	.L1356
+.L1361:
+	leaq	256(%rsp), %rax
+	movq	%rax, %rdi
+	movq	%rax, 32(%rsp)
+	movq	%rax, %rbx
+	call	_ZN1n10task_group4syncEv
+.LEHE47:
+	movq	%rbx, %rdi
+	movq	%r13, %r12
+	call	_ZN1n10task_group4syncEv
+	.p2align 4,,10
+	.p2align 3
+.L1374:
+	movq	%r12, %r15
+	xorl	%ebp, %ebp
+	movq	(%r12), %r12
+	movq	8(%r15), %r14
+	leaq	16(%r15), %rbx
+	testq	%r14, %r14
+	je	.L1369
+	.p2align 4,,10
+	.p2align 3
+.L1370:
+	movq	48(%rbx), %rax
+	testq	%rax, %rax
+	je	.L1367
+	addq	$1, %rbp
+	movq	56(%rbx), %rsi
+	movq	%rbx, %rdi
+	addq	$80, %rbx
+	call	*16(%rax)
+	cmpq	%r14, %rbp
+	jne	.L1370
+.L1369:
+	cmpq	%r13, %r15
+	je	.L1366
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1504
+.L1372:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %ecx
+	movl	$656, %edx
+	movq	%r15, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1366:
+	testq	%r12, %r12
+	jne	.L1374
+	movq	104(%rsp), %rax
+	movq	112(%rsp), %rdi
+	movl	$4, %edx
+	leaq	0(,%rax,4), %rsi
+	movq	(%rdi), %rax
+	movq	%rsi, 120(%rsp)
+.LEHB48:
+	call	*16(%rax)
+.LEHE48:
+	movq	%rax, %rcx
+	movq	%rax, 128(%rsp)
+	leaq	168(%rsp), %rax
+	leaq	152(%rsp), %rdx
+	movq	%rax, %xmm3
+	leaq	160(%rsp), %rax
+	movq	%rdx, %xmm4
+	movq	192(%rsp), %r12
+	movq	%rax, %xmm6
+	movq	144(%rsp), %rax
+	movhps	16(%rsp), %xmm3
+	movq	%rcx, 160(%rsp)
+	punpcklqdq	%xmm6, %xmm4
+	movq	176(%rsp), %rbx
+	movaps	%xmm3, 48(%rsp)
+	leaq	272(%rsp), %r15
+	movq	%rax, 152(%rsp)
+	movaps	%xmm4, 64(%rsp)
+	cmpq	$2, %r12
+	jbe	.L1379
+	.p2align 4,,10
+	.p2align 3
+.L1378:
+	movq	88(%rsp), %rax
+	subq	$1, %r12
+	xorl	%edx, %edx
+	movdqa	48(%rsp), %xmm1
+	movq	%r12, %rbp
+	shrq	%r12
+	movdqa	64(%rsp), %xmm2
+	movq	$0, 264(%rsp)
+	movq	%rax, 240(%rsp)
+	movq	80(%rsp), %rax
+	andl	$1, %ebp
+	movq	$0, 272(%rsp)
+	addq	%r12, %rbp
+	movq	%rax, 256(%rsp)
+	movq	40(%rsp), %rax
+	movq	$0, 280(%rsp)
+	movq	%r15, 40(%rsp)
+	movq	%rbx, 168(%rsp)
+	xorl	%ebx, %ebx
+	movq	%rax, 928(%rsp)
+	movq	%r15, %rax
+	movaps	%xmm1, 208(%rsp)
+	movaps	%xmm2, 224(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1380:
+	leaq	1(%rdx), %rcx
+	leaq	(%rdx,%rdx,4), %rdx
+	salq	$4, %rdx
+	movq	%rcx, 8(%rax)
+	leaq	16(%rax,%rdx), %rsi
+	movq	(%rsp), %rax
+	movq	$0, 56(%rsi)
+	movq	%rax, (%rsi)
+	leaq	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_iNS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE0_EEvmOS6_EUlvE_EE(%rip), %rax
+	movq	%rax, 48(%rsi)
+	movq	8(%rsp), %rax
+	movq	%rbx, 8(%rsi)
+	movq	%rax, 64(%rsi)
+	lock addq	$1, 264(%rsp)
+	movq	256(%rsp), %rdi
+.LEHB49:
+	call	_ZN1n11thread_pool6__pushEPNS_11__task_nodeE
+	addq	$1, %rbx
+	cmpq	%rbx, %rbp
+	je	.L1385
+	movq	928(%rsp), %rax
+	movq	8(%rax), %rdx
+	cmpq	$8, %rdx
+	jne	.L1380
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	je	.L1505
+.L1381:
+	movq	%rax, 928(%rsp)
+	movq	8(%rax), %rdx
+	jmp	.L1380
+	.p2align 4,,10
+	.p2align 3
+.L1367:
+	addq	$1, %rbp
+	addq	$80, %rbx
+	cmpq	%rbp, %r14
+	jne	.L1370
+	jmp	.L1369
+	.p2align 4,,10
+	.p2align 3
+.L1385:
+	movq	32(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	_ZN1n10task_group4syncEv
+.LEHE49:
+	movq	%rbx, %rdi
+	movq	%r15, %rbx
+	call	_ZN1n10task_group4syncEv
+	.p2align 4,,10
+	.p2align 3
+.L1398:
+	movq	%rbx, %r14
+	xorl	%r12d, %r12d
+	movq	(%rbx), %rbx
+	movq	8(%r14), %r13
+	leaq	16(%r14), %rbp
+	testq	%r13, %r13
+	je	.L1393
+	.p2align 4,,10
+	.p2align 3
+.L1394:
+	movq	48(%rbp), %rax
+	testq	%rax, %rax
+	je	.L1391
+	addq	$1, %r12
+	movq	56(%rbp), %rsi
+	movq	%rbp, %rdi
+	addq	$80, %rbp
+	call	*16(%rax)
+	cmpq	%r13, %r12
+	jne	.L1394
+.L1393:
+	cmpq	%r15, %r14
+	je	.L1390
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1506
+.L1396:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %ecx
+	movl	$656, %edx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1390:
+	testq	%rbx, %rbx
+	jne	.L1398
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r14
+	testq	%r14, %r14
+	je	.L1507
+.L1400:
+	movq	192(%rsp), %r12
+	movq	168(%rsp), %rax
+	testq	%r12, %r12
+	je	.L1405
+	xorl	%ebp, %ebp
+	xorl	%r13d, %r13d
+	jmp	.L1414
+	.p2align 4,,10
+	.p2align 3
+.L1406:
+	movq	(%r12), %rax
+	movq	%rax, (%rbx,%rbp,8)
+.L1413:
+	leaq	1(%rbp), %r12
+	movq	192(%rsp), %rax
+	leaq	(%r12,%r12), %rdx
+	cmpq	%rax, %rdx
+	jnb	.L1508
+	movq	168(%rsp), %rax
+	movq	%r12, %rbp
+.L1414:
+	movq	%rbp, %rdx
+	salq	$4, %rdx
+	leaq	(%rax,%rdx), %r12
+	cmpq	%r13, %rbp
+	jne	.L1406
+	leaq	5(%rbp), %rsi
+	movl	$8, %edx
+	movq	%r14, %rdi
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 24(%rsp)
+	movq	(%r14), %rax
+.LEHB50:
+	call	*16(%rax)
+.LEHE50:
+	movq	%rax, %rcx
+	movq	%rax, 16(%rsp)
+	movq	(%r12), %rax
+	leaq	0(,%rbp,8), %rdx
+	movq	%rax, (%rcx,%rbp,8)
+	testq	%rbp, %rbp
+	jne	.L1509
+	testq	%rbx, %rbx
+	je	.L1412
+.L1411:
+	movq	(%r14), %rax
+	movl	$8, %ecx
+	movq	%rbx, %rsi
+	movq	%r14, %rdi
+	leaq	0(,%r13,8), %rdx
+.LEHB51:
+	call	*24(%rax)
+.LEHE51:
+.L1412:
+	movq	24(%rsp), %r13
+	movq	16(%rsp), %rbx
+	jmp	.L1413
+	.p2align 4,,10
+	.p2align 3
+.L1391:
+	addq	$1, %r12
+	addq	$80, %rbp
+	cmpq	%r12, %r13
+	jne	.L1394
+	jmp	.L1393
+	.p2align 4,,10
+	.p2align 3
+.L1506:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1396
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1396
+	.p2align 4,,10
+	.p2align 3
+.L1508:
+	testb	$1, %al
+	je	.L1510
+.L1417:
+	movq	152(%rsp), %rdx
+	movq	160(%rsp), %rcx
+	movq	%r12, 192(%rsp)
+	movq	176(%rsp), %rsi
+	movq	184(%rsp), %rax
+	movq	%rbx, 176(%rsp)
+	movq	200(%rsp), %rdi
+	movq	%r13, 184(%rsp)
+	movq	%r14, 200(%rsp)
+	movq	%rcx, 152(%rsp)
+	movq	%rdx, 160(%rsp)
+	testq	%rsi, %rsi
+	je	.L1423
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	movl	$8, %ecx
+	call	*24(%rax)
+	movq	192(%rsp), %r12
+	cmpq	$2, %r12
+	jbe	.L1511
+	movq	176(%rsp), %rbx
+	jmp	.L1378
+.L1509:
+	movq	%rcx, %rdi
+	movq	%rbx, %rsi
+	call	memcpy@PLT
+	jmp	.L1411
+.L1505:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1512
+.L1383:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %edx
+	movl	$656, %esi
+	movq	(%rdi), %rax
+.LEHB52:
+	call	*16(%rax)
+.LEHE52:
+	movq	%rax, %rdx
+	movl	$82, %ecx
+	xorl	%eax, %eax
+	movq	%rdx, %rdi
+	rep stosq
+	movq	928(%rsp), %rax
+	movq	%rdx, (%rax)
+	movq	928(%rsp), %rax
+	movq	(%rax), %rax
+	jmp	.L1381
+.L1423:
+	cmpq	$2, %r12
+	ja	.L1378
+	cmpq	$0, 104(%rsp)
+	movq	144(%rsp), %rdi
+	je	.L1379
+.L1517:
+	cmpq	%rdi, %rcx
+	jne	.L1513
+.L1379:
+	movq	112(%rsp), %rdi
+	movq	120(%rsp), %rdx
+	movl	$4, %ecx
+	movq	128(%rsp), %rsi
+	movq	(%rdi), %rax
+.LEHB53:
+	call	*24(%rax)
+.LEHE53:
+	movq	176(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L1341
+	movq	184(%rsp), %rax
+	movq	200(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1341:
+	addq	$952, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L1510:
+	.cfi_restore_state
+	movq	168(%rsp), %rdx
+	leaq	-8(%rdx,%rax,8), %rax
+	movq	%rax, 96(%rsp)
+	cmpq	%r12, %r13
+	je	.L1514
+	movq	(%rax), %rax
+	movq	%rax, (%rbx,%r12,8)
+.L1422:
+	addq	$1, %r12
+	jmp	.L1417
+.L1507:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1515
+.L1403:
+	movq	_ZZN1n4heapEvE3res(%rip), %r14
+	jmp	.L1400
+.L1504:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1372
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1372
+.L1512:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1383
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1383
+.L1405:
+	subq	$8, %rax
+	movl	$80, %esi
+	movq	$10, 24(%rsp)
+	movq	%rax, 96(%rsp)
+.L1416:
+	movq	(%r14), %rax
+	movl	$8, %edx
+	movq	%r14, %rdi
+.LEHB54:
+	call	*16(%rax)
+.LEHE54:
+	movq	%rax, %rcx
+	movq	%rax, 16(%rsp)
+	movq	96(%rsp), %rax
+	leaq	0(,%r12,8), %rbp
+	movq	(%rax), %rax
+	movq	%rax, (%rcx,%r12,8)
+	testq	%r12, %r12
+	jne	.L1516
+	testq	%rbx, %rbx
+	je	.L1421
+.L1420:
+	movq	(%r14), %rax
+	movl	$8, %ecx
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movq	%r14, %rdi
+.LEHB55:
+	call	*24(%rax)
+.LEHE55:
+.L1421:
+	movq	24(%rsp), %r13
+	movq	16(%rsp), %rbx
+	jmp	.L1422
+.L1511:
+	cmpq	$0, 104(%rsp)
+	movq	152(%rsp), %rcx
+	movq	144(%rsp), %rdi
+	jne	.L1517
+	jmp	.L1379
+.L1502:
+	leaq	0(,%rcx,8), %rdx
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L1352
+.L1515:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1403
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1403
+.L1503:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1518
+.L1359:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %edx
+	movl	$656, %esi
+	leaq	256(%rsp), %rcx
+	movq	%rcx, 32(%rsp)
+	movq	(%rdi), %rax
+.LEHB56:
+	call	*16(%rax)
+.LEHE56:
+	movq	%rax, %rdx
+	movl	$82, %ecx
+	xorl	%eax, %eax
+	movq	%rdx, %rdi
+	rep stosq
+	movq	928(%rsp), %rax
+	movq	%rdx, (%rax)
+	movq	928(%rsp), %rax
+	movq	(%rax), %rax
+	jmp	.L1357
+.L1513:
+	movq	120(%rsp), %rdx
+	movq	%rcx, %rsi
+	call	memcpy@PLT
+	jmp	.L1379
+.L1516:
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movq	%rcx, %rdi
+	call	memcpy@PLT
+	jmp	.L1420
+.L1501:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1519
+.L1348:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	192(%rsp), %rcx
+	movq	184(%rsp), %r13
+	movq	176(%rsp), %r14
+	jmp	.L1346
+.L1518:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r14
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1359
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r14, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1359
+.L1500:
+	movq	104(%rsp), %rax
+	cmpq	$1, %rax
+	jbe	.L1341
+	xorl	%edx, %edx
+.L1344:
+	shrq	%rax
+	addl	$1, %edx
+	cmpq	$1, %rax
+	jne	.L1344
+	movq	104(%rsp), %rax
+	movl	$1, %ecx
+	leaq	(%rdi,%rax,4), %rsi
+	call	_ZN1n9__pdqsortIiNS_4lessEEEvPT_S3_RT0_ib.isra.0
+	jmp	.L1341
+.L1519:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1348
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1348
+.L1514:
+	addq	$6, %rbp
+	leaq	0(%rbp,%rbp), %rax
+	movq	%rbp, %rsi
+	movq	%rax, 24(%rsp)
+	salq	$4, %rsi
+	jmp	.L1416
+.L1433:
+	movq	%rax, %rbx
+	jmp	.L1377
+.L1434:
+	movq	%rax, %rbp
+	jmp	.L1409
+.L1428:
+	movq	%rbx, 16(%rsp)
+.L1409:
+	cmpq	$0, 16(%rsp)
+	jne	.L1520
+.L1429:
+	movq	%rbp, %rbx
+.L1377:
+	movq	176(%rsp), %rsi
+	movq	184(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L1430
+	movq	200(%rsp), %rdi
+	salq	$3, %rdx
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1430:
+	movq	%rbx, %rdi
+.LEHB57:
+	call	_Unwind_Resume@PLT
+.LEHE57:
+.L1520:
+	movq	24(%rsp), %rdx
+	movq	(%r14), %rax
+	movl	$8, %ecx
+	movq	%r14, %rdi
+	movq	16(%rsp), %rsi
+	salq	$3, %rdx
+	call	*24(%rax)
+	jmp	.L1429
+.L1436:
+.L1498:
+	movq	%rax, %rbx
+	jmp	.L1401
+.L1435:
+	jmp	.L1498
+.L1438:
+.L1499:
+	movq	%rax, %rbp
+	jmp	.L1428
+.L1437:
+	jmp	.L1499
+.L1401:
+	movq	32(%rsp), %rdi
+	call	_ZN1n10task_groupD1Ev
+	jmp	.L1377
+	.cfi_endproc
+.LFE7118:
+	.section	.gcc_except_table
+.LLSDA7118:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7118-.LLSDACSB7118
+.LLSDACSB7118:
+	.uleb128 .LEHB46-.LFB7118
+	.uleb128 .LEHE46-.LEHB46
+	.uleb128 .L1433-.LFB7118
+	.uleb128 0
+	.uleb128 .LEHB47-.LFB7118
+	.uleb128 .LEHE47-.LEHB47
+	.uleb128 .L1435-.LFB7118
+	.uleb128 0
+	.uleb128 .LEHB48-.LFB7118
+	.uleb128 .LEHE48-.LEHB48
+	.uleb128 .L1433-.LFB7118
+	.uleb128 0
+	.uleb128 .LEHB49-.LFB7118
+	.uleb128 .LEHE49-.LEHB49
+	.uleb128 .L1436-.LFB7118
+	.uleb128 0
+	.uleb128 .LEHB50-.LFB7118
+	.uleb128 .LEHE50-.LEHB50
+	.uleb128 .L1438-.LFB7118
+	.uleb128 0
+	.uleb128 .LEHB51-.LFB7118
+	.uleb128 .LEHE51-.LEHB51
+	.uleb128 .L1434-.LFB7118
+	.uleb128 0
+	.uleb128 .LEHB52-.LFB7118
+	.uleb128 .LEHE52-.LEHB52
+	.uleb128 .L1436-.LFB7118
+	.uleb128 0
+	.uleb128 .LEHB53-.LFB7118
+	.uleb128 .LEHE53-.LEHB53
+	.uleb128 .L1433-.LFB7118
+	.uleb128 0
+	.uleb128 .LEHB54-.LFB7118
+	.uleb128 .LEHE54-.LEHB54
+	.uleb128 .L1437-.LFB7118
+	.uleb128 0
+	.uleb128 .LEHB55-.LFB7118
+	.uleb128 .LEHE55-.LEHB55
+	.uleb128 .L1434-.LFB7118
+	.uleb128 0
+	.uleb128 .LEHB56-.LFB7118
+	.uleb128 .LEHE56-.LEHB56
+	.uleb128 .L1435-.LFB7118
+	.uleb128 0
+	.uleb128 .LEHB57-.LFB7118
+	.uleb128 .LEHE57-.LEHB57
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE7118:
+	.section	.text._ZN1n4sortINS_11thread_poolEiNS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceE,"axG",@progbits,_ZN1n4sortINS_11thread_poolEiNS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceE,comdat
+	.size	_ZN1n4sortINS_11thread_poolEiNS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceE, .-_ZN1n4sortINS_11thread_poolEiNS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceE
+	.section	.rodata.str1.8
+	.align 8
+.LC32:
+	.string	"expected equal : expected value : v.len(), actual value : n::size_t(len)"
+	.section	.rodata.str1.1
+.LC33:
+	.string	"expected true : same"
+	.section	.text.unlikely
+.LCOLDB34:
+	.text
+.LHOTB34:
+	.p2align 4
+	.globl	_Z18test_parallel_sortv
+	.type	_Z18test_parallel_sortv, @function
+_Z18test_parallel_sortv:
+.LFB6930:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6930
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$328, %rsp
+	.cfi_def_cfa_offset 384
+	leaq	80(%rsp), %rax
+	leaq	32(%rsp), %r14
+	movq	%rax, %rdi
+	movq	%rax, 24(%rsp)
+.LEHB58:
+	call	_ZN1n11thread_poolC2Em.constprop.1
+.LEHE58:
+	leaq	48(%rsp), %rax
+	movdqa	.LC31(%rip), %xmm0
+	movl	$0, (%rsp)
+	movq	%rax, 8(%rsp)
+	movl	(%rsp), %esi
+	movaps	%xmm0, 32(%rsp)
+.L1542:
+	movq	8(%rsp), %rdi
+.LEHB59:
+	call	_Z7numbersi
+.LEHE59:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r13
+	movq	64(%rsp), %rbx
+	testq	%r13, %r13
+	je	.L1619
+.L1522:
+	testq	%rbx, %rbx
+	movl	$40, %ecx
+	movl	$4, %edx
+	movq	%r13, %rdi
+	leaq	0(,%rbx,4), %rax
+	cmove	%rcx, %rax
+	movq	%rax, 16(%rsp)
+	movq	%rax, %rsi
+	movq	0(%r13), %rax
+.LEHB60:
+	call	*16(%rax)
+.LEHE60:
+	movq	64(%rsp), %rbx
+	movq	48(%rsp), %r12
+	movq	%rax, %rbp
+	testq	%rbx, %rbx
+	jne	.L1620
+.L1527:
+	movq	72(%rsp), %r15
+	movq	24(%rsp), %rdi
+	movq	%r12, %rsi
+	movq	%rbx, %rdx
+	movq	%r15, %rcx
+.LEHB61:
+	call	_ZN1n4sortINS_11thread_poolEiNS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceE
+.LEHE61:
+	cmpq	$1, %rbx
+	jbe	.L1528
+	movq	%rbx, %rax
+	xorl	%edx, %edx
+	.p2align 4,,10
+	.p2align 3
+.L1529:
+	shrq	%rax
+	addl	$1, %edx
+	cmpq	$1, %rax
+	jne	.L1529
+	leaq	0(%rbp,%rbx,4), %rsi
+	movl	$1, %ecx
+	movq	%rbp, %rdi
+	call	_ZN1n9__pdqsortIiNS_4lessEEEvPT_S3_RT0_ib.isra.0
+.L1618:
+	movslq	(%rsp), %rcx
+	xorl	%eax, %eax
+	movl	$1, %edx
+	.p2align 4,,10
+	.p2align 3
+.L1531:
+	testb	%dl, %dl
+	je	.L1530
+	movl	0(%rbp,%rax,4), %esi
+	cmpl	%esi, (%r12,%rax,4)
+	sete	%dl
+.L1530:
+	addq	$1, %rax
+	cmpq	%rbx, %rax
+	jne	.L1531
+	cmpq	%rcx, %rax
+	jne	.L1535
+	testb	%dl, %dl
+	je	.L1615
+.L1536:
+	testq	%rbp, %rbp
+	je	.L1538
+	movq	0(%r13), %rax
+	movq	16(%rsp), %rdx
+	movq	%rbp, %rsi
+	movq	%r13, %rdi
+	movl	$4, %ecx
+	call	*24(%rax)
+.L1538:
+	testq	%r12, %r12
+	je	.L1539
+	movq	56(%rsp), %rax
+	movl	$4, %ecx
+	movq	%r12, %rsi
+	movq	%r15, %rdi
+	addq	$4, %r14
+	leaq	0(,%rax,4), %rdx
+	movq	(%r15), %rax
+	call	*24(%rax)
+	cmpq	%r14, 8(%rsp)
+	je	.L1541
+.L1540:
+	movl	(%r14), %eax
+	movl	%eax, (%rsp)
+	movl	%eax, %esi
+	jmp	.L1542
+	.p2align 4,,10
+	.p2align 3
+.L1620:
+	leaq	0(,%rbx,4), %rdx
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L1527
+	.p2align 4,,10
+	.p2align 3
+.L1539:
+	addq	$4, %r14
+	cmpq	%r14, 8(%rsp)
+	jne	.L1540
+.L1541:
+	leaq	200(%rsp), %rbx
+	movq	%rbx, %rdi
+	movq	%rbx, (%rsp)
+	call	pthread_mutex_lock@PLT
+	movb	$1, 304(%rsp)
+	lock addq	$1, 288(%rsp)
+	leaq	240(%rsp), %rax
+	movq	%rax, %rdi
+	movq	%rax, 8(%rsp)
+	call	pthread_cond_broadcast@PLT
+	movq	%rbx, %rdi
+	xorl	%ebx, %ebx
+	call	pthread_mutex_unlock@PLT
+	cmpq	$0, 96(%rsp)
+	je	.L1546
+	.p2align 4,,10
+	.p2align 3
+.L1543:
+	movq	80(%rsp), %rax
+	xorl	%esi, %esi
+	movq	(%rax,%rbx,8), %rax
+	addq	$1, %rbx
+	movq	24(%rax), %rdi
+	call	pthread_join@PLT
+	movq	96(%rsp), %rax
+	cmpq	%rax, %rbx
+	jb	.L1543
+	testq	%rax, %rax
+	je	.L1546
+	xorl	%ebp, %ebp
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %r13
+	.p2align 4,,10
+	.p2align 3
+.L1560:
+	movq	80(%rsp), %rax
+	movq	(%rax,%rbp,8), %r15
+	movq	136(%r15), %r14
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1621
+.L1548:
+	movq	(%r14), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%r14, %rsi
+	movl	$8, %ecx
+	xorl	%r14d, %r14d
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	$0, 160(%r15)
+	jne	.L1550
+	jmp	.L1556
+	.p2align 4,,10
+	.p2align 3
+.L1554:
+	movq	(%r12), %rax
+	movl	$8, %ecx
+	movq	%r12, %rsi
+	addq	$1, %r14
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	160(%r15), %r14
+	jnb	.L1556
+.L1550:
+	movq	144(%r15), %rax
+	movq	(%rax,%r14,8), %r12
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L1554
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1554
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%r13, _ZZN1n4heapEvE7storage(%rip)
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1554
+	.p2align 4,,10
+	.p2align 3
+.L1556:
+	movq	144(%r15), %rsi
+	testq	%rsi, %rsi
+	je	.L1552
+	movq	152(%r15), %rax
+	movq	168(%r15), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1552:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1622
+.L1558:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$64, %ecx
+	movl	$192, %edx
+	movq	%r15, %rsi
+	addq	$1, %rbp
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	96(%rsp), %rbp
+	jb	.L1560
+.L1546:
+	movq	8(%rsp), %rdi
+	call	pthread_cond_destroy@PLT
+	movq	(%rsp), %rdi
+	call	pthread_mutex_destroy@PLT
+	leaq	112(%rsp), %rdi
+	call	pthread_mutex_destroy@PLT
+	movq	152(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L1545
+	movq	160(%rsp), %rax
+	movq	176(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1545:
+	movq	80(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L1521
+	movq	88(%rsp), %rax
+	movq	104(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1521:
+	addq	$328, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1622:
+	.cfi_restore_state
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1558
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1558
+	.p2align 4,,10
+	.p2align 3
+.L1621:
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1548
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1548
+	.p2align 4,,10
+	.p2align 3
+.L1528:
+	testq	%rbx, %rbx
+	jne	.L1618
+	movl	(%rsp), %eax
+	testl	%eax, %eax
+	je	.L1536
+	jmp	.L1535
+	.p2align 4,,10
+	.p2align 3
+.L1619:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1623
+.L1524:
+	movq	_ZZN1n4heapEvE3res(%rip), %r13
+	jmp	.L1522
+.L1623:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1524
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1524
+.L1570:
+	movq	%rax, %rbx
+	jmp	.L1566
+.L1613:
+	jmp	.L1614
+.L1571:
+	movq	%rax, %rbx
+	jmp	.L1564
+	.section	.gcc_except_table
+.LLSDA6930:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6930-.LLSDACSB6930
+.LLSDACSB6930:
+	.uleb128 .LEHB58-.LFB6930
+	.uleb128 .LEHE58-.LEHB58
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB59-.LFB6930
+	.uleb128 .LEHE59-.LEHB59
+	.uleb128 .L1570-.LFB6930
+	.uleb128 0
+	.uleb128 .LEHB60-.LFB6930
+	.uleb128 .LEHE60-.LEHB60
+	.uleb128 .L1571-.LFB6930
+	.uleb128 0
+	.uleb128 .LEHB61-.LFB6930
+	.uleb128 .LEHE61-.LEHB61
+	.uleb128 .L1613-.LFB6930
+	.uleb128 0
+.LLSDACSE6930:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6930
+	.type	_Z18test_parallel_sortv.cold, @function
+_Z18test_parallel_sortv.cold:
+.LFSB6930:
+.L1615:
+	.cfi_def_cfa_offset 384
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC33(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB62:
+	call	__cxa_throw@PLT
+.L1535:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC32(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE62:
+.L1572:
+.L1614:
+	movq	%rax, %rbx
+	testq	%rbp, %rbp
+	je	.L1564
+	movq	0(%r13), %rax
+	movq	16(%rsp), %rdx
+	movq	%rbp, %rsi
+	movq	%r13, %rdi
+	movl	$4, %ecx
+	call	*24(%rax)
+.L1564:
+	movq	48(%rsp), %rsi
+	movq	56(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L1566
+	movq	72(%rsp), %rdi
+	salq	$2, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1566:
+	movq	24(%rsp), %rdi
+	call	_ZN1n11thread_poolD1Ev
+	movq	%rbx, %rdi
+.LEHB63:
+	call	_Unwind_Resume@PLT
+.LEHE63:
+	.cfi_endproc
+.LFE6930:
+	.section	.gcc_except_table
+.LLSDAC6930:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6930-.LLSDACSBC6930
+.LLSDACSBC6930:
+	.uleb128 .LEHB62-.LCOLDB34
+	.uleb128 .LEHE62-.LEHB62
+	.uleb128 .L1572-.LCOLDB34
+	.uleb128 0
+	.uleb128 .LEHB63-.LCOLDB34
+	.uleb128 .LEHE63-.LEHB63
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6930:
+	.section	.text.unlikely
+	.text
+	.size	_Z18test_parallel_sortv, .-_Z18test_parallel_sortv
+	.section	.text.unlikely
+	.size	_Z18test_parallel_sortv.cold, .-_Z18test_parallel_sortv.cold
+.LCOLDE34:
+	.text
+.LHOTE34:
+	.section	.text._ZN1n11thread_pool4bulkIZNS_15__parallel_findIS0_ZNS_4findIS0_NS_5sliceIKiEEiEEmRT_T0_RKT1_EUlmmE_EEmS8_mOS9_EUlmE_EEvmOS7_,"axG",@progbits,_ZN1n11thread_pool4bulkIZNS_15__parallel_findIS0_ZNS_4findIS0_NS_5sliceIKiEEiEEmRT_T0_RKT1_EUlmmE_EEmS8_mOS9_EUlmE_EEvmOS7_,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n11thread_pool4bulkIZNS_15__parallel_findIS0_ZNS_4findIS0_NS_5sliceIKiEEiEEmRT_T0_RKT1_EUlmmE_EEmS8_mOS9_EUlmE_EEvmOS7_
+	.type	_ZN1n11thread_pool4bulkIZNS_15__parallel_findIS0_ZNS_4findIS0_NS_5sliceIKiEEiEEmRT_T0_RKT1_EUlmmE_EEmS8_mOS9_EUlmE_EEvmOS7_, @function
+_ZN1n11thread_pool4bulkIZNS_15__parallel_findIS0_ZNS_4findIS0_NS_5sliceIKiEEiEEmRT_T0_RKT1_EUlmmE_EEmS8_mOS9_EUlmE_EEvmOS7_:
+.LFB7185:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7185
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$712, %rsp
+	.cfi_def_cfa_offset 768
+	leaq	32(%rsp), %rbp
+	movq	%rsi, (%rsp)
+	movq	%rdi, 16(%rsp)
+	movq	$0, 24(%rsp)
+	movq	$0, 32(%rsp)
+	movq	$0, 40(%rsp)
+	movq	%rbp, 688(%rsp)
+	testq	%rsi, %rsi
+	je	.L1626
+	leaq	16(%rsp), %rcx
+	movq	%rdx, %r13
+	xorl	%ebx, %ebx
+	xorl	%edx, %edx
+	movq	%rcx, 8(%rsp)
+	movq	%rbp, %rax
+	leaq	24(%rsp), %r14
+	leaq	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_15__parallel_findIS2_ZNS_4findIS2_NS_5sliceIKiEEiEEmRT_T0_RKT1_EUlmmE_EEmSA_mOSB_EUlmE_EEvmOS9_EUlvE_EE(%rip), %r15
+	.p2align 4,,10
+	.p2align 3
+.L1625:
+	leaq	1(%rdx), %rcx
+	leaq	(%rdx,%rdx,4), %rdx
+	salq	$4, %rdx
+	movq	%rcx, 8(%rax)
+	leaq	16(%rax,%rdx), %rsi
+	movq	$0, 56(%rsi)
+	movq	%r13, (%rsi)
+	movq	%rbx, 8(%rsi)
+	movq	%r15, 48(%rsi)
+	movq	%r14, 64(%rsi)
+	lock addq	$1, 24(%rsp)
+	movq	16(%rsp), %rdi
+	movq	8(%rsp), %r12
+.LEHB64:
+	call	_ZN1n11thread_pool6__pushEPNS_11__task_nodeE
+	addq	$1, %rbx
+	cmpq	%rbx, (%rsp)
+	je	.L1626
+	movq	688(%rsp), %rax
+	movq	8(%rax), %rdx
+	cmpq	$8, %rdx
+	jne	.L1625
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	je	.L1657
+.L1627:
+	movq	%rax, 688(%rsp)
+	movq	8(%rax), %rdx
+	jmp	.L1625
+	.p2align 4,,10
+	.p2align 3
+.L1626:
+	leaq	16(%rsp), %r12
+	movq	%r12, %rdi
+	call	_ZN1n10task_group4syncEv
+.LEHE64:
+	movq	%r12, %rdi
+	movq	%rbp, %r14
+	call	_ZN1n10task_group4syncEv
+	.p2align 4,,10
+	.p2align 3
+.L1643:
+	movq	%r14, %r13
+	xorl	%r15d, %r15d
+	movq	(%r14), %r14
+	movq	8(%r13), %r12
+	leaq	16(%r13), %rbx
+	testq	%r12, %r12
+	je	.L1638
+	.p2align 4,,10
+	.p2align 3
+.L1639:
+	movq	48(%rbx), %rdx
+	testq	%rdx, %rdx
+	je	.L1636
+	addq	$1, %r15
+	movq	56(%rbx), %rsi
+	movq	%rbx, %rdi
+	addq	$80, %rbx
+	call	*16(%rdx)
+	cmpq	%r15, %r12
+	jne	.L1639
+.L1638:
+	cmpq	%rbp, %r13
+	je	.L1635
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1658
+.L1641:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %ecx
+	movl	$656, %edx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1635:
+	testq	%r14, %r14
+	jne	.L1643
+	addq	$712, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1636:
+	.cfi_restore_state
+	addq	$1, %r15
+	addq	$80, %rbx
+	cmpq	%r15, %r12
+	jne	.L1639
+	jmp	.L1638
+	.p2align 4,,10
+	.p2align 3
+.L1658:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1641
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1641
+.L1657:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1659
+.L1629:
+	leaq	16(%rsp), %r12
+	movl	$16, %edx
+	movl	$656, %esi
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+.LEHB65:
+	call	*16(%rax)
+.LEHE65:
+	movq	%rax, %rdx
+	movl	$82, %ecx
+	xorl	%eax, %eax
+	movq	%rdx, %rdi
+	rep stosq
+	movq	688(%rsp), %rax
+	movq	%rdx, (%rax)
+	movq	688(%rsp), %rax
+	movq	(%rax), %rax
+	jmp	.L1627
+.L1659:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1629
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1629
+.L1646:
+	movq	%rax, %rbx
+.L1644:
+	movq	%r12, %rdi
+	call	_ZN1n10task_groupD1Ev
+	movq	%rbx, %rdi
+.LEHB66:
+	call	_Unwind_Resume@PLT
+.LEHE66:
+	.cfi_endproc
+.LFE7185:
+	.section	.gcc_except_table
+.LLSDA7185:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7185-.LLSDACSB7185
+.LLSDACSB7185:
+	.uleb128 .LEHB64-.LFB7185
+	.uleb128 .LEHE64-.LEHB64
+	.uleb128 .L1646-.LFB7185
+	.uleb128 0
+	.uleb128 .LEHB65-.LFB7185
+	.uleb128 .LEHE65-.LEHB65
+	.uleb128 .L1646-.LFB7185
+	.uleb128 0
+	.uleb128 .LEHB66-.LFB7185
+	.uleb128 .LEHE66-.LEHB66
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE7185:
+	.section	.text._ZN1n11thread_pool4bulkIZNS_15__parallel_findIS0_ZNS_4findIS0_NS_5sliceIKiEEiEEmRT_T0_RKT1_EUlmmE_EEmS8_mOS9_EUlmE_EEvmOS7_,"axG",@progbits,_ZN1n11thread_pool4bulkIZNS_15__parallel_findIS0_ZNS_4findIS0_NS_5sliceIKiEEiEEmRT_T0_RKT1_EUlmmE_EEmS8_mOS9_EUlmE_EEvmOS7_,comdat
+	.size	_ZN1n11thread_pool4bulkIZNS_15__parallel_findIS0_ZNS_4findIS0_NS_5sliceIKiEEiEEmRT_T0_RKT1_EUlmmE_EEmS8_mOS9_EUlmE_EEvmOS7_, .-_ZN1n11thread_pool4bulkIZNS_15__parallel_findIS0_ZNS_4findIS0_NS_5sliceIKiEEiEEmRT_T0_RKT1_EUlmmE_EEmS8_mOS9_EUlmE_EEvmOS7_
+	.section	.rodata.str1.8
+	.align 8
+.LC35:
+	.string	"expected equal : expected value : n::find(pool, v.iter(), 1), actual value : 123456"
+	.align 8
+.LC36:
+	.string	"expected equal : expected value : n::find(pool, v.iter(), 3), actual value : n::size_t(-1)"
+	.align 8
+.LC37:
+	.string	"expected equal : expected value : n::find(pool, v.iter(), [](int i) { return i > 1; }), actual value : 250000"
+	.section	.text.unlikely
+.LCOLDB38:
+	.text
+.LHOTB38:
+	.p2align 4
+	.globl	_Z18test_parallel_findv
+	.type	_Z18test_parallel_findv, @function
+_Z18test_parallel_findv:
+.LFB6926:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6926
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$1304, %rsp
+	.cfi_def_cfa_offset 1360
+	leaq	368(%rsp), %rax
+	movq	%rax, %rdi
+	movq	%rax, 8(%rsp)
+.LEHB67:
+	call	_ZN1n11thread_poolC2Em.constprop.1
+.LEHE67:
+	pxor	%xmm0, %xmm0
+	movq	$0, 272(%rsp)
+	movups	%xmm0, 280(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rdi
+	testq	%rdi, %rdi
+	je	.L1661
+	movq	280(%rsp), %r12
+	movq	%rdi, 296(%rsp)
+	movl	$0, 304(%rsp)
+	cmpq	$299999, %r12
+	jbe	.L1732
+	xorl	%ebx, %ebx
+	xorl	%eax, %eax
+.L1663:
+	movl	$300000, %edx
+	leaq	(%rbx,%rax,4), %rdi
+	xorl	%esi, %esi
+	movq	%rbx, %rbp
+	subq	%rax, %rdx
+	salq	$2, %rdx
+	call	memset@PLT
+.L1667:
+	movl	$74, %eax
+	movl	$300000, %edx
+	movq	$300000, 288(%rsp)
+	leaq	304(%rsp), %rbx
+	leaq	124(%rsp), %r12
+.L1682:
+	leaq	200(%rsp), %rsi
+	movq	%r12, %xmm3
+	leaq	208(%rsp), %rcx
+	movq	%rdx, 152(%rsp)
+	movq	%rcx, %xmm7
+	movq	%rsi, %xmm1
+	leaq	256(%rsp), %rcx
+	movq	384(%rsp), %rdx
+	leaq	216(%rsp), %rsi
+	punpcklqdq	%xmm7, %xmm1
+	movq	%rcx, %xmm7
+	movl	$2, 1000000(%rbp)
+	movq	%rsi, %xmm2
+	movaps	%xmm1, 32(%rsp)
+	leaq	144(%rsp), %rcx
+	leaq	176(%rsp), %rsi
+	punpcklqdq	%xmm7, %xmm2
+	movq	%rcx, %xmm7
+	leaq	184(%rsp), %rcx
+	movl	$1, 493824(%rbp)
+	movq	%rcx, %xmm1
+	movq	%rsi, %xmm4
+	leaq	240(%rsp), %rcx
+	movaps	%xmm2, 48(%rsp)
+	leaq	192(%rsp), %rsi
+	movq	%rcx, %xmm2
+	leaq	136(%rsp), %rcx
+	movl	$1, 800000(%rbp)
+	movq	%rsi, %xmm5
+	movq	%rcx, %xmm6
+	leaq	4(,%rdx,4), %rsi
+	movq	%rbx, %rdx
+	cmpq	%rax, %rsi
+	punpcklqdq	%xmm1, %xmm4
+	punpcklqdq	%xmm7, %xmm3
+	movq	8(%rsp), %rdi
+	leaq	128(%rsp), %rcx
+	cmova	%rax, %rsi
+	punpcklqdq	%xmm2, %xmm5
+	movl	$1, %eax
+	movq	%rcx, %xmm0
+	leaq	608(%rsp), %rcx
+	movaps	%xmm4, 80(%rsp)
+	movq	%rcx, (%rsp)
+	testq	%rsi, %rsi
+	leaq	336(%rsp), %r13
+	cmove	%rax, %rsi
+	movaps	%xmm3, 64(%rsp)
+	leaq	152(%rsp), %rax
+	movq	%r13, %xmm3
+	movaps	%xmm5, 96(%rsp)
+	punpcklqdq	%xmm3, %xmm6
+	movhps	(%rsp), %xmm0
+	movq	%rbp, 128(%rsp)
+	movaps	%xmm0, 224(%rsp)
+	movq	%rax, %xmm0
+	leaq	160(%rsp), %rax
+	movq	%rax, %xmm4
+	leaq	168(%rsp), %rax
+	movl	$1, 608(%rsp)
+	punpcklqdq	%xmm4, %xmm0
+	movq	%rsi, 160(%rsp)
+	movaps	%xmm0, 304(%rsp)
+	movq	%rax, %xmm0
+	leaq	224(%rsp), %rax
+	movq	%rax, %xmm5
+	movaps	%xmm6, 16(%rsp)
+	movq	$-1, 168(%rsp)
+	punpcklqdq	%xmm5, %xmm0
+	movaps	%xmm0, 320(%rsp)
+.LEHB68:
+	call	_ZN1n11thread_pool4bulkIZNS_15__parallel_findIS0_ZNS_4findIS0_NS_5sliceIKiEEiEEmRT_T0_RKT1_EUlmmE_EEmS8_mOS9_EUlmE_EEvmOS7_
+	cmpq	$123456, 168(%rsp)
+	jne	.L1794
+	movq	272(%rsp), %rdx
+	movq	288(%rsp), %rax
+	movl	$3, 336(%rsp)
+	movdqa	16(%rsp), %xmm6
+	movdqa	80(%rsp), %xmm7
+	movq	$-1, 192(%rsp)
+	movq	%rdx, 136(%rsp)
+	movq	384(%rsp), %rdx
+	movq	%rax, 176(%rsp)
+	addq	$4095, %rax
+	movdqa	96(%rsp), %xmm1
+	leaq	4(,%rdx,4), %rsi
+	shrq	$12, %rax
+	movq	(%rsp), %rdx
+	movq	8(%rsp), %rdi
+	cmpq	%rax, %rsi
+	movaps	%xmm6, 240(%rsp)
+	cmova	%rax, %rsi
+	movl	$1, %eax
+	movaps	%xmm7, 608(%rsp)
+	movaps	%xmm1, 624(%rsp)
+	testq	%rsi, %rsi
+	cmove	%rax, %rsi
+	movq	%rsi, 184(%rsp)
+	call	_ZN1n11thread_pool4bulkIZNS_15__parallel_findIS0_ZNS_4findIS0_NS_5sliceIKiEEiEEmRT_T0_RKT1_EUlmmE_EEmS8_mOS9_EUlmE_EEvmOS7_
+.LEHE68:
+	cmpq	$-1, 192(%rsp)
+	jne	.L1795
+	movq	272(%rsp), %rdx
+	movq	288(%rsp), %rax
+	leaq	624(%rsp), %r12
+	movq	$-1, 216(%rsp)
+	movdqa	64(%rsp), %xmm2
+	movdqa	32(%rsp), %xmm3
+	movq	$0, 616(%rsp)
+	leaq	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_15__parallel_findIS2_ZNS_4findIS2_NS_5sliceIKiEEZ18test_parallel_findvEUliE_EEmRT_T0_OT1_EUlmmE_EEmSB_mOSC_EUlmE_EEvmOSA_EUlvE_EE(%rip), %r15
+	movq	%rdx, 144(%rsp)
+	movq	384(%rsp), %rdx
+	leaq	616(%rsp), %r14
+	movq	%rax, 200(%rsp)
+	addq	$4095, %rax
+	movdqa	48(%rsp), %xmm4
+	leaq	4(,%rdx,4), %rbp
+	shrq	$12, %rax
+	movq	$0, 624(%rsp)
+	cmpq	%rax, %rbp
+	movq	%r12, 1280(%rsp)
+	cmova	%rax, %rbp
+	movl	$1, %eax
+	movq	$0, 632(%rsp)
+	movaps	%xmm2, 256(%rsp)
+	testq	%rbp, %rbp
+	movaps	%xmm3, 336(%rsp)
+	cmove	%rax, %rbp
+	movq	8(%rsp), %rax
+	xorl	%ebx, %ebx
+	xorl	%edx, %edx
+	movaps	%xmm4, 352(%rsp)
+	movq	%rbp, 208(%rsp)
+	movq	%rax, 608(%rsp)
+	movq	%r12, %rax
+	.p2align 4,,10
+	.p2align 3
+.L1688:
+	leaq	1(%rdx), %rcx
+	leaq	(%rdx,%rdx,4), %rdx
+	salq	$4, %rdx
+	movq	%rcx, 8(%rax)
+	leaq	16(%rax,%rdx), %rsi
+	movq	$0, 56(%rsi)
+	movq	%r13, (%rsi)
+	movq	%rbx, 8(%rsi)
+	movq	%r15, 48(%rsi)
+	movq	%r14, 64(%rsi)
+	lock addq	$1, 616(%rsp)
+	movq	608(%rsp), %rdi
+.LEHB69:
+	call	_ZN1n11thread_pool6__pushEPNS_11__task_nodeE
+	addq	$1, %rbx
+	cmpq	%rbx, %rbp
+	je	.L1693
+	movq	1280(%rsp), %rax
+	movq	8(%rax), %rdx
+	cmpq	$8, %rdx
+	jne	.L1688
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	je	.L1802
+.L1689:
+	movq	%rax, 1280(%rsp)
+	movq	8(%rax), %rdx
+	jmp	.L1688
+	.p2align 4,,10
+	.p2align 3
+.L1693:
+	movq	(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	_ZN1n10task_group4syncEv
+.LEHE69:
+	movq	%rbx, %rdi
+	movq	%r12, %r13
+	call	_ZN1n10task_group4syncEv
+	.p2align 4,,10
+	.p2align 3
+.L1706:
+	movq	%r13, %rbp
+	xorl	%r14d, %r14d
+	movq	0(%r13), %r13
+	movq	8(%rbp), %rbx
+	leaq	16(%rbp), %r15
+	testq	%rbx, %rbx
+	je	.L1701
+	.p2align 4,,10
+	.p2align 3
+.L1702:
+	movq	48(%r15), %rdx
+	testq	%rdx, %rdx
+	je	.L1699
+	addq	$1, %r14
+	movq	56(%r15), %rsi
+	movq	%r15, %rdi
+	addq	$80, %r15
+	call	*16(%rdx)
+	cmpq	%r14, %rbx
+	jne	.L1702
+.L1701:
+	cmpq	%r12, %rbp
+	je	.L1698
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1803
+.L1704:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %ecx
+	movl	$656, %edx
+	movq	%rbp, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1698:
+	testq	%r13, %r13
+	jne	.L1706
+	cmpq	$250000, 216(%rsp)
+	jne	.L1804
+	movq	272(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L1711
+	movq	280(%rsp), %rax
+	movq	296(%rsp), %rdi
+	movl	$4, %ecx
+	leaq	0(,%rax,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1711:
+	leaq	488(%rsp), %rbx
+	movq	%rbx, %rdi
+	movq	%rbx, (%rsp)
+	call	pthread_mutex_lock@PLT
+	movb	$1, 592(%rsp)
+	lock addq	$1, 576(%rsp)
+	leaq	528(%rsp), %rax
+	movq	%rax, %rdi
+	movq	%rax, 8(%rsp)
+	call	pthread_cond_broadcast@PLT
+	movq	%rbx, %rdi
+	xorl	%ebx, %ebx
+	call	pthread_mutex_unlock@PLT
+	cmpq	$0, 384(%rsp)
+	je	.L1715
+	.p2align 4,,10
+	.p2align 3
+.L1712:
+	movq	368(%rsp), %rax
+	xorl	%esi, %esi
+	movq	(%rax,%rbx,8), %rax
+	addq	$1, %rbx
+	movq	24(%rax), %rdi
+	call	pthread_join@PLT
+	movq	384(%rsp), %rax
+	cmpq	%rax, %rbx
+	jb	.L1712
+	testq	%rax, %rax
+	je	.L1715
+	xorl	%ebp, %ebp
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %r13
+	.p2align 4,,10
+	.p2align 3
+.L1729:
+	movq	368(%rsp), %rax
+	movq	(%rax,%rbp,8), %r15
+	movq	136(%r15), %r14
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1805
+.L1717:
+	movq	(%r14), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%r14, %rsi
+	movl	$8, %ecx
+	xorl	%r14d, %r14d
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	$0, 160(%r15)
+	jne	.L1719
+	jmp	.L1725
+	.p2align 4,,10
+	.p2align 3
+.L1723:
+	movq	(%r12), %rax
+	movl	$8, %ecx
+	movq	%r12, %rsi
+	addq	$1, %r14
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	160(%r15), %r14
+	jnb	.L1725
+.L1719:
+	movq	144(%r15), %rax
+	movq	(%rax,%r14,8), %r12
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L1723
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1723
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%r13, _ZZN1n4heapEvE7storage(%rip)
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1723
+	.p2align 4,,10
+	.p2align 3
+.L1699:
+	addq	$1, %r14
+	addq	$80, %r15
+	cmpq	%r14, %rbx
+	jne	.L1702
+	jmp	.L1701
+	.p2align 4,,10
+	.p2align 3
+.L1725:
+	movq	144(%r15), %rsi
+	testq	%rsi, %rsi
+	je	.L1721
+	movq	152(%r15), %rax
+	movq	168(%r15), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1721:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1806
+.L1727:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$64, %ecx
+	movl	$192, %edx
+	movq	%r15, %rsi
+	addq	$1, %rbp
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	384(%rsp), %rbp
+	jb	.L1729
+.L1715:
+	movq	8(%rsp), %rdi
+	call	pthread_cond_destroy@PLT
+	movq	(%rsp), %rdi
+	call	pthread_mutex_destroy@PLT
+	leaq	400(%rsp), %rdi
+	call	pthread_mutex_destroy@PLT
+	movq	440(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L1714
+	movq	448(%rsp), %rax
+	movq	464(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1714:
+	movq	368(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L1660
+	movq	376(%rsp), %rax
+	movq	392(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1660:
+	addq	$1304, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1806:
+	.cfi_restore_state
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1727
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1727
+	.p2align 4,,10
+	.p2align 3
+.L1805:
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1717
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1717
+	.p2align 4,,10
+	.p2align 3
+.L1803:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1704
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1704
+.L1802:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1807
+.L1691:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %edx
+	movl	$656, %esi
+	movq	(%rdi), %rax
+.LEHB70:
+	call	*16(%rax)
+.LEHE70:
+	movq	%rax, %rdx
+	movl	$82, %ecx
+	xorl	%eax, %eax
+	movq	%rdx, %rdi
+	rep stosq
+	movq	1280(%rsp), %rax
+	movq	%rdx, (%rax)
+	movq	1280(%rsp), %rax
+	movq	(%rax), %rax
+	jmp	.L1689
+.L1732:
+	xorl	%ebp, %ebp
+.L1662:
+	movq	(%rdi), %rax
+	movl	$4, %edx
+	movl	$1200000, %esi
+.LEHB71:
+	call	*16(%rax)
+	movq	%rax, 272(%rsp)
+	movq	%rax, %rbx
+	movq	288(%rsp), %rax
+	movq	$300000, 280(%rsp)
+	testq	%rax, %rax
+	jne	.L1808
+	testq	%rbp, %rbp
+	je	.L1663
+.L1684:
+	movq	296(%rsp), %rdi
+	leaq	0(,%r12,4), %rdx
+	movl	$4, %ecx
+	movq	%rbp, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	288(%rsp), %rax
+	movq	272(%rsp), %rbx
+.L1668:
+	cmpq	$299999, %rax
+	jbe	.L1663
+	movq	%rbx, %rbp
+	jmp	.L1667
+	.p2align 4,,10
+	.p2align 3
+.L1661:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1809
+.L1665:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	288(%rsp), %rax
+	movl	$0, 304(%rsp)
+	movq	272(%rsp), %rbp
+	movq	%rdi, 296(%rsp)
+	cmpq	$300000, %rax
+	ja	.L1667
+	movq	280(%rsp), %r12
+	cmpq	$299999, %r12
+	ja	.L1733
+	leaq	304(%rsp), %rbx
+	cmpq	%rbp, %rbx
+	jb	.L1662
+	leaq	0(%rbp,%rax,4), %rax
+	cmpq	%rax, %rbx
+	jnb	.L1662
+	leaq	116(%rsp), %rdx
+	movl	$0, 116(%rsp)
+	cmpq	%rbp, %rdx
+	jb	.L1669
+	cmpq	%rax, %rdx
+	jb	.L1810
+.L1669:
+	movq	(%rdi), %rax
+	movl	$4, %edx
+	movl	$1200000, %esi
+	call	*16(%rax)
+	movq	%rax, 272(%rsp)
+	movq	%rax, %rdi
+	movq	288(%rsp), %rax
+	movq	$300000, 280(%rsp)
+	testq	%rax, %rax
+	jne	.L1801
+	testq	%rbp, %rbp
+	jne	.L1679
+	movq	%rdi, %rbp
+.L1680:
+	movl	$300000, %edx
+	leaq	0(%rbp,%rax,4), %rdi
+	xorl	%esi, %esi
+	subq	%rax, %rdx
+	salq	$2, %rdx
+	call	memset@PLT
+.L1681:
+	movl	$74, %eax
+	movl	$300000, %edx
+	leaq	124(%rsp), %r12
+	movq	$300000, 288(%rsp)
+	jmp	.L1682
+.L1807:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	testl	%eax, %eax
+	je	.L1691
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1691
+.L1809:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1665
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1665
+.L1808:
+	leaq	0(,%rax,4), %rdx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	memcpy@PLT
+	jmp	.L1684
+.L1810:
+	leaq	120(%rsp), %rdx
+	movl	$0, 120(%rsp)
+	cmpq	%rax, %rdx
+	jnb	.L1670
+	cmpq	%rbp, %rdx
+	jnb	.L1811
+.L1670:
+	movq	(%rdi), %rax
+	movl	$4, %edx
+	movl	$1200000, %esi
+	call	*16(%rax)
+	movq	%rax, 272(%rsp)
+	movq	%rax, %rdi
+	movq	288(%rsp), %rax
+	movq	$300000, 280(%rsp)
+	testq	%rax, %rax
+	jne	.L1801
+	testq	%rbp, %rbp
+	jne	.L1679
+	xorl	%eax, %eax
+	movq	%rdi, %rbp
+	jmp	.L1680
+	.p2align 4,,10
+	.p2align 3
+.L1801:
+	leaq	0(,%rax,4), %rdx
+	movq	%rbp, %rsi
+	call	memcpy@PLT
+.L1679:
+	movq	296(%rsp), %rdi
+	leaq	0(,%r12,4), %rdx
+	movl	$4, %ecx
+	movq	%rbp, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	288(%rsp), %rax
+	movq	272(%rsp), %rbp
+	cmpq	$299999, %rax
+	jbe	.L1680
+	jmp	.L1681
+.L1811:
+	leaq	124(%rsp), %r12
+	xorl	%eax, %eax
+	movl	$300000, %esi
+	leaq	272(%rsp), %rdi
+	movq	%r12, %rdx
+	movl	%eax, 124(%rsp)
+	call	_ZN1n6vectorIiE6resizeEmRKi
+.LEHE71:
+	movq	288(%rsp), %rdx
+	movq	272(%rsp), %rbp
+	leaq	4095(%rdx), %rax
+	shrq	$12, %rax
+	jmp	.L1682
+.L1733:
+	movq	%rbp, %rbx
+	jmp	.L1668
+.L1804:
+	jmp	.L1707
+.L1739:
+	movq	%rax, %rbx
+	jmp	.L1709
+.L1792:
+	jmp	.L1793
+	.section	.gcc_except_table
+.LLSDA6926:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6926-.LLSDACSB6926
+.LLSDACSB6926:
+	.uleb128 .LEHB67-.LFB6926
+	.uleb128 .LEHE67-.LEHB67
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB68-.LFB6926
+	.uleb128 .LEHE68-.LEHB68
+	.uleb128 .L1792-.LFB6926
+	.uleb128 0
+	.uleb128 .LEHB69-.LFB6926
+	.uleb128 .LEHE69-.LEHB69
+	.uleb128 .L1739-.LFB6926
+	.uleb128 0
+	.uleb128 .LEHB70-.LFB6926
+	.uleb128 .LEHE70-.LEHB70
+	.uleb128 .L1739-.LFB6926
+	.uleb128 0
+	.uleb128 .LEHB71-.LFB6926
+	.uleb128 .LEHE71-.LEHB71
+	.uleb128 .L1792-.LFB6926
+	.uleb128 0
+.LLSDACSE6926:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6926
+	.type	_Z18test_parallel_findv.cold, @function
+_Z18test_parallel_findv.cold:
+.LFSB6926:
+.L1794:
+	.cfi_def_cfa_offset 1360
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC35(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB72:
+	call	__cxa_throw@PLT
+.L1795:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC36(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE72:
+.L1709:
+	movq	(%rsp), %rdi
+	call	_ZN1n10task_groupD1Ev
+.L1710:
+	movq	272(%rsp), %rsi
+	movq	280(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L1731
+	movq	296(%rsp), %rdi
+	salq	$2, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1731:
+	movq	8(%rsp), %rdi
+	call	_ZN1n11thread_poolD1Ev
+	movq	%rbx, %rdi
+.LEHB73:
+	call	_Unwind_Resume@PLT
+.LEHE73:
+.L1738:
+.L1793:
+	movq	%rax, %rbx
+	jmp	.L1710
+.L1707:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC37(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB74:
+	call	__cxa_throw@PLT
+.LEHE74:
+	.cfi_endproc
+.LFE6926:
+	.section	.gcc_except_table
+.LLSDAC6926:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6926-.LLSDACSBC6926
+.LLSDACSBC6926:
+	.uleb128 .LEHB72-.LCOLDB38
+	.uleb128 .LEHE72-.LEHB72
+	.uleb128 .L1738-.LCOLDB38
+	.uleb128 0
+	.uleb128 .LEHB73-.LCOLDB38
+	.uleb128 .LEHE73-.LEHB73
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB74-.LCOLDB38
+	.uleb128 .LEHE74-.LEHB74
+	.uleb128 .L1738-.LCOLDB38
+	.uleb128 0
+.LLSDACSEC6926:
+	.section	.text.unlikely
+	.text
+	.size	_Z18test_parallel_findv, .-_Z18test_parallel_findv
+	.section	.text.unlikely
+	.size	_Z18test_parallel_findv.cold, .-_Z18test_parallel_findv.cold
+.LCOLDE38:
+	.text
+.LHOTE38:
+	.section	.text._ZN1n14__avx512_countIiEEmPKT_mS1_,"axG",@progbits,_ZN1n14__avx512_countIiEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n14__avx512_countIiEEmPKT_mS1_
+	.type	_ZN1n14__avx512_countIiEEmPKT_mS1_, @function
+_ZN1n14__avx512_countIiEEmPKT_mS1_:
+.LFB7245:
+	.cfi_startproc
+	movq	%rsi, %r8
+	vpbroadcastd	%edx, %zmm2
+	movl	$16, %eax
+	xorl	%r9d, %r9d
+	cmpq	$15, %rsi
+	jbe	.L1836
+	.p2align 4,,10
+	.p2align 3
+.L1816:
+	vmovdqu32	-64(%rdi,%rax,4), %zmm5
+	vpcmpd	$0, %zmm2, %zmm5, %k0
+	kmovw	%k0, %ecx
+	popcntq	%rcx, %rcx
+	addq	%rcx, %r9
+	movq	%rax, %rcx
+	leaq	16(%rax), %rax
+	cmpq	%rax, %r8
+	jnb	.L1816
+	subq	%rcx, %r8
+	je	.L1812
+	leaq	-1(%r8), %rax
+	cmpq	$14, %rax
+	jbe	.L1822
+	movq	%r8, %rsi
+	leaq	(%rdi,%rcx,4), %rax
+	movl	$1, %r10d
+	shrq	$4, %rsi
+	vpxor	%xmm3, %xmm3, %xmm3
+	vpbroadcastd	%r10d, %zmm4
+	salq	$6, %rsi
+	addq	%rax, %rsi
+	.p2align 4,,10
+	.p2align 3
+.L1817:
+	vpcmpd	$0, (%rax), %zmm2, %k1
+	addq	$64, %rax
+	vmovdqa32	%zmm4, %zmm0{%k1}{z}
+	vpmovzxdq	%ymm0, %zmm1
+	vextracti64x4	$0x1, %zmm0, %ymm0
+	vpmovzxdq	%ymm0, %zmm0
+	vpaddq	%zmm0, %zmm1, %zmm1
+	vpaddq	%zmm1, %zmm3, %zmm3
+	cmpq	%rax, %rsi
+	jne	.L1817
+	vmovdqa	%ymm3, %ymm2
+	vextracti64x4	$0x1, %zmm3, %ymm3
+	movq	%r8, %rsi
+	vpaddq	%ymm3, %ymm2, %ymm2
+	andq	$-16, %rsi
+	vextracti128	$0x1, %ymm2, %xmm1
+	vpaddq	%xmm1, %xmm2, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rax
+	testb	$15, %r8b
+	je	.L1818
+.L1814:
+	movq	%r8, %r10
+	subq	%rsi, %r10
+	leaq	-1(%r10), %r11
+	cmpq	$6, %r11
+	jbe	.L1819
+	vmovd	%edx, %xmm1
+	leaq	(%rcx,%rsi), %rax
+	movq	%r10, %r11
+	vpbroadcastd	%xmm1, %ymm1
+	andq	$-8, %r11
+	vpcmpeqd	(%rdi,%rax,4), %ymm1, %ymm1
+	movl	$1, %eax
+	addq	%r11, %rsi
+	andl	$7, %r10d
+	vmovd	%eax, %xmm0
+	vpbroadcastd	%xmm0, %ymm0
+	vpand	%ymm0, %ymm1, %ymm1
+	vpmovzxdq	%xmm1, %ymm0
+	vextracti128	$0x1, %ymm1, %xmm1
+	vpmovzxdq	%xmm1, %ymm1
+	vpaddq	%ymm1, %ymm0, %ymm0
+	vpaddq	%ymm2, %ymm0, %ymm0
+	vmovdqa	%xmm0, %xmm1
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpaddq	%xmm0, %xmm1, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rax
+	je	.L1818
+.L1819:
+	leaq	(%rcx,%rsi), %r10
+	cmpl	%edx, (%rdi,%r10,4)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	1(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1818
+	addq	%rcx, %r10
+	cmpl	%edx, (%rdi,%r10,4)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	2(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1818
+	addq	%rcx, %r10
+	cmpl	%edx, (%rdi,%r10,4)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	3(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1818
+	addq	%rcx, %r10
+	cmpl	%edx, (%rdi,%r10,4)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	4(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1818
+	addq	%rcx, %r10
+	cmpl	%edx, (%rdi,%r10,4)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	5(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1818
+	addq	%rcx, %r10
+	cmpl	%edx, (%rdi,%r10,4)
+	sete	%r10b
+	addq	$6, %rsi
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	cmpq	%r8, %rsi
+	jnb	.L1818
+	addq	%rsi, %rcx
+	cmpl	%edx, (%rdi,%rcx,4)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+.L1818:
+	addq	%rax, %r9
+.L1812:
+	movq	%r9, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1836:
+	testq	%rsi, %rsi
+	je	.L1812
+	xorl	%ecx, %ecx
+	vpxor	%xmm2, %xmm2, %xmm2
+	xorl	%eax, %eax
+	xorl	%esi, %esi
+	jmp	.L1814
+.L1822:
+	vpxor	%xmm2, %xmm2, %xmm2
+	xorl	%eax, %eax
+	xorl	%esi, %esi
+	jmp	.L1814
+	.cfi_endproc
+.LFE7245:
+	.size	_ZN1n14__avx512_countIiEEmPKT_mS1_, .-_ZN1n14__avx512_countIiEEmPKT_mS1_
+	.section	.text._ZN1n12__avx2_countIiEEmPKT_mS1_,"axG",@progbits,_ZN1n12__avx2_countIiEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n12__avx2_countIiEEmPKT_mS1_
+	.type	_ZN1n12__avx2_countIiEEmPKT_mS1_, @function
+_ZN1n12__avx2_countIiEEmPKT_mS1_:
+.LFB7246:
+	.cfi_startproc
+	vmovd	%edx, %xmm2
+	movq	%rsi, %rcx
+	movl	%edx, %r9d
+	xorl	%esi, %esi
+	vpbroadcastd	%xmm2, %ymm2
+	movl	$8, %edx
+	cmpq	$7, %rcx
+	jbe	.L1861
+	.p2align 4,,10
+	.p2align 3
+.L1838:
+	vpcmpeqd	-32(%rdi,%rdx,4), %ymm2, %ymm0
+	vpmovmskb	%ymm0, %eax
+	popcntl	%eax, %eax
+	shrq	$2, %rax
+	addq	%rax, %rsi
+	movq	%rdx, %rax
+	leaq	8(%rdx), %rdx
+	cmpq	%rdx, %rcx
+	jnb	.L1838
+	subq	%rax, %rcx
+	je	.L1837
+	leaq	-1(%rcx), %rdx
+	cmpq	$6, %rdx
+	jbe	.L1847
+	movq	%rcx, %r8
+	movl	$1, %r10d
+	leaq	(%rdi,%rax,4), %rdx
+	shrq	$3, %r8
+	vmovd	%r10d, %xmm4
+	vpxor	%xmm3, %xmm3, %xmm3
+	salq	$5, %r8
+	vpbroadcastd	%xmm4, %ymm4
+	addq	%rdx, %r8
+	.p2align 4,,10
+	.p2align 3
+.L1841:
+	vpcmpeqd	(%rdx), %ymm2, %ymm0
+	addq	$32, %rdx
+	vpand	%ymm4, %ymm0, %ymm0
+	vpmovzxdq	%xmm0, %ymm1
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxdq	%xmm0, %ymm0
+	vpaddq	%ymm0, %ymm1, %ymm0
+	vpaddq	%ymm0, %ymm3, %ymm3
+	cmpq	%rdx, %r8
+	jne	.L1841
+	vmovdqa	%xmm3, %xmm2
+	vextracti128	$0x1, %ymm3, %xmm3
+	movq	%rcx, %r8
+	vpaddq	%xmm3, %xmm2, %xmm2
+	andq	$-8, %r8
+	vpsrldq	$8, %xmm2, %xmm0
+	vpaddq	%xmm0, %xmm2, %xmm0
+	vmovq	%xmm0, %rdx
+	testb	$7, %cl
+	je	.L1842
+.L1839:
+	movq	%rcx, %r10
+	subq	%r8, %r10
+	leaq	-1(%r10), %r11
+	cmpq	$2, %r11
+	jbe	.L1843
+	vmovd	%r9d, %xmm5
+	leaq	(%rax,%r8), %rdx
+	movq	%r10, %r11
+	vpshufd	$0, %xmm5, %xmm0
+	andq	$-4, %r11
+	vpcmpeqd	(%rdi,%rdx,4), %xmm0, %xmm0
+	movl	$1, %edx
+	addq	%r11, %r8
+	andl	$3, %r10d
+	vmovd	%edx, %xmm1
+	vpshufd	$0, %xmm1, %xmm1
+	vpand	%xmm1, %xmm0, %xmm0
+	vpmovzxdq	%xmm0, %xmm1
+	vpsrldq	$8, %xmm0, %xmm0
+	vpmovzxdq	%xmm0, %xmm0
+	vpaddq	%xmm0, %xmm1, %xmm0
+	vpaddq	%xmm2, %xmm0, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rdx
+	je	.L1842
+.L1843:
+	leaq	(%rax,%r8), %r10
+	cmpl	%r9d, (%rdi,%r10,4)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rdx
+	leaq	1(%r8), %r10
+	cmpq	%rcx, %r10
+	jnb	.L1842
+	addq	%rax, %r10
+	cmpl	%r9d, (%rdi,%r10,4)
+	sete	%r10b
+	addq	$2, %r8
+	movzbl	%r10b, %r10d
+	addq	%r10, %rdx
+	cmpq	%rcx, %r8
+	jnb	.L1842
+	addq	%r8, %rax
+	cmpl	%r9d, (%rdi,%rax,4)
+	sete	%al
+	movzbl	%al, %eax
+	addq	%rax, %rdx
+.L1842:
+	addq	%rdx, %rsi
+.L1837:
+	movq	%rsi, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1861:
+	testq	%rcx, %rcx
+	je	.L1837
+	xorl	%eax, %eax
+	vpxor	%xmm2, %xmm2, %xmm2
+	xorl	%edx, %edx
+	xorl	%r8d, %r8d
+	jmp	.L1839
+.L1847:
+	vpxor	%xmm2, %xmm2, %xmm2
+	xorl	%edx, %edx
+	xorl	%r8d, %r8d
+	jmp	.L1839
+	.cfi_endproc
+.LFE7246:
+	.size	_ZN1n12__avx2_countIiEEmPKT_mS1_, .-_ZN1n12__avx2_countIiEEmPKT_mS1_
+	.globl	__popcountdi2
+	.section	.text._ZN1n10simd_countIiEEmPKT_mS1_NS_8simd_isaE,"axG",@progbits,_ZN1n10simd_countIiEEmPKT_mS1_NS_8simd_isaE,comdat
+	.p2align 4
+	.weak	_ZN1n10simd_countIiEEmPKT_mS1_NS_8simd_isaE
+	.type	_ZN1n10simd_countIiEEmPKT_mS1_NS_8simd_isaE, @function
+_ZN1n10simd_countIiEEmPKT_mS1_NS_8simd_isaE:
+.LFB7179:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	movq	%rdi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movl	%edx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movl	%ecx, %ebx
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 64
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1919
+.L1864:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebx
+	jge	.L1920
+.L1898:
+	cmpl	$2, %ebx
+	je	.L1875
+.L1922:
+	cmpl	$3, %ebx
+	je	.L1876
+	cmpl	$1, %ebx
+	je	.L1877
+	xorl	%ebx, %ebx
+	testq	%rbp, %rbp
+	je	.L1862
+	leaq	-1(%rbp), %rax
+	cmpq	$2, %rax
+	jbe	.L1896
+	movq	%rbp, %rdx
+	movd	%r12d, %xmm5
+	pxor	%xmm1, %xmm1
+	movq	%r14, %rax
+	shrq	$2, %rdx
+	movdqa	.LC1(%rip), %xmm2
+	pshufd	$0, %xmm5, %xmm5
+	pxor	%xmm3, %xmm3
+	salq	$4, %rdx
+	addq	%r14, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L1886:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqd	%xmm5, %xmm0
+	pand	%xmm2, %xmm0
+	movdqa	%xmm0, %xmm4
+	punpckldq	%xmm3, %xmm0
+	punpckhdq	%xmm3, %xmm4
+	paddq	%xmm4, %xmm0
+	paddq	%xmm0, %xmm1
+	cmpq	%rax, %rdx
+	jne	.L1886
+	movdqa	%xmm1, %xmm0
+	psrldq	$8, %xmm0
+	paddq	%xmm0, %xmm1
+	movq	%xmm1, %rbx
+	testb	$3, %bpl
+	je	.L1862
+	movq	%rbp, %rax
+	andq	$-4, %rax
+.L1885:
+	xorl	%ecx, %ecx
+	cmpl	%r12d, (%r14,%rax,4)
+	leaq	0(,%rax,4), %rdx
+	sete	%cl
+	addq	%rcx, %rbx
+	leaq	1(%rax), %rcx
+	cmpq	%rbp, %rcx
+	jnb	.L1862
+	xorl	%ecx, %ecx
+	cmpl	%r12d, 4(%r14,%rdx)
+	sete	%cl
+	addq	$2, %rax
+	addq	%rcx, %rbx
+	cmpq	%rbp, %rax
+	jnb	.L1862
+	xorl	%eax, %eax
+	cmpl	%r12d, 8(%r14,%rdx)
+	sete	%al
+	addq	%rax, %rbx
+.L1862:
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+.L1897:
+	.p2align 4,,10
+	.p2align 3
+.L1920:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1921
+.L1871:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %ebx
+	cmpl	$2, %ebx
+	jne	.L1922
+.L1875:
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	movl	%r12d, %edx
+	movq	%rbp, %rsi
+	movq	%r14, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n12__avx2_countIiEEmPKT_mS1_
+	.p2align 4,,10
+	.p2align 3
+.L1919:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1864
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1889
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1866:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1864
+	.p2align 4,,10
+	.p2align 3
+.L1877:
+	movd	%r12d, %xmm5
+	movl	$4, %r13d
+	xorl	%ebx, %ebx
+	pshufd	$0, %xmm5, %xmm5
+	movaps	%xmm5, (%rsp)
+	cmpq	$3, %rbp
+	jbe	.L1923
+	.p2align 4,,10
+	.p2align 3
+.L1880:
+	movdqu	-16(%r14,%r13,4), %xmm0
+	pcmpeqd	(%rsp), %xmm0
+	pmovmskb	%xmm0, %edi
+	call	__popcountdi2@PLT
+	cltq
+	shrq	$2, %rax
+	addq	%rax, %rbx
+	movq	%r13, %rax
+	leaq	4(%r13), %r13
+	cmpq	%r13, %rbp
+	jnb	.L1880
+	subq	%rax, %rbp
+	je	.L1862
+	leaq	-1(%rbp), %rdx
+	cmpq	$2, %rdx
+	jbe	.L1895
+	leaq	(%r14,%rax,4), %rdx
+	pxor	%xmm1, %xmm1
+	pxor	%xmm3, %xmm3
+	movq	%rbp, %rcx
+	shrq	$2, %rcx
+	movdqa	.LC1(%rip), %xmm2
+	salq	$4, %rcx
+	addq	%rdx, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L1883:
+	movdqu	(%rdx), %xmm0
+	addq	$16, %rdx
+	pcmpeqd	(%rsp), %xmm0
+	pand	%xmm2, %xmm0
+	movdqa	%xmm0, %xmm4
+	punpckldq	%xmm3, %xmm0
+	punpckhdq	%xmm3, %xmm4
+	paddq	%xmm4, %xmm0
+	paddq	%xmm0, %xmm1
+	cmpq	%rcx, %rdx
+	jne	.L1883
+	movdqa	%xmm1, %xmm0
+	psrldq	$8, %xmm0
+	paddq	%xmm0, %xmm1
+	movq	%xmm1, %rdx
+	testb	$3, %bpl
+	je	.L1884
+	movq	%rbp, %rcx
+	andq	$-4, %rcx
+.L1881:
+	leaq	(%rcx,%rax), %rsi
+	cmpl	%r12d, (%r14,%rsi,4)
+	sete	%sil
+	movzbl	%sil, %esi
+	addq	%rsi, %rdx
+	leaq	1(%rcx), %rsi
+	cmpq	%rbp, %rsi
+	jnb	.L1884
+	addq	%rax, %rsi
+	cmpl	%r12d, (%r14,%rsi,4)
+	sete	%sil
+	addq	$2, %rcx
+	movzbl	%sil, %esi
+	addq	%rsi, %rdx
+	cmpq	%rbp, %rcx
+	jnb	.L1884
+	addq	%rcx, %rax
+	cmpl	%r12d, (%r14,%rax,4)
+	sete	%al
+	movzbl	%al, %eax
+	addq	%rax, %rdx
+.L1884:
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	addq	%rdx, %rbx
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1876:
+	.cfi_restore_state
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	movl	%r12d, %edx
+	movq	%rbp, %rsi
+	movq	%r14, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n14__avx512_countIiEEmPKT_mS1_
+	.p2align 4,,10
+	.p2align 3
+.L1921:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1871
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1891
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1873:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1871
+.L1891:
+	movl	$3, %eax
+	jmp	.L1873
+	.p2align 4,,10
+	.p2align 3
+.L1923:
+	xorl	%eax, %eax
+	xorl	%edx, %edx
+	xorl	%ecx, %ecx
+	testq	%rbp, %rbp
+	jne	.L1881
+	jmp	.L1862
+.L1896:
+	xorl	%ebx, %ebx
+	xorl	%eax, %eax
+	jmp	.L1885
+.L1889:
+	movl	$3, %eax
+	jmp	.L1866
+.L1895:
+	xorl	%edx, %edx
+	xorl	%ecx, %ecx
+	jmp	.L1881
+	.cfi_endproc
+.LFE7179:
+	.size	_ZN1n10simd_countIiEEmPKT_mS1_NS_8simd_isaE, .-_ZN1n10simd_countIiEEmPKT_mS1_NS_8simd_isaE
+	.text
+	.p2align 4
+	.type	_ZN1n4taskUlPvE8_4_FUNES1_, @function
+_ZN1n4taskUlPvE8_4_FUNES1_:
+.LFB7252:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	xorl	%edx, %edx
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movq	(%rdi), %rbp
+	movq	8(%rdi), %rcx
+	movq	0(%rbp), %rax
+	movq	8(%rbp), %rbx
+	movq	%rcx, %rdi
+	movq	24(%rbp), %r13
+	movq	(%rax), %rax
+	divq	(%rbx)
+	imulq	%rax, %rdi
+	movq	%rdx, %rsi
+	cmpq	%rdx, %rcx
+	cmovbe	%rcx, %rsi
+	addq	$1, %rcx
+	addq	%rdi, %rsi
+	cmpq	%rdx, %rcx
+	cmova	%rdx, %rcx
+	addq	%rdi, %rax
+	leaq	(%rcx,%rax), %rbx
+	movq	16(%rbp), %rax
+	subq	%rsi, %rbx
+	movq	(%rax), %rax
+	leaq	(%rax,%rsi,4), %r12
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1937
+.L1926:
+	movl	0(%r13), %edx
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %ecx
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	call	_ZN1n10simd_countIiEEmPKT_mS1_NS_8simd_isaE
+	movq	32(%rbp), %rdx
+	lock addq	%rax, (%rdx)
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1937:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r14
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1926
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1930
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1928:
+	movq	%r14, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1926
+	.p2align 4,,10
+	.p2align 3
+.L1930:
+	movl	$3, %eax
+	jmp	.L1928
+.L1932:
+	.cfi_endproc
+.LFE7252:
+	.size	_ZN1n4taskUlPvE8_4_FUNES1_, .-_ZN1n4taskUlPvE8_4_FUNES1_
+	.section	.rodata.str1.8
+	.align 8
+.LC41:
+	.string	"expected equal : expected value : n::count(pool, v.iter(), 42), actual value : n::count(v.iter(), 42)"
+	.align 8
+.LC42:
+	.string	"expected equal : expected value : n::count(pool, v.iter(), [](int i) { return i < 100; }), actual value : n::count(v.iter(), [](int i) { return i < 100; })"
+	.section	.text.unlikely
+.LCOLDB43:
+	.text
+.LHOTB43:
+	.p2align 4
+	.globl	_Z19test_parallel_countv
+	.type	_Z19test_parallel_countv, @function
+_Z19test_parallel_countv:
+.LFB6919:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6919
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$1240, %rsp
+	.cfi_def_cfa_offset 1296
+	leaq	304(%rsp), %r14
+	movq	%r14, %rdi
+	movq	%r14, 48(%rsp)
+.LEHB75:
+	call	_ZN1n11thread_poolC2Em.constprop.1
+.LEHE75:
+	leaq	176(%rsp), %rdi
+.LEHB76:
+	call	_Z7numbersi.constprop.0
+.LEHE76:
+	movq	176(%rsp), %rax
+	movq	192(%rsp), %rbx
+	leaq	560(%rsp), %r15
+	movl	$42, 256(%rsp)
+	movq	$0, 136(%rsp)
+	leaq	552(%rsp), %r12
+	movq	%rax, 40(%rsp)
+	movq	%rax, 112(%rsp)
+	leaq	4095(%rbx), %rax
+	shrq	$12, %rax
+	movq	%rbx, 120(%rsp)
+	movq	%rax, %rcx
+	movq	%rax, 56(%rsp)
+	movq	320(%rsp), %rax
+	movq	$0, 552(%rsp)
+	leaq	4(,%rax,4), %r13
+	movl	$1, %eax
+	movq	$0, 560(%rsp)
+	cmpq	%rcx, %r13
+	movq	%r15, 1216(%rsp)
+	cmova	%rcx, %r13
+	leaq	544(%rsp), %rcx
+	movq	$0, 568(%rsp)
+	movq	%rcx, 16(%rsp)
+	testq	%r13, %r13
+	movq	%r14, 544(%rsp)
+	leaq	208(%rsp), %r14
+	cmove	%rax, %r13
+	leaq	120(%rsp), %rax
+	xorl	%ebp, %ebp
+	xorl	%edx, %edx
+	movq	%rax, %xmm0
+	leaq	128(%rsp), %rax
+	movq	%rax, %xmm6
+	leaq	112(%rsp), %rax
+	movq	%r13, 128(%rsp)
+	punpcklqdq	%xmm6, %xmm0
+	movaps	%xmm0, 208(%rsp)
+	movq	%rax, %xmm0
+	leaq	256(%rsp), %rax
+	movq	%rax, 32(%rsp)
+	leaq	136(%rsp), %rax
+	movq	%rax, 240(%rsp)
+	movq	%r15, %rax
+	movhps	32(%rsp), %xmm0
+	movaps	%xmm0, 224(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1939:
+	leaq	1(%rdx), %rcx
+	leaq	(%rdx,%rdx,4), %rdx
+	salq	$4, %rdx
+	movq	%rcx, 8(%rax)
+	leaq	16(%rax,%rdx), %rsi
+	leaq	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_5countIS2_NS_5sliceIKiEEiEEmRT_T0_RKT1_EUlmE_EEvmOS8_EUlvE_EE(%rip), %rax
+	movq	$0, 56(%rsi)
+	movq	%r14, (%rsi)
+	movq	%rbp, 8(%rsi)
+	movq	%rax, 48(%rsi)
+	movq	%r12, 64(%rsi)
+	lock addq	$1, 552(%rsp)
+	movq	16(%rsp), %rax
+	movq	544(%rsp), %rdi
+	movq	%rax, 8(%rsp)
+.LEHB77:
+	call	_ZN1n11thread_pool6__pushEPNS_11__task_nodeE
+	addq	$1, %rbp
+	cmpq	%rbp, %r13
+	je	.L1944
+	movq	1216(%rsp), %rax
+	movq	8(%rax), %rdx
+	cmpq	$8, %rdx
+	jne	.L1939
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	je	.L2090
+.L1940:
+	movq	%rax, 1216(%rsp)
+	movq	8(%rax), %rdx
+	jmp	.L1939
+	.p2align 4,,10
+	.p2align 3
+.L1944:
+	leaq	544(%rsp), %r14
+	movq	%r14, %rdi
+	movq	%r14, 8(%rsp)
+	call	_ZN1n10task_group4syncEv
+.LEHE77:
+	leaq	152(%rsp), %rdx
+	leaq	160(%rsp), %rax
+	movq	%r14, %rdi
+	movq	%r15, %r14
+	movq	%rax, %xmm7
+	movq	%rdx, %xmm6
+	leaq	144(%rsp), %rax
+	punpcklqdq	%xmm7, %xmm6
+	leaq	111(%rsp), %rdx
+	movaps	%xmm6, 16(%rsp)
+	movq	%rdx, %xmm7
+	movq	%rax, %xmm6
+	punpcklqdq	%xmm6, %xmm7
+	movaps	%xmm7, 64(%rsp)
+	call	_ZN1n10task_group4syncEv
+	movq	%rbx, 80(%rsp)
+	movq	%r12, 88(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1957:
+	movq	%r14, %r13
+	xorl	%ebx, %ebx
+	movq	(%r14), %r14
+	movq	8(%r13), %rbp
+	leaq	16(%r13), %r12
+	testq	%rbp, %rbp
+	je	.L1952
+	.p2align 4,,10
+	.p2align 3
+.L1953:
+	movq	48(%r12), %rax
+	testq	%rax, %rax
+	je	.L1950
+	addq	$1, %rbx
+	movq	56(%r12), %rsi
+	movq	%r12, %rdi
+	addq	$80, %r12
+	call	*16(%rax)
+	cmpq	%rbx, %rbp
+	jne	.L1953
+.L1952:
+	cmpq	%r15, %r13
+	je	.L1949
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2091
+.L1955:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %ecx
+	movl	$656, %edx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1949:
+	testq	%r14, %r14
+	jne	.L1957
+	movq	80(%rsp), %rbx
+	movq	88(%rsp), %r12
+	movq	136(%rsp), %rbp
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L2092
+.L1959:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %ecx
+	movq	40(%rsp), %rdi
+	movl	$42, %edx
+	movq	%rbx, %rsi
+	call	_ZN1n10simd_countIiEEmPKT_mS1_NS_8simd_isaE
+	cmpq	%rax, %rbp
+	jne	.L1964
+	movq	40(%rsp), %rax
+	movdqa	16(%rsp), %xmm7
+	movq	%rbx, 152(%rsp)
+	leaq	560(%rsp), %r14
+	movdqa	64(%rsp), %xmm6
+	movq	$0, 168(%rsp)
+	movq	%rax, 144(%rsp)
+	movq	320(%rsp), %rax
+	movq	$0, 552(%rsp)
+	leaq	4(,%rax,4), %r13
+	movq	56(%rsp), %rax
+	movq	$0, 560(%rsp)
+	movq	$0, 568(%rsp)
+	cmpq	%rax, %r13
+	movq	%r15, 1216(%rsp)
+	leaq	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_5countIS2_NS_5sliceIKiEEZ19test_parallel_countvEUliE_EEmRT_T0_OT1_EUlmE_EEvmOS9_EUlvE_EE(%rip), %r15
+	cmova	%rax, %r13
+	movl	$1, %eax
+	movaps	%xmm7, 256(%rsp)
+	movaps	%xmm6, 272(%rsp)
+	testq	%r13, %r13
+	cmove	%rax, %r13
+	leaq	168(%rsp), %rax
+	xorl	%ebp, %ebp
+	xorl	%edx, %edx
+	movq	%rax, 288(%rsp)
+	movq	48(%rsp), %rax
+	movq	%r13, 160(%rsp)
+	movq	%rax, 544(%rsp)
+	movq	%r14, %rax
+	.p2align 4,,10
+	.p2align 3
+.L1967:
+	leaq	1(%rdx), %rcx
+	leaq	(%rdx,%rdx,4), %rdx
+	salq	$4, %rdx
+	movq	%rcx, 8(%rax)
+	leaq	16(%rax,%rdx), %rsi
+	movq	32(%rsp), %rax
+	movq	$0, 56(%rsi)
+	movq	%rax, (%rsi)
+	movq	%rbp, 8(%rsi)
+	movq	%r15, 48(%rsi)
+	movq	%r12, 64(%rsi)
+	lock addq	$1, 552(%rsp)
+	movq	544(%rsp), %rdi
+.LEHB78:
+	call	_ZN1n11thread_pool6__pushEPNS_11__task_nodeE
+	addq	$1, %rbp
+	cmpq	%rbp, %r13
+	je	.L1972
+	movq	1216(%rsp), %rax
+	movq	8(%rax), %rdx
+	cmpq	$8, %rdx
+	jne	.L1967
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	je	.L2093
+.L1968:
+	movq	%rax, 1216(%rsp)
+	movq	8(%rax), %rdx
+	jmp	.L1967
+	.p2align 4,,10
+	.p2align 3
+.L1950:
+	addq	$1, %rbx
+	addq	$80, %r12
+	cmpq	%rbx, %rbp
+	jne	.L1953
+	jmp	.L1952
+	.p2align 4,,10
+	.p2align 3
+.L2091:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1955
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1955
+	.p2align 4,,10
+	.p2align 3
+.L1972:
+	movq	8(%rsp), %r15
+	movq	%r15, %rdi
+	call	_ZN1n10task_group4syncEv
+.LEHE78:
+	movq	%r15, %rdi
+	movq	%r14, %r13
+	call	_ZN1n10task_group4syncEv
+	movq	%rbx, 8(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1985:
+	movq	%r13, %r15
+	xorl	%ebx, %ebx
+	movq	0(%r13), %r13
+	movq	8(%r15), %r12
+	leaq	16(%r15), %rbp
+	testq	%r12, %r12
+	je	.L1980
+	.p2align 4,,10
+	.p2align 3
+.L1981:
+	movq	48(%rbp), %rdx
+	testq	%rdx, %rdx
+	je	.L1978
+	addq	$1, %rbx
+	movq	56(%rbp), %rsi
+	movq	%rbp, %rdi
+	addq	$80, %rbp
+	call	*16(%rdx)
+	cmpq	%rbx, %r12
+	jne	.L1981
+.L1980:
+	cmpq	%r14, %r15
+	je	.L1977
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2094
+.L1983:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %ecx
+	movl	$656, %edx
+	movq	%r15, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1977:
+	testq	%r13, %r13
+	jne	.L1985
+	movq	8(%rsp), %rbx
+	movl	$1024, %edx
+	movq	40(%rsp), %rcx
+	movq	168(%rsp), %rax
+	cmpq	%rdx, %rbx
+	movq	%rbx, %rsi
+	cmovbe	%rbx, %rdx
+	leaq	(%rcx,%rdx,4), %r8
+	subq	%rdx, %rsi
+	testq	%rbx, %rbx
+	je	.L1987
+	movq	%rcx, %rdi
+	leaq	-1(%rdx), %rcx
+	movdqa	.LC0(%rip), %xmm5
+	xorl	%ebx, %ebx
+	movdqa	.LC1(%rip), %xmm4
+	pxor	%xmm2, %xmm2
+	cmpq	$2, %rcx
+	jbe	.L2095
+	.p2align 4,,10
+	.p2align 3
+.L2084:
+	movq	%rdx, %r9
+	movq	%rdi, %rcx
+	pxor	%xmm1, %xmm1
+	shrq	$2, %r9
+	salq	$4, %r9
+	addq	%rdi, %r9
+	.p2align 4,,10
+	.p2align 3
+.L1989:
+	movdqu	(%rcx), %xmm0
+	addq	$16, %rcx
+	pcmpgtd	%xmm5, %xmm0
+	pandn	%xmm4, %xmm0
+	movdqa	%xmm0, %xmm3
+	punpckldq	%xmm2, %xmm0
+	punpckhdq	%xmm2, %xmm3
+	paddq	%xmm3, %xmm0
+	paddq	%xmm0, %xmm1
+	cmpq	%rcx, %r9
+	jne	.L1989
+	movdqa	%xmm1, %xmm0
+	psrldq	$8, %xmm0
+	paddq	%xmm0, %xmm1
+	movq	%xmm1, %rcx
+	addq	%rcx, %rbx
+	movq	%rdx, %rcx
+	andq	$-4, %rcx
+	testb	$3, %dl
+	je	.L1990
+.L1995:
+	cmpl	$99, (%rdi,%rcx,4)
+	leaq	0(,%rcx,4), %r9
+	jg	.L1991
+	addq	$1, %rbx
+.L1991:
+	leaq	1(%rcx), %r10
+	cmpq	%rdx, %r10
+	jnb	.L1990
+	cmpl	$99, 4(%rdi,%r9)
+	jg	.L1992
+	addq	$1, %rbx
+.L1992:
+	addq	$2, %rcx
+	cmpq	%rdx, %rcx
+	jnb	.L1990
+	cmpl	$99, 8(%rdi,%r9)
+	jg	.L1990
+	addq	$1, %rbx
+.L1990:
+	movl	$1024, %edx
+	movq	%rsi, %rcx
+	movq	%r8, %rdi
+	cmpq	%rdx, %rsi
+	cmovbe	%rsi, %rdx
+	leaq	(%r8,%rdx,4), %r9
+	subq	%rdx, %rcx
+	testq	%rsi, %rsi
+	je	.L1987
+	movq	%rcx, %rsi
+	leaq	-1(%rdx), %rcx
+	movq	%r9, %r8
+	cmpq	$2, %rcx
+	ja	.L2084
+.L2095:
+	xorl	%ecx, %ecx
+	jmp	.L1995
+	.p2align 4,,10
+	.p2align 3
+.L1978:
+	addq	$1, %rbx
+	addq	$80, %rbp
+	cmpq	%rbx, %r12
+	jne	.L1981
+	jmp	.L1980
+	.p2align 4,,10
+	.p2align 3
+.L2094:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1983
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1983
+	.p2align 4,,10
+	.p2align 3
+.L1987:
+	movq	184(%rsp), %rdx
+	cmpq	%rbx, %rax
+	jne	.L2083
+	movq	40(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L1998
+	movq	200(%rsp), %rdi
+	salq	$2, %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1998:
+	leaq	424(%rsp), %r14
+	movq	%r14, %rdi
+	call	pthread_mutex_lock@PLT
+	movb	$1, 528(%rsp)
+	lock addq	$1, 512(%rsp)
+	xorl	%ebx, %ebx
+	leaq	464(%rsp), %r15
+	movq	%r15, %rdi
+	call	pthread_cond_broadcast@PLT
+	movq	%r14, %rdi
+	call	pthread_mutex_unlock@PLT
+	cmpq	$0, 320(%rsp)
+	je	.L2002
+	.p2align 4,,10
+	.p2align 3
+.L1999:
+	movq	304(%rsp), %rax
+	xorl	%esi, %esi
+	movq	(%rax,%rbx,8), %rax
+	addq	$1, %rbx
+	movq	24(%rax), %rdi
+	call	pthread_join@PLT
+	movq	320(%rsp), %rax
+	cmpq	%rax, %rbx
+	jb	.L1999
+	testq	%rax, %rax
+	je	.L2002
+	movq	%r14, 8(%rsp)
+	xorl	%ebp, %ebp
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %r13
+	movq	%r15, 32(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L2016:
+	movq	304(%rsp), %rax
+	movq	(%rax,%rbp,8), %r14
+	movq	136(%r14), %r12
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2096
+.L2004:
+	movq	(%r12), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%r12, %rsi
+	movl	$8, %ecx
+	xorl	%r12d, %r12d
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	$0, 160(%r14)
+	jne	.L2006
+	jmp	.L2012
+	.p2align 4,,10
+	.p2align 3
+.L2010:
+	movq	(%r15), %rax
+	movl	$8, %ecx
+	movq	%r15, %rsi
+	addq	$1, %r12
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	160(%r14), %r12
+	jnb	.L2012
+.L2006:
+	movq	144(%r14), %rax
+	movq	(%rax,%r12,8), %r15
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L2010
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2010
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%r13, _ZZN1n4heapEvE7storage(%rip)
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2010
+	.p2align 4,,10
+	.p2align 3
+.L2012:
+	movq	144(%r14), %rsi
+	testq	%rsi, %rsi
+	je	.L2008
+	movq	152(%r14), %rax
+	movq	168(%r14), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2008:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2097
+.L2014:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$64, %ecx
+	movl	$192, %edx
+	movq	%r14, %rsi
+	addq	$1, %rbp
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	320(%rsp), %rbp
+	jb	.L2016
+	movq	8(%rsp), %r14
+	movq	32(%rsp), %r15
+.L2002:
+	movq	%r15, %rdi
+	call	pthread_cond_destroy@PLT
+	movq	%r14, %rdi
+	call	pthread_mutex_destroy@PLT
+	leaq	336(%rsp), %rdi
+	call	pthread_mutex_destroy@PLT
+	movq	376(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L2001
+	movq	384(%rsp), %rax
+	movq	400(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2001:
+	movq	304(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L1938
+	movq	312(%rsp), %rax
+	movq	328(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1938:
+	addq	$1240, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2097:
+	.cfi_restore_state
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2014
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2014
+	.p2align 4,,10
+	.p2align 3
+.L2096:
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2004
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2004
+.L2093:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2098
+.L1970:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %edx
+	movl	$656, %esi
+	movq	(%rdi), %rax
+.LEHB79:
+	call	*16(%rax)
+.LEHE79:
+	movq	%rax, %rdx
+	movl	$82, %ecx
+	xorl	%eax, %eax
+	movq	%rdx, %rdi
+	rep stosq
+	movq	1216(%rsp), %rax
+	movq	%rdx, (%rax)
+	movq	1216(%rsp), %rax
+	movq	(%rax), %rax
+	jmp	.L1968
+.L2090:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2099
+.L1942:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %edx
+	movl	$656, %esi
+	leaq	544(%rsp), %rcx
+	movq	%rcx, 8(%rsp)
+	movq	(%rdi), %rax
+.LEHB80:
+	call	*16(%rax)
+.LEHE80:
+	movq	%rax, %rdx
+	movl	$82, %ecx
+	xorl	%eax, %eax
+	movq	%rdx, %rdi
+	rep stosq
+	movq	1216(%rsp), %rax
+	movq	%rdx, (%rax)
+	movq	1216(%rsp), %rax
+	movq	(%rax), %rax
+	jmp	.L1940
+.L2092:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1959
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L2020
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1963:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1959
+.L2099:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	testl	%eax, %eax
+	je	.L1942
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1942
+.L2098:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	testl	%eax, %eax
+	je	.L1970
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1970
+.L2020:
+	movl	$3, %eax
+	jmp	.L1963
+.L2030:
+	movq	%rax, %rbx
+	jmp	.L1988
+.L2026:
+	movq	%rax, %rbx
+	jmp	.L2019
+.L2028:
+	movq	%rax, %rbx
+	jmp	.L1988
+.L2029:
+	.section	.gcc_except_table
+.LLSDA6919:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6919-.LLSDACSB6919
+.LLSDACSB6919:
+	.uleb128 .LEHB75-.LFB6919
+	.uleb128 .LEHE75-.LEHB75
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB76-.LFB6919
+	.uleb128 .LEHE76-.LEHB76
+	.uleb128 .L2026-.LFB6919
+	.uleb128 0
+	.uleb128 .LEHB77-.LFB6919
+	.uleb128 .LEHE77-.LEHB77
+	.uleb128 .L2028-.LFB6919
+	.uleb128 0
+	.uleb128 .LEHB78-.LFB6919
+	.uleb128 .LEHE78-.LEHB78
+	.uleb128 .L2030-.LFB6919
+	.uleb128 0
+	.uleb128 .LEHB79-.LFB6919
+	.uleb128 .LEHE79-.LEHB79
+	.uleb128 .L2030-.LFB6919
+	.uleb128 0
+	.uleb128 .LEHB80-.LFB6919
+	.uleb128 .LEHE80-.LEHB80
+	.uleb128 .L2028-.LFB6919
+	.uleb128 0
+.LLSDACSE6919:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6919
+	.type	_Z19test_parallel_countv.cold, @function
+_Z19test_parallel_countv.cold:
+.LFSB6919:
+.L1964:
+	.cfi_def_cfa_offset 1296
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC41(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB81:
+	call	__cxa_throw@PLT
+.L2083:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC42(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE81:
+.L1988:
+	movq	8(%rsp), %rdi
+	call	_ZN1n10task_groupD1Ev
+.L1961:
+	cmpq	$0, 40(%rsp)
+	movq	184(%rsp), %rdx
+	je	.L2019
+	movq	40(%rsp), %rsi
+	salq	$2, %rdx
+	movl	$4, %ecx
+	movq	200(%rsp), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2019:
+	movq	48(%rsp), %rdi
+	call	_ZN1n11thread_poolD1Ev
+	movq	%rbx, %rdi
+.LEHB82:
+	call	_Unwind_Resume@PLT
+.LEHE82:
+.L2027:
+	movq	%rax, %rbx
+	jmp	.L1961
+	.cfi_endproc
+.LFE6919:
+	.section	.gcc_except_table
+.LLSDAC6919:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6919-.LLSDACSBC6919
+.LLSDACSBC6919:
+	.uleb128 .LEHB81-.LCOLDB43
+	.uleb128 .LEHE81-.LEHB81
+	.uleb128 .L2027-.LCOLDB43
+	.uleb128 0
+	.uleb128 .LEHB82-.LCOLDB43
+	.uleb128 .LEHE82-.LEHB82
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6919:
+	.section	.text.unlikely
+	.text
+	.size	_Z19test_parallel_countv, .-_Z19test_parallel_countv
+	.section	.text.unlikely
+	.size	_Z19test_parallel_countv.cold, .-_Z19test_parallel_countv.cold
+.LCOLDE43:
+	.text
+.LHOTE43:
+	.section	.text._ZN1n13__avx512_findIiEEmPKT_mS1_,"axG",@progbits,_ZN1n13__avx512_findIiEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n13__avx512_findIiEEmPKT_mS1_
+	.type	_ZN1n13__avx512_findIiEEmPKT_mS1_, @function
+_ZN1n13__avx512_findIiEEmPKT_mS1_:
+.LFB7275:
+	.cfi_startproc
+	xorl	%ecx, %ecx
+	vpbroadcastd	%edx, %zmm0
+	jmp	.L2101
+	.p2align 4,,10
+	.p2align 3
+.L2103:
+	vmovdqu32	-64(%rdi,%rcx,4), %zmm1
+	vpcmpd	$0, %zmm0, %zmm1, %k0
+	kortestq	%k0, %k0
+	jne	.L2110
+.L2101:
+	movq	%rcx, %rax
+	leaq	16(%rcx), %rcx
+	cmpq	%rcx, %rsi
+	jnb	.L2103
+	subq	%rax, %rsi
+	je	.L2106
+	leaq	(%rdi,%rax,4), %rdi
+	xorl	%ecx, %ecx
+	jmp	.L2105
+	.p2align 4,,10
+	.p2align 3
+.L2111:
+	addq	$1, %rcx
+	cmpq	%rcx, %rsi
+	je	.L2106
+.L2105:
+	cmpl	(%rdi,%rcx,4), %edx
+	jne	.L2111
+	addq	%rcx, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2106:
+	movq	$-1, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2110:
+	kmovq	%k0, %rdx
+	rep bsfq	%rdx, %rdx
+	movslq	%edx, %rdx
+	addq	%rdx, %rax
+	vzeroupper
+	ret
+	.cfi_endproc
+.LFE7275:
+	.size	_ZN1n13__avx512_findIiEEmPKT_mS1_, .-_ZN1n13__avx512_findIiEEmPKT_mS1_
+	.section	.text._ZN1n11__avx2_findIiEEmPKT_mS1_,"axG",@progbits,_ZN1n11__avx2_findIiEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n11__avx2_findIiEEmPKT_mS1_
+	.type	_ZN1n11__avx2_findIiEEmPKT_mS1_, @function
+_ZN1n11__avx2_findIiEEmPKT_mS1_:
+.LFB7276:
+	.cfi_startproc
+	vmovd	%edx, %xmm1
+	xorl	%eax, %eax
+	vpbroadcastd	%xmm1, %ymm1
+	jmp	.L2113
+	.p2align 4,,10
+	.p2align 3
+.L2115:
+	vpcmpeqd	-128(%rdi,%rax,4), %ymm1, %ymm2
+	vpcmpeqd	-96(%rdi,%rax,4), %ymm1, %ymm0
+	vpcmpeqd	-64(%rdi,%rax,4), %ymm1, %ymm3
+	vpor	%ymm2, %ymm0, %ymm0
+	vpcmpeqd	-32(%rdi,%rax,4), %ymm1, %ymm2
+	vpor	%ymm3, %ymm2, %ymm2
+	vpor	%ymm2, %ymm0, %ymm0
+	vptest	%ymm0, %ymm0
+	jne	.L2116
+.L2113:
+	movq	%rax, %rcx
+	addq	$32, %rax
+	cmpq	%rax, %rsi
+	jnb	.L2115
+	movq	%rcx, %rax
+	leaq	8(%rcx), %rcx
+	cmpq	%rcx, %rsi
+	jb	.L2128
+	.p2align 4,,10
+	.p2align 3
+.L2118:
+	vpcmpeqd	-32(%rdi,%rcx,4), %ymm1, %ymm0
+	vpmovmskb	%ymm0, %r8d
+	testl	%r8d, %r8d
+	jne	.L2129
+.L2116:
+	movq	%rcx, %rax
+	leaq	8(%rcx), %rcx
+	cmpq	%rcx, %rsi
+	jnb	.L2118
+.L2128:
+	subq	%rax, %rsi
+	je	.L2121
+	leaq	(%rdi,%rax,4), %rdi
+	xorl	%ecx, %ecx
+	jmp	.L2120
+	.p2align 4,,10
+	.p2align 3
+.L2130:
+	addq	$1, %rcx
+	cmpq	%rcx, %rsi
+	je	.L2121
+.L2120:
+	cmpl	(%rdi,%rcx,4), %edx
+	jne	.L2130
+	addq	%rcx, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2121:
+	movq	$-1, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2129:
+	rep bsfl	%r8d, %r8d
+	movslq	%r8d, %r8
+	shrq	$2, %r8
+	addq	%r8, %rax
+	vzeroupper
+	ret
+	.cfi_endproc
+.LFE7276:
+	.size	_ZN1n11__avx2_findIiEEmPKT_mS1_, .-_ZN1n11__avx2_findIiEEmPKT_mS1_
+	.text
+	.p2align 4
+	.type	_ZN1n4taskUlPvE14_4_FUNES1_, @function
+_ZN1n4taskUlPvE14_4_FUNES1_:
+.LFB7327:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%edx, %edx
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	(%rdi), %r14
+	movq	8(%rdi), %rcx
+	movq	(%r14), %rax
+	movq	8(%r14), %rsi
+	movq	(%rax), %rax
+	divq	(%rsi)
+	movq	%rcx, %rsi
+	imulq	%rax, %rsi
+	movq	%rdx, %r13
+	cmpq	%rdx, %rcx
+	cmovbe	%rcx, %r13
+	addq	$1, %rcx
+	addq	%rsi, %r13
+	cmpq	%rdx, %rcx
+	cmova	%rdx, %rcx
+	addq	%rsi, %rax
+	leaq	(%rcx,%rax), %rbx
+	cmpq	%rbx, %r13
+	jnb	.L2131
+	.p2align 4,,10
+	.p2align 3
+.L2132:
+	movq	16(%r14), %rax
+	movq	(%rax), %rax
+	cmpq	%r13, %rax
+	jb	.L2131
+	movq	%rbx, %rbp
+	movl	$4096, %eax
+	subq	%r13, %rbp
+	cmpq	%rax, %rbp
+	cmova	%rax, %rbp
+	movq	24(%r14), %rax
+	movq	8(%rax), %rdx
+	movq	(%rax), %rax
+	movq	(%rax), %rax
+	leaq	(%rax,%r13,4), %r12
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L2197
+.L2135:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %r15d
+	movl	(%rdx), %r8d
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L2198
+.L2139:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %r15d
+	jge	.L2199
+.L2174:
+	cmpl	$2, %r15d
+	je	.L2151
+.L2202:
+	cmpl	$3, %r15d
+	je	.L2152
+	cmpl	$1, %r15d
+	je	.L2153
+	xorl	%eax, %eax
+	cmpq	%r13, %rbx
+	jne	.L2154
+	jmp	.L2155
+	.p2align 4,,10
+	.p2align 3
+.L2200:
+	addq	$1, %rax
+	cmpq	%rax, %rbp
+	je	.L2155
+.L2154:
+	cmpl	(%r12,%rax,4), %r8d
+	jne	.L2200
+	jmp	.L2161
+	.p2align 4,,10
+	.p2align 3
+.L2152:
+	movl	%r8d, %edx
+	movq	%rbp, %rsi
+	movq	%r12, %rdi
+	call	_ZN1n13__avx512_findIiEEmPKT_mS1_
+.L2156:
+	cmpq	$-1, %rax
+	jne	.L2161
+.L2155:
+	addq	$4096, %r13
+	cmpq	%rbx, %r13
+	jb	.L2132
+.L2131:
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L2173:
+	.p2align 4,,10
+	.p2align 3
+.L2199:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L2201
+.L2147:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %r15d
+	cmpl	$2, %r15d
+	jne	.L2202
+.L2151:
+	movl	%r8d, %edx
+	movq	%rbp, %rsi
+	movq	%r12, %rdi
+	call	_ZN1n11__avx2_findIiEEmPKT_mS1_
+	jmp	.L2156
+	.p2align 4,,10
+	.p2align 3
+.L2197:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rdi
+	movq	%rdx, 8(%rsp)
+	call	__cxa_guard_acquire@PLT
+	movq	8(%rsp), %rdx
+	testl	%eax, %eax
+	je	.L2135
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movq	8(%rsp), %rdx
+	movl	12(%rax), %eax
+	movl	%eax, %ecx
+	andl	$2129920, %ecx
+	cmpl	$2129920, %ecx
+	je	.L2165
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L2137:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rdi
+	movq	%rdx, 8(%rsp)
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	movq	8(%rsp), %rdx
+	jmp	.L2135
+.L2172:
+	.p2align 4,,10
+	.p2align 3
+.L2198:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rdi
+	movl	%r8d, 8(%rsp)
+	call	__cxa_guard_acquire@PLT
+	movl	8(%rsp), %r8d
+	testl	%eax, %eax
+	je	.L2139
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	8(%rsp), %r8d
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L2167
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L2142:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rdi
+	movl	%r8d, 8(%rsp)
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	movl	8(%rsp), %r8d
+	jmp	.L2139
+	.p2align 4,,10
+	.p2align 3
+.L2153:
+	movd	%r8d, %xmm4
+	movq	%rbp, %rdi
+	xorl	%eax, %eax
+	pshufd	$0, %xmm4, %xmm2
+	andq	$-16, %rdi
+	jmp	.L2157
+	.p2align 4,,10
+	.p2align 3
+.L2159:
+	movdqu	-64(%r12,%rax,4), %xmm0
+	movdqu	-48(%r12,%rax,4), %xmm1
+	movdqu	-16(%r12,%rax,4), %xmm3
+	pcmpeqd	%xmm2, %xmm1
+	pcmpeqd	%xmm2, %xmm0
+	pcmpeqd	%xmm2, %xmm3
+	por	%xmm1, %xmm0
+	movdqu	-32(%r12,%rax,4), %xmm1
+	pcmpeqd	%xmm2, %xmm1
+	por	%xmm3, %xmm1
+	por	%xmm1, %xmm0
+	pmovmskb	%xmm0, %ecx
+	testl	%ecx, %ecx
+	jne	.L2160
+.L2157:
+	movq	%rax, %rdx
+	addq	$16, %rax
+	cmpq	%rdi, %rdx
+	jne	.L2159
+	movq	%rdx, %rax
+	leaq	4(%rdx), %rdx
+	cmpq	%rdx, %rbp
+	jb	.L2203
+	.p2align 4,,10
+	.p2align 3
+.L2162:
+	movdqu	-16(%r12,%rdx,4), %xmm0
+	pcmpeqd	%xmm2, %xmm0
+	pmovmskb	%xmm0, %ecx
+	testl	%ecx, %ecx
+	jne	.L2204
+.L2160:
+	movq	%rdx, %rax
+	leaq	4(%rdx), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L2162
+.L2203:
+	cmpq	%rax, %rbp
+	jne	.L2163
+	jmp	.L2155
+	.p2align 4,,10
+	.p2align 3
+.L2205:
+	addq	$1, %rax
+	cmpq	%rax, %rbp
+	je	.L2155
+.L2163:
+	cmpl	(%r12,%rax,4), %r8d
+	jne	.L2205
+	addq	%rax, %r13
+	movq	16(%r14), %rax
+	movq	(%rax), %rax
+.L2164:
+	cmpq	%rax, %r13
+	jnb	.L2131
+	movq	16(%r14), %rdx
+	lock cmpxchgq	%r13, (%rdx)
+	jne	.L2164
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2204:
+	.cfi_restore_state
+	rep bsfl	%ecx, %ecx
+	movslq	%ecx, %rcx
+	shrq	$2, %rcx
+	addq	%rcx, %rax
+.L2161:
+	addq	%rax, %r13
+	movq	16(%r14), %rax
+	movq	(%rax), %rax
+	jmp	.L2164
+	.p2align 4,,10
+	.p2align 3
+.L2201:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r15
+	movl	%r8d, 8(%rsp)
+	movq	%r15, %rdi
+	call	__cxa_guard_acquire@PLT
+	movl	8(%rsp), %r8d
+	testl	%eax, %eax
+	je	.L2147
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	8(%rsp), %r8d
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L2169
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L2149:
+	movq	%r15, %rdi
+	movl	%r8d, 8(%rsp)
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	movl	8(%rsp), %r8d
+	jmp	.L2147
+.L2167:
+	movl	$3, %eax
+	jmp	.L2142
+.L2165:
+	movl	$3, %eax
+	jmp	.L2137
+.L2169:
+	movl	$3, %eax
+	jmp	.L2149
+	.cfi_endproc
+.LFE7327:
+	.size	_ZN1n4taskUlPvE14_4_FUNES1_, .-_ZN1n4taskUlPvE14_4_FUNES1_
+	.section	.text._ZN1n4swapINS_6stringIcEEEEvRT_S4_,"axG",@progbits,_ZN1n4swapINS_6stringIcEEEEvRT_S4_,comdat
+	.p2align 4
+	.weak	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	.type	_ZN1n4swapINS_6stringIcEEEEvRT_S4_, @function
+_ZN1n4swapINS_6stringIcEEEEvRT_S4_:
+.LFB7388:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7388
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 112
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L2226
+.L2208:
+	movdqu	(%rbx), %xmm1
+	pxor	%xmm0, %xmm0
+	movq	16(%rbx), %r13
+	movaps	%xmm0, 48(%rsp)
+	movhlps	%xmm1, %xmm7
+	movaps	%xmm1, (%rsp)
+	movq	%xmm7, %r12
+	cmpq	$23, %r12
+	je	.L2227
+	movq	24(%rbx), %rax
+	movq	$23, 8(%rbx)
+	movq	$0, (%rbx)
+	movq	%rax, 40(%rsp)
+	movb	$0, 24(%rbx)
+	cmpq	%rbp, %rbx
+	je	.L2228
+.L2211:
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+	movq	0(%rbp), %rax
+	movq	16(%rbp), %rdx
+	movq	%rax, (%rbx)
+	movq	8(%rbp), %rax
+	movq	%rdx, 16(%rbx)
+	movq	%rax, 8(%rbx)
+	cmpq	$23, %rax
+	je	.L2229
+	movq	24(%rbp), %rax
+	movq	%rax, 24(%rbx)
+	movq	$23, 8(%rbp)
+	movq	$0, 0(%rbp)
+	movb	$0, 24(%rbp)
+.L2216:
+	movdqa	(%rsp), %xmm2
+	movq	%r13, 16(%rbp)
+	movups	%xmm2, 0(%rbp)
+	cmpq	$23, %r12
+	je	.L2213
+.L2214:
+	movq	40(%rsp), %rax
+	movq	%rax, 24(%rbp)
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2228:
+	.cfi_restore_state
+	movq	%r13, 16(%rbp)
+	movups	%xmm1, 0(%rbp)
+	jmp	.L2214
+	.p2align 4,,10
+	.p2align 3
+.L2227:
+	movdqu	24(%rbx), %xmm4
+	movq	40(%rbx), %rax
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+	movq	%rax, 56(%rsp)
+	movups	%xmm4, 40(%rsp)
+	cmpq	%rbp, %rbx
+	jne	.L2211
+	movq	8(%rbp), %rdx
+	cmpq	$23, %rdx
+	je	.L2230
+.L2212:
+	movq	16(%rbp), %rdi
+	movq	24(%rbp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB83:
+	call	*24(%rax)
+.LEHE83:
+	jmp	.L2216
+.L2230:
+	movq	%r13, 16(%rbp)
+	movups	%xmm1, 0(%rbp)
+.L2213:
+	movdqu	40(%rsp), %xmm5
+	movq	56(%rsp), %rax
+	movups	%xmm5, 24(%rbp)
+	movq	%rax, 40(%rbp)
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2226:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L2208
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2208
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2208
+	.p2align 4,,10
+	.p2align 3
+.L2229:
+	movdqu	24(%rbp), %xmm6
+	movups	%xmm6, 24(%rbx)
+	movq	40(%rbp), %rax
+	movq	%rax, 40(%rbx)
+	movq	8(%rbp), %rdx
+	movq	$0, 0(%rbp)
+	movb	$0, 24(%rbp)
+	cmpq	$23, %rdx
+	jne	.L2212
+	jmp	.L2216
+.L2221:
+	movq	%rax, %rbx
+.L2217:
+	cmpq	$23, %r12
+	je	.L2219
+	movq	0(%r13), %rax
+	movq	40(%rsp), %rsi
+	leaq	1(%r12), %rdx
+	movq	%r13, %rdi
+	movl	$1, %ecx
+	call	*24(%rax)
+.L2219:
+	movq	%rbx, %rdi
+.LEHB84:
+	call	_Unwind_Resume@PLT
+.LEHE84:
+	.cfi_endproc
+.LFE7388:
+	.section	.gcc_except_table
+.LLSDA7388:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7388-.LLSDACSB7388
+.LLSDACSB7388:
+	.uleb128 .LEHB83-.LFB7388
+	.uleb128 .LEHE83-.LEHB83
+	.uleb128 .L2221-.LFB7388
+	.uleb128 0
+	.uleb128 .LEHB84-.LFB7388
+	.uleb128 .LEHE84-.LEHB84
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE7388:
+	.section	.text._ZN1n4swapINS_6stringIcEEEEvRT_S4_,"axG",@progbits,_ZN1n4swapINS_6stringIcEEEEvRT_S4_,comdat
+	.size	_ZN1n4swapINS_6stringIcEEEEvRT_S4_, .-_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	.section	.text.unlikely
+.LCOLDB45:
+	.text
+.LHOTB45:
+	.p2align 4
+	.type	_ZN1n9__pdqsortINS_6stringIcEENS_4lessEEEvPT_S5_RT0_ib.isra.0, @function
+_ZN1n9__pdqsortINS_6stringIcEENS_4lessEEEvPT_S5_RT0_ib.isra.0:
+.LFB7471:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7471
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rsi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	subq	%rdi, %r13
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%r13, %rax
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	sarq	$4, %rax
+	subq	$264, %rsp
+	.cfi_def_cfa_offset 320
+	movq	%rdi, 32(%rsp)
+	movabsq	$-6148914691236517205, %rdi
+	imulq	%rdi, %rax
+	movq	%rsi, 88(%rsp)
+	movl	%edx, 148(%rsp)
+	movb	%cl, 147(%rsp)
+	movq	%rax, 48(%rsp)
+	cmpq	$1104, %r13
+	jbe	.L2232
+	leaq	-48(%rsi), %rax
+	movq	%rax, 152(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L2233:
+	movq	48(%rsp), %rax
+	movq	%rax, %rcx
+	andq	$-2, %rax
+	shrq	%rcx
+	addq	%rcx, %rax
+	movq	%rcx, 136(%rsp)
+	movq	32(%rsp), %rcx
+	salq	$4, %rax
+	leaq	(%rcx,%rax), %rbx
+	movq	%rax, 128(%rsp)
+	movq	(%rcx), %r12
+	movq	(%rbx), %rbp
+	movq	8(%rbx), %r14
+	movq	8(%rcx), %r15
+	cmpq	$6144, %r13
+	jbe	.L2294
+	leaq	24(%rcx), %rsi
+	cmpq	$23, %r15
+	je	.L2296
+	movq	24(%rcx), %rsi
+.L2296:
+	cmpq	$23, %r14
+	je	.L2986
+	cmpq	%r12, %rbp
+	movq	%r12, %rdx
+	movq	24(%rbx), %rax
+	cmovbe	%rbp, %rdx
+	movq	%rax, %rdi
+	testq	%rdx, %rdx
+	je	.L2302
+.L2299:
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L2303
+	cmpq	%r12, %rbp
+	jnb	.L2304
+.L2301:
+	movq	32(%rsp), %rdi
+	movq	%rbx, %rsi
+.LEHB85:
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	(%rbx), %rbp
+	movq	8(%rbx), %r14
+.L2304:
+	cmpq	$23, %r14
+	je	.L2300
+	movq	24(%rbx), %rax
+.L2305:
+	movq	%rax, %rsi
+.L2306:
+	movq	88(%rsp), %rax
+	cmpq	$23, -40(%rax)
+	movq	-48(%rax), %r12
+	leaq	-24(%rax), %rdi
+	je	.L2308
+	movq	-24(%rax), %rdi
+.L2308:
+	cmpq	%rbp, %r12
+	movq	%rbp, %rdx
+	cmovbe	%r12, %rdx
+	testq	%rdx, %rdx
+	je	.L2309
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2309
+	js	.L2312
+.L2311:
+	movq	32(%rsp), %rax
+	cmpq	$23, 8(%rax)
+	movq	(%rax), %r12
+	leaq	24(%rax), %rsi
+	je	.L2314
+	movq	24(%rax), %rsi
+.L2314:
+	leaq	24(%rbx), %rdi
+	cmpq	$23, %r14
+	je	.L2316
+	movq	24(%rbx), %rdi
+.L2316:
+	cmpq	%r12, %rbp
+	movq	%r12, %rdx
+	cmovbe	%rbp, %rdx
+	testq	%rdx, %rdx
+	je	.L2317
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2317
+	js	.L2320
+.L2319:
+	movq	32(%rsp), %rax
+	movq	128(%rsp), %rcx
+	cmpq	$23, 56(%rax)
+	movq	48(%rax), %r15
+	leaq	-48(%rax,%rcx), %rbp
+	leaq	48(%rax), %r12
+	je	.L2987
+	movq	72(%rax), %rax
+.L2322:
+	movq	8(%rbp), %r14
+	movq	0(%rbp), %r13
+	cmpq	$23, %r14
+	je	.L2988
+	cmpq	%r13, %r15
+	movq	%r13, %rdx
+	movq	24(%rbp), %rsi
+	cmovbe	%r15, %rdx
+	movq	%rsi, %rdi
+	testq	%rdx, %rdx
+	je	.L2328
+.L2325:
+	movq	%rax, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L2329
+	cmpq	%r15, %r13
+	jnb	.L2330
+.L2327:
+	movq	%rbp, %rsi
+	movq	%r12, %rdi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	0(%rbp), %r13
+	movq	8(%rbp), %r14
+.L2330:
+	cmpq	$23, %r14
+	je	.L2326
+	movq	24(%rbp), %rsi
+.L2332:
+	movq	88(%rsp), %rax
+	cmpq	$23, -88(%rax)
+	movq	-96(%rax), %r15
+	leaq	-72(%rax), %rdi
+	je	.L2334
+	movq	-72(%rax), %rdi
+.L2334:
+	cmpq	%r13, %r15
+	movq	%r13, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L2335
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2335
+	js	.L2338
+.L2337:
+	movq	32(%rsp), %rax
+	cmpq	$23, 56(%rax)
+	movq	48(%rax), %r15
+	leaq	72(%rax), %rsi
+	je	.L2340
+	movq	72(%rax), %rsi
+.L2340:
+	leaq	24(%rbp), %rdi
+	cmpq	$23, %r14
+	je	.L2342
+	movq	24(%rbp), %rdi
+.L2342:
+	cmpq	%r13, %r15
+	movq	%r13, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L2343
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2343
+	js	.L2346
+.L2345:
+	movq	32(%rsp), %rax
+	movq	128(%rsp), %rcx
+	cmpq	$23, 104(%rax)
+	leaq	48(%rax,%rcx), %r13
+	leaq	96(%rax), %rcx
+	movq	96(%rax), %r12
+	movq	%rcx, (%rsp)
+	je	.L2989
+	movq	120(%rax), %rax
+.L2348:
+	movq	8(%r13), %r15
+	movq	0(%r13), %r14
+	cmpq	$23, %r15
+	je	.L2990
+	cmpq	%r14, %r12
+	movq	%r14, %rdx
+	movq	24(%r13), %rsi
+	cmovbe	%r12, %rdx
+	movq	%rsi, %rdi
+	testq	%rdx, %rdx
+	je	.L2354
+.L2351:
+	movq	%rax, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L2355
+	cmpq	%r12, %r14
+	jnb	.L2356
+.L2353:
+	movq	(%rsp), %rdi
+	movq	%r13, %rsi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	0(%r13), %r14
+	movq	8(%r13), %r15
+.L2356:
+	cmpq	$23, %r15
+	je	.L2352
+	movq	24(%r13), %rsi
+.L2358:
+	movq	88(%rsp), %rax
+	cmpq	$23, -136(%rax)
+	movq	-144(%rax), %r12
+	leaq	-120(%rax), %rdi
+	je	.L2360
+	movq	-120(%rax), %rdi
+.L2360:
+	cmpq	%r14, %r12
+	movq	%r14, %rdx
+	cmovbe	%r12, %rdx
+	testq	%rdx, %rdx
+	je	.L2361
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2361
+	js	.L2364
+.L2363:
+	movq	32(%rsp), %rax
+	cmpq	$23, 104(%rax)
+	movq	96(%rax), %r12
+	leaq	120(%rax), %rsi
+	je	.L2366
+	movq	120(%rax), %rsi
+.L2366:
+	leaq	24(%r13), %rdi
+	cmpq	$23, %r15
+	je	.L2368
+	movq	24(%r13), %rdi
+.L2368:
+	cmpq	%r12, %r14
+	movq	%r12, %rdx
+	cmovbe	%r14, %rdx
+	testq	%rdx, %rdx
+	je	.L2369
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2369
+	js	.L2372
+.L2371:
+	cmpq	$23, 8(%rbp)
+	movq	0(%rbp), %r15
+	leaq	24(%rbp), %rsi
+	je	.L2374
+	movq	24(%rbp), %rsi
+.L2374:
+	movq	8(%rbx), %r14
+	movq	(%rbx), %r12
+	cmpq	$23, %r14
+	je	.L2991
+	cmpq	%r12, %r15
+	movq	%r12, %rdx
+	movq	24(%rbx), %rax
+	cmovbe	%r15, %rdx
+	movq	%rax, %rdi
+	testq	%rdx, %rdx
+	je	.L2380
+.L2377:
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L2381
+	cmpq	%r15, %r12
+	jnb	.L2382
+.L2379:
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+.LEHE85:
+	movq	(%rbx), %r12
+	movq	8(%rbx), %r14
+.L2382:
+	cmpq	$23, %r14
+	je	.L2378
+	movq	24(%rbx), %rax
+.L2383:
+	movq	%rax, %rsi
+.L2384:
+	cmpq	$23, 8(%r13)
+	movq	0(%r13), %r15
+	leaq	24(%r13), %rdi
+	je	.L2386
+	movq	24(%r13), %rdi
+.L2386:
+	cmpq	%r12, %r15
+	movq	%r12, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L2387
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2387
+	js	.L2390
+.L2389:
+	cmpq	$23, 8(%rbp)
+	movq	0(%rbp), %r13
+	leaq	24(%rbp), %rsi
+	je	.L2392
+	movq	24(%rbp), %rsi
+.L2392:
+	leaq	24(%rbx), %rdi
+	cmpq	$23, %r14
+	je	.L2394
+	movq	24(%rbx), %rdi
+.L2394:
+	cmpq	%r12, %r13
+	movq	%r12, %rdx
+	cmovbe	%r13, %rdx
+	testq	%rdx, %rdx
+	je	.L2395
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2395
+	js	.L2398
+.L2397:
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L2992
+.L2400:
+	movq	32(%rsp), %rax
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 240(%rsp)
+	movdqu	(%rax), %xmm5
+	movq	8(%rax), %r13
+	movq	%rax, %rcx
+	movq	16(%rax), %r12
+	movhlps	%xmm5, %xmm3
+	movaps	%xmm5, (%rsp)
+	movq	%xmm3, %rbp
+	cmpq	$23, %rbp
+	je	.L2993
+	movq	24(%rax), %rax
+	movq	$23, 8(%rcx)
+	movq	$0, (%rcx)
+	movq	%rax, 232(%rsp)
+	movb	$0, 24(%rcx)
+	cmpq	%rbx, %rcx
+	je	.L2405
+.L2403:
+	movq	32(%rsp), %rcx
+	movq	$0, (%rcx)
+	movb	$0, 24(%rcx)
+	movq	(%rbx), %rax
+	movq	16(%rbx), %rdx
+	movq	%rax, (%rcx)
+	movq	8(%rbx), %rax
+	movq	%rdx, 16(%rcx)
+	movq	%rax, 8(%rcx)
+	cmpq	$23, %rax
+	je	.L2994
+	movq	24(%rbx), %rax
+	movq	%rax, 24(%rcx)
+	movq	$23, 8(%rbx)
+.L2407:
+	movq	8(%rbx), %rax
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+	cmpq	$23, %rax
+	je	.L2408
+.L2729:
+	movq	16(%rbx), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%rbx), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB86:
+	call	*24(%rax)
+.LEHE86:
+.L2408:
+	movdqa	(%rsp), %xmm7
+	movq	%r12, 16(%rbx)
+	movups	%xmm7, (%rbx)
+	cmpq	$23, %rbp
+	je	.L2728
+.L2412:
+	movq	232(%rsp), %rax
+	movq	%rax, 24(%rbx)
+.L2414:
+	cmpb	$0, 147(%rsp)
+	jne	.L2440
+	movq	32(%rsp), %rax
+	movdqu	(%rax), %xmm5
+	movhlps	%xmm5, %xmm3
+	movaps	%xmm5, 64(%rsp)
+	movq	%xmm5, %r15
+	movq	%xmm3, %rax
+	movq	%xmm3, 16(%rsp)
+	cmpq	$23, %rax
+	movq	32(%rsp), %rax
+	leaq	24(%rax), %rsi
+	je	.L2442
+	movq	24(%rax), %rsi
+.L2442:
+	cmpq	$23, -40(%rax)
+	movq	-48(%rax), %rbx
+	leaq	-24(%rax), %rdi
+	je	.L2444
+	movq	-24(%rax), %rdi
+.L2444:
+	cmpq	%rbx, %r15
+	movq	%rbx, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L2445
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2445
+	jns	.L2447
+.L2440:
+	movdqa	.LC4(%rip), %xmm6
+	movaps	%xmm6, 160(%rsp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L2995
+.L2512:
+	movq	32(%rsp), %rax
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 192(%rsp)
+	movdqu	(%rax), %xmm6
+	movq	16(%rax), %rax
+	movhlps	%xmm6, %xmm5
+	movq	%rax, 176(%rsp)
+	movq	%xmm6, %r15
+	movq	%xmm5, %rbp
+	movaps	%xmm6, 16(%rsp)
+	movq	%xmm5, 40(%rsp)
+	movaps	%xmm6, 160(%rsp)
+	cmpq	$23, %rbp
+	je	.L2996
+	movq	32(%rsp), %rax
+	movq	24(%rax), %rcx
+	movq	$23, 8(%rax)
+	movq	%rcx, 64(%rsp)
+	movq	%rcx, 184(%rsp)
+.L2515:
+	leaq	184(%rsp), %rcx
+	cmpq	$23, %rbp
+	movb	$0, 24(%rax)
+	movq	%rax, %r13
+	movq	%rcx, %rbx
+	movq	%rcx, 80(%rsp)
+	cmovne	64(%rsp), %rbx
+	movq	$0, (%rax)
+	movq	%rbp, 96(%rsp)
+	movq	%rbx, %rbp
+	.p2align 4,,10
+	.p2align 3
+.L2889:
+	movq	%r13, %rbx
+	movdqu	48(%r13), %xmm2
+	addq	$48, %r13
+	leaq	24(%r13), %rdi
+	movhlps	%xmm2, %xmm4
+	movaps	%xmm2, (%rsp)
+	movq	%xmm2, %r12
+	movq	%xmm4, %r14
+	cmpq	$23, %r14
+	je	.L2517
+	movq	24(%r13), %rdi
+.L2517:
+	cmpq	%r12, %r15
+	movq	%r12, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L2518
+	movq	%rbp, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2518
+	js	.L2889
+	.p2align 4,,10
+	.p2align 3
+.L2520:
+	movq	88(%rsp), %rax
+	movq	%r14, %r12
+	movq	%rbx, %r14
+	movq	%rbp, %rbx
+	movq	96(%rsp), %rbp
+	movq	%r13, 104(%rsp)
+	movq	%rax, 96(%rsp)
+	movq	32(%rsp), %rax
+	movq	8(%r13), %r13
+	cmpq	%rax, %r14
+	je	.L2997
+	movq	%r12, 120(%rsp)
+	movq	%rbp, 112(%rsp)
+	movq	%r15, %rbp
+	movq	%rbx, %r15
+	movq	96(%rsp), %rbx
+	.p2align 4,,10
+	.p2align 3
+.L2875:
+	subq	$48, %rbx
+	movq	(%rbx), %r12
+	cmpq	$23, 8(%rbx)
+	leaq	24(%rbx), %rdi
+	je	.L2533
+	movq	24(%rbx), %rdi
+.L2533:
+	cmpq	%rbp, %r12
+	movq	%rbp, %rdx
+	cmovbe	%r12, %rdx
+	testq	%rdx, %rdx
+	je	.L2534
+	movq	%r15, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2534
+	jns	.L2875
+	.p2align 4,,10
+	.p2align 3
+.L2976:
+	movq	%rbx, 96(%rsp)
+	movq	112(%rsp), %rbp
+	movq	%rbx, %rax
+	movq	120(%rsp), %r12
+.L2531:
+	movq	104(%rsp), %rbx
+	cmpq	%rax, %rbx
+	jnb	.L2739
+	movq	%rax, %rbp
+	.p2align 4,,10
+	.p2align 3
+.L2564:
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L2998
+.L2536:
+	pxor	%xmm0, %xmm0
+	movq	16(%rbx), %r14
+	movaps	%xmm0, 240(%rsp)
+	cmpq	$23, %r12
+	je	.L2999
+	movq	24(%rbx), %rax
+	movq	$23, 8(%rbx)
+	movq	$0, (%rbx)
+	movq	%rax, 232(%rsp)
+	movb	$0, 24(%rbx)
+	cmpq	%rbp, %rbx
+	je	.L3000
+.L2540:
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+	movq	0(%rbp), %rax
+	movq	16(%rbp), %rdx
+	movq	%rax, (%rbx)
+	movq	8(%rbp), %rax
+	movq	%rdx, 16(%rbx)
+	movq	%rax, 8(%rbx)
+	cmpq	$23, %rax
+	je	.L3001
+	movq	24(%rbp), %rax
+	movq	%rax, 24(%rbx)
+	movq	$23, 8(%rbp)
+	movq	$0, 0(%rbp)
+	movb	$0, 24(%rbp)
+.L2546:
+	movdqa	(%rsp), %xmm4
+	movq	%r14, 16(%rbp)
+	movups	%xmm4, 0(%rbp)
+	cmpq	$23, %r12
+	je	.L2544
+.L2543:
+	movq	232(%rsp), %rax
+	movq	%rax, 24(%rbp)
+.L2550:
+	movq	80(%rsp), %r13
+	movq	184(%rsp), %rax
+	movq	%rbp, 16(%rsp)
+	cmpq	$23, 40(%rsp)
+	movq	160(%rsp), %r15
+	cmovne	%rax, %r13
+	movq	%rax, 64(%rsp)
+	movq	%r13, %rbp
+	.p2align 4,,10
+	.p2align 3
+.L2891:
+	movq	%rbx, %r13
+	movdqu	48(%rbx), %xmm1
+	addq	$48, %rbx
+	leaq	24(%rbx), %rdi
+	movhlps	%xmm1, %xmm6
+	movaps	%xmm1, (%rsp)
+	movq	%xmm1, %r12
+	movq	%xmm6, %r14
+	cmpq	$23, %r14
+	je	.L2554
+	movq	24(%rbx), %rdi
+.L2554:
+	cmpq	%r12, %r15
+	movq	%r12, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L2555
+	movq	%rbp, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2555
+	js	.L2891
+	.p2align 4,,10
+	.p2align 3
+.L2972:
+	movq	%rbx, %r12
+	movq	%rbp, %rbx
+	movq	16(%rsp), %rbp
+	movq	%r14, 16(%rsp)
+	movq	%r13, %r14
+.L2890:
+	subq	$48, %rbp
+	movq	0(%rbp), %r13
+	cmpq	$23, 8(%rbp)
+	leaq	24(%rbp), %rdi
+	je	.L2559
+	movq	24(%rbp), %rdi
+.L2559:
+	cmpq	%r13, %r15
+	movq	%r13, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L2560
+	movq	%rbx, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2560
+	jns	.L2890
+	.p2align 4,,10
+	.p2align 3
+.L2977:
+	movq	%r12, %rbx
+	movq	16(%rsp), %r12
+	movq	8(%rbx), %r13
+	cmpq	%rbp, %rbx
+	jb	.L2564
+	movq	40(%rsp), %rbp
+	movq	%r15, %xmm3
+	movq	%rbp, %xmm7
+	punpcklqdq	%xmm7, %xmm3
+	movaps	%xmm3, 16(%rsp)
+.L2525:
+	cmpq	%r14, 32(%rsp)
+	je	.L2727
+	.p2align 4,,10
+	.p2align 3
+.L2565:
+	movq	32(%rsp), %r15
+	movq	8(%r15), %rax
+	cmpq	$23, %rax
+	je	.L2567
+	movq	16(%r15), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%r15), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB87:
+	call	*24(%rax)
+.LEHE87:
+	movq	$23, 8(%r15)
+.L2567:
+	movq	32(%rsp), %rcx
+	movq	$0, (%rcx)
+	movb	$0, 24(%rcx)
+	movq	-48(%rbx), %rax
+	movq	-32(%rbx), %rdx
+	movq	%rax, (%rcx)
+	movq	-40(%rbx), %rax
+	movq	%rdx, 16(%rcx)
+	movq	%rax, 8(%rcx)
+	cmpq	$23, %rax
+	je	.L3002
+	movq	-24(%rbx), %rax
+	movq	%rax, 24(%rcx)
+	movq	$23, -40(%rbx)
+	movq	$0, -48(%rbx)
+	movb	$0, -24(%rbx)
+.L2569:
+	movdqa	16(%rsp), %xmm4
+	movq	176(%rsp), %rax
+	movups	%xmm4, -48(%rbx)
+	movq	%rax, -32(%rbx)
+	cmpq	$23, %rbp
+	je	.L3003
+	movq	64(%rsp), %rax
+	movq	%rax, -24(%rbx)
+.L2572:
+	movq	88(%rsp), %rcx
+	movq	32(%rsp), %rax
+	movq	%r14, %r12
+	movabsq	$-6148914691236517205, %rsi
+	subq	%rbx, %rcx
+	subq	%rax, %r12
+	movq	%rcx, %rdx
+	movq	%r12, %rax
+	movq	%rcx, (%rsp)
+	sarq	$4, %rdx
+	sarq	$4, %rax
+	imulq	%rsi, %rdx
+	imulq	%rsi, %rax
+	movq	%rdx, %rcx
+	movq	%rdx, 40(%rsp)
+	movq	48(%rsp), %rdx
+	shrq	$3, %rdx
+	cmpq	%rcx, %rax
+	cmovbe	%rax, %rcx
+	cmpq	%rdx, %rcx
+	jnb	.L3004
+	subl	$1, 148(%rsp)
+	je	.L3005
+	cmpq	$1104, %r12
+	ja	.L3006
+.L2660:
+	movq	(%rsp), %r13
+	cmpq	$1104, %r13
+	ja	.L3007
+.L2664:
+	movzbl	147(%rsp), %ecx
+	movl	148(%rsp), %edx
+	movq	%r14, %rsi
+	movq	32(%rsp), %rdi
+.LEHB88:
+	call	_ZN1n9__pdqsortINS_6stringIcEENS_4lessEEEvPT_S5_RT0_ib.isra.0
+.LEHE88:
+	movq	40(%rsp), %rax
+	movq	%rbx, 32(%rsp)
+	movq	%rax, 48(%rsp)
+.L2509:
+	movb	$0, 147(%rsp)
+	cmpq	$1104, %r13
+	ja	.L2233
+.L2234:
+	movq	32(%rsp), %rbp
+	movq	88(%rsp), %rax
+	addq	$48, %rbp
+	cmpq	%rax, %rbp
+	jnb	.L2231
+	leaq	232(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	jmp	.L2291
+.L3008:
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2269
+	js	.L2272
+.L2271:
+	movq	88(%rsp), %rax
+	addq	$48, %rbp
+	cmpq	%rax, %rbp
+	jnb	.L2231
+.L2291:
+	cmpq	$23, -40(%rbp)
+	movq	-48(%rbp), %rbx
+	leaq	-24(%rbp), %rsi
+	je	.L2266
+	movq	-24(%rbp), %rsi
+.L2266:
+	movdqu	0(%rbp), %xmm3
+	movq	8(%rbp), %r14
+	leaq	24(%rbp), %rdi
+	movhlps	%xmm3, %xmm7
+	movaps	%xmm3, (%rsp)
+	movq	%xmm3, %r12
+	movq	%xmm7, %r13
+	cmpq	$23, %r13
+	je	.L2268
+	movq	24(%rbp), %rdi
+.L2268:
+	cmpq	%r12, %rbx
+	movq	%r12, %rdx
+	cmovbe	%rbx, %rdx
+	testq	%rdx, %rdx
+	jne	.L3008
+.L2269:
+	cmpq	%rbx, %r12
+	jnb	.L2271
+.L2272:
+	movdqa	.LC4(%rip), %xmm4
+	movaps	%xmm4, 208(%rsp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L3009
+.L2273:
+	movq	16(%rbp), %rax
+	movdqa	(%rsp), %xmm7
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 240(%rsp)
+	movq	%rax, 40(%rsp)
+	movq	%rax, 224(%rsp)
+	movaps	%xmm7, 208(%rsp)
+	cmpq	$23, %r13
+	je	.L3010
+	movq	24(%rbp), %rax
+	movq	$23, 8(%rbp)
+	movq	%rax, 232(%rsp)
+.L2277:
+	movq	$0, 0(%rbp)
+	movq	%rbp, %rbx
+	movb	$0, 24(%rbp)
+.L2885:
+	movq	8(%rbx), %rax
+	cmpq	$23, %rax
+	je	.L2278
+	movq	16(%rbx), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%rbx), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB89:
+	call	*24(%rax)
+	movq	$23, 8(%rbx)
+.L2278:
+	movq	-48(%rbx), %rax
+	movq	-32(%rbx), %r15
+	subq	$48, %rbx
+	movb	$0, 72(%rbx)
+	movq	%rax, 48(%rbx)
+	movq	8(%rbx), %rax
+	movq	%r15, 64(%rbx)
+	movq	%rax, 56(%rbx)
+	cmpq	$23, %rax
+	je	.L3011
+	movq	24(%rbx), %rax
+	movq	$23, 8(%rbx)
+	movq	%rax, 72(%rbx)
+.L2280:
+	cmpq	$23, -40(%rbx)
+	movq	-48(%rbx), %rcx
+	movb	$0, 24(%rbx)
+	leaq	-24(%rbx), %rsi
+	movq	$0, (%rbx)
+	je	.L2282
+	movq	-24(%rbx), %rsi
+.L2282:
+	movq	16(%rsp), %rdi
+	cmpq	$23, %r13
+	je	.L2283
+	movq	232(%rsp), %rdi
+.L2283:
+	cmpq	%r12, %rcx
+	movq	%r12, %rdx
+	cmovbe	%rcx, %rdx
+	testq	%rdx, %rdx
+	je	.L2284
+	movq	%rcx, 32(%rsp)
+	call	memcmp@PLT
+	movq	32(%rsp), %rcx
+	testl	%eax, %eax
+	je	.L2284
+	js	.L2885
+	movq	8(%rbx), %rax
+	cmpq	$23, %rax
+	je	.L2288
+.L3038:
+	leaq	1(%rax), %rdx
+	movq	(%r15), %rax
+	movq	24(%rbx), %rsi
+	movl	$1, %ecx
+	movq	%r15, %rdi
+	call	*24(%rax)
+.LEHE89:
+.L2288:
+	movdqa	(%rsp), %xmm6
+	movq	40(%rsp), %rax
+	movups	%xmm6, (%rbx)
+	movq	%rax, 16(%rbx)
+	cmpq	$23, %r13
+	je	.L3012
+	movq	232(%rsp), %rax
+	addq	$48, %rbp
+	movq	%rax, 24(%rbx)
+	movq	88(%rsp), %rax
+	cmpq	%rax, %rbp
+	jb	.L2291
+.L2231:
+	addq	$264, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2560:
+	.cfi_restore_state
+	cmpq	%r15, %r13
+	jnb	.L2890
+	jmp	.L2977
+	.p2align 4,,10
+	.p2align 3
+.L2555:
+	cmpq	%r15, %r12
+	jnb	.L2972
+	jmp	.L2891
+	.p2align 4,,10
+	.p2align 3
+.L2518:
+	cmpq	%r15, %r12
+	jnb	.L2520
+	jmp	.L2889
+	.p2align 4,,10
+	.p2align 3
+.L2534:
+	cmpq	%rbp, %r12
+	jnb	.L2875
+	jmp	.L2976
+.L3013:
+	movdqa	(%rsp), %xmm4
+	movups	%xmm4, (%rbx)
+	.p2align 4,,10
+	.p2align 3
+.L2544:
+	movdqu	232(%rsp), %xmm5
+	movq	248(%rsp), %rax
+	movups	%xmm5, 24(%rbp)
+	movq	%rax, 40(%rbp)
+	jmp	.L2550
+	.p2align 4,,10
+	.p2align 3
+.L3000:
+	movdqa	(%rsp), %xmm7
+	movups	%xmm7, (%rbx)
+	jmp	.L2543
+	.p2align 4,,10
+	.p2align 3
+.L2999:
+	movdqu	24(%rbx), %xmm7
+	movq	40(%rbx), %rax
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+	movq	%rax, 248(%rsp)
+	movups	%xmm7, 232(%rsp)
+	cmpq	%rbp, %rbx
+	jne	.L2540
+	movq	8(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L3013
+.L2542:
+	movq	16(%rbp), %rdi
+	movq	24(%rbp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB90:
+	call	*24(%rax)
+.LEHE90:
+	jmp	.L2546
+	.p2align 4,,10
+	.p2align 3
+.L2998:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2537
+	movdqu	(%rbx), %xmm3
+	movq	168(%rsp), %rax
+	movq	8(%rbx), %r13
+	movhlps	%xmm3, %xmm5
+	movq	%rax, 40(%rsp)
+	movaps	%xmm3, (%rsp)
+	movq	%xmm5, %r12
+	jmp	.L2536
+	.p2align 4,,10
+	.p2align 3
+.L3001:
+	movdqu	24(%rbp), %xmm7
+	movups	%xmm7, 24(%rbx)
+	movq	40(%rbp), %rax
+	movq	%rax, 40(%rbx)
+	movq	8(%rbp), %rdx
+	movq	$0, 0(%rbp)
+	movb	$0, 24(%rbp)
+	cmpq	$23, %rdx
+	jne	.L2542
+	jmp	.L2546
+.L2294:
+	leaq	24(%rbx), %rax
+	cmpq	$23, %r14
+	je	.L2416
+	movq	24(%rbx), %rax
+.L2416:
+	cmpq	$23, %r15
+	je	.L3014
+	movq	32(%rsp), %rcx
+	cmpq	%r12, %rbp
+	movq	%r12, %rdx
+	cmovbe	%rbp, %rdx
+	movq	24(%rcx), %rsi
+	movq	%rsi, %rdi
+	testq	%rdx, %rdx
+	je	.L2422
+	movq	%rax, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L2423
+.L3026:
+	cmpq	%rbp, %r12
+	jnb	.L2424
+.L2421:
+	movq	32(%rsp), %r14
+	movq	%rbx, %rdi
+	movq	%r14, %rsi
+.LEHB91:
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	(%r14), %r12
+	movq	8(%r14), %r15
+.L2424:
+	cmpq	$23, %r15
+	je	.L2420
+.L3027:
+	movq	32(%rsp), %rax
+	movq	24(%rax), %rsi
+.L2426:
+	movq	88(%rsp), %rax
+	cmpq	$23, -40(%rax)
+	movq	-48(%rax), %rbp
+	leaq	-24(%rax), %rdi
+	je	.L2428
+	movq	-24(%rax), %rdi
+.L2428:
+	cmpq	%rbp, %r12
+	movq	%rbp, %rdx
+	cmovbe	%r12, %rdx
+	testq	%rdx, %rdx
+	je	.L2429
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2429
+	js	.L2432
+.L2431:
+	cmpq	$23, 8(%rbx)
+	movq	(%rbx), %rbp
+	leaq	24(%rbx), %rsi
+	je	.L2434
+	movq	24(%rbx), %rsi
+.L2434:
+	movq	32(%rsp), %rax
+	leaq	24(%rax), %rdi
+	cmpq	$23, %r15
+	je	.L2436
+	movq	24(%rax), %rdi
+.L2436:
+	cmpq	%r12, %rbp
+	movq	%r12, %rdx
+	cmovbe	%rbp, %rdx
+	testq	%rdx, %rdx
+	je	.L2437
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2437
+	jns	.L2414
+	movq	32(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+.LEHE91:
+	jmp	.L2414
+	.p2align 4,,10
+	.p2align 3
+.L2445:
+	cmpq	%r15, %rbx
+	jb	.L2440
+.L2447:
+	movdqa	.LC4(%rip), %xmm7
+	movaps	%xmm7, 160(%rsp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L3015
+.L2448:
+	movq	32(%rsp), %rax
+	movq	16(%rsp), %rcx
+	pxor	%xmm0, %xmm0
+	movdqa	64(%rsp), %xmm6
+	movaps	%xmm0, 192(%rsp)
+	movq	16(%rax), %rax
+	movq	%rcx, 40(%rsp)
+	movaps	%xmm6, 160(%rsp)
+	movq	%rax, 176(%rsp)
+	cmpq	$23, %rcx
+	je	.L3016
+	movq	32(%rsp), %rax
+	movq	24(%rax), %r14
+	movq	$23, 8(%rax)
+	movq	%r14, 184(%rsp)
+.L2452:
+	cmpq	$23, 16(%rsp)
+	movq	88(%rsp), %rbx
+	movb	$0, 24(%rax)
+	movq	$0, (%rax)
+	leaq	184(%rsp), %rax
+	movq	%rax, 80(%rsp)
+	cmovne	%r14, %rax
+	movq	%rax, (%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L2886:
+	movq	%rbx, %r13
+	movq	-40(%rbx), %r12
+	subq	$48, %rbx
+	movq	(%rbx), %rbp
+	leaq	24(%rbx), %rsi
+	cmpq	$23, %r12
+	je	.L2454
+	movq	24(%rbx), %rsi
+.L2454:
+	cmpq	%rbp, %r15
+	movq	%rbp, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L2455
+	movq	(%rsp), %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2455
+	js	.L2886
+.L2457:
+	movq	32(%rsp), %rbp
+	cmpq	%r13, 88(%rsp)
+	je	.L2466
+.L2874:
+	addq	$48, %rbp
+	movq	0(%rbp), %r13
+	cmpq	$23, 8(%rbp)
+	leaq	24(%rbp), %rsi
+	je	.L2469
+	movq	24(%rbp), %rsi
+.L2469:
+	cmpq	%r13, %r15
+	movq	%r13, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L2470
+	movq	(%rsp), %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2470
+	jns	.L2874
+.L2472:
+	cmpq	%rbx, %rbp
+	jnb	.L2461
+	.p2align 4,,10
+	.p2align 3
+.L2501:
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L3017
+.L2473:
+	movdqu	0(%rbp), %xmm5
+	pxor	%xmm0, %xmm0
+	movq	8(%rbp), %r14
+	movq	16(%rbp), %r13
+	movaps	%xmm0, 240(%rsp)
+	movhlps	%xmm5, %xmm3
+	movaps	%xmm5, (%rsp)
+	movq	%xmm3, %r12
+	cmpq	$23, %r12
+	je	.L3018
+	movq	24(%rbp), %rax
+	movq	$23, 8(%rbp)
+	movq	$0, 0(%rbp)
+	movq	%rax, 232(%rsp)
+	movb	$0, 24(%rbp)
+	cmpq	%rbp, %rbx
+	je	.L3019
+.L2477:
+	movq	$0, 0(%rbp)
+	movb	$0, 24(%rbp)
+	movq	(%rbx), %rax
+	movq	16(%rbx), %rdx
+	movq	%rax, 0(%rbp)
+	movq	8(%rbx), %rax
+	movq	%rdx, 16(%rbp)
+	movq	%rax, 8(%rbp)
+	cmpq	$23, %rax
+	je	.L3020
+	movq	24(%rbx), %rax
+	movq	%rax, 24(%rbp)
+	movq	$23, 8(%rbx)
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+.L2482:
+	movdqa	(%rsp), %xmm3
+	movq	%r13, 16(%rbx)
+	movups	%xmm3, (%rbx)
+	cmpq	$23, %r12
+	je	.L2479
+.L2480:
+	movq	232(%rsp), %rax
+	movq	%rax, 24(%rbx)
+.L2486:
+	movq	80(%rsp), %r13
+	movq	184(%rsp), %r14
+	movq	%rbp, 16(%rsp)
+	cmpq	$23, 40(%rsp)
+	movq	160(%rsp), %r15
+	cmovne	%r14, %r13
+	movq	%r13, %rbp
+	.p2align 4,,10
+	.p2align 3
+.L2888:
+	movq	-40(%rbx), %r13
+	subq	$48, %rbx
+	movq	(%rbx), %r12
+	leaq	24(%rbx), %rsi
+	cmpq	$23, %r13
+	je	.L2490
+	movq	24(%rbx), %rsi
+.L2490:
+	cmpq	%r15, %r12
+	movq	%r15, %rdx
+	cmovbe	%r12, %rdx
+	testq	%rdx, %rdx
+	je	.L2491
+	movq	%rbp, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2491
+	js	.L2888
+	.p2align 4,,10
+	.p2align 3
+.L2968:
+	movq	%rbx, (%rsp)
+	movq	%rbp, %rbx
+	movq	16(%rsp), %rbp
+	movq	%r13, %r12
+.L2887:
+	addq	$48, %rbp
+	movq	0(%rbp), %r13
+	cmpq	$23, 8(%rbp)
+	leaq	24(%rbp), %rsi
+	je	.L2495
+	movq	24(%rbp), %rsi
+.L2495:
+	cmpq	%r13, %r15
+	movq	%r13, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L2496
+	movq	%rbx, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2496
+	jns	.L2887
+	movq	(%rsp), %rbx
+	cmpq	%rbx, %rbp
+	jb	.L2501
+.L3024:
+	movq	40(%rsp), %rax
+	movq	%r15, %xmm7
+	movq	%rax, %xmm5
+	movq	%rax, 16(%rsp)
+	punpcklqdq	%xmm5, %xmm7
+	movaps	%xmm7, 64(%rsp)
+	cmpq	%rbx, 32(%rsp)
+	jne	.L2725
+.L2502:
+	cmpq	$23, %r12
+	je	.L2505
+	movq	16(%rbx), %rdi
+	movq	24(%rbx), %rsi
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB92:
+	call	*24(%rax)
+	jmp	.L2505
+.L3021:
+	addq	$48, %rbp
+	movq	0(%rbp), %r13
+	cmpq	$23, 8(%rbp)
+	leaq	24(%rbp), %rsi
+	je	.L2463
+	movq	24(%rbp), %rsi
+.L2463:
+	cmpq	%r13, %r15
+	movq	%r13, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L2464
+	movq	(%rsp), %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L2465
+.L2464:
+	cmpq	%r13, %r15
+	jb	.L2467
+.L2466:
+	cmpq	%rbx, %rbp
+	jb	.L3021
+.L2461:
+	cmpq	%rbx, 32(%rsp)
+	je	.L2502
+.L2725:
+	movq	32(%rsp), %r15
+	movq	8(%r15), %rax
+	cmpq	$23, %rax
+	je	.L2503
+	movq	16(%r15), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%r15), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE92:
+	movq	$23, 8(%r15)
+.L2503:
+	movq	32(%rsp), %rcx
+	movq	$0, (%rcx)
+	movb	$0, 24(%rcx)
+	movq	(%rbx), %rax
+	movq	16(%rbx), %rdx
+	movq	%rax, (%rcx)
+	movq	8(%rbx), %rax
+	movq	%rdx, 16(%rcx)
+	movq	%rax, 8(%rcx)
+	cmpq	$23, %rax
+	je	.L3022
+	movq	24(%rbx), %rax
+	movq	%rax, 24(%rcx)
+	movq	$23, 8(%rbx)
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+.L2505:
+	movdqa	64(%rsp), %xmm5
+	movq	176(%rsp), %rax
+	cmpq	$23, 16(%rsp)
+	movq	%rax, 16(%rbx)
+	movups	%xmm5, (%rbx)
+	je	.L3023
+	movq	%r14, 24(%rbx)
+.L2508:
+	movq	88(%rsp), %r13
+	leaq	48(%rbx), %rax
+	movabsq	$-6148914691236517205, %rcx
+	movq	%rax, 32(%rsp)
+	subq	%rax, %r13
+	movq	%r13, %rax
+	sarq	$4, %rax
+	imulq	%rcx, %rax
+	movq	%rax, 48(%rsp)
+	jmp	.L2509
+	.p2align 4,,10
+	.p2align 3
+.L2491:
+	cmpq	%r12, %r15
+	jnb	.L2968
+	jmp	.L2888
+	.p2align 4,,10
+	.p2align 3
+.L2496:
+	cmpq	%r13, %r15
+	jnb	.L2887
+	movq	(%rsp), %rbx
+	cmpq	%rbx, %rbp
+	jb	.L2501
+	jmp	.L3024
+	.p2align 4,,10
+	.p2align 3
+.L2455:
+	cmpq	%rbp, %r15
+	jnb	.L2457
+	jmp	.L2886
+.L2470:
+	cmpq	%r13, %r15
+	jnb	.L2874
+	jmp	.L2472
+.L3018:
+	movdqu	24(%rbp), %xmm7
+	movq	40(%rbp), %rax
+	movb	$0, 24(%rbp)
+	movq	$0, 0(%rbp)
+	movq	%rax, 248(%rsp)
+	movups	%xmm7, 232(%rsp)
+	cmpq	%rbp, %rbx
+	jne	.L2477
+	movq	%r14, %rdx
+	cmpq	$23, %r14
+	jne	.L2478
+	movq	%r13, 16(%rbx)
+	movups	%xmm5, (%rbx)
+.L2479:
+	movdqu	232(%rsp), %xmm7
+	movq	248(%rsp), %rax
+	movups	%xmm7, 24(%rbx)
+	movq	%rax, 40(%rbx)
+	jmp	.L2486
+.L2537:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	jne	.L2538
+	movdqu	(%rbx), %xmm4
+	movq	168(%rsp), %rax
+	movq	8(%rbx), %r13
+	movhlps	%xmm4, %xmm0
+	movq	%rax, 40(%rsp)
+	movaps	%xmm4, (%rsp)
+	movq	%xmm0, %r12
+	jmp	.L2536
+.L2429:
+	cmpq	%r12, %rbp
+	jnb	.L2431
+.L2432:
+	movq	32(%rsp), %r14
+	movq	152(%rsp), %rsi
+	movq	%r14, %rdi
+.LEHB93:
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	(%r14), %r12
+	movq	8(%r14), %r15
+	jmp	.L2431
+.L2437:
+	cmpq	%rbp, %r12
+	jnb	.L2414
+	movq	32(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	jmp	.L2414
+.L2395:
+	cmpq	%r13, %r12
+	jnb	.L2397
+.L2398:
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	jne	.L2400
+.L2992:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L2400
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2400
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2400
+	.p2align 4,,10
+	.p2align 3
+.L2317:
+	cmpq	%r12, %rbp
+	jnb	.L2319
+.L2320:
+	movq	32(%rsp), %rdi
+	movq	%rbx, %rsi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	jmp	.L2319
+.L2309:
+	cmpq	%rbp, %r12
+	jnb	.L2311
+.L2312:
+	movq	152(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	(%rbx), %rbp
+	movq	8(%rbx), %r14
+	jmp	.L2311
+.L2335:
+	cmpq	%r13, %r15
+	jnb	.L2337
+.L2338:
+	movq	88(%rsp), %rax
+	movq	%rbp, %rdi
+	leaq	-96(%rax), %rsi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	0(%rbp), %r13
+	movq	8(%rbp), %r14
+	jmp	.L2337
+.L2387:
+	cmpq	%r12, %r15
+	jnb	.L2389
+.L2390:
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	(%rbx), %r12
+	movq	8(%rbx), %r14
+	jmp	.L2389
+.L2369:
+	cmpq	%r12, %r14
+	jnb	.L2371
+.L2372:
+	movq	(%rsp), %rdi
+	movq	%r13, %rsi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	jmp	.L2371
+.L2361:
+	cmpq	%r14, %r12
+	jnb	.L2363
+.L2364:
+	movq	88(%rsp), %rax
+	movq	%r13, %rdi
+	leaq	-144(%rax), %rsi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	0(%r13), %r14
+	movq	8(%r13), %r15
+	jmp	.L2363
+.L2343:
+	cmpq	%r15, %r13
+	jnb	.L2345
+.L2346:
+	movq	%rbp, %rsi
+	movq	%r12, %rdi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+.LEHE93:
+	jmp	.L2345
+.L2997:
+	movq	88(%rsp), %rcx
+	cmpq	%rcx, 104(%rsp)
+	jnb	.L3025
+	movq	%rbx, 112(%rsp)
+	movq	96(%rsp), %rbx
+	movq	%r13, 120(%rsp)
+	movq	%rbp, %r13
+	movq	%r14, %rbp
+	movq	%r12, %r14
+	movq	%r15, %r12
+	.p2align 4,,10
+	.p2align 3
+.L2523:
+	subq	$48, %rbx
+	movq	(%rbx), %r15
+	cmpq	$23, 8(%rbx)
+	leaq	24(%rbx), %rdi
+	je	.L2527
+	movq	24(%rbx), %rdi
+.L2527:
+	cmpq	%r12, %r15
+	movq	%r12, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L2528
+	movq	112(%rsp), %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2528
+	jns	.L2530
+.L2971:
+	movq	%r14, %r12
+	movq	%rbx, 96(%rsp)
+	movq	%rbp, %r14
+	movq	%rbx, %rax
+	movq	%r13, %rbp
+	movq	120(%rsp), %r13
+	jmp	.L2531
+	.p2align 4,,10
+	.p2align 3
+.L2528:
+	cmpq	%r12, %r15
+	jb	.L2971
+.L2530:
+	cmpq	%rbx, 104(%rsp)
+	jb	.L2523
+	movq	%rbx, 96(%rsp)
+	movq	%rbp, %r14
+	movq	104(%rsp), %rbx
+	movq	%r13, %rbp
+	cmpq	%r14, 32(%rsp)
+	jne	.L2565
+.L2727:
+	movq	-40(%rbx), %rax
+.L2566:
+	cmpq	$23, %rax
+	je	.L2569
+	movq	-32(%rbx), %rdi
+	leaq	1(%rax), %rdx
+	movq	-24(%rbx), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB94:
+	call	*24(%rax)
+.LEHE94:
+	jmp	.L2569
+.L3019:
+	movq	%r13, 16(%rbx)
+	movups	%xmm5, (%rbx)
+	jmp	.L2480
+.L2993:
+	movdqu	24(%rax), %xmm7
+	movq	40(%rax), %rax
+	movq	$0, (%rcx)
+	movb	$0, 24(%rcx)
+	movq	%rax, 248(%rsp)
+	movaps	%xmm7, 16(%rsp)
+	movups	%xmm7, 232(%rsp)
+	cmpq	%rbx, %rcx
+	jne	.L2403
+	movq	%r13, %rax
+	cmpq	$23, %r13
+	jne	.L2729
+	movq	32(%rsp), %rax
+	movups	%xmm5, (%rax)
+.L2728:
+	movdqu	232(%rsp), %xmm4
+	movq	248(%rsp), %rax
+	movups	%xmm4, 24(%rbx)
+	movq	%rax, 40(%rbx)
+	jmp	.L2414
+.L3004:
+	movq	96(%rsp), %rcx
+	cmpq	%rcx, 104(%rsp)
+	jnb	.L2665
+.L2982:
+	movq	(%rsp), %r13
+	jmp	.L2664
+.L3006:
+	shrq	$2, %rax
+	movq	32(%rsp), %rdi
+	leaq	(%rax,%rax,2), %rbp
+	salq	$4, %rbp
+	leaq	(%rdi,%rbp), %rsi
+.LEHB95:
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	%r14, %rsi
+	leaq	-96(%rbx), %rdi
+	subq	%rbp, %rsi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	cmpq	$6144, %r12
+	jbe	.L2660
+	movq	32(%rsp), %r15
+	leaq	48(%r15,%rbp), %rsi
+	leaq	48(%r15), %rdi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	leaq	96(%r15,%rbp), %rsi
+	leaq	96(%r15), %rdi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	%r14, %rax
+	leaq	-144(%rbx), %rdi
+	subq	%rbp, %rax
+	leaq	-48(%rax), %rsi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	%r14, %rax
+	leaq	-192(%rbx), %rdi
+	subq	%rbp, %rax
+	leaq	-96(%rax), %rsi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	(%rsp), %r13
+	cmpq	$1104, %r13
+	jbe	.L2664
+.L3007:
+	movq	40(%rsp), %rax
+	movq	%rbx, %rdi
+	shrq	$2, %rax
+	leaq	3(%rax,%rax,2), %rbp
+	salq	$4, %rbp
+	leaq	(%r14,%rbp), %rsi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	88(%rsp), %rax
+	movq	152(%rsp), %rdi
+	subq	%rbp, %rax
+	leaq	48(%rax), %rsi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	cmpq	$6144, %r13
+	jbe	.L2664
+	leaq	48(%r14,%rbp), %rsi
+	leaq	48(%rbx), %rdi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	leaq	96(%r14,%rbp), %rsi
+	leaq	96(%rbx), %rdi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	88(%rsp), %r15
+	movq	%r15, %rcx
+	leaq	-96(%r15), %rdi
+	subq	%rbp, %rcx
+	movq	%rcx, %rsi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	%r15, %rax
+	leaq	-144(%r15), %rdi
+	subq	%rbp, %rax
+	leaq	-48(%rax), %rsi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+.LEHE95:
+	jmp	.L2664
+.L3017:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2474
+.L2974:
+	movq	168(%rsp), %rax
+	movq	%rax, 40(%rsp)
+	jmp	.L2473
+.L2996:
+	movq	32(%rsp), %rcx
+	movdqu	24(%rcx), %xmm6
+	movq	40(%rcx), %rdx
+	movaps	%xmm6, (%rsp)
+	movq	(%rsp), %rax
+	movq	%rdx, 200(%rsp)
+	movq	%rax, 64(%rsp)
+	movq	%rcx, %rax
+	movups	%xmm6, 184(%rsp)
+	jmp	.L2515
+.L2465:
+	jns	.L2466
+.L2467:
+	cmpq	%rbx, %rbp
+	jb	.L2501
+	jmp	.L2725
+	.p2align 4,,10
+	.p2align 3
+.L3014:
+	cmpq	%r12, %rbp
+	movq	%r12, %rdx
+	cmovbe	%rbp, %rdx
+	testq	%rdx, %rdx
+	je	.L2418
+	movq	32(%rsp), %rcx
+	movq	%rax, %rsi
+	leaq	24(%rcx), %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L3026
+.L2423:
+	js	.L2421
+	cmpq	$23, %r15
+	jne	.L3027
+.L2420:
+	movq	32(%rsp), %rax
+	movl	$23, %r15d
+	leaq	24(%rax), %rsi
+	jmp	.L2426
+.L2986:
+	cmpq	%r12, %rbp
+	movq	%r12, %rdx
+	leaq	24(%rbx), %rdi
+	cmovbe	%rbp, %rdx
+	testq	%rdx, %rdx
+	jne	.L2299
+	cmpq	%r12, %rbp
+	jb	.L2301
+.L2300:
+	leaq	24(%rbx), %rsi
+	movl	$23, %r14d
+	jmp	.L2306
+.L2988:
+	cmpq	%r13, %r15
+	movq	%r13, %rdx
+	leaq	24(%rbp), %rdi
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	jne	.L2325
+	cmpq	%r15, %r13
+	jb	.L2327
+.L2326:
+	leaq	24(%rbp), %rsi
+	movl	$23, %r14d
+	jmp	.L2332
+.L2990:
+	cmpq	%r14, %r12
+	movq	%r14, %rdx
+	leaq	24(%r13), %rdi
+	cmovbe	%r12, %rdx
+	testq	%rdx, %rdx
+	jne	.L2351
+	cmpq	%r12, %r14
+	jb	.L2353
+.L2352:
+	leaq	24(%r13), %rsi
+	movl	$23, %r15d
+	jmp	.L2358
+.L2991:
+	cmpq	%r12, %r15
+	movq	%r12, %rdx
+	leaq	24(%rbx), %rdi
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	jne	.L2377
+	cmpq	%r15, %r12
+	jb	.L2379
+.L2378:
+	leaq	24(%rbx), %rsi
+	movl	$23, %r14d
+	jmp	.L2384
+.L2987:
+	addq	$72, %rax
+	jmp	.L2322
+.L2989:
+	addq	$120, %rax
+	jmp	.L2348
+.L2329:
+	jns	.L2330
+	jmp	.L2327
+.L2303:
+	jns	.L2304
+	jmp	.L2301
+.L2381:
+	jns	.L2382
+	jmp	.L2379
+.L2355:
+	jns	.L2356
+	jmp	.L2353
+.L2995:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L2512
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2512
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2512
+.L3020:
+	movdqu	24(%rbx), %xmm4
+	movups	%xmm4, 24(%rbp)
+	movq	40(%rbx), %rax
+	movq	%rax, 40(%rbp)
+	movq	8(%rbx), %rdx
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+	cmpq	$23, %rdx
+	je	.L2482
+.L2478:
+	movq	16(%rbx), %rdi
+	movq	24(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB96:
+	call	*24(%rax)
+.LEHE96:
+	jmp	.L2482
+.L2538:
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movdqu	(%rbx), %xmm6
+	movq	8(%rbx), %r13
+	movq	168(%rsp), %rax
+	movhlps	%xmm6, %xmm0
+	movaps	%xmm6, (%rsp)
+	movq	%rax, 40(%rsp)
+	movq	%xmm0, %r12
+	jmp	.L2536
+.L3025:
+	movq	104(%rsp), %rbx
+	jmp	.L2727
+.L3003:
+	movdqu	184(%rsp), %xmm3
+	movq	200(%rsp), %rax
+	movups	%xmm3, -24(%rbx)
+	movq	%rax, -8(%rbx)
+	jmp	.L2572
+.L3002:
+	movdqu	-24(%rbx), %xmm7
+	movups	%xmm7, 24(%rcx)
+	movq	-8(%rbx), %rax
+	movq	%rax, 40(%rcx)
+	movq	-40(%rbx), %rax
+	movq	$0, -48(%rbx)
+	movb	$0, -24(%rbx)
+	jmp	.L2566
+.L2405:
+	movups	%xmm5, (%rcx)
+	jmp	.L2412
+.L2422:
+	cmpq	%rbp, %r12
+	jnb	.L2426
+	jmp	.L2421
+.L2302:
+	cmpq	%r12, %rbp
+	jnb	.L2305
+	jmp	.L2301
+.L2380:
+	cmpq	%r15, %r12
+	jnb	.L2383
+	jmp	.L2379
+.L2354:
+	cmpq	%r12, %r14
+	jnb	.L2358
+	jmp	.L2353
+.L2328:
+	cmpq	%r15, %r13
+	jnb	.L2332
+	jmp	.L2327
+.L2665:
+	movq	32(%rsp), %rax
+	cmpq	%r14, %rax
+	je	.L2666
+	leaq	48(%rax), %r12
+	cmpq	%r14, %r12
+	jnb	.L2666
+	leaq	232(%rsp), %rax
+	movq	$0, 104(%rsp)
+	movq	%rax, 96(%rsp)
+	jmp	.L2693
+.L3028:
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2671
+	js	.L2674
+.L2673:
+	addq	$48, %r12
+	cmpq	%r14, %r12
+	jnb	.L2666
+.L2693:
+	cmpq	$23, -40(%r12)
+	movq	-48(%r12), %rbp
+	leaq	-24(%r12), %rsi
+	je	.L2668
+	movq	-24(%r12), %rsi
+.L2668:
+	movdqu	(%r12), %xmm4
+	movq	8(%r12), %rax
+	leaq	24(%r12), %rdi
+	movhlps	%xmm4, %xmm5
+	movq	%rax, 64(%rsp)
+	movq	%xmm4, %r15
+	movq	%xmm5, %rax
+	movaps	%xmm4, 48(%rsp)
+	movq	%xmm5, 16(%rsp)
+	cmpq	$23, %rax
+	je	.L2670
+	movq	24(%r12), %rdi
+.L2670:
+	cmpq	%rbp, %r15
+	movq	%rbp, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	jne	.L3028
+.L2671:
+	cmpq	%rbp, %r15
+	jnb	.L2673
+.L2674:
+	movdqa	.LC4(%rip), %xmm4
+	movaps	%xmm4, 208(%rsp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L3029
+.L2675:
+	movq	16(%r12), %rax
+	movdqa	48(%rsp), %xmm7
+	pxor	%xmm0, %xmm0
+	cmpq	$23, 16(%rsp)
+	movaps	%xmm0, 240(%rsp)
+	movq	%rax, 112(%rsp)
+	movq	%rax, 224(%rsp)
+	movaps	%xmm7, 208(%rsp)
+	je	.L3030
+	movq	$23, 8(%r12)
+	movq	24(%r12), %rax
+	movq	%rax, 232(%rsp)
+.L2679:
+	movq	%r12, %r13
+	movq	$0, (%r12)
+	movb	$0, 24(%r12)
+	movq	8(%r13), %rax
+	cmpq	$23, %rax
+	je	.L2680
+.L3032:
+	movq	16(%r13), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%r13), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB97:
+	call	*24(%rax)
+	movq	$23, 8(%r13)
+.L2680:
+	movb	$0, 24(%r13)
+	movq	-48(%r13), %rax
+	leaq	-48(%r13), %rbp
+	movq	16(%rbp), %rdx
+	movq	%rax, 48(%rbp)
+	movq	8(%rbp), %rax
+	movq	%rdx, 64(%rbp)
+	movq	%rax, 56(%rbp)
+	cmpq	$23, %rax
+	je	.L3031
+	movq	24(%rbp), %rax
+	movq	$23, 8(%rbp)
+	movq	%rax, 72(%rbp)
+.L2682:
+	movq	32(%rsp), %rax
+	movq	$0, 0(%rbp)
+	movb	$0, 24(%rbp)
+	cmpq	%rax, %rbp
+	je	.L2683
+	cmpq	$23, -40(%rbp)
+	movq	-48(%rbp), %rcx
+	leaq	-24(%rbp), %rsi
+	je	.L2685
+	movq	-24(%rbp), %rsi
+.L2685:
+	cmpq	$23, 16(%rsp)
+	movq	96(%rsp), %rdi
+	je	.L2686
+	movq	232(%rsp), %rdi
+.L2686:
+	cmpq	%rcx, %r15
+	movq	%rcx, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L2687
+	movq	%rcx, 80(%rsp)
+	call	memcmp@PLT
+	movq	80(%rsp), %rcx
+	testl	%eax, %eax
+	je	.L2687
+	jns	.L2683
+.L2743:
+	movq	%rbp, %r13
+	movq	8(%r13), %rax
+	cmpq	$23, %rax
+	jne	.L3032
+	jmp	.L2680
+.L2994:
+	movdqu	24(%rbx), %xmm5
+	movups	%xmm5, 24(%rcx)
+	movq	40(%rbx), %rax
+	movq	%rax, 40(%rcx)
+	jmp	.L2407
+.L2687:
+	cmpq	%rcx, %r15
+	jb	.L2743
+.L2683:
+	movq	-40(%r13), %rax
+	cmpq	$23, %rax
+	je	.L2690
+	movq	-32(%r13), %rdi
+	leaq	1(%rax), %rdx
+	movq	-24(%r13), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE97:
+.L2690:
+	movdqa	48(%rsp), %xmm6
+	movq	112(%rsp), %rax
+	cmpq	$23, 16(%rsp)
+	movq	%rax, -32(%r13)
+	movups	%xmm6, -48(%r13)
+	je	.L3033
+	movq	232(%rsp), %rax
+	movq	%rax, -24(%r13)
+.L2980:
+	movabsq	$-6148914691236517205, %rdx
+	movq	%r12, %rax
+	subq	%rbp, %rax
+	sarq	$4, %rax
+	imulq	%rdx, %rax
+	addq	%rax, 104(%rsp)
+	cmpq	$8, 104(%rsp)
+	jbe	.L2673
+	addq	$48, %r12
+	cmpq	%r12, %r14
+	jne	.L2982
+.L2666:
+	movq	88(%rsp), %rax
+	cmpq	%rbx, %rax
+	je	.L2231
+	leaq	48(%rbx), %r12
+	cmpq	%rax, %r12
+	jnb	.L2231
+	leaq	232(%rsp), %rax
+	movq	$0, 64(%rsp)
+	movq	%rax, 96(%rsp)
+	jmp	.L2722
+.L3034:
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2700
+	js	.L2703
+.L2702:
+	movq	88(%rsp), %rax
+	addq	$48, %r12
+	cmpq	%rax, %r12
+	jnb	.L2231
+.L2722:
+	cmpq	$23, -40(%r12)
+	movq	-48(%r12), %rbp
+	leaq	-24(%r12), %rsi
+	je	.L2697
+	movq	-24(%r12), %rsi
+.L2697:
+	movdqu	(%r12), %xmm5
+	movq	8(%r12), %r15
+	leaq	24(%r12), %rdi
+	movhlps	%xmm5, %xmm3
+	movaps	%xmm5, 48(%rsp)
+	movq	%xmm5, %r13
+	movq	%xmm3, %rax
+	movq	%xmm3, 16(%rsp)
+	cmpq	$23, %rax
+	je	.L2699
+	movq	24(%r12), %rdi
+.L2699:
+	cmpq	%rbp, %r13
+	movq	%rbp, %rdx
+	cmovbe	%r13, %rdx
+	testq	%rdx, %rdx
+	jne	.L3034
+.L2700:
+	cmpq	%rbp, %r13
+	jnb	.L2702
+.L2703:
+	movdqa	.LC4(%rip), %xmm7
+	movaps	%xmm7, 208(%rsp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L3035
+.L2704:
+	movq	16(%r12), %rax
+	movdqa	48(%rsp), %xmm3
+	pxor	%xmm0, %xmm0
+	cmpq	$23, 16(%rsp)
+	movaps	%xmm0, 240(%rsp)
+	movq	%rax, 80(%rsp)
+	movq	%rax, 224(%rsp)
+	movaps	%xmm3, 208(%rsp)
+	je	.L3036
+	movq	$23, 8(%r12)
+	movq	24(%r12), %rax
+	movq	%rax, 232(%rsp)
+.L2708:
+	movq	$0, (%r12)
+	movq	%r12, %rbp
+	movb	$0, 24(%r12)
+.L2892:
+	movq	8(%rbp), %rax
+	cmpq	$23, %rax
+	je	.L2709
+	movq	16(%rbp), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%rbp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB98:
+	call	*24(%rax)
+.LEHE98:
+	movq	$23, 8(%rbp)
+.L2709:
+	movq	-48(%rbp), %rax
+	movq	-32(%rbp), %rdx
+	subq	$48, %rbp
+	movb	$0, 72(%rbp)
+	movq	%rax, 48(%rbp)
+	movq	8(%rbp), %rax
+	movq	%rdx, 64(%rbp)
+	movq	%rax, 56(%rbp)
+	cmpq	$23, %rax
+	je	.L3037
+	movq	24(%rbp), %rax
+	movq	$23, 8(%rbp)
+	movq	%rax, 72(%rbp)
+.L2711:
+	movq	$0, 0(%rbp)
+	movb	$0, 24(%rbp)
+	cmpq	%rbx, %rbp
+	je	.L2712
+	cmpq	$23, -40(%rbp)
+	movq	-48(%rbp), %rcx
+	leaq	-24(%rbp), %rsi
+	je	.L2714
+	movq	-24(%rbp), %rsi
+.L2714:
+	cmpq	$23, 16(%rsp)
+	movq	96(%rsp), %rdi
+	je	.L2715
+	movq	232(%rsp), %rdi
+.L2715:
+	cmpq	%rcx, %r13
+	movq	%rcx, %rdx
+	cmovbe	%r13, %rdx
+	testq	%rdx, %rdx
+	je	.L2716
+	movq	%rcx, 104(%rsp)
+	call	memcmp@PLT
+	movq	104(%rsp), %rcx
+	testl	%eax, %eax
+	je	.L2716
+	js	.L2892
+	jmp	.L2712
+	.p2align 4,,10
+	.p2align 3
+.L2284:
+	cmpq	%rcx, %r12
+	jb	.L2885
+	movq	8(%rbx), %rax
+	cmpq	$23, %rax
+	jne	.L3038
+	jmp	.L2288
+.L3031:
+	movdqu	-24(%r13), %xmm5
+	movq	-8(%r13), %rax
+	movups	%xmm5, 24(%r13)
+	movq	%rax, 40(%r13)
+	jmp	.L2682
+.L3011:
+	movdqu	24(%rbx), %xmm5
+	movq	40(%rbx), %rax
+	movups	%xmm5, 72(%rbx)
+	movq	%rax, 88(%rbx)
+	jmp	.L2280
+.L2474:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2974
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2974
+.L2418:
+	cmpq	%rbp, %r12
+	jb	.L2421
+	movq	32(%rsp), %rax
+	movl	$23, %r15d
+	leaq	24(%rax), %rsi
+	jmp	.L2426
+.L3005:
+	movq	136(%rsp), %rax
+	leaq	-1(%rax), %rcx
+	leaq	-1(%rax,%rax), %rax
+	movq	%rcx, 40(%rsp)
+	movq	128(%rsp), %rcx
+	movq	%rax, 104(%rsp)
+	movq	32(%rsp), %rax
+	leaq	-48(%rax,%rcx), %rax
+	movq	%rax, 112(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L2577:
+	movq	48(%rsp), %rcx
+	cmpq	%rcx, 104(%rsp)
+	jnb	.L2591
+	movq	112(%rsp), %rax
+	movq	104(%rsp), %r13
+	movq	40(%rsp), %r14
+	movdqu	(%rax), %xmm6
+	movq	8(%rax), %rax
+	movhlps	%xmm6, %xmm3
+	movq	%rax, 120(%rsp)
+	movaps	%xmm6, (%rsp)
+	movq	%xmm3, %r15
+	jmp	.L2608
+	.p2align 4,,10
+	.p2align 3
+.L3043:
+	movq	%rcx, 16(%rsp)
+	call	memcmp@PLT
+	movq	16(%rsp), %rcx
+	testl	%eax, %eax
+	je	.L2589
+	jns	.L2591
+.L2592:
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L3039
+.L2593:
+	pxor	%xmm0, %xmm0
+	movq	16(%r14), %rbp
+	movaps	%xmm0, 240(%rsp)
+	cmpq	$23, %r15
+	je	.L3040
+	movq	24(%r14), %rax
+	movq	$23, 8(%r14)
+	movq	$0, (%r14)
+	movq	%rax, 232(%rsp)
+	movb	$0, 24(%r14)
+	cmpq	%rbx, %r14
+	je	.L3041
+.L2597:
+	movq	$0, (%r14)
+	movb	$0, 24(%r14)
+	movq	(%rbx), %rax
+	movq	16(%rbx), %rdx
+	movq	%rax, (%r14)
+	movq	8(%rbx), %rax
+	movq	%rdx, 16(%r14)
+	movq	%rax, 8(%r14)
+	cmpq	$23, %rax
+	je	.L3042
+	movq	24(%rbx), %rax
+	movq	%rax, 24(%r14)
+	movq	$23, 8(%rbx)
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+.L2603:
+	movdqa	(%rsp), %xmm6
+	movq	%rbp, 16(%rbx)
+	movups	%xmm6, (%rbx)
+	cmpq	$23, %r15
+	je	.L2601
+.L2600:
+	movq	232(%rsp), %rax
+	movq	48(%rsp), %rcx
+	movq	%rax, 24(%rbx)
+	leaq	1(%r13,%r13), %rax
+	cmpq	%rcx, %rax
+	jnb	.L2591
+.L2607:
+	movq	%r13, %r14
+	movq	%rax, %r13
+.L2608:
+	movq	32(%rsp), %rsi
+	leaq	0(%r13,%r13,2), %rbx
+	leaq	1(%r14), %rax
+	movq	48(%rsp), %rdi
+	salq	$4, %rbx
+	leaq	(%rax,%rax), %r9
+	movq	(%rsp), %rcx
+	addq	%rsi, %rbx
+	movq	(%rbx), %r12
+	movq	8(%rbx), %r8
+	cmpq	%rdi, %r9
+	jnb	.L2578
+	addq	%r9, %rax
+	salq	$5, %rax
+	leaq	(%rsi,%rax), %rbp
+	movq	8(%rbp), %r11
+	movq	0(%rbp), %r10
+	leaq	24(%rbp), %rsi
+	cmpq	$23, %r11
+	je	.L2580
+	movq	24(%rbp), %rsi
+.L2580:
+	leaq	24(%rbx), %rdi
+	cmpq	$23, %r8
+	je	.L2582
+	movq	24(%rbx), %rdi
+.L2582:
+	cmpq	%r12, %r10
+	movq	%r12, %rdx
+	cmovbe	%r10, %rdx
+	testq	%rdx, %rdx
+	je	.L2583
+	movq	%r8, 96(%rsp)
+	movq	%r11, 88(%rsp)
+	movq	%r10, 80(%rsp)
+	movq	%r9, 64(%rsp)
+	movq	%rcx, 16(%rsp)
+	call	memcmp@PLT
+	movq	16(%rsp), %rcx
+	movq	64(%rsp), %r9
+	testl	%eax, %eax
+	movq	80(%rsp), %r10
+	movq	88(%rsp), %r11
+	movq	96(%rsp), %r8
+	je	.L2583
+	cmovs	%r11, %r8
+	cmovs	%r10, %r12
+	cmovs	%rbp, %rbx
+	cmovs	%r9, %r13
+	.p2align 4,,10
+	.p2align 3
+.L2578:
+	movq	32(%rsp), %rax
+	leaq	(%r14,%r14,2), %r14
+	leaq	24(%rbx), %rsi
+	salq	$4, %r14
+	addq	%rax, %r14
+	cmpq	$23, %r8
+	je	.L2586
+	movq	24(%rbx), %rsi
+.L2586:
+	leaq	24(%r14), %rdi
+	cmpq	$23, %r15
+	je	.L2588
+	movq	24(%r14), %rdi
+.L2588:
+	cmpq	%r12, %rcx
+	movq	%r12, %rdx
+	cmovbe	%rcx, %rdx
+	testq	%rdx, %rdx
+	jne	.L3043
+.L2589:
+	cmpq	%r12, %rcx
+	jb	.L2592
+.L2591:
+	subq	$1, 40(%rsp)
+	movq	40(%rsp), %rax
+	subq	$2, 104(%rsp)
+	subq	$48, 112(%rsp)
+	cmpq	$-1, %rax
+	jne	.L2577
+	movq	48(%rsp), %rax
+	movq	32(%rsp), %rcx
+	leaq	-1(%rax), %r14
+	leaq	(%rax,%rax,2), %rax
+	salq	$4, %rax
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	leaq	-24(%rcx,%rax), %r15
+	je	.L3044
+	.p2align 4,,10
+	.p2align 3
+.L2612:
+	movq	32(%rsp), %rax
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 240(%rsp)
+	movdqu	(%rax), %xmm5
+	movq	8(%rax), %r12
+	movq	%rax, %rcx
+	movq	16(%rax), %rbp
+	movhlps	%xmm5, %xmm3
+	movaps	%xmm5, (%rsp)
+	movq	%xmm3, %rbx
+	cmpq	$23, %rbx
+	je	.L3045
+	movq	24(%rax), %rax
+	movq	$23, 8(%rcx)
+	movq	$0, (%rcx)
+	movq	%rax, 232(%rsp)
+	leaq	-24(%r15), %rax
+	movb	$0, 24(%rcx)
+	cmpq	%rax, %rcx
+	je	.L3046
+.L2615:
+	movq	32(%rsp), %rcx
+	movq	$0, (%rcx)
+	movb	$0, 24(%rcx)
+	movq	-24(%r15), %rax
+	movq	-8(%r15), %rdx
+	movq	%rax, (%rcx)
+	movq	-16(%r15), %rax
+	movq	%rdx, 16(%rcx)
+	movq	%rax, 8(%rcx)
+	cmpq	$23, %rax
+	je	.L3047
+	movq	(%r15), %rax
+	movq	%rax, 24(%rcx)
+	movq	$23, -16(%r15)
+	movq	$0, -24(%r15)
+	movb	$0, (%r15)
+.L2621:
+	movdqa	(%rsp), %xmm3
+	movq	%rbp, -8(%r15)
+	movups	%xmm3, -24(%r15)
+	cmpq	$23, %rbx
+	je	.L2619
+.L2618:
+	movq	232(%rsp), %rax
+	movq	%rax, (%r15)
+.L2625:
+	cmpq	$1, %r14
+	je	.L2231
+	movq	32(%rsp), %rax
+	movl	$1, %r12d
+	xorl	%r8d, %r8d
+	movdqu	(%rax), %xmm3
+	movq	8(%rax), %rax
+	movhlps	%xmm3, %xmm5
+	movq	%rax, 104(%rsp)
+	movaps	%xmm3, (%rsp)
+	movq	%xmm5, %r13
+	jmp	.L2657
+	.p2align 4,,10
+	.p2align 3
+.L3052:
+	movq	%rcx, 48(%rsp)
+	movq	%r9, 40(%rsp)
+	movq	%r8, 16(%rsp)
+	call	memcmp@PLT
+	movq	16(%rsp), %r8
+	movq	40(%rsp), %r9
+	testl	%eax, %eax
+	movq	48(%rsp), %rcx
+	je	.L2638
+	jns	.L2640
+.L2641:
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L3048
+.L2642:
+	pxor	%xmm0, %xmm0
+	movq	16(%r8), %rbp
+	movaps	%xmm0, 240(%rsp)
+	cmpq	$23, %r13
+	je	.L3049
+	movq	24(%r8), %rax
+	movq	$23, 8(%r8)
+	movq	$0, (%r8)
+	movq	%rax, 232(%rsp)
+	movb	$0, 24(%r8)
+	cmpq	%r8, %rbx
+	je	.L3050
+.L2646:
+	movq	$0, (%r8)
+	movb	$0, 24(%r8)
+	movq	(%rbx), %rax
+	movq	16(%rbx), %rdx
+	movq	%rax, (%r8)
+	movq	8(%rbx), %rax
+	movq	%rdx, 16(%r8)
+	movq	%rax, 8(%r8)
+	cmpq	$23, %rax
+	je	.L3051
+	movq	24(%rbx), %rax
+	movq	%rax, 24(%r8)
+	movq	$23, 8(%rbx)
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+.L2652:
+	movdqa	(%rsp), %xmm7
+	movq	%rbp, 16(%rbx)
+	movups	%xmm7, (%rbx)
+	cmpq	$23, %r13
+	je	.L2650
+.L2649:
+	movq	232(%rsp), %rax
+	movq	%rax, 24(%rbx)
+	leaq	1(%r12,%r12), %rax
+	cmpq	%r14, %rax
+	jnb	.L2640
+.L2656:
+	movq	%r12, %r8
+	movq	%rax, %r12
+.L2657:
+	movq	32(%rsp), %rsi
+	leaq	(%r12,%r12,2), %rbx
+	leaq	1(%r8), %rax
+	movq	(%rsp), %r9
+	salq	$4, %rbx
+	leaq	(%rax,%rax), %r11
+	addq	%rsi, %rbx
+	movq	(%rbx), %rcx
+	movq	8(%rbx), %r10
+	cmpq	%r14, %r11
+	jnb	.L2627
+	addq	%r11, %rax
+	salq	$5, %rax
+	leaq	(%rsi,%rax), %rbp
+	movq	0(%rbp), %rax
+	leaq	24(%rbp), %rsi
+	movq	%rax, 16(%rsp)
+	movq	8(%rbp), %rax
+	movq	%rax, 40(%rsp)
+	cmpq	$23, %rax
+	je	.L2629
+	movq	24(%rbp), %rsi
+.L2629:
+	leaq	24(%rbx), %rdi
+	cmpq	$23, %r10
+	je	.L2631
+	movq	24(%rbx), %rdi
+.L2631:
+	movq	16(%rsp), %rax
+	cmpq	%rcx, %rax
+	movq	%rax, %rdx
+	cmova	%rcx, %rdx
+	testq	%rdx, %rdx
+	je	.L2632
+	movq	%rcx, 96(%rsp)
+	movq	%r9, 88(%rsp)
+	movq	%r10, 80(%rsp)
+	movq	%r8, 64(%rsp)
+	movq	%r11, 48(%rsp)
+	call	memcmp@PLT
+	movq	48(%rsp), %r11
+	movq	64(%rsp), %r8
+	testl	%eax, %eax
+	movq	80(%rsp), %r10
+	movq	88(%rsp), %r9
+	movq	96(%rsp), %rcx
+	je	.L2632
+	cmovs	40(%rsp), %r10
+	cmovs	16(%rsp), %rcx
+	cmovs	%rbp, %rbx
+	cmovs	%r11, %r12
+	.p2align 4,,10
+	.p2align 3
+.L2627:
+	movq	32(%rsp), %rax
+	leaq	(%r8,%r8,2), %r8
+	leaq	24(%rbx), %rsi
+	salq	$4, %r8
+	addq	%rax, %r8
+	cmpq	$23, %r10
+	je	.L2635
+	movq	24(%rbx), %rsi
+.L2635:
+	leaq	24(%r8), %rdi
+	cmpq	$23, %r13
+	je	.L2637
+	movq	24(%r8), %rdi
+.L2637:
+	cmpq	%rcx, %r9
+	movq	%rcx, %rdx
+	cmovbe	%r9, %rdx
+	testq	%rdx, %rdx
+	jne	.L3052
+.L2638:
+	cmpq	%rcx, %r9
+	jb	.L2641
+.L2640:
+	subq	$1, %r14
+	subq	$48, %r15
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	jne	.L2612
+.L3044:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L2612
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2612
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2612
+.L3053:
+	movdqa	(%rsp), %xmm6
+	movq	%rbp, 16(%rbx)
+	movups	%xmm6, (%rbx)
+.L2650:
+	movq	248(%rsp), %rax
+	movdqu	232(%rsp), %xmm7
+	movq	%rax, 40(%rbx)
+	leaq	1(%r12,%r12), %rax
+	movups	%xmm7, 24(%rbx)
+	cmpq	%r14, %rax
+	jb	.L2656
+	jmp	.L2640
+.L3054:
+	movdqa	(%rsp), %xmm5
+	movq	%rbp, 16(%rbx)
+	movups	%xmm5, (%rbx)
+.L2601:
+	movq	248(%rsp), %rax
+	movq	48(%rsp), %rcx
+	movdqu	232(%rsp), %xmm4
+	movq	%rax, 40(%rbx)
+	leaq	1(%r13,%r13), %rax
+	movups	%xmm4, 24(%rbx)
+	cmpq	%rcx, %rax
+	jb	.L2607
+	jmp	.L2591
+	.p2align 4,,10
+	.p2align 3
+.L2632:
+	movq	16(%rsp), %rax
+	cmpq	%rax, %rcx
+	jnb	.L2627
+	movq	40(%rsp), %r10
+	movq	%rax, %rcx
+	movq	%rbp, %rbx
+	movq	%r11, %r12
+	jmp	.L2627
+	.p2align 4,,10
+	.p2align 3
+.L2583:
+	cmpq	%r10, %r12
+	jnb	.L2578
+	movq	%r11, %r8
+	movq	%r10, %r12
+	movq	%rbp, %rbx
+	movq	%r9, %r13
+	jmp	.L2578
+	.p2align 4,,10
+	.p2align 3
+.L3050:
+	movdqa	(%rsp), %xmm7
+	movq	%rbp, 16(%rbx)
+	movups	%xmm7, (%rbx)
+	jmp	.L2649
+	.p2align 4,,10
+	.p2align 3
+.L3041:
+	movdqa	(%rsp), %xmm6
+	movq	%rbp, 16(%rbx)
+	movups	%xmm6, (%rbx)
+	jmp	.L2600
+	.p2align 4,,10
+	.p2align 3
+.L3049:
+	movdqu	24(%r8), %xmm7
+	movq	40(%r8), %rax
+	movq	$0, (%r8)
+	movb	$0, 24(%r8)
+	movq	%rax, 248(%rsp)
+	movups	%xmm7, 232(%rsp)
+	cmpq	%r8, %rbx
+	jne	.L2646
+	movq	8(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L3053
+.L2648:
+	movq	16(%rbx), %rdi
+	movq	24(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB99:
+	call	*24(%rax)
+.LEHE99:
+	jmp	.L2652
+	.p2align 4,,10
+	.p2align 3
+.L3040:
+	movdqu	24(%r14), %xmm6
+	movq	40(%r14), %rax
+	movq	$0, (%r14)
+	movb	$0, 24(%r14)
+	movq	%rax, 248(%rsp)
+	movups	%xmm6, 232(%rsp)
+	cmpq	%rbx, %r14
+	jne	.L2597
+	movq	8(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L3054
+.L2599:
+	movq	16(%rbx), %rdi
+	movq	24(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB100:
+	call	*24(%rax)
+.LEHE100:
+	jmp	.L2603
+.L3039:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2594
+.L2978:
+	movdqu	(%r14), %xmm7
+	movq	8(%r14), %rax
+	movaps	%xmm7, (%rsp)
+	psrldq	$8, %xmm7
+	movq	%rax, 120(%rsp)
+	movq	%xmm7, %r15
+	jmp	.L2593
+.L3048:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2643
+.L2979:
+	movdqu	(%r8), %xmm6
+	movq	8(%r8), %rax
+	movhlps	%xmm6, %xmm5
+	movq	%rax, 104(%rsp)
+	movaps	%xmm6, (%rsp)
+	movq	%xmm5, %r13
+	jmp	.L2642
+.L3042:
+	movdqu	24(%rbx), %xmm5
+	movups	%xmm5, 24(%r14)
+	movq	40(%rbx), %rax
+	movq	%rax, 40(%r14)
+	movq	8(%rbx), %rdx
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+	cmpq	$23, %rdx
+	jne	.L2599
+	jmp	.L2603
+.L3051:
+	movdqu	24(%rbx), %xmm3
+	movups	%xmm3, 24(%r8)
+	movq	40(%rbx), %rax
+	movq	%rax, 40(%r8)
+	movq	8(%rbx), %rdx
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+	cmpq	$23, %rdx
+	jne	.L2648
+	jmp	.L2652
+.L2643:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%r8, (%rsp)
+	call	__cxa_guard_acquire@PLT
+	movq	(%rsp), %r8
+	testl	%eax, %eax
+	jne	.L2644
+	movdqu	(%r8), %xmm4
+	movq	8(%r8), %rax
+	movhlps	%xmm4, %xmm7
+	movq	%rax, 104(%rsp)
+	movaps	%xmm4, (%rsp)
+	movq	%xmm7, %r13
+	jmp	.L2642
+.L2594:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2978
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movdqu	(%r14), %xmm5
+	movq	8(%r14), %rax
+	movaps	%xmm5, (%rsp)
+	psrldq	$8, %xmm5
+	movq	%rax, 120(%rsp)
+	movq	%xmm5, %r15
+	jmp	.L2593
+.L3045:
+	movdqu	24(%rax), %xmm6
+	movq	40(%rax), %rax
+	movq	$0, (%rcx)
+	movb	$0, 24(%rcx)
+	movq	%rax, 248(%rsp)
+	leaq	-24(%r15), %rax
+	movaps	%xmm6, 16(%rsp)
+	movups	%xmm6, 232(%rsp)
+	cmpq	%rax, %rcx
+	jne	.L2615
+	movq	-16(%r15), %rax
+	cmpq	$23, %rax
+	jne	.L2617
+	movq	%rbp, -8(%r15)
+	movups	%xmm5, -24(%r15)
+.L2619:
+	movdqu	232(%rsp), %xmm6
+	movq	248(%rsp), %rax
+	movups	%xmm6, (%r15)
+	movq	%rax, 16(%r15)
+	jmp	.L2625
+.L3046:
+	movq	-16(%r15), %rax
+	cmpq	$23, %rax
+	je	.L3055
+.L2617:
+	movq	-8(%r15), %rdi
+	leaq	1(%rax), %rdx
+	movq	(%r15), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB101:
+	call	*24(%rax)
+.LEHE101:
+	jmp	.L2621
+.L2644:
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%r8, (%rsp)
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movq	(%rsp), %r8
+	jmp	.L2979
+.L3047:
+	movdqu	(%r15), %xmm5
+	movups	%xmm5, 24(%rcx)
+	movq	16(%r15), %rax
+	movq	%rax, 40(%rcx)
+	movq	-16(%r15), %rax
+	movq	$0, -24(%r15)
+	movb	$0, (%r15)
+	cmpq	$23, %rax
+	jne	.L2617
+	jmp	.L2621
+.L3033:
+	movdqu	232(%rsp), %xmm4
+	movq	248(%rsp), %rax
+	movups	%xmm4, -24(%r13)
+	movq	%rax, -8(%r13)
+	jmp	.L2980
+.L2232:
+	testb	%cl, %cl
+	je	.L2234
+	movq	32(%rsp), %rcx
+	cmpq	%rcx, %rsi
+	je	.L2231
+	leaq	48(%rcx), %rbp
+	cmpq	%rsi, %rbp
+	jnb	.L2231
+	leaq	232(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	jmp	.L2262
+.L3056:
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2240
+	js	.L2243
+.L2242:
+	movq	88(%rsp), %rax
+	addq	$48, %rbp
+	cmpq	%rax, %rbp
+	jnb	.L2231
+.L2262:
+	cmpq	$23, -40(%rbp)
+	movq	-48(%rbp), %rbx
+	leaq	-24(%rbp), %rsi
+	je	.L2237
+	movq	-24(%rbp), %rsi
+.L2237:
+	movdqu	0(%rbp), %xmm4
+	movq	8(%rbp), %r14
+	leaq	24(%rbp), %rdi
+	movhlps	%xmm4, %xmm3
+	movaps	%xmm4, (%rsp)
+	movq	%xmm4, %r12
+	movq	%xmm3, %r13
+	cmpq	$23, %r13
+	je	.L2239
+	movq	24(%rbp), %rdi
+.L2239:
+	cmpq	%r12, %rbx
+	movq	%r12, %rdx
+	cmovbe	%rbx, %rdx
+	testq	%rdx, %rdx
+	jne	.L3056
+.L2240:
+	cmpq	%rbx, %r12
+	jnb	.L2242
+.L2243:
+	movdqa	.LC4(%rip), %xmm7
+	movaps	%xmm7, 208(%rsp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L3057
+.L2244:
+	movdqa	(%rsp), %xmm5
+	movq	16(%rbp), %r15
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 240(%rsp)
+	movq	%r15, 224(%rsp)
+	movaps	%xmm5, 208(%rsp)
+	cmpq	$23, %r13
+	je	.L3058
+	movq	24(%rbp), %rax
+	movq	$23, 8(%rbp)
+	movq	%rax, 232(%rsp)
+.L2248:
+	movq	$0, 0(%rbp)
+	movq	%rbp, %rbx
+	movb	$0, 24(%rbp)
+.L2884:
+	movq	8(%rbx), %rax
+	cmpq	$23, %rax
+	je	.L2249
+	movq	16(%rbx), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%rbx), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB102:
+	call	*24(%rax)
+	movq	$23, 8(%rbx)
+.L2249:
+	movq	-48(%rbx), %rax
+	movq	-32(%rbx), %rdx
+	subq	$48, %rbx
+	movb	$0, 72(%rbx)
+	movq	%rax, 48(%rbx)
+	movq	8(%rbx), %rax
+	movq	%rdx, 64(%rbx)
+	movq	%rax, 56(%rbx)
+	cmpq	$23, %rax
+	je	.L3059
+	movq	24(%rbx), %rax
+	movq	$23, 8(%rbx)
+	movq	%rax, 72(%rbx)
+.L2251:
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+	cmpq	%rbx, 32(%rsp)
+	je	.L2252
+	cmpq	$23, -40(%rbx)
+	movq	-48(%rbx), %rcx
+	leaq	-24(%rbx), %rsi
+	je	.L2254
+	movq	-24(%rbx), %rsi
+.L2254:
+	movq	16(%rsp), %rdi
+	cmpq	$23, %r13
+	je	.L2255
+	movq	232(%rsp), %rdi
+.L2255:
+	cmpq	%r12, %rcx
+	movq	%r12, %rdx
+	cmovbe	%rcx, %rdx
+	testq	%rdx, %rdx
+	je	.L2256
+	movq	%rcx, 40(%rsp)
+	call	memcmp@PLT
+	movq	40(%rsp), %rcx
+	testl	%eax, %eax
+	je	.L2256
+	js	.L2884
+	jmp	.L2252
+	.p2align 4,,10
+	.p2align 3
+.L2256:
+	cmpq	%rcx, %r12
+	jb	.L2884
+.L2252:
+	movq	8(%rbx), %rax
+	cmpq	$23, %rax
+	je	.L2259
+	movq	16(%rbx), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%rbx), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE102:
+.L2259:
+	movdqa	(%rsp), %xmm5
+	movq	%r15, 16(%rbx)
+	movups	%xmm5, (%rbx)
+	cmpq	$23, %r13
+	je	.L3060
+	movq	232(%rsp), %rax
+	movq	%rax, 24(%rbx)
+	jmp	.L2242
+.L3059:
+	movdqu	24(%rbx), %xmm7
+	movq	40(%rbx), %rax
+	movups	%xmm7, 72(%rbx)
+	movq	%rax, 88(%rbx)
+	jmp	.L2251
+.L3016:
+	movq	32(%rsp), %rcx
+	movdqu	24(%rcx), %xmm6
+	movq	40(%rcx), %rdx
+	movaps	%xmm6, (%rsp)
+	movq	(%rsp), %rax
+	movq	%rdx, 200(%rsp)
+	movq	%rax, %r14
+	movups	%xmm6, 184(%rsp)
+	movq	%rcx, %rax
+	jmp	.L2452
+.L2716:
+	cmpq	%rcx, %r13
+	jb	.L2892
+.L2712:
+	movq	8(%rbp), %rax
+	cmpq	$23, %rax
+	je	.L2719
+	movq	16(%rbp), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%rbp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB103:
+	call	*24(%rax)
+.LEHE103:
+.L2719:
+	movdqa	48(%rsp), %xmm4
+	movq	80(%rsp), %rax
+	cmpq	$23, 16(%rsp)
+	movq	%rax, 16(%rbp)
+	movups	%xmm4, 0(%rbp)
+	je	.L3061
+	movq	232(%rsp), %rax
+	movq	%rax, 24(%rbp)
+.L2981:
+	movabsq	$-6148914691236517205, %rdx
+	movq	%r12, %rax
+	subq	%rbp, %rax
+	sarq	$4, %rax
+	imulq	%rdx, %rax
+	addq	%rax, 64(%rsp)
+	cmpq	$8, 64(%rsp)
+	jbe	.L2702
+	leaq	48(%r12), %rax
+	cmpq	%rax, 88(%rsp)
+	jne	.L2982
+	jmp	.L2231
+	.p2align 4,,10
+	.p2align 3
+.L3037:
+	movdqu	24(%rbp), %xmm6
+	movq	40(%rbp), %rax
+	movups	%xmm6, 72(%rbp)
+	movq	%rax, 88(%rbp)
+	jmp	.L2711
+.L3015:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2449
+	movq	32(%rsp), %rax
+	movdqu	(%rax), %xmm3
+	movaps	%xmm3, 64(%rsp)
+	movq	%xmm3, %r15
+	movhps	%xmm3, 16(%rsp)
+	jmp	.L2448
+.L3023:
+	movdqu	184(%rsp), %xmm6
+	movq	200(%rsp), %rax
+	movups	%xmm6, 24(%rbx)
+	movq	%rax, 40(%rbx)
+	jmp	.L2508
+.L3022:
+	movdqu	24(%rbx), %xmm3
+	movups	%xmm3, 24(%rcx)
+	movq	40(%rbx), %rax
+	movq	%rax, 40(%rcx)
+	movq	8(%rbx), %r12
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+	jmp	.L2502
+.L3030:
+	movdqu	24(%r12), %xmm3
+	movq	40(%r12), %rax
+	movups	%xmm3, 232(%rsp)
+	movq	%rax, 248(%rsp)
+	jmp	.L2679
+.L3029:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2676
+	movdqu	(%r12), %xmm3
+	movq	8(%r12), %rax
+	movaps	%xmm3, 48(%rsp)
+	movq	%xmm3, %r15
+	movq	%rax, 64(%rsp)
+	movhps	%xmm3, 16(%rsp)
+	jmp	.L2675
+.L3055:
+	movq	%rbp, -8(%r15)
+	movups	%xmm5, -24(%r15)
+	jmp	.L2618
+.L3061:
+	movdqu	232(%rsp), %xmm7
+	movq	248(%rsp), %rax
+	movups	%xmm7, 24(%rbp)
+	movq	%rax, 40(%rbp)
+	jmp	.L2981
+.L3010:
+	movdqu	24(%rbp), %xmm3
+	movq	40(%rbp), %rax
+	movups	%xmm3, 232(%rsp)
+	movq	%rax, 248(%rsp)
+	jmp	.L2277
+.L3009:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2274
+	movdqu	0(%rbp), %xmm3
+	movq	8(%rbp), %r14
+	movhlps	%xmm3, %xmm5
+	movaps	%xmm3, (%rsp)
+	movq	%xmm3, %r12
+	movq	%xmm5, %r13
+	jmp	.L2273
+.L2449:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	jne	.L2450
+	movq	32(%rsp), %rax
+	movdqu	(%rax), %xmm7
+	movaps	%xmm7, 64(%rsp)
+	movq	%xmm7, %r15
+	movhps	%xmm7, 16(%rsp)
+	jmp	.L2448
+.L3058:
+	movdqu	24(%rbp), %xmm4
+	movq	40(%rbp), %rax
+	movups	%xmm4, 232(%rsp)
+	movq	%rax, 248(%rsp)
+	jmp	.L2248
+.L3057:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2245
+	movdqu	0(%rbp), %xmm3
+	movq	8(%rbp), %r14
+	movaps	%xmm3, (%rsp)
+	movq	%xmm3, %r12
+	psrldq	$8, %xmm3
+	movq	%xmm3, %r13
+	jmp	.L2244
+.L3012:
+	movdqu	232(%rsp), %xmm4
+	movq	248(%rsp), %rax
+	movups	%xmm4, 24(%rbx)
+	movq	%rax, 40(%rbx)
+	jmp	.L2271
+.L3060:
+	movdqu	232(%rsp), %xmm6
+	movq	248(%rsp), %rax
+	movups	%xmm6, 24(%rbx)
+	movq	%rax, 40(%rbx)
+	jmp	.L2242
+.L2676:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	jne	.L2677
+	movdqu	(%r12), %xmm7
+	movq	8(%r12), %rax
+	movaps	%xmm7, 48(%rsp)
+	movq	%xmm7, %r15
+	movq	%rax, 64(%rsp)
+	movhps	%xmm7, 16(%rsp)
+	jmp	.L2675
+.L3036:
+	movdqu	24(%r12), %xmm5
+	movq	40(%r12), %rax
+	movups	%xmm5, 232(%rsp)
+	movq	%rax, 248(%rsp)
+	jmp	.L2708
+.L3035:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2705
+	movdqu	(%r12), %xmm4
+	movq	8(%r12), %r15
+	movaps	%xmm4, 48(%rsp)
+	movq	%xmm4, %r13
+	movhps	%xmm4, 16(%rsp)
+	jmp	.L2704
+.L2245:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	jne	.L2246
+	movdqu	0(%rbp), %xmm4
+	movq	8(%rbp), %r14
+	movhlps	%xmm4, %xmm0
+	movaps	%xmm4, (%rsp)
+	movq	%xmm4, %r12
+	movq	%xmm0, %r13
+	jmp	.L2244
+.L2450:
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movq	32(%rsp), %rax
+	movdqu	(%rax), %xmm5
+	movaps	%xmm5, 64(%rsp)
+	movq	%xmm5, %r15
+	movhps	%xmm5, 16(%rsp)
+	jmp	.L2448
+.L2705:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	jne	.L2706
+	movdqu	(%r12), %xmm6
+	movq	8(%r12), %r15
+	movaps	%xmm6, 48(%rsp)
+	movq	%xmm6, %r13
+	movhps	%xmm6, 16(%rsp)
+	jmp	.L2704
+.L2246:
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movdqu	0(%rbp), %xmm7
+	movq	8(%rbp), %r14
+	movaps	%xmm7, (%rsp)
+	movq	%xmm7, %r12
+	psrldq	$8, %xmm7
+	movq	%xmm7, %r13
+	jmp	.L2244
+.L2706:
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movdqu	(%r12), %xmm3
+	movq	8(%r12), %r15
+	movaps	%xmm3, 48(%rsp)
+	movq	%xmm3, %r13
+	movhps	%xmm3, 16(%rsp)
+	jmp	.L2704
+.L2274:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	jne	.L2275
+	movdqu	0(%rbp), %xmm6
+	movq	8(%rbp), %r14
+	movhlps	%xmm6, %xmm3
+	movaps	%xmm6, (%rsp)
+	movq	%xmm6, %r12
+	movq	%xmm3, %r13
+	jmp	.L2273
+.L2275:
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movdqu	0(%rbp), %xmm4
+	movq	8(%rbp), %r14
+	movhlps	%xmm4, %xmm0
+	movaps	%xmm4, (%rsp)
+	movq	%xmm4, %r12
+	movq	%xmm0, %r13
+	jmp	.L2273
+.L2677:
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movdqu	(%r12), %xmm5
+	movq	8(%r12), %rax
+	movaps	%xmm5, 48(%rsp)
+	movq	%xmm5, %r15
+	movq	%rax, 64(%rsp)
+	movhps	%xmm5, 16(%rsp)
+	jmp	.L2675
+.L2739:
+	movq	104(%rsp), %rbx
+	jmp	.L2525
+.L2755:
+	movq	%rax, %rbx
+	jmp	.L2694
+.L2748:
+	movq	%rax, %rbx
+	jmp	.L2488
+.L2745:
+	movq	%rax, %rbx
+	jmp	.L2263
+.L2754:
+	movq	%rax, %rbx
+	jmp	.L2653
+.L2756:
+	movq	%rax, %rbx
+	jmp	.L2723
+.L2753:
+	movq	%rax, %rbx
+	jmp	.L2622
+.L2747:
+	movq	%rax, %rbx
+	jmp	.L2409
+.L2750:
+	movq	%rax, %rbx
+	jmp	.L2552
+.L2746:
+	movq	%rax, %rbx
+	jmp	.L2292
+.L2752:
+	movq	%rax, %rbx
+	jmp	.L2604
+.L2749:
+	movq	%rax, %rbx
+	jmp	.L2483
+.L2751:
+	movq	%rax, %rbx
+	jmp	.L2547
+	.section	.gcc_except_table
+.LLSDA7471:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7471-.LLSDACSB7471
+.LLSDACSB7471:
+	.uleb128 .LEHB85-.LFB7471
+	.uleb128 .LEHE85-.LEHB85
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB86-.LFB7471
+	.uleb128 .LEHE86-.LEHB86
+	.uleb128 .L2747-.LFB7471
+	.uleb128 0
+	.uleb128 .LEHB87-.LFB7471
+	.uleb128 .LEHE87-.LEHB87
+	.uleb128 .L2750-.LFB7471
+	.uleb128 0
+	.uleb128 .LEHB88-.LFB7471
+	.uleb128 .LEHE88-.LEHB88
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB89-.LFB7471
+	.uleb128 .LEHE89-.LEHB89
+	.uleb128 .L2746-.LFB7471
+	.uleb128 0
+	.uleb128 .LEHB90-.LFB7471
+	.uleb128 .LEHE90-.LEHB90
+	.uleb128 .L2751-.LFB7471
+	.uleb128 0
+	.uleb128 .LEHB91-.LFB7471
+	.uleb128 .LEHE91-.LEHB91
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB92-.LFB7471
+	.uleb128 .LEHE92-.LEHB92
+	.uleb128 .L2748-.LFB7471
+	.uleb128 0
+	.uleb128 .LEHB93-.LFB7471
+	.uleb128 .LEHE93-.LEHB93
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB94-.LFB7471
+	.uleb128 .LEHE94-.LEHB94
+	.uleb128 .L2750-.LFB7471
+	.uleb128 0
+	.uleb128 .LEHB95-.LFB7471
+	.uleb128 .LEHE95-.LEHB95
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB96-.LFB7471
+	.uleb128 .LEHE96-.LEHB96
+	.uleb128 .L2749-.LFB7471
+	.uleb128 0
+	.uleb128 .LEHB97-.LFB7471
+	.uleb128 .LEHE97-.LEHB97
+	.uleb128 .L2755-.LFB7471
+	.uleb128 0
+	.uleb128 .LEHB98-.LFB7471
+	.uleb128 .LEHE98-.LEHB98
+	.uleb128 .L2756-.LFB7471
+	.uleb128 0
+	.uleb128 .LEHB99-.LFB7471
+	.uleb128 .LEHE99-.LEHB99
+	.uleb128 .L2754-.LFB7471
+	.uleb128 0
+	.uleb128 .LEHB100-.LFB7471
+	.uleb128 .LEHE100-.LEHB100
+	.uleb128 .L2752-.LFB7471
+	.uleb128 0
+	.uleb128 .LEHB101-.LFB7471
+	.uleb128 .LEHE101-.LEHB101
+	.uleb128 .L2753-.LFB7471
+	.uleb128 0
+	.uleb128 .LEHB102-.LFB7471
+	.uleb128 .LEHE102-.LEHB102
+	.uleb128 .L2745-.LFB7471
+	.uleb128 0
+	.uleb128 .LEHB103-.LFB7471
+	.uleb128 .LEHE103-.LEHB103
+	.uleb128 .L2756-.LFB7471
+	.uleb128 0
+.LLSDACSE7471:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7471
+	.type	_ZN1n9__pdqsortINS_6stringIcEENS_4lessEEEvPT_S5_RT0_ib.isra.0.cold, @function
+_ZN1n9__pdqsortINS_6stringIcEENS_4lessEEEvPT_S5_RT0_ib.isra.0.cold:
+.LFSB7471:
+.L2694:
+	.cfi_def_cfa_offset 320
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	cmpq	$23, 64(%rsp)
+	je	.L2695
+	movq	112(%rsp), %rdi
+	movq	64(%rsp), %rdx
+	movl	$1, %ecx
+	movq	232(%rsp), %rsi
+	movq	(%rdi), %rax
+	addq	$1, %rdx
+	call	*24(%rax)
+.L2695:
+	movq	%rbx, %rdi
+.LEHB104:
+	call	_Unwind_Resume@PLT
+.LEHE104:
+.L2483:
+	cmpq	$23, %r14
+	je	.L2488
+	movq	0(%r13), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	movq	%r13, %rdi
+	movq	232(%rsp), %rsi
+	call	*24(%rax)
+.L2488:
+	movq	168(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L2510
+	movq	176(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	184(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2510:
+	movq	%rbx, %rdi
+.LEHB105:
+	call	_Unwind_Resume@PLT
+.LEHE105:
+.L2263:
+	cmpq	$23, %r14
+	je	.L2264
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	movq	%r15, %rdi
+	movq	232(%rsp), %rsi
+	call	*24(%rax)
+.L2264:
+	movq	%rbx, %rdi
+.LEHB106:
+	call	_Unwind_Resume@PLT
+.LEHE106:
+.L2653:
+	cmpq	$23, 104(%rsp)
+	je	.L2655
+	movq	104(%rsp), %rdx
+	movq	0(%rbp), %rax
+	movl	$1, %ecx
+	movq	%rbp, %rdi
+	movq	232(%rsp), %rsi
+	addq	$1, %rdx
+	call	*24(%rax)
+.L2655:
+	movq	%rbx, %rdi
+.LEHB107:
+	call	_Unwind_Resume@PLT
+.LEHE107:
+.L2723:
+	cmpq	$23, %r15
+	je	.L2724
+	movq	80(%rsp), %rdi
+	leaq	1(%r15), %rdx
+	movl	$1, %ecx
+	movq	232(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2724:
+	movq	%rbx, %rdi
+.LEHB108:
+	call	_Unwind_Resume@PLT
+.LEHE108:
+.L2622:
+	cmpq	$23, %r12
+	je	.L2624
+	movq	0(%rbp), %rax
+	movq	232(%rsp), %rsi
+	leaq	1(%r12), %rdx
+	movq	%rbp, %rdi
+	movl	$1, %ecx
+	call	*24(%rax)
+.L2624:
+	movq	%rbx, %rdi
+.LEHB109:
+	call	_Unwind_Resume@PLT
+.LEHE109:
+.L2409:
+	cmpq	$23, %r13
+	je	.L2411
+	movq	(%r12), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	movq	%r12, %rdi
+	movq	232(%rsp), %rsi
+	call	*24(%rax)
+.L2411:
+	movq	%rbx, %rdi
+.LEHB110:
+	call	_Unwind_Resume@PLT
+.LEHE110:
+.L2547:
+	cmpq	$23, %r13
+	je	.L2552
+	movq	(%r14), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	movq	%r14, %rdi
+	movq	232(%rsp), %rsi
+	call	*24(%rax)
+.L2552:
+	movq	168(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L2575
+	movq	176(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	184(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2575:
+	movq	%rbx, %rdi
+.LEHB111:
+	call	_Unwind_Resume@PLT
+.LEHE111:
+.L2292:
+	cmpq	$23, %r14
+	je	.L2293
+	movq	40(%rsp), %rdi
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	movq	232(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2293:
+	movq	%rbx, %rdi
+.LEHB112:
+	call	_Unwind_Resume@PLT
+.LEHE112:
+.L2604:
+	cmpq	$23, 120(%rsp)
+	je	.L2606
+	movq	120(%rsp), %rdx
+	movq	0(%rbp), %rax
+	movl	$1, %ecx
+	movq	%rbp, %rdi
+	movq	232(%rsp), %rsi
+	addq	$1, %rdx
+	call	*24(%rax)
+.L2606:
+	movq	%rbx, %rdi
+.LEHB113:
+	call	_Unwind_Resume@PLT
+.LEHE113:
+	.cfi_endproc
+.LFE7471:
+	.section	.gcc_except_table
+.LLSDAC7471:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7471-.LLSDACSBC7471
+.LLSDACSBC7471:
+	.uleb128 .LEHB104-.LCOLDB45
+	.uleb128 .LEHE104-.LEHB104
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB105-.LCOLDB45
+	.uleb128 .LEHE105-.LEHB105
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB106-.LCOLDB45
+	.uleb128 .LEHE106-.LEHB106
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB107-.LCOLDB45
+	.uleb128 .LEHE107-.LEHB107
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB108-.LCOLDB45
+	.uleb128 .LEHE108-.LEHB108
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB109-.LCOLDB45
+	.uleb128 .LEHE109-.LEHB109
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB110-.LCOLDB45
+	.uleb128 .LEHE110-.LEHB110
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB111-.LCOLDB45
+	.uleb128 .LEHE111-.LEHB111
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB112-.LCOLDB45
+	.uleb128 .LEHE112-.LEHB112
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB113-.LCOLDB45
+	.uleb128 .LEHE113-.LEHB113
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC7471:
+	.section	.text.unlikely
+	.text
+	.size	_ZN1n9__pdqsortINS_6stringIcEENS_4lessEEEvPT_S5_RT0_ib.isra.0, .-_ZN1n9__pdqsortINS_6stringIcEENS_4lessEEEvPT_S5_RT0_ib.isra.0
+	.section	.text.unlikely
+	.size	_ZN1n9__pdqsortINS_6stringIcEENS_4lessEEEvPT_S5_RT0_ib.isra.0.cold, .-_ZN1n9__pdqsortINS_6stringIcEENS_4lessEEEvPT_S5_RT0_ib.isra.0.cold
+.LCOLDE45:
+	.text
+.LHOTE45:
+	.section	.text._ZN1n4sortINS_11thread_poolENS_6stringIcEENS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceE,"axG",@progbits,_ZN1n4sortINS_11thread_poolENS_6stringIcEENS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceE,comdat
+	.p2align 4
+	.weak	_ZN1n4sortINS_11thread_poolENS_6stringIcEENS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceE
+	.type	_ZN1n4sortINS_11thread_poolENS_6stringIcEENS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceE, @function
+_ZN1n4sortINS_11thread_poolENS_6stringIcEENS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceE:
+.LFB7143:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7143
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdi, %rax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$952, %rsp
+	.cfi_def_cfa_offset 1008
+	movq	16(%rax), %rax
+	movq	%rdx, 104(%rsp)
+	addq	$4095, %rdx
+	shrq	$12, %rdx
+	leaq	4(,%rax,4), %rax
+	movq	%rdi, 80(%rsp)
+	movq	%rsi, %rdi
+	cmpq	%rdx, %rax
+	movq	%rcx, 112(%rsp)
+	cmova	%rdx, %rax
+	movl	$1, %edx
+	testq	%rax, %rax
+	cmovne	%rax, %rdx
+	cmpq	$1, %rax
+	jbe	.L3221
+	pxor	%xmm0, %xmm0
+	movq	%rsi, 144(%rsp)
+	movq	%rdx, %r15
+	movq	$0, 176(%rsp)
+	movups	%xmm0, 184(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L3222
+	xorl	%r14d, %r14d
+	xorl	%r13d, %r13d
+	xorl	%ecx, %ecx
+.L3067:
+	movq	%rax, 200(%rsp)
+	xorl	%edx, %edx
+	xorl	%r12d, %r12d
+	xorl	%ebx, %ebx
+	movq	104(%rsp), %rax
+	divq	%r15
+	movq	%rdx, 8(%rsp)
+	movq	%rax, (%rsp)
+	jmp	.L3076
+	.p2align 4,,10
+	.p2align 3
+.L3071:
+	movq	%rbp, (%r14,%rcx,8)
+.L3218:
+	movq	192(%rsp), %rcx
+.L3074:
+	movq	(%rsp), %rdi
+	addq	$1, %rcx
+	leaq	1(%rbx), %rax
+	movq	%rcx, 192(%rsp)
+	addq	%rdi, %r12
+	cmpq	%rbx, %r15
+	je	.L3075
+	movq	184(%rsp), %r13
+	movq	176(%rsp), %r14
+	movq	%rax, %rbx
+.L3076:
+	movq	8(%rsp), %rax
+	cmpq	%rbx, %rax
+	movq	%rax, %rbp
+	cmova	%rbx, %rbp
+	addq	%r12, %rbp
+	cmpq	%r13, %rcx
+	jne	.L3071
+	leaq	5(%r13), %rsi
+	movq	200(%rsp), %rdi
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 184(%rsp)
+	movq	(%rdi), %rax
+.LEHB114:
+	call	*16(%rax)
+	movq	192(%rsp), %rdx
+	movq	%rax, 176(%rsp)
+	movq	%rbp, (%rax,%rdx,8)
+	movq	192(%rsp), %rcx
+	testq	%rcx, %rcx
+	jne	.L3223
+	testq	%r14, %r14
+	je	.L3074
+.L3073:
+	movq	200(%rsp), %rdi
+	leaq	0(,%r13,8), %rdx
+	movl	$8, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE114:
+	jmp	.L3218
+.L3075:
+	leaq	176(%rsp), %rax
+	xorl	%ebx, %ebx
+	xorl	%edx, %edx
+	movq	$0, 264(%rsp)
+	movq	%rax, %rcx
+	movq	%rax, 16(%rsp)
+	leaq	144(%rsp), %rax
+	leaq	272(%rsp), %r13
+	movq	%rcx, %xmm0
+	leaq	208(%rsp), %rcx
+	movq	%rax, %xmm5
+	movq	$0, 272(%rsp)
+	leaq	143(%rsp), %rax
+	movq	%rcx, (%rsp)
+	punpcklqdq	%xmm5, %xmm0
+	leaq	264(%rsp), %rcx
+	movq	%rax, 88(%rsp)
+	leaq	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_NS_6stringIcEENS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE_EEvmOS8_EUlvE_EE(%rip), %rbp
+	leaq	256(%rsp), %r12
+	movq	%rax, 224(%rsp)
+	movq	80(%rsp), %rax
+	movq	$0, 280(%rsp)
+	movq	%r13, 928(%rsp)
+	movq	%r13, 40(%rsp)
+	movq	%rcx, 8(%rsp)
+	movq	%rax, 256(%rsp)
+	movq	%r13, %rax
+	movaps	%xmm0, 208(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L3077:
+	leaq	1(%rdx), %rcx
+	leaq	(%rdx,%rdx,4), %rdx
+	salq	$4, %rdx
+	movq	%rcx, 8(%rax)
+	leaq	16(%rax,%rdx), %rsi
+	movq	(%rsp), %rax
+	movq	$0, 56(%rsi)
+	movq	%rax, (%rsi)
+	movq	8(%rsp), %rax
+	movq	%rbx, 8(%rsi)
+	movq	%rbp, 48(%rsi)
+	movq	%rax, 64(%rsi)
+	lock addq	$1, 264(%rsp)
+	movq	256(%rsp), %rdi
+	movq	%r12, 32(%rsp)
+.LEHB115:
+	call	_ZN1n11thread_pool6__pushEPNS_11__task_nodeE
+	addq	$1, %rbx
+	cmpq	%rbx, %r15
+	je	.L3082
+	movq	928(%rsp), %rax
+	movq	8(%rax), %rdx
+	cmpq	$8, %rdx
+	jne	.L3077
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	je	.L3224
+.L3078:
+	movq	%rax, 928(%rsp)
+	movq	8(%rax), %rdx
+	jmp	.L3077
+.L3082:
+	leaq	256(%rsp), %rax
+	movq	%rax, %rdi
+	movq	%rax, 32(%rsp)
+	movq	%rax, %rbx
+	call	_ZN1n10task_group4syncEv
+.LEHE115:
+	movq	%rbx, %rdi
+	movq	%r13, %r12
+	call	_ZN1n10task_group4syncEv
+	.p2align 4,,10
+	.p2align 3
+.L3095:
+	movq	%r12, %r15
+	xorl	%ebp, %ebp
+	movq	(%r12), %r12
+	movq	8(%r15), %r14
+	leaq	16(%r15), %rbx
+	testq	%r14, %r14
+	je	.L3090
+	.p2align 4,,10
+	.p2align 3
+.L3091:
+	movq	48(%rbx), %rax
+	testq	%rax, %rax
+	je	.L3088
+	addq	$1, %rbp
+	movq	56(%rbx), %rsi
+	movq	%rbx, %rdi
+	addq	$80, %rbx
+	call	*16(%rax)
+	cmpq	%r14, %rbp
+	jne	.L3091
+.L3090:
+	cmpq	%r13, %r15
+	je	.L3087
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3225
+.L3093:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %ecx
+	movl	$656, %edx
+	movq	%r15, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L3087:
+	testq	%r12, %r12
+	jne	.L3095
+	movq	104(%rsp), %rax
+	movq	112(%rsp), %rdi
+	movl	$8, %edx
+	leaq	(%rax,%rax,2), %rax
+	salq	$4, %rax
+	movq	%rax, 120(%rsp)
+	movq	%rax, %rsi
+	movq	(%rdi), %rax
+.LEHB116:
+	call	*16(%rax)
+.LEHE116:
+	movq	%rax, %rcx
+	movq	%rax, 128(%rsp)
+	leaq	168(%rsp), %rax
+	leaq	152(%rsp), %rdx
+	movq	%rax, %xmm3
+	leaq	160(%rsp), %rax
+	movq	%rdx, %xmm4
+	movq	192(%rsp), %r12
+	movq	%rax, %xmm6
+	movq	144(%rsp), %rax
+	movhps	16(%rsp), %xmm3
+	movq	%rcx, 160(%rsp)
+	punpcklqdq	%xmm6, %xmm4
+	movq	176(%rsp), %rbx
+	movaps	%xmm3, 48(%rsp)
+	leaq	272(%rsp), %r15
+	movq	%rax, 152(%rsp)
+	movaps	%xmm4, 64(%rsp)
+	cmpq	$2, %r12
+	jbe	.L3100
+	.p2align 4,,10
+	.p2align 3
+.L3099:
+	movq	88(%rsp), %rax
+	subq	$1, %r12
+	xorl	%edx, %edx
+	movdqa	48(%rsp), %xmm1
+	movq	%r12, %rbp
+	shrq	%r12
+	movdqa	64(%rsp), %xmm2
+	movq	$0, 264(%rsp)
+	movq	%rax, 240(%rsp)
+	movq	80(%rsp), %rax
+	andl	$1, %ebp
+	movq	$0, 272(%rsp)
+	addq	%r12, %rbp
+	movq	%rax, 256(%rsp)
+	movq	40(%rsp), %rax
+	movq	$0, 280(%rsp)
+	movq	%r15, 40(%rsp)
+	movq	%rbx, 168(%rsp)
+	xorl	%ebx, %ebx
+	movq	%rax, 928(%rsp)
+	movq	%r15, %rax
+	movaps	%xmm1, 208(%rsp)
+	movaps	%xmm2, 224(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L3101:
+	leaq	1(%rdx), %rcx
+	leaq	(%rdx,%rdx,4), %rdx
+	salq	$4, %rdx
+	movq	%rcx, 8(%rax)
+	leaq	16(%rax,%rdx), %rsi
+	movq	(%rsp), %rax
+	movq	$0, 56(%rsi)
+	movq	%rax, (%rsi)
+	leaq	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_NS_6stringIcEENS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE0_EEvmOS8_EUlvE_EE(%rip), %rax
+	movq	%rax, 48(%rsi)
+	movq	8(%rsp), %rax
+	movq	%rbx, 8(%rsi)
+	movq	%rax, 64(%rsi)
+	lock addq	$1, 264(%rsp)
+	movq	256(%rsp), %rdi
+.LEHB117:
+	call	_ZN1n11thread_pool6__pushEPNS_11__task_nodeE
+	addq	$1, %rbx
+	cmpq	%rbx, %rbp
+	je	.L3106
+	movq	928(%rsp), %rax
+	movq	8(%rax), %rdx
+	cmpq	$8, %rdx
+	jne	.L3101
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	je	.L3226
+.L3102:
+	movq	%rax, 928(%rsp)
+	movq	8(%rax), %rdx
+	jmp	.L3101
+	.p2align 4,,10
+	.p2align 3
+.L3088:
+	addq	$1, %rbp
+	addq	$80, %rbx
+	cmpq	%rbp, %r14
+	jne	.L3091
+	jmp	.L3090
+	.p2align 4,,10
+	.p2align 3
+.L3106:
+	movq	32(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	_ZN1n10task_group4syncEv
+.LEHE117:
+	movq	%rbx, %rdi
+	movq	%r15, %rbx
+	call	_ZN1n10task_group4syncEv
+	.p2align 4,,10
+	.p2align 3
+.L3119:
+	movq	%rbx, %r14
+	xorl	%r12d, %r12d
+	movq	(%rbx), %rbx
+	movq	8(%r14), %r13
+	leaq	16(%r14), %rbp
+	testq	%r13, %r13
+	je	.L3114
+	.p2align 4,,10
+	.p2align 3
+.L3115:
+	movq	48(%rbp), %rax
+	testq	%rax, %rax
+	je	.L3112
+	addq	$1, %r12
+	movq	56(%rbp), %rsi
+	movq	%rbp, %rdi
+	addq	$80, %rbp
+	call	*16(%rax)
+	cmpq	%r13, %r12
+	jne	.L3115
+.L3114:
+	cmpq	%r15, %r14
+	je	.L3111
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3227
+.L3117:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %ecx
+	movl	$656, %edx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L3111:
+	testq	%rbx, %rbx
+	jne	.L3119
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r14
+	testq	%r14, %r14
+	je	.L3228
+.L3121:
+	movq	192(%rsp), %r12
+	movq	168(%rsp), %rax
+	testq	%r12, %r12
+	je	.L3126
+	xorl	%ebp, %ebp
+	xorl	%r13d, %r13d
+	jmp	.L3135
+	.p2align 4,,10
+	.p2align 3
+.L3127:
+	movq	(%r12), %rax
+	movq	%rax, (%rbx,%rbp,8)
+.L3134:
+	leaq	1(%rbp), %r12
+	movq	192(%rsp), %rax
+	leaq	(%r12,%r12), %rdx
+	cmpq	%rax, %rdx
+	jnb	.L3229
+	movq	168(%rsp), %rax
+	movq	%r12, %rbp
+.L3135:
+	movq	%rbp, %rdx
+	salq	$4, %rdx
+	leaq	(%rax,%rdx), %r12
+	cmpq	%r13, %rbp
+	jne	.L3127
+	leaq	5(%rbp), %rsi
+	movl	$8, %edx
+	movq	%r14, %rdi
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 24(%rsp)
+	movq	(%r14), %rax
+.LEHB118:
+	call	*16(%rax)
+.LEHE118:
+	movq	%rax, %rcx
+	movq	%rax, 16(%rsp)
+	movq	(%r12), %rax
+	leaq	0(,%rbp,8), %rdx
+	movq	%rax, (%rcx,%rbp,8)
+	testq	%rbp, %rbp
+	jne	.L3230
+	testq	%rbx, %rbx
+	je	.L3133
+.L3132:
+	movq	(%r14), %rax
+	movl	$8, %ecx
+	movq	%rbx, %rsi
+	movq	%r14, %rdi
+	leaq	0(,%r13,8), %rdx
+.LEHB119:
+	call	*24(%rax)
+.LEHE119:
+.L3133:
+	movq	24(%rsp), %r13
+	movq	16(%rsp), %rbx
+	jmp	.L3134
+	.p2align 4,,10
+	.p2align 3
+.L3112:
+	addq	$1, %r12
+	addq	$80, %rbp
+	cmpq	%r12, %r13
+	jne	.L3115
+	jmp	.L3114
+	.p2align 4,,10
+	.p2align 3
+.L3227:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3117
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3117
+	.p2align 4,,10
+	.p2align 3
+.L3229:
+	testb	$1, %al
+	je	.L3231
+.L3138:
+	movq	152(%rsp), %rdx
+	movq	160(%rsp), %rcx
+	movq	%r12, 192(%rsp)
+	movq	176(%rsp), %rsi
+	movq	184(%rsp), %rax
+	movq	%rbx, 176(%rsp)
+	movq	200(%rsp), %rdi
+	movq	%r13, 184(%rsp)
+	movq	%r14, 200(%rsp)
+	movq	%rcx, 152(%rsp)
+	movq	%rdx, 160(%rsp)
+	testq	%rsi, %rsi
+	je	.L3144
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	movl	$8, %ecx
+	call	*24(%rax)
+	movq	192(%rsp), %r12
+	cmpq	$2, %r12
+	jbe	.L3232
+	movq	176(%rsp), %rbx
+	jmp	.L3099
+.L3230:
+	movq	%rcx, %rdi
+	movq	%rbx, %rsi
+	call	memcpy@PLT
+	jmp	.L3132
+.L3226:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3233
+.L3104:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %edx
+	movl	$656, %esi
+	movq	(%rdi), %rax
+.LEHB120:
+	call	*16(%rax)
+.LEHE120:
+	movq	%rax, %rdx
+	movl	$82, %ecx
+	xorl	%eax, %eax
+	movq	%rdx, %rdi
+	rep stosq
+	movq	928(%rsp), %rax
+	movq	%rdx, (%rax)
+	movq	928(%rsp), %rax
+	movq	(%rax), %rax
+	jmp	.L3102
+.L3144:
+	cmpq	$2, %r12
+	ja	.L3099
+	cmpq	$0, 104(%rsp)
+	movq	144(%rsp), %rdi
+	je	.L3100
+.L3238:
+	cmpq	%rdi, %rcx
+	jne	.L3234
+.L3100:
+	movq	112(%rsp), %rdi
+	movq	120(%rsp), %rdx
+	movl	$8, %ecx
+	movq	128(%rsp), %rsi
+	movq	(%rdi), %rax
+.LEHB121:
+	call	*24(%rax)
+.LEHE121:
+	movq	176(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L3062
+	movq	184(%rsp), %rax
+	movq	200(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L3062:
+	addq	$952, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L3231:
+	.cfi_restore_state
+	movq	168(%rsp), %rdx
+	leaq	-8(%rdx,%rax,8), %rax
+	movq	%rax, 96(%rsp)
+	cmpq	%r12, %r13
+	je	.L3235
+	movq	(%rax), %rax
+	movq	%rax, (%rbx,%r12,8)
+.L3143:
+	addq	$1, %r12
+	jmp	.L3138
+.L3228:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3236
+.L3124:
+	movq	_ZZN1n4heapEvE3res(%rip), %r14
+	jmp	.L3121
+.L3225:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3093
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3093
+.L3233:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3104
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3104
+.L3126:
+	subq	$8, %rax
+	movl	$80, %esi
+	movq	$10, 24(%rsp)
+	movq	%rax, 96(%rsp)
+.L3137:
+	movq	(%r14), %rax
+	movl	$8, %edx
+	movq	%r14, %rdi
+.LEHB122:
+	call	*16(%rax)
+.LEHE122:
+	movq	%rax, %rcx
+	movq	%rax, 16(%rsp)
+	movq	96(%rsp), %rax
+	leaq	0(,%r12,8), %rbp
+	movq	(%rax), %rax
+	movq	%rax, (%rcx,%r12,8)
+	testq	%r12, %r12
+	jne	.L3237
+	testq	%rbx, %rbx
+	je	.L3142
+.L3141:
+	movq	(%r14), %rax
+	movl	$8, %ecx
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movq	%r14, %rdi
+.LEHB123:
+	call	*24(%rax)
+.LEHE123:
+.L3142:
+	movq	24(%rsp), %r13
+	movq	16(%rsp), %rbx
+	jmp	.L3143
+.L3232:
+	cmpq	$0, 104(%rsp)
+	movq	152(%rsp), %rcx
+	movq	144(%rsp), %rdi
+	jne	.L3238
+	jmp	.L3100
+.L3223:
+	leaq	0(,%rcx,8), %rdx
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L3073
+.L3236:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3124
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3124
+.L3224:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3239
+.L3080:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %edx
+	movl	$656, %esi
+	leaq	256(%rsp), %rcx
+	movq	%rcx, 32(%rsp)
+	movq	(%rdi), %rax
+.LEHB124:
+	call	*16(%rax)
+.LEHE124:
+	movq	%rax, %rdx
+	movl	$82, %ecx
+	xorl	%eax, %eax
+	movq	%rdx, %rdi
+	rep stosq
+	movq	928(%rsp), %rax
+	movq	%rdx, (%rax)
+	movq	928(%rsp), %rax
+	movq	(%rax), %rax
+	jmp	.L3078
+.L3234:
+	movq	120(%rsp), %rdx
+	movq	%rcx, %rsi
+	call	memcpy@PLT
+	jmp	.L3100
+.L3237:
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movq	%rcx, %rdi
+	call	memcpy@PLT
+	jmp	.L3141
+.L3222:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3240
+.L3069:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	192(%rsp), %rcx
+	movq	184(%rsp), %r13
+	movq	176(%rsp), %r14
+	jmp	.L3067
+.L3239:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r14
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3080
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r14, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3080
+.L3221:
+	movq	104(%rsp), %rax
+	cmpq	$1, %rax
+	jbe	.L3062
+	xorl	%edx, %edx
+.L3065:
+	shrq	%rax
+	addl	$1, %edx
+	cmpq	$1, %rax
+	jne	.L3065
+	movq	104(%rsp), %rax
+	movl	$1, %ecx
+	leaq	(%rax,%rax,2), %rsi
+	salq	$4, %rsi
+	addq	%rdi, %rsi
+.LEHB125:
+	call	_ZN1n9__pdqsortINS_6stringIcEENS_4lessEEEvPT_S5_RT0_ib.isra.0
+.LEHE125:
+	jmp	.L3062
+.L3240:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3069
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3069
+.L3235:
+	addq	$6, %rbp
+	leaq	0(%rbp,%rbp), %rax
+	movq	%rbp, %rsi
+	movq	%rax, 24(%rsp)
+	salq	$4, %rsi
+	jmp	.L3137
+.L3154:
+	movq	%rax, %rbx
+	jmp	.L3098
+.L3155:
+	movq	%rax, %rbp
+	jmp	.L3130
+.L3149:
+	movq	%rbx, 16(%rsp)
+.L3130:
+	cmpq	$0, 16(%rsp)
+	jne	.L3241
+.L3150:
+	movq	%rbp, %rbx
+.L3098:
+	movq	176(%rsp), %rsi
+	movq	184(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L3151
+	movq	200(%rsp), %rdi
+	salq	$3, %rdx
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L3151:
+	movq	%rbx, %rdi
+.LEHB126:
+	call	_Unwind_Resume@PLT
+.LEHE126:
+.L3241:
+	movq	24(%rsp), %rdx
+	movq	(%r14), %rax
+	movl	$8, %ecx
+	movq	%r14, %rdi
+	movq	16(%rsp), %rsi
+	salq	$3, %rdx
+	call	*24(%rax)
+	jmp	.L3150
+.L3157:
+.L3219:
+	movq	%rax, %rbx
+	jmp	.L3122
+.L3156:
+	jmp	.L3219
+.L3159:
+.L3220:
+	movq	%rax, %rbp
+	jmp	.L3149
+.L3158:
+	jmp	.L3220
+.L3122:
+	movq	32(%rsp), %rdi
+	call	_ZN1n10task_groupD1Ev
+	jmp	.L3098
+	.cfi_endproc
+.LFE7143:
+	.section	.gcc_except_table
+.LLSDA7143:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7143-.LLSDACSB7143
+.LLSDACSB7143:
+	.uleb128 .LEHB114-.LFB7143
+	.uleb128 .LEHE114-.LEHB114
+	.uleb128 .L3154-.LFB7143
+	.uleb128 0
+	.uleb128 .LEHB115-.LFB7143
+	.uleb128 .LEHE115-.LEHB115
+	.uleb128 .L3156-.LFB7143
+	.uleb128 0
+	.uleb128 .LEHB116-.LFB7143
+	.uleb128 .LEHE116-.LEHB116
+	.uleb128 .L3154-.LFB7143
+	.uleb128 0
+	.uleb128 .LEHB117-.LFB7143
+	.uleb128 .LEHE117-.LEHB117
+	.uleb128 .L3157-.LFB7143
+	.uleb128 0
+	.uleb128 .LEHB118-.LFB7143
+	.uleb128 .LEHE118-.LEHB118
+	.uleb128 .L3159-.LFB7143
+	.uleb128 0
+	.uleb128 .LEHB119-.LFB7143
+	.uleb128 .LEHE119-.LEHB119
+	.uleb128 .L3155-.LFB7143
+	.uleb128 0
+	.uleb128 .LEHB120-.LFB7143
+	.uleb128 .LEHE120-.LEHB120
+	.uleb128 .L3157-.LFB7143
+	.uleb128 0
+	.uleb128 .LEHB121-.LFB7143
+	.uleb128 .LEHE121-.LEHB121
+	.uleb128 .L3154-.LFB7143
+	.uleb128 0
+	.uleb128 .LEHB122-.LFB7143
+	.uleb128 .LEHE122-.LEHB122
+	.uleb128 .L3158-.LFB7143
+	.uleb128 0
+	.uleb128 .LEHB123-.LFB7143
+	.uleb128 .LEHE123-.LEHB123
+	.uleb128 .L3155-.LFB7143
+	.uleb128 0
+	.uleb128 .LEHB124-.LFB7143
+	.uleb128 .LEHE124-.LEHB124
+	.uleb128 .L3156-.LFB7143
+	.uleb128 0
+	.uleb128 .LEHB125-.LFB7143
+	.uleb128 .LEHE125-.LEHB125
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB126-.LFB7143
+	.uleb128 .LEHE126-.LEHB126
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE7143:
+	.section	.text._ZN1n4sortINS_11thread_poolENS_6stringIcEENS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceE,"axG",@progbits,_ZN1n4sortINS_11thread_poolENS_6stringIcEENS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceE,comdat
+	.size	_ZN1n4sortINS_11thread_poolENS_6stringIcEENS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceE, .-_ZN1n4sortINS_11thread_poolENS_6stringIcEENS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceE
+	.section	.rodata.str1.8
+	.align 8
+.LC46:
+	.string	"a key long enough to live on the heap "
+	.section	.rodata.str1.1
+.LC47:
+	.string	"expected true : sorted"
+	.section	.text.unlikely
+.LCOLDB48:
+	.text
+.LHOTB48:
+	.p2align 4
+	.globl	_Z26test_parallel_sort_stringsv
+	.type	_Z26test_parallel_sort_stringsv, @function
+_Z26test_parallel_sort_stringsv:
+.LFB6934:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6934
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$392, %rsp
+	.cfi_def_cfa_offset 448
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3551
+.L3244:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	pxor	%xmm0, %xmm0
+	movq	$0, 144(%rsp)
+	movups	%xmm0, 152(%rsp)
+	pxor	%xmm0, %xmm0
+	movq	%rax, 168(%rsp)
+	movq	$0, 208(%rsp)
+	movaps	%xmm0, 176(%rsp)
+	movaps	%xmm0, 192(%rsp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3552
+.L3247:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	152(%rsp), %rbx
+	pxor	%xmm0, %xmm0
+	pxor	%xmm1, %xmm1
+	movq	$0, 216(%rsp)
+	movq	%rax, 240(%rsp)
+	movq	$0, 296(%rsp)
+	movb	$0, 368(%rsp)
+	movaps	%xmm1, 224(%rsp)
+	movups	%xmm1, 248(%rsp)
+	movups	%xmm0, 264(%rsp)
+	movups	%xmm0, 280(%rsp)
+	movaps	%xmm0, 304(%rsp)
+	movaps	%xmm0, 320(%rsp)
+	movaps	%xmm0, 336(%rsp)
+	movaps	%xmm1, 352(%rsp)
+	cmpq	$1, %rbx
+	jbe	.L3553
+.L3249:
+	movq	$0, 72(%rsp)
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r14
+	movabsq	$-7046029254386353131, %rbp
+	movq	%rbp, %r15
+	jmp	.L3265
+	.p2align 4,,10
+	.p2align 3
+.L3253:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$64, %edx
+	movl	$192, %esi
+	movq	(%rdi), %rax
+.LEHB127:
+	call	*16(%rax)
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	movl	$24, %ecx
+	xorl	%eax, %eax
+	rep stosq
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3554
+.L3256:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$8, %edx
+	movl	$528, %esi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	leaq	16(%rax), %rdx
+	movq	$64, (%rax)
+	movq	%rdx, 8(%rax)
+	movq	%rax, 136(%rbx)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3555
+.L3259:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	160(%rsp), %rdx
+	pxor	%xmm5, %xmm5
+	movq	%rbp, 16(%rbx)
+	movq	152(%rsp), %r12
+	movq	144(%rsp), %r13
+	movq	$0, 144(%rbx)
+	movq	%rax, 168(%rbx)
+	leaq	144(%rsp), %rax
+	movq	%rax, 88(%rsp)
+	movq	%rax, (%rbx)
+	movq	72(%rsp), %rax
+	movups	%xmm5, 152(%rbx)
+	movq	%rax, 8(%rbx)
+	cmpq	%r12, %rdx
+	je	.L3556
+	movq	%rbx, 0(%r13,%rdx,8)
+.L3264:
+	addq	$1, %rdx
+	addq	%r15, %rbp
+	cmpq	$0, 72(%rsp)
+	movq	%rdx, 160(%rsp)
+	jne	.L3557
+	movq	$1, 72(%rsp)
+.L3265:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L3253
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3253
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r14, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3253
+	.p2align 4,,10
+	.p2align 3
+.L3555:
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3259
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r14, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3259
+	.p2align 4,,10
+	.p2align 3
+.L3554:
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3256
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r14, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3256
+	.p2align 4,,10
+	.p2align 3
+.L3556:
+	leaq	5(%r12), %rsi
+	movq	168(%rsp), %rdi
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 152(%rsp)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	160(%rsp), %rdx
+	movq	%rax, %rdi
+	movq	%rax, 144(%rsp)
+	movq	%rbx, (%rdi,%rdx,8)
+	leaq	0(,%rdx,8), %rax
+	testq	%rdx, %rdx
+	jne	.L3558
+	testq	%r13, %r13
+	je	.L3264
+.L3263:
+	movq	168(%rsp), %rdi
+	leaq	0(,%r12,8), %rdx
+	movl	$8, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE127:
+	movq	160(%rsp), %rdx
+	jmp	.L3264
+.L3557:
+	movq	144(%rsp), %rax
+	leaq	_ZN1n11thread_pool6__loopEPv(%rip), %rbx
+	xorl	%esi, %esi
+	movq	%rbx, %rdx
+	movq	(%rax), %rcx
+	leaq	24(%rcx), %rdi
+	call	pthread_create@PLT
+	movq	144(%rsp), %rax
+	movq	%rbx, %rdx
+	xorl	%esi, %esi
+	movq	8(%rax), %rcx
+	leaq	24(%rcx), %rdi
+	call	pthread_create@PLT
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbp
+	testq	%rbp, %rbp
+	je	.L3266
+	movq	%rbp, 64(%rsp)
+.L3267:
+	movq	$0, 24(%rsp)
+	leaq	120(%rsp), %rax
+	movq	$0, 8(%rsp)
+	movq	$0, 40(%rsp)
+	movq	$0, 32(%rsp)
+	movq	%rax, 16(%rsp)
+	jmp	.L3353
+	.p2align 4,,10
+	.p2align 3
+.L3297:
+	movq	32(%rsp), %rax
+	movq	24(%rsp), %rcx
+	movdqa	.LC4(%rip), %xmm3
+	leaq	(%rax,%rcx), %rbx
+	movups	%xmm3, (%rbx)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L3559
+	movq	104(%rsp), %r15
+	pxor	%xmm0, %xmm0
+	movq	%rax, 16(%rbx)
+	movq	$0, 40(%rbx)
+	movq	96(%rsp), %r12
+	movups	%xmm0, 24(%rbx)
+	cmpq	$23, %r15
+	je	.L3431
+	movq	120(%rsp), %r14
+	movq	%r12, %rdx
+	xorl	%edi, %edi
+.L3406:
+	leaq	24(%rbx), %rbp
+	cmpq	%rbp, %r14
+	jnb	.L3560
+	.p2align 4,,10
+	.p2align 3
+.L3337:
+	movl	$23, %r13d
+	cmpq	$23, %rdx
+	jbe	.L3348
+.L3402:
+	leaq	10(%r13,%r13), %r13
+	movq	(%rax), %rcx
+	movq	%rax, %rdi
+	cmpq	%rdx, %r13
+	cmovb	%rdx, %r13
+	movl	$1, %edx
+	leaq	1(%r13), %rsi
+.LEHB128:
+	call	*16(%rcx)
+	movq	%rax, %rbp
+	movq	(%rbx), %rax
+	cmpq	$23, 8(%rbx)
+	leaq	24(%rbx), %rsi
+	leaq	1(%rax), %rdx
+	je	.L3341
+	movq	24(%rbx), %rsi
+.L3341:
+	movq	%rbp, %rdi
+	call	memcpy@PLT
+	movq	8(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L3342
+	movq	16(%rbx), %rdi
+	movq	24(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE128:
+.L3342:
+	movq	%rbp, 24(%rbx)
+	movq	(%rbx), %rdi
+	movq	%r13, 8(%rbx)
+	cmpq	$23, %r13
+	je	.L3561
+.L3348:
+	movq	%r12, %rdx
+	addq	%rbp, %rdi
+	movq	%r14, %rsi
+	call	memmove@PLT
+	addq	(%rbx), %r12
+	addq	$1, 8(%rsp)
+	movq	%r12, (%rbx)
+	movb	$0, 0(%rbp,%r12)
+	cmpq	$23, %r15
+	je	.L3562
+.L3327:
+	movq	112(%rsp), %rdi
+	movq	120(%rsp), %rsi
+	leaq	1(%r15), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	addq	$48, 24(%rsp)
+	cmpq	$20000, 8(%rsp)
+	je	.L3563
+.L3328:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbp
+.L3353:
+	movdqa	.LC4(%rip), %xmm2
+	movaps	%xmm2, 96(%rsp)
+	testq	%rbp, %rbp
+	je	.L3274
+	movq	%rbp, 112(%rsp)
+	pxor	%xmm0, %xmm0
+	movq	16(%rsp), %r15
+	xorl	%r13d, %r13d
+	movups	%xmm0, 120(%rsp)
+	movl	$38, %eax
+	movl	$23, %r14d
+	movq	$0, 136(%rsp)
+.L3275:
+	leaq	10(%r14,%r14), %r12
+	movl	$1, %edx
+	movq	%rbp, %rdi
+	cmpq	%rax, %r12
+	cmovb	%rax, %r12
+	movq	0(%rbp), %rax
+	leaq	1(%r12), %rsi
+.LEHB129:
+	call	*16(%rax)
+	leaq	1(%r13), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L3283
+	movq	0(%rbp), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%rbp, %rdi
+	call	*24(%rax)
+.LEHE129:
+.L3283:
+	movq	%rbx, 120(%rsp)
+	movq	%r12, 104(%rsp)
+.L3282:
+	leaq	.LC46(%rip), %rsi
+	cmpq	$23, %r12
+	je	.L3288
+.L3287:
+	leaq	(%rbx,%r13), %rdi
+	movl	$38, %edx
+	call	memmove@PLT
+	movq	96(%rsp), %rax
+	leaq	38(%rax), %rdx
+	movq	%rdx, 96(%rsp)
+	movb	$0, 38(%rbx,%rax)
+	movq	8(%rsp), %rax
+	movq	96(%rsp), %r12
+	movq	104(%rsp), %r13
+	movl	%eax, %ebx
+	imull	$7919, %eax, %eax
+	movq	%rax, %rbp
+	imulq	$1321528399, %rax, %rax
+	shrq	$35, %rax
+	imull	$26, %eax, %eax
+	subl	%eax, %ebp
+	addl	$97, %ebp
+	cmpq	%r13, %r12
+	je	.L3564
+.L3289:
+	movq	16(%rsp), %rax
+	cmpq	$23, %r13
+	je	.L3292
+	movq	120(%rsp), %rax
+.L3292:
+	movb	%bpl, (%rax,%r12)
+	movq	96(%rsp), %rdx
+	leaq	1(%rdx), %rcx
+	movq	%rcx, 96(%rsp)
+	movb	$0, 1(%rax,%rdx)
+	imull	$104729, %ebx, %eax
+	movq	96(%rsp), %rbp
+	movq	104(%rsp), %r12
+	movq	%rax, %rbx
+	imulq	$1321528399, %rax, %rax
+	shrq	$35, %rax
+	imull	$26, %eax, %eax
+	subl	%eax, %ebx
+	addl	$97, %ebx
+	cmpq	%r12, %rbp
+	je	.L3565
+.L3293:
+	movq	16(%rsp), %rax
+	cmpq	$23, %r12
+	je	.L3296
+	movq	120(%rsp), %rax
+.L3296:
+	movb	%bl, (%rax,%rbp)
+	movq	96(%rsp), %rdx
+	leaq	1(%rdx), %rcx
+	movq	%rcx, 96(%rsp)
+	movq	40(%rsp), %rcx
+	movb	$0, 1(%rax,%rdx)
+	cmpq	%rcx, 8(%rsp)
+	jne	.L3297
+	movq	8(%rsp), %rax
+	movq	64(%rsp), %rdi
+	movl	$8, %edx
+	leaq	5(%rax), %rsi
+	leaq	(%rsi,%rsi), %rax
+	addq	%rax, %rsi
+	movq	%rax, 56(%rsp)
+	movq	(%rdi), %rax
+	salq	$5, %rsi
+.LEHB130:
+	call	*16(%rax)
+.LEHE130:
+	movq	24(%rsp), %rcx
+	movdqa	.LC4(%rip), %xmm4
+	movq	%rax, 48(%rsp)
+	leaq	(%rax,%rcx), %rbx
+	movups	%xmm4, (%rbx)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L3566
+	movq	104(%rsp), %r15
+	pxor	%xmm0, %xmm0
+	movq	%rax, 16(%rbx)
+	movq	$0, 40(%rbx)
+	movq	96(%rsp), %r14
+	movups	%xmm0, 24(%rbx)
+	cmpq	$23, %r15
+	je	.L3430
+	movq	120(%rsp), %r13
+	movq	%r14, %rdx
+	xorl	%edi, %edi
+.L3405:
+	leaq	24(%rbx), %rbp
+	cmpq	%rbp, %r13
+	jnb	.L3567
+	.p2align 4,,10
+	.p2align 3
+.L3307:
+	movl	$23, %r12d
+	cmpq	$23, %rdx
+	jbe	.L3323
+.L3400:
+	leaq	10(%r12,%r12), %r12
+	movq	(%rax), %rcx
+	movq	%rax, %rdi
+	cmpq	%rdx, %r12
+	cmovb	%rdx, %r12
+	movl	$1, %edx
+	leaq	1(%r12), %rsi
+.LEHB131:
+	call	*16(%rcx)
+.LEHE131:
+	movq	%rax, %rbp
+	movq	(%rbx), %rax
+	cmpq	$23, 8(%rbx)
+	leaq	1(%rax), %rdx
+	je	.L3568
+	movq	24(%rbx), %rsi
+.L3313:
+	movq	%rbp, %rdi
+	call	memcpy@PLT
+	movq	8(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L3314
+	movq	16(%rbx), %rdi
+	movq	24(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB132:
+	call	*24(%rax)
+.LEHE132:
+.L3314:
+	movq	%rbp, 24(%rbx)
+	movq	(%rbx), %rdi
+	movq	%r12, 8(%rbx)
+	cmpq	$23, %r12
+	je	.L3569
+.L3323:
+	addq	%rbp, %rdi
+	movq	%r14, %rdx
+	movq	%r13, %rsi
+	call	memmove@PLT
+	movq	(%rbx), %rax
+	addq	%r14, %rax
+	cmpq	$0, 8(%rsp)
+	movq	%rax, (%rbx)
+	movb	$0, 0(%rbp,%rax)
+	jne	.L3570
+	cmpq	$0, 32(%rsp)
+	je	.L3571
+.L3326:
+	movq	40(%rsp), %rax
+	movq	64(%rsp), %rdi
+	movl	$8, %ecx
+	movq	32(%rsp), %rsi
+	leaq	(%rax,%rax,2), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+.LEHB133:
+	call	*24(%rax)
+.LEHE133:
+	movq	56(%rsp), %rax
+	addq	$1, 8(%rsp)
+	movq	%rax, 40(%rsp)
+	movq	48(%rsp), %rax
+	movq	%rax, 32(%rsp)
+	cmpq	$23, %r15
+	jne	.L3327
+.L3562:
+	addq	$48, 24(%rsp)
+	cmpq	$20000, 8(%rsp)
+	jne	.L3328
+	movq	64(%rsp), %rcx
+	movq	32(%rsp), %rsi
+	movl	$20000, %edx
+	movq	88(%rsp), %rdi
+.LEHB134:
+	call	_ZN1n4sortINS_11thread_poolENS_6stringIcEENS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceE
+.LEHE134:
+	jmp	.L3354
+	.p2align 4,,10
+	.p2align 3
+.L3286:
+	movq	16(%rsp), %rax
+	addq	%rax, %rsi
+.L3288:
+	movq	16(%rsp), %rbx
+	jmp	.L3287
+	.p2align 4,,10
+	.p2align 3
+.L3564:
+	leaq	1(%r12), %r14
+	cmpq	%r14, %r12
+	jnb	.L3289
+	leaq	10(%r12,%r12), %rax
+	movq	112(%rsp), %r15
+	movl	$1, %edx
+	cmpq	%r14, %rax
+	cmovb	%r14, %rax
+	movq	%r15, %rdi
+	movq	%rax, 56(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+.LEHB135:
+	call	*16(%rax)
+.LEHE135:
+	movq	%rax, 48(%rsp)
+	cmpq	$23, %r13
+	je	.L3290
+	movq	120(%rsp), %rsi
+	movq	%r14, %rdx
+	movq	%rax, %rdi
+	movq	%rsi, 80(%rsp)
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	movq	80(%rsp), %rsi
+	movq	%r15, %rdi
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+.LEHB136:
+	call	*24(%rax)
+.LEHE136:
+.L3291:
+	movq	48(%rsp), %rax
+	movq	%rax, 120(%rsp)
+	movq	56(%rsp), %rax
+	movq	%rax, 104(%rsp)
+	movq	%rax, %r13
+	jmp	.L3289
+	.p2align 4,,10
+	.p2align 3
+.L3565:
+	leaq	1(%rbp), %r13
+	cmpq	%r13, %rbp
+	jnb	.L3293
+	leaq	10(%rbp,%rbp), %rax
+	movq	112(%rsp), %r15
+	movl	$1, %edx
+	cmpq	%r13, %rax
+	cmovb	%r13, %rax
+	movq	%r15, %rdi
+	movq	%rax, %r14
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+.LEHB137:
+	call	*16(%rax)
+.LEHE137:
+	movq	%rax, 48(%rsp)
+	cmpq	$23, %r12
+	je	.L3294
+	movq	120(%rsp), %rsi
+	movq	%r13, %rdx
+	movq	%rax, %rdi
+	movq	%rsi, 56(%rsp)
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	movq	56(%rsp), %rsi
+	movq	%r15, %rdi
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+.LEHB138:
+	call	*24(%rax)
+.LEHE138:
+.L3295:
+	movq	48(%rsp), %rax
+	movq	%r14, 104(%rsp)
+	movq	%r14, %r12
+	movq	%rax, 120(%rsp)
+	jmp	.L3293
+	.p2align 4,,10
+	.p2align 3
+.L3431:
+	movq	16(%rsp), %r14
+	leaq	24(%rbx), %rbp
+	movq	%r12, %rdx
+	xorl	%edi, %edi
+	cmpq	%rbp, %r14
+	jb	.L3337
+.L3560:
+	leaq	0(%rbp,%rdi), %rcx
+	movl	$23, %r13d
+	cmpq	%rcx, %r14
+	jb	.L3338
+	.p2align 4,,10
+	.p2align 3
+.L3576:
+	cmpq	%rdx, %r13
+	jb	.L3402
+	xorl	%ebp, %ebp
+	cmpq	$23, %r13
+	jne	.L3348
+.L3561:
+	leaq	24(%rbx), %rbp
+	jmp	.L3348
+	.p2align 4,,10
+	.p2align 3
+.L3274:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3572
+.L3278:
+	movq	_ZZN1n4heapEvE3res(%rip), %rbp
+	movq	96(%rsp), %r13
+	pxor	%xmm0, %xmm0
+	xorl	%r15d, %r15d
+	movq	104(%rsp), %r12
+	movups	%xmm0, 120(%rsp)
+	movq	%rbp, 112(%rsp)
+	leaq	38(%r13), %rax
+	movq	$0, 136(%rsp)
+	cmpq	$23, %r12
+	je	.L3573
+.L3280:
+	leaq	(%r15,%r13), %rdx
+	leaq	.LC46(%rip), %rcx
+	cmpq	%rdx, %rcx
+	jnb	.L3574
+	leaq	.LC46(%rip), %rcx
+	subq	%r15, %rcx
+	movq	%rcx, 48(%rsp)
+	cmpq	%rax, %r12
+	jnb	.L3413
+	leaq	10(%r12,%r12), %rdx
+	movq	%rbp, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, %r14
+	leaq	1(%rax), %rsi
+	movq	0(%rbp), %rax
+.LEHB139:
+	call	*16(%rax)
+	leaq	1(%r13), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r12
+	je	.L3285
+	movq	0(%rbp), %rax
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%rbp, %rdi
+	call	*24(%rax)
+.L3285:
+	movq	%rbx, 120(%rsp)
+	movq	%r14, %r12
+	movq	%r14, 104(%rsp)
+.L3284:
+	movq	48(%rsp), %rsi
+	cmpq	$23, %r12
+	je	.L3286
+	addq	%rbx, %rsi
+	jmp	.L3287
+	.p2align 4,,10
+	.p2align 3
+.L3574:
+	xorl	%ebx, %ebx
+	cmpq	%rax, %r12
+	jnb	.L3282
+	movq	%r12, %r14
+	jmp	.L3275
+	.p2align 4,,10
+	.p2align 3
+.L3559:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3575
+.L3333:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	pxor	%xmm0, %xmm0
+	movq	8(%rbx), %r13
+	movq	$0, 40(%rbx)
+	movq	104(%rsp), %r15
+	movq	(%rbx), %rdi
+	movups	%xmm0, 24(%rbx)
+	movq	96(%rsp), %r12
+	movq	16(%rsp), %r14
+	movq	%rax, 16(%rbx)
+	cmpq	$23, %r15
+	je	.L3335
+	movq	120(%rsp), %r14
+.L3335:
+	leaq	(%r12,%rdi), %rdx
+	xorl	%ebp, %ebp
+	cmpq	$23, %r13
+	je	.L3406
+	leaq	0(%rbp,%rdi), %rcx
+	cmpq	%rcx, %r14
+	jnb	.L3576
+.L3338:
+	subq	%rbp, %r14
+	cmpq	%rdx, %r13
+	jnb	.L3426
+	leaq	10(%r13,%r13), %r13
+	movq	(%rax), %rcx
+	movq	%rax, %rdi
+	cmpq	%rdx, %r13
+	cmovb	%rdx, %r13
+	movl	$1, %edx
+	leaq	1(%r13), %rsi
+	call	*16(%rcx)
+	movq	%rax, %rbp
+	movq	(%rbx), %rax
+	cmpq	$23, 8(%rbx)
+	leaq	24(%rbx), %rsi
+	leaq	1(%rax), %rdx
+	je	.L3345
+	movq	24(%rbx), %rsi
+.L3345:
+	movq	%rbp, %rdi
+	call	memcpy@PLT
+	movq	8(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L3346
+	movq	16(%rbx), %rdi
+	movq	24(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE139:
+.L3346:
+	movq	%rbp, 24(%rbx)
+	movq	(%rbx), %rdi
+	movq	%r13, 8(%rbx)
+.L3343:
+	cmpq	$23, %r13
+	jne	.L3549
+	leaq	24(%rbx), %rbp
+.L3549:
+	addq	%rbp, %r14
+	jmp	.L3348
+	.p2align 4,,10
+	.p2align 3
+.L3570:
+	movq	24(%rsp), %rdx
+	movq	32(%rsp), %rsi
+	movq	48(%rsp), %rdi
+	call	memcpy@PLT
+	jmp	.L3326
+	.p2align 4,,10
+	.p2align 3
+.L3430:
+	movq	16(%rsp), %r13
+	leaq	24(%rbx), %rbp
+	movq	%r14, %rdx
+	xorl	%edi, %edi
+	cmpq	%rbp, %r13
+	jb	.L3307
+.L3567:
+	leaq	0(%rbp,%rdi), %rcx
+	movl	$23, %r12d
+	cmpq	%rcx, %r13
+	jb	.L3308
+	.p2align 4,,10
+	.p2align 3
+.L3579:
+	cmpq	%rdx, %r12
+	jb	.L3400
+	xorl	%ebp, %ebp
+	cmpq	$23, %r12
+	jne	.L3323
+.L3569:
+	leaq	24(%rbx), %rbp
+	jmp	.L3323
+	.p2align 4,,10
+	.p2align 3
+.L3413:
+	xorl	%ebx, %ebx
+	jmp	.L3284
+	.p2align 4,,10
+	.p2align 3
+.L3571:
+	cmpq	$23, %r15
+	je	.L3577
+	movq	56(%rsp), %rax
+	movq	%rax, 40(%rsp)
+	movq	48(%rsp), %rax
+	movq	%rax, 32(%rsp)
+	movq	72(%rsp), %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L3327
+	.p2align 4,,10
+	.p2align 3
+.L3566:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3578
+.L3303:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	pxor	%xmm0, %xmm0
+	movq	104(%rsp), %r15
+	movq	$0, 40(%rbx)
+	movq	(%rbx), %rdi
+	movq	8(%rbx), %r12
+	movups	%xmm0, 24(%rbx)
+	movq	96(%rsp), %r14
+	movq	16(%rsp), %r13
+	movq	%rax, 16(%rbx)
+	cmpq	$23, %r15
+	je	.L3305
+	movq	120(%rsp), %r13
+.L3305:
+	leaq	(%r14,%rdi), %rdx
+	xorl	%ebp, %ebp
+	cmpq	$23, %r12
+	je	.L3405
+	leaq	0(%rbp,%rdi), %rcx
+	cmpq	%rcx, %r13
+	jnb	.L3579
+.L3308:
+	subq	%rbp, %r13
+	cmpq	%rdx, %r12
+	jnb	.L3420
+	leaq	10(%r12,%r12), %r12
+	movq	(%rax), %rcx
+	movq	%rax, %rdi
+	cmpq	%rdx, %r12
+	cmovb	%rdx, %r12
+	movl	$1, %edx
+	leaq	1(%r12), %rsi
+.LEHB140:
+	call	*16(%rcx)
+.LEHE140:
+	movq	%rax, %rbp
+	movq	(%rbx), %rax
+	cmpq	$23, 8(%rbx)
+	leaq	1(%rax), %rdx
+	je	.L3580
+	movq	24(%rbx), %rsi
+.L3319:
+	movq	%rbp, %rdi
+	call	memcpy@PLT
+	movq	8(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L3320
+	movq	16(%rbx), %rdi
+	movq	24(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB141:
+	call	*24(%rax)
+.LEHE141:
+.L3320:
+	movq	%rbp, 24(%rbx)
+	movq	(%rbx), %rdi
+	movq	%r12, 8(%rbx)
+.L3315:
+	cmpq	$23, %r12
+	jne	.L3548
+	leaq	24(%rbx), %rbp
+.L3548:
+	addq	%rbp, %r13
+	jmp	.L3323
+	.p2align 4,,10
+	.p2align 3
+.L3572:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3278
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3278
+	.p2align 4,,10
+	.p2align 3
+.L3568:
+	leaq	24(%rbx), %rsi
+	jmp	.L3313
+	.p2align 4,,10
+	.p2align 3
+.L3426:
+	xorl	%ebp, %ebp
+	jmp	.L3343
+	.p2align 4,,10
+	.p2align 3
+.L3294:
+	movq	16(%rsp), %rsi
+	movq	%rax, %rdi
+	movq	%r13, %rdx
+	call	memcpy@PLT
+	jmp	.L3295
+	.p2align 4,,10
+	.p2align 3
+.L3290:
+	movq	16(%rsp), %rsi
+	movq	%rax, %rdi
+	movq	%r14, %rdx
+	call	memcpy@PLT
+	jmp	.L3291
+	.p2align 4,,10
+	.p2align 3
+.L3575:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3333
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3333
+	.p2align 4,,10
+	.p2align 3
+.L3420:
+	xorl	%ebp, %ebp
+	jmp	.L3315
+	.p2align 4,,10
+	.p2align 3
+.L3577:
+	movq	56(%rsp), %rax
+	addq	$48, 24(%rsp)
+	movq	%rax, 40(%rsp)
+	movq	48(%rsp), %rax
+	movq	%rax, 32(%rsp)
+	movq	72(%rsp), %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L3328
+	.p2align 4,,10
+	.p2align 3
+.L3578:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3303
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3303
+	.p2align 4,,10
+	.p2align 3
+.L3580:
+	leaq	24(%rbx), %rsi
+	jmp	.L3319
+.L3563:
+	movq	64(%rsp), %rcx
+	movq	32(%rsp), %rsi
+	movl	$20000, %edx
+	movq	88(%rsp), %rdi
+.LEHB142:
+	call	_ZN1n4sortINS_11thread_poolENS_6stringIcEENS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceE
+.LEHE142:
+.L3354:
+	movq	32(%rsp), %rax
+	movq	72(%rsp), %rbp
+	leaq	72(%rax), %rbx
+	movl	$1, %eax
+	jmp	.L3364
+	.p2align 4,,10
+	.p2align 3
+.L3582:
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L3362
+	notl	%eax
+	shrl	$31, %eax
+	.p2align 4,,10
+	.p2align 3
+.L3358:
+	addq	$1, %rbp
+	addq	$48, %rbx
+	cmpq	$20000, %rbp
+	je	.L3581
+.L3364:
+	testb	%al, %al
+	je	.L3358
+	cmpq	$23, -64(%rbx)
+	movq	-72(%rbx), %r12
+	movq	%rbx, %rdi
+	leaq	-48(%rbx), %rsi
+	je	.L3360
+	movq	-48(%rbx), %rsi
+.L3360:
+	cmpq	$23, -16(%rbx)
+	movq	-24(%rbx), %r13
+	je	.L3361
+	movq	(%rbx), %rdi
+.L3361:
+	cmpq	%r13, %r12
+	movq	%r13, %rdx
+	cmovbe	%r12, %rdx
+	testq	%rdx, %rdx
+	jne	.L3582
+.L3362:
+	cmpq	%r12, %r13
+	setnb	%al
+	jmp	.L3358
+.L3581:
+	testb	%al, %al
+	je	.L3583
+	movq	32(%rsp), %rbx
+	xorl	%ebp, %ebp
+	.p2align 4,,10
+	.p2align 3
+.L3373:
+	movq	8(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L3370
+	movq	16(%rbx), %rdi
+	addq	$1, %rbp
+	movq	24(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	addq	$48, %rbx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	$20000, %rbp
+	jne	.L3373
+.L3372:
+	cmpq	$0, 32(%rsp)
+	je	.L3368
+	movq	40(%rsp), %rax
+	movq	64(%rsp), %rdi
+	movl	$8, %ecx
+	movq	32(%rsp), %rsi
+	leaq	(%rax,%rax,2), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+	call	*24(%rax)
+.L3368:
+	leaq	264(%rsp), %r14
+	movq	%r14, %rdi
+	call	pthread_mutex_lock@PLT
+	movb	$1, 368(%rsp)
+	lock addq	$1, 352(%rsp)
+	xorl	%ebx, %ebx
+	leaq	304(%rsp), %r15
+	movq	%r15, %rdi
+	call	pthread_cond_broadcast@PLT
+	movq	%r14, %rdi
+	call	pthread_mutex_unlock@PLT
+	cmpq	$0, 160(%rsp)
+	je	.L3377
+	.p2align 4,,10
+	.p2align 3
+.L3374:
+	movq	144(%rsp), %rax
+	xorl	%esi, %esi
+	movq	(%rax,%rbx,8), %rax
+	addq	$1, %rbx
+	movq	24(%rax), %rdi
+	call	pthread_join@PLT
+	movq	160(%rsp), %rax
+	cmpq	%rax, %rbx
+	jb	.L3374
+	testq	%rax, %rax
+	je	.L3377
+	movq	%r15, 8(%rsp)
+	xorl	%ebp, %ebp
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %r13
+	movq	%r14, 16(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L3391:
+	movq	144(%rsp), %rax
+	movq	(%rax,%rbp,8), %r14
+	movq	136(%r14), %r12
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3584
+.L3379:
+	movq	(%r12), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%r12, %rsi
+	movl	$8, %ecx
+	xorl	%r12d, %r12d
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	$0, 160(%r14)
+	jne	.L3381
+	jmp	.L3387
+	.p2align 4,,10
+	.p2align 3
+.L3385:
+	movq	(%r15), %rax
+	movl	$8, %ecx
+	movq	%r15, %rsi
+	addq	$1, %r12
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	160(%r14), %r12
+	jnb	.L3387
+.L3381:
+	movq	144(%r14), %rax
+	movq	(%rax,%r12,8), %r15
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L3385
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3385
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%r13, _ZZN1n4heapEvE7storage(%rip)
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3385
+	.p2align 4,,10
+	.p2align 3
+.L3387:
+	movq	144(%r14), %rsi
+	testq	%rsi, %rsi
+	je	.L3383
+	movq	152(%r14), %rax
+	movq	168(%r14), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L3383:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3585
+.L3389:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$64, %ecx
+	movl	$192, %edx
+	movq	%r14, %rsi
+	addq	$1, %rbp
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	160(%rsp), %rbp
+	jb	.L3391
+	movq	8(%rsp), %r15
+	movq	16(%rsp), %r14
+.L3377:
+	movq	%r15, %rdi
+	call	pthread_cond_destroy@PLT
+	movq	%r14, %rdi
+	call	pthread_mutex_destroy@PLT
+	leaq	176(%rsp), %rdi
+	call	pthread_mutex_destroy@PLT
+	movq	216(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L3376
+	movq	224(%rsp), %rax
+	movq	240(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L3376:
+	movq	144(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L3242
+	movq	152(%rsp), %rax
+	movq	168(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L3242:
+	addq	$392, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L3370:
+	.cfi_restore_state
+	addq	$1, %rbp
+	addq	$48, %rbx
+	cmpq	$20000, %rbp
+	jne	.L3373
+	jmp	.L3372
+	.p2align 4,,10
+	.p2align 3
+.L3585:
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3389
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3389
+	.p2align 4,,10
+	.p2align 3
+.L3584:
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3379
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3379
+.L3558:
+	movq	%rax, %rdx
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L3263
+.L3553:
+	movq	168(%rsp), %rdi
+	movl	$8, %edx
+	movl	$16, %esi
+	movq	144(%rsp), %rbp
+	movq	(%rdi), %rax
+.LEHB143:
+	call	*16(%rax)
+	movq	%rax, 144(%rsp)
+	movq	%rax, %rdi
+	movq	160(%rsp), %rax
+	movq	$2, 152(%rsp)
+	testq	%rax, %rax
+	jne	.L3586
+	testq	%rbp, %rbp
+	je	.L3249
+.L3251:
+	movq	168(%rsp), %rdi
+	leaq	0(,%rbx,8), %rdx
+	movl	$8, %ecx
+	movq	%rbp, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE143:
+	jmp	.L3249
+.L3552:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3247
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3247
+.L3551:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3244
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3244
+.L3266:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3587
+.L3272:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	%rax, 64(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbp
+	jmp	.L3267
+.L3586:
+	leaq	0(,%rax,8), %rdx
+	movq	%rbp, %rsi
+	call	memcpy@PLT
+	jmp	.L3251
+.L3587:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3272
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3272
+.L3573:
+	leaq	120(%rsp), %rbx
+	leaq	.LC46(%rip), %rcx
+	cmpq	%rbx, %rcx
+	jnb	.L3588
+	cmpq	$23, %rax
+	ja	.L3589
+	leaq	.LC46(%rip), %rsi
+	jmp	.L3287
+.L3588:
+	movq	%rbx, %r15
+	jmp	.L3280
+.L3589:
+	movl	$23, %r14d
+	movq	%rbx, %r15
+	jmp	.L3275
+.L3440:
+	movq	%rax, %rbx
+	jmp	.L3393
+.L3436:
+	movq	%rax, %rbx
+	jmp	.L3393
+.L3441:
+	movq	%rax, %rbx
+	jmp	.L3393
+.L3435:
+	movq	%rax, %rbx
+	jmp	.L3403
+.L3439:
+	movq	%rax, %rbx
+	jmp	.L3393
+.L3583:
+	jmp	.L3540
+.L3437:
+	movq	%rax, %rbx
+	jmp	.L3393
+.L3434:
+	movq	%rax, %rbx
+	jmp	.L3268
+.L3432:
+	movq	%rax, %rbx
+	jmp	.L3300
+.L3433:
+	movq	%rax, %rbx
+	jmp	.L3550
+.L3438:
+	movq	%rax, %rbx
+	jmp	.L3299
+.L3442:
+	movq	%rax, %rbx
+	jmp	.L3550
+	.section	.gcc_except_table
+.LLSDA6934:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6934-.LLSDACSB6934
+.LLSDACSB6934:
+	.uleb128 .LEHB127-.LFB6934
+	.uleb128 .LEHE127-.LEHB127
+	.uleb128 .L3434-.LFB6934
+	.uleb128 0
+	.uleb128 .LEHB128-.LFB6934
+	.uleb128 .LEHE128-.LEHB128
+	.uleb128 .L3432-.LFB6934
+	.uleb128 0
+	.uleb128 .LEHB129-.LFB6934
+	.uleb128 .LEHE129-.LEHB129
+	.uleb128 .L3432-.LFB6934
+	.uleb128 0
+	.uleb128 .LEHB130-.LFB6934
+	.uleb128 .LEHE130-.LEHB130
+	.uleb128 .L3438-.LFB6934
+	.uleb128 0
+	.uleb128 .LEHB131-.LFB6934
+	.uleb128 .LEHE131-.LEHB131
+	.uleb128 .L3441-.LFB6934
+	.uleb128 0
+	.uleb128 .LEHB132-.LFB6934
+	.uleb128 .LEHE132-.LEHB132
+	.uleb128 .L3436-.LFB6934
+	.uleb128 0
+	.uleb128 .LEHB133-.LFB6934
+	.uleb128 .LEHE133-.LEHB133
+	.uleb128 .L3440-.LFB6934
+	.uleb128 0
+	.uleb128 .LEHB134-.LFB6934
+	.uleb128 .LEHE134-.LEHB134
+	.uleb128 .L3433-.LFB6934
+	.uleb128 0
+	.uleb128 .LEHB135-.LFB6934
+	.uleb128 .LEHE135-.LEHB135
+	.uleb128 .L3432-.LFB6934
+	.uleb128 0
+	.uleb128 .LEHB136-.LFB6934
+	.uleb128 .LEHE136-.LEHB136
+	.uleb128 .L3435-.LFB6934
+	.uleb128 0
+	.uleb128 .LEHB137-.LFB6934
+	.uleb128 .LEHE137-.LEHB137
+	.uleb128 .L3432-.LFB6934
+	.uleb128 0
+	.uleb128 .LEHB138-.LFB6934
+	.uleb128 .LEHE138-.LEHB138
+	.uleb128 .L3435-.LFB6934
+	.uleb128 0
+	.uleb128 .LEHB139-.LFB6934
+	.uleb128 .LEHE139-.LEHB139
+	.uleb128 .L3432-.LFB6934
+	.uleb128 0
+	.uleb128 .LEHB140-.LFB6934
+	.uleb128 .LEHE140-.LEHB140
+	.uleb128 .L3439-.LFB6934
+	.uleb128 0
+	.uleb128 .LEHB141-.LFB6934
+	.uleb128 .LEHE141-.LEHB141
+	.uleb128 .L3437-.LFB6934
+	.uleb128 0
+	.uleb128 .LEHB142-.LFB6934
+	.uleb128 .LEHE142-.LEHB142
+	.uleb128 .L3442-.LFB6934
+	.uleb128 0
+	.uleb128 .LEHB143-.LFB6934
+	.uleb128 .LEHE143-.LEHB143
+	.uleb128 .L3434-.LFB6934
+	.uleb128 0
+.LLSDACSE6934:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6934
+	.type	_Z26test_parallel_sort_stringsv.cold, @function
+_Z26test_parallel_sort_stringsv.cold:
+.LFSB6934:
+.L3393:
+	.cfi_def_cfa_offset 448
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	56(%rsp), %rax
+	movq	%rax, 40(%rsp)
+	movq	48(%rsp), %rax
+	movq	%rax, 32(%rsp)
+.L3300:
+	movq	104(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L3356
+.L3404:
+	movq	112(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	120(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L3356:
+	movq	32(%rsp), %rbp
+	xorl	%r12d, %r12d
+.L3395:
+	movq	8(%rsp), %rax
+	cmpq	%rax, %r12
+	je	.L3590
+	movq	8(%rbp), %rax
+	cmpq	$23, %rax
+	je	.L3396
+	movq	16(%rbp), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%rbp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L3396:
+	addq	$1, %r12
+	addq	$48, %rbp
+	jmp	.L3395
+.L3403:
+	movq	104(%rsp), %rax
+	jmp	.L3404
+.L3268:
+	movq	216(%rsp), %rsi
+	movq	224(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L3269
+	movq	240(%rsp), %rdi
+	salq	$3, %rdx
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L3269:
+	movq	144(%rsp), %rsi
+	movq	152(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L3270
+	movq	168(%rsp), %rdi
+	salq	$3, %rdx
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L3270:
+	movq	%rbx, %rdi
+.LEHB144:
+	call	_Unwind_Resume@PLT
+.LEHE144:
+.L3590:
+	cmpq	$0, 32(%rsp)
+	je	.L3398
+	movq	64(%rsp), %rdi
+	imulq	$48, 40(%rsp), %rdx
+	movl	$8, %ecx
+	movq	32(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L3398:
+	movq	88(%rsp), %rdi
+	call	_ZN1n11thread_poolD1Ev
+	movq	%rbx, %rdi
+.LEHB145:
+	call	_Unwind_Resume@PLT
+.LEHE145:
+.L3443:
+	movq	%rax, %rbx
+.L3550:
+	movq	$20000, 8(%rsp)
+	jmp	.L3356
+.L3299:
+	movq	56(%rsp), %rax
+	movq	%rax, 40(%rsp)
+	jmp	.L3300
+.L3540:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC47(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB146:
+	call	__cxa_throw@PLT
+.LEHE146:
+	.cfi_endproc
+.LFE6934:
+	.section	.gcc_except_table
+.LLSDAC6934:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6934-.LLSDACSBC6934
+.LLSDACSBC6934:
+	.uleb128 .LEHB144-.LCOLDB48
+	.uleb128 .LEHE144-.LEHB144
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB145-.LCOLDB48
+	.uleb128 .LEHE145-.LEHB145
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB146-.LCOLDB48
+	.uleb128 .LEHE146-.LEHB146
+	.uleb128 .L3443-.LCOLDB48
+	.uleb128 0
+.LLSDACSEC6934:
+	.section	.text.unlikely
+	.text
+	.size	_Z26test_parallel_sort_stringsv, .-_Z26test_parallel_sort_stringsv
+	.section	.text.unlikely
+	.size	_Z26test_parallel_sort_stringsv.cold, .-_Z26test_parallel_sort_stringsv.cold
+.LCOLDE48:
+	.text
+.LHOTE48:
+	.p2align 4
+	.type	_ZN1n4taskUlPvE26_4_FUNES1_, @function
+_ZN1n4taskUlPvE26_4_FUNES1_:
+.LFB7396:
+	.cfi_startproc
+	movq	(%rdi), %r8
+	movq	8(%rdi), %rdx
+	movq	(%r8), %rax
+	movq	(%rax), %rax
+	movq	(%rax,%rdx,8), %rsi
+	movq	8(%rax,%rdx,8), %rcx
+	subq	%rsi, %rcx
+	cmpq	$1, %rcx
+	jbe	.L3591
+	movq	%rcx, %rax
+	xorl	%edx, %edx
+	.p2align 4,,10
+	.p2align 3
+.L3593:
+	shrq	%rax
+	addl	$1, %edx
+	cmpq	$1, %rax
+	jne	.L3593
+	movq	8(%r8), %rax
+	leaq	(%rsi,%rsi,2), %rdi
+	leaq	(%rcx,%rcx,2), %rsi
+	movl	$1, %ecx
+	salq	$4, %rdi
+	salq	$4, %rsi
+	addq	(%rax), %rdi
+	addq	%rdi, %rsi
+	jmp	_ZN1n9__pdqsortINS_6stringIcEENS_4lessEEEvPT_S5_RT0_ib.isra.0
+	.p2align 4,,10
+	.p2align 3
+.L3591:
+	ret
+	.cfi_endproc
+.LFE7396:
+	.size	_ZN1n4taskUlPvE26_4_FUNES1_, .-_ZN1n4taskUlPvE26_4_FUNES1_
+	.weak	_ZTSN1n15memory_resourceE
+	.section	.rodata._ZTSN1n15memory_resourceE,"aG",@progbits,_ZTSN1n15memory_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n15memory_resourceE, @object
+	.size	_ZTSN1n15memory_resourceE, 22
+_ZTSN1n15memory_resourceE:
+	.string	"N1n15memory_resourceE"
+	.weak	_ZTIN1n15memory_resourceE
+	.section	.data.rel.ro._ZTIN1n15memory_resourceE,"awG",@progbits,_ZTIN1n15memory_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n15memory_resourceE, @object
+	.size	_ZTIN1n15memory_resourceE, 16
+_ZTIN1n15memory_resourceE:
+	.quad	_ZTVN10__cxxabiv117__class_type_infoE+16
+	.quad	_ZTSN1n15memory_resourceE
+	.weak	_ZTSN1n13heap_resourceE
+	.section	.rodata._ZTSN1n13heap_resourceE,"aG",@progbits,_ZTSN1n13heap_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n13heap_resourceE, @object
+	.size	_ZTSN1n13heap_resourceE, 20
+_ZTSN1n13heap_resourceE:
+	.string	"N1n13heap_resourceE"
+	.weak	_ZTIN1n13heap_resourceE
+	.section	.data.rel.ro._ZTIN1n13heap_resourceE,"awG",@progbits,_ZTIN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n13heap_resourceE, @object
+	.size	_ZTIN1n13heap_resourceE, 24
+_ZTIN1n13heap_resourceE:
+	.quad	_ZTVN10__cxxabiv120__si_class_type_infoE+16
+	.quad	_ZTSN1n13heap_resourceE
+	.quad	_ZTIN1n15memory_resourceE
+	.weak	_ZTVN1n13heap_resourceE
+	.section	.data.rel.ro.local._ZTVN1n13heap_resourceE,"awG",@progbits,_ZTVN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTVN1n13heap_resourceE, @object
+	.size	_ZTVN1n13heap_resourceE, 48
+_ZTVN1n13heap_resourceE:
+	.quad	0
+	.quad	_ZTIN1n13heap_resourceE
+	.quad	_ZN1n13heap_resourceD1Ev
+	.quad	_ZN1n13heap_resourceD0Ev
+	.quad	_ZN1n13heap_resource8allocateEmm
+	.quad	_ZN1n13heap_resource10deallocateEPvmm
+	.weak	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_NS_6stringIcEENS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE0_EEvmOS8_EUlvE_EE
+	.section	.data.rel.ro.local._ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_NS_6stringIcEENS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE0_EEvmOS8_EUlvE_EE,"awG",@progbits,_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_NS_6stringIcEENS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE0_EEvmOS8_EUlvE_EE,comdat
+	.align 16
+	.type	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_NS_6stringIcEENS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE0_EEvmOS8_EUlvE_EE, @gnu_unique_object
+	.size	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_NS_6stringIcEENS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE0_EEvmOS8_EUlvE_EE, 24
+_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_NS_6stringIcEENS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE0_EEvmOS8_EUlvE_EE:
+	.quad	_ZN1n4taskUlPvE29_4_FUNES1_
+	.quad	_ZN1n4taskUlPvS1_E30_4_FUNES1_S1_
+	.quad	_ZN1n4taskUlPvPNS_15memory_resourceEE31_4_FUNES1_S3_
+	.weak	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_NS_6stringIcEENS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE_EEvmOS8_EUlvE_EE
+	.section	.data.rel.ro.local._ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_NS_6stringIcEENS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE_EEvmOS8_EUlvE_EE,"awG",@progbits,_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_NS_6stringIcEENS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE_EEvmOS8_EUlvE_EE,comdat
+	.align 16
+	.type	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_NS_6stringIcEENS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE_EEvmOS8_EUlvE_EE, @gnu_unique_object
+	.size	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_NS_6stringIcEENS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE_EEvmOS8_EUlvE_EE, 24
+_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_NS_6stringIcEENS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE_EEvmOS8_EUlvE_EE:
+	.quad	_ZN1n4taskUlPvE26_4_FUNES1_
+	.quad	_ZN1n4taskUlPvS1_E27_4_FUNES1_S1_
+	.quad	_ZN1n4taskUlPvPNS_15memory_resourceEE28_4_FUNES1_S3_
+	.weak	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_iNS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE0_EEvmOS6_EUlvE_EE
+	.section	.data.rel.ro.local._ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_iNS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE0_EEvmOS6_EUlvE_EE,"awG",@progbits,_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_iNS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE0_EEvmOS6_EUlvE_EE,comdat
+	.align 16
+	.type	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_iNS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE0_EEvmOS6_EUlvE_EE, @gnu_unique_object
+	.size	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_iNS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE0_EEvmOS6_EUlvE_EE, 24
+_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_iNS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE0_EEvmOS6_EUlvE_EE:
+	.quad	_ZN1n4taskUlPvE23_4_FUNES1_
+	.quad	_ZN1n4taskUlPvS1_E24_4_FUNES1_S1_
+	.quad	_ZN1n4taskUlPvPNS_15memory_resourceEE25_4_FUNES1_S3_
+	.weak	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_iNS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE_EEvmOS6_EUlvE_EE
+	.section	.data.rel.ro.local._ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_iNS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE_EEvmOS6_EUlvE_EE,"awG",@progbits,_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_iNS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE_EEvmOS6_EUlvE_EE,comdat
+	.align 16
+	.type	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_iNS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE_EEvmOS6_EUlvE_EE, @gnu_unique_object
+	.size	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_iNS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE_EEvmOS6_EUlvE_EE, 24
+_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_4sortIS2_iNS_4lessEEEvRT_NS_5sliceIT0_EET1_RNS_15memory_resourceEEUlmE_EEvmOS6_EUlvE_EE:
+	.quad	_ZN1n4taskUlPvE20_4_FUNES1_
+	.quad	_ZN1n4taskUlPvS1_E21_4_FUNES1_S1_
+	.quad	_ZN1n4taskUlPvPNS_15memory_resourceEE22_4_FUNES1_S3_
+	.section	.data.rel.ro.local,"aw"
+	.align 16
+	.type	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_15__parallel_findIS2_ZNS_4findIS2_NS_5sliceIKiEEZ18test_parallel_findvEUliE_EEmRT_T0_OT1_EUlmmE_EEmSB_mOSC_EUlmE_EEvmOSA_EUlvE_EE, @object
+	.size	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_15__parallel_findIS2_ZNS_4findIS2_NS_5sliceIKiEEZ18test_parallel_findvEUliE_EEmRT_T0_OT1_EUlmmE_EEmSB_mOSC_EUlmE_EEvmOSA_EUlvE_EE, 24
+_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_15__parallel_findIS2_ZNS_4findIS2_NS_5sliceIKiEEZ18test_parallel_findvEUliE_EEmRT_T0_OT1_EUlmmE_EEmSB_mOSC_EUlmE_EEvmOSA_EUlvE_EE:
+	.quad	_ZN1n4taskUlPvE17_4_FUNES1_
+	.quad	_ZN1n4taskUlPvS1_E18_4_FUNES1_S1_
+	.quad	_ZN1n4taskUlPvPNS_15memory_resourceEE19_4_FUNES1_S3_
+	.weak	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_15__parallel_findIS2_ZNS_4findIS2_NS_5sliceIKiEEiEEmRT_T0_RKT1_EUlmmE_EEmSA_mOSB_EUlmE_EEvmOS9_EUlvE_EE
+	.section	.data.rel.ro.local._ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_15__parallel_findIS2_ZNS_4findIS2_NS_5sliceIKiEEiEEmRT_T0_RKT1_EUlmmE_EEmSA_mOSB_EUlmE_EEvmOS9_EUlvE_EE,"awG",@progbits,_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_15__parallel_findIS2_ZNS_4findIS2_NS_5sliceIKiEEiEEmRT_T0_RKT1_EUlmmE_EEmSA_mOSB_EUlmE_EEvmOS9_EUlvE_EE,comdat
+	.align 16
+	.type	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_15__parallel_findIS2_ZNS_4findIS2_NS_5sliceIKiEEiEEmRT_T0_RKT1_EUlmmE_EEmSA_mOSB_EUlmE_EEvmOS9_EUlvE_EE, @gnu_unique_object
+	.size	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_15__parallel_findIS2_ZNS_4findIS2_NS_5sliceIKiEEiEEmRT_T0_RKT1_EUlmmE_EEmSA_mOSB_EUlmE_EEvmOS9_EUlvE_EE, 24
+_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_15__parallel_findIS2_ZNS_4findIS2_NS_5sliceIKiEEiEEmRT_T0_RKT1_EUlmmE_EEmSA_mOSB_EUlmE_EEvmOS9_EUlvE_EE:
+	.quad	_ZN1n4taskUlPvE14_4_FUNES1_
+	.quad	_ZN1n4taskUlPvS1_E15_4_FUNES1_S1_
+	.quad	_ZN1n4taskUlPvPNS_15memory_resourceEE16_4_FUNES1_S3_
+	.section	.data.rel.ro.local
+	.align 16
+	.type	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_5countIS2_NS_5sliceIKiEEZ19test_parallel_countvEUliE_EEmRT_T0_OT1_EUlmE_EEvmOS9_EUlvE_EE, @object
+	.size	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_5countIS2_NS_5sliceIKiEEZ19test_parallel_countvEUliE_EEmRT_T0_OT1_EUlmE_EEvmOS9_EUlvE_EE, 24
+_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_5countIS2_NS_5sliceIKiEEZ19test_parallel_countvEUliE_EEmRT_T0_OT1_EUlmE_EEvmOS9_EUlvE_EE:
+	.quad	_ZN1n4taskUlPvE11_4_FUNES1_
+	.quad	_ZN1n4taskUlPvS1_E12_4_FUNES1_S1_
+	.quad	_ZN1n4taskUlPvPNS_15memory_resourceEE13_4_FUNES1_S3_
+	.weak	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_5countIS2_NS_5sliceIKiEEiEEmRT_T0_RKT1_EUlmE_EEvmOS8_EUlvE_EE
+	.section	.data.rel.ro.local._ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_5countIS2_NS_5sliceIKiEEiEEmRT_T0_RKT1_EUlmE_EEvmOS8_EUlvE_EE,"awG",@progbits,_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_5countIS2_NS_5sliceIKiEEiEEmRT_T0_RKT1_EUlmE_EEvmOS8_EUlvE_EE,comdat
+	.align 16
+	.type	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_5countIS2_NS_5sliceIKiEEiEEmRT_T0_RKT1_EUlmE_EEvmOS8_EUlvE_EE, @gnu_unique_object
+	.size	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_5countIS2_NS_5sliceIKiEEiEEmRT_T0_RKT1_EUlmE_EEvmOS8_EUlvE_EE, 24
+_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_5countIS2_NS_5sliceIKiEEiEEmRT_T0_RKT1_EUlmE_EEvmOS8_EUlvE_EE:
+	.quad	_ZN1n4taskUlPvE8_4_FUNES1_
+	.quad	_ZN1n4taskUlPvS1_E9_4_FUNES1_S1_
+	.quad	_ZN1n4taskUlPvPNS_15memory_resourceEE10_4_FUNES1_S3_
+	.section	.data.rel.ro.local
+	.align 16
+	.type	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_6reduceIS2_NS_5sliceIKiEExZ20test_parallel_reducevEUlxiE_EET1_RT_T0_S9_T2_EUlmE_EEvmOSA_EUlvE_EE, @object
+	.size	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_6reduceIS2_NS_5sliceIKiEExZ20test_parallel_reducevEUlxiE_EET1_RT_T0_S9_T2_EUlmE_EEvmOSA_EUlvE_EE, 24
+_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_6reduceIS2_NS_5sliceIKiEExZ20test_parallel_reducevEUlxiE_EET1_RT_T0_S9_T2_EUlmE_EEvmOSA_EUlvE_EE:
+	.quad	_ZN1n4taskUlPvE5_4_FUNES1_
+	.quad	_ZN1n4taskUlPvS1_E6_4_FUNES1_S1_
+	.quad	_ZN1n4taskUlPvPNS_15memory_resourceEE7_4_FUNES1_S3_
+	.align 16
+	.type	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_8for_eachIS2_NS_5sliceIKiEEZ22test_parallel_for_eachvEUliE_EEvRT_T0_OT1_EUlmE_EEvmOS9_EUlvE_EE, @object
+	.size	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_8for_eachIS2_NS_5sliceIKiEEZ22test_parallel_for_eachvEUliE_EEvRT_T0_OT1_EUlmE_EEvmOS9_EUlvE_EE, 24
+_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZNS_8for_eachIS2_NS_5sliceIKiEEZ22test_parallel_for_eachvEUliE_EEvRT_T0_OT1_EUlmE_EEvmOS9_EUlvE_EE:
+	.quad	_ZN1n4taskUlPvE2_4_FUNES1_
+	.quad	_ZN1n4taskUlPvS1_E3_4_FUNES1_S1_
+	.quad	_ZN1n4taskUlPvPNS_15memory_resourceEE4_4_FUNES1_S3_
+	.weak	_ZN1n16__current_workerE
+	.section	.tbss._ZN1n16__current_workerE,"awTG",@nobits,_ZN1n16__current_workerE,comdat
+	.align 8
+	.type	_ZN1n16__current_workerE, @gnu_unique_object
+	.size	_ZN1n16__current_workerE, 8
+_ZN1n16__current_workerE:
+	.zero	8
+	.weak	_ZN1n18__current_resourceE
+	.section	.tbss._ZN1n18__current_resourceE,"awTG",@nobits,_ZN1n18__current_resourceE,comdat
+	.align 8
+	.type	_ZN1n18__current_resourceE, @gnu_unique_object
+	.size	_ZN1n18__current_resourceE, 8
+_ZN1n18__current_resourceE:
+	.zero	8
+	.weak	_ZGVZN1n4heapEvE3res
+	.section	.bss._ZGVZN1n4heapEvE3res,"awG",@nobits,_ZGVZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZGVZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZGVZN1n4heapEvE3res, 8
+_ZGVZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE3res
+	.section	.bss._ZZN1n4heapEvE3res,"awG",@nobits,_ZZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZZN1n4heapEvE3res, 8
+_ZZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE7storage
+	.section	.bss._ZZN1n4heapEvE7storage,"awG",@nobits,_ZZN1n4heapEvE7storage,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE7storage, @gnu_unique_object
+	.size	_ZZN1n4heapEvE7storage, 8
+_ZZN1n4heapEvE7storage:
+	.zero	8
+	.weak	_ZGVZN1n9simd_bestEvE4best
+	.section	.bss._ZGVZN1n9simd_bestEvE4best,"awG",@nobits,_ZGVZN1n9simd_bestEvE4best,comdat
+	.align 8
+	.type	_ZGVZN1n9simd_bestEvE4best, @gnu_unique_object
+	.size	_ZGVZN1n9simd_bestEvE4best, 8
+_ZGVZN1n9simd_bestEvE4best:
+	.zero	8
+	.weak	_ZZN1n9simd_bestEvE4best
+	.section	.bss._ZZN1n9simd_bestEvE4best,"awG",@nobits,_ZZN1n9simd_bestEvE4best,comdat
+	.align 4
+	.type	_ZZN1n9simd_bestEvE4best, @gnu_unique_object
+	.size	_ZZN1n9simd_bestEvE4best, 4
+_ZZN1n9simd_bestEvE4best:
+	.zero	4
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC0:
+	.long	99
+	.long	99
+	.long	99
+	.long	99
+	.align 16
+.LC1:
+	.long	1
+	.long	1
+	.long	1
+	.long	1
+	.align 16
+.LC4:
+	.quad	0
+	.quad	23
+	.set	.LC7,.LC31+4
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC23:
+	.long	6
+	.long	100
+	.section	.rodata.cst16
+	.align 16
+.LC31:
+	.long	0
+	.long	10
+	.long	5000
+	.long	100001
+	.hidden	DW.ref._ZTIPKc
+	.weak	DW.ref._ZTIPKc
+	.section	.data.rel.local.DW.ref._ZTIPKc,"awG",@progbits,DW.ref._ZTIPKc,comdat
+	.align 8
+	.type	DW.ref._ZTIPKc, @object
+	.size	DW.ref._ZTIPKc, 8
+DW.ref._ZTIPKc:
+	.quad	_ZTIPKc
+	.hidden	DW.ref.__gxx_personality_v0
+	.weak	DW.ref.__gxx_personality_v0
+	.section	.data.rel.local.DW.ref.__gxx_personality_v0,"awG",@progbits,DW.ref.__gxx_personality_v0,comdat
+	.align 8
+	.type	DW.ref.__gxx_personality_v0, @object
+	.size	DW.ref.__gxx_personality_v0, 8
+DW.ref.__gxx_personality_v0:
+	.quad	__gxx_personality_v0
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,7653 @@
+	.file	"tests-pool.cpp"
+	.text
+	.p2align 4
+	.type	_ZN1n4taskUlPvE2_4_FUNES1_, @function
+_ZN1n4taskUlPvE2_4_FUNES1_:
+.LFB6870:
+	.cfi_startproc
+	movq	(%rdi), %rdx
+	movq	16(%rdi), %rax
+	addl	8(%rdi), %eax
+	addl	24(%rdi), %eax
+	addl	%eax, (%rdx)
+	ret
+	.cfi_endproc
+.LFE6870:
+	.size	_ZN1n4taskUlPvE2_4_FUNES1_, .-_ZN1n4taskUlPvE2_4_FUNES1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvS1_E3_4_FUNES1_S1_, @function
+_ZN1n4taskUlPvS1_E3_4_FUNES1_S1_:
+.LFB6873:
+	.cfi_startproc
+	movdqu	(%rdi), %xmm0
+	movups	%xmm0, (%rsi)
+	movdqu	16(%rdi), %xmm1
+	movups	%xmm1, 16(%rsi)
+	ret
+	.cfi_endproc
+.LFE6873:
+	.size	_ZN1n4taskUlPvS1_E3_4_FUNES1_S1_, .-_ZN1n4taskUlPvS1_E3_4_FUNES1_S1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvPNS_15memory_resourceEE4_4_FUNES1_S3_, @function
+_ZN1n4taskUlPvPNS_15memory_resourceEE4_4_FUNES1_S3_:
+.LFB6876:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE6876:
+	.size	_ZN1n4taskUlPvPNS_15memory_resourceEE4_4_FUNES1_S3_, .-_ZN1n4taskUlPvPNS_15memory_resourceEE4_4_FUNES1_S3_
+	.p2align 4
+	.type	_ZN1n4taskUlPvE5_4_FUNES1_, @function
+_ZN1n4taskUlPvE5_4_FUNES1_:
+.LFB6882:
+	.cfi_startproc
+	movq	(%rdi), %rax
+	movq	(%rax), %rdx
+	movsbl	8(%rax), %eax
+	movl	%eax, (%rdx)
+	ret
+	.cfi_endproc
+.LFE6882:
+	.size	_ZN1n4taskUlPvE5_4_FUNES1_, .-_ZN1n4taskUlPvE5_4_FUNES1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvS1_E6_4_FUNES1_S1_, @function
+_ZN1n4taskUlPvS1_E6_4_FUNES1_S1_:
+.LFB6885:
+	.cfi_startproc
+	movq	(%rdi), %rax
+	movq	%rax, (%rsi)
+	ret
+	.cfi_endproc
+.LFE6885:
+	.size	_ZN1n4taskUlPvS1_E6_4_FUNES1_S1_, .-_ZN1n4taskUlPvS1_E6_4_FUNES1_S1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvPNS_15memory_resourceEE7_4_FUNES1_S3_, @function
+_ZN1n4taskUlPvPNS_15memory_resourceEE7_4_FUNES1_S3_:
+.LFB6888:
+	.cfi_startproc
+	movq	%rdi, %rax
+	movq	%rsi, %rdi
+	movl	$8, %ecx
+	movl	$208, %edx
+	movq	(%rax), %rsi
+	movq	(%rdi), %rax
+	movq	24(%rax), %rax
+	jmp	*%rax
+	.cfi_endproc
+.LFE6888:
+	.size	_ZN1n4taskUlPvPNS_15memory_resourceEE7_4_FUNES1_S3_, .-_ZN1n4taskUlPvPNS_15memory_resourceEE7_4_FUNES1_S3_
+	.p2align 4
+	.type	_ZN1n4taskUlPvS1_E9_4_FUNES1_S1_, @function
+_ZN1n4taskUlPvS1_E9_4_FUNES1_S1_:
+.LFB6929:
+	.cfi_startproc
+	movdqu	(%rdi), %xmm0
+	movups	%xmm0, (%rsi)
+	movq	16(%rdi), %rax
+	movq	%rax, 16(%rsi)
+	ret
+	.cfi_endproc
+.LFE6929:
+	.size	_ZN1n4taskUlPvS1_E9_4_FUNES1_S1_, .-_ZN1n4taskUlPvS1_E9_4_FUNES1_S1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvPNS_15memory_resourceEE10_4_FUNES1_S3_, @function
+_ZN1n4taskUlPvPNS_15memory_resourceEE10_4_FUNES1_S3_:
+.LFB6932:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE6932:
+	.size	_ZN1n4taskUlPvPNS_15memory_resourceEE10_4_FUNES1_S3_, .-_ZN1n4taskUlPvPNS_15memory_resourceEE10_4_FUNES1_S3_
+	.p2align 4
+	.type	_ZN1n4taskUlPvS1_E12_4_FUNES1_S1_, @function
+_ZN1n4taskUlPvS1_E12_4_FUNES1_S1_:
+.LFB6943:
+	.cfi_startproc
+	movdqu	(%rdi), %xmm0
+	movups	%xmm0, (%rsi)
+	ret
+	.cfi_endproc
+.LFE6943:
+	.size	_ZN1n4taskUlPvS1_E12_4_FUNES1_S1_, .-_ZN1n4taskUlPvS1_E12_4_FUNES1_S1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvPNS_15memory_resourceEE13_4_FUNES1_S3_, @function
+_ZN1n4taskUlPvPNS_15memory_resourceEE13_4_FUNES1_S3_:
+.LFB6946:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE6946:
+	.size	_ZN1n4taskUlPvPNS_15memory_resourceEE13_4_FUNES1_S3_, .-_ZN1n4taskUlPvPNS_15memory_resourceEE13_4_FUNES1_S3_
+	.p2align 4
+	.type	_ZN1n4taskUlPvE14_4_FUNES1_, @function
+_ZN1n4taskUlPvE14_4_FUNES1_:
+.LFB6978:
+	.cfi_startproc
+	movq	(%rdi), %rdx
+	movq	8(%rdi), %rcx
+	movq	(%rdx), %rax
+	movq	8(%rdx), %rsi
+	movq	%rax, %rdx
+	sall	$4, %eax
+	salq	$4, %rdx
+	addl	%ecx, %eax
+	addq	%rcx, %rdx
+	movl	%eax, (%rsi,%rdx,4)
+	ret
+	.cfi_endproc
+.LFE6978:
+	.size	_ZN1n4taskUlPvE14_4_FUNES1_, .-_ZN1n4taskUlPvE14_4_FUNES1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvS1_E15_4_FUNES1_S1_, @function
+_ZN1n4taskUlPvS1_E15_4_FUNES1_S1_:
+.LFB6981:
+	.cfi_startproc
+	movdqu	(%rdi), %xmm0
+	movups	%xmm0, (%rsi)
+	ret
+	.cfi_endproc
+.LFE6981:
+	.size	_ZN1n4taskUlPvS1_E15_4_FUNES1_S1_, .-_ZN1n4taskUlPvS1_E15_4_FUNES1_S1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvPNS_15memory_resourceEE16_4_FUNES1_S3_, @function
+_ZN1n4taskUlPvPNS_15memory_resourceEE16_4_FUNES1_S3_:
+.LFB6984:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE6984:
+	.size	_ZN1n4taskUlPvPNS_15memory_resourceEE16_4_FUNES1_S3_, .-_ZN1n4taskUlPvPNS_15memory_resourceEE16_4_FUNES1_S3_
+	.p2align 4
+	.type	_ZN1n4taskUlPvS1_E18_4_FUNES1_S1_, @function
+_ZN1n4taskUlPvS1_E18_4_FUNES1_S1_:
+.LFB6994:
+	.cfi_startproc
+	movdqu	(%rdi), %xmm0
+	movups	%xmm0, (%rsi)
+	ret
+	.cfi_endproc
+.LFE6994:
+	.size	_ZN1n4taskUlPvS1_E18_4_FUNES1_S1_, .-_ZN1n4taskUlPvS1_E18_4_FUNES1_S1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvPNS_15memory_resourceEE19_4_FUNES1_S3_, @function
+_ZN1n4taskUlPvPNS_15memory_resourceEE19_4_FUNES1_S3_:
+.LFB6997:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE6997:
+	.size	_ZN1n4taskUlPvPNS_15memory_resourceEE19_4_FUNES1_S3_, .-_ZN1n4taskUlPvPNS_15memory_resourceEE19_4_FUNES1_S3_
+	.p2align 4
+	.type	_ZN1n4taskUlPvE20_4_FUNES1_, @function
+_ZN1n4taskUlPvE20_4_FUNES1_:
+.LFB7004:
+	.cfi_startproc
+	movq	(%rdi), %rax
+	movq	(%rax), %rax
+	addl	$1, (%rax)
+	ret
+	.cfi_endproc
+.LFE7004:
+	.size	_ZN1n4taskUlPvE20_4_FUNES1_, .-_ZN1n4taskUlPvE20_4_FUNES1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvS1_E21_4_FUNES1_S1_, @function
+_ZN1n4taskUlPvS1_E21_4_FUNES1_S1_:
+.LFB7007:
+	.cfi_startproc
+	movdqu	(%rdi), %xmm0
+	movups	%xmm0, (%rsi)
+	ret
+	.cfi_endproc
+.LFE7007:
+	.size	_ZN1n4taskUlPvS1_E21_4_FUNES1_S1_, .-_ZN1n4taskUlPvS1_E21_4_FUNES1_S1_
+	.p2align 4
+	.type	_ZN1n4taskUlPvPNS_15memory_resourceEE22_4_FUNES1_S3_, @function
+_ZN1n4taskUlPvPNS_15memory_resourceEE22_4_FUNES1_S3_:
+.LFB7010:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7010:
+	.size	_ZN1n4taskUlPvPNS_15memory_resourceEE22_4_FUNES1_S3_, .-_ZN1n4taskUlPvPNS_15memory_resourceEE22_4_FUNES1_S3_
+	.section	.text._ZN17counting_resourceD2Ev,"axG",@progbits,_ZN17counting_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN17counting_resourceD2Ev
+	.type	_ZN17counting_resourceD2Ev, @function
+_ZN17counting_resourceD2Ev:
+.LFB7024:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7024:
+	.size	_ZN17counting_resourceD2Ev, .-_ZN17counting_resourceD2Ev
+	.weak	_ZN17counting_resourceD1Ev
+	.set	_ZN17counting_resourceD1Ev,_ZN17counting_resourceD2Ev
+	.section	.text._ZN1n13heap_resourceD2Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD2Ev
+	.type	_ZN1n13heap_resourceD2Ev, @function
+_ZN1n13heap_resourceD2Ev:
+.LFB7028:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7028:
+	.size	_ZN1n13heap_resourceD2Ev, .-_ZN1n13heap_resourceD2Ev
+	.weak	_ZN1n13heap_resourceD1Ev
+	.set	_ZN1n13heap_resourceD1Ev,_ZN1n13heap_resourceD2Ev
+	.section	.text._ZN1n13heap_resource10deallocateEPvmm,"axG",@progbits,_ZN1n13heap_resource10deallocateEPvmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource10deallocateEPvmm
+	.type	_ZN1n13heap_resource10deallocateEPvmm, @function
+_ZN1n13heap_resource10deallocateEPvmm:
+.LFB38:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rcx
+	jbe	.L23
+	movq	%rcx, %rsi
+	jmp	_ZdlPvSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L23:
+	jmp	_ZdlPv@PLT
+	.cfi_endproc
+.LFE38:
+	.size	_ZN1n13heap_resource10deallocateEPvmm, .-_ZN1n13heap_resource10deallocateEPvmm
+	.section	.text._ZN1n13heap_resource8allocateEmm,"axG",@progbits,_ZN1n13heap_resource8allocateEmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource8allocateEmm
+	.type	_ZN1n13heap_resource8allocateEmm, @function
+_ZN1n13heap_resource8allocateEmm:
+.LFB37:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rdx
+	jbe	.L25
+	movq	%rdx, %rsi
+	jmp	_ZnwmSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L25:
+	jmp	_Znwm@PLT
+	.cfi_endproc
+.LFE37:
+	.size	_ZN1n13heap_resource8allocateEmm, .-_ZN1n13heap_resource8allocateEmm
+	.section	.text._ZN1n13heap_resourceD0Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD0Ev
+	.type	_ZN1n13heap_resourceD0Ev, @function
+_ZN1n13heap_resourceD0Ev:
+.LFB7030:
+	.cfi_startproc
+	movl	$8, %esi
+	jmp	_ZdlPvm@PLT
+	.cfi_endproc
+.LFE7030:
+	.size	_ZN1n13heap_resourceD0Ev, .-_ZN1n13heap_resourceD0Ev
+	.section	.text._ZN17counting_resourceD0Ev,"axG",@progbits,_ZN17counting_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN17counting_resourceD0Ev
+	.type	_ZN17counting_resourceD0Ev, @function
+_ZN17counting_resourceD0Ev:
+.LFB7026:
+	.cfi_startproc
+	movl	$16, %esi
+	jmp	_ZdlPvm@PLT
+	.cfi_endproc
+.LFE7026:
+	.size	_ZN17counting_resourceD0Ev, .-_ZN17counting_resourceD0Ev
+	.text
+	.p2align 4
+	.type	_ZN1n4taskUlPvE11_4_FUNES1_, @function
+_ZN1n4taskUlPvE11_4_FUNES1_:
+.LFB6940:
+	.cfi_startproc
+	movq	(%rdi), %rax
+	movq	8(%rdi), %rdx
+	lock addq	%rdx, (%rax)
+	ret
+	.cfi_endproc
+.LFE6940:
+	.size	_ZN1n4taskUlPvE11_4_FUNES1_, .-_ZN1n4taskUlPvE11_4_FUNES1_
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC1:
+	.string	"expected equal : expected value : called, actual value : 6"
+	.align 8
+.LC2:
+	.string	"expected equal : expected value : counting.allocations, actual value : 0"
+	.section	.text.unlikely,"ax",@progbits
+.LCOLDB3:
+	.text
+.LHOTB3:
+	.p2align 4
+	.globl	_Z30test_task_small_capture_inlinev
+	.type	_Z30test_task_small_capture_inlinev, @function
+_Z30test_task_small_capture_inlinev:
+.LFB6794:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6794
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	leaq	16+_ZTV17counting_resource(%rip), %rax
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$160, %rsp
+	.cfi_def_cfa_offset 192
+	movdqa	.LC0(%rip), %xmm0
+	movq	%rax, 16(%rsp)
+	leaq	16(%rsp), %rax
+	leaq	96(%rsp), %rbp
+	movq	$0, 24(%rsp)
+	movq	%rbp, %rdi
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbx
+	movq	%rax, %fs:_ZN1n18__current_resourceE@tpoff
+	leaq	12(%rsp), %rax
+	movq	%rax, 32(%rsp)
+	leaq	_ZN1n4task8__ops_ofIZ30test_task_small_capture_inlinevEUlvE_EE(%rip), %rax
+	movups	%xmm0, 40(%rsp)
+	movdqa	32(%rsp), %xmm1
+	movq	$3, 56(%rsp)
+	movdqa	48(%rsp), %xmm2
+	movl	$0, 12(%rsp)
+	movq	$0, 88(%rsp)
+	movq	%rax, 144(%rsp)
+	movq	$0, 152(%rsp)
+	movq	$0, 80(%rsp)
+	movaps	%xmm1, 96(%rsp)
+	movaps	%xmm2, 112(%rsp)
+	call	_ZN1n4taskUlPvE2_4_FUNES1_
+	cmpl	$6, 12(%rsp)
+	jne	.L42
+	movl	24(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L43
+	movq	%rbx, %fs:_ZN1n18__current_resourceE@tpoff
+	addq	$160, %rsp
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.globl	__gxx_personality_v0
+	.section	.gcc_except_table,"a",@progbits
+.LLSDA6794:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6794-.LLSDACSB6794
+.LLSDACSB6794:
+.LLSDACSE6794:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6794
+	.type	_Z30test_task_small_capture_inlinev.cold, @function
+_Z30test_task_small_capture_inlinev.cold:
+.LFSB6794:
+.L42:
+	.cfi_def_cfa_offset 192
+	.cfi_offset 3, -32
+	.cfi_offset 6, -24
+	.cfi_offset 12, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC1(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB0:
+	call	__cxa_throw@PLT
+.L43:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC2(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE0:
+.L35:
+	movq	%rax, %r12
+	movq	144(%rsp), %rax
+	testq	%rax, %rax
+	je	.L33
+	movq	152(%rsp), %rsi
+	movq	%rbp, %rdi
+	call	*16(%rax)
+.L33:
+	movq	80(%rsp), %rax
+	testq	%rax, %rax
+	je	.L34
+	movq	88(%rsp), %rsi
+	leaq	32(%rsp), %rdi
+	call	*16(%rax)
+.L34:
+	movq	%rbx, %fs:_ZN1n18__current_resourceE@tpoff
+	movq	%r12, %rdi
+.LEHB1:
+	call	_Unwind_Resume@PLT
+.LEHE1:
+	.cfi_endproc
+.LFE6794:
+	.section	.gcc_except_table
+.LLSDAC6794:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6794-.LLSDACSBC6794
+.LLSDACSBC6794:
+	.uleb128 .LEHB0-.LCOLDB3
+	.uleb128 .LEHE0-.LEHB0
+	.uleb128 .L35-.LCOLDB3
+	.uleb128 0
+	.uleb128 .LEHB1-.LCOLDB3
+	.uleb128 .LEHE1-.LEHB1
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6794:
+	.section	.text.unlikely
+	.text
+	.size	_Z30test_task_small_capture_inlinev, .-_Z30test_task_small_capture_inlinev
+	.section	.text.unlikely
+	.size	_Z30test_task_small_capture_inlinev.cold, .-_Z30test_task_small_capture_inlinev.cold
+.LCOLDE3:
+	.text
+.LHOTE3:
+	.section	.text._ZN1n11thread_pool6__loopEPv,"axG",@progbits,_ZN1n11thread_pool6__loopEPv,comdat
+	.p2align 4
+	.weak	_ZN1n11thread_pool6__loopEPv
+	.type	_ZN1n11thread_pool6__loopEPv, @function
+_ZN1n11thread_pool6__loopEPv:
+.LFB6735:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6735
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$88, %rsp
+	.cfi_def_cfa_offset 144
+	movq	(%rdi), %rbx
+	movq	%rdi, %fs:_ZN1n16__current_workerE@tpoff
+	leaq	208(%rbx), %r12
+	.p2align 4,,10
+	.p2align 3
+.L47:
+	movq	(%r12), %r13
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %rbp
+	testq	%rbp, %rbp
+	je	.L48
+	cmpq	0(%rbp), %rbx
+	jne	.L49
+	movq	128(%rbp), %rcx
+	movq	136(%rbp), %rdi
+	leaq	64(%rbp), %r8
+	leaq	128(%rbp), %r9
+	leaq	-1(%rcx), %rax
+	movq	%rax, 128(%rbp)
+	lock orq	$0, (%rsp)
+	movq	64(%rbp), %rsi
+	cmpq	%rsi, %rax
+	jge	.L50
+	movq	%rcx, 128(%rbp)
+.L51:
+	movq	112(%rbx), %rax
+	leaq	112(%rbx), %r15
+	testq	%rax, %rax
+	jne	.L55
+	movq	16(%rbx), %rsi
+.L58:
+	movq	16(%rbp), %rdx
+	movq	%rdx, %rax
+	salq	$13, %rax
+	xorq	%rdx, %rax
+	movq	%rax, %rdx
+	shrq	$7, %rdx
+	xorq	%rax, %rdx
+	movq	%rdx, %rax
+	salq	$17, %rax
+	xorq	%rdx, %rax
+	xorl	%edx, %edx
+	movq	%rax, 16(%rbp)
+	divq	%rsi
+	movq	%rdx, %rcx
+.L56:
+	leaq	(%rcx,%rsi), %r8
+	testq	%rsi, %rsi
+	jne	.L66
+	jmp	.L67
+	.p2align 4,,10
+	.p2align 3
+.L64:
+	addq	$1, %rcx
+	cmpq	%rcx, %r8
+	je	.L67
+.L66:
+	movq	%rcx, %rax
+	xorl	%edx, %edx
+	divq	%rsi
+	movq	(%rbx), %rax
+	movq	(%rax,%rdx,8), %rdx
+	cmpq	%rbp, %rdx
+	je	.L64
+	movq	64(%rdx), %rax
+	leaq	64(%rdx), %r9
+	lock orq	$0, (%rsp)
+	movq	128(%rdx), %rdi
+	cmpq	%rdi, %rax
+	jge	.L64
+	movq	136(%rdx), %rdi
+	movq	(%rdi), %rdx
+	movq	8(%rdi), %rdi
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%rdi,%rdx,8), %r14
+	leaq	1(%rax), %rdx
+	lock cmpxchgq	%rdx, (%r9)
+	jne	.L64
+.L53:
+	movq	48(%r14), %rax
+	movq	%r14, %rdi
+	leaq	16(%rsp), %rbp
+.LEHB2:
+	call	*(%rax)
+.LEHE2:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 16(%rsp)
+	movaps	%xmm0, 32(%rsp)
+	movaps	%xmm0, 48(%rsp)
+	movaps	%xmm0, 64(%rsp)
+	cmpq	%rbp, %r14
+	je	.L68
+	movq	48(%r14), %rax
+	testq	%rax, %rax
+	je	.L68
+	movq	56(%r14), %rsi
+	movq	%r14, %rdi
+.LEHB3:
+	call	*16(%rax)
+	movq	$0, 48(%r14)
+	movq	64(%rsp), %rax
+	testq	%rax, %rax
+	je	.L68
+	movq	%r14, %rsi
+	movq	%rbp, %rdi
+	call	*8(%rax)
+.LEHE3:
+	movdqa	64(%rsp), %xmm1
+	movaps	%xmm1, 48(%r14)
+.L68:
+	movq	64(%r14), %rax
+	lock subq	$1, (%rax)
+	jmp	.L47
+	.p2align 4,,10
+	.p2align 3
+.L67:
+	leaq	120(%rbx), %rbp
+	movq	%rbp, %rdi
+	call	pthread_mutex_lock@PLT
+	lock addq	$1, 216(%rbx)
+	cmpb	$0, 224(%rbx)
+	jne	.L94
+	movq	(%r12), %rax
+	cmpq	%r13, %rax
+	jne	.L71
+	leaq	160(%rbx), %rdi
+	movq	%rbp, %rsi
+.LEHB4:
+	call	pthread_cond_wait@PLT
+.LEHE4:
+.L71:
+	lock subq	$1, 216(%rbx)
+	movq	%rbp, %rdi
+	call	pthread_mutex_unlock@PLT
+	jmp	.L47
+	.p2align 4,,10
+	.p2align 3
+.L49:
+	movq	112(%rbx), %rcx
+	leaq	112(%rbx), %r15
+	testq	%rcx, %rcx
+	jne	.L74
+	movq	16(%rbx), %rsi
+	xorl	%ebp, %ebp
+	jmp	.L56
+	.p2align 4,,10
+	.p2align 3
+.L74:
+	xorl	%ebp, %ebp
+.L55:
+	leaq	32(%rbx), %rdi
+	movq	%rdi, 8(%rsp)
+	call	pthread_mutex_lock@PLT
+	movq	104(%rbx), %rax
+	cmpq	88(%rbx), %rax
+	movq	8(%rsp), %rdi
+	jne	.L57
+	call	pthread_mutex_unlock@PLT
+	movq	16(%rbx), %rsi
+	testq	%rbp, %rbp
+	jne	.L58
+	xorl	%ecx, %ecx
+	jmp	.L56
+	.p2align 4,,10
+	.p2align 3
+.L50:
+	movq	(%rdi), %rdx
+	movq	8(%rdi), %rdi
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%rdi,%rdx,8), %r14
+	cmpq	%rsi, %rax
+	jne	.L53
+	lock cmpxchgq	%rcx, (%r8)
+	movq	%rcx, (%r9)
+	je	.L53
+	jmp	.L51
+	.p2align 4,,10
+	.p2align 3
+.L48:
+	movq	112(%rbx), %rcx
+	leaq	112(%rbx), %r15
+	testq	%rcx, %rcx
+	jne	.L55
+	movq	16(%rbx), %rsi
+	jmp	.L56
+	.p2align 4,,10
+	.p2align 3
+.L57:
+	movq	72(%rbx), %rdx
+	leaq	1(%rax), %rcx
+	movq	%rcx, 104(%rbx)
+	movq	(%rdx,%rax,8), %r14
+	lock subq	$1, (%r15)
+	movq	88(%rbx), %rax
+	cmpq	%rax, 104(%rbx)
+	jne	.L93
+	movq	$0, 88(%rbx)
+	movq	$0, 104(%rbx)
+.L93:
+	call	pthread_mutex_unlock@PLT
+	jmp	.L53
+	.p2align 4,,10
+	.p2align 3
+.L94:
+	movq	%rbp, %rdi
+	call	pthread_mutex_unlock@PLT
+	addq	$88, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L75:
+	.cfi_restore_state
+	movq	%rax, %rbx
+.L69:
+	movq	64(%rsp), %rax
+	testq	%rax, %rax
+	je	.L70
+	movq	72(%rsp), %rsi
+	movq	%rbp, %rdi
+	call	*16(%rax)
+.L70:
+	movq	%rbx, %rdi
+.LEHB5:
+	call	_Unwind_Resume@PLT
+.LEHE5:
+	.cfi_endproc
+.LFE6735:
+	.section	.gcc_except_table
+.LLSDA6735:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6735-.LLSDACSB6735
+.LLSDACSB6735:
+	.uleb128 .LEHB2-.LFB6735
+	.uleb128 .LEHE2-.LEHB2
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB3-.LFB6735
+	.uleb128 .LEHE3-.LEHB3
+	.uleb128 .L75-.LFB6735
+	.uleb128 0
+	.uleb128 .LEHB4-.LFB6735
+	.uleb128 .LEHE4-.LEHB4
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB5-.LFB6735
+	.uleb128 .LEHE5-.LEHB5
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6735:
+	.section	.text._ZN1n11thread_pool6__loopEPv,"axG",@progbits,_ZN1n11thread_pool6__loopEPv,comdat
+	.size	_ZN1n11thread_pool6__loopEPv, .-_ZN1n11thread_pool6__loopEPv
+	.section	.text._ZN17counting_resource8allocateEmm,"axG",@progbits,_ZN17counting_resource8allocateEmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN17counting_resource8allocateEmm
+	.type	_ZN17counting_resource8allocateEmm, @function
+_ZN17counting_resource8allocateEmm:
+.LFB6792:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rsi, %rbx
+	addl	$1, 8(%rdi)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L103
+.L97:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	movq	(%rdi), %rax
+	movq	16(%rax), %rax
+	jmp	*%rax
+	.p2align 4,,10
+	.p2align 3
+.L103:
+	.cfi_restore_state
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L97
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L97
+	.cfi_endproc
+.LFE6792:
+	.size	_ZN17counting_resource8allocateEmm, .-_ZN17counting_resource8allocateEmm
+	.section	.text._ZN17counting_resource10deallocateEPvmm,"axG",@progbits,_ZN17counting_resource10deallocateEPvmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN17counting_resource10deallocateEPvmm
+	.type	_ZN17counting_resource10deallocateEPvmm, @function
+_ZN17counting_resource10deallocateEPvmm:
+.LFB6793:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rcx, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rdx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rsi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	addl	$1, 12(%rdi)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L112
+.L106:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%r12, %rcx
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movq	(%rdi), %rax
+	movq	24(%rax), %rax
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	jmp	*%rax
+	.p2align 4,,10
+	.p2align 3
+.L112:
+	.cfi_restore_state
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L106
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r13, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L106
+	.cfi_endproc
+.LFE6793:
+	.size	_ZN17counting_resource10deallocateEPvmm, .-_ZN17counting_resource10deallocateEPvmm
+	.section	.text.unlikely
+	.align 2
+.LCOLDB4:
+	.text
+.LHOTB4:
+	.align 2
+	.p2align 4
+	.type	_ZN1n11thread_poolC2Em.constprop.2, @function
+_ZN1n11thread_poolC2Em.constprop.2:
+.LFB7033:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7033
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L173
+.L115:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	pxor	%xmm0, %xmm0
+	movq	$0, 0(%rbp)
+	movups	%xmm0, 8(%rbp)
+	pxor	%xmm0, %xmm0
+	movq	%rax, 24(%rbp)
+	movq	$0, 64(%rbp)
+	movups	%xmm0, 32(%rbp)
+	movups	%xmm0, 48(%rbp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L174
+.L118:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	8(%rbp), %rbx
+	pxor	%xmm0, %xmm0
+	pxor	%xmm1, %xmm1
+	movq	$0, 72(%rbp)
+	movq	%rax, 96(%rbp)
+	movq	$0, 152(%rbp)
+	movb	$0, 224(%rbp)
+	movups	%xmm1, 80(%rbp)
+	movups	%xmm1, 104(%rbp)
+	movups	%xmm0, 120(%rbp)
+	movups	%xmm0, 136(%rbp)
+	movups	%xmm0, 160(%rbp)
+	movups	%xmm0, 176(%rbp)
+	movups	%xmm0, 192(%rbp)
+	movups	%xmm1, 208(%rbp)
+	cmpq	$2, %rbx
+	jbe	.L175
+.L120:
+	movabsq	$-7046029254386353131, %r15
+	xorl	%r12d, %r12d
+	jmp	.L136
+	.p2align 4,,10
+	.p2align 3
+.L124:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$64, %edx
+	movl	$192, %esi
+	movq	(%rdi), %rax
+.LEHB6:
+	call	*16(%rax)
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	movl	$24, %ecx
+	xorl	%eax, %eax
+	rep stosq
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L176
+.L127:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$8, %edx
+	movl	$528, %esi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	leaq	16(%rax), %rdx
+	movq	$64, (%rax)
+	movq	%rdx, 8(%rax)
+	movq	%rax, 136(%rbx)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L177
+.L130:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	%r12, 8(%rbx)
+	addq	$1, %r12
+	pxor	%xmm2, %xmm2
+	movups	%xmm2, 152(%rbx)
+	movq	16(%rbp), %rdx
+	movq	8(%rbp), %r13
+	movq	%rax, 168(%rbx)
+	movq	%r12, %rax
+	movq	0(%rbp), %r14
+	imulq	%r15, %rax
+	movq	%rbp, (%rbx)
+	movq	$0, 144(%rbx)
+	movq	%rax, 16(%rbx)
+	cmpq	%r13, %rdx
+	je	.L178
+	movq	%rbx, (%r14,%rdx,8)
+.L135:
+	addq	$1, %rdx
+	movq	%rdx, 16(%rbp)
+	cmpq	$3, %r12
+	je	.L179
+.L136:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L124
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L124
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L124
+	.p2align 4,,10
+	.p2align 3
+.L177:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L130
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L130
+	.p2align 4,,10
+	.p2align 3
+.L176:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L127
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L127
+	.p2align 4,,10
+	.p2align 3
+.L178:
+	leaq	5(%r13), %rsi
+	movq	24(%rbp), %rdi
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 8(%rbp)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	16(%rbp), %rdx
+	movq	%rax, %rdi
+	movq	%rax, 0(%rbp)
+	movq	%rbx, (%rdi,%rdx,8)
+	leaq	0(,%rdx,8), %rax
+	testq	%rdx, %rdx
+	jne	.L180
+	testq	%r14, %r14
+	je	.L135
+.L134:
+	movq	24(%rbp), %rdi
+	leaq	0(,%r13,8), %rdx
+	movl	$8, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	16(%rbp), %rdx
+	addq	$1, %rdx
+	movq	%rdx, 16(%rbp)
+	cmpq	$3, %r12
+	jne	.L136
+	.p2align 4,,10
+	.p2align 3
+.L179:
+	xorl	%ebx, %ebx
+	leaq	_ZN1n11thread_pool6__loopEPv(%rip), %r12
+	.p2align 4,,10
+	.p2align 3
+.L137:
+	movq	0(%rbp), %rax
+	movq	%r12, %rdx
+	xorl	%esi, %esi
+	movq	(%rax,%rbx), %rcx
+	addq	$8, %rbx
+	leaq	24(%rcx), %rdi
+	call	pthread_create@PLT
+	cmpq	$24, %rbx
+	jne	.L137
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L180:
+	.cfi_restore_state
+	movq	%rax, %rdx
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L134
+	.p2align 4,,10
+	.p2align 3
+.L173:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L115
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L115
+	.p2align 4,,10
+	.p2align 3
+.L175:
+	movq	24(%rbp), %rdi
+	movq	0(%rbp), %r12
+	movl	$8, %edx
+	movl	$24, %esi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, 0(%rbp)
+	movq	%rax, %rdi
+	movq	16(%rbp), %rax
+	movq	$3, 8(%rbp)
+	testq	%rax, %rax
+	jne	.L181
+	testq	%r12, %r12
+	je	.L120
+.L122:
+	movq	24(%rbp), %rdi
+	leaq	0(,%rbx,8), %rdx
+	movl	$8, %ecx
+	movq	%r12, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE6:
+	jmp	.L120
+	.p2align 4,,10
+	.p2align 3
+.L174:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L118
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L118
+	.p2align 4,,10
+	.p2align 3
+.L181:
+	leaq	0(,%rax,8), %rdx
+	movq	%r12, %rsi
+	call	memcpy@PLT
+	jmp	.L122
+.L141:
+	movq	%rax, %rbx
+	jmp	.L138
+	.section	.gcc_except_table
+.LLSDA7033:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7033-.LLSDACSB7033
+.LLSDACSB7033:
+	.uleb128 .LEHB6-.LFB7033
+	.uleb128 .LEHE6-.LEHB6
+	.uleb128 .L141-.LFB7033
+	.uleb128 0
+.LLSDACSE7033:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7033
+	.type	_ZN1n11thread_poolC2Em.constprop.2.cold, @function
+_ZN1n11thread_poolC2Em.constprop.2.cold:
+.LFSB7033:
+.L138:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	72(%rbp), %rsi
+	movq	80(%rbp), %rdx
+	testq	%rsi, %rsi
+	je	.L139
+	movq	96(%rbp), %rdi
+	salq	$3, %rdx
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L139:
+	movq	0(%rbp), %rsi
+	movq	8(%rbp), %rdx
+	testq	%rsi, %rsi
+	je	.L140
+	movq	24(%rbp), %rdi
+	salq	$3, %rdx
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L140:
+	movq	%rbx, %rdi
+.LEHB7:
+	call	_Unwind_Resume@PLT
+.LEHE7:
+	.cfi_endproc
+.LFE7033:
+	.section	.gcc_except_table
+.LLSDAC7033:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7033-.LLSDACSBC7033
+.LLSDACSBC7033:
+	.uleb128 .LEHB7-.LCOLDB4
+	.uleb128 .LEHE7-.LEHB7
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC7033:
+	.section	.text.unlikely
+	.text
+	.size	_ZN1n11thread_poolC2Em.constprop.2, .-_ZN1n11thread_poolC2Em.constprop.2
+	.section	.text.unlikely
+	.size	_ZN1n11thread_poolC2Em.constprop.2.cold, .-_ZN1n11thread_poolC2Em.constprop.2.cold
+.LCOLDE4:
+	.text
+.LHOTE4:
+	.section	.rodata.str1.8
+	.align 8
+.LC5:
+	.string	"expected equal : expected value : called, actual value : 'x'"
+	.align 8
+.LC6:
+	.string	"expected equal : expected value : counting.allocations, actual value : 1"
+	.align 8
+.LC7:
+	.string	"expected equal : expected value : counting.deallocations, actual value : 1"
+	.section	.text.unlikely
+.LCOLDB8:
+	.text
+.LHOTB8:
+	.p2align 4
+	.globl	_Z33test_task_large_capture_allocatesv
+	.type	_Z33test_task_large_capture_allocatesv, @function
+_Z33test_task_large_capture_allocatesv:
+.LFB6800:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6800
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pxor	%xmm0, %xmm0
+	movl	$8, %edx
+	movl	$208, %esi
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	leaq	16+_ZTV17counting_resource(%rip), %rax
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$520, %rsp
+	.cfi_def_cfa_offset 560
+	leaq	16(%rsp), %rdi
+	movq	%rax, 16(%rsp)
+	movq	$0, 24(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbp
+	movq	%rdi, %fs:_ZN1n18__current_resourceE@tpoff
+	movq	$120, 96(%rsp)
+	movq	$0, 104(%rsp)
+	movq	$0, 288(%rsp)
+	movl	$0, 12(%rsp)
+	movq	$120, 312(%rsp)
+	movq	$0, 320(%rsp)
+	movaps	%xmm0, 112(%rsp)
+	movaps	%xmm0, 128(%rsp)
+	movaps	%xmm0, 144(%rsp)
+	movaps	%xmm0, 160(%rsp)
+	movaps	%xmm0, 176(%rsp)
+	movaps	%xmm0, 192(%rsp)
+	movaps	%xmm0, 208(%rsp)
+	movaps	%xmm0, 224(%rsp)
+	movaps	%xmm0, 240(%rsp)
+	movaps	%xmm0, 256(%rsp)
+	movaps	%xmm0, 272(%rsp)
+	movups	%xmm0, 328(%rsp)
+	movups	%xmm0, 344(%rsp)
+	movups	%xmm0, 360(%rsp)
+	movups	%xmm0, 376(%rsp)
+	movups	%xmm0, 392(%rsp)
+	movups	%xmm0, 408(%rsp)
+	movups	%xmm0, 424(%rsp)
+	movq	$0, 504(%rsp)
+	movq	$0, 80(%rsp)
+	movq	%rdi, 88(%rsp)
+	movups	%xmm0, 440(%rsp)
+	movups	%xmm0, 456(%rsp)
+	movups	%xmm0, 472(%rsp)
+	movups	%xmm0, 488(%rsp)
+.LEHB8:
+	call	_ZN17counting_resource8allocateEmm
+.LEHE8:
+	leaq	12(%rsp), %rdx
+	leaq	32(%rsp), %r12
+	movq	%rax, 32(%rsp)
+	movq	%rdx, 304(%rsp)
+	leaq	304(%rsp), %rbx
+	movq	%r12, %rdi
+	movdqa	304(%rsp), %xmm1
+	movq	%rbx, %rsi
+	movups	%xmm1, (%rax)
+	movdqa	320(%rsp), %xmm2
+	movups	%xmm2, 16(%rax)
+	movdqa	336(%rsp), %xmm3
+	movups	%xmm3, 32(%rax)
+	movdqa	352(%rsp), %xmm4
+	movups	%xmm4, 48(%rax)
+	movdqa	368(%rsp), %xmm5
+	movups	%xmm5, 64(%rax)
+	movdqa	384(%rsp), %xmm6
+	movups	%xmm6, 80(%rax)
+	movdqa	400(%rsp), %xmm7
+	movups	%xmm7, 96(%rax)
+	movdqa	416(%rsp), %xmm1
+	movups	%xmm1, 112(%rax)
+	movdqa	432(%rsp), %xmm2
+	movups	%xmm2, 128(%rax)
+	movdqa	448(%rsp), %xmm3
+	movups	%xmm3, 144(%rax)
+	movdqa	464(%rsp), %xmm4
+	movups	%xmm4, 160(%rax)
+	movdqa	480(%rsp), %xmm5
+	movups	%xmm5, 176(%rax)
+	movdqa	496(%rsp), %xmm6
+	movups	%xmm6, 192(%rax)
+	call	_ZN1n4taskUlPvS1_E6_4_FUNES1_S1_
+	movq	88(%rsp), %rsi
+	leaq	_ZN1n4task8__ops_ofIZ33test_task_large_capture_allocatesvEUlvE_EE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, 352(%rsp)
+	movq	%rsi, 360(%rsp)
+	movq	$0, 80(%rsp)
+	call	_ZN1n4taskUlPvE5_4_FUNES1_
+	cmpl	$120, 12(%rsp)
+	jne	.L202
+	cmpl	$1, 24(%rsp)
+	jne	.L203
+	call	_ZN1n4taskUlPvPNS_15memory_resourceEE7_4_FUNES1_S3_
+	movq	80(%rsp), %rax
+	testq	%rax, %rax
+	je	.L185
+	movq	88(%rsp), %rsi
+	movq	%r12, %rdi
+	call	*16(%rax)
+.L185:
+	movq	%rbp, %fs:_ZN1n18__current_resourceE@tpoff
+	cmpl	$1, 28(%rsp)
+	jne	.L204
+	addq	$520, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.L191:
+	.cfi_restore_state
+	movq	%rax, %rdi
+	jmp	.L190
+	.section	.gcc_except_table
+.LLSDA6800:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6800-.LLSDACSB6800
+.LLSDACSB6800:
+	.uleb128 .LEHB8-.LFB6800
+	.uleb128 .LEHE8-.LEHB8
+	.uleb128 .L191-.LFB6800
+	.uleb128 0
+.LLSDACSE6800:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6800
+	.type	_Z33test_task_large_capture_allocatesv.cold, @function
+_Z33test_task_large_capture_allocatesv.cold:
+.LFSB6800:
+.L204:
+	.cfi_def_cfa_offset 560
+	.cfi_offset 3, -40
+	.cfi_offset 6, -32
+	.cfi_offset 12, -24
+	.cfi_offset 13, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC7(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB9:
+	call	__cxa_throw@PLT
+.LEHE9:
+.L192:
+	movq	%rax, %r13
+	movq	352(%rsp), %rax
+	testq	%rax, %rax
+	je	.L188
+	movq	360(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	*16(%rax)
+.L188:
+	movq	80(%rsp), %rax
+	testq	%rax, %rax
+	je	.L189
+	movq	88(%rsp), %rsi
+	movq	%r12, %rdi
+	call	*16(%rax)
+.L189:
+	movq	%r13, %rdi
+.L190:
+	movq	%rbp, %fs:_ZN1n18__current_resourceE@tpoff
+.LEHB10:
+	call	_Unwind_Resume@PLT
+.LEHE10:
+.L203:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC6(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB11:
+	call	__cxa_throw@PLT
+.L202:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC5(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE11:
+	.cfi_endproc
+.LFE6800:
+	.section	.gcc_except_table
+.LLSDAC6800:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6800-.LLSDACSBC6800
+.LLSDACSBC6800:
+	.uleb128 .LEHB9-.LCOLDB8
+	.uleb128 .LEHE9-.LEHB9
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB10-.LCOLDB8
+	.uleb128 .LEHE10-.LEHB10
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB11-.LCOLDB8
+	.uleb128 .LEHE11-.LEHB11
+	.uleb128 .L192-.LCOLDB8
+	.uleb128 0
+.LLSDACSEC6800:
+	.section	.text.unlikely
+	.text
+	.size	_Z33test_task_large_capture_allocatesv, .-_Z33test_task_large_capture_allocatesv
+	.section	.text.unlikely
+	.size	_Z33test_task_large_capture_allocatesv.cold, .-_Z33test_task_large_capture_allocatesv.cold
+.LCOLDE8:
+	.text
+.LHOTE8:
+	.section	.text._ZN1n10__ws_dequeD2Ev,"axG",@progbits,_ZN1n10__ws_dequeD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n10__ws_dequeD2Ev
+	.type	_ZN1n10__ws_dequeD2Ev, @function
+_ZN1n10__ws_dequeD2Ev:
+.LFB6715:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6715
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movq	72(%rdi), %rbx
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L227
+.L208:
+	movq	(%rbx), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$8, %ecx
+	movq	%rbx, %rsi
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	$0, 96(%r12)
+	je	.L210
+	xorl	%ebx, %ebx
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r13
+	jmp	.L214
+	.p2align 4,,10
+	.p2align 3
+.L212:
+	movq	0(%rbp), %rax
+	movl	$8, %ecx
+	movq	%rbp, %rsi
+	addq	$1, %rbx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	96(%r12), %rbx
+	jnb	.L210
+.L214:
+	movq	80(%r12), %rax
+	movq	(%rax,%rbx,8), %rbp
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L212
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L212
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r13, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L212
+	.p2align 4,,10
+	.p2align 3
+.L210:
+	movq	80(%r12), %rsi
+	testq	%rsi, %rsi
+	je	.L206
+	movq	104(%r12), %rdi
+	movq	88(%r12), %rdx
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	salq	$3, %rdx
+	call	*24(%rax)
+.L206:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L227:
+	.cfi_restore_state
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L208
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L208
+	.cfi_endproc
+.LFE6715:
+	.section	.gcc_except_table
+.LLSDA6715:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6715-.LLSDACSB6715
+.LLSDACSB6715:
+.LLSDACSE6715:
+	.section	.text._ZN1n10__ws_dequeD2Ev,"axG",@progbits,_ZN1n10__ws_dequeD5Ev,comdat
+	.size	_ZN1n10__ws_dequeD2Ev, .-_ZN1n10__ws_dequeD2Ev
+	.weak	_ZN1n10__ws_dequeD1Ev
+	.set	_ZN1n10__ws_dequeD1Ev,_ZN1n10__ws_dequeD2Ev
+	.section	.rodata.str1.8
+	.align 8
+.LC9:
+	.string	"expected true : d.take().get() == nodes + 199"
+	.align 8
+.LC10:
+	.string	"expected true : d.steal().get() == nodes + 0"
+	.align 8
+.LC11:
+	.string	"expected true : d.steal().get() == nodes + 1"
+	.align 8
+.LC12:
+	.string	"expected equal : expected value : left, actual value : 197"
+	.align 8
+.LC13:
+	.string	"expected false : d.steal().has()"
+	.section	.text.unlikely
+.LCOLDB14:
+	.text
+.LHOTB14:
+	.p2align 4
+	.globl	_Z17test_deque_ordersv
+	.type	_Z17test_deque_ordersv, @function
+_Z17test_deque_ordersv:
+.LFB6802:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6802
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	andq	$-64, %rsp
+	subq	$16192, %rsp
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movq	$0, 64(%rsp)
+	movq	$0, 128(%rsp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L347
+.L230:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$8, %edx
+	movl	$528, %esi
+	movq	(%rdi), %rax
+.LEHB12:
+	call	*16(%rax)
+.LEHE12:
+	leaq	16(%rax), %rdx
+	movq	$64, (%rax)
+	movq	%rdx, 8(%rax)
+	movq	%rax, 136(%rsp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L348
+.L233:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	pxor	%xmm0, %xmm0
+	movq	$0, 144(%rsp)
+	leaq	16240(%rsp), %rdx
+	movups	%xmm0, 152(%rsp)
+	movq	%rax, 168(%rsp)
+	leaq	192(%rsp), %rax
+	movq	%rax, 48(%rsp)
+	leaq	240(%rsp), %rax
+	.p2align 4,,10
+	.p2align 3
+.L235:
+	movaps	%xmm0, (%rax)
+	addq	$80, %rax
+	cmpq	%rax, %rdx
+	jne	.L235
+	movq	48(%rsp), %r15
+	leaq	16000(%r15), %rax
+	movq	%rax, 40(%rsp)
+	jmp	.L252
+	.p2align 4,,10
+	.p2align 3
+.L236:
+	movq	8(%r13), %rdx
+	subq	$1, %rax
+	andq	%r12, %rax
+	addq	$1, %r12
+	movq	%r15, (%rdx,%rax,8)
+	addq	$80, %r15
+	movq	%r12, 128(%rsp)
+	cmpq	%r15, 40(%rsp)
+	je	.L349
+.L252:
+	movq	128(%rsp), %r12
+	movq	64(%rsp), %rdi
+	movq	%rdi, 56(%rsp)
+	movq	%r12, %rdx
+	movq	%rdi, %rbx
+	subq	%rdi, %rdx
+	movq	136(%rsp), %r13
+	movq	0(%r13), %rax
+	cmpq	%rdx, %rax
+	jg	.L236
+	addq	%rax, %rax
+	movq	%rax, 32(%rsp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L350
+.L238:
+	movq	32(%rsp), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$8, %edx
+	leaq	16(,%rax,8), %rsi
+	movq	(%rdi), %rax
+.LEHB13:
+	call	*16(%rax)
+.LEHE13:
+	movq	%rax, %r14
+	movq	32(%rsp), %rax
+	movq	%rax, (%r14)
+	leaq	16(%r14), %rax
+	movq	%rax, 8(%r14)
+	movq	56(%rsp), %rax
+	cmpq	%rax, %r12
+	jle	.L246
+	.p2align 4,,10
+	.p2align 3
+.L243:
+	movq	0(%r13), %rax
+	movq	8(%r13), %rdx
+	subq	$1, %rax
+	andq	%rbx, %rax
+	movq	(%rdx,%rax,8), %rcx
+	movq	(%r14), %rax
+	movq	8(%r14), %rdx
+	subq	$1, %rax
+	andq	%rbx, %rax
+	addq	$1, %rbx
+	movq	%rcx, (%rdx,%rax,8)
+	cmpq	%rbx, %r12
+	jne	.L243
+.L246:
+	movq	144(%rsp), %rax
+	movq	160(%rsp), %rdx
+	movq	152(%rsp), %rbx
+	movq	%rax, 56(%rsp)
+	cmpq	%rbx, %rdx
+	je	.L351
+	movq	%r13, (%rax,%rdx,8)
+.L251:
+	addq	$1, %rdx
+	movq	%r14, %r13
+	movq	%rdx, 160(%rsp)
+	movq	%r14, 136(%rsp)
+	movq	(%r14), %rax
+	jmp	.L236
+	.p2align 4,,10
+	.p2align 3
+.L350:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L238
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L238
+	.p2align 4,,10
+	.p2align 3
+.L351:
+	leaq	5(%rbx), %rsi
+	movq	168(%rsp), %rdi
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 152(%rsp)
+	movq	(%rdi), %rax
+.LEHB14:
+	call	*16(%rax)
+.LEHE14:
+	movq	160(%rsp), %rdx
+	movq	%rax, %rdi
+	movq	%rax, 144(%rsp)
+	movq	%r13, (%rdi,%rdx,8)
+	leaq	0(,%rdx,8), %rax
+	testq	%rdx, %rdx
+	jne	.L352
+	cmpq	$0, 56(%rsp)
+	je	.L251
+.L250:
+	movq	168(%rsp), %rdi
+	movq	56(%rsp), %rsi
+	movl	$8, %ecx
+	leaq	0(,%rbx,8), %rdx
+	movq	(%rdi), %rax
+.LEHB15:
+	call	*24(%rax)
+.LEHE15:
+	movq	160(%rsp), %rdx
+	jmp	.L251
+.L352:
+	movq	56(%rsp), %rsi
+	movq	%rax, %rdx
+	call	memcpy@PLT
+	jmp	.L250
+.L349:
+	movq	128(%rsp), %rdx
+	movq	136(%rsp), %rdi
+	leaq	-1(%rdx), %rax
+	movq	%rax, 128(%rsp)
+	lock orq	$0, (%rsp)
+	movq	64(%rsp), %rcx
+	cmpq	%rcx, %rax
+	jge	.L253
+	movq	%rdx, 128(%rsp)
+.L254:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC9(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB16:
+	call	__cxa_throw@PLT
+.LEHE16:
+	.p2align 4,,10
+	.p2align 3
+.L253:
+	movq	(%rdi), %rsi
+	movq	8(%rdi), %rdi
+	subq	$1, %rsi
+	andq	%rax, %rsi
+	movq	(%rdi,%rsi,8), %rsi
+	cmpq	%rcx, %rax
+	je	.L353
+.L255:
+	leaq	16112(%rsp), %rbx
+	cmpq	%rbx, %rsi
+	jne	.L254
+	movq	64(%rsp), %rax
+	lock orq	$0, (%rsp)
+	movq	128(%rsp), %rdx
+	cmpq	%rdx, %rax
+	jge	.L259
+	movq	136(%rsp), %rcx
+	movq	(%rcx), %rsi
+	movq	8(%rcx), %rcx
+	leaq	-1(%rsi), %rdx
+	andq	%rax, %rdx
+	movq	(%rcx,%rdx,8), %rdx
+	leaq	1(%rax), %rcx
+	lock cmpxchgq	%rcx, 64(%rsp)
+	jne	.L259
+	movq	48(%rsp), %rax
+	cmpq	%rax, %rdx
+	jne	.L259
+	movq	64(%rsp), %rax
+	lock orq	$0, (%rsp)
+	movq	128(%rsp), %rdx
+	cmpq	%rdx, %rax
+	jge	.L264
+	movq	136(%rsp), %rcx
+	movq	(%rcx), %rsi
+	movq	8(%rcx), %rcx
+	leaq	-1(%rsi), %rdx
+	andq	%rax, %rdx
+	movq	(%rcx,%rdx,8), %rdx
+	leaq	1(%rax), %rcx
+	lock cmpxchgq	%rcx, 64(%rsp)
+	jne	.L264
+	leaq	272(%rsp), %rax
+	cmpq	%rax, %rdx
+	jne	.L264
+	xorl	%r8d, %r8d
+	.p2align 4,,10
+	.p2align 3
+.L266:
+	movq	128(%rsp), %rcx
+	movq	136(%rsp), %rdi
+	leaq	-1(%rcx), %rax
+	movq	%rax, 128(%rsp)
+	lock orq	$0, (%rsp)
+	movq	64(%rsp), %rsi
+	cmpq	%rsi, %rax
+	jge	.L268
+	movq	%rcx, 128(%rsp)
+.L269:
+	cmpl	$197, %r8d
+	jne	.L354
+	movq	64(%rsp), %rax
+	lock orq	$0, (%rsp)
+	movq	128(%rsp), %rdx
+	cmpq	%rdx, %rax
+	jge	.L291
+	jmp	.L355
+	.p2align 4,,10
+	.p2align 3
+.L356:
+	movq	56(%rbx), %rsi
+	movq	%rbx, %rdi
+	call	*16(%rax)
+	movq	48(%rsp), %rsi
+	leaq	-80(%rbx), %rax
+	cmpq	%rsi, %rbx
+	je	.L276
+.L277:
+	movq	%rax, %rbx
+.L291:
+	movq	48(%rbx), %rax
+	testq	%rax, %rax
+	jne	.L356
+	movq	48(%rsp), %rcx
+	leaq	-80(%rbx), %rax
+	cmpq	%rcx, %rbx
+	jne	.L277
+.L276:
+	movq	136(%rsp), %rbx
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L357
+.L279:
+	movq	(%rbx), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%rbx, %rsi
+	movl	$8, %ecx
+	xorl	%ebx, %ebx
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r13
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	$0, 160(%rsp)
+	jne	.L281
+	jmp	.L287
+	.p2align 4,,10
+	.p2align 3
+.L285:
+	movq	(%r12), %rax
+	movl	$8, %ecx
+	movq	%r12, %rsi
+	addq	$1, %rbx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	160(%rsp), %rbx
+	jnb	.L287
+.L281:
+	movq	144(%rsp), %rax
+	movq	(%rax,%rbx,8), %r12
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L285
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L285
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r13, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L285
+	.p2align 4,,10
+	.p2align 3
+.L268:
+	movq	(%rdi), %rdx
+	movq	8(%rdi), %rdi
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%rdi,%rdx,8), %rdx
+	cmpq	%rsi, %rax
+	je	.L270
+.L271:
+	addl	$1, %r8d
+	jmp	.L266
+.L287:
+	movq	144(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L228
+	movq	152(%rsp), %rax
+	movq	168(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L228:
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.L270:
+	.cfi_restore_state
+	lock cmpxchgq	%rcx, 64(%rsp)
+	movq	%rcx, 128(%rsp)
+	je	.L271
+	jmp	.L269
+	.p2align 4,,10
+	.p2align 3
+.L355:
+	movq	136(%rsp), %rcx
+	movq	(%rcx), %rsi
+	movq	8(%rcx), %rcx
+	leaq	-1(%rsi), %rdx
+	andq	%rax, %rdx
+	movq	(%rcx,%rdx,8), %rdx
+	leaq	1(%rax), %rdx
+	lock cmpxchgq	%rdx, 64(%rsp)
+	je	.L341
+	jmp	.L291
+	.p2align 4,,10
+	.p2align 3
+.L357:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L279
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L279
+.L348:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L233
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L233
+.L347:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L230
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L230
+.L353:
+	lock cmpxchgq	%rdx, 64(%rsp)
+	movq	%rdx, 128(%rsp)
+	je	.L255
+	jmp	.L254
+.L354:
+	jmp	.L292
+.L301:
+	movq	%rax, %rbx
+	jmp	.L288
+.L300:
+	movq	%rax, %rbx
+	jmp	.L288
+.L299:
+	movq	%rax, %rbx
+	jmp	.L288
+.L297:
+	movq	%rax, %rbx
+	jmp	.L288
+	.section	.gcc_except_table
+.LLSDA6802:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6802-.LLSDACSB6802
+.LLSDACSB6802:
+	.uleb128 .LEHB12-.LFB6802
+	.uleb128 .LEHE12-.LEHB12
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB13-.LFB6802
+	.uleb128 .LEHE13-.LEHB13
+	.uleb128 .L300-.LFB6802
+	.uleb128 0
+	.uleb128 .LEHB14-.LFB6802
+	.uleb128 .LEHE14-.LEHB14
+	.uleb128 .L301-.LFB6802
+	.uleb128 0
+	.uleb128 .LEHB15-.LFB6802
+	.uleb128 .LEHE15-.LEHB15
+	.uleb128 .L297-.LFB6802
+	.uleb128 0
+	.uleb128 .LEHB16-.LFB6802
+	.uleb128 .LEHE16-.LEHB16
+	.uleb128 .L299-.LFB6802
+	.uleb128 0
+.LLSDACSE6802:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6802
+	.type	_Z17test_deque_ordersv.cold, @function
+_Z17test_deque_ordersv.cold:
+.LFSB6802:
+.L341:
+	.cfi_def_cfa 6, 16
+	.cfi_offset 3, -56
+	.cfi_offset 6, -16
+	.cfi_offset 12, -48
+	.cfi_offset 13, -40
+	.cfi_offset 14, -32
+	.cfi_offset 15, -24
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC13(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB17:
+	call	__cxa_throw@PLT
+.LEHE17:
+.L292:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC12(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB18:
+	call	__cxa_throw@PLT
+.LEHE18:
+.L296:
+.L346:
+	movq	%rax, %rbx
+	leaq	16192(%rsp), %r12
+.L290:
+	movq	-32(%r12), %rax
+	subq	$80, %r12
+	testq	%rax, %rax
+	je	.L289
+	movq	56(%r12), %rsi
+	movq	%r12, %rdi
+	call	*16(%rax)
+.L289:
+	movq	48(%rsp), %rax
+	cmpq	%rax, %r12
+	jne	.L290
+	leaq	64(%rsp), %rdi
+	call	_ZN1n10__ws_dequeD1Ev
+	movq	%rbx, %rdi
+.LEHB19:
+	call	_Unwind_Resume@PLT
+.LEHE19:
+.L303:
+	jmp	.L346
+.L288:
+	leaq	16192(%rsp), %r12
+	jmp	.L290
+.L264:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC11(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB20:
+	call	__cxa_throw@PLT
+.LEHE20:
+.L259:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC10(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB21:
+	call	__cxa_throw@PLT
+.LEHE21:
+.L302:
+	jmp	.L346
+.L298:
+	jmp	.L346
+	.cfi_endproc
+.LFE6802:
+	.section	.gcc_except_table
+.LLSDAC6802:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6802-.LLSDACSBC6802
+.LLSDACSBC6802:
+	.uleb128 .LEHB17-.LCOLDB14
+	.uleb128 .LEHE17-.LEHB17
+	.uleb128 .L296-.LCOLDB14
+	.uleb128 0
+	.uleb128 .LEHB18-.LCOLDB14
+	.uleb128 .LEHE18-.LEHB18
+	.uleb128 .L303-.LCOLDB14
+	.uleb128 0
+	.uleb128 .LEHB19-.LCOLDB14
+	.uleb128 .LEHE19-.LEHB19
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB20-.LCOLDB14
+	.uleb128 .LEHE20-.LEHB20
+	.uleb128 .L302-.LCOLDB14
+	.uleb128 0
+	.uleb128 .LEHB21-.LCOLDB14
+	.uleb128 .LEHE21-.LEHB21
+	.uleb128 .L298-.LCOLDB14
+	.uleb128 0
+.LLSDACSEC6802:
+	.section	.text.unlikely
+	.text
+	.size	_Z17test_deque_ordersv, .-_Z17test_deque_ordersv
+	.section	.text.unlikely
+	.size	_Z17test_deque_ordersv.cold, .-_Z17test_deque_ordersv.cold
+.LCOLDE14:
+	.text
+.LHOTE14:
+	.section	.text._ZN1n11thread_poolD2Ev,"axG",@progbits,_ZN1n11thread_poolD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n11thread_poolD2Ev
+	.type	_ZN1n11thread_poolD2Ev, @function
+_ZN1n11thread_poolD2Ev:
+.LFB6747:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6747
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leaq	120(%rdi), %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	movq	%r15, %rdi
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	%r15, (%rsp)
+	call	pthread_mutex_lock@PLT
+	movb	$1, 224(%rbx)
+	lock addq	$1, 208(%rbx)
+	xorl	%ebp, %ebp
+	leaq	160(%rbx), %rax
+	movq	%rax, %rdi
+	movq	%rax, 8(%rsp)
+	call	pthread_cond_broadcast@PLT
+	movq	%r15, %rdi
+	call	pthread_mutex_unlock@PLT
+	cmpq	$0, 16(%rbx)
+	je	.L362
+	.p2align 4,,10
+	.p2align 3
+.L359:
+	movq	(%rbx), %rax
+	xorl	%esi, %esi
+	movq	(%rax,%rbp,8), %rax
+	addq	$1, %rbp
+	movq	24(%rax), %rdi
+	call	pthread_join@PLT
+	movq	16(%rbx), %rax
+	cmpq	%rax, %rbp
+	jb	.L359
+	testq	%rax, %rax
+	je	.L362
+	xorl	%r12d, %r12d
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	.p2align 4,,10
+	.p2align 3
+.L376:
+	movq	(%rbx), %rax
+	movq	(%rax,%r12,8), %r15
+	movq	136(%r15), %r13
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L402
+.L364:
+	movq	0(%r13), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%r13, %rsi
+	movl	$8, %ecx
+	xorl	%r13d, %r13d
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	$0, 160(%r15)
+	jne	.L366
+	jmp	.L372
+	.p2align 4,,10
+	.p2align 3
+.L370:
+	movq	(%r14), %rax
+	movl	$8, %ecx
+	movq	%r14, %rsi
+	addq	$1, %r13
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	160(%r15), %r13
+	jnb	.L372
+.L366:
+	movq	144(%r15), %rax
+	movq	(%rax,%r13,8), %r14
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L370
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L370
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L370
+	.p2align 4,,10
+	.p2align 3
+.L372:
+	movq	144(%r15), %rsi
+	testq	%rsi, %rsi
+	je	.L368
+	movq	152(%r15), %rax
+	movq	168(%r15), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L368:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L403
+.L374:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$64, %ecx
+	movl	$192, %edx
+	movq	%r15, %rsi
+	addq	$1, %r12
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	16(%rbx), %r12
+	jb	.L376
+.L362:
+	movq	8(%rsp), %rdi
+	call	pthread_cond_destroy@PLT
+	movq	(%rsp), %rdi
+	call	pthread_mutex_destroy@PLT
+	leaq	32(%rbx), %rdi
+	call	pthread_mutex_destroy@PLT
+	movq	72(%rbx), %rsi
+	testq	%rsi, %rsi
+	je	.L361
+	movq	80(%rbx), %rax
+	movq	96(%rbx), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L361:
+	movq	(%rbx), %rsi
+	testq	%rsi, %rsi
+	je	.L358
+	movq	24(%rbx), %rdi
+	movq	8(%rbx), %rdx
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	salq	$3, %rdx
+	call	*24(%rax)
+.L358:
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L403:
+	.cfi_restore_state
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L374
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L374
+	.p2align 4,,10
+	.p2align 3
+.L402:
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L364
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L364
+	.cfi_endproc
+.LFE6747:
+	.section	.gcc_except_table
+.LLSDA6747:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6747-.LLSDACSB6747
+.LLSDACSB6747:
+.LLSDACSE6747:
+	.section	.text._ZN1n11thread_poolD2Ev,"axG",@progbits,_ZN1n11thread_poolD5Ev,comdat
+	.size	_ZN1n11thread_poolD2Ev, .-_ZN1n11thread_poolD2Ev
+	.weak	_ZN1n11thread_poolD1Ev
+	.set	_ZN1n11thread_poolD1Ev,_ZN1n11thread_poolD2Ev
+	.section	.text._ZN1n10task_group4syncEv,"axG",@progbits,_ZN1n10task_group4syncEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n10task_group4syncEv
+	.type	_ZN1n10task_group4syncEv, @function
+_ZN1n10task_group4syncEv:
+.LFB6762:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6762
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	leaq	8(%rdi), %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$88, %rsp
+	.cfi_def_cfa_offset 144
+	.p2align 4,,10
+	.p2align 3
+.L405:
+	movq	(%r12), %rax
+	testq	%rax, %rax
+	je	.L449
+.L428:
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %rbx
+	movq	0(%rbp), %r13
+	testq	%rbx, %rbx
+	je	.L406
+	cmpq	(%rbx), %r13
+	jne	.L407
+	movq	128(%rbx), %rcx
+	movq	136(%rbx), %rdi
+	leaq	64(%rbx), %r8
+	leaq	128(%rbx), %r9
+	leaq	-1(%rcx), %rax
+	movq	%rax, 128(%rbx)
+	lock orq	$0, (%rsp)
+	movq	64(%rbx), %rsi
+	cmpq	%rsi, %rax
+	jge	.L408
+	movq	%rcx, 128(%rbx)
+.L409:
+	movq	112(%r13), %rax
+	leaq	112(%r13), %r15
+	testq	%rax, %rax
+	jne	.L413
+	movq	16(%r13), %rsi
+.L416:
+	movq	16(%rbx), %rdx
+	movq	%rdx, %rax
+	salq	$13, %rax
+	xorq	%rdx, %rax
+	movq	%rax, %rdx
+	shrq	$7, %rdx
+	xorq	%rax, %rdx
+	movq	%rdx, %rax
+	salq	$17, %rax
+	xorq	%rdx, %rax
+	xorl	%edx, %edx
+	movq	%rax, 16(%rbx)
+	divq	%rsi
+	movq	%rdx, %rcx
+.L414:
+	leaq	(%rcx,%rsi), %r8
+	testq	%rsi, %rsi
+	jne	.L423
+	jmp	.L424
+	.p2align 4,,10
+	.p2align 3
+.L421:
+	addq	$1, %rcx
+	cmpq	%r8, %rcx
+	je	.L424
+.L423:
+	movq	%rcx, %rax
+	xorl	%edx, %edx
+	divq	%rsi
+	movq	0(%r13), %rax
+	movq	(%rax,%rdx,8), %rdx
+	cmpq	%rbx, %rdx
+	je	.L421
+	movq	64(%rdx), %rax
+	leaq	64(%rdx), %r9
+	lock orq	$0, (%rsp)
+	movq	128(%rdx), %rdi
+	cmpq	%rdi, %rax
+	jge	.L421
+	movq	136(%rdx), %rdi
+	movq	(%rdi), %rdx
+	movq	8(%rdi), %rdi
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%rdi,%rdx,8), %r14
+	leaq	1(%rax), %rdx
+	lock cmpxchgq	%rdx, (%r9)
+	jne	.L421
+.L411:
+	movq	48(%r14), %rax
+	movq	%r14, %rdi
+	leaq	16(%rsp), %rbx
+.LEHB22:
+	call	*(%rax)
+.LEHE22:
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 16(%rsp)
+	movaps	%xmm0, 32(%rsp)
+	movaps	%xmm0, 48(%rsp)
+	movaps	%xmm0, 64(%rsp)
+	cmpq	%rbx, %r14
+	je	.L425
+	movq	48(%r14), %rax
+	testq	%rax, %rax
+	je	.L425
+	movq	56(%r14), %rsi
+	movq	%r14, %rdi
+.LEHB23:
+	call	*16(%rax)
+	movq	$0, 48(%r14)
+	movq	64(%rsp), %rax
+	testq	%rax, %rax
+	je	.L425
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	call	*8(%rax)
+.LEHE23:
+	movdqa	64(%rsp), %xmm1
+	movaps	%xmm1, 48(%r14)
+.L425:
+	movq	64(%r14), %rax
+	lock subq	$1, (%rax)
+	movq	(%r12), %rax
+	testq	%rax, %rax
+	jne	.L428
+.L449:
+	addq	$88, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L424:
+	.cfi_restore_state
+	call	sched_yield@PLT
+	jmp	.L405
+	.p2align 4,,10
+	.p2align 3
+.L407:
+	movq	112(%r13), %rcx
+	leaq	112(%r13), %r15
+	testq	%rcx, %rcx
+	jne	.L430
+	movq	16(%r13), %rsi
+	xorl	%ebx, %ebx
+	jmp	.L414
+	.p2align 4,,10
+	.p2align 3
+.L430:
+	xorl	%ebx, %ebx
+.L413:
+	leaq	32(%r13), %rdi
+	movq	%rdi, 8(%rsp)
+	call	pthread_mutex_lock@PLT
+	movq	104(%r13), %rax
+	cmpq	88(%r13), %rax
+	movq	8(%rsp), %rdi
+	jne	.L415
+	call	pthread_mutex_unlock@PLT
+	movq	16(%r13), %rsi
+	testq	%rbx, %rbx
+	jne	.L416
+	xorl	%ecx, %ecx
+	jmp	.L414
+	.p2align 4,,10
+	.p2align 3
+.L408:
+	movq	(%rdi), %rdx
+	movq	8(%rdi), %rdi
+	subq	$1, %rdx
+	andq	%rax, %rdx
+	movq	(%rdi,%rdx,8), %r14
+	cmpq	%rsi, %rax
+	jne	.L411
+	lock cmpxchgq	%rcx, (%r8)
+	movq	%rcx, (%r9)
+	je	.L411
+	jmp	.L409
+	.p2align 4,,10
+	.p2align 3
+.L406:
+	movq	112(%r13), %rcx
+	leaq	112(%r13), %r15
+	testq	%rcx, %rcx
+	jne	.L413
+	movq	16(%r13), %rsi
+	jmp	.L414
+	.p2align 4,,10
+	.p2align 3
+.L415:
+	movq	72(%r13), %rdx
+	leaq	1(%rax), %rcx
+	movq	%rcx, 104(%r13)
+	movq	(%rdx,%rax,8), %r14
+	lock subq	$1, (%r15)
+	movq	88(%r13), %rax
+	cmpq	%rax, 104(%r13)
+	jne	.L448
+	movq	$0, 88(%r13)
+	movq	$0, 104(%r13)
+.L448:
+	call	pthread_mutex_unlock@PLT
+	jmp	.L411
+.L431:
+	movq	%rax, %rbp
+.L426:
+	movq	64(%rsp), %rax
+	testq	%rax, %rax
+	je	.L427
+	movq	72(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	*16(%rax)
+.L427:
+	movq	%rbp, %rdi
+.LEHB24:
+	call	_Unwind_Resume@PLT
+.LEHE24:
+	.cfi_endproc
+.LFE6762:
+	.section	.gcc_except_table
+.LLSDA6762:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6762-.LLSDACSB6762
+.LLSDACSB6762:
+	.uleb128 .LEHB22-.LFB6762
+	.uleb128 .LEHE22-.LEHB22
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB23-.LFB6762
+	.uleb128 .LEHE23-.LEHB23
+	.uleb128 .L431-.LFB6762
+	.uleb128 0
+	.uleb128 .LEHB24-.LFB6762
+	.uleb128 .LEHE24-.LEHB24
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6762:
+	.section	.text._ZN1n10task_group4syncEv,"axG",@progbits,_ZN1n10task_group4syncEv,comdat
+	.size	_ZN1n10task_group4syncEv, .-_ZN1n10task_group4syncEv
+	.section	.text._ZN1n10task_groupD2Ev,"axG",@progbits,_ZN1n10task_groupD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n10task_groupD2Ev
+	.type	_ZN1n10task_groupD2Ev, @function
+_ZN1n10task_groupD2Ev:
+.LFB6759:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6759
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	addq	$16, %r14
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%r14, %r13
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	call	_ZN1n10task_group4syncEv
+	.p2align 4,,10
+	.p2align 3
+.L459:
+	movq	%r13, %r12
+	movq	0(%r13), %r13
+	movq	8(%r12), %rbp
+	testq	%rbp, %rbp
+	je	.L451
+	leaq	16(%r12), %rbx
+	xorl	%r15d, %r15d
+	.p2align 4,,10
+	.p2align 3
+.L454:
+	movq	48(%rbx), %rdx
+	testq	%rdx, %rdx
+	je	.L452
+	addq	$1, %r15
+	movq	56(%rbx), %rsi
+	movq	%rbx, %rdi
+	addq	$80, %rbx
+	call	*16(%rdx)
+	cmpq	%r15, %rbp
+	jne	.L454
+.L451:
+	cmpq	%r12, %r14
+	je	.L455
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L468
+.L457:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %ecx
+	movl	$656, %edx
+	movq	%r12, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L455:
+	testq	%r13, %r13
+	jne	.L459
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L452:
+	.cfi_restore_state
+	addq	$1, %r15
+	addq	$80, %rbx
+	cmpq	%r15, %rbp
+	jne	.L454
+	jmp	.L451
+	.p2align 4,,10
+	.p2align 3
+.L468:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L457
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L457
+	.cfi_endproc
+.LFE6759:
+	.section	.gcc_except_table
+.LLSDA6759:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6759-.LLSDACSB6759
+.LLSDACSB6759:
+.LLSDACSE6759:
+	.section	.text._ZN1n10task_groupD2Ev,"axG",@progbits,_ZN1n10task_groupD5Ev,comdat
+	.size	_ZN1n10task_groupD2Ev, .-_ZN1n10task_groupD2Ev
+	.weak	_ZN1n10task_groupD1Ev
+	.set	_ZN1n10task_groupD1Ev,_ZN1n10task_groupD2Ev
+	.section	.text.unlikely
+	.align 2
+.LCOLDB15:
+	.text
+.LHOTB15:
+	.align 2
+	.p2align 4
+	.type	_ZN1n11thread_pool4bulkIZZ21test_pool_nested_bulkvENKUlmE_clEmEUlmE_EEvmOT_.constprop.0, @function
+_ZN1n11thread_pool4bulkIZZ21test_pool_nested_bulkvENKUlmE_clEmEUlmE_EEvmOT_.constprop.0:
+.LFB7037:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7037
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%edx, %edx
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$776, %rsp
+	.cfi_def_cfa_offset 832
+	leaq	88(%rsp), %rcx
+	leaq	96(%rsp), %rax
+	movq	%rsi, 32(%rsp)
+	movq	%rcx, 40(%rsp)
+	leaq	80(%rsp), %rcx
+	movq	%rdi, 80(%rsp)
+	movq	$0, 88(%rsp)
+	movq	$0, 96(%rsp)
+	movq	$0, 104(%rsp)
+	movq	%rax, 16(%rsp)
+	movq	%rax, 752(%rsp)
+	movq	$0, 8(%rsp)
+	movq	%rcx, 72(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L470:
+	leaq	1(%rdx), %rcx
+	leaq	(%rdx,%rdx,4), %rdx
+	salq	$4, %rdx
+	movq	%rcx, 8(%rax)
+	leaq	16(%rax,%rdx), %rbp
+	movq	32(%rsp), %rax
+	movq	$0, 56(%rbp)
+	movq	%rax, 0(%rbp)
+	movq	8(%rsp), %rax
+	movq	%rax, 8(%rbp)
+	leaq	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZZ21test_pool_nested_bulkvENKUlmE_clEmEUlmE_EEvmOT_EUlvE_EE(%rip), %rax
+	movq	%rax, 48(%rbp)
+	movq	40(%rsp), %rax
+	movq	%rax, 64(%rbp)
+	lock addq	$1, 88(%rsp)
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %r13
+	movq	80(%rsp), %rbx
+	testq	%r13, %r13
+	je	.L475
+	cmpq	0(%r13), %rbx
+	jne	.L475
+	movq	128(%r13), %rcx
+	movq	%rcx, 24(%rsp)
+	movq	64(%r13), %rdi
+	movq	%rdi, 48(%rsp)
+	subq	%rdi, %rcx
+	movq	%rdi, %r12
+	movq	136(%r13), %r14
+	movq	(%r14), %rax
+	cmpq	%rcx, %rax
+	jle	.L538
+.L476:
+	movq	24(%rsp), %rcx
+	movq	8(%r14), %rdx
+	subq	$1, %rax
+	andq	%rcx, %rax
+	movq	%rbp, (%rdx,%rax,8)
+	movq	%rcx, %rax
+	addq	$1, %rax
+	movq	%rax, 128(%r13)
+.L487:
+	lock addq	$1, 208(%rbx)
+	movq	216(%rbx), %rax
+	testq	%rax, %rax
+	jne	.L539
+.L492:
+	addq	$1, 8(%rsp)
+	movq	8(%rsp), %rax
+	cmpq	$16, %rax
+	je	.L493
+	movq	752(%rsp), %rax
+	movq	8(%rax), %rdx
+	cmpq	$8, %rdx
+	jne	.L470
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	je	.L540
+.L471:
+	movq	%rax, 752(%rsp)
+	movq	8(%rax), %rdx
+	jmp	.L470
+	.p2align 4,,10
+	.p2align 3
+.L475:
+	leaq	32(%rbx), %r12
+	movq	%r12, %rdi
+	call	pthread_mutex_lock@PLT
+	movq	88(%rbx), %rdx
+	movq	80(%rbx), %r13
+	cmpq	%r13, %rdx
+	je	.L541
+	movq	72(%rbx), %rax
+	movq	%rbp, (%rax,%rdx,8)
+.L491:
+	addq	$1, %rdx
+	movq	%rdx, 88(%rbx)
+	lock addq	$1, 112(%rbx)
+	movq	%r12, %rdi
+	call	pthread_mutex_unlock@PLT
+	jmp	.L487
+	.p2align 4,,10
+	.p2align 3
+.L539:
+	leaq	120(%rbx), %rbp
+	movq	%rbp, %rdi
+	call	pthread_mutex_lock@PLT
+	leaq	160(%rbx), %rdi
+	call	pthread_cond_broadcast@PLT
+	movq	%rbp, %rdi
+	call	pthread_mutex_unlock@PLT
+	jmp	.L492
+	.p2align 4,,10
+	.p2align 3
+.L538:
+	addq	%rax, %rax
+	movq	%rax, 64(%rsp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L542
+.L478:
+	movq	64(%rsp), %rax
+	movq	72(%rsp), %rcx
+	movl	$8, %edx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	leaq	16(,%rax,8), %rsi
+	movq	%rcx, 56(%rsp)
+	movq	(%rdi), %rax
+.LEHB25:
+	call	*16(%rax)
+	movq	%rax, %r15
+	movq	64(%rsp), %rax
+	movq	48(%rsp), %rcx
+	movq	24(%rsp), %rsi
+	movq	%rax, (%r15)
+	leaq	16(%r15), %rax
+	movq	%rax, 8(%r15)
+	cmpq	%rcx, 24(%rsp)
+	jle	.L483
+	.p2align 4,,10
+	.p2align 3
+.L480:
+	movq	(%r14), %rax
+	movq	8(%r14), %rdx
+	subq	$1, %rax
+	andq	%r12, %rax
+	movq	(%rdx,%rax,8), %rcx
+	movq	(%r15), %rax
+	movq	8(%r15), %rdx
+	subq	$1, %rax
+	andq	%r12, %rax
+	addq	$1, %r12
+	movq	%rcx, (%rdx,%rax,8)
+	cmpq	%r12, %rsi
+	jne	.L480
+.L483:
+	movq	144(%r13), %rax
+	movq	160(%r13), %rdx
+	movq	152(%r13), %r12
+	movq	%rax, 48(%rsp)
+	cmpq	%r12, %rdx
+	je	.L543
+	movq	%r14, (%rax,%rdx,8)
+.L486:
+	addq	$1, %rdx
+	movq	%r15, %r14
+	movq	%rdx, 160(%r13)
+	movq	%r15, 136(%r13)
+	movq	(%r15), %rax
+	jmp	.L476
+	.p2align 4,,10
+	.p2align 3
+.L493:
+	leaq	80(%rsp), %rbx
+	movq	%rbx, %rdi
+	movq	%rbx, 56(%rsp)
+	call	_ZN1n10task_group4syncEv
+.LEHE25:
+	movq	%rbx, %rdi
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r14
+	call	_ZN1n10task_group4syncEv
+	movq	16(%rsp), %r13
+	.p2align 4,,10
+	.p2align 3
+.L506:
+	movq	%r13, %r12
+	xorl	%r15d, %r15d
+	movq	0(%r13), %r13
+	movq	8(%r12), %rbp
+	leaq	16(%r12), %rbx
+	testq	%rbp, %rbp
+	je	.L501
+	.p2align 4,,10
+	.p2align 3
+.L502:
+	movq	48(%rbx), %rdx
+	testq	%rdx, %rdx
+	je	.L499
+	addq	$1, %r15
+	movq	56(%rbx), %rsi
+	movq	%rbx, %rdi
+	addq	$80, %rbx
+	call	*16(%rdx)
+	cmpq	%r15, %rbp
+	jne	.L502
+.L501:
+	movq	16(%rsp), %rax
+	cmpq	%rax, %r12
+	je	.L498
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L544
+.L504:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %ecx
+	movl	$656, %edx
+	movq	%r12, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L498:
+	testq	%r13, %r13
+	jne	.L506
+	addq	$776, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L499:
+	.cfi_restore_state
+	addq	$1, %r15
+	addq	$80, %rbx
+	cmpq	%r15, %rbp
+	jne	.L502
+	jmp	.L501
+	.p2align 4,,10
+	.p2align 3
+.L544:
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L504
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r14, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L504
+	.p2align 4,,10
+	.p2align 3
+.L541:
+	leaq	5(%r13), %rsi
+	movq	96(%rbx), %rdi
+	leaq	80(%rsp), %rcx
+	movq	72(%rbx), %r14
+	leaq	(%rsi,%rsi), %rax
+	movq	%rcx, 56(%rsp)
+	salq	$4, %rsi
+	movl	$8, %edx
+	movq	%rax, 80(%rbx)
+	movq	(%rdi), %rax
+.LEHB26:
+	call	*16(%rax)
+	movq	88(%rbx), %rdx
+	movq	%rax, %rdi
+	movq	%rax, 72(%rbx)
+	movq	%rbp, (%rdi,%rdx,8)
+	leaq	0(,%rdx,8), %rax
+	testq	%rdx, %rdx
+	jne	.L545
+	testq	%r14, %r14
+	je	.L491
+.L490:
+	movq	96(%rbx), %rdi
+	leaq	80(%rsp), %rcx
+	leaq	0(,%r13,8), %rdx
+	movq	%r14, %rsi
+	movq	%rcx, 56(%rsp)
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	88(%rbx), %rdx
+	jmp	.L491
+.L540:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L546
+.L473:
+	leaq	80(%rsp), %rcx
+	movl	$16, %edx
+	movl	$656, %esi
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%rcx, 56(%rsp)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, %rdx
+	movl	$82, %ecx
+	xorl	%eax, %eax
+	movq	%rdx, %rdi
+	rep stosq
+	movq	752(%rsp), %rax
+	movq	%rdx, (%rax)
+	movq	752(%rsp), %rax
+	movq	(%rax), %rax
+	jmp	.L471
+.L542:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r15
+	movq	%r15, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L478
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r15, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L478
+.L545:
+	movq	%rax, %rdx
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L490
+.L543:
+	leaq	5(%r12), %rsi
+	leaq	80(%rsp), %rcx
+	movl	$8, %edx
+	movq	168(%r13), %rdi
+	leaq	(%rsi,%rsi), %rax
+	movq	%rcx, 56(%rsp)
+	salq	$4, %rsi
+	movq	%rax, 152(%r13)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	160(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, 144(%r13)
+	movq	%r14, (%rdi,%rdx,8)
+	leaq	0(,%rdx,8), %rax
+	testq	%rdx, %rdx
+	jne	.L547
+	cmpq	$0, 48(%rsp)
+	je	.L486
+.L485:
+	movq	168(%r13), %rdi
+	leaq	80(%rsp), %rcx
+	movq	48(%rsp), %rsi
+	leaq	0(,%r12,8), %rdx
+	movq	%rcx, 56(%rsp)
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE26:
+	movq	160(%r13), %rdx
+	jmp	.L486
+.L547:
+	movq	48(%rsp), %rsi
+	movq	%rax, %rdx
+	call	memcpy@PLT
+	jmp	.L485
+.L546:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L473
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L473
+.L508:
+	movq	%rax, %rbx
+	jmp	.L507
+	.section	.gcc_except_table
+.LLSDA7037:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7037-.LLSDACSB7037
+.LLSDACSB7037:
+	.uleb128 .LEHB25-.LFB7037
+	.uleb128 .LEHE25-.LEHB25
+	.uleb128 .L508-.LFB7037
+	.uleb128 0
+	.uleb128 .LEHB26-.LFB7037
+	.uleb128 .LEHE26-.LEHB26
+	.uleb128 .L508-.LFB7037
+	.uleb128 0
+.LLSDACSE7037:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7037
+	.type	_ZN1n11thread_pool4bulkIZZ21test_pool_nested_bulkvENKUlmE_clEmEUlmE_EEvmOT_.constprop.0.cold, @function
+_ZN1n11thread_pool4bulkIZZ21test_pool_nested_bulkvENKUlmE_clEmEUlmE_EEvmOT_.constprop.0.cold:
+.LFSB7037:
+.L507:
+	.cfi_def_cfa_offset 832
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	56(%rsp), %rdi
+	call	_ZN1n10task_groupD1Ev
+	movq	%rbx, %rdi
+.LEHB27:
+	call	_Unwind_Resume@PLT
+.LEHE27:
+	.cfi_endproc
+.LFE7037:
+	.section	.gcc_except_table
+.LLSDAC7037:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7037-.LLSDACSBC7037
+.LLSDACSBC7037:
+	.uleb128 .LEHB27-.LCOLDB15
+	.uleb128 .LEHE27-.LEHB27
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC7037:
+	.section	.text.unlikely
+	.text
+	.size	_ZN1n11thread_pool4bulkIZZ21test_pool_nested_bulkvENKUlmE_clEmEUlmE_EEvmOT_.constprop.0, .-_ZN1n11thread_pool4bulkIZZ21test_pool_nested_bulkvENKUlmE_clEmEUlmE_EEvmOT_.constprop.0
+	.section	.text.unlikely
+	.size	_ZN1n11thread_pool4bulkIZZ21test_pool_nested_bulkvENKUlmE_clEmEUlmE_EEvmOT_.constprop.0.cold, .-_ZN1n11thread_pool4bulkIZZ21test_pool_nested_bulkvENKUlmE_clEmEUlmE_EEvmOT_.constprop.0.cold
+.LCOLDE15:
+	.text
+.LHOTE15:
+	.p2align 4
+	.type	_ZN1n4taskUlPvE17_4_FUNES1_, @function
+_ZN1n4taskUlPvE17_4_FUNES1_:
+.LFB6991:
+	.cfi_startproc
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 32
+	movq	(%rdi), %rax
+	movq	8(%rdi), %rcx
+	movq	%rsp, %rsi
+	movq	(%rax), %rdx
+	movq	8(%rax), %rax
+	movq	%rcx, (%rsp)
+	movq	%rdx, %rdi
+	movq	%rax, 8(%rsp)
+	call	_ZN1n11thread_pool4bulkIZZ21test_pool_nested_bulkvENKUlmE_clEmEUlmE_EEvmOT_.constprop.0
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE6991:
+	.size	_ZN1n4taskUlPvE17_4_FUNES1_, .-_ZN1n4taskUlPvE17_4_FUNES1_
+	.section	.rodata.str1.8
+	.align 8
+.LC16:
+	.string	"expected equal : expected value : sum, actual value : 50005000"
+	.section	.text.unlikely
+.LCOLDB17:
+	.text
+.LHOTB17:
+	.p2align 4
+	.globl	_Z20test_pool_many_tasksv
+	.type	_Z20test_pool_many_tasksv, @function
+_Z20test_pool_many_tasksv:
+.LFB6812:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6812
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$1016, %rsp
+	.cfi_def_cfa_offset 1072
+	leaq	80(%rsp), %rax
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	movq	%rax, 56(%rsp)
+.LEHB28:
+	call	_ZN1n11thread_poolC2Em.constprop.2
+.LEHE28:
+	leaq	336(%rsp), %rax
+	xorl	%edx, %edx
+	leaq	72(%rsp), %rdi
+	leaq	328(%rsp), %rcx
+	movq	$0, 72(%rsp)
+	movq	%rbx, 320(%rsp)
+	movq	$0, 328(%rsp)
+	movq	$0, 336(%rsp)
+	movq	$0, 344(%rsp)
+	movq	%rax, 48(%rsp)
+	movq	%rax, 992(%rsp)
+	movq	$1, (%rsp)
+	movq	%rdi, 16(%rsp)
+	movq	%rcx, 24(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L551:
+	leaq	1(%rdx), %rcx
+	leaq	(%rdx,%rdx,4), %rdx
+	salq	$4, %rdx
+	movq	%rcx, 8(%rax)
+	leaq	16(%rax,%rdx), %rbp
+	movq	16(%rsp), %rax
+	movq	$0, 56(%rbp)
+	movq	%rax, 0(%rbp)
+	movq	(%rsp), %rax
+	movq	%rax, 8(%rbp)
+	leaq	_ZN1n4task8__ops_ofIZ20test_pool_many_tasksvEUlvE_EE(%rip), %rax
+	movq	%rax, 48(%rbp)
+	movq	24(%rsp), %rax
+	movq	%rax, 64(%rbp)
+	lock addq	$1, 328(%rsp)
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %r13
+	movq	320(%rsp), %rbx
+	testq	%r13, %r13
+	je	.L556
+	cmpq	0(%r13), %rbx
+	jne	.L556
+	movq	128(%r13), %rcx
+	movq	%rcx, 8(%rsp)
+	movq	64(%r13), %rsi
+	movq	%rsi, 32(%rsp)
+	subq	%rsi, %rcx
+	movq	%rsi, %r12
+	movq	136(%r13), %r14
+	movq	(%r14), %rax
+	cmpq	%rcx, %rax
+	jle	.L664
+.L557:
+	movq	8(%rsp), %rcx
+	movq	8(%r14), %rdx
+	subq	$1, %rax
+	andq	%rcx, %rax
+	movq	%rbp, (%rdx,%rax,8)
+	movq	%rcx, %rax
+	addq	$1, %rax
+	movq	%rax, 128(%r13)
+.L568:
+	lock addq	$1, 208(%rbx)
+	movq	216(%rbx), %rax
+	testq	%rax, %rax
+	jne	.L665
+.L573:
+	addq	$1, (%rsp)
+	movq	(%rsp), %rax
+	cmpq	$10001, %rax
+	je	.L574
+	movq	992(%rsp), %rax
+	movq	8(%rax), %rdx
+	cmpq	$8, %rdx
+	jne	.L551
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	je	.L666
+.L552:
+	movq	%rax, 992(%rsp)
+	movq	8(%rax), %rdx
+	jmp	.L551
+	.p2align 4,,10
+	.p2align 3
+.L556:
+	leaq	32(%rbx), %r12
+	movq	%r12, %rdi
+	call	pthread_mutex_lock@PLT
+	movq	88(%rbx), %rdx
+	movq	80(%rbx), %r13
+	cmpq	%r13, %rdx
+	je	.L667
+	movq	72(%rbx), %rax
+	movq	%rbp, (%rax,%rdx,8)
+.L572:
+	addq	$1, %rdx
+	movq	%rdx, 88(%rbx)
+	lock addq	$1, 112(%rbx)
+	movq	%r12, %rdi
+	call	pthread_mutex_unlock@PLT
+	jmp	.L568
+	.p2align 4,,10
+	.p2align 3
+.L665:
+	leaq	120(%rbx), %rbp
+	movq	%rbp, %rdi
+	call	pthread_mutex_lock@PLT
+	leaq	160(%rbx), %rdi
+	call	pthread_cond_broadcast@PLT
+	movq	%rbp, %rdi
+	call	pthread_mutex_unlock@PLT
+	jmp	.L573
+	.p2align 4,,10
+	.p2align 3
+.L664:
+	addq	%rax, %rax
+	movq	%rax, 40(%rsp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L668
+.L559:
+	movq	40(%rsp), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$8, %edx
+	leaq	16(,%rax,8), %rsi
+	movq	(%rdi), %rax
+.LEHB29:
+	call	*16(%rax)
+	movq	%rax, %r15
+	movq	40(%rsp), %rax
+	movq	32(%rsp), %rsi
+	movq	%rax, (%r15)
+	leaq	16(%r15), %rax
+	movq	%rax, 8(%r15)
+	cmpq	%rsi, 8(%rsp)
+	jle	.L564
+	movq	8(%rsp), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L561:
+	movq	(%r14), %rax
+	movq	8(%r14), %rdx
+	subq	$1, %rax
+	andq	%r12, %rax
+	movq	(%rdx,%rax,8), %rcx
+	movq	(%r15), %rax
+	movq	8(%r15), %rdx
+	subq	$1, %rax
+	andq	%r12, %rax
+	addq	$1, %r12
+	movq	%rcx, (%rdx,%rax,8)
+	cmpq	%r12, %rsi
+	jne	.L561
+.L564:
+	movq	144(%r13), %rax
+	movq	160(%r13), %rdx
+	movq	152(%r13), %r12
+	movq	%rax, 32(%rsp)
+	cmpq	%r12, %rdx
+	je	.L669
+	movq	%r14, (%rax,%rdx,8)
+.L567:
+	addq	$1, %rdx
+	movq	%r15, %r14
+	movq	%rdx, 160(%r13)
+	movq	%r15, 136(%r13)
+	movq	(%r15), %rax
+	jmp	.L557
+	.p2align 4,,10
+	.p2align 3
+.L667:
+	leaq	5(%r13), %rsi
+	movq	96(%rbx), %rdi
+	movq	72(%rbx), %r14
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 80(%rbx)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	88(%rbx), %rdx
+	movq	%rax, %rdi
+	movq	%rax, 72(%rbx)
+	movq	%rbp, (%rdi,%rdx,8)
+	leaq	0(,%rdx,8), %rax
+	testq	%rdx, %rdx
+	jne	.L670
+	testq	%r14, %r14
+	je	.L572
+.L571:
+	movq	96(%rbx), %rdi
+	leaq	0(,%r13,8), %rdx
+	movl	$8, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	88(%rbx), %rdx
+	jmp	.L572
+	.p2align 4,,10
+	.p2align 3
+.L666:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L671
+.L554:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %edx
+	movl	$656, %esi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, %rdx
+	movq	%rax, %rdi
+	movl	$82, %ecx
+	xorl	%eax, %eax
+	rep stosq
+	movq	992(%rsp), %rax
+	movq	%rdx, (%rax)
+	movq	992(%rsp), %rax
+	movq	(%rax), %rax
+	jmp	.L552
+	.p2align 4,,10
+	.p2align 3
+.L668:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L559
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L559
+	.p2align 4,,10
+	.p2align 3
+.L670:
+	movq	%rax, %rdx
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L571
+	.p2align 4,,10
+	.p2align 3
+.L669:
+	leaq	5(%r12), %rsi
+	movq	168(%r13), %rdi
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 152(%r13)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	160(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, 144(%r13)
+	movq	%r14, (%rdi,%rdx,8)
+	leaq	0(,%rdx,8), %rax
+	testq	%rdx, %rdx
+	jne	.L672
+	cmpq	$0, 32(%rsp)
+	je	.L567
+.L566:
+	movq	168(%r13), %rdi
+	movq	32(%rsp), %rsi
+	movl	$8, %ecx
+	leaq	0(,%r12,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE29:
+	movq	160(%r13), %rdx
+	jmp	.L567
+	.p2align 4,,10
+	.p2align 3
+.L671:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L554
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L554
+.L574:
+	leaq	320(%rsp), %rdi
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r13
+	call	_ZN1n10task_group4syncEv
+	movq	48(%rsp), %r12
+	.p2align 4,,10
+	.p2align 3
+.L587:
+	movq	%r12, %r14
+	xorl	%r15d, %r15d
+	movq	(%r12), %r12
+	movq	8(%r14), %rbp
+	leaq	16(%r14), %rbx
+	testq	%rbp, %rbp
+	je	.L582
+	.p2align 4,,10
+	.p2align 3
+.L583:
+	movq	48(%rbx), %rdx
+	testq	%rdx, %rdx
+	je	.L580
+	addq	$1, %r15
+	movq	56(%rbx), %rsi
+	movq	%rbx, %rdi
+	addq	$80, %rbx
+	call	*16(%rdx)
+	cmpq	%rbp, %r15
+	jne	.L583
+.L582:
+	movq	48(%rsp), %rax
+	cmpq	%rax, %r14
+	je	.L579
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L673
+.L585:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %ecx
+	movl	$656, %edx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L579:
+	testq	%r12, %r12
+	jne	.L587
+	cmpq	$50005000, 72(%rsp)
+	jne	.L659
+	leaq	200(%rsp), %r14
+	movq	%r14, %rdi
+	call	pthread_mutex_lock@PLT
+	movb	$1, 304(%rsp)
+	lock addq	$1, 288(%rsp)
+	xorl	%ebx, %ebx
+	leaq	240(%rsp), %r15
+	movq	%r15, %rdi
+	call	pthread_cond_broadcast@PLT
+	movq	%r14, %rdi
+	call	pthread_mutex_unlock@PLT
+	cmpq	$0, 96(%rsp)
+	je	.L592
+	.p2align 4,,10
+	.p2align 3
+.L589:
+	movq	80(%rsp), %rax
+	xorl	%esi, %esi
+	movq	(%rax,%rbx,8), %rax
+	addq	$1, %rbx
+	movq	24(%rax), %rdi
+	call	pthread_join@PLT
+	movq	96(%rsp), %rax
+	cmpq	%rax, %rbx
+	jb	.L589
+	testq	%rax, %rax
+	je	.L592
+	movq	%r14, (%rsp)
+	xorl	%ebp, %ebp
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %r13
+	movq	%r15, 8(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L606:
+	movq	80(%rsp), %rax
+	movq	(%rax,%rbp,8), %r14
+	movq	136(%r14), %r12
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L674
+.L594:
+	movq	(%r12), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%r12, %rsi
+	movl	$8, %ecx
+	xorl	%r12d, %r12d
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	$0, 160(%r14)
+	jne	.L596
+	jmp	.L602
+	.p2align 4,,10
+	.p2align 3
+.L600:
+	movq	(%r15), %rax
+	movl	$8, %ecx
+	movq	%r15, %rsi
+	addq	$1, %r12
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	160(%r14), %r12
+	jnb	.L602
+.L596:
+	movq	144(%r14), %rax
+	movq	(%rax,%r12,8), %r15
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L600
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L600
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%r13, _ZZN1n4heapEvE7storage(%rip)
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L600
+	.p2align 4,,10
+	.p2align 3
+.L580:
+	addq	$1, %r15
+	addq	$80, %rbx
+	cmpq	%r15, %rbp
+	jne	.L583
+	jmp	.L582
+	.p2align 4,,10
+	.p2align 3
+.L602:
+	movq	144(%r14), %rsi
+	testq	%rsi, %rsi
+	je	.L598
+	movq	152(%r14), %rax
+	movq	168(%r14), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L598:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L675
+.L604:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$64, %ecx
+	movl	$192, %edx
+	movq	%r14, %rsi
+	addq	$1, %rbp
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	96(%rsp), %rbp
+	jb	.L606
+	movq	(%rsp), %r14
+	movq	8(%rsp), %r15
+.L592:
+	movq	%r15, %rdi
+	call	pthread_cond_destroy@PLT
+	movq	%r14, %rdi
+	call	pthread_mutex_destroy@PLT
+	leaq	112(%rsp), %rdi
+	call	pthread_mutex_destroy@PLT
+	movq	152(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L591
+	movq	160(%rsp), %rax
+	movq	176(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L591:
+	movq	80(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L550
+	movq	88(%rsp), %rax
+	movq	104(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L550:
+	addq	$1016, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L675:
+	.cfi_restore_state
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L604
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L604
+	.p2align 4,,10
+	.p2align 3
+.L674:
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L594
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L594
+	.p2align 4,,10
+	.p2align 3
+.L673:
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L585
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r13, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L585
+.L672:
+	movq	32(%rsp), %rsi
+	movq	%rax, %rdx
+	call	memcpy@PLT
+	jmp	.L566
+.L612:
+	movq	%rax, %rbx
+	jmp	.L608
+	.section	.gcc_except_table
+.LLSDA6812:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6812-.LLSDACSB6812
+.LLSDACSB6812:
+	.uleb128 .LEHB28-.LFB6812
+	.uleb128 .LEHE28-.LEHB28
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB29-.LFB6812
+	.uleb128 .LEHE29-.LEHB29
+	.uleb128 .L612-.LFB6812
+	.uleb128 0
+.LLSDACSE6812:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6812
+	.type	_Z20test_pool_many_tasksv.cold, @function
+_Z20test_pool_many_tasksv.cold:
+.LFSB6812:
+.L659:
+	.cfi_def_cfa_offset 1072
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC16(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB30:
+	call	__cxa_throw@PLT
+.LEHE30:
+.L613:
+	movq	%rax, %rbx
+	jmp	.L609
+.L608:
+	leaq	320(%rsp), %rdi
+	call	_ZN1n10task_groupD1Ev
+.L609:
+	movq	56(%rsp), %rdi
+	call	_ZN1n11thread_poolD1Ev
+	movq	%rbx, %rdi
+.LEHB31:
+	call	_Unwind_Resume@PLT
+.LEHE31:
+	.cfi_endproc
+.LFE6812:
+	.section	.gcc_except_table
+.LLSDAC6812:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6812-.LLSDACSBC6812
+.LLSDACSBC6812:
+	.uleb128 .LEHB30-.LCOLDB17
+	.uleb128 .LEHE30-.LEHB30
+	.uleb128 .L613-.LCOLDB17
+	.uleb128 0
+	.uleb128 .LEHB31-.LCOLDB17
+	.uleb128 .LEHE31-.LEHB31
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6812:
+	.section	.text.unlikely
+	.text
+	.size	_Z20test_pool_many_tasksv, .-_Z20test_pool_many_tasksv
+	.section	.text.unlikely
+	.size	_Z20test_pool_many_tasksv.cold, .-_Z20test_pool_many_tasksv.cold
+.LCOLDE17:
+	.text
+.LHOTE17:
+	.section	.rodata.str1.8
+	.align 8
+.LC18:
+	.string	"expected equal : expected value : count, actual value : 10"
+	.align 8
+.LC19:
+	.string	"expected equal : expected value : pool.workers(), actual value : 1"
+	.section	.text.unlikely
+.LCOLDB20:
+	.text
+.LHOTB20:
+	.p2align 4
+	.globl	_Z25test_pool_without_workersv
+	.type	_Z25test_pool_without_workersv, @function
+_Z25test_pool_without_workersv:
+.LFB6817:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6817
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$1032, %rsp
+	.cfi_def_cfa_offset 1088
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L805
+.L678:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	pxor	%xmm0, %xmm0
+	movq	$0, 96(%rsp)
+	movups	%xmm0, 104(%rsp)
+	pxor	%xmm0, %xmm0
+	movq	%rax, 120(%rsp)
+	movq	$0, 160(%rsp)
+	movaps	%xmm0, 128(%rsp)
+	movaps	%xmm0, 144(%rsp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L806
+.L681:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	pxor	%xmm0, %xmm0
+	xorl	%edx, %edx
+	leaq	88(%rsp), %rcx
+	movq	%rcx, 24(%rsp)
+	leaq	344(%rsp), %rcx
+	pxor	%xmm1, %xmm1
+	movq	%rax, 192(%rsp)
+	leaq	84(%rsp), %rax
+	movq	%rax, 88(%rsp)
+	leaq	96(%rsp), %rax
+	movq	%rax, 72(%rsp)
+	movq	%rax, 336(%rsp)
+	leaq	352(%rsp), %rax
+	movq	%rcx, 32(%rsp)
+	leaq	336(%rsp), %rcx
+	movq	$0, 168(%rsp)
+	movq	$0, 248(%rsp)
+	movb	$0, 320(%rsp)
+	movl	$0, 84(%rsp)
+	movq	$0, 344(%rsp)
+	movq	$0, 352(%rsp)
+	movq	$0, 360(%rsp)
+	movq	%rax, 8(%rsp)
+	movq	%rax, 1008(%rsp)
+	movq	$0, (%rsp)
+	movq	%rcx, 64(%rsp)
+	movaps	%xmm1, 176(%rsp)
+	movups	%xmm1, 200(%rsp)
+	movups	%xmm0, 216(%rsp)
+	movups	%xmm0, 232(%rsp)
+	movaps	%xmm0, 256(%rsp)
+	movaps	%xmm0, 272(%rsp)
+	movaps	%xmm0, 288(%rsp)
+	movaps	%xmm1, 304(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L683:
+	leaq	1(%rdx), %rcx
+	leaq	(%rdx,%rdx,4), %rdx
+	salq	$4, %rdx
+	movq	%rcx, 8(%rax)
+	leaq	16(%rax,%rdx), %rbp
+	movq	24(%rsp), %rax
+	movq	$0, 56(%rbp)
+	movq	%rax, 0(%rbp)
+	movq	(%rsp), %rax
+	movq	%rax, 8(%rbp)
+	leaq	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZ25test_pool_without_workersvEUlmE_EEvmOT_EUlvE_EE(%rip), %rax
+	movq	%rax, 48(%rbp)
+	movq	32(%rsp), %rax
+	movq	%rax, 64(%rbp)
+	lock addq	$1, 344(%rsp)
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %r13
+	movq	336(%rsp), %rbx
+	testq	%r13, %r13
+	je	.L688
+	cmpq	0(%r13), %rbx
+	jne	.L688
+	movq	128(%r13), %rcx
+	movq	%rcx, 16(%rsp)
+	movq	64(%r13), %rsi
+	movq	%rsi, 40(%rsp)
+	subq	%rsi, %rcx
+	movq	%rsi, %r12
+	movq	136(%r13), %r14
+	movq	(%r14), %rax
+	cmpq	%rcx, %rax
+	jle	.L807
+.L689:
+	movq	16(%rsp), %rcx
+	movq	8(%r14), %rdx
+	subq	$1, %rax
+	andq	%rcx, %rax
+	movq	%rbp, (%rdx,%rax,8)
+	movq	%rcx, %rax
+	addq	$1, %rax
+	movq	%rax, 128(%r13)
+.L700:
+	lock addq	$1, 208(%rbx)
+	movq	216(%rbx), %rax
+	testq	%rax, %rax
+	jne	.L808
+	addq	$1, (%rsp)
+	movq	(%rsp), %rax
+	cmpq	$10, %rax
+	je	.L706
+.L811:
+	movq	1008(%rsp), %rax
+	movq	8(%rax), %rdx
+	cmpq	$8, %rdx
+	jne	.L683
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	je	.L809
+.L684:
+	movq	%rax, 1008(%rsp)
+	movq	8(%rax), %rdx
+	jmp	.L683
+	.p2align 4,,10
+	.p2align 3
+.L688:
+	leaq	32(%rbx), %r12
+	movq	%r12, %rdi
+	call	pthread_mutex_lock@PLT
+	movq	88(%rbx), %rdx
+	movq	80(%rbx), %r13
+	cmpq	%r13, %rdx
+	je	.L810
+	movq	72(%rbx), %rax
+	movq	%rbp, (%rax,%rdx,8)
+.L704:
+	addq	$1, %rdx
+	movq	%rdx, 88(%rbx)
+	lock addq	$1, 112(%rbx)
+	movq	%r12, %rdi
+	call	pthread_mutex_unlock@PLT
+	jmp	.L700
+	.p2align 4,,10
+	.p2align 3
+.L808:
+	leaq	120(%rbx), %rbp
+	movq	%rbp, %rdi
+	call	pthread_mutex_lock@PLT
+	leaq	160(%rbx), %rdi
+	call	pthread_cond_broadcast@PLT
+	movq	%rbp, %rdi
+	call	pthread_mutex_unlock@PLT
+	addq	$1, (%rsp)
+	movq	(%rsp), %rax
+	cmpq	$10, %rax
+	jne	.L811
+.L706:
+	leaq	336(%rsp), %rax
+	movq	%rax, %rdi
+	movq	%rax, 48(%rsp)
+	movq	%rax, %rbx
+.LEHB32:
+	call	_ZN1n10task_group4syncEv
+.LEHE32:
+	movq	%rbx, %rdi
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r13
+	call	_ZN1n10task_group4syncEv
+	movq	8(%rsp), %r12
+	.p2align 4,,10
+	.p2align 3
+.L719:
+	movq	%r12, %r14
+	xorl	%r15d, %r15d
+	movq	(%r12), %r12
+	movq	8(%r14), %rbp
+	leaq	16(%r14), %rbx
+	testq	%rbp, %rbp
+	je	.L714
+	.p2align 4,,10
+	.p2align 3
+.L715:
+	movq	48(%rbx), %rdx
+	testq	%rdx, %rdx
+	je	.L712
+	addq	$1, %r15
+	movq	56(%rbx), %rsi
+	movq	%rbx, %rdi
+	addq	$80, %rbx
+	call	*16(%rdx)
+	cmpq	%rbp, %r15
+	jne	.L715
+.L714:
+	movq	8(%rsp), %rax
+	cmpq	%rax, %r14
+	je	.L711
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L812
+.L717:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %ecx
+	movl	$656, %edx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L711:
+	testq	%r12, %r12
+	jne	.L719
+	cmpl	$10, 84(%rsp)
+	jne	.L813
+	cmpq	$0, 112(%rsp)
+	jne	.L799
+	leaq	216(%rsp), %r14
+	movq	%r14, %rdi
+	call	pthread_mutex_lock@PLT
+	movb	$1, 320(%rsp)
+	lock addq	$1, 304(%rsp)
+	xorl	%ebx, %ebx
+	leaq	256(%rsp), %r15
+	movq	%r15, %rdi
+	call	pthread_cond_broadcast@PLT
+	movq	%r14, %rdi
+	call	pthread_mutex_unlock@PLT
+	cmpq	$0, 112(%rsp)
+	je	.L728
+	.p2align 4,,10
+	.p2align 3
+.L725:
+	movq	96(%rsp), %rax
+	xorl	%esi, %esi
+	movq	(%rax,%rbx,8), %rax
+	addq	$1, %rbx
+	movq	24(%rax), %rdi
+	call	pthread_join@PLT
+	movq	112(%rsp), %rax
+	cmpq	%rax, %rbx
+	jb	.L725
+	testq	%rax, %rax
+	je	.L728
+	movq	%r15, (%rsp)
+	xorl	%ebp, %ebp
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %r13
+	movq	%r14, 8(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L742:
+	movq	96(%rsp), %rax
+	movq	(%rax,%rbp,8), %r14
+	movq	136(%r14), %r12
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L814
+.L730:
+	movq	(%r12), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%r12, %rsi
+	movl	$8, %ecx
+	xorl	%r12d, %r12d
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	$0, 160(%r14)
+	jne	.L732
+	jmp	.L738
+	.p2align 4,,10
+	.p2align 3
+.L736:
+	movq	(%r15), %rax
+	movl	$8, %ecx
+	movq	%r15, %rsi
+	addq	$1, %r12
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	160(%r14), %r12
+	jnb	.L738
+.L732:
+	movq	144(%r14), %rax
+	movq	(%rax,%r12,8), %r15
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L736
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L736
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%r13, _ZZN1n4heapEvE7storage(%rip)
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L736
+	.p2align 4,,10
+	.p2align 3
+.L807:
+	addq	%rax, %rax
+	movq	%rax, 56(%rsp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L815
+.L691:
+	movq	56(%rsp), %rax
+	movq	64(%rsp), %rcx
+	movl	$8, %edx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	leaq	16(,%rax,8), %rsi
+	movq	%rcx, 48(%rsp)
+	movq	(%rdi), %rax
+.LEHB33:
+	call	*16(%rax)
+.LEHE33:
+	movq	%rax, %r15
+	movq	56(%rsp), %rax
+	movq	40(%rsp), %rcx
+	movq	16(%rsp), %rsi
+	movq	%rax, (%r15)
+	leaq	16(%r15), %rax
+	movq	%rax, 8(%r15)
+	cmpq	%rcx, 16(%rsp)
+	jle	.L696
+	.p2align 4,,10
+	.p2align 3
+.L693:
+	movq	(%r14), %rax
+	movq	8(%r14), %rdx
+	subq	$1, %rax
+	andq	%r12, %rax
+	movq	(%rdx,%rax,8), %rcx
+	movq	(%r15), %rax
+	movq	8(%r15), %rdx
+	subq	$1, %rax
+	andq	%r12, %rax
+	addq	$1, %r12
+	movq	%rcx, (%rdx,%rax,8)
+	cmpq	%r12, %rsi
+	jne	.L693
+.L696:
+	movq	144(%r13), %rax
+	movq	160(%r13), %rdx
+	movq	152(%r13), %r12
+	movq	%rax, 40(%rsp)
+	cmpq	%r12, %rdx
+	je	.L816
+	movq	%r14, (%rax,%rdx,8)
+.L699:
+	addq	$1, %rdx
+	movq	%r15, %r14
+	movq	%rdx, 160(%r13)
+	movq	%r15, 136(%r13)
+	movq	(%r15), %rax
+	jmp	.L689
+	.p2align 4,,10
+	.p2align 3
+.L712:
+	addq	$1, %r15
+	addq	$80, %rbx
+	cmpq	%r15, %rbp
+	jne	.L715
+	jmp	.L714
+	.p2align 4,,10
+	.p2align 3
+.L738:
+	movq	144(%r14), %rsi
+	testq	%rsi, %rsi
+	je	.L734
+	movq	152(%r14), %rax
+	movq	168(%r14), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L734:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L817
+.L740:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$64, %ecx
+	movl	$192, %edx
+	movq	%r14, %rsi
+	addq	$1, %rbp
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	112(%rsp), %rbp
+	jb	.L742
+	movq	(%rsp), %r15
+	movq	8(%rsp), %r14
+.L728:
+	movq	%r15, %rdi
+	call	pthread_cond_destroy@PLT
+	movq	%r14, %rdi
+	call	pthread_mutex_destroy@PLT
+	leaq	128(%rsp), %rdi
+	call	pthread_mutex_destroy@PLT
+	movq	168(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L727
+	movq	176(%rsp), %rax
+	movq	192(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L727:
+	movq	96(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L676
+	movq	104(%rsp), %rax
+	movq	120(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L676:
+	addq	$1032, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L817:
+	.cfi_restore_state
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L740
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L740
+	.p2align 4,,10
+	.p2align 3
+.L814:
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L730
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L730
+	.p2align 4,,10
+	.p2align 3
+.L812:
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L717
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r13, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L717
+	.p2align 4,,10
+	.p2align 3
+.L810:
+	leaq	5(%r13), %rsi
+	movq	96(%rbx), %rdi
+	movq	72(%rbx), %r14
+	leaq	336(%rsp), %rcx
+	leaq	(%rsi,%rsi), %rax
+	movq	%rcx, 48(%rsp)
+	salq	$4, %rsi
+	movl	$8, %edx
+	movq	%rax, 80(%rbx)
+	movq	(%rdi), %rax
+.LEHB34:
+	call	*16(%rax)
+	movq	88(%rbx), %rdx
+	movq	%rax, %rdi
+	movq	%rax, 72(%rbx)
+	movq	%rbp, (%rdi,%rdx,8)
+	leaq	0(,%rdx,8), %rax
+	testq	%rdx, %rdx
+	jne	.L818
+	testq	%r14, %r14
+	je	.L704
+.L703:
+	movq	96(%rbx), %rdi
+	leaq	336(%rsp), %rcx
+	leaq	0(,%r13,8), %rdx
+	movq	%r14, %rsi
+	movq	%rcx, 48(%rsp)
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	88(%rbx), %rdx
+	jmp	.L704
+.L809:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L819
+.L686:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %edx
+	movl	$656, %esi
+	leaq	336(%rsp), %rcx
+	movq	%rcx, 48(%rsp)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%rax, %rdx
+	movl	$82, %ecx
+	xorl	%eax, %eax
+	movq	%rdx, %rdi
+	rep stosq
+	movq	1008(%rsp), %rax
+	movq	%rdx, (%rax)
+	movq	1008(%rsp), %rax
+	movq	(%rax), %rax
+	jmp	.L684
+.L815:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r15
+	movq	%r15, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L691
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r15, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L691
+.L806:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L681
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L681
+.L805:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L678
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L678
+.L818:
+	movq	%rax, %rdx
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L703
+.L816:
+	leaq	5(%r12), %rsi
+	movq	168(%r13), %rdi
+	movl	$8, %edx
+	leaq	336(%rsp), %rcx
+	leaq	(%rsi,%rsi), %rax
+	movq	%rcx, 48(%rsp)
+	salq	$4, %rsi
+	movq	%rax, 152(%r13)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	160(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, 144(%r13)
+	movq	%r14, (%rdi,%rdx,8)
+	leaq	0(,%rdx,8), %rax
+	testq	%rdx, %rdx
+	jne	.L820
+	cmpq	$0, 40(%rsp)
+	je	.L699
+.L698:
+	movq	168(%r13), %rdi
+	leaq	336(%rsp), %rcx
+	movq	40(%rsp), %rsi
+	leaq	0(,%r12,8), %rdx
+	movq	%rcx, 48(%rsp)
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE34:
+	movq	160(%r13), %rdx
+	jmp	.L699
+.L820:
+	movq	40(%rsp), %rsi
+	movq	%rax, %rdx
+	call	memcpy@PLT
+	jmp	.L698
+.L819:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L686
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L686
+.L813:
+	jmp	.L720
+.L747:
+	movq	%rax, %rbx
+	jmp	.L722
+	.section	.gcc_except_table
+.LLSDA6817:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6817-.LLSDACSB6817
+.LLSDACSB6817:
+	.uleb128 .LEHB32-.LFB6817
+	.uleb128 .LEHE32-.LEHB32
+	.uleb128 .L747-.LFB6817
+	.uleb128 0
+	.uleb128 .LEHB33-.LFB6817
+	.uleb128 .LEHE33-.LEHB33
+	.uleb128 .L747-.LFB6817
+	.uleb128 0
+	.uleb128 .LEHB34-.LFB6817
+	.uleb128 .LEHE34-.LEHB34
+	.uleb128 .L747-.LFB6817
+	.uleb128 0
+.LLSDACSE6817:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6817
+	.type	_Z25test_pool_without_workersv.cold, @function
+_Z25test_pool_without_workersv.cold:
+.LFSB6817:
+.L799:
+	.cfi_def_cfa_offset 1088
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC19(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB35:
+	call	__cxa_throw@PLT
+.L746:
+	movq	%rax, %rbx
+	jmp	.L723
+.L720:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC18(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE35:
+.L722:
+	movq	48(%rsp), %rdi
+	call	_ZN1n10task_groupD1Ev
+.L723:
+	movq	72(%rsp), %rdi
+	call	_ZN1n11thread_poolD1Ev
+	movq	%rbx, %rdi
+.LEHB36:
+	call	_Unwind_Resume@PLT
+.LEHE36:
+	.cfi_endproc
+.LFE6817:
+	.section	.gcc_except_table
+.LLSDAC6817:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6817-.LLSDACSBC6817
+.LLSDACSBC6817:
+	.uleb128 .LEHB35-.LCOLDB20
+	.uleb128 .LEHE35-.LEHB35
+	.uleb128 .L746-.LCOLDB20
+	.uleb128 0
+	.uleb128 .LEHB36-.LCOLDB20
+	.uleb128 .LEHE36-.LEHB36
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6817:
+	.section	.text.unlikely
+	.text
+	.size	_Z25test_pool_without_workersv, .-_Z25test_pool_without_workersv
+	.section	.text.unlikely
+	.size	_Z25test_pool_without_workersv.cold, .-_Z25test_pool_without_workersv.cold
+.LCOLDE20:
+	.text
+.LHOTE20:
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC21:
+	.string	"expected true : filled"
+	.section	.text.unlikely
+.LCOLDB22:
+	.text
+.LHOTB22:
+	.p2align 4
+	.globl	_Z21test_pool_nested_bulkv
+	.type	_Z21test_pool_nested_bulkv, @function
+_Z21test_pool_nested_bulkv:
+.LFB6814:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6814
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$2072, %rsp
+	.cfi_def_cfa_offset 2128
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1010
+.L823:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	pxor	%xmm0, %xmm0
+	movq	$0, 112(%rsp)
+	movups	%xmm0, 120(%rsp)
+	pxor	%xmm0, %xmm0
+	movq	%rax, 136(%rsp)
+	movq	$0, 176(%rsp)
+	movaps	%xmm0, 144(%rsp)
+	movaps	%xmm0, 160(%rsp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1011
+.L826:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	120(%rsp), %rbx
+	pxor	%xmm0, %xmm0
+	pxor	%xmm1, %xmm1
+	movq	$0, 184(%rsp)
+	movq	%rax, 208(%rsp)
+	movq	$0, 264(%rsp)
+	movb	$0, 336(%rsp)
+	movaps	%xmm1, 192(%rsp)
+	movups	%xmm1, 216(%rsp)
+	movups	%xmm0, 232(%rsp)
+	movups	%xmm0, 248(%rsp)
+	movaps	%xmm0, 272(%rsp)
+	movaps	%xmm0, 288(%rsp)
+	movaps	%xmm0, 304(%rsp)
+	movaps	%xmm1, 320(%rsp)
+	cmpq	$1, %rbx
+	jbe	.L1012
+.L828:
+	movabsq	$-7046029254386353131, %rbp
+	xorl	%r12d, %r12d
+	movq	%rbp, %r15
+	jmp	.L844
+	.p2align 4,,10
+	.p2align 3
+.L832:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$64, %edx
+	movl	$192, %esi
+	movq	(%rdi), %rax
+.LEHB37:
+	call	*16(%rax)
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	movl	$24, %ecx
+	xorl	%eax, %eax
+	rep stosq
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1013
+.L835:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$8, %edx
+	movl	$528, %esi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	leaq	16(%rax), %rdx
+	movq	$64, (%rax)
+	movq	%rdx, 8(%rax)
+	movq	%rax, 136(%rbx)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1014
+.L838:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	128(%rsp), %rdx
+	pxor	%xmm2, %xmm2
+	movq	%r12, 8(%rbx)
+	movq	120(%rsp), %r13
+	movq	112(%rsp), %r14
+	movq	%rbp, 16(%rbx)
+	movq	%rax, 168(%rbx)
+	leaq	112(%rsp), %rax
+	movq	$0, 144(%rbx)
+	movq	%rax, 24(%rsp)
+	movq	%rax, (%rbx)
+	movups	%xmm2, 152(%rbx)
+	cmpq	%r13, %rdx
+	je	.L1015
+	movq	%rbx, (%r14,%rdx,8)
+.L843:
+	addq	$1, %rdx
+	addq	%r15, %rbp
+	movq	%rdx, 128(%rsp)
+	testq	%r12, %r12
+	jne	.L1016
+	movl	$1, %r12d
+.L844:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L832
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L832
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L832
+.L1014:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L838
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L838
+.L1013:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L835
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L835
+.L1015:
+	leaq	5(%r13), %rsi
+	movq	136(%rsp), %rdi
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 120(%rsp)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	128(%rsp), %rdx
+	movq	%rax, %rdi
+	movq	%rax, 112(%rsp)
+	movq	%rbx, (%rdi,%rdx,8)
+	leaq	0(,%rdx,8), %rax
+	testq	%rdx, %rdx
+	jne	.L1017
+	testq	%r14, %r14
+	je	.L843
+.L842:
+	movq	136(%rsp), %rdi
+	leaq	0(,%r13,8), %rdx
+	movl	$8, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE37:
+	movq	128(%rsp), %rdx
+	jmp	.L843
+.L1016:
+	movq	112(%rsp), %rax
+	movq	24(%rsp), %r15
+	leaq	_ZN1n11thread_pool6__loopEPv(%rip), %rbx
+	xorl	%esi, %esi
+	leaq	1040(%rsp), %rdi
+	movq	%rbx, %rdx
+	movq	(%rax), %rcx
+	movq	%rdi, %xmm3
+	movq	%r15, %xmm0
+	movq	%rdi, %r14
+	punpcklqdq	%xmm3, %xmm0
+	movq	%rdi, 88(%rsp)
+	leaq	24(%rcx), %rdi
+	movaps	%xmm0, (%rsp)
+	call	pthread_create@PLT
+	movq	112(%rsp), %rax
+	movq	%rbx, %rdx
+	xorl	%esi, %esi
+	movq	8(%rax), %rcx
+	leaq	24(%rcx), %rdi
+	call	pthread_create@PLT
+	xorl	%eax, %eax
+	movl	$128, %ecx
+	movq	%r14, %rdi
+	rep stosq
+	xorl	%edx, %edx
+	leaq	96(%rsp), %rcx
+	leaq	368(%rsp), %rax
+	movq	%rcx, 40(%rsp)
+	leaq	360(%rsp), %rcx
+	movdqa	(%rsp), %xmm0
+	movq	%rcx, 32(%rsp)
+	leaq	352(%rsp), %rcx
+	movq	%r15, 352(%rsp)
+	movq	$0, 360(%rsp)
+	movq	$0, 368(%rsp)
+	movq	$0, 376(%rsp)
+	movq	%rax, 16(%rsp)
+	movq	%rax, 1024(%rsp)
+	movq	$0, (%rsp)
+	movq	%rcx, 80(%rsp)
+	movaps	%xmm0, 96(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L845:
+	leaq	1(%rdx), %rcx
+	leaq	(%rdx,%rdx,4), %rdx
+	salq	$4, %rdx
+	movq	%rcx, 8(%rax)
+	leaq	16(%rax,%rdx), %rbp
+	movq	40(%rsp), %rax
+	movq	$0, 56(%rbp)
+	movq	%rax, 0(%rbp)
+	movq	(%rsp), %rax
+	movq	%rax, 8(%rbp)
+	leaq	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZ21test_pool_nested_bulkvEUlmE_EEvmOT_EUlvE_EE(%rip), %rax
+	movq	%rax, 48(%rbp)
+	movq	32(%rsp), %rax
+	movq	%rax, 64(%rbp)
+	lock addq	$1, 360(%rsp)
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %r13
+	movq	352(%rsp), %rbx
+	testq	%r13, %r13
+	je	.L854
+	cmpq	0(%r13), %rbx
+	jne	.L854
+	movq	128(%r13), %rcx
+	movq	%rcx, 48(%rsp)
+	movq	64(%r13), %rsi
+	movq	%rsi, 56(%rsp)
+	subq	%rsi, %rcx
+	movq	%rsi, %r12
+	movq	136(%r13), %r14
+	movq	(%r14), %rax
+	cmpq	%rcx, %rax
+	jle	.L1018
+.L855:
+	movq	48(%rsp), %rcx
+	movq	8(%r14), %rdx
+	subq	$1, %rax
+	andq	%rcx, %rax
+	movq	%rbp, (%rdx,%rax,8)
+	movq	%rcx, %rax
+	addq	$1, %rax
+	movq	%rax, 128(%r13)
+.L866:
+	lock addq	$1, 208(%rbx)
+	movq	216(%rbx), %rax
+	testq	%rax, %rax
+	jne	.L1019
+	addq	$1, (%rsp)
+	movq	(%rsp), %rax
+	cmpq	$16, %rax
+	je	.L1020
+.L872:
+	movq	1024(%rsp), %rax
+	movq	8(%rax), %rdx
+	cmpq	$8, %rdx
+	jne	.L845
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	je	.L1021
+.L850:
+	movq	%rax, 1024(%rsp)
+	movq	8(%rax), %rdx
+	jmp	.L845
+	.p2align 4,,10
+	.p2align 3
+.L854:
+	leaq	32(%rbx), %r12
+	movq	%r12, %rdi
+	call	pthread_mutex_lock@PLT
+	movq	88(%rbx), %rdx
+	movq	80(%rbx), %r13
+	cmpq	%r13, %rdx
+	je	.L1022
+	movq	72(%rbx), %rax
+	movq	%rbp, (%rax,%rdx,8)
+.L870:
+	addq	$1, %rdx
+	movq	%rdx, 88(%rbx)
+	lock addq	$1, 112(%rbx)
+	movq	%r12, %rdi
+	call	pthread_mutex_unlock@PLT
+	jmp	.L866
+.L1019:
+	leaq	120(%rbx), %rbp
+	movq	%rbp, %rdi
+	call	pthread_mutex_lock@PLT
+	leaq	160(%rbx), %rdi
+	call	pthread_cond_broadcast@PLT
+	movq	%rbp, %rdi
+	call	pthread_mutex_unlock@PLT
+	addq	$1, (%rsp)
+	movq	(%rsp), %rax
+	cmpq	$16, %rax
+	jne	.L872
+.L1020:
+	leaq	352(%rsp), %rax
+	movq	%rax, %rdi
+	movq	%rax, 64(%rsp)
+	movq	%rax, %rbx
+.LEHB38:
+	call	_ZN1n10task_group4syncEv
+.LEHE38:
+	movq	%rbx, %rdi
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r13
+	call	_ZN1n10task_group4syncEv
+	movq	16(%rsp), %r12
+	.p2align 4,,10
+	.p2align 3
+.L883:
+	movq	%r12, %r14
+	xorl	%r15d, %r15d
+	movq	(%r12), %r12
+	movq	8(%r14), %rbp
+	leaq	16(%r14), %rbx
+	testq	%rbp, %rbp
+	je	.L878
+	.p2align 4,,10
+	.p2align 3
+.L879:
+	movq	48(%rbx), %rdx
+	testq	%rdx, %rdx
+	je	.L876
+	addq	$1, %r15
+	movq	56(%rbx), %rsi
+	movq	%rbx, %rdi
+	addq	$80, %rbx
+	call	*16(%rdx)
+	cmpq	%r15, %rbp
+	jne	.L879
+.L878:
+	movq	16(%rsp), %rax
+	cmpq	%rax, %r14
+	je	.L875
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1023
+.L881:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %ecx
+	movl	$656, %edx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L875:
+	testq	%r12, %r12
+	jne	.L883
+	movq	88(%rsp), %rdx
+	movl	$15, %eax
+	movl	$1, %ecx
+	jmp	.L884
+	.p2align 4,,10
+	.p2align 3
+.L887:
+	addl	$16, %eax
+	addq	$64, %rdx
+	cmpl	$271, %eax
+	je	.L1024
+.L884:
+	testb	%cl, %cl
+	je	.L887
+	leal	-15(%rax), %esi
+	xorl	%ecx, %ecx
+	cmpl	%esi, (%rdx)
+	jne	.L887
+	leal	-14(%rax), %esi
+	cmpl	%esi, 4(%rdx)
+	jne	.L887
+	leal	-13(%rax), %esi
+	cmpl	%esi, 8(%rdx)
+	jne	.L887
+	leal	-12(%rax), %esi
+	cmpl	%esi, 12(%rdx)
+	jne	.L887
+	leal	-11(%rax), %esi
+	cmpl	%esi, 16(%rdx)
+	jne	.L887
+	leal	-10(%rax), %esi
+	cmpl	%esi, 20(%rdx)
+	jne	.L887
+	leal	-9(%rax), %esi
+	cmpl	%esi, 24(%rdx)
+	jne	.L887
+	leal	-8(%rax), %esi
+	cmpl	%esi, 28(%rdx)
+	jne	.L887
+	leal	-7(%rax), %esi
+	cmpl	%esi, 32(%rdx)
+	jne	.L887
+	leal	-6(%rax), %esi
+	cmpl	%esi, 36(%rdx)
+	jne	.L887
+	leal	-5(%rax), %esi
+	cmpl	%esi, 40(%rdx)
+	jne	.L887
+	leal	-4(%rax), %esi
+	cmpl	%esi, 44(%rdx)
+	jne	.L887
+	leal	-3(%rax), %esi
+	cmpl	%esi, 48(%rdx)
+	jne	.L887
+	leal	-2(%rax), %esi
+	cmpl	%esi, 52(%rdx)
+	jne	.L887
+	leal	-1(%rax), %esi
+	cmpl	%esi, 56(%rdx)
+	jne	.L887
+	cmpl	%eax, 60(%rdx)
+	sete	%cl
+	addl	$16, %eax
+	addq	$64, %rdx
+	cmpl	$271, %eax
+	jne	.L884
+.L1024:
+	testb	%cl, %cl
+	je	.L1005
+	leaq	232(%rsp), %r14
+	movq	%r14, %rdi
+	call	pthread_mutex_lock@PLT
+	movb	$1, 336(%rsp)
+	lock addq	$1, 320(%rsp)
+	xorl	%ebx, %ebx
+	leaq	272(%rsp), %r15
+	movq	%r15, %rdi
+	call	pthread_cond_broadcast@PLT
+	movq	%r14, %rdi
+	call	pthread_mutex_unlock@PLT
+	cmpq	$0, 128(%rsp)
+	je	.L892
+	.p2align 4,,10
+	.p2align 3
+.L889:
+	movq	112(%rsp), %rax
+	xorl	%esi, %esi
+	movq	(%rax,%rbx,8), %rax
+	addq	$1, %rbx
+	movq	24(%rax), %rdi
+	call	pthread_join@PLT
+	movq	128(%rsp), %rax
+	cmpq	%rax, %rbx
+	jb	.L889
+	testq	%rax, %rax
+	je	.L892
+	movq	%r14, (%rsp)
+	xorl	%ebp, %ebp
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %r13
+	movq	%r15, 16(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L906:
+	movq	112(%rsp), %rax
+	movq	(%rax,%rbp,8), %r14
+	movq	136(%r14), %r12
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1025
+.L894:
+	movq	(%r12), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%r12, %rsi
+	movl	$8, %ecx
+	xorl	%r12d, %r12d
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	$0, 160(%r14)
+	jne	.L896
+	jmp	.L902
+	.p2align 4,,10
+	.p2align 3
+.L900:
+	movq	(%r15), %rax
+	movl	$8, %ecx
+	movq	%r15, %rsi
+	addq	$1, %r12
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	160(%r14), %r12
+	jnb	.L902
+.L896:
+	movq	144(%r14), %rax
+	movq	(%rax,%r12,8), %r15
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L900
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L900
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%r13, _ZZN1n4heapEvE7storage(%rip)
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L900
+.L1018:
+	addq	%rax, %rax
+	movq	%rax, 72(%rsp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1026
+.L857:
+	movq	72(%rsp), %rax
+	movq	80(%rsp), %rcx
+	movl	$8, %edx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	leaq	16(,%rax,8), %rsi
+	movq	%rcx, 64(%rsp)
+	movq	(%rdi), %rax
+.LEHB39:
+	call	*16(%rax)
+.LEHE39:
+	movq	%rax, %r15
+	movq	72(%rsp), %rax
+	movq	56(%rsp), %rcx
+	movq	48(%rsp), %rsi
+	movq	%rax, (%r15)
+	leaq	16(%r15), %rax
+	movq	%rax, 8(%r15)
+	cmpq	%rcx, 48(%rsp)
+	jle	.L862
+	.p2align 4,,10
+	.p2align 3
+.L859:
+	movq	(%r14), %rax
+	movq	8(%r14), %rdx
+	subq	$1, %rax
+	andq	%r12, %rax
+	movq	(%rdx,%rax,8), %rcx
+	movq	(%r15), %rax
+	movq	8(%r15), %rdx
+	subq	$1, %rax
+	andq	%r12, %rax
+	addq	$1, %r12
+	movq	%rcx, (%rdx,%rax,8)
+	cmpq	%r12, %rsi
+	jne	.L859
+.L862:
+	movq	144(%r13), %rcx
+	movq	160(%r13), %rax
+	movq	152(%r13), %r12
+	movq	%rcx, 56(%rsp)
+	cmpq	%r12, %rax
+	je	.L1027
+	movq	%r14, (%rcx,%rax,8)
+.L865:
+	addq	$1, %rax
+	movq	%r15, %r14
+	movq	%rax, 160(%r13)
+	movq	%r15, 136(%r13)
+	movq	(%r15), %rax
+	jmp	.L855
+	.p2align 4,,10
+	.p2align 3
+.L876:
+	addq	$1, %r15
+	addq	$80, %rbx
+	cmpq	%r15, %rbp
+	jne	.L879
+	jmp	.L878
+.L1023:
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L881
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r13, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L881
+	.p2align 4,,10
+	.p2align 3
+.L902:
+	movq	144(%r14), %rsi
+	testq	%rsi, %rsi
+	je	.L898
+	movq	152(%r14), %rax
+	movq	168(%r14), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L898:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1028
+.L904:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$64, %ecx
+	movl	$192, %edx
+	movq	%r14, %rsi
+	addq	$1, %rbp
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	128(%rsp), %rbp
+	jb	.L906
+	movq	(%rsp), %r14
+	movq	16(%rsp), %r15
+.L892:
+	movq	%r15, %rdi
+	call	pthread_cond_destroy@PLT
+	movq	%r14, %rdi
+	call	pthread_mutex_destroy@PLT
+	leaq	144(%rsp), %rdi
+	call	pthread_mutex_destroy@PLT
+	movq	184(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L891
+	movq	192(%rsp), %rax
+	movq	208(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L891:
+	movq	112(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L821
+	movq	120(%rsp), %rax
+	movq	136(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L821:
+	addq	$2072, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L1028:
+	.cfi_restore_state
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L904
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L904
+.L1025:
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L894
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L894
+.L1022:
+	leaq	5(%r13), %rsi
+	movq	96(%rbx), %rdi
+	movq	72(%rbx), %r14
+	leaq	352(%rsp), %rcx
+	leaq	(%rsi,%rsi), %rax
+	movq	%rcx, 64(%rsp)
+	salq	$4, %rsi
+	movl	$8, %edx
+	movq	%rax, 80(%rbx)
+	movq	(%rdi), %rax
+.LEHB40:
+	call	*16(%rax)
+	movq	88(%rbx), %rdx
+	movq	%rax, %rdi
+	movq	%rax, 72(%rbx)
+	movq	%rbp, (%rdi,%rdx,8)
+	leaq	0(,%rdx,8), %rax
+	testq	%rdx, %rdx
+	jne	.L1029
+	testq	%r14, %r14
+	je	.L870
+.L869:
+	movq	96(%rbx), %rdi
+	leaq	352(%rsp), %rcx
+	leaq	0(,%r13,8), %rdx
+	movq	%r14, %rsi
+	movq	%rcx, 64(%rsp)
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	88(%rbx), %rdx
+	jmp	.L870
+.L1017:
+	movq	%rax, %rdx
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L842
+.L1021:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1030
+.L852:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %edx
+	movl	$656, %esi
+	leaq	352(%rsp), %rcx
+	movq	%rcx, 64(%rsp)
+	movq	(%rdi), %rax
+	call	*16(%rax)
+.LEHE40:
+	movq	%rax, %rdx
+	movl	$82, %ecx
+	xorl	%eax, %eax
+	movq	%rdx, %rdi
+	rep stosq
+	movq	1024(%rsp), %rax
+	movq	%rdx, (%rax)
+	movq	1024(%rsp), %rax
+	movq	(%rax), %rax
+	jmp	.L850
+.L1026:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r15
+	movq	%r15, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L857
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r15, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L857
+.L1012:
+	movq	112(%rsp), %rbp
+	movl	$8, %edx
+	movl	$16, %esi
+	movq	136(%rsp), %rdi
+	movq	(%rdi), %rax
+.LEHB41:
+	call	*16(%rax)
+	movq	%rax, 112(%rsp)
+	movq	%rax, %rdi
+	movq	128(%rsp), %rax
+	movq	$2, 120(%rsp)
+	testq	%rax, %rax
+	jne	.L1031
+	testq	%rbp, %rbp
+	je	.L828
+.L830:
+	movq	136(%rsp), %rdi
+	leaq	0(,%rbx,8), %rdx
+	movl	$8, %ecx
+	movq	%rbp, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE41:
+	jmp	.L828
+.L1011:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L826
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L826
+.L1010:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L823
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L823
+.L1029:
+	movq	%rax, %rdx
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	jmp	.L869
+.L1027:
+	leaq	5(%r12), %rax
+	movq	168(%r13), %rdi
+	leaq	352(%rsp), %rcx
+	leaq	(%rax,%rax), %rdx
+	salq	$4, %rax
+	movq	%rcx, 64(%rsp)
+	movq	%rax, %rsi
+	movq	(%rdi), %rax
+	movq	%rdx, 152(%r13)
+	movl	$8, %edx
+.LEHB42:
+	call	*16(%rax)
+	movq	%rax, 144(%r13)
+	movq	%rax, %rdi
+	movq	160(%r13), %rax
+	movq	%r14, (%rdi,%rax,8)
+	leaq	0(,%rax,8), %rdx
+	testq	%rax, %rax
+	jne	.L1032
+	cmpq	$0, 56(%rsp)
+	je	.L865
+.L864:
+	movq	168(%r13), %rdi
+	leaq	352(%rsp), %rcx
+	movq	56(%rsp), %rsi
+	leaq	0(,%r12,8), %rdx
+	movq	%rcx, 64(%rsp)
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE42:
+	movq	160(%r13), %rax
+	jmp	.L865
+.L1032:
+	movq	56(%rsp), %rsi
+	call	memcpy@PLT
+	jmp	.L864
+.L1030:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L852
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L852
+.L1031:
+	leaq	0(,%rax,8), %rdx
+	movq	%rbp, %rsi
+	call	memcpy@PLT
+	jmp	.L830
+.L927:
+	movq	%rax, %rbx
+	jmp	.L885
+.L928:
+	movq	%rax, %rbx
+	jmp	.L846
+	.section	.gcc_except_table
+.LLSDA6814:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6814-.LLSDACSB6814
+.LLSDACSB6814:
+	.uleb128 .LEHB37-.LFB6814
+	.uleb128 .LEHE37-.LEHB37
+	.uleb128 .L928-.LFB6814
+	.uleb128 0
+	.uleb128 .LEHB38-.LFB6814
+	.uleb128 .LEHE38-.LEHB38
+	.uleb128 .L927-.LFB6814
+	.uleb128 0
+	.uleb128 .LEHB39-.LFB6814
+	.uleb128 .LEHE39-.LEHB39
+	.uleb128 .L927-.LFB6814
+	.uleb128 0
+	.uleb128 .LEHB40-.LFB6814
+	.uleb128 .LEHE40-.LEHB40
+	.uleb128 .L927-.LFB6814
+	.uleb128 0
+	.uleb128 .LEHB41-.LFB6814
+	.uleb128 .LEHE41-.LEHB41
+	.uleb128 .L928-.LFB6814
+	.uleb128 0
+	.uleb128 .LEHB42-.LFB6814
+	.uleb128 .LEHE42-.LEHB42
+	.uleb128 .L927-.LFB6814
+	.uleb128 0
+.LLSDACSE6814:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6814
+	.type	_Z21test_pool_nested_bulkv.cold, @function
+_Z21test_pool_nested_bulkv.cold:
+.LFSB6814:
+.L1005:
+	.cfi_def_cfa_offset 2128
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC21(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB43:
+	call	__cxa_throw@PLT
+.LEHE43:
+.L926:
+	movq	%rax, %rbx
+	jmp	.L886
+.L885:
+	movq	64(%rsp), %rdi
+	call	_ZN1n10task_groupD1Ev
+.L886:
+	movq	24(%rsp), %rdi
+	call	_ZN1n11thread_poolD1Ev
+	movq	%rbx, %rdi
+.LEHB44:
+	call	_Unwind_Resume@PLT
+.LEHE44:
+.L846:
+	movq	184(%rsp), %rsi
+	movq	192(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L847
+	movq	208(%rsp), %rdi
+	salq	$3, %rdx
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L847:
+	movq	112(%rsp), %rsi
+	movq	120(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L848
+	movq	136(%rsp), %rdi
+	salq	$3, %rdx
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L848:
+	movq	%rbx, %rdi
+.LEHB45:
+	call	_Unwind_Resume@PLT
+.LEHE45:
+	.cfi_endproc
+.LFE6814:
+	.section	.gcc_except_table
+.LLSDAC6814:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6814-.LLSDACSBC6814
+.LLSDACSBC6814:
+	.uleb128 .LEHB43-.LCOLDB22
+	.uleb128 .LEHE43-.LEHB43
+	.uleb128 .L926-.LCOLDB22
+	.uleb128 0
+	.uleb128 .LEHB44-.LCOLDB22
+	.uleb128 .LEHE44-.LEHB44
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB45-.LCOLDB22
+	.uleb128 .LEHE45-.LEHB45
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6814:
+	.section	.text.unlikely
+	.text
+	.size	_Z21test_pool_nested_bulkv, .-_Z21test_pool_nested_bulkv
+	.section	.text.unlikely
+	.size	_Z21test_pool_nested_bulkv.cold, .-_Z21test_pool_nested_bulkv.cold
+.LCOLDE22:
+	.text
+.LHOTE22:
+	.section	.rodata._ZN1n4test10test_suite7run_allEv.str1.1,"aMS",@progbits,1
+.LC23:
+	.string	"\nSUITE [%s] "
+.LC25:
+	.string	"%s"
+.LC26:
+	.string	"\nTEST [%s] "
+.LC27:
+	.string	" - Result : \033[1;32mPASSED\033[0m"
+.LC28:
+	.string	"\033[1;31merror : %s\033[0m\n"
+.LC29:
+	.string	" - Result : \033[1;31mFAILED\033[0m"
+.LC30:
+	.string	" - Passed : \033[1;32m%d\033[0m\n"
+.LC31:
+	.string	" - Failed : \033[1;31m%d\033[0m\n"
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4test10test_suite7run_allEv
+	.type	_ZN1n4test10test_suite7run_allEv, @function
+_ZN1n4test10test_suite7run_allEv:
+.LFB6791:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6791
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	leaq	.LC23(%rip), %rdx
+	movl	$79, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	16(%rdi), %rcx
+	leaq	16(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L1034
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L1035
+	testb	$4, %cl
+	jne	.L1088
+	testl	%ecx, %ecx
+	je	.L1034
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L1089
+	.p2align 4,,10
+	.p2align 3
+.L1034:
+	movzwl	.LC24(%rip), %r15d
+	movq	%rbx, %rsi
+	leaq	.LC25(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+.LEHB46:
+	call	printf@PLT
+	movl	8(%r12), %esi
+	testl	%esi, %esi
+	jle	.L1055
+	movl	$0, 12(%rsp)
+	xorl	%ebp, %ebp
+	xorl	%r14d, %r14d
+	jmp	.L1049
+	.p2align 4,,10
+	.p2align 3
+.L1092:
+	testb	$4, %dl
+	jne	.L1090
+	testl	%edx, %edx
+	je	.L1040
+	movb	$42, (%rax)
+	testb	$2, %dl
+	jne	.L1091
+	.p2align 4,,10
+	.p2align 3
+.L1040:
+	movq	%rbx, %rsi
+	leaq	.LC25(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+.LEHE46:
+	movq	(%r12), %rax
+.LEHB47:
+	call	*8(%rax,%r13)
+.LEHE47:
+	leaq	.LC27(%rip), %rdi
+	addl	$1, %r14d
+.LEHB48:
+	call	puts@PLT
+.L1045:
+	addq	$1, %rbp
+	cmpl	%ebp, 8(%r12)
+	jle	.L1039
+.L1049:
+	movq	(%r12), %rax
+	movq	%rbp, %r13
+	movq	%rbx, %rdi
+	movl	$79, %esi
+	salq	$4, %r13
+	leaq	.LC26(%rip), %rdx
+	movq	(%rax,%r13), %rcx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L1040
+	movl	$79, %edx
+	subl	%eax, %edx
+	addq	%rbx, %rax
+	cmpl	$8, %edx
+	jb	.L1092
+	movabsq	$3038287259199220266, %rsi
+	leaq	8(%rax), %rdi
+	movl	%edx, %ecx
+	andq	$-8, %rdi
+	movq	%rsi, (%rax)
+	movq	%rsi, -8(%rax,%rcx)
+	subq	%rdi, %rax
+	leal	(%rdx,%rax), %ecx
+	movq	%rsi, %rax
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L1040
+.L1055:
+	movl	$0, 12(%rsp)
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L1039:
+	movabsq	$5917806138674729738, %rax
+	movq	%rbx, %rdi
+	movq	%rax, 16(%rsp)
+	movabsq	$9095440486453792, %rax
+	movq	%rax, 22(%rsp)
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L1050
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L1051
+	testb	$4, %cl
+	jne	.L1093
+	testl	%ecx, %ecx
+	je	.L1050
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L1094
+.L1050:
+	movq	%rbx, %rsi
+	leaq	.LC25(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+	movl	%r14d, %esi
+	leaq	.LC30(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	12(%rsp), %esi
+	leaq	.LC31(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	$10, %edi
+	call	putchar@PLT
+.LEHE48:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L1051:
+	.cfi_restore_state
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L1050
+.L1035:
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L1034
+.L1090:
+	movl	$707406378, (%rax)
+	movl	$707406378, -4(%rax,%rdx)
+	jmp	.L1040
+.L1091:
+	movl	$10794, %ecx
+	movw	%cx, -2(%rax,%rdx)
+	jmp	.L1040
+.L1089:
+	movl	$10794, %edi
+	movw	%di, -2(%rdx,%rcx)
+	jmp	.L1034
+.L1094:
+	movl	$10794, %eax
+	movw	%ax, -2(%rdx,%rcx)
+	jmp	.L1050
+.L1088:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L1034
+.L1093:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L1050
+.L1056:
+	movq	%rax, %rdi
+	movq	%rdx, %rax
+.L1046:
+	subq	$1, %rax
+	jne	.L1087
+	call	__cxa_begin_catch@PLT
+	leaq	.LC28(%rip), %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+.LEHB49:
+	call	printf@PLT
+.LEHE49:
+	call	__cxa_end_catch@PLT
+	leaq	.LC29(%rip), %rdi
+	addl	$1, 12(%rsp)
+.LEHB50:
+	call	puts@PLT
+	jmp	.L1045
+.L1048:
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+.L1087:
+	call	_Unwind_Resume@PLT
+.LEHE50:
+.L1057:
+	movq	%rax, %rbx
+	jmp	.L1048
+	.cfi_endproc
+.LFE6791:
+	.section	.gcc_except_table
+	.align 4
+.LLSDA6791:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT6791-.LLSDATTD6791
+.LLSDATTD6791:
+	.byte	0x1
+	.uleb128 .LLSDACSE6791-.LLSDACSB6791
+.LLSDACSB6791:
+	.uleb128 .LEHB46-.LFB6791
+	.uleb128 .LEHE46-.LEHB46
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB47-.LFB6791
+	.uleb128 .LEHE47-.LEHB47
+	.uleb128 .L1056-.LFB6791
+	.uleb128 0x1
+	.uleb128 .LEHB48-.LFB6791
+	.uleb128 .LEHE48-.LEHB48
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB49-.LFB6791
+	.uleb128 .LEHE49-.LEHB49
+	.uleb128 .L1057-.LFB6791
+	.uleb128 0
+	.uleb128 .LEHB50-.LFB6791
+	.uleb128 .LEHE50-.LEHB50
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6791:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	DW.ref._ZTIPKc-.
+.LLSDATT6791:
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.size	_ZN1n4test10test_suite7run_allEv, .-_ZN1n4test10test_suite7run_allEv
+	.section	.text.unlikely
+.LCOLDB32:
+	.text
+.LHOTB32:
+	.p2align 4
+	.globl	_Z3fibRN1n11thread_poolEi
+	.type	_Z3fibRN1n11thread_poolEi, @function
+_Z3fibRN1n11thread_poolEi:
+.LFB6809:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6809
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$760, %rsp
+	.cfi_def_cfa_offset 816
+	movl	%esi, 44(%rsp)
+	cmpl	$14, %esi
+	jg	.L1096
+	cmpl	$1, %esi
+	jg	.L1097
+	movslq	%esi, %rax
+	movq	%rax, (%rsp)
+.L1095:
+	movq	(%rsp), %rax
+	addq	$760, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1097:
+	.cfi_restore_state
+	leal	-1(%rsi), %esi
+.LEHB51:
+	call	_Z3fibRN1n11thread_poolEi
+	movq	%rbx, %rdi
+	movq	%rax, %r14
+	movl	44(%rsp), %eax
+	leal	-2(%rax), %esi
+	call	_Z3fibRN1n11thread_poolEi
+.LEHE51:
+	addq	%r14, %rax
+	movq	%rax, (%rsp)
+	jmp	.L1095
+	.p2align 4,,10
+	.p2align 3
+.L1096:
+	leaq	56(%rsp), %rax
+	leaq	80(%rsp), %rbp
+	movq	%rdi, 64(%rsp)
+	movq	%rax, 96(%rsp)
+	leaq	44(%rsp), %rax
+	movq	%rax, 112(%rsp)
+	leaq	_ZN1n4task8__ops_ofIZ3fibRNS_11thread_poolEiEUlvE_EE(%rip), %rax
+	movq	%rax, 144(%rsp)
+	leaq	72(%rsp), %rax
+	movq	$0, 56(%rsp)
+	movq	$0, 72(%rsp)
+	movq	$0, 80(%rsp)
+	movq	%rbp, 736(%rsp)
+	movq	$1, 88(%rsp)
+	movq	$0, 152(%rsp)
+	movq	%rdi, 104(%rsp)
+	movq	%rax, 160(%rsp)
+	lock addq	$1, 72(%rsp)
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %r14
+	movq	64(%rsp), %r12
+	testq	%r14, %r14
+	je	.L1099
+	cmpq	(%r14), %r12
+	jne	.L1099
+	movq	128(%r14), %rdx
+	movq	%rdx, 8(%rsp)
+	movq	64(%r14), %rdi
+	movq	%rdi, 24(%rsp)
+	subq	%rdi, %rdx
+	movq	%rdi, %r13
+	movq	136(%r14), %r15
+	movq	(%r15), %rax
+	cmpq	%rdx, %rax
+	jle	.L1154
+.L1100:
+	movq	8(%rsp), %rdi
+	movq	8(%r15), %rdx
+	subq	$1, %rax
+	leaq	96(%rsp), %rcx
+	andq	%rdi, %rax
+	movq	%rcx, (%rdx,%rax,8)
+	movq	%rdi, %rax
+	addq	$1, %rax
+	movq	%rax, 128(%r14)
+.L1111:
+	lock addq	$1, 208(%r12)
+	movq	216(%r12), %rax
+	testq	%rax, %rax
+	jne	.L1155
+.L1116:
+	movl	44(%rsp), %eax
+	movq	%rbx, %rdi
+	leal	-2(%rax), %esi
+	leaq	64(%rsp), %rax
+	movq	%rax, (%rsp)
+.LEHB52:
+	call	_Z3fibRN1n11thread_poolEi
+	leaq	64(%rsp), %rbx
+	movq	%rax, %r14
+	movq	%rbx, %rdi
+	movq	%rbx, (%rsp)
+	call	_ZN1n10task_group4syncEv
+.LEHE52:
+	addq	56(%rsp), %r14
+	movq	%rbx, %rdi
+	movq	%rbp, %r13
+	movq	%r14, (%rsp)
+	call	_ZN1n10task_group4syncEv
+	.p2align 4,,10
+	.p2align 3
+.L1127:
+	movq	%r13, %r12
+	xorl	%r15d, %r15d
+	movq	0(%r13), %r13
+	movq	8(%r12), %rbx
+	leaq	16(%r12), %r14
+	testq	%rbx, %rbx
+	je	.L1122
+	.p2align 4,,10
+	.p2align 3
+.L1123:
+	movq	48(%r14), %rcx
+	testq	%rcx, %rcx
+	je	.L1120
+	addq	$1, %r15
+	movq	56(%r14), %rsi
+	movq	%r14, %rdi
+	addq	$80, %r14
+	call	*16(%rcx)
+	cmpq	%r15, %rbx
+	jne	.L1123
+.L1122:
+	cmpq	%rbp, %r12
+	je	.L1119
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1156
+.L1125:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %ecx
+	movl	$656, %edx
+	movq	%r12, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1119:
+	testq	%r13, %r13
+	jne	.L1127
+	jmp	.L1095
+.L1099:
+	leaq	32(%r12), %r13
+	movq	%r13, %rdi
+	call	pthread_mutex_lock@PLT
+	movq	88(%r12), %rax
+	movq	80(%r12), %r14
+	cmpq	%r14, %rax
+	je	.L1157
+	movq	72(%r12), %rdx
+	leaq	96(%rsp), %rcx
+	movq	%rcx, (%rdx,%rax,8)
+.L1115:
+	addq	$1, %rax
+	movq	%rax, 88(%r12)
+	lock addq	$1, 112(%r12)
+	movq	%r13, %rdi
+	call	pthread_mutex_unlock@PLT
+	jmp	.L1111
+	.p2align 4,,10
+	.p2align 3
+.L1120:
+	addq	$1, %r15
+	addq	$80, %r14
+	cmpq	%r15, %rbx
+	jne	.L1123
+	jmp	.L1122
+	.p2align 4,,10
+	.p2align 3
+.L1156:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1125
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1125
+.L1155:
+	leaq	120(%r12), %r13
+	movq	%r13, %rdi
+	call	pthread_mutex_lock@PLT
+	leaq	160(%r12), %rdi
+	call	pthread_cond_broadcast@PLT
+	movq	%r13, %rdi
+	call	pthread_mutex_unlock@PLT
+	jmp	.L1116
+.L1154:
+	addq	%rax, %rax
+	movq	%rax, 32(%rsp)
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1158
+.L1102:
+	movq	32(%rsp), %rax
+	leaq	64(%rsp), %rcx
+	movl	$8, %edx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%rcx, (%rsp)
+	leaq	16(,%rax,8), %rsi
+	movq	(%rdi), %rax
+.LEHB53:
+	call	*16(%rax)
+	movq	32(%rsp), %rdx
+	movq	%rax, 16(%rsp)
+	movq	%rdx, (%rax)
+	movq	%rax, %rdx
+	leaq	16(%rax), %rax
+	movq	%rax, 8(%rdx)
+	movq	24(%rsp), %rdx
+	cmpq	%rdx, 8(%rsp)
+	jle	.L1107
+	.p2align 4,,10
+	.p2align 3
+.L1104:
+	movq	(%r15), %rax
+	movq	8(%r15), %rdx
+	subq	$1, %rax
+	andq	%r13, %rax
+	movq	(%rdx,%rax,8), %rcx
+	movq	16(%rsp), %rdx
+	movq	(%rdx), %rax
+	movq	8(%rdx), %rdx
+	movq	%rax, (%rsp)
+	subq	$1, %rax
+	andq	%r13, %rax
+	addq	$1, %r13
+	movq	%rcx, (%rdx,%rax,8)
+	cmpq	%r13, 8(%rsp)
+	jne	.L1104
+.L1107:
+	movq	144(%r14), %rdx
+	movq	160(%r14), %rax
+	movq	152(%r14), %r13
+	movq	%rdx, 24(%rsp)
+	cmpq	%r13, %rax
+	je	.L1159
+	movq	%r15, (%rdx,%rax,8)
+.L1110:
+	addq	$1, %rax
+	movq	%rax, 160(%r14)
+	movq	16(%rsp), %r15
+	movq	%r15, 136(%r14)
+	movq	(%r15), %rax
+	jmp	.L1100
+.L1157:
+	leaq	5(%r14), %rax
+	movq	96(%r12), %rdi
+	movq	72(%r12), %r15
+	leaq	(%rax,%rax), %rdx
+	salq	$4, %rax
+	movq	%rax, %rsi
+	movq	(%rdi), %rax
+	movq	%rdx, 80(%r12)
+	leaq	64(%rsp), %rdx
+	movq	%rdx, (%rsp)
+	movl	$8, %edx
+	call	*16(%rax)
+	movq	%rax, 72(%r12)
+	movq	%rax, %rdi
+	movq	88(%r12), %rax
+	leaq	96(%rsp), %rcx
+	movq	%rcx, (%rdi,%rax,8)
+	leaq	0(,%rax,8), %rdx
+	testq	%rax, %rax
+	jne	.L1160
+	testq	%r15, %r15
+	je	.L1115
+.L1114:
+	movq	96(%r12), %rdi
+	leaq	64(%rsp), %rsi
+	movl	$8, %ecx
+	leaq	0(,%r14,8), %rdx
+	movq	%rsi, (%rsp)
+	movq	%r15, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	88(%r12), %rax
+	jmp	.L1115
+.L1158:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	testl	%eax, %eax
+	je	.L1102
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1102
+.L1160:
+	movq	%r15, %rsi
+	call	memcpy@PLT
+	jmp	.L1114
+.L1159:
+	leaq	5(%r13), %rax
+	movq	168(%r14), %rdi
+	leaq	(%rax,%rax), %rdx
+	salq	$4, %rax
+	movq	%rax, %rsi
+	movq	(%rdi), %rax
+	movq	%rdx, 152(%r14)
+	leaq	64(%rsp), %rdx
+	movq	%rdx, (%rsp)
+	movl	$8, %edx
+	call	*16(%rax)
+	movq	%rax, 144(%r14)
+	movq	%rax, %rdi
+	movq	160(%r14), %rax
+	movq	%r15, (%rdi,%rax,8)
+	leaq	0(,%rax,8), %rdx
+	testq	%rax, %rax
+	jne	.L1161
+	cmpq	$0, 24(%rsp)
+	je	.L1110
+.L1109:
+	movq	168(%r14), %rdi
+	leaq	64(%rsp), %rsi
+	movl	$8, %ecx
+	leaq	0(,%r13,8), %rdx
+	movq	%rsi, (%rsp)
+	movq	24(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE53:
+	movq	160(%r14), %rax
+	jmp	.L1110
+.L1161:
+	movq	24(%rsp), %rsi
+	call	memcpy@PLT
+	jmp	.L1109
+.L1129:
+	movq	%rax, %rbx
+	jmp	.L1128
+	.section	.gcc_except_table
+.LLSDA6809:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6809-.LLSDACSB6809
+.LLSDACSB6809:
+	.uleb128 .LEHB51-.LFB6809
+	.uleb128 .LEHE51-.LEHB51
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB52-.LFB6809
+	.uleb128 .LEHE52-.LEHB52
+	.uleb128 .L1129-.LFB6809
+	.uleb128 0
+	.uleb128 .LEHB53-.LFB6809
+	.uleb128 .LEHE53-.LEHB53
+	.uleb128 .L1129-.LFB6809
+	.uleb128 0
+.LLSDACSE6809:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6809
+	.type	_Z3fibRN1n11thread_poolEi.cold, @function
+_Z3fibRN1n11thread_poolEi.cold:
+.LFSB6809:
+.L1128:
+	.cfi_def_cfa_offset 816
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	(%rsp), %rdi
+	call	_ZN1n10task_groupD1Ev
+	movq	%rbx, %rdi
+.LEHB54:
+	call	_Unwind_Resume@PLT
+.LEHE54:
+	.cfi_endproc
+.LFE6809:
+	.section	.gcc_except_table
+.LLSDAC6809:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6809-.LLSDACSBC6809
+.LLSDACSBC6809:
+	.uleb128 .LEHB54-.LCOLDB32
+	.uleb128 .LEHE54-.LEHB54
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6809:
+	.section	.text.unlikely
+	.text
+	.size	_Z3fibRN1n11thread_poolEi, .-_Z3fibRN1n11thread_poolEi
+	.section	.text.unlikely
+	.size	_Z3fibRN1n11thread_poolEi.cold, .-_Z3fibRN1n11thread_poolEi.cold
+.LCOLDE32:
+	.text
+.LHOTE32:
+	.p2align 4
+	.type	_ZN1n4taskUlPvE8_4_FUNES1_, @function
+_ZN1n4taskUlPvE8_4_FUNES1_:
+.LFB6926:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	16(%rdi), %rax
+	movq	(%rdi), %rbx
+	movq	8(%rdi), %rdi
+	movl	(%rax), %esi
+	subl	$1, %esi
+	call	_Z3fibRN1n11thread_poolEi
+	movq	%rax, (%rbx)
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE6926:
+	.size	_ZN1n4taskUlPvE8_4_FUNES1_, .-_ZN1n4taskUlPvE8_4_FUNES1_
+	.section	.rodata.str1.8
+	.align 8
+.LC33:
+	.string	"expected equal : expected value : fib(pool, 25), actual value : 75025"
+	.section	.text.unlikely
+.LCOLDB34:
+	.text
+.LHOTB34:
+	.p2align 4
+	.globl	_Z19test_pool_fork_joinv
+	.type	_Z19test_pool_fork_joinv, @function
+_Z19test_pool_fork_joinv:
+.LFB6811:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6811
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$1000, %rsp
+	.cfi_def_cfa_offset 1056
+	leaq	56(%rsp), %rax
+	movq	%rax, %xmm0
+	leaq	64(%rsp), %rax
+	movq	%rax, %xmm1
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	movq	%rax, 16(%rsp)
+	punpcklqdq	%xmm1, %xmm0
+	movaps	%xmm0, (%rsp)
+.LEHB55:
+	call	_ZN1n11thread_poolC2Em.constprop.2
+.LEHE55:
+	leaq	52(%rsp), %rax
+	movdqa	(%rsp), %xmm0
+	movq	%rbx, 304(%rsp)
+	movq	%rax, 352(%rsp)
+	leaq	_ZN1n4task8__ops_ofIZ3fibRNS_11thread_poolEiEUlvE_EE(%rip), %rax
+	leaq	320(%rsp), %rbx
+	movq	%rax, 384(%rsp)
+	leaq	312(%rsp), %rax
+	movl	$25, 52(%rsp)
+	movq	$0, 56(%rsp)
+	movq	$0, 312(%rsp)
+	movq	$0, 320(%rsp)
+	movq	%rbx, 976(%rsp)
+	movq	$1, 328(%rsp)
+	movq	$0, 392(%rsp)
+	movq	%rax, 400(%rsp)
+	movaps	%xmm0, 336(%rsp)
+	lock addq	$1, 312(%rsp)
+	movq	%fs:_ZN1n16__current_workerE@tpoff, %r13
+	movq	304(%rsp), %r12
+	testq	%r13, %r13
+	je	.L1165
+	cmpq	0(%r13), %r12
+	jne	.L1165
+	movq	128(%r13), %rcx
+	movq	%rcx, 32(%rsp)
+	movq	64(%r13), %rsi
+	movq	%rsi, 40(%rsp)
+	subq	%rsi, %rcx
+	movq	%rsi, 24(%rsp)
+	movq	136(%r13), %r14
+	movq	(%r14), %rax
+	cmpq	%rcx, %rax
+	jle	.L1266
+.L1166:
+	movq	32(%rsp), %rsi
+	movq	8(%r14), %rdx
+	subq	$1, %rax
+	leaq	336(%rsp), %rcx
+	andq	%rsi, %rax
+	movq	%rcx, (%rdx,%rax,8)
+	movq	%rsi, %rax
+	addq	$1, %rax
+	movq	%rax, 128(%r13)
+.L1177:
+	lock addq	$1, 208(%r12)
+	movq	216(%r12), %rax
+	testq	%rax, %rax
+	jne	.L1267
+.L1182:
+	movl	52(%rsp), %eax
+	movq	16(%rsp), %rdi
+	leal	-2(%rax), %esi
+	leaq	304(%rsp), %rax
+	movq	%rax, (%rsp)
+.LEHB56:
+	call	_Z3fibRN1n11thread_poolEi
+	leaq	304(%rsp), %r15
+	movq	%rax, %r14
+	movq	%r15, %rdi
+	movq	%r15, (%rsp)
+	call	_ZN1n10task_group4syncEv
+.LEHE56:
+	addq	56(%rsp), %r14
+	movq	%r15, %rdi
+	movq	%rbx, %r15
+	movq	%r14, (%rsp)
+	call	_ZN1n10task_group4syncEv
+	.p2align 4,,10
+	.p2align 3
+.L1193:
+	movq	%r15, %r13
+	xorl	%r14d, %r14d
+	movq	(%r15), %r15
+	movq	8(%r13), %r12
+	leaq	16(%r13), %rbp
+	testq	%r12, %r12
+	je	.L1188
+	.p2align 4,,10
+	.p2align 3
+.L1189:
+	movq	48(%rbp), %rcx
+	testq	%rcx, %rcx
+	je	.L1186
+	addq	$1, %r14
+	movq	56(%rbp), %rsi
+	movq	%rbp, %rdi
+	addq	$80, %rbp
+	call	*16(%rcx)
+	cmpq	%r14, %r12
+	jne	.L1189
+.L1188:
+	cmpq	%rbx, %r13
+	je	.L1185
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1268
+.L1191:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$16, %ecx
+	movl	$656, %edx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1185:
+	testq	%r15, %r15
+	jne	.L1193
+	cmpq	$75025, (%rsp)
+	jne	.L1269
+	leaq	184(%rsp), %rbx
+	movq	%rbx, %rdi
+	movq	%rbx, (%rsp)
+	call	pthread_mutex_lock@PLT
+	movb	$1, 288(%rsp)
+	lock addq	$1, 272(%rsp)
+	leaq	224(%rsp), %rax
+	movq	%rax, %rdi
+	movq	%rax, 16(%rsp)
+	call	pthread_cond_broadcast@PLT
+	movq	%rbx, %rdi
+	xorl	%ebx, %ebx
+	call	pthread_mutex_unlock@PLT
+	cmpq	$0, 80(%rsp)
+	je	.L1201
+	.p2align 4,,10
+	.p2align 3
+.L1198:
+	movq	64(%rsp), %rax
+	xorl	%esi, %esi
+	movq	(%rax,%rbx,8), %rax
+	addq	$1, %rbx
+	movq	24(%rax), %rdi
+	call	pthread_join@PLT
+	movq	80(%rsp), %rax
+	cmpq	%rax, %rbx
+	jb	.L1198
+	testq	%rax, %rax
+	je	.L1201
+	xorl	%ebp, %ebp
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %r13
+	.p2align 4,,10
+	.p2align 3
+.L1215:
+	movq	64(%rsp), %rax
+	movq	(%rax,%rbp,8), %r15
+	movq	136(%r15), %r14
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1270
+.L1203:
+	movq	(%r14), %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%r14, %rsi
+	movl	$8, %ecx
+	xorl	%r14d, %r14d
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	$0, 160(%r15)
+	jne	.L1205
+	jmp	.L1211
+	.p2align 4,,10
+	.p2align 3
+.L1209:
+	movq	(%r12), %rax
+	movl	$8, %ecx
+	movq	%r12, %rsi
+	addq	$1, %r14
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	leaq	16(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	160(%r15), %r14
+	jnb	.L1211
+.L1205:
+	movq	144(%r15), %rax
+	movq	(%rax,%r14,8), %r12
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L1209
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1209
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%r13, _ZZN1n4heapEvE7storage(%rip)
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1209
+.L1165:
+	leaq	32(%r12), %r14
+	movq	%r14, %rdi
+	call	pthread_mutex_lock@PLT
+	movq	88(%r12), %rax
+	movq	80(%r12), %r13
+	cmpq	%r13, %rax
+	je	.L1271
+	movq	72(%r12), %rdx
+	leaq	336(%rsp), %rcx
+	movq	%rcx, (%rdx,%rax,8)
+.L1181:
+	addq	$1, %rax
+	movq	%rax, 88(%r12)
+	lock addq	$1, 112(%r12)
+	movq	%r14, %rdi
+	call	pthread_mutex_unlock@PLT
+	jmp	.L1177
+	.p2align 4,,10
+	.p2align 3
+.L1211:
+	movq	144(%r15), %rsi
+	testq	%rsi, %rsi
+	je	.L1207
+	movq	152(%r15), %rax
+	movq	168(%r15), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1207:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1272
+.L1213:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$64, %ecx
+	movl	$192, %edx
+	movq	%r15, %rsi
+	addq	$1, %rbp
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	80(%rsp), %rbp
+	jb	.L1215
+.L1201:
+	movq	16(%rsp), %rdi
+	call	pthread_cond_destroy@PLT
+	movq	(%rsp), %rdi
+	call	pthread_mutex_destroy@PLT
+	leaq	96(%rsp), %rdi
+	call	pthread_mutex_destroy@PLT
+	movq	136(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L1200
+	movq	144(%rsp), %rax
+	movq	160(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1200:
+	movq	64(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L1164
+	movq	72(%rsp), %rax
+	movq	88(%rsp), %rdi
+	movl	$8, %ecx
+	leaq	0(,%rax,8), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1164:
+	addq	$1000, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1186:
+	.cfi_restore_state
+	addq	$1, %r14
+	addq	$80, %rbp
+	cmpq	%r14, %r12
+	jne	.L1189
+	jmp	.L1188
+	.p2align 4,,10
+	.p2align 3
+.L1272:
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1213
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1213
+	.p2align 4,,10
+	.p2align 3
+.L1270:
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1203
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1203
+.L1268:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1191
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1191
+.L1267:
+	leaq	120(%r12), %r13
+	movq	%r13, %rdi
+	call	pthread_mutex_lock@PLT
+	leaq	160(%r12), %rdi
+	call	pthread_cond_broadcast@PLT
+	movq	%r13, %rdi
+	call	pthread_mutex_unlock@PLT
+	jmp	.L1182
+.L1266:
+	addq	%rax, %rax
+	movq	%rax, %rbp
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1273
+.L1168:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	leaq	304(%rsp), %rcx
+	movl	$8, %edx
+	leaq	16(,%rbp,8), %rsi
+	movq	%rcx, (%rsp)
+	movq	(%rdi), %rax
+.LEHB57:
+	call	*16(%rax)
+	movq	%rbp, (%rax)
+	movq	%rax, %r15
+	leaq	16(%rax), %rax
+	movq	40(%rsp), %rcx
+	movq	%rax, 8(%r15)
+	cmpq	%rcx, 32(%rsp)
+	jle	.L1173
+.L1170:
+	movq	(%r14), %rax
+	movq	24(%rsp), %rsi
+	movq	8(%r14), %rdx
+	subq	$1, %rax
+	andq	%rsi, %rax
+	movq	(%rdx,%rax,8), %rcx
+	movq	(%r15), %rax
+	movq	8(%r15), %rdx
+	subq	$1, %rax
+	andq	%rsi, %rax
+	addq	$1, %rsi
+	movq	%rcx, (%rdx,%rax,8)
+	movq	%rsi, 24(%rsp)
+	cmpq	%rsi, 32(%rsp)
+	jne	.L1170
+.L1173:
+	movq	152(%r13), %rcx
+	movq	160(%r13), %rax
+	movq	144(%r13), %rbp
+	movq	%rcx, 24(%rsp)
+	cmpq	%rcx, %rax
+	je	.L1274
+	movq	%r14, 0(%rbp,%rax,8)
+.L1176:
+	addq	$1, %rax
+	movq	%r15, %r14
+	movq	%rax, 160(%r13)
+	movq	%r15, 136(%r13)
+	movq	(%r15), %rax
+	jmp	.L1166
+.L1271:
+	leaq	5(%r13), %rax
+	movq	96(%r12), %rdi
+	movq	72(%r12), %r15
+	leaq	304(%rsp), %rcx
+	leaq	(%rax,%rax), %rdx
+	salq	$4, %rax
+	movq	%rcx, (%rsp)
+	movq	%rax, %rsi
+	movq	(%rdi), %rax
+	movq	%rdx, 80(%r12)
+	movl	$8, %edx
+	call	*16(%rax)
+	movq	%rax, 72(%r12)
+	movq	%rax, %rdi
+	movq	88(%r12), %rax
+	leaq	336(%rsp), %rcx
+	movq	%rcx, (%rdi,%rax,8)
+	leaq	0(,%rax,8), %rdx
+	testq	%rax, %rax
+	jne	.L1275
+	testq	%r15, %r15
+	je	.L1181
+.L1180:
+	movq	96(%r12), %rdi
+	leaq	304(%rsp), %rcx
+	leaq	0(,%r13,8), %rdx
+	movq	%r15, %rsi
+	movq	%rcx, (%rsp)
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	88(%r12), %rax
+	jmp	.L1181
+.L1273:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r15
+	movq	%r15, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1168
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r15, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1168
+.L1275:
+	movq	%r15, %rsi
+	call	memcpy@PLT
+	jmp	.L1180
+.L1274:
+	movq	%rcx, %rax
+	movq	168(%r13), %rdi
+	leaq	304(%rsp), %rcx
+	addq	$5, %rax
+	movq	%rcx, (%rsp)
+	leaq	(%rax,%rax), %rdx
+	salq	$4, %rax
+	movq	%rax, %rsi
+	movq	(%rdi), %rax
+	movq	%rdx, 152(%r13)
+	movl	$8, %edx
+	call	*16(%rax)
+	movq	%rax, 144(%r13)
+	movq	%rax, %rdi
+	movq	160(%r13), %rax
+	movq	%r14, (%rdi,%rax,8)
+	leaq	0(,%rax,8), %rdx
+	testq	%rax, %rax
+	jne	.L1276
+	testq	%rbp, %rbp
+	je	.L1176
+.L1175:
+	movq	168(%r13), %rdi
+	movq	24(%rsp), %rdx
+	leaq	304(%rsp), %rcx
+	movq	%rbp, %rsi
+	movq	%rcx, (%rsp)
+	movl	$8, %ecx
+	movq	(%rdi), %rax
+	salq	$3, %rdx
+	call	*24(%rax)
+.LEHE57:
+	movq	160(%r13), %rax
+	jmp	.L1176
+.L1276:
+	movq	%rbp, %rsi
+	call	memcpy@PLT
+	jmp	.L1175
+.L1269:
+	jmp	.L1194
+.L1220:
+	movq	%rax, %rbx
+	jmp	.L1196
+	.section	.gcc_except_table
+.LLSDA6811:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6811-.LLSDACSB6811
+.LLSDACSB6811:
+	.uleb128 .LEHB55-.LFB6811
+	.uleb128 .LEHE55-.LEHB55
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB56-.LFB6811
+	.uleb128 .LEHE56-.LEHB56
+	.uleb128 .L1220-.LFB6811
+	.uleb128 0
+	.uleb128 .LEHB57-.LFB6811
+	.uleb128 .LEHE57-.LEHB57
+	.uleb128 .L1220-.LFB6811
+	.uleb128 0
+.LLSDACSE6811:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6811
+	.type	_Z19test_pool_fork_joinv.cold, @function
+_Z19test_pool_fork_joinv.cold:
+.LFSB6811:
+.L1194:
+	.cfi_def_cfa_offset 1056
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC33(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB58:
+	call	__cxa_throw@PLT
+.LEHE58:
+.L1196:
+	movq	(%rsp), %rdi
+	call	_ZN1n10task_groupD1Ev
+.L1197:
+	movq	16(%rsp), %rdi
+	call	_ZN1n11thread_poolD1Ev
+	movq	%rbx, %rdi
+.LEHB59:
+	call	_Unwind_Resume@PLT
+.LEHE59:
+.L1219:
+	movq	%rax, %rbx
+	jmp	.L1197
+	.cfi_endproc
+.LFE6811:
+	.section	.gcc_except_table
+.LLSDAC6811:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6811-.LLSDACSBC6811
+.LLSDACSBC6811:
+	.uleb128 .LEHB58-.LCOLDB34
+	.uleb128 .LEHE58-.LEHB58
+	.uleb128 .L1219-.LCOLDB34
+	.uleb128 0
+	.uleb128 .LEHB59-.LCOLDB34
+	.uleb128 .LEHE59-.LEHB59
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6811:
+	.section	.text.unlikely
+	.text
+	.size	_Z19test_pool_fork_joinv, .-_Z19test_pool_fork_joinv
+	.section	.text.unlikely
+	.size	_Z19test_pool_fork_joinv.cold, .-_Z19test_pool_fork_joinv.cold
+.LCOLDE34:
+	.text
+.LHOTE34:
+	.section	.rodata.str1.1
+.LC35:
+	.string	"n::thread_pool tests"
+	.section	.rodata.str1.8
+	.align 8
+.LC36:
+	.string	"test_task_small_capture_inline"
+	.align 8
+.LC37:
+	.string	"test_task_large_capture_allocates"
+	.section	.rodata.str1.1
+.LC38:
+	.string	"test_deque_orders"
+.LC39:
+	.string	"test_pool_fork_join"
+.LC40:
+	.string	"test_pool_many_tasks"
+.LC41:
+	.string	"test_pool_nested_bulk"
+.LC42:
+	.string	"test_pool_without_workers"
+	.section	.text.unlikely
+.LCOLDB44:
+	.section	.text.startup,"ax",@progbits
+.LHOTB44:
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB6819:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6819
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$1600, %edi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 64
+.LEHB60:
+	call	_Znam@PLT
+.LEHE60:
+	movq	%rax, %rbx
+	leaq	1600(%rax), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L1278:
+	movq	$0, (%rax)
+	addq	$16, %rax
+	movq	$0, -8(%rax)
+	cmpq	%rax, %rdx
+	jne	.L1278
+	leaq	.LC35(%rip), %rax
+	movq	%rsp, %rdi
+	movq	%rbx, (%rsp)
+	movq	%rax, 16(%rsp)
+	leaq	.LC36(%rip), %rax
+	movq	%rax, (%rbx)
+	leaq	_Z30test_task_small_capture_inlinev(%rip), %rax
+	movq	%rax, 8(%rbx)
+	leaq	.LC37(%rip), %rax
+	movq	%rax, 16(%rbx)
+	leaq	_Z33test_task_large_capture_allocatesv(%rip), %rax
+	movq	%rax, 24(%rbx)
+	leaq	.LC38(%rip), %rax
+	movq	%rax, 32(%rbx)
+	leaq	_Z17test_deque_ordersv(%rip), %rax
+	movq	%rax, 40(%rbx)
+	leaq	.LC39(%rip), %rax
+	movq	%rax, 48(%rbx)
+	leaq	_Z19test_pool_fork_joinv(%rip), %rax
+	movq	%rax, 56(%rbx)
+	leaq	.LC40(%rip), %rax
+	movq	%rax, 64(%rbx)
+	leaq	_Z20test_pool_many_tasksv(%rip), %rax
+	movq	%rax, 72(%rbx)
+	leaq	.LC41(%rip), %rax
+	movq	%rax, 80(%rbx)
+	leaq	_Z21test_pool_nested_bulkv(%rip), %rax
+	movq	%rax, 88(%rbx)
+	leaq	.LC42(%rip), %rax
+	movq	%rax, 96(%rbx)
+	leaq	_Z25test_pool_without_workersv(%rip), %rax
+	movq	%rax, 104(%rbx)
+	movq	.LC43(%rip), %rax
+	movq	%rax, 8(%rsp)
+.LEHB61:
+	call	_ZN1n4test10test_suite7run_allEv
+.LEHE61:
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L1280:
+	.cfi_restore_state
+	movq	%rax, %rbp
+	jmp	.L1279
+	.section	.gcc_except_table
+.LLSDA6819:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6819-.LLSDACSB6819
+.LLSDACSB6819:
+	.uleb128 .LEHB60-.LFB6819
+	.uleb128 .LEHE60-.LEHB60
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB61-.LFB6819
+	.uleb128 .LEHE61-.LEHB61
+	.uleb128 .L1280-.LFB6819
+	.uleb128 0
+.LLSDACSE6819:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6819
+	.type	main.cold, @function
+main.cold:
+.LFSB6819:
+.L1279:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	movq	%rbp, %rdi
+.LEHB62:
+	call	_Unwind_Resume@PLT
+.LEHE62:
+	.cfi_endproc
+.LFE6819:
+	.section	.gcc_except_table
+.LLSDAC6819:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6819-.LLSDACSBC6819
+.LLSDACSBC6819:
+	.uleb128 .LEHB62-.LCOLDB44
+	.uleb128 .LEHE62-.LEHB62
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6819:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	main, .-main
+	.section	.text.unlikely
+	.size	main.cold, .-main.cold
+.LCOLDE44:
+	.section	.text.startup
+.LHOTE44:
+	.weak	_ZTSN1n15memory_resourceE
+	.section	.rodata._ZTSN1n15memory_resourceE,"aG",@progbits,_ZTSN1n15memory_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n15memory_resourceE, @object
+	.size	_ZTSN1n15memory_resourceE, 22
+_ZTSN1n15memory_resourceE:
+	.string	"N1n15memory_resourceE"
+	.weak	_ZTIN1n15memory_resourceE
+	.section	.data.rel.ro._ZTIN1n15memory_resourceE,"awG",@progbits,_ZTIN1n15memory_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n15memory_resourceE, @object
+	.size	_ZTIN1n15memory_resourceE, 16
+_ZTIN1n15memory_resourceE:
+	.quad	_ZTVN10__cxxabiv117__class_type_infoE+16
+	.quad	_ZTSN1n15memory_resourceE
+	.weak	_ZTSN1n13heap_resourceE
+	.section	.rodata._ZTSN1n13heap_resourceE,"aG",@progbits,_ZTSN1n13heap_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n13heap_resourceE, @object
+	.size	_ZTSN1n13heap_resourceE, 20
+_ZTSN1n13heap_resourceE:
+	.string	"N1n13heap_resourceE"
+	.weak	_ZTIN1n13heap_resourceE
+	.section	.data.rel.ro._ZTIN1n13heap_resourceE,"awG",@progbits,_ZTIN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n13heap_resourceE, @object
+	.size	_ZTIN1n13heap_resourceE, 24
+_ZTIN1n13heap_resourceE:
+	.quad	_ZTVN10__cxxabiv120__si_class_type_infoE+16
+	.quad	_ZTSN1n13heap_resourceE
+	.quad	_ZTIN1n15memory_resourceE
+	.weak	_ZTS17counting_resource
+	.section	.rodata._ZTS17counting_resource,"aG",@progbits,_ZTS17counting_resource,comdat
+	.align 16
+	.type	_ZTS17counting_resource, @object
+	.size	_ZTS17counting_resource, 20
+_ZTS17counting_resource:
+	.string	"17counting_resource"
+	.weak	_ZTI17counting_resource
+	.section	.data.rel.ro._ZTI17counting_resource,"awG",@progbits,_ZTI17counting_resource,comdat
+	.align 8
+	.type	_ZTI17counting_resource, @object
+	.size	_ZTI17counting_resource, 24
+_ZTI17counting_resource:
+	.quad	_ZTVN10__cxxabiv120__si_class_type_infoE+16
+	.quad	_ZTS17counting_resource
+	.quad	_ZTIN1n15memory_resourceE
+	.weak	_ZTVN1n13heap_resourceE
+	.section	.data.rel.ro.local._ZTVN1n13heap_resourceE,"awG",@progbits,_ZTVN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTVN1n13heap_resourceE, @object
+	.size	_ZTVN1n13heap_resourceE, 48
+_ZTVN1n13heap_resourceE:
+	.quad	0
+	.quad	_ZTIN1n13heap_resourceE
+	.quad	_ZN1n13heap_resourceD1Ev
+	.quad	_ZN1n13heap_resourceD0Ev
+	.quad	_ZN1n13heap_resource8allocateEmm
+	.quad	_ZN1n13heap_resource10deallocateEPvmm
+	.weak	_ZTV17counting_resource
+	.section	.data.rel.ro.local._ZTV17counting_resource,"awG",@progbits,_ZTV17counting_resource,comdat
+	.align 8
+	.type	_ZTV17counting_resource, @object
+	.size	_ZTV17counting_resource, 48
+_ZTV17counting_resource:
+	.quad	0
+	.quad	_ZTI17counting_resource
+	.quad	_ZN17counting_resourceD1Ev
+	.quad	_ZN17counting_resourceD0Ev
+	.quad	_ZN17counting_resource8allocateEmm
+	.quad	_ZN17counting_resource10deallocateEPvmm
+	.section	.data.rel.ro.local,"aw"
+	.align 16
+	.type	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZ25test_pool_without_workersvEUlmE_EEvmOT_EUlvE_EE, @object
+	.size	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZ25test_pool_without_workersvEUlmE_EEvmOT_EUlvE_EE, 24
+_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZ25test_pool_without_workersvEUlmE_EEvmOT_EUlvE_EE:
+	.quad	_ZN1n4taskUlPvE20_4_FUNES1_
+	.quad	_ZN1n4taskUlPvS1_E21_4_FUNES1_S1_
+	.quad	_ZN1n4taskUlPvPNS_15memory_resourceEE22_4_FUNES1_S3_
+	.align 16
+	.type	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZ21test_pool_nested_bulkvEUlmE_EEvmOT_EUlvE_EE, @object
+	.size	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZ21test_pool_nested_bulkvEUlmE_EEvmOT_EUlvE_EE, 24
+_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZ21test_pool_nested_bulkvEUlmE_EEvmOT_EUlvE_EE:
+	.quad	_ZN1n4taskUlPvE17_4_FUNES1_
+	.quad	_ZN1n4taskUlPvS1_E18_4_FUNES1_S1_
+	.quad	_ZN1n4taskUlPvPNS_15memory_resourceEE19_4_FUNES1_S3_
+	.align 16
+	.type	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZZ21test_pool_nested_bulkvENKUlmE_clEmEUlmE_EEvmOT_EUlvE_EE, @object
+	.size	_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZZ21test_pool_nested_bulkvENKUlmE_clEmEUlmE_EEvmOT_EUlvE_EE, 24
+_ZN1n4task8__ops_ofIZNS_11thread_pool4bulkIZZ21test_pool_nested_bulkvENKUlmE_clEmEUlmE_EEvmOT_EUlvE_EE:
+	.quad	_ZN1n4taskUlPvE14_4_FUNES1_
+	.quad	_ZN1n4taskUlPvS1_E15_4_FUNES1_S1_
+	.quad	_ZN1n4taskUlPvPNS_15memory_resourceEE16_4_FUNES1_S3_
+	.align 16
+	.type	_ZN1n4task8__ops_ofIZ20test_pool_many_tasksvEUlvE_EE, @object
+	.size	_ZN1n4task8__ops_ofIZ20test_pool_many_tasksvEUlvE_EE, 24
+_ZN1n4task8__ops_ofIZ20test_pool_many_tasksvEUlvE_EE:
+	.quad	_ZN1n4taskUlPvE11_4_FUNES1_
+	.quad	_ZN1n4taskUlPvS1_E12_4_FUNES1_S1_
+	.quad	_ZN1n4taskUlPvPNS_15memory_resourceEE13_4_FUNES1_S3_
+	.align 16
+	.type	_ZN1n4task8__ops_ofIZ3fibRNS_11thread_poolEiEUlvE_EE, @object
+	.size	_ZN1n4task8__ops_ofIZ3fibRNS_11thread_poolEiEUlvE_EE, 24
+_ZN1n4task8__ops_ofIZ3fibRNS_11thread_poolEiEUlvE_EE:
+	.quad	_ZN1n4taskUlPvE8_4_FUNES1_
+	.quad	_ZN1n4taskUlPvS1_E9_4_FUNES1_S1_
+	.quad	_ZN1n4taskUlPvPNS_15memory_resourceEE10_4_FUNES1_S3_
+	.align 16
+	.type	_ZN1n4task8__ops_ofIZ33test_task_large_capture_allocatesvEUlvE_EE, @object
+	.size	_ZN1n4task8__ops_ofIZ33test_task_large_capture_allocatesvEUlvE_EE, 24
+_ZN1n4task8__ops_ofIZ33test_task_large_capture_allocatesvEUlvE_EE:
+	.quad	_ZN1n4taskUlPvE5_4_FUNES1_
+	.quad	_ZN1n4taskUlPvS1_E6_4_FUNES1_S1_
+	.quad	_ZN1n4taskUlPvPNS_15memory_resourceEE7_4_FUNES1_S3_
+	.align 16
+	.type	_ZN1n4task8__ops_ofIZ30test_task_small_capture_inlinevEUlvE_EE, @object
+	.size	_ZN1n4task8__ops_ofIZ30test_task_small_capture_inlinevEUlvE_EE, 24
+_ZN1n4task8__ops_ofIZ30test_task_small_capture_inlinevEUlvE_EE:
+	.quad	_ZN1n4taskUlPvE2_4_FUNES1_
+	.quad	_ZN1n4taskUlPvS1_E3_4_FUNES1_S1_
+	.quad	_ZN1n4taskUlPvPNS_15memory_resourceEE4_4_FUNES1_S3_
+	.weak	_ZN1n16__current_workerE
+	.section	.tbss._ZN1n16__current_workerE,"awTG",@nobits,_ZN1n16__current_workerE,comdat
+	.align 8
+	.type	_ZN1n16__current_workerE, @gnu_unique_object
+	.size	_ZN1n16__current_workerE, 8
+_ZN1n16__current_workerE:
+	.zero	8
+	.weak	_ZN1n18__current_resourceE
+	.section	.tbss._ZN1n18__current_resourceE,"awTG",@nobits,_ZN1n18__current_resourceE,comdat
+	.align 8
+	.type	_ZN1n18__current_resourceE, @gnu_unique_object
+	.size	_ZN1n18__current_resourceE, 8
+_ZN1n18__current_resourceE:
+	.zero	8
+	.weak	_ZGVZN1n4heapEvE3res
+	.section	.bss._ZGVZN1n4heapEvE3res,"awG",@nobits,_ZGVZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZGVZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZGVZN1n4heapEvE3res, 8
+_ZGVZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE3res
+	.section	.bss._ZZN1n4heapEvE3res,"awG",@nobits,_ZZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZZN1n4heapEvE3res, 8
+_ZZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE7storage
+	.section	.bss._ZZN1n4heapEvE7storage,"awG",@nobits,_ZZN1n4heapEvE7storage,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE7storage, @gnu_unique_object
+	.size	_ZZN1n4heapEvE7storage, 8
+_ZZN1n4heapEvE7storage:
+	.zero	8
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC0:
+	.quad	1
+	.quad	2
+	.section	.rodata.cst2,"aM",@progbits,2
+	.align 2
+.LC24:
+	.byte	10
+	.byte	0
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC43:
+	.long	7
+	.long	100
+	.hidden	DW.ref._ZTIPKc
+	.weak	DW.ref._ZTIPKc
+	.section	.data.rel.local.DW.ref._ZTIPKc,"awG",@progbits,DW.ref._ZTIPKc,comdat
+	.align 8
+	.type	DW.ref._ZTIPKc, @object
+	.size	DW.ref._ZTIPKc, 8
+DW.ref._ZTIPKc:
+	.quad	_ZTIPKc
+	.hidden	DW.ref.__gxx_personality_v0
+	.weak	DW.ref.__gxx_personality_v0
+	.section	.data.rel.local.DW.ref.__gxx_personality_v0,"awG",@progbits,DW.ref.__gxx_personality_v0,comdat
+	.align 8
+	.type	DW.ref.__gxx_personality_v0, @object
+	.size	DW.ref.__gxx_personality_v0, 8
+DW.ref.__gxx_personality_v0:
+	.quad	__gxx_personality_v0
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
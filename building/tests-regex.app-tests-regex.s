@@ -0,0 +1,4579 @@
+	.file	"tests-regex.cpp"
+	.text
+	.section	.text._ZN1n13heap_resourceD2Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD2Ev
+	.type	_ZN1n13heap_resourceD2Ev, @function
+_ZN1n13heap_resourceD2Ev:
+.LFB7120:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7120:
+	.size	_ZN1n13heap_resourceD2Ev, .-_ZN1n13heap_resourceD2Ev
+	.weak	_ZN1n13heap_resourceD1Ev
+	.set	_ZN1n13heap_resourceD1Ev,_ZN1n13heap_resourceD2Ev
+	.section	.text._ZN1n13heap_resource10deallocateEPvmm,"axG",@progbits,_ZN1n13heap_resource10deallocateEPvmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource10deallocateEPvmm
+	.type	_ZN1n13heap_resource10deallocateEPvmm, @function
+_ZN1n13heap_resource10deallocateEPvmm:
+.LFB56:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rcx
+	jbe	.L4
+	movq	%rcx, %rsi
+	jmp	_ZdlPvSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	jmp	_ZdlPv@PLT
+	.cfi_endproc
+.LFE56:
+	.size	_ZN1n13heap_resource10deallocateEPvmm, .-_ZN1n13heap_resource10deallocateEPvmm
+	.section	.text._ZN1n13heap_resource8allocateEmm,"axG",@progbits,_ZN1n13heap_resource8allocateEmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource8allocateEmm
+	.type	_ZN1n13heap_resource8allocateEmm, @function
+_ZN1n13heap_resource8allocateEmm:
+.LFB55:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rdx
+	jbe	.L6
+	movq	%rdx, %rsi
+	jmp	_ZnwmSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	jmp	_Znwm@PLT
+	.cfi_endproc
+.LFE55:
+	.size	_ZN1n13heap_resource8allocateEmm, .-_ZN1n13heap_resource8allocateEmm
+	.section	.text._ZN1n13heap_resourceD0Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD0Ev
+	.type	_ZN1n13heap_resourceD0Ev, @function
+_ZN1n13heap_resourceD0Ev:
+.LFB7122:
+	.cfi_startproc
+	movl	$8, %esi
+	jmp	_ZdlPvm@PLT
+	.cfi_endproc
+.LFE7122:
+	.size	_ZN1n13heap_resourceD0Ev, .-_ZN1n13heap_resourceD0Ev
+	.section	.text._ZN1n4fileIcLNS_4modeE6EED2Ev,"axG",@progbits,_ZN1n4fileIcLNS_4modeE6EED5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4fileIcLNS_4modeE6EED2Ev
+	.type	_ZN1n4fileIcLNS_4modeE6EED2Ev, @function
+_ZN1n4fileIcLNS_4modeE6EED2Ev:
+.LFB6945:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6945
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movl	(%rdi), %ebp
+	testl	%ebp, %ebp
+	js	.L9
+	cmpl	$2, 8(%rdi)
+	je	.L59
+.L10:
+	cmpb	$0, 4(%rbx)
+	jne	.L60
+.L15:
+	movl	$-1, (%rbx)
+.L9:
+	cmpq	$0, 16(%rbx)
+	je	.L16
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L61
+.L18:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	$0, 16(%rbx)
+.L16:
+	movq	48(%rbx), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 8(%rbx)
+	movups	%xmm0, 32(%rbx)
+	testq	%rdi, %rdi
+	je	.L20
+	call	fclose@PLT
+	movl	(%rbx), %ebp
+	movq	$0, 48(%rbx)
+	testl	%ebp, %ebp
+	js	.L57
+	cmpl	$2, 8(%rbx)
+	jne	.L24
+	movq	40(%rbx), %r12
+	testq	%r12, %r12
+	jne	.L62
+.L24:
+	cmpb	$0, 4(%rbx)
+	jne	.L63
+.L30:
+	movl	$-1, (%rbx)
+.L57:
+	movq	16(%rbx), %rax
+	testq	%rax, %rax
+	je	.L8
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L64
+.L33:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L8:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L59:
+	.cfi_restore_state
+	movq	40(%rdi), %r12
+	testq	%r12, %r12
+	je	.L10
+	movq	16(%rdi), %r13
+.L14:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L65
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L14
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	movq	$0, 40(%rbx)
+	jmp	.L10
+	.p2align 4,,10
+	.p2align 3
+.L20:
+	movl	(%rbx), %eax
+	testl	%eax, %eax
+	js	.L8
+	cmpb	$0, 4(%rbx)
+	je	.L30
+.L63:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L30
+	.p2align 4,,10
+	.p2align 3
+.L60:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L15
+	.p2align 4,,10
+	.p2align 3
+.L64:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L33
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L33
+	.p2align 4,,10
+	.p2align 3
+.L61:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L18
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L18
+	.p2align 4,,10
+	.p2align 3
+.L62:
+	movq	16(%rbx), %r13
+.L29:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L66
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L29
+	.p2align 4,,10
+	.p2align 3
+.L28:
+	movq	$0, 40(%rbx)
+	jmp	.L24
+	.p2align 4,,10
+	.p2align 3
+.L65:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L13
+	jmp	.L14
+	.p2align 4,,10
+	.p2align 3
+.L66:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L28
+	jmp	.L29
+	.cfi_endproc
+.LFE6945:
+	.globl	__gxx_personality_v0
+	.section	.gcc_except_table._ZN1n4fileIcLNS_4modeE6EED2Ev,"aG",@progbits,_ZN1n4fileIcLNS_4modeE6EED5Ev,comdat
+.LLSDA6945:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6945-.LLSDACSB6945
+.LLSDACSB6945:
+.LLSDACSE6945:
+	.section	.text._ZN1n4fileIcLNS_4modeE6EED2Ev,"axG",@progbits,_ZN1n4fileIcLNS_4modeE6EED5Ev,comdat
+	.size	_ZN1n4fileIcLNS_4modeE6EED2Ev, .-_ZN1n4fileIcLNS_4modeE6EED2Ev
+	.weak	_ZN1n4fileIcLNS_4modeE6EED1Ev
+	.set	_ZN1n4fileIcLNS_4modeE6EED1Ev,_ZN1n4fileIcLNS_4modeE6EED2Ev
+	.section	.text._ZN1n7fd_file5closeEv,"axG",@progbits,_ZN1n7fd_file5closeEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n7fd_file5closeEv
+	.type	_ZN1n7fd_file5closeEv, @function
+_ZN1n7fd_file5closeEv:
+.LFB153:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movl	(%rdi), %ebp
+	testl	%ebp, %ebp
+	js	.L68
+	cmpl	$2, 8(%rdi)
+	je	.L89
+.L69:
+	cmpb	$0, 4(%rbx)
+	jne	.L90
+.L74:
+	movl	$-1, (%rbx)
+.L68:
+	cmpq	$0, 16(%rbx)
+	je	.L75
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L91
+.L77:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	$0, 16(%rbx)
+.L75:
+	pxor	%xmm0, %xmm0
+	movl	$0, 8(%rbx)
+	movups	%xmm0, 32(%rbx)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L89:
+	.cfi_restore_state
+	movq	40(%rdi), %r12
+	testq	%r12, %r12
+	je	.L69
+	movq	16(%rdi), %r13
+.L73:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L92
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L73
+	.p2align 4,,10
+	.p2align 3
+.L72:
+	movq	$0, 40(%rbx)
+	jmp	.L69
+	.p2align 4,,10
+	.p2align 3
+.L90:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L74
+	.p2align 4,,10
+	.p2align 3
+.L91:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L77
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L77
+	.p2align 4,,10
+	.p2align 3
+.L92:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L72
+	jmp	.L73
+	.cfi_endproc
+.LFE153:
+	.size	_ZN1n7fd_file5closeEv, .-_ZN1n7fd_file5closeEv
+	.section	.text._ZN1n9simd_bestEv,"axG",@progbits,_ZN1n9simd_bestEv,comdat
+	.p2align 4
+	.weak	_ZN1n9simd_bestEv
+	.type	_ZN1n9simd_bestEv, @function
+_ZN1n9simd_bestEv:
+.LFB6556:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L109
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L109:
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L95
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L99
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L97:
+	movq	%rbx, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+.L95:
+.L101:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %eax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L99:
+	.cfi_restore_state
+	movl	$3, %eax
+	jmp	.L97
+	.cfi_endproc
+.LFE6556:
+	.size	_ZN1n9simd_bestEv, .-_ZN1n9simd_bestEv
+	.section	.rodata._ZN1n4test10test_suite7run_allEv.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"\nSUITE [%s] "
+.LC2:
+	.string	"%s"
+.LC3:
+	.string	"\nTEST [%s] "
+.LC4:
+	.string	" - Result : \033[1;32mPASSED\033[0m"
+.LC5:
+	.string	"\033[1;31merror : %s\033[0m\n"
+.LC6:
+	.string	" - Result : \033[1;31mFAILED\033[0m"
+.LC7:
+	.string	" - Passed : \033[1;32m%d\033[0m\n"
+.LC8:
+	.string	" - Failed : \033[1;31m%d\033[0m\n"
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4test10test_suite7run_allEv
+	.type	_ZN1n4test10test_suite7run_allEv, @function
+_ZN1n4test10test_suite7run_allEv:
+.LFB6910:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6910
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rdx
+	movl	$79, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	16(%rdi), %rcx
+	leaq	16(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L111
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L112
+	testb	$4, %cl
+	jne	.L165
+	testl	%ecx, %ecx
+	je	.L111
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L166
+	.p2align 4,,10
+	.p2align 3
+.L111:
+	movzwl	.LC1(%rip), %r15d
+	movq	%rbx, %rsi
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+.LEHB0:
+	call	printf@PLT
+	movl	8(%r12), %esi
+	testl	%esi, %esi
+	jle	.L132
+	movl	$0, 12(%rsp)
+	xorl	%ebp, %ebp
+	xorl	%r14d, %r14d
+	jmp	.L126
+	.p2align 4,,10
+	.p2align 3
+.L169:
+	testb	$4, %dl
+	jne	.L167
+	testl	%edx, %edx
+	je	.L117
+	movb	$42, (%rax)
+	testb	$2, %dl
+	jne	.L168
+	.p2align 4,,10
+	.p2align 3
+.L117:
+	movq	%rbx, %rsi
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+.LEHE0:
+	movq	(%r12), %rax
+.LEHB1:
+	call	*8(%rax,%r13)
+.LEHE1:
+	leaq	.LC4(%rip), %rdi
+	addl	$1, %r14d
+.LEHB2:
+	call	puts@PLT
+.L122:
+	addq	$1, %rbp
+	cmpl	%ebp, 8(%r12)
+	jle	.L116
+.L126:
+	movq	(%r12), %rax
+	movq	%rbp, %r13
+	movq	%rbx, %rdi
+	movl	$79, %esi
+	salq	$4, %r13
+	leaq	.LC3(%rip), %rdx
+	movq	(%rax,%r13), %rcx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L117
+	movl	$79, %edx
+	subl	%eax, %edx
+	addq	%rbx, %rax
+	cmpl	$8, %edx
+	jb	.L169
+	movabsq	$3038287259199220266, %rsi
+	leaq	8(%rax), %rdi
+	movl	%edx, %ecx
+	andq	$-8, %rdi
+	movq	%rsi, (%rax)
+	movq	%rsi, -8(%rax,%rcx)
+	subq	%rdi, %rax
+	leal	(%rdx,%rax), %ecx
+	movq	%rsi, %rax
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L117
+.L132:
+	movl	$0, 12(%rsp)
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L116:
+	movabsq	$5917806138674729738, %rax
+	movq	%rbx, %rdi
+	movq	%rax, 16(%rsp)
+	movabsq	$9095440486453792, %rax
+	movq	%rax, 22(%rsp)
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L127
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L128
+	testb	$4, %cl
+	jne	.L170
+	testl	%ecx, %ecx
+	je	.L127
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L171
+.L127:
+	movq	%rbx, %rsi
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+	movl	%r14d, %esi
+	leaq	.LC7(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	12(%rsp), %esi
+	leaq	.LC8(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	$10, %edi
+	call	putchar@PLT
+.LEHE2:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L128:
+	.cfi_restore_state
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L127
+.L112:
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L111
+.L167:
+	movl	$707406378, (%rax)
+	movl	$707406378, -4(%rax,%rdx)
+	jmp	.L117
+.L168:
+	movl	$10794, %ecx
+	movw	%cx, -2(%rax,%rdx)
+	jmp	.L117
+.L166:
+	movl	$10794, %edi
+	movw	%di, -2(%rdx,%rcx)
+	jmp	.L111
+.L171:
+	movl	$10794, %eax
+	movw	%ax, -2(%rdx,%rcx)
+	jmp	.L127
+.L165:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L111
+.L170:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L127
+.L133:
+	movq	%rax, %rdi
+	movq	%rdx, %rax
+.L123:
+	subq	$1, %rax
+	jne	.L164
+	call	__cxa_begin_catch@PLT
+	leaq	.LC5(%rip), %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+.LEHB3:
+	call	printf@PLT
+.LEHE3:
+	call	__cxa_end_catch@PLT
+	leaq	.LC6(%rip), %rdi
+	addl	$1, 12(%rsp)
+.LEHB4:
+	call	puts@PLT
+	jmp	.L122
+.L125:
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+.L164:
+	call	_Unwind_Resume@PLT
+.LEHE4:
+.L134:
+	movq	%rax, %rbx
+	jmp	.L125
+	.cfi_endproc
+.LFE6910:
+	.section	.gcc_except_table._ZN1n4test10test_suite7run_allEv,"aG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.align 4
+.LLSDA6910:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT6910-.LLSDATTD6910
+.LLSDATTD6910:
+	.byte	0x1
+	.uleb128 .LLSDACSE6910-.LLSDACSB6910
+.LLSDACSB6910:
+	.uleb128 .LEHB0-.LFB6910
+	.uleb128 .LEHE0-.LEHB0
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB1-.LFB6910
+	.uleb128 .LEHE1-.LEHB1
+	.uleb128 .L133-.LFB6910
+	.uleb128 0x1
+	.uleb128 .LEHB2-.LFB6910
+	.uleb128 .LEHE2-.LEHB2
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB3-.LFB6910
+	.uleb128 .LEHE3-.LEHB3
+	.uleb128 .L134-.LFB6910
+	.uleb128 0
+	.uleb128 .LEHB4-.LFB6910
+	.uleb128 .LEHE4-.LEHB4
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6910:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	DW.ref._ZTIPKc-.
+.LLSDATT6910:
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.size	_ZN1n4test10test_suite7run_allEv, .-_ZN1n4test10test_suite7run_allEv
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC9:
+	.string	"n::regex tests"
+.LC10:
+	.string	"test_search_sequence"
+.LC11:
+	.string	"test_search_leading_literal"
+	.section	.text.unlikely,"ax",@progbits
+.LCOLDB13:
+	.section	.text.startup,"ax",@progbits
+.LHOTB13:
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB6932:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6932
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$1600, %edi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 64
+.LEHB5:
+	call	_Znam@PLT
+.LEHE5:
+	movq	%rax, %rbx
+	leaq	1600(%rax), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L173:
+	movq	$0, (%rax)
+	addq	$16, %rax
+	movq	$0, -8(%rax)
+	cmpq	%rdx, %rax
+	jne	.L173
+	leaq	.LC9(%rip), %rax
+	movq	%rsp, %rdi
+	movq	%rbx, (%rsp)
+	movq	%rax, 16(%rsp)
+	leaq	.LC10(%rip), %rax
+	movq	%rax, (%rbx)
+	leaq	_Z20test_search_sequencev(%rip), %rax
+	movq	%rax, 8(%rbx)
+	leaq	.LC11(%rip), %rax
+	movq	%rax, 16(%rbx)
+	leaq	_Z27test_search_leading_literalv(%rip), %rax
+	movq	%rax, 24(%rbx)
+	movq	.LC12(%rip), %rax
+	movq	%rax, 8(%rsp)
+.LEHB6:
+	call	_ZN1n4test10test_suite7run_allEv
+.LEHE6:
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L175:
+	.cfi_restore_state
+	movq	%rax, %rbp
+	jmp	.L174
+	.section	.gcc_except_table,"a",@progbits
+.LLSDA6932:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6932-.LLSDACSB6932
+.LLSDACSB6932:
+	.uleb128 .LEHB5-.LFB6932
+	.uleb128 .LEHE5-.LEHB5
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB6-.LFB6932
+	.uleb128 .LEHE6-.LEHB6
+	.uleb128 .L175-.LFB6932
+	.uleb128 0
+.LLSDACSE6932:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6932
+	.type	main.cold, @function
+main.cold:
+.LFSB6932:
+.L174:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	movq	%rbp, %rdi
+.LEHB7:
+	call	_Unwind_Resume@PLT
+.LEHE7:
+	.cfi_endproc
+.LFE6932:
+	.section	.gcc_except_table
+.LLSDAC6932:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6932-.LLSDACSBC6932
+.LLSDACSBC6932:
+	.uleb128 .LEHB7-.LCOLDB13
+	.uleb128 .LEHE7-.LEHB7
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6932:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	main, .-main
+	.section	.text.unlikely
+	.size	main.cold, .-main.cold
+.LCOLDE13:
+	.section	.text.startup
+.LHOTE13:
+	.section	.rodata._ZN1n9__extractIcNS_5sliceIKcEENS_6rxlistIcEEJmEEENS_10extract_rcET0_NS_24extract_pattern_iteratorIT_EERNS_5maybeIT1_EEDpRNSB_IT2_EE.str1.1,"aMS",@progbits,1
+.LC14:
+	.string	"$-$"
+	.section	.text._ZN1n9__extractIcNS_5sliceIKcEENS_6rxlistIcEEJmEEENS_10extract_rcET0_NS_24extract_pattern_iteratorIT_EERNS_5maybeIT1_EEDpRNSB_IT2_EE,"axG",@progbits,_ZN1n9__extractIcNS_5sliceIKcEENS_6rxlistIcEEJmEEENS_10extract_rcET0_NS_24extract_pattern_iteratorIT_EERNS_5maybeIT1_EEDpRNSB_IT2_EE,comdat
+	.p2align 4
+	.weak	_ZN1n9__extractIcNS_5sliceIKcEENS_6rxlistIcEEJmEEENS_10extract_rcET0_NS_24extract_pattern_iteratorIT_EERNS_5maybeIT1_EEDpRNSB_IT2_EE
+	.type	_ZN1n9__extractIcNS_5sliceIKcEENS_6rxlistIcEEJmEEENS_10extract_rcET0_NS_24extract_pattern_iteratorIT_EERNS_5maybeIT1_EEDpRNSB_IT2_EE, @function
+_ZN1n9__extractIcNS_5sliceIKcEENS_6rxlistIcEEJmEEENS_10extract_rcET0_NS_24extract_pattern_iteratorIT_EERNS_5maybeIT1_EEDpRNSB_IT2_EE:
+.LFB7039:
+	.cfi_startproc
+	movq	%rcx, %r9
+	movq	%rdi, %rax
+	addq	%rdx, %rsi
+.L181:
+	cmpq	%rsi, %rdx
+	je	.L241
+	movzbl	(%rdx), %ecx
+	testb	%cl, %cl
+	je	.L217
+	leaq	1(%rdx), %rdi
+	cmpb	$36, %cl
+	je	.L184
+	addq	$1, %rax
+	cmpb	%cl, -1(%rax)
+	je	.L244
+	movl	$4, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L244:
+	movq	%rdi, %rdx
+	jmp	.L181
+	.p2align 4,,10
+	.p2align 3
+.L217:
+	movq	%rdx, %rdi
+.L184:
+	subq	%rdx, %rsi
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rax, %r10
+	leaq	.LC14(%rip), %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rsi, %rcx
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movl	$0, %ebx
+	je	.L183
+	.p2align 4,,10
+	.p2align 3
+.L198:
+	cmpb	$39, (%r10)
+	movl	$1, %edx
+	je	.L245
+.L188:
+	cmpq	%rdx, %rcx
+	je	.L192
+	movzbl	(%r12,%rdx), %r11d
+	testb	%r11b, %r11b
+	je	.L195
+	cmpb	$36, %r11b
+	je	.L195
+	addq	$1, %rdx
+	cmpb	%r11b, -1(%r10,%rdx)
+	je	.L188
+.L192:
+	testq	%rbx, %rbx
+	je	.L205
+	movq	%rsi, %rcx
+	movq	%rax, (%r9)
+	movq	%rsi, %rdx
+	movq	%rbx, 8(%r9)
+	subq	%rbx, %rcx
+	movb	$1, 16(%r9)
+	jmp	.L200
+	.p2align 4,,10
+	.p2align 3
+.L216:
+	testq	%rdx, %rdx
+	je	.L246
+.L200:
+	subq	$1, %rdx
+	cmpq	%rcx, %rdx
+	jne	.L216
+.L201:
+	addq	%rax, %rsi
+	addq	%rdi, %rcx
+	subq	%rdx, %rsi
+	cmpq	%rdi, %rcx
+	je	.L183
+.L247:
+	movzbl	(%rdi), %eax
+	testb	%al, %al
+	je	.L220
+	leaq	1(%rdi), %rdx
+	cmpb	$36, %al
+	je	.L203
+	addq	$1, %rsi
+	cmpb	%al, -1(%rsi)
+	jne	.L182
+	movq	%rdx, %rdi
+	cmpq	%rdi, %rcx
+	jne	.L247
+.L183:
+	movl	$5, %eax
+	jmp	.L180
+	.p2align 4,,10
+	.p2align 3
+.L205:
+	movl	$3, %eax
+.L180:
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L245:
+	.cfi_restore_state
+	cmpq	$1, %rcx
+	jne	.L191
+	jmp	.L189
+	.p2align 4,,10
+	.p2align 3
+.L248:
+	cmpq	%rdx, %rcx
+	je	.L192
+.L191:
+	movzbl	(%r10,%rdx), %r11d
+	movq	%rdx, %rbp
+	addq	$1, %rdx
+	cmpb	$39, %r11b
+	jne	.L248
+	cmpq	$-1, %rbp
+	je	.L192
+.L193:
+	cmpq	%rcx, %rdx
+	movq	%rcx, %r11
+	cmovbe	%rdx, %r11
+	addq	%rdx, %rbx
+	addq	%r11, %r10
+	subq	%r11, %rcx
+	jne	.L198
+	jmp	.L192
+.L220:
+	movq	%rdi, %rdx
+.L203:
+	subq	%rdi, %rcx
+	je	.L183
+	movzbl	(%rsi), %eax
+	subl	$48, %eax
+	cmpb	$9, %al
+	ja	.L205
+	movsbq	%al, %rax
+	cmpq	$1, %rcx
+	je	.L206
+	movl	$1, %r9d
+	jmp	.L208
+.L249:
+	leaq	(%rax,%rax,4), %rax
+	addq	$1, %r9
+	leaq	-48(%rdi,%rax,2), %rax
+	cmpq	%r9, %rcx
+	je	.L207
+.L208:
+	movsbq	(%rsi,%r9), %rdi
+	leal	-48(%rdi), %r10d
+	cmpb	$9, %r10b
+	jbe	.L249
+.L207:
+	movq	%rax, (%r8)
+	movb	$1, 8(%r8)
+	testq	%r9, %r9
+	je	.L205
+.L209:
+	movq	%rcx, %rdi
+	leaq	-1(%rcx), %rax
+	subq	%r9, %rdi
+	jmp	.L210
+	.p2align 4,,10
+	.p2align 3
+.L212:
+	subq	$1, %rax
+	jb	.L211
+.L210:
+	cmpq	%rax, %rdi
+	jne	.L212
+	leaq	(%rsi,%rcx), %rax
+	xorl	%ecx, %ecx
+	subq	%rdi, %rax
+.L215:
+	movzbl	(%rdx,%rcx), %esi
+	cmpq	%rdi, %rcx
+	je	.L213
+	testb	%sil, %sil
+	je	.L250
+	addq	$1, %rcx
+	cmpb	-1(%rax,%rcx), %sil
+	je	.L215
+.L182:
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	movl	$4, %eax
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L246:
+	.cfi_restore_state
+	xorl	%ecx, %ecx
+	jmp	.L201
+.L189:
+	addq	$2, %rbx
+	jmp	.L192
+.L195:
+	cmpq	%rdx, %rcx
+	je	.L192
+	movl	$3, %edx
+	jmp	.L193
+.L211:
+	movzbl	(%rdx), %esi
+.L213:
+	negb	%sil
+	sbbl	%eax, %eax
+	andl	$7, %eax
+	jmp	.L180
+.L250:
+	subq	%rcx, %rdi
+	negq	%rdi
+	sbbl	%eax, %eax
+	andl	$6, %eax
+	jmp	.L180
+.L206:
+	movq	%rax, (%r8)
+	movl	$1, %r9d
+	movb	$1, 8(%r8)
+	jmp	.L209
+.L241:
+	.cfi_def_cfa_offset 8
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	movl	$5, %eax
+	ret
+	.cfi_endproc
+.LFE7039:
+	.size	_ZN1n9__extractIcNS_5sliceIKcEENS_6rxlistIcEEJmEEENS_10extract_rcET0_NS_24extract_pattern_iteratorIT_EERNS_5maybeIT1_EEDpRNSB_IT2_EE, .-_ZN1n9__extractIcNS_5sliceIKcEENS_6rxlistIcEEJmEEENS_10extract_rcET0_NS_24extract_pattern_iteratorIT_EERNS_5maybeIT1_EEDpRNSB_IT2_EE
+	.section	.text._ZN1n12__horspool_nIcEEmPKT_mS3_m,"axG",@progbits,_ZN1n12__horspool_nIcEEmPKT_mS3_m,comdat
+	.p2align 4
+	.weak	_ZN1n12__horspool_nIcEEmPKT_mS3_m
+	.type	_ZN1n12__horspool_nIcEEmPKT_mS3_m, @function
+_ZN1n12__horspool_nIcEEmPKT_mS3_m:
+.LFB7090:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rcx, %xmm0
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	punpcklqdq	%xmm0, %xmm0
+	movq	%rdx, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rsi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rcx, %rbx
+	subq	$2072, %rsp
+	.cfi_def_cfa_offset 2128
+	leaq	16(%rsp), %rax
+	leaq	2064(%rsp), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L252:
+	movaps	%xmm0, (%rax)
+	addq	$16, %rax
+	cmpq	%rdx, %rax
+	jne	.L252
+	leaq	-1(%rbx), %r8
+	movq	%r14, %rax
+	leaq	-1(%r14,%rbx), %rdx
+	cmpq	$1, %rbx
+	jbe	.L274
+	.p2align 4,,10
+	.p2align 3
+.L256:
+	movzbl	(%rax), %ecx
+	movq	%rdx, %rsi
+	subq	%rax, %rsi
+	addq	$1, %rax
+	movq	%rsi, 16(%rsp,%rcx,8)
+	cmpq	%rdx, %rax
+	jne	.L256
+	movzbl	-1(%r14,%rbx), %ecx
+	cmpq	%rbx, %r13
+	jb	.L255
+.L257:
+	movq	%rbx, %rax
+	xorl	%ebp, %ebp
+.L261:
+	movzbl	-1(%r12,%rax), %r15d
+	cmpb	%r15b, %cl
+	je	.L275
+.L259:
+	addq	16(%rsp,%r15,8), %rbp
+	leaq	(%rbx,%rbp), %rax
+	cmpq	%rax, %r13
+	jnb	.L261
+.L255:
+	movq	$-1, %rbp
+.L251:
+	addq	$2072, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbp, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L275:
+	.cfi_restore_state
+	movq	%r8, %rdx
+	leaq	(%r12,%rbp), %rdi
+	movq	%r14, %rsi
+	movb	%cl, 15(%rsp)
+	movq	%r8, (%rsp)
+	call	memcmp@PLT
+	movq	(%rsp), %r8
+	movzbl	15(%rsp), %ecx
+	testl	%eax, %eax
+	je	.L251
+	jmp	.L259
+.L274:
+	movzbl	-1(%r14,%rbx), %ecx
+	cmpq	%rbx, %r13
+	jb	.L255
+	xorl	%ebp, %ebp
+	movl	$1, %eax
+	testq	%r8, %r8
+	jne	.L257
+	.p2align 4,,10
+	.p2align 3
+.L258:
+	movzbl	-1(%r12,%rax), %eax
+	cmpb	%cl, %al
+	je	.L251
+	addq	16(%rsp,%rax,8), %rbp
+	leaq	1(%rbp), %rax
+	cmpq	%rax, %r13
+	jnb	.L258
+	jmp	.L255
+	.cfi_endproc
+.LFE7090:
+	.size	_ZN1n12__horspool_nIcEEmPKT_mS3_m, .-_ZN1n12__horspool_nIcEEmPKT_mS3_m
+	.section	.text._ZN1n13__avx2_searchIcEEmPKT_mS3_m,"axG",@progbits,_ZN1n13__avx2_searchIcEEmPKT_mS3_m,comdat
+	.p2align 4
+	.weak	_ZN1n13__avx2_searchIcEEmPKT_mS3_m
+	.type	_ZN1n13__avx2_searchIcEEmPKT_mS3_m, @function
+_ZN1n13__avx2_searchIcEEmPKT_mS3_m:
+.LFB7104:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdx, %rax
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	movq	%rcx, %r14
+	pushq	%r13
+	pushq	%r12
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	xorl	%r12d, %r12d
+	pushq	%rbx
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	andq	$-32, %rsp
+	addq	$-128, %rsp
+	vpbroadcastb	(%rdx), %ymm4
+	vpbroadcastb	-1(%rdx,%rcx), %ymm5
+	movq	%rdx, 104(%rsp)
+	leaq	31(%rcx), %rdx
+	movq	%rsi, 96(%rsp)
+	movq	%rdx, 16(%rsp)
+	vmovdqa	%ymm4, 64(%rsp)
+	vmovdqa	%ymm5, 32(%rsp)
+	cmpq	%rdx, %rsi
+	jb	.L277
+	leaq	(%rdi,%rcx), %rsi
+	addq	$1, %rax
+	movq	%rsi, 24(%rsp)
+	leaq	-2(%rcx), %rsi
+	movq	%rsi, 120(%rsp)
+	movq	%rax, 112(%rsp)
+.L281:
+	movq	24(%rsp), %rax
+	vmovdqa	32(%rsp), %ymm2
+	vmovdqa	64(%rsp), %ymm3
+	vpcmpeqb	-1(%r12,%rax), %ymm2, %ymm0
+	vpcmpeqb	(%rbx,%r12), %ymm3, %ymm1
+	vpand	%ymm1, %ymm0, %ymm0
+	vpmovmskb	%ymm0, %r15d
+	testl	%r15d, %r15d
+	je	.L278
+	vzeroupper
+	jmp	.L280
+	.p2align 4,,10
+	.p2align 3
+.L306:
+	leal	-1(%r15), %eax
+	andl	%eax, %r15d
+	je	.L278
+.L280:
+	xorl	%ecx, %ecx
+	movq	120(%rsp), %rdx
+	movq	112(%rsp), %rsi
+	rep bsfl	%r15d, %ecx
+	movslq	%ecx, %rcx
+	leaq	(%rcx,%r12), %r13
+	leaq	1(%rbx,%r13), %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L306
+.L276:
+	leaq	-40(%rbp), %rsp
+	movq	%r13, %rax
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L278:
+	.cfi_restore_state
+	movq	16(%rsp), %rax
+	addq	$32, %r12
+	addq	%r12, %rax
+	cmpq	%rax, 96(%rsp)
+	jnb	.L281
+	subq	%r12, 96(%rsp)
+.L277:
+	cmpq	%r14, 96(%rsp)
+	jb	.L289
+	addq	%r12, %rbx
+	xorl	%r13d, %r13d
+	testq	%r14, %r14
+	je	.L302
+	.p2align 4,,10
+	.p2align 3
+.L282:
+	xorl	%eax, %eax
+	jmp	.L285
+	.p2align 4,,10
+	.p2align 3
+.L284:
+	addq	$1, %rax
+	cmpq	%rax, %r14
+	je	.L283
+.L285:
+	movq	104(%rsp), %rdx
+	movzbl	(%rdx,%rax), %esi
+	cmpb	%sil, (%rbx,%rax)
+	je	.L284
+	cmpq	%rax, %r14
+	je	.L283
+	addq	$1, %r13
+	addq	$1, %rbx
+	leaq	(%r14,%r13), %rax
+	cmpq	%rax, 96(%rsp)
+	jnb	.L282
+.L289:
+	movq	$-1, %r13
+	vzeroupper
+	jmp	.L276
+	.p2align 4,,10
+	.p2align 3
+.L283:
+	cmpq	$-1, %r13
+	je	.L303
+.L302:
+	addq	%r12, %r13
+	vzeroupper
+	jmp	.L276
+.L303:
+	vzeroupper
+	jmp	.L276
+	.cfi_endproc
+.LFE7104:
+	.size	_ZN1n13__avx2_searchIcEEmPKT_mS3_m, .-_ZN1n13__avx2_searchIcEEmPKT_mS3_m
+	.section	.text._ZN1n13__sse2_searchIcEEmPKT_mS3_m,"axG",@progbits,_ZN1n13__sse2_searchIcEEmPKT_mS3_m,comdat
+	.p2align 4
+	.weak	_ZN1n13__sse2_searchIcEEmPKT_mS3_m
+	.type	_ZN1n13__sse2_searchIcEEmPKT_mS3_m, @function
+_ZN1n13__sse2_searchIcEEmPKT_mS3_m:
+.LFB7105:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdx, %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rcx, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	xorl	%ebp, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movzbl	(%rdx), %eax
+	movq	%rsi, 40(%rsp)
+	movd	%eax, %xmm0
+	movzbl	-1(%rdx,%rcx), %eax
+	punpcklbw	%xmm0, %xmm0
+	punpcklwd	%xmm0, %xmm0
+	pshufd	$0, %xmm0, %xmm5
+	movd	%eax, %xmm0
+	leaq	15(%rcx), %rax
+	punpcklbw	%xmm0, %xmm0
+	movq	%rax, 88(%rsp)
+	punpcklwd	%xmm0, %xmm0
+	movaps	%xmm5, 48(%rsp)
+	pshufd	$0, %xmm0, %xmm6
+	movaps	%xmm6, 64(%rsp)
+	cmpq	%rax, %rsi
+	jb	.L308
+	leaq	(%rdi,%rcx), %rax
+	movq	%rax, 80(%rsp)
+	leaq	-2(%rcx), %rax
+	movq	%rax, 8(%rsp)
+	leaq	1(%rdx), %rax
+	movq	%rax, 32(%rsp)
+.L312:
+	movq	80(%rsp), %rax
+	movdqu	(%rbx,%rbp), %xmm1
+	movdqu	-1(%rax,%rbp), %xmm2
+	pcmpeqb	48(%rsp), %xmm1
+	movaps	%xmm2, 16(%rsp)
+	movdqa	16(%rsp), %xmm0
+	pcmpeqb	64(%rsp), %xmm0
+	pand	%xmm1, %xmm0
+	pmovmskb	%xmm0, %r13d
+	testl	%r13d, %r13d
+	jne	.L311
+	jmp	.L309
+	.p2align 4,,10
+	.p2align 3
+.L335:
+	leal	-1(%r13), %eax
+	andl	%eax, %r13d
+	je	.L309
+.L311:
+	xorl	%ecx, %ecx
+	movq	8(%rsp), %rdx
+	movq	32(%rsp), %rsi
+	rep bsfl	%r13d, %ecx
+	movslq	%ecx, %rcx
+	leaq	(%rcx,%rbp), %r12
+	leaq	1(%rbx,%r12), %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L335
+.L307:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%r12, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L309:
+	.cfi_restore_state
+	movq	88(%rsp), %rax
+	addq	$16, %rbp
+	addq	%rbp, %rax
+	cmpq	%rax, 40(%rsp)
+	jnb	.L312
+	subq	%rbp, 40(%rsp)
+.L308:
+	cmpq	%r14, 40(%rsp)
+	jb	.L320
+	addq	%rbp, %rbx
+	xorl	%r12d, %r12d
+	testq	%r14, %r14
+	je	.L333
+	.p2align 4,,10
+	.p2align 3
+.L313:
+	xorl	%eax, %eax
+	jmp	.L316
+	.p2align 4,,10
+	.p2align 3
+.L315:
+	addq	$1, %rax
+	cmpq	%rax, %r14
+	je	.L314
+.L316:
+	movzbl	(%r15,%rax), %edx
+	cmpb	%dl, (%rbx,%rax)
+	je	.L315
+	cmpq	%rax, %r14
+	je	.L314
+	addq	$1, %r12
+	addq	$1, %rbx
+	leaq	(%r14,%r12), %rax
+	cmpq	%rax, 40(%rsp)
+	jnb	.L313
+.L320:
+	movq	$-1, %r12
+	jmp	.L307
+	.p2align 4,,10
+	.p2align 3
+.L314:
+	cmpq	$-1, %r12
+	je	.L307
+.L333:
+	addq	%rbp, %r12
+	jmp	.L307
+	.cfi_endproc
+.LFE7105:
+	.size	_ZN1n13__sse2_searchIcEEmPKT_mS3_m, .-_ZN1n13__sse2_searchIcEEmPKT_mS3_m
+	.section	.rodata._ZN1n15search_sequenceIcNS_5sliceIKcEES3_EENS_6resultINS1_IKT_EENS_8match_rcEEET0_T1_.str1.1,"aMS",@progbits,1
+.LC15:
+	.string	"{$:$:$}"
+.LC16:
+	.string	"{$:$:}"
+.LC17:
+	.string	"{$::$}"
+	.section	.text._ZN1n15search_sequenceIcNS_5sliceIKcEES3_EENS_6resultINS1_IKT_EENS_8match_rcEEET0_T1_,"axG",@progbits,_ZN1n15search_sequenceIcNS_5sliceIKcEES3_EENS_6resultINS1_IKT_EENS_8match_rcEEET0_T1_,comdat
+	.p2align 4
+	.weak	_ZN1n15search_sequenceIcNS_5sliceIKcEES3_EENS_6resultINS1_IKT_EENS_8match_rcEEET0_T1_
+	.type	_ZN1n15search_sequenceIcNS_5sliceIKcEES3_EENS_6resultINS1_IKT_EENS_8match_rcEEET0_T1_, @function
+_ZN1n15search_sequenceIcNS_5sliceIKcEES3_EENS_6resultINS1_IKT_EENS_8match_rcEEET0_T1_:
+.LFB6965:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leaq	.LC15(%rip), %rax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rcx, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%r8, %r13
+	leaq	(%rax,%rdx), %r8
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	movq	%rsi, %rdi
+	movq	%rdx, %rsi
+	movq	%rdi, %r11
+	movq	%rdi, %rdx
+	leaq	(%rdi,%rsi), %r12
+	subq	$184, %rsp
+	.cfi_def_cfa_offset 240
+	movb	$0, 136(%rsp)
+	movb	$0, 160(%rsp)
+.L337:
+	cmpq	%r8, %rax
+	je	.L339
+	movzbl	(%rax), %ecx
+	testb	%cl, %cl
+	je	.L340
+	addq	$1, %rax
+	cmpb	$36, %cl
+	je	.L340
+	addq	$1, %rdx
+	cmpb	%cl, -1(%rdx)
+	je	.L337
+.L339:
+	leaq	.LC16(%rip), %rax
+	leaq	(%rax,%rsi), %rcx
+.L376:
+	cmpq	%rax, %rcx
+	je	.L380
+	movzbl	(%rax), %edx
+	testb	%dl, %dl
+	je	.L381
+	addq	$1, %rax
+	cmpb	$36, %dl
+	je	.L381
+	addq	$1, %r11
+	cmpb	%dl, -1(%r11)
+	je	.L376
+.L380:
+	leaq	144(%rsp), %rcx
+	leaq	128(%rsp), %r8
+	leaq	.LC17(%rip), %rdx
+	call	_ZN1n9__extractIcNS_5sliceIKcEENS_6rxlistIcEEJmEEENS_10extract_rcET0_NS_24extract_pattern_iteratorIT_EERNS_5maybeIT1_EEDpRNSB_IT2_EE
+	testl	%eax, %eax
+	jne	.L621
+	cmpb	$0, 160(%rsp)
+	je	.L621
+	cmpb	$0, 136(%rsp)
+	jne	.L622
+.L621:
+	movq	$1, 16(%rbx)
+	movl	$1, (%rbx)
+.L336:
+	addq	$184, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L622:
+	.cfi_restore_state
+	movq	128(%rsp), %rax
+	movq	144(%rsp), %r9
+	xorl	%ebp, %ebp
+	movq	152(%rsp), %rcx
+	testq	%rax, %rax
+	jne	.L462
+.L460:
+	pxor	%xmm0, %xmm0
+	movq	$0, (%rbx)
+	movups	%xmm0, 8(%rbx)
+	jmp	.L336
+	.p2align 4,,10
+	.p2align 3
+.L340:
+	movq	%r12, %r10
+	subq	%rdx, %r10
+	je	.L339
+	movq	%rax, (%rsp)
+	movq	%r10, %r8
+	movq	%rdx, %r9
+	xorl	%ebp, %ebp
+	movq	%r10, 8(%rsp)
+	leaq	.LC14(%rip), %r15
+	.p2align 4,,10
+	.p2align 3
+.L352:
+	cmpb	$39, (%r9)
+	movl	$1, %eax
+	je	.L623
+.L342:
+	cmpq	%r8, %rax
+	je	.L592
+	movzbl	(%r15,%rax), %ecx
+	testb	%cl, %cl
+	je	.L349
+	cmpb	$36, %cl
+	je	.L349
+	addq	$1, %rax
+	cmpb	%cl, -1(%r9,%rax)
+	je	.L342
+.L592:
+	movq	(%rsp), %rax
+	movq	8(%rsp), %r10
+.L346:
+	testq	%rbp, %rbp
+	je	.L339
+	movq	%r10, %rcx
+	movq	%rdx, 144(%rsp)
+	movq	%rbp, 152(%rsp)
+	subq	%rbp, %rcx
+	movb	$1, 160(%rsp)
+	jmp	.L353
+	.p2align 4,,10
+	.p2align 3
+.L378:
+	testq	%r10, %r10
+	je	.L624
+.L353:
+	subq	$1, %r10
+	cmpq	%rcx, %r10
+	jne	.L378
+.L354:
+	movq	%r12, %r9
+	subq	%r10, %r9
+	leaq	(%rax,%rcx), %r10
+	movq	%r9, %rdx
+.L355:
+	cmpq	%r10, %rax
+	je	.L339
+	movzbl	(%rax), %r8d
+	testb	%r8b, %r8b
+	je	.L356
+	addq	$1, %rax
+	cmpb	$36, %r8b
+	je	.L356
+	addq	$1, %rdx
+	cmpb	%r8b, -1(%rdx)
+	jne	.L339
+	jmp	.L355
+	.p2align 4,,10
+	.p2align 3
+.L623:
+	cmpq	$1, %r8
+	jne	.L345
+	jmp	.L343
+	.p2align 4,,10
+	.p2align 3
+.L625:
+	cmpq	%rax, %r8
+	je	.L592
+.L345:
+	movzbl	(%r9,%rax), %ecx
+	movq	%rax, %r10
+	addq	$1, %rax
+	cmpb	$39, %cl
+	jne	.L625
+	cmpq	$-1, %r10
+	je	.L592
+.L347:
+	cmpq	%rax, %r8
+	movq	%rax, %rcx
+	cmovbe	%r8, %rcx
+	addq	%rax, %rbp
+	addq	%rcx, %r9
+	subq	%rcx, %r8
+	jne	.L352
+	jmp	.L592
+.L462:
+	testq	%rcx, %rcx
+	jne	.L409
+.L422:
+	xorl	%eax, %eax
+	movl	$1, %esi
+	xorl	%r11d, %r11d
+	movq	%rax, 56(%rsp)
+	movq	%rax, 96(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L437:
+	cmpq	%rbp, %r11
+	jb	.L458
+	testb	%sil, %sil
+	je	.L458
+	movq	96(%rsp), %rax
+	movq	$0, 16(%rbx)
+	cmpq	%rax, %r13
+	cmovbe	%r13, %rax
+	addq	%r14, %rax
+	movq	%rax, (%rbx)
+	movq	56(%rsp), %rax
+	movq	%rax, 8(%rbx)
+	jmp	.L336
+.L624:
+	xorl	%ecx, %ecx
+	jmp	.L354
+.L381:
+	movq	%r12, %r9
+	subq	%r11, %r9
+	je	.L380
+	movq	%r9, %rcx
+	movq	%r11, %r8
+	xorl	%r10d, %r10d
+	.p2align 4,,10
+	.p2align 3
+.L393:
+	cmpb	$39, (%r8)
+	movl	$1, %edx
+	je	.L626
+.L383:
+	cmpq	%rdx, %rcx
+	je	.L387
+	leaq	.LC14(%rip), %r15
+	movzbl	(%r15,%rdx), %ebp
+	testb	%bpl, %bpl
+	je	.L390
+	cmpb	$36, %bpl
+	je	.L390
+	addq	$1, %rdx
+	cmpb	%bpl, -1(%r8,%rdx)
+	je	.L383
+.L387:
+	testq	%r10, %r10
+	je	.L380
+	movq	%r9, %rdx
+	movq	%r11, 144(%rsp)
+	movq	%r10, 152(%rsp)
+	subq	%r10, %rdx
+	movb	$1, 160(%rsp)
+	jmp	.L394
+	.p2align 4,,10
+	.p2align 3
+.L410:
+	testq	%r9, %r9
+	je	.L627
+.L394:
+	subq	$1, %r9
+	cmpq	%rdx, %r9
+	jne	.L410
+.L395:
+	subq	%r9, %r12
+	leaq	(%rax,%rdx), %r9
+	movq	%r12, %rcx
+.L396:
+	cmpq	%r9, %rax
+	je	.L380
+	movzbl	(%rax), %r8d
+	testb	%r8b, %r8b
+	je	.L397
+	addq	$1, %rax
+	cmpb	$36, %r8b
+	je	.L397
+	addq	$1, %rcx
+	cmpb	%r8b, -1(%rcx)
+	jne	.L380
+	jmp	.L396
+	.p2align 4,,10
+	.p2align 3
+.L626:
+	cmpq	$1, %rcx
+	jne	.L386
+	jmp	.L384
+	.p2align 4,,10
+	.p2align 3
+.L628:
+	cmpq	%rcx, %rdx
+	je	.L387
+.L386:
+	movzbl	(%r8,%rdx), %ebp
+	movq	%rdx, %r15
+	addq	$1, %rdx
+	cmpb	$39, %bpl
+	jne	.L628
+	cmpq	$-1, %r15
+	je	.L387
+.L388:
+	cmpq	%rdx, %rcx
+	movq	%rdx, %rbp
+	cmovbe	%rcx, %rbp
+	addq	%rdx, %r10
+	addq	%rbp, %r8
+	subq	%rbp, %rcx
+	jne	.L393
+	jmp	.L387
+.L343:
+	movq	(%rsp), %rax
+	movq	8(%rsp), %r10
+	addq	$2, %rbp
+	jmp	.L346
+.L627:
+	xorl	%edx, %edx
+	jmp	.L395
+.L403:
+	movzbl	(%rax), %r8d
+.L405:
+	testb	%r8b, %r8b
+	jne	.L380
+.L407:
+	movb	$1, 136(%rsp)
+	movq	144(%rsp), %r9
+	movq	$-1, %rax
+	movq	$-1, 128(%rsp)
+	movq	152(%rsp), %rcx
+.L409:
+	movzbl	(%r9), %edx
+	xorl	%esi, %esi
+	cmpb	$39, %dl
+	jne	.L418
+	movl	$1, %esi
+	cmpq	$1, %rcx
+	jne	.L420
+	jmp	.L419
+	.p2align 4,,10
+	.p2align 3
+.L630:
+	addq	$1, %rsi
+	cmpq	%rcx, %rsi
+	je	.L629
+.L420:
+	cmpb	$39, (%r9,%rsi)
+	jne	.L630
+.L419:
+	leaq	1(%r9), %rdi
+	movq	%rdi, 120(%rsp)
+	leaq	-1(%rsi), %rdi
+	movl	$1, %esi
+	movq	%rdi, 112(%rsp)
+.L418:
+	testq	%rax, %rax
+	setne	%r8b
+	testq	%r13, %r13
+	setne	%dil
+	andb	%dil, %r8b
+	movb	%r8b, 110(%rsp)
+	je	.L422
+	movq	$0, 56(%rsp)
+	movq	%r14, %r15
+	xorl	%r11d, %r11d
+	movq	$0, 96(%rsp)
+	movq	%rbp, 72(%rsp)
+	movq	%rax, 48(%rsp)
+	movb	%sil, 111(%rsp)
+	movq	%rcx, 24(%rsp)
+	movq	%rbx, 64(%rsp)
+	movq	%r13, 88(%rsp)
+	movq	%r14, 80(%rsp)
+	movq	%r13, %r14
+	.p2align 4,,10
+	.p2align 3
+.L421:
+	movq	24(%rsp), %rbx
+	movq	%r14, %r12
+	movq	%r15, %r13
+	movq	%r9, %rbp
+	xorl	%ecx, %ecx
+	.p2align 4,,10
+	.p2align 3
+.L454:
+	leaq	1(%rbp), %rsi
+	leaq	1+.LC14(%rip), %rax
+	leaq	0(%rbp,%rbx), %rdi
+	cmpb	$39, %dl
+	je	.L631
+.L439:
+	movq	%rsi, %r10
+	cmpq	%rsi, %rdi
+	je	.L618
+	movzbl	(%rax), %r8d
+	testb	%r8b, %r8b
+	je	.L450
+	cmpb	$36, %r8b
+	je	.L450
+	addq	$1, %rsi
+	addq	$1, %rax
+	cmpb	%r8b, (%r10)
+	je	.L439
+.L618:
+	movq	64(%rsp), %rbx
+	jmp	.L621
+	.p2align 4,,10
+	.p2align 3
+.L631:
+	cmpq	$1, %rbx
+	je	.L471
+	movl	$1, %r8d
+	jmp	.L442
+	.p2align 4,,10
+	.p2align 3
+.L632:
+	cmpq	%r8, %rbx
+	je	.L618
+	.p2align 4,,10
+	.p2align 3
+.L442:
+	movzbl	0(%rbp,%r8), %eax
+	movq	%r8, %rdi
+	addq	$1, %r8
+	cmpb	$39, %al
+	jne	.L632
+	leaq	-1(%rdi), %rdx
+	cmpq	$-1, %rdi
+	je	.L618
+	cmpq	%rdx, %r12
+	jnb	.L633
+.L448:
+	testq	%rcx, %rcx
+	jne	.L455
+	testq	%r11, %r11
+	jne	.L620
+	cmpb	$0, 111(%rsp)
+	je	.L423
+	cmpq	$0, 112(%rsp)
+	jne	.L634
+.L423:
+	addq	$1, 96(%rsp)
+	movzbl	110(%rsp), %eax
+	subq	$1, %r14
+	addq	$1, %r15
+.L434:
+	testq	%r14, %r14
+	je	.L620
+	testb	%al, %al
+	je	.L620
+	movzbl	(%r9), %edx
+	jmp	.L421
+	.p2align 4,,10
+	.p2align 3
+.L633:
+	testq	%rdx, %rdx
+	je	.L440
+	movq	%r13, %rdi
+	movq	%r9, 16(%rsp)
+	movq	%rcx, 8(%rsp)
+	movq	%r11, (%rsp)
+	movq	%r8, 40(%rsp)
+	movq	%rdx, 32(%rsp)
+	call	memcmp@PLT
+	movq	(%rsp), %r11
+	movq	8(%rsp), %rcx
+	testl	%eax, %eax
+	movq	16(%rsp), %r9
+	jne	.L448
+	movq	32(%rsp), %rdx
+	movq	40(%rsp), %r8
+.L440:
+	cmpq	%r12, %rdx
+	movq	%r12, %rax
+	cmovbe	%rdx, %rax
+	subq	%rax, %r12
+	addq	%rax, %r13
+	cmpq	%r8, %rbx
+	cmovbe	%rbx, %r8
+	addq	%rdx, %rcx
+	subq	%r8, %rbx
+	addq	%r8, %rbp
+.L447:
+	testq	%rbx, %rbx
+	je	.L448
+	movzbl	0(%rbp), %edx
+	jmp	.L454
+	.p2align 4,,10
+	.p2align 3
+.L455:
+	cmpq	%r14, %rcx
+	movq	%r14, %rax
+	cmovbe	%rcx, %rax
+	addq	$1, %r11
+	addq	%rcx, 56(%rsp)
+	subq	%rax, %r14
+	addq	%rax, %r15
+	movq	48(%rsp), %rax
+	cmpq	%rax, %r11
+	setb	%al
+	jmp	.L434
+	.p2align 4,,10
+	.p2align 3
+.L471:
+	xorl	%edx, %edx
+	movl	$2, %r8d
+	jmp	.L440
+	.p2align 4,,10
+	.p2align 3
+.L620:
+	movq	48(%rsp), %rax
+	movq	72(%rsp), %rbp
+	movq	64(%rsp), %rbx
+	movq	80(%rsp), %r14
+	cmpq	%r11, %rax
+	movq	88(%rsp), %r13
+	setnb	%sil
+	jmp	.L437
+.L458:
+	movq	$1, 16(%rbx)
+	movl	$0, (%rbx)
+	jmp	.L336
+.L349:
+	cmpq	%r8, %rax
+	je	.L592
+	movl	$3, %eax
+	jmp	.L347
+.L356:
+	addq	%r9, %rcx
+	subq	%rdx, %rcx
+	je	.L339
+	movzbl	(%rdx), %r10d
+	leal	-48(%r10), %r8d
+	cmpb	$9, %r8b
+	ja	.L339
+	movsbq	%r8b, %rbp
+	movl	$1, %r10d
+	cmpq	$1, %rcx
+	jne	.L360
+	jmp	.L358
+	.p2align 4,,10
+	.p2align 3
+.L635:
+	leaq	0(%rbp,%rbp,4), %r9
+	addq	$1, %r10
+	leaq	-48(%r8,%r9,2), %rbp
+	cmpq	%r10, %rcx
+	je	.L359
+.L360:
+	movsbq	(%rdx,%r10), %r8
+	leal	-48(%r8), %r9d
+	cmpb	$9, %r9b
+	jbe	.L635
+.L359:
+	testq	%r10, %r10
+	je	.L339
+.L358:
+	movq	%rcx, %r9
+	leaq	-1(%rcx), %r8
+	subq	%r10, %r9
+	jmp	.L361
+	.p2align 4,,10
+	.p2align 3
+.L377:
+	leaq	-1(%r8), %r10
+	testq	%r8, %r8
+	je	.L636
+	movq	%r10, %r8
+.L361:
+	cmpq	%r8, %r9
+	jne	.L377
+.L362:
+	addq	%rdx, %rcx
+	subq	%r8, %rcx
+	leaq	(%rax,%r9), %r8
+	movq	%rcx, %r10
+.L363:
+	cmpq	%r8, %rax
+	je	.L339
+	movzbl	(%rax), %edx
+	testb	%dl, %dl
+	je	.L364
+	addq	$1, %rax
+	cmpb	$36, %dl
+	je	.L364
+	addq	$1, %rcx
+	cmpb	%dl, -1(%rcx)
+	jne	.L339
+	jmp	.L363
+.L634:
+	movq	112(%rsp), %rax
+	cmpq	%rax, %r14
+	jb	.L614
+	cmpq	$1, %rax
+	je	.L637
+	cmpq	$32, 112(%rsp)
+	jbe	.L638
+	movq	120(%rsp), %rdx
+	movq	%rax, %rcx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	movq	%r9, 8(%rsp)
+	movq	%r11, (%rsp)
+	call	_ZN1n12__horspool_nIcEEmPKT_mS3_m
+	movq	(%rsp), %r11
+	movq	8(%rsp), %r9
+.L426:
+	cmpq	$-1, %rax
+	je	.L614
+	addq	%rax, 96(%rsp)
+	cmpq	%r14, %rax
+	cmova	%r14, %rax
+	subq	%rax, %r14
+	addq	%rax, %r15
+	movzbl	111(%rsp), %eax
+	jmp	.L434
+.L384:
+	addq	$2, %r10
+	jmp	.L387
+.L450:
+	cmpq	%rsi, %rdi
+	je	.L618
+	movzbl	(%rsi), %eax
+	testq	%r12, %r12
+	je	.L448
+	movzbl	0(%r13), %esi
+	cmpb	%sil, %dl
+	jg	.L448
+	cmpb	%al, %sil
+	jg	.L448
+	movl	$3, %eax
+	subq	$1, %r12
+	addq	$1, %r13
+	cmpq	%rax, %rbx
+	cmovbe	%rbx, %rax
+	addq	$1, %rcx
+	subq	%rax, %rbx
+	addq	%rax, %rbp
+	jmp	.L447
+.L636:
+	xorl	%r9d, %r9d
+	jmp	.L362
+.L629:
+	xorl	%esi, %esi
+	jmp	.L418
+.L397:
+	addq	%rdx, %r12
+	movq	%r12, %rdx
+	subq	%rcx, %rdx
+	je	.L380
+	movzbl	(%rcx), %r10d
+	leal	-48(%r10), %r8d
+	cmpb	$9, %r8b
+	ja	.L380
+	movsbq	%r8b, %rbp
+	movl	$1, %r10d
+	cmpq	$1, %rdx
+	jne	.L401
+	jmp	.L399
+	.p2align 4,,10
+	.p2align 3
+.L639:
+	leaq	0(%rbp,%rbp,4), %r9
+	addq	$1, %r10
+	leaq	-48(%r8,%r9,2), %rbp
+	cmpq	%r10, %rdx
+	je	.L400
+.L401:
+	movsbq	(%rcx,%r10), %r8
+	leal	-48(%r8), %r9d
+	cmpb	$9, %r9b
+	jbe	.L639
+.L400:
+	testq	%r10, %r10
+	je	.L380
+.L399:
+	movq	%rdx, %r9
+	leaq	-1(%rdx), %r8
+	subq	%r10, %r9
+	jmp	.L402
+	.p2align 4,,10
+	.p2align 3
+.L404:
+	subq	$1, %r8
+	jb	.L403
+.L402:
+	cmpq	%r9, %r8
+	jne	.L404
+	addq	%rcx, %rdx
+	xorl	%ecx, %ecx
+	subq	%r9, %rdx
+.L408:
+	movzbl	(%rax,%rcx), %r8d
+	cmpq	%rcx, %r9
+	je	.L405
+	testb	%r8b, %r8b
+	je	.L640
+	addq	$1, %rcx
+	cmpb	%r8b, -1(%rdx,%rcx)
+	jne	.L380
+	jmp	.L408
+.L390:
+	cmpq	%rdx, %rcx
+	je	.L387
+	movl	$3, %edx
+	jmp	.L388
+.L430:
+	movq	112(%rsp), %rsi
+	movq	120(%rsp), %rdi
+	movq	%r15, %rcx
+	xorl	%eax, %eax
+.L431:
+	xorl	%edx, %edx
+	jmp	.L433
+.L432:
+	addq	$1, %rdx
+	cmpq	%rsi, %rdx
+	je	.L426
+.L433:
+	movzbl	(%rdi,%rdx), %ebx
+	cmpb	%bl, (%rcx,%rdx)
+	je	.L432
+	cmpq	%rdx, %rsi
+	je	.L426
+	addq	$1, %rax
+	addq	$1, %rcx
+	leaq	(%rax,%rsi), %rdx
+	cmpq	%rdx, %r14
+	jnb	.L431
+.L614:
+	movq	72(%rsp), %rbp
+	movzbl	111(%rsp), %esi
+	movq	64(%rsp), %rbx
+	movq	80(%rsp), %r14
+	movq	88(%rsp), %r13
+	jmp	.L437
+.L637:
+	movq	120(%rsp), %rax
+	movq	%r14, %rdx
+	movq	%r15, %rdi
+	movq	%r11, (%rsp)
+	movq	%r9, 8(%rsp)
+	movzbl	(%rax), %esi
+	call	memchr@PLT
+	movq	(%rsp), %r11
+	testq	%rax, %rax
+	je	.L614
+	movq	8(%rsp), %r9
+	subq	%r15, %rax
+	jmp	.L426
+.L364:
+	addq	%r9, %r10
+	movq	%r10, %r8
+	subq	%rcx, %r8
+	je	.L339
+	movzbl	(%rcx), %edx
+	subl	$48, %edx
+	cmpb	$9, %dl
+	ja	.L339
+	movq	%rax, (%rsp)
+	movsbq	%dl, %rdx
+	movl	$1, %r9d
+	jmp	.L366
+.L368:
+	movsbq	(%rcx,%r9), %r15
+	leal	-48(%r15), %eax
+	cmpb	$9, %al
+	ja	.L367
+	imulq	$10, %rdx, %rdx
+	addq	$1, %r9
+	leaq	-48(%rdx,%r15), %rdx
+.L366:
+	cmpq	%r9, %r8
+	jne	.L368
+.L367:
+	movq	%rdx, 128(%rsp)
+	movq	%r8, %rdx
+	movq	(%rsp), %rax
+	movb	$1, 136(%rsp)
+	subq	%r9, %rdx
+	jmp	.L369
+	.p2align 4,,10
+	.p2align 3
+.L371:
+	testq	%r8, %r8
+	je	.L370
+.L369:
+	subq	$1, %r8
+	cmpq	%rdx, %r8
+	jne	.L371
+	subq	%rdx, %r10
+	xorl	%ecx, %ecx
+.L375:
+	movzbl	(%rax,%rcx), %r8d
+	cmpq	%rcx, %rdx
+	je	.L372
+	testb	%r8b, %r8b
+	je	.L641
+	addq	$1, %rcx
+	cmpb	-1(%r10,%rcx), %r8b
+	jne	.L339
+	jmp	.L375
+.L638:
+	movq	%r9, 8(%rsp)
+	movq	%r11, (%rsp)
+	call	_ZN1n9simd_bestEv
+	movl	%eax, %ebx
+	call	_ZN1n9simd_bestEv
+	movq	(%rsp), %r11
+	movq	8(%rsp), %r9
+	cmpl	%eax, %ebx
+	jge	.L642
+.L428:
+	cmpl	$1, %ebx
+	je	.L429
+	subl	$2, %ebx
+	cmpl	$1, %ebx
+	ja	.L430
+	movq	112(%rsp), %rcx
+	movq	120(%rsp), %rdx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	movq	%r9, 8(%rsp)
+	movq	%r11, (%rsp)
+	call	_ZN1n13__avx2_searchIcEEmPKT_mS3_m
+	movq	(%rsp), %r11
+	movq	8(%rsp), %r9
+	jmp	.L426
+.L640:
+	cmpq	%rcx, %r9
+	jne	.L380
+	jmp	.L407
+.L370:
+	movzbl	(%rax), %r8d
+.L372:
+	testb	%r8b, %r8b
+	jne	.L339
+.L374:
+	movq	128(%rsp), %rax
+	movq	144(%rsp), %r9
+	movq	152(%rsp), %rcx
+	movq	%rax, %rdi
+	orq	%rbp, %rdi
+	je	.L460
+	cmpq	%rbp, %rax
+	jnb	.L462
+	movq	$1, 16(%rbx)
+	movl	$2, (%rbx)
+	jmp	.L336
+.L429:
+	movq	112(%rsp), %rcx
+	movq	120(%rsp), %rdx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	movq	%r9, 8(%rsp)
+	movq	%r11, (%rsp)
+	call	_ZN1n13__sse2_searchIcEEmPKT_mS3_m
+	movq	(%rsp), %r11
+	movq	8(%rsp), %r9
+	jmp	.L426
+.L642:
+	call	_ZN1n9simd_bestEv
+	movq	8(%rsp), %r9
+	movq	(%rsp), %r11
+	movl	%eax, %ebx
+	jmp	.L428
+.L641:
+	cmpq	%rcx, %rdx
+	jne	.L339
+	jmp	.L374
+	.cfi_endproc
+.LFE6965:
+	.size	_ZN1n15search_sequenceIcNS_5sliceIKcEES3_EENS_6resultINS1_IKT_EENS_8match_rcEEET0_T1_, .-_ZN1n15search_sequenceIcNS_5sliceIKcEES3_EENS_6resultINS1_IKT_EENS_8match_rcEEET0_T1_
+	.section	.rodata.str1.1
+.LC18:
+	.string	"GGaaaRaabCq"
+.LC19:
+	.string	"{'aa'a-zA-Z:0:2}"
+.LC21:
+	.string	"expected true : found.has()"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC22:
+	.string	"expected equal : expected value : found.get().len(), actual value : 8"
+	.align 8
+.LC23:
+	.string	"expected true : found.get() == n::slice_of(\"aaaRaabC\")"
+	.section	.text.unlikely
+.LCOLDB25:
+	.text
+.LHOTB25:
+	.p2align 4
+	.globl	_Z20test_search_sequencev
+	.type	_Z20test_search_sequencev, @function
+_Z20test_search_sequencev:
+.LFB6911:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6911
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	addq	$-128, %rsp
+	.cfi_def_cfa_offset 160
+	movdqa	.LC20(%rip), %xmm1
+	movaps	%xmm1, 32(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbx
+	testq	%rbx, %rbx
+	je	.L644
+	pxor	%xmm0, %xmm0
+	leaq	56(%rsp), %rax
+	movq	%rbx, 48(%rsp)
+	xorl	%edi, %edi
+	leaq	.LC18(%rip), %rsi
+	movups	%xmm0, 56(%rsp)
+	movq	$0, 72(%rsp)
+	cmpq	%rax, %rsi
+	jb	.L707
+.L737:
+	leaq	.LC18(%rip), %rsi
+.L707:
+	movq	%rax, %rbx
+.L645:
+	addq	%rbx, %rdi
+	movl	$11, %edx
+	call	memmove@PLT
+	movq	32(%rsp), %rax
+	movdqa	.LC20(%rip), %xmm2
+	leaq	11(%rax), %rdx
+	movq	%rdx, 32(%rsp)
+	movb	$0, 11(%rbx,%rax)
+	movaps	%xmm2, 80(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbx
+	testq	%rbx, %rbx
+	je	.L660
+	pxor	%xmm0, %xmm0
+	leaq	104(%rsp), %rcx
+	movq	%rbx, 96(%rsp)
+	xorl	%edx, %edx
+	leaq	.LC19(%rip), %rax
+	movups	%xmm0, 104(%rsp)
+	movq	$0, 120(%rsp)
+	cmpq	%rcx, %rax
+	jb	.L706
+.L738:
+	leaq	.LC19(%rip), %rax
+.L706:
+	movq	%rcx, %rbx
+.L661:
+	movdqu	(%rax), %xmm3
+	leaq	56(%rsp), %rcx
+	movups	%xmm3, (%rbx,%rdx)
+	movq	80(%rsp), %rax
+	leaq	16(%rax), %rdx
+	movq	%rdx, 80(%rsp)
+	movb	$0, 16(%rbx,%rax)
+	cmpq	$23, 40(%rsp)
+	movq	32(%rsp), %r8
+	je	.L676
+	movq	56(%rsp), %rcx
+.L676:
+	cmpq	$23, 88(%rsp)
+	movq	80(%rsp), %rdx
+	leaq	104(%rsp), %rsi
+	je	.L677
+	movq	104(%rsp), %rsi
+.L677:
+	movq	%rsp, %rdi
+	call	_ZN1n15search_sequenceIcNS_5sliceIKcEES3_EENS_6resultINS1_IKT_EENS_8match_rcEEET0_T1_
+	movq	88(%rsp), %rdx
+	cmpq	$23, %rdx
+	je	.L678
+	movq	96(%rsp), %rdi
+	movq	104(%rsp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L678:
+	cmpq	$0, 16(%rsp)
+	jne	.L735
+	cmpq	$8, 8(%rsp)
+	jne	.L736
+	movabsq	$4855550418880651617, %rax
+	movq	(%rsp), %rdx
+	cmpq	%rax, (%rdx)
+	jne	.L681
+	movq	40(%rsp), %rdx
+	cmpq	$23, %rdx
+	je	.L643
+	movq	48(%rsp), %rdi
+	movq	56(%rsp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L643:
+	subq	$-128, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L660:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L740
+.L665:
+	movq	80(%rsp), %rdx
+	movq	88(%rsp), %rbp
+	pxor	%xmm0, %xmm0
+	xorl	%ecx, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movups	%xmm0, 104(%rsp)
+	leaq	.LC19(%rip), %rax
+	movq	$0, 120(%rsp)
+	leaq	16(%rdx), %rsi
+	movq	%rdi, 96(%rsp)
+	cmpq	$23, %rbp
+	je	.L741
+.L667:
+	leaq	(%rcx,%rdx), %r8
+	cmpq	%r8, %rax
+	jnb	.L742
+	subq	%rcx, %rax
+	movq	%rax, %r12
+	cmpq	%rsi, %rbp
+	jnb	.L701
+	leaq	10(%rbp,%rbp), %rbp
+	movq	(%rdi), %rax
+	movl	$1, %edx
+	cmpq	%rsi, %rbp
+	cmovb	%rsi, %rbp
+	leaq	1(%rbp), %rsi
+.LEHB8:
+	call	*16(%rax)
+	movq	%rax, %rbx
+	movq	80(%rsp), %rax
+	cmpq	$23, 88(%rsp)
+	leaq	104(%rsp), %rsi
+	leaq	1(%rax), %rdx
+	je	.L672
+	movq	104(%rsp), %rsi
+.L672:
+	movq	%rbx, %rdi
+	call	memcpy@PLT
+	movq	88(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L673
+	movq	96(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	104(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L673:
+	movq	%rbx, 104(%rsp)
+	movq	80(%rsp), %rdx
+	movq	%rbp, 88(%rsp)
+.L671:
+	leaq	(%rbx,%r12), %rax
+	cmpq	$23, %rbp
+	jne	.L661
+	leaq	104(%rsp), %rcx
+	leaq	(%rcx,%r12), %rax
+	jmp	.L706
+.L742:
+	cmpq	%rsi, %rbp
+	jnb	.L663
+.L686:
+	leaq	10(%rbp,%rbp), %rbp
+	movq	(%rdi), %rax
+	movl	$1, %edx
+	cmpq	%rsi, %rbp
+	cmovb	%rsi, %rbp
+	leaq	1(%rbp), %rsi
+	call	*16(%rax)
+	movq	%rax, %rbx
+	movq	80(%rsp), %rax
+	cmpq	$23, 88(%rsp)
+	leaq	104(%rsp), %rsi
+	leaq	1(%rax), %rdx
+	je	.L669
+	movq	104(%rsp), %rsi
+.L669:
+	movq	%rbx, %rdi
+	call	memcpy@PLT
+	movq	88(%rsp), %rdx
+	cmpq	$23, %rdx
+	je	.L670
+	movq	96(%rsp), %rdi
+	movq	104(%rsp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE8:
+.L670:
+	movq	%rbx, 104(%rsp)
+	movq	80(%rsp), %rdx
+	movq	%rbp, 88(%rsp)
+.L663:
+	leaq	.LC19(%rip), %rax
+	cmpq	$23, %rbp
+	jne	.L661
+	leaq	104(%rsp), %rcx
+	jmp	.L738
+	.p2align 4,,10
+	.p2align 3
+.L644:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L743
+.L649:
+	movq	32(%rsp), %rdi
+	movq	40(%rsp), %rbp
+	pxor	%xmm0, %xmm0
+	xorl	%eax, %eax
+	movq	_ZZN1n4heapEvE3res(%rip), %rcx
+	movups	%xmm0, 56(%rsp)
+	leaq	.LC18(%rip), %rsi
+	movq	$0, 72(%rsp)
+	leaq	11(%rdi), %rdx
+	movq	%rcx, 48(%rsp)
+	cmpq	$23, %rbp
+	je	.L744
+.L651:
+	leaq	(%rax,%rdi), %r8
+	cmpq	%r8, %rsi
+	jnb	.L745
+	subq	%rax, %rsi
+	movq	%rsi, %r12
+	cmpq	%rdx, %rbp
+	jnb	.L693
+	leaq	10(%rbp,%rbp), %rbp
+	movq	(%rcx), %rax
+	movq	%rcx, %rdi
+	cmpq	%rdx, %rbp
+	cmovb	%rdx, %rbp
+	movl	$1, %edx
+	leaq	1(%rbp), %rsi
+.LEHB9:
+	call	*16(%rax)
+	cmpq	$23, 40(%rsp)
+	leaq	56(%rsp), %rsi
+	movq	%rax, %rbx
+	movq	32(%rsp), %rax
+	leaq	1(%rax), %rdx
+	je	.L656
+	movq	56(%rsp), %rsi
+.L656:
+	movq	%rbx, %rdi
+	call	memcpy@PLT
+	movq	40(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L657
+	movq	48(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	56(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L657:
+	movq	%rbx, 56(%rsp)
+	movq	32(%rsp), %rdi
+	movq	%rbp, 40(%rsp)
+.L655:
+	leaq	(%rbx,%r12), %rsi
+	cmpq	$23, %rbp
+	jne	.L645
+	leaq	56(%rsp), %rax
+	leaq	(%rax,%r12), %rsi
+	jmp	.L707
+.L745:
+	cmpq	%rdx, %rbp
+	jnb	.L647
+.L687:
+	leaq	10(%rbp,%rbp), %rbp
+	movq	(%rcx), %rax
+	movq	%rcx, %rdi
+	cmpq	%rdx, %rbp
+	cmovb	%rdx, %rbp
+	movl	$1, %edx
+	leaq	1(%rbp), %rsi
+	call	*16(%rax)
+	cmpq	$23, 40(%rsp)
+	leaq	56(%rsp), %rsi
+	movq	%rax, %rbx
+	movq	32(%rsp), %rax
+	leaq	1(%rax), %rdx
+	je	.L653
+	movq	56(%rsp), %rsi
+.L653:
+	movq	%rbx, %rdi
+	call	memcpy@PLT
+	movq	40(%rsp), %rdx
+	cmpq	$23, %rdx
+	je	.L654
+	movq	48(%rsp), %rdi
+	movq	56(%rsp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE9:
+.L654:
+	movq	%rbx, 56(%rsp)
+	movq	32(%rsp), %rdi
+	movq	%rbp, 40(%rsp)
+.L647:
+	leaq	.LC18(%rip), %rsi
+	cmpq	$23, %rbp
+	jne	.L645
+	leaq	56(%rsp), %rax
+	jmp	.L737
+.L743:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L649
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L649
+.L740:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L665
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L665
+.L693:
+	xorl	%ebx, %ebx
+	jmp	.L655
+.L744:
+	leaq	56(%rsp), %rax
+	cmpq	%rax, %rsi
+	jnb	.L651
+	cmpq	$23, %rdx
+	ja	.L687
+	jmp	.L707
+	.p2align 4,,10
+	.p2align 3
+.L701:
+	xorl	%ebx, %ebx
+	jmp	.L671
+.L741:
+	leaq	104(%rsp), %rcx
+	cmpq	%rcx, %rax
+	jnb	.L667
+	cmpq	$23, %rsi
+	ja	.L686
+	jmp	.L706
+.L733:
+	jmp	.L734
+	.section	.gcc_except_table
+.LLSDA6911:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6911-.LLSDACSB6911
+.LLSDACSB6911:
+	.uleb128 .LEHB8-.LFB6911
+	.uleb128 .LEHE8-.LEHB8
+	.uleb128 .L733-.LFB6911
+	.uleb128 0
+	.uleb128 .LEHB9-.LFB6911
+	.uleb128 .LEHE9-.LEHB9
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6911:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6911
+	.type	_Z20test_search_sequencev.cold, @function
+_Z20test_search_sequencev.cold:
+.LFSB6911:
+.L735:
+	.cfi_def_cfa_offset 160
+	.cfi_offset 3, -32
+	.cfi_offset 6, -24
+	.cfi_offset 12, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC21(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB10:
+	call	__cxa_throw@PLT
+.LEHE10:
+.L708:
+.L734:
+	movq	%rax, %rbx
+	movq	40(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L685
+	movq	48(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	56(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L685:
+	movq	%rbx, %rdi
+.LEHB11:
+	call	_Unwind_Resume@PLT
+.LEHE11:
+.L736:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC22(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB12:
+	call	__cxa_throw@PLT
+.L681:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC23(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE12:
+	.cfi_endproc
+.LFE6911:
+	.section	.gcc_except_table
+.LLSDAC6911:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6911-.LLSDACSBC6911
+.LLSDACSBC6911:
+	.uleb128 .LEHB10-.LCOLDB25
+	.uleb128 .LEHE10-.LEHB10
+	.uleb128 .L708-.LCOLDB25
+	.uleb128 0
+	.uleb128 .LEHB11-.LCOLDB25
+	.uleb128 .LEHE11-.LEHB11
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB12-.LCOLDB25
+	.uleb128 .LEHE12-.LEHB12
+	.uleb128 .L708-.LCOLDB25
+	.uleb128 0
+.LLSDACSEC6911:
+	.section	.text.unlikely
+	.text
+	.size	_Z20test_search_sequencev, .-_Z20test_search_sequencev
+	.section	.text.unlikely
+	.size	_Z20test_search_sequencev.cold, .-_Z20test_search_sequencev.cold
+.LCOLDE25:
+	.text
+.LHOTE25:
+	.section	.rodata.str1.1
+.LC26:
+	.string	"abcabd"
+.LC27:
+	.string	"abcxyzQ"
+.LC28:
+	.string	"{'xyz'A-Z:1:1}"
+.LC29:
+	.string	"{'xyw':1:}"
+	.section	.rodata.str1.8
+	.align 8
+.LC30:
+	.string	"expected true : found.get() == n::slice_of(\"xyzQ\")"
+	.align 8
+.LC31:
+	.string	"expected equal : expected value : found.get().data() - input.data(), actual value : 6003"
+	.align 8
+.LC32:
+	.string	"expected false : missing.has()"
+	.section	.text.unlikely
+.LCOLDB33:
+	.text
+.LHOTB33:
+	.p2align 4
+	.globl	_Z27test_search_leading_literalv
+	.type	_Z27test_search_leading_literalv, @function
+_Z27test_search_leading_literalv:
+.LFB6924:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6924
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$200, %rsp
+	.cfi_def_cfa_offset 256
+	movdqa	.LC20(%rip), %xmm2
+	movaps	%xmm2, 96(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, %rdx
+	testq	%rax, %rax
+	je	.L1009
+.L747:
+	pxor	%xmm0, %xmm0
+	movq	%rdx, 112(%rsp)
+	leaq	168(%rsp), %r15
+	movq	$0, 136(%rsp)
+	movl	$1000, 20(%rsp)
+	movups	%xmm0, 120(%rsp)
+	jmp	.L751
+	.p2align 4,,10
+	.p2align 3
+.L1011:
+	leaq	(%rax,%rdi), %rcx
+	cmpq	%rcx, %r12
+	jnb	.L767
+	movq	%r12, %r14
+	subq	%rax, %r14
+	cmpq	%rdx, %rbx
+	jnb	.L772
+	leaq	10(%rbx,%rbx), %rbx
+	movq	112(%rsp), %rdi
+	cmpq	%rdx, %rbx
+	cmovb	%rdx, %rbx
+	movq	(%rdi), %rax
+	movl	$1, %edx
+	leaq	1(%rbx), %rsi
+.LEHB13:
+	call	*16(%rax)
+	movq	%rax, %r12
+	movq	96(%rsp), %rax
+	cmpq	$23, 104(%rsp)
+	leaq	120(%rsp), %rsi
+	leaq	1(%rax), %rdx
+	je	.L773
+	movq	120(%rsp), %rsi
+.L773:
+	movq	%r12, %rdi
+	call	memcpy@PLT
+	movq	104(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L774
+	movq	112(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	120(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE13:
+.L774:
+	movq	%r12, 120(%rsp)
+	movq	96(%rsp), %rdi
+	movq	%rbx, 104(%rsp)
+.L772:
+	cmpq	$23, %rbx
+	je	.L1010
+	movq	120(%rsp), %rax
+	leaq	(%rax,%r14), %r12
+.L777:
+	movq	%rax, %r14
+.L776:
+	movq	%rbp, %rdx
+	addq	%r14, %rdi
+	movq	%r12, %rsi
+	call	memmove@PLT
+	addq	96(%rsp), %rbp
+	movq	%rbp, 96(%rsp)
+	movb	$0, (%r14,%rbp)
+	cmpq	$23, %r13
+	je	.L778
+	movq	160(%rsp), %rdi
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	subl	$1, 20(%rsp)
+	je	.L780
+.L779:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+.L751:
+	movdqa	.LC20(%rip), %xmm1
+	movaps	%xmm1, 144(%rsp)
+	testq	%rax, %rax
+	je	.L781
+	movq	%rax, 160(%rsp)
+	pxor	%xmm0, %xmm0
+	xorl	%ebp, %ebp
+	movq	$0, 184(%rsp)
+	movups	%xmm0, 168(%rsp)
+.L1001:
+	leaq	.LC26(%rip), %rsi
+.L764:
+	movq	%r15, %rbx
+.L763:
+	leaq	(%rbx,%rbp), %rdi
+	movl	$6, %edx
+	movq	%r15, %r12
+	call	memmove@PLT
+	movq	144(%rsp), %rax
+	leaq	6(%rax), %rdx
+	movq	%rdx, 144(%rsp)
+	movb	$0, 6(%rbx,%rax)
+	movq	152(%rsp), %r13
+	movq	144(%rsp), %rbp
+	cmpq	$23, %r13
+	je	.L765
+	movq	168(%rsp), %r12
+.L765:
+	movq	104(%rsp), %rbx
+	leaq	120(%rsp), %rax
+	cmpq	$23, %rbx
+	je	.L766
+	movq	120(%rsp), %rax
+.L766:
+	movq	96(%rsp), %rdi
+	leaq	0(%rbp,%rdi), %rdx
+	cmpq	%rax, %r12
+	jnb	.L1011
+.L767:
+	cmpq	%rdx, %rbx
+	jnb	.L769
+	leaq	10(%rbx,%rbx), %rbx
+	movq	112(%rsp), %rdi
+	cmpq	%rdx, %rbx
+	cmovb	%rdx, %rbx
+	movq	(%rdi), %rax
+	movl	$1, %edx
+	leaq	1(%rbx), %rsi
+.LEHB14:
+	call	*16(%rax)
+	movq	%rax, %r14
+	movq	96(%rsp), %rax
+	cmpq	$23, 104(%rsp)
+	leaq	120(%rsp), %rsi
+	leaq	1(%rax), %rdx
+	je	.L770
+	movq	120(%rsp), %rsi
+.L770:
+	movq	%r14, %rdi
+	call	memcpy@PLT
+	movq	104(%rsp), %rdx
+	cmpq	$23, %rdx
+	je	.L771
+	movq	112(%rsp), %rdi
+	movq	120(%rsp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE14:
+.L771:
+	movq	%r14, 120(%rsp)
+	movq	96(%rsp), %rdi
+	movq	%rbx, 104(%rsp)
+.L769:
+	leaq	120(%rsp), %r14
+	cmpq	$23, %rbx
+	je	.L776
+	movq	120(%rsp), %rax
+	jmp	.L777
+	.p2align 4,,10
+	.p2align 3
+.L778:
+	subl	$1, 20(%rsp)
+	jne	.L779
+.L780:
+	movdqa	.LC20(%rip), %xmm3
+	movaps	%xmm3, 144(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L782
+	movq	%rax, 160(%rsp)
+	pxor	%xmm0, %xmm0
+	leaq	168(%rsp), %rbx
+	leaq	.LC27(%rip), %rax
+	movq	$0, 184(%rsp)
+	xorl	%r14d, %r14d
+	movups	%xmm0, 168(%rsp)
+	cmpq	%rbx, %rax
+	jb	.L783
+.L1002:
+	leaq	.LC27(%rip), %rax
+.L783:
+	leaq	(%rbx,%r14), %rdi
+	movl	$7, %edx
+	movq	%rax, %rsi
+	call	memmove@PLT
+	movq	144(%rsp), %rax
+	leaq	7(%rax), %rdx
+	movq	%rdx, 144(%rsp)
+	movb	$0, 7(%rbx,%rax)
+	movq	152(%rsp), %rbp
+	leaq	168(%rsp), %rbx
+	movq	144(%rsp), %r12
+	cmpq	$23, %rbp
+	je	.L796
+	movq	168(%rsp), %rbx
+.L796:
+	movq	104(%rsp), %r13
+	leaq	120(%rsp), %rcx
+	cmpq	$23, %r13
+	je	.L797
+	movq	120(%rsp), %rcx
+.L797:
+	movq	96(%rsp), %rdx
+	leaq	(%r12,%rdx), %rax
+	cmpq	%rcx, %rbx
+	jb	.L798
+	leaq	(%rcx,%rdx), %rsi
+	cmpq	%rsi, %rbx
+	jnb	.L798
+	subq	%rcx, %rbx
+	cmpq	%rax, %r13
+	jnb	.L803
+	leaq	10(%r13,%r13), %r13
+	movq	112(%rsp), %rdi
+	movl	$1, %edx
+	cmpq	%rax, %r13
+	cmovb	%rax, %r13
+	movq	(%rdi), %rax
+	leaq	1(%r13), %rsi
+.LEHB15:
+	call	*16(%rax)
+	movq	%rax, %r14
+	movq	96(%rsp), %rax
+	cmpq	$23, 104(%rsp)
+	leaq	120(%rsp), %rsi
+	leaq	1(%rax), %rdx
+	je	.L804
+	movq	120(%rsp), %rsi
+.L804:
+	movq	%r14, %rdi
+	call	memcpy@PLT
+	movq	104(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L805
+	movq	112(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	120(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE15:
+.L805:
+	movq	%r14, 120(%rsp)
+	movq	96(%rsp), %rdx
+	movq	%r13, 104(%rsp)
+.L803:
+	cmpq	$23, %r13
+	je	.L1012
+	movq	120(%rsp), %rax
+	addq	%rax, %rbx
+	movq	%rax, %r14
+.L807:
+	leaq	(%r14,%rdx), %rdi
+	movq	%rbx, %rsi
+	movq	%r12, %rdx
+	call	memmove@PLT
+	addq	96(%rsp), %r12
+	movq	%r12, 96(%rsp)
+	movb	$0, (%r14,%r12)
+	cmpq	$23, %rbp
+	je	.L809
+	movq	160(%rsp), %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L809:
+	movdqa	.LC20(%rip), %xmm4
+	movaps	%xmm4, 144(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r12
+	testq	%r12, %r12
+	je	.L810
+	pxor	%xmm0, %xmm0
+	leaq	168(%rsp), %rbx
+	xorl	%edx, %edx
+	movq	%r12, 160(%rsp)
+	leaq	.LC28(%rip), %rax
+	movups	%xmm0, 168(%rsp)
+	movq	$0, 184(%rsp)
+	cmpq	%rbx, %rax
+	jb	.L911
+.L1003:
+	leaq	.LC28(%rip), %rax
+.L911:
+	movq	%rbx, %r12
+.L811:
+	leaq	(%r12,%rdx), %rdi
+	movq	%rax, %rsi
+	movl	$14, %edx
+	call	memmove@PLT
+	movq	144(%rsp), %rax
+	leaq	120(%rsp), %rcx
+	leaq	14(%rax), %rdx
+	movq	%rdx, 144(%rsp)
+	movb	$0, 14(%r12,%rax)
+	cmpq	$23, 104(%rsp)
+	movq	96(%rsp), %r8
+	je	.L826
+	movq	120(%rsp), %rcx
+.L826:
+	movq	144(%rsp), %rdx
+	leaq	168(%rsp), %rsi
+	cmpq	$23, 152(%rsp)
+	je	.L827
+	movq	168(%rsp), %rsi
+.L827:
+	leaq	32(%rsp), %rdi
+	call	_ZN1n15search_sequenceIcNS_5sliceIKcEES3_EENS_6resultINS1_IKT_EENS_8match_rcEEET0_T1_
+	movq	152(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L828
+	movq	160(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L828:
+	movq	48(%rsp), %rdx
+	testq	%rdx, %rdx
+	jne	.L998
+	cmpq	$4, 40(%rsp)
+	movq	32(%rsp), %rax
+	jne	.L830
+	cmpl	$1366980984, (%rax)
+	jne	.L830
+	cmpq	$23, 104(%rsp)
+	leaq	120(%rsp), %rcx
+	je	.L831
+	movq	120(%rsp), %rcx
+.L831:
+	subq	%rcx, %rax
+	cmpq	$6003, %rax
+	jne	.L999
+	movdqa	.LC20(%rip), %xmm5
+	movaps	%xmm5, 144(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r12
+	testq	%r12, %r12
+	je	.L834
+	pxor	%xmm0, %xmm0
+	leaq	168(%rsp), %rbx
+	leaq	.LC29(%rip), %rax
+	movq	%r12, 160(%rsp)
+	movq	$0, 184(%rsp)
+	movups	%xmm0, 168(%rsp)
+	cmpq	%rbx, %rax
+	jb	.L910
+.L1005:
+	leaq	.LC29(%rip), %rax
+.L910:
+	movq	%rbx, %r12
+.L835:
+	leaq	(%r12,%rdx), %rdi
+	movq	%rax, %rsi
+	movl	$10, %edx
+	call	memmove@PLT
+	movq	144(%rsp), %rax
+	leaq	120(%rsp), %rcx
+	leaq	10(%rax), %rdx
+	movq	%rdx, 144(%rsp)
+	movb	$0, 10(%r12,%rax)
+	cmpq	$23, 104(%rsp)
+	movq	96(%rsp), %r8
+	je	.L850
+	movq	120(%rsp), %rcx
+.L850:
+	movq	144(%rsp), %rdx
+	leaq	168(%rsp), %rsi
+	cmpq	$23, 152(%rsp)
+	je	.L851
+	movq	168(%rsp), %rsi
+.L851:
+	leaq	64(%rsp), %rdi
+	call	_ZN1n15search_sequenceIcNS_5sliceIKcEES3_EENS_6resultINS1_IKT_EENS_8match_rcEEET0_T1_
+	movq	152(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L852
+	movq	160(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L852:
+	cmpq	$0, 80(%rsp)
+	je	.L1000
+	movq	104(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L746
+	movq	112(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	120(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L746:
+	addq	$200, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L798:
+	.cfi_restore_state
+	cmpq	%rax, %r13
+	jnb	.L800
+	leaq	10(%r13,%r13), %r13
+	movq	112(%rsp), %rdi
+	movl	$1, %edx
+	cmpq	%rax, %r13
+	cmovb	%rax, %r13
+	movq	(%rdi), %rax
+	leaq	1(%r13), %rsi
+.LEHB16:
+	call	*16(%rax)
+	movq	%rax, %r14
+	movq	96(%rsp), %rax
+	cmpq	$23, 104(%rsp)
+	leaq	120(%rsp), %rsi
+	leaq	1(%rax), %rdx
+	je	.L801
+	movq	120(%rsp), %rsi
+.L801:
+	movq	%r14, %rdi
+	call	memcpy@PLT
+	movq	104(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L802
+	movq	112(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	120(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE16:
+.L802:
+	movq	%r14, 120(%rsp)
+	movq	96(%rsp), %rdx
+	movq	%r13, 104(%rsp)
+.L800:
+	leaq	120(%rsp), %r14
+	cmpq	$23, %r13
+	je	.L807
+	movq	120(%rsp), %rax
+	movq	%rax, %r14
+	jmp	.L807
+	.p2align 4,,10
+	.p2align 3
+.L781:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1013
+.L753:
+	movq	_ZZN1n4heapEvE3res(%rip), %r14
+	movq	144(%rsp), %rbp
+	pxor	%xmm0, %xmm0
+	movq	$0, 184(%rsp)
+	movq	152(%rsp), %r13
+	movups	%xmm0, 168(%rsp)
+	movq	%r14, 160(%rsp)
+	leaq	6(%rbp), %r12
+	movq	$0, 8(%rsp)
+	cmpq	$23, %r13
+	je	.L1014
+.L755:
+	movq	8(%rsp), %rax
+	leaq	.LC26(%rip), %rcx
+	addq	%rbp, %rax
+	cmpq	%rax, %rcx
+	jnb	.L1015
+	movq	8(%rsp), %rax
+	leaq	.LC26(%rip), %rcx
+	subq	%rax, %rcx
+	movq	%rcx, 24(%rsp)
+	cmpq	%r12, %r13
+	jnb	.L868
+	leaq	10(%r13,%r13), %rax
+	movl	$1, %edx
+	movq	%r14, %rdi
+	cmpq	%r12, %rax
+	cmovnb	%rax, %r12
+	movq	(%r14), %rax
+	leaq	1(%r12), %rsi
+.LEHB17:
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L761
+	movq	(%r14), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L761:
+	movq	%r12, %r13
+	movq	%rbx, 168(%rsp)
+	movq	24(%rsp), %rsi
+	movq	%r12, 152(%rsp)
+	cmpq	$23, %r13
+	je	.L762
+.L1026:
+	addq	%rbx, %rsi
+	jmp	.L763
+.L1015:
+	cmpq	%r12, %r13
+	jnb	.L867
+.L864:
+	leaq	10(%r13,%r13), %rax
+	movl	$1, %edx
+	movq	%r14, %rdi
+	cmpq	%r12, %rax
+	cmovnb	%rax, %r12
+	movq	(%r14), %rax
+	leaq	1(%r12), %rsi
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L759
+	movq	(%r14), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L759:
+	movq	%rbx, 168(%rsp)
+	movq	%r12, 152(%rsp)
+.L758:
+	leaq	.LC26(%rip), %rsi
+	cmpq	$23, %r12
+	jne	.L763
+	jmp	.L1001
+.L1010:
+	leaq	120(%rsp), %rax
+	leaq	(%rax,%r14), %r12
+	movq	%rax, %r14
+	jmp	.L776
+.L1013:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L753
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L753
+.L867:
+	xorl	%ebx, %ebx
+	movq	%r13, %r12
+	jmp	.L758
+.L1012:
+	leaq	120(%rsp), %rax
+	addq	%rax, %rbx
+	movq	%rax, %r14
+	jmp	.L807
+.L834:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1016
+.L839:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	144(%rsp), %rdx
+	pxor	%xmm0, %xmm0
+	xorl	%ebx, %ebx
+	movq	152(%rsp), %rbp
+	movups	%xmm0, 168(%rsp)
+	leaq	.LC29(%rip), %rax
+	movq	%rdi, 160(%rsp)
+	leaq	10(%rdx), %rcx
+	movq	$0, 184(%rsp)
+	cmpq	$23, %rbp
+	je	.L1017
+.L841:
+	leaq	(%rbx,%rdx), %rsi
+	cmpq	%rsi, %rax
+	jnb	.L1018
+	subq	%rbx, %rax
+	movq	%rax, %r13
+	cmpq	%rcx, %rbp
+	jnb	.L905
+	leaq	10(%rbp,%rbp), %rbp
+	movq	(%rdi), %rax
+	movl	$1, %edx
+	cmpq	%rcx, %rbp
+	cmovb	%rcx, %rbp
+	leaq	1(%rbp), %rsi
+	call	*16(%rax)
+	movq	%rax, %r12
+	movq	144(%rsp), %rax
+	cmpq	$23, 152(%rsp)
+	leaq	168(%rsp), %rsi
+	leaq	1(%rax), %rdx
+	je	.L846
+	movq	168(%rsp), %rsi
+.L846:
+	movq	%r12, %rdi
+	call	memcpy@PLT
+	movq	152(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L847
+	movq	160(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L847:
+	movq	%r12, 168(%rsp)
+	movq	144(%rsp), %rdx
+	movq	%rbp, 152(%rsp)
+.L845:
+	leaq	(%r12,%r13), %rax
+	cmpq	$23, %rbp
+	jne	.L835
+	leaq	168(%rsp), %rbx
+	leaq	(%rbx,%r13), %rax
+	jmp	.L910
+.L1018:
+	cmpq	%rcx, %rbp
+	jnb	.L837
+.L861:
+	leaq	10(%rbp,%rbp), %rbp
+	movq	(%rdi), %rax
+	movl	$1, %edx
+	cmpq	%rcx, %rbp
+	cmovb	%rcx, %rbp
+	leaq	1(%rbp), %rsi
+	call	*16(%rax)
+	movq	%rax, %r12
+	movq	144(%rsp), %rax
+	cmpq	$23, 152(%rsp)
+	leaq	168(%rsp), %rsi
+	leaq	1(%rax), %rdx
+	je	.L843
+	movq	168(%rsp), %rsi
+.L843:
+	movq	%r12, %rdi
+	call	memcpy@PLT
+	movq	152(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L844
+	movq	160(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L844:
+	movq	%r12, 168(%rsp)
+	movq	144(%rsp), %rdx
+	movq	%rbp, 152(%rsp)
+.L837:
+	leaq	.LC29(%rip), %rax
+	cmpq	$23, %rbp
+	jne	.L835
+	leaq	168(%rsp), %rbx
+	jmp	.L1005
+.L1009:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1019
+.L749:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdx
+	jmp	.L747
+.L782:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1020
+.L787:
+	movq	_ZZN1n4heapEvE3res(%rip), %r13
+	movq	144(%rsp), %r14
+	pxor	%xmm0, %xmm0
+	xorl	%r15d, %r15d
+	movq	152(%rsp), %rbp
+	movups	%xmm0, 168(%rsp)
+	leaq	.LC27(%rip), %rax
+	movq	%r13, 160(%rsp)
+	leaq	7(%r14), %r12
+	movq	$0, 184(%rsp)
+	cmpq	$23, %rbp
+	je	.L1021
+.L789:
+	leaq	(%r15,%r14), %rdx
+	cmpq	%rdx, %rax
+	jnb	.L1022
+	subq	%r15, %rax
+	movq	%rax, 8(%rsp)
+	cmpq	%r12, %rbp
+	jnb	.L882
+	leaq	10(%rbp,%rbp), %rax
+	movl	$1, %edx
+	movq	%r13, %rdi
+	cmpq	%r12, %rax
+	cmovnb	%rax, %r12
+	movq	0(%r13), %rax
+	leaq	1(%r12), %rsi
+	call	*16(%rax)
+	leaq	1(%r14), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %rbp
+	je	.L793
+	movq	0(%r13), %rax
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r13, %rdi
+	call	*24(%rax)
+.L793:
+	movq	%rbx, 168(%rsp)
+	movq	%r12, %rbp
+	movq	%r12, 152(%rsp)
+.L792:
+	cmpq	$23, %rbp
+	jne	.L1008
+	leaq	168(%rsp), %rbx
+.L1008:
+	movq	8(%rsp), %rax
+	addq	%rbx, %rax
+	jmp	.L783
+.L1022:
+	cmpq	%r12, %rbp
+	jnb	.L881
+.L863:
+	leaq	10(%rbp,%rbp), %rax
+	movl	$1, %edx
+	movq	%r13, %rdi
+	cmpq	%r12, %rax
+	cmovnb	%rax, %r12
+	movq	0(%r13), %rax
+	leaq	1(%r12), %rsi
+	call	*16(%rax)
+	leaq	1(%r14), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %rbp
+	je	.L791
+	movq	0(%r13), %rax
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r13, %rdi
+	call	*24(%rax)
+.L791:
+	movq	%rbx, 168(%rsp)
+	movq	%r12, 152(%rsp)
+.L785:
+	leaq	.LC27(%rip), %rax
+	cmpq	$23, %r12
+	jne	.L783
+	leaq	168(%rsp), %rbx
+	jmp	.L1002
+.L810:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1023
+.L815:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	144(%rsp), %rdx
+	pxor	%xmm0, %xmm0
+	xorl	%ebx, %ebx
+	movq	152(%rsp), %rbp
+	movups	%xmm0, 168(%rsp)
+	leaq	.LC28(%rip), %rax
+	movq	%rdi, 160(%rsp)
+	leaq	14(%rdx), %rcx
+	movq	$0, 184(%rsp)
+	cmpq	$23, %rbp
+	je	.L1024
+.L817:
+	leaq	(%rbx,%rdx), %rsi
+	cmpq	%rsi, %rax
+	jnb	.L1025
+	subq	%rbx, %rax
+	movq	%rax, %r13
+	cmpq	%rcx, %rbp
+	jnb	.L894
+	leaq	10(%rbp,%rbp), %rbp
+	movq	(%rdi), %rax
+	movl	$1, %edx
+	cmpq	%rcx, %rbp
+	cmovb	%rcx, %rbp
+	leaq	1(%rbp), %rsi
+	call	*16(%rax)
+	movq	%rax, %r12
+	movq	144(%rsp), %rax
+	cmpq	$23, 152(%rsp)
+	leaq	168(%rsp), %rsi
+	leaq	1(%rax), %rdx
+	je	.L822
+	movq	168(%rsp), %rsi
+.L822:
+	movq	%r12, %rdi
+	call	memcpy@PLT
+	movq	152(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L823
+	movq	160(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L823:
+	movq	%r12, 168(%rsp)
+	movq	144(%rsp), %rdx
+	movq	%rbp, 152(%rsp)
+.L821:
+	leaq	(%r12,%r13), %rax
+	cmpq	$23, %rbp
+	jne	.L811
+	leaq	168(%rsp), %rbx
+	leaq	(%rbx,%r13), %rax
+	jmp	.L911
+.L1025:
+	cmpq	%rcx, %rbp
+	jnb	.L813
+.L862:
+	leaq	10(%rbp,%rbp), %rbp
+	movq	(%rdi), %rax
+	movl	$1, %edx
+	cmpq	%rcx, %rbp
+	cmovb	%rcx, %rbp
+	leaq	1(%rbp), %rsi
+	call	*16(%rax)
+	movq	%rax, %r12
+	movq	144(%rsp), %rax
+	cmpq	$23, 152(%rsp)
+	leaq	168(%rsp), %rsi
+	leaq	1(%rax), %rdx
+	je	.L819
+	movq	168(%rsp), %rsi
+.L819:
+	movq	%r12, %rdi
+	call	memcpy@PLT
+	movq	152(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L820
+	movq	160(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE17:
+.L820:
+	movq	%r12, 168(%rsp)
+	movq	144(%rsp), %rdx
+	movq	%rbp, 152(%rsp)
+.L813:
+	leaq	.LC28(%rip), %rax
+	cmpq	$23, %rbp
+	jne	.L811
+	leaq	168(%rsp), %rbx
+	jmp	.L1003
+.L1023:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L815
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L815
+.L1020:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L787
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L787
+.L1019:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L749
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L749
+.L1016:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L839
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L839
+.L1017:
+	leaq	168(%rsp), %rbx
+	cmpq	%rbx, %rax
+	jnb	.L841
+	cmpq	$23, %rcx
+	ja	.L861
+	jmp	.L910
+	.p2align 4,,10
+	.p2align 3
+.L868:
+	movq	24(%rsp), %rsi
+	xorl	%ebx, %ebx
+	cmpq	$23, %r13
+	jne	.L1026
+.L762:
+	addq	%r15, %rsi
+	jmp	.L764
+.L1014:
+	leaq	168(%rsp), %rbx
+	leaq	.LC26(%rip), %rax
+	cmpq	%rbx, %rax
+	jnb	.L1027
+	cmpq	$23, %r12
+	jbe	.L913
+	movq	%rbx, 8(%rsp)
+	jmp	.L864
+.L894:
+	xorl	%r12d, %r12d
+	jmp	.L821
+.L1024:
+	leaq	168(%rsp), %rbx
+	cmpq	%rbx, %rax
+	jnb	.L817
+	cmpq	$23, %rcx
+	ja	.L862
+	jmp	.L911
+	.p2align 4,,10
+	.p2align 3
+.L881:
+	xorl	%ebx, %ebx
+	movq	%rbp, %r12
+	jmp	.L785
+.L882:
+	xorl	%ebx, %ebx
+	jmp	.L792
+.L1021:
+	leaq	168(%rsp), %rbx
+	cmpq	%rbx, %rax
+	jnb	.L1028
+	cmpq	$23, %r12
+	jbe	.L783
+	movq	%rbx, %r15
+	jmp	.L863
+.L905:
+	xorl	%r12d, %r12d
+	jmp	.L845
+.L1028:
+	movq	%rbx, %r15
+	jmp	.L789
+.L913:
+	leaq	.LC26(%rip), %rsi
+	jmp	.L763
+.L1027:
+	movq	%rbx, 8(%rsp)
+	jmp	.L755
+.L916:
+	movq	%rax, %rbx
+	jmp	.L858
+.L914:
+	movq	%rax, %rbx
+	jmp	.L855
+.L996:
+	jmp	.L997
+	.section	.gcc_except_table
+.LLSDA6924:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6924-.LLSDACSB6924
+.LLSDACSB6924:
+	.uleb128 .LEHB13-.LFB6924
+	.uleb128 .LEHE13-.LEHB13
+	.uleb128 .L914-.LFB6924
+	.uleb128 0
+	.uleb128 .LEHB14-.LFB6924
+	.uleb128 .LEHE14-.LEHB14
+	.uleb128 .L914-.LFB6924
+	.uleb128 0
+	.uleb128 .LEHB15-.LFB6924
+	.uleb128 .LEHE15-.LEHB15
+	.uleb128 .L916-.LFB6924
+	.uleb128 0
+	.uleb128 .LEHB16-.LFB6924
+	.uleb128 .LEHE16-.LEHB16
+	.uleb128 .L916-.LFB6924
+	.uleb128 0
+	.uleb128 .LEHB17-.LFB6924
+	.uleb128 .LEHE17-.LEHB17
+	.uleb128 .L996-.LFB6924
+	.uleb128 0
+.LLSDACSE6924:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6924
+	.type	_Z27test_search_leading_literalv.cold, @function
+_Z27test_search_leading_literalv.cold:
+.LFSB6924:
+.L830:
+	.cfi_def_cfa_offset 256
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC30(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB18:
+	call	__cxa_throw@PLT
+.L999:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC31(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L1000:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC32(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE18:
+.L915:
+.L997:
+	movq	%rax, %rbx
+.L857:
+	movq	104(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L860
+	movq	112(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	120(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L860:
+	movq	%rbx, %rdi
+.LEHB19:
+	call	_Unwind_Resume@PLT
+.LEHE19:
+.L998:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC21(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB20:
+	call	__cxa_throw@PLT
+.LEHE20:
+.L858:
+	cmpq	$23, %rbp
+	je	.L857
+	movq	160(%rsp), %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L857
+.L855:
+	cmpq	$23, %r13
+	je	.L857
+	movq	160(%rsp), %rdi
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	movq	168(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L857
+	.cfi_endproc
+.LFE6924:
+	.section	.gcc_except_table
+.LLSDAC6924:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6924-.LLSDACSBC6924
+.LLSDACSBC6924:
+	.uleb128 .LEHB18-.LCOLDB33
+	.uleb128 .LEHE18-.LEHB18
+	.uleb128 .L915-.LCOLDB33
+	.uleb128 0
+	.uleb128 .LEHB19-.LCOLDB33
+	.uleb128 .LEHE19-.LEHB19
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB20-.LCOLDB33
+	.uleb128 .LEHE20-.LEHB20
+	.uleb128 .L915-.LCOLDB33
+	.uleb128 0
+.LLSDACSEC6924:
+	.section	.text.unlikely
+	.text
+	.size	_Z27test_search_leading_literalv, .-_Z27test_search_leading_literalv
+	.section	.text.unlikely
+	.size	_Z27test_search_leading_literalv.cold, .-_Z27test_search_leading_literalv.cold
+.LCOLDE33:
+	.text
+.LHOTE33:
+	.section	.text.unlikely
+.LCOLDB35:
+	.section	.text.startup
+.LHOTB35:
+	.p2align 4
+	.type	_GLOBAL__sub_I__Z20test_search_sequencev, @function
+_GLOBAL__sub_I__Z20test_search_sequencev:
+.LFB7124:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7124
+	cmpb	$0, _ZGVN1n4stdrE(%rip)
+	je	.L1060
+	ret
+.L1060:
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movl	$4294967295, %eax
+	xorl	%edi, %edi
+	xorl	%r8d, %r8d
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$48, %rsp
+	.cfi_def_cfa_offset 80
+	movdqa	.LC34(%rip), %xmm0
+	movq	stdin(%rip), %rbx
+	movb	$1, _ZGVN1n4stdrE(%rip)
+	movq	%rax, _ZN1n4stdrE(%rip)
+	movq	$0, 8+_ZN1n4stdrE(%rip)
+	movq	%rdi, 16+_ZN1n4stdrE(%rip)
+	movq	%r8, 40+_ZN1n4stdrE(%rip)
+	movups	%xmm0, 24+_ZN1n4stdrE(%rip)
+	testq	%rbx, %rbx
+	je	.L1061
+	movq	%rbx, %rdi
+	movq	%rbx, 48+_ZN1n4stdrE(%rip)
+	call	fileno@PLT
+	movq	%rbx, %rdi
+	call	fileno@PLT
+	movl	_ZN1n4stdrE(%rip), %ebx
+	xorl	%edx, %edx
+	xorl	%ecx, %ecx
+	movdqa	.LC34(%rip), %xmm0
+	movl	%eax, (%rsp)
+	movw	$0, 4(%rsp)
+	movb	$0, 6(%rsp)
+	movq	$0, 8(%rsp)
+	movq	%rdx, 16(%rsp)
+	movq	%rcx, 40(%rsp)
+	movups	%xmm0, 24(%rsp)
+	testl	%ebx, %ebx
+	js	.L1033
+	cmpl	$2, 8+_ZN1n4stdrE(%rip)
+	je	.L1062
+.L1034:
+	cmpb	$0, 4+_ZN1n4stdrE(%rip)
+	jne	.L1039
+.L1040:
+	movl	$-1, _ZN1n4stdrE(%rip)
+.L1033:
+	cmpq	$0, 16+_ZN1n4stdrE(%rip)
+	je	.L1045
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1063
+.L1043:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24+_ZN1n4stdrE(%rip), %rdx
+	movl	$64, %ecx
+	movq	16+_ZN1n4stdrE(%rip), %rsi
+	movq	(%rdi), %rax
+.LEHB21:
+	call	*24(%rax)
+.L1045:
+	movl	(%rsp), %eax
+	movdqu	24(%rsp), %xmm1
+	movl	%eax, _ZN1n4stdrE(%rip)
+	movzwl	4(%rsp), %eax
+	movups	%xmm1, 24+_ZN1n4stdrE(%rip)
+	movw	%ax, 4+_ZN1n4stdrE(%rip)
+	movzbl	6(%rsp), %eax
+	movb	%al, 6+_ZN1n4stdrE(%rip)
+	movq	8(%rsp), %rax
+	movq	%rax, 8+_ZN1n4stdrE(%rip)
+	movq	16(%rsp), %rax
+	movq	%rax, 16+_ZN1n4stdrE(%rip)
+	movq	40(%rsp), %rax
+	movq	%rax, 40+_ZN1n4stdrE(%rip)
+	jmp	.L1032
+.L1061:
+	xorl	%esi, %esi
+	movq	%rsi, 48+_ZN1n4stdrE(%rip)
+.L1032:
+	addq	$48, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	leaq	__dso_handle(%rip), %rdx
+	leaq	_ZN1n4stdrE(%rip), %rsi
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+	leaq	_ZN1n4fileIcLNS_4modeE6EED1Ev(%rip), %rdi
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+	jmp	__cxa_atexit@PLT
+.L1062:
+	.cfi_restore_state
+	movq	40+_ZN1n4stdrE(%rip), %rbp
+	testq	%rbp, %rbp
+	je	.L1034
+	movq	16+_ZN1n4stdrE(%rip), %r12
+.L1038:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1064
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L1038
+.L1037:
+	xorl	%eax, %eax
+	movq	%rax, 40+_ZN1n4stdrE(%rip)
+	jmp	.L1034
+.L1039:
+	movl	_ZN1n4stdrE(%rip), %edi
+	call	close@PLT
+.LEHE21:
+	jmp	.L1040
+.L1063:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1043
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1043
+.L1064:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1037
+	jmp	.L1038
+.L1047:
+	movq	%rax, %rbx
+	jmp	.L1046
+	.section	.gcc_except_table
+.LLSDA7124:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7124-.LLSDACSB7124
+.LLSDACSB7124:
+	.uleb128 .LEHB21-.LFB7124
+	.uleb128 .LEHE21-.LEHB21
+	.uleb128 .L1047-.LFB7124
+	.uleb128 0
+.LLSDACSE7124:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7124
+	.type	_GLOBAL__sub_I__Z20test_search_sequencev.cold, @function
+_GLOBAL__sub_I__Z20test_search_sequencev.cold:
+.LFSB7124:
+.L1046:
+	.cfi_def_cfa_offset 80
+	.cfi_offset 3, -32
+	.cfi_offset 6, -24
+	.cfi_offset 12, -16
+	movq	%rsp, %rdi
+	call	_ZN1n7fd_file5closeEv
+	leaq	_ZN1n4stdrE(%rip), %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB22:
+	call	_Unwind_Resume@PLT
+.LEHE22:
+	.cfi_endproc
+.LFE7124:
+	.section	.gcc_except_table
+.LLSDAC7124:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7124-.LLSDACSBC7124
+.LLSDACSBC7124:
+	.uleb128 .LEHB22-.LCOLDB35
+	.uleb128 .LEHE22-.LEHB22
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC7124:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	_GLOBAL__sub_I__Z20test_search_sequencev, .-_GLOBAL__sub_I__Z20test_search_sequencev
+	.section	.text.unlikely
+	.size	_GLOBAL__sub_I__Z20test_search_sequencev.cold, .-_GLOBAL__sub_I__Z20test_search_sequencev.cold
+.LCOLDE35:
+	.section	.text.startup
+.LHOTE35:
+	.section	.init_array,"aw"
+	.align 8
+	.quad	_GLOBAL__sub_I__Z20test_search_sequencev
+	.weak	_ZGVN1n4stdrE
+	.section	.bss._ZGVN1n4stdrE,"awG",@nobits,_ZGVN1n4stdrE,comdat
+	.align 8
+	.type	_ZGVN1n4stdrE, @gnu_unique_object
+	.size	_ZGVN1n4stdrE, 8
+_ZGVN1n4stdrE:
+	.zero	8
+	.weak	_ZTSN1n15memory_resourceE
+	.section	.rodata._ZTSN1n15memory_resourceE,"aG",@progbits,_ZTSN1n15memory_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n15memory_resourceE, @object
+	.size	_ZTSN1n15memory_resourceE, 22
+_ZTSN1n15memory_resourceE:
+	.string	"N1n15memory_resourceE"
+	.weak	_ZTIN1n15memory_resourceE
+	.section	.data.rel.ro._ZTIN1n15memory_resourceE,"awG",@progbits,_ZTIN1n15memory_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n15memory_resourceE, @object
+	.size	_ZTIN1n15memory_resourceE, 16
+_ZTIN1n15memory_resourceE:
+	.quad	_ZTVN10__cxxabiv117__class_type_infoE+16
+	.quad	_ZTSN1n15memory_resourceE
+	.weak	_ZTSN1n13heap_resourceE
+	.section	.rodata._ZTSN1n13heap_resourceE,"aG",@progbits,_ZTSN1n13heap_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n13heap_resourceE, @object
+	.size	_ZTSN1n13heap_resourceE, 20
+_ZTSN1n13heap_resourceE:
+	.string	"N1n13heap_resourceE"
+	.weak	_ZTIN1n13heap_resourceE
+	.section	.data.rel.ro._ZTIN1n13heap_resourceE,"awG",@progbits,_ZTIN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n13heap_resourceE, @object
+	.size	_ZTIN1n13heap_resourceE, 24
+_ZTIN1n13heap_resourceE:
+	.quad	_ZTVN10__cxxabiv120__si_class_type_infoE+16
+	.quad	_ZTSN1n13heap_resourceE
+	.quad	_ZTIN1n15memory_resourceE
+	.weak	_ZTVN1n13heap_resourceE
+	.section	.data.rel.ro.local._ZTVN1n13heap_resourceE,"awG",@progbits,_ZTVN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTVN1n13heap_resourceE, @object
+	.size	_ZTVN1n13heap_resourceE, 48
+_ZTVN1n13heap_resourceE:
+	.quad	0
+	.quad	_ZTIN1n13heap_resourceE
+	.quad	_ZN1n13heap_resourceD1Ev
+	.quad	_ZN1n13heap_resourceD0Ev
+	.quad	_ZN1n13heap_resource8allocateEmm
+	.quad	_ZN1n13heap_resource10deallocateEPvmm
+	.weak	_ZN1n4stdrE
+	.section	.bss._ZN1n4stdrE,"awG",@nobits,_ZN1n4stdrE,comdat
+	.align 32
+	.type	_ZN1n4stdrE, @gnu_unique_object
+	.size	_ZN1n4stdrE, 56
+_ZN1n4stdrE:
+	.zero	56
+	.weak	_ZGVZN1n9simd_bestEvE4best
+	.section	.bss._ZGVZN1n9simd_bestEvE4best,"awG",@nobits,_ZGVZN1n9simd_bestEvE4best,comdat
+	.align 8
+	.type	_ZGVZN1n9simd_bestEvE4best, @gnu_unique_object
+	.size	_ZGVZN1n9simd_bestEvE4best, 8
+_ZGVZN1n9simd_bestEvE4best:
+	.zero	8
+	.weak	_ZZN1n9simd_bestEvE4best
+	.section	.bss._ZZN1n9simd_bestEvE4best,"awG",@nobits,_ZZN1n9simd_bestEvE4best,comdat
+	.align 4
+	.type	_ZZN1n9simd_bestEvE4best, @gnu_unique_object
+	.size	_ZZN1n9simd_bestEvE4best, 4
+_ZZN1n9simd_bestEvE4best:
+	.zero	4
+	.weak	_ZN1n18__current_resourceE
+	.section	.tbss._ZN1n18__current_resourceE,"awTG",@nobits,_ZN1n18__current_resourceE,comdat
+	.align 8
+	.type	_ZN1n18__current_resourceE, @gnu_unique_object
+	.size	_ZN1n18__current_resourceE, 8
+_ZN1n18__current_resourceE:
+	.zero	8
+	.weak	_ZGVZN1n4heapEvE3res
+	.section	.bss._ZGVZN1n4heapEvE3res,"awG",@nobits,_ZGVZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZGVZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZGVZN1n4heapEvE3res, 8
+_ZGVZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE3res
+	.section	.bss._ZZN1n4heapEvE3res,"awG",@nobits,_ZZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZZN1n4heapEvE3res, 8
+_ZZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE7storage
+	.section	.bss._ZZN1n4heapEvE7storage,"awG",@nobits,_ZZN1n4heapEvE7storage,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE7storage, @gnu_unique_object
+	.size	_ZZN1n4heapEvE7storage, 8
+_ZZN1n4heapEvE7storage:
+	.zero	8
+	.section	.rodata.cst2,"aM",@progbits,2
+	.align 2
+.LC1:
+	.byte	10
+	.byte	0
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC12:
+	.long	2
+	.long	100
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC20:
+	.quad	0
+	.quad	23
+	.align 16
+.LC34:
+	.quad	65536
+	.quad	0
+	.hidden	DW.ref._ZTIPKc
+	.weak	DW.ref._ZTIPKc
+	.section	.data.rel.local.DW.ref._ZTIPKc,"awG",@progbits,DW.ref._ZTIPKc,comdat
+	.align 8
+	.type	DW.ref._ZTIPKc, @object
+	.size	DW.ref._ZTIPKc, 8
+DW.ref._ZTIPKc:
+	.quad	_ZTIPKc
+	.hidden	DW.ref.__gxx_personality_v0
+	.weak	DW.ref.__gxx_personality_v0
+	.section	.data.rel.local.DW.ref.__gxx_personality_v0,"awG",@progbits,DW.ref.__gxx_personality_v0,comdat
+	.align 8
+	.type	DW.ref.__gxx_personality_v0, @object
+	.size	DW.ref.__gxx_personality_v0, 8
+DW.ref.__gxx_personality_v0:
+	.quad	__gxx_personality_v0
+	.hidden	__dso_handle
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,15988 @@
+	.file	"tests-simd.cpp"
+	.text
+	.section	.text._ZN1n13heap_resourceD2Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD2Ev
+	.type	_ZN1n13heap_resourceD2Ev, @function
+_ZN1n13heap_resourceD2Ev:
+.LFB6957:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE6957:
+	.size	_ZN1n13heap_resourceD2Ev, .-_ZN1n13heap_resourceD2Ev
+	.weak	_ZN1n13heap_resourceD1Ev
+	.set	_ZN1n13heap_resourceD1Ev,_ZN1n13heap_resourceD2Ev
+	.section	.text._ZN1n13heap_resource10deallocateEPvmm,"axG",@progbits,_ZN1n13heap_resource10deallocateEPvmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource10deallocateEPvmm
+	.type	_ZN1n13heap_resource10deallocateEPvmm, @function
+_ZN1n13heap_resource10deallocateEPvmm:
+.LFB6573:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rcx
+	jbe	.L4
+	movq	%rcx, %rsi
+	jmp	_ZdlPvSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	jmp	_ZdlPv@PLT
+	.cfi_endproc
+.LFE6573:
+	.size	_ZN1n13heap_resource10deallocateEPvmm, .-_ZN1n13heap_resource10deallocateEPvmm
+	.section	.text._ZN1n13heap_resource8allocateEmm,"axG",@progbits,_ZN1n13heap_resource8allocateEmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource8allocateEmm
+	.type	_ZN1n13heap_resource8allocateEmm, @function
+_ZN1n13heap_resource8allocateEmm:
+.LFB6572:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rdx
+	jbe	.L6
+	movq	%rdx, %rsi
+	jmp	_ZnwmSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	jmp	_Znwm@PLT
+	.cfi_endproc
+.LFE6572:
+	.size	_ZN1n13heap_resource8allocateEmm, .-_ZN1n13heap_resource8allocateEmm
+	.section	.text._ZN1n13heap_resourceD0Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD0Ev
+	.type	_ZN1n13heap_resourceD0Ev, @function
+_ZN1n13heap_resourceD0Ev:
+.LFB6959:
+	.cfi_startproc
+	movl	$8, %esi
+	jmp	_ZdlPvm@PLT
+	.cfi_endproc
+.LFE6959:
+	.size	_ZN1n13heap_resourceD0Ev, .-_ZN1n13heap_resourceD0Ev
+	.text
+	.p2align 4
+	.type	_ZN1n13__avx2_searchIcEEmPKT_mS3_m.constprop.0, @function
+_ZN1n13__avx2_searchIcEEmPKT_mS3_m.constprop.0:
+.LFB6974:
+	.cfi_startproc
+	movzbl	(%rdx), %r9d
+	movzbl	2(%rdx), %r10d
+	movq	%rdi, %rcx
+	movq	%rsi, %r8
+	movq	%rdx, %rdi
+	vmovd	%r9d, %xmm2
+	vmovd	%r10d, %xmm3
+	vpbroadcastb	%xmm2, %ymm2
+	vpbroadcastb	%xmm3, %ymm3
+	cmpq	$33, %rsi
+	jbe	.L16
+	xorl	%esi, %esi
+.L13:
+	vpcmpeqb	(%rcx,%rsi), %ymm2, %ymm0
+	vpcmpeqb	2(%rcx,%rsi), %ymm3, %ymm1
+	vpand	%ymm1, %ymm0, %ymm0
+	vpmovmskb	%ymm0, %edx
+	testl	%edx, %edx
+	je	.L10
+	movzbl	1(%rdi), %r11d
+	jmp	.L12
+	.p2align 4,,10
+	.p2align 3
+.L25:
+	leal	-1(%rdx), %eax
+	andl	%eax, %edx
+	je	.L10
+.L12:
+	xorl	%eax, %eax
+	rep bsfl	%edx, %eax
+	cltq
+	addq	%rsi, %rax
+	cmpb	%r11b, 1(%rcx,%rax)
+	jne	.L25
+.L8:
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L10:
+	leaq	32(%rsi), %rax
+	addq	$66, %rsi
+	cmpq	%rsi, %r8
+	jb	.L26
+	movq	%rax, %rsi
+	jmp	.L13
+.L16:
+	xorl	%eax, %eax
+.L9:
+	cmpq	$2, %r8
+	jbe	.L19
+	addq	%rax, %rcx
+	xorl	%edx, %edx
+	.p2align 4,,10
+	.p2align 3
+.L14:
+	cmpb	(%rcx), %r9b
+	jne	.L15
+	movzbl	1(%rdi), %esi
+	cmpb	%sil, 1(%rcx)
+	jne	.L15
+	cmpb	2(%rcx), %r10b
+	jne	.L15
+	addq	%rdx, %rax
+	jmp	.L8
+	.p2align 4,,10
+	.p2align 3
+.L15:
+	leaq	1(%rdx), %rsi
+	addq	$4, %rdx
+	addq	$1, %rcx
+	cmpq	%rdx, %r8
+	jb	.L19
+	movq	%rsi, %rdx
+	jmp	.L14
+.L19:
+	movq	$-1, %rax
+	jmp	.L8
+.L26:
+	subq	%rax, %r8
+	jmp	.L9
+	.cfi_endproc
+.LFE6974:
+	.size	_ZN1n13__avx2_searchIcEEmPKT_mS3_m.constprop.0, .-_ZN1n13__avx2_searchIcEEmPKT_mS3_m.constprop.0
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC4:
+	.string	"xyz"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC7:
+	.string	"expected equal : expected value : n::simd_search(hay, len, \"xyz\", 3, level), actual value : len < 153 ? n::size_t(-1) : 150"
+	.section	.rodata.str1.1
+.LC8:
+	.string	"cab"
+	.section	.rodata.str1.8
+	.align 8
+.LC11:
+	.string	"expected equal : expected value : n::simd_search(hay, len, \"cab\", 3, level), actual value : len < 5 ? n::size_t(-1) : 2"
+	.section	.rodata.str1.1
+.LC12:
+	.string	"zab"
+	.section	.rodata.str1.8
+	.align 8
+.LC13:
+	.string	"expected equal : expected value : n::simd_search(hay + 1, len, \"zab\", 3, level), actual value : len < 154 ? n::size_t(-1) : 151"
+	.section	.text.unlikely,"ax",@progbits
+.LCOLDB14:
+	.text
+.LHOTB14:
+	.p2align 4
+	.globl	_Z16test_simd_searchv
+	.type	_Z16test_simd_searchv, @function
+_Z16test_simd_searchv:
+.LFB6739:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	movabsq	$8752855149986407009, %rax
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	xorl	%ebp, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$216, %rsp
+	.cfi_def_cfa_offset 256
+	movdqa	.LC1(%rip), %xmm1
+	movdqa	.LC2(%rip), %xmm0
+	movq	%rax, 144(%rsp)
+	movdqa	.LC0(%rip), %xmm2
+	movabsq	$7017560814792106362, %rax
+	movq	%rax, 152(%rsp)
+	movq	.LC3(%rip), %rax
+	movaps	%xmm2, (%rsp)
+	movq	%rax, 192(%rsp)
+	movaps	%xmm1, 16(%rsp)
+	movaps	%xmm0, 32(%rsp)
+	movaps	%xmm2, 48(%rsp)
+	movaps	%xmm1, 64(%rsp)
+	movaps	%xmm0, 80(%rsp)
+	movaps	%xmm2, 96(%rsp)
+	movaps	%xmm1, 112(%rsp)
+	movaps	%xmm0, 128(%rsp)
+	movaps	%xmm1, 160(%rsp)
+	movaps	%xmm0, 176(%rsp)
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L202
+.L124:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	jg	.L203
+.L151:
+	movl	$3, %ebx
+	movq	%rsp, %r12
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L204
+.L31:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	movl	%ebp, %eax
+	jge	.L205
+.L153:
+.L35:
+	cmpl	$1, %eax
+	je	.L42
+	subl	$2, %eax
+	cmpl	$1, %eax
+	ja	.L43
+	leaq	.LC4(%rip), %rdx
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	call	_ZN1n13__avx2_searchIcEEmPKT_mS3_m.constprop.0
+	cmpq	$152, %rbx
+	ja	.L45
+	cmpq	$-1, %rax
+	jne	.L206
+.L60:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L207
+.L62:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	movl	%ebp, %eax
+	jge	.L208
+.L155:
+.L66:
+	cmpl	$1, %eax
+	je	.L73
+.L214:
+	subl	$2, %eax
+	cmpl	$1, %eax
+	ja	.L74
+	leaq	.LC8(%rip), %rdx
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	call	_ZN1n13__avx2_searchIcEEmPKT_mS3_m.constprop.0
+	cmpq	$4, %rbx
+	jbe	.L209
+.L76:
+	cmpq	$2, %rax
+	jne	.L82
+.L90:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L210
+.L92:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	movl	%ebp, %eax
+	jge	.L211
+.L157:
+.L96:
+	cmpl	$1, %eax
+	je	.L103
+	subl	$2, %eax
+	cmpl	$1, %eax
+	ja	.L104
+	leaq	1(%rsp), %rdi
+	leaq	.LC12(%rip), %rdx
+	movq	%rbx, %rsi
+	call	_ZN1n13__avx2_searchIcEEmPKT_mS3_m.constprop.0
+.L105:
+	cmpq	$153, %rbx
+	ja	.L212
+	addq	$1, %rax
+	je	.L117
+	jmp	.L118
+	.p2align 4,,10
+	.p2align 3
+.L43:
+	movq	%r12, %rdx
+	xorl	%ecx, %ecx
+	leaq	-2(%rbx), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L46:
+	cmpb	$120, (%rdx)
+	movq	%rcx, %rax
+	leaq	1(%rcx), %rcx
+	jne	.L57
+	cmpb	$121, 1(%rdx)
+	jne	.L57
+	cmpb	$122, 2(%rdx)
+	jne	.L57
+.L49:
+	cmpq	$152, %rbx
+	jbe	.L59
+.L45:
+	cmpq	$150, %rax
+	jne	.L59
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	jne	.L62
+.L207:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L62
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L137
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L64:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	movl	%ebp, %eax
+	jl	.L66
+.L154:
+	.p2align 4,,10
+	.p2align 3
+.L208:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L213
+.L69:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %eax
+	cmpl	$1, %eax
+	jne	.L214
+.L73:
+	cmpq	$17, %rbx
+	jbe	.L141
+	xorl	%esi, %esi
+	leaq	2(%rsp), %rcx
+.L81:
+	movdqa	(%r12,%rsi), %xmm0
+	movdqu	(%rcx,%rsi), %xmm1
+	pcmpeqb	.LC9(%rip), %xmm0
+	pcmpeqb	.LC10(%rip), %xmm1
+	pand	%xmm1, %xmm0
+	pmovmskb	%xmm0, %edx
+	testl	%edx, %edx
+	je	.L79
+	.p2align 4,,10
+	.p2align 3
+.L80:
+	xorl	%eax, %eax
+	rep bsfl	%edx, %eax
+	cltq
+	addq	%rsi, %rax
+	cmpb	$97, 1(%rsp,%rax)
+	je	.L76
+	leal	-1(%rdx), %eax
+	andl	%eax, %edx
+	jne	.L80
+.L79:
+	leaq	16(%rsi), %rax
+	addq	$34, %rsi
+	cmpq	%rsi, %rbx
+	jb	.L215
+	movq	%rax, %rsi
+	jmp	.L81
+	.p2align 4,,10
+	.p2align 3
+.L57:
+	addq	$1, %rdx
+	cmpq	%rcx, %rsi
+	jne	.L46
+.L56:
+	cmpq	$152, %rbx
+	jbe	.L60
+.L221:
+	jmp	.L59
+	.p2align 4,,10
+	.p2align 3
+.L42:
+	cmpq	$17, %rbx
+	jbe	.L135
+	xorl	%esi, %esi
+	leaq	2(%rsp), %rcx
+.L51:
+	movdqa	(%r12,%rsi), %xmm0
+	movdqu	(%rcx,%rsi), %xmm1
+	pcmpeqb	.LC5(%rip), %xmm0
+	pcmpeqb	.LC6(%rip), %xmm1
+	pand	%xmm1, %xmm0
+	pmovmskb	%xmm0, %edx
+	testl	%edx, %edx
+	je	.L48
+	.p2align 4,,10
+	.p2align 3
+.L50:
+	xorl	%eax, %eax
+	rep bsfl	%edx, %eax
+	cltq
+	addq	%rsi, %rax
+	cmpb	$121, 1(%rsp,%rax)
+	je	.L49
+	leal	-1(%rdx), %eax
+	andl	%eax, %edx
+	jne	.L50
+.L48:
+	leaq	16(%rsi), %rdi
+	addq	$34, %rsi
+	cmpq	%rsi, %rbx
+	jb	.L216
+	movq	%rdi, %rsi
+	jmp	.L51
+.L104:
+	leaq	1(%rsp), %rax
+	xorl	%edx, %edx
+	leaq	-2(%rbx), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L106:
+	movq	%rdx, %rcx
+	addq	$1, %rdx
+	cmpb	$122, (%rax)
+	jne	.L115
+	cmpb	$97, 1(%rax)
+	jne	.L115
+	cmpb	$98, 2(%rax)
+	jne	.L115
+.L158:
+	cmpq	$153, %rbx
+	jbe	.L118
+	cmpq	$151, %rcx
+	jne	.L118
+.L200:
+	addq	$1, %rbx
+	cmpq	$200, %rbx
+	jne	.L29
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	addl	$1, %ebp
+	testb	%al, %al
+	jne	.L124
+.L202:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L124
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L149
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L126:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	jle	.L151
+.L203:
+	addq	$216, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L115:
+	.cfi_restore_state
+	addq	$1, %rax
+	cmpq	%rdx, %rsi
+	jne	.L106
+.L114:
+	cmpq	$153, %rbx
+	ja	.L217
+.L117:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	addq	$1, %rbx
+	testb	%al, %al
+	jne	.L31
+	.p2align 4,,10
+	.p2align 3
+.L204:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L31
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L131
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L33:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	movl	%ebp, %eax
+	jl	.L35
+.L152:
+	.p2align 4,,10
+	.p2align 3
+.L205:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L218
+.L38:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %eax
+	jmp	.L35
+	.p2align 4,,10
+	.p2align 3
+.L103:
+	cmpq	$17, %rbx
+	jbe	.L147
+	movdqa	.LC6(%rip), %xmm3
+	movdqa	.LC10(%rip), %xmm2
+	xorl	%ecx, %ecx
+	leaq	1(%rsp), %rdi
+	leaq	3(%rsp), %rsi
+.L110:
+	movdqu	(%rdi,%rcx), %xmm0
+	movdqu	(%rsi,%rcx), %xmm1
+	pcmpeqb	%xmm3, %xmm0
+	pcmpeqb	%xmm2, %xmm1
+	pand	%xmm1, %xmm0
+	pmovmskb	%xmm0, %edx
+	testl	%edx, %edx
+	je	.L108
+	.p2align 4,,10
+	.p2align 3
+.L109:
+	xorl	%eax, %eax
+	rep bsfl	%edx, %eax
+	cltq
+	addq	%rcx, %rax
+	cmpb	$97, 2(%rsp,%rax)
+	je	.L105
+	leal	-1(%rdx), %eax
+	andl	%eax, %edx
+	jne	.L109
+.L108:
+	leaq	16(%rcx), %r8
+	addq	$34, %rcx
+	cmpq	%rcx, %rbx
+	jb	.L219
+	movq	%r8, %rcx
+	jmp	.L110
+.L74:
+	movq	%r12, %rdx
+	xorl	%ecx, %ecx
+	leaq	-2(%rbx), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L77:
+	cmpb	$99, (%rdx)
+	movq	%rcx, %rax
+	leaq	1(%rcx), %rcx
+	jne	.L88
+	cmpb	$97, 1(%rdx)
+	jne	.L88
+	cmpb	$98, 2(%rdx)
+	jne	.L88
+	cmpq	$4, %rbx
+	ja	.L76
+	jmp	.L82
+	.p2align 4,,10
+	.p2align 3
+.L88:
+	addq	$1, %rdx
+	cmpq	%rcx, %rsi
+	jne	.L77
+.L87:
+	cmpq	$4, %rbx
+	jbe	.L90
+	jmp	.L82
+.L156:
+	.p2align 4,,10
+	.p2align 3
+.L211:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L220
+.L99:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %eax
+	jmp	.L96
+	.p2align 4,,10
+	.p2align 3
+.L210:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L92
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L143
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L94:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L92
+.L220:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L99
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L145
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L101:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L99
+.L218:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L38
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L133
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L40:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L38
+.L213:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L69
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L139
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L71:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L69
+.L141:
+	movq	%rbx, %rdi
+	xorl	%eax, %eax
+.L78:
+	leaq	(%r12,%rax), %rcx
+	xorl	%edx, %edx
+	.p2align 4,,10
+	.p2align 3
+.L83:
+	cmpb	$99, (%rcx)
+	jne	.L85
+	cmpb	$97, 1(%rcx)
+	jne	.L85
+	cmpb	$98, 2(%rcx)
+	jne	.L85
+	addq	%rdx, %rax
+	cmpq	$4, %rbx
+	ja	.L76
+	cmpq	$-1, %rax
+	je	.L90
+	jmp	.L82
+	.p2align 4,,10
+	.p2align 3
+.L85:
+	leaq	1(%rdx), %rsi
+	addq	$4, %rdx
+	addq	$1, %rcx
+	cmpq	%rdx, %rdi
+	jb	.L87
+	movq	%rsi, %rdx
+	jmp	.L83
+.L147:
+	movq	%rbx, %rsi
+	xorl	%r8d, %r8d
+.L107:
+	leaq	(%r12,%r8), %rdx
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L112:
+	cmpb	$122, 1(%rdx)
+	jne	.L113
+	cmpb	$97, 2(%rdx)
+	jne	.L113
+	cmpb	$98, 3(%rdx)
+	jne	.L113
+	addq	%r8, %rax
+	jmp	.L105
+.L113:
+	leaq	1(%rax), %rcx
+	addq	$4, %rax
+	addq	$1, %rdx
+	cmpq	%rax, %rsi
+	jb	.L114
+	movq	%rcx, %rax
+	jmp	.L112
+.L131:
+	movl	$3, %eax
+	jmp	.L33
+.L143:
+	movl	$3, %eax
+	jmp	.L94
+.L135:
+	movq	%rbx, %rsi
+	xorl	%edi, %edi
+.L47:
+	leaq	(%r12,%rdi), %rdx
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L53:
+	cmpb	$120, (%rdx)
+	jne	.L54
+	cmpb	$121, 1(%rdx)
+	jne	.L54
+	cmpb	$122, 2(%rdx)
+	jne	.L54
+	addq	%rdi, %rax
+	cmpq	$152, %rbx
+	ja	.L45
+	cmpq	$-1, %rax
+	je	.L60
+	jmp	.L59
+	.p2align 4,,10
+	.p2align 3
+.L54:
+	leaq	1(%rax), %rcx
+	addq	$4, %rax
+	addq	$1, %rdx
+	cmpq	%rax, %rsi
+	jb	.L56
+	movq	%rcx, %rax
+	jmp	.L53
+.L137:
+	movl	$3, %eax
+	jmp	.L64
+.L219:
+	movq	%rbx, %rsi
+	subq	%r8, %rsi
+	cmpq	$2, %rsi
+	ja	.L107
+	cmpq	$153, %rbx
+	jbe	.L117
+.L217:
+	jmp	.L118
+	.p2align 4,,10
+	.p2align 3
+.L216:
+	movq	%rbx, %rsi
+	subq	%rdi, %rsi
+	cmpq	$2, %rsi
+	ja	.L47
+	cmpq	$152, %rbx
+	jbe	.L60
+	jmp	.L221
+	.p2align 4,,10
+	.p2align 3
+.L215:
+	movq	%rbx, %rdi
+	subq	%rax, %rdi
+	cmpq	$2, %rdi
+	ja	.L78
+	jmp	.L82
+.L209:
+	cmpq	$-1, %rax
+	je	.L90
+	jmp	.L82
+	.p2align 4,,10
+	.p2align 3
+.L133:
+	movl	$3, %eax
+	jmp	.L40
+.L145:
+	movl	$3, %eax
+	jmp	.L101
+.L139:
+	movl	$3, %eax
+	jmp	.L71
+.L149:
+	movl	$3, %eax
+	jmp	.L126
+.L212:
+	cmpq	$151, %rax
+	je	.L200
+	jmp	.L118
+.L206:
+	jmp	.L59
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.type	_Z16test_simd_searchv.cold, @function
+_Z16test_simd_searchv.cold:
+.LFSB6739:
+.L118:
+	.cfi_def_cfa_offset 256
+	.cfi_offset 3, -40
+	.cfi_offset 6, -32
+	.cfi_offset 12, -24
+	.cfi_offset 13, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC13(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L82:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC11(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L59:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC7(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.cfi_endproc
+.LFE6739:
+	.text
+	.size	_Z16test_simd_searchv, .-_Z16test_simd_searchv
+	.section	.text.unlikely
+	.size	_Z16test_simd_searchv.cold, .-_Z16test_simd_searchv.cold
+.LCOLDE14:
+	.text
+.LHOTE14:
+	.section	.rodata._ZN1n4test10test_suite7run_allEv.str1.1,"aMS",@progbits,1
+.LC15:
+	.string	"\nSUITE [%s] "
+.LC17:
+	.string	"%s"
+.LC18:
+	.string	"\nTEST [%s] "
+.LC19:
+	.string	" - Result : \033[1;32mPASSED\033[0m"
+.LC20:
+	.string	"\033[1;31merror : %s\033[0m\n"
+.LC21:
+	.string	" - Result : \033[1;31mFAILED\033[0m"
+.LC22:
+	.string	" - Passed : \033[1;32m%d\033[0m\n"
+.LC23:
+	.string	" - Failed : \033[1;31m%d\033[0m\n"
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4test10test_suite7run_allEv
+	.type	_ZN1n4test10test_suite7run_allEv, @function
+_ZN1n4test10test_suite7run_allEv:
+.LFB6556:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6556
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	leaq	.LC15(%rip), %rdx
+	movl	$79, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	16(%rdi), %rcx
+	leaq	16(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L223
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L224
+	testb	$4, %cl
+	jne	.L277
+	testl	%ecx, %ecx
+	je	.L223
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L278
+	.p2align 4,,10
+	.p2align 3
+.L223:
+	movzwl	.LC16(%rip), %r15d
+	movq	%rbx, %rsi
+	leaq	.LC17(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+.LEHB0:
+	call	printf@PLT
+	movl	8(%r12), %esi
+	testl	%esi, %esi
+	jle	.L244
+	movl	$0, 12(%rsp)
+	xorl	%ebp, %ebp
+	xorl	%r14d, %r14d
+	jmp	.L238
+	.p2align 4,,10
+	.p2align 3
+.L281:
+	testb	$4, %dl
+	jne	.L279
+	testl	%edx, %edx
+	je	.L229
+	movb	$42, (%rax)
+	testb	$2, %dl
+	jne	.L280
+	.p2align 4,,10
+	.p2align 3
+.L229:
+	movq	%rbx, %rsi
+	leaq	.LC17(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+.LEHE0:
+	movq	(%r12), %rax
+.LEHB1:
+	call	*8(%rax,%r13)
+.LEHE1:
+	leaq	.LC19(%rip), %rdi
+	addl	$1, %r14d
+.LEHB2:
+	call	puts@PLT
+.L234:
+	addq	$1, %rbp
+	cmpl	%ebp, 8(%r12)
+	jle	.L228
+.L238:
+	movq	(%r12), %rax
+	movq	%rbp, %r13
+	movq	%rbx, %rdi
+	movl	$79, %esi
+	salq	$4, %r13
+	leaq	.LC18(%rip), %rdx
+	movq	(%rax,%r13), %rcx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L229
+	movl	$79, %edx
+	subl	%eax, %edx
+	addq	%rbx, %rax
+	cmpl	$8, %edx
+	jb	.L281
+	movabsq	$3038287259199220266, %rsi
+	leaq	8(%rax), %rdi
+	movl	%edx, %ecx
+	andq	$-8, %rdi
+	movq	%rsi, (%rax)
+	movq	%rsi, -8(%rax,%rcx)
+	subq	%rdi, %rax
+	leal	(%rdx,%rax), %ecx
+	movq	%rsi, %rax
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L229
+.L244:
+	movl	$0, 12(%rsp)
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L228:
+	movabsq	$5917806138674729738, %rax
+	movq	%rbx, %rdi
+	movq	%rax, 16(%rsp)
+	movabsq	$9095440486453792, %rax
+	movq	%rax, 22(%rsp)
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L239
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L240
+	testb	$4, %cl
+	jne	.L282
+	testl	%ecx, %ecx
+	je	.L239
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L283
+.L239:
+	movq	%rbx, %rsi
+	leaq	.LC17(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+	movl	%r14d, %esi
+	leaq	.LC22(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	12(%rsp), %esi
+	leaq	.LC23(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	$10, %edi
+	call	putchar@PLT
+.LEHE2:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L240:
+	.cfi_restore_state
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L239
+.L224:
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L223
+.L279:
+	movl	$707406378, (%rax)
+	movl	$707406378, -4(%rax,%rdx)
+	jmp	.L229
+.L280:
+	movl	$10794, %ecx
+	movw	%cx, -2(%rax,%rdx)
+	jmp	.L229
+.L278:
+	movl	$10794, %edi
+	movw	%di, -2(%rdx,%rcx)
+	jmp	.L223
+.L283:
+	movl	$10794, %eax
+	movw	%ax, -2(%rdx,%rcx)
+	jmp	.L239
+.L277:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L223
+.L282:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L239
+.L245:
+	movq	%rax, %rdi
+	movq	%rdx, %rax
+.L235:
+	subq	$1, %rax
+	jne	.L276
+	call	__cxa_begin_catch@PLT
+	leaq	.LC20(%rip), %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+.LEHB3:
+	call	printf@PLT
+.LEHE3:
+	call	__cxa_end_catch@PLT
+	leaq	.LC21(%rip), %rdi
+	addl	$1, 12(%rsp)
+.LEHB4:
+	call	puts@PLT
+	jmp	.L234
+.L237:
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+.L276:
+	call	_Unwind_Resume@PLT
+.LEHE4:
+.L246:
+	movq	%rax, %rbx
+	jmp	.L237
+	.cfi_endproc
+.LFE6556:
+	.globl	__gxx_personality_v0
+	.section	.gcc_except_table._ZN1n4test10test_suite7run_allEv,"aG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.align 4
+.LLSDA6556:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT6556-.LLSDATTD6556
+.LLSDATTD6556:
+	.byte	0x1
+	.uleb128 .LLSDACSE6556-.LLSDACSB6556
+.LLSDACSB6556:
+	.uleb128 .LEHB0-.LFB6556
+	.uleb128 .LEHE0-.LEHB0
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB1-.LFB6556
+	.uleb128 .LEHE1-.LEHB1
+	.uleb128 .L245-.LFB6556
+	.uleb128 0x1
+	.uleb128 .LEHB2-.LFB6556
+	.uleb128 .LEHE2-.LEHB2
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB3-.LFB6556
+	.uleb128 .LEHE3-.LEHB3
+	.uleb128 .L246-.LFB6556
+	.uleb128 0
+	.uleb128 .LEHB4-.LFB6556
+	.uleb128 .LEHE4-.LEHB4
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6556:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	DW.ref._ZTIPKc-.
+.LLSDATT6556:
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.size	_ZN1n4test10test_suite7run_allEv, .-_ZN1n4test10test_suite7run_allEv
+	.section	.rodata.str1.1
+.LC24:
+	.string	"n::simd tests"
+.LC25:
+	.string	"test_simd_char"
+.LC26:
+	.string	"test_simd_16"
+.LC27:
+	.string	"test_simd_32"
+.LC28:
+	.string	"test_simd_64"
+.LC29:
+	.string	"test_simd_count_long_bytes"
+.LC30:
+	.string	"test_simd_algorithms"
+.LC31:
+	.string	"test_simd_search"
+	.section	.text.unlikely
+.LCOLDB33:
+	.section	.text.startup,"ax",@progbits
+.LHOTB33:
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB6740:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6740
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$1600, %edi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 64
+.LEHB5:
+	call	_Znam@PLT
+.LEHE5:
+	movq	%rax, %rbx
+	leaq	1600(%rax), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L285:
+	movq	$0, (%rax)
+	addq	$16, %rax
+	movq	$0, -8(%rax)
+	cmpq	%rax, %rdx
+	jne	.L285
+	leaq	.LC24(%rip), %rax
+	movq	%rsp, %rdi
+	movq	%rbx, (%rsp)
+	movq	%rax, 16(%rsp)
+	leaq	.LC25(%rip), %rax
+	movq	%rax, (%rbx)
+	leaq	_Z14test_simd_charv(%rip), %rax
+	movq	%rax, 8(%rbx)
+	leaq	.LC26(%rip), %rax
+	movq	%rax, 16(%rbx)
+	leaq	_Z12test_simd_16v(%rip), %rax
+	movq	%rax, 24(%rbx)
+	leaq	.LC27(%rip), %rax
+	movq	%rax, 32(%rbx)
+	leaq	_Z12test_simd_32v(%rip), %rax
+	movq	%rax, 40(%rbx)
+	leaq	.LC28(%rip), %rax
+	movq	%rax, 48(%rbx)
+	leaq	_Z12test_simd_64v(%rip), %rax
+	movq	%rax, 56(%rbx)
+	leaq	.LC29(%rip), %rax
+	movq	%rax, 64(%rbx)
+	leaq	_Z26test_simd_count_long_bytesv(%rip), %rax
+	movq	%rax, 72(%rbx)
+	leaq	.LC30(%rip), %rax
+	movq	%rax, 80(%rbx)
+	leaq	_Z20test_simd_algorithmsv(%rip), %rax
+	movq	%rax, 88(%rbx)
+	leaq	.LC31(%rip), %rax
+	movq	%rax, 96(%rbx)
+	leaq	_Z16test_simd_searchv(%rip), %rax
+	movq	%rax, 104(%rbx)
+	movq	.LC32(%rip), %rax
+	movq	%rax, 8(%rsp)
+.LEHB6:
+	call	_ZN1n4test10test_suite7run_allEv
+.LEHE6:
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L287:
+	.cfi_restore_state
+	movq	%rax, %rbp
+	jmp	.L286
+	.section	.gcc_except_table,"a",@progbits
+.LLSDA6740:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6740-.LLSDACSB6740
+.LLSDACSB6740:
+	.uleb128 .LEHB5-.LFB6740
+	.uleb128 .LEHE5-.LEHB5
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB6-.LFB6740
+	.uleb128 .LEHE6-.LEHB6
+	.uleb128 .L287-.LFB6740
+	.uleb128 0
+.LLSDACSE6740:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6740
+	.type	main.cold, @function
+main.cold:
+.LFSB6740:
+.L286:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	movq	%rbp, %rdi
+.LEHB7:
+	call	_Unwind_Resume@PLT
+.LEHE7:
+	.cfi_endproc
+.LFE6740:
+	.section	.gcc_except_table
+.LLSDAC6740:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6740-.LLSDACSBC6740
+.LLSDACSBC6740:
+	.uleb128 .LEHB7-.LCOLDB33
+	.uleb128 .LEHE7-.LEHB7
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6740:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	main, .-main
+	.section	.text.unlikely
+	.size	main.cold, .-main.cold
+.LCOLDE33:
+	.section	.text.startup
+.LHOTE33:
+	.section	.text._ZN1n6vectorIcE6resizeEmRKc,"axG",@progbits,_ZN1n6vectorIcE6resizeEmRKc,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n6vectorIcE6resizeEmRKc
+	.type	_ZN1n6vectorIcE6resizeEmRKc, @function
+_ZN1n6vectorIcE6resizeEmRKc:
+.LFB6757:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movq	%rdx, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movq	%rdi, %rbx
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 64
+	movq	16(%rdi), %rdx
+	cmpq	%rdx, %rsi
+	jb	.L300
+	movq	8(%rdi), %r13
+	cmpq	%rsi, %r13
+	jnb	.L295
+	movq	(%rdi), %r14
+	cmpq	%r14, %r12
+	jb	.L296
+	addq	%r14, %rdx
+	cmpq	%rdx, %r12
+	jnb	.L296
+	movzbl	(%r12), %eax
+	leaq	15(%rsp), %rdx
+	movb	%al, 15(%rsp)
+	call	_ZN1n6vectorIcE6resizeEmRKc
+	jmp	.L292
+	.p2align 4,,10
+	.p2align 3
+.L307:
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+.L298:
+	movq	24(%rbx), %rdi
+	movq	%r13, %rdx
+	movl	$1, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	16(%rbx), %rdx
+.L295:
+	cmpq	%rbp, %rdx
+	jnb	.L300
+	.p2align 4,,10
+	.p2align 3
+.L301:
+	movzbl	(%r12), %ecx
+	movq	(%rbx), %rax
+	movb	%cl, (%rax,%rdx)
+	addq	$1, %rdx
+	cmpq	%rdx, %rbp
+	jne	.L301
+.L300:
+	movq	%rbp, 16(%rbx)
+.L292:
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L296:
+	.cfi_restore_state
+	movq	24(%rbx), %rdi
+	movl	$1, %edx
+	movq	%rbp, %rsi
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	16(%rbx), %rdx
+	movq	%rbp, 8(%rbx)
+	movq	%rax, (%rbx)
+	testq	%rdx, %rdx
+	jne	.L307
+	testq	%r14, %r14
+	je	.L301
+	jmp	.L298
+	.cfi_endproc
+.LFE6757:
+	.size	_ZN1n6vectorIcE6resizeEmRKc, .-_ZN1n6vectorIcE6resizeEmRKc
+	.section	.text._ZN1n14__avx512_countIcEEmPKT_mS1_,"axG",@progbits,_ZN1n14__avx512_countIcEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n14__avx512_countIcEEmPKT_mS1_
+	.type	_ZN1n14__avx512_countIcEEmPKT_mS1_, @function
+_ZN1n14__avx512_countIcEEmPKT_mS1_:
+.LFB6809:
+	.cfi_startproc
+	movl	%edx, %r10d
+	vpbroadcastb	%edx, %zmm5
+	movl	$64, %eax
+	xorl	%r8d, %r8d
+	cmpq	$63, %rsi
+	jbe	.L334
+	.p2align 4,,10
+	.p2align 3
+.L312:
+	vpcmpeqb	-64(%rdi,%rax), %zmm5, %k0
+	movq	%rax, %r9
+	addq	$64, %rax
+	kmovq	%k0, %rcx
+	popcntq	%rcx, %rcx
+	addq	%rcx, %r8
+	cmpq	%rax, %rsi
+	jnb	.L312
+	subq	%r9, %rsi
+	je	.L308
+	leaq	-1(%rsi), %rax
+	cmpq	$62, %rax
+	jbe	.L319
+	movq	%rsi, %rcx
+	addq	%r9, %rdi
+	movl	$1, %r9d
+	andq	$-64, %rcx
+	movq	%rdi, %rax
+	vpxor	%xmm7, %xmm7, %xmm7
+	addq	%rdi, %rcx
+	vpbroadcastb	%r9d, %zmm6
+	.p2align 4,,10
+	.p2align 3
+.L313:
+	vpcmpb	$0, (%rax), %zmm5, %k1
+	addq	$64, %rax
+	vmovdqu8	%zmm6, %zmm0{%k1}{z}
+	vpmovzxbw	%ymm0, %zmm1
+	vextracti64x4	$0x1, %zmm0, %ymm0
+	vpmovzxwd	%ymm1, %zmm4
+	vextracti64x4	$0x1, %zmm1, %ymm1
+	vpmovzxbw	%ymm0, %zmm0
+	vpmovzxdq	%ymm4, %zmm2
+	vextracti64x4	$0x1, %zmm4, %ymm4
+	vpmovzxwd	%ymm1, %zmm1
+	vpmovzxdq	%ymm4, %zmm4
+	vpmovzxwd	%ymm0, %zmm3
+	vextracti64x4	$0x1, %zmm0, %ymm0
+	vpaddq	%zmm4, %zmm2, %zmm2
+	vpmovzxdq	%ymm1, %zmm4
+	vextracti64x4	$0x1, %zmm1, %ymm1
+	vpmovzxdq	%ymm1, %zmm1
+	vpmovzxwd	%ymm0, %zmm0
+	vpaddq	%zmm1, %zmm4, %zmm4
+	vpmovzxdq	%ymm3, %zmm1
+	vextracti64x4	$0x1, %zmm3, %ymm3
+	vpmovzxdq	%ymm3, %zmm3
+	vpaddq	%zmm4, %zmm2, %zmm2
+	vpaddq	%zmm3, %zmm1, %zmm1
+	vpmovzxdq	%ymm0, %zmm3
+	vextracti64x4	$0x1, %zmm0, %ymm0
+	vpaddq	%zmm3, %zmm1, %zmm1
+	vpmovzxdq	%ymm0, %zmm0
+	vpaddq	%zmm1, %zmm2, %zmm2
+	vpaddq	%zmm7, %zmm0, %zmm0
+	vpaddq	%zmm0, %zmm2, %zmm7
+	cmpq	%rax, %rcx
+	jne	.L313
+	vmovdqa	%ymm7, %ymm3
+	vextracti64x4	$0x1, %zmm7, %ymm7
+	movq	%rsi, %rax
+	vpaddq	%ymm7, %ymm3, %ymm3
+	andq	$-64, %rax
+	vextracti128	$0x1, %ymm3, %xmm1
+	vpaddq	%xmm1, %xmm3, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rcx
+	testb	$63, %sil
+	je	.L314
+.L310:
+	movq	%rsi, %r9
+	subq	%rax, %r9
+	leaq	-1(%r9), %r11
+	cmpq	$30, %r11
+	jbe	.L317
+	vmovd	%edx, %xmm0
+	movl	$1, %edx
+	vpbroadcastb	%xmm0, %ymm0
+	vmovd	%edx, %xmm1
+	movq	%r9, %rdx
+	vpcmpeqb	(%rdi,%rax), %ymm0, %ymm0
+	vpbroadcastb	%xmm1, %ymm1
+	andq	$-32, %rdx
+	addq	%rdx, %rax
+	andl	$31, %r9d
+	vpand	%ymm1, %ymm0, %ymm0
+	vpmovzxbw	%xmm0, %ymm2
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxwd	%xmm2, %ymm4
+	vextracti128	$0x1, %ymm2, %xmm2
+	vpmovzxbw	%xmm0, %ymm0
+	vpmovzxwd	%xmm2, %ymm2
+	vpmovzxwd	%xmm0, %ymm5
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxdq	%xmm2, %ymm1
+	vextracti128	$0x1, %ymm2, %xmm2
+	vpmovzxwd	%xmm0, %ymm0
+	vpmovzxdq	%xmm2, %ymm2
+	vpaddq	%ymm2, %ymm1, %ymm1
+	vpmovzxdq	%xmm4, %ymm2
+	vextracti128	$0x1, %ymm4, %xmm4
+	vpmovzxdq	%xmm4, %ymm4
+	vpaddq	%ymm4, %ymm2, %ymm2
+	vpaddq	%ymm2, %ymm1, %ymm1
+	vpmovzxdq	%xmm5, %ymm2
+	vextracti128	$0x1, %ymm5, %xmm5
+	vpmovzxdq	%xmm5, %ymm5
+	vpaddq	%ymm5, %ymm2, %ymm2
+	vpaddq	%ymm3, %ymm2, %ymm2
+	vpaddq	%ymm2, %ymm1, %ymm1
+	vpmovzxdq	%xmm0, %ymm2
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxdq	%xmm0, %ymm0
+	vpaddq	%ymm0, %ymm2, %ymm0
+	vpaddq	%ymm0, %ymm1, %ymm1
+	vmovdqa	%xmm1, %xmm0
+	vextracti128	$0x1, %ymm1, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rcx
+	je	.L314
+	.p2align 4,,10
+	.p2align 3
+.L317:
+	xorl	%edx, %edx
+	cmpb	%r10b, (%rdi,%rax)
+	sete	%dl
+	addq	$1, %rax
+	addq	%rdx, %rcx
+	cmpq	%rsi, %rax
+	jb	.L317
+.L314:
+	addq	%rcx, %r8
+.L308:
+	movq	%r8, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L334:
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	testq	%rsi, %rsi
+	jne	.L310
+	jmp	.L308
+.L319:
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	addq	%r9, %rdi
+	jmp	.L310
+	.cfi_endproc
+.LFE6809:
+	.size	_ZN1n14__avx512_countIcEEmPKT_mS1_, .-_ZN1n14__avx512_countIcEEmPKT_mS1_
+	.section	.text._ZN1n12__avx2_countIcEEmPKT_mS1_,"axG",@progbits,_ZN1n12__avx2_countIcEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n12__avx2_countIcEEmPKT_mS1_
+	.type	_ZN1n12__avx2_countIcEEmPKT_mS1_, @function
+_ZN1n12__avx2_countIcEEmPKT_mS1_:
+.LFB6810:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	vmovd	%edx, %xmm2
+	movq	%rdi, %r10
+	movl	%edx, %r11d
+	movq	%rsi, %rdi
+	vpbroadcastb	%xmm2, %ymm2
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	.cfi_offset 14, -24
+	.cfi_offset 13, -32
+	.cfi_offset 12, -40
+	.cfi_offset 3, -48
+	cmpq	$31, %rsi
+	jbe	.L336
+	xorl	%edx, %edx
+	xorl	%r9d, %r9d
+	movl	$32, %r8d
+	xorl	%ebx, %ebx
+	vpxor	%xmm3, %xmm3, %xmm3
+	.p2align 4,,10
+	.p2align 3
+.L342:
+	movq	%rdi, %r12
+	movl	$255, %ecx
+	subq	%rdx, %r12
+	movq	%r12, %rsi
+	shrq	$5, %rsi
+	cmpq	%rcx, %rsi
+	cmovbe	%rsi, %rcx
+	testq	%rsi, %rsi
+	je	.L349
+	addq	%r10, %rdx
+	vpxor	%xmm1, %xmm1, %xmm1
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L338:
+	vpcmpeqb	(%rdx), %ymm2, %ymm0
+	addq	$1, %rax
+	addq	$32, %rdx
+	vpsubb	%ymm0, %ymm1, %ymm0
+	vmovdqa	%ymm0, %ymm1
+	cmpq	%rcx, %rax
+	jb	.L338
+	subq	$1, %rcx
+	movq	%rdi, %r12
+	salq	$5, %rcx
+	testq	%rsi, %rsi
+	cmove	%rbx, %rcx
+	leaq	(%rcx,%r8), %rdx
+	subq	%rdx, %r12
+	leaq	32(%rdx), %r8
+.L337:
+	vpsadbw	%ymm3, %ymm0, %ymm0
+	vmovq	%xmm0, %rcx
+	vpextrq	$1, %xmm0, %r14
+	vextracti128	$0x1, %ymm0, %xmm0
+	addq	%r14, %rcx
+	vmovq	%xmm0, %r13
+	vpextrq	$1, %xmm0, %rax
+	addq	%r9, %rcx
+	addq	%r13, %rcx
+	leaq	(%rax,%rcx), %r9
+	cmpq	%r8, %rdi
+	jb	.L362
+	testq	%rsi, %rsi
+	jne	.L342
+.L343:
+	jmp	.L343
+	.p2align 4,,10
+	.p2align 3
+.L362:
+	testq	%r12, %r12
+	je	.L335
+	leaq	-1(%r12), %rax
+	cmpq	$30, %rax
+	jbe	.L351
+	movq	%r12, %rsi
+	leaq	(%r10,%rdx), %rcx
+	vpxor	%xmm3, %xmm3, %xmm3
+	movl	$1, %edi
+	andq	$-32, %rsi
+	vmovd	%edi, %xmm4
+	movq	%rcx, %rax
+	addq	%rcx, %rsi
+	vpbroadcastb	%xmm4, %ymm4
+	.p2align 4,,10
+	.p2align 3
+.L345:
+	vpcmpeqb	(%rax), %ymm2, %ymm0
+	addq	$32, %rax
+	vpand	%ymm4, %ymm0, %ymm0
+	vpmovzxbw	%xmm0, %ymm1
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxwd	%xmm1, %ymm7
+	vextracti128	$0x1, %ymm1, %xmm1
+	vpmovzxbw	%xmm0, %ymm0
+	vpmovzxwd	%xmm1, %ymm1
+	vpmovzxwd	%xmm0, %ymm6
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxdq	%xmm1, %ymm5
+	vextracti128	$0x1, %ymm1, %xmm1
+	vpmovzxwd	%xmm0, %ymm0
+	vpmovzxdq	%xmm1, %ymm1
+	vpaddq	%ymm1, %ymm5, %ymm1
+	vpmovzxdq	%xmm7, %ymm5
+	vextracti128	$0x1, %ymm7, %xmm7
+	vpmovzxdq	%xmm7, %ymm7
+	vpaddq	%ymm7, %ymm5, %ymm5
+	vpaddq	%ymm5, %ymm1, %ymm1
+	vpmovzxdq	%xmm6, %ymm5
+	vextracti128	$0x1, %ymm6, %xmm6
+	vpmovzxdq	%xmm6, %ymm6
+	vpaddq	%ymm6, %ymm5, %ymm5
+	vpmovzxdq	%xmm0, %ymm6
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpaddq	%ymm6, %ymm5, %ymm5
+	vpmovzxdq	%xmm0, %ymm0
+	vpaddq	%ymm5, %ymm1, %ymm1
+	vpaddq	%ymm3, %ymm0, %ymm0
+	vpaddq	%ymm0, %ymm1, %ymm3
+	cmpq	%rax, %rsi
+	jne	.L345
+	vmovdqa	%xmm3, %xmm0
+	vextracti128	$0x1, %ymm3, %xmm3
+	movq	%r12, %r8
+	vpaddq	%xmm3, %xmm0, %xmm3
+	andq	$-32, %r8
+	vpsrldq	$8, %xmm3, %xmm0
+	vpaddq	%xmm0, %xmm3, %xmm0
+	vmovq	%xmm0, %rax
+	testb	$31, %r12b
+	je	.L346
+.L344:
+	movq	%r12, %rsi
+	subq	%r8, %rsi
+	leaq	-1(%rsi), %rdi
+	cmpq	$14, %rdi
+	jbe	.L347
+	vmovd	%r11d, %xmm0
+	movl	$1, %eax
+	movq	%rsi, %rdi
+	vpbroadcastb	%xmm0, %xmm0
+	vmovd	%eax, %xmm1
+	andq	$-16, %rdi
+	vpcmpeqb	(%rcx,%r8), %xmm0, %xmm0
+	vpbroadcastb	%xmm1, %xmm1
+	addq	%rdi, %r8
+	andl	$15, %esi
+	vpand	%xmm1, %xmm0, %xmm0
+	vpmovzxbw	%xmm0, %xmm2
+	vpsrldq	$8, %xmm0, %xmm0
+	vpmovzxwd	%xmm2, %xmm5
+	vpsrldq	$8, %xmm2, %xmm2
+	vpmovzxbw	%xmm0, %xmm0
+	vpmovzxdq	%xmm5, %xmm1
+	vpsrldq	$8, %xmm5, %xmm5
+	vpmovzxwd	%xmm2, %xmm2
+	vpmovzxdq	%xmm5, %xmm5
+	vpmovzxwd	%xmm0, %xmm4
+	vpaddq	%xmm5, %xmm1, %xmm1
+	vpsrldq	$8, %xmm0, %xmm0
+	vpmovzxdq	%xmm2, %xmm5
+	vpsrldq	$8, %xmm2, %xmm2
+	vpmovzxwd	%xmm0, %xmm0
+	vpmovzxdq	%xmm2, %xmm2
+	vpaddq	%xmm2, %xmm5, %xmm2
+	vpaddq	%xmm2, %xmm1, %xmm1
+	vpmovzxdq	%xmm4, %xmm2
+	vpsrldq	$8, %xmm4, %xmm4
+	vpmovzxdq	%xmm4, %xmm4
+	vpaddq	%xmm4, %xmm2, %xmm2
+	vpaddq	%xmm3, %xmm2, %xmm2
+	vpaddq	%xmm2, %xmm1, %xmm1
+	vpmovzxdq	%xmm0, %xmm2
+	vpsrldq	$8, %xmm0, %xmm0
+	vpmovzxdq	%xmm0, %xmm0
+	vpaddq	%xmm0, %xmm2, %xmm0
+	vpaddq	%xmm0, %xmm1, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rax
+	je	.L346
+.L347:
+	xorl	%esi, %esi
+	cmpb	%r11b, (%rcx,%r8)
+	sete	%sil
+	addq	%rsi, %rax
+	leaq	1(%r8), %rsi
+	cmpq	%r12, %rsi
+	jnb	.L346
+	addq	%rsi, %r10
+	cmpb	%r11b, (%r10,%rdx)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+	leaq	2(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L346
+	xorl	%edx, %edx
+	cmpb	%r11b, 2(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	3(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L346
+	xorl	%edx, %edx
+	cmpb	%r11b, 3(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	4(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L346
+	xorl	%edx, %edx
+	cmpb	%r11b, 4(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	5(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L346
+	xorl	%edx, %edx
+	cmpb	%r11b, 5(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	6(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L346
+	xorl	%edx, %edx
+	cmpb	%r11b, 6(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	7(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L346
+	xorl	%edx, %edx
+	cmpb	%r11b, 7(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	8(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L346
+	xorl	%edx, %edx
+	cmpb	%r11b, 8(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	9(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L346
+	xorl	%edx, %edx
+	cmpb	%r11b, 9(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	10(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L346
+	xorl	%edx, %edx
+	cmpb	%r11b, 10(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	11(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L346
+	xorl	%edx, %edx
+	cmpb	%r11b, 11(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	12(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L346
+	xorl	%edx, %edx
+	cmpb	%r11b, 12(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	13(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L346
+	xorl	%edx, %edx
+	cmpb	%r11b, 13(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	14(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L346
+	xorl	%edx, %edx
+	cmpb	%r11b, 14(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	.p2align 4,,10
+	.p2align 3
+.L346:
+	addq	%rax, %r9
+.L335:
+	vzeroupper
+	movq	%r9, %rax
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L349:
+	.cfi_restore_state
+	vpxor	%xmm0, %xmm0, %xmm0
+	jmp	.L337
+.L336:
+	xorl	%r9d, %r9d
+	testq	%rsi, %rsi
+	je	.L335
+	movq	%rsi, %r12
+	xorl	%edx, %edx
+	xorl	%r9d, %r9d
+	xorl	%eax, %eax
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%r8d, %r8d
+	movq	%r10, %rcx
+	jmp	.L344
+.L351:
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%eax, %eax
+	leaq	(%r10,%rdx), %rcx
+	xorl	%r8d, %r8d
+	jmp	.L344
+	.cfi_endproc
+.LFE6810:
+	.size	_ZN1n12__avx2_countIcEEmPKT_mS1_, .-_ZN1n12__avx2_countIcEEmPKT_mS1_
+	.section	.text._ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE,"axG",@progbits,_ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE,comdat
+	.p2align 4
+	.weak	_ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE
+	.type	_ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE, @function
+_ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE:
+.LFB6768:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	movl	%ecx, %r13d
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movl	%edx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	movq	%rsi, %rbx
+	testb	%al, %al
+	je	.L428
+.L365:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %r13d
+	jge	.L429
+.L405:
+	cmpl	$2, %r13d
+	je	.L376
+.L431:
+	cmpl	$3, %r13d
+	je	.L377
+	cmpl	$1, %r13d
+	je	.L378
+	xorl	%esi, %esi
+	testq	%rbx, %rbx
+	je	.L363
+	leaq	-1(%rbx), %rax
+	cmpq	$14, %rax
+	jbe	.L403
+	movd	%r12d, %xmm7
+	movq	%rbx, %rdx
+	pxor	%xmm4, %xmm4
+	movq	%rbp, %rax
+	punpcklbw	%xmm7, %xmm7
+	pxor	%xmm6, %xmm6
+	pxor	%xmm5, %xmm5
+	andq	$-16, %rdx
+	punpcklwd	%xmm7, %xmm7
+	movdqa	.LC36(%rip), %xmm3
+	addq	%rbp, %rdx
+	pxor	%xmm8, %xmm8
+	pshufd	$0, %xmm7, %xmm7
+	.p2align 4,,10
+	.p2align 3
+.L393:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqb	%xmm7, %xmm0
+	pand	%xmm3, %xmm0
+	movdqa	%xmm0, %xmm2
+	punpckhbw	%xmm8, %xmm0
+	punpcklbw	%xmm8, %xmm2
+	movdqa	%xmm0, %xmm9
+	punpckhwd	%xmm6, %xmm0
+	movdqa	%xmm2, %xmm1
+	punpckhwd	%xmm6, %xmm2
+	punpcklwd	%xmm6, %xmm9
+	punpcklwd	%xmm6, %xmm1
+	movdqa	%xmm1, %xmm10
+	punpckldq	%xmm5, %xmm1
+	punpckhdq	%xmm5, %xmm10
+	paddq	%xmm10, %xmm1
+	movdqa	%xmm2, %xmm10
+	punpckldq	%xmm5, %xmm2
+	punpckhdq	%xmm5, %xmm10
+	paddq	%xmm10, %xmm2
+	paddq	%xmm2, %xmm1
+	movdqa	%xmm9, %xmm2
+	punpckldq	%xmm5, %xmm9
+	punpckhdq	%xmm5, %xmm2
+	paddq	%xmm2, %xmm9
+	movdqa	%xmm0, %xmm2
+	punpckhdq	%xmm5, %xmm0
+	punpckldq	%xmm5, %xmm2
+	paddq	%xmm4, %xmm0
+	paddq	%xmm2, %xmm9
+	paddq	%xmm9, %xmm1
+	movdqa	%xmm1, %xmm4
+	paddq	%xmm0, %xmm4
+	cmpq	%rax, %rdx
+	jne	.L393
+	movdqa	%xmm4, %xmm0
+	movq	%rbx, %rax
+	psrldq	$8, %xmm0
+	andq	$-16, %rax
+	paddq	%xmm0, %xmm4
+	movq	%xmm4, %rsi
+	testb	$15, %bl
+	je	.L363
+.L392:
+	xorl	%edx, %edx
+	cmpb	%r12b, 0(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	1(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L363
+	xorl	%edx, %edx
+	cmpb	%r12b, 1(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	2(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L363
+	xorl	%edx, %edx
+	cmpb	%r12b, 2(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	3(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L363
+	xorl	%edx, %edx
+	cmpb	%r12b, 3(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	4(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L363
+	xorl	%edx, %edx
+	cmpb	%r12b, 4(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	5(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L363
+	xorl	%edx, %edx
+	cmpb	%r12b, 5(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	6(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L363
+	xorl	%edx, %edx
+	cmpb	%r12b, 6(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	7(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L363
+	xorl	%edx, %edx
+	cmpb	%r12b, 7(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	8(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L363
+	xorl	%edx, %edx
+	cmpb	%r12b, 8(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	9(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L363
+	xorl	%edx, %edx
+	cmpb	%r12b, 9(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	10(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L363
+	xorl	%edx, %edx
+	cmpb	%r12b, 10(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	11(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L363
+	xorl	%edx, %edx
+	cmpb	%r12b, 11(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	12(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L363
+	xorl	%edx, %edx
+	cmpb	%r12b, 12(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	13(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L363
+	xorl	%edx, %edx
+	cmpb	%r12b, 13(%rbp,%rax)
+	sete	%dl
+	addq	%rdx, %rsi
+	leaq	14(%rax), %rdx
+	cmpq	%rbx, %rdx
+	jnb	.L363
+	cmpb	%r12b, 14(%rbp,%rax)
+	sete	%al
+	movzbl	%al, %eax
+	.p2align 4,,10
+	.p2align 3
+.L427:
+	addq	%rax, %rsi
+.L363:
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%rsi, %rax
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+.L404:
+	.p2align 4,,10
+	.p2align 3
+.L429:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L430
+.L372:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %r13d
+	cmpl	$2, %r13d
+	jne	.L431
+.L376:
+	movsbl	%r12b, %edx
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n12__avx2_countIcEEmPKT_mS1_
+	.p2align 4,,10
+	.p2align 3
+.L428:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r14
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L365
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L396
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L367:
+	movq	%r14, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L365
+	.p2align 4,,10
+	.p2align 3
+.L378:
+	movd	%r12d, %xmm4
+	xorl	%esi, %esi
+	punpcklbw	%xmm4, %xmm4
+	punpcklwd	%xmm4, %xmm4
+	pshufd	$0, %xmm4, %xmm4
+	cmpq	$15, %rbx
+	jbe	.L381
+	xorl	%edx, %edx
+	movl	$16, %r9d
+	pxor	%xmm3, %xmm3
+	xorl	%r8d, %r8d
+	.p2align 4,,10
+	.p2align 3
+.L384:
+	movq	%rbx, %rax
+	movl	$255, %ecx
+	subq	%rdx, %rax
+	movq	%rax, %rdi
+	shrq	$4, %rdi
+	cmpq	%rcx, %rdi
+	cmovbe	%rdi, %rcx
+	testq	%rdi, %rdi
+	je	.L382
+	addq	%rbp, %rdx
+	pxor	%xmm2, %xmm2
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L383:
+	movdqu	(%rdx), %xmm0
+	movdqa	%xmm2, %xmm1
+	addq	$1, %rax
+	addq	$16, %rdx
+	pcmpeqb	%xmm4, %xmm0
+	psubb	%xmm0, %xmm1
+	movdqa	%xmm1, %xmm2
+	cmpq	%rcx, %rax
+	jb	.L383
+	subq	$1, %rcx
+	psadbw	%xmm3, %xmm1
+	salq	$4, %rcx
+	movhlps	%xmm1, %xmm7
+	movq	%xmm1, %rax
+	testq	%rdi, %rdi
+	cmove	%r8, %rcx
+	leaq	(%rcx,%r9), %rdx
+	movq	%xmm7, %rcx
+	addq	%rcx, %rax
+	leaq	16(%rdx), %r9
+	addq	%rax, %rsi
+	cmpq	%r9, %rbx
+	jnb	.L384
+	subq	%rdx, %rbx
+.L386:
+	testq	%rbx, %rbx
+	je	.L363
+	leaq	-1(%rbx), %rax
+	cmpq	$14, %rax
+	jbe	.L402
+	movq	%rbx, %rcx
+	pxor	%xmm6, %xmm6
+	pxor	%xmm8, %xmm8
+	addq	%rbp, %rdx
+	andq	$-16, %rcx
+	pxor	%xmm7, %xmm7
+	pxor	%xmm5, %xmm5
+	movq	%rdx, %rax
+	movdqa	.LC36(%rip), %xmm3
+	addq	%rdx, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L390:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqb	%xmm4, %xmm0
+	pand	%xmm3, %xmm0
+	movdqa	%xmm0, %xmm2
+	punpckhbw	%xmm8, %xmm0
+	punpcklbw	%xmm8, %xmm2
+	movdqa	%xmm0, %xmm9
+	punpckhwd	%xmm7, %xmm0
+	movdqa	%xmm2, %xmm1
+	punpckhwd	%xmm7, %xmm2
+	punpcklwd	%xmm7, %xmm9
+	punpcklwd	%xmm7, %xmm1
+	movdqa	%xmm1, %xmm10
+	punpckhdq	%xmm5, %xmm1
+	punpckldq	%xmm5, %xmm10
+	paddq	%xmm10, %xmm1
+	movdqa	%xmm2, %xmm10
+	punpckhdq	%xmm5, %xmm2
+	punpckldq	%xmm5, %xmm10
+	paddq	%xmm10, %xmm2
+	paddq	%xmm2, %xmm1
+	movdqa	%xmm9, %xmm2
+	punpckhdq	%xmm5, %xmm9
+	punpckldq	%xmm5, %xmm2
+	paddq	%xmm2, %xmm9
+	movdqa	%xmm0, %xmm2
+	punpckhdq	%xmm5, %xmm0
+	punpckldq	%xmm5, %xmm2
+	paddq	%xmm6, %xmm0
+	paddq	%xmm2, %xmm9
+	paddq	%xmm9, %xmm1
+	movdqa	%xmm1, %xmm6
+	paddq	%xmm0, %xmm6
+	cmpq	%rax, %rcx
+	jne	.L390
+	movdqa	%xmm6, %xmm0
+	movq	%rbx, %rcx
+	psrldq	$8, %xmm0
+	andq	$-16, %rcx
+	paddq	%xmm0, %xmm6
+	movq	%xmm6, %rax
+	testb	$15, %bl
+	je	.L427
+.L388:
+	xorl	%edi, %edi
+	cmpb	%r12b, (%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	1(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L427
+	xorl	%edi, %edi
+	cmpb	%r12b, 1(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	2(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L427
+	xorl	%edi, %edi
+	cmpb	%r12b, 2(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	3(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L427
+	xorl	%edi, %edi
+	cmpb	%r12b, 3(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	4(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L427
+	xorl	%edi, %edi
+	cmpb	%r12b, 4(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	5(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L427
+	xorl	%edi, %edi
+	cmpb	%r12b, 5(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	6(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L427
+	xorl	%edi, %edi
+	cmpb	%r12b, 6(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	7(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L427
+	xorl	%edi, %edi
+	cmpb	%r12b, 7(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	8(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L427
+	xorl	%edi, %edi
+	cmpb	%r12b, 8(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	9(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L427
+	xorl	%edi, %edi
+	cmpb	%r12b, 9(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	10(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L427
+	xorl	%edi, %edi
+	cmpb	%r12b, 10(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	11(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L427
+	xorl	%edi, %edi
+	cmpb	%r12b, 11(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	12(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L427
+	xorl	%edi, %edi
+	cmpb	%r12b, 12(%rdx,%rcx)
+	sete	%dil
+	addq	%rdi, %rax
+	leaq	13(%rcx), %rdi
+	cmpq	%rbx, %rdi
+	jnb	.L427
+	xorl	%edi, %edi
+	cmpb	%r12b, 13(%rdx,%rcx)
+	sete	%dil
+	addq	$14, %rcx
+	addq	%rdi, %rax
+	cmpq	%rbx, %rcx
+	jnb	.L427
+	cmpb	%r12b, (%rdx,%rcx)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+	jmp	.L427
+	.p2align 4,,10
+	.p2align 3
+.L377:
+	movsbl	%r12b, %edx
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n14__avx512_countIcEEmPKT_mS1_
+.L430:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r14
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L372
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L398
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L374:
+	movq	%r14, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L372
+.L398:
+	movl	$3, %eax
+	jmp	.L374
+.L381:
+	xorl	%eax, %eax
+	xorl	%ecx, %ecx
+	movq	%rbp, %rdx
+	testq	%rbx, %rbx
+	jne	.L388
+	jmp	.L363
+.L403:
+	xorl	%esi, %esi
+	xorl	%eax, %eax
+	jmp	.L392
+.L396:
+	movl	$3, %eax
+	jmp	.L367
+.L402:
+	xorl	%eax, %eax
+	xorl	%ecx, %ecx
+	addq	%rbp, %rdx
+	jmp	.L388
+.L382:
+	pxor	%xmm0, %xmm0
+	psadbw	%xmm0, %xmm0
+	movhlps	%xmm0, %xmm3
+	movq	%xmm0, %rdi
+	movq	%xmm3, %rcx
+	addq	%rdi, %rcx
+	addq	%rcx, %rsi
+	cmpq	%r9, %rbx
+	jb	.L400
+.L387:
+	jmp	.L387
+.L400:
+	movq	%rax, %rbx
+	jmp	.L386
+	.cfi_endproc
+.LFE6768:
+	.size	_ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE, .-_ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE
+	.section	.rodata.str1.1
+.LC37:
+	.string	"b"
+	.section	.rodata.str1.8
+	.align 8
+.LC38:
+	.string	"expected equal : expected value : n::count(v.iter(), 'a'), actual value : 100000"
+	.align 8
+.LC39:
+	.string	"expected equal : expected value : n::simd_count<char>(v.data(), v.len(), 'b'), actual value : 1"
+	.section	.text.unlikely
+.LCOLDB40:
+	.text
+.LHOTB40:
+	.p2align 4
+	.globl	_Z26test_simd_count_long_bytesv
+	.type	_Z26test_simd_count_long_bytesv, @function
+_Z26test_simd_count_long_bytesv:
+.LFB6727:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6727
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pxor	%xmm0, %xmm0
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	movq	$0, 32(%rsp)
+	movups	%xmm0, 40(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rdi
+	testq	%rdi, %rdi
+	je	.L433
+	movq	40(%rsp), %rbx
+	movq	%rdi, 56(%rsp)
+	movb	$97, 28(%rsp)
+	cmpq	$99999, %rbx
+	jbe	.L494
+	movb	$97, 0
+.L435:
+	movl	$1, %eax
+	.p2align 4,,10
+	.p2align 3
+.L461:
+	movq	32(%rsp), %rdx
+	movb	$97, (%rdx,%rax)
+	addq	$1, %rax
+	cmpq	$100000, %rax
+	jne	.L461
+.L462:
+	movq	32(%rsp), %r12
+.L439:
+	movq	$100000, 48(%rsp)
+	movl	$100000, %ebp
+.L457:
+	leaq	.LC37(%rip), %rax
+	cmpq	%r12, %rax
+	jnb	.L554
+.L463:
+	movl	$50000, %ebx
+	movq	40(%rsp), %r13
+	leaq	1(%rbp), %rdx
+	cmpq	%rbx, %rbp
+	cmovbe	%rbp, %rbx
+	cmpq	%rdx, %r13
+	jnb	.L465
+	leaq	10(%r13,%r13), %rsi
+	movq	56(%rsp), %rdi
+	cmpq	%rdx, %rsi
+	cmovb	%rdx, %rsi
+	movq	(%rdi), %rax
+	movl	$1, %edx
+	movq	%rsi, 40(%rsp)
+.LEHB8:
+	call	*16(%rax)
+.LEHE8:
+	movq	%rax, 32(%rsp)
+	leaq	1(%rbx), %r14
+	testq	%rbp, %rbp
+	jne	.L555
+	movq	48(%rsp), %rdx
+	testq	%rdx, %rdx
+	jne	.L556
+	testq	%r12, %r12
+	jne	.L467
+	movl	$1, %edx
+	movq	%rax, %rsi
+	.p2align 4,,10
+	.p2align 3
+.L469:
+	movq	%rdx, 48(%rsp)
+	movb	$98, (%rsi)
+.L470:
+	movq	48(%rsp), %rbp
+	movq	32(%rsp), %rbx
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L557
+.L477:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %ecx
+	movl	$97, %edx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	_ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE
+	cmpq	$100000, %rax
+	jne	.L482
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L558
+.L486:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %ecx
+	movq	48(%rsp), %rsi
+	movl	$98, %edx
+	movq	32(%rsp), %rdi
+	call	_ZN1n10simd_countIcEEmPKT_mS1_NS_8simd_isaE
+	cmpq	$1, %rax
+	jne	.L489
+	movq	32(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L432
+	movq	56(%rsp), %rdi
+	movq	40(%rsp), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L432:
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L494:
+	.cfi_restore_state
+	xorl	%r12d, %r12d
+.L434:
+	movq	(%rdi), %rax
+	movl	$1, %edx
+	movl	$100000, %esi
+.LEHB9:
+	call	*16(%rax)
+	movq	48(%rsp), %rdx
+	movq	%rax, 32(%rsp)
+	movq	$100000, 40(%rsp)
+	testq	%rdx, %rdx
+	jne	.L559
+	testq	%r12, %r12
+	jne	.L459
+	movb	$97, (%rax)
+	jmp	.L435
+	.p2align 4,,10
+	.p2align 3
+.L554:
+	leaq	(%r12,%rbp), %rdx
+	cmpq	%rdx, %rax
+	jnb	.L463
+	movq	56(%rsp), %r13
+	movl	$1, %edx
+	movl	$1, %esi
+	movq	0(%r13), %rax
+	movq	%r13, %rdi
+	call	*16(%rax)
+.LEHE9:
+	movb	$98, (%rax)
+	movq	48(%rsp), %rbp
+	movl	$50000, %ebx
+	movq	%rax, %r12
+	movq	40(%rsp), %r14
+	cmpq	%rbx, %rbp
+	leaq	1(%rbp), %rdx
+	cmovbe	%rbp, %rbx
+	cmpq	%rdx, %r14
+	jnb	.L471
+	leaq	10(%r14,%r14), %rsi
+	movq	56(%rsp), %rdi
+	movq	32(%rsp), %r15
+	cmpq	%rdx, %rsi
+	cmovb	%rdx, %rsi
+	movq	(%rdi), %rax
+	movl	$1, %edx
+	movq	%rsi, 40(%rsp)
+.LEHB10:
+	call	*16(%rax)
+.LEHE10:
+	movq	%rax, 32(%rsp)
+	leaq	1(%rbx), %rcx
+	testq	%rbp, %rbp
+	jne	.L560
+	movq	48(%rsp), %rdx
+	testq	%rdx, %rdx
+	jne	.L561
+	testq	%r15, %r15
+	jne	.L473
+	movl	$1, %edx
+	movq	%rax, %rsi
+	.p2align 4,,10
+	.p2align 3
+.L475:
+	movq	%rdx, 48(%rsp)
+	movzbl	(%r12), %eax
+	movl	$1, %ecx
+	movq	%r13, %rdi
+	movl	$1, %edx
+	movb	%al, (%rsi)
+	movq	0(%r13), %rax
+	movq	%r12, %rsi
+	call	*24(%rax)
+	jmp	.L470
+	.p2align 4,,10
+	.p2align 3
+.L465:
+	leaq	(%r12,%rbx), %rsi
+	subq	%rbx, %rbp
+	je	.L469
+	leaq	1(%r12,%rbx), %rdi
+	movq	%rbp, %rdx
+	call	memmove@PLT
+.L552:
+	movq	48(%rsp), %rax
+	addq	32(%rsp), %rbx
+	movq	%rbx, %rsi
+	leaq	1(%rax), %rdx
+	jmp	.L469
+	.p2align 4,,10
+	.p2align 3
+.L557:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L477
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L495
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L481:
+	movq	%r12, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L477
+	.p2align 4,,10
+	.p2align 3
+.L558:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L486
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L497
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L488:
+	movq	%r12, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L486
+	.p2align 4,,10
+	.p2align 3
+.L556:
+	leaq	(%rax,%r14), %rdi
+	movq	%r12, %rsi
+	call	memcpy@PLT
+.L467:
+	movq	56(%rsp), %rdi
+	movl	$1, %ecx
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+	movq	(%rdi), %rax
+.LEHB11:
+	call	*24(%rax)
+	jmp	.L552
+	.p2align 4,,10
+	.p2align 3
+.L433:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L562
+.L437:
+	movq	48(%rsp), %rdx
+	movq	32(%rsp), %r12
+	movb	$97, 28(%rsp)
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%rdi, 56(%rsp)
+	cmpq	$100000, %rdx
+	ja	.L439
+	movq	40(%rsp), %rbx
+	cmpq	$99999, %rbx
+	ja	.L440
+	leaq	28(%rsp), %rax
+	cmpq	%r12, %rax
+	jb	.L434
+	addq	%r12, %rdx
+	cmpq	%rdx, %rax
+	jnb	.L434
+	leaq	29(%rsp), %rax
+	movb	$97, 29(%rsp)
+	cmpq	%r12, %rax
+	jb	.L441
+	cmpq	%rdx, %rax
+	jb	.L563
+.L441:
+	movq	(%rdi), %rax
+	movl	$1, %edx
+	movl	$100000, %esi
+	call	*16(%rax)
+	movq	48(%rsp), %rdx
+	movq	%rax, 32(%rsp)
+	movq	$100000, 40(%rsp)
+	testq	%rdx, %rdx
+	jne	.L564
+	testq	%r12, %r12
+	jne	.L452
+	movb	$97, (%rax)
+	movl	$1, %eax
+	.p2align 4,,10
+	.p2align 3
+.L455:
+	movq	32(%rsp), %rdx
+	movb	$97, (%rdx,%rax)
+	addq	$1, %rax
+	cmpq	$100000, %rax
+	jne	.L455
+	jmp	.L462
+	.p2align 4,,10
+	.p2align 3
+.L471:
+	movq	32(%rsp), %rax
+	leaq	(%rax,%rbx), %rsi
+	subq	%rbx, %rbp
+	je	.L475
+	leaq	1(%rax,%rbx), %rdi
+	movq	%rbp, %rdx
+	call	memmove@PLT
+	jmp	.L553
+	.p2align 4,,10
+	.p2align 3
+.L555:
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	48(%rsp), %rdx
+	subq	%rbx, %rdx
+	je	.L467
+	movq	32(%rsp), %rdi
+	leaq	(%r12,%rbx), %rsi
+	addq	%r14, %rdi
+	call	memcpy@PLT
+	jmp	.L467
+	.p2align 4,,10
+	.p2align 3
+.L559:
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+.L459:
+	movq	56(%rsp), %rdi
+	movl	$1, %ecx
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE11:
+	movq	48(%rsp), %rdx
+	movq	32(%rsp), %r12
+.L440:
+	cmpq	$99999, %rdx
+	ja	.L439
+	movb	$97, (%r12,%rdx)
+	leaq	1(%rdx), %rax
+	jne	.L461
+	jmp	.L462
+	.p2align 4,,10
+	.p2align 3
+.L561:
+	leaq	(%rax,%rcx), %rdi
+	movq	%r15, %rsi
+	call	memcpy@PLT
+.L473:
+	movq	56(%rsp), %rdi
+	movl	$1, %ecx
+	movq	%r14, %rdx
+	movq	%r15, %rsi
+	movq	(%rdi), %rax
+.LEHB12:
+	call	*24(%rax)
+.LEHE12:
+.L553:
+	movq	48(%rsp), %rax
+	addq	32(%rsp), %rbx
+	movq	%rbx, %rsi
+	leaq	1(%rax), %rdx
+	jmp	.L475
+	.p2align 4,,10
+	.p2align 3
+.L562:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L437
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L437
+	.p2align 4,,10
+	.p2align 3
+.L560:
+	movq	%rbx, %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rcx, 8(%rsp)
+	call	memcpy@PLT
+	movq	48(%rsp), %rdx
+	movq	8(%rsp), %rcx
+	subq	%rbx, %rdx
+	je	.L473
+	addq	32(%rsp), %rcx
+	leaq	(%r15,%rbx), %rsi
+	movq	%rcx, %rdi
+	call	memcpy@PLT
+	jmp	.L473
+.L495:
+	movl	$3, %eax
+	jmp	.L481
+.L497:
+	movl	$3, %eax
+	jmp	.L488
+.L564:
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+.L452:
+	movq	56(%rsp), %rdi
+	movl	$1, %ecx
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	movq	(%rdi), %rax
+.LEHB13:
+	call	*24(%rax)
+	movq	48(%rsp), %rdx
+	movq	32(%rsp), %r12
+	cmpq	$99999, %rdx
+	ja	.L439
+	movb	$97, (%r12,%rdx)
+	leaq	1(%rdx), %rax
+	jne	.L455
+	jmp	.L462
+.L563:
+	leaq	30(%rsp), %rax
+	movb	$97, 30(%rsp)
+	cmpq	%rdx, %rax
+	jnb	.L442
+	cmpq	%r12, %rax
+	jnb	.L565
+.L442:
+	movq	(%rdi), %rax
+	movl	$1, %edx
+	movl	$100000, %esi
+	call	*16(%rax)
+	movq	48(%rsp), %rdx
+	movq	%rax, 32(%rsp)
+	movq	%rax, %rdi
+	movq	$100000, 40(%rsp)
+	testq	%rdx, %rdx
+	jne	.L566
+	xorl	%eax, %eax
+	testq	%r12, %r12
+	jne	.L445
+.L448:
+	movq	32(%rsp), %rdx
+	movb	$97, (%rdx,%rax)
+	addq	$1, %rax
+	cmpq	$100000, %rax
+	jne	.L448
+.L449:
+	movq	$100000, 48(%rsp)
+	movl	$100000, %ebp
+.L443:
+	movq	32(%rsp), %r12
+	jmp	.L457
+.L566:
+	movq	%r12, %rsi
+	call	memcpy@PLT
+.L445:
+	movq	56(%rsp), %rdi
+	movl	$1, %ecx
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	48(%rsp), %rax
+	cmpq	$99999, %rax
+	jbe	.L448
+	jmp	.L449
+.L565:
+	leaq	31(%rsp), %rdx
+	leaq	32(%rsp), %rdi
+	movl	$100000, %esi
+	movb	$97, 31(%rsp)
+	call	_ZN1n6vectorIcE6resizeEmRKc
+.LEHE13:
+	movq	48(%rsp), %rbp
+	jmp	.L443
+.L500:
+	movq	%rax, %rbx
+	jmp	.L478
+.L546:
+	jmp	.L547
+.L502:
+	.section	.gcc_except_table
+.LLSDA6727:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6727-.LLSDACSB6727
+.LLSDACSB6727:
+	.uleb128 .LEHB8-.LFB6727
+	.uleb128 .LEHE8-.LEHB8
+	.uleb128 .L546-.LFB6727
+	.uleb128 0
+	.uleb128 .LEHB9-.LFB6727
+	.uleb128 .LEHE9-.LEHB9
+	.uleb128 .L546-.LFB6727
+	.uleb128 0
+	.uleb128 .LEHB10-.LFB6727
+	.uleb128 .LEHE10-.LEHB10
+	.uleb128 .L500-.LFB6727
+	.uleb128 0
+	.uleb128 .LEHB11-.LFB6727
+	.uleb128 .LEHE11-.LEHB11
+	.uleb128 .L546-.LFB6727
+	.uleb128 0
+	.uleb128 .LEHB12-.LFB6727
+	.uleb128 .LEHE12-.LEHB12
+	.uleb128 .L500-.LFB6727
+	.uleb128 0
+	.uleb128 .LEHB13-.LFB6727
+	.uleb128 .LEHE13-.LEHB13
+	.uleb128 .L546-.LFB6727
+	.uleb128 0
+.LLSDACSE6727:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6727
+	.type	_Z26test_simd_count_long_bytesv.cold, @function
+_Z26test_simd_count_long_bytesv.cold:
+.LFSB6727:
+.L489:
+	.cfi_def_cfa_offset 128
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC39(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB14:
+	call	__cxa_throw@PLT
+.LEHE14:
+.L478:
+	movq	0(%r13), %rax
+	movl	$1, %ecx
+	movq	%r12, %rsi
+	movq	%r13, %rdi
+	movl	$1, %edx
+	call	*24(%rax)
+.L479:
+	movq	32(%rsp), %rsi
+	movq	40(%rsp), %rdx
+	testq	%rsi, %rsi
+	je	.L493
+	movq	56(%rsp), %rdi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L493:
+	movq	%rbx, %rdi
+.LEHB15:
+	call	_Unwind_Resume@PLT
+.LEHE15:
+.L499:
+.L547:
+	movq	%rax, %rbx
+	jmp	.L479
+.L501:
+.L482:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC38(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB16:
+	call	__cxa_throw@PLT
+.LEHE16:
+	.cfi_endproc
+.LFE6727:
+	.section	.gcc_except_table
+.LLSDAC6727:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6727-.LLSDACSBC6727
+.LLSDACSBC6727:
+	.uleb128 .LEHB14-.LCOLDB40
+	.uleb128 .LEHE14-.LEHB14
+	.uleb128 .L499-.LCOLDB40
+	.uleb128 0
+	.uleb128 .LEHB15-.LCOLDB40
+	.uleb128 .LEHE15-.LEHB15
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB16-.LCOLDB40
+	.uleb128 .LEHE16-.LEHB16
+	.uleb128 .L499-.LCOLDB40
+	.uleb128 0
+.LLSDACSEC6727:
+	.section	.text.unlikely
+	.text
+	.size	_Z26test_simd_count_long_bytesv, .-_Z26test_simd_count_long_bytesv
+	.section	.text.unlikely
+	.size	_Z26test_simd_count_long_bytesv.cold, .-_Z26test_simd_count_long_bytesv.cold
+.LCOLDE40:
+	.text
+.LHOTE40:
+	.section	.text._ZN1n13__avx512_findIcEEmPKT_mS1_,"axG",@progbits,_ZN1n13__avx512_findIcEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n13__avx512_findIcEEmPKT_mS1_
+	.type	_ZN1n13__avx512_findIcEEmPKT_mS1_, @function
+_ZN1n13__avx512_findIcEEmPKT_mS1_:
+.LFB6866:
+	.cfi_startproc
+	movl	%edx, %ecx
+	vpbroadcastb	%edx, %zmm0
+	xorl	%edx, %edx
+	jmp	.L568
+	.p2align 4,,10
+	.p2align 3
+.L570:
+	vpcmpeqb	-64(%rdi,%rdx), %zmm0, %k0
+	kortestq	%k0, %k0
+	jne	.L577
+.L568:
+	movq	%rdx, %rax
+	leaq	64(%rdx), %rdx
+	cmpq	%rdx, %rsi
+	jnb	.L570
+	subq	%rax, %rsi
+	je	.L573
+	xorl	%edx, %edx
+	addq	%rax, %rdi
+	jmp	.L572
+	.p2align 4,,10
+	.p2align 3
+.L578:
+	addq	$1, %rdx
+	cmpq	%rdx, %rsi
+	je	.L573
+.L572:
+	cmpb	(%rdi,%rdx), %cl
+	jne	.L578
+	addq	%rdx, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L573:
+	movq	$-1, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L577:
+	xorl	%edx, %edx
+	kmovq	%k0, %rcx
+	rep bsfq	%rcx, %rdx
+	movslq	%edx, %rdx
+	addq	%rdx, %rax
+	vzeroupper
+	ret
+	.cfi_endproc
+.LFE6866:
+	.size	_ZN1n13__avx512_findIcEEmPKT_mS1_, .-_ZN1n13__avx512_findIcEEmPKT_mS1_
+	.section	.text._ZN1n11__avx2_findIcEEmPKT_mS1_,"axG",@progbits,_ZN1n11__avx2_findIcEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n11__avx2_findIcEEmPKT_mS1_
+	.type	_ZN1n11__avx2_findIcEEmPKT_mS1_, @function
+_ZN1n11__avx2_findIcEEmPKT_mS1_:
+.LFB6867:
+	.cfi_startproc
+	vmovd	%edx, %xmm1
+	movl	%edx, %r8d
+	xorl	%eax, %eax
+	vpbroadcastb	%xmm1, %ymm1
+	jmp	.L580
+	.p2align 4,,10
+	.p2align 3
+.L582:
+	vpcmpeqb	-128(%rdi,%rax), %ymm1, %ymm2
+	vpcmpeqb	-96(%rdi,%rax), %ymm1, %ymm0
+	vpcmpeqb	-64(%rdi,%rax), %ymm1, %ymm3
+	vpor	%ymm2, %ymm0, %ymm0
+	vpcmpeqb	-32(%rdi,%rax), %ymm1, %ymm2
+	vpor	%ymm3, %ymm2, %ymm2
+	vpor	%ymm2, %ymm0, %ymm0
+	vptest	%ymm0, %ymm0
+	jne	.L583
+.L580:
+	movq	%rax, %rdx
+	subq	$-128, %rax
+	cmpq	%rax, %rsi
+	jnb	.L582
+	movq	%rdx, %rax
+	leaq	32(%rdx), %rdx
+	cmpq	%rdx, %rsi
+	jb	.L595
+	.p2align 4,,10
+	.p2align 3
+.L585:
+	vpcmpeqb	-32(%rdi,%rdx), %ymm1, %ymm0
+	vpmovmskb	%ymm0, %ecx
+	testl	%ecx, %ecx
+	jne	.L596
+.L583:
+	movq	%rdx, %rax
+	leaq	32(%rdx), %rdx
+	cmpq	%rdx, %rsi
+	jnb	.L585
+.L595:
+	subq	%rax, %rsi
+	je	.L588
+	xorl	%edx, %edx
+	leaq	(%rdi,%rax), %rcx
+	jmp	.L587
+	.p2align 4,,10
+	.p2align 3
+.L597:
+	addq	$1, %rdx
+	cmpq	%rdx, %rsi
+	je	.L588
+.L587:
+	cmpb	(%rcx,%rdx), %r8b
+	jne	.L597
+	addq	%rdx, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L588:
+	movq	$-1, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L596:
+	rep bsfl	%ecx, %ecx
+	movslq	%ecx, %rcx
+	addq	%rcx, %rax
+	vzeroupper
+	ret
+	.cfi_endproc
+.LFE6867:
+	.size	_ZN1n11__avx2_findIcEEmPKT_mS1_, .-_ZN1n11__avx2_findIcEEmPKT_mS1_
+	.section	.text._ZN1n9simd_findIcEEmPKT_mS1_NS_8simd_isaE.constprop.0,"axG",@progbits,_Z16check_find_countIcEvN1n8simd_isaE,comdat
+	.p2align 4
+	.type	_ZN1n9simd_findIcEEmPKT_mS1_NS_8simd_isaE.constprop.0, @function
+_ZN1n9simd_findIcEEmPKT_mS1_NS_8simd_isaE.constprop.0:
+.LFB6982:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movl	%edx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L644
+.L600:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	jge	.L645
+.L630:
+	cmpl	$2, %r12d
+	je	.L611
+.L650:
+	cmpl	$3, %r12d
+	je	.L612
+	xorl	%eax, %eax
+	cmpl	$1, %r12d
+	je	.L626
+	testq	%rbp, %rbp
+	jne	.L614
+.L628:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	$-1, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L646:
+	.cfi_restore_state
+	addq	$1, %rax
+	cmpq	%rax, %rbp
+	je	.L628
+.L614:
+	cmpb	$9, (%rbx,%rax)
+	jne	.L646
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L626:
+	.cfi_restore_state
+	movdqa	.LC41(%rip), %xmm2
+	jmp	.L613
+	.p2align 4,,10
+	.p2align 3
+.L617:
+	movdqu	-64(%rbx,%rax), %xmm0
+	movdqu	-48(%rbx,%rax), %xmm1
+	movdqu	-16(%rbx,%rax), %xmm3
+	pcmpeqb	%xmm2, %xmm1
+	pcmpeqb	%xmm2, %xmm0
+	pcmpeqb	%xmm2, %xmm3
+	por	%xmm1, %xmm0
+	movdqu	-32(%rbx,%rax), %xmm1
+	pcmpeqb	%xmm2, %xmm1
+	por	%xmm3, %xmm1
+	por	%xmm1, %xmm0
+	pmovmskb	%xmm0, %ecx
+	testl	%ecx, %ecx
+	jne	.L616
+.L613:
+	movq	%rax, %rdx
+	addq	$64, %rax
+	cmpq	%rax, %rbp
+	jnb	.L617
+.L616:
+	movdqa	.LC41(%rip), %xmm1
+	jmp	.L618
+	.p2align 4,,10
+	.p2align 3
+.L619:
+	movdqu	-16(%rbx,%rdx), %xmm0
+	pcmpeqb	%xmm1, %xmm0
+	pmovmskb	%xmm0, %ecx
+	testl	%ecx, %ecx
+	jne	.L647
+.L618:
+	movq	%rdx, %rax
+	leaq	16(%rdx), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L619
+	subq	%rax, %rbp
+	je	.L628
+	xorl	%edx, %edx
+	leaq	(%rbx,%rax), %rcx
+	jmp	.L621
+	.p2align 4,,10
+	.p2align 3
+.L648:
+	addq	$1, %rdx
+	cmpq	%rdx, %rbp
+	je	.L628
+.L621:
+	cmpb	$9, (%rcx,%rdx)
+	jne	.L648
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	addq	%rdx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.L629:
+	.p2align 4,,10
+	.p2align 3
+.L645:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L649
+.L607:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	cmpl	$2, %r12d
+	jne	.L650
+.L611:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movl	$9, %edx
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n11__avx2_findIcEEmPKT_mS1_
+	.p2align 4,,10
+	.p2align 3
+.L644:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L600
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L622
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L602:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L600
+	.p2align 4,,10
+	.p2align 3
+.L612:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movl	$9, %edx
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n13__avx512_findIcEEmPKT_mS1_
+	.p2align 4,,10
+	.p2align 3
+.L647:
+	.cfi_restore_state
+	rep bsfl	%ecx, %ecx
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movslq	%ecx, %rcx
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	addq	%rcx, %rax
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L649:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L607
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L624
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L609:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L607
+.L624:
+	movl	$3, %eax
+	jmp	.L609
+.L622:
+	movl	$3, %eax
+	jmp	.L602
+	.cfi_endproc
+.LFE6982:
+	.size	_ZN1n9simd_findIcEEmPKT_mS1_NS_8simd_isaE.constprop.0, .-_ZN1n9simd_findIcEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	.section	.rodata._Z16check_find_countIcEvN1n8simd_isaE.str1.8,"aMS",@progbits,1
+	.align 8
+.LC54:
+	.string	"expected equal : expected value : n::simd_find<T>(p, len, T(9), isa), actual value : n::size_t(-1)"
+	.align 8
+.LC55:
+	.string	"expected equal : expected value : n::simd_count<T>(p, len, T(3), isa), actual value : n::__scalar_count<T>(p, len, T(3))"
+	.align 8
+.LC56:
+	.string	"expected equal : expected value : n::simd_find<T>(p, len, T(9), isa), actual value : len - 1"
+	.align 8
+.LC57:
+	.string	"expected equal : expected value : n::simd_find<T>(p, len, T(9), isa), actual value : len / 2"
+	.section	.text._Z16check_find_countIcEvN1n8simd_isaE,"axG",@progbits,_Z16check_find_countIcEvN1n8simd_isaE,comdat
+	.p2align 4
+	.weak	_Z16check_find_countIcEvN1n8simd_isaE
+	.type	_Z16check_find_countIcEvN1n8simd_isaE, @function
+_Z16check_find_countIcEvN1n8simd_isaE:
+.LFB6784:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	movl	$36, %ecx
+	pxor	%xmm0, %xmm0
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	xorl	%r12d, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movl	%edi, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$344, %rsp
+	.cfi_def_cfa_offset 400
+	movdqa	.LC53(%rip), %xmm11
+	leaq	32(%rsp), %rdi
+	movaps	%xmm0, 16(%rsp)
+	rep stosq
+	leaq	16(%rsp), %rax
+	movq	%rax, 8(%rsp)
+	movl	$0, (%rdi)
+.L707:
+	movq	8(%rsp), %rax
+	movq	$-1, %rbx
+	xorl	%r13d, %r13d
+	leaq	(%rax,%r12), %r14
+	.p2align 4,,10
+	.p2align 3
+.L652:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L758
+.L657:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	movl	%ebp, %eax
+	jge	.L759
+.L719:
+.L661:
+	cmpl	$2, %eax
+	je	.L668
+.L767:
+	cmpl	$3, %eax
+	je	.L669
+	cmpl	$1, %eax
+	je	.L760
+	testq	%r13, %r13
+	je	.L761
+	cmpq	$14, %rbx
+	jbe	.L762
+	movq	%r13, %rdx
+	pxor	%xmm2, %xmm2
+	pxor	%xmm6, %xmm6
+	movq	%r14, %rax
+	andq	$-16, %rdx
+	movdqa	.LC36(%rip), %xmm5
+	pxor	%xmm4, %xmm4
+	pxor	%xmm3, %xmm3
+	movdqa	.LC53(%rip), %xmm8
+	addq	%r14, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L688:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqb	%xmm8, %xmm0
+	pand	%xmm5, %xmm0
+	movdqa	%xmm0, %xmm1
+	punpckhbw	%xmm6, %xmm0
+	punpcklbw	%xmm6, %xmm1
+	movdqa	%xmm0, %xmm7
+	punpckhwd	%xmm4, %xmm0
+	movdqa	%xmm1, %xmm9
+	punpckhwd	%xmm4, %xmm1
+	punpcklwd	%xmm4, %xmm7
+	movdqa	%xmm1, %xmm10
+	punpcklwd	%xmm4, %xmm9
+	punpckhdq	%xmm3, %xmm1
+	punpckldq	%xmm3, %xmm10
+	paddq	%xmm10, %xmm1
+	movdqa	%xmm9, %xmm10
+	punpckhdq	%xmm3, %xmm9
+	punpckldq	%xmm3, %xmm10
+	paddq	%xmm10, %xmm9
+	paddq	%xmm9, %xmm1
+	movdqa	%xmm7, %xmm9
+	punpckhdq	%xmm3, %xmm7
+	punpckldq	%xmm3, %xmm9
+	paddq	%xmm9, %xmm7
+	movdqa	%xmm0, %xmm9
+	punpckhdq	%xmm3, %xmm0
+	punpckldq	%xmm3, %xmm9
+	paddq	%xmm2, %xmm0
+	paddq	%xmm9, %xmm7
+	paddq	%xmm7, %xmm1
+	paddq	%xmm0, %xmm1
+	movdqa	%xmm1, %xmm2
+	cmpq	%rax, %rdx
+	jne	.L688
+	movdqa	%xmm1, %xmm0
+	movq	%r13, %rax
+	psrldq	$8, %xmm0
+	andq	$-16, %rax
+	paddq	%xmm0, %xmm2
+	movq	%xmm2, %rdi
+	testb	$15, %r13b
+	je	.L689
+	xorl	%edx, %edx
+	cmpb	$3, (%r14,%rax)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	1(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L683
+.L687:
+	cmpb	$3, (%r14,%rdx)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rdi
+	leaq	2(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L683
+	xorl	%edx, %edx
+	cmpb	$3, 2(%rax,%r14)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	3(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L683
+	xorl	%edx, %edx
+	cmpb	$3, 3(%rax,%r14)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	4(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L683
+	xorl	%edx, %edx
+	cmpb	$3, 4(%rax,%r14)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	5(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L683
+	xorl	%edx, %edx
+	cmpb	$3, 5(%rax,%r14)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	6(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L683
+	xorl	%edx, %edx
+	cmpb	$3, 6(%rax,%r14)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	7(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L683
+	xorl	%edx, %edx
+	cmpb	$3, 7(%rax,%r14)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	8(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L683
+	xorl	%edx, %edx
+	cmpb	$3, 8(%rax,%r14)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	9(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L683
+	xorl	%edx, %edx
+	cmpb	$3, 9(%rax,%r14)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	10(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L683
+	xorl	%edx, %edx
+	cmpb	$3, 10(%rax,%r14)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	11(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L683
+	xorl	%edx, %edx
+	cmpb	$3, 11(%rax,%r14)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	12(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L683
+	xorl	%edx, %edx
+	cmpb	$3, 12(%rax,%r14)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	13(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L683
+	xorl	%edx, %edx
+	cmpb	$3, 13(%rax,%r14)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	14(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L683
+	cmpb	$3, 14(%rax,%r14)
+	sete	%al
+	movzbl	%al, %eax
+	addq	%rax, %rdi
+	cmpq	$14, %rbx
+	jbe	.L691
+	movdqa	.LC36(%rip), %xmm5
+	movdqa	.LC53(%rip), %xmm8
+	.p2align 4,,10
+	.p2align 3
+.L689:
+	movq	%r13, %rdx
+	pxor	%xmm1, %xmm1
+	pxor	%xmm7, %xmm7
+	movq	%r14, %rax
+	andq	$-16, %rdx
+	pxor	%xmm6, %xmm6
+	pxor	%xmm4, %xmm4
+	addq	%r14, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L695:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqb	%xmm8, %xmm0
+	pand	%xmm5, %xmm0
+	movdqa	%xmm0, %xmm3
+	punpckhbw	%xmm7, %xmm0
+	punpcklbw	%xmm7, %xmm3
+	movdqa	%xmm0, %xmm9
+	punpckhwd	%xmm6, %xmm0
+	movdqa	%xmm3, %xmm2
+	punpckhwd	%xmm6, %xmm3
+	punpcklwd	%xmm6, %xmm9
+	punpcklwd	%xmm6, %xmm2
+	movdqa	%xmm2, %xmm10
+	punpckldq	%xmm4, %xmm2
+	punpckhdq	%xmm4, %xmm10
+	paddq	%xmm10, %xmm2
+	movdqa	%xmm3, %xmm10
+	punpckldq	%xmm4, %xmm3
+	punpckhdq	%xmm4, %xmm10
+	paddq	%xmm10, %xmm3
+	paddq	%xmm3, %xmm2
+	movdqa	%xmm9, %xmm3
+	punpckldq	%xmm4, %xmm9
+	punpckhdq	%xmm4, %xmm3
+	paddq	%xmm3, %xmm9
+	movdqa	%xmm0, %xmm3
+	punpckhdq	%xmm4, %xmm0
+	punpckldq	%xmm4, %xmm3
+	paddq	%xmm1, %xmm0
+	paddq	%xmm3, %xmm9
+	paddq	%xmm9, %xmm2
+	movdqa	%xmm2, %xmm1
+	paddq	%xmm0, %xmm1
+	cmpq	%rax, %rdx
+	jne	.L695
+	movdqa	%xmm1, %xmm0
+	movq	%r13, %rdx
+	psrldq	$8, %xmm0
+	andq	$-16, %rdx
+	paddq	%xmm0, %xmm1
+	movq	%xmm1, %rax
+	testb	$15, %r13b
+	je	.L693
+.L694:
+	xorl	%ecx, %ecx
+	cmpb	$3, (%r14,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	1(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L693
+	xorl	%ecx, %ecx
+	cmpb	$3, 1(%rdx,%r14)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	2(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L693
+.L708:
+	cmpb	$3, (%r14,%rcx)
+	sete	%cl
+	movzbl	%cl, %ecx
+	addq	%rcx, %rax
+	leaq	3(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L693
+	xorl	%ecx, %ecx
+	cmpb	$3, 3(%rdx,%r14)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	4(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L693
+	xorl	%ecx, %ecx
+	cmpb	$3, 4(%rdx,%r14)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	5(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L693
+	xorl	%ecx, %ecx
+	cmpb	$3, 5(%rdx,%r14)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	6(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L693
+	xorl	%ecx, %ecx
+	cmpb	$3, 6(%rdx,%r14)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	7(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L693
+	xorl	%ecx, %ecx
+	cmpb	$3, 7(%rdx,%r14)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	8(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L693
+	xorl	%ecx, %ecx
+	cmpb	$3, 8(%rdx,%r14)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	9(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L693
+	xorl	%ecx, %ecx
+	cmpb	$3, 9(%rdx,%r14)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	10(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L693
+	xorl	%ecx, %ecx
+	cmpb	$3, 10(%rdx,%r14)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	11(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L693
+	xorl	%ecx, %ecx
+	cmpb	$3, 11(%rdx,%r14)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	12(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L693
+	xorl	%ecx, %ecx
+	cmpb	$3, 12(%rdx,%r14)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	13(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L693
+	xorl	%ecx, %ecx
+	cmpb	$3, 13(%rdx,%r14)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	14(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L693
+	cmpb	$3, 14(%rdx,%r14)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+	.p2align 4,,10
+	.p2align 3
+.L693:
+	cmpq	%rdi, %rax
+	jne	.L763
+	movl	%ebp, %edx
+	movq	%r13, %rsi
+	movq	%r14, %rdi
+	call	_ZN1n9simd_findIcEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	$-1, %rax
+	jne	.L699
+	movdqa	.LC53(%rip), %xmm11
+	testq	%r13, %r13
+	jne	.L764
+.L700:
+	movl	$7, %r13d
+	addq	$7, %rbx
+.L703:
+	cmpq	$14, %rbx
+	jbe	.L765
+	movq	%r13, %rdx
+	movq	%r14, %rax
+	movdqa	.LC42(%rip), %xmm3
+	movdqa	.LC43(%rip), %xmm15
+	andq	$-16, %rdx
+	movdqa	.LC44(%rip), %xmm14
+	movdqa	.LC45(%rip), %xmm13
+	movdqa	.LC46(%rip), %xmm12
+	addq	%r14, %rdx
+	movdqa	.LC47(%rip), %xmm10
+	movdqa	.LC51(%rip), %xmm7
+	movdqa	.LC52(%rip), %xmm6
+	movdqa	.LC48(%rip), %xmm9
+	movdqa	.LC36(%rip), %xmm5
+	movdqa	.LC49(%rip), %xmm8
+	.p2align 4,,10
+	.p2align 3
+.L654:
+	movdqa	%xmm3, %xmm4
+	addq	$16, %rax
+	paddq	%xmm15, %xmm3
+	movdqa	%xmm4, %xmm1
+	movdqa	%xmm4, %xmm0
+	movdqa	%xmm4, %xmm2
+	paddq	%xmm14, %xmm1
+	paddq	%xmm12, %xmm2
+	shufps	$136, %xmm1, %xmm0
+	movdqa	%xmm4, %xmm1
+	paddq	%xmm13, %xmm1
+	shufps	$136, %xmm2, %xmm1
+	movdqa	%xmm0, %xmm2
+	punpcklwd	%xmm1, %xmm0
+	punpckhwd	%xmm1, %xmm2
+	movdqa	%xmm0, %xmm1
+	punpckhwd	%xmm2, %xmm1
+	punpcklwd	%xmm2, %xmm0
+	movdqa	%xmm4, %xmm2
+	punpcklwd	%xmm1, %xmm0
+	movdqa	%xmm4, %xmm1
+	paddq	%xmm9, %xmm2
+	paddq	%xmm10, %xmm1
+	shufps	$136, %xmm2, %xmm1
+	movdqa	%xmm4, %xmm2
+	paddq	.LC50(%rip), %xmm4
+	paddq	%xmm8, %xmm2
+	shufps	$136, %xmm4, %xmm2
+	movdqa	%xmm1, %xmm4
+	punpcklwd	%xmm2, %xmm1
+	punpckhwd	%xmm2, %xmm4
+	movdqa	%xmm1, %xmm2
+	punpckhwd	%xmm4, %xmm2
+	punpcklwd	%xmm4, %xmm1
+	punpcklwd	%xmm2, %xmm1
+	movdqa	%xmm0, %xmm2
+	pmulhuw	%xmm7, %xmm2
+	psrlw	$2, %xmm2
+	movdqa	%xmm2, %xmm4
+	psllw	$2, %xmm4
+	paddw	%xmm4, %xmm2
+	psubw	%xmm2, %xmm0
+	movdqa	%xmm1, %xmm2
+	pmulhuw	%xmm7, %xmm2
+	pand	%xmm6, %xmm0
+	psrlw	$2, %xmm2
+	movdqa	%xmm2, %xmm4
+	psllw	$2, %xmm4
+	paddw	%xmm4, %xmm2
+	psubw	%xmm2, %xmm1
+	pand	%xmm6, %xmm1
+	packuswb	%xmm1, %xmm0
+	paddb	%xmm5, %xmm0
+	movups	%xmm0, -16(%rax)
+	cmpq	%rax, %rdx
+	jne	.L654
+	movq	%r13, %rcx
+	andq	$-16, %rcx
+	testb	$15, %r13b
+	je	.L652
+	movq	%rcx, %rax
+	leaq	1(%rcx), %r8
+	movabsq	$-3689348814741910323, %rdi
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	movq	%rcx, %rax
+	subq	%rdx, %rax
+	addl	$1, %eax
+	movb	%al, (%r14,%rcx)
+	cmpq	%r13, %r8
+	jnb	.L652
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	subq	%rdx, %r8
+	addl	$1, %r8d
+	movb	%r8b, 1(%rcx,%r14)
+	leaq	2(%rcx), %r8
+	cmpq	%r13, %r8
+	jnb	.L652
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rdi
+	movq	%rdx, %rax
+	shrq	$2, %rax
+	andq	$-4, %rdi
+	leaq	(%rdi,%rax), %rdx
+	subq	%rdx, %r8
+	addl	$1, %r8d
+	movb	%r8b, 2(%rcx,%r14)
+	leaq	3(%rcx), %r8
+	cmpq	%r13, %r8
+	jnb	.L652
+.L653:
+	movabsq	$-3689348814741910323, %rdi
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	movq	%r8, %rax
+	subq	%rdx, %rax
+	addl	$1, %eax
+	movb	%al, (%r14,%r8)
+	leaq	4(%rcx), %r8
+	cmpq	%r13, %r8
+	jnb	.L652
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	subq	%rdx, %r8
+	addl	$1, %r8d
+	movb	%r8b, 4(%rcx,%r14)
+	leaq	5(%rcx), %r8
+	cmpq	%r13, %r8
+	jnb	.L652
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	subq	%rdx, %r8
+	addl	$1, %r8d
+	movb	%r8b, 5(%rcx,%r14)
+	leaq	6(%rcx), %r8
+	cmpq	%r13, %r8
+	jnb	.L652
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	subq	%rdx, %r8
+	addl	$1, %r8d
+	movb	%r8b, 6(%rcx,%r14)
+	leaq	7(%rcx), %r8
+	cmpq	%r13, %r8
+	jnb	.L652
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	subq	%rdx, %r8
+	addl	$1, %r8d
+	movb	%r8b, 7(%rcx,%r14)
+	leaq	8(%rcx), %r8
+	cmpq	%r13, %r8
+	jnb	.L652
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	subq	%rdx, %r8
+	addl	$1, %r8d
+	movb	%r8b, 8(%rcx,%r14)
+	leaq	9(%rcx), %r8
+	cmpq	%r13, %r8
+	jnb	.L652
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	subq	%rdx, %r8
+	addl	$1, %r8d
+	movb	%r8b, 9(%rcx,%r14)
+	leaq	10(%rcx), %r8
+	cmpq	%r13, %r8
+	jnb	.L652
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rdx, %rax
+	subq	%rax, %r8
+	leal	1(%r8), %eax
+	leaq	11(%rcx), %r8
+	movb	%al, 10(%rcx,%r14)
+	cmpq	%r13, %r8
+	jnb	.L652
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rdx, %rax
+	subq	%rax, %r8
+	leal	1(%r8), %eax
+	leaq	12(%rcx), %r8
+	movb	%al, 11(%rcx,%r14)
+	cmpq	%r13, %r8
+	jnb	.L652
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rdi
+	movq	%rdx, %rax
+	shrq	$2, %rax
+	andq	$-4, %rdi
+	leaq	(%rdi,%rax), %rdx
+	subq	%rdx, %r8
+	leal	1(%r8), %eax
+	leaq	13(%rcx), %r8
+	movb	%al, 12(%rcx,%r14)
+	cmpq	%r13, %r8
+	jnb	.L652
+	movabsq	$-3689348814741910323, %rdi
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rdx, %rax
+	subq	%rax, %r8
+	leal	1(%r8), %eax
+	leaq	14(%rcx), %r8
+	movb	%al, 13(%rcx,%r14)
+	cmpq	%r13, %r8
+	jnb	.L652
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rdi
+	movq	%rdx, %rax
+	shrq	$2, %rax
+	andq	$-4, %rdi
+	addq	%rdi, %rax
+	subq	%rax, %r8
+	leal	1(%r8), %eax
+	movb	%al, 14(%rcx,%r14)
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	jne	.L657
+	.p2align 4,,10
+	.p2align 3
+.L758:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r15
+	movq	%r15, %rdi
+	call	__cxa_guard_acquire@PLT
+	movdqa	.LC53(%rip), %xmm11
+	testl	%eax, %eax
+	je	.L657
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L709
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L659:
+	movq	%r15, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	movl	%ebp, %eax
+	movdqa	.LC53(%rip), %xmm11
+	jl	.L661
+.L718:
+	.p2align 4,,10
+	.p2align 3
+.L759:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L766
+.L664:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %eax
+	cmpl	$2, %eax
+	jne	.L767
+.L668:
+	movq	%r14, %rdi
+	movl	$3, %edx
+	movq	%r13, %rsi
+	call	_ZN1n12__avx2_countIcEEmPKT_mS1_
+	movdqa	.LC53(%rip), %xmm11
+	movq	%rax, %rdi
+	testq	%r13, %r13
+	je	.L716
+.L683:
+	cmpq	$14, %rbx
+	jbe	.L717
+	movdqa	.LC36(%rip), %xmm5
+	movdqa	%xmm11, %xmm8
+	jmp	.L689
+	.p2align 4,,10
+	.p2align 3
+.L764:
+	movb	$9, (%r14,%rbx)
+	movl	%ebp, %edx
+	movq	%r13, %rsi
+	movq	%r14, %rdi
+	call	_ZN1n9simd_findIcEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	%rbx, %rax
+	jne	.L768
+	movq	%r13, %r15
+	movl	%ebp, %edx
+	movq	%r13, %rsi
+	movq	%r14, %rdi
+	shrq	%r15
+	movb	$9, (%r14,%r15)
+	call	_ZN1n9simd_findIcEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	movdqa	.LC53(%rip), %xmm11
+	cmpq	%rax, %r15
+	jne	.L769
+	addq	$7, %r13
+	addq	$7, %rbx
+	cmpq	$301, %r13
+	jne	.L703
+	addq	$1, %r12
+	cmpq	$8, %r12
+	jne	.L707
+	addq	$344, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L669:
+	.cfi_restore_state
+	movq	%r14, %rdi
+	movl	$3, %edx
+	movq	%r13, %rsi
+	call	_ZN1n14__avx512_countIcEEmPKT_mS1_
+	movdqa	.LC53(%rip), %xmm11
+	movq	%rax, %rdi
+.L675:
+	testq	%r13, %r13
+	jne	.L683
+.L716:
+	xorl	%eax, %eax
+	jmp	.L693
+	.p2align 4,,10
+	.p2align 3
+.L760:
+	xorl	%edi, %edi
+	xorl	%edx, %edx
+	movl	$16, %r10d
+	xorl	%r9d, %r9d
+	pxor	%xmm3, %xmm3
+	cmpq	$15, %r13
+	jbe	.L770
+	.p2align 4,,10
+	.p2align 3
+.L671:
+	movq	%r13, %rax
+	movl	$255, %ecx
+	subq	%rdx, %rax
+	movq	%rax, %r8
+	shrq	$4, %r8
+	cmpq	%rcx, %r8
+	cmovbe	%r8, %rcx
+	testq	%r8, %r8
+	je	.L676
+	addq	%r14, %rdx
+	pxor	%xmm2, %xmm2
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L677:
+	movdqu	(%rdx), %xmm0
+	movdqa	%xmm2, %xmm1
+	addq	$1, %rax
+	addq	$16, %rdx
+	pcmpeqb	%xmm11, %xmm0
+	psubb	%xmm0, %xmm1
+	movdqa	%xmm1, %xmm2
+	cmpq	%rcx, %rax
+	jb	.L677
+	subq	$1, %rcx
+	psadbw	%xmm3, %xmm1
+	salq	$4, %rcx
+	testq	%r8, %r8
+	movhlps	%xmm1, %xmm5
+	cmove	%r9, %rcx
+	movq	%xmm5, %rax
+	leaq	(%rcx,%r10), %rdx
+	movq	%xmm1, %rcx
+	addq	%rcx, %rax
+	leaq	16(%rdx), %r10
+	addq	%rax, %rdi
+	cmpq	%r10, %r13
+	jnb	.L671
+	movq	%r13, %rax
+	subq	%rdx, %rax
+.L680:
+	testq	%rax, %rax
+	je	.L683
+	cmpq	$15, %rax
+	jbe	.L715
+	movq	8(%rsp), %rsi
+	leaq	(%r12,%rdx), %rcx
+	movq	%rax, %r8
+	pxor	%xmm2, %xmm2
+	pxor	%xmm7, %xmm7
+	pxor	%xmm6, %xmm6
+	pxor	%xmm4, %xmm4
+	andq	$-16, %r8
+	addq	%rsi, %rcx
+	movdqa	.LC36(%rip), %xmm5
+	movdqa	.LC53(%rip), %xmm8
+	addq	%rcx, %r8
+	.p2align 4,,10
+	.p2align 3
+.L684:
+	movdqu	(%rcx), %xmm0
+	addq	$16, %rcx
+	pcmpeqb	%xmm8, %xmm0
+	pand	%xmm5, %xmm0
+	movdqa	%xmm0, %xmm3
+	punpckhbw	%xmm7, %xmm0
+	punpcklbw	%xmm7, %xmm3
+	movdqa	%xmm0, %xmm9
+	punpckhwd	%xmm6, %xmm0
+	movdqa	%xmm3, %xmm1
+	punpckhwd	%xmm6, %xmm3
+	punpcklwd	%xmm6, %xmm9
+	punpcklwd	%xmm6, %xmm1
+	movdqa	%xmm1, %xmm10
+	punpckhdq	%xmm4, %xmm1
+	punpckldq	%xmm4, %xmm10
+	paddq	%xmm10, %xmm1
+	movdqa	%xmm3, %xmm10
+	punpckhdq	%xmm4, %xmm3
+	punpckldq	%xmm4, %xmm10
+	paddq	%xmm10, %xmm3
+	paddq	%xmm3, %xmm1
+	movdqa	%xmm9, %xmm3
+	punpckhdq	%xmm4, %xmm9
+	punpckldq	%xmm4, %xmm3
+	paddq	%xmm3, %xmm9
+	movdqa	%xmm0, %xmm3
+	punpckhdq	%xmm4, %xmm0
+	punpckldq	%xmm4, %xmm3
+	paddq	%xmm2, %xmm0
+	paddq	%xmm3, %xmm9
+	paddq	%xmm9, %xmm1
+	paddq	%xmm0, %xmm1
+	movdqa	%xmm1, %xmm2
+	cmpq	%rcx, %r8
+	jne	.L684
+	movdqa	%xmm1, %xmm0
+	movq	%rax, %r8
+	psrldq	$8, %xmm0
+	andq	$-16, %r8
+	paddq	%xmm0, %xmm2
+	movq	%xmm2, %rcx
+	testb	$15, %al
+	je	.L771
+.L681:
+	addq	%r14, %rdx
+	xorl	%r9d, %r9d
+	cmpb	$3, (%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	1(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L685
+	xorl	%r9d, %r9d
+	cmpb	$3, 1(%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	2(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L685
+	xorl	%r9d, %r9d
+	cmpb	$3, 2(%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	3(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L685
+	xorl	%r9d, %r9d
+	cmpb	$3, 3(%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	4(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L685
+	xorl	%r9d, %r9d
+	cmpb	$3, 4(%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	5(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L685
+	xorl	%r9d, %r9d
+	cmpb	$3, 5(%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	6(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L685
+	xorl	%r9d, %r9d
+	cmpb	$3, 6(%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	7(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L685
+	xorl	%r9d, %r9d
+	cmpb	$3, 7(%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	8(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L685
+	xorl	%r9d, %r9d
+	cmpb	$3, 8(%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	9(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L685
+	xorl	%r9d, %r9d
+	cmpb	$3, 9(%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	10(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L685
+	xorl	%r9d, %r9d
+	cmpb	$3, 10(%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	11(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L685
+	xorl	%r9d, %r9d
+	cmpb	$3, 11(%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	12(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L685
+	xorl	%r9d, %r9d
+	cmpb	$3, 12(%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	13(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L685
+	xorl	%r9d, %r9d
+	cmpb	$3, 13(%rdx,%r8)
+	sete	%r9b
+	addq	$14, %r8
+	addq	%r9, %rcx
+	cmpq	%rax, %r8
+	jnb	.L685
+	xorl	%eax, %eax
+	cmpb	$3, (%rdx,%r8)
+	sete	%al
+	addq	%rax, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L685:
+	addq	%rcx, %rdi
+	jmp	.L675
+.L766:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r15
+	movq	%r15, %rdi
+	call	__cxa_guard_acquire@PLT
+	movdqa	.LC53(%rip), %xmm11
+	testl	%eax, %eax
+	je	.L664
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L711
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L666:
+	movq	%r15, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	movdqa	.LC53(%rip), %xmm11
+	jmp	.L664
+.L765:
+	movl	$513, %eax
+	movb	$3, 2(%r14)
+	xorl	%ecx, %ecx
+	movl	$3, %r8d
+	movw	%ax, (%r14)
+	jmp	.L653
+.L717:
+	xorl	%eax, %eax
+	xorl	%edx, %edx
+	jmp	.L694
+.L761:
+	xorl	%esi, %esi
+	movl	%ebp, %edx
+	movq	%r14, %rdi
+	call	_ZN1n9simd_findIcEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	movdqa	.LC53(%rip), %xmm11
+	cmpq	$-1, %rax
+	jne	.L699
+	addq	$7, %rbx
+	movl	$7, %r13d
+	jmp	.L703
+.L770:
+	movq	%r13, %rax
+	xorl	%ecx, %ecx
+	xorl	%r8d, %r8d
+	testq	%r13, %r13
+	jne	.L681
+	xorl	%esi, %esi
+	movl	%ebp, %edx
+	movq	%r14, %rdi
+	call	_ZN1n9simd_findIcEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	movdqa	.LC53(%rip), %xmm11
+	cmpq	$-1, %rax
+	je	.L700
+.L699:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC54(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L762:
+	xorl	%edi, %edi
+	cmpb	$3, (%r14)
+	movl	$1, %edx
+	sete	%dil
+	xorl	%eax, %eax
+	jmp	.L687
+.L709:
+	movl	$3, %eax
+	jmp	.L659
+.L771:
+	addq	%rcx, %rdi
+	jmp	.L683
+.L711:
+	movl	$3, %eax
+	jmp	.L666
+.L715:
+	xorl	%ecx, %ecx
+	xorl	%r8d, %r8d
+	jmp	.L681
+.L691:
+	xorl	%eax, %eax
+	cmpb	$3, (%r14)
+	movl	$2, %ecx
+	sete	%al
+	xorl	%edx, %edx
+	cmpb	$3, 1(%r14)
+	sete	%dl
+	addq	%rdx, %rax
+	xorl	%edx, %edx
+	jmp	.L708
+.L676:
+	cmpq	%r10, %r13
+	jb	.L772
+.L679:
+	jmp	.L679
+.L772:
+	pxor	%xmm0, %xmm0
+	psadbw	%xmm0, %xmm0
+	movhlps	%xmm0, %xmm5
+	movq	%xmm0, %r8
+	movq	%xmm5, %rcx
+	addq	%r8, %rcx
+	addq	%rcx, %rdi
+	jmp	.L680
+.L769:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC57(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L768:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC56(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L763:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC55(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.cfi_endproc
+.LFE6784:
+	.size	_Z16check_find_countIcEvN1n8simd_isaE, .-_Z16check_find_countIcEvN1n8simd_isaE
+	.section	.text._ZN1n14__avx512_countIhEEmPKT_mS1_,"axG",@progbits,_ZN1n14__avx512_countIhEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n14__avx512_countIhEEmPKT_mS1_
+	.type	_ZN1n14__avx512_countIhEEmPKT_mS1_, @function
+_ZN1n14__avx512_countIhEEmPKT_mS1_:
+.LFB6870:
+	.cfi_startproc
+	movl	%edx, %r10d
+	vpbroadcastb	%edx, %zmm5
+	movl	$64, %eax
+	xorl	%r8d, %r8d
+	cmpq	$63, %rsi
+	jbe	.L798
+	.p2align 4,,10
+	.p2align 3
+.L777:
+	vpcmpeqb	-64(%rdi,%rax), %zmm5, %k0
+	movq	%rax, %r9
+	addq	$64, %rax
+	kmovq	%k0, %rcx
+	popcntq	%rcx, %rcx
+	addq	%rcx, %r8
+	cmpq	%rax, %rsi
+	jnb	.L777
+	subq	%r9, %rsi
+	je	.L773
+	leaq	-1(%rsi), %rax
+	cmpq	$62, %rax
+	jbe	.L784
+	movq	%rsi, %rcx
+	addq	%r9, %rdi
+	movl	$1, %r9d
+	andq	$-64, %rcx
+	movq	%rdi, %rax
+	vpxor	%xmm7, %xmm7, %xmm7
+	addq	%rdi, %rcx
+	vpbroadcastb	%r9d, %zmm6
+	.p2align 4,,10
+	.p2align 3
+.L778:
+	vpcmpb	$0, (%rax), %zmm5, %k1
+	addq	$64, %rax
+	vmovdqu8	%zmm6, %zmm0{%k1}{z}
+	vpmovzxbw	%ymm0, %zmm1
+	vextracti64x4	$0x1, %zmm0, %ymm0
+	vpmovzxwd	%ymm1, %zmm4
+	vextracti64x4	$0x1, %zmm1, %ymm1
+	vpmovzxbw	%ymm0, %zmm0
+	vpmovzxdq	%ymm4, %zmm2
+	vextracti64x4	$0x1, %zmm4, %ymm4
+	vpmovzxwd	%ymm1, %zmm1
+	vpmovzxdq	%ymm4, %zmm4
+	vpmovzxwd	%ymm0, %zmm3
+	vextracti64x4	$0x1, %zmm0, %ymm0
+	vpaddq	%zmm4, %zmm2, %zmm2
+	vpmovzxdq	%ymm1, %zmm4
+	vextracti64x4	$0x1, %zmm1, %ymm1
+	vpmovzxdq	%ymm1, %zmm1
+	vpmovzxwd	%ymm0, %zmm0
+	vpaddq	%zmm1, %zmm4, %zmm4
+	vpmovzxdq	%ymm3, %zmm1
+	vextracti64x4	$0x1, %zmm3, %ymm3
+	vpmovzxdq	%ymm3, %zmm3
+	vpaddq	%zmm4, %zmm2, %zmm2
+	vpaddq	%zmm3, %zmm1, %zmm1
+	vpmovzxdq	%ymm0, %zmm3
+	vextracti64x4	$0x1, %zmm0, %ymm0
+	vpaddq	%zmm3, %zmm1, %zmm1
+	vpmovzxdq	%ymm0, %zmm0
+	vpaddq	%zmm1, %zmm2, %zmm2
+	vpaddq	%zmm7, %zmm0, %zmm0
+	vpaddq	%zmm0, %zmm2, %zmm7
+	cmpq	%rax, %rcx
+	jne	.L778
+	vmovdqa	%ymm7, %ymm3
+	vextracti64x4	$0x1, %zmm7, %ymm7
+	movq	%rsi, %rax
+	vpaddq	%ymm7, %ymm3, %ymm3
+	andq	$-64, %rax
+	vextracti128	$0x1, %ymm3, %xmm1
+	vpaddq	%xmm1, %xmm3, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rcx
+	testb	$63, %sil
+	je	.L779
+.L775:
+	movq	%rsi, %r9
+	subq	%rax, %r9
+	leaq	-1(%r9), %r11
+	cmpq	$30, %r11
+	jbe	.L782
+	vmovd	%edx, %xmm0
+	movl	$1, %edx
+	vpbroadcastb	%xmm0, %ymm0
+	vmovd	%edx, %xmm1
+	movq	%r9, %rdx
+	vpcmpeqb	(%rdi,%rax), %ymm0, %ymm0
+	vpbroadcastb	%xmm1, %ymm1
+	andq	$-32, %rdx
+	addq	%rdx, %rax
+	andl	$31, %r9d
+	vpand	%ymm1, %ymm0, %ymm0
+	vpmovzxbw	%xmm0, %ymm2
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxwd	%xmm2, %ymm4
+	vextracti128	$0x1, %ymm2, %xmm2
+	vpmovzxbw	%xmm0, %ymm0
+	vpmovzxwd	%xmm2, %ymm2
+	vpmovzxwd	%xmm0, %ymm5
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxdq	%xmm2, %ymm1
+	vextracti128	$0x1, %ymm2, %xmm2
+	vpmovzxwd	%xmm0, %ymm0
+	vpmovzxdq	%xmm2, %ymm2
+	vpaddq	%ymm2, %ymm1, %ymm1
+	vpmovzxdq	%xmm4, %ymm2
+	vextracti128	$0x1, %ymm4, %xmm4
+	vpmovzxdq	%xmm4, %ymm4
+	vpaddq	%ymm4, %ymm2, %ymm2
+	vpaddq	%ymm2, %ymm1, %ymm1
+	vpmovzxdq	%xmm5, %ymm2
+	vextracti128	$0x1, %ymm5, %xmm5
+	vpmovzxdq	%xmm5, %ymm5
+	vpaddq	%ymm5, %ymm2, %ymm2
+	vpaddq	%ymm3, %ymm2, %ymm2
+	vpaddq	%ymm2, %ymm1, %ymm1
+	vpmovzxdq	%xmm0, %ymm2
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxdq	%xmm0, %ymm0
+	vpaddq	%ymm0, %ymm2, %ymm0
+	vpaddq	%ymm0, %ymm1, %ymm1
+	vmovdqa	%xmm1, %xmm0
+	vextracti128	$0x1, %ymm1, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rcx
+	je	.L779
+	.p2align 4,,10
+	.p2align 3
+.L782:
+	xorl	%edx, %edx
+	cmpb	%r10b, (%rdi,%rax)
+	sete	%dl
+	addq	$1, %rax
+	addq	%rdx, %rcx
+	cmpq	%rsi, %rax
+	jb	.L782
+.L779:
+	addq	%rcx, %r8
+.L773:
+	movq	%r8, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L798:
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	testq	%rsi, %rsi
+	jne	.L775
+	jmp	.L773
+.L784:
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	addq	%r9, %rdi
+	jmp	.L775
+	.cfi_endproc
+.LFE6870:
+	.size	_ZN1n14__avx512_countIhEEmPKT_mS1_, .-_ZN1n14__avx512_countIhEEmPKT_mS1_
+	.section	.text._ZN1n12__avx2_countIhEEmPKT_mS1_,"axG",@progbits,_ZN1n12__avx2_countIhEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n12__avx2_countIhEEmPKT_mS1_
+	.type	_ZN1n12__avx2_countIhEEmPKT_mS1_, @function
+_ZN1n12__avx2_countIhEEmPKT_mS1_:
+.LFB6871:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	vmovd	%edx, %xmm2
+	movq	%rdi, %r10
+	movl	%edx, %r11d
+	movq	%rsi, %rdi
+	vpbroadcastb	%xmm2, %ymm2
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	.cfi_offset 14, -24
+	.cfi_offset 13, -32
+	.cfi_offset 12, -40
+	.cfi_offset 3, -48
+	cmpq	$31, %rsi
+	jbe	.L800
+	xorl	%edx, %edx
+	xorl	%r9d, %r9d
+	movl	$32, %r8d
+	xorl	%ebx, %ebx
+	vpxor	%xmm3, %xmm3, %xmm3
+	.p2align 4,,10
+	.p2align 3
+.L806:
+	movq	%rdi, %r12
+	movl	$255, %ecx
+	subq	%rdx, %r12
+	movq	%r12, %rsi
+	shrq	$5, %rsi
+	cmpq	%rcx, %rsi
+	cmovbe	%rsi, %rcx
+	testq	%rsi, %rsi
+	je	.L813
+	addq	%r10, %rdx
+	vpxor	%xmm1, %xmm1, %xmm1
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L802:
+	vpcmpeqb	(%rdx), %ymm2, %ymm0
+	addq	$1, %rax
+	addq	$32, %rdx
+	vpsubb	%ymm0, %ymm1, %ymm0
+	vmovdqa	%ymm0, %ymm1
+	cmpq	%rcx, %rax
+	jb	.L802
+	subq	$1, %rcx
+	movq	%rdi, %r12
+	salq	$5, %rcx
+	testq	%rsi, %rsi
+	cmove	%rbx, %rcx
+	leaq	(%rcx,%r8), %rdx
+	subq	%rdx, %r12
+	leaq	32(%rdx), %r8
+.L801:
+	vpsadbw	%ymm3, %ymm0, %ymm0
+	vmovq	%xmm0, %rcx
+	vpextrq	$1, %xmm0, %r14
+	vextracti128	$0x1, %ymm0, %xmm0
+	addq	%r14, %rcx
+	vmovq	%xmm0, %r13
+	vpextrq	$1, %xmm0, %rax
+	addq	%r9, %rcx
+	addq	%r13, %rcx
+	leaq	(%rax,%rcx), %r9
+	cmpq	%r8, %rdi
+	jb	.L826
+	testq	%rsi, %rsi
+	jne	.L806
+.L807:
+	jmp	.L807
+	.p2align 4,,10
+	.p2align 3
+.L826:
+	testq	%r12, %r12
+	je	.L799
+	leaq	-1(%r12), %rax
+	cmpq	$30, %rax
+	jbe	.L815
+	movq	%r12, %rsi
+	leaq	(%r10,%rdx), %rcx
+	vpxor	%xmm3, %xmm3, %xmm3
+	movl	$1, %edi
+	andq	$-32, %rsi
+	vmovd	%edi, %xmm4
+	movq	%rcx, %rax
+	addq	%rcx, %rsi
+	vpbroadcastb	%xmm4, %ymm4
+	.p2align 4,,10
+	.p2align 3
+.L809:
+	vpcmpeqb	(%rax), %ymm2, %ymm0
+	addq	$32, %rax
+	vpand	%ymm4, %ymm0, %ymm0
+	vpmovzxbw	%xmm0, %ymm1
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxwd	%xmm1, %ymm7
+	vextracti128	$0x1, %ymm1, %xmm1
+	vpmovzxbw	%xmm0, %ymm0
+	vpmovzxwd	%xmm1, %ymm1
+	vpmovzxwd	%xmm0, %ymm6
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxdq	%xmm1, %ymm5
+	vextracti128	$0x1, %ymm1, %xmm1
+	vpmovzxwd	%xmm0, %ymm0
+	vpmovzxdq	%xmm1, %ymm1
+	vpaddq	%ymm1, %ymm5, %ymm1
+	vpmovzxdq	%xmm7, %ymm5
+	vextracti128	$0x1, %ymm7, %xmm7
+	vpmovzxdq	%xmm7, %ymm7
+	vpaddq	%ymm7, %ymm5, %ymm5
+	vpaddq	%ymm5, %ymm1, %ymm1
+	vpmovzxdq	%xmm6, %ymm5
+	vextracti128	$0x1, %ymm6, %xmm6
+	vpmovzxdq	%xmm6, %ymm6
+	vpaddq	%ymm6, %ymm5, %ymm5
+	vpmovzxdq	%xmm0, %ymm6
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpaddq	%ymm6, %ymm5, %ymm5
+	vpmovzxdq	%xmm0, %ymm0
+	vpaddq	%ymm5, %ymm1, %ymm1
+	vpaddq	%ymm3, %ymm0, %ymm0
+	vpaddq	%ymm0, %ymm1, %ymm3
+	cmpq	%rax, %rsi
+	jne	.L809
+	vmovdqa	%xmm3, %xmm0
+	vextracti128	$0x1, %ymm3, %xmm3
+	movq	%r12, %r8
+	vpaddq	%xmm3, %xmm0, %xmm3
+	andq	$-32, %r8
+	vpsrldq	$8, %xmm3, %xmm0
+	vpaddq	%xmm0, %xmm3, %xmm0
+	vmovq	%xmm0, %rax
+	testb	$31, %r12b
+	je	.L810
+.L808:
+	movq	%r12, %rsi
+	subq	%r8, %rsi
+	leaq	-1(%rsi), %rdi
+	cmpq	$14, %rdi
+	jbe	.L811
+	vmovd	%r11d, %xmm0
+	movl	$1, %eax
+	movq	%rsi, %rdi
+	vpbroadcastb	%xmm0, %xmm0
+	vmovd	%eax, %xmm1
+	andq	$-16, %rdi
+	vpcmpeqb	(%rcx,%r8), %xmm0, %xmm0
+	vpbroadcastb	%xmm1, %xmm1
+	addq	%rdi, %r8
+	andl	$15, %esi
+	vpand	%xmm1, %xmm0, %xmm0
+	vpmovzxbw	%xmm0, %xmm2
+	vpsrldq	$8, %xmm0, %xmm0
+	vpmovzxwd	%xmm2, %xmm5
+	vpsrldq	$8, %xmm2, %xmm2
+	vpmovzxbw	%xmm0, %xmm0
+	vpmovzxdq	%xmm5, %xmm1
+	vpsrldq	$8, %xmm5, %xmm5
+	vpmovzxwd	%xmm2, %xmm2
+	vpmovzxdq	%xmm5, %xmm5
+	vpmovzxwd	%xmm0, %xmm4
+	vpaddq	%xmm5, %xmm1, %xmm1
+	vpsrldq	$8, %xmm0, %xmm0
+	vpmovzxdq	%xmm2, %xmm5
+	vpsrldq	$8, %xmm2, %xmm2
+	vpmovzxwd	%xmm0, %xmm0
+	vpmovzxdq	%xmm2, %xmm2
+	vpaddq	%xmm2, %xmm5, %xmm2
+	vpaddq	%xmm2, %xmm1, %xmm1
+	vpmovzxdq	%xmm4, %xmm2
+	vpsrldq	$8, %xmm4, %xmm4
+	vpmovzxdq	%xmm4, %xmm4
+	vpaddq	%xmm4, %xmm2, %xmm2
+	vpaddq	%xmm3, %xmm2, %xmm2
+	vpaddq	%xmm2, %xmm1, %xmm1
+	vpmovzxdq	%xmm0, %xmm2
+	vpsrldq	$8, %xmm0, %xmm0
+	vpmovzxdq	%xmm0, %xmm0
+	vpaddq	%xmm0, %xmm2, %xmm0
+	vpaddq	%xmm0, %xmm1, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rax
+	je	.L810
+.L811:
+	xorl	%esi, %esi
+	cmpb	%r11b, (%rcx,%r8)
+	sete	%sil
+	addq	%rsi, %rax
+	leaq	1(%r8), %rsi
+	cmpq	%r12, %rsi
+	jnb	.L810
+	addq	%rsi, %r10
+	cmpb	%r11b, (%r10,%rdx)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+	leaq	2(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L810
+	xorl	%edx, %edx
+	cmpb	%r11b, 2(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	3(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L810
+	xorl	%edx, %edx
+	cmpb	%r11b, 3(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	4(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L810
+	xorl	%edx, %edx
+	cmpb	%r11b, 4(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	5(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L810
+	xorl	%edx, %edx
+	cmpb	%r11b, 5(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	6(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L810
+	xorl	%edx, %edx
+	cmpb	%r11b, 6(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	7(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L810
+	xorl	%edx, %edx
+	cmpb	%r11b, 7(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	8(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L810
+	xorl	%edx, %edx
+	cmpb	%r11b, 8(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	9(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L810
+	xorl	%edx, %edx
+	cmpb	%r11b, 9(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	10(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L810
+	xorl	%edx, %edx
+	cmpb	%r11b, 10(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	11(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L810
+	xorl	%edx, %edx
+	cmpb	%r11b, 11(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	12(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L810
+	xorl	%edx, %edx
+	cmpb	%r11b, 12(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	13(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L810
+	xorl	%edx, %edx
+	cmpb	%r11b, 13(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	14(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L810
+	xorl	%edx, %edx
+	cmpb	%r11b, 14(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	.p2align 4,,10
+	.p2align 3
+.L810:
+	addq	%rax, %r9
+.L799:
+	vzeroupper
+	movq	%r9, %rax
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L813:
+	.cfi_restore_state
+	vpxor	%xmm0, %xmm0, %xmm0
+	jmp	.L801
+.L800:
+	xorl	%r9d, %r9d
+	testq	%rsi, %rsi
+	je	.L799
+	movq	%rsi, %r12
+	xorl	%edx, %edx
+	xorl	%r9d, %r9d
+	xorl	%eax, %eax
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%r8d, %r8d
+	movq	%r10, %rcx
+	jmp	.L808
+.L815:
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%eax, %eax
+	leaq	(%r10,%rdx), %rcx
+	xorl	%r8d, %r8d
+	jmp	.L808
+	.cfi_endproc
+.LFE6871:
+	.size	_ZN1n12__avx2_countIhEEmPKT_mS1_, .-_ZN1n12__avx2_countIhEEmPKT_mS1_
+	.section	.text._ZN1n13__avx512_findIhEEmPKT_mS1_,"axG",@progbits,_ZN1n13__avx512_findIhEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n13__avx512_findIhEEmPKT_mS1_
+	.type	_ZN1n13__avx512_findIhEEmPKT_mS1_, @function
+_ZN1n13__avx512_findIhEEmPKT_mS1_:
+.LFB6873:
+	.cfi_startproc
+	movl	%edx, %ecx
+	vpbroadcastb	%edx, %zmm0
+	xorl	%edx, %edx
+	jmp	.L828
+	.p2align 4,,10
+	.p2align 3
+.L830:
+	vpcmpeqb	-64(%rdi,%rdx), %zmm0, %k0
+	kortestq	%k0, %k0
+	jne	.L837
+.L828:
+	movq	%rdx, %rax
+	leaq	64(%rdx), %rdx
+	cmpq	%rdx, %rsi
+	jnb	.L830
+	subq	%rax, %rsi
+	je	.L833
+	xorl	%edx, %edx
+	addq	%rax, %rdi
+	jmp	.L832
+	.p2align 4,,10
+	.p2align 3
+.L838:
+	addq	$1, %rdx
+	cmpq	%rdx, %rsi
+	je	.L833
+.L832:
+	cmpb	(%rdi,%rdx), %cl
+	jne	.L838
+	addq	%rdx, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L833:
+	movq	$-1, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L837:
+	xorl	%edx, %edx
+	kmovq	%k0, %rcx
+	rep bsfq	%rcx, %rdx
+	movslq	%edx, %rdx
+	addq	%rdx, %rax
+	vzeroupper
+	ret
+	.cfi_endproc
+.LFE6873:
+	.size	_ZN1n13__avx512_findIhEEmPKT_mS1_, .-_ZN1n13__avx512_findIhEEmPKT_mS1_
+	.section	.text._ZN1n11__avx2_findIhEEmPKT_mS1_,"axG",@progbits,_ZN1n11__avx2_findIhEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n11__avx2_findIhEEmPKT_mS1_
+	.type	_ZN1n11__avx2_findIhEEmPKT_mS1_, @function
+_ZN1n11__avx2_findIhEEmPKT_mS1_:
+.LFB6874:
+	.cfi_startproc
+	vmovd	%edx, %xmm1
+	movl	%edx, %r8d
+	xorl	%eax, %eax
+	vpbroadcastb	%xmm1, %ymm1
+	jmp	.L840
+	.p2align 4,,10
+	.p2align 3
+.L842:
+	vpcmpeqb	-128(%rdi,%rax), %ymm1, %ymm2
+	vpcmpeqb	-96(%rdi,%rax), %ymm1, %ymm0
+	vpcmpeqb	-64(%rdi,%rax), %ymm1, %ymm3
+	vpor	%ymm2, %ymm0, %ymm0
+	vpcmpeqb	-32(%rdi,%rax), %ymm1, %ymm2
+	vpor	%ymm3, %ymm2, %ymm2
+	vpor	%ymm2, %ymm0, %ymm0
+	vptest	%ymm0, %ymm0
+	jne	.L843
+.L840:
+	movq	%rax, %rdx
+	subq	$-128, %rax
+	cmpq	%rax, %rsi
+	jnb	.L842
+	movq	%rdx, %rax
+	leaq	32(%rdx), %rdx
+	cmpq	%rdx, %rsi
+	jb	.L855
+	.p2align 4,,10
+	.p2align 3
+.L845:
+	vpcmpeqb	-32(%rdi,%rdx), %ymm1, %ymm0
+	vpmovmskb	%ymm0, %ecx
+	testl	%ecx, %ecx
+	jne	.L856
+.L843:
+	movq	%rdx, %rax
+	leaq	32(%rdx), %rdx
+	cmpq	%rdx, %rsi
+	jnb	.L845
+.L855:
+	subq	%rax, %rsi
+	je	.L848
+	xorl	%edx, %edx
+	leaq	(%rdi,%rax), %rcx
+	jmp	.L847
+	.p2align 4,,10
+	.p2align 3
+.L857:
+	addq	$1, %rdx
+	cmpq	%rdx, %rsi
+	je	.L848
+.L847:
+	cmpb	(%rcx,%rdx), %r8b
+	jne	.L857
+	addq	%rdx, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L848:
+	movq	$-1, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L856:
+	rep bsfl	%ecx, %ecx
+	movslq	%ecx, %rcx
+	addq	%rcx, %rax
+	vzeroupper
+	ret
+	.cfi_endproc
+.LFE6874:
+	.size	_ZN1n11__avx2_findIhEEmPKT_mS1_, .-_ZN1n11__avx2_findIhEEmPKT_mS1_
+	.section	.text._ZN1n9simd_findIhEEmPKT_mS1_NS_8simd_isaE.constprop.0,"axG",@progbits,_Z16check_find_countIhEvN1n8simd_isaE,comdat
+	.p2align 4
+	.type	_ZN1n9simd_findIhEEmPKT_mS1_NS_8simd_isaE.constprop.0, @function
+_ZN1n9simd_findIhEEmPKT_mS1_NS_8simd_isaE.constprop.0:
+.LFB6983:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movl	%edx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L904
+.L860:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	jge	.L905
+.L890:
+	cmpl	$2, %r12d
+	je	.L871
+.L910:
+	cmpl	$3, %r12d
+	je	.L872
+	xorl	%eax, %eax
+	cmpl	$1, %r12d
+	je	.L886
+	testq	%rbp, %rbp
+	jne	.L874
+.L888:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	$-1, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L906:
+	.cfi_restore_state
+	addq	$1, %rax
+	cmpq	%rax, %rbp
+	je	.L888
+.L874:
+	cmpb	$9, (%rbx,%rax)
+	jne	.L906
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L886:
+	.cfi_restore_state
+	movdqa	.LC41(%rip), %xmm2
+	jmp	.L873
+	.p2align 4,,10
+	.p2align 3
+.L877:
+	movdqu	-64(%rbx,%rax), %xmm0
+	movdqu	-48(%rbx,%rax), %xmm1
+	movdqu	-16(%rbx,%rax), %xmm3
+	pcmpeqb	%xmm2, %xmm1
+	pcmpeqb	%xmm2, %xmm0
+	pcmpeqb	%xmm2, %xmm3
+	por	%xmm1, %xmm0
+	movdqu	-32(%rbx,%rax), %xmm1
+	pcmpeqb	%xmm2, %xmm1
+	por	%xmm3, %xmm1
+	por	%xmm1, %xmm0
+	pmovmskb	%xmm0, %ecx
+	testl	%ecx, %ecx
+	jne	.L876
+.L873:
+	movq	%rax, %rdx
+	addq	$64, %rax
+	cmpq	%rax, %rbp
+	jnb	.L877
+.L876:
+	movdqa	.LC41(%rip), %xmm1
+	jmp	.L878
+	.p2align 4,,10
+	.p2align 3
+.L879:
+	movdqu	-16(%rbx,%rdx), %xmm0
+	pcmpeqb	%xmm1, %xmm0
+	pmovmskb	%xmm0, %ecx
+	testl	%ecx, %ecx
+	jne	.L907
+.L878:
+	movq	%rdx, %rax
+	leaq	16(%rdx), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L879
+	subq	%rax, %rbp
+	je	.L888
+	xorl	%edx, %edx
+	leaq	(%rbx,%rax), %rcx
+	jmp	.L881
+	.p2align 4,,10
+	.p2align 3
+.L908:
+	addq	$1, %rdx
+	cmpq	%rdx, %rbp
+	je	.L888
+.L881:
+	cmpb	$9, (%rcx,%rdx)
+	jne	.L908
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	addq	%rdx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.L889:
+	.p2align 4,,10
+	.p2align 3
+.L905:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L909
+.L867:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	cmpl	$2, %r12d
+	jne	.L910
+.L871:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movl	$9, %edx
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n11__avx2_findIhEEmPKT_mS1_
+	.p2align 4,,10
+	.p2align 3
+.L904:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L860
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L882
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L862:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L860
+	.p2align 4,,10
+	.p2align 3
+.L872:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movl	$9, %edx
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n13__avx512_findIhEEmPKT_mS1_
+	.p2align 4,,10
+	.p2align 3
+.L907:
+	.cfi_restore_state
+	rep bsfl	%ecx, %ecx
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movslq	%ecx, %rcx
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	addq	%rcx, %rax
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L909:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L867
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L884
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L869:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L867
+.L884:
+	movl	$3, %eax
+	jmp	.L869
+.L882:
+	movl	$3, %eax
+	jmp	.L862
+	.cfi_endproc
+.LFE6983:
+	.size	_ZN1n9simd_findIhEEmPKT_mS1_NS_8simd_isaE.constprop.0, .-_ZN1n9simd_findIhEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	.section	.text._Z16check_find_countIhEvN1n8simd_isaE,"axG",@progbits,_Z16check_find_countIhEvN1n8simd_isaE,comdat
+	.p2align 4
+	.weak	_Z16check_find_countIhEvN1n8simd_isaE
+	.type	_Z16check_find_countIhEvN1n8simd_isaE, @function
+_Z16check_find_countIhEvN1n8simd_isaE:
+.LFB6785:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	movl	$36, %ecx
+	pxor	%xmm0, %xmm0
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	xorl	%r12d, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movl	%edi, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$344, %rsp
+	.cfi_def_cfa_offset 400
+	movdqa	.LC53(%rip), %xmm11
+	leaq	32(%rsp), %rdi
+	movaps	%xmm0, 16(%rsp)
+	rep stosq
+	leaq	16(%rsp), %rax
+	movq	%rax, 8(%rsp)
+	movl	$0, (%rdi)
+.L967:
+	movq	8(%rsp), %rax
+	movq	$-1, %rbx
+	xorl	%r13d, %r13d
+	leaq	(%rax,%r12), %r14
+	.p2align 4,,10
+	.p2align 3
+.L912:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1018
+.L917:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	movl	%ebp, %eax
+	jge	.L1019
+.L979:
+.L921:
+	cmpl	$2, %eax
+	je	.L928
+.L1027:
+	cmpl	$3, %eax
+	je	.L929
+	cmpl	$1, %eax
+	je	.L1020
+	testq	%r13, %r13
+	je	.L1021
+	cmpq	$14, %rbx
+	jbe	.L1022
+	movq	%r13, %rdx
+	pxor	%xmm2, %xmm2
+	pxor	%xmm6, %xmm6
+	movq	%r14, %rax
+	andq	$-16, %rdx
+	movdqa	.LC36(%rip), %xmm5
+	pxor	%xmm4, %xmm4
+	pxor	%xmm3, %xmm3
+	movdqa	.LC53(%rip), %xmm8
+	addq	%r14, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L948:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqb	%xmm8, %xmm0
+	pand	%xmm5, %xmm0
+	movdqa	%xmm0, %xmm1
+	punpckhbw	%xmm6, %xmm0
+	punpcklbw	%xmm6, %xmm1
+	movdqa	%xmm0, %xmm7
+	punpckhwd	%xmm4, %xmm0
+	movdqa	%xmm1, %xmm9
+	punpckhwd	%xmm4, %xmm1
+	punpcklwd	%xmm4, %xmm7
+	movdqa	%xmm1, %xmm10
+	punpcklwd	%xmm4, %xmm9
+	punpckhdq	%xmm3, %xmm1
+	punpckldq	%xmm3, %xmm10
+	paddq	%xmm10, %xmm1
+	movdqa	%xmm9, %xmm10
+	punpckhdq	%xmm3, %xmm9
+	punpckldq	%xmm3, %xmm10
+	paddq	%xmm10, %xmm9
+	paddq	%xmm9, %xmm1
+	movdqa	%xmm7, %xmm9
+	punpckhdq	%xmm3, %xmm7
+	punpckldq	%xmm3, %xmm9
+	paddq	%xmm9, %xmm7
+	movdqa	%xmm0, %xmm9
+	punpckhdq	%xmm3, %xmm0
+	punpckldq	%xmm3, %xmm9
+	paddq	%xmm2, %xmm0
+	paddq	%xmm9, %xmm7
+	paddq	%xmm7, %xmm1
+	paddq	%xmm0, %xmm1
+	movdqa	%xmm1, %xmm2
+	cmpq	%rax, %rdx
+	jne	.L948
+	movdqa	%xmm1, %xmm0
+	movq	%r13, %rax
+	psrldq	$8, %xmm0
+	andq	$-16, %rax
+	paddq	%xmm0, %xmm2
+	movq	%xmm2, %rdi
+	testb	$15, %r13b
+	je	.L949
+	xorl	%edx, %edx
+	cmpb	$3, (%r14,%rax)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	1(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L943
+.L947:
+	cmpb	$3, (%r14,%rdx)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rdi
+	leaq	2(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L943
+	xorl	%edx, %edx
+	cmpb	$3, 2(%rax,%r14)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	3(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L943
+	xorl	%edx, %edx
+	cmpb	$3, 3(%rax,%r14)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	4(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L943
+	xorl	%edx, %edx
+	cmpb	$3, 4(%rax,%r14)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	5(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L943
+	xorl	%edx, %edx
+	cmpb	$3, 5(%rax,%r14)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	6(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L943
+	xorl	%edx, %edx
+	cmpb	$3, 6(%rax,%r14)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	7(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L943
+	xorl	%edx, %edx
+	cmpb	$3, 7(%rax,%r14)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	8(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L943
+	xorl	%edx, %edx
+	cmpb	$3, 8(%rax,%r14)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	9(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L943
+	xorl	%edx, %edx
+	cmpb	$3, 9(%rax,%r14)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	10(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L943
+	xorl	%edx, %edx
+	cmpb	$3, 10(%rax,%r14)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	11(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L943
+	xorl	%edx, %edx
+	cmpb	$3, 11(%rax,%r14)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	12(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L943
+	xorl	%edx, %edx
+	cmpb	$3, 12(%rax,%r14)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	13(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L943
+	xorl	%edx, %edx
+	cmpb	$3, 13(%rax,%r14)
+	sete	%dl
+	addq	%rdx, %rdi
+	leaq	14(%rax), %rdx
+	cmpq	%r13, %rdx
+	jnb	.L943
+	cmpb	$3, 14(%rax,%r14)
+	sete	%al
+	movzbl	%al, %eax
+	addq	%rax, %rdi
+	cmpq	$14, %rbx
+	jbe	.L951
+	movdqa	.LC36(%rip), %xmm5
+	movdqa	.LC53(%rip), %xmm8
+	.p2align 4,,10
+	.p2align 3
+.L949:
+	movq	%r13, %rdx
+	pxor	%xmm1, %xmm1
+	pxor	%xmm7, %xmm7
+	movq	%r14, %rax
+	andq	$-16, %rdx
+	pxor	%xmm6, %xmm6
+	pxor	%xmm4, %xmm4
+	addq	%r14, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L955:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqb	%xmm8, %xmm0
+	pand	%xmm5, %xmm0
+	movdqa	%xmm0, %xmm3
+	punpckhbw	%xmm7, %xmm0
+	punpcklbw	%xmm7, %xmm3
+	movdqa	%xmm0, %xmm9
+	punpckhwd	%xmm6, %xmm0
+	movdqa	%xmm3, %xmm2
+	punpckhwd	%xmm6, %xmm3
+	punpcklwd	%xmm6, %xmm9
+	punpcklwd	%xmm6, %xmm2
+	movdqa	%xmm2, %xmm10
+	punpckldq	%xmm4, %xmm2
+	punpckhdq	%xmm4, %xmm10
+	paddq	%xmm10, %xmm2
+	movdqa	%xmm3, %xmm10
+	punpckldq	%xmm4, %xmm3
+	punpckhdq	%xmm4, %xmm10
+	paddq	%xmm10, %xmm3
+	paddq	%xmm3, %xmm2
+	movdqa	%xmm9, %xmm3
+	punpckldq	%xmm4, %xmm9
+	punpckhdq	%xmm4, %xmm3
+	paddq	%xmm3, %xmm9
+	movdqa	%xmm0, %xmm3
+	punpckhdq	%xmm4, %xmm0
+	punpckldq	%xmm4, %xmm3
+	paddq	%xmm1, %xmm0
+	paddq	%xmm3, %xmm9
+	paddq	%xmm9, %xmm2
+	movdqa	%xmm2, %xmm1
+	paddq	%xmm0, %xmm1
+	cmpq	%rax, %rdx
+	jne	.L955
+	movdqa	%xmm1, %xmm0
+	movq	%r13, %rdx
+	psrldq	$8, %xmm0
+	andq	$-16, %rdx
+	paddq	%xmm0, %xmm1
+	movq	%xmm1, %rax
+	testb	$15, %r13b
+	je	.L953
+.L954:
+	xorl	%ecx, %ecx
+	cmpb	$3, (%r14,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	1(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L953
+	xorl	%ecx, %ecx
+	cmpb	$3, 1(%rdx,%r14)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	2(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L953
+.L968:
+	cmpb	$3, (%r14,%rcx)
+	sete	%cl
+	movzbl	%cl, %ecx
+	addq	%rcx, %rax
+	leaq	3(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L953
+	xorl	%ecx, %ecx
+	cmpb	$3, 3(%rdx,%r14)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	4(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L953
+	xorl	%ecx, %ecx
+	cmpb	$3, 4(%rdx,%r14)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	5(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L953
+	xorl	%ecx, %ecx
+	cmpb	$3, 5(%rdx,%r14)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	6(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L953
+	xorl	%ecx, %ecx
+	cmpb	$3, 6(%rdx,%r14)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	7(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L953
+	xorl	%ecx, %ecx
+	cmpb	$3, 7(%rdx,%r14)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	8(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L953
+	xorl	%ecx, %ecx
+	cmpb	$3, 8(%rdx,%r14)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	9(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L953
+	xorl	%ecx, %ecx
+	cmpb	$3, 9(%rdx,%r14)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	10(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L953
+	xorl	%ecx, %ecx
+	cmpb	$3, 10(%rdx,%r14)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	11(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L953
+	xorl	%ecx, %ecx
+	cmpb	$3, 11(%rdx,%r14)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	12(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L953
+	xorl	%ecx, %ecx
+	cmpb	$3, 12(%rdx,%r14)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	13(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L953
+	xorl	%ecx, %ecx
+	cmpb	$3, 13(%rdx,%r14)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	14(%rdx), %rcx
+	cmpq	%r13, %rcx
+	jnb	.L953
+	cmpb	$3, 14(%rdx,%r14)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+	.p2align 4,,10
+	.p2align 3
+.L953:
+	cmpq	%rdi, %rax
+	jne	.L1023
+	movl	%ebp, %edx
+	movq	%r13, %rsi
+	movq	%r14, %rdi
+	call	_ZN1n9simd_findIhEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	$-1, %rax
+	jne	.L959
+	movdqa	.LC53(%rip), %xmm11
+	testq	%r13, %r13
+	jne	.L1024
+.L960:
+	movl	$7, %r13d
+	addq	$7, %rbx
+.L963:
+	cmpq	$14, %rbx
+	jbe	.L1025
+	movq	%r13, %rdx
+	movq	%r14, %rax
+	movdqa	.LC42(%rip), %xmm3
+	movdqa	.LC43(%rip), %xmm15
+	andq	$-16, %rdx
+	movdqa	.LC44(%rip), %xmm14
+	movdqa	.LC45(%rip), %xmm13
+	movdqa	.LC46(%rip), %xmm12
+	addq	%r14, %rdx
+	movdqa	.LC47(%rip), %xmm10
+	movdqa	.LC51(%rip), %xmm7
+	movdqa	.LC52(%rip), %xmm6
+	movdqa	.LC48(%rip), %xmm9
+	movdqa	.LC36(%rip), %xmm5
+	movdqa	.LC49(%rip), %xmm8
+	.p2align 4,,10
+	.p2align 3
+.L914:
+	movdqa	%xmm3, %xmm4
+	addq	$16, %rax
+	paddq	%xmm15, %xmm3
+	movdqa	%xmm4, %xmm1
+	movdqa	%xmm4, %xmm0
+	movdqa	%xmm4, %xmm2
+	paddq	%xmm14, %xmm1
+	paddq	%xmm12, %xmm2
+	shufps	$136, %xmm1, %xmm0
+	movdqa	%xmm4, %xmm1
+	paddq	%xmm13, %xmm1
+	shufps	$136, %xmm2, %xmm1
+	movdqa	%xmm0, %xmm2
+	punpcklwd	%xmm1, %xmm0
+	punpckhwd	%xmm1, %xmm2
+	movdqa	%xmm0, %xmm1
+	punpckhwd	%xmm2, %xmm1
+	punpcklwd	%xmm2, %xmm0
+	movdqa	%xmm4, %xmm2
+	punpcklwd	%xmm1, %xmm0
+	movdqa	%xmm4, %xmm1
+	paddq	%xmm9, %xmm2
+	paddq	%xmm10, %xmm1
+	shufps	$136, %xmm2, %xmm1
+	movdqa	%xmm4, %xmm2
+	paddq	.LC50(%rip), %xmm4
+	paddq	%xmm8, %xmm2
+	shufps	$136, %xmm4, %xmm2
+	movdqa	%xmm1, %xmm4
+	punpcklwd	%xmm2, %xmm1
+	punpckhwd	%xmm2, %xmm4
+	movdqa	%xmm1, %xmm2
+	punpckhwd	%xmm4, %xmm2
+	punpcklwd	%xmm4, %xmm1
+	punpcklwd	%xmm2, %xmm1
+	movdqa	%xmm0, %xmm2
+	pmulhuw	%xmm7, %xmm2
+	psrlw	$2, %xmm2
+	movdqa	%xmm2, %xmm4
+	psllw	$2, %xmm4
+	paddw	%xmm4, %xmm2
+	psubw	%xmm2, %xmm0
+	movdqa	%xmm1, %xmm2
+	pmulhuw	%xmm7, %xmm2
+	pand	%xmm6, %xmm0
+	psrlw	$2, %xmm2
+	movdqa	%xmm2, %xmm4
+	psllw	$2, %xmm4
+	paddw	%xmm4, %xmm2
+	psubw	%xmm2, %xmm1
+	pand	%xmm6, %xmm1
+	packuswb	%xmm1, %xmm0
+	paddb	%xmm5, %xmm0
+	movups	%xmm0, -16(%rax)
+	cmpq	%rax, %rdx
+	jne	.L914
+	movq	%r13, %rcx
+	andq	$-16, %rcx
+	testb	$15, %r13b
+	je	.L912
+	movq	%rcx, %rax
+	leaq	1(%rcx), %r8
+	movabsq	$-3689348814741910323, %rdi
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	movq	%rcx, %rax
+	subq	%rdx, %rax
+	addl	$1, %eax
+	movb	%al, (%r14,%rcx)
+	cmpq	%r13, %r8
+	jnb	.L912
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	subq	%rdx, %r8
+	addl	$1, %r8d
+	movb	%r8b, 1(%rcx,%r14)
+	leaq	2(%rcx), %r8
+	cmpq	%r13, %r8
+	jnb	.L912
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rdi
+	movq	%rdx, %rax
+	shrq	$2, %rax
+	andq	$-4, %rdi
+	leaq	(%rdi,%rax), %rdx
+	subq	%rdx, %r8
+	addl	$1, %r8d
+	movb	%r8b, 2(%rcx,%r14)
+	leaq	3(%rcx), %r8
+	cmpq	%r13, %r8
+	jnb	.L912
+.L913:
+	movabsq	$-3689348814741910323, %rdi
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	movq	%r8, %rax
+	subq	%rdx, %rax
+	addl	$1, %eax
+	movb	%al, (%r14,%r8)
+	leaq	4(%rcx), %r8
+	cmpq	%r13, %r8
+	jnb	.L912
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	subq	%rdx, %r8
+	addl	$1, %r8d
+	movb	%r8b, 4(%rcx,%r14)
+	leaq	5(%rcx), %r8
+	cmpq	%r13, %r8
+	jnb	.L912
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	subq	%rdx, %r8
+	addl	$1, %r8d
+	movb	%r8b, 5(%rcx,%r14)
+	leaq	6(%rcx), %r8
+	cmpq	%r13, %r8
+	jnb	.L912
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	subq	%rdx, %r8
+	addl	$1, %r8d
+	movb	%r8b, 6(%rcx,%r14)
+	leaq	7(%rcx), %r8
+	cmpq	%r13, %r8
+	jnb	.L912
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	subq	%rdx, %r8
+	addl	$1, %r8d
+	movb	%r8b, 7(%rcx,%r14)
+	leaq	8(%rcx), %r8
+	cmpq	%r13, %r8
+	jnb	.L912
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	subq	%rdx, %r8
+	addl	$1, %r8d
+	movb	%r8b, 8(%rcx,%r14)
+	leaq	9(%rcx), %r8
+	cmpq	%r13, %r8
+	jnb	.L912
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	subq	%rdx, %r8
+	addl	$1, %r8d
+	movb	%r8b, 9(%rcx,%r14)
+	leaq	10(%rcx), %r8
+	cmpq	%r13, %r8
+	jnb	.L912
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rdx, %rax
+	subq	%rax, %r8
+	leal	1(%r8), %eax
+	leaq	11(%rcx), %r8
+	movb	%al, 10(%rcx,%r14)
+	cmpq	%r13, %r8
+	jnb	.L912
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rdx, %rax
+	subq	%rax, %r8
+	leal	1(%r8), %eax
+	leaq	12(%rcx), %r8
+	movb	%al, 11(%rcx,%r14)
+	cmpq	%r13, %r8
+	jnb	.L912
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rdi
+	movq	%rdx, %rax
+	shrq	$2, %rax
+	andq	$-4, %rdi
+	leaq	(%rdi,%rax), %rdx
+	subq	%rdx, %r8
+	leal	1(%r8), %eax
+	leaq	13(%rcx), %r8
+	movb	%al, 12(%rcx,%r14)
+	cmpq	%r13, %r8
+	jnb	.L912
+	movabsq	$-3689348814741910323, %rdi
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rdx, %rax
+	subq	%rax, %r8
+	leal	1(%r8), %eax
+	leaq	14(%rcx), %r8
+	movb	%al, 13(%rcx,%r14)
+	cmpq	%r13, %r8
+	jnb	.L912
+	movq	%r8, %rax
+	mulq	%rdi
+	movq	%rdx, %rdi
+	movq	%rdx, %rax
+	shrq	$2, %rax
+	andq	$-4, %rdi
+	addq	%rdi, %rax
+	subq	%rax, %r8
+	leal	1(%r8), %eax
+	movb	%al, 14(%rcx,%r14)
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	jne	.L917
+	.p2align 4,,10
+	.p2align 3
+.L1018:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r15
+	movq	%r15, %rdi
+	call	__cxa_guard_acquire@PLT
+	movdqa	.LC53(%rip), %xmm11
+	testl	%eax, %eax
+	je	.L917
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L969
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L919:
+	movq	%r15, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	movl	%ebp, %eax
+	movdqa	.LC53(%rip), %xmm11
+	jl	.L921
+.L978:
+	.p2align 4,,10
+	.p2align 3
+.L1019:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1026
+.L924:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %eax
+	cmpl	$2, %eax
+	jne	.L1027
+.L928:
+	movq	%r14, %rdi
+	movl	$3, %edx
+	movq	%r13, %rsi
+	call	_ZN1n12__avx2_countIhEEmPKT_mS1_
+	movdqa	.LC53(%rip), %xmm11
+	movq	%rax, %rdi
+	testq	%r13, %r13
+	je	.L976
+.L943:
+	cmpq	$14, %rbx
+	jbe	.L977
+	movdqa	.LC36(%rip), %xmm5
+	movdqa	%xmm11, %xmm8
+	jmp	.L949
+	.p2align 4,,10
+	.p2align 3
+.L1024:
+	movb	$9, (%r14,%rbx)
+	movl	%ebp, %edx
+	movq	%r13, %rsi
+	movq	%r14, %rdi
+	call	_ZN1n9simd_findIhEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	%rbx, %rax
+	jne	.L1028
+	movq	%r13, %r15
+	movl	%ebp, %edx
+	movq	%r13, %rsi
+	movq	%r14, %rdi
+	shrq	%r15
+	movb	$9, (%r14,%r15)
+	call	_ZN1n9simd_findIhEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	movdqa	.LC53(%rip), %xmm11
+	cmpq	%rax, %r15
+	jne	.L1029
+	addq	$7, %r13
+	addq	$7, %rbx
+	cmpq	$301, %r13
+	jne	.L963
+	addq	$1, %r12
+	cmpq	$8, %r12
+	jne	.L967
+	addq	$344, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L929:
+	.cfi_restore_state
+	movq	%r14, %rdi
+	movl	$3, %edx
+	movq	%r13, %rsi
+	call	_ZN1n14__avx512_countIhEEmPKT_mS1_
+	movdqa	.LC53(%rip), %xmm11
+	movq	%rax, %rdi
+.L935:
+	testq	%r13, %r13
+	jne	.L943
+.L976:
+	xorl	%eax, %eax
+	jmp	.L953
+	.p2align 4,,10
+	.p2align 3
+.L1020:
+	xorl	%edi, %edi
+	xorl	%edx, %edx
+	movl	$16, %r10d
+	xorl	%r9d, %r9d
+	pxor	%xmm3, %xmm3
+	cmpq	$15, %r13
+	jbe	.L1030
+	.p2align 4,,10
+	.p2align 3
+.L931:
+	movq	%r13, %rax
+	movl	$255, %ecx
+	subq	%rdx, %rax
+	movq	%rax, %r8
+	shrq	$4, %r8
+	cmpq	%rcx, %r8
+	cmovbe	%r8, %rcx
+	testq	%r8, %r8
+	je	.L936
+	addq	%r14, %rdx
+	pxor	%xmm2, %xmm2
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L937:
+	movdqu	(%rdx), %xmm0
+	movdqa	%xmm2, %xmm1
+	addq	$1, %rax
+	addq	$16, %rdx
+	pcmpeqb	%xmm11, %xmm0
+	psubb	%xmm0, %xmm1
+	movdqa	%xmm1, %xmm2
+	cmpq	%rcx, %rax
+	jb	.L937
+	subq	$1, %rcx
+	psadbw	%xmm3, %xmm1
+	salq	$4, %rcx
+	testq	%r8, %r8
+	movhlps	%xmm1, %xmm5
+	cmove	%r9, %rcx
+	movq	%xmm5, %rax
+	leaq	(%rcx,%r10), %rdx
+	movq	%xmm1, %rcx
+	addq	%rcx, %rax
+	leaq	16(%rdx), %r10
+	addq	%rax, %rdi
+	cmpq	%r10, %r13
+	jnb	.L931
+	movq	%r13, %rax
+	subq	%rdx, %rax
+.L940:
+	testq	%rax, %rax
+	je	.L943
+	cmpq	$15, %rax
+	jbe	.L975
+	movq	8(%rsp), %rsi
+	leaq	(%r12,%rdx), %rcx
+	movq	%rax, %r8
+	pxor	%xmm2, %xmm2
+	pxor	%xmm7, %xmm7
+	pxor	%xmm6, %xmm6
+	pxor	%xmm4, %xmm4
+	andq	$-16, %r8
+	addq	%rsi, %rcx
+	movdqa	.LC36(%rip), %xmm5
+	movdqa	.LC53(%rip), %xmm8
+	addq	%rcx, %r8
+	.p2align 4,,10
+	.p2align 3
+.L944:
+	movdqu	(%rcx), %xmm0
+	addq	$16, %rcx
+	pcmpeqb	%xmm8, %xmm0
+	pand	%xmm5, %xmm0
+	movdqa	%xmm0, %xmm3
+	punpckhbw	%xmm7, %xmm0
+	punpcklbw	%xmm7, %xmm3
+	movdqa	%xmm0, %xmm9
+	punpckhwd	%xmm6, %xmm0
+	movdqa	%xmm3, %xmm1
+	punpckhwd	%xmm6, %xmm3
+	punpcklwd	%xmm6, %xmm9
+	punpcklwd	%xmm6, %xmm1
+	movdqa	%xmm1, %xmm10
+	punpckhdq	%xmm4, %xmm1
+	punpckldq	%xmm4, %xmm10
+	paddq	%xmm10, %xmm1
+	movdqa	%xmm3, %xmm10
+	punpckhdq	%xmm4, %xmm3
+	punpckldq	%xmm4, %xmm10
+	paddq	%xmm10, %xmm3
+	paddq	%xmm3, %xmm1
+	movdqa	%xmm9, %xmm3
+	punpckhdq	%xmm4, %xmm9
+	punpckldq	%xmm4, %xmm3
+	paddq	%xmm3, %xmm9
+	movdqa	%xmm0, %xmm3
+	punpckhdq	%xmm4, %xmm0
+	punpckldq	%xmm4, %xmm3
+	paddq	%xmm2, %xmm0
+	paddq	%xmm3, %xmm9
+	paddq	%xmm9, %xmm1
+	paddq	%xmm0, %xmm1
+	movdqa	%xmm1, %xmm2
+	cmpq	%rcx, %r8
+	jne	.L944
+	movdqa	%xmm1, %xmm0
+	movq	%rax, %r8
+	psrldq	$8, %xmm0
+	andq	$-16, %r8
+	paddq	%xmm0, %xmm2
+	movq	%xmm2, %rcx
+	testb	$15, %al
+	je	.L1031
+.L941:
+	addq	%r14, %rdx
+	xorl	%r9d, %r9d
+	cmpb	$3, (%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	1(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L945
+	xorl	%r9d, %r9d
+	cmpb	$3, 1(%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	2(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L945
+	xorl	%r9d, %r9d
+	cmpb	$3, 2(%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	3(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L945
+	xorl	%r9d, %r9d
+	cmpb	$3, 3(%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	4(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L945
+	xorl	%r9d, %r9d
+	cmpb	$3, 4(%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	5(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L945
+	xorl	%r9d, %r9d
+	cmpb	$3, 5(%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	6(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L945
+	xorl	%r9d, %r9d
+	cmpb	$3, 6(%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	7(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L945
+	xorl	%r9d, %r9d
+	cmpb	$3, 7(%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	8(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L945
+	xorl	%r9d, %r9d
+	cmpb	$3, 8(%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	9(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L945
+	xorl	%r9d, %r9d
+	cmpb	$3, 9(%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	10(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L945
+	xorl	%r9d, %r9d
+	cmpb	$3, 10(%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	11(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L945
+	xorl	%r9d, %r9d
+	cmpb	$3, 11(%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	12(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L945
+	xorl	%r9d, %r9d
+	cmpb	$3, 12(%rdx,%r8)
+	sete	%r9b
+	addq	%r9, %rcx
+	leaq	13(%r8), %r9
+	cmpq	%rax, %r9
+	jnb	.L945
+	xorl	%r9d, %r9d
+	cmpb	$3, 13(%rdx,%r8)
+	sete	%r9b
+	addq	$14, %r8
+	addq	%r9, %rcx
+	cmpq	%rax, %r8
+	jnb	.L945
+	xorl	%eax, %eax
+	cmpb	$3, (%rdx,%r8)
+	sete	%al
+	addq	%rax, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L945:
+	addq	%rcx, %rdi
+	jmp	.L935
+.L1026:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r15
+	movq	%r15, %rdi
+	call	__cxa_guard_acquire@PLT
+	movdqa	.LC53(%rip), %xmm11
+	testl	%eax, %eax
+	je	.L924
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L971
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L926:
+	movq	%r15, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	movdqa	.LC53(%rip), %xmm11
+	jmp	.L924
+.L1025:
+	movl	$513, %eax
+	movb	$3, 2(%r14)
+	xorl	%ecx, %ecx
+	movl	$3, %r8d
+	movw	%ax, (%r14)
+	jmp	.L913
+.L977:
+	xorl	%eax, %eax
+	xorl	%edx, %edx
+	jmp	.L954
+.L1021:
+	xorl	%esi, %esi
+	movl	%ebp, %edx
+	movq	%r14, %rdi
+	call	_ZN1n9simd_findIhEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	movdqa	.LC53(%rip), %xmm11
+	cmpq	$-1, %rax
+	jne	.L959
+	addq	$7, %rbx
+	movl	$7, %r13d
+	jmp	.L963
+.L1030:
+	movq	%r13, %rax
+	xorl	%ecx, %ecx
+	xorl	%r8d, %r8d
+	testq	%r13, %r13
+	jne	.L941
+	xorl	%esi, %esi
+	movl	%ebp, %edx
+	movq	%r14, %rdi
+	call	_ZN1n9simd_findIhEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	movdqa	.LC53(%rip), %xmm11
+	cmpq	$-1, %rax
+	je	.L960
+.L959:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC54(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L1022:
+	xorl	%edi, %edi
+	cmpb	$3, (%r14)
+	movl	$1, %edx
+	sete	%dil
+	xorl	%eax, %eax
+	jmp	.L947
+.L969:
+	movl	$3, %eax
+	jmp	.L919
+.L1031:
+	addq	%rcx, %rdi
+	jmp	.L943
+.L971:
+	movl	$3, %eax
+	jmp	.L926
+.L975:
+	xorl	%ecx, %ecx
+	xorl	%r8d, %r8d
+	jmp	.L941
+.L951:
+	xorl	%eax, %eax
+	cmpb	$3, (%r14)
+	movl	$2, %ecx
+	sete	%al
+	xorl	%edx, %edx
+	cmpb	$3, 1(%r14)
+	sete	%dl
+	addq	%rdx, %rax
+	xorl	%edx, %edx
+	jmp	.L968
+.L936:
+	cmpq	%r10, %r13
+	jb	.L1032
+.L939:
+	jmp	.L939
+.L1032:
+	pxor	%xmm0, %xmm0
+	psadbw	%xmm0, %xmm0
+	movhlps	%xmm0, %xmm5
+	movq	%xmm0, %r8
+	movq	%xmm5, %rcx
+	addq	%r8, %rcx
+	addq	%rcx, %rdi
+	jmp	.L940
+.L1029:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC57(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L1028:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC56(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L1023:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC55(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.cfi_endproc
+.LFE6785:
+	.size	_Z16check_find_countIhEvN1n8simd_isaE, .-_Z16check_find_countIhEvN1n8simd_isaE
+	.text
+	.p2align 4
+	.globl	_Z14test_simd_charv
+	.type	_Z14test_simd_charv, @function
+_Z14test_simd_charv:
+.LFB6723:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	xorl	%ebx, %ebx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	jmp	.L1034
+	.p2align 4,,10
+	.p2align 3
+.L1036:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebx
+	jg	.L1062
+.L1039:
+	movl	%ebx, %edi
+	addl	$1, %ebx
+	call	_Z16check_find_countIcEvN1n8simd_isaE
+.L1034:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	jne	.L1036
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1036
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1049
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1038:
+	movq	%rbp, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebx
+	jle	.L1039
+	.p2align 4,,10
+	.p2align 3
+.L1062:
+	xorl	%ebx, %ebx
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbp
+	jmp	.L1040
+	.p2align 4,,10
+	.p2align 3
+.L1043:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebx
+	jg	.L1063
+.L1053:
+.L1046:
+	movl	%ebx, %edi
+	addl	$1, %ebx
+	call	_Z16check_find_countIhEvN1n8simd_isaE
+.L1040:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	jne	.L1043
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1043
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1051
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1045:
+	movq	%rbp, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebx
+	jle	.L1046
+.L1063:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1049:
+	.cfi_restore_state
+	movl	$3, %eax
+	jmp	.L1038
+	.p2align 4,,10
+	.p2align 3
+.L1051:
+	movl	$3, %eax
+	jmp	.L1045
+.L1054:
+	.cfi_endproc
+.LFE6723:
+	.size	_Z14test_simd_charv, .-_Z14test_simd_charv
+	.section	.text._ZN1n14__avx512_countIsEEmPKT_mS1_,"axG",@progbits,_ZN1n14__avx512_countIsEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n14__avx512_countIsEEmPKT_mS1_
+	.type	_ZN1n14__avx512_countIsEEmPKT_mS1_, @function
+_ZN1n14__avx512_countIsEEmPKT_mS1_:
+.LFB6877:
+	.cfi_startproc
+	movq	%rsi, %r8
+	vpbroadcastw	%edx, %zmm3
+	movl	$32, %eax
+	xorl	%r9d, %r9d
+	cmpq	$31, %rsi
+	jbe	.L1087
+	.p2align 4,,10
+	.p2align 3
+.L1068:
+	vmovdqu16	-64(%rdi,%rax,2), %zmm6
+	vpcmpw	$0, %zmm3, %zmm6, %k0
+	kmovd	%k0, %ecx
+	popcntq	%rcx, %rcx
+	addq	%rcx, %r9
+	movq	%rax, %rcx
+	leaq	32(%rax), %rax
+	cmpq	%rax, %r8
+	jnb	.L1068
+	subq	%rcx, %r8
+	je	.L1064
+	leaq	-1(%r8), %rax
+	cmpq	$30, %rax
+	jbe	.L1074
+	movq	%r8, %rsi
+	leaq	(%rdi,%rcx,2), %rax
+	movl	$1, %r10d
+	shrq	$5, %rsi
+	vpxor	%xmm4, %xmm4, %xmm4
+	vpbroadcastw	%r10d, %zmm5
+	salq	$6, %rsi
+	addq	%rax, %rsi
+	.p2align 4,,10
+	.p2align 3
+.L1069:
+	vpcmpw	$0, (%rax), %zmm3, %k1
+	addq	$64, %rax
+	vmovdqu16	%zmm5, %zmm0{%k1}{z}
+	vpmovzxwd	%ymm0, %zmm1
+	vextracti64x4	$0x1, %zmm0, %ymm0
+	vpmovzxwd	%ymm0, %zmm0
+	vpmovzxdq	%ymm0, %zmm2
+	vextracti64x4	$0x1, %zmm0, %ymm0
+	vpmovzxdq	%ymm0, %zmm0
+	vpaddq	%zmm0, %zmm2, %zmm2
+	vpmovzxdq	%ymm1, %zmm0
+	vextracti64x4	$0x1, %zmm1, %ymm1
+	vpmovzxdq	%ymm1, %zmm1
+	vpaddq	%zmm1, %zmm0, %zmm0
+	vpaddq	%zmm0, %zmm2, %zmm2
+	vpaddq	%zmm2, %zmm4, %zmm4
+	cmpq	%rax, %rsi
+	jne	.L1069
+	vmovdqa	%ymm4, %ymm3
+	vextracti64x4	$0x1, %zmm4, %ymm4
+	movq	%r8, %rsi
+	vpaddq	%ymm4, %ymm3, %ymm3
+	andq	$-32, %rsi
+	vextracti128	$0x1, %ymm3, %xmm1
+	vpaddq	%xmm1, %xmm3, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rax
+	testb	$31, %r8b
+	je	.L1070
+.L1066:
+	movq	%r8, %r10
+	subq	%rsi, %r10
+	leaq	-1(%r10), %r11
+	cmpq	$14, %r11
+	jbe	.L1071
+	vmovd	%edx, %xmm0
+	leaq	(%rsi,%rcx), %rax
+	movq	%r10, %r11
+	vpbroadcastw	%xmm0, %ymm0
+	andq	$-16, %r11
+	vpcmpeqw	(%rdi,%rax,2), %ymm0, %ymm0
+	movl	$1, %eax
+	addq	%r11, %rsi
+	andl	$15, %r10d
+	vmovd	%eax, %xmm1
+	vpbroadcastw	%xmm1, %ymm1
+	vpand	%ymm1, %ymm0, %ymm0
+	vpmovzxwd	%xmm0, %ymm2
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxwd	%xmm0, %ymm0
+	vpmovzxdq	%xmm0, %ymm1
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxdq	%xmm0, %ymm0
+	vpaddq	%ymm0, %ymm1, %ymm0
+	vpmovzxdq	%xmm2, %ymm1
+	vextracti128	$0x1, %ymm2, %xmm2
+	vpmovzxdq	%xmm2, %ymm2
+	vpaddq	%ymm2, %ymm1, %ymm1
+	vpaddq	%ymm1, %ymm0, %ymm0
+	vpaddq	%ymm3, %ymm0, %ymm0
+	vmovdqa	%xmm0, %xmm1
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpaddq	%xmm0, %xmm1, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rax
+	je	.L1070
+.L1071:
+	leaq	(%rsi,%rcx), %r10
+	cmpw	%dx, (%rdi,%r10,2)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	1(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1070
+	addq	%rcx, %r10
+	cmpw	%dx, (%rdi,%r10,2)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	2(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1070
+	addq	%rcx, %r10
+	cmpw	%dx, (%rdi,%r10,2)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	3(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1070
+	addq	%rcx, %r10
+	cmpw	%dx, (%rdi,%r10,2)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	4(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1070
+	addq	%rcx, %r10
+	cmpw	%dx, (%rdi,%r10,2)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	5(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1070
+	addq	%rcx, %r10
+	cmpw	%dx, (%rdi,%r10,2)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	6(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1070
+	addq	%rcx, %r10
+	cmpw	%dx, (%rdi,%r10,2)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	7(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1070
+	addq	%rcx, %r10
+	cmpw	%dx, (%rdi,%r10,2)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	8(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1070
+	addq	%rcx, %r10
+	cmpw	%dx, (%rdi,%r10,2)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	9(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1070
+	addq	%rcx, %r10
+	cmpw	%dx, (%rdi,%r10,2)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	10(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1070
+	addq	%rcx, %r10
+	cmpw	%dx, (%rdi,%r10,2)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	11(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1070
+	addq	%rcx, %r10
+	cmpw	%dx, (%rdi,%r10,2)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	12(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1070
+	addq	%rcx, %r10
+	cmpw	%dx, (%rdi,%r10,2)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	13(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1070
+	addq	%rcx, %r10
+	cmpw	%dx, (%rdi,%r10,2)
+	sete	%r10b
+	addq	$14, %rsi
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	cmpq	%r8, %rsi
+	jnb	.L1070
+	addq	%rsi, %rcx
+	cmpw	%dx, (%rdi,%rcx,2)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+	.p2align 4,,10
+	.p2align 3
+.L1070:
+	addq	%rax, %r9
+.L1064:
+	movq	%r9, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1087:
+	testq	%rsi, %rsi
+	je	.L1064
+	xorl	%ecx, %ecx
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%eax, %eax
+	xorl	%esi, %esi
+	jmp	.L1066
+.L1074:
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%eax, %eax
+	xorl	%esi, %esi
+	jmp	.L1066
+	.cfi_endproc
+.LFE6877:
+	.size	_ZN1n14__avx512_countIsEEmPKT_mS1_, .-_ZN1n14__avx512_countIsEEmPKT_mS1_
+	.section	.text._ZN1n12__avx2_countIsEEmPKT_mS1_,"axG",@progbits,_ZN1n12__avx2_countIsEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n12__avx2_countIsEEmPKT_mS1_
+	.type	_ZN1n12__avx2_countIsEEmPKT_mS1_, @function
+_ZN1n12__avx2_countIsEEmPKT_mS1_:
+.LFB6878:
+	.cfi_startproc
+	vmovd	%edx, %xmm3
+	movq	%rdi, %r8
+	movl	%edx, %r9d
+	xorl	%edi, %edi
+	vpbroadcastw	%xmm3, %ymm3
+	movl	$16, %edx
+	cmpq	$15, %rsi
+	jbe	.L1111
+	.p2align 4,,10
+	.p2align 3
+.L1089:
+	vpcmpeqw	-32(%r8,%rdx,2), %ymm3, %ymm0
+	movq	%rdx, %rcx
+	leaq	16(%rdx), %rdx
+	vpmovmskb	%ymm0, %eax
+	popcntl	%eax, %eax
+	shrq	%rax
+	addq	%rax, %rdi
+	cmpq	%rdx, %rsi
+	jnb	.L1089
+	subq	%rcx, %rsi
+	je	.L1088
+	leaq	-1(%rsi), %rax
+	cmpq	$14, %rax
+	jbe	.L1098
+	movq	%rsi, %rdx
+	movl	$1, %r10d
+	leaq	(%r8,%rcx,2), %rax
+	shrq	$4, %rdx
+	vmovd	%r10d, %xmm5
+	vpxor	%xmm4, %xmm4, %xmm4
+	salq	$5, %rdx
+	vpbroadcastw	%xmm5, %ymm5
+	addq	%rax, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L1092:
+	vpcmpeqw	(%rax), %ymm3, %ymm0
+	addq	$32, %rax
+	vpand	%ymm5, %ymm0, %ymm0
+	vpmovzxwd	%xmm0, %ymm1
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxdq	%xmm1, %ymm2
+	vextracti128	$0x1, %ymm1, %xmm1
+	vpmovzxwd	%xmm0, %ymm0
+	vpmovzxdq	%xmm1, %ymm1
+	vpaddq	%ymm1, %ymm2, %ymm1
+	vpmovzxdq	%xmm0, %ymm2
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxdq	%xmm0, %ymm0
+	vpaddq	%ymm0, %ymm2, %ymm0
+	vpaddq	%ymm0, %ymm1, %ymm0
+	vpaddq	%ymm0, %ymm4, %ymm4
+	cmpq	%rax, %rdx
+	jne	.L1092
+	vmovdqa	%xmm4, %xmm3
+	vextracti128	$0x1, %ymm4, %xmm4
+	movq	%rsi, %rdx
+	vpaddq	%xmm4, %xmm3, %xmm3
+	andq	$-16, %rdx
+	vpsrldq	$8, %xmm3, %xmm0
+	vpaddq	%xmm0, %xmm3, %xmm0
+	vmovq	%xmm0, %rax
+	testb	$15, %sil
+	je	.L1093
+.L1090:
+	movq	%rsi, %r10
+	subq	%rdx, %r10
+	leaq	-1(%r10), %r11
+	cmpq	$6, %r11
+	jbe	.L1094
+	vmovd	%r9d, %xmm0
+	leaq	(%rdx,%rcx), %rax
+	movq	%r10, %r11
+	vpbroadcastw	%xmm0, %xmm0
+	andq	$-8, %r11
+	vpcmpeqw	(%r8,%rax,2), %xmm0, %xmm0
+	movl	$1, %eax
+	addq	%r11, %rdx
+	andl	$7, %r10d
+	vmovd	%eax, %xmm1
+	vpbroadcastw	%xmm1, %xmm1
+	vpand	%xmm1, %xmm0, %xmm0
+	vpmovzxwd	%xmm0, %xmm2
+	vpsrldq	$8, %xmm0, %xmm0
+	vpmovzxwd	%xmm0, %xmm0
+	vpmovzxdq	%xmm0, %xmm1
+	vpsrldq	$8, %xmm0, %xmm0
+	vpmovzxdq	%xmm0, %xmm0
+	vpaddq	%xmm0, %xmm1, %xmm0
+	vpmovzxdq	%xmm2, %xmm1
+	vpsrldq	$8, %xmm2, %xmm2
+	vpmovzxdq	%xmm2, %xmm2
+	vpaddq	%xmm2, %xmm1, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vpaddq	%xmm3, %xmm0, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rax
+	je	.L1093
+.L1094:
+	leaq	(%rdx,%rcx), %r10
+	cmpw	%r9w, (%r8,%r10,2)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	1(%rdx), %r10
+	cmpq	%rsi, %r10
+	jnb	.L1093
+	addq	%rcx, %r10
+	cmpw	%r9w, (%r8,%r10,2)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	2(%rdx), %r10
+	cmpq	%rsi, %r10
+	jnb	.L1093
+	addq	%rcx, %r10
+	cmpw	%r9w, (%r8,%r10,2)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	3(%rdx), %r10
+	cmpq	%rsi, %r10
+	jnb	.L1093
+	addq	%rcx, %r10
+	cmpw	%r9w, (%r8,%r10,2)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	4(%rdx), %r10
+	cmpq	%rsi, %r10
+	jnb	.L1093
+	addq	%rcx, %r10
+	cmpw	%r9w, (%r8,%r10,2)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	5(%rdx), %r10
+	cmpq	%rsi, %r10
+	jnb	.L1093
+	addq	%rcx, %r10
+	cmpw	%r9w, (%r8,%r10,2)
+	sete	%r10b
+	addq	$6, %rdx
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	cmpq	%rsi, %rdx
+	jnb	.L1093
+	addq	%rcx, %rdx
+	cmpw	%r9w, (%r8,%rdx,2)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+.L1093:
+	addq	%rax, %rdi
+.L1088:
+	movq	%rdi, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1111:
+	testq	%rsi, %rsi
+	je	.L1088
+	xorl	%ecx, %ecx
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%eax, %eax
+	xorl	%edx, %edx
+	jmp	.L1090
+.L1098:
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%eax, %eax
+	xorl	%edx, %edx
+	jmp	.L1090
+	.cfi_endproc
+.LFE6878:
+	.size	_ZN1n12__avx2_countIsEEmPKT_mS1_, .-_ZN1n12__avx2_countIsEEmPKT_mS1_
+	.section	.text._ZN1n13__avx512_findIsEEmPKT_mS1_,"axG",@progbits,_ZN1n13__avx512_findIsEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n13__avx512_findIsEEmPKT_mS1_
+	.type	_ZN1n13__avx512_findIsEEmPKT_mS1_, @function
+_ZN1n13__avx512_findIsEEmPKT_mS1_:
+.LFB6880:
+	.cfi_startproc
+	movl	%edx, %ecx
+	vpbroadcastw	%edx, %zmm0
+	xorl	%edx, %edx
+	jmp	.L1113
+	.p2align 4,,10
+	.p2align 3
+.L1115:
+	vmovdqu16	-64(%rdi,%rdx,2), %zmm1
+	vpcmpw	$0, %zmm0, %zmm1, %k0
+	kortestq	%k0, %k0
+	jne	.L1122
+.L1113:
+	movq	%rdx, %rax
+	leaq	32(%rdx), %rdx
+	cmpq	%rdx, %rsi
+	jnb	.L1115
+	subq	%rax, %rsi
+	je	.L1118
+	leaq	(%rdi,%rax,2), %rdi
+	xorl	%edx, %edx
+	jmp	.L1117
+	.p2align 4,,10
+	.p2align 3
+.L1123:
+	addq	$1, %rdx
+	cmpq	%rdx, %rsi
+	je	.L1118
+.L1117:
+	cmpw	(%rdi,%rdx,2), %cx
+	jne	.L1123
+	addq	%rdx, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1118:
+	movq	$-1, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1122:
+	xorl	%edx, %edx
+	kmovq	%k0, %rcx
+	rep bsfq	%rcx, %rdx
+	movslq	%edx, %rdx
+	addq	%rdx, %rax
+	vzeroupper
+	ret
+	.cfi_endproc
+.LFE6880:
+	.size	_ZN1n13__avx512_findIsEEmPKT_mS1_, .-_ZN1n13__avx512_findIsEEmPKT_mS1_
+	.section	.text._ZN1n11__avx2_findIsEEmPKT_mS1_,"axG",@progbits,_ZN1n11__avx2_findIsEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n11__avx2_findIsEEmPKT_mS1_
+	.type	_ZN1n11__avx2_findIsEEmPKT_mS1_, @function
+_ZN1n11__avx2_findIsEEmPKT_mS1_:
+.LFB6881:
+	.cfi_startproc
+	vmovd	%edx, %xmm1
+	movl	%edx, %r8d
+	xorl	%eax, %eax
+	vpbroadcastw	%xmm1, %ymm1
+	jmp	.L1125
+	.p2align 4,,10
+	.p2align 3
+.L1127:
+	vpcmpeqw	-128(%rdi,%rax,2), %ymm1, %ymm2
+	vpcmpeqw	-96(%rdi,%rax,2), %ymm1, %ymm0
+	vpcmpeqw	-64(%rdi,%rax,2), %ymm1, %ymm3
+	vpor	%ymm2, %ymm0, %ymm0
+	vpcmpeqw	-32(%rdi,%rax,2), %ymm1, %ymm2
+	vpor	%ymm3, %ymm2, %ymm2
+	vpor	%ymm2, %ymm0, %ymm0
+	vptest	%ymm0, %ymm0
+	jne	.L1128
+.L1125:
+	movq	%rax, %rdx
+	addq	$64, %rax
+	cmpq	%rax, %rsi
+	jnb	.L1127
+	movq	%rdx, %rax
+	leaq	16(%rdx), %rdx
+	cmpq	%rdx, %rsi
+	jb	.L1140
+	.p2align 4,,10
+	.p2align 3
+.L1130:
+	vpcmpeqw	-32(%rdi,%rdx,2), %ymm1, %ymm0
+	vpmovmskb	%ymm0, %ecx
+	testl	%ecx, %ecx
+	jne	.L1141
+.L1128:
+	movq	%rdx, %rax
+	leaq	16(%rdx), %rdx
+	cmpq	%rdx, %rsi
+	jnb	.L1130
+.L1140:
+	subq	%rax, %rsi
+	je	.L1133
+	leaq	(%rdi,%rax,2), %rcx
+	xorl	%edx, %edx
+	jmp	.L1132
+	.p2align 4,,10
+	.p2align 3
+.L1142:
+	addq	$1, %rdx
+	cmpq	%rdx, %rsi
+	je	.L1133
+.L1132:
+	cmpw	(%rcx,%rdx,2), %r8w
+	jne	.L1142
+	addq	%rdx, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1133:
+	movq	$-1, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1141:
+	rep bsfl	%ecx, %ecx
+	movslq	%ecx, %rcx
+	shrq	%rcx
+	addq	%rcx, %rax
+	vzeroupper
+	ret
+	.cfi_endproc
+.LFE6881:
+	.size	_ZN1n11__avx2_findIsEEmPKT_mS1_, .-_ZN1n11__avx2_findIsEEmPKT_mS1_
+	.section	.text._ZN1n9simd_findIsEEmPKT_mS1_NS_8simd_isaE.constprop.0,"axG",@progbits,_Z16check_find_countIsEvN1n8simd_isaE,comdat
+	.p2align 4
+	.type	_ZN1n9simd_findIsEEmPKT_mS1_NS_8simd_isaE.constprop.0, @function
+_ZN1n9simd_findIsEEmPKT_mS1_NS_8simd_isaE.constprop.0:
+.LFB6985:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movl	%edx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1189
+.L1145:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	jge	.L1190
+.L1175:
+	cmpl	$2, %r12d
+	je	.L1156
+.L1195:
+	cmpl	$3, %r12d
+	je	.L1157
+	xorl	%eax, %eax
+	cmpl	$1, %r12d
+	je	.L1171
+	testq	%rbp, %rbp
+	jne	.L1159
+.L1173:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	$-1, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1191:
+	.cfi_restore_state
+	addq	$1, %rax
+	cmpq	%rax, %rbp
+	je	.L1173
+.L1159:
+	cmpw	$9, (%rbx,%rax,2)
+	jne	.L1191
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1171:
+	.cfi_restore_state
+	movdqa	.LC62(%rip), %xmm2
+	jmp	.L1158
+	.p2align 4,,10
+	.p2align 3
+.L1162:
+	movdqu	-64(%rbx,%rax,2), %xmm0
+	movdqu	-48(%rbx,%rax,2), %xmm1
+	movdqu	-16(%rbx,%rax,2), %xmm3
+	pcmpeqw	%xmm2, %xmm1
+	pcmpeqw	%xmm2, %xmm0
+	pcmpeqw	%xmm2, %xmm3
+	por	%xmm1, %xmm0
+	movdqu	-32(%rbx,%rax,2), %xmm1
+	pcmpeqw	%xmm2, %xmm1
+	por	%xmm3, %xmm1
+	por	%xmm1, %xmm0
+	pmovmskb	%xmm0, %ecx
+	testl	%ecx, %ecx
+	jne	.L1161
+.L1158:
+	movq	%rax, %rdx
+	addq	$32, %rax
+	cmpq	%rax, %rbp
+	jnb	.L1162
+.L1161:
+	movdqa	.LC62(%rip), %xmm1
+	jmp	.L1163
+	.p2align 4,,10
+	.p2align 3
+.L1164:
+	movdqu	-16(%rbx,%rdx,2), %xmm0
+	pcmpeqw	%xmm1, %xmm0
+	pmovmskb	%xmm0, %ecx
+	testl	%ecx, %ecx
+	jne	.L1192
+.L1163:
+	movq	%rdx, %rax
+	leaq	8(%rdx), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L1164
+	subq	%rax, %rbp
+	je	.L1173
+	leaq	(%rbx,%rax,2), %rcx
+	xorl	%edx, %edx
+	jmp	.L1166
+	.p2align 4,,10
+	.p2align 3
+.L1193:
+	addq	$1, %rdx
+	cmpq	%rdx, %rbp
+	je	.L1173
+.L1166:
+	cmpw	$9, (%rcx,%rdx,2)
+	jne	.L1193
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	addq	%rdx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.L1174:
+	.p2align 4,,10
+	.p2align 3
+.L1190:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1194
+.L1152:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	cmpl	$2, %r12d
+	jne	.L1195
+.L1156:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movl	$9, %edx
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n11__avx2_findIsEEmPKT_mS1_
+	.p2align 4,,10
+	.p2align 3
+.L1189:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1145
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1167
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1147:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1145
+	.p2align 4,,10
+	.p2align 3
+.L1157:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movl	$9, %edx
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n13__avx512_findIsEEmPKT_mS1_
+	.p2align 4,,10
+	.p2align 3
+.L1192:
+	.cfi_restore_state
+	rep bsfl	%ecx, %ecx
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movslq	%ecx, %rcx
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	shrq	%rcx
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	addq	%rcx, %rax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1194:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1152
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1169
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1154:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1152
+.L1169:
+	movl	$3, %eax
+	jmp	.L1154
+.L1167:
+	movl	$3, %eax
+	jmp	.L1147
+	.cfi_endproc
+.LFE6985:
+	.size	_ZN1n9simd_findIsEEmPKT_mS1_NS_8simd_isaE.constprop.0, .-_ZN1n9simd_findIsEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	.globl	__popcountdi2
+	.section	.text._Z16check_find_countIsEvN1n8simd_isaE,"axG",@progbits,_Z16check_find_countIsEvN1n8simd_isaE,comdat
+	.p2align 4
+	.weak	_Z16check_find_countIsEvN1n8simd_isaE
+	.type	_Z16check_find_countIsEvN1n8simd_isaE, @function
+_Z16check_find_countIsEvN1n8simd_isaE:
+.LFB6786:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	movl	$77, %ecx
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movl	%edi, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$696, %rsp
+	.cfi_def_cfa_offset 752
+	leaq	64(%rsp), %rdi
+	leaq	64(%rsp), %r15
+	movq	$0, 40(%rsp)
+	rep stosq
+	leaq	80(%rsp), %rax
+	movq	%r15, 48(%rsp)
+	movq	%rax, 56(%rsp)
+.L1247:
+	movq	48(%rsp), %rax
+	movq	40(%rsp), %rcx
+	movq	$-1, %rbx
+	xorl	%r14d, %r14d
+	leaq	(%rax,%rcx,2), %rax
+	movq	%rax, 24(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1197:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1298
+.L1201:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	movl	%ebp, %eax
+	jge	.L1299
+.L1261:
+.L1205:
+	cmpl	$2, %eax
+	je	.L1212
+.L1305:
+	cmpl	$3, %eax
+	je	.L1213
+	cmpl	$1, %eax
+	je	.L1300
+	testq	%r14, %r14
+	je	.L1290
+	cmpq	$6, %rbx
+	jbe	.L1257
+	movq	%r14, %rdx
+	movq	24(%rsp), %rax
+	pxor	%xmm4, %xmm4
+	pxor	%xmm6, %xmm6
+	shrq	$3, %rdx
+	movdqa	.LC61(%rip), %xmm2
+	movdqa	.LC63(%rip), %xmm5
+	pxor	%xmm3, %xmm3
+	salq	$4, %rdx
+	addq	%rax, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L1229:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqw	%xmm5, %xmm0
+	pand	%xmm2, %xmm0
+	movdqa	%xmm0, %xmm1
+	punpckhwd	%xmm6, %xmm0
+	punpcklwd	%xmm6, %xmm1
+	movdqa	%xmm1, %xmm7
+	punpckhdq	%xmm3, %xmm1
+	punpckldq	%xmm3, %xmm7
+	paddq	%xmm7, %xmm1
+	movdqa	%xmm0, %xmm7
+	punpckhdq	%xmm3, %xmm0
+	punpckldq	%xmm3, %xmm7
+	paddq	%xmm7, %xmm0
+	paddq	%xmm0, %xmm1
+	paddq	%xmm1, %xmm4
+	cmpq	%rax, %rdx
+	jne	.L1229
+	movdqa	%xmm4, %xmm0
+	movq	%r14, %rax
+	psrldq	$8, %xmm0
+	andq	$-8, %rax
+	paddq	%xmm0, %xmm4
+	movq	%xmm4, %r13
+	testb	$7, %r14b
+	je	.L1230
+.L1228:
+	xorl	%edi, %edi
+	cmpw	$3, (%r15,%rax,2)
+	leaq	(%rax,%rax), %rsi
+	sete	%dil
+	addq	%rdi, %r13
+	leaq	1(%rax), %rdi
+	cmpq	%r14, %rdi
+	jnb	.L1226
+	xorl	%edi, %edi
+	cmpw	$3, 2(%r15,%rsi)
+	sete	%dil
+	addq	%rdi, %r13
+	leaq	2(%rax), %rdi
+	cmpq	%r14, %rdi
+	jnb	.L1226
+	xorl	%edi, %edi
+	cmpw	$3, 4(%r15,%rsi)
+	sete	%dil
+	addq	%rdi, %r13
+	leaq	3(%rax), %rdi
+	cmpq	%r14, %rdi
+	jnb	.L1226
+	xorl	%edi, %edi
+	cmpw	$3, 6(%r15,%rsi)
+	sete	%dil
+	addq	%rdi, %r13
+	leaq	4(%rax), %rdi
+	cmpq	%r14, %rdi
+	jnb	.L1226
+	xorl	%edi, %edi
+	cmpw	$3, 8(%r15,%rsi)
+	sete	%dil
+	addq	%rdi, %r13
+	leaq	5(%rax), %rdi
+	cmpq	%r14, %rdi
+	jnb	.L1226
+	xorl	%edi, %edi
+	cmpw	$3, 10(%r15,%rsi)
+	sete	%dil
+	addq	$6, %rax
+	addq	%rdi, %r13
+	cmpq	%r14, %rax
+	jnb	.L1226
+	xorl	%eax, %eax
+	cmpw	$3, 12(%r15,%rsi)
+	sete	%al
+	addq	%rax, %r13
+.L1224:
+	cmpq	$6, %rbx
+	jbe	.L1250
+	.p2align 4,,10
+	.p2align 3
+.L1296:
+	movdqa	.LC61(%rip), %xmm2
+	movdqa	.LC63(%rip), %xmm5
+.L1230:
+	movq	%r14, %rsi
+	pxor	%xmm3, %xmm3
+	pxor	%xmm6, %xmm6
+	movq	%r15, %rax
+	shrq	$3, %rsi
+	pxor	%xmm4, %xmm4
+	salq	$4, %rsi
+	addq	%r15, %rsi
+	.p2align 4,,10
+	.p2align 3
+.L1235:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqw	%xmm5, %xmm0
+	pand	%xmm2, %xmm0
+	movdqa	%xmm0, %xmm1
+	punpckhwd	%xmm6, %xmm0
+	movdqa	%xmm0, %xmm7
+	punpcklwd	%xmm6, %xmm1
+	punpckldq	%xmm4, %xmm0
+	punpckhdq	%xmm4, %xmm7
+	paddq	%xmm7, %xmm0
+	movdqa	%xmm1, %xmm7
+	punpckldq	%xmm4, %xmm1
+	punpckhdq	%xmm4, %xmm7
+	paddq	%xmm7, %xmm1
+	paddq	%xmm1, %xmm0
+	paddq	%xmm0, %xmm3
+	cmpq	%rax, %rsi
+	jne	.L1235
+	movdqa	%xmm3, %xmm0
+	movq	%r14, %rsi
+	psrldq	$8, %xmm0
+	andq	$-8, %rsi
+	paddq	%xmm0, %xmm3
+	movq	%xmm3, %rax
+	testb	$7, %r14b
+	je	.L1233
+.L1234:
+	xorl	%r9d, %r9d
+	cmpw	$3, (%r15,%rsi,2)
+	leaq	(%rsi,%rsi), %rdi
+	sete	%r9b
+	addq	%r9, %rax
+	leaq	1(%rsi), %r9
+	cmpq	%r14, %r9
+	jnb	.L1233
+.L1249:
+	xorl	%r9d, %r9d
+	cmpw	$3, 2(%r15,%rdi)
+	sete	%r9b
+	addq	%r9, %rax
+	leaq	2(%rsi), %r9
+	cmpq	%r14, %r9
+	jnb	.L1233
+	xorl	%r9d, %r9d
+	cmpw	$3, 4(%r15,%rdi)
+	sete	%r9b
+	addq	%r9, %rax
+	leaq	3(%rsi), %r9
+	cmpq	%r14, %r9
+	jnb	.L1233
+	xorl	%r9d, %r9d
+	cmpw	$3, 6(%r15,%rdi)
+	sete	%r9b
+	addq	%r9, %rax
+	leaq	4(%rsi), %r9
+	cmpq	%r14, %r9
+	jnb	.L1233
+	xorl	%r9d, %r9d
+	cmpw	$3, 8(%r15,%rdi)
+	sete	%r9b
+	addq	%r9, %rax
+	leaq	5(%rsi), %r9
+	cmpq	%r14, %r9
+	jnb	.L1233
+	xorl	%r9d, %r9d
+	cmpw	$3, 10(%r15,%rdi)
+	sete	%r9b
+	addq	$6, %rsi
+	addq	%r9, %rax
+	cmpq	%r14, %rsi
+	jnb	.L1233
+	xorl	%esi, %esi
+	cmpw	$3, 12(%r15,%rdi)
+	sete	%sil
+	addq	%rsi, %rax
+.L1233:
+	cmpq	%r13, %rax
+	jne	.L1301
+	movl	%ebp, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	_ZN1n9simd_findIsEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	$-1, %rax
+	jne	.L1239
+	testq	%r14, %r14
+	jne	.L1302
+.L1232:
+	addq	$7, %rbx
+	movl	$7, %r14d
+.L1243:
+	cmpq	$6, %rbx
+	jbe	.L1303
+	movq	%r14, %rdx
+	movq	%r15, %rax
+	movdqa	.LC42(%rip), %xmm4
+	movdqa	.LC47(%rip), %xmm9
+	shrq	$3, %rdx
+	movdqa	.LC45(%rip), %xmm7
+	movdqa	.LC44(%rip), %xmm8
+	salq	$4, %rdx
+	movdqa	.LC46(%rip), %xmm6
+	movdqa	.LC61(%rip), %xmm2
+	movdqa	.LC51(%rip), %xmm5
+	addq	%r15, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L1198:
+	movdqa	%xmm4, %xmm1
+	addq	$16, %rax
+	paddq	%xmm9, %xmm4
+	movdqa	%xmm1, %xmm3
+	movdqa	%xmm1, %xmm0
+	paddq	%xmm8, %xmm3
+	shufps	$136, %xmm3, %xmm0
+	movdqa	%xmm1, %xmm3
+	paddq	%xmm6, %xmm1
+	paddq	%xmm7, %xmm3
+	shufps	$136, %xmm1, %xmm3
+	movdqa	%xmm0, %xmm1
+	punpcklwd	%xmm3, %xmm0
+	punpckhwd	%xmm3, %xmm1
+	movdqa	%xmm0, %xmm3
+	punpckhwd	%xmm1, %xmm3
+	punpcklwd	%xmm1, %xmm0
+	punpcklwd	%xmm3, %xmm0
+	movdqa	%xmm0, %xmm1
+	pmulhuw	%xmm5, %xmm0
+	paddw	%xmm2, %xmm1
+	psrlw	$2, %xmm0
+	movdqa	%xmm0, %xmm3
+	psllw	$2, %xmm3
+	paddw	%xmm0, %xmm3
+	psubw	%xmm3, %xmm1
+	movups	%xmm1, -16(%rax)
+	cmpq	%rax, %rdx
+	jne	.L1198
+	movq	%r14, %rsi
+	andq	$-8, %rsi
+	testb	$7, %r14b
+	je	.L1197
+	movq	%rsi, %rax
+	leaq	1(%rsi), %r10
+	leaq	(%rsi,%rsi), %r11
+	movabsq	$-3689348814741910323, %rdi
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	movq	%rsi, %rax
+	subq	%rdx, %rax
+	addl	$1, %eax
+	movw	%ax, (%r15,%rsi,2)
+	cmpq	%r14, %r10
+	jnb	.L1197
+	movq	%r10, %rax
+	leaq	2(%r11), %r9
+	mulq	%rdi
+	movq	%rdx, %rdi
+	movq	%rdx, %rax
+	shrq	$2, %rax
+	andq	$-4, %rdi
+	addq	%rax, %rdi
+	subq	%rdi, %r10
+	addl	$1, %r10d
+	movw	%r10w, 2(%r11,%r15)
+	leaq	2(%rsi), %r10
+	cmpq	%r14, %r10
+	jnb	.L1197
+.L1248:
+	movabsq	$-3689348814741910323, %rdi
+	movq	%r10, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	subq	%rdx, %r10
+	addl	$1, %r10d
+	movw	%r10w, 2(%r15,%r9)
+	leaq	3(%rsi), %r10
+	cmpq	%r14, %r10
+	jnb	.L1197
+	movq	%r10, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	subq	%rdx, %r10
+	addl	$1, %r10d
+	movw	%r10w, 4(%r15,%r9)
+	leaq	4(%rsi), %r10
+	cmpq	%r14, %r10
+	jnb	.L1197
+	movq	%r10, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	subq	%rdx, %r10
+	addl	$1, %r10d
+	movw	%r10w, 6(%r15,%r9)
+	leaq	5(%rsi), %r10
+	cmpq	%r14, %r10
+	jnb	.L1197
+	movq	%r10, %rax
+	addq	$6, %rsi
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	subq	%rdx, %r10
+	addl	$1, %r10d
+	movw	%r10w, 8(%r15,%r9)
+	cmpq	%r14, %rsi
+	jnb	.L1197
+	movq	%rsi, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	subq	%rdx, %rsi
+	addl	$1, %esi
+	movw	%si, 10(%r15,%r9)
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	jne	.L1201
+.L1298:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1201
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1251
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1203:
+	movq	%r12, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	movl	%ebp, %eax
+	jl	.L1205
+.L1260:
+	.p2align 4,,10
+	.p2align 3
+.L1299:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1304
+.L1208:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %eax
+	cmpl	$2, %eax
+	jne	.L1305
+.L1212:
+	movl	$3, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	_ZN1n12__avx2_countIsEEmPKT_mS1_
+	movq	%rax, %r13
+	testq	%r14, %r14
+	je	.L1258
+.L1226:
+	cmpq	$6, %rbx
+	ja	.L1296
+.L1259:
+	xorl	%eax, %eax
+	xorl	%esi, %esi
+	jmp	.L1234
+	.p2align 4,,10
+	.p2align 3
+.L1302:
+	movl	$9, %ecx
+	movl	%ebp, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	movw	%cx, (%r15,%rbx,2)
+	call	_ZN1n9simd_findIsEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	%rax, %rbx
+	jne	.L1306
+	movq	%r14, %rax
+	movl	$9, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	andq	$-2, %rax
+	movw	%dx, (%r15,%rax)
+	movl	%ebp, %edx
+	call	_ZN1n9simd_findIsEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	movq	%r14, %rdx
+	shrq	%rdx
+	cmpq	%rax, %rdx
+	jne	.L1307
+	addq	$7, %r14
+	addq	$7, %rbx
+	cmpq	$301, %r14
+	jne	.L1243
+	addq	$1, 40(%rsp)
+	addq	$2, %r15
+	cmpq	%r15, 56(%rsp)
+	jne	.L1247
+	addq	$696, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1300:
+	.cfi_restore_state
+	cmpq	$7, %r14
+	jbe	.L1308
+	leaq	-8(%r14), %rax
+	movq	24(%rsp), %r12
+	movdqa	.LC63(%rip), %xmm5
+	xorl	%r13d, %r13d
+	movq	%rax, 32(%rsp)
+	shrq	$3, %rax
+	salq	$4, %rax
+	leaq	16(%r12,%rax), %rax
+	movq	%rax, 16(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1220:
+	movdqu	(%r12), %xmm0
+	movaps	%xmm5, (%rsp)
+	addq	$16, %r12
+	pcmpeqw	%xmm5, %xmm0
+	pmovmskb	%xmm0, %edi
+	call	__popcountdi2@PLT
+	movdqa	(%rsp), %xmm5
+	cltq
+	shrq	%rax
+	addq	%rax, %r13
+	cmpq	%r12, 16(%rsp)
+	jne	.L1220
+	movq	32(%rsp), %r12
+	movq	%r14, %rdi
+	andq	$-8, %r12
+	addq	$8, %r12
+	subq	%r12, %rdi
+	je	.L1224
+	cmpq	$7, %rdi
+	jbe	.L1256
+	movq	40(%rsp), %rax
+	movq	%rdi, %rsi
+	pxor	%xmm4, %xmm4
+	pxor	%xmm6, %xmm6
+	movq	48(%rsp), %rcx
+	shrq	$3, %rsi
+	movdqa	.LC61(%rip), %xmm2
+	pxor	%xmm3, %xmm3
+	addq	%r12, %rax
+	salq	$4, %rsi
+	leaq	(%rcx,%rax,2), %rax
+	addq	%rax, %rsi
+	.p2align 4,,10
+	.p2align 3
+.L1225:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqw	%xmm5, %xmm0
+	pand	%xmm2, %xmm0
+	movdqa	%xmm0, %xmm1
+	punpckhwd	%xmm6, %xmm0
+	punpcklwd	%xmm6, %xmm1
+	movdqa	%xmm1, %xmm7
+	punpckhdq	%xmm3, %xmm1
+	punpckldq	%xmm3, %xmm7
+	paddq	%xmm7, %xmm1
+	movdqa	%xmm0, %xmm7
+	punpckhdq	%xmm3, %xmm0
+	punpckldq	%xmm3, %xmm7
+	paddq	%xmm7, %xmm0
+	paddq	%xmm0, %xmm1
+	paddq	%xmm1, %xmm4
+	cmpq	%rax, %rsi
+	jne	.L1225
+	movdqa	%xmm4, %xmm0
+	movq	%rdi, %rsi
+	psrldq	$8, %xmm0
+	andq	$-8, %rsi
+	paddq	%xmm0, %xmm4
+	movq	%xmm4, %rax
+	testb	$7, %dil
+	je	.L1309
+.L1222:
+	leaq	(%r12,%rsi), %r9
+	cmpw	$3, (%r15,%r9,2)
+	sete	%r9b
+	movzbl	%r9b, %r9d
+	addq	%r9, %rax
+	leaq	1(%rsi), %r9
+	cmpq	%rdi, %r9
+	jnb	.L1227
+	addq	%r12, %r9
+	cmpw	$3, (%r15,%r9,2)
+	sete	%r9b
+	movzbl	%r9b, %r9d
+	addq	%r9, %rax
+	leaq	2(%rsi), %r9
+	cmpq	%rdi, %r9
+	jnb	.L1227
+	addq	%r12, %r9
+	cmpw	$3, (%r15,%r9,2)
+	sete	%r9b
+	movzbl	%r9b, %r9d
+	addq	%r9, %rax
+	leaq	3(%rsi), %r9
+	cmpq	%rdi, %r9
+	jnb	.L1227
+	addq	%r12, %r9
+	cmpw	$3, (%r15,%r9,2)
+	sete	%r9b
+	movzbl	%r9b, %r9d
+	addq	%r9, %rax
+	leaq	4(%rsi), %r9
+	cmpq	%rdi, %r9
+	jnb	.L1227
+	addq	%r12, %r9
+	cmpw	$3, (%r15,%r9,2)
+	sete	%r9b
+	movzbl	%r9b, %r9d
+	addq	%r9, %rax
+	leaq	5(%rsi), %r9
+	cmpq	%rdi, %r9
+	jnb	.L1227
+	addq	%r12, %r9
+	cmpw	$3, (%r15,%r9,2)
+	sete	%r9b
+	addq	$6, %rsi
+	movzbl	%r9b, %r9d
+	addq	%r9, %rax
+	cmpq	%rdi, %rsi
+	jnb	.L1227
+	addq	%rsi, %r12
+	xorl	%esi, %esi
+	cmpw	$3, (%r15,%r12,2)
+	sete	%sil
+	addq	%rsi, %rax
+.L1227:
+	addq	%rax, %r13
+.L1219:
+	testq	%r14, %r14
+	jne	.L1226
+.L1258:
+	xorl	%eax, %eax
+	jmp	.L1233
+	.p2align 4,,10
+	.p2align 3
+.L1213:
+	movl	$3, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	_ZN1n14__avx512_countIsEEmPKT_mS1_
+	movq	%rax, %r13
+	jmp	.L1219
+	.p2align 4,,10
+	.p2align 3
+.L1304:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1208
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1253
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1210:
+	movq	%r12, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1208
+	.p2align 4,,10
+	.p2align 3
+.L1303:
+	movl	$131073, (%r15)
+	movl	$2, %r10d
+	movl	$2, %r9d
+	xorl	%esi, %esi
+	jmp	.L1248
+.L1290:
+	xorl	%esi, %esi
+	movl	%ebp, %edx
+	movq	%r15, %rdi
+	call	_ZN1n9simd_findIsEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	$-1, %rax
+	je	.L1232
+.L1239:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC54(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L1308:
+	testq	%r14, %r14
+	je	.L1290
+	movl	$7, %edi
+	xorl	%r12d, %r12d
+	xorl	%r13d, %r13d
+	xorl	%eax, %eax
+	xorl	%esi, %esi
+	jmp	.L1222
+.L1309:
+	addq	%rax, %r13
+	cmpq	$6, %rbx
+	ja	.L1296
+	jmp	.L1259
+.L1257:
+	xorl	%r13d, %r13d
+	xorl	%eax, %eax
+	jmp	.L1228
+.L1251:
+	movl	$3, %eax
+	jmp	.L1203
+.L1250:
+	xorl	%eax, %eax
+	cmpw	$3, (%r15)
+	sete	%al
+	xorl	%esi, %esi
+	xorl	%edi, %edi
+	jmp	.L1249
+.L1253:
+	movl	$3, %eax
+	jmp	.L1210
+.L1256:
+	xorl	%eax, %eax
+	xorl	%esi, %esi
+	jmp	.L1222
+.L1301:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC55(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L1307:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC57(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L1306:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC56(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.cfi_endproc
+.LFE6786:
+	.size	_Z16check_find_countIsEvN1n8simd_isaE, .-_Z16check_find_countIsEvN1n8simd_isaE
+	.section	.text._ZN1n14__avx512_countIwEEmPKT_mS1_,"axG",@progbits,_ZN1n14__avx512_countIwEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n14__avx512_countIwEEmPKT_mS1_
+	.type	_ZN1n14__avx512_countIwEEmPKT_mS1_, @function
+_ZN1n14__avx512_countIwEEmPKT_mS1_:
+.LFB6884:
+	.cfi_startproc
+	movq	%rsi, %r8
+	vpbroadcastd	%edx, %zmm2
+	movl	$16, %eax
+	xorl	%r9d, %r9d
+	cmpq	$15, %rsi
+	jbe	.L1333
+	.p2align 4,,10
+	.p2align 3
+.L1314:
+	vmovdqu32	-64(%rdi,%rax,4), %zmm5
+	vpcmpd	$0, %zmm2, %zmm5, %k0
+	kmovw	%k0, %ecx
+	popcntq	%rcx, %rcx
+	addq	%rcx, %r9
+	movq	%rax, %rcx
+	leaq	16(%rax), %rax
+	cmpq	%rax, %r8
+	jnb	.L1314
+	subq	%rcx, %r8
+	je	.L1310
+	leaq	-1(%r8), %rax
+	cmpq	$14, %rax
+	jbe	.L1320
+	movq	%r8, %rsi
+	leaq	(%rdi,%rcx,4), %rax
+	movl	$1, %r10d
+	shrq	$4, %rsi
+	vpxor	%xmm3, %xmm3, %xmm3
+	vpbroadcastd	%r10d, %zmm4
+	salq	$6, %rsi
+	addq	%rax, %rsi
+	.p2align 4,,10
+	.p2align 3
+.L1315:
+	vpcmpd	$0, (%rax), %zmm2, %k1
+	addq	$64, %rax
+	vmovdqa32	%zmm4, %zmm0{%k1}{z}
+	vpmovzxdq	%ymm0, %zmm1
+	vextracti64x4	$0x1, %zmm0, %ymm0
+	vpmovzxdq	%ymm0, %zmm0
+	vpaddq	%zmm0, %zmm1, %zmm1
+	vpaddq	%zmm1, %zmm3, %zmm3
+	cmpq	%rax, %rsi
+	jne	.L1315
+	vmovdqa	%ymm3, %ymm2
+	vextracti64x4	$0x1, %zmm3, %ymm3
+	movq	%r8, %rsi
+	vpaddq	%ymm3, %ymm2, %ymm2
+	andq	$-16, %rsi
+	vextracti128	$0x1, %ymm2, %xmm1
+	vpaddq	%xmm1, %xmm2, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rax
+	testb	$15, %r8b
+	je	.L1316
+.L1312:
+	movq	%r8, %r10
+	subq	%rsi, %r10
+	leaq	-1(%r10), %r11
+	cmpq	$6, %r11
+	jbe	.L1317
+	vmovd	%edx, %xmm1
+	leaq	(%rcx,%rsi), %rax
+	movq	%r10, %r11
+	vpbroadcastd	%xmm1, %ymm1
+	andq	$-8, %r11
+	vpcmpeqd	(%rdi,%rax,4), %ymm1, %ymm1
+	movl	$1, %eax
+	addq	%r11, %rsi
+	andl	$7, %r10d
+	vmovd	%eax, %xmm0
+	vpbroadcastd	%xmm0, %ymm0
+	vpand	%ymm0, %ymm1, %ymm1
+	vpmovzxdq	%xmm1, %ymm0
+	vextracti128	$0x1, %ymm1, %xmm1
+	vpmovzxdq	%xmm1, %ymm1
+	vpaddq	%ymm1, %ymm0, %ymm0
+	vpaddq	%ymm2, %ymm0, %ymm0
+	vmovdqa	%xmm0, %xmm1
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpaddq	%xmm0, %xmm1, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rax
+	je	.L1316
+.L1317:
+	leaq	(%rcx,%rsi), %r10
+	cmpl	%edx, (%rdi,%r10,4)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	1(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1316
+	addq	%rcx, %r10
+	cmpl	%edx, (%rdi,%r10,4)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	2(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1316
+	addq	%rcx, %r10
+	cmpl	%edx, (%rdi,%r10,4)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	3(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1316
+	addq	%rcx, %r10
+	cmpl	%edx, (%rdi,%r10,4)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	4(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1316
+	addq	%rcx, %r10
+	cmpl	%edx, (%rdi,%r10,4)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	5(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1316
+	addq	%rcx, %r10
+	cmpl	%edx, (%rdi,%r10,4)
+	sete	%r10b
+	addq	$6, %rsi
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	cmpq	%r8, %rsi
+	jnb	.L1316
+	addq	%rsi, %rcx
+	cmpl	%edx, (%rdi,%rcx,4)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+.L1316:
+	addq	%rax, %r9
+.L1310:
+	movq	%r9, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1333:
+	testq	%rsi, %rsi
+	je	.L1310
+	xorl	%ecx, %ecx
+	vpxor	%xmm2, %xmm2, %xmm2
+	xorl	%eax, %eax
+	xorl	%esi, %esi
+	jmp	.L1312
+.L1320:
+	vpxor	%xmm2, %xmm2, %xmm2
+	xorl	%eax, %eax
+	xorl	%esi, %esi
+	jmp	.L1312
+	.cfi_endproc
+.LFE6884:
+	.size	_ZN1n14__avx512_countIwEEmPKT_mS1_, .-_ZN1n14__avx512_countIwEEmPKT_mS1_
+	.section	.text._ZN1n12__avx2_countIwEEmPKT_mS1_,"axG",@progbits,_ZN1n12__avx2_countIwEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n12__avx2_countIwEEmPKT_mS1_
+	.type	_ZN1n12__avx2_countIwEEmPKT_mS1_, @function
+_ZN1n12__avx2_countIwEEmPKT_mS1_:
+.LFB6885:
+	.cfi_startproc
+	vmovd	%edx, %xmm2
+	movq	%rsi, %rcx
+	movl	%edx, %r9d
+	xorl	%esi, %esi
+	vpbroadcastd	%xmm2, %ymm2
+	movl	$8, %edx
+	cmpq	$7, %rcx
+	jbe	.L1357
+	.p2align 4,,10
+	.p2align 3
+.L1335:
+	vpcmpeqd	-32(%rdi,%rdx,4), %ymm2, %ymm0
+	vpmovmskb	%ymm0, %eax
+	popcntl	%eax, %eax
+	shrq	$2, %rax
+	addq	%rax, %rsi
+	movq	%rdx, %rax
+	leaq	8(%rdx), %rdx
+	cmpq	%rdx, %rcx
+	jnb	.L1335
+	subq	%rax, %rcx
+	je	.L1334
+	leaq	-1(%rcx), %rdx
+	cmpq	$6, %rdx
+	jbe	.L1344
+	movq	%rcx, %r8
+	movl	$1, %r10d
+	leaq	(%rdi,%rax,4), %rdx
+	shrq	$3, %r8
+	vmovd	%r10d, %xmm4
+	vpxor	%xmm3, %xmm3, %xmm3
+	salq	$5, %r8
+	vpbroadcastd	%xmm4, %ymm4
+	addq	%rdx, %r8
+	.p2align 4,,10
+	.p2align 3
+.L1338:
+	vpcmpeqd	(%rdx), %ymm2, %ymm0
+	addq	$32, %rdx
+	vpand	%ymm4, %ymm0, %ymm0
+	vpmovzxdq	%xmm0, %ymm1
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxdq	%xmm0, %ymm0
+	vpaddq	%ymm0, %ymm1, %ymm0
+	vpaddq	%ymm0, %ymm3, %ymm3
+	cmpq	%rdx, %r8
+	jne	.L1338
+	vmovdqa	%xmm3, %xmm2
+	vextracti128	$0x1, %ymm3, %xmm3
+	movq	%rcx, %r8
+	vpaddq	%xmm3, %xmm2, %xmm2
+	andq	$-8, %r8
+	vpsrldq	$8, %xmm2, %xmm0
+	vpaddq	%xmm0, %xmm2, %xmm0
+	vmovq	%xmm0, %rdx
+	testb	$7, %cl
+	je	.L1339
+.L1336:
+	movq	%rcx, %r10
+	subq	%r8, %r10
+	leaq	-1(%r10), %r11
+	cmpq	$2, %r11
+	jbe	.L1340
+	vmovd	%r9d, %xmm5
+	leaq	(%rax,%r8), %rdx
+	movq	%r10, %r11
+	vpshufd	$0, %xmm5, %xmm0
+	andq	$-4, %r11
+	vpcmpeqd	(%rdi,%rdx,4), %xmm0, %xmm0
+	movl	$1, %edx
+	addq	%r11, %r8
+	andl	$3, %r10d
+	vmovd	%edx, %xmm1
+	vpshufd	$0, %xmm1, %xmm1
+	vpand	%xmm1, %xmm0, %xmm0
+	vpmovzxdq	%xmm0, %xmm1
+	vpsrldq	$8, %xmm0, %xmm0
+	vpmovzxdq	%xmm0, %xmm0
+	vpaddq	%xmm0, %xmm1, %xmm0
+	vpaddq	%xmm2, %xmm0, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rdx
+	je	.L1339
+.L1340:
+	leaq	(%rax,%r8), %r10
+	cmpl	%r9d, (%rdi,%r10,4)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rdx
+	leaq	1(%r8), %r10
+	cmpq	%rcx, %r10
+	jnb	.L1339
+	addq	%rax, %r10
+	cmpl	%r9d, (%rdi,%r10,4)
+	sete	%r10b
+	addq	$2, %r8
+	movzbl	%r10b, %r10d
+	addq	%r10, %rdx
+	cmpq	%rcx, %r8
+	jnb	.L1339
+	addq	%r8, %rax
+	cmpl	%r9d, (%rdi,%rax,4)
+	sete	%al
+	movzbl	%al, %eax
+	addq	%rax, %rdx
+.L1339:
+	addq	%rdx, %rsi
+.L1334:
+	movq	%rsi, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1357:
+	testq	%rcx, %rcx
+	je	.L1334
+	xorl	%eax, %eax
+	vpxor	%xmm2, %xmm2, %xmm2
+	xorl	%edx, %edx
+	xorl	%r8d, %r8d
+	jmp	.L1336
+.L1344:
+	vpxor	%xmm2, %xmm2, %xmm2
+	xorl	%edx, %edx
+	xorl	%r8d, %r8d
+	jmp	.L1336
+	.cfi_endproc
+.LFE6885:
+	.size	_ZN1n12__avx2_countIwEEmPKT_mS1_, .-_ZN1n12__avx2_countIwEEmPKT_mS1_
+	.section	.text._ZN1n13__avx512_findIwEEmPKT_mS1_,"axG",@progbits,_ZN1n13__avx512_findIwEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n13__avx512_findIwEEmPKT_mS1_
+	.type	_ZN1n13__avx512_findIwEEmPKT_mS1_, @function
+_ZN1n13__avx512_findIwEEmPKT_mS1_:
+.LFB6887:
+	.cfi_startproc
+	xorl	%ecx, %ecx
+	vpbroadcastd	%edx, %zmm0
+	jmp	.L1359
+	.p2align 4,,10
+	.p2align 3
+.L1361:
+	vmovdqu32	-64(%rdi,%rcx,4), %zmm1
+	vpcmpd	$0, %zmm0, %zmm1, %k0
+	kortestq	%k0, %k0
+	jne	.L1368
+.L1359:
+	movq	%rcx, %rax
+	leaq	16(%rcx), %rcx
+	cmpq	%rcx, %rsi
+	jnb	.L1361
+	subq	%rax, %rsi
+	je	.L1364
+	leaq	(%rdi,%rax,4), %rdi
+	xorl	%ecx, %ecx
+	jmp	.L1363
+	.p2align 4,,10
+	.p2align 3
+.L1369:
+	addq	$1, %rcx
+	cmpq	%rcx, %rsi
+	je	.L1364
+.L1363:
+	cmpl	(%rdi,%rcx,4), %edx
+	jne	.L1369
+	addq	%rcx, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1364:
+	movq	$-1, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1368:
+	kmovq	%k0, %rdx
+	rep bsfq	%rdx, %rdx
+	movslq	%edx, %rdx
+	addq	%rdx, %rax
+	vzeroupper
+	ret
+	.cfi_endproc
+.LFE6887:
+	.size	_ZN1n13__avx512_findIwEEmPKT_mS1_, .-_ZN1n13__avx512_findIwEEmPKT_mS1_
+	.section	.text._ZN1n11__avx2_findIwEEmPKT_mS1_,"axG",@progbits,_ZN1n11__avx2_findIwEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n11__avx2_findIwEEmPKT_mS1_
+	.type	_ZN1n11__avx2_findIwEEmPKT_mS1_, @function
+_ZN1n11__avx2_findIwEEmPKT_mS1_:
+.LFB6888:
+	.cfi_startproc
+	vmovd	%edx, %xmm1
+	xorl	%eax, %eax
+	vpbroadcastd	%xmm1, %ymm1
+	jmp	.L1371
+	.p2align 4,,10
+	.p2align 3
+.L1373:
+	vpcmpeqd	-128(%rdi,%rax,4), %ymm1, %ymm2
+	vpcmpeqd	-96(%rdi,%rax,4), %ymm1, %ymm0
+	vpcmpeqd	-64(%rdi,%rax,4), %ymm1, %ymm3
+	vpor	%ymm2, %ymm0, %ymm0
+	vpcmpeqd	-32(%rdi,%rax,4), %ymm1, %ymm2
+	vpor	%ymm3, %ymm2, %ymm2
+	vpor	%ymm2, %ymm0, %ymm0
+	vptest	%ymm0, %ymm0
+	jne	.L1374
+.L1371:
+	movq	%rax, %rcx
+	addq	$32, %rax
+	cmpq	%rax, %rsi
+	jnb	.L1373
+	movq	%rcx, %rax
+	leaq	8(%rcx), %rcx
+	cmpq	%rcx, %rsi
+	jb	.L1386
+	.p2align 4,,10
+	.p2align 3
+.L1376:
+	vpcmpeqd	-32(%rdi,%rcx,4), %ymm1, %ymm0
+	vpmovmskb	%ymm0, %r8d
+	testl	%r8d, %r8d
+	jne	.L1387
+.L1374:
+	movq	%rcx, %rax
+	leaq	8(%rcx), %rcx
+	cmpq	%rcx, %rsi
+	jnb	.L1376
+.L1386:
+	subq	%rax, %rsi
+	je	.L1379
+	leaq	(%rdi,%rax,4), %rdi
+	xorl	%ecx, %ecx
+	jmp	.L1378
+	.p2align 4,,10
+	.p2align 3
+.L1388:
+	addq	$1, %rcx
+	cmpq	%rcx, %rsi
+	je	.L1379
+.L1378:
+	cmpl	(%rdi,%rcx,4), %edx
+	jne	.L1388
+	addq	%rcx, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1379:
+	movq	$-1, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1387:
+	rep bsfl	%r8d, %r8d
+	movslq	%r8d, %r8
+	shrq	$2, %r8
+	addq	%r8, %rax
+	vzeroupper
+	ret
+	.cfi_endproc
+.LFE6888:
+	.size	_ZN1n11__avx2_findIwEEmPKT_mS1_, .-_ZN1n11__avx2_findIwEEmPKT_mS1_
+	.section	.text._ZN1n9simd_findIwEEmPKT_mS1_NS_8simd_isaE.constprop.0,"axG",@progbits,_Z16check_find_countIwEvN1n8simd_isaE,comdat
+	.p2align 4
+	.type	_ZN1n9simd_findIwEEmPKT_mS1_NS_8simd_isaE.constprop.0, @function
+_ZN1n9simd_findIwEEmPKT_mS1_NS_8simd_isaE.constprop.0:
+.LFB6987:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movl	%edx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1435
+.L1391:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	jge	.L1436
+.L1421:
+	cmpl	$2, %r12d
+	je	.L1402
+.L1441:
+	cmpl	$3, %r12d
+	je	.L1403
+	xorl	%eax, %eax
+	cmpl	$1, %r12d
+	je	.L1417
+	testq	%rbp, %rbp
+	jne	.L1405
+.L1419:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	$-1, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1437:
+	.cfi_restore_state
+	addq	$1, %rax
+	cmpq	%rax, %rbp
+	je	.L1419
+.L1405:
+	cmpl	$9, (%rbx,%rax,4)
+	jne	.L1437
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1417:
+	.cfi_restore_state
+	movdqa	.LC67(%rip), %xmm2
+	jmp	.L1404
+	.p2align 4,,10
+	.p2align 3
+.L1408:
+	movdqu	-64(%rbx,%rax,4), %xmm0
+	movdqu	-48(%rbx,%rax,4), %xmm1
+	movdqu	-16(%rbx,%rax,4), %xmm3
+	pcmpeqd	%xmm2, %xmm1
+	pcmpeqd	%xmm2, %xmm0
+	pcmpeqd	%xmm2, %xmm3
+	por	%xmm1, %xmm0
+	movdqu	-32(%rbx,%rax,4), %xmm1
+	pcmpeqd	%xmm2, %xmm1
+	por	%xmm3, %xmm1
+	por	%xmm1, %xmm0
+	pmovmskb	%xmm0, %ecx
+	testl	%ecx, %ecx
+	jne	.L1407
+.L1404:
+	movq	%rax, %rdx
+	addq	$16, %rax
+	cmpq	%rax, %rbp
+	jnb	.L1408
+.L1407:
+	movdqa	.LC67(%rip), %xmm1
+	jmp	.L1409
+	.p2align 4,,10
+	.p2align 3
+.L1410:
+	movdqu	-16(%rbx,%rdx,4), %xmm0
+	pcmpeqd	%xmm1, %xmm0
+	pmovmskb	%xmm0, %ecx
+	testl	%ecx, %ecx
+	jne	.L1438
+.L1409:
+	movq	%rdx, %rax
+	leaq	4(%rdx), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L1410
+	subq	%rax, %rbp
+	je	.L1419
+	leaq	(%rbx,%rax,4), %rcx
+	xorl	%edx, %edx
+	jmp	.L1412
+	.p2align 4,,10
+	.p2align 3
+.L1439:
+	addq	$1, %rdx
+	cmpq	%rdx, %rbp
+	je	.L1419
+.L1412:
+	cmpl	$9, (%rcx,%rdx,4)
+	jne	.L1439
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	addq	%rdx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.L1420:
+	.p2align 4,,10
+	.p2align 3
+.L1436:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1440
+.L1398:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	cmpl	$2, %r12d
+	jne	.L1441
+.L1402:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movl	$9, %edx
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n11__avx2_findIwEEmPKT_mS1_
+	.p2align 4,,10
+	.p2align 3
+.L1435:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1391
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1413
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1393:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1391
+	.p2align 4,,10
+	.p2align 3
+.L1403:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movl	$9, %edx
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n13__avx512_findIwEEmPKT_mS1_
+	.p2align 4,,10
+	.p2align 3
+.L1438:
+	.cfi_restore_state
+	rep bsfl	%ecx, %ecx
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movslq	%ecx, %rcx
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	shrq	$2, %rcx
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	addq	%rcx, %rax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1440:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1398
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1415
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1400:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1398
+.L1415:
+	movl	$3, %eax
+	jmp	.L1400
+.L1413:
+	movl	$3, %eax
+	jmp	.L1393
+	.cfi_endproc
+.LFE6987:
+	.size	_ZN1n9simd_findIwEEmPKT_mS1_NS_8simd_isaE.constprop.0, .-_ZN1n9simd_findIwEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	.section	.text._Z16check_find_countIwEvN1n8simd_isaE,"axG",@progbits,_Z16check_find_countIwEvN1n8simd_isaE,comdat
+	.p2align 4
+	.weak	_Z16check_find_countIwEvN1n8simd_isaE
+	.type	_Z16check_find_countIwEvN1n8simd_isaE, @function
+_Z16check_find_countIwEvN1n8simd_isaE:
+.LFB6787:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$154, %ecx
+	xorl	%eax, %eax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movl	%edi, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$1304, %rsp
+	.cfi_def_cfa_offset 1360
+	leaq	64(%rsp), %rdi
+	leaq	64(%rsp), %r15
+	movq	$0, 48(%rsp)
+	rep stosq
+	movq	%r15, 56(%rsp)
+.L1489:
+	movq	56(%rsp), %rax
+	movq	48(%rsp), %rsi
+	movq	$-1, %rbx
+	xorl	%r14d, %r14d
+	leaq	(%rax,%rsi,4), %rax
+	movq	%rax, 32(%rsp)
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1531
+	.p2align 4,,10
+	.p2align 3
+.L1446:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	movl	%ebp, %eax
+	jge	.L1532
+.L1500:
+.L1450:
+	cmpl	$2, %eax
+	je	.L1457
+.L1538:
+	cmpl	$3, %eax
+	je	.L1458
+	cmpl	$1, %eax
+	je	.L1533
+	testq	%r14, %r14
+	je	.L1526
+	cmpq	$2, %rbx
+	jbe	.L1534
+	movq	%r14, %rdx
+	movq	32(%rsp), %rax
+	pxor	%xmm1, %xmm1
+	pxor	%xmm3, %xmm3
+	shrq	$2, %rdx
+	movdqa	.LC68(%rip), %xmm2
+	movdqa	.LC66(%rip), %xmm4
+	salq	$4, %rdx
+	addq	%rax, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L1473:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqd	%xmm2, %xmm0
+	pand	%xmm4, %xmm0
+	movdqa	%xmm0, %xmm5
+	punpckldq	%xmm3, %xmm0
+	punpckhdq	%xmm3, %xmm5
+	paddq	%xmm5, %xmm0
+	paddq	%xmm0, %xmm1
+	cmpq	%rax, %rdx
+	jne	.L1473
+	movdqa	%xmm1, %xmm0
+	movq	%r14, %rax
+	psrldq	$8, %xmm0
+	andq	$-4, %rax
+	paddq	%xmm0, %xmm1
+	movq	%xmm1, %r13
+	testb	$3, %r14b
+	je	.L1474
+	xorl	%edi, %edi
+	cmpl	$3, (%r15,%rax,4)
+	leaq	0(,%rax,4), %rcx
+	sete	%dil
+	addq	%rdi, %r13
+	leaq	1(%rax), %rdi
+	cmpq	%r14, %rdi
+	jnb	.L1469
+.L1472:
+	xorl	%edi, %edi
+	cmpl	$3, 4(%r15,%rcx)
+	sete	%dil
+	addq	$2, %rax
+	addq	%rdi, %r13
+	cmpq	%r14, %rax
+	jnb	.L1469
+	xorl	%eax, %eax
+	cmpl	$3, 8(%r15,%rcx)
+	sete	%al
+	addq	%rax, %r13
+.L1466:
+	cmpq	$2, %rbx
+	jbe	.L1491
+	.p2align 4,,10
+	.p2align 3
+.L1529:
+	movdqa	.LC68(%rip), %xmm2
+	movdqa	.LC66(%rip), %xmm4
+.L1474:
+	movq	%r14, %rcx
+	pxor	%xmm1, %xmm1
+	pxor	%xmm3, %xmm3
+	movq	%r15, %rax
+	shrq	$2, %rcx
+	salq	$4, %rcx
+	addq	%r15, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L1479:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqd	%xmm2, %xmm0
+	pand	%xmm4, %xmm0
+	movdqa	%xmm0, %xmm5
+	punpckldq	%xmm3, %xmm0
+	punpckhdq	%xmm3, %xmm5
+	paddq	%xmm5, %xmm0
+	paddq	%xmm0, %xmm1
+	cmpq	%rax, %rcx
+	jne	.L1479
+	movdqa	%xmm1, %xmm0
+	movq	%r14, %rcx
+	psrldq	$8, %xmm0
+	andq	$-4, %rcx
+	paddq	%xmm0, %xmm1
+	movq	%xmm1, %rax
+	testb	$3, %r14b
+	je	.L1477
+.L1478:
+	xorl	%r9d, %r9d
+	cmpl	$3, (%r15,%rcx,4)
+	leaq	0(,%rcx,4), %rdi
+	sete	%r9b
+	addq	%r9, %rax
+	leaq	1(%rcx), %r9
+	cmpq	%r14, %r9
+	jnb	.L1477
+.L1490:
+	xorl	%r9d, %r9d
+	cmpl	$3, 4(%r15,%rdi)
+	sete	%r9b
+	addq	$2, %rcx
+	addq	%r9, %rax
+	cmpq	%r14, %rcx
+	jnb	.L1477
+	xorl	%ecx, %ecx
+	cmpl	$3, 8(%r15,%rdi)
+	sete	%cl
+	addq	%rcx, %rax
+.L1477:
+	cmpq	%r13, %rax
+	jne	.L1535
+	movl	%ebp, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	_ZN1n9simd_findIwEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	$-1, %rax
+	jne	.L1483
+	testq	%r14, %r14
+	jne	.L1536
+.L1476:
+	addq	$7, %rbx
+	movl	$7, %r14d
+.L1487:
+	movabsq	$-3689348814741910323, %rdi
+	xorl	%ecx, %ecx
+	.p2align 4,,10
+	.p2align 3
+.L1444:
+	movq	%rcx, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	movq	%rcx, %rax
+	subq	%rdx, %rax
+	addl	$1, %eax
+	movl	%eax, (%r15,%rcx,4)
+	addq	$1, %rcx
+	cmpq	%r14, %rcx
+	jne	.L1444
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	jne	.L1446
+.L1531:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1446
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1492
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1448:
+	movq	%r12, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	movl	%ebp, %eax
+	jl	.L1450
+.L1499:
+	.p2align 4,,10
+	.p2align 3
+.L1532:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1537
+.L1453:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %eax
+	cmpl	$2, %eax
+	jne	.L1538
+.L1457:
+	movl	$3, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	_ZN1n12__avx2_countIwEEmPKT_mS1_
+	movq	%rax, %r13
+	testq	%r14, %r14
+	je	.L1497
+.L1469:
+	cmpq	$2, %rbx
+	ja	.L1529
+.L1498:
+	xorl	%eax, %eax
+	xorl	%ecx, %ecx
+	jmp	.L1478
+	.p2align 4,,10
+	.p2align 3
+.L1536:
+	movl	$9, (%r15,%rbx,4)
+	movl	%ebp, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	_ZN1n9simd_findIwEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	%rax, %rbx
+	jne	.L1539
+	movq	%r14, %r12
+	movl	%ebp, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	shrq	%r12
+	movl	$9, (%r15,%r12,4)
+	call	_ZN1n9simd_findIwEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	%rax, %r12
+	jne	.L1540
+	addq	$7, %r14
+	addq	$7, %rbx
+	cmpq	$301, %r14
+	jne	.L1487
+	addq	$1, 48(%rsp)
+	movq	48(%rsp), %rax
+	addq	$4, %r15
+	cmpq	$8, %rax
+	jne	.L1489
+	addq	$1304, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1458:
+	.cfi_restore_state
+	movl	$3, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	_ZN1n14__avx512_countIwEEmPKT_mS1_
+	movq	%rax, %r13
+.L1464:
+	testq	%r14, %r14
+	jne	.L1469
+.L1497:
+	xorl	%eax, %eax
+	jmp	.L1477
+	.p2align 4,,10
+	.p2align 3
+.L1533:
+	cmpq	$3, %r14
+	jbe	.L1526
+	leaq	-4(%r14), %rax
+	movq	32(%rsp), %r12
+	movdqa	.LC68(%rip), %xmm2
+	xorl	%r13d, %r13d
+	movq	%rax, 40(%rsp)
+	shrq	$2, %rax
+	salq	$4, %rax
+	leaq	16(%r12,%rax), %rax
+	movq	%rax, 24(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1465:
+	movdqu	(%r12), %xmm0
+	movaps	%xmm2, (%rsp)
+	addq	$16, %r12
+	pcmpeqd	%xmm2, %xmm0
+	pmovmskb	%xmm0, %edi
+	call	__popcountdi2@PLT
+	movdqa	(%rsp), %xmm2
+	cltq
+	shrq	$2, %rax
+	addq	%rax, %r13
+	cmpq	%r12, 24(%rsp)
+	jne	.L1465
+	movq	40(%rsp), %r12
+	movq	%r14, %rdi
+	andq	$-4, %r12
+	addq	$4, %r12
+	subq	%r12, %rdi
+	je	.L1466
+	cmpq	$3, %rdi
+	jbe	.L1496
+	movq	48(%rsp), %rax
+	movq	%rdi, %rcx
+	pxor	%xmm1, %xmm1
+	pxor	%xmm3, %xmm3
+	movq	56(%rsp), %rsi
+	shrq	$2, %rcx
+	movdqa	.LC66(%rip), %xmm4
+	addq	%r12, %rax
+	salq	$4, %rcx
+	leaq	(%rsi,%rax,4), %rax
+	addq	%rax, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L1468:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqd	%xmm2, %xmm0
+	pand	%xmm4, %xmm0
+	movdqa	%xmm0, %xmm5
+	punpckhdq	%xmm3, %xmm0
+	punpckldq	%xmm3, %xmm5
+	paddq	%xmm5, %xmm0
+	paddq	%xmm0, %xmm1
+	cmpq	%rax, %rcx
+	jne	.L1468
+	movdqa	%xmm1, %xmm0
+	movq	%rdi, %rcx
+	psrldq	$8, %xmm0
+	andq	$-4, %rcx
+	paddq	%xmm0, %xmm1
+	movq	%xmm1, %rax
+	testb	$3, %dil
+	je	.L1541
+.L1467:
+	leaq	(%r12,%rcx), %r9
+	cmpl	$3, (%r15,%r9,4)
+	sete	%r9b
+	movzbl	%r9b, %r9d
+	addq	%r9, %rax
+	leaq	1(%rcx), %r9
+	cmpq	%rdi, %r9
+	jnb	.L1470
+	addq	%r12, %r9
+	cmpl	$3, (%r15,%r9,4)
+	sete	%r9b
+	addq	$2, %rcx
+	movzbl	%r9b, %r9d
+	addq	%r9, %rax
+	cmpq	%rdi, %rcx
+	jnb	.L1470
+	addq	%rcx, %r12
+	xorl	%ecx, %ecx
+	cmpl	$3, (%r15,%r12,4)
+	sete	%cl
+	addq	%rcx, %rax
+.L1470:
+	addq	%rax, %r13
+	jmp	.L1464
+	.p2align 4,,10
+	.p2align 3
+.L1537:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1453
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1494
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1455:
+	movq	%r12, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1453
+.L1541:
+	addq	%rax, %r13
+	cmpq	$2, %rbx
+	ja	.L1529
+	jmp	.L1498
+.L1526:
+	xorl	%esi, %esi
+	movl	%ebp, %edx
+	movq	%r15, %rdi
+	call	_ZN1n9simd_findIwEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	$-1, %rax
+	je	.L1476
+.L1483:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC54(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L1534:
+	xorl	%r13d, %r13d
+	cmpl	$3, (%r15)
+	sete	%r13b
+	xorl	%eax, %eax
+	xorl	%ecx, %ecx
+	jmp	.L1472
+.L1492:
+	movl	$3, %eax
+	jmp	.L1448
+.L1491:
+	xorl	%eax, %eax
+	cmpl	$3, (%r15)
+	sete	%al
+	xorl	%ecx, %ecx
+	xorl	%edi, %edi
+	jmp	.L1490
+.L1494:
+	movl	$3, %eax
+	jmp	.L1455
+.L1496:
+	xorl	%eax, %eax
+	xorl	%ecx, %ecx
+	jmp	.L1467
+.L1535:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC55(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L1540:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC57(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L1539:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC56(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.cfi_endproc
+.LFE6787:
+	.size	_Z16check_find_countIwEvN1n8simd_isaE, .-_Z16check_find_countIwEvN1n8simd_isaE
+	.text
+	.p2align 4
+	.globl	_Z12test_simd_16v
+	.type	_Z12test_simd_16v, @function
+_Z12test_simd_16v:
+.LFB6724:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	xorl	%ebx, %ebx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	jmp	.L1543
+	.p2align 4,,10
+	.p2align 3
+.L1545:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebx
+	jg	.L1571
+.L1548:
+	movl	%ebx, %edi
+	addl	$1, %ebx
+	call	_Z16check_find_countIsEvN1n8simd_isaE
+.L1543:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	jne	.L1545
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1545
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1558
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1547:
+	movq	%rbp, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebx
+	jle	.L1548
+	.p2align 4,,10
+	.p2align 3
+.L1571:
+	xorl	%ebx, %ebx
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbp
+	jmp	.L1549
+	.p2align 4,,10
+	.p2align 3
+.L1552:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebx
+	jg	.L1572
+.L1562:
+.L1555:
+	movl	%ebx, %edi
+	addl	$1, %ebx
+	call	_Z16check_find_countIwEvN1n8simd_isaE
+.L1549:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	jne	.L1552
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1552
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1560
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1554:
+	movq	%rbp, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebx
+	jle	.L1555
+.L1572:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1558:
+	.cfi_restore_state
+	movl	$3, %eax
+	jmp	.L1547
+	.p2align 4,,10
+	.p2align 3
+.L1560:
+	movl	$3, %eax
+	jmp	.L1554
+.L1563:
+	.cfi_endproc
+.LFE6724:
+	.size	_Z12test_simd_16v, .-_Z12test_simd_16v
+	.section	.text._ZN1n14__avx512_countIiEEmPKT_mS1_,"axG",@progbits,_ZN1n14__avx512_countIiEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n14__avx512_countIiEEmPKT_mS1_
+	.type	_ZN1n14__avx512_countIiEEmPKT_mS1_, @function
+_ZN1n14__avx512_countIiEEmPKT_mS1_:
+.LFB6891:
+	.cfi_startproc
+	movq	%rsi, %r8
+	vpbroadcastd	%edx, %zmm2
+	movl	$16, %eax
+	xorl	%r9d, %r9d
+	cmpq	$15, %rsi
+	jbe	.L1596
+	.p2align 4,,10
+	.p2align 3
+.L1577:
+	vmovdqu32	-64(%rdi,%rax,4), %zmm5
+	vpcmpd	$0, %zmm2, %zmm5, %k0
+	kmovw	%k0, %ecx
+	popcntq	%rcx, %rcx
+	addq	%rcx, %r9
+	movq	%rax, %rcx
+	leaq	16(%rax), %rax
+	cmpq	%rax, %r8
+	jnb	.L1577
+	subq	%rcx, %r8
+	je	.L1573
+	leaq	-1(%r8), %rax
+	cmpq	$14, %rax
+	jbe	.L1583
+	movq	%r8, %rsi
+	leaq	(%rdi,%rcx,4), %rax
+	movl	$1, %r10d
+	shrq	$4, %rsi
+	vpxor	%xmm3, %xmm3, %xmm3
+	vpbroadcastd	%r10d, %zmm4
+	salq	$6, %rsi
+	addq	%rax, %rsi
+	.p2align 4,,10
+	.p2align 3
+.L1578:
+	vpcmpd	$0, (%rax), %zmm2, %k1
+	addq	$64, %rax
+	vmovdqa32	%zmm4, %zmm0{%k1}{z}
+	vpmovzxdq	%ymm0, %zmm1
+	vextracti64x4	$0x1, %zmm0, %ymm0
+	vpmovzxdq	%ymm0, %zmm0
+	vpaddq	%zmm0, %zmm1, %zmm1
+	vpaddq	%zmm1, %zmm3, %zmm3
+	cmpq	%rax, %rsi
+	jne	.L1578
+	vmovdqa	%ymm3, %ymm2
+	vextracti64x4	$0x1, %zmm3, %ymm3
+	movq	%r8, %rsi
+	vpaddq	%ymm3, %ymm2, %ymm2
+	andq	$-16, %rsi
+	vextracti128	$0x1, %ymm2, %xmm1
+	vpaddq	%xmm1, %xmm2, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rax
+	testb	$15, %r8b
+	je	.L1579
+.L1575:
+	movq	%r8, %r10
+	subq	%rsi, %r10
+	leaq	-1(%r10), %r11
+	cmpq	$6, %r11
+	jbe	.L1580
+	vmovd	%edx, %xmm1
+	leaq	(%rcx,%rsi), %rax
+	movq	%r10, %r11
+	vpbroadcastd	%xmm1, %ymm1
+	andq	$-8, %r11
+	vpcmpeqd	(%rdi,%rax,4), %ymm1, %ymm1
+	movl	$1, %eax
+	addq	%r11, %rsi
+	andl	$7, %r10d
+	vmovd	%eax, %xmm0
+	vpbroadcastd	%xmm0, %ymm0
+	vpand	%ymm0, %ymm1, %ymm1
+	vpmovzxdq	%xmm1, %ymm0
+	vextracti128	$0x1, %ymm1, %xmm1
+	vpmovzxdq	%xmm1, %ymm1
+	vpaddq	%ymm1, %ymm0, %ymm0
+	vpaddq	%ymm2, %ymm0, %ymm0
+	vmovdqa	%xmm0, %xmm1
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpaddq	%xmm0, %xmm1, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rax
+	je	.L1579
+.L1580:
+	leaq	(%rcx,%rsi), %r10
+	cmpl	%edx, (%rdi,%r10,4)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	1(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1579
+	addq	%rcx, %r10
+	cmpl	%edx, (%rdi,%r10,4)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	2(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1579
+	addq	%rcx, %r10
+	cmpl	%edx, (%rdi,%r10,4)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	3(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1579
+	addq	%rcx, %r10
+	cmpl	%edx, (%rdi,%r10,4)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	4(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1579
+	addq	%rcx, %r10
+	cmpl	%edx, (%rdi,%r10,4)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	5(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1579
+	addq	%rcx, %r10
+	cmpl	%edx, (%rdi,%r10,4)
+	sete	%r10b
+	addq	$6, %rsi
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	cmpq	%r8, %rsi
+	jnb	.L1579
+	addq	%rsi, %rcx
+	cmpl	%edx, (%rdi,%rcx,4)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+.L1579:
+	addq	%rax, %r9
+.L1573:
+	movq	%r9, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1596:
+	testq	%rsi, %rsi
+	je	.L1573
+	xorl	%ecx, %ecx
+	vpxor	%xmm2, %xmm2, %xmm2
+	xorl	%eax, %eax
+	xorl	%esi, %esi
+	jmp	.L1575
+.L1583:
+	vpxor	%xmm2, %xmm2, %xmm2
+	xorl	%eax, %eax
+	xorl	%esi, %esi
+	jmp	.L1575
+	.cfi_endproc
+.LFE6891:
+	.size	_ZN1n14__avx512_countIiEEmPKT_mS1_, .-_ZN1n14__avx512_countIiEEmPKT_mS1_
+	.section	.text._ZN1n12__avx2_countIiEEmPKT_mS1_,"axG",@progbits,_ZN1n12__avx2_countIiEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n12__avx2_countIiEEmPKT_mS1_
+	.type	_ZN1n12__avx2_countIiEEmPKT_mS1_, @function
+_ZN1n12__avx2_countIiEEmPKT_mS1_:
+.LFB6892:
+	.cfi_startproc
+	vmovd	%edx, %xmm2
+	movq	%rsi, %rcx
+	movl	%edx, %r9d
+	xorl	%esi, %esi
+	vpbroadcastd	%xmm2, %ymm2
+	movl	$8, %edx
+	cmpq	$7, %rcx
+	jbe	.L1620
+	.p2align 4,,10
+	.p2align 3
+.L1598:
+	vpcmpeqd	-32(%rdi,%rdx,4), %ymm2, %ymm0
+	vpmovmskb	%ymm0, %eax
+	popcntl	%eax, %eax
+	shrq	$2, %rax
+	addq	%rax, %rsi
+	movq	%rdx, %rax
+	leaq	8(%rdx), %rdx
+	cmpq	%rdx, %rcx
+	jnb	.L1598
+	subq	%rax, %rcx
+	je	.L1597
+	leaq	-1(%rcx), %rdx
+	cmpq	$6, %rdx
+	jbe	.L1607
+	movq	%rcx, %r8
+	movl	$1, %r10d
+	leaq	(%rdi,%rax,4), %rdx
+	shrq	$3, %r8
+	vmovd	%r10d, %xmm4
+	vpxor	%xmm3, %xmm3, %xmm3
+	salq	$5, %r8
+	vpbroadcastd	%xmm4, %ymm4
+	addq	%rdx, %r8
+	.p2align 4,,10
+	.p2align 3
+.L1601:
+	vpcmpeqd	(%rdx), %ymm2, %ymm0
+	addq	$32, %rdx
+	vpand	%ymm4, %ymm0, %ymm0
+	vpmovzxdq	%xmm0, %ymm1
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxdq	%xmm0, %ymm0
+	vpaddq	%ymm0, %ymm1, %ymm0
+	vpaddq	%ymm0, %ymm3, %ymm3
+	cmpq	%rdx, %r8
+	jne	.L1601
+	vmovdqa	%xmm3, %xmm2
+	vextracti128	$0x1, %ymm3, %xmm3
+	movq	%rcx, %r8
+	vpaddq	%xmm3, %xmm2, %xmm2
+	andq	$-8, %r8
+	vpsrldq	$8, %xmm2, %xmm0
+	vpaddq	%xmm0, %xmm2, %xmm0
+	vmovq	%xmm0, %rdx
+	testb	$7, %cl
+	je	.L1602
+.L1599:
+	movq	%rcx, %r10
+	subq	%r8, %r10
+	leaq	-1(%r10), %r11
+	cmpq	$2, %r11
+	jbe	.L1603
+	vmovd	%r9d, %xmm5
+	leaq	(%rax,%r8), %rdx
+	movq	%r10, %r11
+	vpshufd	$0, %xmm5, %xmm0
+	andq	$-4, %r11
+	vpcmpeqd	(%rdi,%rdx,4), %xmm0, %xmm0
+	movl	$1, %edx
+	addq	%r11, %r8
+	andl	$3, %r10d
+	vmovd	%edx, %xmm1
+	vpshufd	$0, %xmm1, %xmm1
+	vpand	%xmm1, %xmm0, %xmm0
+	vpmovzxdq	%xmm0, %xmm1
+	vpsrldq	$8, %xmm0, %xmm0
+	vpmovzxdq	%xmm0, %xmm0
+	vpaddq	%xmm0, %xmm1, %xmm0
+	vpaddq	%xmm2, %xmm0, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rdx
+	je	.L1602
+.L1603:
+	leaq	(%rax,%r8), %r10
+	cmpl	%r9d, (%rdi,%r10,4)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rdx
+	leaq	1(%r8), %r10
+	cmpq	%rcx, %r10
+	jnb	.L1602
+	addq	%rax, %r10
+	cmpl	%r9d, (%rdi,%r10,4)
+	sete	%r10b
+	addq	$2, %r8
+	movzbl	%r10b, %r10d
+	addq	%r10, %rdx
+	cmpq	%rcx, %r8
+	jnb	.L1602
+	addq	%r8, %rax
+	cmpl	%r9d, (%rdi,%rax,4)
+	sete	%al
+	movzbl	%al, %eax
+	addq	%rax, %rdx
+.L1602:
+	addq	%rdx, %rsi
+.L1597:
+	movq	%rsi, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1620:
+	testq	%rcx, %rcx
+	je	.L1597
+	xorl	%eax, %eax
+	vpxor	%xmm2, %xmm2, %xmm2
+	xorl	%edx, %edx
+	xorl	%r8d, %r8d
+	jmp	.L1599
+.L1607:
+	vpxor	%xmm2, %xmm2, %xmm2
+	xorl	%edx, %edx
+	xorl	%r8d, %r8d
+	jmp	.L1599
+	.cfi_endproc
+.LFE6892:
+	.size	_ZN1n12__avx2_countIiEEmPKT_mS1_, .-_ZN1n12__avx2_countIiEEmPKT_mS1_
+	.section	.text._ZN1n13__avx512_findIiEEmPKT_mS1_,"axG",@progbits,_ZN1n13__avx512_findIiEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n13__avx512_findIiEEmPKT_mS1_
+	.type	_ZN1n13__avx512_findIiEEmPKT_mS1_, @function
+_ZN1n13__avx512_findIiEEmPKT_mS1_:
+.LFB6894:
+	.cfi_startproc
+	xorl	%ecx, %ecx
+	vpbroadcastd	%edx, %zmm0
+	jmp	.L1622
+	.p2align 4,,10
+	.p2align 3
+.L1624:
+	vmovdqu32	-64(%rdi,%rcx,4), %zmm1
+	vpcmpd	$0, %zmm0, %zmm1, %k0
+	kortestq	%k0, %k0
+	jne	.L1631
+.L1622:
+	movq	%rcx, %rax
+	leaq	16(%rcx), %rcx
+	cmpq	%rcx, %rsi
+	jnb	.L1624
+	subq	%rax, %rsi
+	je	.L1627
+	leaq	(%rdi,%rax,4), %rdi
+	xorl	%ecx, %ecx
+	jmp	.L1626
+	.p2align 4,,10
+	.p2align 3
+.L1632:
+	addq	$1, %rcx
+	cmpq	%rcx, %rsi
+	je	.L1627
+.L1626:
+	cmpl	(%rdi,%rcx,4), %edx
+	jne	.L1632
+	addq	%rcx, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1627:
+	movq	$-1, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1631:
+	kmovq	%k0, %rdx
+	rep bsfq	%rdx, %rdx
+	movslq	%edx, %rdx
+	addq	%rdx, %rax
+	vzeroupper
+	ret
+	.cfi_endproc
+.LFE6894:
+	.size	_ZN1n13__avx512_findIiEEmPKT_mS1_, .-_ZN1n13__avx512_findIiEEmPKT_mS1_
+	.section	.text._ZN1n11__avx2_findIiEEmPKT_mS1_,"axG",@progbits,_ZN1n11__avx2_findIiEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n11__avx2_findIiEEmPKT_mS1_
+	.type	_ZN1n11__avx2_findIiEEmPKT_mS1_, @function
+_ZN1n11__avx2_findIiEEmPKT_mS1_:
+.LFB6895:
+	.cfi_startproc
+	vmovd	%edx, %xmm1
+	xorl	%eax, %eax
+	vpbroadcastd	%xmm1, %ymm1
+	jmp	.L1634
+	.p2align 4,,10
+	.p2align 3
+.L1636:
+	vpcmpeqd	-128(%rdi,%rax,4), %ymm1, %ymm2
+	vpcmpeqd	-96(%rdi,%rax,4), %ymm1, %ymm0
+	vpcmpeqd	-64(%rdi,%rax,4), %ymm1, %ymm3
+	vpor	%ymm2, %ymm0, %ymm0
+	vpcmpeqd	-32(%rdi,%rax,4), %ymm1, %ymm2
+	vpor	%ymm3, %ymm2, %ymm2
+	vpor	%ymm2, %ymm0, %ymm0
+	vptest	%ymm0, %ymm0
+	jne	.L1637
+.L1634:
+	movq	%rax, %rcx
+	addq	$32, %rax
+	cmpq	%rax, %rsi
+	jnb	.L1636
+	movq	%rcx, %rax
+	leaq	8(%rcx), %rcx
+	cmpq	%rcx, %rsi
+	jb	.L1649
+	.p2align 4,,10
+	.p2align 3
+.L1639:
+	vpcmpeqd	-32(%rdi,%rcx,4), %ymm1, %ymm0
+	vpmovmskb	%ymm0, %r8d
+	testl	%r8d, %r8d
+	jne	.L1650
+.L1637:
+	movq	%rcx, %rax
+	leaq	8(%rcx), %rcx
+	cmpq	%rcx, %rsi
+	jnb	.L1639
+.L1649:
+	subq	%rax, %rsi
+	je	.L1642
+	leaq	(%rdi,%rax,4), %rdi
+	xorl	%ecx, %ecx
+	jmp	.L1641
+	.p2align 4,,10
+	.p2align 3
+.L1651:
+	addq	$1, %rcx
+	cmpq	%rcx, %rsi
+	je	.L1642
+.L1641:
+	cmpl	(%rdi,%rcx,4), %edx
+	jne	.L1651
+	addq	%rcx, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1642:
+	movq	$-1, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1650:
+	rep bsfl	%r8d, %r8d
+	movslq	%r8d, %r8
+	shrq	$2, %r8
+	addq	%r8, %rax
+	vzeroupper
+	ret
+	.cfi_endproc
+.LFE6895:
+	.size	_ZN1n11__avx2_findIiEEmPKT_mS1_, .-_ZN1n11__avx2_findIiEEmPKT_mS1_
+	.section	.text._ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE,"axG",@progbits,_ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE,comdat
+	.p2align 4
+	.weak	_ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE
+	.type	_ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE, @function
+_ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE:
+.LFB6838:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	movl	%edx, %r13d
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movl	%ecx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	movq	%rdi, %rbx
+	testb	%al, %al
+	je	.L1698
+.L1654:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	jge	.L1699
+.L1684:
+	cmpl	$2, %r12d
+	je	.L1665
+.L1702:
+	cmpl	$3, %r12d
+	je	.L1666
+	cmpl	$1, %r12d
+	je	.L1667
+	xorl	%eax, %eax
+	testq	%rbp, %rbp
+	jne	.L1668
+.L1682:
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	$-1, %rax
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1700:
+	.cfi_restore_state
+	addq	$1, %rax
+	cmpq	%rax, %rbp
+	je	.L1682
+.L1668:
+	cmpl	(%rbx,%rax,4), %r13d
+	jne	.L1700
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+.L1683:
+	.p2align 4,,10
+	.p2align 3
+.L1699:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1701
+.L1661:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	cmpl	$2, %r12d
+	jne	.L1702
+.L1665:
+	movl	%r13d, %edx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n11__avx2_findIiEEmPKT_mS1_
+	.p2align 4,,10
+	.p2align 3
+.L1698:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r14
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1654
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1677
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1656:
+	movq	%r14, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1654
+	.p2align 4,,10
+	.p2align 3
+.L1667:
+	movd	%r13d, %xmm4
+	xorl	%eax, %eax
+	pshufd	$0, %xmm4, %xmm2
+	jmp	.L1670
+	.p2align 4,,10
+	.p2align 3
+.L1672:
+	movdqu	-64(%rbx,%rax,4), %xmm0
+	movdqu	-48(%rbx,%rax,4), %xmm1
+	movdqu	-16(%rbx,%rax,4), %xmm3
+	pcmpeqd	%xmm2, %xmm1
+	pcmpeqd	%xmm2, %xmm0
+	pcmpeqd	%xmm2, %xmm3
+	por	%xmm1, %xmm0
+	movdqu	-32(%rbx,%rax,4), %xmm1
+	pcmpeqd	%xmm2, %xmm1
+	por	%xmm3, %xmm1
+	por	%xmm1, %xmm0
+	pmovmskb	%xmm0, %ecx
+	testl	%ecx, %ecx
+	jne	.L1673
+.L1670:
+	movq	%rax, %rdx
+	addq	$16, %rax
+	cmpq	%rax, %rbp
+	jnb	.L1672
+	movq	%rdx, %rax
+	leaq	4(%rdx), %rdx
+	cmpq	%rdx, %rbp
+	jb	.L1703
+	.p2align 4,,10
+	.p2align 3
+.L1674:
+	movdqu	-16(%rbx,%rdx,4), %xmm0
+	pcmpeqd	%xmm2, %xmm0
+	pmovmskb	%xmm0, %ecx
+	testl	%ecx, %ecx
+	jne	.L1704
+.L1673:
+	movq	%rdx, %rax
+	leaq	4(%rdx), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L1674
+.L1703:
+	subq	%rax, %rbp
+	je	.L1682
+	leaq	(%rbx,%rax,4), %rcx
+	xorl	%edx, %edx
+	jmp	.L1676
+	.p2align 4,,10
+	.p2align 3
+.L1705:
+	addq	$1, %rdx
+	cmpq	%rdx, %rbp
+	je	.L1682
+.L1676:
+	cmpl	(%rcx,%rdx,4), %r13d
+	jne	.L1705
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	addq	%rdx, %rax
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1666:
+	.cfi_restore_state
+	movl	%r13d, %edx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n13__avx512_findIiEEmPKT_mS1_
+	.p2align 4,,10
+	.p2align 3
+.L1704:
+	.cfi_restore_state
+	rep bsfl	%ecx, %ecx
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	movslq	%ecx, %rcx
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	shrq	$2, %rcx
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	addq	%rcx, %rax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1701:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r14
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1661
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1679
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1663:
+	movq	%r14, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1661
+.L1679:
+	movl	$3, %eax
+	jmp	.L1663
+.L1677:
+	movl	$3, %eax
+	jmp	.L1656
+	.cfi_endproc
+.LFE6838:
+	.size	_ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE, .-_ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE
+	.section	.rodata.str1.8
+	.align 8
+.LC70:
+	.string	"expected equal : expected value : n::count(v.iter(), 7), actual value : 100"
+	.align 8
+.LC71:
+	.string	"expected true : n::contains(v.iter(), 9)"
+	.align 8
+.LC72:
+	.string	"expected false : n::contains(v.iter(), 10)"
+	.section	.text.unlikely
+.LCOLDB73:
+	.text
+.LHOTB73:
+	.p2align 4
+	.globl	_Z20test_simd_algorithmsv
+	.type	_Z20test_simd_algorithmsv, @function
+_Z20test_simd_algorithmsv:
+.LFB6734:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6734
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r15
+	testq	%r15, %r15
+	je	.L1816
+.L1707:
+	xorl	%ebp, %ebp
+	xorl	%r12d, %r12d
+	xorl	%r13d, %r13d
+	movl	$3435973837, %r14d
+	jmp	.L1719
+	.p2align 4,,10
+	.p2align 3
+.L1711:
+	movl	%ebx, 0(%r13,%rbp,4)
+	addq	$1, %rbp
+	cmpq	$1000, %rbp
+	je	.L1817
+.L1719:
+	movl	%ebp, %ebx
+	imulq	%r14, %rbx
+	shrq	$35, %rbx
+	leal	(%rbx,%rbx,4), %eax
+	movl	%ebp, %ebx
+	addl	%eax, %eax
+	subl	%eax, %ebx
+	cmpq	%r12, %rbp
+	jne	.L1711
+	leaq	5(%rbp), %rsi
+	movl	$4, %edx
+	movq	%r15, %rdi
+	leaq	(%rsi,%rsi), %rax
+	salq	$3, %rsi
+	movq	%rax, 24(%rsp)
+	movq	(%r15), %rax
+.LEHB17:
+	call	*16(%rax)
+.LEHE17:
+	movq	%rax, (%rsp)
+	leaq	0(,%rbp,4), %rdx
+	movl	%ebx, (%rax,%rbp,4)
+	testq	%rbp, %rbp
+	jne	.L1818
+	testq	%r13, %r13
+	je	.L1762
+.L1713:
+	movq	(%r15), %rax
+	movl	$4, %ecx
+	movq	%r13, %rsi
+	movq	%r15, %rdi
+	leaq	0(,%r12,4), %rdx
+.LEHB18:
+	call	*24(%rax)
+.LEHE18:
+	addq	$1, %rbp
+	movq	24(%rsp), %r12
+	movq	(%rsp), %r13
+	cmpq	$1000, %rbp
+	jne	.L1719
+.L1817:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1819
+.L1721:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %ebx
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1820
+.L1725:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebx
+	jge	.L1821
+.L1777:
+	cmpl	$2, %ebx
+	je	.L1737
+.L1826:
+	cmpl	$3, %ebx
+	je	.L1738
+	cmpl	$1, %ebx
+	je	.L1822
+	movdqa	.LC69(%rip), %xmm7
+	movq	%r13, %rax
+	pxor	%xmm1, %xmm1
+	movdqa	.LC66(%rip), %xmm4
+	leaq	4000(%r13), %rdx
+	pxor	%xmm2, %xmm2
+	movaps	%xmm7, (%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1742:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqd	(%rsp), %xmm0
+	pand	%xmm4, %xmm0
+	movdqa	%xmm0, %xmm3
+	punpckldq	%xmm2, %xmm0
+	punpckhdq	%xmm2, %xmm3
+	paddq	%xmm3, %xmm0
+	paddq	%xmm0, %xmm1
+	cmpq	%rax, %rdx
+	jne	.L1742
+	movdqa	%xmm1, %xmm0
+	psrldq	$8, %xmm0
+	paddq	%xmm0, %xmm1
+	movq	%xmm1, %rbx
+.L1741:
+	cmpq	$100, %rbx
+	jne	.L1810
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1823
+.L1745:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %ecx
+	movl	$9, %edx
+	movl	$1000, %esi
+	movq	%r13, %rdi
+	call	_ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE
+	cmpq	$-1, %rax
+	je	.L1811
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1824
+.L1752:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %ecx
+	movl	$10, %edx
+	movl	$1000, %esi
+	movq	%r13, %rdi
+	call	_ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE
+	cmpq	$-1, %rax
+	jne	.L1755
+	testq	%r13, %r13
+	je	.L1706
+	movq	(%r15), %rax
+	movl	$4, %ecx
+	movq	%r13, %rsi
+	movq	%r15, %rdi
+	leaq	0(,%r12,4), %rdx
+	call	*24(%rax)
+.L1706:
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1818:
+	.cfi_restore_state
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L1713
+	.p2align 4,,10
+	.p2align 3
+.L1762:
+	movq	24(%rsp), %r12
+	movq	%rax, %r13
+	movl	$1, %ebp
+	jmp	.L1719
+.L1824:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1752
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1773
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1754:
+	movq	%rbp, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1752
+.L1823:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1745
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1771
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1747:
+	movq	%rbp, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1745
+.L1822:
+	movdqa	.LC69(%rip), %xmm7
+	movl	$4, %ebp
+	xorl	%ebx, %ebx
+	movaps	%xmm7, (%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1739:
+	movdqu	-16(%r13,%rbp,4), %xmm0
+	addq	$4, %rbp
+	pcmpeqd	(%rsp), %xmm0
+	pmovmskb	%xmm0, %edi
+	call	__popcountdi2@PLT
+	cltq
+	shrq	$2, %rax
+	addq	%rax, %rbx
+	cmpq	$1000, %rbp
+	jbe	.L1739
+	jmp	.L1741
+.L1776:
+.L1821:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1825
+.L1733:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %ebx
+	cmpl	$2, %ebx
+	jne	.L1826
+.L1737:
+	movl	$7, %edx
+	movl	$1000, %esi
+	movq	%r13, %rdi
+	call	_ZN1n12__avx2_countIiEEmPKT_mS1_
+	movq	%rax, %rbx
+	jmp	.L1741
+.L1775:
+.L1820:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1725
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1766
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1728:
+	movq	%rbp, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1725
+.L1819:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1721
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1764
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1723:
+	movq	%rbp, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1721
+.L1738:
+	movl	$7, %edx
+	movl	$1000, %esi
+	movq	%r13, %rdi
+	call	_ZN1n14__avx512_countIiEEmPKT_mS1_
+	movq	%rax, %rbx
+	jmp	.L1741
+.L1816:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1827
+.L1709:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	jmp	.L1707
+.L1825:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1733
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1768
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1735:
+	movq	%rbp, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1733
+.L1827:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1709
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1709
+.L1768:
+	movl	$3, %eax
+	jmp	.L1735
+.L1773:
+	movl	$3, %eax
+	jmp	.L1754
+.L1771:
+	movl	$3, %eax
+	jmp	.L1747
+.L1766:
+	movl	$3, %eax
+	jmp	.L1728
+.L1764:
+	movl	$3, %eax
+	jmp	.L1723
+.L1783:
+	movq	%rax, %rbx
+	jmp	.L1716
+.L1782:
+	movq	%rax, %rbx
+	jmp	.L1759
+	.section	.gcc_except_table
+.LLSDA6734:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6734-.LLSDACSB6734
+.LLSDACSB6734:
+	.uleb128 .LEHB17-.LFB6734
+	.uleb128 .LEHE17-.LEHB17
+	.uleb128 .L1782-.LFB6734
+	.uleb128 0
+	.uleb128 .LEHB18-.LFB6734
+	.uleb128 .LEHE18-.LEHB18
+	.uleb128 .L1783-.LFB6734
+	.uleb128 0
+.LLSDACSE6734:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6734
+	.type	_Z20test_simd_algorithmsv.cold, @function
+_Z20test_simd_algorithmsv.cold:
+.LFSB6734:
+.L1811:
+	.cfi_def_cfa_offset 96
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+.L1778:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC71(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB19:
+	call	__cxa_throw@PLT
+.L1779:
+.L1755:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC72(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L1810:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC70(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE19:
+.L1780:
+	movq	%rax, %rbx
+.L1717:
+	testq	%r13, %r13
+	je	.L1760
+.L1781:
+	movq	(%r15), %rax
+	movl	$4, %ecx
+	movq	%r13, %rsi
+	movq	%r15, %rdi
+	leaq	0(,%r12,4), %rdx
+	call	*24(%rax)
+.L1760:
+	movq	%rbx, %rdi
+.LEHB20:
+	call	_Unwind_Resume@PLT
+.LEHE20:
+.L1716:
+	movq	24(%rsp), %r12
+	movq	(%rsp), %r13
+	jmp	.L1717
+.L1759:
+	movq	24(%rsp), %r12
+	jmp	.L1717
+	.cfi_endproc
+.LFE6734:
+	.section	.gcc_except_table
+.LLSDAC6734:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6734-.LLSDACSBC6734
+.LLSDACSBC6734:
+	.uleb128 .LEHB19-.LCOLDB73
+	.uleb128 .LEHE19-.LEHB19
+	.uleb128 .L1780-.LCOLDB73
+	.uleb128 0
+	.uleb128 .LEHB20-.LCOLDB73
+	.uleb128 .LEHE20-.LEHB20
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6734:
+	.section	.text.unlikely
+	.text
+	.size	_Z20test_simd_algorithmsv, .-_Z20test_simd_algorithmsv
+	.section	.text.unlikely
+	.size	_Z20test_simd_algorithmsv.cold, .-_Z20test_simd_algorithmsv.cold
+.LCOLDE73:
+	.text
+.LHOTE73:
+	.section	.text._ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE.constprop.0,"axG",@progbits,_Z16check_find_countIiEvN1n8simd_isaE,comdat
+	.p2align 4
+	.type	_ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE.constprop.0, @function
+_ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE.constprop.0:
+.LFB6989:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movl	%edx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1874
+.L1830:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	jge	.L1875
+.L1860:
+	cmpl	$2, %r12d
+	je	.L1841
+.L1880:
+	cmpl	$3, %r12d
+	je	.L1842
+	xorl	%eax, %eax
+	cmpl	$1, %r12d
+	je	.L1856
+	testq	%rbp, %rbp
+	jne	.L1844
+.L1858:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	$-1, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1876:
+	.cfi_restore_state
+	addq	$1, %rax
+	cmpq	%rax, %rbp
+	je	.L1858
+.L1844:
+	cmpl	$9, (%rbx,%rax,4)
+	jne	.L1876
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1856:
+	.cfi_restore_state
+	movdqa	.LC67(%rip), %xmm2
+	jmp	.L1843
+	.p2align 4,,10
+	.p2align 3
+.L1847:
+	movdqu	-64(%rbx,%rax,4), %xmm0
+	movdqu	-48(%rbx,%rax,4), %xmm1
+	movdqu	-16(%rbx,%rax,4), %xmm3
+	pcmpeqd	%xmm2, %xmm1
+	pcmpeqd	%xmm2, %xmm0
+	pcmpeqd	%xmm2, %xmm3
+	por	%xmm1, %xmm0
+	movdqu	-32(%rbx,%rax,4), %xmm1
+	pcmpeqd	%xmm2, %xmm1
+	por	%xmm3, %xmm1
+	por	%xmm1, %xmm0
+	pmovmskb	%xmm0, %ecx
+	testl	%ecx, %ecx
+	jne	.L1846
+.L1843:
+	movq	%rax, %rdx
+	addq	$16, %rax
+	cmpq	%rax, %rbp
+	jnb	.L1847
+.L1846:
+	movdqa	.LC67(%rip), %xmm1
+	jmp	.L1848
+	.p2align 4,,10
+	.p2align 3
+.L1849:
+	movdqu	-16(%rbx,%rdx,4), %xmm0
+	pcmpeqd	%xmm1, %xmm0
+	pmovmskb	%xmm0, %ecx
+	testl	%ecx, %ecx
+	jne	.L1877
+.L1848:
+	movq	%rdx, %rax
+	leaq	4(%rdx), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L1849
+	subq	%rax, %rbp
+	je	.L1858
+	leaq	(%rbx,%rax,4), %rcx
+	xorl	%edx, %edx
+	jmp	.L1851
+	.p2align 4,,10
+	.p2align 3
+.L1878:
+	addq	$1, %rdx
+	cmpq	%rdx, %rbp
+	je	.L1858
+.L1851:
+	cmpl	$9, (%rcx,%rdx,4)
+	jne	.L1878
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	addq	%rdx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.L1859:
+	.p2align 4,,10
+	.p2align 3
+.L1875:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1879
+.L1837:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	cmpl	$2, %r12d
+	jne	.L1880
+.L1841:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movl	$9, %edx
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n11__avx2_findIiEEmPKT_mS1_
+	.p2align 4,,10
+	.p2align 3
+.L1874:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1830
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1852
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1832:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1830
+	.p2align 4,,10
+	.p2align 3
+.L1842:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movl	$9, %edx
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n13__avx512_findIiEEmPKT_mS1_
+	.p2align 4,,10
+	.p2align 3
+.L1877:
+	.cfi_restore_state
+	rep bsfl	%ecx, %ecx
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movslq	%ecx, %rcx
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	shrq	$2, %rcx
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	addq	%rcx, %rax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1879:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1837
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1854
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1839:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1837
+.L1854:
+	movl	$3, %eax
+	jmp	.L1839
+.L1852:
+	movl	$3, %eax
+	jmp	.L1832
+	.cfi_endproc
+.LFE6989:
+	.size	_ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE.constprop.0, .-_ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	.section	.text._Z16check_find_countIiEvN1n8simd_isaE,"axG",@progbits,_Z16check_find_countIiEvN1n8simd_isaE,comdat
+	.p2align 4
+	.weak	_Z16check_find_countIiEvN1n8simd_isaE
+	.type	_Z16check_find_countIiEvN1n8simd_isaE, @function
+_Z16check_find_countIiEvN1n8simd_isaE:
+.LFB6788:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$154, %ecx
+	xorl	%eax, %eax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movl	%edi, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$1304, %rsp
+	.cfi_def_cfa_offset 1360
+	leaq	64(%rsp), %rdi
+	leaq	64(%rsp), %r15
+	movq	$0, 48(%rsp)
+	rep stosq
+	movq	%r15, 56(%rsp)
+.L1928:
+	movq	56(%rsp), %rax
+	movq	48(%rsp), %rsi
+	movq	$-1, %rbx
+	xorl	%r14d, %r14d
+	leaq	(%rax,%rsi,4), %rax
+	movq	%rax, 32(%rsp)
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1970
+	.p2align 4,,10
+	.p2align 3
+.L1885:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	movl	%ebp, %eax
+	jge	.L1971
+.L1939:
+.L1889:
+	cmpl	$2, %eax
+	je	.L1896
+.L1977:
+	cmpl	$3, %eax
+	je	.L1897
+	cmpl	$1, %eax
+	je	.L1972
+	testq	%r14, %r14
+	je	.L1965
+	cmpq	$2, %rbx
+	jbe	.L1973
+	movq	%r14, %rdx
+	movq	32(%rsp), %rax
+	pxor	%xmm1, %xmm1
+	pxor	%xmm3, %xmm3
+	shrq	$2, %rdx
+	movdqa	.LC68(%rip), %xmm2
+	movdqa	.LC66(%rip), %xmm4
+	salq	$4, %rdx
+	addq	%rax, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L1912:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqd	%xmm2, %xmm0
+	pand	%xmm4, %xmm0
+	movdqa	%xmm0, %xmm5
+	punpckldq	%xmm3, %xmm0
+	punpckhdq	%xmm3, %xmm5
+	paddq	%xmm5, %xmm0
+	paddq	%xmm0, %xmm1
+	cmpq	%rax, %rdx
+	jne	.L1912
+	movdqa	%xmm1, %xmm0
+	movq	%r14, %rax
+	psrldq	$8, %xmm0
+	andq	$-4, %rax
+	paddq	%xmm0, %xmm1
+	movq	%xmm1, %r13
+	testb	$3, %r14b
+	je	.L1913
+	xorl	%edi, %edi
+	cmpl	$3, (%r15,%rax,4)
+	leaq	0(,%rax,4), %rcx
+	sete	%dil
+	addq	%rdi, %r13
+	leaq	1(%rax), %rdi
+	cmpq	%r14, %rdi
+	jnb	.L1908
+.L1911:
+	xorl	%edi, %edi
+	cmpl	$3, 4(%r15,%rcx)
+	sete	%dil
+	addq	$2, %rax
+	addq	%rdi, %r13
+	cmpq	%r14, %rax
+	jnb	.L1908
+	xorl	%eax, %eax
+	cmpl	$3, 8(%r15,%rcx)
+	sete	%al
+	addq	%rax, %r13
+.L1905:
+	cmpq	$2, %rbx
+	jbe	.L1930
+	.p2align 4,,10
+	.p2align 3
+.L1968:
+	movdqa	.LC68(%rip), %xmm2
+	movdqa	.LC66(%rip), %xmm4
+.L1913:
+	movq	%r14, %rcx
+	pxor	%xmm1, %xmm1
+	pxor	%xmm3, %xmm3
+	movq	%r15, %rax
+	shrq	$2, %rcx
+	salq	$4, %rcx
+	addq	%r15, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L1918:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqd	%xmm2, %xmm0
+	pand	%xmm4, %xmm0
+	movdqa	%xmm0, %xmm5
+	punpckldq	%xmm3, %xmm0
+	punpckhdq	%xmm3, %xmm5
+	paddq	%xmm5, %xmm0
+	paddq	%xmm0, %xmm1
+	cmpq	%rax, %rcx
+	jne	.L1918
+	movdqa	%xmm1, %xmm0
+	movq	%r14, %rcx
+	psrldq	$8, %xmm0
+	andq	$-4, %rcx
+	paddq	%xmm0, %xmm1
+	movq	%xmm1, %rax
+	testb	$3, %r14b
+	je	.L1916
+.L1917:
+	xorl	%r9d, %r9d
+	cmpl	$3, (%r15,%rcx,4)
+	leaq	0(,%rcx,4), %rdi
+	sete	%r9b
+	addq	%r9, %rax
+	leaq	1(%rcx), %r9
+	cmpq	%r14, %r9
+	jnb	.L1916
+.L1929:
+	xorl	%r9d, %r9d
+	cmpl	$3, 4(%r15,%rdi)
+	sete	%r9b
+	addq	$2, %rcx
+	addq	%r9, %rax
+	cmpq	%r14, %rcx
+	jnb	.L1916
+	xorl	%ecx, %ecx
+	cmpl	$3, 8(%r15,%rdi)
+	sete	%cl
+	addq	%rcx, %rax
+.L1916:
+	cmpq	%r13, %rax
+	jne	.L1974
+	movl	%ebp, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	_ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	$-1, %rax
+	jne	.L1922
+	testq	%r14, %r14
+	jne	.L1975
+.L1915:
+	addq	$7, %rbx
+	movl	$7, %r14d
+.L1926:
+	movabsq	$-3689348814741910323, %rdi
+	xorl	%ecx, %ecx
+	.p2align 4,,10
+	.p2align 3
+.L1883:
+	movq	%rcx, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	movq	%rcx, %rax
+	subq	%rdx, %rax
+	addl	$1, %eax
+	movl	%eax, (%r15,%rcx,4)
+	addq	$1, %rcx
+	cmpq	%r14, %rcx
+	jne	.L1883
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	jne	.L1885
+.L1970:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1885
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1931
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1887:
+	movq	%r12, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	movl	%ebp, %eax
+	jl	.L1889
+.L1938:
+	.p2align 4,,10
+	.p2align 3
+.L1971:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L1976
+.L1892:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %eax
+	cmpl	$2, %eax
+	jne	.L1977
+.L1896:
+	movl	$3, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	_ZN1n12__avx2_countIiEEmPKT_mS1_
+	movq	%rax, %r13
+	testq	%r14, %r14
+	je	.L1936
+.L1908:
+	cmpq	$2, %rbx
+	ja	.L1968
+.L1937:
+	xorl	%eax, %eax
+	xorl	%ecx, %ecx
+	jmp	.L1917
+	.p2align 4,,10
+	.p2align 3
+.L1975:
+	movl	$9, (%r15,%rbx,4)
+	movl	%ebp, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	_ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	%rax, %rbx
+	jne	.L1978
+	movq	%r14, %r12
+	movl	%ebp, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	shrq	%r12
+	movl	$9, (%r15,%r12,4)
+	call	_ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	%rax, %r12
+	jne	.L1979
+	addq	$7, %r14
+	addq	$7, %rbx
+	cmpq	$301, %r14
+	jne	.L1926
+	addq	$1, 48(%rsp)
+	movq	48(%rsp), %rax
+	addq	$4, %r15
+	cmpq	$8, %rax
+	jne	.L1928
+	addq	$1304, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1897:
+	.cfi_restore_state
+	movl	$3, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	_ZN1n14__avx512_countIiEEmPKT_mS1_
+	movq	%rax, %r13
+.L1903:
+	testq	%r14, %r14
+	jne	.L1908
+.L1936:
+	xorl	%eax, %eax
+	jmp	.L1916
+	.p2align 4,,10
+	.p2align 3
+.L1972:
+	cmpq	$3, %r14
+	jbe	.L1965
+	leaq	-4(%r14), %rax
+	movq	32(%rsp), %r12
+	movdqa	.LC68(%rip), %xmm2
+	xorl	%r13d, %r13d
+	movq	%rax, 40(%rsp)
+	shrq	$2, %rax
+	salq	$4, %rax
+	leaq	16(%r12,%rax), %rax
+	movq	%rax, 24(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1904:
+	movdqu	(%r12), %xmm0
+	movaps	%xmm2, (%rsp)
+	addq	$16, %r12
+	pcmpeqd	%xmm2, %xmm0
+	pmovmskb	%xmm0, %edi
+	call	__popcountdi2@PLT
+	movdqa	(%rsp), %xmm2
+	cltq
+	shrq	$2, %rax
+	addq	%rax, %r13
+	cmpq	%r12, 24(%rsp)
+	jne	.L1904
+	movq	40(%rsp), %r12
+	movq	%r14, %rdi
+	andq	$-4, %r12
+	addq	$4, %r12
+	subq	%r12, %rdi
+	je	.L1905
+	cmpq	$3, %rdi
+	jbe	.L1935
+	movq	48(%rsp), %rax
+	movq	%rdi, %rcx
+	pxor	%xmm1, %xmm1
+	pxor	%xmm3, %xmm3
+	movq	56(%rsp), %rsi
+	shrq	$2, %rcx
+	movdqa	.LC66(%rip), %xmm4
+	addq	%r12, %rax
+	salq	$4, %rcx
+	leaq	(%rsi,%rax,4), %rax
+	addq	%rax, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L1907:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqd	%xmm2, %xmm0
+	pand	%xmm4, %xmm0
+	movdqa	%xmm0, %xmm5
+	punpckhdq	%xmm3, %xmm0
+	punpckldq	%xmm3, %xmm5
+	paddq	%xmm5, %xmm0
+	paddq	%xmm0, %xmm1
+	cmpq	%rax, %rcx
+	jne	.L1907
+	movdqa	%xmm1, %xmm0
+	movq	%rdi, %rcx
+	psrldq	$8, %xmm0
+	andq	$-4, %rcx
+	paddq	%xmm0, %xmm1
+	movq	%xmm1, %rax
+	testb	$3, %dil
+	je	.L1980
+.L1906:
+	leaq	(%r12,%rcx), %r9
+	cmpl	$3, (%r15,%r9,4)
+	sete	%r9b
+	movzbl	%r9b, %r9d
+	addq	%r9, %rax
+	leaq	1(%rcx), %r9
+	cmpq	%rdi, %r9
+	jnb	.L1909
+	addq	%r12, %r9
+	cmpl	$3, (%r15,%r9,4)
+	sete	%r9b
+	addq	$2, %rcx
+	movzbl	%r9b, %r9d
+	addq	%r9, %rax
+	cmpq	%rdi, %rcx
+	jnb	.L1909
+	addq	%rcx, %r12
+	xorl	%ecx, %ecx
+	cmpl	$3, (%r15,%r12,4)
+	sete	%cl
+	addq	%rcx, %rax
+.L1909:
+	addq	%rax, %r13
+	jmp	.L1903
+	.p2align 4,,10
+	.p2align 3
+.L1976:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1892
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L1933
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L1894:
+	movq	%r12, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1892
+.L1980:
+	addq	%rax, %r13
+	cmpq	$2, %rbx
+	ja	.L1968
+	jmp	.L1937
+.L1965:
+	xorl	%esi, %esi
+	movl	%ebp, %edx
+	movq	%r15, %rdi
+	call	_ZN1n9simd_findIiEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	$-1, %rax
+	je	.L1915
+.L1922:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC54(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L1973:
+	xorl	%r13d, %r13d
+	cmpl	$3, (%r15)
+	sete	%r13b
+	xorl	%eax, %eax
+	xorl	%ecx, %ecx
+	jmp	.L1911
+.L1931:
+	movl	$3, %eax
+	jmp	.L1887
+.L1930:
+	xorl	%eax, %eax
+	cmpl	$3, (%r15)
+	sete	%al
+	xorl	%ecx, %ecx
+	xorl	%edi, %edi
+	jmp	.L1929
+.L1933:
+	movl	$3, %eax
+	jmp	.L1894
+.L1935:
+	xorl	%eax, %eax
+	xorl	%ecx, %ecx
+	jmp	.L1906
+.L1974:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC55(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L1979:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC57(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L1978:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC56(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.cfi_endproc
+.LFE6788:
+	.size	_Z16check_find_countIiEvN1n8simd_isaE, .-_Z16check_find_countIiEvN1n8simd_isaE
+	.section	.text._ZN1n14__avx512_countIjEEmPKT_mS1_,"axG",@progbits,_ZN1n14__avx512_countIjEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n14__avx512_countIjEEmPKT_mS1_
+	.type	_ZN1n14__avx512_countIjEEmPKT_mS1_, @function
+_ZN1n14__avx512_countIjEEmPKT_mS1_:
+.LFB6898:
+	.cfi_startproc
+	movq	%rsi, %r8
+	vpbroadcastd	%edx, %zmm2
+	movl	$16, %eax
+	xorl	%r9d, %r9d
+	cmpq	$15, %rsi
+	jbe	.L2004
+	.p2align 4,,10
+	.p2align 3
+.L1985:
+	vmovdqu32	-64(%rdi,%rax,4), %zmm5
+	vpcmpd	$0, %zmm2, %zmm5, %k0
+	kmovw	%k0, %ecx
+	popcntq	%rcx, %rcx
+	addq	%rcx, %r9
+	movq	%rax, %rcx
+	leaq	16(%rax), %rax
+	cmpq	%rax, %r8
+	jnb	.L1985
+	subq	%rcx, %r8
+	je	.L1981
+	leaq	-1(%r8), %rax
+	cmpq	$14, %rax
+	jbe	.L1991
+	movq	%r8, %rsi
+	leaq	(%rdi,%rcx,4), %rax
+	movl	$1, %r10d
+	shrq	$4, %rsi
+	vpxor	%xmm3, %xmm3, %xmm3
+	vpbroadcastd	%r10d, %zmm4
+	salq	$6, %rsi
+	addq	%rax, %rsi
+	.p2align 4,,10
+	.p2align 3
+.L1986:
+	vpcmpd	$0, (%rax), %zmm2, %k1
+	addq	$64, %rax
+	vmovdqa32	%zmm4, %zmm0{%k1}{z}
+	vpmovzxdq	%ymm0, %zmm1
+	vextracti64x4	$0x1, %zmm0, %ymm0
+	vpmovzxdq	%ymm0, %zmm0
+	vpaddq	%zmm0, %zmm1, %zmm1
+	vpaddq	%zmm1, %zmm3, %zmm3
+	cmpq	%rax, %rsi
+	jne	.L1986
+	vmovdqa	%ymm3, %ymm2
+	vextracti64x4	$0x1, %zmm3, %ymm3
+	movq	%r8, %rsi
+	vpaddq	%ymm3, %ymm2, %ymm2
+	andq	$-16, %rsi
+	vextracti128	$0x1, %ymm2, %xmm1
+	vpaddq	%xmm1, %xmm2, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rax
+	testb	$15, %r8b
+	je	.L1987
+.L1983:
+	movq	%r8, %r10
+	subq	%rsi, %r10
+	leaq	-1(%r10), %r11
+	cmpq	$6, %r11
+	jbe	.L1988
+	vmovd	%edx, %xmm1
+	leaq	(%rcx,%rsi), %rax
+	movq	%r10, %r11
+	vpbroadcastd	%xmm1, %ymm1
+	andq	$-8, %r11
+	vpcmpeqd	(%rdi,%rax,4), %ymm1, %ymm1
+	movl	$1, %eax
+	addq	%r11, %rsi
+	andl	$7, %r10d
+	vmovd	%eax, %xmm0
+	vpbroadcastd	%xmm0, %ymm0
+	vpand	%ymm0, %ymm1, %ymm1
+	vpmovzxdq	%xmm1, %ymm0
+	vextracti128	$0x1, %ymm1, %xmm1
+	vpmovzxdq	%xmm1, %ymm1
+	vpaddq	%ymm1, %ymm0, %ymm0
+	vpaddq	%ymm2, %ymm0, %ymm0
+	vmovdqa	%xmm0, %xmm1
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpaddq	%xmm0, %xmm1, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rax
+	je	.L1987
+.L1988:
+	leaq	(%rcx,%rsi), %r10
+	cmpl	%edx, (%rdi,%r10,4)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	1(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1987
+	addq	%rcx, %r10
+	cmpl	%edx, (%rdi,%r10,4)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	2(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1987
+	addq	%rcx, %r10
+	cmpl	%edx, (%rdi,%r10,4)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	3(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1987
+	addq	%rcx, %r10
+	cmpl	%edx, (%rdi,%r10,4)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	4(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1987
+	addq	%rcx, %r10
+	cmpl	%edx, (%rdi,%r10,4)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	5(%rsi), %r10
+	cmpq	%r8, %r10
+	jnb	.L1987
+	addq	%rcx, %r10
+	cmpl	%edx, (%rdi,%r10,4)
+	sete	%r10b
+	addq	$6, %rsi
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	cmpq	%r8, %rsi
+	jnb	.L1987
+	addq	%rsi, %rcx
+	cmpl	%edx, (%rdi,%rcx,4)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+.L1987:
+	addq	%rax, %r9
+.L1981:
+	movq	%r9, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2004:
+	testq	%rsi, %rsi
+	je	.L1981
+	xorl	%ecx, %ecx
+	vpxor	%xmm2, %xmm2, %xmm2
+	xorl	%eax, %eax
+	xorl	%esi, %esi
+	jmp	.L1983
+.L1991:
+	vpxor	%xmm2, %xmm2, %xmm2
+	xorl	%eax, %eax
+	xorl	%esi, %esi
+	jmp	.L1983
+	.cfi_endproc
+.LFE6898:
+	.size	_ZN1n14__avx512_countIjEEmPKT_mS1_, .-_ZN1n14__avx512_countIjEEmPKT_mS1_
+	.section	.text._ZN1n12__avx2_countIjEEmPKT_mS1_,"axG",@progbits,_ZN1n12__avx2_countIjEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n12__avx2_countIjEEmPKT_mS1_
+	.type	_ZN1n12__avx2_countIjEEmPKT_mS1_, @function
+_ZN1n12__avx2_countIjEEmPKT_mS1_:
+.LFB6899:
+	.cfi_startproc
+	vmovd	%edx, %xmm2
+	movq	%rsi, %rcx
+	movl	%edx, %r9d
+	xorl	%esi, %esi
+	vpbroadcastd	%xmm2, %ymm2
+	movl	$8, %edx
+	cmpq	$7, %rcx
+	jbe	.L2028
+	.p2align 4,,10
+	.p2align 3
+.L2006:
+	vpcmpeqd	-32(%rdi,%rdx,4), %ymm2, %ymm0
+	vpmovmskb	%ymm0, %eax
+	popcntl	%eax, %eax
+	shrq	$2, %rax
+	addq	%rax, %rsi
+	movq	%rdx, %rax
+	leaq	8(%rdx), %rdx
+	cmpq	%rdx, %rcx
+	jnb	.L2006
+	subq	%rax, %rcx
+	je	.L2005
+	leaq	-1(%rcx), %rdx
+	cmpq	$6, %rdx
+	jbe	.L2015
+	movq	%rcx, %r8
+	movl	$1, %r10d
+	leaq	(%rdi,%rax,4), %rdx
+	shrq	$3, %r8
+	vmovd	%r10d, %xmm4
+	vpxor	%xmm3, %xmm3, %xmm3
+	salq	$5, %r8
+	vpbroadcastd	%xmm4, %ymm4
+	addq	%rdx, %r8
+	.p2align 4,,10
+	.p2align 3
+.L2009:
+	vpcmpeqd	(%rdx), %ymm2, %ymm0
+	addq	$32, %rdx
+	vpand	%ymm4, %ymm0, %ymm0
+	vpmovzxdq	%xmm0, %ymm1
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxdq	%xmm0, %ymm0
+	vpaddq	%ymm0, %ymm1, %ymm0
+	vpaddq	%ymm0, %ymm3, %ymm3
+	cmpq	%rdx, %r8
+	jne	.L2009
+	vmovdqa	%xmm3, %xmm2
+	vextracti128	$0x1, %ymm3, %xmm3
+	movq	%rcx, %r8
+	vpaddq	%xmm3, %xmm2, %xmm2
+	andq	$-8, %r8
+	vpsrldq	$8, %xmm2, %xmm0
+	vpaddq	%xmm0, %xmm2, %xmm0
+	vmovq	%xmm0, %rdx
+	testb	$7, %cl
+	je	.L2010
+.L2007:
+	movq	%rcx, %r10
+	subq	%r8, %r10
+	leaq	-1(%r10), %r11
+	cmpq	$2, %r11
+	jbe	.L2011
+	vmovd	%r9d, %xmm5
+	leaq	(%rax,%r8), %rdx
+	movq	%r10, %r11
+	vpshufd	$0, %xmm5, %xmm0
+	andq	$-4, %r11
+	vpcmpeqd	(%rdi,%rdx,4), %xmm0, %xmm0
+	movl	$1, %edx
+	addq	%r11, %r8
+	andl	$3, %r10d
+	vmovd	%edx, %xmm1
+	vpshufd	$0, %xmm1, %xmm1
+	vpand	%xmm1, %xmm0, %xmm0
+	vpmovzxdq	%xmm0, %xmm1
+	vpsrldq	$8, %xmm0, %xmm0
+	vpmovzxdq	%xmm0, %xmm0
+	vpaddq	%xmm0, %xmm1, %xmm0
+	vpaddq	%xmm2, %xmm0, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rdx
+	je	.L2010
+.L2011:
+	leaq	(%rax,%r8), %r10
+	cmpl	%r9d, (%rdi,%r10,4)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rdx
+	leaq	1(%r8), %r10
+	cmpq	%rcx, %r10
+	jnb	.L2010
+	addq	%rax, %r10
+	cmpl	%r9d, (%rdi,%r10,4)
+	sete	%r10b
+	addq	$2, %r8
+	movzbl	%r10b, %r10d
+	addq	%r10, %rdx
+	cmpq	%rcx, %r8
+	jnb	.L2010
+	addq	%r8, %rax
+	cmpl	%r9d, (%rdi,%rax,4)
+	sete	%al
+	movzbl	%al, %eax
+	addq	%rax, %rdx
+.L2010:
+	addq	%rdx, %rsi
+.L2005:
+	movq	%rsi, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2028:
+	testq	%rcx, %rcx
+	je	.L2005
+	xorl	%eax, %eax
+	vpxor	%xmm2, %xmm2, %xmm2
+	xorl	%edx, %edx
+	xorl	%r8d, %r8d
+	jmp	.L2007
+.L2015:
+	vpxor	%xmm2, %xmm2, %xmm2
+	xorl	%edx, %edx
+	xorl	%r8d, %r8d
+	jmp	.L2007
+	.cfi_endproc
+.LFE6899:
+	.size	_ZN1n12__avx2_countIjEEmPKT_mS1_, .-_ZN1n12__avx2_countIjEEmPKT_mS1_
+	.section	.text._ZN1n13__avx512_findIjEEmPKT_mS1_,"axG",@progbits,_ZN1n13__avx512_findIjEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n13__avx512_findIjEEmPKT_mS1_
+	.type	_ZN1n13__avx512_findIjEEmPKT_mS1_, @function
+_ZN1n13__avx512_findIjEEmPKT_mS1_:
+.LFB6901:
+	.cfi_startproc
+	vpbroadcastd	%edx, %zmm0
+	xorl	%ecx, %ecx
+	jmp	.L2030
+	.p2align 4,,10
+	.p2align 3
+.L2032:
+	vmovdqu32	-64(%rdi,%rcx,4), %zmm1
+	vpcmpd	$0, %zmm0, %zmm1, %k0
+	kortestq	%k0, %k0
+	jne	.L2039
+.L2030:
+	movq	%rcx, %rax
+	leaq	16(%rcx), %rcx
+	cmpq	%rcx, %rsi
+	jnb	.L2032
+	subq	%rax, %rsi
+	je	.L2035
+	leaq	(%rdi,%rax,4), %rdi
+	xorl	%ecx, %ecx
+	jmp	.L2034
+	.p2align 4,,10
+	.p2align 3
+.L2040:
+	addq	$1, %rcx
+	cmpq	%rcx, %rsi
+	je	.L2035
+.L2034:
+	cmpl	(%rdi,%rcx,4), %edx
+	jne	.L2040
+	addq	%rcx, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2035:
+	movq	$-1, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2039:
+	kmovq	%k0, %rdx
+	rep bsfq	%rdx, %rdx
+	movslq	%edx, %rdx
+	addq	%rdx, %rax
+	vzeroupper
+	ret
+	.cfi_endproc
+.LFE6901:
+	.size	_ZN1n13__avx512_findIjEEmPKT_mS1_, .-_ZN1n13__avx512_findIjEEmPKT_mS1_
+	.section	.text._ZN1n11__avx2_findIjEEmPKT_mS1_,"axG",@progbits,_ZN1n11__avx2_findIjEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n11__avx2_findIjEEmPKT_mS1_
+	.type	_ZN1n11__avx2_findIjEEmPKT_mS1_, @function
+_ZN1n11__avx2_findIjEEmPKT_mS1_:
+.LFB6902:
+	.cfi_startproc
+	vmovd	%edx, %xmm1
+	xorl	%eax, %eax
+	vpbroadcastd	%xmm1, %ymm1
+	jmp	.L2042
+	.p2align 4,,10
+	.p2align 3
+.L2044:
+	vpcmpeqd	-128(%rdi,%rax,4), %ymm1, %ymm2
+	vpcmpeqd	-96(%rdi,%rax,4), %ymm1, %ymm0
+	vpcmpeqd	-64(%rdi,%rax,4), %ymm1, %ymm3
+	vpor	%ymm2, %ymm0, %ymm0
+	vpcmpeqd	-32(%rdi,%rax,4), %ymm1, %ymm2
+	vpor	%ymm3, %ymm2, %ymm2
+	vpor	%ymm2, %ymm0, %ymm0
+	vptest	%ymm0, %ymm0
+	jne	.L2045
+.L2042:
+	movq	%rax, %rcx
+	addq	$32, %rax
+	cmpq	%rax, %rsi
+	jnb	.L2044
+	movq	%rcx, %rax
+	leaq	8(%rcx), %rcx
+	cmpq	%rcx, %rsi
+	jb	.L2057
+	.p2align 4,,10
+	.p2align 3
+.L2047:
+	vpcmpeqd	-32(%rdi,%rcx,4), %ymm1, %ymm0
+	vpmovmskb	%ymm0, %r8d
+	testl	%r8d, %r8d
+	jne	.L2058
+.L2045:
+	movq	%rcx, %rax
+	leaq	8(%rcx), %rcx
+	cmpq	%rcx, %rsi
+	jnb	.L2047
+.L2057:
+	subq	%rax, %rsi
+	je	.L2050
+	leaq	(%rdi,%rax,4), %rdi
+	xorl	%ecx, %ecx
+	jmp	.L2049
+	.p2align 4,,10
+	.p2align 3
+.L2059:
+	addq	$1, %rcx
+	cmpq	%rcx, %rsi
+	je	.L2050
+.L2049:
+	cmpl	(%rdi,%rcx,4), %edx
+	jne	.L2059
+	addq	%rcx, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2050:
+	movq	$-1, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2058:
+	rep bsfl	%r8d, %r8d
+	movslq	%r8d, %r8
+	shrq	$2, %r8
+	addq	%r8, %rax
+	vzeroupper
+	ret
+	.cfi_endproc
+.LFE6902:
+	.size	_ZN1n11__avx2_findIjEEmPKT_mS1_, .-_ZN1n11__avx2_findIjEEmPKT_mS1_
+	.section	.text._ZN1n9simd_findIjEEmPKT_mS1_NS_8simd_isaE.constprop.0,"axG",@progbits,_Z16check_find_countIjEvN1n8simd_isaE,comdat
+	.p2align 4
+	.type	_ZN1n9simd_findIjEEmPKT_mS1_NS_8simd_isaE.constprop.0, @function
+_ZN1n9simd_findIjEEmPKT_mS1_NS_8simd_isaE.constprop.0:
+.LFB6991:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movl	%edx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L2106
+.L2062:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	jge	.L2107
+.L2092:
+	cmpl	$2, %r12d
+	je	.L2073
+.L2112:
+	cmpl	$3, %r12d
+	je	.L2074
+	xorl	%eax, %eax
+	cmpl	$1, %r12d
+	je	.L2088
+	testq	%rbp, %rbp
+	jne	.L2076
+.L2090:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	$-1, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2108:
+	.cfi_restore_state
+	addq	$1, %rax
+	cmpq	%rax, %rbp
+	je	.L2090
+.L2076:
+	cmpl	$9, (%rbx,%rax,4)
+	jne	.L2108
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2088:
+	.cfi_restore_state
+	movdqa	.LC67(%rip), %xmm2
+	jmp	.L2075
+	.p2align 4,,10
+	.p2align 3
+.L2079:
+	movdqu	-64(%rbx,%rax,4), %xmm0
+	movdqu	-48(%rbx,%rax,4), %xmm1
+	movdqu	-16(%rbx,%rax,4), %xmm3
+	pcmpeqd	%xmm2, %xmm1
+	pcmpeqd	%xmm2, %xmm0
+	pcmpeqd	%xmm2, %xmm3
+	por	%xmm1, %xmm0
+	movdqu	-32(%rbx,%rax,4), %xmm1
+	pcmpeqd	%xmm2, %xmm1
+	por	%xmm3, %xmm1
+	por	%xmm1, %xmm0
+	pmovmskb	%xmm0, %ecx
+	testl	%ecx, %ecx
+	jne	.L2078
+.L2075:
+	movq	%rax, %rdx
+	addq	$16, %rax
+	cmpq	%rax, %rbp
+	jnb	.L2079
+.L2078:
+	movdqa	.LC67(%rip), %xmm1
+	jmp	.L2080
+	.p2align 4,,10
+	.p2align 3
+.L2081:
+	movdqu	-16(%rbx,%rdx,4), %xmm0
+	pcmpeqd	%xmm1, %xmm0
+	pmovmskb	%xmm0, %ecx
+	testl	%ecx, %ecx
+	jne	.L2109
+.L2080:
+	movq	%rdx, %rax
+	leaq	4(%rdx), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L2081
+	subq	%rax, %rbp
+	je	.L2090
+	leaq	(%rbx,%rax,4), %rcx
+	xorl	%edx, %edx
+	jmp	.L2083
+	.p2align 4,,10
+	.p2align 3
+.L2110:
+	addq	$1, %rdx
+	cmpq	%rdx, %rbp
+	je	.L2090
+.L2083:
+	cmpl	$9, (%rcx,%rdx,4)
+	jne	.L2110
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	addq	%rdx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.L2091:
+	.p2align 4,,10
+	.p2align 3
+.L2107:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L2111
+.L2069:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	cmpl	$2, %r12d
+	jne	.L2112
+.L2073:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movl	$9, %edx
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n11__avx2_findIjEEmPKT_mS1_
+	.p2align 4,,10
+	.p2align 3
+.L2106:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2062
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L2084
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L2064:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2062
+	.p2align 4,,10
+	.p2align 3
+.L2074:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movl	$9, %edx
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n13__avx512_findIjEEmPKT_mS1_
+	.p2align 4,,10
+	.p2align 3
+.L2109:
+	.cfi_restore_state
+	rep bsfl	%ecx, %ecx
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movslq	%ecx, %rcx
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	shrq	$2, %rcx
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	addq	%rcx, %rax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2111:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2069
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L2086
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L2071:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2069
+.L2086:
+	movl	$3, %eax
+	jmp	.L2071
+.L2084:
+	movl	$3, %eax
+	jmp	.L2064
+	.cfi_endproc
+.LFE6991:
+	.size	_ZN1n9simd_findIjEEmPKT_mS1_NS_8simd_isaE.constprop.0, .-_ZN1n9simd_findIjEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	.section	.text._Z16check_find_countIjEvN1n8simd_isaE,"axG",@progbits,_Z16check_find_countIjEvN1n8simd_isaE,comdat
+	.p2align 4
+	.weak	_Z16check_find_countIjEvN1n8simd_isaE
+	.type	_Z16check_find_countIjEvN1n8simd_isaE, @function
+_Z16check_find_countIjEvN1n8simd_isaE:
+.LFB6789:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$154, %ecx
+	xorl	%eax, %eax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movl	%edi, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$1304, %rsp
+	.cfi_def_cfa_offset 1360
+	leaq	64(%rsp), %rdi
+	leaq	64(%rsp), %r15
+	movq	$0, 48(%rsp)
+	rep stosq
+	movq	%r15, 56(%rsp)
+.L2160:
+	movq	56(%rsp), %rax
+	movq	48(%rsp), %rsi
+	movq	$-1, %rbx
+	xorl	%r14d, %r14d
+	leaq	(%rax,%rsi,4), %rax
+	movq	%rax, 32(%rsp)
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L2202
+	.p2align 4,,10
+	.p2align 3
+.L2117:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	movl	%ebp, %eax
+	jge	.L2203
+.L2171:
+.L2121:
+	cmpl	$2, %eax
+	je	.L2128
+.L2209:
+	cmpl	$3, %eax
+	je	.L2129
+	cmpl	$1, %eax
+	je	.L2204
+	testq	%r14, %r14
+	je	.L2197
+	cmpq	$2, %rbx
+	jbe	.L2205
+	movq	%r14, %rdx
+	movq	32(%rsp), %rax
+	pxor	%xmm1, %xmm1
+	pxor	%xmm3, %xmm3
+	shrq	$2, %rdx
+	movdqa	.LC68(%rip), %xmm2
+	movdqa	.LC66(%rip), %xmm4
+	salq	$4, %rdx
+	addq	%rax, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L2144:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqd	%xmm2, %xmm0
+	pand	%xmm4, %xmm0
+	movdqa	%xmm0, %xmm5
+	punpckhdq	%xmm3, %xmm0
+	punpckldq	%xmm3, %xmm5
+	paddq	%xmm5, %xmm0
+	paddq	%xmm0, %xmm1
+	cmpq	%rax, %rdx
+	jne	.L2144
+	movdqa	%xmm1, %xmm0
+	movq	%r14, %rax
+	psrldq	$8, %xmm0
+	andq	$-4, %rax
+	paddq	%xmm0, %xmm1
+	movq	%xmm1, %r13
+	testb	$3, %r14b
+	je	.L2145
+	xorl	%edi, %edi
+	cmpl	$3, (%r15,%rax,4)
+	leaq	0(,%rax,4), %rcx
+	sete	%dil
+	addq	%rdi, %r13
+	leaq	1(%rax), %rdi
+	cmpq	%r14, %rdi
+	jnb	.L2140
+.L2143:
+	xorl	%edi, %edi
+	cmpl	$3, 4(%r15,%rcx)
+	sete	%dil
+	addq	$2, %rax
+	addq	%rdi, %r13
+	cmpq	%r14, %rax
+	jnb	.L2140
+	xorl	%eax, %eax
+	cmpl	$3, 8(%r15,%rcx)
+	sete	%al
+	addq	%rax, %r13
+.L2137:
+	cmpq	$2, %rbx
+	jbe	.L2162
+	.p2align 4,,10
+	.p2align 3
+.L2200:
+	movdqa	.LC68(%rip), %xmm2
+	movdqa	.LC66(%rip), %xmm4
+.L2145:
+	movq	%r14, %rcx
+	pxor	%xmm1, %xmm1
+	pxor	%xmm3, %xmm3
+	movq	%r15, %rax
+	shrq	$2, %rcx
+	salq	$4, %rcx
+	addq	%r15, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L2150:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqd	%xmm2, %xmm0
+	pand	%xmm4, %xmm0
+	movdqa	%xmm0, %xmm5
+	punpckldq	%xmm3, %xmm0
+	punpckhdq	%xmm3, %xmm5
+	paddq	%xmm5, %xmm0
+	paddq	%xmm0, %xmm1
+	cmpq	%rax, %rcx
+	jne	.L2150
+	movdqa	%xmm1, %xmm0
+	movq	%r14, %rcx
+	psrldq	$8, %xmm0
+	andq	$-4, %rcx
+	paddq	%xmm0, %xmm1
+	movq	%xmm1, %rax
+	testb	$3, %r14b
+	je	.L2148
+.L2149:
+	xorl	%r9d, %r9d
+	cmpl	$3, (%r15,%rcx,4)
+	leaq	0(,%rcx,4), %rdi
+	sete	%r9b
+	addq	%r9, %rax
+	leaq	1(%rcx), %r9
+	cmpq	%r14, %r9
+	jnb	.L2148
+.L2161:
+	xorl	%r9d, %r9d
+	cmpl	$3, 4(%r15,%rdi)
+	sete	%r9b
+	addq	$2, %rcx
+	addq	%r9, %rax
+	cmpq	%r14, %rcx
+	jnb	.L2148
+	xorl	%ecx, %ecx
+	cmpl	$3, 8(%r15,%rdi)
+	sete	%cl
+	addq	%rcx, %rax
+.L2148:
+	cmpq	%r13, %rax
+	jne	.L2206
+	movl	%ebp, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	_ZN1n9simd_findIjEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	$-1, %rax
+	jne	.L2154
+	testq	%r14, %r14
+	jne	.L2207
+.L2147:
+	addq	$7, %rbx
+	movl	$7, %r14d
+.L2158:
+	movabsq	$-3689348814741910323, %rdi
+	xorl	%ecx, %ecx
+	.p2align 4,,10
+	.p2align 3
+.L2115:
+	movq	%rcx, %rax
+	mulq	%rdi
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	movq	%rcx, %rax
+	subq	%rdx, %rax
+	addl	$1, %eax
+	movl	%eax, (%r15,%rcx,4)
+	addq	$1, %rcx
+	cmpq	%r14, %rcx
+	jne	.L2115
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	jne	.L2117
+.L2202:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2117
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L2163
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L2119:
+	movq	%r12, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebp
+	movl	%ebp, %eax
+	jl	.L2121
+.L2170:
+	.p2align 4,,10
+	.p2align 3
+.L2203:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L2208
+.L2124:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %eax
+	cmpl	$2, %eax
+	jne	.L2209
+.L2128:
+	movl	$3, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	_ZN1n12__avx2_countIjEEmPKT_mS1_
+	movq	%rax, %r13
+	testq	%r14, %r14
+	je	.L2168
+.L2140:
+	cmpq	$2, %rbx
+	ja	.L2200
+.L2169:
+	xorl	%eax, %eax
+	xorl	%ecx, %ecx
+	jmp	.L2149
+	.p2align 4,,10
+	.p2align 3
+.L2207:
+	movl	$9, (%r15,%rbx,4)
+	movl	%ebp, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	_ZN1n9simd_findIjEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	%rax, %rbx
+	jne	.L2210
+	movq	%r14, %r12
+	movl	%ebp, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	shrq	%r12
+	movl	$9, (%r15,%r12,4)
+	call	_ZN1n9simd_findIjEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	%rax, %r12
+	jne	.L2211
+	addq	$7, %r14
+	addq	$7, %rbx
+	cmpq	$301, %r14
+	jne	.L2158
+	addq	$1, 48(%rsp)
+	movq	48(%rsp), %rax
+	addq	$4, %r15
+	cmpq	$8, %rax
+	jne	.L2160
+	addq	$1304, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2129:
+	.cfi_restore_state
+	movl	$3, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	_ZN1n14__avx512_countIjEEmPKT_mS1_
+	movq	%rax, %r13
+.L2135:
+	testq	%r14, %r14
+	jne	.L2140
+.L2168:
+	xorl	%eax, %eax
+	jmp	.L2148
+	.p2align 4,,10
+	.p2align 3
+.L2204:
+	cmpq	$3, %r14
+	jbe	.L2197
+	leaq	-4(%r14), %rax
+	movq	32(%rsp), %r12
+	movdqa	.LC68(%rip), %xmm2
+	xorl	%r13d, %r13d
+	movq	%rax, 40(%rsp)
+	shrq	$2, %rax
+	salq	$4, %rax
+	leaq	16(%r12,%rax), %rax
+	movq	%rax, 24(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L2136:
+	movdqu	(%r12), %xmm0
+	movaps	%xmm2, (%rsp)
+	addq	$16, %r12
+	pcmpeqd	%xmm2, %xmm0
+	pmovmskb	%xmm0, %edi
+	call	__popcountdi2@PLT
+	movdqa	(%rsp), %xmm2
+	cltq
+	shrq	$2, %rax
+	addq	%rax, %r13
+	cmpq	%r12, 24(%rsp)
+	jne	.L2136
+	movq	40(%rsp), %r12
+	movq	%r14, %rdi
+	andq	$-4, %r12
+	addq	$4, %r12
+	subq	%r12, %rdi
+	je	.L2137
+	cmpq	$3, %rdi
+	jbe	.L2167
+	movq	48(%rsp), %rax
+	movq	%rdi, %rcx
+	pxor	%xmm1, %xmm1
+	pxor	%xmm3, %xmm3
+	movq	56(%rsp), %rsi
+	shrq	$2, %rcx
+	movdqa	.LC66(%rip), %xmm4
+	addq	%r12, %rax
+	salq	$4, %rcx
+	leaq	(%rsi,%rax,4), %rax
+	addq	%rax, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L2139:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqd	%xmm2, %xmm0
+	pand	%xmm4, %xmm0
+	movdqa	%xmm0, %xmm5
+	punpckhdq	%xmm3, %xmm0
+	punpckldq	%xmm3, %xmm5
+	paddq	%xmm5, %xmm0
+	paddq	%xmm0, %xmm1
+	cmpq	%rax, %rcx
+	jne	.L2139
+	movdqa	%xmm1, %xmm0
+	movq	%rdi, %rcx
+	psrldq	$8, %xmm0
+	andq	$-4, %rcx
+	paddq	%xmm0, %xmm1
+	movq	%xmm1, %rax
+	testb	$3, %dil
+	je	.L2212
+.L2138:
+	leaq	(%r12,%rcx), %r9
+	cmpl	$3, (%r15,%r9,4)
+	sete	%r9b
+	movzbl	%r9b, %r9d
+	addq	%r9, %rax
+	leaq	1(%rcx), %r9
+	cmpq	%rdi, %r9
+	jnb	.L2141
+	addq	%r12, %r9
+	cmpl	$3, (%r15,%r9,4)
+	sete	%r9b
+	addq	$2, %rcx
+	movzbl	%r9b, %r9d
+	addq	%r9, %rax
+	cmpq	%rdi, %rcx
+	jnb	.L2141
+	addq	%rcx, %r12
+	xorl	%ecx, %ecx
+	cmpl	$3, (%r15,%r12,4)
+	sete	%cl
+	addq	%rcx, %rax
+.L2141:
+	addq	%rax, %r13
+	jmp	.L2135
+	.p2align 4,,10
+	.p2align 3
+.L2208:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2124
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L2165
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L2126:
+	movq	%r12, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2124
+.L2212:
+	addq	%rax, %r13
+	cmpq	$2, %rbx
+	ja	.L2200
+	jmp	.L2169
+.L2197:
+	xorl	%esi, %esi
+	movl	%ebp, %edx
+	movq	%r15, %rdi
+	call	_ZN1n9simd_findIjEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	$-1, %rax
+	je	.L2147
+.L2154:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC54(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L2205:
+	xorl	%r13d, %r13d
+	cmpl	$3, (%r15)
+	sete	%r13b
+	xorl	%eax, %eax
+	xorl	%ecx, %ecx
+	jmp	.L2143
+.L2163:
+	movl	$3, %eax
+	jmp	.L2119
+.L2162:
+	xorl	%eax, %eax
+	cmpl	$3, (%r15)
+	sete	%al
+	xorl	%ecx, %ecx
+	xorl	%edi, %edi
+	jmp	.L2161
+.L2165:
+	movl	$3, %eax
+	jmp	.L2126
+.L2167:
+	xorl	%eax, %eax
+	xorl	%ecx, %ecx
+	jmp	.L2138
+.L2206:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC55(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2211:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC57(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2210:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC56(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.cfi_endproc
+.LFE6789:
+	.size	_Z16check_find_countIjEvN1n8simd_isaE, .-_Z16check_find_countIjEvN1n8simd_isaE
+	.text
+	.p2align 4
+	.globl	_Z12test_simd_32v
+	.type	_Z12test_simd_32v, @function
+_Z12test_simd_32v:
+.LFB6725:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	xorl	%ebx, %ebx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	jmp	.L2214
+	.p2align 4,,10
+	.p2align 3
+.L2216:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebx
+	jg	.L2242
+.L2219:
+	movl	%ebx, %edi
+	addl	$1, %ebx
+	call	_Z16check_find_countIiEvN1n8simd_isaE
+.L2214:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	jne	.L2216
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2216
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L2229
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L2218:
+	movq	%rbp, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebx
+	jle	.L2219
+	.p2align 4,,10
+	.p2align 3
+.L2242:
+	xorl	%ebx, %ebx
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbp
+	jmp	.L2220
+	.p2align 4,,10
+	.p2align 3
+.L2223:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebx
+	jg	.L2243
+.L2233:
+.L2226:
+	movl	%ebx, %edi
+	addl	$1, %ebx
+	call	_Z16check_find_countIjEvN1n8simd_isaE
+.L2220:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	jne	.L2223
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2223
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L2231
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L2225:
+	movq	%rbp, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebx
+	jle	.L2226
+.L2243:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2229:
+	.cfi_restore_state
+	movl	$3, %eax
+	jmp	.L2218
+	.p2align 4,,10
+	.p2align 3
+.L2231:
+	movl	$3, %eax
+	jmp	.L2225
+.L2234:
+	.cfi_endproc
+.LFE6725:
+	.size	_Z12test_simd_32v, .-_Z12test_simd_32v
+	.section	.text._ZN1n14__avx512_countIlEEmPKT_mS1_,"axG",@progbits,_ZN1n14__avx512_countIlEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n14__avx512_countIlEEmPKT_mS1_
+	.type	_ZN1n14__avx512_countIlEEmPKT_mS1_, @function
+_ZN1n14__avx512_countIlEEmPKT_mS1_:
+.LFB6905:
+	.cfi_startproc
+	vpbroadcastq	%rdx, %zmm0
+	movl	$8, %eax
+	xorl	%r8d, %r8d
+	cmpq	$7, %rsi
+	jbe	.L2267
+	.p2align 4,,10
+	.p2align 3
+.L2248:
+	vmovdqu64	-64(%rdi,%rax,8), %zmm5
+	vpcmpq	$0, %zmm0, %zmm5, %k0
+	kmovw	%k0, %ecx
+	popcntq	%rcx, %rcx
+	addq	%rcx, %r8
+	movq	%rax, %rcx
+	leaq	8(%rax), %rax
+	cmpq	%rax, %rsi
+	jnb	.L2248
+	subq	%rcx, %rsi
+	je	.L2244
+	leaq	-1(%rsi), %rax
+	cmpq	$6, %rax
+	jbe	.L2254
+	movq	%rsi, %r9
+	leaq	(%rdi,%rcx,8), %rax
+	vpxor	%xmm1, %xmm1, %xmm1
+	shrq	$3, %r9
+	vpternlogd	$0xFF, %zmm3, %zmm3, %zmm3
+	salq	$6, %r9
+	addq	%rax, %r9
+	.p2align 4,,10
+	.p2align 3
+.L2249:
+	vpcmpq	$0, (%rax), %zmm0, %k1
+	addq	$64, %rax
+	vmovdqa64	%zmm3, %zmm2{%k1}{z}
+	vpsubq	%zmm2, %zmm1, %zmm1
+	cmpq	%r9, %rax
+	jne	.L2249
+	vmovdqa	%ymm1, %ymm0
+	vextracti64x4	$0x1, %zmm1, %ymm1
+	movq	%rsi, %r9
+	vpaddq	%ymm1, %ymm0, %ymm0
+	andq	$-8, %r9
+	vextracti128	$0x1, %ymm0, %xmm2
+	vpaddq	%xmm2, %xmm0, %xmm1
+	vpsrldq	$8, %xmm1, %xmm2
+	vpaddq	%xmm2, %xmm1, %xmm1
+	vmovq	%xmm1, %rax
+	testb	$7, %sil
+	je	.L2250
+.L2246:
+	movq	%rsi, %r10
+	subq	%r9, %r10
+	leaq	-1(%r10), %r11
+	cmpq	$2, %r11
+	jbe	.L2251
+	vmovq	%rdx, %xmm4
+	leaq	(%rcx,%r9), %rax
+	movq	%r10, %r11
+	vpbroadcastq	%xmm4, %ymm1
+	andq	$-4, %r11
+	vpcmpeqq	(%rdi,%rax,8), %ymm1, %ymm1
+	addq	%r11, %r9
+	andl	$3, %r10d
+	vpsubq	%ymm1, %ymm0, %ymm0
+	vmovdqa	%xmm0, %xmm1
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpaddq	%xmm0, %xmm1, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rax
+	je	.L2250
+.L2251:
+	leaq	(%rcx,%r9), %r10
+	cmpq	%rdx, (%rdi,%r10,8)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	1(%r9), %r10
+	cmpq	%rsi, %r10
+	jnb	.L2250
+	addq	%rcx, %r10
+	cmpq	%rdx, (%rdi,%r10,8)
+	sete	%r10b
+	addq	$2, %r9
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	cmpq	%rsi, %r9
+	jnb	.L2250
+	addq	%r9, %rcx
+	cmpq	%rdx, (%rdi,%rcx,8)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+.L2250:
+	addq	%rax, %r8
+.L2244:
+	movq	%r8, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2267:
+	testq	%rsi, %rsi
+	je	.L2244
+	xorl	%ecx, %ecx
+	vpxor	%xmm0, %xmm0, %xmm0
+	xorl	%eax, %eax
+	xorl	%r9d, %r9d
+	jmp	.L2246
+.L2254:
+	vpxor	%xmm0, %xmm0, %xmm0
+	xorl	%eax, %eax
+	xorl	%r9d, %r9d
+	jmp	.L2246
+	.cfi_endproc
+.LFE6905:
+	.size	_ZN1n14__avx512_countIlEEmPKT_mS1_, .-_ZN1n14__avx512_countIlEEmPKT_mS1_
+	.section	.text._ZN1n12__avx2_countIlEEmPKT_mS1_,"axG",@progbits,_ZN1n12__avx2_countIlEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n12__avx2_countIlEEmPKT_mS1_
+	.type	_ZN1n12__avx2_countIlEEmPKT_mS1_, @function
+_ZN1n12__avx2_countIlEEmPKT_mS1_:
+.LFB6906:
+	.cfi_startproc
+	vmovq	%rdx, %xmm3
+	movq	%rdx, %r9
+	xorl	%ecx, %ecx
+	movl	$4, %edx
+	vpbroadcastq	%xmm3, %ymm1
+	cmpq	$3, %rsi
+	jbe	.L2286
+	.p2align 4,,10
+	.p2align 3
+.L2269:
+	vpcmpeqq	-32(%rdi,%rdx,8), %ymm1, %ymm0
+	vpmovmskb	%ymm0, %eax
+	popcntl	%eax, %eax
+	shrq	$3, %rax
+	addq	%rax, %rcx
+	movq	%rdx, %rax
+	leaq	4(%rdx), %rdx
+	cmpq	%rdx, %rsi
+	jnb	.L2269
+	subq	%rax, %rsi
+	je	.L2268
+	leaq	-1(%rsi), %rdx
+	cmpq	$2, %rdx
+	jbe	.L2276
+	movq	%rsi, %r8
+	leaq	(%rdi,%rax,8), %rdx
+	vpxor	%xmm0, %xmm0, %xmm0
+	shrq	$2, %r8
+	salq	$5, %r8
+	addq	%rdx, %r8
+	.p2align 4,,10
+	.p2align 3
+.L2272:
+	vpcmpeqq	(%rdx), %ymm1, %ymm2
+	addq	$32, %rdx
+	vpsubq	%ymm2, %ymm0, %ymm0
+	cmpq	%rdx, %r8
+	jne	.L2272
+	vmovdqa	%xmm0, %xmm1
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpaddq	%xmm0, %xmm1, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rdx
+	testb	$3, %sil
+	je	.L2273
+	movq	%rsi, %r8
+	andq	$-4, %r8
+.L2270:
+	leaq	(%rax,%r8), %r10
+	cmpq	%r9, (%rdi,%r10,8)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rdx
+	leaq	1(%r8), %r10
+	cmpq	%rsi, %r10
+	jnb	.L2273
+	addq	%rax, %r10
+	cmpq	%r9, (%rdi,%r10,8)
+	sete	%r10b
+	addq	$2, %r8
+	movzbl	%r10b, %r10d
+	addq	%r10, %rdx
+	cmpq	%rsi, %r8
+	jnb	.L2273
+	addq	%r8, %rax
+	cmpq	%r9, (%rdi,%rax,8)
+	sete	%al
+	movzbl	%al, %eax
+	addq	%rax, %rdx
+.L2273:
+	addq	%rdx, %rcx
+.L2268:
+	movq	%rcx, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2286:
+	xorl	%eax, %eax
+	xorl	%edx, %edx
+	xorl	%r8d, %r8d
+	testq	%rsi, %rsi
+	jne	.L2270
+	jmp	.L2268
+.L2276:
+	xorl	%edx, %edx
+	xorl	%r8d, %r8d
+	jmp	.L2270
+	.cfi_endproc
+.LFE6906:
+	.size	_ZN1n12__avx2_countIlEEmPKT_mS1_, .-_ZN1n12__avx2_countIlEEmPKT_mS1_
+	.section	.text._ZN1n13__avx512_findIlEEmPKT_mS1_,"axG",@progbits,_ZN1n13__avx512_findIlEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n13__avx512_findIlEEmPKT_mS1_
+	.type	_ZN1n13__avx512_findIlEEmPKT_mS1_, @function
+_ZN1n13__avx512_findIlEEmPKT_mS1_:
+.LFB6908:
+	.cfi_startproc
+	xorl	%ecx, %ecx
+	vpbroadcastq	%rdx, %zmm0
+	jmp	.L2288
+	.p2align 4,,10
+	.p2align 3
+.L2290:
+	vmovdqu64	-64(%rdi,%rcx,8), %zmm1
+	vpcmpq	$0, %zmm0, %zmm1, %k0
+	kortestq	%k0, %k0
+	jne	.L2297
+.L2288:
+	movq	%rcx, %rax
+	leaq	8(%rcx), %rcx
+	cmpq	%rcx, %rsi
+	jnb	.L2290
+	subq	%rax, %rsi
+	je	.L2293
+	leaq	(%rdi,%rax,8), %rdi
+	xorl	%ecx, %ecx
+	jmp	.L2292
+	.p2align 4,,10
+	.p2align 3
+.L2298:
+	addq	$1, %rcx
+	cmpq	%rcx, %rsi
+	je	.L2293
+.L2292:
+	cmpq	(%rdi,%rcx,8), %rdx
+	jne	.L2298
+	addq	%rcx, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2293:
+	movq	$-1, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2297:
+	kmovq	%k0, %rdx
+	rep bsfq	%rdx, %rdx
+	movslq	%edx, %rdx
+	addq	%rdx, %rax
+	vzeroupper
+	ret
+	.cfi_endproc
+.LFE6908:
+	.size	_ZN1n13__avx512_findIlEEmPKT_mS1_, .-_ZN1n13__avx512_findIlEEmPKT_mS1_
+	.section	.text._ZN1n11__avx2_findIlEEmPKT_mS1_,"axG",@progbits,_ZN1n11__avx2_findIlEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n11__avx2_findIlEEmPKT_mS1_
+	.type	_ZN1n11__avx2_findIlEEmPKT_mS1_, @function
+_ZN1n11__avx2_findIlEEmPKT_mS1_:
+.LFB6909:
+	.cfi_startproc
+	vmovq	%rdx, %xmm4
+	xorl	%eax, %eax
+	vpbroadcastq	%xmm4, %ymm1
+	jmp	.L2300
+	.p2align 4,,10
+	.p2align 3
+.L2302:
+	vpcmpeqq	-128(%rdi,%rax,8), %ymm1, %ymm2
+	vpcmpeqq	-96(%rdi,%rax,8), %ymm1, %ymm0
+	vpcmpeqq	-64(%rdi,%rax,8), %ymm1, %ymm3
+	vpor	%ymm2, %ymm0, %ymm0
+	vpcmpeqq	-32(%rdi,%rax,8), %ymm1, %ymm2
+	vpor	%ymm3, %ymm2, %ymm2
+	vpor	%ymm2, %ymm0, %ymm0
+	vptest	%ymm0, %ymm0
+	jne	.L2303
+.L2300:
+	movq	%rax, %rcx
+	addq	$16, %rax
+	cmpq	%rax, %rsi
+	jnb	.L2302
+	movq	%rcx, %rax
+	leaq	4(%rcx), %rcx
+	cmpq	%rcx, %rsi
+	jb	.L2315
+	.p2align 4,,10
+	.p2align 3
+.L2305:
+	vpcmpeqq	-32(%rdi,%rcx,8), %ymm1, %ymm0
+	vpmovmskb	%ymm0, %r8d
+	testl	%r8d, %r8d
+	jne	.L2316
+.L2303:
+	movq	%rcx, %rax
+	leaq	4(%rcx), %rcx
+	cmpq	%rcx, %rsi
+	jnb	.L2305
+.L2315:
+	subq	%rax, %rsi
+	je	.L2308
+	leaq	(%rdi,%rax,8), %rdi
+	xorl	%ecx, %ecx
+	jmp	.L2307
+	.p2align 4,,10
+	.p2align 3
+.L2317:
+	addq	$1, %rcx
+	cmpq	%rcx, %rsi
+	je	.L2308
+.L2307:
+	cmpq	(%rdi,%rcx,8), %rdx
+	jne	.L2317
+	addq	%rcx, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2308:
+	movq	$-1, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2316:
+	rep bsfl	%r8d, %r8d
+	movslq	%r8d, %r8
+	shrq	$3, %r8
+	addq	%r8, %rax
+	vzeroupper
+	ret
+	.cfi_endproc
+.LFE6909:
+	.size	_ZN1n11__avx2_findIlEEmPKT_mS1_, .-_ZN1n11__avx2_findIlEEmPKT_mS1_
+	.section	.text._ZN1n9simd_findIlEEmPKT_mS1_NS_8simd_isaE.constprop.0,"axG",@progbits,_Z16check_find_countIlEvN1n8simd_isaE,comdat
+	.p2align 4
+	.type	_ZN1n9simd_findIlEEmPKT_mS1_NS_8simd_isaE.constprop.0, @function
+_ZN1n9simd_findIlEEmPKT_mS1_NS_8simd_isaE.constprop.0:
+.LFB6993:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movl	%edx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L2364
+.L2320:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	jge	.L2365
+.L2350:
+	cmpl	$2, %r12d
+	je	.L2331
+.L2370:
+	cmpl	$3, %r12d
+	je	.L2332
+	xorl	%eax, %eax
+	cmpl	$1, %r12d
+	je	.L2346
+	testq	%rbp, %rbp
+	jne	.L2334
+.L2348:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	$-1, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2366:
+	.cfi_restore_state
+	addq	$1, %rax
+	cmpq	%rax, %rbp
+	je	.L2348
+.L2334:
+	cmpq	$9, (%rbx,%rax,8)
+	jne	.L2366
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2346:
+	.cfi_restore_state
+	movdqa	.LC74(%rip), %xmm4
+	jmp	.L2333
+	.p2align 4,,10
+	.p2align 3
+.L2337:
+	movdqu	-64(%rbx,%rax,8), %xmm1
+	movdqu	-48(%rbx,%rax,8), %xmm2
+	movdqu	-32(%rbx,%rax,8), %xmm0
+	movdqu	-16(%rbx,%rax,8), %xmm3
+	pcmpeqd	%xmm4, %xmm1
+	pcmpeqd	%xmm4, %xmm2
+	pcmpeqd	%xmm4, %xmm0
+	pcmpeqd	%xmm4, %xmm3
+	pshufd	$177, %xmm1, %xmm6
+	pshufd	$177, %xmm2, %xmm5
+	pshufd	$177, %xmm0, %xmm8
+	pshufd	$177, %xmm3, %xmm7
+	pand	%xmm6, %xmm1
+	pand	%xmm8, %xmm0
+	pand	%xmm7, %xmm3
+	pand	%xmm5, %xmm2
+	por	%xmm3, %xmm0
+	por	%xmm2, %xmm1
+	por	%xmm1, %xmm0
+	pmovmskb	%xmm0, %ecx
+	testl	%ecx, %ecx
+	jne	.L2336
+.L2333:
+	movq	%rax, %rdx
+	addq	$8, %rax
+	cmpq	%rax, %rbp
+	jnb	.L2337
+.L2336:
+	movdqa	.LC74(%rip), %xmm2
+	jmp	.L2338
+	.p2align 4,,10
+	.p2align 3
+.L2339:
+	movdqu	-16(%rbx,%rdx,8), %xmm0
+	pcmpeqd	%xmm2, %xmm0
+	pshufd	$177, %xmm0, %xmm1
+	pand	%xmm1, %xmm0
+	pmovmskb	%xmm0, %ecx
+	testl	%ecx, %ecx
+	jne	.L2367
+.L2338:
+	movq	%rdx, %rax
+	leaq	2(%rdx), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L2339
+	subq	%rax, %rbp
+	je	.L2348
+	leaq	(%rbx,%rax,8), %rcx
+	xorl	%edx, %edx
+	jmp	.L2341
+	.p2align 4,,10
+	.p2align 3
+.L2368:
+	addq	$1, %rdx
+	cmpq	%rdx, %rbp
+	je	.L2348
+.L2341:
+	cmpq	$9, (%rcx,%rdx,8)
+	jne	.L2368
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	addq	%rdx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.L2349:
+	.p2align 4,,10
+	.p2align 3
+.L2365:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L2369
+.L2327:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	cmpl	$2, %r12d
+	jne	.L2370
+.L2331:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movl	$9, %edx
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n11__avx2_findIlEEmPKT_mS1_
+	.p2align 4,,10
+	.p2align 3
+.L2364:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2320
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L2342
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L2322:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2320
+	.p2align 4,,10
+	.p2align 3
+.L2332:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movl	$9, %edx
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n13__avx512_findIlEEmPKT_mS1_
+	.p2align 4,,10
+	.p2align 3
+.L2367:
+	.cfi_restore_state
+	rep bsfl	%ecx, %ecx
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movslq	%ecx, %rcx
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	shrq	$3, %rcx
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	addq	%rcx, %rax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2369:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2327
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L2344
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L2329:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2327
+.L2344:
+	movl	$3, %eax
+	jmp	.L2329
+.L2342:
+	movl	$3, %eax
+	jmp	.L2322
+	.cfi_endproc
+.LFE6993:
+	.size	_ZN1n9simd_findIlEEmPKT_mS1_NS_8simd_isaE.constprop.0, .-_ZN1n9simd_findIlEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	.section	.text._Z16check_find_countIlEvN1n8simd_isaE,"axG",@progbits,_Z16check_find_countIlEvN1n8simd_isaE,comdat
+	.p2align 4
+	.weak	_Z16check_find_countIlEvN1n8simd_isaE
+	.type	_Z16check_find_countIlEvN1n8simd_isaE, @function
+_Z16check_find_countIlEvN1n8simd_isaE:
+.LFB6790:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	movl	$308, %ecx
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movabsq	$-3689348814741910323, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$2504, %rsp
+	.cfi_def_cfa_offset 2560
+	movl	%edi, 4(%rsp)
+	leaq	32(%rsp), %rdi
+	leaq	32(%rsp), %r15
+	rep stosq
+	leaq	96(%rsp), %rax
+	movq	%rax, 24(%rsp)
+.L2407:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	movq	%r15, %rbx
+	xorl	%r14d, %r14d
+	testb	%al, %al
+	je	.L2440
+	.p2align 4,,10
+	.p2align 3
+.L2375:
+	movl	4(%rsp), %eax
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %eax
+	jge	.L2441
+.L2415:
+.L2379:
+	cmpl	$2, %eax
+	je	.L2386
+.L2447:
+	cmpl	$3, %eax
+	je	.L2387
+	cmpl	$1, %eax
+	je	.L2442
+	movq	%r15, %rax
+	xorl	%r13d, %r13d
+	testq	%r14, %r14
+	je	.L2443
+	.p2align 4,,10
+	.p2align 3
+.L2391:
+	xorl	%edx, %edx
+	cmpq	$3, (%rax)
+	sete	%dl
+	addq	$8, %rax
+	addq	%rdx, %r13
+	cmpq	%rax, %rbx
+	jne	.L2391
+.L2395:
+	movq	%r15, %rax
+	xorl	%edx, %edx
+	.p2align 4,,10
+	.p2align 3
+.L2399:
+	xorl	%esi, %esi
+	cmpq	$3, (%rax)
+	sete	%sil
+	addq	$8, %rax
+	addq	%rsi, %rdx
+	cmpq	%rax, %rbx
+	jne	.L2399
+.L2398:
+	cmpq	%rdx, %r13
+	jne	.L2444
+	movl	4(%rsp), %r12d
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	movl	%r12d, %edx
+	call	_ZN1n9simd_findIlEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	$-1, %rax
+	jne	.L2401
+	testq	%r14, %r14
+	jne	.L2445
+.L2402:
+	leaq	7(%r14), %rsi
+	addq	$56, %rbx
+.L2405:
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L2373:
+	movq	%r14, %rax
+	mulq	%rbp
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	movq	%r14, %rax
+	subq	%rdx, %rax
+	addq	$1, %rax
+	movq	%rax, (%r15,%r14,8)
+	addq	$1, %r14
+	cmpq	%r14, %rsi
+	jne	.L2373
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	jne	.L2375
+.L2440:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2375
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L2408
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L2377:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	movl	4(%rsp), %eax
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %eax
+	jl	.L2379
+.L2414:
+	.p2align 4,,10
+	.p2align 3
+.L2441:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L2446
+.L2382:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %eax
+	cmpl	$2, %eax
+	jne	.L2447
+.L2386:
+	movl	$3, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	_ZN1n12__avx2_countIlEEmPKT_mS1_
+	movq	%rax, %r13
+	testq	%r14, %r14
+	jne	.L2395
+	xorl	%edx, %edx
+	jmp	.L2398
+	.p2align 4,,10
+	.p2align 3
+.L2445:
+	movq	$9, -8(%rbx)
+	movl	%r12d, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	_ZN1n9simd_findIlEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	movq	%rax, %rdx
+	leaq	-1(%r14), %rax
+	cmpq	%rax, %rdx
+	jne	.L2448
+	movq	%r14, %r13
+	movl	4(%rsp), %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	shrq	%r13
+	movq	$9, (%r15,%r13,8)
+	call	_ZN1n9simd_findIlEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	%rax, %r13
+	jne	.L2449
+	leaq	7(%r14), %rsi
+	addq	$56, %rbx
+	cmpq	$294, %r14
+	jne	.L2405
+	addq	$8, %r15
+	cmpq	%r15, 24(%rsp)
+	jne	.L2407
+	addq	$2504, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2442:
+	.cfi_restore_state
+	cmpq	$1, %r14
+	jbe	.L2450
+	leaq	-2(%r14), %rax
+	movq	%r15, %r12
+	xorl	%r13d, %r13d
+	movq	%rax, 16(%rsp)
+	shrq	%rax
+	salq	$4, %rax
+	leaq	16(%r15,%rax), %rax
+	movq	%rax, 8(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L2394:
+	movdqu	(%r12), %xmm0
+	addq	$16, %r12
+	pcmpeqd	.LC75(%rip), %xmm0
+	pshufd	$177, %xmm0, %xmm1
+	pand	%xmm1, %xmm0
+	pmovmskb	%xmm0, %edi
+	call	__popcountdi2@PLT
+	cltq
+	shrq	$3, %rax
+	addq	%rax, %r13
+	cmpq	%r12, 8(%rsp)
+	jne	.L2394
+	movq	16(%rsp), %rax
+	movq	%r14, %r10
+	andq	$-2, %rax
+	addq	$2, %rax
+	subq	%rax, %r10
+	je	.L2395
+	leaq	(%r15,%rax,8), %rdi
+	xorl	%edx, %edx
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L2396:
+	xorl	%esi, %esi
+	cmpq	$3, (%rdi,%rax,8)
+	sete	%sil
+	addq	$1, %rax
+	addq	%rsi, %rdx
+	cmpq	%r10, %rax
+	jb	.L2396
+	addq	%rdx, %r13
+.L2393:
+	testq	%r14, %r14
+	jne	.L2395
+	xorl	%edx, %edx
+	jmp	.L2398
+	.p2align 4,,10
+	.p2align 3
+.L2387:
+	movl	$3, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	_ZN1n14__avx512_countIlEEmPKT_mS1_
+	movq	%rax, %r13
+	jmp	.L2393
+	.p2align 4,,10
+	.p2align 3
+.L2446:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2382
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L2410
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L2384:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2382
+.L2443:
+	movl	4(%rsp), %edx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	_ZN1n9simd_findIlEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	$-1, %rax
+	jne	.L2401
+	addq	$56, %rbx
+	movl	$7, %esi
+	jmp	.L2405
+.L2408:
+	movl	$3, %eax
+	jmp	.L2377
+.L2410:
+	movl	$3, %eax
+	jmp	.L2384
+.L2450:
+	movl	4(%rsp), %edx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	_ZN1n9simd_findIlEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	$-1, %rax
+	je	.L2402
+.L2401:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC54(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2444:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC55(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2449:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC57(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2448:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC56(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.cfi_endproc
+.LFE6790:
+	.size	_Z16check_find_countIlEvN1n8simd_isaE, .-_Z16check_find_countIlEvN1n8simd_isaE
+	.section	.text._ZN1n14__avx512_countIyEEmPKT_mS1_,"axG",@progbits,_ZN1n14__avx512_countIyEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n14__avx512_countIyEEmPKT_mS1_
+	.type	_ZN1n14__avx512_countIyEEmPKT_mS1_, @function
+_ZN1n14__avx512_countIyEEmPKT_mS1_:
+.LFB6912:
+	.cfi_startproc
+	vpbroadcastq	%rdx, %zmm0
+	movl	$8, %eax
+	xorl	%r8d, %r8d
+	cmpq	$7, %rsi
+	jbe	.L2474
+	.p2align 4,,10
+	.p2align 3
+.L2455:
+	vmovdqu64	-64(%rdi,%rax,8), %zmm5
+	vpcmpq	$0, %zmm0, %zmm5, %k0
+	kmovw	%k0, %ecx
+	popcntq	%rcx, %rcx
+	addq	%rcx, %r8
+	movq	%rax, %rcx
+	leaq	8(%rax), %rax
+	cmpq	%rax, %rsi
+	jnb	.L2455
+	subq	%rcx, %rsi
+	je	.L2451
+	leaq	-1(%rsi), %rax
+	cmpq	$6, %rax
+	jbe	.L2461
+	movq	%rsi, %r9
+	leaq	(%rdi,%rcx,8), %rax
+	vpxor	%xmm1, %xmm1, %xmm1
+	shrq	$3, %r9
+	vpternlogd	$0xFF, %zmm3, %zmm3, %zmm3
+	salq	$6, %r9
+	addq	%rax, %r9
+	.p2align 4,,10
+	.p2align 3
+.L2456:
+	vpcmpq	$0, (%rax), %zmm0, %k1
+	addq	$64, %rax
+	vmovdqa64	%zmm3, %zmm2{%k1}{z}
+	vpsubq	%zmm2, %zmm1, %zmm1
+	cmpq	%r9, %rax
+	jne	.L2456
+	vmovdqa	%ymm1, %ymm0
+	vextracti64x4	$0x1, %zmm1, %ymm1
+	movq	%rsi, %r9
+	vpaddq	%ymm1, %ymm0, %ymm0
+	andq	$-8, %r9
+	vextracti128	$0x1, %ymm0, %xmm2
+	vpaddq	%xmm2, %xmm0, %xmm1
+	vpsrldq	$8, %xmm1, %xmm2
+	vpaddq	%xmm2, %xmm1, %xmm1
+	vmovq	%xmm1, %rax
+	testb	$7, %sil
+	je	.L2457
+.L2453:
+	movq	%rsi, %r10
+	subq	%r9, %r10
+	leaq	-1(%r10), %r11
+	cmpq	$2, %r11
+	jbe	.L2458
+	vmovq	%rdx, %xmm4
+	leaq	(%rcx,%r9), %rax
+	movq	%r10, %r11
+	vpbroadcastq	%xmm4, %ymm1
+	andq	$-4, %r11
+	vpcmpeqq	(%rdi,%rax,8), %ymm1, %ymm1
+	addq	%r11, %r9
+	andl	$3, %r10d
+	vpsubq	%ymm1, %ymm0, %ymm0
+	vmovdqa	%xmm0, %xmm1
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpaddq	%xmm0, %xmm1, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rax
+	je	.L2457
+.L2458:
+	leaq	(%rcx,%r9), %r10
+	cmpq	%rdx, (%rdi,%r10,8)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	leaq	1(%r9), %r10
+	cmpq	%rsi, %r10
+	jnb	.L2457
+	addq	%rcx, %r10
+	cmpq	%rdx, (%rdi,%r10,8)
+	sete	%r10b
+	addq	$2, %r9
+	movzbl	%r10b, %r10d
+	addq	%r10, %rax
+	cmpq	%rsi, %r9
+	jnb	.L2457
+	addq	%r9, %rcx
+	cmpq	%rdx, (%rdi,%rcx,8)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+.L2457:
+	addq	%rax, %r8
+.L2451:
+	movq	%r8, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2474:
+	testq	%rsi, %rsi
+	je	.L2451
+	xorl	%ecx, %ecx
+	vpxor	%xmm0, %xmm0, %xmm0
+	xorl	%eax, %eax
+	xorl	%r9d, %r9d
+	jmp	.L2453
+.L2461:
+	vpxor	%xmm0, %xmm0, %xmm0
+	xorl	%eax, %eax
+	xorl	%r9d, %r9d
+	jmp	.L2453
+	.cfi_endproc
+.LFE6912:
+	.size	_ZN1n14__avx512_countIyEEmPKT_mS1_, .-_ZN1n14__avx512_countIyEEmPKT_mS1_
+	.section	.text._ZN1n12__avx2_countIyEEmPKT_mS1_,"axG",@progbits,_ZN1n12__avx2_countIyEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n12__avx2_countIyEEmPKT_mS1_
+	.type	_ZN1n12__avx2_countIyEEmPKT_mS1_, @function
+_ZN1n12__avx2_countIyEEmPKT_mS1_:
+.LFB6913:
+	.cfi_startproc
+	vmovq	%rdx, %xmm3
+	movq	%rdx, %r9
+	xorl	%ecx, %ecx
+	movl	$4, %edx
+	vpbroadcastq	%xmm3, %ymm1
+	cmpq	$3, %rsi
+	jbe	.L2493
+	.p2align 4,,10
+	.p2align 3
+.L2476:
+	vpcmpeqq	-32(%rdi,%rdx,8), %ymm1, %ymm0
+	vpmovmskb	%ymm0, %eax
+	popcntl	%eax, %eax
+	shrq	$3, %rax
+	addq	%rax, %rcx
+	movq	%rdx, %rax
+	leaq	4(%rdx), %rdx
+	cmpq	%rdx, %rsi
+	jnb	.L2476
+	subq	%rax, %rsi
+	je	.L2475
+	leaq	-1(%rsi), %rdx
+	cmpq	$2, %rdx
+	jbe	.L2483
+	movq	%rsi, %r8
+	leaq	(%rdi,%rax,8), %rdx
+	vpxor	%xmm0, %xmm0, %xmm0
+	shrq	$2, %r8
+	salq	$5, %r8
+	addq	%rdx, %r8
+	.p2align 4,,10
+	.p2align 3
+.L2479:
+	vpcmpeqq	(%rdx), %ymm1, %ymm2
+	addq	$32, %rdx
+	vpsubq	%ymm2, %ymm0, %ymm0
+	cmpq	%rdx, %r8
+	jne	.L2479
+	vmovdqa	%xmm0, %xmm1
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpaddq	%xmm0, %xmm1, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rdx
+	testb	$3, %sil
+	je	.L2480
+	movq	%rsi, %r8
+	andq	$-4, %r8
+.L2477:
+	leaq	(%rax,%r8), %r10
+	cmpq	%r9, (%rdi,%r10,8)
+	sete	%r10b
+	movzbl	%r10b, %r10d
+	addq	%r10, %rdx
+	leaq	1(%r8), %r10
+	cmpq	%rsi, %r10
+	jnb	.L2480
+	addq	%rax, %r10
+	cmpq	%r9, (%rdi,%r10,8)
+	sete	%r10b
+	addq	$2, %r8
+	movzbl	%r10b, %r10d
+	addq	%r10, %rdx
+	cmpq	%rsi, %r8
+	jnb	.L2480
+	addq	%r8, %rax
+	cmpq	%r9, (%rdi,%rax,8)
+	sete	%al
+	movzbl	%al, %eax
+	addq	%rax, %rdx
+.L2480:
+	addq	%rdx, %rcx
+.L2475:
+	movq	%rcx, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2493:
+	xorl	%eax, %eax
+	xorl	%edx, %edx
+	xorl	%r8d, %r8d
+	testq	%rsi, %rsi
+	jne	.L2477
+	jmp	.L2475
+.L2483:
+	xorl	%edx, %edx
+	xorl	%r8d, %r8d
+	jmp	.L2477
+	.cfi_endproc
+.LFE6913:
+	.size	_ZN1n12__avx2_countIyEEmPKT_mS1_, .-_ZN1n12__avx2_countIyEEmPKT_mS1_
+	.section	.text._ZN1n13__avx512_findIyEEmPKT_mS1_,"axG",@progbits,_ZN1n13__avx512_findIyEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n13__avx512_findIyEEmPKT_mS1_
+	.type	_ZN1n13__avx512_findIyEEmPKT_mS1_, @function
+_ZN1n13__avx512_findIyEEmPKT_mS1_:
+.LFB6915:
+	.cfi_startproc
+	xorl	%ecx, %ecx
+	vpbroadcastq	%rdx, %zmm0
+	jmp	.L2495
+	.p2align 4,,10
+	.p2align 3
+.L2497:
+	vmovdqu64	-64(%rdi,%rcx,8), %zmm1
+	vpcmpq	$0, %zmm0, %zmm1, %k0
+	kortestq	%k0, %k0
+	jne	.L2504
+.L2495:
+	movq	%rcx, %rax
+	leaq	8(%rcx), %rcx
+	cmpq	%rcx, %rsi
+	jnb	.L2497
+	subq	%rax, %rsi
+	je	.L2500
+	leaq	(%rdi,%rax,8), %rdi
+	xorl	%ecx, %ecx
+	jmp	.L2499
+	.p2align 4,,10
+	.p2align 3
+.L2505:
+	addq	$1, %rcx
+	cmpq	%rcx, %rsi
+	je	.L2500
+.L2499:
+	cmpq	(%rdi,%rcx,8), %rdx
+	jne	.L2505
+	addq	%rcx, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2500:
+	movq	$-1, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2504:
+	kmovq	%k0, %rdx
+	rep bsfq	%rdx, %rdx
+	movslq	%edx, %rdx
+	addq	%rdx, %rax
+	vzeroupper
+	ret
+	.cfi_endproc
+.LFE6915:
+	.size	_ZN1n13__avx512_findIyEEmPKT_mS1_, .-_ZN1n13__avx512_findIyEEmPKT_mS1_
+	.section	.text._ZN1n11__avx2_findIyEEmPKT_mS1_,"axG",@progbits,_ZN1n11__avx2_findIyEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n11__avx2_findIyEEmPKT_mS1_
+	.type	_ZN1n11__avx2_findIyEEmPKT_mS1_, @function
+_ZN1n11__avx2_findIyEEmPKT_mS1_:
+.LFB6916:
+	.cfi_startproc
+	vmovq	%rdx, %xmm4
+	xorl	%eax, %eax
+	vpbroadcastq	%xmm4, %ymm1
+	jmp	.L2507
+	.p2align 4,,10
+	.p2align 3
+.L2509:
+	vpcmpeqq	-128(%rdi,%rax,8), %ymm1, %ymm2
+	vpcmpeqq	-96(%rdi,%rax,8), %ymm1, %ymm0
+	vpcmpeqq	-64(%rdi,%rax,8), %ymm1, %ymm3
+	vpor	%ymm2, %ymm0, %ymm0
+	vpcmpeqq	-32(%rdi,%rax,8), %ymm1, %ymm2
+	vpor	%ymm3, %ymm2, %ymm2
+	vpor	%ymm2, %ymm0, %ymm0
+	vptest	%ymm0, %ymm0
+	jne	.L2510
+.L2507:
+	movq	%rax, %rcx
+	addq	$16, %rax
+	cmpq	%rax, %rsi
+	jnb	.L2509
+	movq	%rcx, %rax
+	leaq	4(%rcx), %rcx
+	cmpq	%rcx, %rsi
+	jb	.L2522
+	.p2align 4,,10
+	.p2align 3
+.L2512:
+	vpcmpeqq	-32(%rdi,%rcx,8), %ymm1, %ymm0
+	vpmovmskb	%ymm0, %r8d
+	testl	%r8d, %r8d
+	jne	.L2523
+.L2510:
+	movq	%rcx, %rax
+	leaq	4(%rcx), %rcx
+	cmpq	%rcx, %rsi
+	jnb	.L2512
+.L2522:
+	subq	%rax, %rsi
+	je	.L2515
+	leaq	(%rdi,%rax,8), %rdi
+	xorl	%ecx, %ecx
+	jmp	.L2514
+	.p2align 4,,10
+	.p2align 3
+.L2524:
+	addq	$1, %rcx
+	cmpq	%rcx, %rsi
+	je	.L2515
+.L2514:
+	cmpq	(%rdi,%rcx,8), %rdx
+	jne	.L2524
+	addq	%rcx, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2515:
+	movq	$-1, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2523:
+	rep bsfl	%r8d, %r8d
+	movslq	%r8d, %r8
+	shrq	$3, %r8
+	addq	%r8, %rax
+	vzeroupper
+	ret
+	.cfi_endproc
+.LFE6916:
+	.size	_ZN1n11__avx2_findIyEEmPKT_mS1_, .-_ZN1n11__avx2_findIyEEmPKT_mS1_
+	.section	.text._ZN1n9simd_findIyEEmPKT_mS1_NS_8simd_isaE.constprop.0,"axG",@progbits,_Z16check_find_countIyEvN1n8simd_isaE,comdat
+	.p2align 4
+	.type	_ZN1n9simd_findIyEEmPKT_mS1_NS_8simd_isaE.constprop.0, @function
+_ZN1n9simd_findIyEEmPKT_mS1_NS_8simd_isaE.constprop.0:
+.LFB6995:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movl	%edx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L2571
+.L2527:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	jge	.L2572
+.L2557:
+	cmpl	$2, %r12d
+	je	.L2538
+.L2577:
+	cmpl	$3, %r12d
+	je	.L2539
+	xorl	%eax, %eax
+	cmpl	$1, %r12d
+	je	.L2553
+	testq	%rbp, %rbp
+	jne	.L2541
+.L2555:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	$-1, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2573:
+	.cfi_restore_state
+	addq	$1, %rax
+	cmpq	%rax, %rbp
+	je	.L2555
+.L2541:
+	cmpq	$9, (%rbx,%rax,8)
+	jne	.L2573
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2553:
+	.cfi_restore_state
+	movdqa	.LC74(%rip), %xmm4
+	jmp	.L2540
+	.p2align 4,,10
+	.p2align 3
+.L2544:
+	movdqu	-64(%rbx,%rax,8), %xmm1
+	movdqu	-48(%rbx,%rax,8), %xmm2
+	movdqu	-32(%rbx,%rax,8), %xmm0
+	movdqu	-16(%rbx,%rax,8), %xmm3
+	pcmpeqd	%xmm4, %xmm1
+	pcmpeqd	%xmm4, %xmm2
+	pcmpeqd	%xmm4, %xmm0
+	pcmpeqd	%xmm4, %xmm3
+	pshufd	$177, %xmm1, %xmm6
+	pshufd	$177, %xmm2, %xmm5
+	pshufd	$177, %xmm0, %xmm8
+	pshufd	$177, %xmm3, %xmm7
+	pand	%xmm6, %xmm1
+	pand	%xmm8, %xmm0
+	pand	%xmm7, %xmm3
+	pand	%xmm5, %xmm2
+	por	%xmm3, %xmm0
+	por	%xmm2, %xmm1
+	por	%xmm1, %xmm0
+	pmovmskb	%xmm0, %ecx
+	testl	%ecx, %ecx
+	jne	.L2543
+.L2540:
+	movq	%rax, %rdx
+	addq	$8, %rax
+	cmpq	%rax, %rbp
+	jnb	.L2544
+.L2543:
+	movdqa	.LC74(%rip), %xmm2
+	jmp	.L2545
+	.p2align 4,,10
+	.p2align 3
+.L2546:
+	movdqu	-16(%rbx,%rdx,8), %xmm0
+	pcmpeqd	%xmm2, %xmm0
+	pshufd	$177, %xmm0, %xmm1
+	pand	%xmm1, %xmm0
+	pmovmskb	%xmm0, %ecx
+	testl	%ecx, %ecx
+	jne	.L2574
+.L2545:
+	movq	%rdx, %rax
+	leaq	2(%rdx), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L2546
+	subq	%rax, %rbp
+	je	.L2555
+	leaq	(%rbx,%rax,8), %rcx
+	xorl	%edx, %edx
+	jmp	.L2548
+	.p2align 4,,10
+	.p2align 3
+.L2575:
+	addq	$1, %rdx
+	cmpq	%rdx, %rbp
+	je	.L2555
+.L2548:
+	cmpq	$9, (%rcx,%rdx,8)
+	jne	.L2575
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	addq	%rdx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.L2556:
+	.p2align 4,,10
+	.p2align 3
+.L2572:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L2576
+.L2534:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %r12d
+	cmpl	$2, %r12d
+	jne	.L2577
+.L2538:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movl	$9, %edx
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n11__avx2_findIyEEmPKT_mS1_
+	.p2align 4,,10
+	.p2align 3
+.L2571:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2527
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L2549
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L2529:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2527
+	.p2align 4,,10
+	.p2align 3
+.L2539:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movl	$9, %edx
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	jmp	_ZN1n13__avx512_findIyEEmPKT_mS1_
+	.p2align 4,,10
+	.p2align 3
+.L2574:
+	.cfi_restore_state
+	rep bsfl	%ecx, %ecx
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movslq	%ecx, %rcx
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	shrq	$3, %rcx
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	addq	%rcx, %rax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2576:
+	.cfi_restore_state
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2534
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L2551
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L2536:
+	movq	%r13, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2534
+.L2551:
+	movl	$3, %eax
+	jmp	.L2536
+.L2549:
+	movl	$3, %eax
+	jmp	.L2529
+	.cfi_endproc
+.LFE6995:
+	.size	_ZN1n9simd_findIyEEmPKT_mS1_NS_8simd_isaE.constprop.0, .-_ZN1n9simd_findIyEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	.section	.text._Z16check_find_countIyEvN1n8simd_isaE,"axG",@progbits,_Z16check_find_countIyEvN1n8simd_isaE,comdat
+	.p2align 4
+	.weak	_Z16check_find_countIyEvN1n8simd_isaE
+	.type	_Z16check_find_countIyEvN1n8simd_isaE, @function
+_Z16check_find_countIyEvN1n8simd_isaE:
+.LFB6791:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	movl	$308, %ecx
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movabsq	$-3689348814741910323, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$2504, %rsp
+	.cfi_def_cfa_offset 2560
+	movl	%edi, 4(%rsp)
+	leaq	32(%rsp), %rdi
+	leaq	32(%rsp), %r15
+	rep stosq
+	leaq	96(%rsp), %rax
+	movq	%rax, 24(%rsp)
+.L2614:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	movq	%r15, %rbx
+	xorl	%r14d, %r14d
+	testb	%al, %al
+	je	.L2647
+	.p2align 4,,10
+	.p2align 3
+.L2582:
+	movl	4(%rsp), %eax
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %eax
+	jge	.L2648
+.L2622:
+.L2586:
+	cmpl	$2, %eax
+	je	.L2593
+.L2654:
+	cmpl	$3, %eax
+	je	.L2594
+	cmpl	$1, %eax
+	je	.L2649
+	movq	%r15, %rax
+	xorl	%r13d, %r13d
+	testq	%r14, %r14
+	je	.L2650
+	.p2align 4,,10
+	.p2align 3
+.L2598:
+	xorl	%edx, %edx
+	cmpq	$3, (%rax)
+	sete	%dl
+	addq	$8, %rax
+	addq	%rdx, %r13
+	cmpq	%rax, %rbx
+	jne	.L2598
+.L2602:
+	movq	%r15, %rax
+	xorl	%edx, %edx
+	.p2align 4,,10
+	.p2align 3
+.L2606:
+	xorl	%esi, %esi
+	cmpq	$3, (%rax)
+	sete	%sil
+	addq	$8, %rax
+	addq	%rsi, %rdx
+	cmpq	%rax, %rbx
+	jne	.L2606
+.L2605:
+	cmpq	%rdx, %r13
+	jne	.L2651
+	movl	4(%rsp), %r12d
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	movl	%r12d, %edx
+	call	_ZN1n9simd_findIyEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	$-1, %rax
+	jne	.L2608
+	testq	%r14, %r14
+	jne	.L2652
+.L2609:
+	leaq	7(%r14), %rsi
+	addq	$56, %rbx
+.L2612:
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L2580:
+	movq	%r14, %rax
+	mulq	%rbp
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	movq	%r14, %rax
+	subq	%rdx, %rax
+	addq	$1, %rax
+	movq	%rax, (%r15,%r14,8)
+	addq	$1, %r14
+	cmpq	%r14, %rsi
+	jne	.L2580
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	jne	.L2582
+.L2647:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2582
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L2615
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L2584:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	movl	4(%rsp), %eax
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %eax
+	jl	.L2586
+.L2621:
+	.p2align 4,,10
+	.p2align 3
+.L2648:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L2653
+.L2589:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %eax
+	cmpl	$2, %eax
+	jne	.L2654
+.L2593:
+	movl	$3, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	_ZN1n12__avx2_countIyEEmPKT_mS1_
+	movq	%rax, %r13
+	testq	%r14, %r14
+	jne	.L2602
+	xorl	%edx, %edx
+	jmp	.L2605
+	.p2align 4,,10
+	.p2align 3
+.L2652:
+	movq	$9, -8(%rbx)
+	movl	%r12d, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	_ZN1n9simd_findIyEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	movq	%rax, %rdx
+	leaq	-1(%r14), %rax
+	cmpq	%rax, %rdx
+	jne	.L2655
+	movq	%r14, %r13
+	movl	4(%rsp), %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	shrq	%r13
+	movq	$9, (%r15,%r13,8)
+	call	_ZN1n9simd_findIyEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	%rax, %r13
+	jne	.L2656
+	leaq	7(%r14), %rsi
+	addq	$56, %rbx
+	cmpq	$294, %r14
+	jne	.L2612
+	addq	$8, %r15
+	cmpq	%r15, 24(%rsp)
+	jne	.L2614
+	addq	$2504, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2649:
+	.cfi_restore_state
+	cmpq	$1, %r14
+	jbe	.L2657
+	leaq	-2(%r14), %rax
+	movq	%r15, %r12
+	xorl	%r13d, %r13d
+	movq	%rax, 16(%rsp)
+	shrq	%rax
+	salq	$4, %rax
+	leaq	16(%r15,%rax), %rax
+	movq	%rax, 8(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L2601:
+	movdqu	(%r12), %xmm0
+	addq	$16, %r12
+	pcmpeqd	.LC75(%rip), %xmm0
+	pshufd	$177, %xmm0, %xmm1
+	pand	%xmm1, %xmm0
+	pmovmskb	%xmm0, %edi
+	call	__popcountdi2@PLT
+	cltq
+	shrq	$3, %rax
+	addq	%rax, %r13
+	cmpq	%r12, 8(%rsp)
+	jne	.L2601
+	movq	16(%rsp), %rax
+	movq	%r14, %r10
+	andq	$-2, %rax
+	addq	$2, %rax
+	subq	%rax, %r10
+	je	.L2602
+	leaq	(%r15,%rax,8), %rdi
+	xorl	%edx, %edx
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L2603:
+	xorl	%esi, %esi
+	cmpq	$3, (%rdi,%rax,8)
+	sete	%sil
+	addq	$1, %rax
+	addq	%rsi, %rdx
+	cmpq	%r10, %rax
+	jb	.L2603
+	addq	%rdx, %r13
+.L2600:
+	testq	%r14, %r14
+	jne	.L2602
+	xorl	%edx, %edx
+	jmp	.L2605
+	.p2align 4,,10
+	.p2align 3
+.L2594:
+	movl	$3, %edx
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	_ZN1n14__avx512_countIyEEmPKT_mS1_
+	movq	%rax, %r13
+	jmp	.L2600
+	.p2align 4,,10
+	.p2align 3
+.L2653:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2589
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L2617
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L2591:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2589
+.L2650:
+	movl	4(%rsp), %edx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	_ZN1n9simd_findIyEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	$-1, %rax
+	jne	.L2608
+	addq	$56, %rbx
+	movl	$7, %esi
+	jmp	.L2612
+.L2615:
+	movl	$3, %eax
+	jmp	.L2584
+.L2617:
+	movl	$3, %eax
+	jmp	.L2591
+.L2657:
+	movl	4(%rsp), %edx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	_ZN1n9simd_findIyEEmPKT_mS1_NS_8simd_isaE.constprop.0
+	cmpq	$-1, %rax
+	je	.L2609
+.L2608:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC54(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2651:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC55(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2656:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC57(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L2655:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC56(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.cfi_endproc
+.LFE6791:
+	.size	_Z16check_find_countIyEvN1n8simd_isaE, .-_Z16check_find_countIyEvN1n8simd_isaE
+	.text
+	.p2align 4
+	.globl	_Z12test_simd_64v
+	.type	_Z12test_simd_64v, @function
+_Z12test_simd_64v:
+.LFB6726:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	xorl	%ebx, %ebx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	jmp	.L2659
+	.p2align 4,,10
+	.p2align 3
+.L2661:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebx
+	jg	.L2687
+.L2664:
+	movl	%ebx, %edi
+	addl	$1, %ebx
+	call	_Z16check_find_countIlEvN1n8simd_isaE
+.L2659:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	jne	.L2661
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2661
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L2674
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L2663:
+	movq	%rbp, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebx
+	jle	.L2664
+	.p2align 4,,10
+	.p2align 3
+.L2687:
+	xorl	%ebx, %ebx
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbp
+	jmp	.L2665
+	.p2align 4,,10
+	.p2align 3
+.L2668:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebx
+	jg	.L2688
+.L2678:
+.L2671:
+	movl	%ebx, %edi
+	addl	$1, %ebx
+	call	_Z16check_find_countIyEvN1n8simd_isaE
+.L2665:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	jne	.L2668
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2668
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L2676
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L2670:
+	movq	%rbp, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %ebx
+	jle	.L2671
+.L2688:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2674:
+	.cfi_restore_state
+	movl	$3, %eax
+	jmp	.L2663
+	.p2align 4,,10
+	.p2align 3
+.L2676:
+	movl	$3, %eax
+	jmp	.L2670
+.L2679:
+	.cfi_endproc
+.LFE6726:
+	.size	_Z12test_simd_64v, .-_Z12test_simd_64v
+	.weak	_ZTSN1n15memory_resourceE
+	.section	.rodata._ZTSN1n15memory_resourceE,"aG",@progbits,_ZTSN1n15memory_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n15memory_resourceE, @object
+	.size	_ZTSN1n15memory_resourceE, 22
+_ZTSN1n15memory_resourceE:
+	.string	"N1n15memory_resourceE"
+	.weak	_ZTIN1n15memory_resourceE
+	.section	.data.rel.ro._ZTIN1n15memory_resourceE,"awG",@progbits,_ZTIN1n15memory_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n15memory_resourceE, @object
+	.size	_ZTIN1n15memory_resourceE, 16
+_ZTIN1n15memory_resourceE:
+	.quad	_ZTVN10__cxxabiv117__class_type_infoE+16
+	.quad	_ZTSN1n15memory_resourceE
+	.weak	_ZTSN1n13heap_resourceE
+	.section	.rodata._ZTSN1n13heap_resourceE,"aG",@progbits,_ZTSN1n13heap_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n13heap_resourceE, @object
+	.size	_ZTSN1n13heap_resourceE, 20
+_ZTSN1n13heap_resourceE:
+	.string	"N1n13heap_resourceE"
+	.weak	_ZTIN1n13heap_resourceE
+	.section	.data.rel.ro._ZTIN1n13heap_resourceE,"awG",@progbits,_ZTIN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n13heap_resourceE, @object
+	.size	_ZTIN1n13heap_resourceE, 24
+_ZTIN1n13heap_resourceE:
+	.quad	_ZTVN10__cxxabiv120__si_class_type_infoE+16
+	.quad	_ZTSN1n13heap_resourceE
+	.quad	_ZTIN1n15memory_resourceE
+	.weak	_ZTVN1n13heap_resourceE
+	.section	.data.rel.ro.local._ZTVN1n13heap_resourceE,"awG",@progbits,_ZTVN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTVN1n13heap_resourceE, @object
+	.size	_ZTVN1n13heap_resourceE, 48
+_ZTVN1n13heap_resourceE:
+	.quad	0
+	.quad	_ZTIN1n13heap_resourceE
+	.quad	_ZN1n13heap_resourceD1Ev
+	.quad	_ZN1n13heap_resourceD0Ev
+	.quad	_ZN1n13heap_resource8allocateEmm
+	.quad	_ZN1n13heap_resource10deallocateEPvmm
+	.weak	_ZN1n18__current_resourceE
+	.section	.tbss._ZN1n18__current_resourceE,"awTG",@nobits,_ZN1n18__current_resourceE,comdat
+	.align 8
+	.type	_ZN1n18__current_resourceE, @gnu_unique_object
+	.size	_ZN1n18__current_resourceE, 8
+_ZN1n18__current_resourceE:
+	.zero	8
+	.weak	_ZGVZN1n4heapEvE3res
+	.section	.bss._ZGVZN1n4heapEvE3res,"awG",@nobits,_ZGVZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZGVZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZGVZN1n4heapEvE3res, 8
+_ZGVZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE3res
+	.section	.bss._ZZN1n4heapEvE3res,"awG",@nobits,_ZZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZZN1n4heapEvE3res, 8
+_ZZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE7storage
+	.section	.bss._ZZN1n4heapEvE7storage,"awG",@nobits,_ZZN1n4heapEvE7storage,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE7storage, @gnu_unique_object
+	.size	_ZZN1n4heapEvE7storage, 8
+_ZZN1n4heapEvE7storage:
+	.zero	8
+	.weak	_ZGVZN1n9simd_bestEvE4best
+	.section	.bss._ZGVZN1n9simd_bestEvE4best,"awG",@nobits,_ZGVZN1n9simd_bestEvE4best,comdat
+	.align 8
+	.type	_ZGVZN1n9simd_bestEvE4best, @gnu_unique_object
+	.size	_ZGVZN1n9simd_bestEvE4best, 8
+_ZGVZN1n9simd_bestEvE4best:
+	.zero	8
+	.weak	_ZZN1n9simd_bestEvE4best
+	.section	.bss._ZZN1n9simd_bestEvE4best,"awG",@nobits,_ZZN1n9simd_bestEvE4best,comdat
+	.align 4
+	.type	_ZZN1n9simd_bestEvE4best, @gnu_unique_object
+	.size	_ZZN1n9simd_bestEvE4best, 4
+_ZZN1n9simd_bestEvE4best:
+	.zero	4
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC0:
+	.byte	97
+	.byte	98
+	.byte	99
+	.byte	97
+	.byte	98
+	.byte	99
+	.byte	97
+	.byte	98
+	.byte	99
+	.byte	97
+	.byte	98
+	.byte	99
+	.byte	97
+	.byte	98
+	.byte	99
+	.byte	97
+	.align 16
+.LC1:
+	.byte	98
+	.byte	99
+	.byte	97
+	.byte	98
+	.byte	99
+	.byte	97
+	.byte	98
+	.byte	99
+	.byte	97
+	.byte	98
+	.byte	99
+	.byte	97
+	.byte	98
+	.byte	99
+	.byte	97
+	.byte	98
+	.align 16
+.LC2:
+	.byte	99
+	.byte	97
+	.byte	98
+	.byte	99
+	.byte	97
+	.byte	98
+	.byte	99
+	.byte	97
+	.byte	98
+	.byte	99
+	.byte	97
+	.byte	98
+	.byte	99
+	.byte	97
+	.byte	98
+	.byte	99
+	.set	.LC3,.LC0
+	.align 16
+.LC5:
+	.byte	120
+	.byte	120
+	.byte	120
+	.byte	120
+	.byte	120
+	.byte	120
+	.byte	120
+	.byte	120
+	.byte	120
+	.byte	120
+	.byte	120
+	.byte	120
+	.byte	120
+	.byte	120
+	.byte	120
+	.byte	120
+	.align 16
+.LC6:
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.align 16
+.LC9:
+	.byte	99
+	.byte	99
+	.byte	99
+	.byte	99
+	.byte	99
+	.byte	99
+	.byte	99
+	.byte	99
+	.byte	99
+	.byte	99
+	.byte	99
+	.byte	99
+	.byte	99
+	.byte	99
+	.byte	99
+	.byte	99
+	.align 16
+.LC10:
+	.byte	98
+	.byte	98
+	.byte	98
+	.byte	98
+	.byte	98
+	.byte	98
+	.byte	98
+	.byte	98
+	.byte	98
+	.byte	98
+	.byte	98
+	.byte	98
+	.byte	98
+	.byte	98
+	.byte	98
+	.byte	98
+	.set	.LC16,.LC48
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC32:
+	.long	7
+	.long	100
+	.section	.rodata.cst16
+	.align 16
+.LC36:
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.align 16
+.LC41:
+	.byte	9
+	.byte	9
+	.byte	9
+	.byte	9
+	.byte	9
+	.byte	9
+	.byte	9
+	.byte	9
+	.byte	9
+	.byte	9
+	.byte	9
+	.byte	9
+	.byte	9
+	.byte	9
+	.byte	9
+	.byte	9
+	.align 16
+.LC42:
+	.quad	0
+	.quad	1
+	.align 16
+.LC43:
+	.quad	16
+	.quad	16
+	.align 16
+.LC44:
+	.quad	2
+	.quad	2
+	.align 16
+.LC45:
+	.quad	4
+	.quad	4
+	.align 16
+.LC46:
+	.quad	6
+	.quad	6
+	.align 16
+.LC47:
+	.quad	8
+	.quad	8
+	.align 16
+.LC48:
+	.quad	10
+	.quad	10
+	.align 16
+.LC49:
+	.quad	12
+	.quad	12
+	.align 16
+.LC50:
+	.quad	14
+	.quad	14
+	.align 16
+.LC51:
+	.value	-13107
+	.value	-13107
+	.value	-13107
+	.value	-13107
+	.value	-13107
+	.value	-13107
+	.value	-13107
+	.value	-13107
+	.align 16
+.LC52:
+	.value	255
+	.value	255
+	.value	255
+	.value	255
+	.value	255
+	.value	255
+	.value	255
+	.value	255
+	.align 16
+.LC53:
+	.byte	3
+	.byte	3
+	.byte	3
+	.byte	3
+	.byte	3
+	.byte	3
+	.byte	3
+	.byte	3
+	.byte	3
+	.byte	3
+	.byte	3
+	.byte	3
+	.byte	3
+	.byte	3
+	.byte	3
+	.byte	3
+	.align 16
+.LC61:
+	.value	1
+	.value	1
+	.value	1
+	.value	1
+	.value	1
+	.value	1
+	.value	1
+	.value	1
+	.align 16
+.LC62:
+	.value	9
+	.value	9
+	.value	9
+	.value	9
+	.value	9
+	.value	9
+	.value	9
+	.value	9
+	.align 16
+.LC63:
+	.value	3
+	.value	3
+	.value	3
+	.value	3
+	.value	3
+	.value	3
+	.value	3
+	.value	3
+	.align 16
+.LC66:
+	.long	1
+	.long	1
+	.long	1
+	.long	1
+	.align 16
+.LC67:
+	.long	9
+	.long	9
+	.long	9
+	.long	9
+	.align 16
+.LC68:
+	.long	3
+	.long	3
+	.long	3
+	.long	3
+	.align 16
+.LC69:
+	.long	7
+	.long	7
+	.long	7
+	.long	7
+	.align 16
+.LC74:
+	.long	9
+	.long	0
+	.long	9
+	.long	0
+	.align 16
+.LC75:
+	.long	3
+	.long	0
+	.long	3
+	.long	0
+	.hidden	DW.ref._ZTIPKc
+	.weak	DW.ref._ZTIPKc
+	.section	.data.rel.local.DW.ref._ZTIPKc,"awG",@progbits,DW.ref._ZTIPKc,comdat
+	.align 8
+	.type	DW.ref._ZTIPKc, @object
+	.size	DW.ref._ZTIPKc, 8
+DW.ref._ZTIPKc:
+	.quad	_ZTIPKc
+	.hidden	DW.ref.__gxx_personality_v0
+	.weak	DW.ref.__gxx_personality_v0
+	.section	.data.rel.local.DW.ref.__gxx_personality_v0,"awG",@progbits,DW.ref.__gxx_personality_v0,comdat
+	.align 8
+	.type	DW.ref.__gxx_personality_v0, @object
+	.size	DW.ref.__gxx_personality_v0, 8
+DW.ref.__gxx_personality_v0:
+	.quad	__gxx_personality_v0
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
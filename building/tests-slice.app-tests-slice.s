@@ -0,0 +1,1442 @@
+	.file	"tests-slice.cpp"
+	.text
+	.p2align 4
+	.globl	_Z19test_slice_subslicev
+	.type	_Z19test_slice_subslicev, @function
+_Z19test_slice_subslicev:
+.LFB6760:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE6760:
+	.size	_Z19test_slice_subslicev, .-_Z19test_slice_subslicev
+	.section	.text._ZN1n13heap_resourceD2Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD2Ev
+	.type	_ZN1n13heap_resourceD2Ev, @function
+_ZN1n13heap_resourceD2Ev:
+.LFB6823:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE6823:
+	.size	_ZN1n13heap_resourceD2Ev, .-_ZN1n13heap_resourceD2Ev
+	.weak	_ZN1n13heap_resourceD1Ev
+	.set	_ZN1n13heap_resourceD1Ev,_ZN1n13heap_resourceD2Ev
+	.section	.text._ZN1n13heap_resource10deallocateEPvmm,"axG",@progbits,_ZN1n13heap_resource10deallocateEPvmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource10deallocateEPvmm
+	.type	_ZN1n13heap_resource10deallocateEPvmm, @function
+_ZN1n13heap_resource10deallocateEPvmm:
+.LFB6517:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rcx
+	jbe	.L5
+	movq	%rcx, %rsi
+	jmp	_ZdlPvSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L5:
+	jmp	_ZdlPv@PLT
+	.cfi_endproc
+.LFE6517:
+	.size	_ZN1n13heap_resource10deallocateEPvmm, .-_ZN1n13heap_resource10deallocateEPvmm
+	.section	.text._ZN1n13heap_resource8allocateEmm,"axG",@progbits,_ZN1n13heap_resource8allocateEmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource8allocateEmm
+	.type	_ZN1n13heap_resource8allocateEmm, @function
+_ZN1n13heap_resource8allocateEmm:
+.LFB6516:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rdx
+	jbe	.L7
+	movq	%rdx, %rsi
+	jmp	_ZnwmSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	jmp	_Znwm@PLT
+	.cfi_endproc
+.LFE6516:
+	.size	_ZN1n13heap_resource8allocateEmm, .-_ZN1n13heap_resource8allocateEmm
+	.section	.text._ZN1n13heap_resourceD0Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD0Ev
+	.type	_ZN1n13heap_resourceD0Ev, @function
+_ZN1n13heap_resourceD0Ev:
+.LFB6825:
+	.cfi_startproc
+	movl	$8, %esi
+	jmp	_ZdlPvm@PLT
+	.cfi_endproc
+.LFE6825:
+	.size	_ZN1n13heap_resourceD0Ev, .-_ZN1n13heap_resourceD0Ev
+	.text
+	.p2align 4
+	.globl	_Z27test_slice_starts_ends_withv
+	.type	_Z27test_slice_starts_ends_withv, @function
+_Z27test_slice_starts_ends_withv:
+.LFB6767:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE6767:
+	.size	_Z27test_slice_starts_ends_withv, .-_Z27test_slice_starts_ends_withv
+	.p2align 4
+	.globl	_Z19test_slice_iteratesv
+	.type	_Z19test_slice_iteratesv, @function
+_Z19test_slice_iteratesv:
+.LFB6752:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6752
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbx
+	testq	%rbx, %rbx
+	je	.L19
+.L11:
+	movq	(%rbx), %rax
+	movq	%rbx, %rdi
+	movl	$4, %edx
+	movl	$40, %esi
+.LEHB0:
+	call	*16(%rax)
+.LEHE0:
+	movq	%rbx, %rdi
+	movl	$4, %ecx
+	movl	$40, %edx
+	movq	%rax, %rsi
+	movq	.LC0(%rip), %rax
+	movl	$3, 8(%rsi)
+	movq	%rax, (%rsi)
+	movq	(%rbx), %rax
+	call	*24(%rax)
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L19:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L20
+.L13:
+	movq	_ZZN1n4heapEvE3res(%rip), %rbx
+	jmp	.L11
+.L20:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L13
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L13
+	.cfi_endproc
+.LFE6752:
+	.globl	__gxx_personality_v0
+	.section	.gcc_except_table,"a",@progbits
+.LLSDA6752:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6752-.LLSDACSB6752
+.LLSDACSB6752:
+	.uleb128 .LEHB0-.LFB6752
+	.uleb128 .LEHE0-.LEHB0
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6752:
+	.text
+	.size	_Z19test_slice_iteratesv, .-_Z19test_slice_iteratesv
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC1:
+	.string	"abc"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC3:
+	.string	"expected true : s.iter() == n::slice_of(\"abc\")"
+	.section	.rodata.str1.1
+.LC4:
+	.string	"abd"
+	.section	.rodata.str1.8
+	.align 8
+.LC5:
+	.string	"expected false : s.iter() == n::slice_of(\"abd\")"
+	.section	.text.unlikely,"ax",@progbits
+.LCOLDB7:
+	.text
+.LHOTB7:
+	.p2align 4
+	.globl	_Z17test_slice_equalsv
+	.type	_Z17test_slice_equalsv, @function
+_Z17test_slice_equalsv:
+.LFB6770:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6770
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	movdqa	.LC2(%rip), %xmm0
+	movaps	%xmm0, 16(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L22
+	pxor	%xmm0, %xmm0
+	leaq	40(%rsp), %r13
+	movq	%rax, 32(%rsp)
+	xorl	%r12d, %r12d
+	leaq	.LC1(%rip), %rbp
+	movups	%xmm0, 40(%rsp)
+	movq	$0, 56(%rsp)
+	cmpq	%r13, %rbp
+	jb	.L55
+.L73:
+	leaq	.LC1(%rip), %rsi
+.L76:
+	movq	%r13, %rbx
+.L23:
+	leaq	(%rbx,%r12), %rdi
+	movl	$3, %edx
+	call	memmove@PLT
+	movq	16(%rsp), %rax
+	leaq	3(%rax), %rdx
+	movq	%rdx, 16(%rsp)
+	movb	$0, 3(%rbx,%rax)
+	movq	24(%rsp), %rbx
+	leaq	40(%rsp), %rax
+	movq	16(%rsp), %rdx
+	cmpq	$23, %rbx
+	je	.L36
+	movq	40(%rsp), %rax
+.L36:
+	cmpq	$3, %rdx
+	jne	.L37
+	cmpw	$25185, (%rax)
+	jne	.L37
+	cmpb	$99, 2(%rax)
+	jne	.L37
+	cmpq	$23, %rbx
+	je	.L21
+	movq	32(%rsp), %rdi
+	movq	40(%rsp), %rsi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L21:
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L55:
+	.cfi_restore_state
+	movq	%rbp, %rsi
+	jmp	.L76
+	.p2align 4,,10
+	.p2align 3
+.L22:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L77
+.L27:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	16(%rsp), %r12
+	pxor	%xmm0, %xmm0
+	xorl	%r13d, %r13d
+	movq	24(%rsp), %r14
+	movups	%xmm0, 40(%rsp)
+	leaq	.LC1(%rip), %rbp
+	movq	%r15, 32(%rsp)
+	leaq	3(%r12), %rax
+	movq	$0, 56(%rsp)
+	cmpq	$23, %r14
+	je	.L78
+.L29:
+	leaq	0(%r13,%r12), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L79
+	subq	%r13, %rbp
+	movq	%rbp, 8(%rsp)
+	cmpq	%rax, %r14
+	jnb	.L52
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %rbp
+	movq	(%r15), %rax
+.LEHB1:
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L33
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L33:
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, %r14
+	movq	%rbp, 24(%rsp)
+.L32:
+	cmpq	$23, %r14
+	je	.L34
+	movq	8(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L23
+.L79:
+	cmpq	%rax, %r14
+	jnb	.L51
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %rbp
+	movq	(%r15), %rax
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L31
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L31:
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, 24(%rsp)
+.L25:
+	leaq	.LC1(%rip), %rsi
+	cmpq	$23, %rbp
+	jne	.L23
+	leaq	40(%rsp), %r13
+	jmp	.L73
+.L77:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L27
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L27
+.L51:
+	xorl	%ebx, %ebx
+	movq	%r14, %rbp
+	jmp	.L25
+.L52:
+	xorl	%ebx, %ebx
+	jmp	.L32
+.L34:
+	movq	8(%rsp), %rsi
+	leaq	40(%rsp), %r13
+	addq	%r13, %rsi
+	jmp	.L76
+.L78:
+	leaq	40(%rsp), %r13
+	cmpq	%r13, %rbp
+	jnb	.L29
+	cmpq	$23, %rax
+	jbe	.L55
+	movl	$56, %edx
+	movq	%r15, %rdi
+	cmpq	%rdx, %rax
+	cmovnb	%rax, %rdx
+	movq	(%r15), %rax
+	leaq	1(%rdx), %rsi
+	movq	%rdx, %r14
+	movl	$1, %edx
+	call	*16(%rax)
+.LEHE1:
+	movq	%r13, %rsi
+	leaq	1(%r12), %rdx
+	movq	%rax, %rbx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, %rsi
+	movq	%r14, 24(%rsp)
+	jmp	.L23
+	.section	.gcc_except_table
+.LLSDA6770:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6770-.LLSDACSB6770
+.LLSDACSB6770:
+	.uleb128 .LEHB1-.LFB6770
+	.uleb128 .LEHE1-.LEHB1
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6770:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6770
+	.type	_Z17test_slice_equalsv.cold, @function
+_Z17test_slice_equalsv.cold:
+.LFSB6770:
+.L37:
+	.cfi_def_cfa_offset 128
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC3(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB2:
+	call	__cxa_throw@PLT
+.LEHE2:
+.L56:
+	movq	%rax, %rbp
+	cmpq	$23, %rbx
+	je	.L46
+	movq	32(%rsp), %rdi
+	movq	40(%rsp), %rsi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L46:
+	movq	%rbp, %rdi
+.LEHB3:
+	call	_Unwind_Resume@PLT
+.LEHE3:
+	.cfi_endproc
+.LFE6770:
+	.section	.gcc_except_table
+.LLSDAC6770:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6770-.LLSDACSBC6770
+.LLSDACSBC6770:
+	.uleb128 .LEHB2-.LCOLDB7
+	.uleb128 .LEHE2-.LEHB2
+	.uleb128 .L56-.LCOLDB7
+	.uleb128 0
+	.uleb128 .LEHB3-.LCOLDB7
+	.uleb128 .LEHE3-.LEHB3
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6770:
+	.section	.text.unlikely
+	.text
+	.size	_Z17test_slice_equalsv, .-_Z17test_slice_equalsv
+	.section	.text.unlikely
+	.size	_Z17test_slice_equalsv.cold, .-_Z17test_slice_equalsv.cold
+.LCOLDE7:
+	.text
+.LHOTE7:
+	.section	.rodata.str1.1
+.LC8:
+	.string	"Hello"
+	.section	.rodata.str1.8
+	.align 8
+.LC9:
+	.string	"expected equal : expected value : sl.len(), actual value : 5"
+	.align 8
+.LC10:
+	.string	"expected equal : expected value : sl[1], actual value : 'e'"
+	.section	.text.unlikely
+.LCOLDB11:
+	.text
+.LHOTB11:
+	.p2align 4
+	.globl	_Z19test_slice_len_datav
+	.type	_Z19test_slice_len_datav, @function
+_Z19test_slice_len_datav:
+.LFB6744:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6744
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	movdqa	.LC2(%rip), %xmm0
+	movaps	%xmm0, 16(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L81
+	pxor	%xmm0, %xmm0
+	leaq	40(%rsp), %r13
+	movq	%rax, 32(%rsp)
+	xorl	%r12d, %r12d
+	leaq	.LC8(%rip), %rbp
+	movups	%xmm0, 40(%rsp)
+	movq	$0, 56(%rsp)
+	cmpq	%r13, %rbp
+	jb	.L109
+.L123:
+	leaq	.LC8(%rip), %rsi
+.L126:
+	movq	%r13, %rbx
+.L82:
+	leaq	(%rbx,%r12), %rdi
+	movl	$5, %edx
+	call	memmove@PLT
+	movq	16(%rsp), %rax
+	leaq	5(%rax), %rdx
+	movq	%rdx, 16(%rsp)
+	movb	$0, 5(%rbx,%rax)
+	movq	24(%rsp), %rbx
+	movq	16(%rsp), %rax
+	cmpq	$23, %rbx
+	je	.L95
+	movq	40(%rsp), %rsi
+	cmpq	$5, %rax
+	jne	.L96
+	cmpb	$101, 1(%rsi)
+	jne	.L127
+	movq	32(%rsp), %rdi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L80:
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L95:
+	.cfi_restore_state
+	cmpq	$5, %rax
+	jne	.L96
+	cmpb	$101, 41(%rsp)
+	je	.L80
+	jmp	.L97
+	.p2align 4,,10
+	.p2align 3
+.L109:
+	movq	%rbp, %rsi
+	jmp	.L126
+	.p2align 4,,10
+	.p2align 3
+.L81:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L128
+.L86:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	16(%rsp), %r12
+	pxor	%xmm0, %xmm0
+	xorl	%r13d, %r13d
+	movq	24(%rsp), %r14
+	movups	%xmm0, 40(%rsp)
+	leaq	.LC8(%rip), %rbp
+	movq	%r15, 32(%rsp)
+	leaq	5(%r12), %rax
+	movq	$0, 56(%rsp)
+	cmpq	$23, %r14
+	je	.L129
+.L88:
+	leaq	0(%r13,%r12), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L130
+	subq	%r13, %rbp
+	movq	%rbp, 8(%rsp)
+	cmpq	%rax, %r14
+	jnb	.L107
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %rbp
+	movq	(%r15), %rax
+.LEHB4:
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L92
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L92:
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, %r14
+	movq	%rbp, 24(%rsp)
+.L91:
+	cmpq	$23, %r14
+	je	.L93
+	movq	8(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L82
+.L130:
+	cmpq	%rax, %r14
+	jnb	.L106
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %rbp
+	movq	(%r15), %rax
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L90
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L90:
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, 24(%rsp)
+.L84:
+	leaq	.LC8(%rip), %rsi
+	cmpq	$23, %rbp
+	jne	.L82
+	leaq	40(%rsp), %r13
+	jmp	.L123
+.L128:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L86
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L86
+.L106:
+	xorl	%ebx, %ebx
+	movq	%r14, %rbp
+	jmp	.L84
+.L107:
+	xorl	%ebx, %ebx
+	jmp	.L91
+.L93:
+	movq	8(%rsp), %rsi
+	leaq	40(%rsp), %r13
+	addq	%r13, %rsi
+	jmp	.L126
+.L129:
+	leaq	40(%rsp), %r13
+	cmpq	%r13, %rbp
+	jnb	.L88
+	cmpq	$23, %rax
+	jbe	.L109
+	movl	$56, %edx
+	movq	%r15, %rdi
+	cmpq	%rdx, %rax
+	cmovnb	%rax, %rdx
+	movq	(%r15), %rax
+	leaq	1(%rdx), %rsi
+	movq	%rdx, %r14
+	movl	$1, %edx
+	call	*16(%rax)
+.LEHE4:
+	movq	%r13, %rsi
+	leaq	1(%r12), %rdx
+	movq	%rax, %rbx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	%rbx, 40(%rsp)
+	movq	%rbp, %rsi
+	movq	%r14, 24(%rsp)
+	jmp	.L82
+.L127:
+	jmp	.L97
+	.section	.gcc_except_table
+.LLSDA6744:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6744-.LLSDACSB6744
+.LLSDACSB6744:
+	.uleb128 .LEHB4-.LFB6744
+	.uleb128 .LEHE4-.LEHB4
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6744:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6744
+	.type	_Z19test_slice_len_datav.cold, @function
+_Z19test_slice_len_datav.cold:
+.LFSB6744:
+.L96:
+	.cfi_def_cfa_offset 128
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC9(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB5:
+	call	__cxa_throw@PLT
+.LEHE5:
+.L110:
+	movq	%rax, %rbp
+	cmpq	$23, %rbx
+	je	.L101
+	movq	32(%rsp), %rdi
+	movq	40(%rsp), %rsi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L101:
+	movq	%rbp, %rdi
+.LEHB6:
+	call	_Unwind_Resume@PLT
+.LEHE6:
+.L97:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC10(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB7:
+	call	__cxa_throw@PLT
+.LEHE7:
+	.cfi_endproc
+.LFE6744:
+	.section	.gcc_except_table
+.LLSDAC6744:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6744-.LLSDACSBC6744
+.LLSDACSBC6744:
+	.uleb128 .LEHB5-.LCOLDB11
+	.uleb128 .LEHE5-.LEHB5
+	.uleb128 .L110-.LCOLDB11
+	.uleb128 0
+	.uleb128 .LEHB6-.LCOLDB11
+	.uleb128 .LEHE6-.LEHB6
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB7-.LCOLDB11
+	.uleb128 .LEHE7-.LEHB7
+	.uleb128 .L110-.LCOLDB11
+	.uleb128 0
+.LLSDACSEC6744:
+	.section	.text.unlikely
+	.text
+	.size	_Z19test_slice_len_datav, .-_Z19test_slice_len_datav
+	.section	.text.unlikely
+	.size	_Z19test_slice_len_datav.cold, .-_Z19test_slice_len_datav.cold
+.LCOLDE11:
+	.text
+.LHOTE11:
+	.section	.rodata._ZN1n4test10test_suite7run_allEv.str1.1,"aMS",@progbits,1
+.LC12:
+	.string	"\nSUITE [%s] "
+.LC14:
+	.string	"%s"
+.LC15:
+	.string	"\nTEST [%s] "
+.LC16:
+	.string	" - Result : \033[1;32mPASSED\033[0m"
+.LC17:
+	.string	"\033[1;31merror : %s\033[0m\n"
+.LC18:
+	.string	" - Result : \033[1;31mFAILED\033[0m"
+.LC19:
+	.string	" - Passed : \033[1;32m%d\033[0m\n"
+.LC20:
+	.string	" - Failed : \033[1;31m%d\033[0m\n"
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4test10test_suite7run_allEv
+	.type	_ZN1n4test10test_suite7run_allEv, @function
+_ZN1n4test10test_suite7run_allEv:
+.LFB6743:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6743
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	leaq	.LC12(%rip), %rdx
+	movl	$79, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	16(%rdi), %rcx
+	leaq	16(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L132
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L133
+	testb	$4, %cl
+	jne	.L186
+	testl	%ecx, %ecx
+	je	.L132
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L187
+	.p2align 4,,10
+	.p2align 3
+.L132:
+	movzwl	.LC13(%rip), %r15d
+	movq	%rbx, %rsi
+	leaq	.LC14(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+.LEHB8:
+	call	printf@PLT
+	movl	8(%r12), %esi
+	testl	%esi, %esi
+	jle	.L153
+	movl	$0, 12(%rsp)
+	xorl	%ebp, %ebp
+	xorl	%r14d, %r14d
+	jmp	.L147
+	.p2align 4,,10
+	.p2align 3
+.L190:
+	testb	$4, %dl
+	jne	.L188
+	testl	%edx, %edx
+	je	.L138
+	movb	$42, (%rax)
+	testb	$2, %dl
+	jne	.L189
+	.p2align 4,,10
+	.p2align 3
+.L138:
+	movq	%rbx, %rsi
+	leaq	.LC14(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+.LEHE8:
+	movq	(%r12), %rax
+.LEHB9:
+	call	*8(%rax,%r13)
+.LEHE9:
+	leaq	.LC16(%rip), %rdi
+	addl	$1, %r14d
+.LEHB10:
+	call	puts@PLT
+.L143:
+	addq	$1, %rbp
+	cmpl	%ebp, 8(%r12)
+	jle	.L137
+.L147:
+	movq	(%r12), %rax
+	movq	%rbp, %r13
+	movq	%rbx, %rdi
+	movl	$79, %esi
+	salq	$4, %r13
+	leaq	.LC15(%rip), %rdx
+	movq	(%rax,%r13), %rcx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L138
+	movl	$79, %edx
+	subl	%eax, %edx
+	addq	%rbx, %rax
+	cmpl	$8, %edx
+	jb	.L190
+	movabsq	$3038287259199220266, %rsi
+	leaq	8(%rax), %rdi
+	movl	%edx, %ecx
+	andq	$-8, %rdi
+	movq	%rsi, (%rax)
+	movq	%rsi, -8(%rax,%rcx)
+	subq	%rdi, %rax
+	leal	(%rdx,%rax), %ecx
+	movq	%rsi, %rax
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L138
+.L153:
+	movl	$0, 12(%rsp)
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L137:
+	movabsq	$5917806138674729738, %rax
+	movq	%rbx, %rdi
+	movq	%rax, 16(%rsp)
+	movabsq	$9095440486453792, %rax
+	movq	%rax, 22(%rsp)
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L148
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L149
+	testb	$4, %cl
+	jne	.L191
+	testl	%ecx, %ecx
+	je	.L148
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L192
+.L148:
+	movq	%rbx, %rsi
+	leaq	.LC14(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+	movl	%r14d, %esi
+	leaq	.LC19(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	12(%rsp), %esi
+	leaq	.LC20(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	$10, %edi
+	call	putchar@PLT
+.LEHE10:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L149:
+	.cfi_restore_state
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L148
+.L133:
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L132
+.L188:
+	movl	$707406378, (%rax)
+	movl	$707406378, -4(%rax,%rdx)
+	jmp	.L138
+.L189:
+	movl	$10794, %ecx
+	movw	%cx, -2(%rax,%rdx)
+	jmp	.L138
+.L187:
+	movl	$10794, %edi
+	movw	%di, -2(%rdx,%rcx)
+	jmp	.L132
+.L192:
+	movl	$10794, %eax
+	movw	%ax, -2(%rdx,%rcx)
+	jmp	.L148
+.L186:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L132
+.L191:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L148
+.L154:
+	movq	%rax, %rdi
+	movq	%rdx, %rax
+.L144:
+	subq	$1, %rax
+	jne	.L185
+	call	__cxa_begin_catch@PLT
+	leaq	.LC17(%rip), %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+.LEHB11:
+	call	printf@PLT
+.LEHE11:
+	call	__cxa_end_catch@PLT
+	leaq	.LC18(%rip), %rdi
+	addl	$1, 12(%rsp)
+.LEHB12:
+	call	puts@PLT
+	jmp	.L143
+.L146:
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+.L185:
+	call	_Unwind_Resume@PLT
+.LEHE12:
+.L155:
+	movq	%rax, %rbx
+	jmp	.L146
+	.cfi_endproc
+.LFE6743:
+	.section	.gcc_except_table
+	.align 4
+.LLSDA6743:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT6743-.LLSDATTD6743
+.LLSDATTD6743:
+	.byte	0x1
+	.uleb128 .LLSDACSE6743-.LLSDACSB6743
+.LLSDACSB6743:
+	.uleb128 .LEHB8-.LFB6743
+	.uleb128 .LEHE8-.LEHB8
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB9-.LFB6743
+	.uleb128 .LEHE9-.LEHB9
+	.uleb128 .L154-.LFB6743
+	.uleb128 0x1
+	.uleb128 .LEHB10-.LFB6743
+	.uleb128 .LEHE10-.LEHB10
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB11-.LFB6743
+	.uleb128 .LEHE11-.LEHB11
+	.uleb128 .L155-.LFB6743
+	.uleb128 0
+	.uleb128 .LEHB12-.LFB6743
+	.uleb128 .LEHE12-.LEHB12
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6743:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	DW.ref._ZTIPKc-.
+.LLSDATT6743:
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.size	_ZN1n4test10test_suite7run_allEv, .-_ZN1n4test10test_suite7run_allEv
+	.section	.rodata.str1.1
+.LC21:
+	.string	"n::slice tests"
+.LC22:
+	.string	"test_slice_len_data"
+.LC23:
+	.string	"test_slice_iterates"
+.LC24:
+	.string	"test_slice_subslice"
+.LC25:
+	.string	"test_slice_starts_ends_with"
+.LC26:
+	.string	"test_slice_equals"
+	.section	.text.unlikely
+.LCOLDB28:
+	.section	.text.startup,"ax",@progbits
+.LHOTB28:
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB6783:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6783
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$1600, %edi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 64
+.LEHB13:
+	call	_Znam@PLT
+.LEHE13:
+	movq	%rax, %rbx
+	leaq	1600(%rax), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L194:
+	movq	$0, (%rax)
+	addq	$16, %rax
+	movq	$0, -8(%rax)
+	cmpq	%rdx, %rax
+	jne	.L194
+	leaq	.LC21(%rip), %rax
+	movq	%rsp, %rdi
+	movq	%rbx, (%rsp)
+	movq	%rax, 16(%rsp)
+	leaq	.LC22(%rip), %rax
+	movq	%rax, (%rbx)
+	leaq	_Z19test_slice_len_datav(%rip), %rax
+	movq	%rax, 8(%rbx)
+	leaq	.LC23(%rip), %rax
+	movq	%rax, 16(%rbx)
+	leaq	_Z19test_slice_iteratesv(%rip), %rax
+	movq	%rax, 24(%rbx)
+	leaq	.LC24(%rip), %rax
+	movq	%rax, 32(%rbx)
+	leaq	_Z19test_slice_subslicev(%rip), %rax
+	movq	%rax, 40(%rbx)
+	leaq	.LC25(%rip), %rax
+	movq	%rax, 48(%rbx)
+	leaq	_Z27test_slice_starts_ends_withv(%rip), %rax
+	movq	%rax, 56(%rbx)
+	leaq	.LC26(%rip), %rax
+	movq	%rax, 64(%rbx)
+	leaq	_Z17test_slice_equalsv(%rip), %rax
+	movq	%rax, 72(%rbx)
+	movq	.LC27(%rip), %rax
+	movq	%rax, 8(%rsp)
+.LEHB14:
+	call	_ZN1n4test10test_suite7run_allEv
+.LEHE14:
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L196:
+	.cfi_restore_state
+	movq	%rax, %rbp
+	jmp	.L195
+	.section	.gcc_except_table
+.LLSDA6783:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6783-.LLSDACSB6783
+.LLSDACSB6783:
+	.uleb128 .LEHB13-.LFB6783
+	.uleb128 .LEHE13-.LEHB13
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB14-.LFB6783
+	.uleb128 .LEHE14-.LEHB14
+	.uleb128 .L196-.LFB6783
+	.uleb128 0
+.LLSDACSE6783:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6783
+	.type	main.cold, @function
+main.cold:
+.LFSB6783:
+.L195:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	movq	%rbp, %rdi
+.LEHB15:
+	call	_Unwind_Resume@PLT
+.LEHE15:
+	.cfi_endproc
+.LFE6783:
+	.section	.gcc_except_table
+.LLSDAC6783:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6783-.LLSDACSBC6783
+.LLSDACSBC6783:
+	.uleb128 .LEHB15-.LCOLDB28
+	.uleb128 .LEHE15-.LEHB15
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6783:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	main, .-main
+	.section	.text.unlikely
+	.size	main.cold, .-main.cold
+.LCOLDE28:
+	.section	.text.startup
+.LHOTE28:
+	.weak	_ZTSN1n15memory_resourceE
+	.section	.rodata._ZTSN1n15memory_resourceE,"aG",@progbits,_ZTSN1n15memory_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n15memory_resourceE, @object
+	.size	_ZTSN1n15memory_resourceE, 22
+_ZTSN1n15memory_resourceE:
+	.string	"N1n15memory_resourceE"
+	.weak	_ZTIN1n15memory_resourceE
+	.section	.data.rel.ro._ZTIN1n15memory_resourceE,"awG",@progbits,_ZTIN1n15memory_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n15memory_resourceE, @object
+	.size	_ZTIN1n15memory_resourceE, 16
+_ZTIN1n15memory_resourceE:
+	.quad	_ZTVN10__cxxabiv117__class_type_infoE+16
+	.quad	_ZTSN1n15memory_resourceE
+	.weak	_ZTSN1n13heap_resourceE
+	.section	.rodata._ZTSN1n13heap_resourceE,"aG",@progbits,_ZTSN1n13heap_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n13heap_resourceE, @object
+	.size	_ZTSN1n13heap_resourceE, 20
+_ZTSN1n13heap_resourceE:
+	.string	"N1n13heap_resourceE"
+	.weak	_ZTIN1n13heap_resourceE
+	.section	.data.rel.ro._ZTIN1n13heap_resourceE,"awG",@progbits,_ZTIN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n13heap_resourceE, @object
+	.size	_ZTIN1n13heap_resourceE, 24
+_ZTIN1n13heap_resourceE:
+	.quad	_ZTVN10__cxxabiv120__si_class_type_infoE+16
+	.quad	_ZTSN1n13heap_resourceE
+	.quad	_ZTIN1n15memory_resourceE
+	.weak	_ZTVN1n13heap_resourceE
+	.section	.data.rel.ro.local._ZTVN1n13heap_resourceE,"awG",@progbits,_ZTVN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTVN1n13heap_resourceE, @object
+	.size	_ZTVN1n13heap_resourceE, 48
+_ZTVN1n13heap_resourceE:
+	.quad	0
+	.quad	_ZTIN1n13heap_resourceE
+	.quad	_ZN1n13heap_resourceD1Ev
+	.quad	_ZN1n13heap_resourceD0Ev
+	.quad	_ZN1n13heap_resource8allocateEmm
+	.quad	_ZN1n13heap_resource10deallocateEPvmm
+	.weak	_ZN1n18__current_resourceE
+	.section	.tbss._ZN1n18__current_resourceE,"awTG",@nobits,_ZN1n18__current_resourceE,comdat
+	.align 8
+	.type	_ZN1n18__current_resourceE, @gnu_unique_object
+	.size	_ZN1n18__current_resourceE, 8
+_ZN1n18__current_resourceE:
+	.zero	8
+	.weak	_ZGVZN1n4heapEvE3res
+	.section	.bss._ZGVZN1n4heapEvE3res,"awG",@nobits,_ZGVZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZGVZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZGVZN1n4heapEvE3res, 8
+_ZGVZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE3res
+	.section	.bss._ZZN1n4heapEvE3res,"awG",@nobits,_ZZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZZN1n4heapEvE3res, 8
+_ZZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE7storage
+	.section	.bss._ZZN1n4heapEvE7storage,"awG",@nobits,_ZZN1n4heapEvE7storage,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE7storage, @gnu_unique_object
+	.size	_ZZN1n4heapEvE7storage, 8
+_ZZN1n4heapEvE7storage:
+	.zero	8
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC0:
+	.long	1
+	.long	2
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC2:
+	.quad	0
+	.quad	23
+	.section	.rodata.cst2,"aM",@progbits,2
+	.align 2
+.LC13:
+	.byte	10
+	.byte	0
+	.section	.rodata.cst8
+	.align 8
+.LC27:
+	.long	5
+	.long	100
+	.hidden	DW.ref._ZTIPKc
+	.weak	DW.ref._ZTIPKc
+	.section	.data.rel.local.DW.ref._ZTIPKc,"awG",@progbits,DW.ref._ZTIPKc,comdat
+	.align 8
+	.type	DW.ref._ZTIPKc, @object
+	.size	DW.ref._ZTIPKc, 8
+DW.ref._ZTIPKc:
+	.quad	_ZTIPKc
+	.hidden	DW.ref.__gxx_personality_v0
+	.weak	DW.ref.__gxx_personality_v0
+	.section	.data.rel.local.DW.ref.__gxx_personality_v0,"awG",@progbits,DW.ref.__gxx_personality_v0,comdat
+	.align 8
+	.type	DW.ref.__gxx_personality_v0, @object
+	.size	DW.ref.__gxx_personality_v0, 8
+DW.ref.__gxx_personality_v0:
+	.quad	__gxx_personality_v0
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
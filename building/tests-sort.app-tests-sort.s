@@ -0,0 +1,16535 @@
+	.file	"tests-sort.cpp"
+	.text
+	.section	.text._ZN1n13heap_resourceD2Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD2Ev
+	.type	_ZN1n13heap_resourceD2Ev, @function
+_ZN1n13heap_resourceD2Ev:
+.LFB7120:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7120:
+	.size	_ZN1n13heap_resourceD2Ev, .-_ZN1n13heap_resourceD2Ev
+	.weak	_ZN1n13heap_resourceD1Ev
+	.set	_ZN1n13heap_resourceD1Ev,_ZN1n13heap_resourceD2Ev
+	.section	.text._ZN1n13heap_resource10deallocateEPvmm,"axG",@progbits,_ZN1n13heap_resource10deallocateEPvmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource10deallocateEPvmm
+	.type	_ZN1n13heap_resource10deallocateEPvmm, @function
+_ZN1n13heap_resource10deallocateEPvmm:
+.LFB38:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rcx
+	jbe	.L4
+	movq	%rcx, %rsi
+	jmp	_ZdlPvSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	jmp	_ZdlPv@PLT
+	.cfi_endproc
+.LFE38:
+	.size	_ZN1n13heap_resource10deallocateEPvmm, .-_ZN1n13heap_resource10deallocateEPvmm
+	.section	.text._ZN1n13heap_resource8allocateEmm,"axG",@progbits,_ZN1n13heap_resource8allocateEmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource8allocateEmm
+	.type	_ZN1n13heap_resource8allocateEmm, @function
+_ZN1n13heap_resource8allocateEmm:
+.LFB37:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rdx
+	jbe	.L6
+	movq	%rdx, %rsi
+	jmp	_ZnwmSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	jmp	_Znwm@PLT
+	.cfi_endproc
+.LFE37:
+	.size	_ZN1n13heap_resource8allocateEmm, .-_ZN1n13heap_resource8allocateEmm
+	.section	.text._ZN1n13heap_resourceD0Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD0Ev
+	.type	_ZN1n13heap_resourceD0Ev, @function
+_ZN1n13heap_resourceD0Ev:
+.LFB7122:
+	.cfi_startproc
+	movl	$8, %esi
+	jmp	_ZdlPvm@PLT
+	.cfi_endproc
+.LFE7122:
+	.size	_ZN1n13heap_resourceD0Ev, .-_ZN1n13heap_resourceD0Ev
+	.text
+	.p2align 4
+	.type	_ZN1n10__lsd_sortI5keyedZ32test_radix_sort_by_key_is_stablevEUlRKS1_E_EEvPT_mS6_RT0_.constprop.0, @function
+_ZN1n10__lsd_sortI5keyedZ32test_radix_sort_by_key_is_stablevEUlRKS1_E_EEvPT_mS6_RT0_.constprop.0:
+.LFB7124:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movq	%rdi, %r9
+	movl	$1024, %ecx
+	xorl	%eax, %eax
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rsi, %r10
+	movq	%rdx, %r11
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8080, %rsp
+	.cfi_def_cfa_offset 8120
+	leaq	-120(%rsp), %rbp
+	movq	%rbp, %rdi
+	rep stosq
+	xorl	%edi, %edi
+	testq	%rsi, %rsi
+	je	.L9
+	leaq	0(,%rsi,8), %rdi
+	movq	%r9, %rcx
+	leaq	(%r9,%rdi), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L10:
+	movl	(%rcx), %eax
+	addq	$8, %rcx
+	leal	-2147483648(%rax), %edx
+	movzbl	%al, %r8d
+	movzbl	%ah, %eax
+	movl	%eax, %eax
+	addq	$1, -120(%rsp,%r8,8)
+	addq	$1, 1928(%rsp,%rax,8)
+	movl	%edx, %eax
+	shrl	$24, %edx
+	shrl	$16, %eax
+	movzbl	%al, %eax
+	addq	$1, 3976(%rsp,%rax,8)
+	movl	%edx, %eax
+	addq	$1, 6024(%rsp,%rax,8)
+	cmpq	%rcx, %rsi
+	jne	.L10
+.L9:
+	leaq	1928(%rsp), %r8
+	movq	%r9, %rbx
+	xorl	%ecx, %ecx
+.L15:
+	movl	(%rbx), %eax
+	addl	$-2147483648, %eax
+	shrl	%cl, %eax
+	movzbl	%al, %eax
+	cmpq	0(%rbp,%rax,8), %r10
+	je	.L11
+	movq	%rbp, %rax
+	xorl	%edx, %edx
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	movq	(%rax), %rsi
+	movq	%rdx, (%rax)
+	addq	$8, %rax
+	addq	%rsi, %rdx
+	cmpq	%rax, %r8
+	jne	.L12
+	testq	%r10, %r10
+	je	.L13
+	movq	%rbx, %rdx
+	leaq	(%rbx,%rdi), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L14:
+	movl	(%rdx), %eax
+	addq	$8, %rdx
+	addl	$-2147483648, %eax
+	shrl	%cl, %eax
+	movzbl	%al, %eax
+	leaq	0(%rbp,%rax,8), %r12
+	movq	(%r12), %rax
+	leaq	1(%rax), %r13
+	movq	%r13, (%r12)
+	movq	-8(%rdx), %r12
+	movq	%r12, (%r11,%rax,8)
+	cmpq	%rsi, %rdx
+	jne	.L14
+.L13:
+	movq	%rbx, %rax
+	movq	%r11, %rbx
+	movq	%rax, %r11
+.L11:
+	addl	$8, %ecx
+	addq	$2048, %rbp
+	addq	$2048, %r8
+	cmpl	$32, %ecx
+	jne	.L15
+	cmpq	%rbx, %r9
+	je	.L8
+	addq	$8080, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%rdi, %rdx
+	movq	%rbx, %rsi
+	movq	%r9, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	jmp	memcpy@PLT
+.L8:
+	.cfi_restore_state
+	addq	$8080, %rsp
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE7124:
+	.size	_ZN1n10__lsd_sortI5keyedZ32test_radix_sort_by_key_is_stablevEUlRKS1_E_EEvPT_mS6_RT0_.constprop.0, .-_ZN1n10__lsd_sortI5keyedZ32test_radix_sort_by_key_is_stablevEUlRKS1_E_EEvPT_mS6_RT0_.constprop.0
+	.p2align 4
+	.type	_ZN1n10__lsd_sortIsNS_14__identity_keyEEEvPT_mS3_RT0_.isra.0, @function
+_ZN1n10__lsd_sortIsNS_14__identity_keyEEEvPT_mS3_RT0_.isra.0:
+.LFB7125:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	movq	%rdi, %r9
+	movl	$512, %ecx
+	xorl	%eax, %eax
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	movq	%rsi, %r10
+	movq	%rdx, %r8
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	xorl	%ebp, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	subq	$3976, %rsp
+	.cfi_def_cfa_offset 4024
+	leaq	-120(%rsp), %rdi
+	rep stosq
+	testq	%rsi, %rsi
+	je	.L29
+	leaq	(%rsi,%rsi), %rbp
+	movq	%r9, %rdx
+	leaq	(%r9,%rbp), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L30:
+	movzwl	(%rdx), %eax
+	addq	$2, %rdx
+	movzbl	%al, %ecx
+	addq	$32768, %rax
+	movzbl	%ah, %eax
+	addq	$1, -120(%rsp,%rcx,8)
+	addq	$1, 1928(%rsp,%rax,8)
+	cmpq	%rdx, %rsi
+	jne	.L30
+.L29:
+	leaq	1928(%rsp), %rdi
+	movq	%r9, %rbx
+	xorl	%ecx, %ecx
+.L35:
+	movzwl	(%rbx), %esi
+	leaq	-2048(%rdi), %rax
+	movq	%rax, %r11
+	leal	-32768(%rsi), %edx
+	movzwl	%dx, %edx
+	sarl	%cl, %edx
+	movzbl	%dl, %edx
+	cmpq	(%rax,%rdx,8), %r10
+	je	.L31
+	xorl	%edx, %edx
+	.p2align 4,,10
+	.p2align 3
+.L32:
+	movq	(%rax), %rsi
+	movq	%rdx, (%rax)
+	addq	$8, %rax
+	addq	%rsi, %rdx
+	cmpq	%rdi, %rax
+	jne	.L32
+	testq	%r10, %r10
+	je	.L33
+	movq	%rbx, %rdx
+	leaq	(%rbx,%rbp), %r12
+	.p2align 4,,10
+	.p2align 3
+.L34:
+	movzwl	(%rdx), %esi
+	addq	$2, %rdx
+	leal	-32768(%rsi), %eax
+	movzwl	%ax, %eax
+	sarl	%cl, %eax
+	movzbl	%al, %eax
+	leaq	(%r11,%rax,8), %r13
+	movq	0(%r13), %rax
+	leaq	1(%rax), %r14
+	movw	%si, (%r8,%rax,2)
+	movq	%r14, 0(%r13)
+	cmpq	%r12, %rdx
+	jne	.L34
+.L33:
+	movq	%rbx, %rax
+	movq	%r8, %rbx
+	movq	%rax, %r8
+.L31:
+	addq	$2048, %rdi
+	cmpl	$8, %ecx
+	je	.L48
+	movl	$8, %ecx
+	jmp	.L35
+.L48:
+	cmpq	%rbx, %r9
+	je	.L28
+	addq	$3976, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movq	%r9, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	jmp	memcpy@PLT
+.L28:
+	.cfi_restore_state
+	addq	$3976, %rsp
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE7125:
+	.size	_ZN1n10__lsd_sortIsNS_14__identity_keyEEEvPT_mS3_RT0_.isra.0, .-_ZN1n10__lsd_sortIsNS_14__identity_keyEEEvPT_mS3_RT0_.isra.0
+	.p2align 4
+	.type	_ZN1n10__lsd_sortIyNS_14__identity_keyEEEvPT_mS3_RT0_.isra.0, @function
+_ZN1n10__lsd_sortIyNS_14__identity_keyEEEvPT_mS3_RT0_.isra.0:
+.LFB7126:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp
+	xorl	%esi, %esi
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdx, %rbx
+	movl	$16384, %edx
+	subq	$16392, %rsp
+	.cfi_def_cfa_offset 16448
+	movq	%rsp, %r8
+	movq	%r8, %rdi
+	call	memset@PLT
+	xorl	%r11d, %r11d
+	movq	%rax, %r8
+	testq	%rbp, %rbp
+	je	.L50
+	leaq	0(,%rbp,8), %r11
+	movq	%r12, %rcx
+	leaq	(%r12,%r11), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L51:
+	movq	(%rcx), %rax
+	addq	$8, %rcx
+	movzbl	%al, %edx
+	addq	$1, (%rsp,%rdx,8)
+	movzbl	%ah, %edx
+	addq	$1, 2048(%rsp,%rdx,8)
+	movq	%rax, %rdx
+	shrq	$16, %rdx
+	movzbl	%dl, %edx
+	addq	$1, 4096(%rsp,%rdx,8)
+	movq	%rax, %rdx
+	shrq	$24, %rdx
+	movzbl	%dl, %edx
+	addq	$1, 6144(%rsp,%rdx,8)
+	movq	%rax, %rdx
+	shrq	$32, %rdx
+	movzbl	%dl, %edx
+	addq	$1, 8192(%rsp,%rdx,8)
+	movq	%rax, %rdx
+	shrq	$40, %rdx
+	movzbl	%dl, %edx
+	addq	$1, 10240(%rsp,%rdx,8)
+	movq	%rax, %rdx
+	shrq	$56, %rax
+	addq	$1, 14336(%rsp,%rax,8)
+	shrq	$48, %rdx
+	movzbl	%dl, %edx
+	addq	$1, 12288(%rsp,%rdx,8)
+	cmpq	%rcx, %rsi
+	jne	.L51
+.L50:
+	leaq	2048(%rsp), %rdi
+	leaq	18432(%rsp), %r10
+	movq	%r12, %r9
+	xorl	%ecx, %ecx
+	.p2align 4,,10
+	.p2align 3
+.L56:
+	movq	(%r9), %rax
+	shrq	%cl, %rax
+	movzbl	%al, %eax
+	cmpq	(%r8,%rax,8), %rbp
+	je	.L52
+	movq	%r8, %rax
+	xorl	%edx, %edx
+	.p2align 4,,10
+	.p2align 3
+.L53:
+	movq	(%rax), %rsi
+	movq	%rdx, (%rax)
+	addq	$8, %rax
+	addq	%rsi, %rdx
+	cmpq	%rax, %rdi
+	jne	.L53
+	testq	%rbp, %rbp
+	je	.L54
+	movq	%r9, %rax
+	leaq	(%r9,%r11), %r13
+	.p2align 4,,10
+	.p2align 3
+.L55:
+	movq	(%rax), %rsi
+	addq	$8, %rax
+	movq	%rsi, %rdx
+	shrq	%cl, %rdx
+	movzbl	%dl, %edx
+	leaq	(%r8,%rdx,8), %r14
+	movq	(%r14), %rdx
+	leaq	1(%rdx), %r15
+	movq	%rsi, (%rbx,%rdx,8)
+	movq	%r15, (%r14)
+	cmpq	%r13, %rax
+	jne	.L55
+.L54:
+	movq	%r9, %rax
+	movq	%rbx, %r9
+	movq	%rax, %rbx
+.L52:
+	addq	$2048, %rdi
+	addl	$8, %ecx
+	addq	$2048, %r8
+	cmpq	%rdi, %r10
+	jne	.L56
+	cmpq	%r9, %r12
+	je	.L49
+	addq	$16392, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%r12, %rdi
+	movq	%r11, %rdx
+	movq	%r9, %rsi
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	memcpy@PLT
+.L49:
+	.cfi_restore_state
+	addq	$16392, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE7126:
+	.size	_ZN1n10__lsd_sortIyNS_14__identity_keyEEEvPT_mS3_RT0_.isra.0, .-_ZN1n10__lsd_sortIyNS_14__identity_keyEEEvPT_mS3_RT0_.isra.0
+	.p2align 4
+	.type	_ZN1n10__lsd_sortIiNS_14__identity_keyEEEvPT_mS3_RT0_.isra.0, @function
+_ZN1n10__lsd_sortIiNS_14__identity_keyEEEvPT_mS3_RT0_.isra.0:
+.LFB7127:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	movq	%rdi, %r9
+	movl	$1024, %ecx
+	xorl	%eax, %eax
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	movq	%rsi, %r10
+	movq	%rdx, %r11
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	subq	$8072, %rsp
+	.cfi_def_cfa_offset 8120
+	leaq	-120(%rsp), %rbp
+	movq	%rbp, %rdi
+	rep stosq
+	xorl	%edi, %edi
+	testq	%rsi, %rsi
+	je	.L70
+	leaq	0(,%rsi,4), %rdi
+	movq	%r9, %rcx
+	leaq	(%r9,%rdi), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L71:
+	movl	(%rcx), %eax
+	addq	$4, %rcx
+	leal	-2147483648(%rax), %edx
+	movzbl	%al, %r8d
+	movzbl	%ah, %eax
+	movl	%eax, %eax
+	addq	$1, -120(%rsp,%r8,8)
+	addq	$1, 1928(%rsp,%rax,8)
+	movl	%edx, %eax
+	shrl	$24, %edx
+	shrl	$16, %eax
+	movzbl	%al, %eax
+	addq	$1, 3976(%rsp,%rax,8)
+	movl	%edx, %eax
+	addq	$1, 6024(%rsp,%rax,8)
+	cmpq	%rcx, %rsi
+	jne	.L71
+.L70:
+	leaq	1928(%rsp), %r8
+	movq	%r9, %rbx
+	xorl	%ecx, %ecx
+.L76:
+	movl	(%rbx), %eax
+	addl	$-2147483648, %eax
+	shrl	%cl, %eax
+	movzbl	%al, %eax
+	cmpq	0(%rbp,%rax,8), %r10
+	je	.L72
+	movq	%rbp, %rax
+	xorl	%edx, %edx
+	.p2align 4,,10
+	.p2align 3
+.L73:
+	movq	(%rax), %rsi
+	movq	%rdx, (%rax)
+	addq	$8, %rax
+	addq	%rsi, %rdx
+	cmpq	%rax, %r8
+	jne	.L73
+	testq	%r10, %r10
+	je	.L74
+	movq	%rbx, %rdx
+	leaq	(%rbx,%rdi), %r12
+	.p2align 4,,10
+	.p2align 3
+.L75:
+	movl	(%rdx), %esi
+	addq	$4, %rdx
+	leal	-2147483648(%rsi), %eax
+	shrl	%cl, %eax
+	movzbl	%al, %eax
+	leaq	0(%rbp,%rax,8), %r13
+	movq	0(%r13), %rax
+	leaq	1(%rax), %r14
+	movl	%esi, (%r11,%rax,4)
+	movq	%r14, 0(%r13)
+	cmpq	%r12, %rdx
+	jne	.L75
+.L74:
+	movq	%rbx, %rax
+	movq	%r11, %rbx
+	movq	%rax, %r11
+.L72:
+	addl	$8, %ecx
+	addq	$2048, %rbp
+	addq	$2048, %r8
+	cmpl	$32, %ecx
+	jne	.L76
+	cmpq	%rbx, %r9
+	je	.L69
+	addq	$8072, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	movq	%rdi, %rdx
+	movq	%rbx, %rsi
+	movq	%r9, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	jmp	memcpy@PLT
+.L69:
+	.cfi_restore_state
+	addq	$8072, %rsp
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE7127:
+	.size	_ZN1n10__lsd_sortIiNS_14__identity_keyEEEvPT_mS3_RT0_.isra.0, .-_ZN1n10__lsd_sortIiNS_14__identity_keyEEEvPT_mS3_RT0_.isra.0
+	.p2align 4
+	.type	_ZN1n9__pdqsortIiZ20test_sort_comparatorvEUliiE_EEvPT_S3_RT0_ib.isra.0, @function
+_ZN1n9__pdqsortIiZ20test_sort_comparatorvEUliiE_EEvPT_S3_RT0_ib.isra.0:
+.LFB7128:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	subq	%rdi, %r12
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%r12, %rax
+	sarq	$2, %rax
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	cmpq	$92, %r12
+	jbe	.L90
+	movl	%edx, %r13d
+	movl	%ecx, %r9d
+	.p2align 4,,10
+	.p2align 3
+.L91:
+	movq	%rax, %r10
+	movl	(%rdi), %esi
+	shrq	%r10
+	leaq	0(,%r10,4), %r8
+	leaq	(%rdi,%r8), %rdx
+	movl	(%rdx), %ecx
+	cmpq	$512, %r12
+	jbe	.L101
+	cmpl	%esi, %ecx
+	jle	.L102
+	movl	%ecx, (%rdi)
+	movl	%esi, (%rdx)
+	movl	-4(%rbp), %r11d
+	cmpl	%esi, %r11d
+	jle	.L103
+.L176:
+	movl	%r11d, (%rdx)
+	movl	%esi, -4(%rbp)
+	movl	(%rdx), %esi
+.L103:
+	movl	(%rdi), %ecx
+	cmpl	%esi, %ecx
+	jge	.L105
+	movl	%esi, (%rdi)
+	movl	%ecx, (%rdx)
+.L105:
+	leaq	-4(%rdi,%r8), %r11
+	movl	4(%rdi), %esi
+	movl	(%r11), %ecx
+	cmpl	%ecx, %esi
+	jge	.L106
+	movl	%ecx, 4(%rdi)
+	movl	%esi, %ecx
+	movl	%esi, (%r11)
+	movl	-8(%rbp), %ebx
+	cmpl	%ebx, %esi
+	jge	.L107
+.L175:
+	movl	%ebx, (%r11)
+	movl	%esi, -8(%rbp)
+	movl	(%r11), %ecx
+.L107:
+	movl	4(%rdi), %esi
+	cmpl	%ecx, %esi
+	jge	.L108
+	movl	%ecx, 4(%rdi)
+	movl	%esi, %ecx
+	movl	%esi, (%r11)
+.L108:
+	leaq	4(%rdi,%r8), %rbx
+	movl	8(%rdi), %esi
+	movl	(%rbx), %r8d
+	cmpl	%r8d, %esi
+	jge	.L109
+	movl	%r8d, 8(%rdi)
+	movl	%esi, (%rbx)
+	movl	-12(%rbp), %r12d
+	cmpl	%r12d, %esi
+	jge	.L110
+.L174:
+	movl	%r12d, (%rbx)
+	movl	%esi, -12(%rbp)
+	movl	(%rbx), %esi
+.L110:
+	movl	8(%rdi), %r8d
+	cmpl	%esi, %r8d
+	jge	.L236
+	movl	%esi, 8(%rdi)
+	movl	%r8d, (%rbx)
+	movl	(%r11), %ecx
+.L112:
+	movl	(%rdx), %esi
+	cmpl	%ecx, %esi
+	jle	.L113
+	movd	%esi, %xmm0
+	movd	%ecx, %xmm1
+	movl	%ecx, %esi
+	punpckldq	%xmm1, %xmm0
+	movq	%xmm0, (%r11)
+	movl	(%rbx), %r8d
+	cmpl	%ecx, %r8d
+	jle	.L114
+.L173:
+	movl	%r8d, (%rdx)
+	movl	%ecx, (%rbx)
+	movl	(%rdx), %esi
+.L114:
+	movl	(%r11), %ecx
+	cmpl	%esi, %ecx
+	jge	.L115
+	movd	%esi, %xmm0
+	movd	%ecx, %xmm2
+	movl	%ecx, %esi
+	punpckldq	%xmm2, %xmm0
+	movq	%xmm0, (%r11)
+.L115:
+	movl	(%rdi), %ecx
+	movl	%esi, (%rdi)
+	movl	%ecx, (%rdx)
+	movl	(%rdi), %ecx
+.L116:
+	movq	%rdi, %rbx
+	testb	%r9b, %r9b
+	jne	.L131
+	cmpl	%ecx, -4(%rdi)
+	jle	.L237
+	.p2align 4,,10
+	.p2align 3
+.L131:
+	movq	%rbx, %rsi
+	movl	4(%rbx), %r8d
+	addq	$4, %rbx
+	cmpl	%ecx, %r8d
+	jg	.L131
+	movq	%rbp, %rdx
+	cmpq	%rdi, %rsi
+	je	.L134
+	.p2align 4,,10
+	.p2align 3
+.L132:
+	subq	$4, %rdx
+	cmpl	%ecx, (%rdx)
+	jle	.L132
+.L135:
+	movq	%rax, %r11
+	shrq	$3, %r11
+	cmpq	%rdx, %rbx
+	jnb	.L136
+	movl	(%rdx), %r12d
+	.p2align 4,,10
+	.p2align 3
+.L139:
+	movl	%r12d, (%rbx)
+	movl	%r8d, (%rdx)
+	.p2align 4,,10
+	.p2align 3
+.L137:
+	movq	%rbx, %rsi
+	movl	4(%rbx), %r8d
+	addq	$4, %rbx
+	cmpl	%ecx, %r8d
+	jg	.L137
+	.p2align 4,,10
+	.p2align 3
+.L138:
+	movl	-4(%rdx), %r12d
+	subq	$4, %rdx
+	cmpl	%ecx, %r12d
+	jle	.L138
+	cmpq	%rdx, %rbx
+	jb	.L139
+	movl	-4(%rbx), %edx
+	movq	%rsi, %r8
+	movq	%rbp, %r12
+	subq	%rdi, %r8
+	subq	%rbx, %r12
+	movl	%edx, (%rdi)
+	movq	%r8, %rdx
+	movl	%ecx, -4(%rbx)
+	movq	%r12, %rcx
+	sarq	$2, %rdx
+	sarq	$2, %rcx
+	movq	%rdx, 8(%rsp)
+	cmpq	%rcx, %rdx
+	movq	%rcx, %r15
+	movq	%rcx, %r14
+	cmovbe	%rdx, %r15
+	cmpq	%r11, %r15
+	jnb	.L140
+	subl	$1, %r13d
+	jne	.L141
+.L242:
+	leaq	-1(%r10), %rbp
+	leaq	-1(%r10,%r10), %r12
+	testq	%r10, %r10
+	je	.L89
+.L145:
+	cmpq	%rax, %r12
+	jnb	.L147
+	movl	(%rdi,%rbp,4), %r11d
+	movq	%r12, %rcx
+	movq	%rbp, %r9
+	jmp	.L148
+	.p2align 4,,10
+	.p2align 3
+.L238:
+	leaq	(%rdi,%r10,8), %r10
+	movl	(%r10), %ebx
+	cmpl	%esi, %ebx
+	jge	.L186
+	movl	%ebx, %esi
+	movq	%r10, %r8
+	leaq	(%rdi,%r9,4), %rcx
+	cmpl	%esi, %r11d
+	jle	.L147
+.L144:
+	movl	%esi, (%rcx)
+	leaq	1(%rdx,%rdx), %rcx
+	movl	%r11d, (%r8)
+	cmpq	%rax, %rcx
+	jnb	.L147
+	movq	%rdx, %r9
+.L148:
+	leaq	1(%r9), %r10
+	leaq	(%rdi,%rcx,4), %r8
+	leaq	(%r10,%r10), %rdx
+	movl	(%r8), %esi
+	cmpq	%rax, %rdx
+	jb	.L238
+.L186:
+	movq	%rcx, %rdx
+	leaq	(%rdi,%r9,4), %rcx
+	cmpl	%esi, %r11d
+	jg	.L144
+.L147:
+	subq	$1, %rbp
+	subq	$2, %r12
+	cmpq	$-1, %rbp
+	jne	.L145
+	subq	$1, %rax
+	movl	(%rdi), %ecx
+	leaq	(%rdi,%rax,4), %rdx
+	movl	(%rdx), %esi
+	movl	%esi, (%rdi)
+	movl	%ecx, (%rdx)
+	cmpq	$1, %rax
+	je	.L89
+.L152:
+	movl	(%rdi), %r11d
+	movl	$1, %ecx
+	xorl	%r9d, %r9d
+	jmp	.L154
+	.p2align 4,,10
+	.p2align 3
+.L239:
+	leaq	(%rdi,%r10,8), %r10
+	movl	(%r10), %ebx
+	cmpl	%esi, %ebx
+	jge	.L188
+	movl	%ebx, %esi
+	movq	%r10, %r8
+	leaq	(%rdi,%r9,4), %rcx
+	cmpl	%esi, %r11d
+	jle	.L153
+.L151:
+	movl	%esi, (%rcx)
+	leaq	1(%rdx,%rdx), %rcx
+	movl	%r11d, (%r8)
+	cmpq	%rax, %rcx
+	jnb	.L153
+	movq	%rdx, %r9
+.L154:
+	leaq	1(%r9), %r10
+	leaq	(%rdi,%rcx,4), %r8
+	leaq	(%r10,%r10), %rdx
+	movl	(%r8), %esi
+	cmpq	%rax, %rdx
+	jb	.L239
+.L188:
+	movq	%rcx, %rdx
+	leaq	(%rdi,%r9,4), %rcx
+	cmpl	%esi, %r11d
+	jg	.L151
+.L153:
+	subq	$1, %rax
+	movl	(%rdi), %edx
+	movl	(%rdi,%rax,4), %ecx
+	movl	%ecx, (%rdi)
+	movl	%edx, (%rdi,%rax,4)
+	cmpq	$1, %rax
+	jne	.L152
+.L89:
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L240:
+	.cfi_restore_state
+	subq	$4, %rdx
+	cmpl	%ecx, (%rdx)
+	jg	.L135
+.L134:
+	cmpq	%rdx, %rbx
+	jb	.L240
+	movq	%rax, %r11
+	shrq	$3, %r11
+.L136:
+	movl	-4(%rbx), %edx
+	movq	%rsi, %r8
+	movq	%rbp, %r12
+	subq	%rdi, %r8
+	subq	%rbx, %r12
+	movl	%edx, (%rdi)
+	movq	%r8, %r15
+	movl	%ecx, -4(%rbx)
+	movq	%r12, %rcx
+	sarq	$2, %r15
+	sarq	$2, %rcx
+	movq	%r15, 8(%rsp)
+	movq	%r15, %rdx
+	cmpq	%rcx, %r15
+	movq	%rcx, %r14
+	cmova	%rcx, %r15
+	cmpq	%r11, %r15
+	jnb	.L241
+	subl	$1, %r13d
+	je	.L242
+.L141:
+	cmpq	$92, %r8
+	jbe	.L156
+	andq	$-4, %rdx
+	movl	(%rdi), %r10d
+	leaq	(%rdi,%rdx), %rax
+	movl	(%rax), %r11d
+	movl	%r11d, (%rdi)
+	movl	%r10d, (%rax)
+	movq	%rsi, %rax
+	movl	-8(%rbx), %r10d
+	subq	%rdx, %rax
+	movl	(%rax), %r11d
+	movl	%r11d, -8(%rbx)
+	movl	%r10d, (%rax)
+	cmpq	$512, %r8
+	jbe	.L156
+	leaq	4(%rdi,%rdx), %rax
+	movl	4(%rdi), %r8d
+	movl	(%rax), %r10d
+	movl	%r10d, 4(%rdi)
+	movl	%r8d, (%rax)
+	leaq	8(%rdi,%rdx), %rax
+	movl	8(%rdi), %r8d
+	movl	(%rax), %r10d
+	movl	%r10d, 8(%rdi)
+	movl	%r8d, (%rax)
+	movq	8(%rsp), %rax
+	movl	-12(%rbx), %r8d
+	notq	%rax
+	andq	$-4, %rax
+	addq	%rsi, %rax
+	movl	(%rax), %r10d
+	movl	%r10d, -12(%rbx)
+	movl	%r8d, (%rax)
+	movq	%rsi, %rax
+	subq	%rdx, %rax
+	movl	-16(%rbx), %edx
+	movl	-8(%rax), %r8d
+	movl	%r8d, -16(%rbx)
+	movl	%edx, -8(%rax)
+.L156:
+	cmpq	$92, %r12
+	ja	.L243
+.L140:
+	movzbl	%r9b, %ecx
+	movl	%r13d, %edx
+	call	_ZN1n9__pdqsortIiZ20test_sort_comparatorvEUliiE_EEvPT_S3_RT0_ib.isra.0
+	movq	%r14, %rax
+	movq	%rbx, %rdi
+.L130:
+	xorl	%r9d, %r9d
+	cmpq	$92, %r12
+	ja	.L91
+.L92:
+	addq	$4, %rdi
+	cmpq	%rbp, %rdi
+	jnb	.L89
+	movl	-4(%rdi), %edx
+	movl	(%rdi), %ecx
+	cmpl	%ecx, %edx
+	jge	.L92
+	movq	%rdi, %rax
+	.p2align 4,,10
+	.p2align 3
+.L99:
+	movl	%edx, (%rax)
+	movl	-8(%rax), %edx
+	subq	$4, %rax
+	cmpl	%edx, %ecx
+	jg	.L99
+	movl	%ecx, (%rax)
+	jmp	.L92
+.L101:
+	cmpl	%esi, %ecx
+	jge	.L117
+	movl	%esi, (%rdx)
+	movl	%ecx, (%rdi)
+	movl	-4(%rbp), %r8d
+	cmpl	%ecx, %r8d
+	jle	.L118
+.L178:
+	movl	%r8d, (%rdi)
+	movl	%ecx, -4(%rbp)
+	movl	(%rdi), %ecx
+.L118:
+	movl	(%rdx), %esi
+	cmpl	%ecx, %esi
+	jge	.L116
+	movl	%ecx, (%rdx)
+	movl	%esi, (%rdi)
+.L235:
+	movl	%esi, %ecx
+	jmp	.L116
+.L243:
+	movq	%r14, %rax
+	movl	(%rbx), %r8d
+	andq	$-4, %rcx
+	shrq	$2, %rax
+	leaq	4(,%rax,4), %rax
+	leaq	(%rsi,%rax), %rdx
+	movl	(%rdx), %r10d
+	movl	%r10d, (%rbx)
+	movl	%r8d, (%rdx)
+	movq	%rbp, %rdx
+	subq	%rcx, %rdx
+	movl	-4(%rbp), %ecx
+	movl	(%rdx), %r8d
+	movl	%r8d, -4(%rbp)
+	movl	%ecx, (%rdx)
+	cmpq	$512, %r12
+	jbe	.L140
+	leaq	4(%rsi,%rax), %rdx
+	movl	4(%rbx), %ecx
+	movl	(%rdx), %r8d
+	movl	%r8d, 4(%rbx)
+	movl	%ecx, (%rdx)
+	leaq	8(%rsi,%rax), %rdx
+	movl	8(%rbx), %ecx
+	movl	(%rdx), %r8d
+	movl	%r8d, 8(%rbx)
+	movl	%ecx, (%rdx)
+	movq	%rbp, %rdx
+	movl	-8(%rbp), %ecx
+	subq	%rax, %rdx
+	movl	(%rdx), %r8d
+	movl	%r8d, -8(%rbp)
+	movl	%ecx, (%rdx)
+	movq	$-4, %rdx
+	subq	%rax, %rdx
+	leaq	0(%rbp,%rdx), %rax
+	movl	-12(%rbp), %edx
+	movl	(%rax), %ecx
+	movl	%ecx, -12(%rbp)
+	movl	%edx, (%rax)
+	jmp	.L140
+.L117:
+	movl	-4(%rbp), %r8d
+	cmpl	%esi, %r8d
+	jle	.L235
+	movl	%esi, %ecx
+	jmp	.L178
+.L102:
+	movl	-4(%rbp), %r11d
+	cmpl	%ecx, %r11d
+	jle	.L105
+	movl	%ecx, %esi
+	jmp	.L176
+.L113:
+	cmpl	%r8d, %esi
+	jge	.L115
+	movl	%esi, %ecx
+	jmp	.L173
+.L109:
+	movl	-12(%rbp), %r12d
+	cmpl	%r8d, %r12d
+	jle	.L112
+	movl	%r8d, %esi
+	jmp	.L174
+.L106:
+	movl	-8(%rbp), %ebx
+	cmpl	%ebx, %ecx
+	jge	.L108
+	movl	%ecx, %esi
+	jmp	.L175
+.L237:
+	movq	%rbp, %rax
+	.p2align 4,,10
+	.p2align 3
+.L120:
+	movq	%rax, %r9
+	movl	-4(%rax), %esi
+	subq	$4, %rax
+	cmpl	%ecx, %esi
+	jl	.L120
+	movq	%rdi, %rdx
+	cmpq	%r9, %rbp
+	je	.L123
+	.p2align 4,,10
+	.p2align 3
+.L121:
+	addq	$4, %rdx
+	cmpl	%ecx, (%rdx)
+	jge	.L121
+.L124:
+	cmpq	%rax, %rdx
+	jnb	.L122
+	movl	(%rdx), %r8d
+.L129:
+	movl	%esi, (%rdx)
+	movl	%r8d, (%rax)
+	.p2align 4,,10
+	.p2align 3
+.L125:
+	movq	%rax, %r9
+	movl	-4(%rax), %esi
+	subq	$4, %rax
+	cmpl	%ecx, %esi
+	jl	.L125
+	.p2align 4,,10
+	.p2align 3
+.L126:
+	movl	4(%rdx), %r8d
+	addq	$4, %rdx
+	cmpl	%ecx, %r8d
+	jge	.L126
+	cmpq	%rax, %rdx
+	jb	.L129
+	jmp	.L122
+.L244:
+	addq	$4, %rdx
+	cmpl	%ecx, (%rdx)
+	jl	.L124
+.L123:
+	cmpq	%rax, %rdx
+	jb	.L244
+.L122:
+	movq	%rbp, %r12
+	movl	%esi, (%rdi)
+	movq	%r9, %rdi
+	subq	%r9, %r12
+	movl	%ecx, (%rax)
+	movq	%r12, %rax
+	sarq	$2, %rax
+	jmp	.L130
+.L236:
+	movl	(%r11), %ecx
+	movl	%esi, %r8d
+	jmp	.L112
+.L241:
+	cmpq	%rdi, %rsi
+	je	.L161
+	leaq	4(%rdi), %rdx
+	cmpq	%rsi, %rdx
+	jnb	.L161
+	xorl	%r10d, %r10d
+	jmp	.L166
+	.p2align 4,,10
+	.p2align 3
+.L162:
+	addq	$4, %rdx
+	cmpq	%rsi, %rdx
+	jnb	.L161
+.L166:
+	movl	(%rdx), %ecx
+	cmpl	%ecx, -4(%rdx)
+	jge	.L162
+	movq	%rdx, %rax
+.L164:
+	movl	-4(%rax), %r8d
+	subq	$4, %rax
+	movl	%r8d, 4(%rax)
+	cmpq	%rdi, %rax
+	je	.L163
+	cmpl	-4(%rax), %ecx
+	jg	.L164
+.L163:
+	movl	%ecx, (%rax)
+	movq	%rdx, %rcx
+	subq	%rax, %rcx
+	movq	%rcx, %rax
+	sarq	$2, %rax
+	addq	%rax, %r10
+	cmpq	$8, %r10
+	jbe	.L162
+	addq	$4, %rdx
+	cmpq	%rdx, %rsi
+	jne	.L140
+.L161:
+	cmpq	%rbx, %rbp
+	je	.L89
+	leaq	8(%rsi), %rdx
+	cmpq	%rbp, %rdx
+	jnb	.L89
+	xorl	%r8d, %r8d
+	jmp	.L170
+.L167:
+	addq	$4, %rdx
+	cmpq	%rbp, %rdx
+	jnb	.L89
+.L170:
+	movl	(%rdx), %ecx
+	cmpl	%ecx, -4(%rdx)
+	jge	.L167
+	movq	%rdx, %rax
+.L169:
+	movl	-4(%rax), %r10d
+	subq	$4, %rax
+	movl	%r10d, 4(%rax)
+	cmpq	%rax, %rbx
+	je	.L168
+	cmpl	-4(%rax), %ecx
+	jg	.L169
+.L168:
+	movl	%ecx, (%rax)
+	movq	%rdx, %rcx
+	subq	%rax, %rcx
+	movq	%rcx, %rax
+	sarq	$2, %rax
+	addq	%rax, %r8
+	cmpq	$8, %r8
+	jbe	.L167
+	addq	$4, %rdx
+	cmpq	%rdx, %rbp
+	jne	.L140
+	jmp	.L89
+	.p2align 4,,10
+	.p2align 3
+.L90:
+	testb	%cl, %cl
+	je	.L92
+	cmpq	%rdi, %rsi
+	je	.L89
+	leaq	4(%rdi), %rdx
+	cmpq	%rsi, %rdx
+	jb	.L97
+	jmp	.L89
+	.p2align 4,,10
+	.p2align 3
+.L94:
+	addq	$4, %rdx
+	cmpq	%rbp, %rdx
+	jnb	.L89
+.L97:
+	movl	(%rdx), %ecx
+	cmpl	%ecx, -4(%rdx)
+	jge	.L94
+	movq	%rdx, %rax
+.L96:
+	movl	-4(%rax), %esi
+	subq	$4, %rax
+	movl	%esi, 4(%rax)
+	cmpq	%rax, %rdi
+	je	.L95
+	cmpl	-4(%rax), %ecx
+	jg	.L96
+.L95:
+	movl	%ecx, (%rax)
+	jmp	.L94
+	.cfi_endproc
+.LFE7128:
+	.size	_ZN1n9__pdqsortIiZ20test_sort_comparatorvEUliiE_EEvPT_S3_RT0_ib.isra.0, .-_ZN1n9__pdqsortIiZ20test_sort_comparatorvEUliiE_EEvPT_S3_RT0_ib.isra.0
+	.p2align 4
+	.type	_ZN1n9__pdqsortIiNS_4lessEEEvPT_S3_RT0_ib.isra.0, @function
+_ZN1n9__pdqsortIiNS_4lessEEEvPT_S3_RT0_ib.isra.0:
+.LFB7136:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	subq	%rdi, %r12
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%r12, %rax
+	sarq	$2, %rax
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	cmpq	$92, %r12
+	jbe	.L246
+	movl	%edx, %r13d
+	movl	%ecx, %r9d
+	.p2align 4,,10
+	.p2align 3
+.L247:
+	movq	%rax, %r10
+	movl	(%rdi), %esi
+	shrq	%r10
+	leaq	0(,%r10,4), %r8
+	leaq	(%rdi,%r8), %rdx
+	movl	(%rdx), %ecx
+	cmpq	$512, %r12
+	jbe	.L257
+	cmpl	%ecx, %esi
+	jle	.L258
+	movl	%ecx, (%rdi)
+	movl	%esi, (%rdx)
+	movl	-4(%rbp), %r11d
+	cmpl	%esi, %r11d
+	jge	.L259
+.L331:
+	movl	%r11d, (%rdx)
+	movl	%esi, -4(%rbp)
+	movl	(%rdx), %esi
+.L259:
+	movl	(%rdi), %ecx
+	cmpl	%esi, %ecx
+	jle	.L261
+	movl	%esi, (%rdi)
+	movl	%ecx, (%rdx)
+.L261:
+	leaq	-4(%rdi,%r8), %r11
+	movl	4(%rdi), %esi
+	movl	(%r11), %ecx
+	cmpl	%esi, %ecx
+	jge	.L262
+	movl	%ecx, 4(%rdi)
+	movl	%esi, %ecx
+	movl	%esi, (%r11)
+	movl	-8(%rbp), %ebx
+	cmpl	%ebx, %esi
+	jle	.L263
+.L330:
+	movl	%ebx, (%r11)
+	movl	%esi, -8(%rbp)
+	movl	(%r11), %ecx
+.L263:
+	movl	4(%rdi), %esi
+	cmpl	%ecx, %esi
+	jle	.L264
+	movl	%ecx, 4(%rdi)
+	movl	%esi, %ecx
+	movl	%esi, (%r11)
+.L264:
+	leaq	4(%rdi,%r8), %rbx
+	movl	8(%rdi), %esi
+	movl	(%rbx), %r8d
+	cmpl	%esi, %r8d
+	jge	.L265
+	movl	%r8d, 8(%rdi)
+	movl	%esi, (%rbx)
+	movl	-12(%rbp), %r12d
+	cmpl	%r12d, %esi
+	jle	.L266
+.L329:
+	movl	%r12d, (%rbx)
+	movl	%esi, -12(%rbp)
+	movl	(%rbx), %esi
+.L266:
+	movl	8(%rdi), %r8d
+	cmpl	%esi, %r8d
+	jle	.L391
+	movl	%esi, 8(%rdi)
+	movl	%r8d, (%rbx)
+	movl	(%r11), %ecx
+.L268:
+	movl	(%rdx), %esi
+	cmpl	%ecx, %esi
+	jge	.L269
+	movd	%esi, %xmm0
+	movd	%ecx, %xmm1
+	movl	%ecx, %esi
+	punpckldq	%xmm1, %xmm0
+	movq	%xmm0, (%r11)
+	movl	(%rbx), %r8d
+	cmpl	%ecx, %r8d
+	jge	.L270
+.L328:
+	movl	%r8d, (%rdx)
+	movl	%ecx, (%rbx)
+	movl	(%rdx), %esi
+.L270:
+	movl	(%r11), %ecx
+	cmpl	%esi, %ecx
+	jle	.L271
+	movd	%esi, %xmm0
+	movd	%ecx, %xmm2
+	movl	%ecx, %esi
+	punpckldq	%xmm2, %xmm0
+	movq	%xmm0, (%r11)
+.L271:
+	movl	(%rdi), %ecx
+	movl	%esi, (%rdi)
+	movl	%ecx, (%rdx)
+	movl	(%rdi), %ecx
+.L272:
+	movq	%rdi, %rbx
+	testb	%r9b, %r9b
+	jne	.L287
+	cmpl	%ecx, -4(%rdi)
+	jge	.L392
+	.p2align 4,,10
+	.p2align 3
+.L287:
+	movq	%rbx, %rsi
+	movl	4(%rbx), %r8d
+	addq	$4, %rbx
+	cmpl	%ecx, %r8d
+	jl	.L287
+	movq	%rbp, %rdx
+	cmpq	%rdi, %rsi
+	je	.L290
+	.p2align 4,,10
+	.p2align 3
+.L288:
+	subq	$4, %rdx
+	cmpl	%ecx, (%rdx)
+	jge	.L288
+.L291:
+	movq	%rax, %r11
+	shrq	$3, %r11
+	cmpq	%rdx, %rbx
+	jnb	.L292
+	movl	(%rdx), %r12d
+	.p2align 4,,10
+	.p2align 3
+.L295:
+	movl	%r12d, (%rbx)
+	movl	%r8d, (%rdx)
+	.p2align 4,,10
+	.p2align 3
+.L293:
+	movq	%rbx, %rsi
+	movl	4(%rbx), %r8d
+	addq	$4, %rbx
+	cmpl	%ecx, %r8d
+	jl	.L293
+	.p2align 4,,10
+	.p2align 3
+.L294:
+	movl	-4(%rdx), %r12d
+	subq	$4, %rdx
+	cmpl	%ecx, %r12d
+	jge	.L294
+	cmpq	%rdx, %rbx
+	jb	.L295
+	movl	-4(%rbx), %edx
+	movq	%rsi, %r8
+	movq	%rbp, %r12
+	subq	%rdi, %r8
+	subq	%rbx, %r12
+	movl	%edx, (%rdi)
+	movq	%r8, %rdx
+	movl	%ecx, -4(%rbx)
+	movq	%r12, %rcx
+	sarq	$2, %rdx
+	sarq	$2, %rcx
+	movq	%rdx, 8(%rsp)
+	cmpq	%rcx, %rdx
+	movq	%rcx, %r15
+	movq	%rcx, %r14
+	cmovbe	%rdx, %r15
+	cmpq	%r11, %r15
+	jnb	.L296
+	subl	$1, %r13d
+	jne	.L297
+.L397:
+	leaq	-1(%r10), %rbp
+	leaq	-1(%r10,%r10), %r12
+	testq	%r10, %r10
+	je	.L245
+.L301:
+	cmpq	%rax, %r12
+	jnb	.L303
+	movl	(%rdi,%rbp,4), %r11d
+	movq	%r12, %rcx
+	movq	%rbp, %r9
+	jmp	.L304
+	.p2align 4,,10
+	.p2align 3
+.L393:
+	leaq	(%rdi,%r10,8), %r10
+	movl	(%r10), %ebx
+	cmpl	%esi, %ebx
+	jle	.L341
+	movl	%ebx, %esi
+	movq	%r10, %r8
+	leaq	(%rdi,%r9,4), %rcx
+	cmpl	%esi, %r11d
+	jge	.L303
+.L300:
+	movl	%esi, (%rcx)
+	leaq	1(%rdx,%rdx), %rcx
+	movl	%r11d, (%r8)
+	cmpq	%rax, %rcx
+	jnb	.L303
+	movq	%rdx, %r9
+.L304:
+	leaq	1(%r9), %r10
+	leaq	(%rdi,%rcx,4), %r8
+	leaq	(%r10,%r10), %rdx
+	movl	(%r8), %esi
+	cmpq	%rax, %rdx
+	jb	.L393
+.L341:
+	movq	%rcx, %rdx
+	leaq	(%rdi,%r9,4), %rcx
+	cmpl	%esi, %r11d
+	jl	.L300
+.L303:
+	subq	$1, %rbp
+	subq	$2, %r12
+	cmpq	$-1, %rbp
+	jne	.L301
+	subq	$1, %rax
+	movl	(%rdi), %ecx
+	leaq	(%rdi,%rax,4), %rdx
+	movl	(%rdx), %esi
+	movl	%esi, (%rdi)
+	movl	%ecx, (%rdx)
+	cmpq	$1, %rax
+	je	.L245
+.L308:
+	movl	(%rdi), %r11d
+	movl	$1, %ecx
+	xorl	%r9d, %r9d
+	jmp	.L310
+	.p2align 4,,10
+	.p2align 3
+.L394:
+	leaq	(%rdi,%r10,8), %r10
+	movl	(%r10), %ebx
+	cmpl	%esi, %ebx
+	jle	.L343
+	movl	%ebx, %esi
+	movq	%r10, %r8
+	leaq	(%rdi,%r9,4), %rcx
+	cmpl	%esi, %r11d
+	jge	.L309
+.L307:
+	movl	%esi, (%rcx)
+	leaq	1(%rdx,%rdx), %rcx
+	movl	%r11d, (%r8)
+	cmpq	%rax, %rcx
+	jnb	.L309
+	movq	%rdx, %r9
+.L310:
+	leaq	1(%r9), %r10
+	leaq	(%rdi,%rcx,4), %r8
+	leaq	(%r10,%r10), %rdx
+	movl	(%r8), %esi
+	cmpq	%rax, %rdx
+	jb	.L394
+.L343:
+	movq	%rcx, %rdx
+	leaq	(%rdi,%r9,4), %rcx
+	cmpl	%esi, %r11d
+	jl	.L307
+.L309:
+	subq	$1, %rax
+	movl	(%rdi), %edx
+	movl	(%rdi,%rax,4), %ecx
+	movl	%ecx, (%rdi)
+	movl	%edx, (%rdi,%rax,4)
+	cmpq	$1, %rax
+	jne	.L308
+.L245:
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L395:
+	.cfi_restore_state
+	subq	$4, %rdx
+	cmpl	%ecx, (%rdx)
+	jl	.L291
+.L290:
+	cmpq	%rdx, %rbx
+	jb	.L395
+	movq	%rax, %r11
+	shrq	$3, %r11
+.L292:
+	movl	-4(%rbx), %edx
+	movq	%rsi, %r8
+	movq	%rbp, %r12
+	subq	%rdi, %r8
+	subq	%rbx, %r12
+	movl	%edx, (%rdi)
+	movq	%r8, %r15
+	movl	%ecx, -4(%rbx)
+	movq	%r12, %rcx
+	sarq	$2, %r15
+	sarq	$2, %rcx
+	movq	%r15, 8(%rsp)
+	movq	%r15, %rdx
+	cmpq	%rcx, %r15
+	movq	%rcx, %r14
+	cmova	%rcx, %r15
+	cmpq	%r11, %r15
+	jnb	.L396
+	subl	$1, %r13d
+	je	.L397
+.L297:
+	cmpq	$92, %r8
+	jbe	.L312
+	andq	$-4, %rdx
+	movl	(%rdi), %r10d
+	leaq	(%rdi,%rdx), %rax
+	movl	(%rax), %r11d
+	movl	%r11d, (%rdi)
+	movl	%r10d, (%rax)
+	movq	%rsi, %rax
+	movl	-8(%rbx), %r10d
+	subq	%rdx, %rax
+	movl	(%rax), %r11d
+	movl	%r11d, -8(%rbx)
+	movl	%r10d, (%rax)
+	cmpq	$512, %r8
+	jbe	.L312
+	leaq	4(%rdi,%rdx), %rax
+	movl	4(%rdi), %r8d
+	movl	(%rax), %r10d
+	movl	%r10d, 4(%rdi)
+	movl	%r8d, (%rax)
+	leaq	8(%rdi,%rdx), %rax
+	movl	8(%rdi), %r8d
+	movl	(%rax), %r10d
+	movl	%r10d, 8(%rdi)
+	movl	%r8d, (%rax)
+	movq	8(%rsp), %rax
+	movl	-12(%rbx), %r8d
+	notq	%rax
+	andq	$-4, %rax
+	addq	%rsi, %rax
+	movl	(%rax), %r10d
+	movl	%r10d, -12(%rbx)
+	movl	%r8d, (%rax)
+	movq	%rsi, %rax
+	subq	%rdx, %rax
+	movl	-16(%rbx), %edx
+	movl	-8(%rax), %r8d
+	movl	%r8d, -16(%rbx)
+	movl	%edx, -8(%rax)
+.L312:
+	cmpq	$92, %r12
+	ja	.L398
+.L296:
+	movzbl	%r9b, %ecx
+	movl	%r13d, %edx
+	call	_ZN1n9__pdqsortIiNS_4lessEEEvPT_S3_RT0_ib.isra.0
+	movq	%r14, %rax
+	movq	%rbx, %rdi
+.L286:
+	xorl	%r9d, %r9d
+	cmpq	$92, %r12
+	ja	.L247
+.L248:
+	addq	$4, %rdi
+	cmpq	%rbp, %rdi
+	jnb	.L245
+	movl	(%rdi), %ecx
+	movl	-4(%rdi), %edx
+	cmpl	%edx, %ecx
+	jge	.L248
+	movq	%rdi, %rax
+	.p2align 4,,10
+	.p2align 3
+.L255:
+	movl	%edx, (%rax)
+	movl	-8(%rax), %edx
+	subq	$4, %rax
+	cmpl	%edx, %ecx
+	jl	.L255
+	movl	%ecx, (%rax)
+	jmp	.L248
+.L257:
+	cmpl	%ecx, %esi
+	jge	.L273
+	movl	%esi, (%rdx)
+	movl	%ecx, (%rdi)
+	movl	-4(%rbp), %r8d
+	cmpl	%ecx, %r8d
+	jge	.L274
+.L333:
+	movl	%r8d, (%rdi)
+	movl	%ecx, -4(%rbp)
+	movl	(%rdi), %ecx
+.L274:
+	movl	(%rdx), %esi
+	cmpl	%ecx, %esi
+	jle	.L272
+	movl	%ecx, (%rdx)
+	movl	%esi, (%rdi)
+.L390:
+	movl	%esi, %ecx
+	jmp	.L272
+.L398:
+	movq	%r14, %rax
+	movl	(%rbx), %r8d
+	andq	$-4, %rcx
+	shrq	$2, %rax
+	leaq	4(,%rax,4), %rax
+	leaq	(%rsi,%rax), %rdx
+	movl	(%rdx), %r10d
+	movl	%r10d, (%rbx)
+	movl	%r8d, (%rdx)
+	movq	%rbp, %rdx
+	subq	%rcx, %rdx
+	movl	-4(%rbp), %ecx
+	movl	(%rdx), %r8d
+	movl	%r8d, -4(%rbp)
+	movl	%ecx, (%rdx)
+	cmpq	$512, %r12
+	jbe	.L296
+	leaq	4(%rsi,%rax), %rdx
+	movl	4(%rbx), %ecx
+	movl	(%rdx), %r8d
+	movl	%r8d, 4(%rbx)
+	movl	%ecx, (%rdx)
+	leaq	8(%rsi,%rax), %rdx
+	movl	8(%rbx), %ecx
+	movl	(%rdx), %r8d
+	movl	%r8d, 8(%rbx)
+	movl	%ecx, (%rdx)
+	movq	%rbp, %rdx
+	movl	-8(%rbp), %ecx
+	subq	%rax, %rdx
+	movl	(%rdx), %r8d
+	movl	%r8d, -8(%rbp)
+	movl	%ecx, (%rdx)
+	movq	$-4, %rdx
+	subq	%rax, %rdx
+	leaq	0(%rbp,%rdx), %rax
+	movl	-12(%rbp), %edx
+	movl	(%rax), %ecx
+	movl	%ecx, -12(%rbp)
+	movl	%edx, (%rax)
+	jmp	.L296
+.L273:
+	movl	-4(%rbp), %r8d
+	cmpl	%esi, %r8d
+	jge	.L390
+	movl	%esi, %ecx
+	jmp	.L333
+.L258:
+	movl	-4(%rbp), %r11d
+	cmpl	%ecx, %r11d
+	jge	.L261
+	movl	%ecx, %esi
+	jmp	.L331
+.L269:
+	cmpl	%r8d, %esi
+	jle	.L271
+	movl	%esi, %ecx
+	jmp	.L328
+.L265:
+	movl	-12(%rbp), %r12d
+	cmpl	%r12d, %r8d
+	jle	.L268
+	movl	%r8d, %esi
+	jmp	.L329
+.L262:
+	movl	-8(%rbp), %ebx
+	cmpl	%ebx, %ecx
+	jle	.L264
+	movl	%ecx, %esi
+	jmp	.L330
+.L392:
+	movq	%rbp, %rax
+	.p2align 4,,10
+	.p2align 3
+.L276:
+	movq	%rax, %r9
+	movl	-4(%rax), %esi
+	subq	$4, %rax
+	cmpl	%ecx, %esi
+	jg	.L276
+	movq	%rdi, %rdx
+	cmpq	%r9, %rbp
+	je	.L279
+	.p2align 4,,10
+	.p2align 3
+.L277:
+	addq	$4, %rdx
+	cmpl	%ecx, (%rdx)
+	jle	.L277
+.L280:
+	cmpq	%rax, %rdx
+	jnb	.L278
+	movl	(%rdx), %r8d
+.L285:
+	movl	%esi, (%rdx)
+	movl	%r8d, (%rax)
+	.p2align 4,,10
+	.p2align 3
+.L281:
+	movq	%rax, %r9
+	movl	-4(%rax), %esi
+	subq	$4, %rax
+	cmpl	%ecx, %esi
+	jg	.L281
+	.p2align 4,,10
+	.p2align 3
+.L282:
+	movl	4(%rdx), %r8d
+	addq	$4, %rdx
+	cmpl	%ecx, %r8d
+	jle	.L282
+	cmpq	%rax, %rdx
+	jb	.L285
+	jmp	.L278
+.L399:
+	addq	$4, %rdx
+	cmpl	%ecx, (%rdx)
+	jg	.L280
+.L279:
+	cmpq	%rax, %rdx
+	jb	.L399
+.L278:
+	movq	%rbp, %r12
+	movl	%esi, (%rdi)
+	movq	%r9, %rdi
+	subq	%r9, %r12
+	movl	%ecx, (%rax)
+	movq	%r12, %rax
+	sarq	$2, %rax
+	jmp	.L286
+.L391:
+	movl	(%r11), %ecx
+	movl	%esi, %r8d
+	jmp	.L268
+.L396:
+	cmpq	%rdi, %rsi
+	je	.L317
+	leaq	4(%rdi), %rdx
+	cmpq	%rsi, %rdx
+	jnb	.L317
+	xorl	%r10d, %r10d
+	jmp	.L321
+	.p2align 4,,10
+	.p2align 3
+.L318:
+	addq	$4, %rdx
+	cmpq	%rsi, %rdx
+	jnb	.L317
+.L321:
+	movl	(%rdx), %ecx
+	cmpl	-4(%rdx), %ecx
+	jge	.L318
+	movq	%rdx, %rax
+.L320:
+	movl	-4(%rax), %r8d
+	subq	$4, %rax
+	movl	%r8d, 4(%rax)
+	cmpq	%rdi, %rax
+	je	.L319
+	cmpl	-4(%rax), %ecx
+	jl	.L320
+.L319:
+	movl	%ecx, (%rax)
+	movq	%rdx, %rcx
+	subq	%rax, %rcx
+	movq	%rcx, %rax
+	sarq	$2, %rax
+	addq	%rax, %r10
+	cmpq	$8, %r10
+	jbe	.L318
+	addq	$4, %rdx
+	cmpq	%rdx, %rsi
+	jne	.L296
+.L317:
+	cmpq	%rbx, %rbp
+	je	.L245
+	leaq	8(%rsi), %rdx
+	cmpq	%rbp, %rdx
+	jnb	.L245
+	xorl	%r8d, %r8d
+	jmp	.L325
+.L322:
+	addq	$4, %rdx
+	cmpq	%rbp, %rdx
+	jnb	.L245
+.L325:
+	movl	(%rdx), %ecx
+	cmpl	-4(%rdx), %ecx
+	jge	.L322
+	movq	%rdx, %rax
+.L324:
+	movl	-4(%rax), %r10d
+	subq	$4, %rax
+	movl	%r10d, 4(%rax)
+	cmpq	%rax, %rbx
+	je	.L323
+	cmpl	-4(%rax), %ecx
+	jl	.L324
+.L323:
+	movl	%ecx, (%rax)
+	movq	%rdx, %rcx
+	subq	%rax, %rcx
+	movq	%rcx, %rax
+	sarq	$2, %rax
+	addq	%rax, %r8
+	cmpq	$8, %r8
+	jbe	.L322
+	addq	$4, %rdx
+	cmpq	%rdx, %rbp
+	jne	.L296
+	jmp	.L245
+	.p2align 4,,10
+	.p2align 3
+.L246:
+	testb	%cl, %cl
+	je	.L248
+	cmpq	%rdi, %rsi
+	je	.L245
+	leaq	4(%rdi), %rdx
+	cmpq	%rsi, %rdx
+	jb	.L253
+	jmp	.L245
+	.p2align 4,,10
+	.p2align 3
+.L250:
+	addq	$4, %rdx
+	cmpq	%rbp, %rdx
+	jnb	.L245
+.L253:
+	movl	(%rdx), %ecx
+	cmpl	-4(%rdx), %ecx
+	jge	.L250
+	movq	%rdx, %rax
+.L252:
+	movl	-4(%rax), %esi
+	subq	$4, %rax
+	movl	%esi, 4(%rax)
+	cmpq	%rax, %rdi
+	je	.L251
+	cmpl	-4(%rax), %ecx
+	jl	.L252
+.L251:
+	movl	%ecx, (%rax)
+	jmp	.L250
+	.cfi_endproc
+.LFE7136:
+	.size	_ZN1n9__pdqsortIiNS_4lessEEEvPT_S3_RT0_ib.isra.0, .-_ZN1n9__pdqsortIiNS_4lessEEEvPT_S3_RT0_ib.isra.0
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"expected true : sorted(v)"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC1:
+	.string	"expected equal : expected value : checksum(v), actual value : sum"
+	.section	.text.unlikely,"ax",@progbits
+.LCOLDB2:
+	.text
+.LHOTB2:
+	.p2align 4
+	.globl	_Z18test_sort_patternsv
+	.type	_Z18test_sort_patternsv, @function
+_Z18test_sort_patternsv:
+.LFB6775:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6775
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	movl	$0, 12(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L474:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, (%rsp)
+	testq	%rax, %rax
+	je	.L531
+.L401:
+	movl	12(%rsp), %eax
+	cmpl	$4, %eax
+	ja	.L478
+	leaq	.L407(%rip), %rdi
+	xorl	%r15d, %r15d
+	movslq	(%rdi,%rax,4), %rax
+	addq	%rdi, %rax
+	jmp	*%rax
+	.section	.rodata
+	.align 4
+	.align 4
+.L407:
+	.long	.L479-.L407
+	.long	.L480-.L407
+	.long	.L481-.L407
+	.long	.L482-.L407
+	.long	.L483-.L407
+	.text
+	.p2align 4,,10
+	.p2align 3
+.L482:
+	xorl	%r12d, %r12d
+	movl	$1, %ebx
+	xorl	%r13d, %r13d
+	xorl	%ebp, %ebp
+	jmp	.L408
+	.p2align 4,,10
+	.p2align 3
+.L434:
+	movl	$7, 0(%rbp,%r13)
+.L438:
+	addq	$1, %r12
+	leaq	1(%rbx), %rax
+	addq	$4, %r13
+	cmpq	$5000, %r12
+	je	.L419
+.L437:
+	movq	%rax, %rbx
+.L408:
+	cmpq	%r15, %r12
+	jne	.L434
+	leaq	5(%r12), %rsi
+	movq	(%rsp), %rdi
+	movl	$4, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$3, %rsi
+	movq	%rax, 16(%rsp)
+	movq	(%rdi), %rax
+.LEHB0:
+	call	*16(%rax)
+.LEHE0:
+	movl	$7, (%rax,%r13)
+	movq	%rax, %r14
+	testq	%r12, %r12
+	jne	.L532
+	testq	%rbp, %rbp
+	je	.L533
+.L436:
+	movq	(%rsp), %rdi
+	leaq	0(,%r15,4), %rdx
+	movl	$4, %ecx
+	movq	%rbp, %rsi
+	movq	(%rdi), %rax
+.LEHB1:
+	call	*24(%rax)
+.LEHE1:
+	movq	16(%rsp), %r15
+	movq	%r14, %rbp
+	jmp	.L438
+	.p2align 4,,10
+	.p2align 3
+.L481:
+	xorl	%r12d, %r12d
+	movl	$1, %ebx
+	xorl	%r13d, %r13d
+	xorl	%eax, %eax
+	xorl	%ebp, %ebp
+	jmp	.L409
+	.p2align 4,,10
+	.p2align 3
+.L427:
+	movl	%r14d, 0(%rbp,%r13)
+.L431:
+	addq	$1, %r12
+	leaq	1(%rbx), %rdx
+	addq	$4, %r13
+	cmpq	$5000, %r12
+	je	.L419
+	movl	%r12d, %eax
+	movq	%rdx, %rbx
+.L409:
+	movl	$5000, %r14d
+	subl	%eax, %r14d
+	cmpq	%r15, %r12
+	jne	.L427
+	leaq	5(%r12), %rsi
+	movq	(%rsp), %rdi
+	movl	$4, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$3, %rsi
+	movq	%rax, 16(%rsp)
+	movq	(%rdi), %rax
+.LEHB2:
+	call	*16(%rax)
+.LEHE2:
+	movq	%rax, 24(%rsp)
+	movl	%r14d, (%rax,%r13)
+	testq	%r12, %r12
+	jne	.L534
+	testq	%rbp, %rbp
+	je	.L535
+.L429:
+	movq	(%rsp), %rdi
+	leaq	0(,%r15,4), %rdx
+	movl	$4, %ecx
+	movq	%rbp, %rsi
+	movq	(%rdi), %rax
+.LEHB3:
+	call	*24(%rax)
+.LEHE3:
+	movq	16(%rsp), %r15
+	movq	24(%rsp), %rbp
+	jmp	.L431
+	.p2align 4,,10
+	.p2align 3
+.L480:
+	xorl	%r12d, %r12d
+	xorl	%r14d, %r14d
+	movl	$1, %ebx
+	xorl	%r13d, %r13d
+	xorl	%ebp, %ebp
+	jmp	.L410
+	.p2align 4,,10
+	.p2align 3
+.L420:
+	movl	%r14d, 0(%rbp,%r13)
+.L424:
+	addq	$1, %r12
+	leaq	1(%rbx), %rax
+	addq	$4, %r13
+	cmpq	$5000, %r12
+	je	.L419
+	movl	%r12d, %r14d
+	movq	%rax, %rbx
+.L410:
+	cmpq	%r15, %r12
+	jne	.L420
+	leaq	5(%r12), %rsi
+	movq	(%rsp), %rdi
+	movl	$4, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$3, %rsi
+	movq	%rax, 16(%rsp)
+	movq	(%rdi), %rax
+.LEHB4:
+	call	*16(%rax)
+.LEHE4:
+	movq	%rax, 24(%rsp)
+	movl	%r14d, (%rax,%r13)
+	testq	%r12, %r12
+	jne	.L536
+	testq	%rbp, %rbp
+	je	.L537
+.L422:
+	movq	(%rsp), %rdi
+	leaq	0(,%r15,4), %rdx
+	movl	$4, %ecx
+	movq	%rbp, %rsi
+	movq	(%rdi), %rax
+.LEHB5:
+	call	*24(%rax)
+.LEHE5:
+	movq	16(%rsp), %r15
+	movq	24(%rsp), %rbp
+	jmp	.L424
+	.p2align 4,,10
+	.p2align 3
+.L483:
+	xorl	%r12d, %r12d
+	xorl	%r13d, %r13d
+	movl	$1, %ebx
+	xorl	%r14d, %r14d
+	xorl	%eax, %eax
+	xorl	%ebp, %ebp
+	jmp	.L406
+	.p2align 4,,10
+	.p2align 3
+.L441:
+	movl	%r13d, 0(%rbp,%r14)
+.L445:
+	addq	$1, %r12
+	leaq	1(%rbx), %rdx
+	addq	$4, %r14
+	cmpq	$5000, %r12
+	je	.L419
+	movl	%r12d, %eax
+	movl	%r12d, %r13d
+	movq	%rdx, %rbx
+.L406:
+	movl	$5000, %edx
+	subl	%eax, %edx
+	cmpl	$2499, %r12d
+	cmovg	%edx, %r13d
+	cmpq	%r15, %r12
+	jne	.L441
+	leaq	5(%r12), %rsi
+	movq	(%rsp), %rdi
+	movl	$4, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$3, %rsi
+	movq	%rax, 16(%rsp)
+	movq	(%rdi), %rax
+.LEHB6:
+	call	*16(%rax)
+.LEHE6:
+	movq	%rax, 24(%rsp)
+	movl	%r13d, (%rax,%r14)
+	testq	%r12, %r12
+	jne	.L538
+	testq	%rbp, %rbp
+	je	.L539
+.L443:
+	movq	(%rsp), %rdi
+	leaq	0(,%r15,4), %rdx
+	movl	$4, %ecx
+	movq	%rbp, %rsi
+	movq	(%rdi), %rax
+.LEHB7:
+	call	*24(%rax)
+.LEHE7:
+	movq	16(%rsp), %r15
+	movq	24(%rsp), %rbp
+	jmp	.L445
+	.p2align 4,,10
+	.p2align 3
+.L479:
+	xorl	%r13d, %r13d
+	movl	$1, %ebx
+	xorl	%r14d, %r14d
+	xorl	%ebp, %ebp
+	jmp	.L411
+	.p2align 4,,10
+	.p2align 3
+.L412:
+	movl	%r12d, 0(%rbp,%r14)
+.L416:
+	addq	$1, %r13
+	leaq	1(%rbx), %rax
+	addq	$4, %r14
+	cmpq	$5000, %r13
+	je	.L419
+.L415:
+	movq	%rax, %rbx
+.L411:
+	movabsq	$6364136223846793005, %rax
+	imulq	seed(%rip), %rax
+	movabsq	$1442695040888963407, %rcx
+	movabsq	$755578637259143235, %rdi
+	addq	%rcx, %rax
+	movq	%rax, %r12
+	movq	%rax, seed(%rip)
+	shrq	$38, %rax
+	mulq	%rdi
+	shrq	$33, %r12
+	shrq	$7, %rdx
+	imulq	$100000, %rdx, %rdx
+	subq	%rdx, %r12
+	subl	$50000, %r12d
+	cmpq	%r15, %r13
+	jne	.L412
+	leaq	5(%r13), %rsi
+	movq	(%rsp), %rdi
+	movl	$4, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$3, %rsi
+	movq	%rax, 16(%rsp)
+	movq	(%rdi), %rax
+.LEHB8:
+	call	*16(%rax)
+.LEHE8:
+	movq	%rax, 24(%rsp)
+	movl	%r12d, (%rax,%r14)
+	testq	%r13, %r13
+	jne	.L540
+	testq	%rbp, %rbp
+	je	.L541
+.L414:
+	movq	(%rsp), %rdi
+	leaq	0(,%r15,4), %rdx
+	movl	$4, %ecx
+	movq	%rbp, %rsi
+	movq	(%rdi), %rax
+.LEHB9:
+	call	*24(%rax)
+.LEHE9:
+	movq	16(%rsp), %r15
+	movq	24(%rsp), %rbp
+	jmp	.L416
+	.p2align 4,,10
+	.p2align 3
+.L419:
+	testq	%rbx, %rbx
+	je	.L453
+	leaq	-1(%rbx), %r14
+	cmpq	$2, %r14
+	jbe	.L490
+	movq	%rbx, %rdx
+	pxor	%xmm0, %xmm0
+	pxor	%xmm4, %xmm4
+	movq	%rbp, %rax
+	shrq	$2, %rdx
+	salq	$4, %rdx
+	addq	%rbp, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L455:
+	movdqu	(%rax), %xmm2
+	movdqa	%xmm4, %xmm3
+	addq	$16, %rax
+	pcmpgtd	%xmm2, %xmm3
+	movdqa	%xmm2, %xmm1
+	punpckldq	%xmm3, %xmm1
+	punpckhdq	%xmm3, %xmm2
+	paddq	%xmm1, %xmm0
+	paddq	%xmm2, %xmm0
+	cmpq	%rdx, %rax
+	jne	.L455
+	movdqa	%xmm0, %xmm1
+	movq	%rbx, %rax
+	psrldq	$8, %xmm1
+	andq	$-4, %rax
+	paddq	%xmm1, %xmm0
+	movq	%xmm0, %r13
+	testb	$3, %bl
+	je	.L456
+.L454:
+	movslq	0(%rbp,%rax,4), %rcx
+	leaq	0(,%rax,4), %rdx
+	addq	%rcx, %r13
+	leaq	1(%rax), %rcx
+	cmpq	%rbx, %rcx
+	jnb	.L457
+	movslq	4(%rbp,%rdx), %rcx
+	addq	$2, %rax
+	addq	%rcx, %r13
+	cmpq	%rbx, %rax
+	jnb	.L456
+	movslq	8(%rbp,%rdx), %rax
+	addq	%rax, %r13
+.L456:
+	movq	%rbx, %r12
+	xorl	%edx, %edx
+	.p2align 4,,10
+	.p2align 3
+.L459:
+	shrq	%r12
+	addl	$1, %edx
+	cmpq	$1, %r12
+	jne	.L459
+	leaq	0(%rbp,%rbx,4), %rsi
+	movl	$1, %ecx
+	movq	%rbp, %rdi
+	call	_ZN1n9__pdqsortIiNS_4lessEEEvPT_S3_RT0_ib.isra.0
+	movl	0(%rbp), %eax
+	jmp	.L461
+	.p2align 4,,10
+	.p2align 3
+.L543:
+	addq	$1, %r12
+	cmpq	%rbx, %r12
+	je	.L542
+.L461:
+	movl	%eax, %edx
+	movl	0(%rbp,%r12,4), %eax
+	cmpl	%eax, %edx
+	jle	.L543
+	jmp	.L460
+	.p2align 4,,10
+	.p2align 3
+.L542:
+	cmpq	$2, %r14
+	jbe	.L544
+	movq	%rbx, %rdx
+	pxor	%xmm0, %xmm0
+	pxor	%xmm4, %xmm4
+	movq	%rbp, %rax
+	shrq	$2, %rdx
+	salq	$4, %rdx
+	addq	%rbp, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L466:
+	movdqu	(%rax), %xmm2
+	movdqa	%xmm4, %xmm3
+	addq	$16, %rax
+	pcmpgtd	%xmm2, %xmm3
+	movdqa	%xmm2, %xmm1
+	punpckldq	%xmm3, %xmm1
+	punpckhdq	%xmm3, %xmm2
+	paddq	%xmm1, %xmm0
+	paddq	%xmm2, %xmm0
+	cmpq	%rax, %rdx
+	jne	.L466
+	movdqa	%xmm0, %xmm1
+	movq	%rbx, %rdx
+	psrldq	$8, %xmm1
+	andq	$-4, %rdx
+	paddq	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	testb	$3, %bl
+	je	.L545
+.L464:
+	movslq	0(%rbp,%rdx,4), %rcx
+	leaq	0(,%rdx,4), %rsi
+	addq	%rcx, %rax
+	leaq	1(%rdx), %rcx
+	cmpq	%rbx, %rcx
+	jnb	.L546
+	movslq	4(%rbp,%rsi), %rcx
+	addq	$2, %rdx
+	addq	%rcx, %rax
+	cmpq	%rbx, %rdx
+	jnb	.L547
+	movslq	8(%rbp,%rsi), %rdx
+	addq	%rdx, %rax
+	cmpq	%rax, %r13
+	jne	.L463
+.L467:
+	movq	(%rsp), %rdi
+	leaq	0(,%r15,4), %rdx
+	movl	$4, %ecx
+	movq	%rbp, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	addl	$1, 12(%rsp)
+	movl	12(%rsp), %eax
+	cmpl	$6, %eax
+	jne	.L474
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L545:
+	.cfi_restore_state
+	cmpq	%rax, %r13
+	je	.L467
+	jmp	.L463
+	.p2align 4,,10
+	.p2align 3
+.L531:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L548
+.L403:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	%rax, (%rsp)
+	jmp	.L401
+.L457:
+	cmpq	$1, %rbx
+	jne	.L456
+	movslq	0(%rbp), %rax
+	cmpq	%rax, %r13
+	jne	.L549
+.L453:
+	testq	%rbp, %rbp
+	jne	.L467
+	addl	$1, 12(%rsp)
+	movl	12(%rsp), %eax
+	cmpl	$6, %eax
+	jne	.L474
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L544:
+	.cfi_restore_state
+	xorl	%eax, %eax
+	xorl	%edx, %edx
+	jmp	.L464
+.L532:
+	movq	%r13, %rdx
+	movq	%rbp, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L436
+.L540:
+	movq	%r14, %rdx
+	movq	%rbp, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L414
+.L536:
+	movq	%r13, %rdx
+	movq	%rbp, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L422
+.L534:
+	movq	%r13, %rdx
+	movq	%rbp, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L429
+.L538:
+	movq	%r14, %rdx
+	movq	%rbp, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L443
+.L490:
+	xorl	%r13d, %r13d
+	xorl	%eax, %eax
+	jmp	.L454
+.L546:
+	cmpq	%rax, %r13
+	je	.L467
+	jmp	.L463
+	.p2align 4,,10
+	.p2align 3
+.L547:
+	cmpq	%rax, %r13
+	je	.L467
+	jmp	.L463
+	.p2align 4,,10
+	.p2align 3
+.L548:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L403
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L403
+.L541:
+	movq	%rax, %rbp
+	movq	16(%rsp), %r15
+	leaq	1(%rbx), %rax
+	addq	$4, %r14
+	movl	$1, %r13d
+	jmp	.L415
+.L539:
+	movq	%rax, %rbp
+	movq	16(%rsp), %r15
+	addq	$1, %rbx
+	addq	$4, %r14
+	movl	$1, %r12d
+	movl	$1, %r13d
+	movl	$1, %eax
+	jmp	.L406
+.L537:
+	movq	16(%rsp), %r15
+	movq	%rax, %rbp
+	addq	$1, %rbx
+	addq	$4, %r13
+	movl	12(%rsp), %r14d
+	movl	$1, %r12d
+	jmp	.L410
+.L535:
+	movq	%rax, %rbp
+	movq	16(%rsp), %r15
+	addq	$1, %rbx
+	addq	$4, %r13
+	movl	$1, %r12d
+	movl	$1, %eax
+	jmp	.L409
+.L533:
+	movq	16(%rsp), %r15
+	leaq	1(%rbx), %rax
+	addq	$4, %r13
+	movq	%r14, %rbp
+	movl	$1, %r12d
+	jmp	.L437
+.L497:
+	movq	%rax, %rbx
+	jmp	.L446
+.L498:
+	movq	%rax, %rbx
+	jmp	.L439
+.L499:
+	movq	%rax, %rbx
+	jmp	.L446
+.L500:
+	movq	%rax, %rbx
+	jmp	.L446
+.L495:
+	movq	%rax, %rbx
+	jmp	.L446
+.L520:
+	jmp	.L521
+.L549:
+	jmp	.L463
+	.globl	__gxx_personality_v0
+	.section	.gcc_except_table,"a",@progbits
+.LLSDA6775:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6775-.LLSDACSB6775
+.LLSDACSB6775:
+	.uleb128 .LEHB0-.LFB6775
+	.uleb128 .LEHE0-.LEHB0
+	.uleb128 .L520-.LFB6775
+	.uleb128 0
+	.uleb128 .LEHB1-.LFB6775
+	.uleb128 .LEHE1-.LEHB1
+	.uleb128 .L498-.LFB6775
+	.uleb128 0
+	.uleb128 .LEHB2-.LFB6775
+	.uleb128 .LEHE2-.LEHB2
+	.uleb128 .L520-.LFB6775
+	.uleb128 0
+	.uleb128 .LEHB3-.LFB6775
+	.uleb128 .LEHE3-.LEHB3
+	.uleb128 .L497-.LFB6775
+	.uleb128 0
+	.uleb128 .LEHB4-.LFB6775
+	.uleb128 .LEHE4-.LEHB4
+	.uleb128 .L520-.LFB6775
+	.uleb128 0
+	.uleb128 .LEHB5-.LFB6775
+	.uleb128 .LEHE5-.LEHB5
+	.uleb128 .L495-.LFB6775
+	.uleb128 0
+	.uleb128 .LEHB6-.LFB6775
+	.uleb128 .LEHE6-.LEHB6
+	.uleb128 .L520-.LFB6775
+	.uleb128 0
+	.uleb128 .LEHB7-.LFB6775
+	.uleb128 .LEHE7-.LEHB7
+	.uleb128 .L500-.LFB6775
+	.uleb128 0
+	.uleb128 .LEHB8-.LFB6775
+	.uleb128 .LEHE8-.LEHB8
+	.uleb128 .L520-.LFB6775
+	.uleb128 0
+	.uleb128 .LEHB9-.LFB6775
+	.uleb128 .LEHE9-.LEHB9
+	.uleb128 .L499-.LFB6775
+	.uleb128 0
+.LLSDACSE6775:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6775
+	.type	_Z18test_sort_patternsv.cold, @function
+_Z18test_sort_patternsv.cold:
+.LFSB6775:
+.L446:
+	.cfi_def_cfa_offset 96
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	24(%rsp), %rbp
+.L418:
+	movq	16(%rsp), %r15
+	testq	%rbp, %rbp
+	je	.L476
+.L477:
+	movq	(%rsp), %rdi
+	leaq	0(,%r15,4), %rdx
+	movl	$4, %ecx
+	movq	%rbp, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L476:
+	movq	%rbx, %rdi
+.LEHB10:
+	call	_Unwind_Resume@PLT
+.LEHE10:
+.L439:
+	movq	%r14, %rbp
+	jmp	.L418
+.L460:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC0(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB11:
+	call	__cxa_throw@PLT
+.LEHE11:
+.L463:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC1(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB12:
+	call	__cxa_throw@PLT
+.LEHE12:
+.L493:
+	movq	%rax, %rbx
+	jmp	.L477
+.L496:
+	movq	%r15, 16(%rsp)
+	movq	%rax, %rbx
+	jmp	.L418
+.L478:
+	xorl	%r15d, %r15d
+	xorl	%r13d, %r13d
+	movl	$1, %ebx
+	xorl	%r14d, %r14d
+	xorl	%ebp, %ebp
+.L405:
+	movabsq	$6364136223846793005, %rax
+	imulq	seed(%rip), %rax
+	movabsq	$1442695040888963407, %rcx
+	addq	%rcx, %rax
+	movq	%rax, seed(%rip)
+	shrq	$33, %rax
+	andl	$3, %eax
+	movl	%eax, 24(%rsp)
+	cmpq	%r15, %r13
+	je	.L550
+	movl	24(%rsp), %eax
+	movl	%eax, 0(%rbp,%r14)
+.L452:
+	addq	$1, %r13
+	leaq	1(%rbx), %rax
+	addq	$4, %r14
+	cmpq	$5000, %r13
+	je	.L551
+.L451:
+	movq	%rax, %rbx
+	jmp	.L405
+.L492:
+.L521:
+	movq	%rax, %rbx
+	jmp	.L418
+.L550:
+	movq	(%rsp), %rdi
+	leaq	5(%r13), %rax
+	movl	$4, %edx
+	leaq	(%rax,%rax), %rcx
+	leaq	0(,%rax,8), %rsi
+	movq	(%rdi), %rax
+	movq	%rcx, 16(%rsp)
+.LEHB13:
+	call	*16(%rax)
+.LEHE13:
+	movq	%rax, %r12
+	movl	24(%rsp), %eax
+	movl	%eax, (%r12,%r14)
+	testq	%r13, %r13
+	jne	.L552
+	testq	%rbp, %rbp
+	jne	.L450
+	movq	16(%rsp), %r15
+	leaq	1(%rbx), %rax
+	addq	$4, %r14
+	movq	%r12, %rbp
+	movl	$1, %r13d
+	jmp	.L451
+.L551:
+	jmp	.L419
+.L552:
+	movq	%r14, %rdx
+	movq	%rbp, %rsi
+	movq	%r12, %rdi
+	call	memcpy@PLT
+.L450:
+	movq	(%rsp), %rdi
+	leaq	0(,%r15,4), %rdx
+	movl	$4, %ecx
+	movq	%rbp, %rsi
+	movq	(%rdi), %rax
+.LEHB14:
+	call	*24(%rax)
+.LEHE14:
+	movq	16(%rsp), %r15
+	movq	%r12, %rbp
+	jmp	.L452
+.L494:
+	movq	%rax, %rbx
+	movq	%r12, %rbp
+	jmp	.L418
+	.cfi_endproc
+.LFE6775:
+	.section	.gcc_except_table
+.LLSDAC6775:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6775-.LLSDACSBC6775
+.LLSDACSBC6775:
+	.uleb128 .LEHB10-.LCOLDB2
+	.uleb128 .LEHE10-.LEHB10
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB11-.LCOLDB2
+	.uleb128 .LEHE11-.LEHB11
+	.uleb128 .L493-.LCOLDB2
+	.uleb128 0
+	.uleb128 .LEHB12-.LCOLDB2
+	.uleb128 .LEHE12-.LEHB12
+	.uleb128 .L496-.LCOLDB2
+	.uleb128 0
+	.uleb128 .LEHB13-.LCOLDB2
+	.uleb128 .LEHE13-.LEHB13
+	.uleb128 .L492-.LCOLDB2
+	.uleb128 0
+	.uleb128 .LEHB14-.LCOLDB2
+	.uleb128 .LEHE14-.LEHB14
+	.uleb128 .L494-.LCOLDB2
+	.uleb128 0
+.LLSDACSEC6775:
+	.section	.text.unlikely
+	.text
+	.size	_Z18test_sort_patternsv, .-_Z18test_sort_patternsv
+	.section	.text.unlikely
+	.size	_Z18test_sort_patternsv.cold, .-_Z18test_sort_patternsv.cold
+.LCOLDE2:
+	.text
+.LHOTE2:
+	.section	.rodata.str1.1
+.LC3:
+	.string	"expected true : sorted(v, gt)"
+	.section	.text.unlikely
+.LCOLDB4:
+	.text
+.LHOTB4:
+	.p2align 4
+	.globl	_Z20test_sort_comparatorv
+	.type	_Z20test_sort_comparatorv, @function
+_Z20test_sort_comparatorv:
+.LFB6779:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6779
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r15
+	testq	%r15, %r15
+	je	.L590
+.L554:
+	xorl	%ebx, %ebx
+	xorl	%r12d, %r12d
+	xorl	%r13d, %r13d
+	movabsq	$6364136223846793005, %r14
+	jmp	.L564
+	.p2align 4,,10
+	.p2align 3
+.L558:
+	movl	%ebp, 0(%r13,%rbx,4)
+	addq	$1, %rbx
+	cmpq	$1000, %rbx
+	je	.L591
+.L564:
+	movq	seed(%rip), %rax
+	movabsq	$1442695040888963407, %rcx
+	movabsq	$2361183241434822607, %rdi
+	imulq	%r14, %rax
+	addq	%rcx, %rax
+	movq	%rax, %rbp
+	movq	%rax, seed(%rip)
+	shrq	$36, %rax
+	mulq	%rdi
+	shrq	$33, %rbp
+	shrq	$4, %rdx
+	imulq	$1000, %rdx, %rdx
+	subq	%rdx, %rbp
+	cmpq	%rbx, %r12
+	jne	.L558
+	leaq	5(%r12), %rsi
+	movl	$4, %edx
+	movq	%r15, %rdi
+	leaq	(%rsi,%rsi), %rax
+	salq	$3, %rsi
+	movq	%rax, 8(%rsp)
+	movq	(%r15), %rax
+.LEHB15:
+	call	*16(%rax)
+.LEHE15:
+	movq	%rax, (%rsp)
+	leaq	0(,%rbx,4), %rdx
+	movl	%ebp, (%rax,%rbx,4)
+	testq	%rbx, %rbx
+	jne	.L592
+	testq	%r13, %r13
+	je	.L572
+.L560:
+	movq	(%r15), %rax
+	movl	$4, %ecx
+	movq	%r13, %rsi
+	movq	%r15, %rdi
+	leaq	0(,%r12,4), %rdx
+.LEHB16:
+	call	*24(%rax)
+.LEHE16:
+	addq	$1, %rbx
+	movq	8(%rsp), %r12
+	movq	(%rsp), %r13
+	cmpq	$1000, %rbx
+	jne	.L564
+.L591:
+	xorl	%edx, %edx
+	.p2align 4,,10
+	.p2align 3
+.L563:
+	shrq	%rbx
+	addl	$1, %edx
+	cmpq	$1, %rbx
+	jne	.L563
+	leaq	4000(%r13), %rsi
+	movl	$1, %ecx
+	movq	%r13, %rdi
+	call	_ZN1n9__pdqsortIiZ20test_sort_comparatorvEUliiE_EEvPT_S3_RT0_ib.isra.0
+	movl	0(%r13), %eax
+	jmp	.L566
+	.p2align 4,,10
+	.p2align 3
+.L594:
+	addq	$1, %rbx
+	cmpq	$1000, %rbx
+	je	.L593
+.L566:
+	movl	%eax, %edx
+	movl	0(%r13,%rbx,4), %eax
+	cmpl	%edx, %eax
+	jle	.L594
+	jmp	.L565
+	.p2align 4,,10
+	.p2align 3
+.L592:
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L560
+	.p2align 4,,10
+	.p2align 3
+.L572:
+	movq	8(%rsp), %r12
+	movq	%rax, %r13
+	movl	$1, %ebx
+	jmp	.L564
+.L593:
+	movq	(%r15), %rax
+	movq	%r13, %rsi
+	movq	%r15, %rdi
+	movl	$4, %ecx
+	leaq	0(,%r12,4), %rdx
+	call	*24(%rax)
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L590:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L595
+.L556:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	jmp	.L554
+.L595:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L556
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L556
+.L577:
+	movq	%rax, %rbx
+	jmp	.L568
+.L576:
+	movq	%rax, %rbx
+	jmp	.L569
+	.section	.gcc_except_table
+.LLSDA6779:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6779-.LLSDACSB6779
+.LLSDACSB6779:
+	.uleb128 .LEHB15-.LFB6779
+	.uleb128 .LEHE15-.LEHB15
+	.uleb128 .L576-.LFB6779
+	.uleb128 0
+	.uleb128 .LEHB16-.LFB6779
+	.uleb128 .LEHE16-.LEHB16
+	.uleb128 .L577-.LFB6779
+	.uleb128 0
+.LLSDACSE6779:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6779
+	.type	_Z20test_sort_comparatorv.cold, @function
+_Z20test_sort_comparatorv.cold:
+.LFSB6779:
+.L565:
+	.cfi_def_cfa_offset 80
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC3(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB17:
+	call	__cxa_throw@PLT
+.LEHE17:
+.L575:
+	movq	%rax, %rbx
+.L571:
+	movq	(%r15), %rax
+	movl	$4, %ecx
+	movq	%r13, %rsi
+	movq	%r15, %rdi
+	leaq	0(,%r12,4), %rdx
+	call	*24(%rax)
+.L570:
+	movq	%rbx, %rdi
+.LEHB18:
+	call	_Unwind_Resume@PLT
+.LEHE18:
+.L568:
+	movq	(%rsp), %r13
+.L569:
+	movq	8(%rsp), %r12
+	testq	%r13, %r13
+	je	.L570
+	jmp	.L571
+	.cfi_endproc
+.LFE6779:
+	.section	.gcc_except_table
+.LLSDAC6779:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6779-.LLSDACSBC6779
+.LLSDACSBC6779:
+	.uleb128 .LEHB17-.LCOLDB4
+	.uleb128 .LEHE17-.LEHB17
+	.uleb128 .L575-.LCOLDB4
+	.uleb128 0
+	.uleb128 .LEHB18-.LCOLDB4
+	.uleb128 .LEHE18-.LEHB18
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6779:
+	.section	.text.unlikely
+	.text
+	.size	_Z20test_sort_comparatorv, .-_Z20test_sort_comparatorv
+	.section	.text.unlikely
+	.size	_Z20test_sort_comparatorv.cold, .-_Z20test_sort_comparatorv.cold
+.LCOLDE4:
+	.text
+.LHOTE4:
+	.section	.rodata.str1.1
+.LC5:
+	.string	"expected true : stable"
+	.section	.text.unlikely
+.LCOLDB6:
+	.text
+.LHOTB6:
+	.p2align 4
+	.globl	_Z32test_radix_sort_by_key_is_stablev
+	.type	_Z32test_radix_sort_by_key_is_stablev, @function
+_Z32test_radix_sort_by_key_is_stablev:
+.LFB6804:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6804
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r15
+	testq	%r15, %r15
+	je	.L642
+.L597:
+	xorl	%ebx, %ebx
+	xorl	%r12d, %r12d
+	xorl	%r13d, %r13d
+	jmp	.L610
+	.p2align 4,,10
+	.p2align 3
+.L601:
+	leaq	0(%r13,%rbx,8), %rax
+	movl	%ebx, 4(%rax)
+	addq	$1, %rbx
+	movl	%ebp, (%rax)
+	cmpq	$3000, %rbx
+	je	.L643
+.L610:
+	movabsq	$6364136223846793005, %rax
+	imulq	seed(%rip), %rax
+	movabsq	$1442695040888963407, %rcx
+	movabsq	$-6640827866535438581, %rdi
+	addq	%rcx, %rax
+	movq	%rax, %rbp
+	movq	%rax, seed(%rip)
+	shrq	$34, %rax
+	mulq	%rdi
+	shrq	$33, %rbp
+	shrq	$4, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	leaq	(%rax,%rax,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rbp
+	subl	$25, %ebp
+	cmpq	%r12, %rbx
+	jne	.L601
+	leaq	5(%rbx), %rsi
+	movl	$4, %edx
+	movq	%r15, %rdi
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 8(%rsp)
+	movq	(%r15), %rax
+.LEHB19:
+	call	*16(%rax)
+.LEHE19:
+	leaq	0(,%rbx,8), %rdx
+	movq	%rax, (%rsp)
+	addq	%rdx, %rax
+	movl	%ebp, (%rax)
+	movl	%ebx, 4(%rax)
+	testq	%rbx, %rbx
+	jne	.L644
+	testq	%r13, %r13
+	je	.L617
+.L606:
+	movq	(%r15), %rax
+	movl	$4, %ecx
+	movq	%r13, %rsi
+	movq	%r15, %rdi
+	leaq	0(,%r12,8), %rdx
+.LEHB20:
+	call	*24(%rax)
+.LEHE20:
+	addq	$1, %rbx
+	movq	8(%rsp), %r12
+	movq	(%rsp), %r13
+	cmpq	$3000, %rbx
+	jne	.L610
+.L643:
+	movq	(%r15), %rax
+	movl	$4, %edx
+	movl	$24000, %esi
+	movq	%r15, %rdi
+.LEHB21:
+	call	*16(%rax)
+	movq	%rax, %rdx
+	movl	$3000, %esi
+	movq	%r13, %rdi
+	movq	%rax, %rbx
+	call	_ZN1n10__lsd_sortI5keyedZ32test_radix_sort_by_key_is_stablevEUlRKS1_E_EEvPT_mS6_RT0_.constprop.0
+	movq	(%r15), %rax
+	movl	$4, %ecx
+	movq	%rbx, %rsi
+	movl	$24000, %edx
+	movq	%r15, %rdi
+	call	*24(%rax)
+.LEHE21:
+	movl	$1, %eax
+	movl	$1, %edx
+	.p2align 4,,10
+	.p2align 3
+.L612:
+	testb	%dl, %dl
+	je	.L611
+	movl	0(%r13,%rax,8), %esi
+	cmpl	%esi, -8(%r13,%rax,8)
+	jl	.L611
+	movl	$0, %edx
+	jne	.L611
+	movl	4(%r13,%rax,8), %esi
+	cmpl	%esi, -4(%r13,%rax,8)
+	setl	%dl
+	.p2align 4,,10
+	.p2align 3
+.L611:
+	addq	$1, %rax
+	cmpq	$3000, %rax
+	jne	.L612
+	testb	%dl, %dl
+	je	.L638
+	testq	%r13, %r13
+	je	.L596
+	movq	(%r15), %rax
+	movl	$4, %ecx
+	movq	%r13, %rsi
+	movq	%r15, %rdi
+	leaq	0(,%r12,8), %rdx
+	call	*24(%rax)
+.L596:
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L644:
+	.cfi_restore_state
+	movq	(%rsp), %rdi
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L606
+	.p2align 4,,10
+	.p2align 3
+.L617:
+	movq	(%rsp), %r13
+	movq	8(%rsp), %r12
+	movl	$1, %ebx
+	jmp	.L610
+.L642:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L645
+.L599:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	jmp	.L597
+.L645:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L599
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L599
+.L636:
+	jmp	.L637
+.L621:
+	movq	%rax, %rbx
+	jmp	.L615
+.L622:
+	movq	%rax, %rbx
+	jmp	.L603
+	.section	.gcc_except_table
+.LLSDA6804:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6804-.LLSDACSB6804
+.LLSDACSB6804:
+	.uleb128 .LEHB19-.LFB6804
+	.uleb128 .LEHE19-.LEHB19
+	.uleb128 .L622-.LFB6804
+	.uleb128 0
+	.uleb128 .LEHB20-.LFB6804
+	.uleb128 .LEHE20-.LEHB20
+	.uleb128 .L621-.LFB6804
+	.uleb128 0
+	.uleb128 .LEHB21-.LFB6804
+	.uleb128 .LEHE21-.LEHB21
+	.uleb128 .L636-.LFB6804
+	.uleb128 0
+.LLSDACSE6804:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6804
+	.type	_Z32test_radix_sort_by_key_is_stablev.cold, @function
+_Z32test_radix_sort_by_key_is_stablev.cold:
+.LFSB6804:
+.L638:
+	.cfi_def_cfa_offset 80
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC5(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB22:
+	call	__cxa_throw@PLT
+.LEHE22:
+.L620:
+.L637:
+	movq	%rax, %rbx
+.L604:
+	testq	%r13, %r13
+	je	.L616
+	movq	(%r15), %rax
+	movl	$4, %ecx
+	movq	%r13, %rsi
+	movq	%r15, %rdi
+	leaq	0(,%r12,8), %rdx
+	call	*24(%rax)
+.L616:
+	movq	%rbx, %rdi
+.LEHB23:
+	call	_Unwind_Resume@PLT
+.LEHE23:
+.L615:
+	movq	8(%rsp), %r12
+	movq	(%rsp), %r13
+	jmp	.L604
+.L603:
+	movq	8(%rsp), %r12
+	jmp	.L604
+	.cfi_endproc
+.LFE6804:
+	.section	.gcc_except_table
+.LLSDAC6804:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6804-.LLSDACSBC6804
+.LLSDACSBC6804:
+	.uleb128 .LEHB22-.LCOLDB6
+	.uleb128 .LEHE22-.LEHB22
+	.uleb128 .L620-.LCOLDB6
+	.uleb128 0
+	.uleb128 .LEHB23-.LCOLDB6
+	.uleb128 .LEHE23-.LEHB23
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6804:
+	.section	.text.unlikely
+	.text
+	.size	_Z32test_radix_sort_by_key_is_stablev, .-_Z32test_radix_sort_by_key_is_stablev
+	.section	.text.unlikely
+	.size	_Z32test_radix_sort_by_key_is_stablev.cold, .-_Z32test_radix_sort_by_key_is_stablev.cold
+.LCOLDE6:
+	.text
+.LHOTE6:
+	.p2align 4
+	.type	_ZN1n12__merge_sortI5keyedZ16test_stable_sortvEUlRKS1_S3_E_EEvPT_mS6_RT0_.isra.0, @function
+_ZN1n12__merge_sortI5keyedZ16test_stable_sortvEUlRKS1_S3_E_EEvPT_mS6_RT0_.isra.0:
+.LFB7144:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rsi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	cmpq	$16, %rsi
+	jbe	.L778
+	movq	%rsi, %r12
+	movq	%rdx, %rbp
+	shrq	%r12
+	leaq	0(,%r12,8), %rax
+	movq	%rax, 8(%rsp)
+	leaq	(%rdi,%rax), %r13
+	cmpq	$16, %r12
+	jbe	.L779
+	movq	%rsi, %r15
+	shrq	$2, %r15
+	leaq	0(,%r15,8), %r11
+	leaq	(%rdi,%r11), %rcx
+	cmpq	$16, %r15
+	jbe	.L780
+	movq	%rsi, %r9
+	movq	%rcx, 40(%rsp)
+	shrq	$3, %r9
+	movq	%r11, 32(%rsp)
+	movq	%r9, %rsi
+	movq	%r9, 16(%rsp)
+	call	_ZN1n12__merge_sortI5keyedZ16test_stable_sortvEUlRKS1_S3_E_EEvPT_mS6_RT0_.isra.0
+	movq	16(%rsp), %r9
+	movq	%r15, %rsi
+	movq	%rbp, %rdx
+	leaq	0(,%r9,8), %rax
+	subq	%r9, %rsi
+	movq	%r9, 48(%rsp)
+	leaq	(%rbx,%rax), %rdi
+	movq	%rax, 24(%rsp)
+	movq	%rdi, 16(%rsp)
+	call	_ZN1n12__merge_sortI5keyedZ16test_stable_sortvEUlRKS1_S3_E_EEvPT_mS6_RT0_.isra.0
+	movq	24(%rsp), %rax
+	movq	16(%rsp), %rdi
+	movq	32(%rsp), %r11
+	movq	40(%rsp), %rcx
+	movl	-8(%rbx,%rax), %eax
+	cmpl	%eax, (%rdi)
+	jge	.L669
+	movq	48(%rsp), %r9
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L670:
+	movq	(%rbx,%rax,8), %rdx
+	movq	%rdx, 0(%rbp,%rax,8)
+	addq	$1, %rax
+	cmpq	%rax, %r9
+	jne	.L670
+	cmpq	%r15, %r9
+	jnb	.L717
+	movq	%r9, %rsi
+	xorl	%edx, %edx
+	xorl	%eax, %eax
+	jmp	.L674
+	.p2align 4,,10
+	.p2align 3
+.L782:
+	movq	(%r8), %rdi
+	addq	$1, %rsi
+	movq	%rdi, -8(%rbx,%rdx,8)
+.L673:
+	cmpq	%r9, %rax
+	jnb	.L669
+	cmpq	%r15, %rsi
+	jnb	.L781
+.L674:
+	leaq	0(%rbp,%rax,8), %rdi
+	leaq	(%rbx,%rsi,8), %r8
+	addq	$1, %rdx
+	movl	(%rdi), %r10d
+	cmpl	%r10d, (%r8)
+	jl	.L782
+	movq	(%rdi), %rdi
+	addq	$1, %rax
+	movq	%rdi, -8(%rbx,%rdx,8)
+	jmp	.L673
+	.p2align 4,,10
+	.p2align 3
+.L779:
+	leaq	8(%rdi), %rdx
+	cmpq	%r13, %rdx
+	jb	.L655
+	.p2align 4,,10
+	.p2align 3
+.L661:
+	movq	%r14, %r9
+	subq	%r12, %r9
+	cmpq	$16, %r9
+	jbe	.L783
+	movq	%r9, %r15
+	movq	%rbp, %rdx
+	movq	%r13, %rdi
+	movq	%r9, 16(%rsp)
+	shrq	%r15
+	movq	%r15, %rsi
+	call	_ZN1n12__merge_sortI5keyedZ16test_stable_sortvEUlRKS1_S3_E_EEvPT_mS6_RT0_.isra.0
+	movq	16(%rsp), %r9
+	leaq	0(,%r15,8), %rax
+	movq	%rbp, %rdx
+	leaq	0(%r13,%rax), %rcx
+	movq	%rax, 24(%rsp)
+	movq	%r9, %rsi
+	movq	%rcx, %rdi
+	movq	%rcx, 16(%rsp)
+	subq	%r15, %rsi
+	movq	%r9, 32(%rsp)
+	call	_ZN1n12__merge_sortI5keyedZ16test_stable_sortvEUlRKS1_S3_E_EEvPT_mS6_RT0_.isra.0
+	movq	24(%rsp), %rax
+	movq	16(%rsp), %rcx
+	movl	-8(%r13,%rax), %eax
+	cmpl	%eax, (%rcx)
+	jge	.L699
+	movq	32(%rsp), %r9
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L704:
+	movq	0(%r13,%rax,8), %rdx
+	movq	%rdx, 0(%rbp,%rax,8)
+	addq	$1, %rax
+	cmpq	%rax, %r15
+	jne	.L704
+	cmpq	%r9, %r15
+	jnb	.L720
+	movq	%r15, %rcx
+	xorl	%edx, %edx
+	xorl	%eax, %eax
+	jmp	.L708
+	.p2align 4,,10
+	.p2align 3
+.L785:
+	movq	(%rdi), %rsi
+	addq	$1, %rcx
+	movq	%rsi, -8(%r13,%rdx,8)
+	cmpq	%r15, %rax
+	jnb	.L699
+.L786:
+	cmpq	%r9, %rcx
+	jnb	.L784
+.L708:
+	leaq	0(%rbp,%rax,8), %rsi
+	leaq	0(%r13,%rcx,8), %rdi
+	addq	$1, %rdx
+	movl	(%rsi), %r8d
+	cmpl	%r8d, (%rdi)
+	jl	.L785
+	movq	(%rsi), %rsi
+	addq	$1, %rax
+	movq	%rsi, -8(%r13,%rdx,8)
+	cmpq	%r15, %rax
+	jb	.L786
+	.p2align 4,,10
+	.p2align 3
+.L699:
+	movq	8(%rsp), %rax
+	movl	-8(%rbx,%rax), %eax
+	cmpl	%eax, 0(%r13)
+	jge	.L646
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L698:
+	movq	(%rbx,%rax,8), %rdx
+	movq	%rdx, 0(%rbp,%rax,8)
+	addq	$1, %rax
+	cmpq	%rax, %r12
+	jne	.L698
+	cmpq	%r14, %r12
+	jnb	.L721
+	movq	%r12, %rcx
+	xorl	%edx, %edx
+	xorl	%eax, %eax
+	jmp	.L714
+	.p2align 4,,10
+	.p2align 3
+.L788:
+	movq	(%rdi), %rsi
+	addq	$1, %rcx
+	movq	%rsi, -8(%rbx,%rdx,8)
+	cmpq	%r12, %rax
+	jnb	.L646
+.L789:
+	cmpq	%r14, %rcx
+	jnb	.L787
+.L714:
+	leaq	0(%rbp,%rax,8), %rsi
+	leaq	(%rbx,%rcx,8), %rdi
+	addq	$1, %rdx
+	movl	(%rsi), %r10d
+	cmpl	%r10d, (%rdi)
+	jl	.L788
+	movq	(%rsi), %rsi
+	addq	$1, %rax
+	movq	%rsi, -8(%rbx,%rdx,8)
+	cmpq	%r12, %rax
+	jb	.L789
+.L646:
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L790:
+	.cfi_restore_state
+	movd	4(%rdx), %xmm2
+	movd	%esi, %xmm0
+	movq	%rdx, %rax
+	punpckldq	%xmm2, %xmm0
+.L660:
+	movq	-8(%rax), %rcx
+	subq	$8, %rax
+	movq	%rcx, 8(%rax)
+	cmpq	%rax, %rbx
+	je	.L659
+	cmpl	-8(%rax), %esi
+	jl	.L660
+.L659:
+	movq	%xmm0, (%rax)
+.L658:
+	addq	$8, %rdx
+	cmpq	%r13, %rdx
+	jnb	.L661
+.L655:
+	movl	(%rdx), %esi
+	cmpl	-8(%rdx), %esi
+	jge	.L658
+	jmp	.L790
+	.p2align 4,,10
+	.p2align 3
+.L781:
+	cmpq	%r9, %rax
+	jnb	.L669
+.L671:
+	subq	%rax, %rdx
+	leaq	(%rbx,%rdx,8), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L676:
+	addq	$1, %rax
+	movq	-8(%rbp,%rax,8), %rdx
+	movq	%rdx, -8(%rsi,%rax,8)
+	cmpq	%r9, %rax
+	jb	.L676
+.L669:
+	movq	%r12, %r10
+	subq	%r15, %r10
+	cmpq	$16, %r10
+	jbe	.L791
+	movq	%r10, %r9
+	movq	%rcx, %rdi
+	movq	%rbp, %rdx
+	movq	%r11, 48(%rsp)
+	shrq	%r9
+	movq	%r10, 40(%rsp)
+	movq	%r9, %rsi
+	movq	%r9, 24(%rsp)
+	movq	%rcx, 16(%rsp)
+	call	_ZN1n12__merge_sortI5keyedZ16test_stable_sortvEUlRKS1_S3_E_EEvPT_mS6_RT0_.isra.0
+	movq	24(%rsp), %r9
+	movq	40(%rsp), %r10
+	movq	%rbp, %rdx
+	movq	16(%rsp), %rcx
+	leaq	0(,%r9,8), %rax
+	movq	%r10, %rsi
+	movq	%r10, 56(%rsp)
+	leaq	(%rcx,%rax), %rdi
+	subq	%r9, %rsi
+	movq	%rax, 32(%rsp)
+	movq	%rcx, 24(%rsp)
+	movq	%rdi, 16(%rsp)
+	movq	%r9, 40(%rsp)
+	call	_ZN1n12__merge_sortI5keyedZ16test_stable_sortvEUlRKS1_S3_E_EEvPT_mS6_RT0_.isra.0
+	movq	24(%rsp), %rcx
+	movq	32(%rsp), %rax
+	movq	16(%rsp), %rdi
+	movq	48(%rsp), %r11
+	movl	-8(%rcx,%rax), %eax
+	cmpl	%eax, (%rdi)
+	jge	.L679
+	movq	56(%rsp), %r10
+	movq	40(%rsp), %r9
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L684:
+	movq	(%rcx,%rax,8), %rdx
+	movq	%rdx, 0(%rbp,%rax,8)
+	addq	$1, %rax
+	cmpq	%rax, %r9
+	jne	.L684
+	cmpq	%r10, %r9
+	jnb	.L718
+	movq	%r11, 16(%rsp)
+	movq	%r9, %rsi
+	xorl	%edx, %edx
+	xorl	%eax, %eax
+	jmp	.L688
+	.p2align 4,,10
+	.p2align 3
+.L793:
+	movq	(%r8), %rdi
+	addq	$1, %rsi
+	movq	%rdi, -8(%rcx,%rdx,8)
+.L687:
+	cmpq	%r9, %rax
+	jnb	.L774
+	cmpq	%r10, %rsi
+	jnb	.L792
+.L688:
+	leaq	0(%rbp,%rax,8), %rdi
+	leaq	(%rcx,%rsi,8), %r8
+	addq	$1, %rdx
+	movl	(%rdi), %r11d
+	cmpl	%r11d, (%r8)
+	jl	.L793
+	movq	(%rdi), %rdi
+	addq	$1, %rax
+	movq	%rdi, -8(%rcx,%rdx,8)
+	jmp	.L687
+	.p2align 4,,10
+	.p2align 3
+.L792:
+	movq	16(%rsp), %r11
+	cmpq	%r9, %rax
+	jnb	.L679
+.L685:
+	subq	%rax, %rdx
+	leaq	(%rcx,%rdx,8), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L690:
+	addq	$1, %rax
+	movq	-8(%rbp,%rax,8), %rdx
+	movq	%rdx, -8(%rsi,%rax,8)
+	cmpq	%r9, %rax
+	jb	.L690
+.L679:
+	movl	-8(%rbx,%r11), %eax
+	cmpl	%eax, (%rcx)
+	jge	.L661
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L678:
+	movq	(%rbx,%rax,8), %rdx
+	movq	%rdx, 0(%rbp,%rax,8)
+	addq	$1, %rax
+	cmpq	%rax, %r15
+	jne	.L678
+	cmpq	%r12, %r15
+	jnb	.L719
+	movq	%r15, %rcx
+	xorl	%edx, %edx
+	xorl	%eax, %eax
+	jmp	.L694
+	.p2align 4,,10
+	.p2align 3
+.L795:
+	movq	(%rdi), %rsi
+	addq	$1, %rcx
+	movq	%rsi, -8(%rbx,%rdx,8)
+.L693:
+	cmpq	%r15, %rax
+	jnb	.L661
+	cmpq	%r12, %rcx
+	jnb	.L794
+.L694:
+	leaq	0(%rbp,%rax,8), %rsi
+	leaq	(%rbx,%rcx,8), %rdi
+	addq	$1, %rdx
+	movl	(%rsi), %r11d
+	cmpl	%r11d, (%rdi)
+	jl	.L795
+	movq	(%rsi), %rsi
+	addq	$1, %rax
+	movq	%rsi, -8(%rbx,%rdx,8)
+	jmp	.L693
+	.p2align 4,,10
+	.p2align 3
+.L778:
+	leaq	(%rdi,%rsi,8), %rdi
+	cmpq	%rdi, %rbx
+	je	.L646
+	leaq	8(%rbx), %rdx
+	cmpq	%rdi, %rdx
+	jb	.L653
+	jmp	.L646
+	.p2align 4,,10
+	.p2align 3
+.L650:
+	addq	$8, %rdx
+	cmpq	%rdi, %rdx
+	jnb	.L646
+.L653:
+	movl	(%rdx), %esi
+	cmpl	-8(%rdx), %esi
+	jge	.L650
+	movd	4(%rdx), %xmm1
+	movd	%esi, %xmm0
+	movq	%rdx, %rax
+	punpckldq	%xmm1, %xmm0
+.L652:
+	movq	-8(%rax), %rcx
+	subq	$8, %rax
+	movq	%rcx, 8(%rax)
+	cmpq	%rax, %rbx
+	je	.L651
+	cmpl	-8(%rax), %esi
+	jl	.L652
+.L651:
+	movq	%xmm0, (%rax)
+	jmp	.L650
+	.p2align 4,,10
+	.p2align 3
+.L783:
+	leaq	0(%r13,%r9,8), %rdi
+	cmpq	%r13, %rdi
+	je	.L699
+	leaq	8(%r13), %rdx
+	cmpq	%rdi, %rdx
+	jb	.L703
+	jmp	.L699
+	.p2align 4,,10
+	.p2align 3
+.L700:
+	addq	$8, %rdx
+	cmpq	%rdi, %rdx
+	jnb	.L699
+.L703:
+	movl	(%rdx), %esi
+	cmpl	-8(%rdx), %esi
+	jge	.L700
+	movd	4(%rdx), %xmm3
+	movd	%esi, %xmm0
+	movq	%rdx, %rax
+	punpckldq	%xmm3, %xmm0
+.L702:
+	movq	-8(%rax), %rcx
+	subq	$8, %rax
+	movq	%rcx, 8(%rax)
+	cmpq	%r13, %rax
+	je	.L701
+	cmpl	-8(%rax), %esi
+	jl	.L702
+.L701:
+	movq	%xmm0, (%rax)
+	jmp	.L700
+	.p2align 4,,10
+	.p2align 3
+.L787:
+	cmpq	%r12, %rax
+	jnb	.L646
+.L711:
+	subq	%rax, %rdx
+	leaq	(%rbx,%rdx,8), %rcx
+	.p2align 4,,10
+	.p2align 3
+.L716:
+	addq	$1, %rax
+	movq	-8(%rbp,%rax,8), %rdx
+	movq	%rdx, -8(%rcx,%rax,8)
+	cmpq	%r12, %rax
+	jb	.L716
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L791:
+	.cfi_restore_state
+	cmpq	%r13, %rcx
+	je	.L679
+	leaq	8(%rcx), %rdx
+	cmpq	%r13, %rdx
+	jb	.L683
+	jmp	.L679
+	.p2align 4,,10
+	.p2align 3
+.L680:
+	addq	$8, %rdx
+	cmpq	%r13, %rdx
+	jnb	.L679
+.L683:
+	movl	(%rdx), %edi
+	cmpl	-8(%rdx), %edi
+	jge	.L680
+	movd	4(%rdx), %xmm5
+	movd	%edi, %xmm0
+	movq	%rdx, %rax
+	punpckldq	%xmm5, %xmm0
+.L682:
+	movq	-8(%rax), %rsi
+	subq	$8, %rax
+	movq	%rsi, 8(%rax)
+	cmpq	%rcx, %rax
+	je	.L681
+	cmpl	-8(%rax), %edi
+	jl	.L682
+.L681:
+	movq	%xmm0, (%rax)
+	jmp	.L680
+	.p2align 4,,10
+	.p2align 3
+.L780:
+	leaq	8(%rdi), %rdx
+	cmpq	%rcx, %rdx
+	jb	.L663
+	jmp	.L669
+	.p2align 4,,10
+	.p2align 3
+.L666:
+	addq	$8, %rdx
+	cmpq	%rcx, %rdx
+	jnb	.L669
+.L663:
+	movl	(%rdx), %edi
+	cmpl	-8(%rdx), %edi
+	jge	.L666
+	movd	4(%rdx), %xmm4
+	movd	%edi, %xmm0
+	movq	%rdx, %rax
+	punpckldq	%xmm4, %xmm0
+.L668:
+	movq	-8(%rax), %rsi
+	subq	$8, %rax
+	movq	%rsi, 8(%rax)
+	cmpq	%rax, %rbx
+	je	.L667
+	cmpl	-8(%rax), %edi
+	jl	.L668
+.L667:
+	movq	%xmm0, (%rax)
+	jmp	.L666
+	.p2align 4,,10
+	.p2align 3
+.L784:
+	cmpq	%r15, %rax
+	jnb	.L699
+.L705:
+	subq	%rax, %rdx
+	leaq	0(%r13,%rdx,8), %rcx
+	.p2align 4,,10
+	.p2align 3
+.L710:
+	addq	$1, %rax
+	movq	-8(%rbp,%rax,8), %rdx
+	movq	%rdx, -8(%rcx,%rax,8)
+	cmpq	%r15, %rax
+	jb	.L710
+	jmp	.L699
+	.p2align 4,,10
+	.p2align 3
+.L794:
+	cmpq	%r15, %rax
+	jnb	.L661
+.L691:
+	subq	%rax, %rdx
+	leaq	(%rbx,%rdx,8), %rcx
+	.p2align 4,,10
+	.p2align 3
+.L696:
+	addq	$1, %rax
+	movq	-8(%rbp,%rax,8), %rdx
+	movq	%rdx, -8(%rcx,%rax,8)
+	cmpq	%r15, %rax
+	jb	.L696
+	jmp	.L661
+	.p2align 4,,10
+	.p2align 3
+.L774:
+	movq	16(%rsp), %r11
+	jmp	.L679
+.L721:
+	xorl	%eax, %eax
+	xorl	%edx, %edx
+	jmp	.L711
+.L719:
+	xorl	%eax, %eax
+	xorl	%edx, %edx
+	jmp	.L691
+.L720:
+	xorl	%edx, %edx
+	xorl	%eax, %eax
+	jmp	.L705
+.L717:
+	xorl	%eax, %eax
+	xorl	%edx, %edx
+	jmp	.L671
+.L718:
+	xorl	%edx, %edx
+	xorl	%eax, %eax
+	jmp	.L685
+	.cfi_endproc
+.LFE7144:
+	.size	_ZN1n12__merge_sortI5keyedZ16test_stable_sortvEUlRKS1_S3_E_EEvPT_mS6_RT0_.isra.0, .-_ZN1n12__merge_sortI5keyedZ16test_stable_sortvEUlRKS1_S3_E_EEvPT_mS6_RT0_.isra.0
+	.section	.rodata.str1.1
+.LC7:
+	.string	"expected true : sorted(i32)"
+	.section	.rodata.str1.8
+	.align 8
+.LC8:
+	.string	"expected equal : expected value : checksum(i32), actual value : sum"
+	.section	.rodata.str1.1
+.LC9:
+	.string	"expected true : sorted(u64)"
+.LC10:
+	.string	"expected true : sorted(i16)"
+	.section	.text.unlikely
+.LCOLDB11:
+	.text
+.LHOTB11:
+	.p2align 4
+	.globl	_Z24test_radix_sort_integersv
+	.type	_Z24test_radix_sort_integersv, @function
+_Z24test_radix_sort_integersv:
+.LFB6797:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6797
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$88, %rsp
+	.cfi_def_cfa_offset 144
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, 48(%rsp)
+	movq	%rax, 56(%rsp)
+	testq	%rax, %rax
+	je	.L895
+.L797:
+	movq	48(%rsp), %rax
+	movq	%rax, 64(%rsp)
+.L804:
+	movq	$0, 24(%rsp)
+	xorl	%ebp, %ebp
+	movabsq	$6364136223846793005, %r12
+	movabsq	$1442695040888963407, %r13
+	movq	$0, 8(%rsp)
+	movq	$0, 40(%rsp)
+	movq	$0, 32(%rsp)
+	movq	$0, 16(%rsp)
+	movq	$0, (%rsp)
+	jmp	.L831
+	.p2align 4,,10
+	.p2align 3
+.L824:
+	movq	8(%rsp), %rax
+	movw	%bx, (%rax,%rbp,2)
+	cmpq	$20000, %r14
+	je	.L896
+.L827:
+	movq	%r14, %rbp
+.L831:
+	movq	seed(%rip), %rax
+	movq	16(%rsp), %rcx
+	imulq	%r12, %rax
+	addq	%r13, %rax
+	movq	%rax, %rbx
+	movq	%rax, seed(%rip)
+	shrq	$33, %rbx
+	subl	$1073741824, %ebx
+	cmpq	%rcx, %rbp
+	je	.L897
+	movq	(%rsp), %rdi
+	movl	%ebx, (%rdi,%rbp,4)
+.L814:
+	imulq	%r12, %rax
+	leaq	1(%rbp), %r14
+	leaq	(%rax,%r13), %rbx
+	movq	%rbx, %rax
+	shrq	$33, %rbx
+	imulq	%r12, %rax
+	salq	$31, %rbx
+	addq	%r13, %rax
+	movq	%rax, seed(%rip)
+	shrq	$33, %rax
+	xorq	%rax, %rbx
+	movq	40(%rsp), %rax
+	cmpq	%rax, %rbp
+	je	.L898
+	movq	32(%rsp), %rax
+	movq	%rbx, (%rax,%rbp,8)
+.L823:
+	movq	seed(%rip), %rbx
+	movq	24(%rsp), %rax
+	imulq	%r12, %rbx
+	addq	%r13, %rbx
+	movq	%rbx, seed(%rip)
+	shrq	$33, %rbx
+	cmpq	%rax, %rbp
+	jne	.L824
+	leaq	5(%rbp), %rsi
+	movq	48(%rsp), %rdi
+	movl	$2, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$2, %rsi
+	movq	%rax, 24(%rsp)
+	movq	(%rdi), %rax
+.LEHB24:
+	call	*16(%rax)
+.LEHE24:
+	movw	%bx, (%rax,%rbp,2)
+	movq	%rax, %r15
+	leaq	(%rbp,%rbp), %rdx
+	testq	%rbp, %rbp
+	jne	.L899
+	cmpq	$0, 8(%rsp)
+	je	.L849
+.L826:
+	movq	24(%rsp), %rax
+	movq	48(%rsp), %rdi
+	movl	$2, %ecx
+	movq	8(%rsp), %rsi
+	leaq	-10(%rax), %rdx
+	movq	(%rdi), %rax
+.LEHB25:
+	call	*24(%rax)
+.LEHE25:
+	movq	%r15, 8(%rsp)
+	cmpq	$20000, %r14
+	jne	.L827
+.L896:
+	movq	(%rsp), %rcx
+	pxor	%xmm0, %xmm0
+	pxor	%xmm4, %xmm4
+	movq	%rcx, %rax
+	leaq	80000(%rcx), %rbx
+	.p2align 4,,10
+	.p2align 3
+.L832:
+	movdqu	(%rax), %xmm2
+	movdqa	%xmm4, %xmm3
+	addq	$16, %rax
+	pcmpgtd	%xmm2, %xmm3
+	movdqa	%xmm2, %xmm1
+	punpckldq	%xmm3, %xmm1
+	punpckhdq	%xmm3, %xmm2
+	paddq	%xmm1, %xmm0
+	paddq	%xmm2, %xmm0
+	cmpq	%rax, %rbx
+	jne	.L832
+	movq	56(%rsp), %r15
+	movdqa	%xmm0, %xmm1
+	movl	$4, %edx
+	movl	$80000, %esi
+	psrldq	$8, %xmm1
+	movq	(%r15), %rax
+	paddq	%xmm1, %xmm0
+	movq	%r15, %rdi
+	movq	%xmm0, %rbp
+.LEHB26:
+	call	*16(%rax)
+	movq	(%rsp), %r14
+	movq	%rax, %rdx
+	movl	$20000, %esi
+	movq	%rax, %r12
+	movq	%r14, %rdi
+	call	_ZN1n10__lsd_sortIiNS_14__identity_keyEEEvPT_mS3_RT0_.isra.0
+	movq	(%r15), %rax
+	movl	$4, %ecx
+	movq	%r12, %rsi
+	movl	$80000, %edx
+	movq	%r15, %rdi
+	call	*24(%rax)
+.LEHE26:
+	movl	(%r14), %edx
+	movq	%r14, %rsi
+	movl	$1, %eax
+	jmp	.L834
+	.p2align 4,,10
+	.p2align 3
+.L901:
+	addq	$1, %rax
+	cmpq	$20000, %rax
+	je	.L900
+.L834:
+	movl	%edx, %ecx
+	movl	(%rsi,%rax,4), %edx
+	cmpl	%ecx, %edx
+	jge	.L901
+	jmp	.L833
+	.p2align 4,,10
+	.p2align 3
+.L898:
+	leaq	5(%rbp), %rsi
+	movq	64(%rsp), %rdi
+	movl	$8, %edx
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 72(%rsp)
+	movq	(%rdi), %rax
+.LEHB27:
+	call	*16(%rax)
+.LEHE27:
+	movq	%rbx, (%rax,%rbp,8)
+	movq	%rax, %r15
+	leaq	0(,%rbp,8), %rdx
+	testq	%rbp, %rbp
+	jne	.L902
+	cmpq	$0, 32(%rsp)
+	je	.L822
+.L821:
+	movq	64(%rsp), %rdi
+	movq	40(%rsp), %rdx
+	movl	$8, %ecx
+	movq	32(%rsp), %rsi
+	movq	(%rdi), %rax
+	salq	$3, %rdx
+.LEHB28:
+	call	*24(%rax)
+.LEHE28:
+.L822:
+	movq	72(%rsp), %rax
+	movq	%r15, 32(%rsp)
+	movq	%rax, 40(%rsp)
+	jmp	.L823
+	.p2align 4,,10
+	.p2align 3
+.L897:
+	movq	56(%rsp), %rdi
+	leaq	5(%rbp), %rsi
+	movl	$4, %edx
+	leaq	(%rsi,%rsi), %r15
+	salq	$3, %rsi
+	movq	(%rdi), %rax
+.LEHB29:
+	call	*16(%rax)
+.LEHE29:
+	movl	%ebx, (%rax,%rbp,4)
+	movq	%rax, %r14
+	leaq	0(,%rbp,4), %rdx
+	testq	%rbp, %rbp
+	jne	.L903
+	cmpq	$0, (%rsp)
+	je	.L888
+.L813:
+	movq	56(%rsp), %rdi
+	movq	16(%rsp), %rdx
+	movl	$4, %ecx
+	movq	(%rsp), %rsi
+	movq	(%rdi), %rax
+	salq	$2, %rdx
+.LEHB30:
+	call	*24(%rax)
+.LEHE30:
+.L888:
+	movq	%r15, 16(%rsp)
+	movq	seed(%rip), %rax
+	movq	%r14, (%rsp)
+	jmp	.L814
+	.p2align 4,,10
+	.p2align 3
+.L903:
+	movq	(%rsp), %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L813
+	.p2align 4,,10
+	.p2align 3
+.L902:
+	movq	32(%rsp), %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L821
+	.p2align 4,,10
+	.p2align 3
+.L899:
+	movq	8(%rsp), %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L826
+	.p2align 4,,10
+	.p2align 3
+.L849:
+	movq	%rax, 8(%rsp)
+	jmp	.L827
+.L900:
+	movq	(%rsp), %rax
+	pxor	%xmm0, %xmm0
+	pxor	%xmm4, %xmm4
+	.p2align 4,,10
+	.p2align 3
+.L835:
+	movdqu	(%rax), %xmm2
+	movdqa	%xmm4, %xmm3
+	addq	$16, %rax
+	pcmpgtd	%xmm2, %xmm3
+	movdqa	%xmm2, %xmm1
+	punpckldq	%xmm3, %xmm1
+	punpckhdq	%xmm3, %xmm2
+	paddq	%xmm1, %xmm0
+	paddq	%xmm2, %xmm0
+	cmpq	%rbx, %rax
+	jne	.L835
+	movdqa	%xmm0, %xmm1
+	psrldq	$8, %xmm1
+	paddq	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	cmpq	%rax, %rbp
+	jne	.L886
+	movq	64(%rsp), %r15
+	movl	$8, %edx
+	movl	$160000, %esi
+	movq	(%r15), %rax
+	movq	%r15, %rdi
+.LEHB31:
+	call	*16(%rax)
+	movq	32(%rsp), %r14
+	movq	%rax, %rdx
+	movl	$20000, %esi
+	movq	%rax, %rbx
+	movq	%r14, %rdi
+	call	_ZN1n10__lsd_sortIyNS_14__identity_keyEEEvPT_mS3_RT0_.isra.0
+	movq	(%r15), %rax
+	movl	$8, %ecx
+	movq	%rbx, %rsi
+	movl	$160000, %edx
+	movq	%r15, %rdi
+	call	*24(%rax)
+	movq	(%r14), %rdx
+	movq	%r14, %rsi
+	movl	$1, %eax
+	jmp	.L838
+	.p2align 4,,10
+	.p2align 3
+.L905:
+	addq	$1, %rax
+	cmpq	$20000, %rax
+	je	.L904
+.L838:
+	movq	%rdx, %rcx
+	movq	(%rsi,%rax,8), %rdx
+	cmpq	%rcx, %rdx
+	jnb	.L905
+	jmp	.L837
+.L904:
+	movq	48(%rsp), %r15
+	movl	$2, %edx
+	movl	$40000, %esi
+	movq	(%r15), %rax
+	movq	%r15, %rdi
+	call	*16(%rax)
+	movq	8(%rsp), %rdi
+	movq	%rax, %rdx
+	movl	$20000, %esi
+	movq	%rax, %rbx
+	call	_ZN1n10__lsd_sortIsNS_14__identity_keyEEEvPT_mS3_RT0_.isra.0
+	movq	(%r15), %rax
+	movq	%r15, %rdi
+	movl	$2, %ecx
+	movl	$40000, %edx
+	movq	%rbx, %rsi
+	call	*24(%rax)
+.LEHE31:
+	movq	8(%rsp), %rsi
+	movl	$1, %eax
+	movzwl	(%rsi), %edx
+	jmp	.L841
+	.p2align 4,,10
+	.p2align 3
+.L907:
+	addq	$1, %rax
+	cmpq	$20000, %rax
+	je	.L906
+.L841:
+	movl	%edx, %ecx
+	movzwl	(%rsi,%rax,2), %edx
+	cmpw	%dx, %cx
+	jle	.L907
+	jmp	.L840
+.L906:
+	movq	48(%rsp), %rdi
+	movq	24(%rsp), %rdx
+	movl	$2, %ecx
+	movq	8(%rsp), %rsi
+	movq	(%rdi), %rax
+	addq	%rdx, %rdx
+	call	*24(%rax)
+	movq	64(%rsp), %rdi
+	movq	40(%rsp), %rdx
+	movl	$8, %ecx
+	movq	32(%rsp), %rsi
+	movq	(%rdi), %rax
+	salq	$3, %rdx
+	call	*24(%rax)
+	movq	56(%rsp), %rdi
+	movq	16(%rsp), %rdx
+	movl	$4, %ecx
+	movq	(%rsp), %rsi
+	movq	(%rdi), %rax
+	salq	$2, %rdx
+	call	*24(%rax)
+	addq	$88, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L895:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L908
+.L799:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	%rax, 56(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, 48(%rsp)
+	testq	%rax, %rax
+	jne	.L797
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L909
+.L802:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	%rax, 64(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, 48(%rsp)
+	testq	%rax, %rax
+	jne	.L804
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L910
+.L806:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	%rax, 48(%rsp)
+	jmp	.L804
+.L908:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L799
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L799
+.L910:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L806
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L806
+.L909:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L802
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L802
+.L856:
+	movq	%rax, %rbx
+	jmp	.L816
+.L857:
+	movq	%rax, %rbx
+	jmp	.L810
+.L853:
+	movq	%rax, %rbx
+	jmp	.L843
+.L854:
+	movq	%rax, %rbx
+	jmp	.L819
+.L855:
+	movq	%rax, %rbx
+	jmp	.L829
+.L884:
+	jmp	.L885
+	.section	.gcc_except_table
+.LLSDA6797:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6797-.LLSDACSB6797
+.LLSDACSB6797:
+	.uleb128 .LEHB24-.LFB6797
+	.uleb128 .LEHE24-.LEHB24
+	.uleb128 .L884-.LFB6797
+	.uleb128 0
+	.uleb128 .LEHB25-.LFB6797
+	.uleb128 .LEHE25-.LEHB25
+	.uleb128 .L855-.LFB6797
+	.uleb128 0
+	.uleb128 .LEHB26-.LFB6797
+	.uleb128 .LEHE26-.LEHB26
+	.uleb128 .L884-.LFB6797
+	.uleb128 0
+	.uleb128 .LEHB27-.LFB6797
+	.uleb128 .LEHE27-.LEHB27
+	.uleb128 .L854-.LFB6797
+	.uleb128 0
+	.uleb128 .LEHB28-.LFB6797
+	.uleb128 .LEHE28-.LEHB28
+	.uleb128 .L853-.LFB6797
+	.uleb128 0
+	.uleb128 .LEHB29-.LFB6797
+	.uleb128 .LEHE29-.LEHB29
+	.uleb128 .L857-.LFB6797
+	.uleb128 0
+	.uleb128 .LEHB30-.LFB6797
+	.uleb128 .LEHE30-.LEHB30
+	.uleb128 .L856-.LFB6797
+	.uleb128 0
+	.uleb128 .LEHB31-.LFB6797
+	.uleb128 .LEHE31-.LEHB31
+	.uleb128 .L884-.LFB6797
+	.uleb128 0
+.LLSDACSE6797:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6797
+	.type	_Z24test_radix_sort_integersv.cold, @function
+_Z24test_radix_sort_integersv.cold:
+.LFSB6797:
+.L840:
+	.cfi_def_cfa_offset 144
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC10(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB32:
+	call	__cxa_throw@PLT
+.LEHE32:
+.L837:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC9(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB33:
+	call	__cxa_throw@PLT
+.LEHE33:
+.L851:
+	movq	%rax, %rbx
+.L845:
+	movq	48(%rsp), %rdi
+	movq	24(%rsp), %rdx
+	movl	$2, %ecx
+	movq	8(%rsp), %rsi
+	movq	(%rdi), %rax
+	addq	%rdx, %rdx
+	call	*24(%rax)
+.L844:
+	cmpq	$0, 32(%rsp)
+	je	.L846
+	movq	64(%rsp), %rdi
+	movq	40(%rsp), %rdx
+	movl	$8, %ecx
+	movq	32(%rsp), %rsi
+	movq	(%rdi), %rax
+	salq	$3, %rdx
+	call	*24(%rax)
+.L846:
+	cmpq	$0, (%rsp)
+	je	.L847
+	movq	56(%rsp), %rdi
+	movq	16(%rsp), %rdx
+	movl	$4, %ecx
+	movq	(%rsp), %rsi
+	movq	(%rdi), %rax
+	salq	$2, %rdx
+	call	*24(%rax)
+.L847:
+	movq	%rbx, %rdi
+.LEHB34:
+	call	_Unwind_Resume@PLT
+.LEHE34:
+.L852:
+.L885:
+	movq	%rax, %rbx
+.L811:
+	cmpq	$0, 8(%rsp)
+	je	.L844
+	jmp	.L845
+.L886:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC8(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB35:
+	call	__cxa_throw@PLT
+.L833:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC7(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE35:
+.L816:
+	movq	%r15, 16(%rsp)
+	movq	%r14, (%rsp)
+	jmp	.L811
+.L810:
+	movq	%r15, 16(%rsp)
+	jmp	.L811
+.L843:
+	movq	72(%rsp), %rax
+	movq	%r15, 32(%rsp)
+	movq	%rax, 40(%rsp)
+	jmp	.L811
+.L819:
+	movq	72(%rsp), %rax
+	movq	%rax, 40(%rsp)
+	jmp	.L811
+.L829:
+	movq	%r15, 8(%rsp)
+	jmp	.L811
+	.cfi_endproc
+.LFE6797:
+	.section	.gcc_except_table
+.LLSDAC6797:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6797-.LLSDACSBC6797
+.LLSDACSBC6797:
+	.uleb128 .LEHB32-.LCOLDB11
+	.uleb128 .LEHE32-.LEHB32
+	.uleb128 .L851-.LCOLDB11
+	.uleb128 0
+	.uleb128 .LEHB33-.LCOLDB11
+	.uleb128 .LEHE33-.LEHB33
+	.uleb128 .L852-.LCOLDB11
+	.uleb128 0
+	.uleb128 .LEHB34-.LCOLDB11
+	.uleb128 .LEHE34-.LEHB34
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB35-.LCOLDB11
+	.uleb128 .LEHE35-.LEHB35
+	.uleb128 .L852-.LCOLDB11
+	.uleb128 0
+.LLSDACSEC6797:
+	.section	.text.unlikely
+	.text
+	.size	_Z24test_radix_sort_integersv, .-_Z24test_radix_sort_integersv
+	.section	.text.unlikely
+	.size	_Z24test_radix_sort_integersv.cold, .-_Z24test_radix_sort_integersv.cold
+.LCOLDE11:
+	.text
+.LHOTE11:
+	.section	.text.unlikely
+.LCOLDB12:
+	.text
+.LHOTB12:
+	.p2align 4
+	.globl	_Z16test_stable_sortv
+	.type	_Z16test_stable_sortv, @function
+_Z16test_stable_sortv:
+.LFB6788:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6788
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r15
+	testq	%r15, %r15
+	je	.L1089
+.L912:
+	xorl	%ebx, %ebx
+	xorl	%r12d, %r12d
+	xorl	%r13d, %r13d
+	jmp	.L925
+	.p2align 4,,10
+	.p2align 3
+.L916:
+	leaq	0(%r13,%rbx,8), %rax
+	movl	%ebx, 4(%rax)
+	addq	$1, %rbx
+	movl	%ebp, (%rax)
+	cmpq	$3000, %rbx
+	je	.L1090
+.L925:
+	movabsq	$6364136223846793005, %rax
+	imulq	seed(%rip), %rax
+	movabsq	$1442695040888963407, %rcx
+	movabsq	$-6640827866535438581, %rdi
+	addq	%rcx, %rax
+	movq	%rax, %rbp
+	movq	%rax, seed(%rip)
+	shrq	$34, %rax
+	mulq	%rdi
+	shrq	$33, %rbp
+	shrq	$4, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	leaq	(%rax,%rax,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rbp
+	cmpq	%rbx, %r12
+	jne	.L916
+	leaq	5(%r12), %rsi
+	movl	$4, %edx
+	movq	%r15, %rdi
+	leaq	(%rsi,%rsi), %rax
+	salq	$4, %rsi
+	movq	%rax, 8(%rsp)
+	movq	(%r15), %rax
+.LEHB36:
+	call	*16(%rax)
+.LEHE36:
+	leaq	0(,%rbx,8), %rdx
+	movq	%rax, (%rsp)
+	addq	%rdx, %rax
+	movl	%ebp, (%rax)
+	movl	%ebx, 4(%rax)
+	testq	%rbx, %rbx
+	jne	.L1091
+	testq	%r13, %r13
+	je	.L996
+.L921:
+	movq	(%r15), %rax
+	movl	$4, %ecx
+	movq	%r13, %rsi
+	movq	%r15, %rdi
+	leaq	0(,%r12,8), %rdx
+.LEHB37:
+	call	*24(%rax)
+.LEHE37:
+	addq	$1, %rbx
+	movq	8(%rsp), %r12
+	movq	(%rsp), %r13
+	cmpq	$3000, %rbx
+	jne	.L925
+.L1090:
+	movq	(%r15), %rax
+	movl	$4, %edx
+	movl	$12000, %esi
+	movq	%r15, %rdi
+.LEHB38:
+	call	*16(%rax)
+	movq	%rax, %rbx
+	movq	%rax, %rdx
+	movl	$187, %esi
+	movq	%r13, %rdi
+	call	_ZN1n12__merge_sortI5keyedZ16test_stable_sortvEUlRKS1_S3_E_EEvPT_mS6_RT0_.isra.0
+	movq	%rbx, %rdx
+	leaq	1496(%r13), %rdi
+	movl	$188, %esi
+	call	_ZN1n12__merge_sortI5keyedZ16test_stable_sortvEUlRKS1_S3_E_EEvPT_mS6_RT0_.isra.0
+	leaq	12000(%r13), %rbp
+	movl	1488(%r13), %eax
+	xorl	%edx, %edx
+	cmpl	%eax, 1496(%r13)
+	jge	.L928
+.L929:
+	movq	0(%r13,%rdx,8), %rax
+	movq	%rax, (%rbx,%rdx,8)
+	addq	$1, %rdx
+	cmpq	$187, %rdx
+	jne	.L929
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	jmp	.L938
+.L1093:
+	movq	(%rdi), %rsi
+	addq	$1, %rdx
+	movq	%rsi, -8(%r13,%rcx,8)
+.L937:
+	cmpq	$186, %rax
+	ja	.L928
+	cmpq	$374, %rdx
+	ja	.L1092
+.L938:
+	leaq	(%rbx,%rax,8), %rsi
+	leaq	0(%r13,%rdx,8), %rdi
+	addq	$1, %rcx
+	movl	(%rsi), %r11d
+	cmpl	%r11d, (%rdi)
+	jl	.L1093
+	movq	(%rsi), %rsi
+	addq	$1, %rax
+	movq	%rsi, -8(%r13,%rcx,8)
+	jmp	.L937
+	.p2align 4,,10
+	.p2align 3
+.L1091:
+	movq	(%rsp), %rdi
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	jmp	.L921
+	.p2align 4,,10
+	.p2align 3
+.L996:
+	movq	8(%rsp), %r12
+	movq	(%rsp), %r13
+	movl	$1, %ebx
+	jmp	.L925
+.L1092:
+	cmpq	$186, %rax
+	ja	.L928
+	subq	%rax, %rcx
+	leaq	0(%r13,%rcx,8), %rcx
+.L940:
+	addq	$1, %rax
+	movq	-8(%rbx,%rax,8), %rdx
+	movq	%rdx, -8(%rcx,%rax,8)
+	cmpq	$186, %rax
+	jbe	.L940
+.L928:
+	leaq	3000(%r13), %r14
+	movq	%rbx, %rdx
+	movl	$187, %esi
+	movq	%r14, %rdi
+	call	_ZN1n12__merge_sortI5keyedZ16test_stable_sortvEUlRKS1_S3_E_EEvPT_mS6_RT0_.isra.0
+	movq	%rbx, %rdx
+	movl	$188, %esi
+	leaq	4496(%r13), %rdi
+	call	_ZN1n12__merge_sortI5keyedZ16test_stable_sortvEUlRKS1_S3_E_EEvPT_mS6_RT0_.isra.0
+	movl	4488(%r13), %eax
+	xorl	%edx, %edx
+	cmpl	%eax, 4496(%r13)
+	jge	.L934
+.L935:
+	movq	(%r14,%rdx,8), %rax
+	movq	%rax, (%rbx,%rdx,8)
+	addq	$1, %rdx
+	cmpq	$187, %rdx
+	jne	.L935
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	jmp	.L945
+.L1095:
+	movq	(%rdi), %rsi
+	addq	$1, %rdx
+	movq	%rsi, -8(%r14,%rcx,8)
+.L944:
+	cmpq	$186, %rax
+	ja	.L934
+	cmpq	$374, %rdx
+	ja	.L1094
+.L945:
+	leaq	(%rbx,%rax,8), %rsi
+	leaq	(%r14,%rdx,8), %rdi
+	addq	$1, %rcx
+	movl	(%rsi), %r8d
+	cmpl	%r8d, (%rdi)
+	jl	.L1095
+	movq	(%rsi), %rsi
+	addq	$1, %rax
+	movq	%rsi, -8(%r14,%rcx,8)
+	jmp	.L944
+.L1094:
+	cmpq	$186, %rax
+	ja	.L934
+	subq	%rax, %rcx
+	leaq	(%r14,%rcx,8), %rcx
+.L947:
+	addq	$1, %rax
+	movq	-8(%rbx,%rax,8), %rdx
+	movq	%rdx, -8(%rcx,%rax,8)
+	cmpq	$186, %rax
+	jbe	.L947
+.L934:
+	movl	2992(%r13), %eax
+	xorl	%edx, %edx
+	cmpl	%eax, 3000(%r13)
+	jge	.L941
+	.p2align 4,,10
+	.p2align 3
+.L942:
+	movq	0(%r13,%rdx,8), %rax
+	movq	%rax, (%rbx,%rdx,8)
+	addq	$1, %rdx
+	cmpq	$375, %rdx
+	jne	.L942
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	jmp	.L950
+.L1097:
+	movq	(%rdi), %rsi
+	addq	$1, %rdx
+	movq	%rsi, -8(%r13,%rcx,8)
+.L949:
+	cmpq	$374, %rax
+	ja	.L941
+	cmpq	$749, %rdx
+	ja	.L1096
+.L950:
+	leaq	(%rbx,%rax,8), %rsi
+	leaq	0(%r13,%rdx,8), %rdi
+	addq	$1, %rcx
+	movl	(%rsi), %r11d
+	cmpl	%r11d, (%rdi)
+	jl	.L1097
+	movq	(%rsi), %rsi
+	addq	$1, %rax
+	movq	%rsi, -8(%r13,%rcx,8)
+	jmp	.L949
+.L1096:
+	cmpq	$374, %rax
+	ja	.L941
+	subq	%rax, %rcx
+	leaq	0(%r13,%rcx,8), %rcx
+	.p2align 4,,10
+	.p2align 3
+.L952:
+	addq	$1, %rax
+	movq	-8(%rbx,%rax,8), %rdx
+	movq	%rdx, -8(%rcx,%rax,8)
+	cmpq	$374, %rax
+	jbe	.L952
+.L941:
+	leaq	6000(%r13), %r14
+	movq	%rbx, %rdx
+	movl	$375, %esi
+	movq	%r14, %rdi
+	call	_ZN1n12__merge_sortI5keyedZ16test_stable_sortvEUlRKS1_S3_E_EEvPT_mS6_RT0_.isra.0
+	movq	%rbx, %rdx
+	movl	$375, %esi
+	leaq	9000(%r13), %rdi
+	call	_ZN1n12__merge_sortI5keyedZ16test_stable_sortvEUlRKS1_S3_E_EEvPT_mS6_RT0_.isra.0
+	movl	8992(%r13), %eax
+	xorl	%edx, %edx
+	cmpl	%eax, 9000(%r13)
+	jge	.L932
+	.p2align 4,,10
+	.p2align 3
+.L933:
+	movq	(%r14,%rdx,8), %rax
+	movq	%rax, (%rbx,%rdx,8)
+	addq	$1, %rdx
+	cmpq	$375, %rdx
+	jne	.L933
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	jmp	.L957
+.L1099:
+	movq	(%rdi), %rsi
+	addq	$1, %rdx
+	movq	%rsi, -8(%r14,%rcx,8)
+.L956:
+	cmpq	$374, %rax
+	ja	.L932
+	cmpq	$749, %rdx
+	ja	.L1098
+.L957:
+	leaq	(%rbx,%rax,8), %rsi
+	leaq	(%r14,%rdx,8), %rdi
+	addq	$1, %rcx
+	movl	(%rsi), %r11d
+	cmpl	%r11d, (%rdi)
+	jl	.L1099
+	movq	(%rsi), %rsi
+	addq	$1, %rax
+	movq	%rsi, -8(%r14,%rcx,8)
+	jmp	.L956
+.L1098:
+	cmpq	$374, %rax
+	ja	.L932
+	subq	%rax, %rcx
+	leaq	(%r14,%rcx,8), %rcx
+	.p2align 4,,10
+	.p2align 3
+.L959:
+	addq	$1, %rax
+	movq	-8(%rbx,%rax,8), %rdx
+	movq	%rdx, -8(%rcx,%rax,8)
+	cmpq	$374, %rax
+	jbe	.L959
+.L932:
+	movl	5992(%r13), %eax
+	xorl	%edx, %edx
+	cmpl	%eax, 6000(%r13)
+	jge	.L953
+	.p2align 4,,10
+	.p2align 3
+.L954:
+	movq	0(%r13,%rdx,8), %rax
+	movq	%rax, (%rbx,%rdx,8)
+	addq	$1, %rdx
+	cmpq	$750, %rdx
+	jne	.L954
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	jmp	.L962
+.L1101:
+	movq	(%rdi), %rsi
+	addq	$1, %rdx
+	movq	%rsi, -8(%r13,%rcx,8)
+	cmpq	$749, %rax
+	ja	.L953
+.L1102:
+	cmpq	$1499, %rdx
+	ja	.L1100
+.L962:
+	leaq	(%rbx,%rax,8), %rsi
+	leaq	0(%r13,%rdx,8), %rdi
+	addq	$1, %rcx
+	movl	(%rsi), %r9d
+	cmpl	%r9d, (%rdi)
+	jl	.L1101
+	movq	(%rsi), %rsi
+	addq	$1, %rax
+	movq	%rsi, -8(%r13,%rcx,8)
+	cmpq	$749, %rax
+	jbe	.L1102
+.L953:
+	movq	%rbx, %rdx
+	movl	$375, %esi
+	movq	%rbp, %rdi
+	call	_ZN1n12__merge_sortI5keyedZ16test_stable_sortvEUlRKS1_S3_E_EEvPT_mS6_RT0_.isra.0
+	movq	%rbx, %rdx
+	movl	$375, %esi
+	leaq	15000(%r13), %rdi
+	call	_ZN1n12__merge_sortI5keyedZ16test_stable_sortvEUlRKS1_S3_E_EEvPT_mS6_RT0_.isra.0
+	movl	14992(%r13), %eax
+	xorl	%edx, %edx
+	cmpl	%eax, 15000(%r13)
+	jge	.L930
+.L931:
+	movq	0(%rbp,%rdx,8), %rax
+	movq	%rax, (%rbx,%rdx,8)
+	addq	$1, %rdx
+	cmpq	$375, %rdx
+	jne	.L931
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	jmp	.L969
+.L1104:
+	movq	(%rdi), %rsi
+	addq	$1, %rdx
+	movq	%rsi, -8(%rbp,%rcx,8)
+.L968:
+	cmpq	$374, %rax
+	ja	.L930
+	cmpq	$749, %rdx
+	ja	.L1103
+.L969:
+	leaq	(%rbx,%rax,8), %rsi
+	leaq	0(%rbp,%rdx,8), %rdi
+	addq	$1, %rcx
+	movl	(%rsi), %r9d
+	cmpl	%r9d, (%rdi)
+	jl	.L1104
+	movq	(%rsi), %rsi
+	addq	$1, %rax
+	movq	%rsi, -8(%rbp,%rcx,8)
+	jmp	.L968
+.L1103:
+	cmpq	$374, %rax
+	ja	.L930
+	subq	%rax, %rcx
+	leaq	0(%rbp,%rcx,8), %rcx
+	.p2align 4,,10
+	.p2align 3
+.L971:
+	addq	$1, %rax
+	movq	-8(%rbx,%rax,8), %rdx
+	movq	%rdx, -8(%rcx,%rax,8)
+	cmpq	$374, %rax
+	jbe	.L971
+.L930:
+	leaq	18000(%r13), %r14
+	movq	%rbx, %rdx
+	movl	$375, %esi
+	movq	%r14, %rdi
+	call	_ZN1n12__merge_sortI5keyedZ16test_stable_sortvEUlRKS1_S3_E_EEvPT_mS6_RT0_.isra.0
+	movq	%rbx, %rdx
+	movl	$375, %esi
+	leaq	21000(%r13), %rdi
+	call	_ZN1n12__merge_sortI5keyedZ16test_stable_sortvEUlRKS1_S3_E_EEvPT_mS6_RT0_.isra.0
+	movl	20992(%r13), %eax
+	xorl	%edx, %edx
+	cmpl	%eax, 21000(%r13)
+	jge	.L965
+	.p2align 4,,10
+	.p2align 3
+.L966:
+	movq	(%r14,%rdx,8), %rax
+	movq	%rax, (%rbx,%rdx,8)
+	addq	$1, %rdx
+	cmpq	$375, %rdx
+	jne	.L966
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	jmp	.L977
+.L1106:
+	movq	(%rdi), %rsi
+	addq	$1, %rdx
+	movq	%rsi, -8(%r14,%rcx,8)
+.L976:
+	cmpq	$374, %rax
+	ja	.L965
+	cmpq	$749, %rdx
+	ja	.L1105
+.L977:
+	leaq	(%rbx,%rax,8), %rsi
+	leaq	(%r14,%rdx,8), %rdi
+	addq	$1, %rcx
+	movl	(%rsi), %r10d
+	cmpl	%r10d, (%rdi)
+	jl	.L1106
+	movq	(%rsi), %rsi
+	addq	$1, %rax
+	movq	%rsi, -8(%r14,%rcx,8)
+	jmp	.L976
+.L1105:
+	cmpq	$374, %rax
+	ja	.L965
+	subq	%rax, %rcx
+	leaq	(%r14,%rcx,8), %rcx
+	.p2align 4,,10
+	.p2align 3
+.L979:
+	addq	$1, %rax
+	movq	-8(%rbx,%rax,8), %rdx
+	movq	%rdx, -8(%rcx,%rax,8)
+	cmpq	$374, %rax
+	jbe	.L979
+.L965:
+	movl	17992(%r13), %eax
+	xorl	%edx, %edx
+	cmpl	%eax, 18000(%r13)
+	jge	.L984
+	.p2align 4,,10
+	.p2align 3
+.L972:
+	movq	0(%rbp,%rdx,8), %rax
+	movq	%rax, (%rbx,%rdx,8)
+	addq	$1, %rdx
+	cmpq	$750, %rdx
+	jne	.L972
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	jmp	.L982
+.L1108:
+	movq	(%rdi), %rsi
+	addq	$1, %rdx
+	movq	%rsi, -8(%rbp,%rcx,8)
+	cmpq	$749, %rax
+	ja	.L984
+.L1109:
+	cmpq	$1499, %rdx
+	ja	.L1107
+.L982:
+	leaq	(%rbx,%rax,8), %rsi
+	leaq	0(%rbp,%rdx,8), %rdi
+	addq	$1, %rcx
+	movl	(%rsi), %r10d
+	cmpl	%r10d, (%rdi)
+	jl	.L1108
+	movq	(%rsi), %rsi
+	addq	$1, %rax
+	movq	%rsi, -8(%rbp,%rcx,8)
+	cmpq	$749, %rax
+	jbe	.L1109
+.L984:
+	movl	11992(%r13), %eax
+	xorl	%edx, %edx
+	cmpl	%eax, 12000(%r13)
+	jge	.L973
+	.p2align 4,,10
+	.p2align 3
+.L974:
+	movq	0(%r13,%rdx,8), %rax
+	movq	%rax, (%rbx,%rdx,8)
+	addq	$1, %rdx
+	cmpq	$1500, %rdx
+	jne	.L974
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	jmp	.L988
+	.p2align 4,,10
+	.p2align 3
+.L1111:
+	movq	(%rdi), %rsi
+	addq	$1, %rdx
+	movq	%rsi, -8(%r13,%rcx,8)
+	cmpq	$1499, %rax
+	ja	.L973
+.L1112:
+	cmpq	$2999, %rdx
+	ja	.L1110
+.L988:
+	leaq	(%rbx,%rax,8), %rsi
+	leaq	0(%r13,%rdx,8), %rdi
+	addq	$1, %rcx
+	movl	(%rsi), %r8d
+	cmpl	%r8d, (%rdi)
+	jl	.L1111
+	movq	(%rsi), %rsi
+	addq	$1, %rax
+	movq	%rsi, -8(%r13,%rcx,8)
+	cmpq	$1499, %rax
+	jbe	.L1112
+.L973:
+	movq	(%r15), %rax
+	movl	$4, %ecx
+	movl	$12000, %edx
+	movq	%rbx, %rsi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.LEHE38:
+	movl	$1, %eax
+	movl	$1, %edx
+	.p2align 4,,10
+	.p2align 3
+.L927:
+	testb	%dl, %dl
+	je	.L991
+	movl	0(%r13,%rax,8), %esi
+	cmpl	%esi, -8(%r13,%rax,8)
+	jl	.L991
+	movl	$0, %edx
+	jne	.L991
+	movl	4(%r13,%rax,8), %esi
+	cmpl	%esi, -4(%r13,%rax,8)
+	setl	%dl
+	.p2align 4,,10
+	.p2align 3
+.L991:
+	addq	$1, %rax
+	cmpq	$3000, %rax
+	jne	.L927
+	testb	%dl, %dl
+	je	.L1083
+	testq	%r13, %r13
+	je	.L911
+	movq	(%r15), %rax
+	movl	$4, %ecx
+	movq	%r13, %rsi
+	movq	%r15, %rdi
+	leaq	0(,%r12,8), %rdx
+	call	*24(%rax)
+.L911:
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L1089:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1113
+.L914:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	jmp	.L912
+.L1110:
+	cmpq	$1499, %rax
+	ja	.L973
+	subq	%rax, %rcx
+	leaq	0(%r13,%rcx,8), %rcx
+	.p2align 4,,10
+	.p2align 3
+.L990:
+	addq	$1, %rax
+	movq	-8(%rbx,%rax,8), %rdx
+	movq	%rdx, -8(%rcx,%rax,8)
+	cmpq	$1500, %rax
+	jne	.L990
+	jmp	.L973
+.L1107:
+	cmpq	$749, %rax
+	ja	.L984
+	subq	%rax, %rcx
+	leaq	0(%rbp,%rcx,8), %rcx
+	.p2align 4,,10
+	.p2align 3
+.L985:
+	addq	$1, %rax
+	movq	-8(%rbx,%rax,8), %rdx
+	movq	%rdx, -8(%rcx,%rax,8)
+	cmpq	$749, %rax
+	jbe	.L985
+	jmp	.L984
+.L1100:
+	cmpq	$749, %rax
+	ja	.L953
+	subq	%rax, %rcx
+	leaq	0(%r13,%rcx,8), %rcx
+	.p2align 4,,10
+	.p2align 3
+.L964:
+	addq	$1, %rax
+	movq	-8(%rbx,%rax,8), %rdx
+	movq	%rdx, -8(%rcx,%rax,8)
+	cmpq	$749, %rax
+	jbe	.L964
+	jmp	.L953
+.L1113:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L914
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L914
+.L1003:
+	movq	%rax, %rbx
+	jmp	.L918
+.L1081:
+	jmp	.L1082
+.L1002:
+	movq	%rax, %rbx
+	jmp	.L994
+	.section	.gcc_except_table
+.LLSDA6788:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6788-.LLSDACSB6788
+.LLSDACSB6788:
+	.uleb128 .LEHB36-.LFB6788
+	.uleb128 .LEHE36-.LEHB36
+	.uleb128 .L1003-.LFB6788
+	.uleb128 0
+	.uleb128 .LEHB37-.LFB6788
+	.uleb128 .LEHE37-.LEHB37
+	.uleb128 .L1002-.LFB6788
+	.uleb128 0
+	.uleb128 .LEHB38-.LFB6788
+	.uleb128 .LEHE38-.LEHB38
+	.uleb128 .L1081-.LFB6788
+	.uleb128 0
+.LLSDACSE6788:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6788
+	.type	_Z16test_stable_sortv.cold, @function
+_Z16test_stable_sortv.cold:
+.LFSB6788:
+.L918:
+	.cfi_def_cfa_offset 80
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	8(%rsp), %r12
+.L919:
+	testq	%r13, %r13
+	je	.L995
+	movq	(%r15), %rax
+	movl	$4, %ecx
+	movq	%r13, %rsi
+	movq	%r15, %rdi
+	leaq	0(,%r12,8), %rdx
+	call	*24(%rax)
+.L995:
+	movq	%rbx, %rdi
+.LEHB39:
+	call	_Unwind_Resume@PLT
+.LEHE39:
+.L1001:
+.L1082:
+	movq	%rax, %rbx
+	jmp	.L919
+.L1083:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC5(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB40:
+	call	__cxa_throw@PLT
+.LEHE40:
+.L994:
+	movq	8(%rsp), %r12
+	movq	(%rsp), %r13
+	jmp	.L919
+	.cfi_endproc
+.LFE6788:
+	.section	.gcc_except_table
+.LLSDAC6788:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6788-.LLSDACSBC6788
+.LLSDACSBC6788:
+	.uleb128 .LEHB39-.LCOLDB12
+	.uleb128 .LEHE39-.LEHB39
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB40-.LCOLDB12
+	.uleb128 .LEHE40-.LEHB40
+	.uleb128 .L1001-.LCOLDB12
+	.uleb128 0
+.LLSDACSEC6788:
+	.section	.text.unlikely
+	.text
+	.size	_Z16test_stable_sortv, .-_Z16test_stable_sortv
+	.section	.text.unlikely
+	.size	_Z16test_stable_sortv.cold, .-_Z16test_stable_sortv.cold
+.LCOLDE12:
+	.text
+.LHOTE12:
+	.section	.rodata._ZN1n4test10test_suite7run_allEv.str1.1,"aMS",@progbits,1
+.LC13:
+	.string	"\nSUITE [%s] "
+.LC15:
+	.string	"%s"
+.LC16:
+	.string	"\nTEST [%s] "
+.LC17:
+	.string	" - Result : \033[1;32mPASSED\033[0m"
+.LC18:
+	.string	"\033[1;31merror : %s\033[0m\n"
+.LC19:
+	.string	" - Result : \033[1;31mFAILED\033[0m"
+.LC20:
+	.string	" - Passed : \033[1;32m%d\033[0m\n"
+.LC21:
+	.string	" - Failed : \033[1;31m%d\033[0m\n"
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4test10test_suite7run_allEv
+	.type	_ZN1n4test10test_suite7run_allEv, @function
+_ZN1n4test10test_suite7run_allEv:
+.LFB6771:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6771
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	leaq	.LC13(%rip), %rdx
+	movl	$79, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	16(%rdi), %rcx
+	leaq	16(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L1115
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L1116
+	testb	$4, %cl
+	jne	.L1169
+	testl	%ecx, %ecx
+	je	.L1115
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L1170
+	.p2align 4,,10
+	.p2align 3
+.L1115:
+	movzwl	.LC14(%rip), %r15d
+	movq	%rbx, %rsi
+	leaq	.LC15(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+.LEHB41:
+	call	printf@PLT
+	movl	8(%r12), %esi
+	testl	%esi, %esi
+	jle	.L1136
+	movl	$0, 12(%rsp)
+	xorl	%ebp, %ebp
+	xorl	%r14d, %r14d
+	jmp	.L1130
+	.p2align 4,,10
+	.p2align 3
+.L1173:
+	testb	$4, %dl
+	jne	.L1171
+	testl	%edx, %edx
+	je	.L1121
+	movb	$42, (%rax)
+	testb	$2, %dl
+	jne	.L1172
+	.p2align 4,,10
+	.p2align 3
+.L1121:
+	movq	%rbx, %rsi
+	leaq	.LC15(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+.LEHE41:
+	movq	(%r12), %rax
+.LEHB42:
+	call	*8(%rax,%r13)
+.LEHE42:
+	leaq	.LC17(%rip), %rdi
+	addl	$1, %r14d
+.LEHB43:
+	call	puts@PLT
+.L1126:
+	addq	$1, %rbp
+	cmpl	%ebp, 8(%r12)
+	jle	.L1120
+.L1130:
+	movq	(%r12), %rax
+	movq	%rbp, %r13
+	movq	%rbx, %rdi
+	movl	$79, %esi
+	salq	$4, %r13
+	leaq	.LC16(%rip), %rdx
+	movq	(%rax,%r13), %rcx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L1121
+	movl	$79, %edx
+	subl	%eax, %edx
+	addq	%rbx, %rax
+	cmpl	$8, %edx
+	jb	.L1173
+	movabsq	$3038287259199220266, %rsi
+	leaq	8(%rax), %rdi
+	movl	%edx, %ecx
+	andq	$-8, %rdi
+	movq	%rsi, (%rax)
+	movq	%rsi, -8(%rax,%rcx)
+	subq	%rdi, %rax
+	leal	(%rdx,%rax), %ecx
+	movq	%rsi, %rax
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L1121
+.L1136:
+	movl	$0, 12(%rsp)
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L1120:
+	movabsq	$5917806138674729738, %rax
+	movq	%rbx, %rdi
+	movq	%rax, 16(%rsp)
+	movabsq	$9095440486453792, %rax
+	movq	%rax, 22(%rsp)
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L1131
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L1132
+	testb	$4, %cl
+	jne	.L1174
+	testl	%ecx, %ecx
+	je	.L1131
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L1175
+.L1131:
+	movq	%rbx, %rsi
+	leaq	.LC15(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+	movl	%r14d, %esi
+	leaq	.LC20(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	12(%rsp), %esi
+	leaq	.LC21(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	$10, %edi
+	call	putchar@PLT
+.LEHE43:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L1132:
+	.cfi_restore_state
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L1131
+.L1116:
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L1115
+.L1171:
+	movl	$707406378, (%rax)
+	movl	$707406378, -4(%rax,%rdx)
+	jmp	.L1121
+.L1172:
+	movl	$10794, %ecx
+	movw	%cx, -2(%rax,%rdx)
+	jmp	.L1121
+.L1170:
+	movl	$10794, %edi
+	movw	%di, -2(%rdx,%rcx)
+	jmp	.L1115
+.L1175:
+	movl	$10794, %eax
+	movw	%ax, -2(%rdx,%rcx)
+	jmp	.L1131
+.L1169:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L1115
+.L1174:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L1131
+.L1137:
+	movq	%rax, %rdi
+	movq	%rdx, %rax
+.L1127:
+	subq	$1, %rax
+	jne	.L1168
+	call	__cxa_begin_catch@PLT
+	leaq	.LC18(%rip), %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+.LEHB44:
+	call	printf@PLT
+.LEHE44:
+	call	__cxa_end_catch@PLT
+	leaq	.LC19(%rip), %rdi
+	addl	$1, 12(%rsp)
+.LEHB45:
+	call	puts@PLT
+	jmp	.L1126
+.L1129:
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+.L1168:
+	call	_Unwind_Resume@PLT
+.LEHE45:
+.L1138:
+	movq	%rax, %rbx
+	jmp	.L1129
+	.cfi_endproc
+.LFE6771:
+	.section	.gcc_except_table
+	.align 4
+.LLSDA6771:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT6771-.LLSDATTD6771
+.LLSDATTD6771:
+	.byte	0x1
+	.uleb128 .LLSDACSE6771-.LLSDACSB6771
+.LLSDACSB6771:
+	.uleb128 .LEHB41-.LFB6771
+	.uleb128 .LEHE41-.LEHB41
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB42-.LFB6771
+	.uleb128 .LEHE42-.LEHB42
+	.uleb128 .L1137-.LFB6771
+	.uleb128 0x1
+	.uleb128 .LEHB43-.LFB6771
+	.uleb128 .LEHE43-.LEHB43
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB44-.LFB6771
+	.uleb128 .LEHE44-.LEHB44
+	.uleb128 .L1138-.LFB6771
+	.uleb128 0
+	.uleb128 .LEHB45-.LFB6771
+	.uleb128 .LEHE45-.LEHB45
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6771:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	DW.ref._ZTIPKc-.
+.LLSDATT6771:
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.size	_ZN1n4test10test_suite7run_allEv, .-_ZN1n4test10test_suite7run_allEv
+	.text
+	.p2align 4
+	.globl	_Z3rndv
+	.type	_Z3rndv, @function
+_Z3rndv:
+.LFB6772:
+	.cfi_startproc
+	movabsq	$6364136223846793005, %rax
+	imulq	seed(%rip), %rax
+	movabsq	$1442695040888963407, %rdx
+	addq	%rdx, %rax
+	movq	%rax, seed(%rip)
+	shrq	$33, %rax
+	ret
+	.cfi_endproc
+.LFE6772:
+	.size	_Z3rndv, .-_Z3rndv
+	.section	.rodata.str1.1
+.LC22:
+	.string	"n::sort tests"
+.LC23:
+	.string	"test_sort_patterns"
+.LC24:
+	.string	"test_sort_comparator"
+.LC25:
+	.string	"test_sort_strings"
+.LC26:
+	.string	"test_stable_sort"
+.LC27:
+	.string	"test_radix_sort_integers"
+	.section	.rodata.str1.8
+	.align 8
+.LC28:
+	.string	"test_radix_sort_by_key_is_stable"
+	.section	.rodata.str1.1
+.LC29:
+	.string	"test_radix_sort_strings"
+.LC30:
+	.string	"test_radix_sort_wide_strings"
+	.section	.text.unlikely
+.LCOLDB32:
+	.section	.text.startup,"ax",@progbits
+.LHOTB32:
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB6825:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6825
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$1600, %edi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 64
+.LEHB46:
+	call	_Znam@PLT
+.LEHE46:
+	movq	%rax, %rbx
+	leaq	1600(%rax), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L1178:
+	movq	$0, (%rax)
+	addq	$16, %rax
+	movq	$0, -8(%rax)
+	cmpq	%rax, %rdx
+	jne	.L1178
+	leaq	.LC22(%rip), %rax
+	movq	%rsp, %rdi
+	movq	%rbx, (%rsp)
+	movq	%rax, 16(%rsp)
+	leaq	.LC23(%rip), %rax
+	movq	%rax, (%rbx)
+	leaq	_Z18test_sort_patternsv(%rip), %rax
+	movq	%rax, 8(%rbx)
+	leaq	.LC24(%rip), %rax
+	movq	%rax, 16(%rbx)
+	leaq	_Z20test_sort_comparatorv(%rip), %rax
+	movq	%rax, 24(%rbx)
+	leaq	.LC25(%rip), %rax
+	movq	%rax, 32(%rbx)
+	leaq	_Z17test_sort_stringsv(%rip), %rax
+	movq	%rax, 40(%rbx)
+	leaq	.LC26(%rip), %rax
+	movq	%rax, 48(%rbx)
+	leaq	_Z16test_stable_sortv(%rip), %rax
+	movq	%rax, 56(%rbx)
+	leaq	.LC27(%rip), %rax
+	movq	%rax, 64(%rbx)
+	leaq	_Z24test_radix_sort_integersv(%rip), %rax
+	movq	%rax, 72(%rbx)
+	leaq	.LC28(%rip), %rax
+	movq	%rax, 80(%rbx)
+	leaq	_Z32test_radix_sort_by_key_is_stablev(%rip), %rax
+	movq	%rax, 88(%rbx)
+	leaq	.LC29(%rip), %rax
+	movq	%rax, 96(%rbx)
+	leaq	_Z23test_radix_sort_stringsv(%rip), %rax
+	movq	%rax, 104(%rbx)
+	leaq	.LC30(%rip), %rax
+	movq	%rax, 112(%rbx)
+	leaq	_Z28test_radix_sort_wide_stringsv(%rip), %rax
+	movq	%rax, 120(%rbx)
+	movq	.LC31(%rip), %rax
+	movq	%rax, 8(%rsp)
+.LEHB47:
+	call	_ZN1n4test10test_suite7run_allEv
+.LEHE47:
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L1180:
+	.cfi_restore_state
+	movq	%rax, %rbp
+	jmp	.L1179
+	.section	.gcc_except_table
+.LLSDA6825:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6825-.LLSDACSB6825
+.LLSDACSB6825:
+	.uleb128 .LEHB46-.LFB6825
+	.uleb128 .LEHE46-.LEHB46
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB47-.LFB6825
+	.uleb128 .LEHE47-.LEHB47
+	.uleb128 .L1180-.LFB6825
+	.uleb128 0
+.LLSDACSE6825:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6825
+	.type	main.cold, @function
+main.cold:
+.LFSB6825:
+.L1179:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	movq	%rbp, %rdi
+.LEHB48:
+	call	_Unwind_Resume@PLT
+.LEHE48:
+	.cfi_endproc
+.LFE6825:
+	.section	.gcc_except_table
+.LLSDAC6825:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6825-.LLSDACSBC6825
+.LLSDACSBC6825:
+	.uleb128 .LEHB48-.LCOLDB32
+	.uleb128 .LEHE48-.LEHB48
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6825:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	main, .-main
+	.section	.text.unlikely
+	.size	main.cold, .-main.cold
+.LCOLDE32:
+	.section	.text.startup
+.LHOTE32:
+	.section	.text._ZN1n6vectorINS_6stringIcEEE9__releaseEv,"axG",@progbits,_ZN1n6vectorINS_6stringIcEEE9__releaseEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n6vectorINS_6stringIcEEE9__releaseEv
+	.type	_ZN1n6vectorINS_6stringIcEEE9__releaseEv, @function
+_ZN1n6vectorINS_6stringIcEEE9__releaseEv:
+.LFB6920:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6920
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movq	16(%rdi), %rbp
+	movq	(%rdi), %rsi
+	testq	%rbp, %rbp
+	je	.L1186
+	movq	%rsi, %rbx
+	xorl	%r13d, %r13d
+	.p2align 4,,10
+	.p2align 3
+.L1190:
+	movq	8(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L1187
+	movq	16(%rbx), %rdi
+	addq	$1, %r13
+	movq	24(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	addq	$48, %rbx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	%r13, %rbp
+	jne	.L1190
+.L1189:
+	movq	(%r12), %rsi
+.L1186:
+	testq	%rsi, %rsi
+	je	.L1191
+	movq	8(%r12), %rax
+	movq	24(%r12), %rdi
+	movl	$8, %ecx
+	leaq	(%rax,%rax,2), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+.LEHB49:
+	call	*24(%rax)
+.LEHE49:
+.L1191:
+	pxor	%xmm0, %xmm0
+	movq	$0, (%r12)
+	movups	%xmm0, 8(%r12)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1187:
+	.cfi_restore_state
+	addq	$1, %r13
+	addq	$48, %rbx
+	cmpq	%r13, %rbp
+	jne	.L1190
+	jmp	.L1189
+	.cfi_endproc
+.LFE6920:
+	.section	.gcc_except_table
+.LLSDA6920:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6920-.LLSDACSB6920
+.LLSDACSB6920:
+	.uleb128 .LEHB49-.LFB6920
+	.uleb128 .LEHE49-.LEHB49
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6920:
+	.section	.text._ZN1n6vectorINS_6stringIcEEE9__releaseEv,"axG",@progbits,_ZN1n6vectorINS_6stringIcEEE9__releaseEv,comdat
+	.size	_ZN1n6vectorINS_6stringIcEEE9__releaseEv, .-_ZN1n6vectorINS_6stringIcEEE9__releaseEv
+	.section	.text._ZN1n10__msd_sortIcEEvPNS_6stringIT_EEmm,"axG",@progbits,_ZN1n10__msd_sortIcEEvPNS_6stringIT_EEmm,comdat
+	.p2align 4
+	.weak	_ZN1n10__msd_sortIcEEvPNS_6stringIT_EEmm
+	.type	_ZN1n10__msd_sortIcEEvPNS_6stringIT_EEmm, @function
+_ZN1n10__msd_sortIcEEvPNS_6stringIT_EEmm:
+.LFB7052:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7052
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdx, %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$6344, %rsp
+	.cfi_def_cfa_offset 6400
+	cmpq	$32, %rsi
+	jbe	.L1200
+	leaq	144(%rsp), %rax
+	movq	%rax, 72(%rsp)
+	leaq	2208(%rsp), %rax
+	movq	%rax, 80(%rsp)
+	leaq	4272(%rsp), %rax
+	movq	%rax, 64(%rsp)
+.L1233:
+	movq	72(%rsp), %rdi
+	leaq	(%r12,%r12,2), %rdx
+	xorl	%eax, %eax
+	movl	$257, %ecx
+	salq	$4, %rdx
+	rep stosq
+	leaq	24(%r13,%rdx), %rsi
+	leaq	24(%r13), %rax
+.L1203:
+	movq	%rax, %rcx
+	xorl	%edx, %edx
+	cmpq	-24(%rax), %r15
+	jnb	.L1201
+	cmpq	$23, -16(%rax)
+	je	.L1202
+	movq	(%rax), %rcx
+.L1202:
+	movzbl	(%rcx,%r15), %edx
+	addq	$1, %rdx
+.L1201:
+	addq	$1, 144(%rsp,%rdx,8)
+	addq	$48, %rax
+	cmpq	%rax, %rsi
+	jne	.L1203
+	movq	144(%rsp), %rax
+	movq	64(%rsp), %rcx
+	xorl	%edx, %edx
+	movq	80(%rsp), %rsi
+	movq	72(%rsp), %rdi
+	movq	%rax, 88(%rsp)
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L1204:
+	movq	%rdx, (%rsi,%rax,8)
+	addq	(%rdi,%rax,8), %rdx
+	movq	%rdx, (%rcx,%rax,8)
+	addq	$1, %rax
+	cmpq	$257, %rax
+	jne	.L1204
+	movq	80(%rsp), %rax
+	xorl	%r14d, %r14d
+	movq	%rax, 8(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1205:
+	movq	8(%rsp), %rax
+	movq	64(%rsp), %rdi
+	movq	(%rax), %rax
+	movq	(%rdi,%r14,8), %rsi
+	movq	%rsi, 16(%rsp)
+	cmpq	%rsi, %rax
+	jb	.L1225
+	jmp	.L1227
+	.p2align 4,,10
+	.p2align 3
+.L1302:
+	movq	8(%rsp), %rdi
+	addq	$1, %rax
+	movq	%rax, (%rdi)
+	movq	16(%rsp), %rdi
+	cmpq	%rdi, %rax
+	jnb	.L1227
+.L1225:
+	leaq	(%rax,%rax,2), %rdx
+	xorl	%ebp, %ebp
+	salq	$4, %rdx
+	addq	%r13, %rdx
+	movq	(%rdx), %rcx
+	cmpq	%rcx, %r15
+	jnb	.L1206
+	cmpq	$23, 8(%rdx)
+	leaq	24(%rdx), %rsi
+	je	.L1208
+	movq	24(%rdx), %rsi
+.L1208:
+	movzbl	(%rsi,%r15), %esi
+	leaq	1(%rsi), %rbp
+.L1206:
+	cmpq	%r14, %rbp
+	je	.L1302
+	movq	2208(%rsp,%rbp,8), %r12
+	leaq	(%r12,%r12,2), %rbx
+	salq	$4, %rbx
+	addq	%r13, %rbx
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L1303
+.L1211:
+	movq	8(%rdx), %rax
+	movq	%rcx, %xmm1
+	movq	16(%rdx), %rcx
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 128(%rsp)
+	movq	%rax, %xmm7
+	movq	%rax, 56(%rsp)
+	punpcklqdq	%xmm7, %xmm1
+	movq	%rcx, 48(%rsp)
+	movaps	%xmm1, 32(%rsp)
+	cmpq	$23, %rax
+	je	.L1304
+	movq	24(%rdx), %rax
+	movq	$23, 8(%rdx)
+	movq	$0, (%rdx)
+	movq	%rax, 120(%rsp)
+	movb	$0, 24(%rdx)
+	cmpq	%rbx, %rdx
+	je	.L1305
+.L1215:
+	movq	$0, (%rdx)
+	movb	$0, 24(%rdx)
+	movq	(%rbx), %rax
+	movq	16(%rbx), %rcx
+	movq	%rax, (%rdx)
+	movq	8(%rbx), %rax
+	movq	%rcx, 16(%rdx)
+	movq	%rax, 8(%rdx)
+	cmpq	$23, %rax
+	je	.L1306
+	movq	24(%rbx), %rax
+	movq	%rax, 24(%rdx)
+	movq	$23, 8(%rbx)
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+.L1220:
+	movdqa	32(%rsp), %xmm2
+	movq	48(%rsp), %rax
+	cmpq	$23, 56(%rsp)
+	movq	%rax, 16(%rbx)
+	movups	%xmm2, (%rbx)
+	je	.L1217
+.L1218:
+	movq	120(%rsp), %rax
+	movq	%rax, 24(%rbx)
+.L1224:
+	movq	8(%rsp), %rax
+	addq	$1, %r12
+	movq	16(%rsp), %rdi
+	movq	%r12, 2208(%rsp,%rbp,8)
+	movq	(%rax), %rax
+	cmpq	%rdi, %rax
+	jb	.L1225
+.L1227:
+	addq	$1, %r14
+	addq	$8, 8(%rsp)
+	cmpq	$257, %r14
+	jne	.L1205
+	movq	72(%rsp), %rsi
+	movl	$2, %eax
+	movl	$1, %ecx
+	movq	152(%rsp), %r12
+	.p2align 4,,10
+	.p2align 3
+.L1229:
+	movq	(%rsi,%rax,8), %rdx
+	cmpq	%rdx, %r12
+	jnb	.L1228
+	movq	%rdx, %r12
+	movq	%rax, %rcx
+.L1228:
+	addq	$1, %rax
+	cmpq	$257, %rax
+	jne	.L1229
+	addq	$1, %r15
+	xorl	%r14d, %r14d
+	movq	%r12, 8(%rsp)
+	movq	%r13, %rax
+	movq	%r15, %rdx
+	movq	88(%rsp), %r12
+	movq	%r14, %r15
+	movl	$1, %ebx
+	movq	72(%rsp), %r14
+	movq	%rcx, %r13
+	jmp	.L1232
+	.p2align 4,,10
+	.p2align 3
+.L1230:
+	addq	$1, %rbx
+	addq	%rbp, %r12
+	cmpq	$257, %rbx
+	je	.L1307
+.L1232:
+	movq	(%r14,%rbx,8), %rbp
+	cmpq	%rbx, %r13
+	je	.L1269
+	cmpq	$1, %rbp
+	jbe	.L1230
+	leaq	(%r12,%r12,2), %rdi
+	movq	%rbp, %rsi
+	addq	$1, %rbx
+	movq	%rax, 48(%rsp)
+	salq	$4, %rdi
+	movq	%rdx, 16(%rsp)
+	addq	%rbp, %r12
+	addq	%rax, %rdi
+.LEHB50:
+	call	_ZN1n10__msd_sortIcEEvPNS_6stringIT_EEmm
+.LEHE50:
+	movq	16(%rsp), %rdx
+	movq	48(%rsp), %rax
+	cmpq	$257, %rbx
+	jne	.L1232
+.L1307:
+	movq	%r15, %r14
+	movq	%rax, %r13
+	movq	8(%rsp), %r12
+	movq	%rdx, %r15
+	leaq	(%r14,%r14,2), %rax
+	salq	$4, %rax
+	addq	%rax, %r13
+	cmpq	$32, %r12
+	ja	.L1233
+.L1200:
+	leaq	(%r12,%r12,2), %rax
+	salq	$4, %rax
+	leaq	0(%r13,%rax), %r14
+	cmpq	%r13, %r14
+	je	.L1199
+	leaq	48(%r13), %rbx
+	cmpq	%r14, %rbx
+	jb	.L1263
+	jmp	.L1199
+	.p2align 4,,10
+	.p2align 3
+.L1238:
+	cmpq	%r8, %rbp
+	movq	%r8, %rcx
+	movq	24(%rbx), %rax
+	cmovbe	%rbp, %rcx
+	testq	%rcx, %rcx
+	je	.L1240
+.L1308:
+	addq	%rdx, %rsi
+	addq	%rax, %rdi
+	movq	%rcx, %rdx
+	movq	%r8, 16(%rsp)
+	call	memcmp@PLT
+	movq	16(%rsp), %r8
+	testl	%eax, %eax
+	je	.L1240
+	js	.L1243
+.L1242:
+	addq	$48, %rbx
+	cmpq	%r14, %rbx
+	jnb	.L1199
+.L1263:
+	movq	(%rbx), %r12
+	movq	-48(%rbx), %rax
+	movq	%r15, %rdi
+	movq	%r15, %rsi
+	leaq	-24(%rbx), %rdx
+	cmpq	%r15, %r12
+	cmovbe	%r12, %rdi
+	cmpq	%r15, %rax
+	cmovbe	%rax, %rsi
+	subq	%rsi, %rax
+	cmpq	$23, -40(%rbx)
+	movq	%rax, %rbp
+	je	.L1237
+	movq	-24(%rbx), %rdx
+.L1237:
+	movq	8(%rbx), %rax
+	movq	%r12, %r8
+	subq	%rdi, %r8
+	movq	%rax, 8(%rsp)
+	cmpq	$23, %rax
+	jne	.L1238
+	cmpq	%r8, %rbp
+	movq	%r8, %rcx
+	leaq	24(%rbx), %rax
+	cmovbe	%rbp, %rcx
+	testq	%rcx, %rcx
+	jne	.L1308
+.L1240:
+	cmpq	%rbp, %r8
+	jnb	.L1242
+.L1243:
+	movdqa	.LC33(%rip), %xmm7
+	movaps	%xmm7, 4272(%rsp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L1244
+	movq	%r12, %xmm7
+	movhps	8(%rsp), %xmm7
+	movaps	%xmm7, 16(%rsp)
+.L1245:
+	movq	16(%rbx), %rax
+	movhlps	%xmm7, %xmm6
+	pxor	%xmm0, %xmm0
+	movaps	%xmm7, 4272(%rsp)
+	movq	%xmm6, %rsi
+	movq	%xmm6, 32(%rsp)
+	movq	%rax, 48(%rsp)
+	movq	%rax, 4288(%rsp)
+	movaps	%xmm0, 4304(%rsp)
+	cmpq	$23, %rsi
+	je	.L1309
+	movq	24(%rbx), %rax
+	movq	$23, 8(%rbx)
+	movq	%rax, 4296(%rsp)
+.L1249:
+	cmpq	%r12, %r15
+	movq	%r12, %rax
+	movq	%rbx, %rbp
+	movq	$0, (%rbx)
+	cmovbe	%r15, %rax
+	movb	$0, 24(%rbx)
+	movq	%rax, 56(%rsp)
+	movq	8(%rbp), %rax
+	cmpq	$23, %rax
+	je	.L1250
+.L1311:
+	movq	16(%rbp), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%rbp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB51:
+	call	*24(%rax)
+.LEHE51:
+	movq	$23, 8(%rbp)
+.L1250:
+	movb	$0, 24(%rbp)
+	movq	-48(%rbp), %rax
+	leaq	-48(%rbp), %rcx
+	movq	16(%rcx), %rdx
+	movq	%rax, 48(%rcx)
+	movq	8(%rcx), %rax
+	movq	%rdx, 64(%rcx)
+	movq	%rax, 56(%rcx)
+	cmpq	$23, %rax
+	je	.L1310
+	movq	24(%rcx), %rax
+	movq	$23, 8(%rcx)
+	movq	%rax, 72(%rcx)
+.L1252:
+	movq	$0, (%rcx)
+	movb	$0, 24(%rcx)
+	cmpq	%rcx, %r13
+	je	.L1253
+	movq	-48(%rcx), %r8
+	movq	%r15, %rsi
+	leaq	-24(%rcx), %rdx
+	cmpq	%r15, %r8
+	cmovbe	%r8, %rsi
+	subq	%rsi, %r8
+	cmpq	$23, -40(%rcx)
+	je	.L1255
+	movq	-24(%rcx), %rdx
+.L1255:
+	movq	56(%rsp), %rax
+	movq	%r12, %r9
+	subq	%rax, %r9
+	cmpq	$23, 32(%rsp)
+	leaq	4296(%rsp), %rax
+	je	.L1256
+	movq	4296(%rsp), %rax
+.L1256:
+	cmpq	%r9, %r8
+	movq	%r9, %r10
+	cmovbe	%r8, %r10
+	testq	%r10, %r10
+	je	.L1257
+	movq	56(%rsp), %rdi
+	addq	%rdx, %rsi
+	movq	%r10, %rdx
+	movq	%r9, 80(%rsp)
+	movq	%r8, 72(%rsp)
+	addq	%rax, %rdi
+	movq	%rcx, 64(%rsp)
+	call	memcmp@PLT
+	movq	64(%rsp), %rcx
+	movq	72(%rsp), %r8
+	testl	%eax, %eax
+	movq	80(%rsp), %r9
+	je	.L1257
+	jns	.L1253
+.L1271:
+	movq	%rcx, %rbp
+	movq	8(%rbp), %rax
+	cmpq	$23, %rax
+	jne	.L1311
+	jmp	.L1250
+	.p2align 4,,10
+	.p2align 3
+.L1305:
+	movq	%rcx, 16(%rbx)
+	movups	%xmm1, (%rbx)
+	jmp	.L1218
+	.p2align 4,,10
+	.p2align 3
+.L1304:
+	movdqu	24(%rdx), %xmm4
+	movq	40(%rdx), %rax
+	movq	$0, (%rdx)
+	movb	$0, 24(%rdx)
+	movq	%rax, 136(%rsp)
+	movups	%xmm4, 120(%rsp)
+	cmpq	%rbx, %rdx
+	jne	.L1215
+	movq	%rcx, 16(%rbx)
+	movups	%xmm1, (%rbx)
+.L1217:
+	movdqu	120(%rsp), %xmm5
+	movq	136(%rsp), %rax
+	movups	%xmm5, 24(%rbx)
+	movq	%rax, 40(%rbx)
+	jmp	.L1224
+	.p2align 4,,10
+	.p2align 3
+.L1303:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1212
+.L1300:
+	movq	(%rdx), %rcx
+	jmp	.L1211
+	.p2align 4,,10
+	.p2align 3
+.L1306:
+	movdqu	24(%rbx), %xmm6
+	movups	%xmm6, 24(%rdx)
+	movq	40(%rbx), %rax
+	movq	%rax, 40(%rdx)
+	movq	8(%rbx), %rdx
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+	cmpq	$23, %rdx
+	je	.L1220
+	movq	16(%rbx), %rdi
+	movq	24(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB52:
+	call	*24(%rax)
+.LEHE52:
+	jmp	.L1220
+	.p2align 4,,10
+	.p2align 3
+.L1212:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rdx, 48(%rsp)
+	call	__cxa_guard_acquire@PLT
+	movq	48(%rsp), %rdx
+	testl	%eax, %eax
+	je	.L1300
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rdx, 48(%rsp)
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movq	48(%rsp), %rdx
+	jmp	.L1300
+	.p2align 4,,10
+	.p2align 3
+.L1269:
+	movq	%r12, %r15
+	jmp	.L1230
+.L1257:
+	cmpq	%r8, %r9
+	jb	.L1271
+.L1253:
+	movq	-40(%rbp), %rax
+	cmpq	$23, %rax
+	je	.L1260
+	movq	-32(%rbp), %rdi
+	leaq	1(%rax), %rdx
+	movq	-24(%rbp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB53:
+	call	*24(%rax)
+.LEHE53:
+.L1260:
+	movdqa	16(%rsp), %xmm7
+	movq	48(%rsp), %rax
+	cmpq	$23, 32(%rsp)
+	movq	%rax, -32(%rbp)
+	movups	%xmm7, -48(%rbp)
+	je	.L1312
+	movq	4296(%rsp), %rax
+	addq	$48, %rbx
+	movq	%rax, -24(%rbp)
+	cmpq	%r14, %rbx
+	jb	.L1263
+.L1199:
+	addq	$6344, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L1310:
+	.cfi_restore_state
+	movdqu	-24(%rbp), %xmm7
+	movq	-8(%rbp), %rax
+	movups	%xmm7, 24(%rbp)
+	movq	%rax, 40(%rbp)
+	jmp	.L1252
+.L1309:
+	movdqu	24(%rbx), %xmm7
+	movq	40(%rbx), %rax
+	movups	%xmm7, 4296(%rsp)
+	movq	%rax, 4312(%rsp)
+	jmp	.L1249
+.L1244:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1246
+.L1301:
+	movdqu	(%rbx), %xmm7
+	movq	8(%rbx), %rax
+	movq	(%rbx), %r12
+	movq	%rax, 8(%rsp)
+	movaps	%xmm7, 16(%rsp)
+	jmp	.L1245
+.L1312:
+	movdqu	4296(%rsp), %xmm7
+	movq	4312(%rsp), %rax
+	movups	%xmm7, -24(%rbp)
+	movq	%rax, -8(%rbp)
+	jmp	.L1242
+.L1246:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1301
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1301
+.L1273:
+	movq	%rax, %rbx
+	jmp	.L1264
+.L1272:
+	movq	%rax, %rbx
+	jmp	.L1221
+.L1264:
+	cmpq	$23, 8(%rsp)
+	je	.L1265
+	movq	48(%rsp), %rdi
+	movq	8(%rsp), %rdx
+	movl	$1, %ecx
+	movq	4296(%rsp), %rsi
+	movq	(%rdi), %rax
+	addq	$1, %rdx
+	call	*24(%rax)
+.L1265:
+	movq	%rbx, %rdi
+.LEHB54:
+	call	_Unwind_Resume@PLT
+.LEHE54:
+.L1221:
+	cmpq	$23, 56(%rsp)
+	je	.L1265
+	movq	48(%rsp), %rdi
+	movq	56(%rsp), %rdx
+	movl	$1, %ecx
+	movq	120(%rsp), %rsi
+	movq	(%rdi), %rax
+	addq	$1, %rdx
+	call	*24(%rax)
+	jmp	.L1265
+	.cfi_endproc
+.LFE7052:
+	.section	.gcc_except_table
+.LLSDA7052:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7052-.LLSDACSB7052
+.LLSDACSB7052:
+	.uleb128 .LEHB50-.LFB7052
+	.uleb128 .LEHE50-.LEHB50
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB51-.LFB7052
+	.uleb128 .LEHE51-.LEHB51
+	.uleb128 .L1273-.LFB7052
+	.uleb128 0
+	.uleb128 .LEHB52-.LFB7052
+	.uleb128 .LEHE52-.LEHB52
+	.uleb128 .L1272-.LFB7052
+	.uleb128 0
+	.uleb128 .LEHB53-.LFB7052
+	.uleb128 .LEHE53-.LEHB53
+	.uleb128 .L1273-.LFB7052
+	.uleb128 0
+	.uleb128 .LEHB54-.LFB7052
+	.uleb128 .LEHE54-.LEHB54
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE7052:
+	.section	.text._ZN1n10__msd_sortIcEEvPNS_6stringIT_EEmm,"axG",@progbits,_ZN1n10__msd_sortIcEEvPNS_6stringIT_EEmm,comdat
+	.size	_ZN1n10__msd_sortIcEEvPNS_6stringIT_EEmm, .-_ZN1n10__msd_sortIcEEvPNS_6stringIT_EEmm
+	.section	.text._ZN1n10__msd_sortIwEEvPNS_6stringIT_EEmm,"axG",@progbits,_ZN1n10__msd_sortIwEEvPNS_6stringIT_EEmm,comdat
+	.p2align 4
+	.weak	_ZN1n10__msd_sortIwEEvPNS_6stringIT_EEmm
+	.type	_ZN1n10__msd_sortIwEEvPNS_6stringIT_EEmm, @function
+_ZN1n10__msd_sortIwEEvPNS_6stringIT_EEmm:
+.LFB7064:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7064
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$6360, %rsp
+	.cfi_def_cfa_offset 6416
+	movq	%rdx, 64(%rsp)
+	cmpq	$32, %rsi
+	jbe	.L1314
+	leaq	160(%rsp), %rax
+	movq	%rax, 88(%rsp)
+	leaq	2224(%rsp), %rax
+	movq	%rax, 96(%rsp)
+	leaq	4288(%rsp), %rax
+	movq	%rax, 80(%rsp)
+.L1347:
+	movq	88(%rsp), %rdi
+	xorl	%eax, %eax
+	movl	$257, %ecx
+	leaq	(%r12,%r12,2), %rdx
+	salq	$4, %rdx
+	rep stosq
+	movq	64(%rsp), %rax
+	leaq	24(%r14,%rdx), %rsi
+	movq	%rax, %rdi
+	shrq	$2, %rdi
+	movq	%rdi, 32(%rsp)
+	movq	%rdi, %r9
+	movq	%rax, %rdi
+	notq	%rax
+	andl	$3, %eax
+	andq	$-4, %rdi
+	leal	0(,%rax,8), %ecx
+	leaq	24(%r14), %rax
+	movl	%ecx, 76(%rsp)
+.L1317:
+	movq	%rax, %r8
+	xorl	%edx, %edx
+	cmpq	-24(%rax), %r9
+	jnb	.L1315
+	cmpq	$5, -16(%rax)
+	je	.L1316
+	movq	(%rax), %r8
+.L1316:
+	movl	(%r8,%rdi), %edx
+	shrl	%cl, %edx
+	movzbl	%dl, %edx
+	addq	$1, %rdx
+.L1315:
+	addq	$1, 160(%rsp,%rdx,8)
+	addq	$48, %rax
+	cmpq	%rax, %rsi
+	jne	.L1317
+	movq	160(%rsp), %rax
+	movq	80(%rsp), %rcx
+	xorl	%edx, %edx
+	movq	96(%rsp), %rsi
+	movq	88(%rsp), %rdi
+	movq	%rax, 104(%rsp)
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L1318:
+	movq	%rdx, (%rsi,%rax,8)
+	addq	(%rdi,%rax,8), %rdx
+	movq	%rdx, (%rcx,%rax,8)
+	addq	$1, %rax
+	cmpq	$257, %rax
+	jne	.L1318
+	movq	96(%rsp), %rax
+	xorl	%r13d, %r13d
+	movq	%rax, (%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1319:
+	movq	(%rsp), %rax
+	movq	80(%rsp), %rdi
+	movq	(%rax), %rax
+	movq	(%rdi,%r13,8), %rsi
+	movq	%rsi, 24(%rsp)
+	cmpq	%rsi, %rax
+	jb	.L1339
+	jmp	.L1341
+	.p2align 4,,10
+	.p2align 3
+.L1424:
+	movq	(%rsp), %rsi
+	addq	$1, %rax
+	movq	%rax, (%rsi)
+	movq	24(%rsp), %rsi
+	cmpq	%rsi, %rax
+	jnb	.L1341
+.L1339:
+	leaq	(%rax,%rax,2), %rdx
+	xorl	%ebp, %ebp
+	salq	$4, %rdx
+	addq	%r14, %rdx
+	movq	(%rdx), %rsi
+	cmpq	%rsi, 32(%rsp)
+	jnb	.L1320
+	cmpq	$5, 8(%rdx)
+	leaq	24(%rdx), %rdi
+	je	.L1322
+	movq	24(%rdx), %rdi
+.L1322:
+	movq	64(%rsp), %rcx
+	andq	$-4, %rcx
+	movl	(%rdi,%rcx), %edi
+	movzbl	76(%rsp), %ecx
+	shrl	%cl, %edi
+	movzbl	%dil, %edi
+	leaq	1(%rdi), %rbp
+.L1320:
+	cmpq	%r13, %rbp
+	je	.L1424
+	movq	2224(%rsp,%rbp,8), %r12
+	movdqa	.LC35(%rip), %xmm2
+	leaq	(%r12,%r12,2), %rbx
+	movaps	%xmm2, 112(%rsp)
+	salq	$4, %rbx
+	addq	%r14, %rbx
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L1425
+.L1325:
+	movq	8(%rdx), %rax
+	movq	16(%rdx), %r15
+	movq	%rsi, %xmm1
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 144(%rsp)
+	movq	%rax, %xmm7
+	movq	%rax, 40(%rsp)
+	punpcklqdq	%xmm7, %xmm1
+	movq	%r15, 128(%rsp)
+	movaps	%xmm1, 48(%rsp)
+	movaps	%xmm1, 112(%rsp)
+	cmpq	$5, %rax
+	je	.L1426
+	movq	24(%rdx), %rax
+	movq	$5, 8(%rdx)
+	movq	$0, (%rdx)
+	movq	%rax, 136(%rsp)
+	movl	$0, 24(%rdx)
+	cmpq	%rbx, %rdx
+	je	.L1330
+.L1329:
+	movq	$0, (%rdx)
+	movdqu	(%rbx), %xmm0
+	movq	16(%rbx), %rax
+	movl	$0, 24(%rdx)
+	movhlps	%xmm0, %xmm4
+	movups	%xmm0, (%rdx)
+	movq	%rax, 16(%rdx)
+	movq	%xmm4, %rax
+	cmpq	$5, %rax
+	je	.L1427
+	movq	24(%rbx), %rax
+	movq	%rax, 24(%rdx)
+	movq	$5, 8(%rbx)
+	movq	$0, (%rbx)
+.L1333:
+	movdqa	48(%rsp), %xmm3
+	cmpq	$5, 40(%rsp)
+	movq	%r15, 16(%rbx)
+	movups	%xmm3, (%rbx)
+	je	.L1428
+	movq	136(%rsp), %rax
+	movq	%rax, 24(%rbx)
+.L1338:
+	movq	(%rsp), %rax
+	addq	$1, %r12
+	movq	24(%rsp), %rsi
+	movq	%r12, 2224(%rsp,%rbp,8)
+	movq	(%rax), %rax
+	cmpq	%rsi, %rax
+	jb	.L1339
+.L1341:
+	addq	$1, %r13
+	addq	$8, (%rsp)
+	cmpq	$257, %r13
+	jne	.L1319
+	movq	88(%rsp), %rcx
+	movq	168(%rsp), %r12
+	movl	$2, %eax
+	movl	$1, %r13d
+	.p2align 4,,10
+	.p2align 3
+.L1343:
+	movq	(%rcx,%rax,8), %rdx
+	cmpq	%rdx, %r12
+	jnb	.L1342
+	movq	%rdx, %r12
+	movq	%rax, %r13
+.L1342:
+	addq	$1, %rax
+	cmpq	$257, %rax
+	jne	.L1343
+	movq	%r12, (%rsp)
+	movq	%r14, %rax
+	movq	104(%rsp), %r12
+	xorl	%r15d, %r15d
+	addq	$1, 64(%rsp)
+	movq	88(%rsp), %r14
+	movl	$1, %ebx
+	jmp	.L1346
+	.p2align 4,,10
+	.p2align 3
+.L1344:
+	addq	$1, %rbx
+	addq	%rbp, %r12
+	cmpq	$257, %rbx
+	je	.L1429
+.L1346:
+	movq	(%r14,%rbx,8), %rbp
+	cmpq	%r13, %rbx
+	je	.L1386
+	cmpq	$1, %rbp
+	jbe	.L1344
+	leaq	(%r12,%r12,2), %rdi
+	movq	64(%rsp), %rdx
+	movq	%rbp, %rsi
+	addq	$1, %rbx
+	salq	$4, %rdi
+	movq	%rax, 24(%rsp)
+	addq	%rbp, %r12
+	addq	%rax, %rdi
+.LEHB55:
+	call	_ZN1n10__msd_sortIwEEvPNS_6stringIT_EEmm
+.LEHE55:
+	movq	24(%rsp), %rax
+	cmpq	$257, %rbx
+	jne	.L1346
+.L1429:
+	movq	%rax, %r14
+	movq	(%rsp), %r12
+	leaq	(%r15,%r15,2), %rax
+	salq	$4, %rax
+	addq	%rax, %r14
+	cmpq	$32, %r12
+	ja	.L1347
+.L1314:
+	leaq	(%r12,%r12,2), %rax
+	salq	$4, %rax
+	addq	%r14, %rax
+	movq	%rax, 24(%rsp)
+	cmpq	%r14, %rax
+	je	.L1313
+	leaq	48(%r14), %r12
+	cmpq	%rax, %r12
+	jnb	.L1313
+	movq	64(%rsp), %rbx
+	shrq	$2, %rbx
+.L1380:
+	movq	(%r12), %rdx
+	movq	-48(%r12), %rax
+	leaq	-24(%r12), %rsi
+	cmpq	%rdx, %rbx
+	movq	%rdx, %r9
+	movq	%rax, %rcx
+	cmovbe	%rbx, %r9
+	cmpq	%rax, %rbx
+	cmovbe	%rbx, %rcx
+	subq	%rcx, %rax
+	cmpq	$5, -40(%r12)
+	movq	%rax, %r8
+	je	.L1351
+	movq	-24(%r12), %rsi
+.L1351:
+	movq	8(%r12), %r13
+	movq	%rdx, %r10
+	leaq	24(%r12), %rdi
+	leaq	0(,%rcx,4), %r11
+	subq	%r9, %r10
+	cmpq	$5, %r13
+	je	.L1353
+	movq	24(%r12), %rdi
+.L1353:
+	cmpq	%r10, %r8
+	movq	%r10, %rcx
+	leaq	0(,%r9,4), %r15
+	cmovbe	%r8, %rcx
+	testq	%rcx, %rcx
+	je	.L1354
+	xorl	%eax, %eax
+	addq	%r15, %rdi
+	addq	%r11, %rsi
+	jmp	.L1358
+	.p2align 4,,10
+	.p2align 3
+.L1355:
+	addq	$1, %rax
+	cmpq	%rax, %rcx
+	je	.L1354
+.L1358:
+	movl	(%rsi,%rax,4), %r11d
+	cmpl	%r11d, (%rdi,%rax,4)
+	je	.L1355
+.L1421:
+	jnb	.L1357
+	movdqa	.LC35(%rip), %xmm7
+	movaps	%xmm7, 4288(%rsp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L1359
+	movq	%rdx, %xmm7
+	movq	%r13, %xmm5
+	movq	%rdx, %rax
+	punpcklqdq	%xmm5, %xmm7
+	movaps	%xmm7, (%rsp)
+.L1360:
+	movq	16(%r12), %rdi
+	movhlps	%xmm7, %xmm6
+	pxor	%xmm0, %xmm0
+	movaps	%xmm7, 4288(%rsp)
+	movq	%xmm6, %rcx
+	movq	%xmm6, 40(%rsp)
+	movq	%rdi, 32(%rsp)
+	movq	%rdi, 4304(%rsp)
+	movaps	%xmm0, 4320(%rsp)
+	cmpq	$5, %rcx
+	je	.L1430
+	movq	$5, 8(%r12)
+	movq	24(%r12), %rdx
+	movq	%rdx, 4312(%rsp)
+.L1364:
+	subq	%r9, %rax
+	movq	$0, (%r12)
+	movq	%r12, %rbp
+	movl	$0, 24(%r12)
+	movq	%rax, 48(%rsp)
+.L1365:
+	movq	8(%rbp), %rax
+	cmpq	$5, %rax
+	je	.L1366
+	movq	16(%rbp), %rdi
+	movq	24(%rbp), %rsi
+	movl	$4, %ecx
+	leaq	4(,%rax,4), %rdx
+	movq	(%rdi), %rax
+.LEHB56:
+	call	*24(%rax)
+	movq	$5, 8(%rbp)
+.L1366:
+	movq	-32(%rbp), %rax
+	movdqu	-48(%rbp), %xmm7
+	subq	$48, %rbp
+	movl	$0, 72(%rbp)
+	movq	%rax, 64(%rbp)
+	movq	8(%rbp), %rax
+	movups	%xmm7, 48(%rbp)
+	cmpq	$5, %rax
+	je	.L1431
+	movq	24(%rbp), %rax
+	movq	$5, 8(%rbp)
+	movq	%rax, 72(%rbp)
+.L1368:
+	movq	$0, 0(%rbp)
+	movl	$0, 24(%rbp)
+	cmpq	%r14, %rbp
+	je	.L1369
+	movq	-48(%rbp), %rdi
+	leaq	-24(%rbp), %r8
+	cmpq	%rdi, %rbx
+	movq	%rdi, %rax
+	cmovbe	%rbx, %rax
+	subq	%rax, %rdi
+	cmpq	$5, -40(%rbp)
+	je	.L1371
+	movq	-24(%rbp), %r8
+.L1371:
+	cmpq	$5, 40(%rsp)
+	leaq	0(,%rax,4), %rdx
+	leaq	4312(%rsp), %rcx
+	je	.L1372
+	movq	4312(%rsp), %rcx
+.L1372:
+	movq	48(%rsp), %rax
+	cmpq	%rax, %rdi
+	cmovbe	%rdi, %rax
+	movq	%rax, %rsi
+	testq	%rax, %rax
+	je	.L1373
+	xorl	%eax, %eax
+	addq	%r15, %rcx
+	addq	%r8, %rdx
+	jmp	.L1376
+	.p2align 4,,10
+	.p2align 3
+.L1374:
+	addq	$1, %rax
+	cmpq	%rax, %rsi
+	je	.L1373
+.L1376:
+	movl	(%rdx,%rax,4), %r10d
+	cmpl	%r10d, (%rcx,%rax,4)
+	je	.L1374
+.L1423:
+	jb	.L1365
+.L1369:
+	movq	8(%rbp), %rax
+	cmpq	$5, %rax
+	je	.L1377
+	movq	16(%rbp), %rdi
+	movq	24(%rbp), %rsi
+	movl	$4, %ecx
+	leaq	4(,%rax,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE56:
+.L1377:
+	movdqa	(%rsp), %xmm7
+	movq	32(%rsp), %rax
+	cmpq	$5, 40(%rsp)
+	movq	%rax, 16(%rbp)
+	movups	%xmm7, 0(%rbp)
+	je	.L1432
+	movq	4312(%rsp), %rax
+	movq	%rax, 24(%rbp)
+.L1357:
+	movq	24(%rsp), %rax
+	addq	$48, %r12
+	cmpq	%rax, %r12
+	jb	.L1380
+.L1313:
+	addq	$6360, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1426:
+	.cfi_restore_state
+	movdqu	24(%rdx), %xmm5
+	movq	40(%rdx), %rax
+	movq	$0, (%rdx)
+	movl	$0, 24(%rdx)
+	movq	%rax, 152(%rsp)
+	movups	%xmm5, 136(%rsp)
+	cmpq	%rbx, %rdx
+	jne	.L1329
+.L1330:
+	movq	8(%rbx), %rax
+.L1331:
+	cmpq	$5, %rax
+	je	.L1333
+	movq	16(%rbx), %rdi
+	movq	24(%rbx), %rsi
+	movl	$4, %ecx
+	leaq	4(,%rax,4), %rdx
+	movq	(%rdi), %rax
+.LEHB57:
+	call	*24(%rax)
+.LEHE57:
+	jmp	.L1333
+	.p2align 4,,10
+	.p2align 3
+.L1428:
+	movdqu	136(%rsp), %xmm6
+	movq	152(%rsp), %rax
+	movups	%xmm6, 24(%rbx)
+	movq	%rax, 40(%rbx)
+	jmp	.L1338
+	.p2align 4,,10
+	.p2align 3
+.L1425:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1326
+.L1420:
+	movq	(%rdx), %rsi
+	jmp	.L1325
+	.p2align 4,,10
+	.p2align 3
+.L1427:
+	movdqu	24(%rbx), %xmm7
+	movups	%xmm7, 24(%rdx)
+	movq	40(%rbx), %rax
+	movq	%rax, 40(%rdx)
+	movq	8(%rbx), %rax
+	movq	$0, (%rbx)
+	movl	$0, 24(%rbx)
+	jmp	.L1331
+	.p2align 4,,10
+	.p2align 3
+.L1326:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rdx, 40(%rsp)
+	call	__cxa_guard_acquire@PLT
+	movq	40(%rsp), %rdx
+	testl	%eax, %eax
+	je	.L1420
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rdx, 40(%rsp)
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movq	40(%rsp), %rdx
+	jmp	.L1420
+	.p2align 4,,10
+	.p2align 3
+.L1386:
+	movq	%r12, %r15
+	jmp	.L1344
+.L1354:
+	cmpq	%r8, %r10
+	jmp	.L1421
+.L1373:
+	cmpq	%rdi, 48(%rsp)
+	jmp	.L1423
+.L1431:
+	movdqu	24(%rbp), %xmm7
+	movq	40(%rbp), %rax
+	movups	%xmm7, 72(%rbp)
+	movq	%rax, 88(%rbp)
+	jmp	.L1368
+.L1430:
+	movdqu	24(%r12), %xmm7
+	movq	40(%r12), %rdx
+	movups	%xmm7, 4312(%rsp)
+	movq	%rdx, 4328(%rsp)
+	jmp	.L1364
+.L1359:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1361
+.L1422:
+	movdqu	(%r12), %xmm7
+	movq	%rbx, %r9
+	movq	8(%r12), %r13
+	movq	%xmm7, %rax
+	movaps	%xmm7, (%rsp)
+	cmpq	%rbx, %rax
+	cmovbe	%rax, %r9
+	leaq	0(,%r9,4), %r15
+	jmp	.L1360
+.L1432:
+	movdqu	4312(%rsp), %xmm7
+	movq	4328(%rsp), %rax
+	movups	%xmm7, 24(%rbp)
+	movq	%rax, 40(%rbp)
+	jmp	.L1357
+.L1361:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1422
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1422
+.L1389:
+	movq	%rax, %rbx
+	jmp	.L1381
+.L1388:
+	movq	%rax, %rbx
+	jmp	.L1334
+.L1381:
+	cmpq	$5, %r13
+	je	.L1382
+	movq	32(%rsp), %rdi
+	movq	4312(%rsp), %rsi
+	movl	$4, %ecx
+	leaq	4(,%r13,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1382:
+	movq	%rbx, %rdi
+.LEHB58:
+	call	_Unwind_Resume@PLT
+.LEHE58:
+.L1334:
+	cmpq	$5, 40(%rsp)
+	je	.L1382
+	movq	40(%rsp), %rax
+	movq	136(%rsp), %rsi
+	movl	$4, %ecx
+	movq	%r15, %rdi
+	leaq	4(,%rax,4), %rdx
+	movq	(%r15), %rax
+	call	*24(%rax)
+	jmp	.L1382
+	.cfi_endproc
+.LFE7064:
+	.section	.gcc_except_table
+.LLSDA7064:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7064-.LLSDACSB7064
+.LLSDACSB7064:
+	.uleb128 .LEHB55-.LFB7064
+	.uleb128 .LEHE55-.LEHB55
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB56-.LFB7064
+	.uleb128 .LEHE56-.LEHB56
+	.uleb128 .L1389-.LFB7064
+	.uleb128 0
+	.uleb128 .LEHB57-.LFB7064
+	.uleb128 .LEHE57-.LEHB57
+	.uleb128 .L1388-.LFB7064
+	.uleb128 0
+	.uleb128 .LEHB58-.LFB7064
+	.uleb128 .LEHE58-.LEHB58
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE7064:
+	.section	.text._ZN1n10__msd_sortIwEEvPNS_6stringIT_EEmm,"axG",@progbits,_ZN1n10__msd_sortIwEEvPNS_6stringIT_EEmm,comdat
+	.size	_ZN1n10__msd_sortIwEEvPNS_6stringIT_EEmm, .-_ZN1n10__msd_sortIwEEvPNS_6stringIT_EEmm
+	.section	.text.unlikely
+.LCOLDB37:
+	.text
+.LHOTB37:
+	.p2align 4
+	.globl	_Z28test_radix_sort_wide_stringsv
+	.type	_Z28test_radix_sort_wide_stringsv, @function
+_Z28test_radix_sort_wide_stringsv:
+.LFB6818:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6818
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$136, %rsp
+	.cfi_def_cfa_offset 192
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, 8(%rsp)
+	movq	%rax, 72(%rsp)
+	testq	%rax, %rax
+	je	.L1620
+.L1434:
+	movq	$0, 24(%rsp)
+	movq	$0, 16(%rsp)
+	movq	$0, 40(%rsp)
+	movq	$0, 48(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1508:
+	movdqa	.LC35(%rip), %xmm1
+	cmpq	$0, 8(%rsp)
+	movaps	%xmm1, 80(%rsp)
+	je	.L1621
+.L1438:
+	movabsq	$6364136223846793005, %rcx
+	imulq	seed(%rip), %rcx
+	movq	8(%rsp), %rax
+	pxor	%xmm0, %xmm0
+	movabsq	$1442695040888963407, %r15
+	movups	%xmm0, 104(%rsp)
+	movq	%rax, 96(%rsp)
+	movabsq	$-6148914691236517205, %rax
+	movq	$0, 120(%rsp)
+	addq	%r15, %rcx
+	movq	%rcx, %rsi
+	movq	%rcx, seed(%rip)
+	shrq	$33, %rsi
+	mulq	%rsi
+	shrq	$2, %rdx
+	leaq	(%rdx,%rdx,2), %rax
+	movq	%rsi, %rdx
+	addq	%rax, %rax
+	subq	%rax, %rdx
+	cmpl	%eax, %esi
+	je	.L1442
+	leal	19990(%rdx), %eax
+	movq	80(%rsp), %rsi
+	movq	88(%rsp), %r14
+	movl	$19990, %ebx
+	movl	%eax, (%rsp)
+	jmp	.L1452
+	.p2align 4,,10
+	.p2align 3
+.L1622:
+	movq	104(%rsp), %rax
+	addl	$1, %ebx
+	movl	%r12d, -4(%rax,%r13)
+	movq	%rbp, 80(%rsp)
+	movl	$0, (%rax,%r13)
+	cmpl	%ebx, (%rsp)
+	je	.L1442
+.L1451:
+	movq	seed(%rip), %rcx
+	movq	%rbp, %rsi
+.L1452:
+	movabsq	$6364136223846793005, %rax
+	leal	-19893(%rbx), %r12d
+	leaq	1(%rsi), %rbp
+	movabsq	$-6148914691236517205, %rdi
+	movabsq	$6148914691236517205, %rdx
+	imulq	%rax, %rcx
+	leaq	(%rcx,%r15), %rax
+	movq	%rax, seed(%rip)
+	shrq	$33, %rax
+	imulq	%rdi, %rax
+	cmpq	%rax, %rdx
+	cmovnb	%ebx, %r12d
+	cmpq	%r14, %rsi
+	je	.L1445
+.L1614:
+	leaq	0(,%rbp,4), %r13
+.L1446:
+	cmpq	$5, %r14
+	jne	.L1622
+	movl	%r12d, 100(%rsp,%r13)
+	addl	$1, %ebx
+	movq	%rbp, 80(%rsp)
+	movl	$0, 104(%rsp,%r13)
+	cmpl	%ebx, (%rsp)
+	jne	.L1451
+.L1442:
+	movq	16(%rsp), %rdi
+	cmpq	%rdi, 40(%rsp)
+	je	.L1623
+	movq	48(%rsp), %rax
+	movq	24(%rsp), %rdi
+	movdqa	.LC35(%rip), %xmm2
+	leaq	(%rax,%rdi), %rbx
+	movups	%xmm2, (%rbx)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L1624
+	movq	88(%rsp), %r15
+	pxor	%xmm0, %xmm0
+	movq	%rax, 16(%rbx)
+	movq	$0, 40(%rbx)
+	movq	80(%rsp), %r12
+	movups	%xmm0, 24(%rbx)
+	cmpq	$5, %r15
+	je	.L1555
+	movq	104(%rsp), %r14
+	movq	%r12, %rdx
+	xorl	%edi, %edi
+.L1540:
+	leaq	24(%rbx), %rbp
+	movl	$5, %r13d
+	cmpq	%rbp, %r14
+	jnb	.L1491
+	salq	$2, %rdi
+	cmpq	$5, %rdx
+	jbe	.L1503
+.L1537:
+	leaq	10(%r13,%r13), %r13
+	movq	(%rax), %rcx
+	movq	%rax, %rdi
+	cmpq	%rdx, %r13
+	cmovb	%rdx, %r13
+	movl	$4, %edx
+	leaq	4(,%r13,4), %rsi
+.LEHB59:
+	call	*16(%rcx)
+	movq	%rax, %rbp
+	movq	(%rbx), %rax
+	cmpq	$5, 8(%rbx)
+	leaq	24(%rbx), %rsi
+	leaq	4(,%rax,4), %rdx
+	je	.L1496
+	movq	24(%rbx), %rsi
+.L1496:
+	movq	%rbp, %rdi
+	call	memcpy@PLT
+	movq	8(%rbx), %rax
+	cmpq	$5, %rax
+	je	.L1497
+	movq	16(%rbx), %rdi
+	movq	24(%rbx), %rsi
+	movl	$4, %ecx
+	leaq	4(,%rax,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE59:
+.L1497:
+	movq	(%rbx), %rax
+	movq	%rbp, 24(%rbx)
+	movq	%r13, 8(%rbx)
+	leaq	0(,%rax,4), %rdi
+	cmpq	$5, %r13
+	je	.L1625
+.L1503:
+	leaq	0(,%r12,4), %rdx
+	addq	%rbp, %rdi
+	movq	%r14, %rsi
+	call	memmove@PLT
+	addq	(%rbx), %r12
+	addq	$1, 16(%rsp)
+	movq	%r12, (%rbx)
+	movl	$0, 0(%rbp,%r12,4)
+	cmpq	$5, %r15
+	je	.L1626
+.L1482:
+	movq	96(%rsp), %rdi
+	movq	104(%rsp), %rsi
+	movl	$4, %ecx
+	leaq	4(,%r15,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	addq	$48, 24(%rsp)
+	cmpq	$500, 16(%rsp)
+	je	.L1627
+.L1483:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L1508
+	.p2align 4,,10
+	.p2align 3
+.L1445:
+	cmpq	%rbp, %r14
+	jnb	.L1614
+	leaq	10(%r14,%r14), %rax
+	movq	8(%rsp), %rdi
+	movl	$4, %edx
+	cmpq	%rbp, %rax
+	cmovb	%rbp, %rax
+	movq	%rax, 56(%rsp)
+	leaq	4(,%rax,4), %rsi
+	movq	(%rdi), %rax
+.LEHB60:
+	call	*16(%rax)
+	movq	%rax, 32(%rsp)
+	leaq	0(,%rbp,4), %r13
+	cmpq	$5, %r14
+	je	.L1628
+	movq	104(%rsp), %rsi
+	movq	%rax, %rdi
+	movq	%r13, %rdx
+	movq	%rsi, 64(%rsp)
+	call	memcpy@PLT
+	movq	8(%rsp), %rdi
+	movq	64(%rsp), %rsi
+	leaq	4(,%r14,4), %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE60:
+.L1449:
+	movq	32(%rsp), %rax
+	movq	%rax, 104(%rsp)
+	movq	56(%rsp), %rax
+	movq	%rax, 88(%rsp)
+	movq	%rax, %r14
+	jmp	.L1446
+	.p2align 4,,10
+	.p2align 3
+.L1623:
+	movq	40(%rsp), %rax
+	movq	72(%rsp), %rdi
+	movl	$8, %edx
+	addq	$5, %rax
+	leaq	(%rax,%rax), %rcx
+	leaq	(%rcx,%rax), %rsi
+	movq	(%rdi), %rax
+	movq	%rcx, 8(%rsp)
+	salq	$5, %rsi
+.LEHB61:
+	call	*16(%rax)
+.LEHE61:
+	movq	24(%rsp), %rcx
+	movdqa	.LC35(%rip), %xmm3
+	movq	%rax, (%rsp)
+	leaq	(%rax,%rcx), %rbx
+	movups	%xmm3, (%rbx)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L1629
+	movq	88(%rsp), %r15
+	pxor	%xmm0, %xmm0
+	movq	%rax, 16(%rbx)
+	movq	$0, 40(%rbx)
+	movq	80(%rsp), %r14
+	movups	%xmm0, 24(%rbx)
+	cmpq	$5, %r15
+	je	.L1554
+	movq	104(%rsp), %r13
+	movq	%r14, %rdx
+	xorl	%edi, %edi
+.L1539:
+	leaq	24(%rbx), %rbp
+	movl	$5, %r12d
+	cmpq	%rbp, %r13
+	jnb	.L1462
+	salq	$2, %rdi
+	cmpq	$5, %rdx
+	jbe	.L1478
+.L1535:
+	leaq	10(%r12,%r12), %r12
+	movq	(%rax), %rcx
+	movq	%rax, %rdi
+	cmpq	%rdx, %r12
+	cmovb	%rdx, %r12
+	movl	$4, %edx
+	leaq	4(,%r12,4), %rsi
+.LEHB62:
+	call	*16(%rcx)
+.LEHE62:
+	movq	%rax, %rbp
+	movq	(%rbx), %rax
+	cmpq	$5, 8(%rbx)
+	leaq	4(,%rax,4), %rdx
+	je	.L1630
+	movq	24(%rbx), %rsi
+.L1469:
+	movq	%rbp, %rdi
+	call	memcpy@PLT
+	movq	8(%rbx), %rax
+	cmpq	$5, %rax
+	je	.L1470
+	movq	16(%rbx), %rdi
+	movq	24(%rbx), %rsi
+	movl	$4, %ecx
+	leaq	4(,%rax,4), %rdx
+	movq	(%rdi), %rax
+.LEHB63:
+	call	*24(%rax)
+.LEHE63:
+.L1470:
+	movq	(%rbx), %rax
+	movq	%rbp, 24(%rbx)
+	movq	%r12, 8(%rbx)
+	leaq	0(,%rax,4), %rdi
+	cmpq	$5, %r12
+	je	.L1631
+.L1478:
+	addq	%rbp, %rdi
+	leaq	0(,%r14,4), %rdx
+	movq	%r13, %rsi
+	call	memmove@PLT
+	movq	(%rbx), %rax
+	addq	%r14, %rax
+	cmpq	$0, 16(%rsp)
+	movq	%rax, (%rbx)
+	movl	$0, 0(%rbp,%rax,4)
+	jne	.L1632
+	cmpq	$0, 48(%rsp)
+	je	.L1633
+.L1481:
+	movq	40(%rsp), %rax
+	movq	72(%rsp), %rdi
+	movl	$8, %ecx
+	movq	48(%rsp), %rsi
+	leaq	(%rax,%rax,2), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+.LEHB64:
+	call	*24(%rax)
+.LEHE64:
+	movq	8(%rsp), %rax
+	addq	$1, 16(%rsp)
+	movq	%rax, 40(%rsp)
+	movq	(%rsp), %rax
+	movq	%rax, 48(%rsp)
+	cmpq	$5, %r15
+	jne	.L1482
+.L1626:
+	addq	$48, 24(%rsp)
+	cmpq	$500, 16(%rsp)
+	jne	.L1483
+	movq	48(%rsp), %rdi
+	xorl	%edx, %edx
+	movl	$500, %esi
+.LEHB65:
+	call	_ZN1n10__msd_sortIwEEvPNS_6stringIT_EEmm
+.LEHE65:
+	jmp	.L1509
+	.p2align 4,,10
+	.p2align 3
+.L1624:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1634
+.L1488:
+	pxor	%xmm0, %xmm0
+	movq	(%rbx), %rdi
+	movq	8(%rbx), %r13
+	leaq	104(%rsp), %r14
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	88(%rsp), %r15
+	movups	%xmm0, 24(%rbx)
+	movq	$0, 40(%rbx)
+	movq	80(%rsp), %r12
+	movq	%rax, 16(%rbx)
+	cmpq	$5, %r15
+	je	.L1490
+	movq	104(%rsp), %r14
+.L1490:
+	leaq	(%r12,%rdi), %rdx
+	xorl	%ebp, %ebp
+	cmpq	$5, %r13
+	je	.L1540
+.L1491:
+	salq	$2, %rdi
+	leaq	0(%rbp,%rdi), %rcx
+	cmpq	%rcx, %r14
+	jnb	.L1635
+	subq	%rbp, %r14
+	cmpq	%rdx, %r13
+	jnb	.L1551
+	leaq	10(%r13,%r13), %r13
+	movq	(%rax), %rcx
+	movq	%rax, %rdi
+	cmpq	%rdx, %r13
+	cmovb	%rdx, %r13
+	movl	$4, %edx
+	leaq	4(,%r13,4), %rsi
+.LEHB66:
+	call	*16(%rcx)
+	movq	%rax, %rbp
+	movq	(%rbx), %rax
+	cmpq	$5, 8(%rbx)
+	leaq	24(%rbx), %rsi
+	leaq	4(,%rax,4), %rdx
+	je	.L1500
+	movq	24(%rbx), %rsi
+.L1500:
+	movq	%rbp, %rdi
+	call	memcpy@PLT
+	movq	8(%rbx), %rax
+	cmpq	$5, %rax
+	je	.L1501
+	movq	16(%rbx), %rdi
+	movq	24(%rbx), %rsi
+	movl	$4, %ecx
+	leaq	4(,%rax,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE66:
+.L1501:
+	movq	(%rbx), %rax
+	movq	%rbp, 24(%rbx)
+	movq	%r13, 8(%rbx)
+	leaq	0(,%rax,4), %rdi
+.L1498:
+	cmpq	$5, %r13
+	jne	.L1616
+	leaq	24(%rbx), %rbp
+.L1616:
+	addq	%rbp, %r14
+	jmp	.L1503
+	.p2align 4,,10
+	.p2align 3
+.L1635:
+	cmpq	%rdx, %r13
+	jb	.L1537
+	xorl	%ebp, %ebp
+	cmpq	$5, %r13
+	jne	.L1503
+.L1625:
+	leaq	24(%rbx), %rbp
+	jmp	.L1503
+	.p2align 4,,10
+	.p2align 3
+.L1628:
+	leaq	104(%rsp), %rsi
+	movq	%r13, %rdx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L1449
+	.p2align 4,,10
+	.p2align 3
+.L1555:
+	movq	%r12, %rdx
+	xorl	%edi, %edi
+	leaq	104(%rsp), %r14
+	jmp	.L1540
+	.p2align 4,,10
+	.p2align 3
+.L1621:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1636
+.L1440:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L1438
+.L1629:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1637
+.L1459:
+	pxor	%xmm0, %xmm0
+	movq	(%rbx), %rdi
+	movq	8(%rbx), %r12
+	leaq	104(%rsp), %r13
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	88(%rsp), %r15
+	movups	%xmm0, 24(%rbx)
+	movq	$0, 40(%rbx)
+	movq	80(%rsp), %r14
+	movq	%rax, 16(%rbx)
+	cmpq	$5, %r15
+	je	.L1461
+	movq	104(%rsp), %r13
+.L1461:
+	leaq	(%r14,%rdi), %rdx
+	xorl	%ebp, %ebp
+	cmpq	$5, %r12
+	je	.L1539
+.L1462:
+	salq	$2, %rdi
+	leaq	0(%rbp,%rdi), %rcx
+	cmpq	%rcx, %r13
+	jnb	.L1638
+	subq	%rbp, %r13
+	cmpq	%rdx, %r12
+	jnb	.L1545
+	leaq	10(%r12,%r12), %r12
+	movq	(%rax), %rcx
+	movq	%rax, %rdi
+	cmpq	%rdx, %r12
+	cmovb	%rdx, %r12
+	movl	$4, %edx
+	leaq	4(,%r12,4), %rsi
+.LEHB67:
+	call	*16(%rcx)
+.LEHE67:
+	movq	%rax, %rbp
+	movq	(%rbx), %rax
+	cmpq	$5, 8(%rbx)
+	leaq	24(%rbx), %rsi
+	leaq	4(,%rax,4), %rdx
+	je	.L1474
+	movq	24(%rbx), %rsi
+.L1474:
+	movq	%rbp, %rdi
+	call	memcpy@PLT
+	movq	8(%rbx), %rax
+	cmpq	$5, %rax
+	je	.L1475
+	movq	16(%rbx), %rdi
+	movq	24(%rbx), %rsi
+	movl	$4, %ecx
+	leaq	4(,%rax,4), %rdx
+	movq	(%rdi), %rax
+.LEHB68:
+	call	*24(%rax)
+.LEHE68:
+.L1475:
+	movq	(%rbx), %rax
+	movq	%rbp, 24(%rbx)
+	movq	%r12, 8(%rbx)
+	leaq	0(,%rax,4), %rdi
+.L1472:
+	cmpq	$5, %r12
+	jne	.L1615
+	leaq	24(%rbx), %rbp
+.L1615:
+	addq	%rbp, %r13
+	jmp	.L1478
+	.p2align 4,,10
+	.p2align 3
+.L1638:
+	cmpq	%rdx, %r12
+	jb	.L1535
+	xorl	%ebp, %ebp
+	cmpq	$5, %r12
+	jne	.L1478
+.L1631:
+	leaq	24(%rbx), %rbp
+	jmp	.L1478
+	.p2align 4,,10
+	.p2align 3
+.L1632:
+	movq	24(%rsp), %rdx
+	movq	48(%rsp), %rsi
+	movq	(%rsp), %rdi
+	call	memcpy@PLT
+	jmp	.L1481
+	.p2align 4,,10
+	.p2align 3
+.L1554:
+	movq	%r14, %rdx
+	xorl	%edi, %edi
+	leaq	104(%rsp), %r13
+	jmp	.L1539
+	.p2align 4,,10
+	.p2align 3
+.L1633:
+	cmpq	$5, %r15
+	je	.L1639
+	movq	$1, 16(%rsp)
+	movq	(%rsp), %rax
+	movq	%rax, 48(%rsp)
+	movq	8(%rsp), %rax
+	movq	%rax, 40(%rsp)
+	jmp	.L1482
+.L1636:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1440
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1440
+.L1630:
+	leaq	24(%rbx), %rsi
+	jmp	.L1469
+.L1551:
+	xorl	%ebp, %ebp
+	jmp	.L1498
+.L1634:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1488
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1488
+.L1545:
+	xorl	%ebp, %ebp
+	jmp	.L1472
+.L1639:
+	movq	(%rsp), %rax
+	addq	$48, 24(%rsp)
+	movq	$1, 16(%rsp)
+	movq	%rax, 48(%rsp)
+	movq	8(%rsp), %rax
+	movq	%rax, 40(%rsp)
+	jmp	.L1483
+.L1637:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1459
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1459
+.L1627:
+	movq	48(%rsp), %rdi
+	xorl	%edx, %edx
+	movl	$500, %esi
+.LEHB69:
+	call	_ZN1n10__msd_sortIwEEvPNS_6stringIT_EEmm
+.LEHE69:
+.L1509:
+	movq	48(%rsp), %rax
+	movl	$1, %r10d
+	leaq	72(%rax), %rdi
+	.p2align 4,,10
+	.p2align 3
+.L1521:
+	cmpq	$5, -64(%rdi)
+	movq	-72(%rdi), %r8
+	movq	%rdi, %rdx
+	leaq	-48(%rdi), %rsi
+	je	.L1514
+	movq	-48(%rdi), %rsi
+.L1514:
+	cmpq	$5, -16(%rdi)
+	movq	-24(%rdi), %r9
+	je	.L1515
+	movq	(%rdi), %rdx
+.L1515:
+	cmpq	%r9, %r8
+	movq	%r9, %rcx
+	cmovbe	%r8, %rcx
+	testq	%rcx, %rcx
+	je	.L1516
+	xorl	%eax, %eax
+	jmp	.L1520
+	.p2align 4,,10
+	.p2align 3
+.L1517:
+	addq	$1, %rax
+	cmpq	%rax, %rcx
+	je	.L1516
+.L1520:
+	movl	(%rsi,%rax,4), %ebx
+	cmpl	%ebx, (%rdx,%rax,4)
+	je	.L1517
+.L1618:
+	jb	.L1518
+	addq	$1, %r10
+	addq	$48, %rdi
+	cmpq	$500, %r10
+	jne	.L1521
+	movq	48(%rsp), %rbx
+	xorl	%ebp, %ebp
+	.p2align 4,,10
+	.p2align 3
+.L1522:
+	movq	8(%rbx), %rax
+	cmpq	$5, %rax
+	je	.L1526
+	movq	16(%rbx), %rdi
+	addq	$1, %rbp
+	movq	24(%rbx), %rsi
+	addq	$48, %rbx
+	leaq	4(,%rax,4), %rdx
+	movl	$4, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	$500, %rbp
+	jne	.L1522
+.L1528:
+	cmpq	$0, 48(%rsp)
+	je	.L1433
+	movq	40(%rsp), %rax
+	movq	72(%rsp), %rdi
+	movl	$8, %ecx
+	movq	48(%rsp), %rsi
+	leaq	(%rax,%rax,2), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+	call	*24(%rax)
+.L1433:
+	addq	$136, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L1516:
+	.cfi_restore_state
+	cmpq	%r8, %r9
+	jmp	.L1618
+.L1526:
+	addq	$1, %rbp
+	addq	$48, %rbx
+	cmpq	$500, %rbp
+	jne	.L1522
+	jmp	.L1528
+.L1620:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1640
+.L1436:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	%rax, 72(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L1434
+.L1640:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1436
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1436
+.L1556:
+	movq	%rax, %rbx
+	jmp	.L1456
+.L1561:
+	movq	%rax, %rbx
+	jmp	.L1485
+.L1563:
+	movq	%rax, %rbx
+	jmp	.L1471
+.L1562:
+	movq	%rax, %rbx
+	jmp	.L1467
+.L1564:
+	movq	%rax, %rbx
+	jmp	.L1619
+.L1560:
+	movq	%rax, %rbx
+	jmp	.L1476
+.L1558:
+	movq	%rax, %rbx
+	jmp	.L1529
+.L1557:
+	movq	%rax, %rbx
+	jmp	.L1619
+.L1559:
+	movq	%rax, %rbx
+	jmp	.L1455
+	.section	.gcc_except_table
+.LLSDA6818:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6818-.LLSDACSB6818
+.LLSDACSB6818:
+	.uleb128 .LEHB59-.LFB6818
+	.uleb128 .LEHE59-.LEHB59
+	.uleb128 .L1556-.LFB6818
+	.uleb128 0
+	.uleb128 .LEHB60-.LFB6818
+	.uleb128 .LEHE60-.LEHB60
+	.uleb128 .L1556-.LFB6818
+	.uleb128 0
+	.uleb128 .LEHB61-.LFB6818
+	.uleb128 .LEHE61-.LEHB61
+	.uleb128 .L1559-.LFB6818
+	.uleb128 0
+	.uleb128 .LEHB62-.LFB6818
+	.uleb128 .LEHE62-.LEHB62
+	.uleb128 .L1562-.LFB6818
+	.uleb128 0
+	.uleb128 .LEHB63-.LFB6818
+	.uleb128 .LEHE63-.LEHB63
+	.uleb128 .L1563-.LFB6818
+	.uleb128 0
+	.uleb128 .LEHB64-.LFB6818
+	.uleb128 .LEHE64-.LEHB64
+	.uleb128 .L1561-.LFB6818
+	.uleb128 0
+	.uleb128 .LEHB65-.LFB6818
+	.uleb128 .LEHE65-.LEHB65
+	.uleb128 .L1557-.LFB6818
+	.uleb128 0
+	.uleb128 .LEHB66-.LFB6818
+	.uleb128 .LEHE66-.LEHB66
+	.uleb128 .L1556-.LFB6818
+	.uleb128 0
+	.uleb128 .LEHB67-.LFB6818
+	.uleb128 .LEHE67-.LEHB67
+	.uleb128 .L1558-.LFB6818
+	.uleb128 0
+	.uleb128 .LEHB68-.LFB6818
+	.uleb128 .LEHE68-.LEHB68
+	.uleb128 .L1560-.LFB6818
+	.uleb128 0
+	.uleb128 .LEHB69-.LFB6818
+	.uleb128 .LEHE69-.LEHB69
+	.uleb128 .L1564-.LFB6818
+	.uleb128 0
+.LLSDACSE6818:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6818
+	.type	_Z28test_radix_sort_wide_stringsv.cold, @function
+_Z28test_radix_sort_wide_stringsv.cold:
+.LFSB6818:
+.L1471:
+	.cfi_def_cfa_offset 192
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	8(%rsp), %rax
+	movq	%rax, 40(%rsp)
+	movq	(%rsp), %rax
+	movq	%rax, 48(%rsp)
+.L1456:
+	movq	88(%rsp), %rax
+	cmpq	$5, %rax
+	je	.L1511
+	movq	96(%rsp), %rdi
+	movq	104(%rsp), %rsi
+	movl	$4, %ecx
+	leaq	4(,%rax,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1511:
+	movq	48(%rsp), %rbp
+	xorl	%r12d, %r12d
+.L1531:
+	movq	16(%rsp), %rax
+	cmpq	%rax, %r12
+	je	.L1641
+	movq	8(%rbp), %rax
+	cmpq	$5, %rax
+	je	.L1532
+	movq	16(%rbp), %rdi
+	movq	24(%rbp), %rsi
+	movl	$4, %ecx
+	leaq	4(,%rax,4), %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1532:
+	addq	$1, %r12
+	addq	$48, %rbp
+	jmp	.L1531
+.L1485:
+	movq	8(%rsp), %rax
+	movq	%rax, 40(%rsp)
+	movq	(%rsp), %rax
+	movq	%rax, 48(%rsp)
+	jmp	.L1456
+.L1467:
+	movq	8(%rsp), %rax
+	movq	%rax, 40(%rsp)
+	movq	(%rsp), %rax
+	movq	%rax, 48(%rsp)
+	jmp	.L1456
+.L1565:
+	movq	%rax, %rbx
+.L1619:
+	movq	$500, 16(%rsp)
+	jmp	.L1511
+.L1476:
+	movq	8(%rsp), %rax
+	movq	%rax, 40(%rsp)
+	movq	(%rsp), %rax
+	movq	%rax, 48(%rsp)
+	jmp	.L1456
+.L1529:
+	movq	8(%rsp), %rax
+	movq	%rax, 40(%rsp)
+	movq	(%rsp), %rax
+	movq	%rax, 48(%rsp)
+	jmp	.L1456
+.L1518:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC0(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB70:
+	call	__cxa_throw@PLT
+.LEHE70:
+.L1455:
+	movq	8(%rsp), %rax
+	movq	%rax, 40(%rsp)
+	jmp	.L1456
+.L1641:
+	cmpq	$0, 48(%rsp)
+	je	.L1534
+	movq	72(%rsp), %rdi
+	imulq	$48, 40(%rsp), %rdx
+	movl	$8, %ecx
+	movq	48(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1534:
+	movq	%rbx, %rdi
+.LEHB71:
+	call	_Unwind_Resume@PLT
+.LEHE71:
+	.cfi_endproc
+.LFE6818:
+	.section	.gcc_except_table
+.LLSDAC6818:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6818-.LLSDACSBC6818
+.LLSDACSBC6818:
+	.uleb128 .LEHB70-.LCOLDB37
+	.uleb128 .LEHE70-.LEHB70
+	.uleb128 .L1565-.LCOLDB37
+	.uleb128 0
+	.uleb128 .LEHB71-.LCOLDB37
+	.uleb128 .LEHE71-.LEHB71
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6818:
+	.section	.text.unlikely
+	.text
+	.size	_Z28test_radix_sort_wide_stringsv, .-_Z28test_radix_sort_wide_stringsv
+	.section	.text.unlikely
+	.size	_Z28test_radix_sort_wide_stringsv.cold, .-_Z28test_radix_sort_wide_stringsv.cold
+.LCOLDE37:
+	.text
+.LHOTE37:
+	.section	.text._ZN1n4swapINS_6stringIcEEEEvRT_S4_,"axG",@progbits,_ZN1n4swapINS_6stringIcEEEEvRT_S4_,comdat
+	.p2align 4
+	.weak	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	.type	_ZN1n4swapINS_6stringIcEEEEvRT_S4_, @function
+_ZN1n4swapINS_6stringIcEEEEvRT_S4_:
+.LFB7086:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7086
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 112
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L1662
+.L1644:
+	movdqu	(%rbx), %xmm1
+	pxor	%xmm0, %xmm0
+	movq	16(%rbx), %r13
+	movaps	%xmm0, 48(%rsp)
+	movhlps	%xmm1, %xmm7
+	movaps	%xmm1, (%rsp)
+	movq	%xmm7, %r12
+	cmpq	$23, %r12
+	je	.L1663
+	movq	24(%rbx), %rax
+	movq	$23, 8(%rbx)
+	movq	$0, (%rbx)
+	movq	%rax, 40(%rsp)
+	movb	$0, 24(%rbx)
+	cmpq	%rbp, %rbx
+	je	.L1664
+.L1647:
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+	movq	0(%rbp), %rax
+	movq	16(%rbp), %rdx
+	movq	%rax, (%rbx)
+	movq	8(%rbp), %rax
+	movq	%rdx, 16(%rbx)
+	movq	%rax, 8(%rbx)
+	cmpq	$23, %rax
+	je	.L1665
+	movq	24(%rbp), %rax
+	movq	%rax, 24(%rbx)
+	movq	$23, 8(%rbp)
+	movq	$0, 0(%rbp)
+	movb	$0, 24(%rbp)
+.L1652:
+	movdqa	(%rsp), %xmm2
+	movq	%r13, 16(%rbp)
+	movups	%xmm2, 0(%rbp)
+	cmpq	$23, %r12
+	je	.L1649
+.L1650:
+	movq	40(%rsp), %rax
+	movq	%rax, 24(%rbp)
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1664:
+	.cfi_restore_state
+	movq	%r13, 16(%rbp)
+	movups	%xmm1, 0(%rbp)
+	jmp	.L1650
+	.p2align 4,,10
+	.p2align 3
+.L1663:
+	movdqu	24(%rbx), %xmm4
+	movq	40(%rbx), %rax
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+	movq	%rax, 56(%rsp)
+	movups	%xmm4, 40(%rsp)
+	cmpq	%rbp, %rbx
+	jne	.L1647
+	movq	8(%rbp), %rdx
+	cmpq	$23, %rdx
+	je	.L1666
+.L1648:
+	movq	16(%rbp), %rdi
+	movq	24(%rbp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB72:
+	call	*24(%rax)
+.LEHE72:
+	jmp	.L1652
+.L1666:
+	movq	%r13, 16(%rbp)
+	movups	%xmm1, 0(%rbp)
+.L1649:
+	movdqu	40(%rsp), %xmm5
+	movq	56(%rsp), %rax
+	movups	%xmm5, 24(%rbp)
+	movq	%rax, 40(%rbp)
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1662:
+	.cfi_restore_state
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L1644
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1644
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1644
+	.p2align 4,,10
+	.p2align 3
+.L1665:
+	movdqu	24(%rbp), %xmm6
+	movups	%xmm6, 24(%rbx)
+	movq	40(%rbp), %rax
+	movq	%rax, 40(%rbx)
+	movq	8(%rbp), %rdx
+	movq	$0, 0(%rbp)
+	movb	$0, 24(%rbp)
+	cmpq	$23, %rdx
+	jne	.L1648
+	jmp	.L1652
+.L1657:
+	movq	%rax, %rbx
+.L1653:
+	cmpq	$23, %r12
+	je	.L1655
+	movq	0(%r13), %rax
+	movq	40(%rsp), %rsi
+	leaq	1(%r12), %rdx
+	movq	%r13, %rdi
+	movl	$1, %ecx
+	call	*24(%rax)
+.L1655:
+	movq	%rbx, %rdi
+.LEHB73:
+	call	_Unwind_Resume@PLT
+.LEHE73:
+	.cfi_endproc
+.LFE7086:
+	.section	.gcc_except_table
+.LLSDA7086:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7086-.LLSDACSB7086
+.LLSDACSB7086:
+	.uleb128 .LEHB72-.LFB7086
+	.uleb128 .LEHE72-.LEHB72
+	.uleb128 .L1657-.LFB7086
+	.uleb128 0
+	.uleb128 .LEHB73-.LFB7086
+	.uleb128 .LEHE73-.LEHB73
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE7086:
+	.section	.text._ZN1n4swapINS_6stringIcEEEEvRT_S4_,"axG",@progbits,_ZN1n4swapINS_6stringIcEEEEvRT_S4_,comdat
+	.size	_ZN1n4swapINS_6stringIcEEEEvRT_S4_, .-_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	.section	.text.unlikely
+.LCOLDB38:
+	.text
+.LHOTB38:
+	.p2align 4
+	.type	_ZN1n9__pdqsortINS_6stringIcEENS_4lessEEEvPT_S5_RT0_ib.isra.0, @function
+_ZN1n9__pdqsortINS_6stringIcEENS_4lessEEEvPT_S5_RT0_ib.isra.0:
+.LFB7155:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7155
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rsi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	subq	%rdi, %r13
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%r13, %rax
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	sarq	$4, %rax
+	subq	$264, %rsp
+	.cfi_def_cfa_offset 320
+	movq	%rdi, 32(%rsp)
+	movabsq	$-6148914691236517205, %rdi
+	imulq	%rdi, %rax
+	movq	%rsi, 88(%rsp)
+	movl	%edx, 148(%rsp)
+	movb	%cl, 147(%rsp)
+	movq	%rax, 48(%rsp)
+	cmpq	$1104, %r13
+	jbe	.L1668
+	leaq	-48(%rsi), %rax
+	movq	%rax, 152(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1669:
+	movq	48(%rsp), %rax
+	movq	%rax, %rcx
+	andq	$-2, %rax
+	shrq	%rcx
+	addq	%rcx, %rax
+	movq	%rcx, 136(%rsp)
+	movq	32(%rsp), %rcx
+	salq	$4, %rax
+	leaq	(%rcx,%rax), %rbx
+	movq	%rax, 128(%rsp)
+	movq	(%rcx), %r12
+	movq	(%rbx), %rbp
+	movq	8(%rbx), %r14
+	movq	8(%rcx), %r15
+	cmpq	$6144, %r13
+	jbe	.L1730
+	leaq	24(%rcx), %rsi
+	cmpq	$23, %r15
+	je	.L1732
+	movq	24(%rcx), %rsi
+.L1732:
+	cmpq	$23, %r14
+	je	.L2422
+	cmpq	%r12, %rbp
+	movq	%r12, %rdx
+	movq	24(%rbx), %rax
+	cmovbe	%rbp, %rdx
+	movq	%rax, %rdi
+	testq	%rdx, %rdx
+	je	.L1738
+.L1735:
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L1739
+	cmpq	%r12, %rbp
+	jnb	.L1740
+.L1737:
+	movq	32(%rsp), %rdi
+	movq	%rbx, %rsi
+.LEHB74:
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	(%rbx), %rbp
+	movq	8(%rbx), %r14
+.L1740:
+	cmpq	$23, %r14
+	je	.L1736
+	movq	24(%rbx), %rax
+.L1741:
+	movq	%rax, %rsi
+.L1742:
+	movq	88(%rsp), %rax
+	cmpq	$23, -40(%rax)
+	movq	-48(%rax), %r12
+	leaq	-24(%rax), %rdi
+	je	.L1744
+	movq	-24(%rax), %rdi
+.L1744:
+	cmpq	%rbp, %r12
+	movq	%rbp, %rdx
+	cmovbe	%r12, %rdx
+	testq	%rdx, %rdx
+	je	.L1745
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L1745
+	js	.L1748
+.L1747:
+	movq	32(%rsp), %rax
+	cmpq	$23, 8(%rax)
+	movq	(%rax), %r12
+	leaq	24(%rax), %rsi
+	je	.L1750
+	movq	24(%rax), %rsi
+.L1750:
+	leaq	24(%rbx), %rdi
+	cmpq	$23, %r14
+	je	.L1752
+	movq	24(%rbx), %rdi
+.L1752:
+	cmpq	%r12, %rbp
+	movq	%r12, %rdx
+	cmovbe	%rbp, %rdx
+	testq	%rdx, %rdx
+	je	.L1753
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L1753
+	js	.L1756
+.L1755:
+	movq	32(%rsp), %rax
+	movq	128(%rsp), %rcx
+	cmpq	$23, 56(%rax)
+	movq	48(%rax), %r15
+	leaq	-48(%rax,%rcx), %rbp
+	leaq	48(%rax), %r12
+	je	.L2423
+	movq	72(%rax), %rax
+.L1758:
+	movq	8(%rbp), %r14
+	movq	0(%rbp), %r13
+	cmpq	$23, %r14
+	je	.L2424
+	cmpq	%r13, %r15
+	movq	%r13, %rdx
+	movq	24(%rbp), %rsi
+	cmovbe	%r15, %rdx
+	movq	%rsi, %rdi
+	testq	%rdx, %rdx
+	je	.L1764
+.L1761:
+	movq	%rax, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L1765
+	cmpq	%r15, %r13
+	jnb	.L1766
+.L1763:
+	movq	%rbp, %rsi
+	movq	%r12, %rdi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	0(%rbp), %r13
+	movq	8(%rbp), %r14
+.L1766:
+	cmpq	$23, %r14
+	je	.L1762
+	movq	24(%rbp), %rsi
+.L1768:
+	movq	88(%rsp), %rax
+	cmpq	$23, -88(%rax)
+	movq	-96(%rax), %r15
+	leaq	-72(%rax), %rdi
+	je	.L1770
+	movq	-72(%rax), %rdi
+.L1770:
+	cmpq	%r13, %r15
+	movq	%r13, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L1771
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L1771
+	js	.L1774
+.L1773:
+	movq	32(%rsp), %rax
+	cmpq	$23, 56(%rax)
+	movq	48(%rax), %r15
+	leaq	72(%rax), %rsi
+	je	.L1776
+	movq	72(%rax), %rsi
+.L1776:
+	leaq	24(%rbp), %rdi
+	cmpq	$23, %r14
+	je	.L1778
+	movq	24(%rbp), %rdi
+.L1778:
+	cmpq	%r13, %r15
+	movq	%r13, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L1779
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L1779
+	js	.L1782
+.L1781:
+	movq	32(%rsp), %rax
+	movq	128(%rsp), %rcx
+	cmpq	$23, 104(%rax)
+	leaq	48(%rax,%rcx), %r13
+	leaq	96(%rax), %rcx
+	movq	96(%rax), %r12
+	movq	%rcx, (%rsp)
+	je	.L2425
+	movq	120(%rax), %rax
+.L1784:
+	movq	8(%r13), %r15
+	movq	0(%r13), %r14
+	cmpq	$23, %r15
+	je	.L2426
+	cmpq	%r14, %r12
+	movq	%r14, %rdx
+	movq	24(%r13), %rsi
+	cmovbe	%r12, %rdx
+	movq	%rsi, %rdi
+	testq	%rdx, %rdx
+	je	.L1790
+.L1787:
+	movq	%rax, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L1791
+	cmpq	%r12, %r14
+	jnb	.L1792
+.L1789:
+	movq	(%rsp), %rdi
+	movq	%r13, %rsi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	0(%r13), %r14
+	movq	8(%r13), %r15
+.L1792:
+	cmpq	$23, %r15
+	je	.L1788
+	movq	24(%r13), %rsi
+.L1794:
+	movq	88(%rsp), %rax
+	cmpq	$23, -136(%rax)
+	movq	-144(%rax), %r12
+	leaq	-120(%rax), %rdi
+	je	.L1796
+	movq	-120(%rax), %rdi
+.L1796:
+	cmpq	%r14, %r12
+	movq	%r14, %rdx
+	cmovbe	%r12, %rdx
+	testq	%rdx, %rdx
+	je	.L1797
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L1797
+	js	.L1800
+.L1799:
+	movq	32(%rsp), %rax
+	cmpq	$23, 104(%rax)
+	movq	96(%rax), %r12
+	leaq	120(%rax), %rsi
+	je	.L1802
+	movq	120(%rax), %rsi
+.L1802:
+	leaq	24(%r13), %rdi
+	cmpq	$23, %r15
+	je	.L1804
+	movq	24(%r13), %rdi
+.L1804:
+	cmpq	%r12, %r14
+	movq	%r12, %rdx
+	cmovbe	%r14, %rdx
+	testq	%rdx, %rdx
+	je	.L1805
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L1805
+	js	.L1808
+.L1807:
+	cmpq	$23, 8(%rbp)
+	movq	0(%rbp), %r15
+	leaq	24(%rbp), %rsi
+	je	.L1810
+	movq	24(%rbp), %rsi
+.L1810:
+	movq	8(%rbx), %r14
+	movq	(%rbx), %r12
+	cmpq	$23, %r14
+	je	.L2427
+	cmpq	%r12, %r15
+	movq	%r12, %rdx
+	movq	24(%rbx), %rax
+	cmovbe	%r15, %rdx
+	movq	%rax, %rdi
+	testq	%rdx, %rdx
+	je	.L1816
+.L1813:
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L1817
+	cmpq	%r15, %r12
+	jnb	.L1818
+.L1815:
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+.LEHE74:
+	movq	(%rbx), %r12
+	movq	8(%rbx), %r14
+.L1818:
+	cmpq	$23, %r14
+	je	.L1814
+	movq	24(%rbx), %rax
+.L1819:
+	movq	%rax, %rsi
+.L1820:
+	cmpq	$23, 8(%r13)
+	movq	0(%r13), %r15
+	leaq	24(%r13), %rdi
+	je	.L1822
+	movq	24(%r13), %rdi
+.L1822:
+	cmpq	%r12, %r15
+	movq	%r12, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L1823
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L1823
+	js	.L1826
+.L1825:
+	cmpq	$23, 8(%rbp)
+	movq	0(%rbp), %r13
+	leaq	24(%rbp), %rsi
+	je	.L1828
+	movq	24(%rbp), %rsi
+.L1828:
+	leaq	24(%rbx), %rdi
+	cmpq	$23, %r14
+	je	.L1830
+	movq	24(%rbx), %rdi
+.L1830:
+	cmpq	%r12, %r13
+	movq	%r12, %rdx
+	cmovbe	%r13, %rdx
+	testq	%rdx, %rdx
+	je	.L1831
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L1831
+	js	.L1834
+.L1833:
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L2428
+.L1836:
+	movq	32(%rsp), %rax
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 240(%rsp)
+	movdqu	(%rax), %xmm5
+	movq	8(%rax), %r13
+	movq	%rax, %rcx
+	movq	16(%rax), %r12
+	movhlps	%xmm5, %xmm3
+	movaps	%xmm5, (%rsp)
+	movq	%xmm3, %rbp
+	cmpq	$23, %rbp
+	je	.L2429
+	movq	24(%rax), %rax
+	movq	$23, 8(%rcx)
+	movq	$0, (%rcx)
+	movq	%rax, 232(%rsp)
+	movb	$0, 24(%rcx)
+	cmpq	%rbx, %rcx
+	je	.L1841
+.L1839:
+	movq	32(%rsp), %rcx
+	movq	$0, (%rcx)
+	movb	$0, 24(%rcx)
+	movq	(%rbx), %rax
+	movq	16(%rbx), %rdx
+	movq	%rax, (%rcx)
+	movq	8(%rbx), %rax
+	movq	%rdx, 16(%rcx)
+	movq	%rax, 8(%rcx)
+	cmpq	$23, %rax
+	je	.L2430
+	movq	24(%rbx), %rax
+	movq	%rax, 24(%rcx)
+	movq	$23, 8(%rbx)
+.L1843:
+	movq	8(%rbx), %rax
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+	cmpq	$23, %rax
+	je	.L1844
+.L2165:
+	movq	16(%rbx), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%rbx), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB75:
+	call	*24(%rax)
+.LEHE75:
+.L1844:
+	movdqa	(%rsp), %xmm7
+	movq	%r12, 16(%rbx)
+	movups	%xmm7, (%rbx)
+	cmpq	$23, %rbp
+	je	.L2164
+.L1848:
+	movq	232(%rsp), %rax
+	movq	%rax, 24(%rbx)
+.L1850:
+	cmpb	$0, 147(%rsp)
+	jne	.L1876
+	movq	32(%rsp), %rax
+	movdqu	(%rax), %xmm5
+	movhlps	%xmm5, %xmm3
+	movaps	%xmm5, 64(%rsp)
+	movq	%xmm5, %r15
+	movq	%xmm3, %rax
+	movq	%xmm3, 16(%rsp)
+	cmpq	$23, %rax
+	movq	32(%rsp), %rax
+	leaq	24(%rax), %rsi
+	je	.L1878
+	movq	24(%rax), %rsi
+.L1878:
+	cmpq	$23, -40(%rax)
+	movq	-48(%rax), %rbx
+	leaq	-24(%rax), %rdi
+	je	.L1880
+	movq	-24(%rax), %rdi
+.L1880:
+	cmpq	%rbx, %r15
+	movq	%rbx, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L1881
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L1881
+	jns	.L1883
+.L1876:
+	movdqa	.LC33(%rip), %xmm6
+	movaps	%xmm6, 160(%rsp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L2431
+.L1948:
+	movq	32(%rsp), %rax
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 192(%rsp)
+	movdqu	(%rax), %xmm6
+	movq	16(%rax), %rax
+	movhlps	%xmm6, %xmm5
+	movq	%rax, 176(%rsp)
+	movq	%xmm6, %r15
+	movq	%xmm5, %rbp
+	movaps	%xmm6, 16(%rsp)
+	movq	%xmm5, 40(%rsp)
+	movaps	%xmm6, 160(%rsp)
+	cmpq	$23, %rbp
+	je	.L2432
+	movq	32(%rsp), %rax
+	movq	24(%rax), %rcx
+	movq	$23, 8(%rax)
+	movq	%rcx, 64(%rsp)
+	movq	%rcx, 184(%rsp)
+.L1951:
+	leaq	184(%rsp), %rcx
+	cmpq	$23, %rbp
+	movb	$0, 24(%rax)
+	movq	%rax, %r13
+	movq	%rcx, %rbx
+	movq	%rcx, 80(%rsp)
+	cmovne	64(%rsp), %rbx
+	movq	$0, (%rax)
+	movq	%rbp, 96(%rsp)
+	movq	%rbx, %rbp
+	.p2align 4,,10
+	.p2align 3
+.L2325:
+	movq	%r13, %rbx
+	movdqu	48(%r13), %xmm2
+	addq	$48, %r13
+	leaq	24(%r13), %rdi
+	movhlps	%xmm2, %xmm4
+	movaps	%xmm2, (%rsp)
+	movq	%xmm2, %r12
+	movq	%xmm4, %r14
+	cmpq	$23, %r14
+	je	.L1953
+	movq	24(%r13), %rdi
+.L1953:
+	cmpq	%r12, %r15
+	movq	%r12, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L1954
+	movq	%rbp, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L1954
+	js	.L2325
+	.p2align 4,,10
+	.p2align 3
+.L1956:
+	movq	88(%rsp), %rax
+	movq	%r14, %r12
+	movq	%rbx, %r14
+	movq	%rbp, %rbx
+	movq	96(%rsp), %rbp
+	movq	%r13, 104(%rsp)
+	movq	%rax, 96(%rsp)
+	movq	32(%rsp), %rax
+	movq	8(%r13), %r13
+	cmpq	%rax, %r14
+	je	.L2433
+	movq	%r12, 120(%rsp)
+	movq	%rbp, 112(%rsp)
+	movq	%r15, %rbp
+	movq	%rbx, %r15
+	movq	96(%rsp), %rbx
+	.p2align 4,,10
+	.p2align 3
+.L2311:
+	subq	$48, %rbx
+	movq	(%rbx), %r12
+	cmpq	$23, 8(%rbx)
+	leaq	24(%rbx), %rdi
+	je	.L1969
+	movq	24(%rbx), %rdi
+.L1969:
+	cmpq	%rbp, %r12
+	movq	%rbp, %rdx
+	cmovbe	%r12, %rdx
+	testq	%rdx, %rdx
+	je	.L1970
+	movq	%r15, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L1970
+	jns	.L2311
+	.p2align 4,,10
+	.p2align 3
+.L2412:
+	movq	%rbx, 96(%rsp)
+	movq	112(%rsp), %rbp
+	movq	%rbx, %rax
+	movq	120(%rsp), %r12
+.L1967:
+	movq	104(%rsp), %rbx
+	cmpq	%rax, %rbx
+	jnb	.L2175
+	movq	%rax, %rbp
+	.p2align 4,,10
+	.p2align 3
+.L2000:
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L2434
+.L1972:
+	pxor	%xmm0, %xmm0
+	movq	16(%rbx), %r14
+	movaps	%xmm0, 240(%rsp)
+	cmpq	$23, %r12
+	je	.L2435
+	movq	24(%rbx), %rax
+	movq	$23, 8(%rbx)
+	movq	$0, (%rbx)
+	movq	%rax, 232(%rsp)
+	movb	$0, 24(%rbx)
+	cmpq	%rbp, %rbx
+	je	.L2436
+.L1976:
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+	movq	0(%rbp), %rax
+	movq	16(%rbp), %rdx
+	movq	%rax, (%rbx)
+	movq	8(%rbp), %rax
+	movq	%rdx, 16(%rbx)
+	movq	%rax, 8(%rbx)
+	cmpq	$23, %rax
+	je	.L2437
+	movq	24(%rbp), %rax
+	movq	%rax, 24(%rbx)
+	movq	$23, 8(%rbp)
+	movq	$0, 0(%rbp)
+	movb	$0, 24(%rbp)
+.L1982:
+	movdqa	(%rsp), %xmm4
+	movq	%r14, 16(%rbp)
+	movups	%xmm4, 0(%rbp)
+	cmpq	$23, %r12
+	je	.L1980
+.L1979:
+	movq	232(%rsp), %rax
+	movq	%rax, 24(%rbp)
+.L1986:
+	movq	80(%rsp), %r13
+	movq	184(%rsp), %rax
+	movq	%rbp, 16(%rsp)
+	cmpq	$23, 40(%rsp)
+	movq	160(%rsp), %r15
+	cmovne	%rax, %r13
+	movq	%rax, 64(%rsp)
+	movq	%r13, %rbp
+	.p2align 4,,10
+	.p2align 3
+.L2327:
+	movq	%rbx, %r13
+	movdqu	48(%rbx), %xmm1
+	addq	$48, %rbx
+	leaq	24(%rbx), %rdi
+	movhlps	%xmm1, %xmm6
+	movaps	%xmm1, (%rsp)
+	movq	%xmm1, %r12
+	movq	%xmm6, %r14
+	cmpq	$23, %r14
+	je	.L1990
+	movq	24(%rbx), %rdi
+.L1990:
+	cmpq	%r12, %r15
+	movq	%r12, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L1991
+	movq	%rbp, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L1991
+	js	.L2327
+	.p2align 4,,10
+	.p2align 3
+.L2408:
+	movq	%rbx, %r12
+	movq	%rbp, %rbx
+	movq	16(%rsp), %rbp
+	movq	%r14, 16(%rsp)
+	movq	%r13, %r14
+.L2326:
+	subq	$48, %rbp
+	movq	0(%rbp), %r13
+	cmpq	$23, 8(%rbp)
+	leaq	24(%rbp), %rdi
+	je	.L1995
+	movq	24(%rbp), %rdi
+.L1995:
+	cmpq	%r13, %r15
+	movq	%r13, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L1996
+	movq	%rbx, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L1996
+	jns	.L2326
+	.p2align 4,,10
+	.p2align 3
+.L2413:
+	movq	%r12, %rbx
+	movq	16(%rsp), %r12
+	movq	8(%rbx), %r13
+	cmpq	%rbp, %rbx
+	jb	.L2000
+	movq	40(%rsp), %rbp
+	movq	%r15, %xmm3
+	movq	%rbp, %xmm7
+	punpcklqdq	%xmm7, %xmm3
+	movaps	%xmm3, 16(%rsp)
+.L1961:
+	cmpq	%r14, 32(%rsp)
+	je	.L2163
+	.p2align 4,,10
+	.p2align 3
+.L2001:
+	movq	32(%rsp), %r15
+	movq	8(%r15), %rax
+	cmpq	$23, %rax
+	je	.L2003
+	movq	16(%r15), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%r15), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB76:
+	call	*24(%rax)
+.LEHE76:
+	movq	$23, 8(%r15)
+.L2003:
+	movq	32(%rsp), %rcx
+	movq	$0, (%rcx)
+	movb	$0, 24(%rcx)
+	movq	-48(%rbx), %rax
+	movq	-32(%rbx), %rdx
+	movq	%rax, (%rcx)
+	movq	-40(%rbx), %rax
+	movq	%rdx, 16(%rcx)
+	movq	%rax, 8(%rcx)
+	cmpq	$23, %rax
+	je	.L2438
+	movq	-24(%rbx), %rax
+	movq	%rax, 24(%rcx)
+	movq	$23, -40(%rbx)
+	movq	$0, -48(%rbx)
+	movb	$0, -24(%rbx)
+.L2005:
+	movdqa	16(%rsp), %xmm4
+	movq	176(%rsp), %rax
+	movups	%xmm4, -48(%rbx)
+	movq	%rax, -32(%rbx)
+	cmpq	$23, %rbp
+	je	.L2439
+	movq	64(%rsp), %rax
+	movq	%rax, -24(%rbx)
+.L2008:
+	movq	88(%rsp), %rcx
+	movq	32(%rsp), %rax
+	movq	%r14, %r12
+	movabsq	$-6148914691236517205, %rsi
+	subq	%rbx, %rcx
+	subq	%rax, %r12
+	movq	%rcx, %rdx
+	movq	%r12, %rax
+	movq	%rcx, (%rsp)
+	sarq	$4, %rdx
+	sarq	$4, %rax
+	imulq	%rsi, %rdx
+	imulq	%rsi, %rax
+	movq	%rdx, %rcx
+	movq	%rdx, 40(%rsp)
+	movq	48(%rsp), %rdx
+	shrq	$3, %rdx
+	cmpq	%rcx, %rax
+	cmovbe	%rax, %rcx
+	cmpq	%rdx, %rcx
+	jnb	.L2440
+	subl	$1, 148(%rsp)
+	je	.L2441
+	cmpq	$1104, %r12
+	ja	.L2442
+.L2096:
+	movq	(%rsp), %r13
+	cmpq	$1104, %r13
+	ja	.L2443
+.L2100:
+	movzbl	147(%rsp), %ecx
+	movl	148(%rsp), %edx
+	movq	%r14, %rsi
+	movq	32(%rsp), %rdi
+.LEHB77:
+	call	_ZN1n9__pdqsortINS_6stringIcEENS_4lessEEEvPT_S5_RT0_ib.isra.0
+.LEHE77:
+	movq	40(%rsp), %rax
+	movq	%rbx, 32(%rsp)
+	movq	%rax, 48(%rsp)
+.L1945:
+	movb	$0, 147(%rsp)
+	cmpq	$1104, %r13
+	ja	.L1669
+.L1670:
+	movq	32(%rsp), %rbp
+	movq	88(%rsp), %rax
+	addq	$48, %rbp
+	cmpq	%rax, %rbp
+	jnb	.L1667
+	leaq	232(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	jmp	.L1727
+.L2444:
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L1705
+	js	.L1708
+.L1707:
+	movq	88(%rsp), %rax
+	addq	$48, %rbp
+	cmpq	%rax, %rbp
+	jnb	.L1667
+.L1727:
+	cmpq	$23, -40(%rbp)
+	movq	-48(%rbp), %rbx
+	leaq	-24(%rbp), %rsi
+	je	.L1702
+	movq	-24(%rbp), %rsi
+.L1702:
+	movdqu	0(%rbp), %xmm3
+	movq	8(%rbp), %r14
+	leaq	24(%rbp), %rdi
+	movhlps	%xmm3, %xmm7
+	movaps	%xmm3, (%rsp)
+	movq	%xmm3, %r12
+	movq	%xmm7, %r13
+	cmpq	$23, %r13
+	je	.L1704
+	movq	24(%rbp), %rdi
+.L1704:
+	cmpq	%r12, %rbx
+	movq	%r12, %rdx
+	cmovbe	%rbx, %rdx
+	testq	%rdx, %rdx
+	jne	.L2444
+.L1705:
+	cmpq	%rbx, %r12
+	jnb	.L1707
+.L1708:
+	movdqa	.LC33(%rip), %xmm4
+	movaps	%xmm4, 208(%rsp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L2445
+.L1709:
+	movq	16(%rbp), %rax
+	movdqa	(%rsp), %xmm7
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 240(%rsp)
+	movq	%rax, 40(%rsp)
+	movq	%rax, 224(%rsp)
+	movaps	%xmm7, 208(%rsp)
+	cmpq	$23, %r13
+	je	.L2446
+	movq	24(%rbp), %rax
+	movq	$23, 8(%rbp)
+	movq	%rax, 232(%rsp)
+.L1713:
+	movq	$0, 0(%rbp)
+	movq	%rbp, %rbx
+	movb	$0, 24(%rbp)
+.L2321:
+	movq	8(%rbx), %rax
+	cmpq	$23, %rax
+	je	.L1714
+	movq	16(%rbx), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%rbx), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB78:
+	call	*24(%rax)
+	movq	$23, 8(%rbx)
+.L1714:
+	movq	-48(%rbx), %rax
+	movq	-32(%rbx), %r15
+	subq	$48, %rbx
+	movb	$0, 72(%rbx)
+	movq	%rax, 48(%rbx)
+	movq	8(%rbx), %rax
+	movq	%r15, 64(%rbx)
+	movq	%rax, 56(%rbx)
+	cmpq	$23, %rax
+	je	.L2447
+	movq	24(%rbx), %rax
+	movq	$23, 8(%rbx)
+	movq	%rax, 72(%rbx)
+.L1716:
+	cmpq	$23, -40(%rbx)
+	movq	-48(%rbx), %rcx
+	movb	$0, 24(%rbx)
+	leaq	-24(%rbx), %rsi
+	movq	$0, (%rbx)
+	je	.L1718
+	movq	-24(%rbx), %rsi
+.L1718:
+	movq	16(%rsp), %rdi
+	cmpq	$23, %r13
+	je	.L1719
+	movq	232(%rsp), %rdi
+.L1719:
+	cmpq	%r12, %rcx
+	movq	%r12, %rdx
+	cmovbe	%rcx, %rdx
+	testq	%rdx, %rdx
+	je	.L1720
+	movq	%rcx, 32(%rsp)
+	call	memcmp@PLT
+	movq	32(%rsp), %rcx
+	testl	%eax, %eax
+	je	.L1720
+	js	.L2321
+	movq	8(%rbx), %rax
+	cmpq	$23, %rax
+	je	.L1724
+.L2474:
+	leaq	1(%rax), %rdx
+	movq	(%r15), %rax
+	movq	24(%rbx), %rsi
+	movl	$1, %ecx
+	movq	%r15, %rdi
+	call	*24(%rax)
+.LEHE78:
+.L1724:
+	movdqa	(%rsp), %xmm6
+	movq	40(%rsp), %rax
+	movups	%xmm6, (%rbx)
+	movq	%rax, 16(%rbx)
+	cmpq	$23, %r13
+	je	.L2448
+	movq	232(%rsp), %rax
+	addq	$48, %rbp
+	movq	%rax, 24(%rbx)
+	movq	88(%rsp), %rax
+	cmpq	%rax, %rbp
+	jb	.L1727
+.L1667:
+	addq	$264, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1996:
+	.cfi_restore_state
+	cmpq	%r15, %r13
+	jnb	.L2326
+	jmp	.L2413
+	.p2align 4,,10
+	.p2align 3
+.L1991:
+	cmpq	%r15, %r12
+	jnb	.L2408
+	jmp	.L2327
+	.p2align 4,,10
+	.p2align 3
+.L1954:
+	cmpq	%r15, %r12
+	jnb	.L1956
+	jmp	.L2325
+	.p2align 4,,10
+	.p2align 3
+.L1970:
+	cmpq	%rbp, %r12
+	jnb	.L2311
+	jmp	.L2412
+.L2449:
+	movdqa	(%rsp), %xmm4
+	movups	%xmm4, (%rbx)
+	.p2align 4,,10
+	.p2align 3
+.L1980:
+	movdqu	232(%rsp), %xmm5
+	movq	248(%rsp), %rax
+	movups	%xmm5, 24(%rbp)
+	movq	%rax, 40(%rbp)
+	jmp	.L1986
+	.p2align 4,,10
+	.p2align 3
+.L2436:
+	movdqa	(%rsp), %xmm7
+	movups	%xmm7, (%rbx)
+	jmp	.L1979
+	.p2align 4,,10
+	.p2align 3
+.L2435:
+	movdqu	24(%rbx), %xmm7
+	movq	40(%rbx), %rax
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+	movq	%rax, 248(%rsp)
+	movups	%xmm7, 232(%rsp)
+	cmpq	%rbp, %rbx
+	jne	.L1976
+	movq	8(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L2449
+.L1978:
+	movq	16(%rbp), %rdi
+	movq	24(%rbp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB79:
+	call	*24(%rax)
+.LEHE79:
+	jmp	.L1982
+	.p2align 4,,10
+	.p2align 3
+.L2434:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1973
+	movdqu	(%rbx), %xmm3
+	movq	168(%rsp), %rax
+	movq	8(%rbx), %r13
+	movhlps	%xmm3, %xmm5
+	movq	%rax, 40(%rsp)
+	movaps	%xmm3, (%rsp)
+	movq	%xmm5, %r12
+	jmp	.L1972
+	.p2align 4,,10
+	.p2align 3
+.L2437:
+	movdqu	24(%rbp), %xmm7
+	movups	%xmm7, 24(%rbx)
+	movq	40(%rbp), %rax
+	movq	%rax, 40(%rbx)
+	movq	8(%rbp), %rdx
+	movq	$0, 0(%rbp)
+	movb	$0, 24(%rbp)
+	cmpq	$23, %rdx
+	jne	.L1978
+	jmp	.L1982
+.L1730:
+	leaq	24(%rbx), %rax
+	cmpq	$23, %r14
+	je	.L1852
+	movq	24(%rbx), %rax
+.L1852:
+	cmpq	$23, %r15
+	je	.L2450
+	movq	32(%rsp), %rcx
+	cmpq	%r12, %rbp
+	movq	%r12, %rdx
+	cmovbe	%rbp, %rdx
+	movq	24(%rcx), %rsi
+	movq	%rsi, %rdi
+	testq	%rdx, %rdx
+	je	.L1858
+	movq	%rax, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L1859
+.L2462:
+	cmpq	%rbp, %r12
+	jnb	.L1860
+.L1857:
+	movq	32(%rsp), %r14
+	movq	%rbx, %rdi
+	movq	%r14, %rsi
+.LEHB80:
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	(%r14), %r12
+	movq	8(%r14), %r15
+.L1860:
+	cmpq	$23, %r15
+	je	.L1856
+.L2463:
+	movq	32(%rsp), %rax
+	movq	24(%rax), %rsi
+.L1862:
+	movq	88(%rsp), %rax
+	cmpq	$23, -40(%rax)
+	movq	-48(%rax), %rbp
+	leaq	-24(%rax), %rdi
+	je	.L1864
+	movq	-24(%rax), %rdi
+.L1864:
+	cmpq	%rbp, %r12
+	movq	%rbp, %rdx
+	cmovbe	%r12, %rdx
+	testq	%rdx, %rdx
+	je	.L1865
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L1865
+	js	.L1868
+.L1867:
+	cmpq	$23, 8(%rbx)
+	movq	(%rbx), %rbp
+	leaq	24(%rbx), %rsi
+	je	.L1870
+	movq	24(%rbx), %rsi
+.L1870:
+	movq	32(%rsp), %rax
+	leaq	24(%rax), %rdi
+	cmpq	$23, %r15
+	je	.L1872
+	movq	24(%rax), %rdi
+.L1872:
+	cmpq	%r12, %rbp
+	movq	%r12, %rdx
+	cmovbe	%rbp, %rdx
+	testq	%rdx, %rdx
+	je	.L1873
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L1873
+	jns	.L1850
+	movq	32(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+.LEHE80:
+	jmp	.L1850
+	.p2align 4,,10
+	.p2align 3
+.L1881:
+	cmpq	%r15, %rbx
+	jb	.L1876
+.L1883:
+	movdqa	.LC33(%rip), %xmm7
+	movaps	%xmm7, 160(%rsp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L2451
+.L1884:
+	movq	32(%rsp), %rax
+	movq	16(%rsp), %rcx
+	pxor	%xmm0, %xmm0
+	movdqa	64(%rsp), %xmm6
+	movaps	%xmm0, 192(%rsp)
+	movq	16(%rax), %rax
+	movq	%rcx, 40(%rsp)
+	movaps	%xmm6, 160(%rsp)
+	movq	%rax, 176(%rsp)
+	cmpq	$23, %rcx
+	je	.L2452
+	movq	32(%rsp), %rax
+	movq	24(%rax), %r14
+	movq	$23, 8(%rax)
+	movq	%r14, 184(%rsp)
+.L1888:
+	cmpq	$23, 16(%rsp)
+	movq	88(%rsp), %rbx
+	movb	$0, 24(%rax)
+	movq	$0, (%rax)
+	leaq	184(%rsp), %rax
+	movq	%rax, 80(%rsp)
+	cmovne	%r14, %rax
+	movq	%rax, (%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L2322:
+	movq	%rbx, %r13
+	movq	-40(%rbx), %r12
+	subq	$48, %rbx
+	movq	(%rbx), %rbp
+	leaq	24(%rbx), %rsi
+	cmpq	$23, %r12
+	je	.L1890
+	movq	24(%rbx), %rsi
+.L1890:
+	cmpq	%rbp, %r15
+	movq	%rbp, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L1891
+	movq	(%rsp), %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L1891
+	js	.L2322
+.L1893:
+	movq	32(%rsp), %rbp
+	cmpq	%r13, 88(%rsp)
+	je	.L1902
+.L2310:
+	addq	$48, %rbp
+	movq	0(%rbp), %r13
+	cmpq	$23, 8(%rbp)
+	leaq	24(%rbp), %rsi
+	je	.L1905
+	movq	24(%rbp), %rsi
+.L1905:
+	cmpq	%r13, %r15
+	movq	%r13, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L1906
+	movq	(%rsp), %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L1906
+	jns	.L2310
+.L1908:
+	cmpq	%rbx, %rbp
+	jnb	.L1897
+	.p2align 4,,10
+	.p2align 3
+.L1937:
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L2453
+.L1909:
+	movdqu	0(%rbp), %xmm5
+	pxor	%xmm0, %xmm0
+	movq	8(%rbp), %r14
+	movq	16(%rbp), %r13
+	movaps	%xmm0, 240(%rsp)
+	movhlps	%xmm5, %xmm3
+	movaps	%xmm5, (%rsp)
+	movq	%xmm3, %r12
+	cmpq	$23, %r12
+	je	.L2454
+	movq	24(%rbp), %rax
+	movq	$23, 8(%rbp)
+	movq	$0, 0(%rbp)
+	movq	%rax, 232(%rsp)
+	movb	$0, 24(%rbp)
+	cmpq	%rbp, %rbx
+	je	.L2455
+.L1913:
+	movq	$0, 0(%rbp)
+	movb	$0, 24(%rbp)
+	movq	(%rbx), %rax
+	movq	16(%rbx), %rdx
+	movq	%rax, 0(%rbp)
+	movq	8(%rbx), %rax
+	movq	%rdx, 16(%rbp)
+	movq	%rax, 8(%rbp)
+	cmpq	$23, %rax
+	je	.L2456
+	movq	24(%rbx), %rax
+	movq	%rax, 24(%rbp)
+	movq	$23, 8(%rbx)
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+.L1918:
+	movdqa	(%rsp), %xmm3
+	movq	%r13, 16(%rbx)
+	movups	%xmm3, (%rbx)
+	cmpq	$23, %r12
+	je	.L1915
+.L1916:
+	movq	232(%rsp), %rax
+	movq	%rax, 24(%rbx)
+.L1922:
+	movq	80(%rsp), %r13
+	movq	184(%rsp), %r14
+	movq	%rbp, 16(%rsp)
+	cmpq	$23, 40(%rsp)
+	movq	160(%rsp), %r15
+	cmovne	%r14, %r13
+	movq	%r13, %rbp
+	.p2align 4,,10
+	.p2align 3
+.L2324:
+	movq	-40(%rbx), %r13
+	subq	$48, %rbx
+	movq	(%rbx), %r12
+	leaq	24(%rbx), %rsi
+	cmpq	$23, %r13
+	je	.L1926
+	movq	24(%rbx), %rsi
+.L1926:
+	cmpq	%r15, %r12
+	movq	%r15, %rdx
+	cmovbe	%r12, %rdx
+	testq	%rdx, %rdx
+	je	.L1927
+	movq	%rbp, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L1927
+	js	.L2324
+	.p2align 4,,10
+	.p2align 3
+.L2404:
+	movq	%rbx, (%rsp)
+	movq	%rbp, %rbx
+	movq	16(%rsp), %rbp
+	movq	%r13, %r12
+.L2323:
+	addq	$48, %rbp
+	movq	0(%rbp), %r13
+	cmpq	$23, 8(%rbp)
+	leaq	24(%rbp), %rsi
+	je	.L1931
+	movq	24(%rbp), %rsi
+.L1931:
+	cmpq	%r13, %r15
+	movq	%r13, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L1932
+	movq	%rbx, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L1932
+	jns	.L2323
+	movq	(%rsp), %rbx
+	cmpq	%rbx, %rbp
+	jb	.L1937
+.L2460:
+	movq	40(%rsp), %rax
+	movq	%r15, %xmm7
+	movq	%rax, %xmm5
+	movq	%rax, 16(%rsp)
+	punpcklqdq	%xmm5, %xmm7
+	movaps	%xmm7, 64(%rsp)
+	cmpq	%rbx, 32(%rsp)
+	jne	.L2161
+.L1938:
+	cmpq	$23, %r12
+	je	.L1941
+	movq	16(%rbx), %rdi
+	movq	24(%rbx), %rsi
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB81:
+	call	*24(%rax)
+	jmp	.L1941
+.L2457:
+	addq	$48, %rbp
+	movq	0(%rbp), %r13
+	cmpq	$23, 8(%rbp)
+	leaq	24(%rbp), %rsi
+	je	.L1899
+	movq	24(%rbp), %rsi
+.L1899:
+	cmpq	%r13, %r15
+	movq	%r13, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L1900
+	movq	(%rsp), %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L1901
+.L1900:
+	cmpq	%r13, %r15
+	jb	.L1903
+.L1902:
+	cmpq	%rbx, %rbp
+	jb	.L2457
+.L1897:
+	cmpq	%rbx, 32(%rsp)
+	je	.L1938
+.L2161:
+	movq	32(%rsp), %r15
+	movq	8(%r15), %rax
+	cmpq	$23, %rax
+	je	.L1939
+	movq	16(%r15), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%r15), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE81:
+	movq	$23, 8(%r15)
+.L1939:
+	movq	32(%rsp), %rcx
+	movq	$0, (%rcx)
+	movb	$0, 24(%rcx)
+	movq	(%rbx), %rax
+	movq	16(%rbx), %rdx
+	movq	%rax, (%rcx)
+	movq	8(%rbx), %rax
+	movq	%rdx, 16(%rcx)
+	movq	%rax, 8(%rcx)
+	cmpq	$23, %rax
+	je	.L2458
+	movq	24(%rbx), %rax
+	movq	%rax, 24(%rcx)
+	movq	$23, 8(%rbx)
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+.L1941:
+	movdqa	64(%rsp), %xmm5
+	movq	176(%rsp), %rax
+	cmpq	$23, 16(%rsp)
+	movq	%rax, 16(%rbx)
+	movups	%xmm5, (%rbx)
+	je	.L2459
+	movq	%r14, 24(%rbx)
+.L1944:
+	movq	88(%rsp), %r13
+	leaq	48(%rbx), %rax
+	movabsq	$-6148914691236517205, %rcx
+	movq	%rax, 32(%rsp)
+	subq	%rax, %r13
+	movq	%r13, %rax
+	sarq	$4, %rax
+	imulq	%rcx, %rax
+	movq	%rax, 48(%rsp)
+	jmp	.L1945
+	.p2align 4,,10
+	.p2align 3
+.L1927:
+	cmpq	%r12, %r15
+	jnb	.L2404
+	jmp	.L2324
+	.p2align 4,,10
+	.p2align 3
+.L1932:
+	cmpq	%r13, %r15
+	jnb	.L2323
+	movq	(%rsp), %rbx
+	cmpq	%rbx, %rbp
+	jb	.L1937
+	jmp	.L2460
+	.p2align 4,,10
+	.p2align 3
+.L1891:
+	cmpq	%rbp, %r15
+	jnb	.L1893
+	jmp	.L2322
+.L1906:
+	cmpq	%r13, %r15
+	jnb	.L2310
+	jmp	.L1908
+.L2454:
+	movdqu	24(%rbp), %xmm7
+	movq	40(%rbp), %rax
+	movb	$0, 24(%rbp)
+	movq	$0, 0(%rbp)
+	movq	%rax, 248(%rsp)
+	movups	%xmm7, 232(%rsp)
+	cmpq	%rbp, %rbx
+	jne	.L1913
+	movq	%r14, %rdx
+	cmpq	$23, %r14
+	jne	.L1914
+	movq	%r13, 16(%rbx)
+	movups	%xmm5, (%rbx)
+.L1915:
+	movdqu	232(%rsp), %xmm7
+	movq	248(%rsp), %rax
+	movups	%xmm7, 24(%rbx)
+	movq	%rax, 40(%rbx)
+	jmp	.L1922
+.L1973:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	jne	.L1974
+	movdqu	(%rbx), %xmm4
+	movq	168(%rsp), %rax
+	movq	8(%rbx), %r13
+	movhlps	%xmm4, %xmm0
+	movq	%rax, 40(%rsp)
+	movaps	%xmm4, (%rsp)
+	movq	%xmm0, %r12
+	jmp	.L1972
+.L1865:
+	cmpq	%r12, %rbp
+	jnb	.L1867
+.L1868:
+	movq	32(%rsp), %r14
+	movq	152(%rsp), %rsi
+	movq	%r14, %rdi
+.LEHB82:
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	(%r14), %r12
+	movq	8(%r14), %r15
+	jmp	.L1867
+.L1873:
+	cmpq	%rbp, %r12
+	jnb	.L1850
+	movq	32(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	jmp	.L1850
+.L1831:
+	cmpq	%r13, %r12
+	jnb	.L1833
+.L1834:
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	jne	.L1836
+.L2428:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L1836
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1836
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1836
+	.p2align 4,,10
+	.p2align 3
+.L1753:
+	cmpq	%r12, %rbp
+	jnb	.L1755
+.L1756:
+	movq	32(%rsp), %rdi
+	movq	%rbx, %rsi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	jmp	.L1755
+.L1745:
+	cmpq	%rbp, %r12
+	jnb	.L1747
+.L1748:
+	movq	152(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	(%rbx), %rbp
+	movq	8(%rbx), %r14
+	jmp	.L1747
+.L1771:
+	cmpq	%r13, %r15
+	jnb	.L1773
+.L1774:
+	movq	88(%rsp), %rax
+	movq	%rbp, %rdi
+	leaq	-96(%rax), %rsi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	0(%rbp), %r13
+	movq	8(%rbp), %r14
+	jmp	.L1773
+.L1823:
+	cmpq	%r12, %r15
+	jnb	.L1825
+.L1826:
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	(%rbx), %r12
+	movq	8(%rbx), %r14
+	jmp	.L1825
+.L1805:
+	cmpq	%r12, %r14
+	jnb	.L1807
+.L1808:
+	movq	(%rsp), %rdi
+	movq	%r13, %rsi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	jmp	.L1807
+.L1797:
+	cmpq	%r14, %r12
+	jnb	.L1799
+.L1800:
+	movq	88(%rsp), %rax
+	movq	%r13, %rdi
+	leaq	-144(%rax), %rsi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	0(%r13), %r14
+	movq	8(%r13), %r15
+	jmp	.L1799
+.L1779:
+	cmpq	%r15, %r13
+	jnb	.L1781
+.L1782:
+	movq	%rbp, %rsi
+	movq	%r12, %rdi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+.LEHE82:
+	jmp	.L1781
+.L2433:
+	movq	88(%rsp), %rcx
+	cmpq	%rcx, 104(%rsp)
+	jnb	.L2461
+	movq	%rbx, 112(%rsp)
+	movq	96(%rsp), %rbx
+	movq	%r13, 120(%rsp)
+	movq	%rbp, %r13
+	movq	%r14, %rbp
+	movq	%r12, %r14
+	movq	%r15, %r12
+	.p2align 4,,10
+	.p2align 3
+.L1959:
+	subq	$48, %rbx
+	movq	(%rbx), %r15
+	cmpq	$23, 8(%rbx)
+	leaq	24(%rbx), %rdi
+	je	.L1963
+	movq	24(%rbx), %rdi
+.L1963:
+	cmpq	%r12, %r15
+	movq	%r12, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L1964
+	movq	112(%rsp), %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L1964
+	jns	.L1966
+.L2407:
+	movq	%r14, %r12
+	movq	%rbx, 96(%rsp)
+	movq	%rbp, %r14
+	movq	%rbx, %rax
+	movq	%r13, %rbp
+	movq	120(%rsp), %r13
+	jmp	.L1967
+	.p2align 4,,10
+	.p2align 3
+.L1964:
+	cmpq	%r12, %r15
+	jb	.L2407
+.L1966:
+	cmpq	%rbx, 104(%rsp)
+	jb	.L1959
+	movq	%rbx, 96(%rsp)
+	movq	%rbp, %r14
+	movq	104(%rsp), %rbx
+	movq	%r13, %rbp
+	cmpq	%r14, 32(%rsp)
+	jne	.L2001
+.L2163:
+	movq	-40(%rbx), %rax
+.L2002:
+	cmpq	$23, %rax
+	je	.L2005
+	movq	-32(%rbx), %rdi
+	leaq	1(%rax), %rdx
+	movq	-24(%rbx), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB83:
+	call	*24(%rax)
+.LEHE83:
+	jmp	.L2005
+.L2455:
+	movq	%r13, 16(%rbx)
+	movups	%xmm5, (%rbx)
+	jmp	.L1916
+.L2429:
+	movdqu	24(%rax), %xmm7
+	movq	40(%rax), %rax
+	movq	$0, (%rcx)
+	movb	$0, 24(%rcx)
+	movq	%rax, 248(%rsp)
+	movaps	%xmm7, 16(%rsp)
+	movups	%xmm7, 232(%rsp)
+	cmpq	%rbx, %rcx
+	jne	.L1839
+	movq	%r13, %rax
+	cmpq	$23, %r13
+	jne	.L2165
+	movq	32(%rsp), %rax
+	movups	%xmm5, (%rax)
+.L2164:
+	movdqu	232(%rsp), %xmm4
+	movq	248(%rsp), %rax
+	movups	%xmm4, 24(%rbx)
+	movq	%rax, 40(%rbx)
+	jmp	.L1850
+.L2440:
+	movq	96(%rsp), %rcx
+	cmpq	%rcx, 104(%rsp)
+	jnb	.L2101
+.L2418:
+	movq	(%rsp), %r13
+	jmp	.L2100
+.L2442:
+	shrq	$2, %rax
+	movq	32(%rsp), %rdi
+	leaq	(%rax,%rax,2), %rbp
+	salq	$4, %rbp
+	leaq	(%rdi,%rbp), %rsi
+.LEHB84:
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	%r14, %rsi
+	leaq	-96(%rbx), %rdi
+	subq	%rbp, %rsi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	cmpq	$6144, %r12
+	jbe	.L2096
+	movq	32(%rsp), %r15
+	leaq	48(%r15,%rbp), %rsi
+	leaq	48(%r15), %rdi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	leaq	96(%r15,%rbp), %rsi
+	leaq	96(%r15), %rdi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	%r14, %rax
+	leaq	-144(%rbx), %rdi
+	subq	%rbp, %rax
+	leaq	-48(%rax), %rsi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	%r14, %rax
+	leaq	-192(%rbx), %rdi
+	subq	%rbp, %rax
+	leaq	-96(%rax), %rsi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	(%rsp), %r13
+	cmpq	$1104, %r13
+	jbe	.L2100
+.L2443:
+	movq	40(%rsp), %rax
+	movq	%rbx, %rdi
+	shrq	$2, %rax
+	leaq	3(%rax,%rax,2), %rbp
+	salq	$4, %rbp
+	leaq	(%r14,%rbp), %rsi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	88(%rsp), %rax
+	movq	152(%rsp), %rdi
+	subq	%rbp, %rax
+	leaq	48(%rax), %rsi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	cmpq	$6144, %r13
+	jbe	.L2100
+	leaq	48(%r14,%rbp), %rsi
+	leaq	48(%rbx), %rdi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	leaq	96(%r14,%rbp), %rsi
+	leaq	96(%rbx), %rdi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	88(%rsp), %r15
+	movq	%r15, %rcx
+	leaq	-96(%r15), %rdi
+	subq	%rbp, %rcx
+	movq	%rcx, %rsi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+	movq	%r15, %rax
+	leaq	-144(%r15), %rdi
+	subq	%rbp, %rax
+	leaq	-48(%rax), %rsi
+	call	_ZN1n4swapINS_6stringIcEEEEvRT_S4_
+.LEHE84:
+	jmp	.L2100
+.L2453:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1910
+.L2410:
+	movq	168(%rsp), %rax
+	movq	%rax, 40(%rsp)
+	jmp	.L1909
+.L2432:
+	movq	32(%rsp), %rcx
+	movdqu	24(%rcx), %xmm6
+	movq	40(%rcx), %rdx
+	movaps	%xmm6, (%rsp)
+	movq	(%rsp), %rax
+	movq	%rdx, 200(%rsp)
+	movq	%rax, 64(%rsp)
+	movq	%rcx, %rax
+	movups	%xmm6, 184(%rsp)
+	jmp	.L1951
+.L1901:
+	jns	.L1902
+.L1903:
+	cmpq	%rbx, %rbp
+	jb	.L1937
+	jmp	.L2161
+	.p2align 4,,10
+	.p2align 3
+.L2450:
+	cmpq	%r12, %rbp
+	movq	%r12, %rdx
+	cmovbe	%rbp, %rdx
+	testq	%rdx, %rdx
+	je	.L1854
+	movq	32(%rsp), %rcx
+	movq	%rax, %rsi
+	leaq	24(%rcx), %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2462
+.L1859:
+	js	.L1857
+	cmpq	$23, %r15
+	jne	.L2463
+.L1856:
+	movq	32(%rsp), %rax
+	movl	$23, %r15d
+	leaq	24(%rax), %rsi
+	jmp	.L1862
+.L2422:
+	cmpq	%r12, %rbp
+	movq	%r12, %rdx
+	leaq	24(%rbx), %rdi
+	cmovbe	%rbp, %rdx
+	testq	%rdx, %rdx
+	jne	.L1735
+	cmpq	%r12, %rbp
+	jb	.L1737
+.L1736:
+	leaq	24(%rbx), %rsi
+	movl	$23, %r14d
+	jmp	.L1742
+.L2424:
+	cmpq	%r13, %r15
+	movq	%r13, %rdx
+	leaq	24(%rbp), %rdi
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	jne	.L1761
+	cmpq	%r15, %r13
+	jb	.L1763
+.L1762:
+	leaq	24(%rbp), %rsi
+	movl	$23, %r14d
+	jmp	.L1768
+.L2426:
+	cmpq	%r14, %r12
+	movq	%r14, %rdx
+	leaq	24(%r13), %rdi
+	cmovbe	%r12, %rdx
+	testq	%rdx, %rdx
+	jne	.L1787
+	cmpq	%r12, %r14
+	jb	.L1789
+.L1788:
+	leaq	24(%r13), %rsi
+	movl	$23, %r15d
+	jmp	.L1794
+.L2427:
+	cmpq	%r12, %r15
+	movq	%r12, %rdx
+	leaq	24(%rbx), %rdi
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	jne	.L1813
+	cmpq	%r15, %r12
+	jb	.L1815
+.L1814:
+	leaq	24(%rbx), %rsi
+	movl	$23, %r14d
+	jmp	.L1820
+.L2423:
+	addq	$72, %rax
+	jmp	.L1758
+.L2425:
+	addq	$120, %rax
+	jmp	.L1784
+.L1765:
+	jns	.L1766
+	jmp	.L1763
+.L1739:
+	jns	.L1740
+	jmp	.L1737
+.L1817:
+	jns	.L1818
+	jmp	.L1815
+.L1791:
+	jns	.L1792
+	jmp	.L1789
+.L2431:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L1948
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1948
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1948
+.L2456:
+	movdqu	24(%rbx), %xmm4
+	movups	%xmm4, 24(%rbp)
+	movq	40(%rbx), %rax
+	movq	%rax, 40(%rbp)
+	movq	8(%rbx), %rdx
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+	cmpq	$23, %rdx
+	je	.L1918
+.L1914:
+	movq	16(%rbx), %rdi
+	movq	24(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB85:
+	call	*24(%rax)
+.LEHE85:
+	jmp	.L1918
+.L1974:
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movdqu	(%rbx), %xmm6
+	movq	8(%rbx), %r13
+	movq	168(%rsp), %rax
+	movhlps	%xmm6, %xmm0
+	movaps	%xmm6, (%rsp)
+	movq	%rax, 40(%rsp)
+	movq	%xmm0, %r12
+	jmp	.L1972
+.L2461:
+	movq	104(%rsp), %rbx
+	jmp	.L2163
+.L2439:
+	movdqu	184(%rsp), %xmm3
+	movq	200(%rsp), %rax
+	movups	%xmm3, -24(%rbx)
+	movq	%rax, -8(%rbx)
+	jmp	.L2008
+.L2438:
+	movdqu	-24(%rbx), %xmm7
+	movups	%xmm7, 24(%rcx)
+	movq	-8(%rbx), %rax
+	movq	%rax, 40(%rcx)
+	movq	-40(%rbx), %rax
+	movq	$0, -48(%rbx)
+	movb	$0, -24(%rbx)
+	jmp	.L2002
+.L1841:
+	movups	%xmm5, (%rcx)
+	jmp	.L1848
+.L1858:
+	cmpq	%rbp, %r12
+	jnb	.L1862
+	jmp	.L1857
+.L1738:
+	cmpq	%r12, %rbp
+	jnb	.L1741
+	jmp	.L1737
+.L1816:
+	cmpq	%r15, %r12
+	jnb	.L1819
+	jmp	.L1815
+.L1790:
+	cmpq	%r12, %r14
+	jnb	.L1794
+	jmp	.L1789
+.L1764:
+	cmpq	%r15, %r13
+	jnb	.L1768
+	jmp	.L1763
+.L2101:
+	movq	32(%rsp), %rax
+	cmpq	%r14, %rax
+	je	.L2102
+	leaq	48(%rax), %r12
+	cmpq	%r14, %r12
+	jnb	.L2102
+	leaq	232(%rsp), %rax
+	movq	$0, 104(%rsp)
+	movq	%rax, 96(%rsp)
+	jmp	.L2129
+.L2464:
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2107
+	js	.L2110
+.L2109:
+	addq	$48, %r12
+	cmpq	%r14, %r12
+	jnb	.L2102
+.L2129:
+	cmpq	$23, -40(%r12)
+	movq	-48(%r12), %rbp
+	leaq	-24(%r12), %rsi
+	je	.L2104
+	movq	-24(%r12), %rsi
+.L2104:
+	movdqu	(%r12), %xmm4
+	movq	8(%r12), %rax
+	leaq	24(%r12), %rdi
+	movhlps	%xmm4, %xmm5
+	movq	%rax, 64(%rsp)
+	movq	%xmm4, %r15
+	movq	%xmm5, %rax
+	movaps	%xmm4, 48(%rsp)
+	movq	%xmm5, 16(%rsp)
+	cmpq	$23, %rax
+	je	.L2106
+	movq	24(%r12), %rdi
+.L2106:
+	cmpq	%rbp, %r15
+	movq	%rbp, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	jne	.L2464
+.L2107:
+	cmpq	%rbp, %r15
+	jnb	.L2109
+.L2110:
+	movdqa	.LC33(%rip), %xmm4
+	movaps	%xmm4, 208(%rsp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L2465
+.L2111:
+	movq	16(%r12), %rax
+	movdqa	48(%rsp), %xmm7
+	pxor	%xmm0, %xmm0
+	cmpq	$23, 16(%rsp)
+	movaps	%xmm0, 240(%rsp)
+	movq	%rax, 112(%rsp)
+	movq	%rax, 224(%rsp)
+	movaps	%xmm7, 208(%rsp)
+	je	.L2466
+	movq	$23, 8(%r12)
+	movq	24(%r12), %rax
+	movq	%rax, 232(%rsp)
+.L2115:
+	movq	%r12, %r13
+	movq	$0, (%r12)
+	movb	$0, 24(%r12)
+	movq	8(%r13), %rax
+	cmpq	$23, %rax
+	je	.L2116
+.L2468:
+	movq	16(%r13), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%r13), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB86:
+	call	*24(%rax)
+	movq	$23, 8(%r13)
+.L2116:
+	movb	$0, 24(%r13)
+	movq	-48(%r13), %rax
+	leaq	-48(%r13), %rbp
+	movq	16(%rbp), %rdx
+	movq	%rax, 48(%rbp)
+	movq	8(%rbp), %rax
+	movq	%rdx, 64(%rbp)
+	movq	%rax, 56(%rbp)
+	cmpq	$23, %rax
+	je	.L2467
+	movq	24(%rbp), %rax
+	movq	$23, 8(%rbp)
+	movq	%rax, 72(%rbp)
+.L2118:
+	movq	32(%rsp), %rax
+	movq	$0, 0(%rbp)
+	movb	$0, 24(%rbp)
+	cmpq	%rax, %rbp
+	je	.L2119
+	cmpq	$23, -40(%rbp)
+	movq	-48(%rbp), %rcx
+	leaq	-24(%rbp), %rsi
+	je	.L2121
+	movq	-24(%rbp), %rsi
+.L2121:
+	cmpq	$23, 16(%rsp)
+	movq	96(%rsp), %rdi
+	je	.L2122
+	movq	232(%rsp), %rdi
+.L2122:
+	cmpq	%rcx, %r15
+	movq	%rcx, %rdx
+	cmovbe	%r15, %rdx
+	testq	%rdx, %rdx
+	je	.L2123
+	movq	%rcx, 80(%rsp)
+	call	memcmp@PLT
+	movq	80(%rsp), %rcx
+	testl	%eax, %eax
+	je	.L2123
+	jns	.L2119
+.L2179:
+	movq	%rbp, %r13
+	movq	8(%r13), %rax
+	cmpq	$23, %rax
+	jne	.L2468
+	jmp	.L2116
+.L2430:
+	movdqu	24(%rbx), %xmm5
+	movups	%xmm5, 24(%rcx)
+	movq	40(%rbx), %rax
+	movq	%rax, 40(%rcx)
+	jmp	.L1843
+.L2123:
+	cmpq	%rcx, %r15
+	jb	.L2179
+.L2119:
+	movq	-40(%r13), %rax
+	cmpq	$23, %rax
+	je	.L2126
+	movq	-32(%r13), %rdi
+	leaq	1(%rax), %rdx
+	movq	-24(%r13), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE86:
+.L2126:
+	movdqa	48(%rsp), %xmm6
+	movq	112(%rsp), %rax
+	cmpq	$23, 16(%rsp)
+	movq	%rax, -32(%r13)
+	movups	%xmm6, -48(%r13)
+	je	.L2469
+	movq	232(%rsp), %rax
+	movq	%rax, -24(%r13)
+.L2416:
+	movabsq	$-6148914691236517205, %rdx
+	movq	%r12, %rax
+	subq	%rbp, %rax
+	sarq	$4, %rax
+	imulq	%rdx, %rax
+	addq	%rax, 104(%rsp)
+	cmpq	$8, 104(%rsp)
+	jbe	.L2109
+	addq	$48, %r12
+	cmpq	%r12, %r14
+	jne	.L2418
+.L2102:
+	movq	88(%rsp), %rax
+	cmpq	%rbx, %rax
+	je	.L1667
+	leaq	48(%rbx), %r12
+	cmpq	%rax, %r12
+	jnb	.L1667
+	leaq	232(%rsp), %rax
+	movq	$0, 64(%rsp)
+	movq	%rax, 96(%rsp)
+	jmp	.L2158
+.L2470:
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2136
+	js	.L2139
+.L2138:
+	movq	88(%rsp), %rax
+	addq	$48, %r12
+	cmpq	%rax, %r12
+	jnb	.L1667
+.L2158:
+	cmpq	$23, -40(%r12)
+	movq	-48(%r12), %rbp
+	leaq	-24(%r12), %rsi
+	je	.L2133
+	movq	-24(%r12), %rsi
+.L2133:
+	movdqu	(%r12), %xmm5
+	movq	8(%r12), %r15
+	leaq	24(%r12), %rdi
+	movhlps	%xmm5, %xmm3
+	movaps	%xmm5, 48(%rsp)
+	movq	%xmm5, %r13
+	movq	%xmm3, %rax
+	movq	%xmm3, 16(%rsp)
+	cmpq	$23, %rax
+	je	.L2135
+	movq	24(%r12), %rdi
+.L2135:
+	cmpq	%rbp, %r13
+	movq	%rbp, %rdx
+	cmovbe	%r13, %rdx
+	testq	%rdx, %rdx
+	jne	.L2470
+.L2136:
+	cmpq	%rbp, %r13
+	jnb	.L2138
+.L2139:
+	movdqa	.LC33(%rip), %xmm7
+	movaps	%xmm7, 208(%rsp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L2471
+.L2140:
+	movq	16(%r12), %rax
+	movdqa	48(%rsp), %xmm3
+	pxor	%xmm0, %xmm0
+	cmpq	$23, 16(%rsp)
+	movaps	%xmm0, 240(%rsp)
+	movq	%rax, 80(%rsp)
+	movq	%rax, 224(%rsp)
+	movaps	%xmm3, 208(%rsp)
+	je	.L2472
+	movq	$23, 8(%r12)
+	movq	24(%r12), %rax
+	movq	%rax, 232(%rsp)
+.L2144:
+	movq	$0, (%r12)
+	movq	%r12, %rbp
+	movb	$0, 24(%r12)
+.L2328:
+	movq	8(%rbp), %rax
+	cmpq	$23, %rax
+	je	.L2145
+	movq	16(%rbp), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%rbp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB87:
+	call	*24(%rax)
+.LEHE87:
+	movq	$23, 8(%rbp)
+.L2145:
+	movq	-48(%rbp), %rax
+	movq	-32(%rbp), %rdx
+	subq	$48, %rbp
+	movb	$0, 72(%rbp)
+	movq	%rax, 48(%rbp)
+	movq	8(%rbp), %rax
+	movq	%rdx, 64(%rbp)
+	movq	%rax, 56(%rbp)
+	cmpq	$23, %rax
+	je	.L2473
+	movq	24(%rbp), %rax
+	movq	$23, 8(%rbp)
+	movq	%rax, 72(%rbp)
+.L2147:
+	movq	$0, 0(%rbp)
+	movb	$0, 24(%rbp)
+	cmpq	%rbx, %rbp
+	je	.L2148
+	cmpq	$23, -40(%rbp)
+	movq	-48(%rbp), %rcx
+	leaq	-24(%rbp), %rsi
+	je	.L2150
+	movq	-24(%rbp), %rsi
+.L2150:
+	cmpq	$23, 16(%rsp)
+	movq	96(%rsp), %rdi
+	je	.L2151
+	movq	232(%rsp), %rdi
+.L2151:
+	cmpq	%rcx, %r13
+	movq	%rcx, %rdx
+	cmovbe	%r13, %rdx
+	testq	%rdx, %rdx
+	je	.L2152
+	movq	%rcx, 104(%rsp)
+	call	memcmp@PLT
+	movq	104(%rsp), %rcx
+	testl	%eax, %eax
+	je	.L2152
+	js	.L2328
+	jmp	.L2148
+	.p2align 4,,10
+	.p2align 3
+.L1720:
+	cmpq	%rcx, %r12
+	jb	.L2321
+	movq	8(%rbx), %rax
+	cmpq	$23, %rax
+	jne	.L2474
+	jmp	.L1724
+.L2467:
+	movdqu	-24(%r13), %xmm5
+	movq	-8(%r13), %rax
+	movups	%xmm5, 24(%r13)
+	movq	%rax, 40(%r13)
+	jmp	.L2118
+.L2447:
+	movdqu	24(%rbx), %xmm5
+	movq	40(%rbx), %rax
+	movups	%xmm5, 72(%rbx)
+	movq	%rax, 88(%rbx)
+	jmp	.L1716
+.L1910:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2410
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2410
+.L1854:
+	cmpq	%rbp, %r12
+	jb	.L1857
+	movq	32(%rsp), %rax
+	movl	$23, %r15d
+	leaq	24(%rax), %rsi
+	jmp	.L1862
+.L2441:
+	movq	136(%rsp), %rax
+	leaq	-1(%rax), %rcx
+	leaq	-1(%rax,%rax), %rax
+	movq	%rcx, 40(%rsp)
+	movq	128(%rsp), %rcx
+	movq	%rax, 104(%rsp)
+	movq	32(%rsp), %rax
+	leaq	-48(%rax,%rcx), %rax
+	movq	%rax, 112(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L2013:
+	movq	48(%rsp), %rcx
+	cmpq	%rcx, 104(%rsp)
+	jnb	.L2027
+	movq	112(%rsp), %rax
+	movq	104(%rsp), %r13
+	movq	40(%rsp), %r14
+	movdqu	(%rax), %xmm6
+	movq	8(%rax), %rax
+	movhlps	%xmm6, %xmm3
+	movq	%rax, 120(%rsp)
+	movaps	%xmm6, (%rsp)
+	movq	%xmm3, %r15
+	jmp	.L2044
+	.p2align 4,,10
+	.p2align 3
+.L2479:
+	movq	%rcx, 16(%rsp)
+	call	memcmp@PLT
+	movq	16(%rsp), %rcx
+	testl	%eax, %eax
+	je	.L2025
+	jns	.L2027
+.L2028:
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L2475
+.L2029:
+	pxor	%xmm0, %xmm0
+	movq	16(%r14), %rbp
+	movaps	%xmm0, 240(%rsp)
+	cmpq	$23, %r15
+	je	.L2476
+	movq	24(%r14), %rax
+	movq	$23, 8(%r14)
+	movq	$0, (%r14)
+	movq	%rax, 232(%rsp)
+	movb	$0, 24(%r14)
+	cmpq	%rbx, %r14
+	je	.L2477
+.L2033:
+	movq	$0, (%r14)
+	movb	$0, 24(%r14)
+	movq	(%rbx), %rax
+	movq	16(%rbx), %rdx
+	movq	%rax, (%r14)
+	movq	8(%rbx), %rax
+	movq	%rdx, 16(%r14)
+	movq	%rax, 8(%r14)
+	cmpq	$23, %rax
+	je	.L2478
+	movq	24(%rbx), %rax
+	movq	%rax, 24(%r14)
+	movq	$23, 8(%rbx)
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+.L2039:
+	movdqa	(%rsp), %xmm6
+	movq	%rbp, 16(%rbx)
+	movups	%xmm6, (%rbx)
+	cmpq	$23, %r15
+	je	.L2037
+.L2036:
+	movq	232(%rsp), %rax
+	movq	48(%rsp), %rcx
+	movq	%rax, 24(%rbx)
+	leaq	1(%r13,%r13), %rax
+	cmpq	%rcx, %rax
+	jnb	.L2027
+.L2043:
+	movq	%r13, %r14
+	movq	%rax, %r13
+.L2044:
+	movq	32(%rsp), %rsi
+	leaq	0(%r13,%r13,2), %rbx
+	leaq	1(%r14), %rax
+	movq	48(%rsp), %rdi
+	salq	$4, %rbx
+	leaq	(%rax,%rax), %r9
+	movq	(%rsp), %rcx
+	addq	%rsi, %rbx
+	movq	(%rbx), %r12
+	movq	8(%rbx), %r8
+	cmpq	%rdi, %r9
+	jnb	.L2014
+	addq	%r9, %rax
+	salq	$5, %rax
+	leaq	(%rsi,%rax), %rbp
+	movq	8(%rbp), %r11
+	movq	0(%rbp), %r10
+	leaq	24(%rbp), %rsi
+	cmpq	$23, %r11
+	je	.L2016
+	movq	24(%rbp), %rsi
+.L2016:
+	leaq	24(%rbx), %rdi
+	cmpq	$23, %r8
+	je	.L2018
+	movq	24(%rbx), %rdi
+.L2018:
+	cmpq	%r12, %r10
+	movq	%r12, %rdx
+	cmovbe	%r10, %rdx
+	testq	%rdx, %rdx
+	je	.L2019
+	movq	%r8, 96(%rsp)
+	movq	%r11, 88(%rsp)
+	movq	%r10, 80(%rsp)
+	movq	%r9, 64(%rsp)
+	movq	%rcx, 16(%rsp)
+	call	memcmp@PLT
+	movq	16(%rsp), %rcx
+	movq	64(%rsp), %r9
+	testl	%eax, %eax
+	movq	80(%rsp), %r10
+	movq	88(%rsp), %r11
+	movq	96(%rsp), %r8
+	je	.L2019
+	cmovs	%r11, %r8
+	cmovs	%r10, %r12
+	cmovs	%rbp, %rbx
+	cmovs	%r9, %r13
+	.p2align 4,,10
+	.p2align 3
+.L2014:
+	movq	32(%rsp), %rax
+	leaq	(%r14,%r14,2), %r14
+	leaq	24(%rbx), %rsi
+	salq	$4, %r14
+	addq	%rax, %r14
+	cmpq	$23, %r8
+	je	.L2022
+	movq	24(%rbx), %rsi
+.L2022:
+	leaq	24(%r14), %rdi
+	cmpq	$23, %r15
+	je	.L2024
+	movq	24(%r14), %rdi
+.L2024:
+	cmpq	%r12, %rcx
+	movq	%r12, %rdx
+	cmovbe	%rcx, %rdx
+	testq	%rdx, %rdx
+	jne	.L2479
+.L2025:
+	cmpq	%r12, %rcx
+	jb	.L2028
+.L2027:
+	subq	$1, 40(%rsp)
+	movq	40(%rsp), %rax
+	subq	$2, 104(%rsp)
+	subq	$48, 112(%rsp)
+	cmpq	$-1, %rax
+	jne	.L2013
+	movq	48(%rsp), %rax
+	movq	32(%rsp), %rcx
+	leaq	-1(%rax), %r14
+	leaq	(%rax,%rax,2), %rax
+	salq	$4, %rax
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	leaq	-24(%rcx,%rax), %r15
+	je	.L2480
+	.p2align 4,,10
+	.p2align 3
+.L2048:
+	movq	32(%rsp), %rax
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 240(%rsp)
+	movdqu	(%rax), %xmm5
+	movq	8(%rax), %r12
+	movq	%rax, %rcx
+	movq	16(%rax), %rbp
+	movhlps	%xmm5, %xmm3
+	movaps	%xmm5, (%rsp)
+	movq	%xmm3, %rbx
+	cmpq	$23, %rbx
+	je	.L2481
+	movq	24(%rax), %rax
+	movq	$23, 8(%rcx)
+	movq	$0, (%rcx)
+	movq	%rax, 232(%rsp)
+	leaq	-24(%r15), %rax
+	movb	$0, 24(%rcx)
+	cmpq	%rax, %rcx
+	je	.L2482
+.L2051:
+	movq	32(%rsp), %rcx
+	movq	$0, (%rcx)
+	movb	$0, 24(%rcx)
+	movq	-24(%r15), %rax
+	movq	-8(%r15), %rdx
+	movq	%rax, (%rcx)
+	movq	-16(%r15), %rax
+	movq	%rdx, 16(%rcx)
+	movq	%rax, 8(%rcx)
+	cmpq	$23, %rax
+	je	.L2483
+	movq	(%r15), %rax
+	movq	%rax, 24(%rcx)
+	movq	$23, -16(%r15)
+	movq	$0, -24(%r15)
+	movb	$0, (%r15)
+.L2057:
+	movdqa	(%rsp), %xmm3
+	movq	%rbp, -8(%r15)
+	movups	%xmm3, -24(%r15)
+	cmpq	$23, %rbx
+	je	.L2055
+.L2054:
+	movq	232(%rsp), %rax
+	movq	%rax, (%r15)
+.L2061:
+	cmpq	$1, %r14
+	je	.L1667
+	movq	32(%rsp), %rax
+	movl	$1, %r12d
+	xorl	%r8d, %r8d
+	movdqu	(%rax), %xmm3
+	movq	8(%rax), %rax
+	movhlps	%xmm3, %xmm5
+	movq	%rax, 104(%rsp)
+	movaps	%xmm3, (%rsp)
+	movq	%xmm5, %r13
+	jmp	.L2093
+	.p2align 4,,10
+	.p2align 3
+.L2488:
+	movq	%rcx, 48(%rsp)
+	movq	%r9, 40(%rsp)
+	movq	%r8, 16(%rsp)
+	call	memcmp@PLT
+	movq	16(%rsp), %r8
+	movq	40(%rsp), %r9
+	testl	%eax, %eax
+	movq	48(%rsp), %rcx
+	je	.L2074
+	jns	.L2076
+.L2077:
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L2484
+.L2078:
+	pxor	%xmm0, %xmm0
+	movq	16(%r8), %rbp
+	movaps	%xmm0, 240(%rsp)
+	cmpq	$23, %r13
+	je	.L2485
+	movq	24(%r8), %rax
+	movq	$23, 8(%r8)
+	movq	$0, (%r8)
+	movq	%rax, 232(%rsp)
+	movb	$0, 24(%r8)
+	cmpq	%r8, %rbx
+	je	.L2486
+.L2082:
+	movq	$0, (%r8)
+	movb	$0, 24(%r8)
+	movq	(%rbx), %rax
+	movq	16(%rbx), %rdx
+	movq	%rax, (%r8)
+	movq	8(%rbx), %rax
+	movq	%rdx, 16(%r8)
+	movq	%rax, 8(%r8)
+	cmpq	$23, %rax
+	je	.L2487
+	movq	24(%rbx), %rax
+	movq	%rax, 24(%r8)
+	movq	$23, 8(%rbx)
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+.L2088:
+	movdqa	(%rsp), %xmm7
+	movq	%rbp, 16(%rbx)
+	movups	%xmm7, (%rbx)
+	cmpq	$23, %r13
+	je	.L2086
+.L2085:
+	movq	232(%rsp), %rax
+	movq	%rax, 24(%rbx)
+	leaq	1(%r12,%r12), %rax
+	cmpq	%r14, %rax
+	jnb	.L2076
+.L2092:
+	movq	%r12, %r8
+	movq	%rax, %r12
+.L2093:
+	movq	32(%rsp), %rsi
+	leaq	(%r12,%r12,2), %rbx
+	leaq	1(%r8), %rax
+	movq	(%rsp), %r9
+	salq	$4, %rbx
+	leaq	(%rax,%rax), %r11
+	addq	%rsi, %rbx
+	movq	(%rbx), %rcx
+	movq	8(%rbx), %r10
+	cmpq	%r14, %r11
+	jnb	.L2063
+	addq	%r11, %rax
+	salq	$5, %rax
+	leaq	(%rsi,%rax), %rbp
+	movq	0(%rbp), %rax
+	leaq	24(%rbp), %rsi
+	movq	%rax, 16(%rsp)
+	movq	8(%rbp), %rax
+	movq	%rax, 40(%rsp)
+	cmpq	$23, %rax
+	je	.L2065
+	movq	24(%rbp), %rsi
+.L2065:
+	leaq	24(%rbx), %rdi
+	cmpq	$23, %r10
+	je	.L2067
+	movq	24(%rbx), %rdi
+.L2067:
+	movq	16(%rsp), %rax
+	cmpq	%rcx, %rax
+	movq	%rax, %rdx
+	cmova	%rcx, %rdx
+	testq	%rdx, %rdx
+	je	.L2068
+	movq	%rcx, 96(%rsp)
+	movq	%r9, 88(%rsp)
+	movq	%r10, 80(%rsp)
+	movq	%r8, 64(%rsp)
+	movq	%r11, 48(%rsp)
+	call	memcmp@PLT
+	movq	48(%rsp), %r11
+	movq	64(%rsp), %r8
+	testl	%eax, %eax
+	movq	80(%rsp), %r10
+	movq	88(%rsp), %r9
+	movq	96(%rsp), %rcx
+	je	.L2068
+	cmovs	40(%rsp), %r10
+	cmovs	16(%rsp), %rcx
+	cmovs	%rbp, %rbx
+	cmovs	%r11, %r12
+	.p2align 4,,10
+	.p2align 3
+.L2063:
+	movq	32(%rsp), %rax
+	leaq	(%r8,%r8,2), %r8
+	leaq	24(%rbx), %rsi
+	salq	$4, %r8
+	addq	%rax, %r8
+	cmpq	$23, %r10
+	je	.L2071
+	movq	24(%rbx), %rsi
+.L2071:
+	leaq	24(%r8), %rdi
+	cmpq	$23, %r13
+	je	.L2073
+	movq	24(%r8), %rdi
+.L2073:
+	cmpq	%rcx, %r9
+	movq	%rcx, %rdx
+	cmovbe	%r9, %rdx
+	testq	%rdx, %rdx
+	jne	.L2488
+.L2074:
+	cmpq	%rcx, %r9
+	jb	.L2077
+.L2076:
+	subq	$1, %r14
+	subq	$48, %r15
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	jne	.L2048
+.L2480:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	jne	.L2048
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2048
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2048
+.L2489:
+	movdqa	(%rsp), %xmm6
+	movq	%rbp, 16(%rbx)
+	movups	%xmm6, (%rbx)
+.L2086:
+	movq	248(%rsp), %rax
+	movdqu	232(%rsp), %xmm7
+	movq	%rax, 40(%rbx)
+	leaq	1(%r12,%r12), %rax
+	movups	%xmm7, 24(%rbx)
+	cmpq	%r14, %rax
+	jb	.L2092
+	jmp	.L2076
+.L2490:
+	movdqa	(%rsp), %xmm5
+	movq	%rbp, 16(%rbx)
+	movups	%xmm5, (%rbx)
+.L2037:
+	movq	248(%rsp), %rax
+	movq	48(%rsp), %rcx
+	movdqu	232(%rsp), %xmm4
+	movq	%rax, 40(%rbx)
+	leaq	1(%r13,%r13), %rax
+	movups	%xmm4, 24(%rbx)
+	cmpq	%rcx, %rax
+	jb	.L2043
+	jmp	.L2027
+	.p2align 4,,10
+	.p2align 3
+.L2068:
+	movq	16(%rsp), %rax
+	cmpq	%rax, %rcx
+	jnb	.L2063
+	movq	40(%rsp), %r10
+	movq	%rax, %rcx
+	movq	%rbp, %rbx
+	movq	%r11, %r12
+	jmp	.L2063
+	.p2align 4,,10
+	.p2align 3
+.L2019:
+	cmpq	%r10, %r12
+	jnb	.L2014
+	movq	%r11, %r8
+	movq	%r10, %r12
+	movq	%rbp, %rbx
+	movq	%r9, %r13
+	jmp	.L2014
+	.p2align 4,,10
+	.p2align 3
+.L2486:
+	movdqa	(%rsp), %xmm7
+	movq	%rbp, 16(%rbx)
+	movups	%xmm7, (%rbx)
+	jmp	.L2085
+	.p2align 4,,10
+	.p2align 3
+.L2477:
+	movdqa	(%rsp), %xmm6
+	movq	%rbp, 16(%rbx)
+	movups	%xmm6, (%rbx)
+	jmp	.L2036
+	.p2align 4,,10
+	.p2align 3
+.L2485:
+	movdqu	24(%r8), %xmm7
+	movq	40(%r8), %rax
+	movq	$0, (%r8)
+	movb	$0, 24(%r8)
+	movq	%rax, 248(%rsp)
+	movups	%xmm7, 232(%rsp)
+	cmpq	%r8, %rbx
+	jne	.L2082
+	movq	8(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L2489
+.L2084:
+	movq	16(%rbx), %rdi
+	movq	24(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB88:
+	call	*24(%rax)
+.LEHE88:
+	jmp	.L2088
+	.p2align 4,,10
+	.p2align 3
+.L2476:
+	movdqu	24(%r14), %xmm6
+	movq	40(%r14), %rax
+	movq	$0, (%r14)
+	movb	$0, 24(%r14)
+	movq	%rax, 248(%rsp)
+	movups	%xmm6, 232(%rsp)
+	cmpq	%rbx, %r14
+	jne	.L2033
+	movq	8(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L2490
+.L2035:
+	movq	16(%rbx), %rdi
+	movq	24(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB89:
+	call	*24(%rax)
+.LEHE89:
+	jmp	.L2039
+.L2475:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2030
+.L2414:
+	movdqu	(%r14), %xmm7
+	movq	8(%r14), %rax
+	movaps	%xmm7, (%rsp)
+	psrldq	$8, %xmm7
+	movq	%rax, 120(%rsp)
+	movq	%xmm7, %r15
+	jmp	.L2029
+.L2484:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2079
+.L2415:
+	movdqu	(%r8), %xmm6
+	movq	8(%r8), %rax
+	movhlps	%xmm6, %xmm5
+	movq	%rax, 104(%rsp)
+	movaps	%xmm6, (%rsp)
+	movq	%xmm5, %r13
+	jmp	.L2078
+.L2478:
+	movdqu	24(%rbx), %xmm5
+	movups	%xmm5, 24(%r14)
+	movq	40(%rbx), %rax
+	movq	%rax, 40(%r14)
+	movq	8(%rbx), %rdx
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+	cmpq	$23, %rdx
+	jne	.L2035
+	jmp	.L2039
+.L2487:
+	movdqu	24(%rbx), %xmm3
+	movups	%xmm3, 24(%r8)
+	movq	40(%rbx), %rax
+	movq	%rax, 40(%r8)
+	movq	8(%rbx), %rdx
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+	cmpq	$23, %rdx
+	jne	.L2084
+	jmp	.L2088
+.L2079:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%r8, (%rsp)
+	call	__cxa_guard_acquire@PLT
+	movq	(%rsp), %r8
+	testl	%eax, %eax
+	jne	.L2080
+	movdqu	(%r8), %xmm4
+	movq	8(%r8), %rax
+	movhlps	%xmm4, %xmm7
+	movq	%rax, 104(%rsp)
+	movaps	%xmm4, (%rsp)
+	movq	%xmm7, %r13
+	jmp	.L2078
+.L2030:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2414
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movdqu	(%r14), %xmm5
+	movq	8(%r14), %rax
+	movaps	%xmm5, (%rsp)
+	psrldq	$8, %xmm5
+	movq	%rax, 120(%rsp)
+	movq	%xmm5, %r15
+	jmp	.L2029
+.L2481:
+	movdqu	24(%rax), %xmm6
+	movq	40(%rax), %rax
+	movq	$0, (%rcx)
+	movb	$0, 24(%rcx)
+	movq	%rax, 248(%rsp)
+	leaq	-24(%r15), %rax
+	movaps	%xmm6, 16(%rsp)
+	movups	%xmm6, 232(%rsp)
+	cmpq	%rax, %rcx
+	jne	.L2051
+	movq	-16(%r15), %rax
+	cmpq	$23, %rax
+	jne	.L2053
+	movq	%rbp, -8(%r15)
+	movups	%xmm5, -24(%r15)
+.L2055:
+	movdqu	232(%rsp), %xmm6
+	movq	248(%rsp), %rax
+	movups	%xmm6, (%r15)
+	movq	%rax, 16(%r15)
+	jmp	.L2061
+.L2482:
+	movq	-16(%r15), %rax
+	cmpq	$23, %rax
+	je	.L2491
+.L2053:
+	movq	-8(%r15), %rdi
+	leaq	1(%rax), %rdx
+	movq	(%r15), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB90:
+	call	*24(%rax)
+.LEHE90:
+	jmp	.L2057
+.L2080:
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%r8, (%rsp)
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movq	(%rsp), %r8
+	jmp	.L2415
+.L2483:
+	movdqu	(%r15), %xmm5
+	movups	%xmm5, 24(%rcx)
+	movq	16(%r15), %rax
+	movq	%rax, 40(%rcx)
+	movq	-16(%r15), %rax
+	movq	$0, -24(%r15)
+	movb	$0, (%r15)
+	cmpq	$23, %rax
+	jne	.L2053
+	jmp	.L2057
+.L2469:
+	movdqu	232(%rsp), %xmm4
+	movq	248(%rsp), %rax
+	movups	%xmm4, -24(%r13)
+	movq	%rax, -8(%r13)
+	jmp	.L2416
+.L1668:
+	testb	%cl, %cl
+	je	.L1670
+	movq	32(%rsp), %rcx
+	cmpq	%rcx, %rsi
+	je	.L1667
+	leaq	48(%rcx), %rbp
+	cmpq	%rsi, %rbp
+	jnb	.L1667
+	leaq	232(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	jmp	.L1698
+.L2492:
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L1676
+	js	.L1679
+.L1678:
+	movq	88(%rsp), %rax
+	addq	$48, %rbp
+	cmpq	%rax, %rbp
+	jnb	.L1667
+.L1698:
+	cmpq	$23, -40(%rbp)
+	movq	-48(%rbp), %rbx
+	leaq	-24(%rbp), %rsi
+	je	.L1673
+	movq	-24(%rbp), %rsi
+.L1673:
+	movdqu	0(%rbp), %xmm4
+	movq	8(%rbp), %r14
+	leaq	24(%rbp), %rdi
+	movhlps	%xmm4, %xmm3
+	movaps	%xmm4, (%rsp)
+	movq	%xmm4, %r12
+	movq	%xmm3, %r13
+	cmpq	$23, %r13
+	je	.L1675
+	movq	24(%rbp), %rdi
+.L1675:
+	cmpq	%r12, %rbx
+	movq	%r12, %rdx
+	cmovbe	%rbx, %rdx
+	testq	%rdx, %rdx
+	jne	.L2492
+.L1676:
+	cmpq	%rbx, %r12
+	jnb	.L1678
+.L1679:
+	movdqa	.LC33(%rip), %xmm7
+	movaps	%xmm7, 208(%rsp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L2493
+.L1680:
+	movdqa	(%rsp), %xmm5
+	movq	16(%rbp), %r15
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 240(%rsp)
+	movq	%r15, 224(%rsp)
+	movaps	%xmm5, 208(%rsp)
+	cmpq	$23, %r13
+	je	.L2494
+	movq	24(%rbp), %rax
+	movq	$23, 8(%rbp)
+	movq	%rax, 232(%rsp)
+.L1684:
+	movq	$0, 0(%rbp)
+	movq	%rbp, %rbx
+	movb	$0, 24(%rbp)
+.L2320:
+	movq	8(%rbx), %rax
+	cmpq	$23, %rax
+	je	.L1685
+	movq	16(%rbx), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%rbx), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB91:
+	call	*24(%rax)
+	movq	$23, 8(%rbx)
+.L1685:
+	movq	-48(%rbx), %rax
+	movq	-32(%rbx), %rdx
+	subq	$48, %rbx
+	movb	$0, 72(%rbx)
+	movq	%rax, 48(%rbx)
+	movq	8(%rbx), %rax
+	movq	%rdx, 64(%rbx)
+	movq	%rax, 56(%rbx)
+	cmpq	$23, %rax
+	je	.L2495
+	movq	24(%rbx), %rax
+	movq	$23, 8(%rbx)
+	movq	%rax, 72(%rbx)
+.L1687:
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+	cmpq	%rbx, 32(%rsp)
+	je	.L1688
+	cmpq	$23, -40(%rbx)
+	movq	-48(%rbx), %rcx
+	leaq	-24(%rbx), %rsi
+	je	.L1690
+	movq	-24(%rbx), %rsi
+.L1690:
+	movq	16(%rsp), %rdi
+	cmpq	$23, %r13
+	je	.L1691
+	movq	232(%rsp), %rdi
+.L1691:
+	cmpq	%r12, %rcx
+	movq	%r12, %rdx
+	cmovbe	%rcx, %rdx
+	testq	%rdx, %rdx
+	je	.L1692
+	movq	%rcx, 40(%rsp)
+	call	memcmp@PLT
+	movq	40(%rsp), %rcx
+	testl	%eax, %eax
+	je	.L1692
+	js	.L2320
+	jmp	.L1688
+	.p2align 4,,10
+	.p2align 3
+.L1692:
+	cmpq	%rcx, %r12
+	jb	.L2320
+.L1688:
+	movq	8(%rbx), %rax
+	cmpq	$23, %rax
+	je	.L1695
+	movq	16(%rbx), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%rbx), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE91:
+.L1695:
+	movdqa	(%rsp), %xmm5
+	movq	%r15, 16(%rbx)
+	movups	%xmm5, (%rbx)
+	cmpq	$23, %r13
+	je	.L2496
+	movq	232(%rsp), %rax
+	movq	%rax, 24(%rbx)
+	jmp	.L1678
+.L2495:
+	movdqu	24(%rbx), %xmm7
+	movq	40(%rbx), %rax
+	movups	%xmm7, 72(%rbx)
+	movq	%rax, 88(%rbx)
+	jmp	.L1687
+.L2452:
+	movq	32(%rsp), %rcx
+	movdqu	24(%rcx), %xmm6
+	movq	40(%rcx), %rdx
+	movaps	%xmm6, (%rsp)
+	movq	(%rsp), %rax
+	movq	%rdx, 200(%rsp)
+	movq	%rax, %r14
+	movups	%xmm6, 184(%rsp)
+	movq	%rcx, %rax
+	jmp	.L1888
+.L2152:
+	cmpq	%rcx, %r13
+	jb	.L2328
+.L2148:
+	movq	8(%rbp), %rax
+	cmpq	$23, %rax
+	je	.L2155
+	movq	16(%rbp), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%rbp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB92:
+	call	*24(%rax)
+.LEHE92:
+.L2155:
+	movdqa	48(%rsp), %xmm4
+	movq	80(%rsp), %rax
+	cmpq	$23, 16(%rsp)
+	movq	%rax, 16(%rbp)
+	movups	%xmm4, 0(%rbp)
+	je	.L2497
+	movq	232(%rsp), %rax
+	movq	%rax, 24(%rbp)
+.L2417:
+	movabsq	$-6148914691236517205, %rdx
+	movq	%r12, %rax
+	subq	%rbp, %rax
+	sarq	$4, %rax
+	imulq	%rdx, %rax
+	addq	%rax, 64(%rsp)
+	cmpq	$8, 64(%rsp)
+	jbe	.L2138
+	leaq	48(%r12), %rax
+	cmpq	%rax, 88(%rsp)
+	jne	.L2418
+	jmp	.L1667
+	.p2align 4,,10
+	.p2align 3
+.L2473:
+	movdqu	24(%rbp), %xmm6
+	movq	40(%rbp), %rax
+	movups	%xmm6, 72(%rbp)
+	movq	%rax, 88(%rbp)
+	jmp	.L2147
+.L2451:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1885
+	movq	32(%rsp), %rax
+	movdqu	(%rax), %xmm3
+	movaps	%xmm3, 64(%rsp)
+	movq	%xmm3, %r15
+	movhps	%xmm3, 16(%rsp)
+	jmp	.L1884
+.L2459:
+	movdqu	184(%rsp), %xmm6
+	movq	200(%rsp), %rax
+	movups	%xmm6, 24(%rbx)
+	movq	%rax, 40(%rbx)
+	jmp	.L1944
+.L2458:
+	movdqu	24(%rbx), %xmm3
+	movups	%xmm3, 24(%rcx)
+	movq	40(%rbx), %rax
+	movq	%rax, 40(%rcx)
+	movq	8(%rbx), %r12
+	movq	$0, (%rbx)
+	movb	$0, 24(%rbx)
+	jmp	.L1938
+.L2466:
+	movdqu	24(%r12), %xmm3
+	movq	40(%r12), %rax
+	movups	%xmm3, 232(%rsp)
+	movq	%rax, 248(%rsp)
+	jmp	.L2115
+.L2465:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2112
+	movdqu	(%r12), %xmm3
+	movq	8(%r12), %rax
+	movaps	%xmm3, 48(%rsp)
+	movq	%xmm3, %r15
+	movq	%rax, 64(%rsp)
+	movhps	%xmm3, 16(%rsp)
+	jmp	.L2111
+.L2491:
+	movq	%rbp, -8(%r15)
+	movups	%xmm5, -24(%r15)
+	jmp	.L2054
+.L2497:
+	movdqu	232(%rsp), %xmm7
+	movq	248(%rsp), %rax
+	movups	%xmm7, 24(%rbp)
+	movq	%rax, 40(%rbp)
+	jmp	.L2417
+.L2446:
+	movdqu	24(%rbp), %xmm3
+	movq	40(%rbp), %rax
+	movups	%xmm3, 232(%rsp)
+	movq	%rax, 248(%rsp)
+	jmp	.L1713
+.L2445:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1710
+	movdqu	0(%rbp), %xmm3
+	movq	8(%rbp), %r14
+	movhlps	%xmm3, %xmm5
+	movaps	%xmm3, (%rsp)
+	movq	%xmm3, %r12
+	movq	%xmm5, %r13
+	jmp	.L1709
+.L1885:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	jne	.L1886
+	movq	32(%rsp), %rax
+	movdqu	(%rax), %xmm7
+	movaps	%xmm7, 64(%rsp)
+	movq	%xmm7, %r15
+	movhps	%xmm7, 16(%rsp)
+	jmp	.L1884
+.L2494:
+	movdqu	24(%rbp), %xmm4
+	movq	40(%rbp), %rax
+	movups	%xmm4, 232(%rsp)
+	movq	%rax, 248(%rsp)
+	jmp	.L1684
+.L2493:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1681
+	movdqu	0(%rbp), %xmm3
+	movq	8(%rbp), %r14
+	movaps	%xmm3, (%rsp)
+	movq	%xmm3, %r12
+	psrldq	$8, %xmm3
+	movq	%xmm3, %r13
+	jmp	.L1680
+.L2448:
+	movdqu	232(%rsp), %xmm4
+	movq	248(%rsp), %rax
+	movups	%xmm4, 24(%rbx)
+	movq	%rax, 40(%rbx)
+	jmp	.L1707
+.L2496:
+	movdqu	232(%rsp), %xmm6
+	movq	248(%rsp), %rax
+	movups	%xmm6, 24(%rbx)
+	movq	%rax, 40(%rbx)
+	jmp	.L1678
+.L2112:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	jne	.L2113
+	movdqu	(%r12), %xmm7
+	movq	8(%r12), %rax
+	movaps	%xmm7, 48(%rsp)
+	movq	%xmm7, %r15
+	movq	%rax, 64(%rsp)
+	movhps	%xmm7, 16(%rsp)
+	jmp	.L2111
+.L2472:
+	movdqu	24(%r12), %xmm5
+	movq	40(%r12), %rax
+	movups	%xmm5, 232(%rsp)
+	movq	%rax, 248(%rsp)
+	jmp	.L2144
+.L2471:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2141
+	movdqu	(%r12), %xmm4
+	movq	8(%r12), %r15
+	movaps	%xmm4, 48(%rsp)
+	movq	%xmm4, %r13
+	movhps	%xmm4, 16(%rsp)
+	jmp	.L2140
+.L1681:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	jne	.L1682
+	movdqu	0(%rbp), %xmm4
+	movq	8(%rbp), %r14
+	movhlps	%xmm4, %xmm0
+	movaps	%xmm4, (%rsp)
+	movq	%xmm4, %r12
+	movq	%xmm0, %r13
+	jmp	.L1680
+.L1886:
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movq	32(%rsp), %rax
+	movdqu	(%rax), %xmm5
+	movaps	%xmm5, 64(%rsp)
+	movq	%xmm5, %r15
+	movhps	%xmm5, 16(%rsp)
+	jmp	.L1884
+.L2141:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	jne	.L2142
+	movdqu	(%r12), %xmm6
+	movq	8(%r12), %r15
+	movaps	%xmm6, 48(%rsp)
+	movq	%xmm6, %r13
+	movhps	%xmm6, 16(%rsp)
+	jmp	.L2140
+.L1682:
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movdqu	0(%rbp), %xmm7
+	movq	8(%rbp), %r14
+	movaps	%xmm7, (%rsp)
+	movq	%xmm7, %r12
+	psrldq	$8, %xmm7
+	movq	%xmm7, %r13
+	jmp	.L1680
+.L2142:
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movdqu	(%r12), %xmm3
+	movq	8(%r12), %r15
+	movaps	%xmm3, 48(%rsp)
+	movq	%xmm3, %r13
+	movhps	%xmm3, 16(%rsp)
+	jmp	.L2140
+.L1710:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	jne	.L1711
+	movdqu	0(%rbp), %xmm6
+	movq	8(%rbp), %r14
+	movhlps	%xmm6, %xmm3
+	movaps	%xmm6, (%rsp)
+	movq	%xmm6, %r12
+	movq	%xmm3, %r13
+	jmp	.L1709
+.L1711:
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movdqu	0(%rbp), %xmm4
+	movq	8(%rbp), %r14
+	movhlps	%xmm4, %xmm0
+	movaps	%xmm4, (%rsp)
+	movq	%xmm4, %r12
+	movq	%xmm0, %r13
+	jmp	.L1709
+.L2113:
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movdqu	(%r12), %xmm5
+	movq	8(%r12), %rax
+	movaps	%xmm5, 48(%rsp)
+	movq	%xmm5, %r15
+	movq	%rax, 64(%rsp)
+	movhps	%xmm5, 16(%rsp)
+	jmp	.L2111
+.L2175:
+	movq	104(%rsp), %rbx
+	jmp	.L1961
+.L2191:
+	movq	%rax, %rbx
+	jmp	.L2130
+.L2184:
+	movq	%rax, %rbx
+	jmp	.L1924
+.L2181:
+	movq	%rax, %rbx
+	jmp	.L1699
+.L2190:
+	movq	%rax, %rbx
+	jmp	.L2089
+.L2192:
+	movq	%rax, %rbx
+	jmp	.L2159
+.L2189:
+	movq	%rax, %rbx
+	jmp	.L2058
+.L2183:
+	movq	%rax, %rbx
+	jmp	.L1845
+.L2186:
+	movq	%rax, %rbx
+	jmp	.L1988
+.L2182:
+	movq	%rax, %rbx
+	jmp	.L1728
+.L2188:
+	movq	%rax, %rbx
+	jmp	.L2040
+.L2185:
+	movq	%rax, %rbx
+	jmp	.L1919
+.L2187:
+	movq	%rax, %rbx
+	jmp	.L1983
+	.section	.gcc_except_table
+.LLSDA7155:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7155-.LLSDACSB7155
+.LLSDACSB7155:
+	.uleb128 .LEHB74-.LFB7155
+	.uleb128 .LEHE74-.LEHB74
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB75-.LFB7155
+	.uleb128 .LEHE75-.LEHB75
+	.uleb128 .L2183-.LFB7155
+	.uleb128 0
+	.uleb128 .LEHB76-.LFB7155
+	.uleb128 .LEHE76-.LEHB76
+	.uleb128 .L2186-.LFB7155
+	.uleb128 0
+	.uleb128 .LEHB77-.LFB7155
+	.uleb128 .LEHE77-.LEHB77
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB78-.LFB7155
+	.uleb128 .LEHE78-.LEHB78
+	.uleb128 .L2182-.LFB7155
+	.uleb128 0
+	.uleb128 .LEHB79-.LFB7155
+	.uleb128 .LEHE79-.LEHB79
+	.uleb128 .L2187-.LFB7155
+	.uleb128 0
+	.uleb128 .LEHB80-.LFB7155
+	.uleb128 .LEHE80-.LEHB80
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB81-.LFB7155
+	.uleb128 .LEHE81-.LEHB81
+	.uleb128 .L2184-.LFB7155
+	.uleb128 0
+	.uleb128 .LEHB82-.LFB7155
+	.uleb128 .LEHE82-.LEHB82
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB83-.LFB7155
+	.uleb128 .LEHE83-.LEHB83
+	.uleb128 .L2186-.LFB7155
+	.uleb128 0
+	.uleb128 .LEHB84-.LFB7155
+	.uleb128 .LEHE84-.LEHB84
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB85-.LFB7155
+	.uleb128 .LEHE85-.LEHB85
+	.uleb128 .L2185-.LFB7155
+	.uleb128 0
+	.uleb128 .LEHB86-.LFB7155
+	.uleb128 .LEHE86-.LEHB86
+	.uleb128 .L2191-.LFB7155
+	.uleb128 0
+	.uleb128 .LEHB87-.LFB7155
+	.uleb128 .LEHE87-.LEHB87
+	.uleb128 .L2192-.LFB7155
+	.uleb128 0
+	.uleb128 .LEHB88-.LFB7155
+	.uleb128 .LEHE88-.LEHB88
+	.uleb128 .L2190-.LFB7155
+	.uleb128 0
+	.uleb128 .LEHB89-.LFB7155
+	.uleb128 .LEHE89-.LEHB89
+	.uleb128 .L2188-.LFB7155
+	.uleb128 0
+	.uleb128 .LEHB90-.LFB7155
+	.uleb128 .LEHE90-.LEHB90
+	.uleb128 .L2189-.LFB7155
+	.uleb128 0
+	.uleb128 .LEHB91-.LFB7155
+	.uleb128 .LEHE91-.LEHB91
+	.uleb128 .L2181-.LFB7155
+	.uleb128 0
+	.uleb128 .LEHB92-.LFB7155
+	.uleb128 .LEHE92-.LEHB92
+	.uleb128 .L2192-.LFB7155
+	.uleb128 0
+.LLSDACSE7155:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7155
+	.type	_ZN1n9__pdqsortINS_6stringIcEENS_4lessEEEvPT_S5_RT0_ib.isra.0.cold, @function
+_ZN1n9__pdqsortINS_6stringIcEENS_4lessEEEvPT_S5_RT0_ib.isra.0.cold:
+.LFSB7155:
+.L2130:
+	.cfi_def_cfa_offset 320
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	cmpq	$23, 64(%rsp)
+	je	.L2131
+	movq	112(%rsp), %rdi
+	movq	64(%rsp), %rdx
+	movl	$1, %ecx
+	movq	232(%rsp), %rsi
+	movq	(%rdi), %rax
+	addq	$1, %rdx
+	call	*24(%rax)
+.L2131:
+	movq	%rbx, %rdi
+.LEHB93:
+	call	_Unwind_Resume@PLT
+.LEHE93:
+.L1919:
+	cmpq	$23, %r14
+	je	.L1924
+	movq	0(%r13), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	movq	%r13, %rdi
+	movq	232(%rsp), %rsi
+	call	*24(%rax)
+.L1924:
+	movq	168(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L1946
+	movq	176(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	184(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1946:
+	movq	%rbx, %rdi
+.LEHB94:
+	call	_Unwind_Resume@PLT
+.LEHE94:
+.L1699:
+	cmpq	$23, %r14
+	je	.L1700
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	movq	%r15, %rdi
+	movq	232(%rsp), %rsi
+	call	*24(%rax)
+.L1700:
+	movq	%rbx, %rdi
+.LEHB95:
+	call	_Unwind_Resume@PLT
+.LEHE95:
+.L2089:
+	cmpq	$23, 104(%rsp)
+	je	.L2091
+	movq	104(%rsp), %rdx
+	movq	0(%rbp), %rax
+	movl	$1, %ecx
+	movq	%rbp, %rdi
+	movq	232(%rsp), %rsi
+	addq	$1, %rdx
+	call	*24(%rax)
+.L2091:
+	movq	%rbx, %rdi
+.LEHB96:
+	call	_Unwind_Resume@PLT
+.LEHE96:
+.L2159:
+	cmpq	$23, %r15
+	je	.L2160
+	movq	80(%rsp), %rdi
+	leaq	1(%r15), %rdx
+	movl	$1, %ecx
+	movq	232(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2160:
+	movq	%rbx, %rdi
+.LEHB97:
+	call	_Unwind_Resume@PLT
+.LEHE97:
+.L2058:
+	cmpq	$23, %r12
+	je	.L2060
+	movq	0(%rbp), %rax
+	movq	232(%rsp), %rsi
+	leaq	1(%r12), %rdx
+	movq	%rbp, %rdi
+	movl	$1, %ecx
+	call	*24(%rax)
+.L2060:
+	movq	%rbx, %rdi
+.LEHB98:
+	call	_Unwind_Resume@PLT
+.LEHE98:
+.L1845:
+	cmpq	$23, %r13
+	je	.L1847
+	movq	(%r12), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	movq	%r12, %rdi
+	movq	232(%rsp), %rsi
+	call	*24(%rax)
+.L1847:
+	movq	%rbx, %rdi
+.LEHB99:
+	call	_Unwind_Resume@PLT
+.LEHE99:
+.L1983:
+	cmpq	$23, %r13
+	je	.L1988
+	movq	(%r14), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	movq	%r14, %rdi
+	movq	232(%rsp), %rsi
+	call	*24(%rax)
+.L1988:
+	movq	168(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L2011
+	movq	176(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	184(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2011:
+	movq	%rbx, %rdi
+.LEHB100:
+	call	_Unwind_Resume@PLT
+.LEHE100:
+.L1728:
+	cmpq	$23, %r14
+	je	.L1729
+	movq	40(%rsp), %rdi
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	movq	232(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1729:
+	movq	%rbx, %rdi
+.LEHB101:
+	call	_Unwind_Resume@PLT
+.LEHE101:
+.L2040:
+	cmpq	$23, 120(%rsp)
+	je	.L2042
+	movq	120(%rsp), %rdx
+	movq	0(%rbp), %rax
+	movl	$1, %ecx
+	movq	%rbp, %rdi
+	movq	232(%rsp), %rsi
+	addq	$1, %rdx
+	call	*24(%rax)
+.L2042:
+	movq	%rbx, %rdi
+.LEHB102:
+	call	_Unwind_Resume@PLT
+.LEHE102:
+	.cfi_endproc
+.LFE7155:
+	.section	.gcc_except_table
+.LLSDAC7155:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7155-.LLSDACSBC7155
+.LLSDACSBC7155:
+	.uleb128 .LEHB93-.LCOLDB38
+	.uleb128 .LEHE93-.LEHB93
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB94-.LCOLDB38
+	.uleb128 .LEHE94-.LEHB94
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB95-.LCOLDB38
+	.uleb128 .LEHE95-.LEHB95
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB96-.LCOLDB38
+	.uleb128 .LEHE96-.LEHB96
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB97-.LCOLDB38
+	.uleb128 .LEHE97-.LEHB97
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB98-.LCOLDB38
+	.uleb128 .LEHE98-.LEHB98
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB99-.LCOLDB38
+	.uleb128 .LEHE99-.LEHB99
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB100-.LCOLDB38
+	.uleb128 .LEHE100-.LEHB100
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB101-.LCOLDB38
+	.uleb128 .LEHE101-.LEHB101
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB102-.LCOLDB38
+	.uleb128 .LEHE102-.LEHB102
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC7155:
+	.section	.text.unlikely
+	.text
+	.size	_ZN1n9__pdqsortINS_6stringIcEENS_4lessEEEvPT_S5_RT0_ib.isra.0, .-_ZN1n9__pdqsortINS_6stringIcEENS_4lessEEEvPT_S5_RT0_ib.isra.0
+	.section	.text.unlikely
+	.size	_ZN1n9__pdqsortINS_6stringIcEENS_4lessEEEvPT_S5_RT0_ib.isra.0.cold, .-_ZN1n9__pdqsortINS_6stringIcEENS_4lessEEEvPT_S5_RT0_ib.isra.0.cold
+.LCOLDE38:
+	.text
+.LHOTE38:
+	.section	.rodata.str1.1
+.LC39:
+	.string	"prefix-"
+.LC40:
+	.string	"expected true : same"
+	.section	.text.unlikely
+.LCOLDB42:
+	.text
+.LHOTB42:
+	.p2align 4
+	.globl	_Z23test_radix_sort_stringsv
+	.type	_Z23test_radix_sort_stringsv, @function
+_Z23test_radix_sort_stringsv:
+.LFB6808:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6808
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pxor	%xmm0, %xmm0
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$184, %rsp
+	.cfi_def_cfa_offset 240
+	movq	$0, 64(%rsp)
+	movups	%xmm0, 72(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rdx
+	testq	%rdx, %rdx
+	je	.L2499
+	movq	%rdx, 88(%rsp)
+	movq	%rdx, %rax
+	movq	$0, 96(%rsp)
+	movups	%xmm0, 104(%rsp)
+.L2500:
+	leaq	152(%rsp), %rsi
+	movq	%rdx, 120(%rsp)
+	movl	$3000, 60(%rsp)
+	movq	%rsi, 16(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L2623:
+	movdqa	.LC33(%rip), %xmm1
+	movaps	%xmm1, 128(%rsp)
+	testq	%rax, %rax
+	je	.L2507
+	movq	16(%rsp), %rsi
+	pxor	%xmm0, %xmm0
+	xorl	%ebp, %ebp
+	movq	%rax, 144(%rsp)
+	leaq	.LC39(%rip), %rax
+	movups	%xmm0, 152(%rsp)
+	movq	$0, 168(%rsp)
+	cmpq	%rsi, %rax
+	jb	.L2792
+.L2785:
+	leaq	.LC39(%rip), %rsi
+.L2520:
+	movq	16(%rsp), %rbx
+.L2508:
+	leaq	(%rbx,%rbp), %rdi
+	movl	$7, %edx
+	movabsq	$6364136223846793005, %r15
+	movabsq	$1442695040888963407, %r14
+	call	memmove@PLT
+	movq	128(%rsp), %rax
+	leaq	7(%rax), %rdx
+	movq	%rdx, 128(%rsp)
+	movb	$0, 7(%rbx,%rax)
+	movq	seed(%rip), %rbx
+	movabsq	$-6148914691236517205, %rax
+	imulq	%r15, %rbx
+	addq	%r14, %rbx
+	movq	%rbx, %rcx
+	shrq	$33, %rcx
+	mulq	%rcx
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,2), %rax
+	salq	$2, %rax
+	subq	%rax, %rcx
+	movl	%ecx, 8(%rsp)
+	testl	%ecx, %ecx
+	je	.L2521
+	xorl	%r13d, %r13d
+	jmp	.L2528
+	.p2align 4,,10
+	.p2align 3
+.L2794:
+	movq	152(%rsp), %rdx
+	addl	$1, %r13d
+	movb	%bl, (%rdx,%rbp)
+	movq	128(%rsp), %rax
+	leaq	1(%rax), %rcx
+	movq	%rcx, 128(%rsp)
+	movb	$0, 1(%rdx,%rax)
+	cmpl	%r13d, 8(%rsp)
+	je	.L2527
+.L2526:
+	movq	seed(%rip), %rbx
+.L2528:
+	imulq	%r15, %rbx
+	movq	128(%rsp), %rbp
+	movabsq	$-6148914691236517205, %rax
+	movq	136(%rsp), %r12
+	addq	%r14, %rbx
+	movq	%rbx, seed(%rip)
+	shrq	$33, %rbx
+	mulq	%rbx
+	movq	%rdx, %rax
+	andq	$-2, %rdx
+	shrq	%rax
+	addq	%rax, %rdx
+	subq	%rdx, %rbx
+	addl	$97, %ebx
+	cmpq	%r12, %rbp
+	je	.L2793
+.L2522:
+	cmpq	$23, %r12
+	jne	.L2794
+	movb	%bl, 152(%rsp,%rbp)
+	movq	128(%rsp), %rax
+	addl	$1, %r13d
+	addq	$1, %rax
+	movq	%rax, 128(%rsp)
+	movb	$0, 152(%rsp,%rax)
+	cmpl	%r13d, 8(%rsp)
+	jne	.L2526
+.L2527:
+	movq	seed(%rip), %rbx
+.L2521:
+	movabsq	$6364136223846793005, %rax
+	imulq	%rax, %rbx
+	movabsq	$1442695040888963407, %rax
+	addq	%rax, %rbx
+	movq	%rbx, seed(%rip)
+	shrq	$33, %rbx
+	andl	$3, %ebx
+	jne	.L2529
+	movq	128(%rsp), %rbx
+	movq	136(%rsp), %rbp
+	cmpq	%rbp, %rbx
+	je	.L2795
+.L2530:
+	movq	16(%rsp), %rax
+	cmpq	$23, %rbp
+	je	.L2533
+	movq	152(%rsp), %rax
+.L2533:
+	movb	$-23, (%rax,%rbx)
+	movq	128(%rsp), %rdx
+	leaq	1(%rdx), %rcx
+	movq	%rcx, 128(%rsp)
+	movb	$0, 1(%rax,%rdx)
+.L2529:
+	movq	80(%rsp), %rbp
+	movq	72(%rsp), %r12
+	movq	64(%rsp), %r13
+	cmpq	%r12, %rbp
+	je	.L2796
+	leaq	0(%rbp,%rbp,2), %rbx
+	movdqa	.LC33(%rip), %xmm2
+	salq	$4, %rbx
+	addq	%r13, %rbx
+	movups	%xmm2, (%rbx)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L2797
+	pxor	%xmm0, %xmm0
+	movq	%rax, 16(%rbx)
+	cmpq	$23, 136(%rsp)
+	movq	$0, 40(%rbx)
+	movq	128(%rsp), %r12
+	movups	%xmm0, 24(%rbx)
+	je	.L2704
+	movq	152(%rsp), %r14
+	movq	%r12, %rdx
+	xorl	%edi, %edi
+.L2673:
+	leaq	24(%rbx), %rbp
+	cmpq	%rbp, %r14
+	jnb	.L2798
+	.p2align 4,,10
+	.p2align 3
+.L2564:
+	movl	$23, %r13d
+	cmpq	$23, %rdx
+	jbe	.L2575
+.L2666:
+	leaq	10(%r13,%r13), %r13
+	movq	(%rax), %rcx
+	movq	%rax, %rdi
+	cmpq	%rdx, %r13
+	cmovb	%rdx, %r13
+	movl	$1, %edx
+	leaq	1(%r13), %rsi
+.LEHB103:
+	call	*16(%rcx)
+	movq	%rax, %rbp
+	movq	(%rbx), %rax
+	cmpq	$23, 8(%rbx)
+	leaq	24(%rbx), %rsi
+	leaq	1(%rax), %rdx
+	je	.L2568
+	movq	24(%rbx), %rsi
+.L2568:
+	movq	%rbp, %rdi
+	call	memcpy@PLT
+	movq	8(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L2569
+	movq	16(%rbx), %rdi
+	movq	24(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2569:
+	movq	%rbp, 24(%rbx)
+	movq	(%rbx), %rdi
+	movq	%r13, 8(%rbx)
+	cmpq	$23, %r13
+	je	.L2799
+.L2575:
+	movq	%r12, %rdx
+	addq	%rbp, %rdi
+	movq	%r14, %rsi
+	call	memmove@PLT
+	addq	(%rbx), %r12
+	movq	%r12, (%rbx)
+	movq	80(%rsp), %rbx
+	movb	$0, 0(%rbp,%r12)
+.L2557:
+	movq	112(%rsp), %rbp
+	movq	104(%rsp), %r13
+	addq	$1, %rbx
+	movq	%rbx, 80(%rsp)
+	movq	96(%rsp), %r14
+	cmpq	%r13, %rbp
+	je	.L2800
+	leaq	0(%rbp,%rbp,2), %rbx
+	movdqa	.LC33(%rip), %xmm3
+	salq	$4, %rbx
+	addq	%r14, %rbx
+	movups	%xmm3, (%rbx)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L2801
+	movq	136(%rsp), %rbp
+	pxor	%xmm0, %xmm0
+	movq	%rax, 16(%rbx)
+	movq	$0, 40(%rbx)
+	movq	128(%rsp), %r13
+	movups	%xmm0, 24(%rbx)
+	cmpq	$23, %rbp
+	je	.L2702
+	movq	152(%rsp), %r15
+	movq	%r13, %rdx
+	xorl	%edi, %edi
+.L2671:
+	leaq	24(%rbx), %r12
+	cmpq	%r12, %r15
+	jnb	.L2802
+	.p2align 4,,10
+	.p2align 3
+.L2607:
+	movl	$23, %r14d
+	cmpq	$23, %rdx
+	jbe	.L2618
+.L2662:
+	leaq	10(%r14,%r14), %r14
+	movq	(%rax), %rcx
+	movq	%rax, %rdi
+	cmpq	%rdx, %r14
+	cmovb	%rdx, %r14
+	movl	$1, %edx
+	leaq	1(%r14), %rsi
+	call	*16(%rcx)
+	movq	%rax, %r12
+	movq	(%rbx), %rax
+	cmpq	$23, 8(%rbx)
+	leaq	24(%rbx), %rsi
+	leaq	1(%rax), %rdx
+	je	.L2611
+	movq	24(%rbx), %rsi
+.L2611:
+	movq	%r12, %rdi
+	call	memcpy@PLT
+	movq	8(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L2612
+	movq	16(%rbx), %rdi
+	movq	24(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE103:
+.L2612:
+	movq	%r12, 24(%rbx)
+	movq	(%rbx), %rdi
+	movq	%r14, 8(%rbx)
+	cmpq	$23, %r14
+	je	.L2803
+.L2618:
+	movq	%r13, %rdx
+	addq	%r12, %rdi
+	movq	%r15, %rsi
+	call	memmove@PLT
+	addq	(%rbx), %r13
+	movq	%r13, (%rbx)
+	movq	112(%rsp), %rbx
+	movb	$0, (%r12,%r13)
+.L2600:
+	leaq	1(%rbx), %r12
+	movq	%r12, 112(%rsp)
+	cmpq	$23, %rbp
+	je	.L2620
+.L2808:
+	movq	144(%rsp), %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	152(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	subl	$1, 60(%rsp)
+	je	.L2622
+.L2621:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	jmp	.L2623
+	.p2align 4,,10
+	.p2align 3
+.L2793:
+	leaq	1(%rbp), %rcx
+	cmpq	%rcx, %rbp
+	jnb	.L2522
+	leaq	10(%rbp,%rbp), %rax
+	movq	%rcx, 32(%rsp)
+	movl	$1, %edx
+	movq	144(%rsp), %rdi
+	cmpq	%rcx, %rax
+	cmovb	%rcx, %rax
+	movq	%rdi, 48(%rsp)
+	movq	%rax, 40(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%rdi), %rax
+.LEHB104:
+	call	*16(%rax)
+.LEHE104:
+	movq	%rax, 24(%rsp)
+	cmpq	$23, %r12
+	je	.L2523
+	movq	152(%rsp), %rsi
+	movq	32(%rsp), %rdx
+	movq	%rax, %rdi
+	movq	%rsi, 32(%rsp)
+	call	memcpy@PLT
+	movq	48(%rsp), %rdi
+	movq	32(%rsp), %rsi
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+.LEHB105:
+	call	*24(%rax)
+.LEHE105:
+.L2524:
+	movq	24(%rsp), %rax
+	movq	%rax, 152(%rsp)
+	movq	40(%rsp), %rax
+	movq	%rax, 136(%rsp)
+	movq	%rax, %r12
+	jmp	.L2522
+	.p2align 4,,10
+	.p2align 3
+.L2523:
+	movq	32(%rsp), %rdx
+	movq	16(%rsp), %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L2524
+	.p2align 4,,10
+	.p2align 3
+.L2800:
+	leaq	5(%rbp), %rdx
+	movq	120(%rsp), %rdi
+	leaq	(%rdx,%rdx), %rax
+	leaq	(%rax,%rdx), %rsi
+	movq	%rax, 104(%rsp)
+	movq	(%rdi), %rax
+	movl	$8, %edx
+	salq	$5, %rsi
+.LEHB106:
+	call	*16(%rax)
+	leaq	0(%rbp,%rbp,2), %rdx
+	movdqa	.LC33(%rip), %xmm5
+	movq	%rax, 96(%rsp)
+	salq	$4, %rdx
+	leaq	(%rax,%rdx), %rbx
+	movups	%xmm5, (%rbx)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L2804
+	movq	128(%rsp), %rdx
+	movq	136(%rsp), %rbp
+	pxor	%xmm0, %xmm0
+	movq	%rax, 16(%rbx)
+	movq	$0, 40(%rbx)
+	movq	%rdx, 24(%rsp)
+	movups	%xmm0, 24(%rbx)
+	cmpq	$23, %rbp
+	je	.L2701
+	movq	152(%rsp), %rsi
+	xorl	%edi, %edi
+	movq	%rsi, 8(%rsp)
+.L2670:
+	leaq	24(%rbx), %r12
+	cmpq	%r12, 8(%rsp)
+	jnb	.L2805
+	.p2align 4,,10
+	.p2align 3
+.L2584:
+	movl	$23, %r15d
+	cmpq	$23, %rdx
+	jbe	.L2595
+.L2660:
+	leaq	10(%r15,%r15), %rcx
+	movq	%rax, %rdi
+	cmpq	%rdx, %rcx
+	cmovnb	%rcx, %rdx
+	movq	(%rax), %rcx
+	movq	%rdx, %r15
+	leaq	1(%rdx), %rsi
+	movl	$1, %edx
+	call	*16(%rcx)
+	movq	%rax, %r12
+	movq	(%rbx), %rax
+	cmpq	$23, 8(%rbx)
+	leaq	24(%rbx), %rsi
+	leaq	1(%rax), %rdx
+	je	.L2588
+	movq	24(%rbx), %rsi
+.L2588:
+	movq	%r12, %rdi
+	call	memcpy@PLT
+	movq	8(%rbx), %rax
+	cmpq	$23, %rax
+	je	.L2589
+	movq	16(%rbx), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%rbx), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2589:
+	movq	%r12, 24(%rbx)
+	movq	(%rbx), %rdi
+	movq	%r15, 8(%rbx)
+	cmpq	$23, %r15
+	je	.L2806
+.L2595:
+	movq	24(%rsp), %r15
+	movq	8(%rsp), %rsi
+	addq	%r12, %rdi
+	movq	%r15, %rdx
+	call	memmove@PLT
+	movq	(%rbx), %rax
+	movq	96(%rsp), %rdi
+	addq	%r15, %rax
+	movq	%rax, (%rbx)
+	movq	112(%rsp), %rbx
+	movb	$0, (%r12,%rax)
+	testq	%rbx, %rbx
+	jne	.L2807
+	testq	%r14, %r14
+	je	.L2600
+.L2598:
+	movq	120(%rsp), %rdi
+	leaq	0(%r13,%r13,2), %rdx
+	movl	$8, %ecx
+	movq	%r14, %rsi
+	salq	$4, %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE106:
+	leaq	1(%rbx), %r12
+	movq	%r12, 112(%rsp)
+	cmpq	$23, %rbp
+	jne	.L2808
+.L2620:
+	subl	$1, 60(%rsp)
+	jne	.L2621
+.L2622:
+	movq	64(%rsp), %rax
+	movq	80(%rsp), %r13
+	xorl	%edx, %edx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	movq	%rax, 8(%rsp)
+.LEHB107:
+	call	_ZN1n10__msd_sortIcEEvPNS_6stringIT_EEmm
+	movq	96(%rsp), %r15
+	cmpq	$1, %r12
+	jbe	.L2624
+	movq	%r12, %rax
+	xorl	%edx, %edx
+.L2625:
+	shrq	%rax
+	addl	$1, %edx
+	cmpq	$1, %rax
+	jne	.L2625
+	leaq	(%r12,%r12,2), %rsi
+	movl	$1, %ecx
+	movq	%r15, %rdi
+	salq	$4, %rsi
+	addq	%r15, %rsi
+	call	_ZN1n9__pdqsortINS_6stringIcEENS_4lessEEEvPT_S5_RT0_ib.isra.0
+.LEHE107:
+	cmpq	$1, %r13
+	jbe	.L2809
+.L2626:
+	movq	8(%rsp), %rax
+	movl	$1, %r14d
+	movq	%r12, 16(%rsp)
+	movq	%rbx, 24(%rsp)
+	movq	%r14, %r12
+	leaq	72(%rax), %rbp
+	jmp	.L2637
+.L2811:
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L2633
+	js	.L2636
+	addq	$1, %r12
+	addq	$48, %rbp
+	cmpq	%r12, %r13
+	je	.L2810
+.L2637:
+	cmpq	$23, -64(%rbp)
+	movq	-72(%rbp), %rbx
+	movq	%rbp, %rdi
+	leaq	-48(%rbp), %rsi
+	je	.L2631
+	movq	-48(%rbp), %rsi
+.L2631:
+	cmpq	$23, -16(%rbp)
+	movq	-24(%rbp), %r14
+	je	.L2632
+	movq	0(%rbp), %rdi
+.L2632:
+	cmpq	%r14, %rbx
+	movq	%r14, %rdx
+	cmovbe	%rbx, %rdx
+	testq	%rdx, %rdx
+	jne	.L2811
+.L2633:
+	cmpq	%rbx, %r14
+	jb	.L2636
+	addq	$1, %r12
+	addq	$48, %rbp
+	cmpq	%r12, %r13
+	jne	.L2637
+.L2810:
+	movq	16(%rsp), %r12
+	movq	24(%rsp), %rbx
+.L2627:
+	movq	8(%rsp), %rax
+	xorl	%r8d, %r8d
+	movq	%rbx, 16(%rsp)
+	leaq	24(%r15), %rbp
+	movq	%r8, %rbx
+	leaq	24(%rax), %rcx
+	movl	$1, %eax
+	movq	%rcx, %r14
+	jmp	.L2643
+.L2699:
+	xorl	%eax, %eax
+.L2640:
+	addq	$1, %rbx
+	addq	$48, %r14
+	addq	$48, %rbp
+	cmpq	%r13, %rbx
+	je	.L2812
+.L2643:
+	testb	%al, %al
+	je	.L2640
+	movq	-24(%r14), %rdx
+	movq	%r14, %rdi
+	movq	%rbp, %rsi
+	cmpq	-24(%rbp), %rdx
+	jne	.L2699
+	cmpq	$23, -16(%rbp)
+	je	.L2641
+	movq	0(%rbp), %rsi
+.L2641:
+	cmpq	$23, -16(%r14)
+	je	.L2642
+	movq	(%r14), %rdi
+.L2642:
+	testq	%rdx, %rdx
+	je	.L2640
+	call	memcmp@PLT
+	testl	%eax, %eax
+	sete	%al
+	jmp	.L2640
+	.p2align 4,,10
+	.p2align 3
+.L2796:
+	leaq	5(%rbp), %rdx
+	movq	88(%rsp), %rdi
+	leaq	(%rdx,%rdx), %rax
+	leaq	(%rax,%rdx), %rsi
+	movq	%rax, 72(%rsp)
+	movq	(%rdi), %rax
+	movl	$8, %edx
+	salq	$5, %rsi
+.LEHB108:
+	call	*16(%rax)
+	leaq	0(%rbp,%rbp,2), %rdx
+	movdqa	.LC33(%rip), %xmm4
+	movq	%rax, 64(%rsp)
+	salq	$4, %rdx
+	leaq	(%rax,%rdx), %rbx
+	movups	%xmm4, (%rbx)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L2813
+	pxor	%xmm0, %xmm0
+	movq	%rax, 16(%rbx)
+	cmpq	$23, 136(%rsp)
+	movq	$0, 40(%rbx)
+	movq	128(%rsp), %r15
+	movups	%xmm0, 24(%rbx)
+	je	.L2703
+	movq	152(%rsp), %rsi
+	movq	%r15, %rdx
+	xorl	%edi, %edi
+	movq	%rsi, 8(%rsp)
+.L2672:
+	leaq	24(%rbx), %rbp
+	cmpq	%rbp, 8(%rsp)
+	jnb	.L2814
+	.p2align 4,,10
+	.p2align 3
+.L2541:
+	movl	$23, %r14d
+	cmpq	$23, %rdx
+	jbe	.L2552
+.L2664:
+	leaq	10(%r14,%r14), %r14
+	movq	(%rax), %rcx
+	movq	%rax, %rdi
+	cmpq	%rdx, %r14
+	cmovb	%rdx, %r14
+	movl	$1, %edx
+	leaq	1(%r14), %rsi
+	call	*16(%rcx)
+	movq	%rax, %rbp
+	movq	(%rbx), %rax
+	cmpq	$23, 8(%rbx)
+	leaq	24(%rbx), %rsi
+	leaq	1(%rax), %rdx
+	je	.L2545
+	movq	24(%rbx), %rsi
+.L2545:
+	movq	%rbp, %rdi
+	call	memcpy@PLT
+	movq	8(%rbx), %rax
+	cmpq	$23, %rax
+	je	.L2546
+	movq	16(%rbx), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%rbx), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2546:
+	movq	%rbp, 24(%rbx)
+	movq	(%rbx), %rdi
+	movq	%r14, 8(%rbx)
+	cmpq	$23, %r14
+	je	.L2815
+.L2552:
+	movq	8(%rsp), %rsi
+	addq	%rbp, %rdi
+	movq	%r15, %rdx
+	call	memmove@PLT
+	movq	(%rbx), %rax
+	movq	64(%rsp), %rdi
+	addq	%r15, %rax
+	movq	%rax, (%rbx)
+	movq	80(%rsp), %rbx
+	movb	$0, 0(%rbp,%rax)
+	testq	%rbx, %rbx
+	jne	.L2816
+	testq	%r13, %r13
+	je	.L2557
+.L2555:
+	movq	88(%rsp), %rdi
+	leaq	(%r12,%r12,2), %rdx
+	movl	$8, %ecx
+	movq	%r13, %rsi
+	salq	$4, %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L2557
+	.p2align 4,,10
+	.p2align 3
+.L2792:
+	movq	%rsi, %rbx
+	xorl	%ebp, %ebp
+	leaq	.LC39(%rip), %rsi
+	jmp	.L2508
+	.p2align 4,,10
+	.p2align 3
+.L2704:
+	movq	16(%rsp), %r14
+	leaq	24(%rbx), %rbp
+	movq	%r12, %rdx
+	xorl	%edi, %edi
+	cmpq	%rbp, %r14
+	jb	.L2564
+.L2798:
+	leaq	0(%rbp,%rdi), %rcx
+	movl	$23, %r13d
+	cmpq	%rcx, %r14
+	jb	.L2565
+	.p2align 4,,10
+	.p2align 3
+.L2821:
+	cmpq	%rdx, %r13
+	jb	.L2666
+	xorl	%ebp, %ebp
+	cmpq	$23, %r13
+	jne	.L2575
+.L2799:
+	leaq	24(%rbx), %rbp
+	jmp	.L2575
+	.p2align 4,,10
+	.p2align 3
+.L2702:
+	movq	16(%rsp), %r15
+	leaq	24(%rbx), %r12
+	movq	%r13, %rdx
+	xorl	%edi, %edi
+	cmpq	%r12, %r15
+	jb	.L2607
+.L2802:
+	leaq	(%r12,%rdi), %rcx
+	movl	$23, %r14d
+	cmpq	%rcx, %r15
+	jb	.L2608
+	.p2align 4,,10
+	.p2align 3
+.L2823:
+	cmpq	%rdx, %r14
+	jb	.L2662
+	xorl	%r12d, %r12d
+	cmpq	$23, %r14
+	jne	.L2618
+.L2803:
+	leaq	24(%rbx), %r12
+	jmp	.L2618
+	.p2align 4,,10
+	.p2align 3
+.L2507:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2817
+.L2512:
+	movq	_ZZN1n4heapEvE3res(%rip), %r14
+	movq	128(%rsp), %rbp
+	pxor	%xmm0, %xmm0
+	xorl	%r15d, %r15d
+	movq	136(%rsp), %r13
+	movups	%xmm0, 152(%rsp)
+	movq	%r14, 144(%rsp)
+	leaq	7(%rbp), %r12
+	movq	$0, 168(%rsp)
+	cmpq	$23, %r13
+	je	.L2818
+.L2514:
+	leaq	(%r15,%rbp), %rax
+	leaq	.LC39(%rip), %rsi
+	cmpq	%rax, %rsi
+	jnb	.L2819
+	leaq	.LC39(%rip), %rax
+	subq	%r15, %rax
+	movq	%rax, 8(%rsp)
+	cmpq	%r12, %r13
+	jnb	.L2680
+	leaq	10(%r13,%r13), %rax
+	movl	$1, %edx
+	movq	%r14, %rdi
+	cmpq	%r12, %rax
+	cmovnb	%rax, %r12
+	movq	(%r14), %rax
+	leaq	1(%r12), %rsi
+	call	*16(%rax)
+	leaq	1(%rbp), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L2518
+	movq	(%r14), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L2518:
+	movq	%r12, %r13
+	movq	%rbx, 152(%rsp)
+	movq	8(%rsp), %rsi
+	movq	%r12, 136(%rsp)
+	cmpq	$23, %r13
+	je	.L2519
+.L2832:
+	addq	%rbx, %rsi
+	jmp	.L2508
+.L2819:
+	cmpq	%r12, %r13
+	jnb	.L2679
+.L2667:
+	leaq	10(%r13,%r13), %rax
+	movl	$1, %edx
+	movq	%r14, %rdi
+	cmpq	%r12, %rax
+	cmovnb	%rax, %r12
+	movq	(%r14), %rax
+	leaq	1(%r12), %rsi
+	call	*16(%rax)
+	leaq	1(%rbp), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r13
+	je	.L2516
+	movq	(%r14), %rax
+	leaq	1(%r13), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L2516:
+	movq	%rbx, 152(%rsp)
+	movq	%r12, 136(%rsp)
+.L2510:
+	leaq	.LC39(%rip), %rsi
+	cmpq	$23, %r12
+	jne	.L2508
+	jmp	.L2785
+	.p2align 4,,10
+	.p2align 3
+.L2797:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2820
+.L2560:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	pxor	%xmm0, %xmm0
+	movq	(%rbx), %rdi
+	movq	$0, 40(%rbx)
+	movq	8(%rbx), %r13
+	movq	16(%rsp), %r14
+	movups	%xmm0, 24(%rbx)
+	cmpq	$23, 136(%rsp)
+	movq	%rax, 16(%rbx)
+	movq	128(%rsp), %r12
+	je	.L2562
+	movq	152(%rsp), %r14
+.L2562:
+	leaq	(%rdi,%r12), %rdx
+	xorl	%ebp, %ebp
+	cmpq	$23, %r13
+	je	.L2673
+	leaq	0(%rbp,%rdi), %rcx
+	cmpq	%rcx, %r14
+	jnb	.L2821
+.L2565:
+	subq	%rbp, %r14
+	cmpq	%rdx, %r13
+	jnb	.L2690
+	leaq	10(%r13,%r13), %r13
+	movq	(%rax), %rcx
+	movq	%rax, %rdi
+	cmpq	%rdx, %r13
+	cmovb	%rdx, %r13
+	movl	$1, %edx
+	leaq	1(%r13), %rsi
+	call	*16(%rcx)
+	movq	%rax, %rbp
+	movq	(%rbx), %rax
+	cmpq	$23, 8(%rbx)
+	leaq	24(%rbx), %rsi
+	leaq	1(%rax), %rdx
+	je	.L2572
+	movq	24(%rbx), %rsi
+.L2572:
+	movq	%rbp, %rdi
+	call	memcpy@PLT
+	movq	8(%rbx), %rax
+	cmpq	$23, %rax
+	je	.L2573
+	movq	16(%rbx), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%rbx), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2573:
+	movq	%rbp, 24(%rbx)
+	movq	(%rbx), %rdi
+	movq	%r13, 8(%rbx)
+.L2570:
+	cmpq	$23, %r13
+	jne	.L2789
+	leaq	24(%rbx), %rbp
+.L2789:
+	addq	%rbp, %r14
+	jmp	.L2575
+	.p2align 4,,10
+	.p2align 3
+.L2801:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2822
+.L2603:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	pxor	%xmm0, %xmm0
+	movq	(%rbx), %rdi
+	movq	$0, 40(%rbx)
+	movq	136(%rsp), %rbp
+	movq	8(%rbx), %r14
+	movups	%xmm0, 24(%rbx)
+	movq	%rax, 16(%rbx)
+	movq	128(%rsp), %r13
+	movq	16(%rsp), %r15
+	cmpq	$23, %rbp
+	je	.L2605
+	movq	152(%rsp), %r15
+.L2605:
+	leaq	0(%r13,%rdi), %rdx
+	xorl	%r12d, %r12d
+	cmpq	$23, %r14
+	je	.L2671
+	leaq	(%r12,%rdi), %rcx
+	cmpq	%rcx, %r15
+	jnb	.L2823
+.L2608:
+	subq	%r12, %r15
+	cmpq	%rdx, %r14
+	jnb	.L2698
+	leaq	10(%r14,%r14), %r14
+	movq	(%rax), %rcx
+	movq	%rax, %rdi
+	cmpq	%rdx, %r14
+	cmovb	%rdx, %r14
+	movl	$1, %edx
+	leaq	1(%r14), %rsi
+	call	*16(%rcx)
+	movq	%rax, %r12
+	movq	(%rbx), %rax
+	cmpq	$23, 8(%rbx)
+	leaq	24(%rbx), %rsi
+	leaq	1(%rax), %rdx
+	je	.L2615
+	movq	24(%rbx), %rsi
+.L2615:
+	movq	%r12, %rdi
+	call	memcpy@PLT
+	movq	8(%rbx), %rax
+	cmpq	$23, %rax
+	je	.L2616
+	movq	16(%rbx), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%rbx), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2616:
+	movq	%r12, 24(%rbx)
+	movq	(%rbx), %rdi
+	movq	%r14, 8(%rbx)
+.L2613:
+	cmpq	$23, %r14
+	jne	.L2791
+	leaq	24(%rbx), %r12
+.L2791:
+	addq	%r12, %r15
+	jmp	.L2618
+	.p2align 4,,10
+	.p2align 3
+.L2807:
+	leaq	(%rbx,%rbx,2), %rdx
+	movq	%r14, %rsi
+	salq	$4, %rdx
+	call	memcpy@PLT
+	jmp	.L2598
+	.p2align 4,,10
+	.p2align 3
+.L2816:
+	leaq	(%rbx,%rbx,2), %rdx
+	movq	%r13, %rsi
+	salq	$4, %rdx
+	call	memcpy@PLT
+	jmp	.L2555
+	.p2align 4,,10
+	.p2align 3
+.L2795:
+	leaq	1(%rbx), %r13
+	cmpq	%r13, %rbx
+	jnb	.L2530
+	movq	144(%rsp), %r15
+	leaq	10(%rbx,%rbx), %r12
+	movl	$1, %edx
+	cmpq	%r13, %r12
+	cmovb	%r13, %r12
+	movq	(%r15), %rax
+	movq	%r15, %rdi
+	leaq	1(%r12), %rsi
+	call	*16(%rax)
+.LEHE108:
+	movq	%rax, %r14
+	cmpq	$23, %rbp
+	je	.L2531
+	movq	152(%rsp), %rsi
+	movq	%r13, %rdx
+	movq	%rax, %rdi
+	movq	%rsi, 8(%rsp)
+	call	memcpy@PLT
+	movq	(%r15), %rax
+	movq	8(%rsp), %rsi
+	movq	%r15, %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+.LEHB109:
+	call	*24(%rax)
+.LEHE109:
+.L2532:
+	movq	%r14, 152(%rsp)
+	movq	%r12, %rbp
+	movq	%r12, 136(%rsp)
+	jmp	.L2530
+	.p2align 4,,10
+	.p2align 3
+.L2701:
+	movq	16(%rsp), %rsi
+	xorl	%edi, %edi
+	leaq	24(%rbx), %r12
+	movq	%rsi, 8(%rsp)
+	cmpq	%r12, 8(%rsp)
+	jb	.L2584
+.L2805:
+	movl	$23, %r15d
+	leaq	(%r12,%rdi), %rcx
+	cmpq	%rcx, 8(%rsp)
+	jb	.L2585
+.L2827:
+	cmpq	%rdx, %r15
+	jb	.L2660
+	xorl	%r12d, %r12d
+	cmpq	$23, %r15
+	jne	.L2595
+.L2806:
+	leaq	24(%rbx), %r12
+	jmp	.L2595
+	.p2align 4,,10
+	.p2align 3
+.L2703:
+	movq	16(%rsp), %rsi
+	movq	%r15, %rdx
+	xorl	%edi, %edi
+	leaq	24(%rbx), %rbp
+	movq	%rsi, 8(%rsp)
+	cmpq	%rbp, 8(%rsp)
+	jb	.L2541
+.L2814:
+	movl	$23, %r14d
+	leaq	0(%rbp,%rdi), %rcx
+	cmpq	%rcx, 8(%rsp)
+	jb	.L2542
+.L2825:
+	cmpq	%rdx, %r14
+	jb	.L2664
+	xorl	%ebp, %ebp
+	cmpq	$23, %r14
+	jne	.L2552
+.L2815:
+	leaq	24(%rbx), %rbp
+	jmp	.L2552
+.L2813:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2824
+.L2537:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	pxor	%xmm0, %xmm0
+	movq	8(%rbx), %r14
+	movq	$0, 40(%rbx)
+	movq	16(%rsp), %rsi
+	movq	(%rbx), %rdi
+	movups	%xmm0, 24(%rbx)
+	cmpq	$23, 136(%rsp)
+	movq	%rax, 16(%rbx)
+	movq	%rsi, 8(%rsp)
+	movq	128(%rsp), %r15
+	je	.L2539
+	movq	152(%rsp), %rsi
+	movq	%rsi, 8(%rsp)
+.L2539:
+	leaq	(%r15,%rdi), %rdx
+	xorl	%ebp, %ebp
+	cmpq	$23, %r14
+	je	.L2672
+	leaq	0(%rbp,%rdi), %rcx
+	cmpq	%rcx, 8(%rsp)
+	jnb	.L2825
+.L2542:
+	movq	8(%rsp), %rsi
+	subq	%rbp, %rsi
+	movq	%rsi, 8(%rsp)
+	cmpq	%rdx, %r14
+	jnb	.L2686
+	leaq	10(%r14,%r14), %r14
+	movq	(%rax), %rcx
+	movq	%rax, %rdi
+	cmpq	%rdx, %r14
+	cmovb	%rdx, %r14
+	movl	$1, %edx
+	leaq	1(%r14), %rsi
+.LEHB110:
+	call	*16(%rcx)
+	movq	%rax, %rbp
+	movq	(%rbx), %rax
+	cmpq	$23, 8(%rbx)
+	leaq	24(%rbx), %rsi
+	leaq	1(%rax), %rdx
+	je	.L2549
+	movq	24(%rbx), %rsi
+.L2549:
+	movq	%rbp, %rdi
+	call	memcpy@PLT
+	movq	8(%rbx), %rax
+	cmpq	$23, %rax
+	je	.L2550
+	movq	16(%rbx), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%rbx), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2550:
+	movq	%rbp, 24(%rbx)
+	movq	(%rbx), %rdi
+	movq	%r14, 8(%rbx)
+.L2547:
+	cmpq	$23, %r14
+	jne	.L2788
+	leaq	24(%rbx), %rbp
+.L2788:
+	movq	8(%rsp), %rax
+	addq	%rbp, %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L2552
+.L2804:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2826
+.L2580:
+	movq	128(%rsp), %rsi
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	pxor	%xmm0, %xmm0
+	movq	$0, 40(%rbx)
+	movq	136(%rsp), %rbp
+	movq	(%rbx), %rdi
+	movups	%xmm0, 24(%rbx)
+	movq	%rsi, 24(%rsp)
+	movq	16(%rsp), %rsi
+	movq	%rax, 16(%rbx)
+	movq	8(%rbx), %r15
+	movq	%rsi, 8(%rsp)
+	cmpq	$23, %rbp
+	je	.L2582
+	movq	152(%rsp), %rsi
+	movq	%rsi, 8(%rsp)
+.L2582:
+	movq	24(%rsp), %rsi
+	xorl	%r12d, %r12d
+	leaq	(%rsi,%rdi), %rdx
+	cmpq	$23, %r15
+	je	.L2670
+	leaq	(%r12,%rdi), %rcx
+	cmpq	%rcx, 8(%rsp)
+	jnb	.L2827
+.L2585:
+	movq	8(%rsp), %rsi
+	subq	%r12, %rsi
+	movq	%rsi, 8(%rsp)
+	cmpq	%rdx, %r15
+	jnb	.L2694
+	leaq	10(%r15,%r15), %rcx
+	movq	%rax, %rdi
+	cmpq	%rdx, %rcx
+	cmovnb	%rcx, %rdx
+	movq	(%rax), %rcx
+	movq	%rdx, %r15
+	leaq	1(%rdx), %rsi
+	movl	$1, %edx
+	call	*16(%rcx)
+	movq	%rax, %r12
+	movq	(%rbx), %rax
+	cmpq	$23, 8(%rbx)
+	leaq	24(%rbx), %rsi
+	leaq	1(%rax), %rdx
+	je	.L2592
+	movq	24(%rbx), %rsi
+.L2592:
+	movq	%r12, %rdi
+	call	memcpy@PLT
+	movq	8(%rbx), %rax
+	cmpq	$23, %rax
+	je	.L2593
+	movq	16(%rbx), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%rbx), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE110:
+.L2593:
+	movq	%r12, 24(%rbx)
+	movq	(%rbx), %rdi
+	movq	%r15, 8(%rbx)
+.L2590:
+	cmpq	$23, %r15
+	jne	.L2790
+	leaq	24(%rbx), %r12
+.L2790:
+	movq	8(%rsp), %rax
+	addq	%r12, %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L2595
+.L2817:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2512
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2512
+.L2690:
+	xorl	%ebp, %ebp
+	jmp	.L2570
+.L2698:
+	xorl	%r12d, %r12d
+	jmp	.L2613
+.L2820:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2560
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2560
+.L2822:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2603
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2603
+.L2686:
+	xorl	%ebp, %ebp
+	jmp	.L2547
+.L2694:
+	xorl	%r12d, %r12d
+	jmp	.L2590
+.L2679:
+	xorl	%ebx, %ebx
+	movq	%r13, %r12
+	jmp	.L2510
+.L2531:
+	movq	16(%rsp), %rsi
+	movq	%r13, %rdx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	jmp	.L2532
+.L2824:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2537
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2537
+.L2826:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2580
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2580
+.L2812:
+	movq	16(%rsp), %rbx
+	testb	%al, %al
+	je	.L2644
+	testq	%r12, %r12
+	je	.L2828
+.L2628:
+	movq	%r15, %rbp
+	xorl	%r12d, %r12d
+	jmp	.L2650
+.L2829:
+	movq	16(%rbp), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%rbp), %rsi
+	addq	$48, %rbp
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	leaq	1(%r12), %rax
+	cmpq	%rbx, %r12
+	je	.L2649
+.L2648:
+	movq	%rax, %r12
+.L2650:
+	movq	8(%rbp), %rax
+	cmpq	$23, %rax
+	jne	.L2829
+	leaq	1(%r12), %rax
+	addq	$48, %rbp
+	cmpq	%rbx, %r12
+	jne	.L2648
+.L2649:
+	testq	%r15, %r15
+	je	.L2646
+.L2638:
+	movq	104(%rsp), %rax
+	movq	120(%rsp), %rdi
+	movl	$8, %ecx
+	movq	%r15, %rsi
+	leaq	(%rax,%rax,2), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+	call	*24(%rax)
+.L2646:
+	testq	%r13, %r13
+	je	.L2639
+.L2645:
+	movq	8(%rsp), %rbx
+	xorl	%ebp, %ebp
+.L2655:
+	movq	8(%rbx), %rax
+	cmpq	$23, %rax
+	je	.L2653
+	movq	16(%rbx), %rdi
+	leaq	1(%rax), %rdx
+	addq	$1, %rbp
+	movq	24(%rbx), %rsi
+	movl	$1, %ecx
+	addq	$48, %rbx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	%rbp, %r13
+	jne	.L2655
+.L2639:
+	cmpq	$0, 8(%rsp)
+	je	.L2498
+	movq	72(%rsp), %rax
+	movq	88(%rsp), %rdi
+	movl	$8, %ecx
+	movq	8(%rsp), %rsi
+	leaq	(%rax,%rax,2), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+	call	*24(%rax)
+.L2498:
+	addq	$184, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L2653:
+	.cfi_restore_state
+	addq	$1, %rbp
+	addq	$48, %rbx
+	cmpq	%rbp, %r13
+	jne	.L2655
+	jmp	.L2639
+.L2624:
+	cmpq	$1, %r13
+	ja	.L2626
+	testq	%r13, %r13
+	jne	.L2627
+	testq	%r12, %r12
+	jne	.L2628
+	testq	%r15, %r15
+	jne	.L2638
+	jmp	.L2639
+	.p2align 4,,10
+	.p2align 3
+.L2499:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2830
+.L2502:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rdx
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	pxor	%xmm0, %xmm0
+	movq	$0, 96(%rsp)
+	movups	%xmm0, 104(%rsp)
+	movq	%rax, 88(%rsp)
+	movq	%rdx, %rax
+	testq	%rdx, %rdx
+	jne	.L2500
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2831
+.L2505:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdx
+	jmp	.L2500
+.L2828:
+	testq	%r15, %r15
+	jne	.L2638
+	jmp	.L2645
+.L2831:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2505
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2505
+.L2830:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2502
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2502
+	.p2align 4,,10
+	.p2align 3
+.L2680:
+	movq	8(%rsp), %rsi
+	xorl	%ebx, %ebx
+	cmpq	$23, %r13
+	jne	.L2832
+.L2519:
+	movq	16(%rsp), %rax
+	addq	%rax, %rsi
+	jmp	.L2520
+.L2818:
+	leaq	152(%rsp), %rbx
+	leaq	.LC39(%rip), %rax
+	cmpq	%rbx, %rax
+	jnb	.L2833
+	cmpq	$23, %r12
+	jbe	.L2700
+	movq	%rbx, %r15
+	jmp	.L2667
+.L2809:
+	testq	%r13, %r13
+	je	.L2628
+	jmp	.L2627
+.L2700:
+	leaq	.LC39(%rip), %rsi
+	jmp	.L2508
+.L2833:
+	movq	%rbx, %r15
+	jmp	.L2514
+.L2705:
+	movq	%rax, %rbx
+	jmp	.L2656
+.L2707:
+	movq	%rax, %rbx
+	jmp	.L2668
+.L2783:
+	jmp	.L2784
+	.section	.gcc_except_table
+.LLSDA6808:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6808-.LLSDACSB6808
+.LLSDACSB6808:
+	.uleb128 .LEHB103-.LFB6808
+	.uleb128 .LEHE103-.LEHB103
+	.uleb128 .L2705-.LFB6808
+	.uleb128 0
+	.uleb128 .LEHB104-.LFB6808
+	.uleb128 .LEHE104-.LEHB104
+	.uleb128 .L2705-.LFB6808
+	.uleb128 0
+	.uleb128 .LEHB105-.LFB6808
+	.uleb128 .LEHE105-.LEHB105
+	.uleb128 .L2707-.LFB6808
+	.uleb128 0
+	.uleb128 .LEHB106-.LFB6808
+	.uleb128 .LEHE106-.LEHB106
+	.uleb128 .L2705-.LFB6808
+	.uleb128 0
+	.uleb128 .LEHB107-.LFB6808
+	.uleb128 .LEHE107-.LEHB107
+	.uleb128 .L2783-.LFB6808
+	.uleb128 0
+	.uleb128 .LEHB108-.LFB6808
+	.uleb128 .LEHE108-.LEHB108
+	.uleb128 .L2705-.LFB6808
+	.uleb128 0
+	.uleb128 .LEHB109-.LFB6808
+	.uleb128 .LEHE109-.LEHB109
+	.uleb128 .L2707-.LFB6808
+	.uleb128 0
+	.uleb128 .LEHB110-.LFB6808
+	.uleb128 .LEHE110-.LEHB110
+	.uleb128 .L2705-.LFB6808
+	.uleb128 0
+.LLSDACSE6808:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6808
+	.type	_Z23test_radix_sort_stringsv.cold, @function
+_Z23test_radix_sort_stringsv.cold:
+.LFSB6808:
+.L2636:
+	.cfi_def_cfa_offset 240
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC0(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB111:
+	call	__cxa_throw@PLT
+.L2644:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC40(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE111:
+.L2656:
+	movq	136(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L2658
+.L2669:
+	movq	144(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	152(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2658:
+	leaq	96(%rsp), %rdi
+	call	_ZN1n6vectorINS_6stringIcEEE9__releaseEv
+	leaq	64(%rsp), %rdi
+	call	_ZN1n6vectorINS_6stringIcEEE9__releaseEv
+	movq	%rbx, %rdi
+.LEHB112:
+	call	_Unwind_Resume@PLT
+.LEHE112:
+.L2668:
+	movq	136(%rsp), %rax
+	jmp	.L2669
+.L2706:
+.L2784:
+	movq	%rax, %rbx
+	jmp	.L2658
+	.cfi_endproc
+.LFE6808:
+	.section	.gcc_except_table
+.LLSDAC6808:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6808-.LLSDACSBC6808
+.LLSDACSBC6808:
+	.uleb128 .LEHB111-.LCOLDB42
+	.uleb128 .LEHE111-.LEHB111
+	.uleb128 .L2706-.LCOLDB42
+	.uleb128 0
+	.uleb128 .LEHB112-.LCOLDB42
+	.uleb128 .LEHE112-.LEHB112
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6808:
+	.section	.text.unlikely
+	.text
+	.size	_Z23test_radix_sort_stringsv, .-_Z23test_radix_sort_stringsv
+	.section	.text.unlikely
+	.size	_Z23test_radix_sort_stringsv.cold, .-_Z23test_radix_sort_stringsv.cold
+.LCOLDE42:
+	.text
+.LHOTE42:
+	.section	.rodata.str1.1
+.LC43:
+	.string	"pear"
+.LC44:
+	.string	"apple"
+.LC45:
+	.string	"a rather long fruit name"
+.LC46:
+	.string	"fig"
+	.section	.rodata.str1.8
+	.align 8
+.LC47:
+	.string	"expected true : v.data()[0] == n::str(\"a rather long fruit name\")"
+	.align 8
+.LC48:
+	.string	"expected true : v.data()[1] == n::str(\"apple\")"
+	.align 8
+.LC49:
+	.string	"expected true : v.data()[3] == n::str(\"pear\")"
+	.section	.text.unlikely
+.LCOLDB50:
+	.text
+.LHOTB50:
+	.p2align 4
+	.globl	_Z17test_sort_stringsv
+	.type	_Z17test_sort_stringsv, @function
+_Z17test_sort_stringsv:
+.LFB6783:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6783
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pxor	%xmm0, %xmm0
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$120, %rsp
+	.cfi_def_cfa_offset 176
+	movq	$0, 32(%rsp)
+	movups	%xmm0, 40(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	%rax, %rdx
+	testq	%rax, %rax
+	je	.L3293
+.L2835:
+	movdqa	.LC33(%rip), %xmm1
+	movq	%rdx, 56(%rsp)
+	movaps	%xmm1, 64(%rsp)
+	testq	%rax, %rax
+	je	.L2839
+	movq	%rax, 80(%rsp)
+	pxor	%xmm0, %xmm0
+	xorl	%r13d, %r13d
+	leaq	.LC43(%rip), %rax
+	leaq	88(%rsp), %rbx
+	movq	%rax, (%rsp)
+	movq	$0, 104(%rsp)
+	movups	%xmm0, 88(%rsp)
+	cmpq	%rbx, %rax
+	jb	.L2840
+.L3108:
+	leaq	.LC43(%rip), %rax
+	.p2align 4,,10
+	.p2align 3
+.L2840:
+	movl	(%rax), %eax
+	movq	32(%rsp), %rbp
+	movl	%eax, (%rbx,%r13)
+	movq	64(%rsp), %rax
+	movq	40(%rsp), %r13
+	leaq	4(%rax), %rdx
+	movq	%rdx, 64(%rsp)
+	movb	$0, 4(%rbx,%rax)
+	movq	48(%rsp), %rbx
+	movq	%rbx, %r12
+	cmpq	%r13, %rbx
+	je	.L3294
+	leaq	(%rbx,%rbx,2), %rax
+	movdqa	.LC33(%rip), %xmm1
+	salq	$4, %rax
+	addq	%rax, %rbp
+	movups	%xmm1, 0(%rbp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L3295
+.L2863:
+	movq	80(%rsp), %rax
+	movdqa	64(%rsp), %xmm2
+	pxor	%xmm0, %xmm0
+	movq	$0, 40(%rbp)
+	movups	%xmm0, 24(%rbp)
+	movq	%rax, 16(%rbp)
+	movq	72(%rsp), %rax
+	movups	%xmm2, 0(%rbp)
+	cmpq	$23, %rax
+	je	.L3296
+	movq	88(%rsp), %rax
+	leaq	1(%rbx), %r12
+	movq	%rax, 24(%rbp)
+.L2866:
+	movdqa	.LC33(%rip), %xmm2
+	movq	%r12, 48(%rsp)
+	movaps	%xmm2, 64(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L2867
+	pxor	%xmm0, %xmm0
+	leaq	88(%rsp), %rbx
+	movq	%rax, 80(%rsp)
+	xorl	%ebp, %ebp
+	leaq	.LC44(%rip), %r13
+	movups	%xmm0, 88(%rsp)
+	movq	$0, 104(%rsp)
+	cmpq	%rbx, %r13
+	jb	.L3107
+.L3267:
+	leaq	.LC44(%rip), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L2868:
+	leaq	(%rbx,%rbp), %rdi
+	movl	$5, %edx
+	call	memmove@PLT
+	movq	64(%rsp), %rax
+	movq	40(%rsp), %r14
+	movq	32(%rsp), %rbp
+	leaq	5(%rax), %rdx
+	movq	%rdx, 64(%rsp)
+	movb	$0, 5(%rbx,%rax)
+	movq	48(%rsp), %rbx
+	movq	%rbx, %r12
+	cmpq	%r14, %rbx
+	je	.L3297
+	leaq	(%rbx,%rbx,2), %rax
+	movdqa	.LC33(%rip), %xmm3
+	salq	$4, %rax
+	addq	%rax, %rbp
+	movups	%xmm3, 0(%rbp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L3298
+.L2891:
+	movq	80(%rsp), %rax
+	movdqa	64(%rsp), %xmm4
+	pxor	%xmm0, %xmm0
+	movq	$0, 40(%rbp)
+	movups	%xmm0, 24(%rbp)
+	movq	%rax, 16(%rbp)
+	movq	72(%rsp), %rax
+	movups	%xmm4, 0(%rbp)
+	cmpq	$23, %rax
+	je	.L3299
+	movq	88(%rsp), %rax
+	leaq	1(%rbx), %r12
+	movq	%rax, 24(%rbp)
+.L2894:
+	movdqa	.LC33(%rip), %xmm3
+	movq	%r12, 48(%rsp)
+	movaps	%xmm3, 64(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbp
+	testq	%rbp, %rbp
+	je	.L2895
+	leaq	88(%rsp), %rcx
+	movq	%rbp, 80(%rsp)
+	pxor	%xmm0, %xmm0
+	leaq	.LC45(%rip), %rax
+	movq	%rcx, 8(%rsp)
+	xorl	%r14d, %r14d
+	movl	$23, %r15d
+	movq	$0, 104(%rsp)
+	movq	%rax, 24(%rsp)
+	movl	$24, %eax
+	movups	%xmm0, 88(%rsp)
+.L2896:
+	leaq	10(%r15,%r15), %r12
+	movl	$1, %edx
+	movq	%rbp, %rdi
+	cmpq	%rax, %r12
+	cmovb	%rax, %r12
+	movq	0(%rbp), %rax
+	leaq	1(%r12), %rsi
+.LEHB113:
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%r14), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r15
+	je	.L2904
+	movq	0(%rbp), %rax
+	leaq	1(%r15), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%rbp, %rdi
+	call	*24(%rax)
+.L2904:
+	movq	%rbx, 88(%rsp)
+	movq	%r12, 72(%rsp)
+.L2903:
+	leaq	.LC45(%rip), %rsi
+	cmpq	$23, %r12
+	je	.L3300
+.L2908:
+	leaq	(%rbx,%r14), %rdi
+	movl	$24, %edx
+	call	memmove@PLT
+	movq	64(%rsp), %rax
+	movq	40(%rsp), %r14
+	movq	32(%rsp), %rbp
+	leaq	24(%rax), %rdx
+	movq	%rdx, 64(%rsp)
+	movb	$0, 24(%rbx,%rax)
+	movq	48(%rsp), %rbx
+	movq	%rbx, %r12
+	cmpq	%r14, %rbx
+	je	.L3301
+	leaq	(%rbx,%rbx,2), %rax
+	movdqa	.LC33(%rip), %xmm5
+	salq	$4, %rax
+	addq	%rax, %rbp
+	movups	%xmm5, 0(%rbp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L3302
+.L2920:
+	movq	80(%rsp), %rax
+	movdqa	64(%rsp), %xmm6
+	pxor	%xmm0, %xmm0
+	movq	$0, 40(%rbp)
+	movups	%xmm0, 24(%rbp)
+	movq	%rax, 16(%rbp)
+	movq	72(%rsp), %rax
+	movups	%xmm6, 0(%rbp)
+	cmpq	$23, %rax
+	je	.L3303
+	movq	88(%rsp), %rax
+	leaq	1(%rbx), %r12
+	movq	%rax, 24(%rbp)
+.L2923:
+	movdqa	.LC33(%rip), %xmm4
+	movq	%r12, 48(%rsp)
+	movaps	%xmm4, 64(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L2924
+	pxor	%xmm0, %xmm0
+	leaq	88(%rsp), %rbx
+	movq	%rax, 80(%rsp)
+	xorl	%ebp, %ebp
+	leaq	.LC46(%rip), %rsi
+	movups	%xmm0, 88(%rsp)
+	movq	$0, 104(%rsp)
+	cmpq	%rbx, %rsi
+	jb	.L2925
+.L3268:
+	leaq	.LC46(%rip), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L2925:
+	leaq	(%rbx,%rbp), %rdi
+	movl	$3, %edx
+	call	memmove@PLT
+	movq	64(%rsp), %rax
+	movq	40(%rsp), %r15
+	movq	32(%rsp), %r14
+	leaq	3(%rax), %rdx
+	movq	%rdx, 64(%rsp)
+	movb	$0, 3(%rbx,%rax)
+	movq	48(%rsp), %rbx
+	movq	%rbx, %r12
+	cmpq	%r15, %rbx
+	je	.L3304
+	leaq	(%rbx,%rbx,2), %rbp
+	movdqa	.LC33(%rip), %xmm7
+	salq	$4, %rbp
+	addq	%r14, %rbp
+	movups	%xmm7, 0(%rbp)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L3305
+.L2949:
+	movq	80(%rsp), %rax
+	movdqa	64(%rsp), %xmm1
+	pxor	%xmm0, %xmm0
+	movq	$0, 40(%rbp)
+	movups	%xmm0, 24(%rbp)
+	movq	%rax, 16(%rbp)
+	movq	72(%rsp), %rax
+	movups	%xmm1, 0(%rbp)
+	cmpq	$23, %rax
+	je	.L3306
+	movq	88(%rsp), %rax
+	movq	%rax, 24(%rbp)
+.L2952:
+	movq	%rbx, %r12
+	movq	%r14, %rbp
+.L2947:
+	addq	$1, %r12
+	movq	%r12, 48(%rsp)
+	cmpq	$1, %r12
+	jbe	.L3049
+	movq	%r12, %rax
+	xorl	%edx, %edx
+	.p2align 4,,10
+	.p2align 3
+.L2954:
+	shrq	%rax
+	addl	$1, %edx
+	cmpq	$1, %rax
+	jne	.L2954
+	leaq	(%r12,%r12,2), %rsi
+	movl	$1, %ecx
+	movq	%rbp, %rdi
+	salq	$4, %rsi
+	addq	%rbp, %rsi
+	call	_ZN1n9__pdqsortINS_6stringIcEENS_4lessEEEvPT_S5_RT0_ib.isra.0
+.L3049:
+	movdqa	.LC33(%rip), %xmm5
+	movaps	%xmm5, 64(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %r12
+	testq	%r12, %r12
+	je	.L2955
+	leaq	88(%rsp), %rcx
+	pxor	%xmm0, %xmm0
+	xorl	%r15d, %r15d
+	movq	%r12, 80(%rsp)
+	movq	$0, 104(%rsp)
+	movl	$24, %eax
+	movq	$23, 8(%rsp)
+	movq	%rcx, 16(%rsp)
+	movups	%xmm0, 88(%rsp)
+.L2956:
+	movq	8(%rsp), %rcx
+	movl	$1, %edx
+	movq	%r12, %rdi
+	leaq	10(%rcx,%rcx), %r14
+	cmpq	%rax, %r14
+	cmovb	%rax, %r14
+	movq	(%r12), %rax
+	leaq	1(%r14), %rsi
+	call	*16(%rax)
+	movq	16(%rsp), %rsi
+	leaq	1(%r15), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	movq	8(%rsp), %rcx
+	cmpq	$23, %rcx
+	je	.L2964
+	movq	(%r12), %rax
+	movq	%rcx, %rdx
+	xorl	%esi, %esi
+	movl	$1, %ecx
+	addq	$1, %rdx
+	movq	%r12, %rdi
+	call	*24(%rax)
+.LEHE113:
+.L2964:
+	movq	%rbx, 88(%rsp)
+	movq	%r14, 72(%rsp)
+.L2963:
+	leaq	.LC45(%rip), %rsi
+	cmpq	$23, %r14
+	je	.L3307
+.L2968:
+	leaq	(%rbx,%r15), %rdi
+	movl	$24, %edx
+	call	memmove@PLT
+	movq	64(%rsp), %rax
+	leaq	24(%rax), %rdx
+	movq	%rdx, 64(%rsp)
+	movb	$0, 24(%rbx,%rax)
+	movq	0(%rbp), %rdx
+	movq	72(%rsp), %rbx
+	cmpq	64(%rsp), %rdx
+	je	.L3308
+.L2970:
+	cmpq	$23, %rbx
+	je	.L2980
+	movq	80(%rsp), %rdi
+	movq	88(%rsp), %rsi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2980:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC47(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB114:
+	call	__cxa_throw@PLT
+.LEHE114:
+	.p2align 4,,10
+	.p2align 3
+.L3308:
+	cmpq	$23, %rbx
+	je	.L3309
+	movq	88(%rsp), %rax
+	cmpq	$23, 8(%rbp)
+	movq	%rax, %rsi
+	je	.L3310
+	testq	%rdx, %rdx
+	je	.L2976
+	movq	24(%rbp), %rdi
+.L2977:
+	movq	%rax, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L2970
+	movq	88(%rsp), %rsi
+	cmpq	$23, %rbx
+	je	.L2973
+.L2976:
+	movq	80(%rsp), %rdi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2973:
+	movdqa	.LC33(%rip), %xmm6
+	movaps	%xmm6, 64(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L2981
+	movq	%rax, 80(%rsp)
+	pxor	%xmm0, %xmm0
+	leaq	88(%rsp), %rbx
+	xorl	%r12d, %r12d
+	movq	$0, 104(%rsp)
+	movups	%xmm0, 88(%rsp)
+.L3103:
+	leaq	.LC44(%rip), %rsi
+.L2982:
+	leaq	(%rbx,%r12), %rdi
+	movl	$5, %edx
+	call	memmove@PLT
+	movq	64(%rsp), %rax
+	leaq	5(%rax), %rdx
+	movq	%rdx, 64(%rsp)
+	movb	$0, 5(%rbx,%rax)
+	movq	48(%rbp), %rdx
+	movq	72(%rsp), %rbx
+	cmpq	64(%rsp), %rdx
+	je	.L3311
+.L2995:
+	cmpq	$23, %rbx
+	je	.L3005
+	movq	80(%rsp), %rdi
+	movq	88(%rsp), %rsi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L3005:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC48(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB115:
+	call	__cxa_throw@PLT
+.LEHE115:
+	.p2align 4,,10
+	.p2align 3
+.L3304:
+	leaq	5(%rbx), %rdx
+	movq	56(%rsp), %rdi
+	leaq	(%rdx,%rdx), %rax
+	leaq	(%rax,%rdx), %rsi
+	movq	%rax, 40(%rsp)
+	movq	(%rdi), %rax
+	movl	$8, %edx
+	salq	$5, %rsi
+.LEHB116:
+	call	*16(%rax)
+	leaq	(%rbx,%rbx,2), %rbx
+	movdqa	.LC33(%rip), %xmm2
+	movq	%rax, 32(%rsp)
+	movq	%rax, %rbp
+	salq	$4, %rbx
+	addq	%rax, %rbx
+	movups	%xmm2, (%rbx)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L3312
+.L2939:
+	movq	80(%rsp), %rax
+	movdqa	64(%rsp), %xmm3
+	pxor	%xmm0, %xmm0
+	movq	$0, 40(%rbx)
+	movups	%xmm0, 24(%rbx)
+	movq	%rax, 16(%rbx)
+	movq	72(%rsp), %rax
+	movups	%xmm3, (%rbx)
+	cmpq	$23, %rax
+	je	.L3313
+	movq	$23, 72(%rsp)
+	movq	88(%rsp), %rax
+	movq	%rax, 24(%rbx)
+.L2943:
+	movq	$0, 64(%rsp)
+	movb	$0, 88(%rsp)
+	testq	%r12, %r12
+	jne	.L3314
+	testq	%r14, %r14
+	je	.L2946
+.L2945:
+	movq	56(%rsp), %rdi
+	leaq	(%r15,%r15,2), %rdx
+	movl	$8, %ecx
+	movq	%r14, %rsi
+	salq	$4, %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE116:
+	jmp	.L2947
+	.p2align 4,,10
+	.p2align 3
+.L3301:
+	leaq	5(%rbx), %rdx
+	movq	56(%rsp), %rdi
+	leaq	(%rdx,%rdx), %rax
+	leaq	(%rax,%rdx), %rsi
+	movq	%rax, 40(%rsp)
+	movq	(%rdi), %rax
+	movl	$8, %edx
+	salq	$5, %rsi
+.LEHB117:
+	call	*16(%rax)
+	leaq	(%rbx,%rbx,2), %rbx
+	movdqa	.LC33(%rip), %xmm6
+	movq	%rax, 32(%rsp)
+	movq	%rax, %rdi
+	salq	$4, %rbx
+	addq	%rax, %rbx
+	movups	%xmm6, (%rbx)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L3315
+.L2911:
+	movq	80(%rsp), %rax
+	movdqa	64(%rsp), %xmm7
+	pxor	%xmm0, %xmm0
+	movq	$0, 40(%rbx)
+	movups	%xmm0, 24(%rbx)
+	movq	%rax, 16(%rbx)
+	movq	72(%rsp), %rax
+	movups	%xmm7, (%rbx)
+	cmpq	$23, %rax
+	je	.L3316
+	movq	$23, 72(%rsp)
+	movq	88(%rsp), %rax
+	movq	%rax, 24(%rbx)
+.L2915:
+	movq	$0, 64(%rsp)
+	movb	$0, 88(%rsp)
+	testq	%r12, %r12
+	jne	.L3317
+	testq	%rbp, %rbp
+	je	.L2918
+.L2917:
+	movq	56(%rsp), %rdi
+	leaq	(%r14,%r14,2), %rdx
+	movl	$8, %ecx
+	movq	%rbp, %rsi
+	salq	$4, %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE117:
+.L2918:
+	addq	$1, %r12
+	jmp	.L2923
+	.p2align 4,,10
+	.p2align 3
+.L3297:
+	leaq	5(%rbx), %rdx
+	movq	56(%rsp), %rdi
+	leaq	(%rdx,%rdx), %rax
+	leaq	(%rax,%rdx), %rsi
+	movq	%rax, 40(%rsp)
+	movq	(%rdi), %rax
+	movl	$8, %edx
+	salq	$5, %rsi
+.LEHB118:
+	call	*16(%rax)
+	leaq	(%rbx,%rbx,2), %rbx
+	movdqa	.LC33(%rip), %xmm4
+	movq	%rax, 32(%rsp)
+	movq	%rax, %rdi
+	salq	$4, %rbx
+	addq	%rax, %rbx
+	movups	%xmm4, (%rbx)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L3318
+.L2882:
+	movq	80(%rsp), %rax
+	movdqa	64(%rsp), %xmm5
+	pxor	%xmm0, %xmm0
+	movq	$0, 40(%rbx)
+	movups	%xmm0, 24(%rbx)
+	movq	%rax, 16(%rbx)
+	movq	72(%rsp), %rax
+	movups	%xmm5, (%rbx)
+	cmpq	$23, %rax
+	je	.L3319
+	movq	$23, 72(%rsp)
+	movq	88(%rsp), %rax
+	movq	%rax, 24(%rbx)
+.L2886:
+	movq	$0, 64(%rsp)
+	movb	$0, 88(%rsp)
+	testq	%r12, %r12
+	jne	.L3320
+	testq	%rbp, %rbp
+	je	.L2889
+.L2888:
+	movq	56(%rsp), %rdi
+	leaq	(%r14,%r14,2), %rdx
+	movl	$8, %ecx
+	movq	%rbp, %rsi
+	salq	$4, %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE118:
+.L2889:
+	addq	$1, %r12
+	jmp	.L2894
+	.p2align 4,,10
+	.p2align 3
+.L3294:
+	leaq	5(%rbx), %rdx
+	movq	56(%rsp), %rdi
+	leaq	(%rdx,%rdx), %rax
+	leaq	(%rax,%rdx), %rsi
+	movq	%rax, 40(%rsp)
+	movq	(%rdi), %rax
+	movl	$8, %edx
+	salq	$5, %rsi
+.LEHB119:
+	call	*16(%rax)
+	leaq	(%rbx,%rbx,2), %rbx
+	movdqa	.LC33(%rip), %xmm2
+	movq	%rax, 32(%rsp)
+	movq	%rax, %rdi
+	salq	$4, %rbx
+	addq	%rax, %rbx
+	movups	%xmm2, (%rbx)
+	cmpq	$0, %fs:_ZN1n18__current_resourceE@tpoff
+	je	.L3321
+.L2854:
+	movq	80(%rsp), %rax
+	movdqa	64(%rsp), %xmm3
+	pxor	%xmm0, %xmm0
+	movq	$0, 40(%rbx)
+	movups	%xmm0, 24(%rbx)
+	movq	%rax, 16(%rbx)
+	movq	72(%rsp), %rax
+	movups	%xmm3, (%rbx)
+	cmpq	$23, %rax
+	je	.L3322
+	movq	$23, 72(%rsp)
+	movq	88(%rsp), %rax
+	movq	%rax, 24(%rbx)
+.L2858:
+	movq	$0, 64(%rsp)
+	movb	$0, 88(%rsp)
+	testq	%r12, %r12
+	jne	.L3323
+	testq	%rbp, %rbp
+	je	.L2861
+.L2860:
+	movq	56(%rsp), %rdi
+	leaq	0(%r13,%r13,2), %rdx
+	movl	$8, %ecx
+	movq	%rbp, %rsi
+	salq	$4, %rdx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE119:
+.L2861:
+	addq	$1, %r12
+	jmp	.L2866
+	.p2align 4,,10
+	.p2align 3
+.L3107:
+	movq	%r13, %rsi
+	jmp	.L2868
+.L3310:
+	leaq	24(%rbp), %rdi
+	testq	%rdx, %rdx
+	je	.L2976
+	jmp	.L2977
+.L2946:
+	movq	$1, 48(%rsp)
+	jmp	.L3049
+	.p2align 4,,10
+	.p2align 3
+.L3311:
+	cmpq	$23, %rbx
+	je	.L3324
+	movq	88(%rsp), %rax
+	cmpq	$23, 56(%rbp)
+	movq	%rax, %rsi
+	je	.L3325
+	testq	%rdx, %rdx
+	je	.L3001
+	movq	72(%rbp), %rdi
+.L3002:
+	movq	%rax, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L2995
+	movq	88(%rsp), %rsi
+	cmpq	$23, %rbx
+	je	.L2998
+.L3001:
+	movq	80(%rsp), %rdi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L2998:
+	movdqa	.LC33(%rip), %xmm7
+	movaps	%xmm7, 64(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L3006
+	movq	%rax, 80(%rsp)
+	pxor	%xmm0, %xmm0
+	leaq	88(%rsp), %rbx
+	xorl	%r13d, %r13d
+	movq	$0, 104(%rsp)
+	movups	%xmm0, 88(%rsp)
+.L3102:
+	leaq	.LC43(%rip), %rax
+.L3007:
+	movl	(%rax), %eax
+	movl	%eax, (%rbx,%r13)
+	movq	64(%rsp), %rax
+	leaq	4(%rax), %rdx
+	movq	%rdx, 64(%rsp)
+	movb	$0, 4(%rbx,%rax)
+	movq	144(%rbp), %rdx
+	movq	72(%rsp), %rbx
+	cmpq	64(%rsp), %rdx
+	je	.L3326
+.L3020:
+	cmpq	$23, %rbx
+	je	.L3030
+	movq	80(%rsp), %rdi
+	movq	88(%rsp), %rsi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L3030:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC49(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB120:
+	call	__cxa_throw@PLT
+.LEHE120:
+	.p2align 4,,10
+	.p2align 3
+.L3326:
+	cmpq	$23, %rbx
+	je	.L3327
+	movq	88(%rsp), %rax
+	cmpq	$23, 152(%rbp)
+	movq	%rax, %rsi
+	je	.L3328
+	testq	%rdx, %rdx
+	je	.L3026
+	movq	168(%rbp), %rdi
+.L3027:
+	movq	%rax, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L3020
+	movq	88(%rsp), %rsi
+	cmpq	$23, %rbx
+	je	.L3023
+.L3026:
+	movq	80(%rsp), %rdi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L3023:
+	movq	32(%rsp), %r13
+	movq	48(%rsp), %r12
+	xorl	%ebp, %ebp
+	movq	%r13, %rbx
+	testq	%r12, %r12
+	je	.L3036
+	.p2align 4,,10
+	.p2align 3
+.L3037:
+	movq	8(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L3034
+	movq	16(%rbx), %rdi
+	addq	$1, %rbp
+	movq	24(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	addq	$48, %rbx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	%rbp, %r12
+	jne	.L3037
+.L3036:
+	testq	%r13, %r13
+	je	.L2834
+	movq	40(%rsp), %rax
+	movq	56(%rsp), %rdi
+	movl	$8, %ecx
+	movq	%r13, %rsi
+	leaq	(%rax,%rax,2), %rdx
+	movq	(%rdi), %rax
+	salq	$4, %rdx
+	call	*24(%rax)
+.L2834:
+	addq	$120, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L3034:
+	.cfi_restore_state
+	addq	$1, %rbp
+	addq	$48, %rbx
+	cmpq	%rbp, %r12
+	jne	.L3037
+	jmp	.L3036
+	.p2align 4,,10
+	.p2align 3
+.L3006:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3329
+.L3011:
+	movq	_ZZN1n4heapEvE3res(%rip), %r14
+	movq	64(%rsp), %r13
+	pxor	%xmm0, %xmm0
+	movq	$0, 104(%rsp)
+	movq	72(%rsp), %r12
+	movups	%xmm0, 88(%rsp)
+	movq	%r14, 80(%rsp)
+	leaq	4(%r13), %r15
+	movq	$0, 8(%rsp)
+	cmpq	$23, %r12
+	je	.L3330
+.L3013:
+	movq	8(%rsp), %rax
+	addq	%r13, %rax
+	cmpq	%rax, (%rsp)
+	jnb	.L3331
+	movq	(%rsp), %rcx
+	movq	8(%rsp), %rax
+	subq	%rax, %rcx
+	movq	%rcx, (%rsp)
+	cmpq	%r15, %r12
+	jnb	.L3100
+	leaq	10(%r12,%r12), %rax
+	movl	$1, %edx
+	movq	%r14, %rdi
+	cmpq	%r15, %rax
+	cmovnb	%rax, %r15
+	movq	(%r14), %rax
+	leaq	1(%r15), %rsi
+.LEHB121:
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r12
+	je	.L3017
+	movq	(%r14), %rax
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L3017:
+	movq	%rbx, 88(%rsp)
+	movq	%r15, %r12
+	movq	%r15, 72(%rsp)
+.L3016:
+	cmpq	$23, %r12
+	jne	.L3291
+	leaq	88(%rsp), %rbx
+.L3291:
+	movq	(%rsp), %rax
+	addq	%rbx, %rax
+	jmp	.L3007
+.L3331:
+	cmpq	%r15, %r12
+	jnb	.L3099
+.L3047:
+	leaq	10(%r12,%r12), %rax
+	movl	$1, %edx
+	movq	%r14, %rdi
+	cmpq	%r15, %rax
+	cmovnb	%rax, %r15
+	movq	(%r14), %rax
+	leaq	1(%r15), %rsi
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%r13), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r12
+	je	.L3015
+	movq	(%r14), %rax
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L3015:
+	movq	%rbx, 88(%rsp)
+	movq	%r15, 72(%rsp)
+.L3009:
+	leaq	.LC43(%rip), %rax
+	cmpq	$23, %r15
+	jne	.L3007
+	leaq	88(%rsp), %rbx
+	jmp	.L3102
+	.p2align 4,,10
+	.p2align 3
+.L2981:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3332
+.L2986:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	64(%rsp), %r12
+	pxor	%xmm0, %xmm0
+	movq	$0, 104(%rsp)
+	movq	72(%rsp), %r14
+	movups	%xmm0, 88(%rsp)
+	movq	%r15, 80(%rsp)
+	leaq	5(%r12), %rax
+	movq	$0, 8(%rsp)
+	cmpq	$23, %r14
+	je	.L3333
+.L2988:
+	movq	8(%rsp), %rcx
+	leaq	(%rcx,%r12), %rdx
+	cmpq	%rdx, %r13
+	jnb	.L3334
+	movq	8(%rsp), %rcx
+	subq	%rcx, %r13
+	movq	%r13, 16(%rsp)
+	cmpq	%rax, %r14
+	jnb	.L3093
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, %r13
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%r12), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L2992
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L2992:
+	movq	%rbx, 88(%rsp)
+	movq	%r13, %r14
+	movq	%r13, 72(%rsp)
+.L2991:
+	cmpq	$23, %r14
+	jne	.L3289
+	leaq	88(%rsp), %rbx
+.L3289:
+	movq	16(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L2982
+.L3334:
+	cmpq	%rax, %r14
+	jnb	.L3092
+.L3048:
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, %r13
+	leaq	1(%rax), %rsi
+	movq	(%r15), %rax
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%r12), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L2990
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L2990:
+	movq	%rbx, 88(%rsp)
+	movq	%r13, 72(%rsp)
+.L2984:
+	leaq	.LC44(%rip), %rsi
+	cmpq	$23, %r13
+	jne	.L2982
+	leaq	88(%rsp), %rbx
+	jmp	.L3103
+	.p2align 4,,10
+	.p2align 3
+.L2955:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3335
+.L2959:
+	movq	_ZZN1n4heapEvE3res(%rip), %r12
+	movq	64(%rsp), %r15
+	pxor	%xmm0, %xmm0
+	movq	$0, 104(%rsp)
+	movq	72(%rsp), %r14
+	movups	%xmm0, 88(%rsp)
+	movq	%r12, 80(%rsp)
+	leaq	24(%r15), %rax
+	movq	$0, 16(%rsp)
+	cmpq	$23, %r14
+	je	.L3336
+.L2961:
+	movq	16(%rsp), %rcx
+	leaq	(%rcx,%r15), %rdx
+	cmpq	%rdx, 24(%rsp)
+	jnb	.L3337
+	movq	24(%rsp), %rdi
+	subq	%rcx, %rdi
+	movq	%rdi, 24(%rsp)
+	cmpq	%rax, %r14
+	jnb	.L3086
+	leaq	10(%r14,%r14), %rdx
+	movq	%r12, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, 8(%rsp)
+	leaq	1(%rax), %rsi
+	movq	(%r12), %rax
+	call	*16(%rax)
+	movq	16(%rsp), %rsi
+	leaq	1(%r15), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L2966
+	movq	(%r12), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r12, %rdi
+	call	*24(%rax)
+.L2966:
+	movq	8(%rsp), %rax
+	movq	%rbx, 88(%rsp)
+	movq	%rax, 72(%rsp)
+	movq	%rax, %r14
+.L2965:
+	cmpq	$23, %r14
+	jne	.L3287
+	leaq	88(%rsp), %rbx
+.L3287:
+	movq	24(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L2968
+.L3086:
+	xorl	%ebx, %ebx
+	jmp	.L2965
+.L3337:
+	xorl	%ebx, %ebx
+	cmpq	%rax, %r14
+	jnb	.L2963
+	movq	%r14, 8(%rsp)
+	jmp	.L2956
+	.p2align 4,,10
+	.p2align 3
+.L2924:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3338
+.L2929:
+	movq	_ZZN1n4heapEvE3res(%rip), %r14
+	movq	64(%rsp), %rbp
+	pxor	%xmm0, %xmm0
+	movq	$0, 104(%rsp)
+	movq	72(%rsp), %r12
+	movups	%xmm0, 88(%rsp)
+	leaq	.LC46(%rip), %rsi
+	movq	%r14, 80(%rsp)
+	leaq	3(%rbp), %r15
+	movq	$0, 8(%rsp)
+	cmpq	$23, %r12
+	je	.L3339
+.L2931:
+	movq	8(%rsp), %rax
+	addq	%rbp, %rax
+	cmpq	%rax, %rsi
+	jnb	.L3340
+	movq	8(%rsp), %rax
+	movq	%rsi, %rcx
+	subq	%rax, %rcx
+	movq	%rcx, 16(%rsp)
+	cmpq	%r15, %r12
+	jnb	.L3079
+	leaq	10(%r12,%r12), %rax
+	movl	$1, %edx
+	movq	%r14, %rdi
+	cmpq	%r15, %rax
+	cmovnb	%rax, %r15
+	movq	(%r14), %rax
+	leaq	1(%r15), %rsi
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r12
+	je	.L2935
+	movq	(%r14), %rax
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L2935:
+	movq	%rbx, 88(%rsp)
+	movq	%r15, %r12
+	movq	%r15, 72(%rsp)
+.L2934:
+	cmpq	$23, %r12
+	jne	.L3284
+	leaq	88(%rsp), %rbx
+.L3284:
+	movq	16(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L2925
+.L3340:
+	cmpq	%r15, %r12
+	jnb	.L3078
+.L3050:
+	leaq	10(%r12,%r12), %rax
+	movl	$1, %edx
+	movq	%r14, %rdi
+	cmpq	%r15, %rax
+	cmovnb	%rax, %r15
+	movq	(%r14), %rax
+	leaq	1(%r15), %rsi
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r12
+	je	.L2933
+	movq	(%r14), %rax
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L2933:
+	movq	%rbx, 88(%rsp)
+	movq	%r15, 72(%rsp)
+.L2927:
+	leaq	.LC46(%rip), %rsi
+	cmpq	$23, %r15
+	jne	.L2925
+	leaq	88(%rsp), %rbx
+	jmp	.L3268
+	.p2align 4,,10
+	.p2align 3
+.L3293:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3341
+.L2837:
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	movq	_ZZN1n4heapEvE3res(%rip), %rdx
+	jmp	.L2835
+	.p2align 4,,10
+	.p2align 3
+.L2839:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3342
+.L2844:
+	movq	_ZZN1n4heapEvE3res(%rip), %r14
+	movq	64(%rsp), %r13
+	pxor	%xmm0, %xmm0
+	xorl	%r15d, %r15d
+	movq	72(%rsp), %r12
+	leaq	.LC43(%rip), %rax
+	movups	%xmm0, 88(%rsp)
+	movq	%r14, 80(%rsp)
+	leaq	4(%r13), %rbp
+	movq	$0, 104(%rsp)
+	movq	%rax, (%rsp)
+	cmpq	$23, %r12
+	je	.L3343
+.L2846:
+	leaq	(%r15,%r13), %rax
+	cmpq	%rax, (%rsp)
+	jnb	.L3344
+	leaq	.LC43(%rip), %rax
+	subq	%r15, %rax
+	movq	%rax, 8(%rsp)
+	cmpq	%rbp, %r12
+	jnb	.L3058
+	leaq	10(%r12,%r12), %rax
+	movl	$1, %edx
+	movq	%r14, %rdi
+	cmpq	%rbp, %rax
+	cmovnb	%rax, %rbp
+	movq	(%r14), %rax
+	leaq	1(%rbp), %rsi
+	call	*16(%rax)
+	leaq	1(%r13), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r12
+	je	.L2850
+	movq	(%r14), %rax
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L2850:
+	movq	%rbx, 88(%rsp)
+	movq	%rbp, %r12
+	movq	%rbp, 72(%rsp)
+.L2849:
+	cmpq	$23, %r12
+	jne	.L3278
+	leaq	88(%rsp), %rbx
+.L3278:
+	movq	8(%rsp), %rax
+	addq	%rbx, %rax
+	jmp	.L2840
+.L3344:
+	cmpq	%rbp, %r12
+	jnb	.L3057
+.L3052:
+	leaq	10(%r12,%r12), %rax
+	movl	$1, %edx
+	movq	%r14, %rdi
+	cmpq	%rbp, %rax
+	cmovnb	%rax, %rbp
+	movq	(%r14), %rax
+	leaq	1(%rbp), %rsi
+	call	*16(%rax)
+	leaq	1(%r13), %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r12
+	je	.L2848
+	movq	(%r14), %rax
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L2848:
+	movq	%rbx, 88(%rsp)
+	movq	%rbp, 72(%rsp)
+.L2842:
+	leaq	.LC43(%rip), %rax
+	cmpq	$23, %rbp
+	jne	.L2840
+	leaq	88(%rsp), %rbx
+	jmp	.L3108
+	.p2align 4,,10
+	.p2align 3
+.L2867:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3345
+.L2872:
+	movq	_ZZN1n4heapEvE3res(%rip), %r14
+	movq	64(%rsp), %rbp
+	pxor	%xmm0, %xmm0
+	movq	$0, 104(%rsp)
+	movq	72(%rsp), %r12
+	movups	%xmm0, 88(%rsp)
+	leaq	.LC44(%rip), %r13
+	movq	%r14, 80(%rsp)
+	leaq	5(%rbp), %r15
+	movq	$0, 8(%rsp)
+	cmpq	$23, %r12
+	je	.L3346
+.L2874:
+	movq	8(%rsp), %rax
+	addq	%rbp, %rax
+	cmpq	%rax, %r13
+	jnb	.L3347
+	movq	8(%rsp), %rax
+	movq	%r13, %rcx
+	subq	%rax, %rcx
+	movq	%rcx, 16(%rsp)
+	cmpq	%r15, %r12
+	jnb	.L3065
+	leaq	10(%r12,%r12), %rax
+	movl	$1, %edx
+	movq	%r14, %rdi
+	cmpq	%r15, %rax
+	cmovnb	%rax, %r15
+	movq	(%r14), %rax
+	leaq	1(%r15), %rsi
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r12
+	je	.L2878
+	movq	(%r14), %rax
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L2878:
+	movq	%rbx, 88(%rsp)
+	movq	%r15, %r12
+	movq	%r15, 72(%rsp)
+.L2877:
+	cmpq	$23, %r12
+	jne	.L3280
+	leaq	88(%rsp), %rbx
+.L3280:
+	movq	16(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L2868
+.L3347:
+	cmpq	%r15, %r12
+	jnb	.L3064
+.L3051:
+	leaq	10(%r12,%r12), %rax
+	movl	$1, %edx
+	movq	%r14, %rdi
+	cmpq	%r15, %rax
+	cmovnb	%rax, %r15
+	movq	(%r14), %rax
+	leaq	1(%r15), %rsi
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%rbp), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r12
+	je	.L2876
+	movq	(%r14), %rax
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	*24(%rax)
+.L2876:
+	movq	%rbx, 88(%rsp)
+	movq	%r15, 72(%rsp)
+.L2870:
+	leaq	.LC44(%rip), %rsi
+	cmpq	$23, %r15
+	jne	.L2868
+	leaq	88(%rsp), %rbx
+	jmp	.L3267
+	.p2align 4,,10
+	.p2align 3
+.L2895:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3348
+.L2899:
+	movq	_ZZN1n4heapEvE3res(%rip), %rbp
+	movq	64(%rsp), %r14
+	pxor	%xmm0, %xmm0
+	leaq	.LC45(%rip), %rcx
+	movq	72(%rsp), %r12
+	movq	%rcx, 24(%rsp)
+	movq	%rbp, 80(%rsp)
+	leaq	24(%r14), %rax
+	movq	$0, 104(%rsp)
+	movq	$0, 8(%rsp)
+	movups	%xmm0, 88(%rsp)
+	cmpq	$23, %r12
+	je	.L3349
+.L2901:
+	movq	8(%rsp), %rcx
+	leaq	(%rcx,%r14), %rdx
+	cmpq	%rdx, 24(%rsp)
+	jnb	.L3350
+	movq	24(%rsp), %rdi
+	subq	%rcx, %rdi
+	movq	%rdi, 16(%rsp)
+	cmpq	%rax, %r12
+	jnb	.L3072
+	leaq	10(%r12,%r12), %rdx
+	movq	%rbp, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	movq	%rax, %r15
+	leaq	1(%rax), %rsi
+	movq	0(%rbp), %rax
+	call	*16(%rax)
+	movq	8(%rsp), %rsi
+	leaq	1(%r14), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r12
+	je	.L2906
+	movq	0(%rbp), %rax
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%rbp, %rdi
+	call	*24(%rax)
+.LEHE121:
+.L2906:
+	movq	%rbx, 88(%rsp)
+	movq	%r15, %r12
+	movq	%r15, 72(%rsp)
+.L2905:
+	cmpq	$23, %r12
+	jne	.L3282
+	leaq	88(%rsp), %rbx
+.L3282:
+	movq	16(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L2908
+.L3072:
+	xorl	%ebx, %ebx
+	jmp	.L2905
+.L3350:
+	xorl	%ebx, %ebx
+	cmpq	%rax, %r12
+	jnb	.L2903
+	movq	%r12, %r15
+	jmp	.L2896
+	.p2align 4,,10
+	.p2align 3
+.L3300:
+	leaq	88(%rsp), %rbx
+	jmp	.L2908
+	.p2align 4,,10
+	.p2align 3
+.L3307:
+	leaq	88(%rsp), %rbx
+	jmp	.L2968
+	.p2align 4,,10
+	.p2align 3
+.L3303:
+	movdqu	88(%rsp), %xmm6
+	movq	104(%rsp), %rax
+	movq	%rbx, %r12
+	movq	%rax, 40(%rbp)
+	movups	%xmm6, 24(%rbp)
+	jmp	.L2918
+	.p2align 4,,10
+	.p2align 3
+.L3306:
+	movdqu	88(%rsp), %xmm7
+	movq	104(%rsp), %rax
+	movups	%xmm7, 24(%rbp)
+	movq	%rax, 40(%rbp)
+	jmp	.L2952
+	.p2align 4,,10
+	.p2align 3
+.L3296:
+	movdqu	88(%rsp), %xmm4
+	movq	104(%rsp), %rax
+	movq	%rbx, %r12
+	movq	%rax, 40(%rbp)
+	movups	%xmm4, 24(%rbp)
+	jmp	.L2861
+	.p2align 4,,10
+	.p2align 3
+.L3299:
+	movdqu	88(%rsp), %xmm5
+	movq	104(%rsp), %rax
+	movq	%rbx, %r12
+	movq	%rax, 40(%rbp)
+	movups	%xmm5, 24(%rbp)
+	jmp	.L2889
+	.p2align 4,,10
+	.p2align 3
+.L3298:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	movq	48(%rsp), %rbx
+	testb	%al, %al
+	jne	.L2891
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	movq	48(%rsp), %rbx
+	testl	%eax, %eax
+	je	.L2891
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movq	48(%rsp), %rbx
+	jmp	.L2891
+	.p2align 4,,10
+	.p2align 3
+.L3305:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L3269
+.L3286:
+	movq	48(%rsp), %rbx
+	movq	32(%rsp), %r14
+	jmp	.L2949
+	.p2align 4,,10
+	.p2align 3
+.L3295:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	movq	48(%rsp), %rbx
+	testb	%al, %al
+	jne	.L2863
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	movq	48(%rsp), %rbx
+	testl	%eax, %eax
+	je	.L2863
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movq	48(%rsp), %rbx
+	jmp	.L2863
+	.p2align 4,,10
+	.p2align 3
+.L3302:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	movq	48(%rsp), %rbx
+	testb	%al, %al
+	jne	.L2920
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	movq	48(%rsp), %rbx
+	testl	%eax, %eax
+	je	.L2920
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	movq	48(%rsp), %rbx
+	jmp	.L2920
+	.p2align 4,,10
+	.p2align 3
+.L3324:
+	cmpq	$23, 56(%rbp)
+	je	.L3351
+	movq	72(%rbp), %rdi
+	leaq	88(%rsp), %rax
+	testq	%rdx, %rdx
+	jne	.L3002
+	jmp	.L2998
+	.p2align 4,,10
+	.p2align 3
+.L3327:
+	cmpq	$23, 152(%rbp)
+	je	.L3352
+	movq	168(%rbp), %rdi
+	leaq	88(%rsp), %rax
+	testq	%rdx, %rdx
+	jne	.L3027
+	jmp	.L3023
+	.p2align 4,,10
+	.p2align 3
+.L3309:
+	cmpq	$23, 8(%rbp)
+	je	.L3353
+	movq	24(%rbp), %rdi
+	leaq	88(%rsp), %rax
+	testq	%rdx, %rdx
+	jne	.L2977
+	jmp	.L2973
+	.p2align 4,,10
+	.p2align 3
+.L3323:
+	leaq	(%r12,%r12,2), %rdx
+	movq	%rbp, %rsi
+	salq	$4, %rdx
+	call	memcpy@PLT
+	jmp	.L2860
+	.p2align 4,,10
+	.p2align 3
+.L3314:
+	leaq	(%r12,%r12,2), %rdx
+	movq	%r14, %rsi
+	movq	%rbp, %rdi
+	salq	$4, %rdx
+	call	memcpy@PLT
+	jmp	.L2945
+	.p2align 4,,10
+	.p2align 3
+.L3320:
+	leaq	(%r12,%r12,2), %rdx
+	movq	%rbp, %rsi
+	salq	$4, %rdx
+	call	memcpy@PLT
+	jmp	.L2888
+	.p2align 4,,10
+	.p2align 3
+.L3317:
+	leaq	(%r12,%r12,2), %rdx
+	movq	%rbp, %rsi
+	salq	$4, %rdx
+	call	memcpy@PLT
+	jmp	.L2917
+.L3325:
+	leaq	72(%rbp), %rdi
+	testq	%rdx, %rdx
+	je	.L3001
+	jmp	.L3002
+.L3328:
+	leaq	168(%rbp), %rdi
+	testq	%rdx, %rdx
+	je	.L3026
+	jmp	.L3027
+.L3313:
+	movdqu	88(%rsp), %xmm7
+	movq	104(%rsp), %rax
+	movups	%xmm7, 24(%rbx)
+	movq	%rax, 40(%rbx)
+	jmp	.L2943
+.L3322:
+	movdqu	88(%rsp), %xmm4
+	movq	104(%rsp), %rax
+	movups	%xmm4, 24(%rbx)
+	movq	%rax, 40(%rbx)
+	jmp	.L2858
+.L3319:
+	movdqu	88(%rsp), %xmm5
+	movq	104(%rsp), %rax
+	movups	%xmm5, 24(%rbx)
+	movq	%rax, 40(%rbx)
+	jmp	.L2886
+.L3316:
+	movdqu	88(%rsp), %xmm6
+	movq	104(%rsp), %rax
+	movups	%xmm6, 24(%rbx)
+	movq	%rax, 40(%rbx)
+	jmp	.L2915
+.L3315:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2912
+.L3283:
+	movq	48(%rsp), %r12
+	movq	32(%rsp), %rdi
+	jmp	.L2911
+.L3312:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2940
+.L3285:
+	movq	48(%rsp), %r12
+	movq	32(%rsp), %rbp
+	jmp	.L2939
+.L3321:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2855
+.L3279:
+	movq	48(%rsp), %r12
+	movq	32(%rsp), %rdi
+	jmp	.L2854
+.L3318:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L2883
+.L3281:
+	movq	48(%rsp), %r12
+	movq	32(%rsp), %rdi
+	jmp	.L2882
+.L3345:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2872
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2872
+.L3348:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2899
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2899
+.L3341:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2837
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2837
+.L3332:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2986
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2986
+.L3329:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3011
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3011
+.L3342:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2844
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2844
+.L3338:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2929
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2929
+.L3335:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L2959
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L2959
+.L2883:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3281
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3281
+.L2855:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3279
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3279
+.L2940:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3285
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3285
+.L2912:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r12
+	movq	%r12, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3283
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3283
+.L3353:
+	testq	%rdx, %rdx
+	je	.L2973
+	leaq	88(%rsp), %rbx
+	leaq	24(%rbp), %rdi
+	movq	%rbx, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L2980
+	jmp	.L2973
+.L3352:
+	testq	%rdx, %rdx
+	je	.L3023
+	leaq	88(%rsp), %rsi
+	leaq	168(%rbp), %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L3030
+	jmp	.L3023
+.L3351:
+	testq	%rdx, %rdx
+	je	.L2998
+	leaq	88(%rsp), %rbx
+	leaq	72(%rbp), %rdi
+	movq	%rbx, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L3005
+	jmp	.L2998
+.L3269:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L3286
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L3286
+.L3064:
+	xorl	%ebx, %ebx
+	movq	%r12, %r15
+	jmp	.L2870
+.L3057:
+	xorl	%ebx, %ebx
+	movq	%r12, %rbp
+	jmp	.L2842
+.L3078:
+	xorl	%ebx, %ebx
+	movq	%r12, %r15
+	jmp	.L2927
+.L3092:
+	xorl	%ebx, %ebx
+	movq	%r14, %r13
+	jmp	.L2984
+.L3099:
+	xorl	%ebx, %ebx
+	movq	%r12, %r15
+	jmp	.L3009
+.L3333:
+	leaq	88(%rsp), %rbx
+	cmpq	%rbx, %r13
+	jnb	.L3354
+	cmpq	$23, %rax
+	jbe	.L3103
+	movq	%rbx, 8(%rsp)
+	jmp	.L3048
+.L3058:
+	xorl	%ebx, %ebx
+	jmp	.L2849
+.L3079:
+	xorl	%ebx, %ebx
+	jmp	.L2934
+.L3093:
+	xorl	%ebx, %ebx
+	jmp	.L2991
+.L3339:
+	leaq	88(%rsp), %rbx
+	cmpq	%rbx, %rsi
+	jnb	.L3355
+	cmpq	$23, %r15
+	jbe	.L2925
+	movq	%rbx, 8(%rsp)
+	jmp	.L3050
+.L3336:
+	leaq	88(%rsp), %rbx
+	cmpq	%rbx, 24(%rsp)
+	jnb	.L3356
+	cmpq	$23, %rax
+	ja	.L3357
+	leaq	.LC45(%rip), %rsi
+	jmp	.L2968
+.L3355:
+	movq	%rbx, 8(%rsp)
+	jmp	.L2931
+.L3357:
+	movq	$23, 8(%rsp)
+	movq	%rbx, 16(%rsp)
+	jmp	.L2956
+.L3356:
+	movq	%rbx, 16(%rsp)
+	jmp	.L2961
+	.p2align 4,,10
+	.p2align 3
+.L3065:
+	xorl	%ebx, %ebx
+	jmp	.L2877
+.L3346:
+	leaq	88(%rsp), %rbx
+	cmpq	%rbx, %r13
+	jnb	.L3358
+	cmpq	$23, %r15
+	jbe	.L3107
+	movq	%rbx, 8(%rsp)
+	jmp	.L3051
+.L3349:
+	leaq	88(%rsp), %rbx
+	cmpq	%rbx, %rcx
+	jnb	.L3359
+	cmpq	$23, %rax
+	ja	.L3360
+	movq	%rcx, %rsi
+	jmp	.L2908
+.L3358:
+	movq	%rbx, 8(%rsp)
+	jmp	.L2874
+.L3360:
+	movq	%rbx, 8(%rsp)
+	movl	$23, %r15d
+	jmp	.L2896
+.L3359:
+	movq	%rbx, 8(%rsp)
+	jmp	.L2901
+	.p2align 4,,10
+	.p2align 3
+.L3100:
+	xorl	%ebx, %ebx
+	jmp	.L3016
+.L3330:
+	leaq	88(%rsp), %rbx
+	cmpq	%rbx, (%rsp)
+	jnb	.L3361
+	cmpq	$23, %r15
+	jbe	.L3102
+	movq	%rbx, 8(%rsp)
+	jmp	.L3047
+.L3343:
+	leaq	88(%rsp), %rbx
+	cmpq	%rbx, %rax
+	jnb	.L3362
+	cmpq	$23, %rbp
+	jbe	.L3108
+	movq	%rbx, %r15
+	jmp	.L3052
+.L3354:
+	movq	%rbx, 8(%rsp)
+	jmp	.L2988
+.L3361:
+	movq	%rbx, 8(%rsp)
+	jmp	.L3013
+.L3362:
+	movq	%rbx, %r15
+	jmp	.L2846
+.L3110:
+	movq	%rax, %rbx
+	jmp	.L3040
+.L3109:
+	movq	%rax, %rbx
+	jmp	.L3038
+.L3112:
+	movq	%rax, %rbx
+	jmp	.L3043
+.L3111:
+	movq	%rax, %rbx
+	jmp	.L3041
+.L3113:
+	movq	%rax, %rbx
+	jmp	.L3045
+	.section	.gcc_except_table
+.LLSDA6783:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6783-.LLSDACSB6783
+.LLSDACSB6783:
+	.uleb128 .LEHB113-.LFB6783
+	.uleb128 .LEHE113-.LEHB113
+	.uleb128 .L3110-.LFB6783
+	.uleb128 0
+	.uleb128 .LEHB114-.LFB6783
+	.uleb128 .LEHE114-.LEHB114
+	.uleb128 .L3110-.LFB6783
+	.uleb128 0
+	.uleb128 .LEHB115-.LFB6783
+	.uleb128 .LEHE115-.LEHB115
+	.uleb128 .L3110-.LFB6783
+	.uleb128 0
+	.uleb128 .LEHB116-.LFB6783
+	.uleb128 .LEHE116-.LEHB116
+	.uleb128 .L3113-.LFB6783
+	.uleb128 0
+	.uleb128 .LEHB117-.LFB6783
+	.uleb128 .LEHE117-.LEHB117
+	.uleb128 .L3112-.LFB6783
+	.uleb128 0
+	.uleb128 .LEHB118-.LFB6783
+	.uleb128 .LEHE118-.LEHB118
+	.uleb128 .L3111-.LFB6783
+	.uleb128 0
+	.uleb128 .LEHB119-.LFB6783
+	.uleb128 .LEHE119-.LEHB119
+	.uleb128 .L3109-.LFB6783
+	.uleb128 0
+	.uleb128 .LEHB120-.LFB6783
+	.uleb128 .LEHE120-.LEHB120
+	.uleb128 .L3110-.LFB6783
+	.uleb128 0
+	.uleb128 .LEHB121-.LFB6783
+	.uleb128 .LEHE121-.LEHB121
+	.uleb128 .L3110-.LFB6783
+	.uleb128 0
+.LLSDACSE6783:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6783
+	.type	_Z17test_sort_stringsv.cold, @function
+_Z17test_sort_stringsv.cold:
+.LFSB6783:
+.L3043:
+	.cfi_def_cfa_offset 176
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	72(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L3040
+	movq	80(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	88(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L3040:
+	leaq	32(%rsp), %rdi
+	call	_ZN1n6vectorINS_6stringIcEEE9__releaseEv
+	movq	%rbx, %rdi
+.LEHB122:
+	call	_Unwind_Resume@PLT
+.LEHE122:
+.L3038:
+	movq	72(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L3040
+	movq	80(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	88(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L3040
+.L3041:
+	movq	72(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L3040
+	movq	80(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	88(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L3040
+.L3045:
+	movq	72(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L3040
+	movq	80(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	88(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L3040
+	.cfi_endproc
+.LFE6783:
+	.section	.gcc_except_table
+.LLSDAC6783:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6783-.LLSDACSBC6783
+.LLSDACSBC6783:
+	.uleb128 .LEHB122-.LCOLDB50
+	.uleb128 .LEHE122-.LEHB122
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6783:
+	.section	.text.unlikely
+	.text
+	.size	_Z17test_sort_stringsv, .-_Z17test_sort_stringsv
+	.section	.text.unlikely
+	.size	_Z17test_sort_stringsv.cold, .-_Z17test_sort_stringsv.cold
+.LCOLDE50:
+	.text
+.LHOTE50:
+	.weak	_ZTSN1n15memory_resourceE
+	.section	.rodata._ZTSN1n15memory_resourceE,"aG",@progbits,_ZTSN1n15memory_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n15memory_resourceE, @object
+	.size	_ZTSN1n15memory_resourceE, 22
+_ZTSN1n15memory_resourceE:
+	.string	"N1n15memory_resourceE"
+	.weak	_ZTIN1n15memory_resourceE
+	.section	.data.rel.ro._ZTIN1n15memory_resourceE,"awG",@progbits,_ZTIN1n15memory_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n15memory_resourceE, @object
+	.size	_ZTIN1n15memory_resourceE, 16
+_ZTIN1n15memory_resourceE:
+	.quad	_ZTVN10__cxxabiv117__class_type_infoE+16
+	.quad	_ZTSN1n15memory_resourceE
+	.weak	_ZTSN1n13heap_resourceE
+	.section	.rodata._ZTSN1n13heap_resourceE,"aG",@progbits,_ZTSN1n13heap_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n13heap_resourceE, @object
+	.size	_ZTSN1n13heap_resourceE, 20
+_ZTSN1n13heap_resourceE:
+	.string	"N1n13heap_resourceE"
+	.weak	_ZTIN1n13heap_resourceE
+	.section	.data.rel.ro._ZTIN1n13heap_resourceE,"awG",@progbits,_ZTIN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n13heap_resourceE, @object
+	.size	_ZTIN1n13heap_resourceE, 24
+_ZTIN1n13heap_resourceE:
+	.quad	_ZTVN10__cxxabiv120__si_class_type_infoE+16
+	.quad	_ZTSN1n13heap_resourceE
+	.quad	_ZTIN1n15memory_resourceE
+	.weak	_ZTVN1n13heap_resourceE
+	.section	.data.rel.ro.local._ZTVN1n13heap_resourceE,"awG",@progbits,_ZTVN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTVN1n13heap_resourceE, @object
+	.size	_ZTVN1n13heap_resourceE, 48
+_ZTVN1n13heap_resourceE:
+	.quad	0
+	.quad	_ZTIN1n13heap_resourceE
+	.quad	_ZN1n13heap_resourceD1Ev
+	.quad	_ZN1n13heap_resourceD0Ev
+	.quad	_ZN1n13heap_resource8allocateEmm
+	.quad	_ZN1n13heap_resource10deallocateEPvmm
+	.globl	seed
+	.data
+	.align 8
+	.type	seed, @object
+	.size	seed, 8
+seed:
+	.quad	42
+	.weak	_ZN1n18__current_resourceE
+	.section	.tbss._ZN1n18__current_resourceE,"awTG",@nobits,_ZN1n18__current_resourceE,comdat
+	.align 8
+	.type	_ZN1n18__current_resourceE, @gnu_unique_object
+	.size	_ZN1n18__current_resourceE, 8
+_ZN1n18__current_resourceE:
+	.zero	8
+	.weak	_ZGVZN1n4heapEvE3res
+	.section	.bss._ZGVZN1n4heapEvE3res,"awG",@nobits,_ZGVZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZGVZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZGVZN1n4heapEvE3res, 8
+_ZGVZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE3res
+	.section	.bss._ZZN1n4heapEvE3res,"awG",@nobits,_ZZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZZN1n4heapEvE3res, 8
+_ZZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE7storage
+	.section	.bss._ZZN1n4heapEvE7storage,"awG",@nobits,_ZZN1n4heapEvE7storage,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE7storage, @gnu_unique_object
+	.size	_ZZN1n4heapEvE7storage, 8
+_ZZN1n4heapEvE7storage:
+	.zero	8
+	.section	.rodata.cst2,"aM",@progbits,2
+	.align 2
+.LC14:
+	.byte	10
+	.byte	0
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC31:
+	.long	8
+	.long	100
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC33:
+	.quad	0
+	.quad	23
+	.align 16
+.LC35:
+	.quad	0
+	.quad	5
+	.hidden	DW.ref._ZTIPKc
+	.weak	DW.ref._ZTIPKc
+	.section	.data.rel.local.DW.ref._ZTIPKc,"awG",@progbits,DW.ref._ZTIPKc,comdat
+	.align 8
+	.type	DW.ref._ZTIPKc, @object
+	.size	DW.ref._ZTIPKc, 8
+DW.ref._ZTIPKc:
+	.quad	_ZTIPKc
+	.hidden	DW.ref.__gxx_personality_v0
+	.weak	DW.ref.__gxx_personality_v0
+	.section	.data.rel.local.DW.ref.__gxx_personality_v0,"awG",@progbits,DW.ref.__gxx_personality_v0,comdat
+	.align 8
+	.type	DW.ref.__gxx_personality_v0, @object
+	.size	DW.ref.__gxx_personality_v0, 8
+DW.ref.__gxx_personality_v0:
+	.quad	__gxx_personality_v0
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,5770 @@
+	.file	"tests-std-reader.cpp"
+	.text
+	.section	.text._ZN1n13heap_resourceD2Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD2Ev
+	.type	_ZN1n13heap_resourceD2Ev, @function
+_ZN1n13heap_resourceD2Ev:
+.LFB7014:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7014:
+	.size	_ZN1n13heap_resourceD2Ev, .-_ZN1n13heap_resourceD2Ev
+	.weak	_ZN1n13heap_resourceD1Ev
+	.set	_ZN1n13heap_resourceD1Ev,_ZN1n13heap_resourceD2Ev
+	.text
+	.p2align 4
+	.globl	_Z4feedPv
+	.type	_Z4feedPv, @function
+_Z4feedPv:
+.LFB6940:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movabsq	$5675921253449092805, %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movabsq	$2951479051793528259, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movl	$10000, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$10008, %rsp
+	.cfi_def_cfa_offset 10064
+	movl	(%rdi), %ebx
+	movq	%rsp, %rbp
+	movq	%rbp, %r13
+	.p2align 4,,10
+	.p2align 3
+.L8:
+	leaq	-10000(%r12), %rcx
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	movq	%rcx, %rdx
+	shrq	$2, %rdx
+	movq	%rdx, %rax
+	mulq	%r14
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	movq	%rcx, %rdx
+	salq	$2, %rax
+	subq	%rax, %rdx
+	cmpq	$99, %rdx
+	je	.L4
+	movq	%rcx, %rax
+	mulq	%r15
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,2), %rax
+	leaq	(%rdx,%rax,4), %rdx
+	movq	%rcx, %rax
+	addq	%rdx, %rdx
+	subq	%rdx, %rax
+	addl	$97, %eax
+	movb	%al, 0(%r13,%rcx)
+	addq	$1, %rcx
+	cmpq	%r12, %rcx
+	jne	.L7
+.L6:
+	movl	$10000, %edx
+	movq	%rbp, %rsi
+	movl	%ebx, %edi
+	addq	$10000, %r12
+	call	write@PLT
+	subq	$10000, %r13
+	cmpq	$3010000, %r12
+	jne	.L8
+	movl	%ebx, %edi
+	call	close@PLT
+	addq	$10008, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	.cfi_restore_state
+	movb	$10, 0(%r13,%rcx)
+	addq	$1, %rcx
+	cmpq	%r12, %rcx
+	jne	.L7
+	jmp	.L6
+	.cfi_endproc
+.LFE6940:
+	.size	_Z4feedPv, .-_Z4feedPv
+	.section	.text._ZN1n13heap_resource8allocateEmm,"axG",@progbits,_ZN1n13heap_resource8allocateEmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource8allocateEmm
+	.type	_ZN1n13heap_resource8allocateEmm, @function
+_ZN1n13heap_resource8allocateEmm:
+.LFB6557:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rdx
+	jbe	.L12
+	movq	%rdx, %rsi
+	jmp	_ZnwmSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	jmp	_Znwm@PLT
+	.cfi_endproc
+.LFE6557:
+	.size	_ZN1n13heap_resource8allocateEmm, .-_ZN1n13heap_resource8allocateEmm
+	.section	.text._ZN1n13heap_resource10deallocateEPvmm,"axG",@progbits,_ZN1n13heap_resource10deallocateEPvmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource10deallocateEPvmm
+	.type	_ZN1n13heap_resource10deallocateEPvmm, @function
+_ZN1n13heap_resource10deallocateEPvmm:
+.LFB6558:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rcx
+	jbe	.L14
+	movq	%rcx, %rsi
+	jmp	_ZdlPvSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L14:
+	jmp	_ZdlPv@PLT
+	.cfi_endproc
+.LFE6558:
+	.size	_ZN1n13heap_resource10deallocateEPvmm, .-_ZN1n13heap_resource10deallocateEPvmm
+	.section	.text._ZN1n13heap_resourceD0Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD0Ev
+	.type	_ZN1n13heap_resourceD0Ev, @function
+_ZN1n13heap_resourceD0Ev:
+.LFB7016:
+	.cfi_startproc
+	movl	$8, %esi
+	jmp	_ZdlPvm@PLT
+	.cfi_endproc
+.LFE7016:
+	.size	_ZN1n13heap_resourceD0Ev, .-_ZN1n13heap_resourceD0Ev
+	.section	.text._ZN1n4fileIcLNS_4modeE6EED2Ev,"axG",@progbits,_ZN1n4fileIcLNS_4modeE6EED5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4fileIcLNS_4modeE6EED2Ev
+	.type	_ZN1n4fileIcLNS_4modeE6EED2Ev, @function
+_ZN1n4fileIcLNS_4modeE6EED2Ev:
+.LFB6966:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6966
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movl	(%rdi), %ebp
+	testl	%ebp, %ebp
+	js	.L17
+	cmpl	$2, 8(%rdi)
+	je	.L67
+.L18:
+	cmpb	$0, 4(%rbx)
+	jne	.L68
+.L23:
+	movl	$-1, (%rbx)
+.L17:
+	cmpq	$0, 16(%rbx)
+	je	.L24
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L69
+.L26:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	$0, 16(%rbx)
+.L24:
+	movq	48(%rbx), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 8(%rbx)
+	movups	%xmm0, 32(%rbx)
+	testq	%rdi, %rdi
+	je	.L28
+	call	fclose@PLT
+	movl	(%rbx), %ebp
+	movq	$0, 48(%rbx)
+	testl	%ebp, %ebp
+	js	.L65
+	cmpl	$2, 8(%rbx)
+	jne	.L32
+	movq	40(%rbx), %r12
+	testq	%r12, %r12
+	jne	.L70
+.L32:
+	cmpb	$0, 4(%rbx)
+	jne	.L71
+.L38:
+	movl	$-1, (%rbx)
+.L65:
+	movq	16(%rbx), %rax
+	testq	%rax, %rax
+	je	.L16
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L72
+.L41:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L16:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L67:
+	.cfi_restore_state
+	movq	40(%rdi), %r12
+	testq	%r12, %r12
+	je	.L18
+	movq	16(%rdi), %r13
+.L22:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L73
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L22
+	.p2align 4,,10
+	.p2align 3
+.L21:
+	movq	$0, 40(%rbx)
+	jmp	.L18
+	.p2align 4,,10
+	.p2align 3
+.L28:
+	movl	(%rbx), %eax
+	testl	%eax, %eax
+	js	.L16
+	cmpb	$0, 4(%rbx)
+	je	.L38
+.L71:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L38
+	.p2align 4,,10
+	.p2align 3
+.L68:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L23
+	.p2align 4,,10
+	.p2align 3
+.L72:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L41
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L41
+	.p2align 4,,10
+	.p2align 3
+.L69:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L26
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L26
+	.p2align 4,,10
+	.p2align 3
+.L70:
+	movq	16(%rbx), %r13
+.L37:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L74
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L37
+	.p2align 4,,10
+	.p2align 3
+.L36:
+	movq	$0, 40(%rbx)
+	jmp	.L32
+	.p2align 4,,10
+	.p2align 3
+.L73:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L21
+	jmp	.L22
+	.p2align 4,,10
+	.p2align 3
+.L74:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L36
+	jmp	.L37
+	.cfi_endproc
+.LFE6966:
+	.globl	__gxx_personality_v0
+	.section	.gcc_except_table._ZN1n4fileIcLNS_4modeE6EED2Ev,"aG",@progbits,_ZN1n4fileIcLNS_4modeE6EED5Ev,comdat
+.LLSDA6966:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6966-.LLSDACSB6966
+.LLSDACSB6966:
+.LLSDACSE6966:
+	.section	.text._ZN1n4fileIcLNS_4modeE6EED2Ev,"axG",@progbits,_ZN1n4fileIcLNS_4modeE6EED5Ev,comdat
+	.size	_ZN1n4fileIcLNS_4modeE6EED2Ev, .-_ZN1n4fileIcLNS_4modeE6EED2Ev
+	.weak	_ZN1n4fileIcLNS_4modeE6EED1Ev
+	.set	_ZN1n4fileIcLNS_4modeE6EED1Ev,_ZN1n4fileIcLNS_4modeE6EED2Ev
+	.section	.text._ZN1n7fd_file5closeEv,"axG",@progbits,_ZN1n7fd_file5closeEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n7fd_file5closeEv
+	.type	_ZN1n7fd_file5closeEv, @function
+_ZN1n7fd_file5closeEv:
+.LFB6639:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movl	(%rdi), %ebp
+	testl	%ebp, %ebp
+	js	.L76
+	cmpl	$2, 8(%rdi)
+	je	.L97
+.L77:
+	cmpb	$0, 4(%rbx)
+	jne	.L98
+.L82:
+	movl	$-1, (%rbx)
+.L76:
+	cmpq	$0, 16(%rbx)
+	je	.L83
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L99
+.L85:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	$0, 16(%rbx)
+.L83:
+	pxor	%xmm0, %xmm0
+	movl	$0, 8(%rbx)
+	movups	%xmm0, 32(%rbx)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L97:
+	.cfi_restore_state
+	movq	40(%rdi), %r12
+	testq	%r12, %r12
+	je	.L77
+	movq	16(%rdi), %r13
+.L81:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L100
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L81
+	.p2align 4,,10
+	.p2align 3
+.L80:
+	movq	$0, 40(%rbx)
+	jmp	.L77
+	.p2align 4,,10
+	.p2align 3
+.L98:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L82
+	.p2align 4,,10
+	.p2align 3
+.L99:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L85
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L85
+	.p2align 4,,10
+	.p2align 3
+.L100:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L80
+	jmp	.L81
+	.cfi_endproc
+.LFE6639:
+	.size	_ZN1n7fd_file5closeEv, .-_ZN1n7fd_file5closeEv
+	.section	.text._ZN1n10std_readerD2Ev,"axG",@progbits,_ZN1n10std_readerD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n10std_readerD2Ev
+	.type	_ZN1n10std_readerD2Ev, @function
+_ZN1n10std_readerD2Ev:
+.LFB6900:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6900
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	cmpq	$0, 40(%rdi)
+	je	.L102
+	movq	24(%rdi), %rsi
+	addq	56(%rdi), %rsi
+	xorl	%edx, %edx
+	movl	(%rdi), %edi
+	call	lseek@PLT
+	movq	48(%rbx), %rsi
+	movq	40(%rbx), %rdi
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	jmp	munmap@PLT
+	.p2align 4,,10
+	.p2align 3
+.L102:
+	.cfi_restore_state
+	cmpq	$0, 8(%rdi)
+	je	.L101
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L111
+.L105:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	16(%rbx), %rdx
+	movl	$64, %ecx
+	movq	8(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L101:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L111:
+	.cfi_restore_state
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L105
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L105
+	.cfi_endproc
+.LFE6900:
+	.section	.gcc_except_table._ZN1n10std_readerD2Ev,"aG",@progbits,_ZN1n10std_readerD5Ev,comdat
+.LLSDA6900:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6900-.LLSDACSB6900
+.LLSDACSB6900:
+.LLSDACSE6900:
+	.section	.text._ZN1n10std_readerD2Ev,"axG",@progbits,_ZN1n10std_readerD5Ev,comdat
+	.size	_ZN1n10std_readerD2Ev, .-_ZN1n10std_readerD2Ev
+	.weak	_ZN1n10std_readerD1Ev
+	.set	_ZN1n10std_readerD1Ev,_ZN1n10std_readerD2Ev
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC2:
+	.string	"expected equal : expected value : count, actual value : total / 100"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC3:
+	.string	"expected true : sized"
+	.section	.text.unlikely,"ax",@progbits
+.LCOLDB6:
+	.text
+.LHOTB6:
+	.p2align 4
+	.globl	_Z21test_std_reader_linesv
+	.type	_Z21test_std_reader_linesv, @function
+_Z21test_std_reader_linesv:
+.LFB6945:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6945
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$264, %rsp
+	.cfi_def_cfa_offset 320
+	leaq	40(%rsp), %rdi
+	call	pipe@PLT
+	xorl	%esi, %esi
+	leaq	32(%rsp), %rdi
+	leaq	44(%rsp), %rcx
+	leaq	_Z4feedPv(%rip), %rdx
+	call	pthread_create@PLT
+	movl	40(%rsp), %edi
+	movdqa	.LC0(%rip), %xmm0
+	leaq	112(%rsp), %rsi
+	movw	$0, 52(%rsp)
+	movl	%edi, 48(%rsp)
+	movq	$0, 56(%rsp)
+	movq	$0, 80(%rsp)
+	movq	$0, 88(%rsp)
+	movq	$0, 96(%rsp)
+	movq	$0, 104(%rsp)
+	movaps	%xmm0, 64(%rsp)
+	call	fstat@PLT
+	testl	%eax, %eax
+	jne	.L114
+	movl	136(%rsp), %eax
+	andl	$61440, %eax
+	cmpl	$32768, %eax
+	je	.L254
+.L115:
+	cmpl	$4096, %eax
+	je	.L255
+.L114:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L256
+.L122:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	64(%rsp), %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+.LEHB0:
+	call	*16(%rax)
+.LEHE0:
+	movq	%rax, 56(%rsp)
+.L119:
+	movdqa	.LC1(%rip), %xmm0
+	leaq	48(%rsp), %rcx
+	movq	%rcx, 24(%rsp)
+	movq	%rcx, 112(%rsp)
+	movups	%xmm0, 120(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L257
+.L124:
+	pxor	%xmm0, %xmm0
+	leaq	144(%rsp), %rbx
+	xorl	%edi, %edi
+	xorl	%edx, %edx
+	movaps	%xmm0, 144(%rsp)
+	pxor	%xmm0, %xmm0
+	movq	$0, 160(%rsp)
+	movaps	%xmm0, 176(%rsp)
+	movq	24(%rcx), %rsi
+	movq	%rax, 136(%rsp)
+	movq	32(%rcx), %rax
+	movq	$0, 168(%rsp)
+	movb	$0, 192(%rsp)
+	movb	$1, 15(%rsp)
+	movq	$0, 16(%rsp)
+	movq	%rbx, (%rsp)
+	jmp	.L128
+	.p2align 4,,10
+	.p2align 3
+.L130:
+	cmpb	$0, 15(%rsp)
+	movl	$1, %edx
+	je	.L129
+	movb	$0, 192(%rsp)
+	cmpq	$99, 176(%rsp)
+	sete	15(%rsp)
+	xorl	%edx, %edx
+.L129:
+	addq	$1, 16(%rsp)
+.L128:
+	testb	%dl, %dl
+	jne	.L130
+	subq	%rsi, %rax
+	cmpq	%rdi, %rax
+	cmova	%rdi, %rax
+	addq	%rsi, %rax
+	movq	%rax, 24(%rcx)
+	movq	(%rsp), %rax
+	cmpq	$23, 128(%rsp)
+	movq	$0, 184(%rsp)
+	movq	$0, 120(%rsp)
+	je	.L131
+	movq	144(%rsp), %rax
+.L131:
+	movb	$0, (%rax)
+	movq	112(%rsp), %r13
+	xorl	%r15d, %r15d
+	movq	32(%r13), %rax
+	movq	24(%r13), %rbx
+.L132:
+	movq	%rax, %r12
+	leaq	1(%r15), %r14
+	movq	8(%r13), %rdi
+	subq	%rbx, %r12
+	cmpq	%r14, %r12
+	jnb	.L133
+	cmpb	$0, 5(%r13)
+	jne	.L133
+	testq	%rbx, %rbx
+	jne	.L258
+	movq	16(%r13), %rbp
+	cmpq	%rbp, %r14
+	cmova	%rbp, %r14
+	cmpq	%r14, %rax
+	jnb	.L193
+	.p2align 4,,10
+	.p2align 3
+.L140:
+	movl	0(%r13), %r12d
+	subq	%rax, %rbp
+	leaq	(%rdi,%rax), %rbx
+	jmp	.L137
+	.p2align 4,,10
+	.p2align 3
+.L260:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L259
+.L137:
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movl	%r12d, %edi
+.LEHB1:
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L260
+	movq	32(%r13), %r12
+	je	.L136
+	addq	%r12, %rax
+	movq	%rax, 32(%r13)
+	cmpq	%r14, %rax
+	jnb	.L261
+	movq	16(%r13), %rbp
+	movq	8(%r13), %rdi
+	jmp	.L140
+	.p2align 4,,10
+	.p2align 3
+.L259:
+	movq	32(%r13), %r12
+.L136:
+	movq	24(%r13), %rbx
+	movq	8(%r13), %rdi
+	movb	$1, 5(%r13)
+	subq	%rbx, %r12
+	.p2align 4,,10
+	.p2align 3
+.L133:
+	addq	%rdi, %rbx
+	cmpq	%r12, %r15
+	jnb	.L141
+	leaq	(%rbx,%r15), %rbp
+	movq	%r12, %rdx
+	movl	$10, %esi
+	subq	%r15, %rdx
+	movq	%rbp, %rdi
+	call	memchr@PLT
+	testq	%rax, %rax
+	je	.L142
+	subq	%rbp, %rax
+	cmpq	$-1, %rax
+	je	.L142
+	movq	120(%rsp), %rdx
+	leaq	(%r15,%rax), %rbp
+	testq	%rdx, %rdx
+	jne	.L145
+	xorl	%eax, %eax
+	testq	%rbp, %rbp
+	je	.L147
+	leaq	-1(%rbp), %rax
+	cmpb	$13, -1(%rbx,%rbp)
+	cmovne	%rbp, %rax
+.L147:
+	addq	$1, %rbp
+	movq	%rbx, 168(%rsp)
+	movq	%rax, 176(%rsp)
+	movq	%rbp, %rdi
+	movq	%rbp, 184(%rsp)
+.L162:
+	movq	112(%rsp), %rcx
+	movb	$1, 192(%rsp)
+	movq	24(%rcx), %rsi
+	movq	32(%rcx), %rax
+	jmp	.L130
+	.p2align 4,,10
+	.p2align 3
+.L141:
+	movq	128(%rsp), %rbp
+	testq	%r12, %r12
+	je	.L262
+	movq	(%rsp), %rax
+	cmpq	$23, %rbp
+	je	.L167
+	movq	144(%rsp), %rax
+.L167:
+	movq	120(%rsp), %rdi
+	leaq	(%r12,%rdi), %rdx
+	cmpq	%rax, %rbx
+	jb	.L168
+	leaq	(%rax,%rdi), %rcx
+	cmpq	%rcx, %rbx
+	jnb	.L168
+	subq	%rax, %rbx
+	movq	%rbx, %r13
+	cmpq	%rdx, %rbp
+	jnb	.L173
+	leaq	10(%rbp,%rbp), %rbp
+	movq	136(%rsp), %rdi
+	cmpq	%rdx, %rbp
+	cmovb	%rdx, %rbp
+	movq	(%rdi), %rax
+	movl	$1, %edx
+	leaq	1(%rbp), %rsi
+	call	*16(%rax)
+	movq	%rax, %rbx
+	movq	120(%rsp), %rax
+	cmpq	$23, 128(%rsp)
+	leaq	144(%rsp), %rsi
+	leaq	1(%rax), %rdx
+	je	.L174
+	movq	144(%rsp), %rsi
+.L174:
+	movq	%rbx, %rdi
+	call	memcpy@PLT
+	movq	128(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L175
+	movq	136(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	144(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L175:
+	movq	%rbx, 144(%rsp)
+	movq	120(%rsp), %rdi
+	movq	%rbp, 128(%rsp)
+.L173:
+	cmpq	$23, %rbp
+	je	.L263
+	movq	144(%rsp), %rax
+	leaq	(%rax,%r13), %rbx
+.L178:
+	movq	%rax, %r13
+.L177:
+	addq	%r13, %rdi
+	movq	%r12, %rdx
+	movq	%rbx, %rsi
+	call	memmove@PLT
+	movq	120(%rsp), %rax
+	addq	%r12, %rax
+	movq	%rax, 120(%rsp)
+	movb	$0, 0(%r13,%rax)
+	movq	112(%rsp), %r13
+	movq	32(%r13), %rax
+	movq	24(%r13), %rdx
+	movq	%rax, %rbx
+	subq	%rdx, %rbx
+	cmpq	%r12, %rbx
+	cmova	%r12, %rbx
+	xorl	%r15d, %r15d
+	addq	%rdx, %rbx
+	movq	%rbx, 24(%r13)
+	jmp	.L132
+	.p2align 4,,10
+	.p2align 3
+.L168:
+	cmpq	%rdx, %rbp
+	jnb	.L170
+	leaq	10(%rbp,%rbp), %rbp
+	movq	136(%rsp), %rdi
+	cmpq	%rdx, %rbp
+	cmovb	%rdx, %rbp
+	movq	(%rdi), %rax
+	movl	$1, %edx
+	leaq	1(%rbp), %rsi
+	call	*16(%rax)
+	cmpq	$23, 128(%rsp)
+	movq	%rax, %r13
+	movq	(%rsp), %rsi
+	movq	120(%rsp), %rax
+	leaq	1(%rax), %rdx
+	je	.L171
+	movq	144(%rsp), %rsi
+.L171:
+	movq	%r13, %rdi
+	call	memcpy@PLT
+	movq	128(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L172
+	movq	136(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	144(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L172:
+	movq	%r13, 144(%rsp)
+	movq	120(%rsp), %rdi
+	movq	%rbp, 128(%rsp)
+.L170:
+	movq	(%rsp), %r13
+	cmpq	$23, %rbp
+	je	.L177
+	movq	144(%rsp), %rax
+	jmp	.L178
+	.p2align 4,,10
+	.p2align 3
+.L142:
+	movq	112(%rsp), %r13
+	movq	%r12, %r15
+	movq	32(%r13), %rax
+	movq	24(%r13), %rbx
+	jmp	.L132
+.L261:
+	movq	24(%r13), %rbx
+	movq	8(%r13), %rdi
+	subq	%rbx, %rax
+	movq	%rax, %r12
+	jmp	.L133
+.L145:
+	movq	128(%rsp), %r12
+	leaq	144(%rsp), %rcx
+	cmpq	$23, %r12
+	je	.L148
+	movq	144(%rsp), %rcx
+.L148:
+	leaq	0(%rbp,%rdx), %rax
+	cmpq	%rcx, %rbx
+	jb	.L149
+	leaq	(%rcx,%rdx), %rsi
+	cmpq	%rsi, %rbx
+	jnb	.L149
+	subq	%rcx, %rbx
+	movq	%rbx, %r13
+	cmpq	%rax, %r12
+	jnb	.L154
+	leaq	10(%r12,%r12), %r12
+	movq	136(%rsp), %rdi
+	movl	$1, %edx
+	cmpq	%rax, %r12
+	cmovb	%rax, %r12
+	movq	(%rdi), %rax
+	leaq	1(%r12), %rsi
+	call	*16(%rax)
+	movq	%rax, %rbx
+	movq	120(%rsp), %rax
+	cmpq	$23, 128(%rsp)
+	leaq	144(%rsp), %rsi
+	leaq	1(%rax), %rdx
+	je	.L155
+	movq	144(%rsp), %rsi
+.L155:
+	movq	%rbx, %rdi
+	call	memcpy@PLT
+	movq	128(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L156
+	movq	136(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	144(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L156:
+	movq	%rbx, 144(%rsp)
+	movq	120(%rsp), %rdx
+	movq	%r12, 128(%rsp)
+.L154:
+	cmpq	$23, %r12
+	je	.L264
+	movq	144(%rsp), %rax
+	leaq	(%rax,%r13), %rbx
+	movq	%rax, %r13
+.L158:
+	leaq	0(%r13,%rdx), %rdi
+	movq	%rbx, %rsi
+	movq	%rbp, %rdx
+	call	memmove@PLT
+	movq	120(%rsp), %rax
+	leaq	144(%rsp), %rbx
+	addq	%rbp, %rax
+	movq	%rax, 120(%rsp)
+	movb	$0, 0(%r13,%rax)
+	movq	120(%rsp), %rax
+	cmpq	$23, 128(%rsp)
+	je	.L160
+	movq	144(%rsp), %rbx
+.L160:
+	testq	%rax, %rax
+	je	.L147
+	leaq	-1(%rax), %rdx
+	cmpb	$13, -1(%rbx,%rax)
+	cmove	%rdx, %rax
+	jmp	.L147
+.L149:
+	cmpq	%rax, %r12
+	jnb	.L151
+	leaq	10(%r12,%r12), %r12
+	movq	136(%rsp), %rdi
+	movl	$1, %edx
+	cmpq	%rax, %r12
+	cmovb	%rax, %r12
+	movq	(%rdi), %rax
+	leaq	1(%r12), %rsi
+	call	*16(%rax)
+	movq	%rax, %r13
+	movq	120(%rsp), %rax
+	cmpq	$23, 128(%rsp)
+	leaq	144(%rsp), %rsi
+	leaq	1(%rax), %rdx
+	je	.L152
+	movq	144(%rsp), %rsi
+.L152:
+	movq	%r13, %rdi
+	call	memcpy@PLT
+	movq	128(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L153
+	movq	136(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	144(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L153:
+	movq	%r13, 144(%rsp)
+	movq	120(%rsp), %rdx
+	movq	%r12, 128(%rsp)
+.L151:
+	leaq	144(%rsp), %r13
+	cmpq	$23, %r12
+	je	.L158
+	movq	144(%rsp), %rax
+	movq	%rax, %r13
+	jmp	.L158
+.L258:
+	leaq	(%rdi,%rbx), %rsi
+	movq	%r12, %rdx
+	call	memmove@PLT
+	movq	16(%r13), %rbp
+	movq	32(%r13), %rax
+	subq	24(%r13), %rax
+	movq	8(%r13), %rdi
+	movq	$0, 24(%r13)
+	cmpq	%rbp, %r14
+	movq	%rax, 32(%r13)
+	movq	%rax, %r12
+	cmova	%rbp, %r14
+	cmpq	%r14, %rax
+	jb	.L140
+.L193:
+	xorl	%ebx, %ebx
+	jmp	.L133
+.L263:
+	leaq	144(%rsp), %rax
+	leaq	(%rax,%r13), %rbx
+	movq	%rax, %r13
+	jmp	.L177
+.L256:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L122
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L122
+.L262:
+	movq	120(%rsp), %rdx
+	leaq	144(%rsp), %rax
+	cmpq	$23, %rbp
+	je	.L164
+	movq	144(%rsp), %rax
+.L164:
+	testq	%rdx, %rdx
+	jne	.L265
+	cmpq	$30000, 16(%rsp)
+	movq	%rax, 168(%rsp)
+	movq	$0, 176(%rsp)
+	movb	$0, 192(%rsp)
+	jne	.L266
+	cmpb	$0, 15(%rsp)
+	je	.L250
+	movq	32(%rsp), %rdi
+	xorl	%esi, %esi
+	call	pthread_join@PLT
+	movl	40(%rsp), %edi
+	call	close@PLT
+.LEHE1:
+	movq	128(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L180
+	movq	136(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	144(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L180:
+	cmpq	$0, 88(%rsp)
+	je	.L181
+	movl	48(%rsp), %edi
+	movq	72(%rsp), %rsi
+	xorl	%edx, %edx
+	addq	104(%rsp), %rsi
+	call	lseek@PLT
+	movq	96(%rsp), %rsi
+	movq	88(%rsp), %rdi
+	call	munmap@PLT
+.L112:
+	addq	$264, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L265:
+	.cfi_restore_state
+	cmpb	$13, -1(%rax,%rdx)
+	leaq	-1(%rdx), %rcx
+	movq	%rax, 168(%rsp)
+	cmovne	%rdx, %rcx
+	movq	184(%rsp), %rdi
+	movq	%rcx, 176(%rsp)
+	jmp	.L162
+.L255:
+	movl	64(%rsp), %edx
+	movl	48(%rsp), %edi
+	movl	$1031, %esi
+	xorl	%eax, %eax
+	movb	$1, 52(%rsp)
+.LEHB2:
+	call	fcntl@PLT
+.LEHE2:
+	jmp	.L114
+.L264:
+	leaq	144(%rsp), %rax
+	leaq	(%rax,%r13), %rbx
+	movq	%rax, %r13
+	jmp	.L158
+.L181:
+	cmpq	$0, 56(%rsp)
+	je	.L112
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L267
+.L184:
+	movq	64(%rsp), %rdx
+	movq	56(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L112
+.L257:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L268
+.L126:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	112(%rsp), %rcx
+	jmp	.L124
+.L254:
+	movl	48(%rsp), %edi
+	movl	$1, %edx
+	xorl	%esi, %esi
+	call	lseek@PLT
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	js	.L253
+	cmpq	160(%rsp), %rax
+	jl	.L269
+.L253:
+	movl	136(%rsp), %eax
+	andl	$61440, %eax
+	jmp	.L115
+.L267:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L184
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L184
+.L268:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L126
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L126
+.L269:
+	movl	$30, %edi
+	call	sysconf@PLT
+	movq	%rbx, %r9
+	movl	48(%rsp), %r8d
+	xorl	%edi, %edi
+	movq	%rax, %rcx
+	movq	%rbx, %rax
+	movq	160(%rsp), %rsi
+	cqto
+	idivq	%rcx
+	movl	$2, %ecx
+	subq	%rdx, %r9
+	movl	$1, %edx
+	subq	%r9, %rsi
+	movq	%r9, 104(%rsp)
+	movq	%rsi, 96(%rsp)
+	call	mmap@PLT
+	movq	%rax, %rbp
+	cmpq	$-1, %rax
+	je	.L253
+	movq	96(%rsp), %rsi
+	movl	$2, %edx
+	movq	%rax, %rdi
+	call	madvise@PLT
+	subq	104(%rsp), %rbx
+	movq	%rbp, 88(%rsp)
+	movq	%rbx, %xmm0
+	movq	%rbp, 56(%rsp)
+	movhps	96(%rsp), %xmm0
+	movb	$1, 53(%rsp)
+	movups	%xmm0, 72(%rsp)
+	jmp	.L119
+.L266:
+	jmp	.L188
+.L248:
+	jmp	.L249
+	.section	.gcc_except_table,"a",@progbits
+.LLSDA6945:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6945-.LLSDACSB6945
+.LLSDACSB6945:
+	.uleb128 .LEHB0-.LFB6945
+	.uleb128 .LEHE0-.LEHB0
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB1-.LFB6945
+	.uleb128 .LEHE1-.LEHB1
+	.uleb128 .L248-.LFB6945
+	.uleb128 0
+	.uleb128 .LEHB2-.LFB6945
+	.uleb128 .LEHE2-.LEHB2
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6945:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6945
+	.type	_Z21test_std_reader_linesv.cold, @function
+_Z21test_std_reader_linesv.cold:
+.LFSB6945:
+.L250:
+	.cfi_def_cfa_offset 320
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC3(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB3:
+	call	__cxa_throw@PLT
+.LEHE3:
+.L206:
+.L249:
+	movq	%rax, %rbx
+	movq	128(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L187
+	movq	136(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movl	$1, %ecx
+	movq	144(%rsp), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L187:
+	movq	24(%rsp), %rdi
+	call	_ZN1n10std_readerD1Ev
+	movq	%rbx, %rdi
+.LEHB4:
+	call	_Unwind_Resume@PLT
+.LEHE4:
+.L188:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC2(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB5:
+	call	__cxa_throw@PLT
+.LEHE5:
+	.cfi_endproc
+.LFE6945:
+	.section	.gcc_except_table
+.LLSDAC6945:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6945-.LLSDACSBC6945
+.LLSDACSBC6945:
+	.uleb128 .LEHB3-.LCOLDB6
+	.uleb128 .LEHE3-.LEHB3
+	.uleb128 .L206-.LCOLDB6
+	.uleb128 0
+	.uleb128 .LEHB4-.LCOLDB6
+	.uleb128 .LEHE4-.LEHB4
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB5-.LCOLDB6
+	.uleb128 .LEHE5-.LEHB5
+	.uleb128 .L206-.LCOLDB6
+	.uleb128 0
+.LLSDACSEC6945:
+	.section	.text.unlikely
+	.text
+	.size	_Z21test_std_reader_linesv, .-_Z21test_std_reader_linesv
+	.section	.text.unlikely
+	.size	_Z21test_std_reader_linesv.cold, .-_Z21test_std_reader_linesv.cold
+.LCOLDE6:
+	.text
+.LHOTE6:
+	.section	.rodata._ZN1n4test10test_suite7run_allEv.str1.1,"aMS",@progbits,1
+.LC7:
+	.string	"\nSUITE [%s] "
+.LC9:
+	.string	"%s"
+.LC10:
+	.string	"\nTEST [%s] "
+.LC11:
+	.string	" - Result : \033[1;32mPASSED\033[0m"
+.LC12:
+	.string	"\033[1;31merror : %s\033[0m\n"
+.LC13:
+	.string	" - Result : \033[1;31mFAILED\033[0m"
+.LC14:
+	.string	" - Passed : \033[1;32m%d\033[0m\n"
+.LC15:
+	.string	" - Failed : \033[1;31m%d\033[0m\n"
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4test10test_suite7run_allEv
+	.type	_ZN1n4test10test_suite7run_allEv, @function
+_ZN1n4test10test_suite7run_allEv:
+.LFB6938:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6938
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	leaq	.LC7(%rip), %rdx
+	movl	$79, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	16(%rdi), %rcx
+	leaq	16(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L271
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L272
+	testb	$4, %cl
+	jne	.L325
+	testl	%ecx, %ecx
+	je	.L271
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L326
+	.p2align 4,,10
+	.p2align 3
+.L271:
+	movzwl	.LC8(%rip), %r15d
+	movq	%rbx, %rsi
+	leaq	.LC9(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+.LEHB6:
+	call	printf@PLT
+	movl	8(%r12), %esi
+	testl	%esi, %esi
+	jle	.L292
+	movl	$0, 12(%rsp)
+	xorl	%ebp, %ebp
+	xorl	%r14d, %r14d
+	jmp	.L286
+	.p2align 4,,10
+	.p2align 3
+.L329:
+	testb	$4, %dl
+	jne	.L327
+	testl	%edx, %edx
+	je	.L277
+	movb	$42, (%rax)
+	testb	$2, %dl
+	jne	.L328
+	.p2align 4,,10
+	.p2align 3
+.L277:
+	movq	%rbx, %rsi
+	leaq	.LC9(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+.LEHE6:
+	movq	(%r12), %rax
+.LEHB7:
+	call	*8(%rax,%r13)
+.LEHE7:
+	leaq	.LC11(%rip), %rdi
+	addl	$1, %r14d
+.LEHB8:
+	call	puts@PLT
+.L282:
+	addq	$1, %rbp
+	cmpl	%ebp, 8(%r12)
+	jle	.L276
+.L286:
+	movq	(%r12), %rax
+	movq	%rbp, %r13
+	movq	%rbx, %rdi
+	movl	$79, %esi
+	salq	$4, %r13
+	leaq	.LC10(%rip), %rdx
+	movq	(%rax,%r13), %rcx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L277
+	movl	$79, %edx
+	subl	%eax, %edx
+	addq	%rbx, %rax
+	cmpl	$8, %edx
+	jb	.L329
+	movabsq	$3038287259199220266, %rsi
+	leaq	8(%rax), %rdi
+	movl	%edx, %ecx
+	andq	$-8, %rdi
+	movq	%rsi, (%rax)
+	movq	%rsi, -8(%rax,%rcx)
+	subq	%rdi, %rax
+	leal	(%rdx,%rax), %ecx
+	movq	%rsi, %rax
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L277
+.L292:
+	movl	$0, 12(%rsp)
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L276:
+	movabsq	$5917806138674729738, %rax
+	movq	%rbx, %rdi
+	movq	%rax, 16(%rsp)
+	movabsq	$9095440486453792, %rax
+	movq	%rax, 22(%rsp)
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L287
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L288
+	testb	$4, %cl
+	jne	.L330
+	testl	%ecx, %ecx
+	je	.L287
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L331
+.L287:
+	movq	%rbx, %rsi
+	leaq	.LC9(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+	movl	%r14d, %esi
+	leaq	.LC14(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	12(%rsp), %esi
+	leaq	.LC15(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	$10, %edi
+	call	putchar@PLT
+.LEHE8:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L288:
+	.cfi_restore_state
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L287
+.L272:
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L271
+.L327:
+	movl	$707406378, (%rax)
+	movl	$707406378, -4(%rax,%rdx)
+	jmp	.L277
+.L328:
+	movl	$10794, %ecx
+	movw	%cx, -2(%rax,%rdx)
+	jmp	.L277
+.L326:
+	movl	$10794, %edi
+	movw	%di, -2(%rdx,%rcx)
+	jmp	.L271
+.L331:
+	movl	$10794, %eax
+	movw	%ax, -2(%rdx,%rcx)
+	jmp	.L287
+.L325:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L271
+.L330:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L287
+.L293:
+	movq	%rax, %rdi
+	movq	%rdx, %rax
+.L283:
+	subq	$1, %rax
+	jne	.L324
+	call	__cxa_begin_catch@PLT
+	leaq	.LC12(%rip), %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+.LEHB9:
+	call	printf@PLT
+.LEHE9:
+	call	__cxa_end_catch@PLT
+	leaq	.LC13(%rip), %rdi
+	addl	$1, 12(%rsp)
+.LEHB10:
+	call	puts@PLT
+	jmp	.L282
+.L285:
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+.L324:
+	call	_Unwind_Resume@PLT
+.LEHE10:
+.L294:
+	movq	%rax, %rbx
+	jmp	.L285
+	.cfi_endproc
+.LFE6938:
+	.section	.gcc_except_table
+	.align 4
+.LLSDA6938:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT6938-.LLSDATTD6938
+.LLSDATTD6938:
+	.byte	0x1
+	.uleb128 .LLSDACSE6938-.LLSDACSB6938
+.LLSDACSB6938:
+	.uleb128 .LEHB6-.LFB6938
+	.uleb128 .LEHE6-.LEHB6
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB7-.LFB6938
+	.uleb128 .LEHE7-.LEHB7
+	.uleb128 .L293-.LFB6938
+	.uleb128 0x1
+	.uleb128 .LEHB8-.LFB6938
+	.uleb128 .LEHE8-.LEHB8
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB9-.LFB6938
+	.uleb128 .LEHE9-.LEHB9
+	.uleb128 .L294-.LFB6938
+	.uleb128 0
+	.uleb128 .LEHB10-.LFB6938
+	.uleb128 .LEHE10-.LEHB10
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6938:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	DW.ref._ZTIPKc-.
+.LLSDATT6938:
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.size	_ZN1n4test10test_suite7run_allEv, .-_ZN1n4test10test_suite7run_allEv
+	.text
+	.p2align 4
+	.globl	_Z7byte_atm
+	.type	_Z7byte_atm, @function
+_Z7byte_atm:
+.LFB6939:
+	.cfi_startproc
+	movabsq	$2951479051793528259, %rax
+	movq	%rdi, %rdx
+	movq	%rdi, %rcx
+	shrq	$2, %rdx
+	mulq	%rdx
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	movq	%rdi, %rdx
+	salq	$2, %rax
+	subq	%rax, %rdx
+	movl	$10, %eax
+	cmpq	$99, %rdx
+	je	.L332
+	movabsq	$5675921253449092805, %rax
+	mulq	%rdi
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,2), %rax
+	leaq	(%rdx,%rax,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+	leal	97(%rcx), %eax
+.L332:
+	ret
+	.cfi_endproc
+.LFE6939:
+	.size	_Z7byte_atm, .-_Z7byte_atm
+	.p2align 4
+	.globl	_Z11write_inputv
+	.type	_Z11write_inputv, @function
+_Z11write_inputv:
+.LFB6941:
+	.cfi_startproc
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 32
+	movl	$438, %edx
+	movl	$577, %esi
+	xorl	%eax, %eax
+	movq	path(%rip), %rdi
+	call	open@PLT
+	leaq	12(%rsp), %rdi
+	movl	%eax, 12(%rsp)
+	call	_Z4feedPv
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE6941:
+	.size	_Z11write_inputv, .-_Z11write_inputv
+	.p2align 4
+	.globl	_Z10same_bytesRN1n10std_readerEm
+	.type	_Z10same_bytesRN1n10std_readerEm, @function
+_Z10same_bytesRN1n10std_readerEm:
+.LFB6942:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	32(%rdi), %rdi
+	movq	24(%r14), %r9
+	movq	%rsi, 8(%rsp)
+	movq	%rdi, %rax
+	subq	%r9, %rax
+	cmpq	%r9, %rdi
+	jne	.L339
+	cmpb	$0, 5(%r14)
+	jne	.L340
+	testq	%rdi, %rdi
+	jne	.L389
+.L341:
+	movq	16(%r14), %rbx
+	movl	$1, %edx
+	cmpq	$0, %rbx
+	cmovbe	%rbx, %rdx
+	cmpq	%rdx, %rdi
+	jnb	.L370
+	.p2align 4,,10
+	.p2align 3
+.L348:
+	movq	8(%r14), %r12
+	movl	(%r14), %ebp
+	jmp	.L345
+	.p2align 4,,10
+	.p2align 3
+.L391:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L390
+.L345:
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	movl	%ebp, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L391
+	movq	32(%r14), %rdi
+	je	.L344
+	addq	%rax, %rdi
+	movq	%rdi, 32(%r14)
+	jne	.L392
+	movq	16(%r14), %rbx
+	jmp	.L348
+.L339:
+	movl	$4096, %edx
+	movq	8(%r14), %rbx
+	cmpq	%rdx, %rax
+	cmova	%rdx, %rax
+	leaq	(%rbx,%r9), %r8
+	addq	%rax, %r9
+	movq	%r9, 24(%r14)
+.L349:
+	movabsq	$2951479051793528259, %r15
+	movl	$1, %r12d
+	.p2align 4,,10
+	.p2align 3
+.L366:
+	movq	8(%rsp), %rcx
+	leaq	(%rax,%rcx), %rsi
+	subq	%rcx, %r8
+	testq	%rax, %rax
+	je	.L393
+	.p2align 4,,10
+	.p2align 3
+.L353:
+	testb	%r12b, %r12b
+	je	.L351
+	movq	%rcx, %rdx
+	movzbl	(%r8,%rcx), %r10d
+	shrq	$2, %rdx
+	movq	%rdx, %rax
+	mulq	%r15
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	movq	%rcx, %rdx
+	salq	$2, %rax
+	subq	%rax, %rdx
+	movl	$10, %eax
+	cmpq	$99, %rdx
+	je	.L352
+	movabsq	$5675921253449092805, %rax
+	mulq	%rcx
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,2), %rax
+	leaq	(%rdx,%rax,4), %rdx
+	movq	%rcx, %rax
+	addq	%rdx, %rdx
+	subq	%rdx, %rax
+	addl	$97, %eax
+.L352:
+	cmpb	%al, %r10b
+	sete	%r12b
+.L351:
+	addq	$1, %rcx
+	cmpq	%rcx, %rsi
+	jne	.L353
+.L368:
+	movq	%rdi, %rcx
+	movq	%rsi, 8(%rsp)
+	subq	%r9, %rcx
+	cmpq	%r9, %rdi
+	jne	.L354
+	cmpb	$0, 5(%r14)
+	je	.L394
+	movl	$4096, %eax
+	cmpq	%rax, %rcx
+	cmovbe	%rcx, %rax
+	addq	%rdi, %rax
+	movq	%rax, 24(%r14)
+.L365:
+	cmpq	$3000000, 8(%rsp)
+	sete	%al
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	andl	%r12d, %eax
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L354:
+	.cfi_restore_state
+	movl	$4096, %eax
+	leaq	(%rbx,%r9), %r8
+	cmpq	%rax, %rcx
+	cmovbe	%rcx, %rax
+	addq	%rax, %r9
+	movq	%r9, 24(%r14)
+	jmp	.L366
+	.p2align 4,,10
+	.p2align 3
+.L394:
+	testq	%rdi, %rdi
+	jne	.L395
+.L356:
+	movq	16(%r14), %rbp
+	movl	$1, %edx
+	cmpq	$0, %rbp
+	cmovbe	%rbp, %rdx
+	cmpq	%rdx, %rdi
+	jnb	.L372
+	.p2align 4,,10
+	.p2align 3
+.L363:
+	movl	(%r14), %r13d
+	jmp	.L360
+	.p2align 4,,10
+	.p2align 3
+.L397:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L396
+.L360:
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movl	%r13d, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L397
+	movq	32(%r14), %rdi
+	je	.L359
+	addq	%rax, %rdi
+	movq	%rdi, 32(%r14)
+	jne	.L398
+	movq	16(%r14), %rbp
+	movq	8(%r14), %rbx
+	jmp	.L363
+	.p2align 4,,10
+	.p2align 3
+.L396:
+	movq	32(%r14), %rdi
+.L359:
+	movq	24(%r14), %rdx
+	movq	%rdi, %rcx
+	movq	8(%r14), %rbx
+	movb	$1, 5(%r14)
+	subq	%rdx, %rcx
+.L357:
+	movl	$4096, %eax
+	leaq	(%rbx,%rdx), %r8
+	cmpq	%rax, %rcx
+	cmovbe	%rcx, %rax
+	leaq	(%rax,%rdx), %r9
+	movq	%r9, 24(%r14)
+	cmpq	%rdx, %rdi
+	jne	.L366
+	jmp	.L365
+	.p2align 4,,10
+	.p2align 3
+.L393:
+	movq	%rcx, %rsi
+	jmp	.L368
+.L398:
+	movq	24(%r14), %rdx
+	movq	%rdi, %rcx
+	movq	8(%r14), %rbx
+	subq	%rdx, %rcx
+	jmp	.L357
+.L395:
+	pxor	%xmm0, %xmm0
+	xorl	%ecx, %ecx
+	xorl	%edi, %edi
+	movups	%xmm0, 24(%r14)
+	jmp	.L356
+.L340:
+	movl	$4096, %edx
+	cmpq	%rdx, %rax
+	cmova	%rdx, %rax
+	addq	%rdi, %rax
+	movq	%rax, 24(%r14)
+.L350:
+	movl	$1, %r12d
+	jmp	.L365
+	.p2align 4,,10
+	.p2align 3
+.L390:
+	movq	32(%r14), %rdi
+.L344:
+	movq	24(%r14), %rdx
+	movb	$1, 5(%r14)
+	movq	%rdi, %rax
+	subq	%rdx, %rax
+.L342:
+	movl	$4096, %ecx
+	movq	8(%r14), %rbx
+	cmpq	%rcx, %rax
+	cmova	%rcx, %rax
+	leaq	(%rbx,%rdx), %r8
+	leaq	(%rax,%rdx), %r9
+	movq	%r9, 24(%r14)
+	cmpq	%rdx, %rdi
+	jne	.L349
+	jmp	.L350
+	.p2align 4,,10
+	.p2align 3
+.L392:
+	movq	24(%r14), %rdx
+	movq	%rdi, %rax
+	subq	%rdx, %rax
+	jmp	.L342
+.L372:
+	xorl	%edx, %edx
+	jmp	.L357
+.L389:
+	pxor	%xmm0, %xmm0
+	xorl	%eax, %eax
+	xorl	%edi, %edi
+	movups	%xmm0, 24(%r14)
+	jmp	.L341
+.L370:
+	xorl	%edx, %edx
+	jmp	.L342
+	.cfi_endproc
+.LFE6942:
+	.size	_Z10same_bytesRN1n10std_readerEm, .-_Z10same_bytesRN1n10std_readerEm
+	.section	.rodata.str1.1
+.LC17:
+	.string	"expected true : r.pipe()"
+.LC18:
+	.string	"expected false : r.mapped()"
+	.section	.rodata.str1.8
+	.align 8
+.LC19:
+	.string	"expected true : same_bytes(r, 0)"
+	.section	.text.unlikely
+.LCOLDB20:
+	.text
+.LHOTB20:
+	.p2align 4
+	.globl	_Z20test_std_reader_pipev
+	.type	_Z20test_std_reader_pipev, @function
+_Z20test_std_reader_pipev:
+.LFB6943:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6943
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$232, %rsp
+	.cfi_def_cfa_offset 272
+	leaq	8(%rsp), %rdi
+	call	pipe@PLT
+	xorl	%esi, %esi
+	movq	%rsp, %rdi
+	leaq	12(%rsp), %rcx
+	leaq	_Z4feedPv(%rip), %rdx
+	call	pthread_create@PLT
+	movl	8(%rsp), %ebx
+	movdqa	.LC16(%rip), %xmm0
+	leaq	80(%rsp), %rsi
+	movw	$0, 20(%rsp)
+	movl	%ebx, %edi
+	movl	%ebx, 16(%rsp)
+	movq	$0, 24(%rsp)
+	movq	$0, 48(%rsp)
+	movq	$0, 56(%rsp)
+	movq	$0, 64(%rsp)
+	movq	$0, 72(%rsp)
+	movaps	%xmm0, 32(%rsp)
+	call	fstat@PLT
+	testl	%eax, %eax
+	jne	.L401
+	movl	104(%rsp), %eax
+	andl	$61440, %eax
+	cmpl	$32768, %eax
+	je	.L434
+.L402:
+	cmpl	$4096, %eax
+	je	.L435
+.L401:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L436
+.L409:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	32(%rsp), %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+.LEHB11:
+	call	*16(%rax)
+.LEHE11:
+	cmpb	$0, 20(%rsp)
+	movq	%rax, 24(%rsp)
+	je	.L406
+	cmpq	$0, 56(%rsp)
+	jne	.L429
+	leaq	16(%rsp), %rbx
+	xorl	%esi, %esi
+	movq	%rbx, %rdi
+.LEHB12:
+	call	_Z10same_bytesRN1n10std_readerEm
+.LEHE12:
+	testb	%al, %al
+	je	.L430
+	movq	56(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L414
+	movl	16(%rsp), %edi
+	movq	40(%rsp), %rsi
+	xorl	%edx, %edx
+	addq	72(%rsp), %rsi
+	call	lseek@PLT
+	movq	64(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	munmap@PLT
+.L415:
+	movq	(%rsp), %rdi
+	xorl	%esi, %esi
+.LEHB13:
+	call	pthread_join@PLT
+	movl	8(%rsp), %edi
+	call	close@PLT
+.LEHE13:
+	addq	$232, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L414:
+	.cfi_restore_state
+	cmpq	$0, 24(%rsp)
+	je	.L415
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L437
+.L417:
+	movq	32(%rsp), %rdx
+	movq	24(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L415
+	.p2align 4,,10
+	.p2align 3
+.L436:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L409
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L409
+	.p2align 4,,10
+	.p2align 3
+.L435:
+	movl	$1048576, %edx
+	movl	$1031, %esi
+	movl	%ebx, %edi
+	xorl	%eax, %eax
+	movb	$1, 20(%rsp)
+.LEHB14:
+	call	fcntl@PLT
+.LEHE14:
+	jmp	.L401
+	.p2align 4,,10
+	.p2align 3
+.L437:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L417
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L417
+	.p2align 4,,10
+	.p2align 3
+.L434:
+	movl	$1, %edx
+	xorl	%esi, %esi
+	movl	%ebx, %edi
+	call	lseek@PLT
+	movq	%rax, %rbp
+	testq	%rax, %rax
+	js	.L433
+	cmpq	128(%rsp), %rax
+	jl	.L438
+.L433:
+	movl	104(%rsp), %eax
+	andl	$61440, %eax
+	jmp	.L402
+	.p2align 4,,10
+	.p2align 3
+.L438:
+	movl	$30, %edi
+	call	sysconf@PLT
+	movl	%ebx, %r8d
+	xorl	%edi, %edi
+	movq	%rax, %rcx
+	movq	%rbp, %rax
+	movq	128(%rsp), %rbp
+	cqto
+	idivq	%rcx
+	imulq	%rcx, %rax
+	movq	%rdx, %r12
+	movl	$2, %ecx
+	movl	$1, %edx
+	subq	%rax, %rbp
+	movq	%rax, %r9
+	movq	%rax, 72(%rsp)
+	movq	%rbp, %rsi
+	movq	%rbp, 64(%rsp)
+	call	mmap@PLT
+	movq	%rax, %r13
+	cmpq	$-1, %rax
+	jne	.L405
+	jmp	.L433
+.L427:
+	jmp	.L428
+	.section	.gcc_except_table
+.LLSDA6943:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6943-.LLSDACSB6943
+.LLSDACSB6943:
+	.uleb128 .LEHB11-.LFB6943
+	.uleb128 .LEHE11-.LEHB11
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB12-.LFB6943
+	.uleb128 .LEHE12-.LEHB12
+	.uleb128 .L427-.LFB6943
+	.uleb128 0
+	.uleb128 .LEHB13-.LFB6943
+	.uleb128 .LEHE13-.LEHB13
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB14-.LFB6943
+	.uleb128 .LEHE14-.LEHB14
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6943:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6943
+	.type	_Z20test_std_reader_pipev.cold, @function
+_Z20test_std_reader_pipev.cold:
+.LFSB6943:
+.L430:
+	.cfi_def_cfa_offset 272
+	.cfi_offset 3, -40
+	.cfi_offset 6, -32
+	.cfi_offset 12, -24
+	.cfi_offset 13, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC19(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB15:
+	call	__cxa_throw@PLT
+.L429:
+	movl	$8, %edi
+	leaq	16(%rsp), %rbx
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC18(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L405:
+	movl	$2, %edx
+	movq	%rbp, %rsi
+	movq	%rax, %rdi
+	call	madvise@PLT
+	movq	%r13, 56(%rsp)
+	movq	%r13, 24(%rsp)
+	movq	%r12, 40(%rsp)
+	movq	%rbp, 48(%rsp)
+	movb	$1, 21(%rsp)
+.L406:
+	movl	$8, %edi
+	leaq	16(%rsp), %rbx
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC17(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE15:
+.L420:
+.L428:
+	movq	%rax, %rbp
+	movq	%rbx, %rdi
+	call	_ZN1n10std_readerD1Ev
+	movq	%rbp, %rdi
+.LEHB16:
+	call	_Unwind_Resume@PLT
+.LEHE16:
+	.cfi_endproc
+.LFE6943:
+	.section	.gcc_except_table
+.LLSDAC6943:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6943-.LLSDACSBC6943
+.LLSDACSBC6943:
+	.uleb128 .LEHB15-.LCOLDB20
+	.uleb128 .LEHE15-.LEHB15
+	.uleb128 .L420-.LCOLDB20
+	.uleb128 0
+	.uleb128 .LEHB16-.LCOLDB20
+	.uleb128 .LEHE16-.LEHB16
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6943:
+	.section	.text.unlikely
+	.text
+	.size	_Z20test_std_reader_pipev, .-_Z20test_std_reader_pipev
+	.section	.text.unlikely
+	.size	_Z20test_std_reader_pipev.cold, .-_Z20test_std_reader_pipev.cold
+.LCOLDE20:
+	.text
+.LHOTE20:
+	.section	.rodata.str1.8
+	.align 8
+.LC21:
+	.string	"expected equal : expected value : r.peek().data()[0], actual value : 'a'"
+	.align 8
+.LC22:
+	.string	"expected equal : expected value : r.splice_to(out), actual value : total - 10"
+	.align 8
+.LC23:
+	.string	"expected true : same_bytes(r, 10)"
+	.section	.text.unlikely
+.LCOLDB24:
+	.text
+.LHOTB24:
+	.p2align 4
+	.globl	_Z22test_std_reader_splicev
+	.type	_Z22test_std_reader_splicev, @function
+_Z22test_std_reader_splicev:
+.LFB6950:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6950
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$264, %rsp
+	.cfi_def_cfa_offset 320
+	leaq	40(%rsp), %rdi
+	call	pipe@PLT
+	xorl	%esi, %esi
+	leaq	44(%rsp), %rcx
+	leaq	32(%rsp), %rdi
+	leaq	_Z4feedPv(%rip), %rdx
+	call	pthread_create@PLT
+	movq	copy(%rip), %rdi
+	movl	$577, %esi
+	xorl	%eax, %eax
+	movl	$438, %edx
+.LEHB17:
+	call	open@PLT
+	movl	40(%rsp), %r12d
+	movdqa	.LC16(%rip), %xmm1
+	movw	$0, 52(%rsp)
+	movl	%eax, 12(%rsp)
+	leaq	112(%rsp), %rax
+	movq	%rax, %rsi
+	movl	%r12d, %edi
+	movl	%r12d, 48(%rsp)
+	movq	$0, 56(%rsp)
+	movq	$0, 80(%rsp)
+	movq	$0, 88(%rsp)
+	movq	$0, 96(%rsp)
+	movq	$0, 104(%rsp)
+	movq	%rax, 24(%rsp)
+	movaps	%xmm1, 64(%rsp)
+	call	fstat@PLT
+	testl	%eax, %eax
+	jne	.L441
+	movl	136(%rsp), %eax
+	andl	$61440, %eax
+	cmpl	$32768, %eax
+	je	.L564
+.L442:
+	cmpl	$4096, %eax
+	je	.L565
+.L441:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L566
+.L450:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	64(%rsp), %r12
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%r12, %rsi
+	call	*16(%rax)
+.LEHE17:
+	movq	80(%rsp), %rbx
+	movq	72(%rsp), %rdx
+	movq	%rax, 56(%rsp)
+	movq	%rax, %r13
+	movq	%rbx, %rbp
+	subq	%rdx, %rbp
+	cmpq	%rdx, %rbx
+	jne	.L447
+	cmpb	$0, 53(%rsp)
+	jne	.L446
+	testq	%rbx, %rbx
+	jne	.L567
+.L452:
+	cmpq	$0, %r12
+	movl	$1, %eax
+	cmovbe	%r12, %rax
+	cmpq	%rax, %rbx
+	jnb	.L522
+	movl	48(%rsp), %r14d
+	jmp	.L455
+	.p2align 4,,10
+	.p2align 3
+.L568:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L454
+.L455:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%r14d, %edi
+.LEHB18:
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L568
+	je	.L454
+	movq	72(%rsp), %rdx
+	movq	%rax, 80(%rsp)
+	movq	%rax, %rbp
+	movq	%rax, %rbx
+	subq	%rdx, %rbp
+.L447:
+	cmpb	$97, 0(%r13,%rdx)
+	jne	.L518
+	movl	$10, %eax
+	cmpq	%rax, %rbp
+	cmovbe	%rbp, %rax
+	addq	%rdx, %rax
+	movq	%rax, 72(%rsp)
+	cmpq	%rbx, %rax
+	je	.L458
+	movq	%rbx, %rbp
+	leaq	0(%r13,%rax), %r14
+	subq	%rax, %rbp
+	movq	%rbp, 16(%rsp)
+.L463:
+	movl	12(%rsp), %edi
+	movq	%rbp, %rdx
+	movq	%r14, %rsi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L569
+	addq	%rax, %r14
+	subq	%rax, %rbp
+	jne	.L463
+	cmpb	$0, 52(%rsp)
+	movq	%rbx, 72(%rsp)
+	movq	%rbx, %rbp
+	jne	.L517
+.L520:
+	cmpb	$0, 53(%rsp)
+	jne	.L478
+	testq	%rbx, %rbx
+	jne	.L570
+.L472:
+	testq	%r12, %r12
+	je	.L478
+	movl	48(%rsp), %ebp
+	jmp	.L475
+	.p2align 4,,10
+	.p2align 3
+.L571:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L474
+.L475:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L571
+	je	.L474
+	movq	%rax, 80(%rsp)
+	movq	72(%rsp), %rbp
+	movq	%rax, %rbx
+.L469:
+	movq	%rbx, %r15
+	leaq	0(%r13,%rbp), %r14
+	subq	%rbp, %r15
+	je	.L478
+	.p2align 4,,10
+	.p2align 3
+.L477:
+	movq	%r15, (%rsp)
+.L484:
+	movq	(%rsp), %rdx
+	movl	12(%rsp), %edi
+	movq	%r14, %rsi
+	call	write@PLT
+.LEHE18:
+	testq	%rax, %rax
+	js	.L572
+	addq	%rax, %r14
+	subq	%rax, (%rsp)
+	jne	.L484
+	movq	%rbx, %rax
+	addq	%r15, 16(%rsp)
+	subq	%rbp, %rax
+	cmpq	%r15, %rax
+	cmova	%r15, %rax
+	addq	%rax, %rbp
+	movq	%rbp, 72(%rsp)
+	cmpq	%rbx, %rbp
+	jne	.L562
+	cmpb	$0, 53(%rsp)
+	je	.L573
+.L478:
+	cmpq	$2999990, 16(%rsp)
+	jne	.L461
+	movq	88(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L491
+	movl	48(%rsp), %edi
+	movq	72(%rsp), %rsi
+	xorl	%edx, %edx
+	addq	104(%rsp), %rsi
+	call	lseek@PLT
+	movq	96(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	munmap@PLT
+.L492:
+	movq	32(%rsp), %rdi
+	xorl	%esi, %esi
+.LEHB19:
+	call	pthread_join@PLT
+	movl	40(%rsp), %edi
+	call	close@PLT
+	movl	12(%rsp), %edi
+	call	close@PLT
+	movq	copy(%rip), %rdi
+	xorl	%esi, %esi
+	xorl	%eax, %eax
+	call	open@PLT
+	movdqa	.LC16(%rip), %xmm2
+	movq	24(%rsp), %rsi
+	movw	$0, 52(%rsp)
+	movl	%eax, %edi
+	movl	%eax, 48(%rsp)
+	movl	%eax, %ebx
+	movq	$0, 56(%rsp)
+	movq	$0, 80(%rsp)
+	movq	$0, 88(%rsp)
+	movq	$0, 96(%rsp)
+	movq	$0, 104(%rsp)
+	movaps	%xmm2, 64(%rsp)
+	call	fstat@PLT
+	testl	%eax, %eax
+	jne	.L497
+	movl	136(%rsp), %eax
+	andl	$61440, %eax
+	cmpl	$32768, %eax
+	je	.L574
+.L498:
+	cmpl	$4096, %eax
+	je	.L575
+.L497:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L576
+.L505:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	64(%rsp), %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	call	*16(%rax)
+.LEHE19:
+	movq	%rax, 56(%rsp)
+.L502:
+	leaq	48(%rsp), %rbp
+	movl	$10, %esi
+	movq	%rbp, %rdi
+.LEHB20:
+	call	_Z10same_bytesRN1n10std_readerEm
+	testb	%al, %al
+	je	.L558
+	movl	%ebx, %edi
+	call	close@PLT
+.LEHE20:
+	movq	copy(%rip), %rdi
+	call	remove@PLT
+	movq	88(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L508
+	movl	48(%rsp), %edi
+	movq	72(%rsp), %rsi
+	xorl	%edx, %edx
+	addq	104(%rsp), %rsi
+	call	lseek@PLT
+	movq	96(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	munmap@PLT
+.L439:
+	addq	$264, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L458:
+	.cfi_restore_state
+	cmpb	$0, 52(%rsp)
+	je	.L577
+	movq	$0, 16(%rsp)
+	movq	%rbx, %rbp
+.L517:
+	cmpb	$0, 53(%rsp)
+	jne	.L464
+	.p2align 4,,10
+	.p2align 3
+.L470:
+	movl	12(%rsp), %edx
+	movl	48(%rsp), %edi
+	movl	$1, %r9d
+	xorl	%ecx, %ecx
+	movq	%r12, %r8
+	xorl	%esi, %esi
+.LEHB21:
+	call	splice@PLT
+	testq	%rax, %rax
+	jle	.L465
+	addq	%rax, 16(%rsp)
+	jmp	.L470
+	.p2align 4,,10
+	.p2align 3
+.L573:
+	testq	%rbp, %rbp
+	jne	.L578
+.L486:
+	testq	%r12, %r12
+	je	.L478
+	movl	48(%rsp), %ebp
+	jmp	.L489
+	.p2align 4,,10
+	.p2align 3
+.L579:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L488
+.L489:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	read@PLT
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	js	.L579
+	je	.L488
+	movq	%rax, 80(%rsp)
+	movq	72(%rsp), %rbp
+.L562:
+	movq	%rbx, %r15
+	subq	%rbp, %r15
+.L480:
+	leaq	0(%r13,%rbp), %r14
+	testq	%r15, %r15
+	jne	.L477
+	jmp	.L478
+	.p2align 4,,10
+	.p2align 3
+.L572:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L478
+	jmp	.L484
+	.p2align 4,,10
+	.p2align 3
+.L465:
+	jne	.L467
+	movb	$1, 53(%rsp)
+	cmpq	%rbp, %rbx
+	jne	.L469
+	jmp	.L478
+	.p2align 4,,10
+	.p2align 3
+.L467:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L470
+.L464:
+	cmpq	%rbp, %rbx
+	jne	.L469
+	jmp	.L520
+	.p2align 4,,10
+	.p2align 3
+.L488:
+	movq	72(%rsp), %rbp
+	movb	$1, 53(%rsp)
+	xorl	%ebx, %ebx
+	movq	%rbp, %r15
+	negq	%r15
+	jmp	.L480
+.L569:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L463
+.L461:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC22(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE21:
+	.p2align 4,,10
+	.p2align 3
+.L578:
+	pxor	%xmm0, %xmm0
+	movups	%xmm0, 72(%rsp)
+	jmp	.L486
+.L491:
+	testq	%r13, %r13
+	je	.L492
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L580
+.L494:
+	movq	64(%rsp), %rdx
+	movq	56(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L492
+.L508:
+	cmpq	$0, 56(%rsp)
+	je	.L439
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L581
+.L511:
+	movq	64(%rsp), %rdx
+	movq	56(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L439
+.L576:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L505
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L505
+.L566:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L450
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L450
+.L583:
+	movl	$30, %edi
+	call	sysconf@PLT
+	movl	%r12d, %r8d
+	xorl	%edi, %edi
+	movq	%rax, %rcx
+	movq	%rbx, %rax
+	movq	160(%rsp), %rbx
+	cqto
+	idivq	%rcx
+	imulq	%rcx, %rax
+	movq	%rdx, %rbp
+	movl	$2, %ecx
+	movl	$1, %edx
+	subq	%rax, %rbx
+	movq	%rax, %r9
+	movq	%rax, 104(%rsp)
+	movq	%rbx, %rsi
+	movq	%rbx, 96(%rsp)
+	call	mmap@PLT
+	movq	%rax, %r13
+	cmpq	$-1, %rax
+	je	.L561
+	movl	$2, %edx
+	movq	%rbx, %rsi
+	movq	%rax, %rdi
+	movl	$1048576, %r12d
+	call	madvise@PLT
+	movq	%rbp, %rdx
+	movq	%rbp, 72(%rsp)
+	movq	%rbx, %rbp
+	movq	%r13, 88(%rsp)
+	subq	%rdx, %rbp
+	movq	%r13, 56(%rsp)
+	movq	%rbx, 80(%rsp)
+	movb	$1, 53(%rsp)
+	cmpq	%rdx, %rbx
+	jne	.L447
+.L446:
+	cmpb	$97, 0(%r13,%rdx)
+	jne	.L582
+	movq	$0, 16(%rsp)
+	movl	$10, %eax
+	cmpq	%rax, %rbp
+	cmovbe	%rbp, %rax
+	cmpb	$0, 52(%rsp)
+	leaq	(%rax,%rdx), %rbp
+	movq	%rbp, 72(%rsp)
+	jne	.L517
+	jmp	.L464
+.L565:
+	movl	$1048576, %edx
+	movl	$1031, %esi
+	movl	%r12d, %edi
+	xorl	%eax, %eax
+	movb	$1, 52(%rsp)
+.LEHB22:
+	call	fcntl@PLT
+	jmp	.L441
+.L581:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L511
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L511
+.L580:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L494
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L494
+.L567:
+	pxor	%xmm0, %xmm0
+	xorl	%ebp, %ebp
+	xorl	%ebx, %ebx
+	movups	%xmm0, 72(%rsp)
+	jmp	.L452
+.L570:
+	pxor	%xmm0, %xmm0
+	movups	%xmm0, 72(%rsp)
+	jmp	.L472
+.L564:
+	movl	$1, %edx
+	xorl	%esi, %esi
+	movl	%r12d, %edi
+	call	lseek@PLT
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	js	.L561
+	cmpq	160(%rsp), %rax
+	jl	.L583
+.L561:
+	movl	136(%rsp), %eax
+	andl	$61440, %eax
+	jmp	.L442
+.L575:
+	movl	$1048576, %edx
+	movl	$1031, %esi
+	movl	%ebx, %edi
+	xorl	%eax, %eax
+	movb	$1, 52(%rsp)
+	call	fcntl@PLT
+.LEHE22:
+	jmp	.L497
+.L574:
+	movl	$1, %edx
+	xorl	%esi, %esi
+	movl	%ebx, %edi
+	call	lseek@PLT
+	movq	%rax, %rbp
+	testq	%rax, %rax
+	js	.L563
+	cmpq	160(%rsp), %rax
+	jl	.L584
+.L563:
+	movl	136(%rsp), %eax
+	andl	$61440, %eax
+	jmp	.L498
+.L454:
+	movb	$1, 53(%rsp)
+	xorl	%ebx, %ebx
+	xorl	%edx, %edx
+	jmp	.L447
+.L474:
+	movb	$1, 53(%rsp)
+	movq	72(%rsp), %rbp
+	xorl	%ebx, %ebx
+	jmp	.L469
+.L584:
+	movl	$30, %edi
+	call	sysconf@PLT
+	movl	%ebx, %r8d
+	xorl	%edi, %edi
+	movq	%rax, %rcx
+	movq	%rbp, %rax
+	movq	160(%rsp), %rbp
+	cqto
+	idivq	%rcx
+	imulq	%rcx, %rax
+	movq	%rdx, %r13
+	movl	$2, %ecx
+	movl	$1, %edx
+	subq	%rax, %rbp
+	movq	%rax, %r9
+	movq	%rax, 104(%rsp)
+	movq	%rbp, %rsi
+	movq	%rbp, 96(%rsp)
+	call	mmap@PLT
+	movq	%rax, %r12
+	cmpq	$-1, %rax
+	je	.L563
+	movl	$2, %edx
+	movq	%rbp, %rsi
+	movq	%rax, %rdi
+	call	madvise@PLT
+	movq	%r12, 88(%rsp)
+	movq	%r12, 56(%rsp)
+	movq	%r13, 72(%rsp)
+	movq	%rbp, 80(%rsp)
+	movb	$1, 53(%rsp)
+	jmp	.L502
+.L522:
+	xorl	%edx, %edx
+	jmp	.L447
+.L577:
+	xorl	%eax, %eax
+	movq	%rax, 16(%rsp)
+	jmp	.L520
+.L556:
+	jmp	.L557
+.L554:
+	jmp	.L555
+.L582:
+	jmp	.L518
+	.section	.gcc_except_table
+.LLSDA6950:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6950-.LLSDACSB6950
+.LLSDACSB6950:
+	.uleb128 .LEHB17-.LFB6950
+	.uleb128 .LEHE17-.LEHB17
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB18-.LFB6950
+	.uleb128 .LEHE18-.LEHB18
+	.uleb128 .L554-.LFB6950
+	.uleb128 0
+	.uleb128 .LEHB19-.LFB6950
+	.uleb128 .LEHE19-.LEHB19
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB20-.LFB6950
+	.uleb128 .LEHE20-.LEHB20
+	.uleb128 .L556-.LFB6950
+	.uleb128 0
+	.uleb128 .LEHB21-.LFB6950
+	.uleb128 .LEHE21-.LEHB21
+	.uleb128 .L554-.LFB6950
+	.uleb128 0
+	.uleb128 .LEHB22-.LFB6950
+	.uleb128 .LEHE22-.LEHB22
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6950:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6950
+	.type	_Z22test_std_reader_splicev.cold, @function
+_Z22test_std_reader_splicev.cold:
+.LFSB6950:
+.L558:
+	.cfi_def_cfa_offset 320
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC23(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB23:
+	call	__cxa_throw@PLT
+.LEHE23:
+.L518:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC21(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB24:
+	call	__cxa_throw@PLT
+.LEHE24:
+.L527:
+.L557:
+	movq	%rax, %rbx
+	movq	%rbp, %rdi
+	call	_ZN1n10std_readerD1Ev
+	movq	%rbx, %rdi
+.LEHB25:
+	call	_Unwind_Resume@PLT
+.L526:
+.L555:
+	movq	%rax, %rbx
+	leaq	48(%rsp), %rdi
+	call	_ZN1n10std_readerD1Ev
+	movq	%rbx, %rdi
+	call	_Unwind_Resume@PLT
+.LEHE25:
+	.cfi_endproc
+.LFE6950:
+	.section	.gcc_except_table
+.LLSDAC6950:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6950-.LLSDACSBC6950
+.LLSDACSBC6950:
+	.uleb128 .LEHB23-.LCOLDB24
+	.uleb128 .LEHE23-.LEHB23
+	.uleb128 .L527-.LCOLDB24
+	.uleb128 0
+	.uleb128 .LEHB24-.LCOLDB24
+	.uleb128 .LEHE24-.LEHB24
+	.uleb128 .L526-.LCOLDB24
+	.uleb128 0
+	.uleb128 .LEHB25-.LCOLDB24
+	.uleb128 .LEHE25-.LEHB25
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6950:
+	.section	.text.unlikely
+	.text
+	.size	_Z22test_std_reader_splicev, .-_Z22test_std_reader_splicev
+	.section	.text.unlikely
+	.size	_Z22test_std_reader_splicev.cold, .-_Z22test_std_reader_splicev.cold
+.LCOLDE24:
+	.text
+.LHOTE24:
+	.section	.rodata.str1.1
+.LC25:
+	.string	"n::std_reader tests"
+.LC26:
+	.string	"test_std_reader_pipe"
+.LC27:
+	.string	"test_std_reader_file"
+.LC28:
+	.string	"test_std_reader_lines"
+.LC29:
+	.string	"test_std_reader_splice"
+	.section	.text.unlikely
+.LCOLDB31:
+	.section	.text.startup,"ax",@progbits
+.LHOTB31:
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB6951:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6951
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$1600, %edi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 64
+.LEHB26:
+	call	_Znam@PLT
+.LEHE26:
+	movq	%rax, %rbx
+	leaq	1600(%rax), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L586:
+	movq	$0, (%rax)
+	addq	$16, %rax
+	movq	$0, -8(%rax)
+	cmpq	%rax, %rdx
+	jne	.L586
+	leaq	.LC25(%rip), %rax
+	movq	%rsp, %rdi
+	movq	%rbx, (%rsp)
+	movq	%rax, 16(%rsp)
+	leaq	.LC26(%rip), %rax
+	movq	%rax, (%rbx)
+	leaq	_Z20test_std_reader_pipev(%rip), %rax
+	movq	%rax, 8(%rbx)
+	leaq	.LC27(%rip), %rax
+	movq	%rax, 16(%rbx)
+	leaq	_Z20test_std_reader_filev(%rip), %rax
+	movq	%rax, 24(%rbx)
+	leaq	.LC28(%rip), %rax
+	movq	%rax, 32(%rbx)
+	leaq	_Z21test_std_reader_linesv(%rip), %rax
+	movq	%rax, 40(%rbx)
+	leaq	.LC29(%rip), %rax
+	movq	%rax, 48(%rbx)
+	leaq	_Z22test_std_reader_splicev(%rip), %rax
+	movq	%rax, 56(%rbx)
+	movq	.LC30(%rip), %rax
+	movq	%rax, 8(%rsp)
+.LEHB27:
+	call	_ZN1n4test10test_suite7run_allEv
+.LEHE27:
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L588:
+	.cfi_restore_state
+	movq	%rax, %rbp
+	jmp	.L587
+	.section	.gcc_except_table
+.LLSDA6951:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6951-.LLSDACSB6951
+.LLSDACSB6951:
+	.uleb128 .LEHB26-.LFB6951
+	.uleb128 .LEHE26-.LEHB26
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB27-.LFB6951
+	.uleb128 .LEHE27-.LEHB27
+	.uleb128 .L588-.LFB6951
+	.uleb128 0
+.LLSDACSE6951:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6951
+	.type	main.cold, @function
+main.cold:
+.LFSB6951:
+.L587:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	movq	%rbp, %rdi
+.LEHB28:
+	call	_Unwind_Resume@PLT
+.LEHE28:
+	.cfi_endproc
+.LFE6951:
+	.section	.gcc_except_table
+.LLSDAC6951:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6951-.LLSDACSBC6951
+.LLSDACSBC6951:
+	.uleb128 .LEHB28-.LCOLDB31
+	.uleb128 .LEHE28-.LEHB28
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6951:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	main, .-main
+	.section	.text.unlikely
+	.size	main.cold, .-main.cold
+.LCOLDE31:
+	.section	.text.startup
+.LHOTE31:
+	.section	.text._ZN1n14__avx512_countIcEEmPKT_mS1_,"axG",@progbits,_ZN1n14__avx512_countIcEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n14__avx512_countIcEEmPKT_mS1_
+	.type	_ZN1n14__avx512_countIcEEmPKT_mS1_, @function
+_ZN1n14__avx512_countIcEEmPKT_mS1_:
+.LFB7002:
+	.cfi_startproc
+	movl	%edx, %r10d
+	vpbroadcastb	%edx, %zmm5
+	movl	$64, %eax
+	xorl	%r8d, %r8d
+	cmpq	$63, %rsi
+	jbe	.L619
+	.p2align 4,,10
+	.p2align 3
+.L597:
+	vpcmpeqb	-64(%rdi,%rax), %zmm5, %k0
+	movq	%rax, %r9
+	addq	$64, %rax
+	kmovq	%k0, %rcx
+	popcntq	%rcx, %rcx
+	addq	%rcx, %r8
+	cmpq	%rax, %rsi
+	jnb	.L597
+	subq	%r9, %rsi
+	je	.L593
+	leaq	-1(%rsi), %rax
+	cmpq	$62, %rax
+	jbe	.L604
+	movq	%rsi, %rcx
+	addq	%r9, %rdi
+	movl	$1, %r9d
+	andq	$-64, %rcx
+	movq	%rdi, %rax
+	vpxor	%xmm7, %xmm7, %xmm7
+	addq	%rdi, %rcx
+	vpbroadcastb	%r9d, %zmm6
+	.p2align 4,,10
+	.p2align 3
+.L598:
+	vpcmpb	$0, (%rax), %zmm5, %k1
+	addq	$64, %rax
+	vmovdqu8	%zmm6, %zmm0{%k1}{z}
+	vpmovzxbw	%ymm0, %zmm1
+	vextracti64x4	$0x1, %zmm0, %ymm0
+	vpmovzxwd	%ymm1, %zmm4
+	vextracti64x4	$0x1, %zmm1, %ymm1
+	vpmovzxbw	%ymm0, %zmm0
+	vpmovzxdq	%ymm4, %zmm2
+	vextracti64x4	$0x1, %zmm4, %ymm4
+	vpmovzxwd	%ymm1, %zmm1
+	vpmovzxdq	%ymm4, %zmm4
+	vpmovzxwd	%ymm0, %zmm3
+	vextracti64x4	$0x1, %zmm0, %ymm0
+	vpaddq	%zmm4, %zmm2, %zmm2
+	vpmovzxdq	%ymm1, %zmm4
+	vextracti64x4	$0x1, %zmm1, %ymm1
+	vpmovzxdq	%ymm1, %zmm1
+	vpmovzxwd	%ymm0, %zmm0
+	vpaddq	%zmm1, %zmm4, %zmm4
+	vpmovzxdq	%ymm3, %zmm1
+	vextracti64x4	$0x1, %zmm3, %ymm3
+	vpmovzxdq	%ymm3, %zmm3
+	vpaddq	%zmm4, %zmm2, %zmm2
+	vpaddq	%zmm3, %zmm1, %zmm1
+	vpmovzxdq	%ymm0, %zmm3
+	vextracti64x4	$0x1, %zmm0, %ymm0
+	vpaddq	%zmm3, %zmm1, %zmm1
+	vpmovzxdq	%ymm0, %zmm0
+	vpaddq	%zmm1, %zmm2, %zmm2
+	vpaddq	%zmm7, %zmm0, %zmm0
+	vpaddq	%zmm0, %zmm2, %zmm7
+	cmpq	%rax, %rcx
+	jne	.L598
+	vmovdqa	%ymm7, %ymm3
+	vextracti64x4	$0x1, %zmm7, %ymm7
+	movq	%rsi, %rax
+	vpaddq	%ymm7, %ymm3, %ymm3
+	andq	$-64, %rax
+	vextracti128	$0x1, %ymm3, %xmm1
+	vpaddq	%xmm1, %xmm3, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rcx
+	testb	$63, %sil
+	je	.L599
+.L595:
+	movq	%rsi, %r9
+	subq	%rax, %r9
+	leaq	-1(%r9), %r11
+	cmpq	$30, %r11
+	jbe	.L602
+	vmovd	%edx, %xmm0
+	movl	$1, %edx
+	vpbroadcastb	%xmm0, %ymm0
+	vmovd	%edx, %xmm1
+	movq	%r9, %rdx
+	vpcmpeqb	(%rdi,%rax), %ymm0, %ymm0
+	vpbroadcastb	%xmm1, %ymm1
+	andq	$-32, %rdx
+	addq	%rdx, %rax
+	andl	$31, %r9d
+	vpand	%ymm1, %ymm0, %ymm0
+	vpmovzxbw	%xmm0, %ymm2
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxwd	%xmm2, %ymm4
+	vextracti128	$0x1, %ymm2, %xmm2
+	vpmovzxbw	%xmm0, %ymm0
+	vpmovzxwd	%xmm2, %ymm2
+	vpmovzxwd	%xmm0, %ymm5
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxdq	%xmm2, %ymm1
+	vextracti128	$0x1, %ymm2, %xmm2
+	vpmovzxwd	%xmm0, %ymm0
+	vpmovzxdq	%xmm2, %ymm2
+	vpaddq	%ymm2, %ymm1, %ymm1
+	vpmovzxdq	%xmm4, %ymm2
+	vextracti128	$0x1, %ymm4, %xmm4
+	vpmovzxdq	%xmm4, %ymm4
+	vpaddq	%ymm4, %ymm2, %ymm2
+	vpaddq	%ymm2, %ymm1, %ymm1
+	vpmovzxdq	%xmm5, %ymm2
+	vextracti128	$0x1, %ymm5, %xmm5
+	vpmovzxdq	%xmm5, %ymm5
+	vpaddq	%ymm5, %ymm2, %ymm2
+	vpaddq	%ymm3, %ymm2, %ymm2
+	vpaddq	%ymm2, %ymm1, %ymm1
+	vpmovzxdq	%xmm0, %ymm2
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxdq	%xmm0, %ymm0
+	vpaddq	%ymm0, %ymm2, %ymm0
+	vpaddq	%ymm0, %ymm1, %ymm1
+	vmovdqa	%xmm1, %xmm0
+	vextracti128	$0x1, %ymm1, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rcx
+	je	.L599
+	.p2align 4,,10
+	.p2align 3
+.L602:
+	xorl	%edx, %edx
+	cmpb	%r10b, (%rdi,%rax)
+	sete	%dl
+	addq	$1, %rax
+	addq	%rdx, %rcx
+	cmpq	%rsi, %rax
+	jb	.L602
+.L599:
+	addq	%rcx, %r8
+.L593:
+	movq	%r8, %rax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L619:
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	testq	%rsi, %rsi
+	jne	.L595
+	jmp	.L593
+.L604:
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	addq	%r9, %rdi
+	jmp	.L595
+	.cfi_endproc
+.LFE7002:
+	.size	_ZN1n14__avx512_countIcEEmPKT_mS1_, .-_ZN1n14__avx512_countIcEEmPKT_mS1_
+	.section	.text._ZN1n12__avx2_countIcEEmPKT_mS1_,"axG",@progbits,_ZN1n12__avx2_countIcEEmPKT_mS1_,comdat
+	.p2align 4
+	.weak	_ZN1n12__avx2_countIcEEmPKT_mS1_
+	.type	_ZN1n12__avx2_countIcEEmPKT_mS1_, @function
+_ZN1n12__avx2_countIcEEmPKT_mS1_:
+.LFB7003:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	vmovd	%edx, %xmm2
+	movq	%rdi, %r10
+	movl	%edx, %r11d
+	movq	%rsi, %rdi
+	vpbroadcastb	%xmm2, %ymm2
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	.cfi_offset 14, -24
+	.cfi_offset 13, -32
+	.cfi_offset 12, -40
+	.cfi_offset 3, -48
+	cmpq	$31, %rsi
+	jbe	.L621
+	xorl	%edx, %edx
+	xorl	%r9d, %r9d
+	movl	$32, %r8d
+	xorl	%ebx, %ebx
+	vpxor	%xmm3, %xmm3, %xmm3
+	.p2align 4,,10
+	.p2align 3
+.L627:
+	movq	%rdi, %r12
+	movl	$255, %ecx
+	subq	%rdx, %r12
+	movq	%r12, %rsi
+	shrq	$5, %rsi
+	cmpq	%rcx, %rsi
+	cmovbe	%rsi, %rcx
+	testq	%rsi, %rsi
+	je	.L634
+	addq	%r10, %rdx
+	vpxor	%xmm1, %xmm1, %xmm1
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L623:
+	vpcmpeqb	(%rdx), %ymm2, %ymm0
+	addq	$1, %rax
+	addq	$32, %rdx
+	vpsubb	%ymm0, %ymm1, %ymm0
+	vmovdqa	%ymm0, %ymm1
+	cmpq	%rcx, %rax
+	jb	.L623
+	subq	$1, %rcx
+	movq	%rdi, %r12
+	salq	$5, %rcx
+	testq	%rsi, %rsi
+	cmove	%rbx, %rcx
+	leaq	(%rcx,%r8), %rdx
+	subq	%rdx, %r12
+	leaq	32(%rdx), %r8
+.L622:
+	vpsadbw	%ymm3, %ymm0, %ymm0
+	vmovq	%xmm0, %rcx
+	vpextrq	$1, %xmm0, %r14
+	vextracti128	$0x1, %ymm0, %xmm0
+	addq	%r14, %rcx
+	vmovq	%xmm0, %r13
+	vpextrq	$1, %xmm0, %rax
+	addq	%r9, %rcx
+	addq	%r13, %rcx
+	leaq	(%rax,%rcx), %r9
+	cmpq	%r8, %rdi
+	jb	.L648
+	testq	%rsi, %rsi
+	jne	.L627
+.L628:
+	jmp	.L628
+	.p2align 4,,10
+	.p2align 3
+.L648:
+	testq	%r12, %r12
+	je	.L620
+	leaq	-1(%r12), %rax
+	cmpq	$30, %rax
+	jbe	.L636
+	movq	%r12, %rsi
+	leaq	(%r10,%rdx), %rcx
+	vpxor	%xmm3, %xmm3, %xmm3
+	movl	$1, %edi
+	andq	$-32, %rsi
+	vmovd	%edi, %xmm4
+	movq	%rcx, %rax
+	addq	%rcx, %rsi
+	vpbroadcastb	%xmm4, %ymm4
+	.p2align 4,,10
+	.p2align 3
+.L630:
+	vpcmpeqb	(%rax), %ymm2, %ymm0
+	addq	$32, %rax
+	vpand	%ymm4, %ymm0, %ymm0
+	vpmovzxbw	%xmm0, %ymm1
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxwd	%xmm1, %ymm7
+	vextracti128	$0x1, %ymm1, %xmm1
+	vpmovzxbw	%xmm0, %ymm0
+	vpmovzxwd	%xmm1, %ymm1
+	vpmovzxwd	%xmm0, %ymm6
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxdq	%xmm1, %ymm5
+	vextracti128	$0x1, %ymm1, %xmm1
+	vpmovzxwd	%xmm0, %ymm0
+	vpmovzxdq	%xmm1, %ymm1
+	vpaddq	%ymm1, %ymm5, %ymm1
+	vpmovzxdq	%xmm7, %ymm5
+	vextracti128	$0x1, %ymm7, %xmm7
+	vpmovzxdq	%xmm7, %ymm7
+	vpaddq	%ymm7, %ymm5, %ymm5
+	vpaddq	%ymm5, %ymm1, %ymm1
+	vpmovzxdq	%xmm6, %ymm5
+	vextracti128	$0x1, %ymm6, %xmm6
+	vpmovzxdq	%xmm6, %ymm6
+	vpaddq	%ymm6, %ymm5, %ymm5
+	vpmovzxdq	%xmm0, %ymm6
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpaddq	%ymm6, %ymm5, %ymm5
+	vpmovzxdq	%xmm0, %ymm0
+	vpaddq	%ymm5, %ymm1, %ymm1
+	vpaddq	%ymm3, %ymm0, %ymm0
+	vpaddq	%ymm0, %ymm1, %ymm3
+	cmpq	%rax, %rsi
+	jne	.L630
+	vmovdqa	%xmm3, %xmm0
+	vextracti128	$0x1, %ymm3, %xmm3
+	movq	%r12, %r8
+	vpaddq	%xmm3, %xmm0, %xmm3
+	andq	$-32, %r8
+	vpsrldq	$8, %xmm3, %xmm0
+	vpaddq	%xmm0, %xmm3, %xmm0
+	vmovq	%xmm0, %rax
+	testb	$31, %r12b
+	je	.L631
+.L629:
+	movq	%r12, %rsi
+	subq	%r8, %rsi
+	leaq	-1(%rsi), %rdi
+	cmpq	$14, %rdi
+	jbe	.L632
+	vmovd	%r11d, %xmm0
+	movl	$1, %eax
+	movq	%rsi, %rdi
+	vpbroadcastb	%xmm0, %xmm0
+	vmovd	%eax, %xmm1
+	andq	$-16, %rdi
+	vpcmpeqb	(%rcx,%r8), %xmm0, %xmm0
+	vpbroadcastb	%xmm1, %xmm1
+	addq	%rdi, %r8
+	andl	$15, %esi
+	vpand	%xmm1, %xmm0, %xmm0
+	vpmovzxbw	%xmm0, %xmm2
+	vpsrldq	$8, %xmm0, %xmm0
+	vpmovzxwd	%xmm2, %xmm5
+	vpsrldq	$8, %xmm2, %xmm2
+	vpmovzxbw	%xmm0, %xmm0
+	vpmovzxdq	%xmm5, %xmm1
+	vpsrldq	$8, %xmm5, %xmm5
+	vpmovzxwd	%xmm2, %xmm2
+	vpmovzxdq	%xmm5, %xmm5
+	vpmovzxwd	%xmm0, %xmm4
+	vpaddq	%xmm5, %xmm1, %xmm1
+	vpsrldq	$8, %xmm0, %xmm0
+	vpmovzxdq	%xmm2, %xmm5
+	vpsrldq	$8, %xmm2, %xmm2
+	vpmovzxwd	%xmm0, %xmm0
+	vpmovzxdq	%xmm2, %xmm2
+	vpaddq	%xmm2, %xmm5, %xmm2
+	vpaddq	%xmm2, %xmm1, %xmm1
+	vpmovzxdq	%xmm4, %xmm2
+	vpsrldq	$8, %xmm4, %xmm4
+	vpmovzxdq	%xmm4, %xmm4
+	vpaddq	%xmm4, %xmm2, %xmm2
+	vpaddq	%xmm3, %xmm2, %xmm2
+	vpaddq	%xmm2, %xmm1, %xmm1
+	vpmovzxdq	%xmm0, %xmm2
+	vpsrldq	$8, %xmm0, %xmm0
+	vpmovzxdq	%xmm0, %xmm0
+	vpaddq	%xmm0, %xmm2, %xmm0
+	vpaddq	%xmm0, %xmm1, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vmovq	%xmm0, %rax
+	je	.L631
+.L632:
+	xorl	%esi, %esi
+	cmpb	%r11b, (%rcx,%r8)
+	sete	%sil
+	addq	%rsi, %rax
+	leaq	1(%r8), %rsi
+	cmpq	%r12, %rsi
+	jnb	.L631
+	addq	%rsi, %r10
+	cmpb	%r11b, (%r10,%rdx)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+	leaq	2(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L631
+	xorl	%edx, %edx
+	cmpb	%r11b, 2(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	3(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L631
+	xorl	%edx, %edx
+	cmpb	%r11b, 3(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	4(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L631
+	xorl	%edx, %edx
+	cmpb	%r11b, 4(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	5(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L631
+	xorl	%edx, %edx
+	cmpb	%r11b, 5(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	6(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L631
+	xorl	%edx, %edx
+	cmpb	%r11b, 6(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	7(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L631
+	xorl	%edx, %edx
+	cmpb	%r11b, 7(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	8(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L631
+	xorl	%edx, %edx
+	cmpb	%r11b, 8(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	9(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L631
+	xorl	%edx, %edx
+	cmpb	%r11b, 9(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	10(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L631
+	xorl	%edx, %edx
+	cmpb	%r11b, 10(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	11(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L631
+	xorl	%edx, %edx
+	cmpb	%r11b, 11(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	12(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L631
+	xorl	%edx, %edx
+	cmpb	%r11b, 12(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	13(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L631
+	xorl	%edx, %edx
+	cmpb	%r11b, 13(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	leaq	14(%r8), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L631
+	xorl	%edx, %edx
+	cmpb	%r11b, 14(%rcx,%r8)
+	sete	%dl
+	addq	%rdx, %rax
+	.p2align 4,,10
+	.p2align 3
+.L631:
+	addq	%rax, %r9
+.L620:
+	vzeroupper
+	movq	%r9, %rax
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L634:
+	.cfi_restore_state
+	vpxor	%xmm0, %xmm0, %xmm0
+	jmp	.L622
+.L621:
+	xorl	%r9d, %r9d
+	testq	%rsi, %rsi
+	je	.L620
+	movq	%rsi, %r12
+	xorl	%edx, %edx
+	xorl	%r9d, %r9d
+	xorl	%eax, %eax
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%r8d, %r8d
+	movq	%r10, %rcx
+	jmp	.L629
+.L636:
+	vpxor	%xmm3, %xmm3, %xmm3
+	xorl	%eax, %eax
+	leaq	(%r10,%rdx), %rcx
+	xorl	%r8d, %r8d
+	jmp	.L629
+	.cfi_endproc
+.LFE7003:
+	.size	_ZN1n12__avx2_countIcEEmPKT_mS1_, .-_ZN1n12__avx2_countIcEEmPKT_mS1_
+	.section	.rodata.str1.1
+.LC35:
+	.string	"expected true : r.mapped()"
+	.section	.rodata.str1.8
+	.align 8
+.LC36:
+	.string	"expected equal : expected value : r.peek().data()[0], actual value : byte_at(5000)"
+	.align 8
+.LC37:
+	.string	"expected equal : expected value : ::lseek(fd, 0, SEEK_CUR), actual value : 6000"
+	.align 8
+.LC38:
+	.string	"expected true : same_bytes(r, 6000)"
+	.align 8
+.LC40:
+	.string	"expected equal : expected value : n::count(r.iter(), '\\n'), actual value : total / 100"
+	.section	.text.unlikely
+.LCOLDB41:
+	.text
+.LHOTB41:
+	.p2align 4
+	.globl	_Z20test_std_reader_filev
+	.type	_Z20test_std_reader_filev, @function
+_Z20test_std_reader_filev:
+.LFB6944:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6944
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$438, %edx
+	movl	$577, %esi
+	xorl	%eax, %eax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$232, %rsp
+	.cfi_def_cfa_offset 288
+	movq	path(%rip), %rdi
+	leaq	80(%rsp), %r15
+.LEHB29:
+	call	open@PLT
+	movq	%r15, %rdi
+	movl	%eax, 80(%rsp)
+	call	_Z4feedPv
+	movq	path(%rip), %rdi
+	xorl	%esi, %esi
+	xorl	%eax, %eax
+	call	open@PLT
+	xorl	%edx, %edx
+	movl	$5000, %esi
+	movl	%eax, %edi
+	movl	%eax, %r13d
+	call	lseek@PLT
+	movq	%r15, %rsi
+	movl	%r13d, %edi
+	movl	%r13d, 16(%rsp)
+	movdqa	.LC16(%rip), %xmm6
+	movw	$0, 20(%rsp)
+	movq	$0, 24(%rsp)
+	movq	$0, 48(%rsp)
+	movq	$0, 56(%rsp)
+	movq	$0, 64(%rsp)
+	movq	$0, 72(%rsp)
+	movaps	%xmm6, 32(%rsp)
+	call	fstat@PLT
+	testl	%eax, %eax
+	jne	.L651
+	movl	104(%rsp), %eax
+	andl	$61440, %eax
+	cmpl	$32768, %eax
+	je	.L844
+.L652:
+	cmpl	$4096, %eax
+	je	.L845
+.L651:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L846
+.L659:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	32(%rsp), %rbp
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%rbp, %rsi
+	call	*16(%rax)
+	movq	%rax, 24(%rsp)
+	movq	%rax, %rbx
+	movq	56(%rsp), %rax
+	movq	%rax, 8(%rsp)
+.L656:
+	cmpq	$0, 8(%rsp)
+	je	.L834
+	movq	48(%rsp), %rdx
+	movq	40(%rsp), %rax
+	movq	%rdx, %r14
+	subq	%rax, %r14
+	cmpq	%rax, %rdx
+	jne	.L662
+	cmpb	$0, 21(%rsp)
+	je	.L847
+	.p2align 4,,10
+	.p2align 3
+.L662:
+	cmpb	$105, (%rbx,%rax)
+	jne	.L835
+	movl	$1000, %edx
+	movl	16(%rsp), %edi
+	cmpq	%rdx, %r14
+	movq	%rdx, %rsi
+	cmovbe	%r14, %rsi
+	xorl	%edx, %edx
+	addq	%rax, %rsi
+	addq	72(%rsp), %rsi
+	call	lseek@PLT
+	movq	64(%rsp), %rsi
+	movq	8(%rsp), %rdi
+	call	munmap@PLT
+	xorl	%esi, %esi
+	movl	$1, %edx
+	movl	%r13d, %edi
+	call	lseek@PLT
+	cmpq	$6000, %rax
+	jne	.L836
+	movdqa	.LC16(%rip), %xmm5
+	movq	%r15, %rsi
+	movl	%r13d, %edi
+	movl	%r13d, 16(%rsp)
+	movw	$0, 20(%rsp)
+	movq	$0, 24(%rsp)
+	movq	$0, 48(%rsp)
+	movq	$0, 56(%rsp)
+	movq	$0, 64(%rsp)
+	movq	$0, 72(%rsp)
+	movaps	%xmm5, 32(%rsp)
+	call	fstat@PLT
+	testl	%eax, %eax
+	jne	.L673
+	movl	104(%rsp), %eax
+	andl	$61440, %eax
+	cmpl	$32768, %eax
+	je	.L848
+.L674:
+	cmpl	$4096, %eax
+	je	.L849
+.L673:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L850
+.L681:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	32(%rsp), %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	call	*16(%rax)
+.LEHE29:
+	movq	%rax, 24(%rsp)
+.L678:
+	leaq	16(%rsp), %rdi
+	movl	$6000, %esi
+	movq	%rdi, 8(%rsp)
+.LEHB30:
+	call	_Z10same_bytesRN1n10std_readerEm
+.LEHE30:
+	testb	%al, %al
+	je	.L837
+	movq	56(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L684
+	movl	16(%rsp), %edi
+	movq	40(%rsp), %rsi
+	xorl	%edx, %edx
+	addq	72(%rsp), %rsi
+	call	lseek@PLT
+	movq	64(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	munmap@PLT
+.L685:
+	xorl	%esi, %esi
+	xorl	%edx, %edx
+	movl	%r13d, %edi
+	call	lseek@PLT
+	movq	%r15, %rsi
+	movl	%r13d, %edi
+	movl	%r13d, 16(%rsp)
+	movdqa	.LC16(%rip), %xmm6
+	movw	$0, 20(%rsp)
+	movq	$0, 24(%rsp)
+	movq	$0, 48(%rsp)
+	movq	$0, 56(%rsp)
+	movq	$0, 64(%rsp)
+	movq	$0, 72(%rsp)
+	movaps	%xmm6, 32(%rsp)
+	call	fstat@PLT
+	testl	%eax, %eax
+	jne	.L690
+	movl	104(%rsp), %eax
+	andl	$61440, %eax
+	cmpl	$32768, %eax
+	je	.L851
+.L691:
+	cmpl	$4096, %eax
+	je	.L852
+.L690:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L853
+.L699:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	32(%rsp), %rbx
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	movq	%rbx, %rsi
+.LEHB31:
+	call	*16(%rax)
+	movq	40(%rsp), %rdx
+	movq	%rax, 24(%rsp)
+	movq	%rax, %rbp
+	movq	48(%rsp), %rax
+	movq	%rax, %r12
+	subq	%rdx, %r12
+	cmpq	%rdx, %rax
+	je	.L854
+.L696:
+	movl	$4096, %eax
+	addq	%rdx, %rbp
+	cmpq	%rax, %r12
+	cmova	%rax, %r12
+	addq	%r12, %rdx
+	movq	%rdx, 40(%rsp)
+.L765:
+	xorl	%r15d, %r15d
+.L756:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L855
+.L711:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %r14d
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L856
+.L715:
+	cmpl	_ZZN1n9simd_bestEvE4best(%rip), %r14d
+	jge	.L857
+.L784:
+	cmpl	$2, %r14d
+	je	.L728
+.L861:
+	cmpl	$3, %r14d
+	je	.L729
+	cmpl	$1, %r14d
+	je	.L858
+	testq	%r12, %r12
+	je	.L735
+	leaq	-1(%r12), %rax
+	cmpq	$14, %rax
+	jbe	.L777
+	movq	%r12, %rdx
+	pxor	%xmm4, %xmm4
+	pxor	%xmm6, %xmm6
+	movq	%rbp, %rax
+	andq	$-16, %rdx
+	pxor	%xmm5, %xmm5
+	pxor	%xmm3, %xmm3
+	addq	%rbp, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L743:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqb	.LC39(%rip), %xmm0
+	pand	.LC34(%rip), %xmm0
+	movdqa	%xmm0, %xmm2
+	punpckhbw	%xmm6, %xmm0
+	punpcklbw	%xmm6, %xmm2
+	movdqa	%xmm0, %xmm7
+	punpckhwd	%xmm5, %xmm0
+	movdqa	%xmm2, %xmm1
+	punpckhwd	%xmm5, %xmm2
+	punpcklwd	%xmm5, %xmm7
+	punpcklwd	%xmm5, %xmm1
+	movdqa	%xmm1, %xmm8
+	punpckldq	%xmm3, %xmm1
+	punpckhdq	%xmm3, %xmm8
+	paddq	%xmm8, %xmm1
+	movdqa	%xmm2, %xmm8
+	punpckldq	%xmm3, %xmm2
+	punpckhdq	%xmm3, %xmm8
+	paddq	%xmm8, %xmm2
+	paddq	%xmm2, %xmm1
+	movdqa	%xmm7, %xmm2
+	punpckldq	%xmm3, %xmm7
+	punpckhdq	%xmm3, %xmm2
+	paddq	%xmm2, %xmm7
+	movdqa	%xmm0, %xmm2
+	punpckhdq	%xmm3, %xmm0
+	punpckldq	%xmm3, %xmm2
+	paddq	%xmm4, %xmm0
+	paddq	%xmm2, %xmm7
+	paddq	%xmm7, %xmm1
+	movdqa	%xmm1, %xmm4
+	paddq	%xmm0, %xmm4
+	cmpq	%rdx, %rax
+	jne	.L743
+	movdqa	%xmm4, %xmm0
+	movq	%r12, %rdx
+	psrldq	$8, %xmm0
+	andq	$-16, %rdx
+	paddq	%xmm0, %xmm4
+	movq	%xmm4, %rax
+	testb	$15, %r12b
+	je	.L744
+.L742:
+	xorl	%ecx, %ecx
+	cmpb	$10, 0(%rbp,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	1(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L744
+	xorl	%ecx, %ecx
+	cmpb	$10, 1(%rbp,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	2(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L744
+	xorl	%ecx, %ecx
+	cmpb	$10, 2(%rbp,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	3(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L744
+	xorl	%ecx, %ecx
+	cmpb	$10, 3(%rbp,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	4(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L744
+	xorl	%ecx, %ecx
+	cmpb	$10, 4(%rbp,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	5(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L744
+	xorl	%ecx, %ecx
+	cmpb	$10, 5(%rbp,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	6(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L744
+	xorl	%ecx, %ecx
+	cmpb	$10, 6(%rbp,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	7(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L744
+	xorl	%ecx, %ecx
+	cmpb	$10, 7(%rbp,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	8(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L744
+	xorl	%ecx, %ecx
+	cmpb	$10, 8(%rbp,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	9(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L744
+	xorl	%ecx, %ecx
+	cmpb	$10, 9(%rbp,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	10(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L744
+	xorl	%ecx, %ecx
+	cmpb	$10, 10(%rbp,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	11(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L744
+	xorl	%ecx, %ecx
+	cmpb	$10, 11(%rbp,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	12(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L744
+	xorl	%ecx, %ecx
+	cmpb	$10, 12(%rbp,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	13(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L744
+	xorl	%ecx, %ecx
+	cmpb	$10, 13(%rbp,%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	14(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L744
+	cmpb	$10, 14(%rbp,%rdx)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+	.p2align 4,,10
+	.p2align 3
+.L744:
+	addq	%rax, %r15
+.L735:
+	movq	48(%rsp), %rax
+	movq	40(%rsp), %rdx
+	movq	24(%rsp), %rbx
+	movq	%rax, %r14
+	subq	%rdx, %r14
+	cmpq	%rdx, %rax
+	jne	.L745
+	cmpb	$0, 21(%rsp)
+	je	.L859
+	movl	$4096, %eax
+	cmpq	%rax, %r14
+	cmovbe	%r14, %rax
+	addq	%rdx, %rax
+	movq	%rax, 40(%rsp)
+.L755:
+	cmpq	$30000, %r15
+	jne	.L709
+	movq	56(%rsp), %rbp
+	testq	%rbp, %rbp
+	je	.L757
+	movq	72(%rsp), %rsi
+	movl	16(%rsp), %edi
+	addq	%rdx, %rsi
+	xorl	%edx, %edx
+	call	lseek@PLT
+	movq	64(%rsp), %rsi
+	movq	%rbp, %rdi
+	call	munmap@PLT
+.L758:
+	movl	%r13d, %edi
+	call	close@PLT
+.LEHE31:
+	movq	path(%rip), %rdi
+	addq	$232, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	remove@PLT
+	.p2align 4,,10
+	.p2align 3
+.L745:
+	.cfi_restore_state
+	movl	$4096, %r12d
+	leaq	(%rbx,%rdx), %rbp
+	cmpq	%r12, %r14
+	cmovbe	%r14, %r12
+	addq	%r12, %rdx
+	movq	%rdx, 40(%rsp)
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	jne	.L711
+.L855:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L711
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L767
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L713:
+	movq	%rbx, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L711
+.L783:
+	.p2align 4,,10
+	.p2align 3
+.L857:
+	movzbl	_ZGVZN1n9simd_bestEvE4best(%rip), %eax
+	testb	%al, %al
+	je	.L860
+.L724:
+	movl	_ZZN1n9simd_bestEvE4best(%rip), %r14d
+	cmpl	$2, %r14d
+	jne	.L861
+.L728:
+	movl	$10, %edx
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	call	_ZN1n12__avx2_countIcEEmPKT_mS1_
+	addq	%rax, %r15
+	jmp	.L735
+.L782:
+	.p2align 4,,10
+	.p2align 3
+.L856:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L715
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L769
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L719:
+	movq	%rbx, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L715
+	.p2align 4,,10
+	.p2align 3
+.L858:
+	xorl	%esi, %esi
+	xorl	%r8d, %r8d
+	movl	$16, %ecx
+	xorl	%edi, %edi
+	pxor	%xmm3, %xmm3
+	cmpq	$15, %r12
+	jbe	.L862
+	.p2align 4,,10
+	.p2align 3
+.L731:
+	movq	%r12, %rdx
+	movl	$255, %eax
+	subq	%r8, %rdx
+	shrq	$4, %rdx
+	cmpq	%rax, %rdx
+	cmovbe	%rdx, %rax
+	testq	%rdx, %rdx
+	je	.L775
+	addq	%rbp, %r8
+	pxor	%xmm1, %xmm1
+	xorl	%r9d, %r9d
+	.p2align 4,,10
+	.p2align 3
+.L737:
+	movdqu	(%r8), %xmm2
+	movdqa	%xmm1, %xmm0
+	addq	$1, %r9
+	addq	$16, %r8
+	pcmpeqb	.LC39(%rip), %xmm2
+	psubb	%xmm2, %xmm0
+	movdqa	%xmm0, %xmm1
+	cmpq	%rax, %r9
+	jb	.L737
+	subq	$1, %rax
+	salq	$4, %rax
+	testq	%rdx, %rdx
+	cmove	%rdi, %rax
+	leaq	(%rax,%rcx), %r8
+	leaq	16(%r8), %rcx
+.L736:
+	psadbw	%xmm3, %xmm0
+	movhlps	%xmm0, %xmm6
+	movq	%xmm0, %r9
+	movq	%xmm6, %rax
+	addq	%r9, %rax
+	addq	%rax, %rsi
+	cmpq	%rcx, %r12
+	jb	.L738
+	testq	%rdx, %rdx
+	jne	.L731
+.L739:
+	jmp	.L739
+	.p2align 4,,10
+	.p2align 3
+.L729:
+	movl	$10, %edx
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	call	_ZN1n14__avx512_countIcEEmPKT_mS1_
+	addq	%rax, %r15
+	jmp	.L735
+	.p2align 4,,10
+	.p2align 3
+.L738:
+	subq	%r8, %r12
+	je	.L733
+	leaq	-1(%r12), %rax
+	cmpq	$14, %rax
+	jbe	.L776
+	leaq	0(%rbp,%r8), %rax
+	pxor	%xmm3, %xmm3
+	pxor	%xmm5, %xmm5
+	movq	%r12, %rdx
+	andq	$-16, %rdx
+	movdqa	.LC39(%rip), %xmm7
+	pxor	%xmm4, %xmm4
+	pxor	%xmm2, %xmm2
+	movdqa	.LC34(%rip), %xmm6
+	addq	%rax, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L740:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqb	%xmm7, %xmm0
+	pand	%xmm6, %xmm0
+	movdqa	%xmm0, %xmm1
+	punpckhbw	%xmm5, %xmm0
+	punpcklbw	%xmm5, %xmm1
+	movdqa	%xmm0, %xmm8
+	punpckhwd	%xmm4, %xmm0
+	movdqa	%xmm1, %xmm9
+	punpckhwd	%xmm4, %xmm1
+	punpcklwd	%xmm4, %xmm8
+	movdqa	%xmm1, %xmm10
+	punpcklwd	%xmm4, %xmm9
+	punpckldq	%xmm2, %xmm1
+	punpckhdq	%xmm2, %xmm10
+	paddq	%xmm10, %xmm1
+	movdqa	%xmm9, %xmm10
+	punpckldq	%xmm2, %xmm9
+	punpckhdq	%xmm2, %xmm10
+	paddq	%xmm10, %xmm9
+	paddq	%xmm9, %xmm1
+	movdqa	%xmm8, %xmm9
+	punpckldq	%xmm2, %xmm8
+	punpckhdq	%xmm2, %xmm9
+	paddq	%xmm9, %xmm8
+	movdqa	%xmm0, %xmm9
+	punpckhdq	%xmm2, %xmm0
+	punpckldq	%xmm2, %xmm9
+	paddq	%xmm3, %xmm0
+	paddq	%xmm9, %xmm8
+	paddq	%xmm8, %xmm1
+	movdqa	%xmm1, %xmm3
+	paddq	%xmm0, %xmm3
+	cmpq	%rax, %rdx
+	jne	.L740
+	movdqa	%xmm3, %xmm0
+	movq	%r12, %rdx
+	psrldq	$8, %xmm0
+	andq	$-16, %rdx
+	paddq	%xmm0, %xmm3
+	movq	%xmm3, %rax
+	testb	$15, %r12b
+	je	.L741
+.L732:
+	leaq	0(%rbp,%rdx), %rcx
+	cmpb	$10, (%rcx,%r8)
+	sete	%cl
+	movzbl	%cl, %ecx
+	addq	%rcx, %rax
+	leaq	1(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L741
+	addq	%rbp, %rcx
+	cmpb	$10, (%rcx,%r8)
+	sete	%cl
+	movzbl	%cl, %ecx
+	addq	%rcx, %rax
+	leaq	2(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L741
+	addq	%rbp, %r8
+	xorl	%ecx, %ecx
+	cmpb	$10, 2(%rdx,%r8)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	3(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L741
+	xorl	%ecx, %ecx
+	cmpb	$10, 3(%rdx,%r8)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	4(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L741
+	xorl	%ecx, %ecx
+	cmpb	$10, 4(%rdx,%r8)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	5(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L741
+	xorl	%ecx, %ecx
+	cmpb	$10, 5(%rdx,%r8)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	6(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L741
+	xorl	%ecx, %ecx
+	cmpb	$10, 6(%rdx,%r8)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	7(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L741
+	xorl	%ecx, %ecx
+	cmpb	$10, 7(%rdx,%r8)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	8(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L741
+	xorl	%ecx, %ecx
+	cmpb	$10, 8(%rdx,%r8)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	9(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L741
+	xorl	%ecx, %ecx
+	cmpb	$10, 9(%rdx,%r8)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	10(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L741
+	xorl	%ecx, %ecx
+	cmpb	$10, 10(%rdx,%r8)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	11(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L741
+	xorl	%ecx, %ecx
+	cmpb	$10, 11(%rdx,%r8)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	12(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L741
+	xorl	%ecx, %ecx
+	cmpb	$10, 12(%rdx,%r8)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	13(%rdx), %rcx
+	cmpq	%r12, %rcx
+	jnb	.L741
+	xorl	%ecx, %ecx
+	cmpb	$10, 13(%rdx,%r8)
+	sete	%cl
+	addq	$14, %rdx
+	addq	%rcx, %rax
+	cmpq	%r12, %rdx
+	jnb	.L741
+	cmpb	$10, (%r8,%rdx)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+	.p2align 4,,10
+	.p2align 3
+.L741:
+	addq	%rax, %rsi
+.L733:
+	addq	%rsi, %r15
+	jmp	.L735
+	.p2align 4,,10
+	.p2align 3
+.L775:
+	pxor	%xmm0, %xmm0
+	jmp	.L736
+.L859:
+	testq	%rax, %rax
+	jne	.L863
+	movq	32(%rsp), %r12
+	movl	$1, %ecx
+	cmpq	$0, %r12
+	cmovbe	%r12, %rcx
+	cmpq	%rcx, %rax
+	jnb	.L750
+.L748:
+	movl	16(%rsp), %ebp
+	jmp	.L753
+	.p2align 4,,10
+	.p2align 3
+.L864:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L752
+.L753:
+	movq	%r12, %rdx
+	movq	%rbx, %rsi
+	movl	%ebp, %edi
+.LEHB32:
+	call	read@PLT
+	testq	%rax, %rax
+	js	.L864
+	je	.L752
+	movq	40(%rsp), %rdx
+	movq	%rax, 48(%rsp)
+	movq	%rax, %r14
+	subq	%rdx, %r14
+.L750:
+	movl	$4096, %r12d
+	leaq	(%rbx,%rdx), %rbp
+	cmpq	%r12, %r14
+	cmovbe	%r14, %r12
+	leaq	(%r12,%rdx), %rcx
+	movq	%rcx, 40(%rsp)
+	cmpq	%rdx, %rax
+	jne	.L756
+	jmp	.L755
+	.p2align 4,,10
+	.p2align 3
+.L860:
+	leaq	_ZGVZN1n9simd_bestEvE4best(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L724
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	movl	%eax, %edx
+	andl	$2129920, %edx
+	cmpl	$2129920, %edx
+	je	.L771
+	testb	$4, %ah
+	setne	%al
+	movzbl	%al, %eax
+	addl	$1, %eax
+.L726:
+	movq	%rbx, %rdi
+	movl	%eax, _ZZN1n9simd_bestEvE4best(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L724
+	.p2align 4,,10
+	.p2align 3
+.L752:
+	movl	$4096, %r12d
+	movb	$1, 21(%rsp)
+	cmpq	%r12, %r14
+	cmovbe	%r14, %r12
+.L749:
+	movq	%r12, 40(%rsp)
+	xorl	%edx, %edx
+	jmp	.L755
+.L854:
+	cmpb	$0, 21(%rsp)
+	jne	.L695
+	testq	%rax, %rax
+	jne	.L865
+	cmpq	$0, %rbx
+	movl	$1, %ecx
+	cmovbe	%rbx, %rcx
+	cmpq	%rcx, %rax
+	jnb	.L704
+.L702:
+	movl	16(%rsp), %r14d
+	jmp	.L707
+	.p2align 4,,10
+	.p2align 3
+.L866:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L706
+.L707:
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movl	%r14d, %edi
+	call	read@PLT
+.LEHE32:
+	testq	%rax, %rax
+	js	.L866
+	je	.L706
+	movq	40(%rsp), %rdx
+	movq	%rax, 48(%rsp)
+	movq	%rax, %r12
+	subq	%rdx, %r12
+.L704:
+	movl	$4096, %ecx
+	addq	%rdx, %rbp
+	cmpq	%rcx, %r12
+	cmova	%rcx, %r12
+	leaq	(%r12,%rdx), %rcx
+	movq	%rcx, 40(%rsp)
+	cmpq	%rdx, %rax
+	jne	.L765
+	jmp	.L709
+	.p2align 4,,10
+	.p2align 3
+.L847:
+	testq	%rdx, %rdx
+	jne	.L867
+.L663:
+	cmpq	$0, %rbp
+	movl	$1, %eax
+	movl	16(%rsp), %r12d
+	cmovbe	%rbp, %rax
+	cmpq	%rax, %rdx
+	jb	.L667
+	jmp	.L841
+	.p2align 4,,10
+	.p2align 3
+.L868:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L666
+.L667:
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movl	%r12d, %edi
+.LEHB33:
+	call	read@PLT
+.LEHE33:
+	testq	%rax, %rax
+	js	.L868
+	je	.L666
+	movq	%rax, 48(%rsp)
+	movq	%rax, %r14
+.L841:
+	xorl	%eax, %eax
+	jmp	.L662
+.L684:
+	cmpq	$0, 24(%rsp)
+	je	.L685
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L869
+.L687:
+	movq	32(%rsp), %rdx
+	movq	24(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L685
+.L757:
+	testq	%rbx, %rbx
+	je	.L758
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L870
+.L760:
+	movq	32(%rsp), %rdx
+	movq	24(%rsp), %rsi
+	movl	$64, %ecx
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L758
+.L863:
+	movq	32(%rsp), %r12
+	pxor	%xmm0, %xmm0
+	movups	%xmm0, 40(%rsp)
+	testq	%r12, %r12
+	je	.L749
+	xorl	%r14d, %r14d
+	jmp	.L748
+.L846:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L659
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L659
+.L850:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L681
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L681
+.L853:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L699
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L699
+.L862:
+	xorl	%eax, %eax
+	xorl	%edx, %edx
+	testq	%r12, %r12
+	jne	.L732
+	jmp	.L733
+.L849:
+	movl	$1048576, %edx
+	movl	$1031, %esi
+	movl	%r13d, %edi
+	xorl	%eax, %eax
+	movb	$1, 20(%rsp)
+.LEHB34:
+	call	fcntl@PLT
+	jmp	.L673
+.L845:
+	movl	$1048576, %edx
+	movl	$1031, %esi
+	movl	%r13d, %edi
+	xorl	%eax, %eax
+	movb	$1, 20(%rsp)
+	call	fcntl@PLT
+	jmp	.L651
+.L852:
+	movl	$1048576, %edx
+	movl	$1031, %esi
+	movl	%r13d, %edi
+	xorl	%eax, %eax
+	movb	$1, 20(%rsp)
+	call	fcntl@PLT
+.LEHE34:
+	jmp	.L690
+.L873:
+	movl	$30, %edi
+	call	sysconf@PLT
+	movq	128(%rsp), %r14
+	movl	%r13d, %r8d
+	xorl	%edi, %edi
+	movq	%rax, %rcx
+	movq	%rbx, %rax
+	cqto
+	idivq	%rcx
+	imulq	%rcx, %rax
+	movq	%rdx, %rbx
+	movl	$2, %ecx
+	movl	$1, %edx
+	subq	%rax, %r14
+	movq	%rax, %r9
+	movq	%rax, 72(%rsp)
+	movq	%r14, %rsi
+	movq	%r14, 64(%rsp)
+	call	mmap@PLT
+	movq	%rax, %rbp
+	cmpq	$-1, %rax
+	je	.L843
+	movl	$2, %edx
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	movq	%r14, %r12
+	call	madvise@PLT
+	subq	%rbx, %r12
+	movq	%rbp, 56(%rsp)
+	movq	%rbx, %rdx
+	movq	%rbp, 24(%rsp)
+	movq	%r14, 48(%rsp)
+	movb	$1, 21(%rsp)
+	cmpq	%rbx, %r14
+	jne	.L696
+.L695:
+	movl	$4096, %eax
+	cmpq	%rax, %r12
+	cmovbe	%r12, %rax
+	addq	%rdx, %rax
+	movq	%rax, 40(%rsp)
+.L709:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC40(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB35:
+	call	__cxa_throw@PLT
+.LEHE35:
+	.p2align 4,,10
+	.p2align 3
+.L870:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L760
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L760
+.L869:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L687
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L687
+.L867:
+	pxor	%xmm0, %xmm0
+	xorl	%r14d, %r14d
+	xorl	%edx, %edx
+	movups	%xmm0, 40(%rsp)
+	jmp	.L663
+.L777:
+	xorl	%eax, %eax
+	xorl	%edx, %edx
+	jmp	.L742
+.L769:
+	movl	$3, %eax
+	jmp	.L719
+.L767:
+	movl	$3, %eax
+	jmp	.L713
+.L844:
+	movl	$1, %edx
+	xorl	%esi, %esi
+	movl	%r13d, %edi
+	call	lseek@PLT
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	js	.L840
+	cmpq	128(%rsp), %rax
+	jl	.L871
+.L840:
+	movl	104(%rsp), %eax
+	andl	$61440, %eax
+	jmp	.L652
+.L848:
+	movl	$1, %edx
+	xorl	%esi, %esi
+	movl	%r13d, %edi
+	call	lseek@PLT
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	js	.L842
+	cmpq	128(%rsp), %rax
+	jl	.L872
+.L842:
+	movl	104(%rsp), %eax
+	andl	$61440, %eax
+	jmp	.L674
+.L851:
+	movl	$1, %edx
+	xorl	%esi, %esi
+	movl	%r13d, %edi
+	call	lseek@PLT
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	js	.L843
+	cmpq	128(%rsp), %rax
+	jl	.L873
+.L843:
+	movl	104(%rsp), %eax
+	andl	$61440, %eax
+	jmp	.L691
+.L666:
+	movb	$1, 21(%rsp)
+	xorl	%eax, %eax
+	jmp	.L662
+.L771:
+	movl	$3, %eax
+	jmp	.L726
+.L706:
+	movl	$4096, %eax
+	movb	$1, 21(%rsp)
+	cmpq	%rax, %r12
+	cmovbe	%r12, %rax
+	movq	%rax, 40(%rsp)
+	jmp	.L709
+.L865:
+	pxor	%xmm0, %xmm0
+	movups	%xmm0, 40(%rsp)
+	testq	%rbx, %rbx
+	je	.L874
+	xorl	%r12d, %r12d
+	jmp	.L702
+.L776:
+	xorl	%eax, %eax
+	xorl	%edx, %edx
+	jmp	.L732
+.L872:
+	movl	$30, %edi
+	call	sysconf@PLT
+	movl	%r13d, %r8d
+	xorl	%edi, %edi
+	movq	%rax, %rcx
+	movq	%rbx, %rax
+	movq	128(%rsp), %rbx
+	cqto
+	idivq	%rcx
+	imulq	%rcx, %rax
+	movq	%rdx, %rbp
+	movl	$2, %ecx
+	movl	$1, %edx
+	subq	%rax, %rbx
+	movq	%rax, %r9
+	movq	%rax, 72(%rsp)
+	movq	%rbx, %rsi
+	movq	%rbx, 64(%rsp)
+	call	mmap@PLT
+	movq	%rax, %r12
+	cmpq	$-1, %rax
+	je	.L842
+	movl	$2, %edx
+	movq	%rbx, %rsi
+	movq	%rax, %rdi
+	call	madvise@PLT
+	movq	%r12, 56(%rsp)
+	movq	%r12, 24(%rsp)
+	movq	%rbp, 40(%rsp)
+	movq	%rbx, 48(%rsp)
+	movb	$1, 21(%rsp)
+	jmp	.L678
+.L871:
+	movl	$30, %edi
+	call	sysconf@PLT
+	movq	128(%rsp), %rbp
+	movl	%r13d, %r8d
+	xorl	%edi, %edi
+	movq	%rax, %rcx
+	movq	%rbx, %rax
+	cqto
+	idivq	%rcx
+	imulq	%rcx, %rax
+	movq	%rdx, %rbx
+	movl	$2, %ecx
+	movl	$1, %edx
+	subq	%rax, %rbp
+	movq	%rax, %r9
+	movq	%rax, 72(%rsp)
+	movq	%rbp, %rsi
+	movq	%rbp, 64(%rsp)
+	call	mmap@PLT
+	movq	%rax, 8(%rsp)
+	cmpq	$-1, %rax
+	je	.L840
+	movq	%rax, %r14
+	movq	%rbp, %rsi
+	movl	$2, %edx
+	movq	%rax, %rdi
+	call	madvise@PLT
+	movq	%rbx, 40(%rsp)
+	movq	%r14, %rbx
+	movq	%rbp, 48(%rsp)
+	movl	$1048576, %ebp
+	movq	%r14, 56(%rsp)
+	movq	%r14, 24(%rsp)
+	movb	$1, 21(%rsp)
+	jmp	.L656
+.L874:
+	xorl	%eax, %eax
+	movq	%rax, 40(%rsp)
+	jmp	.L709
+.L832:
+	jmp	.L833
+.L830:
+	jmp	.L831
+.L781:
+	movq	%rax, %rbx
+	jmp	.L717
+	.section	.gcc_except_table
+.LLSDA6944:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6944-.LLSDACSB6944
+.LLSDACSB6944:
+	.uleb128 .LEHB29-.LFB6944
+	.uleb128 .LEHE29-.LEHB29
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB30-.LFB6944
+	.uleb128 .LEHE30-.LEHB30
+	.uleb128 .L832-.LFB6944
+	.uleb128 0
+	.uleb128 .LEHB31-.LFB6944
+	.uleb128 .LEHE31-.LEHB31
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB32-.LFB6944
+	.uleb128 .LEHE32-.LEHB32
+	.uleb128 .L781-.LFB6944
+	.uleb128 0
+	.uleb128 .LEHB33-.LFB6944
+	.uleb128 .LEHE33-.LEHB33
+	.uleb128 .L830-.LFB6944
+	.uleb128 0
+	.uleb128 .LEHB34-.LFB6944
+	.uleb128 .LEHE34-.LEHB34
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB35-.LFB6944
+	.uleb128 .LEHE35-.LEHB35
+	.uleb128 .L781-.LFB6944
+	.uleb128 0
+.LLSDACSE6944:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6944
+	.type	_Z20test_std_reader_filev.cold, @function
+_Z20test_std_reader_filev.cold:
+.LFSB6944:
+.L836:
+	.cfi_def_cfa_offset 288
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC37(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB36:
+	call	__cxa_throw@PLT
+.LEHE36:
+.L835:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC36(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB37:
+	call	__cxa_throw@PLT
+.LEHE37:
+.L780:
+.L833:
+	movq	8(%rsp), %rdi
+	movq	%rax, %rbx
+	call	_ZN1n10std_readerD1Ev
+	movq	%rbx, %rdi
+.LEHB38:
+	call	_Unwind_Resume@PLT
+.L779:
+.L831:
+	movq	%rax, %rbx
+	leaq	16(%rsp), %rdi
+	call	_ZN1n10std_readerD1Ev
+	movq	%rbx, %rdi
+	call	_Unwind_Resume@PLT
+.LEHE38:
+.L837:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC38(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB39:
+	call	__cxa_throw@PLT
+.LEHE39:
+.L834:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC35(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB40:
+	call	__cxa_throw@PLT
+.LEHE40:
+.L717:
+	movq	8(%rsp), %rdi
+	call	_ZN1n10std_readerD1Ev
+	movq	%rbx, %rdi
+.LEHB41:
+	call	_Unwind_Resume@PLT
+.LEHE41:
+	.cfi_endproc
+.LFE6944:
+	.section	.gcc_except_table
+.LLSDAC6944:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6944-.LLSDACSBC6944
+.LLSDACSBC6944:
+	.uleb128 .LEHB36-.LCOLDB41
+	.uleb128 .LEHE36-.LEHB36
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB37-.LCOLDB41
+	.uleb128 .LEHE37-.LEHB37
+	.uleb128 .L779-.LCOLDB41
+	.uleb128 0
+	.uleb128 .LEHB38-.LCOLDB41
+	.uleb128 .LEHE38-.LEHB38
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB39-.LCOLDB41
+	.uleb128 .LEHE39-.LEHB39
+	.uleb128 .L780-.LCOLDB41
+	.uleb128 0
+	.uleb128 .LEHB40-.LCOLDB41
+	.uleb128 .LEHE40-.LEHB40
+	.uleb128 .L779-.LCOLDB41
+	.uleb128 0
+	.uleb128 .LEHB41-.LCOLDB41
+	.uleb128 .LEHE41-.LEHB41
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6944:
+	.section	.text.unlikely
+	.text
+	.size	_Z20test_std_reader_filev, .-_Z20test_std_reader_filev
+	.section	.text.unlikely
+	.size	_Z20test_std_reader_filev.cold, .-_Z20test_std_reader_filev.cold
+.LCOLDE41:
+	.text
+.LHOTE41:
+	.section	.text.unlikely
+.LCOLDB43:
+	.section	.text.startup
+.LHOTB43:
+	.p2align 4
+	.type	_GLOBAL__sub_I_path, @function
+_GLOBAL__sub_I_path:
+.LFB7018:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7018
+	cmpb	$0, _ZGVN1n4stdrE(%rip)
+	je	.L906
+	ret
+.L906:
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movl	$4294967295, %eax
+	xorl	%edi, %edi
+	xorl	%r8d, %r8d
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$48, %rsp
+	.cfi_def_cfa_offset 80
+	movdqa	.LC42(%rip), %xmm0
+	movq	stdin(%rip), %rbx
+	movb	$1, _ZGVN1n4stdrE(%rip)
+	movq	%rax, _ZN1n4stdrE(%rip)
+	movq	$0, 8+_ZN1n4stdrE(%rip)
+	movq	%rdi, 16+_ZN1n4stdrE(%rip)
+	movq	%r8, 40+_ZN1n4stdrE(%rip)
+	movups	%xmm0, 24+_ZN1n4stdrE(%rip)
+	testq	%rbx, %rbx
+	je	.L907
+	movq	%rbx, %rdi
+	movq	%rbx, 48+_ZN1n4stdrE(%rip)
+	call	fileno@PLT
+	movq	%rbx, %rdi
+	call	fileno@PLT
+	movl	_ZN1n4stdrE(%rip), %ebx
+	xorl	%edx, %edx
+	xorl	%ecx, %ecx
+	movdqa	.LC42(%rip), %xmm0
+	movl	%eax, (%rsp)
+	movw	$0, 4(%rsp)
+	movb	$0, 6(%rsp)
+	movq	$0, 8(%rsp)
+	movq	%rdx, 16(%rsp)
+	movq	%rcx, 40(%rsp)
+	movups	%xmm0, 24(%rsp)
+	testl	%ebx, %ebx
+	js	.L879
+	cmpl	$2, 8+_ZN1n4stdrE(%rip)
+	je	.L908
+.L880:
+	cmpb	$0, 4+_ZN1n4stdrE(%rip)
+	jne	.L885
+.L886:
+	movl	$-1, _ZN1n4stdrE(%rip)
+.L879:
+	cmpq	$0, 16+_ZN1n4stdrE(%rip)
+	je	.L891
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L909
+.L889:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24+_ZN1n4stdrE(%rip), %rdx
+	movl	$64, %ecx
+	movq	16+_ZN1n4stdrE(%rip), %rsi
+	movq	(%rdi), %rax
+.LEHB42:
+	call	*24(%rax)
+.L891:
+	movl	(%rsp), %eax
+	movdqu	24(%rsp), %xmm1
+	movl	%eax, _ZN1n4stdrE(%rip)
+	movzwl	4(%rsp), %eax
+	movups	%xmm1, 24+_ZN1n4stdrE(%rip)
+	movw	%ax, 4+_ZN1n4stdrE(%rip)
+	movzbl	6(%rsp), %eax
+	movb	%al, 6+_ZN1n4stdrE(%rip)
+	movq	8(%rsp), %rax
+	movq	%rax, 8+_ZN1n4stdrE(%rip)
+	movq	16(%rsp), %rax
+	movq	%rax, 16+_ZN1n4stdrE(%rip)
+	movq	40(%rsp), %rax
+	movq	%rax, 40+_ZN1n4stdrE(%rip)
+	jmp	.L878
+.L907:
+	xorl	%esi, %esi
+	movq	%rsi, 48+_ZN1n4stdrE(%rip)
+.L878:
+	addq	$48, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	leaq	__dso_handle(%rip), %rdx
+	leaq	_ZN1n4stdrE(%rip), %rsi
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+	leaq	_ZN1n4fileIcLNS_4modeE6EED1Ev(%rip), %rdi
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+	jmp	__cxa_atexit@PLT
+.L908:
+	.cfi_restore_state
+	movq	40+_ZN1n4stdrE(%rip), %rbp
+	testq	%rbp, %rbp
+	je	.L880
+	movq	16+_ZN1n4stdrE(%rip), %r12
+.L884:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L910
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L884
+.L883:
+	xorl	%eax, %eax
+	movq	%rax, 40+_ZN1n4stdrE(%rip)
+	jmp	.L880
+.L885:
+	movl	_ZN1n4stdrE(%rip), %edi
+	call	close@PLT
+.LEHE42:
+	jmp	.L886
+.L909:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L889
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L889
+.L910:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L883
+	jmp	.L884
+.L893:
+	movq	%rax, %rbx
+	jmp	.L892
+	.section	.gcc_except_table
+.LLSDA7018:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7018-.LLSDACSB7018
+.LLSDACSB7018:
+	.uleb128 .LEHB42-.LFB7018
+	.uleb128 .LEHE42-.LEHB42
+	.uleb128 .L893-.LFB7018
+	.uleb128 0
+.LLSDACSE7018:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7018
+	.type	_GLOBAL__sub_I_path.cold, @function
+_GLOBAL__sub_I_path.cold:
+.LFSB7018:
+.L892:
+	.cfi_def_cfa_offset 80
+	.cfi_offset 3, -32
+	.cfi_offset 6, -24
+	.cfi_offset 12, -16
+	movq	%rsp, %rdi
+	call	_ZN1n7fd_file5closeEv
+	leaq	_ZN1n4stdrE(%rip), %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB43:
+	call	_Unwind_Resume@PLT
+.LEHE43:
+	.cfi_endproc
+.LFE7018:
+	.section	.gcc_except_table
+.LLSDAC7018:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7018-.LLSDACSBC7018
+.LLSDACSBC7018:
+	.uleb128 .LEHB43-.LCOLDB43
+	.uleb128 .LEHE43-.LEHB43
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC7018:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	_GLOBAL__sub_I_path, .-_GLOBAL__sub_I_path
+	.section	.text.unlikely
+	.size	_GLOBAL__sub_I_path.cold, .-_GLOBAL__sub_I_path.cold
+.LCOLDE43:
+	.section	.text.startup
+.LHOTE43:
+	.section	.init_array,"aw"
+	.align 8
+	.quad	_GLOBAL__sub_I_path
+	.weak	_ZGVN1n4stdrE
+	.section	.bss._ZGVN1n4stdrE,"awG",@nobits,_ZGVN1n4stdrE,comdat
+	.align 8
+	.type	_ZGVN1n4stdrE, @gnu_unique_object
+	.size	_ZGVN1n4stdrE, 8
+_ZGVN1n4stdrE:
+	.zero	8
+	.weak	_ZTSN1n15memory_resourceE
+	.section	.rodata._ZTSN1n15memory_resourceE,"aG",@progbits,_ZTSN1n15memory_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n15memory_resourceE, @object
+	.size	_ZTSN1n15memory_resourceE, 22
+_ZTSN1n15memory_resourceE:
+	.string	"N1n15memory_resourceE"
+	.weak	_ZTIN1n15memory_resourceE
+	.section	.data.rel.ro._ZTIN1n15memory_resourceE,"awG",@progbits,_ZTIN1n15memory_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n15memory_resourceE, @object
+	.size	_ZTIN1n15memory_resourceE, 16
+_ZTIN1n15memory_resourceE:
+	.quad	_ZTVN10__cxxabiv117__class_type_infoE+16
+	.quad	_ZTSN1n15memory_resourceE
+	.weak	_ZTSN1n13heap_resourceE
+	.section	.rodata._ZTSN1n13heap_resourceE,"aG",@progbits,_ZTSN1n13heap_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n13heap_resourceE, @object
+	.size	_ZTSN1n13heap_resourceE, 20
+_ZTSN1n13heap_resourceE:
+	.string	"N1n13heap_resourceE"
+	.weak	_ZTIN1n13heap_resourceE
+	.section	.data.rel.ro._ZTIN1n13heap_resourceE,"awG",@progbits,_ZTIN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n13heap_resourceE, @object
+	.size	_ZTIN1n13heap_resourceE, 24
+_ZTIN1n13heap_resourceE:
+	.quad	_ZTVN10__cxxabiv120__si_class_type_infoE+16
+	.quad	_ZTSN1n13heap_resourceE
+	.quad	_ZTIN1n15memory_resourceE
+	.weak	_ZTVN1n13heap_resourceE
+	.section	.data.rel.ro.local._ZTVN1n13heap_resourceE,"awG",@progbits,_ZTVN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTVN1n13heap_resourceE, @object
+	.size	_ZTVN1n13heap_resourceE, 48
+_ZTVN1n13heap_resourceE:
+	.quad	0
+	.quad	_ZTIN1n13heap_resourceE
+	.quad	_ZN1n13heap_resourceD1Ev
+	.quad	_ZN1n13heap_resourceD0Ev
+	.quad	_ZN1n13heap_resource8allocateEmm
+	.quad	_ZN1n13heap_resource10deallocateEPvmm
+	.globl	copy
+	.section	.rodata.str1.1
+.LC44:
+	.string	"test_std_reader_copy.txt"
+	.section	.data.rel.local,"aw"
+	.align 8
+	.type	copy, @object
+	.size	copy, 8
+copy:
+	.quad	.LC44
+	.globl	path
+	.section	.rodata.str1.1
+.LC45:
+	.string	"test_std_reader.txt"
+	.section	.data.rel.local
+	.align 8
+	.type	path, @object
+	.size	path, 8
+path:
+	.quad	.LC45
+	.weak	_ZN1n4stdrE
+	.section	.bss._ZN1n4stdrE,"awG",@nobits,_ZN1n4stdrE,comdat
+	.align 32
+	.type	_ZN1n4stdrE, @gnu_unique_object
+	.size	_ZN1n4stdrE, 56
+_ZN1n4stdrE:
+	.zero	56
+	.weak	_ZN1n18__current_resourceE
+	.section	.tbss._ZN1n18__current_resourceE,"awTG",@nobits,_ZN1n18__current_resourceE,comdat
+	.align 8
+	.type	_ZN1n18__current_resourceE, @gnu_unique_object
+	.size	_ZN1n18__current_resourceE, 8
+_ZN1n18__current_resourceE:
+	.zero	8
+	.weak	_ZGVZN1n4heapEvE3res
+	.section	.bss._ZGVZN1n4heapEvE3res,"awG",@nobits,_ZGVZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZGVZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZGVZN1n4heapEvE3res, 8
+_ZGVZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE3res
+	.section	.bss._ZZN1n4heapEvE3res,"awG",@nobits,_ZZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZZN1n4heapEvE3res, 8
+_ZZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE7storage
+	.section	.bss._ZZN1n4heapEvE7storage,"awG",@nobits,_ZZN1n4heapEvE7storage,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE7storage, @gnu_unique_object
+	.size	_ZZN1n4heapEvE7storage, 8
+_ZZN1n4heapEvE7storage:
+	.zero	8
+	.weak	_ZGVZN1n9simd_bestEvE4best
+	.section	.bss._ZGVZN1n9simd_bestEvE4best,"awG",@nobits,_ZGVZN1n9simd_bestEvE4best,comdat
+	.align 8
+	.type	_ZGVZN1n9simd_bestEvE4best, @gnu_unique_object
+	.size	_ZGVZN1n9simd_bestEvE4best, 8
+_ZGVZN1n9simd_bestEvE4best:
+	.zero	8
+	.weak	_ZZN1n9simd_bestEvE4best
+	.section	.bss._ZZN1n9simd_bestEvE4best,"awG",@nobits,_ZZN1n9simd_bestEvE4best,comdat
+	.align 4
+	.type	_ZZN1n9simd_bestEvE4best, @gnu_unique_object
+	.size	_ZZN1n9simd_bestEvE4best, 4
+_ZZN1n9simd_bestEvE4best:
+	.zero	4
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC0:
+	.quad	4096
+	.quad	0
+	.align 16
+.LC1:
+	.quad	0
+	.quad	23
+	.section	.rodata.cst2,"aM",@progbits,2
+	.align 2
+.LC8:
+	.byte	10
+	.byte	0
+	.section	.rodata.cst16
+	.align 16
+.LC16:
+	.quad	1048576
+	.quad	0
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC30:
+	.long	4
+	.long	100
+	.section	.rodata.cst16
+	.align 16
+.LC34:
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.align 16
+.LC39:
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.align 16
+.LC42:
+	.quad	65536
+	.quad	0
+	.hidden	DW.ref._ZTIPKc
+	.weak	DW.ref._ZTIPKc
+	.section	.data.rel.local.DW.ref._ZTIPKc,"awG",@progbits,DW.ref._ZTIPKc,comdat
+	.align 8
+	.type	DW.ref._ZTIPKc, @object
+	.size	DW.ref._ZTIPKc, 8
+DW.ref._ZTIPKc:
+	.quad	_ZTIPKc
+	.hidden	DW.ref.__gxx_personality_v0
+	.weak	DW.ref.__gxx_personality_v0
+	.section	.data.rel.local.DW.ref.__gxx_personality_v0,"awG",@progbits,DW.ref.__gxx_personality_v0,comdat
+	.align 8
+	.type	DW.ref.__gxx_personality_v0, @object
+	.size	DW.ref.__gxx_personality_v0, 8
+DW.ref.__gxx_personality_v0:
+	.quad	__gxx_personality_v0
+	.hidden	__dso_handle
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
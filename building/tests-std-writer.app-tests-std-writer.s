@@ -0,0 +1,7661 @@
+	.file	"tests-std-writer.cpp"
+	.text
+	.section	.text._ZN1n13heap_resourceD2Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD2Ev
+	.type	_ZN1n13heap_resourceD2Ev, @function
+_ZN1n13heap_resourceD2Ev:
+.LFB7022:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE7022:
+	.size	_ZN1n13heap_resourceD2Ev, .-_ZN1n13heap_resourceD2Ev
+	.weak	_ZN1n13heap_resourceD1Ev
+	.set	_ZN1n13heap_resourceD1Ev,_ZN1n13heap_resourceD2Ev
+	.section	.text._ZN1n13heap_resource10deallocateEPvmm,"axG",@progbits,_ZN1n13heap_resource10deallocateEPvmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource10deallocateEPvmm
+	.type	_ZN1n13heap_resource10deallocateEPvmm, @function
+_ZN1n13heap_resource10deallocateEPvmm:
+.LFB66:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rcx
+	jbe	.L4
+	movq	%rcx, %rsi
+	jmp	_ZdlPvSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	jmp	_ZdlPv@PLT
+	.cfi_endproc
+.LFE66:
+	.size	_ZN1n13heap_resource10deallocateEPvmm, .-_ZN1n13heap_resource10deallocateEPvmm
+	.section	.text._ZN1n13heap_resource8allocateEmm,"axG",@progbits,_ZN1n13heap_resource8allocateEmm,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resource8allocateEmm
+	.type	_ZN1n13heap_resource8allocateEmm, @function
+_ZN1n13heap_resource8allocateEmm:
+.LFB65:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	cmpq	$16, %rdx
+	jbe	.L6
+	movq	%rdx, %rsi
+	jmp	_ZnwmSt11align_val_t@PLT
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	jmp	_Znwm@PLT
+	.cfi_endproc
+.LFE65:
+	.size	_ZN1n13heap_resource8allocateEmm, .-_ZN1n13heap_resource8allocateEmm
+	.section	.text._ZN1n13heap_resourceD0Ev,"axG",@progbits,_ZN1n13heap_resourceD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n13heap_resourceD0Ev
+	.type	_ZN1n13heap_resourceD0Ev, @function
+_ZN1n13heap_resourceD0Ev:
+.LFB7024:
+	.cfi_startproc
+	movl	$8, %esi
+	jmp	_ZdlPvm@PLT
+	.cfi_endproc
+.LFE7024:
+	.size	_ZN1n13heap_resourceD0Ev, .-_ZN1n13heap_resourceD0Ev
+	.section	.text._ZN1n10std_writerILi9EE8__bufferD2Ev,"axG",@progbits,_ZN1n10std_writerILi9EE8__bufferD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n10std_writerILi9EE8__bufferD2Ev
+	.type	_ZN1n10std_writerILi9EE8__bufferD2Ev, @function
+_ZN1n10std_writerILi9EE8__bufferD2Ev:
+.LFB7030:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7030
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	8(%rdi), %rbp
+	movq	%rdi, %rbx
+	testq	%rbp, %rbp
+	jne	.L9
+.L14:
+	cmpq	$0, (%rbx)
+	movq	$0, 8(%rbx)
+	movb	$0, 32(%rbx)
+	je	.L8
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L26
+.L17:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	16(%rbx), %rdx
+	movl	$64, %ecx
+	movq	(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L8:
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L9:
+	.cfi_restore_state
+	movq	(%rdi), %r12
+.L15:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	$9, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L27
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L15
+	jmp	.L14
+	.p2align 4,,10
+	.p2align 3
+.L27:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L14
+	jmp	.L15
+	.p2align 4,,10
+	.p2align 3
+.L26:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L17
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L17
+	.cfi_endproc
+.LFE7030:
+	.globl	__gxx_personality_v0
+	.section	.gcc_except_table._ZN1n10std_writerILi9EE8__bufferD2Ev,"aG",@progbits,_ZN1n10std_writerILi9EE8__bufferD5Ev,comdat
+.LLSDA7030:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7030-.LLSDACSB7030
+.LLSDACSB7030:
+.LLSDACSE7030:
+	.section	.text._ZN1n10std_writerILi9EE8__bufferD2Ev,"axG",@progbits,_ZN1n10std_writerILi9EE8__bufferD5Ev,comdat
+	.size	_ZN1n10std_writerILi9EE8__bufferD2Ev, .-_ZN1n10std_writerILi9EE8__bufferD2Ev
+	.weak	_ZN1n10std_writerILi9EE8__bufferD1Ev
+	.set	_ZN1n10std_writerILi9EE8__bufferD1Ev,_ZN1n10std_writerILi9EE8__bufferD2Ev
+	.section	.text._ZN1n10std_writerILi1EE8__bufferD2Ev,"axG",@progbits,_ZN1n10std_writerILi1EE8__bufferD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n10std_writerILi1EE8__bufferD2Ev
+	.type	_ZN1n10std_writerILi1EE8__bufferD2Ev, @function
+_ZN1n10std_writerILi1EE8__bufferD2Ev:
+.LFB7033:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7033
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	8(%rdi), %rbp
+	movq	%rdi, %rbx
+	testq	%rbp, %rbp
+	jne	.L29
+.L34:
+	cmpq	$0, (%rbx)
+	movq	$0, 8(%rbx)
+	movb	$0, 32(%rbx)
+	je	.L28
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L46
+.L37:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	16(%rbx), %rdx
+	movl	$64, %ecx
+	movq	(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L28:
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	.cfi_restore_state
+	movq	(%rdi), %r12
+.L35:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	$1, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L47
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L35
+	jmp	.L34
+	.p2align 4,,10
+	.p2align 3
+.L47:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L34
+	jmp	.L35
+	.p2align 4,,10
+	.p2align 3
+.L46:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L37
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L37
+	.cfi_endproc
+.LFE7033:
+	.section	.gcc_except_table._ZN1n10std_writerILi1EE8__bufferD2Ev,"aG",@progbits,_ZN1n10std_writerILi1EE8__bufferD5Ev,comdat
+.LLSDA7033:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7033-.LLSDACSB7033
+.LLSDACSB7033:
+.LLSDACSE7033:
+	.section	.text._ZN1n10std_writerILi1EE8__bufferD2Ev,"axG",@progbits,_ZN1n10std_writerILi1EE8__bufferD5Ev,comdat
+	.size	_ZN1n10std_writerILi1EE8__bufferD2Ev, .-_ZN1n10std_writerILi1EE8__bufferD2Ev
+	.weak	_ZN1n10std_writerILi1EE8__bufferD1Ev
+	.set	_ZN1n10std_writerILi1EE8__bufferD1Ev,_ZN1n10std_writerILi1EE8__bufferD2Ev
+	.section	.text._ZN1n4fileIcLNS_4modeE6EED2Ev,"axG",@progbits,_ZN1n4fileIcLNS_4modeE6EED5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4fileIcLNS_4modeE6EED2Ev
+	.type	_ZN1n4fileIcLNS_4modeE6EED2Ev, @function
+_ZN1n4fileIcLNS_4modeE6EED2Ev:
+.LFB6917:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6917
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movl	(%rdi), %ebp
+	testl	%ebp, %ebp
+	js	.L49
+	cmpl	$2, 8(%rdi)
+	je	.L99
+.L50:
+	cmpb	$0, 4(%rbx)
+	jne	.L100
+.L55:
+	movl	$-1, (%rbx)
+.L49:
+	cmpq	$0, 16(%rbx)
+	je	.L56
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L101
+.L58:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	$0, 16(%rbx)
+.L56:
+	movq	48(%rbx), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$0, 8(%rbx)
+	movups	%xmm0, 32(%rbx)
+	testq	%rdi, %rdi
+	je	.L60
+	call	fclose@PLT
+	movl	(%rbx), %ebp
+	movq	$0, 48(%rbx)
+	testl	%ebp, %ebp
+	js	.L97
+	cmpl	$2, 8(%rbx)
+	jne	.L64
+	movq	40(%rbx), %r12
+	testq	%r12, %r12
+	jne	.L102
+.L64:
+	cmpb	$0, 4(%rbx)
+	jne	.L103
+.L70:
+	movl	$-1, (%rbx)
+.L97:
+	movq	16(%rbx), %rax
+	testq	%rax, %rax
+	je	.L48
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L104
+.L73:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L48:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L99:
+	.cfi_restore_state
+	movq	40(%rdi), %r12
+	testq	%r12, %r12
+	je	.L50
+	movq	16(%rdi), %r13
+.L54:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L105
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L54
+	.p2align 4,,10
+	.p2align 3
+.L53:
+	movq	$0, 40(%rbx)
+	jmp	.L50
+	.p2align 4,,10
+	.p2align 3
+.L60:
+	movl	(%rbx), %eax
+	testl	%eax, %eax
+	js	.L48
+	cmpb	$0, 4(%rbx)
+	je	.L70
+.L103:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L70
+	.p2align 4,,10
+	.p2align 3
+.L100:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L55
+	.p2align 4,,10
+	.p2align 3
+.L104:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L73
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L73
+	.p2align 4,,10
+	.p2align 3
+.L101:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L58
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L58
+	.p2align 4,,10
+	.p2align 3
+.L102:
+	movq	16(%rbx), %r13
+.L69:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L106
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L69
+	.p2align 4,,10
+	.p2align 3
+.L68:
+	movq	$0, 40(%rbx)
+	jmp	.L64
+	.p2align 4,,10
+	.p2align 3
+.L105:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L53
+	jmp	.L54
+	.p2align 4,,10
+	.p2align 3
+.L106:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L68
+	jmp	.L69
+	.cfi_endproc
+.LFE6917:
+	.section	.gcc_except_table._ZN1n4fileIcLNS_4modeE6EED2Ev,"aG",@progbits,_ZN1n4fileIcLNS_4modeE6EED5Ev,comdat
+.LLSDA6917:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6917-.LLSDACSB6917
+.LLSDACSB6917:
+.LLSDACSE6917:
+	.section	.text._ZN1n4fileIcLNS_4modeE6EED2Ev,"axG",@progbits,_ZN1n4fileIcLNS_4modeE6EED5Ev,comdat
+	.size	_ZN1n4fileIcLNS_4modeE6EED2Ev, .-_ZN1n4fileIcLNS_4modeE6EED2Ev
+	.weak	_ZN1n4fileIcLNS_4modeE6EED1Ev
+	.set	_ZN1n4fileIcLNS_4modeE6EED1Ev,_ZN1n4fileIcLNS_4modeE6EED2Ev
+	.section	.text._ZN1n7fd_file5closeEv,"axG",@progbits,_ZN1n7fd_file5closeEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n7fd_file5closeEv
+	.type	_ZN1n7fd_file5closeEv, @function
+_ZN1n7fd_file5closeEv:
+.LFB163:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movl	(%rdi), %ebp
+	testl	%ebp, %ebp
+	js	.L108
+	cmpl	$2, 8(%rdi)
+	je	.L129
+.L109:
+	cmpb	$0, 4(%rbx)
+	jne	.L130
+.L114:
+	movl	$-1, (%rbx)
+.L108:
+	cmpq	$0, 16(%rbx)
+	je	.L115
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L131
+.L117:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24(%rbx), %rdx
+	movl	$64, %ecx
+	movq	16(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	$0, 16(%rbx)
+.L115:
+	pxor	%xmm0, %xmm0
+	movl	$0, 8(%rbx)
+	movups	%xmm0, 32(%rbx)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L129:
+	.cfi_restore_state
+	movq	40(%rdi), %r12
+	testq	%r12, %r12
+	je	.L109
+	movq	16(%rdi), %r13
+.L113:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	%ebp, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L132
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L113
+	.p2align 4,,10
+	.p2align 3
+.L112:
+	movq	$0, 40(%rbx)
+	jmp	.L109
+	.p2align 4,,10
+	.p2align 3
+.L130:
+	movl	(%rbx), %edi
+	call	close@PLT
+	jmp	.L114
+	.p2align 4,,10
+	.p2align 3
+.L131:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L117
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L117
+	.p2align 4,,10
+	.p2align 3
+.L132:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L112
+	jmp	.L113
+	.cfi_endproc
+.LFE163:
+	.size	_ZN1n7fd_file5closeEv, .-_ZN1n7fd_file5closeEv
+	.section	.rodata._ZN1n4test10test_suite7run_allEv.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"\nSUITE [%s] "
+.LC2:
+	.string	"%s"
+.LC3:
+	.string	"\nTEST [%s] "
+.LC4:
+	.string	" - Result : \033[1;32mPASSED\033[0m"
+.LC5:
+	.string	"\033[1;31merror : %s\033[0m\n"
+.LC6:
+	.string	" - Result : \033[1;31mFAILED\033[0m"
+.LC7:
+	.string	" - Passed : \033[1;32m%d\033[0m\n"
+.LC8:
+	.string	" - Failed : \033[1;31m%d\033[0m\n"
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n4test10test_suite7run_allEv
+	.type	_ZN1n4test10test_suite7run_allEv, @function
+_ZN1n4test10test_suite7run_allEv:
+.LFB6883:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6883
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rdx
+	movl	$79, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movq	16(%rdi), %rcx
+	leaq	16(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L134
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L135
+	testb	$4, %cl
+	jne	.L188
+	testl	%ecx, %ecx
+	je	.L134
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L189
+	.p2align 4,,10
+	.p2align 3
+.L134:
+	movzwl	.LC1(%rip), %r15d
+	movq	%rbx, %rsi
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+.LEHB0:
+	call	printf@PLT
+	movl	8(%r12), %esi
+	testl	%esi, %esi
+	jle	.L155
+	movl	$0, 12(%rsp)
+	xorl	%ebp, %ebp
+	xorl	%r14d, %r14d
+	jmp	.L149
+	.p2align 4,,10
+	.p2align 3
+.L192:
+	testb	$4, %dl
+	jne	.L190
+	testl	%edx, %edx
+	je	.L140
+	movb	$42, (%rax)
+	testb	$2, %dl
+	jne	.L191
+	.p2align 4,,10
+	.p2align 3
+.L140:
+	movq	%rbx, %rsi
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+.LEHE0:
+	movq	(%r12), %rax
+.LEHB1:
+	call	*8(%rax,%r13)
+.LEHE1:
+	leaq	.LC4(%rip), %rdi
+	addl	$1, %r14d
+.LEHB2:
+	call	puts@PLT
+.L145:
+	addq	$1, %rbp
+	cmpl	%ebp, 8(%r12)
+	jle	.L139
+.L149:
+	movq	(%r12), %rax
+	movq	%rbp, %r13
+	movq	%rbx, %rdi
+	movl	$79, %esi
+	salq	$4, %r13
+	leaq	.LC3(%rip), %rdx
+	movq	(%rax,%r13), %rcx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L140
+	movl	$79, %edx
+	subl	%eax, %edx
+	addq	%rbx, %rax
+	cmpl	$8, %edx
+	jb	.L192
+	movabsq	$3038287259199220266, %rsi
+	leaq	8(%rax), %rdi
+	movl	%edx, %ecx
+	andq	$-8, %rdi
+	movq	%rsi, (%rax)
+	movq	%rsi, -8(%rax,%rcx)
+	subq	%rdi, %rax
+	leal	(%rdx,%rax), %ecx
+	movq	%rsi, %rax
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L140
+.L155:
+	movl	$0, 12(%rsp)
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L139:
+	movabsq	$5917806138674729738, %rax
+	movq	%rbx, %rdi
+	movq	%rax, 16(%rsp)
+	movabsq	$9095440486453792, %rax
+	movq	%rax, 22(%rsp)
+	call	strlen@PLT
+	cmpq	$79, %rax
+	je	.L150
+	movl	$79, %ecx
+	leaq	(%rbx,%rax), %rdx
+	subl	%eax, %ecx
+	movabsq	$3038287259199220266, %rax
+	cmpl	$8, %ecx
+	jnb	.L151
+	testb	$4, %cl
+	jne	.L193
+	testl	%ecx, %ecx
+	je	.L150
+	movb	$42, (%rdx)
+	testb	$2, %cl
+	jne	.L194
+.L150:
+	movq	%rbx, %rsi
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+	movw	%r15w, 94(%rsp)
+	call	printf@PLT
+	movl	%r14d, %esi
+	leaq	.LC7(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	12(%rsp), %esi
+	leaq	.LC8(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	movl	$10, %edi
+	call	putchar@PLT
+.LEHE2:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L151:
+	.cfi_restore_state
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L150
+.L135:
+	leaq	8(%rdx), %rdi
+	movl	%ecx, %esi
+	movq	%rax, (%rdx)
+	andq	$-8, %rdi
+	movq	%rax, -8(%rdx,%rsi)
+	subq	%rdi, %rdx
+	addl	%edx, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	jmp	.L134
+.L190:
+	movl	$707406378, (%rax)
+	movl	$707406378, -4(%rax,%rdx)
+	jmp	.L140
+.L191:
+	movl	$10794, %ecx
+	movw	%cx, -2(%rax,%rdx)
+	jmp	.L140
+.L189:
+	movl	$10794, %edi
+	movw	%di, -2(%rdx,%rcx)
+	jmp	.L134
+.L194:
+	movl	$10794, %eax
+	movw	%ax, -2(%rdx,%rcx)
+	jmp	.L150
+.L188:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L134
+.L193:
+	movl	$707406378, (%rdx)
+	movl	$707406378, -4(%rdx,%rcx)
+	jmp	.L150
+.L156:
+	movq	%rax, %rdi
+	movq	%rdx, %rax
+.L146:
+	subq	$1, %rax
+	jne	.L187
+	call	__cxa_begin_catch@PLT
+	leaq	.LC5(%rip), %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+.LEHB3:
+	call	printf@PLT
+.LEHE3:
+	call	__cxa_end_catch@PLT
+	leaq	.LC6(%rip), %rdi
+	addl	$1, 12(%rsp)
+.LEHB4:
+	call	puts@PLT
+	jmp	.L145
+.L148:
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+.L187:
+	call	_Unwind_Resume@PLT
+.LEHE4:
+.L157:
+	movq	%rax, %rbx
+	jmp	.L148
+	.cfi_endproc
+.LFE6883:
+	.section	.gcc_except_table._ZN1n4test10test_suite7run_allEv,"aG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.align 4
+.LLSDA6883:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT6883-.LLSDATTD6883
+.LLSDATTD6883:
+	.byte	0x1
+	.uleb128 .LLSDACSE6883-.LLSDACSB6883
+.LLSDACSB6883:
+	.uleb128 .LEHB0-.LFB6883
+	.uleb128 .LEHE0-.LEHB0
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB1-.LFB6883
+	.uleb128 .LEHE1-.LEHB1
+	.uleb128 .L156-.LFB6883
+	.uleb128 0x1
+	.uleb128 .LEHB2-.LFB6883
+	.uleb128 .LEHE2-.LEHB2
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB3-.LFB6883
+	.uleb128 .LEHE3-.LEHB3
+	.uleb128 .L157-.LFB6883
+	.uleb128 0
+	.uleb128 .LEHB4-.LFB6883
+	.uleb128 .LEHE4-.LEHB4
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6883:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	DW.ref._ZTIPKc-.
+.LLSDATT6883:
+	.section	.text._ZN1n4test10test_suite7run_allEv,"axG",@progbits,_ZN1n4test10test_suite7run_allEv,comdat
+	.size	_ZN1n4test10test_suite7run_allEv, .-_ZN1n4test10test_suite7run_allEv
+	.text
+	.p2align 4
+	.globl	_Z8redirectv
+	.type	_Z8redirectv, @function
+_Z8redirectv:
+.LFB6884:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	path(%rip), %rdi
+	movl	$438, %edx
+	xorl	%eax, %eax
+	movl	$577, %esi
+	call	open@PLT
+	movl	$9, %esi
+	movl	%eax, %ebx
+	movl	%eax, %edi
+	call	dup2@PLT
+	movl	%ebx, %edi
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	jmp	close@PLT
+	.cfi_endproc
+.LFE6884:
+	.size	_Z8redirectv, .-_Z8redirectv
+	.section	.text.unlikely,"ax",@progbits
+.LCOLDB11:
+	.text
+.LHOTB11:
+	.p2align 4
+	.globl	_Z7writtenv
+	.type	_Z7writtenv, @function
+_Z7writtenv:
+.LFB6885:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6885
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$4120, %rsp
+	.cfi_def_cfa_offset 4176
+	movdqa	.LC9(%rip), %xmm0
+	movups	%xmm0, (%rdi)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L238
+.L198:
+	movq	%rax, 16(%rbx)
+	pxor	%xmm0, %xmm0
+	xorl	%esi, %esi
+	xorl	%eax, %eax
+	movq	$0, 40(%rbx)
+	movq	path(%rip), %rdi
+	movups	%xmm0, 24(%rbx)
+.LEHB5:
+	call	open@PLT
+	movl	%eax, %r15d
+	leaq	24(%rbx), %rax
+	leaq	16(%rsp), %r13
+	movq	%rax, (%rsp)
+	jmp	.L202
+	.p2align 4,,10
+	.p2align 3
+.L241:
+	leaq	(%rdx,%rdi), %rcx
+	cmpq	%rcx, %r13
+	jnb	.L205
+	movq	%r13, %rcx
+	subq	%rdx, %rcx
+	movq	%rcx, 8(%rsp)
+	cmpq	%rax, %r12
+	jnb	.L211
+	leaq	10(%r12,%r12), %r12
+	movq	16(%rbx), %rdi
+	movl	$1, %edx
+	cmpq	%rax, %r12
+	cmovb	%rax, %r12
+	movq	(%rdi), %rax
+	leaq	1(%r12), %rsi
+	call	*16(%rax)
+	movq	%rax, %r14
+	movq	(%rbx), %rax
+	cmpq	$23, 8(%rbx)
+	leaq	24(%rbx), %rsi
+	leaq	1(%rax), %rdx
+	je	.L213
+	movq	24(%rbx), %rsi
+.L213:
+	movq	%r14, %rdi
+	call	memcpy@PLT
+	movq	8(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L214
+	movq	16(%rbx), %rdi
+	movq	24(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L214:
+	movq	%r14, 24(%rbx)
+	movq	(%rbx), %rdi
+	movq	%r12, 8(%rbx)
+.L211:
+	cmpq	$23, %r12
+	je	.L239
+	movq	24(%rbx), %r12
+	movq	8(%rsp), %rsi
+	addq	%r12, %rsi
+	.p2align 4,,10
+	.p2align 3
+.L218:
+	movq	%rbp, %rdx
+	addq	%r12, %rdi
+	call	memmove@PLT
+	addq	(%rbx), %rbp
+	movq	%rbp, (%rbx)
+	movb	$0, (%r12,%rbp)
+.L202:
+	movl	$4096, %edx
+	movq	%r13, %rsi
+	movl	%r15d, %edi
+	call	read@PLT
+	movq	%rax, %rbp
+	testq	%rax, %rax
+	jle	.L240
+	movq	8(%rbx), %r12
+	movq	(%rsp), %rdx
+	cmpq	$23, %r12
+	je	.L204
+	movq	24(%rbx), %rdx
+.L204:
+	movq	(%rbx), %rdi
+	leaq	0(%rbp,%rdi), %rax
+	cmpq	%rdx, %r13
+	jnb	.L241
+.L205:
+	cmpq	%rax, %r12
+	jnb	.L207
+	leaq	10(%r12,%r12), %r12
+	movq	16(%rbx), %rdi
+	movl	$1, %edx
+	cmpq	%rax, %r12
+	cmovb	%rax, %r12
+	movq	(%rdi), %rax
+	leaq	1(%r12), %rsi
+	call	*16(%rax)
+	movq	%rax, %r14
+	movq	(%rbx), %rax
+	cmpq	$23, 8(%rbx)
+	movq	(%rsp), %rsi
+	leaq	1(%rax), %rdx
+	je	.L209
+	movq	24(%rbx), %rsi
+.L209:
+	movq	%r14, %rdi
+	call	memcpy@PLT
+	movq	8(%rbx), %rdx
+	cmpq	$23, %rdx
+	je	.L210
+	movq	16(%rbx), %rdi
+	movq	24(%rbx), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L210:
+	movq	%r14, 24(%rbx)
+	movq	(%rbx), %rdi
+	movq	%r12, 8(%rbx)
+.L207:
+	movq	%r13, %rsi
+	cmpq	$23, %r12
+	je	.L242
+	movq	24(%rbx), %r12
+	jmp	.L218
+	.p2align 4,,10
+	.p2align 3
+.L242:
+	movq	(%rsp), %r12
+	jmp	.L218
+	.p2align 4,,10
+	.p2align 3
+.L240:
+	movl	%r15d, %edi
+	call	close@PLT
+.LEHE5:
+	addq	$4120, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L239:
+	.cfi_restore_state
+	movq	8(%rsp), %rsi
+	leaq	24(%rbx), %r12
+	addq	%r12, %rsi
+	jmp	.L218
+	.p2align 4,,10
+	.p2align 3
+.L238:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L243
+.L200:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	jmp	.L198
+.L243:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L200
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L200
+.L223:
+	movq	%rax, %rbp
+	jmp	.L220
+	.section	.gcc_except_table,"a",@progbits
+.LLSDA6885:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6885-.LLSDACSB6885
+.LLSDACSB6885:
+	.uleb128 .LEHB5-.LFB6885
+	.uleb128 .LEHE5-.LEHB5
+	.uleb128 .L223-.LFB6885
+	.uleb128 0
+.LLSDACSE6885:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6885
+	.type	_Z7writtenv.cold, @function
+_Z7writtenv.cold:
+.LFSB6885:
+.L220:
+	.cfi_def_cfa_offset 4176
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	8(%rbx), %rax
+	cmpq	$23, %rax
+	je	.L221
+	movq	16(%rbx), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%rbx), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L221:
+	movq	%rbp, %rdi
+.LEHB6:
+	call	_Unwind_Resume@PLT
+.LEHE6:
+	.cfi_endproc
+.LFE6885:
+	.section	.gcc_except_table
+.LLSDAC6885:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6885-.LLSDACSBC6885
+.LLSDACSBC6885:
+	.uleb128 .LEHB6-.LCOLDB11
+	.uleb128 .LEHE6-.LEHB6
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6885:
+	.section	.text.unlikely
+	.text
+	.size	_Z7writtenv, .-_Z7writtenv
+	.section	.text.unlikely
+	.size	_Z7writtenv.cold, .-_Z7writtenv.cold
+.LCOLDE11:
+	.text
+.LHOTE11:
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC12:
+	.string	"expected true : whole"
+	.section	.text.unlikely
+.LCOLDB13:
+	.text
+.LHOTB13:
+	.p2align 4
+	.globl	_Z23test_std_writer_threadsv
+	.type	_Z23test_std_writer_threadsv, @function
+_Z23test_std_writer_threadsv:
+.LFB6896:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6896
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	movl	$438, %edx
+	movl	$577, %esi
+	xorl	%eax, %eax
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	leaq	_Z11write_linesPv(%rip), %r14
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	subq	$96, %rsp
+	.cfi_def_cfa_offset 144
+	movq	path(%rip), %rdi
+	leaq	12(%rsp), %r12
+	leaq	48(%rsp), %r13
+.LEHB7:
+	call	open@PLT
+	movl	$9, %esi
+	movl	%eax, %ebx
+	movl	%eax, %edi
+	call	dup2@PLT
+	movl	%ebx, %edi
+	leaq	16(%rsp), %rbx
+	call	close@PLT
+	movq	%rbx, %rbp
+	movl	$0, _ZN1n10std_writerILi9EE8__policyE(%rip)
+	movl	$1684234849, 12(%rsp)
+.L245:
+	movq	%r12, %rcx
+	movq	%rbp, %rdi
+	movq	%r14, %rdx
+	xorl	%esi, %esi
+	call	pthread_create@PLT
+	addq	$8, %rbp
+	addq	$1, %r12
+	cmpq	%r13, %rbp
+	jne	.L245
+.L246:
+	movq	(%rbx), %rdi
+	xorl	%esi, %esi
+	addq	$8, %rbx
+	call	pthread_join@PLT
+	cmpq	%r13, %rbx
+	jne	.L246
+	movq	%rbx, %rdi
+	call	_Z7writtenv
+.LEHE7:
+	cmpq	$23, 56(%rsp)
+	leaq	72(%rsp), %r8
+	je	.L247
+	movq	72(%rsp), %r8
+.L247:
+	cmpq	$260000, 48(%rsp)
+	jne	.L248
+	leaq	64(%r8), %rdx
+	addq	$260064, %r8
+	.p2align 4,,10
+	.p2align 3
+.L249:
+	leaq	-63(%rdx), %rax
+	movl	$1, %ecx
+	.p2align 4,,10
+	.p2align 3
+.L253:
+	testb	%cl, %cl
+	je	.L250
+	movzbl	(%rax), %edi
+	movzbl	-64(%rdx), %esi
+	cmpb	%sil, %dil
+	sete	%cl
+	addq	$1, %rax
+	cmpq	%rax, %rdx
+	jne	.L253
+	cmpb	%sil, %dil
+	jne	.L248
+	cmpb	$10, (%rdx)
+	jne	.L248
+	addq	$65, %rdx
+	cmpq	%r8, %rdx
+	jne	.L249
+	movl	$9, %edi
+.LEHB8:
+	call	close@PLT
+.LEHE8:
+	movq	path(%rip), %rdi
+	call	remove@PLT
+	movq	56(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L244
+	movq	64(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	72(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L244:
+	addq	$96, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L250:
+	.cfi_restore_state
+	addq	$1, %rax
+	cmpq	%rax, %rdx
+	jne	.L250
+.L248:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC12(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB9:
+	call	__cxa_throw@PLT
+.LEHE9:
+.L259:
+	movq	%rax, %rbx
+	jmp	.L255
+	.section	.gcc_except_table
+.LLSDA6896:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6896-.LLSDACSB6896
+.LLSDACSB6896:
+	.uleb128 .LEHB7-.LFB6896
+	.uleb128 .LEHE7-.LEHB7
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB8-.LFB6896
+	.uleb128 .LEHE8-.LEHB8
+	.uleb128 .L259-.LFB6896
+	.uleb128 0
+	.uleb128 .LEHB9-.LFB6896
+	.uleb128 .LEHE9-.LEHB9
+	.uleb128 .L259-.LFB6896
+	.uleb128 0
+.LLSDACSE6896:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6896
+	.type	_Z23test_std_writer_threadsv.cold, @function
+_Z23test_std_writer_threadsv.cold:
+.LFSB6896:
+.L255:
+	.cfi_def_cfa_offset 144
+	.cfi_offset 3, -48
+	.cfi_offset 6, -40
+	.cfi_offset 12, -32
+	.cfi_offset 13, -24
+	.cfi_offset 14, -16
+	movq	56(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L256
+	movq	64(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	72(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L256:
+	movq	%rbx, %rdi
+.LEHB10:
+	call	_Unwind_Resume@PLT
+.LEHE10:
+	.cfi_endproc
+.LFE6896:
+	.section	.gcc_except_table
+.LLSDAC6896:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6896-.LLSDACSBC6896
+.LLSDACSBC6896:
+	.uleb128 .LEHB10-.LCOLDB13
+	.uleb128 .LEHE10-.LEHB10
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6896:
+	.section	.text.unlikely
+	.text
+	.size	_Z23test_std_writer_threadsv, .-_Z23test_std_writer_threadsv
+	.section	.text.unlikely
+	.size	_Z23test_std_writer_threadsv.cold, .-_Z23test_std_writer_threadsv.cold
+.LCOLDE13:
+	.text
+.LHOTE13:
+	.section	.rodata.str1.1
+.LC14:
+	.string	"5."
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC15:
+	.string	"expected true : written() == n::str(\"5.\")"
+	.section	.text.unlikely
+.LCOLDB16:
+	.text
+.LHOTB16:
+	.p2align 4
+	.globl	_Z28test_std_writer_empty_appendv
+	.type	_Z28test_std_writer_empty_appendv, @function
+_Z28test_std_writer_empty_appendv:
+.LFB6900:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6900
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$136, %rsp
+	.cfi_def_cfa_offset 192
+	movq	stdout(%rip), %rdi
+.LEHB11:
+	call	fflush@PLT
+	movl	$1, %edi
+	call	dup@PLT
+	movl	$438, %edx
+	movl	$577, %esi
+	movq	path(%rip), %rdi
+	movl	%eax, %ebx
+	xorl	%eax, %eax
+	call	open@PLT
+	movl	$1, %esi
+	movl	%eax, %ebp
+	movl	%eax, %edi
+	call	dup2@PLT
+	movl	%ebp, %edi
+	call	close@PLT
+	xorl	%ecx, %ecx
+	leaq	_Z11empty_firstPv(%rip), %rdx
+	xorl	%esi, %esi
+	leaq	24(%rsp), %rdi
+	call	pthread_create@PLT
+	movq	24(%rsp), %rdi
+	xorl	%esi, %esi
+	call	pthread_join@PLT
+	movl	$1, %esi
+	movl	%ebx, %edi
+	call	dup2@PLT
+	movl	%ebx, %edi
+	call	close@PLT
+.LEHE11:
+	movdqa	.LC9(%rip), %xmm0
+	movaps	%xmm0, 80(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L272
+	pxor	%xmm0, %xmm0
+	leaq	104(%rsp), %r13
+	movq	%rax, 96(%rsp)
+	xorl	%r12d, %r12d
+	leaq	.LC14(%rip), %rbp
+	movups	%xmm0, 104(%rsp)
+	movq	$0, 120(%rsp)
+	cmpq	%r13, %rbp
+	jb	.L319
+.L351:
+	leaq	.LC14(%rip), %rax
+.L355:
+	movq	%r13, %rbx
+.L273:
+	movzwl	(%rax), %eax
+	leaq	32(%rsp), %rdi
+	movw	%ax, (%rbx,%r12)
+	movq	80(%rsp), %rax
+	leaq	2(%rax), %rdx
+	movq	%rdx, 80(%rsp)
+	movb	$0, 2(%rbx,%rax)
+.LEHB12:
+	call	_Z7writtenv
+.LEHE12:
+	movq	32(%rsp), %rdx
+	movq	40(%rsp), %rbp
+	movq	88(%rsp), %rbx
+	cmpq	80(%rsp), %rdx
+	je	.L356
+	movq	56(%rsp), %r13
+	cmpq	$23, %rbp
+	je	.L294
+.L301:
+	xorl	%r12d, %r12d
+.L295:
+	movq	48(%rsp), %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	$23, %rbx
+	je	.L303
+	movq	104(%rsp), %rsi
+.L297:
+	movq	96(%rsp), %rdi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L303:
+	testb	%r12b, %r12b
+	je	.L298
+.L300:
+	movq	path(%rip), %rdi
+	call	remove@PLT
+	addq	$136, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L356:
+	.cfi_restore_state
+	cmpq	$23, %rbx
+	je	.L357
+	movq	104(%rsp), %rsi
+	movq	%rsi, %rax
+	cmpq	$23, %rbp
+	je	.L358
+	movq	56(%rsp), %r13
+	testq	%rdx, %rdx
+	jne	.L309
+	movq	48(%rsp), %rdi
+	movq	%r13, %rsi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	104(%rsp), %rsi
+.L292:
+	movl	$1, %r12d
+	jmp	.L297
+.L358:
+	testq	%rdx, %rdx
+	je	.L292
+.L289:
+	leaq	56(%rsp), %rdi
+	movq	%rax, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L299
+	.p2align 4,,10
+	.p2align 3
+.L294:
+	cmpq	$23, %rbx
+	je	.L298
+	movq	104(%rsp), %rsi
+	xorl	%r12d, %r12d
+	jmp	.L297
+	.p2align 4,,10
+	.p2align 3
+.L319:
+	movq	%rbp, %rax
+	jmp	.L355
+	.p2align 4,,10
+	.p2align 3
+.L272:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L359
+.L277:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	80(%rsp), %r12
+	pxor	%xmm0, %xmm0
+	xorl	%r13d, %r13d
+	movq	88(%rsp), %r14
+	movups	%xmm0, 104(%rsp)
+	leaq	.LC14(%rip), %rbp
+	movq	%r15, 96(%rsp)
+	leaq	2(%r12), %rax
+	movq	$0, 120(%rsp)
+	cmpq	$23, %r14
+	je	.L360
+.L279:
+	leaq	0(%r13,%r12), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L361
+	subq	%r13, %rbp
+	movq	%rbp, 8(%rsp)
+	cmpq	%rax, %r14
+	jnb	.L316
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %rbp
+	movq	(%r15), %rax
+.LEHB13:
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L283
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L283:
+	movq	%rbx, 104(%rsp)
+	movq	%rbp, %r14
+	movq	%rbp, 88(%rsp)
+.L282:
+	cmpq	$23, %r14
+	je	.L284
+	movq	8(%rsp), %rax
+	addq	%rbx, %rax
+	jmp	.L273
+.L361:
+	cmpq	%rax, %r14
+	jnb	.L315
+	leaq	10(%r14,%r14), %rdx
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %rbp
+	movq	(%r15), %rax
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r14
+	je	.L281
+	movq	(%r15), %rax
+	leaq	1(%r14), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	*24(%rax)
+.LEHE13:
+.L281:
+	movq	%rbx, 104(%rsp)
+	movq	%rbp, 88(%rsp)
+.L275:
+	leaq	.LC14(%rip), %rax
+	cmpq	$23, %rbp
+	jne	.L273
+	leaq	104(%rsp), %r13
+	jmp	.L351
+	.p2align 4,,10
+	.p2align 3
+.L357:
+	cmpq	$23, %rbp
+	je	.L362
+	movq	56(%rsp), %r13
+	leaq	104(%rsp), %rax
+	testq	%rdx, %rdx
+	je	.L363
+.L309:
+	movq	%rax, %rsi
+	movq	%r13, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L364
+	cmpq	$23, %rbp
+	je	.L299
+	movl	$1, %r12d
+	jmp	.L295
+.L364:
+	cmpq	$23, %rbp
+	jne	.L301
+	jmp	.L294
+.L359:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L277
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L277
+.L363:
+	movq	48(%rsp), %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L300
+.L299:
+	cmpq	$23, %rbx
+	je	.L300
+	movq	104(%rsp), %rsi
+	jmp	.L292
+.L362:
+	testq	%rdx, %rdx
+	je	.L300
+	leaq	104(%rsp), %rax
+	jmp	.L289
+.L315:
+	xorl	%ebx, %ebx
+	movq	%r14, %rbp
+	jmp	.L275
+.L316:
+	xorl	%ebx, %ebx
+	jmp	.L282
+.L284:
+	movq	8(%rsp), %rax
+	leaq	104(%rsp), %r13
+	addq	%r13, %rax
+	jmp	.L355
+.L360:
+	leaq	104(%rsp), %r13
+	cmpq	%r13, %rbp
+	jnb	.L279
+	cmpq	$23, %rax
+	jbe	.L319
+	movl	$56, %edx
+	movq	%r15, %rdi
+	cmpq	%rdx, %rax
+	cmovnb	%rax, %rdx
+	movq	(%r15), %rax
+	leaq	1(%rdx), %rsi
+	movq	%rdx, %r14
+	movl	$1, %edx
+.LEHB14:
+	call	*16(%rax)
+.LEHE14:
+	leaq	1(%r12), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rbx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	%rbx, 104(%rsp)
+	movq	%rbp, %rax
+	movq	%r14, 88(%rsp)
+	jmp	.L273
+.L320:
+	movq	%rax, %rbx
+	jmp	.L304
+	.section	.gcc_except_table
+.LLSDA6900:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6900-.LLSDACSB6900
+.LLSDACSB6900:
+	.uleb128 .LEHB11-.LFB6900
+	.uleb128 .LEHE11-.LEHB11
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB12-.LFB6900
+	.uleb128 .LEHE12-.LEHB12
+	.uleb128 .L320-.LFB6900
+	.uleb128 0
+	.uleb128 .LEHB13-.LFB6900
+	.uleb128 .LEHE13-.LEHB13
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB14-.LFB6900
+	.uleb128 .LEHE14-.LEHB14
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6900:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6900
+	.type	_Z28test_std_writer_empty_appendv.cold, @function
+_Z28test_std_writer_empty_appendv.cold:
+.LFSB6900:
+.L298:
+	.cfi_def_cfa_offset 192
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC15(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB15:
+	call	__cxa_throw@PLT
+.LEHE15:
+.L304:
+	movq	88(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L305
+	movq	96(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	104(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L305:
+	movq	%rbx, %rdi
+.LEHB16:
+	call	_Unwind_Resume@PLT
+.LEHE16:
+	.cfi_endproc
+.LFE6900:
+	.section	.gcc_except_table
+.LLSDAC6900:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6900-.LLSDACSBC6900
+.LLSDACSBC6900:
+	.uleb128 .LEHB15-.LCOLDB16
+	.uleb128 .LEHE15-.LEHB15
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB16-.LCOLDB16
+	.uleb128 .LEHE16-.LEHB16
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6900:
+	.section	.text.unlikely
+	.text
+	.size	_Z28test_std_writer_empty_appendv, .-_Z28test_std_writer_empty_appendv
+	.section	.text.unlikely
+	.size	_Z28test_std_writer_empty_appendv.cold, .-_Z28test_std_writer_empty_appendv.cold
+.LCOLDE16:
+	.text
+.LHOTE16:
+	.section	.rodata.str1.1
+.LC17:
+	.string	"n::std_writer tests"
+.LC18:
+	.string	"test_std_writer_policies"
+.LC19:
+	.string	"test_std_writer_large_writes"
+.LC20:
+	.string	"test_std_writer_threads"
+.LC21:
+	.string	"test_printf"
+.LC22:
+	.string	"test_printf_stdw"
+.LC23:
+	.string	"test_std_writer_empty_append"
+	.section	.text.unlikely
+.LCOLDB25:
+	.section	.text.startup,"ax",@progbits
+.LHOTB25:
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB6901:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6901
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$1600, %edi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 64
+.LEHB17:
+	call	_Znam@PLT
+.LEHE17:
+	movq	%rax, %rbx
+	leaq	1600(%rax), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L366:
+	movq	$0, (%rax)
+	addq	$16, %rax
+	movq	$0, -8(%rax)
+	cmpq	%rax, %rdx
+	jne	.L366
+	leaq	.LC17(%rip), %rax
+	movq	%rsp, %rdi
+	movq	%rbx, (%rsp)
+	movq	%rax, 16(%rsp)
+	leaq	.LC18(%rip), %rax
+	movq	%rax, (%rbx)
+	leaq	_Z24test_std_writer_policiesv(%rip), %rax
+	movq	%rax, 8(%rbx)
+	leaq	.LC19(%rip), %rax
+	movq	%rax, 16(%rbx)
+	leaq	_Z28test_std_writer_large_writesv(%rip), %rax
+	movq	%rax, 24(%rbx)
+	leaq	.LC20(%rip), %rax
+	movq	%rax, 32(%rbx)
+	leaq	_Z23test_std_writer_threadsv(%rip), %rax
+	movq	%rax, 40(%rbx)
+	leaq	.LC21(%rip), %rax
+	movq	%rax, 48(%rbx)
+	leaq	_Z11test_printfv(%rip), %rax
+	movq	%rax, 56(%rbx)
+	leaq	.LC22(%rip), %rax
+	movq	%rax, 64(%rbx)
+	leaq	_Z16test_printf_stdwv(%rip), %rax
+	movq	%rax, 72(%rbx)
+	leaq	.LC23(%rip), %rax
+	movq	%rax, 80(%rbx)
+	leaq	_Z28test_std_writer_empty_appendv(%rip), %rax
+	movq	%rax, 88(%rbx)
+	movq	.LC24(%rip), %rax
+	movq	%rax, 8(%rsp)
+.LEHB18:
+	call	_ZN1n4test10test_suite7run_allEv
+.LEHE18:
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L368:
+	.cfi_restore_state
+	movq	%rax, %rbp
+	jmp	.L367
+	.section	.gcc_except_table
+.LLSDA6901:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6901-.LLSDACSB6901
+.LLSDACSB6901:
+	.uleb128 .LEHB17-.LFB6901
+	.uleb128 .LEHE17-.LEHB17
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB18-.LFB6901
+	.uleb128 .LEHE18-.LEHB18
+	.uleb128 .L368-.LFB6901
+	.uleb128 0
+.LLSDACSE6901:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6901
+	.type	main.cold, @function
+main.cold:
+.LFSB6901:
+.L367:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	movq	%rbx, %rdi
+	call	_ZdaPv@PLT
+	movq	%rbp, %rdi
+.LEHB19:
+	call	_Unwind_Resume@PLT
+.LEHE19:
+	.cfi_endproc
+.LFE6901:
+	.section	.gcc_except_table
+.LLSDAC6901:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6901-.LLSDACSBC6901
+.LLSDACSBC6901:
+	.uleb128 .LEHB19-.LCOLDB25
+	.uleb128 .LEHE19-.LEHB19
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6901:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	main, .-main
+	.section	.text.unlikely
+	.size	main.cold, .-main.cold
+.LCOLDE25:
+	.section	.text.startup
+.LHOTE25:
+	.text
+	.p2align 4
+	.type	__tls_init, @function
+__tls_init:
+.LFB7026:
+	.cfi_startproc
+	cmpb	$0, %fs:__tls_guard@tpoff
+	je	.L382
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L382:
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	cmpb	$0, %fs:_ZGVN1n10std_writerILi9EE7__localE@tpoff
+	movb	$1, %fs:__tls_guard@tpoff
+	je	.L383
+	cmpb	$0, %fs:_ZGVN1n10std_writerILi1EE7__localE@tpoff
+	je	.L384
+.L373:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L384:
+	.cfi_restore_state
+	movq	%fs:0, %rax
+	leaq	__dso_handle(%rip), %rdx
+	movb	$1, %fs:_ZGVN1n10std_writerILi1EE7__localE@tpoff
+	leaq	_ZN1n10std_writerILi1EE8__bufferD1Ev(%rip), %rdi
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	leaq	_ZN1n10std_writerILi1EE7__localE@tpoff(%rax), %rsi
+	jmp	__cxa_thread_atexit@PLT
+	.p2align 4,,10
+	.p2align 3
+.L383:
+	.cfi_restore_state
+	movq	%fs:0, %rax
+	leaq	__dso_handle(%rip), %rdx
+	movb	$1, %fs:_ZGVN1n10std_writerILi9EE7__localE@tpoff
+	leaq	_ZN1n10std_writerILi9EE8__bufferD1Ev(%rip), %rdi
+	leaq	_ZN1n10std_writerILi9EE7__localE@tpoff(%rax), %rsi
+	call	__cxa_thread_atexit@PLT
+	cmpb	$0, %fs:_ZGVN1n10std_writerILi1EE7__localE@tpoff
+	jne	.L373
+	jmp	.L384
+	.cfi_endproc
+.LFE7026:
+	.size	__tls_init, .-__tls_init
+	.weak	_ZTHN1n10std_writerILi1EE7__localE
+	.set	_ZTHN1n10std_writerILi1EE7__localE,__tls_init
+	.weak	_ZTHN1n10std_writerILi9EE7__localE
+	.set	_ZTHN1n10std_writerILi9EE7__localE,__tls_init
+	.section	.text._ZN1n10std_writerILi9EE5batchD2Ev,"axG",@progbits,_ZN1n10std_writerILi9EE5batchD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n10std_writerILi9EE5batchD2Ev
+	.type	_ZN1n10std_writerILi9EE5batchD2Ev, @function
+_ZN1n10std_writerILi9EE5batchD2Ev:
+.LFB6937:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6937
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	call	_ZTHN1n10std_writerILi9EE7__localE
+	subq	$1, %fs:24+_ZN1n10std_writerILi9EE7__localE@tpoff
+	je	.L404
+.L385:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L404:
+	.cfi_restore_state
+	movl	_ZN1n10std_writerILi9EE8__policyE(%rip), %eax
+	cmpl	$2, %eax
+	je	.L388
+	cmpl	$1, %eax
+	jne	.L385
+	cmpb	$0, %fs:32+_ZN1n10std_writerILi9EE7__localE@tpoff
+	je	.L385
+.L388:
+	movq	%fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff, %rbx
+	testq	%rbx, %rbx
+	jne	.L405
+.L390:
+	movq	$0, %fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff
+	movb	$0, %fs:32+_ZN1n10std_writerILi9EE7__localE@tpoff
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L405:
+	.cfi_restore_state
+	movq	%fs:_ZN1n10std_writerILi9EE7__localE@tpoff, %rbp
+.L393:
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movl	$9, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L406
+	addq	%rax, %rbp
+	subq	%rax, %rbx
+	jne	.L393
+	jmp	.L390
+	.p2align 4,,10
+	.p2align 3
+.L406:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L390
+	jmp	.L393
+	.cfi_endproc
+.LFE6937:
+	.section	.gcc_except_table
+.LLSDA6937:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6937-.LLSDACSB6937
+.LLSDACSB6937:
+.LLSDACSE6937:
+	.section	.text._ZN1n10std_writerILi9EE5batchD2Ev,"axG",@progbits,_ZN1n10std_writerILi9EE5batchD5Ev,comdat
+	.size	_ZN1n10std_writerILi9EE5batchD2Ev, .-_ZN1n10std_writerILi9EE5batchD2Ev
+	.weak	_ZN1n10std_writerILi9EE5batchD1Ev
+	.set	_ZN1n10std_writerILi9EE5batchD1Ev,_ZN1n10std_writerILi9EE5batchD2Ev
+	.text
+	.p2align 4
+	.globl	_Z11write_linesPv
+	.type	_Z11write_linesPv, @function
+_Z11write_linesPv:
+.LFB6895:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movl	$1000, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	leaq	_ZN1n10std_writerILi9EE7__localE@tpoff, %rbx
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movsbl	(%rdi), %eax
+	leaq	16(%rsp), %rbp
+	movd	%eax, %xmm0
+	punpcklbw	%xmm0, %xmm0
+	punpcklwd	%xmm0, %xmm0
+	pshufd	$0, %xmm0, %xmm7
+	movaps	%xmm7, (%rsp)
+	jmp	.L448
+	.p2align 4,,10
+	.p2align 3
+.L487:
+	movl	_ZN1n10std_writerILi9EE8__policyE(%rip), %edx
+	cmpl	$3, %edx
+	je	.L481
+	movq	%rax, %r14
+	testq	%rax, %rax
+	jne	.L423
+.L428:
+	movq	%fs:16(%rbx), %r14
+	movb	$0, %fs:32(%rbx)
+	movq	$0, %fs:8(%rbx)
+	cmpq	$65535, %r14
+	ja	.L424
+	testq	%r14, %r14
+	jne	.L431
+	movl	$65536, %r14d
+.L430:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L482
+.L433:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%r14, %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%fs:(%rbx), %rsi
+	movq	%rax, %r15
+	testq	%rsi, %rsi
+	je	.L435
+	movq	%fs:8(%rbx), %rdx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L483
+.L437:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%fs:16(%rbx), %rdx
+	movl	$64, %ecx
+	movq	%fs:(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	%r15, %fs:(%rbx)
+	movq	%r14, %fs:16(%rbx)
+.L424:
+	movq	%fs:8(%rbx), %rax
+	movq	%fs:(%rbx), %r15
+	leaq	65(%rax), %rdx
+.L411:
+	movdqa	16(%rsp), %xmm6
+	movups	%xmm6, (%r15,%rax)
+	movdqa	32(%rsp), %xmm7
+	movups	%xmm7, 16(%r15,%rax)
+	movdqa	48(%rsp), %xmm0
+	movups	%xmm0, 32(%r15,%rax)
+	movdqa	64(%rsp), %xmm6
+	movups	%xmm6, 48(%r15,%rax)
+	movzbl	80(%rsp), %ecx
+	movb	%cl, 64(%r15,%rax)
+	movzbl	%fs:32(%rbx), %eax
+	movq	%rdx, %fs:8(%rbx)
+	testb	%al, %al
+	je	.L484
+.L440:
+	cmpq	$0, %fs:24(%rbx)
+	movb	%al, %fs:32(%rbx)
+	jne	.L439
+	movl	_ZN1n10std_writerILi9EE8__policyE(%rip), %eax
+	cmpl	$2, %eax
+	je	.L442
+	cmpl	$1, %eax
+	je	.L485
+.L439:
+	subl	$1, %r12d
+	je	.L486
+.L448:
+	movdqa	(%rsp), %xmm1
+	movaps	%xmm1, 16(%rbp)
+	movaps	%xmm1, 32(%rbp)
+	movaps	%xmm1, 48(%rbp)
+	movaps	%xmm1, 0(%rbp)
+	movb	$10, 80(%rsp)
+	call	_ZTHN1n10std_writerILi9EE7__localE
+	movq	%fs:16(%rbx), %r8
+	movq	%fs:8(%rbx), %rax
+	movq	%r8, %rdx
+	subq	%rax, %rdx
+	cmpq	$64, %rdx
+	jbe	.L487
+	movq	%fs:(%rbx), %r15
+	leaq	65(%rax), %rdx
+	jmp	.L411
+	.p2align 4,,10
+	.p2align 3
+.L431:
+	addq	%r14, %r14
+	cmpq	$65535, %r14
+	ja	.L430
+	addq	%r14, %r14
+	cmpq	$65535, %r14
+	jbe	.L431
+	jmp	.L430
+	.p2align 4,,10
+	.p2align 3
+.L484:
+	movl	_ZN1n10std_writerILi9EE8__policyE(%rip), %edx
+	cmpl	$1, %edx
+	jne	.L440
+	movl	$65, %edx
+	movl	$10, %esi
+	movq	%rbp, %rdi
+	call	memchr@PLT
+	testq	%rax, %rax
+	setne	%al
+	jmp	.L440
+	.p2align 4,,10
+	.p2align 3
+.L481:
+	leaq	65(%rax), %rdx
+	movq	%r8, %r14
+	cmpq	%rdx, %r8
+	jnb	.L488
+	testq	%r8, %r8
+	jne	.L413
+	movl	$65536, %r14d
+	cmpq	$65536, %rdx
+	jbe	.L414
+	.p2align 4,,10
+	.p2align 3
+.L413:
+	addq	%r14, %r14
+	cmpq	%rdx, %r14
+	jb	.L413
+.L414:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L489
+.L417:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%r14, %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%fs:(%rbx), %rsi
+	movq	%rax, %r15
+	testq	%rsi, %rsi
+	je	.L419
+	movq	%fs:8(%rbx), %rdx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L490
+.L421:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%fs:16(%rbx), %rdx
+	movl	$64, %ecx
+	movq	%fs:(%rbx), %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L419:
+	movq	%fs:8(%rbx), %rax
+	movq	%r15, %fs:(%rbx)
+	movq	%r14, %fs:16(%rbx)
+	leaq	65(%rax), %rdx
+	jmp	.L411
+	.p2align 4,,10
+	.p2align 3
+.L485:
+	cmpb	$0, %fs:32(%rbx)
+	je	.L439
+.L442:
+	movq	%fs:8(%rbx), %r14
+	testq	%r14, %r14
+	jne	.L443
+.L446:
+	movq	$0, %fs:8(%rbx)
+	movb	$0, %fs:32(%rbx)
+	subl	$1, %r12d
+	jne	.L448
+.L486:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L423:
+	.cfi_restore_state
+	movq	%fs:(%rbx), %r15
+.L429:
+	movq	%r14, %rdx
+	movq	%r15, %rsi
+	movl	$9, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L491
+	addq	%rax, %r15
+	subq	%rax, %r14
+	jne	.L429
+	jmp	.L428
+	.p2align 4,,10
+	.p2align 3
+.L491:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L428
+	jmp	.L429
+	.p2align 4,,10
+	.p2align 3
+.L435:
+	movq	%rax, %fs:(%rbx)
+	movq	%r14, %fs:16(%rbx)
+	jmp	.L424
+	.p2align 4,,10
+	.p2align 3
+.L482:
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L433
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r13, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L433
+	.p2align 4,,10
+	.p2align 3
+.L488:
+	movq	%fs:(%rbx), %r15
+	jmp	.L411
+	.p2align 4,,10
+	.p2align 3
+.L443:
+	movq	%fs:(%rbx), %r15
+.L447:
+	movq	%r14, %rdx
+	movq	%r15, %rsi
+	movl	$9, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L492
+	addq	%rax, %r15
+	subq	%rax, %r14
+	jne	.L447
+	jmp	.L446
+	.p2align 4,,10
+	.p2align 3
+.L492:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L446
+	jmp	.L447
+	.p2align 4,,10
+	.p2align 3
+.L483:
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L437
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r13, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L437
+	.p2align 4,,10
+	.p2align 3
+.L489:
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L417
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r13, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L417
+.L490:
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L421
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r13, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L421
+	.cfi_endproc
+.LFE6895:
+	.size	_Z11write_linesPv, .-_Z11write_linesPv
+	.align 2
+	.p2align 4
+	.type	_ZN1n10std_writerILi9EE6appendEPKcm.constprop.1, @function
+_ZN1n10std_writerILi9EE6appendEPKcm.constprop.1:
+.LFB7054:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	call	_ZTHN1n10std_writerILi9EE7__localE
+	testq	%rbp, %rbp
+	je	.L493
+	movq	%fs:16+_ZN1n10std_writerILi9EE7__localE@tpoff, %rbx
+	movq	%fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff, %rax
+	movq	%rbx, %rdx
+	subq	%rax, %rdx
+	cmpq	%rbp, %rdx
+	jb	.L576
+.L496:
+	movq	%fs:_ZN1n10std_writerILi9EE7__localE@tpoff, %r13
+.L499:
+	leaq	0(%r13,%rax), %rdi
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	call	memcpy@PLT
+	movq	%fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff, %rbx
+	movzbl	%fs:32+_ZN1n10std_writerILi9EE7__localE@tpoff, %eax
+	addq	%rbp, %rbx
+	movq	%rbx, %fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff
+	testb	%al, %al
+	je	.L577
+.L531:
+	cmpq	$0, %fs:24+_ZN1n10std_writerILi9EE7__localE@tpoff
+	movb	%al, %fs:32+_ZN1n10std_writerILi9EE7__localE@tpoff
+	jne	.L493
+	movl	_ZN1n10std_writerILi9EE8__policyE(%rip), %eax
+	cmpl	$2, %eax
+	je	.L532
+	cmpl	$1, %eax
+	je	.L578
+.L493:
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L576:
+	.cfi_restore_state
+	movl	_ZN1n10std_writerILi9EE8__policyE(%rip), %edx
+	cmpl	$3, %edx
+	je	.L579
+	movq	%rax, %r13
+	testq	%rax, %rax
+	jne	.L511
+.L516:
+	movq	$0, %fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff
+	movb	$0, %fs:32+_ZN1n10std_writerILi9EE7__localE@tpoff
+	cmpq	$65535, %rbx
+	ja	.L512
+	testq	%rbx, %rbx
+	jne	.L519
+	movl	$65536, %ebx
+.L518:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L580
+.L521:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%rbx, %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%fs:_ZN1n10std_writerILi9EE7__localE@tpoff, %rsi
+	movq	%rax, %r13
+	testq	%rsi, %rsi
+	je	.L523
+	movq	%fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff, %rdx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L581
+.L525:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$64, %ecx
+	movq	%fs:16+_ZN1n10std_writerILi9EE7__localE@tpoff, %rdx
+	movq	%fs:_ZN1n10std_writerILi9EE7__localE@tpoff, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L523:
+	movq	%r13, %fs:_ZN1n10std_writerILi9EE7__localE@tpoff
+	movq	%rbx, %fs:16+_ZN1n10std_writerILi9EE7__localE@tpoff
+.L512:
+	cmpq	%rbx, %rbp
+	jnb	.L527
+	movq	%fs:_ZN1n10std_writerILi9EE7__localE@tpoff, %r13
+	movq	%fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff, %rax
+	jmp	.L499
+	.p2align 4,,10
+	.p2align 3
+.L577:
+	movl	_ZN1n10std_writerILi9EE8__policyE(%rip), %edx
+	cmpl	$1, %edx
+	jne	.L531
+	movq	%rbp, %rdx
+	movl	$10, %esi
+	movq	%r12, %rdi
+	call	memchr@PLT
+	testq	%rax, %rax
+	setne	%al
+	jmp	.L531
+	.p2align 4,,10
+	.p2align 3
+.L519:
+	addq	%rbx, %rbx
+	cmpq	$65535, %rbx
+	ja	.L518
+	addq	%rbx, %rbx
+	cmpq	$65535, %rbx
+	jbe	.L519
+	jmp	.L518
+	.p2align 4,,10
+	.p2align 3
+.L578:
+	cmpb	$0, %fs:32+_ZN1n10std_writerILi9EE7__localE@tpoff
+	je	.L493
+.L532:
+	testq	%rbx, %rbx
+	jne	.L533
+.L536:
+	movq	$0, %fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff
+	movb	$0, %fs:32+_ZN1n10std_writerILi9EE7__localE@tpoff
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L582:
+	.cfi_restore_state
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L493
+	.p2align 4,,10
+	.p2align 3
+.L527:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	$9, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L582
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L527
+	jmp	.L493
+	.p2align 4,,10
+	.p2align 3
+.L511:
+	movq	%fs:_ZN1n10std_writerILi9EE7__localE@tpoff, %rbx
+.L517:
+	movq	%r13, %rdx
+	movq	%rbx, %rsi
+	movl	$9, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L583
+	addq	%rax, %rbx
+	subq	%rax, %r13
+	jne	.L517
+	.p2align 4,,10
+	.p2align 3
+.L574:
+	movq	%fs:16+_ZN1n10std_writerILi9EE7__localE@tpoff, %rbx
+	jmp	.L516
+	.p2align 4,,10
+	.p2align 3
+.L579:
+	leaq	0(%rbp,%rax), %rdx
+	cmpq	%rdx, %rbx
+	jnb	.L496
+	testq	%rbx, %rbx
+	je	.L500
+	.p2align 4,,10
+	.p2align 3
+.L501:
+	addq	%rbx, %rbx
+	cmpq	%rdx, %rbx
+	jb	.L501
+.L502:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L584
+.L505:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%rbx, %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%fs:_ZN1n10std_writerILi9EE7__localE@tpoff, %rsi
+	movq	%rax, %r13
+	testq	%rsi, %rsi
+	je	.L507
+	movq	%fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff, %rdx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L585
+.L509:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$64, %ecx
+	movq	%fs:16+_ZN1n10std_writerILi9EE7__localE@tpoff, %rdx
+	movq	%fs:_ZN1n10std_writerILi9EE7__localE@tpoff, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L507:
+	movq	%r13, %fs:_ZN1n10std_writerILi9EE7__localE@tpoff
+	movq	%fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff, %rax
+	movq	%rbx, %fs:16+_ZN1n10std_writerILi9EE7__localE@tpoff
+	jmp	.L499
+	.p2align 4,,10
+	.p2align 3
+.L583:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L574
+	jmp	.L517
+	.p2align 4,,10
+	.p2align 3
+.L500:
+	movl	$65536, %ebx
+	cmpq	$65536, %rdx
+	ja	.L501
+	jmp	.L502
+	.p2align 4,,10
+	.p2align 3
+.L584:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L505
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r13, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L505
+	.p2align 4,,10
+	.p2align 3
+.L580:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L521
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r13, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L521
+	.p2align 4,,10
+	.p2align 3
+.L533:
+	movq	%fs:_ZN1n10std_writerILi9EE7__localE@tpoff, %rbp
+.L537:
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movl	$9, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L586
+	addq	%rax, %rbp
+	subq	%rax, %rbx
+	jne	.L537
+	jmp	.L536
+	.p2align 4,,10
+	.p2align 3
+.L586:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L536
+	jmp	.L537
+	.p2align 4,,10
+	.p2align 3
+.L581:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r14
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L525
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r14, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L525
+.L585:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r14
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L509
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r14, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L509
+	.cfi_endproc
+.LFE7054:
+	.size	_ZN1n10std_writerILi9EE6appendEPKcm.constprop.1, .-_ZN1n10std_writerILi9EE6appendEPKcm.constprop.1
+	.section	.rodata.str1.1
+.LC26:
+	.string	"head"
+	.section	.rodata.str1.8
+	.align 8
+.LC27:
+	.string	"expected equal : expected value : written().len(), actual value : 100004"
+	.align 8
+.LC28:
+	.string	"expected equal : expected value : written().len(), actual value : 300004"
+	.section	.text.unlikely
+.LCOLDB29:
+	.text
+.LHOTB29:
+	.p2align 4
+	.globl	_Z28test_std_writer_large_writesv
+	.type	_Z28test_std_writer_large_writesv, @function
+_Z28test_std_writer_large_writesv:
+.LFB6891:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6891
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	movl	$438, %edx
+	movl	$577, %esi
+	xorl	%eax, %eax
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movl	$23, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	subq	$96, %rsp
+	.cfi_def_cfa_offset 144
+	movq	path(%rip), %rdi
+.LEHB20:
+	call	open@PLT
+	movl	$9, %esi
+	movl	%eax, %ebx
+	movl	%eax, %edi
+	call	dup2@PLT
+	movl	%ebx, %edi
+	call	close@PLT
+.LEHE20:
+	movdqa	.LC9(%rip), %xmm0
+	xorl	%edx, %edx
+	movaps	%xmm0, (%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L658
+.L588:
+	pxor	%xmm0, %xmm0
+	movq	%rax, 16(%rsp)
+	xorl	%ebx, %ebx
+	leaq	24(%rsp), %r12
+	movq	$0, 40(%rsp)
+	movups	%xmm0, 24(%rsp)
+	jmp	.L598
+	.p2align 4,,10
+	.p2align 3
+.L660:
+	movq	24(%rsp), %rcx
+	addl	$1, %ebx
+	movb	%r13b, (%rcx,%rdx)
+	movq	(%rsp), %rax
+	leaq	1(%rax), %rdx
+	movq	%rdx, (%rsp)
+	movb	$0, 1(%rcx,%rax)
+	cmpl	$100000, %ebx
+	je	.L597
+.L596:
+	movq	(%rsp), %rdx
+	movq	8(%rsp), %rbp
+.L598:
+	movl	%ebx, %eax
+	movl	%ebx, %ecx
+	imulq	$1321528399, %rax, %rax
+	shrq	$35, %rax
+	imull	$26, %eax, %eax
+	subl	%eax, %ecx
+	leal	97(%rcx), %r13d
+	cmpq	%rbp, %rdx
+	je	.L659
+.L592:
+	cmpq	$23, %rbp
+	jne	.L660
+	movb	%r13b, 24(%rsp,%rdx)
+	movq	(%rsp), %rax
+	addl	$1, %ebx
+	addq	$1, %rax
+	movq	%rax, (%rsp)
+	movb	$0, 24(%rsp,%rax)
+	cmpl	$100000, %ebx
+	jne	.L596
+.L597:
+	movl	$0, _ZN1n10std_writerILi9EE8__policyE(%rip)
+	movl	$4, %esi
+	leaq	.LC26(%rip), %rdi
+.LEHB21:
+	call	_ZN1n10std_writerILi9EE6appendEPKcm.constprop.1
+	cmpq	$23, 8(%rsp)
+	movq	(%rsp), %rsi
+	leaq	24(%rsp), %rdi
+	je	.L599
+	movq	24(%rsp), %rdi
+.L599:
+	call	_ZN1n10std_writerILi9EE6appendEPKcm.constprop.1
+	leaq	48(%rsp), %rbp
+	movq	%rbp, %rdi
+	call	_Z7writtenv
+.LEHE21:
+	movq	56(%rsp), %rax
+	movq	48(%rsp), %rbx
+	cmpq	$23, %rax
+	je	.L600
+	movq	64(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	72(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L600:
+	cmpq	$100004, %rbx
+	jne	.L652
+	movl	$3, _ZN1n10std_writerILi9EE8__policyE(%rip)
+	leaq	24(%rsp), %rdi
+	cmpq	$23, 8(%rsp)
+	movq	(%rsp), %rsi
+	je	.L602
+	movq	24(%rsp), %rdi
+.L602:
+.LEHB22:
+	call	_ZN1n10std_writerILi9EE6appendEPKcm.constprop.1
+	cmpq	$23, 8(%rsp)
+	movq	(%rsp), %rsi
+	leaq	24(%rsp), %rdi
+	je	.L603
+	movq	24(%rsp), %rdi
+.L603:
+	call	_ZN1n10std_writerILi9EE6appendEPKcm.constprop.1
+	movq	%rbp, %rdi
+	call	_Z7writtenv
+.LEHE22:
+	movq	56(%rsp), %rax
+	movq	48(%rsp), %rbx
+	cmpq	$23, %rax
+	je	.L604
+	movq	64(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	72(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L604:
+	cmpq	$100004, %rbx
+	jne	.L653
+.LEHB23:
+	call	_ZTHN1n10std_writerILi9EE7__localE
+	movq	%fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff, %rbx
+	testq	%rbx, %rbx
+	jne	.L606
+.L610:
+	movq	$0, %fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff
+	movq	%rbp, %rdi
+	movb	$0, %fs:32+_ZN1n10std_writerILi9EE7__localE@tpoff
+	call	_Z7writtenv
+.LEHE23:
+	movq	56(%rsp), %rax
+	movq	48(%rsp), %rbx
+	cmpq	$23, %rax
+	je	.L612
+	movq	64(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	72(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L612:
+	cmpq	$300004, %rbx
+	jne	.L654
+	movl	$9, %edi
+.LEHB24:
+	call	close@PLT
+.LEHE24:
+	movq	path(%rip), %rdi
+	call	remove@PLT
+	movq	8(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L587
+	movq	16(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L587:
+	addq	$96, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L659:
+	.cfi_restore_state
+	leaq	1(%rbp), %rax
+	cmpq	%rax, %rbp
+	jnb	.L592
+	leaq	10(%rbp,%rbp), %rbp
+	movq	16(%rsp), %rdi
+	movl	$1, %edx
+	cmpq	%rax, %rbp
+	cmovb	%rax, %rbp
+	movq	(%rdi), %rax
+	leaq	1(%rbp), %rsi
+.LEHB25:
+	call	*16(%rax)
+	movq	%rax, %r14
+	movq	(%rsp), %rax
+	cmpq	$23, 8(%rsp)
+	movq	%r12, %rsi
+	leaq	1(%rax), %rdx
+	je	.L593
+	movq	24(%rsp), %rsi
+.L593:
+	movq	%r14, %rdi
+	call	memcpy@PLT
+	movq	8(%rsp), %rdx
+	cmpq	$23, %rdx
+	je	.L594
+	movq	16(%rsp), %rdi
+	movq	24(%rsp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L594:
+	movq	%r14, 24(%rsp)
+	movq	(%rsp), %rdx
+	movq	%rbp, 8(%rsp)
+	jmp	.L592
+.L606:
+	movq	%fs:_ZN1n10std_writerILi9EE7__localE@tpoff, %r12
+.L611:
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	movl	$9, %edi
+	call	write@PLT
+.LEHE25:
+	testq	%rax, %rax
+	js	.L661
+	addq	%rax, %r12
+	subq	%rax, %rbx
+	jne	.L611
+	jmp	.L610
+.L661:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L610
+	jmp	.L611
+.L658:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L662
+.L590:
+	movq	_ZZN1n4heapEvE3res(%rip), %rax
+	movq	(%rsp), %rdx
+	movq	8(%rsp), %rbp
+	jmp	.L588
+.L662:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L590
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L590
+.L650:
+	jmp	.L651
+	.section	.gcc_except_table
+.LLSDA6891:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6891-.LLSDACSB6891
+.LLSDACSB6891:
+	.uleb128 .LEHB20-.LFB6891
+	.uleb128 .LEHE20-.LEHB20
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB21-.LFB6891
+	.uleb128 .LEHE21-.LEHB21
+	.uleb128 .L650-.LFB6891
+	.uleb128 0
+	.uleb128 .LEHB22-.LFB6891
+	.uleb128 .LEHE22-.LEHB22
+	.uleb128 .L650-.LFB6891
+	.uleb128 0
+	.uleb128 .LEHB23-.LFB6891
+	.uleb128 .LEHE23-.LEHB23
+	.uleb128 .L650-.LFB6891
+	.uleb128 0
+	.uleb128 .LEHB24-.LFB6891
+	.uleb128 .LEHE24-.LEHB24
+	.uleb128 .L650-.LFB6891
+	.uleb128 0
+	.uleb128 .LEHB25-.LFB6891
+	.uleb128 .LEHE25-.LEHB25
+	.uleb128 .L650-.LFB6891
+	.uleb128 0
+.LLSDACSE6891:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6891
+	.type	_Z28test_std_writer_large_writesv.cold, @function
+_Z28test_std_writer_large_writesv.cold:
+.LFSB6891:
+.L653:
+	.cfi_def_cfa_offset 144
+	.cfi_offset 3, -48
+	.cfi_offset 6, -40
+	.cfi_offset 12, -32
+	.cfi_offset 13, -24
+	.cfi_offset 14, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC27(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB26:
+	call	__cxa_throw@PLT
+.L654:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC28(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE26:
+.L622:
+.L651:
+	movq	%rax, %rbx
+	movq	8(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L616
+	movq	16(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	24(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L616:
+	movq	%rbx, %rdi
+.LEHB27:
+	call	_Unwind_Resume@PLT
+.LEHE27:
+.L652:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC27(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB28:
+	call	__cxa_throw@PLT
+.LEHE28:
+	.cfi_endproc
+.LFE6891:
+	.section	.gcc_except_table
+.LLSDAC6891:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6891-.LLSDACSBC6891
+.LLSDACSBC6891:
+	.uleb128 .LEHB26-.LCOLDB29
+	.uleb128 .LEHE26-.LEHB26
+	.uleb128 .L622-.LCOLDB29
+	.uleb128 0
+	.uleb128 .LEHB27-.LCOLDB29
+	.uleb128 .LEHE27-.LEHB27
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB28-.LCOLDB29
+	.uleb128 .LEHE28-.LEHB28
+	.uleb128 .L622-.LCOLDB29
+	.uleb128 0
+.LLSDACSEC6891:
+	.section	.text.unlikely
+	.text
+	.size	_Z28test_std_writer_large_writesv, .-_Z28test_std_writer_large_writesv
+	.section	.text.unlikely
+	.size	_Z28test_std_writer_large_writesv.cold, .-_Z28test_std_writer_large_writesv.cold
+.LCOLDE29:
+	.text
+.LHOTE29:
+	.section	.rodata.str1.1
+.LC30:
+	.string	"no newline\na\nb\nx\n"
+.LC31:
+	.string	"no newline"
+	.section	.rodata.str1.8
+	.align 8
+.LC32:
+	.string	"expected equal : expected value : written().len(), actual value : 0"
+	.align 8
+.LC33:
+	.string	"expected equal : expected value : written().len(), actual value : 11"
+	.section	.rodata.str1.1
+.LC34:
+	.string	"a\nb"
+	.section	.rodata.str1.8
+	.align 8
+.LC35:
+	.string	"expected equal : expected value : written().len(), actual value : 15"
+	.section	.rodata.str1.1
+.LC36:
+	.string	"x\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC37:
+	.string	"expected true : written() == n::str(\"no newline\\na\\nb\\nx\\n\")"
+	.align 8
+.LC38:
+	.string	"expected equal : expected value : written().len(), actual value : 18"
+	.section	.rodata.str1.1
+.LC39:
+	.string	"expected true : w.flush()"
+	.section	.text.unlikely
+.LCOLDB40:
+	.text
+.LHOTB40:
+	.p2align 4
+	.globl	_Z24test_std_writer_policiesv
+	.type	_Z24test_std_writer_policiesv, @function
+_Z24test_std_writer_policiesv:
+.LFB6889:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6889
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$438, %edx
+	movl	$577, %esi
+	xorl	%eax, %eax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$120, %rsp
+	.cfi_def_cfa_offset 176
+	movq	path(%rip), %rdi
+.LEHB29:
+	call	open@PLT
+	movl	$9, %esi
+	movl	%eax, %ebx
+	movl	%eax, %edi
+	call	dup2@PLT
+	movl	%ebx, %edi
+	leaq	64(%rsp), %rbx
+	call	close@PLT
+	movl	$10, %esi
+	leaq	.LC31(%rip), %rdi
+	movl	$1, _ZN1n10std_writerILi9EE8__policyE(%rip)
+	call	_ZN1n10std_writerILi9EE6appendEPKcm.constprop.1
+	movq	%rbx, %rdi
+	call	_Z7writtenv
+.LEHE29:
+	movq	72(%rsp), %rdx
+	movq	64(%rsp), %rbp
+	cmpq	$23, %rdx
+	je	.L664
+	movq	80(%rsp), %rdi
+	movq	88(%rsp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L664:
+	testq	%rbp, %rbp
+	jne	.L851
+	movb	$10, 64(%rsp)
+.LEHB30:
+	call	_ZTHN1n10std_writerILi9EE7__localE
+	movq	%fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff, %rax
+	cmpq	%fs:16+_ZN1n10std_writerILi9EE7__localE@tpoff, %rax
+	je	.L862
+	leaq	1(%rax), %rdx
+	movzbl	64(%rsp), %ecx
+	movq	%rdx, %fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff
+	movq	%fs:_ZN1n10std_writerILi9EE7__localE@tpoff, %rdx
+	movb	%cl, (%rdx,%rax)
+	movzbl	%fs:32+_ZN1n10std_writerILi9EE7__localE@tpoff, %eax
+	testb	%al, %al
+	je	.L863
+.L668:
+	cmpq	$0, %fs:24+_ZN1n10std_writerILi9EE7__localE@tpoff
+	movb	%al, %fs:32+_ZN1n10std_writerILi9EE7__localE@tpoff
+	je	.L864
+.L667:
+	movq	%rbx, %rdi
+	call	_Z7writtenv
+.LEHE30:
+	movq	72(%rsp), %rdx
+	movq	64(%rsp), %r12
+	cmpq	$23, %rdx
+	je	.L677
+	movq	80(%rsp), %rdi
+	movq	88(%rsp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L677:
+	cmpq	$11, %r12
+	jne	.L852
+.LEHB31:
+	call	_ZTHN1n10std_writerILi9EE7__localE
+.LEHE31:
+	movl	$3, %esi
+	addq	$1, %fs:24+_ZN1n10std_writerILi9EE7__localE@tpoff
+	leaq	.LC34(%rip), %rdi
+.LEHB32:
+	call	_ZN1n10std_writerILi9EE6appendEPKcm.constprop.1
+	movb	$10, 64(%rsp)
+	call	_ZTHN1n10std_writerILi9EE7__localE
+	movq	%fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff, %rax
+	cmpq	%fs:16+_ZN1n10std_writerILi9EE7__localE@tpoff, %rax
+	je	.L865
+	leaq	1(%rax), %rdx
+	movzbl	64(%rsp), %ecx
+	movq	%rdx, %fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff
+	movq	%fs:_ZN1n10std_writerILi9EE7__localE@tpoff, %rdx
+	movb	%cl, (%rdx,%rax)
+	movzbl	%fs:32+_ZN1n10std_writerILi9EE7__localE@tpoff, %eax
+	testb	%al, %al
+	je	.L866
+.L681:
+	cmpq	$0, %fs:24+_ZN1n10std_writerILi9EE7__localE@tpoff
+	movb	%al, %fs:32+_ZN1n10std_writerILi9EE7__localE@tpoff
+	je	.L867
+.L680:
+	movq	%rbx, %rdi
+	call	_Z7writtenv
+.LEHE32:
+	movq	72(%rsp), %rdx
+	movq	64(%rsp), %r12
+	cmpq	$23, %rdx
+	je	.L689
+	movq	80(%rsp), %rdi
+	movq	88(%rsp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L689:
+	cmpq	$11, %r12
+	jne	.L853
+	call	_ZTHN1n10std_writerILi9EE7__localE
+	subq	$1, %fs:24+_ZN1n10std_writerILi9EE7__localE@tpoff
+	je	.L868
+.L692:
+	movq	%rbx, %rdi
+.LEHB33:
+	call	_Z7writtenv
+.LEHE33:
+	movq	72(%rsp), %rdx
+	movq	64(%rsp), %r12
+	cmpq	$23, %rdx
+	je	.L700
+	movq	80(%rsp), %rdi
+	movq	88(%rsp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L700:
+	cmpq	$15, %r12
+	jne	.L854
+	movl	$0, _ZN1n10std_writerILi9EE8__policyE(%rip)
+	movl	$2, %esi
+	leaq	.LC36(%rip), %rdi
+.LEHB34:
+	call	_ZN1n10std_writerILi9EE6appendEPKcm.constprop.1
+	movq	%rbx, %rdi
+	call	_Z7writtenv
+.LEHE34:
+	movq	72(%rsp), %rdx
+	movq	64(%rsp), %r12
+	cmpq	$23, %rdx
+	je	.L702
+	movq	80(%rsp), %rdi
+	movq	88(%rsp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L702:
+	cmpq	$15, %r12
+	jne	.L855
+.LEHB35:
+	call	_ZTHN1n10std_writerILi9EE7__localE
+.LEHE35:
+	movq	%fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff, %r12
+	testq	%r12, %r12
+	jne	.L869
+.L704:
+	movdqa	.LC9(%rip), %xmm0
+	movb	$0, %fs:32+_ZN1n10std_writerILi9EE7__localE@tpoff
+	movaps	%xmm0, 64(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L710
+	pxor	%xmm0, %xmm0
+	leaq	88(%rsp), %r14
+	movq	%rax, 80(%rsp)
+	leaq	.LC30(%rip), %r13
+	movq	$0, 104(%rsp)
+	movups	%xmm0, 88(%rsp)
+	cmpq	%r14, %r13
+	jb	.L771
+.L858:
+	leaq	.LC30(%rip), %rsi
+.L861:
+	movq	%r14, %r12
+.L711:
+	leaq	(%r12,%rbp), %rdi
+	movl	$17, %edx
+	call	memmove@PLT
+	movq	64(%rsp), %rax
+	leaq	16(%rsp), %rdi
+	leaq	17(%rax), %rdx
+	movq	%rdx, 64(%rsp)
+	movb	$0, 17(%r12,%rax)
+.LEHB36:
+	call	_Z7writtenv
+.LEHE36:
+	movq	16(%rsp), %rdx
+	movq	24(%rsp), %r12
+	movq	72(%rsp), %rbp
+	cmpq	64(%rsp), %rdx
+	je	.L870
+	movq	40(%rsp), %r14
+	cmpq	$23, %r12
+	je	.L732
+.L739:
+	xorl	%r13d, %r13d
+.L733:
+	movq	32(%rsp), %rdi
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	$23, %rbp
+	je	.L741
+	movq	88(%rsp), %rsi
+.L735:
+	movq	80(%rsp), %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L741:
+	testb	%r13b, %r13b
+	je	.L736
+.L738:
+	movl	$2, _ZN1n10std_writerILi9EE8__policyE(%rip)
+	movb	$121, 64(%rsp)
+.LEHB37:
+	call	_ZTHN1n10std_writerILi9EE7__localE
+	movq	%fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff, %rax
+	cmpq	%fs:16+_ZN1n10std_writerILi9EE7__localE@tpoff, %rax
+	je	.L871
+	leaq	1(%rax), %rdx
+	movzbl	64(%rsp), %ecx
+	movq	%rdx, %fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff
+	movq	%fs:_ZN1n10std_writerILi9EE7__localE@tpoff, %rdx
+	movb	%cl, (%rdx,%rax)
+	movzbl	%fs:32+_ZN1n10std_writerILi9EE7__localE@tpoff, %eax
+	testb	%al, %al
+	jne	.L744
+	cmpb	$10, 64(%rsp)
+	sete	%al
+.L744:
+	cmpq	$0, %fs:24+_ZN1n10std_writerILi9EE7__localE@tpoff
+	movb	%al, %fs:32+_ZN1n10std_writerILi9EE7__localE@tpoff
+	jne	.L743
+	movl	_ZN1n10std_writerILi9EE8__policyE(%rip), %eax
+	cmpl	$2, %eax
+	je	.L746
+	cmpl	$1, %eax
+	je	.L872
+.L743:
+	movq	%rbx, %rdi
+	call	_Z7writtenv
+.LEHE37:
+	movq	72(%rsp), %rdx
+	movq	64(%rsp), %rbx
+	cmpq	$23, %rdx
+	je	.L753
+	movq	80(%rsp), %rdi
+	movq	88(%rsp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L753:
+	cmpq	$18, %rbx
+	jne	.L856
+	movl	$9, %edi
+.LEHB38:
+	call	close@PLT
+.LEHE38:
+	movq	path(%rip), %rdi
+	addq	$120, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	remove@PLT
+	.p2align 4,,10
+	.p2align 3
+.L866:
+	.cfi_restore_state
+	cmpb	$10, 64(%rsp)
+	sete	%al
+	jmp	.L681
+	.p2align 4,,10
+	.p2align 3
+.L863:
+	cmpb	$10, 64(%rsp)
+	sete	%al
+	jmp	.L668
+	.p2align 4,,10
+	.p2align 3
+.L864:
+	movl	_ZN1n10std_writerILi9EE8__policyE(%rip), %eax
+	cmpl	$2, %eax
+	je	.L670
+	cmpl	$1, %eax
+	jne	.L667
+	cmpb	$0, %fs:32+_ZN1n10std_writerILi9EE7__localE@tpoff
+	je	.L667
+.L670:
+	movq	%fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff, %r12
+	testq	%r12, %r12
+	jne	.L672
+.L675:
+	movq	$0, %fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff
+	movb	$0, %fs:32+_ZN1n10std_writerILi9EE7__localE@tpoff
+	jmp	.L667
+	.p2align 4,,10
+	.p2align 3
+.L867:
+	movl	_ZN1n10std_writerILi9EE8__policyE(%rip), %eax
+	cmpl	$2, %eax
+	je	.L683
+	cmpl	$1, %eax
+	jne	.L680
+	cmpb	$0, %fs:32+_ZN1n10std_writerILi9EE7__localE@tpoff
+	je	.L680
+.L683:
+	movq	%fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff, %r12
+	testq	%r12, %r12
+	jne	.L684
+.L687:
+	movq	$0, %fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff
+	movb	$0, %fs:32+_ZN1n10std_writerILi9EE7__localE@tpoff
+	jmp	.L680
+	.p2align 4,,10
+	.p2align 3
+.L868:
+	movl	_ZN1n10std_writerILi9EE8__policyE(%rip), %eax
+	cmpl	$2, %eax
+	je	.L693
+	cmpl	$1, %eax
+	jne	.L692
+	cmpb	$0, %fs:32+_ZN1n10std_writerILi9EE7__localE@tpoff
+	je	.L692
+.L693:
+	movq	%fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff, %r12
+	testq	%r12, %r12
+	jne	.L695
+.L698:
+	movq	$0, %fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff
+	movb	$0, %fs:32+_ZN1n10std_writerILi9EE7__localE@tpoff
+	jmp	.L692
+	.p2align 4,,10
+	.p2align 3
+.L870:
+	cmpq	$23, %rbp
+	je	.L873
+	movq	88(%rsp), %rsi
+	movq	%rsi, %rax
+	cmpq	$23, %r12
+	je	.L874
+	movq	40(%rsp), %r14
+	testq	%rdx, %rdx
+	jne	.L761
+	movq	32(%rsp), %rdi
+	movq	%r14, %rsi
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	88(%rsp), %rsi
+.L730:
+	movl	$1, %r13d
+	jmp	.L735
+	.p2align 4,,10
+	.p2align 3
+.L869:
+	movq	%fs:_ZN1n10std_writerILi9EE7__localE@tpoff, %r13
+.L709:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	$9, %edi
+.LEHB39:
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L875
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L709
+	movq	$0, %fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff
+	jmp	.L704
+	.p2align 4,,10
+	.p2align 3
+.L875:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	je	.L709
+	movb	$0, %fs:32+_ZN1n10std_writerILi9EE7__localE@tpoff
+	xorl	%eax, %eax
+	movl	$8, %edi
+	movq	%rax, %fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC39(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+	.p2align 4,,10
+	.p2align 3
+.L874:
+	testq	%rdx, %rdx
+	je	.L730
+.L727:
+	leaq	40(%rsp), %rdi
+	movq	%rax, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L737
+	.p2align 4,,10
+	.p2align 3
+.L732:
+	cmpq	$23, %rbp
+	je	.L736
+	movq	88(%rsp), %rsi
+	xorl	%r13d, %r13d
+	jmp	.L735
+	.p2align 4,,10
+	.p2align 3
+.L771:
+	movq	%r13, %rsi
+	jmp	.L861
+	.p2align 4,,10
+	.p2align 3
+.L710:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L876
+.L715:
+	movq	_ZZN1n4heapEvE3res(%rip), %r8
+	movq	64(%rsp), %rbp
+	pxor	%xmm0, %xmm0
+	xorl	%r14d, %r14d
+	movq	72(%rsp), %r15
+	movups	%xmm0, 88(%rsp)
+	leaq	.LC30(%rip), %r13
+	movq	%r8, 80(%rsp)
+	leaq	17(%rbp), %rax
+	movq	$0, 104(%rsp)
+	cmpq	$23, %r15
+	je	.L877
+.L717:
+	leaq	(%r14,%rbp), %rdx
+	cmpq	%rdx, %r13
+	jnb	.L878
+	subq	%r14, %r13
+	movq	%r13, 8(%rsp)
+	cmpq	%rax, %r15
+	jnb	.L768
+	leaq	10(%r15,%r15), %rdx
+	movq	%r8, %rdi
+	movq	%r8, (%rsp)
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %r13
+	movq	(%r8), %rax
+	call	*16(%rax)
+	leaq	1(%rbp), %rdx
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %r12
+	call	memcpy@PLT
+	cmpq	$23, %r15
+	je	.L721
+	movq	(%rsp), %r8
+	leaq	1(%r15), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	(%r8), %rax
+	movq	%r8, %rdi
+	call	*24(%rax)
+.L721:
+	movq	%r12, 88(%rsp)
+	movq	%r13, %r15
+	movq	%r13, 72(%rsp)
+.L720:
+	cmpq	$23, %r15
+	je	.L722
+	movq	8(%rsp), %rsi
+	addq	%r12, %rsi
+	jmp	.L711
+.L878:
+	cmpq	%rax, %r15
+	jnb	.L767
+	leaq	10(%r15,%r15), %rdx
+	movq	%r8, %rdi
+	movq	%r8, (%rsp)
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %r13
+	movq	(%r8), %rax
+	call	*16(%rax)
+	leaq	1(%rbp), %rdx
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %r12
+	call	memcpy@PLT
+	cmpq	$23, %r15
+	je	.L719
+	movq	(%rsp), %r8
+	leaq	1(%r15), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	(%r8), %rax
+	movq	%r8, %rdi
+	call	*24(%rax)
+.L719:
+	movq	%r12, 88(%rsp)
+	movq	%r13, 72(%rsp)
+.L713:
+	leaq	.LC30(%rip), %rsi
+	cmpq	$23, %r13
+	jne	.L711
+	leaq	88(%rsp), %r14
+	jmp	.L858
+	.p2align 4,,10
+	.p2align 3
+.L872:
+	cmpb	$0, %fs:32+_ZN1n10std_writerILi9EE7__localE@tpoff
+	je	.L743
+.L746:
+	movq	%fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff, %rbp
+	testq	%rbp, %rbp
+	jne	.L748
+.L751:
+	movq	$0, %fs:8+_ZN1n10std_writerILi9EE7__localE@tpoff
+	movb	$0, %fs:32+_ZN1n10std_writerILi9EE7__localE@tpoff
+	jmp	.L743
+	.p2align 4,,10
+	.p2align 3
+.L862:
+	movl	$1, %esi
+	movq	%rbx, %rdi
+	call	_ZN1n10std_writerILi9EE6appendEPKcm.constprop.1
+.LEHE39:
+	jmp	.L667
+	.p2align 4,,10
+	.p2align 3
+.L865:
+	movl	$1, %esi
+	movq	%rbx, %rdi
+.LEHB40:
+	call	_ZN1n10std_writerILi9EE6appendEPKcm.constprop.1
+.LEHE40:
+	jmp	.L680
+	.p2align 4,,10
+	.p2align 3
+.L873:
+	cmpq	$23, %r12
+	je	.L879
+	movq	40(%rsp), %r14
+	leaq	88(%rsp), %rax
+	testq	%rdx, %rdx
+	jne	.L761
+	movq	32(%rsp), %rdi
+	leaq	1(%r12), %rdx
+	movl	$1, %ecx
+	movq	%r14, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L738
+	.p2align 4,,10
+	.p2align 3
+.L761:
+	movq	%rax, %rsi
+	movq	%r14, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L880
+	cmpq	$23, %r12
+	je	.L737
+	movl	$1, %r13d
+	jmp	.L733
+	.p2align 4,,10
+	.p2align 3
+.L871:
+	movl	$1, %esi
+	movq	%rbx, %rdi
+.LEHB41:
+	call	_ZN1n10std_writerILi9EE6appendEPKcm.constprop.1
+.LEHE41:
+	jmp	.L743
+.L880:
+	cmpq	$23, %r12
+	jne	.L739
+	jmp	.L732
+.L876:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L715
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L715
+.L695:
+	movq	%fs:_ZN1n10std_writerILi9EE7__localE@tpoff, %r13
+.L699:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	$9, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L881
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L699
+	jmp	.L698
+.L881:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L698
+	jmp	.L699
+.L737:
+	cmpq	$23, %rbp
+	je	.L738
+	movq	88(%rsp), %rsi
+	jmp	.L730
+.L748:
+	movq	%fs:_ZN1n10std_writerILi9EE7__localE@tpoff, %r12
+.L752:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	$9, %edi
+.LEHB42:
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L882
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L752
+	jmp	.L751
+.L882:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L751
+	jmp	.L752
+.L672:
+	movq	%fs:_ZN1n10std_writerILi9EE7__localE@tpoff, %r13
+.L676:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	$9, %edi
+	call	write@PLT
+.LEHE42:
+	testq	%rax, %rax
+	js	.L883
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L676
+	jmp	.L675
+.L883:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L675
+	jmp	.L676
+.L684:
+	movq	%fs:_ZN1n10std_writerILi9EE7__localE@tpoff, %r13
+.L688:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movl	$9, %edi
+.LEHB43:
+	call	write@PLT
+.LEHE43:
+	testq	%rax, %rax
+	js	.L884
+	addq	%rax, %r13
+	subq	%rax, %r12
+	jne	.L688
+	jmp	.L687
+.L884:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L687
+	jmp	.L688
+.L879:
+	leaq	88(%rsp), %rax
+	testq	%rdx, %rdx
+	jne	.L727
+	jmp	.L738
+.L767:
+	xorl	%r12d, %r12d
+	movq	%r15, %r13
+	jmp	.L713
+.L768:
+	xorl	%r12d, %r12d
+	jmp	.L720
+.L722:
+	movq	8(%rsp), %rsi
+	leaq	88(%rsp), %r14
+	addq	%r14, %rsi
+	jmp	.L861
+.L877:
+	leaq	88(%rsp), %r14
+	cmpq	%r14, %r13
+	jnb	.L717
+	cmpq	$23, %rax
+	jbe	.L771
+	movl	$56, %edx
+	movq	%r8, %rdi
+	cmpq	%rdx, %rax
+	cmovnb	%rax, %rdx
+	movq	(%r8), %rax
+	leaq	1(%rdx), %rsi
+	movq	%rdx, %r15
+	movl	$1, %edx
+.LEHB44:
+	call	*16(%rax)
+.LEHE44:
+	movq	%r14, %rsi
+	leaq	1(%rbp), %rdx
+	movq	%rax, %r12
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	%r12, 88(%rsp)
+	movq	%r13, %rsi
+	movq	%r15, 72(%rsp)
+	jmp	.L711
+.L773:
+	movq	%rax, %rbx
+	jmp	.L756
+.L849:
+	jmp	.L850
+	.section	.gcc_except_table
+.LLSDA6889:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6889-.LLSDACSB6889
+.LLSDACSB6889:
+	.uleb128 .LEHB29-.LFB6889
+	.uleb128 .LEHE29-.LEHB29
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB30-.LFB6889
+	.uleb128 .LEHE30-.LEHB30
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB31-.LFB6889
+	.uleb128 .LEHE31-.LEHB31
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB32-.LFB6889
+	.uleb128 .LEHE32-.LEHB32
+	.uleb128 .L849-.LFB6889
+	.uleb128 0
+	.uleb128 .LEHB33-.LFB6889
+	.uleb128 .LEHE33-.LEHB33
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB34-.LFB6889
+	.uleb128 .LEHE34-.LEHB34
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB35-.LFB6889
+	.uleb128 .LEHE35-.LEHB35
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB36-.LFB6889
+	.uleb128 .LEHE36-.LEHB36
+	.uleb128 .L773-.LFB6889
+	.uleb128 0
+	.uleb128 .LEHB37-.LFB6889
+	.uleb128 .LEHE37-.LEHB37
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB38-.LFB6889
+	.uleb128 .LEHE38-.LEHB38
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB39-.LFB6889
+	.uleb128 .LEHE39-.LEHB39
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB40-.LFB6889
+	.uleb128 .LEHE40-.LEHB40
+	.uleb128 .L849-.LFB6889
+	.uleb128 0
+	.uleb128 .LEHB41-.LFB6889
+	.uleb128 .LEHE41-.LEHB41
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB42-.LFB6889
+	.uleb128 .LEHE42-.LEHB42
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB43-.LFB6889
+	.uleb128 .LEHE43-.LEHB43
+	.uleb128 .L849-.LFB6889
+	.uleb128 0
+	.uleb128 .LEHB44-.LFB6889
+	.uleb128 .LEHE44-.LEHB44
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6889:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6889
+	.type	_Z24test_std_writer_policiesv.cold, @function
+_Z24test_std_writer_policiesv.cold:
+.LFSB6889:
+.L854:
+	.cfi_def_cfa_offset 176
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC35(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB45:
+	call	__cxa_throw@PLT
+.L852:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC33(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L736:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC37(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L855:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC35(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE45:
+.L756:
+	movq	72(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L757
+	movq	80(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	88(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L757:
+	movq	%rbx, %rdi
+.LEHB46:
+	call	_Unwind_Resume@PLT
+.L851:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC32(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.L856:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC38(%rip), %rax
+	movq	%rax, (%rdi)
+	call	__cxa_throw@PLT
+.LEHE46:
+.L853:
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC33(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB47:
+	call	__cxa_throw@PLT
+.LEHE47:
+.L772:
+.L850:
+	movq	%rax, %rbx
+	leaq	16(%rsp), %rdi
+	call	_ZN1n10std_writerILi9EE5batchD1Ev
+	movq	%rbx, %rdi
+.LEHB48:
+	call	_Unwind_Resume@PLT
+.LEHE48:
+	.cfi_endproc
+.LFE6889:
+	.section	.gcc_except_table
+.LLSDAC6889:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6889-.LLSDACSBC6889
+.LLSDACSBC6889:
+	.uleb128 .LEHB45-.LCOLDB40
+	.uleb128 .LEHE45-.LEHB45
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB46-.LCOLDB40
+	.uleb128 .LEHE46-.LEHB46
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB47-.LCOLDB40
+	.uleb128 .LEHE47-.LEHB47
+	.uleb128 .L772-.LCOLDB40
+	.uleb128 0
+	.uleb128 .LEHB48-.LCOLDB40
+	.uleb128 .LEHE48-.LEHB48
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6889:
+	.section	.text.unlikely
+	.text
+	.size	_Z24test_std_writer_policiesv, .-_Z24test_std_writer_policiesv
+	.section	.text.unlikely
+	.size	_Z24test_std_writer_policiesv.cold, .-_Z24test_std_writer_policiesv.cold
+.LCOLDE40:
+	.text
+.LHOTE40:
+	.section	.text._ZN1n10std_writerILi1EE5batchD2Ev,"axG",@progbits,_ZN1n10std_writerILi1EE5batchD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN1n10std_writerILi1EE5batchD2Ev
+	.type	_ZN1n10std_writerILi1EE5batchD2Ev, @function
+_ZN1n10std_writerILi1EE5batchD2Ev:
+.LFB6977:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6977
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	call	_ZTHN1n10std_writerILi1EE7__localE
+	subq	$1, %fs:24+_ZN1n10std_writerILi1EE7__localE@tpoff
+	je	.L904
+.L885:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L904:
+	.cfi_restore_state
+	movl	_ZN1n10std_writerILi1EE8__policyE(%rip), %eax
+	cmpl	$2, %eax
+	je	.L888
+	cmpl	$1, %eax
+	jne	.L885
+	cmpb	$0, %fs:32+_ZN1n10std_writerILi1EE7__localE@tpoff
+	je	.L885
+.L888:
+	movq	%fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff, %rbx
+	testq	%rbx, %rbx
+	jne	.L905
+.L890:
+	movq	$0, %fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff
+	movb	$0, %fs:32+_ZN1n10std_writerILi1EE7__localE@tpoff
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L905:
+	.cfi_restore_state
+	movq	%fs:_ZN1n10std_writerILi1EE7__localE@tpoff, %rbp
+.L893:
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movl	$1, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L906
+	addq	%rax, %rbp
+	subq	%rax, %rbx
+	jne	.L893
+	jmp	.L890
+	.p2align 4,,10
+	.p2align 3
+.L906:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L890
+	jmp	.L893
+	.cfi_endproc
+.LFE6977:
+	.section	.gcc_except_table
+.LLSDA6977:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6977-.LLSDACSB6977
+.LLSDACSB6977:
+.LLSDACSE6977:
+	.section	.text._ZN1n10std_writerILi1EE5batchD2Ev,"axG",@progbits,_ZN1n10std_writerILi1EE5batchD5Ev,comdat
+	.size	_ZN1n10std_writerILi1EE5batchD2Ev, .-_ZN1n10std_writerILi1EE5batchD2Ev
+	.weak	_ZN1n10std_writerILi1EE5batchD1Ev
+	.set	_ZN1n10std_writerILi1EE5batchD1Ev,_ZN1n10std_writerILi1EE5batchD2Ev
+	.text
+	.align 2
+	.p2align 4
+	.type	_ZN1n10std_writerILi1EE6appendEPKcm.isra.0, @function
+_ZN1n10std_writerILi1EE6appendEPKcm.isra.0:
+.LFB7058:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	call	_ZTHN1n10std_writerILi1EE7__localE
+	testq	%rbp, %rbp
+	je	.L907
+	movq	%fs:16+_ZN1n10std_writerILi1EE7__localE@tpoff, %rbx
+	movq	%fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff, %rax
+	movq	%rbx, %rdx
+	subq	%rax, %rdx
+	cmpq	%rbp, %rdx
+	jb	.L990
+.L910:
+	movq	%fs:_ZN1n10std_writerILi1EE7__localE@tpoff, %r13
+.L913:
+	leaq	0(%r13,%rax), %rdi
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	call	memcpy@PLT
+	movq	%fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff, %rbx
+	movzbl	%fs:32+_ZN1n10std_writerILi1EE7__localE@tpoff, %eax
+	addq	%rbp, %rbx
+	movq	%rbx, %fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff
+	testb	%al, %al
+	je	.L991
+.L945:
+	cmpq	$0, %fs:24+_ZN1n10std_writerILi1EE7__localE@tpoff
+	movb	%al, %fs:32+_ZN1n10std_writerILi1EE7__localE@tpoff
+	jne	.L907
+	movl	_ZN1n10std_writerILi1EE8__policyE(%rip), %eax
+	cmpl	$2, %eax
+	je	.L946
+	cmpl	$1, %eax
+	je	.L992
+.L907:
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L990:
+	.cfi_restore_state
+	movl	_ZN1n10std_writerILi1EE8__policyE(%rip), %edx
+	cmpl	$3, %edx
+	je	.L993
+	movq	%rax, %r13
+	testq	%rax, %rax
+	jne	.L925
+.L930:
+	movq	$0, %fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff
+	movb	$0, %fs:32+_ZN1n10std_writerILi1EE7__localE@tpoff
+	cmpq	$65535, %rbx
+	ja	.L926
+	testq	%rbx, %rbx
+	jne	.L933
+	movl	$65536, %ebx
+.L932:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L994
+.L935:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%rbx, %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%fs:_ZN1n10std_writerILi1EE7__localE@tpoff, %rsi
+	movq	%rax, %r13
+	testq	%rsi, %rsi
+	je	.L937
+	movq	%fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff, %rdx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L995
+.L939:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$64, %ecx
+	movq	%fs:16+_ZN1n10std_writerILi1EE7__localE@tpoff, %rdx
+	movq	%fs:_ZN1n10std_writerILi1EE7__localE@tpoff, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L937:
+	movq	%r13, %fs:_ZN1n10std_writerILi1EE7__localE@tpoff
+	movq	%rbx, %fs:16+_ZN1n10std_writerILi1EE7__localE@tpoff
+.L926:
+	cmpq	%rbx, %rbp
+	jnb	.L941
+	movq	%fs:_ZN1n10std_writerILi1EE7__localE@tpoff, %r13
+	movq	%fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff, %rax
+	jmp	.L913
+	.p2align 4,,10
+	.p2align 3
+.L991:
+	movl	_ZN1n10std_writerILi1EE8__policyE(%rip), %edx
+	cmpl	$1, %edx
+	jne	.L945
+	movq	%rbp, %rdx
+	movl	$10, %esi
+	movq	%r12, %rdi
+	call	memchr@PLT
+	testq	%rax, %rax
+	setne	%al
+	jmp	.L945
+	.p2align 4,,10
+	.p2align 3
+.L933:
+	addq	%rbx, %rbx
+	cmpq	$65535, %rbx
+	ja	.L932
+	addq	%rbx, %rbx
+	cmpq	$65535, %rbx
+	jbe	.L933
+	jmp	.L932
+	.p2align 4,,10
+	.p2align 3
+.L992:
+	cmpb	$0, %fs:32+_ZN1n10std_writerILi1EE7__localE@tpoff
+	je	.L907
+.L946:
+	testq	%rbx, %rbx
+	jne	.L947
+.L950:
+	movq	$0, %fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff
+	movb	$0, %fs:32+_ZN1n10std_writerILi1EE7__localE@tpoff
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L996:
+	.cfi_restore_state
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L907
+	.p2align 4,,10
+	.p2align 3
+.L941:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	$1, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L996
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L941
+	jmp	.L907
+	.p2align 4,,10
+	.p2align 3
+.L925:
+	movq	%fs:_ZN1n10std_writerILi1EE7__localE@tpoff, %rbx
+.L931:
+	movq	%r13, %rdx
+	movq	%rbx, %rsi
+	movl	$1, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L997
+	addq	%rax, %rbx
+	subq	%rax, %r13
+	jne	.L931
+	.p2align 4,,10
+	.p2align 3
+.L988:
+	movq	%fs:16+_ZN1n10std_writerILi1EE7__localE@tpoff, %rbx
+	jmp	.L930
+	.p2align 4,,10
+	.p2align 3
+.L993:
+	leaq	0(%rbp,%rax), %rdx
+	cmpq	%rdx, %rbx
+	jnb	.L910
+	testq	%rbx, %rbx
+	je	.L914
+	.p2align 4,,10
+	.p2align 3
+.L915:
+	addq	%rbx, %rbx
+	cmpq	%rdx, %rbx
+	jb	.L915
+.L916:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L998
+.L919:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	%rbx, %rsi
+	movl	$64, %edx
+	movq	(%rdi), %rax
+	call	*16(%rax)
+	movq	%fs:_ZN1n10std_writerILi1EE7__localE@tpoff, %rsi
+	movq	%rax, %r13
+	testq	%rsi, %rsi
+	je	.L921
+	movq	%fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff, %rdx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L999
+.L923:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movl	$64, %ecx
+	movq	%fs:16+_ZN1n10std_writerILi1EE7__localE@tpoff, %rdx
+	movq	%fs:_ZN1n10std_writerILi1EE7__localE@tpoff, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L921:
+	movq	%r13, %fs:_ZN1n10std_writerILi1EE7__localE@tpoff
+	movq	%fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff, %rax
+	movq	%rbx, %fs:16+_ZN1n10std_writerILi1EE7__localE@tpoff
+	jmp	.L913
+	.p2align 4,,10
+	.p2align 3
+.L997:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L988
+	jmp	.L931
+	.p2align 4,,10
+	.p2align 3
+.L914:
+	movl	$65536, %ebx
+	cmpq	$65536, %rdx
+	ja	.L915
+	jmp	.L916
+	.p2align 4,,10
+	.p2align 3
+.L998:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L919
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r13, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L919
+	.p2align 4,,10
+	.p2align 3
+.L994:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r13
+	movq	%r13, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L935
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r13, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L935
+	.p2align 4,,10
+	.p2align 3
+.L947:
+	movq	%fs:_ZN1n10std_writerILi1EE7__localE@tpoff, %rbp
+.L951:
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movl	$1, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1000
+	addq	%rax, %rbp
+	subq	%rax, %rbx
+	jne	.L951
+	jmp	.L950
+	.p2align 4,,10
+	.p2align 3
+.L1000:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L950
+	jmp	.L951
+	.p2align 4,,10
+	.p2align 3
+.L995:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r14
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L939
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r14, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L939
+.L999:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %r14
+	movq	%r14, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L923
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%r14, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L923
+	.cfi_endproc
+.LFE7058:
+	.size	_ZN1n10std_writerILi1EE6appendEPKcm.isra.0, .-_ZN1n10std_writerILi1EE6appendEPKcm.isra.0
+	.section	.rodata.str1.1
+.LC41:
+	.string	"$."
+	.text
+	.p2align 4
+	.globl	_Z11empty_firstPv
+	.type	_Z11empty_firstPv, @function
+_Z11empty_firstPv:
+.LFB6899:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	leaq	.LC41(%rip), %rbx
+	subq	$56, %rsp
+	.cfi_def_cfa_offset 112
+	call	_ZTHN1n10std_writerILi1EE7__localE
+	movl	$36, %esi
+	movq	%rbx, %rdi
+	call	strchrnul@PLT
+	movq	%rax, %rsi
+	movq	%rax, %r12
+	movzbl	(%rax), %eax
+	subq	%rbx, %rsi
+	testb	%al, %al
+	jne	.L1002
+	jmp	.L1003
+	.p2align 4,,10
+	.p2align 3
+.L1005:
+	addq	$1, %rsi
+	movzbl	(%rbx,%rsi), %eax
+	testb	%al, %al
+	je	.L1004
+.L1002:
+	cmpb	$36, %al
+	jne	.L1005
+	leaq	1(%rbx,%rsi), %r12
+.L1003:
+	movq	%rbx, %rdi
+	leaq	16(%rsp), %r13
+	leaq	17(%rsp), %rbp
+	call	_ZN1n10std_writerILi1EE6appendEPKcm.isra.0
+	movb	$53, 16(%rsp)
+	leaq	_ZN1n10std_writerILi1EE7__localE@tpoff, %rbx
+	.p2align 4,,10
+	.p2align 3
+.L1007:
+	movzbl	-1(%rbp), %eax
+	movb	%al, 15(%rsp)
+	call	_ZTHN1n10std_writerILi1EE7__localE
+	movq	%fs:8(%rbx), %rax
+	cmpq	%fs:16(%rbx), %rax
+	je	.L1040
+	movzbl	15(%rsp), %ecx
+	movq	%fs:(%rbx), %rdx
+	leaq	1(%rax), %rsi
+	movq	%rsi, %fs:8(%rbx)
+	movb	%cl, (%rdx,%rax)
+	movzbl	%fs:32(%rbx), %eax
+	testb	%al, %al
+	jne	.L1009
+	cmpb	$10, 15(%rsp)
+	sete	%al
+.L1009:
+	cmpq	$0, %fs:24(%rbx)
+	movb	%al, %fs:32(%rbx)
+	jne	.L1008
+	movl	_ZN1n10std_writerILi1EE8__policyE(%rip), %eax
+	cmpl	$2, %eax
+	je	.L1011
+	cmpl	$1, %eax
+	je	.L1041
+.L1008:
+	subq	$1, %rbp
+	cmpq	%rbp, %r13
+	jne	.L1007
+	movq	$-1, %rsi
+	movq	%r12, %rdi
+	call	strnlen@PLT
+	movq	%r12, %rdi
+	movq	%rax, %rsi
+	call	_ZN1n10std_writerILi1EE6appendEPKcm.isra.0
+	call	_ZTHN1n10std_writerILi1EE7__localE
+	movq	%fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff, %rbx
+	testq	%rbx, %rbx
+	jne	.L1042
+.L1024:
+	movq	$0, %fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff
+	xorl	%eax, %eax
+	movb	$0, %fs:32+_ZN1n10std_writerILi1EE7__localE@tpoff
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1041:
+	.cfi_restore_state
+	cmpb	$0, %fs:32(%rbx)
+	je	.L1008
+.L1011:
+	movq	%fs:8(%rbx), %r15
+	testq	%r15, %r15
+	jne	.L1013
+.L1016:
+	movq	$0, %fs:8(%rbx)
+	movb	$0, %fs:32(%rbx)
+	jmp	.L1008
+	.p2align 4,,10
+	.p2align 3
+.L1040:
+	leaq	15(%rsp), %rdi
+	movl	$1, %esi
+	call	_ZN1n10std_writerILi1EE6appendEPKcm.isra.0
+	jmp	.L1008
+	.p2align 4,,10
+	.p2align 3
+.L1004:
+	leaq	(%rbx,%rsi), %r12
+	jmp	.L1003
+	.p2align 4,,10
+	.p2align 3
+.L1013:
+	movq	%fs:(%rbx), %r14
+.L1017:
+	movq	%r15, %rdx
+	movq	%r14, %rsi
+	movl	$1, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1043
+	addq	%rax, %r14
+	subq	%rax, %r15
+	jne	.L1017
+	jmp	.L1016
+	.p2align 4,,10
+	.p2align 3
+.L1043:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1016
+	jmp	.L1017
+	.p2align 4,,10
+	.p2align 3
+.L1042:
+	movq	%fs:_ZN1n10std_writerILi1EE7__localE@tpoff, %rbp
+.L1025:
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movl	$1, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1044
+	addq	%rax, %rbp
+	subq	%rax, %rbx
+	jne	.L1025
+	jmp	.L1024
+	.p2align 4,,10
+	.p2align 3
+.L1044:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1024
+	jmp	.L1025
+	.cfi_endproc
+.LFE6899:
+	.size	_Z11empty_firstPv, .-_Z11empty_firstPv
+	.section	.rodata._ZN1n6printfIJiEEEvNS_16cstring_iteratorIcEEDpRKT_.str1.1,"aMS",@progbits,1
+.LC42:
+	.string	"0123456789"
+	.section	.text._ZN1n6printfIJiEEEvNS_16cstring_iteratorIcEEDpRKT_,"axG",@progbits,_ZN1n6printfIJiEEEvNS_16cstring_iteratorIcEEDpRKT_,comdat
+	.p2align 4
+	.weak	_ZN1n6printfIJiEEEvNS_16cstring_iteratorIcEEDpRKT_
+	.type	_ZN1n6printfIJiEEEvNS_16cstring_iteratorIcEEDpRKT_, @function
+_ZN1n6printfIJiEEEvNS_16cstring_iteratorIcEEDpRKT_:
+.LFB6949:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6949
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$56, %rsp
+	.cfi_def_cfa_offset 112
+.LEHB49:
+	call	_ZTHN1n10std_writerILi1EE7__localE
+.LEHE49:
+	movl	$36, %esi
+	movq	%rbx, %rdi
+	addq	$1, %fs:24+_ZN1n10std_writerILi1EE7__localE@tpoff
+	call	strchrnul@PLT
+	movq	%rax, %rsi
+	movq	%rax, %r12
+	movzbl	(%rax), %eax
+	subq	%rbx, %rsi
+	testb	%al, %al
+	jne	.L1046
+	jmp	.L1047
+	.p2align 4,,10
+	.p2align 3
+.L1049:
+	addq	$1, %rsi
+	movzbl	(%rbx,%rsi), %eax
+	testb	%al, %al
+	je	.L1048
+.L1046:
+	cmpb	$36, %al
+	jne	.L1049
+	leaq	1(%rsi,%rbx), %r12
+.L1047:
+	movq	%rbx, %rdi
+	leaq	16(%rsp), %r13
+.LEHB50:
+	call	_ZN1n10std_writerILi1EE6appendEPKcm.isra.0
+	movl	0(%rbp), %edi
+	testl	%edi, %edi
+	jne	.L1051
+	movb	$48, 16(%rsp)
+	movl	$1, %ebp
+.L1052:
+	leaq	16(%rsp), %r13
+	leaq	_ZN1n10std_writerILi1EE7__localE@tpoff, %rbx
+	.p2align 4,,10
+	.p2align 3
+.L1066:
+	subq	$1, %rbp
+	movzbl	0(%r13,%rbp), %eax
+	movb	%al, 15(%rsp)
+	call	_ZTHN1n10std_writerILi1EE7__localE
+	movq	%fs:8(%rbx), %rax
+	cmpq	%fs:16(%rbx), %rax
+	je	.L1107
+	movzbl	15(%rsp), %ecx
+	movq	%fs:(%rbx), %rdx
+	leaq	1(%rax), %rsi
+	movq	%rsi, %fs:8(%rbx)
+	movb	%cl, (%rdx,%rax)
+	movzbl	%fs:32(%rbx), %eax
+	testb	%al, %al
+	jne	.L1058
+	cmpb	$10, 15(%rsp)
+	sete	%al
+.L1058:
+	cmpq	$0, %fs:24(%rbx)
+	movb	%al, %fs:32(%rbx)
+	jne	.L1057
+	movl	_ZN1n10std_writerILi1EE8__policyE(%rip), %eax
+	cmpl	$2, %eax
+	je	.L1060
+	cmpl	$1, %eax
+	je	.L1108
+.L1057:
+	testq	%rbp, %rbp
+	jne	.L1066
+.L1067:
+	movq	$-1, %rsi
+	movq	%r12, %rdi
+	leaq	16(%rsp), %r13
+	call	strnlen@PLT
+	movq	%r12, %rdi
+	movq	%rax, %rsi
+	call	_ZN1n10std_writerILi1EE6appendEPKcm.isra.0
+.LEHE50:
+	call	_ZTHN1n10std_writerILi1EE7__localE
+	subq	$1, %fs:24+_ZN1n10std_writerILi1EE7__localE@tpoff
+	je	.L1109
+.L1045:
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1108:
+	.cfi_restore_state
+	cmpb	$0, %fs:32(%rbx)
+	je	.L1057
+.L1060:
+	movq	%fs:8(%rbx), %r14
+	testq	%r14, %r14
+	jne	.L1061
+.L1064:
+	movq	$0, %fs:8(%rbx)
+	movb	$0, %fs:32(%rbx)
+	jmp	.L1057
+	.p2align 4,,10
+	.p2align 3
+.L1107:
+	leaq	15(%rsp), %rdi
+	movl	$1, %esi
+.LEHB51:
+	call	_ZN1n10std_writerILi1EE6appendEPKcm.isra.0
+	jmp	.L1057
+	.p2align 4,,10
+	.p2align 3
+.L1051:
+	movl	%edi, %eax
+	leaq	.LC42(%rip), %r8
+	movl	$3435973837, %esi
+	negl	%eax
+	cmovs	%edi, %eax
+	xorl	%ebp, %ebp
+	.p2align 4,,10
+	.p2align 3
+.L1054:
+	movl	%eax, %edx
+	cmpq	$20, %rbp
+	je	.L1053
+	movq	%rdx, %rcx
+	imulq	%rsi, %rcx
+	shrq	$35, %rcx
+	leal	(%rcx,%rcx,4), %ecx
+	addl	%ecx, %ecx
+	subl	%ecx, %eax
+	cltq
+	movzbl	(%r8,%rax), %eax
+	movb	%al, 16(%rsp,%rbp)
+	addq	$1, %rbp
+.L1053:
+	imulq	%rsi, %rdx
+	shrq	$35, %rdx
+	movl	%edx, %eax
+	testl	%edx, %edx
+	jne	.L1054
+	testl	%edi, %edi
+	js	.L1110
+.L1055:
+	testq	%rbp, %rbp
+	je	.L1067
+	jmp	.L1052
+	.p2align 4,,10
+	.p2align 3
+.L1109:
+	movl	_ZN1n10std_writerILi1EE8__policyE(%rip), %eax
+	cmpl	$2, %eax
+	je	.L1071
+	cmpl	$1, %eax
+	jne	.L1045
+	cmpb	$0, %fs:32+_ZN1n10std_writerILi1EE7__localE@tpoff
+	je	.L1045
+.L1071:
+	movq	%fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff, %rbx
+	testq	%rbx, %rbx
+	jne	.L1073
+.L1076:
+	movq	$0, %fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff
+	movb	$0, %fs:32+_ZN1n10std_writerILi1EE7__localE@tpoff
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1048:
+	.cfi_restore_state
+	leaq	(%rbx,%rsi), %r12
+	jmp	.L1047
+	.p2align 4,,10
+	.p2align 3
+.L1061:
+	movq	%fs:(%rbx), %r15
+.L1065:
+	movq	%r14, %rdx
+	movq	%r15, %rsi
+	movl	$1, %edi
+	call	write@PLT
+.LEHE51:
+	testq	%rax, %rax
+	js	.L1111
+	addq	%rax, %r15
+	subq	%rax, %r14
+	jne	.L1065
+	jmp	.L1064
+	.p2align 4,,10
+	.p2align 3
+.L1111:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1064
+	jmp	.L1065
+	.p2align 4,,10
+	.p2align 3
+.L1110:
+	cmpq	$20, %rbp
+	je	.L1052
+	movb	$45, 16(%rsp,%rbp)
+	addq	$1, %rbp
+	jmp	.L1055
+.L1073:
+	movq	%fs:_ZN1n10std_writerILi1EE7__localE@tpoff, %rbp
+.L1077:
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movl	$1, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1112
+	addq	%rax, %rbp
+	subq	%rax, %rbx
+	jne	.L1077
+	jmp	.L1076
+.L1112:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1076
+	jmp	.L1077
+.L1079:
+	movq	%rax, %rbx
+.L1078:
+	movq	%r13, %rdi
+	call	_ZN1n10std_writerILi1EE5batchD1Ev
+	movq	%rbx, %rdi
+.LEHB52:
+	call	_Unwind_Resume@PLT
+.LEHE52:
+	.cfi_endproc
+.LFE6949:
+	.section	.gcc_except_table
+.LLSDA6949:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6949-.LLSDACSB6949
+.LLSDACSB6949:
+	.uleb128 .LEHB49-.LFB6949
+	.uleb128 .LEHE49-.LEHB49
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB50-.LFB6949
+	.uleb128 .LEHE50-.LEHB50
+	.uleb128 .L1079-.LFB6949
+	.uleb128 0
+	.uleb128 .LEHB51-.LFB6949
+	.uleb128 .LEHE51-.LEHB51
+	.uleb128 .L1079-.LFB6949
+	.uleb128 0
+	.uleb128 .LEHB52-.LFB6949
+	.uleb128 .LEHE52-.LEHB52
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6949:
+	.section	.text._ZN1n6printfIJiEEEvNS_16cstring_iteratorIcEEDpRKT_,"axG",@progbits,_ZN1n6printfIJiEEEvNS_16cstring_iteratorIcEEDpRKT_,comdat
+	.size	_ZN1n6printfIJiEEEvNS_16cstring_iteratorIcEEDpRKT_, .-_ZN1n6printfIJiEEEvNS_16cstring_iteratorIcEEDpRKT_
+	.section	.rodata.str1.1
+.LC43:
+	.string	"1\n2\n3\n4\n"
+.LC44:
+	.string	"$\n"
+.LC45:
+	.string	"4\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC46:
+	.string	"expected true : written() == n::str(\"1\\n2\\n3\\n4\\n\")"
+	.section	.text.unlikely
+.LCOLDB47:
+	.text
+.LHOTB47:
+	.p2align 4
+	.globl	_Z16test_printf_stdwv
+	.type	_Z16test_printf_stdwv, @function
+_Z16test_printf_stdwv:
+.LFB6898:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6898
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$136, %rsp
+	.cfi_def_cfa_offset 192
+	movq	stdout(%rip), %rdi
+	leaq	80(%rsp), %rbp
+.LEHB53:
+	call	fflush@PLT
+	movl	$1, %edi
+	call	dup@PLT
+	movl	$438, %edx
+	movl	$577, %esi
+	movq	path(%rip), %rdi
+	movl	%eax, 28(%rsp)
+	xorl	%eax, %eax
+	call	open@PLT
+	movl	$1, %esi
+	movl	%eax, %ebx
+	movl	%eax, %edi
+	call	dup2@PLT
+	movl	%ebx, %edi
+	leaq	.LC44(%rip), %rbx
+	call	close@PLT
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movl	$0, _ZN1n10std_writerILi1EE8__policyE(%rip)
+	movl	$1, 80(%rsp)
+	call	_ZN1n6printfIJiEEEvNS_16cstring_iteratorIcEEDpRKT_
+	movl	$36, %esi
+	movq	%rbx, %rdi
+	call	strchrnul@PLT
+	movq	%rax, %rsi
+	movq	%rax, %r12
+	movzbl	(%rax), %eax
+	subq	%rbx, %rsi
+	testb	%al, %al
+	jne	.L1114
+	jmp	.L1115
+	.p2align 4,,10
+	.p2align 3
+.L1117:
+	addq	$1, %rsi
+	movzbl	(%rbx,%rsi), %eax
+	testb	%al, %al
+	je	.L1116
+.L1114:
+	cmpb	$36, %al
+	jne	.L1117
+	leaq	1(%rbx,%rsi), %r12
+.L1115:
+	movq	%rbx, %rdi
+	leaq	81(%rsp), %r13
+	leaq	_ZN1n10std_writerILi1EE7__localE@tpoff, %r15
+	call	_ZN1n10std_writerILi1EE6appendEPKcm.isra.0
+	leaq	32(%rsp), %rax
+	movb	$50, 80(%rsp)
+	movq	%rax, 8(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1119:
+	movzbl	-1(%r13), %eax
+	movb	%al, 32(%rsp)
+	call	_ZTHN1n10std_writerILi1EE7__localE
+	movq	%fs:8(%r15), %rax
+	cmpq	%fs:16(%r15), %rax
+	je	.L1233
+	movzbl	32(%rsp), %esi
+	movq	%fs:(%r15), %rdx
+	leaq	1(%rax), %rdi
+	movq	%rdi, %fs:8(%r15)
+	movb	%sil, (%rdx,%rax)
+	movzbl	%fs:32(%r15), %eax
+	testb	%al, %al
+	jne	.L1121
+	cmpb	$10, 32(%rsp)
+	sete	%al
+.L1121:
+	cmpq	$0, %fs:24(%r15)
+	movb	%al, %fs:32(%r15)
+	jne	.L1120
+	movl	_ZN1n10std_writerILi1EE8__policyE(%rip), %eax
+	cmpl	$2, %eax
+	je	.L1123
+	cmpl	$1, %eax
+	je	.L1234
+.L1120:
+	subq	$1, %r13
+	cmpq	%r13, %rbp
+	jne	.L1119
+	movq	$-1, %rsi
+	movq	%r12, %rdi
+	call	strnlen@PLT
+	movq	%r12, %rdi
+	movq	%rax, %rsi
+	call	_ZN1n10std_writerILi1EE6appendEPKcm.isra.0
+	movq	%rbx, %rdi
+	movq	%rbp, %rsi
+	movl	$3, 80(%rsp)
+	call	_ZN1n6printfIJiEEEvNS_16cstring_iteratorIcEEDpRKT_
+	movl	$2, %esi
+	leaq	.LC45(%rip), %rdi
+	call	_ZN1n10std_writerILi1EE6appendEPKcm.isra.0
+	call	_ZTHN1n10std_writerILi1EE7__localE
+	movq	%fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff, %rbx
+	testq	%rbx, %rbx
+	jne	.L1133
+.L1140:
+	movb	$0, %fs:32+_ZN1n10std_writerILi1EE7__localE@tpoff
+	movl	$1, %esi
+	movq	$0, %fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff
+	movl	28(%rsp), %ebx
+	movl	%ebx, %edi
+	call	dup2@PLT
+	movl	%ebx, %edi
+	call	close@PLT
+.LEHE53:
+	movdqa	.LC9(%rip), %xmm0
+	movaps	%xmm0, 80(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L1134
+	pxor	%xmm0, %xmm0
+	leaq	104(%rsp), %r13
+	movq	%rax, 96(%rsp)
+	xorl	%r12d, %r12d
+	leaq	.LC43(%rip), %rbp
+	movups	%xmm0, 104(%rsp)
+	movq	$0, 120(%rsp)
+	cmpq	%r13, %rbp
+	jb	.L1185
+.L1229:
+	leaq	.LC43(%rip), %rax
+.L1232:
+	movq	%r13, %rbx
+.L1135:
+	movq	(%rax), %rax
+	movq	8(%rsp), %rdi
+	movq	%rax, (%rbx,%r12)
+	movq	80(%rsp), %rax
+	leaq	8(%rax), %rdx
+	movq	%rdx, 80(%rsp)
+	movb	$0, 8(%rbx,%rax)
+.LEHB54:
+	call	_Z7writtenv
+.LEHE54:
+	movq	32(%rsp), %rdx
+	movq	40(%rsp), %rbp
+	movq	88(%rsp), %rbx
+	cmpq	80(%rsp), %rdx
+	je	.L1235
+	movq	56(%rsp), %r13
+	cmpq	$23, %rbp
+	je	.L1160
+.L1167:
+	xorl	%r12d, %r12d
+.L1161:
+	movq	48(%rsp), %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	$23, %rbx
+	je	.L1169
+	movq	104(%rsp), %rsi
+.L1163:
+	movq	96(%rsp), %rdi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1169:
+	testb	%r12b, %r12b
+	je	.L1164
+.L1166:
+	movq	path(%rip), %rdi
+	addq	$136, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	remove@PLT
+	.p2align 4,,10
+	.p2align 3
+.L1234:
+	.cfi_restore_state
+	cmpb	$0, %fs:32(%r15)
+	je	.L1120
+.L1123:
+	movq	%fs:8(%r15), %r14
+	testq	%r14, %r14
+	jne	.L1125
+.L1128:
+	movq	$0, %fs:8(%r15)
+	movb	$0, %fs:32(%r15)
+	jmp	.L1120
+	.p2align 4,,10
+	.p2align 3
+.L1233:
+	movq	8(%rsp), %rdi
+	movl	$1, %esi
+.LEHB55:
+	call	_ZN1n10std_writerILi1EE6appendEPKcm.isra.0
+	jmp	.L1120
+	.p2align 4,,10
+	.p2align 3
+.L1116:
+	leaq	(%rbx,%rsi), %r12
+	jmp	.L1115
+	.p2align 4,,10
+	.p2align 3
+.L1125:
+	movq	%fs:(%r15), %rax
+	movq	%rax, 16(%rsp)
+.L1129:
+	movq	16(%rsp), %rsi
+	movq	%r14, %rdx
+	movl	$1, %edi
+	call	write@PLT
+.LEHE55:
+	testq	%rax, %rax
+	js	.L1236
+	addq	%rax, 16(%rsp)
+	subq	%rax, %r14
+	jne	.L1129
+	jmp	.L1128
+	.p2align 4,,10
+	.p2align 3
+.L1236:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1128
+	jmp	.L1129
+	.p2align 4,,10
+	.p2align 3
+.L1235:
+	cmpq	$23, %rbx
+	je	.L1237
+	movq	104(%rsp), %rsi
+	movq	%rsi, %rax
+	cmpq	$23, %rbp
+	je	.L1238
+	movq	56(%rsp), %r13
+	testq	%rdx, %rdx
+	jne	.L1175
+	movq	48(%rsp), %rdi
+	movq	%r13, %rsi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	104(%rsp), %rsi
+.L1158:
+	movl	$1, %r12d
+	jmp	.L1163
+	.p2align 4,,10
+	.p2align 3
+.L1133:
+	movq	%fs:_ZN1n10std_writerILi1EE7__localE@tpoff, %rbp
+.L1141:
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movl	$1, %edi
+.LEHB56:
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1239
+	addq	%rax, %rbp
+	subq	%rax, %rbx
+	jne	.L1141
+	jmp	.L1140
+	.p2align 4,,10
+	.p2align 3
+.L1239:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1140
+	jmp	.L1141
+.L1238:
+	testq	%rdx, %rdx
+	je	.L1158
+.L1155:
+	leaq	56(%rsp), %rdi
+	movq	%rax, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L1165
+	.p2align 4,,10
+	.p2align 3
+.L1160:
+	cmpq	$23, %rbx
+	je	.L1164
+	movq	104(%rsp), %rsi
+	xorl	%r12d, %r12d
+	jmp	.L1163
+	.p2align 4,,10
+	.p2align 3
+.L1185:
+	movq	%rbp, %rax
+	jmp	.L1232
+	.p2align 4,,10
+	.p2align 3
+.L1134:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1240
+.L1143:
+	movq	_ZZN1n4heapEvE3res(%rip), %r8
+	movq	80(%rsp), %r12
+	pxor	%xmm0, %xmm0
+	xorl	%r13d, %r13d
+	movq	88(%rsp), %r15
+	movups	%xmm0, 104(%rsp)
+	leaq	.LC43(%rip), %rbp
+	movq	%r8, 96(%rsp)
+	leaq	8(%r12), %rax
+	movq	$0, 120(%rsp)
+	cmpq	$23, %r15
+	je	.L1241
+.L1145:
+	leaq	0(%r13,%r12), %rdx
+	cmpq	%rdx, %rbp
+	jnb	.L1242
+	movq	%rbp, %r14
+	subq	%r13, %r14
+	cmpq	%rax, %r15
+	jnb	.L1182
+	leaq	10(%r15,%r15), %rdx
+	movq	%r8, %rdi
+	movq	%r8, 16(%rsp)
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %rbp
+	movq	(%r8), %rax
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r15
+	je	.L1149
+	movq	16(%rsp), %r8
+	leaq	1(%r15), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	(%r8), %rax
+	movq	%r8, %rdi
+	call	*24(%rax)
+.L1149:
+	movq	%rbx, 104(%rsp)
+	movq	%rbp, %r15
+	movq	%rbp, 88(%rsp)
+.L1148:
+	leaq	(%rbx,%r14), %rax
+	cmpq	$23, %r15
+	jne	.L1135
+	leaq	104(%rsp), %r13
+	leaq	0(%r13,%r14), %rax
+	jmp	.L1232
+.L1242:
+	cmpq	%rax, %r15
+	jnb	.L1181
+	leaq	10(%r15,%r15), %rdx
+	movq	%r8, %rdi
+	movq	%r8, 16(%rsp)
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %rbp
+	movq	(%r8), %rax
+	call	*16(%rax)
+	leaq	1(%r12), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	cmpq	$23, %r15
+	je	.L1147
+	movq	16(%rsp), %r8
+	leaq	1(%r15), %rdx
+	movl	$1, %ecx
+	xorl	%esi, %esi
+	movq	(%r8), %rax
+	movq	%r8, %rdi
+	call	*24(%rax)
+.LEHE56:
+.L1147:
+	movq	%rbx, 104(%rsp)
+	movq	%rbp, 88(%rsp)
+.L1137:
+	leaq	.LC43(%rip), %rax
+	cmpq	$23, %rbp
+	jne	.L1135
+	leaq	104(%rsp), %r13
+	jmp	.L1229
+	.p2align 4,,10
+	.p2align 3
+.L1237:
+	cmpq	$23, %rbp
+	je	.L1243
+	movq	56(%rsp), %r13
+	leaq	104(%rsp), %rax
+	testq	%rdx, %rdx
+	jne	.L1175
+	movq	48(%rsp), %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L1166
+	.p2align 4,,10
+	.p2align 3
+.L1175:
+	movq	%rax, %rsi
+	movq	%r13, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L1244
+	cmpq	$23, %rbp
+	je	.L1165
+	movl	$1, %r12d
+	jmp	.L1161
+.L1244:
+	cmpq	$23, %rbp
+	jne	.L1167
+	jmp	.L1160
+.L1240:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1143
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1143
+.L1165:
+	cmpq	$23, %rbx
+	je	.L1166
+	movq	104(%rsp), %rsi
+	jmp	.L1158
+.L1243:
+	testq	%rdx, %rdx
+	je	.L1166
+	leaq	104(%rsp), %rax
+	jmp	.L1155
+.L1181:
+	xorl	%ebx, %ebx
+	movq	%r15, %rbp
+	jmp	.L1137
+.L1182:
+	xorl	%ebx, %ebx
+	jmp	.L1148
+.L1241:
+	leaq	104(%rsp), %r13
+	cmpq	%r13, %rbp
+	jnb	.L1145
+	cmpq	$23, %rax
+	jbe	.L1185
+	movl	$56, %edx
+	movq	%r8, %rdi
+	cmpq	%rdx, %rax
+	cmovnb	%rax, %rdx
+	movq	(%r8), %rax
+	leaq	1(%rdx), %rsi
+	movq	%rdx, %r15
+	movl	$1, %edx
+.LEHB57:
+	call	*16(%rax)
+.LEHE57:
+	leaq	1(%r12), %rdx
+	movq	%r13, %rsi
+	movq	%rax, %rbx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	%rbx, 104(%rsp)
+	movq	%rbp, %rax
+	movq	%r15, 88(%rsp)
+	jmp	.L1135
+.L1186:
+	movq	%rax, %rbx
+	jmp	.L1170
+	.section	.gcc_except_table
+.LLSDA6898:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6898-.LLSDACSB6898
+.LLSDACSB6898:
+	.uleb128 .LEHB53-.LFB6898
+	.uleb128 .LEHE53-.LEHB53
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB54-.LFB6898
+	.uleb128 .LEHE54-.LEHB54
+	.uleb128 .L1186-.LFB6898
+	.uleb128 0
+	.uleb128 .LEHB55-.LFB6898
+	.uleb128 .LEHE55-.LEHB55
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB56-.LFB6898
+	.uleb128 .LEHE56-.LEHB56
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB57-.LFB6898
+	.uleb128 .LEHE57-.LEHB57
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6898:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6898
+	.type	_Z16test_printf_stdwv.cold, @function
+_Z16test_printf_stdwv.cold:
+.LFSB6898:
+.L1164:
+	.cfi_def_cfa_offset 192
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC46(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB58:
+	call	__cxa_throw@PLT
+.LEHE58:
+.L1170:
+	movq	88(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L1171
+	movq	96(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	104(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1171:
+	movq	%rbx, %rdi
+.LEHB59:
+	call	_Unwind_Resume@PLT
+.LEHE59:
+	.cfi_endproc
+.LFE6898:
+	.section	.gcc_except_table
+.LLSDAC6898:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6898-.LLSDACSBC6898
+.LLSDACSBC6898:
+	.uleb128 .LEHB58-.LCOLDB47
+	.uleb128 .LEHE58-.LEHB58
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB59-.LCOLDB47
+	.uleb128 .LEHE59-.LEHB59
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6898:
+	.section	.text.unlikely
+	.text
+	.size	_Z16test_printf_stdwv, .-_Z16test_printf_stdwv
+	.section	.text.unlikely
+	.size	_Z16test_printf_stdwv.cold, .-_Z16test_printf_stdwv.cold
+.LCOLDE47:
+	.text
+.LHOTE47:
+	.section	.text._ZN1n6printfIJiiNS_6stringIcEEEEEvNS_16cstring_iteratorIcEEDpRKT_,"axG",@progbits,_ZN1n6printfIJiiNS_6stringIcEEEEEvNS_16cstring_iteratorIcEEDpRKT_,comdat
+	.p2align 4
+	.weak	_ZN1n6printfIJiiNS_6stringIcEEEEEvNS_16cstring_iteratorIcEEDpRKT_
+	.type	_ZN1n6printfIJiiNS_6stringIcEEEEEvNS_16cstring_iteratorIcEEDpRKT_, @function
+_ZN1n6printfIJiiNS_6stringIcEEEEEvNS_16cstring_iteratorIcEEDpRKT_:
+.LFB6948:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6948
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rcx, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rsi, %rbx
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	movq	%rdx, 8(%rsp)
+.LEHB60:
+	call	_ZTHN1n10std_writerILi1EE7__localE
+.LEHE60:
+	movl	$36, %esi
+	movq	%rbp, %rdi
+	addq	$1, %fs:24+_ZN1n10std_writerILi1EE7__localE@tpoff
+	call	strchrnul@PLT
+	movq	%rax, %rsi
+	movq	%rax, %r12
+	movzbl	(%rax), %eax
+	subq	%rbp, %rsi
+	testb	%al, %al
+	jne	.L1246
+	jmp	.L1247
+	.p2align 4,,10
+	.p2align 3
+.L1249:
+	addq	$1, %rsi
+	movzbl	0(%rbp,%rsi), %eax
+	testb	%al, %al
+	je	.L1248
+.L1246:
+	cmpb	$36, %al
+	jne	.L1249
+	leaq	1(%rsi,%rbp), %r12
+.L1247:
+	movq	%rbp, %rdi
+	leaq	32(%rsp), %r13
+.LEHB61:
+	call	_ZN1n10std_writerILi1EE6appendEPKcm.isra.0
+	movl	(%rbx), %edi
+	testl	%edi, %edi
+	jne	.L1251
+	movb	$48, 32(%rsp)
+	movl	$1, %ebp
+.L1252:
+	leaq	32(%rsp), %r13
+	leaq	_ZN1n10std_writerILi1EE7__localE@tpoff, %rbx
+	.p2align 4,,10
+	.p2align 3
+.L1266:
+	subq	$1, %rbp
+	movzbl	0(%r13,%rbp), %eax
+	movb	%al, 30(%rsp)
+	call	_ZTHN1n10std_writerILi1EE7__localE
+	movq	%fs:8(%rbx), %rax
+	cmpq	%fs:16(%rbx), %rax
+	je	.L1359
+	movzbl	30(%rsp), %ecx
+	movq	%fs:(%rbx), %rdx
+	leaq	1(%rax), %rsi
+	movq	%rsi, %fs:8(%rbx)
+	movb	%cl, (%rdx,%rax)
+	movzbl	%fs:32(%rbx), %eax
+	testb	%al, %al
+	jne	.L1258
+	cmpb	$10, 30(%rsp)
+	sete	%al
+.L1258:
+	cmpq	$0, %fs:24(%rbx)
+	movb	%al, %fs:32(%rbx)
+	jne	.L1257
+	movl	_ZN1n10std_writerILi1EE8__policyE(%rip), %eax
+	cmpl	$2, %eax
+	je	.L1260
+	cmpl	$1, %eax
+	je	.L1360
+.L1257:
+	testq	%rbp, %rbp
+	jne	.L1266
+.L1267:
+	movl	$36, %esi
+	movq	%r12, %rdi
+	call	strchrnul@PLT
+	movq	%rax, %rsi
+	movq	%rax, %r15
+	movzbl	(%rax), %eax
+	subq	%r12, %rsi
+	testb	%al, %al
+	jne	.L1269
+	jmp	.L1270
+	.p2align 4,,10
+	.p2align 3
+.L1272:
+	addq	$1, %rsi
+	movzbl	(%r12,%rsi), %eax
+	testb	%al, %al
+	je	.L1271
+.L1269:
+	cmpb	$36, %al
+	jne	.L1272
+	leaq	1(%r12,%rsi), %r15
+.L1270:
+	movq	%r12, %rdi
+	leaq	32(%rsp), %r13
+	call	_ZN1n10std_writerILi1EE6appendEPKcm.isra.0
+	movq	8(%rsp), %rax
+	movl	(%rax), %edi
+	testl	%edi, %edi
+	jne	.L1274
+	movb	$48, 32(%rsp)
+	movl	$1, %ebp
+.L1275:
+	leaq	32(%rsp), %r13
+	leaq	_ZN1n10std_writerILi1EE7__localE@tpoff, %rbx
+	.p2align 4,,10
+	.p2align 3
+.L1289:
+	subq	$1, %rbp
+	movzbl	0(%r13,%rbp), %eax
+	movb	%al, 31(%rsp)
+	call	_ZTHN1n10std_writerILi1EE7__localE
+	movq	%fs:8(%rbx), %rax
+	cmpq	%fs:16(%rbx), %rax
+	je	.L1361
+	movzbl	31(%rsp), %ecx
+	movq	%fs:(%rbx), %rdx
+	leaq	1(%rax), %rsi
+	movq	%rsi, %fs:8(%rbx)
+	movb	%cl, (%rdx,%rax)
+	movzbl	%fs:32(%rbx), %eax
+	testb	%al, %al
+	jne	.L1281
+	cmpb	$10, 31(%rsp)
+	sete	%al
+.L1281:
+	cmpq	$0, %fs:24(%rbx)
+	movb	%al, %fs:32(%rbx)
+	jne	.L1280
+	movl	_ZN1n10std_writerILi1EE8__policyE(%rip), %eax
+	cmpl	$2, %eax
+	je	.L1283
+	cmpl	$1, %eax
+	je	.L1362
+.L1280:
+	testq	%rbp, %rbp
+	jne	.L1289
+.L1290:
+	movl	$36, %esi
+	movq	%r15, %rdi
+	call	strchrnul@PLT
+	movq	%rax, %rsi
+	movq	%rax, %rbx
+	movzbl	(%rax), %eax
+	subq	%r15, %rsi
+	testb	%al, %al
+	jne	.L1292
+	jmp	.L1293
+	.p2align 4,,10
+	.p2align 3
+.L1295:
+	addq	$1, %rsi
+	movzbl	(%r15,%rsi), %eax
+	testb	%al, %al
+	je	.L1294
+.L1292:
+	cmpb	$36, %al
+	jne	.L1295
+	leaq	1(%r15,%rsi), %rbx
+.L1293:
+	movq	%r15, %rdi
+	leaq	32(%rsp), %r13
+	call	_ZN1n10std_writerILi1EE6appendEPKcm.isra.0
+	cmpq	$23, 8(%r14)
+	movq	(%r14), %rsi
+	leaq	24(%r14), %rdi
+	je	.L1298
+	movq	24(%r14), %rdi
+.L1298:
+	leaq	32(%rsp), %r13
+	call	_ZN1n10std_writerILi1EE6appendEPKcm.isra.0
+	movq	$-1, %rsi
+	movq	%rbx, %rdi
+	call	strnlen@PLT
+	movq	%rbx, %rdi
+	movq	%rax, %rsi
+	call	_ZN1n10std_writerILi1EE6appendEPKcm.isra.0
+.LEHE61:
+	call	_ZTHN1n10std_writerILi1EE7__localE
+	subq	$1, %fs:24+_ZN1n10std_writerILi1EE7__localE@tpoff
+	je	.L1363
+.L1245:
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1360:
+	.cfi_restore_state
+	cmpb	$0, %fs:32(%rbx)
+	je	.L1257
+.L1260:
+	movq	%fs:8(%rbx), %r15
+	testq	%r15, %r15
+	jne	.L1261
+.L1264:
+	movq	$0, %fs:8(%rbx)
+	movb	$0, %fs:32(%rbx)
+	jmp	.L1257
+	.p2align 4,,10
+	.p2align 3
+.L1362:
+	cmpb	$0, %fs:32(%rbx)
+	je	.L1280
+.L1283:
+	movq	%fs:8(%rbx), %r12
+	testq	%r12, %r12
+	jne	.L1284
+.L1287:
+	movq	$0, %fs:8(%rbx)
+	movb	$0, %fs:32(%rbx)
+	jmp	.L1280
+	.p2align 4,,10
+	.p2align 3
+.L1359:
+	leaq	30(%rsp), %rdi
+	movl	$1, %esi
+.LEHB62:
+	call	_ZN1n10std_writerILi1EE6appendEPKcm.isra.0
+	jmp	.L1257
+	.p2align 4,,10
+	.p2align 3
+.L1361:
+	leaq	31(%rsp), %rdi
+	movl	$1, %esi
+	call	_ZN1n10std_writerILi1EE6appendEPKcm.isra.0
+	jmp	.L1280
+	.p2align 4,,10
+	.p2align 3
+.L1251:
+	movl	%edi, %eax
+	leaq	.LC42(%rip), %r8
+	movl	$3435973837, %esi
+	negl	%eax
+	cmovs	%edi, %eax
+	xorl	%ebp, %ebp
+	.p2align 4,,10
+	.p2align 3
+.L1254:
+	movl	%eax, %edx
+	cmpq	$20, %rbp
+	je	.L1253
+	movq	%rdx, %rcx
+	imulq	%rsi, %rcx
+	shrq	$35, %rcx
+	leal	(%rcx,%rcx,4), %ecx
+	addl	%ecx, %ecx
+	subl	%ecx, %eax
+	cltq
+	movzbl	(%r8,%rax), %eax
+	movb	%al, 32(%rsp,%rbp)
+	addq	$1, %rbp
+.L1253:
+	imulq	%rsi, %rdx
+	shrq	$35, %rdx
+	movl	%edx, %eax
+	testl	%edx, %edx
+	jne	.L1254
+	testl	%edi, %edi
+	js	.L1364
+.L1255:
+	testq	%rbp, %rbp
+	je	.L1267
+	jmp	.L1252
+	.p2align 4,,10
+	.p2align 3
+.L1274:
+	movl	%edi, %eax
+	leaq	.LC42(%rip), %r8
+	movl	$3435973837, %esi
+	negl	%eax
+	cmovs	%edi, %eax
+	xorl	%ebp, %ebp
+	.p2align 4,,10
+	.p2align 3
+.L1277:
+	movl	%eax, %edx
+	cmpq	$20, %rbp
+	je	.L1276
+	movq	%rdx, %rcx
+	imulq	%rsi, %rcx
+	shrq	$35, %rcx
+	leal	(%rcx,%rcx,4), %ecx
+	addl	%ecx, %ecx
+	subl	%ecx, %eax
+	cltq
+	movzbl	(%r8,%rax), %eax
+	movb	%al, 32(%rsp,%rbp)
+	addq	$1, %rbp
+.L1276:
+	imulq	%rsi, %rdx
+	shrq	$35, %rdx
+	movl	%edx, %eax
+	testl	%edx, %edx
+	jne	.L1277
+	testl	%edi, %edi
+	js	.L1365
+.L1278:
+	testq	%rbp, %rbp
+	je	.L1290
+	jmp	.L1275
+	.p2align 4,,10
+	.p2align 3
+.L1363:
+	movl	_ZN1n10std_writerILi1EE8__policyE(%rip), %eax
+	cmpl	$2, %eax
+	je	.L1301
+	cmpl	$1, %eax
+	jne	.L1245
+	cmpb	$0, %fs:32+_ZN1n10std_writerILi1EE7__localE@tpoff
+	je	.L1245
+.L1301:
+	movq	%fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff, %rbx
+	testq	%rbx, %rbx
+	jne	.L1303
+.L1306:
+	movq	$0, %fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff
+	movb	$0, %fs:32+_ZN1n10std_writerILi1EE7__localE@tpoff
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1271:
+	.cfi_restore_state
+	leaq	(%r12,%rsi), %r15
+	jmp	.L1270
+	.p2align 4,,10
+	.p2align 3
+.L1248:
+	leaq	0(%rbp,%rsi), %r12
+	jmp	.L1247
+	.p2align 4,,10
+	.p2align 3
+.L1284:
+	movq	%fs:(%rbx), %rax
+	movq	%rax, (%rsp)
+.L1288:
+	movq	(%rsp), %rsi
+	movq	%r12, %rdx
+	movl	$1, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1366
+	addq	%rax, (%rsp)
+	subq	%rax, %r12
+	jne	.L1288
+	jmp	.L1287
+	.p2align 4,,10
+	.p2align 3
+.L1366:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1287
+	jmp	.L1288
+	.p2align 4,,10
+	.p2align 3
+.L1261:
+	movq	%fs:(%rbx), %rax
+	movq	%rax, (%rsp)
+.L1265:
+	movq	(%rsp), %rsi
+	movq	%r15, %rdx
+	movl	$1, %edi
+	call	write@PLT
+.LEHE62:
+	testq	%rax, %rax
+	js	.L1367
+	addq	%rax, (%rsp)
+	subq	%rax, %r15
+	jne	.L1265
+	jmp	.L1264
+	.p2align 4,,10
+	.p2align 3
+.L1367:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1264
+	jmp	.L1265
+	.p2align 4,,10
+	.p2align 3
+.L1294:
+	leaq	(%r15,%rsi), %rbx
+	jmp	.L1293
+	.p2align 4,,10
+	.p2align 3
+.L1364:
+	cmpq	$20, %rbp
+	je	.L1252
+	movb	$45, 32(%rsp,%rbp)
+	addq	$1, %rbp
+	jmp	.L1255
+	.p2align 4,,10
+	.p2align 3
+.L1365:
+	cmpq	$20, %rbp
+	je	.L1275
+	movb	$45, 32(%rsp,%rbp)
+	addq	$1, %rbp
+	jmp	.L1278
+.L1303:
+	movq	%fs:_ZN1n10std_writerILi1EE7__localE@tpoff, %rbp
+.L1307:
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movl	$1, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1368
+	addq	%rax, %rbp
+	subq	%rax, %rbx
+	jne	.L1307
+	jmp	.L1306
+.L1368:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1306
+	jmp	.L1307
+.L1309:
+	movq	%rax, %rbx
+.L1308:
+	movq	%r13, %rdi
+	call	_ZN1n10std_writerILi1EE5batchD1Ev
+	movq	%rbx, %rdi
+.LEHB63:
+	call	_Unwind_Resume@PLT
+.LEHE63:
+	.cfi_endproc
+.LFE6948:
+	.section	.gcc_except_table
+.LLSDA6948:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6948-.LLSDACSB6948
+.LLSDACSB6948:
+	.uleb128 .LEHB60-.LFB6948
+	.uleb128 .LEHE60-.LEHB60
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB61-.LFB6948
+	.uleb128 .LEHE61-.LEHB61
+	.uleb128 .L1309-.LFB6948
+	.uleb128 0
+	.uleb128 .LEHB62-.LFB6948
+	.uleb128 .LEHE62-.LEHB62
+	.uleb128 .L1309-.LFB6948
+	.uleb128 0
+	.uleb128 .LEHB63-.LFB6948
+	.uleb128 .LEHE63-.LEHB63
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6948:
+	.section	.text._ZN1n6printfIJiiNS_6stringIcEEEEEvNS_16cstring_iteratorIcEEDpRKT_,"axG",@progbits,_ZN1n6printfIJiiNS_6stringIcEEEEEvNS_16cstring_iteratorIcEEDpRKT_,comdat
+	.size	_ZN1n6printfIJiiNS_6stringIcEEEEEvNS_16cstring_iteratorIcEEDpRKT_, .-_ZN1n6printfIJiiNS_6stringIcEEEEEvNS_16cstring_iteratorIcEEDpRKT_
+	.section	.rodata.str1.1
+.LC48:
+	.string	"three"
+.LC49:
+	.string	"1 + 2 = three\n[42]"
+.LC50:
+	.string	"$ + $ = $\n"
+.LC51:
+	.string	"[$]"
+	.section	.rodata.str1.8
+	.align 8
+.LC52:
+	.string	"expected true : written() == n::str(\"1 + 2 = three\\n[42]\")"
+	.section	.text.unlikely
+.LCOLDB53:
+	.text
+.LHOTB53:
+	.p2align 4
+	.globl	_Z11test_printfv
+	.type	_Z11test_printfv, @function
+_Z11test_printfv:
+.LFB6897:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA6897
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$136, %rsp
+	.cfi_def_cfa_offset 192
+	movq	stdout(%rip), %rdi
+.LEHB64:
+	call	fflush@PLT
+	movl	$1, %edi
+	call	dup@PLT
+	movl	$438, %edx
+	movl	$577, %esi
+	movq	path(%rip), %rdi
+	movl	%eax, %r13d
+	xorl	%eax, %eax
+	call	open@PLT
+	movl	$1, %esi
+	movl	%eax, %ebx
+	movl	%eax, %edi
+	call	dup2@PLT
+	movl	%ebx, %edi
+	call	close@PLT
+.LEHE64:
+	movl	$1, _ZN1n10std_writerILi1EE8__policyE(%rip)
+	movdqa	.LC9(%rip), %xmm1
+	movaps	%xmm1, 80(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rbx
+	testq	%rbx, %rbx
+	je	.L1370
+	pxor	%xmm0, %xmm0
+	leaq	104(%rsp), %r12
+	movq	%rbx, 96(%rsp)
+	xorl	%edi, %edi
+	leaq	.LC48(%rip), %rsi
+	movups	%xmm0, 104(%rsp)
+	movq	$0, 120(%rsp)
+	cmpq	%r12, %rsi
+	jb	.L1451
+.L1502:
+	leaq	.LC48(%rip), %rsi
+.L1451:
+	movq	%r12, %rbx
+.L1371:
+	addq	%rbx, %rdi
+	movl	$5, %edx
+	leaq	32(%rsp), %rbp
+	call	memmove@PLT
+	movq	80(%rsp), %rax
+	leaq	28(%rsp), %rsi
+	leaq	.LC50(%rip), %rdi
+	movl	$1, 28(%rsp)
+	leaq	5(%rax), %rdx
+	movq	%rdx, 80(%rsp)
+	movq	%rbp, %rdx
+	movb	$0, 5(%rbx,%rax)
+	leaq	80(%rsp), %rbx
+	movq	%rbx, %rcx
+	movl	$2, 32(%rsp)
+.LEHB65:
+	call	_ZN1n6printfIJiiNS_6stringIcEEEEEvNS_16cstring_iteratorIcEEDpRKT_
+.LEHE65:
+	movq	88(%rsp), %rdx
+	cmpq	$23, %rdx
+	je	.L1386
+	movq	96(%rsp), %rdi
+	movq	104(%rsp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1386:
+	movq	%rbx, %rsi
+	leaq	.LC51(%rip), %rdi
+	movl	$42, 80(%rsp)
+.LEHB66:
+	call	_ZN1n6printfIJiEEEvNS_16cstring_iteratorIcEEDpRKT_
+	call	_ZTHN1n10std_writerILi1EE7__localE
+	movq	%fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff, %rbx
+	testq	%rbx, %rbx
+	jne	.L1387
+.L1394:
+	movq	$0, %fs:8+_ZN1n10std_writerILi1EE7__localE@tpoff
+	movl	$1, %esi
+	movl	%r13d, %edi
+	movb	$0, %fs:32+_ZN1n10std_writerILi1EE7__localE@tpoff
+	call	dup2@PLT
+	movl	%r13d, %edi
+	call	close@PLT
+.LEHE66:
+	movdqa	.LC9(%rip), %xmm2
+	movaps	%xmm2, 80(%rsp)
+	movq	%fs:_ZN1n18__current_resourceE@tpoff, %rax
+	testq	%rax, %rax
+	je	.L1388
+	pxor	%xmm0, %xmm0
+	leaq	104(%rsp), %r12
+	movq	%rax, 96(%rsp)
+	xorl	%r14d, %r14d
+	leaq	.LC49(%rip), %r13
+	movups	%xmm0, 104(%rsp)
+	movq	$0, 120(%rsp)
+	cmpq	%r12, %r13
+	jb	.L1450
+.L1503:
+	leaq	.LC49(%rip), %rsi
+.L1506:
+	movq	%r12, %rbx
+.L1389:
+	leaq	(%rbx,%r14), %rdi
+	movl	$18, %edx
+	call	memmove@PLT
+	movq	80(%rsp), %rax
+	movq	%rbp, %rdi
+	leaq	18(%rax), %rdx
+	movq	%rdx, 80(%rsp)
+	movb	$0, 18(%rbx,%rax)
+.LEHB67:
+	call	_Z7writtenv
+.LEHE67:
+	movq	32(%rsp), %rdx
+	movq	40(%rsp), %rbp
+	movq	88(%rsp), %rbx
+	cmpq	80(%rsp), %rdx
+	je	.L1507
+	movq	56(%rsp), %r13
+	cmpq	$23, %rbp
+	je	.L1414
+.L1421:
+	xorl	%r12d, %r12d
+.L1415:
+	movq	48(%rsp), %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	cmpq	$23, %rbx
+	je	.L1423
+	movq	104(%rsp), %rsi
+.L1417:
+	movq	96(%rsp), %rdi
+	leaq	1(%rbx), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1423:
+	testb	%r12b, %r12b
+	je	.L1418
+.L1420:
+	movq	path(%rip), %rdi
+	addq	$136, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	remove@PLT
+	.p2align 4,,10
+	.p2align 3
+.L1507:
+	.cfi_restore_state
+	cmpq	$23, %rbx
+	je	.L1508
+	movq	104(%rsp), %rsi
+	movq	%rsi, %rax
+	cmpq	$23, %rbp
+	je	.L1509
+	movq	56(%rsp), %r13
+	testq	%rdx, %rdx
+	jne	.L1432
+	movq	48(%rsp), %rdi
+	movq	%r13, %rsi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	movq	104(%rsp), %rsi
+.L1412:
+	movl	$1, %r12d
+	jmp	.L1417
+	.p2align 4,,10
+	.p2align 3
+.L1387:
+	movq	%fs:_ZN1n10std_writerILi1EE7__localE@tpoff, %r12
+.L1395:
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	movl	$1, %edi
+.LEHB68:
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1510
+	addq	%rax, %r12
+	subq	%rax, %rbx
+	jne	.L1395
+	jmp	.L1394
+	.p2align 4,,10
+	.p2align 3
+.L1510:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1394
+	jmp	.L1395
+.L1509:
+	testq	%rdx, %rdx
+	je	.L1412
+.L1409:
+	leaq	56(%rsp), %rdi
+	movq	%rax, %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L1419
+	.p2align 4,,10
+	.p2align 3
+.L1414:
+	cmpq	$23, %rbx
+	je	.L1418
+	movq	104(%rsp), %rsi
+	xorl	%r12d, %r12d
+	jmp	.L1417
+	.p2align 4,,10
+	.p2align 3
+.L1450:
+	movq	%r13, %rsi
+	jmp	.L1506
+	.p2align 4,,10
+	.p2align 3
+.L1388:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1511
+.L1397:
+	movq	_ZZN1n4heapEvE3res(%rip), %r15
+	movq	80(%rsp), %r14
+	pxor	%xmm0, %xmm0
+	xorl	%r12d, %r12d
+	movq	88(%rsp), %rcx
+	movups	%xmm0, 104(%rsp)
+	leaq	.LC49(%rip), %r13
+	movq	%r15, 96(%rsp)
+	leaq	18(%r14), %rax
+	movq	$0, 120(%rsp)
+	cmpq	$23, %rcx
+	je	.L1512
+.L1399:
+	leaq	(%r12,%r14), %rdx
+	cmpq	%rdx, %r13
+	jnb	.L1513
+	subq	%r12, %r13
+	movq	%r13, 8(%rsp)
+	cmpq	%rax, %rcx
+	jnb	.L1447
+	leaq	10(%rcx,%rcx), %rdx
+	movq	%rcx, (%rsp)
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %r13
+	movq	(%r15), %rax
+	call	*16(%rax)
+	leaq	1(%r14), %rdx
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	movq	(%rsp), %rcx
+	cmpq	$23, %rcx
+	je	.L1403
+	movq	(%r15), %rax
+	leaq	1(%rcx), %rdx
+	xorl	%esi, %esi
+	movl	$1, %ecx
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L1403:
+	movq	%rbx, 104(%rsp)
+	movq	%r13, %rcx
+	movq	%r13, 88(%rsp)
+.L1402:
+	cmpq	$23, %rcx
+	je	.L1404
+	movq	8(%rsp), %rsi
+	addq	%rbx, %rsi
+	jmp	.L1389
+.L1513:
+	cmpq	%rax, %rcx
+	jnb	.L1446
+	leaq	10(%rcx,%rcx), %rdx
+	movq	%rcx, (%rsp)
+	movq	%r15, %rdi
+	cmpq	%rax, %rdx
+	cmovnb	%rdx, %rax
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	movq	%rax, %r13
+	movq	(%r15), %rax
+	call	*16(%rax)
+	leaq	1(%r14), %rdx
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	movq	(%rsp), %rcx
+	cmpq	$23, %rcx
+	je	.L1401
+	movq	(%r15), %rax
+	leaq	1(%rcx), %rdx
+	xorl	%esi, %esi
+	movl	$1, %ecx
+	movq	%r15, %rdi
+	call	*24(%rax)
+.L1401:
+	movq	%rbx, 104(%rsp)
+	movq	%r13, 88(%rsp)
+.L1391:
+	leaq	.LC49(%rip), %rsi
+	cmpq	$23, %r13
+	jne	.L1389
+	leaq	104(%rsp), %r12
+	jmp	.L1503
+	.p2align 4,,10
+	.p2align 3
+.L1370:
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1514
+.L1375:
+	movq	_ZZN1n4heapEvE3res(%rip), %rcx
+	movq	80(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	xorl	%r12d, %r12d
+	movq	88(%rsp), %rbp
+	movups	%xmm0, 104(%rsp)
+	leaq	.LC48(%rip), %rsi
+	movq	%rcx, 96(%rsp)
+	leaq	5(%rdi), %rax
+	movq	$0, 120(%rsp)
+	cmpq	$23, %rbp
+	je	.L1515
+.L1377:
+	leaq	(%r12,%rdi), %rdx
+	cmpq	%rdx, %rsi
+	jnb	.L1516
+	subq	%r12, %rsi
+	movq	%rsi, %r14
+	cmpq	%rax, %rbp
+	jnb	.L1439
+	leaq	10(%rbp,%rbp), %rbp
+	movl	$1, %edx
+	movq	%rcx, %rdi
+	cmpq	%rax, %rbp
+	cmovb	%rax, %rbp
+	movq	(%rcx), %rax
+	leaq	1(%rbp), %rsi
+	call	*16(%rax)
+	cmpq	$23, 88(%rsp)
+	leaq	104(%rsp), %rsi
+	movq	%rax, %rbx
+	movq	80(%rsp), %rax
+	leaq	1(%rax), %rdx
+	je	.L1382
+	movq	104(%rsp), %rsi
+.L1382:
+	movq	%rbx, %rdi
+	call	memcpy@PLT
+	movq	88(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L1383
+	movq	96(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	104(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1383:
+	movq	%rbx, 104(%rsp)
+	movq	80(%rsp), %rdi
+	movq	%rbp, 88(%rsp)
+.L1381:
+	leaq	(%rbx,%r14), %rsi
+	cmpq	$23, %rbp
+	jne	.L1371
+	leaq	104(%rsp), %r12
+	leaq	(%r12,%r14), %rsi
+	jmp	.L1451
+.L1516:
+	cmpq	%rax, %rbp
+	jnb	.L1373
+.L1429:
+	leaq	10(%rbp,%rbp), %rbp
+	movl	$1, %edx
+	movq	%rcx, %rdi
+	cmpq	%rax, %rbp
+	cmovb	%rax, %rbp
+	movq	(%rcx), %rax
+	leaq	1(%rbp), %rsi
+	call	*16(%rax)
+	cmpq	$23, 88(%rsp)
+	leaq	104(%rsp), %rsi
+	movq	%rax, %rbx
+	movq	80(%rsp), %rax
+	leaq	1(%rax), %rdx
+	je	.L1379
+	movq	104(%rsp), %rsi
+.L1379:
+	movq	%rbx, %rdi
+	call	memcpy@PLT
+	movq	88(%rsp), %rdx
+	cmpq	$23, %rdx
+	je	.L1380
+	movq	96(%rsp), %rdi
+	movq	104(%rsp), %rsi
+	addq	$1, %rdx
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.LEHE68:
+.L1380:
+	movq	%rbx, 104(%rsp)
+	movq	80(%rsp), %rdi
+	movq	%rbp, 88(%rsp)
+.L1373:
+	leaq	.LC48(%rip), %rsi
+	cmpq	$23, %rbp
+	jne	.L1371
+	leaq	104(%rsp), %r12
+	jmp	.L1502
+	.p2align 4,,10
+	.p2align 3
+.L1508:
+	cmpq	$23, %rbp
+	je	.L1517
+	movq	56(%rsp), %r13
+	leaq	104(%rsp), %rax
+	testq	%rdx, %rdx
+	jne	.L1432
+	movq	48(%rsp), %rdi
+	leaq	1(%rbp), %rdx
+	movl	$1, %ecx
+	movq	%r13, %rsi
+	movq	(%rdi), %rax
+	call	*24(%rax)
+	jmp	.L1420
+	.p2align 4,,10
+	.p2align 3
+.L1432:
+	movq	%rax, %rsi
+	movq	%r13, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L1518
+	cmpq	$23, %rbp
+	je	.L1419
+	movl	$1, %r12d
+	jmp	.L1415
+.L1518:
+	cmpq	$23, %rbp
+	jne	.L1421
+	jmp	.L1414
+.L1514:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbp
+	movq	%rbp, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1375
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbp, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1375
+.L1511:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1397
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1397
+.L1419:
+	cmpq	$23, %rbx
+	je	.L1420
+	movq	104(%rsp), %rsi
+	jmp	.L1412
+.L1517:
+	testq	%rdx, %rdx
+	je	.L1420
+	leaq	104(%rsp), %rax
+	jmp	.L1409
+.L1446:
+	xorl	%ebx, %ebx
+	movq	%rcx, %r13
+	jmp	.L1391
+.L1515:
+	leaq	104(%rsp), %r12
+	cmpq	%r12, %rsi
+	jnb	.L1377
+	cmpq	$23, %rax
+	ja	.L1429
+	jmp	.L1451
+	.p2align 4,,10
+	.p2align 3
+.L1439:
+	xorl	%ebx, %ebx
+	jmp	.L1381
+.L1447:
+	xorl	%ebx, %ebx
+	jmp	.L1402
+.L1404:
+	movq	8(%rsp), %rsi
+	leaq	104(%rsp), %r12
+	addq	%r12, %rsi
+	jmp	.L1506
+.L1512:
+	leaq	104(%rsp), %r12
+	cmpq	%r12, %r13
+	jnb	.L1399
+	cmpq	$23, %rax
+	jbe	.L1450
+	movl	$56, %edx
+	movq	%r15, %rdi
+	cmpq	%rdx, %rax
+	movq	%rdx, %rcx
+	movl	$1, %edx
+	cmovnb	%rax, %rcx
+	movq	(%r15), %rax
+	leaq	1(%rcx), %rsi
+	movq	%rcx, (%rsp)
+.LEHB69:
+	call	*16(%rax)
+.LEHE69:
+	movq	%r12, %rsi
+	leaq	1(%r14), %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memcpy@PLT
+	movq	(%rsp), %rcx
+	movq	%rbx, 104(%rsp)
+	movq	%r13, %rsi
+	movq	%rcx, 88(%rsp)
+	jmp	.L1389
+.L1453:
+	movq	%rax, %rbx
+	jmp	.L1426
+.L1452:
+	movq	%rax, %rbx
+	jmp	.L1424
+	.section	.gcc_except_table
+.LLSDA6897:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE6897-.LLSDACSB6897
+.LLSDACSB6897:
+	.uleb128 .LEHB64-.LFB6897
+	.uleb128 .LEHE64-.LEHB64
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB65-.LFB6897
+	.uleb128 .LEHE65-.LEHB65
+	.uleb128 .L1452-.LFB6897
+	.uleb128 0
+	.uleb128 .LEHB66-.LFB6897
+	.uleb128 .LEHE66-.LEHB66
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB67-.LFB6897
+	.uleb128 .LEHE67-.LEHB67
+	.uleb128 .L1453-.LFB6897
+	.uleb128 0
+	.uleb128 .LEHB68-.LFB6897
+	.uleb128 .LEHE68-.LEHB68
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB69-.LFB6897
+	.uleb128 .LEHE69-.LEHB69
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE6897:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC6897
+	.type	_Z11test_printfv.cold, @function
+_Z11test_printfv.cold:
+.LFSB6897:
+.L1418:
+	.cfi_def_cfa_offset 192
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movl	$8, %edi
+	call	__cxa_allocate_exception@PLT
+	xorl	%edx, %edx
+	leaq	_ZTIPKc(%rip), %rsi
+	movq	%rax, %rdi
+	leaq	.LC52(%rip), %rax
+	movq	%rax, (%rdi)
+.LEHB70:
+	call	__cxa_throw@PLT
+.LEHE70:
+.L1426:
+	movq	88(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L1427
+	movq	96(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	104(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1427:
+	movq	%rbx, %rdi
+.LEHB71:
+	call	_Unwind_Resume@PLT
+.LEHE71:
+.L1424:
+	movq	88(%rsp), %rax
+	cmpq	$23, %rax
+	je	.L1425
+	movq	96(%rsp), %rdi
+	leaq	1(%rax), %rdx
+	movq	104(%rsp), %rsi
+	movl	$1, %ecx
+	movq	(%rdi), %rax
+	call	*24(%rax)
+.L1425:
+	movq	%rbx, %rdi
+.LEHB72:
+	call	_Unwind_Resume@PLT
+.LEHE72:
+	.cfi_endproc
+.LFE6897:
+	.section	.gcc_except_table
+.LLSDAC6897:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC6897-.LLSDACSBC6897
+.LLSDACSBC6897:
+	.uleb128 .LEHB70-.LCOLDB53
+	.uleb128 .LEHE70-.LEHB70
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB71-.LCOLDB53
+	.uleb128 .LEHE71-.LEHB71
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB72-.LCOLDB53
+	.uleb128 .LEHE72-.LEHB72
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC6897:
+	.section	.text.unlikely
+	.text
+	.size	_Z11test_printfv, .-_Z11test_printfv
+	.section	.text.unlikely
+	.size	_Z11test_printfv.cold, .-_Z11test_printfv.cold
+.LCOLDE53:
+	.text
+.LHOTE53:
+	.section	.text.unlikely
+.LCOLDB55:
+	.section	.text.startup
+.LHOTB55:
+	.p2align 4
+	.type	_GLOBAL__sub_I_path, @function
+_GLOBAL__sub_I_path:
+.LFB7035:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA7035
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$48, %rsp
+	.cfi_def_cfa_offset 80
+	cmpb	$0, _ZGVN1n4stdrE(%rip)
+	je	.L1550
+.L1520:
+	cmpb	$0, _ZGVN1n10std_writerILi9EE8__policyE(%rip)
+	je	.L1551
+.L1537:
+	cmpb	$0, _ZGVN1n10std_writerILi1EE8__policyE(%rip)
+	je	.L1552
+.L1519:
+	addq	$48, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.L1550:
+	.cfi_restore_state
+	movdqa	.LC54(%rip), %xmm0
+	movq	stdin(%rip), %rbx
+	movl	$4294967295, %eax
+	xorl	%edi, %edi
+	xorl	%r8d, %r8d
+	movb	$1, _ZGVN1n4stdrE(%rip)
+	movq	%rax, _ZN1n4stdrE(%rip)
+	movq	$0, 8+_ZN1n4stdrE(%rip)
+	movq	%rdi, 16+_ZN1n4stdrE(%rip)
+	movq	%r8, 40+_ZN1n4stdrE(%rip)
+	movups	%xmm0, 24+_ZN1n4stdrE(%rip)
+	testq	%rbx, %rbx
+	je	.L1553
+	movq	%rbx, %rdi
+	movq	%rbx, 48+_ZN1n4stdrE(%rip)
+	call	fileno@PLT
+	movq	%rbx, %rdi
+	call	fileno@PLT
+	movl	_ZN1n4stdrE(%rip), %ebx
+	xorl	%edx, %edx
+	xorl	%ecx, %ecx
+	movdqa	.LC54(%rip), %xmm0
+	movl	%eax, (%rsp)
+	movw	$0, 4(%rsp)
+	movb	$0, 6(%rsp)
+	movq	$0, 8(%rsp)
+	movq	%rdx, 16(%rsp)
+	movq	%rcx, 40(%rsp)
+	movups	%xmm0, 24(%rsp)
+	testl	%ebx, %ebx
+	js	.L1523
+	cmpl	$2, 8+_ZN1n4stdrE(%rip)
+	je	.L1554
+.L1524:
+	cmpb	$0, 4+_ZN1n4stdrE(%rip)
+	jne	.L1529
+.L1530:
+	movl	$-1, _ZN1n4stdrE(%rip)
+.L1523:
+	cmpq	$0, 16+_ZN1n4stdrE(%rip)
+	je	.L1535
+	movzbl	_ZGVZN1n4heapEvE3res(%rip), %eax
+	testb	%al, %al
+	je	.L1555
+.L1533:
+	movq	_ZZN1n4heapEvE3res(%rip), %rdi
+	movq	24+_ZN1n4stdrE(%rip), %rdx
+	movl	$64, %ecx
+	movq	16+_ZN1n4stdrE(%rip), %rsi
+	movq	(%rdi), %rax
+.LEHB73:
+	call	*24(%rax)
+.L1535:
+	movl	(%rsp), %eax
+	movdqu	24(%rsp), %xmm1
+	movl	%eax, _ZN1n4stdrE(%rip)
+	movzwl	4(%rsp), %eax
+	movups	%xmm1, 24+_ZN1n4stdrE(%rip)
+	movw	%ax, 4+_ZN1n4stdrE(%rip)
+	movzbl	6(%rsp), %eax
+	movb	%al, 6+_ZN1n4stdrE(%rip)
+	movq	8(%rsp), %rax
+	movq	%rax, 8+_ZN1n4stdrE(%rip)
+	movq	16(%rsp), %rax
+	movq	%rax, 16+_ZN1n4stdrE(%rip)
+	movq	40(%rsp), %rax
+	movq	%rax, 40+_ZN1n4stdrE(%rip)
+	jmp	.L1522
+.L1552:
+	movl	$1, %edi
+	movb	$1, _ZGVN1n10std_writerILi1EE8__policyE(%rip)
+	call	isatty@PLT
+	testl	%eax, %eax
+	setne	%al
+	movzbl	%al, %eax
+	movl	%eax, _ZN1n10std_writerILi1EE8__policyE(%rip)
+	jmp	.L1519
+.L1551:
+	movl	$9, %edi
+	movb	$1, _ZGVN1n10std_writerILi9EE8__policyE(%rip)
+	call	isatty@PLT
+	testl	%eax, %eax
+	setne	%al
+	movzbl	%al, %eax
+	movl	%eax, _ZN1n10std_writerILi9EE8__policyE(%rip)
+	jmp	.L1537
+.L1553:
+	xorl	%esi, %esi
+	movq	%rsi, 48+_ZN1n4stdrE(%rip)
+.L1522:
+	leaq	__dso_handle(%rip), %rdx
+	leaq	_ZN1n4stdrE(%rip), %rsi
+	leaq	_ZN1n4fileIcLNS_4modeE6EED1Ev(%rip), %rdi
+	call	__cxa_atexit@PLT
+	jmp	.L1520
+.L1554:
+	movq	40+_ZN1n4stdrE(%rip), %rbp
+	testq	%rbp, %rbp
+	je	.L1524
+	movq	16+_ZN1n4stdrE(%rip), %r12
+.L1528:
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movl	%ebx, %edi
+	call	write@PLT
+	testq	%rax, %rax
+	js	.L1556
+	addq	%rax, %r12
+	subq	%rax, %rbp
+	jne	.L1528
+.L1527:
+	xorl	%eax, %eax
+	movq	%rax, 40+_ZN1n4stdrE(%rip)
+	jmp	.L1524
+.L1529:
+	movl	_ZN1n4stdrE(%rip), %edi
+	call	close@PLT
+.LEHE73:
+	jmp	.L1530
+.L1555:
+	leaq	_ZGVZN1n4heapEvE3res(%rip), %rbx
+	movq	%rbx, %rdi
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	je	.L1533
+	leaq	16+_ZTVN1n13heap_resourceE(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, _ZZN1n4heapEvE7storage(%rip)
+	leaq	_ZZN1n4heapEvE7storage(%rip), %rax
+	movq	%rax, _ZZN1n4heapEvE3res(%rip)
+	call	__cxa_guard_release@PLT
+	jmp	.L1533
+.L1556:
+	call	__errno_location@PLT
+	cmpl	$4, (%rax)
+	jne	.L1527
+	jmp	.L1528
+.L1539:
+	movq	%rax, %rbx
+	jmp	.L1536
+	.section	.gcc_except_table
+.LLSDA7035:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE7035-.LLSDACSB7035
+.LLSDACSB7035:
+	.uleb128 .LEHB73-.LFB7035
+	.uleb128 .LEHE73-.LEHB73
+	.uleb128 .L1539-.LFB7035
+	.uleb128 0
+.LLSDACSE7035:
+	.section	.text.startup
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC7035
+	.type	_GLOBAL__sub_I_path.cold, @function
+_GLOBAL__sub_I_path.cold:
+.LFSB7035:
+.L1536:
+	.cfi_def_cfa_offset 80
+	.cfi_offset 3, -32
+	.cfi_offset 6, -24
+	.cfi_offset 12, -16
+	movq	%rsp, %rdi
+	call	_ZN1n7fd_file5closeEv
+	leaq	_ZN1n4stdrE(%rip), %rdi
+	call	_ZN1n7fd_file5closeEv
+	movq	%rbx, %rdi
+.LEHB74:
+	call	_Unwind_Resume@PLT
+.LEHE74:
+	.cfi_endproc
+.LFE7035:
+	.section	.gcc_except_table
+.LLSDAC7035:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC7035-.LLSDACSBC7035
+.LLSDACSBC7035:
+	.uleb128 .LEHB74-.LCOLDB55
+	.uleb128 .LEHE74-.LEHB74
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC7035:
+	.section	.text.unlikely
+	.section	.text.startup
+	.size	_GLOBAL__sub_I_path, .-_GLOBAL__sub_I_path
+	.section	.text.unlikely
+	.size	_GLOBAL__sub_I_path.cold, .-_GLOBAL__sub_I_path.cold
+.LCOLDE55:
+	.section	.text.startup
+.LHOTE55:
+	.section	.init_array,"aw"
+	.align 8
+	.quad	_GLOBAL__sub_I_path
+	.weak	_ZGVN1n10std_writerILi1EE7__localE
+	.section	.tbss._ZGVN1n10std_writerILi1EE7__localE,"awTG",@nobits,_ZGVN1n10std_writerILi1EE7__localE,comdat
+	.align 8
+	.type	_ZGVN1n10std_writerILi1EE7__localE, @gnu_unique_object
+	.size	_ZGVN1n10std_writerILi1EE7__localE, 8
+_ZGVN1n10std_writerILi1EE7__localE:
+	.zero	8
+	.weak	_ZGVN1n10std_writerILi9EE7__localE
+	.section	.tbss._ZGVN1n10std_writerILi9EE7__localE,"awTG",@nobits,_ZGVN1n10std_writerILi9EE7__localE,comdat
+	.align 8
+	.type	_ZGVN1n10std_writerILi9EE7__localE, @gnu_unique_object
+	.size	_ZGVN1n10std_writerILi9EE7__localE, 8
+_ZGVN1n10std_writerILi9EE7__localE:
+	.zero	8
+	.section	.tbss,"awT",@nobits
+	.type	__tls_guard, @object
+	.size	__tls_guard, 1
+__tls_guard:
+	.zero	1
+	.weak	_ZGVN1n10std_writerILi1EE8__policyE
+	.section	.bss._ZGVN1n10std_writerILi1EE8__policyE,"awG",@nobits,_ZGVN1n10std_writerILi1EE8__policyE,comdat
+	.align 8
+	.type	_ZGVN1n10std_writerILi1EE8__policyE, @gnu_unique_object
+	.size	_ZGVN1n10std_writerILi1EE8__policyE, 8
+_ZGVN1n10std_writerILi1EE8__policyE:
+	.zero	8
+	.weak	_ZGVN1n10std_writerILi9EE8__policyE
+	.section	.bss._ZGVN1n10std_writerILi9EE8__policyE,"awG",@nobits,_ZGVN1n10std_writerILi9EE8__policyE,comdat
+	.align 8
+	.type	_ZGVN1n10std_writerILi9EE8__policyE, @gnu_unique_object
+	.size	_ZGVN1n10std_writerILi9EE8__policyE, 8
+_ZGVN1n10std_writerILi9EE8__policyE:
+	.zero	8
+	.weak	_ZGVN1n4stdrE
+	.section	.bss._ZGVN1n4stdrE,"awG",@nobits,_ZGVN1n4stdrE,comdat
+	.align 8
+	.type	_ZGVN1n4stdrE, @gnu_unique_object
+	.size	_ZGVN1n4stdrE, 8
+_ZGVN1n4stdrE:
+	.zero	8
+	.weak	_ZTSN1n15memory_resourceE
+	.section	.rodata._ZTSN1n15memory_resourceE,"aG",@progbits,_ZTSN1n15memory_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n15memory_resourceE, @object
+	.size	_ZTSN1n15memory_resourceE, 22
+_ZTSN1n15memory_resourceE:
+	.string	"N1n15memory_resourceE"
+	.weak	_ZTIN1n15memory_resourceE
+	.section	.data.rel.ro._ZTIN1n15memory_resourceE,"awG",@progbits,_ZTIN1n15memory_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n15memory_resourceE, @object
+	.size	_ZTIN1n15memory_resourceE, 16
+_ZTIN1n15memory_resourceE:
+	.quad	_ZTVN10__cxxabiv117__class_type_infoE+16
+	.quad	_ZTSN1n15memory_resourceE
+	.weak	_ZTSN1n13heap_resourceE
+	.section	.rodata._ZTSN1n13heap_resourceE,"aG",@progbits,_ZTSN1n13heap_resourceE,comdat
+	.align 16
+	.type	_ZTSN1n13heap_resourceE, @object
+	.size	_ZTSN1n13heap_resourceE, 20
+_ZTSN1n13heap_resourceE:
+	.string	"N1n13heap_resourceE"
+	.weak	_ZTIN1n13heap_resourceE
+	.section	.data.rel.ro._ZTIN1n13heap_resourceE,"awG",@progbits,_ZTIN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTIN1n13heap_resourceE, @object
+	.size	_ZTIN1n13heap_resourceE, 24
+_ZTIN1n13heap_resourceE:
+	.quad	_ZTVN10__cxxabiv120__si_class_type_infoE+16
+	.quad	_ZTSN1n13heap_resourceE
+	.quad	_ZTIN1n15memory_resourceE
+	.weak	_ZTVN1n13heap_resourceE
+	.section	.data.rel.ro.local._ZTVN1n13heap_resourceE,"awG",@progbits,_ZTVN1n13heap_resourceE,comdat
+	.align 8
+	.type	_ZTVN1n13heap_resourceE, @object
+	.size	_ZTVN1n13heap_resourceE, 48
+_ZTVN1n13heap_resourceE:
+	.quad	0
+	.quad	_ZTIN1n13heap_resourceE
+	.quad	_ZN1n13heap_resourceD1Ev
+	.quad	_ZN1n13heap_resourceD0Ev
+	.quad	_ZN1n13heap_resource8allocateEmm
+	.quad	_ZN1n13heap_resource10deallocateEPvmm
+	.weak	_ZN1n10std_writerILi9EE8__policyE
+	.section	.bss._ZN1n10std_writerILi9EE8__policyE,"awG",@nobits,_ZN1n10std_writerILi9EE8__policyE,comdat
+	.align 4
+	.type	_ZN1n10std_writerILi9EE8__policyE, @gnu_unique_object
+	.size	_ZN1n10std_writerILi9EE8__policyE, 4
+_ZN1n10std_writerILi9EE8__policyE:
+	.zero	4
+	.weak	_ZN1n10std_writerILi9EE7__localE
+	.section	.tbss._ZN1n10std_writerILi9EE7__localE,"awTG",@nobits,_ZN1n10std_writerILi9EE7__localE,comdat
+	.align 8
+	.type	_ZN1n10std_writerILi9EE7__localE, @gnu_unique_object
+	.size	_ZN1n10std_writerILi9EE7__localE, 40
+_ZN1n10std_writerILi9EE7__localE:
+	.zero	40
+	.globl	path
+	.section	.rodata.str1.1
+.LC56:
+	.string	"test_std_writer.txt"
+	.section	.data.rel.local,"aw"
+	.align 8
+	.type	path, @object
+	.size	path, 8
+path:
+	.quad	.LC56
+	.weak	_ZN1n4stdrE
+	.section	.bss._ZN1n4stdrE,"awG",@nobits,_ZN1n4stdrE,comdat
+	.align 32
+	.type	_ZN1n4stdrE, @gnu_unique_object
+	.size	_ZN1n4stdrE, 56
+_ZN1n4stdrE:
+	.zero	56
+	.weak	_ZN1n10std_writerILi1EE8__policyE
+	.section	.bss._ZN1n10std_writerILi1EE8__policyE,"awG",@nobits,_ZN1n10std_writerILi1EE8__policyE,comdat
+	.align 4
+	.type	_ZN1n10std_writerILi1EE8__policyE, @gnu_unique_object
+	.size	_ZN1n10std_writerILi1EE8__policyE, 4
+_ZN1n10std_writerILi1EE8__policyE:
+	.zero	4
+	.weak	_ZN1n10std_writerILi1EE7__localE
+	.section	.tbss._ZN1n10std_writerILi1EE7__localE,"awTG",@nobits,_ZN1n10std_writerILi1EE7__localE,comdat
+	.align 8
+	.type	_ZN1n10std_writerILi1EE7__localE, @gnu_unique_object
+	.size	_ZN1n10std_writerILi1EE7__localE, 40
+_ZN1n10std_writerILi1EE7__localE:
+	.zero	40
+	.weak	_ZN1n18__current_resourceE
+	.section	.tbss._ZN1n18__current_resourceE,"awTG",@nobits,_ZN1n18__current_resourceE,comdat
+	.align 8
+	.type	_ZN1n18__current_resourceE, @gnu_unique_object
+	.size	_ZN1n18__current_resourceE, 8
+_ZN1n18__current_resourceE:
+	.zero	8
+	.weak	_ZGVZN1n4heapEvE3res
+	.section	.bss._ZGVZN1n4heapEvE3res,"awG",@nobits,_ZGVZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZGVZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZGVZN1n4heapEvE3res, 8
+_ZGVZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE3res
+	.section	.bss._ZZN1n4heapEvE3res,"awG",@nobits,_ZZN1n4heapEvE3res,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE3res, @gnu_unique_object
+	.size	_ZZN1n4heapEvE3res, 8
+_ZZN1n4heapEvE3res:
+	.zero	8
+	.weak	_ZZN1n4heapEvE7storage
+	.section	.bss._ZZN1n4heapEvE7storage,"awG",@nobits,_ZZN1n4heapEvE7storage,comdat
+	.align 8
+	.type	_ZZN1n4heapEvE7storage, @gnu_unique_object
+	.size	_ZZN1n4heapEvE7storage, 8
+_ZZN1n4heapEvE7storage:
+	.zero	8
+	.section	.rodata.cst2,"aM",@progbits,2
+	.align 2
+.LC1:
+	.byte	10
+	.byte	0
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC9:
+	.quad	0
+	.quad	23
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC24:
+	.long	6
+	.long	100
+	.section	.rodata.cst16
+	.align 16
+.LC54:
+	.quad	65536
+	.quad	0
+	.hidden	DW.ref._ZTIPKc
+	.weak	DW.ref._ZTIPKc
+	.section	.data.rel.local.DW.ref._ZTIPKc,"awG",@progbits,DW.ref._ZTIPKc,comdat
+	.align 8
+	.type	DW.ref._ZTIPKc, @object
+	.size	DW.ref._ZTIPKc, 8
+DW.ref._ZTIPKc:
+	.quad	_ZTIPKc
+	.hidden	DW.ref.__gxx_personality_v0
+	.weak	DW.ref.__gxx_personality_v0
+	.section	.data.rel.local.DW.ref.__gxx_personality_v0,"awG",@progbits,DW.ref.__gxx_personality_v0,comdat
+	.align 8
+	.type	DW.ref.__gxx_personality_v0, @object
+	.size	DW.ref.__gxx_personality_v0, 8
+DW.ref.__gxx_personality_v0:
+	.quad	__gxx_personality_v0
+	.hidden	__dso_handle
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits